@@ -0,0 +1,47 @@
+#!/bin/bash
+#
+# @file benchmark.sh
+# @brief Script to build and run the benchmark application.
+#
+# This script builds the benchmarks against the library sources and runs them.
+# The allocation functions are wrapped at link time, so the benchmarks can
+# report the number of allocations per operation.
+#
+# @usage
+# Run this script from the root of your project, the arguments are passed to
+# the benchmark application:
+#   ./benchmark.sh [--json] [--filter=name] [--time=ms] [--label=revision];
+#
+# Compare two revisions by saving the JSON output of each one:
+#   ./benchmark.sh --json --label="$(git rev-parse --short HEAD)" > benchmark.json;
+
+# Determine the directory of the script
+SCRIPT_DIR=$(dirname "$(readlink -f "$0")");
+# Load helper functions
+source "$SCRIPT_DIR/helper.sh";
+
+# Global Settings.
+BASE_NAME='libstr';   # Base name for the project.
+PROJECT_PATH=$(pwd);  # Root path of the project.
+
+# Dependencies for the benchmarks, the allocation functions are counted.
+BENCHMARK_DEPENDENCIES='-pthread -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc';
+
+# Search paths for benchmark code.
+BENCHMARK_CODE_SEARCH_PATHS="$PROJECT_PATH/include $PROJECT_PATH/src $PROJECT_PATH/benchmarks";
+
+# Build and output paths.
+BENCHMARK_BUILD_PATH="$PROJECT_PATH/build/benchmark";
+BIN_PATH="$PROJECT_PATH/bin/benchmark";
+APP_NAME="$BASE_NAME-benchmark.app";
+
+# Build the benchmark app.
+benchmark_files_to_compile=$(get_files_to_compile "$BENCHMARK_CODE_SEARCH_PATHS");
+build_app "$benchmark_files_to_compile" $BENCHMARK_BUILD_PATH $APP_NAME "$BENCHMARK_DEPENDENCIES" $BIN_PATH > /dev/null;
+
+# Clean precompiled header files from the project directories.
+clean_project_precompiled_headers "$PROJECT_PATH" > /dev/null;
+remove_precompiled_headers "$PROJECT_PATH/benchmarks" > /dev/null;
+
+# Run the benchmarks.
+"$BIN_PATH/$APP_NAME" "$@";
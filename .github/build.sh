@@ -15,6 +15,7 @@
 # - BASE_NAME: Base name for the project.
 # - PROJECT_PATH: Root path of the project.
 # - TEST_DEPENDENCIES: Dependencies for tests.
+# - STATS_TEST_DEPENDENCIES: Dependencies for the tests with the instrumentation counters enabled.
 # - LIBRARY_DEPENDENCIES: Dependencies for libraries.
 # - LIBRARY_CODE_SEARCH_PATHS: Search paths for library code.
 # - TEST_CODE_SEARCH_PATHS: Search paths for test code.
@@ -34,8 +35,9 @@ BASE_NAME='libstr';   # Base name for the project.
 PROJECT_PATH=$(pwd);  # Root path of the project.
 
 # Dependencies for tests and library (add as needed).
-TEST_DEPENDENCIES='';
-LIBRARY_DEPENDENCIES='';
+TEST_DEPENDENCIES='-pthread';
+STATS_TEST_DEPENDENCIES='-pthread -DLIBSTR_ENABLE_STATS';
+LIBRARY_DEPENDENCIES='-pthread';
 
 # Search paths for library and test code.
 LIBRARY_CODE_SEARCH_PATHS="$PROJECT_PATH/include $PROJECT_PATH/src";
@@ -45,10 +47,12 @@ TEST_CODE_SEARCH_PATHS="$LIBRARY_CODE_SEARCH_PATHS $PROJECT_PATH/tests";
 BASE_BUILD_PATH="$PROJECT_PATH/build";
 LIBRARY_BUILD_PATH="$BASE_BUILD_PATH/library";
 TEST_BUILD_PATH="$BASE_BUILD_PATH/test";
+STATS_TEST_BUILD_PATH="$BASE_BUILD_PATH/test-stats";
 
 # Output paths.
 BIN_PATH="$PROJECT_PATH/bin";
 APP_NAME="$BASE_NAME.app";
+STATS_BIN_PATH="$BIN_PATH/stats";
 
 # Clean up build directory before start the build.
 clean_directory "$BASE_BUILD_PATH";
@@ -57,6 +61,9 @@ clean_directory "$BASE_BUILD_PATH";
 app_files_to_compile=$(get_files_to_compile "$TEST_CODE_SEARCH_PATHS");
 build_app "$app_files_to_compile" $TEST_BUILD_PATH $APP_NAME "$TEST_DEPENDENCIES" $BIN_PATH;
 
+# Build the main app again with the instrumentation counters enabled.
+build_app "$app_files_to_compile" $STATS_TEST_BUILD_PATH $APP_NAME "$STATS_TEST_DEPENDENCIES" $STATS_BIN_PATH;
+
 # Create shared and static libraries.
 library_files_to_compile=$(get_files_to_compile "$LIBRARY_CODE_SEARCH_PATHS");
 create_libraries "$library_files_to_compile" $LIBRARY_BUILD_PATH $BASE_NAME "$LIBRARY_DEPENDENCIES" $BIN_PATH;
@@ -64,5 +71,6 @@ create_libraries "$library_files_to_compile" $LIBRARY_BUILD_PATH $BASE_NAME "$LI
 # Clean precompiled header files from the project directories.
 clean_project_precompiled_headers "$PROJECT_PATH" > /dev/null;
 
-# Test the APP execution.
-"$BIN_PATH/$APP_NAME";
+# Test the APP execution, with and without the instrumentation counters.
+"$BIN_PATH/$APP_NAME" || exit 1;
+"$STATS_BIN_PATH/$APP_NAME";
@@ -0,0 +1,284 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "../include/strutils.h"
+#include "benchmark.h"
+
+/**
+ * The number of characters of the generated documents.
+ */
+#define BENCHMARK_DOCUMENT_SIZE (1 << 20)
+
+/**
+ * The number of characters of the huge document.
+ */
+#define BENCHMARK_HUGE_SIZE (32 << 20)
+
+/**
+ * The depth of the nested documents.
+ */
+#define BENCHMARK_NESTED_DEPTH 128
+
+/**
+ * The number of allocations, the benchmarks run on a single thread.
+ */
+static size_t benchmark_allocation_count = 0;
+
+/**
+ * The allocation functions, wrapped at link time with -Wl,--wrap.
+ */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *memory, size_t size);
+
+/**
+ * Counts a malloc() call.
+ */
+void *__wrap_malloc(size_t size) {
+  benchmark_allocation_count++;
+  return __real_malloc(size);
+}
+
+/**
+ * Counts a calloc() call.
+ */
+void *__wrap_calloc(size_t count, size_t size) {
+  benchmark_allocation_count++;
+  return __real_calloc(count, size);
+}
+
+/**
+ * Counts a realloc() call.
+ */
+void *__wrap_realloc(void *memory, size_t size) {
+  benchmark_allocation_count++;
+  return __real_realloc(memory, size);
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t benchmark_allocations(void) {
+  return benchmark_allocation_count;
+}
+
+/**
+ * Returns the next number of a xorshift generator.
+ */
+static uint64_t benchmark_random(uint64_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+/**
+ * Appends a number with a random shape: integer, decimal or exponent.
+ */
+static void benchmark_append_number(struct StringTokenizer *tokenizer, uint64_t *state) {
+  uint64_t random = benchmark_random(state);
+  int64_t integer = (int64_t)(random >> 40) - (1 << 23);
+  char buffer[DTOS_BUFFER_SIZE];
+  switch (random % 3) {
+    case 0:
+      st_append_int(tokenizer, integer);
+      break;
+
+    case 1:
+      snprintf(buffer, sizeof(buffer), "%.6f", integer / 1024.0);
+      st_append_string(tokenizer, buffer);
+      break;
+
+    default:
+      snprintf(buffer, sizeof(buffer), "%.12e", integer * 1e-12 * (double)(random % 1000));
+      st_append_string(tokenizer, buffer);
+      break;
+  }
+}
+
+/**
+ * Appends a string of random words, some of them escaped.
+ */
+static void benchmark_append_words(struct StringTokenizer *tokenizer, uint64_t *state) {
+  static const char *words[] = {"lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "line\\n", "caf\\u00e9", "tab\\t"};
+  size_t count = 2 + benchmark_random(state) % 12;
+  st_append_char(tokenizer, '"');
+  for (size_t i = 0; i < count; i++) {
+    if (i > 0) {
+      st_append_char(tokenizer, ' ');
+    }
+    st_append_string(tokenizer, words[benchmark_random(state) % (sizeof(words) / sizeof(words[0]))]);
+  }
+  st_append_char(tokenizer, '"');
+}
+
+/**
+ * Moves the characters of a tokenizer to a dataset.
+ */
+static int benchmark_dataset_take(struct BenchmarkDataset *dataset, const char *name, struct StringTokenizer *tokenizer) {
+  dataset->name = name;
+  dataset->length = tokenizer->position;
+  dataset->string = st_detach_string(tokenizer);
+  st_destroy(tokenizer);
+  return dataset->string != NULL;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int benchmark_datasets_create(struct BenchmarkDataset *datasets) {
+  uint64_t state = 0x9e3779b97f4a7c15;
+  memset(datasets, 0, BENCHMARK_DATASETS * sizeof(struct BenchmarkDataset));
+  // Number-heavy: an array of integers, decimals and exponents.
+  struct StringTokenizer *tokenizer = st_create_empty(BENCHMARK_DOCUMENT_SIZE);
+  st_append_char(tokenizer, '[');
+  while (tokenizer->position < BENCHMARK_DOCUMENT_SIZE) {
+    benchmark_append_number(tokenizer, &state);
+    st_append_string(tokenizer, ", ");
+  }
+  st_append_string(tokenizer, "0]");
+  int created = benchmark_dataset_take(&datasets[0], "numbers", tokenizer);
+  // String-heavy: an array of strings.
+  tokenizer = st_create_empty(BENCHMARK_DOCUMENT_SIZE);
+  st_append_char(tokenizer, '[');
+  while (tokenizer->position < BENCHMARK_DOCUMENT_SIZE) {
+    benchmark_append_words(tokenizer, &state);
+    st_append_string(tokenizer, ", ");
+  }
+  st_append_string(tokenizer, "\"\"]");
+  created &= benchmark_dataset_take(&datasets[1], "strings", tokenizer);
+  // Deeply nested: objects and arrays nested BENCHMARK_NESTED_DEPTH levels.
+  tokenizer = st_create_empty(BENCHMARK_DOCUMENT_SIZE);
+  st_append_char(tokenizer, '[');
+  while (tokenizer->position < BENCHMARK_DOCUMENT_SIZE) {
+    for (int depth = 0; depth < BENCHMARK_NESTED_DEPTH; depth++) {
+      st_append_string(tokenizer, depth % 2 == 0 ? "{\"node\": " : "[");
+    }
+    benchmark_append_number(tokenizer, &state);
+    for (int depth = BENCHMARK_NESTED_DEPTH - 1; depth >= 0; depth--) {
+      st_append_char(tokenizer, depth % 2 == 0 ? '}' : ']');
+    }
+    st_append_string(tokenizer, ", ");
+  }
+  st_append_string(tokenizer, "null]");
+  created &= benchmark_dataset_take(&datasets[2], "nested", tokenizer);
+  // Tiny: a single small object.
+  tokenizer = st_create_empty(64);
+  st_append_string(tokenizer, "{\"id\": 42, \"name\": \"tiny\", \"ok\": true}");
+  created &= benchmark_dataset_take(&datasets[3], "tiny", tokenizer);
+  // Huge: records mixing every kind of value.
+  tokenizer = st_create_empty(BENCHMARK_HUGE_SIZE);
+  st_append_char(tokenizer, '[');
+  for (int64_t id = 0; tokenizer->position < BENCHMARK_HUGE_SIZE; id++) {
+    st_append_string(tokenizer, "{\"id\": ");
+    st_append_int(tokenizer, id);
+    st_append_string(tokenizer, ", \"name\": ");
+    benchmark_append_words(tokenizer, &state);
+    st_append_string(tokenizer, ", \"score\": ");
+    benchmark_append_number(tokenizer, &state);
+    st_append_string(tokenizer, ", \"tags\": [\"a\", \"b\"], \"active\": true}, ");
+  }
+  st_append_string(tokenizer, "{}]");
+  created &= benchmark_dataset_take(&datasets[4], "huge", tokenizer);
+  return created;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void benchmark_datasets_free(struct BenchmarkDataset *datasets) {
+  for (int i = 0; i < BENCHMARK_DATASETS; i++) {
+    free(datasets[i].string);
+    datasets[i].string = NULL;
+  }
+}
+
+/**
+ * Returns the monotonic time in nanoseconds.
+ */
+static double benchmark_now(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void benchmark_begin(struct BenchmarkOptions *options) {
+  options->printed = 0;
+  if (options->json) {
+    printf("{\n  \"label\": \"%s\",\n  \"benchmarks\": [", options->label != NULL ? options->label : "");
+    return;
+  }
+  printf("%-36s %14s %12s %12s\n", "benchmark", "ns/op", "MB/s", "allocs/op");
+}
+
+/**
+ * {@inheritdoc}
+ */
+int benchmark_run(struct BenchmarkOptions *options, const char *name, const struct BenchmarkDataset *dataset, int (*run)(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work)) {
+  char full_name[128];
+  snprintf(full_name, sizeof(full_name), "%s/%s", name, dataset->name);
+  if (options->filter != NULL && strstr(full_name, options->filter) == NULL) {
+    return 1;
+  }
+  // Warm up, then find the number of calls that lasts the minimum time.
+  struct BenchmarkWork work = {0, 0};
+  if (run(dataset, &work) == 0 || work.ops == 0) {
+    fprintf(stderr, "%s failed.\n", full_name);
+    return 0;
+  }
+  double min_time = options->min_time_ms * 1e6;
+  size_t calls = 1;
+  while (1) {
+    double start = benchmark_now();
+    for (size_t i = 0; i < calls; i++) {
+      run(dataset, &work);
+    }
+    if (benchmark_now() - start >= min_time / 4 || calls >= ((size_t)1 << 30)) {
+      break;
+    }
+    calls *= 2;
+  }
+  calls *= 4;
+  // Keep the fastest sample, it is the least disturbed by the system.
+  double best = 0;
+  size_t allocations = 0;
+  for (int sample = 0; sample < BENCHMARK_SAMPLES; sample++) {
+    size_t first_allocation = benchmark_allocations();
+    double start = benchmark_now();
+    for (size_t i = 0; i < calls; i++) {
+      run(dataset, &work);
+    }
+    double elapsed = benchmark_now() - start;
+    if (sample == 0 || elapsed < best) {
+      best = elapsed;
+    }
+    allocations = benchmark_allocations() - first_allocation;
+  }
+  double ops = (double)calls * work.ops;
+  double ns_per_op = best / ops;
+  double mb_per_s = (double)calls * work.bytes / (best / 1e9) / (1024 * 1024);
+  double allocations_per_op = allocations / ops;
+  if (options->json) {
+    printf("%s\n    {\"name\": \"%s\", \"dataset\": \"%s\", \"bytes\": %zu, \"ops\": %zu, \"ns_per_op\": %.3f, \"mb_per_s\": %.3f, \"allocs_per_op\": %.3f}",
+           options->printed > 0 ? "," : "", name, dataset->name, work.bytes, work.ops, ns_per_op, mb_per_s, allocations_per_op);
+  }
+  else {
+    printf("%-36s %14.2f %12.2f %12.3f\n", full_name, ns_per_op, mb_per_s, allocations_per_op);
+  }
+  options->printed++;
+  fflush(stdout);
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void benchmark_end(struct BenchmarkOptions *options) {
+  if (options->json) {
+    printf("\n  ]\n}\n");
+  }
+}
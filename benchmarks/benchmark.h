@@ -0,0 +1,152 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdlib.h>
+
+/**
+ * The number of datasets.
+ */
+#define BENCHMARK_DATASETS 5
+
+/**
+ * The number of timed samples of a benchmark, the fastest one is reported.
+ */
+#define BENCHMARK_SAMPLES 5
+
+/**
+ * The default minimum duration of a sample, in milliseconds.
+ */
+#define BENCHMARK_MIN_TIME_MS 100
+
+/**
+ * Struct definition for a generated dataset.
+ *
+ * The datasets are generated from a fixed seed, so every run and every
+ * revision benchmarks the same characters.
+ */
+struct BenchmarkDataset {
+
+  /**
+   * The name of the dataset.
+   */
+  const char *name;
+
+  /**
+   * The null terminated characters of the dataset.
+   */
+  char *string;
+
+  /**
+   * The number of characters of the dataset.
+   */
+  size_t length;
+};
+
+/**
+ * Struct definition for the work done by a single benchmark call.
+ */
+struct BenchmarkWork {
+
+  /**
+   * The number of operations done.
+   */
+  size_t ops;
+
+  /**
+   * The number of bytes processed.
+   */
+  size_t bytes;
+};
+
+/**
+ * Struct definition for the options of a benchmark run.
+ */
+struct BenchmarkOptions {
+
+  /**
+   * Only the benchmarks whose name contains the filter are run, or NULL.
+   */
+  const char *filter;
+
+  /**
+   * The minimum duration of a sample, in milliseconds.
+   */
+  long min_time_ms;
+
+  /**
+   * Prints the results as JSON when set.
+   */
+  int json;
+
+  /**
+   * The label of the revision, printed with the JSON results.
+   */
+  const char *label;
+
+  /**
+   * The number of benchmarks printed so far.
+   */
+  size_t printed;
+};
+
+/**
+ * Generates the datasets: number-heavy, string-heavy, deeply nested, tiny and huge documents.
+ *
+ * @param struct BenchmarkDataset *datasets
+ *   The BENCHMARK_DATASETS datasets to fill.
+ *
+ * @return int
+ *   Returns 1 on success, otherwise 0.
+ */
+int benchmark_datasets_create(struct BenchmarkDataset *datasets);
+
+/**
+ * Frees the generated datasets.
+ *
+ * @param struct BenchmarkDataset *datasets
+ *   The BENCHMARK_DATASETS datasets to free.
+ */
+void benchmark_datasets_free(struct BenchmarkDataset *datasets);
+
+/**
+ * Returns the number of allocations done by the benchmark so far.
+ *
+ * @return size_t
+ *   The number of malloc(), calloc() and realloc() calls.
+ */
+size_t benchmark_allocations(void);
+
+/**
+ * Prints the start of the results.
+ *
+ * @param struct BenchmarkOptions *options
+ *   The options of the run.
+ */
+void benchmark_begin(struct BenchmarkOptions *options);
+
+/**
+ * Times a benchmark and prints ns/op, MB/s and allocations/op.
+ *
+ * @param struct BenchmarkOptions *options
+ *   The options of the run.
+ * @param const char *name
+ *   The name of the benchmark.
+ * @param const struct BenchmarkDataset *dataset
+ *   The dataset passed to the benchmark.
+ * @param int (*run)(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work)
+ *   The benchmark, returns 1 on success and reports the work done by a call.
+ *
+ * @return int
+ *   Returns 1 if the benchmark succeeded or was filtered out, otherwise 0.
+ */
+int benchmark_run(struct BenchmarkOptions *options, const char *name, const struct BenchmarkDataset *dataset, int (*run)(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work));
+
+/**
+ * Prints the end of the results.
+ *
+ * @param struct BenchmarkOptions *options
+ *   The options of the run.
+ */
+void benchmark_end(struct BenchmarkOptions *options);
+
+#endif // BENCHMARK_H
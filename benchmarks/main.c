@@ -0,0 +1,429 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+#include "benchmark.h"
+
+/**
+ * The number of records appended by the append benchmarks.
+ */
+#define BENCHMARK_RECORDS 10000
+
+/**
+ * The number of values converted by the numeric conversion benchmarks.
+ */
+#define BENCHMARK_VALUES 4096
+
+/**
+ * The dataset of the benchmarks that generate their own characters.
+ */
+static struct BenchmarkDataset benchmark_records = {"records", NULL, 0};
+
+/**
+ * The numbers of the number-heavy dataset as null terminated strings.
+ */
+static struct BenchmarkDataset benchmark_numeric_strings = {"numeric-strings", NULL, 0};
+
+/**
+ * The views of the numeric strings.
+ */
+static struct StringView *benchmark_numeric_views = NULL;
+
+/**
+ * The number of numeric strings.
+ */
+static size_t benchmark_numeric_count = 0;
+
+/**
+ * Extracts every string of a dataset with st_sub_string().
+ */
+static int benchmark_sub_string(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  struct StringTokenizer *tokenizer = st_create_n(dataset->string, dataset->length);
+  if (tokenizer == NULL) {
+    return 0;
+  }
+  work->ops = 0;
+  work->bytes = dataset->length;
+  char token;
+  while ((token = st_current_token(tokenizer)) != '\0') {
+    if (token == '"') {
+      char *string = st_sub_string(tokenizer, '"', '"');
+      if (string == NULL) {
+        break;
+      }
+      free(string);
+      work->ops++;
+    }
+    st_next_token(tokenizer);
+  }
+  st_destroy(tokenizer);
+  return 1;
+}
+
+/**
+ * Extracts every number of a dataset, skipping the strings.
+ *
+ * The mode selects the extraction: 1 for st_extract_double(), 0 for
+ * st_extract_double_to() and -1 for st_extract_int64() first.
+ */
+static int benchmark_extract_numbers(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work, const int mode) {
+  struct StringTokenizer *tokenizer = st_create_n(dataset->string, dataset->length);
+  if (tokenizer == NULL) {
+    return 0;
+  }
+  work->ops = 0;
+  work->bytes = dataset->length;
+  struct StringView view;
+  char token;
+  while ((token = st_current_token(tokenizer)) != '\0') {
+    if (token == '"') {
+      st_sub_string_view(tokenizer, '"', '"', &view);
+    }
+    else if (token == '-' || (token >= '0' && token <= '9')) {
+      double value;
+      int64_t integer;
+      if (mode < 0) {
+        // Integers first, the rest as doubles.
+        if (st_extract_int64(tokenizer, &integer) == 0 && st_extract_double_to(tokenizer, &value) == 0) {
+          break;
+        }
+      }
+      else if (mode > 0) {
+        double *number = st_extract_double(tokenizer);
+        if (number == NULL) {
+          break;
+        }
+        free(number);
+      }
+      else if (st_extract_double_to(tokenizer, &value) == 0) {
+        break;
+      }
+      work->ops++;
+    }
+    st_next_token(tokenizer);
+  }
+  st_destroy(tokenizer);
+  return 1;
+}
+
+/**
+ * Extracts every number of a dataset with st_extract_double().
+ */
+static int benchmark_extract_double(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  return benchmark_extract_numbers(dataset, work, 1);
+}
+
+/**
+ * Extracts every number of a dataset with st_extract_double_to().
+ */
+static int benchmark_extract_double_to(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  return benchmark_extract_numbers(dataset, work, 0);
+}
+
+/**
+ * Extracts every number of a dataset with st_extract_int64(), then st_extract_double_to().
+ */
+static int benchmark_extract_int64(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  return benchmark_extract_numbers(dataset, work, -1);
+}
+
+/**
+ * Parses a dataset with st_json_parse() and no callbacks.
+ */
+static int benchmark_json_parse(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  static const struct JsonHandler handler = {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL};
+  struct StringTokenizer *tokenizer = st_create_n(dataset->string, dataset->length);
+  if (tokenizer == NULL) {
+    return 0;
+  }
+  int parsed = st_json_parse(tokenizer, &handler, NULL);
+  st_destroy(tokenizer);
+  work->ops = 1;
+  work->bytes = dataset->length;
+  return parsed;
+}
+
+/**
+ * Serializes records with the st_append_*() functions.
+ */
+static int benchmark_append(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  struct StringTokenizer *tokenizer = st_create_empty(1);
+  if (tokenizer == NULL) {
+    return 0;
+  }
+  int appended = st_append_char(tokenizer, '[');
+  for (int64_t id = 0; id < BENCHMARK_RECORDS; id++) {
+    double score = id / 16.0;
+    appended &= st_append_string(tokenizer, "{\"id\": ");
+    appended &= st_append_int(tokenizer, id);
+    appended &= st_append_string(tokenizer, ", \"name\": ");
+    appended &= st_append_escaped_string(tokenizer, "line\n\"quoted\"");
+    appended &= st_append_string(tokenizer, ", \"score\": ");
+    appended &= st_append_double(tokenizer, &score);
+    appended &= st_append_string(tokenizer, "}, ");
+  }
+  appended &= st_append_string(tokenizer, "{}]");
+  work->ops = BENCHMARK_RECORDS;
+  work->bytes = tokenizer->position;
+  st_destroy(tokenizer);
+  return appended;
+}
+
+/**
+ * Serializes records into a chained output kept in memory.
+ */
+static int benchmark_output_append(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  struct StringOutput *output = st_output_create(-1, 0, 0);
+  if (output == NULL) {
+    return 0;
+  }
+  int appended = st_output_append_char(output, '[');
+  for (int64_t id = 0; id < BENCHMARK_RECORDS; id++) {
+    appended &= st_output_append_string(output, "{\"id\": ");
+    appended &= st_output_append_int(output, id);
+    appended &= st_output_append_string(output, ", \"name\": \"line\\n\\\"quoted\\\"\", \"score\": ");
+    appended &= st_output_append_double(output, id / 16.0);
+    appended &= st_output_append_string(output, "}, ");
+  }
+  appended &= st_output_append_string(output, "{}]");
+  work->ops = BENCHMARK_RECORDS;
+  work->bytes = output->length;
+  st_output_destroy(output);
+  return appended;
+}
+
+/**
+ * Converts integers with itos().
+ */
+static int benchmark_itos(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  work->ops = BENCHMARK_VALUES;
+  work->bytes = 0;
+  for (int i = 0; i < BENCHMARK_VALUES; i++) {
+    char *string = itos((i - BENCHMARK_VALUES / 2) * 524287);
+    if (string == NULL) {
+      return 0;
+    }
+    work->bytes += strlen(string);
+    free(string);
+  }
+  return 1;
+}
+
+/**
+ * Converts integers with itos_to().
+ */
+static int benchmark_itos_to(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  char buffer[ITOS_BUFFER_SIZE];
+  work->ops = BENCHMARK_VALUES;
+  work->bytes = 0;
+  for (int i = 0; i < BENCHMARK_VALUES; i++) {
+    work->bytes += itos_to(buffer, (i - BENCHMARK_VALUES / 2) * 524287);
+  }
+  return 1;
+}
+
+/**
+ * Converts long doubles with ldtos().
+ */
+static int benchmark_ldtos(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  work->ops = BENCHMARK_VALUES;
+  work->bytes = 0;
+  for (int i = 0; i < BENCHMARK_VALUES; i++) {
+    char *string = ldtos((i - BENCHMARK_VALUES / 2) * 1024.0L / 3.0L);
+    if (string == NULL) {
+      return 0;
+    }
+    work->bytes += strlen(string);
+    free(string);
+  }
+  return 1;
+}
+
+/**
+ * Converts doubles with dtos_to().
+ */
+static int benchmark_dtos_to(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  char buffer[DTOS_BUFFER_SIZE];
+  work->ops = BENCHMARK_VALUES;
+  work->bytes = 0;
+  for (int i = 0; i < BENCHMARK_VALUES; i++) {
+    work->bytes += dtos_to(buffer, (i - BENCHMARK_VALUES / 2) * 1024.0 / 3.0);
+  }
+  return 1;
+}
+
+/**
+ * Converts doubles with six fixed decimals with dtos_fixed_to().
+ */
+static int benchmark_dtos_fixed_to(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  char buffer[DTOS_FIXED_BUFFER_SIZE];
+  work->ops = BENCHMARK_VALUES;
+  work->bytes = 0;
+  for (int i = 0; i < BENCHMARK_VALUES; i++) {
+    work->bytes += dtos_fixed_to(buffer, (i - BENCHMARK_VALUES / 2) * 1024.0 / 3.0, 6);
+  }
+  return 1;
+}
+
+/**
+ * Converts numeric strings with stold().
+ */
+static int benchmark_stold(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  work->ops = 0;
+  work->bytes = dataset->length;
+  volatile long double sum = 0;
+  for (const char *string = dataset->string; string < dataset->string + dataset->length; string += strlen(string) + 1) {
+    sum += stold(string);
+    work->ops++;
+  }
+  return 1;
+}
+
+/**
+ * Converts numeric strings with stod().
+ */
+static int benchmark_stod(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  work->ops = 0;
+  work->bytes = dataset->length;
+  volatile double sum = 0;
+  for (const char *string = dataset->string; string < dataset->string + dataset->length; string += strlen(string) + 1) {
+    double value = 0;
+    stod(string, strlen(string), &value);
+    sum += value;
+    work->ops++;
+  }
+  return 1;
+}
+
+/**
+ * Converts the numeric strings with stod_batch().
+ */
+static int benchmark_stod_batch(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  double *values = (double *)malloc(benchmark_numeric_count * sizeof(double));
+  if (values == NULL) {
+    return 0;
+  }
+  work->ops = stod_batch(benchmark_numeric_views, benchmark_numeric_count, values);
+  work->bytes = dataset->length;
+  free(values);
+  return work->ops == benchmark_numeric_count;
+}
+
+/**
+ * Converts integers with i64tos_batch().
+ */
+static int benchmark_i64tos_batch(const struct BenchmarkDataset *dataset, struct BenchmarkWork *work) {
+  int64_t values[BENCHMARK_VALUES];
+  char buffer[BENCHMARK_VALUES * (ITOS_BUFFER_SIZE - 1) + 1];
+  for (int i = 0; i < BENCHMARK_VALUES; i++) {
+    values[i] = (i - BENCHMARK_VALUES / 2) * 524287;
+  }
+  work->ops = BENCHMARK_VALUES;
+  work->bytes = i64tos_batch(buffer, values, BENCHMARK_VALUES, NULL);
+  return 1;
+}
+
+/**
+ * Splits the number-heavy dataset into null terminated numeric strings.
+ */
+static int benchmark_numeric_strings_create(const struct BenchmarkDataset *numbers) {
+  char *string = (char *)malloc(numbers->length + 1);
+  if (string == NULL) {
+    return 0;
+  }
+  size_t length = 0;
+  for (size_t i = 0; i < numbers->length; i++) {
+    char token = numbers->string[i];
+    if (token == '[' || token == ']' || token == ' ') {
+      continue;
+    }
+    string[length++] = token == ',' ? '\0' : token;
+  }
+  string[length] = '\0';
+  benchmark_numeric_strings.string = string;
+  benchmark_numeric_strings.length = length;
+  // Point a view to every numeric string.
+  for (size_t i = 0; i < length; i += strlen(string + i) + 1) {
+    benchmark_numeric_count++;
+  }
+  benchmark_numeric_views = (struct StringView *)malloc(benchmark_numeric_count * sizeof(struct StringView));
+  if (benchmark_numeric_views == NULL) {
+    return 0;
+  }
+  benchmark_numeric_count = 0;
+  for (size_t i = 0; i < length; i += strlen(string + i) + 1) {
+    benchmark_numeric_views[benchmark_numeric_count++] = sv_from_string(string + i);
+  }
+  return 1;
+}
+
+/**
+ * Benchmark program controller function.
+ *
+ * Usage: libstr-benchmark.app [--json] [--filter=name] [--time=ms] [--label=revision]
+ *
+ * @param int argc
+ *   The number of arguments passed by the user in the command line.
+ * @param array argv
+ *   Array of char, the arguments names.
+ *
+ * @return int
+ *   The constant that represent the exit status.
+ */
+int main(int argc, char const *argv[]) {
+  struct BenchmarkOptions options = {NULL, BENCHMARK_MIN_TIME_MS, 0, NULL, 0};
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--json") == 0) {
+      options.json = 1;
+    }
+    else if (strncmp(argv[i], "--filter=", 9) == 0) {
+      options.filter = argv[i] + 9;
+    }
+    else if (strncmp(argv[i], "--time=", 7) == 0) {
+      options.min_time_ms = atol(argv[i] + 7) > 0 ? atol(argv[i] + 7) : BENCHMARK_MIN_TIME_MS;
+    }
+    else if (strncmp(argv[i], "--label=", 8) == 0) {
+      options.label = argv[i] + 8;
+    }
+    else {
+      fprintf(stderr, "Usage: %s [--json] [--filter=name] [--time=ms] [--label=revision]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  // Generate the datasets.
+  struct BenchmarkDataset datasets[BENCHMARK_DATASETS];
+  if (benchmark_datasets_create(datasets) == 0 || benchmark_numeric_strings_create(&datasets[0]) == 0) {
+    fprintf(stderr, "The datasets could not be generated.\n");
+    return EXIT_FAILURE;
+  }
+  // Run the benchmarks.
+  int succeeded = 1;
+  benchmark_begin(&options);
+  for (int i = 0; i < BENCHMARK_DATASETS; i++) {
+    succeeded &= benchmark_run(&options, "st_json_parse", &datasets[i], benchmark_json_parse);
+  }
+  succeeded &= benchmark_run(&options, "st_sub_string", &datasets[1], benchmark_sub_string);
+  succeeded &= benchmark_run(&options, "st_sub_string", &datasets[4], benchmark_sub_string);
+  succeeded &= benchmark_run(&options, "st_extract_double", &datasets[0], benchmark_extract_double);
+  succeeded &= benchmark_run(&options, "st_extract_double", &datasets[4], benchmark_extract_double);
+  succeeded &= benchmark_run(&options, "st_extract_double_to", &datasets[0], benchmark_extract_double_to);
+  succeeded &= benchmark_run(&options, "st_extract_double_to", &datasets[4], benchmark_extract_double_to);
+  succeeded &= benchmark_run(&options, "st_extract_int64", &datasets[0], benchmark_extract_int64);
+  succeeded &= benchmark_run(&options, "st_extract_int64", &datasets[4], benchmark_extract_int64);
+  succeeded &= benchmark_run(&options, "st_append", &benchmark_records, benchmark_append);
+  succeeded &= benchmark_run(&options, "st_output_append", &benchmark_records, benchmark_output_append);
+  succeeded &= benchmark_run(&options, "itos", &benchmark_records, benchmark_itos);
+  succeeded &= benchmark_run(&options, "itos_to", &benchmark_records, benchmark_itos_to);
+  succeeded &= benchmark_run(&options, "i64tos_batch", &benchmark_records, benchmark_i64tos_batch);
+  succeeded &= benchmark_run(&options, "ldtos", &benchmark_records, benchmark_ldtos);
+  succeeded &= benchmark_run(&options, "dtos_to", &benchmark_records, benchmark_dtos_to);
+  succeeded &= benchmark_run(&options, "dtos_fixed_to", &benchmark_records, benchmark_dtos_fixed_to);
+  succeeded &= benchmark_run(&options, "stold", &benchmark_numeric_strings, benchmark_stold);
+  succeeded &= benchmark_run(&options, "stod", &benchmark_numeric_strings, benchmark_stod);
+  succeeded &= benchmark_run(&options, "stod_batch", &benchmark_numeric_strings, benchmark_stod_batch);
+  benchmark_end(&options);
+  free(benchmark_numeric_views);
+  free(benchmark_numeric_strings.string);
+  benchmark_datasets_free(datasets);
+  return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,3271 @@
+# 0 "/root/repo/src/char_class.c"
+# 1 "/root/repo/build/library//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "/root/repo/src/char_class.c"
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 2 "/root/repo/src/char_class.c" 2
+# 1 "/root/repo/src/../include/strutils.h" 1
+
+
+
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 56 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 30 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+
+
+
+
+
+typedef __off_t off_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+
+
+
+
+typedef __ssize_t ssize_t;
+
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 5 "/root/repo/src/../include/strutils.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 6 "/root/repo/src/../include/strutils.h" 2
+
+
+
+
+
+
+
+
+# 13 "/root/repo/src/../include/strutils.h"
+struct StringView {
+
+
+
+
+  const char *ptr;
+
+
+
+
+  size_t len;
+};
+# 35 "/root/repo/src/../include/strutils.h"
+struct StringView sv_from_string(const char *string);
+# 48 "/root/repo/src/../include/strutils.h"
+int sv_compare(const struct StringView *a, const struct StringView *b);
+# 61 "/root/repo/src/../include/strutils.h"
+int sv_equals(const struct StringView *view, const char *string);
+# 72 "/root/repo/src/../include/strutils.h"
+uint64_t sv_hash(const struct StringView *view);
+# 84 "/root/repo/src/../include/strutils.h"
+char *sv_to_string(const struct StringView *view);
+# 97 "/root/repo/src/../include/strutils.h"
+int sv_to_double(const struct StringView *view, double *value);
+# 110 "/root/repo/src/../include/strutils.h"
+int sv_to_int64(const struct StringView *view, int64_t *value);
+# 122 "/root/repo/src/../include/strutils.h"
+enum StringCharClassBits {
+
+
+
+
+  ST_CLASS_WHITESPACE = 1 << 0,
+
+
+
+
+  ST_CLASS_DIGIT = 1 << 1,
+
+
+
+
+  ST_CLASS_NUMERIC = 1 << 2,
+
+
+
+
+  ST_CLASS_HEX = 1 << 3,
+
+
+
+
+  ST_CLASS_STRUCTURAL = 1 << 4,
+
+
+
+
+
+  ST_CLASS_ESCAPE = 1 << 5,
+
+
+
+
+  ST_CLASS_ALPHA = 1 << 6,
+};
+
+
+
+
+
+
+extern const uint8_t st_char_classes[256];
+
+
+
+
+struct StringCharClass {
+
+
+
+
+  uint8_t members[256];
+};
+# 189 "/root/repo/src/../include/strutils.h"
+void st_char_class_init(struct StringCharClass *char_class, const unsigned int classes, const char *members);
+# 202 "/root/repo/src/../include/strutils.h"
+static inline int st_char_is(const char token, const unsigned int classes) {
+  return (st_char_classes[(unsigned char)token] & classes) != 0;
+}
+# 217 "/root/repo/src/../include/strutils.h"
+static inline int st_char_class_has(const struct StringCharClass *char_class, const char token) {
+  return char_class->members[(unsigned char)token] != 0;
+}
+# 231 "/root/repo/src/../include/strutils.h"
+enum StringScanIsa {
+  ST_SCAN_SCALAR,
+  ST_SCAN_SSE2,
+  ST_SCAN_AVX2,
+  ST_SCAN_AVX512,
+};
+# 247 "/root/repo/src/../include/strutils.h"
+int st_scan_isa_supported(const enum StringScanIsa isa);
+# 261 "/root/repo/src/../include/strutils.h"
+int st_scan_set_isa(const enum StringScanIsa isa);
+
+
+
+
+
+
+
+enum StringScanIsa st_scan_isa();
+# 284 "/root/repo/src/../include/strutils.h"
+size_t st_scan_delimiter(const char *string, const size_t length, const char delim);
+# 299 "/root/repo/src/../include/strutils.h"
+size_t st_scan_non_whitespace(const char *string, const size_t length);
+# 312 "/root/repo/src/../include/strutils.h"
+size_t st_scan_nul(const char *string, const size_t length);
+# 328 "/root/repo/src/../include/strutils.h"
+size_t st_scan_escape(const char *string, const size_t length);
+# 343 "/root/repo/src/../include/strutils.h"
+size_t st_scan_class(const char *string, const size_t length, const struct StringCharClass *char_class);
+# 365 "/root/repo/src/../include/strutils.h"
+struct StringArenaBlock;
+
+
+
+
+
+
+
+struct StringArena {
+
+
+
+
+  struct StringArenaBlock *head;
+
+
+
+
+  size_t block_size;
+
+
+
+
+  size_t used;
+};
+# 400 "/root/repo/src/../include/strutils.h"
+struct StringArena *st_arena_create(const size_t block_size);
+# 413 "/root/repo/src/../include/strutils.h"
+void *st_arena_alloc(struct StringArena *arena, const size_t size);
+# 426 "/root/repo/src/../include/strutils.h"
+char *st_arena_string(struct StringArena *arena, const struct StringView *view);
+# 436 "/root/repo/src/../include/strutils.h"
+void st_arena_reset(struct StringArena *arena);
+
+
+
+
+
+
+
+void st_arena_destroy(struct StringArena *arena);
+
+
+
+
+
+
+
+struct StringArena *st_arena_acquire(void);
+# 462 "/root/repo/src/../include/strutils.h"
+void st_arena_release(struct StringArena *arena);
+
+
+
+
+
+
+void st_arena_pool_clear(void);
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 477 "/root/repo/src/../include/strutils.h" 2
+# 486 "/root/repo/src/../include/strutils.h"
+
+# 486 "/root/repo/src/../include/strutils.h"
+struct StringStats {
+
+
+
+
+  uint64_t bytes_scanned;
+
+
+
+
+  uint64_t tokens_extracted;
+
+
+
+
+  uint64_t allocations;
+
+
+
+
+  uint64_t reallocations;
+
+
+
+
+  uint64_t expansions;
+
+
+
+
+  uint64_t bytes_copied;
+
+
+
+
+  uint64_t conversions;
+
+
+
+
+  uint64_t conversion_ns;
+};
+
+struct StringTokenizer;
+# 554 "/root/repo/src/../include/strutils.h"
+int st_stats_available(void);
+
+
+
+
+
+
+
+void st_stats_enable(const int enabled);
+
+
+
+
+
+
+
+void st_stats_snapshot(struct StringStats *stats);
+
+
+
+
+void st_stats_reset(void);
+# 589 "/root/repo/src/../include/strutils.h"
+void st_stats_add(const struct StringTokenizer *tokenizer, const size_t field, const uint64_t value);
+# 602 "/root/repo/src/../include/strutils.h"
+uint64_t st_stats_clock(const struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 84 "/usr/include/stdio.h" 3 4
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 434 "/usr/include/stdio.h" 3 4
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 611 "/root/repo/src/../include/strutils.h" 2
+# 620 "/root/repo/src/../include/strutils.h"
+
+# 620 "/root/repo/src/../include/strutils.h"
+struct StringStream {
+
+
+
+
+
+  ssize_t (*read)(void *context, char *buffer, size_t size);
+
+
+
+
+  void *context;
+
+
+
+
+  int fd;
+
+
+
+
+  size_t chunk_size;
+
+
+
+
+  size_t capacity;
+
+
+
+
+  size_t offset;
+
+
+
+
+  int eof;
+
+
+
+
+  int error;
+};
+
+
+
+
+enum StringGrowthPolicy {
+
+
+
+
+  ST_GROWTH_GEOMETRIC,
+
+
+
+
+  ST_GROWTH_LINEAR,
+};
+# 693 "/root/repo/src/../include/strutils.h"
+enum StringOwnership {
+
+
+
+
+  ST_STRING_BORROWED,
+
+
+
+
+  ST_STRING_OWNED,
+
+
+
+
+  ST_STRING_MAPPED,
+
+
+
+
+  ST_STRING_INLINE,
+};
+
+
+
+
+struct StringTokenizer {
+
+
+
+
+  char *string;
+
+
+
+
+  size_t length;
+
+
+
+
+  size_t position;
+
+
+
+
+  size_t incremental_factor;
+
+
+
+
+  enum StringGrowthPolicy growth_policy;
+
+
+
+
+  size_t max_increment;
+
+
+
+
+  struct StringStream *stream;
+
+
+
+
+  enum StringOwnership ownership;
+
+
+
+
+  struct StringArena *arena;
+
+
+
+
+  char inline_buffer[256];
+
+
+
+
+  struct StringStructuralIndex *structural_index;
+
+
+
+
+  struct StringStats *stats;
+};
+# 791 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create(char *string);
+# 806 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_n(char *string, const size_t length);
+# 821 "/root/repo/src/../include/strutils.h"
+void st_init(struct StringTokenizer *tokenizer, char *string, const size_t length);
+# 836 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_mmap(const char *path);
+# 851 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_empty(const size_t string_size);
+# 866 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_fd(const int fd, const size_t chunk_size);
+# 881 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_file(FILE *file, const size_t chunk_size);
+# 900 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_callback(ssize_t (*read)(void *context, char *buffer, size_t size), void *context, const size_t chunk_size);
+# 916 "/root/repo/src/../include/strutils.h"
+int st_ensure(struct StringTokenizer *tokenizer, const size_t size);
+# 930 "/root/repo/src/../include/strutils.h"
+void st_attach_arena(struct StringTokenizer *tokenizer, struct StringArena *arena);
+# 942 "/root/repo/src/../include/strutils.h"
+void st_attach_stats(struct StringTokenizer *tokenizer, struct StringStats *stats);
+# 953 "/root/repo/src/../include/strutils.h"
+void st_reset(struct StringTokenizer *tokenizer);
+# 971 "/root/repo/src/../include/strutils.h"
+int st_rebind(struct StringTokenizer *tokenizer, char *string, const size_t length);
+# 988 "/root/repo/src/../include/strutils.h"
+char *st_detach_string(struct StringTokenizer *tokenizer);
+# 1001 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_pool_acquire(const size_t string_size);
+# 1012 "/root/repo/src/../include/strutils.h"
+void st_pool_release(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+void st_pool_clear(void);
+
+
+
+
+
+
+
+void st_destroy(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+void st_next_token(struct StringTokenizer *tokenizer);
+# 1046 "/root/repo/src/../include/strutils.h"
+char st_current_token(struct StringTokenizer *tokenizer);
+# 1061 "/root/repo/src/../include/strutils.h"
+char *st_sub_string(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim);
+# 1074 "/root/repo/src/../include/strutils.h"
+char *st_slice_string(struct StringTokenizer *tokenizer, const int length);
+# 1085 "/root/repo/src/../include/strutils.h"
+char *st_extract_numbers(struct StringTokenizer *tokenizer);
+# 1105 "/root/repo/src/../include/strutils.h"
+int st_sub_string_view(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim, struct StringView *view);
+# 1123 "/root/repo/src/../include/strutils.h"
+int st_slice_string_view(struct StringTokenizer *tokenizer, const int length, struct StringView *view);
+# 1139 "/root/repo/src/../include/strutils.h"
+int st_extract_numbers_view(struct StringTokenizer *tokenizer, struct StringView *view);
+# 1158 "/root/repo/src/../include/strutils.h"
+int st_extract_until_view(struct StringTokenizer *tokenizer, const struct StringCharClass *delimiters, struct StringView *view);
+# 1172 "/root/repo/src/../include/strutils.h"
+double *st_extract_double(struct StringTokenizer *tokenizer);
+# 1188 "/root/repo/src/../include/strutils.h"
+int st_extract_double_to(struct StringTokenizer *tokenizer, double *value);
+# 1207 "/root/repo/src/../include/strutils.h"
+int st_extract_int64(struct StringTokenizer *tokenizer, int64_t *value);
+# 1222 "/root/repo/src/../include/strutils.h"
+int *st_extract_boolean(struct StringTokenizer *tokenizer, const char *bool_value, const int int_value);
+# 1235 "/root/repo/src/../include/strutils.h"
+int st_starts_with(struct StringTokenizer *tokenizer, const char *needle);
+# 1251 "/root/repo/src/../include/strutils.h"
+int st_expand_string(struct StringTokenizer *tokenizer, const size_t size);
+# 1264 "/root/repo/src/../include/strutils.h"
+void st_set_growth_policy(struct StringTokenizer *tokenizer, const enum StringGrowthPolicy policy, const size_t max_increment);
+# 1278 "/root/repo/src/../include/strutils.h"
+int st_reserve(struct StringTokenizer *tokenizer, const size_t length);
+# 1292 "/root/repo/src/../include/strutils.h"
+int st_shrink_to_fit(struct StringTokenizer *tokenizer);
+# 1305 "/root/repo/src/../include/strutils.h"
+int st_append_string(struct StringTokenizer *tokenizer, const char *string);
+# 1320 "/root/repo/src/../include/strutils.h"
+int st_append_n(struct StringTokenizer *tokenizer, const char *string, const size_t length);
+# 1333 "/root/repo/src/../include/strutils.h"
+int st_append_char(struct StringTokenizer *tokenizer, const char token);
+# 1350 "/root/repo/src/../include/strutils.h"
+int st_append_many(struct StringTokenizer *tokenizer, const struct StringView *fragments, const size_t count);
+# 1365 "/root/repo/src/../include/strutils.h"
+int st_append_quoted_string(struct StringTokenizer *tokenizer, const char *string);
+# 1381 "/root/repo/src/../include/strutils.h"
+int st_append_escaped_string(struct StringTokenizer *tokenizer, const char *string);
+# 1398 "/root/repo/src/../include/strutils.h"
+int st_append_escaped_n(struct StringTokenizer *tokenizer, const char *string, const size_t length);
+# 1411 "/root/repo/src/../include/strutils.h"
+int st_append_int(struct StringTokenizer *tokenizer, const int64_t value);
+# 1427 "/root/repo/src/../include/strutils.h"
+int st_append_double(struct StringTokenizer *tokenizer, const double *value);
+# 1442 "/root/repo/src/../include/strutils.h"
+int st_append_double_precision(struct StringTokenizer *tokenizer, const double *value, const int precision);
+# 1457 "/root/repo/src/../include/strutils.h"
+int st_append_fixed(struct StringTokenizer *tokenizer, const double *value, const int precision);
+# 1473 "/root/repo/src/../include/strutils.h"
+static inline int is_numeric(const char token) {
+  return st_char_is(token, ST_CLASS_NUMERIC);
+}
+# 1517 "/root/repo/src/../include/strutils.h"
+char *itos(int value);
+# 1530 "/root/repo/src/../include/strutils.h"
+size_t itos_to(char *buffer, int value);
+# 1543 "/root/repo/src/../include/strutils.h"
+size_t i64tos_to(char *buffer, int64_t value);
+# 1556 "/root/repo/src/../include/strutils.h"
+size_t u64tos_to(char *buffer, uint64_t value);
+# 1568 "/root/repo/src/../include/strutils.h"
+char *ldtos(long double value);
+# 1579 "/root/repo/src/../include/strutils.h"
+long double stold(const char *numeric_string);
+# 1598 "/root/repo/src/../include/strutils.h"
+size_t stod(const char *string, const size_t length, double *value);
+# 1614 "/root/repo/src/../include/strutils.h"
+size_t dtos_to(char *buffer, const double value);
+# 1632 "/root/repo/src/../include/strutils.h"
+size_t dtos_precision_to(char *buffer, const double value, int precision);
+# 1651 "/root/repo/src/../include/strutils.h"
+size_t dtos_fixed_to(char *buffer, const double value, int precision);
+# 1672 "/root/repo/src/../include/strutils.h"
+size_t stoi64(const char *string, const size_t length, int64_t *value);
+# 1687 "/root/repo/src/../include/strutils.h"
+size_t stod_batch(const struct StringView *views, const size_t count, double *values);
+# 1702 "/root/repo/src/../include/strutils.h"
+size_t stoi64_batch(const struct StringView *views, const size_t count, int64_t *values);
+# 1719 "/root/repo/src/../include/strutils.h"
+size_t i64tos_batch(char *buffer, const int64_t *values, const size_t count, size_t *offsets);
+# 1736 "/root/repo/src/../include/strutils.h"
+size_t dtos_batch(char *buffer, const double *values, const size_t count, size_t *offsets);
+# 1756 "/root/repo/src/../include/strutils.h"
+struct JsonHandler {
+
+
+
+
+  int (*start_object)(void *context);
+
+
+
+
+  int (*end_object)(void *context);
+
+
+
+
+  int (*start_array)(void *context);
+
+
+
+
+  int (*end_array)(void *context);
+
+
+
+
+  int (*key)(void *context, const struct StringView *key);
+
+
+
+
+  int (*string)(void *context, const struct StringView *value);
+
+
+
+
+  int (*number)(void *context, const struct StringView *raw, double value);
+
+
+
+
+  int (*boolean)(void *context, int value);
+
+
+
+
+  int (*null)(void *context);
+};
+# 1822 "/root/repo/src/../include/strutils.h"
+int st_json_parse(struct StringTokenizer *tokenizer, const struct JsonHandler *handler, void *context);
+# 1840 "/root/repo/src/../include/strutils.h"
+int st_json_unescape(const struct StringView *view, char *buffer, size_t *length);
+# 1856 "/root/repo/src/../include/strutils.h"
+int st_skip_value(struct StringTokenizer *tokenizer);
+# 1875 "/root/repo/src/../include/strutils.h"
+int st_find_key(struct StringTokenizer *tokenizer, const char *key);
+# 1892 "/root/repo/src/../include/strutils.h"
+struct StringStructuralIndex {
+
+
+
+
+  size_t *positions;
+
+
+
+
+  size_t count;
+
+
+
+
+
+  uint64_t *in_string;
+
+
+
+
+  size_t length;
+
+
+
+
+  size_t hint;
+};
+# 1935 "/root/repo/src/../include/strutils.h"
+int st_build_structural_index(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+void st_drop_structural_index(struct StringTokenizer *tokenizer);
+# 1956 "/root/repo/src/../include/strutils.h"
+size_t st_structural_next(struct StringStructuralIndex *index, const size_t position);
+# 1969 "/root/repo/src/../include/strutils.h"
+static inline int st_structural_in_string(const struct StringStructuralIndex *index, const size_t position) {
+  return (int)((index->in_string[position / 64] >> (position % 64)) & 1);
+}
+# 1983 "/root/repo/src/../include/strutils.h"
+void st_next_structural(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/uio.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 2 3 4
+
+
+
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 3 4
+struct iovec
+  {
+    void *iov_base;
+    size_t iov_len;
+  };
+# 24 "/usr/include/x86_64-linux-gnu/sys/uio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uio_lim.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/sys/uio.h" 2 3 4
+
+
+
+
+
+
+
+# 41 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t readv (int __fd, const struct iovec *__iovec, int __count)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 52 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t writev (int __fd, const struct iovec *__iovec, int __count)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 67 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t preadv (int __fd, const struct iovec *__iovec, int __count,
+         __off_t __offset)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 80 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t pwritev (int __fd, const struct iovec *__iovec, int __count,
+   __off_t __offset)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 174 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+
+# 1991 "/root/repo/src/../include/strutils.h" 2
+# 2010 "/root/repo/src/../include/strutils.h"
+
+# 2010 "/root/repo/src/../include/strutils.h"
+struct StringParallelHandler {
+
+
+
+
+
+  int (*process)(void *context, struct StringTokenizer *tokenizer, void **result);
+
+
+
+
+
+  int (*merge)(void *context, void *result);
+};
+# 2050 "/root/repo/src/../include/strutils.h"
+int st_parallel_lines(char *string, const size_t length, size_t threads, size_t chunk_size, const struct StringParallelHandler *handler, void *context);
+
+
+
+
+struct StringFragments {
+
+
+
+
+  struct StringTokenizer **fragments;
+
+
+
+
+  size_t count;
+
+
+
+
+  struct iovec *iov;
+
+
+
+
+  size_t iov_count;
+
+
+
+
+  size_t length;
+
+
+
+
+  char *separator;
+};
+# 2113 "/root/repo/src/../include/strutils.h"
+int st_parallel_serialize(struct StringFragments *fragments, const size_t count, size_t threads, size_t batch_size, int (*serialize)(void *context, struct StringTokenizer *tokenizer, size_t index), void *context, const char *separator);
+# 2128 "/root/repo/src/../include/strutils.h"
+int st_fragments_stitch(const struct StringFragments *fragments, struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+void st_fragments_free(struct StringFragments *fragments);
+# 2158 "/root/repo/src/../include/strutils.h"
+struct StringOutputBlock;
+# 2167 "/root/repo/src/../include/strutils.h"
+struct StringOutput {
+
+
+
+
+  struct StringOutputBlock *head;
+
+
+
+
+  struct StringOutputBlock *tail;
+
+
+
+
+  struct StringOutputBlock *spare;
+
+
+
+
+  size_t block_size;
+
+
+
+
+  size_t length;
+
+
+
+
+  size_t flush_threshold;
+
+
+
+
+  int fd;
+
+
+
+
+  size_t written;
+
+
+
+
+  int error;
+};
+# 2228 "/root/repo/src/../include/strutils.h"
+struct StringOutput *st_output_create(const int fd, const size_t block_size, const size_t flush_threshold);
+# 2243 "/root/repo/src/../include/strutils.h"
+char *st_output_reserve(struct StringOutput *output, const size_t size);
+# 2256 "/root/repo/src/../include/strutils.h"
+int st_output_commit(struct StringOutput *output, const size_t size);
+# 2271 "/root/repo/src/../include/strutils.h"
+int st_output_append_n(struct StringOutput *output, const char *string, const size_t length);
+# 2284 "/root/repo/src/../include/strutils.h"
+int st_output_append_string(struct StringOutput *output, const char *string);
+# 2297 "/root/repo/src/../include/strutils.h"
+int st_output_append_char(struct StringOutput *output, const char token);
+# 2310 "/root/repo/src/../include/strutils.h"
+int st_output_append_int(struct StringOutput *output, const int64_t value);
+# 2323 "/root/repo/src/../include/strutils.h"
+int st_output_append_double(struct StringOutput *output, const double value);
+# 2338 "/root/repo/src/../include/strutils.h"
+size_t st_output_iov(const struct StringOutput *output, struct iovec *iov, const size_t count);
+# 2353 "/root/repo/src/../include/strutils.h"
+int st_output_flush(struct StringOutput *output);
+
+
+
+
+
+
+
+void st_output_reset(struct StringOutput *output);
+
+
+
+
+
+
+
+void st_output_destroy(struct StringOutput *output);
+# 3 "/root/repo/src/char_class.c" 2
+# 35 "/root/repo/src/char_class.c"
+const uint8_t st_char_classes[256] = {
+  ( (((0) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 0) >= ('0') && ((0) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 0) >= ('0') && ((0) * 16 + 0) <= ('9')) || ((0) * 16 + 0) == '-' || ((0) * 16 + 0) == '+' || ((0) * 16 + 0) == '.' || ((0) * 16 + 0) == 'e' || ((0) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 0) >= ('0') && ((0) * 16 + 0) <= ('9')) || (((0) * 16 + 0) >= ('a') && ((0) * 16 + 0) <= ('f')) || (((0) * 16 + 0) >= ('A') && ((0) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 0) == '{' || ((0) * 16 + 0) == '}' || ((0) * 16 + 0) == '[' || ((0) * 16 + 0) == ']' || ((0) * 16 + 0) == ':' || ((0) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 0) < ' ' || ((0) * 16 + 0) == '"' || ((0) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 0) >= ('a') && ((0) * 16 + 0) <= ('z')) || (((0) * 16 + 0) >= ('A') && ((0) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 1) >= ('0') && ((0) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 1) >= ('0') && ((0) * 16 + 1) <= ('9')) || ((0) * 16 + 1) == '-' || ((0) * 16 + 1) == '+' || ((0) * 16 + 1) == '.' || ((0) * 16 + 1) == 'e' || ((0) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 1) >= ('0') && ((0) * 16 + 1) <= ('9')) || (((0) * 16 + 1) >= ('a') && ((0) * 16 + 1) <= ('f')) || (((0) * 16 + 1) >= ('A') && ((0) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 1) == '{' || ((0) * 16 + 1) == '}' || ((0) * 16 + 1) == '[' || ((0) * 16 + 1) == ']' || ((0) * 16 + 1) == ':' || ((0) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 1) < ' ' || ((0) * 16 + 1) == '"' || ((0) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 1) >= ('a') && ((0) * 16 + 1) <= ('z')) || (((0) * 16 + 1) >= ('A') && ((0) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 2) >= ('0') && ((0) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 2) >= ('0') && ((0) * 16 + 2) <= ('9')) || ((0) * 16 + 2) == '-' || ((0) * 16 + 2) == '+' || ((0) * 16 + 2) == '.' || ((0) * 16 + 2) == 'e' || ((0) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 2) >= ('0') && ((0) * 16 + 2) <= ('9')) || (((0) * 16 + 2) >= ('a') && ((0) * 16 + 2) <= ('f')) || (((0) * 16 + 2) >= ('A') && ((0) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 2) == '{' || ((0) * 16 + 2) == '}' || ((0) * 16 + 2) == '[' || ((0) * 16 + 2) == ']' || ((0) * 16 + 2) == ':' || ((0) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 2) < ' ' || ((0) * 16 + 2) == '"' || ((0) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 2) >= ('a') && ((0) * 16 + 2) <= ('z')) || (((0) * 16 + 2) >= ('A') && ((0) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 3) >= ('0') && ((0) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 3) >= ('0') && ((0) * 16 + 3) <= ('9')) || ((0) * 16 + 3) == '-' || ((0) * 16 + 3) == '+' || ((0) * 16 + 3) == '.' || ((0) * 16 + 3) == 'e' || ((0) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 3) >= ('0') && ((0) * 16 + 3) <= ('9')) || (((0) * 16 + 3) >= ('a') && ((0) * 16 + 3) <= ('f')) || (((0) * 16 + 3) >= ('A') && ((0) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 3) == '{' || ((0) * 16 + 3) == '}' || ((0) * 16 + 3) == '[' || ((0) * 16 + 3) == ']' || ((0) * 16 + 3) == ':' || ((0) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 3) < ' ' || ((0) * 16 + 3) == '"' || ((0) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 3) >= ('a') && ((0) * 16 + 3) <= ('z')) || (((0) * 16 + 3) >= ('A') && ((0) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 4) >= ('0') && ((0) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 4) >= ('0') && ((0) * 16 + 4) <= ('9')) || ((0) * 16 + 4) == '-' || ((0) * 16 + 4) == '+' || ((0) * 16 + 4) == '.' || ((0) * 16 + 4) == 'e' || ((0) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 4) >= ('0') && ((0) * 16 + 4) <= ('9')) || (((0) * 16 + 4) >= ('a') && ((0) * 16 + 4) <= ('f')) || (((0) * 16 + 4) >= ('A') && ((0) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 4) == '{' || ((0) * 16 + 4) == '}' || ((0) * 16 + 4) == '[' || ((0) * 16 + 4) == ']' || ((0) * 16 + 4) == ':' || ((0) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 4) < ' ' || ((0) * 16 + 4) == '"' || ((0) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 4) >= ('a') && ((0) * 16 + 4) <= ('z')) || (((0) * 16 + 4) >= ('A') && ((0) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 5) >= ('0') && ((0) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 5) >= ('0') && ((0) * 16 + 5) <= ('9')) || ((0) * 16 + 5) == '-' || ((0) * 16 + 5) == '+' || ((0) * 16 + 5) == '.' || ((0) * 16 + 5) == 'e' || ((0) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 5) >= ('0') && ((0) * 16 + 5) <= ('9')) || (((0) * 16 + 5) >= ('a') && ((0) * 16 + 5) <= ('f')) || (((0) * 16 + 5) >= ('A') && ((0) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 5) == '{' || ((0) * 16 + 5) == '}' || ((0) * 16 + 5) == '[' || ((0) * 16 + 5) == ']' || ((0) * 16 + 5) == ':' || ((0) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 5) < ' ' || ((0) * 16 + 5) == '"' || ((0) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 5) >= ('a') && ((0) * 16 + 5) <= ('z')) || (((0) * 16 + 5) >= ('A') && ((0) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 6) >= ('0') && ((0) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 6) >= ('0') && ((0) * 16 + 6) <= ('9')) || ((0) * 16 + 6) == '-' || ((0) * 16 + 6) == '+' || ((0) * 16 + 6) == '.' || ((0) * 16 + 6) == 'e' || ((0) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 6) >= ('0') && ((0) * 16 + 6) <= ('9')) || (((0) * 16 + 6) >= ('a') && ((0) * 16 + 6) <= ('f')) || (((0) * 16 + 6) >= ('A') && ((0) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 6) == '{' || ((0) * 16 + 6) == '}' || ((0) * 16 + 6) == '[' || ((0) * 16 + 6) == ']' || ((0) * 16 + 6) == ':' || ((0) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 6) < ' ' || ((0) * 16 + 6) == '"' || ((0) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 6) >= ('a') && ((0) * 16 + 6) <= ('z')) || (((0) * 16 + 6) >= ('A') && ((0) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 7) >= ('0') && ((0) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 7) >= ('0') && ((0) * 16 + 7) <= ('9')) || ((0) * 16 + 7) == '-' || ((0) * 16 + 7) == '+' || ((0) * 16 + 7) == '.' || ((0) * 16 + 7) == 'e' || ((0) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 7) >= ('0') && ((0) * 16 + 7) <= ('9')) || (((0) * 16 + 7) >= ('a') && ((0) * 16 + 7) <= ('f')) || (((0) * 16 + 7) >= ('A') && ((0) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 7) == '{' || ((0) * 16 + 7) == '}' || ((0) * 16 + 7) == '[' || ((0) * 16 + 7) == ']' || ((0) * 16 + 7) == ':' || ((0) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 7) < ' ' || ((0) * 16 + 7) == '"' || ((0) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 7) >= ('a') && ((0) * 16 + 7) <= ('z')) || (((0) * 16 + 7) >= ('A') && ((0) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 8) >= ('0') && ((0) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 8) >= ('0') && ((0) * 16 + 8) <= ('9')) || ((0) * 16 + 8) == '-' || ((0) * 16 + 8) == '+' || ((0) * 16 + 8) == '.' || ((0) * 16 + 8) == 'e' || ((0) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 8) >= ('0') && ((0) * 16 + 8) <= ('9')) || (((0) * 16 + 8) >= ('a') && ((0) * 16 + 8) <= ('f')) || (((0) * 16 + 8) >= ('A') && ((0) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 8) == '{' || ((0) * 16 + 8) == '}' || ((0) * 16 + 8) == '[' || ((0) * 16 + 8) == ']' || ((0) * 16 + 8) == ':' || ((0) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 8) < ' ' || ((0) * 16 + 8) == '"' || ((0) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 8) >= ('a') && ((0) * 16 + 8) <= ('z')) || (((0) * 16 + 8) >= ('A') && ((0) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 9) >= ('0') && ((0) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 9) >= ('0') && ((0) * 16 + 9) <= ('9')) || ((0) * 16 + 9) == '-' || ((0) * 16 + 9) == '+' || ((0) * 16 + 9) == '.' || ((0) * 16 + 9) == 'e' || ((0) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 9) >= ('0') && ((0) * 16 + 9) <= ('9')) || (((0) * 16 + 9) >= ('a') && ((0) * 16 + 9) <= ('f')) || (((0) * 16 + 9) >= ('A') && ((0) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 9) == '{' || ((0) * 16 + 9) == '}' || ((0) * 16 + 9) == '[' || ((0) * 16 + 9) == ']' || ((0) * 16 + 9) == ':' || ((0) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 9) < ' ' || ((0) * 16 + 9) == '"' || ((0) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 9) >= ('a') && ((0) * 16 + 9) <= ('z')) || (((0) * 16 + 9) >= ('A') && ((0) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 10) >= ('0') && ((0) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 10) >= ('0') && ((0) * 16 + 10) <= ('9')) || ((0) * 16 + 10) == '-' || ((0) * 16 + 10) == '+' || ((0) * 16 + 10) == '.' || ((0) * 16 + 10) == 'e' || ((0) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 10) >= ('0') && ((0) * 16 + 10) <= ('9')) || (((0) * 16 + 10) >= ('a') && ((0) * 16 + 10) <= ('f')) || (((0) * 16 + 10) >= ('A') && ((0) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 10) == '{' || ((0) * 16 + 10) == '}' || ((0) * 16 + 10) == '[' || ((0) * 16 + 10) == ']' || ((0) * 16 + 10) == ':' || ((0) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 10) < ' ' || ((0) * 16 + 10) == '"' || ((0) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 10) >= ('a') && ((0) * 16 + 10) <= ('z')) || (((0) * 16 + 10) >= ('A') && ((0) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 11) >= ('0') && ((0) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 11) >= ('0') && ((0) * 16 + 11) <= ('9')) || ((0) * 16 + 11) == '-' || ((0) * 16 + 11) == '+' || ((0) * 16 + 11) == '.' || ((0) * 16 + 11) == 'e' || ((0) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 11) >= ('0') && ((0) * 16 + 11) <= ('9')) || (((0) * 16 + 11) >= ('a') && ((0) * 16 + 11) <= ('f')) || (((0) * 16 + 11) >= ('A') && ((0) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 11) == '{' || ((0) * 16 + 11) == '}' || ((0) * 16 + 11) == '[' || ((0) * 16 + 11) == ']' || ((0) * 16 + 11) == ':' || ((0) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 11) < ' ' || ((0) * 16 + 11) == '"' || ((0) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 11) >= ('a') && ((0) * 16 + 11) <= ('z')) || (((0) * 16 + 11) >= ('A') && ((0) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 12) >= ('0') && ((0) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 12) >= ('0') && ((0) * 16 + 12) <= ('9')) || ((0) * 16 + 12) == '-' || ((0) * 16 + 12) == '+' || ((0) * 16 + 12) == '.' || ((0) * 16 + 12) == 'e' || ((0) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 12) >= ('0') && ((0) * 16 + 12) <= ('9')) || (((0) * 16 + 12) >= ('a') && ((0) * 16 + 12) <= ('f')) || (((0) * 16 + 12) >= ('A') && ((0) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 12) == '{' || ((0) * 16 + 12) == '}' || ((0) * 16 + 12) == '[' || ((0) * 16 + 12) == ']' || ((0) * 16 + 12) == ':' || ((0) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 12) < ' ' || ((0) * 16 + 12) == '"' || ((0) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 12) >= ('a') && ((0) * 16 + 12) <= ('z')) || (((0) * 16 + 12) >= ('A') && ((0) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 13) >= ('0') && ((0) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 13) >= ('0') && ((0) * 16 + 13) <= ('9')) || ((0) * 16 + 13) == '-' || ((0) * 16 + 13) == '+' || ((0) * 16 + 13) == '.' || ((0) * 16 + 13) == 'e' || ((0) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 13) >= ('0') && ((0) * 16 + 13) <= ('9')) || (((0) * 16 + 13) >= ('a') && ((0) * 16 + 13) <= ('f')) || (((0) * 16 + 13) >= ('A') && ((0) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 13) == '{' || ((0) * 16 + 13) == '}' || ((0) * 16 + 13) == '[' || ((0) * 16 + 13) == ']' || ((0) * 16 + 13) == ':' || ((0) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 13) < ' ' || ((0) * 16 + 13) == '"' || ((0) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 13) >= ('a') && ((0) * 16 + 13) <= ('z')) || (((0) * 16 + 13) >= ('A') && ((0) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 14) >= ('0') && ((0) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 14) >= ('0') && ((0) * 16 + 14) <= ('9')) || ((0) * 16 + 14) == '-' || ((0) * 16 + 14) == '+' || ((0) * 16 + 14) == '.' || ((0) * 16 + 14) == 'e' || ((0) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 14) >= ('0') && ((0) * 16 + 14) <= ('9')) || (((0) * 16 + 14) >= ('a') && ((0) * 16 + 14) <= ('f')) || (((0) * 16 + 14) >= ('A') && ((0) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 14) == '{' || ((0) * 16 + 14) == '}' || ((0) * 16 + 14) == '[' || ((0) * 16 + 14) == ']' || ((0) * 16 + 14) == ':' || ((0) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 14) < ' ' || ((0) * 16 + 14) == '"' || ((0) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 14) >= ('a') && ((0) * 16 + 14) <= ('z')) || (((0) * 16 + 14) >= ('A') && ((0) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((0) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((0) * 16 + 15) >= ('0') && ((0) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((0) * 16 + 15) >= ('0') && ((0) * 16 + 15) <= ('9')) || ((0) * 16 + 15) == '-' || ((0) * 16 + 15) == '+' || ((0) * 16 + 15) == '.' || ((0) * 16 + 15) == 'e' || ((0) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((0) * 16 + 15) >= ('0') && ((0) * 16 + 15) <= ('9')) || (((0) * 16 + 15) >= ('a') && ((0) * 16 + 15) <= ('f')) || (((0) * 16 + 15) >= ('A') && ((0) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((0) * 16 + 15) == '{' || ((0) * 16 + 15) == '}' || ((0) * 16 + 15) == '[' || ((0) * 16 + 15) == ']' || ((0) * 16 + 15) == ':' || ((0) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((0) * 16 + 15) < ' ' || ((0) * 16 + 15) == '"' || ((0) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((0) * 16 + 15) >= ('a') && ((0) * 16 + 15) <= ('z')) || (((0) * 16 + 15) >= ('A') && ((0) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 0) >= ('0') && ((1) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 0) >= ('0') && ((1) * 16 + 0) <= ('9')) || ((1) * 16 + 0) == '-' || ((1) * 16 + 0) == '+' || ((1) * 16 + 0) == '.' || ((1) * 16 + 0) == 'e' || ((1) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 0) >= ('0') && ((1) * 16 + 0) <= ('9')) || (((1) * 16 + 0) >= ('a') && ((1) * 16 + 0) <= ('f')) || (((1) * 16 + 0) >= ('A') && ((1) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 0) == '{' || ((1) * 16 + 0) == '}' || ((1) * 16 + 0) == '[' || ((1) * 16 + 0) == ']' || ((1) * 16 + 0) == ':' || ((1) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 0) < ' ' || ((1) * 16 + 0) == '"' || ((1) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 0) >= ('a') && ((1) * 16 + 0) <= ('z')) || (((1) * 16 + 0) >= ('A') && ((1) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 1) >= ('0') && ((1) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 1) >= ('0') && ((1) * 16 + 1) <= ('9')) || ((1) * 16 + 1) == '-' || ((1) * 16 + 1) == '+' || ((1) * 16 + 1) == '.' || ((1) * 16 + 1) == 'e' || ((1) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 1) >= ('0') && ((1) * 16 + 1) <= ('9')) || (((1) * 16 + 1) >= ('a') && ((1) * 16 + 1) <= ('f')) || (((1) * 16 + 1) >= ('A') && ((1) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 1) == '{' || ((1) * 16 + 1) == '}' || ((1) * 16 + 1) == '[' || ((1) * 16 + 1) == ']' || ((1) * 16 + 1) == ':' || ((1) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 1) < ' ' || ((1) * 16 + 1) == '"' || ((1) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 1) >= ('a') && ((1) * 16 + 1) <= ('z')) || (((1) * 16 + 1) >= ('A') && ((1) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 2) >= ('0') && ((1) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 2) >= ('0') && ((1) * 16 + 2) <= ('9')) || ((1) * 16 + 2) == '-' || ((1) * 16 + 2) == '+' || ((1) * 16 + 2) == '.' || ((1) * 16 + 2) == 'e' || ((1) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 2) >= ('0') && ((1) * 16 + 2) <= ('9')) || (((1) * 16 + 2) >= ('a') && ((1) * 16 + 2) <= ('f')) || (((1) * 16 + 2) >= ('A') && ((1) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 2) == '{' || ((1) * 16 + 2) == '}' || ((1) * 16 + 2) == '[' || ((1) * 16 + 2) == ']' || ((1) * 16 + 2) == ':' || ((1) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 2) < ' ' || ((1) * 16 + 2) == '"' || ((1) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 2) >= ('a') && ((1) * 16 + 2) <= ('z')) || (((1) * 16 + 2) >= ('A') && ((1) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 3) >= ('0') && ((1) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 3) >= ('0') && ((1) * 16 + 3) <= ('9')) || ((1) * 16 + 3) == '-' || ((1) * 16 + 3) == '+' || ((1) * 16 + 3) == '.' || ((1) * 16 + 3) == 'e' || ((1) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 3) >= ('0') && ((1) * 16 + 3) <= ('9')) || (((1) * 16 + 3) >= ('a') && ((1) * 16 + 3) <= ('f')) || (((1) * 16 + 3) >= ('A') && ((1) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 3) == '{' || ((1) * 16 + 3) == '}' || ((1) * 16 + 3) == '[' || ((1) * 16 + 3) == ']' || ((1) * 16 + 3) == ':' || ((1) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 3) < ' ' || ((1) * 16 + 3) == '"' || ((1) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 3) >= ('a') && ((1) * 16 + 3) <= ('z')) || (((1) * 16 + 3) >= ('A') && ((1) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 4) >= ('0') && ((1) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 4) >= ('0') && ((1) * 16 + 4) <= ('9')) || ((1) * 16 + 4) == '-' || ((1) * 16 + 4) == '+' || ((1) * 16 + 4) == '.' || ((1) * 16 + 4) == 'e' || ((1) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 4) >= ('0') && ((1) * 16 + 4) <= ('9')) || (((1) * 16 + 4) >= ('a') && ((1) * 16 + 4) <= ('f')) || (((1) * 16 + 4) >= ('A') && ((1) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 4) == '{' || ((1) * 16 + 4) == '}' || ((1) * 16 + 4) == '[' || ((1) * 16 + 4) == ']' || ((1) * 16 + 4) == ':' || ((1) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 4) < ' ' || ((1) * 16 + 4) == '"' || ((1) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 4) >= ('a') && ((1) * 16 + 4) <= ('z')) || (((1) * 16 + 4) >= ('A') && ((1) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 5) >= ('0') && ((1) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 5) >= ('0') && ((1) * 16 + 5) <= ('9')) || ((1) * 16 + 5) == '-' || ((1) * 16 + 5) == '+' || ((1) * 16 + 5) == '.' || ((1) * 16 + 5) == 'e' || ((1) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 5) >= ('0') && ((1) * 16 + 5) <= ('9')) || (((1) * 16 + 5) >= ('a') && ((1) * 16 + 5) <= ('f')) || (((1) * 16 + 5) >= ('A') && ((1) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 5) == '{' || ((1) * 16 + 5) == '}' || ((1) * 16 + 5) == '[' || ((1) * 16 + 5) == ']' || ((1) * 16 + 5) == ':' || ((1) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 5) < ' ' || ((1) * 16 + 5) == '"' || ((1) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 5) >= ('a') && ((1) * 16 + 5) <= ('z')) || (((1) * 16 + 5) >= ('A') && ((1) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 6) >= ('0') && ((1) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 6) >= ('0') && ((1) * 16 + 6) <= ('9')) || ((1) * 16 + 6) == '-' || ((1) * 16 + 6) == '+' || ((1) * 16 + 6) == '.' || ((1) * 16 + 6) == 'e' || ((1) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 6) >= ('0') && ((1) * 16 + 6) <= ('9')) || (((1) * 16 + 6) >= ('a') && ((1) * 16 + 6) <= ('f')) || (((1) * 16 + 6) >= ('A') && ((1) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 6) == '{' || ((1) * 16 + 6) == '}' || ((1) * 16 + 6) == '[' || ((1) * 16 + 6) == ']' || ((1) * 16 + 6) == ':' || ((1) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 6) < ' ' || ((1) * 16 + 6) == '"' || ((1) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 6) >= ('a') && ((1) * 16 + 6) <= ('z')) || (((1) * 16 + 6) >= ('A') && ((1) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 7) >= ('0') && ((1) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 7) >= ('0') && ((1) * 16 + 7) <= ('9')) || ((1) * 16 + 7) == '-' || ((1) * 16 + 7) == '+' || ((1) * 16 + 7) == '.' || ((1) * 16 + 7) == 'e' || ((1) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 7) >= ('0') && ((1) * 16 + 7) <= ('9')) || (((1) * 16 + 7) >= ('a') && ((1) * 16 + 7) <= ('f')) || (((1) * 16 + 7) >= ('A') && ((1) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 7) == '{' || ((1) * 16 + 7) == '}' || ((1) * 16 + 7) == '[' || ((1) * 16 + 7) == ']' || ((1) * 16 + 7) == ':' || ((1) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 7) < ' ' || ((1) * 16 + 7) == '"' || ((1) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 7) >= ('a') && ((1) * 16 + 7) <= ('z')) || (((1) * 16 + 7) >= ('A') && ((1) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 8) >= ('0') && ((1) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 8) >= ('0') && ((1) * 16 + 8) <= ('9')) || ((1) * 16 + 8) == '-' || ((1) * 16 + 8) == '+' || ((1) * 16 + 8) == '.' || ((1) * 16 + 8) == 'e' || ((1) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 8) >= ('0') && ((1) * 16 + 8) <= ('9')) || (((1) * 16 + 8) >= ('a') && ((1) * 16 + 8) <= ('f')) || (((1) * 16 + 8) >= ('A') && ((1) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 8) == '{' || ((1) * 16 + 8) == '}' || ((1) * 16 + 8) == '[' || ((1) * 16 + 8) == ']' || ((1) * 16 + 8) == ':' || ((1) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 8) < ' ' || ((1) * 16 + 8) == '"' || ((1) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 8) >= ('a') && ((1) * 16 + 8) <= ('z')) || (((1) * 16 + 8) >= ('A') && ((1) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 9) >= ('0') && ((1) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 9) >= ('0') && ((1) * 16 + 9) <= ('9')) || ((1) * 16 + 9) == '-' || ((1) * 16 + 9) == '+' || ((1) * 16 + 9) == '.' || ((1) * 16 + 9) == 'e' || ((1) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 9) >= ('0') && ((1) * 16 + 9) <= ('9')) || (((1) * 16 + 9) >= ('a') && ((1) * 16 + 9) <= ('f')) || (((1) * 16 + 9) >= ('A') && ((1) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 9) == '{' || ((1) * 16 + 9) == '}' || ((1) * 16 + 9) == '[' || ((1) * 16 + 9) == ']' || ((1) * 16 + 9) == ':' || ((1) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 9) < ' ' || ((1) * 16 + 9) == '"' || ((1) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 9) >= ('a') && ((1) * 16 + 9) <= ('z')) || (((1) * 16 + 9) >= ('A') && ((1) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 10) >= ('0') && ((1) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 10) >= ('0') && ((1) * 16 + 10) <= ('9')) || ((1) * 16 + 10) == '-' || ((1) * 16 + 10) == '+' || ((1) * 16 + 10) == '.' || ((1) * 16 + 10) == 'e' || ((1) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 10) >= ('0') && ((1) * 16 + 10) <= ('9')) || (((1) * 16 + 10) >= ('a') && ((1) * 16 + 10) <= ('f')) || (((1) * 16 + 10) >= ('A') && ((1) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 10) == '{' || ((1) * 16 + 10) == '}' || ((1) * 16 + 10) == '[' || ((1) * 16 + 10) == ']' || ((1) * 16 + 10) == ':' || ((1) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 10) < ' ' || ((1) * 16 + 10) == '"' || ((1) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 10) >= ('a') && ((1) * 16 + 10) <= ('z')) || (((1) * 16 + 10) >= ('A') && ((1) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 11) >= ('0') && ((1) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 11) >= ('0') && ((1) * 16 + 11) <= ('9')) || ((1) * 16 + 11) == '-' || ((1) * 16 + 11) == '+' || ((1) * 16 + 11) == '.' || ((1) * 16 + 11) == 'e' || ((1) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 11) >= ('0') && ((1) * 16 + 11) <= ('9')) || (((1) * 16 + 11) >= ('a') && ((1) * 16 + 11) <= ('f')) || (((1) * 16 + 11) >= ('A') && ((1) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 11) == '{' || ((1) * 16 + 11) == '}' || ((1) * 16 + 11) == '[' || ((1) * 16 + 11) == ']' || ((1) * 16 + 11) == ':' || ((1) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 11) < ' ' || ((1) * 16 + 11) == '"' || ((1) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 11) >= ('a') && ((1) * 16 + 11) <= ('z')) || (((1) * 16 + 11) >= ('A') && ((1) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 12) >= ('0') && ((1) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 12) >= ('0') && ((1) * 16 + 12) <= ('9')) || ((1) * 16 + 12) == '-' || ((1) * 16 + 12) == '+' || ((1) * 16 + 12) == '.' || ((1) * 16 + 12) == 'e' || ((1) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 12) >= ('0') && ((1) * 16 + 12) <= ('9')) || (((1) * 16 + 12) >= ('a') && ((1) * 16 + 12) <= ('f')) || (((1) * 16 + 12) >= ('A') && ((1) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 12) == '{' || ((1) * 16 + 12) == '}' || ((1) * 16 + 12) == '[' || ((1) * 16 + 12) == ']' || ((1) * 16 + 12) == ':' || ((1) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 12) < ' ' || ((1) * 16 + 12) == '"' || ((1) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 12) >= ('a') && ((1) * 16 + 12) <= ('z')) || (((1) * 16 + 12) >= ('A') && ((1) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 13) >= ('0') && ((1) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 13) >= ('0') && ((1) * 16 + 13) <= ('9')) || ((1) * 16 + 13) == '-' || ((1) * 16 + 13) == '+' || ((1) * 16 + 13) == '.' || ((1) * 16 + 13) == 'e' || ((1) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 13) >= ('0') && ((1) * 16 + 13) <= ('9')) || (((1) * 16 + 13) >= ('a') && ((1) * 16 + 13) <= ('f')) || (((1) * 16 + 13) >= ('A') && ((1) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 13) == '{' || ((1) * 16 + 13) == '}' || ((1) * 16 + 13) == '[' || ((1) * 16 + 13) == ']' || ((1) * 16 + 13) == ':' || ((1) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 13) < ' ' || ((1) * 16 + 13) == '"' || ((1) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 13) >= ('a') && ((1) * 16 + 13) <= ('z')) || (((1) * 16 + 13) >= ('A') && ((1) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 14) >= ('0') && ((1) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 14) >= ('0') && ((1) * 16 + 14) <= ('9')) || ((1) * 16 + 14) == '-' || ((1) * 16 + 14) == '+' || ((1) * 16 + 14) == '.' || ((1) * 16 + 14) == 'e' || ((1) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 14) >= ('0') && ((1) * 16 + 14) <= ('9')) || (((1) * 16 + 14) >= ('a') && ((1) * 16 + 14) <= ('f')) || (((1) * 16 + 14) >= ('A') && ((1) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 14) == '{' || ((1) * 16 + 14) == '}' || ((1) * 16 + 14) == '[' || ((1) * 16 + 14) == ']' || ((1) * 16 + 14) == ':' || ((1) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 14) < ' ' || ((1) * 16 + 14) == '"' || ((1) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 14) >= ('a') && ((1) * 16 + 14) <= ('z')) || (((1) * 16 + 14) >= ('A') && ((1) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((1) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((1) * 16 + 15) >= ('0') && ((1) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((1) * 16 + 15) >= ('0') && ((1) * 16 + 15) <= ('9')) || ((1) * 16 + 15) == '-' || ((1) * 16 + 15) == '+' || ((1) * 16 + 15) == '.' || ((1) * 16 + 15) == 'e' || ((1) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((1) * 16 + 15) >= ('0') && ((1) * 16 + 15) <= ('9')) || (((1) * 16 + 15) >= ('a') && ((1) * 16 + 15) <= ('f')) || (((1) * 16 + 15) >= ('A') && ((1) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((1) * 16 + 15) == '{' || ((1) * 16 + 15) == '}' || ((1) * 16 + 15) == '[' || ((1) * 16 + 15) == ']' || ((1) * 16 + 15) == ':' || ((1) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((1) * 16 + 15) < ' ' || ((1) * 16 + 15) == '"' || ((1) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((1) * 16 + 15) >= ('a') && ((1) * 16 + 15) <= ('z')) || (((1) * 16 + 15) >= ('A') && ((1) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 0) >= ('0') && ((2) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 0) >= ('0') && ((2) * 16 + 0) <= ('9')) || ((2) * 16 + 0) == '-' || ((2) * 16 + 0) == '+' || ((2) * 16 + 0) == '.' || ((2) * 16 + 0) == 'e' || ((2) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 0) >= ('0') && ((2) * 16 + 0) <= ('9')) || (((2) * 16 + 0) >= ('a') && ((2) * 16 + 0) <= ('f')) || (((2) * 16 + 0) >= ('A') && ((2) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 0) == '{' || ((2) * 16 + 0) == '}' || ((2) * 16 + 0) == '[' || ((2) * 16 + 0) == ']' || ((2) * 16 + 0) == ':' || ((2) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 0) < ' ' || ((2) * 16 + 0) == '"' || ((2) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 0) >= ('a') && ((2) * 16 + 0) <= ('z')) || (((2) * 16 + 0) >= ('A') && ((2) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 1) >= ('0') && ((2) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 1) >= ('0') && ((2) * 16 + 1) <= ('9')) || ((2) * 16 + 1) == '-' || ((2) * 16 + 1) == '+' || ((2) * 16 + 1) == '.' || ((2) * 16 + 1) == 'e' || ((2) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 1) >= ('0') && ((2) * 16 + 1) <= ('9')) || (((2) * 16 + 1) >= ('a') && ((2) * 16 + 1) <= ('f')) || (((2) * 16 + 1) >= ('A') && ((2) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 1) == '{' || ((2) * 16 + 1) == '}' || ((2) * 16 + 1) == '[' || ((2) * 16 + 1) == ']' || ((2) * 16 + 1) == ':' || ((2) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 1) < ' ' || ((2) * 16 + 1) == '"' || ((2) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 1) >= ('a') && ((2) * 16 + 1) <= ('z')) || (((2) * 16 + 1) >= ('A') && ((2) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 2) >= ('0') && ((2) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 2) >= ('0') && ((2) * 16 + 2) <= ('9')) || ((2) * 16 + 2) == '-' || ((2) * 16 + 2) == '+' || ((2) * 16 + 2) == '.' || ((2) * 16 + 2) == 'e' || ((2) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 2) >= ('0') && ((2) * 16 + 2) <= ('9')) || (((2) * 16 + 2) >= ('a') && ((2) * 16 + 2) <= ('f')) || (((2) * 16 + 2) >= ('A') && ((2) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 2) == '{' || ((2) * 16 + 2) == '}' || ((2) * 16 + 2) == '[' || ((2) * 16 + 2) == ']' || ((2) * 16 + 2) == ':' || ((2) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 2) < ' ' || ((2) * 16 + 2) == '"' || ((2) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 2) >= ('a') && ((2) * 16 + 2) <= ('z')) || (((2) * 16 + 2) >= ('A') && ((2) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 3) >= ('0') && ((2) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 3) >= ('0') && ((2) * 16 + 3) <= ('9')) || ((2) * 16 + 3) == '-' || ((2) * 16 + 3) == '+' || ((2) * 16 + 3) == '.' || ((2) * 16 + 3) == 'e' || ((2) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 3) >= ('0') && ((2) * 16 + 3) <= ('9')) || (((2) * 16 + 3) >= ('a') && ((2) * 16 + 3) <= ('f')) || (((2) * 16 + 3) >= ('A') && ((2) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 3) == '{' || ((2) * 16 + 3) == '}' || ((2) * 16 + 3) == '[' || ((2) * 16 + 3) == ']' || ((2) * 16 + 3) == ':' || ((2) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 3) < ' ' || ((2) * 16 + 3) == '"' || ((2) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 3) >= ('a') && ((2) * 16 + 3) <= ('z')) || (((2) * 16 + 3) >= ('A') && ((2) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 4) >= ('0') && ((2) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 4) >= ('0') && ((2) * 16 + 4) <= ('9')) || ((2) * 16 + 4) == '-' || ((2) * 16 + 4) == '+' || ((2) * 16 + 4) == '.' || ((2) * 16 + 4) == 'e' || ((2) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 4) >= ('0') && ((2) * 16 + 4) <= ('9')) || (((2) * 16 + 4) >= ('a') && ((2) * 16 + 4) <= ('f')) || (((2) * 16 + 4) >= ('A') && ((2) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 4) == '{' || ((2) * 16 + 4) == '}' || ((2) * 16 + 4) == '[' || ((2) * 16 + 4) == ']' || ((2) * 16 + 4) == ':' || ((2) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 4) < ' ' || ((2) * 16 + 4) == '"' || ((2) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 4) >= ('a') && ((2) * 16 + 4) <= ('z')) || (((2) * 16 + 4) >= ('A') && ((2) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 5) >= ('0') && ((2) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 5) >= ('0') && ((2) * 16 + 5) <= ('9')) || ((2) * 16 + 5) == '-' || ((2) * 16 + 5) == '+' || ((2) * 16 + 5) == '.' || ((2) * 16 + 5) == 'e' || ((2) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 5) >= ('0') && ((2) * 16 + 5) <= ('9')) || (((2) * 16 + 5) >= ('a') && ((2) * 16 + 5) <= ('f')) || (((2) * 16 + 5) >= ('A') && ((2) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 5) == '{' || ((2) * 16 + 5) == '}' || ((2) * 16 + 5) == '[' || ((2) * 16 + 5) == ']' || ((2) * 16 + 5) == ':' || ((2) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 5) < ' ' || ((2) * 16 + 5) == '"' || ((2) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 5) >= ('a') && ((2) * 16 + 5) <= ('z')) || (((2) * 16 + 5) >= ('A') && ((2) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 6) >= ('0') && ((2) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 6) >= ('0') && ((2) * 16 + 6) <= ('9')) || ((2) * 16 + 6) == '-' || ((2) * 16 + 6) == '+' || ((2) * 16 + 6) == '.' || ((2) * 16 + 6) == 'e' || ((2) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 6) >= ('0') && ((2) * 16 + 6) <= ('9')) || (((2) * 16 + 6) >= ('a') && ((2) * 16 + 6) <= ('f')) || (((2) * 16 + 6) >= ('A') && ((2) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 6) == '{' || ((2) * 16 + 6) == '}' || ((2) * 16 + 6) == '[' || ((2) * 16 + 6) == ']' || ((2) * 16 + 6) == ':' || ((2) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 6) < ' ' || ((2) * 16 + 6) == '"' || ((2) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 6) >= ('a') && ((2) * 16 + 6) <= ('z')) || (((2) * 16 + 6) >= ('A') && ((2) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 7) >= ('0') && ((2) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 7) >= ('0') && ((2) * 16 + 7) <= ('9')) || ((2) * 16 + 7) == '-' || ((2) * 16 + 7) == '+' || ((2) * 16 + 7) == '.' || ((2) * 16 + 7) == 'e' || ((2) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 7) >= ('0') && ((2) * 16 + 7) <= ('9')) || (((2) * 16 + 7) >= ('a') && ((2) * 16 + 7) <= ('f')) || (((2) * 16 + 7) >= ('A') && ((2) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 7) == '{' || ((2) * 16 + 7) == '}' || ((2) * 16 + 7) == '[' || ((2) * 16 + 7) == ']' || ((2) * 16 + 7) == ':' || ((2) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 7) < ' ' || ((2) * 16 + 7) == '"' || ((2) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 7) >= ('a') && ((2) * 16 + 7) <= ('z')) || (((2) * 16 + 7) >= ('A') && ((2) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 8) >= ('0') && ((2) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 8) >= ('0') && ((2) * 16 + 8) <= ('9')) || ((2) * 16 + 8) == '-' || ((2) * 16 + 8) == '+' || ((2) * 16 + 8) == '.' || ((2) * 16 + 8) == 'e' || ((2) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 8) >= ('0') && ((2) * 16 + 8) <= ('9')) || (((2) * 16 + 8) >= ('a') && ((2) * 16 + 8) <= ('f')) || (((2) * 16 + 8) >= ('A') && ((2) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 8) == '{' || ((2) * 16 + 8) == '}' || ((2) * 16 + 8) == '[' || ((2) * 16 + 8) == ']' || ((2) * 16 + 8) == ':' || ((2) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 8) < ' ' || ((2) * 16 + 8) == '"' || ((2) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 8) >= ('a') && ((2) * 16 + 8) <= ('z')) || (((2) * 16 + 8) >= ('A') && ((2) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 9) >= ('0') && ((2) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 9) >= ('0') && ((2) * 16 + 9) <= ('9')) || ((2) * 16 + 9) == '-' || ((2) * 16 + 9) == '+' || ((2) * 16 + 9) == '.' || ((2) * 16 + 9) == 'e' || ((2) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 9) >= ('0') && ((2) * 16 + 9) <= ('9')) || (((2) * 16 + 9) >= ('a') && ((2) * 16 + 9) <= ('f')) || (((2) * 16 + 9) >= ('A') && ((2) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 9) == '{' || ((2) * 16 + 9) == '}' || ((2) * 16 + 9) == '[' || ((2) * 16 + 9) == ']' || ((2) * 16 + 9) == ':' || ((2) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 9) < ' ' || ((2) * 16 + 9) == '"' || ((2) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 9) >= ('a') && ((2) * 16 + 9) <= ('z')) || (((2) * 16 + 9) >= ('A') && ((2) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 10) >= ('0') && ((2) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 10) >= ('0') && ((2) * 16 + 10) <= ('9')) || ((2) * 16 + 10) == '-' || ((2) * 16 + 10) == '+' || ((2) * 16 + 10) == '.' || ((2) * 16 + 10) == 'e' || ((2) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 10) >= ('0') && ((2) * 16 + 10) <= ('9')) || (((2) * 16 + 10) >= ('a') && ((2) * 16 + 10) <= ('f')) || (((2) * 16 + 10) >= ('A') && ((2) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 10) == '{' || ((2) * 16 + 10) == '}' || ((2) * 16 + 10) == '[' || ((2) * 16 + 10) == ']' || ((2) * 16 + 10) == ':' || ((2) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 10) < ' ' || ((2) * 16 + 10) == '"' || ((2) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 10) >= ('a') && ((2) * 16 + 10) <= ('z')) || (((2) * 16 + 10) >= ('A') && ((2) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 11) >= ('0') && ((2) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 11) >= ('0') && ((2) * 16 + 11) <= ('9')) || ((2) * 16 + 11) == '-' || ((2) * 16 + 11) == '+' || ((2) * 16 + 11) == '.' || ((2) * 16 + 11) == 'e' || ((2) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 11) >= ('0') && ((2) * 16 + 11) <= ('9')) || (((2) * 16 + 11) >= ('a') && ((2) * 16 + 11) <= ('f')) || (((2) * 16 + 11) >= ('A') && ((2) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 11) == '{' || ((2) * 16 + 11) == '}' || ((2) * 16 + 11) == '[' || ((2) * 16 + 11) == ']' || ((2) * 16 + 11) == ':' || ((2) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 11) < ' ' || ((2) * 16 + 11) == '"' || ((2) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 11) >= ('a') && ((2) * 16 + 11) <= ('z')) || (((2) * 16 + 11) >= ('A') && ((2) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 12) >= ('0') && ((2) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 12) >= ('0') && ((2) * 16 + 12) <= ('9')) || ((2) * 16 + 12) == '-' || ((2) * 16 + 12) == '+' || ((2) * 16 + 12) == '.' || ((2) * 16 + 12) == 'e' || ((2) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 12) >= ('0') && ((2) * 16 + 12) <= ('9')) || (((2) * 16 + 12) >= ('a') && ((2) * 16 + 12) <= ('f')) || (((2) * 16 + 12) >= ('A') && ((2) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 12) == '{' || ((2) * 16 + 12) == '}' || ((2) * 16 + 12) == '[' || ((2) * 16 + 12) == ']' || ((2) * 16 + 12) == ':' || ((2) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 12) < ' ' || ((2) * 16 + 12) == '"' || ((2) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 12) >= ('a') && ((2) * 16 + 12) <= ('z')) || (((2) * 16 + 12) >= ('A') && ((2) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 13) >= ('0') && ((2) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 13) >= ('0') && ((2) * 16 + 13) <= ('9')) || ((2) * 16 + 13) == '-' || ((2) * 16 + 13) == '+' || ((2) * 16 + 13) == '.' || ((2) * 16 + 13) == 'e' || ((2) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 13) >= ('0') && ((2) * 16 + 13) <= ('9')) || (((2) * 16 + 13) >= ('a') && ((2) * 16 + 13) <= ('f')) || (((2) * 16 + 13) >= ('A') && ((2) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 13) == '{' || ((2) * 16 + 13) == '}' || ((2) * 16 + 13) == '[' || ((2) * 16 + 13) == ']' || ((2) * 16 + 13) == ':' || ((2) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 13) < ' ' || ((2) * 16 + 13) == '"' || ((2) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 13) >= ('a') && ((2) * 16 + 13) <= ('z')) || (((2) * 16 + 13) >= ('A') && ((2) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 14) >= ('0') && ((2) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 14) >= ('0') && ((2) * 16 + 14) <= ('9')) || ((2) * 16 + 14) == '-' || ((2) * 16 + 14) == '+' || ((2) * 16 + 14) == '.' || ((2) * 16 + 14) == 'e' || ((2) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 14) >= ('0') && ((2) * 16 + 14) <= ('9')) || (((2) * 16 + 14) >= ('a') && ((2) * 16 + 14) <= ('f')) || (((2) * 16 + 14) >= ('A') && ((2) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 14) == '{' || ((2) * 16 + 14) == '}' || ((2) * 16 + 14) == '[' || ((2) * 16 + 14) == ']' || ((2) * 16 + 14) == ':' || ((2) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 14) < ' ' || ((2) * 16 + 14) == '"' || ((2) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 14) >= ('a') && ((2) * 16 + 14) <= ('z')) || (((2) * 16 + 14) >= ('A') && ((2) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((2) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((2) * 16 + 15) >= ('0') && ((2) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((2) * 16 + 15) >= ('0') && ((2) * 16 + 15) <= ('9')) || ((2) * 16 + 15) == '-' || ((2) * 16 + 15) == '+' || ((2) * 16 + 15) == '.' || ((2) * 16 + 15) == 'e' || ((2) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((2) * 16 + 15) >= ('0') && ((2) * 16 + 15) <= ('9')) || (((2) * 16 + 15) >= ('a') && ((2) * 16 + 15) <= ('f')) || (((2) * 16 + 15) >= ('A') && ((2) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((2) * 16 + 15) == '{' || ((2) * 16 + 15) == '}' || ((2) * 16 + 15) == '[' || ((2) * 16 + 15) == ']' || ((2) * 16 + 15) == ':' || ((2) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((2) * 16 + 15) < ' ' || ((2) * 16 + 15) == '"' || ((2) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((2) * 16 + 15) >= ('a') && ((2) * 16 + 15) <= ('z')) || (((2) * 16 + 15) >= ('A') && ((2) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 0) >= ('0') && ((3) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 0) >= ('0') && ((3) * 16 + 0) <= ('9')) || ((3) * 16 + 0) == '-' || ((3) * 16 + 0) == '+' || ((3) * 16 + 0) == '.' || ((3) * 16 + 0) == 'e' || ((3) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 0) >= ('0') && ((3) * 16 + 0) <= ('9')) || (((3) * 16 + 0) >= ('a') && ((3) * 16 + 0) <= ('f')) || (((3) * 16 + 0) >= ('A') && ((3) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 0) == '{' || ((3) * 16 + 0) == '}' || ((3) * 16 + 0) == '[' || ((3) * 16 + 0) == ']' || ((3) * 16 + 0) == ':' || ((3) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 0) < ' ' || ((3) * 16 + 0) == '"' || ((3) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 0) >= ('a') && ((3) * 16 + 0) <= ('z')) || (((3) * 16 + 0) >= ('A') && ((3) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 1) >= ('0') && ((3) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 1) >= ('0') && ((3) * 16 + 1) <= ('9')) || ((3) * 16 + 1) == '-' || ((3) * 16 + 1) == '+' || ((3) * 16 + 1) == '.' || ((3) * 16 + 1) == 'e' || ((3) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 1) >= ('0') && ((3) * 16 + 1) <= ('9')) || (((3) * 16 + 1) >= ('a') && ((3) * 16 + 1) <= ('f')) || (((3) * 16 + 1) >= ('A') && ((3) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 1) == '{' || ((3) * 16 + 1) == '}' || ((3) * 16 + 1) == '[' || ((3) * 16 + 1) == ']' || ((3) * 16 + 1) == ':' || ((3) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 1) < ' ' || ((3) * 16 + 1) == '"' || ((3) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 1) >= ('a') && ((3) * 16 + 1) <= ('z')) || (((3) * 16 + 1) >= ('A') && ((3) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 2) >= ('0') && ((3) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 2) >= ('0') && ((3) * 16 + 2) <= ('9')) || ((3) * 16 + 2) == '-' || ((3) * 16 + 2) == '+' || ((3) * 16 + 2) == '.' || ((3) * 16 + 2) == 'e' || ((3) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 2) >= ('0') && ((3) * 16 + 2) <= ('9')) || (((3) * 16 + 2) >= ('a') && ((3) * 16 + 2) <= ('f')) || (((3) * 16 + 2) >= ('A') && ((3) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 2) == '{' || ((3) * 16 + 2) == '}' || ((3) * 16 + 2) == '[' || ((3) * 16 + 2) == ']' || ((3) * 16 + 2) == ':' || ((3) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 2) < ' ' || ((3) * 16 + 2) == '"' || ((3) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 2) >= ('a') && ((3) * 16 + 2) <= ('z')) || (((3) * 16 + 2) >= ('A') && ((3) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 3) >= ('0') && ((3) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 3) >= ('0') && ((3) * 16 + 3) <= ('9')) || ((3) * 16 + 3) == '-' || ((3) * 16 + 3) == '+' || ((3) * 16 + 3) == '.' || ((3) * 16 + 3) == 'e' || ((3) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 3) >= ('0') && ((3) * 16 + 3) <= ('9')) || (((3) * 16 + 3) >= ('a') && ((3) * 16 + 3) <= ('f')) || (((3) * 16 + 3) >= ('A') && ((3) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 3) == '{' || ((3) * 16 + 3) == '}' || ((3) * 16 + 3) == '[' || ((3) * 16 + 3) == ']' || ((3) * 16 + 3) == ':' || ((3) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 3) < ' ' || ((3) * 16 + 3) == '"' || ((3) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 3) >= ('a') && ((3) * 16 + 3) <= ('z')) || (((3) * 16 + 3) >= ('A') && ((3) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 4) >= ('0') && ((3) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 4) >= ('0') && ((3) * 16 + 4) <= ('9')) || ((3) * 16 + 4) == '-' || ((3) * 16 + 4) == '+' || ((3) * 16 + 4) == '.' || ((3) * 16 + 4) == 'e' || ((3) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 4) >= ('0') && ((3) * 16 + 4) <= ('9')) || (((3) * 16 + 4) >= ('a') && ((3) * 16 + 4) <= ('f')) || (((3) * 16 + 4) >= ('A') && ((3) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 4) == '{' || ((3) * 16 + 4) == '}' || ((3) * 16 + 4) == '[' || ((3) * 16 + 4) == ']' || ((3) * 16 + 4) == ':' || ((3) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 4) < ' ' || ((3) * 16 + 4) == '"' || ((3) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 4) >= ('a') && ((3) * 16 + 4) <= ('z')) || (((3) * 16 + 4) >= ('A') && ((3) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 5) >= ('0') && ((3) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 5) >= ('0') && ((3) * 16 + 5) <= ('9')) || ((3) * 16 + 5) == '-' || ((3) * 16 + 5) == '+' || ((3) * 16 + 5) == '.' || ((3) * 16 + 5) == 'e' || ((3) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 5) >= ('0') && ((3) * 16 + 5) <= ('9')) || (((3) * 16 + 5) >= ('a') && ((3) * 16 + 5) <= ('f')) || (((3) * 16 + 5) >= ('A') && ((3) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 5) == '{' || ((3) * 16 + 5) == '}' || ((3) * 16 + 5) == '[' || ((3) * 16 + 5) == ']' || ((3) * 16 + 5) == ':' || ((3) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 5) < ' ' || ((3) * 16 + 5) == '"' || ((3) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 5) >= ('a') && ((3) * 16 + 5) <= ('z')) || (((3) * 16 + 5) >= ('A') && ((3) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 6) >= ('0') && ((3) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 6) >= ('0') && ((3) * 16 + 6) <= ('9')) || ((3) * 16 + 6) == '-' || ((3) * 16 + 6) == '+' || ((3) * 16 + 6) == '.' || ((3) * 16 + 6) == 'e' || ((3) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 6) >= ('0') && ((3) * 16 + 6) <= ('9')) || (((3) * 16 + 6) >= ('a') && ((3) * 16 + 6) <= ('f')) || (((3) * 16 + 6) >= ('A') && ((3) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 6) == '{' || ((3) * 16 + 6) == '}' || ((3) * 16 + 6) == '[' || ((3) * 16 + 6) == ']' || ((3) * 16 + 6) == ':' || ((3) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 6) < ' ' || ((3) * 16 + 6) == '"' || ((3) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 6) >= ('a') && ((3) * 16 + 6) <= ('z')) || (((3) * 16 + 6) >= ('A') && ((3) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 7) >= ('0') && ((3) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 7) >= ('0') && ((3) * 16 + 7) <= ('9')) || ((3) * 16 + 7) == '-' || ((3) * 16 + 7) == '+' || ((3) * 16 + 7) == '.' || ((3) * 16 + 7) == 'e' || ((3) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 7) >= ('0') && ((3) * 16 + 7) <= ('9')) || (((3) * 16 + 7) >= ('a') && ((3) * 16 + 7) <= ('f')) || (((3) * 16 + 7) >= ('A') && ((3) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 7) == '{' || ((3) * 16 + 7) == '}' || ((3) * 16 + 7) == '[' || ((3) * 16 + 7) == ']' || ((3) * 16 + 7) == ':' || ((3) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 7) < ' ' || ((3) * 16 + 7) == '"' || ((3) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 7) >= ('a') && ((3) * 16 + 7) <= ('z')) || (((3) * 16 + 7) >= ('A') && ((3) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 8) >= ('0') && ((3) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 8) >= ('0') && ((3) * 16 + 8) <= ('9')) || ((3) * 16 + 8) == '-' || ((3) * 16 + 8) == '+' || ((3) * 16 + 8) == '.' || ((3) * 16 + 8) == 'e' || ((3) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 8) >= ('0') && ((3) * 16 + 8) <= ('9')) || (((3) * 16 + 8) >= ('a') && ((3) * 16 + 8) <= ('f')) || (((3) * 16 + 8) >= ('A') && ((3) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 8) == '{' || ((3) * 16 + 8) == '}' || ((3) * 16 + 8) == '[' || ((3) * 16 + 8) == ']' || ((3) * 16 + 8) == ':' || ((3) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 8) < ' ' || ((3) * 16 + 8) == '"' || ((3) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 8) >= ('a') && ((3) * 16 + 8) <= ('z')) || (((3) * 16 + 8) >= ('A') && ((3) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 9) >= ('0') && ((3) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 9) >= ('0') && ((3) * 16 + 9) <= ('9')) || ((3) * 16 + 9) == '-' || ((3) * 16 + 9) == '+' || ((3) * 16 + 9) == '.' || ((3) * 16 + 9) == 'e' || ((3) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 9) >= ('0') && ((3) * 16 + 9) <= ('9')) || (((3) * 16 + 9) >= ('a') && ((3) * 16 + 9) <= ('f')) || (((3) * 16 + 9) >= ('A') && ((3) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 9) == '{' || ((3) * 16 + 9) == '}' || ((3) * 16 + 9) == '[' || ((3) * 16 + 9) == ']' || ((3) * 16 + 9) == ':' || ((3) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 9) < ' ' || ((3) * 16 + 9) == '"' || ((3) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 9) >= ('a') && ((3) * 16 + 9) <= ('z')) || (((3) * 16 + 9) >= ('A') && ((3) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 10) >= ('0') && ((3) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 10) >= ('0') && ((3) * 16 + 10) <= ('9')) || ((3) * 16 + 10) == '-' || ((3) * 16 + 10) == '+' || ((3) * 16 + 10) == '.' || ((3) * 16 + 10) == 'e' || ((3) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 10) >= ('0') && ((3) * 16 + 10) <= ('9')) || (((3) * 16 + 10) >= ('a') && ((3) * 16 + 10) <= ('f')) || (((3) * 16 + 10) >= ('A') && ((3) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 10) == '{' || ((3) * 16 + 10) == '}' || ((3) * 16 + 10) == '[' || ((3) * 16 + 10) == ']' || ((3) * 16 + 10) == ':' || ((3) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 10) < ' ' || ((3) * 16 + 10) == '"' || ((3) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 10) >= ('a') && ((3) * 16 + 10) <= ('z')) || (((3) * 16 + 10) >= ('A') && ((3) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 11) >= ('0') && ((3) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 11) >= ('0') && ((3) * 16 + 11) <= ('9')) || ((3) * 16 + 11) == '-' || ((3) * 16 + 11) == '+' || ((3) * 16 + 11) == '.' || ((3) * 16 + 11) == 'e' || ((3) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 11) >= ('0') && ((3) * 16 + 11) <= ('9')) || (((3) * 16 + 11) >= ('a') && ((3) * 16 + 11) <= ('f')) || (((3) * 16 + 11) >= ('A') && ((3) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 11) == '{' || ((3) * 16 + 11) == '}' || ((3) * 16 + 11) == '[' || ((3) * 16 + 11) == ']' || ((3) * 16 + 11) == ':' || ((3) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 11) < ' ' || ((3) * 16 + 11) == '"' || ((3) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 11) >= ('a') && ((3) * 16 + 11) <= ('z')) || (((3) * 16 + 11) >= ('A') && ((3) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 12) >= ('0') && ((3) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 12) >= ('0') && ((3) * 16 + 12) <= ('9')) || ((3) * 16 + 12) == '-' || ((3) * 16 + 12) == '+' || ((3) * 16 + 12) == '.' || ((3) * 16 + 12) == 'e' || ((3) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 12) >= ('0') && ((3) * 16 + 12) <= ('9')) || (((3) * 16 + 12) >= ('a') && ((3) * 16 + 12) <= ('f')) || (((3) * 16 + 12) >= ('A') && ((3) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 12) == '{' || ((3) * 16 + 12) == '}' || ((3) * 16 + 12) == '[' || ((3) * 16 + 12) == ']' || ((3) * 16 + 12) == ':' || ((3) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 12) < ' ' || ((3) * 16 + 12) == '"' || ((3) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 12) >= ('a') && ((3) * 16 + 12) <= ('z')) || (((3) * 16 + 12) >= ('A') && ((3) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 13) >= ('0') && ((3) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 13) >= ('0') && ((3) * 16 + 13) <= ('9')) || ((3) * 16 + 13) == '-' || ((3) * 16 + 13) == '+' || ((3) * 16 + 13) == '.' || ((3) * 16 + 13) == 'e' || ((3) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 13) >= ('0') && ((3) * 16 + 13) <= ('9')) || (((3) * 16 + 13) >= ('a') && ((3) * 16 + 13) <= ('f')) || (((3) * 16 + 13) >= ('A') && ((3) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 13) == '{' || ((3) * 16 + 13) == '}' || ((3) * 16 + 13) == '[' || ((3) * 16 + 13) == ']' || ((3) * 16 + 13) == ':' || ((3) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 13) < ' ' || ((3) * 16 + 13) == '"' || ((3) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 13) >= ('a') && ((3) * 16 + 13) <= ('z')) || (((3) * 16 + 13) >= ('A') && ((3) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 14) >= ('0') && ((3) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 14) >= ('0') && ((3) * 16 + 14) <= ('9')) || ((3) * 16 + 14) == '-' || ((3) * 16 + 14) == '+' || ((3) * 16 + 14) == '.' || ((3) * 16 + 14) == 'e' || ((3) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 14) >= ('0') && ((3) * 16 + 14) <= ('9')) || (((3) * 16 + 14) >= ('a') && ((3) * 16 + 14) <= ('f')) || (((3) * 16 + 14) >= ('A') && ((3) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 14) == '{' || ((3) * 16 + 14) == '}' || ((3) * 16 + 14) == '[' || ((3) * 16 + 14) == ']' || ((3) * 16 + 14) == ':' || ((3) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 14) < ' ' || ((3) * 16 + 14) == '"' || ((3) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 14) >= ('a') && ((3) * 16 + 14) <= ('z')) || (((3) * 16 + 14) >= ('A') && ((3) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((3) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((3) * 16 + 15) >= ('0') && ((3) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((3) * 16 + 15) >= ('0') && ((3) * 16 + 15) <= ('9')) || ((3) * 16 + 15) == '-' || ((3) * 16 + 15) == '+' || ((3) * 16 + 15) == '.' || ((3) * 16 + 15) == 'e' || ((3) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((3) * 16 + 15) >= ('0') && ((3) * 16 + 15) <= ('9')) || (((3) * 16 + 15) >= ('a') && ((3) * 16 + 15) <= ('f')) || (((3) * 16 + 15) >= ('A') && ((3) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((3) * 16 + 15) == '{' || ((3) * 16 + 15) == '}' || ((3) * 16 + 15) == '[' || ((3) * 16 + 15) == ']' || ((3) * 16 + 15) == ':' || ((3) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((3) * 16 + 15) < ' ' || ((3) * 16 + 15) == '"' || ((3) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((3) * 16 + 15) >= ('a') && ((3) * 16 + 15) <= ('z')) || (((3) * 16 + 15) >= ('A') && ((3) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)),
+  ( (((4) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 0) >= ('0') && ((4) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 0) >= ('0') && ((4) * 16 + 0) <= ('9')) || ((4) * 16 + 0) == '-' || ((4) * 16 + 0) == '+' || ((4) * 16 + 0) == '.' || ((4) * 16 + 0) == 'e' || ((4) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 0) >= ('0') && ((4) * 16 + 0) <= ('9')) || (((4) * 16 + 0) >= ('a') && ((4) * 16 + 0) <= ('f')) || (((4) * 16 + 0) >= ('A') && ((4) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 0) == '{' || ((4) * 16 + 0) == '}' || ((4) * 16 + 0) == '[' || ((4) * 16 + 0) == ']' || ((4) * 16 + 0) == ':' || ((4) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 0) < ' ' || ((4) * 16 + 0) == '"' || ((4) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 0) >= ('a') && ((4) * 16 + 0) <= ('z')) || (((4) * 16 + 0) >= ('A') && ((4) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 1) >= ('0') && ((4) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 1) >= ('0') && ((4) * 16 + 1) <= ('9')) || ((4) * 16 + 1) == '-' || ((4) * 16 + 1) == '+' || ((4) * 16 + 1) == '.' || ((4) * 16 + 1) == 'e' || ((4) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 1) >= ('0') && ((4) * 16 + 1) <= ('9')) || (((4) * 16 + 1) >= ('a') && ((4) * 16 + 1) <= ('f')) || (((4) * 16 + 1) >= ('A') && ((4) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 1) == '{' || ((4) * 16 + 1) == '}' || ((4) * 16 + 1) == '[' || ((4) * 16 + 1) == ']' || ((4) * 16 + 1) == ':' || ((4) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 1) < ' ' || ((4) * 16 + 1) == '"' || ((4) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 1) >= ('a') && ((4) * 16 + 1) <= ('z')) || (((4) * 16 + 1) >= ('A') && ((4) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 2) >= ('0') && ((4) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 2) >= ('0') && ((4) * 16 + 2) <= ('9')) || ((4) * 16 + 2) == '-' || ((4) * 16 + 2) == '+' || ((4) * 16 + 2) == '.' || ((4) * 16 + 2) == 'e' || ((4) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 2) >= ('0') && ((4) * 16 + 2) <= ('9')) || (((4) * 16 + 2) >= ('a') && ((4) * 16 + 2) <= ('f')) || (((4) * 16 + 2) >= ('A') && ((4) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 2) == '{' || ((4) * 16 + 2) == '}' || ((4) * 16 + 2) == '[' || ((4) * 16 + 2) == ']' || ((4) * 16 + 2) == ':' || ((4) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 2) < ' ' || ((4) * 16 + 2) == '"' || ((4) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 2) >= ('a') && ((4) * 16 + 2) <= ('z')) || (((4) * 16 + 2) >= ('A') && ((4) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 3) >= ('0') && ((4) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 3) >= ('0') && ((4) * 16 + 3) <= ('9')) || ((4) * 16 + 3) == '-' || ((4) * 16 + 3) == '+' || ((4) * 16 + 3) == '.' || ((4) * 16 + 3) == 'e' || ((4) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 3) >= ('0') && ((4) * 16 + 3) <= ('9')) || (((4) * 16 + 3) >= ('a') && ((4) * 16 + 3) <= ('f')) || (((4) * 16 + 3) >= ('A') && ((4) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 3) == '{' || ((4) * 16 + 3) == '}' || ((4) * 16 + 3) == '[' || ((4) * 16 + 3) == ']' || ((4) * 16 + 3) == ':' || ((4) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 3) < ' ' || ((4) * 16 + 3) == '"' || ((4) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 3) >= ('a') && ((4) * 16 + 3) <= ('z')) || (((4) * 16 + 3) >= ('A') && ((4) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 4) >= ('0') && ((4) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 4) >= ('0') && ((4) * 16 + 4) <= ('9')) || ((4) * 16 + 4) == '-' || ((4) * 16 + 4) == '+' || ((4) * 16 + 4) == '.' || ((4) * 16 + 4) == 'e' || ((4) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 4) >= ('0') && ((4) * 16 + 4) <= ('9')) || (((4) * 16 + 4) >= ('a') && ((4) * 16 + 4) <= ('f')) || (((4) * 16 + 4) >= ('A') && ((4) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 4) == '{' || ((4) * 16 + 4) == '}' || ((4) * 16 + 4) == '[' || ((4) * 16 + 4) == ']' || ((4) * 16 + 4) == ':' || ((4) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 4) < ' ' || ((4) * 16 + 4) == '"' || ((4) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 4) >= ('a') && ((4) * 16 + 4) <= ('z')) || (((4) * 16 + 4) >= ('A') && ((4) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 5) >= ('0') && ((4) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 5) >= ('0') && ((4) * 16 + 5) <= ('9')) || ((4) * 16 + 5) == '-' || ((4) * 16 + 5) == '+' || ((4) * 16 + 5) == '.' || ((4) * 16 + 5) == 'e' || ((4) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 5) >= ('0') && ((4) * 16 + 5) <= ('9')) || (((4) * 16 + 5) >= ('a') && ((4) * 16 + 5) <= ('f')) || (((4) * 16 + 5) >= ('A') && ((4) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 5) == '{' || ((4) * 16 + 5) == '}' || ((4) * 16 + 5) == '[' || ((4) * 16 + 5) == ']' || ((4) * 16 + 5) == ':' || ((4) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 5) < ' ' || ((4) * 16 + 5) == '"' || ((4) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 5) >= ('a') && ((4) * 16 + 5) <= ('z')) || (((4) * 16 + 5) >= ('A') && ((4) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 6) >= ('0') && ((4) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 6) >= ('0') && ((4) * 16 + 6) <= ('9')) || ((4) * 16 + 6) == '-' || ((4) * 16 + 6) == '+' || ((4) * 16 + 6) == '.' || ((4) * 16 + 6) == 'e' || ((4) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 6) >= ('0') && ((4) * 16 + 6) <= ('9')) || (((4) * 16 + 6) >= ('a') && ((4) * 16 + 6) <= ('f')) || (((4) * 16 + 6) >= ('A') && ((4) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 6) == '{' || ((4) * 16 + 6) == '}' || ((4) * 16 + 6) == '[' || ((4) * 16 + 6) == ']' || ((4) * 16 + 6) == ':' || ((4) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 6) < ' ' || ((4) * 16 + 6) == '"' || ((4) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 6) >= ('a') && ((4) * 16 + 6) <= ('z')) || (((4) * 16 + 6) >= ('A') && ((4) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 7) >= ('0') && ((4) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 7) >= ('0') && ((4) * 16 + 7) <= ('9')) || ((4) * 16 + 7) == '-' || ((4) * 16 + 7) == '+' || ((4) * 16 + 7) == '.' || ((4) * 16 + 7) == 'e' || ((4) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 7) >= ('0') && ((4) * 16 + 7) <= ('9')) || (((4) * 16 + 7) >= ('a') && ((4) * 16 + 7) <= ('f')) || (((4) * 16 + 7) >= ('A') && ((4) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 7) == '{' || ((4) * 16 + 7) == '}' || ((4) * 16 + 7) == '[' || ((4) * 16 + 7) == ']' || ((4) * 16 + 7) == ':' || ((4) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 7) < ' ' || ((4) * 16 + 7) == '"' || ((4) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 7) >= ('a') && ((4) * 16 + 7) <= ('z')) || (((4) * 16 + 7) >= ('A') && ((4) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 8) >= ('0') && ((4) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 8) >= ('0') && ((4) * 16 + 8) <= ('9')) || ((4) * 16 + 8) == '-' || ((4) * 16 + 8) == '+' || ((4) * 16 + 8) == '.' || ((4) * 16 + 8) == 'e' || ((4) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 8) >= ('0') && ((4) * 16 + 8) <= ('9')) || (((4) * 16 + 8) >= ('a') && ((4) * 16 + 8) <= ('f')) || (((4) * 16 + 8) >= ('A') && ((4) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 8) == '{' || ((4) * 16 + 8) == '}' || ((4) * 16 + 8) == '[' || ((4) * 16 + 8) == ']' || ((4) * 16 + 8) == ':' || ((4) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 8) < ' ' || ((4) * 16 + 8) == '"' || ((4) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 8) >= ('a') && ((4) * 16 + 8) <= ('z')) || (((4) * 16 + 8) >= ('A') && ((4) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 9) >= ('0') && ((4) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 9) >= ('0') && ((4) * 16 + 9) <= ('9')) || ((4) * 16 + 9) == '-' || ((4) * 16 + 9) == '+' || ((4) * 16 + 9) == '.' || ((4) * 16 + 9) == 'e' || ((4) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 9) >= ('0') && ((4) * 16 + 9) <= ('9')) || (((4) * 16 + 9) >= ('a') && ((4) * 16 + 9) <= ('f')) || (((4) * 16 + 9) >= ('A') && ((4) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 9) == '{' || ((4) * 16 + 9) == '}' || ((4) * 16 + 9) == '[' || ((4) * 16 + 9) == ']' || ((4) * 16 + 9) == ':' || ((4) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 9) < ' ' || ((4) * 16 + 9) == '"' || ((4) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 9) >= ('a') && ((4) * 16 + 9) <= ('z')) || (((4) * 16 + 9) >= ('A') && ((4) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 10) >= ('0') && ((4) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 10) >= ('0') && ((4) * 16 + 10) <= ('9')) || ((4) * 16 + 10) == '-' || ((4) * 16 + 10) == '+' || ((4) * 16 + 10) == '.' || ((4) * 16 + 10) == 'e' || ((4) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 10) >= ('0') && ((4) * 16 + 10) <= ('9')) || (((4) * 16 + 10) >= ('a') && ((4) * 16 + 10) <= ('f')) || (((4) * 16 + 10) >= ('A') && ((4) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 10) == '{' || ((4) * 16 + 10) == '}' || ((4) * 16 + 10) == '[' || ((4) * 16 + 10) == ']' || ((4) * 16 + 10) == ':' || ((4) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 10) < ' ' || ((4) * 16 + 10) == '"' || ((4) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 10) >= ('a') && ((4) * 16 + 10) <= ('z')) || (((4) * 16 + 10) >= ('A') && ((4) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 11) >= ('0') && ((4) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 11) >= ('0') && ((4) * 16 + 11) <= ('9')) || ((4) * 16 + 11) == '-' || ((4) * 16 + 11) == '+' || ((4) * 16 + 11) == '.' || ((4) * 16 + 11) == 'e' || ((4) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 11) >= ('0') && ((4) * 16 + 11) <= ('9')) || (((4) * 16 + 11) >= ('a') && ((4) * 16 + 11) <= ('f')) || (((4) * 16 + 11) >= ('A') && ((4) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 11) == '{' || ((4) * 16 + 11) == '}' || ((4) * 16 + 11) == '[' || ((4) * 16 + 11) == ']' || ((4) * 16 + 11) == ':' || ((4) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 11) < ' ' || ((4) * 16 + 11) == '"' || ((4) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 11) >= ('a') && ((4) * 16 + 11) <= ('z')) || (((4) * 16 + 11) >= ('A') && ((4) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 12) >= ('0') && ((4) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 12) >= ('0') && ((4) * 16 + 12) <= ('9')) || ((4) * 16 + 12) == '-' || ((4) * 16 + 12) == '+' || ((4) * 16 + 12) == '.' || ((4) * 16 + 12) == 'e' || ((4) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 12) >= ('0') && ((4) * 16 + 12) <= ('9')) || (((4) * 16 + 12) >= ('a') && ((4) * 16 + 12) <= ('f')) || (((4) * 16 + 12) >= ('A') && ((4) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 12) == '{' || ((4) * 16 + 12) == '}' || ((4) * 16 + 12) == '[' || ((4) * 16 + 12) == ']' || ((4) * 16 + 12) == ':' || ((4) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 12) < ' ' || ((4) * 16 + 12) == '"' || ((4) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 12) >= ('a') && ((4) * 16 + 12) <= ('z')) || (((4) * 16 + 12) >= ('A') && ((4) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 13) >= ('0') && ((4) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 13) >= ('0') && ((4) * 16 + 13) <= ('9')) || ((4) * 16 + 13) == '-' || ((4) * 16 + 13) == '+' || ((4) * 16 + 13) == '.' || ((4) * 16 + 13) == 'e' || ((4) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 13) >= ('0') && ((4) * 16 + 13) <= ('9')) || (((4) * 16 + 13) >= ('a') && ((4) * 16 + 13) <= ('f')) || (((4) * 16 + 13) >= ('A') && ((4) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 13) == '{' || ((4) * 16 + 13) == '}' || ((4) * 16 + 13) == '[' || ((4) * 16 + 13) == ']' || ((4) * 16 + 13) == ':' || ((4) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 13) < ' ' || ((4) * 16 + 13) == '"' || ((4) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 13) >= ('a') && ((4) * 16 + 13) <= ('z')) || (((4) * 16 + 13) >= ('A') && ((4) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 14) >= ('0') && ((4) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 14) >= ('0') && ((4) * 16 + 14) <= ('9')) || ((4) * 16 + 14) == '-' || ((4) * 16 + 14) == '+' || ((4) * 16 + 14) == '.' || ((4) * 16 + 14) == 'e' || ((4) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 14) >= ('0') && ((4) * 16 + 14) <= ('9')) || (((4) * 16 + 14) >= ('a') && ((4) * 16 + 14) <= ('f')) || (((4) * 16 + 14) >= ('A') && ((4) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 14) == '{' || ((4) * 16 + 14) == '}' || ((4) * 16 + 14) == '[' || ((4) * 16 + 14) == ']' || ((4) * 16 + 14) == ':' || ((4) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 14) < ' ' || ((4) * 16 + 14) == '"' || ((4) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 14) >= ('a') && ((4) * 16 + 14) <= ('z')) || (((4) * 16 + 14) >= ('A') && ((4) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((4) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((4) * 16 + 15) >= ('0') && ((4) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((4) * 16 + 15) >= ('0') && ((4) * 16 + 15) <= ('9')) || ((4) * 16 + 15) == '-' || ((4) * 16 + 15) == '+' || ((4) * 16 + 15) == '.' || ((4) * 16 + 15) == 'e' || ((4) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((4) * 16 + 15) >= ('0') && ((4) * 16 + 15) <= ('9')) || (((4) * 16 + 15) >= ('a') && ((4) * 16 + 15) <= ('f')) || (((4) * 16 + 15) >= ('A') && ((4) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((4) * 16 + 15) == '{' || ((4) * 16 + 15) == '}' || ((4) * 16 + 15) == '[' || ((4) * 16 + 15) == ']' || ((4) * 16 + 15) == ':' || ((4) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((4) * 16 + 15) < ' ' || ((4) * 16 + 15) == '"' || ((4) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((4) * 16 + 15) >= ('a') && ((4) * 16 + 15) <= ('z')) || (((4) * 16 + 15) >= ('A') && ((4) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 0) >= ('0') && ((5) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 0) >= ('0') && ((5) * 16 + 0) <= ('9')) || ((5) * 16 + 0) == '-' || ((5) * 16 + 0) == '+' || ((5) * 16 + 0) == '.' || ((5) * 16 + 0) == 'e' || ((5) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 0) >= ('0') && ((5) * 16 + 0) <= ('9')) || (((5) * 16 + 0) >= ('a') && ((5) * 16 + 0) <= ('f')) || (((5) * 16 + 0) >= ('A') && ((5) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 0) == '{' || ((5) * 16 + 0) == '}' || ((5) * 16 + 0) == '[' || ((5) * 16 + 0) == ']' || ((5) * 16 + 0) == ':' || ((5) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 0) < ' ' || ((5) * 16 + 0) == '"' || ((5) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 0) >= ('a') && ((5) * 16 + 0) <= ('z')) || (((5) * 16 + 0) >= ('A') && ((5) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 1) >= ('0') && ((5) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 1) >= ('0') && ((5) * 16 + 1) <= ('9')) || ((5) * 16 + 1) == '-' || ((5) * 16 + 1) == '+' || ((5) * 16 + 1) == '.' || ((5) * 16 + 1) == 'e' || ((5) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 1) >= ('0') && ((5) * 16 + 1) <= ('9')) || (((5) * 16 + 1) >= ('a') && ((5) * 16 + 1) <= ('f')) || (((5) * 16 + 1) >= ('A') && ((5) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 1) == '{' || ((5) * 16 + 1) == '}' || ((5) * 16 + 1) == '[' || ((5) * 16 + 1) == ']' || ((5) * 16 + 1) == ':' || ((5) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 1) < ' ' || ((5) * 16 + 1) == '"' || ((5) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 1) >= ('a') && ((5) * 16 + 1) <= ('z')) || (((5) * 16 + 1) >= ('A') && ((5) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 2) >= ('0') && ((5) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 2) >= ('0') && ((5) * 16 + 2) <= ('9')) || ((5) * 16 + 2) == '-' || ((5) * 16 + 2) == '+' || ((5) * 16 + 2) == '.' || ((5) * 16 + 2) == 'e' || ((5) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 2) >= ('0') && ((5) * 16 + 2) <= ('9')) || (((5) * 16 + 2) >= ('a') && ((5) * 16 + 2) <= ('f')) || (((5) * 16 + 2) >= ('A') && ((5) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 2) == '{' || ((5) * 16 + 2) == '}' || ((5) * 16 + 2) == '[' || ((5) * 16 + 2) == ']' || ((5) * 16 + 2) == ':' || ((5) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 2) < ' ' || ((5) * 16 + 2) == '"' || ((5) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 2) >= ('a') && ((5) * 16 + 2) <= ('z')) || (((5) * 16 + 2) >= ('A') && ((5) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 3) >= ('0') && ((5) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 3) >= ('0') && ((5) * 16 + 3) <= ('9')) || ((5) * 16 + 3) == '-' || ((5) * 16 + 3) == '+' || ((5) * 16 + 3) == '.' || ((5) * 16 + 3) == 'e' || ((5) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 3) >= ('0') && ((5) * 16 + 3) <= ('9')) || (((5) * 16 + 3) >= ('a') && ((5) * 16 + 3) <= ('f')) || (((5) * 16 + 3) >= ('A') && ((5) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 3) == '{' || ((5) * 16 + 3) == '}' || ((5) * 16 + 3) == '[' || ((5) * 16 + 3) == ']' || ((5) * 16 + 3) == ':' || ((5) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 3) < ' ' || ((5) * 16 + 3) == '"' || ((5) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 3) >= ('a') && ((5) * 16 + 3) <= ('z')) || (((5) * 16 + 3) >= ('A') && ((5) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 4) >= ('0') && ((5) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 4) >= ('0') && ((5) * 16 + 4) <= ('9')) || ((5) * 16 + 4) == '-' || ((5) * 16 + 4) == '+' || ((5) * 16 + 4) == '.' || ((5) * 16 + 4) == 'e' || ((5) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 4) >= ('0') && ((5) * 16 + 4) <= ('9')) || (((5) * 16 + 4) >= ('a') && ((5) * 16 + 4) <= ('f')) || (((5) * 16 + 4) >= ('A') && ((5) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 4) == '{' || ((5) * 16 + 4) == '}' || ((5) * 16 + 4) == '[' || ((5) * 16 + 4) == ']' || ((5) * 16 + 4) == ':' || ((5) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 4) < ' ' || ((5) * 16 + 4) == '"' || ((5) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 4) >= ('a') && ((5) * 16 + 4) <= ('z')) || (((5) * 16 + 4) >= ('A') && ((5) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 5) >= ('0') && ((5) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 5) >= ('0') && ((5) * 16 + 5) <= ('9')) || ((5) * 16 + 5) == '-' || ((5) * 16 + 5) == '+' || ((5) * 16 + 5) == '.' || ((5) * 16 + 5) == 'e' || ((5) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 5) >= ('0') && ((5) * 16 + 5) <= ('9')) || (((5) * 16 + 5) >= ('a') && ((5) * 16 + 5) <= ('f')) || (((5) * 16 + 5) >= ('A') && ((5) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 5) == '{' || ((5) * 16 + 5) == '}' || ((5) * 16 + 5) == '[' || ((5) * 16 + 5) == ']' || ((5) * 16 + 5) == ':' || ((5) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 5) < ' ' || ((5) * 16 + 5) == '"' || ((5) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 5) >= ('a') && ((5) * 16 + 5) <= ('z')) || (((5) * 16 + 5) >= ('A') && ((5) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 6) >= ('0') && ((5) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 6) >= ('0') && ((5) * 16 + 6) <= ('9')) || ((5) * 16 + 6) == '-' || ((5) * 16 + 6) == '+' || ((5) * 16 + 6) == '.' || ((5) * 16 + 6) == 'e' || ((5) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 6) >= ('0') && ((5) * 16 + 6) <= ('9')) || (((5) * 16 + 6) >= ('a') && ((5) * 16 + 6) <= ('f')) || (((5) * 16 + 6) >= ('A') && ((5) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 6) == '{' || ((5) * 16 + 6) == '}' || ((5) * 16 + 6) == '[' || ((5) * 16 + 6) == ']' || ((5) * 16 + 6) == ':' || ((5) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 6) < ' ' || ((5) * 16 + 6) == '"' || ((5) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 6) >= ('a') && ((5) * 16 + 6) <= ('z')) || (((5) * 16 + 6) >= ('A') && ((5) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 7) >= ('0') && ((5) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 7) >= ('0') && ((5) * 16 + 7) <= ('9')) || ((5) * 16 + 7) == '-' || ((5) * 16 + 7) == '+' || ((5) * 16 + 7) == '.' || ((5) * 16 + 7) == 'e' || ((5) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 7) >= ('0') && ((5) * 16 + 7) <= ('9')) || (((5) * 16 + 7) >= ('a') && ((5) * 16 + 7) <= ('f')) || (((5) * 16 + 7) >= ('A') && ((5) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 7) == '{' || ((5) * 16 + 7) == '}' || ((5) * 16 + 7) == '[' || ((5) * 16 + 7) == ']' || ((5) * 16 + 7) == ':' || ((5) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 7) < ' ' || ((5) * 16 + 7) == '"' || ((5) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 7) >= ('a') && ((5) * 16 + 7) <= ('z')) || (((5) * 16 + 7) >= ('A') && ((5) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 8) >= ('0') && ((5) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 8) >= ('0') && ((5) * 16 + 8) <= ('9')) || ((5) * 16 + 8) == '-' || ((5) * 16 + 8) == '+' || ((5) * 16 + 8) == '.' || ((5) * 16 + 8) == 'e' || ((5) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 8) >= ('0') && ((5) * 16 + 8) <= ('9')) || (((5) * 16 + 8) >= ('a') && ((5) * 16 + 8) <= ('f')) || (((5) * 16 + 8) >= ('A') && ((5) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 8) == '{' || ((5) * 16 + 8) == '}' || ((5) * 16 + 8) == '[' || ((5) * 16 + 8) == ']' || ((5) * 16 + 8) == ':' || ((5) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 8) < ' ' || ((5) * 16 + 8) == '"' || ((5) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 8) >= ('a') && ((5) * 16 + 8) <= ('z')) || (((5) * 16 + 8) >= ('A') && ((5) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 9) >= ('0') && ((5) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 9) >= ('0') && ((5) * 16 + 9) <= ('9')) || ((5) * 16 + 9) == '-' || ((5) * 16 + 9) == '+' || ((5) * 16 + 9) == '.' || ((5) * 16 + 9) == 'e' || ((5) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 9) >= ('0') && ((5) * 16 + 9) <= ('9')) || (((5) * 16 + 9) >= ('a') && ((5) * 16 + 9) <= ('f')) || (((5) * 16 + 9) >= ('A') && ((5) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 9) == '{' || ((5) * 16 + 9) == '}' || ((5) * 16 + 9) == '[' || ((5) * 16 + 9) == ']' || ((5) * 16 + 9) == ':' || ((5) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 9) < ' ' || ((5) * 16 + 9) == '"' || ((5) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 9) >= ('a') && ((5) * 16 + 9) <= ('z')) || (((5) * 16 + 9) >= ('A') && ((5) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 10) >= ('0') && ((5) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 10) >= ('0') && ((5) * 16 + 10) <= ('9')) || ((5) * 16 + 10) == '-' || ((5) * 16 + 10) == '+' || ((5) * 16 + 10) == '.' || ((5) * 16 + 10) == 'e' || ((5) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 10) >= ('0') && ((5) * 16 + 10) <= ('9')) || (((5) * 16 + 10) >= ('a') && ((5) * 16 + 10) <= ('f')) || (((5) * 16 + 10) >= ('A') && ((5) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 10) == '{' || ((5) * 16 + 10) == '}' || ((5) * 16 + 10) == '[' || ((5) * 16 + 10) == ']' || ((5) * 16 + 10) == ':' || ((5) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 10) < ' ' || ((5) * 16 + 10) == '"' || ((5) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 10) >= ('a') && ((5) * 16 + 10) <= ('z')) || (((5) * 16 + 10) >= ('A') && ((5) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 11) >= ('0') && ((5) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 11) >= ('0') && ((5) * 16 + 11) <= ('9')) || ((5) * 16 + 11) == '-' || ((5) * 16 + 11) == '+' || ((5) * 16 + 11) == '.' || ((5) * 16 + 11) == 'e' || ((5) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 11) >= ('0') && ((5) * 16 + 11) <= ('9')) || (((5) * 16 + 11) >= ('a') && ((5) * 16 + 11) <= ('f')) || (((5) * 16 + 11) >= ('A') && ((5) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 11) == '{' || ((5) * 16 + 11) == '}' || ((5) * 16 + 11) == '[' || ((5) * 16 + 11) == ']' || ((5) * 16 + 11) == ':' || ((5) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 11) < ' ' || ((5) * 16 + 11) == '"' || ((5) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 11) >= ('a') && ((5) * 16 + 11) <= ('z')) || (((5) * 16 + 11) >= ('A') && ((5) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 12) >= ('0') && ((5) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 12) >= ('0') && ((5) * 16 + 12) <= ('9')) || ((5) * 16 + 12) == '-' || ((5) * 16 + 12) == '+' || ((5) * 16 + 12) == '.' || ((5) * 16 + 12) == 'e' || ((5) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 12) >= ('0') && ((5) * 16 + 12) <= ('9')) || (((5) * 16 + 12) >= ('a') && ((5) * 16 + 12) <= ('f')) || (((5) * 16 + 12) >= ('A') && ((5) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 12) == '{' || ((5) * 16 + 12) == '}' || ((5) * 16 + 12) == '[' || ((5) * 16 + 12) == ']' || ((5) * 16 + 12) == ':' || ((5) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 12) < ' ' || ((5) * 16 + 12) == '"' || ((5) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 12) >= ('a') && ((5) * 16 + 12) <= ('z')) || (((5) * 16 + 12) >= ('A') && ((5) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 13) >= ('0') && ((5) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 13) >= ('0') && ((5) * 16 + 13) <= ('9')) || ((5) * 16 + 13) == '-' || ((5) * 16 + 13) == '+' || ((5) * 16 + 13) == '.' || ((5) * 16 + 13) == 'e' || ((5) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 13) >= ('0') && ((5) * 16 + 13) <= ('9')) || (((5) * 16 + 13) >= ('a') && ((5) * 16 + 13) <= ('f')) || (((5) * 16 + 13) >= ('A') && ((5) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 13) == '{' || ((5) * 16 + 13) == '}' || ((5) * 16 + 13) == '[' || ((5) * 16 + 13) == ']' || ((5) * 16 + 13) == ':' || ((5) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 13) < ' ' || ((5) * 16 + 13) == '"' || ((5) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 13) >= ('a') && ((5) * 16 + 13) <= ('z')) || (((5) * 16 + 13) >= ('A') && ((5) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 14) >= ('0') && ((5) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 14) >= ('0') && ((5) * 16 + 14) <= ('9')) || ((5) * 16 + 14) == '-' || ((5) * 16 + 14) == '+' || ((5) * 16 + 14) == '.' || ((5) * 16 + 14) == 'e' || ((5) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 14) >= ('0') && ((5) * 16 + 14) <= ('9')) || (((5) * 16 + 14) >= ('a') && ((5) * 16 + 14) <= ('f')) || (((5) * 16 + 14) >= ('A') && ((5) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 14) == '{' || ((5) * 16 + 14) == '}' || ((5) * 16 + 14) == '[' || ((5) * 16 + 14) == ']' || ((5) * 16 + 14) == ':' || ((5) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 14) < ' ' || ((5) * 16 + 14) == '"' || ((5) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 14) >= ('a') && ((5) * 16 + 14) <= ('z')) || (((5) * 16 + 14) >= ('A') && ((5) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((5) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((5) * 16 + 15) >= ('0') && ((5) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((5) * 16 + 15) >= ('0') && ((5) * 16 + 15) <= ('9')) || ((5) * 16 + 15) == '-' || ((5) * 16 + 15) == '+' || ((5) * 16 + 15) == '.' || ((5) * 16 + 15) == 'e' || ((5) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((5) * 16 + 15) >= ('0') && ((5) * 16 + 15) <= ('9')) || (((5) * 16 + 15) >= ('a') && ((5) * 16 + 15) <= ('f')) || (((5) * 16 + 15) >= ('A') && ((5) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((5) * 16 + 15) == '{' || ((5) * 16 + 15) == '}' || ((5) * 16 + 15) == '[' || ((5) * 16 + 15) == ']' || ((5) * 16 + 15) == ':' || ((5) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((5) * 16 + 15) < ' ' || ((5) * 16 + 15) == '"' || ((5) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((5) * 16 + 15) >= ('a') && ((5) * 16 + 15) <= ('z')) || (((5) * 16 + 15) >= ('A') && ((5) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 0) >= ('0') && ((6) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 0) >= ('0') && ((6) * 16 + 0) <= ('9')) || ((6) * 16 + 0) == '-' || ((6) * 16 + 0) == '+' || ((6) * 16 + 0) == '.' || ((6) * 16 + 0) == 'e' || ((6) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 0) >= ('0') && ((6) * 16 + 0) <= ('9')) || (((6) * 16 + 0) >= ('a') && ((6) * 16 + 0) <= ('f')) || (((6) * 16 + 0) >= ('A') && ((6) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 0) == '{' || ((6) * 16 + 0) == '}' || ((6) * 16 + 0) == '[' || ((6) * 16 + 0) == ']' || ((6) * 16 + 0) == ':' || ((6) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 0) < ' ' || ((6) * 16 + 0) == '"' || ((6) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 0) >= ('a') && ((6) * 16 + 0) <= ('z')) || (((6) * 16 + 0) >= ('A') && ((6) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 1) >= ('0') && ((6) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 1) >= ('0') && ((6) * 16 + 1) <= ('9')) || ((6) * 16 + 1) == '-' || ((6) * 16 + 1) == '+' || ((6) * 16 + 1) == '.' || ((6) * 16 + 1) == 'e' || ((6) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 1) >= ('0') && ((6) * 16 + 1) <= ('9')) || (((6) * 16 + 1) >= ('a') && ((6) * 16 + 1) <= ('f')) || (((6) * 16 + 1) >= ('A') && ((6) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 1) == '{' || ((6) * 16 + 1) == '}' || ((6) * 16 + 1) == '[' || ((6) * 16 + 1) == ']' || ((6) * 16 + 1) == ':' || ((6) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 1) < ' ' || ((6) * 16 + 1) == '"' || ((6) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 1) >= ('a') && ((6) * 16 + 1) <= ('z')) || (((6) * 16 + 1) >= ('A') && ((6) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 2) >= ('0') && ((6) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 2) >= ('0') && ((6) * 16 + 2) <= ('9')) || ((6) * 16 + 2) == '-' || ((6) * 16 + 2) == '+' || ((6) * 16 + 2) == '.' || ((6) * 16 + 2) == 'e' || ((6) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 2) >= ('0') && ((6) * 16 + 2) <= ('9')) || (((6) * 16 + 2) >= ('a') && ((6) * 16 + 2) <= ('f')) || (((6) * 16 + 2) >= ('A') && ((6) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 2) == '{' || ((6) * 16 + 2) == '}' || ((6) * 16 + 2) == '[' || ((6) * 16 + 2) == ']' || ((6) * 16 + 2) == ':' || ((6) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 2) < ' ' || ((6) * 16 + 2) == '"' || ((6) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 2) >= ('a') && ((6) * 16 + 2) <= ('z')) || (((6) * 16 + 2) >= ('A') && ((6) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 3) >= ('0') && ((6) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 3) >= ('0') && ((6) * 16 + 3) <= ('9')) || ((6) * 16 + 3) == '-' || ((6) * 16 + 3) == '+' || ((6) * 16 + 3) == '.' || ((6) * 16 + 3) == 'e' || ((6) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 3) >= ('0') && ((6) * 16 + 3) <= ('9')) || (((6) * 16 + 3) >= ('a') && ((6) * 16 + 3) <= ('f')) || (((6) * 16 + 3) >= ('A') && ((6) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 3) == '{' || ((6) * 16 + 3) == '}' || ((6) * 16 + 3) == '[' || ((6) * 16 + 3) == ']' || ((6) * 16 + 3) == ':' || ((6) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 3) < ' ' || ((6) * 16 + 3) == '"' || ((6) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 3) >= ('a') && ((6) * 16 + 3) <= ('z')) || (((6) * 16 + 3) >= ('A') && ((6) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 4) >= ('0') && ((6) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 4) >= ('0') && ((6) * 16 + 4) <= ('9')) || ((6) * 16 + 4) == '-' || ((6) * 16 + 4) == '+' || ((6) * 16 + 4) == '.' || ((6) * 16 + 4) == 'e' || ((6) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 4) >= ('0') && ((6) * 16 + 4) <= ('9')) || (((6) * 16 + 4) >= ('a') && ((6) * 16 + 4) <= ('f')) || (((6) * 16 + 4) >= ('A') && ((6) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 4) == '{' || ((6) * 16 + 4) == '}' || ((6) * 16 + 4) == '[' || ((6) * 16 + 4) == ']' || ((6) * 16 + 4) == ':' || ((6) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 4) < ' ' || ((6) * 16 + 4) == '"' || ((6) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 4) >= ('a') && ((6) * 16 + 4) <= ('z')) || (((6) * 16 + 4) >= ('A') && ((6) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 5) >= ('0') && ((6) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 5) >= ('0') && ((6) * 16 + 5) <= ('9')) || ((6) * 16 + 5) == '-' || ((6) * 16 + 5) == '+' || ((6) * 16 + 5) == '.' || ((6) * 16 + 5) == 'e' || ((6) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 5) >= ('0') && ((6) * 16 + 5) <= ('9')) || (((6) * 16 + 5) >= ('a') && ((6) * 16 + 5) <= ('f')) || (((6) * 16 + 5) >= ('A') && ((6) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 5) == '{' || ((6) * 16 + 5) == '}' || ((6) * 16 + 5) == '[' || ((6) * 16 + 5) == ']' || ((6) * 16 + 5) == ':' || ((6) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 5) < ' ' || ((6) * 16 + 5) == '"' || ((6) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 5) >= ('a') && ((6) * 16 + 5) <= ('z')) || (((6) * 16 + 5) >= ('A') && ((6) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 6) >= ('0') && ((6) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 6) >= ('0') && ((6) * 16 + 6) <= ('9')) || ((6) * 16 + 6) == '-' || ((6) * 16 + 6) == '+' || ((6) * 16 + 6) == '.' || ((6) * 16 + 6) == 'e' || ((6) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 6) >= ('0') && ((6) * 16 + 6) <= ('9')) || (((6) * 16 + 6) >= ('a') && ((6) * 16 + 6) <= ('f')) || (((6) * 16 + 6) >= ('A') && ((6) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 6) == '{' || ((6) * 16 + 6) == '}' || ((6) * 16 + 6) == '[' || ((6) * 16 + 6) == ']' || ((6) * 16 + 6) == ':' || ((6) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 6) < ' ' || ((6) * 16 + 6) == '"' || ((6) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 6) >= ('a') && ((6) * 16 + 6) <= ('z')) || (((6) * 16 + 6) >= ('A') && ((6) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 7) >= ('0') && ((6) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 7) >= ('0') && ((6) * 16 + 7) <= ('9')) || ((6) * 16 + 7) == '-' || ((6) * 16 + 7) == '+' || ((6) * 16 + 7) == '.' || ((6) * 16 + 7) == 'e' || ((6) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 7) >= ('0') && ((6) * 16 + 7) <= ('9')) || (((6) * 16 + 7) >= ('a') && ((6) * 16 + 7) <= ('f')) || (((6) * 16 + 7) >= ('A') && ((6) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 7) == '{' || ((6) * 16 + 7) == '}' || ((6) * 16 + 7) == '[' || ((6) * 16 + 7) == ']' || ((6) * 16 + 7) == ':' || ((6) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 7) < ' ' || ((6) * 16 + 7) == '"' || ((6) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 7) >= ('a') && ((6) * 16 + 7) <= ('z')) || (((6) * 16 + 7) >= ('A') && ((6) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 8) >= ('0') && ((6) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 8) >= ('0') && ((6) * 16 + 8) <= ('9')) || ((6) * 16 + 8) == '-' || ((6) * 16 + 8) == '+' || ((6) * 16 + 8) == '.' || ((6) * 16 + 8) == 'e' || ((6) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 8) >= ('0') && ((6) * 16 + 8) <= ('9')) || (((6) * 16 + 8) >= ('a') && ((6) * 16 + 8) <= ('f')) || (((6) * 16 + 8) >= ('A') && ((6) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 8) == '{' || ((6) * 16 + 8) == '}' || ((6) * 16 + 8) == '[' || ((6) * 16 + 8) == ']' || ((6) * 16 + 8) == ':' || ((6) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 8) < ' ' || ((6) * 16 + 8) == '"' || ((6) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 8) >= ('a') && ((6) * 16 + 8) <= ('z')) || (((6) * 16 + 8) >= ('A') && ((6) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 9) >= ('0') && ((6) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 9) >= ('0') && ((6) * 16 + 9) <= ('9')) || ((6) * 16 + 9) == '-' || ((6) * 16 + 9) == '+' || ((6) * 16 + 9) == '.' || ((6) * 16 + 9) == 'e' || ((6) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 9) >= ('0') && ((6) * 16 + 9) <= ('9')) || (((6) * 16 + 9) >= ('a') && ((6) * 16 + 9) <= ('f')) || (((6) * 16 + 9) >= ('A') && ((6) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 9) == '{' || ((6) * 16 + 9) == '}' || ((6) * 16 + 9) == '[' || ((6) * 16 + 9) == ']' || ((6) * 16 + 9) == ':' || ((6) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 9) < ' ' || ((6) * 16 + 9) == '"' || ((6) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 9) >= ('a') && ((6) * 16 + 9) <= ('z')) || (((6) * 16 + 9) >= ('A') && ((6) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 10) >= ('0') && ((6) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 10) >= ('0') && ((6) * 16 + 10) <= ('9')) || ((6) * 16 + 10) == '-' || ((6) * 16 + 10) == '+' || ((6) * 16 + 10) == '.' || ((6) * 16 + 10) == 'e' || ((6) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 10) >= ('0') && ((6) * 16 + 10) <= ('9')) || (((6) * 16 + 10) >= ('a') && ((6) * 16 + 10) <= ('f')) || (((6) * 16 + 10) >= ('A') && ((6) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 10) == '{' || ((6) * 16 + 10) == '}' || ((6) * 16 + 10) == '[' || ((6) * 16 + 10) == ']' || ((6) * 16 + 10) == ':' || ((6) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 10) < ' ' || ((6) * 16 + 10) == '"' || ((6) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 10) >= ('a') && ((6) * 16 + 10) <= ('z')) || (((6) * 16 + 10) >= ('A') && ((6) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 11) >= ('0') && ((6) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 11) >= ('0') && ((6) * 16 + 11) <= ('9')) || ((6) * 16 + 11) == '-' || ((6) * 16 + 11) == '+' || ((6) * 16 + 11) == '.' || ((6) * 16 + 11) == 'e' || ((6) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 11) >= ('0') && ((6) * 16 + 11) <= ('9')) || (((6) * 16 + 11) >= ('a') && ((6) * 16 + 11) <= ('f')) || (((6) * 16 + 11) >= ('A') && ((6) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 11) == '{' || ((6) * 16 + 11) == '}' || ((6) * 16 + 11) == '[' || ((6) * 16 + 11) == ']' || ((6) * 16 + 11) == ':' || ((6) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 11) < ' ' || ((6) * 16 + 11) == '"' || ((6) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 11) >= ('a') && ((6) * 16 + 11) <= ('z')) || (((6) * 16 + 11) >= ('A') && ((6) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 12) >= ('0') && ((6) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 12) >= ('0') && ((6) * 16 + 12) <= ('9')) || ((6) * 16 + 12) == '-' || ((6) * 16 + 12) == '+' || ((6) * 16 + 12) == '.' || ((6) * 16 + 12) == 'e' || ((6) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 12) >= ('0') && ((6) * 16 + 12) <= ('9')) || (((6) * 16 + 12) >= ('a') && ((6) * 16 + 12) <= ('f')) || (((6) * 16 + 12) >= ('A') && ((6) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 12) == '{' || ((6) * 16 + 12) == '}' || ((6) * 16 + 12) == '[' || ((6) * 16 + 12) == ']' || ((6) * 16 + 12) == ':' || ((6) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 12) < ' ' || ((6) * 16 + 12) == '"' || ((6) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 12) >= ('a') && ((6) * 16 + 12) <= ('z')) || (((6) * 16 + 12) >= ('A') && ((6) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 13) >= ('0') && ((6) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 13) >= ('0') && ((6) * 16 + 13) <= ('9')) || ((6) * 16 + 13) == '-' || ((6) * 16 + 13) == '+' || ((6) * 16 + 13) == '.' || ((6) * 16 + 13) == 'e' || ((6) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 13) >= ('0') && ((6) * 16 + 13) <= ('9')) || (((6) * 16 + 13) >= ('a') && ((6) * 16 + 13) <= ('f')) || (((6) * 16 + 13) >= ('A') && ((6) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 13) == '{' || ((6) * 16 + 13) == '}' || ((6) * 16 + 13) == '[' || ((6) * 16 + 13) == ']' || ((6) * 16 + 13) == ':' || ((6) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 13) < ' ' || ((6) * 16 + 13) == '"' || ((6) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 13) >= ('a') && ((6) * 16 + 13) <= ('z')) || (((6) * 16 + 13) >= ('A') && ((6) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 14) >= ('0') && ((6) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 14) >= ('0') && ((6) * 16 + 14) <= ('9')) || ((6) * 16 + 14) == '-' || ((6) * 16 + 14) == '+' || ((6) * 16 + 14) == '.' || ((6) * 16 + 14) == 'e' || ((6) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 14) >= ('0') && ((6) * 16 + 14) <= ('9')) || (((6) * 16 + 14) >= ('a') && ((6) * 16 + 14) <= ('f')) || (((6) * 16 + 14) >= ('A') && ((6) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 14) == '{' || ((6) * 16 + 14) == '}' || ((6) * 16 + 14) == '[' || ((6) * 16 + 14) == ']' || ((6) * 16 + 14) == ':' || ((6) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 14) < ' ' || ((6) * 16 + 14) == '"' || ((6) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 14) >= ('a') && ((6) * 16 + 14) <= ('z')) || (((6) * 16 + 14) >= ('A') && ((6) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((6) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((6) * 16 + 15) >= ('0') && ((6) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((6) * 16 + 15) >= ('0') && ((6) * 16 + 15) <= ('9')) || ((6) * 16 + 15) == '-' || ((6) * 16 + 15) == '+' || ((6) * 16 + 15) == '.' || ((6) * 16 + 15) == 'e' || ((6) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((6) * 16 + 15) >= ('0') && ((6) * 16 + 15) <= ('9')) || (((6) * 16 + 15) >= ('a') && ((6) * 16 + 15) <= ('f')) || (((6) * 16 + 15) >= ('A') && ((6) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((6) * 16 + 15) == '{' || ((6) * 16 + 15) == '}' || ((6) * 16 + 15) == '[' || ((6) * 16 + 15) == ']' || ((6) * 16 + 15) == ':' || ((6) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((6) * 16 + 15) < ' ' || ((6) * 16 + 15) == '"' || ((6) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((6) * 16 + 15) >= ('a') && ((6) * 16 + 15) <= ('z')) || (((6) * 16 + 15) >= ('A') && ((6) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 0) >= ('0') && ((7) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 0) >= ('0') && ((7) * 16 + 0) <= ('9')) || ((7) * 16 + 0) == '-' || ((7) * 16 + 0) == '+' || ((7) * 16 + 0) == '.' || ((7) * 16 + 0) == 'e' || ((7) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 0) >= ('0') && ((7) * 16 + 0) <= ('9')) || (((7) * 16 + 0) >= ('a') && ((7) * 16 + 0) <= ('f')) || (((7) * 16 + 0) >= ('A') && ((7) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 0) == '{' || ((7) * 16 + 0) == '}' || ((7) * 16 + 0) == '[' || ((7) * 16 + 0) == ']' || ((7) * 16 + 0) == ':' || ((7) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 0) < ' ' || ((7) * 16 + 0) == '"' || ((7) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 0) >= ('a') && ((7) * 16 + 0) <= ('z')) || (((7) * 16 + 0) >= ('A') && ((7) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 1) >= ('0') && ((7) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 1) >= ('0') && ((7) * 16 + 1) <= ('9')) || ((7) * 16 + 1) == '-' || ((7) * 16 + 1) == '+' || ((7) * 16 + 1) == '.' || ((7) * 16 + 1) == 'e' || ((7) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 1) >= ('0') && ((7) * 16 + 1) <= ('9')) || (((7) * 16 + 1) >= ('a') && ((7) * 16 + 1) <= ('f')) || (((7) * 16 + 1) >= ('A') && ((7) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 1) == '{' || ((7) * 16 + 1) == '}' || ((7) * 16 + 1) == '[' || ((7) * 16 + 1) == ']' || ((7) * 16 + 1) == ':' || ((7) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 1) < ' ' || ((7) * 16 + 1) == '"' || ((7) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 1) >= ('a') && ((7) * 16 + 1) <= ('z')) || (((7) * 16 + 1) >= ('A') && ((7) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 2) >= ('0') && ((7) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 2) >= ('0') && ((7) * 16 + 2) <= ('9')) || ((7) * 16 + 2) == '-' || ((7) * 16 + 2) == '+' || ((7) * 16 + 2) == '.' || ((7) * 16 + 2) == 'e' || ((7) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 2) >= ('0') && ((7) * 16 + 2) <= ('9')) || (((7) * 16 + 2) >= ('a') && ((7) * 16 + 2) <= ('f')) || (((7) * 16 + 2) >= ('A') && ((7) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 2) == '{' || ((7) * 16 + 2) == '}' || ((7) * 16 + 2) == '[' || ((7) * 16 + 2) == ']' || ((7) * 16 + 2) == ':' || ((7) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 2) < ' ' || ((7) * 16 + 2) == '"' || ((7) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 2) >= ('a') && ((7) * 16 + 2) <= ('z')) || (((7) * 16 + 2) >= ('A') && ((7) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 3) >= ('0') && ((7) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 3) >= ('0') && ((7) * 16 + 3) <= ('9')) || ((7) * 16 + 3) == '-' || ((7) * 16 + 3) == '+' || ((7) * 16 + 3) == '.' || ((7) * 16 + 3) == 'e' || ((7) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 3) >= ('0') && ((7) * 16 + 3) <= ('9')) || (((7) * 16 + 3) >= ('a') && ((7) * 16 + 3) <= ('f')) || (((7) * 16 + 3) >= ('A') && ((7) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 3) == '{' || ((7) * 16 + 3) == '}' || ((7) * 16 + 3) == '[' || ((7) * 16 + 3) == ']' || ((7) * 16 + 3) == ':' || ((7) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 3) < ' ' || ((7) * 16 + 3) == '"' || ((7) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 3) >= ('a') && ((7) * 16 + 3) <= ('z')) || (((7) * 16 + 3) >= ('A') && ((7) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 4) >= ('0') && ((7) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 4) >= ('0') && ((7) * 16 + 4) <= ('9')) || ((7) * 16 + 4) == '-' || ((7) * 16 + 4) == '+' || ((7) * 16 + 4) == '.' || ((7) * 16 + 4) == 'e' || ((7) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 4) >= ('0') && ((7) * 16 + 4) <= ('9')) || (((7) * 16 + 4) >= ('a') && ((7) * 16 + 4) <= ('f')) || (((7) * 16 + 4) >= ('A') && ((7) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 4) == '{' || ((7) * 16 + 4) == '}' || ((7) * 16 + 4) == '[' || ((7) * 16 + 4) == ']' || ((7) * 16 + 4) == ':' || ((7) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 4) < ' ' || ((7) * 16 + 4) == '"' || ((7) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 4) >= ('a') && ((7) * 16 + 4) <= ('z')) || (((7) * 16 + 4) >= ('A') && ((7) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 5) >= ('0') && ((7) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 5) >= ('0') && ((7) * 16 + 5) <= ('9')) || ((7) * 16 + 5) == '-' || ((7) * 16 + 5) == '+' || ((7) * 16 + 5) == '.' || ((7) * 16 + 5) == 'e' || ((7) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 5) >= ('0') && ((7) * 16 + 5) <= ('9')) || (((7) * 16 + 5) >= ('a') && ((7) * 16 + 5) <= ('f')) || (((7) * 16 + 5) >= ('A') && ((7) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 5) == '{' || ((7) * 16 + 5) == '}' || ((7) * 16 + 5) == '[' || ((7) * 16 + 5) == ']' || ((7) * 16 + 5) == ':' || ((7) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 5) < ' ' || ((7) * 16 + 5) == '"' || ((7) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 5) >= ('a') && ((7) * 16 + 5) <= ('z')) || (((7) * 16 + 5) >= ('A') && ((7) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 6) >= ('0') && ((7) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 6) >= ('0') && ((7) * 16 + 6) <= ('9')) || ((7) * 16 + 6) == '-' || ((7) * 16 + 6) == '+' || ((7) * 16 + 6) == '.' || ((7) * 16 + 6) == 'e' || ((7) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 6) >= ('0') && ((7) * 16 + 6) <= ('9')) || (((7) * 16 + 6) >= ('a') && ((7) * 16 + 6) <= ('f')) || (((7) * 16 + 6) >= ('A') && ((7) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 6) == '{' || ((7) * 16 + 6) == '}' || ((7) * 16 + 6) == '[' || ((7) * 16 + 6) == ']' || ((7) * 16 + 6) == ':' || ((7) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 6) < ' ' || ((7) * 16 + 6) == '"' || ((7) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 6) >= ('a') && ((7) * 16 + 6) <= ('z')) || (((7) * 16 + 6) >= ('A') && ((7) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 7) >= ('0') && ((7) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 7) >= ('0') && ((7) * 16 + 7) <= ('9')) || ((7) * 16 + 7) == '-' || ((7) * 16 + 7) == '+' || ((7) * 16 + 7) == '.' || ((7) * 16 + 7) == 'e' || ((7) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 7) >= ('0') && ((7) * 16 + 7) <= ('9')) || (((7) * 16 + 7) >= ('a') && ((7) * 16 + 7) <= ('f')) || (((7) * 16 + 7) >= ('A') && ((7) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 7) == '{' || ((7) * 16 + 7) == '}' || ((7) * 16 + 7) == '[' || ((7) * 16 + 7) == ']' || ((7) * 16 + 7) == ':' || ((7) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 7) < ' ' || ((7) * 16 + 7) == '"' || ((7) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 7) >= ('a') && ((7) * 16 + 7) <= ('z')) || (((7) * 16 + 7) >= ('A') && ((7) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 8) >= ('0') && ((7) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 8) >= ('0') && ((7) * 16 + 8) <= ('9')) || ((7) * 16 + 8) == '-' || ((7) * 16 + 8) == '+' || ((7) * 16 + 8) == '.' || ((7) * 16 + 8) == 'e' || ((7) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 8) >= ('0') && ((7) * 16 + 8) <= ('9')) || (((7) * 16 + 8) >= ('a') && ((7) * 16 + 8) <= ('f')) || (((7) * 16 + 8) >= ('A') && ((7) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 8) == '{' || ((7) * 16 + 8) == '}' || ((7) * 16 + 8) == '[' || ((7) * 16 + 8) == ']' || ((7) * 16 + 8) == ':' || ((7) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 8) < ' ' || ((7) * 16 + 8) == '"' || ((7) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 8) >= ('a') && ((7) * 16 + 8) <= ('z')) || (((7) * 16 + 8) >= ('A') && ((7) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 9) >= ('0') && ((7) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 9) >= ('0') && ((7) * 16 + 9) <= ('9')) || ((7) * 16 + 9) == '-' || ((7) * 16 + 9) == '+' || ((7) * 16 + 9) == '.' || ((7) * 16 + 9) == 'e' || ((7) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 9) >= ('0') && ((7) * 16 + 9) <= ('9')) || (((7) * 16 + 9) >= ('a') && ((7) * 16 + 9) <= ('f')) || (((7) * 16 + 9) >= ('A') && ((7) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 9) == '{' || ((7) * 16 + 9) == '}' || ((7) * 16 + 9) == '[' || ((7) * 16 + 9) == ']' || ((7) * 16 + 9) == ':' || ((7) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 9) < ' ' || ((7) * 16 + 9) == '"' || ((7) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 9) >= ('a') && ((7) * 16 + 9) <= ('z')) || (((7) * 16 + 9) >= ('A') && ((7) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 10) >= ('0') && ((7) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 10) >= ('0') && ((7) * 16 + 10) <= ('9')) || ((7) * 16 + 10) == '-' || ((7) * 16 + 10) == '+' || ((7) * 16 + 10) == '.' || ((7) * 16 + 10) == 'e' || ((7) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 10) >= ('0') && ((7) * 16 + 10) <= ('9')) || (((7) * 16 + 10) >= ('a') && ((7) * 16 + 10) <= ('f')) || (((7) * 16 + 10) >= ('A') && ((7) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 10) == '{' || ((7) * 16 + 10) == '}' || ((7) * 16 + 10) == '[' || ((7) * 16 + 10) == ']' || ((7) * 16 + 10) == ':' || ((7) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 10) < ' ' || ((7) * 16 + 10) == '"' || ((7) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 10) >= ('a') && ((7) * 16 + 10) <= ('z')) || (((7) * 16 + 10) >= ('A') && ((7) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 11) >= ('0') && ((7) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 11) >= ('0') && ((7) * 16 + 11) <= ('9')) || ((7) * 16 + 11) == '-' || ((7) * 16 + 11) == '+' || ((7) * 16 + 11) == '.' || ((7) * 16 + 11) == 'e' || ((7) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 11) >= ('0') && ((7) * 16 + 11) <= ('9')) || (((7) * 16 + 11) >= ('a') && ((7) * 16 + 11) <= ('f')) || (((7) * 16 + 11) >= ('A') && ((7) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 11) == '{' || ((7) * 16 + 11) == '}' || ((7) * 16 + 11) == '[' || ((7) * 16 + 11) == ']' || ((7) * 16 + 11) == ':' || ((7) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 11) < ' ' || ((7) * 16 + 11) == '"' || ((7) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 11) >= ('a') && ((7) * 16 + 11) <= ('z')) || (((7) * 16 + 11) >= ('A') && ((7) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 12) >= ('0') && ((7) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 12) >= ('0') && ((7) * 16 + 12) <= ('9')) || ((7) * 16 + 12) == '-' || ((7) * 16 + 12) == '+' || ((7) * 16 + 12) == '.' || ((7) * 16 + 12) == 'e' || ((7) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 12) >= ('0') && ((7) * 16 + 12) <= ('9')) || (((7) * 16 + 12) >= ('a') && ((7) * 16 + 12) <= ('f')) || (((7) * 16 + 12) >= ('A') && ((7) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 12) == '{' || ((7) * 16 + 12) == '}' || ((7) * 16 + 12) == '[' || ((7) * 16 + 12) == ']' || ((7) * 16 + 12) == ':' || ((7) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 12) < ' ' || ((7) * 16 + 12) == '"' || ((7) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 12) >= ('a') && ((7) * 16 + 12) <= ('z')) || (((7) * 16 + 12) >= ('A') && ((7) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 13) >= ('0') && ((7) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 13) >= ('0') && ((7) * 16 + 13) <= ('9')) || ((7) * 16 + 13) == '-' || ((7) * 16 + 13) == '+' || ((7) * 16 + 13) == '.' || ((7) * 16 + 13) == 'e' || ((7) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 13) >= ('0') && ((7) * 16 + 13) <= ('9')) || (((7) * 16 + 13) >= ('a') && ((7) * 16 + 13) <= ('f')) || (((7) * 16 + 13) >= ('A') && ((7) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 13) == '{' || ((7) * 16 + 13) == '}' || ((7) * 16 + 13) == '[' || ((7) * 16 + 13) == ']' || ((7) * 16 + 13) == ':' || ((7) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 13) < ' ' || ((7) * 16 + 13) == '"' || ((7) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 13) >= ('a') && ((7) * 16 + 13) <= ('z')) || (((7) * 16 + 13) >= ('A') && ((7) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 14) >= ('0') && ((7) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 14) >= ('0') && ((7) * 16 + 14) <= ('9')) || ((7) * 16 + 14) == '-' || ((7) * 16 + 14) == '+' || ((7) * 16 + 14) == '.' || ((7) * 16 + 14) == 'e' || ((7) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 14) >= ('0') && ((7) * 16 + 14) <= ('9')) || (((7) * 16 + 14) >= ('a') && ((7) * 16 + 14) <= ('f')) || (((7) * 16 + 14) >= ('A') && ((7) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 14) == '{' || ((7) * 16 + 14) == '}' || ((7) * 16 + 14) == '[' || ((7) * 16 + 14) == ']' || ((7) * 16 + 14) == ':' || ((7) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 14) < ' ' || ((7) * 16 + 14) == '"' || ((7) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 14) >= ('a') && ((7) * 16 + 14) <= ('z')) || (((7) * 16 + 14) >= ('A') && ((7) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((7) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((7) * 16 + 15) >= ('0') && ((7) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((7) * 16 + 15) >= ('0') && ((7) * 16 + 15) <= ('9')) || ((7) * 16 + 15) == '-' || ((7) * 16 + 15) == '+' || ((7) * 16 + 15) == '.' || ((7) * 16 + 15) == 'e' || ((7) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((7) * 16 + 15) >= ('0') && ((7) * 16 + 15) <= ('9')) || (((7) * 16 + 15) >= ('a') && ((7) * 16 + 15) <= ('f')) || (((7) * 16 + 15) >= ('A') && ((7) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((7) * 16 + 15) == '{' || ((7) * 16 + 15) == '}' || ((7) * 16 + 15) == '[' || ((7) * 16 + 15) == ']' || ((7) * 16 + 15) == ':' || ((7) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((7) * 16 + 15) < ' ' || ((7) * 16 + 15) == '"' || ((7) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((7) * 16 + 15) >= ('a') && ((7) * 16 + 15) <= ('z')) || (((7) * 16 + 15) >= ('A') && ((7) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)),
+  ( (((8) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 0) >= ('0') && ((8) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 0) >= ('0') && ((8) * 16 + 0) <= ('9')) || ((8) * 16 + 0) == '-' || ((8) * 16 + 0) == '+' || ((8) * 16 + 0) == '.' || ((8) * 16 + 0) == 'e' || ((8) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 0) >= ('0') && ((8) * 16 + 0) <= ('9')) || (((8) * 16 + 0) >= ('a') && ((8) * 16 + 0) <= ('f')) || (((8) * 16 + 0) >= ('A') && ((8) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 0) == '{' || ((8) * 16 + 0) == '}' || ((8) * 16 + 0) == '[' || ((8) * 16 + 0) == ']' || ((8) * 16 + 0) == ':' || ((8) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 0) < ' ' || ((8) * 16 + 0) == '"' || ((8) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 0) >= ('a') && ((8) * 16 + 0) <= ('z')) || (((8) * 16 + 0) >= ('A') && ((8) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 1) >= ('0') && ((8) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 1) >= ('0') && ((8) * 16 + 1) <= ('9')) || ((8) * 16 + 1) == '-' || ((8) * 16 + 1) == '+' || ((8) * 16 + 1) == '.' || ((8) * 16 + 1) == 'e' || ((8) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 1) >= ('0') && ((8) * 16 + 1) <= ('9')) || (((8) * 16 + 1) >= ('a') && ((8) * 16 + 1) <= ('f')) || (((8) * 16 + 1) >= ('A') && ((8) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 1) == '{' || ((8) * 16 + 1) == '}' || ((8) * 16 + 1) == '[' || ((8) * 16 + 1) == ']' || ((8) * 16 + 1) == ':' || ((8) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 1) < ' ' || ((8) * 16 + 1) == '"' || ((8) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 1) >= ('a') && ((8) * 16 + 1) <= ('z')) || (((8) * 16 + 1) >= ('A') && ((8) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 2) >= ('0') && ((8) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 2) >= ('0') && ((8) * 16 + 2) <= ('9')) || ((8) * 16 + 2) == '-' || ((8) * 16 + 2) == '+' || ((8) * 16 + 2) == '.' || ((8) * 16 + 2) == 'e' || ((8) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 2) >= ('0') && ((8) * 16 + 2) <= ('9')) || (((8) * 16 + 2) >= ('a') && ((8) * 16 + 2) <= ('f')) || (((8) * 16 + 2) >= ('A') && ((8) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 2) == '{' || ((8) * 16 + 2) == '}' || ((8) * 16 + 2) == '[' || ((8) * 16 + 2) == ']' || ((8) * 16 + 2) == ':' || ((8) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 2) < ' ' || ((8) * 16 + 2) == '"' || ((8) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 2) >= ('a') && ((8) * 16 + 2) <= ('z')) || (((8) * 16 + 2) >= ('A') && ((8) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 3) >= ('0') && ((8) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 3) >= ('0') && ((8) * 16 + 3) <= ('9')) || ((8) * 16 + 3) == '-' || ((8) * 16 + 3) == '+' || ((8) * 16 + 3) == '.' || ((8) * 16 + 3) == 'e' || ((8) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 3) >= ('0') && ((8) * 16 + 3) <= ('9')) || (((8) * 16 + 3) >= ('a') && ((8) * 16 + 3) <= ('f')) || (((8) * 16 + 3) >= ('A') && ((8) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 3) == '{' || ((8) * 16 + 3) == '}' || ((8) * 16 + 3) == '[' || ((8) * 16 + 3) == ']' || ((8) * 16 + 3) == ':' || ((8) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 3) < ' ' || ((8) * 16 + 3) == '"' || ((8) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 3) >= ('a') && ((8) * 16 + 3) <= ('z')) || (((8) * 16 + 3) >= ('A') && ((8) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 4) >= ('0') && ((8) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 4) >= ('0') && ((8) * 16 + 4) <= ('9')) || ((8) * 16 + 4) == '-' || ((8) * 16 + 4) == '+' || ((8) * 16 + 4) == '.' || ((8) * 16 + 4) == 'e' || ((8) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 4) >= ('0') && ((8) * 16 + 4) <= ('9')) || (((8) * 16 + 4) >= ('a') && ((8) * 16 + 4) <= ('f')) || (((8) * 16 + 4) >= ('A') && ((8) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 4) == '{' || ((8) * 16 + 4) == '}' || ((8) * 16 + 4) == '[' || ((8) * 16 + 4) == ']' || ((8) * 16 + 4) == ':' || ((8) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 4) < ' ' || ((8) * 16 + 4) == '"' || ((8) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 4) >= ('a') && ((8) * 16 + 4) <= ('z')) || (((8) * 16 + 4) >= ('A') && ((8) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 5) >= ('0') && ((8) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 5) >= ('0') && ((8) * 16 + 5) <= ('9')) || ((8) * 16 + 5) == '-' || ((8) * 16 + 5) == '+' || ((8) * 16 + 5) == '.' || ((8) * 16 + 5) == 'e' || ((8) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 5) >= ('0') && ((8) * 16 + 5) <= ('9')) || (((8) * 16 + 5) >= ('a') && ((8) * 16 + 5) <= ('f')) || (((8) * 16 + 5) >= ('A') && ((8) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 5) == '{' || ((8) * 16 + 5) == '}' || ((8) * 16 + 5) == '[' || ((8) * 16 + 5) == ']' || ((8) * 16 + 5) == ':' || ((8) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 5) < ' ' || ((8) * 16 + 5) == '"' || ((8) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 5) >= ('a') && ((8) * 16 + 5) <= ('z')) || (((8) * 16 + 5) >= ('A') && ((8) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 6) >= ('0') && ((8) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 6) >= ('0') && ((8) * 16 + 6) <= ('9')) || ((8) * 16 + 6) == '-' || ((8) * 16 + 6) == '+' || ((8) * 16 + 6) == '.' || ((8) * 16 + 6) == 'e' || ((8) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 6) >= ('0') && ((8) * 16 + 6) <= ('9')) || (((8) * 16 + 6) >= ('a') && ((8) * 16 + 6) <= ('f')) || (((8) * 16 + 6) >= ('A') && ((8) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 6) == '{' || ((8) * 16 + 6) == '}' || ((8) * 16 + 6) == '[' || ((8) * 16 + 6) == ']' || ((8) * 16 + 6) == ':' || ((8) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 6) < ' ' || ((8) * 16 + 6) == '"' || ((8) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 6) >= ('a') && ((8) * 16 + 6) <= ('z')) || (((8) * 16 + 6) >= ('A') && ((8) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 7) >= ('0') && ((8) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 7) >= ('0') && ((8) * 16 + 7) <= ('9')) || ((8) * 16 + 7) == '-' || ((8) * 16 + 7) == '+' || ((8) * 16 + 7) == '.' || ((8) * 16 + 7) == 'e' || ((8) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 7) >= ('0') && ((8) * 16 + 7) <= ('9')) || (((8) * 16 + 7) >= ('a') && ((8) * 16 + 7) <= ('f')) || (((8) * 16 + 7) >= ('A') && ((8) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 7) == '{' || ((8) * 16 + 7) == '}' || ((8) * 16 + 7) == '[' || ((8) * 16 + 7) == ']' || ((8) * 16 + 7) == ':' || ((8) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 7) < ' ' || ((8) * 16 + 7) == '"' || ((8) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 7) >= ('a') && ((8) * 16 + 7) <= ('z')) || (((8) * 16 + 7) >= ('A') && ((8) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 8) >= ('0') && ((8) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 8) >= ('0') && ((8) * 16 + 8) <= ('9')) || ((8) * 16 + 8) == '-' || ((8) * 16 + 8) == '+' || ((8) * 16 + 8) == '.' || ((8) * 16 + 8) == 'e' || ((8) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 8) >= ('0') && ((8) * 16 + 8) <= ('9')) || (((8) * 16 + 8) >= ('a') && ((8) * 16 + 8) <= ('f')) || (((8) * 16 + 8) >= ('A') && ((8) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 8) == '{' || ((8) * 16 + 8) == '}' || ((8) * 16 + 8) == '[' || ((8) * 16 + 8) == ']' || ((8) * 16 + 8) == ':' || ((8) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 8) < ' ' || ((8) * 16 + 8) == '"' || ((8) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 8) >= ('a') && ((8) * 16 + 8) <= ('z')) || (((8) * 16 + 8) >= ('A') && ((8) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 9) >= ('0') && ((8) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 9) >= ('0') && ((8) * 16 + 9) <= ('9')) || ((8) * 16 + 9) == '-' || ((8) * 16 + 9) == '+' || ((8) * 16 + 9) == '.' || ((8) * 16 + 9) == 'e' || ((8) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 9) >= ('0') && ((8) * 16 + 9) <= ('9')) || (((8) * 16 + 9) >= ('a') && ((8) * 16 + 9) <= ('f')) || (((8) * 16 + 9) >= ('A') && ((8) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 9) == '{' || ((8) * 16 + 9) == '}' || ((8) * 16 + 9) == '[' || ((8) * 16 + 9) == ']' || ((8) * 16 + 9) == ':' || ((8) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 9) < ' ' || ((8) * 16 + 9) == '"' || ((8) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 9) >= ('a') && ((8) * 16 + 9) <= ('z')) || (((8) * 16 + 9) >= ('A') && ((8) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 10) >= ('0') && ((8) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 10) >= ('0') && ((8) * 16 + 10) <= ('9')) || ((8) * 16 + 10) == '-' || ((8) * 16 + 10) == '+' || ((8) * 16 + 10) == '.' || ((8) * 16 + 10) == 'e' || ((8) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 10) >= ('0') && ((8) * 16 + 10) <= ('9')) || (((8) * 16 + 10) >= ('a') && ((8) * 16 + 10) <= ('f')) || (((8) * 16 + 10) >= ('A') && ((8) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 10) == '{' || ((8) * 16 + 10) == '}' || ((8) * 16 + 10) == '[' || ((8) * 16 + 10) == ']' || ((8) * 16 + 10) == ':' || ((8) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 10) < ' ' || ((8) * 16 + 10) == '"' || ((8) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 10) >= ('a') && ((8) * 16 + 10) <= ('z')) || (((8) * 16 + 10) >= ('A') && ((8) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 11) >= ('0') && ((8) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 11) >= ('0') && ((8) * 16 + 11) <= ('9')) || ((8) * 16 + 11) == '-' || ((8) * 16 + 11) == '+' || ((8) * 16 + 11) == '.' || ((8) * 16 + 11) == 'e' || ((8) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 11) >= ('0') && ((8) * 16 + 11) <= ('9')) || (((8) * 16 + 11) >= ('a') && ((8) * 16 + 11) <= ('f')) || (((8) * 16 + 11) >= ('A') && ((8) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 11) == '{' || ((8) * 16 + 11) == '}' || ((8) * 16 + 11) == '[' || ((8) * 16 + 11) == ']' || ((8) * 16 + 11) == ':' || ((8) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 11) < ' ' || ((8) * 16 + 11) == '"' || ((8) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 11) >= ('a') && ((8) * 16 + 11) <= ('z')) || (((8) * 16 + 11) >= ('A') && ((8) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 12) >= ('0') && ((8) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 12) >= ('0') && ((8) * 16 + 12) <= ('9')) || ((8) * 16 + 12) == '-' || ((8) * 16 + 12) == '+' || ((8) * 16 + 12) == '.' || ((8) * 16 + 12) == 'e' || ((8) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 12) >= ('0') && ((8) * 16 + 12) <= ('9')) || (((8) * 16 + 12) >= ('a') && ((8) * 16 + 12) <= ('f')) || (((8) * 16 + 12) >= ('A') && ((8) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 12) == '{' || ((8) * 16 + 12) == '}' || ((8) * 16 + 12) == '[' || ((8) * 16 + 12) == ']' || ((8) * 16 + 12) == ':' || ((8) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 12) < ' ' || ((8) * 16 + 12) == '"' || ((8) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 12) >= ('a') && ((8) * 16 + 12) <= ('z')) || (((8) * 16 + 12) >= ('A') && ((8) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 13) >= ('0') && ((8) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 13) >= ('0') && ((8) * 16 + 13) <= ('9')) || ((8) * 16 + 13) == '-' || ((8) * 16 + 13) == '+' || ((8) * 16 + 13) == '.' || ((8) * 16 + 13) == 'e' || ((8) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 13) >= ('0') && ((8) * 16 + 13) <= ('9')) || (((8) * 16 + 13) >= ('a') && ((8) * 16 + 13) <= ('f')) || (((8) * 16 + 13) >= ('A') && ((8) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 13) == '{' || ((8) * 16 + 13) == '}' || ((8) * 16 + 13) == '[' || ((8) * 16 + 13) == ']' || ((8) * 16 + 13) == ':' || ((8) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 13) < ' ' || ((8) * 16 + 13) == '"' || ((8) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 13) >= ('a') && ((8) * 16 + 13) <= ('z')) || (((8) * 16 + 13) >= ('A') && ((8) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 14) >= ('0') && ((8) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 14) >= ('0') && ((8) * 16 + 14) <= ('9')) || ((8) * 16 + 14) == '-' || ((8) * 16 + 14) == '+' || ((8) * 16 + 14) == '.' || ((8) * 16 + 14) == 'e' || ((8) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 14) >= ('0') && ((8) * 16 + 14) <= ('9')) || (((8) * 16 + 14) >= ('a') && ((8) * 16 + 14) <= ('f')) || (((8) * 16 + 14) >= ('A') && ((8) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 14) == '{' || ((8) * 16 + 14) == '}' || ((8) * 16 + 14) == '[' || ((8) * 16 + 14) == ']' || ((8) * 16 + 14) == ':' || ((8) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 14) < ' ' || ((8) * 16 + 14) == '"' || ((8) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 14) >= ('a') && ((8) * 16 + 14) <= ('z')) || (((8) * 16 + 14) >= ('A') && ((8) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((8) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((8) * 16 + 15) >= ('0') && ((8) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((8) * 16 + 15) >= ('0') && ((8) * 16 + 15) <= ('9')) || ((8) * 16 + 15) == '-' || ((8) * 16 + 15) == '+' || ((8) * 16 + 15) == '.' || ((8) * 16 + 15) == 'e' || ((8) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((8) * 16 + 15) >= ('0') && ((8) * 16 + 15) <= ('9')) || (((8) * 16 + 15) >= ('a') && ((8) * 16 + 15) <= ('f')) || (((8) * 16 + 15) >= ('A') && ((8) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((8) * 16 + 15) == '{' || ((8) * 16 + 15) == '}' || ((8) * 16 + 15) == '[' || ((8) * 16 + 15) == ']' || ((8) * 16 + 15) == ':' || ((8) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((8) * 16 + 15) < ' ' || ((8) * 16 + 15) == '"' || ((8) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((8) * 16 + 15) >= ('a') && ((8) * 16 + 15) <= ('z')) || (((8) * 16 + 15) >= ('A') && ((8) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 0) >= ('0') && ((9) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 0) >= ('0') && ((9) * 16 + 0) <= ('9')) || ((9) * 16 + 0) == '-' || ((9) * 16 + 0) == '+' || ((9) * 16 + 0) == '.' || ((9) * 16 + 0) == 'e' || ((9) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 0) >= ('0') && ((9) * 16 + 0) <= ('9')) || (((9) * 16 + 0) >= ('a') && ((9) * 16 + 0) <= ('f')) || (((9) * 16 + 0) >= ('A') && ((9) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 0) == '{' || ((9) * 16 + 0) == '}' || ((9) * 16 + 0) == '[' || ((9) * 16 + 0) == ']' || ((9) * 16 + 0) == ':' || ((9) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 0) < ' ' || ((9) * 16 + 0) == '"' || ((9) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 0) >= ('a') && ((9) * 16 + 0) <= ('z')) || (((9) * 16 + 0) >= ('A') && ((9) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 1) >= ('0') && ((9) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 1) >= ('0') && ((9) * 16 + 1) <= ('9')) || ((9) * 16 + 1) == '-' || ((9) * 16 + 1) == '+' || ((9) * 16 + 1) == '.' || ((9) * 16 + 1) == 'e' || ((9) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 1) >= ('0') && ((9) * 16 + 1) <= ('9')) || (((9) * 16 + 1) >= ('a') && ((9) * 16 + 1) <= ('f')) || (((9) * 16 + 1) >= ('A') && ((9) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 1) == '{' || ((9) * 16 + 1) == '}' || ((9) * 16 + 1) == '[' || ((9) * 16 + 1) == ']' || ((9) * 16 + 1) == ':' || ((9) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 1) < ' ' || ((9) * 16 + 1) == '"' || ((9) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 1) >= ('a') && ((9) * 16 + 1) <= ('z')) || (((9) * 16 + 1) >= ('A') && ((9) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 2) >= ('0') && ((9) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 2) >= ('0') && ((9) * 16 + 2) <= ('9')) || ((9) * 16 + 2) == '-' || ((9) * 16 + 2) == '+' || ((9) * 16 + 2) == '.' || ((9) * 16 + 2) == 'e' || ((9) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 2) >= ('0') && ((9) * 16 + 2) <= ('9')) || (((9) * 16 + 2) >= ('a') && ((9) * 16 + 2) <= ('f')) || (((9) * 16 + 2) >= ('A') && ((9) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 2) == '{' || ((9) * 16 + 2) == '}' || ((9) * 16 + 2) == '[' || ((9) * 16 + 2) == ']' || ((9) * 16 + 2) == ':' || ((9) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 2) < ' ' || ((9) * 16 + 2) == '"' || ((9) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 2) >= ('a') && ((9) * 16 + 2) <= ('z')) || (((9) * 16 + 2) >= ('A') && ((9) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 3) >= ('0') && ((9) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 3) >= ('0') && ((9) * 16 + 3) <= ('9')) || ((9) * 16 + 3) == '-' || ((9) * 16 + 3) == '+' || ((9) * 16 + 3) == '.' || ((9) * 16 + 3) == 'e' || ((9) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 3) >= ('0') && ((9) * 16 + 3) <= ('9')) || (((9) * 16 + 3) >= ('a') && ((9) * 16 + 3) <= ('f')) || (((9) * 16 + 3) >= ('A') && ((9) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 3) == '{' || ((9) * 16 + 3) == '}' || ((9) * 16 + 3) == '[' || ((9) * 16 + 3) == ']' || ((9) * 16 + 3) == ':' || ((9) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 3) < ' ' || ((9) * 16 + 3) == '"' || ((9) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 3) >= ('a') && ((9) * 16 + 3) <= ('z')) || (((9) * 16 + 3) >= ('A') && ((9) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 4) >= ('0') && ((9) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 4) >= ('0') && ((9) * 16 + 4) <= ('9')) || ((9) * 16 + 4) == '-' || ((9) * 16 + 4) == '+' || ((9) * 16 + 4) == '.' || ((9) * 16 + 4) == 'e' || ((9) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 4) >= ('0') && ((9) * 16 + 4) <= ('9')) || (((9) * 16 + 4) >= ('a') && ((9) * 16 + 4) <= ('f')) || (((9) * 16 + 4) >= ('A') && ((9) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 4) == '{' || ((9) * 16 + 4) == '}' || ((9) * 16 + 4) == '[' || ((9) * 16 + 4) == ']' || ((9) * 16 + 4) == ':' || ((9) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 4) < ' ' || ((9) * 16 + 4) == '"' || ((9) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 4) >= ('a') && ((9) * 16 + 4) <= ('z')) || (((9) * 16 + 4) >= ('A') && ((9) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 5) >= ('0') && ((9) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 5) >= ('0') && ((9) * 16 + 5) <= ('9')) || ((9) * 16 + 5) == '-' || ((9) * 16 + 5) == '+' || ((9) * 16 + 5) == '.' || ((9) * 16 + 5) == 'e' || ((9) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 5) >= ('0') && ((9) * 16 + 5) <= ('9')) || (((9) * 16 + 5) >= ('a') && ((9) * 16 + 5) <= ('f')) || (((9) * 16 + 5) >= ('A') && ((9) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 5) == '{' || ((9) * 16 + 5) == '}' || ((9) * 16 + 5) == '[' || ((9) * 16 + 5) == ']' || ((9) * 16 + 5) == ':' || ((9) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 5) < ' ' || ((9) * 16 + 5) == '"' || ((9) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 5) >= ('a') && ((9) * 16 + 5) <= ('z')) || (((9) * 16 + 5) >= ('A') && ((9) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 6) >= ('0') && ((9) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 6) >= ('0') && ((9) * 16 + 6) <= ('9')) || ((9) * 16 + 6) == '-' || ((9) * 16 + 6) == '+' || ((9) * 16 + 6) == '.' || ((9) * 16 + 6) == 'e' || ((9) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 6) >= ('0') && ((9) * 16 + 6) <= ('9')) || (((9) * 16 + 6) >= ('a') && ((9) * 16 + 6) <= ('f')) || (((9) * 16 + 6) >= ('A') && ((9) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 6) == '{' || ((9) * 16 + 6) == '}' || ((9) * 16 + 6) == '[' || ((9) * 16 + 6) == ']' || ((9) * 16 + 6) == ':' || ((9) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 6) < ' ' || ((9) * 16 + 6) == '"' || ((9) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 6) >= ('a') && ((9) * 16 + 6) <= ('z')) || (((9) * 16 + 6) >= ('A') && ((9) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 7) >= ('0') && ((9) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 7) >= ('0') && ((9) * 16 + 7) <= ('9')) || ((9) * 16 + 7) == '-' || ((9) * 16 + 7) == '+' || ((9) * 16 + 7) == '.' || ((9) * 16 + 7) == 'e' || ((9) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 7) >= ('0') && ((9) * 16 + 7) <= ('9')) || (((9) * 16 + 7) >= ('a') && ((9) * 16 + 7) <= ('f')) || (((9) * 16 + 7) >= ('A') && ((9) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 7) == '{' || ((9) * 16 + 7) == '}' || ((9) * 16 + 7) == '[' || ((9) * 16 + 7) == ']' || ((9) * 16 + 7) == ':' || ((9) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 7) < ' ' || ((9) * 16 + 7) == '"' || ((9) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 7) >= ('a') && ((9) * 16 + 7) <= ('z')) || (((9) * 16 + 7) >= ('A') && ((9) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 8) >= ('0') && ((9) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 8) >= ('0') && ((9) * 16 + 8) <= ('9')) || ((9) * 16 + 8) == '-' || ((9) * 16 + 8) == '+' || ((9) * 16 + 8) == '.' || ((9) * 16 + 8) == 'e' || ((9) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 8) >= ('0') && ((9) * 16 + 8) <= ('9')) || (((9) * 16 + 8) >= ('a') && ((9) * 16 + 8) <= ('f')) || (((9) * 16 + 8) >= ('A') && ((9) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 8) == '{' || ((9) * 16 + 8) == '}' || ((9) * 16 + 8) == '[' || ((9) * 16 + 8) == ']' || ((9) * 16 + 8) == ':' || ((9) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 8) < ' ' || ((9) * 16 + 8) == '"' || ((9) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 8) >= ('a') && ((9) * 16 + 8) <= ('z')) || (((9) * 16 + 8) >= ('A') && ((9) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 9) >= ('0') && ((9) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 9) >= ('0') && ((9) * 16 + 9) <= ('9')) || ((9) * 16 + 9) == '-' || ((9) * 16 + 9) == '+' || ((9) * 16 + 9) == '.' || ((9) * 16 + 9) == 'e' || ((9) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 9) >= ('0') && ((9) * 16 + 9) <= ('9')) || (((9) * 16 + 9) >= ('a') && ((9) * 16 + 9) <= ('f')) || (((9) * 16 + 9) >= ('A') && ((9) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 9) == '{' || ((9) * 16 + 9) == '}' || ((9) * 16 + 9) == '[' || ((9) * 16 + 9) == ']' || ((9) * 16 + 9) == ':' || ((9) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 9) < ' ' || ((9) * 16 + 9) == '"' || ((9) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 9) >= ('a') && ((9) * 16 + 9) <= ('z')) || (((9) * 16 + 9) >= ('A') && ((9) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 10) >= ('0') && ((9) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 10) >= ('0') && ((9) * 16 + 10) <= ('9')) || ((9) * 16 + 10) == '-' || ((9) * 16 + 10) == '+' || ((9) * 16 + 10) == '.' || ((9) * 16 + 10) == 'e' || ((9) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 10) >= ('0') && ((9) * 16 + 10) <= ('9')) || (((9) * 16 + 10) >= ('a') && ((9) * 16 + 10) <= ('f')) || (((9) * 16 + 10) >= ('A') && ((9) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 10) == '{' || ((9) * 16 + 10) == '}' || ((9) * 16 + 10) == '[' || ((9) * 16 + 10) == ']' || ((9) * 16 + 10) == ':' || ((9) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 10) < ' ' || ((9) * 16 + 10) == '"' || ((9) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 10) >= ('a') && ((9) * 16 + 10) <= ('z')) || (((9) * 16 + 10) >= ('A') && ((9) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 11) >= ('0') && ((9) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 11) >= ('0') && ((9) * 16 + 11) <= ('9')) || ((9) * 16 + 11) == '-' || ((9) * 16 + 11) == '+' || ((9) * 16 + 11) == '.' || ((9) * 16 + 11) == 'e' || ((9) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 11) >= ('0') && ((9) * 16 + 11) <= ('9')) || (((9) * 16 + 11) >= ('a') && ((9) * 16 + 11) <= ('f')) || (((9) * 16 + 11) >= ('A') && ((9) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 11) == '{' || ((9) * 16 + 11) == '}' || ((9) * 16 + 11) == '[' || ((9) * 16 + 11) == ']' || ((9) * 16 + 11) == ':' || ((9) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 11) < ' ' || ((9) * 16 + 11) == '"' || ((9) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 11) >= ('a') && ((9) * 16 + 11) <= ('z')) || (((9) * 16 + 11) >= ('A') && ((9) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 12) >= ('0') && ((9) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 12) >= ('0') && ((9) * 16 + 12) <= ('9')) || ((9) * 16 + 12) == '-' || ((9) * 16 + 12) == '+' || ((9) * 16 + 12) == '.' || ((9) * 16 + 12) == 'e' || ((9) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 12) >= ('0') && ((9) * 16 + 12) <= ('9')) || (((9) * 16 + 12) >= ('a') && ((9) * 16 + 12) <= ('f')) || (((9) * 16 + 12) >= ('A') && ((9) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 12) == '{' || ((9) * 16 + 12) == '}' || ((9) * 16 + 12) == '[' || ((9) * 16 + 12) == ']' || ((9) * 16 + 12) == ':' || ((9) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 12) < ' ' || ((9) * 16 + 12) == '"' || ((9) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 12) >= ('a') && ((9) * 16 + 12) <= ('z')) || (((9) * 16 + 12) >= ('A') && ((9) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 13) >= ('0') && ((9) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 13) >= ('0') && ((9) * 16 + 13) <= ('9')) || ((9) * 16 + 13) == '-' || ((9) * 16 + 13) == '+' || ((9) * 16 + 13) == '.' || ((9) * 16 + 13) == 'e' || ((9) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 13) >= ('0') && ((9) * 16 + 13) <= ('9')) || (((9) * 16 + 13) >= ('a') && ((9) * 16 + 13) <= ('f')) || (((9) * 16 + 13) >= ('A') && ((9) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 13) == '{' || ((9) * 16 + 13) == '}' || ((9) * 16 + 13) == '[' || ((9) * 16 + 13) == ']' || ((9) * 16 + 13) == ':' || ((9) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 13) < ' ' || ((9) * 16 + 13) == '"' || ((9) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 13) >= ('a') && ((9) * 16 + 13) <= ('z')) || (((9) * 16 + 13) >= ('A') && ((9) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 14) >= ('0') && ((9) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 14) >= ('0') && ((9) * 16 + 14) <= ('9')) || ((9) * 16 + 14) == '-' || ((9) * 16 + 14) == '+' || ((9) * 16 + 14) == '.' || ((9) * 16 + 14) == 'e' || ((9) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 14) >= ('0') && ((9) * 16 + 14) <= ('9')) || (((9) * 16 + 14) >= ('a') && ((9) * 16 + 14) <= ('f')) || (((9) * 16 + 14) >= ('A') && ((9) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 14) == '{' || ((9) * 16 + 14) == '}' || ((9) * 16 + 14) == '[' || ((9) * 16 + 14) == ']' || ((9) * 16 + 14) == ':' || ((9) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 14) < ' ' || ((9) * 16 + 14) == '"' || ((9) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 14) >= ('a') && ((9) * 16 + 14) <= ('z')) || (((9) * 16 + 14) >= ('A') && ((9) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((9) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((9) * 16 + 15) >= ('0') && ((9) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((9) * 16 + 15) >= ('0') && ((9) * 16 + 15) <= ('9')) || ((9) * 16 + 15) == '-' || ((9) * 16 + 15) == '+' || ((9) * 16 + 15) == '.' || ((9) * 16 + 15) == 'e' || ((9) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((9) * 16 + 15) >= ('0') && ((9) * 16 + 15) <= ('9')) || (((9) * 16 + 15) >= ('a') && ((9) * 16 + 15) <= ('f')) || (((9) * 16 + 15) >= ('A') && ((9) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((9) * 16 + 15) == '{' || ((9) * 16 + 15) == '}' || ((9) * 16 + 15) == '[' || ((9) * 16 + 15) == ']' || ((9) * 16 + 15) == ':' || ((9) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((9) * 16 + 15) < ' ' || ((9) * 16 + 15) == '"' || ((9) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((9) * 16 + 15) >= ('a') && ((9) * 16 + 15) <= ('z')) || (((9) * 16 + 15) >= ('A') && ((9) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 0) >= ('0') && ((10) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 0) >= ('0') && ((10) * 16 + 0) <= ('9')) || ((10) * 16 + 0) == '-' || ((10) * 16 + 0) == '+' || ((10) * 16 + 0) == '.' || ((10) * 16 + 0) == 'e' || ((10) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 0) >= ('0') && ((10) * 16 + 0) <= ('9')) || (((10) * 16 + 0) >= ('a') && ((10) * 16 + 0) <= ('f')) || (((10) * 16 + 0) >= ('A') && ((10) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 0) == '{' || ((10) * 16 + 0) == '}' || ((10) * 16 + 0) == '[' || ((10) * 16 + 0) == ']' || ((10) * 16 + 0) == ':' || ((10) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 0) < ' ' || ((10) * 16 + 0) == '"' || ((10) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 0) >= ('a') && ((10) * 16 + 0) <= ('z')) || (((10) * 16 + 0) >= ('A') && ((10) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 1) >= ('0') && ((10) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 1) >= ('0') && ((10) * 16 + 1) <= ('9')) || ((10) * 16 + 1) == '-' || ((10) * 16 + 1) == '+' || ((10) * 16 + 1) == '.' || ((10) * 16 + 1) == 'e' || ((10) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 1) >= ('0') && ((10) * 16 + 1) <= ('9')) || (((10) * 16 + 1) >= ('a') && ((10) * 16 + 1) <= ('f')) || (((10) * 16 + 1) >= ('A') && ((10) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 1) == '{' || ((10) * 16 + 1) == '}' || ((10) * 16 + 1) == '[' || ((10) * 16 + 1) == ']' || ((10) * 16 + 1) == ':' || ((10) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 1) < ' ' || ((10) * 16 + 1) == '"' || ((10) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 1) >= ('a') && ((10) * 16 + 1) <= ('z')) || (((10) * 16 + 1) >= ('A') && ((10) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 2) >= ('0') && ((10) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 2) >= ('0') && ((10) * 16 + 2) <= ('9')) || ((10) * 16 + 2) == '-' || ((10) * 16 + 2) == '+' || ((10) * 16 + 2) == '.' || ((10) * 16 + 2) == 'e' || ((10) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 2) >= ('0') && ((10) * 16 + 2) <= ('9')) || (((10) * 16 + 2) >= ('a') && ((10) * 16 + 2) <= ('f')) || (((10) * 16 + 2) >= ('A') && ((10) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 2) == '{' || ((10) * 16 + 2) == '}' || ((10) * 16 + 2) == '[' || ((10) * 16 + 2) == ']' || ((10) * 16 + 2) == ':' || ((10) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 2) < ' ' || ((10) * 16 + 2) == '"' || ((10) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 2) >= ('a') && ((10) * 16 + 2) <= ('z')) || (((10) * 16 + 2) >= ('A') && ((10) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 3) >= ('0') && ((10) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 3) >= ('0') && ((10) * 16 + 3) <= ('9')) || ((10) * 16 + 3) == '-' || ((10) * 16 + 3) == '+' || ((10) * 16 + 3) == '.' || ((10) * 16 + 3) == 'e' || ((10) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 3) >= ('0') && ((10) * 16 + 3) <= ('9')) || (((10) * 16 + 3) >= ('a') && ((10) * 16 + 3) <= ('f')) || (((10) * 16 + 3) >= ('A') && ((10) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 3) == '{' || ((10) * 16 + 3) == '}' || ((10) * 16 + 3) == '[' || ((10) * 16 + 3) == ']' || ((10) * 16 + 3) == ':' || ((10) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 3) < ' ' || ((10) * 16 + 3) == '"' || ((10) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 3) >= ('a') && ((10) * 16 + 3) <= ('z')) || (((10) * 16 + 3) >= ('A') && ((10) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 4) >= ('0') && ((10) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 4) >= ('0') && ((10) * 16 + 4) <= ('9')) || ((10) * 16 + 4) == '-' || ((10) * 16 + 4) == '+' || ((10) * 16 + 4) == '.' || ((10) * 16 + 4) == 'e' || ((10) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 4) >= ('0') && ((10) * 16 + 4) <= ('9')) || (((10) * 16 + 4) >= ('a') && ((10) * 16 + 4) <= ('f')) || (((10) * 16 + 4) >= ('A') && ((10) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 4) == '{' || ((10) * 16 + 4) == '}' || ((10) * 16 + 4) == '[' || ((10) * 16 + 4) == ']' || ((10) * 16 + 4) == ':' || ((10) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 4) < ' ' || ((10) * 16 + 4) == '"' || ((10) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 4) >= ('a') && ((10) * 16 + 4) <= ('z')) || (((10) * 16 + 4) >= ('A') && ((10) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 5) >= ('0') && ((10) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 5) >= ('0') && ((10) * 16 + 5) <= ('9')) || ((10) * 16 + 5) == '-' || ((10) * 16 + 5) == '+' || ((10) * 16 + 5) == '.' || ((10) * 16 + 5) == 'e' || ((10) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 5) >= ('0') && ((10) * 16 + 5) <= ('9')) || (((10) * 16 + 5) >= ('a') && ((10) * 16 + 5) <= ('f')) || (((10) * 16 + 5) >= ('A') && ((10) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 5) == '{' || ((10) * 16 + 5) == '}' || ((10) * 16 + 5) == '[' || ((10) * 16 + 5) == ']' || ((10) * 16 + 5) == ':' || ((10) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 5) < ' ' || ((10) * 16 + 5) == '"' || ((10) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 5) >= ('a') && ((10) * 16 + 5) <= ('z')) || (((10) * 16 + 5) >= ('A') && ((10) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 6) >= ('0') && ((10) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 6) >= ('0') && ((10) * 16 + 6) <= ('9')) || ((10) * 16 + 6) == '-' || ((10) * 16 + 6) == '+' || ((10) * 16 + 6) == '.' || ((10) * 16 + 6) == 'e' || ((10) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 6) >= ('0') && ((10) * 16 + 6) <= ('9')) || (((10) * 16 + 6) >= ('a') && ((10) * 16 + 6) <= ('f')) || (((10) * 16 + 6) >= ('A') && ((10) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 6) == '{' || ((10) * 16 + 6) == '}' || ((10) * 16 + 6) == '[' || ((10) * 16 + 6) == ']' || ((10) * 16 + 6) == ':' || ((10) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 6) < ' ' || ((10) * 16 + 6) == '"' || ((10) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 6) >= ('a') && ((10) * 16 + 6) <= ('z')) || (((10) * 16 + 6) >= ('A') && ((10) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 7) >= ('0') && ((10) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 7) >= ('0') && ((10) * 16 + 7) <= ('9')) || ((10) * 16 + 7) == '-' || ((10) * 16 + 7) == '+' || ((10) * 16 + 7) == '.' || ((10) * 16 + 7) == 'e' || ((10) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 7) >= ('0') && ((10) * 16 + 7) <= ('9')) || (((10) * 16 + 7) >= ('a') && ((10) * 16 + 7) <= ('f')) || (((10) * 16 + 7) >= ('A') && ((10) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 7) == '{' || ((10) * 16 + 7) == '}' || ((10) * 16 + 7) == '[' || ((10) * 16 + 7) == ']' || ((10) * 16 + 7) == ':' || ((10) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 7) < ' ' || ((10) * 16 + 7) == '"' || ((10) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 7) >= ('a') && ((10) * 16 + 7) <= ('z')) || (((10) * 16 + 7) >= ('A') && ((10) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 8) >= ('0') && ((10) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 8) >= ('0') && ((10) * 16 + 8) <= ('9')) || ((10) * 16 + 8) == '-' || ((10) * 16 + 8) == '+' || ((10) * 16 + 8) == '.' || ((10) * 16 + 8) == 'e' || ((10) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 8) >= ('0') && ((10) * 16 + 8) <= ('9')) || (((10) * 16 + 8) >= ('a') && ((10) * 16 + 8) <= ('f')) || (((10) * 16 + 8) >= ('A') && ((10) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 8) == '{' || ((10) * 16 + 8) == '}' || ((10) * 16 + 8) == '[' || ((10) * 16 + 8) == ']' || ((10) * 16 + 8) == ':' || ((10) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 8) < ' ' || ((10) * 16 + 8) == '"' || ((10) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 8) >= ('a') && ((10) * 16 + 8) <= ('z')) || (((10) * 16 + 8) >= ('A') && ((10) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 9) >= ('0') && ((10) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 9) >= ('0') && ((10) * 16 + 9) <= ('9')) || ((10) * 16 + 9) == '-' || ((10) * 16 + 9) == '+' || ((10) * 16 + 9) == '.' || ((10) * 16 + 9) == 'e' || ((10) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 9) >= ('0') && ((10) * 16 + 9) <= ('9')) || (((10) * 16 + 9) >= ('a') && ((10) * 16 + 9) <= ('f')) || (((10) * 16 + 9) >= ('A') && ((10) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 9) == '{' || ((10) * 16 + 9) == '}' || ((10) * 16 + 9) == '[' || ((10) * 16 + 9) == ']' || ((10) * 16 + 9) == ':' || ((10) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 9) < ' ' || ((10) * 16 + 9) == '"' || ((10) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 9) >= ('a') && ((10) * 16 + 9) <= ('z')) || (((10) * 16 + 9) >= ('A') && ((10) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 10) >= ('0') && ((10) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 10) >= ('0') && ((10) * 16 + 10) <= ('9')) || ((10) * 16 + 10) == '-' || ((10) * 16 + 10) == '+' || ((10) * 16 + 10) == '.' || ((10) * 16 + 10) == 'e' || ((10) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 10) >= ('0') && ((10) * 16 + 10) <= ('9')) || (((10) * 16 + 10) >= ('a') && ((10) * 16 + 10) <= ('f')) || (((10) * 16 + 10) >= ('A') && ((10) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 10) == '{' || ((10) * 16 + 10) == '}' || ((10) * 16 + 10) == '[' || ((10) * 16 + 10) == ']' || ((10) * 16 + 10) == ':' || ((10) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 10) < ' ' || ((10) * 16 + 10) == '"' || ((10) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 10) >= ('a') && ((10) * 16 + 10) <= ('z')) || (((10) * 16 + 10) >= ('A') && ((10) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 11) >= ('0') && ((10) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 11) >= ('0') && ((10) * 16 + 11) <= ('9')) || ((10) * 16 + 11) == '-' || ((10) * 16 + 11) == '+' || ((10) * 16 + 11) == '.' || ((10) * 16 + 11) == 'e' || ((10) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 11) >= ('0') && ((10) * 16 + 11) <= ('9')) || (((10) * 16 + 11) >= ('a') && ((10) * 16 + 11) <= ('f')) || (((10) * 16 + 11) >= ('A') && ((10) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 11) == '{' || ((10) * 16 + 11) == '}' || ((10) * 16 + 11) == '[' || ((10) * 16 + 11) == ']' || ((10) * 16 + 11) == ':' || ((10) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 11) < ' ' || ((10) * 16 + 11) == '"' || ((10) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 11) >= ('a') && ((10) * 16 + 11) <= ('z')) || (((10) * 16 + 11) >= ('A') && ((10) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 12) >= ('0') && ((10) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 12) >= ('0') && ((10) * 16 + 12) <= ('9')) || ((10) * 16 + 12) == '-' || ((10) * 16 + 12) == '+' || ((10) * 16 + 12) == '.' || ((10) * 16 + 12) == 'e' || ((10) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 12) >= ('0') && ((10) * 16 + 12) <= ('9')) || (((10) * 16 + 12) >= ('a') && ((10) * 16 + 12) <= ('f')) || (((10) * 16 + 12) >= ('A') && ((10) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 12) == '{' || ((10) * 16 + 12) == '}' || ((10) * 16 + 12) == '[' || ((10) * 16 + 12) == ']' || ((10) * 16 + 12) == ':' || ((10) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 12) < ' ' || ((10) * 16 + 12) == '"' || ((10) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 12) >= ('a') && ((10) * 16 + 12) <= ('z')) || (((10) * 16 + 12) >= ('A') && ((10) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 13) >= ('0') && ((10) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 13) >= ('0') && ((10) * 16 + 13) <= ('9')) || ((10) * 16 + 13) == '-' || ((10) * 16 + 13) == '+' || ((10) * 16 + 13) == '.' || ((10) * 16 + 13) == 'e' || ((10) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 13) >= ('0') && ((10) * 16 + 13) <= ('9')) || (((10) * 16 + 13) >= ('a') && ((10) * 16 + 13) <= ('f')) || (((10) * 16 + 13) >= ('A') && ((10) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 13) == '{' || ((10) * 16 + 13) == '}' || ((10) * 16 + 13) == '[' || ((10) * 16 + 13) == ']' || ((10) * 16 + 13) == ':' || ((10) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 13) < ' ' || ((10) * 16 + 13) == '"' || ((10) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 13) >= ('a') && ((10) * 16 + 13) <= ('z')) || (((10) * 16 + 13) >= ('A') && ((10) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 14) >= ('0') && ((10) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 14) >= ('0') && ((10) * 16 + 14) <= ('9')) || ((10) * 16 + 14) == '-' || ((10) * 16 + 14) == '+' || ((10) * 16 + 14) == '.' || ((10) * 16 + 14) == 'e' || ((10) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 14) >= ('0') && ((10) * 16 + 14) <= ('9')) || (((10) * 16 + 14) >= ('a') && ((10) * 16 + 14) <= ('f')) || (((10) * 16 + 14) >= ('A') && ((10) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 14) == '{' || ((10) * 16 + 14) == '}' || ((10) * 16 + 14) == '[' || ((10) * 16 + 14) == ']' || ((10) * 16 + 14) == ':' || ((10) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 14) < ' ' || ((10) * 16 + 14) == '"' || ((10) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 14) >= ('a') && ((10) * 16 + 14) <= ('z')) || (((10) * 16 + 14) >= ('A') && ((10) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((10) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((10) * 16 + 15) >= ('0') && ((10) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((10) * 16 + 15) >= ('0') && ((10) * 16 + 15) <= ('9')) || ((10) * 16 + 15) == '-' || ((10) * 16 + 15) == '+' || ((10) * 16 + 15) == '.' || ((10) * 16 + 15) == 'e' || ((10) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((10) * 16 + 15) >= ('0') && ((10) * 16 + 15) <= ('9')) || (((10) * 16 + 15) >= ('a') && ((10) * 16 + 15) <= ('f')) || (((10) * 16 + 15) >= ('A') && ((10) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((10) * 16 + 15) == '{' || ((10) * 16 + 15) == '}' || ((10) * 16 + 15) == '[' || ((10) * 16 + 15) == ']' || ((10) * 16 + 15) == ':' || ((10) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((10) * 16 + 15) < ' ' || ((10) * 16 + 15) == '"' || ((10) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((10) * 16 + 15) >= ('a') && ((10) * 16 + 15) <= ('z')) || (((10) * 16 + 15) >= ('A') && ((10) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 0) >= ('0') && ((11) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 0) >= ('0') && ((11) * 16 + 0) <= ('9')) || ((11) * 16 + 0) == '-' || ((11) * 16 + 0) == '+' || ((11) * 16 + 0) == '.' || ((11) * 16 + 0) == 'e' || ((11) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 0) >= ('0') && ((11) * 16 + 0) <= ('9')) || (((11) * 16 + 0) >= ('a') && ((11) * 16 + 0) <= ('f')) || (((11) * 16 + 0) >= ('A') && ((11) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 0) == '{' || ((11) * 16 + 0) == '}' || ((11) * 16 + 0) == '[' || ((11) * 16 + 0) == ']' || ((11) * 16 + 0) == ':' || ((11) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 0) < ' ' || ((11) * 16 + 0) == '"' || ((11) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 0) >= ('a') && ((11) * 16 + 0) <= ('z')) || (((11) * 16 + 0) >= ('A') && ((11) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 1) >= ('0') && ((11) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 1) >= ('0') && ((11) * 16 + 1) <= ('9')) || ((11) * 16 + 1) == '-' || ((11) * 16 + 1) == '+' || ((11) * 16 + 1) == '.' || ((11) * 16 + 1) == 'e' || ((11) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 1) >= ('0') && ((11) * 16 + 1) <= ('9')) || (((11) * 16 + 1) >= ('a') && ((11) * 16 + 1) <= ('f')) || (((11) * 16 + 1) >= ('A') && ((11) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 1) == '{' || ((11) * 16 + 1) == '}' || ((11) * 16 + 1) == '[' || ((11) * 16 + 1) == ']' || ((11) * 16 + 1) == ':' || ((11) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 1) < ' ' || ((11) * 16 + 1) == '"' || ((11) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 1) >= ('a') && ((11) * 16 + 1) <= ('z')) || (((11) * 16 + 1) >= ('A') && ((11) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 2) >= ('0') && ((11) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 2) >= ('0') && ((11) * 16 + 2) <= ('9')) || ((11) * 16 + 2) == '-' || ((11) * 16 + 2) == '+' || ((11) * 16 + 2) == '.' || ((11) * 16 + 2) == 'e' || ((11) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 2) >= ('0') && ((11) * 16 + 2) <= ('9')) || (((11) * 16 + 2) >= ('a') && ((11) * 16 + 2) <= ('f')) || (((11) * 16 + 2) >= ('A') && ((11) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 2) == '{' || ((11) * 16 + 2) == '}' || ((11) * 16 + 2) == '[' || ((11) * 16 + 2) == ']' || ((11) * 16 + 2) == ':' || ((11) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 2) < ' ' || ((11) * 16 + 2) == '"' || ((11) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 2) >= ('a') && ((11) * 16 + 2) <= ('z')) || (((11) * 16 + 2) >= ('A') && ((11) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 3) >= ('0') && ((11) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 3) >= ('0') && ((11) * 16 + 3) <= ('9')) || ((11) * 16 + 3) == '-' || ((11) * 16 + 3) == '+' || ((11) * 16 + 3) == '.' || ((11) * 16 + 3) == 'e' || ((11) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 3) >= ('0') && ((11) * 16 + 3) <= ('9')) || (((11) * 16 + 3) >= ('a') && ((11) * 16 + 3) <= ('f')) || (((11) * 16 + 3) >= ('A') && ((11) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 3) == '{' || ((11) * 16 + 3) == '}' || ((11) * 16 + 3) == '[' || ((11) * 16 + 3) == ']' || ((11) * 16 + 3) == ':' || ((11) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 3) < ' ' || ((11) * 16 + 3) == '"' || ((11) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 3) >= ('a') && ((11) * 16 + 3) <= ('z')) || (((11) * 16 + 3) >= ('A') && ((11) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 4) >= ('0') && ((11) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 4) >= ('0') && ((11) * 16 + 4) <= ('9')) || ((11) * 16 + 4) == '-' || ((11) * 16 + 4) == '+' || ((11) * 16 + 4) == '.' || ((11) * 16 + 4) == 'e' || ((11) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 4) >= ('0') && ((11) * 16 + 4) <= ('9')) || (((11) * 16 + 4) >= ('a') && ((11) * 16 + 4) <= ('f')) || (((11) * 16 + 4) >= ('A') && ((11) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 4) == '{' || ((11) * 16 + 4) == '}' || ((11) * 16 + 4) == '[' || ((11) * 16 + 4) == ']' || ((11) * 16 + 4) == ':' || ((11) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 4) < ' ' || ((11) * 16 + 4) == '"' || ((11) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 4) >= ('a') && ((11) * 16 + 4) <= ('z')) || (((11) * 16 + 4) >= ('A') && ((11) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 5) >= ('0') && ((11) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 5) >= ('0') && ((11) * 16 + 5) <= ('9')) || ((11) * 16 + 5) == '-' || ((11) * 16 + 5) == '+' || ((11) * 16 + 5) == '.' || ((11) * 16 + 5) == 'e' || ((11) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 5) >= ('0') && ((11) * 16 + 5) <= ('9')) || (((11) * 16 + 5) >= ('a') && ((11) * 16 + 5) <= ('f')) || (((11) * 16 + 5) >= ('A') && ((11) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 5) == '{' || ((11) * 16 + 5) == '}' || ((11) * 16 + 5) == '[' || ((11) * 16 + 5) == ']' || ((11) * 16 + 5) == ':' || ((11) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 5) < ' ' || ((11) * 16 + 5) == '"' || ((11) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 5) >= ('a') && ((11) * 16 + 5) <= ('z')) || (((11) * 16 + 5) >= ('A') && ((11) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 6) >= ('0') && ((11) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 6) >= ('0') && ((11) * 16 + 6) <= ('9')) || ((11) * 16 + 6) == '-' || ((11) * 16 + 6) == '+' || ((11) * 16 + 6) == '.' || ((11) * 16 + 6) == 'e' || ((11) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 6) >= ('0') && ((11) * 16 + 6) <= ('9')) || (((11) * 16 + 6) >= ('a') && ((11) * 16 + 6) <= ('f')) || (((11) * 16 + 6) >= ('A') && ((11) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 6) == '{' || ((11) * 16 + 6) == '}' || ((11) * 16 + 6) == '[' || ((11) * 16 + 6) == ']' || ((11) * 16 + 6) == ':' || ((11) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 6) < ' ' || ((11) * 16 + 6) == '"' || ((11) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 6) >= ('a') && ((11) * 16 + 6) <= ('z')) || (((11) * 16 + 6) >= ('A') && ((11) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 7) >= ('0') && ((11) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 7) >= ('0') && ((11) * 16 + 7) <= ('9')) || ((11) * 16 + 7) == '-' || ((11) * 16 + 7) == '+' || ((11) * 16 + 7) == '.' || ((11) * 16 + 7) == 'e' || ((11) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 7) >= ('0') && ((11) * 16 + 7) <= ('9')) || (((11) * 16 + 7) >= ('a') && ((11) * 16 + 7) <= ('f')) || (((11) * 16 + 7) >= ('A') && ((11) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 7) == '{' || ((11) * 16 + 7) == '}' || ((11) * 16 + 7) == '[' || ((11) * 16 + 7) == ']' || ((11) * 16 + 7) == ':' || ((11) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 7) < ' ' || ((11) * 16 + 7) == '"' || ((11) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 7) >= ('a') && ((11) * 16 + 7) <= ('z')) || (((11) * 16 + 7) >= ('A') && ((11) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 8) >= ('0') && ((11) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 8) >= ('0') && ((11) * 16 + 8) <= ('9')) || ((11) * 16 + 8) == '-' || ((11) * 16 + 8) == '+' || ((11) * 16 + 8) == '.' || ((11) * 16 + 8) == 'e' || ((11) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 8) >= ('0') && ((11) * 16 + 8) <= ('9')) || (((11) * 16 + 8) >= ('a') && ((11) * 16 + 8) <= ('f')) || (((11) * 16 + 8) >= ('A') && ((11) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 8) == '{' || ((11) * 16 + 8) == '}' || ((11) * 16 + 8) == '[' || ((11) * 16 + 8) == ']' || ((11) * 16 + 8) == ':' || ((11) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 8) < ' ' || ((11) * 16 + 8) == '"' || ((11) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 8) >= ('a') && ((11) * 16 + 8) <= ('z')) || (((11) * 16 + 8) >= ('A') && ((11) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 9) >= ('0') && ((11) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 9) >= ('0') && ((11) * 16 + 9) <= ('9')) || ((11) * 16 + 9) == '-' || ((11) * 16 + 9) == '+' || ((11) * 16 + 9) == '.' || ((11) * 16 + 9) == 'e' || ((11) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 9) >= ('0') && ((11) * 16 + 9) <= ('9')) || (((11) * 16 + 9) >= ('a') && ((11) * 16 + 9) <= ('f')) || (((11) * 16 + 9) >= ('A') && ((11) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 9) == '{' || ((11) * 16 + 9) == '}' || ((11) * 16 + 9) == '[' || ((11) * 16 + 9) == ']' || ((11) * 16 + 9) == ':' || ((11) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 9) < ' ' || ((11) * 16 + 9) == '"' || ((11) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 9) >= ('a') && ((11) * 16 + 9) <= ('z')) || (((11) * 16 + 9) >= ('A') && ((11) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 10) >= ('0') && ((11) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 10) >= ('0') && ((11) * 16 + 10) <= ('9')) || ((11) * 16 + 10) == '-' || ((11) * 16 + 10) == '+' || ((11) * 16 + 10) == '.' || ((11) * 16 + 10) == 'e' || ((11) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 10) >= ('0') && ((11) * 16 + 10) <= ('9')) || (((11) * 16 + 10) >= ('a') && ((11) * 16 + 10) <= ('f')) || (((11) * 16 + 10) >= ('A') && ((11) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 10) == '{' || ((11) * 16 + 10) == '}' || ((11) * 16 + 10) == '[' || ((11) * 16 + 10) == ']' || ((11) * 16 + 10) == ':' || ((11) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 10) < ' ' || ((11) * 16 + 10) == '"' || ((11) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 10) >= ('a') && ((11) * 16 + 10) <= ('z')) || (((11) * 16 + 10) >= ('A') && ((11) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 11) >= ('0') && ((11) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 11) >= ('0') && ((11) * 16 + 11) <= ('9')) || ((11) * 16 + 11) == '-' || ((11) * 16 + 11) == '+' || ((11) * 16 + 11) == '.' || ((11) * 16 + 11) == 'e' || ((11) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 11) >= ('0') && ((11) * 16 + 11) <= ('9')) || (((11) * 16 + 11) >= ('a') && ((11) * 16 + 11) <= ('f')) || (((11) * 16 + 11) >= ('A') && ((11) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 11) == '{' || ((11) * 16 + 11) == '}' || ((11) * 16 + 11) == '[' || ((11) * 16 + 11) == ']' || ((11) * 16 + 11) == ':' || ((11) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 11) < ' ' || ((11) * 16 + 11) == '"' || ((11) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 11) >= ('a') && ((11) * 16 + 11) <= ('z')) || (((11) * 16 + 11) >= ('A') && ((11) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 12) >= ('0') && ((11) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 12) >= ('0') && ((11) * 16 + 12) <= ('9')) || ((11) * 16 + 12) == '-' || ((11) * 16 + 12) == '+' || ((11) * 16 + 12) == '.' || ((11) * 16 + 12) == 'e' || ((11) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 12) >= ('0') && ((11) * 16 + 12) <= ('9')) || (((11) * 16 + 12) >= ('a') && ((11) * 16 + 12) <= ('f')) || (((11) * 16 + 12) >= ('A') && ((11) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 12) == '{' || ((11) * 16 + 12) == '}' || ((11) * 16 + 12) == '[' || ((11) * 16 + 12) == ']' || ((11) * 16 + 12) == ':' || ((11) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 12) < ' ' || ((11) * 16 + 12) == '"' || ((11) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 12) >= ('a') && ((11) * 16 + 12) <= ('z')) || (((11) * 16 + 12) >= ('A') && ((11) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 13) >= ('0') && ((11) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 13) >= ('0') && ((11) * 16 + 13) <= ('9')) || ((11) * 16 + 13) == '-' || ((11) * 16 + 13) == '+' || ((11) * 16 + 13) == '.' || ((11) * 16 + 13) == 'e' || ((11) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 13) >= ('0') && ((11) * 16 + 13) <= ('9')) || (((11) * 16 + 13) >= ('a') && ((11) * 16 + 13) <= ('f')) || (((11) * 16 + 13) >= ('A') && ((11) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 13) == '{' || ((11) * 16 + 13) == '}' || ((11) * 16 + 13) == '[' || ((11) * 16 + 13) == ']' || ((11) * 16 + 13) == ':' || ((11) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 13) < ' ' || ((11) * 16 + 13) == '"' || ((11) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 13) >= ('a') && ((11) * 16 + 13) <= ('z')) || (((11) * 16 + 13) >= ('A') && ((11) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 14) >= ('0') && ((11) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 14) >= ('0') && ((11) * 16 + 14) <= ('9')) || ((11) * 16 + 14) == '-' || ((11) * 16 + 14) == '+' || ((11) * 16 + 14) == '.' || ((11) * 16 + 14) == 'e' || ((11) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 14) >= ('0') && ((11) * 16 + 14) <= ('9')) || (((11) * 16 + 14) >= ('a') && ((11) * 16 + 14) <= ('f')) || (((11) * 16 + 14) >= ('A') && ((11) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 14) == '{' || ((11) * 16 + 14) == '}' || ((11) * 16 + 14) == '[' || ((11) * 16 + 14) == ']' || ((11) * 16 + 14) == ':' || ((11) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 14) < ' ' || ((11) * 16 + 14) == '"' || ((11) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 14) >= ('a') && ((11) * 16 + 14) <= ('z')) || (((11) * 16 + 14) >= ('A') && ((11) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((11) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((11) * 16 + 15) >= ('0') && ((11) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((11) * 16 + 15) >= ('0') && ((11) * 16 + 15) <= ('9')) || ((11) * 16 + 15) == '-' || ((11) * 16 + 15) == '+' || ((11) * 16 + 15) == '.' || ((11) * 16 + 15) == 'e' || ((11) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((11) * 16 + 15) >= ('0') && ((11) * 16 + 15) <= ('9')) || (((11) * 16 + 15) >= ('a') && ((11) * 16 + 15) <= ('f')) || (((11) * 16 + 15) >= ('A') && ((11) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((11) * 16 + 15) == '{' || ((11) * 16 + 15) == '}' || ((11) * 16 + 15) == '[' || ((11) * 16 + 15) == ']' || ((11) * 16 + 15) == ':' || ((11) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((11) * 16 + 15) < ' ' || ((11) * 16 + 15) == '"' || ((11) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((11) * 16 + 15) >= ('a') && ((11) * 16 + 15) <= ('z')) || (((11) * 16 + 15) >= ('A') && ((11) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)),
+  ( (((12) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 0) >= ('0') && ((12) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 0) >= ('0') && ((12) * 16 + 0) <= ('9')) || ((12) * 16 + 0) == '-' || ((12) * 16 + 0) == '+' || ((12) * 16 + 0) == '.' || ((12) * 16 + 0) == 'e' || ((12) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 0) >= ('0') && ((12) * 16 + 0) <= ('9')) || (((12) * 16 + 0) >= ('a') && ((12) * 16 + 0) <= ('f')) || (((12) * 16 + 0) >= ('A') && ((12) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 0) == '{' || ((12) * 16 + 0) == '}' || ((12) * 16 + 0) == '[' || ((12) * 16 + 0) == ']' || ((12) * 16 + 0) == ':' || ((12) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 0) < ' ' || ((12) * 16 + 0) == '"' || ((12) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 0) >= ('a') && ((12) * 16 + 0) <= ('z')) || (((12) * 16 + 0) >= ('A') && ((12) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 1) >= ('0') && ((12) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 1) >= ('0') && ((12) * 16 + 1) <= ('9')) || ((12) * 16 + 1) == '-' || ((12) * 16 + 1) == '+' || ((12) * 16 + 1) == '.' || ((12) * 16 + 1) == 'e' || ((12) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 1) >= ('0') && ((12) * 16 + 1) <= ('9')) || (((12) * 16 + 1) >= ('a') && ((12) * 16 + 1) <= ('f')) || (((12) * 16 + 1) >= ('A') && ((12) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 1) == '{' || ((12) * 16 + 1) == '}' || ((12) * 16 + 1) == '[' || ((12) * 16 + 1) == ']' || ((12) * 16 + 1) == ':' || ((12) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 1) < ' ' || ((12) * 16 + 1) == '"' || ((12) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 1) >= ('a') && ((12) * 16 + 1) <= ('z')) || (((12) * 16 + 1) >= ('A') && ((12) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 2) >= ('0') && ((12) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 2) >= ('0') && ((12) * 16 + 2) <= ('9')) || ((12) * 16 + 2) == '-' || ((12) * 16 + 2) == '+' || ((12) * 16 + 2) == '.' || ((12) * 16 + 2) == 'e' || ((12) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 2) >= ('0') && ((12) * 16 + 2) <= ('9')) || (((12) * 16 + 2) >= ('a') && ((12) * 16 + 2) <= ('f')) || (((12) * 16 + 2) >= ('A') && ((12) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 2) == '{' || ((12) * 16 + 2) == '}' || ((12) * 16 + 2) == '[' || ((12) * 16 + 2) == ']' || ((12) * 16 + 2) == ':' || ((12) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 2) < ' ' || ((12) * 16 + 2) == '"' || ((12) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 2) >= ('a') && ((12) * 16 + 2) <= ('z')) || (((12) * 16 + 2) >= ('A') && ((12) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 3) >= ('0') && ((12) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 3) >= ('0') && ((12) * 16 + 3) <= ('9')) || ((12) * 16 + 3) == '-' || ((12) * 16 + 3) == '+' || ((12) * 16 + 3) == '.' || ((12) * 16 + 3) == 'e' || ((12) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 3) >= ('0') && ((12) * 16 + 3) <= ('9')) || (((12) * 16 + 3) >= ('a') && ((12) * 16 + 3) <= ('f')) || (((12) * 16 + 3) >= ('A') && ((12) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 3) == '{' || ((12) * 16 + 3) == '}' || ((12) * 16 + 3) == '[' || ((12) * 16 + 3) == ']' || ((12) * 16 + 3) == ':' || ((12) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 3) < ' ' || ((12) * 16 + 3) == '"' || ((12) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 3) >= ('a') && ((12) * 16 + 3) <= ('z')) || (((12) * 16 + 3) >= ('A') && ((12) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 4) >= ('0') && ((12) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 4) >= ('0') && ((12) * 16 + 4) <= ('9')) || ((12) * 16 + 4) == '-' || ((12) * 16 + 4) == '+' || ((12) * 16 + 4) == '.' || ((12) * 16 + 4) == 'e' || ((12) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 4) >= ('0') && ((12) * 16 + 4) <= ('9')) || (((12) * 16 + 4) >= ('a') && ((12) * 16 + 4) <= ('f')) || (((12) * 16 + 4) >= ('A') && ((12) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 4) == '{' || ((12) * 16 + 4) == '}' || ((12) * 16 + 4) == '[' || ((12) * 16 + 4) == ']' || ((12) * 16 + 4) == ':' || ((12) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 4) < ' ' || ((12) * 16 + 4) == '"' || ((12) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 4) >= ('a') && ((12) * 16 + 4) <= ('z')) || (((12) * 16 + 4) >= ('A') && ((12) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 5) >= ('0') && ((12) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 5) >= ('0') && ((12) * 16 + 5) <= ('9')) || ((12) * 16 + 5) == '-' || ((12) * 16 + 5) == '+' || ((12) * 16 + 5) == '.' || ((12) * 16 + 5) == 'e' || ((12) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 5) >= ('0') && ((12) * 16 + 5) <= ('9')) || (((12) * 16 + 5) >= ('a') && ((12) * 16 + 5) <= ('f')) || (((12) * 16 + 5) >= ('A') && ((12) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 5) == '{' || ((12) * 16 + 5) == '}' || ((12) * 16 + 5) == '[' || ((12) * 16 + 5) == ']' || ((12) * 16 + 5) == ':' || ((12) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 5) < ' ' || ((12) * 16 + 5) == '"' || ((12) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 5) >= ('a') && ((12) * 16 + 5) <= ('z')) || (((12) * 16 + 5) >= ('A') && ((12) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 6) >= ('0') && ((12) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 6) >= ('0') && ((12) * 16 + 6) <= ('9')) || ((12) * 16 + 6) == '-' || ((12) * 16 + 6) == '+' || ((12) * 16 + 6) == '.' || ((12) * 16 + 6) == 'e' || ((12) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 6) >= ('0') && ((12) * 16 + 6) <= ('9')) || (((12) * 16 + 6) >= ('a') && ((12) * 16 + 6) <= ('f')) || (((12) * 16 + 6) >= ('A') && ((12) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 6) == '{' || ((12) * 16 + 6) == '}' || ((12) * 16 + 6) == '[' || ((12) * 16 + 6) == ']' || ((12) * 16 + 6) == ':' || ((12) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 6) < ' ' || ((12) * 16 + 6) == '"' || ((12) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 6) >= ('a') && ((12) * 16 + 6) <= ('z')) || (((12) * 16 + 6) >= ('A') && ((12) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 7) >= ('0') && ((12) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 7) >= ('0') && ((12) * 16 + 7) <= ('9')) || ((12) * 16 + 7) == '-' || ((12) * 16 + 7) == '+' || ((12) * 16 + 7) == '.' || ((12) * 16 + 7) == 'e' || ((12) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 7) >= ('0') && ((12) * 16 + 7) <= ('9')) || (((12) * 16 + 7) >= ('a') && ((12) * 16 + 7) <= ('f')) || (((12) * 16 + 7) >= ('A') && ((12) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 7) == '{' || ((12) * 16 + 7) == '}' || ((12) * 16 + 7) == '[' || ((12) * 16 + 7) == ']' || ((12) * 16 + 7) == ':' || ((12) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 7) < ' ' || ((12) * 16 + 7) == '"' || ((12) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 7) >= ('a') && ((12) * 16 + 7) <= ('z')) || (((12) * 16 + 7) >= ('A') && ((12) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 8) >= ('0') && ((12) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 8) >= ('0') && ((12) * 16 + 8) <= ('9')) || ((12) * 16 + 8) == '-' || ((12) * 16 + 8) == '+' || ((12) * 16 + 8) == '.' || ((12) * 16 + 8) == 'e' || ((12) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 8) >= ('0') && ((12) * 16 + 8) <= ('9')) || (((12) * 16 + 8) >= ('a') && ((12) * 16 + 8) <= ('f')) || (((12) * 16 + 8) >= ('A') && ((12) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 8) == '{' || ((12) * 16 + 8) == '}' || ((12) * 16 + 8) == '[' || ((12) * 16 + 8) == ']' || ((12) * 16 + 8) == ':' || ((12) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 8) < ' ' || ((12) * 16 + 8) == '"' || ((12) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 8) >= ('a') && ((12) * 16 + 8) <= ('z')) || (((12) * 16 + 8) >= ('A') && ((12) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 9) >= ('0') && ((12) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 9) >= ('0') && ((12) * 16 + 9) <= ('9')) || ((12) * 16 + 9) == '-' || ((12) * 16 + 9) == '+' || ((12) * 16 + 9) == '.' || ((12) * 16 + 9) == 'e' || ((12) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 9) >= ('0') && ((12) * 16 + 9) <= ('9')) || (((12) * 16 + 9) >= ('a') && ((12) * 16 + 9) <= ('f')) || (((12) * 16 + 9) >= ('A') && ((12) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 9) == '{' || ((12) * 16 + 9) == '}' || ((12) * 16 + 9) == '[' || ((12) * 16 + 9) == ']' || ((12) * 16 + 9) == ':' || ((12) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 9) < ' ' || ((12) * 16 + 9) == '"' || ((12) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 9) >= ('a') && ((12) * 16 + 9) <= ('z')) || (((12) * 16 + 9) >= ('A') && ((12) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 10) >= ('0') && ((12) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 10) >= ('0') && ((12) * 16 + 10) <= ('9')) || ((12) * 16 + 10) == '-' || ((12) * 16 + 10) == '+' || ((12) * 16 + 10) == '.' || ((12) * 16 + 10) == 'e' || ((12) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 10) >= ('0') && ((12) * 16 + 10) <= ('9')) || (((12) * 16 + 10) >= ('a') && ((12) * 16 + 10) <= ('f')) || (((12) * 16 + 10) >= ('A') && ((12) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 10) == '{' || ((12) * 16 + 10) == '}' || ((12) * 16 + 10) == '[' || ((12) * 16 + 10) == ']' || ((12) * 16 + 10) == ':' || ((12) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 10) < ' ' || ((12) * 16 + 10) == '"' || ((12) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 10) >= ('a') && ((12) * 16 + 10) <= ('z')) || (((12) * 16 + 10) >= ('A') && ((12) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 11) >= ('0') && ((12) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 11) >= ('0') && ((12) * 16 + 11) <= ('9')) || ((12) * 16 + 11) == '-' || ((12) * 16 + 11) == '+' || ((12) * 16 + 11) == '.' || ((12) * 16 + 11) == 'e' || ((12) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 11) >= ('0') && ((12) * 16 + 11) <= ('9')) || (((12) * 16 + 11) >= ('a') && ((12) * 16 + 11) <= ('f')) || (((12) * 16 + 11) >= ('A') && ((12) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 11) == '{' || ((12) * 16 + 11) == '}' || ((12) * 16 + 11) == '[' || ((12) * 16 + 11) == ']' || ((12) * 16 + 11) == ':' || ((12) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 11) < ' ' || ((12) * 16 + 11) == '"' || ((12) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 11) >= ('a') && ((12) * 16 + 11) <= ('z')) || (((12) * 16 + 11) >= ('A') && ((12) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 12) >= ('0') && ((12) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 12) >= ('0') && ((12) * 16 + 12) <= ('9')) || ((12) * 16 + 12) == '-' || ((12) * 16 + 12) == '+' || ((12) * 16 + 12) == '.' || ((12) * 16 + 12) == 'e' || ((12) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 12) >= ('0') && ((12) * 16 + 12) <= ('9')) || (((12) * 16 + 12) >= ('a') && ((12) * 16 + 12) <= ('f')) || (((12) * 16 + 12) >= ('A') && ((12) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 12) == '{' || ((12) * 16 + 12) == '}' || ((12) * 16 + 12) == '[' || ((12) * 16 + 12) == ']' || ((12) * 16 + 12) == ':' || ((12) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 12) < ' ' || ((12) * 16 + 12) == '"' || ((12) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 12) >= ('a') && ((12) * 16 + 12) <= ('z')) || (((12) * 16 + 12) >= ('A') && ((12) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 13) >= ('0') && ((12) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 13) >= ('0') && ((12) * 16 + 13) <= ('9')) || ((12) * 16 + 13) == '-' || ((12) * 16 + 13) == '+' || ((12) * 16 + 13) == '.' || ((12) * 16 + 13) == 'e' || ((12) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 13) >= ('0') && ((12) * 16 + 13) <= ('9')) || (((12) * 16 + 13) >= ('a') && ((12) * 16 + 13) <= ('f')) || (((12) * 16 + 13) >= ('A') && ((12) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 13) == '{' || ((12) * 16 + 13) == '}' || ((12) * 16 + 13) == '[' || ((12) * 16 + 13) == ']' || ((12) * 16 + 13) == ':' || ((12) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 13) < ' ' || ((12) * 16 + 13) == '"' || ((12) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 13) >= ('a') && ((12) * 16 + 13) <= ('z')) || (((12) * 16 + 13) >= ('A') && ((12) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 14) >= ('0') && ((12) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 14) >= ('0') && ((12) * 16 + 14) <= ('9')) || ((12) * 16 + 14) == '-' || ((12) * 16 + 14) == '+' || ((12) * 16 + 14) == '.' || ((12) * 16 + 14) == 'e' || ((12) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 14) >= ('0') && ((12) * 16 + 14) <= ('9')) || (((12) * 16 + 14) >= ('a') && ((12) * 16 + 14) <= ('f')) || (((12) * 16 + 14) >= ('A') && ((12) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 14) == '{' || ((12) * 16 + 14) == '}' || ((12) * 16 + 14) == '[' || ((12) * 16 + 14) == ']' || ((12) * 16 + 14) == ':' || ((12) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 14) < ' ' || ((12) * 16 + 14) == '"' || ((12) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 14) >= ('a') && ((12) * 16 + 14) <= ('z')) || (((12) * 16 + 14) >= ('A') && ((12) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((12) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((12) * 16 + 15) >= ('0') && ((12) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((12) * 16 + 15) >= ('0') && ((12) * 16 + 15) <= ('9')) || ((12) * 16 + 15) == '-' || ((12) * 16 + 15) == '+' || ((12) * 16 + 15) == '.' || ((12) * 16 + 15) == 'e' || ((12) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((12) * 16 + 15) >= ('0') && ((12) * 16 + 15) <= ('9')) || (((12) * 16 + 15) >= ('a') && ((12) * 16 + 15) <= ('f')) || (((12) * 16 + 15) >= ('A') && ((12) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((12) * 16 + 15) == '{' || ((12) * 16 + 15) == '}' || ((12) * 16 + 15) == '[' || ((12) * 16 + 15) == ']' || ((12) * 16 + 15) == ':' || ((12) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((12) * 16 + 15) < ' ' || ((12) * 16 + 15) == '"' || ((12) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((12) * 16 + 15) >= ('a') && ((12) * 16 + 15) <= ('z')) || (((12) * 16 + 15) >= ('A') && ((12) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 0) >= ('0') && ((13) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 0) >= ('0') && ((13) * 16 + 0) <= ('9')) || ((13) * 16 + 0) == '-' || ((13) * 16 + 0) == '+' || ((13) * 16 + 0) == '.' || ((13) * 16 + 0) == 'e' || ((13) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 0) >= ('0') && ((13) * 16 + 0) <= ('9')) || (((13) * 16 + 0) >= ('a') && ((13) * 16 + 0) <= ('f')) || (((13) * 16 + 0) >= ('A') && ((13) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 0) == '{' || ((13) * 16 + 0) == '}' || ((13) * 16 + 0) == '[' || ((13) * 16 + 0) == ']' || ((13) * 16 + 0) == ':' || ((13) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 0) < ' ' || ((13) * 16 + 0) == '"' || ((13) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 0) >= ('a') && ((13) * 16 + 0) <= ('z')) || (((13) * 16 + 0) >= ('A') && ((13) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 1) >= ('0') && ((13) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 1) >= ('0') && ((13) * 16 + 1) <= ('9')) || ((13) * 16 + 1) == '-' || ((13) * 16 + 1) == '+' || ((13) * 16 + 1) == '.' || ((13) * 16 + 1) == 'e' || ((13) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 1) >= ('0') && ((13) * 16 + 1) <= ('9')) || (((13) * 16 + 1) >= ('a') && ((13) * 16 + 1) <= ('f')) || (((13) * 16 + 1) >= ('A') && ((13) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 1) == '{' || ((13) * 16 + 1) == '}' || ((13) * 16 + 1) == '[' || ((13) * 16 + 1) == ']' || ((13) * 16 + 1) == ':' || ((13) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 1) < ' ' || ((13) * 16 + 1) == '"' || ((13) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 1) >= ('a') && ((13) * 16 + 1) <= ('z')) || (((13) * 16 + 1) >= ('A') && ((13) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 2) >= ('0') && ((13) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 2) >= ('0') && ((13) * 16 + 2) <= ('9')) || ((13) * 16 + 2) == '-' || ((13) * 16 + 2) == '+' || ((13) * 16 + 2) == '.' || ((13) * 16 + 2) == 'e' || ((13) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 2) >= ('0') && ((13) * 16 + 2) <= ('9')) || (((13) * 16 + 2) >= ('a') && ((13) * 16 + 2) <= ('f')) || (((13) * 16 + 2) >= ('A') && ((13) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 2) == '{' || ((13) * 16 + 2) == '}' || ((13) * 16 + 2) == '[' || ((13) * 16 + 2) == ']' || ((13) * 16 + 2) == ':' || ((13) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 2) < ' ' || ((13) * 16 + 2) == '"' || ((13) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 2) >= ('a') && ((13) * 16 + 2) <= ('z')) || (((13) * 16 + 2) >= ('A') && ((13) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 3) >= ('0') && ((13) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 3) >= ('0') && ((13) * 16 + 3) <= ('9')) || ((13) * 16 + 3) == '-' || ((13) * 16 + 3) == '+' || ((13) * 16 + 3) == '.' || ((13) * 16 + 3) == 'e' || ((13) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 3) >= ('0') && ((13) * 16 + 3) <= ('9')) || (((13) * 16 + 3) >= ('a') && ((13) * 16 + 3) <= ('f')) || (((13) * 16 + 3) >= ('A') && ((13) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 3) == '{' || ((13) * 16 + 3) == '}' || ((13) * 16 + 3) == '[' || ((13) * 16 + 3) == ']' || ((13) * 16 + 3) == ':' || ((13) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 3) < ' ' || ((13) * 16 + 3) == '"' || ((13) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 3) >= ('a') && ((13) * 16 + 3) <= ('z')) || (((13) * 16 + 3) >= ('A') && ((13) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 4) >= ('0') && ((13) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 4) >= ('0') && ((13) * 16 + 4) <= ('9')) || ((13) * 16 + 4) == '-' || ((13) * 16 + 4) == '+' || ((13) * 16 + 4) == '.' || ((13) * 16 + 4) == 'e' || ((13) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 4) >= ('0') && ((13) * 16 + 4) <= ('9')) || (((13) * 16 + 4) >= ('a') && ((13) * 16 + 4) <= ('f')) || (((13) * 16 + 4) >= ('A') && ((13) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 4) == '{' || ((13) * 16 + 4) == '}' || ((13) * 16 + 4) == '[' || ((13) * 16 + 4) == ']' || ((13) * 16 + 4) == ':' || ((13) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 4) < ' ' || ((13) * 16 + 4) == '"' || ((13) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 4) >= ('a') && ((13) * 16 + 4) <= ('z')) || (((13) * 16 + 4) >= ('A') && ((13) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 5) >= ('0') && ((13) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 5) >= ('0') && ((13) * 16 + 5) <= ('9')) || ((13) * 16 + 5) == '-' || ((13) * 16 + 5) == '+' || ((13) * 16 + 5) == '.' || ((13) * 16 + 5) == 'e' || ((13) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 5) >= ('0') && ((13) * 16 + 5) <= ('9')) || (((13) * 16 + 5) >= ('a') && ((13) * 16 + 5) <= ('f')) || (((13) * 16 + 5) >= ('A') && ((13) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 5) == '{' || ((13) * 16 + 5) == '}' || ((13) * 16 + 5) == '[' || ((13) * 16 + 5) == ']' || ((13) * 16 + 5) == ':' || ((13) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 5) < ' ' || ((13) * 16 + 5) == '"' || ((13) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 5) >= ('a') && ((13) * 16 + 5) <= ('z')) || (((13) * 16 + 5) >= ('A') && ((13) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 6) >= ('0') && ((13) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 6) >= ('0') && ((13) * 16 + 6) <= ('9')) || ((13) * 16 + 6) == '-' || ((13) * 16 + 6) == '+' || ((13) * 16 + 6) == '.' || ((13) * 16 + 6) == 'e' || ((13) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 6) >= ('0') && ((13) * 16 + 6) <= ('9')) || (((13) * 16 + 6) >= ('a') && ((13) * 16 + 6) <= ('f')) || (((13) * 16 + 6) >= ('A') && ((13) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 6) == '{' || ((13) * 16 + 6) == '}' || ((13) * 16 + 6) == '[' || ((13) * 16 + 6) == ']' || ((13) * 16 + 6) == ':' || ((13) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 6) < ' ' || ((13) * 16 + 6) == '"' || ((13) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 6) >= ('a') && ((13) * 16 + 6) <= ('z')) || (((13) * 16 + 6) >= ('A') && ((13) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 7) >= ('0') && ((13) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 7) >= ('0') && ((13) * 16 + 7) <= ('9')) || ((13) * 16 + 7) == '-' || ((13) * 16 + 7) == '+' || ((13) * 16 + 7) == '.' || ((13) * 16 + 7) == 'e' || ((13) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 7) >= ('0') && ((13) * 16 + 7) <= ('9')) || (((13) * 16 + 7) >= ('a') && ((13) * 16 + 7) <= ('f')) || (((13) * 16 + 7) >= ('A') && ((13) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 7) == '{' || ((13) * 16 + 7) == '}' || ((13) * 16 + 7) == '[' || ((13) * 16 + 7) == ']' || ((13) * 16 + 7) == ':' || ((13) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 7) < ' ' || ((13) * 16 + 7) == '"' || ((13) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 7) >= ('a') && ((13) * 16 + 7) <= ('z')) || (((13) * 16 + 7) >= ('A') && ((13) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 8) >= ('0') && ((13) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 8) >= ('0') && ((13) * 16 + 8) <= ('9')) || ((13) * 16 + 8) == '-' || ((13) * 16 + 8) == '+' || ((13) * 16 + 8) == '.' || ((13) * 16 + 8) == 'e' || ((13) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 8) >= ('0') && ((13) * 16 + 8) <= ('9')) || (((13) * 16 + 8) >= ('a') && ((13) * 16 + 8) <= ('f')) || (((13) * 16 + 8) >= ('A') && ((13) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 8) == '{' || ((13) * 16 + 8) == '}' || ((13) * 16 + 8) == '[' || ((13) * 16 + 8) == ']' || ((13) * 16 + 8) == ':' || ((13) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 8) < ' ' || ((13) * 16 + 8) == '"' || ((13) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 8) >= ('a') && ((13) * 16 + 8) <= ('z')) || (((13) * 16 + 8) >= ('A') && ((13) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 9) >= ('0') && ((13) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 9) >= ('0') && ((13) * 16 + 9) <= ('9')) || ((13) * 16 + 9) == '-' || ((13) * 16 + 9) == '+' || ((13) * 16 + 9) == '.' || ((13) * 16 + 9) == 'e' || ((13) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 9) >= ('0') && ((13) * 16 + 9) <= ('9')) || (((13) * 16 + 9) >= ('a') && ((13) * 16 + 9) <= ('f')) || (((13) * 16 + 9) >= ('A') && ((13) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 9) == '{' || ((13) * 16 + 9) == '}' || ((13) * 16 + 9) == '[' || ((13) * 16 + 9) == ']' || ((13) * 16 + 9) == ':' || ((13) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 9) < ' ' || ((13) * 16 + 9) == '"' || ((13) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 9) >= ('a') && ((13) * 16 + 9) <= ('z')) || (((13) * 16 + 9) >= ('A') && ((13) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 10) >= ('0') && ((13) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 10) >= ('0') && ((13) * 16 + 10) <= ('9')) || ((13) * 16 + 10) == '-' || ((13) * 16 + 10) == '+' || ((13) * 16 + 10) == '.' || ((13) * 16 + 10) == 'e' || ((13) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 10) >= ('0') && ((13) * 16 + 10) <= ('9')) || (((13) * 16 + 10) >= ('a') && ((13) * 16 + 10) <= ('f')) || (((13) * 16 + 10) >= ('A') && ((13) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 10) == '{' || ((13) * 16 + 10) == '}' || ((13) * 16 + 10) == '[' || ((13) * 16 + 10) == ']' || ((13) * 16 + 10) == ':' || ((13) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 10) < ' ' || ((13) * 16 + 10) == '"' || ((13) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 10) >= ('a') && ((13) * 16 + 10) <= ('z')) || (((13) * 16 + 10) >= ('A') && ((13) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 11) >= ('0') && ((13) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 11) >= ('0') && ((13) * 16 + 11) <= ('9')) || ((13) * 16 + 11) == '-' || ((13) * 16 + 11) == '+' || ((13) * 16 + 11) == '.' || ((13) * 16 + 11) == 'e' || ((13) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 11) >= ('0') && ((13) * 16 + 11) <= ('9')) || (((13) * 16 + 11) >= ('a') && ((13) * 16 + 11) <= ('f')) || (((13) * 16 + 11) >= ('A') && ((13) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 11) == '{' || ((13) * 16 + 11) == '}' || ((13) * 16 + 11) == '[' || ((13) * 16 + 11) == ']' || ((13) * 16 + 11) == ':' || ((13) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 11) < ' ' || ((13) * 16 + 11) == '"' || ((13) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 11) >= ('a') && ((13) * 16 + 11) <= ('z')) || (((13) * 16 + 11) >= ('A') && ((13) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 12) >= ('0') && ((13) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 12) >= ('0') && ((13) * 16 + 12) <= ('9')) || ((13) * 16 + 12) == '-' || ((13) * 16 + 12) == '+' || ((13) * 16 + 12) == '.' || ((13) * 16 + 12) == 'e' || ((13) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 12) >= ('0') && ((13) * 16 + 12) <= ('9')) || (((13) * 16 + 12) >= ('a') && ((13) * 16 + 12) <= ('f')) || (((13) * 16 + 12) >= ('A') && ((13) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 12) == '{' || ((13) * 16 + 12) == '}' || ((13) * 16 + 12) == '[' || ((13) * 16 + 12) == ']' || ((13) * 16 + 12) == ':' || ((13) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 12) < ' ' || ((13) * 16 + 12) == '"' || ((13) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 12) >= ('a') && ((13) * 16 + 12) <= ('z')) || (((13) * 16 + 12) >= ('A') && ((13) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 13) >= ('0') && ((13) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 13) >= ('0') && ((13) * 16 + 13) <= ('9')) || ((13) * 16 + 13) == '-' || ((13) * 16 + 13) == '+' || ((13) * 16 + 13) == '.' || ((13) * 16 + 13) == 'e' || ((13) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 13) >= ('0') && ((13) * 16 + 13) <= ('9')) || (((13) * 16 + 13) >= ('a') && ((13) * 16 + 13) <= ('f')) || (((13) * 16 + 13) >= ('A') && ((13) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 13) == '{' || ((13) * 16 + 13) == '}' || ((13) * 16 + 13) == '[' || ((13) * 16 + 13) == ']' || ((13) * 16 + 13) == ':' || ((13) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 13) < ' ' || ((13) * 16 + 13) == '"' || ((13) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 13) >= ('a') && ((13) * 16 + 13) <= ('z')) || (((13) * 16 + 13) >= ('A') && ((13) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 14) >= ('0') && ((13) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 14) >= ('0') && ((13) * 16 + 14) <= ('9')) || ((13) * 16 + 14) == '-' || ((13) * 16 + 14) == '+' || ((13) * 16 + 14) == '.' || ((13) * 16 + 14) == 'e' || ((13) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 14) >= ('0') && ((13) * 16 + 14) <= ('9')) || (((13) * 16 + 14) >= ('a') && ((13) * 16 + 14) <= ('f')) || (((13) * 16 + 14) >= ('A') && ((13) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 14) == '{' || ((13) * 16 + 14) == '}' || ((13) * 16 + 14) == '[' || ((13) * 16 + 14) == ']' || ((13) * 16 + 14) == ':' || ((13) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 14) < ' ' || ((13) * 16 + 14) == '"' || ((13) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 14) >= ('a') && ((13) * 16 + 14) <= ('z')) || (((13) * 16 + 14) >= ('A') && ((13) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((13) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((13) * 16 + 15) >= ('0') && ((13) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((13) * 16 + 15) >= ('0') && ((13) * 16 + 15) <= ('9')) || ((13) * 16 + 15) == '-' || ((13) * 16 + 15) == '+' || ((13) * 16 + 15) == '.' || ((13) * 16 + 15) == 'e' || ((13) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((13) * 16 + 15) >= ('0') && ((13) * 16 + 15) <= ('9')) || (((13) * 16 + 15) >= ('a') && ((13) * 16 + 15) <= ('f')) || (((13) * 16 + 15) >= ('A') && ((13) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((13) * 16 + 15) == '{' || ((13) * 16 + 15) == '}' || ((13) * 16 + 15) == '[' || ((13) * 16 + 15) == ']' || ((13) * 16 + 15) == ':' || ((13) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((13) * 16 + 15) < ' ' || ((13) * 16 + 15) == '"' || ((13) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((13) * 16 + 15) >= ('a') && ((13) * 16 + 15) <= ('z')) || (((13) * 16 + 15) >= ('A') && ((13) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 0) >= ('0') && ((14) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 0) >= ('0') && ((14) * 16 + 0) <= ('9')) || ((14) * 16 + 0) == '-' || ((14) * 16 + 0) == '+' || ((14) * 16 + 0) == '.' || ((14) * 16 + 0) == 'e' || ((14) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 0) >= ('0') && ((14) * 16 + 0) <= ('9')) || (((14) * 16 + 0) >= ('a') && ((14) * 16 + 0) <= ('f')) || (((14) * 16 + 0) >= ('A') && ((14) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 0) == '{' || ((14) * 16 + 0) == '}' || ((14) * 16 + 0) == '[' || ((14) * 16 + 0) == ']' || ((14) * 16 + 0) == ':' || ((14) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 0) < ' ' || ((14) * 16 + 0) == '"' || ((14) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 0) >= ('a') && ((14) * 16 + 0) <= ('z')) || (((14) * 16 + 0) >= ('A') && ((14) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 1) >= ('0') && ((14) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 1) >= ('0') && ((14) * 16 + 1) <= ('9')) || ((14) * 16 + 1) == '-' || ((14) * 16 + 1) == '+' || ((14) * 16 + 1) == '.' || ((14) * 16 + 1) == 'e' || ((14) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 1) >= ('0') && ((14) * 16 + 1) <= ('9')) || (((14) * 16 + 1) >= ('a') && ((14) * 16 + 1) <= ('f')) || (((14) * 16 + 1) >= ('A') && ((14) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 1) == '{' || ((14) * 16 + 1) == '}' || ((14) * 16 + 1) == '[' || ((14) * 16 + 1) == ']' || ((14) * 16 + 1) == ':' || ((14) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 1) < ' ' || ((14) * 16 + 1) == '"' || ((14) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 1) >= ('a') && ((14) * 16 + 1) <= ('z')) || (((14) * 16 + 1) >= ('A') && ((14) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 2) >= ('0') && ((14) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 2) >= ('0') && ((14) * 16 + 2) <= ('9')) || ((14) * 16 + 2) == '-' || ((14) * 16 + 2) == '+' || ((14) * 16 + 2) == '.' || ((14) * 16 + 2) == 'e' || ((14) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 2) >= ('0') && ((14) * 16 + 2) <= ('9')) || (((14) * 16 + 2) >= ('a') && ((14) * 16 + 2) <= ('f')) || (((14) * 16 + 2) >= ('A') && ((14) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 2) == '{' || ((14) * 16 + 2) == '}' || ((14) * 16 + 2) == '[' || ((14) * 16 + 2) == ']' || ((14) * 16 + 2) == ':' || ((14) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 2) < ' ' || ((14) * 16 + 2) == '"' || ((14) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 2) >= ('a') && ((14) * 16 + 2) <= ('z')) || (((14) * 16 + 2) >= ('A') && ((14) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 3) >= ('0') && ((14) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 3) >= ('0') && ((14) * 16 + 3) <= ('9')) || ((14) * 16 + 3) == '-' || ((14) * 16 + 3) == '+' || ((14) * 16 + 3) == '.' || ((14) * 16 + 3) == 'e' || ((14) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 3) >= ('0') && ((14) * 16 + 3) <= ('9')) || (((14) * 16 + 3) >= ('a') && ((14) * 16 + 3) <= ('f')) || (((14) * 16 + 3) >= ('A') && ((14) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 3) == '{' || ((14) * 16 + 3) == '}' || ((14) * 16 + 3) == '[' || ((14) * 16 + 3) == ']' || ((14) * 16 + 3) == ':' || ((14) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 3) < ' ' || ((14) * 16 + 3) == '"' || ((14) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 3) >= ('a') && ((14) * 16 + 3) <= ('z')) || (((14) * 16 + 3) >= ('A') && ((14) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 4) >= ('0') && ((14) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 4) >= ('0') && ((14) * 16 + 4) <= ('9')) || ((14) * 16 + 4) == '-' || ((14) * 16 + 4) == '+' || ((14) * 16 + 4) == '.' || ((14) * 16 + 4) == 'e' || ((14) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 4) >= ('0') && ((14) * 16 + 4) <= ('9')) || (((14) * 16 + 4) >= ('a') && ((14) * 16 + 4) <= ('f')) || (((14) * 16 + 4) >= ('A') && ((14) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 4) == '{' || ((14) * 16 + 4) == '}' || ((14) * 16 + 4) == '[' || ((14) * 16 + 4) == ']' || ((14) * 16 + 4) == ':' || ((14) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 4) < ' ' || ((14) * 16 + 4) == '"' || ((14) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 4) >= ('a') && ((14) * 16 + 4) <= ('z')) || (((14) * 16 + 4) >= ('A') && ((14) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 5) >= ('0') && ((14) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 5) >= ('0') && ((14) * 16 + 5) <= ('9')) || ((14) * 16 + 5) == '-' || ((14) * 16 + 5) == '+' || ((14) * 16 + 5) == '.' || ((14) * 16 + 5) == 'e' || ((14) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 5) >= ('0') && ((14) * 16 + 5) <= ('9')) || (((14) * 16 + 5) >= ('a') && ((14) * 16 + 5) <= ('f')) || (((14) * 16 + 5) >= ('A') && ((14) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 5) == '{' || ((14) * 16 + 5) == '}' || ((14) * 16 + 5) == '[' || ((14) * 16 + 5) == ']' || ((14) * 16 + 5) == ':' || ((14) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 5) < ' ' || ((14) * 16 + 5) == '"' || ((14) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 5) >= ('a') && ((14) * 16 + 5) <= ('z')) || (((14) * 16 + 5) >= ('A') && ((14) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 6) >= ('0') && ((14) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 6) >= ('0') && ((14) * 16 + 6) <= ('9')) || ((14) * 16 + 6) == '-' || ((14) * 16 + 6) == '+' || ((14) * 16 + 6) == '.' || ((14) * 16 + 6) == 'e' || ((14) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 6) >= ('0') && ((14) * 16 + 6) <= ('9')) || (((14) * 16 + 6) >= ('a') && ((14) * 16 + 6) <= ('f')) || (((14) * 16 + 6) >= ('A') && ((14) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 6) == '{' || ((14) * 16 + 6) == '}' || ((14) * 16 + 6) == '[' || ((14) * 16 + 6) == ']' || ((14) * 16 + 6) == ':' || ((14) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 6) < ' ' || ((14) * 16 + 6) == '"' || ((14) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 6) >= ('a') && ((14) * 16 + 6) <= ('z')) || (((14) * 16 + 6) >= ('A') && ((14) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 7) >= ('0') && ((14) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 7) >= ('0') && ((14) * 16 + 7) <= ('9')) || ((14) * 16 + 7) == '-' || ((14) * 16 + 7) == '+' || ((14) * 16 + 7) == '.' || ((14) * 16 + 7) == 'e' || ((14) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 7) >= ('0') && ((14) * 16 + 7) <= ('9')) || (((14) * 16 + 7) >= ('a') && ((14) * 16 + 7) <= ('f')) || (((14) * 16 + 7) >= ('A') && ((14) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 7) == '{' || ((14) * 16 + 7) == '}' || ((14) * 16 + 7) == '[' || ((14) * 16 + 7) == ']' || ((14) * 16 + 7) == ':' || ((14) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 7) < ' ' || ((14) * 16 + 7) == '"' || ((14) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 7) >= ('a') && ((14) * 16 + 7) <= ('z')) || (((14) * 16 + 7) >= ('A') && ((14) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 8) >= ('0') && ((14) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 8) >= ('0') && ((14) * 16 + 8) <= ('9')) || ((14) * 16 + 8) == '-' || ((14) * 16 + 8) == '+' || ((14) * 16 + 8) == '.' || ((14) * 16 + 8) == 'e' || ((14) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 8) >= ('0') && ((14) * 16 + 8) <= ('9')) || (((14) * 16 + 8) >= ('a') && ((14) * 16 + 8) <= ('f')) || (((14) * 16 + 8) >= ('A') && ((14) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 8) == '{' || ((14) * 16 + 8) == '}' || ((14) * 16 + 8) == '[' || ((14) * 16 + 8) == ']' || ((14) * 16 + 8) == ':' || ((14) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 8) < ' ' || ((14) * 16 + 8) == '"' || ((14) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 8) >= ('a') && ((14) * 16 + 8) <= ('z')) || (((14) * 16 + 8) >= ('A') && ((14) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 9) >= ('0') && ((14) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 9) >= ('0') && ((14) * 16 + 9) <= ('9')) || ((14) * 16 + 9) == '-' || ((14) * 16 + 9) == '+' || ((14) * 16 + 9) == '.' || ((14) * 16 + 9) == 'e' || ((14) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 9) >= ('0') && ((14) * 16 + 9) <= ('9')) || (((14) * 16 + 9) >= ('a') && ((14) * 16 + 9) <= ('f')) || (((14) * 16 + 9) >= ('A') && ((14) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 9) == '{' || ((14) * 16 + 9) == '}' || ((14) * 16 + 9) == '[' || ((14) * 16 + 9) == ']' || ((14) * 16 + 9) == ':' || ((14) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 9) < ' ' || ((14) * 16 + 9) == '"' || ((14) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 9) >= ('a') && ((14) * 16 + 9) <= ('z')) || (((14) * 16 + 9) >= ('A') && ((14) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 10) >= ('0') && ((14) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 10) >= ('0') && ((14) * 16 + 10) <= ('9')) || ((14) * 16 + 10) == '-' || ((14) * 16 + 10) == '+' || ((14) * 16 + 10) == '.' || ((14) * 16 + 10) == 'e' || ((14) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 10) >= ('0') && ((14) * 16 + 10) <= ('9')) || (((14) * 16 + 10) >= ('a') && ((14) * 16 + 10) <= ('f')) || (((14) * 16 + 10) >= ('A') && ((14) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 10) == '{' || ((14) * 16 + 10) == '}' || ((14) * 16 + 10) == '[' || ((14) * 16 + 10) == ']' || ((14) * 16 + 10) == ':' || ((14) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 10) < ' ' || ((14) * 16 + 10) == '"' || ((14) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 10) >= ('a') && ((14) * 16 + 10) <= ('z')) || (((14) * 16 + 10) >= ('A') && ((14) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 11) >= ('0') && ((14) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 11) >= ('0') && ((14) * 16 + 11) <= ('9')) || ((14) * 16 + 11) == '-' || ((14) * 16 + 11) == '+' || ((14) * 16 + 11) == '.' || ((14) * 16 + 11) == 'e' || ((14) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 11) >= ('0') && ((14) * 16 + 11) <= ('9')) || (((14) * 16 + 11) >= ('a') && ((14) * 16 + 11) <= ('f')) || (((14) * 16 + 11) >= ('A') && ((14) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 11) == '{' || ((14) * 16 + 11) == '}' || ((14) * 16 + 11) == '[' || ((14) * 16 + 11) == ']' || ((14) * 16 + 11) == ':' || ((14) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 11) < ' ' || ((14) * 16 + 11) == '"' || ((14) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 11) >= ('a') && ((14) * 16 + 11) <= ('z')) || (((14) * 16 + 11) >= ('A') && ((14) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 12) >= ('0') && ((14) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 12) >= ('0') && ((14) * 16 + 12) <= ('9')) || ((14) * 16 + 12) == '-' || ((14) * 16 + 12) == '+' || ((14) * 16 + 12) == '.' || ((14) * 16 + 12) == 'e' || ((14) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 12) >= ('0') && ((14) * 16 + 12) <= ('9')) || (((14) * 16 + 12) >= ('a') && ((14) * 16 + 12) <= ('f')) || (((14) * 16 + 12) >= ('A') && ((14) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 12) == '{' || ((14) * 16 + 12) == '}' || ((14) * 16 + 12) == '[' || ((14) * 16 + 12) == ']' || ((14) * 16 + 12) == ':' || ((14) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 12) < ' ' || ((14) * 16 + 12) == '"' || ((14) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 12) >= ('a') && ((14) * 16 + 12) <= ('z')) || (((14) * 16 + 12) >= ('A') && ((14) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 13) >= ('0') && ((14) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 13) >= ('0') && ((14) * 16 + 13) <= ('9')) || ((14) * 16 + 13) == '-' || ((14) * 16 + 13) == '+' || ((14) * 16 + 13) == '.' || ((14) * 16 + 13) == 'e' || ((14) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 13) >= ('0') && ((14) * 16 + 13) <= ('9')) || (((14) * 16 + 13) >= ('a') && ((14) * 16 + 13) <= ('f')) || (((14) * 16 + 13) >= ('A') && ((14) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 13) == '{' || ((14) * 16 + 13) == '}' || ((14) * 16 + 13) == '[' || ((14) * 16 + 13) == ']' || ((14) * 16 + 13) == ':' || ((14) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 13) < ' ' || ((14) * 16 + 13) == '"' || ((14) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 13) >= ('a') && ((14) * 16 + 13) <= ('z')) || (((14) * 16 + 13) >= ('A') && ((14) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 14) >= ('0') && ((14) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 14) >= ('0') && ((14) * 16 + 14) <= ('9')) || ((14) * 16 + 14) == '-' || ((14) * 16 + 14) == '+' || ((14) * 16 + 14) == '.' || ((14) * 16 + 14) == 'e' || ((14) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 14) >= ('0') && ((14) * 16 + 14) <= ('9')) || (((14) * 16 + 14) >= ('a') && ((14) * 16 + 14) <= ('f')) || (((14) * 16 + 14) >= ('A') && ((14) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 14) == '{' || ((14) * 16 + 14) == '}' || ((14) * 16 + 14) == '[' || ((14) * 16 + 14) == ']' || ((14) * 16 + 14) == ':' || ((14) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 14) < ' ' || ((14) * 16 + 14) == '"' || ((14) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 14) >= ('a') && ((14) * 16 + 14) <= ('z')) || (((14) * 16 + 14) >= ('A') && ((14) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((14) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((14) * 16 + 15) >= ('0') && ((14) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((14) * 16 + 15) >= ('0') && ((14) * 16 + 15) <= ('9')) || ((14) * 16 + 15) == '-' || ((14) * 16 + 15) == '+' || ((14) * 16 + 15) == '.' || ((14) * 16 + 15) == 'e' || ((14) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((14) * 16 + 15) >= ('0') && ((14) * 16 + 15) <= ('9')) || (((14) * 16 + 15) >= ('a') && ((14) * 16 + 15) <= ('f')) || (((14) * 16 + 15) >= ('A') && ((14) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((14) * 16 + 15) == '{' || ((14) * 16 + 15) == '}' || ((14) * 16 + 15) == '[' || ((14) * 16 + 15) == ']' || ((14) * 16 + 15) == ':' || ((14) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((14) * 16 + 15) < ' ' || ((14) * 16 + 15) == '"' || ((14) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((14) * 16 + 15) >= ('a') && ((14) * 16 + 15) <= ('z')) || (((14) * 16 + 15) >= ('A') && ((14) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 0) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 0) >= ('0') && ((15) * 16 + 0) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 0) >= ('0') && ((15) * 16 + 0) <= ('9')) || ((15) * 16 + 0) == '-' || ((15) * 16 + 0) == '+' || ((15) * 16 + 0) == '.' || ((15) * 16 + 0) == 'e' || ((15) * 16 + 0) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 0) >= ('0') && ((15) * 16 + 0) <= ('9')) || (((15) * 16 + 0) >= ('a') && ((15) * 16 + 0) <= ('f')) || (((15) * 16 + 0) >= ('A') && ((15) * 16 + 0) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 0) == '{' || ((15) * 16 + 0) == '}' || ((15) * 16 + 0) == '[' || ((15) * 16 + 0) == ']' || ((15) * 16 + 0) == ':' || ((15) * 16 + 0) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 0) < ' ' || ((15) * 16 + 0) == '"' || ((15) * 16 + 0) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 0) >= ('a') && ((15) * 16 + 0) <= ('z')) || (((15) * 16 + 0) >= ('A') && ((15) * 16 + 0) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 1) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 1) >= ('0') && ((15) * 16 + 1) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 1) >= ('0') && ((15) * 16 + 1) <= ('9')) || ((15) * 16 + 1) == '-' || ((15) * 16 + 1) == '+' || ((15) * 16 + 1) == '.' || ((15) * 16 + 1) == 'e' || ((15) * 16 + 1) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 1) >= ('0') && ((15) * 16 + 1) <= ('9')) || (((15) * 16 + 1) >= ('a') && ((15) * 16 + 1) <= ('f')) || (((15) * 16 + 1) >= ('A') && ((15) * 16 + 1) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 1) == '{' || ((15) * 16 + 1) == '}' || ((15) * 16 + 1) == '[' || ((15) * 16 + 1) == ']' || ((15) * 16 + 1) == ':' || ((15) * 16 + 1) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 1) < ' ' || ((15) * 16 + 1) == '"' || ((15) * 16 + 1) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 1) >= ('a') && ((15) * 16 + 1) <= ('z')) || (((15) * 16 + 1) >= ('A') && ((15) * 16 + 1) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 2) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 2) >= ('0') && ((15) * 16 + 2) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 2) >= ('0') && ((15) * 16 + 2) <= ('9')) || ((15) * 16 + 2) == '-' || ((15) * 16 + 2) == '+' || ((15) * 16 + 2) == '.' || ((15) * 16 + 2) == 'e' || ((15) * 16 + 2) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 2) >= ('0') && ((15) * 16 + 2) <= ('9')) || (((15) * 16 + 2) >= ('a') && ((15) * 16 + 2) <= ('f')) || (((15) * 16 + 2) >= ('A') && ((15) * 16 + 2) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 2) == '{' || ((15) * 16 + 2) == '}' || ((15) * 16 + 2) == '[' || ((15) * 16 + 2) == ']' || ((15) * 16 + 2) == ':' || ((15) * 16 + 2) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 2) < ' ' || ((15) * 16 + 2) == '"' || ((15) * 16 + 2) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 2) >= ('a') && ((15) * 16 + 2) <= ('z')) || (((15) * 16 + 2) >= ('A') && ((15) * 16 + 2) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 3) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 3) >= ('0') && ((15) * 16 + 3) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 3) >= ('0') && ((15) * 16 + 3) <= ('9')) || ((15) * 16 + 3) == '-' || ((15) * 16 + 3) == '+' || ((15) * 16 + 3) == '.' || ((15) * 16 + 3) == 'e' || ((15) * 16 + 3) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 3) >= ('0') && ((15) * 16 + 3) <= ('9')) || (((15) * 16 + 3) >= ('a') && ((15) * 16 + 3) <= ('f')) || (((15) * 16 + 3) >= ('A') && ((15) * 16 + 3) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 3) == '{' || ((15) * 16 + 3) == '}' || ((15) * 16 + 3) == '[' || ((15) * 16 + 3) == ']' || ((15) * 16 + 3) == ':' || ((15) * 16 + 3) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 3) < ' ' || ((15) * 16 + 3) == '"' || ((15) * 16 + 3) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 3) >= ('a') && ((15) * 16 + 3) <= ('z')) || (((15) * 16 + 3) >= ('A') && ((15) * 16 + 3) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 4) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 4) >= ('0') && ((15) * 16 + 4) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 4) >= ('0') && ((15) * 16 + 4) <= ('9')) || ((15) * 16 + 4) == '-' || ((15) * 16 + 4) == '+' || ((15) * 16 + 4) == '.' || ((15) * 16 + 4) == 'e' || ((15) * 16 + 4) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 4) >= ('0') && ((15) * 16 + 4) <= ('9')) || (((15) * 16 + 4) >= ('a') && ((15) * 16 + 4) <= ('f')) || (((15) * 16 + 4) >= ('A') && ((15) * 16 + 4) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 4) == '{' || ((15) * 16 + 4) == '}' || ((15) * 16 + 4) == '[' || ((15) * 16 + 4) == ']' || ((15) * 16 + 4) == ':' || ((15) * 16 + 4) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 4) < ' ' || ((15) * 16 + 4) == '"' || ((15) * 16 + 4) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 4) >= ('a') && ((15) * 16 + 4) <= ('z')) || (((15) * 16 + 4) >= ('A') && ((15) * 16 + 4) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 5) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 5) >= ('0') && ((15) * 16 + 5) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 5) >= ('0') && ((15) * 16 + 5) <= ('9')) || ((15) * 16 + 5) == '-' || ((15) * 16 + 5) == '+' || ((15) * 16 + 5) == '.' || ((15) * 16 + 5) == 'e' || ((15) * 16 + 5) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 5) >= ('0') && ((15) * 16 + 5) <= ('9')) || (((15) * 16 + 5) >= ('a') && ((15) * 16 + 5) <= ('f')) || (((15) * 16 + 5) >= ('A') && ((15) * 16 + 5) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 5) == '{' || ((15) * 16 + 5) == '}' || ((15) * 16 + 5) == '[' || ((15) * 16 + 5) == ']' || ((15) * 16 + 5) == ':' || ((15) * 16 + 5) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 5) < ' ' || ((15) * 16 + 5) == '"' || ((15) * 16 + 5) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 5) >= ('a') && ((15) * 16 + 5) <= ('z')) || (((15) * 16 + 5) >= ('A') && ((15) * 16 + 5) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 6) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 6) >= ('0') && ((15) * 16 + 6) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 6) >= ('0') && ((15) * 16 + 6) <= ('9')) || ((15) * 16 + 6) == '-' || ((15) * 16 + 6) == '+' || ((15) * 16 + 6) == '.' || ((15) * 16 + 6) == 'e' || ((15) * 16 + 6) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 6) >= ('0') && ((15) * 16 + 6) <= ('9')) || (((15) * 16 + 6) >= ('a') && ((15) * 16 + 6) <= ('f')) || (((15) * 16 + 6) >= ('A') && ((15) * 16 + 6) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 6) == '{' || ((15) * 16 + 6) == '}' || ((15) * 16 + 6) == '[' || ((15) * 16 + 6) == ']' || ((15) * 16 + 6) == ':' || ((15) * 16 + 6) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 6) < ' ' || ((15) * 16 + 6) == '"' || ((15) * 16 + 6) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 6) >= ('a') && ((15) * 16 + 6) <= ('z')) || (((15) * 16 + 6) >= ('A') && ((15) * 16 + 6) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 7) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 7) >= ('0') && ((15) * 16 + 7) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 7) >= ('0') && ((15) * 16 + 7) <= ('9')) || ((15) * 16 + 7) == '-' || ((15) * 16 + 7) == '+' || ((15) * 16 + 7) == '.' || ((15) * 16 + 7) == 'e' || ((15) * 16 + 7) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 7) >= ('0') && ((15) * 16 + 7) <= ('9')) || (((15) * 16 + 7) >= ('a') && ((15) * 16 + 7) <= ('f')) || (((15) * 16 + 7) >= ('A') && ((15) * 16 + 7) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 7) == '{' || ((15) * 16 + 7) == '}' || ((15) * 16 + 7) == '[' || ((15) * 16 + 7) == ']' || ((15) * 16 + 7) == ':' || ((15) * 16 + 7) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 7) < ' ' || ((15) * 16 + 7) == '"' || ((15) * 16 + 7) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 7) >= ('a') && ((15) * 16 + 7) <= ('z')) || (((15) * 16 + 7) >= ('A') && ((15) * 16 + 7) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 8) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 8) >= ('0') && ((15) * 16 + 8) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 8) >= ('0') && ((15) * 16 + 8) <= ('9')) || ((15) * 16 + 8) == '-' || ((15) * 16 + 8) == '+' || ((15) * 16 + 8) == '.' || ((15) * 16 + 8) == 'e' || ((15) * 16 + 8) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 8) >= ('0') && ((15) * 16 + 8) <= ('9')) || (((15) * 16 + 8) >= ('a') && ((15) * 16 + 8) <= ('f')) || (((15) * 16 + 8) >= ('A') && ((15) * 16 + 8) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 8) == '{' || ((15) * 16 + 8) == '}' || ((15) * 16 + 8) == '[' || ((15) * 16 + 8) == ']' || ((15) * 16 + 8) == ':' || ((15) * 16 + 8) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 8) < ' ' || ((15) * 16 + 8) == '"' || ((15) * 16 + 8) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 8) >= ('a') && ((15) * 16 + 8) <= ('z')) || (((15) * 16 + 8) >= ('A') && ((15) * 16 + 8) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 9) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 9) >= ('0') && ((15) * 16 + 9) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 9) >= ('0') && ((15) * 16 + 9) <= ('9')) || ((15) * 16 + 9) == '-' || ((15) * 16 + 9) == '+' || ((15) * 16 + 9) == '.' || ((15) * 16 + 9) == 'e' || ((15) * 16 + 9) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 9) >= ('0') && ((15) * 16 + 9) <= ('9')) || (((15) * 16 + 9) >= ('a') && ((15) * 16 + 9) <= ('f')) || (((15) * 16 + 9) >= ('A') && ((15) * 16 + 9) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 9) == '{' || ((15) * 16 + 9) == '}' || ((15) * 16 + 9) == '[' || ((15) * 16 + 9) == ']' || ((15) * 16 + 9) == ':' || ((15) * 16 + 9) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 9) < ' ' || ((15) * 16 + 9) == '"' || ((15) * 16 + 9) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 9) >= ('a') && ((15) * 16 + 9) <= ('z')) || (((15) * 16 + 9) >= ('A') && ((15) * 16 + 9) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 10) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 10) >= ('0') && ((15) * 16 + 10) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 10) >= ('0') && ((15) * 16 + 10) <= ('9')) || ((15) * 16 + 10) == '-' || ((15) * 16 + 10) == '+' || ((15) * 16 + 10) == '.' || ((15) * 16 + 10) == 'e' || ((15) * 16 + 10) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 10) >= ('0') && ((15) * 16 + 10) <= ('9')) || (((15) * 16 + 10) >= ('a') && ((15) * 16 + 10) <= ('f')) || (((15) * 16 + 10) >= ('A') && ((15) * 16 + 10) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 10) == '{' || ((15) * 16 + 10) == '}' || ((15) * 16 + 10) == '[' || ((15) * 16 + 10) == ']' || ((15) * 16 + 10) == ':' || ((15) * 16 + 10) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 10) < ' ' || ((15) * 16 + 10) == '"' || ((15) * 16 + 10) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 10) >= ('a') && ((15) * 16 + 10) <= ('z')) || (((15) * 16 + 10) >= ('A') && ((15) * 16 + 10) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 11) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 11) >= ('0') && ((15) * 16 + 11) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 11) >= ('0') && ((15) * 16 + 11) <= ('9')) || ((15) * 16 + 11) == '-' || ((15) * 16 + 11) == '+' || ((15) * 16 + 11) == '.' || ((15) * 16 + 11) == 'e' || ((15) * 16 + 11) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 11) >= ('0') && ((15) * 16 + 11) <= ('9')) || (((15) * 16 + 11) >= ('a') && ((15) * 16 + 11) <= ('f')) || (((15) * 16 + 11) >= ('A') && ((15) * 16 + 11) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 11) == '{' || ((15) * 16 + 11) == '}' || ((15) * 16 + 11) == '[' || ((15) * 16 + 11) == ']' || ((15) * 16 + 11) == ':' || ((15) * 16 + 11) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 11) < ' ' || ((15) * 16 + 11) == '"' || ((15) * 16 + 11) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 11) >= ('a') && ((15) * 16 + 11) <= ('z')) || (((15) * 16 + 11) >= ('A') && ((15) * 16 + 11) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 12) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 12) >= ('0') && ((15) * 16 + 12) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 12) >= ('0') && ((15) * 16 + 12) <= ('9')) || ((15) * 16 + 12) == '-' || ((15) * 16 + 12) == '+' || ((15) * 16 + 12) == '.' || ((15) * 16 + 12) == 'e' || ((15) * 16 + 12) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 12) >= ('0') && ((15) * 16 + 12) <= ('9')) || (((15) * 16 + 12) >= ('a') && ((15) * 16 + 12) <= ('f')) || (((15) * 16 + 12) >= ('A') && ((15) * 16 + 12) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 12) == '{' || ((15) * 16 + 12) == '}' || ((15) * 16 + 12) == '[' || ((15) * 16 + 12) == ']' || ((15) * 16 + 12) == ':' || ((15) * 16 + 12) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 12) < ' ' || ((15) * 16 + 12) == '"' || ((15) * 16 + 12) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 12) >= ('a') && ((15) * 16 + 12) <= ('z')) || (((15) * 16 + 12) >= ('A') && ((15) * 16 + 12) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 13) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 13) >= ('0') && ((15) * 16 + 13) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 13) >= ('0') && ((15) * 16 + 13) <= ('9')) || ((15) * 16 + 13) == '-' || ((15) * 16 + 13) == '+' || ((15) * 16 + 13) == '.' || ((15) * 16 + 13) == 'e' || ((15) * 16 + 13) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 13) >= ('0') && ((15) * 16 + 13) <= ('9')) || (((15) * 16 + 13) >= ('a') && ((15) * 16 + 13) <= ('f')) || (((15) * 16 + 13) >= ('A') && ((15) * 16 + 13) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 13) == '{' || ((15) * 16 + 13) == '}' || ((15) * 16 + 13) == '[' || ((15) * 16 + 13) == ']' || ((15) * 16 + 13) == ':' || ((15) * 16 + 13) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 13) < ' ' || ((15) * 16 + 13) == '"' || ((15) * 16 + 13) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 13) >= ('a') && ((15) * 16 + 13) <= ('z')) || (((15) * 16 + 13) >= ('A') && ((15) * 16 + 13) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 14) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 14) >= ('0') && ((15) * 16 + 14) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 14) >= ('0') && ((15) * 16 + 14) <= ('9')) || ((15) * 16 + 14) == '-' || ((15) * 16 + 14) == '+' || ((15) * 16 + 14) == '.' || ((15) * 16 + 14) == 'e' || ((15) * 16 + 14) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 14) >= ('0') && ((15) * 16 + 14) <= ('9')) || (((15) * 16 + 14) >= ('a') && ((15) * 16 + 14) <= ('f')) || (((15) * 16 + 14) >= ('A') && ((15) * 16 + 14) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 14) == '{' || ((15) * 16 + 14) == '}' || ((15) * 16 + 14) == '[' || ((15) * 16 + 14) == ']' || ((15) * 16 + 14) == ':' || ((15) * 16 + 14) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 14) < ' ' || ((15) * 16 + 14) == '"' || ((15) * 16 + 14) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 14) >= ('a') && ((15) * 16 + 14) <= ('z')) || (((15) * 16 + 14) >= ('A') && ((15) * 16 + 14) <= ('Z')) ? ST_CLASS_ALPHA : 0)), ( (((15) * 16 + 15) <= ' ' ? ST_CLASS_WHITESPACE : 0) | ((((15) * 16 + 15) >= ('0') && ((15) * 16 + 15) <= ('9')) ? ST_CLASS_DIGIT : 0) | ((((15) * 16 + 15) >= ('0') && ((15) * 16 + 15) <= ('9')) || ((15) * 16 + 15) == '-' || ((15) * 16 + 15) == '+' || ((15) * 16 + 15) == '.' || ((15) * 16 + 15) == 'e' || ((15) * 16 + 15) == 'E' ? ST_CLASS_NUMERIC : 0) | ((((15) * 16 + 15) >= ('0') && ((15) * 16 + 15) <= ('9')) || (((15) * 16 + 15) >= ('a') && ((15) * 16 + 15) <= ('f')) || (((15) * 16 + 15) >= ('A') && ((15) * 16 + 15) <= ('F')) ? ST_CLASS_HEX : 0) | (((15) * 16 + 15) == '{' || ((15) * 16 + 15) == '}' || ((15) * 16 + 15) == '[' || ((15) * 16 + 15) == ']' || ((15) * 16 + 15) == ':' || ((15) * 16 + 15) == ',' ? ST_CLASS_STRUCTURAL : 0) | (((15) * 16 + 15) < ' ' || ((15) * 16 + 15) == '"' || ((15) * 16 + 15) == '\\' ? ST_CLASS_ESCAPE : 0) | ((((15) * 16 + 15) >= ('a') && ((15) * 16 + 15) <= ('z')) || (((15) * 16 + 15) >= ('A') && ((15) * 16 + 15) <= ('Z')) ? ST_CLASS_ALPHA : 0)),
+};
+
+
+
+
+void st_char_class_init(struct StringCharClass *char_class, const unsigned int classes, const char *members) {
+  for (int i = 0; i < 256; i++) {
+    char_class->members[i] = (st_char_classes[i] & classes) != 0;
+  }
+  if (members == 
+# 49 "/root/repo/src/char_class.c" 3 4
+                ((void *)0)
+# 49 "/root/repo/src/char_class.c"
+                    ) {
+    return;
+  }
+  for (; *members != '\0'; members++) {
+    char_class->members[(unsigned char)*members] = 1;
+  }
+}
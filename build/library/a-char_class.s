@@ -0,0 +1,1164 @@
+	.file	"char_class.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/library" "/root/repo/src/char_class.c"
+	.p2align 4
+	.globl	st_char_class_init
+	.type	st_char_class_init, @function
+st_char_class_init:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/src/char_class.c"
+	.loc 1 45 110 view -0
+	.cfi_startproc
+	.loc 1 46 3 view .LVU1
+.LBB2:
+	.loc 1 46 8 view .LVU2
+	.loc 1 46 21 view .LVU3
+	vpbroadcastb	%esi, %ymm1
+.LVL1:
+	.loc 1 47 5 view .LVU4
+	.loc 1 47 50 is_stmt 0 view .LVU5
+	andl	$33, %esi
+.LVL2:
+	.loc 1 47 50 view .LVU6
+	vpbroadcastb	%esi, %xmm4
+	vpmovzxbw	%xmm4, %ymm4
+	vpxor	%xmm3, %xmm3, %xmm3
+	vpmovzxwd	%xmm4, %ymm7
+	vextracti128	$0x1, %ymm4, %xmm4
+	vpcmpeqd	%ymm3, %ymm7, %ymm7
+	vpmovzxwd	%xmm4, %ymm4
+	vpcmpeqd	%ymm3, %ymm4, %ymm4
+	movl	$1, %eax
+	vpbroadcastd	%eax, %ymm2
+	.loc 1 47 28 view .LVU7
+	vmovdqa	.LC1(%rip), %ymm5
+	vpandn	%ymm2, %ymm7, %ymm7
+	vpandn	%ymm2, %ymm4, %ymm4
+	vmovdqa	%ymm7, %ymm6
+	vmovdqa	%ymm4, %ymm0
+	vpermt2w	%ymm4, %ymm5, %ymm7
+	vmovdqa	%ymm6, %ymm4
+	vmovdqa	.LC2(%rip), %ymm6
+	vpermt2w	%ymm0, %ymm5, %ymm4
+	vmovdqa	%ymm7, %ymm0
+	vpermt2b	%ymm4, %ymm6, %ymm0
+	vmovdqu8	%ymm0, (%rdi)
+	.loc 1 46 29 is_stmt 1 view .LVU8
+	.loc 1 46 21 view .LVU9
+	.loc 1 47 5 view .LVU10
+	.loc 1 47 50 is_stmt 0 view .LVU11
+	vpand	.LC3(%rip), %ymm1, %ymm0
+	vpmovzxbw	%xmm0, %ymm4
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm4, %ymm7
+	vextracti128	$0x1, %ymm4, %xmm4
+	vpmovzxwd	%xmm0, %ymm8
+	vpmovzxwd	%xmm4, %ymm4
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpcmpeqd	%ymm3, %ymm7, %ymm7
+	vpcmpeqd	%ymm3, %ymm4, %ymm4
+	vpcmpeqd	%ymm3, %ymm8, %ymm8
+	vpmovzxwd	%xmm0, %ymm0
+	vpcmpeqd	%ymm3, %ymm0, %ymm0
+	vpandn	%ymm2, %ymm4, %ymm4
+	vpandn	%ymm2, %ymm8, %ymm8
+	vpandn	%ymm2, %ymm7, %ymm7
+	.loc 1 47 28 view .LVU12
+	vpermt2w	%ymm4, %ymm5, %ymm7
+	vpandn	%ymm2, %ymm0, %ymm0
+	vmovdqa	%ymm8, %ymm4
+	vpermt2w	%ymm0, %ymm5, %ymm4
+	vmovdqa	%ymm7, %ymm0
+	vpermt2b	%ymm4, %ymm6, %ymm0
+	vmovdqu8	%ymm0, 32(%rdi)
+	.loc 1 46 29 is_stmt 1 view .LVU13
+	.loc 1 46 21 view .LVU14
+	.loc 1 47 5 view .LVU15
+	.loc 1 47 50 is_stmt 0 view .LVU16
+	vpand	.LC4(%rip), %ymm1, %ymm0
+	vpand	.LC5(%rip), %ymm1, %ymm1
+	vpmovzxbw	%xmm0, %ymm4
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpmovzxbw	%xmm0, %ymm0
+	vpmovzxwd	%xmm4, %ymm7
+	vextracti128	$0x1, %ymm4, %xmm4
+	vpmovzxwd	%xmm0, %ymm8
+	vpmovzxwd	%xmm4, %ymm4
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpcmpeqd	%ymm3, %ymm7, %ymm7
+	vpcmpeqd	%ymm3, %ymm4, %ymm4
+	vpcmpeqd	%ymm3, %ymm8, %ymm8
+	vpmovzxwd	%xmm0, %ymm0
+	vpcmpeqd	%ymm3, %ymm0, %ymm0
+	vpandn	%ymm2, %ymm4, %ymm4
+	vpandn	%ymm2, %ymm7, %ymm7
+	vpandn	%ymm2, %ymm8, %ymm8
+	.loc 1 47 28 view .LVU17
+	vpermt2w	%ymm4, %ymm5, %ymm7
+	vpandn	%ymm2, %ymm0, %ymm0
+	vmovdqa	%ymm8, %ymm4
+	vpermt2w	%ymm0, %ymm5, %ymm4
+	vmovdqa	%ymm7, %ymm0
+	vpermt2b	%ymm4, %ymm6, %ymm0
+	vpmovzxbw	%xmm1, %ymm4
+	vextracti128	$0x1, %ymm1, %xmm1
+	vmovdqu8	%ymm0, 64(%rdi)
+	.loc 1 46 29 is_stmt 1 view .LVU18
+	.loc 1 46 21 view .LVU19
+	.loc 1 47 5 view .LVU20
+	vpmovzxbw	%xmm1, %ymm0
+	vpmovzxwd	%xmm4, %ymm7
+	vextracti128	$0x1, %ymm4, %xmm1
+	vpmovzxwd	%xmm0, %ymm4
+	vextracti128	$0x1, %ymm0, %xmm0
+	vpcmpeqd	%ymm3, %ymm7, %ymm7
+	vpmovzxwd	%xmm1, %ymm1
+	vpmovzxwd	%xmm0, %ymm0
+	vpcmpeqd	%ymm3, %ymm1, %ymm1
+	vpcmpeqd	%ymm3, %ymm4, %ymm4
+	vpcmpeqd	%ymm3, %ymm0, %ymm0
+	vpandn	%ymm2, %ymm7, %ymm7
+	vpandn	%ymm2, %ymm1, %ymm1
+	vpandn	%ymm2, %ymm0, %ymm0
+	vpandn	%ymm2, %ymm4, %ymm4
+	.loc 1 47 28 is_stmt 0 view .LVU21
+	vmovdqa	%ymm7, %ymm2
+	vpermt2w	%ymm1, %ymm5, %ymm2
+	vpermi2w	%ymm0, %ymm4, %ymm5
+	vpermi2b	%ymm5, %ymm2, %ymm6
+	vpxor	%xmm0, %xmm0, %xmm0
+	vmovdqu8	%ymm6, 96(%rdi)
+	.loc 1 46 29 is_stmt 1 view .LVU22
+	.loc 1 46 21 view .LVU23
+	.loc 1 47 5 view .LVU24
+	.loc 1 47 28 is_stmt 0 view .LVU25
+	vmovdqu8	%ymm0, 128(%rdi)
+	.loc 1 46 29 is_stmt 1 view .LVU26
+	.loc 1 46 21 view .LVU27
+	.loc 1 47 5 view .LVU28
+	.loc 1 47 28 is_stmt 0 view .LVU29
+	vmovdqu8	%ymm0, 160(%rdi)
+	.loc 1 46 29 is_stmt 1 view .LVU30
+	.loc 1 46 21 view .LVU31
+	.loc 1 47 5 view .LVU32
+	.loc 1 47 28 is_stmt 0 view .LVU33
+	vmovdqu8	%ymm0, 192(%rdi)
+	.loc 1 46 29 is_stmt 1 view .LVU34
+	.loc 1 46 21 view .LVU35
+	.loc 1 47 5 view .LVU36
+	.loc 1 47 28 is_stmt 0 view .LVU37
+	vmovdqu8	%ymm0, 224(%rdi)
+	.loc 1 46 29 is_stmt 1 view .LVU38
+	.loc 1 46 21 view .LVU39
+.LBE2:
+	.loc 1 49 3 view .LVU40
+	.loc 1 49 6 is_stmt 0 view .LVU41
+	testq	%rdx, %rdx
+	jne	.L12
+	jmp	.L11
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 53 5 is_stmt 1 discriminator 2 view .LVU42
+	.loc 1 53 50 is_stmt 0 discriminator 2 view .LVU43
+	movb	$1, (%rdi,%rax)
+	.loc 1 52 35 is_stmt 1 discriminator 2 view .LVU44
+	incq	%rdx
+.LVL3:
+.L12:
+	.loc 1 52 19 discriminator 2 view .LVU45
+	.loc 1 52 10 is_stmt 0 discriminator 2 view .LVU46
+	movzbl	(%rdx), %eax
+	.loc 1 52 19 discriminator 2 view .LVU47
+	testb	%al, %al
+	jne	.L3
+.L11:
+	.loc 1 52 19 discriminator 2 view .LVU48
+	vzeroupper
+.LVL4:
+	.loc 1 55 1 view .LVU49
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	st_char_class_init, .-st_char_class_init
+	.globl	st_char_classes
+	.section	.rodata
+	.align 32
+	.type	st_char_classes, @object
+	.size	st_char_classes, 256
+st_char_classes:
+	.string	"!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!\001"
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\020\004\004"
+	.string	"\016\016\016\016\016\016\016\016\016\016\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"HHHHLH@@@@@@@@@@@@@@@@@@@@\020 \020"
+	.string	""
+	.string	""
+	.string	"HHHHLH@@@@@@@@@@@@@@@@@@@@\020"
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC1:
+	.value	0
+	.value	2
+	.value	4
+	.value	6
+	.value	8
+	.value	10
+	.value	12
+	.value	14
+	.value	16
+	.value	18
+	.value	20
+	.value	22
+	.value	24
+	.value	26
+	.value	28
+	.value	30
+	.align 32
+.LC2:
+	.byte	0
+	.byte	2
+	.byte	4
+	.byte	6
+	.byte	8
+	.byte	10
+	.byte	12
+	.byte	14
+	.byte	16
+	.byte	18
+	.byte	20
+	.byte	22
+	.byte	24
+	.byte	26
+	.byte	28
+	.byte	30
+	.byte	32
+	.byte	34
+	.byte	36
+	.byte	38
+	.byte	40
+	.byte	42
+	.byte	44
+	.byte	46
+	.byte	48
+	.byte	50
+	.byte	52
+	.byte	54
+	.byte	56
+	.byte	58
+	.byte	60
+	.byte	62
+	.align 32
+.LC3:
+	.byte	1
+	.byte	0
+	.byte	32
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	4
+	.byte	16
+	.byte	4
+	.byte	4
+	.byte	0
+	.byte	14
+	.byte	14
+	.byte	14
+	.byte	14
+	.byte	14
+	.byte	14
+	.byte	14
+	.byte	14
+	.byte	14
+	.byte	14
+	.byte	16
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.align 32
+.LC4:
+	.byte	0
+	.byte	72
+	.byte	72
+	.byte	72
+	.byte	72
+	.byte	76
+	.byte	72
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	16
+	.byte	32
+	.byte	16
+	.byte	0
+	.byte	0
+	.align 32
+.LC5:
+	.byte	0
+	.byte	72
+	.byte	72
+	.byte	72
+	.byte	72
+	.byte	76
+	.byte	72
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	64
+	.byte	16
+	.byte	0
+	.byte	16
+	.byte	0
+	.byte	0
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/root/repo/src/../include/strutils.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1d7
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x9
+	.long	.LASF26
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	0x4f
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF4
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF5
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF6
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF7
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x3
+	.long	0x69
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x62
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0xb
+	.long	.LASF27
+	.byte	0x7
+	.byte	0x4
+	.long	0x69
+	.byte	0x4
+	.byte	0x7a
+	.byte	0x6
+	.long	0xe4
+	.uleb128 0x2
+	.long	.LASF14
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF15
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF16
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF17
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF18
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF19
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF20
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	0xa2
+	.long	0xf4
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0xff
+	.byte	0
+	.uleb128 0x3
+	.long	0xe4
+	.uleb128 0xc
+	.long	.LASF25
+	.byte	0x4
+	.byte	0xa6
+	.byte	0x16
+	.long	0xf4
+	.uleb128 0xd
+	.long	.LASF28
+	.value	0x100
+	.byte	0x4
+	.byte	0xab
+	.byte	0x8
+	.long	0x121
+	.uleb128 0xe
+	.long	.LASF24
+	.byte	0x4
+	.byte	0xb0
+	.byte	0xb
+	.long	0x121
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x96
+	.long	0x131
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0xff
+	.byte	0
+	.uleb128 0x1
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF21
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF22
+	.uleb128 0xf
+	.long	0xf9
+	.byte	0x1
+	.byte	0x23
+	.byte	0xf
+	.uleb128 0x9
+	.byte	0x3
+	.quad	st_char_classes
+	.uleb128 0x10
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x6
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d5
+	.uleb128 0x11
+	.long	.LASF30
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x31
+	.long	0x1d5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x8
+	.long	.LASF23
+	.byte	0x50
+	.long	0x70
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x8
+	.long	.LASF24
+	.byte	0x65
+	.long	0x43
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x12
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.long	0x1c9
+	.uleb128 0x13
+	.string	"i"
+	.byte	0x1
+	.byte	0x2e
+	.byte	0xc
+	.long	0x3c
+	.long	.LLST2
+	.long	.LVUS2
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL4
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	0x105
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 45
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU3
+	.uleb128 .LVU4
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF12:
+	.string	"__uint8_t"
+.LASF30:
+	.string	"char_class"
+.LASF28:
+	.string	"StringCharClass"
+.LASF27:
+	.string	"StringCharClassBits"
+.LASF25:
+	.string	"st_char_classes"
+.LASF17:
+	.string	"ST_CLASS_HEX"
+.LASF23:
+	.string	"classes"
+.LASF24:
+	.string	"members"
+.LASF29:
+	.string	"st_char_class_init"
+.LASF7:
+	.string	"unsigned char"
+.LASF20:
+	.string	"ST_CLASS_ALPHA"
+.LASF2:
+	.string	"long unsigned int"
+.LASF3:
+	.string	"short unsigned int"
+.LASF26:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF22:
+	.string	"double"
+.LASF8:
+	.string	"unsigned int"
+.LASF14:
+	.string	"ST_CLASS_WHITESPACE"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF13:
+	.string	"uint8_t"
+.LASF16:
+	.string	"ST_CLASS_NUMERIC"
+.LASF6:
+	.string	"long long int"
+.LASF4:
+	.string	"char"
+.LASF10:
+	.string	"short int"
+.LASF18:
+	.string	"ST_CLASS_STRUCTURAL"
+.LASF5:
+	.string	"long int"
+.LASF21:
+	.string	"long double"
+.LASF9:
+	.string	"signed char"
+.LASF15:
+	.string	"ST_CLASS_DIGIT"
+.LASF19:
+	.string	"ST_CLASS_ESCAPE"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/char_class.c"
+.LASF1:
+	.string	"/root/repo/build/library"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
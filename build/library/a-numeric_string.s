@@ -0,0 +1,3207 @@
+	.file	"numeric_string.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/library" "/root/repo/src/numeric_string.c"
+	.p2align 4
+	.globl	u64tos_to
+	.type	u64tos_to, @function
+u64tos_to:
+.LVL0:
+.LFB27:
+	.file 1 "/root/repo/src/numeric_string.c"
+	.loc 1 48 48 view -0
+	.cfi_startproc
+	.loc 1 49 3 view .LVU1
+.LBB6:
+.LBI6:
+	.loc 1 39 19 view .LVU2
+.LBB7:
+	.loc 1 40 3 view .LVU3
+	.loc 1 40 41 is_stmt 0 view .LVU4
+	movq	%rsi, %rax
+	orq	$1, %rax
+	.loc 1 40 7 view .LVU5
+	movl	$64, %r8d
+	.loc 1 40 19 view .LVU6
+	lzcntq	%rax, %rax
+.LVL1:
+	.loc 1 41 3 is_stmt 1 view .LVU7
+	.loc 1 40 7 is_stmt 0 view .LVU8
+	subl	%eax, %r8d
+.LVL2:
+	.loc 1 41 22 view .LVU9
+	imull	$1233, %r8d, %r8d
+.LVL3:
+	.loc 1 42 26 view .LVU10
+	leaq	numeric_string_powers_of_ten(%rip), %rax
+.LVL4:
+	.loc 1 42 26 view .LVU11
+.LBE7:
+.LBE6:
+	.loc 1 48 48 view .LVU12
+	movq	%rsi, %rcx
+.LBB9:
+.LBB8:
+	.loc 1 41 7 view .LVU13
+	sarl	$12, %r8d
+.LVL5:
+	.loc 1 42 3 is_stmt 1 view .LVU14
+	.loc 1 42 56 is_stmt 0 view .LVU15
+	movslq	%r8d, %rdx
+	.loc 1 42 26 view .LVU16
+	cmpq	(%rax,%rdx,8), %rsi
+	.loc 1 42 66 view .LVU17
+	sbbl	$-1, %r8d
+.LBE8:
+.LBE9:
+	.loc 1 49 10 view .LVU18
+	movslq	%r8d, %r8
+.LVL6:
+	.loc 1 50 3 is_stmt 1 view .LVU19
+	.loc 1 50 9 is_stmt 0 view .LVU20
+	leaq	(%rdi,%r8), %rsi
+.LVL7:
+	.loc 1 51 3 is_stmt 1 view .LVU21
+	.loc 1 51 6 is_stmt 0 view .LVU22
+	movb	$0, (%rsi)
+	.loc 1 53 3 is_stmt 1 view .LVU23
+	.loc 1 53 16 view .LVU24
+	cmpq	$99, %rcx
+	jbe	.L2
+	leaq	numeric_string_digit_pairs(%rip), %r10
+.LBB10:
+	.loc 1 54 60 is_stmt 0 view .LVU25
+	movabsq	$2951479051793528259, %r9
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 54 5 is_stmt 1 view .LVU26
+	.loc 1 54 60 is_stmt 0 view .LVU27
+	movq	%rcx, %rdx
+	shrq	$2, %rdx
+	movq	%rdx, %rax
+	mulq	%r9
+	movq	%rcx, %rax
+	.loc 1 57 10 view .LVU28
+	subq	$2, %rsi
+.LVL9:
+	.loc 1 54 60 view .LVU29
+	shrq	$2, %rdx
+	imulq	$100, %rdx, %rdi
+	subq	%rdi, %rax
+	.loc 1 54 17 view .LVU30
+	leaq	(%r10,%rax,2), %rax
+.LVL10:
+	.loc 1 55 5 is_stmt 1 view .LVU31
+	movq	%rcx, %rdi
+	.loc 1 55 11 is_stmt 0 view .LVU32
+	movq	%rdx, %rcx
+.LVL11:
+	.loc 1 56 5 is_stmt 1 view .LVU33
+	.loc 1 56 16 is_stmt 0 view .LVU34
+	movzbl	1(%rax), %edx
+.LVL12:
+	.loc 1 56 10 view .LVU35
+	movb	%dl, 1(%rsi)
+	.loc 1 57 5 is_stmt 1 view .LVU36
+.LVL13:
+	.loc 1 57 16 is_stmt 0 view .LVU37
+	movzbl	(%rax), %eax
+.LVL14:
+	.loc 1 57 10 view .LVU38
+	movb	%al, (%rsi)
+	.loc 1 57 10 view .LVU39
+.LBE10:
+	.loc 1 53 16 is_stmt 1 view .LVU40
+	cmpq	$9999, %rdi
+	ja	.L3
+.LVL15:
+.L2:
+	.loc 1 59 3 view .LVU41
+	.loc 1 59 6 is_stmt 0 view .LVU42
+	cmpq	$9, %rcx
+	jbe	.L4
+.LBB11:
+	.loc 1 60 5 is_stmt 1 view .LVU43
+	.loc 1 60 17 is_stmt 0 view .LVU44
+	leaq	numeric_string_digit_pairs(%rip), %rax
+	leaq	(%rax,%rcx,2), %rax
+.LVL16:
+	.loc 1 61 5 is_stmt 1 view .LVU45
+	.loc 1 61 16 is_stmt 0 view .LVU46
+	movzbl	1(%rax), %edx
+	.loc 1 61 10 view .LVU47
+	movb	%dl, -1(%rsi)
+	.loc 1 62 5 is_stmt 1 view .LVU48
+.LVL17:
+	.loc 1 62 16 is_stmt 0 view .LVU49
+	movzbl	(%rax), %eax
+.LVL18:
+	.loc 1 62 10 view .LVU50
+	movb	%al, -2(%rsi)
+.LBE11:
+	.loc 1 68 1 view .LVU51
+	movq	%r8, %rax
+	ret
+.LVL19:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 1 65 5 is_stmt 1 view .LVU52
+	.loc 1 65 23 is_stmt 0 view .LVU53
+	addl	$48, %ecx
+	movb	%cl, -1(%rsi)
+	.loc 1 67 3 is_stmt 1 view .LVU54
+	.loc 1 68 1 is_stmt 0 view .LVU55
+	movq	%r8, %rax
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	u64tos_to, .-u64tos_to
+	.p2align 4
+	.globl	i64tos_to
+	.type	i64tos_to, @function
+i64tos_to:
+.LVL20:
+.LFB28:
+	.loc 1 73 47 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 74 3 view .LVU57
+	.loc 1 74 6 is_stmt 0 view .LVU58
+	testq	%rsi, %rsi
+	js	.L12
+	.loc 1 79 3 is_stmt 1 view .LVU59
+	.loc 1 79 10 is_stmt 0 view .LVU60
+	jmp	u64tos_to@PLT
+.LVL21:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+.LBB14:
+.LBI14:
+	.loc 1 73 8 is_stmt 1 view .LVU61
+.LBB15:
+	.loc 1 75 5 view .LVU62
+.LBE15:
+.LBE14:
+	.loc 1 73 47 is_stmt 0 view .LVU63
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB17:
+.LBB16:
+	.loc 1 75 15 view .LVU64
+	movb	$45, (%rdi)
+	.loc 1 77 5 is_stmt 1 view .LVU65
+	.loc 1 77 12 is_stmt 0 view .LVU66
+	negq	%rsi
+.LVL22:
+	.loc 1 77 12 view .LVU67
+	incq	%rdi
+.LVL23:
+	.loc 1 77 12 view .LVU68
+	call	u64tos_to@PLT
+.LVL24:
+	.loc 1 77 55 view .LVU69
+	incq	%rax
+.LVL25:
+	.loc 1 77 55 view .LVU70
+.LBE16:
+.LBE17:
+	.loc 1 80 1 view .LVU71
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	i64tos_to, .-i64tos_to
+	.p2align 4
+	.globl	i64tos_batch
+	.type	i64tos_batch, @function
+i64tos_batch:
+.LVL26:
+.LFB29:
+	.loc 1 85 95 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 86 3 view .LVU73
+	.loc 1 87 3 view .LVU74
+	.loc 1 85 95 is_stmt 0 view .LVU75
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rcx, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 87 13 view .LVU76
+	movb	$0, (%rdi)
+	.loc 1 88 3 is_stmt 1 view .LVU77
+.LBB18:
+	.loc 1 88 8 view .LVU78
+.LVL27:
+	.loc 1 88 24 view .LVU79
+	testq	%rdx, %rdx
+	je	.L16
+	movq	%rdi, %r13
+	movq	%rsi, %r14
+	.loc 1 88 15 is_stmt 0 view .LVU80
+	xorl	%ebp, %ebp
+.LBE18:
+	.loc 1 86 10 view .LVU81
+	xorl	%ebx, %ebx
+	testq	%rcx, %rcx
+	je	.L18
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+.LBB19:
+	.loc 1 89 5 is_stmt 1 view .LVU82
+	.loc 1 90 7 view .LVU83
+	.loc 1 90 18 is_stmt 0 view .LVU84
+	movq	%rbx, (%r15,%rbp,8)
+	.loc 1 93 5 is_stmt 1 view .LVU85
+	.loc 1 93 15 is_stmt 0 view .LVU86
+	leaq	0(%r13,%rbx), %rdi
+	movq	(%r14,%rbp,8), %rsi
+	.loc 1 88 34 view .LVU87
+	incq	%rbp
+.LVL29:
+	.loc 1 93 15 view .LVU88
+	call	i64tos_to@PLT
+.LVL30:
+	.loc 1 93 12 view .LVU89
+	addq	%rax, %rbx
+.LVL31:
+	.loc 1 88 34 is_stmt 1 view .LVU90
+	.loc 1 88 24 view .LVU91
+	cmpq	%rbp, %r12
+	jne	.L17
+.LVL32:
+.L20:
+	.loc 1 88 24 is_stmt 0 view .LVU92
+.LBE19:
+	.loc 1 96 5 is_stmt 1 view .LVU93
+	.loc 1 96 20 is_stmt 0 view .LVU94
+	movq	%rbx, (%r15,%r12,8)
+.L15:
+	.loc 1 99 1 view .LVU95
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL33:
+	.loc 1 99 1 view .LVU96
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL34:
+	.loc 1 99 1 view .LVU97
+	ret
+.LVL35:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.cfi_restore_state
+.LBB20:
+	.loc 1 89 5 is_stmt 1 view .LVU98
+	.loc 1 93 5 view .LVU99
+	.loc 1 93 15 is_stmt 0 view .LVU100
+	movq	(%r14,%rbp,8), %rsi
+	leaq	0(%r13,%rbx), %rdi
+	call	i64tos_to@PLT
+.LVL36:
+	.loc 1 88 34 view .LVU101
+	incq	%rbp
+.LVL37:
+	.loc 1 93 12 view .LVU102
+	addq	%rax, %rbx
+.LVL38:
+	.loc 1 88 34 is_stmt 1 view .LVU103
+	.loc 1 88 24 view .LVU104
+	cmpq	%rbp, %r12
+	jne	.L18
+	jmp	.L15
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 88 24 is_stmt 0 view .LVU105
+.LBE20:
+	.loc 1 95 3 is_stmt 1 view .LVU106
+	.loc 1 86 10 is_stmt 0 view .LVU107
+	xorl	%ebx, %ebx
+	.loc 1 95 6 view .LVU108
+	testq	%rcx, %rcx
+	jne	.L20
+	jmp	.L15
+	.cfi_endproc
+.LFE29:
+	.size	i64tos_batch, .-i64tos_batch
+	.p2align 4
+	.globl	itos_to
+	.type	itos_to, @function
+itos_to:
+.LVL40:
+.LFB30:
+	.loc 1 104 41 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 105 3 view .LVU110
+	.loc 1 105 10 is_stmt 0 view .LVU111
+	movslq	%esi, %rsi
+	.loc 1 105 10 view .LVU112
+	jmp	i64tos_to@PLT
+.LVL41:
+	.loc 1 105 10 view .LVU113
+	.cfi_endproc
+.LFE30:
+	.size	itos_to, .-itos_to
+	.p2align 4
+	.globl	itos
+	.type	itos, @function
+itos:
+.LVL42:
+.LFB31:
+	.loc 1 111 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 113 3 view .LVU115
+	.loc 1 114 3 view .LVU116
+	.loc 1 115 3 view .LVU117
+	.loc 1 111 23 is_stmt 0 view .LVU118
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%edi, %esi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 115 19 view .LVU119
+	movq	%rsp, %rbp
+	movq	%rbp, %rdi
+.LVL43:
+	.loc 1 115 19 view .LVU120
+	call	itos_to@PLT
+.LVL44:
+	.loc 1 116 3 is_stmt 1 view .LVU121
+	.loc 1 116 6 view .LVU122
+	.loc 1 117 3 view .LVU123
+	.loc 1 117 23 is_stmt 0 view .LVU124
+	leaq	1(%rax), %rbx
+	movq	%rbx, %rdi
+	call	malloc@PLT
+.LVL45:
+	.loc 1 117 23 view .LVU125
+	movq	%rax, %rcx
+.LVL46:
+	.loc 1 118 3 is_stmt 1 view .LVU126
+	.loc 1 118 8 view .LVU127
+	.loc 1 118 6 view .LVU128
+	.loc 1 119 3 view .LVU129
+	.loc 1 119 6 is_stmt 0 view .LVU130
+	testq	%rax, %rax
+	je	.L28
+	.loc 1 122 3 is_stmt 1 view .LVU131
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.LVL47:
+	.loc 1 122 3 is_stmt 0 view .LVU132
+	movq	%rax, %rcx
+	.loc 1 123 3 is_stmt 1 view .LVU133
+.L28:
+	.loc 1 124 1 is_stmt 0 view .LVU134
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL48:
+	.loc 1 124 1 view .LVU135
+	movq	%rcx, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	itos, .-itos
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"%.*Lf"
+	.text
+	.p2align 4
+	.globl	ldtos
+	.type	ldtos, @function
+ldtos:
+.LVL49:
+.LFB32:
+	.loc 1 129 32 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 131 3 view .LVU137
+	.loc 1 132 3 view .LVU138
+	.loc 1 133 3 view .LVU139
+	.loc 1 134 3 view .LVU140
+	.loc 1 129 32 is_stmt 0 view .LVU141
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$360, %rsp
+	.cfi_def_cfa_offset 384
+	.loc 1 129 32 view .LVU142
+	fldt	384(%rsp)
+	.loc 1 136 14 view .LVU143
+	leaq	16(%rsp), %rbp
+	.loc 1 134 20 view .LVU144
+	fstl	8(%rsp)
+	.loc 1 134 7 view .LVU145
+	fldl	8(%rsp)
+	.loc 1 134 6 view .LVU146
+	fucomip	%st(1), %st
+	jp	.L35
+	jne	.L35
+	fstp	%st(0)
+	.loc 1 136 5 is_stmt 1 view .LVU147
+	.loc 1 136 14 is_stmt 0 view .LVU148
+	vmovsd	8(%rsp), %xmm0
+	movl	$13, %esi
+	movq	%rbp, %rdi
+	call	dtos_fixed_to@PLT
+.LVL50:
+.L37:
+	.loc 1 142 3 is_stmt 1 view .LVU149
+	.loc 1 142 6 view .LVU150
+	.loc 1 143 3 view .LVU151
+	.loc 1 143 23 is_stmt 0 view .LVU152
+	leaq	1(%rax), %rbx
+	movq	%rbx, %rdi
+	call	malloc@PLT
+.LVL51:
+	.loc 1 143 23 view .LVU153
+	movq	%rax, %rcx
+.LVL52:
+	.loc 1 144 3 is_stmt 1 view .LVU154
+	.loc 1 144 8 view .LVU155
+	.loc 1 144 6 view .LVU156
+	.loc 1 145 3 view .LVU157
+	.loc 1 145 6 is_stmt 0 view .LVU158
+	testq	%rax, %rax
+	je	.L34
+	.loc 1 148 3 is_stmt 1 view .LVU159
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.LVL53:
+	.loc 1 148 3 is_stmt 0 view .LVU160
+	movq	%rax, %rcx
+	.loc 1 149 3 is_stmt 1 view .LVU161
+.L34:
+	.loc 1 150 1 is_stmt 0 view .LVU162
+	addq	$360, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL54:
+	.loc 1 150 1 view .LVU163
+	movq	%rcx, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL55:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.cfi_restore_state
+	.loc 1 139 5 is_stmt 1 view .LVU164
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 400
+	movl	$13, %ecx
+	leaq	.LC0(%rip), %rdx
+	movl	$100, %esi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	fstpt	(%rsp)
+	call	snprintf@PLT
+.LVL56:
+	.loc 1 140 5 view .LVU165
+	.loc 1 140 14 is_stmt 0 view .LVU166
+	movq	%rbp, %rdi
+	call	strlen@PLT
+.LVL57:
+	.loc 1 140 14 view .LVU167
+	popq	%rdx
+	.cfi_def_cfa_offset 392
+	popq	%rcx
+	.cfi_def_cfa_offset 384
+	jmp	.L37
+	.cfi_endproc
+.LFE32:
+	.size	ldtos, .-ldtos
+	.p2align 4
+	.globl	stold
+	.type	stold, @function
+stold:
+.LVL58:
+.LFB33:
+	.loc 1 155 47 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 156 3 view .LVU169
+	.loc 1 157 2 view .LVU170
+	.loc 1 155 47 is_stmt 0 view .LVU171
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 157 4 view .LVU172
+	call	__errno_location@PLT
+.LVL59:
+	.loc 1 157 8 view .LVU173
+	movl	$0, (%rax)
+	.loc 1 158 3 is_stmt 1 view .LVU174
+.LVL60:
+	.loc 1 159 3 view .LVU175
+	.loc 1 157 4 is_stmt 0 view .LVU176
+	movq	%rax, %rbx
+	.loc 1 159 23 view .LVU177
+	leaq	8(%rsp), %rsi
+	movq	%rbp, %rdi
+	call	strtold@PLT
+.LVL61:
+	.loc 1 160 3 is_stmt 1 view .LVU178
+	.loc 1 160 6 view .LVU179
+	.loc 1 162 3 view .LVU180
+	.loc 1 162 6 is_stmt 0 view .LVU181
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	jne	.L49
+	.loc 1 165 3 is_stmt 1 view .LVU182
+	.loc 1 165 7 is_stmt 0 view .LVU183
+	movq	8(%rsp), %rax
+	.loc 1 165 6 view .LVU184
+	cmpb	$0, (%rax)
+	jne	.L48
+	.loc 1 170 1 view .LVU185
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL62:
+	.loc 1 170 1 view .LVU186
+	ret
+.LVL63:
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	.cfi_restore_state
+	.loc 1 170 1 view .LVU187
+	fstp	%st(0)
+	.loc 1 166 4 is_stmt 1 view .LVU188
+	.loc 1 166 10 is_stmt 0 view .LVU189
+	movl	$22, (%rbx)
+	.loc 1 167 5 is_stmt 1 view .LVU190
+	.loc 1 167 12 is_stmt 0 view .LVU191
+	jmp	.L45
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.loc 1 167 12 view .LVU192
+	fstp	%st(0)
+.L45:
+	.loc 1 170 1 view .LVU193
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	.loc 1 163 12 view .LVU194
+	fldz
+.LVL64:
+	.loc 1 170 1 view .LVU195
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL65:
+	.loc 1 170 1 view .LVU196
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	stold, .-stold
+	.section	.rodata
+	.align 32
+	.type	numeric_string_powers_of_ten, @object
+	.size	numeric_string_powers_of_ten, 160
+numeric_string_powers_of_ten:
+	.quad	0
+	.quad	10
+	.quad	100
+	.quad	1000
+	.quad	10000
+	.quad	100000
+	.quad	1000000
+	.quad	10000000
+	.quad	100000000
+	.quad	1000000000
+	.quad	10000000000
+	.quad	100000000000
+	.quad	1000000000000
+	.quad	10000000000000
+	.quad	100000000000000
+	.quad	1000000000000000
+	.quad	10000000000000000
+	.quad	100000000000000000
+	.quad	1000000000000000000
+	.quad	-8446744073709551616
+	.align 32
+	.type	numeric_string_digit_pairs, @object
+	.size	numeric_string_digit_pairs, 201
+numeric_string_digit_pairs:
+	.string	"00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899"
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/usr/include/stdlib.h"
+	.file 7 "/usr/include/string.h"
+	.file 8 "/usr/include/stdio.h"
+	.file 9 "/root/repo/src/../include/strutils.h"
+	.file 10 "/usr/include/errno.h"
+	.file 11 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7d2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF46
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0xa
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x5
+	.long	0x35
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x1c
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x85
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0xa
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x6
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x5
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF14
+	.uleb128 0xa
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x13
+	.long	0x79
+	.uleb128 0x5
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF16
+	.uleb128 0x6
+	.long	0xcd
+	.uleb128 0x1e
+	.uleb128 0x6
+	.long	0xa4
+	.uleb128 0x14
+	.long	0xce
+	.uleb128 0xa
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8c
+	.uleb128 0x5
+	.long	0xd8
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF18
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x6
+	.long	0x35
+	.uleb128 0xe
+	.long	0xa4
+	.long	0x10a
+	.uleb128 0x11
+	.long	0x46
+	.byte	0xc8
+	.byte	0
+	.uleb128 0x5
+	.long	0xfa
+	.uleb128 0xb
+	.long	.LASF19
+	.byte	0xd
+	.byte	0x13
+	.long	0x10a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numeric_string_digit_pairs
+	.uleb128 0xe
+	.long	0xe4
+	.long	0x134
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0x124
+	.uleb128 0xb
+	.long	.LASF20
+	.byte	0x14
+	.byte	0x17
+	.long	0x134
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numeric_string_powers_of_ten
+	.uleb128 0x15
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x7f
+	.byte	0x14
+	.long	0xe9
+	.long	0x169
+	.uleb128 0x2
+	.long	0xd3
+	.uleb128 0x2
+	.long	0x16e
+	.byte	0
+	.uleb128 0x6
+	.long	0x98
+	.uleb128 0x14
+	.long	0x169
+	.uleb128 0x1f
+	.long	.LASF47
+	.byte	0xa
+	.byte	0x25
+	.byte	0xd
+	.long	0x17f
+	.uleb128 0x6
+	.long	0x72
+	.uleb128 0xf
+	.long	.LASF22
+	.byte	0x7
+	.value	0x197
+	.byte	0xf
+	.long	0x35
+	.long	0x19b
+	.uleb128 0x2
+	.long	0xce
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF23
+	.byte	0x8
+	.value	0x17a
+	.byte	0xc
+	.long	0x72
+	.long	0x1bd
+	.uleb128 0x2
+	.long	0x98
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0xce
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF24
+	.byte	0x9
+	.value	0x673
+	.byte	0x8
+	.long	0x35
+	.long	0x1de
+	.uleb128 0x2
+	.long	0x98
+	.uleb128 0x2
+	.long	0xf0
+	.uleb128 0x2
+	.long	0x72
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF25
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xe
+	.long	0x54
+	.long	0x1fe
+	.uleb128 0x2
+	.long	0x54
+	.uleb128 0x2
+	.long	0xc8
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF26
+	.byte	0x6
+	.value	0x229
+	.byte	0xe
+	.long	0x54
+	.long	0x215
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF29
+	.byte	0x9b
+	.byte	0xd
+	.long	0xe9
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x29c
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x9b
+	.byte	0x1f
+	.long	0xce
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xb
+	.long	.LASF27
+	.byte	0x9c
+	.byte	0x9
+	.long	0x98
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x12
+	.long	.LASF28
+	.byte	0x9e
+	.long	0xd8
+	.uleb128 0x7
+	.long	.LASF32
+	.byte	0x9f
+	.byte	0xf
+	.long	0xe9
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x21
+	.quad	.LVL59
+	.long	0x173
+	.uleb128 0xc
+	.quad	.LVL61
+	.long	0x14e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF30
+	.byte	0x81
+	.byte	0x7
+	.long	0x98
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ad
+	.uleb128 0x22
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x81
+	.byte	0x19
+	.long	0xe9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0xb
+	.long	.LASF31
+	.byte	0x83
+	.byte	0x8
+	.long	0x3ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x7
+	.long	.LASF33
+	.byte	0x84
+	.byte	0xa
+	.long	0x35
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x12
+	.long	.LASF28
+	.byte	0x85
+	.long	0xd8
+	.uleb128 0x10
+	.string	"str"
+	.byte	0x8f
+	.byte	0x9
+	.long	0x98
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x8
+	.quad	.LVL50
+	.long	0x1bd
+	.long	0x332
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -376
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3d
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL51
+	.long	0x1fe
+	.long	0x34a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL53
+	.long	0x7ca
+	.long	0x368
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL56
+	.long	0x19b
+	.long	0x398
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x3d
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL57
+	.long	0x184
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x9d
+	.long	0x3be
+	.uleb128 0x23
+	.long	0x46
+	.value	0x14b
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF34
+	.byte	0x6f
+	.byte	0x7
+	.long	0x98
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x482
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x6f
+	.byte	0x10
+	.long	0x72
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xb
+	.long	.LASF31
+	.byte	0x71
+	.byte	0x8
+	.long	0x482
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x12
+	.long	.LASF28
+	.byte	0x72
+	.long	0xd8
+	.uleb128 0x7
+	.long	.LASF33
+	.byte	0x73
+	.byte	0xa
+	.long	0x35
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x10
+	.string	"str"
+	.byte	0x75
+	.byte	0x9
+	.long	0x98
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x8
+	.quad	.LVL44
+	.long	0x492
+	.long	0x44f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL45
+	.long	0x1fe
+	.long	0x467
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL47
+	.long	0x7ca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x9d
+	.long	0x492
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x14
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF36
+	.byte	0x68
+	.byte	0x8
+	.long	0x35
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4fc
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x68
+	.byte	0x16
+	.long	0x98
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x68
+	.byte	0x22
+	.long	0x72
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x16
+	.quad	.LVL41
+	.long	0x5cb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF37
+	.byte	0x55
+	.byte	0x8
+	.long	0x35
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5c6
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x55
+	.byte	0x1b
+	.long	0x98
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0x55
+	.byte	0x32
+	.long	0x5c6
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x4
+	.long	.LASF39
+	.byte	0x55
+	.byte	0x47
+	.long	0x41
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x55
+	.byte	0x56
+	.long	0xf5
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x7
+	.long	.LASF33
+	.byte	0x56
+	.byte	0xa
+	.long	0x35
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x17
+	.long	.LLRL20
+	.uleb128 0x10
+	.string	"i"
+	.byte	0x58
+	.byte	0xf
+	.long	0x35
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x8
+	.quad	.LVL30
+	.long	0x5cb
+	.long	0x5ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL36
+	.long	0x5cb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xbc
+	.uleb128 0x24
+	.long	.LASF41
+	.byte	0x1
+	.byte	0x49
+	.byte	0x8
+	.long	0x35
+	.byte	0x1
+	.long	0x5f3
+	.uleb128 0x13
+	.long	.LASF31
+	.byte	0x49
+	.byte	0x18
+	.long	0x98
+	.uleb128 0x13
+	.long	.LASF32
+	.byte	0x49
+	.byte	0x28
+	.long	0xb0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF42
+	.byte	0x30
+	.byte	0x8
+	.long	0x35
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6f4
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x30
+	.byte	0x18
+	.long	0x98
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x30
+	.byte	0x29
+	.long	0xd8
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x7
+	.long	.LASF33
+	.byte	0x31
+	.byte	0xa
+	.long	0x35
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x10
+	.string	"p"
+	.byte	0x32
+	.byte	0x9
+	.long	0x98
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x18
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.long	0x687
+	.uleb128 0x7
+	.long	.LASF43
+	.byte	0x36
+	.byte	0x11
+	.long	0xce
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.uleb128 0x18
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.long	0x6b0
+	.uleb128 0x7
+	.long	.LASF43
+	.byte	0x3c
+	.byte	0x11
+	.long	0xce
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0x25
+	.long	0x6f4
+	.quad	.LBI6
+	.byte	.LVU2
+	.long	.LLRL4
+	.byte	0x1
+	.byte	0x31
+	.byte	0x13
+	.uleb128 0xd
+	.long	0x705
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x17
+	.long	.LLRL4
+	.uleb128 0x19
+	.long	0x710
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x19
+	.long	0x71a
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF48
+	.byte	0x1
+	.byte	0x27
+	.byte	0x13
+	.long	0x72
+	.byte	0x3
+	.long	0x725
+	.uleb128 0x13
+	.long	.LASF32
+	.byte	0x27
+	.byte	0x38
+	.long	0xd8
+	.uleb128 0x1a
+	.long	.LASF44
+	.byte	0x28
+	.long	0x72
+	.uleb128 0x1a
+	.long	.LASF45
+	.byte	0x29
+	.long	0x72
+	.byte	0
+	.uleb128 0x27
+	.long	0x5cb
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7ca
+	.uleb128 0xd
+	.long	0x5dc
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xd
+	.long	0x5e7
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x28
+	.long	0x5cb
+	.quad	.LBI14
+	.byte	.LVU61
+	.long	.LLRL12
+	.byte	0x1
+	.byte	0x49
+	.byte	0x8
+	.long	0x7ad
+	.uleb128 0xd
+	.long	0x5e7
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xd
+	.long	0x5dc
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xc
+	.quad	.LVL24
+	.long	0x5f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1f
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL21
+	.long	0x5f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF25
+	.long	.LASF49
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL59-1-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU178
+	.uleb128 .LVU195
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x21
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU149
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU163
+	.uleb128 .LVU167
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU154
+	.uleb128 .LVU160
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL44-1-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU121
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU135
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU126
+	.uleb128 .LVU132
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU74
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU92
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU79
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU92
+	.uleb128 .LVU98
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU41
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU21
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU34
+	.uleb128 .LVU37
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU31
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU41
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0xe
+	.byte	0x75
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x64
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x24
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU45
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU52
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0xf
+	.byte	0x72
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	numeric_string_digit_pairs
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU2
+	.uleb128 .LVU15
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU7
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU15
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x40
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x40
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2c
+	.byte	0x8
+	.byte	0x40
+	.byte	0x74
+	.sleb128 0
+	.byte	0x31
+	.byte	0x21
+	.byte	0x12
+	.byte	0x28
+	.value	0x6
+	.byte	0x13
+	.byte	0x8
+	.byte	0x40
+	.byte	0x2f
+	.value	0x1a
+	.byte	0x30
+	.byte	0x16
+	.byte	0x12
+	.byte	0xe
+	.quad	0x8000000000000000
+	.byte	0x1a
+	.byte	0x28
+	.value	0x9
+	.byte	0x31
+	.byte	0x24
+	.byte	0x16
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x16
+	.byte	0x2f
+	.value	0xffe9
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU14
+	.uleb128 .LVU15
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x4
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU61
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU70
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x4
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU61
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU70
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF27:
+	.string	"endptr"
+.LASF15:
+	.string	"int64_t"
+.LASF9:
+	.string	"size_t"
+.LASF32:
+	.string	"value"
+.LASF39:
+	.string	"count"
+.LASF28:
+	.string	"start"
+.LASF30:
+	.string	"ldtos"
+.LASF24:
+	.string	"dtos_fixed_to"
+.LASF43:
+	.string	"pair"
+.LASF4:
+	.string	"unsigned int"
+.LASF17:
+	.string	"uint64_t"
+.LASF19:
+	.string	"numeric_string_digit_pairs"
+.LASF7:
+	.string	"signed char"
+.LASF5:
+	.string	"unsigned char"
+.LASF20:
+	.string	"numeric_string_powers_of_ten"
+.LASF3:
+	.string	"long unsigned int"
+.LASF6:
+	.string	"short unsigned int"
+.LASF23:
+	.string	"snprintf"
+.LASF34:
+	.string	"itos"
+.LASF10:
+	.string	"__int64_t"
+.LASF2:
+	.string	"double"
+.LASF48:
+	.string	"numeric_string_count_digits"
+.LASF22:
+	.string	"strlen"
+.LASF21:
+	.string	"strtold"
+.LASF42:
+	.string	"u64tos_to"
+.LASF16:
+	.string	"long long unsigned int"
+.LASF36:
+	.string	"itos_to"
+.LASF49:
+	.string	"__builtin_memcpy"
+.LASF40:
+	.string	"offsets"
+.LASF37:
+	.string	"i64tos_batch"
+.LASF29:
+	.string	"stold"
+.LASF14:
+	.string	"long long int"
+.LASF46:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF13:
+	.string	"char"
+.LASF38:
+	.string	"values"
+.LASF35:
+	.string	"numeric_string"
+.LASF44:
+	.string	"bits"
+.LASF45:
+	.string	"digits"
+.LASF25:
+	.string	"memcpy"
+.LASF8:
+	.string	"short int"
+.LASF31:
+	.string	"buffer"
+.LASF33:
+	.string	"length"
+.LASF11:
+	.string	"long int"
+.LASF12:
+	.string	"__uint64_t"
+.LASF18:
+	.string	"long double"
+.LASF47:
+	.string	"__errno_location"
+.LASF41:
+	.string	"i64tos_to"
+.LASF26:
+	.string	"malloc"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/library"
+.LASF0:
+	.string	"/root/repo/src/numeric_string.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,15724 @@
+	.file	"string_tokenizer.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/library" "/root/repo/src/string_tokenizer.c"
+	.p2align 4
+	.globl	st_init
+	.type	st_init, @function
+st_init:
+.LVL0:
+.LFB27:
+	.file 1 "/root/repo/src/string_tokenizer.c"
+	.loc 1 34 84 view -0
+	.cfi_startproc
+	.loc 1 35 3 view .LVU1
+	.loc 1 35 21 is_stmt 0 view .LVU2
+	movq	%rsi, (%rdi)
+	.loc 1 36 3 is_stmt 1 view .LVU3
+	.loc 1 36 21 is_stmt 0 view .LVU4
+	movq	%rdx, 8(%rdi)
+	.loc 1 37 3 is_stmt 1 view .LVU5
+	.loc 1 37 23 is_stmt 0 view .LVU6
+	movq	$0, 16(%rdi)
+	.loc 1 38 3 is_stmt 1 view .LVU7
+	.loc 1 38 33 is_stmt 0 view .LVU8
+	movq	$0, 24(%rdi)
+	.loc 1 39 3 is_stmt 1 view .LVU9
+	.loc 1 39 28 is_stmt 0 view .LVU10
+	movl	$0, 32(%rdi)
+	.loc 1 40 3 is_stmt 1 view .LVU11
+	.loc 1 40 28 is_stmt 0 view .LVU12
+	movq	$0, 40(%rdi)
+	.loc 1 41 3 is_stmt 1 view .LVU13
+	.loc 1 41 21 is_stmt 0 view .LVU14
+	movq	$0, 48(%rdi)
+	.loc 1 42 3 is_stmt 1 view .LVU15
+	.loc 1 42 24 is_stmt 0 view .LVU16
+	movl	$0, 56(%rdi)
+	.loc 1 43 3 is_stmt 1 view .LVU17
+	.loc 1 43 20 is_stmt 0 view .LVU18
+	movq	$0, 64(%rdi)
+	.loc 1 44 3 is_stmt 1 view .LVU19
+	.loc 1 44 31 is_stmt 0 view .LVU20
+	movq	$0, 328(%rdi)
+	.loc 1 45 3 is_stmt 1 view .LVU21
+	.loc 1 45 20 is_stmt 0 view .LVU22
+	movq	$0, 336(%rdi)
+	.loc 1 46 1 view .LVU23
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	st_init, .-st_init
+	.p2align 4
+	.globl	st_create_n
+	.type	st_create_n, @function
+st_create_n:
+.LVL1:
+.LFB28:
+	.loc 1 51 72 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 52 3 view .LVU25
+	.loc 1 51 72 is_stmt 0 view .LVU26
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 52 6 view .LVU27
+	testq	%rdi, %rdi
+	je	.L7
+	movq	%rsi, %r12
+	testq	%rsi, %rsi
+	je	.L7
+	movq	%rdi, %rbp
+	.loc 1 55 3 is_stmt 1 view .LVU28
+.LVL2:
+	.loc 1 56 3 view .LVU29
+	.loc 1 56 65 is_stmt 0 view .LVU30
+	movl	$344, %edi
+.LVL3:
+	.loc 1 56 65 view .LVU31
+	call	malloc@PLT
+.LVL4:
+	.loc 1 56 65 view .LVU32
+	movq	%rax, %rbx
+.LVL5:
+	.loc 1 57 3 is_stmt 1 view .LVU33
+	.loc 1 57 8 view .LVU34
+	.loc 1 57 6 view .LVU35
+	.loc 1 58 3 view .LVU36
+	.loc 1 58 6 is_stmt 0 view .LVU37
+	testq	%rax, %rax
+	je	.L7
+	.loc 1 59 5 is_stmt 1 view .LVU38
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	st_init@PLT
+.LVL6:
+	.loc 1 62 1 is_stmt 0 view .LVU39
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL7:
+	.loc 1 62 1 view .LVU40
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL8:
+	.loc 1 62 1 view .LVU41
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL9:
+	.loc 1 62 1 view .LVU42
+	ret
+.LVL10:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.cfi_restore_state
+	.loc 1 53 11 view .LVU43
+	xorl	%ebx, %ebx
+	.loc 1 62 1 view .LVU44
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	st_create_n, .-st_create_n
+	.p2align 4
+	.globl	st_create
+	.type	st_create, @function
+st_create:
+.LVL11:
+.LFB26:
+	.loc 1 24 49 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 25 3 view .LVU46
+	.loc 1 25 6 is_stmt 0 view .LVU47
+	testq	%rdi, %rdi
+	je	.L13
+	.loc 1 24 49 view .LVU48
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 28 3 is_stmt 1 view .LVU49
+	.loc 1 28 10 is_stmt 0 view .LVU50
+	call	strlen@PLT
+.LVL12:
+	.loc 1 28 10 view .LVU51
+	movq	%rax, %rsi
+	movq	%rbx, %rdi
+	.loc 1 29 1 view .LVU52
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL13:
+	.loc 1 28 10 view .LVU53
+	jmp	st_create_n@PLT
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 29 1 view .LVU54
+	xorl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	st_create, .-st_create
+	.p2align 4
+	.globl	st_create_empty
+	.type	st_create_empty, @function
+st_create_empty:
+.LVL15:
+.LFB29:
+	.loc 1 67 67 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 68 3 view .LVU56
+	.loc 1 67 67 is_stmt 0 view .LVU57
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 68 23 view .LVU58
+	leaq	-1(%rdi), %rax
+	.loc 1 67 67 view .LVU59
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 68 6 view .LVU60
+	cmpq	$254, %rax
+	jbe	.L29
+	.loc 1 81 3 is_stmt 1 view .LVU61
+	.loc 1 81 26 is_stmt 0 view .LVU62
+	leaq	1(%rdi), %rdi
+.LVL16:
+	.loc 1 81 26 view .LVU63
+	call	malloc@PLT
+.LVL17:
+	movq	%rax, %rbp
+.LVL18:
+	.loc 1 82 3 is_stmt 1 view .LVU64
+	.loc 1 82 8 view .LVU65
+	.loc 1 82 6 view .LVU66
+	.loc 1 83 3 view .LVU67
+	.loc 1 83 6 is_stmt 0 view .LVU68
+	testq	%rax, %rax
+	je	.L19
+	.loc 1 87 3 is_stmt 1 view .LVU69
+	.loc 1 87 13 is_stmt 0 view .LVU70
+	movb	$0, (%rax)
+	.loc 1 88 3 is_stmt 1 view .LVU71
+	.loc 1 88 23 is_stmt 0 view .LVU72
+	movb	$0, (%rax,%rbx)
+	.loc 1 89 3 is_stmt 1 view .LVU73
+	.loc 1 89 39 is_stmt 0 view .LVU74
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	call	st_create_n@PLT
+.LVL19:
+	.loc 1 90 3 is_stmt 1 view .LVU75
+	.loc 1 90 6 is_stmt 0 view .LVU76
+	testq	%rax, %rax
+	je	.L30
+	.loc 1 95 3 is_stmt 1 view .LVU77
+	.loc 1 95 33 is_stmt 0 view .LVU78
+	movq	%rbx, 24(%rax)
+	.loc 1 96 3 is_stmt 1 view .LVU79
+	.loc 1 96 24 is_stmt 0 view .LVU80
+	movl	$1, 56(%rax)
+	.loc 1 98 3 is_stmt 1 view .LVU81
+.LVL20:
+.L17:
+	.loc 1 99 1 is_stmt 0 view .LVU82
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL21:
+	.loc 1 99 1 view .LVU83
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL22:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.cfi_restore_state
+.LBB17:
+.LBI17:
+	.loc 1 67 25 is_stmt 1 view .LVU84
+.LBB18:
+.LBB19:
+	.loc 1 70 5 view .LVU85
+	.loc 1 70 67 is_stmt 0 view .LVU86
+	movl	$344, %edi
+	call	malloc@PLT
+.LVL23:
+	.loc 1 71 5 is_stmt 1 view .LVU87
+	.loc 1 71 10 view .LVU88
+	.loc 1 71 8 view .LVU89
+	.loc 1 72 5 view .LVU90
+	.loc 1 72 8 is_stmt 0 view .LVU91
+	testq	%rax, %rax
+	je	.L19
+	.loc 1 73 7 is_stmt 1 view .LVU92
+	.loc 1 73 35 is_stmt 0 view .LVU93
+	leaq	72(%rax), %rsi
+	.loc 1 73 7 view .LVU94
+	movq	%rax, %rdi
+	movl	$255, %edx
+	movq	%rax, 8(%rsp)
+	call	st_init@PLT
+.LVL24:
+	.loc 1 74 7 is_stmt 1 view .LVU95
+	.loc 1 74 35 is_stmt 0 view .LVU96
+	movq	8(%rsp), %rax
+	movb	$0, 72(%rax)
+	.loc 1 75 7 is_stmt 1 view .LVU97
+	.loc 1 75 37 is_stmt 0 view .LVU98
+	movq	%rbx, 24(%rax)
+	.loc 1 76 7 is_stmt 1 view .LVU99
+	.loc 1 76 28 is_stmt 0 view .LVU100
+	movl	$3, 56(%rax)
+.LBE19:
+.LBE18:
+.LBE17:
+	.loc 1 99 1 view .LVU101
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL25:
+	.loc 1 99 1 view .LVU102
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL26:
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.cfi_restore_state
+	.loc 1 91 5 is_stmt 1 view .LVU103
+	movq	%rbp, %rdi
+	call	free@PLT
+.LVL27:
+	.loc 1 92 5 view .LVU104
+.L19:
+	.loc 1 84 11 is_stmt 0 view .LVU105
+	xorl	%eax, %eax
+	jmp	.L17
+	.cfi_endproc
+.LFE29:
+	.size	st_create_empty, .-st_create_empty
+	.p2align 4
+	.globl	st_destroy
+	.type	st_destroy, @function
+st_destroy:
+.LVL28:
+.LFB31:
+	.loc 1 128 52 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 129 3 view .LVU107
+	.loc 1 128 52 is_stmt 0 view .LVU108
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 128 52 view .LVU109
+	movq	%rdi, %rbx
+	.loc 1 129 6 view .LVU110
+	testq	%rdi, %rdi
+	je	.L33
+	.loc 1 130 5 is_stmt 1 view .LVU111
+.LVL29:
+.LBB22:
+.LBI22:
+	.loc 1 107 13 view .LVU112
+.LBB23:
+	.loc 1 108 3 view .LVU113
+	call	st_drop_structural_index@PLT
+.LVL30:
+	.loc 1 109 3 view .LVU114
+	.loc 1 109 6 is_stmt 0 view .LVU115
+	cmpq	$0, 48(%rbx)
+	je	.L34
+	.loc 1 111 5 is_stmt 1 view .LVU116
+	movq	(%rbx), %rdi
+	call	free@PLT
+.LVL31:
+	.loc 1 112 5 view .LVU117
+	movq	48(%rbx), %rdi
+	call	free@PLT
+.LVL32:
+	.loc 1 113 5 view .LVU118
+.L33:
+	.loc 1 113 5 is_stmt 0 view .LVU119
+.LBE23:
+.LBE22:
+	.loc 1 132 3 is_stmt 1 view .LVU120
+	movq	%rbx, %rdi
+	.loc 1 134 1 is_stmt 0 view .LVU121
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL33:
+	.loc 1 132 3 view .LVU122
+	jmp	free@PLT
+.LVL34:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.cfi_restore_state
+.LBB25:
+.LBB24:
+	.loc 1 115 8 is_stmt 1 view .LVU123
+	.loc 1 115 21 is_stmt 0 view .LVU124
+	movl	56(%rbx), %eax
+	.loc 1 115 11 view .LVU125
+	cmpl	$1, %eax
+	je	.L38
+	.loc 1 118 8 is_stmt 1 view .LVU126
+	.loc 1 118 11 is_stmt 0 view .LVU127
+	cmpl	$2, %eax
+	jne	.L33
+	.loc 1 119 5 is_stmt 1 view .LVU128
+	movq	8(%rbx), %rsi
+	movq	(%rbx), %rdi
+	call	munmap@PLT
+.LVL35:
+	jmp	.L33
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.loc 1 116 5 view .LVU129
+	movq	(%rbx), %rdi
+	call	free@PLT
+.LVL36:
+	jmp	.L33
+.LBE24:
+.LBE25:
+	.cfi_endproc
+.LFE31:
+	.size	st_destroy, .-st_destroy
+	.p2align 4
+	.globl	st_reset
+	.type	st_reset, @function
+st_reset:
+.LVL37:
+.LFB32:
+	.loc 1 139 50 view -0
+	.cfi_startproc
+	.loc 1 140 3 view .LVU131
+	.loc 1 141 47 is_stmt 0 view .LVU132
+	movl	56(%rdi), %eax
+	.loc 1 140 23 view .LVU133
+	movq	$0, 16(%rdi)
+	.loc 1 141 3 is_stmt 1 view .LVU134
+	.loc 1 141 47 is_stmt 0 view .LVU135
+	andl	$-3, %eax
+	.loc 1 141 6 view .LVU136
+	cmpl	$1, %eax
+	je	.L42
+	.loc 1 146 1 view .LVU137
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L42:
+.LVL38:
+.LBB28:
+.LBI28:
+	.loc 1 139 6 is_stmt 1 view .LVU138
+.LBB29:
+	.loc 1 143 5 view .LVU139
+	.loc 1 143 14 is_stmt 0 view .LVU140
+	movq	(%rdi), %rax
+	.loc 1 143 26 view .LVU141
+	movb	$0, (%rax)
+	.loc 1 144 5 is_stmt 1 view .LVU142
+	jmp	st_drop_structural_index@PLT
+.LVL39:
+	.loc 1 144 5 is_stmt 0 view .LVU143
+.LBE29:
+.LBE28:
+	.cfi_endproc
+.LFE32:
+	.size	st_reset, .-st_reset
+	.p2align 4
+	.globl	st_rebind
+	.type	st_rebind, @function
+st_rebind:
+.LVL40:
+.LFB33:
+	.loc 1 151 85 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 152 3 view .LVU145
+	.loc 1 153 12 is_stmt 0 view .LVU146
+	xorl	%eax, %eax
+	.loc 1 152 6 view .LVU147
+	cmpq	$0, 48(%rdi)
+	je	.L54
+	.loc 1 160 1 view .LVU148
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.loc 1 151 85 discriminator 1 view .LVU149
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 152 50 discriminator 1 view .LVU150
+	testq	%rsi, %rsi
+	je	.L49
+	.loc 1 152 50 discriminator 1 view .LVU151
+	movq	%rdx, %r12
+	testq	%rdx, %rdx
+	je	.L49
+	.loc 1 152 50 discriminator 1 view .LVU152
+	movq	%rdi, %rbx
+	.loc 1 155 3 is_stmt 1 view .LVU153
+.LVL41:
+.LBB32:
+.LBI32:
+	.loc 1 107 13 view .LVU154
+.LBB33:
+	.loc 1 108 3 view .LVU155
+	call	st_drop_structural_index@PLT
+.LVL42:
+	.loc 1 109 3 view .LVU156
+	.loc 1 109 6 is_stmt 0 view .LVU157
+	cmpq	$0, 48(%rbx)
+	je	.L45
+	.loc 1 111 5 is_stmt 1 view .LVU158
+	movq	(%rbx), %rdi
+	call	free@PLT
+.LVL43:
+	.loc 1 112 5 view .LVU159
+	movq	48(%rbx), %rdi
+	call	free@PLT
+.LVL44:
+	.loc 1 113 5 view .LVU160
+	.loc 1 113 23 is_stmt 0 view .LVU161
+	movq	$0, 48(%rbx)
+.L46:
+	.loc 1 121 3 is_stmt 1 view .LVU162
+	.loc 1 122 3 view .LVU163
+	.loc 1 122 24 is_stmt 0 view .LVU164
+	movl	$0, 56(%rbx)
+.LVL45:
+	.loc 1 122 24 view .LVU165
+.LBE33:
+.LBE32:
+	.loc 1 156 3 is_stmt 1 view .LVU166
+	.loc 1 156 21 is_stmt 0 view .LVU167
+	movq	%rbp, (%rbx)
+	.loc 1 157 3 is_stmt 1 view .LVU168
+	.loc 1 157 21 is_stmt 0 view .LVU169
+	movq	%r12, 8(%rbx)
+	.loc 1 158 3 is_stmt 1 view .LVU170
+	.loc 1 158 23 is_stmt 0 view .LVU171
+	movq	$0, 16(%rbx)
+	.loc 1 159 3 is_stmt 1 view .LVU172
+	.loc 1 159 10 is_stmt 0 view .LVU173
+	movl	$1, %eax
+	.loc 1 160 1 view .LVU174
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL46:
+	.loc 1 160 1 view .LVU175
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL47:
+	.loc 1 160 1 view .LVU176
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL48:
+	.loc 1 160 1 view .LVU177
+	ret
+.LVL49:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.cfi_restore_state
+	.loc 1 160 1 view .LVU178
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	.loc 1 153 12 view .LVU179
+	xorl	%eax, %eax
+	.loc 1 160 1 view .LVU180
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL50:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.cfi_restore_state
+.LBB35:
+.LBB34:
+	.loc 1 115 8 is_stmt 1 view .LVU181
+	.loc 1 115 21 is_stmt 0 view .LVU182
+	movl	56(%rbx), %eax
+	.loc 1 115 11 view .LVU183
+	cmpl	$1, %eax
+	je	.L55
+	.loc 1 118 8 is_stmt 1 view .LVU184
+	.loc 1 118 11 is_stmt 0 view .LVU185
+	cmpl	$2, %eax
+	jne	.L46
+	.loc 1 119 5 is_stmt 1 view .LVU186
+	movq	8(%rbx), %rsi
+	movq	(%rbx), %rdi
+	call	munmap@PLT
+.LVL51:
+	jmp	.L46
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.loc 1 116 5 view .LVU187
+	movq	(%rbx), %rdi
+	call	free@PLT
+.LVL52:
+	jmp	.L46
+.LBE34:
+.LBE35:
+	.cfi_endproc
+.LFE33:
+	.size	st_rebind, .-st_rebind
+	.p2align 4
+	.globl	st_detach_string
+	.type	st_detach_string, @function
+st_detach_string:
+.LVL53:
+.LFB34:
+	.loc 1 165 59 view -0
+	.cfi_startproc
+	.loc 1 166 3 view .LVU189
+	.loc 1 165 59 is_stmt 0 view .LVU190
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 167 16 view .LVU191
+	movl	56(%rdi), %eax
+	.loc 1 166 9 view .LVU192
+	movq	(%rdi), %rbp
+.LVL54:
+	.loc 1 167 3 is_stmt 1 view .LVU193
+	.loc 1 167 6 is_stmt 0 view .LVU194
+	cmpl	$3, %eax
+	je	.L62
+	.loc 1 175 8 is_stmt 1 view .LVU195
+	.loc 1 175 11 is_stmt 0 view .LVU196
+	cmpl	$1, %eax
+	je	.L60
+.LVL55:
+.L56:
+	.loc 1 187 1 view .LVU197
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL56:
+	.loc 1 187 1 view .LVU198
+	movq	%rbp, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL57:
+	.loc 1 187 1 view .LVU199
+	ret
+.LVL58:
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	.cfi_restore_state
+.LBB36:
+	.loc 1 169 5 is_stmt 1 view .LVU200
+	.loc 1 169 23 is_stmt 0 view .LVU201
+	movq	16(%rdi), %rax
+	.loc 1 170 14 view .LVU202
+	movq	%rsp, %rdi
+	.loc 1 169 23 view .LVU203
+	movq	%rbp, (%rsp)
+	movq	%rax, 8(%rsp)
+	.loc 1 170 5 is_stmt 1 view .LVU204
+	.loc 1 170 14 is_stmt 0 view .LVU205
+	call	sv_to_string@PLT
+.LVL59:
+	movq	%rax, %rbp
+.LVL60:
+	.loc 1 171 5 is_stmt 1 view .LVU206
+	.loc 1 171 8 is_stmt 0 view .LVU207
+	testq	%rax, %rax
+	je	.L56
+.LVL61:
+.L60:
+	.loc 1 171 8 view .LVU208
+.LBE36:
+	.loc 1 180 3 is_stmt 1 view .LVU209
+	movq	%rbx, %rdi
+	call	st_drop_structural_index@PLT
+.LVL62:
+	.loc 1 181 3 view .LVU210
+	.loc 1 181 23 is_stmt 0 view .LVU211
+	leaq	72(%rbx), %rax
+	movq	%rax, (%rbx)
+	.loc 1 182 3 is_stmt 1 view .LVU212
+	.loc 1 182 21 is_stmt 0 view .LVU213
+	movq	$255, 8(%rbx)
+	.loc 1 183 3 is_stmt 1 view .LVU214
+	.loc 1 183 23 is_stmt 0 view .LVU215
+	movq	$0, 16(%rbx)
+	.loc 1 184 3 is_stmt 1 view .LVU216
+	.loc 1 184 31 is_stmt 0 view .LVU217
+	movb	$0, 72(%rbx)
+	.loc 1 185 3 is_stmt 1 view .LVU218
+	.loc 1 185 24 is_stmt 0 view .LVU219
+	movl	$3, 56(%rbx)
+	.loc 1 186 3 is_stmt 1 view .LVU220
+	.loc 1 187 1 is_stmt 0 view .LVU221
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL63:
+	.loc 1 187 1 view .LVU222
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL64:
+	.loc 1 187 1 view .LVU223
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	st_detach_string, .-st_detach_string
+	.p2align 4
+	.globl	st_pool_release
+	.type	st_pool_release, @function
+st_pool_release:
+.LVL65:
+.LFB36:
+	.loc 1 207 57 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 208 3 view .LVU225
+	.loc 1 208 6 is_stmt 0 view .LVU226
+	testq	%rdi, %rdi
+	je	.L72
+	.loc 1 207 57 view .LVU227
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	.loc 1 211 3 is_stmt 1 view .LVU228
+.LVL66:
+	.loc 1 212 3 view .LVU229
+	.loc 1 207 57 is_stmt 0 view .LVU230
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 211 57 view .LVU231
+	movl	56(%rdi), %eax
+	andl	$-3, %eax
+	.loc 1 212 6 view .LVU232
+	cmpl	$1, %eax
+	jne	.L65
+	.loc 1 212 20 discriminator 1 view .LVU233
+	cmpq	$0, 48(%rdi)
+	je	.L75
+.LVL67:
+.L65:
+	.loc 1 213 5 is_stmt 1 view .LVU234
+	.loc 1 224 1 is_stmt 0 view .LVU235
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 213 5 view .LVU236
+	movq	%rbx, %rdi
+	.loc 1 224 1 view .LVU237
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL68:
+	.loc 1 224 1 view .LVU238
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	.loc 1 213 5 view .LVU239
+	jmp	st_destroy@PLT
+.LVL69:
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	.cfi_restore_state
+	.loc 1 212 79 discriminator 2 view .LVU240
+	leaq	string_tokenizer_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL70:
+	.loc 1 212 48 discriminator 2 view .LVU241
+	cmpq	$8, string_tokenizer_pool_count@dtpoff(%rax)
+	.loc 1 212 79 discriminator 2 view .LVU242
+	movq	%rax, %rbp
+	.loc 1 212 48 discriminator 2 view .LVU243
+	je	.L65
+	.loc 1 217 3 is_stmt 1 view .LVU244
+	movq	%rbx, %rdi
+	call	st_reset@PLT
+.LVL71:
+	.loc 1 218 3 view .LVU245
+	.loc 1 220 3 is_stmt 0 view .LVU246
+	movq	8(%rbx), %rdx
+	movq	(%rbx), %rsi
+	movq	%rbx, %rdi
+	.loc 1 218 24 view .LVU247
+	movl	56(%rbx), %r13d
+.LVL72:
+	.loc 1 219 3 is_stmt 1 view .LVU248
+	.loc 1 219 10 is_stmt 0 view .LVU249
+	movq	24(%rbx), %r12
+.LVL73:
+	.loc 1 220 3 is_stmt 1 view .LVU250
+	call	st_init@PLT
+.LVL74:
+	.loc 1 221 3 view .LVU251
+	.loc 1 223 52 is_stmt 0 view .LVU252
+	movq	string_tokenizer_pool_count@dtpoff(%rbp), %rax
+	.loc 1 221 24 view .LVU253
+	movl	%r13d, 56(%rbx)
+	.loc 1 222 3 is_stmt 1 view .LVU254
+	.loc 1 223 52 is_stmt 0 view .LVU255
+	leaq	1(%rax), %rdx
+	.loc 1 222 33 view .LVU256
+	movq	%r12, 24(%rbx)
+	.loc 1 223 3 is_stmt 1 view .LVU257
+	.loc 1 223 52 is_stmt 0 view .LVU258
+	movq	%rdx, string_tokenizer_pool_count@dtpoff(%rbp)
+	.loc 1 223 56 view .LVU259
+	movq	%rbx, string_tokenizer_pool@dtpoff(%rbp,%rax,8)
+	.loc 1 224 1 view .LVU260
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL75:
+	.loc 1 224 1 view .LVU261
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL76:
+	.loc 1 224 1 view .LVU262
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL77:
+	.loc 1 224 1 view .LVU263
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL78:
+	.loc 1 224 1 view .LVU264
+	ret
+.LVL79:
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.loc 1 224 1 view .LVU265
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	st_pool_release, .-st_pool_release
+	.p2align 4
+	.globl	st_pool_clear
+	.type	st_pool_clear, @function
+st_pool_clear:
+.LFB37:
+	.loc 1 229 26 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 230 3 view .LVU267
+	.loc 1 230 38 view .LVU268
+	.loc 1 229 26 is_stmt 0 view .LVU269
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 230 38 view .LVU270
+	leaq	string_tokenizer_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL80:
+	movq	string_tokenizer_pool_count@dtpoff(%rax), %rax
+	testq	%rax, %rax
+	je	.L83
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.loc 1 231 5 is_stmt 1 view .LVU271
+	.loc 1 231 38 is_stmt 0 view .LVU272
+	leaq	-1(%rax), %rbx
+	.loc 1 231 5 view .LVU273
+	leaq	string_tokenizer_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL81:
+	movq	string_tokenizer_pool@dtpoff(%rax,%rbx,8), %rdi
+	movq	%rax, %rbp
+	movq	%rbx, string_tokenizer_pool_count@dtpoff(%rax)
+	call	st_destroy@PLT
+.LVL82:
+	.loc 1 230 38 is_stmt 1 view .LVU274
+	movq	string_tokenizer_pool_count@dtpoff(%rbp), %rax
+	testq	%rax, %rax
+	jne	.L78
+.L83:
+	.loc 1 233 1 is_stmt 0 view .LVU275
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	st_pool_clear, .-st_pool_clear
+	.p2align 4
+	.globl	st_attach_arena
+	.type	st_attach_arena, @function
+st_attach_arena:
+.LVL83:
+.LFB38:
+	.loc 1 238 84 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 239 3 view .LVU277
+	.loc 1 239 20 is_stmt 0 view .LVU278
+	movq	%rsi, 64(%rdi)
+	.loc 1 240 1 view .LVU279
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	st_attach_arena, .-st_attach_arena
+	.p2align 4
+	.globl	st_attach_stats
+	.type	st_attach_stats, @function
+st_attach_stats:
+.LVL84:
+.LFB39:
+	.loc 1 245 84 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 246 3 view .LVU281
+	.loc 1 246 20 is_stmt 0 view .LVU282
+	movq	%rsi, 336(%rdi)
+	.loc 1 247 1 view .LVU283
+	ret
+	.cfi_endproc
+.LFE39:
+	.size	st_attach_stats, .-st_attach_stats
+	.p2align 4
+	.globl	st_next_token
+	.type	st_next_token, @function
+st_next_token:
+.LVL85:
+.LFB42:
+	.loc 1 290 55 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 292 3 view .LVU285
+	.loc 1 290 55 is_stmt 0 view .LVU286
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 292 10 view .LVU287
+	movq	16(%rdi), %rax
+	.loc 1 293 33 view .LVU288
+	movq	328(%rdi), %rdi
+.LVL86:
+	.loc 1 294 43 view .LVU289
+	movq	8(%rbx), %rsi
+	.loc 1 292 10 view .LVU290
+	leaq	1(%rax), %rbp
+.LVL87:
+	.loc 1 293 3 is_stmt 1 view .LVU291
+	.loc 1 294 3 view .LVU292
+	.loc 1 294 6 is_stmt 0 view .LVU293
+	testq	%rdi, %rdi
+	je	.L90
+	.loc 1 294 20 discriminator 1 view .LVU294
+	cmpq	%rsi, %rbp
+	jb	.L104
+.LVL88:
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	.loc 1 309 5 is_stmt 1 view .LVU295
+	.loc 1 310 8 is_stmt 0 view .LVU296
+	cmpq	$0, 48(%rbx)
+	.loc 1 309 25 view .LVU297
+	movq	%rsi, 16(%rbx)
+	.loc 1 310 5 is_stmt 1 view .LVU298
+	.loc 1 310 8 is_stmt 0 view .LVU299
+	je	.L102
+	.loc 1 310 37 discriminator 1 view .LVU300
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	st_ensure@PLT
+.LVL89:
+	.loc 1 310 34 discriminator 1 view .LVU301
+	testl	%eax, %eax
+	je	.L102
+	.loc 1 313 5 is_stmt 1 view .LVU302
+	.loc 1 313 14 is_stmt 0 view .LVU303
+	movq	16(%rbx), %rbp
+.LVL90:
+	.loc 1 300 9 is_stmt 1 view .LVU304
+	.loc 1 302 29 is_stmt 0 view .LVU305
+	movq	8(%rbx), %rsi
+.L90:
+	.loc 1 300 3 is_stmt 1 view .LVU306
+	.loc 1 302 5 view .LVU307
+	.loc 1 302 8 is_stmt 0 view .LVU308
+	cmpq	%rsi, %rbp
+	jnb	.L92
+	.loc 1 303 7 is_stmt 1 view .LVU309
+	.loc 1 303 60 is_stmt 0 view .LVU310
+	movq	(%rbx), %rdi
+	.loc 1 303 19 view .LVU311
+	subq	%rbp, %rsi
+	.loc 1 303 60 view .LVU312
+	addq	%rbp, %rdi
+	.loc 1 303 19 view .LVU313
+	call	st_scan_non_whitespace@PLT
+.LVL91:
+	.loc 1 304 31 view .LVU314
+	movq	8(%rbx), %rsi
+	.loc 1 303 16 view .LVU315
+	addq	%rax, %rbp
+.LVL92:
+	.loc 1 304 7 is_stmt 1 view .LVU316
+	.loc 1 304 10 is_stmt 0 view .LVU317
+	cmpq	%rsi, %rbp
+	jnb	.L92
+	.loc 1 315 3 is_stmt 1 view .LVU318
+	.loc 1 315 8 view .LVU319
+	.loc 1 315 6 view .LVU320
+	.loc 1 316 3 view .LVU321
+	.loc 1 316 23 is_stmt 0 view .LVU322
+	movq	%rbp, 16(%rbx)
+.L102:
+	.loc 1 317 1 view .LVU323
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL93:
+	.loc 1 317 1 view .LVU324
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL94:
+	.loc 1 317 1 view .LVU325
+	ret
+.LVL95:
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	.cfi_restore_state
+.LBB37:
+.LBI37:
+	.file 2 "/root/repo/src/../include/strutils.h"
+	.loc 2 202 19 is_stmt 1 discriminator 2 view .LVU326
+.LBB38:
+	.loc 2 203 3 discriminator 2 view .LVU327
+	.loc 2 203 3 is_stmt 0 discriminator 2 view .LVU328
+.LBE38:
+.LBE37:
+	.loc 1 294 83 discriminator 2 view .LVU329
+	movq	(%rbx), %rdx
+.LBB40:
+.LBB39:
+	.loc 2 203 26 discriminator 2 view .LVU330
+	movzbl	1(%rdx,%rax), %eax
+.LBE39:
+.LBE40:
+	.loc 1 294 52 discriminator 2 view .LVU331
+	movq	st_char_classes@GOTPCREL(%rip), %rdx
+	testb	$1, (%rdx,%rax)
+	je	.L90
+.LVL96:
+.LBB41:
+.LBI41:
+	.loc 2 1969 19 is_stmt 1 view .LVU332
+.LBB42:
+	.loc 2 1970 3 view .LVU333
+	.loc 2 1970 33 is_stmt 0 view .LVU334
+	movq	16(%rdi), %rax
+	.loc 2 1970 43 view .LVU335
+	movq	%rbp, %rdx
+	shrq	$6, %rdx
+	.loc 2 1970 49 view .LVU336
+	movq	(%rax,%rdx,8), %rax
+.LBE42:
+.LBE41:
+	.loc 1 294 116 view .LVU337
+	btq	%rbp, %rax
+	jc	.L90
+	.loc 1 296 5 is_stmt 1 view .LVU338
+	.loc 1 296 27 is_stmt 0 view .LVU339
+	movq	%rbp, %rsi
+	call	st_structural_next@PLT
+.LVL97:
+	.loc 1 296 25 view .LVU340
+	movq	%rax, 16(%rbx)
+	.loc 1 297 5 is_stmt 1 view .LVU341
+	.loc 1 297 10 view .LVU342
+	.loc 1 297 8 view .LVU343
+	.loc 1 298 5 view .LVU344
+	jmp	.L102
+	.cfi_endproc
+.LFE42:
+	.size	st_next_token, .-st_next_token
+	.p2align 4
+	.globl	st_current_token
+	.type	st_current_token, @function
+st_current_token:
+.LVL98:
+.LFB43:
+	.loc 1 322 58 view -0
+	.cfi_startproc
+	.loc 1 323 3 view .LVU346
+	.loc 1 322 58 is_stmt 0 view .LVU347
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 323 7 view .LVU348
+	movl	$1, %esi
+	.loc 1 322 58 view .LVU349
+	movq	%rdi, %rbx
+	.loc 1 323 7 view .LVU350
+	call	st_ensure@PLT
+.LVL99:
+	.loc 1 323 7 view .LVU351
+	movl	%eax, %edx
+	xorl	%eax, %eax
+	.loc 1 323 6 view .LVU352
+	testl	%edx, %edx
+	je	.L105
+	.loc 1 327 3 is_stmt 1 view .LVU353
+	.loc 1 327 27 is_stmt 0 view .LVU354
+	movq	(%rbx), %rdx
+	movq	16(%rbx), %rax
+	movzbl	(%rdx,%rax), %eax
+.L105:
+	.loc 1 328 1 view .LVU355
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL100:
+	.loc 1 328 1 view .LVU356
+	ret
+	.cfi_endproc
+.LFE43:
+	.size	st_current_token, .-st_current_token
+	.p2align 4
+	.globl	st_sub_string_view
+	.type	st_sub_string_view, @function
+st_sub_string_view:
+.LVL101:
+.LFB44:
+	.loc 1 333 130 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 333 130 is_stmt 0 view .LVU358
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rcx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movl	%edx, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 333 130 view .LVU359
+	movl	%esi, %ebx
+	.loc 1 335 3 is_stmt 1 view .LVU360
+	.loc 1 335 7 is_stmt 0 view .LVU361
+	movl	$1, %esi
+.LVL102:
+	.loc 1 335 7 view .LVU362
+	call	st_ensure@PLT
+.LVL103:
+	.loc 1 335 6 view .LVU363
+	testl	%eax, %eax
+	je	.L111
+	.loc 1 335 48 discriminator 1 view .LVU364
+	movq	0(%rbp), %rdi
+	.loc 1 335 66 discriminator 1 view .LVU365
+	movq	16(%rbp), %rdx
+	.loc 1 337 12 discriminator 1 view .LVU366
+	xorl	%eax, %eax
+	.loc 1 335 36 discriminator 1 view .LVU367
+	cmpb	%bl, (%rdi,%rdx)
+	jne	.L111
+	movsbl	%r13b, %r13d
+.LVL104:
+.LBB46:
+.LBI46:
+	.loc 1 333 5 is_stmt 1 view .LVU368
+.LBB47:
+	.loc 1 340 10 is_stmt 0 view .LVU369
+	movl	$1, %r12d
+	jmp	.L114
+.LVL105:
+	.p2align 4,,10
+	.p2align 3
+.L123:
+.LBB48:
+	.loc 1 345 28 view .LVU370
+	leaq	1(%rbx), %rsi
+	movq	%rbp, %rdi
+	call	st_ensure@PLT
+.LVL106:
+	.loc 1 345 25 view .LVU371
+	testl	%eax, %eax
+	je	.L113
+	.loc 1 345 25 view .LVU372
+.LBE48:
+	.loc 1 350 44 view .LVU373
+	movq	16(%rbp), %rdx
+	.loc 1 350 24 view .LVU374
+	movq	0(%rbp), %rdi
+.LVL107:
+.L114:
+	.loc 1 341 3 is_stmt 1 view .LVU375
+.LBB49:
+	.loc 1 342 5 view .LVU376
+	.loc 1 342 12 is_stmt 0 view .LVU377
+	movq	8(%rbp), %rbx
+	subq	%rdx, %rbx
+.LVL108:
+	.loc 1 343 5 is_stmt 1 view .LVU378
+	.loc 1 343 12 is_stmt 0 view .LVU379
+	movq	%rbx, %rsi
+	.loc 1 343 70 view .LVU380
+	addq	%r12, %rdx
+	.loc 1 343 12 view .LVU381
+	subq	%r12, %rsi
+	.loc 1 343 70 view .LVU382
+	addq	%rdx, %rdi
+	.loc 1 343 12 view .LVU383
+	movl	%r13d, %edx
+	call	st_scan_delimiter@PLT
+.LVL109:
+	.loc 1 343 9 view .LVU384
+	addq	%rax, %r12
+.LVL110:
+	.loc 1 345 5 is_stmt 1 view .LVU385
+	.loc 1 345 8 is_stmt 0 view .LVU386
+	cmpq	%rbx, %r12
+	jnb	.L123
+.L113:
+.LBE49:
+	.loc 1 350 3 is_stmt 1 view .LVU387
+	.loc 1 350 44 is_stmt 0 view .LVU388
+	movq	16(%rbp), %rax
+	.loc 1 350 55 view .LVU389
+	movq	0(%rbp), %rdx
+	leaq	1(%rdx,%rax), %rdx
+	.loc 1 350 13 view .LVU390
+	movq	%rdx, (%r14)
+	.loc 1 351 3 is_stmt 1 view .LVU391
+	.loc 1 351 19 is_stmt 0 view .LVU392
+	leaq	-1(%r12), %rdx
+	.loc 1 353 23 view .LVU393
+	addq	%rax, %r12
+.LVL111:
+	.loc 1 351 19 view .LVU394
+	movq	%rdx, 8(%r14)
+	.loc 1 353 3 is_stmt 1 view .LVU395
+	.loc 1 353 23 is_stmt 0 view .LVU396
+	movq	%r12, 16(%rbp)
+	.loc 1 354 3 is_stmt 1 view .LVU397
+	.loc 1 354 8 view .LVU398
+	.loc 1 354 6 view .LVU399
+	.loc 1 355 3 view .LVU400
+	.loc 1 355 8 view .LVU401
+	.loc 1 355 6 view .LVU402
+	.loc 1 356 3 view .LVU403
+.LVL112:
+	.loc 1 353 23 is_stmt 0 view .LVU404
+	movl	$1, %eax
+.L111:
+	.loc 1 353 23 view .LVU405
+.LBE47:
+.LBE46:
+	.loc 1 357 1 view .LVU406
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL113:
+	.loc 1 357 1 view .LVU407
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL114:
+	.loc 1 357 1 view .LVU408
+	ret
+	.cfi_endproc
+.LFE44:
+	.size	st_sub_string_view, .-st_sub_string_view
+	.p2align 4
+	.globl	st_sub_string
+	.type	st_sub_string, @function
+st_sub_string:
+.LVL115:
+.LFB45:
+	.loc 1 362 102 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 363 3 view .LVU410
+	.loc 1 364 3 view .LVU411
+	.loc 1 362 102 is_stmt 0 view .LVU412
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 364 7 view .LVU413
+	movsbl	%dl, %edx
+	.loc 1 364 7 view .LVU414
+	movsbl	%sil, %esi
+	.loc 1 362 102 view .LVU415
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 364 7 view .LVU416
+	movq	%rsp, %rbp
+	movq	%rbp, %rcx
+	call	st_sub_string_view@PLT
+.LVL116:
+	.loc 1 364 7 view .LVU417
+	movl	%eax, %edx
+	.loc 1 365 11 view .LVU418
+	xorl	%eax, %eax
+	.loc 1 364 6 view .LVU419
+	testl	%edx, %edx
+	je	.L124
+	.loc 1 368 3 is_stmt 1 view .LVU420
+	movq	64(%rbx), %rdi
+.LVL117:
+.LBB52:
+.LBI52:
+	.loc 1 279 14 view .LVU421
+.LBB53:
+	.loc 1 280 3 view .LVU422
+	.loc 1 280 6 is_stmt 0 view .LVU423
+	testq	%rdi, %rdi
+	je	.L126
+	.loc 1 281 5 is_stmt 1 view .LVU424
+	.loc 1 281 12 is_stmt 0 view .LVU425
+	movq	%rbp, %rsi
+	call	st_arena_string@PLT
+.LVL118:
+.L124:
+	.loc 1 281 12 view .LVU426
+.LBE53:
+.LBE52:
+	.loc 1 369 1 view .LVU427
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL119:
+	.loc 1 369 1 view .LVU428
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL120:
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	.cfi_restore_state
+.LBB55:
+.LBB54:
+	.loc 1 283 3 is_stmt 1 view .LVU429
+	.loc 1 283 8 view .LVU430
+	.loc 1 283 6 view .LVU431
+	.loc 1 284 3 view .LVU432
+	.loc 1 284 10 is_stmt 0 view .LVU433
+	movq	%rbp, %rdi
+	call	sv_to_string@PLT
+.LVL121:
+.LBE54:
+.LBE55:
+	.loc 1 369 1 view .LVU434
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL122:
+	.loc 1 369 1 view .LVU435
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL123:
+	.loc 1 369 1 view .LVU436
+	ret
+	.cfi_endproc
+.LFE45:
+	.size	st_sub_string, .-st_sub_string
+	.p2align 4
+	.globl	st_slice_string_view
+	.type	st_slice_string_view, @function
+st_slice_string_view:
+.LVL124:
+.LFB46:
+	.loc 1 374 104 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 376 3 view .LVU438
+	.loc 1 376 6 is_stmt 0 view .LVU439
+	testl	%esi, %esi
+	js	.L137
+	.loc 1 374 104 view .LVU440
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	.loc 1 377 5 view .LVU441
+	movslq	%esi, %r13
+	.loc 1 374 104 view .LVU442
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdx, %r12
+	.loc 1 377 5 is_stmt 1 view .LVU443
+	.loc 1 374 104 is_stmt 0 view .LVU444
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movl	%esi, %ebx
+	.loc 1 377 5 view .LVU445
+	movq	%r13, %rsi
+.LVL125:
+	.loc 1 374 104 view .LVU446
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 377 5 view .LVU447
+	call	st_ensure@PLT
+.LVL126:
+	.loc 1 379 3 is_stmt 1 view .LVU448
+	.loc 1 379 30 is_stmt 0 view .LVU449
+	movq	16(%rbp), %rdx
+	.loc 1 379 52 view .LVU450
+	movq	8(%rbp), %rax
+	.loc 1 379 18 view .LVU451
+	cmpq	%rdx, %rax
+	jb	.L133
+	.loc 1 379 100 discriminator 2 view .LVU452
+	subq	%rdx, %rax
+	.loc 1 379 61 discriminator 2 view .LVU453
+	cmpq	%r13, %rax
+	jb	.L133
+	.loc 1 383 3 is_stmt 1 view .LVU454
+	.loc 1 383 33 is_stmt 0 view .LVU455
+	movq	0(%rbp), %rax
+	.loc 1 386 33 view .LVU456
+	incl	%ebx
+.LVL127:
+	.loc 1 386 33 view .LVU457
+	movslq	%ebx, %rbx
+	.loc 1 383 33 view .LVU458
+	addq	%rdx, %rax
+	.loc 1 386 23 view .LVU459
+	addq	%rdx, %rbx
+.LVL128:
+	.loc 1 383 13 view .LVU460
+	movq	%rax, (%r12)
+	.loc 1 384 3 is_stmt 1 view .LVU461
+	.loc 1 384 13 is_stmt 0 view .LVU462
+	movq	%r13, 8(%r12)
+	.loc 1 386 3 is_stmt 1 view .LVU463
+	.loc 1 386 23 is_stmt 0 view .LVU464
+	movq	%rbx, 16(%rbp)
+	.loc 1 387 3 is_stmt 1 view .LVU465
+	.loc 1 387 8 view .LVU466
+	.loc 1 387 6 view .LVU467
+	.loc 1 388 3 view .LVU468
+	.loc 1 388 8 view .LVU469
+	.loc 1 388 6 view .LVU470
+	.loc 1 389 3 view .LVU471
+	.loc 1 390 1 is_stmt 0 view .LVU472
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 389 10 view .LVU473
+	movl	$1, %eax
+	.loc 1 390 1 view .LVU474
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL129:
+	.loc 1 390 1 view .LVU475
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL130:
+	.loc 1 390 1 view .LVU476
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL131:
+	.loc 1 390 1 view .LVU477
+	ret
+.LVL132:
+	.p2align 4,,10
+	.p2align 3
+.L133:
+	.cfi_restore_state
+	.loc 1 390 1 view .LVU478
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL133:
+	.loc 1 390 1 view .LVU479
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL134:
+	.loc 1 390 1 view .LVU480
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL135:
+	.loc 1 380 12 view .LVU481
+	xorl	%eax, %eax
+	.loc 1 390 1 view .LVU482
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL136:
+	.loc 1 390 1 view .LVU483
+	ret
+.LVL137:
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.loc 1 380 12 view .LVU484
+	xorl	%eax, %eax
+	.loc 1 390 1 view .LVU485
+	ret
+	.cfi_endproc
+.LFE46:
+	.size	st_slice_string_view, .-st_slice_string_view
+	.p2align 4
+	.globl	st_slice_string
+	.type	st_slice_string, @function
+st_slice_string:
+.LVL138:
+.LFB47:
+	.loc 1 395 76 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 396 3 view .LVU487
+	.loc 1 397 3 view .LVU488
+	.loc 1 395 76 is_stmt 0 view .LVU489
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 397 7 view .LVU490
+	movq	%rsp, %rbp
+	movq	%rbp, %rdx
+	call	st_slice_string_view@PLT
+.LVL139:
+	.loc 1 397 7 view .LVU491
+	movl	%eax, %edx
+	.loc 1 398 11 view .LVU492
+	xorl	%eax, %eax
+	.loc 1 397 6 view .LVU493
+	testl	%edx, %edx
+	je	.L138
+	.loc 1 401 3 is_stmt 1 view .LVU494
+	movq	64(%rbx), %rdi
+.LVL140:
+.LBB58:
+.LBI58:
+	.loc 1 279 14 view .LVU495
+.LBB59:
+	.loc 1 280 3 view .LVU496
+	.loc 1 280 6 is_stmt 0 view .LVU497
+	testq	%rdi, %rdi
+	je	.L140
+	.loc 1 281 5 is_stmt 1 view .LVU498
+	.loc 1 281 12 is_stmt 0 view .LVU499
+	movq	%rbp, %rsi
+	call	st_arena_string@PLT
+.LVL141:
+.L138:
+	.loc 1 281 12 view .LVU500
+.LBE59:
+.LBE58:
+	.loc 1 402 1 view .LVU501
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL142:
+	.loc 1 402 1 view .LVU502
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL143:
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	.cfi_restore_state
+.LBB61:
+.LBB60:
+	.loc 1 283 3 is_stmt 1 view .LVU503
+	.loc 1 283 8 view .LVU504
+	.loc 1 283 6 view .LVU505
+	.loc 1 284 3 view .LVU506
+	.loc 1 284 10 is_stmt 0 view .LVU507
+	movq	%rbp, %rdi
+	call	sv_to_string@PLT
+.LVL144:
+.LBE60:
+.LBE61:
+	.loc 1 402 1 view .LVU508
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL145:
+	.loc 1 402 1 view .LVU509
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL146:
+	.loc 1 402 1 view .LVU510
+	ret
+	.cfi_endproc
+.LFE47:
+	.size	st_slice_string, .-st_slice_string
+	.p2align 4
+	.globl	st_extract_numbers_view
+	.type	st_extract_numbers_view, @function
+st_extract_numbers_view:
+.LVL147:
+.LFB49:
+	.loc 1 434 89 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 435 3 view .LVU512
+	.loc 1 434 89 is_stmt 0 view .LVU513
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+.LVL148:
+.LBB69:
+.LBI69:
+	.loc 1 415 12 is_stmt 1 view .LVU514
+.LBB70:
+	.loc 1 417 3 view .LVU515
+	.loc 1 418 3 view .LVU516
+.LBE70:
+.LBE69:
+	.loc 1 434 89 is_stmt 0 view .LVU517
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+.LBB81:
+.LBB77:
+	.loc 1 417 10 view .LVU518
+	xorl	%ebx, %ebx
+.LBE77:
+.LBE81:
+	.loc 1 434 89 view .LVU519
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+.LBB82:
+.LBB78:
+	.loc 1 418 9 view .LVU520
+	jmp	.L146
+.LVL149:
+	.p2align 4,,10
+	.p2align 3
+.L152:
+.LBB71:
+.LBI71:
+	.loc 2 1473 19 is_stmt 1 view .LVU521
+	.loc 2 1474 3 view .LVU522
+.LBB72:
+.LBI72:
+	.loc 2 202 19 view .LVU523
+.LBB73:
+	.loc 2 203 3 view .LVU524
+	.loc 2 203 3 is_stmt 0 view .LVU525
+.LBE73:
+.LBE72:
+.LBE71:
+	.loc 1 418 76 view .LVU526
+	movq	0(%rbp), %rax
+	.loc 1 418 45 view .LVU527
+	movq	st_char_classes@GOTPCREL(%rip), %rdx
+	.loc 1 418 76 view .LVU528
+	addq	%r12, %rax
+	addq	16(%rbp), %rax
+.LBB76:
+.LBB75:
+.LBB74:
+	.loc 2 203 26 view .LVU529
+	movzbl	(%rax), %eax
+.LBE74:
+.LBE75:
+.LBE76:
+	.loc 1 418 45 view .LVU530
+	testb	$4, (%rdx,%rax)
+	je	.L145
+.LVL150:
+.L146:
+	.loc 1 418 45 is_stmt 1 view .LVU531
+	movq	%rbx, %r12
+	.loc 1 418 10 is_stmt 0 view .LVU532
+	incq	%rbx
+.LVL151:
+	.loc 1 418 10 view .LVU533
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	st_ensure@PLT
+.LVL152:
+	.loc 1 418 45 view .LVU534
+	cmpl	$1, %eax
+	je	.L152
+.L145:
+	.loc 1 422 3 is_stmt 1 view .LVU535
+.LBE78:
+.LBE82:
+	.loc 1 436 12 is_stmt 0 view .LVU536
+	xorl	%eax, %eax
+.LBB83:
+.LBB79:
+	.loc 1 422 6 view .LVU537
+	testq	%r12, %r12
+	je	.L144
+	.loc 1 426 3 is_stmt 1 view .LVU538
+	.loc 1 426 44 is_stmt 0 view .LVU539
+	movq	16(%rbp), %rax
+	.loc 1 426 33 view .LVU540
+	movq	0(%rbp), %rdx
+	.loc 1 427 13 view .LVU541
+	movq	%r12, 8(%r13)
+	.loc 1 426 33 view .LVU542
+	addq	%rax, %rdx
+.LBE79:
+.LBE83:
+.LBB84:
+.LBB85:
+	.loc 1 440 23 view .LVU543
+	leaq	-1(%rax,%r12), %rax
+.LBE85:
+.LBE84:
+.LBB87:
+.LBB80:
+	.loc 1 426 13 view .LVU544
+	movq	%rdx, 0(%r13)
+	.loc 1 427 3 is_stmt 1 view .LVU545
+	.loc 1 428 3 view .LVU546
+.LVL153:
+	.loc 1 428 3 is_stmt 0 view .LVU547
+.LBE80:
+.LBE87:
+.LBB88:
+.LBI84:
+	.loc 1 434 5 is_stmt 1 view .LVU548
+.LBB86:
+	.loc 1 438 3 view .LVU549
+	.loc 1 440 3 view .LVU550
+	.loc 1 440 23 is_stmt 0 view .LVU551
+	movq	%rax, 16(%rbp)
+	.loc 1 441 3 is_stmt 1 view .LVU552
+	.loc 1 441 8 view .LVU553
+	.loc 1 441 6 view .LVU554
+	.loc 1 442 3 view .LVU555
+	.loc 1 442 8 view .LVU556
+	.loc 1 442 6 view .LVU557
+	.loc 1 443 3 view .LVU558
+.LVL154:
+	.loc 1 440 23 is_stmt 0 view .LVU559
+	movl	$1, %eax
+.L144:
+	.loc 1 440 23 view .LVU560
+.LBE86:
+.LBE88:
+	.loc 1 444 1 view .LVU561
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL155:
+	.loc 1 444 1 view .LVU562
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL156:
+	.loc 1 444 1 view .LVU563
+	ret
+	.cfi_endproc
+.LFE49:
+	.size	st_extract_numbers_view, .-st_extract_numbers_view
+	.p2align 4
+	.globl	st_extract_until_view
+	.type	st_extract_until_view, @function
+st_extract_until_view:
+.LVL157:
+.LFB50:
+	.loc 1 449 129 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 451 3 view .LVU565
+	.loc 1 452 3 view .LVU566
+	.loc 1 449 129 is_stmt 0 view .LVU567
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 451 10 view .LVU568
+	xorl	%ebx, %ebx
+	.loc 1 452 9 view .LVU569
+	jmp	.L154
+.LVL158:
+	.p2align 4,,10
+	.p2align 3
+.L156:
+.LBB89:
+	.loc 1 453 5 is_stmt 1 view .LVU570
+	.loc 1 453 53 is_stmt 0 view .LVU571
+	movq	16(%r14), %rdi
+	.loc 1 453 12 view .LVU572
+	movq	8(%r14), %r13
+	.loc 1 454 12 view .LVU573
+	movq	%rbp, %rdx
+	.loc 1 453 12 view .LVU574
+	subq	%rdi, %r13
+.LVL159:
+	.loc 1 454 5 is_stmt 1 view .LVU575
+	.loc 1 454 12 is_stmt 0 view .LVU576
+	movq	%r13, %rsi
+	.loc 1 454 66 view .LVU577
+	addq	%rbx, %rdi
+	.loc 1 454 12 view .LVU578
+	subq	%rbx, %rsi
+	.loc 1 454 66 view .LVU579
+	addq	(%r14), %rdi
+	.loc 1 454 12 view .LVU580
+	call	st_scan_class@PLT
+.LVL160:
+	.loc 1 454 9 view .LVU581
+	addq	%rax, %rbx
+.LVL161:
+	.loc 1 456 5 is_stmt 1 view .LVU582
+	.loc 1 456 8 is_stmt 0 view .LVU583
+	cmpq	%r13, %rbx
+	jb	.L155
+.LVL162:
+.L154:
+	.loc 1 456 8 view .LVU584
+.LBE89:
+	.loc 1 452 40 is_stmt 1 view .LVU585
+	.loc 1 452 10 is_stmt 0 view .LVU586
+	leaq	1(%rbx), %rsi
+	movq	%r14, %rdi
+	call	st_ensure@PLT
+.LVL163:
+	.loc 1 452 40 view .LVU587
+	cmpl	$1, %eax
+	je	.L156
+.L155:
+	.loc 1 460 3 is_stmt 1 view .LVU588
+	.loc 1 461 12 is_stmt 0 view .LVU589
+	xorl	%eax, %eax
+	.loc 1 460 6 view .LVU590
+	testq	%rbx, %rbx
+	je	.L153
+	.loc 1 464 3 is_stmt 1 view .LVU591
+	.loc 1 464 44 is_stmt 0 view .LVU592
+	movq	16(%r14), %rax
+	.loc 1 464 33 view .LVU593
+	movq	(%r14), %rdx
+	.loc 1 465 13 view .LVU594
+	movq	%rbx, 8(%r12)
+	.loc 1 464 33 view .LVU595
+	addq	%rax, %rdx
+	.loc 1 467 23 view .LVU596
+	leaq	-1(%rax,%rbx), %rax
+	.loc 1 464 13 view .LVU597
+	movq	%rdx, (%r12)
+	.loc 1 465 3 is_stmt 1 view .LVU598
+	.loc 1 467 3 view .LVU599
+	.loc 1 467 23 is_stmt 0 view .LVU600
+	movq	%rax, 16(%r14)
+	.loc 1 468 3 is_stmt 1 view .LVU601
+	.loc 1 468 8 view .LVU602
+	.loc 1 468 6 view .LVU603
+	.loc 1 469 3 view .LVU604
+	.loc 1 469 8 view .LVU605
+	.loc 1 469 6 view .LVU606
+	.loc 1 470 3 view .LVU607
+	.loc 1 470 10 is_stmt 0 view .LVU608
+	movl	$1, %eax
+.L153:
+	.loc 1 471 1 view .LVU609
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL164:
+	.loc 1 471 1 view .LVU610
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL165:
+	.loc 1 471 1 view .LVU611
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL166:
+	.loc 1 471 1 view .LVU612
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL167:
+	.loc 1 471 1 view .LVU613
+	ret
+	.cfi_endproc
+.LFE50:
+	.size	st_extract_until_view, .-st_extract_until_view
+	.p2align 4
+	.globl	st_extract_numbers
+	.type	st_extract_numbers, @function
+st_extract_numbers:
+.LVL168:
+.LFB51:
+	.loc 1 476 61 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 477 3 view .LVU615
+	.loc 1 478 3 view .LVU616
+	.loc 1 476 61 is_stmt 0 view .LVU617
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 478 7 view .LVU618
+	movq	%rsp, %rbp
+	movq	%rbp, %rsi
+	call	st_extract_numbers_view@PLT
+.LVL169:
+	.loc 1 478 7 view .LVU619
+	movl	%eax, %edx
+	.loc 1 479 11 view .LVU620
+	xorl	%eax, %eax
+	.loc 1 478 6 view .LVU621
+	testl	%edx, %edx
+	je	.L161
+	.loc 1 482 3 is_stmt 1 view .LVU622
+	movq	64(%rbx), %rdi
+.LVL170:
+.LBB92:
+.LBI92:
+	.loc 1 279 14 view .LVU623
+.LBB93:
+	.loc 1 280 3 view .LVU624
+	.loc 1 280 6 is_stmt 0 view .LVU625
+	testq	%rdi, %rdi
+	je	.L163
+	.loc 1 281 5 is_stmt 1 view .LVU626
+	.loc 1 281 12 is_stmt 0 view .LVU627
+	movq	%rbp, %rsi
+	call	st_arena_string@PLT
+.LVL171:
+.L161:
+	.loc 1 281 12 view .LVU628
+.LBE93:
+.LBE92:
+	.loc 1 483 1 view .LVU629
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL172:
+	.loc 1 483 1 view .LVU630
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL173:
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	.cfi_restore_state
+.LBB95:
+.LBB94:
+	.loc 1 283 3 is_stmt 1 view .LVU631
+	.loc 1 283 8 view .LVU632
+	.loc 1 283 6 view .LVU633
+	.loc 1 284 3 view .LVU634
+	.loc 1 284 10 is_stmt 0 view .LVU635
+	movq	%rbp, %rdi
+	call	sv_to_string@PLT
+.LVL174:
+.LBE94:
+.LBE95:
+	.loc 1 483 1 view .LVU636
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL175:
+	.loc 1 483 1 view .LVU637
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL176:
+	.loc 1 483 1 view .LVU638
+	ret
+	.cfi_endproc
+.LFE51:
+	.size	st_extract_numbers, .-st_extract_numbers
+	.p2align 4
+	.globl	st_extract_double_to
+	.type	st_extract_double_to, @function
+st_extract_double_to:
+.LVL177:
+.LFB52:
+	.loc 1 488 76 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 490 3 view .LVU640
+	.loc 1 491 3 view .LVU641
+	.loc 1 488 76 is_stmt 0 view .LVU642
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 491 7 view .LVU643
+	movq	%rsp, %rsi
+.LVL178:
+	.loc 1 491 7 view .LVU644
+	call	st_extract_numbers_view@PLT
+.LVL179:
+	.loc 1 491 6 view .LVU645
+	testl	%eax, %eax
+	jne	.L175
+	.loc 1 492 12 view .LVU646
+	xorl	%eax, %eax
+.L177:
+	.loc 1 504 1 view .LVU647
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL180:
+	.loc 1 504 1 view .LVU648
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL181:
+	.loc 1 504 1 view .LVU649
+	ret
+.LVL182:
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	.cfi_restore_state
+	.loc 1 495 3 is_stmt 1 view .LVU650
+	.loc 1 496 3 view .LVU651
+	.loc 1 496 22 is_stmt 0 view .LVU652
+	movq	8(%rsp), %rsi
+	movq	(%rsp), %rdi
+	movq	%rbp, %rdx
+	call	stod@PLT
+.LVL183:
+	movq	%rax, %rdx
+.LVL184:
+	.loc 1 497 3 is_stmt 1 view .LVU653
+	.loc 1 497 6 view .LVU654
+	.loc 1 498 3 view .LVU655
+	.loc 1 503 10 is_stmt 0 view .LVU656
+	movl	$1, %eax
+.LVL185:
+	.loc 1 498 6 view .LVU657
+	testq	%rdx, %rdx
+	je	.L176
+	.loc 1 504 1 view .LVU658
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL186:
+	.loc 1 504 1 view .LVU659
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL187:
+	.loc 1 504 1 view .LVU660
+	ret
+.LVL188:
+	.p2align 4,,10
+	.p2align 3
+.L176:
+	.cfi_restore_state
+	.loc 1 500 5 is_stmt 1 view .LVU661
+	.loc 1 500 36 is_stmt 0 view .LVU662
+	movq	(%rsp), %rax
+	subq	(%rbx), %rax
+	.loc 1 500 25 view .LVU663
+	movq	%rax, 16(%rbx)
+	.loc 1 501 5 is_stmt 1 view .LVU664
+	.loc 1 492 12 is_stmt 0 view .LVU665
+	xorl	%eax, %eax
+	jmp	.L177
+	.cfi_endproc
+.LFE52:
+	.size	st_extract_double_to, .-st_extract_double_to
+	.p2align 4
+	.globl	st_extract_int64
+	.type	st_extract_int64, @function
+st_extract_int64:
+.LVL189:
+.LFB53:
+	.loc 1 509 73 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 510 3 view .LVU667
+	.loc 1 512 3 view .LVU668
+	.loc 1 509 73 is_stmt 0 view .LVU669
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rsi, %r14
+	.loc 1 512 3 view .LVU670
+	movl	$21, %esi
+.LVL190:
+	.loc 1 509 73 view .LVU671
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %rbx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 512 3 view .LVU672
+	call	st_ensure@PLT
+.LVL191:
+	.loc 1 512 3 view .LVU673
+	movq	%rsp, %r13
+	jmp	.L183
+	.p2align 4,,10
+	.p2align 3
+.L209:
+.LVL192:
+	.loc 1 518 5 is_stmt 1 view .LVU674
+	.loc 1 518 16 is_stmt 0 view .LVU675
+	movq	%r13, %rdx
+	xorl	%esi, %esi
+	call	stoi64@PLT
+.LVL193:
+	movq	%rax, %r12
+.LVL194:
+	.loc 1 520 5 is_stmt 1 view .LVU676
+	.loc 1 517 99 is_stmt 0 view .LVU677
+	xorl	%ebp, %ebp
+.LVL195:
+.L180:
+	.loc 1 520 30 discriminator 1 view .LVU678
+	cmpq	$0, 48(%rbx)
+	je	.L182
+	.loc 1 520 61 discriminator 2 view .LVU679
+	leaq	1(%rbp), %rsi
+	movq	%rbx, %rdi
+	call	st_ensure@PLT
+.LVL196:
+	.loc 1 520 58 discriminator 2 view .LVU680
+	testl	%eax, %eax
+	je	.L182
+.LVL197:
+.L183:
+	.loc 1 513 3 is_stmt 1 view .LVU681
+	.loc 1 514 3 view .LVU682
+	.loc 1 515 3 view .LVU683
+	.loc 1 516 3 view .LVU684
+	.loc 1 517 5 view .LVU685
+	.loc 1 517 26 is_stmt 0 view .LVU686
+	movq	16(%rbx), %rax
+	.loc 1 518 41 view .LVU687
+	movq	(%rbx), %rdi
+	.loc 1 517 48 view .LVU688
+	movq	8(%rbx), %rbp
+	.loc 1 518 41 view .LVU689
+	addq	%rax, %rdi
+	.loc 1 517 99 view .LVU690
+	cmpq	%rbp, %rax
+	jnb	.L209
+	.loc 1 517 99 discriminator 1 view .LVU691
+	subq	%rax, %rbp
+.LVL198:
+	.loc 1 518 5 is_stmt 1 discriminator 1 view .LVU692
+	.loc 1 518 16 is_stmt 0 discriminator 1 view .LVU693
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	call	stoi64@PLT
+.LVL199:
+	movq	%rax, %r12
+.LVL200:
+	.loc 1 520 5 is_stmt 1 discriminator 1 view .LVU694
+	.loc 1 520 8 is_stmt 0 discriminator 1 view .LVU695
+	cmpq	%rbp, %rax
+	jnb	.L180
+	.loc 1 524 3 is_stmt 1 view .LVU696
+	.loc 1 524 6 is_stmt 0 view .LVU697
+	testq	%rax, %rax
+	je	.L184
+.LVL201:
+.L192:
+	.loc 1 527 8 discriminator 1 view .LVU698
+	movq	(%rbx), %rax
+	addq	%r12, %rax
+	addq	16(%rbx), %rax
+	movzbl	(%rax), %eax
+.LVL202:
+	.loc 1 528 3 is_stmt 1 discriminator 1 view .LVU699
+	.loc 1 528 34 is_stmt 0 discriminator 1 view .LVU700
+	movl	%eax, %edx
+	andl	$-33, %edx
+	cmpb	$69, %dl
+	je	.L193
+	.loc 1 528 34 discriminator 1 view .LVU701
+	cmpb	$46, %al
+	jne	.L185
+.L193:
+	.loc 1 528 34 discriminator 1 view .LVU702
+	xorl	%ebp, %ebp
+	jmp	.L186
+.LVL203:
+	.p2align 4,,10
+	.p2align 3
+.L210:
+.LBB102:
+.LBB103:
+.LBB104:
+.LBB105:
+.LBI105:
+	.loc 2 1473 19 is_stmt 1 view .LVU703
+	.loc 2 1474 3 view .LVU704
+.LBB106:
+.LBI106:
+	.loc 2 202 19 view .LVU705
+.LBB107:
+	.loc 2 203 3 view .LVU706
+	.loc 2 203 3 is_stmt 0 view .LVU707
+.LBE107:
+.LBE106:
+.LBE105:
+	.loc 1 418 76 view .LVU708
+	movq	(%rbx), %rax
+	.loc 1 418 45 view .LVU709
+	movq	st_char_classes@GOTPCREL(%rip), %rdx
+	.loc 1 418 76 view .LVU710
+	addq	%r12, %rax
+	addq	16(%rbx), %rax
+.LBB110:
+.LBB109:
+.LBB108:
+	.loc 2 203 26 view .LVU711
+	movzbl	(%rax), %eax
+.LBE108:
+.LBE109:
+.LBE110:
+	.loc 1 418 45 view .LVU712
+	testb	$4, (%rdx,%rax)
+	je	.L188
+.LVL204:
+.L186:
+	.loc 1 418 45 is_stmt 1 view .LVU713
+	movq	%rbp, %r12
+	.loc 1 418 10 is_stmt 0 view .LVU714
+	incq	%rbp
+.LVL205:
+	.loc 1 418 10 view .LVU715
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	st_ensure@PLT
+.LVL206:
+	.loc 1 418 45 view .LVU716
+	cmpl	$1, %eax
+	je	.L210
+.L188:
+	.loc 1 422 3 is_stmt 1 view .LVU717
+	.loc 1 422 6 is_stmt 0 view .LVU718
+	testq	%r12, %r12
+	je	.L184
+	.loc 1 426 3 is_stmt 1 view .LVU719
+.LVL207:
+	.loc 1 427 3 view .LVU720
+	.loc 1 428 3 view .LVU721
+	.loc 1 426 33 is_stmt 0 view .LVU722
+	movq	16(%rbx), %rdi
+.LBE104:
+.LBE103:
+	.loc 1 532 51 view .LVU723
+	leaq	8(%rsp), %rdx
+.LBB112:
+.LBB111:
+	.loc 1 426 33 view .LVU724
+	addq	(%rbx), %rdi
+.LVL208:
+	.loc 1 426 33 view .LVU725
+.LBE111:
+.LBE112:
+	.loc 1 532 51 view .LVU726
+	movq	%r12, %rsi
+	call	stod@PLT
+.LVL209:
+	.loc 1 532 48 view .LVU727
+	testq	%rax, %rax
+	je	.L184
+	.loc 1 536 5 is_stmt 1 view .LVU728
+	.loc 1 536 17 is_stmt 0 view .LVU729
+	vmovsd	8(%rsp), %xmm0
+	.loc 1 536 8 view .LVU730
+	vmovsd	.LC0(%rip), %xmm1
+	vcomisd	%xmm0, %xmm1
+	ja	.L184
+	.loc 1 536 42 discriminator 1 view .LVU731
+	vcomisd	.LC1(%rip), %xmm0
+	jnb	.L184
+	.loc 1 536 100 discriminator 2 view .LVU732
+	vcvttsd2siq	%xmm0, %rax
+	.loc 1 536 92 discriminator 2 view .LVU733
+	vxorps	%xmm1, %xmm1, %xmm1
+	vcvtsi2sdq	%rax, %xmm1, %xmm1
+	.loc 1 536 78 discriminator 2 view .LVU734
+	vucomisd	%xmm1, %xmm0
+	jp	.L184
+	je	.L187
+.LVL210:
+.L184:
+	.loc 1 536 78 discriminator 2 view .LVU735
+.LBE102:
+	.loc 1 549 1 view .LVU736
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL211:
+	.loc 1 549 1 view .LVU737
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	.loc 1 525 12 view .LVU738
+	xorl	%eax, %eax
+	.loc 1 549 1 view .LVU739
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL212:
+	.loc 1 549 1 view .LVU740
+	ret
+.LVL213:
+	.p2align 4,,10
+	.p2align 3
+.L182:
+	.cfi_restore_state
+	.loc 1 524 3 is_stmt 1 view .LVU741
+	.loc 1 524 6 is_stmt 0 view .LVU742
+	testq	%r12, %r12
+	je	.L184
+	.loc 1 527 3 is_stmt 1 view .LVU743
+	.loc 1 527 8 is_stmt 0 view .LVU744
+	cmpq	%rbp, %r12
+	jb	.L192
+.L185:
+	.loc 1 542 10 view .LVU745
+	movq	(%rsp), %rax
+.LVL214:
+.L187:
+	.loc 1 542 3 is_stmt 1 view .LVU746
+	.loc 1 542 10 is_stmt 0 view .LVU747
+	movq	%rax, (%r14)
+	.loc 1 544 3 is_stmt 1 view .LVU748
+	.loc 1 544 23 is_stmt 0 view .LVU749
+	movq	16(%rbx), %rax
+	leaq	-1(%r12,%rax), %rax
+	movq	%rax, 16(%rbx)
+	.loc 1 545 3 is_stmt 1 view .LVU750
+	.loc 1 545 6 view .LVU751
+	.loc 1 546 3 view .LVU752
+	.loc 1 546 8 view .LVU753
+	.loc 1 546 6 view .LVU754
+	.loc 1 547 3 view .LVU755
+	.loc 1 547 8 view .LVU756
+	.loc 1 547 6 view .LVU757
+	.loc 1 548 3 view .LVU758
+	.loc 1 549 1 is_stmt 0 view .LVU759
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 548 10 view .LVU760
+	movl	$1, %eax
+	.loc 1 549 1 view .LVU761
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL215:
+	.loc 1 549 1 view .LVU762
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL216:
+	.loc 1 549 1 view .LVU763
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL217:
+	.loc 1 549 1 view .LVU764
+	ret
+	.cfi_endproc
+.LFE53:
+	.size	st_extract_int64, .-st_extract_int64
+	.p2align 4
+	.globl	st_extract_double
+	.type	st_extract_double, @function
+st_extract_double:
+.LVL218:
+.LFB54:
+	.loc 1 554 62 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 556 3 view .LVU766
+	.loc 1 557 3 view .LVU767
+	.loc 1 554 62 is_stmt 0 view .LVU768
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 557 7 view .LVU769
+	leaq	8(%rsp), %rsi
+	call	st_extract_double_to@PLT
+.LVL219:
+	.loc 1 557 6 view .LVU770
+	testl	%eax, %eax
+	je	.L216
+	.loc 1 561 3 is_stmt 1 view .LVU771
+	movq	64(%rbx), %rdi
+.LVL220:
+.LBB115:
+.LBI115:
+	.loc 1 260 14 view .LVU772
+.LBB116:
+	.loc 1 261 3 view .LVU773
+	.loc 1 261 6 is_stmt 0 view .LVU774
+	testq	%rdi, %rdi
+	je	.L214
+	.loc 1 262 5 is_stmt 1 view .LVU775
+	.loc 1 262 12 is_stmt 0 view .LVU776
+	movl	$8, %esi
+	call	st_arena_alloc@PLT
+.LVL221:
+	.loc 1 262 12 view .LVU777
+.LBE116:
+.LBE115:
+	.loc 1 562 3 is_stmt 1 view .LVU778
+	.loc 1 562 6 is_stmt 0 view .LVU779
+	testq	%rax, %rax
+	je	.L216
+.L221:
+	.loc 1 563 5 is_stmt 1 view .LVU780
+	.loc 1 563 12 is_stmt 0 view .LVU781
+	vmovsd	8(%rsp), %xmm0
+	vmovsd	%xmm0, (%rax)
+	.loc 1 566 1 view .LVU782
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL222:
+	.loc 1 566 1 view .LVU783
+	ret
+.LVL223:
+	.p2align 4,,10
+	.p2align 3
+.L214:
+	.cfi_restore_state
+.LBB118:
+.LBB117:
+	.loc 1 264 3 is_stmt 1 view .LVU784
+	.loc 1 264 8 view .LVU785
+	.loc 1 264 6 view .LVU786
+	.loc 1 265 3 view .LVU787
+	.loc 1 265 10 is_stmt 0 view .LVU788
+	movl	$8, %edi
+	call	malloc@PLT
+.LVL224:
+	.loc 1 265 10 view .LVU789
+.LBE117:
+.LBE118:
+	.loc 1 562 3 is_stmt 1 view .LVU790
+	.loc 1 562 6 is_stmt 0 view .LVU791
+	testq	%rax, %rax
+	jne	.L221
+.LVL225:
+.L216:
+	.loc 1 566 1 view .LVU792
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 558 11 view .LVU793
+	xorl	%eax, %eax
+	.loc 1 566 1 view .LVU794
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL226:
+	.loc 1 566 1 view .LVU795
+	ret
+	.cfi_endproc
+.LFE54:
+	.size	st_extract_double, .-st_extract_double
+	.p2align 4
+	.globl	st_starts_with
+	.type	st_starts_with, @function
+st_starts_with:
+.LVL227:
+.LFB55:
+	.loc 1 571 75 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 573 3 view .LVU797
+	.loc 1 571 75 is_stmt 0 view .LVU798
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12
+	.loc 1 573 19 view .LVU799
+	movq	%rsi, %rdi
+.LVL228:
+	.loc 1 571 75 view .LVU800
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 573 19 view .LVU801
+	call	strlen@PLT
+.LVL229:
+	.loc 1 576 7 view .LVU802
+	movl	%eax, %esi
+	movq	%rsp, %rdx
+	movq	%r12, %rdi
+	.loc 1 573 19 view .LVU803
+	movq	%rax, %rbp
+.LVL230:
+	.loc 1 575 3 is_stmt 1 view .LVU804
+	.loc 1 576 3 view .LVU805
+	.loc 1 576 7 is_stmt 0 view .LVU806
+	call	st_slice_string_view@PLT
+.LVL231:
+	.loc 1 576 6 view .LVU807
+	testl	%eax, %eax
+	je	.L223
+	.loc 1 580 3 is_stmt 1 view .LVU808
+	.loc 1 580 18 is_stmt 0 view .LVU809
+	movq	(%rsp), %r13
+	.loc 1 580 7 view .LVU810
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	%r13, %rdi
+	call	memcmp@PLT
+.LVL232:
+	movl	%eax, %edx
+	.loc 1 586 10 view .LVU811
+	movl	$1, %eax
+	.loc 1 580 6 view .LVU812
+	testl	%edx, %edx
+	jne	.L231
+	.loc 1 587 1 view .LVU813
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL233:
+	.loc 1 587 1 view .LVU814
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL234:
+	.loc 1 587 1 view .LVU815
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL235:
+	.loc 1 587 1 view .LVU816
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL236:
+	.p2align 4,,10
+	.p2align 3
+.L231:
+	.cfi_restore_state
+	.loc 1 582 5 is_stmt 1 view .LVU817
+	.loc 1 582 36 is_stmt 0 view .LVU818
+	subq	(%r12), %r13
+	.loc 1 582 25 view .LVU819
+	movq	%r13, 16(%r12)
+	.loc 1 583 5 is_stmt 1 view .LVU820
+.L223:
+	.loc 1 587 1 is_stmt 0 view .LVU821
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL237:
+	.loc 1 587 1 view .LVU822
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL238:
+	.loc 1 587 1 view .LVU823
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL239:
+	.loc 1 577 12 view .LVU824
+	xorl	%eax, %eax
+	.loc 1 587 1 view .LVU825
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE55:
+	.size	st_starts_with, .-st_starts_with
+	.p2align 4
+	.globl	st_extract_boolean
+	.type	st_extract_boolean, @function
+st_extract_boolean:
+.LVL240:
+.LFB56:
+	.loc 1 592 105 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 594 3 view .LVU827
+	.loc 1 592 105 is_stmt 0 view .LVU828
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%edx, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 594 7 view .LVU829
+	call	st_starts_with@PLT
+.LVL241:
+	.loc 1 594 6 view .LVU830
+	testl	%eax, %eax
+	je	.L237
+	.loc 1 598 3 is_stmt 1 view .LVU831
+	movq	64(%rbx), %rdi
+.LVL242:
+.LBB121:
+.LBI121:
+	.loc 1 260 14 view .LVU832
+.LBB122:
+	.loc 1 261 3 view .LVU833
+	.loc 1 261 6 is_stmt 0 view .LVU834
+	testq	%rdi, %rdi
+	je	.L235
+	.loc 1 262 5 is_stmt 1 view .LVU835
+	.loc 1 262 12 is_stmt 0 view .LVU836
+	movl	$4, %esi
+	call	st_arena_alloc@PLT
+.LVL243:
+	.loc 1 262 12 view .LVU837
+.LBE122:
+.LBE121:
+	.loc 1 600 3 is_stmt 1 view .LVU838
+	.loc 1 600 6 is_stmt 0 view .LVU839
+	testq	%rax, %rax
+	je	.L237
+.L242:
+	.loc 1 601 5 is_stmt 1 view .LVU840
+	.loc 1 601 12 is_stmt 0 view .LVU841
+	movl	%ebp, (%rax)
+	.loc 1 605 1 view .LVU842
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL244:
+	.loc 1 605 1 view .LVU843
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL245:
+	.loc 1 605 1 view .LVU844
+	ret
+.LVL246:
+	.p2align 4,,10
+	.p2align 3
+.L235:
+	.cfi_restore_state
+.LBB124:
+.LBB123:
+	.loc 1 264 3 is_stmt 1 view .LVU845
+	.loc 1 264 8 view .LVU846
+	.loc 1 264 6 view .LVU847
+	.loc 1 265 3 view .LVU848
+	.loc 1 265 10 is_stmt 0 view .LVU849
+	movl	$4, %edi
+	call	malloc@PLT
+.LVL247:
+	.loc 1 265 10 view .LVU850
+.LBE123:
+.LBE124:
+	.loc 1 600 3 is_stmt 1 view .LVU851
+	.loc 1 600 6 is_stmt 0 view .LVU852
+	testq	%rax, %rax
+	jne	.L242
+.LVL248:
+.L237:
+	.loc 1 605 1 view .LVU853
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL249:
+	.loc 1 595 11 view .LVU854
+	xorl	%eax, %eax
+	.loc 1 605 1 view .LVU855
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL250:
+	.loc 1 605 1 view .LVU856
+	ret
+	.cfi_endproc
+.LFE56:
+	.size	st_extract_boolean, .-st_extract_boolean
+	.p2align 4
+	.globl	st_expand_string
+	.type	st_expand_string, @function
+st_expand_string:
+.LVL251:
+.LFB58:
+	.loc 1 658 76 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 659 3 view .LVU858
+	.loc 1 659 16 is_stmt 0 view .LVU859
+	movl	56(%rdi), %edx
+	.loc 1 659 6 view .LVU860
+	cmpl	$2, %edx
+	je	.L266
+	.loc 1 658 76 discriminator 1 view .LVU861
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	.loc 1 659 48 discriminator 1 view .LVU862
+	cmpq	$0, 48(%rdi)
+	je	.L267
+.LVL252:
+.L246:
+	.loc 1 661 12 view .LVU863
+	xorl	%eax, %eax
+.L243:
+	.loc 1 688 1 view .LVU864
+	popq	%rbx
+.LVL253:
+	.loc 1 688 1 view .LVU865
+	popq	%r12
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL254:
+	.p2align 4,,10
+	.p2align 3
+.L267:
+	.cfi_restore_state
+.LBB130:
+.LBI130:
+	.loc 1 658 5 is_stmt 1 view .LVU866
+.LBB131:
+	.loc 1 664 3 view .LVU867
+	.loc 1 664 28 is_stmt 0 view .LVU868
+	movq	16(%rdi), %rdi
+	.loc 1 664 47 view .LVU869
+	movq	8(%rbx), %rax
+	.loc 1 664 28 view .LVU870
+	addq	%rsi, %rdi
+	.loc 1 664 6 view .LVU871
+	cmpq	%rax, %rdi
+	jb	.L248
+	.loc 1 669 3 is_stmt 1 view .LVU872
+	.loc 1 670 3 view .LVU873
+	.loc 1 671 32 is_stmt 0 view .LVU874
+	movq	24(%rbx), %r8
+	.loc 1 675 14 view .LVU875
+	movq	%rax, %rcx
+	cmpq	%rax, %r8
+	cmovnb	%r8, %rcx
+	.loc 1 670 6 view .LVU876
+	cmpl	$1, 32(%rbx)
+	je	.L268
+.L250:
+.LVL255:
+	.loc 1 677 3 is_stmt 1 view .LVU877
+	.loc 1 677 16 is_stmt 0 view .LVU878
+	movq	40(%rbx), %rsi
+.LVL256:
+	.loc 1 677 16 view .LVU879
+	cmpq	%rsi, %rcx
+	movq	%rsi, %r8
+	cmovbe	%rcx, %r8
+	testq	%rsi, %rsi
+	cmovne	%r8, %rcx
+.LVL257:
+	.loc 1 681 3 is_stmt 1 view .LVU880
+	.loc 1 681 10 is_stmt 0 view .LVU881
+	leaq	(%rax,%rcx), %r12
+.LVL258:
+	.loc 1 682 3 is_stmt 1 view .LVU882
+	.loc 1 683 16 is_stmt 0 view .LVU883
+	cmpq	%r12, %rdi
+	leaq	1(%rdi), %rax
+	cmovnb	%rax, %r12
+.LVL259:
+	.loc 1 686 3 is_stmt 1 view .LVU884
+	.loc 1 686 8 view .LVU885
+	.loc 1 686 6 view .LVU886
+	.loc 1 687 3 view .LVU887
+.LBB132:
+.LBI132:
+	.loc 1 618 12 view .LVU888
+.LBB133:
+	.loc 1 619 3 view .LVU889
+	.loc 1 623 3 view .LVU890
+	.loc 1 623 6 is_stmt 0 view .LVU891
+	cmpl	$3, %edx
+	jne	.L253
+.LBB134:
+	.loc 1 624 5 is_stmt 1 view .LVU892
+	.loc 1 624 8 is_stmt 0 view .LVU893
+	cmpq	$256, %r12
+	jbe	.L248
+	.loc 1 629 5 is_stmt 1 view .LVU894
+	.loc 1 629 28 is_stmt 0 view .LVU895
+	movq	%r12, %rdi
+	call	malloc@PLT
+.LVL260:
+	.loc 1 630 5 is_stmt 1 view .LVU896
+	.loc 1 630 10 view .LVU897
+	.loc 1 630 8 view .LVU898
+	.loc 1 631 5 view .LVU899
+	.loc 1 631 8 is_stmt 0 view .LVU900
+	testq	%rax, %rax
+	je	.L246
+	.loc 1 634 5 is_stmt 1 view .LVU901
+	.loc 1 634 10 view .LVU902
+	.loc 1 634 8 view .LVU903
+	.loc 1 635 5 view .LVU904
+	.loc 1 636 5 view .LVU905
+	.loc 1 635 5 is_stmt 0 view .LVU906
+	vmovdqu64	72(%rbx), %zmm0
+	vmovdqu64	136(%rbx), %zmm1
+	vmovdqu64	200(%rbx), %zmm2
+	vmovdqu64	264(%rbx), %zmm3
+	.loc 1 636 23 view .LVU907
+	movq	%rax, (%rbx)
+	.loc 1 637 5 is_stmt 1 view .LVU908
+	.loc 1 637 23 is_stmt 0 view .LVU909
+	movq	%r12, 8(%rbx)
+	.loc 1 638 5 is_stmt 1 view .LVU910
+	.loc 1 638 26 is_stmt 0 view .LVU911
+	movl	$1, 56(%rbx)
+	.loc 1 639 5 is_stmt 1 view .LVU912
+	.loc 1 635 5 is_stmt 0 view .LVU913
+	vmovdqu64	%zmm0, (%rax)
+	vmovdqu64	%zmm1, 64(%rax)
+	vmovdqu64	%zmm2, 128(%rax)
+	vmovdqu64	%zmm3, 192(%rax)
+	vzeroupper
+.LVL261:
+	.p2align 4,,10
+	.p2align 3
+.L248:
+	.loc 1 626 14 view .LVU914
+	movl	$1, %eax
+.LVL262:
+	.loc 1 626 14 view .LVU915
+	jmp	.L243
+.LVL263:
+	.p2align 4,,10
+	.p2align 3
+.L268:
+	.loc 1 626 14 view .LVU916
+.LBE134:
+.LBE133:
+.LBE132:
+	.loc 1 671 5 is_stmt 1 view .LVU917
+	.loc 1 671 14 is_stmt 0 view .LVU918
+	cmpq	%rsi, %r8
+	movq	%rsi, %rcx
+	cmovnb	%r8, %rcx
+.LVL264:
+	.loc 1 672 5 is_stmt 1 view .LVU919
+	.loc 1 672 35 is_stmt 0 view .LVU920
+	movq	%rcx, 24(%rbx)
+	jmp	.L250
+.LVL265:
+	.p2align 4,,10
+	.p2align 3
+.L266:
+	.cfi_def_cfa 7, 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.loc 1 672 35 view .LVU921
+.LBE131:
+.LBE130:
+	.loc 1 661 12 view .LVU922
+	xorl	%eax, %eax
+	.loc 1 688 1 view .LVU923
+	ret
+.LVL266:
+	.p2align 4,,10
+	.p2align 3
+.L253:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -32
+	.cfi_offset 6, -16
+	.cfi_offset 12, -24
+.LBB138:
+.LBB137:
+.LBB136:
+.LBB135:
+	.loc 1 641 3 is_stmt 1 view .LVU924
+	.loc 1 641 26 is_stmt 0 view .LVU925
+	movq	(%rbx), %rdi
+	movq	%r12, %rsi
+	call	realloc@PLT
+.LVL267:
+	.loc 1 642 3 is_stmt 1 view .LVU926
+	.loc 1 642 8 view .LVU927
+	.loc 1 642 6 view .LVU928
+	.loc 1 643 3 view .LVU929
+	.loc 1 643 6 is_stmt 0 view .LVU930
+	testq	%rax, %rax
+	je	.L246
+	.loc 1 648 3 is_stmt 1 view .LVU931
+	.loc 1 648 8 view .LVU932
+	.loc 1 648 6 view .LVU933
+	.loc 1 650 3 view .LVU934
+	.loc 1 650 21 is_stmt 0 view .LVU935
+	movq	%rax, (%rbx)
+	.loc 1 651 3 is_stmt 1 view .LVU936
+	.loc 1 651 21 is_stmt 0 view .LVU937
+	movq	%r12, 8(%rbx)
+	.loc 1 652 3 is_stmt 1 view .LVU938
+	.loc 1 652 10 is_stmt 0 view .LVU939
+	jmp	.L248
+.LBE135:
+.LBE136:
+.LBE137:
+.LBE138:
+	.cfi_endproc
+.LFE58:
+	.size	st_expand_string, .-st_expand_string
+	.p2align 4
+	.globl	st_set_growth_policy
+	.type	st_set_growth_policy, @function
+st_set_growth_policy:
+.LVL268:
+.LFB59:
+	.loc 1 693 128 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 694 3 view .LVU941
+	.loc 1 694 28 is_stmt 0 view .LVU942
+	movl	%esi, 32(%rdi)
+	.loc 1 695 3 is_stmt 1 view .LVU943
+	.loc 1 695 28 is_stmt 0 view .LVU944
+	movq	%rdx, 40(%rdi)
+	.loc 1 696 1 view .LVU945
+	ret
+	.cfi_endproc
+.LFE59:
+	.size	st_set_growth_policy, .-st_set_growth_policy
+	.p2align 4
+	.globl	st_reserve
+	.type	st_reserve, @function
+st_reserve:
+.LVL269:
+.LFB60:
+	.loc 1 701 72 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 702 3 view .LVU947
+	.loc 1 702 6 is_stmt 0 view .LVU948
+	cmpq	%rsi, 8(%rdi)
+	jb	.L287
+	.loc 1 704 12 view .LVU949
+	movl	$1, %eax
+	.loc 1 707 1 view .LVU950
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L287:
+	.loc 1 701 72 view .LVU951
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	.loc 1 706 3 is_stmt 1 view .LVU952
+.LVL270:
+.LBB142:
+.LBI142:
+	.loc 1 618 12 view .LVU953
+.LBB143:
+	.loc 1 619 3 view .LVU954
+.LBE143:
+.LBE142:
+	.loc 1 701 72 is_stmt 0 view .LVU955
+	subq	$24, %rsp
+.LBB147:
+.LBB145:
+	.loc 1 619 16 view .LVU956
+	movl	56(%rdi), %eax
+	.loc 1 619 6 view .LVU957
+	cmpl	$2, %eax
+	je	.L274
+.LVL271:
+	.loc 1 619 48 view .LVU958
+	cmpq	$0, 48(%rdi)
+	je	.L288
+.LVL272:
+.L274:
+	.loc 1 621 12 view .LVU959
+	xorl	%eax, %eax
+.L270:
+.LBE145:
+.LBE147:
+	.loc 1 707 1 view .LVU960
+	movq	-8(%rbp), %rbx
+.LVL273:
+	.loc 1 707 1 view .LVU961
+	leave
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL274:
+	.p2align 4,,10
+	.p2align 3
+.L288:
+	.cfi_restore_state
+.LBB148:
+.LBB146:
+	.loc 1 623 3 is_stmt 1 view .LVU962
+	.loc 1 623 6 is_stmt 0 view .LVU963
+	cmpl	$3, %eax
+	jne	.L275
+.LBB144:
+	.loc 1 624 5 is_stmt 1 view .LVU964
+	.loc 1 624 8 is_stmt 0 view .LVU965
+	cmpq	$256, %rsi
+	jbe	.L271
+	.loc 1 629 5 is_stmt 1 view .LVU966
+	.loc 1 629 28 is_stmt 0 view .LVU967
+	movq	%rsi, %rdi
+	movq	%rsi, 8(%rsp)
+	call	malloc@PLT
+.LVL275:
+	.loc 1 630 5 is_stmt 1 view .LVU968
+	.loc 1 630 10 view .LVU969
+	.loc 1 630 8 view .LVU970
+	.loc 1 631 5 view .LVU971
+	.loc 1 631 8 is_stmt 0 view .LVU972
+	testq	%rax, %rax
+	je	.L274
+	.loc 1 634 5 is_stmt 1 view .LVU973
+	.loc 1 634 10 view .LVU974
+	.loc 1 634 8 view .LVU975
+	.loc 1 635 5 view .LVU976
+	.loc 1 636 5 view .LVU977
+	.loc 1 637 23 is_stmt 0 view .LVU978
+	movq	8(%rsp), %rsi
+	.loc 1 635 5 view .LVU979
+	vmovdqu64	72(%rbx), %zmm0
+	vmovdqu64	136(%rbx), %zmm1
+	vmovdqu64	200(%rbx), %zmm2
+	vmovdqu64	264(%rbx), %zmm3
+	.loc 1 636 23 view .LVU980
+	movq	%rax, (%rbx)
+	.loc 1 637 5 is_stmt 1 view .LVU981
+	.loc 1 637 23 is_stmt 0 view .LVU982
+	movq	%rsi, 8(%rbx)
+	.loc 1 638 5 is_stmt 1 view .LVU983
+	.loc 1 638 26 is_stmt 0 view .LVU984
+	movl	$1, 56(%rbx)
+	.loc 1 639 5 is_stmt 1 view .LVU985
+	.loc 1 635 5 is_stmt 0 view .LVU986
+	vmovdqu64	%zmm0, (%rax)
+	vmovdqu64	%zmm1, 64(%rax)
+	vmovdqu64	%zmm2, 128(%rax)
+	vmovdqu64	%zmm3, 192(%rax)
+	vzeroupper
+.LVL276:
+	.loc 1 639 12 view .LVU987
+	jmp	.L271
+.LVL277:
+	.p2align 4,,10
+	.p2align 3
+.L275:
+	.loc 1 639 12 view .LVU988
+.LBE144:
+	.loc 1 641 3 is_stmt 1 view .LVU989
+	.loc 1 641 26 is_stmt 0 view .LVU990
+	movq	(%rdi), %rdi
+	movq	%rsi, 8(%rsp)
+	call	realloc@PLT
+.LVL278:
+	.loc 1 642 3 is_stmt 1 view .LVU991
+	.loc 1 642 8 view .LVU992
+	.loc 1 642 6 view .LVU993
+	.loc 1 643 3 view .LVU994
+	.loc 1 643 6 is_stmt 0 view .LVU995
+	testq	%rax, %rax
+	je	.L274
+	.loc 1 648 3 is_stmt 1 view .LVU996
+	.loc 1 648 8 view .LVU997
+	.loc 1 648 6 view .LVU998
+	.loc 1 650 3 view .LVU999
+	.loc 1 651 21 is_stmt 0 view .LVU1000
+	movq	8(%rsp), %rsi
+	.loc 1 650 21 view .LVU1001
+	movq	%rax, (%rbx)
+	.loc 1 651 3 is_stmt 1 view .LVU1002
+	.loc 1 651 21 is_stmt 0 view .LVU1003
+	movq	%rsi, 8(%rbx)
+	.loc 1 652 3 is_stmt 1 view .LVU1004
+.LVL279:
+.L271:
+	.loc 1 652 3 is_stmt 0 view .LVU1005
+.LBE146:
+.LBE148:
+	.loc 1 704 12 view .LVU1006
+	movl	$1, %eax
+	jmp	.L270
+	.cfi_endproc
+.LFE60:
+	.size	st_reserve, .-st_reserve
+	.p2align 4
+	.globl	st_pool_acquire
+	.type	st_pool_acquire, @function
+st_pool_acquire:
+.LVL280:
+.LFB35:
+	.loc 1 192 67 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 193 3 view .LVU1008
+	.loc 1 192 67 is_stmt 0 view .LVU1009
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 193 35 view .LVU1010
+	leaq	string_tokenizer_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL281:
+	.loc 1 193 35 view .LVU1011
+	movq	string_tokenizer_pool_count@dtpoff(%rax), %rdx
+	.loc 1 193 6 view .LVU1012
+	testq	%rdx, %rdx
+	je	.L293
+	.loc 1 196 3 is_stmt 1 view .LVU1013
+	.loc 1 196 61 is_stmt 0 view .LVU1014
+	decq	%rdx
+	.loc 1 196 27 view .LVU1015
+	movq	string_tokenizer_pool@dtpoff(%rax,%rdx,8), %rbp
+.LVL282:
+	.loc 1 197 3 is_stmt 1 view .LVU1016
+	.loc 1 197 7 is_stmt 0 view .LVU1017
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	.loc 1 196 27 view .LVU1018
+	movq	%rdx, string_tokenizer_pool_count@dtpoff(%rax)
+	.loc 1 197 7 view .LVU1019
+	call	st_reserve@PLT
+.LVL283:
+	.loc 1 197 6 view .LVU1020
+	testl	%eax, %eax
+	je	.L294
+.LVL284:
+.L289:
+	.loc 1 202 1 view .LVU1021
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL285:
+	.loc 1 202 1 view .LVU1022
+	movq	%rbp, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL286:
+	.p2align 4,,10
+	.p2align 3
+.L293:
+	.cfi_restore_state
+	.loc 1 194 5 is_stmt 1 view .LVU1023
+	.loc 1 202 1 is_stmt 0 view .LVU1024
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 194 12 view .LVU1025
+	movq	%rbx, %rdi
+	.loc 1 202 1 view .LVU1026
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL287:
+	.loc 1 202 1 view .LVU1027
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	.loc 1 194 12 view .LVU1028
+	jmp	st_create_empty@PLT
+.LVL288:
+	.p2align 4,,10
+	.p2align 3
+.L294:
+	.cfi_restore_state
+	.loc 1 198 5 is_stmt 1 view .LVU1029
+	movq	%rbp, %rdi
+	call	st_destroy@PLT
+.LVL289:
+	.loc 1 199 5 view .LVU1030
+	.loc 1 199 11 is_stmt 0 view .LVU1031
+	xorl	%ebp, %ebp
+.LVL290:
+	.loc 1 199 11 view .LVU1032
+	jmp	.L289
+	.cfi_endproc
+.LFE35:
+	.size	st_pool_acquire, .-st_pool_acquire
+	.p2align 4
+	.globl	st_shrink_to_fit
+	.type	st_shrink_to_fit, @function
+st_shrink_to_fit:
+.LVL291:
+.LFB61:
+	.loc 1 712 57 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 713 3 view .LVU1034
+	.loc 1 712 57 is_stmt 0 view .LVU1035
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$8, %rsp
+	.cfi_offset 13, -24
+	.cfi_offset 12, -32
+	.cfi_offset 3, -40
+	.loc 1 713 28 view .LVU1036
+	movq	16(%rdi), %r12
+	.loc 1 713 10 view .LVU1037
+	leaq	1(%r12), %r13
+.LVL292:
+	.loc 1 714 3 is_stmt 1 view .LVU1038
+	.loc 1 714 6 is_stmt 0 view .LVU1039
+	cmpq	8(%rdi), %r13
+	jb	.L310
+.LVL293:
+.L296:
+	.loc 1 724 1 view .LVU1040
+	addq	$8, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+.LVL294:
+	.loc 1 716 12 view .LVU1041
+	movl	$1, %eax
+	.loc 1 724 1 view .LVU1042
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL295:
+	.p2align 4,,10
+	.p2align 3
+.L310:
+	.cfi_restore_state
+.LBB152:
+.LBB153:
+	.loc 1 619 16 view .LVU1043
+	movl	56(%rdi), %eax
+	movq	%rdi, %rbx
+.LBE153:
+.LBE152:
+	.loc 1 718 3 is_stmt 1 view .LVU1044
+.LVL296:
+.LBB159:
+.LBI152:
+	.loc 1 618 12 view .LVU1045
+.LBB156:
+	.loc 1 619 3 view .LVU1046
+	.loc 1 619 6 is_stmt 0 view .LVU1047
+	cmpl	$2, %eax
+	je	.L299
+.LVL297:
+	.loc 1 619 48 view .LVU1048
+	cmpq	$0, 48(%rdi)
+	je	.L311
+.L299:
+	.loc 1 619 48 view .LVU1049
+.LBE156:
+.LBE159:
+	.loc 1 724 1 view .LVU1050
+	addq	$8, %rsp
+	popq	%rbx
+.LVL298:
+	.loc 1 724 1 view .LVU1051
+	popq	%r12
+	popq	%r13
+.LVL299:
+	.loc 1 719 12 view .LVU1052
+	xorl	%eax, %eax
+	.loc 1 724 1 view .LVU1053
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL300:
+	.p2align 4,,10
+	.p2align 3
+.L311:
+	.cfi_restore_state
+.LBB160:
+.LBB157:
+	.loc 1 623 3 is_stmt 1 view .LVU1054
+	.loc 1 623 6 is_stmt 0 view .LVU1055
+	cmpl	$3, %eax
+	jne	.L300
+.LBB154:
+	.loc 1 624 5 is_stmt 1 view .LVU1056
+	.loc 1 624 8 is_stmt 0 view .LVU1057
+	cmpq	$256, %r13
+	ja	.L301
+.LBE154:
+	.loc 1 641 43 view .LVU1058
+	movq	(%rdi), %rax
+	jmp	.L302
+	.p2align 4,,10
+	.p2align 3
+.L300:
+	.loc 1 641 3 is_stmt 1 view .LVU1059
+	.loc 1 641 26 is_stmt 0 view .LVU1060
+	movq	(%rdi), %rdi
+	movq	%r13, %rsi
+	call	realloc@PLT
+.LVL301:
+	.loc 1 642 3 is_stmt 1 view .LVU1061
+	.loc 1 642 8 view .LVU1062
+	.loc 1 642 6 view .LVU1063
+	.loc 1 643 3 view .LVU1064
+	.loc 1 643 6 is_stmt 0 view .LVU1065
+	testq	%rax, %rax
+	je	.L299
+	.loc 1 648 3 is_stmt 1 view .LVU1066
+	.loc 1 648 8 view .LVU1067
+	.loc 1 648 6 view .LVU1068
+	.loc 1 650 3 view .LVU1069
+	.loc 1 650 21 is_stmt 0 view .LVU1070
+	movq	%rax, (%rbx)
+	.loc 1 651 3 is_stmt 1 view .LVU1071
+	.loc 1 651 21 is_stmt 0 view .LVU1072
+	movq	%r13, 8(%rbx)
+	.loc 1 652 3 is_stmt 1 view .LVU1073
+.LVL302:
+	.loc 1 652 3 is_stmt 0 view .LVU1074
+.LBE157:
+.LBE160:
+	.loc 1 722 30 view .LVU1075
+	movq	16(%rbx), %r12
+.L302:
+	.loc 1 722 3 is_stmt 1 view .LVU1076
+	.loc 1 722 42 is_stmt 0 view .LVU1077
+	movb	$0, (%rax,%r12)
+	.loc 1 723 3 is_stmt 1 view .LVU1078
+	.loc 1 723 10 is_stmt 0 view .LVU1079
+	jmp	.L296
+.LVL303:
+	.p2align 4,,10
+	.p2align 3
+.L301:
+.LBB161:
+.LBB158:
+.LBB155:
+	.loc 1 629 5 is_stmt 1 view .LVU1080
+	.loc 1 629 28 is_stmt 0 view .LVU1081
+	movq	%r13, %rdi
+	call	malloc@PLT
+.LVL304:
+	.loc 1 630 5 is_stmt 1 view .LVU1082
+	.loc 1 630 10 view .LVU1083
+	.loc 1 630 8 view .LVU1084
+	.loc 1 631 5 view .LVU1085
+	.loc 1 631 8 is_stmt 0 view .LVU1086
+	testq	%rax, %rax
+	je	.L299
+	.loc 1 634 5 is_stmt 1 view .LVU1087
+	.loc 1 634 10 view .LVU1088
+	.loc 1 634 8 view .LVU1089
+	.loc 1 635 5 view .LVU1090
+	.loc 1 636 5 view .LVU1091
+	.loc 1 635 5 is_stmt 0 view .LVU1092
+	vmovdqu64	72(%rbx), %zmm0
+	vmovdqu64	136(%rbx), %zmm1
+	vmovdqu64	200(%rbx), %zmm2
+	vmovdqu64	264(%rbx), %zmm3
+	.loc 1 636 23 view .LVU1093
+	movq	%rax, (%rbx)
+	.loc 1 637 5 is_stmt 1 view .LVU1094
+	.loc 1 637 23 is_stmt 0 view .LVU1095
+	movq	%r13, 8(%rbx)
+	.loc 1 638 5 is_stmt 1 view .LVU1096
+	.loc 1 638 26 is_stmt 0 view .LVU1097
+	movl	$1, 56(%rbx)
+	.loc 1 639 5 is_stmt 1 view .LVU1098
+.LVL305:
+	.loc 1 635 5 is_stmt 0 view .LVU1099
+	vmovdqu64	%zmm0, (%rax)
+	vmovdqu64	%zmm1, 64(%rax)
+	vmovdqu64	%zmm2, 128(%rax)
+	vmovdqu64	%zmm3, 192(%rax)
+	vzeroupper
+.LVL306:
+	jmp	.L302
+.LBE155:
+.LBE158:
+.LBE161:
+	.cfi_endproc
+.LFE61:
+	.size	st_shrink_to_fit, .-st_shrink_to_fit
+	.p2align 4
+	.globl	st_append_n
+	.type	st_append_n, @function
+st_append_n:
+.LVL307:
+.LFB62:
+	.loc 1 729 93 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 731 3 view .LVU1101
+	.loc 1 729 93 is_stmt 0 view .LVU1102
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	.loc 1 731 7 view .LVU1103
+	movq	%rdx, %rsi
+.LVL308:
+	.loc 1 729 93 view .LVU1104
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 729 93 view .LVU1105
+	movq	%rdx, %rbx
+	.loc 1 731 7 view .LVU1106
+	call	st_expand_string@PLT
+.LVL309:
+	.loc 1 731 6 view .LVU1107
+	testl	%eax, %eax
+	je	.L312
+.LVL310:
+.LBB164:
+.LBI164:
+	.loc 1 729 5 is_stmt 1 view .LVU1108
+.LBB165:
+	.loc 1 735 3 view .LVU1109
+	.loc 1 735 28 is_stmt 0 view .LVU1110
+	movq	16(%rbp), %rdi
+	.loc 1 735 3 view .LVU1111
+	movq	%rbx, %rdx
+	.loc 1 735 28 view .LVU1112
+	addq	0(%rbp), %rdi
+	.loc 1 735 3 view .LVU1113
+	movq	%r12, %rsi
+	call	memcpy@PLT
+.LVL311:
+	.loc 1 736 3 is_stmt 1 view .LVU1114
+	.loc 1 738 42 is_stmt 0 view .LVU1115
+	movq	0(%rbp), %rax
+	.loc 1 736 23 view .LVU1116
+	addq	16(%rbp), %rbx
+.LVL312:
+	.loc 1 736 23 view .LVU1117
+	movq	%rbx, 16(%rbp)
+	.loc 1 738 3 is_stmt 1 view .LVU1118
+	.loc 1 738 42 is_stmt 0 view .LVU1119
+	movb	$0, (%rax,%rbx)
+	.loc 1 740 3 is_stmt 1 view .LVU1120
+.LVL313:
+	.loc 1 738 42 is_stmt 0 view .LVU1121
+	movl	$1, %eax
+.L312:
+.LBE165:
+.LBE164:
+	.loc 1 741 1 view .LVU1122
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL314:
+	.loc 1 741 1 view .LVU1123
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL315:
+	.loc 1 741 1 view .LVU1124
+	ret
+	.cfi_endproc
+.LFE62:
+	.size	st_append_n, .-st_append_n
+	.p2align 4
+	.globl	st_append_char
+	.type	st_append_char, @function
+st_append_char:
+.LVL316:
+.LFB63:
+	.loc 1 746 73 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 748 3 view .LVU1126
+	.loc 1 746 73 is_stmt 0 view .LVU1127
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%esi, %ebp
+	.loc 1 748 7 view .LVU1128
+	movl	$1, %esi
+.LVL317:
+	.loc 1 746 73 view .LVU1129
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 748 7 view .LVU1130
+	call	st_expand_string@PLT
+.LVL318:
+	.loc 1 748 6 view .LVU1131
+	testl	%eax, %eax
+	je	.L318
+	.loc 1 751 3 is_stmt 1 view .LVU1132
+	.loc 1 751 30 is_stmt 0 view .LVU1133
+	movq	16(%rbx), %rax
+	.loc 1 751 12 view .LVU1134
+	movq	(%rbx), %rdx
+	.loc 1 751 40 view .LVU1135
+	leaq	1(%rax), %rcx
+	movq	%rcx, 16(%rbx)
+	.loc 1 751 44 view .LVU1136
+	movb	%bpl, (%rdx,%rax)
+	.loc 1 753 3 is_stmt 1 view .LVU1137
+	.loc 1 753 42 is_stmt 0 view .LVU1138
+	movq	16(%rbx), %rax
+	movq	(%rbx), %rdx
+	movb	$0, (%rdx,%rax)
+	.loc 1 754 3 is_stmt 1 view .LVU1139
+	.loc 1 754 10 is_stmt 0 view .LVU1140
+	movl	$1, %eax
+.L318:
+	.loc 1 755 1 view .LVU1141
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL319:
+	.loc 1 755 1 view .LVU1142
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE63:
+	.size	st_append_char, .-st_append_char
+	.p2align 4
+	.globl	st_append_many
+	.type	st_append_many, @function
+st_append_many:
+.LVL320:
+.LFB64:
+	.loc 1 760 111 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 762 3 view .LVU1144
+	.loc 1 763 3 view .LVU1145
+.LBB166:
+	.loc 1 763 8 view .LVU1146
+	.loc 1 763 24 view .LVU1147
+.LBE166:
+	.loc 1 760 111 is_stmt 0 view .LVU1148
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_offset 14, -24
+	.cfi_offset 13, -32
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbx
+	andq	$-32, %rsp
+	.cfi_offset 3, -48
+.LBB167:
+	.loc 1 763 24 view .LVU1149
+	testq	%rdx, %rdx
+	je	.L325
+	movq	%rdx, %r14
+	leaq	-1(%rdx), %rdx
+.LVL321:
+	.loc 1 763 24 view .LVU1150
+	movq	%rsi, %rbx
+	cmpq	$4, %rdx
+	jbe	.L334
+	movq	%rdx, %rcx
+	shrq	$2, %rcx
+	salq	$6, %rcx
+	vmovdqa	.LC2(%rip), %ymm2
+	movq	%rsi, %rax
+	addq	%rsi, %rcx
+	vpxor	%xmm1, %xmm1, %xmm1
+.LVL322:
+	.p2align 4,,10
+	.p2align 3
+.L327:
+	.loc 1 764 5 is_stmt 1 discriminator 3 view .LVU1151
+	.loc 1 764 27 is_stmt 0 discriminator 3 view .LVU1152
+	vmovdqu	8(%rax), %ymm0
+	addq	$64, %rax
+	vpermt2q	-24(%rax), %ymm2, %ymm0
+	.loc 1 764 12 discriminator 3 view .LVU1153
+	vpaddq	%ymm0, %ymm1, %ymm1
+.LVL323:
+	.loc 1 763 34 is_stmt 1 discriminator 3 view .LVU1154
+	.loc 1 763 24 discriminator 3 view .LVU1155
+	cmpq	%rcx, %rax
+	jne	.L327
+	vmovdqa	%xmm1, %xmm0
+	vextracti64x2	$0x1, %ymm1, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	movq	%rdx, %rax
+	vpaddq	%xmm1, %xmm0, %xmm0
+	andq	$-4, %rax
+	vmovq	%xmm0, %r13
+	vzeroupper
+.LVL324:
+.L326:
+	.loc 1 764 5 view .LVU1156
+	.loc 1 764 24 is_stmt 0 view .LVU1157
+	movq	%rax, %rdx
+	salq	$4, %rdx
+	.loc 1 763 34 view .LVU1158
+	leaq	1(%rax), %rcx
+	.loc 1 764 12 view .LVU1159
+	addq	8(%rbx,%rdx), %r13
+.LVL325:
+	.loc 1 763 34 is_stmt 1 view .LVU1160
+	.loc 1 763 24 view .LVU1161
+	cmpq	%r14, %rcx
+	jnb	.L328
+	.loc 1 764 5 view .LVU1162
+	.loc 1 763 34 is_stmt 0 view .LVU1163
+	leaq	2(%rax), %rcx
+	.loc 1 764 12 view .LVU1164
+	addq	24(%rbx,%rdx), %r13
+.LVL326:
+	.loc 1 763 34 is_stmt 1 view .LVU1165
+	.loc 1 763 24 view .LVU1166
+	cmpq	%r14, %rcx
+	jnb	.L328
+	.loc 1 764 5 view .LVU1167
+	.loc 1 763 34 is_stmt 0 view .LVU1168
+	leaq	3(%rax), %rcx
+	.loc 1 764 12 view .LVU1169
+	addq	40(%rbx,%rdx), %r13
+.LVL327:
+	.loc 1 763 34 is_stmt 1 view .LVU1170
+	.loc 1 763 24 view .LVU1171
+	cmpq	%r14, %rcx
+	jnb	.L328
+	.loc 1 764 5 view .LVU1172
+	.loc 1 763 34 is_stmt 0 view .LVU1173
+	addq	$4, %rax
+	.loc 1 764 12 view .LVU1174
+	addq	56(%rbx,%rdx), %r13
+.LVL328:
+	.loc 1 763 34 is_stmt 1 view .LVU1175
+	.loc 1 763 24 view .LVU1176
+	cmpq	%r14, %rax
+	jnb	.L328
+	.loc 1 764 5 view .LVU1177
+	.loc 1 764 12 is_stmt 0 view .LVU1178
+	addq	72(%rbx,%rdx), %r13
+.LVL329:
+	.loc 1 763 34 is_stmt 1 view .LVU1179
+	.loc 1 763 24 view .LVU1180
+.L328:
+	.loc 1 763 24 is_stmt 0 view .LVU1181
+.LBE167:
+	.loc 1 766 3 is_stmt 1 view .LVU1182
+	.loc 1 766 7 is_stmt 0 view .LVU1183
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+.LVL330:
+	.loc 1 766 7 view .LVU1184
+	call	st_expand_string@PLT
+.LVL331:
+	.loc 1 766 6 view .LVU1185
+	testl	%eax, %eax
+	je	.L332
+	.loc 1 770 3 is_stmt 1 view .LVU1186
+	.loc 1 770 9 is_stmt 0 view .LVU1187
+	movq	16(%r12), %rcx
+	salq	$4, %r14
+.LVL332:
+	.loc 1 770 9 view .LVU1188
+	addq	(%r12), %rcx
+.LVL333:
+	.loc 1 771 3 is_stmt 1 view .LVU1189
+.LBB168:
+	.loc 1 771 8 view .LVU1190
+	.loc 1 771 24 view .LVU1191
+	addq	%rbx, %r14
+.LVL334:
+	.p2align 4,,10
+	.p2align 3
+.L331:
+	.loc 1 772 5 discriminator 3 view .LVU1192
+	movq	(%rbx), %rsi
+	movq	8(%rbx), %rdx
+	movq	%rcx, %rdi
+	call	memcpy@PLT
+.LVL335:
+	.loc 1 773 17 is_stmt 0 discriminator 3 view .LVU1193
+	movq	8(%rbx), %rcx
+	.loc 1 771 24 discriminator 3 view .LVU1194
+	addq	$16, %rbx
+	.loc 1 773 17 discriminator 3 view .LVU1195
+	addq	%rax, %rcx
+	.loc 1 771 34 is_stmt 1 discriminator 3 view .LVU1196
+	.loc 1 771 24 discriminator 3 view .LVU1197
+	cmpq	%r14, %rbx
+	jne	.L331
+.LVL336:
+.L333:
+	.loc 1 771 24 is_stmt 0 discriminator 3 view .LVU1198
+.LBE168:
+	.loc 1 775 3 is_stmt 1 view .LVU1199
+	.loc 1 777 42 is_stmt 0 view .LVU1200
+	movq	(%r12), %rax
+	.loc 1 775 23 view .LVU1201
+	addq	16(%r12), %r13
+	movq	%r13, 16(%r12)
+	.loc 1 777 3 is_stmt 1 view .LVU1202
+	.loc 1 777 42 is_stmt 0 view .LVU1203
+	movb	$0, (%rax,%r13)
+	.loc 1 778 3 is_stmt 1 view .LVU1204
+	.loc 1 779 1 is_stmt 0 view .LVU1205
+	leaq	-32(%rbp), %rsp
+	.loc 1 778 10 view .LVU1206
+	movl	$1, %eax
+	.loc 1 779 1 view .LVU1207
+	popq	%rbx
+	popq	%r12
+.LVL337:
+	.loc 1 779 1 view .LVU1208
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL338:
+	.p2align 4,,10
+	.p2align 3
+.L325:
+	.cfi_restore_state
+	.loc 1 766 3 is_stmt 1 view .LVU1209
+	.loc 1 766 7 is_stmt 0 view .LVU1210
+	xorl	%esi, %esi
+.LVL339:
+	.loc 1 766 7 view .LVU1211
+	call	st_expand_string@PLT
+.LVL340:
+	.loc 1 762 10 view .LVU1212
+	xorl	%r13d, %r13d
+	.loc 1 766 6 view .LVU1213
+	testl	%eax, %eax
+	jne	.L333
+.LVL341:
+.L332:
+	.loc 1 779 1 view .LVU1214
+	leaq	-32(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+.LVL342:
+	.loc 1 779 1 view .LVU1215
+	popq	%r13
+	popq	%r14
+	.loc 1 767 12 view .LVU1216
+	xorl	%eax, %eax
+	.loc 1 779 1 view .LVU1217
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL343:
+.L334:
+	.cfi_restore_state
+.LBB169:
+	.loc 1 763 15 view .LVU1218
+	xorl	%eax, %eax
+.LBE169:
+	.loc 1 762 10 view .LVU1219
+	xorl	%r13d, %r13d
+	jmp	.L326
+	.cfi_endproc
+.LFE64:
+	.size	st_append_many, .-st_append_many
+	.p2align 4
+	.globl	st_append_string
+	.type	st_append_string, @function
+st_append_string:
+.LVL344:
+.LFB65:
+	.loc 1 784 77 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 785 3 view .LVU1221
+	.loc 1 784 77 is_stmt 0 view .LVU1222
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	.loc 1 785 10 view .LVU1223
+	movq	%rsi, %rdi
+.LVL345:
+	.loc 1 784 77 view .LVU1224
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 785 10 view .LVU1225
+	call	strlen@PLT
+.LVL346:
+	.loc 1 786 1 view .LVU1226
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	.loc 1 785 10 view .LVU1227
+	movq	%rbx, %rsi
+	.loc 1 786 1 view .LVU1228
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL347:
+	.loc 1 785 10 view .LVU1229
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	.loc 1 786 1 view .LVU1230
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL348:
+	.loc 1 785 10 view .LVU1231
+	jmp	st_append_n@PLT
+.LVL349:
+	.loc 1 785 10 view .LVU1232
+	.cfi_endproc
+.LFE65:
+	.size	st_append_string, .-st_append_string
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"\""
+	.text
+	.p2align 4
+	.globl	st_append_quoted_string
+	.type	st_append_quoted_string, @function
+st_append_quoted_string:
+.LVL350:
+.LFB66:
+	.loc 1 791 84 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 792 3 view .LVU1234
+	.loc 1 791 84 is_stmt 0 view .LVU1235
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 792 21 view .LVU1236
+	leaq	.LC3(%rip), %rbp
+	.loc 1 791 84 view .LVU1237
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+.LVL351:
+	.loc 1 791 84 view .LVU1238
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 792 21 view .LVU1239
+	movq	%rbp, (%rsp)
+	movq	%rsi, 16(%rsp)
+	movq	$1, 8(%rsp)
+	.loc 1 792 56 view .LVU1240
+	call	strlen@PLT
+.LVL352:
+	.loc 1 793 10 view .LVU1241
+	movq	%rsp, %rsi
+	movq	%rbx, %rdi
+	movl	$3, %edx
+	.loc 1 792 21 view .LVU1242
+	movq	%rbp, 32(%rsp)
+	movq	%rax, 24(%rsp)
+	movq	$1, 40(%rsp)
+	.loc 1 793 3 is_stmt 1 view .LVU1243
+	.loc 1 793 10 is_stmt 0 view .LVU1244
+	call	st_append_many@PLT
+.LVL353:
+	.loc 1 794 1 view .LVU1245
+	addq	$56, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL354:
+	.loc 1 794 1 view .LVU1246
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE66:
+	.size	st_append_quoted_string, .-st_append_quoted_string
+	.p2align 4
+	.globl	st_append_escaped_n
+	.type	st_append_escaped_n, @function
+st_append_escaped_n:
+.LVL355:
+.LFB67:
+	.loc 1 799 101 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 800 3 view .LVU1248
+	.loc 1 802 3 view .LVU1249
+	.loc 1 799 101 is_stmt 0 view .LVU1250
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	.loc 1 802 7 view .LVU1251
+	leaq	2(%rdx), %rsi
+.LVL356:
+	.loc 1 799 101 view .LVU1252
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 802 7 view .LVU1253
+	call	st_expand_string@PLT
+.LVL357:
+	.loc 1 802 6 view .LVU1254
+	testl	%eax, %eax
+	je	.L349
+	.loc 1 805 3 is_stmt 1 view .LVU1255
+	.loc 1 805 30 is_stmt 0 view .LVU1256
+	movq	16(%r14), %rax
+	.loc 1 805 12 view .LVU1257
+	movq	(%r14), %rdx
+	.loc 1 805 40 view .LVU1258
+	leaq	1(%rax), %rsi
+	movq	%rsi, 16(%r14)
+	.loc 1 805 44 view .LVU1259
+	movb	$34, (%rdx,%rax)
+	.loc 1 806 3 is_stmt 1 view .LVU1260
+.LVL358:
+	.loc 1 807 3 view .LVU1261
+	.loc 1 807 16 view .LVU1262
+	testq	%rbp, %rbp
+	je	.L348
+	.loc 1 806 10 is_stmt 0 view .LVU1263
+	xorl	%r13d, %r13d
+.LVL359:
+	.p2align 4,,10
+	.p2align 3
+.L361:
+.LBB170:
+	.loc 1 809 5 is_stmt 1 view .LVU1264
+	.loc 1 809 18 is_stmt 0 view .LVU1265
+	leaq	(%r12,%r13), %r15
+	movq	%rbp, %rsi
+	subq	%r13, %rsi
+	movq	%r15, %rdi
+	call	st_scan_escape@PLT
+.LVL360:
+	.loc 1 810 9 view .LVU1266
+	leaq	7(%rax), %rsi
+	movq	%r14, %rdi
+	.loc 1 809 18 view .LVU1267
+	movq	%rax, %rbx
+.LVL361:
+	.loc 1 810 5 is_stmt 1 view .LVU1268
+	.loc 1 810 9 is_stmt 0 view .LVU1269
+	call	st_expand_string@PLT
+.LVL362:
+	.loc 1 810 8 view .LVU1270
+	testl	%eax, %eax
+	je	.L349
+	.loc 1 813 5 is_stmt 1 view .LVU1271
+	.loc 1 813 30 is_stmt 0 view .LVU1272
+	movq	16(%r14), %rdi
+	.loc 1 813 5 view .LVU1273
+	movq	%rbx, %rdx
+	.loc 1 813 30 view .LVU1274
+	addq	(%r14), %rdi
+	.loc 1 813 5 view .LVU1275
+	movq	%r15, %rsi
+	call	memcpy@PLT
+.LVL363:
+	.loc 1 814 5 is_stmt 1 view .LVU1276
+	.loc 1 814 25 is_stmt 0 view .LVU1277
+	movq	16(%r14), %rax
+	addq	%rbx, %rax
+	.loc 1 815 11 view .LVU1278
+	addq	%r13, %rbx
+.LVL364:
+	.loc 1 814 25 view .LVU1279
+	movq	%rax, 16(%r14)
+	.loc 1 815 5 is_stmt 1 view .LVU1280
+.LVL365:
+	.loc 1 816 5 view .LVU1281
+	.loc 1 816 8 is_stmt 0 view .LVU1282
+	cmpq	%rbx, %rbp
+	je	.L350
+	.loc 1 820 5 is_stmt 1 view .LVU1283
+	.loc 1 821 48 is_stmt 0 view .LVU1284
+	movzbl	(%r12,%rbx), %edx
+	.loc 1 820 11 view .LVU1285
+	addq	(%r14), %rax
+.LVL366:
+	.loc 1 821 5 is_stmt 1 view .LVU1286
+	.loc 1 822 20 is_stmt 0 view .LVU1287
+	movb	$92, (%rax)
+	.loc 1 821 54 view .LVU1288
+	leaq	1(%rbx), %r13
+.LVL367:
+	.loc 1 822 5 is_stmt 1 view .LVU1289
+	.loc 1 823 5 view .LVU1290
+	cmpb	$34, %dl
+	jg	.L351
+	cmpb	$7, %dl
+	jle	.L352
+	leal	-8(%rdx), %esi
+	cmpb	$26, %sil
+	ja	.L352
+	leaq	.L354(%rip), %rcx
+	movzbl	%sil, %esi
+	movslq	(%rcx,%rsi,4), %rsi
+	addq	%rcx, %rsi
+	jmp	*%rsi
+	.section	.rodata
+	.align 4
+	.align 4
+.L354:
+	.long	.L359-.L354
+	.long	.L358-.L354
+	.long	.L357-.L354
+	.long	.L352-.L354
+	.long	.L362-.L354
+	.long	.L355-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L352-.L354
+	.long	.L356-.L354
+	.text
+	.p2align 4,,10
+	.p2align 3
+.L351:
+	cmpb	$92, %dl
+	je	.L356
+.L352:
+	.loc 1 844 9 discriminator 1 view .LVU1291
+	.loc 1 845 43 is_stmt 0 discriminator 1 view .LVU1292
+	movl	%edx, %esi
+	.loc 1 844 9 discriminator 1 view .LVU1293
+	movl	$12405, %ecx
+	.loc 1 845 43 discriminator 1 view .LVU1294
+	shrb	$4, %sil
+	.loc 1 844 9 discriminator 1 view .LVU1295
+	movw	%cx, 1(%rax)
+	.loc 1 845 24 discriminator 1 view .LVU1296
+	xorl	%ebx, %ebx
+	leaq	hex_digits.0(%rip), %rcx
+	.loc 1 845 36 discriminator 1 view .LVU1297
+	andl	$15, %esi
+	.loc 1 845 24 discriminator 1 view .LVU1298
+	movb	(%rcx,%rsi), %bl
+	.loc 1 846 36 discriminator 1 view .LVU1299
+	andl	$15, %edx
+.LVL368:
+	.loc 1 845 24 discriminator 1 view .LVU1300
+	movb	(%rcx,%rdx), %bh
+	.loc 1 844 9 discriminator 1 view .LVU1301
+	movb	$48, 3(%rax)
+	.loc 1 845 9 is_stmt 1 discriminator 1 view .LVU1302
+	.loc 1 846 9 discriminator 1 view .LVU1303
+	.loc 1 845 24 is_stmt 0 discriminator 1 view .LVU1304
+	movw	%bx, 4(%rax)
+	.loc 1 847 9 is_stmt 1 discriminator 1 view .LVU1305
+	.loc 1 847 29 is_stmt 0 discriminator 1 view .LVU1306
+	movq	16(%r14), %rax
+.LVL369:
+	.loc 1 847 29 discriminator 1 view .LVU1307
+	addq	$6, %rax
+	.loc 1 848 9 is_stmt 1 discriminator 1 view .LVU1308
+	.p2align 4,,10
+	.p2align 3
+.L360:
+	.loc 1 847 29 is_stmt 0 view .LVU1309
+	movq	%rax, 16(%r14)
+	.loc 1 847 29 view .LVU1310
+.LBE170:
+	.loc 1 807 16 is_stmt 1 view .LVU1311
+	cmpq	%rbp, %r13
+	jb	.L361
+.LVL370:
+.L350:
+	.loc 1 852 3 view .LVU1312
+	.loc 1 852 12 is_stmt 0 view .LVU1313
+	movq	(%r14), %rdx
+	.loc 1 852 40 view .LVU1314
+	leaq	1(%rax), %rsi
+	movq	%rsi, 16(%r14)
+	.loc 1 852 44 view .LVU1315
+	movb	$34, (%rdx,%rax)
+	.loc 1 854 3 is_stmt 1 view .LVU1316
+	.loc 1 854 42 is_stmt 0 view .LVU1317
+	movq	16(%r14), %rax
+	movq	(%r14), %rdx
+	movb	$0, (%rdx,%rax)
+	.loc 1 855 3 is_stmt 1 view .LVU1318
+	.loc 1 856 1 is_stmt 0 view .LVU1319
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 855 10 view .LVU1320
+	movl	$1, %eax
+	.loc 1 856 1 view .LVU1321
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL371:
+	.loc 1 856 1 view .LVU1322
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL372:
+	.loc 1 856 1 view .LVU1323
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL373:
+	.loc 1 856 1 view .LVU1324
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL374:
+	.p2align 4,,10
+	.p2align 3
+.L357:
+	.cfi_restore_state
+.LBB171:
+	.loc 1 835 9 is_stmt 1 view .LVU1325
+	.loc 1 836 9 view .LVU1326
+	movl	$110, %edx
+.LVL375:
+.L356:
+	.loc 1 826 24 is_stmt 0 view .LVU1327
+	movb	%dl, 1(%rax)
+	.loc 1 850 5 is_stmt 1 view .LVU1328
+	.loc 1 850 25 is_stmt 0 view .LVU1329
+	movq	16(%r14), %rax
+.LVL376:
+	.loc 1 850 25 view .LVU1330
+	addq	$2, %rax
+	jmp	.L360
+.LVL377:
+	.p2align 4,,10
+	.p2align 3
+.L355:
+	.loc 1 838 9 is_stmt 1 view .LVU1331
+	.loc 1 839 9 view .LVU1332
+	movl	$114, %edx
+.LVL378:
+	.loc 1 826 24 is_stmt 0 view .LVU1333
+	movb	%dl, 1(%rax)
+	.loc 1 850 5 is_stmt 1 view .LVU1334
+	.loc 1 850 25 is_stmt 0 view .LVU1335
+	movq	16(%r14), %rax
+.LVL379:
+	.loc 1 850 25 view .LVU1336
+	addq	$2, %rax
+	jmp	.L360
+.LVL380:
+	.p2align 4,,10
+	.p2align 3
+.L358:
+	.loc 1 841 9 is_stmt 1 view .LVU1337
+	.loc 1 842 9 view .LVU1338
+	movl	$116, %edx
+.LVL381:
+	.loc 1 826 24 is_stmt 0 view .LVU1339
+	movb	%dl, 1(%rax)
+	.loc 1 850 5 is_stmt 1 view .LVU1340
+	.loc 1 850 25 is_stmt 0 view .LVU1341
+	movq	16(%r14), %rax
+.LVL382:
+	.loc 1 850 25 view .LVU1342
+	addq	$2, %rax
+	jmp	.L360
+.LVL383:
+	.p2align 4,,10
+	.p2align 3
+.L349:
+	.loc 1 850 25 view .LVU1343
+.LBE171:
+	.loc 1 856 1 view .LVU1344
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL384:
+	.loc 1 856 1 view .LVU1345
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL385:
+	.loc 1 856 1 view .LVU1346
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL386:
+	.loc 1 803 12 view .LVU1347
+	xorl	%eax, %eax
+	.loc 1 856 1 view .LVU1348
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL387:
+	.p2align 4,,10
+	.p2align 3
+.L362:
+	.cfi_restore_state
+.LBB172:
+	.loc 1 823 5 view .LVU1349
+	movl	$102, %edx
+.LVL388:
+	.loc 1 826 24 view .LVU1350
+	movb	%dl, 1(%rax)
+	.loc 1 850 5 is_stmt 1 view .LVU1351
+	.loc 1 850 25 is_stmt 0 view .LVU1352
+	movq	16(%r14), %rax
+.LVL389:
+	.loc 1 850 25 view .LVU1353
+	addq	$2, %rax
+	jmp	.L360
+.LVL390:
+	.p2align 4,,10
+	.p2align 3
+.L359:
+	.loc 1 823 5 view .LVU1354
+	movl	$98, %edx
+.LVL391:
+	.loc 1 826 24 view .LVU1355
+	movb	%dl, 1(%rax)
+	.loc 1 850 5 is_stmt 1 view .LVU1356
+	.loc 1 850 25 is_stmt 0 view .LVU1357
+	movq	16(%r14), %rax
+.LVL392:
+	.loc 1 850 25 view .LVU1358
+	addq	$2, %rax
+	jmp	.L360
+.LVL393:
+.L348:
+	.loc 1 850 25 view .LVU1359
+.LBE172:
+	.loc 1 852 30 view .LVU1360
+	movq	16(%r14), %rax
+	jmp	.L350
+	.cfi_endproc
+.LFE67:
+	.size	st_append_escaped_n, .-st_append_escaped_n
+	.p2align 4
+	.globl	st_append_escaped_string
+	.type	st_append_escaped_string, @function
+st_append_escaped_string:
+.LVL394:
+.LFB68:
+	.loc 1 861 85 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 862 3 view .LVU1362
+	.loc 1 861 85 is_stmt 0 view .LVU1363
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	.loc 1 862 10 view .LVU1364
+	movq	%rsi, %rdi
+.LVL395:
+	.loc 1 861 85 view .LVU1365
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 862 10 view .LVU1366
+	call	strlen@PLT
+.LVL396:
+	.loc 1 863 1 view .LVU1367
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	.loc 1 862 10 view .LVU1368
+	movq	%rbx, %rsi
+	.loc 1 863 1 view .LVU1369
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL397:
+	.loc 1 862 10 view .LVU1370
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	.loc 1 863 1 view .LVU1371
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL398:
+	.loc 1 862 10 view .LVU1372
+	jmp	st_append_escaped_n@PLT
+.LVL399:
+	.loc 1 862 10 view .LVU1373
+	.cfi_endproc
+.LFE68:
+	.size	st_append_escaped_string, .-st_append_escaped_string
+	.p2align 4
+	.globl	st_append_int
+	.type	st_append_int, @function
+st_append_int:
+.LVL400:
+.LFB69:
+	.loc 1 868 75 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 870 3 view .LVU1375
+	.loc 1 868 75 is_stmt 0 view .LVU1376
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	.loc 1 870 7 view .LVU1377
+	movl	$21, %esi
+.LVL401:
+	.loc 1 868 75 view .LVU1378
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 870 7 view .LVU1379
+	call	st_expand_string@PLT
+.LVL402:
+	.loc 1 870 6 view .LVU1380
+	testl	%eax, %eax
+	je	.L373
+	.loc 1 874 3 is_stmt 1 view .LVU1381
+.LVL403:
+	.loc 1 875 3 view .LVU1382
+	.loc 1 875 26 is_stmt 0 view .LVU1383
+	movq	16(%rbx), %rdi
+	movq	%rbp, %rsi
+	addq	(%rbx), %rdi
+	call	i64tos_to@PLT
+.LVL404:
+	.loc 1 875 23 view .LVU1384
+	addq	%rax, 16(%rbx)
+	.loc 1 876 3 is_stmt 1 view .LVU1385
+	.loc 1 876 6 view .LVU1386
+	.loc 1 877 3 view .LVU1387
+	.loc 1 877 10 is_stmt 0 view .LVU1388
+	movl	$1, %eax
+.LVL405:
+.L373:
+	.loc 1 878 1 view .LVU1389
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL406:
+	.loc 1 878 1 view .LVU1390
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL407:
+	.loc 1 878 1 view .LVU1391
+	ret
+	.cfi_endproc
+.LFE69:
+	.size	st_append_int, .-st_append_int
+	.p2align 4
+	.globl	st_append_double
+	.type	st_append_double, @function
+st_append_double:
+.LVL408:
+.LFB70:
+	.loc 1 883 78 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 885 3 view .LVU1393
+	.loc 1 883 78 is_stmt 0 view .LVU1394
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	.loc 1 885 7 view .LVU1395
+	movl	$32, %esi
+.LVL409:
+	.loc 1 883 78 view .LVU1396
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 885 7 view .LVU1397
+	call	st_expand_string@PLT
+.LVL410:
+	.loc 1 885 6 view .LVU1398
+	testl	%eax, %eax
+	je	.L379
+	.loc 1 889 3 is_stmt 1 view .LVU1399
+.LVL411:
+	.loc 1 890 3 view .LVU1400
+	.loc 1 890 26 is_stmt 0 view .LVU1401
+	movq	16(%rbx), %rdi
+	vmovsd	0(%rbp), %xmm0
+	addq	(%rbx), %rdi
+	call	dtos_to@PLT
+.LVL412:
+	.loc 1 890 23 view .LVU1402
+	addq	%rax, 16(%rbx)
+	.loc 1 891 3 is_stmt 1 view .LVU1403
+	.loc 1 891 6 view .LVU1404
+	.loc 1 892 3 view .LVU1405
+	.loc 1 892 10 is_stmt 0 view .LVU1406
+	movl	$1, %eax
+.LVL413:
+.L379:
+	.loc 1 893 1 view .LVU1407
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL414:
+	.loc 1 893 1 view .LVU1408
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL415:
+	.loc 1 893 1 view .LVU1409
+	ret
+	.cfi_endproc
+.LFE70:
+	.size	st_append_double, .-st_append_double
+	.p2align 4
+	.globl	st_append_double_precision
+	.type	st_append_double_precision, @function
+st_append_double_precision:
+.LVL416:
+.LFB71:
+	.loc 1 898 109 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 900 3 view .LVU1411
+	.loc 1 898 109 is_stmt 0 view .LVU1412
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	.loc 1 900 7 view .LVU1413
+	movl	$32, %esi
+.LVL417:
+	.loc 1 898 109 view .LVU1414
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 898 109 view .LVU1415
+	movq	%rdi, %rbx
+	.loc 1 900 7 view .LVU1416
+	call	st_expand_string@PLT
+.LVL418:
+	.loc 1 900 6 view .LVU1417
+	testl	%eax, %eax
+	je	.L385
+	.loc 1 904 3 is_stmt 1 view .LVU1418
+.LVL419:
+	.loc 1 905 3 view .LVU1419
+	.loc 1 905 26 is_stmt 0 view .LVU1420
+	movq	16(%rbx), %rdi
+	vmovsd	0(%rbp), %xmm0
+	addq	(%rbx), %rdi
+	movl	%r12d, %esi
+	call	dtos_precision_to@PLT
+.LVL420:
+	.loc 1 905 23 view .LVU1421
+	addq	%rax, 16(%rbx)
+	.loc 1 906 3 is_stmt 1 view .LVU1422
+	.loc 1 906 6 view .LVU1423
+	.loc 1 907 3 view .LVU1424
+	.loc 1 907 10 is_stmt 0 view .LVU1425
+	movl	$1, %eax
+.LVL421:
+.L385:
+	.loc 1 908 1 view .LVU1426
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL422:
+	.loc 1 908 1 view .LVU1427
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL423:
+	.loc 1 908 1 view .LVU1428
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL424:
+	.loc 1 908 1 view .LVU1429
+	ret
+	.cfi_endproc
+.LFE71:
+	.size	st_append_double_precision, .-st_append_double_precision
+	.p2align 4
+	.globl	st_append_fixed
+	.type	st_append_fixed, @function
+st_append_fixed:
+.LVL425:
+.LFB72:
+	.loc 1 913 98 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 915 3 view .LVU1431
+	.loc 1 916 3 view .LVU1432
+	.loc 1 917 3 view .LVU1433
+	.loc 1 913 98 is_stmt 0 view .LVU1434
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rax
+	movl	%edx, %esi
+.LVL426:
+	.loc 1 913 98 view .LVU1435
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$344, %rsp
+	.cfi_def_cfa_offset 368
+	.loc 1 917 19 view .LVU1436
+	movq	%rsp, %rbp
+	vmovsd	(%rax), %xmm0
+	movq	%rbp, %rdi
+.LVL427:
+	.loc 1 917 19 view .LVU1437
+	call	dtos_fixed_to@PLT
+.LVL428:
+	.loc 1 917 19 view .LVU1438
+	movq	%rax, %rdx
+.LVL429:
+	.loc 1 918 3 is_stmt 1 view .LVU1439
+	.loc 1 918 6 view .LVU1440
+	.loc 1 919 3 view .LVU1441
+	.loc 1 919 10 is_stmt 0 view .LVU1442
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	st_append_n@PLT
+.LVL430:
+	.loc 1 920 1 view .LVU1443
+	addq	$344, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL431:
+	.loc 1 920 1 view .LVU1444
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE72:
+	.size	st_append_fixed, .-st_append_fixed
+	.section	.rodata
+	.align 16
+	.type	hex_digits.0, @object
+	.size	hex_digits.0, 17
+hex_digits.0:
+	.string	"0123456789abcdef"
+	.section	.tbss,"awT",@nobits
+	.align 8
+	.type	string_tokenizer_pool_count, @object
+	.size	string_tokenizer_pool_count, 8
+string_tokenizer_pool_count:
+	.zero	8
+	.align 8
+	.type	string_tokenizer_pool, @object
+	.size	string_tokenizer_pool, 64
+string_tokenizer_pool:
+	.zero	64
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	0
+	.long	-1008730112
+	.align 8
+.LC1:
+	.long	0
+	.long	1138753536
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC2:
+	.quad	0
+	.quad	2
+	.quad	4
+	.quad	6
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "/usr/include/stdlib.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 11 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2921
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3d
+	.long	.LASF187
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x15
+	.long	.LASF9
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xe
+	.long	0x2e
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.long	0x46
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xe
+	.long	0x6e
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x15
+	.long	.LASF10
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x60
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x15
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2c
+	.byte	0x19
+	.long	0x52
+	.uleb128 0x15
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x3f
+	.byte	0x8
+	.uleb128 0x15
+	.long	.LASF14
+	.byte	0x4
+	.byte	0xc2
+	.byte	0x12
+	.long	0x52
+	.uleb128 0xb
+	.long	0xbf
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0xe
+	.long	0xbf
+	.uleb128 0x15
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x6c
+	.byte	0x13
+	.long	0xae
+	.uleb128 0x15
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x13
+	.long	0x94
+	.uleb128 0xe
+	.long	0xd7
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0xb
+	.long	0xf4
+	.uleb128 0x40
+	.uleb128 0xb
+	.long	0xc6
+	.uleb128 0x15
+	.long	.LASF19
+	.byte	0x7
+	.byte	0x18
+	.byte	0x13
+	.long	0x81
+	.uleb128 0xe
+	.long	0xfa
+	.uleb128 0x15
+	.long	.LASF20
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa0
+	.uleb128 0x41
+	.long	.LASF28
+	.byte	0x10
+	.byte	0x2
+	.byte	0xd
+	.byte	0x8
+	.long	0x13d
+	.uleb128 0x32
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0xf5
+	.byte	0
+	.uleb128 0x32
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0xe
+	.long	0x117
+	.uleb128 0x42
+	.long	.LASF52
+	.byte	0x7
+	.byte	0x4
+	.long	0x6e
+	.byte	0x2
+	.byte	0x7a
+	.byte	0x6
+	.long	0x17f
+	.uleb128 0xf
+	.long	.LASF21
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF22
+	.byte	0x2
+	.uleb128 0xf
+	.long	.LASF23
+	.byte	0x4
+	.uleb128 0xf
+	.long	.LASF24
+	.byte	0x8
+	.uleb128 0xf
+	.long	.LASF25
+	.byte	0x10
+	.uleb128 0xf
+	.long	.LASF26
+	.byte	0x20
+	.uleb128 0xf
+	.long	.LASF27
+	.byte	0x40
+	.byte	0
+	.uleb128 0x16
+	.long	0x106
+	.long	0x18f
+	.uleb128 0x1a
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0xe
+	.long	0x17f
+	.uleb128 0x43
+	.long	.LASF110
+	.byte	0x2
+	.byte	0xa6
+	.byte	0x16
+	.long	0x18f
+	.uleb128 0x44
+	.long	.LASF29
+	.value	0x100
+	.byte	0x2
+	.byte	0xab
+	.byte	0x8
+	.long	0x1bc
+	.uleb128 0x45
+	.long	.LASF30
+	.byte	0x2
+	.byte	0xb0
+	.byte	0xb
+	.long	0x1c1
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x1a0
+	.uleb128 0x16
+	.long	0xfa
+	.long	0x1d1
+	.uleb128 0x1a
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF31
+	.byte	0x18
+	.value	0x175
+	.long	0x205
+	.uleb128 0x6
+	.long	.LASF32
+	.value	0x17a
+	.byte	0x1c
+	.long	0x20a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF33
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF34
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF188
+	.uleb128 0xb
+	.long	0x205
+	.uleb128 0x10
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF35
+	.uleb128 0x21
+	.long	.LASF36
+	.byte	0x40
+	.value	0x1e6
+	.long	0x28b
+	.uleb128 0x6
+	.long	.LASF37
+	.value	0x1eb
+	.byte	0xc
+	.long	0x10b
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF38
+	.value	0x1f0
+	.byte	0xc
+	.long	0x10b
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF39
+	.value	0x1f5
+	.byte	0xc
+	.long	0x10b
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF40
+	.value	0x1fa
+	.byte	0xc
+	.long	0x10b
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF41
+	.value	0x1ff
+	.byte	0xc
+	.long	0x10b
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF42
+	.value	0x204
+	.byte	0xc
+	.long	0x10b
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF43
+	.value	0x209
+	.byte	0xc
+	.long	0x10b
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF44
+	.value	0x20e
+	.byte	0xc
+	.long	0x10b
+	.byte	0x38
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF45
+	.byte	0x38
+	.value	0x26c
+	.long	0x2fd
+	.uleb128 0x6
+	.long	.LASF46
+	.value	0x272
+	.byte	0xd
+	.long	0x316
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF47
+	.value	0x277
+	.byte	0x9
+	.long	0xac
+	.byte	0x8
+	.uleb128 0x33
+	.string	"fd"
+	.value	0x27c
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF48
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF49
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF50
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x33
+	.string	"eof"
+	.value	0x290
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF51
+	.value	0x295
+	.byte	0x7
+	.long	0x46
+	.byte	0x34
+	.byte	0
+	.uleb128 0x47
+	.long	0xcb
+	.long	0x316
+	.uleb128 0x3
+	.long	0xac
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xb
+	.long	0x2fd
+	.uleb128 0x34
+	.long	.LASF53
+	.long	0x6e
+	.value	0x29b
+	.long	0x337
+	.uleb128 0xf
+	.long	.LASF54
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF55
+	.byte	0x1
+	.byte	0
+	.uleb128 0xe
+	.long	0x31b
+	.uleb128 0x34
+	.long	.LASF56
+	.long	0x6e
+	.value	0x2b5
+	.long	0x364
+	.uleb128 0xf
+	.long	.LASF57
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF58
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF59
+	.byte	0x2
+	.uleb128 0xf
+	.long	.LASF60
+	.byte	0x3
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF61
+	.value	0x158
+	.byte	0x2
+	.value	0x2cf
+	.byte	0x8
+	.long	0x412
+	.uleb128 0x6
+	.long	.LASF62
+	.value	0x2d4
+	.byte	0x9
+	.long	0xba
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF63
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF64
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF65
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF66
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x31b
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x2f2
+	.byte	0x18
+	.long	0x412
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF69
+	.value	0x2f7
+	.byte	0x18
+	.long	0x33c
+	.byte	0x38
+	.uleb128 0x6
+	.long	.LASF70
+	.value	0x2fc
+	.byte	0x17
+	.long	0x417
+	.byte	0x40
+	.uleb128 0x6
+	.long	.LASF71
+	.value	0x301
+	.byte	0x8
+	.long	0x41c
+	.byte	0x48
+	.uleb128 0x35
+	.long	.LASF72
+	.value	0x306
+	.byte	0x21
+	.long	0x47f
+	.value	0x148
+	.uleb128 0x35
+	.long	.LASF73
+	.value	0x30b
+	.byte	0x17
+	.long	0x484
+	.value	0x150
+	.byte	0
+	.uleb128 0xb
+	.long	0x28b
+	.uleb128 0xb
+	.long	0x1d1
+	.uleb128 0x16
+	.long	0xbf
+	.long	0x42c
+	.uleb128 0x1a
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF74
+	.byte	0x28
+	.value	0x764
+	.long	0x47a
+	.uleb128 0x6
+	.long	.LASF75
+	.value	0x769
+	.byte	0xb
+	.long	0x49a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF76
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF77
+	.value	0x774
+	.byte	0xd
+	.long	0x49f
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF63
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF78
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0xe
+	.long	0x42c
+	.uleb128 0xb
+	.long	0x42c
+	.uleb128 0xb
+	.long	0x216
+	.uleb128 0xb
+	.long	0x13d
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF79
+	.uleb128 0xe
+	.long	0x48e
+	.uleb128 0xb
+	.long	0x2e
+	.uleb128 0xb
+	.long	0x10b
+	.uleb128 0xb
+	.long	0x364
+	.uleb128 0x16
+	.long	0x4a4
+	.long	0x4b9
+	.uleb128 0x1a
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF80
+	.byte	0xe
+	.byte	0x2e
+	.long	0x4a9
+	.uleb128 0xa
+	.byte	0xe
+	.long	string_tokenizer_pool@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0x2a
+	.long	.LASF81
+	.byte	0x13
+	.byte	0x1d
+	.long	0x2e
+	.uleb128 0xa
+	.byte	0xe
+	.long	string_tokenizer_pool_count@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0xc
+	.long	.LASF82
+	.byte	0x2
+	.value	0x673
+	.byte	0x8
+	.long	0x2e
+	.long	0x506
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x495
+	.uleb128 0x3
+	.long	0x46
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF83
+	.byte	0x2
+	.value	0x660
+	.byte	0x8
+	.long	0x2e
+	.long	0x527
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x495
+	.uleb128 0x3
+	.long	0x46
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF84
+	.byte	0x2
+	.value	0x64e
+	.byte	0x8
+	.long	0x2e
+	.long	0x543
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x495
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF85
+	.byte	0x2
+	.value	0x607
+	.byte	0x8
+	.long	0x2e
+	.long	0x55f
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0xd7
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF86
+	.byte	0x2
+	.value	0x148
+	.byte	0x8
+	.long	0x2e
+	.long	0x57b
+	.uleb128 0x3
+	.long	0xf5
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF87
+	.byte	0x8
+	.value	0x234
+	.byte	0xe
+	.long	0xac
+	.long	0x597
+	.uleb128 0x3
+	.long	0xac
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF88
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.long	0xac
+	.long	0x5b7
+	.uleb128 0x3
+	.long	0xac
+	.uleb128 0x3
+	.long	0xef
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF89
+	.byte	0x9
+	.byte	0x40
+	.byte	0xc
+	.long	0x46
+	.long	0x5d7
+	.uleb128 0x3
+	.long	0xef
+	.uleb128 0x3
+	.long	0xef
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF90
+	.byte	0x2
+	.value	0x19d
+	.byte	0x7
+	.long	0xac
+	.long	0x5f3
+	.uleb128 0x3
+	.long	0x417
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF91
+	.byte	0x2
+	.value	0x688
+	.byte	0x8
+	.long	0x2e
+	.long	0x614
+	.uleb128 0x3
+	.long	0xf5
+	.uleb128 0x3
+	.long	0x3a
+	.uleb128 0x3
+	.long	0x614
+	.byte	0
+	.uleb128 0xb
+	.long	0xd7
+	.uleb128 0xc
+	.long	.LASF92
+	.byte	0x2
+	.value	0x63e
+	.byte	0x8
+	.long	0x2e
+	.long	0x63a
+	.uleb128 0x3
+	.long	0xf5
+	.uleb128 0x3
+	.long	0x3a
+	.uleb128 0x3
+	.long	0x63a
+	.byte	0
+	.uleb128 0xb
+	.long	0x48e
+	.uleb128 0xc
+	.long	.LASF93
+	.byte	0x2
+	.value	0x157
+	.byte	0x8
+	.long	0x2e
+	.long	0x660
+	.uleb128 0x3
+	.long	0xf5
+	.uleb128 0x3
+	.long	0x3a
+	.uleb128 0x3
+	.long	0x660
+	.byte	0
+	.uleb128 0xb
+	.long	0x1bc
+	.uleb128 0xc
+	.long	.LASF94
+	.byte	0x2
+	.value	0x1aa
+	.byte	0x7
+	.long	0xba
+	.long	0x681
+	.uleb128 0x3
+	.long	0x417
+	.uleb128 0x3
+	.long	0x489
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF95
+	.byte	0x2
+	.value	0x11c
+	.byte	0x8
+	.long	0x2e
+	.long	0x6a2
+	.uleb128 0x3
+	.long	0xf5
+	.uleb128 0x3
+	.long	0x3a
+	.uleb128 0x3
+	.long	0xc6
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF96
+	.byte	0x2
+	.value	0x394
+	.byte	0x5
+	.long	0x46
+	.long	0x6be
+	.uleb128 0x3
+	.long	0x4a4
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF97
+	.byte	0x2
+	.value	0x12b
+	.byte	0x8
+	.long	0x2e
+	.long	0x6da
+	.uleb128 0x3
+	.long	0xf5
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF98
+	.byte	0x2
+	.value	0x7a4
+	.byte	0x8
+	.long	0x2e
+	.long	0x6f6
+	.uleb128 0x3
+	.long	0x47f
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF99
+	.byte	0x2
+	.byte	0x54
+	.byte	0x7
+	.long	0xba
+	.long	0x70c
+	.uleb128 0x3
+	.long	0x489
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF100
+	.byte	0xa
+	.byte	0x4c
+	.byte	0xc
+	.long	0x46
+	.long	0x727
+	.uleb128 0x3
+	.long	0xac
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF101
+	.byte	0x2
+	.value	0x797
+	.byte	0x6
+	.long	0x73a
+	.uleb128 0x3
+	.long	0x4a4
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF102
+	.byte	0x8
+	.value	0x238
+	.byte	0xd
+	.long	0x74d
+	.uleb128 0x3
+	.long	0xac
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF103
+	.byte	0x8
+	.value	0x229
+	.byte	0xe
+	.long	0xac
+	.long	0x764
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF104
+	.byte	0x9
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0x77b
+	.uleb128 0x3
+	.long	0xf5
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF111
+	.value	0x391
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB72
+	.quad	.LFE72-.LFB72
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x842
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x391
+	.byte	0x2d
+	.long	0x4a4
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0x4
+	.long	.LASF106
+	.value	0x391
+	.byte	0x46
+	.long	0x842
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x4
+	.long	.LASF107
+	.value	0x391
+	.byte	0x57
+	.long	0x4d
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0x13
+	.long	.LASF108
+	.value	0x393
+	.byte	0x8
+	.long	0x847
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x2b
+	.long	.LASF109
+	.value	0x394
+	.long	0x10b
+	.uleb128 0xa
+	.long	.LASF63
+	.value	0x395
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x7
+	.quad	.LVL428
+	.long	0x4e5
+	.long	0x827
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL430
+	.long	0xe88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x495
+	.uleb128 0x16
+	.long	0xbf
+	.long	0x858
+	.uleb128 0x49
+	.long	0x3f
+	.value	0x14b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF112
+	.value	0x382
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB71
+	.quad	.LFE71-.LFB71
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8fd
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x382
+	.byte	0x38
+	.long	0x4a4
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x4
+	.long	.LASF106
+	.value	0x382
+	.byte	0x51
+	.long	0x842
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x4
+	.long	.LASF107
+	.value	0x382
+	.byte	0x62
+	.long	0x4d
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0xa
+	.long	.LASF109
+	.value	0x388
+	.byte	0xc
+	.long	0x10b
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x7
+	.quad	.LVL418
+	.long	0x10cf
+	.long	0x8e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL420
+	.long	0x506
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF113
+	.value	0x373
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB70
+	.quad	.LFE70-.LFB70
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x987
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x373
+	.byte	0x2e
+	.long	0x4a4
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x4
+	.long	.LASF106
+	.value	0x373
+	.byte	0x47
+	.long	0x842
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0xa
+	.long	.LASF109
+	.value	0x379
+	.byte	0xc
+	.long	0x10b
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x7
+	.quad	.LVL410
+	.long	0x10cf
+	.long	0x979
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL412
+	.long	0x527
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF114
+	.value	0x364
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB69
+	.quad	.LFE69-.LFB69
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa17
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x364
+	.byte	0x2b
+	.long	0x4a4
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x4
+	.long	.LASF106
+	.value	0x364
+	.byte	0x44
+	.long	0xe3
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0xa
+	.long	.LASF109
+	.value	0x36a
+	.byte	0xc
+	.long	0x10b
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x7
+	.quad	.LVL402
+	.long	0x10cf
+	.long	0xa02
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x45
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL404
+	.long	0x543
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF115
+	.value	0x35d
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa96
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x35d
+	.byte	0x36
+	.long	0x4a4
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x35d
+	.byte	0x4d
+	.long	0xf5
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x7
+	.quad	.LVL396
+	.long	0x764
+	.long	0xa79
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL399
+	.long	0xa96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF116
+	.value	0x31f
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbd8
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x31f
+	.byte	0x31
+	.long	0x4a4
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x31f
+	.byte	0x48
+	.long	0xf5
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x31f
+	.byte	0x5d
+	.long	0x3a
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x13
+	.long	.LASF117
+	.value	0x320
+	.byte	0x15
+	.long	0xbe8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	hex_digits.0
+	.uleb128 0xa
+	.long	.LASF118
+	.value	0x326
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST164
+	.long	.LVUS164
+	.uleb128 0x37
+	.long	.LLRL165
+	.long	0xbbd
+	.uleb128 0x23
+	.string	"run"
+	.value	0x329
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0xa
+	.long	.LASF119
+	.value	0x334
+	.byte	0xb
+	.long	0xba
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0xa
+	.long	.LASF120
+	.value	0x335
+	.byte	0x13
+	.long	0x60
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x7
+	.quad	.LVL360
+	.long	0x55f
+	.long	0xb84
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL362
+	.long	0x10cf
+	.long	0xba2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 7
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL363
+	.long	0x2912
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL357
+	.long	0x10cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0xc6
+	.long	0xbe8
+	.uleb128 0x1a
+	.long	0x3f
+	.byte	0x10
+	.byte	0
+	.uleb128 0xe
+	.long	0xbd8
+	.uleb128 0x8
+	.long	.LASF121
+	.value	0x317
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB66
+	.quad	.LFE66-.LFB66
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc81
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x317
+	.byte	0x35
+	.long	0x4a4
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x317
+	.byte	0x4c
+	.long	0xf5
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x13
+	.long	.LASF122
+	.value	0x318
+	.byte	0x15
+	.long	0xc81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x7
+	.quad	.LVL352
+	.long	0x764
+	.long	0xc60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL353
+	.long	0xd10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x117
+	.long	0xc91
+	.uleb128 0x1a
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF123
+	.value	0x310
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB65
+	.quad	.LFE65-.LFB65
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd10
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x310
+	.byte	0x2e
+	.long	0x4a4
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x310
+	.byte	0x45
+	.long	0xf5
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x7
+	.quad	.LVL346
+	.long	0x764
+	.long	0xcf3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL349
+	.long	0xe88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF124
+	.value	0x2f8
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB64
+	.quad	.LFE64-.LFB64
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe24
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x2f8
+	.byte	0x2c
+	.long	0x4a4
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x4
+	.long	.LASF122
+	.value	0x2f8
+	.byte	0x50
+	.long	0x489
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x4
+	.long	.LASF76
+	.value	0x2f8
+	.byte	0x68
+	.long	0x3a
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0xa
+	.long	.LASF63
+	.value	0x2fa
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0xa
+	.long	.LASF119
+	.value	0x302
+	.byte	0x9
+	.long	0xba
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x37
+	.long	.LLRL154
+	.long	0xdb2
+	.uleb128 0x23
+	.string	"i"
+	.value	0x2fb
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST155
+	.long	.LVUS155
+	.byte	0
+	.uleb128 0x24
+	.quad	.LBB168
+	.quad	.LBE168-.LBB168
+	.long	0xde7
+	.uleb128 0x23
+	.string	"i"
+	.value	0x303
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x11
+	.quad	.LVL335
+	.long	0x2912
+	.byte	0
+	.uleb128 0x25
+	.quad	.LVL324
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x7
+	.quad	.LVL331
+	.long	0x10cf
+	.long	0xe10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL340
+	.long	0x10cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF125
+	.value	0x2ea
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB63
+	.quad	.LFE63-.LFB63
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe88
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x2ea
+	.byte	0x2c
+	.long	0x4a4
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x4
+	.long	.LASF120
+	.value	0x2ea
+	.byte	0x42
+	.long	0xc6
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x5
+	.quad	.LVL318
+	.long	0x10cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF126
+	.value	0x2d9
+	.long	0x46
+	.long	0xebf
+	.uleb128 0x9
+	.long	.LASF105
+	.byte	0x1
+	.value	0x2d9
+	.byte	0x29
+	.long	0x4a4
+	.uleb128 0x9
+	.long	.LASF62
+	.byte	0x1
+	.value	0x2d9
+	.byte	0x40
+	.long	0xf5
+	.uleb128 0x9
+	.long	.LASF63
+	.byte	0x1
+	.value	0x2d9
+	.byte	0x55
+	.long	0x3a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF127
+	.value	0x2c8
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB61
+	.quad	.LFE61-.LFB61
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf9f
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x2c8
+	.byte	0x2e
+	.long	0x4a4
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0xa
+	.long	.LASF63
+	.value	0x2c9
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x12
+	.long	0x1111
+	.quad	.LBI152
+	.byte	.LVU1045
+	.long	.LLRL135
+	.value	0x2ce
+	.byte	0x7
+	.long	0xf93
+	.uleb128 0x2
+	.long	0x1130
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x2
+	.long	0x1123
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x17
+	.long	.LLRL135
+	.uleb128 0xd
+	.long	0x113d
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x4a
+	.long	0x1149
+	.long	.LLRL139
+	.long	0xf7d
+	.uleb128 0xd
+	.long	0x114a
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x5
+	.quad	.LVL304
+	.long	0x74d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL301
+	.long	0x57b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.quad	.LVL306
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF128
+	.value	0x2bd
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB60
+	.quad	.LFE60-.LFB60
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x108d
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x2bd
+	.byte	0x28
+	.long	0x4a4
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x2bd
+	.byte	0x40
+	.long	0x3a
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x12
+	.long	0x1111
+	.quad	.LBI142
+	.byte	.LVU953
+	.long	.LLRL126
+	.value	0x2c2
+	.byte	0xa
+	.long	0x1081
+	.uleb128 0x2
+	.long	0x1130
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x2
+	.long	0x1123
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x17
+	.long	.LLRL126
+	.uleb128 0xd
+	.long	0x113d
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x38
+	.long	0x1149
+	.quad	.LBB144
+	.quad	.LBE144-.LBB144
+	.long	0x106a
+	.uleb128 0xd
+	.long	0x114a
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x5
+	.quad	.LVL275
+	.long	0x74d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL278
+	.long	0x57b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.quad	.LVL276
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF162
+	.value	0x2b5
+	.quad	.LFB59
+	.quad	.LFE59-.LFB59
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x10cf
+	.uleb128 0x2c
+	.long	.LASF105
+	.byte	0x33
+	.long	0x4a4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2c
+	.long	.LASF129
+	.byte	0x5c
+	.long	0x337
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2c
+	.long	.LASF67
+	.byte	0x71
+	.long	0x3a
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF130
+	.value	0x292
+	.long	0x46
+	.long	0x1111
+	.uleb128 0x9
+	.long	.LASF105
+	.byte	0x1
+	.value	0x292
+	.byte	0x2e
+	.long	0x4a4
+	.uleb128 0x9
+	.long	.LASF131
+	.byte	0x1
+	.value	0x292
+	.byte	0x46
+	.long	0x3a
+	.uleb128 0x1f
+	.long	.LASF132
+	.value	0x29d
+	.byte	0xa
+	.long	0x2e
+	.uleb128 0x1f
+	.long	.LASF133
+	.value	0x2a9
+	.byte	0xa
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF153
+	.byte	0x1
+	.value	0x26a
+	.byte	0xc
+	.long	0x46
+	.byte	0x1
+	.long	0x1158
+	.uleb128 0x9
+	.long	.LASF105
+	.byte	0x1
+	.value	0x26a
+	.byte	0x35
+	.long	0x4a4
+	.uleb128 0x9
+	.long	.LASF63
+	.byte	0x1
+	.value	0x26a
+	.byte	0x4d
+	.long	0x3a
+	.uleb128 0x1f
+	.long	.LASF62
+	.value	0x281
+	.byte	0x9
+	.long	0xba
+	.uleb128 0x2d
+	.uleb128 0x1f
+	.long	.LASF62
+	.value	0x275
+	.byte	0xb
+	.long	0xba
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF134
+	.value	0x250
+	.byte	0x6
+	.long	0x1244
+	.quad	.LFB56
+	.quad	.LFE56-.LFB56
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1244
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x250
+	.byte	0x31
+	.long	0x4a4
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x4
+	.long	.LASF135
+	.value	0x250
+	.byte	0x48
+	.long	0xf5
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x4
+	.long	.LASF136
+	.value	0x250
+	.byte	0x5e
+	.long	0x4d
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0xa
+	.long	.LASF106
+	.value	0x256
+	.byte	0x8
+	.long	0x1244
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x12
+	.long	0x1cd3
+	.quad	.LBI121
+	.byte	.LVU832
+	.long	.LLRL109
+	.value	0x256
+	.byte	0x17
+	.long	0x1228
+	.uleb128 0x2
+	.long	0x1ce5
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x2
+	.long	0x1cf2
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x7
+	.quad	.LVL243
+	.long	0x5d7
+	.long	0x1214
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL247
+	.long	0x74d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL241
+	.long	0x1249
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x46
+	.uleb128 0x8
+	.long	.LASF137
+	.value	0x23b
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB55
+	.quad	.LFE55-.LFB55
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x130d
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x23b
+	.byte	0x2c
+	.long	0x4a4
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x4
+	.long	.LASF138
+	.value	0x23b
+	.byte	0x43
+	.long	0xf5
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0xa
+	.long	.LASF63
+	.value	0x23d
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x13
+	.long	.LASF139
+	.value	0x23f
+	.byte	0x15
+	.long	0x117
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x7
+	.quad	.LVL229
+	.long	0x764
+	.long	0x12ce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL231
+	.long	0x1972
+	.long	0x12ec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL232
+	.long	0x291b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF140
+	.value	0x22a
+	.byte	0x9
+	.long	0x63a
+	.quad	.LFB54
+	.quad	.LFE54-.LFB54
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13df
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x22a
+	.byte	0x33
+	.long	0x4a4
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x13
+	.long	.LASF141
+	.value	0x22c
+	.byte	0xa
+	.long	0x48e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	.LASF106
+	.value	0x231
+	.byte	0xb
+	.long	0x63a
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x12
+	.long	0x1cd3
+	.quad	.LBI115
+	.byte	.LVU772
+	.long	.LLRL99
+	.value	0x231
+	.byte	0x1d
+	.long	0x13c4
+	.uleb128 0x2
+	.long	0x1ce5
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x2
+	.long	0x1cf2
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x7
+	.quad	.LVL221
+	.long	0x5d7
+	.long	0x13b0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL224
+	.long	0x74d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL219
+	.long	0x15e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF142
+	.value	0x1fd
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15e6
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x1fd
+	.byte	0x2e
+	.long	0x4a4
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x4
+	.long	.LASF106
+	.value	0x1fd
+	.byte	0x42
+	.long	0x614
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x2b
+	.long	.LASF109
+	.value	0x1fe
+	.long	0x10b
+	.uleb128 0xa
+	.long	.LASF143
+	.value	0x201
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0xa
+	.long	.LASF144
+	.value	0x202
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x13
+	.long	.LASF141
+	.value	0x203
+	.byte	0xb
+	.long	0xd7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xa
+	.long	.LASF145
+	.value	0x20f
+	.byte	0x8
+	.long	0xbf
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x24
+	.quad	.LBB102
+	.quad	.LBE102-.LBB102
+	.long	0x1573
+	.uleb128 0xa
+	.long	.LASF139
+	.value	0x212
+	.byte	0x17
+	.long	0x117
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x13
+	.long	.LASF146
+	.value	0x213
+	.byte	0xc
+	.long	0x48e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4b
+	.long	0x185f
+	.long	.LLRL91
+	.byte	0x1
+	.value	0x214
+	.byte	0x9
+	.long	0x1558
+	.uleb128 0x2e
+	.long	0x187e
+	.uleb128 0x2e
+	.long	0x1871
+	.uleb128 0x17
+	.long	.LLRL91
+	.uleb128 0xd
+	.long	0x188b
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x12
+	.long	0x22e4
+	.quad	.LBI105
+	.byte	.LVU703
+	.long	.LLRL93
+	.value	0x1a2
+	.byte	0x30
+	.long	0x153c
+	.uleb128 0x2
+	.long	0x22f6
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x27
+	.long	0x2304
+	.quad	.LBI106
+	.byte	.LVU705
+	.long	.LLRL93
+	.byte	0x2
+	.value	0x5c2
+	.byte	0xa
+	.uleb128 0x2
+	.long	0x2321
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x2
+	.long	0x2315
+	.long	.LLST96
+	.long	.LVUS96
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL206
+	.long	0x6a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL209
+	.long	0x619
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL191
+	.long	0x6a2
+	.long	0x1590
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x45
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL193
+	.long	0x5f3
+	.long	0x15ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL196
+	.long	0x6a2
+	.long	0x15cb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 1
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL199
+	.long	0x5f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF147
+	.value	0x1e8
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB52
+	.quad	.LFE52-.LFB52
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1691
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x1e8
+	.byte	0x32
+	.long	0x4a4
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x4
+	.long	.LASF106
+	.value	0x1e8
+	.byte	0x45
+	.long	0x63a
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x13
+	.long	.LASF139
+	.value	0x1ea
+	.byte	0x15
+	.long	0x117
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x2b
+	.long	.LASF109
+	.value	0x1ef
+	.long	0x10b
+	.uleb128 0xa
+	.long	.LASF148
+	.value	0x1f0
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x7
+	.quad	.LVL179
+	.long	0x182a
+	.long	0x167c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL183
+	.long	0x619
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF149
+	.value	0x1dc
+	.byte	0x7
+	.long	0xba
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1751
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x1dc
+	.byte	0x32
+	.long	0x4a4
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x13
+	.long	.LASF139
+	.value	0x1dd
+	.byte	0x15
+	.long	0x117
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x12
+	.long	0x1ca6
+	.quad	.LBI92
+	.byte	.LVU623
+	.long	.LLRL79
+	.value	0x1e2
+	.byte	0xa
+	.long	0x1736
+	.uleb128 0x2
+	.long	0x1cb8
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x2
+	.long	0x1cc5
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x7
+	.quad	.LVL171
+	.long	0x665
+	.long	0x1721
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL174
+	.long	0x6f6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL169
+	.long	0x182a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF150
+	.value	0x1c1
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1825
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x1c1
+	.byte	0x33
+	.long	0x4a4
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x4
+	.long	.LASF151
+	.value	0x1c1
+	.byte	0x5c
+	.long	0x660
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x4
+	.long	.LASF139
+	.value	0x1c1
+	.byte	0x7b
+	.long	0x1825
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x23
+	.string	"end"
+	.value	0x1c3
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x24
+	.quad	.LBB89
+	.quad	.LBE89-.LBB89
+	.long	0x180a
+	.uleb128 0xa
+	.long	.LASF143
+	.value	0x1c5
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x5
+	.quad	.LVL160
+	.long	0x63f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL163
+	.long	0x6a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x117
+	.uleb128 0x26
+	.long	.LASF152
+	.value	0x1b2
+	.long	0x46
+	.long	0x185f
+	.uleb128 0x9
+	.long	.LASF105
+	.byte	0x1
+	.value	0x1b2
+	.byte	0x35
+	.long	0x4a4
+	.uleb128 0x9
+	.long	.LASF139
+	.byte	0x1
+	.value	0x1b2
+	.byte	0x53
+	.long	0x1825
+	.uleb128 0x2f
+	.string	"end"
+	.value	0x1b6
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF154
+	.byte	0x1
+	.value	0x19f
+	.byte	0xc
+	.long	0x46
+	.byte	0x1
+	.long	0x1897
+	.uleb128 0x9
+	.long	.LASF105
+	.byte	0x1
+	.value	0x19f
+	.byte	0x34
+	.long	0x4a4
+	.uleb128 0x9
+	.long	.LASF139
+	.byte	0x1
+	.value	0x19f
+	.byte	0x52
+	.long	0x1825
+	.uleb128 0x2f
+	.string	"end"
+	.value	0x1a1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF155
+	.value	0x18b
+	.byte	0x7
+	.long	0xba
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1972
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x18b
+	.byte	0x2f
+	.long	0x4a4
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x18b
+	.byte	0x44
+	.long	0x4d
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x13
+	.long	.LASF139
+	.value	0x18c
+	.byte	0x15
+	.long	0x117
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x12
+	.long	0x1ca6
+	.quad	.LBI58
+	.byte	.LVU495
+	.long	.LLRL57
+	.value	0x191
+	.byte	0xa
+	.long	0x1950
+	.uleb128 0x2
+	.long	0x1cb8
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x2
+	.long	0x1cc5
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x7
+	.quad	.LVL141
+	.long	0x665
+	.long	0x193b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL144
+	.long	0x6f6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL139
+	.long	0x1972
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF156
+	.value	0x176
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19eb
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x176
+	.byte	0x32
+	.long	0x4a4
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x176
+	.byte	0x47
+	.long	0x4d
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x4
+	.long	.LASF139
+	.value	0x176
+	.byte	0x62
+	.long	0x1825
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x5
+	.quad	.LVL126
+	.long	0x6a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF157
+	.value	0x16a
+	.byte	0x7
+	.long	0xba
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1aed
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x16a
+	.byte	0x2d
+	.long	0x4a4
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x4
+	.long	.LASF158
+	.value	0x16a
+	.byte	0x43
+	.long	0xc6
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x4
+	.long	.LASF159
+	.value	0x16a
+	.byte	0x5b
+	.long	0xc6
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x13
+	.long	.LASF139
+	.value	0x16b
+	.byte	0x15
+	.long	0x117
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x12
+	.long	0x1ca6
+	.quad	.LBI52
+	.byte	.LVU421
+	.long	.LLRL49
+	.value	0x170
+	.byte	0xa
+	.long	0x1ab8
+	.uleb128 0x2
+	.long	0x1cb8
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x2
+	.long	0x1cc5
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x7
+	.quad	.LVL118
+	.long	0x665
+	.long	0x1aa3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL121
+	.long	0x6f6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL116
+	.long	0x1aed
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF160
+	.value	0x14d
+	.long	0x46
+	.long	0x1b4a
+	.uleb128 0x9
+	.long	.LASF105
+	.byte	0x1
+	.value	0x14d
+	.byte	0x30
+	.long	0x4a4
+	.uleb128 0x9
+	.long	.LASF158
+	.byte	0x1
+	.value	0x14d
+	.byte	0x46
+	.long	0xc6
+	.uleb128 0x9
+	.long	.LASF159
+	.byte	0x1
+	.value	0x14d
+	.byte	0x5e
+	.long	0xc6
+	.uleb128 0x9
+	.long	.LASF139
+	.byte	0x1
+	.value	0x14d
+	.byte	0x7c
+	.long	0x1825
+	.uleb128 0x2f
+	.string	"end"
+	.value	0x154
+	.long	0x2e
+	.uleb128 0x2d
+	.uleb128 0x1f
+	.long	.LASF143
+	.value	0x156
+	.byte	0xc
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF161
+	.value	0x142
+	.byte	0x6
+	.long	0xbf
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b9a
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x142
+	.byte	0x2f
+	.long	0x4a4
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x5
+	.quad	.LVL99
+	.long	0x6a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF163
+	.value	0x122
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ca6
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x122
+	.byte	0x2c
+	.long	0x4a4
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0xa
+	.long	.LASF64
+	.value	0x124
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xa
+	.long	.LASF118
+	.value	0x125
+	.byte	0x21
+	.long	0x47f
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x12
+	.long	0x2304
+	.quad	.LBI37
+	.byte	.LVU326
+	.long	.LLRL29
+	.value	0x126
+	.byte	0x37
+	.long	0x1c27
+	.uleb128 0x2
+	.long	0x2321
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x2
+	.long	0x2315
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.uleb128 0x30
+	.long	0x22b2
+	.quad	.LBI41
+	.byte	.LVU332
+	.quad	.LBB41
+	.quad	.LBE41-.LBB41
+	.value	0x126
+	.byte	0x77
+	.long	0x1c67
+	.uleb128 0x2
+	.long	0x22d1
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x2
+	.long	0x22c4
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL89
+	.long	0x6a2
+	.long	0x1c84
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL91
+	.long	0x6be
+	.uleb128 0x5
+	.quad	.LVL97
+	.long	0x6da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF164
+	.byte	0x1
+	.value	0x117
+	.byte	0xe
+	.long	0xba
+	.byte	0x1
+	.long	0x1cd3
+	.uleb128 0x9
+	.long	.LASF105
+	.byte	0x1
+	.value	0x117
+	.byte	0x33
+	.long	0x4a4
+	.uleb128 0x9
+	.long	.LASF139
+	.byte	0x1
+	.value	0x117
+	.byte	0x57
+	.long	0x489
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF165
+	.byte	0x1
+	.value	0x104
+	.byte	0xe
+	.long	0xac
+	.byte	0x1
+	.long	0x1d00
+	.uleb128 0x9
+	.long	.LASF105
+	.byte	0x1
+	.value	0x104
+	.byte	0x32
+	.long	0x4a4
+	.uleb128 0x9
+	.long	.LASF131
+	.byte	0x1
+	.value	0x104
+	.byte	0x4a
+	.long	0x3a
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF166
+	.byte	0xf5
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d37
+	.uleb128 0x18
+	.long	.LASF105
+	.byte	0xf5
+	.byte	0x2e
+	.long	0x4a4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x18
+	.long	.LASF73
+	.byte	0xf5
+	.byte	0x4d
+	.long	0x484
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF167
+	.byte	0xee
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d6e
+	.uleb128 0x18
+	.long	.LASF105
+	.byte	0xee
+	.byte	0x2e
+	.long	0x4a4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x18
+	.long	.LASF70
+	.byte	0xee
+	.byte	0x4d
+	.long	0x417
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF168
+	.byte	0xe5
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d98
+	.uleb128 0x11
+	.quad	.LVL82
+	.long	0x2052
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF169
+	.byte	0xcf
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e46
+	.uleb128 0x14
+	.long	.LASF105
+	.byte	0xcf
+	.byte	0x2e
+	.long	0x4a4
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x19
+	.long	.LASF170
+	.byte	0xd3
+	.byte	0x7
+	.long	0x46
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x19
+	.long	.LASF69
+	.byte	0xda
+	.byte	0x18
+	.long	0x33c
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x19
+	.long	.LASF65
+	.byte	0xdb
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x3b
+	.quad	.LVL69
+	.long	0x2052
+	.long	0x1e19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL71
+	.long	0x2038
+	.long	0x1e31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL74
+	.long	0x220c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.long	.LASF171
+	.byte	0x1
+	.byte	0xc0
+	.byte	0x19
+	.long	0x4a4
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1eda
+	.uleb128 0x14
+	.long	.LASF172
+	.byte	0xc0
+	.byte	0x36
+	.long	0x3a
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x19
+	.long	.LASF105
+	.byte	0xc4
+	.byte	0x1b
+	.long	0x4a4
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x7
+	.quad	.LVL283
+	.long	0xf9f
+	.long	0x1eac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3b
+	.quad	.LVL288
+	.long	0x2124
+	.long	0x1ec5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL289
+	.long	0x2052
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF173
+	.byte	0xa5
+	.byte	0x7
+	.long	0xba
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f6e
+	.uleb128 0x14
+	.long	.LASF105
+	.byte	0xa5
+	.byte	0x30
+	.long	0x4a4
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x19
+	.long	.LASF62
+	.byte	0xa6
+	.byte	0x9
+	.long	0xba
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x24
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.long	0x1f59
+	.uleb128 0x2a
+	.long	.LASF139
+	.byte	0xa9
+	.byte	0x17
+	.long	0x117
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.quad	.LVL59
+	.long	0x6f6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL62
+	.long	0x727
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF174
+	.byte	0x97
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2038
+	.uleb128 0x14
+	.long	.LASF105
+	.byte	0x97
+	.byte	0x27
+	.long	0x4a4
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x14
+	.long	.LASF62
+	.byte	0x97
+	.byte	0x38
+	.long	0xba
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x14
+	.long	.LASF63
+	.byte	0x97
+	.byte	0x4d
+	.long	0x3a
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x4d
+	.long	0x210a
+	.quad	.LBI32
+	.byte	.LVU154
+	.long	.LLRL18
+	.byte	0x1
+	.byte	0x9b
+	.byte	0x3
+	.uleb128 0x2
+	.long	0x2117
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x7
+	.quad	.LVL42
+	.long	0x727
+	.long	0x2002
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL43
+	.long	0x73a
+	.uleb128 0x11
+	.quad	.LVL44
+	.long	0x73a
+	.uleb128 0x11
+	.quad	.LVL51
+	.long	0x70c
+	.uleb128 0x11
+	.quad	.LVL52
+	.long	0x73a
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF175
+	.byte	0x1
+	.byte	0x8b
+	.byte	0x6
+	.byte	0x1
+	.long	0x2052
+	.uleb128 0x20
+	.long	.LASF105
+	.byte	0x1
+	.byte	0x8b
+	.byte	0x27
+	.long	0x4a4
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF176
+	.byte	0x80
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x210a
+	.uleb128 0x14
+	.long	.LASF105
+	.byte	0x80
+	.byte	0x29
+	.long	0x4a4
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x4f
+	.long	0x210a
+	.quad	.LBI22
+	.byte	.LVU112
+	.long	.LLRL11
+	.byte	0x1
+	.byte	0x82
+	.byte	0x5
+	.long	0x20f4
+	.uleb128 0x2
+	.long	0x2117
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x7
+	.quad	.LVL30
+	.long	0x727
+	.long	0x20bf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL31
+	.long	0x73a
+	.uleb128 0x11
+	.quad	.LVL32
+	.long	0x73a
+	.uleb128 0x11
+	.quad	.LVL35
+	.long	0x70c
+	.uleb128 0x11
+	.quad	.LVL36
+	.long	0x73a
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL34
+	.long	0x73a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF189
+	.byte	0x1
+	.byte	0x6b
+	.byte	0xd
+	.byte	0x1
+	.long	0x2124
+	.uleb128 0x20
+	.long	.LASF105
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x37
+	.long	0x4a4
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF177
+	.byte	0x1
+	.byte	0x43
+	.byte	0x19
+	.long	0x4a4
+	.byte	0x1
+	.long	0x2165
+	.uleb128 0x20
+	.long	.LASF172
+	.byte	0x1
+	.byte	0x43
+	.byte	0x36
+	.long	0x3a
+	.uleb128 0x31
+	.long	.LASF62
+	.byte	0x51
+	.byte	0x9
+	.long	0xba
+	.uleb128 0x31
+	.long	.LASF105
+	.byte	0x59
+	.byte	0x1b
+	.long	0x4a4
+	.uleb128 0x2d
+	.uleb128 0x31
+	.long	.LASF105
+	.byte	0x46
+	.byte	0x1d
+	.long	0x4a4
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF178
+	.byte	0x33
+	.byte	0x19
+	.long	0x4a4
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x220c
+	.uleb128 0x14
+	.long	.LASF62
+	.byte	0x33
+	.byte	0x2b
+	.long	0xba
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x14
+	.long	.LASF63
+	.byte	0x33
+	.byte	0x40
+	.long	0x3a
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x19
+	.long	.LASF131
+	.byte	0x37
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x19
+	.long	.LASF105
+	.byte	0x38
+	.byte	0x1b
+	.long	0x4a4
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x7
+	.quad	.LVL4
+	.long	0x74d
+	.long	0x21eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x158
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL6
+	.long	0x220c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF179
+	.byte	0x22
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2250
+	.uleb128 0x18
+	.long	.LASF105
+	.byte	0x22
+	.byte	0x26
+	.long	0x4a4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x18
+	.long	.LASF62
+	.byte	0x22
+	.byte	0x37
+	.long	0xba
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x18
+	.long	.LASF63
+	.byte	0x22
+	.byte	0x4c
+	.long	0x3a
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF180
+	.byte	0x18
+	.byte	0x19
+	.long	0x4a4
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x22b2
+	.uleb128 0x14
+	.long	.LASF62
+	.byte	0x18
+	.byte	0x29
+	.long	0xba
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x7
+	.quad	.LVL12
+	.long	0x764
+	.long	0x229c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL14
+	.long	0x2165
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF181
+	.byte	0x2
+	.value	0x7b1
+	.byte	0x13
+	.long	0x46
+	.byte	0x3
+	.long	0x22df
+	.uleb128 0x9
+	.long	.LASF118
+	.byte	0x2
+	.value	0x7b1
+	.byte	0x4f
+	.long	0x22df
+	.uleb128 0x9
+	.long	.LASF64
+	.byte	0x2
+	.value	0x7b1
+	.byte	0x63
+	.long	0x3a
+	.byte	0
+	.uleb128 0xb
+	.long	0x47a
+	.uleb128 0x1b
+	.long	.LASF182
+	.byte	0x2
+	.value	0x5c1
+	.byte	0x13
+	.long	0x46
+	.byte	0x3
+	.long	0x2304
+	.uleb128 0x9
+	.long	.LASF120
+	.byte	0x2
+	.value	0x5c1
+	.byte	0x29
+	.long	0xc6
+	.byte	0
+	.uleb128 0x52
+	.long	.LASF183
+	.byte	0x2
+	.byte	0xca
+	.byte	0x13
+	.long	0x46
+	.byte	0x3
+	.long	0x232e
+	.uleb128 0x20
+	.long	.LASF120
+	.byte	0x2
+	.byte	0xca
+	.byte	0x29
+	.long	0xc6
+	.uleb128 0x20
+	.long	.LASF184
+	.byte	0x2
+	.byte	0xca
+	.byte	0x43
+	.long	0x75
+	.byte	0
+	.uleb128 0x1c
+	.long	0x2124
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2458
+	.uleb128 0x2
+	.long	0x2135
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xd
+	.long	0x2141
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xd
+	.long	0x214c
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x53
+	.long	0x2124
+	.quad	.LBI17
+	.byte	.LVU84
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.byte	0x1
+	.byte	0x43
+	.byte	0x19
+	.long	0x240d
+	.uleb128 0x2
+	.long	0x2135
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1d
+	.long	0x2141
+	.uleb128 0x1d
+	.long	0x214c
+	.uleb128 0x54
+	.long	0x2157
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0xd
+	.long	0x2158
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x7
+	.quad	.LVL23
+	.long	0x74d
+	.long	0x23e7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x158
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL24
+	.long	0x220c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL17
+	.long	0x74d
+	.long	0x2425
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 1
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL19
+	.long	0x2165
+	.long	0x2443
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL27
+	.long	0x73a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x2038
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x24c5
+	.uleb128 0x2
+	.long	0x2045
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x55
+	.long	0x2038
+	.quad	.LBI28
+	.byte	.LVU138
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.byte	0x1
+	.byte	0x8b
+	.byte	0x6
+	.uleb128 0x2
+	.long	0x2045
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1e
+	.quad	.LVL39
+	.long	0x727
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x1aed
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x25ec
+	.uleb128 0x2
+	.long	0x1afc
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x2
+	.long	0x1b09
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x2
+	.long	0x1b16
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x2
+	.long	0x1b23
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x1d
+	.long	0x1b30
+	.uleb128 0x30
+	.long	0x1aed
+	.quad	.LBI46
+	.byte	.LVU368
+	.quad	.LBB46
+	.quad	.LBE46-.LBB46
+	.value	0x14d
+	.byte	0x5
+	.long	0x25d2
+	.uleb128 0x2
+	.long	0x1b09
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x2
+	.long	0x1b23
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x2
+	.long	0x1b16
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x2
+	.long	0x1afc
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0xd
+	.long	0x1b30
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x56
+	.long	0x1b3b
+	.long	.LLRL44
+	.uleb128 0xd
+	.long	0x1b3c
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x7
+	.quad	.LVL106
+	.long	0x6a2
+	.long	0x25b3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 1
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL109
+	.long	0x681
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL103
+	.long	0x6a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x182a
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x271c
+	.uleb128 0x2
+	.long	0x1839
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x2
+	.long	0x1846
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x1d
+	.long	0x1853
+	.uleb128 0x12
+	.long	0x185f
+	.quad	.LBI69
+	.byte	.LVU514
+	.long	.LLRL62
+	.value	0x1b3
+	.byte	0x7
+	.long	0x26df
+	.uleb128 0x2
+	.long	0x187e
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x2
+	.long	0x1871
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x17
+	.long	.LLRL62
+	.uleb128 0xd
+	.long	0x188b
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x12
+	.long	0x22e4
+	.quad	.LBI71
+	.byte	.LVU521
+	.long	.LLRL66
+	.value	0x1a2
+	.byte	0x30
+	.long	0x26c3
+	.uleb128 0x2
+	.long	0x22f6
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x27
+	.long	0x2304
+	.quad	.LBI72
+	.byte	.LVU523
+	.long	.LLRL66
+	.byte	0x2
+	.value	0x5c2
+	.byte	0xa
+	.uleb128 0x2
+	.long	0x2321
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x2
+	.long	0x2315
+	.long	.LLST69
+	.long	.LVUS69
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL152
+	.long	0x6a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	0x182a
+	.quad	.LBI84
+	.byte	.LVU548
+	.long	.LLRL70
+	.byte	0x1
+	.value	0x1b2
+	.byte	0x5
+	.uleb128 0x2e
+	.long	0x1846
+	.uleb128 0x2
+	.long	0x1839
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x17
+	.long	.LLRL70
+	.uleb128 0xd
+	.long	0x1853
+	.long	.LLST72
+	.long	.LVUS72
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x10cf
+	.quad	.LFB58
+	.quad	.LFE58-.LFB58
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x284e
+	.uleb128 0x2
+	.long	0x10de
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x2
+	.long	0x10eb
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x1d
+	.long	0x10f8
+	.uleb128 0x1d
+	.long	0x1104
+	.uleb128 0x12
+	.long	0x10cf
+	.quad	.LBI130
+	.byte	.LVU866
+	.long	.LLRL114
+	.value	0x292
+	.byte	0x5
+	.long	0x2842
+	.uleb128 0x2
+	.long	0x10eb
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x2
+	.long	0x10de
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x17
+	.long	.LLRL114
+	.uleb128 0xd
+	.long	0x10f8
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0xd
+	.long	0x1104
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x27
+	.long	0x1111
+	.quad	.LBI132
+	.byte	.LVU888
+	.long	.LLRL119
+	.byte	0x1
+	.value	0x2af
+	.byte	0xa
+	.uleb128 0x2
+	.long	0x1130
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x2
+	.long	0x1123
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x17
+	.long	.LLRL119
+	.uleb128 0xd
+	.long	0x113d
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x38
+	.long	0x1149
+	.quad	.LBB134
+	.quad	.LBE134-.LBB134
+	.long	0x282a
+	.uleb128 0xd
+	.long	0x114a
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x5
+	.quad	.LVL260
+	.long	0x74d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL267
+	.long	0x57b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.quad	.LVL261
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x1c
+	.long	0xe88
+	.quad	.LFB62
+	.quad	.LFE62-.LFB62
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2912
+	.uleb128 0x2
+	.long	0xe97
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x2
+	.long	0xea4
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x2
+	.long	0xeb1
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x30
+	.long	0xe88
+	.quad	.LBI164
+	.byte	.LVU1108
+	.quad	.LBB164
+	.quad	.LBE164-.LBB164
+	.value	0x2d9
+	.byte	0x5
+	.long	0x28f7
+	.uleb128 0x2
+	.long	0xeb1
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x2
+	.long	0xea4
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x2
+	.long	0xe97
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x5
+	.quad	.LVL311
+	.long	0x2912
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL309
+	.long	0x10cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF88
+	.long	.LASF185
+	.uleb128 0x3c
+	.long	.LASF89
+	.long	.LASF186
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 693
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS181:
+	.uleb128 0
+	.uleb128 .LVU1437
+	.uleb128 .LVU1437
+	.uleb128 .LVU1444
+	.uleb128 .LVU1444
+	.uleb128 0
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 .LVL431-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL431-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS182:
+	.uleb128 0
+	.uleb128 .LVU1435
+	.uleb128 .LVU1435
+	.uleb128 .LVU1438
+	.uleb128 .LVU1438
+	.uleb128 0
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL428-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL428-1-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS183:
+	.uleb128 0
+	.uleb128 .LVU1438
+	.uleb128 .LVU1438
+	.uleb128 0
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL428-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL428-1-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU1439
+	.uleb128 .LVU1443
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 .LVL430-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS177:
+	.uleb128 0
+	.uleb128 .LVU1417
+	.uleb128 .LVU1417
+	.uleb128 .LVU1427
+	.uleb128 .LVU1427
+	.uleb128 0
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL418-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL418-1-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS178:
+	.uleb128 0
+	.uleb128 .LVU1414
+	.uleb128 .LVU1414
+	.uleb128 .LVU1428
+	.uleb128 .LVU1428
+	.uleb128 0
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS179:
+	.uleb128 0
+	.uleb128 .LVU1417
+	.uleb128 .LVU1417
+	.uleb128 .LVU1429
+	.uleb128 .LVU1429
+	.uleb128 0
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL418-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL418-1-.Ltext0
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU1419
+	.uleb128 .LVU1426
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL419-.Ltext0
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS174:
+	.uleb128 0
+	.uleb128 .LVU1398
+	.uleb128 .LVU1398
+	.uleb128 .LVU1408
+	.uleb128 .LVU1408
+	.uleb128 0
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL410-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL410-1-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS175:
+	.uleb128 0
+	.uleb128 .LVU1396
+	.uleb128 .LVU1396
+	.uleb128 .LVU1409
+	.uleb128 .LVU1409
+	.uleb128 0
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU1400
+	.uleb128 .LVU1407
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS171:
+	.uleb128 0
+	.uleb128 .LVU1380
+	.uleb128 .LVU1380
+	.uleb128 .LVU1390
+	.uleb128 .LVU1390
+	.uleb128 0
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL402-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL402-1-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS172:
+	.uleb128 0
+	.uleb128 .LVU1378
+	.uleb128 .LVU1378
+	.uleb128 .LVU1391
+	.uleb128 .LVU1391
+	.uleb128 0
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LVL407-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL407-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU1382
+	.uleb128 .LVU1389
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS169:
+	.uleb128 0
+	.uleb128 .LVU1365
+	.uleb128 .LVU1365
+	.uleb128 .LVU1372
+	.uleb128 .LVU1372
+	.uleb128 .LVU1373
+	.uleb128 .LVU1373
+	.uleb128 0
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL395-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL395-.Ltext0
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL398-.Ltext0
+	.uleb128 .LVL399-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL399-1-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS170:
+	.uleb128 0
+	.uleb128 .LVU1367
+	.uleb128 .LVU1367
+	.uleb128 .LVU1370
+	.uleb128 .LVU1370
+	.uleb128 .LVU1373
+	.uleb128 .LVU1373
+	.uleb128 0
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL396-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL396-1-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LVL399-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL399-1-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS161:
+	.uleb128 0
+	.uleb128 .LVU1254
+	.uleb128 .LVU1254
+	.uleb128 .LVU1324
+	.uleb128 .LVU1324
+	.uleb128 .LVU1325
+	.uleb128 .LVU1325
+	.uleb128 .LVU1347
+	.uleb128 .LVU1347
+	.uleb128 .LVU1349
+	.uleb128 .LVU1349
+	.uleb128 0
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL357-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL357-1-.Ltext0
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS162:
+	.uleb128 0
+	.uleb128 .LVU1252
+	.uleb128 .LVU1252
+	.uleb128 .LVU1323
+	.uleb128 .LVU1323
+	.uleb128 .LVU1325
+	.uleb128 .LVU1325
+	.uleb128 .LVU1346
+	.uleb128 .LVU1346
+	.uleb128 .LVU1349
+	.uleb128 .LVU1349
+	.uleb128 0
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS163:
+	.uleb128 0
+	.uleb128 .LVU1254
+	.uleb128 .LVU1254
+	.uleb128 .LVU1322
+	.uleb128 .LVU1322
+	.uleb128 .LVU1325
+	.uleb128 .LVU1325
+	.uleb128 .LVU1345
+	.uleb128 .LVU1345
+	.uleb128 .LVU1349
+	.uleb128 .LVU1349
+	.uleb128 0
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL357-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL357-1-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU1261
+	.uleb128 .LVU1264
+	.uleb128 .LVU1264
+	.uleb128 .LVU1281
+	.uleb128 .LVU1281
+	.uleb128 .LVU1289
+	.uleb128 .LVU1289
+	.uleb128 .LVU1312
+	.uleb128 .LVU1325
+	.uleb128 .LVU1343
+	.uleb128 .LVU1349
+	.uleb128 .LVU1359
+	.uleb128 .LVU1359
+	.uleb128 0
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU1268
+	.uleb128 .LVU1270
+	.uleb128 .LVU1270
+	.uleb128 .LVU1279
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 .LVL362-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL362-1-.Ltext0
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU1286
+	.uleb128 .LVU1307
+	.uleb128 .LVU1325
+	.uleb128 .LVU1330
+	.uleb128 .LVU1331
+	.uleb128 .LVU1336
+	.uleb128 .LVU1337
+	.uleb128 .LVU1342
+	.uleb128 .LVU1349
+	.uleb128 .LVU1353
+	.uleb128 .LVU1354
+	.uleb128 .LVU1358
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU1289
+	.uleb128 .LVU1300
+	.uleb128 .LVU1325
+	.uleb128 .LVU1327
+	.uleb128 .LVU1331
+	.uleb128 .LVU1333
+	.uleb128 .LVU1337
+	.uleb128 .LVU1339
+	.uleb128 .LVU1349
+	.uleb128 .LVU1350
+	.uleb128 .LVU1354
+	.uleb128 .LVU1355
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS159:
+	.uleb128 0
+	.uleb128 .LVU1238
+	.uleb128 .LVU1238
+	.uleb128 .LVU1246
+	.uleb128 .LVU1246
+	.uleb128 0
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LFE66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS160:
+	.uleb128 0
+	.uleb128 .LVU1241
+	.uleb128 .LVU1241
+	.uleb128 0
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL352-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL352-1-.Ltext0
+	.uleb128 .LFE66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS157:
+	.uleb128 0
+	.uleb128 .LVU1224
+	.uleb128 .LVU1224
+	.uleb128 .LVU1231
+	.uleb128 .LVU1231
+	.uleb128 .LVU1232
+	.uleb128 .LVU1232
+	.uleb128 0
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS158:
+	.uleb128 0
+	.uleb128 .LVU1226
+	.uleb128 .LVU1226
+	.uleb128 .LVU1229
+	.uleb128 .LVU1229
+	.uleb128 .LVU1232
+	.uleb128 .LVU1232
+	.uleb128 0
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL346-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL346-1-.Ltext0
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL349-1-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS149:
+	.uleb128 0
+	.uleb128 .LVU1184
+	.uleb128 .LVU1184
+	.uleb128 .LVU1208
+	.uleb128 .LVU1208
+	.uleb128 .LVU1209
+	.uleb128 .LVU1209
+	.uleb128 .LVU1212
+	.uleb128 .LVU1212
+	.uleb128 .LVU1215
+	.uleb128 .LVU1215
+	.uleb128 .LVU1218
+	.uleb128 .LVU1218
+	.uleb128 0
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS150:
+	.uleb128 0
+	.uleb128 .LVU1151
+	.uleb128 .LVU1151
+	.uleb128 .LVU1192
+	.uleb128 .LVU1192
+	.uleb128 .LVU1209
+	.uleb128 .LVU1209
+	.uleb128 .LVU1211
+	.uleb128 .LVU1211
+	.uleb128 .LVU1218
+	.uleb128 .LVU1218
+	.uleb128 0
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS151:
+	.uleb128 0
+	.uleb128 .LVU1150
+	.uleb128 .LVU1150
+	.uleb128 .LVU1188
+	.uleb128 .LVU1188
+	.uleb128 .LVU1209
+	.uleb128 .LVU1209
+	.uleb128 .LVU1212
+	.uleb128 .LVU1212
+	.uleb128 .LVU1218
+	.uleb128 .LVU1218
+	.uleb128 0
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU1145
+	.uleb128 .LVU1151
+	.uleb128 .LVU1156
+	.uleb128 .LVU1181
+	.uleb128 .LVU1209
+	.uleb128 .LVU1214
+	.uleb128 .LVU1218
+	.uleb128 0
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU1189
+	.uleb128 .LVU1193
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL335-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU1147
+	.uleb128 .LVU1151
+	.uleb128 .LVU1209
+	.uleb128 .LVU1214
+	.uleb128 .LVU1218
+	.uleb128 0
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU1191
+	.uleb128 .LVU1192
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS147:
+	.uleb128 0
+	.uleb128 .LVU1131
+	.uleb128 .LVU1131
+	.uleb128 .LVU1142
+	.uleb128 .LVU1142
+	.uleb128 0
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL318-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL318-1-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LFE63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS148:
+	.uleb128 0
+	.uleb128 .LVU1129
+	.uleb128 .LVU1129
+	.uleb128 0
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LFE63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS133:
+	.uleb128 0
+	.uleb128 .LVU1040
+	.uleb128 .LVU1040
+	.uleb128 .LVU1043
+	.uleb128 .LVU1043
+	.uleb128 .LVU1048
+	.uleb128 .LVU1048
+	.uleb128 .LVU1051
+	.uleb128 .LVU1051
+	.uleb128 .LVU1054
+	.uleb128 .LVU1054
+	.uleb128 0
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LFE61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU1038
+	.uleb128 .LVU1041
+	.uleb128 .LVU1043
+	.uleb128 .LVU1052
+	.uleb128 .LVU1054
+	.uleb128 0
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LFE61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU1045
+	.uleb128 .LVU1052
+	.uleb128 .LVU1054
+	.uleb128 .LVU1074
+	.uleb128 .LVU1080
+	.uleb128 .LVU1099
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU1045
+	.uleb128 .LVU1051
+	.uleb128 .LVU1051
+	.uleb128 .LVU1054
+	.uleb128 .LVU1054
+	.uleb128 .LVU1074
+	.uleb128 .LVU1080
+	.uleb128 .LVU1099
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU1061
+	.uleb128 .LVU1074
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU1082
+	.uleb128 .LVU1099
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS124:
+	.uleb128 0
+	.uleb128 .LVU958
+	.uleb128 .LVU958
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 .LVU962
+	.uleb128 .LVU962
+	.uleb128 0
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS125:
+	.uleb128 0
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU962
+	.uleb128 .LVU962
+	.uleb128 .LVU968
+	.uleb128 .LVU968
+	.uleb128 .LVU988
+	.uleb128 .LVU988
+	.uleb128 .LVU991
+	.uleb128 .LVU991
+	.uleb128 .LVU1005
+	.uleb128 .LVU1005
+	.uleb128 0
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL275-1-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU953
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU962
+	.uleb128 .LVU962
+	.uleb128 .LVU968
+	.uleb128 .LVU968
+	.uleb128 .LVU988
+	.uleb128 .LVU988
+	.uleb128 .LVU991
+	.uleb128 .LVU991
+	.uleb128 .LVU1005
+	.uleb128 .LVU1005
+	.uleb128 0
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL275-1-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU953
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 .LVU962
+	.uleb128 .LVU962
+	.uleb128 0
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU991
+	.uleb128 .LVU1005
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU968
+	.uleb128 .LVU988
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS105:
+	.uleb128 0
+	.uleb128 .LVU830
+	.uleb128 .LVU830
+	.uleb128 .LVU843
+	.uleb128 .LVU843
+	.uleb128 .LVU845
+	.uleb128 .LVU845
+	.uleb128 .LVU854
+	.uleb128 .LVU854
+	.uleb128 0
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 0
+	.uleb128 .LVU830
+	.uleb128 .LVU830
+	.uleb128 0
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 0
+	.uleb128 .LVU830
+	.uleb128 .LVU830
+	.uleb128 .LVU844
+	.uleb128 .LVU844
+	.uleb128 .LVU845
+	.uleb128 .LVU845
+	.uleb128 .LVU856
+	.uleb128 .LVU856
+	.uleb128 0
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU837
+	.uleb128 .LVU845
+	.uleb128 .LVU850
+	.uleb128 .LVU853
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU833
+	.uleb128 .LVU837
+	.uleb128 .LVU845
+	.uleb128 .LVU850
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU832
+	.uleb128 .LVU837
+	.uleb128 .LVU845
+	.uleb128 .LVU850
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 0
+	.uleb128 .LVU800
+	.uleb128 .LVU800
+	.uleb128 .LVU816
+	.uleb128 .LVU816
+	.uleb128 .LVU817
+	.uleb128 .LVU817
+	.uleb128 .LVU824
+	.uleb128 .LVU824
+	.uleb128 0
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 0
+	.uleb128 .LVU802
+	.uleb128 .LVU802
+	.uleb128 .LVU814
+	.uleb128 .LVU814
+	.uleb128 .LVU817
+	.uleb128 .LVU817
+	.uleb128 .LVU822
+	.uleb128 .LVU822
+	.uleb128 0
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL229-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL229-1-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU804
+	.uleb128 .LVU807
+	.uleb128 .LVU807
+	.uleb128 .LVU815
+	.uleb128 .LVU817
+	.uleb128 .LVU823
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL231-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL231-1-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS97:
+	.uleb128 0
+	.uleb128 .LVU770
+	.uleb128 .LVU770
+	.uleb128 .LVU783
+	.uleb128 .LVU783
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU795
+	.uleb128 .LVU795
+	.uleb128 0
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL219-1-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU777
+	.uleb128 .LVU784
+	.uleb128 .LVU789
+	.uleb128 .LVU792
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU773
+	.uleb128 .LVU777
+	.uleb128 .LVU784
+	.uleb128 .LVU789
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU772
+	.uleb128 .LVU777
+	.uleb128 .LVU784
+	.uleb128 .LVU789
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 0
+	.uleb128 .LVU673
+	.uleb128 .LVU673
+	.uleb128 .LVU737
+	.uleb128 .LVU737
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU762
+	.uleb128 .LVU762
+	.uleb128 0
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL191-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL191-1-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 0
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU764
+	.uleb128 .LVU764
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU674
+	.uleb128 .LVU678
+	.uleb128 .LVU692
+	.uleb128 .LVU698
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU676
+	.uleb128 .LVU680
+	.uleb128 .LVU680
+	.uleb128 .LVU681
+	.uleb128 .LVU694
+	.uleb128 .LVU698
+	.uleb128 .LVU698
+	.uleb128 .LVU703
+	.uleb128 .LVU741
+	.uleb128 .LVU763
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU699
+	.uleb128 .LVU703
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU720
+	.uleb128 .LVU721
+	.uleb128 .LVU721
+	.uleb128 .LVU725
+	.uleb128 .LVU725
+	.uleb128 .LVU727
+	.uleb128 .LVU727
+	.uleb128 .LVU735
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x73
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x73
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5c
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x55
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5c
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL209-1-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x5
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5c
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU703
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 .LVU715
+	.uleb128 .LVU715
+	.uleb128 .LVU722
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU703
+	.uleb128 .LVU707
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x73
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU705
+	.uleb128 .LVU707
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU705
+	.uleb128 .LVU707
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x73
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+.LVUS82:
+	.uleb128 0
+	.uleb128 .LVU645
+	.uleb128 .LVU645
+	.uleb128 .LVU648
+	.uleb128 .LVU648
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU659
+	.uleb128 .LVU659
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL179-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL179-1-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS83:
+	.uleb128 0
+	.uleb128 .LVU644
+	.uleb128 .LVU644
+	.uleb128 .LVU649
+	.uleb128 .LVU649
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU660
+	.uleb128 .LVU660
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 0
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU653
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 0
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS78:
+	.uleb128 0
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 .LVU631
+	.uleb128 .LVU631
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU624
+	.uleb128 .LVU628
+	.uleb128 .LVU631
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+	.uleb128 0
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU623
+	.uleb128 .LVU628
+	.uleb128 .LVU631
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 0
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU613
+	.uleb128 .LVU613
+	.uleb128 0
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 0
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU611
+	.uleb128 .LVU611
+	.uleb128 0
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 0
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU566
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU610
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU575
+	.uleb128 .LVU584
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 0
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU496
+	.uleb128 .LVU500
+	.uleb128 .LVU503
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU495
+	.uleb128 .LVU500
+	.uleb128 .LVU503
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU480
+	.uleb128 .LVU480
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 0
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU446
+	.uleb128 .LVU446
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU479
+	.uleb128 .LVU479
+	.uleb128 .LVU483
+	.uleb128 .LVU483
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU417
+	.uleb128 .LVU417
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 .LVU429
+	.uleb128 .LVU429
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU417
+	.uleb128 .LVU417
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU417
+	.uleb128 .LVU417
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU422
+	.uleb128 .LVU426
+	.uleb128 .LVU429
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU421
+	.uleb128 .LVU426
+	.uleb128 .LVU429
+	.uleb128 .LVU436
+	.uleb128 .LVU436
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 .LVU356
+	.uleb128 .LVU356
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL99-1-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU291
+	.uleb128 .LVU325
+	.uleb128 .LVU326
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU292
+	.uleb128 .LVU295
+	.uleb128 .LVU326
+	.uleb128 .LVU340
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU326
+	.uleb128 .LVU328
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU326
+	.uleb128 .LVU328
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU332
+	.uleb128 .LVU334
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU332
+	.uleb128 .LVU334
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU261
+	.uleb128 .LVU262
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL69-1-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU229
+	.uleb128 .LVU234
+	.uleb128 .LVU240
+	.uleb128 .LVU241
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x12
+	.byte	0x75
+	.sleb128 56
+	.byte	0x94
+	.byte	0x4
+	.byte	0x9
+	.byte	0xfd
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-1-.Ltext0
+	.uleb128 0x12
+	.byte	0x73
+	.sleb128 56
+	.byte	0x94
+	.byte	0x4
+	.byte	0x9
+	.byte	0xfd
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU248
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU265
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU250
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU265
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x18
+	.byte	0
+.LVUS131:
+	.uleb128 0
+	.uleb128 .LVU1011
+	.uleb128 .LVU1011
+	.uleb128 .LVU1022
+	.uleb128 .LVU1022
+	.uleb128 .LVU1023
+	.uleb128 .LVU1023
+	.uleb128 .LVU1027
+	.uleb128 .LVU1027
+	.uleb128 .LVU1029
+	.uleb128 .LVU1029
+	.uleb128 .LVU1029
+	.uleb128 .LVU1029
+	.uleb128 0
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL281-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL281-1-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL288-1-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU1016
+	.uleb128 .LVU1021
+	.uleb128 .LVU1029
+	.uleb128 .LVU1032
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU193
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU154
+	.uleb128 .LVU165
+	.uleb128 .LVU181
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU112
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU119
+	.uleb128 .LVU123
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU29
+	.uleb128 .LVU43
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x158
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU33
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU43
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU64
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU82
+	.uleb128 .LVU103
+	.uleb128 .LVU105
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU75
+	.uleb128 .LVU82
+	.uleb128 .LVU103
+	.uleb128 .LVU104
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU84
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 24
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU87
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU103
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU138
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU407
+	.uleb128 .LVU407
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 0
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU369
+	.uleb128 .LVU370
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU368
+	.uleb128 .LVU404
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU368
+	.uleb128 .LVU404
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU368
+	.uleb128 .LVU404
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU370
+	.uleb128 .LVU394
+	.uleb128 .LVU394
+	.uleb128 .LVU404
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU370
+	.uleb128 .LVU375
+	.uleb128 .LVU378
+	.uleb128 .LVU404
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU563
+	.uleb128 .LVU563
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU514
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU547
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU514
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU547
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU516
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU531
+	.uleb128 .LVU531
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU547
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU521
+	.uleb128 .LVU525
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 0
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU523
+	.uleb128 .LVU525
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU523
+	.uleb128 .LVU525
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 0
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU547
+	.uleb128 .LVU559
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU550
+	.uleb128 .LVU559
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 8
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 .LVU865
+	.uleb128 .LVU865
+	.uleb128 .LVU866
+	.uleb128 .LVU866
+	.uleb128 .LVU921
+	.uleb128 .LVU921
+	.uleb128 .LVU924
+	.uleb128 .LVU924
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU866
+	.uleb128 .LVU879
+	.uleb128 .LVU879
+	.uleb128 .LVU916
+	.uleb128 .LVU916
+	.uleb128 .LVU924
+	.uleb128 .LVU924
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU866
+	.uleb128 .LVU879
+	.uleb128 .LVU879
+	.uleb128 .LVU915
+	.uleb128 .LVU916
+	.uleb128 .LVU921
+	.uleb128 .LVU924
+	.uleb128 0
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU866
+	.uleb128 .LVU915
+	.uleb128 .LVU916
+	.uleb128 .LVU921
+	.uleb128 .LVU924
+	.uleb128 0
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU877
+	.uleb128 .LVU896
+	.uleb128 .LVU919
+	.uleb128 .LVU921
+	.uleb128 .LVU924
+	.uleb128 .LVU926
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL260-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU882
+	.uleb128 .LVU914
+	.uleb128 .LVU924
+	.uleb128 0
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU888
+	.uleb128 .LVU914
+	.uleb128 .LVU924
+	.uleb128 0
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU888
+	.uleb128 .LVU914
+	.uleb128 .LVU924
+	.uleb128 0
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU926
+	.uleb128 0
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU896
+	.uleb128 .LVU914
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS141:
+	.uleb128 0
+	.uleb128 .LVU1107
+	.uleb128 .LVU1107
+	.uleb128 .LVU1123
+	.uleb128 .LVU1123
+	.uleb128 0
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL309-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL309-1-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 0
+	.uleb128 .LVU1104
+	.uleb128 .LVU1104
+	.uleb128 .LVU1124
+	.uleb128 .LVU1124
+	.uleb128 0
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS143:
+	.uleb128 0
+	.uleb128 .LVU1107
+	.uleb128 .LVU1107
+	.uleb128 .LVU1117
+	.uleb128 .LVU1117
+	.uleb128 0
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL309-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL309-1-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU1108
+	.uleb128 .LVU1117
+	.uleb128 .LVU1117
+	.uleb128 .LVU1121
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU1108
+	.uleb128 .LVU1121
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU1108
+	.uleb128 .LVU1121
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0
+.LLRL66:
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0
+.LLRL91:
+	.byte	0x4
+	.uleb128 .LBB103-.Ltext0
+	.uleb128 .LBE103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0
+.LLRL93:
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0
+.LLRL109:
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0
+.LLRL114:
+	.byte	0x4
+	.uleb128 .LBB130-.Ltext0
+	.uleb128 .LBE130-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0
+.LLRL119:
+	.byte	0x4
+	.uleb128 .LBB132-.Ltext0
+	.uleb128 .LBE132-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0
+.LLRL126:
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB147-.Ltext0
+	.uleb128 .LBE147-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0
+.LLRL135:
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB161-.Ltext0
+	.uleb128 .LBE161-.Ltext0
+	.byte	0
+.LLRL139:
+	.byte	0x4
+	.uleb128 .LBB154-.Ltext0
+	.uleb128 .LBE154-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB155-.Ltext0
+	.uleb128 .LBE155-.Ltext0
+	.byte	0
+.LLRL154:
+	.byte	0x4
+	.uleb128 .LBB166-.Ltext0
+	.uleb128 .LBE166-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0
+.LLRL165:
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF124:
+	.string	"st_append_many"
+.LASF44:
+	.string	"conversion_ns"
+.LASF114:
+	.string	"st_append_int"
+.LASF94:
+	.string	"st_arena_string"
+.LASF149:
+	.string	"st_extract_numbers"
+.LASF104:
+	.string	"strlen"
+.LASF85:
+	.string	"i64tos_to"
+.LASF49:
+	.string	"capacity"
+.LASF31:
+	.string	"StringArena"
+.LASF170:
+	.string	"builder"
+.LASF108:
+	.string	"buffer"
+.LASF138:
+	.string	"needle"
+.LASF7:
+	.string	"unsigned int"
+.LASF52:
+	.string	"StringCharClassBits"
+.LASF65:
+	.string	"incremental_factor"
+.LASF121:
+	.string	"st_append_quoted_string"
+.LASF32:
+	.string	"head"
+.LASF53:
+	.string	"StringGrowthPolicy"
+.LASF165:
+	.string	"st_allocate"
+.LASF55:
+	.string	"ST_GROWTH_LINEAR"
+.LASF61:
+	.string	"StringTokenizer"
+.LASF101:
+	.string	"st_drop_structural_index"
+.LASF158:
+	.string	"start_delim"
+.LASF58:
+	.string	"ST_STRING_OWNED"
+.LASF51:
+	.string	"error"
+.LASF21:
+	.string	"ST_CLASS_WHITESPACE"
+.LASF99:
+	.string	"sv_to_string"
+.LASF185:
+	.string	"__builtin_memcpy"
+.LASF93:
+	.string	"st_scan_class"
+.LASF117:
+	.string	"hex_digits"
+.LASF183:
+	.string	"st_char_is"
+.LASF48:
+	.string	"chunk_size"
+.LASF146:
+	.string	"decimal"
+.LASF125:
+	.string	"st_append_char"
+.LASF168:
+	.string	"st_pool_clear"
+.LASF22:
+	.string	"ST_CLASS_DIGIT"
+.LASF129:
+	.string	"policy"
+.LASF92:
+	.string	"stod"
+.LASF103:
+	.string	"malloc"
+.LASF76:
+	.string	"count"
+.LASF118:
+	.string	"index"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF144:
+	.string	"consumed"
+.LASF167:
+	.string	"st_attach_arena"
+.LASF96:
+	.string	"st_ensure"
+.LASF97:
+	.string	"st_scan_non_whitespace"
+.LASF161:
+	.string	"st_current_token"
+.LASF150:
+	.string	"st_extract_until_view"
+.LASF59:
+	.string	"ST_STRING_MAPPED"
+.LASF70:
+	.string	"arena"
+.LASF106:
+	.string	"value"
+.LASF128:
+	.string	"st_reserve"
+.LASF34:
+	.string	"used"
+.LASF182:
+	.string	"is_numeric"
+.LASF130:
+	.string	"st_expand_string"
+.LASF153:
+	.string	"st_resize_string"
+.LASF9:
+	.string	"size_t"
+.LASF17:
+	.string	"int64_t"
+.LASF50:
+	.string	"offset"
+.LASF39:
+	.string	"allocations"
+.LASF81:
+	.string	"string_tokenizer_pool_count"
+.LASF171:
+	.string	"st_pool_acquire"
+.LASF147:
+	.string	"st_extract_double_to"
+.LASF126:
+	.string	"st_append_n"
+.LASF67:
+	.string	"max_increment"
+.LASF188:
+	.string	"StringArenaBlock"
+.LASF13:
+	.string	"__uint64_t"
+.LASF175:
+	.string	"st_reset"
+.LASF160:
+	.string	"st_sub_string_view"
+.LASF142:
+	.string	"st_extract_int64"
+.LASF86:
+	.string	"st_scan_escape"
+.LASF90:
+	.string	"st_arena_alloc"
+.LASF15:
+	.string	"char"
+.LASF62:
+	.string	"string"
+.LASF140:
+	.string	"st_extract_double"
+.LASF174:
+	.string	"st_rebind"
+.LASF159:
+	.string	"end_delim"
+.LASF16:
+	.string	"ssize_t"
+.LASF19:
+	.string	"uint8_t"
+.LASF27:
+	.string	"ST_CLASS_ALPHA"
+.LASF54:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF123:
+	.string	"st_append_string"
+.LASF162:
+	.string	"st_set_growth_policy"
+.LASF74:
+	.string	"StringStructuralIndex"
+.LASF189:
+	.string	"st_release_string"
+.LASF84:
+	.string	"dtos_to"
+.LASF25:
+	.string	"ST_CLASS_STRUCTURAL"
+.LASF4:
+	.string	"long long int"
+.LASF95:
+	.string	"st_scan_delimiter"
+.LASF169:
+	.string	"st_pool_release"
+.LASF47:
+	.string	"context"
+.LASF181:
+	.string	"st_structural_in_string"
+.LASF43:
+	.string	"conversions"
+.LASF102:
+	.string	"free"
+.LASF78:
+	.string	"hint"
+.LASF131:
+	.string	"size"
+.LASF127:
+	.string	"st_shrink_to_fit"
+.LASF110:
+	.string	"st_char_classes"
+.LASF40:
+	.string	"reallocations"
+.LASF80:
+	.string	"string_tokenizer_pool"
+.LASF69:
+	.string	"ownership"
+.LASF176:
+	.string	"st_destroy"
+.LASF57:
+	.string	"ST_STRING_BORROWED"
+.LASF12:
+	.string	"__int64_t"
+.LASF35:
+	.string	"long double"
+.LASF120:
+	.string	"token"
+.LASF154:
+	.string	"st_numbers_view"
+.LASF36:
+	.string	"StringStats"
+.LASF107:
+	.string	"precision"
+.LASF75:
+	.string	"positions"
+.LASF115:
+	.string	"st_append_escaped_string"
+.LASF30:
+	.string	"members"
+.LASF133:
+	.string	"new_length"
+.LASF29:
+	.string	"StringCharClass"
+.LASF37:
+	.string	"bytes_scanned"
+.LASF11:
+	.string	"short int"
+.LASF157:
+	.string	"st_sub_string"
+.LASF155:
+	.string	"st_slice_string"
+.LASF3:
+	.string	"long int"
+.LASF143:
+	.string	"available"
+.LASF63:
+	.string	"length"
+.LASF134:
+	.string	"st_extract_boolean"
+.LASF151:
+	.string	"delimiters"
+.LASF145:
+	.string	"next"
+.LASF38:
+	.string	"tokens_extracted"
+.LASF112:
+	.string	"st_append_double_precision"
+.LASF136:
+	.string	"int_value"
+.LASF164:
+	.string	"st_copy_view"
+.LASF89:
+	.string	"memcmp"
+.LASF20:
+	.string	"uint64_t"
+.LASF24:
+	.string	"ST_CLASS_HEX"
+.LASF98:
+	.string	"st_structural_next"
+.LASF33:
+	.string	"block_size"
+.LASF79:
+	.string	"double"
+.LASF14:
+	.string	"__ssize_t"
+.LASF10:
+	.string	"__uint8_t"
+.LASF141:
+	.string	"number"
+.LASF56:
+	.string	"StringOwnership"
+.LASF46:
+	.string	"read"
+.LASF109:
+	.string	"start"
+.LASF177:
+	.string	"st_create_empty"
+.LASF180:
+	.string	"st_create"
+.LASF173:
+	.string	"st_detach_string"
+.LASF135:
+	.string	"bool_value"
+.LASF148:
+	.string	"converted"
+.LASF2:
+	.string	"long unsigned int"
+.LASF187:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF83:
+	.string	"dtos_precision_to"
+.LASF105:
+	.string	"tokenizer"
+.LASF72:
+	.string	"structural_index"
+.LASF60:
+	.string	"ST_STRING_INLINE"
+.LASF122:
+	.string	"fragments"
+.LASF116:
+	.string	"st_append_escaped_n"
+.LASF156:
+	.string	"st_slice_string_view"
+.LASF26:
+	.string	"ST_CLASS_ESCAPE"
+.LASF5:
+	.string	"unsigned char"
+.LASF71:
+	.string	"inline_buffer"
+.LASF28:
+	.string	"StringView"
+.LASF45:
+	.string	"StringStream"
+.LASF82:
+	.string	"dtos_fixed_to"
+.LASF41:
+	.string	"expansions"
+.LASF178:
+	.string	"st_create_n"
+.LASF73:
+	.string	"stats"
+.LASF87:
+	.string	"realloc"
+.LASF100:
+	.string	"munmap"
+.LASF119:
+	.string	"destination"
+.LASF8:
+	.string	"signed char"
+.LASF6:
+	.string	"short unsigned int"
+.LASF88:
+	.string	"memcpy"
+.LASF139:
+	.string	"view"
+.LASF111:
+	.string	"st_append_fixed"
+.LASF132:
+	.string	"add_size"
+.LASF186:
+	.string	"__builtin_memcmp"
+.LASF66:
+	.string	"growth_policy"
+.LASF166:
+	.string	"st_attach_stats"
+.LASF152:
+	.string	"st_extract_numbers_view"
+.LASF77:
+	.string	"in_string"
+.LASF23:
+	.string	"ST_CLASS_NUMERIC"
+.LASF172:
+	.string	"string_size"
+.LASF184:
+	.string	"classes"
+.LASF137:
+	.string	"st_starts_with"
+.LASF163:
+	.string	"st_next_token"
+.LASF91:
+	.string	"stoi64"
+.LASF42:
+	.string	"bytes_copied"
+.LASF113:
+	.string	"st_append_double"
+.LASF64:
+	.string	"position"
+.LASF179:
+	.string	"st_init"
+.LASF68:
+	.string	"stream"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/string_tokenizer.c"
+.LASF1:
+	.string	"/root/repo/build/library"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1937 @@
+	.file	"string_view.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/library" "/root/repo/src/string_view.c"
+	.p2align 4
+	.globl	sv_from_string
+	.type	sv_from_string, @function
+sv_from_string:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/src/string_view.c"
+	.loc 1 11 54 view -0
+	.cfi_startproc
+	.loc 1 12 3 view .LVU1
+	.loc 1 13 3 view .LVU2
+	.loc 1 11 54 is_stmt 0 view .LVU3
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	xorl	%edx, %edx
+	.loc 1 11 54 view .LVU4
+	movq	%rdi, %rbx
+	.loc 1 13 6 view .LVU5
+	testq	%rdi, %rdi
+	je	.L2
+	.loc 1 14 5 is_stmt 1 view .LVU6
+	.loc 1 14 16 is_stmt 0 view .LVU7
+	call	strlen@PLT
+.LVL1:
+	.loc 1 14 16 view .LVU8
+	movq	%rax, %rdx
+.LVL2:
+.L2:
+	.loc 1 16 3 is_stmt 1 view .LVU9
+	.loc 1 17 1 is_stmt 0 view .LVU10
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL3:
+	.loc 1 17 1 view .LVU11
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	sv_from_string, .-sv_from_string
+	.p2align 4
+	.globl	sv_compare
+	.type	sv_compare, @function
+sv_compare:
+.LVL4:
+.LFB27:
+	.loc 1 22 72 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 23 3 view .LVU13
+	.loc 1 22 72 is_stmt 0 view .LVU14
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 23 29 view .LVU15
+	movq	8(%rsi), %rbx
+	.loc 1 23 20 view .LVU16
+	movq	8(%rdi), %rbp
+	.loc 1 23 10 view .LVU17
+	cmpq	%rbp, %rbx
+	movq	%rbp, %rdx
+	cmovbe	%rbx, %rdx
+.LVL5:
+	.loc 1 24 3 is_stmt 1 view .LVU18
+	.loc 1 24 60 is_stmt 0 view .LVU19
+	testq	%rdx, %rdx
+	je	.L9
+	.loc 1 24 29 discriminator 1 view .LVU20
+	movq	(%rsi), %rsi
+.LVL6:
+	.loc 1 24 29 discriminator 1 view .LVU21
+	movq	(%rdi), %rdi
+.LVL7:
+	.loc 1 24 29 discriminator 1 view .LVU22
+	call	memcmp@PLT
+.LVL8:
+	.loc 1 25 3 is_stmt 1 discriminator 1 view .LVU23
+	.loc 1 25 6 is_stmt 0 discriminator 1 view .LVU24
+	testl	%eax, %eax
+	jne	.L8
+.LVL9:
+.L9:
+	.loc 1 29 3 is_stmt 1 view .LVU25
+	.loc 1 30 12 is_stmt 0 view .LVU26
+	xorl	%eax, %eax
+	.loc 1 29 6 view .LVU27
+	cmpq	%rbp, %rbx
+	je	.L8
+	.loc 1 32 3 is_stmt 1 view .LVU28
+	.loc 1 32 31 is_stmt 0 view .LVU29
+	cmpq	%rbx, %rbp
+	sbbl	%eax, %eax
+	orl	$1, %eax
+.L8:
+	.loc 1 33 1 view .LVU30
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL10:
+	.loc 1 33 1 view .LVU31
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	sv_compare, .-sv_compare
+	.p2align 4
+	.globl	sv_equals
+	.type	sv_equals, @function
+sv_equals:
+.LVL11:
+.LFB28:
+	.loc 1 38 66 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 39 3 view .LVU33
+	.loc 1 38 66 is_stmt 0 view .LVU34
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	.loc 1 39 19 view .LVU35
+	movq	%rsi, %rdi
+.LVL12:
+	.loc 1 38 66 view .LVU36
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 39 19 view .LVU37
+	call	strlen@PLT
+.LVL13:
+	.loc 1 39 19 view .LVU38
+	movq	%rax, %rdx
+.LVL14:
+	.loc 1 40 3 is_stmt 1 view .LVU39
+	.loc 1 41 12 is_stmt 0 view .LVU40
+	xorl	%eax, %eax
+.LVL15:
+	.loc 1 40 6 view .LVU41
+	cmpq	%rdx, 8(%rbp)
+	jne	.L17
+	.loc 1 43 3 is_stmt 1 view .LVU42
+	.loc 1 43 22 is_stmt 0 view .LVU43
+	movl	$1, %eax
+	testq	%rdx, %rdx
+	jne	.L23
+.L17:
+	.loc 1 44 1 view .LVU44
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL16:
+	.loc 1 44 1 view .LVU45
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL17:
+	.loc 1 44 1 view .LVU46
+	ret
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	.cfi_restore_state
+	.loc 1 43 25 discriminator 2 view .LVU47
+	movq	0(%rbp), %rdi
+	movq	%rbx, %rsi
+	call	memcmp@PLT
+.LVL19:
+	.loc 1 43 22 discriminator 2 view .LVU48
+	testl	%eax, %eax
+	sete	%al
+	.loc 1 44 1 discriminator 2 view .LVU49
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL20:
+	.loc 1 43 22 discriminator 2 view .LVU50
+	movzbl	%al, %eax
+	.loc 1 44 1 discriminator 2 view .LVU51
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL21:
+	.loc 1 44 1 discriminator 2 view .LVU52
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	sv_equals, .-sv_equals
+	.p2align 4
+	.globl	sv_hash
+	.type	sv_hash, @function
+sv_hash:
+.LVL22:
+.LFB29:
+	.loc 1 49 49 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 50 3 view .LVU54
+	.loc 1 51 3 view .LVU55
+.LBB2:
+	.loc 1 51 8 view .LVU56
+	.loc 1 51 24 view .LVU57
+	.loc 1 51 30 is_stmt 0 view .LVU58
+	movq	8(%rdi), %rsi
+.LBE2:
+	.loc 1 50 12 view .LVU59
+	movabsq	$-3750763034362895579, %rax
+.LBB3:
+	.loc 1 51 24 view .LVU60
+	testq	%rsi, %rsi
+	je	.L24
+	movq	(%rdi), %rdx
+	.loc 1 53 10 view .LVU61
+	movabsq	$1099511628211, %rdi
+.LVL23:
+	.loc 1 53 10 view .LVU62
+	addq	%rdx, %rsi
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	.loc 1 52 5 is_stmt 1 discriminator 3 view .LVU63
+	.loc 1 52 13 is_stmt 0 discriminator 3 view .LVU64
+	movzbl	(%rdx), %ecx
+	.loc 1 51 24 discriminator 3 view .LVU65
+	incq	%rdx
+.LVL25:
+	.loc 1 52 10 discriminator 3 view .LVU66
+	xorq	%rcx, %rax
+.LVL26:
+	.loc 1 53 5 is_stmt 1 discriminator 3 view .LVU67
+	.loc 1 53 10 is_stmt 0 discriminator 3 view .LVU68
+	imulq	%rdi, %rax
+.LVL27:
+	.loc 1 51 38 is_stmt 1 discriminator 3 view .LVU69
+	.loc 1 51 24 discriminator 3 view .LVU70
+	cmpq	%rdx, %rsi
+	jne	.L26
+.LVL28:
+.L24:
+	.loc 1 51 24 is_stmt 0 discriminator 3 view .LVU71
+.LBE3:
+	.loc 1 56 1 view .LVU72
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	sv_hash, .-sv_hash
+	.p2align 4
+	.globl	sv_to_string
+	.type	sv_to_string, @function
+sv_to_string:
+.LVL29:
+.LFB30:
+	.loc 1 61 51 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 63 3 view .LVU74
+	.loc 1 61 51 is_stmt 0 view .LVU75
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 63 37 view .LVU76
+	movq	8(%rdi), %rbp
+	.loc 1 63 26 view .LVU77
+	leaq	1(%rbp), %rdi
+.LVL30:
+	.loc 1 63 26 view .LVU78
+	call	malloc@PLT
+.LVL31:
+	movq	%rax, %rcx
+.LVL32:
+	.loc 1 64 3 is_stmt 1 view .LVU79
+	.loc 1 64 6 is_stmt 0 view .LVU80
+	testq	%rax, %rax
+	je	.L30
+	.loc 1 68 3 is_stmt 1 view .LVU81
+	.loc 1 68 6 is_stmt 0 view .LVU82
+	testq	%rbp, %rbp
+	jne	.L40
+.LVL33:
+.L32:
+	.loc 1 71 3 is_stmt 1 view .LVU83
+	.loc 1 71 21 is_stmt 0 view .LVU84
+	movb	$0, (%rcx,%rbp)
+	.loc 1 72 3 is_stmt 1 view .LVU85
+.L30:
+	.loc 1 73 1 is_stmt 0 view .LVU86
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL34:
+	.loc 1 73 1 view .LVU87
+	movq	%rcx, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL35:
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	.cfi_restore_state
+	.loc 1 69 5 is_stmt 1 view .LVU88
+	movq	(%rbx), %rsi
+	movq	%rbp, %rdx
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.LVL36:
+	.loc 1 69 5 is_stmt 0 view .LVU89
+	movq	%rax, %rcx
+	jmp	.L32
+	.cfi_endproc
+.LFE30:
+	.size	sv_to_string, .-sv_to_string
+	.p2align 4
+	.globl	sv_to_double
+	.type	sv_to_double, @function
+sv_to_double:
+.LVL37:
+.LFB31:
+	.loc 1 78 64 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 79 3 view .LVU91
+	.loc 1 79 14 is_stmt 0 view .LVU92
+	movq	8(%rdi), %rcx
+	.loc 1 79 24 view .LVU93
+	testq	%rcx, %rcx
+	jne	.L50
+	xorl	%eax, %eax
+	.loc 1 80 1 view .LVU94
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	.loc 1 78 64 discriminator 1 view .LVU95
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 79 27 discriminator 1 view .LVU96
+	movq	%rsi, %rdx
+	movq	(%rdi), %rdi
+.LVL38:
+	.loc 1 79 27 discriminator 1 view .LVU97
+	movq	%rcx, %rsi
+.LVL39:
+	.loc 1 79 27 discriminator 1 view .LVU98
+	call	stod@PLT
+.LVL40:
+	.loc 1 79 24 discriminator 1 view .LVU99
+	cmpq	%rax, 8(%rbx)
+	sete	%al
+	movzbl	%al, %eax
+	.loc 1 80 1 discriminator 1 view .LVU100
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL41:
+	.loc 1 80 1 discriminator 1 view .LVU101
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	sv_to_double, .-sv_to_double
+	.p2align 4
+	.globl	sv_to_int64
+	.type	sv_to_int64, @function
+sv_to_int64:
+.LVL42:
+.LFB32:
+	.loc 1 85 64 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 86 3 view .LVU103
+	.loc 1 86 14 is_stmt 0 view .LVU104
+	movq	8(%rdi), %rcx
+	.loc 1 86 24 view .LVU105
+	testq	%rcx, %rcx
+	jne	.L60
+	xorl	%eax, %eax
+	.loc 1 87 1 view .LVU106
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	.loc 1 85 64 discriminator 1 view .LVU107
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 86 27 discriminator 1 view .LVU108
+	movq	%rsi, %rdx
+	movq	(%rdi), %rdi
+.LVL43:
+	.loc 1 86 27 discriminator 1 view .LVU109
+	movq	%rcx, %rsi
+.LVL44:
+	.loc 1 86 27 discriminator 1 view .LVU110
+	call	stoi64@PLT
+.LVL45:
+	.loc 1 86 24 discriminator 1 view .LVU111
+	cmpq	%rax, 8(%rbx)
+	sete	%al
+	movzbl	%al, %eax
+	.loc 1 87 1 discriminator 1 view .LVU112
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL46:
+	.loc 1 87 1 discriminator 1 view .LVU113
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	sv_to_int64, .-sv_to_int64
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/root/repo/src/../include/strutils.h"
+	.file 7 "/usr/include/string.h"
+	.file 8 "/usr/include/stdlib.h"
+	.file 9 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x4e7
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x11
+	.long	.LASF40
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x9
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xb
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x9
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x4d
+	.uleb128 0x9
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x13
+	.byte	0x8
+	.uleb128 0x6
+	.long	0x9d
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0xb
+	.long	0x9d
+	.uleb128 0x9
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x13
+	.long	0x7e
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF15
+	.uleb128 0x6
+	.long	0xc1
+	.uleb128 0x14
+	.uleb128 0x6
+	.long	0xa4
+	.uleb128 0x9
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x15
+	.long	.LASF41
+	.byte	0x10
+	.byte	0x6
+	.byte	0xd
+	.byte	0x8
+	.long	0xf9
+	.uleb128 0xc
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0xc2
+	.byte	0
+	.uleb128 0xc
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	0xd3
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF17
+	.uleb128 0x6
+	.long	0xf9
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF18
+	.uleb128 0xa
+	.long	.LASF19
+	.byte	0x6
+	.value	0x688
+	.byte	0x8
+	.long	0x2e
+	.long	0x132
+	.uleb128 0x1
+	.long	0xc2
+	.uleb128 0x1
+	.long	0x3a
+	.uleb128 0x1
+	.long	0x132
+	.byte	0
+	.uleb128 0x6
+	.long	0xa9
+	.uleb128 0xa
+	.long	.LASF20
+	.byte	0x6
+	.value	0x63e
+	.byte	0x8
+	.long	0x2e
+	.long	0x158
+	.uleb128 0x1
+	.long	0xc2
+	.uleb128 0x1
+	.long	0x3a
+	.uleb128 0x1
+	.long	0x158
+	.byte	0
+	.uleb128 0x6
+	.long	0x10a
+	.uleb128 0xd
+	.long	.LASF21
+	.byte	0x2b
+	.byte	0xe
+	.long	0x96
+	.long	0x17c
+	.uleb128 0x1
+	.long	0x96
+	.uleb128 0x1
+	.long	0xbc
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF22
+	.byte	0x8
+	.value	0x229
+	.byte	0xe
+	.long	0x96
+	.long	0x193
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF23
+	.byte	0x40
+	.byte	0xc
+	.long	0x46
+	.long	0x1b2
+	.uleb128 0x1
+	.long	0xbc
+	.uleb128 0x1
+	.long	0xbc
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF24
+	.byte	0x7
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0x1c9
+	.uleb128 0x1
+	.long	0xc2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF27
+	.byte	0x55
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x226
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x55
+	.byte	0x2a
+	.long	0x105
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x55
+	.byte	0x39
+	.long	0x132
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x7
+	.quad	.LVL45
+	.long	0x111
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF28
+	.byte	0x4e
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x283
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x4e
+	.byte	0x2b
+	.long	0x105
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x4e
+	.byte	0x39
+	.long	0x158
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x7
+	.quad	.LVL40
+	.long	0x137
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF29
+	.byte	0x3d
+	.byte	0x7
+	.long	0x98
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2f7
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x3d
+	.byte	0x2d
+	.long	0x105
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x8
+	.long	.LASF31
+	.byte	0x3f
+	.byte	0x9
+	.long	0x98
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xe
+	.quad	.LVL31
+	.long	0x17c
+	.long	0x2e2
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 1
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL36
+	.long	0x4d8
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF30
+	.byte	0x31
+	.byte	0xa
+	.long	0xc7
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x357
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x31
+	.byte	0x2b
+	.long	0x105
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x8
+	.long	.LASF32
+	.byte	0x32
+	.byte	0xc
+	.long	0xc7
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x16
+	.long	.LLRL11
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x1
+	.byte	0x33
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF33
+	.byte	0x26
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3de
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x26
+	.byte	0x28
+	.long	0x105
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x26
+	.byte	0x3a
+	.long	0xc2
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x8
+	.long	.LASF34
+	.byte	0x27
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xe
+	.quad	.LVL13
+	.long	0x1b2
+	.long	0x3c9
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL19
+	.long	0x4e1
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF35
+	.byte	0x16
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x47c
+	.uleb128 0xf
+	.string	"a"
+	.byte	0x29
+	.long	0x105
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xf
+	.string	"b"
+	.byte	0x45
+	.long	0x105
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x8
+	.long	.LASF34
+	.byte	0x17
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x8
+	.long	.LASF36
+	.byte	0x18
+	.byte	0x7
+	.long	0x46
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x7
+	.quad	.LVL8
+	.long	0x193
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x76
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF37
+	.byte	0xb
+	.byte	0x13
+	.long	0xd3
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4d8
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0xb
+	.byte	0x2e
+	.long	0xc2
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x8
+	.long	.LASF25
+	.byte	0xc
+	.byte	0x15
+	.long	0xd3
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x7
+	.quad	.LVL1
+	.long	0x1b2
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF21
+	.long	.LASF38
+	.uleb128 0x10
+	.long	.LASF23
+	.long	.LASF39
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL40-1-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU79
+	.uleb128 .LVU83
+	.uleb128 .LVU88
+	.uleb128 .LVU89
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU55
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU71
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0xa
+	.byte	0x9e
+	.uleb128 0x8
+	.quad	0xcbf29ce484222325
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU57
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU70
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x6
+	.byte	0x20
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU39
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU48
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU18
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU31
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x25
+	.byte	0x73
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x76
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU23
+	.uleb128 .LVU25
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU2
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU10
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 0x7
+	.byte	0x55
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x7
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x6
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x51
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF14:
+	.string	"int64_t"
+.LASF10:
+	.string	"size_t"
+.LASF29:
+	.string	"sv_to_string"
+.LASF26:
+	.string	"value"
+.LASF6:
+	.string	"short unsigned int"
+.LASF7:
+	.string	"unsigned int"
+.LASF30:
+	.string	"sv_hash"
+.LASF28:
+	.string	"sv_to_double"
+.LASF31:
+	.string	"string"
+.LASF33:
+	.string	"sv_equals"
+.LASF27:
+	.string	"sv_to_int64"
+.LASF41:
+	.string	"StringView"
+.LASF20:
+	.string	"stod"
+.LASF2:
+	.string	"long unsigned int"
+.LASF37:
+	.string	"sv_from_string"
+.LASF5:
+	.string	"unsigned char"
+.LASF11:
+	.string	"__int64_t"
+.LASF23:
+	.string	"memcmp"
+.LASF18:
+	.string	"double"
+.LASF24:
+	.string	"strlen"
+.LASF15:
+	.string	"long long unsigned int"
+.LASF36:
+	.string	"result"
+.LASF19:
+	.string	"stoi64"
+.LASF38:
+	.string	"__builtin_memcpy"
+.LASF32:
+	.string	"hash"
+.LASF4:
+	.string	"long long int"
+.LASF40:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF13:
+	.string	"char"
+.LASF21:
+	.string	"memcpy"
+.LASF9:
+	.string	"short int"
+.LASF12:
+	.string	"__uint64_t"
+.LASF25:
+	.string	"view"
+.LASF16:
+	.string	"uint64_t"
+.LASF3:
+	.string	"long int"
+.LASF17:
+	.string	"long double"
+.LASF8:
+	.string	"signed char"
+.LASF35:
+	.string	"sv_compare"
+.LASF34:
+	.string	"length"
+.LASF22:
+	.string	"malloc"
+.LASF39:
+	.string	"__builtin_memcmp"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/library"
+.LASF0:
+	.string	"/root/repo/src/string_view.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1 @@
+	.file	"strutils.h"
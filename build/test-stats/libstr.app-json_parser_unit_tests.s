@@ -0,0 +1,10155 @@
+	.file	"json_parser_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/tests/json_parser_unit_tests.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"true"
+.LC1:
+	.string	"false"
+.LC2:
+	.string	"%s "
+	.text
+	.p2align 4
+	.type	json_test_boolean, @function
+json_test_boolean:
+.LVL0:
+.LFB34:
+	.file 1 "/root/repo/tests/json_parser_unit_tests.c"
+	.loc 1 55 56 view -0
+	.cfi_startproc
+	.loc 1 56 3 view .LVU1
+	.loc 1 55 56 is_stmt 0 view .LVU2
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 56 10 view .LVU3
+	testl	%esi, %esi
+	leaq	.LC0(%rip), %rax
+	.loc 1 55 56 view .LVU4
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	.loc 1 56 10 view .LVU5
+	leaq	.LC1(%rip), %rcx
+.LBB4:
+.LBB5:
+	.loc 1 19 10 view .LVU6
+	movl	$256, %ebp
+.LBE5:
+.LBE4:
+	.loc 1 55 56 view .LVU7
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 56 10 view .LVU8
+	cmovne	%rax, %rcx
+.LVL1:
+.LBB8:
+.LBI4:
+	.loc 1 17 12 is_stmt 1 view .LVU9
+.LBB6:
+	.loc 1 18 3 view .LVU10
+	.loc 1 19 3 view .LVU11
+.LBE6:
+.LBE8:
+	.loc 1 55 56 is_stmt 0 view .LVU12
+	movq	%rdi, %rbx
+.LBB9:
+.LBB7:
+	.loc 1 19 48 view .LVU13
+	movq	256(%rdi), %r12
+	.loc 1 20 127 view .LVU14
+	leaq	.LC2(%rip), %rdx
+	.loc 1 19 10 view .LVU15
+	subq	%r12, %rbp
+.LVL2:
+	.loc 1 20 3 is_stmt 1 view .LVU16
+	.loc 1 20 127 is_stmt 0 view .LVU17
+	leaq	(%rdi,%r12), %rdi
+.LVL3:
+	.loc 1 20 127 view .LVU18
+	movq	%rbp, %rsi
+.LVL4:
+	.loc 1 20 127 view .LVU19
+	xorl	%eax, %eax
+	call	snprintf@PLT
+.LVL5:
+	.loc 1 21 3 is_stmt 1 view .LVU20
+	.loc 1 21 21 is_stmt 0 view .LVU21
+	cltq
+	.loc 1 21 62 view .LVU22
+	movl	$255, %edx
+	subq	%r12, %rdx
+	cmpq	%rbp, %rax
+	cmovnb	%rdx, %rax
+.LVL6:
+	.loc 1 21 18 view .LVU23
+	addq	%rax, 256(%rbx)
+	.loc 1 22 3 is_stmt 1 view .LVU24
+.LVL7:
+	.loc 1 22 3 is_stmt 0 view .LVU25
+.LBE7:
+.LBE9:
+	.loc 1 57 1 view .LVU26
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL8:
+	.loc 1 57 1 view .LVU27
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	json_test_boolean, .-json_test_boolean
+	.section	.rodata.str1.1
+.LC3:
+	.string	"n"
+.LC4:
+	.string	"%s:%.*s "
+	.text
+	.p2align 4
+	.type	json_test_number, @function
+json_test_number:
+.LVL9:
+.LFB33:
+	.loc 1 49 88 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 50 3 view .LVU29
+	.loc 1 51 3 view .LVU30
+	.loc 1 49 88 is_stmt 0 view .LVU31
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+.LBB12:
+.LBB13:
+	.loc 1 19 10 view .LVU32
+	movl	$256, %ebp
+.LBE13:
+.LBE12:
+	.loc 1 49 88 view .LVU33
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 51 37 view .LVU34
+	movq	%rsp, %r13
+	movq	%r13, %rdi
+.LVL10:
+	.loc 1 51 37 view .LVU35
+	call	dtos_to@PLT
+.LVL11:
+	.loc 1 52 3 is_stmt 1 view .LVU36
+.LBB15:
+.LBI12:
+	.loc 1 17 12 view .LVU37
+.LBB14:
+	.loc 1 18 3 view .LVU38
+	.loc 1 19 3 view .LVU39
+	.loc 1 19 48 is_stmt 0 view .LVU40
+	movq	256(%rbx), %r12
+	.loc 1 20 31 view .LVU41
+	movq	%r13, %r9
+	.loc 1 19 10 view .LVU42
+	subq	%r12, %rbp
+.LVL12:
+	.loc 1 20 3 is_stmt 1 view .LVU43
+	.loc 1 20 31 is_stmt 0 view .LVU44
+	leaq	(%rbx,%r12), %rdi
+	movl	%eax, %r8d
+	leaq	.LC4(%rip), %rdx
+	movq	%rbp, %rsi
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rcx
+	call	snprintf@PLT
+.LVL13:
+	.loc 1 21 3 is_stmt 1 view .LVU45
+	.loc 1 21 21 is_stmt 0 view .LVU46
+	cltq
+	.loc 1 21 62 view .LVU47
+	movl	$255, %edx
+	subq	%r12, %rdx
+	cmpq	%rbp, %rax
+	cmovnb	%rdx, %rax
+.LVL14:
+	.loc 1 21 18 view .LVU48
+	addq	%rax, 256(%rbx)
+	.loc 1 22 3 is_stmt 1 view .LVU49
+.LVL15:
+	.loc 1 22 3 is_stmt 0 view .LVU50
+.LBE14:
+.LBE15:
+	.loc 1 53 1 view .LVU51
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 40
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL16:
+	.loc 1 53 1 view .LVU52
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	json_test_number, .-json_test_number
+	.section	.rodata.str1.1
+.LC5:
+	.string	"null"
+	.text
+	.p2align 4
+	.type	json_test_null, @function
+json_test_null:
+.LVL17:
+.LFB35:
+	.loc 1 59 42 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 60 3 view .LVU54
+.LBB18:
+.LBI18:
+	.loc 1 17 12 view .LVU55
+.LBB19:
+	.loc 1 18 3 view .LVU56
+	.loc 1 19 3 view .LVU57
+.LBE19:
+.LBE18:
+	.loc 1 59 42 is_stmt 0 view .LVU58
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB23:
+.LBB20:
+	.loc 1 20 127 view .LVU59
+	leaq	.LC2(%rip), %rdx
+	xorl	%eax, %eax
+.LBE20:
+.LBE23:
+	.loc 1 59 42 view .LVU60
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB24:
+.LBB21:
+	.loc 1 19 10 view .LVU61
+	movl	$256, %ebp
+	.loc 1 20 127 view .LVU62
+	leaq	.LC5(%rip), %rcx
+.LBE21:
+.LBE24:
+	.loc 1 59 42 view .LVU63
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 59 42 view .LVU64
+	movq	%rdi, %rbx
+.LBB25:
+.LBB22:
+	.loc 1 19 48 view .LVU65
+	movq	256(%rdi), %r12
+	.loc 1 19 10 view .LVU66
+	subq	%r12, %rbp
+.LVL18:
+	.loc 1 20 3 is_stmt 1 view .LVU67
+	.loc 1 20 127 is_stmt 0 view .LVU68
+	leaq	(%rdi,%r12), %rdi
+.LVL19:
+	.loc 1 20 127 view .LVU69
+	movq	%rbp, %rsi
+	call	snprintf@PLT
+.LVL20:
+	.loc 1 21 3 is_stmt 1 view .LVU70
+	.loc 1 21 21 is_stmt 0 view .LVU71
+	cltq
+	.loc 1 21 62 view .LVU72
+	movl	$255, %edx
+	subq	%r12, %rdx
+	cmpq	%rbp, %rax
+	cmovnb	%rdx, %rax
+.LVL21:
+	.loc 1 21 18 view .LVU73
+	addq	%rax, 256(%rbx)
+	.loc 1 22 3 is_stmt 1 view .LVU74
+.LVL22:
+	.loc 1 22 3 is_stmt 0 view .LVU75
+.LBE22:
+.LBE25:
+	.loc 1 61 1 view .LVU76
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL23:
+	.loc 1 61 1 view .LVU77
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	json_test_null, .-json_test_null
+	.section	.rodata.str1.1
+.LC6:
+	.string	"{"
+	.text
+	.p2align 4
+	.type	json_test_start_object, @function
+json_test_start_object:
+.LVL24:
+.LFB27:
+	.loc 1 25 50 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 26 3 view .LVU79
+.LBB28:
+.LBI28:
+	.loc 1 17 12 view .LVU80
+.LBB29:
+	.loc 1 18 3 view .LVU81
+	.loc 1 19 3 view .LVU82
+.LBE29:
+.LBE28:
+	.loc 1 25 50 is_stmt 0 view .LVU83
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB33:
+.LBB30:
+	.loc 1 20 127 view .LVU84
+	leaq	.LC2(%rip), %rdx
+	xorl	%eax, %eax
+.LBE30:
+.LBE33:
+	.loc 1 25 50 view .LVU85
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB34:
+.LBB31:
+	.loc 1 19 10 view .LVU86
+	movl	$256, %ebp
+	.loc 1 20 127 view .LVU87
+	leaq	.LC6(%rip), %rcx
+.LBE31:
+.LBE34:
+	.loc 1 25 50 view .LVU88
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 25 50 view .LVU89
+	movq	%rdi, %rbx
+.LBB35:
+.LBB32:
+	.loc 1 19 48 view .LVU90
+	movq	256(%rdi), %r12
+	.loc 1 19 10 view .LVU91
+	subq	%r12, %rbp
+.LVL25:
+	.loc 1 20 3 is_stmt 1 view .LVU92
+	.loc 1 20 127 is_stmt 0 view .LVU93
+	leaq	(%rdi,%r12), %rdi
+.LVL26:
+	.loc 1 20 127 view .LVU94
+	movq	%rbp, %rsi
+	call	snprintf@PLT
+.LVL27:
+	.loc 1 21 3 is_stmt 1 view .LVU95
+	.loc 1 21 21 is_stmt 0 view .LVU96
+	cltq
+	.loc 1 21 62 view .LVU97
+	movl	$255, %edx
+	subq	%r12, %rdx
+	cmpq	%rbp, %rax
+	cmovnb	%rdx, %rax
+.LVL28:
+	.loc 1 21 18 view .LVU98
+	addq	%rax, 256(%rbx)
+	.loc 1 22 3 is_stmt 1 view .LVU99
+.LVL29:
+	.loc 1 22 3 is_stmt 0 view .LVU100
+.LBE32:
+.LBE35:
+	.loc 1 27 1 view .LVU101
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL30:
+	.loc 1 27 1 view .LVU102
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	json_test_start_object, .-json_test_start_object
+	.section	.rodata.str1.1
+.LC7:
+	.string	"}"
+	.text
+	.p2align 4
+	.type	json_test_end_object, @function
+json_test_end_object:
+.LVL31:
+.LFB28:
+	.loc 1 29 48 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 30 3 view .LVU104
+.LBB38:
+.LBI38:
+	.loc 1 17 12 view .LVU105
+.LBB39:
+	.loc 1 18 3 view .LVU106
+	.loc 1 19 3 view .LVU107
+.LBE39:
+.LBE38:
+	.loc 1 29 48 is_stmt 0 view .LVU108
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB43:
+.LBB40:
+	.loc 1 20 127 view .LVU109
+	leaq	.LC2(%rip), %rdx
+	xorl	%eax, %eax
+.LBE40:
+.LBE43:
+	.loc 1 29 48 view .LVU110
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB44:
+.LBB41:
+	.loc 1 19 10 view .LVU111
+	movl	$256, %ebp
+	.loc 1 20 127 view .LVU112
+	leaq	.LC7(%rip), %rcx
+.LBE41:
+.LBE44:
+	.loc 1 29 48 view .LVU113
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 29 48 view .LVU114
+	movq	%rdi, %rbx
+.LBB45:
+.LBB42:
+	.loc 1 19 48 view .LVU115
+	movq	256(%rdi), %r12
+	.loc 1 19 10 view .LVU116
+	subq	%r12, %rbp
+.LVL32:
+	.loc 1 20 3 is_stmt 1 view .LVU117
+	.loc 1 20 127 is_stmt 0 view .LVU118
+	leaq	(%rdi,%r12), %rdi
+.LVL33:
+	.loc 1 20 127 view .LVU119
+	movq	%rbp, %rsi
+	call	snprintf@PLT
+.LVL34:
+	.loc 1 21 3 is_stmt 1 view .LVU120
+	.loc 1 21 21 is_stmt 0 view .LVU121
+	cltq
+	.loc 1 21 62 view .LVU122
+	movl	$255, %edx
+	subq	%r12, %rdx
+	cmpq	%rbp, %rax
+	cmovnb	%rdx, %rax
+.LVL35:
+	.loc 1 21 18 view .LVU123
+	addq	%rax, 256(%rbx)
+	.loc 1 22 3 is_stmt 1 view .LVU124
+.LVL36:
+	.loc 1 22 3 is_stmt 0 view .LVU125
+.LBE42:
+.LBE45:
+	.loc 1 31 1 view .LVU126
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL37:
+	.loc 1 31 1 view .LVU127
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	json_test_end_object, .-json_test_end_object
+	.section	.rodata.str1.1
+.LC8:
+	.string	"["
+	.text
+	.p2align 4
+	.type	json_test_start_array, @function
+json_test_start_array:
+.LVL38:
+.LFB29:
+	.loc 1 33 49 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 34 3 view .LVU129
+.LBB48:
+.LBI48:
+	.loc 1 17 12 view .LVU130
+.LBB49:
+	.loc 1 18 3 view .LVU131
+	.loc 1 19 3 view .LVU132
+.LBE49:
+.LBE48:
+	.loc 1 33 49 is_stmt 0 view .LVU133
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB53:
+.LBB50:
+	.loc 1 20 127 view .LVU134
+	leaq	.LC2(%rip), %rdx
+	xorl	%eax, %eax
+.LBE50:
+.LBE53:
+	.loc 1 33 49 view .LVU135
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB54:
+.LBB51:
+	.loc 1 19 10 view .LVU136
+	movl	$256, %ebp
+	.loc 1 20 127 view .LVU137
+	leaq	.LC8(%rip), %rcx
+.LBE51:
+.LBE54:
+	.loc 1 33 49 view .LVU138
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 33 49 view .LVU139
+	movq	%rdi, %rbx
+.LBB55:
+.LBB52:
+	.loc 1 19 48 view .LVU140
+	movq	256(%rdi), %r12
+	.loc 1 19 10 view .LVU141
+	subq	%r12, %rbp
+.LVL39:
+	.loc 1 20 3 is_stmt 1 view .LVU142
+	.loc 1 20 127 is_stmt 0 view .LVU143
+	leaq	(%rdi,%r12), %rdi
+.LVL40:
+	.loc 1 20 127 view .LVU144
+	movq	%rbp, %rsi
+	call	snprintf@PLT
+.LVL41:
+	.loc 1 21 3 is_stmt 1 view .LVU145
+	.loc 1 21 21 is_stmt 0 view .LVU146
+	cltq
+	.loc 1 21 62 view .LVU147
+	movl	$255, %edx
+	subq	%r12, %rdx
+	cmpq	%rbp, %rax
+	cmovnb	%rdx, %rax
+.LVL42:
+	.loc 1 21 18 view .LVU148
+	addq	%rax, 256(%rbx)
+	.loc 1 22 3 is_stmt 1 view .LVU149
+.LVL43:
+	.loc 1 22 3 is_stmt 0 view .LVU150
+.LBE52:
+.LBE55:
+	.loc 1 35 1 view .LVU151
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL44:
+	.loc 1 35 1 view .LVU152
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	json_test_start_array, .-json_test_start_array
+	.section	.rodata.str1.1
+.LC9:
+	.string	"]"
+	.text
+	.p2align 4
+	.type	json_test_end_array, @function
+json_test_end_array:
+.LVL45:
+.LFB30:
+	.loc 1 37 47 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 38 3 view .LVU154
+.LBB58:
+.LBI58:
+	.loc 1 17 12 view .LVU155
+.LBB59:
+	.loc 1 18 3 view .LVU156
+	.loc 1 19 3 view .LVU157
+.LBE59:
+.LBE58:
+	.loc 1 37 47 is_stmt 0 view .LVU158
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB63:
+.LBB60:
+	.loc 1 20 127 view .LVU159
+	leaq	.LC2(%rip), %rdx
+	xorl	%eax, %eax
+.LBE60:
+.LBE63:
+	.loc 1 37 47 view .LVU160
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB64:
+.LBB61:
+	.loc 1 19 10 view .LVU161
+	movl	$256, %ebp
+	.loc 1 20 127 view .LVU162
+	leaq	.LC9(%rip), %rcx
+.LBE61:
+.LBE64:
+	.loc 1 37 47 view .LVU163
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 37 47 view .LVU164
+	movq	%rdi, %rbx
+.LBB65:
+.LBB62:
+	.loc 1 19 48 view .LVU165
+	movq	256(%rdi), %r12
+	.loc 1 19 10 view .LVU166
+	subq	%r12, %rbp
+.LVL46:
+	.loc 1 20 3 is_stmt 1 view .LVU167
+	.loc 1 20 127 is_stmt 0 view .LVU168
+	leaq	(%rdi,%r12), %rdi
+.LVL47:
+	.loc 1 20 127 view .LVU169
+	movq	%rbp, %rsi
+	call	snprintf@PLT
+.LVL48:
+	.loc 1 21 3 is_stmt 1 view .LVU170
+	.loc 1 21 21 is_stmt 0 view .LVU171
+	cltq
+	.loc 1 21 62 view .LVU172
+	movl	$255, %edx
+	subq	%r12, %rdx
+	cmpq	%rbp, %rax
+	cmovnb	%rdx, %rax
+.LVL49:
+	.loc 1 21 18 view .LVU173
+	addq	%rax, 256(%rbx)
+	.loc 1 22 3 is_stmt 1 view .LVU174
+.LVL50:
+	.loc 1 22 3 is_stmt 0 view .LVU175
+.LBE62:
+.LBE65:
+	.loc 1 39 1 view .LVU176
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL51:
+	.loc 1 39 1 view .LVU177
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	json_test_end_array, .-json_test_end_array
+	.section	.rodata.str1.1
+.LC10:
+	.string	"k"
+	.text
+	.p2align 4
+	.type	json_test_key, @function
+json_test_key:
+.LVL52:
+.LFB31:
+	.loc 1 41 71 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 42 3 view .LVU179
+.LBB68:
+.LBI68:
+	.loc 1 17 12 view .LVU180
+.LBB69:
+	.loc 1 18 3 view .LVU181
+	.loc 1 19 3 view .LVU182
+.LBE69:
+.LBE68:
+	.loc 1 41 71 is_stmt 0 view .LVU183
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB74:
+.LBB70:
+	.loc 1 19 48 view .LVU184
+	movq	256(%rdi), %r12
+.LBE70:
+.LBE74:
+	.loc 1 41 71 view .LVU185
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB75:
+.LBB71:
+	.loc 1 19 10 view .LVU186
+	movl	$256, %ebp
+	subq	%r12, %rbp
+.LVL53:
+	.loc 1 20 3 is_stmt 1 view .LVU187
+.LBE71:
+.LBE75:
+	.loc 1 41 71 is_stmt 0 view .LVU188
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 41 71 view .LVU189
+	movq	%rdi, %rbx
+.LBB76:
+.LBB72:
+	.loc 1 20 31 view .LVU190
+	addq	%r12, %rdi
+.LVL54:
+	.loc 1 20 125 view .LVU191
+	testq	%rsi, %rsi
+	je	.L26
+	.loc 1 20 31 view .LVU192
+	movq	(%rsi), %r9
+	movl	8(%rsi), %r8d
+	leaq	.LC10(%rip), %rcx
+	leaq	.LC4(%rip), %rdx
+	movq	%rbp, %rsi
+.LVL55:
+	.loc 1 20 31 view .LVU193
+	xorl	%eax, %eax
+	call	snprintf@PLT
+.LVL56:
+.L27:
+	.loc 1 21 3 is_stmt 1 view .LVU194
+	.loc 1 21 21 is_stmt 0 view .LVU195
+	cltq
+	.loc 1 21 62 view .LVU196
+	movl	$255, %edx
+	subq	%r12, %rdx
+	cmpq	%rbp, %rax
+	cmovnb	%rdx, %rax
+.LVL57:
+	.loc 1 21 18 view .LVU197
+	addq	%rax, 256(%rbx)
+	.loc 1 22 3 is_stmt 1 view .LVU198
+.LVL58:
+	.loc 1 22 3 is_stmt 0 view .LVU199
+.LBE72:
+.LBE76:
+	.loc 1 43 1 view .LVU200
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL59:
+	.loc 1 43 1 view .LVU201
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL60:
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	.cfi_restore_state
+.LBB77:
+.LBB73:
+	.loc 1 20 127 view .LVU202
+	leaq	.LC10(%rip), %rcx
+	leaq	.LC2(%rip), %rdx
+	movq	%rbp, %rsi
+.LVL61:
+	.loc 1 20 127 view .LVU203
+	xorl	%eax, %eax
+	call	snprintf@PLT
+.LVL62:
+	jmp	.L27
+.LBE73:
+.LBE77:
+	.cfi_endproc
+.LFE31:
+	.size	json_test_key, .-json_test_key
+	.section	.rodata.str1.1
+.LC11:
+	.string	"s"
+	.text
+	.p2align 4
+	.type	json_test_string, @function
+json_test_string:
+.LVL63:
+.LFB32:
+	.loc 1 45 76 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 46 3 view .LVU205
+.LBB80:
+.LBI80:
+	.loc 1 17 12 view .LVU206
+.LBB81:
+	.loc 1 18 3 view .LVU207
+	.loc 1 19 3 view .LVU208
+.LBE81:
+.LBE80:
+	.loc 1 45 76 is_stmt 0 view .LVU209
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB86:
+.LBB82:
+	.loc 1 19 48 view .LVU210
+	movq	256(%rdi), %r12
+.LBE82:
+.LBE86:
+	.loc 1 45 76 view .LVU211
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB87:
+.LBB83:
+	.loc 1 19 10 view .LVU212
+	movl	$256, %ebp
+	subq	%r12, %rbp
+.LVL64:
+	.loc 1 20 3 is_stmt 1 view .LVU213
+.LBE83:
+.LBE87:
+	.loc 1 45 76 is_stmt 0 view .LVU214
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 45 76 view .LVU215
+	movq	%rdi, %rbx
+.LBB88:
+.LBB84:
+	.loc 1 20 31 view .LVU216
+	addq	%r12, %rdi
+.LVL65:
+	.loc 1 20 125 view .LVU217
+	testq	%rsi, %rsi
+	je	.L31
+	.loc 1 20 31 view .LVU218
+	movq	(%rsi), %r9
+	movl	8(%rsi), %r8d
+	leaq	.LC11(%rip), %rcx
+	leaq	.LC4(%rip), %rdx
+	movq	%rbp, %rsi
+.LVL66:
+	.loc 1 20 31 view .LVU219
+	xorl	%eax, %eax
+	call	snprintf@PLT
+.LVL67:
+.L32:
+	.loc 1 21 3 is_stmt 1 view .LVU220
+	.loc 1 21 21 is_stmt 0 view .LVU221
+	cltq
+	.loc 1 21 62 view .LVU222
+	movl	$255, %edx
+	subq	%r12, %rdx
+	cmpq	%rbp, %rax
+	cmovnb	%rdx, %rax
+.LVL68:
+	.loc 1 21 18 view .LVU223
+	addq	%rax, 256(%rbx)
+	.loc 1 22 3 is_stmt 1 view .LVU224
+.LVL69:
+	.loc 1 22 3 is_stmt 0 view .LVU225
+.LBE84:
+.LBE88:
+	.loc 1 47 1 view .LVU226
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL70:
+	.loc 1 47 1 view .LVU227
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.cfi_restore_state
+.LBB89:
+.LBB85:
+	.loc 1 20 127 view .LVU228
+	leaq	.LC11(%rip), %rcx
+	leaq	.LC2(%rip), %rdx
+	movq	%rbp, %rsi
+.LVL72:
+	.loc 1 20 127 view .LVU229
+	xorl	%eax, %eax
+	call	snprintf@PLT
+.LVL73:
+	jmp	.L32
+.LBE85:
+.LBE89:
+	.cfi_endproc
+.LFE32:
+	.size	json_test_string, .-json_test_string
+	.section	.rodata.str1.1
+.LC12:
+	.string	"valid"
+.LC13:
+	.string	"invalid"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC14:
+	.string	" {\"a\": [1, -2.5e1, true], \"b\" : {\"c\": null, \"d\": \"x\\\"y\"}, \"e\": []} "
+	.section	.rodata.str1.1
+.LC15:
+	.string	"[]"
+.LC16:
+	.string	"  42"
+.LC17:
+	.string	"\"\\u00e9\""
+.LC18:
+	.string	"[0, -0.5, 1E+2, 2e-1]"
+.LC19:
+	.string	"[1, 2,]"
+.LC20:
+	.string	"{\"a\" 1}"
+.LC21:
+	.string	"{\"a\": 1,}"
+.LC22:
+	.string	"[1 2]"
+.LC23:
+	.string	"[\"open"
+.LC24:
+	.string	"{\"a\": tru}"
+.LC25:
+	.string	"[01]"
+.LC26:
+	.string	"[+1]"
+.LC27:
+	.string	"[.5]"
+.LC28:
+	.string	"[1.]"
+.LC29:
+	.string	"[1e]"
+.LC30:
+	.string	""
+	.section	.rodata.str1.8
+	.align 8
+.LC31:
+	.string	"{ k:a [ n:1 n:-25 true ] k:b { k:c null k:d s:x\\\"y } k:e [ ] } "
+	.section	.rodata.str1.1
+.LC32:
+	.string	"[ ] "
+.LC33:
+	.string	"n:42 "
+.LC34:
+	.string	"s:\\u00e9 "
+.LC35:
+	.string	"[ n:0 n:-0.5 n:100 n:0.2 ] "
+	.section	.rodata.str1.8
+	.align 8
+.LC36:
+	.string	"------------------- st_json_parse(x) -------------------"
+	.align 8
+.LC37:
+	.string	"[Failed] st_json_parse('%s') failed: got '%s'.\n"
+	.align 8
+.LC38:
+	.string	"[Passed] st_json_parse('%s') is %s.\n"
+	.text
+	.p2align 4
+	.globl	run_st_json_parse_unit_tests
+	.type	run_st_json_parse_unit_tests, @function
+run_st_json_parse_unit_tests:
+.LFB36:
+	.loc 1 81 36 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 83 3 view .LVU231
+	.loc 1 81 36 is_stmt 0 view .LVU232
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 83 15 view .LVU233
+	leaq	.LC15(%rip), %rax
+	leaq	.LC16(%rip), %rcx
+	.loc 1 81 36 view .LVU234
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 83 15 view .LVU235
+	vmovq	%rcx, %xmm1
+	leaq	.LC20(%rip), %rcx
+	.loc 1 81 36 view .LVU236
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.loc 1 83 15 view .LVU237
+	leaq	.LC14(%rip), %r14
+	vmovq	%r14, %xmm2
+	.loc 1 81 36 view .LVU238
+	pushq	%r13
+	.loc 1 83 15 view .LVU239
+	vpinsrq	$1, %rax, %xmm2, %xmm0
+	leaq	.LC17(%rip), %rax
+	.loc 1 81 36 view .LVU240
+	pushq	%r12
+	.loc 1 83 15 view .LVU241
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	.loc 1 81 36 view .LVU242
+	pushq	%rbx
+	.loc 1 83 15 view .LVU243
+	leaq	.LC21(%rip), %rax
+	vmovq	%rcx, %xmm1
+	.loc 1 81 36 view .LVU244
+	andq	$-32, %rsp
+	subq	$768, %rsp
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 83 15 view .LVU245
+	leaq	.LC18(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovdqa	%ymm0, 192(%rsp)
+	leaq	.LC19(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC24(%rip), %rcx
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC25(%rip), %rax
+	vmovq	%rcx, %xmm1
+	leaq	.LC22(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovdqa	%ymm0, 224(%rsp)
+	leaq	.LC23(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC28(%rip), %rcx
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC29(%rip), %rax
+	vmovq	%rcx, %xmm1
+	leaq	.LC26(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovdqa	%ymm0, 256(%rsp)
+	leaq	.LC27(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 102 15 view .LVU246
+	leaq	.LC33(%rip), %rcx
+	.loc 1 83 15 view .LVU247
+	leaq	.LC30(%rip), %rax
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	movq	%rax, 320(%rsp)
+	.loc 1 102 3 is_stmt 1 view .LVU248
+	.loc 1 102 15 is_stmt 0 view .LVU249
+	vmovq	%rcx, %xmm1
+	leaq	.LC34(%rip), %rax
+	leaq	.LC31(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	.loc 1 83 15 view .LVU250
+	vmovdqa	%ymm0, 288(%rsp)
+	.loc 1 102 15 view .LVU251
+	leaq	.LC32(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC35(%rip), %rax
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	movq	%rax, 384(%rsp)
+	vmovdqa	%ymm0, 352(%rsp)
+	vpxor	%xmm0, %xmm0, %xmm0
+	vmovdqu	%ymm0, 392(%rsp)
+	vmovdqu	%ymm0, 424(%rsp)
+	vmovdqu	%ymm0, 456(%rsp)
+	.loc 1 111 3 is_stmt 1 view .LVU252
+.LVL74:
+	.loc 1 113 3 view .LVU253
+	leaq	.LC36(%rip), %rdi
+	leaq	488(%rsp), %r12
+	vzeroupper
+.LVL75:
+	call	puts@PLT
+.LVL76:
+	.loc 1 115 3 view .LVU254
+	.loc 1 116 3 view .LVU255
+.LBB90:
+	.loc 1 116 8 view .LVU256
+	.loc 1 116 21 view .LVU257
+.LBE90:
+	.loc 1 115 7 is_stmt 0 view .LVU258
+	movl	$0, 36(%rsp)
+	movq	%r12, 24(%rsp)
+	leaq	64(%rsp), %r15
+	leaq	352(%rsp), %rdx
+	movq	%r15, 56(%rsp)
+	leaq	192(%rsp), %rcx
+	movq	%r14, %r15
+	movq	%rdx, %r14
+.LVL77:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+.LBB98:
+.LBB91:
+	.loc 1 117 39 is_stmt 1 view .LVU259
+	movq	%rcx, 48(%rsp)
+	.loc 1 117 14 is_stmt 0 view .LVU260
+	xorl	%r13d, %r13d
+.LVL78:
+.L54:
+.LBB92:
+	.loc 1 118 7 is_stmt 1 view .LVU261
+	.loc 1 120 7 is_stmt 0 view .LVU262
+	movq	56(%rsp), %rbx
+	.loc 1 118 29 view .LVU263
+	movq	$0, 752(%rsp)
+	.loc 1 119 7 is_stmt 1 view .LVU264
+	.loc 1 120 7 view .LVU265
+	.loc 1 118 29 is_stmt 0 view .LVU266
+	vpxor	%xmm3, %xmm3, %xmm3
+	vpxor	%xmm4, %xmm4, %xmm4
+	vpxor	%xmm5, %xmm5, %xmm5
+	vpxor	%xmm6, %xmm6, %xmm6
+	vmovdqu64	%zmm3, 496(%rsp)
+	vmovdqu64	%zmm4, 560(%rsp)
+	vmovdqu64	%zmm5, 624(%rsp)
+	vmovdqu64	%zmm6, 688(%rsp)
+	.loc 1 120 7 view .LVU267
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	vzeroupper
+.LVL79:
+	call	stpcpy@PLT
+.LVL80:
+	.loc 1 121 7 is_stmt 1 view .LVU268
+	.loc 1 122 7 view .LVU269
+	.loc 1 123 7 view .LVU270
+	.loc 1 123 10 is_stmt 0 view .LVU271
+	testl	%r13d, %r13d
+	jne	.L37
+.LVL81:
+	.loc 1 124 9 is_stmt 1 view .LVU272
+	.loc 1 124 21 is_stmt 0 view .LVU273
+	cmpb	$0, 64(%rsp)
+	movl	$1, %esi
+	je	.L38
+	.loc 1 124 62 discriminator 1 view .LVU274
+	subq	%rbx, %rax
+	movq	%rax, %rsi
+.L38:
+	.loc 1 124 21 discriminator 4 view .LVU275
+	movq	56(%rsp), %rdi
+	.loc 1 121 13 discriminator 4 view .LVU276
+	xorl	%r12d, %r12d
+	.loc 1 124 21 discriminator 4 view .LVU277
+	call	st_create_n@PLT
+.LVL82:
+	movq	%rax, %rbx
+.LVL83:
+	.loc 1 131 7 is_stmt 1 discriminator 4 view .LVU278
+	.loc 1 131 37 is_stmt 0 discriminator 4 view .LVU279
+	testq	%rbx, %rbx
+	je	.L68
+.LVL84:
+.L43:
+	.loc 1 131 40 discriminator 1 view .LVU280
+	leaq	496(%rsp), %rdx
+	leaq	json_test_handler(%rip), %rsi
+	movq	%rbx, %rdi
+	movq	%rdx, 40(%rsp)
+	call	st_json_parse@PLT
+.LVL85:
+	.loc 1 131 37 discriminator 1 view .LVU281
+	testl	%eax, %eax
+	movq	40(%rsp), %rdx
+	je	.L45
+.LVL86:
+	.loc 1 132 7 is_stmt 1 view .LVU282
+	.loc 1 132 37 is_stmt 0 view .LVU283
+	movq	(%r14), %rsi
+	.loc 1 132 10 view .LVU284
+	testq	%rsi, %rsi
+	je	.L41
+	.loc 1 132 68 discriminator 2 view .LVU285
+	movq	%rdx, %rdi
+	movq	%rdx, 40(%rsp)
+	call	strcmp@PLT
+.LVL87:
+	.loc 1 132 65 discriminator 2 view .LVU286
+	testl	%eax, %eax
+	je	.L47
+	movq	40(%rsp), %rdx
+.LVL88:
+	.p2align 4,,10
+	.p2align 3
+.L41:
+	.loc 1 133 9 is_stmt 1 view .LVU287
+	movq	%r15, %rsi
+	leaq	.LC37(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL89:
+	.loc 1 134 9 view .LVU288
+	.loc 1 134 21 is_stmt 0 view .LVU289
+	movl	$1, 36(%rsp)
+.LVL90:
+.L48:
+	.loc 1 140 7 is_stmt 1 view .LVU290
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL91:
+	.loc 1 141 7 view .LVU291
+	.loc 1 141 10 is_stmt 0 view .LVU292
+	testq	%r12, %r12
+	je	.L52
+	.loc 1 142 9 is_stmt 1 view .LVU293
+	movq	%r12, %rdi
+	call	fclose@PLT
+.LVL92:
+.L52:
+.LBE92:
+	.loc 1 117 53 view .LVU294
+	.loc 1 117 39 view .LVU295
+	cmpl	$1, %r13d
+	je	.L69
+.LBB93:
+	.loc 1 120 7 is_stmt 0 view .LVU296
+	movq	48(%rsp), %rax
+	movl	$1, %r13d
+.LVL93:
+	.loc 1 120 7 view .LVU297
+	movq	(%rax), %r15
+	jmp	.L54
+.LVL94:
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	.loc 1 126 12 is_stmt 1 view .LVU298
+	.loc 1 126 24 is_stmt 0 view .LVU299
+	call	tmpfile@PLT
+.LVL95:
+	movq	%rax, %r12
+.LVL96:
+	.loc 1 126 15 view .LVU300
+	testq	%rax, %rax
+	je	.L70
+	.loc 1 127 9 is_stmt 1 view .LVU301
+	movq	56(%rsp), %rdi
+	movq	%rax, %rsi
+	call	fputs@PLT
+.LVL97:
+	.loc 1 128 9 view .LVU302
+	movq	%r12, %rdi
+	call	rewind@PLT
+.LVL98:
+	.loc 1 129 9 view .LVU303
+	.loc 1 129 21 is_stmt 0 view .LVU304
+	movl	$2, %esi
+	movq	%r12, %rdi
+	call	st_create_from_file@PLT
+.LVL99:
+	movq	%rax, %rbx
+.LVL100:
+	.loc 1 131 7 is_stmt 1 view .LVU305
+	.loc 1 131 37 is_stmt 0 view .LVU306
+	testq	%rbx, %rbx
+	jne	.L43
+.LVL101:
+.L68:
+	.loc 1 132 7 is_stmt 1 view .LVU307
+	.loc 1 132 10 is_stmt 0 view .LVU308
+	cmpq	$0, (%r14)
+	je	.L44
+.L66:
+	leaq	496(%rsp), %rdx
+	jmp	.L41
+.LVL102:
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	.loc 1 132 10 view .LVU309
+.LBE93:
+	movq	48(%rsp), %rcx
+.LBE91:
+	.loc 1 116 35 is_stmt 1 view .LVU310
+.LVL103:
+	.loc 1 116 21 view .LVU311
+	addq	$8, %r14
+	addq	$8, %rcx
+.LVL104:
+	.loc 1 116 21 is_stmt 0 view .LVU312
+	cmpq	%r14, 24(%rsp)
+	je	.L53
+.LBB96:
+.LBB94:
+	.loc 1 120 7 view .LVU313
+	movq	(%rcx), %r15
+	jmp	.L36
+.LVL105:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.loc 1 132 7 is_stmt 1 view .LVU314
+	.loc 1 132 10 is_stmt 0 view .LVU315
+	cmpq	$0, (%r14)
+	jne	.L41
+.L44:
+	.loc 1 136 12 is_stmt 1 view .LVU316
+	.loc 1 136 15 is_stmt 0 view .LVU317
+	cmpl	$1, %r13d
+	jne	.L48
+.L67:
+	.loc 1 138 9 view .LVU318
+	leaq	.LC13(%rip), %rdx
+.LVL106:
+.L42:
+	.loc 1 138 9 discriminator 4 view .LVU319
+	movq	%r15, %rsi
+	leaq	.LC38(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL107:
+	jmp	.L48
+.LVL108:
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	.loc 1 136 12 is_stmt 1 view .LVU320
+	.loc 1 136 15 is_stmt 0 view .LVU321
+	cmpl	$1, %r13d
+	jne	.L48
+	.loc 1 138 9 view .LVU322
+	leaq	.LC12(%rip), %rdx
+	jmp	.L42
+.LVL109:
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.loc 1 138 9 view .LVU323
+.LBE94:
+.LBE96:
+.LBE98:
+	.loc 1 146 3 is_stmt 1 view .LVU324
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL110:
+	.loc 1 148 3 view .LVU325
+	.loc 1 149 1 is_stmt 0 view .LVU326
+	movl	36(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL111:
+	.loc 1 149 1 view .LVU327
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+.LVL112:
+	.loc 1 149 1 view .LVU328
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL113:
+	.loc 1 149 1 view .LVU329
+	ret
+.LVL114:
+.L70:
+	.cfi_restore_state
+.LBB99:
+.LBB97:
+.LBB95:
+	.loc 1 132 7 is_stmt 1 view .LVU330
+	.loc 1 132 37 is_stmt 0 view .LVU331
+	movq	(%r14), %rbx
+	.loc 1 132 10 view .LVU332
+	testq	%rbx, %rbx
+	je	.L67
+	.loc 1 122 31 view .LVU333
+	xorl	%ebx, %ebx
+	jmp	.L66
+.LBE95:
+.LBE97:
+.LBE99:
+	.cfi_endproc
+.LFE36:
+	.size	run_st_json_parse_unit_tests, .-run_st_json_parse_unit_tests
+	.section	.rodata.str1.1
+.LC39:
+	.string	"plain"
+.LC40:
+	.string	"a\\\"b\\\\c\\/d"
+.LC41:
+	.string	"\\n\\t\\r\\b\\f"
+.LC42:
+	.string	"\\u0041\\u00e9\\u20ac"
+.LC43:
+	.string	"\\ud83d\\ude00"
+.LC44:
+	.string	"bad\\x"
+.LC45:
+	.string	"\\ud83d"
+.LC46:
+	.string	"\\u12"
+.LC47:
+	.string	"a\"b\\c/d"
+.LC48:
+	.string	"\n\t\r\b\f"
+.LC49:
+	.string	"A\303\251\342\202\254"
+.LC50:
+	.string	"\360\237\230\200"
+	.section	.rodata.str1.8
+	.align 8
+.LC51:
+	.string	"------------------- st_json_unescape(x) -------------------"
+	.align 8
+.LC52:
+	.string	"[Failed] st_json_unescape(\"%s\") failed.\n"
+	.align 8
+.LC53:
+	.string	"[Passed] st_json_unescape(\"%s\") is %s.\n"
+	.text
+	.p2align 4
+	.globl	run_st_json_unescape_unit_tests
+	.type	run_st_json_unescape_unit_tests, @function
+run_st_json_unescape_unit_tests:
+.LFB37:
+	.loc 1 154 39 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	.LC39(%rip), %rax
+	vmovq	%rax, %xmm0
+	.loc 1 156 3 view .LVU335
+	.loc 1 154 39 is_stmt 0 view .LVU336
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 156 15 view .LVU337
+	leaq	.LC40(%rip), %rax
+	leaq	.LC41(%rip), %rcx
+	.loc 1 154 39 view .LVU338
+	pushq	%r14
+	.loc 1 156 15 view .LVU339
+	vpinsrq	$1, %rax, %xmm0, %xmm1
+	vmovq	%rcx, %xmm2
+	.loc 1 154 39 view .LVU340
+	pushq	%r13
+	.loc 1 156 15 view .LVU341
+	leaq	.LC42(%rip), %rax
+	vpinsrq	$1, %rax, %xmm2, %xmm2
+	.loc 1 154 39 view .LVU342
+	pushq	%r12
+	.loc 1 156 15 view .LVU343
+	leaq	.LC45(%rip), %rcx
+	vinserti128	$0x1, %xmm2, %ymm1, %ymm1
+	.loc 1 154 39 view .LVU344
+	pushq	%rbx
+	.loc 1 156 15 view .LVU345
+	leaq	.LC46(%rip), %rax
+	vmovq	%rcx, %xmm2
+	.loc 1 154 39 view .LVU346
+	andq	$-32, %rsp
+	subq	$256, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 156 15 view .LVU347
+	leaq	.LC43(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm2, %xmm2
+	vmovdqa	%ymm1, 64(%rsp)
+	leaq	.LC44(%rip), %rax
+	vmovq	%rcx, %xmm1
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vinserti128	$0x1, %xmm2, %ymm1, %ymm1
+	.loc 1 157 15 view .LVU348
+	leaq	.LC47(%rip), %rax
+	leaq	.LC48(%rip), %rcx
+	.loc 1 156 15 view .LVU349
+	vmovdqa	%ymm1, 96(%rsp)
+	.loc 1 157 3 is_stmt 1 view .LVU350
+	.loc 1 157 15 is_stmt 0 view .LVU351
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vmovq	%rcx, %xmm1
+	leaq	.LC49(%rip), %rax
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	leaq	.LC50(%rip), %rax
+	movq	%rax, 160(%rsp)
+	movq	$0, 168(%rsp)
+	movq	$0, 176(%rsp)
+	movq	$0, 184(%rsp)
+	.loc 1 159 3 is_stmt 1 view .LVU352
+.LVL115:
+	.loc 1 161 3 view .LVU353
+	.loc 1 157 15 is_stmt 0 view .LVU354
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	vmovdqa	%ymm0, 128(%rsp)
+	.loc 1 161 3 view .LVU355
+	leaq	.LC51(%rip), %rdi
+	vzeroupper
+.LVL116:
+	call	puts@PLT
+.LVL117:
+	.loc 1 163 3 is_stmt 1 view .LVU356
+	.loc 1 164 3 view .LVU357
+.LBB100:
+	.loc 1 164 8 view .LVU358
+	.loc 1 164 21 view .LVU359
+	leaq	40(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	leaq	192(%rsp), %rax
+	movq	%rax, 24(%rsp)
+	leaq	48(%rsp), %rax
+	movq	%rax, 8(%rsp)
+.LBE100:
+	.loc 1 161 3 is_stmt 0 view .LVU360
+	xorl	%ebx, %ebx
+	.loc 1 163 7 view .LVU361
+	xorl	%r15d, %r15d
+	leaq	64(%rsp), %r14
+	leaq	128(%rsp), %r13
+	jmp	.L75
+.LVL118:
+	.p2align 4,,10
+	.p2align 3
+.L83:
+.LBB106:
+.LBB101:
+	.loc 1 175 5 discriminator 2 view .LVU362
+	leaq	.LC13(%rip), %rdx
+.LVL119:
+	.loc 1 169 50 discriminator 2 view .LVU363
+	cmpl	$1, %eax
+	je	.L81
+.L73:
+	.loc 1 175 5 discriminator 4 view .LVU364
+	movq	%r12, %rsi
+	leaq	.LC53(%rip), %rdi
+	xorl	%eax, %eax
+.LBE101:
+	.loc 1 164 21 discriminator 4 view .LVU365
+	addq	$8, %rbx
+.LVL120:
+.LBB102:
+	.loc 1 175 5 discriminator 4 view .LVU366
+	call	printf@PLT
+.LVL121:
+	.loc 1 175 5 discriminator 4 view .LVU367
+.LBE102:
+	.loc 1 164 35 is_stmt 1 discriminator 4 view .LVU368
+	.loc 1 164 21 discriminator 4 view .LVU369
+	cmpq	$64, %rbx
+	je	.L82
+.LVL122:
+.L75:
+.LBB103:
+	.loc 1 165 5 view .LVU370
+	.loc 1 165 30 is_stmt 0 view .LVU371
+	movq	(%r14,%rbx), %r12
+	movq	%r12, %rdi
+	call	sv_from_string@PLT
+.LVL123:
+	movq	%rdx, 56(%rsp)
+	.loc 1 166 5 is_stmt 1 view .LVU372
+	.loc 1 167 5 view .LVU373
+	.loc 1 168 21 is_stmt 0 view .LVU374
+	movq	24(%rsp), %rsi
+	movq	16(%rsp), %rdx
+	movq	8(%rsp), %rdi
+	.loc 1 165 30 view .LVU375
+	movq	%rax, 48(%rsp)
+	.loc 1 167 12 view .LVU376
+	movq	$0, 40(%rsp)
+	.loc 1 168 5 is_stmt 1 view .LVU377
+	.loc 1 168 21 is_stmt 0 view .LVU378
+	call	st_json_unescape@PLT
+.LVL124:
+	.loc 1 169 38 view .LVU379
+	movq	0(%r13,%rbx), %rsi
+	.loc 1 168 21 view .LVU380
+	movl	%eax, %edx
+.LVL125:
+	.loc 1 169 5 is_stmt 1 view .LVU381
+	.loc 1 169 42 is_stmt 0 view .LVU382
+	xorl	%eax, %eax
+.LVL126:
+	.loc 1 169 42 view .LVU383
+	testq	%rsi, %rsi
+	setne	%al
+	.loc 1 169 8 view .LVU384
+	cmpl	%edx, %eax
+	je	.L83
+.LVL127:
+.L72:
+	.loc 1 170 7 is_stmt 1 discriminator 6 view .LVU385
+	movq	%r12, %rsi
+	leaq	.LC52(%rip), %rdi
+	xorl	%eax, %eax
+.LBE103:
+	.loc 1 164 21 is_stmt 0 discriminator 6 view .LVU386
+	addq	$8, %rbx
+.LVL128:
+.LBB104:
+	.loc 1 170 7 discriminator 6 view .LVU387
+	call	printf@PLT
+.LVL129:
+	.loc 1 171 7 is_stmt 1 discriminator 6 view .LVU388
+	.loc 1 172 7 discriminator 6 view .LVU389
+	.loc 1 171 19 is_stmt 0 discriminator 6 view .LVU390
+	movl	$1, %r15d
+.LVL130:
+	.loc 1 171 19 discriminator 6 view .LVU391
+.LBE104:
+	.loc 1 164 35 is_stmt 1 discriminator 6 view .LVU392
+	.loc 1 164 21 discriminator 6 view .LVU393
+	cmpq	$64, %rbx
+	jne	.L75
+.L82:
+	.loc 1 164 21 is_stmt 0 discriminator 6 view .LVU394
+.LBE106:
+	.loc 1 177 3 is_stmt 1 view .LVU395
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL131:
+	.loc 1 179 3 view .LVU396
+	.loc 1 180 1 is_stmt 0 view .LVU397
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	movl	%r15d, %eax
+	popq	%r15
+.LVL132:
+	.loc 1 180 1 view .LVU398
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL133:
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.cfi_restore_state
+.LBB107:
+.LBB105:
+	.loc 1 169 83 discriminator 3 view .LVU399
+	movq	%rsi, %rdi
+	movq	%rsi, (%rsp)
+	call	strlen@PLT
+.LVL134:
+	.loc 1 169 69 discriminator 3 view .LVU400
+	cmpq	40(%rsp), %rax
+	jne	.L72
+	.loc 1 169 113 discriminator 5 view .LVU401
+	movq	(%rsp), %rsi
+	movq	24(%rsp), %rdi
+	call	strcmp@PLT
+.LVL135:
+	.loc 1 175 5 discriminator 5 view .LVU402
+	leaq	.LC12(%rip), %rdx
+	.loc 1 169 110 discriminator 5 view .LVU403
+	testl	%eax, %eax
+	je	.L73
+	jmp	.L72
+.LBE105:
+.LBE107:
+	.cfi_endproc
+.LFE37:
+	.size	run_st_json_unescape_unit_tests, .-run_st_json_unescape_unit_tests
+	.section	.rodata.str1.1
+.LC54:
+	.string	"not found"
+.LC55:
+	.string	"{\"a\":}"
+.LC56:
+	.string	"{\"a\": ]"
+.LC57:
+	.string	"{\"a\": ,\"b\": 1}"
+.LC58:
+	.string	"{\"a\": :1}"
+.LC59:
+	.string	"id"
+.LC60:
+	.string	"last"
+.LC61:
+	.string	"missing"
+.LC62:
+	.string	"\"x\""
+.LC63:
+	.string	"indexed"
+.LC64:
+	.string	"streaming"
+	.section	.rodata.str1.8
+	.align 8
+.LC65:
+	.string	"------------------- st_find_key(x) -------------------"
+	.align 8
+.LC68:
+	.string	"[Failed] %s st_find_key(\"%s\") failed: got '%s'.\n"
+	.align 8
+.LC69:
+	.string	"[Passed] %s st_find_key(\"%s\") is '%s'.\n"
+	.section	.rodata.str1.1
+.LC70:
+	.string	"a"
+	.section	.rodata.str1.8
+	.align 8
+.LC71:
+	.string	"[Failed] %s st_skip_value('%s') skipped a missing value.\n"
+	.align 8
+.LC72:
+	.string	"[Passed] %s st_skip_value('%s') reports the missing value.\n"
+	.text
+	.p2align 4
+	.globl	run_st_find_key_unit_tests
+	.type	run_st_find_key_unit_tests, @function
+run_st_find_key_unit_tests:
+.LFB38:
+	.loc 1 185 34 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	.LC57(%rip), %rcx
+	leaq	.LC58(%rip), %rax
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	vmovq	%rcx, %xmm0
+	leaq	.LC55(%rip), %rcx
+	pushq	%r14
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vmovq	%rcx, %xmm1
+	pushq	%r13
+	leaq	.LC56(%rip), %rax
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	pushq	%r12
+	.loc 1 188 15 is_stmt 0 view .LVU405
+	leaq	.LC59(%rip), %rdx
+	vinserti128	$0x1, %xmm0, %ymm1, %ymm2
+	.loc 1 185 34 view .LVU406
+	pushq	%rbx
+	.loc 1 188 15 view .LVU407
+	leaq	.LC60(%rip), %rax
+	vmovq	%rdx, %xmm0
+	.loc 1 185 34 view .LVU408
+	andq	$-32, %rsp
+	subq	$480, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 188 15 view .LVU409
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 189 15 view .LVU410
+	leaq	.LC62(%rip), %rcx
+	.loc 1 188 15 view .LVU411
+	leaq	.LC61(%rip), %rax
+	movq	%rax, 112(%rsp)
+	vmovdqa	%xmm0, 96(%rsp)
+	.loc 1 189 15 view .LVU412
+	leaq	.LC0(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 192 15 view .LVU413
+	leaq	.LC39(%rip), %rdx
+	.loc 1 189 15 view .LVU414
+	vmovdqa	%xmm0, 128(%rsp)
+	.loc 1 192 15 view .LVU415
+	leaq	.LC63(%rip), %rax
+	vmovq	%rdx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC64(%rip), %rax
+	movq	%rax, 176(%rsp)
+	.loc 1 189 15 view .LVU416
+	movq	$0, 144(%rsp)
+	vmovdqa	%ymm2, (%rsp)
+	.loc 1 187 3 is_stmt 1 view .LVU417
+.LVL136:
+	.loc 1 188 3 view .LVU418
+	.loc 1 189 3 view .LVU419
+	.loc 1 191 3 view .LVU420
+	.loc 1 192 3 view .LVU421
+	.loc 1 194 3 view .LVU422
+	.loc 1 192 15 is_stmt 0 view .LVU423
+	vmovdqa	%xmm0, 160(%rsp)
+	.loc 1 194 3 view .LVU424
+	leaq	.LC65(%rip), %rdi
+	vzeroupper
+.LVL137:
+	leaq	224(%rsp), %r14
+	call	puts@PLT
+.LVL138:
+	.loc 1 196 3 is_stmt 1 view .LVU425
+	.loc 1 197 3 view .LVU426
+.LBB108:
+	.loc 1 197 8 view .LVU427
+	.loc 1 197 27 view .LVU428
+	leaq	192(%rsp), %rax
+.LBE108:
+	.loc 1 196 7 is_stmt 0 view .LVU429
+	movl	$0, 92(%rsp)
+	movq	%rax, 80(%rsp)
+.LBB132:
+.LBB109:
+.LBB110:
+.LBB111:
+	.loc 1 232 7 view .LVU430
+	movq	%r14, 48(%rsp)
+.LBE111:
+.LBE110:
+.LBE109:
+.LBE132:
+	.loc 1 194 3 view .LVU431
+	xorl	%r13d, %r13d
+	leaq	160(%rsp), %r15
+.LVL139:
+.L110:
+.LBB133:
+.LBB128:
+	.loc 1 198 5 is_stmt 1 view .LVU432
+	.loc 1 199 5 view .LVU433
+	movq	48(%rsp), %rax
+	vmovdqa64	.LC66(%rip), %zmm4
+	vmovdqa64	.LC67(%rip), %zmm5
+	vmovdqu64	%zmm4, (%rax)
+	vmovdqu64	%zmm5, 39(%rax)
+	.loc 1 200 5 view .LVU434
+.LVL140:
+	.loc 1 201 5 view .LVU435
+	.loc 1 202 5 view .LVU436
+	.loc 1 202 8 is_stmt 0 view .LVU437
+	cmpq	$2, %r13
+	je	.L85
+	.loc 1 203 7 is_stmt 1 view .LVU438
+	.loc 1 203 19 is_stmt 0 view .LVU439
+	movq	%rax, %rdi
+	vzeroupper
+.LVL141:
+	call	st_create@PLT
+.LVL142:
+	movq	%rax, %r14
+.LVL143:
+	.loc 1 204 7 is_stmt 1 view .LVU440
+	.loc 1 204 10 is_stmt 0 view .LVU441
+	cmpq	$1, %r13
+	je	.L153
+	.loc 1 213 5 is_stmt 1 view .LVU442
+.LBB120:
+	.loc 1 213 10 view .LVU443
+.LVL144:
+	.loc 1 213 35 view .LVU444
+	testq	%rax, %rax
+	je	.L154
+.LVL145:
+.L87:
+	.loc 1 213 35 is_stmt 0 view .LVU445
+.LBE120:
+	.loc 1 200 11 view .LVU446
+	xorl	%r12d, %r12d
+.LVL146:
+.L91:
+	.loc 1 200 11 view .LVU447
+	leaq	96(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	leaq	128(%rsp), %rax
+	movq	%rax, 56(%rsp)
+.LBB121:
+.LBB115:
+	.loc 1 216 12 view .LVU448
+	movq	%r12, 40(%rsp)
+.LBE115:
+	.loc 1 213 48 view .LVU449
+	testq	%r14, %r14
+	setne	72(%rsp)
+	movl	$1, %ebx
+.LVL147:
+.L108:
+.LBB116:
+	.loc 1 214 7 is_stmt 1 view .LVU450
+	.loc 1 214 19 is_stmt 0 view .LVU451
+	movq	64(%rsp), %rax
+	movq	%r14, %rdi
+	movq	-8(%rax,%rbx,8), %r12
+	movq	%r12, %rsi
+	call	st_find_key@PLT
+.LVL148:
+	.loc 1 216 7 is_stmt 1 view .LVU452
+	.loc 1 216 12 is_stmt 0 view .LVU453
+	vpxor	%xmm3, %xmm3, %xmm3
+	vmovdqa	%ymm3, 192(%rsp)
+	.loc 1 217 7 is_stmt 1 view .LVU454
+	.loc 1 217 10 is_stmt 0 view .LVU455
+	cmpl	$1, %eax
+	je	.L94
+	.loc 1 226 7 is_stmt 1 view .LVU456
+	.loc 1 226 40 is_stmt 0 view .LVU457
+	movq	56(%rsp), %rcx
+	xorl	%edx, %edx
+	cmpq	$0, -8(%rcx,%rbx,8)
+	setne	%dl
+	.loc 1 226 10 view .LVU458
+	cmpl	%eax, %edx
+	jne	.L155
+	.loc 1 226 124 discriminator 7 view .LVU459
+	movq	%r14, %rdi
+	vzeroupper
+.LVL149:
+	call	st_current_token@PLT
+.LVL150:
+	.loc 1 226 121 discriminator 7 view .LVU460
+	cmpb	$125, %al
+	jne	.L105
+	.loc 1 232 7 view .LVU461
+	leaq	.LC54(%rip), %rcx
+.LVL151:
+.L107:
+	.loc 1 232 7 discriminator 4 view .LVU462
+	movq	(%r15,%r13,8), %rsi
+	movq	%r12, %rdx
+	leaq	.LC69(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL152:
+.L96:
+	.loc 1 232 7 discriminator 4 view .LVU463
+.LBE116:
+	.loc 1 213 57 is_stmt 1 discriminator 2 view .LVU464
+	.loc 1 213 35 discriminator 2 view .LVU465
+	.loc 1 213 23 is_stmt 0 discriminator 2 view .LVU466
+	cmpl	$2, %ebx
+	setle	%al
+	.loc 1 213 35 discriminator 2 view .LVU467
+	incq	%rbx
+.LVL153:
+	.loc 1 213 35 discriminator 2 view .LVU468
+	testb	%al, 72(%rsp)
+	jne	.L108
+.LBE121:
+	.loc 1 234 5 view .LVU469
+	movq	40(%rsp), %r12
+	.loc 1 234 5 is_stmt 1 view .LVU470
+	movq	%r14, %rdi
+	call	st_destroy@PLT
+.LVL154:
+	.loc 1 235 5 view .LVU471
+	.loc 1 235 8 is_stmt 0 view .LVU472
+	testq	%r12, %r12
+	je	.L90
+.LVL155:
+.L92:
+	.loc 1 236 7 is_stmt 1 view .LVU473
+	movq	%r12, %rdi
+	call	fclose@PLT
+.LVL156:
+.L90:
+	.loc 1 236 7 is_stmt 0 view .LVU474
+.LBE128:
+	.loc 1 197 36 is_stmt 1 discriminator 2 view .LVU475
+	.loc 1 197 27 discriminator 2 view .LVU476
+	.loc 1 197 27 is_stmt 0 discriminator 2 view .LVU477
+	incq	%r13
+.LVL157:
+	.loc 1 197 27 discriminator 2 view .LVU478
+	cmpq	$3, %r13
+	jne	.L110
+.LBE133:
+	.loc 1 240 15 view .LVU479
+	vmovdqa	(%rsp), %ymm6
+	movq	48(%rsp), %r14
+	.loc 1 240 3 is_stmt 1 view .LVU480
+	.loc 1 240 15 is_stmt 0 view .LVU481
+	vmovdqa	%ymm6, 192(%rsp)
+	.loc 1 241 3 is_stmt 1 view .LVU482
+.LBB134:
+	.loc 1 241 8 view .LVU483
+.LVL158:
+	.loc 1 241 27 view .LVU484
+.LBB135:
+	.loc 1 242 26 view .LVU485
+	.loc 1 242 26 is_stmt 0 view .LVU486
+	movq	80(%rsp), %r12
+	vzeroupper
+.LVL159:
+	.p2align 4,,10
+	.p2align 3
+.L111:
+.LBB136:
+	.loc 1 243 7 is_stmt 1 view .LVU487
+	.loc 1 244 7 view .LVU488
+	movq	(%r12), %r13
+	movq	%r14, %rdi
+	movq	%r13, %rsi
+	call	strcpy@PLT
+.LVL160:
+	.loc 1 245 7 view .LVU489
+	.loc 1 245 43 is_stmt 0 view .LVU490
+	movq	%r14, %rdi
+	call	st_create@PLT
+.LVL161:
+	movq	%rax, %rbx
+.LVL162:
+	.loc 1 246 7 is_stmt 1 view .LVU491
+	.loc 1 249 7 view .LVU492
+	.loc 1 249 19 is_stmt 0 view .LVU493
+	leaq	.LC70(%rip), %rsi
+	movq	%rax, %rdi
+	call	st_find_key@PLT
+.LVL163:
+	.loc 1 250 7 is_stmt 1 view .LVU494
+	.loc 1 250 14 is_stmt 0 view .LVU495
+	movq	16(%rbx), %rdx
+	movq	%rdx, 72(%rsp)
+.LVL164:
+	.loc 1 251 7 is_stmt 1 view .LVU496
+	.loc 1 251 10 is_stmt 0 view .LVU497
+	testl	%eax, %eax
+	je	.L117
+	.loc 1 251 25 view .LVU498
+	movq	%rbx, %rdi
+	call	st_skip_value@PLT
+.LVL165:
+	.loc 1 251 22 view .LVU499
+	testl	%eax, %eax
+	jne	.L117
+	.loc 1 251 55 view .LVU500
+	movq	72(%rsp), %rdx
+	.loc 1 257 9 view .LVU501
+	movq	(%r15), %rsi
+	.loc 1 251 55 view .LVU502
+	cmpq	16(%rbx), %rdx
+	je	.L156
+.L117:
+	.loc 1 252 9 is_stmt 1 view .LVU503
+	movq	(%r15), %rsi
+	movq	%r13, %rdx
+	leaq	.LC71(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL166:
+	.loc 1 253 9 view .LVU504
+	.loc 1 253 21 is_stmt 0 view .LVU505
+	movl	$1, 92(%rsp)
+.LVL167:
+.L118:
+	.loc 1 259 7 is_stmt 1 view .LVU506
+	movq	%rbx, %rdi
+.LBE136:
+	.loc 1 242 26 is_stmt 0 view .LVU507
+	addq	$8, %r12
+.LBB137:
+	.loc 1 259 7 view .LVU508
+	call	st_destroy@PLT
+.LVL168:
+.LBE137:
+	.loc 1 242 81 is_stmt 1 view .LVU509
+	.loc 1 242 26 view .LVU510
+	cmpq	%r12, %r14
+	jne	.L111
+.LBE135:
+	.loc 1 241 36 discriminator 2 view .LVU511
+.LVL169:
+	.loc 1 241 27 discriminator 2 view .LVU512
+	movq	80(%rsp), %r12
+	leaq	8(%r15), %r13
+.LVL170:
+.LBB141:
+	.loc 1 242 26 discriminator 2 view .LVU513
+.L115:
+.LBB138:
+	.loc 1 243 7 view .LVU514
+	.loc 1 244 7 view .LVU515
+	movq	(%r12), %r15
+	movq	%r14, %rdi
+	movq	%r15, %rsi
+	call	strcpy@PLT
+.LVL171:
+	.loc 1 245 7 view .LVU516
+	.loc 1 245 43 is_stmt 0 view .LVU517
+	movq	%r14, %rdi
+	call	st_create@PLT
+.LVL172:
+	movq	%rax, %rbx
+.LVL173:
+	.loc 1 246 7 is_stmt 1 view .LVU518
+	.loc 1 247 9 view .LVU519
+	movq	%rax, %rdi
+	call	st_build_structural_index@PLT
+.LVL174:
+	.loc 1 249 7 view .LVU520
+	.loc 1 249 19 is_stmt 0 view .LVU521
+	leaq	.LC70(%rip), %rsi
+	movq	%rbx, %rdi
+	call	st_find_key@PLT
+.LVL175:
+	.loc 1 250 7 is_stmt 1 view .LVU522
+	.loc 1 250 14 is_stmt 0 view .LVU523
+	movq	16(%rbx), %rdx
+.LVL176:
+	.loc 1 251 7 is_stmt 1 view .LVU524
+	.loc 1 251 10 is_stmt 0 view .LVU525
+	testl	%eax, %eax
+	jne	.L112
+.LVL177:
+.L114:
+	.loc 1 252 9 is_stmt 1 view .LVU526
+	movq	0(%r13), %rsi
+	movq	%r15, %rdx
+	leaq	.LC71(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL178:
+	.loc 1 253 9 view .LVU527
+	.loc 1 253 21 is_stmt 0 view .LVU528
+	movl	$1, 92(%rsp)
+.LVL179:
+.L113:
+	.loc 1 259 7 is_stmt 1 discriminator 2 view .LVU529
+	movq	%rbx, %rdi
+.LBE138:
+	.loc 1 242 26 is_stmt 0 discriminator 2 view .LVU530
+	addq	$8, %r12
+.LBB139:
+	.loc 1 259 7 discriminator 2 view .LVU531
+	call	st_destroy@PLT
+.LVL180:
+.LBE139:
+	.loc 1 242 81 is_stmt 1 discriminator 2 view .LVU532
+	.loc 1 242 26 discriminator 2 view .LVU533
+	cmpq	%r12, %r14
+	jne	.L115
+.LBE141:
+	.loc 1 241 36 view .LVU534
+.LVL181:
+	.loc 1 241 27 view .LVU535
+	.loc 1 241 27 is_stmt 0 view .LVU536
+.LBE134:
+	.loc 1 262 3 is_stmt 1 view .LVU537
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL182:
+	.loc 1 264 3 view .LVU538
+	.loc 1 265 1 is_stmt 0 view .LVU539
+	movl	92(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL183:
+	.loc 1 265 1 view .LVU540
+	popq	%rbx
+.LVL184:
+	.loc 1 265 1 view .LVU541
+	popq	%r12
+	popq	%r13
+.LVL185:
+	.loc 1 265 1 view .LVU542
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL186:
+	.loc 1 265 1 view .LVU543
+	ret
+.LVL187:
+	.p2align 4,,10
+	.p2align 3
+.L155:
+	.cfi_restore_state
+	.loc 1 265 1 view .LVU544
+	vzeroupper
+.LVL188:
+.L105:
+.LBB143:
+.LBB129:
+.LBB122:
+.LBB117:
+	.loc 1 227 9 is_stmt 1 view .LVU545
+	movq	(%r15,%r13,8), %rsi
+	movq	80(%rsp), %rcx
+	movq	%r12, %rdx
+	leaq	.LC68(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL189:
+	.loc 1 228 9 view .LVU546
+	.loc 1 229 9 view .LVU547
+	.loc 1 228 21 is_stmt 0 view .LVU548
+	movl	$1, 92(%rsp)
+	jmp	.L96
+.LVL190:
+	.p2align 4,,10
+	.p2align 3
+.L94:
+.LBB112:
+	.loc 1 219 9 is_stmt 1 view .LVU549
+	movq	%r14, %rdi
+	movl	$32, %esi
+	vzeroupper
+.LVL191:
+	call	st_ensure@PLT
+.LVL192:
+	.loc 1 220 9 view .LVU550
+	.loc 1 220 16 is_stmt 0 view .LVU551
+	movq	16(%r14), %rax
+	.loc 1 221 13 view .LVU552
+	movq	%r14, %rdi
+	.loc 1 220 16 view .LVU553
+	movq	%rax, 32(%rsp)
+.LVL193:
+	.loc 1 221 9 is_stmt 1 view .LVU554
+	.loc 1 221 13 is_stmt 0 view .LVU555
+	call	st_skip_value@PLT
+.LVL194:
+	.loc 1 221 12 view .LVU556
+	cmpl	$1, %eax
+	je	.L157
+.L97:
+.LBE112:
+	.loc 1 226 7 is_stmt 1 view .LVU557
+	.loc 1 226 36 is_stmt 0 view .LVU558
+	movq	56(%rsp), %rax
+	movq	-8(%rax,%rbx,8), %rsi
+	.loc 1 226 10 view .LVU559
+	testq	%rsi, %rsi
+	je	.L105
+.LVL195:
+.L106:
+	.loc 1 226 66 discriminator 3 view .LVU560
+	movq	80(%rsp), %rdi
+	call	strcmp@PLT
+.LVL196:
+	.loc 1 226 63 discriminator 3 view .LVU561
+	testl	%eax, %eax
+	jne	.L105
+	.loc 1 232 7 view .LVU562
+	movq	80(%rsp), %rcx
+	jmp	.L107
+.LVL197:
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	.loc 1 232 7 view .LVU563
+.LBE117:
+.LBE122:
+	.loc 1 208 10 is_stmt 1 view .LVU564
+	.loc 1 208 22 is_stmt 0 view .LVU565
+	vzeroupper
+.LVL198:
+	call	tmpfile@PLT
+.LVL199:
+	movq	%rax, %r12
+.LVL200:
+	.loc 1 208 13 view .LVU566
+	testq	%rax, %rax
+	je	.L158
+	.loc 1 209 7 is_stmt 1 view .LVU567
+	movq	48(%rsp), %rdi
+	movq	%rax, %rsi
+	call	fputs@PLT
+.LVL201:
+	.loc 1 210 7 view .LVU568
+	movq	%r12, %rdi
+	call	rewind@PLT
+.LVL202:
+	.loc 1 211 7 view .LVU569
+	.loc 1 211 19 is_stmt 0 view .LVU570
+	movl	$3, %esi
+	movq	%r12, %rdi
+	call	st_create_from_file@PLT
+.LVL203:
+	movq	%rax, %r14
+.LVL204:
+	.loc 1 213 5 is_stmt 1 view .LVU571
+.LBB123:
+	.loc 1 213 10 view .LVU572
+	.loc 1 213 35 view .LVU573
+	testq	%rax, %rax
+	jne	.L91
+.LBE123:
+	.loc 1 234 5 view .LVU574
+	xorl	%edi, %edi
+	call	st_destroy@PLT
+.LVL205:
+	.loc 1 235 5 view .LVU575
+	jmp	.L92
+.LVL206:
+	.p2align 4,,10
+	.p2align 3
+.L157:
+.LBB124:
+.LBB118:
+.LBB113:
+	.loc 1 221 66 is_stmt 0 discriminator 1 view .LVU576
+	movq	16(%r14), %rax
+	movq	32(%rsp), %rcx
+	subq	%rcx, %rax
+	.loc 1 221 43 discriminator 1 view .LVU577
+	cmpq	$31, %rax
+	ja	.L97
+	.loc 1 222 11 is_stmt 1 view .LVU578
+	.loc 1 222 43 is_stmt 0 view .LVU579
+	movq	(%r14), %rsi
+	.loc 1 222 11 view .LVU580
+	movq	80(%rsp), %r9
+	.loc 1 222 43 view .LVU581
+	addq	%rcx, %rsi
+	.loc 1 222 11 view .LVU582
+	incq	%rax
+	movq	%r9, %rdi
+	movq	%rsi, %rdx
+	cmpl	$8, %eax
+	jnb	.L159
+.L99:
+	xorl	%ecx, %ecx
+	testb	$4, %al
+	je	.L102
+	movl	(%rdx), %ecx
+	movl	%ecx, (%rdi)
+.LVL207:
+	.loc 1 222 11 view .LVU583
+	movl	$4, %ecx
+.L102:
+	testb	$2, %al
+	je	.L103
+	movzwl	(%rdx,%rcx), %esi
+	movw	%si, (%rdi,%rcx)
+	addq	$2, %rcx
+.L103:
+	testb	$1, %al
+	je	.L104
+	movzbl	(%rdx,%rcx), %eax
+	movb	%al, (%rdi,%rcx)
+.L104:
+	.loc 1 223 11 is_stmt 1 view .LVU584
+	.loc 1 223 45 is_stmt 0 view .LVU585
+	movq	16(%r14), %rax
+	movq	32(%rsp), %rdx
+	incq	%rax
+	subq	%rdx, %rax
+	.loc 1 223 50 view .LVU586
+	movb	$0, 192(%rsp,%rax)
+.LBE113:
+	.loc 1 226 7 is_stmt 1 view .LVU587
+	.loc 1 226 36 is_stmt 0 view .LVU588
+	movq	56(%rsp), %rax
+	movq	-8(%rax,%rbx,8), %rsi
+	.loc 1 226 10 view .LVU589
+	testq	%rsi, %rsi
+	jne	.L106
+	jmp	.L105
+.LVL208:
+	.p2align 4,,10
+	.p2align 3
+.L154:
+	.loc 1 226 10 view .LVU590
+.LBE118:
+.LBE124:
+	.loc 1 234 5 is_stmt 1 view .LVU591
+	xorl	%edi, %edi
+	call	st_destroy@PLT
+.LVL209:
+	.loc 1 235 5 view .LVU592
+.LBE129:
+	.loc 1 197 36 view .LVU593
+	.loc 1 197 27 view .LVU594
+	.loc 1 197 27 is_stmt 0 view .LVU595
+	movl	$1, %r13d
+	jmp	.L110
+.LVL210:
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	.loc 1 197 27 view .LVU596
+.LBE143:
+.LBB144:
+.LBB142:
+.LBB140:
+	.loc 1 251 25 discriminator 1 view .LVU597
+	movq	%rbx, %rdi
+	movq	%rdx, 80(%rsp)
+	call	st_skip_value@PLT
+.LVL211:
+	.loc 1 251 22 discriminator 1 view .LVU598
+	testl	%eax, %eax
+	jne	.L114
+	.loc 1 251 55 discriminator 2 view .LVU599
+	movq	80(%rsp), %rdx
+	.loc 1 257 9 discriminator 2 view .LVU600
+	movq	0(%r13), %rsi
+	.loc 1 251 55 discriminator 2 view .LVU601
+	cmpq	%rdx, 16(%rbx)
+	jne	.L114
+	.loc 1 257 9 is_stmt 1 view .LVU602
+	movq	%r15, %rdx
+	leaq	.LC72(%rip), %rdi
+	call	printf@PLT
+.LVL212:
+	jmp	.L113
+.LVL213:
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	.loc 1 257 9 view .LVU603
+	movq	%r13, %rdx
+	leaq	.LC72(%rip), %rdi
+	call	printf@PLT
+.LVL214:
+	jmp	.L118
+.LVL215:
+	.p2align 4,,10
+	.p2align 3
+.L153:
+	.loc 1 257 9 is_stmt 0 view .LVU604
+.LBE140:
+.LBE142:
+.LBE144:
+.LBB145:
+.LBB130:
+	.loc 1 205 9 is_stmt 1 view .LVU605
+	movq	%rax, %rdi
+	call	st_build_structural_index@PLT
+.LVL216:
+	.loc 1 213 5 view .LVU606
+.LBB125:
+	.loc 1 213 10 view .LVU607
+	.loc 1 213 35 view .LVU608
+	testq	%r14, %r14
+	jne	.L87
+.LBE125:
+	.loc 1 234 5 view .LVU609
+	xorl	%edi, %edi
+	call	st_destroy@PLT
+.LVL217:
+	.loc 1 235 5 view .LVU610
+.LBE130:
+	.loc 1 197 36 view .LVU611
+	.loc 1 197 27 view .LVU612
+	.loc 1 197 27 is_stmt 0 view .LVU613
+	movl	$2, %r13d
+	jmp	.L110
+.LVL218:
+.L159:
+.LBB131:
+.LBB126:
+.LBB119:
+.LBB114:
+	.loc 1 222 11 view .LVU614
+	movl	%eax, %r8d
+	andl	$-8, %r8d
+	xorl	%edx, %edx
+.L100:
+	movl	%edx, %ecx
+	movq	(%rsi,%rcx), %rdi
+	addl	$8, %edx
+	movq	%rdi, (%r9,%rcx)
+	cmpl	%r8d, %edx
+	jb	.L100
+	movq	80(%rsp), %rcx
+	leaq	(%rcx,%rdx), %rdi
+	addq	%rsi, %rdx
+	jmp	.L99
+.LVL219:
+.L158:
+	.loc 1 222 11 view .LVU615
+.LBE114:
+.LBE119:
+.LBE126:
+	.loc 1 213 5 is_stmt 1 view .LVU616
+.LBB127:
+	.loc 1 213 10 view .LVU617
+	.loc 1 213 35 view .LVU618
+.LBE127:
+	.loc 1 234 5 view .LVU619
+	xorl	%edi, %edi
+	call	st_destroy@PLT
+.LVL220:
+	.loc 1 235 5 view .LVU620
+	jmp	.L90
+.LBE131:
+.LBE145:
+	.cfi_endproc
+.LFE38:
+	.size	run_st_find_key_unit_tests, .-run_st_find_key_unit_tests
+	.p2align 4
+	.globl	run_json_parser_tests
+	.type	run_json_parser_tests, @function
+run_json_parser_tests:
+.LFB39:
+	.loc 1 270 29 view -0
+	.cfi_startproc
+	.loc 1 272 3 view .LVU622
+	.loc 1 270 29 is_stmt 0 view .LVU623
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 272 7 view .LVU624
+	xorl	%eax, %eax
+	call	run_st_json_parse_unit_tests@PLT
+.LVL221:
+	.loc 1 272 6 view .LVU625
+	cmpl	$1, %eax
+	je	.L163
+	.loc 1 276 3 is_stmt 1 view .LVU626
+	.loc 1 276 7 is_stmt 0 view .LVU627
+	xorl	%eax, %eax
+	call	run_st_json_unescape_unit_tests@PLT
+.LVL222:
+	.loc 1 276 6 view .LVU628
+	cmpl	$1, %eax
+	je	.L163
+	.loc 1 280 3 is_stmt 1 view .LVU629
+	.loc 1 280 7 is_stmt 0 view .LVU630
+	xorl	%eax, %eax
+	call	run_st_find_key_unit_tests@PLT
+.LVL223:
+	.loc 1 280 6 view .LVU631
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+	.loc 1 285 1 view .LVU632
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	.cfi_restore_state
+	.loc 1 273 11 view .LVU633
+	movl	$1, %eax
+	.loc 1 285 1 view .LVU634
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE39:
+	.size	run_json_parser_tests, .-run_json_parser_tests
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	json_test_handler, @object
+	.size	json_test_handler, 72
+json_test_handler:
+	.quad	json_test_start_object
+	.quad	json_test_end_object
+	.quad	json_test_start_array
+	.quad	json_test_end_array
+	.quad	json_test_key
+	.quad	json_test_string
+	.quad	json_test_number
+	.quad	json_test_boolean
+	.quad	json_test_null
+	.section	.rodata
+	.align 64
+.LC66:
+	.quad	4189034201484567163
+	.quad	6566312176039131936
+	.quad	2478221291776126001
+	.quad	2459014176588177466
+	.quad	6655613409846502003
+	.quad	7596484193047880226
+	.quad	6727070662380385395
+	.quad	3196749125158838316
+	.align 64
+.LC67:
+	.quad	7791825680754418268
+	.quad	6582890714390360937
+	.quad	6711036797442337885
+	.quad	3251662850512527404
+	.quad	2462378497083256369
+	.quad	2483772716304458857
+	.quad	2482736156851183660
+	.quad	35295927194624058
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 6 "/usr/include/stdio.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "/root/repo/tests/../include/strutils.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1da0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2d
+	.long	.LASF178
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0x14
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x18
+	.long	0x35
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x2e
+	.byte	0x8
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x14
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x14
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x98
+	.byte	0x12
+	.long	0x79
+	.uleb128 0x14
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x99
+	.byte	0x12
+	.long	0x79
+	.uleb128 0x14
+	.long	.LASF14
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x79
+	.uleb128 0x8
+	.long	0xb5
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0x18
+	.long	0xb5
+	.uleb128 0x25
+	.long	.LASF53
+	.byte	0xd8
+	.byte	0x4
+	.byte	0x31
+	.long	0x247
+	.uleb128 0x5
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x33
+	.byte	0x7
+	.long	0x72
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x36
+	.byte	0x9
+	.long	0xb0
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x37
+	.byte	0x9
+	.long	0xb0
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x38
+	.byte	0x9
+	.long	0xb0
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF20
+	.byte	0x4
+	.byte	0x39
+	.byte	0x9
+	.long	0xb0
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF21
+	.byte	0x4
+	.byte	0x3a
+	.byte	0x9
+	.long	0xb0
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x9
+	.long	0xb0
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x3c
+	.byte	0x9
+	.long	0xb0
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF24
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x9
+	.long	0xb0
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF25
+	.byte	0x4
+	.byte	0x40
+	.byte	0x9
+	.long	0xb0
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF26
+	.byte	0x4
+	.byte	0x41
+	.byte	0x9
+	.long	0xb0
+	.byte	0x50
+	.uleb128 0x5
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x42
+	.byte	0x9
+	.long	0xb0
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF28
+	.byte	0x4
+	.byte	0x44
+	.byte	0x16
+	.long	0x260
+	.byte	0x60
+	.uleb128 0x5
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x46
+	.byte	0x14
+	.long	0x265
+	.byte	0x68
+	.uleb128 0x5
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x48
+	.byte	0x7
+	.long	0x72
+	.byte	0x70
+	.uleb128 0x5
+	.long	.LASF31
+	.byte	0x4
+	.byte	0x49
+	.byte	0x7
+	.long	0x72
+	.byte	0x74
+	.uleb128 0x5
+	.long	.LASF32
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xb
+	.long	0x8c
+	.byte	0x78
+	.uleb128 0x5
+	.long	.LASF33
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x12
+	.long	0x5d
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF34
+	.byte	0x4
+	.byte	0x4e
+	.byte	0xf
+	.long	0x64
+	.byte	0x82
+	.uleb128 0x5
+	.long	.LASF35
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x8
+	.long	0x26a
+	.byte	0x83
+	.uleb128 0x5
+	.long	.LASF36
+	.byte	0x4
+	.byte	0x51
+	.byte	0xf
+	.long	0x27a
+	.byte	0x88
+	.uleb128 0x5
+	.long	.LASF37
+	.byte	0x4
+	.byte	0x59
+	.byte	0xd
+	.long	0x98
+	.byte	0x90
+	.uleb128 0x5
+	.long	.LASF38
+	.byte	0x4
+	.byte	0x5b
+	.byte	0x17
+	.long	0x284
+	.byte	0x98
+	.uleb128 0x5
+	.long	.LASF39
+	.byte	0x4
+	.byte	0x5c
+	.byte	0x19
+	.long	0x28e
+	.byte	0xa0
+	.uleb128 0x5
+	.long	.LASF40
+	.byte	0x4
+	.byte	0x5d
+	.byte	0x14
+	.long	0x265
+	.byte	0xa8
+	.uleb128 0x5
+	.long	.LASF41
+	.byte	0x4
+	.byte	0x5e
+	.byte	0x9
+	.long	0x54
+	.byte	0xb0
+	.uleb128 0x5
+	.long	.LASF42
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xa
+	.long	0x35
+	.byte	0xb8
+	.uleb128 0x5
+	.long	.LASF43
+	.byte	0x4
+	.byte	0x60
+	.byte	0x7
+	.long	0x72
+	.byte	0xc0
+	.uleb128 0x5
+	.long	.LASF44
+	.byte	0x4
+	.byte	0x62
+	.byte	0x8
+	.long	0x293
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF45
+	.byte	0x5
+	.byte	0x7
+	.byte	0x19
+	.long	0xc1
+	.uleb128 0x30
+	.long	.LASF179
+	.byte	0x4
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1d
+	.long	.LASF46
+	.uleb128 0x8
+	.long	0x25b
+	.uleb128 0x8
+	.long	0xc1
+	.uleb128 0x10
+	.long	0xb5
+	.long	0x27a
+	.uleb128 0x11
+	.long	0x46
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x253
+	.uleb128 0x1d
+	.long	.LASF47
+	.uleb128 0x8
+	.long	0x27f
+	.uleb128 0x1d
+	.long	.LASF48
+	.uleb128 0x8
+	.long	0x289
+	.uleb128 0x10
+	.long	0xb5
+	.long	0x2a3
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x13
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF49
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x13
+	.long	0xa4
+	.uleb128 0x8
+	.long	0x247
+	.uleb128 0x26
+	.long	0x2af
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF50
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF51
+	.uleb128 0x10
+	.long	0xb5
+	.long	0x2d7
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x8
+	.long	0x2dc
+	.uleb128 0x31
+	.uleb128 0x8
+	.long	0xbc
+	.uleb128 0x26
+	.long	0x2dd
+	.uleb128 0x14
+	.long	.LASF52
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x14
+	.long	0x80
+	.uleb128 0x25
+	.long	.LASF54
+	.byte	0x10
+	.byte	0x8
+	.byte	0xd
+	.long	0x318
+	.uleb128 0x27
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0x2dd
+	.byte	0
+	.uleb128 0x27
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0x18
+	.long	0x2f3
+	.uleb128 0x19
+	.long	.LASF55
+	.byte	0x18
+	.value	0x175
+	.long	0x351
+	.uleb128 0x4
+	.long	.LASF56
+	.value	0x17a
+	.byte	0x1c
+	.long	0x356
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF57
+	.value	0x17f
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF58
+	.value	0x184
+	.byte	0xa
+	.long	0x35
+	.byte	0x10
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF59
+	.uleb128 0x8
+	.long	0x351
+	.uleb128 0xe
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF60
+	.uleb128 0x19
+	.long	.LASF61
+	.byte	0x40
+	.value	0x1e6
+	.long	0x3d7
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x1eb
+	.byte	0xc
+	.long	0x2e7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x1f0
+	.byte	0xc
+	.long	0x2e7
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF64
+	.value	0x1f5
+	.byte	0xc
+	.long	0x2e7
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x1fa
+	.byte	0xc
+	.long	0x2e7
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF66
+	.value	0x1ff
+	.byte	0xc
+	.long	0x2e7
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF67
+	.value	0x204
+	.byte	0xc
+	.long	0x2e7
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF68
+	.value	0x209
+	.byte	0xc
+	.long	0x2e7
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF69
+	.value	0x20e
+	.byte	0xc
+	.long	0x2e7
+	.byte	0x38
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF70
+	.byte	0x38
+	.value	0x26c
+	.long	0x44b
+	.uleb128 0x4
+	.long	.LASF71
+	.value	0x272
+	.byte	0xd
+	.long	0x464
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF72
+	.value	0x277
+	.byte	0x9
+	.long	0x54
+	.byte	0x8
+	.uleb128 0x20
+	.string	"fd"
+	.value	0x27c
+	.byte	0x7
+	.long	0x72
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF73
+	.value	0x281
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF74
+	.value	0x286
+	.byte	0xa
+	.long	0x35
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF75
+	.value	0x28b
+	.byte	0xa
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x20
+	.string	"eof"
+	.value	0x290
+	.byte	0x7
+	.long	0x72
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF76
+	.value	0x295
+	.byte	0x7
+	.long	0x72
+	.byte	0x34
+	.byte	0
+	.uleb128 0x1a
+	.long	0x2a3
+	.long	0x464
+	.uleb128 0x3
+	.long	0x54
+	.uleb128 0x3
+	.long	0xb0
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x8
+	.long	0x44b
+	.uleb128 0x28
+	.long	.LASF79
+	.long	0x4d
+	.value	0x29b
+	.long	0x485
+	.uleb128 0x16
+	.long	.LASF77
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF78
+	.byte	0x1
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF80
+	.long	0x4d
+	.value	0x2b5
+	.long	0x4ad
+	.uleb128 0x16
+	.long	.LASF81
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF82
+	.byte	0x1
+	.uleb128 0x16
+	.long	.LASF83
+	.byte	0x2
+	.uleb128 0x16
+	.long	.LASF84
+	.byte	0x3
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF85
+	.value	0x158
+	.byte	0x8
+	.value	0x2cf
+	.byte	0x8
+	.long	0x55b
+	.uleb128 0x4
+	.long	.LASF86
+	.value	0x2d4
+	.byte	0x9
+	.long	0xb0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF87
+	.value	0x2d9
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF88
+	.value	0x2de
+	.byte	0xa
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF89
+	.value	0x2e3
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF90
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x469
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF91
+	.value	0x2ed
+	.byte	0xa
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF92
+	.value	0x2f2
+	.byte	0x18
+	.long	0x55b
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF93
+	.value	0x2f7
+	.byte	0x18
+	.long	0x485
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF94
+	.value	0x2fc
+	.byte	0x17
+	.long	0x560
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF95
+	.value	0x301
+	.byte	0x8
+	.long	0x565
+	.byte	0x48
+	.uleb128 0x29
+	.long	.LASF96
+	.value	0x306
+	.byte	0x21
+	.long	0x5c3
+	.value	0x148
+	.uleb128 0x29
+	.long	.LASF97
+	.value	0x30b
+	.byte	0x17
+	.long	0x5c8
+	.value	0x150
+	.byte	0
+	.uleb128 0x8
+	.long	0x3d7
+	.uleb128 0x8
+	.long	0x31d
+	.uleb128 0x10
+	.long	0xb5
+	.long	0x575
+	.uleb128 0x11
+	.long	0x46
+	.byte	0xff
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF98
+	.byte	0x28
+	.value	0x764
+	.long	0x5c3
+	.uleb128 0x4
+	.long	.LASF99
+	.value	0x769
+	.byte	0xb
+	.long	0x6c2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF100
+	.value	0x76e
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF101
+	.value	0x774
+	.byte	0xd
+	.long	0x6c7
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF87
+	.value	0x779
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF102
+	.value	0x77e
+	.byte	0xa
+	.long	0x35
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	0x575
+	.uleb128 0x8
+	.long	0x362
+	.uleb128 0x19
+	.long	.LASF103
+	.byte	0x48
+	.value	0x6dc
+	.long	0x64f
+	.uleb128 0x4
+	.long	.LASF104
+	.value	0x6e1
+	.byte	0x9
+	.long	0x663
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF105
+	.value	0x6e6
+	.byte	0x9
+	.long	0x663
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF106
+	.value	0x6eb
+	.byte	0x9
+	.long	0x663
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF107
+	.value	0x6f0
+	.byte	0x9
+	.long	0x663
+	.byte	0x18
+	.uleb128 0x20
+	.string	"key"
+	.value	0x6f5
+	.byte	0x9
+	.long	0x681
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF86
+	.value	0x6fa
+	.byte	0x9
+	.long	0x681
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF108
+	.value	0x6ff
+	.byte	0x9
+	.long	0x6a4
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF109
+	.value	0x704
+	.byte	0x9
+	.long	0x6bd
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF110
+	.value	0x709
+	.byte	0x9
+	.long	0x663
+	.byte	0x40
+	.byte	0
+	.uleb128 0x18
+	.long	0x5cd
+	.uleb128 0x1a
+	.long	0x72
+	.long	0x663
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x8
+	.long	0x654
+	.uleb128 0x1a
+	.long	0x72
+	.long	0x67c
+	.uleb128 0x3
+	.long	0x54
+	.uleb128 0x3
+	.long	0x67c
+	.byte	0
+	.uleb128 0x8
+	.long	0x318
+	.uleb128 0x8
+	.long	0x668
+	.uleb128 0x1a
+	.long	0x72
+	.long	0x69f
+	.uleb128 0x3
+	.long	0x54
+	.uleb128 0x3
+	.long	0x67c
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x18
+	.long	0x2e
+	.uleb128 0x8
+	.long	0x686
+	.uleb128 0x1a
+	.long	0x72
+	.long	0x6bd
+	.uleb128 0x3
+	.long	0x54
+	.uleb128 0x3
+	.long	0x72
+	.byte	0
+	.uleb128 0x8
+	.long	0x6a9
+	.uleb128 0x8
+	.long	0x35
+	.uleb128 0x8
+	.long	0x2e7
+	.uleb128 0x8
+	.long	0x4ad
+	.uleb128 0x33
+	.long	.LASF111
+	.value	0x108
+	.byte	0x1
+	.byte	0x9
+	.byte	0x8
+	.long	0x6fb
+	.uleb128 0x5
+	.long	.LASF112
+	.byte	0x1
+	.byte	0xa
+	.byte	0x8
+	.long	0x565
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF87
+	.byte	0x1
+	.byte	0xb
+	.byte	0xa
+	.long	0x35
+	.value	0x100
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF137
+	.byte	0x42
+	.byte	0x21
+	.long	0x64f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	json_test_handler
+	.uleb128 0xd
+	.long	.LASF113
+	.byte	0x8
+	.value	0x416
+	.byte	0x6
+	.long	0xb5
+	.long	0x727
+	.uleb128 0x3
+	.long	0x6cc
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF114
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.long	0x54
+	.long	0x747
+	.uleb128 0x3
+	.long	0x54
+	.uleb128 0x3
+	.long	0x2d7
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF115
+	.byte	0x8
+	.value	0x740
+	.byte	0x5
+	.long	0x72
+	.long	0x75e
+	.uleb128 0x3
+	.long	0x6cc
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF116
+	.byte	0x8
+	.value	0x394
+	.byte	0x5
+	.long	0x72
+	.long	0x77a
+	.uleb128 0x3
+	.long	0x6cc
+	.uleb128 0x3
+	.long	0x41
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF117
+	.byte	0x8
+	.value	0x753
+	.byte	0x5
+	.long	0x72
+	.long	0x796
+	.uleb128 0x3
+	.long	0x6cc
+	.uleb128 0x3
+	.long	0x2dd
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF118
+	.byte	0x8
+	.value	0x78f
+	.byte	0x5
+	.long	0x72
+	.long	0x7ad
+	.uleb128 0x3
+	.long	0x6cc
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF119
+	.byte	0x8
+	.value	0x317
+	.byte	0x19
+	.long	0x6cc
+	.long	0x7c4
+	.uleb128 0x3
+	.long	0xb0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF120
+	.byte	0x8
+	.value	0x730
+	.byte	0x5
+	.long	0x72
+	.long	0x7e5
+	.uleb128 0x3
+	.long	0x67c
+	.uleb128 0x3
+	.long	0xb0
+	.uleb128 0x3
+	.long	0x6c2
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF121
+	.byte	0x8
+	.byte	0x23
+	.byte	0x13
+	.long	0x2f3
+	.long	0x7fb
+	.uleb128 0x3
+	.long	0x2dd
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF122
+	.byte	0x8
+	.value	0x64e
+	.byte	0x8
+	.long	0x35
+	.long	0x817
+	.uleb128 0x3
+	.long	0xb0
+	.uleb128 0x3
+	.long	0x69f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF123
+	.byte	0x6
+	.value	0x17a
+	.byte	0xc
+	.long	0x72
+	.long	0x839
+	.uleb128 0x3
+	.long	0xb0
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x2dd
+	.uleb128 0x2a
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF124
+	.byte	0x6
+	.byte	0xb2
+	.byte	0xc
+	.long	0x72
+	.long	0x84f
+	.uleb128 0x3
+	.long	0x2af
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF129
+	.byte	0x8
+	.value	0x403
+	.byte	0x6
+	.long	0x862
+	.uleb128 0x3
+	.long	0x6cc
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF125
+	.byte	0x6
+	.value	0x164
+	.byte	0xc
+	.long	0x72
+	.long	0x87a
+	.uleb128 0x3
+	.long	0x2dd
+	.uleb128 0x2a
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF126
+	.byte	0x9
+	.byte	0x9c
+	.byte	0xc
+	.long	0x72
+	.long	0x895
+	.uleb128 0x3
+	.long	0x2dd
+	.uleb128 0x3
+	.long	0x2dd
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF127
+	.byte	0x8
+	.value	0x71e
+	.byte	0x5
+	.long	0x72
+	.long	0x8b6
+	.uleb128 0x3
+	.long	0x6cc
+	.uleb128 0x3
+	.long	0x8b6
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x8
+	.long	0x64f
+	.uleb128 0xd
+	.long	.LASF128
+	.byte	0x8
+	.value	0x371
+	.byte	0x19
+	.long	0x6cc
+	.long	0x8d7
+	.uleb128 0x3
+	.long	0x2af
+	.uleb128 0x3
+	.long	0x41
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF130
+	.byte	0x6
+	.value	0x2d3
+	.byte	0xd
+	.long	0x8ea
+	.uleb128 0x3
+	.long	0x2af
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF131
+	.byte	0x6
+	.value	0x28f
+	.byte	0xc
+	.long	0x72
+	.long	0x906
+	.uleb128 0x3
+	.long	0x2e2
+	.uleb128 0x3
+	.long	0x2b4
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF180
+	.byte	0x6
+	.byte	0xbc
+	.byte	0xe
+	.long	0x2af
+	.uleb128 0xd
+	.long	.LASF132
+	.byte	0x8
+	.value	0x326
+	.byte	0x19
+	.long	0x6cc
+	.long	0x92e
+	.uleb128 0x3
+	.long	0xb0
+	.uleb128 0x3
+	.long	0x41
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF133
+	.byte	0x9
+	.value	0x197
+	.byte	0xf
+	.long	0x35
+	.long	0x945
+	.uleb128 0x3
+	.long	0x2dd
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF134
+	.byte	0x9
+	.byte	0x8d
+	.byte	0xe
+	.long	0xb0
+	.long	0x960
+	.uleb128 0x3
+	.long	0xb0
+	.uleb128 0x3
+	.long	0x2dd
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF135
+	.byte	0x1
+	.value	0x10e
+	.byte	0x5
+	.long	0x72
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9ab
+	.uleb128 0x1c
+	.quad	.LVL221
+	.long	0x1197
+	.uleb128 0x1c
+	.quad	.LVL222
+	.long	0xfbd
+	.uleb128 0x1c
+	.quad	.LVL223
+	.long	0x9ab
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF136
+	.byte	0xb9
+	.long	0x72
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf9d
+	.uleb128 0x9
+	.long	.LASF138
+	.byte	0xbb
+	.byte	0xf
+	.long	0x2dd
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+7453
+	.sleb128 0
+	.uleb128 0x9
+	.long	.LASF139
+	.byte	0xbc
+	.byte	0xf
+	.long	0xf9d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0x9
+	.long	.LASF140
+	.byte	0xbd
+	.byte	0xf
+	.long	0xf9d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x22
+	.long	.LASF141
+	.byte	0xbf
+	.long	0x72
+	.byte	0x3
+	.uleb128 0x9
+	.long	.LASF142
+	.byte	0xc0
+	.byte	0xf
+	.long	0xf9d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0xb
+	.long	.LASF144
+	.byte	0xc4
+	.byte	0x7
+	.long	0x72
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x9
+	.long	.LASF143
+	.byte	0xf0
+	.byte	0xf
+	.long	0xfad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.uleb128 0x17
+	.long	.LLRL92
+	.long	0xd05
+	.uleb128 0xb
+	.long	.LASF145
+	.byte	0xc5
+	.byte	0xc
+	.long	0x72
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0xc
+	.long	.LLRL94
+	.uleb128 0x9
+	.long	.LASF86
+	.byte	0xc6
+	.byte	0xa
+	.long	0x565
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 224
+	.uleb128 0xb
+	.long	.LASF146
+	.byte	0xc8
+	.byte	0xb
+	.long	0x2af
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0xb
+	.long	.LASF147
+	.byte	0xc9
+	.byte	0x1d
+	.long	0x6cc
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x17
+	.long	.LLRL97
+	.long	0xbd3
+	.uleb128 0x1e
+	.string	"i"
+	.byte	0xd5
+	.byte	0xe
+	.long	0x72
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0xc
+	.long	.LLRL99
+	.uleb128 0xb
+	.long	.LASF148
+	.byte	0xd6
+	.byte	0xb
+	.long	0x72
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x9
+	.long	.LASF149
+	.byte	0xd8
+	.byte	0xc
+	.long	0x2c7
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.uleb128 0x17
+	.long	.LLRL101
+	.long	0xb28
+	.uleb128 0xb
+	.long	.LASF150
+	.byte	0xdc
+	.byte	0x10
+	.long	0x35
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x12
+	.quad	.LVL191
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL192
+	.long	0x75e
+	.long	0xb13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL194
+	.long	0x747
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL148
+	.long	0x77a
+	.long	0xb46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL149
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL150
+	.long	0x710
+	.long	0xb69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL152
+	.long	0x862
+	.long	0xb8e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL189
+	.long	0x862
+	.long	0xbbb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 80
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL196
+	.long	0x87a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 80
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL141
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL142
+	.long	0x7ad
+	.long	0xbf7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL154
+	.long	0x84f
+	.long	0xc0f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL156
+	.long	0x839
+	.long	0xc27
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL198
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1c
+	.quad	.LVL199
+	.long	0x906
+	.uleb128 0x2
+	.quad	.LVL201
+	.long	0x8ea
+	.long	0xc5e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL202
+	.long	0x8d7
+	.long	0xc76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL203
+	.long	0x8bb
+	.long	0xc93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL205
+	.long	0x84f
+	.long	0xcaa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL209
+	.long	0x84f
+	.long	0xcc1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL216
+	.long	0x796
+	.long	0xcd9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL217
+	.long	0x84f
+	.long	0xcf0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL220
+	.long	0x84f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LLRL103
+	.long	0xf45
+	.uleb128 0xb
+	.long	.LASF145
+	.byte	0xf1
+	.byte	0xc
+	.long	0x72
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0xc
+	.long	.LLRL105
+	.uleb128 0x1e
+	.string	"i"
+	.byte	0xf2
+	.byte	0x11
+	.long	0x35
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0xc
+	.long	.LLRL107
+	.uleb128 0x9
+	.long	.LASF86
+	.byte	0xf3
+	.byte	0xc
+	.long	0x2c7
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 224
+	.uleb128 0xb
+	.long	.LASF147
+	.byte	0xf5
+	.byte	0x1f
+	.long	0x6cc
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0xb
+	.long	.LASF148
+	.byte	0xf9
+	.byte	0xb
+	.long	0x72
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0xb
+	.long	.LASF88
+	.byte	0xfa
+	.byte	0xe
+	.long	0x35
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x2
+	.quad	.LVL160
+	.long	0x945
+	.long	0xda2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL161
+	.long	0x7ad
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL163
+	.long	0x77a
+	.long	0xddf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL165
+	.long	0x747
+	.long	0xdf7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL166
+	.long	0x862
+	.long	0xe1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL168
+	.long	0x84f
+	.long	0xe34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL171
+	.long	0x945
+	.long	0xe52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL172
+	.long	0x7ad
+	.long	0xe6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL174
+	.long	0x796
+	.long	0xe82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL175
+	.long	0x77a
+	.long	0xea7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL178
+	.long	0x862
+	.long	0xecc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL180
+	.long	0x84f
+	.long	0xee4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL211
+	.long	0x747
+	.long	0xefc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL212
+	.long	0x862
+	.long	0xf21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL214
+	.long	0x862
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL137
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL138
+	.long	0x1d88
+	.long	0xf6f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL159
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL182
+	.long	0x1d91
+	.long	0xf91
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL188
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x10
+	.long	0x2dd
+	.long	0xfad
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x2
+	.byte	0
+	.uleb128 0x10
+	.long	0x2dd
+	.long	0xfbd
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x3
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF151
+	.byte	0x9a
+	.long	0x72
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1177
+	.uleb128 0x9
+	.long	.LASF152
+	.byte	0x9c
+	.byte	0xf
+	.long	0x1177
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x9
+	.long	.LASF140
+	.byte	0x9d
+	.byte	0xf
+	.long	0x1177
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x22
+	.long	.LASF141
+	.byte	0x9f
+	.long	0x72
+	.byte	0x8
+	.uleb128 0xb
+	.long	.LASF144
+	.byte	0xa3
+	.byte	0x7
+	.long	0x72
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x17
+	.long	.LLRL87
+	.long	0x1139
+	.uleb128 0x1e
+	.string	"i"
+	.byte	0xa4
+	.byte	0xc
+	.long	0x72
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0xc
+	.long	.LLRL89
+	.uleb128 0x9
+	.long	.LASF153
+	.byte	0xa5
+	.byte	0x17
+	.long	0x2f3
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 48
+	.uleb128 0x9
+	.long	.LASF112
+	.byte	0xa6
+	.byte	0xa
+	.long	0x1187
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.uleb128 0x9
+	.long	.LASF87
+	.byte	0xa7
+	.byte	0xc
+	.long	0x35
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.uleb128 0xb
+	.long	.LASF154
+	.byte	0xa8
+	.byte	0x9
+	.long	0x72
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x2
+	.quad	.LVL121
+	.long	0x862
+	.long	0x109b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL123
+	.long	0x7e5
+	.long	0x10b3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL124
+	.long	0x7c4
+	.long	0x10da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 8
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 16
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL129
+	.long	0x862
+	.long	0x10ff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL134
+	.long	0x92e
+	.long	0x1118
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 0
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL135
+	.long	0x87a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL116
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL117
+	.long	0x1d88
+	.long	0x1163
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC51
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL131
+	.long	0x1d91
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x2dd
+	.long	0x1187
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x7
+	.byte	0
+	.uleb128 0x10
+	.long	0xb5
+	.long	0x1197
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF155
+	.byte	0x51
+	.long	0x72
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1420
+	.uleb128 0x9
+	.long	.LASF156
+	.byte	0x53
+	.byte	0xf
+	.long	0x1420
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.uleb128 0x9
+	.long	.LASF140
+	.byte	0x66
+	.byte	0xf
+	.long	0x1420
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 352
+	.uleb128 0x22
+	.long	.LASF141
+	.byte	0x6f
+	.long	0x72
+	.byte	0x11
+	.uleb128 0xb
+	.long	.LASF144
+	.byte	0x73
+	.byte	0x7
+	.long	0x72
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x17
+	.long	.LLRL78
+	.long	0x13e2
+	.uleb128 0x1e
+	.string	"i"
+	.byte	0x74
+	.byte	0xc
+	.long	0x72
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0xc
+	.long	.LLRL80
+	.uleb128 0xb
+	.long	.LASF157
+	.byte	0x75
+	.byte	0xe
+	.long	0x72
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0xc
+	.long	.LLRL82
+	.uleb128 0x9
+	.long	.LASF158
+	.byte	0x76
+	.byte	0x1d
+	.long	0x6d1
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 496
+	.uleb128 0x9
+	.long	.LASF86
+	.byte	0x77
+	.byte	0xc
+	.long	0x1430
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0xb
+	.long	.LASF146
+	.byte	0x79
+	.byte	0xd
+	.long	0x2af
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0xb
+	.long	.LASF147
+	.byte	0x7a
+	.byte	0x1f
+	.long	0x6cc
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0xb
+	.long	.LASF159
+	.byte	0x83
+	.byte	0xb
+	.long	0x72
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x12
+	.quad	.LVL79
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL80
+	.long	0x1d9a
+	.long	0x12aa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL82
+	.long	0x912
+	.long	0x12c3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL85
+	.long	0x895
+	.long	0x12ef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	json_test_handler
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 40
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL87
+	.long	0x87a
+	.long	0x1308
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 40
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL89
+	.long	0x862
+	.long	0x132d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL91
+	.long	0x84f
+	.long	0x1345
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL92
+	.long	0x839
+	.long	0x135d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL95
+	.long	0x906
+	.uleb128 0x2
+	.quad	.LVL97
+	.long	0x8ea
+	.long	0x1389
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL98
+	.long	0x8d7
+	.long	0x13a1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL99
+	.long	0x8bb
+	.long	0x13be
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL107
+	.long	0x862
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL75
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL76
+	.long	0x1d88
+	.long	0x140c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC36
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL110
+	.long	0x1d91
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x2dd
+	.long	0x1430
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	0xb5
+	.long	0x1440
+	.uleb128 0x11
+	.long	0x46
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF160
+	.byte	0x3b
+	.long	0x72
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1513
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x3b
+	.byte	0x21
+	.long	0x54
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x15
+	.long	0x1cc7
+	.quad	.LBI18
+	.byte	.LVU55
+	.long	.LLRL20
+	.byte	0x3c
+	.uleb128 0x6
+	.long	0x1cec
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x6
+	.long	0x1ce2
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x6
+	.long	0x1cd8
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0xc
+	.long	.LLRL20
+	.uleb128 0x7
+	.long	0x1cf6
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x7
+	.long	0x1d01
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x7
+	.long	0x1d0c
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0xa
+	.quad	.LVL20
+	.long	0x817
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF161
+	.byte	0x37
+	.long	0x72
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x160f
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x37
+	.byte	0x24
+	.long	0x54
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xf
+	.long	.LASF149
+	.byte	0x37
+	.byte	0x31
+	.long	0x72
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x15
+	.long	0x1cc7
+	.quad	.LBI4
+	.byte	.LVU9
+	.long	.LLRL2
+	.byte	0x38
+	.uleb128 0x6
+	.long	0x1cec
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x6
+	.long	0x1ce2
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x6
+	.long	0x1cd8
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xc
+	.long	.LLRL2
+	.uleb128 0x7
+	.long	0x1cf6
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x7
+	.long	0x1d01
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x7
+	.long	0x1d0c
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xa
+	.quad	.LVL5
+	.long	0x817
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1f
+	.byte	0x3
+	.quad	.LC1
+	.byte	0x3
+	.quad	.LC0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF162
+	.byte	0x31
+	.long	0x72
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x174b
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x31
+	.byte	0x23
+	.long	0x54
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2c
+	.string	"raw"
+	.byte	0x31
+	.byte	0x45
+	.long	0x67c
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xf
+	.long	.LASF149
+	.byte	0x31
+	.byte	0x51
+	.long	0x2e
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x9
+	.long	.LASF112
+	.byte	0x32
+	.byte	0x8
+	.long	0x2c7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1f
+	.long	.LASF153
+	.byte	0x33
+	.byte	0x15
+	.long	0x2f3
+	.uleb128 0x37
+	.long	0x1cc7
+	.quad	.LBI12
+	.byte	.LVU37
+	.long	.LLRL12
+	.byte	0x1
+	.byte	0x34
+	.byte	0xa
+	.long	0x172d
+	.uleb128 0x6
+	.long	0x1cec
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x6
+	.long	0x1ce2
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x6
+	.long	0x1cd8
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xc
+	.long	.LLRL12
+	.uleb128 0x7
+	.long	0x1cf6
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x7
+	.long	0x1d01
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x7
+	.long	0x1d0c
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xa
+	.quad	.LVL13
+	.long	0x817
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL11
+	.long	0x7fb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF163
+	.byte	0x2d
+	.long	0x72
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1863
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x2d
+	.byte	0x23
+	.long	0x54
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0xf
+	.long	.LASF149
+	.byte	0x2d
+	.byte	0x45
+	.long	0x67c
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x15
+	.long	0x1cc7
+	.quad	.LBI80
+	.byte	.LVU206
+	.long	.LLRL70
+	.byte	0x2e
+	.uleb128 0x6
+	.long	0x1cec
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x6
+	.long	0x1ce2
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x6
+	.long	0x1cd8
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0xc
+	.long	.LLRL70
+	.uleb128 0x7
+	.long	0x1cf6
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x7
+	.long	0x1d01
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x7
+	.long	0x1d0c
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x2
+	.quad	.LVL67
+	.long	0x817
+	.long	0x1832
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL73
+	.long	0x817
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF164
+	.byte	0x29
+	.long	0x72
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x197b
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x29
+	.byte	0x20
+	.long	0x54
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x2c
+	.string	"key"
+	.byte	0x29
+	.byte	0x42
+	.long	0x67c
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x15
+	.long	0x1cc7
+	.quad	.LBI68
+	.byte	.LVU180
+	.long	.LLRL61
+	.byte	0x2a
+	.uleb128 0x6
+	.long	0x1cec
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x6
+	.long	0x1ce2
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x6
+	.long	0x1cd8
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0xc
+	.long	.LLRL61
+	.uleb128 0x7
+	.long	0x1cf6
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x7
+	.long	0x1d01
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x7
+	.long	0x1d0c
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x2
+	.quad	.LVL56
+	.long	0x817
+	.long	0x194a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL62
+	.long	0x817
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF165
+	.byte	0x25
+	.long	0x72
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a4e
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x25
+	.byte	0x26
+	.long	0x54
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x15
+	.long	0x1cc7
+	.quad	.LBI58
+	.byte	.LVU155
+	.long	.LLRL52
+	.byte	0x26
+	.uleb128 0x6
+	.long	0x1cec
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x6
+	.long	0x1ce2
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x6
+	.long	0x1cd8
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0xc
+	.long	.LLRL52
+	.uleb128 0x7
+	.long	0x1cf6
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x7
+	.long	0x1d01
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x7
+	.long	0x1d0c
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0xa
+	.quad	.LVL48
+	.long	0x817
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF166
+	.byte	0x21
+	.long	0x72
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b21
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x21
+	.byte	0x28
+	.long	0x54
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x15
+	.long	0x1cc7
+	.quad	.LBI48
+	.byte	.LVU130
+	.long	.LLRL44
+	.byte	0x22
+	.uleb128 0x6
+	.long	0x1cec
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x6
+	.long	0x1ce2
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x6
+	.long	0x1cd8
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0xc
+	.long	.LLRL44
+	.uleb128 0x7
+	.long	0x1cf6
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x7
+	.long	0x1d01
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x7
+	.long	0x1d0c
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0xa
+	.quad	.LVL41
+	.long	0x817
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF167
+	.byte	0x1d
+	.long	0x72
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1bf4
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x1d
+	.byte	0x27
+	.long	0x54
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x15
+	.long	0x1cc7
+	.quad	.LBI38
+	.byte	.LVU105
+	.long	.LLRL36
+	.byte	0x1e
+	.uleb128 0x6
+	.long	0x1cec
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x6
+	.long	0x1ce2
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x6
+	.long	0x1cd8
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0xc
+	.long	.LLRL36
+	.uleb128 0x7
+	.long	0x1cf6
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x7
+	.long	0x1d01
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x7
+	.long	0x1d0c
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0xa
+	.quad	.LVL34
+	.long	0x817
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF168
+	.byte	0x19
+	.long	0x72
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cc7
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x19
+	.byte	0x29
+	.long	0x54
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x15
+	.long	0x1cc7
+	.quad	.LBI28
+	.byte	.LVU80
+	.long	.LLRL28
+	.byte	0x1a
+	.uleb128 0x6
+	.long	0x1cec
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x6
+	.long	0x1ce2
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x6
+	.long	0x1cd8
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0xc
+	.long	.LLRL28
+	.uleb128 0x7
+	.long	0x1cf6
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x7
+	.long	0x1d01
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x7
+	.long	0x1d0c
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xa
+	.quad	.LVL27
+	.long	0x817
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF181
+	.byte	0x1
+	.byte	0x11
+	.byte	0xc
+	.long	0x72
+	.byte	0x1
+	.long	0x1d18
+	.uleb128 0x23
+	.long	.LASF72
+	.byte	0x22
+	.long	0x54
+	.uleb128 0x23
+	.long	.LASF169
+	.byte	0x37
+	.long	0x2dd
+	.uleb128 0x23
+	.long	.LASF153
+	.byte	0x57
+	.long	0x67c
+	.uleb128 0x1f
+	.long	.LASF158
+	.byte	0x12
+	.byte	0x1a
+	.long	0x1d18
+	.uleb128 0x1f
+	.long	.LASF170
+	.byte	0x13
+	.byte	0xa
+	.long	0x35
+	.uleb128 0x1f
+	.long	.LASF171
+	.byte	0x14
+	.byte	0x7
+	.long	0x72
+	.byte	0
+	.uleb128 0x8
+	.long	0x6d1
+	.uleb128 0x39
+	.uleb128 0x69
+	.byte	0x9e
+	.uleb128 0x67
+	.byte	0x7b
+	.byte	0x22
+	.byte	0x73
+	.byte	0x6b
+	.byte	0x69
+	.byte	0x70
+	.byte	0x22
+	.byte	0x3a
+	.byte	0x20
+	.byte	0x7b
+	.byte	0x22
+	.byte	0x61
+	.byte	0x22
+	.byte	0x3a
+	.byte	0x20
+	.byte	0x5b
+	.byte	0x31
+	.byte	0x2c
+	.byte	0x20
+	.byte	0x7b
+	.byte	0x22
+	.byte	0x69
+	.byte	0x64
+	.byte	0x22
+	.byte	0x3a
+	.byte	0x20
+	.byte	0x30
+	.byte	0x7d
+	.byte	0x5d
+	.byte	0x2c
+	.byte	0x20
+	.byte	0x22
+	.byte	0x73
+	.byte	0x22
+	.byte	0x3a
+	.byte	0x20
+	.byte	0x22
+	.byte	0x7d
+	.byte	0x5d
+	.byte	0x5c
+	.byte	0x22
+	.byte	0x22
+	.byte	0x7d
+	.byte	0x2c
+	.byte	0x20
+	.byte	0x22
+	.byte	0x6c
+	.byte	0x69
+	.byte	0x73
+	.byte	0x74
+	.byte	0x22
+	.byte	0x3a
+	.byte	0x20
+	.byte	0x5b
+	.byte	0x5b
+	.byte	0x5d
+	.byte	0x2c
+	.byte	0x20
+	.byte	0x22
+	.byte	0x69
+	.byte	0x64
+	.byte	0x22
+	.byte	0x5d
+	.byte	0x2c
+	.byte	0x20
+	.byte	0x22
+	.byte	0x6e
+	.byte	0x22
+	.byte	0x3a
+	.byte	0x20
+	.byte	0x2d
+	.byte	0x31
+	.byte	0x2e
+	.byte	0x35
+	.byte	0x65
+	.byte	0x32
+	.byte	0x20
+	.byte	0x2c
+	.byte	0x22
+	.byte	0x69
+	.byte	0x64
+	.byte	0x22
+	.byte	0x3a
+	.byte	0x20
+	.byte	0x22
+	.byte	0x78
+	.byte	0x22
+	.byte	0x2c
+	.byte	0x20
+	.byte	0x22
+	.byte	0x6c
+	.byte	0x61
+	.byte	0x73
+	.byte	0x74
+	.byte	0x22
+	.byte	0x3a
+	.byte	0x20
+	.byte	0x74
+	.byte	0x72
+	.byte	0x75
+	.byte	0x65
+	.byte	0x7d
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF172
+	.long	.LASF174
+	.uleb128 0x24
+	.long	.LASF173
+	.long	.LASF175
+	.uleb128 0x24
+	.long	.LASF176
+	.long	.LASF177
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 10
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x36
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS91:
+	.uleb128 .LVU426
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 .LVU445
+	.uleb128 .LVU450
+	.uleb128 .LVU462
+	.uleb128 .LVU463
+	.uleb128 .LVU473
+	.uleb128 .LVU476
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU528
+	.uleb128 .LVU528
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU540
+	.uleb128 .LVU540
+	.uleb128 .LVU542
+	.uleb128 .LVU542
+	.uleb128 .LVU543
+	.uleb128 .LVU543
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 .LVU545
+	.uleb128 .LVU547
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 .LVU560
+	.uleb128 .LVU563
+	.uleb128 .LVU583
+	.uleb128 .LVU590
+	.uleb128 0
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 92
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 92
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 92
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 92
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 92
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 92
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -76
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x184
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x184
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 92
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 92
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 92
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 92
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU428
+	.uleb128 .LVU432
+	.uleb128 .LVU477
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU487
+	.uleb128 .LVU595
+	.uleb128 .LVU596
+	.uleb128 .LVU613
+	.uleb128 .LVU614
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU435
+	.uleb128 .LVU447
+	.uleb128 .LVU563
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU576
+	.uleb128 .LVU590
+	.uleb128 .LVU596
+	.uleb128 .LVU604
+	.uleb128 .LVU614
+	.uleb128 .LVU615
+	.uleb128 0
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL201-1-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU436
+	.uleb128 .LVU440
+	.uleb128 .LVU440
+	.uleb128 .LVU445
+	.uleb128 .LVU445
+	.uleb128 .LVU474
+	.uleb128 .LVU544
+	.uleb128 .LVU563
+	.uleb128 .LVU563
+	.uleb128 .LVU571
+	.uleb128 .LVU571
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU592
+	.uleb128 .LVU592
+	.uleb128 .LVU596
+	.uleb128 .LVU604
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 0
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL209-1-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU444
+	.uleb128 .LVU450
+	.uleb128 .LVU450
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU468
+	.uleb128 .LVU544
+	.uleb128 .LVU563
+	.uleb128 .LVU573
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU596
+	.uleb128 .LVU608
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU615
+	.uleb128 .LVU618
+	.uleb128 0
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU452
+	.uleb128 .LVU460
+	.uleb128 .LVU544
+	.uleb128 .LVU545
+	.uleb128 .LVU549
+	.uleb128 .LVU550
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL192-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU554
+	.uleb128 .LVU556
+	.uleb128 .LVU556
+	.uleb128 .LVU560
+	.uleb128 .LVU576
+	.uleb128 .LVU583
+	.uleb128 .LVU614
+	.uleb128 .LVU615
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL194-1-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU484
+	.uleb128 .LVU512
+	.uleb128 .LVU512
+	.uleb128 .LVU535
+	.uleb128 .LVU535
+	.uleb128 .LVU544
+	.uleb128 .LVU596
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU604
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU485
+	.uleb128 .LVU487
+	.uleb128 .LVU513
+	.uleb128 .LVU514
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU491
+	.uleb128 .LVU494
+	.uleb128 .LVU494
+	.uleb128 .LVU518
+	.uleb128 .LVU518
+	.uleb128 .LVU520
+	.uleb128 .LVU520
+	.uleb128 .LVU541
+	.uleb128 .LVU596
+	.uleb128 .LVU604
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL163-1-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU494
+	.uleb128 .LVU499
+	.uleb128 .LVU522
+	.uleb128 .LVU526
+	.uleb128 .LVU596
+	.uleb128 .LVU598
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU496
+	.uleb128 .LVU499
+	.uleb128 .LVU499
+	.uleb128 .LVU514
+	.uleb128 .LVU524
+	.uleb128 .LVU526
+	.uleb128 .LVU596
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU604
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 72
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL211-1-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 72
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU357
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU359
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU369
+	.uleb128 .LVU370
+	.uleb128 .LVU387
+	.uleb128 .LVU387
+	.uleb128 .LVU393
+	.uleb128 .LVU399
+	.uleb128 0
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU362
+	.uleb128 .LVU363
+	.uleb128 .LVU381
+	.uleb128 .LVU383
+	.uleb128 .LVU383
+	.uleb128 .LVU385
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU255
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 .LVU330
+	.uleb128 .LVU330
+	.uleb128 0
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2dc
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2dc
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU257
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU311
+	.uleb128 .LVU311
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 .LVU330
+	.uleb128 .LVU330
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0xb
+	.byte	0x72
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0xc
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0xd
+	.byte	0x72
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0xe
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0xc
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0xe
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x18
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2d0
+	.byte	0x1c
+	.byte	0x6
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x240
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x18
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2d0
+	.byte	0x1c
+	.byte	0x6
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x240
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0xc
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU259
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU280
+	.uleb128 .LVU295
+	.uleb128 .LVU297
+	.uleb128 .LVU298
+	.uleb128 .LVU307
+	.uleb128 .LVU309
+	.uleb128 .LVU314
+	.uleb128 .LVU323
+	.uleb128 .LVU328
+	.uleb128 .LVU330
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU269
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 .LVU282
+	.uleb128 .LVU298
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU307
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU270
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 .LVU281
+	.uleb128 .LVU281
+	.uleb128 .LVU282
+	.uleb128 .LVU298
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU307
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU282
+	.uleb128 .LVU287
+	.uleb128 .LVU307
+	.uleb128 .LVU309
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+	.uleb128 .LVU320
+	.uleb128 .LVU323
+	.uleb128 .LVU330
+	.uleb128 0
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU56
+	.uleb128 .LVU75
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU55
+	.uleb128 .LVU75
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC5
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU55
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU75
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU57
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU67
+	.uleb128 .LVU75
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU70
+	.uleb128 .LVU73
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU10
+	.uleb128 .LVU25
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU9
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU25
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x20
+	.byte	0x3
+	.quad	.LC1
+	.byte	0x3
+	.quad	.LC0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU9
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU25
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU11
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU16
+	.uleb128 .LVU25
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU20
+	.uleb128 .LVU23
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU37
+	.uleb128 .LVU50
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+5751
+	.sleb128 0
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU37
+	.uleb128 .LVU50
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU37
+	.uleb128 .LVU50
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU39
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU43
+	.uleb128 .LVU50
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU45
+	.uleb128 .LVU48
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU206
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU225
+	.uleb128 .LVU228
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 0
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU206
+	.uleb128 .LVU225
+	.uleb128 .LVU228
+	.uleb128 0
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC11
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC11
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU206
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU225
+	.uleb128 .LVU228
+	.uleb128 0
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU208
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 0
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU213
+	.uleb128 .LVU225
+	.uleb128 .LVU228
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU220
+	.uleb128 .LVU223
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU180
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU199
+	.uleb128 .LVU202
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU180
+	.uleb128 .LVU199
+	.uleb128 .LVU202
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC10
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC10
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU180
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU199
+	.uleb128 .LVU202
+	.uleb128 0
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU182
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU187
+	.uleb128 .LVU199
+	.uleb128 .LVU202
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU194
+	.uleb128 .LVU197
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS51:
+	.uleb128 0
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU156
+	.uleb128 .LVU175
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU155
+	.uleb128 .LVU175
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU155
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU175
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU157
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU167
+	.uleb128 .LVU175
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU170
+	.uleb128 .LVU173
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU131
+	.uleb128 .LVU150
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU130
+	.uleb128 .LVU150
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC8
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU130
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU150
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU132
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU142
+	.uleb128 .LVU150
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU145
+	.uleb128 .LVU148
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU106
+	.uleb128 .LVU125
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU105
+	.uleb128 .LVU125
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC7
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU105
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU125
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU107
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU117
+	.uleb128 .LVU125
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU120
+	.uleb128 .LVU123
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU81
+	.uleb128 .LVU100
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU80
+	.uleb128 .LVU100
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC6
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU80
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU100
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU82
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU92
+	.uleb128 .LVU100
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU95
+	.uleb128 .LVU98
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0
+.LLRL61:
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0
+.LLRL78:
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0
+.LLRL80:
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0
+.LLRL82:
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB93-.Ltext0
+	.uleb128 .LBE93-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0
+.LLRL89:
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB103-.Ltext0
+	.uleb128 .LBE103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0
+.LLRL92:
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB132-.Ltext0
+	.uleb128 .LBE132-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB133-.Ltext0
+	.uleb128 .LBE133-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB128-.Ltext0
+	.uleb128 .LBE128-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB129-.Ltext0
+	.uleb128 .LBE129-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB130-.Ltext0
+	.uleb128 .LBE130-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB131-.Ltext0
+	.uleb128 .LBE131-.Ltext0
+	.byte	0
+.LLRL97:
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB116-.Ltext0
+	.uleb128 .LBE116-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB119-.Ltext0
+	.uleb128 .LBE119-.Ltext0
+	.byte	0
+.LLRL101:
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0
+.LLRL103:
+	.byte	0x4
+	.uleb128 .LBB134-.Ltext0
+	.uleb128 .LBE134-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0
+.LLRL105:
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0
+.LLRL107:
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB139-.Ltext0
+	.uleb128 .LBE139-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF168:
+	.string	"json_test_start_object"
+.LASF69:
+	.string	"conversion_ns"
+.LASF35:
+	.string	"_shortbuf"
+.LASF179:
+	.string	"_IO_lock_t"
+.LASF133:
+	.string	"strlen"
+.LASF74:
+	.string	"capacity"
+.LASF24:
+	.string	"_IO_buf_end"
+.LASF106:
+	.string	"start_array"
+.LASF55:
+	.string	"StringArena"
+.LASF112:
+	.string	"buffer"
+.LASF22:
+	.string	"_IO_write_end"
+.LASF4:
+	.string	"unsigned int"
+.LASF89:
+	.string	"incremental_factor"
+.LASF40:
+	.string	"_freeres_list"
+.LASF16:
+	.string	"_flags"
+.LASF56:
+	.string	"head"
+.LASF104:
+	.string	"start_object"
+.LASF158:
+	.string	"events"
+.LASF78:
+	.string	"ST_GROWTH_LINEAR"
+.LASF85:
+	.string	"StringTokenizer"
+.LASF163:
+	.string	"json_test_string"
+.LASF141:
+	.string	"num_tests"
+.LASF32:
+	.string	"_old_offset"
+.LASF28:
+	.string	"_markers"
+.LASF82:
+	.string	"ST_STRING_OWNED"
+.LASF137:
+	.string	"json_test_handler"
+.LASF76:
+	.string	"error"
+.LASF138:
+	.string	"document"
+.LASF145:
+	.string	"mode"
+.LASF173:
+	.string	"putchar"
+.LASF131:
+	.string	"fputs"
+.LASF73:
+	.string	"chunk_size"
+.LASF148:
+	.string	"found"
+.LASF160:
+	.string	"json_test_null"
+.LASF134:
+	.string	"strcpy"
+.LASF27:
+	.string	"_IO_save_end"
+.LASF169:
+	.string	"event"
+.LASF47:
+	.string	"_IO_codecvt"
+.LASF100:
+	.string	"count"
+.LASF51:
+	.string	"long long unsigned int"
+.LASF146:
+	.string	"file"
+.LASF111:
+	.string	"JsonTestEvents"
+.LASF116:
+	.string	"st_ensure"
+.LASF113:
+	.string	"st_current_token"
+.LASF26:
+	.string	"_IO_backup_base"
+.LASF37:
+	.string	"_offset"
+.LASF83:
+	.string	"ST_STRING_MAPPED"
+.LASF94:
+	.string	"arena"
+.LASF149:
+	.string	"value"
+.LASF30:
+	.string	"_fileno"
+.LASF58:
+	.string	"used"
+.LASF165:
+	.string	"json_test_end_array"
+.LASF172:
+	.string	"puts"
+.LASF154:
+	.string	"unescaped"
+.LASF10:
+	.string	"size_t"
+.LASF75:
+	.string	"offset"
+.LASF64:
+	.string	"allocations"
+.LASF19:
+	.string	"_IO_read_base"
+.LASF140:
+	.string	"expected_values"
+.LASF91:
+	.string	"max_increment"
+.LASF59:
+	.string	"StringArenaBlock"
+.LASF11:
+	.string	"__uint64_t"
+.LASF126:
+	.string	"strcmp"
+.LASF86:
+	.string	"string"
+.LASF151:
+	.string	"run_st_json_unescape_unit_tests"
+.LASF181:
+	.string	"json_test_event"
+.LASF176:
+	.string	"stpcpy"
+.LASF144:
+	.string	"exit_status"
+.LASF15:
+	.string	"char"
+.LASF43:
+	.string	"_mode"
+.LASF46:
+	.string	"_IO_marker"
+.LASF127:
+	.string	"st_json_parse"
+.LASF17:
+	.string	"_IO_read_ptr"
+.LASF49:
+	.string	"ssize_t"
+.LASF93:
+	.string	"ownership"
+.LASF147:
+	.string	"tokenizer"
+.LASF77:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF98:
+	.string	"StringStructuralIndex"
+.LASF109:
+	.string	"boolean"
+.LASF161:
+	.string	"json_test_boolean"
+.LASF20:
+	.string	"_IO_write_base"
+.LASF122:
+	.string	"dtos_to"
+.LASF50:
+	.string	"long long int"
+.LASF125:
+	.string	"printf"
+.LASF25:
+	.string	"_IO_save_base"
+.LASF166:
+	.string	"json_test_start_array"
+.LASF72:
+	.string	"context"
+.LASF68:
+	.string	"conversions"
+.LASF155:
+	.string	"run_st_json_parse_unit_tests"
+.LASF162:
+	.string	"json_test_number"
+.LASF128:
+	.string	"st_create_from_file"
+.LASF102:
+	.string	"hint"
+.LASF123:
+	.string	"snprintf"
+.LASF170:
+	.string	"size"
+.LASF41:
+	.string	"_freeres_buf"
+.LASF42:
+	.string	"__pad5"
+.LASF177:
+	.string	"__builtin_stpcpy"
+.LASF175:
+	.string	"__builtin_putchar"
+.LASF65:
+	.string	"reallocations"
+.LASF143:
+	.string	"missing_values"
+.LASF34:
+	.string	"_vtable_offset"
+.LASF130:
+	.string	"rewind"
+.LASF129:
+	.string	"st_destroy"
+.LASF159:
+	.string	"parsed"
+.LASF81:
+	.string	"ST_STRING_BORROWED"
+.LASF139:
+	.string	"key_values"
+.LASF60:
+	.string	"long double"
+.LASF174:
+	.string	"__builtin_puts"
+.LASF110:
+	.string	"null"
+.LASF167:
+	.string	"json_test_end_object"
+.LASF61:
+	.string	"StringStats"
+.LASF99:
+	.string	"positions"
+.LASF132:
+	.string	"st_create_n"
+.LASF18:
+	.string	"_IO_read_end"
+.LASF142:
+	.string	"mode_names"
+.LASF62:
+	.string	"bytes_scanned"
+.LASF8:
+	.string	"short int"
+.LASF9:
+	.string	"long int"
+.LASF87:
+	.string	"length"
+.LASF120:
+	.string	"st_json_unescape"
+.LASF63:
+	.string	"tokens_extracted"
+.LASF48:
+	.string	"_IO_wide_data"
+.LASF52:
+	.string	"uint64_t"
+.LASF79:
+	.string	"StringGrowthPolicy"
+.LASF124:
+	.string	"fclose"
+.LASF57:
+	.string	"block_size"
+.LASF2:
+	.string	"double"
+.LASF135:
+	.string	"run_json_parser_tests"
+.LASF14:
+	.string	"__ssize_t"
+.LASF164:
+	.string	"json_test_key"
+.LASF108:
+	.string	"number"
+.LASF80:
+	.string	"StringOwnership"
+.LASF71:
+	.string	"read"
+.LASF150:
+	.string	"start"
+.LASF121:
+	.string	"sv_from_string"
+.LASF39:
+	.string	"_wide_data"
+.LASF36:
+	.string	"_lock"
+.LASF3:
+	.string	"long unsigned int"
+.LASF178:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF53:
+	.string	"_IO_FILE"
+.LASF119:
+	.string	"st_create"
+.LASF96:
+	.string	"structural_index"
+.LASF84:
+	.string	"ST_STRING_INLINE"
+.LASF5:
+	.string	"unsigned char"
+.LASF95:
+	.string	"inline_buffer"
+.LASF180:
+	.string	"tmpfile"
+.LASF54:
+	.string	"StringView"
+.LASF21:
+	.string	"_IO_write_ptr"
+.LASF70:
+	.string	"StringStream"
+.LASF107:
+	.string	"end_array"
+.LASF66:
+	.string	"expansions"
+.LASF156:
+	.string	"document_values"
+.LASF38:
+	.string	"_codecvt"
+.LASF97:
+	.string	"stats"
+.LASF12:
+	.string	"__off_t"
+.LASF103:
+	.string	"JsonHandler"
+.LASF7:
+	.string	"signed char"
+.LASF136:
+	.string	"run_st_find_key_unit_tests"
+.LASF157:
+	.string	"streaming"
+.LASF6:
+	.string	"short unsigned int"
+.LASF114:
+	.string	"memcpy"
+.LASF115:
+	.string	"st_skip_value"
+.LASF153:
+	.string	"view"
+.LASF105:
+	.string	"end_object"
+.LASF90:
+	.string	"growth_policy"
+.LASF171:
+	.string	"written"
+.LASF118:
+	.string	"st_build_structural_index"
+.LASF29:
+	.string	"_chain"
+.LASF101:
+	.string	"in_string"
+.LASF152:
+	.string	"escaped_values"
+.LASF45:
+	.string	"FILE"
+.LASF31:
+	.string	"_flags2"
+.LASF67:
+	.string	"bytes_copied"
+.LASF33:
+	.string	"_cur_column"
+.LASF117:
+	.string	"st_find_key"
+.LASF88:
+	.string	"position"
+.LASF13:
+	.string	"__off64_t"
+.LASF44:
+	.string	"_unused2"
+.LASF23:
+	.string	"_IO_buf_base"
+.LASF92:
+	.string	"stream"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/tests/json_parser_unit_tests.c"
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
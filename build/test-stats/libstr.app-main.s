@@ -0,0 +1,647 @@
+	.file	"main.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/tests/main.c"
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/tests/main.c"
+	.loc 1 27 40 view -0
+	.cfi_startproc
+	.loc 1 28 3 view .LVU1
+	.loc 1 27 40 is_stmt 0 view .LVU2
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 28 7 view .LVU3
+	xorl	%eax, %eax
+	call	run_numeric_string_tests@PLT
+.LVL1:
+	.loc 1 28 6 view .LVU4
+	cmpl	$1, %eax
+	je	.L4
+	.loc 1 32 3 is_stmt 1 view .LVU5
+	.loc 1 32 7 is_stmt 0 view .LVU6
+	xorl	%eax, %eax
+	call	run_string_view_tests@PLT
+.LVL2:
+	.loc 1 32 6 view .LVU7
+	decl	%eax
+	je	.L4
+	.loc 1 36 3 is_stmt 1 view .LVU8
+	.loc 1 36 7 is_stmt 0 view .LVU9
+	xorl	%eax, %eax
+	call	run_string_scan_tests@PLT
+.LVL3:
+	.loc 1 36 6 view .LVU10
+	decl	%eax
+	je	.L4
+	.loc 1 40 3 is_stmt 1 view .LVU11
+	.loc 1 40 7 is_stmt 0 view .LVU12
+	xorl	%eax, %eax
+	call	run_string_tokenizer_tests@PLT
+.LVL4:
+	.loc 1 40 6 view .LVU13
+	decl	%eax
+	je	.L4
+	.loc 1 44 3 is_stmt 1 view .LVU14
+	.loc 1 44 7 is_stmt 0 view .LVU15
+	xorl	%eax, %eax
+	call	run_string_arena_tests@PLT
+.LVL5:
+	.loc 1 44 6 view .LVU16
+	decl	%eax
+	je	.L4
+	.loc 1 48 3 is_stmt 1 view .LVU17
+	.loc 1 48 7 is_stmt 0 view .LVU18
+	xorl	%eax, %eax
+	call	run_json_parser_tests@PLT
+.LVL6:
+	.loc 1 48 6 view .LVU19
+	decl	%eax
+	je	.L4
+	.loc 1 52 3 is_stmt 1 view .LVU20
+	.loc 1 52 7 is_stmt 0 view .LVU21
+	xorl	%eax, %eax
+	call	run_structural_index_tests@PLT
+.LVL7:
+	.loc 1 52 6 view .LVU22
+	decl	%eax
+	je	.L4
+	.loc 1 56 3 is_stmt 1 view .LVU23
+	.loc 1 56 7 is_stmt 0 view .LVU24
+	xorl	%eax, %eax
+	call	run_parallel_tests@PLT
+.LVL8:
+	.loc 1 56 6 view .LVU25
+	decl	%eax
+	je	.L4
+	.loc 1 60 3 is_stmt 1 view .LVU26
+	.loc 1 60 7 is_stmt 0 view .LVU27
+	xorl	%eax, %eax
+	call	run_string_output_tests@PLT
+.LVL9:
+	.loc 1 60 6 view .LVU28
+	decl	%eax
+	je	.L4
+	.loc 1 64 3 is_stmt 1 view .LVU29
+	.loc 1 64 7 is_stmt 0 view .LVU30
+	xorl	%eax, %eax
+	call	run_string_stats_tests@PLT
+.LVL10:
+	.loc 1 64 6 view .LVU31
+	decl	%eax
+	je	.L4
+	.loc 1 68 3 is_stmt 1 view .LVU32
+	.loc 1 68 7 is_stmt 0 view .LVU33
+	xorl	%eax, %eax
+	call	run_char_class_tests@PLT
+.LVL11:
+	.loc 1 68 6 view .LVU34
+	decl	%eax
+	sete	%al
+	movzbl	%al, %eax
+	jmp	.L1
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 1 30 11 view .LVU35
+	movl	$1, %eax
+.L1:
+	.loc 1 74 1 view .LVU36
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	main, .-main
+	.text
+.Letext0:
+	.file 2 "/root/repo/tests/char_class_unit_tests.h"
+	.file 3 "/root/repo/tests/string_stats_unit_tests.h"
+	.file 4 "/root/repo/tests/string_output_unit_tests.h"
+	.file 5 "/root/repo/tests/parallel_unit_tests.h"
+	.file 6 "/root/repo/tests/structural_index_unit_tests.h"
+	.file 7 "/root/repo/tests/json_parser_unit_tests.h"
+	.file 8 "/root/repo/tests/string_arena_unit_tests.h"
+	.file 9 "/root/repo/tests/string_tokenizer_unit_tests.h"
+	.file 10 "/root/repo/tests/string_scan_unit_tests.h"
+	.file 11 "/root/repo/tests/string_view_unit_tests.h"
+	.file 12 "/root/repo/tests/numeric_string_unit_tests.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x217
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x7
+	.long	.LASF27
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL2
+	.quad	0
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x9
+	.long	0x69
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x5
+	.long	0x70
+	.uleb128 0x1
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF12
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x2
+	.long	.LASF14
+	.byte	0x2
+	.long	0x31
+	.long	0x9f
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF15
+	.byte	0x3
+	.long	0x31
+	.long	0xaf
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF16
+	.byte	0x4
+	.long	0x31
+	.long	0xbf
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF17
+	.byte	0x5
+	.long	0x31
+	.long	0xcf
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF18
+	.byte	0x6
+	.long	0x31
+	.long	0xdf
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF19
+	.byte	0x7
+	.long	0x31
+	.long	0xef
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF20
+	.byte	0x8
+	.long	0x31
+	.long	0xff
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF21
+	.byte	0x9
+	.long	0x31
+	.long	0x10f
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF22
+	.byte	0xa
+	.long	0x31
+	.long	0x11f
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF23
+	.byte	0xb
+	.long	0x31
+	.long	0x12f
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF24
+	.byte	0xc
+	.long	0x31
+	.long	0x13f
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x1b
+	.byte	0x5
+	.long	0x31
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x215
+	.uleb128 0x6
+	.long	.LASF25
+	.byte	0xe
+	.long	0x31
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x6
+	.long	.LASF26
+	.byte	0x20
+	.long	0x215
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x4
+	.quad	.LVL1
+	.long	0x12f
+	.uleb128 0x4
+	.quad	.LVL2
+	.long	0x11f
+	.uleb128 0x4
+	.quad	.LVL3
+	.long	0x10f
+	.uleb128 0x4
+	.quad	.LVL4
+	.long	0xff
+	.uleb128 0x4
+	.quad	.LVL5
+	.long	0xef
+	.uleb128 0x4
+	.quad	.LVL6
+	.long	0xdf
+	.uleb128 0x4
+	.quad	.LVL7
+	.long	0xcf
+	.uleb128 0x4
+	.quad	.LVL8
+	.long	0xbf
+	.uleb128 0x4
+	.quad	.LVL9
+	.long	0xaf
+	.uleb128 0x4
+	.quad	.LVL10
+	.long	0x9f
+	.uleb128 0x4
+	.quad	.LVL11
+	.long	0x8f
+	.byte	0
+	.uleb128 0x5
+	.long	0x7c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 .LFE26-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 .LFE26-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x7
+	.quad	.LFB26
+	.uleb128 .LFE26-.LFB26
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF18:
+	.string	"run_structural_index_tests"
+.LASF15:
+	.string	"run_string_stats_tests"
+.LASF23:
+	.string	"run_string_view_tests"
+.LASF7:
+	.string	"unsigned int"
+.LASF20:
+	.string	"run_string_arena_tests"
+.LASF28:
+	.string	"main"
+.LASF2:
+	.string	"long unsigned int"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF14:
+	.string	"run_char_class_tests"
+.LASF19:
+	.string	"run_json_parser_tests"
+.LASF17:
+	.string	"run_parallel_tests"
+.LASF16:
+	.string	"run_string_output_tests"
+.LASF21:
+	.string	"run_string_tokenizer_tests"
+.LASF5:
+	.string	"unsigned char"
+.LASF10:
+	.string	"char"
+.LASF3:
+	.string	"long int"
+.LASF13:
+	.string	"double"
+.LASF4:
+	.string	"long long int"
+.LASF25:
+	.string	"argc"
+.LASF6:
+	.string	"short unsigned int"
+.LASF8:
+	.string	"signed char"
+.LASF22:
+	.string	"run_string_scan_tests"
+.LASF24:
+	.string	"run_numeric_string_tests"
+.LASF12:
+	.string	"long double"
+.LASF9:
+	.string	"short int"
+.LASF27:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF26:
+	.string	"argv"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+.LASF0:
+	.string	"/root/repo/tests/main.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
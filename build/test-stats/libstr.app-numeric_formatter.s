@@ -0,0 +1,14154 @@
+	.file	"numeric_formatter.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/src/numeric_formatter.c"
+	.p2align 4
+	.type	numeric_formatter_shortest, @function
+numeric_formatter_shortest:
+.LVL0:
+.LFB32:
+	.file 1 "/root/repo/src/numeric_formatter.c"
+	.loc 1 816 126 view -0
+	.cfi_startproc
+	.loc 1 817 3 view .LVU1
+	.loc 1 818 3 view .LVU2
+	.loc 1 819 3 view .LVU3
+	.loc 1 816 126 is_stmt 0 view .LVU4
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	.loc 1 816 126 view .LVU5
+	movq	%rdi, %rbx
+	.loc 1 827 33 view .LVU6
+	andl	$1, %edi
+.LVL1:
+	.loc 1 827 33 view .LVU7
+	movq	%rdi, -24(%rsp)
+	.loc 1 819 6 view .LVU8
+	testl	%esi, %esi
+	jne	.L2
+.LVL2:
+	.loc 1 827 3 is_stmt 1 view .LVU9
+	.loc 1 829 3 view .LVU10
+	.loc 1 829 18 is_stmt 0 view .LVU11
+	leaq	0(,%rbx,4), %r11
+.LVL3:
+	.loc 1 830 3 is_stmt 1 view .LVU12
+	.loc 1 832 3 view .LVU13
+	.loc 1 833 3 view .LVU14
+	.loc 1 834 3 view .LVU15
+	.loc 1 835 3 view .LVU16
+	.loc 1 836 3 view .LVU17
+	leaq	2(%r11), %rsi
+.LVL4:
+	.loc 1 836 3 is_stmt 0 view .LVU18
+	movq	%rsi, -40(%rsp)
+	leaq	-1(%r11), %rsi
+	.loc 1 829 18 view .LVU19
+	movl	$-325, -44(%rsp)
+	movq	%rsi, -32(%rsp)
+	movl	$57, %ecx
+	movl	$1, %r14d
+	movl	$5200, %eax
+	movl	$751, %ebp
+	.loc 1 830 48 view .LVU20
+	movl	$1, %edi
+.LVL5:
+.L3:
+.LBB33:
+	.loc 1 858 5 is_stmt 1 view .LVU21
+.LBB34:
+.LBI34:
+	.loc 1 747 24 view .LVU22
+.LBB35:
+	.loc 1 748 3 view .LVU23
+	.loc 1 748 3 is_stmt 0 view .LVU24
+.LBE35:
+.LBE34:
+	.loc 1 859 5 is_stmt 1 view .LVU25
+	.loc 1 860 5 view .LVU26
+	.loc 1 861 5 view .LVU27
+.LBB38:
+.LBI38:
+	.loc 1 733 23 view .LVU28
+.LBB39:
+	.loc 1 734 3 view .LVU29
+	.loc 1 734 3 is_stmt 0 view .LVU30
+.LBE39:
+.LBE38:
+	.loc 1 862 5 is_stmt 1 view .LVU31
+	.loc 1 863 5 view .LVU32
+	.loc 1 863 74 is_stmt 0 view .LVU33
+	leaq	numeric_formatter_pow5_split(%rip), %rdx
+	addq	%rdx, %rax
+.LVL6:
+.LBB42:
+.LBI42:
+	.loc 1 773 24 is_stmt 1 view .LVU34
+.LBB43:
+	.loc 1 775 17 view .LVU35
+	.loc 1 776 3 view .LVU36
+	.loc 1 776 38 is_stmt 0 view .LVU37
+	movq	(%rax), %rsi
+.LVL7:
+	.loc 1 777 3 is_stmt 1 view .LVU38
+	.loc 1 777 38 is_stmt 0 view .LVU39
+	movq	8(%rax), %r15
+.LVL8:
+	.loc 1 778 3 is_stmt 1 view .LVU40
+	.loc 1 777 17 is_stmt 0 view .LVU41
+	movq	%r11, %rdx
+	.loc 1 778 26 view .LVU42
+	movq	%rsi, %rax
+.LVL9:
+	.loc 1 777 17 view .LVU43
+	mulx	%r15, %r12, %r13
+	.loc 1 778 26 view .LVU44
+	mulq	%r11
+	xorl	%r9d, %r9d
+	movq	%rdx, %r8
+	.loc 1 778 33 view .LVU45
+	addq	%r12, %r8
+.LBE43:
+.LBE42:
+.LBB49:
+.LBB50:
+	.loc 1 777 17 view .LVU46
+	movq	-40(%rsp), %rdx
+.LBE50:
+.LBE49:
+.LBB57:
+.LBB44:
+	.loc 1 778 33 view .LVU47
+	adcq	%r13, %r9
+	.loc 1 778 39 view .LVU48
+	shrdq	%r9, %r8
+.LBE44:
+.LBE57:
+.LBB58:
+.LBB51:
+	.loc 1 778 26 view .LVU49
+	movq	%rdx, %rax
+.LBE51:
+.LBE58:
+.LBB59:
+.LBB45:
+	.loc 1 778 39 view .LVU50
+	testb	$64, %cl
+.LBE45:
+.LBE59:
+.LBB60:
+.LBB52:
+	.loc 1 777 17 view .LVU51
+	mulx	%r15, %r12, %r13
+.LBE52:
+.LBE60:
+.LBB61:
+.LBB46:
+	.loc 1 778 39 view .LVU52
+	shrx	%rcx, %r9, %r9
+	cmovne	%r9, %r8
+.LBE46:
+.LBE61:
+.LBB62:
+.LBB53:
+	.loc 1 778 26 view .LVU53
+	mulq	%rsi
+.LBE53:
+.LBE62:
+.LBB63:
+.LBB47:
+	.loc 1 778 10 view .LVU54
+	movq	%r8, %r10
+.LVL10:
+	.loc 1 778 10 view .LVU55
+.LBE47:
+.LBE63:
+	.loc 1 864 5 is_stmt 1 view .LVU56
+.LBB64:
+.LBI49:
+	.loc 1 773 24 view .LVU57
+.LBB54:
+	.loc 1 775 17 view .LVU58
+	.loc 1 776 3 view .LVU59
+	.loc 1 777 3 view .LVU60
+	.loc 1 778 3 view .LVU61
+	.loc 1 778 26 is_stmt 0 view .LVU62
+	xorl	%r9d, %r9d
+	movq	%rdx, %r8
+	.loc 1 778 33 view .LVU63
+	addq	%r12, %r8
+	adcq	%r13, %r9
+.LBE54:
+.LBE64:
+	.loc 1 865 10 view .LVU64
+	movq	-32(%rsp), %rdx
+.LBB65:
+.LBB55:
+	.loc 1 778 39 view .LVU65
+	shrdq	%r9, %r8
+	.loc 1 778 26 view .LVU66
+	movq	%rsi, -40(%rsp)
+.LVL11:
+	.loc 1 778 39 view .LVU67
+	testb	$64, %cl
+	shrx	%rcx, %r9, %r9
+	cmovne	%r9, %r8
+.LBE55:
+.LBE65:
+	.loc 1 865 10 view .LVU68
+	subq	%r14, %rdx
+	movq	%rdx, %rax
+.LBB66:
+.LBB67:
+	.loc 1 777 17 view .LVU69
+	mulx	%r15, %r12, %r13
+	.loc 1 778 26 view .LVU70
+	mulq	-40(%rsp)
+.LBE67:
+.LBE66:
+.LBB69:
+.LBB56:
+	.loc 1 778 10 view .LVU71
+	movq	%r8, %rsi
+.LVL12:
+	.loc 1 778 10 view .LVU72
+.LBE56:
+.LBE69:
+	.loc 1 865 5 is_stmt 1 view .LVU73
+.LBB70:
+.LBI66:
+	.loc 1 773 24 view .LVU74
+.LBB68:
+	.loc 1 775 17 view .LVU75
+	.loc 1 776 3 view .LVU76
+	.loc 1 777 3 view .LVU77
+	.loc 1 778 3 view .LVU78
+	.loc 1 778 26 is_stmt 0 view .LVU79
+	xorl	%r9d, %r9d
+	movq	%rdx, %r8
+	.loc 1 778 33 view .LVU80
+	addq	%r12, %r8
+	adcq	%r13, %r9
+	.loc 1 778 39 view .LVU81
+	shrdq	%r9, %r8
+	shrx	%rcx, %r9, %r9
+	andl	$64, %ecx
+	cmovne	%r9, %r8
+.LVL13:
+	.loc 1 778 39 view .LVU82
+.LBE68:
+.LBE70:
+	.loc 1 866 5 is_stmt 1 view .LVU83
+	.loc 1 866 8 is_stmt 0 view .LVU84
+	cmpl	$1, %ebp
+	jbe	.L66
+	.loc 1 876 10 is_stmt 1 view .LVU85
+	.loc 1 876 13 is_stmt 0 view .LVU86
+	cmpl	$62, %ebp
+	ja	.L5
+	.loc 1 877 7 is_stmt 1 view .LVU87
+.LVL14:
+.LBB71:
+.LBI71:
+	.loc 1 766 19 view .LVU88
+.LBB72:
+	.loc 1 767 3 view .LVU89
+	.loc 1 767 17 is_stmt 0 view .LVU90
+	bzhi	%rbp, %r11, %r11
+.LVL15:
+	.loc 1 767 38 view .LVU91
+	testq	%r11, %r11
+	sete	%r11b
+	movzbl	%r11b, %r11d
+.LVL16:
+	.loc 1 767 38 view .LVU92
+	movl	%r11d, %eax
+.LBE72:
+.LBE71:
+.LBE33:
+	.loc 1 834 7 view .LVU93
+	xorl	%edi, %edi
+	jmp	.L8
+.LVL17:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 825 8 view .LVU94
+	movq	%rbx, %rdi
+	btsq	$52, %rdi
+	.loc 1 830 43 view .LVU95
+	testq	%rbx, %rbx
+	.loc 1 829 18 view .LVU96
+	leaq	0(,%rdi,4), %r11
+	.loc 1 825 8 view .LVU97
+	movq	%rdi, -16(%rsp)
+	.loc 1 830 43 view .LVU98
+	setne	%dil
+	.loc 1 830 65 view .LVU99
+	cmpl	$1, %esi
+	setbe	%dl
+	.loc 1 830 48 view .LVU100
+	orl	%edx, %edi
+.LBB78:
+	.loc 1 843 10 view .LVU101
+	leaq	-1(%r11), %rbx
+.LVL18:
+	.loc 1 842 10 view .LVU102
+	leaq	2(%r11), %r13
+	.loc 1 843 49 view .LVU103
+	movzbl	%dil, %r14d
+	.loc 1 843 10 view .LVU104
+	movq	%rbx, %rbp
+.LBE78:
+	.loc 1 836 6 view .LVU105
+	movl	%esi, %edx
+.LBB141:
+	.loc 1 842 10 view .LVU106
+	movq	%r13, -40(%rsp)
+	.loc 1 843 10 view .LVU107
+	movq	%rbx, -32(%rsp)
+	movl	%esi, %eax
+.LBE141:
+	.loc 1 824 5 is_stmt 1 view .LVU108
+.LVL19:
+	.loc 1 825 5 view .LVU109
+	.loc 1 827 3 view .LVU110
+	.loc 1 829 3 view .LVU111
+	.loc 1 830 3 view .LVU112
+	.loc 1 832 3 view .LVU113
+	.loc 1 833 3 view .LVU114
+	.loc 1 834 3 view .LVU115
+	.loc 1 835 3 view .LVU116
+	.loc 1 836 3 view .LVU117
+.LBB142:
+	.loc 1 842 10 is_stmt 0 view .LVU118
+	movq	%r13, %r15
+	.loc 1 843 10 view .LVU119
+	subq	%r14, %rbp
+.LBE142:
+	.loc 1 836 6 view .LVU120
+	subl	$1077, %edx
+.LVL20:
+	.loc 1 836 6 view .LVU121
+	js	.L4
+.LVL21:
+.LBB143:
+	.loc 1 837 5 is_stmt 1 view .LVU122
+.LBB79:
+.LBI79:
+	.loc 1 740 24 view .LVU123
+.LBB80:
+	.loc 1 741 3 view .LVU124
+	.loc 1 741 23 is_stmt 0 view .LVU125
+	imull	$78913, %edx, %ebx
+.LBE80:
+.LBE79:
+	.loc 1 837 63 view .LVU126
+	xorl	%eax, %eax
+.LVL22:
+	.loc 1 841 78 view .LVU127
+	leaq	numeric_formatter_pow5_inv_split(%rip), %rcx
+.LBB82:
+.LBB81:
+	.loc 1 741 32 view .LVU128
+	shrl	$18, %ebx
+.LBE81:
+.LBE82:
+	.loc 1 837 63 view .LVU129
+	cmpl	$3, %edx
+	setg	%al
+	.loc 1 837 20 view .LVU130
+	subl	%eax, %ebx
+.LVL23:
+	.loc 1 838 5 is_stmt 1 view .LVU131
+	.loc 1 841 78 is_stmt 0 view .LVU132
+	movl	%ebx, %eax
+	salq	$4, %rax
+	addq	%rcx, %rax
+.LBB83:
+.LBB84:
+	.loc 1 777 38 view .LVU133
+	movq	8(%rax), %r12
+	.loc 1 776 38 view .LVU134
+	movq	(%rax), %r14
+.LBE84:
+.LBE83:
+.LBB91:
+.LBB92:
+	.loc 1 734 33 view .LVU135
+	imull	$1217359, %ebx, %eax
+.LBE92:
+.LBE91:
+	.loc 1 840 27 view .LVU136
+	movl	%ebx, %ecx
+	subl	%edx, %ecx
+.LBB95:
+.LBB93:
+	.loc 1 734 44 view .LVU137
+	shrl	$19, %eax
+.LBE93:
+.LBE95:
+.LBB96:
+.LBB85:
+	.loc 1 778 45 view .LVU138
+	leal	61(%rax,%rcx), %ecx
+	.loc 1 777 17 view .LVU139
+	movq	%r12, %rdx
+.LVL24:
+	.loc 1 778 26 view .LVU140
+	movq	%r14, %rax
+	.loc 1 777 17 view .LVU141
+	mulx	%r11, %r8, %r9
+	.loc 1 778 26 view .LVU142
+	mulq	%r11
+	xorl	%edi, %edi
+.LBE85:
+.LBE96:
+.LBB97:
+.LBB98:
+	movq	%r13, %rax
+.LBE98:
+.LBE97:
+.LBB106:
+.LBB86:
+	movq	%rdx, %rsi
+.LVL25:
+	.loc 1 778 33 view .LVU143
+	addq	%r8, %rsi
+	adcq	%r9, %rdi
+	.loc 1 778 39 view .LVU144
+	shrdq	%rdi, %rsi
+.LBE86:
+.LBE106:
+.LBB107:
+.LBB99:
+	.loc 1 777 17 view .LVU145
+	movq	%r13, %rdx
+.LBE99:
+.LBE107:
+.LBB108:
+.LBB87:
+	.loc 1 778 39 view .LVU146
+	testb	$64, %cl
+.LBE87:
+.LBE108:
+.LBB109:
+.LBB100:
+	.loc 1 777 17 view .LVU147
+	mulx	%r12, %r8, %r9
+.LBE100:
+.LBE109:
+.LBB110:
+.LBB88:
+	.loc 1 778 39 view .LVU148
+	shrx	%rcx, %rdi, %rdi
+	cmovne	%rdi, %rsi
+.LBE88:
+.LBE110:
+.LBB111:
+.LBB101:
+	.loc 1 778 26 view .LVU149
+	mulq	%r14
+.LBE101:
+.LBE111:
+.LBB112:
+.LBB89:
+	.loc 1 778 10 view .LVU150
+	movq	%rsi, %r10
+.LBE89:
+.LBE112:
+.LBB113:
+.LBB102:
+	.loc 1 778 26 view .LVU151
+	xorl	%edi, %edi
+	movq	%rdx, %rsi
+	.loc 1 778 33 view .LVU152
+	addq	%r8, %rsi
+	adcq	%r9, %rdi
+	.loc 1 778 39 view .LVU153
+	shrdq	%rdi, %rsi
+.LBE102:
+.LBE113:
+.LBB114:
+.LBB115:
+	.loc 1 777 17 view .LVU154
+	movq	%r12, %rdx
+.LBE115:
+.LBE114:
+.LBB119:
+.LBB103:
+	.loc 1 778 39 view .LVU155
+	testb	$64, %cl
+.LBE103:
+.LBE119:
+.LBB120:
+.LBB116:
+	.loc 1 778 26 view .LVU156
+	movq	%r14, %rax
+	.loc 1 777 17 view .LVU157
+	mulx	%rbp, %r12, %r13
+.LBE116:
+.LBE120:
+.LBB121:
+.LBB104:
+	.loc 1 778 39 view .LVU158
+	shrx	%rcx, %rdi, %rdi
+	cmovne	%rdi, %rsi
+.LBE104:
+.LBE121:
+.LBB122:
+.LBB117:
+	.loc 1 778 26 view .LVU159
+	mulq	%rbp
+	xorl	%r9d, %r9d
+.LBE117:
+.LBE122:
+	.loc 1 838 9 view .LVU160
+	movl	%ebx, -44(%rsp)
+.LVL26:
+	.loc 1 839 5 is_stmt 1 view .LVU161
+.LBB123:
+.LBI91:
+	.loc 1 733 23 view .LVU162
+.LBB94:
+	.loc 1 734 3 view .LVU163
+	.loc 1 734 3 is_stmt 0 view .LVU164
+.LBE94:
+.LBE123:
+	.loc 1 840 5 is_stmt 1 view .LVU165
+	.loc 1 841 5 view .LVU166
+.LBB124:
+.LBI83:
+	.loc 1 773 24 view .LVU167
+.LBB90:
+	.loc 1 775 17 view .LVU168
+	.loc 1 776 3 view .LVU169
+	.loc 1 777 3 view .LVU170
+	.loc 1 778 3 view .LVU171
+	.loc 1 778 3 is_stmt 0 view .LVU172
+.LBE90:
+.LBE124:
+	.loc 1 842 5 is_stmt 1 view .LVU173
+.LBB125:
+.LBI97:
+	.loc 1 773 24 view .LVU174
+.LBB105:
+	.loc 1 775 17 view .LVU175
+	.loc 1 776 3 view .LVU176
+	.loc 1 777 3 view .LVU177
+	.loc 1 778 3 view .LVU178
+	.loc 1 778 3 is_stmt 0 view .LVU179
+.LBE105:
+.LBE125:
+	.loc 1 843 5 is_stmt 1 view .LVU180
+.LBB126:
+.LBI114:
+	.loc 1 773 24 view .LVU181
+.LBB118:
+	.loc 1 775 17 view .LVU182
+	.loc 1 776 3 view .LVU183
+	.loc 1 777 3 view .LVU184
+	.loc 1 778 3 view .LVU185
+	.loc 1 778 26 is_stmt 0 view .LVU186
+	movq	%rdx, %r8
+	.loc 1 778 33 view .LVU187
+	addq	%r12, %r8
+	adcq	%r13, %r9
+	.loc 1 778 39 view .LVU188
+	shrdq	%r9, %r8
+	shrx	%rcx, %r9, %r9
+	andl	$64, %ecx
+	cmovne	%r9, %r8
+.LVL27:
+	.loc 1 778 39 view .LVU189
+.LBE118:
+.LBE126:
+	.loc 1 844 5 is_stmt 1 view .LVU190
+	.loc 1 844 8 is_stmt 0 view .LVU191
+	cmpl	$21, %ebx
+	ja	.L5
+	.loc 1 846 7 is_stmt 1 view .LVU192
+	movabsq	$-3689348814741910323, %rcx
+	movq	%r11, %rax
+	imulq	%rcx, %rax
+	.loc 1 846 10 is_stmt 0 view .LVU193
+	movabsq	$3689348814741910323, %rdi
+	cmpq	%rax, %rdi
+	jnb	.L67
+	.loc 1 849 12 is_stmt 1 view .LVU194
+	.loc 1 849 15 is_stmt 0 view .LVU195
+	cmpq	$0, -24(%rsp)
+	je	.L9
+.LVL28:
+.LBB127:
+.LBB128:
+	.loc 1 756 20 is_stmt 1 view .LVU196
+.LBE128:
+.LBE127:
+	movq	-40(%rsp), %rax
+.LBB132:
+.LBB129:
+	.loc 1 755 12 is_stmt 0 view .LVU197
+	xorl	%r9d, %r9d
+.LBE129:
+.LBE132:
+	imulq	%rcx, %rax
+	movq	%r15, %rdx
+.LBB133:
+.LBB130:
+	.loc 1 756 20 view .LVU198
+	cmpq	%rax, %rdi
+	jb	.L11
+.LVL29:
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.loc 1 757 5 is_stmt 1 view .LVU199
+	.loc 1 757 11 is_stmt 0 view .LVU200
+	movq	%rdx, %rax
+	mulq	%rcx
+.LVL30:
+	.loc 1 758 10 view .LVU201
+	incl	%r9d
+.LVL31:
+	.loc 1 757 11 view .LVU202
+	shrq	$2, %rdx
+.LVL32:
+	.loc 1 758 5 is_stmt 1 view .LVU203
+	.loc 1 756 20 view .LVU204
+	.loc 1 758 10 is_stmt 0 view .LVU205
+	movq	%rdx, %rax
+	imulq	%rcx, %rax
+	.loc 1 756 20 view .LVU206
+	cmpq	%rax, %rdi
+	jnb	.L10
+.LVL33:
+.L11:
+	.loc 1 760 3 is_stmt 1 view .LVU207
+	.loc 1 760 16 is_stmt 0 view .LVU208
+	cmpl	%ebx, %r9d
+	.loc 1 760 16 view .LVU209
+.LBE130:
+.LBE133:
+	.loc 1 853 12 view .LVU210
+	adcq	$-1, %rsi
+	.loc 1 853 12 view .LVU211
+.LBE143:
+	.loc 1 881 3 is_stmt 1 view .LVU212
+.LVL34:
+	.loc 1 882 3 view .LVU213
+	.loc 1 883 3 view .LVU214
+	.loc 1 884 3 view .LVU215
+	.p2align 4,,10
+	.p2align 3
+.L5:
+.LBB144:
+	.loc 1 914 5 view .LVU216
+	.loc 1 915 5 view .LVU217
+	.loc 1 915 12 is_stmt 0 view .LVU218
+	movq	%rsi, %rcx
+	shrq	$2, %rcx
+	movq	%rcx, %rax
+	movabsq	$2951479051793528259, %r9
+	mulq	%r9
+	.loc 1 915 23 view .LVU219
+	movq	%r8, %rdi
+	shrq	$2, %rdi
+	movq	%rdi, %rax
+	.loc 1 915 12 view .LVU220
+	movq	%rdx, %rcx
+	.loc 1 915 23 view .LVU221
+	mulq	%r9
+	.loc 1 915 12 view .LVU222
+	shrq	$2, %rcx
+	.loc 1 915 23 view .LVU223
+	movq	%rdx, %rdi
+	shrq	$2, %rdi
+	.loc 1 915 8 view .LVU224
+	cmpq	%rcx, %rdi
+	jb	.L68
+	xorl	%ebx, %ebx
+.LBE144:
+	.loc 1 881 11 view .LVU225
+	xorl	%r9d, %r9d
+.LVL35:
+.L26:
+.LBB145:
+	.loc 1 922 20 is_stmt 1 view .LVU226
+	.loc 1 922 15 is_stmt 0 view .LVU227
+	movabsq	$-3689348814741910323, %r11
+	movq	%rsi, %rax
+	mulq	%r11
+.LVL36:
+	.loc 1 922 25 view .LVU228
+	movq	%r8, %rax
+	.loc 1 922 15 view .LVU229
+	movq	%rdx, %rcx
+	.loc 1 922 25 view .LVU230
+	mulq	%r11
+	.loc 1 922 15 view .LVU231
+	shrq	$3, %rcx
+	.loc 1 922 25 view .LVU232
+	movq	%rdx, %rdi
+	shrq	$3, %rdi
+	.loc 1 922 20 view .LVU233
+	cmpq	%rcx, %rdi
+	jnb	.L28
+.LVL37:
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.loc 1 923 7 is_stmt 1 view .LVU234
+	.loc 1 924 7 view .LVU235
+	.loc 1 924 10 is_stmt 0 view .LVU236
+	movq	%r10, %rax
+	mulq	%r11
+	.loc 1 922 15 view .LVU237
+	movq	%rcx, %rax
+	movq	%r10, %rsi
+	.loc 1 924 10 view .LVU238
+	shrq	$3, %rdx
+	movq	%rdx, %r10
+.LVL38:
+	.loc 1 925 7 is_stmt 1 view .LVU239
+	.loc 1 926 7 view .LVU240
+	.loc 1 927 7 view .LVU241
+	.loc 1 922 15 is_stmt 0 view .LVU242
+	mulq	%r11
+.LVL39:
+	.loc 1 922 25 view .LVU243
+	movq	%rdi, %rax
+	movq	%rdi, %r8
+	.loc 1 922 15 view .LVU244
+	movq	%rdx, %rcx
+.LVL40:
+	.loc 1 922 25 view .LVU245
+	mulq	%r11
+	.loc 1 922 15 view .LVU246
+	shrq	$3, %rcx
+	.loc 1 927 7 view .LVU247
+	incl	%r9d
+.LVL41:
+	.loc 1 922 20 is_stmt 1 view .LVU248
+	.loc 1 922 25 is_stmt 0 view .LVU249
+	movq	%rdx, %rdi
+.LVL42:
+	.loc 1 922 25 view .LVU250
+	shrq	$3, %rdi
+	.loc 1 922 20 view .LVU251
+	cmpq	%rcx, %rdi
+	jb	.L27
+	.loc 1 923 21 view .LVU252
+	leaq	(%r10,%r10,4), %rdx
+	addq	%rdx, %rdx
+	movq	%rsi, %rax
+	subq	%rdx, %rax
+	.loc 1 923 26 view .LVU253
+	cmpq	$4, %rax
+	seta	%bl
+.LVL43:
+.L28:
+	.loc 1 929 5 is_stmt 1 view .LVU254
+	.loc 1 929 23 is_stmt 0 view .LVU255
+	cmpq	%r8, %r10
+	sete	%al
+	.loc 1 929 29 view .LVU256
+	orl	%ebx, %eax
+	movzbl	%al, %eax
+	.loc 1 929 12 view .LVU257
+	addq	%rax, %r10
+.LVL44:
+.L25:
+	.loc 1 929 12 view .LVU258
+.LBE145:
+	.loc 1 931 3 is_stmt 1 view .LVU259
+	.loc 1 932 3 view .LVU260
+	.loc 1 932 10 is_stmt 0 view .LVU261
+	movl	-44(%rsp), %edx
+	.loc 1 933 1 view .LVU262
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	.loc 1 932 10 view .LVU263
+	addl	%r9d, %edx
+.LVL45:
+	.loc 1 933 1 view .LVU264
+	movq	%r10, %rax
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	.cfi_restore_state
+.LBB146:
+	.loc 1 916 7 is_stmt 1 view .LVU265
+	.loc 1 916 21 is_stmt 0 view .LVU266
+	movq	%r10, %rdx
+	shrq	$2, %rdx
+	movq	%rdx, %rax
+	mulq	%r9
+	.loc 1 917 10 view .LVU267
+	movq	%rdi, %r8
+	movq	%rcx, %rsi
+	.loc 1 916 21 view .LVU268
+	shrq	$2, %rdx
+	imulq	$100, %rdx, %rax
+	.loc 1 920 15 view .LVU269
+	movl	$2, %r9d
+	.loc 1 916 21 view .LVU270
+	subq	%rax, %r10
+	.loc 1 916 27 view .LVU271
+	cmpq	$49, %r10
+	seta	%bl
+.LVL47:
+	.loc 1 917 7 is_stmt 1 view .LVU272
+	.loc 1 917 10 is_stmt 0 view .LVU273
+	movq	%rdx, %r10
+.LVL48:
+	.loc 1 918 7 is_stmt 1 view .LVU274
+	.loc 1 919 7 view .LVU275
+	.loc 1 920 7 view .LVU276
+	.loc 1 920 7 is_stmt 0 view .LVU277
+	jmp	.L26
+.LVL49:
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	.loc 1 920 7 view .LVU278
+.LBE146:
+.LBB147:
+	.loc 1 868 7 is_stmt 1 view .LVU279
+	.loc 1 869 7 view .LVU280
+	.loc 1 869 10 is_stmt 0 view .LVU281
+	cmpq	$0, -24(%rsp)
+	.loc 1 868 28 view .LVU282
+	movl	$1, %r11d
+.LVL50:
+	.loc 1 869 10 view .LVU283
+	je	.L15
+	.loc 1 873 9 is_stmt 1 view .LVU284
+	.loc 1 873 9 is_stmt 0 view .LVU285
+	decq	%rsi
+	.loc 1 873 9 view .LVU286
+.LBE147:
+	.loc 1 881 3 is_stmt 1 view .LVU287
+.LVL51:
+	.loc 1 882 3 view .LVU288
+	.loc 1 883 3 view .LVU289
+	.loc 1 884 3 view .LVU290
+	.loc 1 834 7 is_stmt 0 view .LVU291
+	xorl	%edi, %edi
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.loc 1 886 20 is_stmt 1 view .LVU292
+	.loc 1 886 15 is_stmt 0 view .LVU293
+	movq	%rsi, %rax
+	movabsq	$-3689348814741910323, %rbp
+	mulq	%rbp
+.LVL53:
+	.loc 1 886 25 view .LVU294
+	movq	%r8, %rax
+	.loc 1 886 15 view .LVU295
+	movq	%rdx, %rsi
+	.loc 1 886 25 view .LVU296
+	mulq	%rbp
+	.loc 1 886 15 view .LVU297
+	shrq	$3, %rsi
+	.loc 1 886 25 view .LVU298
+	movq	%rdx, %rcx
+	shrq	$3, %rcx
+	.loc 1 886 20 view .LVU299
+	cmpq	%rsi, %rcx
+	jnb	.L16
+	.loc 1 882 11 view .LVU300
+	xorl	%r13d, %r13d
+	.loc 1 881 11 view .LVU301
+	xorl	%r9d, %r9d
+	.loc 1 887 39 view .LVU302
+	movabsq	$1844674407370955161, %r12
+	jmp	.L17
+.LVL54:
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	.loc 1 886 25 view .LVU303
+	movq	%rdx, %rcx
+.LVL55:
+.L17:
+	.loc 1 887 7 is_stmt 1 view .LVU304
+	.loc 1 887 39 is_stmt 0 view .LVU305
+	imulq	%rbp, %r8
+.LVL56:
+	.loc 1 887 39 view .LVU306
+	xorl	%eax, %eax
+	rorx	$1, %r8, %r8
+	cmpq	%r8, %r12
+	setnb	%al
+	.loc 1 887 28 view .LVU307
+	andl	%eax, %edi
+.LVL57:
+	.loc 1 888 7 is_stmt 1 view .LVU308
+	.loc 1 888 50 is_stmt 0 view .LVU309
+	xorl	%eax, %eax
+	testb	%r13b, %r13b
+	sete	%al
+	.loc 1 888 28 view .LVU310
+	andl	%eax, %r11d
+.LVL58:
+	.loc 1 889 7 is_stmt 1 view .LVU311
+	.loc 1 889 41 is_stmt 0 view .LVU312
+	movq	%r10, %rax
+	mulq	%rbp
+	.loc 1 889 26 view .LVU313
+	movl	%r10d, %r13d
+.LVL59:
+	.loc 1 893 7 view .LVU314
+	incl	%r9d
+.LVL60:
+	.loc 1 889 41 view .LVU315
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	.loc 1 889 26 view .LVU316
+	subl	%eax, %r13d
+.LVL61:
+	.loc 1 890 7 is_stmt 1 view .LVU317
+	.loc 1 886 15 is_stmt 0 view .LVU318
+	movq	%rsi, %rax
+.LVL62:
+	.loc 1 890 10 view .LVU319
+	movq	%rdx, %r10
+.LVL63:
+	.loc 1 891 7 is_stmt 1 view .LVU320
+	.loc 1 892 7 view .LVU321
+	.loc 1 893 7 view .LVU322
+	.loc 1 886 20 view .LVU323
+	.loc 1 886 15 is_stmt 0 view .LVU324
+	mulq	%rbp
+.LVL64:
+	.loc 1 886 25 view .LVU325
+	movq	%rcx, %rax
+	movq	%rcx, %r8
+	.loc 1 886 15 view .LVU326
+	movq	%rdx, %rsi
+.LVL65:
+	.loc 1 886 25 view .LVU327
+	mulq	%rbp
+	.loc 1 886 15 view .LVU328
+	shrq	$3, %rsi
+	.loc 1 886 25 view .LVU329
+	shrq	$3, %rdx
+	.loc 1 886 20 view .LVU330
+	cmpq	%rsi, %rdx
+	jb	.L33
+	.loc 1 895 5 is_stmt 1 view .LVU331
+	.loc 1 895 8 is_stmt 0 view .LVU332
+	testl	%edi, %edi
+	je	.L18
+.LVL66:
+.L29:
+	.loc 1 896 22 is_stmt 1 view .LVU333
+	movabsq	$-3689348814741910323, %rsi
+	movq	%rcx, %rax
+	imulq	%rsi, %rax
+	movabsq	$1844674407370955161, %rdi
+.LVL67:
+	.loc 1 896 22 is_stmt 0 view .LVU334
+	rorx	$1, %rax, %rax
+	cmpq	%rax, %rdi
+	jb	.L34
+.LVL68:
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.loc 1 897 9 is_stmt 1 view .LVU335
+	.loc 1 897 52 is_stmt 0 view .LVU336
+	xorl	%eax, %eax
+	testb	%r13b, %r13b
+	sete	%al
+	.loc 1 897 30 view .LVU337
+	andl	%eax, %r11d
+.LVL69:
+	.loc 1 898 9 is_stmt 1 view .LVU338
+	.loc 1 898 43 is_stmt 0 view .LVU339
+	movq	%r10, %rax
+	mulq	%rsi
+	.loc 1 898 28 view .LVU340
+	movl	%r10d, %r13d
+.LVL70:
+	.loc 1 902 9 view .LVU341
+	incl	%r9d
+.LVL71:
+	.loc 1 898 43 view .LVU342
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	.loc 1 898 28 view .LVU343
+	subl	%eax, %r13d
+.LVL72:
+	.loc 1 899 9 is_stmt 1 view .LVU344
+	.loc 1 901 12 is_stmt 0 view .LVU345
+	movq	%rcx, %rax
+.LVL73:
+	.loc 1 899 12 view .LVU346
+	movq	%rdx, %r10
+.LVL74:
+	.loc 1 900 9 is_stmt 1 view .LVU347
+	.loc 1 901 9 view .LVU348
+	.loc 1 901 12 is_stmt 0 view .LVU349
+	mulq	%rsi
+.LVL75:
+	.loc 1 901 12 view .LVU350
+	movq	%rdx, %rcx
+	shrq	$3, %rcx
+.LVL76:
+	.loc 1 902 9 is_stmt 1 view .LVU351
+	.loc 1 896 22 view .LVU352
+	.loc 1 902 9 is_stmt 0 view .LVU353
+	movq	%rcx, %rax
+	imulq	%rsi, %rax
+	rorx	$1, %rax, %rax
+	.loc 1 896 22 view .LVU354
+	cmpq	%rax, %rdi
+	jnb	.L19
+.LVL77:
+.L34:
+	.loc 1 896 22 view .LVU355
+	movl	$1, %edi
+.LVL78:
+.L18:
+	.loc 1 905 5 is_stmt 1 view .LVU356
+	.loc 1 905 8 is_stmt 0 view .LVU357
+	cmpb	$5, %r13b
+	jne	.L20
+	.loc 1 905 8 view .LVU358
+	testl	%r11d, %r11d
+	je	.L20
+	.loc 1 905 57 discriminator 1 view .LVU359
+	testb	$1, %r10b
+	jne	.L37
+	.loc 1 907 7 is_stmt 1 view .LVU360
+.LVL79:
+	.loc 1 910 5 view .LVU361
+	.loc 1 910 76 is_stmt 0 view .LVU362
+	cmpq	%rcx, %r10
+	jne	.L25
+	.loc 1 910 52 view .LVU363
+	xorl	$1, %edi
+	.loc 1 910 49 view .LVU364
+	orq	%rbx, %rdi
+	.loc 1 910 76 view .LVU365
+	andl	$1, %edi
+	.loc 1 910 12 view .LVU366
+	addq	%rdi, %r10
+.LVL80:
+	.loc 1 910 12 view .LVU367
+	jmp	.L25
+.LVL81:
+	.p2align 4,,10
+	.p2align 3
+.L67:
+.LBB148:
+.LBB134:
+.LBB135:
+	.loc 1 755 12 view .LVU368
+	xorl	%r9d, %r9d
+	movq	%r11, %rdx
+.LVL82:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.loc 1 757 5 is_stmt 1 view .LVU369
+	.loc 1 757 11 is_stmt 0 view .LVU370
+	movq	%rdx, %rax
+	mulq	%rcx
+.LVL83:
+	.loc 1 758 10 view .LVU371
+	incl	%r9d
+.LVL84:
+	.loc 1 757 11 view .LVU372
+	shrq	$2, %rdx
+.LVL85:
+	.loc 1 758 5 is_stmt 1 view .LVU373
+	.loc 1 756 20 view .LVU374
+	.loc 1 758 10 is_stmt 0 view .LVU375
+	movq	%rdx, %rax
+	imulq	%rcx, %rax
+	.loc 1 756 20 view .LVU376
+	cmpq	%rax, %rdi
+	jnb	.L7
+	.loc 1 760 3 is_stmt 1 view .LVU377
+	.loc 1 760 16 is_stmt 0 view .LVU378
+	xorl	%r11d, %r11d
+	cmpl	%ebx, %r9d
+	setnb	%r11b
+.LVL86:
+	.loc 1 760 16 view .LVU379
+.LBE135:
+.LBE134:
+.LBE148:
+	.loc 1 825 8 view .LVU380
+	movq	-16(%rsp), %rbx
+.LVL87:
+.LBB149:
+	.loc 1 825 8 view .LVU381
+	movl	%r11d, %eax
+.LVL88:
+	.loc 1 825 8 view .LVU382
+.LBE149:
+	.loc 1 834 7 view .LVU383
+	xorl	%edi, %edi
+.LVL89:
+.L8:
+	.loc 1 881 3 is_stmt 1 view .LVU384
+	.loc 1 882 3 view .LVU385
+	.loc 1 883 3 view .LVU386
+	.loc 1 884 3 view .LVU387
+	.loc 1 884 6 is_stmt 0 view .LVU388
+	testl	%eax, %eax
+	jne	.L15
+	jmp	.L5
+.LVL90:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+.LBB150:
+.LBB73:
+.LBB36:
+	.loc 1 748 23 view .LVU389
+	imull	$-732923, %edx, %ecx
+.LBE36:
+.LBE73:
+	.loc 1 858 65 view .LVU390
+	xorl	%esi, %esi
+.LBE150:
+	.loc 1 830 48 view .LVU391
+	movzbl	%dil, %edi
+.LBB151:
+.LBB74:
+.LBB37:
+	.loc 1 748 33 view .LVU392
+	shrl	$20, %ecx
+.LBE37:
+.LBE74:
+	.loc 1 858 65 view .LVU393
+	cmpl	$-1, %edx
+	setl	%sil
+	.loc 1 858 20 view .LVU394
+	subl	%esi, %ecx
+	movl	%ecx, %ebp
+	.loc 1 858 24 view .LVU395
+	movl	$1077, %ecx
+	subl	%eax, %ecx
+	.loc 1 860 19 view .LVU396
+	subl	%ebp, %ecx
+	movslq	%ecx, %rax
+.LVL91:
+.LBB75:
+.LBB40:
+	.loc 1 734 33 view .LVU397
+	imull	$1217359, %ecx, %ecx
+.LBE40:
+.LBE75:
+	.loc 1 859 9 view .LVU398
+	leal	(%rdx,%rbp), %ebx
+	.loc 1 862 19 view .LVU399
+	movl	%ebp, %edx
+.LVL92:
+.LBB76:
+.LBB41:
+	.loc 1 734 44 view .LVU400
+	shrl	$19, %ecx
+.LBE41:
+.LBE76:
+	.loc 1 862 19 view .LVU401
+	subl	%ecx, %edx
+	.loc 1 859 9 view .LVU402
+	movl	%ebx, -44(%rsp)
+	salq	$4, %rax
+.LBE151:
+	.loc 1 825 8 view .LVU403
+	movq	-16(%rsp), %rbx
+.LBB152:
+.LBB77:
+.LBB48:
+	.loc 1 778 45 view .LVU404
+	leal	60(%rdx), %ecx
+	jmp	.L3
+.LVL93:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 778 45 view .LVU405
+.LBE48:
+.LBE77:
+.LBE152:
+	.loc 1 895 5 is_stmt 1 view .LVU406
+	.loc 1 895 8 is_stmt 0 view .LVU407
+	testl	%edi, %edi
+	jne	.L36
+	.loc 1 881 11 view .LVU408
+	xorl	%r9d, %r9d
+	.loc 1 895 8 view .LVU409
+	movq	%r8, %rcx
+	.loc 1 882 11 view .LVU410
+	xorl	%r13d, %r13d
+.LVL94:
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	.loc 1 910 5 is_stmt 1 view .LVU411
+	.loc 1 910 76 is_stmt 0 view .LVU412
+	cmpq	%rcx, %r10
+	je	.L69
+.L23:
+	.loc 1 910 76 discriminator 4 view .LVU413
+	xorl	%eax, %eax
+	cmpb	$4, %r13b
+	seta	%al
+	.loc 1 910 12 discriminator 4 view .LVU414
+	addq	%rax, %r10
+.LVL95:
+	.loc 1 910 12 discriminator 4 view .LVU415
+	jmp	.L25
+.LVL96:
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	.loc 1 910 30 discriminator 1 view .LVU416
+	testl	%edi, %edi
+	je	.L37
+	andl	$1, %ebx
+	je	.L23
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	.loc 1 910 12 view .LVU417
+	incq	%r10
+.LVL97:
+	.loc 1 910 12 view .LVU418
+	jmp	.L25
+.LVL98:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+.LBB153:
+.LBB136:
+.LBB137:
+	.loc 1 756 20 is_stmt 1 view .LVU419
+.LBE137:
+.LBE136:
+.LBB139:
+.LBB131:
+	movq	%rbp, %rax
+	imulq	%rcx, %rax
+.LBE131:
+.LBE139:
+.LBB140:
+.LBB138:
+	.loc 1 755 12 is_stmt 0 view .LVU420
+	xorl	%r9d, %r9d
+	.loc 1 756 20 view .LVU421
+	cmpq	%rax, %rdi
+	jb	.L12
+	.loc 1 755 12 view .LVU422
+	movq	%rbp, %rdx
+.LVL99:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 757 5 is_stmt 1 view .LVU423
+	.loc 1 757 11 is_stmt 0 view .LVU424
+	movq	%rdx, %rax
+	mulq	%rcx
+.LVL100:
+	.loc 1 758 10 view .LVU425
+	incl	%r9d
+.LVL101:
+	.loc 1 757 11 view .LVU426
+	shrq	$2, %rdx
+.LVL102:
+	.loc 1 758 5 is_stmt 1 view .LVU427
+	.loc 1 756 20 view .LVU428
+	.loc 1 758 10 is_stmt 0 view .LVU429
+	movq	%rdx, %rax
+	imulq	%rcx, %rax
+	.loc 1 756 20 view .LVU430
+	cmpq	%rax, %rdi
+	jnb	.L13
+.LVL103:
+.L12:
+	.loc 1 760 3 is_stmt 1 view .LVU431
+	.loc 1 760 16 is_stmt 0 view .LVU432
+	xorl	%edi, %edi
+	cmpl	%ebx, %r9d
+	setnb	%dil
+.LVL104:
+	.loc 1 760 16 view .LVU433
+.LBE138:
+.LBE140:
+	movq	-16(%rsp), %rbx
+.LVL105:
+	.loc 1 760 16 view .LVU434
+	movl	%edi, %eax
+.LVL106:
+	.loc 1 760 16 view .LVU435
+.LBE153:
+	.loc 1 835 7 view .LVU436
+	xorl	%r11d, %r11d
+.LVL107:
+.LBB154:
+	.loc 1 835 7 view .LVU437
+	jmp	.L8
+.LVL108:
+.L36:
+	.loc 1 835 7 view .LVU438
+.LBE154:
+	.loc 1 895 8 view .LVU439
+	movq	%r8, %rcx
+	.loc 1 881 11 view .LVU440
+	xorl	%r9d, %r9d
+	.loc 1 882 11 view .LVU441
+	xorl	%r13d, %r13d
+	jmp	.L29
+	.cfi_endproc
+.LFE32:
+	.size	numeric_formatter_shortest, .-numeric_formatter_shortest
+	.p2align 4
+	.type	numeric_formatter_write, @function
+numeric_formatter_write:
+.LVL109:
+.LFB33:
+	.loc 1 955 116 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 956 3 view .LVU443
+	.loc 1 957 3 view .LVU444
+	.loc 1 955 116 is_stmt 0 view .LVU445
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%esi, %eax
+	movq	%rdx, %rsi
+.LVL110:
+	.loc 1 955 116 view .LVU446
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 957 6 view .LVU447
+	testl	%eax, %eax
+	je	.L71
+	.loc 1 958 5 is_stmt 1 view .LVU448
+	.loc 1 958 10 is_stmt 0 view .LVU449
+	movb	$45, (%rdi)
+	.loc 1 958 7 view .LVU450
+	leaq	1(%rdi), %r12
+.LVL111:
+.L71:
+	.loc 1 960 3 is_stmt 1 view .LVU451
+	.loc 1 960 17 is_stmt 0 view .LVU452
+	leal	-1(%r8), %r15d
+	.loc 1 960 6 view .LVU453
+	cmpl	$20, %r15d
+	ja	.L72
+	.loc 1 962 5 is_stmt 1 view .LVU454
+	.loc 1 962 9 is_stmt 0 view .LVU455
+	movslq	%r8d, %r15
+	.loc 1 965 9 view .LVU456
+	leaq	(%r12,%r15), %rbx
+	.loc 1 962 8 view .LVU457
+	cmpq	%r14, %r15
+	jb	.L73
+	.loc 1 963 7 is_stmt 1 view .LVU458
+	movq	%r14, %rdx
+.LVL112:
+	.loc 1 963 7 is_stmt 0 view .LVU459
+	movq	%r12, %rdi
+.LVL113:
+	.loc 1 964 7 view .LVU460
+	subq	%r14, %r15
+	.loc 1 963 7 view .LVU461
+	call	memcpy@PLT
+.LVL114:
+	.loc 1 964 7 is_stmt 1 view .LVU462
+	.loc 1 964 16 is_stmt 0 view .LVU463
+	leaq	(%r12,%r14), %rax
+	.loc 1 964 7 view .LVU464
+	movabsq	$3472328296227680304, %rdx
+	cmpq	$8, %r15
+	jb	.L116
+	leaq	8(%rax), %rcx
+	andq	$-8, %rcx
+	movq	%rdx, (%rax)
+	movq	%rdx, -8(%rax,%r15)
+	subq	%rcx, %rax
+	addq	%rax, %r15
+	andq	$-8, %r15
+	cmpq	$8, %r15
+	jb	.L80
+	andq	$-8, %r15
+	xorl	%eax, %eax
+.L78:
+	movq	%rdx, (%rcx,%rax)
+	addq	$8, %rax
+	cmpq	%r15, %rax
+	jb	.L78
+	jmp	.L80
+.LVL115:
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	.loc 1 974 8 is_stmt 1 view .LVU465
+	.loc 1 974 23 is_stmt 0 view .LVU466
+	leal	4(%r8), %eax
+.LVL116:
+	.loc 1 974 11 view .LVU467
+	cmpl	$4, %eax
+	jbe	.L117
+.LBB155:
+	.loc 1 985 5 is_stmt 1 view .LVU468
+	.loc 1 985 18 is_stmt 0 view .LVU469
+	movzbl	(%rsi), %eax
+	.loc 1 985 10 view .LVU470
+	movb	%al, (%r12)
+	.loc 1 986 5 is_stmt 1 view .LVU471
+	.loc 1 985 7 is_stmt 0 view .LVU472
+	leaq	1(%r12), %rax
+	.loc 1 986 8 view .LVU473
+	cmpq	$1, %r14
+	ja	.L118
+.LVL117:
+.L91:
+	.loc 1 991 5 is_stmt 1 view .LVU474
+	.loc 1 992 5 view .LVU475
+	.loc 1 992 10 is_stmt 0 view .LVU476
+	movb	$101, (%rax)
+	.loc 1 993 5 is_stmt 1 view .LVU477
+	.loc 1 993 7 is_stmt 0 view .LVU478
+	leaq	2(%rax), %rbx
+	.loc 1 994 10 view .LVU479
+	movslq	%r15d, %rsi
+	.loc 1 993 10 view .LVU480
+	movl	$43, %edx
+	testl	%r15d, %r15d
+	js	.L119
+.LVL118:
+.L93:
+	.loc 1 993 10 view .LVU481
+	movb	%dl, 1(%rax)
+	.loc 1 994 10 discriminator 4 view .LVU482
+	movq	%rbx, %rdi
+	call	u64tos_to@PLT
+.LVL119:
+	.loc 1 994 7 discriminator 4 view .LVU483
+	addq	%rax, %rbx
+.LVL120:
+.L80:
+	.loc 1 994 7 discriminator 4 view .LVU484
+.LBE155:
+	.loc 1 996 3 is_stmt 1 view .LVU485
+	.loc 1 996 6 is_stmt 0 view .LVU486
+	movb	$0, (%rbx)
+	.loc 1 997 3 is_stmt 1 view .LVU487
+	.loc 1 998 1 is_stmt 0 view .LVU488
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 997 21 view .LVU489
+	movq	%rbx, %rax
+	.loc 1 998 1 view .LVU490
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL121:
+	.loc 1 998 1 view .LVU491
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	.loc 1 997 21 view .LVU492
+	subq	%r13, %rax
+.LVL122:
+	.loc 1 998 1 view .LVU493
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL123:
+	.loc 1 998 1 view .LVU494
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL124:
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	.cfi_restore_state
+	.loc 1 968 7 is_stmt 1 view .LVU495
+	cmpl	$8, %r8d
+	jnb	.L81
+	testb	$4, %r8b
+	jne	.L120
+	testl	%r8d, %r8d
+	je	.L82
+	movzbl	(%rsi), %eax
+.LVL125:
+	.loc 1 968 7 is_stmt 0 view .LVU496
+	movb	%al, (%r12)
+	testb	$2, %r8b
+	jne	.L121
+.LVL126:
+.L82:
+	.loc 1 969 7 is_stmt 1 view .LVU497
+	.loc 1 969 16 is_stmt 0 view .LVU498
+	movb	$46, (%rbx)
+	.loc 1 970 7 is_stmt 1 view .LVU499
+	movq	%r14, %rdx
+	.loc 1 970 24 is_stmt 0 view .LVU500
+	leaq	1(%r12,%r15), %rdi
+	.loc 1 970 7 view .LVU501
+	subq	%r15, %rdx
+	.loc 1 970 36 view .LVU502
+	addq	%r15, %rsi
+.LVL127:
+	.loc 1 970 7 view .LVU503
+	call	memcpy@PLT
+.LVL128:
+	.loc 1 971 7 is_stmt 1 view .LVU504
+	.loc 1 971 9 is_stmt 0 view .LVU505
+	leaq	1(%r12,%r14), %rbx
+.LVL129:
+	.loc 1 971 9 view .LVU506
+	jmp	.L80
+.LVL130:
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	.loc 1 976 5 is_stmt 1 view .LVU507
+	.loc 1 977 5 view .LVU508
+	.loc 1 978 20 is_stmt 0 view .LVU509
+	negl	%r8d
+.LVL131:
+	.loc 1 976 10 view .LVU510
+	movl	$11824, %eax
+	.loc 1 978 20 view .LVU511
+	movslq	%r8d, %rcx
+.LVL132:
+	.loc 1 976 10 view .LVU512
+	movw	%ax, (%r12)
+	.loc 1 977 7 view .LVU513
+	leaq	2(%r12), %rbx
+.LVL133:
+	.loc 1 978 5 is_stmt 1 view .LVU514
+	.loc 1 978 20 is_stmt 0 view .LVU515
+	movq	%rcx, %rbp
+	.loc 1 978 5 view .LVU516
+	testl	%ecx, %ecx
+	je	.L89
+	xorl	%edx, %edx
+.LVL134:
+.L88:
+	.loc 1 978 5 view .LVU517
+	movl	%edx, %eax
+	incl	%edx
+	movb	$48, (%rbx,%rax)
+	cmpl	%ebp, %edx
+	jb	.L88
+.L89:
+	.loc 1 979 5 is_stmt 1 view .LVU518
+	.loc 1 979 7 is_stmt 0 view .LVU519
+	addq	%rcx, %rbx
+.LVL135:
+	.loc 1 980 5 is_stmt 1 view .LVU520
+	movq	%rbx, %rdi
+.LVL136:
+	.loc 1 980 5 is_stmt 0 view .LVU521
+	movq	%r14, %rdx
+	call	memcpy@PLT
+.LVL137:
+	.loc 1 981 5 is_stmt 1 view .LVU522
+	.loc 1 981 7 is_stmt 0 view .LVU523
+	addq	%r14, %rbx
+.LVL138:
+	.loc 1 981 7 view .LVU524
+	jmp	.L80
+.LVL139:
+	.p2align 4,,10
+	.p2align 3
+.L118:
+.LBB156:
+	.loc 1 987 12 view .LVU525
+	movb	$46, 1(%r12)
+	.loc 1 987 9 view .LVU526
+	leaq	2(%r12), %rcx
+.LVL140:
+	.loc 1 988 7 view .LVU527
+	decq	%r14
+.LVL141:
+	.loc 1 988 24 view .LVU528
+	incq	%rsi
+	.loc 1 988 7 view .LVU529
+	movq	%r14, %rdx
+.LVL142:
+	.loc 1 988 7 view .LVU530
+	movq	%rcx, %rdi
+.LVL143:
+	.loc 1 988 7 view .LVU531
+	movl	%r8d, 12(%rsp)
+	.loc 1 987 7 is_stmt 1 view .LVU532
+.LVL144:
+	.loc 1 988 7 view .LVU533
+	call	memcpy@PLT
+.LVL145:
+	.loc 1 989 7 view .LVU534
+	.loc 1 989 9 is_stmt 0 view .LVU535
+	leaq	(%rax,%r14), %rax
+	movl	12(%rsp), %r8d
+.LVL146:
+	.loc 1 989 9 view .LVU536
+	jmp	.L91
+.LVL147:
+	.p2align 4,,10
+	.p2align 3
+.L119:
+	.loc 1 994 5 is_stmt 1 view .LVU537
+	.loc 1 994 49 is_stmt 0 view .LVU538
+	movl	$1, %esi
+	subl	%r8d, %esi
+	.loc 1 994 10 view .LVU539
+	movslq	%esi, %rsi
+	.loc 1 993 10 view .LVU540
+	movl	$45, %edx
+	jmp	.L93
+.LVL148:
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	.loc 1 993 10 view .LVU541
+.LBE156:
+	.loc 1 964 7 view .LVU542
+	testb	$4, %r15b
+	jne	.L122
+	testq	%r15, %r15
+	je	.L80
+	movb	$48, (%rax)
+	testb	$2, %r15b
+	je	.L80
+	movl	$12336, %edx
+	movw	%dx, -2(%rax,%r15)
+	jmp	.L80
+.LVL149:
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.loc 1 968 7 view .LVU543
+	movq	(%rsi), %rax
+.LVL150:
+	.loc 1 968 7 view .LVU544
+	leaq	8(%r12), %rdi
+.LVL151:
+	.loc 1 968 7 view .LVU545
+	movq	%rax, (%r12)
+	movl	%r8d, %eax
+	andq	$-8, %rdi
+	movq	-8(%rsi,%rax), %rdx
+.LVL152:
+	.loc 1 968 7 view .LVU546
+	movq	%rsi, %r9
+	movq	%rdx, -8(%r12,%rax)
+	movq	%r12, %rax
+	subq	%rdi, %rax
+	subq	%rax, %r9
+	addl	%r8d, %eax
+	andl	$-8, %eax
+	cmpl	$8, %eax
+	jb	.L82
+	andl	$-8, %eax
+	xorl	%edx, %edx
+.LVL153:
+.L85:
+	.loc 1 968 7 view .LVU547
+	movl	%edx, %ecx
+	movq	(%r9,%rcx), %r8
+	addl	$8, %edx
+	movq	%r8, (%rdi,%rcx)
+	cmpl	%eax, %edx
+	jb	.L85
+	jmp	.L82
+.LVL154:
+	.p2align 4,,10
+	.p2align 3
+.L122:
+	.loc 1 964 7 view .LVU548
+	movl	$808464432, (%rax)
+	movl	$808464432, -4(%rax,%r15)
+	jmp	.L80
+.LVL155:
+	.p2align 4,,10
+	.p2align 3
+.L120:
+	.loc 1 968 7 view .LVU549
+	movl	(%rsi), %eax
+.LVL156:
+	.loc 1 968 7 view .LVU550
+	movl	%r8d, %ebp
+	movl	%eax, (%r12)
+	movl	-4(%rsi,%rbp), %eax
+	movl	%eax, -4(%r12,%rbp)
+	jmp	.L82
+.L121:
+	.loc 1 968 7 view .LVU551
+	movl	%r8d, %ebp
+	movzwl	-2(%rsi,%rbp), %eax
+	movw	%ax, -2(%r12,%rbp)
+	jmp	.L82
+	.cfi_endproc
+.LFE33:
+	.size	numeric_formatter_write, .-numeric_formatter_write
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"nan"
+.LC1:
+	.string	"-inf"
+.LC2:
+	.string	"inf"
+.LC3:
+	.string	"-0"
+.LC4:
+	.string	"0"
+	.text
+	.p2align 4
+	.globl	dtos_to
+	.type	dtos_to, @function
+dtos_to:
+.LVL157:
+.LFB35:
+	.loc 1 1027 50 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1028 3 view .LVU553
+	.loc 1 1029 3 view .LVU554
+	.loc 1 1027 50 is_stmt 0 view .LVU555
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+.LBB159:
+.LBB160:
+	.loc 1 1007 18 view .LVU556
+	movabsq	$4503599627370495, %rdi
+.LVL158:
+	.loc 1 1007 18 view .LVU557
+.LBE160:
+.LBE159:
+	.loc 1 1027 50 view .LVU558
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	.loc 1 1029 3 view .LVU559
+	vmovq	%xmm0, %rbx
+.LVL159:
+	.loc 1 1030 3 is_stmt 1 view .LVU560
+.LBB166:
+.LBI159:
+	.loc 1 1006 15 view .LVU561
+.LBB161:
+	.loc 1 1007 3 view .LVU562
+	.loc 1 1008 51 is_stmt 0 view .LVU563
+	movq	%rbx, %rsi
+	shrq	$52, %rsi
+	.loc 1 1008 18 view .LVU564
+	andl	$2047, %esi
+	.loc 1 1007 18 view .LVU565
+	andq	%rbx, %rdi
+.LVL160:
+	.loc 1 1008 3 is_stmt 1 view .LVU566
+	.loc 1 1009 3 view .LVU567
+.LBE161:
+.LBE166:
+	.loc 1 1027 50 is_stmt 0 view .LVU568
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 80
+.LBB167:
+.LBB162:
+	.loc 1 1009 35 view .LVU569
+	shrq	$63, %rbx
+.LVL161:
+	.loc 1 1010 3 is_stmt 1 view .LVU570
+	.loc 1 1011 3 view .LVU571
+	.loc 1 1011 6 is_stmt 0 view .LVU572
+	cmpl	$2047, %esi
+	je	.L141
+	.loc 1 1014 8 is_stmt 1 view .LVU573
+	.loc 1 1014 11 is_stmt 0 view .LVU574
+	testl	%esi, %esi
+	jne	.L134
+	testq	%rdi, %rdi
+	jne	.L134
+	.loc 1 1015 5 is_stmt 1 view .LVU575
+	.loc 1 1015 31 is_stmt 0 view .LVU576
+	testq	%rbx, %rbx
+	leaq	.LC4(%rip), %r12
+	leaq	.LC3(%rip), %rax
+	cmovne	%rax, %r12
+.L125:
+.LVL162:
+	.loc 1 1020 3 is_stmt 1 view .LVU577
+	movq	%rbp, %rdi
+.LVL163:
+	.loc 1 1020 3 is_stmt 0 view .LVU578
+	movq	%r12, %rsi
+.LVL164:
+	.loc 1 1020 3 view .LVU579
+	call	strcpy@PLT
+.LVL165:
+	.loc 1 1021 3 is_stmt 1 view .LVU580
+.LBE162:
+.LBE167:
+	.loc 1 1045 1 is_stmt 0 view .LVU581
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL166:
+	.loc 1 1045 1 view .LVU582
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL167:
+.LBB168:
+.LBB163:
+	.loc 1 1021 10 view .LVU583
+	movq	%r12, %rdi
+.LBE163:
+.LBE168:
+	.loc 1 1045 1 view .LVU584
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LBB169:
+.LBB164:
+	.loc 1 1021 10 view .LVU585
+	jmp	strlen@PLT
+.LVL168:
+	.p2align 4,,10
+	.p2align 3
+.L134:
+	.cfi_restore_state
+	.loc 1 1021 10 view .LVU586
+.LBE164:
+.LBE169:
+	.loc 1 1031 3 is_stmt 1 view .LVU587
+	.loc 1 1034 3 view .LVU588
+	.loc 1 1035 3 view .LVU589
+	.loc 1 1036 3 view .LVU590
+	.loc 1 1036 44 is_stmt 0 view .LVU591
+	call	numeric_formatter_shortest
+.LVL169:
+	.loc 1 1036 44 view .LVU592
+	movabsq	$-3689348814741910323, %rsi
+	movq	%rdx, %rcx
+.LVL170:
+	.loc 1 1036 44 view .LVU593
+	movq	%rax, %rdx
+.LVL171:
+	.loc 1 1036 44 view .LVU594
+	imulq	%rsi, %rax
+.LVL172:
+	.loc 1 1038 32 view .LVU595
+	movabsq	$1844674407370955161, %rdi
+.LVL173:
+	.loc 1 1036 44 view .LVU596
+	movl	%ecx, %r12d
+.LVL174:
+	.loc 1 1038 3 is_stmt 1 view .LVU597
+	.loc 1 1038 32 view .LVU598
+	.loc 1 1036 44 is_stmt 0 view .LVU599
+	rorx	$1, %rax, %rax
+	incl	%ecx
+.LVL175:
+	.loc 1 1038 32 view .LVU600
+	cmpq	%rax, %rdi
+	jb	.L129
+.LVL176:
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	.loc 1 1039 5 is_stmt 1 view .LVU601
+	.loc 1 1039 22 is_stmt 0 view .LVU602
+	movq	%rdx, %rax
+	mulq	%rsi
+.LVL177:
+	.loc 1 1039 22 view .LVU603
+	movl	%ecx, %r8d
+	.loc 1 1038 32 view .LVU604
+	incl	%ecx
+.LVL178:
+	.loc 1 1039 22 view .LVU605
+	shrq	$3, %rdx
+.LVL179:
+	.loc 1 1040 5 is_stmt 1 view .LVU606
+	.loc 1 1038 32 view .LVU607
+	movq	%rdx, %rax
+	imulq	%rsi, %rax
+	rorx	$1, %rax, %rax
+	cmpq	%rax, %rdi
+	jnb	.L130
+	.loc 1 1040 21 is_stmt 0 view .LVU608
+	movl	%r8d, %r12d
+.LVL180:
+.L129:
+	.loc 1 1042 3 is_stmt 1 view .LVU609
+	.loc 1 1043 3 view .LVU610
+	.loc 1 1043 18 is_stmt 0 view .LVU611
+	movq	%rsp, %r13
+	movq	%rdx, %rsi
+	movq	%r13, %rdi
+	call	u64tos_to@PLT
+.LVL181:
+	.loc 1 1044 10 view .LVU612
+	leal	(%r12,%rax), %r8d
+	movq	%r13, %rdx
+	movl	%ebx, %esi
+	movq	%rbp, %rdi
+	.loc 1 1043 18 view .LVU613
+	movq	%rax, %rcx
+.LVL182:
+	.loc 1 1044 3 is_stmt 1 view .LVU614
+	.loc 1 1044 10 is_stmt 0 view .LVU615
+	call	numeric_formatter_write
+.LVL183:
+	.loc 1 1045 1 view .LVU616
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL184:
+	.loc 1 1045 1 view .LVU617
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL185:
+	.loc 1 1045 1 view .LVU618
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL186:
+	.p2align 4,,10
+	.p2align 3
+.L141:
+	.cfi_restore_state
+.LBB170:
+.LBB165:
+	.loc 1 1012 5 is_stmt 1 view .LVU619
+	.loc 1 1012 42 is_stmt 0 view .LVU620
+	leaq	.LC0(%rip), %r12
+	testq	%rdi, %rdi
+	jne	.L125
+	testq	%rbx, %rbx
+	leaq	.LC2(%rip), %r12
+	leaq	.LC1(%rip), %rax
+	cmovne	%rax, %r12
+	jmp	.L125
+.LBE165:
+.LBE170:
+	.cfi_endproc
+.LFE35:
+	.size	dtos_to, .-dtos_to
+	.section	.rodata.str1.1
+.LC7:
+	.string	"%.*e"
+	.text
+	.p2align 4
+	.globl	dtos_precision_to
+	.type	dtos_precision_to, @function
+dtos_precision_to:
+.LVL187:
+.LFB37:
+	.loc 1 1074 75 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1075 3 view .LVU622
+	.loc 1 1076 3 view .LVU623
+	.loc 1 1074 75 is_stmt 0 view .LVU624
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%esi, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+.LBB180:
+.LBB181:
+	.loc 1 1007 18 view .LVU625
+	movabsq	$4503599627370495, %rdi
+.LVL188:
+	.loc 1 1007 18 view .LVU626
+.LBE181:
+.LBE180:
+	.loc 1 1074 75 view .LVU627
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	.loc 1 1076 3 view .LVU628
+	vmovq	%xmm0, %rbp
+.LVL189:
+	.loc 1 1077 3 is_stmt 1 view .LVU629
+.LBB188:
+.LBI180:
+	.loc 1 1006 15 view .LVU630
+.LBB182:
+	.loc 1 1007 3 view .LVU631
+	.loc 1 1008 51 is_stmt 0 view .LVU632
+	movq	%rbp, %rsi
+.LVL190:
+	.loc 1 1008 51 view .LVU633
+.LBE182:
+.LBE188:
+	.loc 1 1074 75 view .LVU634
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+.LBB189:
+.LBB183:
+	.loc 1 1008 51 view .LVU635
+	shrq	$52, %rsi
+	.loc 1 1008 18 view .LVU636
+	andl	$2047, %esi
+	.loc 1 1007 18 view .LVU637
+	andq	%rbp, %rdi
+.LVL191:
+	.loc 1 1008 3 is_stmt 1 view .LVU638
+	.loc 1 1009 3 view .LVU639
+.LBE183:
+.LBE189:
+	.loc 1 1074 75 is_stmt 0 view .LVU640
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+.LBB190:
+.LBB184:
+	.loc 1 1009 35 view .LVU641
+	shrq	$63, %rbp
+.LVL192:
+	.loc 1 1010 3 is_stmt 1 view .LVU642
+	.loc 1 1011 3 view .LVU643
+	.loc 1 1011 6 is_stmt 0 view .LVU644
+	cmpl	$2047, %esi
+	je	.L214
+	.loc 1 1014 8 is_stmt 1 view .LVU645
+	.loc 1 1014 26 is_stmt 0 view .LVU646
+	testl	%esi, %esi
+	sete	%r14b
+	.loc 1 1014 11 view .LVU647
+	testq	%rdi, %rdi
+	jne	.L188
+	testb	%r14b, %r14b
+	je	.L188
+	.loc 1 1015 5 is_stmt 1 view .LVU648
+	.loc 1 1015 31 is_stmt 0 view .LVU649
+	testq	%rbp, %rbp
+	leaq	.LC4(%rip), %rbx
+	leaq	.LC3(%rip), %rax
+	cmovne	%rax, %rbx
+.L144:
+.LVL193:
+	.loc 1 1020 3 is_stmt 1 view .LVU650
+	movq	%r12, %rdi
+.LVL194:
+	.loc 1 1020 3 is_stmt 0 view .LVU651
+	movq	%rbx, %rsi
+.LVL195:
+	.loc 1 1020 3 view .LVU652
+	call	strcpy@PLT
+.LVL196:
+	.loc 1 1021 3 is_stmt 1 view .LVU653
+.LBE184:
+.LBE190:
+	.loc 1 1126 1 is_stmt 0 view .LVU654
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+.LBB191:
+.LBB185:
+	.loc 1 1021 10 view .LVU655
+	movq	%rbx, %rdi
+.LBE185:
+.LBE191:
+	.loc 1 1126 1 view .LVU656
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL197:
+	.loc 1 1126 1 view .LVU657
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL198:
+	.loc 1 1126 1 view .LVU658
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL199:
+.LBB192:
+.LBB186:
+	.loc 1 1021 10 view .LVU659
+	jmp	strlen@PLT
+.LVL200:
+	.p2align 4,,10
+	.p2align 3
+.L188:
+	.cfi_restore_state
+	.loc 1 1021 10 view .LVU660
+.LBE186:
+.LBE192:
+	.loc 1 1084 6 view .LVU661
+	movl	$17, %r13d
+	cmpl	%r13d, %r15d
+	cmovle	%r15d, %r13d
+	movl	$1, %eax
+	testl	%r13d, %r13d
+	cmovle	%eax, %r13d
+	vmovsd	%xmm0, 8(%rsp)
+.LVL201:
+	.loc 1 1078 3 is_stmt 1 view .LVU662
+	.loc 1 1081 3 view .LVU663
+	.loc 1 1087 3 view .LVU664
+	.loc 1 1088 3 view .LVU665
+	.loc 1 1089 3 view .LVU666
+	.loc 1 1091 18 is_stmt 0 view .LVU667
+	leaq	16(%rsp), %rbx
+	.loc 1 1089 44 view .LVU668
+	call	numeric_formatter_shortest
+.LVL202:
+	.loc 1 1090 3 is_stmt 1 view .LVU669
+	.loc 1 1091 3 view .LVU670
+	.loc 1 1089 44 is_stmt 0 view .LVU671
+	movq	%rax, %rsi
+.LVL203:
+	.loc 1 1091 18 view .LVU672
+	movq	%rbx, %rdi
+	.loc 1 1089 44 view .LVU673
+	movq	%rdx, (%rsp)
+	.loc 1 1091 18 view .LVU674
+	call	u64tos_to@PLT
+.LVL204:
+	.loc 1 1092 34 view .LVU675
+	movl	(%rsp), %r8d
+	.loc 1 1091 18 view .LVU676
+	movq	%rax, %rsi
+.LVL205:
+	.loc 1 1092 3 is_stmt 1 view .LVU677
+	.loc 1 1093 15 is_stmt 0 view .LVU678
+	movslq	%r13d, %rcx
+	.loc 1 1092 34 view .LVU679
+	addl	%eax, %r8d
+.LVL206:
+	.loc 1 1093 3 is_stmt 1 view .LVU680
+	.loc 1 1093 6 is_stmt 0 view .LVU681
+	cmpq	%rsi, %rcx
+	vmovsd	8(%rsp), %xmm0
+	.loc 1 1093 15 view .LVU682
+	movq	%rcx, %rax
+.LVL207:
+	.loc 1 1093 6 view .LVU683
+	jnb	.L215
+.LBB193:
+	.loc 1 1096 5 is_stmt 1 view .LVU684
+	.loc 1 1096 29 is_stmt 0 view .LVU685
+	leal	1(%r13), %edx
+	.loc 1 1096 12 view .LVU686
+	movslq	%edx, %rdx
+.LVL208:
+	.loc 1 1097 5 is_stmt 1 view .LVU687
+	.loc 1 1097 25 view .LVU688
+	cmpq	%rsi, %rdx
+	jb	.L149
+	jmp	.L150
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	.loc 1 1098 7 view .LVU689
+	.loc 1 1098 11 is_stmt 0 view .LVU690
+	incq	%rdx
+.LVL209:
+	.loc 1 1097 25 is_stmt 1 view .LVU691
+	cmpq	%rsi, %rdx
+	jnb	.L150
+.L149:
+	.loc 1 1097 25 is_stmt 0 discriminator 1 view .LVU692
+	cmpb	$48, (%rbx,%rdx)
+	je	.L151
+.L150:
+	.loc 1 1100 5 is_stmt 1 view .LVU693
+	.loc 1 1100 15 is_stmt 0 view .LVU694
+	movzbl	16(%rsp,%rax), %edi
+	.loc 1 1100 34 view .LVU695
+	cmpq	%rdx, %rsi
+	jne	.L152
+	.loc 1 1100 34 view .LVU696
+	cmpb	$53, %dil
+	je	.L216
+.L152:
+.LBB194:
+	.loc 1 1104 7 is_stmt 1 view .LVU697
+.LVL210:
+	.loc 1 1105 7 view .LVU698
+	.loc 1 1106 7 view .LVU699
+.LBB195:
+	.loc 1 1106 12 view .LVU700
+	.loc 1 1106 39 view .LVU701
+	cmpb	$52, %dil
+	jle	.L176
+.LVL211:
+.L164:
+	.loc 1 1107 9 view .LVU702
+	.loc 1 1107 29 is_stmt 0 view .LVU703
+	decq	%rax
+.LVL212:
+	.loc 1 1107 26 view .LVU704
+	movzbl	(%rbx,%rax), %edx
+.LVL213:
+	.loc 1 1108 9 is_stmt 1 view .LVU705
+	.loc 1 1108 23 is_stmt 0 view .LVU706
+	cmpb	$57, %dl
+	je	.L163
+	.loc 1 1108 56 view .LVU707
+	incl	%edx
+.LVL214:
+	.loc 1 1108 56 view .LVU708
+	movb	%dl, 16(%rsp,%rax)
+.LVL215:
+	.loc 1 1106 50 is_stmt 1 view .LVU709
+	.loc 1 1106 39 view .LVU710
+.LBE195:
+	.loc 1 1110 7 view .LVU711
+	jmp	.L176
+.LVL216:
+	.p2align 4,,10
+	.p2align 3
+.L187:
+	.loc 1 1110 7 is_stmt 0 view .LVU712
+.LBE194:
+.LBE193:
+	.loc 1 1123 10 view .LVU713
+	movq	%rax, %rcx
+.LVL217:
+.L176:
+	.loc 1 1122 20 is_stmt 1 view .LVU714
+	cmpq	$1, %rcx
+	jbe	.L175
+	.loc 1 1122 20 is_stmt 0 discriminator 1 view .LVU715
+	cmpb	$48, -1(%rbx,%rcx)
+	.loc 1 1122 36 discriminator 1 view .LVU716
+	leaq	-1(%rcx), %rax
+	.loc 1 1122 20 discriminator 1 view .LVU717
+	je	.L187
+.LVL218:
+.L175:
+	.loc 1 1125 3 is_stmt 1 view .LVU718
+	.loc 1 1125 10 is_stmt 0 view .LVU719
+	movq	%rbx, %rdx
+	movl	%ebp, %esi
+	movq	%r12, %rdi
+	call	numeric_formatter_write
+.LVL219:
+	.loc 1 1126 1 view .LVU720
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL220:
+	.loc 1 1126 1 view .LVU721
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL221:
+	.loc 1 1126 1 view .LVU722
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL222:
+	.loc 1 1126 1 view .LVU723
+	ret
+.LVL223:
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	.cfi_restore_state
+.LBB200:
+.LBB197:
+.LBB196:
+	.loc 1 1108 23 view .LVU724
+	movb	$48, (%rbx,%rax)
+	.loc 1 1106 50 is_stmt 1 view .LVU725
+	.loc 1 1106 39 view .LVU726
+	testq	%rax, %rax
+	jne	.L164
+.LBE196:
+	.loc 1 1110 7 view .LVU727
+	.loc 1 1112 9 view .LVU728
+	.loc 1 1112 19 is_stmt 0 view .LVU729
+	movb	$49, 16(%rsp)
+	.loc 1 1113 9 is_stmt 1 view .LVU730
+	.loc 1 1113 14 is_stmt 0 view .LVU731
+	incl	%r8d
+.LVL224:
+	.loc 1 1113 14 view .LVU732
+	jmp	.L176
+.LVL225:
+	.p2align 4,,10
+	.p2align 3
+.L214:
+	.loc 1 1113 14 view .LVU733
+.LBE197:
+.LBE200:
+.LBB201:
+.LBB187:
+	.loc 1 1012 5 is_stmt 1 view .LVU734
+	.loc 1 1012 42 is_stmt 0 view .LVU735
+	leaq	.LC0(%rip), %rbx
+	testq	%rdi, %rdi
+	jne	.L144
+	testq	%rbp, %rbp
+	leaq	.LC2(%rip), %rbx
+	leaq	.LC1(%rip), %rax
+	cmovne	%rax, %rbx
+	jmp	.L144
+.LVL226:
+	.p2align 4,,10
+	.p2align 3
+.L215:
+	.loc 1 1012 42 view .LVU736
+.LBE187:
+.LBE201:
+	.loc 1 1117 8 is_stmt 1 view .LVU737
+	.loc 1 1117 11 is_stmt 0 view .LVU738
+	cmpl	$15, %r15d
+	jg	.L190
+	movq	%rsi, %rcx
+	testb	%r14b, %r14b
+	je	.L176
+.L190:
+	.loc 1 1120 5 is_stmt 1 view .LVU739
+.LVL227:
+.LBB202:
+.LBI202:
+	.loc 1 1053 15 view .LVU740
+.LBB203:
+	.loc 1 1054 3 view .LVU741
+	.loc 1 1055 3 view .LVU742
+	vxorpd	%xmm1, %xmm1, %xmm1
+	vxorpd	.LC6(%rip), %xmm0, %xmm3
+	vmovsd	%xmm0, %xmm0, %xmm2
+	vcmpltsd	%xmm1, %xmm0, %xmm0
+.LVL228:
+	.loc 1 1055 3 is_stmt 0 view .LVU743
+	leal	-1(%r13), %ecx
+	leaq	64(%rsp), %r13
+.LVL229:
+	.loc 1 1055 3 view .LVU744
+	movq	%r13, %rdi
+	vblendvpd	%xmm0, %xmm3, %xmm2, %xmm0
+	leaq	.LC7(%rip), %rdx
+	movl	$49, %esi
+.LVL230:
+	.loc 1 1055 3 view .LVU745
+	movl	$1, %eax
+	call	snprintf@PLT
+.LVL231:
+	.loc 1 1057 3 is_stmt 1 view .LVU746
+	.loc 1 1058 3 view .LVU747
+	.loc 1 1059 3 view .LVU748
+	.loc 1 1059 13 view .LVU749
+	.loc 1 1059 10 is_stmt 0 view .LVU750
+	movzbl	64(%rsp), %eax
+	.loc 1 1058 15 view .LVU751
+	movq	%r13, %rdi
+	.loc 1 1057 10 view .LVU752
+	xorl	%ecx, %ecx
+	.loc 1 1059 13 view .LVU753
+	cmpb	$101, %al
+	je	.L169
+.LVL232:
+	.p2align 4,,10
+	.p2align 3
+.L172:
+	.loc 1 1060 5 is_stmt 1 view .LVU754
+	.loc 1 1060 19 is_stmt 0 view .LVU755
+	leal	-48(%rax), %edx
+	.loc 1 1060 8 view .LVU756
+	cmpb	$9, %dl
+	ja	.L170
+	.loc 1 1061 7 is_stmt 1 view .LVU757
+	.loc 1 1059 22 is_stmt 0 view .LVU758
+	incq	%rdi
+.LVL233:
+	.loc 1 1061 23 view .LVU759
+	movb	%al, 16(%rsp,%rcx)
+	.loc 1 1059 10 view .LVU760
+	movzbl	(%rdi), %eax
+	.loc 1 1061 19 view .LVU761
+	leaq	1(%rcx), %rdx
+.LVL234:
+	.loc 1 1059 22 is_stmt 1 view .LVU762
+	.loc 1 1059 13 view .LVU763
+	.loc 1 1061 19 is_stmt 0 view .LVU764
+	movq	%rdx, %rcx
+	.loc 1 1059 13 view .LVU765
+	cmpb	$101, %al
+	jne	.L172
+.LVL235:
+.L169:
+	.loc 1 1064 21 view .LVU766
+	incq	%rdi
+.LVL236:
+	.loc 1 1064 21 view .LVU767
+	movl	$10, %edx
+	xorl	%esi, %esi
+	movq	%rcx, (%rsp)
+	.loc 1 1064 3 is_stmt 1 view .LVU768
+	.loc 1 1064 21 is_stmt 0 view .LVU769
+	call	strtol@PLT
+.LVL237:
+	.loc 1 1064 44 view .LVU770
+	leal	1(%rax), %r8d
+.LVL238:
+	.loc 1 1065 3 is_stmt 1 view .LVU771
+	.loc 1 1065 9 is_stmt 0 view .LVU772
+	movq	(%rsp), %rcx
+	jmp	.L174
+.LVL239:
+	.p2align 4,,10
+	.p2align 3
+.L217:
+	.loc 1 1065 20 view .LVU773
+	cmpb	$48, -1(%rbx,%rcx)
+	.loc 1 1065 29 view .LVU774
+	leaq	-1(%rcx), %rax
+	.loc 1 1065 20 view .LVU775
+	jne	.L176
+	.loc 1 1066 10 view .LVU776
+	movq	%rax, %rcx
+.LVL240:
+.L174:
+	.loc 1 1065 20 is_stmt 1 view .LVU777
+	cmpq	$1, %rcx
+	ja	.L217
+	jmp	.L175
+.LVL241:
+	.p2align 4,,10
+	.p2align 3
+.L170:
+	.loc 1 1059 22 view .LVU778
+	.loc 1 1059 10 is_stmt 0 view .LVU779
+	movzbl	1(%rdi), %eax
+	.loc 1 1059 22 view .LVU780
+	incq	%rdi
+.LVL242:
+	.loc 1 1059 13 is_stmt 1 view .LVU781
+	cmpb	$101, %al
+	jne	.L172
+	jmp	.L169
+.LVL243:
+.L216:
+	.loc 1 1059 13 is_stmt 0 view .LVU782
+.LBE203:
+.LBE202:
+.LBB204:
+	.loc 1 1101 7 is_stmt 1 view .LVU783
+.LBB198:
+.LBI198:
+	.loc 1 1053 15 view .LVU784
+.LBB199:
+	.loc 1 1054 3 view .LVU785
+	.loc 1 1055 3 view .LVU786
+	vxorpd	%xmm1, %xmm1, %xmm1
+	vxorpd	.LC6(%rip), %xmm0, %xmm3
+	vmovsd	%xmm0, %xmm0, %xmm2
+	vcmpltsd	%xmm1, %xmm0, %xmm0
+.LVL244:
+	.loc 1 1055 3 is_stmt 0 view .LVU787
+	leaq	64(%rsp), %r14
+	leal	-1(%r13), %ecx
+	leaq	.LC7(%rip), %rdx
+.LVL245:
+	.loc 1 1055 3 view .LVU788
+	vblendvpd	%xmm0, %xmm3, %xmm2, %xmm0
+	movl	$49, %esi
+.LVL246:
+	.loc 1 1055 3 view .LVU789
+	movq	%r14, %rdi
+	movl	$1, %eax
+	call	snprintf@PLT
+.LVL247:
+	.loc 1 1057 3 is_stmt 1 view .LVU790
+	.loc 1 1058 3 view .LVU791
+	.loc 1 1059 3 view .LVU792
+	.loc 1 1059 13 view .LVU793
+	.loc 1 1059 10 is_stmt 0 view .LVU794
+	movzbl	64(%rsp), %edx
+	.loc 1 1058 15 view .LVU795
+	movq	%r14, %rax
+	.loc 1 1057 10 view .LVU796
+	xorl	%ecx, %ecx
+	.loc 1 1059 13 view .LVU797
+	cmpb	$101, %dl
+	je	.L155
+.LVL248:
+	.p2align 4,,10
+	.p2align 3
+.L158:
+	.loc 1 1060 5 is_stmt 1 view .LVU798
+	.loc 1 1060 19 is_stmt 0 view .LVU799
+	leal	-48(%rdx), %esi
+	.loc 1 1060 8 view .LVU800
+	cmpb	$9, %sil
+	ja	.L156
+	.loc 1 1061 7 is_stmt 1 view .LVU801
+	.loc 1 1059 22 is_stmt 0 view .LVU802
+	incq	%rax
+.LVL249:
+	.loc 1 1061 23 view .LVU803
+	movb	%dl, 16(%rsp,%rcx)
+	.loc 1 1059 10 view .LVU804
+	movzbl	(%rax), %edx
+	.loc 1 1061 19 view .LVU805
+	leaq	1(%rcx), %rsi
+.LVL250:
+	.loc 1 1059 22 is_stmt 1 view .LVU806
+	.loc 1 1059 13 view .LVU807
+	.loc 1 1061 19 is_stmt 0 view .LVU808
+	movq	%rsi, %rcx
+	.loc 1 1059 13 view .LVU809
+	cmpb	$101, %dl
+	jne	.L158
+.LVL251:
+.L155:
+	.loc 1 1064 21 view .LVU810
+	leaq	1(%rax), %rdi
+	movl	$10, %edx
+	xorl	%esi, %esi
+	movq	%rcx, (%rsp)
+	.loc 1 1064 3 is_stmt 1 view .LVU811
+	.loc 1 1064 21 is_stmt 0 view .LVU812
+	call	strtol@PLT
+.LVL252:
+	.loc 1 1064 44 view .LVU813
+	leal	1(%rax), %r8d
+.LVL253:
+	.loc 1 1065 3 is_stmt 1 view .LVU814
+	.loc 1 1065 9 is_stmt 0 view .LVU815
+	movq	(%rsp), %rcx
+	jmp	.L160
+.LVL254:
+	.p2align 4,,10
+	.p2align 3
+.L218:
+	.loc 1 1065 20 view .LVU816
+	cmpb	$48, -1(%rbx,%rcx)
+	.loc 1 1065 29 view .LVU817
+	leaq	-1(%rcx), %rax
+	.loc 1 1065 20 view .LVU818
+	jne	.L176
+	.loc 1 1066 10 view .LVU819
+	movq	%rax, %rcx
+.LVL255:
+.L160:
+	.loc 1 1065 20 is_stmt 1 view .LVU820
+	cmpq	$1, %rcx
+	ja	.L218
+	jmp	.L175
+.LVL256:
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	.loc 1 1059 22 view .LVU821
+	.loc 1 1059 10 is_stmt 0 view .LVU822
+	movzbl	1(%rax), %edx
+	.loc 1 1059 22 view .LVU823
+	incq	%rax
+.LVL257:
+	.loc 1 1059 13 is_stmt 1 view .LVU824
+	cmpb	$101, %dl
+	jne	.L158
+	jmp	.L155
+.LBE199:
+.LBE198:
+.LBE204:
+	.cfi_endproc
+.LFE37:
+	.size	dtos_precision_to, .-dtos_precision_to
+	.section	.rodata.str1.1
+.LC8:
+	.string	"%.*f"
+	.text
+	.p2align 4
+	.globl	dtos_fixed_to
+	.type	dtos_fixed_to, @function
+dtos_fixed_to:
+.LVL258:
+.LFB39:
+	.loc 1 1182 71 view -0
+	.cfi_startproc
+	.loc 1 1182 71 is_stmt 0 view .LVU826
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 1190 3 view .LVU827
+	vmovq	%xmm0, %r8
+	.loc 1 1192 51 view .LVU828
+	movq	%r8, %rdx
+	.loc 1 1182 71 view .LVU829
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	.loc 1 1183 3 is_stmt 1 view .LVU830
+	.loc 1 1182 71 is_stmt 0 view .LVU831
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	.loc 1 1186 6 view .LVU832
+	movl	$20, %ebx
+	.loc 1 1182 71 view .LVU833
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 1186 6 view .LVU834
+	cmpl	%ebx, %esi
+	cmovle	%esi, %ebx
+	xorl	%eax, %eax
+	testl	%ebx, %ebx
+	cmovs	%eax, %ebx
+.LVL259:
+	.loc 1 1189 3 is_stmt 1 view .LVU835
+	.loc 1 1190 3 view .LVU836
+	.loc 1 1191 3 view .LVU837
+	.loc 1 1192 51 is_stmt 0 view .LVU838
+	shrq	$52, %rdx
+	.loc 1 1192 18 view .LVU839
+	movl	%edx, %edi
+.LVL260:
+	.loc 1 1191 18 view .LVU840
+	movabsq	$4503599627370495, %rax
+	.loc 1 1192 18 view .LVU841
+	andl	$2047, %edi
+	.loc 1 1191 18 view .LVU842
+	andq	%r8, %rax
+.LVL261:
+	.loc 1 1192 3 is_stmt 1 view .LVU843
+	.loc 1 1193 3 view .LVU844
+	.loc 1 1193 6 is_stmt 0 view .LVU845
+	cmpl	$2047, %edi
+	je	.L250
+	movl	%esi, %r12d
+	.loc 1 1197 3 is_stmt 1 view .LVU846
+	.loc 1 1197 51 is_stmt 0 view .LVU847
+	testl	%edi, %edi
+	je	.L251
+	.loc 1 1197 51 discriminator 1 view .LVU848
+	btsq	$52, %rax
+.LVL262:
+	.loc 1 1198 3 is_stmt 1 discriminator 1 view .LVU849
+	.loc 1 1198 72 is_stmt 0 discriminator 1 view .LVU850
+	leal	-1075(%rdi), %r9d
+.LVL263:
+	.loc 1 1199 3 is_stmt 1 discriminator 1 view .LVU851
+	.loc 1 1200 3 discriminator 1 view .LVU852
+	.loc 1 1200 6 is_stmt 0 discriminator 1 view .LVU853
+	cmpl	$19, %esi
+	jg	.L223
+.LVL264:
+.LBB212:
+.LBI212:
+	.loc 1 1147 12 is_stmt 1 view .LVU854
+.LBB213:
+	.loc 1 1148 3 view .LVU855
+	.loc 1 1148 12 is_stmt 0 view .LVU856
+	movslq	%ebx, %r15
+	leaq	numeric_formatter_fixed_powers(%rip), %rcx
+	movq	(%rcx,%r15,8), %r14
+.LVL265:
+	.loc 1 1149 3 is_stmt 1 view .LVU857
+	.loc 1 1149 6 is_stmt 0 view .LVU858
+	testl	%r9d, %r9d
+	js	.L227
+	.loc 1 1151 5 is_stmt 1 view .LVU859
+	.loc 1 1151 8 is_stmt 0 view .LVU860
+	cmpl	$10, %r9d
+	jg	.L228
+	.loc 1 1151 27 view .LVU861
+	shlx	%r9, %rax, %rbp
+	.loc 1 1151 33 view .LVU862
+	movq	%rbp, %rax
+.LVL266:
+	.loc 1 1151 33 view .LVU863
+	mulq	%r14
+	movq	%rax, %rbp
+	jo	.L228
+.LVL267:
+.L249:
+	.loc 1 1151 33 view .LVU864
+.LBE213:
+.LBE212:
+	.loc 1 1216 13 view .LVU865
+	xorl	%edx, %edx
+	divq	%r14
+	movq	%r13, %rdi
+	.loc 1 1211 10 view .LVU866
+	xorl	%edx, %edx
+	.loc 1 1216 13 view .LVU867
+	movq	%rax, %rsi
+	.loc 1 1211 3 is_stmt 1 view .LVU868
+.LVL268:
+	.loc 1 1212 3 view .LVU869
+	.loc 1 1212 6 is_stmt 0 view .LVU870
+	testq	%r8, %r8
+	js	.L252
+.LVL269:
+.L237:
+	.loc 1 1212 6 view .LVU871
+	movq	%rdx, 8(%rsp)
+.LVL270:
+	.loc 1 1215 3 is_stmt 1 view .LVU872
+	.loc 1 1216 3 view .LVU873
+	.loc 1 1216 13 is_stmt 0 view .LVU874
+	call	u64tos_to@PLT
+.LVL271:
+	.loc 1 1216 10 view .LVU875
+	movq	8(%rsp), %rdx
+	leaq	(%rdx,%rax), %rdi
+.LVL272:
+	.loc 1 1217 3 is_stmt 1 view .LVU876
+	.loc 1 1217 6 is_stmt 0 view .LVU877
+	testl	%r12d, %r12d
+	jle	.L238
+.LBB217:
+	.loc 1 1218 5 is_stmt 1 view .LVU878
+	.loc 1 1218 14 is_stmt 0 view .LVU879
+	movq	%rbp, %rax
+	xorl	%edx, %edx
+	divq	%r14
+	.loc 1 1219 20 view .LVU880
+	movb	$46, 0(%r13,%rdi)
+	leaq	-1(%r13,%r15), %r8
+	leal	-1(%rbx), %eax
+	leaq	(%rdi,%r15), %rsi
+	subq	%rax, %r8
+	addq	%r13, %rsi
+	addq	%rdi, %r8
+.LBB218:
+	.loc 1 1221 50 view .LVU881
+	movabsq	$-3689348814741910323, %r9
+.LBE218:
+	.loc 1 1218 14 view .LVU882
+	movq	%rdx, %rcx
+.LVL273:
+	.loc 1 1219 5 is_stmt 1 view .LVU883
+	.loc 1 1220 5 view .LVU884
+.LBB219:
+	.loc 1 1220 10 view .LVU885
+	.loc 1 1220 31 view .LVU886
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	.loc 1 1221 7 discriminator 3 view .LVU887
+	.loc 1 1221 50 is_stmt 0 discriminator 3 view .LVU888
+	movq	%rcx, %rax
+	mulq	%r9
+	.loc 1 1220 31 discriminator 3 view .LVU889
+	decq	%rsi
+.LVL274:
+	.loc 1 1221 50 discriminator 3 view .LVU890
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+.LVL275:
+	.loc 1 1221 39 discriminator 3 view .LVU891
+	addl	$48, %ecx
+	movb	%cl, 1(%rsi)
+	.loc 1 1222 7 is_stmt 1 discriminator 3 view .LVU892
+	.loc 1 1222 16 is_stmt 0 discriminator 3 view .LVU893
+	movq	%rdx, %rcx
+.LVL276:
+	.loc 1 1220 37 is_stmt 1 discriminator 3 view .LVU894
+	.loc 1 1220 31 discriminator 3 view .LVU895
+	cmpq	%r8, %rsi
+	jne	.L239
+.LBE219:
+	.loc 1 1224 5 view .LVU896
+	.loc 1 1224 25 is_stmt 0 view .LVU897
+	incl	%ebx
+.LVL277:
+	.loc 1 1224 25 view .LVU898
+	movslq	%ebx, %rbx
+	.loc 1 1224 12 view .LVU899
+	addq	%rbx, %rdi
+.LVL278:
+.L238:
+	.loc 1 1224 12 view .LVU900
+.LBE217:
+	.loc 1 1226 3 is_stmt 1 view .LVU901
+	.loc 1 1226 18 is_stmt 0 view .LVU902
+	movb	$0, 0(%r13,%rdi)
+	.loc 1 1227 3 is_stmt 1 view .LVU903
+.LVL279:
+.L219:
+	.loc 1 1228 1 is_stmt 0 view .LVU904
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL280:
+	.loc 1 1228 1 view .LVU905
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL281:
+	.loc 1 1228 1 view .LVU906
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	movq	%rdi, %rax
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL282:
+	.p2align 4,,10
+	.p2align 3
+.L251:
+	.cfi_restore_state
+	.loc 1 1199 3 is_stmt 1 view .LVU907
+	.loc 1 1200 3 view .LVU908
+	.loc 1 1200 6 is_stmt 0 view .LVU909
+	cmpl	$19, %esi
+	jg	.L223
+.LVL283:
+.LBB220:
+	.loc 1 1147 12 is_stmt 1 view .LVU910
+.LBB214:
+	.loc 1 1148 3 view .LVU911
+	.loc 1 1148 12 is_stmt 0 view .LVU912
+	movslq	%ebx, %r15
+	leaq	numeric_formatter_fixed_powers(%rip), %rax
+	movq	(%rax,%r15,8), %r14
+.LVL284:
+	.loc 1 1149 3 is_stmt 1 view .LVU913
+	.loc 1 1158 17 view .LVU914
+	.loc 1 1159 3 view .LVU915
+	.loc 1 1160 3 view .LVU916
+	.loc 1 1161 3 view .LVU917
+	.loc 1 1148 12 is_stmt 0 view .LVU918
+	xorl	%esi, %esi
+	.loc 1 1163 13 view .LVU919
+	xorl	%ebp, %ebp
+.LVL285:
+.L224:
+	.loc 1 1163 13 view .LVU920
+.LBE214:
+.LBE220:
+	.loc 1 1211 3 is_stmt 1 view .LVU921
+	.loc 1 1212 3 view .LVU922
+	movq	%r13, %rdi
+.LVL286:
+	.loc 1 1211 10 is_stmt 0 view .LVU923
+	xorl	%edx, %edx
+	.loc 1 1212 6 view .LVU924
+	testq	%r8, %r8
+	jns	.L237
+.LVL287:
+	.p2align 4,,10
+	.p2align 3
+.L252:
+	.loc 1 1213 5 is_stmt 1 view .LVU925
+	.loc 1 1213 22 is_stmt 0 view .LVU926
+	movb	$45, 0(%r13)
+	.loc 1 1216 13 view .LVU927
+	leaq	1(%r13), %rdi
+.LVL288:
+	.loc 1 1213 18 view .LVU928
+	movl	$1, %edx
+	jmp	.L237
+.LVL289:
+	.p2align 4,,10
+	.p2align 3
+.L228:
+.LBB221:
+	.loc 1 1202 5 is_stmt 1 view .LVU929
+	.loc 1 1202 18 is_stmt 0 view .LVU930
+	movl	%ebx, %ecx
+	leaq	.LC8(%rip), %rdx
+	movl	$332, %esi
+	movq	%r13, %rdi
+.LVL290:
+	.loc 1 1202 18 view .LVU931
+	movl	$1, %eax
+	call	snprintf@PLT
+.LVL291:
+	.loc 1 1203 5 is_stmt 1 view .LVU932
+	.loc 1 1203 71 is_stmt 0 view .LVU933
+	testl	%r12d, %r12d
+	jg	.L226
+	.loc 1 1208 12 view .LVU934
+	movslq	%eax, %rdi
+	jmp	.L219
+.LVL292:
+	.p2align 4,,10
+	.p2align 3
+.L223:
+	.loc 1 1202 5 is_stmt 1 view .LVU935
+	.loc 1 1202 18 is_stmt 0 view .LVU936
+	movl	%ebx, %ecx
+	leaq	.LC8(%rip), %rdx
+	movl	$332, %esi
+	movq	%r13, %rdi
+.LVL293:
+	.loc 1 1202 18 view .LVU937
+	movl	$1, %eax
+	call	snprintf@PLT
+.LVL294:
+	.loc 1 1203 5 is_stmt 1 view .LVU938
+	movslq	%ebx, %r15
+.L226:
+	.loc 1 1203 55 is_stmt 0 discriminator 1 view .LVU939
+	movslq	%eax, %rdi
+	.loc 1 1203 67 discriminator 1 view .LVU940
+	movq	%rdi, %rax
+	.loc 1 1203 67 discriminator 1 view .LVU941
+	subq	%r15, %rax
+.LVL295:
+	.loc 1 1203 71 discriminator 1 view .LVU942
+	leaq	-1(%r13,%rax), %rax
+.LVL296:
+	.loc 1 1204 5 is_stmt 1 discriminator 1 view .LVU943
+	.loc 1 1204 8 is_stmt 0 discriminator 1 view .LVU944
+	testq	%rax, %rax
+	je	.L219
+	.loc 1 1206 7 is_stmt 1 view .LVU945
+	.loc 1 1206 18 is_stmt 0 view .LVU946
+	movb	$46, (%rax)
+	jmp	.L219
+.LVL297:
+	.p2align 4,,10
+	.p2align 3
+.L250:
+	.loc 1 1206 18 view .LVU947
+.LBE221:
+	.loc 1 1194 5 is_stmt 1 view .LVU948
+.LBB222:
+.LBI222:
+	.loc 1 1006 15 view .LVU949
+.LBB223:
+	.loc 1 1007 3 view .LVU950
+	.loc 1 1008 3 view .LVU951
+	.loc 1 1009 3 view .LVU952
+	.loc 1 1010 3 view .LVU953
+	.loc 1 1011 3 view .LVU954
+	.loc 1 1012 5 view .LVU955
+	.loc 1 1012 42 is_stmt 0 view .LVU956
+	leaq	.LC0(%rip), %rbx
+.LVL298:
+	.loc 1 1012 42 view .LVU957
+	testq	%rax, %rax
+	jne	.L221
+	testq	%r8, %r8
+	leaq	.LC2(%rip), %rbx
+	leaq	.LC1(%rip), %rax
+	cmovs	%rax, %rbx
+.L221:
+.LVL299:
+	.loc 1 1020 3 is_stmt 1 view .LVU958
+	movq	%r13, %rdi
+.LVL300:
+	.loc 1 1020 3 is_stmt 0 view .LVU959
+	movq	%rbx, %rsi
+.LVL301:
+	.loc 1 1020 3 view .LVU960
+	call	strcpy@PLT
+.LVL302:
+	.loc 1 1021 3 is_stmt 1 view .LVU961
+.LBE223:
+.LBE222:
+	.loc 1 1228 1 is_stmt 0 view .LVU962
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+.LBB226:
+.LBB224:
+	.loc 1 1021 10 view .LVU963
+	movq	%rbx, %rdi
+.LBE224:
+.LBE226:
+	.loc 1 1228 1 view .LVU964
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL303:
+	.loc 1 1228 1 view .LVU965
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LBB227:
+.LBB225:
+	.loc 1 1021 10 view .LVU966
+	jmp	strlen@PLT
+.LVL304:
+.L227:
+	.cfi_restore_state
+	.loc 1 1021 10 view .LVU967
+.LBE225:
+.LBE227:
+.LBB228:
+.LBB215:
+	.loc 1 1158 17 is_stmt 1 view .LVU968
+	.loc 1 1159 3 view .LVU969
+	.loc 1 1159 17 is_stmt 0 view .LVU970
+	movq	%rax, %rdx
+	.loc 1 1160 17 view .LVU971
+	movl	$1075, %ecx
+	.loc 1 1159 17 view .LVU972
+	mulx	%r14, %r10, %r11
+.LVL305:
+	.loc 1 1160 3 is_stmt 1 view .LVU973
+	.loc 1 1160 17 is_stmt 0 view .LVU974
+	subl	%edi, %ecx
+.LVL306:
+	.loc 1 1161 3 is_stmt 1 view .LVU975
+	.loc 1 1161 6 is_stmt 0 view .LVU976
+	cmpl	$-127, %r9d
+	jl	.L242
+	.loc 1 1166 3 is_stmt 1 view .LVU977
+	.loc 1 1166 17 is_stmt 0 view .LVU978
+	movq	%r10, %rax
+.LVL307:
+	.loc 1 1166 17 view .LVU979
+	shrdq	%r11, %rax
+	xorl	%ebp, %ebp
+	movq	%r11, %rdx
+.LVL308:
+	.loc 1 1166 17 view .LVU980
+	testb	$64, %cl
+	shrx	%rcx, %rdx, %rdx
+	cmovne	%rdx, %rax
+	cmovne	%rbp, %rdx
+.LVL309:
+	.loc 1 1167 3 is_stmt 1 view .LVU981
+	.loc 1 1167 6 is_stmt 0 view .LVU982
+	testq	%rdx, %rdx
+	jne	.L228
+	.loc 1 1167 32 view .LVU983
+	movq	%rax, %rbp
+	.loc 1 1167 29 view .LVU984
+	cmpq	$-1, %rax
+	je	.L228
+	.loc 1 1170 3 is_stmt 1 view .LVU985
+	.loc 1 1170 49 is_stmt 0 view .LVU986
+	movq	%rdx, %rdi
+.LVL310:
+	.loc 1 1170 49 view .LVU987
+	shldq	%rax, %rdi
+	xorl	%edx, %edx
+	movq	%rax, %rsi
+	testb	$64, %cl
+	shlx	%rcx, %rsi, %rsi
+	cmovne	%rsi, %rdi
+	cmovne	%rdx, %rsi
+	.loc 1 1171 17 view .LVU988
+	notl	%r9d
+.LVL311:
+	.loc 1 1170 17 view .LVU989
+	subq	%rsi, %r10
+.LVL312:
+	.loc 1 1170 17 view .LVU990
+	sbbq	%rdi, %r11
+.LVL313:
+	.loc 1 1171 3 is_stmt 1 view .LVU991
+	.loc 1 1171 17 is_stmt 0 view .LVU992
+	xorl	%esi, %esi
+	xorl	%edi, %edi
+	testb	$64, %r9b
+	movl	%r9d, %ecx
+.LVL314:
+	.loc 1 1171 17 view .LVU993
+	sete	%sil
+	setne	%dil
+	shlx	%rcx, %rsi, %rsi
+	shlx	%rcx, %rdi, %rdi
+.LVL315:
+	.loc 1 1172 3 is_stmt 1 view .LVU994
+	.loc 1 1172 52 is_stmt 0 view .LVU995
+	cmpq	%r10, %rsi
+	movq	%rdi, %rcx
+	sbbq	%r11, %rcx
+	jnc	.L231
+	.loc 1 1172 32 view .LVU996
+	incq	%rbp
+.LVL316:
+.L232:
+	.loc 1 1173 3 is_stmt 1 view .LVU997
+	.loc 1 1173 3 is_stmt 0 view .LVU998
+.LBE215:
+.LBE228:
+	.loc 1 1216 13 view .LVU999
+	movq	%rbp, %rax
+	jmp	.L249
+.LVL317:
+	.p2align 4,,10
+	.p2align 3
+.L231:
+.LBB229:
+.LBB216:
+	.loc 1 1172 52 view .LVU1000
+	movq	%r11, %rcx
+	xorq	%rdi, %rcx
+	xorq	%rsi, %r10
+.LVL318:
+	.loc 1 1172 52 view .LVU1001
+	orq	%r10, %rcx
+	jne	.L232
+	.loc 1 1172 87 view .LVU1002
+	andl	$1, %eax
+.LVL319:
+	.loc 1 1172 32 view .LVU1003
+	addq	%rax, %rbp
+	jmp	.L232
+.LVL320:
+.L242:
+	.loc 1 1172 32 view .LVU1004
+	xorl	%esi, %esi
+	.loc 1 1163 13 view .LVU1005
+	xorl	%ebp, %ebp
+	jmp	.L224
+.LBE216:
+.LBE229:
+	.cfi_endproc
+.LFE39:
+	.size	dtos_fixed_to, .-dtos_fixed_to
+	.p2align 4
+	.globl	dtos_batch
+	.type	dtos_batch, @function
+dtos_batch:
+.LVL321:
+.LFB40:
+	.loc 1 1233 92 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1234 3 view .LVU1007
+	.loc 1 1235 3 view .LVU1008
+	.loc 1 1233 92 is_stmt 0 view .LVU1009
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rcx, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 1235 13 view .LVU1010
+	movb	$0, (%rdi)
+	.loc 1 1236 3 is_stmt 1 view .LVU1011
+.LBB230:
+	.loc 1 1236 8 view .LVU1012
+.LVL322:
+	.loc 1 1236 24 view .LVU1013
+	testq	%rdx, %rdx
+	je	.L254
+	movq	%rdi, %r13
+	movq	%rsi, %r14
+	.loc 1 1236 15 is_stmt 0 view .LVU1014
+	xorl	%ebp, %ebp
+.LBE230:
+	.loc 1 1234 10 view .LVU1015
+	xorl	%ebx, %ebx
+	testq	%rcx, %rcx
+	je	.L256
+.LVL323:
+	.p2align 4,,10
+	.p2align 3
+.L255:
+.LBB231:
+	.loc 1 1237 5 is_stmt 1 view .LVU1016
+	.loc 1 1238 7 view .LVU1017
+	.loc 1 1238 18 is_stmt 0 view .LVU1018
+	movq	%rbx, (%r15,%rbp,8)
+	.loc 1 1241 5 is_stmt 1 view .LVU1019
+	.loc 1 1241 15 is_stmt 0 view .LVU1020
+	vmovsd	(%r14,%rbp,8), %xmm0
+	leaq	0(%r13,%rbx), %rdi
+	call	dtos_to@PLT
+.LVL324:
+	.loc 1 1236 34 view .LVU1021
+	incq	%rbp
+.LVL325:
+	.loc 1 1241 12 view .LVU1022
+	addq	%rax, %rbx
+.LVL326:
+	.loc 1 1236 34 is_stmt 1 view .LVU1023
+	.loc 1 1236 24 view .LVU1024
+	cmpq	%rbp, %r12
+	jne	.L255
+.LVL327:
+.L258:
+	.loc 1 1236 24 is_stmt 0 view .LVU1025
+.LBE231:
+	.loc 1 1244 5 is_stmt 1 view .LVU1026
+	.loc 1 1244 20 is_stmt 0 view .LVU1027
+	movq	%rbx, (%r15,%r12,8)
+.L253:
+	.loc 1 1247 1 view .LVU1028
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL328:
+	.loc 1 1247 1 view .LVU1029
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL329:
+	.loc 1 1247 1 view .LVU1030
+	ret
+.LVL330:
+	.p2align 4,,10
+	.p2align 3
+.L256:
+	.cfi_restore_state
+.LBB232:
+	.loc 1 1237 5 is_stmt 1 view .LVU1031
+	.loc 1 1241 5 view .LVU1032
+	.loc 1 1241 15 is_stmt 0 view .LVU1033
+	vmovsd	(%r14,%rbp,8), %xmm0
+	leaq	0(%r13,%rbx), %rdi
+	call	dtos_to@PLT
+.LVL331:
+	.loc 1 1236 34 view .LVU1034
+	incq	%rbp
+.LVL332:
+	.loc 1 1241 12 view .LVU1035
+	addq	%rax, %rbx
+.LVL333:
+	.loc 1 1236 34 is_stmt 1 view .LVU1036
+	.loc 1 1236 24 view .LVU1037
+	cmpq	%rbp, %r12
+	jne	.L256
+	jmp	.L253
+.LVL334:
+	.p2align 4,,10
+	.p2align 3
+.L254:
+	.loc 1 1236 24 is_stmt 0 view .LVU1038
+.LBE232:
+	.loc 1 1243 3 is_stmt 1 view .LVU1039
+	.loc 1 1234 10 is_stmt 0 view .LVU1040
+	xorl	%ebx, %ebx
+	.loc 1 1243 6 view .LVU1041
+	testq	%rcx, %rcx
+	jne	.L258
+	jmp	.L253
+	.cfi_endproc
+.LFE40:
+	.size	dtos_batch, .-dtos_batch
+	.section	.rodata
+	.align 32
+	.type	numeric_formatter_fixed_powers, @object
+	.size	numeric_formatter_fixed_powers, 160
+numeric_formatter_fixed_powers:
+	.quad	1
+	.quad	10
+	.quad	100
+	.quad	1000
+	.quad	10000
+	.quad	100000
+	.quad	1000000
+	.quad	10000000
+	.quad	100000000
+	.quad	1000000000
+	.quad	10000000000
+	.quad	100000000000
+	.quad	1000000000000
+	.quad	10000000000000
+	.quad	100000000000000
+	.quad	1000000000000000
+	.quad	10000000000000000
+	.quad	100000000000000000
+	.quad	1000000000000000000
+	.quad	-8446744073709551616
+	.align 32
+	.type	numeric_formatter_pow5_split, @object
+	.size	numeric_formatter_pow5_split, 5216
+numeric_formatter_pow5_split:
+	.quad	0
+	.quad	1152921504606846976
+	.quad	0
+	.quad	1441151880758558720
+	.quad	0
+	.quad	1801439850948198400
+	.quad	0
+	.quad	2251799813685248000
+	.quad	0
+	.quad	1407374883553280000
+	.quad	0
+	.quad	1759218604441600000
+	.quad	0
+	.quad	2199023255552000000
+	.quad	0
+	.quad	1374389534720000000
+	.quad	0
+	.quad	1717986918400000000
+	.quad	0
+	.quad	2147483648000000000
+	.quad	0
+	.quad	1342177280000000000
+	.quad	0
+	.quad	1677721600000000000
+	.quad	0
+	.quad	2097152000000000000
+	.quad	0
+	.quad	1310720000000000000
+	.quad	0
+	.quad	1638400000000000000
+	.quad	0
+	.quad	2048000000000000000
+	.quad	0
+	.quad	1280000000000000000
+	.quad	0
+	.quad	1600000000000000000
+	.quad	0
+	.quad	2000000000000000000
+	.quad	0
+	.quad	1250000000000000000
+	.quad	0
+	.quad	1562500000000000000
+	.quad	0
+	.quad	1953125000000000000
+	.quad	0
+	.quad	1220703125000000000
+	.quad	0
+	.quad	1525878906250000000
+	.quad	0
+	.quad	1907348632812500000
+	.quad	0
+	.quad	1192092895507812500
+	.quad	0
+	.quad	1490116119384765625
+	.quad	4611686018427387904
+	.quad	1862645149230957031
+	.quad	-8646911284551352320
+	.quad	1164153218269348144
+	.quad	-6196953087261802496
+	.quad	1455191522836685180
+	.quad	-3134505340649865216
+	.quad	1818989403545856475
+	.quad	-3918131675812331520
+	.quad	2273736754432320594
+	.quad	-4754675306596401152
+	.quad	1421085471520200371
+	.quad	-5943344133245501440
+	.quad	1776356839400250464
+	.quad	-2817494148129488896
+	.quad	2220446049250313080
+	.quad	-8678462870222012416
+	.quad	1387778780781445675
+	.quad	7598665485932036096
+	.quad	1734723475976807094
+	.quad	274959820560269312
+	.quad	2168404344971008868
+	.quad	-9051522149004607488
+	.quad	1355252715606880542
+	.quad	2520655369026404352
+	.quad	1694065894508600678
+	.quad	-6072552825571770368
+	.quad	2117582368135750847
+	.quad	-3795345515982356480
+	.quad	1323488980084844279
+	.quad	-4744181894977945600
+	.quad	1654361225106055349
+	.quad	3293144668132343808
+	.quad	2067951531382569187
+	.quad	-247627591630979072
+	.quad	1292469707114105741
+	.quad	8913837547316051968
+	.quad	1615587133892632177
+	.quad	-2692761121137098752
+	.quad	2019483917365790221
+	.quad	-6294661719138074624
+	.quad	1262177448353618888
+	.quad	-3256641130495205376
+	.quad	1577721810442023610
+	.quad	-8682487431546394624
+	.quad	1972152263052529513
+	.quad	-814868626289108736
+	.quad	1232595164407830945
+	.quad	8204786253993389888
+	.quad	1540743955509788682
+	.quad	1032610780636961552
+	.quad	1925929944387235853
+	.quad	2951224747111794922
+	.quad	1203706215242022408
+	.quad	3689030933889743652
+	.quad	1504632769052528010
+	.quad	-4612083369492596243
+	.quad	1880790961315660012
+	.quad	-576709096719178700
+	.quad	1175494350822287507
+	.quad	-720886370898973375
+	.quad	1469367938527859384
+	.quad	3710578054803671186
+	.quad	1836709923159824231
+	.quad	26536550077201078
+	.quad	2295887403949780289
+	.quad	-6900943683842831182
+	.quad	1434929627468612680
+	.quad	-4014493586376151074
+	.quad	1793662034335765850
+	.quad	8816941072311974870
+	.quad	2242077542919707313
+	.quad	-1406940857446097563
+	.quad	1401298464324817070
+	.quad	-6370362090235009857
+	.quad	1751623080406021338
+	.quad	5872105442488401391
+	.quad	2189528850507526673
+	.quad	-3247463126085830987
+	.quad	1368455531567204170
+	.quad	-8671014926034676638
+	.quad	1710569414459005213
+	.quad	-1615396620688569989
+	.quad	2138211768073756516
+	.quad	1296220121283337709
+	.quad	1336382355046097823
+	.quad	-2991410866823215768
+	.quad	1670477943807622278
+	.quad	-8350949601956407614
+	.quad	2088097429759527848
+	.quad	6309871544845715001
+	.quad	1305060893599704905
+	.quad	-5947718624225019960
+	.quad	1631326116999631131
+	.quad	-7434648280281274950
+	.quad	2039157646249538914
+	.quad	-6952498184389490796
+	.quad	1274473528905961821
+	.quad	532749306367912313
+	.quad	1593091911132452277
+	.quad	5277622651387278295
+	.quad	1991364888915565346
+	.quad	7910200175544436838
+	.quad	1244603055572228341
+	.quad	-3947307835851617664
+	.quad	1555753819465285426
+	.quad	8900923260467641632
+	.quad	1944692274331606783
+	.quad	-5966138008276193740
+	.quad	1215432671457254239
+	.quad	-7457672510345242175
+	.quad	1519290839321567799
+	.quad	9124653435777998898
+	.quad	1899113549151959749
+	.quad	8008751406574943263
+	.quad	1186945968219974843
+	.quad	5399253239791291175
+	.quad	1483682460274968554
+	.quad	-2474305487115661840
+	.quad	1854603075343710692
+	.quad	759402079766405302
+	.quad	1159126922089819183
+	.quad	-3662433418719381276
+	.quad	1448908652612273978
+	.quad	-9189727791826614499
+	.quad	1811135815765342473
+	.quad	-2263787702928492316
+	.quad	2263919769706678091
+	.quad	7808504722524468110
+	.quad	1414949856066673807
+	.quad	5148944884728197234
+	.quad	1768687320083342259
+	.quad	1824495087482858639
+	.quad	2210859150104177824
+	.quad	1140309429676786649
+	.quad	1381786968815111140
+	.quad	1425386787095983311
+	.quad	1727233711018888925
+	.quad	6393419502297367043
+	.quad	2159042138773611156
+	.quad	-5227484847918921406
+	.quad	1349401336733506972
+	.quad	-1922670041471263854
+	.quad	1686751670916883715
+	.quad	-2403337551839079817
+	.quad	2108439588646104644
+	.quad	803757039314269066
+	.quad	1317774742903815403
+	.quad	-3606989719284551571
+	.quad	1647218428629769253
+	.quad	4714634887749086344
+	.quad	2059023035787211567
+	.quad	-8582568241225290795
+	.quad	1286889397367007229
+	.quad	-1504838264676837686
+	.quad	1608611746708759036
+	.quad	2730638187581340797
+	.quad	2010764683385948796
+	.quad	-7516723169616437810
+	.quad	1256727927116217997
+	.quad	-172531925165771454
+	.quad	1570909908895272496
+	.quad	4396021111970173586
+	.quad	1963637386119090621
+	.quad	5053356204195052443
+	.quad	1227273366324431638
+	.quad	-2906676781610960254
+	.quad	1534091707905539547
+	.quad	-3633345977013700317
+	.quad	1917614634881924434
+	.quad	-4576684244847256650
+	.quad	1198509146801202771
+	.quad	-5720855306059070813
+	.quad	1498136433501503464
+	.quad	-2539383114146450612
+	.quad	1872670541876879330
+	.quad	-3892957455555225585
+	.quad	1170419088673049581
+	.quad	4357175217410743827
+	.quad	1463023860841311977
+	.quad	-8388589033518733928
+	.quad	1828779826051639971
+	.quad	7961007781811134206
+	.quad	2285974782564549964
+	.quad	-4247742173222816929
+	.quad	1428734239102843727
+	.quad	-5309677716528521161
+	.quad	1785917798878554659
+	.quad	-6637097145660651452
+	.quad	2232397248598193324
+	.quad	-1842342706824213205
+	.quad	1395248280373870827
+	.quad	-2302928383530266507
+	.quad	1744060350467338534
+	.quad	-7490346497840221037
+	.quad	2180075438084173168
+	.quad	6847748484918331612
+	.quad	1362547148802608230
+	.quad	-663686430706861293
+	.quad	1703183936003260287
+	.quad	-829608038383576617
+	.quad	2128979920004075359
+	.quad	-518505023989735386
+	.quad	1330612450002547099
+	.quad	-648131279987169232
+	.quad	1663265562503183874
+	.quad	-5421850118411349444
+	.quad	2079081953128979843
+	.quad	5834715712847682405
+	.quad	1299426220705612402
+	.quad	-1929977395795172801
+	.quad	1624282775882015502
+	.quad	-7024157763171353905
+	.quad	2030353469852519378
+	.quad	-6695941611195790143
+	.quad	1268970918657824611
+	.quad	-8369927013994737679
+	.quad	1586213648322280764
+	.quad	-5850722749066034194
+	.quad	1982767060402850955
+	.quad	5566670318688504437
+	.quad	1239229412751781847
+	.quad	2346651879933242642
+	.quad	1549036765939727309
+	.quad	7545000868343941206
+	.quad	1936295957424659136
+	.quad	4715625542714963254
+	.quad	1210184973390411960
+	.quad	5894531928393704067
+	.quad	1512731216738014950
+	.quad	-1855207126362645724
+	.quad	1890914020922518687
+	.quad	-1159504453976653577
+	.quad	1181821263076574179
+	.quad	-1449380567470816972
+	.quad	1477276578845717724
+	.quad	2799960309088866689
+	.quad	1846595723557147156
+	.quad	-7473396843674234127
+	.quad	1154122327223216972
+	.quad	-4730060036165404755
+	.quad	1442652909029021215
+	.quad	-5912575045206755944
+	.quad	1803316136286276519
+	.quad	-7390718806508444929
+	.quad	2254145170357845649
+	.quad	-7513235640390177
+	.quad	1408840731473653530
+	.quad	-4621077562977875625
+	.quad	1761050914342066913
+	.quad	3447025083132431277
+	.quad	2201313642927583642
+	.quad	6766076695385157452
+	.quad	1375821026829739776
+	.quad	8457595869231446815
+	.quad	1719776283537174720
+	.quad	-7874749237170243097
+	.quad	2149720354421468400
+	.quad	6607496772837067824
+	.quad	1343575221513417750
+	.quad	-964001070808441028
+	.quad	1679469026891772187
+	.quad	-1205001338510551285
+	.quad	2099336283614715234
+	.quad	-3058968845782788505
+	.quad	1312085177259197021
+	.quad	5399660979626290177
+	.quad	1640106471573996277
+	.quad	-7085481830749300991
+	.quad	2050133089467495346
+	.quad	-6734269153432007072
+	.quad	1281333180917184591
+	.quad	-8417836441790008839
+	.quad	1601666476146480739
+	.quad	7924448521472040567
+	.quad	2002083095183100924
+	.quad	-4270591710934750454
+	.quad	1251301934489438077
+	.quad	3885132398186337741
+	.quad	1564127418111797597
+	.quad	-8978642557549241536
+	.quad	1955159272639746996
+	.quad	-3305808589254582008
+	.quad	1221974545399841872
+	.quad	479425281859160394
+	.quad	1527468181749802341
+	.quad	5210967620751338397
+	.quad	1909335227187252926
+	.quad	-1354831255457801406
+	.quad	1193334516992033078
+	.quad	-6305225087749639662
+	.quad	1491668146240041348
+	.quad	-3269845341259661673
+	.quad	1864585182800051685
+	.quad	-6655339356714676450
+	.quad	1165365739250032303
+	.quad	-8319174195893345562
+	.quad	1456707174062540379
+	.quad	8047776328842869663
+	.quad	1820883967578175474
+	.quad	836348374198811271
+	.quad	2276104959472719343
+	.quad	7440246761515338900
+	.quad	1422565599670449589
+	.quad	-4534749603387990086
+	.quad	1778206999588061986
+	.quad	8166621051047176104
+	.quad	2222758749485077483
+	.quad	2798295147690791113
+	.quad	1389224218428173427
+	.quad	-1113817083813899013
+	.quad	1736530273035216783
+	.quad	-1392271354767373766
+	.quad	2170662841294020979
+	.quad	8353202440125167204
+	.quad	1356664275808763112
+	.quad	-8005241023553092611
+	.quad	1695830344760953890
+	.quad	3828506775840797949
+	.quad	2119787930951192363
+	.quad	86973725686804766
+	.quad	1324867456844495227
+	.quad	-4502968861318881947
+	.quad	1656084321055619033
+	.quad	3594660960206173375
+	.quad	2070105401319523792
+	.quad	2246663100128858359
+	.quad	1293815875824702370
+	.quad	-6415043161693702859
+	.quad	1617269844780877962
+	.quad	5816254103165035138
+	.quad	2021587305976097453
+	.quad	5941001823691840913
+	.quad	1263492066235060908
+	.quad	7426252279614801142
+	.quad	1579365082793826135
+	.quad	4671129331091113523
+	.quad	1974206353492282669
+	.quad	5225298841145639904
+	.quad	1233878970932676668
+	.quad	6531623551432049880
+	.quad	1542348713665845835
+	.quad	3552843420862674446
+	.quad	1927935892082307294
+	.quad	-2391158880388216375
+	.quad	1204959932551442058
+	.quad	-7600634618912658373
+	.quad	1506199915689302573
+	.quad	-277421236786047158
+	.quad	1882749894611628216
+	.quad	-7090917300632361330
+	.quad	1176718684132267635
+	.quad	-8863646625790451662
+	.quad	1470898355165334544
+	.quad	-6467872263810676674
+	.quad	1838622943956668180
+	.quad	-3473154311335957938
+	.quad	2298278679945835225
+	.quad	2440964573842414192
+	.quad	1436424174966147016
+	.quad	3051205717303017741
+	.quad	1795530218707683770
+	.quad	-5409364890226003632
+	.quad	2244412773384604712
+	.quad	8148361989677217490
+	.quad	1402757983365377945
+	.quad	-3649605568185641850
+	.quad	1753447479206722431
+	.quad	-4562006960232052312
+	.quad	2191809349008403039
+	.quad	-2851254350145032695
+	.quad	1369880843130251899
+	.quad	-3564067937681290869
+	.quad	1712351053912814874
+	.quad	-9066770940529001490
+	.quad	2140438817391018593
+	.quad	-1055045819403238027
+	.quad	1337774260869386620
+	.quad	3292878744173340370
+	.quad	1672217826086733276
+	.quad	4116098430216675462
+	.quad	2090272282608416595
+	.quad	266718509671728212
+	.quad	1306420176630260372
+	.quad	333398137089660265
+	.quad	1633025220787825465
+	.quad	5028433689789463235
+	.quad	2041281525984781831
+	.quad	-8386443989950055238
+	.quad	1275800953740488644
+	.quad	-5871368969010181144
+	.quad	1594751192175610805
+	.quad	1884160825592049379
+	.quad	1993438990219513507
+	.quad	-1128242493218663091
+	.quad	1245899368887195941
+	.quad	7813068920331446945
+	.quad	1557374211108994927
+	.quad	5154650131986920777
+	.quad	1946717763886243659
+	.quad	915813323278131534
+	.quad	1216698602428902287
+	.quad	-3466919364329723487
+	.quad	1520873253036127858
+	.quad	-8945335223839542262
+	.quad	1901091566295159823
+	.quad	-5590834514899713914
+	.quad	1188182228934474889
+	.quad	2234828893230133415
+	.quad	1485227786168093612
+	.quad	2793536116537666769
+	.quad	1856534732710117015
+	.quad	8663489100477123587
+	.quad	1160334207943823134
+	.quad	1605989338741628675
+	.quad	1450417759929778918
+	.quad	-7215885363427739964
+	.quad	1813022199912223647
+	.quad	-9019856704284674954
+	.quad	2266277749890279559
+	.quad	-5637410440177921847
+	.quad	1416423593681424724
+	.quad	-2435077031795014404
+	.quad	1770529492101780905
+	.quad	6179525747111007803
+	.quad	2213161865127226132
+	.quad	-5361168444910395931
+	.quad	1383226165704516332
+	.quad	-2089774537710607010
+	.quad	1729032707130645415
+	.quad	-2612218172138258762
+	.quad	2161290883913306769
+	.quad	2979049660840976177
+	.quad	1350806802445816731
+	.quad	-887873942376167682
+	.quad	1688508503057270913
+	.quad	8113529608884566205
+	.quad	2110635628821588642
+	.quad	-8764102049729309834
+	.quad	1319147268013492901
+	.quad	-1731755525306861484
+	.quad	1648934085016866126
+	.quad	-6776380425060964759
+	.quad	2061167606271082658
+	.quad	-6541080774876796927
+	.quad	1288229753919426661
+	.quad	1047021068258779650
+	.quad	1610287192399283327
+	.quad	-3302909683103913342
+	.quad	2012858990499104158
+	.quad	4853210475701136017
+	.quad	1258036869061940099
+	.quad	1454827076199032118
+	.quad	1572546086327425124
+	.quad	1818533845248790147
+	.quad	1965682607909281405
+	.quad	3442426662494187794
+	.quad	1228551629943300878
+	.quad	-4920338708737041066
+	.quad	1535689537429126097
+	.quad	3072948650933474476
+	.quad	1919611921786407622
+	.quad	-2691093111593966357
+	.quad	1199757451116504763
+	.quad	-3363866389492457946
+	.quad	1499696813895630954
+	.quad	-8816519005292960336
+	.quad	1874621017369538693
+	.quad	8324733676974063502
+	.quad	1171638135855961683
+	.quad	5794231077790191473
+	.quad	1464547669819952104
+	.quad	7242788847237739342
+	.quad	1830684587274940130
+	.quad	-169885977807601630
+	.quad	2288355734093675162
+	.quad	-2412021745343444971
+	.quad	1430222333808546976
+	.quad	1596658836748081690
+	.quad	1787777917260683721
+	.quad	6607509564362490017
+	.quad	2234722396575854651
+	.quad	1823850468512862308
+	.quad	1396701497859909157
+	.quad	6891499104068465790
+	.quad	1745876872324886446
+	.quad	-608998156769193571
+	.quad	2182346090406108057
+	.quad	4231062170446641922
+	.quad	1363966306503817536
+	.quad	5288827713058302403
+	.quad	1704957883129771920
+	.quad	6611034641322878003
+	.quad	2131197353912214900
+	.quad	-5091475386027977056
+	.quad	1331998346195134312
+	.quad	-1752658214107583416
+	.quad	1664997932743917890
+	.quad	-6802508786061867174
+	.quad	2081247415929897363
+	.quad	4971804045566108824
+	.quad	1300779634956185852
+	.quad	6214755056957636030
+	.quad	1625974543695232315
+	.quad	3156757802769657134
+	.quad	2032468179619040394
+	.quad	6584659645158423613
+	.quad	1270292612261900246
+	.quad	-992547480406746292
+	.quad	1587865765327375307
+	.quad	-1240684350508432865
+	.quad	1984832206659219134
+	.quad	6142101308573311315
+	.quad	1240520129162011959
+	.quad	3065940617289251240
+	.quad	1550650161452514949
+	.quad	8444111790038951954
+	.quad	1938312701815643686
+	.quad	665883850346957067
+	.quad	1211445438634777304
+	.quad	832354812933696334
+	.quad	1514306798293471630
+	.quad	-8182928520687655390
+	.quad	1892883497866839537
+	.quad	-502644307002396715
+	.quad	1183052186166774710
+	.quad	-5239991402180383798
+	.quad	1478815232708468388
+	.quad	-1938303234298091843
+	.quad	1848519040885585485
+	.quad	-5823125539863695306
+	.quad	1155324400553490928
+	.quad	-2667220906402231229
+	.quad	1444155500691863660
+	.quad	1277659885424598868
+	.quad	1805194375864829576
+	.quad	1597074856780748586
+	.quad	2256492969831036970
+	.quad	5609857803915355770
+	.quad	1410308106144398106
+	.quad	-2211049781960581095
+	.quad	1762885132680497632
+	.quad	1847873790976661535
+	.quad	2203606415850622041
+	.quad	-5762607908280668397
+	.quad	1377254009906638775
+	.quad	-7203259885350835496
+	.quad	1721567512383298469
+	.quad	219297180166231438
+	.quad	2151959390479123087
+	.quad	7054589765244976505
+	.quad	1344974619049451929
+	.quad	-5016820848725943081
+	.quad	1681218273811814911
+	.quad	-6271026060907428851
+	.quad	2101522842264768639
+	.quad	-3919391288067143032
+	.quad	1313451776415480399
+	.quad	-4899239110083928790
+	.quad	1641814720519350499
+	.quad	-6124048887604910988
+	.quad	2052268400649188124
+	.quad	-1521687545539375415
+	.quad	1282667750405742577
+	.quad	7321262604930556539
+	.quad	1603334688007178222
+	.quad	-71793780691580134
+	.quad	2004168360008972777
+	.quad	4566814905495150320
+	.quad	1252605225005607986
+	.quad	-3514853404985837908
+	.quad	1565756531257009982
+	.quad	-9005252774659685289
+	.quad	1957195664071262478
+	.quad	1289246043478778550
+	.quad	1223247290044539049
+	.quad	6223243572775861092
+	.quad	1529059112555673811
+	.quad	3167368447542438461
+	.quad	1911323890694592264
+	.quad	1979605279714024038
+	.quad	1194577431684120165
+	.quad	7086192618069917952
+	.quad	1493221789605150206
+	.quad	-365631264267378368
+	.quad	1866527237006437757
+	.quad	-4840205558594499384
+	.quad	1166579523129023598
+	.quad	7784801107039039482
+	.quad	1458224403911279498
+	.quad	507629346944023544
+	.quad	1822780504889099373
+	.quad	5246222702107417334
+	.quad	2278475631111374216
+	.quad	3278889188817135834
+	.quad	1424047269444608885
+	.quad	8710297504448807696
+	.quad	1780059086805761106
+	.align 32
+	.type	numeric_formatter_pow5_inv_split, @object
+	.size	numeric_formatter_pow5_inv_split, 5472
+numeric_formatter_pow5_inv_split:
+	.quad	1
+	.quad	2305843009213693952
+	.quad	-7378697629483820646
+	.quad	1844674407370955161
+	.quad	5165088340638674453
+	.quad	1475739525896764129
+	.quad	7821419487252849886
+	.quad	1180591620717411303
+	.quad	8824922364862649494
+	.quad	1888946593147858085
+	.quad	7059937891890119595
+	.quad	1511157274518286468
+	.quad	-5420096130713635294
+	.quad	1208925819614629174
+	.quad	-8672153809141816470
+	.quad	1934281311383406679
+	.quad	-6937723047313453176
+	.quad	1547425049106725343
+	.quad	-1860829623108852217
+	.quad	1237940039285380274
+	.quad	-2977327396974163548
+	.quad	1980704062856608439
+	.quad	-2381861917579330838
+	.quad	1584563250285286751
+	.quad	9162556910162266299
+	.quad	1267650600228229401
+	.quad	7281393426775805432
+	.quad	2028240960365167042
+	.quad	-1553582888063176301
+	.quad	1622592768292133633
+	.quad	2446482504291369283
+	.quad	1298074214633706907
+	.quad	7603720821608101175
+	.quad	2076918743413931051
+	.quad	2393627842544570617
+	.quad	1661534994731144841
+	.quad	-1774446540706253830
+	.quad	1329227995784915872
+	.quad	-6528463279871916451
+	.quad	2126764793255865396
+	.quad	5845275820328197809
+	.quad	1701411834604692317
+	.quad	-2702476973221262399
+	.quad	1361129467683753853
+	.quad	3054734472329800808
+	.quad	2177807148294006166
+	.quad	-1245561236878069677
+	.quad	1742245718635204932
+	.quad	6382248639981364905
+	.quad	1393796574908163946
+	.quad	2832900194486363201
+	.quad	2230074519853062314
+	.quad	5955668970331000884
+	.quad	1784059615882449851
+	.quad	1075186361522890384
+	.quad	1427247692705959881
+	.quad	-5658399451047196032
+	.quad	2283596308329535809
+	.quad	-4526719560837756825
+	.quad	1826877046663628647
+	.quad	3757321980813615186
+	.quad	1461501637330902918
+	.quad	-8062188859574838821
+	.quad	1169201309864722334
+	.quad	5547241898389809503
+	.quad	1870722095783555735
+	.quad	4437793518711847602
+	.quad	1496577676626844588
+	.quad	-7517811629256252888
+	.quad	1197262141301475670
+	.quad	-960452162584273651
+	.quad	1915619426082361072
+	.quad	6610335899416401726
+	.quad	1532495540865888858
+	.quad	-5779777724692609589
+	.quad	1225996432692711086
+	.quad	-5558295544766265019
+	.quad	1961594292308337738
+	.quad	-757287621071101692
+	.quad	1569275433846670190
+	.quad	-4295178911598791677
+	.quad	1255420347077336152
+	.quad	7885109000409574610
+	.quad	2008672555323737844
+	.quad	-8449308058639981605
+	.quad	1606938044258990275
+	.quad	7997948812055656009
+	.quad	1285550435407192220
+	.quad	-5650025974420502002
+	.quad	2056880696651507552
+	.quad	2858676849947419045
+	.quad	1645504557321206042
+	.quad	-5091756149525885410
+	.quad	1316403645856964833
+	.quad	-768112209757596011
+	.quad	2106245833371143733
+	.quad	3074859046935833515
+	.quad	1684996666696914987
+	.quad	-4918810391935153834
+	.quad	1347997333357531989
+	.quad	-7870096627096246135
+	.quad	2156795733372051183
+	.quad	-2606728486935086585
+	.quad	1725436586697640946
+	.quad	8982663654677661702
+	.quad	1380349269358112757
+	.quad	-385133411483382570
+	.quad	2208558830972980411
+	.quad	-7686804358670526703
+	.quad	1766847064778384329
+	.quad	-6149443486936421362
+	.quad	1413477651822707463
+	.quad	-2460411949614453533
+	.quad	2261564242916331941
+	.quad	9099716884534168143
+	.quad	1809251394333065553
+	.quad	-3788272936598396455
+	.quad	1447401115466452442
+	.quad	4348079280205103483
+	.quad	1157920892373161954
+	.quad	-4111119595897565398
+	.quad	1852673427797059126
+	.quad	7779150767507678651
+	.quad	1482138742237647301
+	.quad	2533971799264232598
+	.quad	1185710993790117841
+	.quad	-3324342750661048490
+	.quad	1897137590064188545
+	.quad	-6348823015270749115
+	.quad	1517710072051350836
+	.quad	5988988032009131678
+	.quad	1214168057641080669
+	.quad	-1485665593011120286
+	.quad	1942668892225729070
+	.quad	-4877881289150806552
+	.quad	1554135113780583256
+	.quad	7165741412905085728
+	.quad	1243308091024466605
+	.quad	-6981557813061414451
+	.quad	1989292945639146568
+	.quad	-1895897435707221237
+	.quad	1591434356511317254
+	.quad	-1516717948565776990
+	.quad	1273147485209053803
+	.quad	4951948911778577463
+	.quad	2037035976334486086
+	.quad	272210314680951647
+	.quad	1629628781067588869
+	.quad	3907117066486671641
+	.quad	1303703024854071095
+	.quad	6251387306378674625
+	.quad	2085924839766513752
+	.quad	-2377587784380880946
+	.quad	1668739871813211001
+	.quad	9165976216721026213
+	.quad	1334991897450568801
+	.quad	7286864317269821294
+	.quad	2135987035920910082
+	.quad	-1549206175667963611
+	.quad	1708789628736728065
+	.quad	-4928713755276281212
+	.quad	1367031702989382452
+	.quad	6871453250525591353
+	.quad	2187250724783011924
+	.quad	9186511415162383406
+	.quad	1749800579826409539
+	.quad	-7408186126837734568
+	.quad	1399840463861127631
+	.quad	-8163748988198464986
+	.quad	2239744742177804210
+	.quad	8226396068408869304
+	.quad	1791795793742243368
+	.quad	-4486929589498635526
+	.quad	1433436634993794694
+	.quad	-7179087343197816842
+	.quad	2293498615990071511
+	.quad	5324776569667477496
+	.quad	1834798892792057209
+	.quad	7949170070475892320
+	.quad	1467839114233645767
+	.quad	-1019361573103106790
+	.quad	1174271291386916613
+	.quad	5747719112518849781
+	.quad	1878834066219066582
+	.quad	-2780522339468740821
+	.quad	1503067252975253265
+	.quad	-5913766686316902980
+	.quad	1202453802380202612
+	.quad	5295368560860596524
+	.quad	1923926083808324180
+	.quad	4236294848688477220
+	.quad	1539140867046659344
+	.quad	7078384693692692099
+	.quad	1231312693637327475
+	.quad	-7121328563801244258
+	.quad	1970100309819723960
+	.quad	9060332407926645887
+	.quad	1576080247855779168
+	.quad	-3819780517884414260
+	.quad	1260864198284623334
+	.quad	-6111648828615062817
+	.quad	2017382717255397335
+	.quad	-8578667877633960576
+	.quad	1613906173804317868
+	.quad	-3173585487365258138
+	.quad	1291124939043454294
+	.quad	-5077736779784413021
+	.quad	2065799902469526871
+	.quad	7005857020398200553
+	.quad	1652639921975621497
+	.quad	-1774012013165260204
+	.quad	1322111937580497197
+	.quad	-6527768035806326650
+	.quad	2115379100128795516
+	.quad	5845832015580669650
+	.quad	1692303280103036413
+	.quad	-6391380831761195250
+	.quad	1353842624082429130
+	.quad	841837113407818570
+	.quad	2166148198531886609
+	.quad	4362818505468165179
+	.quad	1732918558825509287
+	.quad	-3888442825109288503
+	.quad	1386334847060407429
+	.quad	-6221508520174861605
+	.quad	2218135755296651887
+	.quad	2401490813343931363
+	.quad	1774508604237321510
+	.quad	1921192650675145090
+	.quad	1419606883389857208
+	.quad	-615440573661678179
+	.quad	2271371013423771532
+	.quad	6886345170554478103
+	.quad	1817096810739017226
+	.quad	1819727321701672159
+	.quad	1453677448591213781
+	.quad	-2233566957380572596
+	.quad	1162941958872971024
+	.quad	-3573707131808916153
+	.quad	1860707134196753639
+	.quad	-2858965705447132922
+	.quad	1488565707357402911
+	.quad	8780873879868024632
+	.quad	1190852565885922329
+	.quad	2981351763563108441
+	.quad	1905364105417475727
+	.quad	-4993616218633333894
+	.quad	1524291284333980581
+	.quad	7073153469319063855
+	.quad	1219433027467184465
+	.quad	-7129698522799049449
+	.quad	1951092843947495144
+	.quad	-5703758818239239559
+	.quad	1560874275157996115
+	.quad	-8252355869333301970
+	.quad	1248699420126396892
+	.quad	1553625868034358140
+	.quad	1997919072202235028
+	.quad	8621598323911307159
+	.quad	1598335257761788022
+	.quad	-481418970354774919
+	.quad	1278668206209430417
+	.quad	-4459619167309550194
+	.quad	2045869129935088668
+	.quad	121653480894270168
+	.quad	1636695303948070935
+	.quad	97322784715416134
+	.quad	1309356243158456748
+	.quad	-3533632359197244509
+	.quad	2094969989053530796
+	.quad	8241140556867935363
+	.quad	1675975991242824637
+	.quad	-785785183989472356
+	.quad	1340780792994259709
+	.quad	-1257256294383155770
+	.quad	2145249268790815535
+	.quad	-4695153850248434939
+	.quad	1716199415032652428
+	.quad	-66774265456837628
+	.quad	1372959532026121942
+	.quad	-3796187639472850528
+	.quad	2196735251241795108
+	.quad	652398703163629901
+	.quad	1757388200993436087
+	.quad	-6856778666952916726
+	.quad	1405910560794748869
+	.quad	7475898206584884855
+	.quad	2249456897271598191
+	.quad	2291369750525997561
+	.quad	1799565517817278553
+	.quad	9211793429904618695
+	.quad	1439652414253822842
+	.quad	-18525771120251381
+	.quad	2303443862806116547
+	.quad	7363877012587619542
+	.quad	1842755090244893238
+	.quad	-5176944834155635336
+	.quad	1474204072195914590
+	.quad	-7830904682066418592
+	.quad	1179363257756731672
+	.quad	2227947767661371545
+	.quad	1886981212410770676
+	.quad	-1906990600612813087
+	.quad	1509584969928616540
+	.quad	-5214941295232160793
+	.quad	1207667975942893232
+	.quad	6413489186596184024
+	.quad	1932268761508629172
+	.quad	-2247906280206873427
+	.quad	1545815009206903337
+	.quad	5580372605318321905
+	.quad	1236652007365522670
+	.quad	8928596168509315048
+	.quad	1978643211784836272
+	.quad	-235820694676368608
+	.quad	1582914569427869017
+	.quad	7190041073742725760
+	.quad	1266331655542295214
+	.quad	436019273762630246
+	.quad	2026130648867672343
+	.quad	7727513048493924843
+	.quad	1620904519094137874
+	.quad	-8575384820172501418
+	.quad	1296723615275310299
+	.quad	4726128361433549347
+	.quad	2074757784440496479
+	.quad	7470251503888749801
+	.quad	1659806227552397183
+	.quad	-5091845241114731129
+	.quad	1327844982041917746
+	.quad	-4457603571041659483
+	.quad	2124551971267068394
+	.quad	-3566082856833327587
+	.quad	1699641577013654715
+	.quad	-6542215100208572392
+	.quad	1359713261610923772
+	.quad	4289851098633925465
+	.quad	2175541218577478036
+	.quad	-257467935834769951
+	.quad	1740432974861982428
+	.quad	3483374466074094362
+	.quad	1392346379889585943
+	.quad	1884050330976640656
+	.quad	2227754207823337509
+	.quad	5196589079523222848
+	.quad	1782203366258670007
+	.quad	-3221426365865242368
+	.quad	1425762693006936005
+	.quad	5913764258841343181
+	.quad	2281220308811097609
+	.quad	8420360221814984868
+	.quad	1824976247048878087
+	.quad	-642409452031832752
+	.quad	1459980997639102469
+	.quad	-513927561625466201
+	.quad	1167984798111281975
+	.quad	-8200981728084566569
+	.quad	1868775676978051161
+	.quad	4507261061758077715
+	.quad	1495020541582440929
+	.quad	7295157664148372495
+	.quad	1196016433265952743
+	.quad	7982903447895485668
+	.quad	1913626293225524389
+	.quad	-8371072500651252758
+	.quad	1530901034580419511
+	.quad	4371188443704728763
+	.quad	1224720827664335609
+	.quad	-4074144934298164949
+	.quad	1959553324262936974
+	.quad	-3259315947438531959
+	.quad	1567642659410349579
+	.quad	-2607452757950825567
+	.quad	1254114127528279663
+	.quad	3206773216762499739
+	.quad	2006582604045247462
+	.quad	-4813279056073820855
+	.quad	1605266083236197969
+	.quad	-3850623244859056684
+	.quad	1284212866588958375
+	.quad	4907049252451240275
+	.quad	2054740586542333401
+	.quad	236290587219081897
+	.quad	1643792469233866721
+	.quad	-3500316344966644806
+	.quad	1315033975387093376
+	.quad	-1911157337204721366
+	.quad	2104054360619349402
+	.quad	5849771759720043554
+	.quad	1683243488495479522
+	.quad	-2698880221707785803
+	.quad	1346594790796383617
+	.quad	-8007557169474367609
+	.quad	2154551665274213788
+	.quad	-2716696920837583764
+	.quad	1723641332219371030
+	.quad	-5862706351411977334
+	.quad	1378913065775496824
+	.quad	9066413911450387881
+	.quad	2206260905240794919
+	.quad	-7504264129807330988
+	.quad	1765008724192635935
+	.quad	8753983955121776503
+	.quad	1412006979354108748
+	.quad	-8129718560256619535
+	.quad	2259211166966573997
+	.quad	874922781278525018
+	.quad	1807368933573259198
+	.quad	8078635854506640661
+	.quad	1445895146858607358
+	.quad	-4605137760620418441
+	.quad	1156716117486885886
+	.quad	-3678871602250759182
+	.quad	1850745787979017418
+	.quad	746251532941302978
+	.quad	1480596630383213935
+	.quad	597001226353042382
+	.quad	1184477304306571148
+	.quad	-2734146852577042512
+	.quad	1895163686890513836
+	.quad	8880728962164096960
+	.quad	1516130949512411069
+	.quad	-7652812089236363725
+	.quad	1212904759609928855
+	.quad	-1176452898552450990
+	.quad	1940647615375886168
+	.quad	2748186495899949531
+	.quad	1552518092300708935
+	.quad	2198549196719959625
+	.quad	1242014473840567148
+	.quad	-171670099989974923
+	.quad	1987223158144907436
+	.quad	-7516033709475800585
+	.quad	1589778526515925949
+	.quad	-6012826967580640468
+	.quad	1271822821212740759
+	.quad	8826220925580526867
+	.quad	2034916513940385215
+	.quad	7060976740464421494
+	.quad	1627933211152308172
+	.quad	-1729916237112283451
+	.quad	1302346568921846537
+	.quad	-6457214794121563846
+	.quad	2083754510274954460
+	.quad	-8855120650039161400
+	.quad	1667003608219963568
+	.quad	-3394747705289418796
+	.quad	1333602886575970854
+	.quad	-5431596328463070074
+	.quad	2133764618521553367
+	.quad	3033420566713364587
+	.quad	1707011694817242694
+	.quad	6116085268112601993
+	.quad	1365609355853794155
+	.quad	-8661007644729388428
+	.quad	2184974969366070648
+	.quad	-3239457301041600419
+	.quad	1747979975492856518
+	.quad	1097782973908629988
+	.quad	1398383980394285215
+	.quad	1756452758253807981
+	.quad	2237414368630856344
+	.quad	5094511021344956708
+	.quad	1789931494904685075
+	.quad	4075608817075965366
+	.quad	1431945195923748060
+	.quad	6520974107321544586
+	.quad	2291112313477996896
+	.quad	1527430471115325346
+	.quad	1832889850782397517
+	.quad	-6156753252591560370
+	.quad	1466311880625918013
+	.quad	-1236053787331337972
+	.quad	1173049504500734410
+	.quad	9090360384495590213
+	.quad	1876879207201175057
+	.quad	-106409321887348476
+	.quad	1501503365760940045
+	.quad	-3774476272251789104
+	.quad	1201202692608752036
+	.quad	-2349813220860952243
+	.quad	1921924308174003258
+	.quad	1809498238053148529
+	.quad	1537539446539202607
+	.quad	-5931099039041301823
+	.quad	1230031557231362085
+	.quad	1578287981759648052
+	.quad	1968050491570179337
+	.quad	-6116067244076102204
+	.quad	1574440393256143469
+	.quad	-4892853795260881763
+	.quad	1259552314604914775
+	.quad	3239480371808320148
+	.quad	2015283703367863641
+	.quad	-1097764517295254205
+	.quad	1612226962694290912
+	.quad	6500486015647617283
+	.quad	1289781570155432730
+	.quad	-8045966448673363964
+	.quad	2063650512248692368
+	.quad	-2747424344196780848
+	.quad	1650920409798953894
+	.quad	-2197939475357424678
+	.quad	1320736327839163115
+	.quad	7551343283653851484
+	.quad	2113178124542660985
+	.quad	6041074626923081187
+	.quad	1690542499634128788
+	.quad	-6235186742687266020
+	.quad	1352433999707303030
+	.quad	1091747655926105338
+	.quad	2163894399531684849
+	.quad	4562746939482794594
+	.quad	1731115519625347879
+	.quad	7339546366328145998
+	.quad	1384892415700278303
+	.quad	8053925371383123274
+	.quad	2215827865120445285
+	.quad	6443140297106498619
+	.quad	1772662292096356228
+	.quad	-5913534206540532074
+	.quad	1418129833677084982
+	.quad	5295740528502789974
+	.quad	2269007733883335972
+	.quad	-3142105206681588667
+	.quad	1815206187106668777
+	.quad	4865013464138549713
+	.quad	1452164949685335022
+	.quad	-3486686858172980876
+	.quad	1161731959748268017
+	.quad	9178696285890871890
+	.quad	1858771135597228828
+	.quad	-3725089415513033457
+	.quad	1487016908477783062
+	.quad	4398626097073393881
+	.quad	1189613526782226450
+	.quad	7037801755317430209
+	.quad	1903381642851562320
+	.quad	5630241404253944167
+	.quad	1522705314281249856
+	.quad	814844308661245011
+	.quad	1218164251424999885
+	.quad	1303750893857992017
+	.quad	1949062802279999816
+	.quad	-2646348099655516710
+	.quad	1559250241823999852
+	.quad	5261619149759407279
+	.quad	1247400193459199882
+	.quad	-6338804619352589647
+	.quad	1995840309534719811
+	.quad	5997002748743659252
+	.quad	1596672247627775849
+	.quad	8486951013736837725
+	.quad	1277337798102220679
+	.quad	2511075177753209390
+	.quad	2043740476963553087
+	.quad	-5369837487281253134
+	.quad	1634992381570842469
+	.quad	-4295869989825002507
+	.quad	1307993905256673975
+	.quad	4194654460505726958
+	.quad	2092790248410678361
+	.quad	-333625246337328757
+	.quad	1674232198728542688
+	.quad	3422448617672047318
+	.quad	1339385758982834151
+	.quad	-1902779841208544938
+	.quad	2143017214372534641
+	.quad	-8900921502450656597
+	.quad	1714413771498027713
+	.quad	-3431388387218614954
+	.quad	1371531017198422170
+	.quad	5577825024675947042
+	.quad	2194449627517475473
+	.quad	-6605786424484973336
+	.quad	1755559702013980378
+	.quad	-1595280324846068345
+	.quad	1404447761611184302
+	.quad	-6241797334495619676
+	.quad	2247116418577894884
+	.quad	-4993437867596495741
+	.quad	1797693134862315907
+	.quad	3383947335406624054
+	.quad	1438154507889852726
+	.quad	-1964381892833222160
+	.quad	2301047212623764361
+	.quad	-8950203143750398374
+	.quad	1840837770099011489
+	.quad	-7160162515000318699
+	.quad	1472670216079209191
+	.quad	5339916432225476010
+	.quad	1178136172863367353
+	.quad	4854517476818851293
+	.quad	1885017876581387765
+	.quad	3883613981455081034
+	.quad	1508014301265110212
+	.quad	-4271806444319755819
+	.quad	1206411441012088169
+	.quad	-6834890310911609310
+	.quad	1930258305619341071
+	.quad	5600134195496443521
+	.quad	1544206644495472857
+	.quad	-2898590273086665829
+	.quad	1235365315596378285
+	.quad	6430302007287065643
+	.quad	1976584504954205257
+	.quad	-2234456023654168132
+	.quad	1581267603963364205
+	.quad	-5476913633665244829
+	.quad	1265014083170691364
+	.quad	-8763061813864391727
+	.quad	2024022533073106183
+	.quad	-3321100636349603058
+	.quad	1619218026458484946
+	.quad	8411165935146048523
+	.quad	1295374421166787957
+	.quad	-1299529762733963656
+	.quad	2072599073866860731
+	.quad	-8418321439670991571
+	.quad	1658079259093488585
+	.quad	8022738107230848036
+	.quad	1326463407274790868
+	.quad	9147032156827446534
+	.quad	2122341451639665389
+	.quad	-7439769533505684065
+	.quad	1697873161311732311
+	.quad	5116230817421183718
+	.quad	1358298529049385849
+	.quad	-2882077136351837022
+	.quad	2173277646479017358
+	.quad	1383687105660440706
+	.quad	1738622117183213887
+	.quad	-6271747944955468082
+	.quad	1390897693746571109
+	.quad	8411947361780802685
+	.quad	2225436309994513775
+	.quad	6729557889424642148
+	.quad	1780349047995611020
+	.quad	5383646311539713719
+	.quad	1424279238396488816
+	.quad	1235136468979721303
+	.quad	2278846781434382106
+	.quad	-2701239639558133281
+	.quad	1823077425147505684
+	.quad	-2160991711646506624
+	.quad	1458461940118004547
+	.quad	5649904260166615347
+	.quad	1166769552094403638
+	.quad	5350498001524674232
+	.quad	1866831283351045821
+	.quad	591049586477829062
+	.quad	1493465026680836657
+	.quad	-6905857960301557397
+	.quad	1194772021344669325
+	.quad	18673707743239135
+	.quad	1911635234151470921
+	.quad	-3674409848547319015
+	.quad	1529308187321176736
+	.quad	8128518565387875758
+	.quad	1223446549856941389
+	.quad	1937583260394870242
+	.quad	1957514479771106223
+	.quad	8928764237799716840
+	.quad	1566011583816884978
+	.quad	-3925035053985957497
+	.quad	1252809267053507982
+	.quad	8477339172590109297
+	.quad	2004494827285612772
+	.quad	-596826291411733209
+	.quad	1603595861828490217
+	.quad	6901236596354434079
+	.quad	1282876689462792174
+	.quad	-26067890058636443
+	.quad	2052602703140467478
+	.quad	3668494502695001169
+	.quad	1642082162512373983
+	.quad	-8133250842069730034
+	.quad	1313665730009899186
+	.quad	9122891541139893884
+	.quad	2101865168015838698
+	.quad	-3769733211313815862
+	.quad	1681492134412670958
+	.quad	673562245690857633
+	.quad	1345193707530136767
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC6:
+	.long	0
+	.long	-2147483648
+	.long	0
+	.long	0
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/usr/include/stdlib.h"
+	.file 7 "/usr/include/stdio.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "/root/repo/src/../include/strutils.h"
+	.file 10 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x15a4
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x27
+	.long	.LASF86
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF3
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x11
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0xe
+	.long	0x43
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF6
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x11
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x5d
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x11
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x29
+	.byte	0x14
+	.long	0x91
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.long	0x91
+	.uleb128 0x11
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x54
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF14
+	.uleb128 0x11
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x12
+	.long	0xc1
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF16
+	.uleb128 0xe
+	.long	0xc1
+	.uleb128 0x16
+	.long	0xc1
+	.long	0xdd
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x13
+	.byte	0
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF17
+	.uleb128 0x11
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x13
+	.long	0x85
+	.uleb128 0xe
+	.long	0xe4
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF19
+	.uleb128 0x12
+	.long	0xe4
+	.uleb128 0x12
+	.long	0x106
+	.uleb128 0x2a
+	.uleb128 0x12
+	.long	0xc8
+	.uleb128 0x1f
+	.long	0x107
+	.uleb128 0x11
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x72
+	.uleb128 0x11
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9d
+	.uleb128 0xe
+	.long	0x11d
+	.uleb128 0x11
+	.long	.LASF22
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0xb0
+	.uleb128 0xe
+	.long	0x12e
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF23
+	.uleb128 0xe
+	.long	0x35
+	.uleb128 0x12
+	.long	0x43
+	.uleb128 0x12
+	.long	0x12e
+	.uleb128 0x16
+	.long	0x13a
+	.long	0x16c
+	.uleb128 0x20
+	.long	0x2e
+	.value	0x155
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0xe
+	.long	0x155
+	.uleb128 0x2b
+	.long	.LASF24
+	.byte	0x1
+	.byte	0x23
+	.byte	0x17
+	.long	0x16c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numeric_formatter_pow5_inv_split
+	.uleb128 0x16
+	.long	0x13a
+	.long	0x19e
+	.uleb128 0x20
+	.long	0x2e
+	.value	0x145
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0xe
+	.long	0x187
+	.uleb128 0x1a
+	.long	.LASF25
+	.value	0x181
+	.byte	0x17
+	.long	0x19e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numeric_formatter_pow5_split
+	.uleb128 0x2c
+	.long	.LASF87
+	.byte	0x10
+	.byte	0x1
+	.value	0x2cd
+	.byte	0x8
+	.long	0x1e2
+	.uleb128 0x21
+	.long	.LASF26
+	.value	0x2d2
+	.byte	0xc
+	.long	0x12e
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF27
+	.value	0x2d7
+	.byte	0xb
+	.long	0xe4
+	.byte	0x8
+	.byte	0
+	.uleb128 0x16
+	.long	0x13a
+	.long	0x1f2
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x13
+	.byte	0
+	.uleb128 0xe
+	.long	0x1e2
+	.uleb128 0x1a
+	.long	.LASF28
+	.value	0x46b
+	.byte	0x17
+	.long	0x1f2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numeric_formatter_fixed_powers
+	.uleb128 0x1b
+	.long	.LASF29
+	.byte	0x6
+	.byte	0xb1
+	.byte	0x11
+	.long	0xa9
+	.long	0x22d
+	.uleb128 0x7
+	.long	0x10c
+	.uleb128 0x7
+	.long	0x232
+	.uleb128 0x7
+	.long	0x91
+	.byte	0
+	.uleb128 0x12
+	.long	0xbc
+	.uleb128 0x1f
+	.long	0x22d
+	.uleb128 0x1d
+	.long	.LASF30
+	.byte	0x7
+	.value	0x17a
+	.byte	0xc
+	.long	0x91
+	.long	0x259
+	.uleb128 0x7
+	.long	0xbc
+	.uleb128 0x7
+	.long	0x43
+	.uleb128 0x7
+	.long	0x107
+	.uleb128 0x2d
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF31
+	.byte	0x8
+	.byte	0x3d
+	.byte	0xe
+	.long	0x5b
+	.long	0x279
+	.uleb128 0x7
+	.long	0x5b
+	.uleb128 0x7
+	.long	0x91
+	.uleb128 0x7
+	.long	0x43
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xe
+	.long	0x5b
+	.long	0x299
+	.uleb128 0x7
+	.long	0x5b
+	.uleb128 0x7
+	.long	0x101
+	.uleb128 0x7
+	.long	0x43
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF33
+	.byte	0x8
+	.value	0x197
+	.byte	0xf
+	.long	0x43
+	.long	0x2b0
+	.uleb128 0x7
+	.long	0x107
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF34
+	.byte	0x8
+	.byte	0x8d
+	.byte	0xe
+	.long	0xbc
+	.long	0x2cb
+	.uleb128 0x7
+	.long	0xbc
+	.uleb128 0x7
+	.long	0x107
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF35
+	.byte	0x9
+	.value	0x614
+	.byte	0x8
+	.long	0x43
+	.long	0x2e7
+	.uleb128 0x7
+	.long	0xbc
+	.uleb128 0x7
+	.long	0x12e
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF41
+	.value	0x4d1
+	.long	0x43
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3b7
+	.uleb128 0x5
+	.long	.LASF36
+	.value	0x4d1
+	.byte	0x19
+	.long	0xbc
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x5
+	.long	.LASF37
+	.value	0x4d1
+	.byte	0x2f
+	.long	0x3b7
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x5
+	.long	.LASF38
+	.value	0x4d1
+	.byte	0x44
+	.long	0x4f
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x5
+	.long	.LASF39
+	.value	0x4d1
+	.byte	0x53
+	.long	0x14b
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x2
+	.long	.LASF40
+	.value	0x4d2
+	.byte	0xa
+	.long	0x43
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x8
+	.long	.LLRL150
+	.uleb128 0x9
+	.string	"i"
+	.value	0x4d4
+	.byte	0xf
+	.long	0x43
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0xb
+	.quad	.LVL324
+	.long	0xbf3
+	.long	0x39e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL331
+	.long	0xbf3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x146
+	.uleb128 0x1c
+	.long	.LASF42
+	.value	0x49e
+	.long	0x43
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6d8
+	.uleb128 0x5
+	.long	.LASF36
+	.value	0x49e
+	.byte	0x1c
+	.long	0xbc
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x5
+	.long	.LASF43
+	.value	0x49e
+	.byte	0x31
+	.long	0x146
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x5
+	.long	.LASF44
+	.value	0x49e
+	.byte	0x3c
+	.long	0x91
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x2
+	.long	.LASF45
+	.value	0x4a5
+	.byte	0xc
+	.long	0x12e
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x2
+	.long	.LASF46
+	.value	0x4a7
+	.byte	0x12
+	.long	0x13a
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x2
+	.long	.LASF47
+	.value	0x4a8
+	.byte	0x12
+	.long	0x129
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x9
+	.string	"m"
+	.value	0x4ad
+	.byte	0xc
+	.long	0x12e
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x9
+	.string	"e"
+	.value	0x4ae
+	.byte	0xb
+	.long	0xe4
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0xa
+	.long	.LASF51
+	.value	0x4af
+	.byte	0xc
+	.long	0x12e
+	.uleb128 0x2
+	.long	.LASF40
+	.value	0x4bb
+	.byte	0xa
+	.long	0x43
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x2
+	.long	.LASF48
+	.value	0x4bf
+	.byte	0xc
+	.long	0x12e
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x22
+	.quad	.LBB221
+	.quad	.LBE221-.LBB221
+	.long	0x54b
+	.uleb128 0x2
+	.long	.LASF40
+	.value	0x4b2
+	.byte	0x9
+	.long	0x91
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x2
+	.long	.LASF49
+	.value	0x4b3
+	.byte	0xb
+	.long	0xbc
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0xb
+	.quad	.LVL291
+	.long	0x237
+	.long	0x51c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x14c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL294
+	.long	0x237
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x14c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.quad	.LBB217
+	.quad	.LBE217-.LBB217
+	.long	0x58d
+	.uleb128 0x2
+	.long	.LASF50
+	.value	0x4c2
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x8
+	.long	.LLRL134
+	.uleb128 0x9
+	.string	"i"
+	.value	0x4c4
+	.byte	0xe
+	.long	0x91
+	.long	.LLST135
+	.long	.LVUS135
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x6d8
+	.quad	.LBI212
+	.value	.LVU854
+	.long	.LLRL122
+	.value	0x4b0
+	.byte	0x58
+	.long	0x630
+	.uleb128 0x4
+	.long	0x709
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x4
+	.long	0x6fd
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x4
+	.long	0x6f3
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x4
+	.long	0x6e9
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x8
+	.long	.LLRL122
+	.uleb128 0x3
+	.long	0x715
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x3
+	.long	0x731
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x3
+	.long	0x73d
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x3
+	.long	0x749
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x3
+	.long	0x755
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x3
+	.long	0x761
+	.long	.LLST132
+	.long	.LVUS132
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0xdc6
+	.quad	.LBI222
+	.value	.LVU949
+	.long	.LLRL138
+	.value	0x4aa
+	.byte	0xc
+	.long	0x6ca
+	.uleb128 0x4
+	.long	0xde3
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x4
+	.long	0xdd7
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x8
+	.long	.LLRL138
+	.uleb128 0x3
+	.long	0xdef
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x3
+	.long	0xdfb
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x3
+	.long	0xe07
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x3
+	.long	0xe13
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0xb
+	.quad	.LVL302
+	.long	0x2b0
+	.long	0x6bb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL304
+	.long	0x299
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.quad	.LVL271
+	.long	0x2cb
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF64
+	.value	0x47b
+	.byte	0xc
+	.long	0x91
+	.byte	0x1
+	.long	0x76e
+	.uleb128 0xf
+	.string	"m"
+	.value	0x47b
+	.byte	0x39
+	.long	0x13a
+	.uleb128 0xf
+	.string	"e"
+	.value	0x47b
+	.byte	0x4a
+	.long	0xf0
+	.uleb128 0x10
+	.long	.LASF44
+	.value	0x47b
+	.byte	0x57
+	.long	0x98
+	.uleb128 0x10
+	.long	.LASF51
+	.value	0x47b
+	.byte	0x6c
+	.long	0x150
+	.uleb128 0xa
+	.long	.LASF48
+	.value	0x47c
+	.byte	0xc
+	.long	0x12e
+	.uleb128 0x23
+	.long	.LASF52
+	.value	0x486
+	.long	0x3c
+	.uleb128 0xe
+	.long	0x721
+	.uleb128 0xa
+	.long	.LASF53
+	.value	0x487
+	.byte	0x11
+	.long	0x72c
+	.uleb128 0xa
+	.long	.LASF54
+	.value	0x488
+	.byte	0x11
+	.long	0xf0
+	.uleb128 0xa
+	.long	.LASF55
+	.value	0x48e
+	.byte	0x11
+	.long	0x72c
+	.uleb128 0xa
+	.long	.LASF56
+	.value	0x492
+	.byte	0x11
+	.long	0x72c
+	.uleb128 0xa
+	.long	.LASF57
+	.value	0x493
+	.byte	0x11
+	.long	0x72c
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF58
+	.value	0x432
+	.long	0x43
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb6f
+	.uleb128 0x5
+	.long	.LASF36
+	.value	0x432
+	.byte	0x20
+	.long	0xbc
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x5
+	.long	.LASF43
+	.value	0x432
+	.byte	0x35
+	.long	0x146
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x5
+	.long	.LASF44
+	.value	0x432
+	.byte	0x40
+	.long	0x91
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x2
+	.long	.LASF45
+	.value	0x433
+	.byte	0xc
+	.long	0x12e
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x2
+	.long	.LASF40
+	.value	0x435
+	.byte	0xa
+	.long	0x43
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x2
+	.long	.LASF46
+	.value	0x43f
+	.byte	0x12
+	.long	0x13a
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x2
+	.long	.LASF47
+	.value	0x440
+	.byte	0x12
+	.long	0x129
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0xa
+	.long	.LASF59
+	.value	0x441
+	.byte	0x22
+	.long	0x1b9
+	.uleb128 0x1a
+	.long	.LASF60
+	.value	0x442
+	.byte	0x8
+	.long	0xb6f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x2
+	.long	.LASF38
+	.value	0x443
+	.byte	0xa
+	.long	0x43
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x2
+	.long	.LASF61
+	.value	0x444
+	.byte	0xb
+	.long	0xe4
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x19
+	.long	.LLRL94
+	.long	0x976
+	.uleb128 0x2
+	.long	.LASF62
+	.value	0x448
+	.byte	0xc
+	.long	0x43
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x19
+	.long	.LLRL96
+	.long	0x8b2
+	.uleb128 0x2
+	.long	.LASF63
+	.value	0x450
+	.byte	0xb
+	.long	0x91
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x8
+	.long	.LLRL98
+	.uleb128 0x9
+	.string	"i"
+	.value	0x452
+	.byte	0x13
+	.long	0x43
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	0xb7f
+	.quad	.LBI198
+	.value	.LVU784
+	.quad	.LBB198
+	.quad	.LBE198-.LBB198
+	.value	0x44d
+	.byte	0xf
+	.uleb128 0x4
+	.long	0xbb4
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x4
+	.long	0xba8
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x4
+	.long	0xb9c
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x4
+	.long	0xb90
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x25
+	.long	0xbc0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x3
+	.long	0xbcc
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x3
+	.long	0xbd8
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0xb
+	.quad	.LVL247
+	.long	0x237
+	.long	0x95c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL252
+	.long	0x20d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0xdc6
+	.quad	.LBI180
+	.value	.LVU630
+	.long	.LLRL87
+	.value	0x435
+	.byte	0x13
+	.long	0xa10
+	.uleb128 0x4
+	.long	0xde3
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x4
+	.long	0xdd7
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x8
+	.long	.LLRL87
+	.uleb128 0x3
+	.long	0xdef
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x3
+	.long	0xdfb
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x3
+	.long	0xe07
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x3
+	.long	0xe13
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0xb
+	.quad	.LVL196
+	.long	0x2b0
+	.long	0xa01
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL200
+	.long	0x299
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	0xb7f
+	.quad	.LBI202
+	.value	.LVU740
+	.quad	.LBB202
+	.quad	.LBE202-.LBB202
+	.byte	0x1
+	.value	0x460
+	.byte	0xd
+	.long	0xb07
+	.uleb128 0x4
+	.long	0xbb4
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x4
+	.long	0xba8
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x4
+	.long	0xb9c
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x4
+	.long	0xb90
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x25
+	.long	0xbc0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x3
+	.long	0xbcc
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x3
+	.long	0xbd8
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0xb
+	.quad	.LVL231
+	.long	0x237
+	.long	0xaee
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x31
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x41
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x41
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x31
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x41
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x41
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x31
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL237
+	.long	0x20d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL202
+	.long	0xf7a
+	.long	0xb36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xc
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL204
+	.long	0x2cb
+	.long	0xb4e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL219
+	.long	0xe20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0xc1
+	.long	0xb7f
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x24
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF65
+	.value	0x41d
+	.byte	0xf
+	.long	0x43
+	.byte	0x1
+	.long	0xbe3
+	.uleb128 0x10
+	.long	.LASF43
+	.value	0x41d
+	.byte	0x3a
+	.long	0x146
+	.uleb128 0x10
+	.long	.LASF44
+	.value	0x41d
+	.byte	0x4b
+	.long	0x98
+	.uleb128 0x10
+	.long	.LASF60
+	.value	0x41d
+	.byte	0x5c
+	.long	0xbc
+	.uleb128 0x10
+	.long	.LASF61
+	.value	0x41d
+	.byte	0x6d
+	.long	0xfc
+	.uleb128 0xa
+	.long	.LASF66
+	.value	0x41e
+	.byte	0x8
+	.long	0xbe3
+	.uleb128 0xa
+	.long	.LASF38
+	.value	0x421
+	.byte	0xa
+	.long	0x43
+	.uleb128 0x15
+	.string	"p"
+	.value	0x422
+	.byte	0xf
+	.long	0x107
+	.byte	0
+	.uleb128 0x16
+	.long	0xc1
+	.long	0xbf3
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x30
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF67
+	.value	0x403
+	.long	0x43
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdc6
+	.uleb128 0x5
+	.long	.LASF36
+	.value	0x403
+	.byte	0x16
+	.long	0xbc
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x5
+	.long	.LASF43
+	.value	0x403
+	.byte	0x2b
+	.long	0x146
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x2
+	.long	.LASF45
+	.value	0x404
+	.byte	0xc
+	.long	0x12e
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x2
+	.long	.LASF40
+	.value	0x406
+	.byte	0xa
+	.long	0x43
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x2
+	.long	.LASF46
+	.value	0x40a
+	.byte	0x12
+	.long	0x13a
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x2
+	.long	.LASF47
+	.value	0x40b
+	.byte	0x12
+	.long	0x129
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x2
+	.long	.LASF59
+	.value	0x40c
+	.byte	0x22
+	.long	0x1b9
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x1a
+	.long	.LASF60
+	.value	0x412
+	.byte	0x8
+	.long	0xcd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.long	.LASF38
+	.value	0x413
+	.byte	0xa
+	.long	0x43
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0xc
+	.long	0xdc6
+	.quad	.LBI159
+	.value	.LVU561
+	.long	.LLRL71
+	.value	0x406
+	.byte	0x13
+	.long	0xd5e
+	.uleb128 0x4
+	.long	0xde3
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x4
+	.long	0xdd7
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x8
+	.long	.LLRL71
+	.uleb128 0x3
+	.long	0xdef
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x3
+	.long	0xdfb
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x3
+	.long	0xe07
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x3
+	.long	0xe13
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0xb
+	.quad	.LVL165
+	.long	0x2b0
+	.long	0xd4f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL168
+	.long	0x299
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL169
+	.long	0xf7a
+	.long	0xd8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xc
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL181
+	.long	0x2cb
+	.long	0xda5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL183
+	.long	0xe20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF68
+	.value	0x3ee
+	.byte	0xf
+	.long	0x43
+	.byte	0x1
+	.long	0xe20
+	.uleb128 0x10
+	.long	.LASF36
+	.value	0x3ee
+	.byte	0x35
+	.long	0xbc
+	.uleb128 0x10
+	.long	.LASF45
+	.value	0x3ee
+	.byte	0x4c
+	.long	0x13a
+	.uleb128 0xa
+	.long	.LASF46
+	.value	0x3ef
+	.byte	0x12
+	.long	0x13a
+	.uleb128 0xa
+	.long	.LASF47
+	.value	0x3f0
+	.byte	0x12
+	.long	0x129
+	.uleb128 0xa
+	.long	.LASF69
+	.value	0x3f1
+	.byte	0xd
+	.long	0x98
+	.uleb128 0xa
+	.long	.LASF70
+	.value	0x3f2
+	.byte	0xf
+	.long	0x107
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF71
+	.value	0x3bb
+	.byte	0xf
+	.long	0x43
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf7a
+	.uleb128 0x5
+	.long	.LASF36
+	.value	0x3bb
+	.byte	0x2d
+	.long	0xbc
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x5
+	.long	.LASF69
+	.value	0x3bb
+	.byte	0x39
+	.long	0x91
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x5
+	.long	.LASF60
+	.value	0x3bb
+	.byte	0x4f
+	.long	0x107
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x5
+	.long	.LASF38
+	.value	0x3bb
+	.byte	0x5e
+	.long	0x43
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x5
+	.long	.LASF61
+	.value	0x3bb
+	.byte	0x6d
+	.long	0xe4
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x9
+	.string	"p"
+	.value	0x3bc
+	.byte	0x9
+	.long	0xbc
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x19
+	.long	.LLRL61
+	.long	0xf11
+	.uleb128 0x2
+	.long	.LASF27
+	.value	0x3df
+	.byte	0xd
+	.long	0xe4
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0xb
+	.quad	.LVL119
+	.long	0x2cb
+	.long	0xeed
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL145
+	.long	0x159c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x23
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL114
+	.long	0x159c
+	.long	0xf2f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL128
+	.long	0x159c
+	.long	0xf5f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL137
+	.long	0x159c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF72
+	.value	0x330
+	.byte	0x27
+	.long	0x1b9
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x148f
+	.uleb128 0x5
+	.long	.LASF46
+	.value	0x330
+	.byte	0x51
+	.long	0x13a
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x5
+	.long	.LASF47
+	.value	0x330
+	.byte	0x6f
+	.long	0x129
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x9
+	.string	"e2"
+	.value	0x331
+	.byte	0xb
+	.long	0xe4
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x9
+	.string	"m2"
+	.value	0x332
+	.byte	0xc
+	.long	0x12e
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x2
+	.long	.LASF73
+	.value	0x33b
+	.byte	0xd
+	.long	0x98
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x9
+	.string	"mv"
+	.value	0x33d
+	.byte	0x12
+	.long	0x13a
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2
+	.long	.LASF74
+	.value	0x33e
+	.byte	0x12
+	.long	0x129
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x9
+	.string	"vr"
+	.value	0x340
+	.byte	0xc
+	.long	0x12e
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x9
+	.string	"vp"
+	.value	0x340
+	.byte	0x10
+	.long	0x12e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x9
+	.string	"vm"
+	.value	0x340
+	.byte	0x14
+	.long	0x12e
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x9
+	.string	"e10"
+	.value	0x341
+	.byte	0xb
+	.long	0xe4
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2
+	.long	.LASF75
+	.value	0x342
+	.byte	0x7
+	.long	0x91
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x2
+	.long	.LASF76
+	.value	0x343
+	.byte	0x7
+	.long	0x91
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2
+	.long	.LASF77
+	.value	0x371
+	.byte	0xb
+	.long	0xe4
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x2
+	.long	.LASF78
+	.value	0x372
+	.byte	0xb
+	.long	0x111
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x2
+	.long	.LASF79
+	.value	0x373
+	.byte	0xc
+	.long	0x12e
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2
+	.long	.LASF59
+	.value	0x3a3
+	.byte	0x22
+	.long	0x1b9
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x19
+	.long	.LLRL31
+	.long	0x12e7
+	.uleb128 0x9
+	.string	"q"
+	.value	0x345
+	.byte	0x14
+	.long	0x129
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x9
+	.string	"k"
+	.value	0x347
+	.byte	0x13
+	.long	0xf0
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x15
+	.string	"i"
+	.value	0x348
+	.byte	0x13
+	.long	0xf0
+	.uleb128 0xc
+	.long	0x1564
+	.quad	.LBI79
+	.value	.LVU123
+	.long	.LLRL34
+	.value	0x345
+	.byte	0x18
+	.long	0x1149
+	.uleb128 0x4
+	.long	0x1575
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0xc
+	.long	0x148f
+	.quad	.LBI83
+	.value	.LVU167
+	.long	.LLRL36
+	.value	0x349
+	.byte	0xa
+	.long	0x1193
+	.uleb128 0x6
+	.long	0x14b6
+	.uleb128 0x6
+	.long	0x14aa
+	.uleb128 0x4
+	.long	0x14a0
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x8
+	.long	.LLRL36
+	.uleb128 0x3
+	.long	0x14d0
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x18
+	.long	0x14db
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x1580
+	.quad	.LBI91
+	.value	.LVU162
+	.long	.LLRL39
+	.value	0x347
+	.byte	0x1d
+	.long	0x11bb
+	.uleb128 0x4
+	.long	0x1591
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.uleb128 0xc
+	.long	0x148f
+	.quad	.LBI97
+	.value	.LVU174
+	.long	.LLRL41
+	.value	0x34a
+	.byte	0xa
+	.long	0x11fd
+	.uleb128 0x6
+	.long	0x14b6
+	.uleb128 0x6
+	.long	0x14aa
+	.uleb128 0x4
+	.long	0x14a0
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x8
+	.long	.LLRL41
+	.uleb128 0x18
+	.long	0x14d0
+	.uleb128 0x18
+	.long	0x14db
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x148f
+	.quad	.LBI114
+	.value	.LVU181
+	.long	.LLRL43
+	.value	0x34b
+	.byte	0xa
+	.long	0x123f
+	.uleb128 0x6
+	.long	0x14b6
+	.uleb128 0x6
+	.long	0x14aa
+	.uleb128 0x6
+	.long	0x14a0
+	.uleb128 0x8
+	.long	.LLRL43
+	.uleb128 0x3
+	.long	0x14d0
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x18
+	.long	0x14db
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	0x1514
+	.long	.LLRL45
+	.byte	0x1
+	.value	0x355
+	.byte	0xf
+	.long	0x1276
+	.uleb128 0x6
+	.long	0x1531
+	.uleb128 0x4
+	.long	0x1525
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x8
+	.long	.LLRL45
+	.uleb128 0x3
+	.long	0x153b
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.long	0x1514
+	.quad	.LBB134
+	.quad	.LBE134-.LBB134
+	.byte	0x1
+	.value	0x34f
+	.byte	0x20
+	.long	0x12b3
+	.uleb128 0x6
+	.long	0x1531
+	.uleb128 0x4
+	.long	0x1525
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x3
+	.long	0x153b
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.uleb128 0x32
+	.long	0x1514
+	.long	.LLRL50
+	.byte	0x1
+	.value	0x352
+	.byte	0x20
+	.uleb128 0x6
+	.long	0x1531
+	.uleb128 0x4
+	.long	0x1525
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x8
+	.long	.LLRL50
+	.uleb128 0x3
+	.long	0x153b
+	.long	.LLST52
+	.long	.LVUS52
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LLRL17
+	.long	0x1474
+	.uleb128 0x15
+	.string	"q"
+	.value	0x35a
+	.byte	0x14
+	.long	0x129
+	.uleb128 0x15
+	.string	"i"
+	.value	0x35c
+	.byte	0x13
+	.long	0xf0
+	.uleb128 0x15
+	.string	"k"
+	.value	0x35d
+	.byte	0x13
+	.long	0xf0
+	.uleb128 0x15
+	.string	"j"
+	.value	0x35e
+	.byte	0x13
+	.long	0xf0
+	.uleb128 0xc
+	.long	0x1548
+	.quad	.LBI34
+	.value	.LVU22
+	.long	.LLRL18
+	.value	0x35a
+	.byte	0x18
+	.long	0x1338
+	.uleb128 0x6
+	.long	0x1559
+	.byte	0
+	.uleb128 0xc
+	.long	0x1580
+	.quad	.LBI38
+	.value	.LVU28
+	.long	.LLRL19
+	.value	0x35d
+	.byte	0x17
+	.long	0x1358
+	.uleb128 0x6
+	.long	0x1591
+	.byte	0
+	.uleb128 0xc
+	.long	0x148f
+	.quad	.LBI42
+	.value	.LVU34
+	.long	.LLRL20
+	.value	0x35f
+	.byte	0xa
+	.long	0x13b2
+	.uleb128 0x6
+	.long	0x14b6
+	.uleb128 0x4
+	.long	0x14aa
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x4
+	.long	0x14a0
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x8
+	.long	.LLRL20
+	.uleb128 0x3
+	.long	0x14d0
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x3
+	.long	0x14db
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x148f
+	.quad	.LBI49
+	.value	.LVU57
+	.long	.LLRL25
+	.value	0x360
+	.byte	0xa
+	.long	0x1404
+	.uleb128 0x6
+	.long	0x14b6
+	.uleb128 0x6
+	.long	0x14aa
+	.uleb128 0x4
+	.long	0x14a0
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x8
+	.long	.LLRL25
+	.uleb128 0x3
+	.long	0x14d0
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x3
+	.long	0x14db
+	.long	.LLST28
+	.long	.LVUS28
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x148f
+	.quad	.LBI66
+	.value	.LVU74
+	.long	.LLRL29
+	.value	0x361
+	.byte	0xa
+	.long	0x143e
+	.uleb128 0x6
+	.long	0x14b6
+	.uleb128 0x6
+	.long	0x14aa
+	.uleb128 0x6
+	.long	0x14a0
+	.uleb128 0x8
+	.long	.LLRL29
+	.uleb128 0x18
+	.long	0x14d0
+	.uleb128 0x18
+	.long	0x14db
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	0x14ec
+	.quad	.LBI71
+	.value	.LVU88
+	.quad	.LBB71
+	.quad	.LBE71-.LBB71
+	.value	0x36d
+	.byte	0x1e
+	.uleb128 0x6
+	.long	0x1509
+	.uleb128 0x4
+	.long	0x14fd
+	.long	.LLST30
+	.long	.LVUS30
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LLRL53
+	.uleb128 0x2
+	.long	.LASF63
+	.value	0x392
+	.byte	0x9
+	.long	0x91
+	.long	.LLST54
+	.long	.LVUS54
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF80
+	.value	0x305
+	.byte	0x18
+	.long	0x12e
+	.byte	0x3
+	.long	0x14e7
+	.uleb128 0xf
+	.string	"m"
+	.value	0x305
+	.byte	0x43
+	.long	0x13a
+	.uleb128 0xf
+	.string	"mul"
+	.value	0x305
+	.byte	0x56
+	.long	0x14e7
+	.uleb128 0xf
+	.string	"j"
+	.value	0x305
+	.byte	0x69
+	.long	0xf0
+	.uleb128 0x23
+	.long	.LASF52
+	.value	0x307
+	.long	0x3c
+	.uleb128 0xe
+	.long	0x14c0
+	.uleb128 0x15
+	.string	"b0"
+	.value	0x308
+	.byte	0x11
+	.long	0x14cb
+	.uleb128 0x15
+	.string	"b2"
+	.value	0x309
+	.byte	0x11
+	.long	0x14cb
+	.byte	0
+	.uleb128 0x12
+	.long	0x13a
+	.uleb128 0x13
+	.long	.LASF81
+	.value	0x2fe
+	.byte	0x13
+	.long	0x91
+	.byte	0x3
+	.long	0x1514
+	.uleb128 0x10
+	.long	.LASF43
+	.value	0x2fe
+	.byte	0x45
+	.long	0x13a
+	.uleb128 0xf
+	.string	"p"
+	.value	0x2fe
+	.byte	0x5b
+	.long	0x129
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF82
+	.value	0x2f2
+	.byte	0x13
+	.long	0x91
+	.byte	0x3
+	.long	0x1548
+	.uleb128 0x10
+	.long	.LASF43
+	.value	0x2f2
+	.byte	0x3f
+	.long	0x12e
+	.uleb128 0xf
+	.string	"p"
+	.value	0x2f2
+	.byte	0x55
+	.long	0x129
+	.uleb128 0xa
+	.long	.LASF38
+	.value	0x2f3
+	.byte	0xc
+	.long	0x11d
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF83
+	.value	0x2eb
+	.byte	0x18
+	.long	0x11d
+	.byte	0x3
+	.long	0x1564
+	.uleb128 0xf
+	.string	"e"
+	.value	0x2eb
+	.byte	0x43
+	.long	0xf0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF84
+	.value	0x2e4
+	.byte	0x18
+	.long	0x11d
+	.byte	0x3
+	.long	0x1580
+	.uleb128 0xf
+	.string	"e"
+	.value	0x2e4
+	.byte	0x43
+	.long	0xf0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF85
+	.value	0x2dd
+	.byte	0x17
+	.long	0xe4
+	.byte	0x3
+	.long	0x159c
+	.uleb128 0xf
+	.string	"e"
+	.value	0x2dd
+	.byte	0x41
+	.long	0xf0
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF32
+	.long	.LASF88
+	.byte	0xa
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 43
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS145:
+	.uleb128 0
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 .LVU1025
+	.uleb128 .LVU1025
+	.uleb128 .LVU1031
+	.uleb128 .LVU1031
+	.uleb128 .LVU1038
+	.uleb128 .LVU1038
+	.uleb128 0
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS146:
+	.uleb128 0
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 .LVU1025
+	.uleb128 .LVU1025
+	.uleb128 .LVU1031
+	.uleb128 .LVU1031
+	.uleb128 .LVU1038
+	.uleb128 .LVU1038
+	.uleb128 0
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS147:
+	.uleb128 0
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 .LVU1029
+	.uleb128 .LVU1029
+	.uleb128 .LVU1031
+	.uleb128 .LVU1031
+	.uleb128 .LVU1038
+	.uleb128 .LVU1038
+	.uleb128 0
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS148:
+	.uleb128 0
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 .LVU1030
+	.uleb128 .LVU1030
+	.uleb128 .LVU1031
+	.uleb128 .LVU1031
+	.uleb128 .LVU1038
+	.uleb128 .LVU1038
+	.uleb128 0
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU1008
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 .LVU1025
+	.uleb128 .LVU1031
+	.uleb128 .LVU1038
+	.uleb128 .LVU1038
+	.uleb128 0
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU1013
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 .LVU1022
+	.uleb128 .LVU1022
+	.uleb128 .LVU1024
+	.uleb128 .LVU1024
+	.uleb128 .LVU1025
+	.uleb128 .LVU1031
+	.uleb128 .LVU1035
+	.uleb128 .LVU1035
+	.uleb128 .LVU1037
+	.uleb128 .LVU1037
+	.uleb128 .LVU1038
+	.uleb128 .LVU1038
+	.uleb128 0
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU840
+	.uleb128 .LVU840
+	.uleb128 .LVU906
+	.uleb128 .LVU906
+	.uleb128 .LVU907
+	.uleb128 .LVU907
+	.uleb128 .LVU925
+	.uleb128 .LVU925
+	.uleb128 .LVU928
+	.uleb128 .LVU928
+	.uleb128 .LVU965
+	.uleb128 .LVU965
+	.uleb128 .LVU967
+	.uleb128 .LVU967
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU875
+	.uleb128 .LVU875
+	.uleb128 .LVU907
+	.uleb128 .LVU907
+	.uleb128 .LVU932
+	.uleb128 .LVU932
+	.uleb128 .LVU935
+	.uleb128 .LVU935
+	.uleb128 .LVU938
+	.uleb128 .LVU938
+	.uleb128 .LVU947
+	.uleb128 .LVU947
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 .LVU967
+	.uleb128 .LVU967
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL294-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL294-1-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS114:
+	.uleb128 0
+	.uleb128 .LVU835
+	.uleb128 .LVU835
+	.uleb128 .LVU898
+	.uleb128 .LVU898
+	.uleb128 .LVU900
+	.uleb128 .LVU900
+	.uleb128 .LVU905
+	.uleb128 .LVU905
+	.uleb128 .LVU907
+	.uleb128 .LVU907
+	.uleb128 .LVU957
+	.uleb128 .LVU957
+	.uleb128 .LVU960
+	.uleb128 .LVU960
+	.uleb128 .LVU967
+	.uleb128 .LVU967
+	.uleb128 0
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x30
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x44
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x44
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x30
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x44
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x44
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x34
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x44
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x44
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x30
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x44
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x44
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x30
+	.byte	0x74
+	.sleb128 0
+	.byte	0x44
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x44
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x30
+	.byte	0x74
+	.sleb128 0
+	.byte	0x44
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x44
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x34
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x44
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x44
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x30
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x44
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x44
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU837
+	.uleb128 .LVU875
+	.uleb128 .LVU875
+	.uleb128 .LVU907
+	.uleb128 .LVU907
+	.uleb128 .LVU932
+	.uleb128 .LVU932
+	.uleb128 .LVU935
+	.uleb128 .LVU935
+	.uleb128 .LVU938
+	.uleb128 .LVU938
+	.uleb128 .LVU947
+	.uleb128 .LVU947
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 .LVU967
+	.uleb128 .LVU967
+	.uleb128 0
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL294-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL294-1-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU843
+	.uleb128 .LVU875
+	.uleb128 .LVU875
+	.uleb128 .LVU907
+	.uleb128 .LVU907
+	.uleb128 .LVU932
+	.uleb128 .LVU932
+	.uleb128 .LVU935
+	.uleb128 .LVU935
+	.uleb128 .LVU938
+	.uleb128 .LVU938
+	.uleb128 .LVU947
+	.uleb128 .LVU947
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 .LVU967
+	.uleb128 .LVU967
+	.uleb128 0
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x14
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x14
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL294-1-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL294-1-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x14
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x14
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU844
+	.uleb128 .LVU864
+	.uleb128 .LVU864
+	.uleb128 .LVU875
+	.uleb128 .LVU907
+	.uleb128 .LVU923
+	.uleb128 .LVU923
+	.uleb128 .LVU929
+	.uleb128 .LVU929
+	.uleb128 .LVU931
+	.uleb128 .LVU931
+	.uleb128 .LVU932
+	.uleb128 .LVU935
+	.uleb128 .LVU937
+	.uleb128 .LVU937
+	.uleb128 .LVU938
+	.uleb128 .LVU947
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU961
+	.uleb128 .LVU967
+	.uleb128 .LVU987
+	.uleb128 .LVU987
+	.uleb128 .LVU989
+	.uleb128 .LVU989
+	.uleb128 .LVU1004
+	.uleb128 .LVU1004
+	.uleb128 0
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0xa
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 0x4
+	.byte	0x79
+	.sleb128 1075
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL294-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 0x7
+	.byte	0x71
+	.sleb128 0
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x4
+	.byte	0x79
+	.sleb128 1075
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x7
+	.byte	0x79
+	.sleb128 0
+	.byte	0x20
+	.byte	0x23
+	.uleb128 0x433
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU849
+	.uleb128 .LVU851
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU851
+	.uleb128 .LVU864
+	.uleb128 .LVU864
+	.uleb128 .LVU871
+	.uleb128 .LVU907
+	.uleb128 .LVU920
+	.uleb128 .LVU929
+	.uleb128 .LVU932
+	.uleb128 .LVU967
+	.uleb128 .LVU989
+	.uleb128 .LVU989
+	.uleb128 .LVU1004
+	.uleb128 .LVU1004
+	.uleb128 0
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0xe
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0xa
+	.value	0x433
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x4
+	.byte	0xb
+	.value	0xfbce
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL291-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x4
+	.byte	0x79
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU869
+	.uleb128 .LVU871
+	.uleb128 .LVU872
+	.uleb128 .LVU875
+	.uleb128 .LVU875
+	.uleb128 .LVU876
+	.uleb128 .LVU876
+	.uleb128 .LVU904
+	.uleb128 .LVU922
+	.uleb128 .LVU926
+	.uleb128 .LVU926
+	.uleb128 .LVU929
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL271-1-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU873
+	.uleb128 .LVU904
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU932
+	.uleb128 .LVU935
+	.uleb128 .LVU938
+	.uleb128 .LVU942
+	.uleb128 .LVU942
+	.uleb128 .LVU947
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU943
+	.uleb128 .LVU947
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU883
+	.uleb128 .LVU887
+	.uleb128 .LVU887
+	.uleb128 .LVU891
+	.uleb128 .LVU894
+	.uleb128 .LVU900
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU886
+	.uleb128 .LVU887
+	.uleb128 .LVU887
+	.uleb128 .LVU890
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x9
+	.byte	0x74
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU854
+	.uleb128 .LVU864
+	.uleb128 .LVU910
+	.uleb128 .LVU920
+	.uleb128 .LVU967
+	.uleb128 .LVU998
+	.uleb128 .LVU1000
+	.uleb128 0
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1145
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1145
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1145
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1145
+	.sleb128 0
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU854
+	.uleb128 .LVU864
+	.uleb128 .LVU910
+	.uleb128 .LVU920
+	.uleb128 .LVU967
+	.uleb128 .LVU998
+	.uleb128 .LVU1000
+	.uleb128 0
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU854
+	.uleb128 .LVU864
+	.uleb128 .LVU910
+	.uleb128 .LVU920
+	.uleb128 .LVU967
+	.uleb128 .LVU989
+	.uleb128 .LVU989
+	.uleb128 .LVU998
+	.uleb128 .LVU1000
+	.uleb128 .LVU1004
+	.uleb128 .LVU1004
+	.uleb128 0
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x4
+	.byte	0xb
+	.value	0xfbce
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x4
+	.byte	0x79
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x4
+	.byte	0x79
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU854
+	.uleb128 .LVU863
+	.uleb128 .LVU910
+	.uleb128 .LVU920
+	.uleb128 .LVU967
+	.uleb128 .LVU979
+	.uleb128 .LVU979
+	.uleb128 .LVU980
+	.uleb128 .LVU1004
+	.uleb128 0
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU857
+	.uleb128 .LVU864
+	.uleb128 .LVU913
+	.uleb128 .LVU920
+	.uleb128 .LVU967
+	.uleb128 .LVU998
+	.uleb128 .LVU1000
+	.uleb128 0
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU916
+	.uleb128 .LVU920
+	.uleb128 .LVU973
+	.uleb128 .LVU990
+	.uleb128 .LVU1004
+	.uleb128 0
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x18
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x6
+	.byte	0x5a
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5b
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x6
+	.byte	0x5a
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5b
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU917
+	.uleb128 .LVU920
+	.uleb128 .LVU975
+	.uleb128 .LVU993
+	.uleb128 .LVU993
+	.uleb128 .LVU998
+	.uleb128 .LVU1000
+	.uleb128 .LVU1004
+	.uleb128 .LVU1004
+	.uleb128 0
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x432
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU981
+	.uleb128 .LVU997
+	.uleb128 .LVU1000
+	.uleb128 .LVU1003
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x6
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x51
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x6
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x51
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU991
+	.uleb128 .LVU997
+	.uleb128 .LVU1000
+	.uleb128 .LVU1001
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x6
+	.byte	0x5a
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5b
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x6
+	.byte	0x5a
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5b
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU994
+	.uleb128 .LVU998
+	.uleb128 .LVU1000
+	.uleb128 .LVU1004
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x6
+	.byte	0x54
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x55
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x6
+	.byte	0x54
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x55
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU949
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 .LVU967
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU949
+	.uleb128 .LVU965
+	.uleb128 .LVU965
+	.uleb128 .LVU967
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU951
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 .LVU967
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x14
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU952
+	.uleb128 .LVU967
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x9f
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU953
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 .LVU967
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0xd
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU954
+	.uleb128 .LVU958
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 0
+	.uleb128 .LVU626
+	.uleb128 .LVU626
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU660
+	.uleb128 .LVU660
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU724
+	.uleb128 .LVU724
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS79:
+	.uleb128 0
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 .LVU660
+	.uleb128 .LVU660
+	.uleb128 .LVU675
+	.uleb128 .LVU675
+	.uleb128 .LVU733
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+	.uleb128 .LVU736
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.byte	0
+.LVUS80:
+	.uleb128 0
+	.uleb128 .LVU633
+	.uleb128 .LVU633
+	.uleb128 .LVU659
+	.uleb128 .LVU659
+	.uleb128 .LVU660
+	.uleb128 .LVU660
+	.uleb128 .LVU664
+	.uleb128 .LVU664
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU724
+	.uleb128 .LVU724
+	.uleb128 .LVU733
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+	.uleb128 .LVU736
+	.uleb128 .LVU744
+	.uleb128 .LVU744
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU782
+	.uleb128 .LVU782
+	.uleb128 0
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x30
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x41
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x41
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x31
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x41
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x41
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x34
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x41
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x41
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x31
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x41
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x41
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL231-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL231-1-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x30
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x41
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x41
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x31
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x41
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x41
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU629
+	.uleb128 .LVU642
+	.uleb128 .LVU642
+	.uleb128 .LVU653
+	.uleb128 .LVU660
+	.uleb128 .LVU675
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU662
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU665
+	.uleb128 .LVU669
+	.uleb128 .LVU669
+	.uleb128 .LVU675
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL202-1-.Ltext0
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU666
+	.uleb128 .LVU669
+	.uleb128 .LVU669
+	.uleb128 .LVU675
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL202-1-.Ltext0
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU677
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 .LVU699
+	.uleb128 .LVU699
+	.uleb128 .LVU702
+	.uleb128 .LVU702
+	.uleb128 .LVU718
+	.uleb128 .LVU724
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+	.uleb128 .LVU745
+	.uleb128 .LVU782
+	.uleb128 .LVU789
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU680
+	.uleb128 .LVU720
+	.uleb128 .LVU724
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+	.uleb128 .LVU746
+	.uleb128 .LVU771
+	.uleb128 .LVU778
+	.uleb128 .LVU782
+	.uleb128 .LVU790
+	.uleb128 .LVU814
+	.uleb128 .LVU821
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL219-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL231-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL247-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU687
+	.uleb128 .LVU702
+	.uleb128 .LVU782
+	.uleb128 .LVU788
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU698
+	.uleb128 .LVU702
+	.uleb128 .LVU702
+	.uleb128 .LVU705
+	.uleb128 .LVU705
+	.uleb128 .LVU708
+	.uleb128 .LVU708
+	.uleb128 .LVU709
+	.uleb128 .LVU724
+	.uleb128 .LVU733
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0xe
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x4a
+	.byte	0x8
+	.byte	0x39
+	.byte	0x24
+	.byte	0x2b
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x39
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0xe
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0x39
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x39
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU701
+	.uleb128 .LVU702
+	.uleb128 .LVU703
+	.uleb128 .LVU704
+	.uleb128 .LVU704
+	.uleb128 .LVU712
+	.uleb128 .LVU724
+	.uleb128 .LVU733
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU784
+	.uleb128 0
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+2123
+	.sleb128 0
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU784
+	.uleb128 0
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU784
+	.uleb128 0
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU784
+	.uleb128 .LVU787
+	.uleb128 .LVU787
+	.uleb128 .LVU790
+	.uleb128 .LVU790
+	.uleb128 0
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL247-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL247-1-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU791
+	.uleb128 .LVU798
+	.uleb128 .LVU798
+	.uleb128 .LVU806
+	.uleb128 .LVU806
+	.uleb128 .LVU810
+	.uleb128 .LVU816
+	.uleb128 0
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU792
+	.uleb128 .LVU798
+	.uleb128 .LVU798
+	.uleb128 .LVU803
+	.uleb128 .LVU803
+	.uleb128 .LVU807
+	.uleb128 .LVU807
+	.uleb128 .LVU813
+	.uleb128 .LVU821
+	.uleb128 0
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL252-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU630
+	.uleb128 .LVU642
+	.uleb128 .LVU642
+	.uleb128 .LVU653
+	.uleb128 .LVU660
+	.uleb128 .LVU662
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU630
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU660
+	.uleb128 .LVU660
+	.uleb128 .LVU662
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU638
+	.uleb128 .LVU651
+	.uleb128 .LVU651
+	.uleb128 .LVU653
+	.uleb128 .LVU660
+	.uleb128 .LVU662
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU639
+	.uleb128 .LVU652
+	.uleb128 .LVU652
+	.uleb128 .LVU653
+	.uleb128 .LVU660
+	.uleb128 .LVU662
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU642
+	.uleb128 .LVU657
+	.uleb128 .LVU660
+	.uleb128 .LVU721
+	.uleb128 .LVU724
+	.uleb128 0
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU643
+	.uleb128 .LVU650
+	.uleb128 .LVU660
+	.uleb128 .LVU662
+	.uleb128 .LVU733
+	.uleb128 .LVU736
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU740
+	.uleb128 .LVU782
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+2123
+	.sleb128 0
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU740
+	.uleb128 .LVU782
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU740
+	.uleb128 .LVU744
+	.uleb128 .LVU744
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU782
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL231-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL231-1-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x30
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x41
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x41
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x31
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x41
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x41
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU740
+	.uleb128 .LVU743
+	.uleb128 .LVU743
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU782
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL231-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL231-1-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU747
+	.uleb128 .LVU754
+	.uleb128 .LVU754
+	.uleb128 .LVU762
+	.uleb128 .LVU762
+	.uleb128 .LVU766
+	.uleb128 .LVU773
+	.uleb128 .LVU782
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU748
+	.uleb128 .LVU754
+	.uleb128 .LVU754
+	.uleb128 .LVU759
+	.uleb128 .LVU759
+	.uleb128 .LVU763
+	.uleb128 .LVU763
+	.uleb128 .LVU767
+	.uleb128 .LVU767
+	.uleb128 .LVU770
+	.uleb128 .LVU778
+	.uleb128 .LVU782
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS63:
+	.uleb128 0
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU583
+	.uleb128 .LVU583
+	.uleb128 .LVU586
+	.uleb128 .LVU586
+	.uleb128 .LVU618
+	.uleb128 .LVU618
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS64:
+	.uleb128 0
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU586
+	.uleb128 .LVU586
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU560
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU586
+	.uleb128 .LVU586
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU586
+	.uleb128 .LVU619
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU589
+	.uleb128 .LVU592
+	.uleb128 .LVU592
+	.uleb128 .LVU612
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU590
+	.uleb128 .LVU592
+	.uleb128 .LVU592
+	.uleb128 .LVU612
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL169-1-.Ltext0
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU594
+	.uleb128 .LVU595
+	.uleb128 .LVU595
+	.uleb128 .LVU596
+	.uleb128 .LVU597
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU600
+	.uleb128 .LVU601
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU605
+	.uleb128 .LVU605
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 .LVU607
+	.uleb128 .LVU607
+	.uleb128 .LVU609
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x5
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x5
+	.byte	0x51
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x7
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x7
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0xa
+	.byte	0x51
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x9
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x9
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0xa
+	.byte	0x51
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x5
+	.byte	0x51
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU614
+	.uleb128 .LVU616
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU561
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU586
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa9
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU561
+	.uleb128 .LVU583
+	.uleb128 .LVU583
+	.uleb128 .LVU586
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU566
+	.uleb128 .LVU578
+	.uleb128 .LVU578
+	.uleb128 .LVU580
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0xd
+	.byte	0x81
+	.sleb128 0
+	.byte	0x10
+	.uleb128 0xfffffffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU567
+	.uleb128 .LVU579
+	.uleb128 .LVU579
+	.uleb128 .LVU580
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x81
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU570
+	.uleb128 .LVU582
+	.uleb128 .LVU586
+	.uleb128 .LVU617
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU571
+	.uleb128 .LVU577
+	.uleb128 .LVU619
+	.uleb128 0
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU494
+	.uleb128 .LVU494
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 .LVU507
+	.uleb128 .LVU507
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU525
+	.uleb128 .LVU525
+	.uleb128 .LVU531
+	.uleb128 .LVU531
+	.uleb128 .LVU543
+	.uleb128 .LVU543
+	.uleb128 .LVU545
+	.uleb128 .LVU545
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS56:
+	.uleb128 0
+	.uleb128 .LVU446
+	.uleb128 .LVU446
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU467
+	.uleb128 .LVU467
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU496
+	.uleb128 .LVU496
+	.uleb128 .LVU543
+	.uleb128 .LVU543
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 0
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU507
+	.uleb128 .LVU507
+	.uleb128 .LVU517
+	.uleb128 .LVU517
+	.uleb128 .LVU522
+	.uleb128 .LVU522
+	.uleb128 .LVU525
+	.uleb128 .LVU525
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU543
+	.uleb128 .LVU543
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 0
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS58:
+	.uleb128 0
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 .LVU507
+	.uleb128 .LVU507
+	.uleb128 .LVU512
+	.uleb128 .LVU512
+	.uleb128 .LVU525
+	.uleb128 .LVU525
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 .LVU528
+	.uleb128 .LVU528
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 .LVU543
+	.uleb128 .LVU543
+	.uleb128 .LVU547
+	.uleb128 .LVU547
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 .LVU507
+	.uleb128 .LVU507
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 .LVU525
+	.uleb128 .LVU525
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 .LVU543
+	.uleb128 .LVU543
+	.uleb128 .LVU547
+	.uleb128 .LVU547
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL114-1-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU444
+	.uleb128 .LVU451
+	.uleb128 .LVU474
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 .LVU481
+	.uleb128 .LVU484
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 .LVU493
+	.uleb128 .LVU506
+	.uleb128 .LVU507
+	.uleb128 .LVU514
+	.uleb128 .LVU525
+	.uleb128 .LVU533
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU541
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU475
+	.uleb128 .LVU484
+	.uleb128 .LVU537
+	.uleb128 .LVU541
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 .LVU397
+	.uleb128 .LVU397
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 1077
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU9
+	.uleb128 .LVU21
+	.uleb128 .LVU109
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU216
+	.uleb128 .LVU368
+	.uleb128 .LVU384
+	.uleb128 .LVU389
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 .LVU405
+	.uleb128 .LVU419
+	.uleb128 .LVU438
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x4
+	.byte	0xb
+	.value	0xfbcc
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 -1077
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x4
+	.byte	0x74
+	.sleb128 -1077
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0x435
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0x435
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0x435
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0x435
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU9
+	.uleb128 .LVU21
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU10
+	.uleb128 .LVU21
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x5
+	.byte	0x75
+	.sleb128 0
+	.byte	0x31
+	.byte	0x27
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU12
+	.uleb128 .LVU91
+	.uleb128 .LVU112
+	.uleb128 .LVU216
+	.uleb128 .LVU278
+	.uleb128 .LVU283
+	.uleb128 .LVU368
+	.uleb128 .LVU369
+	.uleb128 .LVU389
+	.uleb128 .LVU405
+	.uleb128 .LVU419
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 .LVU438
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU13
+	.uleb128 .LVU21
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU226
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU254
+	.uleb128 .LVU274
+	.uleb128 .LVU278
+	.uleb128 .LVU292
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU350
+	.uleb128 .LVU350
+	.uleb128 .LVU355
+	.uleb128 .LVU356
+	.uleb128 .LVU367
+	.uleb128 .LVU384
+	.uleb128 .LVU389
+	.uleb128 .LVU405
+	.uleb128 .LVU415
+	.uleb128 .LVU416
+	.uleb128 .LVU418
+	.uleb128 .LVU418
+	.uleb128 .LVU419
+	.uleb128 .LVU438
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU240
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU245
+	.uleb128 .LVU275
+	.uleb128 .LVU278
+	.uleb128 .LVU321
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 .LVU327
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU82
+	.uleb128 .LVU94
+	.uleb128 .LVU189
+	.uleb128 .LVU216
+	.uleb128 .LVU226
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 .LVU254
+	.uleb128 .LVU276
+	.uleb128 .LVU303
+	.uleb128 .LVU303
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU306
+	.uleb128 .LVU322
+	.uleb128 .LVU350
+	.uleb128 .LVU351
+	.uleb128 .LVU368
+	.uleb128 .LVU368
+	.uleb128 .LVU389
+	.uleb128 .LVU405
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU419
+	.uleb128 .LVU419
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU161
+	.uleb128 .LVU216
+	.uleb128 .LVU368
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU389
+	.uleb128 .LVU419
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 .LVU438
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU16
+	.uleb128 .LVU94
+	.uleb128 .LVU116
+	.uleb128 .LVU216
+	.uleb128 .LVU278
+	.uleb128 .LVU292
+	.uleb128 .LVU292
+	.uleb128 .LVU334
+	.uleb128 .LVU368
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 .LVU405
+	.uleb128 .LVU405
+	.uleb128 .LVU411
+	.uleb128 .LVU419
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU17
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU94
+	.uleb128 .LVU117
+	.uleb128 .LVU216
+	.uleb128 .LVU278
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 .LVU292
+	.uleb128 .LVU292
+	.uleb128 .LVU368
+	.uleb128 .LVU368
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 .LVU405
+	.uleb128 .LVU405
+	.uleb128 .LVU411
+	.uleb128 .LVU419
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x6
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU213
+	.uleb128 .LVU216
+	.uleb128 .LVU226
+	.uleb128 .LVU265
+	.uleb128 .LVU277
+	.uleb128 .LVU278
+	.uleb128 .LVU288
+	.uleb128 .LVU303
+	.uleb128 .LVU303
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU342
+	.uleb128 .LVU342
+	.uleb128 .LVU352
+	.uleb128 .LVU352
+	.uleb128 .LVU368
+	.uleb128 .LVU385
+	.uleb128 .LVU389
+	.uleb128 .LVU405
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU419
+	.uleb128 .LVU438
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU214
+	.uleb128 .LVU216
+	.uleb128 .LVU289
+	.uleb128 .LVU303
+	.uleb128 .LVU304
+	.uleb128 .LVU314
+	.uleb128 .LVU317
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU320
+	.uleb128 .LVU333
+	.uleb128 .LVU341
+	.uleb128 .LVU344
+	.uleb128 .LVU346
+	.uleb128 .LVU346
+	.uleb128 .LVU347
+	.uleb128 .LVU356
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU368
+	.uleb128 .LVU386
+	.uleb128 .LVU389
+	.uleb128 .LVU405
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU415
+	.uleb128 .LVU416
+	.uleb128 .LVU419
+	.uleb128 .LVU438
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0xd
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x31
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0xd
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x31
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU258
+	.uleb128 .LVU265
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU260
+	.uleb128 .LVU264
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x10
+	.byte	0x5a
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x79
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -100
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU131
+	.uleb128 .LVU216
+	.uleb128 .LVU368
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU384
+	.uleb128 .LVU419
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 .LVU438
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU164
+	.uleb128 .LVU216
+	.uleb128 .LVU368
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU384
+	.uleb128 .LVU419
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 .LVU438
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0xc
+	.long	0x12934f
+	.byte	0x1e
+	.byte	0x43
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x7d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0xc
+	.long	0x12934f
+	.byte	0x1e
+	.byte	0x43
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x7d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x10
+	.byte	0x91
+	.sleb128 -100
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0x12934f
+	.byte	0x1e
+	.byte	0x43
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x7d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0xc
+	.long	0x12934f
+	.byte	0x1e
+	.byte	0x43
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x7d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x10
+	.byte	0x91
+	.sleb128 -100
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0x12934f
+	.byte	0x1e
+	.byte	0x43
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x7d
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU123
+	.uleb128 .LVU125
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU167
+	.uleb128 .LVU172
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0xe
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU162
+	.uleb128 .LVU164
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU174
+	.uleb128 .LVU179
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU184
+	.uleb128 .LVU189
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0xe
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU196
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU201
+	.uleb128 .LVU203
+	.uleb128 .LVU207
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU196
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU207
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU369
+	.uleb128 .LVU371
+	.uleb128 .LVU373
+	.uleb128 .LVU379
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU369
+	.uleb128 .LVU372
+	.uleb128 .LVU372
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU379
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU423
+	.uleb128 .LVU425
+	.uleb128 .LVU427
+	.uleb128 .LVU431
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU419
+	.uleb128 .LVU423
+	.uleb128 .LVU423
+	.uleb128 .LVU426
+	.uleb128 .LVU426
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 .LVU431
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU34
+	.uleb128 .LVU43
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU34
+	.uleb128 .LVU55
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU38
+	.uleb128 .LVU55
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0xe
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x74
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU40
+	.uleb128 .LVU55
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0xe
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x7f
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU57
+	.uleb128 .LVU67
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU60
+	.uleb128 .LVU67
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x10
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x6
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x74
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU61
+	.uleb128 .LVU67
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x10
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x6
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x7f
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU88
+	.uleb128 .LVU91
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU217
+	.uleb128 .LVU226
+	.uleb128 .LVU235
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU254
+	.uleb128 .LVU265
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU278
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1f
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x3a
+	.byte	0x1d
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9223372036854775804
+	.byte	0x2b
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1f
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3a
+	.byte	0x1d
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9223372036854775804
+	.byte	0x2b
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB147-.Ltext0
+	.uleb128 .LBE147-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB149-.Ltext0
+	.uleb128 .LBE149-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB154-.Ltext0
+	.uleb128 .LBE154-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB119-.Ltext0
+	.uleb128 .LBE119-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB132-.Ltext0
+	.uleb128 .LBE132-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB133-.Ltext0
+	.uleb128 .LBE133-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB139-.Ltext0
+	.uleb128 .LBE139-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0
+.LLRL53:
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB146-.Ltext0
+	.uleb128 .LBE146-.Ltext0
+	.byte	0
+.LLRL61:
+	.byte	0x4
+	.uleb128 .LBB155-.Ltext0
+	.uleb128 .LBE155-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0
+.LLRL71:
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB166-.Ltext0
+	.uleb128 .LBE166-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB188-.Ltext0
+	.uleb128 .LBE188-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB189-.Ltext0
+	.uleb128 .LBE189-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB190-.Ltext0
+	.uleb128 .LBE190-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB191-.Ltext0
+	.uleb128 .LBE191-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB192-.Ltext0
+	.uleb128 .LBE192-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB201-.Ltext0
+	.uleb128 .LBE201-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB193-.Ltext0
+	.uleb128 .LBE193-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB200-.Ltext0
+	.uleb128 .LBE200-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB204-.Ltext0
+	.uleb128 .LBE204-.Ltext0
+	.byte	0
+.LLRL96:
+	.byte	0x4
+	.uleb128 .LBB194-.Ltext0
+	.uleb128 .LBE194-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB197-.Ltext0
+	.uleb128 .LBE197-.Ltext0
+	.byte	0
+.LLRL98:
+	.byte	0x4
+	.uleb128 .LBB195-.Ltext0
+	.uleb128 .LBE195-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB196-.Ltext0
+	.uleb128 .LBE196-.Ltext0
+	.byte	0
+.LLRL122:
+	.byte	0x4
+	.uleb128 .LBB212-.Ltext0
+	.uleb128 .LBE212-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB228-.Ltext0
+	.uleb128 .LBE228-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB229-.Ltext0
+	.uleb128 .LBE229-.Ltext0
+	.byte	0
+.LLRL134:
+	.byte	0x4
+	.uleb128 .LBB218-.Ltext0
+	.uleb128 .LBE218-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB219-.Ltext0
+	.uleb128 .LBE219-.Ltext0
+	.byte	0
+.LLRL138:
+	.byte	0x4
+	.uleb128 .LBB222-.Ltext0
+	.uleb128 .LBE222-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB226-.Ltext0
+	.uleb128 .LBE226-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB227-.Ltext0
+	.uleb128 .LBE227-.Ltext0
+	.byte	0
+.LLRL150:
+	.byte	0x4
+	.uleb128 .LBB230-.Ltext0
+	.uleb128 .LBE230-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB231-.Ltext0
+	.uleb128 .LBE231-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB232-.Ltext0
+	.uleb128 .LBE232-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF71:
+	.string	"numeric_formatter_write"
+.LASF88:
+	.string	"__builtin_memcpy"
+.LASF65:
+	.string	"numeric_formatter_libc_digits"
+.LASF56:
+	.string	"remainder"
+.LASF22:
+	.string	"uint64_t"
+.LASF11:
+	.string	"short int"
+.LASF9:
+	.string	"size_t"
+.LASF67:
+	.string	"dtos_to"
+.LASF80:
+	.string	"numeric_formatter_mul_shift"
+.LASF17:
+	.string	"long long int"
+.LASF13:
+	.string	"__uint32_t"
+.LASF75:
+	.string	"vm_is_trailing_zeros"
+.LASF26:
+	.string	"mantissa"
+.LASF32:
+	.string	"memcpy"
+.LASF43:
+	.string	"value"
+.LASF76:
+	.string	"vr_is_trailing_zeros"
+.LASF20:
+	.string	"uint8_t"
+.LASF74:
+	.string	"mm_shift"
+.LASF51:
+	.string	"scaled"
+.LASF55:
+	.string	"quotient"
+.LASF27:
+	.string	"exponent"
+.LASF40:
+	.string	"length"
+.LASF30:
+	.string	"snprintf"
+.LASF23:
+	.string	"long double"
+.LASF45:
+	.string	"bits"
+.LASF4:
+	.string	"__int128 unsigned"
+.LASF39:
+	.string	"offsets"
+.LASF31:
+	.string	"memset"
+.LASF14:
+	.string	"long int"
+.LASF54:
+	.string	"shift"
+.LASF66:
+	.string	"string"
+.LASF41:
+	.string	"dtos_batch"
+.LASF29:
+	.string	"strtol"
+.LASF37:
+	.string	"values"
+.LASF10:
+	.string	"__uint8_t"
+.LASF60:
+	.string	"digits"
+.LASF6:
+	.string	"unsigned char"
+.LASF63:
+	.string	"round_up"
+.LASF62:
+	.string	"tail"
+.LASF8:
+	.string	"signed char"
+.LASF19:
+	.string	"long long unsigned int"
+.LASF21:
+	.string	"uint32_t"
+.LASF85:
+	.string	"numeric_formatter_pow5_bits"
+.LASF5:
+	.string	"unsigned int"
+.LASF78:
+	.string	"last_removed_digit"
+.LASF50:
+	.string	"fraction"
+.LASF42:
+	.string	"dtos_fixed_to"
+.LASF57:
+	.string	"half"
+.LASF16:
+	.string	"char"
+.LASF25:
+	.string	"numeric_formatter_pow5_split"
+.LASF33:
+	.string	"strlen"
+.LASF18:
+	.string	"int32_t"
+.LASF81:
+	.string	"numeric_formatter_multiple_of_pow2"
+.LASF7:
+	.string	"short unsigned int"
+.LASF34:
+	.string	"strcpy"
+.LASF82:
+	.string	"numeric_formatter_multiple_of_pow5"
+.LASF87:
+	.string	"NumericFormatterDecimal"
+.LASF38:
+	.string	"count"
+.LASF53:
+	.string	"product"
+.LASF15:
+	.string	"__uint64_t"
+.LASF59:
+	.string	"decimal"
+.LASF36:
+	.string	"buffer"
+.LASF48:
+	.string	"power"
+.LASF24:
+	.string	"numeric_formatter_pow5_inv_split"
+.LASF2:
+	.string	"long unsigned int"
+.LASF61:
+	.string	"point"
+.LASF49:
+	.string	"separator"
+.LASF70:
+	.string	"special"
+.LASF86:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF68:
+	.string	"numeric_formatter_write_special"
+.LASF52:
+	.string	"uint128"
+.LASF84:
+	.string	"numeric_formatter_log10_pow2"
+.LASF83:
+	.string	"numeric_formatter_log10_pow5"
+.LASF12:
+	.string	"__int32_t"
+.LASF46:
+	.string	"ieee_mantissa"
+.LASF73:
+	.string	"accept_bounds"
+.LASF44:
+	.string	"precision"
+.LASF69:
+	.string	"negative"
+.LASF77:
+	.string	"removed"
+.LASF79:
+	.string	"output"
+.LASF28:
+	.string	"numeric_formatter_fixed_powers"
+.LASF3:
+	.string	"double"
+.LASF58:
+	.string	"dtos_precision_to"
+.LASF35:
+	.string	"u64tos_to"
+.LASF47:
+	.string	"ieee_exponent"
+.LASF72:
+	.string	"numeric_formatter_shortest"
+.LASF64:
+	.string	"numeric_formatter_fixed_scale"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/numeric_formatter.c"
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
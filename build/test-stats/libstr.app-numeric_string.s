@@ -0,0 +1,4402 @@
+	.file	"numeric_string.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/src/numeric_string.c"
+	.p2align 4
+	.globl	u64tos_to
+	.type	u64tos_to, @function
+u64tos_to:
+.LVL0:
+.LFB27:
+	.file 1 "/root/repo/src/numeric_string.c"
+	.loc 1 48 48 view -0
+	.cfi_startproc
+	.loc 1 49 3 view .LVU1
+.LBB6:
+.LBI6:
+	.loc 1 39 19 view .LVU2
+.LBB7:
+	.loc 1 40 3 view .LVU3
+	.loc 1 40 41 is_stmt 0 view .LVU4
+	movq	%rsi, %rax
+	orq	$1, %rax
+	.loc 1 40 7 view .LVU5
+	movl	$64, %r8d
+	.loc 1 40 19 view .LVU6
+	lzcntq	%rax, %rax
+.LVL1:
+	.loc 1 41 3 is_stmt 1 view .LVU7
+	.loc 1 40 7 is_stmt 0 view .LVU8
+	subl	%eax, %r8d
+.LVL2:
+	.loc 1 41 22 view .LVU9
+	imull	$1233, %r8d, %r8d
+.LVL3:
+	.loc 1 42 26 view .LVU10
+	leaq	numeric_string_powers_of_ten(%rip), %rax
+.LVL4:
+	.loc 1 42 26 view .LVU11
+.LBE7:
+.LBE6:
+	.loc 1 48 48 view .LVU12
+	movq	%rsi, %rcx
+.LBB9:
+.LBB8:
+	.loc 1 41 7 view .LVU13
+	sarl	$12, %r8d
+.LVL5:
+	.loc 1 42 3 is_stmt 1 view .LVU14
+	.loc 1 42 56 is_stmt 0 view .LVU15
+	movslq	%r8d, %rdx
+	.loc 1 42 26 view .LVU16
+	cmpq	(%rax,%rdx,8), %rsi
+	.loc 1 42 66 view .LVU17
+	sbbl	$-1, %r8d
+.LBE8:
+.LBE9:
+	.loc 1 49 10 view .LVU18
+	movslq	%r8d, %r8
+.LVL6:
+	.loc 1 50 3 is_stmt 1 view .LVU19
+	.loc 1 50 9 is_stmt 0 view .LVU20
+	leaq	(%rdi,%r8), %rsi
+.LVL7:
+	.loc 1 51 3 is_stmt 1 view .LVU21
+	.loc 1 51 6 is_stmt 0 view .LVU22
+	movb	$0, (%rsi)
+	.loc 1 53 3 is_stmt 1 view .LVU23
+	.loc 1 53 16 view .LVU24
+	cmpq	$99, %rcx
+	jbe	.L2
+	leaq	numeric_string_digit_pairs(%rip), %r10
+.LBB10:
+	.loc 1 54 60 is_stmt 0 view .LVU25
+	movabsq	$2951479051793528259, %r9
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 54 5 is_stmt 1 view .LVU26
+	.loc 1 54 60 is_stmt 0 view .LVU27
+	movq	%rcx, %rdx
+	shrq	$2, %rdx
+	movq	%rdx, %rax
+	mulq	%r9
+	movq	%rcx, %rax
+	.loc 1 57 10 view .LVU28
+	subq	$2, %rsi
+.LVL9:
+	.loc 1 54 60 view .LVU29
+	shrq	$2, %rdx
+	imulq	$100, %rdx, %rdi
+	subq	%rdi, %rax
+	.loc 1 54 17 view .LVU30
+	leaq	(%r10,%rax,2), %rax
+.LVL10:
+	.loc 1 55 5 is_stmt 1 view .LVU31
+	movq	%rcx, %rdi
+	.loc 1 55 11 is_stmt 0 view .LVU32
+	movq	%rdx, %rcx
+.LVL11:
+	.loc 1 56 5 is_stmt 1 view .LVU33
+	.loc 1 56 16 is_stmt 0 view .LVU34
+	movzbl	1(%rax), %edx
+.LVL12:
+	.loc 1 56 10 view .LVU35
+	movb	%dl, 1(%rsi)
+	.loc 1 57 5 is_stmt 1 view .LVU36
+.LVL13:
+	.loc 1 57 16 is_stmt 0 view .LVU37
+	movzbl	(%rax), %eax
+.LVL14:
+	.loc 1 57 10 view .LVU38
+	movb	%al, (%rsi)
+	.loc 1 57 10 view .LVU39
+.LBE10:
+	.loc 1 53 16 is_stmt 1 view .LVU40
+	cmpq	$9999, %rdi
+	ja	.L3
+.LVL15:
+.L2:
+	.loc 1 59 3 view .LVU41
+	.loc 1 59 6 is_stmt 0 view .LVU42
+	cmpq	$9, %rcx
+	jbe	.L4
+.LBB11:
+	.loc 1 60 5 is_stmt 1 view .LVU43
+	.loc 1 60 17 is_stmt 0 view .LVU44
+	leaq	numeric_string_digit_pairs(%rip), %rax
+	leaq	(%rax,%rcx,2), %rax
+.LVL16:
+	.loc 1 61 5 is_stmt 1 view .LVU45
+	.loc 1 61 16 is_stmt 0 view .LVU46
+	movzbl	1(%rax), %edx
+	.loc 1 61 10 view .LVU47
+	movb	%dl, -1(%rsi)
+	.loc 1 62 5 is_stmt 1 view .LVU48
+.LVL17:
+	.loc 1 62 16 is_stmt 0 view .LVU49
+	movzbl	(%rax), %eax
+.LVL18:
+	.loc 1 62 10 view .LVU50
+	movb	%al, -2(%rsi)
+.LBE11:
+	.loc 1 68 1 view .LVU51
+	movq	%r8, %rax
+	ret
+.LVL19:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 1 65 5 is_stmt 1 view .LVU52
+	.loc 1 65 23 is_stmt 0 view .LVU53
+	addl	$48, %ecx
+	movb	%cl, -1(%rsi)
+	.loc 1 67 3 is_stmt 1 view .LVU54
+	.loc 1 68 1 is_stmt 0 view .LVU55
+	movq	%r8, %rax
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	u64tos_to, .-u64tos_to
+	.p2align 4
+	.globl	i64tos_to
+	.type	i64tos_to, @function
+i64tos_to:
+.LVL20:
+.LFB28:
+	.loc 1 73 47 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 74 3 view .LVU57
+	.loc 1 74 6 is_stmt 0 view .LVU58
+	testq	%rsi, %rsi
+	js	.L12
+	.loc 1 79 3 is_stmt 1 view .LVU59
+	.loc 1 79 10 is_stmt 0 view .LVU60
+	jmp	u64tos_to@PLT
+.LVL21:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+.LBB14:
+.LBI14:
+	.loc 1 73 8 is_stmt 1 view .LVU61
+.LBB15:
+	.loc 1 75 5 view .LVU62
+.LBE15:
+.LBE14:
+	.loc 1 73 47 is_stmt 0 view .LVU63
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB17:
+.LBB16:
+	.loc 1 75 15 view .LVU64
+	movb	$45, (%rdi)
+	.loc 1 77 5 is_stmt 1 view .LVU65
+	.loc 1 77 12 is_stmt 0 view .LVU66
+	negq	%rsi
+.LVL22:
+	.loc 1 77 12 view .LVU67
+	incq	%rdi
+.LVL23:
+	.loc 1 77 12 view .LVU68
+	call	u64tos_to@PLT
+.LVL24:
+	.loc 1 77 55 view .LVU69
+	incq	%rax
+.LVL25:
+	.loc 1 77 55 view .LVU70
+.LBE16:
+.LBE17:
+	.loc 1 80 1 view .LVU71
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	i64tos_to, .-i64tos_to
+	.p2align 4
+	.globl	i64tos_batch
+	.type	i64tos_batch, @function
+i64tos_batch:
+.LVL26:
+.LFB29:
+	.loc 1 85 95 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 86 3 view .LVU73
+	.loc 1 87 3 view .LVU74
+	.loc 1 85 95 is_stmt 0 view .LVU75
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rcx, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 87 13 view .LVU76
+	movb	$0, (%rdi)
+	.loc 1 88 3 is_stmt 1 view .LVU77
+.LBB18:
+	.loc 1 88 8 view .LVU78
+.LVL27:
+	.loc 1 88 24 view .LVU79
+	testq	%rdx, %rdx
+	je	.L16
+	movq	%rdi, %r13
+	movq	%rsi, %r14
+	.loc 1 88 15 is_stmt 0 view .LVU80
+	xorl	%ebp, %ebp
+.LBE18:
+	.loc 1 86 10 view .LVU81
+	xorl	%ebx, %ebx
+	testq	%rcx, %rcx
+	je	.L18
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+.LBB19:
+	.loc 1 89 5 is_stmt 1 view .LVU82
+	.loc 1 90 7 view .LVU83
+	.loc 1 90 18 is_stmt 0 view .LVU84
+	movq	%rbx, (%r15,%rbp,8)
+	.loc 1 93 5 is_stmt 1 view .LVU85
+	.loc 1 93 15 is_stmt 0 view .LVU86
+	leaq	0(%r13,%rbx), %rdi
+	movq	(%r14,%rbp,8), %rsi
+	.loc 1 88 34 view .LVU87
+	incq	%rbp
+.LVL29:
+	.loc 1 93 15 view .LVU88
+	call	i64tos_to@PLT
+.LVL30:
+	.loc 1 93 12 view .LVU89
+	addq	%rax, %rbx
+.LVL31:
+	.loc 1 88 34 is_stmt 1 view .LVU90
+	.loc 1 88 24 view .LVU91
+	cmpq	%rbp, %r12
+	jne	.L17
+.LVL32:
+.L20:
+	.loc 1 88 24 is_stmt 0 view .LVU92
+.LBE19:
+	.loc 1 96 5 is_stmt 1 view .LVU93
+	.loc 1 96 20 is_stmt 0 view .LVU94
+	movq	%rbx, (%r15,%r12,8)
+.L15:
+	.loc 1 99 1 view .LVU95
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL33:
+	.loc 1 99 1 view .LVU96
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL34:
+	.loc 1 99 1 view .LVU97
+	ret
+.LVL35:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.cfi_restore_state
+.LBB20:
+	.loc 1 89 5 is_stmt 1 view .LVU98
+	.loc 1 93 5 view .LVU99
+	.loc 1 93 15 is_stmt 0 view .LVU100
+	movq	(%r14,%rbp,8), %rsi
+	leaq	0(%r13,%rbx), %rdi
+	call	i64tos_to@PLT
+.LVL36:
+	.loc 1 88 34 view .LVU101
+	incq	%rbp
+.LVL37:
+	.loc 1 93 12 view .LVU102
+	addq	%rax, %rbx
+.LVL38:
+	.loc 1 88 34 is_stmt 1 view .LVU103
+	.loc 1 88 24 view .LVU104
+	cmpq	%rbp, %r12
+	jne	.L18
+	jmp	.L15
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 88 24 is_stmt 0 view .LVU105
+.LBE20:
+	.loc 1 95 3 is_stmt 1 view .LVU106
+	.loc 1 86 10 is_stmt 0 view .LVU107
+	xorl	%ebx, %ebx
+	.loc 1 95 6 view .LVU108
+	testq	%rcx, %rcx
+	jne	.L20
+	jmp	.L15
+	.cfi_endproc
+.LFE29:
+	.size	i64tos_batch, .-i64tos_batch
+	.p2align 4
+	.globl	itos_to
+	.type	itos_to, @function
+itos_to:
+.LVL40:
+.LFB30:
+	.loc 1 104 41 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 105 3 view .LVU110
+	.loc 1 105 10 is_stmt 0 view .LVU111
+	movslq	%esi, %rsi
+	.loc 1 105 10 view .LVU112
+	jmp	i64tos_to@PLT
+.LVL41:
+	.loc 1 105 10 view .LVU113
+	.cfi_endproc
+.LFE30:
+	.size	itos_to, .-itos_to
+	.p2align 4
+	.globl	itos
+	.type	itos, @function
+itos:
+.LVL42:
+.LFB31:
+	.loc 1 111 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 113 3 view .LVU115
+	.loc 1 114 3 view .LVU116
+	.loc 1 111 23 is_stmt 0 view .LVU117
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	%edi, %ebx
+	.loc 1 114 20 view .LVU118
+	xorl	%edi, %edi
+.LVL43:
+	.loc 1 111 23 view .LVU119
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 115 19 view .LVU120
+	movq	%rsp, %r12
+	.loc 1 114 20 view .LVU121
+	call	st_stats_clock@PLT
+.LVL44:
+	.loc 1 115 19 view .LVU122
+	movl	%ebx, %esi
+	movq	%r12, %rdi
+	.loc 1 114 20 view .LVU123
+	movq	%rax, %rbp
+.LVL45:
+	.loc 1 115 3 is_stmt 1 view .LVU124
+	.loc 1 115 19 is_stmt 0 view .LVU125
+	call	itos_to@PLT
+.LVL46:
+	.loc 1 115 19 view .LVU126
+	movq	%rax, %rbx
+.LVL47:
+	.loc 1 116 3 is_stmt 1 view .LVU127
+	.loc 1 116 8 view .LVU128
+	.loc 1 116 11 is_stmt 0 view .LVU129
+	testq	%rbp, %rbp
+	jne	.L38
+.LVL48:
+.L29:
+	.loc 1 116 17 is_stmt 1 discriminator 3 view .LVU130
+	.loc 1 116 22 discriminator 3 view .LVU131
+	.loc 1 116 20 discriminator 3 view .LVU132
+	.loc 1 116 44 discriminator 3 view .LVU133
+	.loc 1 116 6 discriminator 3 view .LVU134
+	.loc 1 117 3 discriminator 3 view .LVU135
+	.loc 1 117 23 is_stmt 0 discriminator 3 view .LVU136
+	incq	%rbx
+.LVL49:
+	.loc 1 117 23 discriminator 3 view .LVU137
+	movq	%rbx, %rdi
+	call	malloc@PLT
+.LVL50:
+	movq	%rax, %rbp
+.LVL51:
+	.loc 1 118 3 is_stmt 1 discriminator 3 view .LVU138
+	.loc 1 118 8 discriminator 3 view .LVU139
+	xorl	%edi, %edi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL52:
+	.loc 1 118 10 discriminator 3 view .LVU140
+	.loc 1 118 15 discriminator 3 view .LVU141
+	.loc 1 118 13 discriminator 3 view .LVU142
+	.loc 1 118 6 discriminator 3 view .LVU143
+	.loc 1 119 3 discriminator 3 view .LVU144
+	.loc 1 119 6 is_stmt 0 discriminator 3 view .LVU145
+	testq	%rbp, %rbp
+	je	.L28
+	.loc 1 122 3 is_stmt 1 view .LVU146
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+.LVL53:
+	.loc 1 123 3 view .LVU147
+.L28:
+	.loc 1 124 1 is_stmt 0 view .LVU148
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL54:
+	.loc 1 124 1 view .LVU149
+	movq	%rbp, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL55:
+	.loc 1 124 1 view .LVU150
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL56:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.cfi_restore_state
+	.loc 1 116 28 is_stmt 1 discriminator 1 view .LVU151
+	.loc 1 116 33 discriminator 1 view .LVU152
+	movl	$1, %edx
+	movl	$48, %esi
+	xorl	%edi, %edi
+	call	st_stats_add@PLT
+.LVL57:
+	.loc 1 116 10 discriminator 1 view .LVU153
+	.loc 1 116 15 discriminator 1 view .LVU154
+	.loc 1 116 13 discriminator 1 view .LVU155
+	.loc 1 116 31 discriminator 1 view .LVU156
+	.loc 1 116 41 discriminator 1 view .LVU157
+	.loc 1 116 46 discriminator 1 view .LVU158
+	.loc 1 116 5 is_stmt 0 discriminator 1 view .LVU159
+	xorl	%edi, %edi
+	call	st_stats_clock@PLT
+.LVL58:
+	.loc 1 116 46 discriminator 1 view .LVU160
+	subq	%rbp, %rax
+	movq	%rax, %rdx
+	movl	$56, %esi
+	xorl	%edi, %edi
+	call	st_stats_add@PLT
+.LVL59:
+	jmp	.L29
+	.cfi_endproc
+.LFE31:
+	.size	itos, .-itos
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"%.*Lf"
+	.text
+	.p2align 4
+	.globl	ldtos
+	.type	ldtos, @function
+ldtos:
+.LVL60:
+.LFB32:
+	.loc 1 129 32 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 131 3 view .LVU162
+	.loc 1 132 3 view .LVU163
+	.loc 1 133 3 view .LVU164
+	.loc 1 129 32 is_stmt 0 view .LVU165
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 133 20 view .LVU166
+	xorl	%edi, %edi
+	.loc 1 129 32 view .LVU167
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$352, %rsp
+	.cfi_def_cfa_offset 384
+	.loc 1 133 20 view .LVU168
+	call	st_stats_clock@PLT
+.LVL61:
+	.loc 1 134 20 view .LVU169
+	fldt	384(%rsp)
+	.loc 1 133 20 view .LVU170
+	movq	%rax, %rbp
+.LVL62:
+	.loc 1 134 3 is_stmt 1 view .LVU171
+	.loc 1 136 14 is_stmt 0 view .LVU172
+	leaq	16(%rsp), %r12
+	.loc 1 134 20 view .LVU173
+	fstl	8(%rsp)
+	.loc 1 134 7 view .LVU174
+	fldl	8(%rsp)
+	.loc 1 134 6 view .LVU175
+	fucomip	%st(1), %st
+	fstp	%st(0)
+	jp	.L40
+	jne	.L40
+	.loc 1 136 5 is_stmt 1 view .LVU176
+	.loc 1 136 14 is_stmt 0 view .LVU177
+	vmovsd	8(%rsp), %xmm0
+	movl	$13, %esi
+	movq	%r12, %rdi
+	call	dtos_fixed_to@PLT
+.LVL63:
+	.loc 1 136 14 view .LVU178
+	movq	%rax, %rbx
+.LVL64:
+	.loc 1 142 3 is_stmt 1 view .LVU179
+	.loc 1 142 8 view .LVU180
+	.loc 1 142 11 is_stmt 0 view .LVU181
+	testq	%rbp, %rbp
+	jne	.L53
+.LVL65:
+.L43:
+	.loc 1 142 17 is_stmt 1 discriminator 3 view .LVU182
+	.loc 1 142 22 discriminator 3 view .LVU183
+	.loc 1 142 20 discriminator 3 view .LVU184
+	.loc 1 142 44 discriminator 3 view .LVU185
+	.loc 1 142 6 discriminator 3 view .LVU186
+	.loc 1 143 3 discriminator 3 view .LVU187
+	.loc 1 143 23 is_stmt 0 discriminator 3 view .LVU188
+	incq	%rbx
+.LVL66:
+	.loc 1 143 23 discriminator 3 view .LVU189
+	movq	%rbx, %rdi
+	call	malloc@PLT
+.LVL67:
+	movq	%rax, %rbp
+.LVL68:
+	.loc 1 144 3 is_stmt 1 discriminator 3 view .LVU190
+	.loc 1 144 8 discriminator 3 view .LVU191
+	xorl	%edi, %edi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL69:
+	.loc 1 144 10 discriminator 3 view .LVU192
+	.loc 1 144 15 discriminator 3 view .LVU193
+	.loc 1 144 13 discriminator 3 view .LVU194
+	.loc 1 144 6 discriminator 3 view .LVU195
+	.loc 1 145 3 discriminator 3 view .LVU196
+	.loc 1 145 6 is_stmt 0 discriminator 3 view .LVU197
+	testq	%rbp, %rbp
+	je	.L39
+	.loc 1 148 3 is_stmt 1 view .LVU198
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	memcpy@PLT
+.LVL70:
+	.loc 1 149 3 view .LVU199
+.L39:
+	.loc 1 150 1 is_stmt 0 view .LVU200
+	addq	$352, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL71:
+	.loc 1 150 1 view .LVU201
+	movq	%rbp, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL72:
+	.loc 1 150 1 view .LVU202
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL73:
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	.cfi_restore_state
+	.loc 1 139 5 is_stmt 1 view .LVU203
+	pushq	392(%rsp)
+	.cfi_def_cfa_offset 392
+	leaq	.LC0(%rip), %rdx
+	movl	$13, %ecx
+	pushq	392(%rsp)
+	.cfi_def_cfa_offset 400
+	movl	$100, %esi
+	movq	%r12, %rdi
+	xorl	%eax, %eax
+.LVL74:
+	.loc 1 139 5 is_stmt 0 view .LVU204
+	call	snprintf@PLT
+.LVL75:
+	.loc 1 140 5 is_stmt 1 view .LVU205
+	.loc 1 140 14 is_stmt 0 view .LVU206
+	movq	%r12, %rdi
+	call	strlen@PLT
+.LVL76:
+	movq	%rax, %rbx
+.LVL77:
+	.loc 1 140 14 view .LVU207
+	popq	%rax
+	.cfi_def_cfa_offset 392
+.LVL78:
+	.loc 1 140 14 view .LVU208
+	popq	%rdx
+	.cfi_def_cfa_offset 384
+	.loc 1 142 3 is_stmt 1 view .LVU209
+	.loc 1 142 8 view .LVU210
+	.loc 1 142 11 is_stmt 0 view .LVU211
+	testq	%rbp, %rbp
+	je	.L43
+.L53:
+	.loc 1 142 28 is_stmt 1 discriminator 1 view .LVU212
+	.loc 1 142 33 discriminator 1 view .LVU213
+	movl	$1, %edx
+	movl	$48, %esi
+	xorl	%edi, %edi
+	call	st_stats_add@PLT
+.LVL79:
+	.loc 1 142 10 discriminator 1 view .LVU214
+	.loc 1 142 15 discriminator 1 view .LVU215
+	.loc 1 142 13 discriminator 1 view .LVU216
+	.loc 1 142 31 discriminator 1 view .LVU217
+	.loc 1 142 41 discriminator 1 view .LVU218
+	.loc 1 142 46 discriminator 1 view .LVU219
+	.loc 1 142 5 is_stmt 0 discriminator 1 view .LVU220
+	xorl	%edi, %edi
+	call	st_stats_clock@PLT
+.LVL80:
+	.loc 1 142 46 discriminator 1 view .LVU221
+	subq	%rbp, %rax
+	movq	%rax, %rdx
+	movl	$56, %esi
+	xorl	%edi, %edi
+	call	st_stats_add@PLT
+.LVL81:
+	jmp	.L43
+	.cfi_endproc
+.LFE32:
+	.size	ldtos, .-ldtos
+	.p2align 4
+	.globl	stold
+	.type	stold, @function
+stold:
+.LVL82:
+.LFB33:
+	.loc 1 155 47 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 156 3 view .LVU223
+	.loc 1 157 2 view .LVU224
+	.loc 1 155 47 is_stmt 0 view .LVU225
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 157 4 view .LVU226
+	call	__errno_location@PLT
+.LVL83:
+	.loc 1 157 8 view .LVU227
+	movl	$0, (%rax)
+	.loc 1 158 3 is_stmt 1 view .LVU228
+	.loc 1 158 20 is_stmt 0 view .LVU229
+	xorl	%edi, %edi
+	.loc 1 157 4 view .LVU230
+	movq	%rax, %rbx
+	.loc 1 158 20 view .LVU231
+	call	st_stats_clock@PLT
+.LVL84:
+	movq	%rax, %rbp
+.LVL85:
+	.loc 1 159 3 is_stmt 1 view .LVU232
+	.loc 1 159 23 is_stmt 0 view .LVU233
+	leaq	24(%rsp), %rsi
+	movq	%r12, %rdi
+	call	strtold@PLT
+.LVL86:
+	.loc 1 160 3 is_stmt 1 view .LVU234
+	.loc 1 160 8 view .LVU235
+	.loc 1 160 11 is_stmt 0 view .LVU236
+	testq	%rbp, %rbp
+	jne	.L62
+.LVL87:
+.L55:
+	.loc 1 160 17 is_stmt 1 discriminator 3 view .LVU237
+	.loc 1 160 22 discriminator 3 view .LVU238
+	.loc 1 160 20 discriminator 3 view .LVU239
+	.loc 1 160 44 discriminator 3 view .LVU240
+	.loc 1 160 6 discriminator 3 view .LVU241
+	.loc 1 162 3 discriminator 3 view .LVU242
+	.loc 1 162 6 is_stmt 0 discriminator 3 view .LVU243
+	movl	(%rbx), %eax
+	testl	%eax, %eax
+	jne	.L64
+	.loc 1 165 3 is_stmt 1 view .LVU244
+	.loc 1 165 7 is_stmt 0 view .LVU245
+	movq	24(%rsp), %rax
+	.loc 1 165 6 view .LVU246
+	cmpb	$0, (%rax)
+	jne	.L63
+	.loc 1 170 1 view .LVU247
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL88:
+	.loc 1 170 1 view .LVU248
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL89:
+	.loc 1 170 1 view .LVU249
+	ret
+.LVL90:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	.cfi_restore_state
+	.loc 1 170 1 view .LVU250
+	fstp	%st(0)
+	.loc 1 166 4 is_stmt 1 view .LVU251
+	.loc 1 166 10 is_stmt 0 view .LVU252
+	movl	$22, (%rbx)
+	.loc 1 167 5 is_stmt 1 view .LVU253
+	.loc 1 167 12 is_stmt 0 view .LVU254
+	jmp	.L56
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	fstp	%st(0)
+.L56:
+	.loc 1 170 1 view .LVU255
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	.loc 1 163 12 view .LVU256
+	fldz
+	.loc 1 170 1 view .LVU257
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL91:
+	.loc 1 170 1 view .LVU258
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL92:
+	.loc 1 170 1 view .LVU259
+	ret
+.LVL93:
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	.cfi_restore_state
+	.loc 1 160 33 discriminator 1 view .LVU260
+	movl	$1, %edx
+	movl	$48, %esi
+	xorl	%edi, %edi
+	fstpt	(%rsp)
+	.loc 1 160 28 is_stmt 1 discriminator 1 view .LVU261
+	.loc 1 160 33 discriminator 1 view .LVU262
+	call	st_stats_add@PLT
+.LVL94:
+	.loc 1 160 10 discriminator 1 view .LVU263
+	.loc 1 160 15 discriminator 1 view .LVU264
+	.loc 1 160 13 discriminator 1 view .LVU265
+	.loc 1 160 31 discriminator 1 view .LVU266
+	.loc 1 160 41 discriminator 1 view .LVU267
+	.loc 1 160 46 discriminator 1 view .LVU268
+	.loc 1 160 5 is_stmt 0 discriminator 1 view .LVU269
+	xorl	%edi, %edi
+	call	st_stats_clock@PLT
+.LVL95:
+	.loc 1 160 46 discriminator 1 view .LVU270
+	subq	%rbp, %rax
+	movq	%rax, %rdx
+	movl	$56, %esi
+	xorl	%edi, %edi
+	call	st_stats_add@PLT
+.LVL96:
+	fldt	(%rsp)
+	jmp	.L55
+	.cfi_endproc
+.LFE33:
+	.size	stold, .-stold
+	.section	.rodata
+	.align 32
+	.type	numeric_string_powers_of_ten, @object
+	.size	numeric_string_powers_of_ten, 160
+numeric_string_powers_of_ten:
+	.quad	0
+	.quad	10
+	.quad	100
+	.quad	1000
+	.quad	10000
+	.quad	100000
+	.quad	1000000
+	.quad	10000000
+	.quad	100000000
+	.quad	1000000000
+	.quad	10000000000
+	.quad	100000000000
+	.quad	1000000000000
+	.quad	10000000000000
+	.quad	100000000000000
+	.quad	1000000000000000
+	.quad	10000000000000000
+	.quad	100000000000000000
+	.quad	1000000000000000000
+	.quad	-8446744073709551616
+	.align 32
+	.type	numeric_string_digit_pairs, @object
+	.size	numeric_string_digit_pairs, 201
+numeric_string_digit_pairs:
+	.string	"00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899"
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/stdio.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "/root/repo/src/../include/strutils.h"
+	.file 8 "/usr/include/stdlib.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "/usr/include/errno.h"
+	.file 11 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xc83
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF93
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0xa
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x9
+	.long	0x35
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x85
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0xa
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0xa
+	.long	.LASF13
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0x9
+	.long	0xa9
+	.uleb128 0xa
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x13
+	.long	0x98
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF16
+	.uleb128 0xa
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x13
+	.long	0x79
+	.uleb128 0x9
+	.long	0xc8
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0x5
+	.long	0xe5
+	.uleb128 0x23
+	.uleb128 0x5
+	.long	0xb0
+	.uleb128 0x16
+	.long	0xe6
+	.uleb128 0xa
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8c
+	.uleb128 0x9
+	.long	0xf0
+	.uleb128 0x12
+	.long	.LASF24
+	.byte	0x18
+	.value	0x175
+	.long	0x135
+	.uleb128 0x2
+	.long	.LASF20
+	.value	0x17a
+	.byte	0x1c
+	.long	0x13a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF21
+	.value	0x17f
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF22
+	.value	0x184
+	.byte	0xa
+	.long	0x35
+	.byte	0x10
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF94
+	.uleb128 0x5
+	.long	0x135
+	.uleb128 0x6
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF23
+	.uleb128 0x12
+	.long	.LASF25
+	.byte	0x40
+	.value	0x1e6
+	.long	0x1bb
+	.uleb128 0x2
+	.long	.LASF26
+	.value	0x1eb
+	.byte	0xc
+	.long	0xf0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF27
+	.value	0x1f0
+	.byte	0xc
+	.long	0xf0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF28
+	.value	0x1f5
+	.byte	0xc
+	.long	0xf0
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF29
+	.value	0x1fa
+	.byte	0xc
+	.long	0xf0
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF30
+	.value	0x1ff
+	.byte	0xc
+	.long	0xf0
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF31
+	.value	0x204
+	.byte	0xc
+	.long	0xf0
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF32
+	.value	0x209
+	.byte	0xc
+	.long	0xf0
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF33
+	.value	0x20e
+	.byte	0xc
+	.long	0xf0
+	.byte	0x38
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF34
+	.byte	0x38
+	.value	0x26c
+	.long	0x22d
+	.uleb128 0x2
+	.long	.LASF35
+	.value	0x272
+	.byte	0xd
+	.long	0x246
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF36
+	.value	0x277
+	.byte	0x9
+	.long	0x54
+	.byte	0x8
+	.uleb128 0x17
+	.string	"fd"
+	.value	0x27c
+	.long	0x72
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF37
+	.value	0x281
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF38
+	.value	0x286
+	.byte	0xa
+	.long	0x35
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF39
+	.value	0x28b
+	.byte	0xa
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x17
+	.string	"eof"
+	.value	0x290
+	.long	0x72
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF40
+	.value	0x295
+	.byte	0x7
+	.long	0x72
+	.byte	0x34
+	.byte	0
+	.uleb128 0x25
+	.long	0xb5
+	.long	0x246
+	.uleb128 0x4
+	.long	0x54
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x5
+	.long	0x22d
+	.uleb128 0x18
+	.long	.LASF43
+	.long	0x4d
+	.value	0x29b
+	.long	0x267
+	.uleb128 0xb
+	.long	.LASF41
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF42
+	.byte	0x1
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF44
+	.long	0x4d
+	.value	0x2b5
+	.long	0x28f
+	.uleb128 0xb
+	.long	.LASF45
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF46
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF47
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF48
+	.byte	0x3
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF49
+	.value	0x158
+	.byte	0x7
+	.value	0x2cf
+	.byte	0x8
+	.long	0x33d
+	.uleb128 0x2
+	.long	.LASF50
+	.value	0x2d4
+	.byte	0x9
+	.long	0xa4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF51
+	.value	0x2d9
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF52
+	.value	0x2de
+	.byte	0xa
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF53
+	.value	0x2e3
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF54
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x24b
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF55
+	.value	0x2ed
+	.byte	0xa
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF56
+	.value	0x2f2
+	.byte	0x18
+	.long	0x342
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF57
+	.value	0x2f7
+	.byte	0x18
+	.long	0x267
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF58
+	.value	0x2fc
+	.byte	0x17
+	.long	0x347
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF59
+	.value	0x301
+	.byte	0x8
+	.long	0x34c
+	.byte	0x48
+	.uleb128 0x19
+	.long	.LASF60
+	.value	0x306
+	.byte	0x21
+	.long	0x3aa
+	.value	0x148
+	.uleb128 0x19
+	.long	.LASF61
+	.value	0x30b
+	.byte	0x17
+	.long	0x3af
+	.value	0x150
+	.byte	0
+	.uleb128 0x9
+	.long	0x28f
+	.uleb128 0x5
+	.long	0x1bb
+	.uleb128 0x5
+	.long	0x101
+	.uleb128 0xd
+	.long	0xa9
+	.long	0x35c
+	.uleb128 0x13
+	.long	0x46
+	.byte	0xff
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF62
+	.byte	0x28
+	.value	0x764
+	.long	0x3aa
+	.uleb128 0x2
+	.long	.LASF63
+	.value	0x769
+	.byte	0xb
+	.long	0x3b9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF64
+	.value	0x76e
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF65
+	.value	0x774
+	.byte	0xd
+	.long	0x3be
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF51
+	.value	0x779
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF66
+	.value	0x77e
+	.byte	0xa
+	.long	0x35
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x35c
+	.uleb128 0x5
+	.long	0x146
+	.uleb128 0x9
+	.long	0x2e
+	.uleb128 0x5
+	.long	0x35
+	.uleb128 0x5
+	.long	0xf0
+	.uleb128 0xd
+	.long	0xb0
+	.long	0x3d3
+	.uleb128 0x13
+	.long	0x46
+	.byte	0xc8
+	.byte	0
+	.uleb128 0x9
+	.long	0x3c3
+	.uleb128 0xe
+	.long	.LASF67
+	.byte	0xd
+	.byte	0x13
+	.long	0x3d3
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numeric_string_digit_pairs
+	.uleb128 0xd
+	.long	0xfc
+	.long	0x3fd
+	.uleb128 0x13
+	.long	0x46
+	.byte	0x13
+	.byte	0
+	.uleb128 0x9
+	.long	0x3ed
+	.uleb128 0xe
+	.long	.LASF68
+	.byte	0x14
+	.byte	0x17
+	.long	0x3fd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numeric_string_powers_of_ten
+	.uleb128 0x1a
+	.long	.LASF69
+	.byte	0x8
+	.byte	0x7f
+	.byte	0x14
+	.long	0x13f
+	.long	0x432
+	.uleb128 0x4
+	.long	0xeb
+	.uleb128 0x4
+	.long	0x437
+	.byte	0
+	.uleb128 0x5
+	.long	0xa4
+	.uleb128 0x16
+	.long	0x432
+	.uleb128 0x27
+	.long	.LASF95
+	.byte	0xa
+	.byte	0x25
+	.byte	0xd
+	.long	0x448
+	.uleb128 0x5
+	.long	0x72
+	.uleb128 0xf
+	.long	.LASF70
+	.byte	0x9
+	.value	0x197
+	.byte	0xf
+	.long	0x35
+	.long	0x464
+	.uleb128 0x4
+	.long	0xe6
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF71
+	.byte	0x4
+	.value	0x17a
+	.byte	0xc
+	.long	0x72
+	.long	0x486
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x4
+	.long	0x35
+	.uleb128 0x4
+	.long	0xe6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x7
+	.value	0x673
+	.byte	0x8
+	.long	0x35
+	.long	0x4a7
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x4
+	.long	0x3b4
+	.uleb128 0x4
+	.long	0x72
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF73
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.long	0x54
+	.long	0x4c7
+	.uleb128 0x4
+	.long	0x54
+	.uleb128 0x4
+	.long	0xe0
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF74
+	.byte	0x8
+	.value	0x229
+	.byte	0xe
+	.long	0x54
+	.long	0x4de
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF96
+	.byte	0x7
+	.value	0x24d
+	.byte	0x6
+	.long	0x4fb
+	.uleb128 0x4
+	.long	0x4fb
+	.uleb128 0x4
+	.long	0x41
+	.uleb128 0x4
+	.long	0xfc
+	.byte	0
+	.uleb128 0x5
+	.long	0x33d
+	.uleb128 0xf
+	.long	.LASF75
+	.byte	0x7
+	.value	0x25a
+	.byte	0xa
+	.long	0xf0
+	.long	0x517
+	.uleb128 0x4
+	.long	0x4fb
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF79
+	.byte	0x9b
+	.byte	0xd
+	.long	0x13f
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x614
+	.uleb128 0x7
+	.long	.LASF83
+	.byte	0x9b
+	.byte	0x1f
+	.long	0xe6
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0xe
+	.long	.LASF76
+	.byte	0x9c
+	.byte	0x9
+	.long	0xa4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.long	.LASF77
+	.byte	0x9e
+	.byte	0xc
+	.long	0xf0
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x8
+	.long	.LASF78
+	.byte	0x9f
+	.byte	0xf
+	.long	0x13f
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x2a
+	.quad	.LVL83
+	.long	0x43c
+	.uleb128 0x3
+	.quad	.LVL84
+	.long	0x500
+	.long	0x5a3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL86
+	.long	0x417
+	.long	0x5c1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL94
+	.long	0x4de
+	.long	0x5e3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL95
+	.long	0x500
+	.long	0x5fa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL96
+	.long	0x4de
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF80
+	.byte	0x81
+	.byte	0x7
+	.long	0xa4
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7c2
+	.uleb128 0x2b
+	.long	.LASF78
+	.byte	0x1
+	.byte	0x81
+	.byte	0x19
+	.long	0x13f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0xe
+	.long	.LASF81
+	.byte	0x83
+	.byte	0x8
+	.long	0x7c2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x8
+	.long	.LASF51
+	.byte	0x84
+	.byte	0xa
+	.long	0x35
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x8
+	.long	.LASF77
+	.byte	0x85
+	.byte	0xc
+	.long	0xf0
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x14
+	.string	"str"
+	.byte	0x8f
+	.byte	0x9
+	.long	0xa4
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x3
+	.quad	.LVL61
+	.long	0x500
+	.long	0x6a3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL63
+	.long	0x486
+	.long	0x6ca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -376
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3d
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL67
+	.long	0x4c7
+	.long	0x6e2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL69
+	.long	0x4de
+	.long	0x703
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL70
+	.long	0xc7b
+	.long	0x727
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL75
+	.long	0x464
+	.long	0x757
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x3d
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL76
+	.long	0x44d
+	.long	0x76f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL79
+	.long	0x4de
+	.long	0x791
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL80
+	.long	0x500
+	.long	0x7a8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL81
+	.long	0x4de
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xa9
+	.long	0x7d3
+	.uleb128 0x2c
+	.long	0x46
+	.value	0x14b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF82
+	.byte	0x6f
+	.byte	0x7
+	.long	0xa4
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x933
+	.uleb128 0x7
+	.long	.LASF78
+	.byte	0x6f
+	.byte	0x10
+	.long	0x72
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xe
+	.long	.LASF81
+	.byte	0x71
+	.byte	0x8
+	.long	0x933
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x8
+	.long	.LASF77
+	.byte	0x72
+	.byte	0xc
+	.long	0xf0
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x8
+	.long	.LASF51
+	.byte	0x73
+	.byte	0xa
+	.long	0x35
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x14
+	.string	"str"
+	.byte	0x75
+	.byte	0x9
+	.long	0xa4
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x3
+	.quad	.LVL44
+	.long	0x500
+	.long	0x865
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL46
+	.long	0x943
+	.long	0x883
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL50
+	.long	0x4c7
+	.long	0x89b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL52
+	.long	0x4de
+	.long	0x8bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL53
+	.long	0xc7b
+	.long	0x8e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL57
+	.long	0x4de
+	.long	0x902
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL58
+	.long	0x500
+	.long	0x919
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL59
+	.long	0x4de
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xa9
+	.long	0x943
+	.uleb128 0x13
+	.long	0x46
+	.byte	0x14
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF84
+	.byte	0x68
+	.byte	0x8
+	.long	0x35
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9ad
+	.uleb128 0x7
+	.long	.LASF81
+	.byte	0x68
+	.byte	0x16
+	.long	0xa4
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x7
+	.long	.LASF78
+	.byte	0x68
+	.byte	0x22
+	.long	0x72
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x1b
+	.quad	.LVL41
+	.long	0xa7c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF85
+	.byte	0x55
+	.byte	0x8
+	.long	0x35
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa77
+	.uleb128 0x7
+	.long	.LASF81
+	.byte	0x55
+	.byte	0x1b
+	.long	0xa4
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x7
+	.long	.LASF86
+	.byte	0x55
+	.byte	0x32
+	.long	0xa77
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x7
+	.long	.LASF64
+	.byte	0x55
+	.byte	0x47
+	.long	0x41
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x7
+	.long	.LASF87
+	.byte	0x55
+	.byte	0x56
+	.long	0x3b9
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x8
+	.long	.LASF51
+	.byte	0x56
+	.byte	0xa
+	.long	0x35
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x1c
+	.long	.LLRL20
+	.uleb128 0x14
+	.string	"i"
+	.byte	0x58
+	.byte	0xf
+	.long	0x35
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x3
+	.quad	.LVL30
+	.long	0xa7c
+	.long	0xa5e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL36
+	.long	0xa7c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xd4
+	.uleb128 0x2d
+	.long	.LASF88
+	.byte	0x1
+	.byte	0x49
+	.byte	0x8
+	.long	0x35
+	.byte	0x1
+	.long	0xaa4
+	.uleb128 0x15
+	.long	.LASF81
+	.byte	0x49
+	.byte	0x18
+	.long	0xa4
+	.uleb128 0x15
+	.long	.LASF78
+	.byte	0x49
+	.byte	0x28
+	.long	0xc8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF89
+	.byte	0x30
+	.byte	0x8
+	.long	0x35
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xba5
+	.uleb128 0x7
+	.long	.LASF81
+	.byte	0x30
+	.byte	0x18
+	.long	0xa4
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x7
+	.long	.LASF78
+	.byte	0x30
+	.byte	0x29
+	.long	0xf0
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x8
+	.long	.LASF51
+	.byte	0x31
+	.byte	0xa
+	.long	0x35
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x14
+	.string	"p"
+	.byte	0x32
+	.byte	0x9
+	.long	0xa4
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1d
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.long	0xb38
+	.uleb128 0x8
+	.long	.LASF90
+	.byte	0x36
+	.byte	0x11
+	.long	0xe6
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.long	0xb61
+	.uleb128 0x8
+	.long	.LASF90
+	.byte	0x3c
+	.byte	0x11
+	.long	0xe6
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0x2e
+	.long	0xba5
+	.quad	.LBI6
+	.byte	.LVU2
+	.long	.LLRL4
+	.byte	0x1
+	.byte	0x31
+	.byte	0x13
+	.uleb128 0x11
+	.long	0xbb6
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x1c
+	.long	.LLRL4
+	.uleb128 0x1e
+	.long	0xbc1
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1e
+	.long	0xbcb
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF97
+	.byte	0x1
+	.byte	0x27
+	.byte	0x13
+	.long	0x72
+	.byte	0x3
+	.long	0xbd6
+	.uleb128 0x15
+	.long	.LASF78
+	.byte	0x27
+	.byte	0x38
+	.long	0xf0
+	.uleb128 0x1f
+	.long	.LASF91
+	.byte	0x28
+	.long	0x72
+	.uleb128 0x1f
+	.long	.LASF92
+	.byte	0x29
+	.long	0x72
+	.byte	0
+	.uleb128 0x30
+	.long	0xa7c
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc7b
+	.uleb128 0x11
+	.long	0xa8d
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x11
+	.long	0xa98
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x31
+	.long	0xa7c
+	.quad	.LBI14
+	.byte	.LVU61
+	.long	.LLRL12
+	.byte	0x1
+	.byte	0x49
+	.byte	0x8
+	.long	0xc5e
+	.uleb128 0x11
+	.long	0xa98
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x11
+	.long	0xa8d
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x10
+	.quad	.LVL24
+	.long	0xaa4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1f
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL21
+	.long	0xaa4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF73
+	.long	.LASF98
+	.byte	0xb
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 .LVU249
+	.uleb128 .LVU249
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU260
+	.uleb128 .LVU260
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU232
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU248
+	.uleb128 .LVU250
+	.uleb128 .LVU258
+	.uleb128 .LVU260
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU234
+	.uleb128 .LVU237
+	.uleb128 .LVU260
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x21
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x21
+	.byte	0x4
+	.uleb128 .LVL94-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU179
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU201
+	.uleb128 .LVU207
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU171
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU190
+	.uleb128 .LVU203
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL63-1-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU190
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU203
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL69-1-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU124
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU138
+	.uleb128 .LVU151
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU127
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL57-1-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU138
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU151
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL52-1-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU74
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU92
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU79
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU92
+	.uleb128 .LVU98
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU41
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU21
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU34
+	.uleb128 .LVU37
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU31
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU41
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0xe
+	.byte	0x75
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x64
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x24
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU45
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU52
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0xf
+	.byte	0x72
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	numeric_string_digit_pairs
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU2
+	.uleb128 .LVU15
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU7
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU15
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x40
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x40
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2c
+	.byte	0x8
+	.byte	0x40
+	.byte	0x74
+	.sleb128 0
+	.byte	0x31
+	.byte	0x21
+	.byte	0x12
+	.byte	0x28
+	.value	0x6
+	.byte	0x13
+	.byte	0x8
+	.byte	0x40
+	.byte	0x2f
+	.value	0x1a
+	.byte	0x30
+	.byte	0x16
+	.byte	0x12
+	.byte	0xe
+	.quad	0x8000000000000000
+	.byte	0x1a
+	.byte	0x28
+	.value	0x9
+	.byte	0x31
+	.byte	0x24
+	.byte	0x16
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x16
+	.byte	0x2f
+	.value	0xffe9
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU14
+	.uleb128 .LVU15
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x4
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU61
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU70
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x4
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU61
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU70
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF95:
+	.string	"__errno_location"
+.LASF98:
+	.string	"__builtin_memcpy"
+.LASF85:
+	.string	"i64tos_batch"
+.LASF69:
+	.string	"strtold"
+.LASF21:
+	.string	"block_size"
+.LASF48:
+	.string	"ST_STRING_INLINE"
+.LASF7:
+	.string	"signed char"
+.LASF19:
+	.string	"uint64_t"
+.LASF79:
+	.string	"stold"
+.LASF8:
+	.string	"short int"
+.LASF9:
+	.string	"size_t"
+.LASF74:
+	.string	"malloc"
+.LASF61:
+	.string	"stats"
+.LASF73:
+	.string	"memcpy"
+.LASF27:
+	.string	"tokens_extracted"
+.LASF15:
+	.string	"ssize_t"
+.LASF97:
+	.string	"numeric_string_count_digits"
+.LASF17:
+	.string	"int64_t"
+.LASF78:
+	.string	"value"
+.LASF32:
+	.string	"conversions"
+.LASF20:
+	.string	"head"
+.LASF47:
+	.string	"ST_STRING_MAPPED"
+.LASF24:
+	.string	"StringArena"
+.LASF66:
+	.string	"hint"
+.LASF51:
+	.string	"length"
+.LASF35:
+	.string	"read"
+.LASF16:
+	.string	"long long int"
+.LASF91:
+	.string	"bits"
+.LASF87:
+	.string	"offsets"
+.LASF13:
+	.string	"__ssize_t"
+.LASF11:
+	.string	"long int"
+.LASF10:
+	.string	"__int64_t"
+.LASF50:
+	.string	"string"
+.LASF39:
+	.string	"offset"
+.LASF60:
+	.string	"structural_index"
+.LASF86:
+	.string	"values"
+.LASF36:
+	.string	"context"
+.LASF92:
+	.string	"digits"
+.LASF83:
+	.string	"numeric_string"
+.LASF53:
+	.string	"incremental_factor"
+.LASF71:
+	.string	"snprintf"
+.LASF5:
+	.string	"unsigned char"
+.LASF45:
+	.string	"ST_STRING_BORROWED"
+.LASF43:
+	.string	"StringGrowthPolicy"
+.LASF29:
+	.string	"reallocations"
+.LASF23:
+	.string	"long double"
+.LASF68:
+	.string	"numeric_string_powers_of_ten"
+.LASF80:
+	.string	"ldtos"
+.LASF88:
+	.string	"i64tos_to"
+.LASF42:
+	.string	"ST_GROWTH_LINEAR"
+.LASF38:
+	.string	"capacity"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF67:
+	.string	"numeric_string_digit_pairs"
+.LASF4:
+	.string	"unsigned int"
+.LASF57:
+	.string	"ownership"
+.LASF56:
+	.string	"stream"
+.LASF76:
+	.string	"endptr"
+.LASF77:
+	.string	"start"
+.LASF6:
+	.string	"short unsigned int"
+.LASF72:
+	.string	"dtos_fixed_to"
+.LASF14:
+	.string	"char"
+.LASF70:
+	.string	"strlen"
+.LASF58:
+	.string	"arena"
+.LASF82:
+	.string	"itos"
+.LASF12:
+	.string	"__uint64_t"
+.LASF81:
+	.string	"buffer"
+.LASF25:
+	.string	"StringStats"
+.LASF3:
+	.string	"long unsigned int"
+.LASF59:
+	.string	"inline_buffer"
+.LASF2:
+	.string	"double"
+.LASF62:
+	.string	"StringStructuralIndex"
+.LASF93:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF46:
+	.string	"ST_STRING_OWNED"
+.LASF55:
+	.string	"max_increment"
+.LASF31:
+	.string	"bytes_copied"
+.LASF65:
+	.string	"in_string"
+.LASF64:
+	.string	"count"
+.LASF96:
+	.string	"st_stats_add"
+.LASF37:
+	.string	"chunk_size"
+.LASF44:
+	.string	"StringOwnership"
+.LASF33:
+	.string	"conversion_ns"
+.LASF22:
+	.string	"used"
+.LASF41:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF40:
+	.string	"error"
+.LASF52:
+	.string	"position"
+.LASF49:
+	.string	"StringTokenizer"
+.LASF63:
+	.string	"positions"
+.LASF75:
+	.string	"st_stats_clock"
+.LASF26:
+	.string	"bytes_scanned"
+.LASF89:
+	.string	"u64tos_to"
+.LASF54:
+	.string	"growth_policy"
+.LASF90:
+	.string	"pair"
+.LASF94:
+	.string	"StringArenaBlock"
+.LASF34:
+	.string	"StringStream"
+.LASF84:
+	.string	"itos_to"
+.LASF30:
+	.string	"expansions"
+.LASF28:
+	.string	"allocations"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+.LASF0:
+	.string	"/root/repo/src/numeric_string.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
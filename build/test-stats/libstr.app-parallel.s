@@ -0,0 +1,8973 @@
+	.file	"parallel.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/src/parallel.c"
+	.p2align 4
+	.type	parallel_lines_work, @function
+parallel_lines_work:
+.LVL0:
+.LFB30:
+	.file 1 "/root/repo/src/parallel.c"
+	.loc 1 244 108 view -0
+	.cfi_startproc
+	.loc 1 245 3 view .LVU1
+	.loc 1 244 108 is_stmt 0 view .LVU2
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdx, %rax
+	.loc 1 245 43 view .LVU3
+	leaq	0(,%rax,8), %r12
+	.loc 1 244 108 view .LVU4
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 244 108 view .LVU5
+	movq	%rdi, %rbx
+	.loc 1 245 35 view .LVU6
+	movq	40(%rdi), %rdx
+.LVL1:
+	.loc 1 245 9 view .LVU7
+	movq	32(%rdi), %r8
+	.loc 1 245 43 view .LVU8
+	movq	(%rdx,%rax,8), %rcx
+	.loc 1 246 10 view .LVU9
+	movq	8(%rdx,%r12), %rdx
+	.loc 1 245 9 view .LVU10
+	addq	%rcx, %r8
+.LVL2:
+	.loc 1 246 3 is_stmt 1 view .LVU11
+	.loc 1 246 10 is_stmt 0 view .LVU12
+	subq	%rcx, %rdx
+.LVL3:
+	.loc 1 247 3 is_stmt 1 view .LVU13
+	.loc 1 247 23 is_stmt 0 view .LVU14
+	movq	48(%rdi), %rcx
+	movq	$0, (%rcx,%rax,8)
+	.loc 1 249 3 is_stmt 1 view .LVU15
+	.loc 1 249 13 is_stmt 0 view .LVU16
+	movq	80(%rsi), %rdi
+.LVL4:
+	.loc 1 249 6 view .LVU17
+	testq	%rdi, %rdi
+	je	.L11
+	.loc 1 255 8 is_stmt 1 view .LVU18
+	.loc 1 255 12 is_stmt 0 view .LVU19
+	movq	%r8, %rsi
+.LVL5:
+	.loc 1 255 12 view .LVU20
+	call	st_rebind@PLT
+.LVL6:
+	.loc 1 255 11 view .LVU21
+	testl	%eax, %eax
+	je	.L4
+	.loc 1 258 10 view .LVU22
+	movq	80(%rbp), %rsi
+.L3:
+	.loc 1 258 3 is_stmt 1 view .LVU23
+	.loc 1 258 22 is_stmt 0 view .LVU24
+	movq	56(%rbx), %rax
+	.loc 1 258 10 view .LVU25
+	movq	48(%rbx), %rdx
+	movq	64(%rbx), %rdi
+	.loc 1 259 1 view .LVU26
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL7:
+	.loc 1 259 1 view .LVU27
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL8:
+	.loc 1 258 10 view .LVU28
+	movq	(%rax), %rax
+	addq	%r12, %rdx
+	.loc 1 259 1 view .LVU29
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	.loc 1 258 10 view .LVU30
+	jmp	*%rax
+.LVL9:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.cfi_restore_state
+	.loc 1 250 5 is_stmt 1 view .LVU31
+	.loc 1 250 25 is_stmt 0 view .LVU32
+	movq	%rdx, %rsi
+.LVL10:
+	.loc 1 250 25 view .LVU33
+	movq	%r8, %rdi
+	call	st_create_n@PLT
+.LVL11:
+	.loc 1 250 23 view .LVU34
+	movq	%rax, 80(%rbp)
+	.loc 1 251 5 is_stmt 1 view .LVU35
+	.loc 1 250 25 is_stmt 0 view .LVU36
+	movq	%rax, %rsi
+	.loc 1 251 8 view .LVU37
+	testq	%rax, %rax
+	jne	.L3
+.L4:
+	.loc 1 259 1 view .LVU38
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL12:
+	.loc 1 259 1 view .LVU39
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL13:
+	.loc 1 259 1 view .LVU40
+	xorl	%eax, %eax
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	parallel_lines_work, .-parallel_lines_work
+	.p2align 4
+	.type	parallel_worker_run, @function
+parallel_worker_run:
+.LVL14:
+.LFB28:
+	.loc 1 169 50 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 170 3 view .LVU42
+	.loc 1 171 3 view .LVU43
+	.loc 1 169 50 is_stmt 0 view .LVU44
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 171 23 view .LVU45
+	movq	72(%rdi), %r14
+.LVL15:
+	.loc 1 172 3 is_stmt 1 view .LVU46
+	.loc 1 173 3 view .LVU47
+	.loc 1 173 9 is_stmt 0 view .LVU48
+	jmp	.L14
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L27:
+.LBB6:
+.LBB7:
+.LBB8:
+.LBB9:
+	.loc 1 152 7 is_stmt 1 view .LVU49
+	.loc 1 152 16 is_stmt 0 view .LVU50
+	leaq	-1(%rdx), %rbp
+	.loc 1 152 14 view .LVU51
+	movq	%rbp, 48(%rbx)
+.LVL17:
+	.loc 1 153 7 is_stmt 1 view .LVU52
+	.loc 1 155 5 view .LVU53
+	movq	%rbx, %rdi
+	call	pthread_mutex_unlock@PLT
+.LVL18:
+.LBE9:
+	.loc 1 148 53 view .LVU54
+	.loc 1 148 37 view .LVU55
+	.loc 1 148 37 is_stmt 0 view .LVU56
+.LBE8:
+.LBE7:
+.LBE6:
+	.loc 1 174 5 is_stmt 1 view .LVU57
+	.loc 1 174 9 is_stmt 0 view .LVU58
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	call	*(%r14)
+.LVL19:
+	.loc 1 174 8 view .LVU59
+	testl	%eax, %eax
+	je	.L26
+.LVL20:
+.L14:
+	.loc 1 173 40 is_stmt 1 view .LVU60
+.LBB15:
+.LBI6:
+	.loc 1 137 12 view .LVU61
+.LBB13:
+	.loc 1 138 3 view .LVU62
+	.loc 1 140 3 view .LVU63
+	movq	%r12, %rdi
+	call	pthread_mutex_lock@PLT
+.LVL21:
+	.loc 1 141 3 view .LVU64
+	.loc 1 141 13 is_stmt 0 view .LVU65
+	movq	40(%r12), %rbp
+	.loc 1 141 6 view .LVU66
+	cmpq	48(%r12), %rbp
+	jb	.L15
+	.loc 1 145 3 is_stmt 1 view .LVU67
+	movq	%r12, %rdi
+	call	pthread_mutex_unlock@PLT
+.LVL22:
+	.loc 1 147 3 view .LVU68
+	.loc 1 147 23 is_stmt 0 view .LVU69
+	movq	72(%r12), %r13
+.LVL23:
+	.loc 1 148 3 is_stmt 1 view .LVU70
+.LBB11:
+	.loc 1 148 8 view .LVU71
+	.loc 1 148 37 view .LVU72
+	.loc 1 148 29 is_stmt 0 view .LVU73
+	movq	16(%r13), %rcx
+	.loc 1 148 37 view .LVU74
+	cmpq	$1, %rcx
+	jbe	.L24
+	.loc 1 148 15 view .LVU75
+	movl	$1, %ebp
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+.LBB10:
+	.loc 1 149 5 is_stmt 1 view .LVU76
+	.loc 1 149 63 is_stmt 0 view .LVU77
+	movq	64(%r12), %rax
+	.loc 1 149 68 view .LVU78
+	xorl	%edx, %edx
+	.loc 1 149 63 view .LVU79
+	addq	%rbp, %rax
+	.loc 1 149 68 view .LVU80
+	divq	%rcx
+	.loc 1 149 50 view .LVU81
+	imulq	$88, %rdx, %rbx
+	.loc 1 149 28 view .LVU82
+	addq	8(%r13), %rbx
+.LVL25:
+	.loc 1 150 5 is_stmt 1 view .LVU83
+	movq	%rbx, %rdi
+	call	pthread_mutex_lock@PLT
+.LVL26:
+	.loc 1 151 5 view .LVU84
+	.loc 1 151 30 is_stmt 0 view .LVU85
+	movq	48(%rbx), %rdx
+	.loc 1 151 8 view .LVU86
+	cmpq	%rdx, 40(%rbx)
+	jb	.L27
+	.loc 1 155 5 is_stmt 1 view .LVU87
+	movq	%rbx, %rdi
+	call	pthread_mutex_unlock@PLT
+.LVL27:
+.LBE10:
+	.loc 1 148 53 view .LVU88
+	.loc 1 148 29 is_stmt 0 view .LVU89
+	movq	16(%r13), %rcx
+	.loc 1 148 53 view .LVU90
+	incq	%rbp
+.LVL28:
+	.loc 1 148 37 is_stmt 1 view .LVU91
+	cmpq	%rcx, %rbp
+	jb	.L16
+.LVL29:
+.L24:
+	.loc 1 148 37 is_stmt 0 view .LVU92
+.LBE11:
+.LBE13:
+.LBE15:
+	.loc 1 179 1 view .LVU93
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL30:
+	.loc 1 179 1 view .LVU94
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL31:
+	.loc 1 179 1 view .LVU95
+	xorl	%eax, %eax
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL32:
+	.loc 1 179 1 view .LVU96
+	ret
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.cfi_restore_state
+.LBB16:
+.LBB14:
+	.loc 1 142 5 is_stmt 1 view .LVU97
+	.loc 1 142 26 is_stmt 0 view .LVU98
+	leaq	1(%rbp), %rax
+	movq	%rax, 40(%r12)
+.LVL34:
+	.loc 1 143 5 is_stmt 1 view .LVU99
+	.loc 1 145 3 view .LVU100
+	movq	%r12, %rdi
+	call	pthread_mutex_unlock@PLT
+.LVL35:
+	.loc 1 147 3 view .LVU101
+	.loc 1 148 3 view .LVU102
+.LBB12:
+	.loc 1 148 8 view .LVU103
+	.loc 1 148 37 view .LVU104
+	.loc 1 148 37 is_stmt 0 view .LVU105
+.LBE12:
+.LBE14:
+.LBE16:
+	.loc 1 174 5 is_stmt 1 view .LVU106
+	.loc 1 174 9 is_stmt 0 view .LVU107
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movq	%r14, %rdi
+	call	*(%r14)
+.LVL36:
+	.loc 1 174 8 view .LVU108
+	testl	%eax, %eax
+	jne	.L14
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	.loc 1 175 7 is_stmt 1 view .LVU109
+	movl	$1, 24(%r14)
+.LVL37:
+	.loc 1 175 7 is_stmt 0 view .LVU110
+	jmp	.L14
+	.cfi_endproc
+.LFE28:
+	.size	parallel_worker_run, .-parallel_worker_run
+	.p2align 4
+	.type	parallel_run, @function
+parallel_run:
+.LVL38:
+.LFB29:
+	.loc 1 194 87 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 195 3 view .LVU112
+	.loc 1 194 87 is_stmt 0 view .LVU113
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	$1, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	testq	%rdx, %rdx
+	cmovne	%rdx, %rbp
+	.loc 1 195 6 view .LVU114
+	testq	%rsi, %rsi
+	je	.L29
+	cmpq	%rbp, %rsi
+	cmovbe	%rsi, %rbp
+	.loc 1 202 43 view .LVU115
+	imulq	$88, %rbp, %rdi
+.LVL39:
+.L30:
+	.loc 1 199 3 is_stmt 1 view .LVU116
+	.loc 1 202 3 view .LVU117
+	.loc 1 202 43 is_stmt 0 view .LVU118
+	call	malloc@PLT
+.LVL40:
+	.loc 1 202 16 view .LVU119
+	movq	%rax, 8(%r12)
+	.loc 1 203 3 is_stmt 1 view .LVU120
+	.loc 1 202 43 is_stmt 0 view .LVU121
+	movq	%rax, %rbx
+	.loc 1 203 6 view .LVU122
+	testq	%rax, %rax
+	je	.L47
+	.loc 1 206 3 is_stmt 1 view .LVU123
+	.loc 1 206 14 is_stmt 0 view .LVU124
+	movq	%rbp, 16(%r12)
+	.loc 1 207 3 is_stmt 1 view .LVU125
+	.loc 1 207 15 is_stmt 0 view .LVU126
+	movl	$0, 24(%r12)
+	.loc 1 208 3 is_stmt 1 view .LVU127
+.LBB17:
+	.loc 1 208 8 view .LVU128
+.LVL41:
+	.loc 1 208 24 view .LVU129
+.LBE17:
+	.loc 1 207 15 is_stmt 0 view .LVU130
+	xorl	%r14d, %r14d
+.LBB19:
+	.loc 1 208 15 view .LVU131
+	xorl	%r15d, %r15d
+	jmp	.L33
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.loc 1 208 15 view .LVU132
+.LBE19:
+	.loc 1 225 23 view .LVU133
+	movq	8(%r12), %rbx
+.LVL43:
+.LBB20:
+	.loc 1 208 36 view .LVU134
+	movq	%rcx, %r15
+.LVL44:
+.L33:
+.LBB18:
+	.loc 1 209 5 is_stmt 1 discriminator 3 view .LVU135
+	.loc 1 209 28 is_stmt 0 discriminator 3 view .LVU136
+	imulq	$88, %r15, %rax
+	.loc 1 210 5 discriminator 3 view .LVU137
+	xorl	%esi, %esi
+	.loc 1 209 28 discriminator 3 view .LVU138
+	addq	%rax, %rbx
+.LVL45:
+	.loc 1 210 5 is_stmt 1 discriminator 3 view .LVU139
+	movq	%rbx, %rdi
+	call	pthread_mutex_init@PLT
+.LVL46:
+	.loc 1 211 5 discriminator 3 view .LVU140
+	.loc 1 211 31 is_stmt 0 discriminator 3 view .LVU141
+	movq	%r14, %rax
+	xorl	%edx, %edx
+	divq	%rbp
+	.loc 1 213 16 discriminator 3 view .LVU142
+	movq	%r15, 64(%rbx)
+	.loc 1 214 17 discriminator 3 view .LVU143
+	movq	%r12, 72(%rbx)
+	.loc 1 215 23 discriminator 3 view .LVU144
+	movq	$0, 80(%rbx)
+	.loc 1 212 26 discriminator 3 view .LVU145
+	addq	%r13, %r14
+	.loc 1 212 36 discriminator 3 view .LVU146
+	xorl	%edx, %edx
+	.loc 1 212 31 discriminator 3 view .LVU147
+	leaq	1(%r15), %rcx
+	.loc 1 211 18 discriminator 3 view .LVU148
+	movq	%rax, 40(%rbx)
+	.loc 1 212 5 is_stmt 1 discriminator 3 view .LVU149
+	.loc 1 212 36 is_stmt 0 discriminator 3 view .LVU150
+	movq	%r14, %rax
+	divq	%rbp
+	.loc 1 212 17 discriminator 3 view .LVU151
+	movq	%rax, 48(%rbx)
+	.loc 1 213 5 is_stmt 1 discriminator 3 view .LVU152
+	.loc 1 214 5 discriminator 3 view .LVU153
+	.loc 1 215 5 discriminator 3 view .LVU154
+.LBE18:
+	.loc 1 208 36 discriminator 3 view .LVU155
+.LVL47:
+	.loc 1 208 24 discriminator 3 view .LVU156
+	cmpq	%rbp, %rcx
+	jne	.L55
+.LVL48:
+	.loc 1 208 24 is_stmt 0 discriminator 3 view .LVU157
+.LBE20:
+	.loc 1 219 18 is_stmt 1 view .LVU158
+	.loc 1 225 23 is_stmt 0 view .LVU159
+	movq	8(%r12), %rcx
+.LVL49:
+	.loc 1 219 18 view .LVU160
+	cmpq	$1, %rbp
+	je	.L34
+	movl	$88, %r14d
+	.loc 1 218 10 view .LVU161
+	movl	$1, %ebx
+.LVL50:
+	.loc 1 218 10 view .LVU162
+	leaq	parallel_worker_run(%rip), %r13
+.LVL51:
+	.loc 1 218 10 view .LVU163
+	jmp	.L36
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.loc 1 219 36 is_stmt 1 view .LVU164
+	incq	%rbx
+.LVL53:
+	.loc 1 219 18 view .LVU165
+	addq	$88, %r14
+	cmpq	%rbp, %rbx
+	je	.L52
+	movq	8(%r12), %rcx
+.LVL54:
+.L36:
+	.loc 1 220 5 view .LVU166
+	.loc 1 220 81 is_stmt 0 view .LVU167
+	addq	%r14, %rcx
+	.loc 1 220 9 view .LVU168
+	xorl	%esi, %esi
+	leaq	56(%rcx), %rdi
+	movq	%r13, %rdx
+	call	pthread_create@PLT
+.LVL55:
+	.loc 1 220 8 view .LVU169
+	testl	%eax, %eax
+	je	.L56
+	.loc 1 225 3 is_stmt 1 view .LVU170
+	movq	8(%r12), %rdi
+	call	parallel_worker_run
+.LVL56:
+	.loc 1 226 3 view .LVU171
+.LBB21:
+	.loc 1 226 8 view .LVU172
+	.loc 1 226 24 view .LVU173
+	cmpq	$1, %rbx
+	je	.L40
+.L39:
+	.loc 1 226 24 is_stmt 0 view .LVU174
+.LBE21:
+	.loc 1 219 36 discriminator 3 view .LVU175
+	movl	$88, %r14d
+	movl	$1, %r13d
+.LVL57:
+	.p2align 4,,10
+	.p2align 3
+.L42:
+.LBB22:
+	.loc 1 227 5 is_stmt 1 discriminator 3 view .LVU176
+	movq	8(%r12), %rax
+	xorl	%esi, %esi
+	movq	56(%rax,%r14), %rdi
+	.loc 1 226 36 is_stmt 0 discriminator 3 view .LVU177
+	incq	%r13
+.LVL58:
+	.loc 1 227 5 discriminator 3 view .LVU178
+	call	pthread_join@PLT
+.LVL59:
+	.loc 1 226 36 is_stmt 1 discriminator 3 view .LVU179
+	.loc 1 226 24 discriminator 3 view .LVU180
+	addq	$88, %r14
+	cmpq	%r13, %rbx
+	jne	.L42
+.LVL60:
+	.loc 1 226 24 is_stmt 0 discriminator 3 view .LVU181
+.LBE22:
+.LBB23:
+	.loc 1 230 30 is_stmt 1 view .LVU182
+	cmpq	%rbp, %rbx
+	jnb	.L41
+.LVL61:
+.L40:
+	.loc 1 230 30 is_stmt 0 view .LVU183
+	imulq	$88, %rbx, %r13
+.LVL62:
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	.loc 1 231 5 is_stmt 1 discriminator 3 view .LVU184
+	.loc 1 231 25 is_stmt 0 discriminator 3 view .LVU185
+	movq	8(%r12), %rdi
+	.loc 1 230 42 discriminator 3 view .LVU186
+	incq	%rbx
+.LVL63:
+	.loc 1 231 25 discriminator 3 view .LVU187
+	addq	%r13, %rdi
+	.loc 1 231 5 discriminator 3 view .LVU188
+	call	parallel_worker_run
+.LVL64:
+	.loc 1 230 42 is_stmt 1 discriminator 3 view .LVU189
+	.loc 1 230 30 discriminator 3 view .LVU190
+	addq	$88, %r13
+	cmpq	%rbp, %rbx
+	jne	.L44
+.LVL65:
+.L41:
+	.loc 1 230 30 is_stmt 0 discriminator 3 view .LVU191
+.LBE23:
+.LBB24:
+	.loc 1 233 24 is_stmt 1 view .LVU192
+	.loc 1 233 24 is_stmt 0 view .LVU193
+.LBE24:
+	.loc 1 219 36 view .LVU194
+	xorl	%ebx, %ebx
+.LBB25:
+	.loc 1 233 15 view .LVU195
+	xorl	%r13d, %r13d
+	.p2align 4,,10
+	.p2align 3
+.L45:
+.LVL66:
+	.loc 1 234 5 is_stmt 1 discriminator 3 view .LVU196
+	.loc 1 234 40 is_stmt 0 discriminator 3 view .LVU197
+	movq	8(%r12), %rdi
+	.loc 1 233 36 discriminator 3 view .LVU198
+	incq	%r13
+.LVL67:
+	.loc 1 234 40 discriminator 3 view .LVU199
+	addq	%rbx, %rdi
+	.loc 1 234 5 discriminator 3 view .LVU200
+	call	pthread_mutex_destroy@PLT
+.LVL68:
+	.loc 1 235 5 is_stmt 1 discriminator 3 view .LVU201
+	movq	8(%r12), %rax
+	movq	80(%rax,%rbx), %rdi
+	.loc 1 233 24 is_stmt 0 discriminator 3 view .LVU202
+	addq	$88, %rbx
+	.loc 1 235 5 discriminator 3 view .LVU203
+	call	st_destroy@PLT
+.LVL69:
+	.loc 1 233 36 is_stmt 1 discriminator 3 view .LVU204
+	.loc 1 233 24 discriminator 3 view .LVU205
+	cmpq	%rbp, %r13
+	jne	.L45
+.LVL70:
+.L38:
+	.loc 1 233 24 is_stmt 0 discriminator 3 view .LVU206
+.LBE25:
+	.loc 1 237 3 is_stmt 1 view .LVU207
+	movq	8(%r12), %rdi
+	call	free@PLT
+.LVL71:
+	.loc 1 238 3 view .LVU208
+	.loc 1 238 22 is_stmt 0 view .LVU209
+	movl	24(%r12), %edx
+	xorl	%eax, %eax
+	testl	%edx, %edx
+	sete	%al
+.LVL72:
+.L28:
+	.loc 1 239 1 view .LVU210
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL73:
+	.loc 1 239 1 view .LVU211
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	.cfi_restore_state
+	.loc 1 225 3 is_stmt 1 view .LVU212
+	movq	8(%r12), %rdi
+	call	parallel_worker_run
+.LVL75:
+	.loc 1 226 3 view .LVU213
+.LBB26:
+	.loc 1 226 8 view .LVU214
+	.loc 1 226 24 view .LVU215
+	jmp	.L39
+.LVL76:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 226 24 is_stmt 0 view .LVU216
+.LBE26:
+.LBB27:
+	.loc 1 196 5 is_stmt 1 view .LVU217
+	.loc 1 196 23 is_stmt 0 view .LVU218
+	movl	$84, %edi
+.LVL77:
+	.loc 1 196 23 view .LVU219
+	call	sysconf@PLT
+.LVL78:
+	.loc 1 197 5 is_stmt 1 view .LVU220
+	.loc 1 197 51 is_stmt 0 view .LVU221
+	testq	%rax, %rax
+	jle	.L46
+	cmpq	%rbp, %rax
+	cmovbe	%rax, %rbp
+.LBE27:
+	.loc 1 202 43 discriminator 1 view .LVU222
+	imulq	$88, %rbp, %rdi
+.LBB28:
+	jmp	.L30
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	movl	$88, %edi
+	movl	$1, %ebp
+	jmp	.L30
+.LVL79:
+.L34:
+	.loc 1 202 43 discriminator 1 view .LVU223
+.LBE28:
+	.loc 1 225 3 is_stmt 1 view .LVU224
+	movq	%rcx, %rdi
+	call	parallel_worker_run
+.LVL80:
+	.loc 1 226 3 view .LVU225
+.LBB29:
+	.loc 1 226 8 view .LVU226
+	.loc 1 226 24 view .LVU227
+	.loc 1 226 24 is_stmt 0 view .LVU228
+.LBE29:
+.LBB30:
+	.loc 1 230 30 is_stmt 1 view .LVU229
+	.loc 1 230 30 is_stmt 0 view .LVU230
+.LBE30:
+.LBB31:
+	.loc 1 233 24 is_stmt 1 view .LVU231
+	.loc 1 234 5 view .LVU232
+	movq	8(%r12), %rdi
+	call	pthread_mutex_destroy@PLT
+.LVL81:
+	.loc 1 235 5 view .LVU233
+	movq	8(%r12), %rax
+	movq	80(%rax), %rdi
+	call	st_destroy@PLT
+.LVL82:
+	.loc 1 233 36 view .LVU234
+	.loc 1 233 24 view .LVU235
+	jmp	.L38
+.LVL83:
+.L47:
+	.loc 1 233 24 is_stmt 0 view .LVU236
+.LBE31:
+	.loc 1 204 12 view .LVU237
+	xorl	%eax, %eax
+	jmp	.L28
+	.cfi_endproc
+.LFE29:
+	.size	parallel_run, .-parallel_run
+	.p2align 4
+	.type	parallel_serialize_work, @function
+parallel_serialize_work:
+.LVL84:
+.LFB32:
+	.loc 1 316 112 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 318 3 view .LVU239
+	.loc 1 319 3 view .LVU240
+	.loc 1 316 112 is_stmt 0 view .LVU241
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	.loc 1 319 39 view .LVU242
+	movl	$4096, %edi
+.LVL85:
+	.loc 1 316 112 view .LVU243
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 319 39 view .LVU244
+	call	st_create_empty@PLT
+.LVL86:
+	.loc 1 319 39 view .LVU245
+	movq	%rax, %r12
+.LVL87:
+	.loc 1 320 3 is_stmt 1 view .LVU246
+	.loc 1 320 25 is_stmt 0 view .LVU247
+	movq	112(%rbp), %rax
+.LVL88:
+	.loc 1 320 25 view .LVU248
+	movq	%r12, (%rax,%r13,8)
+	.loc 1 321 3 is_stmt 1 view .LVU249
+	.loc 1 321 6 is_stmt 0 view .LVU250
+	testq	%r12, %r12
+	je	.L58
+	.loc 1 324 3 is_stmt 1 view .LVU251
+	.loc 1 324 29 is_stmt 0 view .LVU252
+	movq	80(%rbp), %r14
+	.loc 1 325 10 view .LVU253
+	movq	72(%rbp), %rax
+	.loc 1 324 10 view .LVU254
+	imulq	%r14, %r13
+.LVL89:
+	.loc 1 325 3 is_stmt 1 view .LVU255
+	.loc 1 325 23 is_stmt 0 view .LVU256
+	addq	%r13, %r14
+	.loc 1 325 10 view .LVU257
+	cmpq	%rax, %r14
+	cmova	%rax, %r14
+.LVL90:
+	.loc 1 326 3 is_stmt 1 view .LVU258
+.LBB32:
+	.loc 1 326 8 view .LVU259
+	.loc 1 326 36 view .LVU260
+	.loc 1 326 15 is_stmt 0 view .LVU261
+	movq	%r13, %rbx
+	.loc 1 326 36 view .LVU262
+	cmpq	%r14, %r13
+	jnb	.L65
+.LVL91:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.loc 1 330 5 is_stmt 1 view .LVU263
+	.loc 1 330 9 is_stmt 0 view .LVU264
+	movq	64(%rbp), %rdi
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	call	*88(%rbp)
+.LVL92:
+	.loc 1 330 8 view .LVU265
+	testl	%eax, %eax
+	je	.L58
+	.loc 1 326 49 is_stmt 1 discriminator 2 view .LVU266
+	incq	%rbx
+.LVL93:
+	.loc 1 326 36 discriminator 2 view .LVU267
+	cmpq	%rbx, %r14
+	je	.L65
+	.loc 1 327 5 view .LVU268
+	.loc 1 327 8 is_stmt 0 view .LVU269
+	cmpq	%rbx, %r13
+	jnb	.L59
+	.loc 1 327 26 discriminator 1 view .LVU270
+	movq	104(%rbp), %rdx
+	movq	96(%rbp), %rsi
+	movq	%r12, %rdi
+	call	st_append_n@PLT
+.LVL94:
+	.loc 1 327 23 discriminator 1 view .LVU271
+	testl	%eax, %eax
+	jne	.L59
+.LVL95:
+.L58:
+	.loc 1 327 23 discriminator 1 view .LVU272
+.LBE32:
+	.loc 1 335 1 view .LVU273
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL96:
+	.loc 1 335 1 view .LVU274
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL97:
+	.loc 1 335 1 view .LVU275
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	.loc 1 322 12 view .LVU276
+	xorl	%eax, %eax
+	.loc 1 335 1 view .LVU277
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL98:
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	.cfi_restore_state
+	.loc 1 335 1 view .LVU278
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL99:
+	.loc 1 335 1 view .LVU279
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL100:
+	.loc 1 335 1 view .LVU280
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL101:
+	.loc 1 335 1 view .LVU281
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL102:
+	.loc 1 334 10 view .LVU282
+	movl	$1, %eax
+	.loc 1 335 1 view .LVU283
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL103:
+	.loc 1 335 1 view .LVU284
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	parallel_serialize_work, .-parallel_serialize_work
+	.p2align 4
+	.globl	st_parallel_lines
+	.type	st_parallel_lines, @function
+st_parallel_lines:
+.LVL104:
+.LFB31:
+	.loc 1 264 153 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 265 3 view .LVU286
+	.loc 1 264 153 is_stmt 0 view .LVU287
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 240
+	.loc 1 264 153 view .LVU288
+	movq	%rdx, 40(%rsp)
+	movq	%r9, 8(%rsp)
+	.loc 1 265 6 view .LVU289
+	testq	%rdi, %rdi
+	je	.L90
+	movq	%rsi, %r12
+	testq	%rsi, %rsi
+	je	.L90
+	.loc 1 269 16 view .LVU290
+	testq	%rcx, %rcx
+	movq	%rcx, %r14
+	movl	$1048576, %eax
+	cmove	%rax, %r14
+	.loc 1 272 28 view .LVU291
+	movq	%rsi, %rax
+	xorl	%edx, %edx
+.LVL105:
+	.loc 1 272 28 view .LVU292
+	divq	%r14
+	movq	%rdi, %r13
+	movq	%r8, %rbp
+	.loc 1 268 3 is_stmt 1 view .LVU293
+.LVL106:
+	.loc 1 272 3 view .LVU294
+	.loc 1 273 3 view .LVU295
+	.loc 1 273 30 is_stmt 0 view .LVU296
+	leaq	16(,%rax,8), %rdi
+.LVL107:
+	.loc 1 273 30 view .LVU297
+	call	malloc@PLT
+.LVL108:
+	.loc 1 273 30 view .LVU298
+	movq	%rax, 32(%rsp)
+.LVL109:
+	.loc 1 274 3 is_stmt 1 view .LVU299
+	.loc 1 274 6 is_stmt 0 view .LVU300
+	testq	%rax, %rax
+	je	.L82
+	.loc 1 277 3 is_stmt 1 view .LVU301
+.LVL110:
+	.loc 1 278 3 view .LVU302
+	.loc 1 279 3 view .LVU303
+.LBB33:
+.LBB34:
+	.loc 1 283 43 is_stmt 0 view .LVU304
+	movl	$1, %edx
+	subq	%r14, %rdx
+	.loc 1 283 78 view .LVU305
+	leaq	-1(%r14), %rsi
+	.loc 1 283 43 view .LVU306
+	movq	%rdx, 16(%rsp)
+	.loc 1 283 78 view .LVU307
+	movq	%rsi, 24(%rsp)
+.LBE34:
+.LBE33:
+	.loc 1 279 13 view .LVU308
+	movq	$0, (%rax)
+	.loc 1 280 3 is_stmt 1 view .LVU309
+	.loc 1 280 16 view .LVU310
+	leaq	8(%rax), %r15
+	.loc 1 277 10 is_stmt 0 view .LVU311
+	xorl	%ebx, %ebx
+	.loc 1 278 10 view .LVU312
+	xorl	%eax, %eax
+.LVL111:
+	.p2align 4,,10
+	.p2align 3
+.L84:
+.LBB36:
+	.loc 1 281 5 is_stmt 1 view .LVU313
+	.loc 1 282 5 view .LVU314
+	.loc 1 282 16 is_stmt 0 view .LVU315
+	movq	%r12, %rdx
+	subq	%rax, %rdx
+	.loc 1 286 22 view .LVU316
+	incq	%rbx
+.LVL112:
+	.loc 1 282 8 view .LVU317
+	cmpq	%rdx, %r14
+	jb	.L104
+.LVL113:
+.L83:
+	.loc 1 286 5 is_stmt 1 view .LVU318
+	.loc 1 286 22 is_stmt 0 view .LVU319
+	movq	%r12, (%r15)
+	.loc 1 287 5 is_stmt 1 view .LVU320
+.LVL114:
+	.loc 1 287 5 is_stmt 0 view .LVU321
+.LBE36:
+	.loc 1 280 16 is_stmt 1 view .LVU322
+.L89:
+	.loc 1 289 3 view .LVU323
+	.loc 1 290 3 view .LVU324
+	.loc 1 290 12 is_stmt 0 view .LVU325
+	leaq	parallel_lines_work(%rip), %rax
+	movq	%rax, 48(%rsp)
+	.loc 1 291 3 is_stmt 1 view .LVU326
+	.loc 1 292 14 is_stmt 0 view .LVU327
+	movq	32(%rsp), %rax
+	.loc 1 295 26 view .LVU328
+	movl	$8, %esi
+	.loc 1 292 14 view .LVU329
+	movq	%rax, 88(%rsp)
+	.loc 1 294 15 view .LVU330
+	movq	8(%rsp), %rax
+	.loc 1 295 26 view .LVU331
+	movq	%rbx, %rdi
+	.loc 1 291 14 view .LVU332
+	movq	%r13, 80(%rsp)
+	.loc 1 292 3 is_stmt 1 view .LVU333
+	.loc 1 293 3 view .LVU334
+	.loc 1 293 15 is_stmt 0 view .LVU335
+	movq	%rbp, 104(%rsp)
+	.loc 1 294 3 is_stmt 1 view .LVU336
+	.loc 1 294 15 is_stmt 0 view .LVU337
+	movq	%rax, 112(%rsp)
+	.loc 1 295 3 is_stmt 1 view .LVU338
+	.loc 1 295 26 is_stmt 0 view .LVU339
+	call	calloc@PLT
+.LVL115:
+	.loc 1 295 15 view .LVU340
+	movq	%rax, 96(%rsp)
+	.loc 1 296 3 is_stmt 1 view .LVU341
+	.loc 1 296 6 is_stmt 0 view .LVU342
+	testq	%rax, %rax
+	je	.L105
+	.loc 1 300 3 is_stmt 1 view .LVU343
+	.loc 1 300 19 is_stmt 0 view .LVU344
+	movq	40(%rsp), %rsi
+	leaq	48(%rsp), %rdi
+	movq	%rbx, %rdx
+	call	parallel_run
+.LVL116:
+	movl	%eax, %r12d
+.LVL117:
+	.loc 1 302 3 is_stmt 1 view .LVU345
+	.loc 1 303 3 view .LVU346
+.LBB37:
+	.loc 1 303 8 view .LVU347
+	.loc 1 303 24 view .LVU348
+	.loc 1 303 15 is_stmt 0 view .LVU349
+	xorl	%r13d, %r13d
+.LVL118:
+	.loc 1 303 15 view .LVU350
+.LBE37:
+	.loc 1 302 7 view .LVU351
+	movl	$1, %r14d
+.LVL119:
+.LBB38:
+	.loc 1 305 14 view .LVU352
+	xorl	%r15d, %r15d
+	jmp	.L88
+.LVL120:
+	.p2align 4,,10
+	.p2align 3
+.L106:
+	.loc 1 304 34 discriminator 1 view .LVU353
+	movq	96(%rsp), %rcx
+	movq	8(%rsp), %rdi
+	movq	(%rcx,%r13,8), %rsi
+	call	*%rax
+.LVL121:
+	.loc 1 305 14 discriminator 1 view .LVU354
+	testl	%eax, %eax
+	cmove	%r15d, %r14d
+.LVL122:
+	.loc 1 303 35 is_stmt 1 discriminator 1 view .LVU355
+	incq	%r13
+.LVL123:
+	.loc 1 303 24 discriminator 1 view .LVU356
+	cmpq	%rbx, %r13
+	jnb	.L86
+.LVL124:
+.L88:
+	.loc 1 304 5 view .LVU357
+	.loc 1 304 16 is_stmt 0 view .LVU358
+	movq	8(%rbp), %rax
+	.loc 1 304 8 view .LVU359
+	testq	%rax, %rax
+	jne	.L106
+.L86:
+.LVL125:
+	.loc 1 304 8 view .LVU360
+.LBE38:
+	.loc 1 308 3 is_stmt 1 view .LVU361
+	movq	96(%rsp), %rdi
+	call	free@PLT
+.LVL126:
+	.loc 1 309 3 view .LVU362
+	movq	32(%rsp), %rdi
+	call	free@PLT
+.LVL127:
+	.loc 1 310 3 view .LVU363
+	.loc 1 310 20 is_stmt 0 view .LVU364
+	xorl	%eax, %eax
+	testl	%r12d, %r12d
+	setne	%al
+	andl	%r14d, %eax
+.LVL128:
+.L79:
+	.loc 1 311 1 view .LVU365
+	addq	$184, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL129:
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	.cfi_restore_state
+.LBB39:
+.LBB35:
+	.loc 1 283 7 is_stmt 1 view .LVU366
+	.loc 1 283 43 is_stmt 0 view .LVU367
+	movq	16(%rsp), %rcx
+	movl	$10, %esi
+	addq	%rcx, %rdx
+	.loc 1 283 78 view .LVU368
+	movq	24(%rsp), %rcx
+	leaq	(%rcx,%rax), %rdi
+	addq	%r13, %rdi
+	.loc 1 283 43 view .LVU369
+	call	memchr@PLT
+.LVL130:
+	.loc 1 284 7 is_stmt 1 view .LVU370
+	.loc 1 284 61 is_stmt 0 view .LVU371
+	testq	%rax, %rax
+	je	.L83
+	.loc 1 284 47 discriminator 1 view .LVU372
+	subq	%r13, %rax
+.LVL131:
+	.loc 1 284 61 discriminator 1 view .LVU373
+	incq	%rax
+.LVL132:
+	.loc 1 284 61 discriminator 1 view .LVU374
+.LBE35:
+	.loc 1 286 5 is_stmt 1 discriminator 1 view .LVU375
+	.loc 1 286 22 is_stmt 0 discriminator 1 view .LVU376
+	movq	%rax, (%r15)
+	.loc 1 287 5 is_stmt 1 discriminator 1 view .LVU377
+.LVL133:
+	.loc 1 287 5 is_stmt 0 discriminator 1 view .LVU378
+.LBE39:
+	.loc 1 280 16 is_stmt 1 discriminator 1 view .LVU379
+	addq	$8, %r15
+	cmpq	%r12, %rax
+	jb	.L84
+	jmp	.L89
+.LVL134:
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.loc 1 266 12 is_stmt 0 view .LVU380
+	movl	$1, %eax
+	jmp	.L79
+.LVL135:
+.L105:
+	.loc 1 297 5 is_stmt 1 view .LVU381
+	movq	32(%rsp), %rdi
+	call	free@PLT
+.LVL136:
+	.loc 1 298 5 view .LVU382
+.L82:
+	.loc 1 275 12 is_stmt 0 view .LVU383
+	xorl	%eax, %eax
+	jmp	.L79
+	.cfi_endproc
+.LFE31:
+	.size	st_parallel_lines, .-st_parallel_lines
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	""
+	.text
+	.p2align 4
+	.globl	st_parallel_serialize
+	.type	st_parallel_serialize, @function
+st_parallel_serialize:
+.LVL137:
+.LFB33:
+	.loc 1 340 237 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 341 3 view .LVU385
+	.loc 1 340 237 is_stmt 0 view .LVU386
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 342 16 view .LVU387
+	movl	$1024, %eax
+	.loc 1 340 237 view .LVU388
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rcx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 240
+	.loc 1 342 16 view .LVU389
+	testq	%rcx, %rcx
+	cmove	%rax, %r13
+.LVL138:
+	.loc 1 344 3 is_stmt 1 view .LVU390
+	leaq	-1(%rsi), %rax
+	xorl	%r15d, %r15d
+	addq	%r13, %rax
+	setc	%r15b
+	.loc 1 340 237 is_stmt 0 view .LVU391
+	movq	%rdx, 8(%rsp)
+	.loc 1 344 10 view .LVU392
+	xorl	%edx, %edx
+.LVL139:
+	.loc 1 344 10 view .LVU393
+	divq	%r13
+	.loc 1 346 24 view .LVU394
+	movq	$0, 24(%rdi)
+	.loc 1 347 21 view .LVU395
+	movq	$0, 32(%rdi)
+	.loc 1 348 18 view .LVU396
+	movq	$0, 16(%rdi)
+	.loc 1 349 24 view .LVU397
+	movq	$0, 40(%rdi)
+	.loc 1 340 237 view .LVU398
+	movq	%r8, 16(%rsp)
+	movq	%r9, 24(%rsp)
+	movq	240(%rsp), %r14
+	.loc 1 350 53 view .LVU399
+	testq	%r15, %r15
+	movl	$8, %esi
+.LVL140:
+	.loc 1 345 20 view .LVU400
+	movq	%rax, 8(%rdi)
+	.loc 1 350 53 view .LVU401
+	movl	$1, %edi
+.LVL141:
+	.loc 1 350 53 view .LVU402
+	cmove	%rax, %rdi
+	.loc 1 344 10 view .LVU403
+	movq	%rax, %rbx
+.LVL142:
+	.loc 1 345 3 is_stmt 1 view .LVU404
+	.loc 1 346 3 view .LVU405
+	.loc 1 347 3 view .LVU406
+	.loc 1 348 3 view .LVU407
+	.loc 1 349 3 view .LVU408
+	.loc 1 350 3 view .LVU409
+	.loc 1 350 53 is_stmt 0 view .LVU410
+	call	calloc@PLT
+.LVL143:
+	.loc 1 350 24 view .LVU411
+	movq	%rax, (%r12)
+	.loc 1 351 3 is_stmt 1 view .LVU412
+	.loc 1 351 6 is_stmt 0 view .LVU413
+	testq	%rax, %rax
+	je	.L136
+	.loc 1 356 3 is_stmt 1 view .LVU414
+	.loc 1 356 38 is_stmt 0 view .LVU415
+	testq	%r14, %r14
+	leaq	.LC0(%rip), %rax
+	cmove	%rax, %r14
+	movq	%r14, %rdi
+	call	sv_from_string@PLT
+.LVL144:
+	movq	%rdx, 40(%rsp)
+	.loc 1 357 3 is_stmt 1 view .LVU416
+	.loc 1 356 38 is_stmt 0 view .LVU417
+	movq	%rax, 32(%rsp)
+	.loc 1 357 6 view .LVU418
+	cmpq	$0, 40(%rsp)
+	jne	.L137
+.L115:
+	.loc 1 364 3 is_stmt 1 view .LVU419
+	.loc 1 364 6 is_stmt 0 view .LVU420
+	testq	%r15, %r15
+	je	.L138
+	.loc 1 365 12 view .LVU421
+	movl	$1, %eax
+	jmp	.L107
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	.loc 1 368 3 is_stmt 1 view .LVU422
+	.loc 1 369 3 view .LVU423
+	.loc 1 369 12 is_stmt 0 view .LVU424
+	leaq	parallel_serialize_work(%rip), %rax
+	movq	%rax, 48(%rsp)
+	.loc 1 370 3 is_stmt 1 view .LVU425
+	.loc 1 372 17 is_stmt 0 view .LVU426
+	movq	16(%rsp), %rax
+	.loc 1 374 17 view .LVU427
+	vmovdqa	32(%rsp), %xmm0
+	.loc 1 372 17 view .LVU428
+	movq	%rax, 136(%rsp)
+	.loc 1 373 15 view .LVU429
+	movq	24(%rsp), %rax
+	.loc 1 376 7 view .LVU430
+	movq	8(%rsp), %rsi
+	.loc 1 373 15 view .LVU431
+	movq	%rax, 112(%rsp)
+	.loc 1 375 17 view .LVU432
+	movq	(%r12), %rax
+	.loc 1 376 7 view .LVU433
+	leaq	48(%rsp), %rdi
+	movq	%rbx, %rdx
+	.loc 1 370 13 view .LVU434
+	movq	%rbp, 120(%rsp)
+	.loc 1 371 3 is_stmt 1 view .LVU435
+	.loc 1 371 18 is_stmt 0 view .LVU436
+	movq	%r13, 128(%rsp)
+	.loc 1 372 3 is_stmt 1 view .LVU437
+	.loc 1 373 3 view .LVU438
+	.loc 1 374 3 view .LVU439
+	.loc 1 375 17 is_stmt 0 view .LVU440
+	movq	%rax, 160(%rsp)
+	.loc 1 374 17 view .LVU441
+	vmovdqa	%xmm0, 144(%rsp)
+	.loc 1 375 3 is_stmt 1 view .LVU442
+	.loc 1 376 3 view .LVU443
+	.loc 1 376 7 is_stmt 0 view .LVU444
+	call	parallel_run
+.LVL145:
+	.loc 1 376 6 view .LVU445
+	testl	%eax, %eax
+	je	.L113
+	.loc 1 380 3 is_stmt 1 view .LVU446
+	.loc 1 380 36 is_stmt 0 view .LVU447
+	movq	%rbx, %rdi
+	salq	$5, %rdi
+	subq	$16, %rdi
+	call	malloc@PLT
+.LVL146:
+	.loc 1 380 18 view .LVU448
+	movq	%rax, 16(%r12)
+	.loc 1 381 3 is_stmt 1 view .LVU449
+	.loc 1 380 36 is_stmt 0 view .LVU450
+	movq	%rax, %r9
+	.loc 1 381 6 view .LVU451
+	testq	%rax, %rax
+	je	.L113
+	movq	24(%r12), %rcx
+.LBB40:
+	.loc 1 385 31 view .LVU452
+	movq	152(%rsp), %rdx
+	movq	%rcx, %rsi
+	salq	$4, %rsi
+	.loc 1 386 76 view .LVU453
+	movq	144(%rsp), %r11
+	movq	32(%r12), %rax
+	.loc 1 390 62 view .LVU454
+	movq	(%r12), %rdi
+	addq	%r9, %rsi
+	testq	%rdx, %rdx
+	je	.L121
+.LVL147:
+	.loc 1 385 5 is_stmt 1 view .LVU455
+	.loc 1 390 5 view .LVU456
+	.loc 1 390 76 is_stmt 0 view .LVU457
+	movq	(%rdi), %r8
+	.loc 1 391 40 view .LVU458
+	incq	%rcx
+	.loc 1 390 51 view .LVU459
+	movq	(%r8), %r8
+	movq	%r8, (%rsi)
+	.loc 1 391 5 is_stmt 1 view .LVU460
+	.loc 1 391 77 is_stmt 0 view .LVU461
+	movq	(%rdi), %r8
+	movq	16(%r8), %r8
+	.loc 1 391 52 view .LVU462
+	movq	%r8, 8(%rsi)
+	.loc 1 392 5 is_stmt 1 view .LVU463
+	.loc 1 392 23 is_stmt 0 view .LVU464
+	addq	%r8, %rax
+	.loc 1 384 35 is_stmt 1 view .LVU465
+.LVL148:
+	.loc 1 384 24 view .LVU466
+	cmpq	$1, %rbx
+	jbe	.L123
+	.loc 1 384 35 is_stmt 0 view .LVU467
+	movl	$1, %r8d
+.LVL149:
+.L124:
+	.loc 1 385 5 is_stmt 1 view .LVU468
+	.loc 1 386 21 is_stmt 0 view .LVU469
+	movq	%rcx, %rsi
+	salq	$4, %rsi
+	addq	%r9, %rsi
+	.loc 1 386 7 is_stmt 1 view .LVU470
+	.loc 1 386 53 is_stmt 0 view .LVU471
+	movq	%r11, (%rsi)
+	.loc 1 387 7 is_stmt 1 view .LVU472
+	.loc 1 387 54 is_stmt 0 view .LVU473
+	movq	%rdx, 8(%rsi)
+	.loc 1 388 7 is_stmt 1 view .LVU474
+	.loc 1 390 5 view .LVU475
+	.loc 1 387 42 is_stmt 0 view .LVU476
+	leaq	1(%rcx), %rsi
+	.loc 1 390 76 view .LVU477
+	movq	(%rdi,%r8,8), %rbp
+	.loc 1 390 19 view .LVU478
+	salq	$4, %rsi
+	.loc 1 390 51 view .LVU479
+	movq	0(%rbp), %rbp
+	.loc 1 390 19 view .LVU480
+	addq	%r9, %rsi
+	.loc 1 390 51 view .LVU481
+	movq	%rbp, (%rsi)
+	.loc 1 391 5 is_stmt 1 view .LVU482
+	.loc 1 388 25 is_stmt 0 view .LVU483
+	addq	%rdx, %rax
+	.loc 1 391 40 view .LVU484
+	addq	$2, %rcx
+	.loc 1 391 77 view .LVU485
+	movq	(%rdi,%r8,8), %rbp
+	.loc 1 384 35 view .LVU486
+	incq	%r8
+.LVL150:
+	.loc 1 391 77 view .LVU487
+	movq	16(%rbp), %rbp
+	.loc 1 391 52 view .LVU488
+	movq	%rbp, 8(%rsi)
+	.loc 1 392 5 is_stmt 1 view .LVU489
+	.loc 1 392 23 is_stmt 0 view .LVU490
+	addq	%rbp, %rax
+	.loc 1 384 35 is_stmt 1 view .LVU491
+.LVL151:
+	.loc 1 384 24 view .LVU492
+	cmpq	%rbx, %r8
+	jb	.L124
+	jmp	.L123
+.LVL152:
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	.loc 1 385 5 view .LVU493
+	.loc 1 390 5 view .LVU494
+	.loc 1 390 76 is_stmt 0 view .LVU495
+	movq	(%rdi,%rdx,8), %r8
+	.loc 1 384 24 view .LVU496
+	addq	$16, %rsi
+	.loc 1 390 76 view .LVU497
+	movq	(%r8), %r8
+	.loc 1 390 51 view .LVU498
+	movq	%r8, -16(%rsi)
+	.loc 1 391 5 is_stmt 1 view .LVU499
+	.loc 1 391 77 is_stmt 0 view .LVU500
+	movq	(%rdi,%rdx,8), %r8
+	.loc 1 384 35 view .LVU501
+	incq	%rdx
+.LVL153:
+	.loc 1 391 77 view .LVU502
+	movq	16(%r8), %r8
+	.loc 1 391 52 view .LVU503
+	movq	%r8, -8(%rsi)
+	.loc 1 392 5 is_stmt 1 view .LVU504
+	.loc 1 392 23 is_stmt 0 view .LVU505
+	addq	%r8, %rax
+	.loc 1 384 35 is_stmt 1 view .LVU506
+.LVL154:
+	.loc 1 384 24 view .LVU507
+	cmpq	%rbx, %rdx
+	jb	.L121
+	.loc 1 391 40 is_stmt 0 view .LVU508
+	addq	%rbx, %rcx
+.LVL155:
+.L123:
+	.loc 1 391 40 view .LVU509
+	movq	%rax, 32(%r12)
+	movq	%rcx, 24(%r12)
+.LBE40:
+	.loc 1 365 12 view .LVU510
+	movl	$1, %eax
+	jmp	.L107
+.LVL156:
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	.loc 1 358 5 is_stmt 1 view .LVU511
+	.loc 1 358 28 is_stmt 0 view .LVU512
+	leaq	32(%rsp), %rdi
+	call	sv_to_string@PLT
+.LVL157:
+	.loc 1 358 26 view .LVU513
+	movq	%rax, 40(%r12)
+	.loc 1 359 5 is_stmt 1 view .LVU514
+	.loc 1 359 8 is_stmt 0 view .LVU515
+	testq	%rax, %rax
+	je	.L113
+	.loc 1 362 5 is_stmt 1 view .LVU516
+	.loc 1 362 24 is_stmt 0 view .LVU517
+	movq	%rax, 32(%rsp)
+	jmp	.L115
+.L136:
+	.loc 1 352 5 is_stmt 1 view .LVU518
+	.loc 1 352 22 is_stmt 0 view .LVU519
+	xorl	%eax, %eax
+	movq	%rax, 8(%r12)
+	.loc 1 353 5 is_stmt 1 view .LVU520
+	.p2align 4,,10
+	.p2align 3
+.L113:
+	.loc 1 353 12 is_stmt 0 view .LVU521
+	xorl	%eax, %eax
+.LVL158:
+.L107:
+	.loc 1 395 1 view .LVU522
+	addq	$184, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL159:
+	.loc 1 395 1 view .LVU523
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL160:
+	.loc 1 395 1 view .LVU524
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL161:
+	.loc 1 395 1 view .LVU525
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	st_parallel_serialize, .-st_parallel_serialize
+	.p2align 4
+	.globl	st_fragments_stitch
+	.type	st_fragments_stitch, @function
+st_fragments_stitch:
+.LVL162:
+.LFB34:
+	.loc 1 400 101 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 401 3 view .LVU527
+	.loc 1 400 101 is_stmt 0 view .LVU528
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 401 16 view .LVU529
+	movq	24(%rdi), %r14
+	.loc 1 401 6 view .LVU530
+	testq	%r14, %r14
+	jne	.L140
+	.loc 1 402 5 is_stmt 1 view .LVU531
+	.loc 1 402 29 is_stmt 0 view .LVU532
+	cmpq	$0, 8(%rdi)
+	sete	%bpl
+	movzbl	%bpl, %ebp
+.LVL163:
+.L139:
+	.loc 1 416 1 view .LVU533
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movl	%ebp, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL164:
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	.cfi_restore_state
+	.loc 1 405 51 view .LVU534
+	movq	%r14, %r12
+	salq	$4, %r12
+	movq	%r12, %rdi
+.LVL165:
+	.loc 1 405 51 view .LVU535
+	movq	%rsi, %r13
+	.loc 1 405 3 is_stmt 1 view .LVU536
+	.loc 1 405 51 is_stmt 0 view .LVU537
+	call	malloc@PLT
+.LVL166:
+	.loc 1 405 51 view .LVU538
+	movq	%rax, %rbx
+.LVL167:
+	.loc 1 406 3 is_stmt 1 view .LVU539
+	.loc 1 406 6 is_stmt 0 view .LVU540
+	testq	%rax, %rax
+	je	.L143
+.LBB41:
+	.loc 1 410 43 view .LVU541
+	movq	16(%rbp), %rdx
+	xorl	%eax, %eax
+.LVL168:
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	.loc 1 410 5 is_stmt 1 discriminator 3 view .LVU542
+	.loc 1 410 51 is_stmt 0 discriminator 3 view .LVU543
+	movq	(%rdx,%rax), %rcx
+	.loc 1 410 18 discriminator 3 view .LVU544
+	movq	%rcx, (%rbx,%rax)
+	.loc 1 411 5 is_stmt 1 discriminator 3 view .LVU545
+	.loc 1 411 37 is_stmt 0 discriminator 3 view .LVU546
+	movq	8(%rdx,%rax), %rcx
+	.loc 1 411 18 discriminator 3 view .LVU547
+	movq	%rcx, 8(%rbx,%rax)
+	.loc 1 409 49 is_stmt 1 discriminator 3 view .LVU548
+	.loc 1 409 24 discriminator 3 view .LVU549
+	addq	$16, %rax
+	cmpq	%rax, %r12
+	jne	.L142
+.LBE41:
+	.loc 1 413 3 view .LVU550
+	.loc 1 413 18 is_stmt 0 view .LVU551
+	movq	%r14, %rdx
+	movq	%rbx, %rsi
+	movq	%r13, %rdi
+	call	st_append_many@PLT
+.LVL169:
+	.loc 1 414 3 view .LVU552
+	movq	%rbx, %rdi
+	.loc 1 413 18 view .LVU553
+	movl	%eax, %ebp
+.LVL170:
+	.loc 1 414 3 is_stmt 1 view .LVU554
+	call	free@PLT
+.LVL171:
+	.loc 1 415 3 view .LVU555
+	.loc 1 416 1 is_stmt 0 view .LVU556
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+.LVL172:
+	.loc 1 416 1 view .LVU557
+	movl	%ebp, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL173:
+	.loc 1 416 1 view .LVU558
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL174:
+	.loc 1 416 1 view .LVU559
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL175:
+.L143:
+	.cfi_restore_state
+	.loc 1 407 12 view .LVU560
+	xorl	%ebp, %ebp
+.LVL176:
+	.loc 1 407 12 view .LVU561
+	jmp	.L139
+	.cfi_endproc
+.LFE34:
+	.size	st_fragments_stitch, .-st_fragments_stitch
+	.p2align 4
+	.globl	st_fragments_free
+	.type	st_fragments_free, @function
+st_fragments_free:
+.LVL177:
+.LFB35:
+	.loc 1 421 59 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 422 3 view .LVU563
+.LBB42:
+	.loc 1 422 8 view .LVU564
+	.loc 1 422 24 view .LVU565
+.LBE42:
+	.loc 1 421 59 is_stmt 0 view .LVU566
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LBB43:
+	.loc 1 422 24 view .LVU567
+	cmpq	$0, 8(%rdi)
+	je	.L147
+	.loc 1 422 15 view .LVU568
+	xorl	%ebx, %ebx
+.LVL178:
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU569
+	movq	0(%rbp), %rax
+	movq	(%rax,%rbx,8), %rdi
+	.loc 1 422 45 is_stmt 0 discriminator 3 view .LVU570
+	incq	%rbx
+.LVL179:
+	.loc 1 423 5 discriminator 3 view .LVU571
+	call	st_destroy@PLT
+.LVL180:
+	.loc 1 422 45 is_stmt 1 discriminator 3 view .LVU572
+	.loc 1 422 24 discriminator 3 view .LVU573
+	cmpq	8(%rbp), %rbx
+	jb	.L148
+.LVL181:
+.L147:
+	.loc 1 422 24 is_stmt 0 discriminator 3 view .LVU574
+.LBE43:
+	.loc 1 425 3 is_stmt 1 view .LVU575
+	movq	0(%rbp), %rdi
+	call	free@PLT
+.LVL182:
+	.loc 1 426 3 view .LVU576
+	movq	16(%rbp), %rdi
+	call	free@PLT
+.LVL183:
+	.loc 1 427 3 view .LVU577
+	movq	40(%rbp), %rdi
+	call	free@PLT
+.LVL184:
+	.loc 1 428 3 view .LVU578
+	.loc 1 428 24 is_stmt 0 view .LVU579
+	movq	$0, 0(%rbp)
+	.loc 1 429 3 is_stmt 1 view .LVU580
+	.loc 1 429 18 is_stmt 0 view .LVU581
+	movq	$0, 16(%rbp)
+	.loc 1 430 3 is_stmt 1 view .LVU582
+	.loc 1 430 24 is_stmt 0 view .LVU583
+	movq	$0, 40(%rbp)
+	.loc 1 431 3 is_stmt 1 view .LVU584
+	.loc 1 431 20 is_stmt 0 view .LVU585
+	movq	$0, 8(%rbp)
+	.loc 1 432 3 is_stmt 1 view .LVU586
+	.loc 1 432 24 is_stmt 0 view .LVU587
+	movq	$0, 24(%rbp)
+	.loc 1 433 3 is_stmt 1 view .LVU588
+	.loc 1 433 21 is_stmt 0 view .LVU589
+	movq	$0, 32(%rbp)
+	.loc 1 434 1 view .LVU590
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL185:
+	.loc 1 434 1 view .LVU591
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	st_fragments_free, .-st_fragments_free
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 9 "/root/repo/src/../include/strutils.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.file 11 "/usr/include/pthread.h"
+	.file 12 "/usr/include/unistd.h"
+	.file 13 "/usr/include/stdlib.h"
+	.file 14 "/usr/include/string.h"
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1a0d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x31
+	.long	.LASF372
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0xe
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x10
+	.long	0x35
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0xe
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x33
+	.byte	0x8
+	.uleb128 0x1e
+	.long	0x8a
+	.uleb128 0xe
+	.long	.LASF12
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x4d
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x10
+	.long	0xa2
+	.uleb128 0xe
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x6c
+	.byte	0x13
+	.long	0x91
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF15
+	.uleb128 0x13
+	.long	.LASF19
+	.byte	0x10
+	.byte	0x5
+	.byte	0x33
+	.byte	0x10
+	.long	0xe9
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x35
+	.byte	0x23
+	.long	0xe9
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x36
+	.byte	0x23
+	.long	0xe9
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xc1
+	.uleb128 0xe
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x37
+	.byte	0x3
+	.long	0xc1
+	.uleb128 0x13
+	.long	.LASF20
+	.byte	0x28
+	.byte	0x6
+	.byte	0x16
+	.byte	0x8
+	.long	0x170
+	.uleb128 0x6
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x18
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF22
+	.byte	0x6
+	.byte	0x19
+	.byte	0x10
+	.long	0x69
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF23
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF24
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x10
+	.long	0x69
+	.byte	0xc
+	.uleb128 0x6
+	.long	.LASF25
+	.byte	0x6
+	.byte	0x20
+	.byte	0x7
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9
+	.long	0x77
+	.byte	0x14
+	.uleb128 0x6
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x23
+	.byte	0x9
+	.long	0x77
+	.byte	0x16
+	.uleb128 0x6
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x24
+	.byte	0x14
+	.long	0xee
+	.byte	0x18
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF29
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x20
+	.long	0x19a
+	.uleb128 0x11
+	.long	.LASF30
+	.byte	0x22
+	.byte	0x8
+	.long	0x19a
+	.uleb128 0x11
+	.long	.LASF31
+	.byte	0x23
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1a
+	.long	0xa2
+	.long	0x1aa
+	.uleb128 0x1b
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF32
+	.byte	0x7
+	.byte	0x24
+	.byte	0x3
+	.long	0x17c
+	.uleb128 0x10
+	.long	0x1aa
+	.uleb128 0x34
+	.long	.LASF33
+	.byte	0x38
+	.byte	0x7
+	.byte	0x38
+	.byte	0x7
+	.long	0x1df
+	.uleb128 0x11
+	.long	.LASF30
+	.byte	0x3a
+	.byte	0x8
+	.long	0x1df
+	.uleb128 0x11
+	.long	.LASF31
+	.byte	0x3b
+	.byte	0xc
+	.long	0x4d
+	.byte	0
+	.uleb128 0x1a
+	.long	0xa2
+	.long	0x1ef
+	.uleb128 0x1b
+	.long	0x2e
+	.byte	0x37
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF33
+	.byte	0x7
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x1bb
+	.uleb128 0x10
+	.long	0x1ef
+	.uleb128 0x22
+	.byte	0x28
+	.byte	0x43
+	.long	0x229
+	.uleb128 0x11
+	.long	.LASF34
+	.byte	0x45
+	.byte	0x1c
+	.long	0xfa
+	.uleb128 0x11
+	.long	.LASF30
+	.byte	0x46
+	.byte	0x8
+	.long	0x229
+	.uleb128 0x11
+	.long	.LASF31
+	.byte	0x47
+	.byte	0xc
+	.long	0x4d
+	.byte	0
+	.uleb128 0x1a
+	.long	0xa2
+	.long	0x239
+	.uleb128 0x1b
+	.long	0x2e
+	.byte	0x27
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF35
+	.byte	0x7
+	.byte	0x48
+	.byte	0x3
+	.long	0x200
+	.uleb128 0x5
+	.long	0x24a
+	.uleb128 0x35
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x36
+	.byte	0x7
+	.byte	0x4
+	.long	0x69
+	.byte	0xf
+	.byte	0x48
+	.byte	0x3
+	.long	0x775
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF89
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF98
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF100
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF101
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF102
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF103
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF104
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF105
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0x49
+	.uleb128 0x1
+	.long	.LASF111
+	.byte	0x4a
+	.uleb128 0x1
+	.long	.LASF112
+	.byte	0x4b
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0x4d
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF121
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF122
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF123
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF124
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF125
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF126
+	.byte	0x59
+	.uleb128 0x1
+	.long	.LASF127
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF128
+	.byte	0x5b
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0x5d
+	.uleb128 0x1
+	.long	.LASF131
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0x5f
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0x61
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0x63
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0x69
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0x6a
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0x6b
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0x6d
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0x6e
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0x6f
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0x71
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0x72
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0x73
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0x75
+	.uleb128 0x1
+	.long	.LASF155
+	.byte	0x76
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0x77
+	.uleb128 0x1
+	.long	.LASF157
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0x79
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0x7a
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0x7b
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0x7c
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0x7d
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x7e
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0x7f
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0x81
+	.uleb128 0x1
+	.long	.LASF167
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF168
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF169
+	.byte	0x84
+	.uleb128 0x1
+	.long	.LASF170
+	.byte	0x85
+	.uleb128 0x1
+	.long	.LASF171
+	.byte	0x86
+	.uleb128 0x1
+	.long	.LASF172
+	.byte	0x87
+	.uleb128 0x1
+	.long	.LASF173
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF174
+	.byte	0x89
+	.uleb128 0x1
+	.long	.LASF175
+	.byte	0x8a
+	.uleb128 0x1
+	.long	.LASF176
+	.byte	0x8b
+	.uleb128 0x1
+	.long	.LASF177
+	.byte	0x8c
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x8d
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x8e
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x8f
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x91
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x92
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x93
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x94
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x95
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x96
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x97
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0x99
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x9a
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0x9b
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x9c
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0x9d
+	.uleb128 0x1
+	.long	.LASF195
+	.byte	0x9e
+	.uleb128 0x1
+	.long	.LASF196
+	.byte	0x9f
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF198
+	.byte	0xa1
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0xa2
+	.uleb128 0x1
+	.long	.LASF200
+	.byte	0xa3
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF202
+	.byte	0xa5
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0xa6
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0xa7
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF206
+	.byte	0xa9
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0xaa
+	.uleb128 0x1
+	.long	.LASF208
+	.byte	0xab
+	.uleb128 0x1
+	.long	.LASF209
+	.byte	0xac
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0xad
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0xae
+	.uleb128 0x1
+	.long	.LASF212
+	.byte	0xaf
+	.uleb128 0x1
+	.long	.LASF213
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0xb1
+	.uleb128 0x1
+	.long	.LASF215
+	.byte	0xb2
+	.uleb128 0x1
+	.long	.LASF216
+	.byte	0xb3
+	.uleb128 0x1
+	.long	.LASF217
+	.byte	0xb4
+	.uleb128 0x1
+	.long	.LASF218
+	.byte	0xb5
+	.uleb128 0x1
+	.long	.LASF219
+	.byte	0xb6
+	.uleb128 0x1
+	.long	.LASF220
+	.byte	0xb7
+	.uleb128 0x1
+	.long	.LASF221
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF222
+	.byte	0xb9
+	.uleb128 0x1
+	.long	.LASF223
+	.byte	0xba
+	.uleb128 0x1
+	.long	.LASF224
+	.byte	0xbb
+	.uleb128 0x1
+	.long	.LASF225
+	.byte	0xbc
+	.uleb128 0x1
+	.long	.LASF226
+	.byte	0xbd
+	.uleb128 0x1
+	.long	.LASF227
+	.byte	0xbe
+	.uleb128 0x1
+	.long	.LASF228
+	.byte	0xbf
+	.uleb128 0x1
+	.long	.LASF229
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF230
+	.byte	0xc1
+	.uleb128 0x1
+	.long	.LASF231
+	.byte	0xc2
+	.uleb128 0x1
+	.long	.LASF232
+	.byte	0xc3
+	.uleb128 0x1
+	.long	.LASF233
+	.byte	0xc4
+	.uleb128 0x1
+	.long	.LASF234
+	.byte	0xc5
+	.uleb128 0x1
+	.long	.LASF235
+	.byte	0xc6
+	.uleb128 0x1
+	.long	.LASF236
+	.byte	0xc7
+	.uleb128 0x1
+	.long	.LASF237
+	.byte	0xeb
+	.uleb128 0x1
+	.long	.LASF238
+	.byte	0xec
+	.uleb128 0x1
+	.long	.LASF239
+	.byte	0xed
+	.uleb128 0x1
+	.long	.LASF240
+	.byte	0xee
+	.uleb128 0x1
+	.long	.LASF241
+	.byte	0xef
+	.uleb128 0x1
+	.long	.LASF242
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF243
+	.byte	0xf1
+	.uleb128 0x1
+	.long	.LASF244
+	.byte	0xf2
+	.uleb128 0x1
+	.long	.LASF245
+	.byte	0xf3
+	.uleb128 0x1
+	.long	.LASF246
+	.byte	0xf4
+	.uleb128 0x1
+	.long	.LASF247
+	.byte	0xf5
+	.uleb128 0x1
+	.long	.LASF248
+	.byte	0xf6
+	.uleb128 0x1
+	.long	.LASF249
+	.byte	0xf7
+	.uleb128 0x1
+	.long	.LASF250
+	.byte	0xf8
+	.uleb128 0x1
+	.long	.LASF251
+	.byte	0xf9
+	.uleb128 0x1
+	.long	.LASF252
+	.byte	0xfa
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF253
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x13
+	.long	.LASF254
+	.byte	0x10
+	.byte	0x9
+	.byte	0xd
+	.byte	0x8
+	.long	0x7a9
+	.uleb128 0x16
+	.string	"ptr"
+	.byte	0x9
+	.byte	0x12
+	.byte	0xf
+	.long	0x24b
+	.byte	0
+	.uleb128 0x16
+	.string	"len"
+	.byte	0x9
+	.byte	0x17
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.long	0x781
+	.uleb128 0x14
+	.long	.LASF255
+	.byte	0x18
+	.value	0x175
+	.long	0x7e2
+	.uleb128 0x4
+	.long	.LASF256
+	.value	0x17a
+	.byte	0x1c
+	.long	0x7e7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF257
+	.value	0x17f
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF258
+	.value	0x184
+	.byte	0xa
+	.long	0x35
+	.byte	0x10
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF373
+	.uleb128 0x5
+	.long	0x7e2
+	.uleb128 0xb
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF259
+	.uleb128 0x14
+	.long	.LASF260
+	.byte	0x40
+	.value	0x1e6
+	.long	0x868
+	.uleb128 0x4
+	.long	.LASF261
+	.value	0x1eb
+	.byte	0xc
+	.long	0x775
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF262
+	.value	0x1f0
+	.byte	0xc
+	.long	0x775
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF263
+	.value	0x1f5
+	.byte	0xc
+	.long	0x775
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF264
+	.value	0x1fa
+	.byte	0xc
+	.long	0x775
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF265
+	.value	0x1ff
+	.byte	0xc
+	.long	0x775
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF266
+	.value	0x204
+	.byte	0xc
+	.long	0x775
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF267
+	.value	0x209
+	.byte	0xc
+	.long	0x775
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF268
+	.value	0x20e
+	.byte	0xc
+	.long	0x775
+	.byte	0x38
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF269
+	.byte	0x38
+	.value	0x26c
+	.long	0x8dc
+	.uleb128 0x4
+	.long	.LASF270
+	.value	0x272
+	.byte	0xd
+	.long	0x8f5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF271
+	.value	0x277
+	.byte	0x9
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x1f
+	.string	"fd"
+	.value	0x27c
+	.byte	0x7
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF272
+	.value	0x281
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF273
+	.value	0x286
+	.byte	0xa
+	.long	0x35
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF274
+	.value	0x28b
+	.byte	0xa
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x1f
+	.string	"eof"
+	.value	0x290
+	.byte	0x7
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF275
+	.value	0x295
+	.byte	0x7
+	.long	0x46
+	.byte	0x34
+	.byte	0
+	.uleb128 0x15
+	.long	0xae
+	.long	0x8f5
+	.uleb128 0x2
+	.long	0x8a
+	.uleb128 0x2
+	.long	0x9d
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x5
+	.long	0x8dc
+	.uleb128 0x23
+	.long	.LASF278
+	.long	0x69
+	.value	0x29b
+	.long	0x916
+	.uleb128 0x1
+	.long	.LASF276
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF277
+	.byte	0x1
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF279
+	.long	0x69
+	.value	0x2b5
+	.long	0x93e
+	.uleb128 0x1
+	.long	.LASF280
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF281
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF282
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF283
+	.byte	0x3
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF284
+	.value	0x158
+	.byte	0x9
+	.value	0x2cf
+	.byte	0x8
+	.long	0x9ec
+	.uleb128 0x4
+	.long	.LASF285
+	.value	0x2d4
+	.byte	0x9
+	.long	0x9d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF286
+	.value	0x2d9
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF287
+	.value	0x2de
+	.byte	0xa
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF288
+	.value	0x2e3
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF289
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x8fa
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF290
+	.value	0x2ed
+	.byte	0xa
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF291
+	.value	0x2f2
+	.byte	0x18
+	.long	0x9ec
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF292
+	.value	0x2f7
+	.byte	0x18
+	.long	0x916
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF293
+	.value	0x2fc
+	.byte	0x17
+	.long	0x9f1
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF294
+	.value	0x301
+	.byte	0x8
+	.long	0x9f6
+	.byte	0x48
+	.uleb128 0x24
+	.long	.LASF295
+	.value	0x306
+	.byte	0x21
+	.long	0xa54
+	.value	0x148
+	.uleb128 0x24
+	.long	.LASF296
+	.value	0x30b
+	.byte	0x17
+	.long	0xa59
+	.value	0x150
+	.byte	0
+	.uleb128 0x5
+	.long	0x868
+	.uleb128 0x5
+	.long	0x7ae
+	.uleb128 0x1a
+	.long	0xa2
+	.long	0xa06
+	.uleb128 0x1b
+	.long	0x2e
+	.byte	0xff
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF297
+	.byte	0x28
+	.value	0x764
+	.long	0xa54
+	.uleb128 0x4
+	.long	.LASF298
+	.value	0x769
+	.byte	0xb
+	.long	0xa6a
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF299
+	.value	0x76e
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF300
+	.value	0x774
+	.byte	0xd
+	.long	0xa6f
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF286
+	.value	0x779
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF301
+	.value	0x77e
+	.byte	0xa
+	.long	0x35
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0xa06
+	.uleb128 0x5
+	.long	0x7f3
+	.uleb128 0x5
+	.long	0x7a9
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF302
+	.uleb128 0x5
+	.long	0x35
+	.uleb128 0x5
+	.long	0x775
+	.uleb128 0x13
+	.long	.LASF303
+	.byte	0x10
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x8
+	.long	0xa9c
+	.uleb128 0x6
+	.long	.LASF304
+	.byte	0xa
+	.byte	0x1c
+	.byte	0xb
+	.long	0x8a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF305
+	.byte	0xa
+	.byte	0x1d
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF306
+	.byte	0x10
+	.value	0x7da
+	.long	0xac3
+	.uleb128 0x4
+	.long	.LASF307
+	.value	0x7e0
+	.byte	0x9
+	.long	0xaeb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF308
+	.value	0x7e6
+	.byte	0x9
+	.long	0xb04
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.long	0xa9c
+	.uleb128 0x15
+	.long	0x46
+	.long	0xae1
+	.uleb128 0x2
+	.long	0x8a
+	.uleb128 0x2
+	.long	0xae1
+	.uleb128 0x2
+	.long	0xae6
+	.byte	0
+	.uleb128 0x5
+	.long	0x93e
+	.uleb128 0x5
+	.long	0x8a
+	.uleb128 0x5
+	.long	0xac8
+	.uleb128 0x15
+	.long	0x46
+	.long	0xb04
+	.uleb128 0x2
+	.long	0x8a
+	.uleb128 0x2
+	.long	0x8a
+	.byte	0
+	.uleb128 0x5
+	.long	0xaf0
+	.uleb128 0x14
+	.long	.LASF309
+	.byte	0x30
+	.value	0x807
+	.long	0xb64
+	.uleb128 0x4
+	.long	.LASF310
+	.value	0x80c
+	.byte	0x1c
+	.long	0xb69
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF299
+	.value	0x811
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x1f
+	.string	"iov"
+	.value	0x816
+	.byte	0x11
+	.long	0xb6e
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF311
+	.value	0x81b
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF286
+	.value	0x820
+	.byte	0xa
+	.long	0x35
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF312
+	.value	0x825
+	.byte	0x9
+	.long	0x9d
+	.byte	0x28
+	.byte	0
+	.uleb128 0x10
+	.long	0xb09
+	.uleb128 0x5
+	.long	0xae1
+	.uleb128 0x5
+	.long	0xa74
+	.uleb128 0x13
+	.long	.LASF313
+	.byte	0x58
+	.byte	0x1
+	.byte	0xc
+	.byte	0x8
+	.long	0xbdb
+	.uleb128 0x6
+	.long	.LASF314
+	.byte	0x1
+	.byte	0x11
+	.byte	0x13
+	.long	0x239
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF315
+	.byte	0x1
+	.byte	0x16
+	.byte	0xa
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x16
+	.string	"end"
+	.byte	0x1
+	.byte	0x1b
+	.byte	0xa
+	.long	0x35
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF316
+	.byte	0x1
+	.byte	0x20
+	.byte	0xd
+	.long	0x170
+	.byte	0x38
+	.uleb128 0x16
+	.string	"id"
+	.byte	0x1
+	.byte	0x25
+	.byte	0xa
+	.long	0x35
+	.byte	0x40
+	.uleb128 0x16
+	.string	"job"
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x17
+	.long	0xc9f
+	.byte	0x48
+	.uleb128 0x6
+	.long	.LASF317
+	.byte	0x1
+	.byte	0x2f
+	.byte	0x1b
+	.long	0xae1
+	.byte	0x50
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF318
+	.byte	0x78
+	.byte	0x1
+	.byte	0x35
+	.byte	0x8
+	.long	0xc9f
+	.uleb128 0x6
+	.long	.LASF319
+	.byte	0x1
+	.byte	0x3a
+	.byte	0x9
+	.long	0xcc2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF320
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x1a
+	.long	0xcbd
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF299
+	.byte	0x1
+	.byte	0x44
+	.byte	0xa
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF321
+	.byte	0x1
+	.byte	0x49
+	.byte	0x7
+	.long	0x46
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF285
+	.byte	0x1
+	.byte	0x4e
+	.byte	0x9
+	.long	0x9d
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF322
+	.byte	0x1
+	.byte	0x53
+	.byte	0xb
+	.long	0xa6a
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF323
+	.byte	0x1
+	.byte	0x58
+	.byte	0xa
+	.long	0xae6
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF324
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x27
+	.long	0xcc7
+	.byte	0x38
+	.uleb128 0x6
+	.long	.LASF271
+	.byte	0x1
+	.byte	0x62
+	.byte	0x9
+	.long	0x8a
+	.byte	0x40
+	.uleb128 0x6
+	.long	.LASF325
+	.byte	0x1
+	.byte	0x67
+	.byte	0xa
+	.long	0x35
+	.byte	0x48
+	.uleb128 0x6
+	.long	.LASF326
+	.byte	0x1
+	.byte	0x6c
+	.byte	0xa
+	.long	0x35
+	.byte	0x50
+	.uleb128 0x6
+	.long	.LASF327
+	.byte	0x1
+	.byte	0x71
+	.byte	0x9
+	.long	0xce5
+	.byte	0x58
+	.uleb128 0x6
+	.long	.LASF312
+	.byte	0x1
+	.byte	0x76
+	.byte	0x15
+	.long	0x781
+	.byte	0x60
+	.uleb128 0x6
+	.long	.LASF310
+	.byte	0x1
+	.byte	0x7b
+	.byte	0x1c
+	.long	0xb69
+	.byte	0x70
+	.byte	0
+	.uleb128 0x5
+	.long	0xbdb
+	.uleb128 0x15
+	.long	0x46
+	.long	0xcbd
+	.uleb128 0x2
+	.long	0xc9f
+	.uleb128 0x2
+	.long	0xcbd
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x5
+	.long	0xb73
+	.uleb128 0x5
+	.long	0xca4
+	.uleb128 0x5
+	.long	0xac3
+	.uleb128 0x15
+	.long	0x46
+	.long	0xce5
+	.uleb128 0x2
+	.long	0x8a
+	.uleb128 0x2
+	.long	0xae1
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x5
+	.long	0xccc
+	.uleb128 0xc
+	.long	.LASF328
+	.byte	0x9
+	.value	0x546
+	.byte	0x5
+	.long	0x46
+	.long	0xd0b
+	.uleb128 0x2
+	.long	0xae1
+	.uleb128 0x2
+	.long	0xa5e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF329
+	.byte	0x9
+	.value	0x528
+	.byte	0x5
+	.long	0x46
+	.long	0xd2c
+	.uleb128 0x2
+	.long	0xae1
+	.uleb128 0x2
+	.long	0x24b
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF330
+	.byte	0x9
+	.value	0x353
+	.byte	0x19
+	.long	0xae1
+	.long	0xd43
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF331
+	.byte	0x9
+	.byte	0x54
+	.byte	0x7
+	.long	0x9d
+	.long	0xd59
+	.uleb128 0x2
+	.long	0xa5e
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF332
+	.byte	0x9
+	.byte	0x23
+	.byte	0x13
+	.long	0x781
+	.long	0xd6f
+	.uleb128 0x2
+	.long	0x24b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF333
+	.byte	0xb
+	.value	0x343
+	.byte	0xc
+	.long	0x46
+	.long	0xd86
+	.uleb128 0x2
+	.long	0xd86
+	.byte	0
+	.uleb128 0x5
+	.long	0x239
+	.uleb128 0xc
+	.long	.LASF334
+	.byte	0xb
+	.value	0x31a
+	.byte	0xc
+	.long	0x46
+	.long	0xda2
+	.uleb128 0x2
+	.long	0xd86
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF342
+	.byte	0x9
+	.value	0x403
+	.byte	0x6
+	.long	0xdb5
+	.uleb128 0x2
+	.long	0xae1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF335
+	.byte	0xb
+	.value	0x312
+	.byte	0xc
+	.long	0x46
+	.long	0xdcc
+	.uleb128 0x2
+	.long	0xd86
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF336
+	.byte	0xb
+	.byte	0xdb
+	.byte	0xc
+	.long	0x46
+	.long	0xde7
+	.uleb128 0x2
+	.long	0x170
+	.uleb128 0x2
+	.long	0xae6
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF337
+	.byte	0xb
+	.byte	0xca
+	.byte	0xc
+	.long	0x46
+	.long	0xe0c
+	.uleb128 0x2
+	.long	0xe11
+	.uleb128 0x2
+	.long	0xe1b
+	.uleb128 0x2
+	.long	0xe20
+	.uleb128 0x2
+	.long	0x8c
+	.byte	0
+	.uleb128 0x5
+	.long	0x170
+	.uleb128 0x1e
+	.long	0xe0c
+	.uleb128 0x5
+	.long	0x1fb
+	.uleb128 0x1e
+	.long	0xe16
+	.uleb128 0x5
+	.long	0xe25
+	.uleb128 0x15
+	.long	0x8a
+	.long	0xe34
+	.uleb128 0x2
+	.long	0x8a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF338
+	.byte	0xb
+	.value	0x30d
+	.byte	0xc
+	.long	0x46
+	.long	0xe50
+	.uleb128 0x2
+	.long	0xd86
+	.uleb128 0x2
+	.long	0xe50
+	.byte	0
+	.uleb128 0x5
+	.long	0x1b6
+	.uleb128 0xc
+	.long	.LASF339
+	.byte	0xc
+	.value	0x280
+	.byte	0x11
+	.long	0x4d
+	.long	0xe6c
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF340
+	.byte	0x9
+	.value	0x3cb
+	.byte	0x5
+	.long	0x46
+	.long	0xe8d
+	.uleb128 0x2
+	.long	0xae1
+	.uleb128 0x2
+	.long	0x9d
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF341
+	.byte	0x9
+	.value	0x326
+	.byte	0x19
+	.long	0xae1
+	.long	0xea9
+	.uleb128 0x2
+	.long	0x9d
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF343
+	.byte	0xd
+	.value	0x238
+	.byte	0xd
+	.long	0xebc
+	.uleb128 0x2
+	.long	0x8a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF344
+	.byte	0xd
+	.value	0x22c
+	.byte	0xe
+	.long	0x8a
+	.long	0xed8
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF345
+	.byte	0xe
+	.byte	0x6b
+	.byte	0xe
+	.long	0x8a
+	.long	0xef8
+	.uleb128 0x2
+	.long	0x245
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF346
+	.byte	0xd
+	.value	0x229
+	.byte	0xe
+	.long	0x8a
+	.long	0xf0f
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF374
+	.byte	0x1
+	.value	0x1a5
+	.byte	0x6
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf93
+	.uleb128 0x7
+	.long	.LASF310
+	.value	0x1a5
+	.byte	0x30
+	.long	0xf93
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0xf
+	.long	.LLRL71
+	.long	0xf6b
+	.uleb128 0x1c
+	.string	"i"
+	.value	0x1a6
+	.byte	0xf
+	.long	0x35
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x8
+	.quad	.LVL180
+	.long	0xda2
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL182
+	.long	0xea9
+	.uleb128 0x8
+	.quad	.LVL183
+	.long	0xea9
+	.uleb128 0x8
+	.quad	.LVL184
+	.long	0xea9
+	.byte	0
+	.uleb128 0x5
+	.long	0xb09
+	.uleb128 0x20
+	.long	.LASF349
+	.value	0x190
+	.long	0x46
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x107b
+	.uleb128 0x7
+	.long	.LASF310
+	.value	0x190
+	.byte	0x37
+	.long	0x107b
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x7
+	.long	.LASF317
+	.value	0x190
+	.byte	0x5a
+	.long	0xae1
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0xa
+	.long	.LASF347
+	.value	0x195
+	.byte	0x16
+	.long	0x1080
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0xa
+	.long	.LASF348
+	.value	0x19d
+	.byte	0x7
+	.long	0x46
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x21
+	.quad	.LBB41
+	.quad	.LBE41-.LBB41
+	.long	0x102a
+	.uleb128 0x3a
+	.string	"i"
+	.byte	0x1
+	.value	0x199
+	.byte	0xf
+	.long	0x35
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL166
+	.long	0xef8
+	.long	0x1042
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL169
+	.long	0xcea
+	.long	0x1066
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL171
+	.long	0xea9
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xb64
+	.uleb128 0x5
+	.long	0x781
+	.uleb128 0x20
+	.long	.LASF350
+	.value	0x154
+	.long	0x46
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1225
+	.uleb128 0x7
+	.long	.LASF310
+	.value	0x154
+	.byte	0x33
+	.long	0xf93
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x7
+	.long	.LASF299
+	.value	0x154
+	.byte	0x4b
+	.long	0x41
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x7
+	.long	.LASF351
+	.value	0x154
+	.byte	0x59
+	.long	0x35
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x7
+	.long	.LASF326
+	.value	0x154
+	.byte	0x69
+	.long	0x35
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x7
+	.long	.LASF327
+	.value	0x154
+	.byte	0x7b
+	.long	0xce5
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x7
+	.long	.LASF271
+	.value	0x154
+	.byte	0xcd
+	.long	0x8a
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x3b
+	.long	.LASF312
+	.byte	0x1
+	.value	0x154
+	.byte	0xe2
+	.long	0x24b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0xa
+	.long	.LASF352
+	.value	0x158
+	.byte	0xa
+	.long	0x35
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x3c
+	.long	.LASF353
+	.byte	0x1
+	.value	0x164
+	.byte	0x15
+	.long	0x781
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x26
+	.string	"job"
+	.value	0x170
+	.long	0xbdb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x21
+	.quad	.LBB40
+	.quad	.LBE40-.LBB40
+	.long	0x118a
+	.uleb128 0x1c
+	.string	"i"
+	.value	0x180
+	.byte	0xf
+	.long	0x35
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL143
+	.long	0xebc
+	.long	0x11b4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x31
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL144
+	.long	0xd59
+	.long	0x11cc
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL145
+	.long	0x160b
+	.long	0x11f3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL146
+	.long	0xef8
+	.long	0x120f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x35
+	.byte	0x24
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL157
+	.long	0xd43
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF364
+	.byte	0x1
+	.value	0x13c
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x132f
+	.uleb128 0x3e
+	.string	"job"
+	.byte	0x1
+	.value	0x13c
+	.byte	0x38
+	.long	0xc9f
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x7
+	.long	.LASF354
+	.value	0x13c
+	.byte	0x54
+	.long	0xcbd
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x7
+	.long	.LASF355
+	.value	0x13c
+	.byte	0x69
+	.long	0x41
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xa
+	.long	.LASF317
+	.value	0x13f
+	.byte	0x1b
+	.long	0xae1
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0xa
+	.long	.LASF356
+	.value	0x144
+	.byte	0xa
+	.long	0x35
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xa
+	.long	.LASF357
+	.value	0x145
+	.byte	0xa
+	.long	0x35
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x21
+	.quad	.LBB32
+	.quad	.LBE32-.LBB32
+	.long	0x1319
+	.uleb128 0xa
+	.long	.LASF358
+	.value	0x146
+	.byte	0xf
+	.long	0x35
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x27
+	.quad	.LVL92
+	.long	0x1304
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL94
+	.long	0xd0b
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL86
+	.long	0xd2c
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF359
+	.value	0x108
+	.long	0x46
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x156f
+	.uleb128 0x7
+	.long	.LASF285
+	.value	0x108
+	.byte	0x1d
+	.long	0x9d
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x7
+	.long	.LASF286
+	.value	0x108
+	.byte	0x32
+	.long	0x41
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x7
+	.long	.LASF351
+	.value	0x108
+	.byte	0x41
+	.long	0x35
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x7
+	.long	.LASF272
+	.value	0x108
+	.byte	0x51
+	.long	0x35
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x7
+	.long	.LASF324
+	.value	0x108
+	.byte	0x81
+	.long	0xcc7
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x7
+	.long	.LASF271
+	.value	0x108
+	.byte	0x90
+	.long	0x8a
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0xa
+	.long	.LASF273
+	.value	0x110
+	.byte	0xa
+	.long	0x35
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0xa
+	.long	.LASF322
+	.value	0x111
+	.byte	0xb
+	.long	0xa6a
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0xa
+	.long	.LASF352
+	.value	0x115
+	.byte	0xa
+	.long	0x35
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0xa
+	.long	.LASF360
+	.value	0x116
+	.byte	0xa
+	.long	0x35
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x26
+	.string	"job"
+	.value	0x121
+	.long	0xbdb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0xa
+	.long	.LASF361
+	.value	0x12c
+	.byte	0x7
+	.long	0x46
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0xa
+	.long	.LASF362
+	.value	0x12e
+	.byte	0x7
+	.long	0x46
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0xf
+	.long	.LLRL52
+	.long	0x149a
+	.uleb128 0x1c
+	.string	"end"
+	.value	0x119
+	.byte	0xc
+	.long	0x35
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x28
+	.long	.LLRL54
+	.uleb128 0xa
+	.long	.LASF363
+	.value	0x11b
+	.byte	0x13
+	.long	0x24b
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0xd
+	.quad	.LVL130
+	.long	0xed8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL56
+	.long	0x14c8
+	.uleb128 0x1c
+	.string	"i"
+	.value	0x12f
+	.byte	0xf
+	.long	0x35
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x29
+	.quad	.LVL121
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL108
+	.long	0xef8
+	.long	0x14ed
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xf
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL115
+	.long	0xebc
+	.long	0x150a
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL116
+	.long	0x160b
+	.long	0x1531
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -200
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL126
+	.long	0xea9
+	.uleb128 0x9
+	.quad	.LVL127
+	.long	0xea9
+	.long	0x1558
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL136
+	.long	0xea9
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF375
+	.byte	0x1
+	.byte	0xf4
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x160b
+	.uleb128 0x2a
+	.string	"job"
+	.byte	0xf4
+	.byte	0x34
+	.long	0xc9f
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x18
+	.long	.LASF354
+	.byte	0xf4
+	.byte	0x50
+	.long	0xcbd
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x18
+	.long	.LASF355
+	.byte	0xf4
+	.byte	0x65
+	.long	0x41
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x12
+	.long	.LASF285
+	.byte	0xf5
+	.byte	0x9
+	.long	0x9d
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x12
+	.long	.LASF286
+	.byte	0xf6
+	.byte	0xa
+	.long	0x35
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x8
+	.quad	.LVL6
+	.long	0xe6c
+	.uleb128 0x8
+	.quad	.LVL11
+	.long	0xe8d
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF365
+	.byte	0xc2
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1806
+	.uleb128 0x2a
+	.string	"job"
+	.byte	0xc2
+	.byte	0x2d
+	.long	0xc9f
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x18
+	.long	.LASF351
+	.byte	0xc2
+	.byte	0x39
+	.long	0x35
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x18
+	.long	.LASF352
+	.byte	0xc2
+	.byte	0x4f
+	.long	0x41
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x12
+	.long	.LASF366
+	.byte	0xda
+	.byte	0xa
+	.long	0x35
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xf
+	.long	.LLRL31
+	.long	0x16a9
+	.uleb128 0x12
+	.long	.LASF367
+	.byte	0xc4
+	.byte	0xa
+	.long	0x4d
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0xd
+	.quad	.LVL78
+	.long	0xe55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL22
+	.long	0x1702
+	.uleb128 0x19
+	.string	"i"
+	.byte	0xd0
+	.byte	0xf
+	.long	0x35
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x40
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.uleb128 0x12
+	.long	.LASF354
+	.byte	0xd1
+	.byte	0x1c
+	.long	0xcbd
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xd
+	.quad	.LVL46
+	.long	0xe34
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL25
+	.long	0x1730
+	.uleb128 0x19
+	.string	"i"
+	.byte	0xe2
+	.byte	0xf
+	.long	0x35
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0xd
+	.quad	.LVL59
+	.long	0xdcc
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL27
+	.long	0x1758
+	.uleb128 0x19
+	.string	"i"
+	.byte	0xe6
+	.byte	0xf
+	.long	0x35
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x8
+	.quad	.LVL64
+	.long	0x1806
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL29
+	.long	0x17a7
+	.uleb128 0x19
+	.string	"i"
+	.byte	0xe9
+	.byte	0xf
+	.long	0x35
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x8
+	.quad	.LVL68
+	.long	0xdb5
+	.uleb128 0x8
+	.quad	.LVL69
+	.long	0xda2
+	.uleb128 0x8
+	.quad	.LVL81
+	.long	0xdb5
+	.uleb128 0x8
+	.quad	.LVL82
+	.long	0xda2
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL40
+	.long	0xef8
+	.uleb128 0x9
+	.quad	.LVL55
+	.long	0xde7
+	.long	0x17d1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL56
+	.long	0x1806
+	.uleb128 0x8
+	.quad	.LVL71
+	.long	0xea9
+	.uleb128 0x8
+	.quad	.LVL75
+	.long	0x1806
+	.uleb128 0x8
+	.quad	.LVL80
+	.long	0x1806
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF368
+	.byte	0xa9
+	.byte	0xe
+	.long	0x8a
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19be
+	.uleb128 0x18
+	.long	.LASF369
+	.byte	0xa9
+	.byte	0x28
+	.long	0x8a
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x12
+	.long	.LASF354
+	.byte	0xaa
+	.byte	0x1a
+	.long	0xcbd
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x19
+	.string	"job"
+	.byte	0xab
+	.byte	0x17
+	.long	0xc9f
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x12
+	.long	.LASF355
+	.byte	0xac
+	.byte	0xa
+	.long	0x35
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x41
+	.long	0x19be
+	.quad	.LBI6
+	.byte	.LVU61
+	.long	.LLRL9
+	.byte	0x1
+	.byte	0xad
+	.byte	0xa
+	.long	0x1981
+	.uleb128 0x2c
+	.long	0x19d6
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2c
+	.long	0x19cb
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x28
+	.long	.LLRL9
+	.uleb128 0x1d
+	.long	0x19e1
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1d
+	.long	0x19ec
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x42
+	.long	0x19f7
+	.long	.LLRL14
+	.long	0x193b
+	.uleb128 0x1d
+	.long	0x19f8
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x43
+	.long	0x1a01
+	.long	.LLRL16
+	.uleb128 0x1d
+	.long	0x1a02
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x9
+	.quad	.LVL18
+	.long	0xd6f
+	.long	0x190d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL26
+	.long	0xd8b
+	.long	0x1925
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL27
+	.long	0xd6f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL21
+	.long	0xd8b
+	.long	0x1953
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL22
+	.long	0xd6f
+	.long	0x196b
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL35
+	.long	0xd6f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.quad	.LVL19
+	.long	0x19a1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x29
+	.quad	.LVL36
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF376
+	.byte	0x1
+	.byte	0x89
+	.byte	0xc
+	.long	0x46
+	.byte	0x1
+	.uleb128 0x2d
+	.long	.LASF354
+	.byte	0x89
+	.byte	0x31
+	.long	0xcbd
+	.uleb128 0x2d
+	.long	.LASF355
+	.byte	0x89
+	.byte	0x41
+	.long	0xa6a
+	.uleb128 0x2e
+	.long	.LASF370
+	.byte	0x8a
+	.byte	0x7
+	.long	0x46
+	.uleb128 0x2f
+	.string	"job"
+	.byte	0x93
+	.byte	0x17
+	.long	0xc9f
+	.uleb128 0x30
+	.uleb128 0x2f
+	.string	"i"
+	.byte	0x94
+	.byte	0xf
+	.long	0x35
+	.uleb128 0x30
+	.uleb128 0x2e
+	.long	.LASF371
+	.byte	0x95
+	.byte	0x1c
+	.long	0xcbd
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS70:
+	.uleb128 0
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU591
+	.uleb128 .LVU591
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU565
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU571
+	.uleb128 .LVU571
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU574
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS66:
+	.uleb128 0
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU535
+	.uleb128 .LVU535
+	.uleb128 .LVU554
+	.uleb128 .LVU554
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 .LVU561
+	.uleb128 .LVU561
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU538
+	.uleb128 .LVU538
+	.uleb128 .LVU559
+	.uleb128 .LVU559
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL166-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL166-1-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU539
+	.uleb128 .LVU542
+	.uleb128 .LVU542
+	.uleb128 .LVU557
+	.uleb128 .LVU560
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU554
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU558
+	.uleb128 .LVU558
+	.uleb128 .LVU560
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL171-1-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS58:
+	.uleb128 0
+	.uleb128 .LVU402
+	.uleb128 .LVU402
+	.uleb128 .LVU524
+	.uleb128 .LVU524
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 .LVU468
+	.uleb128 .LVU468
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 .LVU522
+	.uleb128 .LVU522
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 .LVU525
+	.uleb128 .LVU525
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x11
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0xa
+	.value	0x400
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 0
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL143-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL143-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+.LVUS63:
+	.uleb128 0
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL143-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL143-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU404
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU523
+	.uleb128 .LVU523
+	.uleb128 .LVU525
+	.uleb128 .LVU525
+	.uleb128 0
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL143-1-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x12
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x2e
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0xa
+	.value	0x400
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0xa
+	.value	0x400
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU455
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU468
+	.uleb128 .LVU468
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU507
+	.uleb128 .LVU507
+	.uleb128 .LVU509
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU255
+	.uleb128 .LVU255
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU246
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU275
+	.uleb128 .LVU278
+	.uleb128 .LVU281
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU255
+	.uleb128 .LVU272
+	.uleb128 .LVU278
+	.uleb128 .LVU282
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU258
+	.uleb128 .LVU272
+	.uleb128 .LVU278
+	.uleb128 .LVU284
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU260
+	.uleb128 .LVU263
+	.uleb128 .LVU267
+	.uleb128 .LVU272
+	.uleb128 .LVU278
+	.uleb128 .LVU279
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS40:
+	.uleb128 0
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU350
+	.uleb128 .LVU350
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS41:
+	.uleb128 0
+	.uleb128 .LVU298
+	.uleb128 .LVU298
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU292
+	.uleb128 .LVU292
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU294
+	.uleb128 .LVU294
+	.uleb128 .LVU352
+	.uleb128 .LVU352
+	.uleb128 .LVU365
+	.uleb128 .LVU366
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU298
+	.uleb128 .LVU298
+	.uleb128 .LVU365
+	.uleb128 .LVU365
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU298
+	.uleb128 .LVU298
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU295
+	.uleb128 .LVU298
+	.uleb128 .LVU298
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 .LVU352
+	.uleb128 .LVU352
+	.uleb128 .LVU365
+	.uleb128 .LVU366
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x74
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-1-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0xe
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0xf
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x13
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0xe
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0xe
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU299
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU365
+	.uleb128 .LVU366
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU302
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU317
+	.uleb128 .LVU317
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU323
+	.uleb128 .LVU366
+	.uleb128 .LVU376
+	.uleb128 .LVU376
+	.uleb128 .LVU380
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU303
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU318
+	.uleb128 .LVU321
+	.uleb128 .LVU323
+	.uleb128 .LVU366
+	.uleb128 .LVU370
+	.uleb128 .LVU378
+	.uleb128 .LVU380
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU345
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU365
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU346
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU360
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU314
+	.uleb128 .LVU323
+	.uleb128 .LVU366
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU380
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU370
+	.uleb128 .LVU373
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU348
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU360
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU11
+	.uleb128 .LVU21
+	.uleb128 .LVU31
+	.uleb128 .LVU34
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU13
+	.uleb128 .LVU21
+	.uleb128 .LVU31
+	.uleb128 .LVU34
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU116
+	.uleb128 .LVU216
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU223
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU157
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 .LVU184
+	.uleb128 .LVU212
+	.uleb128 .LVU216
+	.uleb128 .LVU223
+	.uleb128 .LVU236
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU220
+	.uleb128 .LVU223
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU129
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU210
+	.uleb128 .LVU212
+	.uleb128 .LVU216
+	.uleb128 .LVU223
+	.uleb128 .LVU236
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU132
+	.uleb128 .LVU134
+	.uleb128 .LVU139
+	.uleb128 .LVU162
+	.uleb128 .LVU223
+	.uleb128 .LVU236
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU173
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU183
+	.uleb128 .LVU215
+	.uleb128 .LVU216
+	.uleb128 .LVU227
+	.uleb128 .LVU236
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU181
+	.uleb128 .LVU183
+	.uleb128 .LVU184
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 .LVU191
+	.uleb128 .LVU228
+	.uleb128 .LVU230
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+	.uleb128 .LVU196
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU206
+	.uleb128 .LVU230
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 .LVU236
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU43
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU46
+	.uleb128 .LVU96
+	.uleb128 .LVU97
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU52
+	.uleb128 .LVU60
+	.uleb128 .LVU99
+	.uleb128 .LVU110
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU49
+	.uleb128 .LVU56
+	.uleb128 .LVU61
+	.uleb128 .LVU105
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6240
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6240
+	.sleb128 0
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU49
+	.uleb128 .LVU56
+	.uleb128 .LVU61
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU105
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU49
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU56
+	.uleb128 .LVU63
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU105
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU49
+	.uleb128 .LVU56
+	.uleb128 .LVU70
+	.uleb128 .LVU95
+	.uleb128 .LVU102
+	.uleb128 .LVU105
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 72
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU72
+	.uleb128 .LVU76
+	.uleb128 .LVU89
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU92
+	.uleb128 .LVU104
+	.uleb128 .LVU105
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU49
+	.uleb128 .LVU56
+	.uleb128 .LVU83
+	.uleb128 .LVU92
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL56:
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0
+.LLRL71:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF280:
+	.string	"ST_STRING_BORROWED"
+.LASF231:
+	.string	"_SC_LEVEL3_CACHE_SIZE"
+.LASF355:
+	.string	"chunk"
+.LASF141:
+	.string	"_SC_INT_MAX"
+.LASF10:
+	.string	"size_t"
+.LASF52:
+	.string	"_SC_MAPPED_FILES"
+.LASF37:
+	.string	"_SC_CHILD_MAX"
+.LASF360:
+	.string	"start"
+.LASF25:
+	.string	"__kind"
+.LASF38:
+	.string	"_SC_CLK_TCK"
+.LASF258:
+	.string	"used"
+.LASF70:
+	.string	"_SC_SIGQUEUE_MAX"
+.LASF12:
+	.string	"__ssize_t"
+.LASF249:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF177:
+	.string	"_SC_DEVICE_IO"
+.LASF267:
+	.string	"conversions"
+.LASF18:
+	.string	"__pthread_list_t"
+.LASF235:
+	.string	"_SC_LEVEL4_CACHE_ASSOC"
+.LASF43:
+	.string	"_SC_JOB_CONTROL"
+.LASF139:
+	.string	"_SC_CHAR_MAX"
+.LASF311:
+	.string	"iov_count"
+.LASF220:
+	.string	"_SC_TRACE_INHERIT"
+.LASF17:
+	.string	"__next"
+.LASF34:
+	.string	"__data"
+.LASF16:
+	.string	"__prev"
+.LASF91:
+	.string	"_SC_PII_SOCKET"
+.LASF329:
+	.string	"st_append_n"
+.LASF44:
+	.string	"_SC_SAVED_IDS"
+.LASF296:
+	.string	"stats"
+.LASF148:
+	.string	"_SC_SCHAR_MAX"
+.LASF19:
+	.string	"__pthread_internal_list"
+.LASF337:
+	.string	"pthread_create"
+.LASF36:
+	.string	"_SC_ARG_MAX"
+.LASF201:
+	.string	"_SC_TIMEOUTS"
+.LASF138:
+	.string	"_SC_CHAR_BIT"
+.LASF59:
+	.string	"_SC_AIO_LISTIO_MAX"
+.LASF23:
+	.string	"__owner"
+.LASF145:
+	.string	"_SC_MB_LEN_MAX"
+.LASF118:
+	.string	"_SC_THREAD_PRIO_PROTECT"
+.LASF92:
+	.string	"_SC_PII_INTERNET"
+.LASF308:
+	.string	"merge"
+.LASF119:
+	.string	"_SC_THREAD_PROCESS_SHARED"
+.LASF14:
+	.string	"ssize_t"
+.LASF245:
+	.string	"_SC_TRACE_NAME_MAX"
+.LASF172:
+	.string	"_SC_C_LANG_SUPPORT"
+.LASF289:
+	.string	"growth_policy"
+.LASF89:
+	.string	"_SC_PII"
+.LASF61:
+	.string	"_SC_AIO_PRIO_DELTA_MAX"
+.LASF294:
+	.string	"inline_buffer"
+.LASF55:
+	.string	"_SC_MEMORY_PROTECTION"
+.LASF365:
+	.string	"parallel_run"
+.LASF293:
+	.string	"arena"
+.LASF40:
+	.string	"_SC_OPEN_MAX"
+.LASF113:
+	.string	"_SC_THREAD_THREADS_MAX"
+.LASF190:
+	.string	"_SC_READER_WRITER_LOCKS"
+.LASF211:
+	.string	"_SC_STREAMS"
+.LASF279:
+	.string	"StringOwnership"
+.LASF3:
+	.string	"long int"
+.LASF63:
+	.string	"_SC_MQ_OPEN_MAX"
+.LASF375:
+	.string	"parallel_lines_work"
+.LASF181:
+	.string	"_SC_FIFO"
+.LASF133:
+	.string	"_SC_2_C_VERSION"
+.LASF250:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF73:
+	.string	"_SC_BC_DIM_MAX"
+.LASF323:
+	.string	"results"
+.LASF320:
+	.string	"workers"
+.LASF286:
+	.string	"length"
+.LASF313:
+	.string	"ParallelWorker"
+.LASF275:
+	.string	"error"
+.LASF256:
+	.string	"head"
+.LASF114:
+	.string	"_SC_THREAD_ATTR_STACKADDR"
+.LASF239:
+	.string	"_SC_V7_ILP32_OFF32"
+.LASF24:
+	.string	"__nusers"
+.LASF207:
+	.string	"_SC_2_PBS_LOCATE"
+.LASF309:
+	.string	"StringFragments"
+.LASF8:
+	.string	"signed char"
+.LASF353:
+	.string	"separator_view"
+.LASF227:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE"
+.LASF253:
+	.string	"uint64_t"
+.LASF219:
+	.string	"_SC_TRACE_EVENT_FILTER"
+.LASF271:
+	.string	"context"
+.LASF157:
+	.string	"_SC_NL_LANGMAX"
+.LASF20:
+	.string	"__pthread_mutex_s"
+.LASF215:
+	.string	"_SC_V6_LP64_OFF64"
+.LASF158:
+	.string	"_SC_NL_MSGMAX"
+.LASF5:
+	.string	"unsigned char"
+.LASF26:
+	.string	"__spins"
+.LASF101:
+	.string	"_SC_PII_OSI_CLTS"
+.LASF354:
+	.string	"worker"
+.LASF341:
+	.string	"st_create_n"
+.LASF223:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC"
+.LASF179:
+	.string	"_SC_DEVICE_SPECIFIC_R"
+.LASF146:
+	.string	"_SC_NZERO"
+.LASF135:
+	.string	"_SC_XOPEN_XPG2"
+.LASF136:
+	.string	"_SC_XOPEN_XPG3"
+.LASF137:
+	.string	"_SC_XOPEN_XPG4"
+.LASF154:
+	.string	"_SC_ULONG_MAX"
+.LASF324:
+	.string	"handler"
+.LASF130:
+	.string	"_SC_XOPEN_ENH_I18N"
+.LASF347:
+	.string	"views"
+.LASF317:
+	.string	"tokenizer"
+.LASF142:
+	.string	"_SC_INT_MIN"
+.LASF13:
+	.string	"char"
+.LASF327:
+	.string	"serialize"
+.LASF134:
+	.string	"_SC_2_UPE"
+.LASF66:
+	.string	"_SC_PAGESIZE"
+.LASF185:
+	.string	"_SC_FILE_SYSTEM"
+.LASF273:
+	.string	"capacity"
+.LASF306:
+	.string	"StringParallelHandler"
+.LASF314:
+	.string	"lock"
+.LASF82:
+	.string	"_SC_2_VERSION"
+.LASF366:
+	.string	"started"
+.LASF80:
+	.string	"_SC_RE_DUP_MAX"
+.LASF232:
+	.string	"_SC_LEVEL3_CACHE_ASSOC"
+.LASF85:
+	.string	"_SC_2_FORT_DEV"
+.LASF140:
+	.string	"_SC_CHAR_MIN"
+.LASF338:
+	.string	"pthread_mutex_init"
+.LASF97:
+	.string	"_SC_IOV_MAX"
+.LASF292:
+	.string	"ownership"
+.LASF176:
+	.string	"_SC_THREAD_CPUTIME"
+.LASF199:
+	.string	"_SC_SYSTEM_DATABASE"
+.LASF291:
+	.string	"stream"
+.LASF99:
+	.string	"_SC_PII_INTERNET_DGRAM"
+.LASF184:
+	.string	"_SC_FILE_LOCKING"
+.LASF149:
+	.string	"_SC_SCHAR_MIN"
+.LASF326:
+	.string	"batch_size"
+.LASF96:
+	.string	"_SC_UIO_MAXIOV"
+.LASF282:
+	.string	"ST_STRING_MAPPED"
+.LASF278:
+	.string	"StringGrowthPolicy"
+.LASF65:
+	.string	"_SC_VERSION"
+.LASF226:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC"
+.LASF21:
+	.string	"__lock"
+.LASF290:
+	.string	"max_increment"
+.LASF352:
+	.string	"chunks"
+.LASF191:
+	.string	"_SC_SPIN_LOCKS"
+.LASF331:
+	.string	"sv_to_string"
+.LASF153:
+	.string	"_SC_UINT_MAX"
+.LASF272:
+	.string	"chunk_size"
+.LASF238:
+	.string	"_SC_RAW_SOCKETS"
+.LASF358:
+	.string	"index"
+.LASF104:
+	.string	"_SC_THREADS"
+.LASF105:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS"
+.LASF144:
+	.string	"_SC_WORD_BIT"
+.LASF192:
+	.string	"_SC_REGEXP"
+.LASF48:
+	.string	"_SC_ASYNCHRONOUS_IO"
+.LASF81:
+	.string	"_SC_CHARCLASS_NAME_MAX"
+.LASF126:
+	.string	"_SC_XOPEN_VERSION"
+.LASF233:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE"
+.LASF112:
+	.string	"_SC_THREAD_STACK_MIN"
+.LASF11:
+	.string	"__uint64_t"
+.LASF2:
+	.string	"long unsigned int"
+.LASF128:
+	.string	"_SC_XOPEN_UNIX"
+.LASF283:
+	.string	"ST_STRING_INLINE"
+.LASF372:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF29:
+	.string	"pthread_t"
+.LASF301:
+	.string	"hint"
+.LASF161:
+	.string	"_SC_NL_TEXTMAX"
+.LASF98:
+	.string	"_SC_PII_INTERNET_STREAM"
+.LASF252:
+	.string	"_SC_SIGSTKSZ"
+.LASF214:
+	.string	"_SC_V6_ILP32_OFFBIG"
+.LASF106:
+	.string	"_SC_GETGR_R_SIZE_MAX"
+.LASF240:
+	.string	"_SC_V7_ILP32_OFFBIG"
+.LASF57:
+	.string	"_SC_SEMAPHORES"
+.LASF234:
+	.string	"_SC_LEVEL4_CACHE_SIZE"
+.LASF251:
+	.string	"_SC_MINSIGSTKSZ"
+.LASF322:
+	.string	"bounds"
+.LASF187:
+	.string	"_SC_MULTI_PROCESS"
+.LASF121:
+	.string	"_SC_NPROCESSORS_ONLN"
+.LASF307:
+	.string	"process"
+.LASF30:
+	.string	"__size"
+.LASF203:
+	.string	"_SC_USER_GROUPS"
+.LASF255:
+	.string	"StringArena"
+.LASF318:
+	.string	"ParallelJob"
+.LASF88:
+	.string	"_SC_2_LOCALEDEF"
+.LASF79:
+	.string	"_SC_LINE_MAX"
+.LASF367:
+	.string	"processors"
+.LASF122:
+	.string	"_SC_PHYS_PAGES"
+.LASF167:
+	.string	"_SC_XOPEN_REALTIME"
+.LASF195:
+	.string	"_SC_SIGNALS"
+.LASF186:
+	.string	"_SC_MONOTONIC_CLOCK"
+.LASF67:
+	.string	"_SC_RTSIG_MAX"
+.LASF183:
+	.string	"_SC_FILE_ATTRIBUTES"
+.LASF204:
+	.string	"_SC_USER_GROUPS_R"
+.LASF127:
+	.string	"_SC_XOPEN_XCU_VERSION"
+.LASF90:
+	.string	"_SC_PII_XTI"
+.LASF168:
+	.string	"_SC_XOPEN_REALTIME_THREADS"
+.LASF4:
+	.string	"long long int"
+.LASF143:
+	.string	"_SC_LONG_BIT"
+.LASF163:
+	.string	"_SC_XBS5_ILP32_OFFBIG"
+.LASF348:
+	.string	"appended"
+.LASF303:
+	.string	"iovec"
+.LASF302:
+	.string	"double"
+.LASF152:
+	.string	"_SC_UCHAR_MAX"
+.LASF182:
+	.string	"_SC_PIPE"
+.LASF202:
+	.string	"_SC_TYPED_MEMORY_OBJECTS"
+.LASF281:
+	.string	"ST_STRING_OWNED"
+.LASF108:
+	.string	"_SC_LOGIN_NAME_MAX"
+.LASF111:
+	.string	"_SC_THREAD_KEYS_MAX"
+.LASF169:
+	.string	"_SC_ADVISORY_INFO"
+.LASF33:
+	.string	"pthread_attr_t"
+.LASF299:
+	.string	"count"
+.LASF333:
+	.string	"pthread_mutex_unlock"
+.LASF270:
+	.string	"read"
+.LASF285:
+	.string	"string"
+.LASF7:
+	.string	"unsigned int"
+.LASF262:
+	.string	"tokens_extracted"
+.LASF35:
+	.string	"pthread_mutex_t"
+.LASF260:
+	.string	"StringStats"
+.LASF287:
+	.string	"position"
+.LASF76:
+	.string	"_SC_COLL_WEIGHTS_MAX"
+.LASF102:
+	.string	"_SC_PII_OSI_M"
+.LASF84:
+	.string	"_SC_2_C_DEV"
+.LASF200:
+	.string	"_SC_SYSTEM_DATABASE_R"
+.LASF373:
+	.string	"StringArenaBlock"
+.LASF244:
+	.string	"_SC_TRACE_EVENT_NAME_MAX"
+.LASF155:
+	.string	"_SC_USHRT_MAX"
+.LASF237:
+	.string	"_SC_IPV6"
+.LASF217:
+	.string	"_SC_HOST_NAME_MAX"
+.LASF75:
+	.string	"_SC_BC_STRING_MAX"
+.LASF376:
+	.string	"parallel_take"
+.LASF116:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING"
+.LASF305:
+	.string	"iov_len"
+.LASF349:
+	.string	"st_fragments_stitch"
+.LASF274:
+	.string	"offset"
+.LASF356:
+	.string	"first"
+.LASF94:
+	.string	"_SC_POLL"
+.LASF345:
+	.string	"memchr"
+.LASF22:
+	.string	"__count"
+.LASF87:
+	.string	"_SC_2_SW_DEV"
+.LASF45:
+	.string	"_SC_REALTIME_SIGNALS"
+.LASF344:
+	.string	"calloc"
+.LASF165:
+	.string	"_SC_XBS5_LPBIG_OFFBIG"
+.LASF206:
+	.string	"_SC_2_PBS_ACCOUNTING"
+.LASF110:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF221:
+	.string	"_SC_TRACE_LOG"
+.LASF259:
+	.string	"long double"
+.LASF53:
+	.string	"_SC_MEMLOCK"
+.LASF93:
+	.string	"_SC_PII_OSI"
+.LASF62:
+	.string	"_SC_DELAYTIMER_MAX"
+.LASF86:
+	.string	"_SC_2_FORT_RUN"
+.LASF241:
+	.string	"_SC_V7_LP64_OFF64"
+.LASF120:
+	.string	"_SC_NPROCESSORS_CONF"
+.LASF150:
+	.string	"_SC_SHRT_MAX"
+.LASF288:
+	.string	"incremental_factor"
+.LASF300:
+	.string	"in_string"
+.LASF319:
+	.string	"work"
+.LASF60:
+	.string	"_SC_AIO_MAX"
+.LASF170:
+	.string	"_SC_BARRIERS"
+.LASF193:
+	.string	"_SC_REGEX_VERSION"
+.LASF230:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE"
+.LASF178:
+	.string	"_SC_DEVICE_SPECIFIC"
+.LASF58:
+	.string	"_SC_SHARED_MEMORY_OBJECTS"
+.LASF332:
+	.string	"sv_from_string"
+.LASF310:
+	.string	"fragments"
+.LASF164:
+	.string	"_SC_XBS5_LP64_OFF64"
+.LASF15:
+	.string	"long long unsigned int"
+.LASF364:
+	.string	"parallel_serialize_work"
+.LASF254:
+	.string	"StringView"
+.LASF242:
+	.string	"_SC_V7_LPBIG_OFFBIG"
+.LASF28:
+	.string	"__list"
+.LASF156:
+	.string	"_SC_NL_ARGMAX"
+.LASF328:
+	.string	"st_append_many"
+.LASF298:
+	.string	"positions"
+.LASF188:
+	.string	"_SC_SINGLE_PROCESS"
+.LASF266:
+	.string	"bytes_copied"
+.LASF123:
+	.string	"_SC_AVPHYS_PAGES"
+.LASF131:
+	.string	"_SC_XOPEN_SHM"
+.LASF198:
+	.string	"_SC_THREAD_SPORADIC_SERVER"
+.LASF243:
+	.string	"_SC_SS_REPL_MAX"
+.LASF263:
+	.string	"allocations"
+.LASF159:
+	.string	"_SC_NL_NMAX"
+.LASF368:
+	.string	"parallel_worker_run"
+.LASF284:
+	.string	"StringTokenizer"
+.LASF208:
+	.string	"_SC_2_PBS_MESSAGE"
+.LASF68:
+	.string	"_SC_SEM_NSEMS_MAX"
+.LASF268:
+	.string	"conversion_ns"
+.LASF103:
+	.string	"_SC_T_IOV_MAX"
+.LASF49:
+	.string	"_SC_PRIORITIZED_IO"
+.LASF350:
+	.string	"st_parallel_serialize"
+.LASF257:
+	.string	"block_size"
+.LASF346:
+	.string	"malloc"
+.LASF31:
+	.string	"__align"
+.LASF351:
+	.string	"threads"
+.LASF213:
+	.string	"_SC_V6_ILP32_OFF32"
+.LASF41:
+	.string	"_SC_STREAM_MAX"
+.LASF42:
+	.string	"_SC_TZNAME_MAX"
+.LASF212:
+	.string	"_SC_2_PBS_CHECKPOINT"
+.LASF196:
+	.string	"_SC_SPAWN"
+.LASF54:
+	.string	"_SC_MEMLOCK_RANGE"
+.LASF74:
+	.string	"_SC_BC_SCALE_MAX"
+.LASF330:
+	.string	"st_create_empty"
+.LASF339:
+	.string	"sysconf"
+.LASF246:
+	.string	"_SC_TRACE_SYS_MAX"
+.LASF210:
+	.string	"_SC_SYMLOOP_MAX"
+.LASF132:
+	.string	"_SC_2_CHAR_TERM"
+.LASF194:
+	.string	"_SC_SHELL"
+.LASF180:
+	.string	"_SC_FD_MGMT"
+.LASF316:
+	.string	"thread"
+.LASF129:
+	.string	"_SC_XOPEN_CRYPT"
+.LASF224:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE"
+.LASF295:
+	.string	"structural_index"
+.LASF173:
+	.string	"_SC_C_LANG_SUPPORT_R"
+.LASF247:
+	.string	"_SC_TRACE_USER_EVENT_MAX"
+.LASF71:
+	.string	"_SC_TIMER_MAX"
+.LASF205:
+	.string	"_SC_2_PBS"
+.LASF175:
+	.string	"_SC_CPUTIME"
+.LASF197:
+	.string	"_SC_SPORADIC_SERVER"
+.LASF9:
+	.string	"short int"
+.LASF174:
+	.string	"_SC_CLOCK_SELECTION"
+.LASF162:
+	.string	"_SC_XBS5_ILP32_OFF32"
+.LASF277:
+	.string	"ST_GROWTH_LINEAR"
+.LASF189:
+	.string	"_SC_NETWORKING"
+.LASF32:
+	.string	"pthread_mutexattr_t"
+.LASF334:
+	.string	"pthread_mutex_lock"
+.LASF236:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE"
+.LASF124:
+	.string	"_SC_ATEXIT_MAX"
+.LASF359:
+	.string	"st_parallel_lines"
+.LASF261:
+	.string	"bytes_scanned"
+.LASF100:
+	.string	"_SC_PII_OSI_COTS"
+.LASF297:
+	.string	"StringStructuralIndex"
+.LASF64:
+	.string	"_SC_MQ_PRIO_MAX"
+.LASF362:
+	.string	"merged"
+.LASF69:
+	.string	"_SC_SEM_VALUE_MAX"
+.LASF27:
+	.string	"__elision"
+.LASF47:
+	.string	"_SC_TIMERS"
+.LASF125:
+	.string	"_SC_PASS_MAX"
+.LASF51:
+	.string	"_SC_FSYNC"
+.LASF370:
+	.string	"taken"
+.LASF95:
+	.string	"_SC_SELECT"
+.LASF109:
+	.string	"_SC_TTY_NAME_MAX"
+.LASF336:
+	.string	"pthread_join"
+.LASF276:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF56:
+	.string	"_SC_MESSAGE_PASSING"
+.LASF325:
+	.string	"items"
+.LASF229:
+	.string	"_SC_LEVEL2_CACHE_ASSOC"
+.LASF72:
+	.string	"_SC_BC_BASE_MAX"
+.LASF342:
+	.string	"st_destroy"
+.LASF228:
+	.string	"_SC_LEVEL2_CACHE_SIZE"
+.LASF78:
+	.string	"_SC_EXPR_NEST_MAX"
+.LASF50:
+	.string	"_SC_SYNCHRONIZED_IO"
+.LASF248:
+	.string	"_SC_XOPEN_STREAMS"
+.LASF225:
+	.string	"_SC_LEVEL1_DCACHE_SIZE"
+.LASF371:
+	.string	"victim"
+.LASF151:
+	.string	"_SC_SHRT_MIN"
+.LASF340:
+	.string	"st_rebind"
+.LASF209:
+	.string	"_SC_2_PBS_TRACK"
+.LASF335:
+	.string	"pthread_mutex_destroy"
+.LASF39:
+	.string	"_SC_NGROUPS_MAX"
+.LASF216:
+	.string	"_SC_V6_LPBIG_OFFBIG"
+.LASF374:
+	.string	"st_fragments_free"
+.LASF343:
+	.string	"free"
+.LASF6:
+	.string	"short unsigned int"
+.LASF222:
+	.string	"_SC_LEVEL1_ICACHE_SIZE"
+.LASF265:
+	.string	"expansions"
+.LASF264:
+	.string	"reallocations"
+.LASF304:
+	.string	"iov_base"
+.LASF369:
+	.string	"argument"
+.LASF77:
+	.string	"_SC_EQUIV_CLASS_MAX"
+.LASF312:
+	.string	"separator"
+.LASF171:
+	.string	"_SC_BASE"
+.LASF46:
+	.string	"_SC_PRIORITY_SCHEDULING"
+.LASF269:
+	.string	"StringStream"
+.LASF361:
+	.string	"processed"
+.LASF147:
+	.string	"_SC_SSIZE_MAX"
+.LASF107:
+	.string	"_SC_GETPW_R_SIZE_MAX"
+.LASF166:
+	.string	"_SC_XOPEN_LEGACY"
+.LASF321:
+	.string	"failed"
+.LASF117:
+	.string	"_SC_THREAD_PRIO_INHERIT"
+.LASF218:
+	.string	"_SC_TRACE"
+.LASF315:
+	.string	"next"
+.LASF160:
+	.string	"_SC_NL_SETMAX"
+.LASF83:
+	.string	"_SC_2_C_BIND"
+.LASF363:
+	.string	"newline"
+.LASF357:
+	.string	"last"
+.LASF115:
+	.string	"_SC_THREAD_ATTR_STACKSIZE"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/parallel.c"
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,5236 @@
+	.file	"parallel_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/tests/parallel_unit_tests.c"
+	.p2align 4
+	.type	parallel_test_merge, @function
+parallel_test_merge:
+.LVL0:
+.LFB27:
+	.file 1 "/root/repo/tests/parallel_unit_tests.c"
+	.loc 1 57 61 view -0
+	.cfi_startproc
+	.loc 1 58 3 view .LVU1
+	.loc 1 57 61 is_stmt 0 view .LVU2
+	movq	%rdi, %rax
+.LVL1:
+	.loc 1 59 3 is_stmt 1 view .LVU3
+	.loc 1 60 3 view .LVU4
+	.loc 1 57 61 is_stmt 0 view .LVU5
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 57 61 view .LVU6
+	movq	%rsi, %rdi
+.LVL2:
+	.loc 1 60 6 view .LVU7
+	testq	%rsi, %rsi
+	je	.L2
+	.loc 1 60 20 discriminator 1 view .LVU8
+	movq	(%rax), %rcx
+	cmpq	%rcx, (%rsi)
+	je	.L3
+.L2:
+	.loc 1 61 5 is_stmt 1 view .LVU9
+	.loc 1 61 20 is_stmt 0 view .LVU10
+	movl	$0, 16(%rax)
+	.loc 1 67 3 is_stmt 1 view .LVU11
+	call	free@PLT
+.LVL3:
+	.loc 1 68 3 view .LVU12
+	.loc 1 69 1 is_stmt 0 view .LVU13
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL4:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.cfi_restore_state
+	.loc 1 64 5 is_stmt 1 view .LVU14
+	.loc 1 64 31 is_stmt 0 view .LVU15
+	movq	8(%rsi), %rdx
+	incq	%rdx
+	.loc 1 64 17 view .LVU16
+	movq	%rdx, (%rax)
+	.loc 1 65 5 is_stmt 1 view .LVU17
+	.loc 1 65 18 is_stmt 0 view .LVU18
+	movq	16(%rsi), %rdx
+	addq	%rdx, 8(%rax)
+	.loc 1 67 3 is_stmt 1 view .LVU19
+	call	free@PLT
+.LVL5:
+	.loc 1 68 3 view .LVU20
+	.loc 1 69 1 is_stmt 0 view .LVU21
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	parallel_test_merge, .-parallel_test_merge
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"id"
+.LC1:
+	.string	"none"
+	.text
+	.p2align 4
+	.type	parallel_test_process, @function
+parallel_test_process:
+.LVL6:
+.LFB26:
+	.loc 1 29 99 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 30 3 view .LVU23
+	.loc 1 29 99 is_stmt 0 view .LVU24
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	.loc 1 30 67 view .LVU25
+	movl	$24, %edi
+.LVL7:
+	.loc 1 29 99 view .LVU26
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rsi, %rbx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 30 67 view .LVU27
+	call	malloc@PLT
+.LVL8:
+	.loc 1 31 3 is_stmt 1 view .LVU28
+	.loc 1 31 6 is_stmt 0 view .LVU29
+	testq	%rax, %rax
+	je	.L11
+	.loc 1 37 11 view .LVU30
+	movq	%rax, (%r12)
+	.loc 1 34 16 view .LVU31
+	movq	$-1, (%rax)
+	.loc 1 35 15 view .LVU32
+	movq	$-1, 8(%rax)
+	.loc 1 36 16 view .LVU33
+	movq	$0, 16(%rax)
+	movq	%rax, %rbp
+	.loc 1 34 3 is_stmt 1 view .LVU34
+	.loc 1 35 3 view .LVU35
+	.loc 1 36 3 view .LVU36
+	.loc 1 37 3 view .LVU37
+	.loc 1 38 3 view .LVU38
+.LBB2:
+	.loc 1 40 9 is_stmt 0 view .LVU39
+	leaq	.LC0(%rip), %r12
+.LVL9:
+	.loc 1 40 46 view .LVU40
+	leaq	8(%rsp), %r13
+	.loc 1 44 5 view .LVU41
+	leaq	.LC1(%rip), %r14
+.LBE2:
+	.loc 1 38 9 view .LVU42
+	jmp	.L12
+.LVL10:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+.LBB3:
+	.loc 1 39 5 is_stmt 1 view .LVU43
+	.loc 1 40 5 view .LVU44
+	.loc 1 40 9 is_stmt 0 view .LVU45
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	st_find_key@PLT
+.LVL11:
+	.loc 1 40 8 view .LVU46
+	testl	%eax, %eax
+	je	.L11
+	.loc 1 40 46 discriminator 1 view .LVU47
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	st_extract_double_to@PLT
+.LVL12:
+	.loc 1 40 43 discriminator 1 view .LVU48
+	testl	%eax, %eax
+	je	.L11
+	.loc 1 44 5 is_stmt 1 view .LVU49
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	st_find_key@PLT
+.LVL13:
+	.loc 1 45 5 view .LVU50
+	.loc 1 45 14 is_stmt 0 view .LVU51
+	movq	16(%rbp), %rax
+	.loc 1 45 21 view .LVU52
+	leaq	1(%rax), %rdx
+	.loc 1 45 8 view .LVU53
+	testq	%rax, %rax
+	.loc 1 45 21 view .LVU54
+	movq	%rdx, 16(%rbp)
+	.loc 1 46 22 view .LVU55
+	vcvttsd2siq	8(%rsp), %rax
+	.loc 1 45 8 view .LVU56
+	jne	.L17
+	.loc 1 46 7 is_stmt 1 view .LVU57
+	.loc 1 46 20 is_stmt 0 view .LVU58
+	movq	%rax, 0(%rbp)
+.L17:
+	.loc 1 48 5 is_stmt 1 view .LVU59
+	.loc 1 48 17 is_stmt 0 view .LVU60
+	movq	%rax, 8(%rbp)
+	.loc 1 49 5 is_stmt 1 view .LVU61
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL14:
+.L12:
+	.loc 1 49 5 is_stmt 0 view .LVU62
+.LBE3:
+	.loc 1 38 38 is_stmt 1 view .LVU63
+	.loc 1 38 10 is_stmt 0 view .LVU64
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL15:
+	.loc 1 38 38 view .LVU65
+	cmpb	$123, %al
+	je	.L18
+	.loc 1 51 3 is_stmt 1 view .LVU66
+	.loc 1 51 30 is_stmt 0 view .LVU67
+	movq	8(%rbx), %rax
+	cmpq	%rax, 16(%rbx)
+	sete	%al
+	.loc 1 52 1 view .LVU68
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL16:
+	.loc 1 52 1 view .LVU69
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL17:
+	.loc 1 52 1 view .LVU70
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	.loc 1 51 30 view .LVU71
+	movzbl	%al, %eax
+	.loc 1 52 1 view .LVU72
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.cfi_restore_state
+	.loc 1 52 1 view .LVU73
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL19:
+	.loc 1 52 1 view .LVU74
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	.loc 1 32 12 view .LVU75
+	xorl	%eax, %eax
+	.loc 1 52 1 view .LVU76
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	parallel_test_process, .-parallel_test_process
+	.section	.rodata.str1.1
+.LC2:
+	.string	"{\"id\":"
+	.text
+	.p2align 4
+	.type	parallel_test_serialize, @function
+parallel_test_serialize:
+.LVL20:
+.LFB29:
+	.loc 1 112 100 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 113 3 view .LVU78
+	.loc 1 112 100 is_stmt 0 view .LVU79
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbx
+	.loc 1 113 10 view .LVU80
+	movq	%rbx, %rdi
+.LVL21:
+	.loc 1 112 100 view .LVU81
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 113 10 view .LVU82
+	leaq	.LC2(%rip), %rsi
+.LVL22:
+	.loc 1 113 10 view .LVU83
+	call	st_append_string@PLT
+.LVL23:
+	.loc 1 113 94 view .LVU84
+	testl	%eax, %eax
+	jne	.L27
+.L29:
+	.loc 1 114 1 view .LVU85
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL24:
+	.loc 1 113 94 view .LVU86
+	xorl	%eax, %eax
+	.loc 1 114 1 view .LVU87
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL25:
+	.loc 1 114 1 view .LVU88
+	ret
+.LVL26:
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.cfi_restore_state
+	.loc 1 113 53 discriminator 1 view .LVU89
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	st_append_int@PLT
+.LVL27:
+	.loc 1 113 50 discriminator 1 view .LVU90
+	testl	%eax, %eax
+	je	.L29
+	.loc 1 113 97 discriminator 3 view .LVU91
+	movq	%rbx, %rdi
+	movl	$125, %esi
+	call	st_append_char@PLT
+.LVL28:
+	.loc 1 113 94 discriminator 3 view .LVU92
+	testl	%eax, %eax
+	setne	%al
+	.loc 1 114 1 discriminator 3 view .LVU93
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL29:
+	.loc 1 113 94 discriminator 3 view .LVU94
+	movzbl	%al, %eax
+	.loc 1 114 1 discriminator 3 view .LVU95
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL30:
+	.loc 1 114 1 discriminator 3 view .LVU96
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	parallel_test_serialize, .-parallel_test_serialize
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC5:
+	.string	"------------------- st_parallel_lines(x) -------------------"
+	.align 8
+.LC6:
+	.string	"{\"id\": %d, \"name\": \"record\\n%d\", \"tags\": [%d]}\n"
+	.align 8
+.LC7:
+	.string	"[Failed] %zu threads and chunks of %zu failed: %ld records merged.\n"
+	.align 8
+.LC8:
+	.string	"[Passed] %zu threads and chunks of %zu merged %ld records in order.\n"
+	.text
+	.p2align 4
+	.globl	run_st_parallel_lines_unit_tests
+	.type	run_st_parallel_lines_unit_tests, @function
+run_st_parallel_lines_unit_tests:
+.LFB28:
+	.loc 1 74 40 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 76 3 view .LVU98
+	.loc 1 74 40 is_stmt 0 view .LVU99
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 81 3 view .LVU100
+	leaq	.LC5(%rip), %rdi
+	.loc 1 74 40 view .LVU101
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	leaq	.LC6(%rip), %r13
+	pushq	%r12
+	.cfi_offset 12, -48
+.LBB4:
+	.loc 1 87 15 view .LVU102
+	movl	$320000, %r12d
+.LBE4:
+	.loc 1 74 40 view .LVU103
+	pushq	%rbx
+	andq	$-32, %rsp
+	subq	$160, %rsp
+	.cfi_offset 3, -56
+	.loc 1 76 10 view .LVU104
+	vmovdqa	.LC3(%rip), %ymm0
+	vmovdqa	%ymm0, 96(%rsp)
+	.loc 1 77 3 is_stmt 1 view .LVU105
+	.loc 1 77 10 is_stmt 0 view .LVU106
+	vmovdqa	.LC4(%rip), %ymm0
+	vmovdqa	%ymm0, 128(%rsp)
+	.loc 1 79 3 is_stmt 1 view .LVU107
+.LVL31:
+	.loc 1 81 3 view .LVU108
+	vzeroupper
+.LVL32:
+	call	puts@PLT
+.LVL33:
+	.loc 1 83 3 view .LVU109
+	.loc 1 84 3 view .LVU110
+	.loc 1 84 26 is_stmt 0 view .LVU111
+	movl	$320000, %edi
+	call	malloc@PLT
+.LVL34:
+	movq	%rax, %rbx
+.LVL35:
+	.loc 1 85 3 is_stmt 1 view .LVU112
+	.loc 1 86 3 view .LVU113
+.LBB5:
+	.loc 1 86 8 view .LVU114
+	.loc 1 86 21 view .LVU115
+	.loc 1 86 12 is_stmt 0 view .LVU116
+	xorl	%r14d, %r14d
+.LBE5:
+	.loc 1 85 10 view .LVU117
+	xorl	%r15d, %r15d
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+.LBB6:
+	.loc 1 87 5 is_stmt 1 discriminator 3 view .LVU118
+	.loc 1 87 15 is_stmt 0 discriminator 3 view .LVU119
+	movl	%r14d, %edx
+	imulq	$613566757, %rdx, %rdx
+	movl	%r14d, %eax
+	movl	%r14d, %r9d
+	shrq	$32, %rdx
+	subl	%edx, %eax
+	shrl	%eax
+	addl	%edx, %eax
+	shrl	$2, %eax
+	leal	0(,%rax,8), %edx
+	subl	%eax, %edx
+	movq	%r12, %rsi
+	subq	%r15, %rsi
+	leaq	(%rbx,%r15), %rdi
+	subl	%edx, %r9d
+	movl	%r14d, %r8d
+	movl	%r14d, %ecx
+	movq	%r13, %rdx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+.LVL37:
+	cltq
+	.loc 1 86 30 discriminator 3 view .LVU120
+	incl	%r14d
+.LVL38:
+	.loc 1 87 12 discriminator 3 view .LVU121
+	addq	%rax, %r15
+.LVL39:
+	.loc 1 86 30 is_stmt 1 discriminator 3 view .LVU122
+	.loc 1 86 21 discriminator 3 view .LVU123
+	cmpl	$5000, %r14d
+	jne	.L35
+.LBE6:
+	.loc 1 90 3 view .LVU124
+.LVL40:
+	.loc 1 91 3 view .LVU125
+	.loc 1 91 32 is_stmt 0 view .LVU126
+	leaq	parallel_test_process(%rip), %rcx
+	leaq	parallel_test_merge(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	128(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	leaq	96(%rsp), %rax
+	movq	%rax, 40(%rsp)
+	leaq	64(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	leaq	48(%rsp), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%r10d, %r10d
+.LBB7:
+.LBB8:
+	.loc 1 96 7 view .LVU127
+	movq	%r15, 8(%rsp)
+.LBE8:
+.LBE7:
+	.loc 1 91 32 view .LVU128
+	vmovdqa	%xmm0, 48(%rsp)
+	.loc 1 92 3 is_stmt 1 view .LVU129
+.LBB11:
+	.loc 1 92 8 view .LVU130
+.LVL41:
+	.loc 1 92 21 view .LVU131
+.LBE11:
+	.loc 1 90 7 is_stmt 0 view .LVU132
+	xorl	%r14d, %r14d
+.LVL42:
+.LBB12:
+.LBB9:
+	.loc 1 96 7 view .LVU133
+	movq	%r10, %r15
+.LVL43:
+.L40:
+	.loc 1 93 5 is_stmt 1 view .LVU134
+	.loc 1 94 21 is_stmt 0 view .LVU135
+	movq	16(%rsp), %rax
+	movq	32(%rsp), %r9
+	movq	(%rax,%r15), %r13
+	movq	40(%rsp), %rax
+	movq	24(%rsp), %r8
+	movq	(%rax,%r15), %r12
+	movq	8(%rsp), %rsi
+	movq	%r13, %rcx
+	movq	%r12, %rdx
+	movq	%rbx, %rdi
+	.loc 1 93 30 view .LVU136
+	movq	$0, 64(%rsp)
+	movq	$0, 72(%rsp)
+	movl	$1, 80(%rsp)
+	.loc 1 94 5 is_stmt 1 view .LVU137
+	.loc 1 94 21 is_stmt 0 view .LVU138
+	call	st_parallel_lines@PLT
+.LVL44:
+	.loc 1 95 5 is_stmt 1 view .LVU139
+	.loc 1 95 54 is_stmt 0 view .LVU140
+	movq	72(%rsp), %rcx
+	.loc 1 95 8 view .LVU141
+	testl	%eax, %eax
+	je	.L37
+	.loc 1 95 24 discriminator 2 view .LVU142
+	movl	80(%rsp), %eax
+.LVL45:
+	.loc 1 95 24 discriminator 2 view .LVU143
+	testl	%eax, %eax
+	je	.L37
+	.loc 1 95 46 discriminator 4 view .LVU144
+	cmpq	$5000, %rcx
+	je	.L38
+.L37:
+	.loc 1 96 7 is_stmt 1 discriminator 5 view .LVU145
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL46:
+	.loc 1 97 7 discriminator 5 view .LVU146
+	.loc 1 98 7 discriminator 5 view .LVU147
+	.loc 1 97 19 is_stmt 0 discriminator 5 view .LVU148
+	movl	$1, %r14d
+.LVL47:
+.L39:
+	.loc 1 97 19 discriminator 5 view .LVU149
+.LBE9:
+	.loc 1 92 35 is_stmt 1 discriminator 2 view .LVU150
+	.loc 1 92 21 discriminator 2 view .LVU151
+	addq	$8, %r15
+.LVL48:
+	.loc 1 92 21 is_stmt 0 discriminator 2 view .LVU152
+	cmpq	$32, %r15
+	jne	.L40
+.LBE12:
+	.loc 1 103 3 is_stmt 1 view .LVU153
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL49:
+	.loc 1 104 3 view .LVU154
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL50:
+	.loc 1 106 3 view .LVU155
+	.loc 1 107 1 is_stmt 0 view .LVU156
+	leaq	-40(%rbp), %rsp
+.LVL51:
+	.loc 1 107 1 view .LVU157
+	popq	%rbx
+.LVL52:
+	.loc 1 107 1 view .LVU158
+	popq	%r12
+	popq	%r13
+	movl	%r14d, %eax
+	popq	%r14
+.LVL53:
+	.loc 1 107 1 view .LVU159
+	popq	%r15
+.LVL54:
+	.loc 1 107 1 view .LVU160
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL55:
+	.loc 1 107 1 view .LVU161
+	ret
+.LVL56:
+.L38:
+	.cfi_restore_state
+.LBB13:
+.LBB10:
+	.loc 1 101 5 is_stmt 1 view .LVU162
+	movl	$5000, %ecx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL57:
+	jmp	.L39
+.LBE10:
+.LBE13:
+	.cfi_endproc
+.LFE28:
+	.size	run_st_parallel_lines_unit_tests, .-run_st_parallel_lines_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC11:
+	.string	"------------------- st_parallel_serialize(x) -------------------"
+	.align 8
+.LC12:
+	.string	"[Failed] %zu items on %zu threads in batches of %zu failed.\n"
+	.align 8
+.LC14:
+	.string	"[Passed] %zu items on %zu threads in batches of %zu match the serial output.\n"
+	.text
+	.p2align 4
+	.globl	run_st_parallel_serialize_unit_tests
+	.type	run_st_parallel_serialize_unit_tests, @function
+run_st_parallel_serialize_unit_tests:
+.LFB30:
+	.loc 1 119 44 view -0
+	.cfi_startproc
+	.loc 1 121 3 view .LVU164
+	.loc 1 119 44 is_stmt 0 view .LVU165
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-32, %rsp
+	pushq	-8(%r10)
+	.loc 1 127 3 view .LVU166
+	leaq	.LC11(%rip), %rdi
+	.loc 1 119 44 view .LVU167
+	pushq	%rbp
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	pushq	%r14
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	leaq	.LC2(%rip), %r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	pushq	%rbx
+	subq	$320, %rsp
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	.loc 1 121 10 view .LVU168
+	vmovdqa	.LC9(%rip), %ymm0
+	movq	$0, -240(%rbp)
+	.loc 1 122 3 is_stmt 1 view .LVU169
+	.loc 1 121 10 is_stmt 0 view .LVU170
+	vmovdqa	%ymm0, -272(%rbp)
+	.loc 1 122 10 view .LVU171
+	vmovdqa	.LC3(%rip), %ymm0
+	movq	$4, -176(%rbp)
+	.loc 1 123 3 is_stmt 1 view .LVU172
+	.loc 1 122 10 is_stmt 0 view .LVU173
+	vmovdqa	%ymm0, -208(%rbp)
+	.loc 1 123 10 view .LVU174
+	movq	$16, -112(%rbp)
+	.loc 1 125 3 is_stmt 1 view .LVU175
+.LVL58:
+	.loc 1 127 3 view .LVU176
+	.loc 1 123 10 is_stmt 0 view .LVU177
+	vmovdqa	.LC10(%rip), %ymm0
+	vmovdqa	%ymm0, -144(%rbp)
+	.loc 1 127 3 view .LVU178
+	vzeroupper
+.LVL59:
+	call	puts@PLT
+.LVL60:
+	.loc 1 129 3 is_stmt 1 view .LVU179
+	.loc 1 130 3 view .LVU180
+.LBB20:
+	.loc 1 130 8 view .LVU181
+	.loc 1 130 21 view .LVU182
+	leaq	-272(%rbp), %rax
+	movq	%rax, -344(%rbp)
+	leaq	-144(%rbp), %rax
+	movq	%rax, -352(%rbp)
+	leaq	-208(%rbp), %rax
+	movq	%rax, -328(%rbp)
+	leaq	-96(%rbp), %rax
+	movq	%rax, -296(%rbp)
+	leaq	-274(%rbp), %rax
+.LBE20:
+	.loc 1 129 7 is_stmt 0 view .LVU183
+	movl	$0, -316(%rbp)
+	movq	%rax, -336(%rbp)
+	.loc 1 127 3 view .LVU184
+	xorl	%r15d, %r15d
+.LVL61:
+	.p2align 4,,10
+	.p2align 3
+.L60:
+.LBB36:
+.LBB21:
+	.loc 1 132 5 is_stmt 1 view .LVU185
+	.loc 1 132 40 is_stmt 0 view .LVU186
+	movl	$1, %edi
+	call	st_create_empty@PLT
+.LVL62:
+	.loc 1 133 5 view .LVU187
+	movq	%rax, %rdi
+	movl	$91, %esi
+	.loc 1 132 40 view .LVU188
+	movq	%rax, %rbx
+.LVL63:
+	.loc 1 133 5 is_stmt 1 view .LVU189
+	call	st_append_char@PLT
+.LVL64:
+	.loc 1 134 5 view .LVU190
+.LBB22:
+	.loc 1 134 10 view .LVU191
+	.loc 1 134 34 view .LVU192
+	.loc 1 134 48 is_stmt 0 view .LVU193
+	movq	-344(%rbp), %rax
+	.loc 1 134 17 view .LVU194
+	xorl	%r13d, %r13d
+	.loc 1 134 48 view .LVU195
+	movq	(%rax,%r15), %r12
+	.loc 1 134 34 view .LVU196
+	testq	%r12, %r12
+	jne	.L45
+	jmp	.L46
+.LVL65:
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	.loc 1 134 58 is_stmt 1 view .LVU197
+	incq	%r13
+.LVL66:
+	.loc 1 134 34 view .LVU198
+	cmpq	%r12, %r13
+	je	.L46
+.L50:
+	.loc 1 135 7 view .LVU199
+	.loc 1 136 9 view .LVU200
+	movl	$44, %esi
+	movq	%rbx, %rdi
+	call	st_append_char@PLT
+.LVL67:
+.L45:
+	.loc 1 138 7 discriminator 2 view .LVU201
+.LBB23:
+.LBI23:
+	.loc 1 112 12 discriminator 2 view .LVU202
+.LBB24:
+	.loc 1 113 3 discriminator 2 view .LVU203
+	.loc 1 113 10 is_stmt 0 discriminator 2 view .LVU204
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	st_append_string@PLT
+.LVL68:
+	.loc 1 113 94 discriminator 2 view .LVU205
+	testl	%eax, %eax
+	je	.L48
+	.loc 1 113 53 view .LVU206
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	st_append_int@PLT
+.LVL69:
+	.loc 1 113 50 view .LVU207
+	testl	%eax, %eax
+	je	.L48
+	.loc 1 113 97 view .LVU208
+	movl	$125, %esi
+	movq	%rbx, %rdi
+.LBE24:
+.LBE23:
+	.loc 1 134 58 view .LVU209
+	incq	%r13
+.LVL70:
+.LBB26:
+.LBB25:
+	.loc 1 113 97 view .LVU210
+	call	st_append_char@PLT
+.LVL71:
+	.loc 1 113 97 view .LVU211
+.LBE25:
+.LBE26:
+	.loc 1 134 58 is_stmt 1 view .LVU212
+	.loc 1 134 34 view .LVU213
+	cmpq	%r12, %r13
+	jne	.L50
+.LVL72:
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	.loc 1 134 34 is_stmt 0 view .LVU214
+.LBE22:
+	.loc 1 140 5 is_stmt 1 view .LVU215
+	movl	$93, %esi
+	movq	%rbx, %rdi
+	call	st_append_char@PLT
+.LVL73:
+	.loc 1 142 5 view .LVU216
+	.loc 1 143 5 view .LVU217
+	.loc 1 143 38 is_stmt 0 view .LVU218
+	movl	$1, %edi
+	call	st_create_empty@PLT
+.LVL74:
+	.loc 1 144 5 view .LVU219
+	movq	%rax, %rdi
+	movl	$91, %esi
+	.loc 1 143 38 view .LVU220
+	movq	%rax, %r13
+.LVL75:
+	.loc 1 144 5 is_stmt 1 view .LVU221
+	call	st_append_char@PLT
+.LVL76:
+	.loc 1 145 5 view .LVU222
+	.loc 1 145 10 is_stmt 0 view .LVU223
+	movl	$44, %eax
+	movw	%ax, -274(%rbp)
+	.loc 1 146 5 is_stmt 1 view .LVU224
+	.loc 1 146 22 is_stmt 0 view .LVU225
+	movq	-352(%rbp), %rax
+	subq	$8, %rsp
+	movq	(%rax,%r15), %rcx
+	movq	-328(%rbp), %rax
+	movq	%rcx, -304(%rbp)
+	movq	(%rax,%r15), %rax
+	movq	-296(%rbp), %rdi
+	movq	%rax, -312(%rbp)
+	pushq	-336(%rbp)
+	movq	%rax, %rdx
+	xorl	%r9d, %r9d
+	leaq	parallel_test_serialize(%rip), %r8
+	movq	%r12, %rsi
+	call	st_parallel_serialize@PLT
+.LVL77:
+	.loc 1 148 5 is_stmt 1 view .LVU226
+	.loc 1 148 18 is_stmt 0 view .LVU227
+	movb	$35, -274(%rbp)
+	.loc 1 149 5 is_stmt 1 view .LVU228
+	.loc 1 149 74 is_stmt 0 view .LVU229
+	popq	%rdx
+	popq	%rcx
+	testl	%eax, %eax
+	jne	.L51
+.LVL78:
+.L55:
+	.loc 1 156 7 is_stmt 1 view .LVU230
+	movq	-304(%rbp), %rcx
+	movq	-312(%rbp), %rdx
+	movq	%r12, %rsi
+	leaq	.LC12(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL79:
+	.loc 1 157 7 view .LVU231
+	.loc 1 157 19 is_stmt 0 view .LVU232
+	movl	$1, -316(%rbp)
+.LVL80:
+.L52:
+	.loc 1 163 5 is_stmt 1 discriminator 2 view .LVU233
+	movq	-296(%rbp), %rdi
+.LBE21:
+	.loc 1 130 21 is_stmt 0 discriminator 2 view .LVU234
+	addq	$8, %r15
+.LVL81:
+.LBB34:
+	.loc 1 163 5 discriminator 2 view .LVU235
+	call	st_fragments_free@PLT
+.LVL82:
+	.loc 1 164 5 is_stmt 1 discriminator 2 view .LVU236
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL83:
+	.loc 1 165 5 discriminator 2 view .LVU237
+	movq	%r13, %rdi
+	call	st_destroy@PLT
+.LVL84:
+.LBE34:
+	.loc 1 130 35 discriminator 2 view .LVU238
+	.loc 1 130 21 discriminator 2 view .LVU239
+	cmpq	$40, %r15
+	jne	.L60
+.LBE36:
+	.loc 1 167 3 view .LVU240
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL85:
+	.loc 1 169 3 view .LVU241
+	.loc 1 170 1 is_stmt 0 view .LVU242
+	movl	-316(%rbp), %eax
+	leaq	-48(%rbp), %rsp
+	popq	%rbx
+.LVL86:
+	.loc 1 170 1 view .LVU243
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+.LVL87:
+	.loc 1 170 1 view .LVU244
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+.LVL88:
+	.loc 1 170 1 view .LVU245
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+	ret
+.LVL89:
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	.cfi_restore_state
+.LBB37:
+.LBB35:
+	.loc 1 149 34 discriminator 1 view .LVU246
+	movq	-296(%rbp), %rdi
+	movq	%r13, %rsi
+	call	st_fragments_stitch@PLT
+.LVL90:
+	.loc 1 149 34 discriminator 1 view .LVU247
+	movl	%eax, %edi
+	.loc 1 149 31 discriminator 1 view .LVU248
+	testl	%eax, %eax
+	jne	.L53
+.LBB27:
+	.loc 1 152 51 view .LVU249
+	movq	-72(%rbp), %rsi
+	.loc 1 153 30 view .LVU250
+	movq	-80(%rbp), %rcx
+.LVL91:
+	.loc 1 152 35 view .LVU251
+	testq	%rsi, %rsi
+	je	.L55
+.L54:
+	leaq	-1(%rsi), %r8
+	cmpq	$4, %r8
+	jbe	.L63
+	movq	%r8, %rdx
+	shrq	$2, %rdx
+	salq	$6, %rdx
+	movq	%rcx, %rax
+	addq	%rcx, %rdx
+.LBE27:
+.LBB28:
+	.loc 1 134 17 view .LVU252
+	vpxor	%xmm1, %xmm1, %xmm1
+.LVL92:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	.loc 1 134 17 view .LVU253
+.LBE28:
+.LBB29:
+	.loc 1 153 7 is_stmt 1 discriminator 4 view .LVU254
+	.loc 1 153 37 is_stmt 0 discriminator 4 view .LVU255
+	vmovdqu	8(%rax), %ymm0
+	vmovdqa	.LC13(%rip), %ymm2
+	addq	$64, %rax
+	vpermt2q	-24(%rax), %ymm2, %ymm0
+	.loc 1 153 18 discriminator 4 view .LVU256
+	vpaddq	%ymm0, %ymm1, %ymm1
+.LVL93:
+	.loc 1 152 64 is_stmt 1 discriminator 4 view .LVU257
+	.loc 1 152 35 discriminator 4 view .LVU258
+	.loc 1 152 35 is_stmt 0 discriminator 4 view .LVU259
+	cmpq	%rdx, %rax
+	jne	.L58
+	vmovdqa	%xmm1, %xmm0
+	vextracti64x2	$0x1, %ymm1, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	movq	%r8, %rax
+	vpaddq	%xmm1, %xmm0, %xmm0
+	andq	$-4, %rax
+	vmovq	%xmm0, %rdx
+	vzeroupper
+.LVL94:
+.L57:
+	.loc 1 153 7 is_stmt 1 view .LVU260
+	.loc 1 153 34 is_stmt 0 view .LVU261
+	movq	%rax, %r8
+	salq	$4, %r8
+	.loc 1 152 64 view .LVU262
+	leaq	1(%rax), %r9
+	.loc 1 153 18 view .LVU263
+	addq	8(%rcx,%r8), %rdx
+.LVL95:
+	.loc 1 152 64 is_stmt 1 view .LVU264
+	.loc 1 152 35 view .LVU265
+	.loc 1 152 35 is_stmt 0 view .LVU266
+	cmpq	%rsi, %r9
+	jnb	.L56
+	.loc 1 153 7 is_stmt 1 view .LVU267
+	.loc 1 152 64 is_stmt 0 view .LVU268
+	leaq	2(%rax), %r9
+	.loc 1 153 18 view .LVU269
+	addq	24(%rcx,%r8), %rdx
+.LVL96:
+	.loc 1 152 64 is_stmt 1 view .LVU270
+	.loc 1 152 35 view .LVU271
+	.loc 1 152 35 is_stmt 0 view .LVU272
+	cmpq	%rsi, %r9
+	jnb	.L56
+	.loc 1 153 7 is_stmt 1 view .LVU273
+	.loc 1 152 64 is_stmt 0 view .LVU274
+	leaq	3(%rax), %r9
+	.loc 1 153 18 view .LVU275
+	addq	40(%rcx,%r8), %rdx
+.LVL97:
+	.loc 1 152 64 is_stmt 1 view .LVU276
+	.loc 1 152 35 view .LVU277
+	.loc 1 152 35 is_stmt 0 view .LVU278
+	cmpq	%rsi, %r9
+	jnb	.L56
+	.loc 1 153 7 is_stmt 1 view .LVU279
+	.loc 1 152 64 is_stmt 0 view .LVU280
+	addq	$4, %rax
+	.loc 1 153 18 view .LVU281
+	addq	56(%rcx,%r8), %rdx
+.LVL98:
+	.loc 1 152 64 is_stmt 1 view .LVU282
+	.loc 1 152 35 view .LVU283
+	.loc 1 152 35 is_stmt 0 view .LVU284
+	cmpq	%rsi, %rax
+	jnb	.L56
+	.loc 1 153 7 is_stmt 1 view .LVU285
+	.loc 1 153 18 is_stmt 0 view .LVU286
+	addq	72(%rcx,%r8), %rdx
+.LVL99:
+	.loc 1 152 64 is_stmt 1 view .LVU287
+	.loc 1 152 35 view .LVU288
+.L56:
+	.loc 1 152 35 is_stmt 0 view .LVU289
+	movq	%rdx, -360(%rbp)
+.LBE29:
+	.loc 1 155 5 is_stmt 1 view .LVU290
+	.loc 1 155 8 is_stmt 0 view .LVU291
+	testl	%edi, %edi
+	je	.L55
+	.loc 1 155 26 discriminator 1 view .LVU292
+	movq	(%rbx), %rsi
+	movq	0(%r13), %rdi
+	call	strcmp@PLT
+.LVL100:
+	.loc 1 155 23 discriminator 1 view .LVU293
+	testl	%eax, %eax
+	jne	.L55
+	.loc 1 155 72 discriminator 2 view .LVU294
+	movq	-360(%rbp), %rdx
+	cmpq	%rdx, -64(%rbp)
+	jne	.L55
+	.loc 1 155 126 discriminator 3 view .LVU295
+	addq	$2, %rdx
+	.loc 1 155 106 discriminator 3 view .LVU296
+	cmpq	16(%rbx), %rdx
+	jne	.L55
+	.loc 1 161 7 is_stmt 1 view .LVU297
+	movq	-304(%rbp), %rcx
+	movq	-312(%rbp), %rdx
+	movq	%r12, %rsi
+	leaq	.LC14(%rip), %rdi
+	call	printf@PLT
+.LVL101:
+	jmp	.L52
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.loc 1 149 77 is_stmt 0 discriminator 3 view .LVU298
+	movl	$93, %esi
+	movq	%r13, %rdi
+	call	st_append_char@PLT
+.LVL102:
+.LBB30:
+	.loc 1 152 51 discriminator 3 view .LVU299
+	movq	-72(%rbp), %rsi
+.LBE30:
+	.loc 1 149 74 discriminator 3 view .LVU300
+	xorl	%edi, %edi
+	testl	%eax, %eax
+.LBB31:
+	.loc 1 153 30 discriminator 3 view .LVU301
+	movq	-80(%rbp), %rcx
+.LBE31:
+	.loc 1 149 74 discriminator 3 view .LVU302
+	setne	%dil
+.LVL103:
+	.loc 1 151 5 is_stmt 1 discriminator 3 view .LVU303
+	.loc 1 152 5 discriminator 3 view .LVU304
+.LBB32:
+	.loc 1 152 10 discriminator 3 view .LVU305
+	.loc 1 152 35 discriminator 3 view .LVU306
+	.loc 1 152 35 is_stmt 0 discriminator 3 view .LVU307
+	testq	%rsi, %rsi
+	jne	.L54
+.LBE32:
+	.loc 1 151 12 view .LVU308
+	xorl	%edx, %edx
+	jmp	.L56
+.L63:
+.LBB33:
+	.loc 1 152 17 view .LVU309
+	xorl	%eax, %eax
+.LBE33:
+	.loc 1 151 12 view .LVU310
+	xorl	%edx, %edx
+	jmp	.L57
+.LBE35:
+.LBE37:
+	.cfi_endproc
+.LFE30:
+	.size	run_st_parallel_serialize_unit_tests, .-run_st_parallel_serialize_unit_tests
+	.p2align 4
+	.globl	run_parallel_tests
+	.type	run_parallel_tests, @function
+run_parallel_tests:
+.LFB31:
+	.loc 1 175 26 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 177 3 view .LVU312
+	.loc 1 175 26 is_stmt 0 view .LVU313
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 177 7 view .LVU314
+	xorl	%eax, %eax
+	call	run_st_parallel_lines_unit_tests@PLT
+.LVL104:
+	.loc 1 177 6 view .LVU315
+	cmpl	$1, %eax
+	je	.L75
+	.loc 1 181 3 is_stmt 1 view .LVU316
+	.loc 1 181 7 is_stmt 0 view .LVU317
+	xorl	%eax, %eax
+	call	run_st_parallel_serialize_unit_tests@PLT
+.LVL105:
+	.loc 1 181 6 view .LVU318
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+.L75:
+	.loc 1 186 1 view .LVU319
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	run_parallel_tests, .-run_parallel_tests
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC3:
+	.quad	1
+	.quad	4
+	.quad	0
+	.quad	8
+	.align 32
+.LC4:
+	.quad	64
+	.quad	1000
+	.quad	0
+	.quad	1
+	.align 32
+.LC9:
+	.quad	5000
+	.quad	5000
+	.quad	5000
+	.quad	1
+	.align 32
+.LC10:
+	.quad	64
+	.quad	1
+	.quad	0
+	.quad	16
+	.align 32
+.LC13:
+	.quad	0
+	.quad	2
+	.quad	4
+	.quad	6
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/stdio.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "/root/repo/tests/../include/strutils.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "/usr/include/stdlib.h"
+	.file 11 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x10a1
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x25
+	.long	.LASF129
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xc
+	.long	.LASF8
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x11
+	.long	0x2e
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x26
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xc
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xc
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xc
+	.long	.LASF12
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x7e
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x11
+	.long	0xa2
+	.uleb128 0xc
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x13
+	.long	0x91
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF15
+	.uleb128 0xc
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x13
+	.long	0x72
+	.uleb128 0x11
+	.long	0xc1
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF17
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0xc
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0x85
+	.uleb128 0xd
+	.long	.LASF23
+	.byte	0x18
+	.value	0x175
+	.long	0x11e
+	.uleb128 0x3
+	.long	.LASF19
+	.value	0x17a
+	.byte	0x1c
+	.long	0x123
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF20
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF21
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF130
+	.uleb128 0x5
+	.long	0x11e
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF22
+	.uleb128 0xd
+	.long	.LASF24
+	.byte	0x40
+	.value	0x1e6
+	.long	0x1a4
+	.uleb128 0x3
+	.long	.LASF25
+	.value	0x1eb
+	.byte	0xc
+	.long	0xde
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF26
+	.value	0x1f0
+	.byte	0xc
+	.long	0xde
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF27
+	.value	0x1f5
+	.byte	0xc
+	.long	0xde
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF28
+	.value	0x1fa
+	.byte	0xc
+	.long	0xde
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF29
+	.value	0x1ff
+	.byte	0xc
+	.long	0xde
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF30
+	.value	0x204
+	.byte	0xc
+	.long	0xde
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF31
+	.value	0x209
+	.byte	0xc
+	.long	0xde
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF32
+	.value	0x20e
+	.byte	0xc
+	.long	0xde
+	.byte	0x38
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF33
+	.byte	0x38
+	.value	0x26c
+	.long	0x218
+	.uleb128 0x3
+	.long	.LASF34
+	.value	0x272
+	.byte	0xd
+	.long	0x231
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF35
+	.value	0x277
+	.byte	0x9
+	.long	0x4d
+	.byte	0x8
+	.uleb128 0x19
+	.string	"fd"
+	.value	0x27c
+	.byte	0x7
+	.long	0x6b
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF36
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF37
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF38
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x19
+	.string	"eof"
+	.value	0x290
+	.byte	0x7
+	.long	0x6b
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF39
+	.value	0x295
+	.byte	0x7
+	.long	0x6b
+	.byte	0x34
+	.byte	0
+	.uleb128 0x14
+	.long	0xae
+	.long	0x231
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x9d
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x218
+	.uleb128 0x1e
+	.long	.LASF42
+	.long	0x46
+	.value	0x29b
+	.long	0x252
+	.uleb128 0xe
+	.long	.LASF40
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF43
+	.long	0x46
+	.value	0x2b5
+	.long	0x27a
+	.uleb128 0xe
+	.long	.LASF44
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF45
+	.byte	0x1
+	.uleb128 0xe
+	.long	.LASF46
+	.byte	0x2
+	.uleb128 0xe
+	.long	.LASF47
+	.byte	0x3
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF48
+	.value	0x158
+	.byte	0x7
+	.value	0x2cf
+	.byte	0x8
+	.long	0x328
+	.uleb128 0x3
+	.long	.LASF49
+	.value	0x2d4
+	.byte	0x9
+	.long	0x9d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF50
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF51
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF52
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF53
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x236
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF54
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF55
+	.value	0x2f2
+	.byte	0x18
+	.long	0x328
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF56
+	.value	0x2f7
+	.byte	0x18
+	.long	0x252
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF57
+	.value	0x2fc
+	.byte	0x17
+	.long	0x32d
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF58
+	.value	0x301
+	.byte	0x8
+	.long	0x332
+	.byte	0x48
+	.uleb128 0x1f
+	.long	.LASF59
+	.value	0x306
+	.byte	0x21
+	.long	0x390
+	.value	0x148
+	.uleb128 0x1f
+	.long	.LASF60
+	.value	0x30b
+	.byte	0x17
+	.long	0x395
+	.value	0x150
+	.byte	0
+	.uleb128 0x5
+	.long	0x1a4
+	.uleb128 0x5
+	.long	0xea
+	.uleb128 0x15
+	.long	0xa2
+	.long	0x342
+	.uleb128 0x16
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF61
+	.byte	0x28
+	.value	0x764
+	.long	0x390
+	.uleb128 0x3
+	.long	.LASF62
+	.value	0x769
+	.byte	0xb
+	.long	0x3a1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF63
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF64
+	.value	0x774
+	.byte	0xd
+	.long	0x3a6
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF50
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF65
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x342
+	.uleb128 0x5
+	.long	0x12f
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF66
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x5
+	.long	0xde
+	.uleb128 0x1a
+	.long	.LASF67
+	.byte	0x10
+	.byte	0x8
+	.byte	0x1a
+	.long	0x3d2
+	.uleb128 0xb
+	.long	.LASF68
+	.byte	0x8
+	.byte	0x1c
+	.byte	0xb
+	.long	0x4d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF69
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xc
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF70
+	.byte	0x10
+	.value	0x7da
+	.long	0x3f9
+	.uleb128 0x3
+	.long	.LASF71
+	.value	0x7e0
+	.byte	0x9
+	.long	0x421
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF72
+	.value	0x7e6
+	.byte	0x9
+	.long	0x43a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.long	0x3d2
+	.uleb128 0x14
+	.long	0x6b
+	.long	0x417
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x417
+	.uleb128 0x2
+	.long	0x41c
+	.byte	0
+	.uleb128 0x5
+	.long	0x27a
+	.uleb128 0x5
+	.long	0x4d
+	.uleb128 0x5
+	.long	0x3fe
+	.uleb128 0x14
+	.long	0x6b
+	.long	0x43a
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x5
+	.long	0x426
+	.uleb128 0xd
+	.long	.LASF73
+	.byte	0x30
+	.value	0x807
+	.long	0x49a
+	.uleb128 0x3
+	.long	.LASF74
+	.value	0x80c
+	.byte	0x1c
+	.long	0x49f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF63
+	.value	0x811
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x19
+	.string	"iov"
+	.value	0x816
+	.byte	0x11
+	.long	0x4a4
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF75
+	.value	0x81b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF50
+	.value	0x820
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF76
+	.value	0x825
+	.byte	0x9
+	.long	0x9d
+	.byte	0x28
+	.byte	0
+	.uleb128 0x11
+	.long	0x43f
+	.uleb128 0x5
+	.long	0x417
+	.uleb128 0x5
+	.long	0x3ab
+	.uleb128 0x1a
+	.long	.LASF77
+	.byte	0x18
+	.byte	0x1
+	.byte	0xb
+	.long	0x4dd
+	.uleb128 0xb
+	.long	.LASF78
+	.byte	0x1
+	.byte	0xc
+	.byte	0x8
+	.long	0x7e
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF79
+	.byte	0x1
+	.byte	0xd
+	.byte	0x8
+	.long	0x7e
+	.byte	0x8
+	.uleb128 0xb
+	.long	.LASF63
+	.byte	0x1
+	.byte	0xe
+	.byte	0x8
+	.long	0x7e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF80
+	.byte	0x18
+	.byte	0x1
+	.byte	0x14
+	.long	0x511
+	.uleb128 0xb
+	.long	.LASF81
+	.byte	0x1
+	.byte	0x15
+	.byte	0x8
+	.long	0x7e
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF63
+	.byte	0x1
+	.byte	0x16
+	.byte	0x8
+	.long	0x7e
+	.byte	0x8
+	.uleb128 0xb
+	.long	.LASF82
+	.byte	0x1
+	.byte	0x17
+	.byte	0x7
+	.long	0x6b
+	.byte	0x10
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF83
+	.byte	0x7
+	.value	0x583
+	.byte	0x5
+	.long	0x6b
+	.long	0x52d
+	.uleb128 0x2
+	.long	0x417
+	.uleb128 0x2
+	.long	0xcd
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF84
+	.byte	0x7
+	.value	0x519
+	.byte	0x5
+	.long	0x6b
+	.long	0x549
+	.uleb128 0x2
+	.long	0x417
+	.uleb128 0x2
+	.long	0xd9
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF85
+	.byte	0x7
+	.value	0x403
+	.byte	0x6
+	.long	0x55c
+	.uleb128 0x2
+	.long	0x417
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF86
+	.byte	0x7
+	.value	0x858
+	.byte	0x6
+	.long	0x56f
+	.uleb128 0x2
+	.long	0x56f
+	.byte	0
+	.uleb128 0x5
+	.long	0x43f
+	.uleb128 0x2a
+	.long	.LASF87
+	.byte	0x9
+	.byte	0x9c
+	.byte	0xc
+	.long	0x6b
+	.long	0x58f
+	.uleb128 0x2
+	.long	0xd9
+	.uleb128 0x2
+	.long	0xd9
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF88
+	.byte	0x7
+	.value	0x850
+	.byte	0x5
+	.long	0x6b
+	.long	0x5ab
+	.uleb128 0x2
+	.long	0x5ab
+	.uleb128 0x2
+	.long	0x417
+	.byte	0
+	.uleb128 0x5
+	.long	0x49a
+	.uleb128 0x7
+	.long	.LASF89
+	.byte	0x7
+	.value	0x841
+	.byte	0x5
+	.long	0x6b
+	.long	0x5e5
+	.uleb128 0x2
+	.long	0x56f
+	.uleb128 0x2
+	.long	0x3a
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x5e5
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0xd9
+	.byte	0
+	.uleb128 0x5
+	.long	0x5ea
+	.uleb128 0x14
+	.long	0x6b
+	.long	0x603
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x417
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF90
+	.byte	0x7
+	.value	0x535
+	.byte	0x5
+	.long	0x6b
+	.long	0x61f
+	.uleb128 0x2
+	.long	0x417
+	.uleb128 0x2
+	.long	0xa9
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF91
+	.byte	0x7
+	.value	0x353
+	.byte	0x19
+	.long	0x417
+	.long	0x636
+	.uleb128 0x2
+	.long	0x3a
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF92
+	.byte	0x7
+	.value	0x416
+	.byte	0x6
+	.long	0xa2
+	.long	0x64d
+	.uleb128 0x2
+	.long	0x417
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF93
+	.byte	0x7
+	.value	0x40b
+	.byte	0x6
+	.long	0x660
+	.uleb128 0x2
+	.long	0x417
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF94
+	.byte	0x7
+	.value	0x4a4
+	.byte	0x5
+	.long	0x6b
+	.long	0x67c
+	.uleb128 0x2
+	.long	0x417
+	.uleb128 0x2
+	.long	0x67c
+	.byte	0
+	.uleb128 0x5
+	.long	0x39a
+	.uleb128 0x7
+	.long	.LASF95
+	.byte	0x7
+	.value	0x753
+	.byte	0x5
+	.long	0x6b
+	.long	0x69d
+	.uleb128 0x2
+	.long	0x417
+	.uleb128 0x2
+	.long	0xd9
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF96
+	.byte	0xa
+	.value	0x238
+	.byte	0xd
+	.long	0x6b0
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF97
+	.byte	0x4
+	.value	0x164
+	.byte	0xc
+	.long	0x6b
+	.long	0x6c8
+	.uleb128 0x2
+	.long	0xd9
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF98
+	.byte	0x7
+	.value	0x802
+	.byte	0x5
+	.long	0x6b
+	.long	0x6f8
+	.uleb128 0x2
+	.long	0x9d
+	.uleb128 0x2
+	.long	0x3a
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x6f8
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x5
+	.long	0x3f9
+	.uleb128 0x7
+	.long	.LASF99
+	.byte	0x4
+	.value	0x17a
+	.byte	0xc
+	.long	0x6b
+	.long	0x71f
+	.uleb128 0x2
+	.long	0x9d
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0xd9
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF100
+	.byte	0xa
+	.value	0x229
+	.byte	0xe
+	.long	0x4d
+	.long	0x736
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF101
+	.byte	0xaf
+	.long	0x6b
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x771
+	.uleb128 0x12
+	.quad	.LVL104
+	.long	0xbd0
+	.uleb128 0x12
+	.quad	.LVL105
+	.long	0x771
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF102
+	.byte	0x77
+	.long	0x6b
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb80
+	.uleb128 0x9
+	.long	.LASF103
+	.byte	0x79
+	.byte	0xa
+	.long	0xb80
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -272
+	.uleb128 0x9
+	.long	.LASF104
+	.byte	0x7a
+	.byte	0xa
+	.long	0xb80
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -208
+	.uleb128 0x9
+	.long	.LASF105
+	.byte	0x7b
+	.byte	0xa
+	.long	0xb80
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -144
+	.uleb128 0x21
+	.long	.LASF106
+	.byte	0x7d
+	.long	0x6b
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF107
+	.byte	0x81
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xf
+	.long	.LLRL22
+	.long	0xb33
+	.uleb128 0x18
+	.string	"i"
+	.byte	0x82
+	.byte	0xc
+	.long	0x6b
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x22
+	.long	.LLRL24
+	.uleb128 0x6
+	.long	.LASF108
+	.byte	0x84
+	.byte	0x1d
+	.long	0x417
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x9
+	.long	.LASF74
+	.byte	0x8e
+	.byte	0x1c
+	.long	0x43f
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -96
+	.uleb128 0x6
+	.long	.LASF109
+	.byte	0x8f
+	.byte	0x1d
+	.long	0x417
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x9
+	.long	.LASF76
+	.byte	0x91
+	.byte	0xa
+	.long	0xb90
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -274
+	.uleb128 0x6
+	.long	.LASF110
+	.byte	0x92
+	.byte	0x9
+	.long	0x6b
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x6
+	.long	.LASF111
+	.byte	0x95
+	.byte	0x9
+	.long	0x6b
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x6
+	.long	.LASF112
+	.byte	0x97
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xf
+	.long	.LLRL30
+	.long	0x946
+	.uleb128 0x6
+	.long	.LASF113
+	.byte	0x86
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x2b
+	.long	0xba0
+	.quad	.LBI23
+	.byte	.LVU202
+	.long	.LLRL32
+	.byte	0x1
+	.byte	0x8a
+	.byte	0x7
+	.long	0x92b
+	.uleb128 0x10
+	.long	0xbb1
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x10
+	.long	0xbc5
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x10
+	.long	0xbbb
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x4
+	.quad	.LVL68
+	.long	0x52d
+	.long	0x8f2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL69
+	.long	0x511
+	.long	0x910
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL71
+	.long	0x603
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7d
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL67
+	.long	0x603
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2c
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL36
+	.long	0x961
+	.uleb128 0x18
+	.string	"j"
+	.byte	0x98
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST37
+	.long	.LVUS37
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL62
+	.long	0x61f
+	.long	0x978
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL64
+	.long	0x603
+	.long	0x996
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5b
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL73
+	.long	0x603
+	.long	0x9b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5d
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL74
+	.long	0x61f
+	.long	0x9cb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL76
+	.long	0x603
+	.long	0x9e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5b
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL77
+	.long	0x5b0
+	.long	0xa36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -296
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -328
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -352
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	parallel_test_serialize
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -240
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL79
+	.long	0x6b0
+	.long	0xa6b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -312
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -304
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL82
+	.long	0x55c
+	.long	0xa85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -296
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL83
+	.long	0x549
+	.long	0xa9d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL84
+	.long	0x549
+	.long	0xab5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL90
+	.long	0x58f
+	.long	0xad5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -296
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL100
+	.long	0x574
+	.uleb128 0x4
+	.quad	.LVL101
+	.long	0x6b0
+	.long	0xb17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -312
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -304
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL102
+	.long	0x603
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL59
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.quad	.LVL60
+	.long	0x1092
+	.long	0xb5d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL85
+	.long	0x109b
+	.long	0xb74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL94
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x15
+	.long	0x2e
+	.long	0xb90
+	.uleb128 0x16
+	.long	0x3f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x15
+	.long	0xa2
+	.long	0xba0
+	.uleb128 0x16
+	.long	0x3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF131
+	.byte	0x1
+	.byte	0x70
+	.byte	0xc
+	.long	0x6b
+	.byte	0x1
+	.long	0xbd0
+	.uleb128 0x1d
+	.long	.LASF35
+	.byte	0x2a
+	.long	0x4d
+	.uleb128 0x1d
+	.long	.LASF114
+	.byte	0x4b
+	.long	0x417
+	.uleb128 0x1d
+	.long	.LASF113
+	.byte	0x5d
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF115
+	.byte	0x4a
+	.long	0x6b
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe33
+	.uleb128 0x9
+	.long	.LASF104
+	.byte	0x4c
+	.byte	0xa
+	.long	0xe33
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0x9
+	.long	.LASF116
+	.byte	0x4d
+	.byte	0xa
+	.long	0xe33
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x21
+	.long	.LASF106
+	.byte	0x4f
+	.long	0x6b
+	.byte	0x4
+	.uleb128 0x2d
+	.long	.LASF117
+	.byte	0x1
+	.byte	0x53
+	.byte	0xa
+	.long	0x2e
+	.long	0x4e200
+	.uleb128 0x6
+	.long	.LASF49
+	.byte	0x54
+	.byte	0x9
+	.long	0x9d
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x6
+	.long	.LASF50
+	.byte	0x55
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x6
+	.long	.LASF107
+	.byte	0x5a
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x9
+	.long	.LASF118
+	.byte	0x5b
+	.byte	0x20
+	.long	0x3d2
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 48
+	.uleb128 0xf
+	.long	.LLRL15
+	.long	0xcf0
+	.uleb128 0x18
+	.string	"i"
+	.byte	0x56
+	.byte	0xc
+	.long	0x6b
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xa
+	.quad	.LVL37
+	.long	0x6fd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2f
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xc
+	.long	0x24924925
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x20
+	.byte	0x25
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xc
+	.long	0x24924925
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x20
+	.byte	0x25
+	.byte	0x22
+	.byte	0x32
+	.byte	0x25
+	.byte	0x37
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL17
+	.long	0xdc5
+	.uleb128 0x18
+	.string	"i"
+	.byte	0x5c
+	.byte	0xc
+	.long	0x6b
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x22
+	.long	.LLRL19
+	.uleb128 0x9
+	.long	.LASF119
+	.byte	0x5d
+	.byte	0x1e
+	.long	0x4dd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x6
+	.long	.LASF120
+	.byte	0x5e
+	.byte	0x9
+	.long	0x6b
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x4
+	.quad	.LVL44
+	.long	0x6c8
+	.long	0xd6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 8
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 32
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL46
+	.long	0x6b0
+	.long	0xd95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL57
+	.long	0x6b0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1388
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL32
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.quad	.LVL33
+	.long	0x1092
+	.long	0xdef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL34
+	.long	0x71f
+	.long	0xe07
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL49
+	.long	0x69d
+	.long	0xe1f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL50
+	.long	0x109b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x2e
+	.long	0xe43
+	.uleb128 0x16
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF123
+	.byte	0x39
+	.long	0x6b
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xeca
+	.uleb128 0x13
+	.long	.LASF35
+	.byte	0x39
+	.byte	0x26
+	.long	0x4d
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x13
+	.long	.LASF121
+	.byte	0x39
+	.byte	0x35
+	.long	0x4d
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x6
+	.long	.LASF119
+	.byte	0x3a
+	.byte	0x1d
+	.long	0xeca
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x6
+	.long	.LASF122
+	.byte	0x3b
+	.byte	0x1e
+	.long	0xecf
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x12
+	.quad	.LVL3
+	.long	0x69d
+	.uleb128 0x12
+	.quad	.LVL5
+	.long	0x69d
+	.byte	0
+	.uleb128 0x5
+	.long	0x4dd
+	.uleb128 0x5
+	.long	0x4a9
+	.uleb128 0x23
+	.long	.LASF124
+	.byte	0x1d
+	.long	0x6b
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xff2
+	.uleb128 0x13
+	.long	.LASF35
+	.byte	0x1d
+	.byte	0x28
+	.long	0x4d
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x13
+	.long	.LASF114
+	.byte	0x1d
+	.byte	0x49
+	.long	0x417
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x13
+	.long	.LASF121
+	.byte	0x1d
+	.byte	0x5b
+	.long	0x41c
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x6
+	.long	.LASF122
+	.byte	0x1e
+	.byte	0x1e
+	.long	0xecf
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xf
+	.long	.LLRL8
+	.long	0xfc6
+	.uleb128 0x2e
+	.string	"id"
+	.byte	0x1
+	.byte	0x27
+	.byte	0xc
+	.long	0x39a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.quad	.LVL11
+	.long	0x681
+	.long	0xf75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL12
+	.long	0x660
+	.long	0xf93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL13
+	.long	0x681
+	.long	0xfb1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL14
+	.long	0x64d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL8
+	.long	0x71f
+	.long	0xfdd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL15
+	.long	0x636
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	0xba0
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1092
+	.uleb128 0x10
+	.long	0xbb1
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x10
+	.long	0xbbb
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x10
+	.long	0xbc5
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x4
+	.quad	.LVL23
+	.long	0x52d
+	.long	0x1059
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL27
+	.long	0x511
+	.long	0x1077
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL28
+	.long	0x603
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7d
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF125
+	.long	.LASF127
+	.uleb128 0x24
+	.long	.LASF126
+	.long	.LASF128
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 112
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS21:
+	.uleb128 .LVU180
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -316
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -316
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -8
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x14c
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -316
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU182
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 .LVU239
+	.uleb128 .LVU246
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU189
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 .LVU243
+	.uleb128 .LVU246
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL64-1-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU221
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU244
+	.uleb128 .LVU246
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU226
+	.uleb128 .LVU230
+	.uleb128 .LVU246
+	.uleb128 .LVU247
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU303
+	.uleb128 .LVU307
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU251
+	.uleb128 .LVU253
+	.uleb128 .LVU260
+	.uleb128 .LVU289
+	.uleb128 .LVU304
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU192
+	.uleb128 .LVU197
+	.uleb128 .LVU198
+	.uleb128 .LVU201
+	.uleb128 .LVU213
+	.uleb128 .LVU214
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU203
+	.uleb128 .LVU211
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU202
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU211
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU202
+	.uleb128 .LVU211
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU251
+	.uleb128 .LVU253
+	.uleb128 .LVU306
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU112
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU158
+	.uleb128 .LVU162
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU113
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x98
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x8
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x98
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU125
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU115
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU133
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU131
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 .LVU160
+	.uleb128 .LVU162
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x7
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x7
+	.byte	0x7f
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU139
+	.uleb128 .LVU143
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU3
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU4
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU28
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU70
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL23-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL23-1-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0
+.LLRL24:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0
+.LLRL32:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF73:
+	.string	"StringFragments"
+.LASF32:
+	.string	"conversion_ns"
+.LASF83:
+	.string	"st_append_int"
+.LASF112:
+	.string	"iov_length"
+.LASF109:
+	.string	"output"
+.LASF75:
+	.string	"iov_count"
+.LASF37:
+	.string	"capacity"
+.LASF23:
+	.string	"StringArena"
+.LASF86:
+	.string	"st_fragments_free"
+.LASF71:
+	.string	"process"
+.LASF3:
+	.string	"unsigned int"
+.LASF81:
+	.string	"next"
+.LASF52:
+	.string	"incremental_factor"
+.LASF116:
+	.string	"chunk_values"
+.LASF19:
+	.string	"head"
+.LASF41:
+	.string	"ST_GROWTH_LINEAR"
+.LASF48:
+	.string	"StringTokenizer"
+.LASF106:
+	.string	"num_tests"
+.LASF118:
+	.string	"handler"
+.LASF45:
+	.string	"ST_STRING_OWNED"
+.LASF80:
+	.string	"ParallelTestTotal"
+.LASF39:
+	.string	"error"
+.LASF105:
+	.string	"batch_values"
+.LASF126:
+	.string	"putchar"
+.LASF36:
+	.string	"chunk_size"
+.LASF111:
+	.string	"stitched"
+.LASF90:
+	.string	"st_append_char"
+.LASF103:
+	.string	"count_values"
+.LASF122:
+	.string	"chunk"
+.LASF110:
+	.string	"serialized"
+.LASF124:
+	.string	"parallel_test_process"
+.LASF100:
+	.string	"malloc"
+.LASF63:
+	.string	"count"
+.LASF113:
+	.string	"index"
+.LASF121:
+	.string	"result"
+.LASF17:
+	.string	"long long unsigned int"
+.LASF92:
+	.string	"st_current_token"
+.LASF46:
+	.string	"ST_STRING_MAPPED"
+.LASF57:
+	.string	"arena"
+.LASF21:
+	.string	"used"
+.LASF72:
+	.string	"merge"
+.LASF98:
+	.string	"st_parallel_lines"
+.LASF125:
+	.string	"puts"
+.LASF8:
+	.string	"size_t"
+.LASF16:
+	.string	"int64_t"
+.LASF38:
+	.string	"offset"
+.LASF27:
+	.string	"allocations"
+.LASF94:
+	.string	"st_extract_double_to"
+.LASF54:
+	.string	"max_increment"
+.LASF130:
+	.string	"StringArenaBlock"
+.LASF11:
+	.string	"__uint64_t"
+.LASF79:
+	.string	"last"
+.LASF89:
+	.string	"st_parallel_serialize"
+.LASF107:
+	.string	"exit_status"
+.LASF13:
+	.string	"char"
+.LASF49:
+	.string	"string"
+.LASF115:
+	.string	"run_st_parallel_lines_unit_tests"
+.LASF14:
+	.string	"ssize_t"
+.LASF56:
+	.string	"ownership"
+.LASF114:
+	.string	"tokenizer"
+.LASF68:
+	.string	"iov_base"
+.LASF40:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF84:
+	.string	"st_append_string"
+.LASF61:
+	.string	"StringStructuralIndex"
+.LASF15:
+	.string	"long long int"
+.LASF97:
+	.string	"printf"
+.LASF104:
+	.string	"thread_values"
+.LASF76:
+	.string	"separator"
+.LASF35:
+	.string	"context"
+.LASF108:
+	.string	"expected"
+.LASF69:
+	.string	"iov_len"
+.LASF123:
+	.string	"parallel_test_merge"
+.LASF31:
+	.string	"conversions"
+.LASF70:
+	.string	"StringParallelHandler"
+.LASF65:
+	.string	"hint"
+.LASF99:
+	.string	"snprintf"
+.LASF117:
+	.string	"size"
+.LASF128:
+	.string	"__builtin_putchar"
+.LASF88:
+	.string	"st_fragments_stitch"
+.LASF28:
+	.string	"reallocations"
+.LASF85:
+	.string	"st_destroy"
+.LASF44:
+	.string	"ST_STRING_BORROWED"
+.LASF9:
+	.string	"__int64_t"
+.LASF22:
+	.string	"long double"
+.LASF127:
+	.string	"__builtin_puts"
+.LASF24:
+	.string	"StringStats"
+.LASF62:
+	.string	"positions"
+.LASF25:
+	.string	"bytes_scanned"
+.LASF7:
+	.string	"short int"
+.LASF10:
+	.string	"long int"
+.LASF50:
+	.string	"length"
+.LASF26:
+	.string	"tokens_extracted"
+.LASF82:
+	.string	"ordered"
+.LASF18:
+	.string	"uint64_t"
+.LASF42:
+	.string	"StringGrowthPolicy"
+.LASF20:
+	.string	"block_size"
+.LASF66:
+	.string	"double"
+.LASF12:
+	.string	"__ssize_t"
+.LASF96:
+	.string	"free"
+.LASF43:
+	.string	"StringOwnership"
+.LASF34:
+	.string	"read"
+.LASF91:
+	.string	"st_create_empty"
+.LASF2:
+	.string	"long unsigned int"
+.LASF129:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF101:
+	.string	"run_parallel_tests"
+.LASF59:
+	.string	"structural_index"
+.LASF47:
+	.string	"ST_STRING_INLINE"
+.LASF74:
+	.string	"fragments"
+.LASF131:
+	.string	"parallel_test_serialize"
+.LASF77:
+	.string	"ParallelTestResult"
+.LASF4:
+	.string	"unsigned char"
+.LASF58:
+	.string	"inline_buffer"
+.LASF33:
+	.string	"StringStream"
+.LASF78:
+	.string	"first"
+.LASF29:
+	.string	"expansions"
+.LASF120:
+	.string	"processed"
+.LASF60:
+	.string	"stats"
+.LASF6:
+	.string	"signed char"
+.LASF5:
+	.string	"short unsigned int"
+.LASF67:
+	.string	"iovec"
+.LASF119:
+	.string	"total"
+.LASF53:
+	.string	"growth_policy"
+.LASF102:
+	.string	"run_st_parallel_serialize_unit_tests"
+.LASF64:
+	.string	"in_string"
+.LASF93:
+	.string	"st_next_token"
+.LASF30:
+	.string	"bytes_copied"
+.LASF95:
+	.string	"st_find_key"
+.LASF51:
+	.string	"position"
+.LASF87:
+	.string	"strcmp"
+.LASF55:
+	.string	"stream"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/tests/parallel_unit_tests.c"
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3076 @@
+	.file	"string_arena.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/src/string_arena.c"
+	.p2align 4
+	.globl	st_arena_create
+	.type	st_arena_create, @function
+st_arena_create:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/src/string_arena.c"
+	.loc 1 50 62 view -0
+	.cfi_startproc
+	.loc 1 51 3 view .LVU1
+	.loc 1 50 62 is_stmt 0 view .LVU2
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	.loc 1 51 53 view .LVU3
+	movl	$24, %edi
+.LVL1:
+	.loc 1 50 62 view .LVU4
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 51 53 view .LVU5
+	call	malloc@PLT
+.LVL2:
+	movq	%rax, %rbx
+.LVL3:
+	.loc 1 52 3 is_stmt 1 view .LVU6
+	.loc 1 52 8 view .LVU7
+	xorl	%edi, %edi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL4:
+	.loc 1 52 10 view .LVU8
+	.loc 1 52 15 view .LVU9
+	.loc 1 52 13 view .LVU10
+	.loc 1 52 6 view .LVU11
+	.loc 1 53 3 view .LVU12
+	.loc 1 53 6 is_stmt 0 view .LVU13
+	testq	%rbx, %rbx
+	je	.L1
+	.loc 1 54 5 is_stmt 1 view .LVU14
+	.loc 1 55 53 is_stmt 0 view .LVU15
+	testq	%rbp, %rbp
+	movl	$65536, %eax
+	cmove	%rax, %rbp
+.LVL5:
+	.loc 1 54 17 view .LVU16
+	movq	$0, (%rbx)
+	.loc 1 55 5 is_stmt 1 view .LVU17
+	.loc 1 55 23 is_stmt 0 view .LVU18
+	movq	%rbp, 8(%rbx)
+	.loc 1 56 5 is_stmt 1 view .LVU19
+	.loc 1 56 17 is_stmt 0 view .LVU20
+	movq	$0, 16(%rbx)
+	.loc 1 58 3 is_stmt 1 view .LVU21
+.L1:
+	.loc 1 59 1 is_stmt 0 view .LVU22
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL6:
+	.loc 1 59 1 view .LVU23
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	st_arena_create, .-st_arena_create
+	.p2align 4
+	.globl	st_arena_alloc
+	.type	st_arena_alloc, @function
+st_arena_alloc:
+.LVL7:
+.LFB27:
+	.loc 1 64 68 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 66 3 view .LVU25
+	.loc 1 64 68 is_stmt 0 view .LVU26
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	.loc 1 66 55 view .LVU27
+	leaq	15(%rsi), %rbp
+	.loc 1 66 10 view .LVU28
+	andq	$-16, %rbp
+.LVL8:
+	.loc 1 67 3 is_stmt 1 view .LVU29
+	.loc 1 64 68 is_stmt 0 view .LVU30
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 67 6 view .LVU31
+	cmpq	%rsi, %rbp
+	jb	.L16
+	.loc 1 70 28 view .LVU32
+	movq	(%rdi), %rbx
+	movq	%rdi, %r12
+	.loc 1 70 3 is_stmt 1 view .LVU33
+.LVL9:
+	.loc 1 71 3 view .LVU34
+	.loc 1 71 6 is_stmt 0 view .LVU35
+	testq	%rbx, %rbx
+	je	.L12
+	.loc 1 71 28 discriminator 1 view .LVU36
+	movq	8(%rbx), %r13
+	.loc 1 71 42 discriminator 1 view .LVU37
+	movq	16(%rbx), %rax
+	.loc 1 71 35 discriminator 1 view .LVU38
+	movq	%r13, %rdx
+	subq	%rax, %rdx
+	.loc 1 71 20 discriminator 1 view .LVU39
+	cmpq	%rbp, %rdx
+	jnb	.L21
+.LBB2:
+	.loc 1 73 5 is_stmt 1 discriminator 1 view .LVU40
+	.loc 1 73 56 is_stmt 0 discriminator 1 view .LVU41
+	addq	%r13, %r13
+.L15:
+.LVL10:
+	.loc 1 74 5 is_stmt 1 discriminator 4 view .LVU42
+	cmpq	%rbp, %r13
+	cmovb	%rbp, %r13
+.LVL11:
+	.loc 1 77 5 discriminator 4 view .LVU43
+	.loc 1 77 40 is_stmt 0 discriminator 4 view .LVU44
+	leaq	32(%r13), %rdi
+.LVL12:
+	.loc 1 77 40 discriminator 4 view .LVU45
+	call	malloc@PLT
+.LVL13:
+	.loc 1 77 40 discriminator 4 view .LVU46
+	movq	%rax, %rbx
+.LVL14:
+	.loc 1 78 5 is_stmt 1 discriminator 4 view .LVU47
+	.loc 1 78 10 discriminator 4 view .LVU48
+	xorl	%edi, %edi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL15:
+	.loc 1 78 12 discriminator 4 view .LVU49
+	.loc 1 78 17 discriminator 4 view .LVU50
+	.loc 1 78 15 discriminator 4 view .LVU51
+	.loc 1 78 8 discriminator 4 view .LVU52
+	.loc 1 79 5 discriminator 4 view .LVU53
+	.loc 1 79 8 is_stmt 0 discriminator 4 view .LVU54
+	testq	%rbx, %rbx
+	je	.L16
+	.loc 1 82 5 is_stmt 1 view .LVU55
+	.loc 1 82 17 is_stmt 0 view .LVU56
+	movq	(%r12), %rax
+	.loc 1 83 17 view .LVU57
+	movq	%r13, 8(%rbx)
+	.loc 1 82 17 view .LVU58
+	movq	%rax, (%rbx)
+	.loc 1 83 5 is_stmt 1 view .LVU59
+	.loc 1 84 5 view .LVU60
+	.loc 1 84 17 is_stmt 0 view .LVU61
+	movq	$0, 16(%rbx)
+	.loc 1 85 5 is_stmt 1 view .LVU62
+	.loc 1 85 17 is_stmt 0 view .LVU63
+	movq	%rbx, (%r12)
+	movq	%rbp, %rdx
+	xorl	%eax, %eax
+	jmp	.L14
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	.loc 1 85 17 view .LVU64
+.LBE2:
+	.loc 1 88 15 view .LVU65
+	leaq	(%rax,%rbp), %rdx
+.LVL17:
+.L14:
+	.loc 1 87 3 is_stmt 1 view .LVU66
+	.loc 1 88 15 is_stmt 0 view .LVU67
+	movq	%rdx, 16(%rbx)
+	.loc 1 89 15 view .LVU68
+	addq	%rbp, 16(%r12)
+	.loc 1 91 1 view .LVU69
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 87 9 view .LVU70
+	leaq	32(%rbx,%rax), %rax
+.LVL18:
+	.loc 1 88 3 is_stmt 1 view .LVU71
+	.loc 1 89 3 view .LVU72
+	.loc 1 90 3 view .LVU73
+	.loc 1 91 1 is_stmt 0 view .LVU74
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL19:
+	.loc 1 91 1 view .LVU75
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL20:
+	.loc 1 91 1 view .LVU76
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL21:
+	.loc 1 91 1 view .LVU77
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL22:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.cfi_restore_state
+.LBB3:
+	.loc 1 73 5 is_stmt 1 discriminator 2 view .LVU78
+	.loc 1 73 56 is_stmt 0 discriminator 2 view .LVU79
+	movq	8(%rdi), %r13
+	jmp	.L15
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 73 56 discriminator 2 view .LVU80
+.LBE3:
+	.loc 1 91 1 view .LVU81
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL24:
+	.loc 1 91 1 view .LVU82
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	.loc 1 68 11 view .LVU83
+	xorl	%eax, %eax
+	.loc 1 91 1 view .LVU84
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	st_arena_alloc, .-st_arena_alloc
+	.p2align 4
+	.globl	st_arena_string
+	.type	st_arena_string, @function
+st_arena_string:
+.LVL25:
+.LFB28:
+	.loc 1 96 81 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 97 3 view .LVU86
+	.loc 1 96 81 is_stmt 0 view .LVU87
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 96 81 view .LVU88
+	movq	%rsi, %rbx
+	.loc 1 97 26 view .LVU89
+	movq	8(%rsi), %rax
+	leaq	1(%rax), %rsi
+.LVL26:
+	.loc 1 97 26 view .LVU90
+	call	st_arena_alloc@PLT
+.LVL27:
+	.loc 1 97 26 view .LVU91
+	movq	%rax, %rcx
+.LVL28:
+	.loc 1 98 3 is_stmt 1 view .LVU92
+	.loc 1 98 6 is_stmt 0 view .LVU93
+	testq	%rax, %rax
+	je	.L22
+	.loc 1 102 3 is_stmt 1 view .LVU94
+	.loc 1 102 11 is_stmt 0 view .LVU95
+	movq	8(%rbx), %rdx
+	.loc 1 102 6 view .LVU96
+	testq	%rdx, %rdx
+	jne	.L32
+.LVL29:
+.L24:
+	.loc 1 105 3 is_stmt 1 view .LVU97
+	.loc 1 105 21 is_stmt 0 view .LVU98
+	movb	$0, (%rcx,%rdx)
+	.loc 1 106 3 is_stmt 1 view .LVU99
+.L22:
+	.loc 1 107 1 is_stmt 0 view .LVU100
+	movq	%rcx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL30:
+	.loc 1 107 1 view .LVU101
+	ret
+.LVL31:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.cfi_restore_state
+	.loc 1 103 5 is_stmt 1 view .LVU102
+	movq	(%rbx), %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.LVL32:
+	.loc 1 103 5 is_stmt 0 view .LVU103
+	movq	%rax, %rcx
+	.loc 1 105 14 view .LVU104
+	movq	8(%rbx), %rdx
+	jmp	.L24
+	.cfi_endproc
+.LFE28:
+	.size	st_arena_string, .-st_arena_string
+	.p2align 4
+	.globl	st_arena_reset
+	.type	st_arena_reset, @function
+st_arena_reset:
+.LVL33:
+.LFB29:
+	.loc 1 112 48 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 113 3 view .LVU106
+	.loc 1 112 48 is_stmt 0 view .LVU107
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 113 28 view .LVU108
+	movq	(%rdi), %r12
+.LVL34:
+	.loc 1 114 3 is_stmt 1 view .LVU109
+	.loc 1 114 6 is_stmt 0 view .LVU110
+	testq	%r12, %r12
+	je	.L44
+	.loc 1 118 28 view .LVU111
+	movq	(%r12), %rbx
+	movq	%rdi, %rbp
+	.loc 1 118 3 is_stmt 1 view .LVU112
+.LVL35:
+	.loc 1 119 3 view .LVU113
+	.loc 1 119 15 view .LVU114
+	testq	%rbx, %rbx
+	je	.L35
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+.LBB4:
+	.loc 1 120 5 view .LVU115
+	movq	%rbx, %rdi
+	.loc 1 120 30 is_stmt 0 view .LVU116
+	movq	(%rbx), %rbx
+.LVL37:
+	.loc 1 121 5 is_stmt 1 view .LVU117
+	call	free@PLT
+.LVL38:
+	.loc 1 122 5 view .LVU118
+	.loc 1 122 5 is_stmt 0 view .LVU119
+.LBE4:
+	.loc 1 119 15 is_stmt 1 view .LVU120
+	testq	%rbx, %rbx
+	jne	.L36
+.LVL39:
+.L35:
+	.loc 1 124 3 view .LVU121
+	.loc 1 124 15 is_stmt 0 view .LVU122
+	movq	$0, (%r12)
+	.loc 1 125 3 is_stmt 1 view .LVU123
+	.loc 1 125 15 is_stmt 0 view .LVU124
+	movq	$0, 16(%r12)
+	.loc 1 126 3 is_stmt 1 view .LVU125
+	.loc 1 126 15 is_stmt 0 view .LVU126
+	movq	$0, 16(%rbp)
+.LVL40:
+.L44:
+	.loc 1 127 1 view .LVU127
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL41:
+	.loc 1 127 1 view .LVU128
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	st_arena_reset, .-st_arena_reset
+	.p2align 4
+	.globl	st_arena_destroy
+	.type	st_arena_destroy, @function
+st_arena_destroy:
+.LVL42:
+.LFB30:
+	.loc 1 132 50 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 133 3 view .LVU130
+	.loc 1 133 6 is_stmt 0 view .LVU131
+	testq	%rdi, %rdi
+	je	.L54
+	.loc 1 132 50 view .LVU132
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	.loc 1 136 3 is_stmt 1 view .LVU133
+	.loc 1 132 50 is_stmt 0 view .LVU134
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 136 28 view .LVU135
+	movq	(%rdi), %rbx
+.LVL43:
+	.loc 1 137 3 is_stmt 1 view .LVU136
+	.loc 1 137 16 view .LVU137
+	testq	%rbx, %rbx
+	je	.L48
+.LVL44:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+.LBB5:
+	.loc 1 138 5 view .LVU138
+	movq	%rbx, %rdi
+	.loc 1 138 30 is_stmt 0 view .LVU139
+	movq	(%rbx), %rbx
+.LVL45:
+	.loc 1 139 5 is_stmt 1 view .LVU140
+	call	free@PLT
+.LVL46:
+	.loc 1 140 5 view .LVU141
+	.loc 1 140 5 is_stmt 0 view .LVU142
+.LBE5:
+	.loc 1 137 16 is_stmt 1 view .LVU143
+	testq	%rbx, %rbx
+	jne	.L49
+.LVL47:
+.L48:
+	.loc 1 142 3 view .LVU144
+	.loc 1 143 1 is_stmt 0 view .LVU145
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL48:
+	.loc 1 142 3 view .LVU146
+	movq	%rbp, %rdi
+	.loc 1 143 1 view .LVU147
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL49:
+	.loc 1 142 3 view .LVU148
+	jmp	free@PLT
+.LVL50:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.loc 1 142 3 view .LVU149
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	st_arena_destroy, .-st_arena_destroy
+	.p2align 4
+	.globl	st_arena_acquire
+	.type	st_arena_acquire, @function
+st_arena_acquire:
+.LFB31:
+	.loc 1 148 44 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 149 3 view .LVU151
+	.loc 1 148 44 is_stmt 0 view .LVU152
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 149 31 view .LVU153
+	leaq	string_arena_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL51:
+	movq	string_arena_pool_count@dtpoff(%rax), %rdx
+	.loc 1 149 6 view .LVU154
+	testq	%rdx, %rdx
+	je	.L64
+	.loc 1 150 5 is_stmt 1 view .LVU155
+	.loc 1 150 30 is_stmt 0 view .LVU156
+	decq	%rdx
+	.loc 1 150 29 view .LVU157
+	movq	%rdx, string_arena_pool_count@dtpoff(%rax)
+	movq	string_arena_pool@dtpoff(%rax,%rdx,8), %rax
+	.loc 1 153 1 view .LVU158
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	.cfi_restore_state
+	.loc 1 152 3 is_stmt 1 view .LVU159
+	.loc 1 152 10 is_stmt 0 view .LVU160
+	xorl	%edi, %edi
+	.loc 1 153 1 view .LVU161
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 152 10 view .LVU162
+	jmp	st_arena_create@PLT
+.LVL52:
+	.cfi_endproc
+.LFE31:
+	.size	st_arena_acquire, .-st_arena_acquire
+	.p2align 4
+	.globl	st_arena_release
+	.type	st_arena_release, @function
+st_arena_release:
+.LVL53:
+.LFB32:
+	.loc 1 158 50 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 159 3 view .LVU164
+	.loc 1 159 6 is_stmt 0 view .LVU165
+	testq	%rdi, %rdi
+	je	.L73
+	.loc 1 158 50 view .LVU166
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	.loc 1 162 3 is_stmt 1 view .LVU167
+	.loc 1 158 50 is_stmt 0 view .LVU168
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 162 31 view .LVU169
+	leaq	string_arena_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL54:
+	.loc 1 164 5 view .LVU170
+	movq	%rbx, %rdi
+	.loc 1 162 6 view .LVU171
+	cmpq	$4, string_arena_pool_count@dtpoff(%rax)
+	.loc 1 162 31 view .LVU172
+	movq	%rax, %rbp
+	.loc 1 162 6 view .LVU173
+	je	.L76
+	.loc 1 167 3 is_stmt 1 view .LVU174
+	call	st_arena_reset@PLT
+.LVL55:
+	.loc 1 168 3 view .LVU175
+	.loc 1 168 44 is_stmt 0 view .LVU176
+	movq	string_arena_pool_count@dtpoff(%rbp), %rax
+	leaq	1(%rax), %rdx
+	movq	%rdx, string_arena_pool_count@dtpoff(%rbp)
+	.loc 1 168 48 view .LVU177
+	movq	%rbx, string_arena_pool@dtpoff(%rbp,%rax,8)
+	.loc 1 169 1 view .LVU178
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL56:
+	.loc 1 169 1 view .LVU179
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL57:
+	.loc 1 169 1 view .LVU180
+	ret
+.LVL58:
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	.cfi_restore_state
+	.loc 1 164 5 is_stmt 1 view .LVU181
+	.loc 1 169 1 is_stmt 0 view .LVU182
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL59:
+	.loc 1 169 1 view .LVU183
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	.loc 1 164 5 view .LVU184
+	jmp	st_arena_destroy@PLT
+.LVL60:
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	.loc 1 164 5 view .LVU185
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	st_arena_release, .-st_arena_release
+	.p2align 4
+	.globl	st_arena_pool_clear
+	.type	st_arena_pool_clear, @function
+st_arena_pool_clear:
+.LFB33:
+	.loc 1 174 32 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 175 3 view .LVU187
+	.loc 1 175 34 view .LVU188
+	.loc 1 174 32 is_stmt 0 view .LVU189
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 175 34 view .LVU190
+	leaq	string_arena_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL61:
+	movq	string_arena_pool_count@dtpoff(%rax), %rax
+	testq	%rax, %rax
+	je	.L84
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.loc 1 176 5 is_stmt 1 view .LVU191
+	.loc 1 176 40 is_stmt 0 view .LVU192
+	leaq	-1(%rax), %rbx
+	.loc 1 176 5 view .LVU193
+	leaq	string_arena_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL62:
+	movq	string_arena_pool@dtpoff(%rax,%rbx,8), %rdi
+	movq	%rax, %rbp
+	movq	%rbx, string_arena_pool_count@dtpoff(%rax)
+	call	st_arena_destroy@PLT
+.LVL63:
+	.loc 1 175 34 is_stmt 1 view .LVU194
+	movq	string_arena_pool_count@dtpoff(%rbp), %rax
+	testq	%rax, %rax
+	jne	.L79
+.L84:
+	.loc 1 178 1 is_stmt 0 view .LVU195
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	st_arena_pool_clear, .-st_arena_pool_clear
+	.section	.tbss,"awT",@nobits
+	.align 8
+	.type	string_arena_pool_count, @object
+	.size	string_arena_pool_count, 8
+string_arena_pool_count:
+	.zero	8
+	.align 8
+	.type	string_arena_pool, @object
+	.size	string_arena_pool, 32
+string_arena_pool:
+	.zero	32
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/root/repo/src/../include/strutils.h"
+	.file 7 "/usr/include/stdlib.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x85e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF87
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x9
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xa
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x9
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF12
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x4d
+	.uleb128 0x2
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0xa
+	.long	0x9d
+	.uleb128 0x9
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x6c
+	.byte	0x13
+	.long	0x8c
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF15
+	.uleb128 0x2
+	.long	0xc1
+	.uleb128 0x1f
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF16
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x9
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0xa
+	.long	0xce
+	.uleb128 0x20
+	.long	.LASF18
+	.byte	0x10
+	.byte	0x6
+	.byte	0xd
+	.byte	0x8
+	.long	0x105
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0xc9
+	.byte	0
+	.uleb128 0x11
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0xdf
+	.uleb128 0xb
+	.long	.LASF19
+	.byte	0x18
+	.value	0x175
+	.long	0x13e
+	.uleb128 0x1
+	.long	.LASF20
+	.value	0x17a
+	.byte	0x1c
+	.long	0x17f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF21
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF22
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF88
+	.byte	0x20
+	.byte	0x10
+	.byte	0x1
+	.byte	0xe
+	.byte	0x8
+	.long	0x17f
+	.uleb128 0xe
+	.long	.LASF23
+	.byte	0x13
+	.byte	0x1c
+	.long	0x17f
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF24
+	.byte	0x18
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0xe
+	.long	.LASF22
+	.byte	0x1d
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x22
+	.long	.LASF89
+	.byte	0x1
+	.byte	0x22
+	.byte	0x1e
+	.long	0x408
+	.byte	0x10
+	.byte	0x20
+	.byte	0
+	.uleb128 0x2
+	.long	0x13e
+	.uleb128 0xb
+	.long	.LASF25
+	.byte	0x40
+	.value	0x1e6
+	.long	0x1f9
+	.uleb128 0x1
+	.long	.LASF26
+	.value	0x1eb
+	.byte	0xc
+	.long	0xce
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF27
+	.value	0x1f0
+	.byte	0xc
+	.long	0xce
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF28
+	.value	0x1f5
+	.byte	0xc
+	.long	0xce
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF29
+	.value	0x1fa
+	.byte	0xc
+	.long	0xce
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF30
+	.value	0x1ff
+	.byte	0xc
+	.long	0xce
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF31
+	.value	0x204
+	.byte	0xc
+	.long	0xce
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF32
+	.value	0x209
+	.byte	0xc
+	.long	0xce
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF33
+	.value	0x20e
+	.byte	0xc
+	.long	0xce
+	.byte	0x38
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF34
+	.byte	0x38
+	.value	0x26c
+	.long	0x26b
+	.uleb128 0x1
+	.long	.LASF35
+	.value	0x272
+	.byte	0xd
+	.long	0x284
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF36
+	.value	0x277
+	.byte	0x9
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x12
+	.string	"fd"
+	.value	0x27c
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF37
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF38
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF39
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x12
+	.string	"eof"
+	.value	0x290
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF40
+	.value	0x295
+	.byte	0x7
+	.long	0x46
+	.byte	0x34
+	.byte	0
+	.uleb128 0x23
+	.long	0xa9
+	.long	0x284
+	.uleb128 0x5
+	.long	0x8a
+	.uleb128 0x5
+	.long	0x98
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x2
+	.long	0x26b
+	.uleb128 0x13
+	.long	.LASF43
+	.long	0x69
+	.value	0x29b
+	.long	0x2a5
+	.uleb128 0x8
+	.long	.LASF41
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF42
+	.byte	0x1
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF44
+	.long	0x69
+	.value	0x2b5
+	.long	0x2cd
+	.uleb128 0x8
+	.long	.LASF45
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF47
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF48
+	.byte	0x3
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF49
+	.value	0x158
+	.byte	0x6
+	.value	0x2cf
+	.byte	0x8
+	.long	0x37b
+	.uleb128 0x1
+	.long	.LASF50
+	.value	0x2d4
+	.byte	0x9
+	.long	0x98
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF51
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF52
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF53
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF54
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x289
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF55
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF56
+	.value	0x2f2
+	.byte	0x18
+	.long	0x380
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF57
+	.value	0x2f7
+	.byte	0x18
+	.long	0x2a5
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF58
+	.value	0x2fc
+	.byte	0x17
+	.long	0x385
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF59
+	.value	0x301
+	.byte	0x8
+	.long	0x38a
+	.byte	0x48
+	.uleb128 0x14
+	.long	.LASF60
+	.value	0x306
+	.byte	0x21
+	.long	0x3e8
+	.value	0x148
+	.uleb128 0x14
+	.long	.LASF61
+	.value	0x30b
+	.byte	0x17
+	.long	0x3ed
+	.value	0x150
+	.byte	0
+	.uleb128 0xa
+	.long	0x2cd
+	.uleb128 0x2
+	.long	0x1f9
+	.uleb128 0x2
+	.long	0x10a
+	.uleb128 0xf
+	.long	0x9d
+	.long	0x39a
+	.uleb128 0x15
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF62
+	.byte	0x28
+	.value	0x764
+	.long	0x3e8
+	.uleb128 0x1
+	.long	.LASF63
+	.value	0x769
+	.byte	0xb
+	.long	0x3fe
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF64
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF65
+	.value	0x774
+	.byte	0xd
+	.long	0x403
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF51
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF66
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x2
+	.long	0x39a
+	.uleb128 0x2
+	.long	0x184
+	.uleb128 0x2
+	.long	0x105
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF67
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0xce
+	.uleb128 0xf
+	.long	0x9d
+	.long	0x417
+	.uleb128 0x25
+	.long	0x3f
+	.byte	0
+	.uleb128 0xf
+	.long	0x385
+	.long	0x427
+	.uleb128 0x15
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF68
+	.byte	0x28
+	.byte	0x2a
+	.long	0x417
+	.uleb128 0xa
+	.byte	0xe
+	.long	string_arena_pool@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0x16
+	.long	.LASF69
+	.byte	0x2d
+	.byte	0x1d
+	.long	0x2e
+	.uleb128 0xa
+	.byte	0xe
+	.long	string_arena_pool_count@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0x17
+	.long	.LASF70
+	.byte	0x7
+	.value	0x238
+	.byte	0xd
+	.long	0x466
+	.uleb128 0x5
+	.long	0x8a
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF72
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xe
+	.long	0x8a
+	.long	0x486
+	.uleb128 0x5
+	.long	0x8a
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF71
+	.byte	0x6
+	.value	0x24d
+	.byte	0x6
+	.long	0x4a3
+	.uleb128 0x5
+	.long	0x4a3
+	.uleb128 0x5
+	.long	0x3a
+	.uleb128 0x5
+	.long	0xda
+	.byte	0
+	.uleb128 0x2
+	.long	0x37b
+	.uleb128 0x27
+	.long	.LASF73
+	.byte	0x7
+	.value	0x229
+	.byte	0xe
+	.long	0x8a
+	.long	0x4bf
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF74
+	.byte	0xae
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4e9
+	.uleb128 0xc
+	.quad	.LVL63
+	.long	0x574
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF75
+	.byte	0x9e
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x53e
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x9e
+	.byte	0x2b
+	.long	0x385
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xd
+	.quad	.LVL55
+	.long	0x602
+	.long	0x530
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x28
+	.quad	.LVL60
+	.long	0x574
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF80
+	.byte	0x1
+	.byte	0x94
+	.byte	0x15
+	.long	0x385
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x574
+	.uleb128 0x19
+	.quad	.LVL52
+	.long	0x7da
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF76
+	.byte	0x84
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x602
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x84
+	.byte	0x2b
+	.long	0x385
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x6
+	.long	.LASF77
+	.byte	0x88
+	.byte	0x1c
+	.long	0x17f
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x2a
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.long	0x5ec
+	.uleb128 0x6
+	.long	.LASF23
+	.byte	0x8a
+	.byte	0x1e
+	.long	0x17f
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xc
+	.quad	.LVL46
+	.long	0x453
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL50
+	.long	0x453
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF78
+	.byte	0x70
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x68a
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x70
+	.byte	0x29
+	.long	0x385
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x6
+	.long	.LASF77
+	.byte	0x71
+	.byte	0x1c
+	.long	0x17f
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x6
+	.long	.LASF23
+	.byte	0x76
+	.byte	0x1c
+	.long	0x17f
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x2b
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x6
+	.long	.LASF79
+	.byte	0x78
+	.byte	0x1e
+	.long	0x17f
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xc
+	.quad	.LVL38
+	.long	0x453
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF81
+	.byte	0x60
+	.byte	0x7
+	.long	0x98
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x70b
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x60
+	.byte	0x2b
+	.long	0x385
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x7
+	.long	.LASF82
+	.byte	0x60
+	.byte	0x4b
+	.long	0x3f2
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x6
+	.long	.LASF50
+	.byte	0x61
+	.byte	0x9
+	.long	0x98
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xd
+	.quad	.LVL27
+	.long	0x70b
+	.long	0x6fd
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL32
+	.long	0x856
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF83
+	.byte	0x40
+	.byte	0x7
+	.long	0x8a
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7da
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x40
+	.byte	0x2a
+	.long	0x385
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x7
+	.long	.LASF24
+	.byte	0x40
+	.byte	0x3e
+	.long	0x3a
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x6
+	.long	.LASF84
+	.byte	0x42
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x6
+	.long	.LASF77
+	.byte	0x46
+	.byte	0x1c
+	.long	0x17f
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x6
+	.long	.LASF85
+	.byte	0x57
+	.byte	0x9
+	.long	0x8a
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x2c
+	.long	.LLRL7
+	.uleb128 0x6
+	.long	.LASF21
+	.byte	0x49
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xd
+	.quad	.LVL13
+	.long	0x4a8
+	.long	0x7bb
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 32
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL15
+	.long	0x486
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF86
+	.byte	0x32
+	.byte	0x15
+	.long	0x385
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x856
+	.uleb128 0x7
+	.long	.LASF21
+	.byte	0x32
+	.byte	0x32
+	.long	0x3a
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x6
+	.long	.LASF58
+	.byte	0x33
+	.byte	0x17
+	.long	0x385
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xd
+	.quad	.LVL2
+	.long	0x4a8
+	.long	0x838
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL4
+	.long	0x486
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF72
+	.long	.LASF90
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU179
+	.uleb128 .LVU180
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU136
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU142
+	.uleb128 .LVU146
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU140
+	.uleb128 .LVU144
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU109
+	.uleb128 .LVU128
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU113
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+	.uleb128 .LVU119
+	.uleb128 .LVU127
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU117
+	.uleb128 .LVU121
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU92
+	.uleb128 .LVU97
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU29
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0xf
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0xf
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU34
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU75
+	.uleb128 .LVU78
+	.uleb128 .LVU80
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU71
+	.uleb128 .LVU78
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU42
+	.uleb128 .LVU64
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU6
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF82:
+	.string	"view"
+.LASF90:
+	.string	"__builtin_memcpy"
+.LASF21:
+	.string	"block_size"
+.LASF48:
+	.string	"ST_STRING_INLINE"
+.LASF18:
+	.string	"StringView"
+.LASF8:
+	.string	"signed char"
+.LASF17:
+	.string	"uint64_t"
+.LASF9:
+	.string	"short int"
+.LASF10:
+	.string	"size_t"
+.LASF73:
+	.string	"malloc"
+.LASF80:
+	.string	"st_arena_acquire"
+.LASF63:
+	.string	"positions"
+.LASF61:
+	.string	"stats"
+.LASF72:
+	.string	"memcpy"
+.LASF27:
+	.string	"tokens_extracted"
+.LASF14:
+	.string	"ssize_t"
+.LASF57:
+	.string	"ownership"
+.LASF32:
+	.string	"conversions"
+.LASF20:
+	.string	"head"
+.LASF47:
+	.string	"ST_STRING_MAPPED"
+.LASF19:
+	.string	"StringArena"
+.LASF70:
+	.string	"free"
+.LASF66:
+	.string	"hint"
+.LASF51:
+	.string	"length"
+.LASF85:
+	.string	"memory"
+.LASF35:
+	.string	"read"
+.LASF4:
+	.string	"long long int"
+.LASF12:
+	.string	"__ssize_t"
+.LASF3:
+	.string	"long int"
+.LASF50:
+	.string	"string"
+.LASF86:
+	.string	"st_arena_create"
+.LASF39:
+	.string	"offset"
+.LASF60:
+	.string	"structural_index"
+.LASF74:
+	.string	"st_arena_pool_clear"
+.LASF84:
+	.string	"aligned_size"
+.LASF36:
+	.string	"context"
+.LASF55:
+	.string	"max_increment"
+.LASF53:
+	.string	"incremental_factor"
+.LASF45:
+	.string	"ST_STRING_BORROWED"
+.LASF43:
+	.string	"StringGrowthPolicy"
+.LASF29:
+	.string	"reallocations"
+.LASF16:
+	.string	"long double"
+.LASF5:
+	.string	"unsigned char"
+.LASF69:
+	.string	"string_arena_pool_count"
+.LASF42:
+	.string	"ST_GROWTH_LINEAR"
+.LASF38:
+	.string	"capacity"
+.LASF15:
+	.string	"long long unsigned int"
+.LASF7:
+	.string	"unsigned int"
+.LASF56:
+	.string	"stream"
+.LASF6:
+	.string	"short unsigned int"
+.LASF75:
+	.string	"st_arena_release"
+.LASF13:
+	.string	"char"
+.LASF78:
+	.string	"st_arena_reset"
+.LASF58:
+	.string	"arena"
+.LASF65:
+	.string	"in_string"
+.LASF11:
+	.string	"__uint64_t"
+.LASF89:
+	.string	"data"
+.LASF25:
+	.string	"StringStats"
+.LASF2:
+	.string	"long unsigned int"
+.LASF59:
+	.string	"inline_buffer"
+.LASF67:
+	.string	"double"
+.LASF62:
+	.string	"StringStructuralIndex"
+.LASF87:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF46:
+	.string	"ST_STRING_OWNED"
+.LASF31:
+	.string	"bytes_copied"
+.LASF24:
+	.string	"size"
+.LASF83:
+	.string	"st_arena_alloc"
+.LASF64:
+	.string	"count"
+.LASF71:
+	.string	"st_stats_add"
+.LASF79:
+	.string	"previous"
+.LASF37:
+	.string	"chunk_size"
+.LASF81:
+	.string	"st_arena_string"
+.LASF77:
+	.string	"block"
+.LASF44:
+	.string	"StringOwnership"
+.LASF33:
+	.string	"conversion_ns"
+.LASF22:
+	.string	"used"
+.LASF41:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF54:
+	.string	"growth_policy"
+.LASF40:
+	.string	"error"
+.LASF52:
+	.string	"position"
+.LASF76:
+	.string	"st_arena_destroy"
+.LASF49:
+	.string	"StringTokenizer"
+.LASF26:
+	.string	"bytes_scanned"
+.LASF68:
+	.string	"string_arena_pool"
+.LASF88:
+	.string	"StringArenaBlock"
+.LASF34:
+	.string	"StringStream"
+.LASF23:
+	.string	"next"
+.LASF30:
+	.string	"expansions"
+.LASF28:
+	.string	"allocations"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/string_arena.c"
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3219 @@
+	.file	"string_arena_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/tests/string_arena_unit_tests.c"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC2:
+	.string	"------------------- st_arena_alloc(x) -------------------"
+	.align 8
+.LC3:
+	.string	"[Failed] st_arena_alloc(%zu) failed: misaligned or NULL.\n"
+	.align 8
+.LC4:
+	.string	"[Passed] st_arena_alloc(%zu) is aligned.\n"
+	.align 8
+.LC5:
+	.string	"[Failed] st_arena_alloc(%zu) failed: overlapping allocations.\n"
+	.align 8
+.LC6:
+	.string	"[Failed] st_arena_reset() failed: the block was not reused."
+	.align 8
+.LC7:
+	.string	"[Passed] st_arena_reset() reuses the newest block."
+	.text
+	.p2align 4
+	.globl	run_st_arena_alloc_unit_tests
+	.type	run_st_arena_alloc_unit_tests, @function
+run_st_arena_alloc_unit_tests:
+.LFB26:
+	.file 1 "/root/repo/tests/string_arena_unit_tests.c"
+	.loc 1 11 37 view -0
+	.cfi_startproc
+	.loc 1 13 3 view .LVU1
+	.loc 1 11 37 is_stmt 0 view .LVU2
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 17 3 view .LVU3
+	leaq	.LC2(%rip), %rdi
+	.loc 1 11 37 view .LVU4
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.loc 1 20 31 view .LVU5
+	movl	$1, %r14d
+	.loc 1 11 37 view .LVU6
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-32, %rsp
+	subq	$160, %rsp
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 13 10 view .LVU7
+	vmovdqa	.LC0(%rip), %ymm0
+	leaq	32(%rsp), %r12
+	vmovdqa	%ymm0, 32(%rsp)
+	vmovdqa	.LC1(%rip), %ymm0
+	leaq	96(%rsp), %r13
+	vmovdqa	%ymm0, 64(%rsp)
+	.loc 1 15 3 is_stmt 1 view .LVU8
+.LVL0:
+	.loc 1 17 3 view .LVU9
+	vzeroupper
+.LVL1:
+	call	puts@PLT
+.LVL2:
+	.loc 1 19 3 view .LVU10
+	.loc 1 20 3 view .LVU11
+	.loc 1 20 31 is_stmt 0 view .LVU12
+	movl	$4096, %edi
+	call	st_arena_create@PLT
+.LVL3:
+	movq	%rax, 24(%rsp)
+.LVL4:
+	.loc 1 21 3 is_stmt 1 view .LVU13
+	.loc 1 22 3 view .LVU14
+.LBB2:
+	.loc 1 22 8 view .LVU15
+	.loc 1 22 21 view .LVU16
+.LBE2:
+	.loc 1 19 7 is_stmt 0 view .LVU17
+	xorl	%r15d, %r15d
+	jmp	.L5
+.LVL5:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+.LBB3:
+	.loc 1 29 5 is_stmt 1 view .LVU18
+	movl	%r14d, %esi
+	movq	%rbx, %rdx
+	movq	%rax, %rdi
+	call	memset@PLT
+.LVL6:
+	.loc 1 31 5 view .LVU19
+	.loc 1 22 21 is_stmt 0 view .LVU20
+	incq	%r14
+.LVL7:
+	.loc 1 31 5 view .LVU21
+	movq	%rbx, %rsi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL8:
+	.loc 1 22 35 is_stmt 1 view .LVU22
+	.loc 1 22 21 view .LVU23
+	cmpq	$9, %r14
+	je	.L28
+.LVL9:
+.L5:
+	.loc 1 23 5 view .LVU24
+	.loc 1 23 39 is_stmt 0 view .LVU25
+	movq	-8(%r12,%r14,8), %rbx
+	movq	24(%rsp), %rdi
+	movq	%rbx, %rsi
+	call	st_arena_alloc@PLT
+.LVL10:
+	.loc 1 23 20 view .LVU26
+	movq	%rax, -8(%r13,%r14,8)
+	.loc 1 24 5 is_stmt 1 view .LVU27
+	.loc 1 24 8 is_stmt 0 view .LVU28
+	testq	%rax, %rax
+	je	.L2
+	.loc 1 24 31 discriminator 2 view .LVU29
+	testb	$15, %al
+	je	.L3
+.L2:
+	.loc 1 25 7 is_stmt 1 discriminator 3 view .LVU30
+	movq	%rbx, %rsi
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 22 21 is_stmt 0 discriminator 3 view .LVU31
+	incq	%r14
+.LVL11:
+	.loc 1 25 7 discriminator 3 view .LVU32
+	call	printf@PLT
+.LVL12:
+	.loc 1 26 7 is_stmt 1 discriminator 3 view .LVU33
+	.loc 1 27 7 discriminator 3 view .LVU34
+	.loc 1 26 19 is_stmt 0 discriminator 3 view .LVU35
+	movl	$1, %r15d
+.LVL13:
+	.loc 1 22 35 is_stmt 1 discriminator 3 view .LVU36
+	.loc 1 22 21 discriminator 3 view .LVU37
+	cmpq	$9, %r14
+	jne	.L5
+.LVL14:
+.L28:
+	.loc 1 22 21 is_stmt 0 discriminator 3 view .LVU38
+.LBE3:
+.LBB4:
+	.loc 1 34 33 is_stmt 1 view .LVU39
+	movl	$1, %ecx
+	cmpl	$1, %r15d
+	je	.L7
+.LVL15:
+	.p2align 4,,10
+	.p2align 3
+.L6:
+.LBB5:
+	.loc 1 35 26 view .LVU40
+	.loc 1 35 39 is_stmt 0 view .LVU41
+	movq	-8(%r12,%rcx,8), %rdi
+	.loc 1 35 26 view .LVU42
+	testq	%rdi, %rdi
+	je	.L11
+	movq	-8(%r13,%rcx,8), %rax
+	leaq	(%rax,%rdi), %rsi
+	jmp	.L9
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 35 45 is_stmt 1 discriminator 2 view .LVU43
+	.loc 1 35 26 discriminator 2 view .LVU44
+	incq	%rax
+.LVL17:
+	.loc 1 35 26 is_stmt 0 discriminator 2 view .LVU45
+	cmpq	%rax, %rsi
+	je	.L11
+.LVL18:
+.L9:
+	.loc 1 36 7 is_stmt 1 view .LVU46
+	.loc 1 36 25 is_stmt 0 view .LVU47
+	movzbl	(%rax), %edx
+	.loc 1 36 10 view .LVU48
+	cmpl	%ecx, %edx
+	je	.L8
+	.loc 1 37 9 is_stmt 1 view .LVU49
+	movq	%rdi, %rsi
+	xorl	%eax, %eax
+.LVL19:
+	.loc 1 37 9 is_stmt 0 view .LVU50
+	leaq	.LC5(%rip), %rdi
+	call	printf@PLT
+.LVL20:
+	.loc 1 38 9 is_stmt 1 view .LVU51
+	.loc 1 39 9 view .LVU52
+	.loc 1 39 9 is_stmt 0 view .LVU53
+.LBE5:
+	.loc 1 34 65 is_stmt 1 view .LVU54
+	.loc 1 34 33 view .LVU55
+.LBB6:
+	.loc 1 38 21 is_stmt 0 view .LVU56
+	movl	$1, %r15d
+.LVL21:
+.L7:
+	.loc 1 38 21 view .LVU57
+.LBE6:
+.LBE4:
+	.loc 1 44 3 is_stmt 1 view .LVU58
+	movq	24(%rsp), %r14
+	movq	%r14, %rdi
+	call	st_arena_reset@PLT
+.LVL22:
+	.loc 1 45 3 view .LVU59
+	.loc 1 45 17 is_stmt 0 view .LVU60
+	movl	$1, %esi
+	movq	%r14, %rdi
+	call	st_arena_alloc@PLT
+.LVL23:
+	.loc 1 46 3 view .LVU61
+	movq	%r14, %rdi
+	.loc 1 45 17 view .LVU62
+	movq	%rax, %rbx
+.LVL24:
+	.loc 1 46 3 is_stmt 1 view .LVU63
+	call	st_arena_reset@PLT
+.LVL25:
+	.loc 1 47 3 view .LVU64
+	.loc 1 47 24 is_stmt 0 view .LVU65
+	cmpq	$0, 16(%r14)
+	jne	.L15
+	testq	%rbx, %rbx
+	je	.L15
+	.loc 1 47 43 discriminator 2 view .LVU66
+	movq	24(%rsp), %rdi
+	movl	$1, %esi
+	call	st_arena_alloc@PLT
+.LVL26:
+	.loc 1 47 40 discriminator 2 view .LVU67
+	cmpq	%rax, %rbx
+	je	.L29
+.L15:
+	.loc 1 48 5 is_stmt 1 view .LVU68
+	leaq	.LC6(%rip), %rdi
+	call	puts@PLT
+.LVL27:
+	.loc 1 49 5 view .LVU69
+	.loc 1 49 17 is_stmt 0 view .LVU70
+	movl	$1, %r15d
+.LVL28:
+.L14:
+	.loc 1 54 3 is_stmt 1 view .LVU71
+	movq	24(%rsp), %rdi
+	call	st_arena_destroy@PLT
+.LVL29:
+	.loc 1 55 3 view .LVU72
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL30:
+	.loc 1 57 3 view .LVU73
+	.loc 1 58 1 is_stmt 0 view .LVU74
+	leaq	-40(%rbp), %rsp
+.LVL31:
+	.loc 1 58 1 view .LVU75
+	popq	%rbx
+.LVL32:
+	.loc 1 58 1 view .LVU76
+	popq	%r12
+	popq	%r13
+.LVL33:
+	.loc 1 58 1 view .LVU77
+	popq	%r14
+	movl	%r15d, %eax
+	popq	%r15
+.LVL34:
+	.loc 1 58 1 view .LVU78
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL35:
+	.loc 1 58 1 view .LVU79
+	ret
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.cfi_restore_state
+.LBB7:
+	.loc 1 34 65 is_stmt 1 discriminator 2 view .LVU80
+	.loc 1 34 33 discriminator 2 view .LVU81
+	incq	%rcx
+.LVL37:
+	.loc 1 34 33 is_stmt 0 discriminator 2 view .LVU82
+	cmpq	$9, %rcx
+	jne	.L6
+	jmp	.L7
+.LVL38:
+.L29:
+	.loc 1 34 33 discriminator 2 view .LVU83
+.LBE7:
+	.loc 1 52 5 is_stmt 1 view .LVU84
+	leaq	.LC7(%rip), %rdi
+	call	puts@PLT
+.LVL39:
+	jmp	.L14
+	.cfi_endproc
+.LFE26:
+	.size	run_st_arena_alloc_unit_tests, .-run_st_arena_alloc_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC8:
+	.string	"------------------- st_attach_arena(x) -------------------"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC9:
+	.string	"true"
+.LC10:
+	.string	"key"
+	.section	.rodata.str1.8
+	.align 8
+.LC12:
+	.string	"[Failed] st_attach_arena() failed: wrong extracted values."
+	.align 8
+.LC13:
+	.string	"[Failed] st_attach_arena() failed: the values were not allocated from the arena."
+	.align 8
+.LC14:
+	.string	"[Passed] st_attach_arena() carves %zu bytes from the arena.\n"
+	.align 8
+.LC15:
+	.string	"[Failed] st_arena_release() failed: the arena was not pooled."
+	.align 8
+.LC16:
+	.string	"[Passed] st_arena_acquire() reuses the released arena."
+	.text
+	.p2align 4
+	.globl	run_st_attach_arena_unit_tests
+	.type	run_st_attach_arena_unit_tests, @function
+run_st_attach_arena_unit_tests:
+.LFB27:
+	.loc 1 63 38 view -0
+	.cfi_startproc
+	.loc 1 65 3 view .LVU86
+	.loc 1 63 38 is_stmt 0 view .LVU87
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	.loc 1 65 3 view .LVU88
+	leaq	.LC8(%rip), %rdi
+	.loc 1 63 38 view .LVU89
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 65 3 view .LVU90
+	call	puts@PLT
+.LVL40:
+	.loc 1 66 3 is_stmt 1 view .LVU91
+	.loc 1 67 3 view .LVU92
+	.loc 1 67 31 is_stmt 0 view .LVU93
+	call	st_arena_acquire@PLT
+.LVL41:
+	.loc 1 68 8 view .LVU94
+	vmovdqa	.LC17(%rip), %xmm0
+	.loc 1 69 39 view .LVU95
+	movq	%rsp, %rdi
+	.loc 1 68 8 view .LVU96
+	vmovdqa	%xmm0, (%rsp)
+	.loc 1 67 31 view .LVU97
+	movq	%rax, %rbp
+.LVL42:
+	.loc 1 68 3 is_stmt 1 view .LVU98
+	.loc 1 68 8 is_stmt 0 view .LVU99
+	movb	$0, 16(%rsp)
+	.loc 1 69 3 is_stmt 1 view .LVU100
+	.loc 1 69 39 is_stmt 0 view .LVU101
+	call	st_create@PLT
+.LVL43:
+	.loc 1 69 39 view .LVU102
+	movq	%rax, %rbx
+.LVL44:
+	.loc 1 70 3 is_stmt 1 view .LVU103
+	movq	%rax, %rdi
+	movq	%rbp, %rsi
+	call	st_attach_arena@PLT
+.LVL45:
+	.loc 1 72 3 view .LVU104
+	.loc 1 72 15 is_stmt 0 view .LVU105
+	movl	$34, %edx
+	movl	$34, %esi
+	movq	%rbx, %rdi
+	call	st_sub_string@PLT
+.LVL46:
+	.loc 1 73 3 view .LVU106
+	movq	%rbx, %rdi
+	.loc 1 72 15 view .LVU107
+	movq	%rax, %r12
+.LVL47:
+	.loc 1 73 3 is_stmt 1 view .LVU108
+	call	st_next_token@PLT
+.LVL48:
+	.loc 1 74 3 view .LVU109
+	.loc 1 74 20 is_stmt 0 view .LVU110
+	movq	%rbx, %rdi
+	call	st_extract_double@PLT
+.LVL49:
+	.loc 1 75 3 view .LVU111
+	movq	%rbx, %rdi
+	.loc 1 74 20 view .LVU112
+	movq	%rax, %r13
+.LVL50:
+	.loc 1 75 3 is_stmt 1 view .LVU113
+	call	st_next_token@PLT
+.LVL51:
+	.loc 1 76 3 view .LVU114
+	.loc 1 76 18 is_stmt 0 view .LVU115
+	movl	$1, %edx
+	leaq	.LC9(%rip), %rsi
+	movq	%rbx, %rdi
+	call	st_extract_boolean@PLT
+.LVL52:
+	.loc 1 77 3 is_stmt 1 view .LVU116
+	.loc 1 77 6 is_stmt 0 view .LVU117
+	testq	%r12, %r12
+	je	.L31
+	.loc 1 77 21 discriminator 1 view .LVU118
+	leaq	.LC10(%rip), %rsi
+	movq	%r12, %rdi
+	movq	%rax, %r14
+	call	strcmp@PLT
+.LVL53:
+	.loc 1 77 45 discriminator 1 view .LVU119
+	testl	%eax, %eax
+	jne	.L31
+	testq	%r13, %r13
+	je	.L31
+	.loc 1 77 63 discriminator 3 view .LVU120
+	vmovsd	0(%r13), %xmm0
+	movl	$1, %edx
+	vucomisd	.LC11(%rip), %xmm0
+	vmovsd	.LC11(%rip), %xmm0
+	setp	%al
+	vucomisd	0(%r13), %xmm0
+	cmovne	%edx, %eax
+	.loc 1 77 83 discriminator 3 view .LVU121
+	testb	%al, %al
+	jne	.L31
+	testq	%r14, %r14
+	je	.L31
+	.loc 1 77 102 discriminator 5 view .LVU122
+	cmpl	$1, (%r14)
+	je	.L32
+.LVL54:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.loc 1 78 5 is_stmt 1 view .LVU123
+	leaq	.LC12(%rip), %rdi
+	call	puts@PLT
+.LVL55:
+	.loc 1 79 5 view .LVU124
+.L33:
+	.loc 1 79 17 is_stmt 0 view .LVU125
+	movl	$1, %r12d
+.LVL56:
+.L35:
+	.loc 1 88 3 is_stmt 1 view .LVU126
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL57:
+	.loc 1 90 3 view .LVU127
+	movq	%rbp, %rdi
+	call	st_arena_release@PLT
+.LVL58:
+	.loc 1 91 3 view .LVU128
+	.loc 1 91 6 is_stmt 0 view .LVU129
+	cmpq	$0, 16(%rbp)
+	jne	.L38
+	.loc 1 91 27 discriminator 1 view .LVU130
+	call	st_arena_acquire@PLT
+.LVL59:
+	.loc 1 91 24 discriminator 1 view .LVU131
+	cmpq	%rax, %rbp
+	je	.L43
+.L38:
+	.loc 1 92 5 is_stmt 1 view .LVU132
+	leaq	.LC15(%rip), %rdi
+	call	puts@PLT
+.LVL60:
+	.loc 1 93 5 view .LVU133
+	.loc 1 93 17 is_stmt 0 view .LVU134
+	movl	$1, %r12d
+.LVL61:
+.L37:
+	.loc 1 98 3 is_stmt 1 view .LVU135
+	movq	%rbp, %rdi
+	call	st_arena_release@PLT
+.LVL62:
+	.loc 1 99 3 view .LVU136
+	call	st_arena_pool_clear@PLT
+.LVL63:
+	.loc 1 100 3 view .LVU137
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL64:
+	.loc 1 102 3 view .LVU138
+	.loc 1 103 1 is_stmt 0 view .LVU139
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL65:
+	.loc 1 103 1 view .LVU140
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL66:
+	.loc 1 103 1 view .LVU141
+	movl	%r12d, %eax
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL67:
+	.loc 1 103 1 view .LVU142
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL68:
+	.loc 1 103 1 view .LVU143
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL69:
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	.cfi_restore_state
+	.loc 1 96 5 is_stmt 1 view .LVU144
+	leaq	.LC16(%rip), %rdi
+	call	puts@PLT
+.LVL70:
+	jmp	.L37
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.loc 1 81 8 view .LVU145
+	.loc 1 81 17 is_stmt 0 view .LVU146
+	movq	16(%rbp), %rsi
+	.loc 1 81 11 view .LVU147
+	testq	%rsi, %rsi
+	jne	.L34
+	.loc 1 82 5 is_stmt 1 view .LVU148
+	leaq	.LC13(%rip), %rdi
+	call	puts@PLT
+.LVL72:
+	.loc 1 83 5 view .LVU149
+	.loc 1 83 5 is_stmt 0 view .LVU150
+	jmp	.L33
+.LVL73:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.loc 1 86 5 is_stmt 1 view .LVU151
+	leaq	.LC14(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL74:
+	.loc 1 66 7 is_stmt 0 view .LVU152
+	xorl	%r12d, %r12d
+.LVL75:
+	.loc 1 66 7 view .LVU153
+	jmp	.L35
+	.cfi_endproc
+.LFE27:
+	.size	run_st_attach_arena_unit_tests, .-run_st_attach_arena_unit_tests
+	.p2align 4
+	.globl	run_string_arena_tests
+	.type	run_string_arena_tests, @function
+run_string_arena_tests:
+.LFB28:
+	.loc 1 108 30 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 110 3 view .LVU155
+	.loc 1 108 30 is_stmt 0 view .LVU156
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 110 7 view .LVU157
+	xorl	%eax, %eax
+	call	run_st_arena_alloc_unit_tests@PLT
+.LVL76:
+	.loc 1 110 6 view .LVU158
+	cmpl	$1, %eax
+	je	.L44
+	.loc 1 114 3 is_stmt 1 view .LVU159
+	.loc 1 114 7 is_stmt 0 view .LVU160
+	xorl	%eax, %eax
+	call	run_st_attach_arena_unit_tests@PLT
+.LVL77:
+	.loc 1 114 6 view .LVU161
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+.L44:
+	.loc 1 119 1 view .LVU162
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	run_string_arena_tests, .-run_string_arena_tests
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC0:
+	.quad	1
+	.quad	3
+	.quad	8
+	.quad	17
+	.align 32
+.LC1:
+	.quad	100
+	.quad	1000
+	.quad	5000
+	.quad	20000
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC11:
+	.long	0
+	.long	-1071054848
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC17:
+	.quad	3543523814248114978
+	.quad	7310875413187997234
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/stdio.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/usr/include/stdint.h"
+	.file 7 "/root/repo/tests/../include/strutils.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xb05
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF95
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x9
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x12
+	.long	0x2e
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x1c
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x12
+	.long	0x6b
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x9
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x9
+	.long	.LASF11
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x5
+	.long	0x9b
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0x12
+	.long	0x9b
+	.uleb128 0x9
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x13
+	.long	0x8a
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF14
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF15
+	.uleb128 0x9
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x9
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x6
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF18
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0xd
+	.long	.LASF22
+	.byte	0x18
+	.value	0x175
+	.long	0x119
+	.uleb128 0x2
+	.long	.LASF19
+	.value	0x17a
+	.byte	0x1c
+	.long	0x11e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF20
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF21
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF96
+	.uleb128 0x5
+	.long	0x119
+	.uleb128 0xd
+	.long	.LASF23
+	.byte	0x40
+	.value	0x1e6
+	.long	0x198
+	.uleb128 0x2
+	.long	.LASF24
+	.value	0x1eb
+	.byte	0xc
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF25
+	.value	0x1f0
+	.byte	0xc
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF26
+	.value	0x1f5
+	.byte	0xc
+	.long	0xc1
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF27
+	.value	0x1fa
+	.byte	0xc
+	.long	0xc1
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF28
+	.value	0x1ff
+	.byte	0xc
+	.long	0xc1
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF29
+	.value	0x204
+	.byte	0xc
+	.long	0xc1
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF30
+	.value	0x209
+	.byte	0xc
+	.long	0xc1
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF31
+	.value	0x20e
+	.byte	0xc
+	.long	0xc1
+	.byte	0x38
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF32
+	.byte	0x38
+	.value	0x26c
+	.long	0x20a
+	.uleb128 0x2
+	.long	.LASF33
+	.value	0x272
+	.byte	0xd
+	.long	0x223
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF34
+	.value	0x277
+	.byte	0x9
+	.long	0x4d
+	.byte	0x8
+	.uleb128 0x15
+	.string	"fd"
+	.value	0x27c
+	.long	0x6b
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF35
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF36
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF37
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x15
+	.string	"eof"
+	.value	0x290
+	.long	0x6b
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF38
+	.value	0x295
+	.byte	0x7
+	.long	0x6b
+	.byte	0x34
+	.byte	0
+	.uleb128 0x1f
+	.long	0xa7
+	.long	0x223
+	.uleb128 0x4
+	.long	0x4d
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x20a
+	.uleb128 0x16
+	.long	.LASF41
+	.long	0x46
+	.value	0x29b
+	.long	0x244
+	.uleb128 0xa
+	.long	.LASF39
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF40
+	.byte	0x1
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF42
+	.long	0x46
+	.value	0x2b5
+	.long	0x26c
+	.uleb128 0xa
+	.long	.LASF43
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF44
+	.byte	0x1
+	.uleb128 0xa
+	.long	.LASF45
+	.byte	0x2
+	.uleb128 0xa
+	.long	.LASF46
+	.byte	0x3
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF47
+	.value	0x158
+	.byte	0x7
+	.value	0x2cf
+	.byte	0x8
+	.long	0x31a
+	.uleb128 0x2
+	.long	.LASF48
+	.value	0x2d4
+	.byte	0x9
+	.long	0x96
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF49
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF50
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF51
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF52
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x228
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF53
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF54
+	.value	0x2f2
+	.byte	0x18
+	.long	0x31a
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF55
+	.value	0x2f7
+	.byte	0x18
+	.long	0x244
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF56
+	.value	0x2fc
+	.byte	0x17
+	.long	0x31f
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF57
+	.value	0x301
+	.byte	0x8
+	.long	0x324
+	.byte	0x48
+	.uleb128 0x17
+	.long	.LASF58
+	.value	0x306
+	.byte	0x21
+	.long	0x382
+	.value	0x148
+	.uleb128 0x17
+	.long	.LASF59
+	.value	0x30b
+	.byte	0x17
+	.long	0x387
+	.value	0x150
+	.byte	0
+	.uleb128 0x5
+	.long	0x198
+	.uleb128 0x5
+	.long	0xe5
+	.uleb128 0xe
+	.long	0x9b
+	.long	0x334
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF60
+	.byte	0x28
+	.value	0x764
+	.long	0x382
+	.uleb128 0x2
+	.long	.LASF61
+	.value	0x769
+	.byte	0xb
+	.long	0x393
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF62
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF63
+	.value	0x774
+	.byte	0xd
+	.long	0x398
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF49
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF64
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x334
+	.uleb128 0x5
+	.long	0x123
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF65
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x5
+	.long	0xc1
+	.uleb128 0x5
+	.long	0x26c
+	.uleb128 0x21
+	.long	.LASF97
+	.byte	0x7
+	.value	0x1d5
+	.byte	0x6
+	.uleb128 0xb
+	.long	.LASF66
+	.value	0x1ce
+	.long	0x3bc
+	.uleb128 0x4
+	.long	0x31f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF67
+	.value	0x403
+	.long	0x3cd
+	.uleb128 0x4
+	.long	0x39d
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF68
+	.byte	0x9c
+	.byte	0xc
+	.long	0x6b
+	.long	0x3e7
+	.uleb128 0x4
+	.long	0xe0
+	.uleb128 0x4
+	.long	0xe0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF69
+	.byte	0x7
+	.value	0x4c6
+	.byte	0x6
+	.long	0x408
+	.long	0x408
+	.uleb128 0x4
+	.long	0x39d
+	.uleb128 0x4
+	.long	0xe0
+	.uleb128 0x4
+	.long	0x72
+	.byte	0
+	.uleb128 0x5
+	.long	0x6b
+	.uleb128 0x8
+	.long	.LASF70
+	.byte	0x7
+	.value	0x494
+	.byte	0x9
+	.long	0x424
+	.long	0x424
+	.uleb128 0x4
+	.long	0x39d
+	.byte	0
+	.uleb128 0x5
+	.long	0x38c
+	.uleb128 0xb
+	.long	.LASF71
+	.value	0x40b
+	.long	0x43a
+	.uleb128 0x4
+	.long	0x39d
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF72
+	.byte	0x7
+	.value	0x425
+	.byte	0x7
+	.long	0x96
+	.long	0x45b
+	.uleb128 0x4
+	.long	0x39d
+	.uleb128 0x4
+	.long	0xa2
+	.uleb128 0x4
+	.long	0xa2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF73
+	.value	0x3a2
+	.long	0x471
+	.uleb128 0x4
+	.long	0x39d
+	.uleb128 0x4
+	.long	0x31f
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF74
+	.byte	0x7
+	.value	0x317
+	.byte	0x19
+	.long	0x39d
+	.long	0x488
+	.uleb128 0x4
+	.long	0x96
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF98
+	.byte	0x7
+	.value	0x1c4
+	.byte	0x15
+	.long	0x31f
+	.uleb128 0xb
+	.long	.LASF75
+	.value	0x1bc
+	.long	0x4a6
+	.uleb128 0x4
+	.long	0x31f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF76
+	.value	0x1b4
+	.long	0x4b7
+	.uleb128 0x4
+	.long	0x31f
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF77
+	.byte	0x3d
+	.byte	0xe
+	.long	0x4d
+	.long	0x4d6
+	.uleb128 0x4
+	.long	0x4d
+	.uleb128 0x4
+	.long	0x6b
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF78
+	.byte	0x4
+	.value	0x164
+	.byte	0xc
+	.long	0x6b
+	.long	0x4ee
+	.uleb128 0x4
+	.long	0xe0
+	.uleb128 0x23
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF79
+	.byte	0x7
+	.value	0x19d
+	.byte	0x7
+	.long	0x4d
+	.long	0x50a
+	.uleb128 0x4
+	.long	0x31f
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF80
+	.byte	0x7
+	.value	0x190
+	.byte	0x15
+	.long	0x31f
+	.long	0x521
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF81
+	.byte	0x6c
+	.long	0x6b
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x55c
+	.uleb128 0xc
+	.quad	.LVL76
+	.long	0x83c
+	.uleb128 0xc
+	.quad	.LVL77
+	.long	0x55c
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF82
+	.byte	0x3f
+	.long	0x6b
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x82c
+	.uleb128 0x7
+	.long	.LASF83
+	.byte	0x42
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x7
+	.long	.LASF56
+	.byte	0x43
+	.byte	0x17
+	.long	0x31f
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x14
+	.long	.LASF48
+	.byte	0x44
+	.byte	0x8
+	.long	0x82c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x7
+	.long	.LASF84
+	.byte	0x45
+	.byte	0x1b
+	.long	0x39d
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x10
+	.string	"key"
+	.byte	0x48
+	.byte	0x9
+	.long	0x96
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x7
+	.long	.LASF85
+	.byte	0x4a
+	.byte	0xb
+	.long	0x424
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x7
+	.long	.LASF86
+	.byte	0x4c
+	.byte	0x8
+	.long	0x408
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x3
+	.quad	.LVL40
+	.long	0xaf6
+	.long	0x61c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL41
+	.long	0x488
+	.uleb128 0x3
+	.quad	.LVL43
+	.long	0x471
+	.long	0x642
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL45
+	.long	0x45b
+	.long	0x660
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL46
+	.long	0x43a
+	.long	0x684
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL48
+	.long	0x429
+	.long	0x69c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL49
+	.long	0x40d
+	.long	0x6b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL51
+	.long	0x429
+	.long	0x6cc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL52
+	.long	0x3e7
+	.long	0x6f6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL53
+	.long	0x3cd
+	.long	0x71b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL55
+	.long	0xaf6
+	.long	0x73a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL57
+	.long	0x3bc
+	.long	0x752
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL58
+	.long	0x3ab
+	.long	0x76a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL59
+	.long	0x488
+	.uleb128 0x3
+	.quad	.LVL60
+	.long	0xaf6
+	.long	0x796
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL62
+	.long	0x3ab
+	.long	0x7ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL63
+	.long	0x3a2
+	.uleb128 0x3
+	.quad	.LVL64
+	.long	0xaff
+	.long	0x7d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL70
+	.long	0xaf6
+	.long	0x7f1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL72
+	.long	0xaf6
+	.long	0x810
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL74
+	.long	0x4d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x9b
+	.long	0x83c
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x10
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF87
+	.byte	0xb
+	.long	0x6b
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xad1
+	.uleb128 0x14
+	.long	.LASF88
+	.byte	0xd
+	.byte	0xa
+	.long	0xad1
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0x24
+	.long	.LASF89
+	.byte	0x1
+	.byte	0xf
+	.byte	0x7
+	.long	0x6b
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF83
+	.byte	0x13
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x7
+	.long	.LASF56
+	.byte	0x14
+	.byte	0x17
+	.long	0x31f
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x14
+	.long	.LASF26
+	.byte	0x15
+	.byte	0x12
+	.long	0xae1
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0x7
+	.long	.LASF90
+	.byte	0x2d
+	.byte	0x9
+	.long	0x4d
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x19
+	.long	.LLRL3
+	.long	0x96b
+	.uleb128 0x10
+	.string	"i"
+	.byte	0x16
+	.byte	0xc
+	.long	0x6b
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x3
+	.quad	.LVL6
+	.long	0x4b7
+	.long	0x905
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL8
+	.long	0x4d6
+	.long	0x92a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL10
+	.long	0x4ee
+	.long	0x949
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL12
+	.long	0x4d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LLRL5
+	.long	0x9b8
+	.uleb128 0x10
+	.string	"i"
+	.byte	0x22
+	.byte	0xc
+	.long	0x6b
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x25
+	.long	.LLRL7
+	.uleb128 0x10
+	.string	"j"
+	.byte	0x23
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x11
+	.quad	.LVL20
+	.long	0x4d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL1
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL2
+	.long	0xaf6
+	.long	0x9e2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL3
+	.long	0x50a
+	.long	0x9fb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL22
+	.long	0x4a6
+	.long	0xa13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL23
+	.long	0x4ee
+	.long	0xa30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL25
+	.long	0x4a6
+	.long	0xa48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL26
+	.long	0x4ee
+	.long	0xa66
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL27
+	.long	0xaf6
+	.long	0xa85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL29
+	.long	0x495
+	.long	0xa9e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL30
+	.long	0xaff
+	.long	0xab5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL39
+	.long	0xaf6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x2e
+	.long	0xae1
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0xe
+	.long	0xaf1
+	.long	0xaf1
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	0x4f
+	.uleb128 0x1a
+	.long	.LASF91
+	.long	.LASF93
+	.uleb128 0x1a
+	.long	.LASF92
+	.long	.LASF94
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS9:
+	.uleb128 .LVU92
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU98
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU141
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU103
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU140
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU108
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU126
+	.uleb128 .LVU145
+	.uleb128 .LVU153
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL48-1-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU113
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU143
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU116
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU123
+	.uleb128 .LVU145
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU11
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU57
+	.uleb128 .LVU70
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU83
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU13
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x88
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x8
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x88
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU63
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU76
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL25-1-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU16
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU21
+	.uleb128 .LVU24
+	.uleb128 .LVU32
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU38
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU51
+	.uleb128 .LVU80
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU40
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU50
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x77
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x58
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x10
+	.byte	0x70
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x77
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x58
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x77
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x58
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF24:
+	.string	"bytes_scanned"
+.LASF50:
+	.string	"position"
+.LASF93:
+	.string	"__builtin_puts"
+.LASF20:
+	.string	"block_size"
+.LASF46:
+	.string	"ST_STRING_INLINE"
+.LASF83:
+	.string	"exit_status"
+.LASF16:
+	.string	"uint64_t"
+.LASF7:
+	.string	"short int"
+.LASF9:
+	.string	"size_t"
+.LASF98:
+	.string	"st_arena_acquire"
+.LASF27:
+	.string	"reallocations"
+.LASF61:
+	.string	"positions"
+.LASF92:
+	.string	"putchar"
+.LASF59:
+	.string	"stats"
+.LASF67:
+	.string	"st_destroy"
+.LASF73:
+	.string	"st_attach_arena"
+.LASF13:
+	.string	"ssize_t"
+.LASF55:
+	.string	"ownership"
+.LASF30:
+	.string	"conversions"
+.LASF19:
+	.string	"head"
+.LASF17:
+	.string	"uintptr_t"
+.LASF45:
+	.string	"ST_STRING_MAPPED"
+.LASF22:
+	.string	"StringArena"
+.LASF74:
+	.string	"st_create"
+.LASF64:
+	.string	"hint"
+.LASF49:
+	.string	"length"
+.LASF33:
+	.string	"read"
+.LASF14:
+	.string	"long long int"
+.LASF11:
+	.string	"__ssize_t"
+.LASF77:
+	.string	"memset"
+.LASF82:
+	.string	"run_st_attach_arena_unit_tests"
+.LASF8:
+	.string	"long int"
+.LASF48:
+	.string	"string"
+.LASF84:
+	.string	"tokenizer"
+.LASF37:
+	.string	"offset"
+.LASF58:
+	.string	"structural_index"
+.LASF97:
+	.string	"st_arena_pool_clear"
+.LASF34:
+	.string	"context"
+.LASF53:
+	.string	"max_increment"
+.LASF72:
+	.string	"st_sub_string"
+.LASF51:
+	.string	"incremental_factor"
+.LASF43:
+	.string	"ST_STRING_BORROWED"
+.LASF41:
+	.string	"StringGrowthPolicy"
+.LASF18:
+	.string	"long double"
+.LASF4:
+	.string	"unsigned char"
+.LASF70:
+	.string	"st_extract_double"
+.LASF40:
+	.string	"ST_GROWTH_LINEAR"
+.LASF36:
+	.string	"capacity"
+.LASF15:
+	.string	"long long unsigned int"
+.LASF3:
+	.string	"unsigned int"
+.LASF81:
+	.string	"run_string_arena_tests"
+.LASF87:
+	.string	"run_st_arena_alloc_unit_tests"
+.LASF91:
+	.string	"puts"
+.LASF69:
+	.string	"st_extract_boolean"
+.LASF25:
+	.string	"tokens_extracted"
+.LASF66:
+	.string	"st_arena_release"
+.LASF12:
+	.string	"char"
+.LASF76:
+	.string	"st_arena_reset"
+.LASF78:
+	.string	"printf"
+.LASF56:
+	.string	"arena"
+.LASF5:
+	.string	"short unsigned int"
+.LASF94:
+	.string	"__builtin_putchar"
+.LASF10:
+	.string	"__uint64_t"
+.LASF89:
+	.string	"num_tests"
+.LASF23:
+	.string	"StringStats"
+.LASF2:
+	.string	"long unsigned int"
+.LASF57:
+	.string	"inline_buffer"
+.LASF65:
+	.string	"double"
+.LASF60:
+	.string	"StringStructuralIndex"
+.LASF95:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF44:
+	.string	"ST_STRING_OWNED"
+.LASF29:
+	.string	"bytes_copied"
+.LASF63:
+	.string	"in_string"
+.LASF79:
+	.string	"st_arena_alloc"
+.LASF62:
+	.string	"count"
+.LASF35:
+	.string	"chunk_size"
+.LASF68:
+	.string	"strcmp"
+.LASF6:
+	.string	"signed char"
+.LASF42:
+	.string	"StringOwnership"
+.LASF31:
+	.string	"conversion_ns"
+.LASF21:
+	.string	"used"
+.LASF39:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF80:
+	.string	"st_arena_create"
+.LASF38:
+	.string	"error"
+.LASF71:
+	.string	"st_next_token"
+.LASF75:
+	.string	"st_arena_destroy"
+.LASF47:
+	.string	"StringTokenizer"
+.LASF85:
+	.string	"number"
+.LASF88:
+	.string	"size_values"
+.LASF52:
+	.string	"growth_policy"
+.LASF54:
+	.string	"stream"
+.LASF96:
+	.string	"StringArenaBlock"
+.LASF32:
+	.string	"StringStream"
+.LASF90:
+	.string	"first"
+.LASF86:
+	.string	"boolean"
+.LASF28:
+	.string	"expansions"
+.LASF26:
+	.string	"allocations"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+.LASF0:
+	.string	"/root/repo/tests/string_arena_unit_tests.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
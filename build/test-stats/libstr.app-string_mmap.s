@@ -0,0 +1,1995 @@
+	.file	"string_mmap.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/src/string_mmap.c"
+	.p2align 4
+	.globl	st_create_from_mmap
+	.type	st_create_from_mmap, @function
+st_create_from_mmap:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/src/string_mmap.c"
+	.loc 1 10 63 view -0
+	.cfi_startproc
+	.loc 1 11 3 view .LVU1
+	.loc 1 11 6 is_stmt 0 view .LVU2
+	testq	%rdi, %rdi
+	je	.L13
+	.loc 1 14 3 is_stmt 1 view .LVU3
+	.loc 1 10 63 is_stmt 0 view .LVU4
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 14 12 view .LVU5
+	xorl	%esi, %esi
+	xorl	%eax, %eax
+	.loc 1 10 63 view .LVU6
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$144, %rsp
+	.cfi_def_cfa_offset 176
+	.loc 1 14 12 view .LVU7
+	call	open@PLT
+.LVL1:
+	.loc 1 14 12 view .LVU8
+	movl	%eax, %ebx
+.LVL2:
+	.loc 1 15 3 is_stmt 1 view .LVU9
+	.loc 1 15 6 is_stmt 0 view .LVU10
+	testl	%eax, %eax
+	js	.L3
+	.loc 1 19 3 is_stmt 1 view .LVU11
+	.loc 1 20 3 view .LVU12
+	.loc 1 20 7 is_stmt 0 view .LVU13
+	movq	%rsp, %rsi
+	movl	%eax, %edi
+	call	fstat@PLT
+.LVL3:
+	.loc 1 20 6 view .LVU14
+	testl	%eax, %eax
+	jne	.L5
+	.loc 1 20 40 discriminator 1 view .LVU15
+	movq	48(%rsp), %r12
+	.loc 1 20 31 discriminator 1 view .LVU16
+	testq	%r12, %r12
+	jle	.L5
+	.loc 1 24 3 is_stmt 1 view .LVU17
+.LVL4:
+	.loc 1 25 3 view .LVU18
+	.loc 1 25 18 is_stmt 0 view .LVU19
+	xorl	%edi, %edi
+	xorl	%r9d, %r9d
+	movl	%ebx, %r8d
+	movl	$2, %ecx
+	movl	$1, %edx
+	movq	%r12, %rsi
+	call	mmap@PLT
+.LVL5:
+	movq	%rax, %rbp
+.LVL6:
+	.loc 1 27 3 is_stmt 1 view .LVU20
+	movl	%ebx, %edi
+	call	close@PLT
+.LVL7:
+	.loc 1 28 3 view .LVU21
+	.loc 1 28 6 is_stmt 0 view .LVU22
+	cmpq	$-1, %rbp
+	je	.L3
+	.loc 1 32 3 is_stmt 1 view .LVU23
+	movl	$2, %edx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	madvise@PLT
+.LVL8:
+	.loc 1 34 3 view .LVU24
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movl	$14, %edx
+	call	madvise@PLT
+.LVL9:
+	.loc 1 36 3 view .LVU25
+	.loc 1 36 39 is_stmt 0 view .LVU26
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	st_create_n@PLT
+.LVL10:
+	.loc 1 37 3 is_stmt 1 view .LVU27
+	.loc 1 37 6 is_stmt 0 view .LVU28
+	testq	%rax, %rax
+	je	.L17
+	.loc 1 41 3 is_stmt 1 view .LVU29
+	.loc 1 41 24 is_stmt 0 view .LVU30
+	movl	$2, 56(%rax)
+	.loc 1 42 3 is_stmt 1 view .LVU31
+	.loc 1 43 1 is_stmt 0 view .LVU32
+	addq	$144, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL11:
+	.loc 1 43 1 view .LVU33
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL12:
+	.loc 1 43 1 view .LVU34
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL13:
+	.loc 1 43 1 view .LVU35
+	ret
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.cfi_restore_state
+	.loc 1 21 5 is_stmt 1 view .LVU36
+	movl	%ebx, %edi
+	call	close@PLT
+.LVL15:
+	.loc 1 22 5 view .LVU37
+.L3:
+	.loc 1 12 11 is_stmt 0 view .LVU38
+	xorl	%eax, %eax
+.L18:
+	.loc 1 43 1 view .LVU39
+	addq	$144, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL16:
+	.loc 1 43 1 view .LVU40
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL17:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.loc 1 12 11 view .LVU41
+	xorl	%eax, %eax
+	.loc 1 43 1 view .LVU42
+	ret
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.cfi_def_cfa_offset 176
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+	.loc 1 38 5 is_stmt 1 view .LVU43
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	munmap@PLT
+.LVL19:
+	.loc 1 39 5 view .LVU44
+	.loc 1 12 11 is_stmt 0 view .LVU45
+	xorl	%eax, %eax
+	jmp	.L18
+	.cfi_endproc
+.LFE26:
+	.size	st_create_from_mmap, .-st_create_from_mmap
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 5 "/usr/include/unistd.h"
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "/root/repo/src/../include/strutils.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 11 "/usr/include/fcntl.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x79e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x15
+	.long	.LASF103
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x5
+	.long	.LASF9
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x5
+	.long	.LASF10
+	.byte	0x2
+	.byte	0x91
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x5
+	.long	.LASF11
+	.byte	0x2
+	.byte	0x92
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x2
+	.byte	0x93
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x2
+	.byte	0x94
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x2
+	.byte	0x96
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF15
+	.byte	0x2
+	.byte	0x97
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x5
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x98
+	.byte	0x12
+	.long	0x5f
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x2
+	.byte	0xa0
+	.byte	0x12
+	.long	0x5f
+	.uleb128 0x17
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x2
+	.byte	0xaf
+	.byte	0x12
+	.long	0x5f
+	.uleb128 0x5
+	.long	.LASF19
+	.byte	0x2
+	.byte	0xb4
+	.byte	0x12
+	.long	0x5f
+	.uleb128 0x5
+	.long	.LASF20
+	.byte	0x2
+	.byte	0xc2
+	.byte	0x12
+	.long	0x5f
+	.uleb128 0x5
+	.long	.LASF21
+	.byte	0x2
+	.byte	0xc5
+	.byte	0x12
+	.long	0x5f
+	.uleb128 0x7
+	.long	0x109
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF22
+	.uleb128 0xd
+	.long	0x109
+	.uleb128 0xe
+	.long	.LASF25
+	.byte	0x10
+	.byte	0x3
+	.byte	0xb
+	.long	0x13c
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x3
+	.byte	0x10
+	.byte	0xc
+	.long	0xc6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF24
+	.byte	0x3
+	.byte	0x15
+	.byte	0x15
+	.long	0xf8
+	.byte	0x8
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF26
+	.byte	0x90
+	.byte	0x4
+	.byte	0x1a
+	.long	0x20c
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x1f
+	.byte	0xd
+	.long	0x72
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF28
+	.byte	0x4
+	.byte	0x24
+	.byte	0xd
+	.long	0x96
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x2c
+	.byte	0xf
+	.long	0xae
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xe
+	.long	0xa2
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xd
+	.long	0x7e
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x4
+	.byte	0x30
+	.byte	0xd
+	.long	0x8a
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0x4
+	.byte	0x32
+	.byte	0x9
+	.long	0x58
+	.byte	0x24
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x4
+	.byte	0x34
+	.byte	0xd
+	.long	0x72
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x4
+	.byte	0x39
+	.byte	0xd
+	.long	0xba
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x11
+	.long	0xd4
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF37
+	.byte	0x4
+	.byte	0x3f
+	.byte	0x10
+	.long	0xe0
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF38
+	.byte	0x4
+	.byte	0x4a
+	.byte	0x15
+	.long	0x115
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF39
+	.byte	0x4
+	.byte	0x4b
+	.byte	0x15
+	.long	0x115
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x4
+	.byte	0x4c
+	.byte	0x15
+	.long	0x115
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF41
+	.byte	0x4
+	.byte	0x59
+	.byte	0x17
+	.long	0x20c
+	.byte	0x78
+	.byte	0
+	.uleb128 0xf
+	.long	0xf8
+	.long	0x21c
+	.uleb128 0x10
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF42
+	.byte	0x5
+	.byte	0xdc
+	.byte	0x13
+	.long	0xec
+	.uleb128 0x5
+	.long	.LASF43
+	.byte	0x6
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0xd
+	.long	0x228
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF44
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF45
+	.uleb128 0x5
+	.long	.LASF46
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x14
+	.long	0x66
+	.uleb128 0x7
+	.long	0x110
+	.uleb128 0xb
+	.long	.LASF47
+	.byte	0x18
+	.value	0x175
+	.long	0x28c
+	.uleb128 0x1
+	.long	.LASF48
+	.value	0x17a
+	.byte	0x1c
+	.long	0x291
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF49
+	.value	0x17f
+	.byte	0xa
+	.long	0x228
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF50
+	.value	0x184
+	.byte	0xa
+	.long	0x228
+	.byte	0x10
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF104
+	.uleb128 0x7
+	.long	0x28c
+	.uleb128 0x6
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF51
+	.uleb128 0xb
+	.long	.LASF52
+	.byte	0x40
+	.value	0x1e6
+	.long	0x312
+	.uleb128 0x1
+	.long	.LASF53
+	.value	0x1eb
+	.byte	0xc
+	.long	0x247
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF54
+	.value	0x1f0
+	.byte	0xc
+	.long	0x247
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF55
+	.value	0x1f5
+	.byte	0xc
+	.long	0x247
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF56
+	.value	0x1fa
+	.byte	0xc
+	.long	0x247
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF57
+	.value	0x1ff
+	.byte	0xc
+	.long	0x247
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF58
+	.value	0x204
+	.byte	0xc
+	.long	0x247
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF59
+	.value	0x209
+	.byte	0xc
+	.long	0x247
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF60
+	.value	0x20e
+	.byte	0xc
+	.long	0x247
+	.byte	0x38
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF61
+	.byte	0x38
+	.value	0x26c
+	.long	0x384
+	.uleb128 0x1
+	.long	.LASF62
+	.value	0x272
+	.byte	0xd
+	.long	0x39d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF63
+	.value	0x277
+	.byte	0x9
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0x11
+	.string	"fd"
+	.value	0x27c
+	.long	0x58
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF64
+	.value	0x281
+	.byte	0xa
+	.long	0x228
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF65
+	.value	0x286
+	.byte	0xa
+	.long	0x228
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF66
+	.value	0x28b
+	.byte	0xa
+	.long	0x228
+	.byte	0x28
+	.uleb128 0x11
+	.string	"eof"
+	.value	0x290
+	.long	0x58
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF67
+	.value	0x295
+	.byte	0x7
+	.long	0x58
+	.byte	0x34
+	.byte	0
+	.uleb128 0x19
+	.long	0x21c
+	.long	0x39d
+	.uleb128 0x3
+	.long	0xd2
+	.uleb128 0x3
+	.long	0x104
+	.uleb128 0x3
+	.long	0x228
+	.byte	0
+	.uleb128 0x7
+	.long	0x384
+	.uleb128 0x12
+	.long	.LASF70
+	.long	0x3c
+	.value	0x29b
+	.long	0x3be
+	.uleb128 0x9
+	.long	.LASF68
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF69
+	.byte	0x1
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF71
+	.long	0x3c
+	.value	0x2b5
+	.long	0x3e6
+	.uleb128 0x9
+	.long	.LASF72
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF73
+	.byte	0x1
+	.uleb128 0x9
+	.long	.LASF74
+	.byte	0x2
+	.uleb128 0x9
+	.long	.LASF75
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF76
+	.value	0x158
+	.byte	0x8
+	.value	0x2cf
+	.byte	0x8
+	.long	0x494
+	.uleb128 0x1
+	.long	.LASF77
+	.value	0x2d4
+	.byte	0x9
+	.long	0x104
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF78
+	.value	0x2d9
+	.byte	0xa
+	.long	0x228
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF79
+	.value	0x2de
+	.byte	0xa
+	.long	0x228
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF80
+	.value	0x2e3
+	.byte	0xa
+	.long	0x228
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF81
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x3a2
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF82
+	.value	0x2ed
+	.byte	0xa
+	.long	0x228
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF83
+	.value	0x2f2
+	.byte	0x18
+	.long	0x494
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF84
+	.value	0x2f7
+	.byte	0x18
+	.long	0x3be
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF85
+	.value	0x2fc
+	.byte	0x17
+	.long	0x499
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF86
+	.value	0x301
+	.byte	0x8
+	.long	0x49e
+	.byte	0x48
+	.uleb128 0x13
+	.long	.LASF87
+	.value	0x306
+	.byte	0x21
+	.long	0x4fc
+	.value	0x148
+	.uleb128 0x13
+	.long	.LASF88
+	.value	0x30b
+	.byte	0x17
+	.long	0x501
+	.value	0x150
+	.byte	0
+	.uleb128 0x7
+	.long	0x312
+	.uleb128 0x7
+	.long	0x258
+	.uleb128 0xf
+	.long	0x109
+	.long	0x4ae
+	.uleb128 0x10
+	.long	0x43
+	.byte	0xff
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF89
+	.byte	0x28
+	.value	0x764
+	.long	0x4fc
+	.uleb128 0x1
+	.long	.LASF90
+	.value	0x769
+	.byte	0xb
+	.long	0x50d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF91
+	.value	0x76e
+	.byte	0xa
+	.long	0x228
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF92
+	.value	0x774
+	.byte	0xd
+	.long	0x512
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF78
+	.value	0x779
+	.byte	0xa
+	.long	0x228
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF93
+	.value	0x77e
+	.byte	0xa
+	.long	0x228
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0x4ae
+	.uleb128 0x7
+	.long	0x29d
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF94
+	.uleb128 0x7
+	.long	0x228
+	.uleb128 0x7
+	.long	0x247
+	.uleb128 0x7
+	.long	0x3e6
+	.uleb128 0xa
+	.long	.LASF95
+	.byte	0x9
+	.byte	0x4c
+	.byte	0xc
+	.long	0x58
+	.long	0x537
+	.uleb128 0x3
+	.long	0xd2
+	.uleb128 0x3
+	.long	0x228
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF96
+	.byte	0x8
+	.value	0x326
+	.byte	0x19
+	.long	0x517
+	.long	0x553
+	.uleb128 0x3
+	.long	0x104
+	.uleb128 0x3
+	.long	0x234
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF97
+	.byte	0x9
+	.byte	0x5e
+	.byte	0xc
+	.long	0x58
+	.long	0x573
+	.uleb128 0x3
+	.long	0xd2
+	.uleb128 0x3
+	.long	0x228
+	.uleb128 0x3
+	.long	0x58
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF98
+	.byte	0x9
+	.byte	0x39
+	.byte	0xe
+	.long	0xd2
+	.long	0x5a2
+	.uleb128 0x3
+	.long	0xd2
+	.uleb128 0x3
+	.long	0x228
+	.uleb128 0x3
+	.long	0x58
+	.uleb128 0x3
+	.long	0x58
+	.uleb128 0x3
+	.long	0x58
+	.uleb128 0x3
+	.long	0xba
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF99
+	.byte	0x5
+	.value	0x166
+	.byte	0xc
+	.long	0x58
+	.long	0x5b9
+	.uleb128 0x3
+	.long	0x58
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF100
+	.byte	0xa
+	.byte	0xd2
+	.byte	0xc
+	.long	0x58
+	.long	0x5d4
+	.uleb128 0x3
+	.long	0x58
+	.uleb128 0x3
+	.long	0x5d4
+	.byte	0
+	.uleb128 0x7
+	.long	0x13c
+	.uleb128 0xa
+	.long	.LASF101
+	.byte	0xb
+	.byte	0xb5
+	.byte	0xc
+	.long	0x58
+	.long	0x5f5
+	.uleb128 0x3
+	.long	0x253
+	.uleb128 0x3
+	.long	0x58
+	.uleb128 0x1b
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF105
+	.byte	0x1
+	.byte	0xa
+	.byte	0x19
+	.long	0x517
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1d
+	.long	.LASF106
+	.byte	0x1
+	.byte	0xa
+	.byte	0x39
+	.long	0x253
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1e
+	.string	"fd"
+	.byte	0x1
+	.byte	0xe
+	.byte	0x7
+	.long	0x58
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1f
+	.long	.LASF107
+	.byte	0x1
+	.byte	0x13
+	.byte	0xf
+	.long	0x13c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0xc
+	.long	.LASF78
+	.byte	0x18
+	.byte	0xa
+	.long	0x228
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xc
+	.long	.LASF77
+	.byte	0x19
+	.byte	0x9
+	.long	0xd2
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xc
+	.long	.LASF102
+	.byte	0x24
+	.byte	0x1b
+	.long	0x517
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x8
+	.quad	.LVL1
+	.long	0x5d9
+	.long	0x6a1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL3
+	.long	0x5b9
+	.long	0x6c0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL5
+	.long	0x573
+	.long	0x6f2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL7
+	.long	0x5a2
+	.long	0x70a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL8
+	.long	0x553
+	.long	0x72d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL9
+	.long	0x553
+	.long	0x750
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3e
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL10
+	.long	0x537
+	.long	0x76e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL15
+	.long	0x5a2
+	.long	0x786
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL19
+	.long	0x51c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU9
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU33
+	.uleb128 .LVU36
+	.uleb128 .LVU40
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU18
+	.uleb128 .LVU35
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU20
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU34
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU27
+	.uleb128 .LVU36
+	.uleb128 .LVU43
+	.uleb128 .LVU44
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF99:
+	.string	"close"
+.LASF24:
+	.string	"tv_nsec"
+.LASF79:
+	.string	"position"
+.LASF49:
+	.string	"block_size"
+.LASF75:
+	.string	"ST_STRING_INLINE"
+.LASF6:
+	.string	"signed char"
+.LASF23:
+	.string	"tv_sec"
+.LASF97:
+	.string	"madvise"
+.LASF46:
+	.string	"uint64_t"
+.LASF14:
+	.string	"__mode_t"
+.LASF43:
+	.string	"size_t"
+.LASF40:
+	.string	"st_ctim"
+.LASF90:
+	.string	"positions"
+.LASF87:
+	.string	"structural_index"
+.LASF88:
+	.string	"stats"
+.LASF21:
+	.string	"__syscall_slong_t"
+.LASF54:
+	.string	"tokens_extracted"
+.LASF27:
+	.string	"st_dev"
+.LASF29:
+	.string	"st_nlink"
+.LASF34:
+	.string	"st_rdev"
+.LASF7:
+	.string	"short int"
+.LASF84:
+	.string	"ownership"
+.LASF59:
+	.string	"conversions"
+.LASF48:
+	.string	"head"
+.LASF74:
+	.string	"ST_STRING_MAPPED"
+.LASF47:
+	.string	"StringArena"
+.LASF93:
+	.string	"hint"
+.LASF78:
+	.string	"length"
+.LASF36:
+	.string	"st_blksize"
+.LASF62:
+	.string	"read"
+.LASF44:
+	.string	"long long int"
+.LASF32:
+	.string	"st_gid"
+.LASF20:
+	.string	"__ssize_t"
+.LASF8:
+	.string	"long int"
+.LASF77:
+	.string	"string"
+.LASF102:
+	.string	"tokenizer"
+.LASF66:
+	.string	"offset"
+.LASF15:
+	.string	"__nlink_t"
+.LASF63:
+	.string	"context"
+.LASF82:
+	.string	"max_increment"
+.LASF80:
+	.string	"incremental_factor"
+.LASF2:
+	.string	"unsigned char"
+.LASF72:
+	.string	"ST_STRING_BORROWED"
+.LASF70:
+	.string	"StringGrowthPolicy"
+.LASF56:
+	.string	"reallocations"
+.LASF51:
+	.string	"long double"
+.LASF26:
+	.string	"stat"
+.LASF28:
+	.string	"st_ino"
+.LASF105:
+	.string	"st_create_from_mmap"
+.LASF69:
+	.string	"ST_GROWTH_LINEAR"
+.LASF65:
+	.string	"capacity"
+.LASF45:
+	.string	"long long unsigned int"
+.LASF100:
+	.string	"fstat"
+.LASF4:
+	.string	"unsigned int"
+.LASF83:
+	.string	"stream"
+.LASF18:
+	.string	"__blksize_t"
+.LASF38:
+	.string	"st_atim"
+.LASF3:
+	.string	"short unsigned int"
+.LASF107:
+	.string	"status"
+.LASF22:
+	.string	"char"
+.LASF98:
+	.string	"mmap"
+.LASF57:
+	.string	"expansions"
+.LASF85:
+	.string	"arena"
+.LASF33:
+	.string	"__pad0"
+.LASF11:
+	.string	"__uid_t"
+.LASF37:
+	.string	"st_blocks"
+.LASF9:
+	.string	"__uint64_t"
+.LASF39:
+	.string	"st_mtim"
+.LASF13:
+	.string	"__ino_t"
+.LASF31:
+	.string	"st_uid"
+.LASF35:
+	.string	"st_size"
+.LASF52:
+	.string	"StringStats"
+.LASF5:
+	.string	"long unsigned int"
+.LASF86:
+	.string	"inline_buffer"
+.LASF94:
+	.string	"double"
+.LASF89:
+	.string	"StringStructuralIndex"
+.LASF103:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF73:
+	.string	"ST_STRING_OWNED"
+.LASF16:
+	.string	"__off_t"
+.LASF58:
+	.string	"bytes_copied"
+.LASF92:
+	.string	"in_string"
+.LASF17:
+	.string	"__time_t"
+.LASF91:
+	.string	"count"
+.LASF10:
+	.string	"__dev_t"
+.LASF64:
+	.string	"chunk_size"
+.LASF95:
+	.string	"munmap"
+.LASF106:
+	.string	"path"
+.LASF41:
+	.string	"__glibc_reserved"
+.LASF60:
+	.string	"conversion_ns"
+.LASF50:
+	.string	"used"
+.LASF68:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF101:
+	.string	"open"
+.LASF42:
+	.string	"ssize_t"
+.LASF25:
+	.string	"timespec"
+.LASF71:
+	.string	"StringOwnership"
+.LASF67:
+	.string	"error"
+.LASF96:
+	.string	"st_create_n"
+.LASF76:
+	.string	"StringTokenizer"
+.LASF30:
+	.string	"st_mode"
+.LASF53:
+	.string	"bytes_scanned"
+.LASF81:
+	.string	"growth_policy"
+.LASF104:
+	.string	"StringArenaBlock"
+.LASF61:
+	.string	"StringStream"
+.LASF19:
+	.string	"__blkcnt_t"
+.LASF12:
+	.string	"__gid_t"
+.LASF55:
+	.string	"allocations"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/string_mmap.c"
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
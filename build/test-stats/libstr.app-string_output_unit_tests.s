@@ -0,0 +1,5034 @@
+	.file	"string_output_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/tests/string_output_unit_tests.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"{\"id\":"
+.LC2:
+	.string	",\"value\":"
+	.text
+	.p2align 4
+	.type	output_test_fill, @function
+output_test_fill:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/tests/string_output_unit_tests.c"
+	.loc 1 12 92 view -0
+	.cfi_startproc
+	.loc 1 13 3 view .LVU1
+.LBB2:
+	.loc 1 13 8 view .LVU2
+	.loc 1 13 21 view .LVU3
+.LBE2:
+	.loc 1 12 92 is_stmt 0 view .LVU4
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+.LBB7:
+.LBB3:
+	.loc 1 16 9 view .LVU5
+	leaq	.LC2(%rip), %r14
+.LBE3:
+.LBE7:
+	.loc 1 12 92 view .LVU6
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	leaq	.LC1(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	xorl	%ebx, %ebx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	jmp	.L5
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+.LBB8:
+.LBB4:
+	.loc 1 15 61 discriminator 1 view .LVU7
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	st_output_append_int@PLT
+.LVL2:
+	.loc 1 15 58 discriminator 1 view .LVU8
+	testl	%eax, %eax
+	je	.L4
+	.loc 1 16 9 discriminator 2 view .LVU9
+	movl	$9, %edx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	st_output_append_n@PLT
+.LVL3:
+	.loc 1 15 98 discriminator 2 view .LVU10
+	testl	%eax, %eax
+	je	.L4
+	.loc 1 16 62 view .LVU11
+	vmovsd	8(%rsp), %xmm0
+	movq	%rbp, %rdi
+	call	st_output_append_double@PLT
+.LVL4:
+	.loc 1 16 59 view .LVU12
+	testl	%eax, %eax
+	je	.L4
+	.loc 1 17 9 discriminator 1 view .LVU13
+	movl	$125, %esi
+	movq	%rbp, %rdi
+	call	st_output_append_char@PLT
+.LVL5:
+	.loc 1 16 106 discriminator 1 view .LVU14
+	testl	%eax, %eax
+	je	.L4
+	.loc 1 20 5 is_stmt 1 view .LVU15
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	call	st_append_string@PLT
+.LVL6:
+	.loc 1 21 5 view .LVU16
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	st_append_int@PLT
+.LVL7:
+	.loc 1 22 5 view .LVU17
+	movl	$9, %edx
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	call	st_append_n@PLT
+.LVL8:
+	.loc 1 23 5 view .LVU18
+	leaq	8(%rsp), %rsi
+	movq	%r12, %rdi
+	call	st_append_double@PLT
+.LVL9:
+	.loc 1 24 5 view .LVU19
+.LBE4:
+	.loc 1 13 21 is_stmt 0 view .LVU20
+	incq	%rbx
+.LVL10:
+.LBB5:
+	.loc 1 24 5 view .LVU21
+	movl	$125, %esi
+	movq	%r12, %rdi
+	call	st_append_char@PLT
+.LVL11:
+.LBE5:
+	.loc 1 13 30 is_stmt 1 view .LVU22
+	.loc 1 13 21 view .LVU23
+	cmpq	$2000, %rbx
+	je	.L21
+.L5:
+.LVL12:
+.LBB6:
+	.loc 1 14 5 view .LVU24
+	.loc 1 14 22 is_stmt 0 view .LVU25
+	vxorpd	%xmm1, %xmm1, %xmm1
+	vcvtsi2sdl	%ebx, %xmm1, %xmm0
+	.loc 1 15 9 view .LVU26
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+	.loc 1 14 22 view .LVU27
+	vmulsd	.LC0(%rip), %xmm0, %xmm0
+	.loc 1 14 12 view .LVU28
+	vmovsd	%xmm0, 8(%rsp)
+	.loc 1 15 5 is_stmt 1 view .LVU29
+	.loc 1 15 9 is_stmt 0 view .LVU30
+	call	st_output_append_string@PLT
+.LVL13:
+	.loc 1 15 8 view .LVU31
+	testl	%eax, %eax
+	jne	.L2
+.L4:
+	.loc 1 18 7 is_stmt 1 view .LVU32
+	.loc 1 18 14 is_stmt 0 view .LVU33
+	xorl	%eax, %eax
+.LVL14:
+.L1:
+	.loc 1 18 14 view .LVU34
+.LBE6:
+.LBE8:
+	.loc 1 27 1 view .LVU35
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL15:
+	.loc 1 27 1 view .LVU36
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL16:
+	.loc 1 27 1 view .LVU37
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL17:
+.L21:
+	.cfi_restore_state
+	.loc 1 26 10 view .LVU38
+	movl	$1, %eax
+	jmp	.L1
+	.cfi_endproc
+.LFE26:
+	.size	output_test_fill, .-output_test_fill
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC5:
+	.string	"------------------- st_output_flush(x) -------------------"
+	.align 8
+.LC6:
+	.string	"[Failed] Blocks of %zu with a threshold of %zu failed.\n"
+	.align 8
+.LC7:
+	.string	"[Passed] Blocks of %zu with a threshold of %zu wrote %zu characters.\n"
+	.text
+	.p2align 4
+	.globl	run_st_output_flush_unit_tests
+	.type	run_st_output_flush_unit_tests, @function
+run_st_output_flush_unit_tests:
+.LFB27:
+	.loc 1 32 38 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 34 3 view .LVU40
+	.loc 1 32 38 is_stmt 0 view .LVU41
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 39 3 view .LVU42
+	leaq	.LC5(%rip), %rdi
+	.loc 1 32 38 view .LVU43
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-32, %rsp
+	addq	$-128, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 34 10 view .LVU44
+	vmovdqa	.LC3(%rip), %ymm0
+	vmovdqa	%ymm0, 64(%rsp)
+	.loc 1 35 3 is_stmt 1 view .LVU45
+	.loc 1 35 10 is_stmt 0 view .LVU46
+	vmovdqa	.LC4(%rip), %ymm0
+	vmovdqa	%ymm0, 96(%rsp)
+	.loc 1 37 3 is_stmt 1 view .LVU47
+.LVL18:
+	.loc 1 39 3 view .LVU48
+	vzeroupper
+.LVL19:
+	call	puts@PLT
+.LVL20:
+	.loc 1 41 3 view .LVU49
+	.loc 1 42 3 view .LVU50
+.LBB9:
+	.loc 1 42 8 view .LVU51
+	.loc 1 42 21 view .LVU52
+	leaq	96(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	leaq	64(%rsp), %rax
+.LBE9:
+	.loc 1 41 7 is_stmt 0 view .LVU53
+	movl	$0, 44(%rsp)
+	movq	%rax, 24(%rsp)
+	.loc 1 39 3 view .LVU54
+	xorl	%r14d, %r14d
+.LVL21:
+.L29:
+.LBB12:
+.LBB10:
+	.loc 1 43 5 is_stmt 1 view .LVU55
+	.loc 1 43 18 is_stmt 0 view .LVU56
+	call	tmpfile@PLT
+.LVL22:
+	movq	%rax, %rbx
+.LVL23:
+	.loc 1 44 5 is_stmt 1 view .LVU57
+	.loc 1 44 118 is_stmt 0 view .LVU58
+	testq	%rax, %rax
+	je	.L36
+	.loc 1 44 49 discriminator 1 view .LVU59
+	movq	32(%rsp), %rax
+.LVL24:
+	.loc 1 44 49 discriminator 1 view .LVU60
+	movq	%rbx, %rdi
+	movq	(%rax,%r14), %r15
+	movq	24(%rsp), %rax
+	movq	(%rax,%r14), %r13
+	movq	%r13, 48(%rsp)
+	call	fileno@PLT
+.LVL25:
+	movl	%eax, %edi
+	movq	%r13, %rsi
+	movq	%r15, %rdx
+	call	st_output_create@PLT
+.LVL26:
+	.loc 1 45 40 discriminator 1 view .LVU61
+	movl	$1, %edi
+	.loc 1 44 49 discriminator 1 view .LVU62
+	movq	%rax, %r13
+.LVL27:
+	.loc 1 45 5 is_stmt 1 discriminator 1 view .LVU63
+	.loc 1 45 40 is_stmt 0 discriminator 1 view .LVU64
+	call	st_create_empty@PLT
+.LVL28:
+	.loc 1 45 40 discriminator 1 view .LVU65
+	movq	%rax, %r12
+.LVL29:
+	.loc 1 46 5 is_stmt 1 discriminator 1 view .LVU66
+	.loc 1 46 71 is_stmt 0 discriminator 1 view .LVU67
+	testq	%r13, %r13
+	je	.L35
+	.loc 1 46 36 discriminator 1 view .LVU68
+	movq	%rax, %rsi
+	movq	%r13, %rdi
+	call	output_test_fill
+.LVL30:
+	.loc 1 46 33 discriminator 1 view .LVU69
+	testl	%eax, %eax
+	jne	.L27
+.L35:
+.LVL31:
+	.loc 1 48 5 is_stmt 1 view .LVU70
+	.loc 1 48 28 is_stmt 0 view .LVU71
+	movq	16(%r12), %rax
+	leaq	1(%rax), %rdi
+	call	malloc@PLT
+.LVL32:
+	movq	%rax, 56(%rsp)
+.LVL33:
+	.loc 1 49 5 is_stmt 1 view .LVU72
+	.loc 1 50 5 view .LVU73
+.L26:
+	.loc 1 55 7 view .LVU74
+	movq	48(%rsp), %rsi
+	movq	%r15, %rdx
+	leaq	.LC6(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL34:
+	.loc 1 56 7 view .LVU75
+	.loc 1 62 5 view .LVU76
+	movq	56(%rsp), %rdi
+	call	free@PLT
+.LVL35:
+	.loc 1 63 5 view .LVU77
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL36:
+	.loc 1 64 5 view .LVU78
+	movq	%r13, %rdi
+	call	st_output_destroy@PLT
+.LVL37:
+	.loc 1 65 5 view .LVU79
+	.loc 1 56 19 is_stmt 0 view .LVU80
+	movl	$1, 44(%rsp)
+.LVL38:
+.L30:
+	.loc 1 66 7 is_stmt 1 view .LVU81
+	movq	%rbx, %rdi
+	call	fclose@PLT
+.LVL39:
+.L24:
+	.loc 1 66 7 is_stmt 0 view .LVU82
+.LBE10:
+	.loc 1 42 35 is_stmt 1 discriminator 2 view .LVU83
+	.loc 1 42 21 discriminator 2 view .LVU84
+	addq	$8, %r14
+.LVL40:
+	.loc 1 42 21 is_stmt 0 discriminator 2 view .LVU85
+	cmpq	$32, %r14
+	jne	.L29
+.LBE12:
+	.loc 1 69 3 is_stmt 1 view .LVU86
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL41:
+	.loc 1 71 3 view .LVU87
+	.loc 1 72 1 is_stmt 0 view .LVU88
+	movl	44(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL42:
+	.loc 1 72 1 view .LVU89
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+.LVL43:
+	.loc 1 72 1 view .LVU90
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL44:
+	.loc 1 72 1 view .LVU91
+	ret
+.LVL45:
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.cfi_restore_state
+.LBB13:
+.LBB11:
+	.loc 1 46 74 discriminator 3 view .LVU92
+	movq	%r13, %rdi
+	call	st_output_flush@PLT
+.LVL46:
+	.loc 1 46 71 discriminator 3 view .LVU93
+	testl	%eax, %eax
+	.loc 1 48 28 discriminator 3 view .LVU94
+	movq	16(%r12), %rax
+	leaq	1(%rax), %rdi
+	.loc 1 46 71 discriminator 3 view .LVU95
+	je	.L28
+.LVL47:
+	.loc 1 48 5 is_stmt 1 view .LVU96
+	.loc 1 48 28 is_stmt 0 view .LVU97
+	call	malloc@PLT
+.LVL48:
+	.loc 1 51 7 view .LVU98
+	movq	%rbx, %rdi
+	.loc 1 48 28 view .LVU99
+	movq	%rax, 16(%rsp)
+	movq	%rax, 56(%rsp)
+.LVL49:
+	.loc 1 49 5 is_stmt 1 view .LVU100
+	.loc 1 50 5 view .LVU101
+	.loc 1 51 7 view .LVU102
+	call	rewind@PLT
+.LVL50:
+	.loc 1 52 7 view .LVU103
+	.loc 1 52 16 is_stmt 0 view .LVU104
+	movq	16(%r12), %rcx
+	movq	16(%rsp), %rdi
+	leaq	1(%rcx), %rdx
+	movl	$1, %esi
+	movq	%rbx, %rcx
+	call	fread@PLT
+.LVL51:
+	.loc 1 54 22 view .LVU105
+	cmpq	$0, 32(%r13)
+	.loc 1 52 16 view .LVU106
+	movq	%rax, %rcx
+.LVL52:
+	.loc 1 54 5 is_stmt 1 view .LVU107
+	.loc 1 54 22 is_stmt 0 view .LVU108
+	jne	.L26
+	.loc 1 54 75 discriminator 2 view .LVU109
+	movq	16(%r12), %rax
+.LVL53:
+	.loc 1 54 86 discriminator 2 view .LVU110
+	cmpq	%rax, 56(%r13)
+	jne	.L26
+	cmpq	%rcx, %rax
+	jne	.L26
+	.loc 1 54 121 discriminator 4 view .LVU111
+	movq	(%r12), %rsi
+	movq	16(%rsp), %rdi
+	movq	%rcx, %rdx
+	movq	%rcx, 8(%rsp)
+	call	memcmp@PLT
+.LVL54:
+	.loc 1 54 118 discriminator 4 view .LVU112
+	testl	%eax, %eax
+	movq	8(%rsp), %rcx
+	jne	.L26
+	.loc 1 60 7 is_stmt 1 view .LVU113
+	movq	48(%rsp), %rsi
+	movq	%r15, %rdx
+	leaq	.LC7(%rip), %rdi
+	call	printf@PLT
+.LVL55:
+	.loc 1 62 5 view .LVU114
+	movq	16(%rsp), %rdi
+	call	free@PLT
+.LVL56:
+	.loc 1 63 5 view .LVU115
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL57:
+	.loc 1 64 5 view .LVU116
+	movq	%r13, %rdi
+	call	st_output_destroy@PLT
+.LVL58:
+	.loc 1 65 5 view .LVU117
+	jmp	.L30
+.LVL59:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.loc 1 48 5 view .LVU118
+	.loc 1 48 28 is_stmt 0 view .LVU119
+	call	malloc@PLT
+.LVL60:
+	movq	%rax, 56(%rsp)
+.LVL61:
+	.loc 1 49 5 is_stmt 1 view .LVU120
+	.loc 1 50 5 view .LVU121
+	jmp	.L26
+.LVL62:
+.L36:
+	.loc 1 45 5 view .LVU122
+	.loc 1 45 40 is_stmt 0 view .LVU123
+	movl	$1, %edi
+	call	st_create_empty@PLT
+.LVL63:
+	.loc 1 45 40 view .LVU124
+	movq	%rax, %rbx
+.LVL64:
+	.loc 1 46 5 is_stmt 1 view .LVU125
+	.loc 1 48 5 view .LVU126
+	.loc 1 49 5 view .LVU127
+	.loc 1 50 5 view .LVU128
+	.loc 1 55 7 view .LVU129
+	movq	32(%rsp), %rax
+.LVL65:
+	.loc 1 55 7 is_stmt 0 view .LVU130
+	leaq	.LC6(%rip), %rdi
+	movq	(%rax,%r14), %rdx
+	movq	24(%rsp), %rax
+	movq	(%rax,%r14), %rsi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL66:
+	.loc 1 56 7 is_stmt 1 view .LVU131
+	.loc 1 62 5 view .LVU132
+	.loc 1 63 5 view .LVU133
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL67:
+	.loc 1 64 5 view .LVU134
+	xorl	%edi, %edi
+	call	st_output_destroy@PLT
+.LVL68:
+	.loc 1 65 5 view .LVU135
+	.loc 1 56 19 is_stmt 0 view .LVU136
+	movl	$1, 44(%rsp)
+	jmp	.L24
+.LBE11:
+.LBE13:
+	.cfi_endproc
+.LFE27:
+	.size	run_st_output_flush_unit_tests, .-run_st_output_flush_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC8:
+	.string	"------------------- st_output_iov(x) -------------------"
+	.align 8
+.LC9:
+	.string	"[Failed] Blocks of %zu listed %zu entries.\n"
+	.align 8
+.LC10:
+	.string	"[Passed] Blocks of %zu listed %zu entries in order.\n"
+	.align 8
+.LC11:
+	.string	"[Failed] Blocks of %zu were not discarded.\n"
+	.text
+	.p2align 4
+	.globl	run_st_output_iov_unit_tests
+	.type	run_st_output_iov_unit_tests, @function
+run_st_output_iov_unit_tests:
+.LFB28:
+	.loc 1 77 36 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 79 3 view .LVU138
+	.loc 1 77 36 is_stmt 0 view .LVU139
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 83 3 view .LVU140
+	leaq	.LC8(%rip), %rdi
+	.loc 1 77 36 view .LVU141
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	.loc 1 79 10 view .LVU142
+	movq	$8, 48(%rsp)
+	movq	$100, 56(%rsp)
+	movq	$0, 64(%rsp)
+	.loc 1 81 3 is_stmt 1 view .LVU143
+.LVL69:
+	.loc 1 83 3 view .LVU144
+	call	puts@PLT
+.LVL70:
+	.loc 1 85 3 view .LVU145
+	.loc 1 86 3 view .LVU146
+.LBB14:
+	.loc 1 86 8 view .LVU147
+	.loc 1 86 21 view .LVU148
+	leaq	72(%rsp), %rax
+	movq	%rax, 40(%rsp)
+.LBE14:
+	.loc 1 85 7 is_stmt 0 view .LVU149
+	movl	$0, 24(%rsp)
+	leaq	48(%rsp), %r15
+.LVL71:
+.L46:
+.LBB19:
+.LBB15:
+	.loc 1 87 5 is_stmt 1 view .LVU150
+	.loc 1 87 35 is_stmt 0 view .LVU151
+	movq	(%r15), %rax
+	movl	$1, %edx
+	movq	%rax, %rsi
+	movl	$-1, %edi
+	movq	%rax, (%rsp)
+	call	st_output_create@PLT
+.LVL72:
+	.loc 1 88 40 view .LVU152
+	movl	$1, %edi
+	.loc 1 87 35 view .LVU153
+	movq	%rax, %r12
+.LVL73:
+	.loc 1 88 5 is_stmt 1 view .LVU154
+	.loc 1 88 40 is_stmt 0 view .LVU155
+	call	st_create_empty@PLT
+.LVL74:
+	.loc 1 88 40 view .LVU156
+	movq	%rax, %rbx
+	.loc 1 89 38 view .LVU157
+	movl	$1, %edi
+	.loc 1 88 40 view .LVU158
+	movq	%rax, 16(%rsp)
+.LVL75:
+	.loc 1 89 5 is_stmt 1 view .LVU159
+	.loc 1 89 38 is_stmt 0 view .LVU160
+	call	st_create_empty@PLT
+.LVL76:
+	.loc 1 90 18 view .LVU161
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	.loc 1 89 38 view .LVU162
+	movq	%rax, %rbp
+.LVL77:
+	.loc 1 90 5 is_stmt 1 view .LVU163
+	.loc 1 90 18 is_stmt 0 view .LVU164
+	call	output_test_fill
+.LVL78:
+	.loc 1 90 18 view .LVU165
+	movl	%eax, 28(%rsp)
+.LVL79:
+	.loc 1 92 5 is_stmt 1 view .LVU166
+	.loc 1 92 12 is_stmt 0 view .LVU167
+	movq	32(%r12), %rax
+.LVL80:
+	.loc 1 92 12 view .LVU168
+	leaq	1(%rax), %rbx
+.LVL81:
+	.loc 1 93 41 view .LVU169
+	movq	%rbx, %rdi
+	salq	$4, %rdi
+	.loc 1 92 12 view .LVU170
+	movq	%rbx, 32(%rsp)
+.LVL82:
+	.loc 1 93 5 is_stmt 1 view .LVU171
+	.loc 1 93 41 is_stmt 0 view .LVU172
+	call	malloc@PLT
+.LVL83:
+	.loc 1 94 22 view .LVU173
+	movq	%rax, %rsi
+	movq	%rbx, %rdx
+	movq	%r12, %rdi
+	.loc 1 93 41 view .LVU174
+	movq	%rax, 8(%rsp)
+.LVL84:
+	.loc 1 94 5 is_stmt 1 view .LVU175
+	.loc 1 93 41 is_stmt 0 view .LVU176
+	movq	%rax, %r13
+	.loc 1 94 22 view .LVU177
+	call	st_output_iov@PLT
+.LVL85:
+	.loc 1 94 22 view .LVU178
+	movq	%rax, %rbx
+.LVL86:
+	.loc 1 95 5 is_stmt 1 view .LVU179
+.LBB16:
+	.loc 1 95 10 view .LVU180
+	.loc 1 95 26 view .LVU181
+	testq	%rax, %rax
+	je	.L38
+	.loc 1 95 17 is_stmt 0 view .LVU182
+	xorl	%r14d, %r14d
+.LVL87:
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	.loc 1 96 7 is_stmt 1 discriminator 3 view .LVU183
+	movq	8(%r13), %rdx
+	movq	0(%r13), %rsi
+	movq	%rbp, %rdi
+	.loc 1 95 38 is_stmt 0 discriminator 3 view .LVU184
+	incq	%r14
+.LVL88:
+	.loc 1 96 7 discriminator 3 view .LVU185
+	call	st_append_n@PLT
+.LVL89:
+	.loc 1 95 38 is_stmt 1 discriminator 3 view .LVU186
+	.loc 1 95 26 discriminator 3 view .LVU187
+	addq	$16, %r13
+	cmpq	%r14, %rbx
+	jne	.L39
+.LVL90:
+.L38:
+	.loc 1 95 26 is_stmt 0 discriminator 3 view .LVU188
+.LBE16:
+	.loc 1 99 5 is_stmt 1 view .LVU189
+	.loc 1 99 19 is_stmt 0 view .LVU190
+	movq	%r12, %rdi
+	call	st_output_flush@PLT
+.LVL91:
+	.loc 1 100 5 is_stmt 1 view .LVU191
+	.loc 1 100 8 is_stmt 0 view .LVU192
+	movl	28(%rsp), %edx
+	testl	%edx, %edx
+	je	.L40
+	testl	%eax, %eax
+	jne	.L40
+	.loc 1 100 37 discriminator 1 view .LVU193
+	movq	32(%r12), %rax
+.LVL92:
+	.loc 1 100 37 discriminator 1 view .LVU194
+	cmpq	%rax, 16(%rbp)
+	je	.L56
+.L40:
+	.loc 1 101 7 is_stmt 1 view .LVU195
+	movq	(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL93:
+	.loc 1 102 7 view .LVU196
+	.loc 1 102 19 is_stmt 0 view .LVU197
+	movl	$1, 24(%rsp)
+.LVL94:
+.L42:
+	.loc 1 109 5 is_stmt 1 view .LVU198
+	movq	%r12, %rdi
+	call	st_output_reset@PLT
+.LVL95:
+	.loc 1 110 5 view .LVU199
+	.loc 1 110 8 is_stmt 0 view .LVU200
+	cmpq	$0, 32(%r12)
+	jne	.L45
+	.loc 1 110 32 discriminator 1 view .LVU201
+	movq	32(%rsp), %rdx
+	movq	8(%rsp), %rsi
+	movq	%r12, %rdi
+	call	st_output_iov@PLT
+.LVL96:
+	.loc 1 110 29 discriminator 1 view .LVU202
+	testq	%rax, %rax
+	je	.L57
+.L45:
+	.loc 1 111 7 is_stmt 1 view .LVU203
+	movq	(%rsp), %rsi
+	leaq	.LC11(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL97:
+	.loc 1 112 7 view .LVU204
+	.loc 1 112 19 is_stmt 0 view .LVU205
+	movl	$1, 24(%rsp)
+.LVL98:
+.L44:
+	.loc 1 114 5 is_stmt 1 discriminator 2 view .LVU206
+	movq	8(%rsp), %rdi
+.LBE15:
+	.loc 1 86 21 is_stmt 0 discriminator 2 view .LVU207
+	addq	$8, %r15
+.LVL99:
+.LBB17:
+	.loc 1 114 5 discriminator 2 view .LVU208
+	call	free@PLT
+.LVL100:
+	.loc 1 115 5 is_stmt 1 discriminator 2 view .LVU209
+	movq	16(%rsp), %rdi
+	call	st_destroy@PLT
+.LVL101:
+	.loc 1 116 5 discriminator 2 view .LVU210
+	movq	%rbp, %rdi
+	call	st_destroy@PLT
+.LVL102:
+	.loc 1 117 5 discriminator 2 view .LVU211
+	movq	%r12, %rdi
+	call	st_output_destroy@PLT
+.LVL103:
+.LBE17:
+	.loc 1 86 35 discriminator 2 view .LVU212
+	.loc 1 86 21 discriminator 2 view .LVU213
+	movq	40(%rsp), %rax
+	cmpq	%rax, %r15
+	jne	.L46
+.LBE19:
+	.loc 1 119 3 view .LVU214
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL104:
+	.loc 1 121 3 view .LVU215
+	.loc 1 122 1 is_stmt 0 view .LVU216
+	movl	24(%rsp), %eax
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL105:
+	.loc 1 122 1 view .LVU217
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL106:
+	.loc 1 122 1 view .LVU218
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL107:
+	.loc 1 122 1 view .LVU219
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL108:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.cfi_restore_state
+.LBB20:
+.LBB18:
+	.loc 1 100 78 discriminator 2 view .LVU220
+	movq	16(%rsp), %rax
+	movq	0(%rbp), %rdi
+	movq	(%rax), %rsi
+	call	strcmp@PLT
+.LVL109:
+	.loc 1 100 75 discriminator 2 view .LVU221
+	testl	%eax, %eax
+	jne	.L40
+	.loc 1 106 7 is_stmt 1 view .LVU222
+	movq	(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	.LC10(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL110:
+	jmp	.L42
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	.loc 1 110 74 is_stmt 0 discriminator 2 view .LVU223
+	movq	%r12, %rdi
+	call	st_output_flush@PLT
+.LVL111:
+	.loc 1 110 71 discriminator 2 view .LVU224
+	testl	%eax, %eax
+	je	.L45
+	jmp	.L44
+.LBE18:
+.LBE20:
+	.cfi_endproc
+.LFE28:
+	.size	run_st_output_iov_unit_tests, .-run_st_output_iov_unit_tests
+	.p2align 4
+	.globl	run_string_output_tests
+	.type	run_string_output_tests, @function
+run_string_output_tests:
+.LFB29:
+	.loc 1 127 31 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 129 3 view .LVU226
+	.loc 1 127 31 is_stmt 0 view .LVU227
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 129 7 view .LVU228
+	xorl	%eax, %eax
+	call	run_st_output_flush_unit_tests@PLT
+.LVL112:
+	.loc 1 129 6 view .LVU229
+	cmpl	$1, %eax
+	je	.L58
+	.loc 1 133 3 is_stmt 1 view .LVU230
+	.loc 1 133 7 is_stmt 0 view .LVU231
+	xorl	%eax, %eax
+	call	run_st_output_iov_unit_tests@PLT
+.LVL113:
+	.loc 1 133 6 view .LVU232
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+.L58:
+	.loc 1 138 1 view .LVU233
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	run_string_output_tests, .-run_string_output_tests
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	0
+	.long	1069547520
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC3:
+	.quad	16
+	.quad	64
+	.quad	0
+	.quad	4096
+	.align 32
+.LC4:
+	.quad	0
+	.quad	100
+	.quad	1
+	.quad	65536
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 6 "/usr/include/stdio.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 9 "/root/repo/tests/../include/strutils.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.file 11 "/usr/include/string.h"
+	.file 12 "/usr/include/stdlib.h"
+	.file 13 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x129a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF159
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xa
+	.long	.LASF8
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xc
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x23
+	.byte	0x8
+	.uleb128 0x1b
+	.long	0x4d
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xc
+	.long	0x70
+	.uleb128 0xa
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x88
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xa
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xa
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x98
+	.byte	0x12
+	.long	0x88
+	.uleb128 0xa
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x99
+	.byte	0x12
+	.long	0x88
+	.uleb128 0xa
+	.long	.LASF14
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x88
+	.uleb128 0x6
+	.long	0xc4
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0xc
+	.long	0xc4
+	.uleb128 0x1c
+	.long	.LASF54
+	.byte	0xd8
+	.byte	0x4
+	.byte	0x31
+	.long	0x256
+	.uleb128 0x5
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x33
+	.byte	0x7
+	.long	0x70
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x36
+	.byte	0x9
+	.long	0xbf
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x37
+	.byte	0x9
+	.long	0xbf
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x38
+	.byte	0x9
+	.long	0xbf
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF20
+	.byte	0x4
+	.byte	0x39
+	.byte	0x9
+	.long	0xbf
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF21
+	.byte	0x4
+	.byte	0x3a
+	.byte	0x9
+	.long	0xbf
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x9
+	.long	0xbf
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x3c
+	.byte	0x9
+	.long	0xbf
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF24
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x9
+	.long	0xbf
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF25
+	.byte	0x4
+	.byte	0x40
+	.byte	0x9
+	.long	0xbf
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF26
+	.byte	0x4
+	.byte	0x41
+	.byte	0x9
+	.long	0xbf
+	.byte	0x50
+	.uleb128 0x5
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x42
+	.byte	0x9
+	.long	0xbf
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF28
+	.byte	0x4
+	.byte	0x44
+	.byte	0x16
+	.long	0x26f
+	.byte	0x60
+	.uleb128 0x5
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x46
+	.byte	0x14
+	.long	0x274
+	.byte	0x68
+	.uleb128 0x5
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x48
+	.byte	0x7
+	.long	0x70
+	.byte	0x70
+	.uleb128 0x5
+	.long	.LASF31
+	.byte	0x4
+	.byte	0x49
+	.byte	0x7
+	.long	0x70
+	.byte	0x74
+	.uleb128 0x5
+	.long	.LASF32
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xb
+	.long	0x9b
+	.byte	0x78
+	.uleb128 0x5
+	.long	.LASF33
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x12
+	.long	0x5b
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF34
+	.byte	0x4
+	.byte	0x4e
+	.byte	0xf
+	.long	0x62
+	.byte	0x82
+	.uleb128 0x5
+	.long	.LASF35
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x8
+	.long	0x279
+	.byte	0x83
+	.uleb128 0x5
+	.long	.LASF36
+	.byte	0x4
+	.byte	0x51
+	.byte	0xf
+	.long	0x289
+	.byte	0x88
+	.uleb128 0x5
+	.long	.LASF37
+	.byte	0x4
+	.byte	0x59
+	.byte	0xd
+	.long	0xa7
+	.byte	0x90
+	.uleb128 0x5
+	.long	.LASF38
+	.byte	0x4
+	.byte	0x5b
+	.byte	0x17
+	.long	0x293
+	.byte	0x98
+	.uleb128 0x5
+	.long	.LASF39
+	.byte	0x4
+	.byte	0x5c
+	.byte	0x19
+	.long	0x29d
+	.byte	0xa0
+	.uleb128 0x5
+	.long	.LASF40
+	.byte	0x4
+	.byte	0x5d
+	.byte	0x14
+	.long	0x274
+	.byte	0xa8
+	.uleb128 0x5
+	.long	.LASF41
+	.byte	0x4
+	.byte	0x5e
+	.byte	0x9
+	.long	0x4d
+	.byte	0xb0
+	.uleb128 0x5
+	.long	.LASF42
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x5
+	.long	.LASF43
+	.byte	0x4
+	.byte	0x60
+	.byte	0x7
+	.long	0x70
+	.byte	0xc0
+	.uleb128 0x5
+	.long	.LASF44
+	.byte	0x4
+	.byte	0x62
+	.byte	0x8
+	.long	0x2a2
+	.byte	0xc4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF45
+	.byte	0x5
+	.byte	0x7
+	.byte	0x19
+	.long	0xd0
+	.uleb128 0x25
+	.long	.LASF160
+	.byte	0x4
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0xf
+	.long	.LASF46
+	.uleb128 0x6
+	.long	0x26a
+	.uleb128 0x6
+	.long	0xd0
+	.uleb128 0x10
+	.long	0xc4
+	.long	0x289
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x262
+	.uleb128 0xf
+	.long	.LASF47
+	.uleb128 0x6
+	.long	0x28e
+	.uleb128 0xf
+	.long	.LASF48
+	.uleb128 0x6
+	.long	0x298
+	.uleb128 0x10
+	.long	0xc4
+	.long	0x2b2
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x13
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF49
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x13
+	.long	0xb3
+	.uleb128 0x6
+	.long	0x256
+	.uleb128 0x1b
+	.long	0x2be
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF50
+	.uleb128 0xa
+	.long	.LASF51
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0xc
+	.long	0x2cf
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF52
+	.uleb128 0x6
+	.long	0x2ec
+	.uleb128 0x26
+	.uleb128 0x6
+	.long	0xcb
+	.uleb128 0xa
+	.long	.LASF53
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x12
+	.long	.LASF55
+	.byte	0x18
+	.value	0x175
+	.long	0x332
+	.uleb128 0x4
+	.long	.LASF56
+	.value	0x17a
+	.byte	0x1c
+	.long	0x337
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF57
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF58
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF59
+	.uleb128 0x6
+	.long	0x332
+	.uleb128 0x9
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF60
+	.uleb128 0x12
+	.long	.LASF61
+	.byte	0x40
+	.value	0x1e6
+	.long	0x3b8
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x1eb
+	.byte	0xc
+	.long	0x2f2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x1f0
+	.byte	0xc
+	.long	0x2f2
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF64
+	.value	0x1f5
+	.byte	0xc
+	.long	0x2f2
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x1fa
+	.byte	0xc
+	.long	0x2f2
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF66
+	.value	0x1ff
+	.byte	0xc
+	.long	0x2f2
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF67
+	.value	0x204
+	.byte	0xc
+	.long	0x2f2
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF68
+	.value	0x209
+	.byte	0xc
+	.long	0x2f2
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF69
+	.value	0x20e
+	.byte	0xc
+	.long	0x2f2
+	.byte	0x38
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF70
+	.byte	0x38
+	.value	0x26c
+	.long	0x42a
+	.uleb128 0x4
+	.long	.LASF71
+	.value	0x272
+	.byte	0xd
+	.long	0x443
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF72
+	.value	0x277
+	.byte	0x9
+	.long	0x4d
+	.byte	0x8
+	.uleb128 0x17
+	.string	"fd"
+	.value	0x27c
+	.long	0x70
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF73
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF74
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF75
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x17
+	.string	"eof"
+	.value	0x290
+	.long	0x70
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF76
+	.value	0x295
+	.byte	0x7
+	.long	0x70
+	.byte	0x34
+	.byte	0
+	.uleb128 0x27
+	.long	0x2b2
+	.long	0x443
+	.uleb128 0x2
+	.long	0x4d
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	0x42a
+	.uleb128 0x1d
+	.long	.LASF79
+	.long	0x46
+	.value	0x29b
+	.long	0x464
+	.uleb128 0xd
+	.long	.LASF77
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF78
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF80
+	.long	0x46
+	.value	0x2b5
+	.long	0x48c
+	.uleb128 0xd
+	.long	.LASF81
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF82
+	.byte	0x1
+	.uleb128 0xd
+	.long	.LASF83
+	.byte	0x2
+	.uleb128 0xd
+	.long	.LASF84
+	.byte	0x3
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF85
+	.value	0x158
+	.byte	0x9
+	.value	0x2cf
+	.byte	0x8
+	.long	0x53a
+	.uleb128 0x4
+	.long	.LASF86
+	.value	0x2d4
+	.byte	0x9
+	.long	0xbf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF87
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF88
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF89
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF90
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x448
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF91
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF92
+	.value	0x2f2
+	.byte	0x18
+	.long	0x53a
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF93
+	.value	0x2f7
+	.byte	0x18
+	.long	0x464
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF94
+	.value	0x2fc
+	.byte	0x17
+	.long	0x53f
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF95
+	.value	0x301
+	.byte	0x8
+	.long	0x544
+	.byte	0x48
+	.uleb128 0x1e
+	.long	.LASF96
+	.value	0x306
+	.byte	0x21
+	.long	0x5a2
+	.value	0x148
+	.uleb128 0x1e
+	.long	.LASF97
+	.value	0x30b
+	.byte	0x17
+	.long	0x5a7
+	.value	0x150
+	.byte	0
+	.uleb128 0x6
+	.long	0x3b8
+	.uleb128 0x6
+	.long	0x2fe
+	.uleb128 0x10
+	.long	0xc4
+	.long	0x554
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF98
+	.byte	0x28
+	.value	0x764
+	.long	0x5a2
+	.uleb128 0x4
+	.long	.LASF99
+	.value	0x769
+	.byte	0xb
+	.long	0x5b8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF100
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF101
+	.value	0x774
+	.byte	0xd
+	.long	0x5bd
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF87
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF102
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0x554
+	.uleb128 0x6
+	.long	0x343
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF103
+	.uleb128 0xc
+	.long	0x5ac
+	.uleb128 0x6
+	.long	0x2e
+	.uleb128 0x6
+	.long	0x2f2
+	.uleb128 0x1c
+	.long	.LASF104
+	.byte	0x10
+	.byte	0xa
+	.byte	0x1a
+	.long	0x5e9
+	.uleb128 0x5
+	.long	.LASF105
+	.byte	0xa
+	.byte	0x1c
+	.byte	0xb
+	.long	0x4d
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF106
+	.byte	0xa
+	.byte	0x1d
+	.byte	0xc
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0x48c
+	.uleb128 0x6
+	.long	0x5c2
+	.uleb128 0x12
+	.long	.LASF107
+	.byte	0x48
+	.value	0x877
+	.long	0x673
+	.uleb128 0x4
+	.long	.LASF56
+	.value	0x87c
+	.byte	0x1d
+	.long	0x67d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF108
+	.value	0x881
+	.byte	0x1d
+	.long	0x67d
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF109
+	.value	0x886
+	.byte	0x1d
+	.long	0x67d
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF57
+	.value	0x88b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF87
+	.value	0x890
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF110
+	.value	0x895
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x17
+	.string	"fd"
+	.value	0x89a
+	.long	0x70
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF111
+	.value	0x89f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF76
+	.value	0x8a4
+	.byte	0x7
+	.long	0x70
+	.byte	0x40
+	.byte	0
+	.uleb128 0xc
+	.long	0x5f3
+	.uleb128 0xf
+	.long	.LASF112
+	.uleb128 0x6
+	.long	0x678
+	.uleb128 0x13
+	.long	.LASF126
+	.byte	0x9
+	.value	0x939
+	.byte	0x6
+	.long	0x695
+	.uleb128 0x2
+	.long	0x695
+	.byte	0
+	.uleb128 0x6
+	.long	0x5f3
+	.uleb128 0x18
+	.long	.LASF113
+	.byte	0xb
+	.byte	0x9c
+	.long	0x70
+	.long	0x6b4
+	.uleb128 0x2
+	.long	0x2ed
+	.uleb128 0x2
+	.long	0x2ed
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF114
+	.byte	0x9
+	.value	0x922
+	.byte	0x8
+	.long	0x2e
+	.long	0x6d5
+	.uleb128 0x2
+	.long	0x6d5
+	.uleb128 0x2
+	.long	0x5ee
+	.uleb128 0x2
+	.long	0x3a
+	.byte	0
+	.uleb128 0x6
+	.long	0x673
+	.uleb128 0x7
+	.long	.LASF115
+	.byte	0x9
+	.value	0x535
+	.byte	0x5
+	.long	0x70
+	.long	0x6f6
+	.uleb128 0x2
+	.long	0x5e9
+	.uleb128 0x2
+	.long	0xcb
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF116
+	.byte	0x9
+	.value	0x593
+	.byte	0x5
+	.long	0x70
+	.long	0x712
+	.uleb128 0x2
+	.long	0x5e9
+	.uleb128 0x2
+	.long	0x712
+	.byte	0
+	.uleb128 0x6
+	.long	0x5b3
+	.uleb128 0x7
+	.long	.LASF117
+	.byte	0x9
+	.value	0x528
+	.byte	0x5
+	.long	0x70
+	.long	0x738
+	.uleb128 0x2
+	.long	0x5e9
+	.uleb128 0x2
+	.long	0x2ed
+	.uleb128 0x2
+	.long	0x3a
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF118
+	.byte	0x9
+	.value	0x583
+	.byte	0x5
+	.long	0x70
+	.long	0x754
+	.uleb128 0x2
+	.long	0x5e9
+	.uleb128 0x2
+	.long	0x2db
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF119
+	.byte	0x9
+	.value	0x519
+	.byte	0x5
+	.long	0x70
+	.long	0x770
+	.uleb128 0x2
+	.long	0x5e9
+	.uleb128 0x2
+	.long	0x2ed
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF120
+	.byte	0x9
+	.value	0x8f9
+	.byte	0x5
+	.long	0x70
+	.long	0x78c
+	.uleb128 0x2
+	.long	0x695
+	.uleb128 0x2
+	.long	0xcb
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF121
+	.byte	0x9
+	.value	0x913
+	.byte	0x5
+	.long	0x70
+	.long	0x7a8
+	.uleb128 0x2
+	.long	0x695
+	.uleb128 0x2
+	.long	0x5b3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF122
+	.byte	0x9
+	.value	0x8df
+	.byte	0x5
+	.long	0x70
+	.long	0x7c9
+	.uleb128 0x2
+	.long	0x695
+	.uleb128 0x2
+	.long	0x2ed
+	.uleb128 0x2
+	.long	0x3a
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF123
+	.byte	0x9
+	.value	0x906
+	.byte	0x5
+	.long	0x70
+	.long	0x7e5
+	.uleb128 0x2
+	.long	0x695
+	.uleb128 0x2
+	.long	0x2db
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF124
+	.byte	0x9
+	.value	0x8ec
+	.byte	0x5
+	.long	0x70
+	.long	0x801
+	.uleb128 0x2
+	.long	0x695
+	.uleb128 0x2
+	.long	0x2ed
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF125
+	.byte	0x6
+	.byte	0xb2
+	.long	0x70
+	.long	0x816
+	.uleb128 0x2
+	.long	0x2be
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF127
+	.byte	0x9
+	.value	0x941
+	.byte	0x6
+	.long	0x829
+	.uleb128 0x2
+	.long	0x695
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF128
+	.byte	0x9
+	.value	0x403
+	.byte	0x6
+	.long	0x83c
+	.uleb128 0x2
+	.long	0x5e9
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF129
+	.byte	0xc
+	.value	0x238
+	.byte	0xd
+	.long	0x84f
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF130
+	.byte	0x6
+	.value	0x164
+	.byte	0xc
+	.long	0x70
+	.long	0x867
+	.uleb128 0x2
+	.long	0x2ed
+	.uleb128 0x29
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF131
+	.byte	0xb
+	.byte	0x40
+	.long	0x70
+	.long	0x886
+	.uleb128 0x2
+	.long	0x2e7
+	.uleb128 0x2
+	.long	0x2e7
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF132
+	.byte	0x6
+	.value	0x2a3
+	.byte	0xf
+	.long	0x2e
+	.long	0x8ac
+	.uleb128 0x2
+	.long	0x4f
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2c3
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF133
+	.byte	0x6
+	.value	0x2d3
+	.byte	0xd
+	.long	0x8bf
+	.uleb128 0x2
+	.long	0x2be
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF134
+	.byte	0xc
+	.value	0x229
+	.byte	0xe
+	.long	0x4d
+	.long	0x8d6
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF135
+	.byte	0x9
+	.value	0x931
+	.byte	0x5
+	.long	0x70
+	.long	0x8ed
+	.uleb128 0x2
+	.long	0x695
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF136
+	.byte	0x9
+	.value	0x353
+	.byte	0x19
+	.long	0x5e9
+	.long	0x904
+	.uleb128 0x2
+	.long	0x3a
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF137
+	.byte	0x9
+	.value	0x8b4
+	.byte	0x16
+	.long	0x695
+	.long	0x925
+	.uleb128 0x2
+	.long	0x77
+	.uleb128 0x2
+	.long	0x3a
+	.uleb128 0x2
+	.long	0x3a
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF138
+	.byte	0x6
+	.value	0x329
+	.byte	0xc
+	.long	0x70
+	.long	0x93c
+	.uleb128 0x2
+	.long	0x2be
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF161
+	.byte	0x6
+	.byte	0xbc
+	.byte	0xe
+	.long	0x2be
+	.uleb128 0x19
+	.long	.LASF139
+	.byte	0x7f
+	.long	0x70
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x983
+	.uleb128 0xb
+	.quad	.LVL112
+	.long	0xd14
+	.uleb128 0xb
+	.quad	.LVL113
+	.long	0x983
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF140
+	.byte	0x4d
+	.long	0x70
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd04
+	.uleb128 0x15
+	.long	.LASF141
+	.byte	0x4f
+	.byte	0xa
+	.long	0xd04
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1f
+	.long	.LASF142
+	.byte	0x51
+	.long	0x70
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF143
+	.byte	0x55
+	.byte	0x7
+	.long	0x70
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x20
+	.long	.LLRL16
+	.long	0xcd1
+	.uleb128 0x14
+	.string	"i"
+	.byte	0x56
+	.byte	0xc
+	.long	0x70
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x16
+	.long	.LLRL18
+	.uleb128 0x8
+	.long	.LASF144
+	.byte	0x57
+	.byte	0x1a
+	.long	0x695
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x8
+	.long	.LASF145
+	.byte	0x58
+	.byte	0x1d
+	.long	0x5e9
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x8
+	.long	.LASF146
+	.byte	0x59
+	.byte	0x1d
+	.long	0x5e9
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x8
+	.long	.LASF147
+	.byte	0x5a
+	.byte	0x9
+	.long	0x70
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x8
+	.long	.LASF100
+	.byte	0x5c
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x14
+	.string	"iov"
+	.byte	0x5d
+	.byte	0x13
+	.long	0x5ee
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x8
+	.long	.LASF148
+	.byte	0x5e
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x8
+	.long	.LASF149
+	.byte	0x63
+	.byte	0x9
+	.long	0x70
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x2b
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.long	0xac2
+	.uleb128 0x14
+	.string	"j"
+	.byte	0x5f
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xe
+	.quad	.LVL89
+	.long	0x717
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL72
+	.long	0x904
+	.long	0xae7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL74
+	.long	0x8ed
+	.long	0xafe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL76
+	.long	0x8ed
+	.long	0xb15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL78
+	.long	0x10e4
+	.long	0xb33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL83
+	.long	0x8bf
+	.long	0xb4d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL85
+	.long	0x6b4
+	.long	0xb71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL91
+	.long	0x8d6
+	.long	0xb89
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL93
+	.long	0x84f
+	.long	0xbb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL95
+	.long	0x682
+	.long	0xbce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL96
+	.long	0x6b4
+	.long	0xbf6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -136
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL97
+	.long	0x84f
+	.long	0xc1d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL100
+	.long	0x83c
+	.long	0xc37
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -136
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL101
+	.long	0x829
+	.long	0xc51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL102
+	.long	0x829
+	.long	0xc69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL103
+	.long	0x816
+	.long	0xc81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL109
+	.long	0x69a
+	.uleb128 0x3
+	.quad	.LVL110
+	.long	0x84f
+	.long	0xcbb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL111
+	.long	0x8d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL70
+	.long	0x1282
+	.long	0xcf0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL104
+	.long	0x128b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x2e
+	.long	0xd14
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF150
+	.byte	0x20
+	.long	0x70
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x10d4
+	.uleb128 0x15
+	.long	.LASF141
+	.byte	0x22
+	.byte	0xa
+	.long	0x10d4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x15
+	.long	.LASF151
+	.byte	0x23
+	.byte	0xa
+	.long	0x10d4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0x1f
+	.long	.LASF142
+	.byte	0x25
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF143
+	.byte	0x29
+	.byte	0x7
+	.long	0x70
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x20
+	.long	.LLRL6
+	.long	0x1096
+	.uleb128 0x14
+	.string	"i"
+	.byte	0x2a
+	.byte	0xc
+	.long	0x70
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x16
+	.long	.LLRL8
+	.uleb128 0x8
+	.long	.LASF152
+	.byte	0x2b
+	.byte	0xb
+	.long	0x2be
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x8
+	.long	.LASF144
+	.byte	0x2c
+	.byte	0x1a
+	.long	0x695
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x8
+	.long	.LASF145
+	.byte	0x2d
+	.byte	0x1d
+	.long	0x5e9
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x8
+	.long	.LASF149
+	.byte	0x2e
+	.byte	0x9
+	.long	0x70
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x8
+	.long	.LASF86
+	.byte	0x30
+	.byte	0xb
+	.long	0xbf
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x8
+	.long	.LASF87
+	.byte	0x31
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xb
+	.quad	.LVL22
+	.long	0x93c
+	.uleb128 0x3
+	.quad	.LVL25
+	.long	0x925
+	.long	0xe26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL26
+	.long	0x904
+	.long	0xe44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL28
+	.long	0x8ed
+	.long	0xe5b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL30
+	.long	0x10e4
+	.long	0xe79
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL32
+	.long	0x8bf
+	.uleb128 0x3
+	.quad	.LVL34
+	.long	0x84f
+	.long	0xeb2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL35
+	.long	0x83c
+	.long	0xecb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL36
+	.long	0x829
+	.long	0xee3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL37
+	.long	0x816
+	.long	0xefb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL39
+	.long	0x801
+	.long	0xf13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL46
+	.long	0x8d6
+	.long	0xf2b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL48
+	.long	0x8bf
+	.uleb128 0x3
+	.quad	.LVL50
+	.long	0x8ac
+	.long	0xf50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL51
+	.long	0x886
+	.long	0xf74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 16
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL54
+	.long	0x1294
+	.long	0xf94
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 16
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL55
+	.long	0x84f
+	.long	0xfc7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL56
+	.long	0x83c
+	.long	0xfe0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 16
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL57
+	.long	0x829
+	.long	0xff8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL58
+	.long	0x816
+	.long	0x1010
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL60
+	.long	0x8bf
+	.uleb128 0x3
+	.quad	.LVL63
+	.long	0x8ed
+	.long	0x1034
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL66
+	.long	0x84f
+	.long	0x1069
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x7
+	.byte	0x77
+	.sleb128 32
+	.byte	0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL67
+	.long	0x829
+	.long	0x1081
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL68
+	.long	0x816
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.quad	.LVL19
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL20
+	.long	0x1282
+	.long	0x10c0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL41
+	.long	0x128b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x2e
+	.long	0x10e4
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF162
+	.byte	0x1
+	.byte	0xc
+	.byte	0xc
+	.long	0x70
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1282
+	.uleb128 0x21
+	.long	.LASF144
+	.byte	0x32
+	.long	0x695
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x21
+	.long	.LASF145
+	.byte	0x52
+	.long	0x5e9
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x16
+	.long	.LLRL2
+	.uleb128 0x14
+	.string	"i"
+	.byte	0xd
+	.byte	0xc
+	.long	0x70
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x16
+	.long	.LLRL4
+	.uleb128 0x15
+	.long	.LASF153
+	.byte	0xe
+	.byte	0xc
+	.long	0x5ac
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.quad	.LVL2
+	.long	0x7c9
+	.long	0x1171
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL3
+	.long	0x7a8
+	.long	0x1194
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x39
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL4
+	.long	0x78c
+	.long	0x11ac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL5
+	.long	0x770
+	.long	0x11ca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7d
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL6
+	.long	0x754
+	.long	0x11e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL7
+	.long	0x738
+	.long	0x1206
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL8
+	.long	0x717
+	.long	0x1229
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x39
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL9
+	.long	0x6f6
+	.long	0x1247
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL11
+	.long	0x6da
+	.long	0x1265
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7d
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL13
+	.long	0x7e5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF154
+	.long	.LASF156
+	.uleb128 0x1a
+	.long	.LASF155
+	.long	.LASF157
+	.uleb128 0x1a
+	.long	.LASF131
+	.long	.LASF158
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS15:
+	.uleb128 .LVU146
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU148
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU213
+	.uleb128 .LVU220
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0xa
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x60
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0xa
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x58
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0xa
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x60
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU154
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU219
+	.uleb128 .LVU220
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL74-1-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU218
+	.uleb128 .LVU220
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL78-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU166
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -116
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU171
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU175
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU179
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU217
+	.uleb128 .LVU220
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU191
+	.uleb128 .LVU194
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU181
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU188
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU50
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 44
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 44
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 44
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x8
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x54
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 44
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU52
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU90
+	.uleb128 .LVU92
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU57
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU82
+	.uleb128 .LVU92
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU125
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL63-1-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU63
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU82
+	.uleb128 .LVU92
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL28-1-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU66
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU82
+	.uleb128 .LVU92
+	.uleb128 .LVU122
+	.uleb128 .LVU125
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU70
+	.uleb128 .LVU74
+	.uleb128 .LVU96
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU122
+	.uleb128 .LVU126
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU72
+	.uleb128 .LVU74
+	.uleb128 .LVU100
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU118
+	.uleb128 .LVU120
+	.uleb128 .LVU122
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU73
+	.uleb128 .LVU74
+	.uleb128 .LVU101
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU118
+	.uleb128 .LVU121
+	.uleb128 .LVU122
+	.uleb128 .LVU128
+	.uleb128 .LVU129
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU3
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU21
+	.uleb128 .LVU24
+	.uleb128 .LVU34
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF69:
+	.string	"conversion_ns"
+.LASF118:
+	.string	"st_append_int"
+.LASF35:
+	.string	"_shortbuf"
+.LASF160:
+	.string	"_IO_lock_t"
+.LASF144:
+	.string	"output"
+.LASF74:
+	.string	"capacity"
+.LASF24:
+	.string	"_IO_buf_end"
+.LASF55:
+	.string	"StringArena"
+.LASF110:
+	.string	"flush_threshold"
+.LASF140:
+	.string	"run_st_output_iov_unit_tests"
+.LASF22:
+	.string	"_IO_write_end"
+.LASF3:
+	.string	"unsigned int"
+.LASF89:
+	.string	"incremental_factor"
+.LASF40:
+	.string	"_freeres_list"
+.LASF114:
+	.string	"st_output_iov"
+.LASF16:
+	.string	"_flags"
+.LASF56:
+	.string	"head"
+.LASF78:
+	.string	"ST_GROWTH_LINEAR"
+.LASF85:
+	.string	"StringTokenizer"
+.LASF142:
+	.string	"num_tests"
+.LASF32:
+	.string	"_old_offset"
+.LASF28:
+	.string	"_markers"
+.LASF82:
+	.string	"ST_STRING_OWNED"
+.LASF76:
+	.string	"error"
+.LASF155:
+	.string	"putchar"
+.LASF123:
+	.string	"st_output_append_int"
+.LASF73:
+	.string	"chunk_size"
+.LASF115:
+	.string	"st_append_char"
+.LASF27:
+	.string	"_IO_save_end"
+.LASF150:
+	.string	"run_st_output_flush_unit_tests"
+.LASF47:
+	.string	"_IO_codecvt"
+.LASF134:
+	.string	"malloc"
+.LASF100:
+	.string	"count"
+.LASF52:
+	.string	"long long unsigned int"
+.LASF152:
+	.string	"file"
+.LASF26:
+	.string	"_IO_backup_base"
+.LASF122:
+	.string	"st_output_append_n"
+.LASF120:
+	.string	"st_output_append_char"
+.LASF37:
+	.string	"_offset"
+.LASF83:
+	.string	"ST_STRING_MAPPED"
+.LASF94:
+	.string	"arena"
+.LASF153:
+	.string	"value"
+.LASF30:
+	.string	"_fileno"
+.LASF58:
+	.string	"used"
+.LASF149:
+	.string	"flushed"
+.LASF154:
+	.string	"puts"
+.LASF8:
+	.string	"size_t"
+.LASF51:
+	.string	"int64_t"
+.LASF75:
+	.string	"offset"
+.LASF64:
+	.string	"allocations"
+.LASF19:
+	.string	"_IO_read_base"
+.LASF138:
+	.string	"fileno"
+.LASF117:
+	.string	"st_append_n"
+.LASF91:
+	.string	"max_increment"
+.LASF59:
+	.string	"StringArenaBlock"
+.LASF11:
+	.string	"__uint64_t"
+.LASF147:
+	.string	"filled"
+.LASF86:
+	.string	"string"
+.LASF143:
+	.string	"exit_status"
+.LASF15:
+	.string	"char"
+.LASF43:
+	.string	"_mode"
+.LASF46:
+	.string	"_IO_marker"
+.LASF109:
+	.string	"spare"
+.LASF17:
+	.string	"_IO_read_ptr"
+.LASF124:
+	.string	"st_output_append_string"
+.LASF49:
+	.string	"ssize_t"
+.LASF151:
+	.string	"threshold_values"
+.LASF93:
+	.string	"ownership"
+.LASF156:
+	.string	"__builtin_puts"
+.LASF105:
+	.string	"iov_base"
+.LASF77:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF119:
+	.string	"st_append_string"
+.LASF98:
+	.string	"StringStructuralIndex"
+.LASF141:
+	.string	"block_values"
+.LASF20:
+	.string	"_IO_write_base"
+.LASF50:
+	.string	"long long int"
+.LASF130:
+	.string	"printf"
+.LASF162:
+	.string	"output_test_fill"
+.LASF25:
+	.string	"_IO_save_base"
+.LASF72:
+	.string	"context"
+.LASF145:
+	.string	"expected"
+.LASF106:
+	.string	"iov_len"
+.LASF68:
+	.string	"conversions"
+.LASF102:
+	.string	"hint"
+.LASF127:
+	.string	"st_output_destroy"
+.LASF41:
+	.string	"_freeres_buf"
+.LASF146:
+	.string	"actual"
+.LASF137:
+	.string	"st_output_create"
+.LASF126:
+	.string	"st_output_reset"
+.LASF112:
+	.string	"StringOutputBlock"
+.LASF42:
+	.string	"__pad5"
+.LASF157:
+	.string	"__builtin_putchar"
+.LASF65:
+	.string	"reallocations"
+.LASF34:
+	.string	"_vtable_offset"
+.LASF133:
+	.string	"rewind"
+.LASF128:
+	.string	"st_destroy"
+.LASF81:
+	.string	"ST_STRING_BORROWED"
+.LASF9:
+	.string	"__int64_t"
+.LASF60:
+	.string	"long double"
+.LASF61:
+	.string	"StringStats"
+.LASF99:
+	.string	"positions"
+.LASF18:
+	.string	"_IO_read_end"
+.LASF62:
+	.string	"bytes_scanned"
+.LASF7:
+	.string	"short int"
+.LASF10:
+	.string	"long int"
+.LASF87:
+	.string	"length"
+.LASF132:
+	.string	"fread"
+.LASF63:
+	.string	"tokens_extracted"
+.LASF48:
+	.string	"_IO_wide_data"
+.LASF131:
+	.string	"memcmp"
+.LASF53:
+	.string	"uint64_t"
+.LASF79:
+	.string	"StringGrowthPolicy"
+.LASF125:
+	.string	"fclose"
+.LASF57:
+	.string	"block_size"
+.LASF103:
+	.string	"double"
+.LASF14:
+	.string	"__ssize_t"
+.LASF139:
+	.string	"run_string_output_tests"
+.LASF129:
+	.string	"free"
+.LASF80:
+	.string	"StringOwnership"
+.LASF71:
+	.string	"read"
+.LASF136:
+	.string	"st_create_empty"
+.LASF39:
+	.string	"_wide_data"
+.LASF36:
+	.string	"_lock"
+.LASF2:
+	.string	"long unsigned int"
+.LASF159:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF54:
+	.string	"_IO_FILE"
+.LASF96:
+	.string	"structural_index"
+.LASF84:
+	.string	"ST_STRING_INLINE"
+.LASF4:
+	.string	"unsigned char"
+.LASF95:
+	.string	"inline_buffer"
+.LASF161:
+	.string	"tmpfile"
+.LASF21:
+	.string	"_IO_write_ptr"
+.LASF70:
+	.string	"StringStream"
+.LASF108:
+	.string	"tail"
+.LASF66:
+	.string	"expansions"
+.LASF38:
+	.string	"_codecvt"
+.LASF97:
+	.string	"stats"
+.LASF107:
+	.string	"StringOutput"
+.LASF12:
+	.string	"__off_t"
+.LASF113:
+	.string	"strcmp"
+.LASF6:
+	.string	"signed char"
+.LASF135:
+	.string	"st_output_flush"
+.LASF5:
+	.string	"short unsigned int"
+.LASF104:
+	.string	"iovec"
+.LASF148:
+	.string	"entries"
+.LASF158:
+	.string	"__builtin_memcmp"
+.LASF90:
+	.string	"growth_policy"
+.LASF111:
+	.string	"written"
+.LASF121:
+	.string	"st_output_append_double"
+.LASF29:
+	.string	"_chain"
+.LASF101:
+	.string	"in_string"
+.LASF45:
+	.string	"FILE"
+.LASF31:
+	.string	"_flags2"
+.LASF67:
+	.string	"bytes_copied"
+.LASF116:
+	.string	"st_append_double"
+.LASF33:
+	.string	"_cur_column"
+.LASF88:
+	.string	"position"
+.LASF13:
+	.string	"__off64_t"
+.LASF44:
+	.string	"_unused2"
+.LASF23:
+	.string	"_IO_buf_base"
+.LASF92:
+	.string	"stream"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+.LASF0:
+	.string	"/root/repo/tests/string_output_unit_tests.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
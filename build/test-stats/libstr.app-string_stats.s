@@ -0,0 +1,2159 @@
+	.file	"string_stats.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/src/string_stats.c"
+	.p2align 4
+	.globl	st_stats_available
+	.type	st_stats_available, @function
+st_stats_available:
+.LFB26:
+	.file 1 "/root/repo/src/string_stats.c"
+	.loc 1 24 30 view -0
+	.cfi_startproc
+	.loc 1 26 3 view .LVU1
+	.loc 1 30 1 is_stmt 0 view .LVU2
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	st_stats_available, .-st_stats_available
+	.p2align 4
+	.globl	st_stats_enable
+	.type	st_stats_enable, @function
+st_stats_enable:
+.LVL0:
+.LFB27:
+	.loc 1 35 41 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 36 2 view .LVU4
+.LBB2:
+	.loc 1 36 19 view .LVU5
+	.loc 1 36 5 view .LVU6
+	.loc 1 36 5 view .LVU7
+	.loc 1 36 10 is_stmt 0 view .LVU8
+	xorl	%eax, %eax
+	testl	%edi, %edi
+	setne	%al
+	.loc 1 36 5 view .LVU9
+	movl	%eax, string_stats_enabled(%rip)
+.LBE2:
+	.loc 1 37 1 view .LVU10
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	st_stats_enable, .-st_stats_enable
+	.p2align 4
+	.globl	st_stats_snapshot
+	.type	st_stats_snapshot, @function
+st_stats_snapshot:
+.LVL1:
+.LFB28:
+	.loc 1 42 51 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 43 3 view .LVU12
+	.loc 1 44 3 view .LVU13
+.LBB3:
+	.loc 1 44 8 view .LVU14
+	.loc 1 44 24 view .LVU15
+.LBE3:
+	.loc 1 42 51 is_stmt 0 view .LVU16
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	string_stats_global(%rip), %rax
+	leaq	64(%rax), %rsi
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	leaq	-64(%rsp), %rdx
+.LVL2:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+.LBB5:
+	.loc 1 45 5 is_stmt 1 discriminator 3 view .LVU17
+.LBB4:
+	.loc 1 45 35 discriminator 3 view .LVU18
+	.loc 1 45 21 discriminator 3 view .LVU19
+	.loc 1 45 81 discriminator 3 view .LVU20
+	movq	(%rax), %rcx
+.LVL3:
+	.loc 1 45 22 discriminator 3 view .LVU21
+.LBE4:
+	.loc 1 44 24 is_stmt 0 discriminator 3 view .LVU22
+	addq	$8, %rax
+.LVL4:
+	.loc 1 45 17 discriminator 3 view .LVU23
+	movq	%rcx, (%rdx)
+	.loc 1 44 76 is_stmt 1 discriminator 3 view .LVU24
+	.loc 1 44 24 discriminator 3 view .LVU25
+	addq	$8, %rdx
+	cmpq	%rsi, %rax
+	jne	.L5
+.LBE5:
+	.loc 1 47 3 view .LVU26
+	vmovdqu64	-64(%rsp), %zmm0
+	vmovdqu64	%zmm0, (%rdi)
+	vzeroupper
+.LVL5:
+	.loc 1 48 1 is_stmt 0 view .LVU27
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	st_stats_snapshot, .-st_stats_snapshot
+	.p2align 4
+	.globl	st_stats_reset
+	.type	st_stats_reset, @function
+st_stats_reset:
+.LFB29:
+	.loc 1 53 27 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 54 3 view .LVU29
+.LBB6:
+	.loc 1 54 8 view .LVU30
+.LVL6:
+	.loc 1 54 24 view .LVU31
+	leaq	string_stats_global(%rip), %rax
+	leaq	64(%rax), %rdx
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.loc 1 55 4 discriminator 3 view .LVU32
+.LBB7:
+	.loc 1 55 21 discriminator 3 view .LVU33
+	.loc 1 55 7 discriminator 3 view .LVU34
+	.loc 1 55 7 discriminator 3 view .LVU35
+	movq	$0, (%rax)
+.LBE7:
+	.loc 1 54 76 discriminator 3 view .LVU36
+	.loc 1 54 24 discriminator 3 view .LVU37
+	addq	$8, %rax
+.LVL8:
+	.loc 1 54 24 is_stmt 0 discriminator 3 view .LVU38
+	cmpq	%rdx, %rax
+	jne	.L9
+.LBE6:
+	.loc 1 57 1 view .LVU39
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	st_stats_reset, .-st_stats_reset
+	.p2align 4
+	.globl	st_stats_add
+	.type	st_stats_add, @function
+st_stats_add:
+.LVL9:
+.LFB30:
+	.loc 1 62 102 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 63 3 view .LVU41
+	.loc 1 63 6 is_stmt 0 view .LVU42
+	testq	%rdi, %rdi
+	je	.L12
+	.loc 1 63 36 discriminator 1 view .LVU43
+	movq	336(%rdi), %rax
+	.loc 1 63 24 discriminator 1 view .LVU44
+	testq	%rax, %rax
+	je	.L12
+	.loc 1 65 5 is_stmt 1 view .LVU45
+	.loc 1 65 53 is_stmt 0 view .LVU46
+	addq	%rdx, (%rax,%rsi)
+.L12:
+	.loc 1 67 3 is_stmt 1 view .LVU47
+.LBB8:
+	.loc 1 67 23 view .LVU48
+.LVL10:
+	.loc 1 67 9 view .LVU49
+	.loc 1 67 69 view .LVU50
+	movl	string_stats_enabled(%rip), %eax
+.LVL11:
+	.loc 1 67 10 view .LVU51
+.LBE8:
+	.loc 1 67 6 is_stmt 0 view .LVU52
+	testl	%eax, %eax
+	jne	.L24
+	.loc 1 70 1 view .LVU53
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	.loc 1 68 4 is_stmt 1 view .LVU54
+	.loc 1 68 31 is_stmt 0 view .LVU55
+	shrq	$3, %rsi
+.LVL12:
+	.loc 1 68 4 view .LVU56
+	leaq	string_stats_global(%rip), %rax
+.LVL13:
+	.loc 1 68 4 view .LVU57
+	lock addq	%rdx, (%rax,%rsi,8)
+	.loc 1 70 1 view .LVU58
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	st_stats_add, .-st_stats_add
+	.p2align 4
+	.globl	st_stats_clock
+	.type	st_stats_clock, @function
+st_stats_clock:
+.LVL14:
+.LFB31:
+	.loc 1 75 66 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 76 3 view .LVU60
+	.loc 1 76 6 is_stmt 0 view .LVU61
+	testq	%rdi, %rdi
+	je	.L26
+	.loc 1 76 25 discriminator 2 view .LVU62
+	cmpq	$0, 336(%rdi)
+	je	.L26
+.L28:
+	.loc 1 79 3 is_stmt 1 view .LVU63
+	.loc 1 80 3 view .LVU64
+	.loc 1 75 66 is_stmt 0 view .LVU65
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 80 3 view .LVU66
+	movq	%rsp, %rsi
+	movl	$1, %edi
+.LVL15:
+	.loc 1 80 3 view .LVU67
+	call	clock_gettime@PLT
+.LVL16:
+	.loc 1 81 3 is_stmt 1 view .LVU68
+	.loc 1 81 31 is_stmt 0 view .LVU69
+	imulq	$1000000000, (%rsp), %rax
+	.loc 1 81 44 view .LVU70
+	addq	8(%rsp), %rax
+	.loc 1 82 1 view .LVU71
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL17:
+	.p2align 4,,10
+	.p2align 3
+.L26:
+.LBB9:
+	.loc 1 76 74 is_stmt 1 discriminator 3 view .LVU72
+	.loc 1 76 60 discriminator 3 view .LVU73
+	.loc 1 76 120 discriminator 3 view .LVU74
+	movl	string_stats_enabled(%rip), %eax
+.LVL18:
+	.loc 1 76 61 discriminator 3 view .LVU75
+.LBE9:
+	.loc 1 76 54 is_stmt 0 discriminator 3 view .LVU76
+	testl	%eax, %eax
+	jne	.L28
+	.loc 1 77 12 view .LVU77
+	xorl	%eax, %eax
+.LVL19:
+	.loc 1 82 1 view .LVU78
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	st_stats_clock, .-st_stats_clock
+	.local	string_stats_global
+	.comm	string_stats_global,64,32
+	.local	string_stats_enabled
+	.comm	string_stats_enabled,4,4
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdatomic.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 9 "/root/repo/src/../include/strutils.h"
+	.file 10 "/usr/include/time.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7ae
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF96
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x19
+	.byte	0x7
+	.byte	0x4
+	.long	0x61
+	.byte	0x2
+	.byte	0x1e
+	.byte	0x3
+	.long	0x61
+	.uleb128 0x5
+	.long	.LASF2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF4
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF5
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF6
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF7
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x2
+	.long	0x61
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF9
+	.uleb128 0x2
+	.long	0x6d
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x2
+	.long	0x79
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF11
+	.uleb128 0x2
+	.long	0x85
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF12
+	.uleb128 0x2
+	.long	0x91
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF13
+	.uleb128 0x2
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF14
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x6
+	.long	.LASF19
+	.byte	0x2
+	.byte	0x2e
+	.byte	0x15
+	.long	0xc8
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	0xc1
+	.uleb128 0xb
+	.long	0xc1
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF15
+	.uleb128 0x2
+	.long	0xd2
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF16
+	.uleb128 0x2
+	.long	0xde
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF17
+	.uleb128 0x2
+	.long	0xea
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0x2
+	.long	0xf6
+	.uleb128 0x1b
+	.byte	0x1
+	.byte	0x2
+	.byte	0xda
+	.byte	0x11
+	.long	0x119
+	.uleb128 0xf
+	.long	.LASF26
+	.byte	0x2
+	.byte	0xdd
+	.byte	0x9
+	.long	0x6d
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x102
+	.uleb128 0x6
+	.long	.LASF20
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0xde
+	.uleb128 0xb
+	.long	0x11e
+	.uleb128 0x6
+	.long	.LASF21
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0xde
+	.uleb128 0x6
+	.long	.LASF22
+	.byte	0x4
+	.byte	0xa0
+	.byte	0x12
+	.long	0xd2
+	.uleb128 0x6
+	.long	.LASF23
+	.byte	0x4
+	.byte	0xa9
+	.byte	0xd
+	.long	0xc1
+	.uleb128 0x1c
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF24
+	.byte	0x4
+	.byte	0xc2
+	.byte	0x12
+	.long	0xd2
+	.uleb128 0x6
+	.long	.LASF25
+	.byte	0x4
+	.byte	0xc5
+	.byte	0x12
+	.long	0xd2
+	.uleb128 0x4
+	.long	0x79
+	.uleb128 0x1d
+	.long	.LASF32
+	.byte	0x10
+	.byte	0x5
+	.byte	0xb
+	.byte	0x8
+	.long	0x19a
+	.uleb128 0xf
+	.long	.LASF27
+	.byte	0x5
+	.byte	0x10
+	.byte	0xc
+	.long	0x13b
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF28
+	.byte	0x5
+	.byte	0x15
+	.byte	0x15
+	.long	0x161
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x7
+	.byte	0x15
+	.long	0x147
+	.uleb128 0x6
+	.long	.LASF30
+	.byte	0x7
+	.byte	0x6c
+	.byte	0x13
+	.long	0x155
+	.uleb128 0x6
+	.long	.LASF31
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x14
+	.long	0x12f
+	.uleb128 0x2
+	.long	0x1b2
+	.uleb128 0xb
+	.long	0x1b2
+	.uleb128 0xc
+	.long	.LASF33
+	.byte	0x18
+	.value	0x175
+	.long	0x1fc
+	.uleb128 0x1
+	.long	.LASF34
+	.value	0x17a
+	.byte	0x1c
+	.long	0x201
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF35
+	.value	0x17f
+	.byte	0xa
+	.long	0x11e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF36
+	.value	0x184
+	.byte	0xa
+	.long	0x11e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF97
+	.uleb128 0x4
+	.long	0x1fc
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF37
+	.uleb128 0xc
+	.long	.LASF38
+	.byte	0x40
+	.value	0x1e6
+	.long	0x282
+	.uleb128 0x1
+	.long	.LASF39
+	.value	0x1eb
+	.byte	0xc
+	.long	0x1b2
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF40
+	.value	0x1f0
+	.byte	0xc
+	.long	0x1b2
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF41
+	.value	0x1f5
+	.byte	0xc
+	.long	0x1b2
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF42
+	.value	0x1fa
+	.byte	0xc
+	.long	0x1b2
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF43
+	.value	0x1ff
+	.byte	0xc
+	.long	0x1b2
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF44
+	.value	0x204
+	.byte	0xc
+	.long	0x1b2
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF45
+	.value	0x209
+	.byte	0xc
+	.long	0x1b2
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF46
+	.value	0x20e
+	.byte	0xc
+	.long	0x1b2
+	.byte	0x38
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF47
+	.byte	0x38
+	.value	0x26c
+	.long	0x2f4
+	.uleb128 0x1
+	.long	.LASF48
+	.value	0x272
+	.byte	0xd
+	.long	0x30d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF49
+	.value	0x277
+	.byte	0x9
+	.long	0x153
+	.byte	0x8
+	.uleb128 0x12
+	.string	"fd"
+	.value	0x27c
+	.long	0xc1
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF50
+	.value	0x281
+	.byte	0xa
+	.long	0x11e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF51
+	.value	0x286
+	.byte	0xa
+	.long	0x11e
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF52
+	.value	0x28b
+	.byte	0xa
+	.long	0x11e
+	.byte	0x28
+	.uleb128 0x12
+	.string	"eof"
+	.value	0x290
+	.long	0xc1
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF53
+	.value	0x295
+	.byte	0x7
+	.long	0xc1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x1f
+	.long	0x1a6
+	.long	0x30d
+	.uleb128 0x9
+	.long	0x153
+	.uleb128 0x9
+	.long	0x16d
+	.uleb128 0x9
+	.long	0x11e
+	.byte	0
+	.uleb128 0x4
+	.long	0x2f4
+	.uleb128 0x13
+	.long	.LASF56
+	.long	0x61
+	.value	0x29b
+	.long	0x32e
+	.uleb128 0x5
+	.long	.LASF54
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF55
+	.byte	0x1
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF57
+	.long	0x61
+	.value	0x2b5
+	.long	0x356
+	.uleb128 0x5
+	.long	.LASF58
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0x3
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF62
+	.value	0x158
+	.byte	0x9
+	.value	0x2cf
+	.byte	0x8
+	.long	0x404
+	.uleb128 0x1
+	.long	.LASF63
+	.value	0x2d4
+	.byte	0x9
+	.long	0x16d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF64
+	.value	0x2d9
+	.byte	0xa
+	.long	0x11e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF65
+	.value	0x2de
+	.byte	0xa
+	.long	0x11e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF66
+	.value	0x2e3
+	.byte	0xa
+	.long	0x11e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF67
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x312
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF68
+	.value	0x2ed
+	.byte	0xa
+	.long	0x11e
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF69
+	.value	0x2f2
+	.byte	0x18
+	.long	0x409
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF70
+	.value	0x2f7
+	.byte	0x18
+	.long	0x32e
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF71
+	.value	0x2fc
+	.byte	0x17
+	.long	0x40e
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF72
+	.value	0x301
+	.byte	0x8
+	.long	0x413
+	.byte	0x48
+	.uleb128 0x14
+	.long	.LASF73
+	.value	0x306
+	.byte	0x21
+	.long	0x471
+	.value	0x148
+	.uleb128 0x14
+	.long	.LASF74
+	.value	0x30b
+	.byte	0x17
+	.long	0x476
+	.value	0x150
+	.byte	0
+	.uleb128 0xb
+	.long	0x356
+	.uleb128 0x4
+	.long	0x282
+	.uleb128 0x4
+	.long	0x1c8
+	.uleb128 0x10
+	.long	0x79
+	.long	0x423
+	.uleb128 0x11
+	.long	0xde
+	.byte	0xff
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF75
+	.byte	0x28
+	.value	0x764
+	.long	0x471
+	.uleb128 0x1
+	.long	.LASF76
+	.value	0x769
+	.byte	0xb
+	.long	0x482
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF77
+	.value	0x76e
+	.byte	0xa
+	.long	0x11e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF78
+	.value	0x774
+	.byte	0xd
+	.long	0x487
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF64
+	.value	0x779
+	.byte	0xa
+	.long	0x11e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF79
+	.value	0x77e
+	.byte	0xa
+	.long	0x11e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0x423
+	.uleb128 0x4
+	.long	0x20d
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF80
+	.uleb128 0x4
+	.long	0x11e
+	.uleb128 0x4
+	.long	0x1b2
+	.uleb128 0x7
+	.long	.LASF81
+	.byte	0xe
+	.byte	0x13
+	.long	0xb5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	string_stats_enabled
+	.uleb128 0x10
+	.long	0x1be
+	.long	0x4b1
+	.uleb128 0x11
+	.long	0xde
+	.byte	0x7
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF82
+	.byte	0x13
+	.byte	0x19
+	.long	0x4a1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	string_stats_global
+	.uleb128 0x21
+	.long	.LASF98
+	.byte	0xa
+	.value	0x120
+	.byte	0xc
+	.long	0xc1
+	.long	0x4e2
+	.uleb128 0x9
+	.long	0x19a
+	.uleb128 0x9
+	.long	0x4e2
+	.byte	0
+	.uleb128 0x4
+	.long	0x172
+	.uleb128 0x22
+	.long	.LASF99
+	.byte	0x1
+	.byte	0x4b
+	.byte	0xa
+	.long	0x1b2
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x584
+	.uleb128 0x15
+	.long	.LASF84
+	.byte	0x4b
+	.byte	0x37
+	.long	0x584
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x23
+	.string	"now"
+	.byte	0x1
+	.byte	0x4f
+	.byte	0x13
+	.long	0x172
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x24
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.long	0x56a
+	.uleb128 0x7
+	.long	.LASF83
+	.byte	0x4c
+	.byte	0x56
+	.long	0x589
+	.uleb128 0xa
+	.byte	0x3
+	.quad	string_stats_enabled
+	.byte	0x9f
+	.uleb128 0x8
+	.long	.LASF87
+	.byte	0x4c
+	.byte	0x65
+	.long	0xc1
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.uleb128 0x25
+	.quad	.LVL16
+	.long	0x4c6
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x404
+	.uleb128 0x4
+	.long	0xb5
+	.uleb128 0xd
+	.long	.LASF88
+	.byte	0x3e
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x613
+	.uleb128 0xe
+	.long	.LASF84
+	.byte	0x3e
+	.byte	0x31
+	.long	0x584
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x15
+	.long	.LASF85
+	.byte	0x3e
+	.byte	0x49
+	.long	0x12a
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xe
+	.long	.LASF86
+	.byte	0x3e
+	.byte	0x5f
+	.long	0x1c3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xa
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x7
+	.long	.LASF83
+	.byte	0x43
+	.byte	0x23
+	.long	0x589
+	.uleb128 0xa
+	.byte	0x3
+	.quad	string_stats_enabled
+	.byte	0x9f
+	.uleb128 0x8
+	.long	.LASF87
+	.byte	0x43
+	.byte	0x32
+	.long	0xc1
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF89
+	.byte	0x35
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x684
+	.uleb128 0xa
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x36
+	.long	0x11e
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xa
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x8
+	.long	.LASF90
+	.byte	0x37
+	.byte	0x21
+	.long	0x684
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x26
+	.long	.LASF91
+	.byte	0x1
+	.byte	0x37
+	.byte	0x31
+	.long	0x1b2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x1be
+	.uleb128 0xd
+	.long	.LASF92
+	.byte	0x2a
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x71e
+	.uleb128 0xe
+	.long	.LASF74
+	.byte	0x2a
+	.byte	0x2c
+	.long	0x476
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.long	.LASF93
+	.byte	0x2b
+	.byte	0xc
+	.long	0x71e
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -64
+	.uleb128 0x27
+	.long	.LLRL1
+	.long	0x712
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x2c
+	.long	0x11e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xa
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x8
+	.long	.LASF83
+	.byte	0x2d
+	.byte	0x2f
+	.long	0x684
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x8
+	.long	.LASF87
+	.byte	0x2d
+	.byte	0x3e
+	.long	0x1b2
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.quad	.LVL5
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x10
+	.long	0x1b2
+	.long	0x72e
+	.uleb128 0x11
+	.long	0xde
+	.byte	0x7
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF94
+	.byte	0x23
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x793
+	.uleb128 0xe
+	.long	.LASF95
+	.byte	0x23
+	.byte	0x20
+	.long	0xcd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xa
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x7
+	.long	.LASF90
+	.byte	0x24
+	.byte	0x1f
+	.long	0x589
+	.uleb128 0xa
+	.byte	0x3
+	.quad	string_stats_enabled
+	.byte	0x9f
+	.uleb128 0x8
+	.long	.LASF91
+	.byte	0x24
+	.byte	0x2f
+	.long	0xc1
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF100
+	.byte	0x1
+	.byte	0x18
+	.byte	0x5
+	.long	0xc1
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x47
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU75
+	.uleb128 .LVU78
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU51
+	.uleb128 .LVU57
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU31
+	.uleb128 .LVU32
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU34
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU15
+	.uleb128 .LVU17
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU19
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU21
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU7
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0xb
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF28:
+	.string	"tv_nsec"
+.LASF65:
+	.string	"position"
+.LASF6:
+	.string	"memory_order_acq_rel"
+.LASF35:
+	.string	"block_size"
+.LASF61:
+	.string	"ST_STRING_INLINE"
+.LASF54:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF11:
+	.string	"signed char"
+.LASF27:
+	.string	"tv_sec"
+.LASF31:
+	.string	"uint64_t"
+.LASF13:
+	.string	"short int"
+.LASF20:
+	.string	"size_t"
+.LASF76:
+	.string	"positions"
+.LASF74:
+	.string	"stats"
+.LASF98:
+	.string	"clock_gettime"
+.LASF45:
+	.string	"conversions"
+.LASF40:
+	.string	"tokens_extracted"
+.LASF81:
+	.string	"string_stats_enabled"
+.LASF30:
+	.string	"ssize_t"
+.LASF96:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF5:
+	.string	"memory_order_release"
+.LASF4:
+	.string	"memory_order_acquire"
+.LASF34:
+	.string	"head"
+.LASF91:
+	.string	"__atomic_store_tmp"
+.LASF60:
+	.string	"ST_STRING_MAPPED"
+.LASF33:
+	.string	"StringArena"
+.LASF23:
+	.string	"__clockid_t"
+.LASF7:
+	.string	"memory_order_seq_cst"
+.LASF79:
+	.string	"hint"
+.LASF64:
+	.string	"length"
+.LASF29:
+	.string	"clockid_t"
+.LASF48:
+	.string	"read"
+.LASF17:
+	.string	"long long int"
+.LASF99:
+	.string	"st_stats_clock"
+.LASF24:
+	.string	"__ssize_t"
+.LASF15:
+	.string	"long int"
+.LASF63:
+	.string	"string"
+.LASF84:
+	.string	"tokenizer"
+.LASF52:
+	.string	"offset"
+.LASF73:
+	.string	"structural_index"
+.LASF94:
+	.string	"st_stats_enable"
+.LASF82:
+	.string	"string_stats_global"
+.LASF49:
+	.string	"context"
+.LASF68:
+	.string	"max_increment"
+.LASF66:
+	.string	"incremental_factor"
+.LASF19:
+	.string	"atomic_int"
+.LASF58:
+	.string	"ST_STRING_BORROWED"
+.LASF56:
+	.string	"StringGrowthPolicy"
+.LASF42:
+	.string	"reallocations"
+.LASF37:
+	.string	"long double"
+.LASF25:
+	.string	"__syscall_slong_t"
+.LASF12:
+	.string	"unsigned char"
+.LASF55:
+	.string	"ST_GROWTH_LINEAR"
+.LASF51:
+	.string	"capacity"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF8:
+	.string	"unsigned int"
+.LASF70:
+	.string	"ownership"
+.LASF85:
+	.string	"field"
+.LASF87:
+	.string	"__atomic_load_tmp"
+.LASF90:
+	.string	"__atomic_store_ptr"
+.LASF69:
+	.string	"stream"
+.LASF14:
+	.string	"short unsigned int"
+.LASF78:
+	.string	"in_string"
+.LASF10:
+	.string	"char"
+.LASF26:
+	.string	"__val"
+.LASF71:
+	.string	"arena"
+.LASF9:
+	.string	"_Bool"
+.LASF21:
+	.string	"__uint64_t"
+.LASF38:
+	.string	"StringStats"
+.LASF16:
+	.string	"long unsigned int"
+.LASF72:
+	.string	"inline_buffer"
+.LASF80:
+	.string	"double"
+.LASF75:
+	.string	"StringStructuralIndex"
+.LASF2:
+	.string	"memory_order_relaxed"
+.LASF59:
+	.string	"ST_STRING_OWNED"
+.LASF44:
+	.string	"bytes_copied"
+.LASF93:
+	.string	"counters"
+.LASF22:
+	.string	"__time_t"
+.LASF77:
+	.string	"count"
+.LASF88:
+	.string	"st_stats_add"
+.LASF50:
+	.string	"chunk_size"
+.LASF95:
+	.string	"enabled"
+.LASF57:
+	.string	"StringOwnership"
+.LASF46:
+	.string	"conversion_ns"
+.LASF36:
+	.string	"used"
+.LASF100:
+	.string	"st_stats_available"
+.LASF32:
+	.string	"timespec"
+.LASF89:
+	.string	"st_stats_reset"
+.LASF53:
+	.string	"error"
+.LASF83:
+	.string	"__atomic_load_ptr"
+.LASF62:
+	.string	"StringTokenizer"
+.LASF3:
+	.string	"memory_order_consume"
+.LASF39:
+	.string	"bytes_scanned"
+.LASF86:
+	.string	"value"
+.LASF67:
+	.string	"growth_policy"
+.LASF92:
+	.string	"st_stats_snapshot"
+.LASF97:
+	.string	"StringArenaBlock"
+.LASF47:
+	.string	"StringStream"
+.LASF43:
+	.string	"expansions"
+.LASF41:
+	.string	"allocations"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/string_stats.c"
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
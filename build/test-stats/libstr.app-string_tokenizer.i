@@ -0,0 +1,4785 @@
+# 0 "/root/repo/src/string_tokenizer.c"
+# 1 "/root/repo/build/test-stats//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "/root/repo/src/string_tokenizer.c"
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 56 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 30 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+
+
+
+
+
+typedef __off_t off_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+
+
+
+
+typedef __ssize_t ssize_t;
+
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 2 "/root/repo/src/string_tokenizer.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 3 "/root/repo/src/string_tokenizer.c" 2
+# 1 "/usr/include/x86_64-linux-gnu/sys/mman.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/sys/mman.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/sys/mman.h" 2 3 4
+# 41 "/usr/include/x86_64-linux-gnu/sys/mman.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mman.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/mman.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mman-map-flags-generic.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/mman.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/mman-linux.h" 1 3 4
+# 119 "/usr/include/x86_64-linux-gnu/bits/mman-linux.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mman-shared.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/mman-linux.h" 2 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/mman.h" 2 3 4
+# 42 "/usr/include/x86_64-linux-gnu/sys/mman.h" 2 3 4
+
+
+
+
+
+# 57 "/usr/include/x86_64-linux-gnu/sys/mman.h" 3 4
+extern void *mmap (void *__addr, size_t __len, int __prot,
+     int __flags, int __fd, __off_t __offset) __attribute__ ((__nothrow__ , __leaf__));
+# 76 "/usr/include/x86_64-linux-gnu/sys/mman.h" 3 4
+extern int munmap (void *__addr, size_t __len) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int mprotect (void *__addr, size_t __len, int __prot) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int msync (void *__addr, size_t __len, int __flags);
+
+
+
+
+extern int madvise (void *__addr, size_t __len, int __advice) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int posix_madvise (void *__addr, size_t __len, int __advice) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int mlock (const void *__addr, size_t __len) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int munlock (const void *__addr, size_t __len) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int mlockall (int __flags) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int munlockall (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int mincore (void *__start, size_t __len, unsigned char *__vec)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 144 "/usr/include/x86_64-linux-gnu/sys/mman.h" 3 4
+extern int shm_open (const char *__name, int __oflag, mode_t __mode);
+
+
+extern int shm_unlink (const char *__name);
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/mman_ext.h" 1 3 4
+# 151 "/usr/include/x86_64-linux-gnu/sys/mman.h" 2 3 4
+
+
+# 4 "/root/repo/src/string_tokenizer.c" 2
+# 1 "/root/repo/src/../include/strutils.h" 1
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 6 "/root/repo/src/../include/strutils.h" 2
+
+
+
+
+
+
+
+
+# 13 "/root/repo/src/../include/strutils.h"
+struct StringView {
+
+
+
+
+  const char *ptr;
+
+
+
+
+  size_t len;
+};
+# 35 "/root/repo/src/../include/strutils.h"
+struct StringView sv_from_string(const char *string);
+# 48 "/root/repo/src/../include/strutils.h"
+int sv_compare(const struct StringView *a, const struct StringView *b);
+# 61 "/root/repo/src/../include/strutils.h"
+int sv_equals(const struct StringView *view, const char *string);
+# 72 "/root/repo/src/../include/strutils.h"
+uint64_t sv_hash(const struct StringView *view);
+# 84 "/root/repo/src/../include/strutils.h"
+char *sv_to_string(const struct StringView *view);
+# 97 "/root/repo/src/../include/strutils.h"
+int sv_to_double(const struct StringView *view, double *value);
+# 110 "/root/repo/src/../include/strutils.h"
+int sv_to_int64(const struct StringView *view, int64_t *value);
+# 122 "/root/repo/src/../include/strutils.h"
+enum StringCharClassBits {
+
+
+
+
+  ST_CLASS_WHITESPACE = 1 << 0,
+
+
+
+
+  ST_CLASS_DIGIT = 1 << 1,
+
+
+
+
+  ST_CLASS_NUMERIC = 1 << 2,
+
+
+
+
+  ST_CLASS_HEX = 1 << 3,
+
+
+
+
+  ST_CLASS_STRUCTURAL = 1 << 4,
+
+
+
+
+
+  ST_CLASS_ESCAPE = 1 << 5,
+
+
+
+
+  ST_CLASS_ALPHA = 1 << 6,
+};
+
+
+
+
+
+
+extern const uint8_t st_char_classes[256];
+
+
+
+
+struct StringCharClass {
+
+
+
+
+  uint8_t members[256];
+};
+# 189 "/root/repo/src/../include/strutils.h"
+void st_char_class_init(struct StringCharClass *char_class, const unsigned int classes, const char *members);
+# 202 "/root/repo/src/../include/strutils.h"
+static inline int st_char_is(const char token, const unsigned int classes) {
+  return (st_char_classes[(unsigned char)token] & classes) != 0;
+}
+# 217 "/root/repo/src/../include/strutils.h"
+static inline int st_char_class_has(const struct StringCharClass *char_class, const char token) {
+  return char_class->members[(unsigned char)token] != 0;
+}
+# 231 "/root/repo/src/../include/strutils.h"
+enum StringScanIsa {
+  ST_SCAN_SCALAR,
+  ST_SCAN_SSE2,
+  ST_SCAN_AVX2,
+  ST_SCAN_AVX512,
+};
+# 247 "/root/repo/src/../include/strutils.h"
+int st_scan_isa_supported(const enum StringScanIsa isa);
+# 261 "/root/repo/src/../include/strutils.h"
+int st_scan_set_isa(const enum StringScanIsa isa);
+
+
+
+
+
+
+
+enum StringScanIsa st_scan_isa();
+# 284 "/root/repo/src/../include/strutils.h"
+size_t st_scan_delimiter(const char *string, const size_t length, const char delim);
+# 299 "/root/repo/src/../include/strutils.h"
+size_t st_scan_non_whitespace(const char *string, const size_t length);
+# 312 "/root/repo/src/../include/strutils.h"
+size_t st_scan_nul(const char *string, const size_t length);
+# 328 "/root/repo/src/../include/strutils.h"
+size_t st_scan_escape(const char *string, const size_t length);
+# 343 "/root/repo/src/../include/strutils.h"
+size_t st_scan_class(const char *string, const size_t length, const struct StringCharClass *char_class);
+# 365 "/root/repo/src/../include/strutils.h"
+struct StringArenaBlock;
+
+
+
+
+
+
+
+struct StringArena {
+
+
+
+
+  struct StringArenaBlock *head;
+
+
+
+
+  size_t block_size;
+
+
+
+
+  size_t used;
+};
+# 400 "/root/repo/src/../include/strutils.h"
+struct StringArena *st_arena_create(const size_t block_size);
+# 413 "/root/repo/src/../include/strutils.h"
+void *st_arena_alloc(struct StringArena *arena, const size_t size);
+# 426 "/root/repo/src/../include/strutils.h"
+char *st_arena_string(struct StringArena *arena, const struct StringView *view);
+# 436 "/root/repo/src/../include/strutils.h"
+void st_arena_reset(struct StringArena *arena);
+
+
+
+
+
+
+
+void st_arena_destroy(struct StringArena *arena);
+
+
+
+
+
+
+
+struct StringArena *st_arena_acquire(void);
+# 462 "/root/repo/src/../include/strutils.h"
+void st_arena_release(struct StringArena *arena);
+
+
+
+
+
+
+void st_arena_pool_clear(void);
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 477 "/root/repo/src/../include/strutils.h" 2
+# 486 "/root/repo/src/../include/strutils.h"
+
+# 486 "/root/repo/src/../include/strutils.h"
+struct StringStats {
+
+
+
+
+  uint64_t bytes_scanned;
+
+
+
+
+  uint64_t tokens_extracted;
+
+
+
+
+  uint64_t allocations;
+
+
+
+
+  uint64_t reallocations;
+
+
+
+
+  uint64_t expansions;
+
+
+
+
+  uint64_t bytes_copied;
+
+
+
+
+  uint64_t conversions;
+
+
+
+
+  uint64_t conversion_ns;
+};
+
+struct StringTokenizer;
+# 554 "/root/repo/src/../include/strutils.h"
+int st_stats_available(void);
+
+
+
+
+
+
+
+void st_stats_enable(const int enabled);
+
+
+
+
+
+
+
+void st_stats_snapshot(struct StringStats *stats);
+
+
+
+
+void st_stats_reset(void);
+# 589 "/root/repo/src/../include/strutils.h"
+void st_stats_add(const struct StringTokenizer *tokenizer, const size_t field, const uint64_t value);
+# 602 "/root/repo/src/../include/strutils.h"
+uint64_t st_stats_clock(const struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 84 "/usr/include/stdio.h" 3 4
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 434 "/usr/include/stdio.h" 3 4
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 611 "/root/repo/src/../include/strutils.h" 2
+# 620 "/root/repo/src/../include/strutils.h"
+
+# 620 "/root/repo/src/../include/strutils.h"
+struct StringStream {
+
+
+
+
+
+  ssize_t (*read)(void *context, char *buffer, size_t size);
+
+
+
+
+  void *context;
+
+
+
+
+  int fd;
+
+
+
+
+  size_t chunk_size;
+
+
+
+
+  size_t capacity;
+
+
+
+
+  size_t offset;
+
+
+
+
+  int eof;
+
+
+
+
+  int error;
+};
+
+
+
+
+enum StringGrowthPolicy {
+
+
+
+
+  ST_GROWTH_GEOMETRIC,
+
+
+
+
+  ST_GROWTH_LINEAR,
+};
+# 693 "/root/repo/src/../include/strutils.h"
+enum StringOwnership {
+
+
+
+
+  ST_STRING_BORROWED,
+
+
+
+
+  ST_STRING_OWNED,
+
+
+
+
+  ST_STRING_MAPPED,
+
+
+
+
+  ST_STRING_INLINE,
+};
+
+
+
+
+struct StringTokenizer {
+
+
+
+
+  char *string;
+
+
+
+
+  size_t length;
+
+
+
+
+  size_t position;
+
+
+
+
+  size_t incremental_factor;
+
+
+
+
+  enum StringGrowthPolicy growth_policy;
+
+
+
+
+  size_t max_increment;
+
+
+
+
+  struct StringStream *stream;
+
+
+
+
+  enum StringOwnership ownership;
+
+
+
+
+  struct StringArena *arena;
+
+
+
+
+  char inline_buffer[256];
+
+
+
+
+  struct StringStructuralIndex *structural_index;
+
+
+
+
+  struct StringStats *stats;
+};
+# 791 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create(char *string);
+# 806 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_n(char *string, const size_t length);
+# 821 "/root/repo/src/../include/strutils.h"
+void st_init(struct StringTokenizer *tokenizer, char *string, const size_t length);
+# 836 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_mmap(const char *path);
+# 851 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_empty(const size_t string_size);
+# 866 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_fd(const int fd, const size_t chunk_size);
+# 881 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_file(FILE *file, const size_t chunk_size);
+# 900 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_callback(ssize_t (*read)(void *context, char *buffer, size_t size), void *context, const size_t chunk_size);
+# 916 "/root/repo/src/../include/strutils.h"
+int st_ensure(struct StringTokenizer *tokenizer, const size_t size);
+# 930 "/root/repo/src/../include/strutils.h"
+void st_attach_arena(struct StringTokenizer *tokenizer, struct StringArena *arena);
+# 942 "/root/repo/src/../include/strutils.h"
+void st_attach_stats(struct StringTokenizer *tokenizer, struct StringStats *stats);
+# 953 "/root/repo/src/../include/strutils.h"
+void st_reset(struct StringTokenizer *tokenizer);
+# 971 "/root/repo/src/../include/strutils.h"
+int st_rebind(struct StringTokenizer *tokenizer, char *string, const size_t length);
+# 988 "/root/repo/src/../include/strutils.h"
+char *st_detach_string(struct StringTokenizer *tokenizer);
+# 1001 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_pool_acquire(const size_t string_size);
+# 1012 "/root/repo/src/../include/strutils.h"
+void st_pool_release(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+void st_pool_clear(void);
+
+
+
+
+
+
+
+void st_destroy(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+void st_next_token(struct StringTokenizer *tokenizer);
+# 1046 "/root/repo/src/../include/strutils.h"
+char st_current_token(struct StringTokenizer *tokenizer);
+# 1061 "/root/repo/src/../include/strutils.h"
+char *st_sub_string(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim);
+# 1074 "/root/repo/src/../include/strutils.h"
+char *st_slice_string(struct StringTokenizer *tokenizer, const int length);
+# 1085 "/root/repo/src/../include/strutils.h"
+char *st_extract_numbers(struct StringTokenizer *tokenizer);
+# 1105 "/root/repo/src/../include/strutils.h"
+int st_sub_string_view(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim, struct StringView *view);
+# 1123 "/root/repo/src/../include/strutils.h"
+int st_slice_string_view(struct StringTokenizer *tokenizer, const int length, struct StringView *view);
+# 1139 "/root/repo/src/../include/strutils.h"
+int st_extract_numbers_view(struct StringTokenizer *tokenizer, struct StringView *view);
+# 1158 "/root/repo/src/../include/strutils.h"
+int st_extract_until_view(struct StringTokenizer *tokenizer, const struct StringCharClass *delimiters, struct StringView *view);
+# 1172 "/root/repo/src/../include/strutils.h"
+double *st_extract_double(struct StringTokenizer *tokenizer);
+# 1188 "/root/repo/src/../include/strutils.h"
+int st_extract_double_to(struct StringTokenizer *tokenizer, double *value);
+# 1207 "/root/repo/src/../include/strutils.h"
+int st_extract_int64(struct StringTokenizer *tokenizer, int64_t *value);
+# 1222 "/root/repo/src/../include/strutils.h"
+int *st_extract_boolean(struct StringTokenizer *tokenizer, const char *bool_value, const int int_value);
+# 1235 "/root/repo/src/../include/strutils.h"
+int st_starts_with(struct StringTokenizer *tokenizer, const char *needle);
+# 1251 "/root/repo/src/../include/strutils.h"
+int st_expand_string(struct StringTokenizer *tokenizer, const size_t size);
+# 1264 "/root/repo/src/../include/strutils.h"
+void st_set_growth_policy(struct StringTokenizer *tokenizer, const enum StringGrowthPolicy policy, const size_t max_increment);
+# 1278 "/root/repo/src/../include/strutils.h"
+int st_reserve(struct StringTokenizer *tokenizer, const size_t length);
+# 1292 "/root/repo/src/../include/strutils.h"
+int st_shrink_to_fit(struct StringTokenizer *tokenizer);
+# 1305 "/root/repo/src/../include/strutils.h"
+int st_append_string(struct StringTokenizer *tokenizer, const char *string);
+# 1320 "/root/repo/src/../include/strutils.h"
+int st_append_n(struct StringTokenizer *tokenizer, const char *string, const size_t length);
+# 1333 "/root/repo/src/../include/strutils.h"
+int st_append_char(struct StringTokenizer *tokenizer, const char token);
+# 1350 "/root/repo/src/../include/strutils.h"
+int st_append_many(struct StringTokenizer *tokenizer, const struct StringView *fragments, const size_t count);
+# 1365 "/root/repo/src/../include/strutils.h"
+int st_append_quoted_string(struct StringTokenizer *tokenizer, const char *string);
+# 1381 "/root/repo/src/../include/strutils.h"
+int st_append_escaped_string(struct StringTokenizer *tokenizer, const char *string);
+# 1398 "/root/repo/src/../include/strutils.h"
+int st_append_escaped_n(struct StringTokenizer *tokenizer, const char *string, const size_t length);
+# 1411 "/root/repo/src/../include/strutils.h"
+int st_append_int(struct StringTokenizer *tokenizer, const int64_t value);
+# 1427 "/root/repo/src/../include/strutils.h"
+int st_append_double(struct StringTokenizer *tokenizer, const double *value);
+# 1442 "/root/repo/src/../include/strutils.h"
+int st_append_double_precision(struct StringTokenizer *tokenizer, const double *value, const int precision);
+# 1457 "/root/repo/src/../include/strutils.h"
+int st_append_fixed(struct StringTokenizer *tokenizer, const double *value, const int precision);
+# 1473 "/root/repo/src/../include/strutils.h"
+static inline int is_numeric(const char token) {
+  return st_char_is(token, ST_CLASS_NUMERIC);
+}
+# 1517 "/root/repo/src/../include/strutils.h"
+char *itos(int value);
+# 1530 "/root/repo/src/../include/strutils.h"
+size_t itos_to(char *buffer, int value);
+# 1543 "/root/repo/src/../include/strutils.h"
+size_t i64tos_to(char *buffer, int64_t value);
+# 1556 "/root/repo/src/../include/strutils.h"
+size_t u64tos_to(char *buffer, uint64_t value);
+# 1568 "/root/repo/src/../include/strutils.h"
+char *ldtos(long double value);
+# 1579 "/root/repo/src/../include/strutils.h"
+long double stold(const char *numeric_string);
+# 1598 "/root/repo/src/../include/strutils.h"
+size_t stod(const char *string, const size_t length, double *value);
+# 1614 "/root/repo/src/../include/strutils.h"
+size_t dtos_to(char *buffer, const double value);
+# 1632 "/root/repo/src/../include/strutils.h"
+size_t dtos_precision_to(char *buffer, const double value, int precision);
+# 1651 "/root/repo/src/../include/strutils.h"
+size_t dtos_fixed_to(char *buffer, const double value, int precision);
+# 1672 "/root/repo/src/../include/strutils.h"
+size_t stoi64(const char *string, const size_t length, int64_t *value);
+# 1687 "/root/repo/src/../include/strutils.h"
+size_t stod_batch(const struct StringView *views, const size_t count, double *values);
+# 1702 "/root/repo/src/../include/strutils.h"
+size_t stoi64_batch(const struct StringView *views, const size_t count, int64_t *values);
+# 1719 "/root/repo/src/../include/strutils.h"
+size_t i64tos_batch(char *buffer, const int64_t *values, const size_t count, size_t *offsets);
+# 1736 "/root/repo/src/../include/strutils.h"
+size_t dtos_batch(char *buffer, const double *values, const size_t count, size_t *offsets);
+# 1756 "/root/repo/src/../include/strutils.h"
+struct JsonHandler {
+
+
+
+
+  int (*start_object)(void *context);
+
+
+
+
+  int (*end_object)(void *context);
+
+
+
+
+  int (*start_array)(void *context);
+
+
+
+
+  int (*end_array)(void *context);
+
+
+
+
+  int (*key)(void *context, const struct StringView *key);
+
+
+
+
+  int (*string)(void *context, const struct StringView *value);
+
+
+
+
+  int (*number)(void *context, const struct StringView *raw, double value);
+
+
+
+
+  int (*boolean)(void *context, int value);
+
+
+
+
+  int (*null)(void *context);
+};
+# 1822 "/root/repo/src/../include/strutils.h"
+int st_json_parse(struct StringTokenizer *tokenizer, const struct JsonHandler *handler, void *context);
+# 1840 "/root/repo/src/../include/strutils.h"
+int st_json_unescape(const struct StringView *view, char *buffer, size_t *length);
+# 1856 "/root/repo/src/../include/strutils.h"
+int st_skip_value(struct StringTokenizer *tokenizer);
+# 1875 "/root/repo/src/../include/strutils.h"
+int st_find_key(struct StringTokenizer *tokenizer, const char *key);
+# 1892 "/root/repo/src/../include/strutils.h"
+struct StringStructuralIndex {
+
+
+
+
+  size_t *positions;
+
+
+
+
+  size_t count;
+
+
+
+
+
+  uint64_t *in_string;
+
+
+
+
+  size_t length;
+
+
+
+
+  size_t hint;
+};
+# 1935 "/root/repo/src/../include/strutils.h"
+int st_build_structural_index(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+void st_drop_structural_index(struct StringTokenizer *tokenizer);
+# 1956 "/root/repo/src/../include/strutils.h"
+size_t st_structural_next(struct StringStructuralIndex *index, const size_t position);
+# 1969 "/root/repo/src/../include/strutils.h"
+static inline int st_structural_in_string(const struct StringStructuralIndex *index, const size_t position) {
+  return (int)((index->in_string[position / 64] >> (position % 64)) & 1);
+}
+# 1983 "/root/repo/src/../include/strutils.h"
+void st_next_structural(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/uio.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 2 3 4
+
+
+
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 3 4
+struct iovec
+  {
+    void *iov_base;
+    size_t iov_len;
+  };
+# 24 "/usr/include/x86_64-linux-gnu/sys/uio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uio_lim.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/sys/uio.h" 2 3 4
+
+
+
+
+
+
+
+# 41 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t readv (int __fd, const struct iovec *__iovec, int __count)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 52 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t writev (int __fd, const struct iovec *__iovec, int __count)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 67 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t preadv (int __fd, const struct iovec *__iovec, int __count,
+         __off_t __offset)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 80 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t pwritev (int __fd, const struct iovec *__iovec, int __count,
+   __off_t __offset)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 174 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+
+# 1991 "/root/repo/src/../include/strutils.h" 2
+# 2010 "/root/repo/src/../include/strutils.h"
+
+# 2010 "/root/repo/src/../include/strutils.h"
+struct StringParallelHandler {
+
+
+
+
+
+  int (*process)(void *context, struct StringTokenizer *tokenizer, void **result);
+
+
+
+
+
+  int (*merge)(void *context, void *result);
+};
+# 2050 "/root/repo/src/../include/strutils.h"
+int st_parallel_lines(char *string, const size_t length, size_t threads, size_t chunk_size, const struct StringParallelHandler *handler, void *context);
+
+
+
+
+struct StringFragments {
+
+
+
+
+  struct StringTokenizer **fragments;
+
+
+
+
+  size_t count;
+
+
+
+
+  struct iovec *iov;
+
+
+
+
+  size_t iov_count;
+
+
+
+
+  size_t length;
+
+
+
+
+  char *separator;
+};
+# 2113 "/root/repo/src/../include/strutils.h"
+int st_parallel_serialize(struct StringFragments *fragments, const size_t count, size_t threads, size_t batch_size, int (*serialize)(void *context, struct StringTokenizer *tokenizer, size_t index), void *context, const char *separator);
+# 2128 "/root/repo/src/../include/strutils.h"
+int st_fragments_stitch(const struct StringFragments *fragments, struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+void st_fragments_free(struct StringFragments *fragments);
+# 2158 "/root/repo/src/../include/strutils.h"
+struct StringOutputBlock;
+# 2167 "/root/repo/src/../include/strutils.h"
+struct StringOutput {
+
+
+
+
+  struct StringOutputBlock *head;
+
+
+
+
+  struct StringOutputBlock *tail;
+
+
+
+
+  struct StringOutputBlock *spare;
+
+
+
+
+  size_t block_size;
+
+
+
+
+  size_t length;
+
+
+
+
+  size_t flush_threshold;
+
+
+
+
+  int fd;
+
+
+
+
+  size_t written;
+
+
+
+
+  int error;
+};
+# 2228 "/root/repo/src/../include/strutils.h"
+struct StringOutput *st_output_create(const int fd, const size_t block_size, const size_t flush_threshold);
+# 2243 "/root/repo/src/../include/strutils.h"
+char *st_output_reserve(struct StringOutput *output, const size_t size);
+# 2256 "/root/repo/src/../include/strutils.h"
+int st_output_commit(struct StringOutput *output, const size_t size);
+# 2271 "/root/repo/src/../include/strutils.h"
+int st_output_append_n(struct StringOutput *output, const char *string, const size_t length);
+# 2284 "/root/repo/src/../include/strutils.h"
+int st_output_append_string(struct StringOutput *output, const char *string);
+# 2297 "/root/repo/src/../include/strutils.h"
+int st_output_append_char(struct StringOutput *output, const char token);
+# 2310 "/root/repo/src/../include/strutils.h"
+int st_output_append_int(struct StringOutput *output, const int64_t value);
+# 2323 "/root/repo/src/../include/strutils.h"
+int st_output_append_double(struct StringOutput *output, const double value);
+# 2338 "/root/repo/src/../include/strutils.h"
+size_t st_output_iov(const struct StringOutput *output, struct iovec *iov, const size_t count);
+# 2353 "/root/repo/src/../include/strutils.h"
+int st_output_flush(struct StringOutput *output);
+
+
+
+
+
+
+
+void st_output_reset(struct StringOutput *output);
+
+
+
+
+
+
+
+void st_output_destroy(struct StringOutput *output);
+# 5 "/root/repo/src/string_tokenizer.c" 2
+# 14 "/root/repo/src/string_tokenizer.c"
+static _Thread_local struct StringTokenizer *string_tokenizer_pool[8];
+
+
+
+
+static _Thread_local size_t string_tokenizer_pool_count = 0;
+
+
+
+
+struct StringTokenizer *st_create(char *string) {
+  if (string == 
+# 25 "/root/repo/src/string_tokenizer.c" 3 4
+               ((void *)0)
+# 25 "/root/repo/src/string_tokenizer.c"
+                   ) {
+    return 
+# 26 "/root/repo/src/string_tokenizer.c" 3 4
+          ((void *)0)
+# 26 "/root/repo/src/string_tokenizer.c"
+              ;
+  }
+  return st_create_n(string, strlen(string));
+}
+
+
+
+
+void st_init(struct StringTokenizer *tokenizer, char *string, const size_t length) {
+  tokenizer->string = string;
+  tokenizer->length = length;
+  tokenizer->position = 0;
+  tokenizer->incremental_factor = 0;
+  tokenizer->growth_policy = ST_GROWTH_GEOMETRIC;
+  tokenizer->max_increment = 0;
+  tokenizer->stream = 
+# 41 "/root/repo/src/string_tokenizer.c" 3 4
+                     ((void *)0)
+# 41 "/root/repo/src/string_tokenizer.c"
+                         ;
+  tokenizer->ownership = ST_STRING_BORROWED;
+  tokenizer->arena = 
+# 43 "/root/repo/src/string_tokenizer.c" 3 4
+                    ((void *)0)
+# 43 "/root/repo/src/string_tokenizer.c"
+                        ;
+  tokenizer->structural_index = 
+# 44 "/root/repo/src/string_tokenizer.c" 3 4
+                               ((void *)0)
+# 44 "/root/repo/src/string_tokenizer.c"
+                                   ;
+  tokenizer->stats = 
+# 45 "/root/repo/src/string_tokenizer.c" 3 4
+                    ((void *)0)
+# 45 "/root/repo/src/string_tokenizer.c"
+                        ;
+}
+
+
+
+
+struct StringTokenizer *st_create_n(char *string, const size_t length) {
+  if (string == 
+# 52 "/root/repo/src/string_tokenizer.c" 3 4
+               ((void *)0) 
+# 52 "/root/repo/src/string_tokenizer.c"
+                    || length == 0) {
+    return 
+# 53 "/root/repo/src/string_tokenizer.c" 3 4
+          ((void *)0)
+# 53 "/root/repo/src/string_tokenizer.c"
+              ;
+  }
+  size_t size = sizeof(struct StringTokenizer);
+  struct StringTokenizer *tokenizer = (struct StringTokenizer *)malloc(size);
+  do { st_stats_add((
+# 57 "/root/repo/src/string_tokenizer.c" 3 4
+ ((void *)0)
+# 57 "/root/repo/src/string_tokenizer.c"
+ ), 
+# 57 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 57 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 57 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 57 "/root/repo/src/string_tokenizer.c"
+ allocations
+# 57 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 57 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  if (tokenizer != 
+# 58 "/root/repo/src/string_tokenizer.c" 3 4
+                  ((void *)0)
+# 58 "/root/repo/src/string_tokenizer.c"
+                      ) {
+    st_init(tokenizer, string, length);
+  }
+  return tokenizer;
+}
+
+
+
+
+struct StringTokenizer *st_create_empty(const size_t string_size) {
+  if (string_size > 0 && string_size < 256) {
+
+    struct StringTokenizer *tokenizer = (struct StringTokenizer *)malloc(sizeof(struct StringTokenizer));
+    do { st_stats_add((
+# 71 "/root/repo/src/string_tokenizer.c" 3 4
+   ((void *)0)
+# 71 "/root/repo/src/string_tokenizer.c"
+   ), 
+# 71 "/root/repo/src/string_tokenizer.c" 3 4
+   __builtin_offsetof (
+# 71 "/root/repo/src/string_tokenizer.c"
+   struct StringStats
+# 71 "/root/repo/src/string_tokenizer.c" 3 4
+   , 
+# 71 "/root/repo/src/string_tokenizer.c"
+   allocations
+# 71 "/root/repo/src/string_tokenizer.c" 3 4
+   )
+# 71 "/root/repo/src/string_tokenizer.c"
+   , (1)); do { } while (0); } while (0);
+    if (tokenizer != 
+# 72 "/root/repo/src/string_tokenizer.c" 3 4
+                    ((void *)0)
+# 72 "/root/repo/src/string_tokenizer.c"
+                        ) {
+      st_init(tokenizer, tokenizer->inline_buffer, 256 - sizeof(""));
+      tokenizer->inline_buffer[0] = '\0';
+      tokenizer->incremental_factor = string_size;
+      tokenizer->ownership = ST_STRING_INLINE;
+    }
+    return tokenizer;
+  }
+
+  char *string = (char *)malloc(string_size + sizeof(""));
+  do { st_stats_add((
+# 82 "/root/repo/src/string_tokenizer.c" 3 4
+ ((void *)0)
+# 82 "/root/repo/src/string_tokenizer.c"
+ ), 
+# 82 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 82 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 82 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 82 "/root/repo/src/string_tokenizer.c"
+ allocations
+# 82 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 82 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  if (string == 
+# 83 "/root/repo/src/string_tokenizer.c" 3 4
+               ((void *)0)
+# 83 "/root/repo/src/string_tokenizer.c"
+                   ) {
+    return 
+# 84 "/root/repo/src/string_tokenizer.c" 3 4
+          ((void *)0)
+# 84 "/root/repo/src/string_tokenizer.c"
+              ;
+  }
+
+  string[0] = '\0';
+  string[string_size] = '\0';
+  struct StringTokenizer *tokenizer = st_create_n(string, string_size);
+  if (tokenizer == 
+# 90 "/root/repo/src/string_tokenizer.c" 3 4
+                  ((void *)0)
+# 90 "/root/repo/src/string_tokenizer.c"
+                      ) {
+    free(string);
+    return 
+# 92 "/root/repo/src/string_tokenizer.c" 3 4
+          ((void *)0)
+# 92 "/root/repo/src/string_tokenizer.c"
+              ;
+  }
+
+  tokenizer->incremental_factor = string_size;
+  tokenizer->ownership = ST_STRING_OWNED;
+
+  return tokenizer;
+}
+
+
+
+
+
+
+
+static void st_release_string(struct StringTokenizer *tokenizer) {
+  st_drop_structural_index(tokenizer);
+  if (tokenizer->stream != 
+# 109 "/root/repo/src/string_tokenizer.c" 3 4
+                          ((void *)0)
+# 109 "/root/repo/src/string_tokenizer.c"
+                              ) {
+
+    free(tokenizer->string);
+    free(tokenizer->stream);
+    tokenizer->stream = 
+# 113 "/root/repo/src/string_tokenizer.c" 3 4
+                       ((void *)0)
+# 113 "/root/repo/src/string_tokenizer.c"
+                           ;
+  }
+  else if (tokenizer->ownership == ST_STRING_OWNED) {
+    free(tokenizer->string);
+  }
+  else if (tokenizer->ownership == ST_STRING_MAPPED) {
+    munmap(tokenizer->string, tokenizer->length);
+  }
+  tokenizer->string = 
+# 121 "/root/repo/src/string_tokenizer.c" 3 4
+                     ((void *)0)
+# 121 "/root/repo/src/string_tokenizer.c"
+                         ;
+  tokenizer->ownership = ST_STRING_BORROWED;
+}
+
+
+
+
+void st_destroy(struct StringTokenizer *tokenizer) {
+  if (tokenizer != 
+# 129 "/root/repo/src/string_tokenizer.c" 3 4
+                  ((void *)0)
+# 129 "/root/repo/src/string_tokenizer.c"
+                      ) {
+    st_release_string(tokenizer);
+  }
+  free(tokenizer);
+  tokenizer = 
+# 133 "/root/repo/src/string_tokenizer.c" 3 4
+             ((void *)0)
+# 133 "/root/repo/src/string_tokenizer.c"
+                 ;
+}
+
+
+
+
+void st_reset(struct StringTokenizer *tokenizer) {
+  tokenizer->position = 0;
+  if (tokenizer->ownership == ST_STRING_OWNED || tokenizer->ownership == ST_STRING_INLINE) {
+
+    tokenizer->string[0] = '\0';
+    st_drop_structural_index(tokenizer);
+  }
+}
+
+
+
+
+int st_rebind(struct StringTokenizer *tokenizer, char *string, const size_t length) {
+  if (tokenizer->stream != 
+# 152 "/root/repo/src/string_tokenizer.c" 3 4
+                          ((void *)0) 
+# 152 "/root/repo/src/string_tokenizer.c"
+                               || string == 
+# 152 "/root/repo/src/string_tokenizer.c" 3 4
+                                            ((void *)0) 
+# 152 "/root/repo/src/string_tokenizer.c"
+                                                 || length == 0) {
+    return 0;
+  }
+  st_release_string(tokenizer);
+  tokenizer->string = string;
+  tokenizer->length = length;
+  tokenizer->position = 0;
+  return 1;
+}
+
+
+
+
+char *st_detach_string(struct StringTokenizer *tokenizer) {
+  char *string = tokenizer->string;
+  if (tokenizer->ownership == ST_STRING_INLINE) {
+
+    struct StringView view = {tokenizer->string, tokenizer->position};
+    string = sv_to_string(&view);
+    if (string == 
+# 171 "/root/repo/src/string_tokenizer.c" 3 4
+                 ((void *)0)
+# 171 "/root/repo/src/string_tokenizer.c"
+                     ) {
+      return 
+# 172 "/root/repo/src/string_tokenizer.c" 3 4
+            ((void *)0)
+# 172 "/root/repo/src/string_tokenizer.c"
+                ;
+    }
+  }
+  else if (tokenizer->ownership != ST_STRING_OWNED) {
+
+    return string;
+  }
+
+  st_drop_structural_index(tokenizer);
+  tokenizer->string = tokenizer->inline_buffer;
+  tokenizer->length = 256 - sizeof("");
+  tokenizer->position = 0;
+  tokenizer->inline_buffer[0] = '\0';
+  tokenizer->ownership = ST_STRING_INLINE;
+  return string;
+}
+
+
+
+
+struct StringTokenizer *st_pool_acquire(const size_t string_size) {
+  if (string_tokenizer_pool_count == 0) {
+    return st_create_empty(string_size);
+  }
+  struct StringTokenizer *tokenizer = string_tokenizer_pool[--string_tokenizer_pool_count];
+  if (st_reserve(tokenizer, string_size) == 0) {
+    st_destroy(tokenizer);
+    return 
+# 199 "/root/repo/src/string_tokenizer.c" 3 4
+          ((void *)0)
+# 199 "/root/repo/src/string_tokenizer.c"
+              ;
+  }
+  return tokenizer;
+}
+
+
+
+
+void st_pool_release(struct StringTokenizer *tokenizer) {
+  if (tokenizer == 
+# 208 "/root/repo/src/string_tokenizer.c" 3 4
+                  ((void *)0)
+# 208 "/root/repo/src/string_tokenizer.c"
+                      ) {
+    return;
+  }
+  int builder = tokenizer->ownership == ST_STRING_OWNED || tokenizer->ownership == ST_STRING_INLINE;
+  if (builder == 0 || tokenizer->stream != 
+# 212 "/root/repo/src/string_tokenizer.c" 3 4
+                                          ((void *)0) 
+# 212 "/root/repo/src/string_tokenizer.c"
+                                               || string_tokenizer_pool_count == 8) {
+    st_destroy(tokenizer);
+    return;
+  }
+
+  st_reset(tokenizer);
+  enum StringOwnership ownership = tokenizer->ownership;
+  size_t incremental_factor = tokenizer->incremental_factor;
+  st_init(tokenizer, tokenizer->string, tokenizer->length);
+  tokenizer->ownership = ownership;
+  tokenizer->incremental_factor = incremental_factor;
+  string_tokenizer_pool[string_tokenizer_pool_count++] = tokenizer;
+}
+
+
+
+
+void st_pool_clear(void) {
+  while (string_tokenizer_pool_count > 0) {
+    st_destroy(string_tokenizer_pool[--string_tokenizer_pool_count]);
+  }
+}
+
+
+
+
+void st_attach_arena(struct StringTokenizer *tokenizer, struct StringArena *arena) {
+  tokenizer->arena = arena;
+}
+
+
+
+
+void st_attach_stats(struct StringTokenizer *tokenizer, struct StringStats *stats) {
+  tokenizer->stats = stats;
+}
+# 260 "/root/repo/src/string_tokenizer.c"
+static void *st_allocate(struct StringTokenizer *tokenizer, const size_t size) {
+  if (tokenizer->arena != 
+# 261 "/root/repo/src/string_tokenizer.c" 3 4
+                         ((void *)0)
+# 261 "/root/repo/src/string_tokenizer.c"
+                             ) {
+    return st_arena_alloc(tokenizer->arena, size);
+  }
+  do { st_stats_add((tokenizer), 
+# 264 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 264 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 264 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 264 "/root/repo/src/string_tokenizer.c"
+ allocations
+# 264 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 264 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  return malloc(size);
+}
+# 279 "/root/repo/src/string_tokenizer.c"
+static char *st_copy_view(struct StringTokenizer *tokenizer, const struct StringView *view) {
+  if (tokenizer->arena != 
+# 280 "/root/repo/src/string_tokenizer.c" 3 4
+                         ((void *)0)
+# 280 "/root/repo/src/string_tokenizer.c"
+                             ) {
+    return st_arena_string(tokenizer->arena, view);
+  }
+  do { st_stats_add((tokenizer), 
+# 283 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 283 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 283 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 283 "/root/repo/src/string_tokenizer.c"
+ allocations
+# 283 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 283 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  return sv_to_string(view);
+}
+
+
+
+
+void st_next_token(struct StringTokenizer *tokenizer) {
+
+  size_t position = tokenizer->position + 1;
+  struct StringStructuralIndex *index = tokenizer->structural_index;
+  if (index != 
+# 294 "/root/repo/src/string_tokenizer.c" 3 4
+              ((void *)0) 
+# 294 "/root/repo/src/string_tokenizer.c"
+                   && position < tokenizer->length && st_char_is(tokenizer->string[position], ST_CLASS_WHITESPACE) && st_structural_in_string(index, position) == 0) {
+
+    tokenizer->position = st_structural_next(index, position);
+    do { st_stats_add((tokenizer), 
+# 297 "/root/repo/src/string_tokenizer.c" 3 4
+   __builtin_offsetof (
+# 297 "/root/repo/src/string_tokenizer.c"
+   struct StringStats
+# 297 "/root/repo/src/string_tokenizer.c" 3 4
+   , 
+# 297 "/root/repo/src/string_tokenizer.c"
+   bytes_scanned
+# 297 "/root/repo/src/string_tokenizer.c" 3 4
+   )
+# 297 "/root/repo/src/string_tokenizer.c"
+   , (tokenizer->position - position + 1)); do { } while (0); } while (0);
+    return;
+  }
+  while (1) {
+
+    if (position < tokenizer->length) {
+      position += st_scan_non_whitespace(tokenizer->string + position, tokenizer->length - position);
+      if (position < tokenizer->length) {
+        break;
+      }
+    }
+
+    tokenizer->position = tokenizer->length;
+    if (tokenizer->stream == 
+# 310 "/root/repo/src/string_tokenizer.c" 3 4
+                            ((void *)0) 
+# 310 "/root/repo/src/string_tokenizer.c"
+                                 || st_ensure(tokenizer, 1) == 0) {
+      return;
+    }
+    position = tokenizer->position;
+  }
+  do { st_stats_add((tokenizer), 
+# 315 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 315 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 315 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 315 "/root/repo/src/string_tokenizer.c"
+ bytes_scanned
+# 315 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 315 "/root/repo/src/string_tokenizer.c"
+ , (position - tokenizer->position)); do { } while (0); } while (0);
+  tokenizer->position = position;
+}
+
+
+
+
+char st_current_token(struct StringTokenizer *tokenizer) {
+  if (st_ensure(tokenizer, 1) == 0) {
+
+    return '\0';
+  }
+  return tokenizer->string[tokenizer->position];
+}
+
+
+
+
+int st_sub_string_view(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim, struct StringView *view) {
+
+  if (st_ensure(tokenizer, 1) == 0 || tokenizer->string[tokenizer->position] != start_delim) {
+
+    return 0;
+  }
+
+  size_t end = 1;
+  while (1) {
+    size_t available = tokenizer->length - tokenizer->position;
+    end += st_scan_delimiter(tokenizer->string + tokenizer->position + end, available - end, end_delim);
+
+    if (end < available || st_ensure(tokenizer, available + 1) == 0) {
+      break;
+    }
+  }
+
+  view->ptr = tokenizer->string + tokenizer->position + 1;
+  view->len = end - 1;
+
+  tokenizer->position += end;
+  do { st_stats_add((tokenizer), 
+# 354 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 354 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 354 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 354 "/root/repo/src/string_tokenizer.c"
+ bytes_scanned
+# 354 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 354 "/root/repo/src/string_tokenizer.c"
+ , (end + 1)); do { } while (0); } while (0);
+  do { st_stats_add((tokenizer), 
+# 355 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 355 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 355 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 355 "/root/repo/src/string_tokenizer.c"
+ tokens_extracted
+# 355 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 355 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  return 1;
+}
+
+
+
+
+char *st_sub_string(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim) {
+  struct StringView view;
+  if (st_sub_string_view(tokenizer, start_delim, end_delim, &view) == 0) {
+    return 
+# 365 "/root/repo/src/string_tokenizer.c" 3 4
+          ((void *)0)
+# 365 "/root/repo/src/string_tokenizer.c"
+              ;
+  }
+
+  return st_copy_view(tokenizer, &view);
+}
+
+
+
+
+int st_slice_string_view(struct StringTokenizer *tokenizer, const int length, struct StringView *view) {
+
+  if (length >= 0) {
+    st_ensure(tokenizer, length);
+  }
+  if (length < 0 || tokenizer->position > tokenizer->length || (size_t)length > (tokenizer->length - tokenizer->position)) {
+    return 0;
+  }
+
+  view->ptr = tokenizer->string + tokenizer->position;
+  view->len = length;
+
+  tokenizer->position += length + 1;
+  do { st_stats_add((tokenizer), 
+# 387 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 387 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 387 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 387 "/root/repo/src/string_tokenizer.c"
+ bytes_scanned
+# 387 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 387 "/root/repo/src/string_tokenizer.c"
+ , (length)); do { } while (0); } while (0);
+  do { st_stats_add((tokenizer), 
+# 388 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 388 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 388 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 388 "/root/repo/src/string_tokenizer.c"
+ tokens_extracted
+# 388 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 388 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  return 1;
+}
+
+
+
+
+char *st_slice_string(struct StringTokenizer *tokenizer, const int length) {
+  struct StringView view;
+  if (st_slice_string_view(tokenizer, length, &view) == 0) {
+    return 
+# 398 "/root/repo/src/string_tokenizer.c" 3 4
+          ((void *)0)
+# 398 "/root/repo/src/string_tokenizer.c"
+              ;
+  }
+
+  return st_copy_view(tokenizer, &view);
+}
+# 415 "/root/repo/src/string_tokenizer.c"
+static int st_numbers_view(struct StringTokenizer *tokenizer, struct StringView *view) {
+
+  size_t end = 0;
+  while (st_ensure(tokenizer, end + 1) == 1 && is_numeric(tokenizer->string[tokenizer->position + end]) == 1) {
+    end++;
+  }
+
+  if (end == 0) {
+    return 0;
+  }
+
+  view->ptr = tokenizer->string + tokenizer->position;
+  view->len = end;
+  return 1;
+}
+
+
+
+
+int st_extract_numbers_view(struct StringTokenizer *tokenizer, struct StringView *view) {
+  if (st_numbers_view(tokenizer, view) == 0) {
+    return 0;
+  }
+  size_t end = view->len;
+
+  tokenizer->position += end - 1;
+  do { st_stats_add((tokenizer), 
+# 441 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 441 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 441 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 441 "/root/repo/src/string_tokenizer.c"
+ bytes_scanned
+# 441 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 441 "/root/repo/src/string_tokenizer.c"
+ , (end)); do { } while (0); } while (0);
+  do { st_stats_add((tokenizer), 
+# 442 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 442 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 442 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 442 "/root/repo/src/string_tokenizer.c"
+ tokens_extracted
+# 442 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 442 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  return 1;
+}
+
+
+
+
+int st_extract_until_view(struct StringTokenizer *tokenizer, const struct StringCharClass *delimiters, struct StringView *view) {
+
+  size_t end = 0;
+  while (st_ensure(tokenizer, end + 1) == 1) {
+    size_t available = tokenizer->length - tokenizer->position;
+    end += st_scan_class(tokenizer->string + tokenizer->position + end, available - end, delimiters);
+
+    if (end < available) {
+      break;
+    }
+  }
+  if (end == 0) {
+    return 0;
+  }
+
+  view->ptr = tokenizer->string + tokenizer->position;
+  view->len = end;
+
+  tokenizer->position += end - 1;
+  do { st_stats_add((tokenizer), 
+# 468 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 468 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 468 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 468 "/root/repo/src/string_tokenizer.c"
+ bytes_scanned
+# 468 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 468 "/root/repo/src/string_tokenizer.c"
+ , (end)); do { } while (0); } while (0);
+  do { st_stats_add((tokenizer), 
+# 469 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 469 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 469 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 469 "/root/repo/src/string_tokenizer.c"
+ tokens_extracted
+# 469 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 469 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  return 1;
+}
+
+
+
+
+char *st_extract_numbers(struct StringTokenizer *tokenizer) {
+  struct StringView view;
+  if (st_extract_numbers_view(tokenizer, &view) == 0) {
+    return 
+# 479 "/root/repo/src/string_tokenizer.c" 3 4
+          ((void *)0)
+# 479 "/root/repo/src/string_tokenizer.c"
+              ;
+  }
+
+  return st_copy_view(tokenizer, &view);
+}
+
+
+
+
+int st_extract_double_to(struct StringTokenizer *tokenizer, double *value) {
+
+  struct StringView view;
+  if (st_extract_numbers_view(tokenizer, &view) == 0) {
+    return 0;
+  }
+
+  uint64_t start = st_stats_clock(tokenizer);
+  size_t converted = stod(view.ptr, view.len, value);
+  do { if ((start) != 0) { do { st_stats_add((tokenizer), 
+# 497 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 497 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 497 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 497 "/root/repo/src/string_tokenizer.c"
+ conversions
+# 497 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 497 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0); do { st_stats_add((tokenizer), 
+# 497 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 497 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 497 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 497 "/root/repo/src/string_tokenizer.c"
+ conversion_ns
+# 497 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 497 "/root/repo/src/string_tokenizer.c"
+ , (st_stats_clock(tokenizer) - (start))); do { } while (0); } while (0); } } while (0);
+  if (converted == 0) {
+
+    tokenizer->position = view.ptr - tokenizer->string;
+    return 0;
+  }
+  return 1;
+}
+
+
+
+
+int st_extract_int64(struct StringTokenizer *tokenizer, int64_t *value) {
+  uint64_t start = st_stats_clock(tokenizer);
+
+  st_ensure(tokenizer, 21);
+  size_t available;
+  size_t consumed;
+  int64_t number;
+  while (1) {
+    available = tokenizer->position < tokenizer->length ? tokenizer->length - tokenizer->position : 0;
+    consumed = stoi64(tokenizer->string + tokenizer->position, available, &number);
+
+    if (consumed < available || tokenizer->stream == 
+# 520 "/root/repo/src/string_tokenizer.c" 3 4
+                                                    ((void *)0) 
+# 520 "/root/repo/src/string_tokenizer.c"
+                                                         || st_ensure(tokenizer, available + 1) == 0) {
+      break;
+    }
+  }
+  if (consumed == 0) {
+    return 0;
+  }
+  char next = consumed < available ? tokenizer->string[tokenizer->position + consumed] : '\0';
+  if (next == '.' || next == 'e' || next == 'E') {
+
+    struct StringView view;
+    double decimal;
+    if (st_numbers_view(tokenizer, &view) == 0 || stod(view.ptr, view.len, &decimal) == 0) {
+      return 0;
+    }
+
+    if (decimal < -9223372036854775808.0 || decimal >= 9223372036854775808.0 || decimal != (double)(int64_t)decimal) {
+      return 0;
+    }
+    number = (int64_t)decimal;
+    consumed = view.len;
+  }
+  *value = number;
+
+  tokenizer->position += consumed - 1;
+  do { if ((start) != 0) { do { st_stats_add((tokenizer), 
+# 545 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 545 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 545 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 545 "/root/repo/src/string_tokenizer.c"
+ conversions
+# 545 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 545 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0); do { st_stats_add((tokenizer), 
+# 545 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 545 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 545 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 545 "/root/repo/src/string_tokenizer.c"
+ conversion_ns
+# 545 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 545 "/root/repo/src/string_tokenizer.c"
+ , (st_stats_clock(tokenizer) - (start))); do { } while (0); } while (0); } } while (0);
+  do { st_stats_add((tokenizer), 
+# 546 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 546 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 546 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 546 "/root/repo/src/string_tokenizer.c"
+ bytes_scanned
+# 546 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 546 "/root/repo/src/string_tokenizer.c"
+ , (consumed)); do { } while (0); } while (0);
+  do { st_stats_add((tokenizer), 
+# 547 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 547 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 547 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 547 "/root/repo/src/string_tokenizer.c"
+ tokens_extracted
+# 547 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 547 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  return 1;
+}
+
+
+
+
+double *st_extract_double(struct StringTokenizer *tokenizer) {
+
+  double number;
+  if (st_extract_double_to(tokenizer, &number) == 0) {
+    return 
+# 558 "/root/repo/src/string_tokenizer.c" 3 4
+          ((void *)0)
+# 558 "/root/repo/src/string_tokenizer.c"
+              ;
+  }
+
+  double *value = (double *)st_allocate(tokenizer, sizeof(double));
+  if (value != 
+# 562 "/root/repo/src/string_tokenizer.c" 3 4
+              ((void *)0)
+# 562 "/root/repo/src/string_tokenizer.c"
+                  ) {
+    *value = number;
+  }
+  return value;
+}
+
+
+
+
+int st_starts_with(struct StringTokenizer *tokenizer, const char *needle) {
+
+  size_t length = strlen(needle);
+
+  struct StringView view;
+  if (st_slice_string_view(tokenizer, length, &view) == 0) {
+    return 0;
+  }
+
+  if (memcmp(view.ptr, needle, length) != 0) {
+
+    tokenizer->position = view.ptr - tokenizer->string;
+    return 0;
+  }
+
+  return 1;
+}
+
+
+
+
+int *st_extract_boolean(struct StringTokenizer *tokenizer, const char *bool_value, const int int_value) {
+
+  if (st_starts_with(tokenizer, bool_value) == 0) {
+    return 
+# 595 "/root/repo/src/string_tokenizer.c" 3 4
+          ((void *)0)
+# 595 "/root/repo/src/string_tokenizer.c"
+              ;
+  }
+
+  int *value = (int *)st_allocate(tokenizer, sizeof(int));
+
+  if (value != 
+# 600 "/root/repo/src/string_tokenizer.c" 3 4
+              ((void *)0)
+# 600 "/root/repo/src/string_tokenizer.c"
+                  ) {
+    *value = int_value;
+  }
+
+  return value;
+}
+# 618 "/root/repo/src/string_tokenizer.c"
+static int st_resize_string(struct StringTokenizer *tokenizer, const size_t length) {
+  if (tokenizer->ownership == ST_STRING_MAPPED || tokenizer->stream != 
+# 619 "/root/repo/src/string_tokenizer.c" 3 4
+                                                                      ((void *)0)
+# 619 "/root/repo/src/string_tokenizer.c"
+                                                                          ) {
+
+    return 0;
+  }
+  if (tokenizer->ownership == ST_STRING_INLINE) {
+    if (length <= 256) {
+
+      return 1;
+    }
+
+    char *string = (char *)malloc(length);
+    do { st_stats_add((tokenizer), 
+# 630 "/root/repo/src/string_tokenizer.c" 3 4
+   __builtin_offsetof (
+# 630 "/root/repo/src/string_tokenizer.c"
+   struct StringStats
+# 630 "/root/repo/src/string_tokenizer.c" 3 4
+   , 
+# 630 "/root/repo/src/string_tokenizer.c"
+   allocations
+# 630 "/root/repo/src/string_tokenizer.c" 3 4
+   )
+# 630 "/root/repo/src/string_tokenizer.c"
+   , (1)); do { } while (0); } while (0);
+    if (string == 
+# 631 "/root/repo/src/string_tokenizer.c" 3 4
+                 ((void *)0)
+# 631 "/root/repo/src/string_tokenizer.c"
+                     ) {
+      return 0;
+    }
+    do { st_stats_add((tokenizer), 
+# 634 "/root/repo/src/string_tokenizer.c" 3 4
+   __builtin_offsetof (
+# 634 "/root/repo/src/string_tokenizer.c"
+   struct StringStats
+# 634 "/root/repo/src/string_tokenizer.c" 3 4
+   , 
+# 634 "/root/repo/src/string_tokenizer.c"
+   bytes_copied
+# 634 "/root/repo/src/string_tokenizer.c" 3 4
+   )
+# 634 "/root/repo/src/string_tokenizer.c"
+   , (256)); do { } while (0); } while (0);
+    memcpy(string, tokenizer->inline_buffer, 256);
+    tokenizer->string = string;
+    tokenizer->length = length;
+    tokenizer->ownership = ST_STRING_OWNED;
+    return 1;
+  }
+  char *string = (char *)realloc(tokenizer->string, length);
+  do { st_stats_add((tokenizer), 
+# 642 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 642 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 642 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 642 "/root/repo/src/string_tokenizer.c"
+ reallocations
+# 642 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 642 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  if (string == 
+# 643 "/root/repo/src/string_tokenizer.c" 3 4
+               ((void *)0)
+# 643 "/root/repo/src/string_tokenizer.c"
+                   ) {
+
+    return 0;
+  }
+
+  do { st_stats_add((tokenizer), 
+# 648 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 648 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 648 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 648 "/root/repo/src/string_tokenizer.c"
+ bytes_copied
+# 648 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 648 "/root/repo/src/string_tokenizer.c"
+ , (string != tokenizer->string ? tokenizer->position : 0)); do { } while (0); } while (0);
+
+  tokenizer->string = string;
+  tokenizer->length = length;
+  return 1;
+}
+
+
+
+
+int st_expand_string(struct StringTokenizer *tokenizer, const size_t size) {
+  if (tokenizer->ownership == ST_STRING_MAPPED || tokenizer->stream != 
+# 659 "/root/repo/src/string_tokenizer.c" 3 4
+                                                                      ((void *)0)
+# 659 "/root/repo/src/string_tokenizer.c"
+                                                                          ) {
+
+    return 0;
+  }
+
+  if ((tokenizer->position + size) < tokenizer->length) {
+
+    return 1;
+  }
+
+  size_t add_size;
+  if (tokenizer->growth_policy == ST_GROWTH_LINEAR) {
+    add_size = size > tokenizer->incremental_factor ? size : tokenizer->incremental_factor;
+    tokenizer->incremental_factor = add_size;
+  }
+  else {
+    add_size = tokenizer->length > tokenizer->incremental_factor ? tokenizer->length : tokenizer->incremental_factor;
+  }
+  if (tokenizer->max_increment != 0 && add_size > tokenizer->max_increment) {
+    add_size = tokenizer->max_increment;
+  }
+
+  size_t new_length = tokenizer->length + add_size;
+  if (new_length <= tokenizer->position + size) {
+    new_length = tokenizer->position + size + sizeof("");
+  }
+
+  do { st_stats_add((tokenizer), 
+# 686 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 686 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 686 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 686 "/root/repo/src/string_tokenizer.c"
+ expansions
+# 686 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 686 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0);
+  return st_resize_string(tokenizer, new_length);
+}
+
+
+
+
+void st_set_growth_policy(struct StringTokenizer *tokenizer, const enum StringGrowthPolicy policy, const size_t max_increment) {
+  tokenizer->growth_policy = policy;
+  tokenizer->max_increment = max_increment;
+}
+
+
+
+
+int st_reserve(struct StringTokenizer *tokenizer, const size_t length) {
+  if (length <= tokenizer->length) {
+
+    return 1;
+  }
+  return st_resize_string(tokenizer, length);
+}
+
+
+
+
+int st_shrink_to_fit(struct StringTokenizer *tokenizer) {
+  size_t length = tokenizer->position + sizeof("");
+  if (length >= tokenizer->length) {
+
+    return 1;
+  }
+  if (st_resize_string(tokenizer, length) == 0) {
+    return 0;
+  }
+
+  tokenizer->string[tokenizer->position] = '\0';
+  return 1;
+}
+
+
+
+
+int st_append_n(struct StringTokenizer *tokenizer, const char *string, const size_t length) {
+
+  if (st_expand_string(tokenizer, length) == 0) {
+    return 0;
+  }
+
+  memcpy(tokenizer->string + tokenizer->position, string, length);
+  tokenizer->position += length;
+
+  tokenizer->string[tokenizer->position] = '\0';
+
+  return 1;
+}
+
+
+
+
+int st_append_char(struct StringTokenizer *tokenizer, const char token) {
+
+  if (st_expand_string(tokenizer, 1) == 0) {
+    return 0;
+  }
+  tokenizer->string[tokenizer->position++] = token;
+
+  tokenizer->string[tokenizer->position] = '\0';
+  return 1;
+}
+
+
+
+
+int st_append_many(struct StringTokenizer *tokenizer, const struct StringView *fragments, const size_t count) {
+
+  size_t length = 0;
+  for (size_t i = 0; i < count; i++) {
+    length += fragments[i].len;
+  }
+  if (st_expand_string(tokenizer, length) == 0) {
+    return 0;
+  }
+
+  char *destination = tokenizer->string + tokenizer->position;
+  for (size_t i = 0; i < count; i++) {
+    memcpy(destination, fragments[i].ptr, fragments[i].len);
+    destination += fragments[i].len;
+  }
+  tokenizer->position += length;
+
+  tokenizer->string[tokenizer->position] = '\0';
+  return 1;
+}
+
+
+
+
+int st_append_string(struct StringTokenizer *tokenizer, const char *string) {
+  return st_append_n(tokenizer, string, strlen(string));
+}
+
+
+
+
+int st_append_quoted_string(struct StringTokenizer *tokenizer, const char *string) {
+  struct StringView fragments[] = {{"\"", 1}, {string, strlen(string)}, {"\"", 1}};
+  return st_append_many(tokenizer, fragments, sizeof(fragments) / sizeof(fragments[0]));
+}
+
+
+
+
+int st_append_escaped_n(struct StringTokenizer *tokenizer, const char *string, const size_t length) {
+  static const char hex_digits[] = "0123456789abcdef";
+
+  if (st_expand_string(tokenizer, length + 2) == 0) {
+    return 0;
+  }
+  tokenizer->string[tokenizer->position++] = '"';
+  size_t index = 0;
+  while (index < length) {
+
+    size_t run = st_scan_escape(string + index, length - index);
+    if (st_expand_string(tokenizer, run + 6 + 1) == 0) {
+      return 0;
+    }
+    memcpy(tokenizer->string + tokenizer->position, string + index, run);
+    tokenizer->position += run;
+    index += run;
+    if (index == length) {
+      break;
+    }
+
+    char *destination = tokenizer->string + tokenizer->position;
+    unsigned char token = (unsigned char)string[index++];
+    destination[0] = '\\';
+    switch (token) {
+      case '"':
+      case '\\':
+        destination[1] = (char)token;
+        break;
+      case '\b':
+        destination[1] = 'b';
+        break;
+      case '\f':
+        destination[1] = 'f';
+        break;
+      case '\n':
+        destination[1] = 'n';
+        break;
+      case '\r':
+        destination[1] = 'r';
+        break;
+      case '\t':
+        destination[1] = 't';
+        break;
+      default:
+        memcpy(destination + 1, "u00", 3);
+        destination[4] = hex_digits[token >> 4];
+        destination[5] = hex_digits[token & 0xF];
+        tokenizer->position += 6;
+        continue;
+    }
+    tokenizer->position += 2;
+  }
+  tokenizer->string[tokenizer->position++] = '"';
+
+  tokenizer->string[tokenizer->position] = '\0';
+  return 1;
+}
+
+
+
+
+int st_append_escaped_string(struct StringTokenizer *tokenizer, const char *string) {
+  return st_append_escaped_n(tokenizer, string, strlen(string));
+}
+
+
+
+
+int st_append_int(struct StringTokenizer *tokenizer, const int64_t value) {
+
+  if (st_expand_string(tokenizer, 21) == 0) {
+    return 0;
+  }
+
+  uint64_t start = st_stats_clock(tokenizer);
+  tokenizer->position += i64tos_to(tokenizer->string + tokenizer->position, value);
+  do { if ((start) != 0) { do { st_stats_add((tokenizer), 
+# 876 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 876 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 876 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 876 "/root/repo/src/string_tokenizer.c"
+ conversions
+# 876 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 876 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0); do { st_stats_add((tokenizer), 
+# 876 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 876 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 876 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 876 "/root/repo/src/string_tokenizer.c"
+ conversion_ns
+# 876 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 876 "/root/repo/src/string_tokenizer.c"
+ , (st_stats_clock(tokenizer) - (start))); do { } while (0); } while (0); } } while (0);
+  return 1;
+}
+
+
+
+
+int st_append_double(struct StringTokenizer *tokenizer, const double *value) {
+
+  if (st_expand_string(tokenizer, 32) == 0) {
+    return 0;
+  }
+
+  uint64_t start = st_stats_clock(tokenizer);
+  tokenizer->position += dtos_to(tokenizer->string + tokenizer->position, *value);
+  do { if ((start) != 0) { do { st_stats_add((tokenizer), 
+# 891 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 891 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 891 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 891 "/root/repo/src/string_tokenizer.c"
+ conversions
+# 891 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 891 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0); do { st_stats_add((tokenizer), 
+# 891 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 891 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 891 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 891 "/root/repo/src/string_tokenizer.c"
+ conversion_ns
+# 891 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 891 "/root/repo/src/string_tokenizer.c"
+ , (st_stats_clock(tokenizer) - (start))); do { } while (0); } while (0); } } while (0);
+  return 1;
+}
+
+
+
+
+int st_append_double_precision(struct StringTokenizer *tokenizer, const double *value, const int precision) {
+
+  if (st_expand_string(tokenizer, 32) == 0) {
+    return 0;
+  }
+
+  uint64_t start = st_stats_clock(tokenizer);
+  tokenizer->position += dtos_precision_to(tokenizer->string + tokenizer->position, *value, precision);
+  do { if ((start) != 0) { do { st_stats_add((tokenizer), 
+# 906 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 906 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 906 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 906 "/root/repo/src/string_tokenizer.c"
+ conversions
+# 906 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 906 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0); do { st_stats_add((tokenizer), 
+# 906 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 906 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 906 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 906 "/root/repo/src/string_tokenizer.c"
+ conversion_ns
+# 906 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 906 "/root/repo/src/string_tokenizer.c"
+ , (st_stats_clock(tokenizer) - (start))); do { } while (0); } while (0); } } while (0);
+  return 1;
+}
+
+
+
+
+int st_append_fixed(struct StringTokenizer *tokenizer, const double *value, const int precision) {
+
+  char buffer[(1 + 309 + 1 + 20 + 1)];
+  uint64_t start = st_stats_clock(tokenizer);
+  size_t length = dtos_fixed_to(buffer, *value, precision);
+  do { if ((start) != 0) { do { st_stats_add((tokenizer), 
+# 918 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 918 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 918 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 918 "/root/repo/src/string_tokenizer.c"
+ conversions
+# 918 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 918 "/root/repo/src/string_tokenizer.c"
+ , (1)); do { } while (0); } while (0); do { st_stats_add((tokenizer), 
+# 918 "/root/repo/src/string_tokenizer.c" 3 4
+ __builtin_offsetof (
+# 918 "/root/repo/src/string_tokenizer.c"
+ struct StringStats
+# 918 "/root/repo/src/string_tokenizer.c" 3 4
+ , 
+# 918 "/root/repo/src/string_tokenizer.c"
+ conversion_ns
+# 918 "/root/repo/src/string_tokenizer.c" 3 4
+ )
+# 918 "/root/repo/src/string_tokenizer.c"
+ , (st_stats_clock(tokenizer) - (start))); do { } while (0); } while (0); } } while (0);
+  return st_append_n(tokenizer, buffer, length);
+}
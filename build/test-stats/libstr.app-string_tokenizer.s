@@ -0,0 +1,18135 @@
+	.file	"string_tokenizer.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/src/string_tokenizer.c"
+	.p2align 4
+	.globl	st_init
+	.type	st_init, @function
+st_init:
+.LVL0:
+.LFB27:
+	.file 1 "/root/repo/src/string_tokenizer.c"
+	.loc 1 34 84 view -0
+	.cfi_startproc
+	.loc 1 35 3 view .LVU1
+	.loc 1 35 21 is_stmt 0 view .LVU2
+	movq	%rsi, (%rdi)
+	.loc 1 36 3 is_stmt 1 view .LVU3
+	.loc 1 36 21 is_stmt 0 view .LVU4
+	movq	%rdx, 8(%rdi)
+	.loc 1 37 3 is_stmt 1 view .LVU5
+	.loc 1 37 23 is_stmt 0 view .LVU6
+	movq	$0, 16(%rdi)
+	.loc 1 38 3 is_stmt 1 view .LVU7
+	.loc 1 38 33 is_stmt 0 view .LVU8
+	movq	$0, 24(%rdi)
+	.loc 1 39 3 is_stmt 1 view .LVU9
+	.loc 1 39 28 is_stmt 0 view .LVU10
+	movl	$0, 32(%rdi)
+	.loc 1 40 3 is_stmt 1 view .LVU11
+	.loc 1 40 28 is_stmt 0 view .LVU12
+	movq	$0, 40(%rdi)
+	.loc 1 41 3 is_stmt 1 view .LVU13
+	.loc 1 41 21 is_stmt 0 view .LVU14
+	movq	$0, 48(%rdi)
+	.loc 1 42 3 is_stmt 1 view .LVU15
+	.loc 1 42 24 is_stmt 0 view .LVU16
+	movl	$0, 56(%rdi)
+	.loc 1 43 3 is_stmt 1 view .LVU17
+	.loc 1 43 20 is_stmt 0 view .LVU18
+	movq	$0, 64(%rdi)
+	.loc 1 44 3 is_stmt 1 view .LVU19
+	.loc 1 44 31 is_stmt 0 view .LVU20
+	movq	$0, 328(%rdi)
+	.loc 1 45 3 is_stmt 1 view .LVU21
+	.loc 1 45 20 is_stmt 0 view .LVU22
+	movq	$0, 336(%rdi)
+	.loc 1 46 1 view .LVU23
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	st_init, .-st_init
+	.p2align 4
+	.globl	st_create_n
+	.type	st_create_n, @function
+st_create_n:
+.LVL1:
+.LFB28:
+	.loc 1 51 72 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 52 3 view .LVU25
+	.loc 1 51 72 is_stmt 0 view .LVU26
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 52 6 view .LVU27
+	testq	%rdi, %rdi
+	je	.L7
+	movq	%rsi, %r12
+	testq	%rsi, %rsi
+	je	.L7
+	movq	%rdi, %rbp
+	.loc 1 55 3 is_stmt 1 view .LVU28
+.LVL2:
+	.loc 1 56 3 view .LVU29
+	.loc 1 56 65 is_stmt 0 view .LVU30
+	movl	$344, %edi
+.LVL3:
+	.loc 1 56 65 view .LVU31
+	call	malloc@PLT
+.LVL4:
+	.loc 1 56 65 view .LVU32
+	movq	%rax, %rbx
+.LVL5:
+	.loc 1 57 3 is_stmt 1 view .LVU33
+	.loc 1 57 8 view .LVU34
+	xorl	%edi, %edi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL6:
+	.loc 1 57 10 view .LVU35
+	.loc 1 57 15 view .LVU36
+	.loc 1 57 13 view .LVU37
+	.loc 1 57 6 view .LVU38
+	.loc 1 58 3 view .LVU39
+	.loc 1 58 6 is_stmt 0 view .LVU40
+	testq	%rbx, %rbx
+	je	.L7
+	.loc 1 59 5 is_stmt 1 view .LVU41
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	st_init@PLT
+.LVL7:
+	.loc 1 62 1 is_stmt 0 view .LVU42
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL8:
+	.loc 1 62 1 view .LVU43
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL9:
+	.loc 1 62 1 view .LVU44
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL10:
+	.loc 1 62 1 view .LVU45
+	ret
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.cfi_restore_state
+	.loc 1 53 11 view .LVU46
+	xorl	%ebx, %ebx
+	.loc 1 62 1 view .LVU47
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	st_create_n, .-st_create_n
+	.p2align 4
+	.globl	st_create
+	.type	st_create, @function
+st_create:
+.LVL12:
+.LFB26:
+	.loc 1 24 49 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 25 3 view .LVU49
+	.loc 1 25 6 is_stmt 0 view .LVU50
+	testq	%rdi, %rdi
+	je	.L13
+	.loc 1 24 49 view .LVU51
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 28 3 is_stmt 1 view .LVU52
+	.loc 1 28 10 is_stmt 0 view .LVU53
+	call	strlen@PLT
+.LVL13:
+	.loc 1 28 10 view .LVU54
+	movq	%rax, %rsi
+	movq	%rbx, %rdi
+	.loc 1 29 1 view .LVU55
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL14:
+	.loc 1 28 10 view .LVU56
+	jmp	st_create_n@PLT
+.LVL15:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 29 1 view .LVU57
+	xorl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	st_create, .-st_create
+	.p2align 4
+	.globl	st_create_empty
+	.type	st_create_empty, @function
+st_create_empty:
+.LVL16:
+.LFB29:
+	.loc 1 67 67 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 68 3 view .LVU59
+	.loc 1 67 67 is_stmt 0 view .LVU60
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 68 23 view .LVU61
+	leaq	-1(%rdi), %rax
+	.loc 1 67 67 view .LVU62
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 68 6 view .LVU63
+	cmpq	$254, %rax
+	jbe	.L29
+	.loc 1 81 3 is_stmt 1 view .LVU64
+	.loc 1 81 26 is_stmt 0 view .LVU65
+	leaq	1(%rdi), %rdi
+.LVL17:
+	.loc 1 81 26 view .LVU66
+	call	malloc@PLT
+.LVL18:
+	movq	%rax, %r12
+.LVL19:
+	.loc 1 82 3 is_stmt 1 view .LVU67
+	.loc 1 82 8 view .LVU68
+	xorl	%edi, %edi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL20:
+	.loc 1 82 10 view .LVU69
+	.loc 1 82 15 view .LVU70
+	.loc 1 82 13 view .LVU71
+	.loc 1 82 6 view .LVU72
+	.loc 1 83 3 view .LVU73
+	.loc 1 83 6 is_stmt 0 view .LVU74
+	testq	%r12, %r12
+	je	.L19
+	.loc 1 87 3 is_stmt 1 view .LVU75
+	.loc 1 87 13 is_stmt 0 view .LVU76
+	movb	$0, (%r12)
+	.loc 1 88 3 is_stmt 1 view .LVU77
+	.loc 1 88 23 is_stmt 0 view .LVU78
+	movb	$0, (%r12,%rbp)
+	.loc 1 89 3 is_stmt 1 view .LVU79
+	.loc 1 89 39 is_stmt 0 view .LVU80
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	st_create_n@PLT
+.LVL21:
+	movq	%rax, %rbx
+.LVL22:
+	.loc 1 90 3 is_stmt 1 view .LVU81
+	.loc 1 90 6 is_stmt 0 view .LVU82
+	testq	%rax, %rax
+	je	.L30
+	.loc 1 95 3 is_stmt 1 view .LVU83
+	.loc 1 95 33 is_stmt 0 view .LVU84
+	movq	%rbp, 24(%rax)
+	.loc 1 96 3 is_stmt 1 view .LVU85
+	.loc 1 96 24 is_stmt 0 view .LVU86
+	movl	$1, 56(%rax)
+	.loc 1 98 3 is_stmt 1 view .LVU87
+.LVL23:
+.L17:
+	.loc 1 99 1 is_stmt 0 view .LVU88
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL24:
+	.loc 1 99 1 view .LVU89
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL25:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.cfi_restore_state
+.LBB17:
+.LBI17:
+	.loc 1 67 25 is_stmt 1 view .LVU90
+.LBB18:
+.LBB19:
+	.loc 1 70 5 view .LVU91
+	.loc 1 70 67 is_stmt 0 view .LVU92
+	movl	$344, %edi
+.LVL26:
+	.loc 1 70 67 view .LVU93
+	call	malloc@PLT
+.LVL27:
+	movq	%rax, %rbx
+.LVL28:
+	.loc 1 71 5 is_stmt 1 view .LVU94
+	.loc 1 71 10 view .LVU95
+	xorl	%edi, %edi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL29:
+	.loc 1 71 12 view .LVU96
+	.loc 1 71 17 view .LVU97
+	.loc 1 71 15 view .LVU98
+	.loc 1 71 8 view .LVU99
+	.loc 1 72 5 view .LVU100
+	.loc 1 72 8 is_stmt 0 view .LVU101
+	testq	%rbx, %rbx
+	je	.L19
+	.loc 1 73 7 is_stmt 1 view .LVU102
+	.loc 1 73 35 is_stmt 0 view .LVU103
+	leaq	72(%rbx), %rsi
+	.loc 1 73 7 view .LVU104
+	movq	%rbx, %rdi
+	movl	$255, %edx
+	call	st_init@PLT
+.LVL30:
+	.loc 1 74 7 is_stmt 1 view .LVU105
+	.loc 1 74 35 is_stmt 0 view .LVU106
+	movb	$0, 72(%rbx)
+	.loc 1 75 7 is_stmt 1 view .LVU107
+	.loc 1 75 37 is_stmt 0 view .LVU108
+	movq	%rbp, 24(%rbx)
+	.loc 1 76 7 is_stmt 1 view .LVU109
+	.loc 1 76 28 is_stmt 0 view .LVU110
+	movl	$3, 56(%rbx)
+.LBE19:
+.LBE18:
+.LBE17:
+	.loc 1 99 1 view .LVU111
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL31:
+	.loc 1 99 1 view .LVU112
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL32:
+	.loc 1 99 1 view .LVU113
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.cfi_restore_state
+	.loc 1 91 5 is_stmt 1 view .LVU114
+	movq	%r12, %rdi
+	call	free@PLT
+.LVL34:
+	.loc 1 92 5 view .LVU115
+.L19:
+	.loc 1 84 11 is_stmt 0 view .LVU116
+	xorl	%ebx, %ebx
+	jmp	.L17
+	.cfi_endproc
+.LFE29:
+	.size	st_create_empty, .-st_create_empty
+	.p2align 4
+	.globl	st_destroy
+	.type	st_destroy, @function
+st_destroy:
+.LVL35:
+.LFB31:
+	.loc 1 128 52 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 129 3 view .LVU118
+	.loc 1 128 52 is_stmt 0 view .LVU119
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 128 52 view .LVU120
+	movq	%rdi, %rbx
+	.loc 1 129 6 view .LVU121
+	testq	%rdi, %rdi
+	je	.L33
+	.loc 1 130 5 is_stmt 1 view .LVU122
+.LVL36:
+.LBB22:
+.LBI22:
+	.loc 1 107 13 view .LVU123
+.LBB23:
+	.loc 1 108 3 view .LVU124
+	call	st_drop_structural_index@PLT
+.LVL37:
+	.loc 1 109 3 view .LVU125
+	.loc 1 109 6 is_stmt 0 view .LVU126
+	cmpq	$0, 48(%rbx)
+	je	.L34
+	.loc 1 111 5 is_stmt 1 view .LVU127
+	movq	(%rbx), %rdi
+	call	free@PLT
+.LVL38:
+	.loc 1 112 5 view .LVU128
+	movq	48(%rbx), %rdi
+	call	free@PLT
+.LVL39:
+	.loc 1 113 5 view .LVU129
+.L33:
+	.loc 1 113 5 is_stmt 0 view .LVU130
+.LBE23:
+.LBE22:
+	.loc 1 132 3 is_stmt 1 view .LVU131
+	movq	%rbx, %rdi
+	.loc 1 134 1 is_stmt 0 view .LVU132
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL40:
+	.loc 1 132 3 view .LVU133
+	jmp	free@PLT
+.LVL41:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.cfi_restore_state
+.LBB25:
+.LBB24:
+	.loc 1 115 8 is_stmt 1 view .LVU134
+	.loc 1 115 21 is_stmt 0 view .LVU135
+	movl	56(%rbx), %eax
+	.loc 1 115 11 view .LVU136
+	cmpl	$1, %eax
+	je	.L38
+	.loc 1 118 8 is_stmt 1 view .LVU137
+	.loc 1 118 11 is_stmt 0 view .LVU138
+	cmpl	$2, %eax
+	jne	.L33
+	.loc 1 119 5 is_stmt 1 view .LVU139
+	movq	8(%rbx), %rsi
+	movq	(%rbx), %rdi
+	call	munmap@PLT
+.LVL42:
+	jmp	.L33
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.loc 1 116 5 view .LVU140
+	movq	(%rbx), %rdi
+	call	free@PLT
+.LVL43:
+	jmp	.L33
+.LBE24:
+.LBE25:
+	.cfi_endproc
+.LFE31:
+	.size	st_destroy, .-st_destroy
+	.p2align 4
+	.globl	st_reset
+	.type	st_reset, @function
+st_reset:
+.LVL44:
+.LFB32:
+	.loc 1 139 50 view -0
+	.cfi_startproc
+	.loc 1 140 3 view .LVU142
+	.loc 1 141 47 is_stmt 0 view .LVU143
+	movl	56(%rdi), %eax
+	.loc 1 140 23 view .LVU144
+	movq	$0, 16(%rdi)
+	.loc 1 141 3 is_stmt 1 view .LVU145
+	.loc 1 141 47 is_stmt 0 view .LVU146
+	andl	$-3, %eax
+	.loc 1 141 6 view .LVU147
+	cmpl	$1, %eax
+	je	.L42
+	.loc 1 146 1 view .LVU148
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L42:
+.LVL45:
+.LBB28:
+.LBI28:
+	.loc 1 139 6 is_stmt 1 view .LVU149
+.LBB29:
+	.loc 1 143 5 view .LVU150
+	.loc 1 143 14 is_stmt 0 view .LVU151
+	movq	(%rdi), %rax
+	.loc 1 143 26 view .LVU152
+	movb	$0, (%rax)
+	.loc 1 144 5 is_stmt 1 view .LVU153
+	jmp	st_drop_structural_index@PLT
+.LVL46:
+	.loc 1 144 5 is_stmt 0 view .LVU154
+.LBE29:
+.LBE28:
+	.cfi_endproc
+.LFE32:
+	.size	st_reset, .-st_reset
+	.p2align 4
+	.globl	st_rebind
+	.type	st_rebind, @function
+st_rebind:
+.LVL47:
+.LFB33:
+	.loc 1 151 85 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 152 3 view .LVU156
+	.loc 1 153 12 is_stmt 0 view .LVU157
+	xorl	%eax, %eax
+	.loc 1 152 6 view .LVU158
+	cmpq	$0, 48(%rdi)
+	je	.L54
+	.loc 1 160 1 view .LVU159
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.loc 1 151 85 discriminator 1 view .LVU160
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 152 50 discriminator 1 view .LVU161
+	testq	%rsi, %rsi
+	je	.L49
+	.loc 1 152 50 discriminator 1 view .LVU162
+	movq	%rdx, %r12
+	testq	%rdx, %rdx
+	je	.L49
+	.loc 1 152 50 discriminator 1 view .LVU163
+	movq	%rdi, %rbx
+	.loc 1 155 3 is_stmt 1 view .LVU164
+.LVL48:
+.LBB32:
+.LBI32:
+	.loc 1 107 13 view .LVU165
+.LBB33:
+	.loc 1 108 3 view .LVU166
+	call	st_drop_structural_index@PLT
+.LVL49:
+	.loc 1 109 3 view .LVU167
+	.loc 1 109 6 is_stmt 0 view .LVU168
+	cmpq	$0, 48(%rbx)
+	je	.L45
+	.loc 1 111 5 is_stmt 1 view .LVU169
+	movq	(%rbx), %rdi
+	call	free@PLT
+.LVL50:
+	.loc 1 112 5 view .LVU170
+	movq	48(%rbx), %rdi
+	call	free@PLT
+.LVL51:
+	.loc 1 113 5 view .LVU171
+	.loc 1 113 23 is_stmt 0 view .LVU172
+	movq	$0, 48(%rbx)
+.L46:
+	.loc 1 121 3 is_stmt 1 view .LVU173
+	.loc 1 122 3 view .LVU174
+	.loc 1 122 24 is_stmt 0 view .LVU175
+	movl	$0, 56(%rbx)
+.LVL52:
+	.loc 1 122 24 view .LVU176
+.LBE33:
+.LBE32:
+	.loc 1 156 3 is_stmt 1 view .LVU177
+	.loc 1 156 21 is_stmt 0 view .LVU178
+	movq	%rbp, (%rbx)
+	.loc 1 157 3 is_stmt 1 view .LVU179
+	.loc 1 157 21 is_stmt 0 view .LVU180
+	movq	%r12, 8(%rbx)
+	.loc 1 158 3 is_stmt 1 view .LVU181
+	.loc 1 158 23 is_stmt 0 view .LVU182
+	movq	$0, 16(%rbx)
+	.loc 1 159 3 is_stmt 1 view .LVU183
+	.loc 1 159 10 is_stmt 0 view .LVU184
+	movl	$1, %eax
+	.loc 1 160 1 view .LVU185
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL53:
+	.loc 1 160 1 view .LVU186
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL54:
+	.loc 1 160 1 view .LVU187
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL55:
+	.loc 1 160 1 view .LVU188
+	ret
+.LVL56:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.cfi_restore_state
+	.loc 1 160 1 view .LVU189
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	.loc 1 153 12 view .LVU190
+	xorl	%eax, %eax
+	.loc 1 160 1 view .LVU191
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL57:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.cfi_restore_state
+.LBB35:
+.LBB34:
+	.loc 1 115 8 is_stmt 1 view .LVU192
+	.loc 1 115 21 is_stmt 0 view .LVU193
+	movl	56(%rbx), %eax
+	.loc 1 115 11 view .LVU194
+	cmpl	$1, %eax
+	je	.L55
+	.loc 1 118 8 is_stmt 1 view .LVU195
+	.loc 1 118 11 is_stmt 0 view .LVU196
+	cmpl	$2, %eax
+	jne	.L46
+	.loc 1 119 5 is_stmt 1 view .LVU197
+	movq	8(%rbx), %rsi
+	movq	(%rbx), %rdi
+	call	munmap@PLT
+.LVL58:
+	jmp	.L46
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.loc 1 116 5 view .LVU198
+	movq	(%rbx), %rdi
+	call	free@PLT
+.LVL59:
+	jmp	.L46
+.LBE34:
+.LBE35:
+	.cfi_endproc
+.LFE33:
+	.size	st_rebind, .-st_rebind
+	.p2align 4
+	.globl	st_detach_string
+	.type	st_detach_string, @function
+st_detach_string:
+.LVL60:
+.LFB34:
+	.loc 1 165 59 view -0
+	.cfi_startproc
+	.loc 1 166 3 view .LVU200
+	.loc 1 165 59 is_stmt 0 view .LVU201
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 167 16 view .LVU202
+	movl	56(%rdi), %eax
+	.loc 1 166 9 view .LVU203
+	movq	(%rdi), %rbp
+.LVL61:
+	.loc 1 167 3 is_stmt 1 view .LVU204
+	.loc 1 167 6 is_stmt 0 view .LVU205
+	cmpl	$3, %eax
+	je	.L62
+	.loc 1 175 8 is_stmt 1 view .LVU206
+	.loc 1 175 11 is_stmt 0 view .LVU207
+	cmpl	$1, %eax
+	je	.L60
+.LVL62:
+.L56:
+	.loc 1 187 1 view .LVU208
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL63:
+	.loc 1 187 1 view .LVU209
+	movq	%rbp, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL64:
+	.loc 1 187 1 view .LVU210
+	ret
+.LVL65:
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	.cfi_restore_state
+.LBB36:
+	.loc 1 169 5 is_stmt 1 view .LVU211
+	.loc 1 169 23 is_stmt 0 view .LVU212
+	movq	16(%rdi), %rax
+	.loc 1 170 14 view .LVU213
+	movq	%rsp, %rdi
+	.loc 1 169 23 view .LVU214
+	movq	%rbp, (%rsp)
+	movq	%rax, 8(%rsp)
+	.loc 1 170 5 is_stmt 1 view .LVU215
+	.loc 1 170 14 is_stmt 0 view .LVU216
+	call	sv_to_string@PLT
+.LVL66:
+	movq	%rax, %rbp
+.LVL67:
+	.loc 1 171 5 is_stmt 1 view .LVU217
+	.loc 1 171 8 is_stmt 0 view .LVU218
+	testq	%rax, %rax
+	je	.L56
+.LVL68:
+.L60:
+	.loc 1 171 8 view .LVU219
+.LBE36:
+	.loc 1 180 3 is_stmt 1 view .LVU220
+	movq	%rbx, %rdi
+	call	st_drop_structural_index@PLT
+.LVL69:
+	.loc 1 181 3 view .LVU221
+	.loc 1 181 23 is_stmt 0 view .LVU222
+	leaq	72(%rbx), %rax
+	movq	%rax, (%rbx)
+	.loc 1 182 3 is_stmt 1 view .LVU223
+	.loc 1 182 21 is_stmt 0 view .LVU224
+	movq	$255, 8(%rbx)
+	.loc 1 183 3 is_stmt 1 view .LVU225
+	.loc 1 183 23 is_stmt 0 view .LVU226
+	movq	$0, 16(%rbx)
+	.loc 1 184 3 is_stmt 1 view .LVU227
+	.loc 1 184 31 is_stmt 0 view .LVU228
+	movb	$0, 72(%rbx)
+	.loc 1 185 3 is_stmt 1 view .LVU229
+	.loc 1 185 24 is_stmt 0 view .LVU230
+	movl	$3, 56(%rbx)
+	.loc 1 186 3 is_stmt 1 view .LVU231
+	.loc 1 187 1 is_stmt 0 view .LVU232
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL70:
+	.loc 1 187 1 view .LVU233
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL71:
+	.loc 1 187 1 view .LVU234
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	st_detach_string, .-st_detach_string
+	.p2align 4
+	.globl	st_pool_release
+	.type	st_pool_release, @function
+st_pool_release:
+.LVL72:
+.LFB36:
+	.loc 1 207 57 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 208 3 view .LVU236
+	.loc 1 208 6 is_stmt 0 view .LVU237
+	testq	%rdi, %rdi
+	je	.L72
+	.loc 1 207 57 view .LVU238
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	.loc 1 211 3 is_stmt 1 view .LVU239
+.LVL73:
+	.loc 1 212 3 view .LVU240
+	.loc 1 207 57 is_stmt 0 view .LVU241
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 211 57 view .LVU242
+	movl	56(%rdi), %eax
+	andl	$-3, %eax
+	.loc 1 212 6 view .LVU243
+	cmpl	$1, %eax
+	jne	.L65
+	.loc 1 212 20 discriminator 1 view .LVU244
+	cmpq	$0, 48(%rdi)
+	je	.L75
+.LVL74:
+.L65:
+	.loc 1 213 5 is_stmt 1 view .LVU245
+	.loc 1 224 1 is_stmt 0 view .LVU246
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 213 5 view .LVU247
+	movq	%rbx, %rdi
+	.loc 1 224 1 view .LVU248
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL75:
+	.loc 1 224 1 view .LVU249
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	.loc 1 213 5 view .LVU250
+	jmp	st_destroy@PLT
+.LVL76:
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	.cfi_restore_state
+	.loc 1 212 79 discriminator 2 view .LVU251
+	leaq	string_tokenizer_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL77:
+	.loc 1 212 48 discriminator 2 view .LVU252
+	cmpq	$8, string_tokenizer_pool_count@dtpoff(%rax)
+	.loc 1 212 79 discriminator 2 view .LVU253
+	movq	%rax, %rbp
+	.loc 1 212 48 discriminator 2 view .LVU254
+	je	.L65
+	.loc 1 217 3 is_stmt 1 view .LVU255
+	movq	%rbx, %rdi
+	call	st_reset@PLT
+.LVL78:
+	.loc 1 218 3 view .LVU256
+	.loc 1 220 3 is_stmt 0 view .LVU257
+	movq	8(%rbx), %rdx
+	movq	(%rbx), %rsi
+	movq	%rbx, %rdi
+	.loc 1 218 24 view .LVU258
+	movl	56(%rbx), %r13d
+.LVL79:
+	.loc 1 219 3 is_stmt 1 view .LVU259
+	.loc 1 219 10 is_stmt 0 view .LVU260
+	movq	24(%rbx), %r12
+.LVL80:
+	.loc 1 220 3 is_stmt 1 view .LVU261
+	call	st_init@PLT
+.LVL81:
+	.loc 1 221 3 view .LVU262
+	.loc 1 223 52 is_stmt 0 view .LVU263
+	movq	string_tokenizer_pool_count@dtpoff(%rbp), %rax
+	.loc 1 221 24 view .LVU264
+	movl	%r13d, 56(%rbx)
+	.loc 1 222 3 is_stmt 1 view .LVU265
+	.loc 1 223 52 is_stmt 0 view .LVU266
+	leaq	1(%rax), %rdx
+	.loc 1 222 33 view .LVU267
+	movq	%r12, 24(%rbx)
+	.loc 1 223 3 is_stmt 1 view .LVU268
+	.loc 1 223 52 is_stmt 0 view .LVU269
+	movq	%rdx, string_tokenizer_pool_count@dtpoff(%rbp)
+	.loc 1 223 56 view .LVU270
+	movq	%rbx, string_tokenizer_pool@dtpoff(%rbp,%rax,8)
+	.loc 1 224 1 view .LVU271
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL82:
+	.loc 1 224 1 view .LVU272
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL83:
+	.loc 1 224 1 view .LVU273
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL84:
+	.loc 1 224 1 view .LVU274
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL85:
+	.loc 1 224 1 view .LVU275
+	ret
+.LVL86:
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.loc 1 224 1 view .LVU276
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	st_pool_release, .-st_pool_release
+	.p2align 4
+	.globl	st_pool_clear
+	.type	st_pool_clear, @function
+st_pool_clear:
+.LFB37:
+	.loc 1 229 26 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 230 3 view .LVU278
+	.loc 1 230 38 view .LVU279
+	.loc 1 229 26 is_stmt 0 view .LVU280
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 230 38 view .LVU281
+	leaq	string_tokenizer_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL87:
+	movq	string_tokenizer_pool_count@dtpoff(%rax), %rax
+	testq	%rax, %rax
+	je	.L83
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.loc 1 231 5 is_stmt 1 view .LVU282
+	.loc 1 231 38 is_stmt 0 view .LVU283
+	leaq	-1(%rax), %rbx
+	.loc 1 231 5 view .LVU284
+	leaq	string_tokenizer_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL88:
+	movq	string_tokenizer_pool@dtpoff(%rax,%rbx,8), %rdi
+	movq	%rax, %rbp
+	movq	%rbx, string_tokenizer_pool_count@dtpoff(%rax)
+	call	st_destroy@PLT
+.LVL89:
+	.loc 1 230 38 is_stmt 1 view .LVU285
+	movq	string_tokenizer_pool_count@dtpoff(%rbp), %rax
+	testq	%rax, %rax
+	jne	.L78
+.L83:
+	.loc 1 233 1 is_stmt 0 view .LVU286
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	st_pool_clear, .-st_pool_clear
+	.p2align 4
+	.globl	st_attach_arena
+	.type	st_attach_arena, @function
+st_attach_arena:
+.LVL90:
+.LFB38:
+	.loc 1 238 84 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 239 3 view .LVU288
+	.loc 1 239 20 is_stmt 0 view .LVU289
+	movq	%rsi, 64(%rdi)
+	.loc 1 240 1 view .LVU290
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	st_attach_arena, .-st_attach_arena
+	.p2align 4
+	.globl	st_attach_stats
+	.type	st_attach_stats, @function
+st_attach_stats:
+.LVL91:
+.LFB39:
+	.loc 1 245 84 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 246 3 view .LVU292
+	.loc 1 246 20 is_stmt 0 view .LVU293
+	movq	%rsi, 336(%rdi)
+	.loc 1 247 1 view .LVU294
+	ret
+	.cfi_endproc
+.LFE39:
+	.size	st_attach_stats, .-st_attach_stats
+	.p2align 4
+	.globl	st_next_token
+	.type	st_next_token, @function
+st_next_token:
+.LVL92:
+.LFB42:
+	.loc 1 290 55 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 292 3 view .LVU296
+	.loc 1 290 55 is_stmt 0 view .LVU297
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 290 55 view .LVU298
+	movq	%rdi, %rbx
+	.loc 1 292 30 view .LVU299
+	movq	16(%rdi), %r12
+	.loc 1 293 33 view .LVU300
+	movq	328(%rdi), %rdi
+.LVL93:
+	.loc 1 294 43 view .LVU301
+	movq	8(%rbx), %rsi
+	.loc 1 292 10 view .LVU302
+	leaq	1(%r12), %rbp
+.LVL94:
+	.loc 1 293 3 is_stmt 1 view .LVU303
+	.loc 1 294 3 view .LVU304
+	.loc 1 294 6 is_stmt 0 view .LVU305
+	testq	%rdi, %rdi
+	je	.L89
+	.loc 1 294 20 discriminator 1 view .LVU306
+	cmpq	%rsi, %rbp
+	jb	.L104
+.LVL95:
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	.loc 1 309 5 is_stmt 1 view .LVU307
+	.loc 1 310 8 is_stmt 0 view .LVU308
+	cmpq	$0, 48(%rbx)
+	.loc 1 309 25 view .LVU309
+	movq	%rsi, 16(%rbx)
+	.loc 1 310 5 is_stmt 1 view .LVU310
+	.loc 1 310 8 is_stmt 0 view .LVU311
+	je	.L102
+	.loc 1 310 37 discriminator 1 view .LVU312
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	st_ensure@PLT
+.LVL96:
+	.loc 1 310 34 discriminator 1 view .LVU313
+	testl	%eax, %eax
+	je	.L102
+	.loc 1 313 5 is_stmt 1 view .LVU314
+	.loc 1 313 14 is_stmt 0 view .LVU315
+	movq	16(%rbx), %rbp
+.LVL97:
+	.loc 1 300 9 is_stmt 1 view .LVU316
+	.loc 1 302 29 is_stmt 0 view .LVU317
+	movq	8(%rbx), %rsi
+.L89:
+	.loc 1 300 3 is_stmt 1 view .LVU318
+	.loc 1 302 5 view .LVU319
+	.loc 1 302 8 is_stmt 0 view .LVU320
+	cmpq	%rsi, %rbp
+	jnb	.L91
+	.loc 1 303 7 is_stmt 1 view .LVU321
+	.loc 1 303 60 is_stmt 0 view .LVU322
+	movq	(%rbx), %rdi
+	.loc 1 303 19 view .LVU323
+	subq	%rbp, %rsi
+	.loc 1 303 60 view .LVU324
+	addq	%rbp, %rdi
+	.loc 1 303 19 view .LVU325
+	call	st_scan_non_whitespace@PLT
+.LVL98:
+	.loc 1 304 31 view .LVU326
+	movq	8(%rbx), %rsi
+	.loc 1 303 16 view .LVU327
+	addq	%rax, %rbp
+.LVL99:
+	.loc 1 304 7 is_stmt 1 view .LVU328
+	.loc 1 304 10 is_stmt 0 view .LVU329
+	cmpq	%rsi, %rbp
+	jnb	.L91
+	.loc 1 315 3 is_stmt 1 view .LVU330
+	.loc 1 315 8 view .LVU331
+	movq	%rbp, %rdx
+	subq	16(%rbx), %rdx
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL100:
+	.loc 1 315 39 view .LVU332
+	.loc 1 315 44 view .LVU333
+	.loc 1 315 42 view .LVU334
+	.loc 1 315 6 view .LVU335
+	.loc 1 316 3 view .LVU336
+	.loc 1 316 23 is_stmt 0 view .LVU337
+	movq	%rbp, 16(%rbx)
+.L102:
+	.loc 1 317 1 view .LVU338
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL101:
+	.loc 1 317 1 view .LVU339
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL102:
+	.loc 1 317 1 view .LVU340
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL103:
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	.cfi_restore_state
+.LBB37:
+.LBI37:
+	.file 2 "/root/repo/src/../include/strutils.h"
+	.loc 2 202 19 is_stmt 1 discriminator 2 view .LVU341
+.LBB38:
+	.loc 2 203 3 discriminator 2 view .LVU342
+	.loc 2 203 3 is_stmt 0 discriminator 2 view .LVU343
+.LBE38:
+.LBE37:
+	.loc 1 294 83 discriminator 2 view .LVU344
+	movq	(%rbx), %rax
+	.loc 1 294 52 discriminator 2 view .LVU345
+	movq	st_char_classes@GOTPCREL(%rip), %rdx
+.LBB40:
+.LBB39:
+	.loc 2 203 26 discriminator 2 view .LVU346
+	movzbl	1(%rax,%r12), %eax
+.LBE39:
+.LBE40:
+	.loc 1 294 52 discriminator 2 view .LVU347
+	testb	$1, (%rdx,%rax)
+	je	.L89
+.LVL104:
+.LBB41:
+.LBI41:
+	.loc 2 1969 19 is_stmt 1 view .LVU348
+.LBB42:
+	.loc 2 1970 3 view .LVU349
+	.loc 2 1970 33 is_stmt 0 view .LVU350
+	movq	16(%rdi), %rax
+	.loc 2 1970 43 view .LVU351
+	movq	%rbp, %rdx
+	shrq	$6, %rdx
+	.loc 2 1970 49 view .LVU352
+	movq	(%rax,%rdx,8), %rax
+.LBE42:
+.LBE41:
+	.loc 1 294 116 view .LVU353
+	btq	%rbp, %rax
+	jc	.L89
+	.loc 1 296 5 is_stmt 1 view .LVU354
+	.loc 1 296 27 is_stmt 0 view .LVU355
+	movq	%rbp, %rsi
+	call	st_structural_next@PLT
+.LVL105:
+	.loc 1 296 25 view .LVU356
+	movq	%rax, 16(%rbx)
+	.loc 1 297 5 is_stmt 1 view .LVU357
+	.loc 1 297 10 view .LVU358
+	movq	%rbx, %rdi
+	subq	%r12, %rax
+	.loc 1 317 1 is_stmt 0 view .LVU359
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL106:
+	.loc 1 317 1 view .LVU360
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL107:
+	.loc 1 297 10 view .LVU361
+	movq	%rax, %rdx
+	xorl	%esi, %esi
+	.loc 1 317 1 view .LVU362
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL108:
+	.loc 1 297 10 view .LVU363
+	jmp	st_stats_add@PLT
+.LVL109:
+	.loc 1 297 10 view .LVU364
+	.cfi_endproc
+.LFE42:
+	.size	st_next_token, .-st_next_token
+	.p2align 4
+	.globl	st_current_token
+	.type	st_current_token, @function
+st_current_token:
+.LVL110:
+.LFB43:
+	.loc 1 322 58 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 323 3 view .LVU366
+	.loc 1 322 58 is_stmt 0 view .LVU367
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 323 7 view .LVU368
+	movl	$1, %esi
+	.loc 1 322 58 view .LVU369
+	movq	%rdi, %rbx
+	.loc 1 323 7 view .LVU370
+	call	st_ensure@PLT
+.LVL111:
+	.loc 1 323 7 view .LVU371
+	movl	%eax, %edx
+	xorl	%eax, %eax
+	.loc 1 323 6 view .LVU372
+	testl	%edx, %edx
+	je	.L105
+	.loc 1 327 3 is_stmt 1 view .LVU373
+	.loc 1 327 27 is_stmt 0 view .LVU374
+	movq	(%rbx), %rdx
+	movq	16(%rbx), %rax
+	movzbl	(%rdx,%rax), %eax
+.L105:
+	.loc 1 328 1 view .LVU375
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL112:
+	.loc 1 328 1 view .LVU376
+	ret
+	.cfi_endproc
+.LFE43:
+	.size	st_current_token, .-st_current_token
+	.p2align 4
+	.globl	st_sub_string_view
+	.type	st_sub_string_view, @function
+st_sub_string_view:
+.LVL113:
+.LFB44:
+	.loc 1 333 130 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 333 130 is_stmt 0 view .LVU378
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rcx, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movl	%edx, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 333 130 view .LVU379
+	movl	%esi, %ebx
+	.loc 1 335 3 is_stmt 1 view .LVU380
+	.loc 1 335 7 is_stmt 0 view .LVU381
+	movl	$1, %esi
+.LVL114:
+	.loc 1 335 7 view .LVU382
+	call	st_ensure@PLT
+.LVL115:
+	.loc 1 335 6 view .LVU383
+	testl	%eax, %eax
+	je	.L111
+	.loc 1 335 48 discriminator 1 view .LVU384
+	movq	0(%rbp), %rdi
+	.loc 1 335 66 discriminator 1 view .LVU385
+	movq	16(%rbp), %rdx
+	.loc 1 337 12 discriminator 1 view .LVU386
+	xorl	%eax, %eax
+	.loc 1 335 36 discriminator 1 view .LVU387
+	cmpb	%bl, (%rdi,%rdx)
+	jne	.L111
+	movsbl	%r13b, %r13d
+.LVL116:
+.LBB46:
+.LBI46:
+	.loc 1 333 5 is_stmt 1 view .LVU388
+.LBB47:
+	.loc 1 340 10 is_stmt 0 view .LVU389
+	movl	$1, %r12d
+	jmp	.L114
+.LVL117:
+	.p2align 4,,10
+	.p2align 3
+.L123:
+.LBB48:
+	.loc 1 345 28 view .LVU390
+	leaq	1(%rbx), %rsi
+	movq	%rbp, %rdi
+	call	st_ensure@PLT
+.LVL118:
+	.loc 1 345 25 view .LVU391
+	testl	%eax, %eax
+	je	.L113
+	.loc 1 345 25 view .LVU392
+.LBE48:
+	.loc 1 350 44 view .LVU393
+	movq	16(%rbp), %rdx
+	.loc 1 350 24 view .LVU394
+	movq	0(%rbp), %rdi
+.LVL119:
+.L114:
+	.loc 1 341 3 is_stmt 1 view .LVU395
+.LBB49:
+	.loc 1 342 5 view .LVU396
+	.loc 1 342 12 is_stmt 0 view .LVU397
+	movq	8(%rbp), %rbx
+	subq	%rdx, %rbx
+.LVL120:
+	.loc 1 343 5 is_stmt 1 view .LVU398
+	.loc 1 343 12 is_stmt 0 view .LVU399
+	movq	%rbx, %rsi
+	.loc 1 343 70 view .LVU400
+	addq	%r12, %rdx
+	.loc 1 343 12 view .LVU401
+	subq	%r12, %rsi
+	.loc 1 343 70 view .LVU402
+	addq	%rdx, %rdi
+	.loc 1 343 12 view .LVU403
+	movl	%r13d, %edx
+	call	st_scan_delimiter@PLT
+.LVL121:
+	.loc 1 343 9 view .LVU404
+	addq	%rax, %r12
+.LVL122:
+	.loc 1 345 5 is_stmt 1 view .LVU405
+	.loc 1 345 8 is_stmt 0 view .LVU406
+	cmpq	%rbx, %r12
+	jnb	.L123
+.L113:
+.LBE49:
+	.loc 1 350 3 is_stmt 1 view .LVU407
+	.loc 1 350 44 is_stmt 0 view .LVU408
+	movq	16(%rbp), %rax
+	.loc 1 350 55 view .LVU409
+	movq	0(%rbp), %rdx
+	.loc 1 354 8 view .LVU410
+	xorl	%esi, %esi
+	.loc 1 350 55 view .LVU411
+	leaq	1(%rdx,%rax), %rdx
+	.loc 1 350 13 view .LVU412
+	movq	%rdx, (%r14)
+	.loc 1 351 3 is_stmt 1 view .LVU413
+	.loc 1 353 23 is_stmt 0 view .LVU414
+	addq	%r12, %rax
+	.loc 1 351 19 view .LVU415
+	leaq	-1(%r12), %rdx
+	movq	%rdx, 8(%r14)
+	.loc 1 353 3 is_stmt 1 view .LVU416
+	.loc 1 353 23 is_stmt 0 view .LVU417
+	movq	%rax, 16(%rbp)
+	.loc 1 354 3 is_stmt 1 view .LVU418
+	.loc 1 354 8 view .LVU419
+	leaq	1(%r12), %rdx
+	movq	%rbp, %rdi
+	call	st_stats_add@PLT
+.LVL123:
+	.loc 1 354 16 view .LVU420
+	.loc 1 354 21 view .LVU421
+	.loc 1 354 19 view .LVU422
+	.loc 1 354 6 view .LVU423
+	.loc 1 355 3 view .LVU424
+	.loc 1 355 8 view .LVU425
+	movl	$1, %edx
+	movl	$8, %esi
+	movq	%rbp, %rdi
+	call	st_stats_add@PLT
+.LVL124:
+	.loc 1 355 10 view .LVU426
+	.loc 1 355 15 view .LVU427
+	.loc 1 355 13 view .LVU428
+	.loc 1 355 6 view .LVU429
+	.loc 1 356 3 view .LVU430
+	.loc 1 355 8 is_stmt 0 view .LVU431
+	movl	$1, %eax
+.L111:
+	.loc 1 355 8 view .LVU432
+.LBE47:
+.LBE46:
+	.loc 1 357 1 view .LVU433
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL125:
+	.loc 1 357 1 view .LVU434
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL126:
+	.loc 1 357 1 view .LVU435
+	ret
+	.cfi_endproc
+.LFE44:
+	.size	st_sub_string_view, .-st_sub_string_view
+	.p2align 4
+	.globl	st_sub_string
+	.type	st_sub_string, @function
+st_sub_string:
+.LVL127:
+.LFB45:
+	.loc 1 362 102 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 363 3 view .LVU437
+	.loc 1 364 3 view .LVU438
+	.loc 1 362 102 is_stmt 0 view .LVU439
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 364 7 view .LVU440
+	movsbl	%dl, %edx
+	.loc 1 364 7 view .LVU441
+	movsbl	%sil, %esi
+	.loc 1 362 102 view .LVU442
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 364 7 view .LVU443
+	movq	%rsp, %rbp
+	movq	%rbp, %rcx
+	call	st_sub_string_view@PLT
+.LVL128:
+	.loc 1 364 7 view .LVU444
+	movl	%eax, %edx
+	.loc 1 365 11 view .LVU445
+	xorl	%eax, %eax
+	.loc 1 364 6 view .LVU446
+	testl	%edx, %edx
+	je	.L124
+	.loc 1 368 3 is_stmt 1 view .LVU447
+.LVL129:
+.LBB54:
+.LBI54:
+	.loc 1 279 14 view .LVU448
+.LBB55:
+	.loc 1 280 3 view .LVU449
+	.loc 1 280 16 is_stmt 0 view .LVU450
+	movq	64(%rbx), %rdi
+	.loc 1 280 6 view .LVU451
+	testq	%rdi, %rdi
+	je	.L126
+	.loc 1 281 5 is_stmt 1 view .LVU452
+	.loc 1 281 12 is_stmt 0 view .LVU453
+	movq	%rbp, %rsi
+	call	st_arena_string@PLT
+.LVL130:
+.L124:
+	.loc 1 281 12 view .LVU454
+.LBE55:
+.LBE54:
+	.loc 1 369 1 view .LVU455
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL131:
+	.loc 1 369 1 view .LVU456
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL132:
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	.cfi_restore_state
+.LBB59:
+.LBB58:
+.LBB56:
+.LBI56:
+	.loc 1 279 14 is_stmt 1 view .LVU457
+.LBB57:
+	.loc 1 283 3 view .LVU458
+	.loc 1 283 8 view .LVU459
+	movq	%rbx, %rdi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL133:
+	.loc 1 283 10 view .LVU460
+	.loc 1 283 15 view .LVU461
+	.loc 1 283 13 view .LVU462
+	.loc 1 283 6 view .LVU463
+	.loc 1 284 3 view .LVU464
+	.loc 1 284 10 is_stmt 0 view .LVU465
+	movq	%rbp, %rdi
+	call	sv_to_string@PLT
+.LVL134:
+	.loc 1 284 10 view .LVU466
+.LBE57:
+.LBE56:
+.LBE58:
+.LBE59:
+	.loc 1 369 1 view .LVU467
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL135:
+	.loc 1 369 1 view .LVU468
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL136:
+	.loc 1 369 1 view .LVU469
+	ret
+	.cfi_endproc
+.LFE45:
+	.size	st_sub_string, .-st_sub_string
+	.p2align 4
+	.globl	st_slice_string_view
+	.type	st_slice_string_view, @function
+st_slice_string_view:
+.LVL137:
+.LFB46:
+	.loc 1 374 104 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 376 3 view .LVU471
+	.loc 1 376 6 is_stmt 0 view .LVU472
+	testl	%esi, %esi
+	js	.L137
+	.loc 1 374 104 view .LVU473
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	.loc 1 377 5 view .LVU474
+	movslq	%esi, %r13
+	.loc 1 374 104 view .LVU475
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdx, %r12
+	.loc 1 377 5 is_stmt 1 view .LVU476
+	.loc 1 374 104 is_stmt 0 view .LVU477
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movl	%esi, %ebx
+	.loc 1 377 5 view .LVU478
+	movq	%r13, %rsi
+.LVL138:
+	.loc 1 374 104 view .LVU479
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 377 5 view .LVU480
+	call	st_ensure@PLT
+.LVL139:
+	.loc 1 379 3 is_stmt 1 view .LVU481
+	.loc 1 379 30 is_stmt 0 view .LVU482
+	movq	16(%rbp), %rdx
+	.loc 1 379 52 view .LVU483
+	movq	8(%rbp), %rax
+	.loc 1 379 18 view .LVU484
+	cmpq	%rdx, %rax
+	jb	.L133
+	.loc 1 379 100 discriminator 2 view .LVU485
+	subq	%rdx, %rax
+	.loc 1 379 61 discriminator 2 view .LVU486
+	cmpq	%r13, %rax
+	jnb	.L138
+.L133:
+	.loc 1 390 1 view .LVU487
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL140:
+	.loc 1 390 1 view .LVU488
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL141:
+	.loc 1 390 1 view .LVU489
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL142:
+	.loc 1 380 12 view .LVU490
+	xorl	%eax, %eax
+	.loc 1 390 1 view .LVU491
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL143:
+	.loc 1 390 1 view .LVU492
+	ret
+.LVL144:
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.loc 1 380 12 view .LVU493
+	xorl	%eax, %eax
+	.loc 1 390 1 view .LVU494
+	ret
+.LVL145:
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -40
+	.cfi_offset 6, -32
+	.cfi_offset 12, -24
+	.cfi_offset 13, -16
+	.loc 1 383 3 is_stmt 1 view .LVU495
+	.loc 1 383 33 is_stmt 0 view .LVU496
+	movq	0(%rbp), %rax
+	.loc 1 386 33 view .LVU497
+	incl	%ebx
+.LVL146:
+	.loc 1 386 33 view .LVU498
+	movslq	%ebx, %rbx
+	.loc 1 383 33 view .LVU499
+	addq	%rdx, %rax
+	.loc 1 386 23 view .LVU500
+	addq	%rdx, %rbx
+.LVL147:
+	.loc 1 383 13 view .LVU501
+	movq	%rax, (%r12)
+	.loc 1 384 3 is_stmt 1 view .LVU502
+	.loc 1 384 13 is_stmt 0 view .LVU503
+	movq	%r13, 8(%r12)
+	.loc 1 386 3 is_stmt 1 view .LVU504
+	.loc 1 386 23 is_stmt 0 view .LVU505
+	movq	%rbx, 16(%rbp)
+	.loc 1 387 3 is_stmt 1 view .LVU506
+	.loc 1 387 8 view .LVU507
+	movq	%r13, %rdx
+	movq	%rbp, %rdi
+	xorl	%esi, %esi
+	call	st_stats_add@PLT
+.LVL148:
+	.loc 1 387 15 view .LVU508
+	.loc 1 387 20 view .LVU509
+	.loc 1 387 18 view .LVU510
+	.loc 1 387 6 view .LVU511
+	.loc 1 388 3 view .LVU512
+	.loc 1 388 8 view .LVU513
+	movq	%rbp, %rdi
+	movl	$1, %edx
+	movl	$8, %esi
+	call	st_stats_add@PLT
+.LVL149:
+	.loc 1 388 10 view .LVU514
+	.loc 1 388 15 view .LVU515
+	.loc 1 388 13 view .LVU516
+	.loc 1 388 6 view .LVU517
+	.loc 1 389 3 view .LVU518
+	.loc 1 390 1 is_stmt 0 view .LVU519
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL150:
+	.loc 1 390 1 view .LVU520
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL151:
+	.loc 1 389 10 view .LVU521
+	movl	$1, %eax
+	.loc 1 390 1 view .LVU522
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL152:
+	.loc 1 390 1 view .LVU523
+	ret
+	.cfi_endproc
+.LFE46:
+	.size	st_slice_string_view, .-st_slice_string_view
+	.p2align 4
+	.globl	st_slice_string
+	.type	st_slice_string, @function
+st_slice_string:
+.LVL153:
+.LFB47:
+	.loc 1 395 76 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 396 3 view .LVU525
+	.loc 1 397 3 view .LVU526
+	.loc 1 395 76 is_stmt 0 view .LVU527
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 397 7 view .LVU528
+	movq	%rsp, %rbp
+	movq	%rbp, %rdx
+	call	st_slice_string_view@PLT
+.LVL154:
+	.loc 1 397 7 view .LVU529
+	movl	%eax, %edx
+	.loc 1 398 11 view .LVU530
+	xorl	%eax, %eax
+	.loc 1 397 6 view .LVU531
+	testl	%edx, %edx
+	je	.L139
+	.loc 1 401 3 is_stmt 1 view .LVU532
+.LVL155:
+.LBB64:
+.LBI64:
+	.loc 1 279 14 view .LVU533
+.LBB65:
+	.loc 1 280 3 view .LVU534
+	.loc 1 280 16 is_stmt 0 view .LVU535
+	movq	64(%rbx), %rdi
+	.loc 1 280 6 view .LVU536
+	testq	%rdi, %rdi
+	je	.L141
+	.loc 1 281 5 is_stmt 1 view .LVU537
+	.loc 1 281 12 is_stmt 0 view .LVU538
+	movq	%rbp, %rsi
+	call	st_arena_string@PLT
+.LVL156:
+.L139:
+	.loc 1 281 12 view .LVU539
+.LBE65:
+.LBE64:
+	.loc 1 402 1 view .LVU540
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL157:
+	.loc 1 402 1 view .LVU541
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL158:
+	.p2align 4,,10
+	.p2align 3
+.L141:
+	.cfi_restore_state
+.LBB69:
+.LBB68:
+.LBB66:
+.LBI66:
+	.loc 1 279 14 is_stmt 1 view .LVU542
+.LBB67:
+	.loc 1 283 3 view .LVU543
+	.loc 1 283 8 view .LVU544
+	movq	%rbx, %rdi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL159:
+	.loc 1 283 10 view .LVU545
+	.loc 1 283 15 view .LVU546
+	.loc 1 283 13 view .LVU547
+	.loc 1 283 6 view .LVU548
+	.loc 1 284 3 view .LVU549
+	.loc 1 284 10 is_stmt 0 view .LVU550
+	movq	%rbp, %rdi
+	call	sv_to_string@PLT
+.LVL160:
+	.loc 1 284 10 view .LVU551
+.LBE67:
+.LBE66:
+.LBE68:
+.LBE69:
+	.loc 1 402 1 view .LVU552
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL161:
+	.loc 1 402 1 view .LVU553
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL162:
+	.loc 1 402 1 view .LVU554
+	ret
+	.cfi_endproc
+.LFE47:
+	.size	st_slice_string, .-st_slice_string
+	.p2align 4
+	.globl	st_extract_numbers_view
+	.type	st_extract_numbers_view, @function
+st_extract_numbers_view:
+.LVL163:
+.LFB49:
+	.loc 1 434 89 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 435 3 view .LVU556
+	.loc 1 434 89 is_stmt 0 view .LVU557
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+.LVL164:
+.LBB77:
+.LBI77:
+	.loc 1 415 12 is_stmt 1 view .LVU558
+.LBB78:
+	.loc 1 417 3 view .LVU559
+	.loc 1 418 3 view .LVU560
+.LBE78:
+.LBE77:
+	.loc 1 434 89 is_stmt 0 view .LVU561
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+.LBB89:
+.LBB85:
+	.loc 1 417 10 view .LVU562
+	xorl	%ebx, %ebx
+.LBE85:
+.LBE89:
+	.loc 1 434 89 view .LVU563
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+.LBB90:
+.LBB86:
+	.loc 1 418 9 view .LVU564
+	jmp	.L147
+.LVL165:
+	.p2align 4,,10
+	.p2align 3
+.L153:
+.LBB79:
+.LBI79:
+	.loc 2 1473 19 is_stmt 1 view .LVU565
+	.loc 2 1474 3 view .LVU566
+.LBB80:
+.LBI80:
+	.loc 2 202 19 view .LVU567
+.LBB81:
+	.loc 2 203 3 view .LVU568
+	.loc 2 203 3 is_stmt 0 view .LVU569
+.LBE81:
+.LBE80:
+.LBE79:
+	.loc 1 418 76 view .LVU570
+	movq	0(%rbp), %rax
+	.loc 1 418 45 view .LVU571
+	movq	st_char_classes@GOTPCREL(%rip), %rdx
+	.loc 1 418 76 view .LVU572
+	addq	%r12, %rax
+	addq	16(%rbp), %rax
+.LBB84:
+.LBB83:
+.LBB82:
+	.loc 2 203 26 view .LVU573
+	movzbl	(%rax), %eax
+.LBE82:
+.LBE83:
+.LBE84:
+	.loc 1 418 45 view .LVU574
+	testb	$4, (%rdx,%rax)
+	je	.L146
+.LVL166:
+.L147:
+	.loc 1 418 45 is_stmt 1 view .LVU575
+	movq	%rbx, %r12
+	.loc 1 418 10 is_stmt 0 view .LVU576
+	incq	%rbx
+.LVL167:
+	.loc 1 418 10 view .LVU577
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	st_ensure@PLT
+.LVL168:
+	.loc 1 418 45 view .LVU578
+	cmpl	$1, %eax
+	je	.L153
+.L146:
+	.loc 1 422 3 is_stmt 1 view .LVU579
+.LBE86:
+.LBE90:
+	.loc 1 436 12 is_stmt 0 view .LVU580
+	xorl	%eax, %eax
+.LBB91:
+.LBB87:
+	.loc 1 422 6 view .LVU581
+	testq	%r12, %r12
+	je	.L145
+	.loc 1 426 3 is_stmt 1 view .LVU582
+	.loc 1 426 44 is_stmt 0 view .LVU583
+	movq	16(%rbp), %rax
+	.loc 1 426 33 view .LVU584
+	movq	0(%rbp), %rdx
+	.loc 1 427 13 view .LVU585
+	movq	%r12, 8(%r13)
+	.loc 1 426 33 view .LVU586
+	addq	%rax, %rdx
+.LBE87:
+.LBE91:
+.LBB92:
+.LBB93:
+	.loc 1 440 23 view .LVU587
+	leaq	-1(%rax,%r12), %rax
+.LBE93:
+.LBE92:
+.LBB95:
+.LBB88:
+	.loc 1 426 13 view .LVU588
+	movq	%rdx, 0(%r13)
+	.loc 1 427 3 is_stmt 1 view .LVU589
+	.loc 1 428 3 view .LVU590
+.LVL169:
+	.loc 1 428 3 is_stmt 0 view .LVU591
+.LBE88:
+.LBE95:
+.LBB96:
+.LBI92:
+	.loc 1 434 5 is_stmt 1 view .LVU592
+.LBB94:
+	.loc 1 438 3 view .LVU593
+	.loc 1 440 3 view .LVU594
+	.loc 1 440 23 is_stmt 0 view .LVU595
+	movq	%rax, 16(%rbp)
+	.loc 1 441 3 is_stmt 1 view .LVU596
+	.loc 1 441 8 view .LVU597
+	movq	%r12, %rdx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	st_stats_add@PLT
+.LVL170:
+	.loc 1 441 12 view .LVU598
+	.loc 1 441 17 view .LVU599
+	.loc 1 441 15 view .LVU600
+	.loc 1 441 6 view .LVU601
+	.loc 1 442 3 view .LVU602
+	.loc 1 442 8 view .LVU603
+	movl	$1, %edx
+	movl	$8, %esi
+	movq	%rbp, %rdi
+	call	st_stats_add@PLT
+.LVL171:
+	.loc 1 442 10 view .LVU604
+	.loc 1 442 15 view .LVU605
+	.loc 1 442 13 view .LVU606
+	.loc 1 442 6 view .LVU607
+	.loc 1 443 3 view .LVU608
+	.loc 1 442 8 is_stmt 0 view .LVU609
+	movl	$1, %eax
+.L145:
+	.loc 1 442 8 view .LVU610
+.LBE94:
+.LBE96:
+	.loc 1 444 1 view .LVU611
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL172:
+	.loc 1 444 1 view .LVU612
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL173:
+	.loc 1 444 1 view .LVU613
+	ret
+	.cfi_endproc
+.LFE49:
+	.size	st_extract_numbers_view, .-st_extract_numbers_view
+	.p2align 4
+	.globl	st_extract_until_view
+	.type	st_extract_until_view, @function
+st_extract_until_view:
+.LVL174:
+.LFB50:
+	.loc 1 449 129 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 451 3 view .LVU615
+	.loc 1 452 3 view .LVU616
+	.loc 1 449 129 is_stmt 0 view .LVU617
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 451 10 view .LVU618
+	xorl	%ebx, %ebx
+	.loc 1 452 9 view .LVU619
+	jmp	.L155
+.LVL175:
+	.p2align 4,,10
+	.p2align 3
+.L157:
+.LBB97:
+	.loc 1 453 5 is_stmt 1 view .LVU620
+	.loc 1 453 53 is_stmt 0 view .LVU621
+	movq	16(%r14), %rdi
+	.loc 1 453 12 view .LVU622
+	movq	8(%r14), %r13
+	.loc 1 454 12 view .LVU623
+	movq	%rbp, %rdx
+	.loc 1 453 12 view .LVU624
+	subq	%rdi, %r13
+.LVL176:
+	.loc 1 454 5 is_stmt 1 view .LVU625
+	.loc 1 454 12 is_stmt 0 view .LVU626
+	movq	%r13, %rsi
+	.loc 1 454 66 view .LVU627
+	addq	%rbx, %rdi
+	.loc 1 454 12 view .LVU628
+	subq	%rbx, %rsi
+	.loc 1 454 66 view .LVU629
+	addq	(%r14), %rdi
+	.loc 1 454 12 view .LVU630
+	call	st_scan_class@PLT
+.LVL177:
+	.loc 1 454 9 view .LVU631
+	addq	%rax, %rbx
+.LVL178:
+	.loc 1 456 5 is_stmt 1 view .LVU632
+	.loc 1 456 8 is_stmt 0 view .LVU633
+	cmpq	%r13, %rbx
+	jb	.L156
+.LVL179:
+.L155:
+	.loc 1 456 8 view .LVU634
+.LBE97:
+	.loc 1 452 40 is_stmt 1 view .LVU635
+	.loc 1 452 10 is_stmt 0 view .LVU636
+	leaq	1(%rbx), %rsi
+	movq	%r14, %rdi
+	call	st_ensure@PLT
+.LVL180:
+	.loc 1 452 40 view .LVU637
+	cmpl	$1, %eax
+	je	.L157
+.L156:
+	.loc 1 460 3 is_stmt 1 view .LVU638
+	.loc 1 461 12 is_stmt 0 view .LVU639
+	xorl	%eax, %eax
+	.loc 1 460 6 view .LVU640
+	testq	%rbx, %rbx
+	je	.L154
+	.loc 1 464 3 is_stmt 1 view .LVU641
+	.loc 1 464 44 is_stmt 0 view .LVU642
+	movq	16(%r14), %rax
+	.loc 1 464 33 view .LVU643
+	movq	(%r14), %rdx
+	.loc 1 465 13 view .LVU644
+	movq	%rbx, 8(%r12)
+	.loc 1 464 33 view .LVU645
+	addq	%rax, %rdx
+	.loc 1 467 23 view .LVU646
+	leaq	-1(%rax,%rbx), %rax
+	.loc 1 464 13 view .LVU647
+	movq	%rdx, (%r12)
+	.loc 1 465 3 is_stmt 1 view .LVU648
+	.loc 1 467 3 view .LVU649
+	.loc 1 467 23 is_stmt 0 view .LVU650
+	movq	%rax, 16(%r14)
+	.loc 1 468 3 is_stmt 1 view .LVU651
+	.loc 1 468 8 view .LVU652
+	movq	%rbx, %rdx
+	xorl	%esi, %esi
+	movq	%r14, %rdi
+	call	st_stats_add@PLT
+.LVL181:
+	.loc 1 468 12 view .LVU653
+	.loc 1 468 17 view .LVU654
+	.loc 1 468 15 view .LVU655
+	.loc 1 468 6 view .LVU656
+	.loc 1 469 3 view .LVU657
+	.loc 1 469 8 view .LVU658
+	movl	$1, %edx
+	movl	$8, %esi
+	movq	%r14, %rdi
+	call	st_stats_add@PLT
+.LVL182:
+	.loc 1 469 10 view .LVU659
+	.loc 1 469 15 view .LVU660
+	.loc 1 469 13 view .LVU661
+	.loc 1 469 6 view .LVU662
+	.loc 1 470 3 view .LVU663
+	.loc 1 470 10 is_stmt 0 view .LVU664
+	movl	$1, %eax
+.L154:
+	.loc 1 471 1 view .LVU665
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL183:
+	.loc 1 471 1 view .LVU666
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL184:
+	.loc 1 471 1 view .LVU667
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL185:
+	.loc 1 471 1 view .LVU668
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL186:
+	.loc 1 471 1 view .LVU669
+	ret
+	.cfi_endproc
+.LFE50:
+	.size	st_extract_until_view, .-st_extract_until_view
+	.p2align 4
+	.globl	st_extract_numbers
+	.type	st_extract_numbers, @function
+st_extract_numbers:
+.LVL187:
+.LFB51:
+	.loc 1 476 61 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 477 3 view .LVU671
+	.loc 1 478 3 view .LVU672
+	.loc 1 476 61 is_stmt 0 view .LVU673
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 478 7 view .LVU674
+	movq	%rsp, %rbp
+	movq	%rbp, %rsi
+	call	st_extract_numbers_view@PLT
+.LVL188:
+	.loc 1 478 7 view .LVU675
+	movl	%eax, %edx
+	.loc 1 479 11 view .LVU676
+	xorl	%eax, %eax
+	.loc 1 478 6 view .LVU677
+	testl	%edx, %edx
+	je	.L162
+	.loc 1 482 3 is_stmt 1 view .LVU678
+.LVL189:
+.LBB102:
+.LBI102:
+	.loc 1 279 14 view .LVU679
+.LBB103:
+	.loc 1 280 3 view .LVU680
+	.loc 1 280 16 is_stmt 0 view .LVU681
+	movq	64(%rbx), %rdi
+	.loc 1 280 6 view .LVU682
+	testq	%rdi, %rdi
+	je	.L164
+	.loc 1 281 5 is_stmt 1 view .LVU683
+	.loc 1 281 12 is_stmt 0 view .LVU684
+	movq	%rbp, %rsi
+	call	st_arena_string@PLT
+.LVL190:
+.L162:
+	.loc 1 281 12 view .LVU685
+.LBE103:
+.LBE102:
+	.loc 1 483 1 view .LVU686
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL191:
+	.loc 1 483 1 view .LVU687
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL192:
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	.cfi_restore_state
+.LBB107:
+.LBB106:
+.LBB104:
+.LBI104:
+	.loc 1 279 14 is_stmt 1 view .LVU688
+.LBB105:
+	.loc 1 283 3 view .LVU689
+	.loc 1 283 8 view .LVU690
+	movq	%rbx, %rdi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL193:
+	.loc 1 283 10 view .LVU691
+	.loc 1 283 15 view .LVU692
+	.loc 1 283 13 view .LVU693
+	.loc 1 283 6 view .LVU694
+	.loc 1 284 3 view .LVU695
+	.loc 1 284 10 is_stmt 0 view .LVU696
+	movq	%rbp, %rdi
+	call	sv_to_string@PLT
+.LVL194:
+	.loc 1 284 10 view .LVU697
+.LBE105:
+.LBE104:
+.LBE106:
+.LBE107:
+	.loc 1 483 1 view .LVU698
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL195:
+	.loc 1 483 1 view .LVU699
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL196:
+	.loc 1 483 1 view .LVU700
+	ret
+	.cfi_endproc
+.LFE51:
+	.size	st_extract_numbers, .-st_extract_numbers
+	.p2align 4
+	.globl	st_extract_double_to
+	.type	st_extract_double_to, @function
+st_extract_double_to:
+.LVL197:
+.LFB52:
+	.loc 1 488 76 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 490 3 view .LVU702
+	.loc 1 491 3 view .LVU703
+	.loc 1 488 76 is_stmt 0 view .LVU704
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 491 7 view .LVU705
+	movq	%rsp, %rsi
+.LVL198:
+	.loc 1 491 7 view .LVU706
+	call	st_extract_numbers_view@PLT
+.LVL199:
+	.loc 1 491 6 view .LVU707
+	testl	%eax, %eax
+	jne	.L180
+	.loc 1 492 12 view .LVU708
+	xorl	%eax, %eax
+.LVL200:
+.L183:
+	.loc 1 504 1 view .LVU709
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL201:
+	.loc 1 504 1 view .LVU710
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL202:
+	.p2align 4,,10
+	.p2align 3
+.L180:
+	.cfi_restore_state
+	.loc 1 495 3 is_stmt 1 view .LVU711
+	.loc 1 495 20 is_stmt 0 view .LVU712
+	movq	%rbx, %rdi
+	call	st_stats_clock@PLT
+.LVL203:
+	.loc 1 496 22 view .LVU713
+	movq	8(%rsp), %rsi
+	movq	(%rsp), %rdi
+	movq	%rbp, %rdx
+	.loc 1 495 20 view .LVU714
+	movq	%rax, %r12
+.LVL204:
+	.loc 1 496 3 is_stmt 1 view .LVU715
+	.loc 1 496 22 is_stmt 0 view .LVU716
+	call	stod@PLT
+.LVL205:
+	.loc 1 496 22 view .LVU717
+	movq	%rax, %rbp
+.LVL206:
+	.loc 1 497 3 is_stmt 1 view .LVU718
+	.loc 1 497 8 view .LVU719
+	.loc 1 497 11 is_stmt 0 view .LVU720
+	testq	%r12, %r12
+	jne	.L181
+.LVL207:
+.L170:
+	.loc 1 497 44 is_stmt 1 discriminator 3 view .LVU721
+	.loc 1 497 49 discriminator 3 view .LVU722
+	.loc 1 497 47 discriminator 3 view .LVU723
+	.loc 1 497 44 discriminator 3 view .LVU724
+	.loc 1 497 6 discriminator 3 view .LVU725
+	.loc 1 498 3 discriminator 3 view .LVU726
+	.loc 1 503 10 is_stmt 0 discriminator 3 view .LVU727
+	movl	$1, %eax
+	.loc 1 498 6 discriminator 3 view .LVU728
+	testq	%rbp, %rbp
+	je	.L182
+	.loc 1 504 1 view .LVU729
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL208:
+	.loc 1 504 1 view .LVU730
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL209:
+	.loc 1 504 1 view .LVU731
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL210:
+	.loc 1 504 1 view .LVU732
+	ret
+.LVL211:
+	.p2align 4,,10
+	.p2align 3
+.L182:
+	.cfi_restore_state
+	.loc 1 500 5 is_stmt 1 view .LVU733
+	.loc 1 500 36 is_stmt 0 view .LVU734
+	movq	(%rsp), %rax
+	subq	(%rbx), %rax
+	.loc 1 500 25 view .LVU735
+	movq	%rax, 16(%rbx)
+	.loc 1 501 5 is_stmt 1 view .LVU736
+	.loc 1 492 12 is_stmt 0 view .LVU737
+	xorl	%eax, %eax
+	jmp	.L183
+.LVL212:
+	.p2align 4,,10
+	.p2align 3
+.L181:
+	.loc 1 497 28 is_stmt 1 discriminator 1 view .LVU738
+	.loc 1 497 33 discriminator 1 view .LVU739
+	movl	$1, %edx
+	movl	$48, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL213:
+	.loc 1 497 10 discriminator 1 view .LVU740
+	.loc 1 497 15 discriminator 1 view .LVU741
+	.loc 1 497 13 discriminator 1 view .LVU742
+	.loc 1 497 31 discriminator 1 view .LVU743
+	.loc 1 497 41 discriminator 1 view .LVU744
+	.loc 1 497 46 discriminator 1 view .LVU745
+	.loc 1 497 5 is_stmt 0 discriminator 1 view .LVU746
+	movq	%rbx, %rdi
+	call	st_stats_clock@PLT
+.LVL214:
+	.loc 1 497 46 discriminator 1 view .LVU747
+	subq	%r12, %rax
+	movq	%rax, %rdx
+	movl	$56, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL215:
+	jmp	.L170
+	.cfi_endproc
+.LFE52:
+	.size	st_extract_double_to, .-st_extract_double_to
+	.p2align 4
+	.globl	st_extract_int64
+	.type	st_extract_int64, @function
+st_extract_int64:
+.LVL216:
+.LFB53:
+	.loc 1 509 73 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 510 3 view .LVU749
+	.loc 1 509 73 is_stmt 0 view .LVU750
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rsi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 510 20 view .LVU751
+	call	st_stats_clock@PLT
+.LVL217:
+	.loc 1 512 3 view .LVU752
+	movl	$21, %esi
+	movq	%rbx, %rdi
+	.loc 1 510 20 view .LVU753
+	movq	%rax, %r14
+.LVL218:
+	.loc 1 512 3 is_stmt 1 view .LVU754
+	movq	%rsp, %r13
+	call	st_ensure@PLT
+.LVL219:
+	.loc 1 512 3 is_stmt 0 view .LVU755
+	jmp	.L189
+	.p2align 4,,10
+	.p2align 3
+.L220:
+.LVL220:
+	.loc 1 518 5 is_stmt 1 view .LVU756
+	.loc 1 518 16 is_stmt 0 view .LVU757
+	movq	%r13, %rdx
+	xorl	%esi, %esi
+	call	stoi64@PLT
+.LVL221:
+	movq	%rax, %r12
+.LVL222:
+	.loc 1 520 5 is_stmt 1 view .LVU758
+	.loc 1 517 99 is_stmt 0 view .LVU759
+	xorl	%ebp, %ebp
+.LVL223:
+.L186:
+	.loc 1 520 30 discriminator 1 view .LVU760
+	cmpq	$0, 48(%rbx)
+	je	.L188
+	.loc 1 520 61 discriminator 2 view .LVU761
+	leaq	1(%rbp), %rsi
+	movq	%rbx, %rdi
+	call	st_ensure@PLT
+.LVL224:
+	.loc 1 520 58 discriminator 2 view .LVU762
+	testl	%eax, %eax
+	je	.L188
+.LVL225:
+.L189:
+	.loc 1 513 3 is_stmt 1 view .LVU763
+	.loc 1 514 3 view .LVU764
+	.loc 1 515 3 view .LVU765
+	.loc 1 516 3 view .LVU766
+	.loc 1 517 5 view .LVU767
+	.loc 1 517 26 is_stmt 0 view .LVU768
+	movq	16(%rbx), %rax
+	.loc 1 518 41 view .LVU769
+	movq	(%rbx), %rdi
+	.loc 1 517 48 view .LVU770
+	movq	8(%rbx), %rbp
+	.loc 1 518 41 view .LVU771
+	addq	%rax, %rdi
+	.loc 1 517 99 view .LVU772
+	cmpq	%rbp, %rax
+	jnb	.L220
+	.loc 1 517 99 discriminator 1 view .LVU773
+	subq	%rax, %rbp
+.LVL226:
+	.loc 1 518 5 is_stmt 1 discriminator 1 view .LVU774
+	.loc 1 518 16 is_stmt 0 discriminator 1 view .LVU775
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	call	stoi64@PLT
+.LVL227:
+	movq	%rax, %r12
+.LVL228:
+	.loc 1 520 5 is_stmt 1 discriminator 1 view .LVU776
+	.loc 1 520 8 is_stmt 0 discriminator 1 view .LVU777
+	cmpq	%rbp, %rax
+	jnb	.L186
+	.loc 1 524 3 is_stmt 1 view .LVU778
+	.loc 1 524 6 is_stmt 0 view .LVU779
+	testq	%rax, %rax
+	je	.L190
+.LVL229:
+.L199:
+	.loc 1 527 8 discriminator 1 view .LVU780
+	movq	(%rbx), %rax
+	addq	%r12, %rax
+	addq	16(%rbx), %rax
+	movzbl	(%rax), %eax
+.LVL230:
+	.loc 1 528 3 is_stmt 1 discriminator 1 view .LVU781
+	.loc 1 528 34 is_stmt 0 discriminator 1 view .LVU782
+	movl	%eax, %edx
+	andl	$-33, %edx
+	cmpb	$69, %dl
+	je	.L200
+	.loc 1 528 34 discriminator 1 view .LVU783
+	cmpb	$46, %al
+	jne	.L191
+.L200:
+	.loc 1 528 34 discriminator 1 view .LVU784
+	xorl	%ebp, %ebp
+	jmp	.L192
+.LVL231:
+	.p2align 4,,10
+	.p2align 3
+.L221:
+.LBB114:
+.LBB115:
+.LBB116:
+.LBB117:
+.LBI117:
+	.loc 2 1473 19 is_stmt 1 view .LVU785
+	.loc 2 1474 3 view .LVU786
+.LBB118:
+.LBI118:
+	.loc 2 202 19 view .LVU787
+.LBB119:
+	.loc 2 203 3 view .LVU788
+	.loc 2 203 3 is_stmt 0 view .LVU789
+.LBE119:
+.LBE118:
+.LBE117:
+	.loc 1 418 76 view .LVU790
+	movq	(%rbx), %rax
+	.loc 1 418 45 view .LVU791
+	movq	st_char_classes@GOTPCREL(%rip), %rdx
+	.loc 1 418 76 view .LVU792
+	addq	%r12, %rax
+	addq	16(%rbx), %rax
+.LBB122:
+.LBB121:
+.LBB120:
+	.loc 2 203 26 view .LVU793
+	movzbl	(%rax), %eax
+.LBE120:
+.LBE121:
+.LBE122:
+	.loc 1 418 45 view .LVU794
+	testb	$4, (%rdx,%rax)
+	je	.L194
+.LVL232:
+.L192:
+	.loc 1 418 45 is_stmt 1 view .LVU795
+	movq	%rbp, %r12
+	.loc 1 418 10 is_stmt 0 view .LVU796
+	incq	%rbp
+.LVL233:
+	.loc 1 418 10 view .LVU797
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	st_ensure@PLT
+.LVL234:
+	.loc 1 418 45 view .LVU798
+	cmpl	$1, %eax
+	je	.L221
+.L194:
+	.loc 1 422 3 is_stmt 1 view .LVU799
+	.loc 1 422 6 is_stmt 0 view .LVU800
+	testq	%r12, %r12
+	je	.L190
+	.loc 1 426 3 is_stmt 1 view .LVU801
+.LVL235:
+	.loc 1 427 3 view .LVU802
+	.loc 1 428 3 view .LVU803
+	.loc 1 426 33 is_stmt 0 view .LVU804
+	movq	16(%rbx), %rdi
+.LBE116:
+.LBE115:
+	.loc 1 532 51 view .LVU805
+	leaq	8(%rsp), %rdx
+.LBB124:
+.LBB123:
+	.loc 1 426 33 view .LVU806
+	addq	(%rbx), %rdi
+.LVL236:
+	.loc 1 426 33 view .LVU807
+.LBE123:
+.LBE124:
+	.loc 1 532 51 view .LVU808
+	movq	%r12, %rsi
+	call	stod@PLT
+.LVL237:
+	.loc 1 532 48 view .LVU809
+	testq	%rax, %rax
+	je	.L190
+	.loc 1 536 5 is_stmt 1 view .LVU810
+	.loc 1 536 17 is_stmt 0 view .LVU811
+	vmovsd	8(%rsp), %xmm0
+	.loc 1 536 8 view .LVU812
+	vmovsd	.LC0(%rip), %xmm1
+	vcomisd	%xmm0, %xmm1
+	ja	.L190
+	.loc 1 536 42 discriminator 1 view .LVU813
+	vcomisd	.LC1(%rip), %xmm0
+	jnb	.L190
+	.loc 1 536 100 discriminator 2 view .LVU814
+	vcvttsd2siq	%xmm0, %rax
+	.loc 1 536 92 discriminator 2 view .LVU815
+	vxorps	%xmm1, %xmm1, %xmm1
+	vcvtsi2sdq	%rax, %xmm1, %xmm1
+	.loc 1 536 78 discriminator 2 view .LVU816
+	vucomisd	%xmm1, %xmm0
+	jp	.L190
+	jne	.L190
+	.loc 1 539 5 is_stmt 1 view .LVU817
+	.loc 1 539 12 is_stmt 0 view .LVU818
+	movq	%rax, (%rsp)
+	.loc 1 540 5 is_stmt 1 view .LVU819
+.LVL238:
+	.loc 1 540 5 is_stmt 0 view .LVU820
+	jmp	.L193
+.LVL239:
+	.p2align 4,,10
+	.p2align 3
+.L190:
+	.loc 1 540 5 view .LVU821
+.LBE114:
+	.loc 1 549 1 view .LVU822
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL240:
+	.loc 1 549 1 view .LVU823
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL241:
+	.loc 1 525 12 view .LVU824
+	xorl	%eax, %eax
+	.loc 1 549 1 view .LVU825
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL242:
+	.loc 1 549 1 view .LVU826
+	ret
+.LVL243:
+	.p2align 4,,10
+	.p2align 3
+.L188:
+	.cfi_restore_state
+	.loc 1 524 3 is_stmt 1 view .LVU827
+	.loc 1 524 6 is_stmt 0 view .LVU828
+	testq	%r12, %r12
+	je	.L190
+	.loc 1 527 3 is_stmt 1 view .LVU829
+	.loc 1 527 8 is_stmt 0 view .LVU830
+	cmpq	%rbp, %r12
+	jb	.L199
+.L191:
+	.loc 1 542 10 view .LVU831
+	movq	(%rsp), %rax
+.L193:
+	.loc 1 542 3 is_stmt 1 view .LVU832
+	.loc 1 542 10 is_stmt 0 view .LVU833
+	movq	%rax, (%r15)
+	.loc 1 544 3 is_stmt 1 view .LVU834
+	.loc 1 544 23 is_stmt 0 view .LVU835
+	movq	16(%rbx), %rax
+	leaq	-1(%r12,%rax), %rax
+	movq	%rax, 16(%rbx)
+	.loc 1 545 3 is_stmt 1 view .LVU836
+	.loc 1 545 8 view .LVU837
+	.loc 1 545 11 is_stmt 0 view .LVU838
+	testq	%r14, %r14
+	jne	.L222
+.L198:
+	.loc 1 545 44 is_stmt 1 discriminator 3 view .LVU839
+	.loc 1 545 49 discriminator 3 view .LVU840
+	.loc 1 545 47 discriminator 3 view .LVU841
+	.loc 1 545 44 discriminator 3 view .LVU842
+	.loc 1 545 6 discriminator 3 view .LVU843
+	.loc 1 546 3 discriminator 3 view .LVU844
+	.loc 1 546 8 discriminator 3 view .LVU845
+	movq	%r12, %rdx
+	movq	%rbx, %rdi
+	xorl	%esi, %esi
+	call	st_stats_add@PLT
+.LVL244:
+	.loc 1 546 17 discriminator 3 view .LVU846
+	.loc 1 546 22 discriminator 3 view .LVU847
+	.loc 1 546 20 discriminator 3 view .LVU848
+	.loc 1 546 6 discriminator 3 view .LVU849
+	.loc 1 547 3 discriminator 3 view .LVU850
+	.loc 1 547 8 discriminator 3 view .LVU851
+	movq	%rbx, %rdi
+	movl	$1, %edx
+	movl	$8, %esi
+	call	st_stats_add@PLT
+.LVL245:
+	.loc 1 547 10 discriminator 3 view .LVU852
+	.loc 1 547 15 discriminator 3 view .LVU853
+	.loc 1 547 13 discriminator 3 view .LVU854
+	.loc 1 547 6 discriminator 3 view .LVU855
+	.loc 1 548 3 discriminator 3 view .LVU856
+	.loc 1 549 1 is_stmt 0 discriminator 3 view .LVU857
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL246:
+	.loc 1 549 1 discriminator 3 view .LVU858
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL247:
+	.loc 1 549 1 discriminator 3 view .LVU859
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL248:
+	.loc 1 548 10 discriminator 3 view .LVU860
+	movl	$1, %eax
+	.loc 1 549 1 discriminator 3 view .LVU861
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL249:
+	.loc 1 549 1 discriminator 3 view .LVU862
+	ret
+.LVL250:
+	.p2align 4,,10
+	.p2align 3
+.L222:
+	.cfi_restore_state
+	.loc 1 545 28 is_stmt 1 discriminator 1 view .LVU863
+	.loc 1 545 33 discriminator 1 view .LVU864
+	movl	$1, %edx
+	movl	$48, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL251:
+	.loc 1 545 10 discriminator 1 view .LVU865
+	.loc 1 545 15 discriminator 1 view .LVU866
+	.loc 1 545 13 discriminator 1 view .LVU867
+	.loc 1 545 31 discriminator 1 view .LVU868
+	.loc 1 545 41 discriminator 1 view .LVU869
+	.loc 1 545 46 discriminator 1 view .LVU870
+	.loc 1 545 5 is_stmt 0 discriminator 1 view .LVU871
+	movq	%rbx, %rdi
+	call	st_stats_clock@PLT
+.LVL252:
+	.loc 1 545 46 discriminator 1 view .LVU872
+	subq	%r14, %rax
+	movq	%rax, %rdx
+	movl	$56, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL253:
+	jmp	.L198
+	.cfi_endproc
+.LFE53:
+	.size	st_extract_int64, .-st_extract_int64
+	.p2align 4
+	.globl	st_extract_double
+	.type	st_extract_double, @function
+st_extract_double:
+.LVL254:
+.LFB54:
+	.loc 1 554 62 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 556 3 view .LVU874
+	.loc 1 557 3 view .LVU875
+	.loc 1 554 62 is_stmt 0 view .LVU876
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 557 7 view .LVU877
+	leaq	8(%rsp), %rsi
+	call	st_extract_double_to@PLT
+.LVL255:
+	.loc 1 557 6 view .LVU878
+	testl	%eax, %eax
+	je	.L228
+	.loc 1 561 3 is_stmt 1 view .LVU879
+.LVL256:
+.LBB129:
+.LBI129:
+	.loc 1 260 14 view .LVU880
+.LBB130:
+	.loc 1 261 3 view .LVU881
+	.loc 1 261 16 is_stmt 0 view .LVU882
+	movq	64(%rbx), %rdi
+	.loc 1 261 6 view .LVU883
+	testq	%rdi, %rdi
+	je	.L226
+	.loc 1 262 5 is_stmt 1 view .LVU884
+	.loc 1 262 12 is_stmt 0 view .LVU885
+	movl	$8, %esi
+	call	st_arena_alloc@PLT
+.LVL257:
+	.loc 1 262 12 view .LVU886
+.LBE130:
+.LBE129:
+	.loc 1 562 3 is_stmt 1 view .LVU887
+	.loc 1 562 6 is_stmt 0 view .LVU888
+	testq	%rax, %rax
+	je	.L228
+.L233:
+	.loc 1 563 5 is_stmt 1 view .LVU889
+	.loc 1 563 12 is_stmt 0 view .LVU890
+	vmovsd	8(%rsp), %xmm0
+	vmovsd	%xmm0, (%rax)
+	.loc 1 566 1 view .LVU891
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL258:
+	.loc 1 566 1 view .LVU892
+	ret
+.LVL259:
+	.p2align 4,,10
+	.p2align 3
+.L226:
+	.cfi_restore_state
+.LBB134:
+.LBB133:
+.LBB131:
+.LBI131:
+	.loc 1 260 14 is_stmt 1 view .LVU893
+.LBB132:
+	.loc 1 264 3 view .LVU894
+	.loc 1 264 8 view .LVU895
+	movq	%rbx, %rdi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL260:
+	.loc 1 264 10 view .LVU896
+	.loc 1 264 15 view .LVU897
+	.loc 1 264 13 view .LVU898
+	.loc 1 264 6 view .LVU899
+	.loc 1 265 3 view .LVU900
+	.loc 1 265 10 is_stmt 0 view .LVU901
+	movl	$8, %edi
+	call	malloc@PLT
+.LVL261:
+	.loc 1 265 10 view .LVU902
+.LBE132:
+.LBE131:
+.LBE133:
+.LBE134:
+	.loc 1 562 3 is_stmt 1 view .LVU903
+	.loc 1 562 6 is_stmt 0 view .LVU904
+	testq	%rax, %rax
+	jne	.L233
+.LVL262:
+.L228:
+	.loc 1 566 1 view .LVU905
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 558 11 view .LVU906
+	xorl	%eax, %eax
+	.loc 1 566 1 view .LVU907
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL263:
+	.loc 1 566 1 view .LVU908
+	ret
+	.cfi_endproc
+.LFE54:
+	.size	st_extract_double, .-st_extract_double
+	.p2align 4
+	.globl	st_starts_with
+	.type	st_starts_with, @function
+st_starts_with:
+.LVL264:
+.LFB55:
+	.loc 1 571 75 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 573 3 view .LVU910
+	.loc 1 571 75 is_stmt 0 view .LVU911
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12
+	.loc 1 573 19 view .LVU912
+	movq	%rsi, %rdi
+.LVL265:
+	.loc 1 571 75 view .LVU913
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 573 19 view .LVU914
+	call	strlen@PLT
+.LVL266:
+	.loc 1 576 7 view .LVU915
+	movl	%eax, %esi
+	movq	%rsp, %rdx
+	movq	%r12, %rdi
+	.loc 1 573 19 view .LVU916
+	movq	%rax, %rbp
+.LVL267:
+	.loc 1 575 3 is_stmt 1 view .LVU917
+	.loc 1 576 3 view .LVU918
+	.loc 1 576 7 is_stmt 0 view .LVU919
+	call	st_slice_string_view@PLT
+.LVL268:
+	.loc 1 576 6 view .LVU920
+	testl	%eax, %eax
+	je	.L235
+	.loc 1 580 3 is_stmt 1 view .LVU921
+	.loc 1 580 18 is_stmt 0 view .LVU922
+	movq	(%rsp), %r13
+	.loc 1 580 7 view .LVU923
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	%r13, %rdi
+	call	memcmp@PLT
+.LVL269:
+	movl	%eax, %edx
+	.loc 1 586 10 view .LVU924
+	movl	$1, %eax
+	.loc 1 580 6 view .LVU925
+	testl	%edx, %edx
+	jne	.L243
+	.loc 1 587 1 view .LVU926
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL270:
+	.loc 1 587 1 view .LVU927
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL271:
+	.loc 1 587 1 view .LVU928
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL272:
+	.loc 1 587 1 view .LVU929
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL273:
+	.p2align 4,,10
+	.p2align 3
+.L243:
+	.cfi_restore_state
+	.loc 1 582 5 is_stmt 1 view .LVU930
+	.loc 1 582 36 is_stmt 0 view .LVU931
+	subq	(%r12), %r13
+	.loc 1 582 25 view .LVU932
+	movq	%r13, 16(%r12)
+	.loc 1 583 5 is_stmt 1 view .LVU933
+.L235:
+	.loc 1 587 1 is_stmt 0 view .LVU934
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL274:
+	.loc 1 587 1 view .LVU935
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL275:
+	.loc 1 587 1 view .LVU936
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL276:
+	.loc 1 577 12 view .LVU937
+	xorl	%eax, %eax
+	.loc 1 587 1 view .LVU938
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE55:
+	.size	st_starts_with, .-st_starts_with
+	.p2align 4
+	.globl	st_extract_boolean
+	.type	st_extract_boolean, @function
+st_extract_boolean:
+.LVL277:
+.LFB56:
+	.loc 1 592 105 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 594 3 view .LVU940
+	.loc 1 592 105 is_stmt 0 view .LVU941
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%edx, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 594 7 view .LVU942
+	call	st_starts_with@PLT
+.LVL278:
+	.loc 1 594 6 view .LVU943
+	testl	%eax, %eax
+	je	.L249
+	.loc 1 598 3 is_stmt 1 view .LVU944
+.LVL279:
+.LBB139:
+.LBI139:
+	.loc 1 260 14 view .LVU945
+.LBB140:
+	.loc 1 261 3 view .LVU946
+	.loc 1 261 16 is_stmt 0 view .LVU947
+	movq	64(%rbx), %rdi
+	.loc 1 261 6 view .LVU948
+	testq	%rdi, %rdi
+	je	.L247
+	.loc 1 262 5 is_stmt 1 view .LVU949
+	.loc 1 262 12 is_stmt 0 view .LVU950
+	movl	$4, %esi
+	call	st_arena_alloc@PLT
+.LVL280:
+	.loc 1 262 12 view .LVU951
+.LBE140:
+.LBE139:
+	.loc 1 600 3 is_stmt 1 view .LVU952
+	.loc 1 600 6 is_stmt 0 view .LVU953
+	testq	%rax, %rax
+	je	.L249
+.L254:
+	.loc 1 601 5 is_stmt 1 view .LVU954
+	.loc 1 601 12 is_stmt 0 view .LVU955
+	movl	%ebp, (%rax)
+	.loc 1 605 1 view .LVU956
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL281:
+	.loc 1 605 1 view .LVU957
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL282:
+	.loc 1 605 1 view .LVU958
+	ret
+.LVL283:
+	.p2align 4,,10
+	.p2align 3
+.L247:
+	.cfi_restore_state
+.LBB144:
+.LBB143:
+.LBB141:
+.LBI141:
+	.loc 1 260 14 is_stmt 1 view .LVU959
+.LBB142:
+	.loc 1 264 3 view .LVU960
+	.loc 1 264 8 view .LVU961
+	movq	%rbx, %rdi
+	movl	$1, %edx
+	movl	$16, %esi
+	call	st_stats_add@PLT
+.LVL284:
+	.loc 1 264 10 view .LVU962
+	.loc 1 264 15 view .LVU963
+	.loc 1 264 13 view .LVU964
+	.loc 1 264 6 view .LVU965
+	.loc 1 265 3 view .LVU966
+	.loc 1 265 10 is_stmt 0 view .LVU967
+	movl	$4, %edi
+	call	malloc@PLT
+.LVL285:
+	.loc 1 265 10 view .LVU968
+.LBE142:
+.LBE141:
+.LBE143:
+.LBE144:
+	.loc 1 600 3 is_stmt 1 view .LVU969
+	.loc 1 600 6 is_stmt 0 view .LVU970
+	testq	%rax, %rax
+	jne	.L254
+.LVL286:
+.L249:
+	.loc 1 605 1 view .LVU971
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL287:
+	.loc 1 595 11 view .LVU972
+	xorl	%eax, %eax
+	.loc 1 605 1 view .LVU973
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL288:
+	.loc 1 605 1 view .LVU974
+	ret
+	.cfi_endproc
+.LFE56:
+	.size	st_extract_boolean, .-st_extract_boolean
+	.p2align 4
+	.globl	st_expand_string
+	.type	st_expand_string, @function
+st_expand_string:
+.LVL289:
+.LFB58:
+	.loc 1 658 76 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 659 3 view .LVU976
+	.loc 1 659 6 is_stmt 0 view .LVU977
+	cmpl	$2, 56(%rdi)
+	je	.L283
+	.loc 1 658 76 discriminator 1 view .LVU978
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 13, -24
+	.cfi_offset 12, -32
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.loc 1 659 48 discriminator 1 view .LVU979
+	cmpq	$0, 48(%rdi)
+	je	.L284
+.LVL290:
+.L258:
+	.loc 1 661 12 view .LVU980
+	xorl	%eax, %eax
+.L255:
+	.loc 1 688 1 view .LVU981
+	addq	$8, %rsp
+	popq	%rbx
+.LVL291:
+	.loc 1 688 1 view .LVU982
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL292:
+	.p2align 4,,10
+	.p2align 3
+.L284:
+	.cfi_restore_state
+.LBB150:
+.LBI150:
+	.loc 1 658 5 is_stmt 1 view .LVU983
+.LBB151:
+	.loc 1 664 3 view .LVU984
+	.loc 1 664 28 is_stmt 0 view .LVU985
+	movq	16(%rdi), %rcx
+	.loc 1 664 47 view .LVU986
+	movq	8(%rdi), %rdx
+	.loc 1 664 28 view .LVU987
+	addq	%rsi, %rcx
+	.loc 1 664 6 view .LVU988
+	cmpq	%rdx, %rcx
+	jb	.L260
+	.loc 1 669 3 is_stmt 1 view .LVU989
+	.loc 1 670 3 view .LVU990
+	.loc 1 671 32 is_stmt 0 view .LVU991
+	movq	24(%rdi), %rdi
+	.loc 1 675 14 view .LVU992
+	cmpq	%rdi, %rdx
+	movq	%rdi, %rax
+	cmovnb	%rdx, %rax
+	.loc 1 670 6 view .LVU993
+	cmpl	$1, 32(%rbx)
+	je	.L285
+.L262:
+.LVL293:
+	.loc 1 677 3 is_stmt 1 view .LVU994
+	.loc 1 677 16 is_stmt 0 view .LVU995
+	movq	40(%rbx), %rsi
+.LVL294:
+	.loc 1 677 16 view .LVU996
+	cmpq	%rsi, %rax
+	movq	%rsi, %rdi
+	cmovbe	%rax, %rdi
+	testq	%rsi, %rsi
+	cmovne	%rdi, %rax
+.LVL295:
+	.loc 1 681 3 is_stmt 1 view .LVU997
+	.loc 1 686 8 is_stmt 0 view .LVU998
+	movl	$32, %esi
+	.loc 1 681 10 view .LVU999
+	leaq	(%rdx,%rax), %r12
+.LVL296:
+	.loc 1 682 3 is_stmt 1 view .LVU1000
+	.loc 1 683 16 is_stmt 0 view .LVU1001
+	cmpq	%r12, %rcx
+	leaq	1(%rcx), %rax
+.LVL297:
+	.loc 1 686 8 view .LVU1002
+	movl	$1, %edx
+	movq	%rbx, %rdi
+	.loc 1 683 16 view .LVU1003
+	cmovnb	%rax, %r12
+.LVL298:
+	.loc 1 686 3 is_stmt 1 view .LVU1004
+	.loc 1 686 8 view .LVU1005
+	call	st_stats_add@PLT
+.LVL299:
+	.loc 1 686 10 view .LVU1006
+	.loc 1 686 15 view .LVU1007
+	.loc 1 686 13 view .LVU1008
+	.loc 1 686 6 view .LVU1009
+	.loc 1 687 3 view .LVU1010
+.LBB152:
+.LBI152:
+	.loc 1 618 12 view .LVU1011
+.LBB153:
+	.loc 1 619 3 view .LVU1012
+	.loc 1 619 16 is_stmt 0 view .LVU1013
+	movl	56(%rbx), %eax
+	.loc 1 619 6 view .LVU1014
+	cmpl	$2, %eax
+	je	.L258
+	.loc 1 619 48 view .LVU1015
+	cmpq	$0, 48(%rbx)
+	jne	.L258
+	.loc 1 623 3 is_stmt 1 view .LVU1016
+	.loc 1 623 6 is_stmt 0 view .LVU1017
+	cmpl	$3, %eax
+	jne	.L265
+.LBB154:
+	.loc 1 624 5 is_stmt 1 view .LVU1018
+	.loc 1 624 8 is_stmt 0 view .LVU1019
+	cmpq	$256, %r12
+	jbe	.L260
+	.loc 1 629 5 is_stmt 1 view .LVU1020
+	.loc 1 629 28 is_stmt 0 view .LVU1021
+	movq	%r12, %rdi
+	call	malloc@PLT
+.LVL300:
+	movq	%rax, %r13
+.LVL301:
+	.loc 1 630 5 is_stmt 1 view .LVU1022
+	.loc 1 630 10 view .LVU1023
+	movl	$1, %edx
+	movl	$16, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL302:
+	.loc 1 630 12 view .LVU1024
+	.loc 1 630 17 view .LVU1025
+	.loc 1 630 15 view .LVU1026
+	.loc 1 630 8 view .LVU1027
+	.loc 1 631 5 view .LVU1028
+	.loc 1 631 8 is_stmt 0 view .LVU1029
+	testq	%r13, %r13
+	je	.L258
+	.loc 1 634 5 is_stmt 1 view .LVU1030
+	.loc 1 634 10 view .LVU1031
+	movl	$256, %edx
+	movl	$40, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL303:
+	.loc 1 634 14 view .LVU1032
+	.loc 1 634 19 view .LVU1033
+	.loc 1 634 17 view .LVU1034
+	.loc 1 634 8 view .LVU1035
+	.loc 1 635 5 view .LVU1036
+	.loc 1 636 5 view .LVU1037
+	.loc 1 635 5 is_stmt 0 view .LVU1038
+	vmovdqu64	72(%rbx), %zmm0
+	vmovdqu64	136(%rbx), %zmm1
+	vmovdqu64	200(%rbx), %zmm2
+	vmovdqu64	264(%rbx), %zmm3
+	.loc 1 636 23 view .LVU1039
+	movq	%r13, (%rbx)
+	.loc 1 637 5 is_stmt 1 view .LVU1040
+	.loc 1 637 23 is_stmt 0 view .LVU1041
+	movq	%r12, 8(%rbx)
+	.loc 1 638 5 is_stmt 1 view .LVU1042
+	.loc 1 638 26 is_stmt 0 view .LVU1043
+	movl	$1, 56(%rbx)
+	.loc 1 639 5 is_stmt 1 view .LVU1044
+	.loc 1 635 5 is_stmt 0 view .LVU1045
+	vmovdqu64	%zmm0, 0(%r13)
+	vmovdqu64	%zmm1, 64(%r13)
+	vmovdqu64	%zmm2, 128(%r13)
+	vmovdqu64	%zmm3, 192(%r13)
+	vzeroupper
+.LVL304:
+	.p2align 4,,10
+	.p2align 3
+.L260:
+	.loc 1 626 14 view .LVU1046
+	movl	$1, %eax
+.LVL305:
+	.loc 1 626 14 view .LVU1047
+	jmp	.L255
+.LVL306:
+	.p2align 4,,10
+	.p2align 3
+.L285:
+	.loc 1 626 14 view .LVU1048
+.LBE154:
+.LBE153:
+.LBE152:
+	.loc 1 671 5 is_stmt 1 view .LVU1049
+	.loc 1 671 14 is_stmt 0 view .LVU1050
+	cmpq	%rdi, %rsi
+	movq	%rdi, %rax
+	cmovnb	%rsi, %rax
+.LVL307:
+	.loc 1 672 5 is_stmt 1 view .LVU1051
+	.loc 1 672 35 is_stmt 0 view .LVU1052
+	movq	%rax, 24(%rbx)
+	jmp	.L262
+.LVL308:
+	.p2align 4,,10
+	.p2align 3
+.L283:
+	.cfi_def_cfa 7, 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.loc 1 672 35 view .LVU1053
+.LBE151:
+.LBE150:
+	.loc 1 661 12 view .LVU1054
+	xorl	%eax, %eax
+	.loc 1 688 1 view .LVU1055
+	ret
+.LVL309:
+	.p2align 4,,10
+	.p2align 3
+.L265:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -40
+	.cfi_offset 6, -16
+	.cfi_offset 12, -32
+	.cfi_offset 13, -24
+.LBB158:
+.LBB157:
+.LBB156:
+.LBB155:
+	.loc 1 641 3 is_stmt 1 view .LVU1056
+	.loc 1 641 26 is_stmt 0 view .LVU1057
+	movq	(%rbx), %rdi
+	movq	%r12, %rsi
+	call	realloc@PLT
+.LVL310:
+	movq	%rax, %r13
+.LVL311:
+	.loc 1 642 3 is_stmt 1 view .LVU1058
+	.loc 1 642 8 view .LVU1059
+	movl	$1, %edx
+	movl	$24, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL312:
+	.loc 1 642 10 view .LVU1060
+	.loc 1 642 15 view .LVU1061
+	.loc 1 642 13 view .LVU1062
+	.loc 1 642 6 view .LVU1063
+	.loc 1 643 3 view .LVU1064
+	.loc 1 643 6 is_stmt 0 view .LVU1065
+	testq	%r13, %r13
+	je	.L258
+	.loc 1 648 3 is_stmt 1 view .LVU1066
+	.loc 1 648 8 view .LVU1067
+	xorl	%edx, %edx
+	cmpq	(%rbx), %r13
+	je	.L267
+	movq	16(%rbx), %rdx
+.L267:
+	.loc 1 648 8 is_stmt 0 view .LVU1068
+	movl	$40, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL313:
+	.loc 1 648 62 is_stmt 1 view .LVU1069
+	.loc 1 648 67 view .LVU1070
+	.loc 1 648 65 view .LVU1071
+	.loc 1 648 6 view .LVU1072
+	.loc 1 650 3 view .LVU1073
+	.loc 1 650 21 is_stmt 0 view .LVU1074
+	movq	%r13, (%rbx)
+	.loc 1 651 3 is_stmt 1 view .LVU1075
+	.loc 1 651 21 is_stmt 0 view .LVU1076
+	movq	%r12, 8(%rbx)
+	.loc 1 652 3 is_stmt 1 view .LVU1077
+	.loc 1 652 10 is_stmt 0 view .LVU1078
+	jmp	.L260
+.LBE155:
+.LBE156:
+.LBE157:
+.LBE158:
+	.cfi_endproc
+.LFE58:
+	.size	st_expand_string, .-st_expand_string
+	.p2align 4
+	.globl	st_set_growth_policy
+	.type	st_set_growth_policy, @function
+st_set_growth_policy:
+.LVL314:
+.LFB59:
+	.loc 1 693 128 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 694 3 view .LVU1080
+	.loc 1 694 28 is_stmt 0 view .LVU1081
+	movl	%esi, 32(%rdi)
+	.loc 1 695 3 is_stmt 1 view .LVU1082
+	.loc 1 695 28 is_stmt 0 view .LVU1083
+	movq	%rdx, 40(%rdi)
+	.loc 1 696 1 view .LVU1084
+	ret
+	.cfi_endproc
+.LFE59:
+	.size	st_set_growth_policy, .-st_set_growth_policy
+	.p2align 4
+	.globl	st_reserve
+	.type	st_reserve, @function
+st_reserve:
+.LVL315:
+.LFB60:
+	.loc 1 701 72 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 702 3 view .LVU1086
+	.loc 1 702 6 is_stmt 0 view .LVU1087
+	cmpq	%rsi, 8(%rdi)
+	jb	.L306
+	.loc 1 704 12 view .LVU1088
+	movl	$1, %eax
+	.loc 1 707 1 view .LVU1089
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L306:
+	.loc 1 701 72 view .LVU1090
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 13, -24
+	.cfi_offset 12, -32
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	.loc 1 706 3 is_stmt 1 view .LVU1091
+.LVL316:
+.LBB162:
+.LBI162:
+	.loc 1 618 12 view .LVU1092
+.LBB163:
+	.loc 1 619 3 view .LVU1093
+.LBE163:
+.LBE162:
+	.loc 1 701 72 is_stmt 0 view .LVU1094
+	subq	$8, %rsp
+.LBB167:
+.LBB165:
+	.loc 1 619 16 view .LVU1095
+	movl	56(%rdi), %eax
+	.loc 1 619 6 view .LVU1096
+	cmpl	$2, %eax
+	je	.L291
+.LVL317:
+	.loc 1 619 48 view .LVU1097
+	cmpq	$0, 48(%rdi)
+	je	.L307
+.LVL318:
+.L291:
+	.loc 1 621 12 view .LVU1098
+	xorl	%eax, %eax
+.L287:
+.LBE165:
+.LBE167:
+	.loc 1 707 1 view .LVU1099
+	addq	$8, %rsp
+	popq	%rbx
+.LVL319:
+	.loc 1 707 1 view .LVU1100
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL320:
+	.p2align 4,,10
+	.p2align 3
+.L307:
+	.cfi_restore_state
+	.loc 1 707 1 view .LVU1101
+	movq	%rsi, %r12
+.LBB168:
+.LBB166:
+	.loc 1 623 3 is_stmt 1 view .LVU1102
+	.loc 1 623 6 is_stmt 0 view .LVU1103
+	cmpl	$3, %eax
+	jne	.L292
+.LBB164:
+	.loc 1 624 5 is_stmt 1 view .LVU1104
+	.loc 1 624 8 is_stmt 0 view .LVU1105
+	cmpq	$256, %rsi
+	jbe	.L288
+	.loc 1 629 5 is_stmt 1 view .LVU1106
+	.loc 1 629 28 is_stmt 0 view .LVU1107
+	movq	%rsi, %rdi
+	call	malloc@PLT
+.LVL321:
+	.loc 1 629 28 view .LVU1108
+	movq	%rax, %r13
+.LVL322:
+	.loc 1 630 5 is_stmt 1 view .LVU1109
+	.loc 1 630 10 view .LVU1110
+	movl	$1, %edx
+	movl	$16, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL323:
+	.loc 1 630 12 view .LVU1111
+	.loc 1 630 17 view .LVU1112
+	.loc 1 630 15 view .LVU1113
+	.loc 1 630 8 view .LVU1114
+	.loc 1 631 5 view .LVU1115
+	.loc 1 631 8 is_stmt 0 view .LVU1116
+	testq	%r13, %r13
+	je	.L291
+	.loc 1 634 5 is_stmt 1 view .LVU1117
+	.loc 1 634 10 view .LVU1118
+	movl	$256, %edx
+	movl	$40, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL324:
+	.loc 1 634 14 view .LVU1119
+	.loc 1 634 19 view .LVU1120
+	.loc 1 634 17 view .LVU1121
+	.loc 1 634 8 view .LVU1122
+	.loc 1 635 5 view .LVU1123
+	.loc 1 636 5 view .LVU1124
+	.loc 1 635 5 is_stmt 0 view .LVU1125
+	vmovdqu64	72(%rbx), %zmm0
+	vmovdqu64	136(%rbx), %zmm1
+	vmovdqu64	200(%rbx), %zmm2
+	vmovdqu64	264(%rbx), %zmm3
+	.loc 1 636 23 view .LVU1126
+	movq	%r13, (%rbx)
+	.loc 1 637 5 is_stmt 1 view .LVU1127
+	.loc 1 637 23 is_stmt 0 view .LVU1128
+	movq	%r12, 8(%rbx)
+	.loc 1 638 5 is_stmt 1 view .LVU1129
+	.loc 1 638 26 is_stmt 0 view .LVU1130
+	movl	$1, 56(%rbx)
+	.loc 1 639 5 is_stmt 1 view .LVU1131
+	.loc 1 635 5 is_stmt 0 view .LVU1132
+	vmovdqu64	%zmm0, 0(%r13)
+	vmovdqu64	%zmm1, 64(%r13)
+	vmovdqu64	%zmm2, 128(%r13)
+	vmovdqu64	%zmm3, 192(%r13)
+	vzeroupper
+.LVL325:
+	.loc 1 639 12 view .LVU1133
+	jmp	.L288
+.LVL326:
+	.p2align 4,,10
+	.p2align 3
+.L292:
+	.loc 1 639 12 view .LVU1134
+.LBE164:
+	.loc 1 641 3 is_stmt 1 view .LVU1135
+	.loc 1 641 26 is_stmt 0 view .LVU1136
+	movq	(%rdi), %rdi
+	call	realloc@PLT
+.LVL327:
+	.loc 1 641 26 view .LVU1137
+	movq	%rax, %r13
+.LVL328:
+	.loc 1 642 3 is_stmt 1 view .LVU1138
+	.loc 1 642 8 view .LVU1139
+	movl	$1, %edx
+	movl	$24, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL329:
+	.loc 1 642 10 view .LVU1140
+	.loc 1 642 15 view .LVU1141
+	.loc 1 642 13 view .LVU1142
+	.loc 1 642 6 view .LVU1143
+	.loc 1 643 3 view .LVU1144
+	.loc 1 643 6 is_stmt 0 view .LVU1145
+	testq	%r13, %r13
+	je	.L291
+	.loc 1 648 3 is_stmt 1 view .LVU1146
+	.loc 1 648 8 view .LVU1147
+	xorl	%edx, %edx
+	cmpq	(%rbx), %r13
+	je	.L294
+	movq	16(%rbx), %rdx
+.L294:
+	.loc 1 648 8 is_stmt 0 view .LVU1148
+	movl	$40, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL330:
+	.loc 1 648 62 is_stmt 1 view .LVU1149
+	.loc 1 648 67 view .LVU1150
+	.loc 1 648 65 view .LVU1151
+	.loc 1 648 6 view .LVU1152
+	.loc 1 650 3 view .LVU1153
+	.loc 1 650 21 is_stmt 0 view .LVU1154
+	movq	%r13, (%rbx)
+	.loc 1 651 3 is_stmt 1 view .LVU1155
+	.loc 1 651 21 is_stmt 0 view .LVU1156
+	movq	%r12, 8(%rbx)
+	.loc 1 652 3 is_stmt 1 view .LVU1157
+.LVL331:
+.L288:
+	.loc 1 652 3 is_stmt 0 view .LVU1158
+.LBE166:
+.LBE168:
+	.loc 1 704 12 view .LVU1159
+	movl	$1, %eax
+	jmp	.L287
+	.cfi_endproc
+.LFE60:
+	.size	st_reserve, .-st_reserve
+	.p2align 4
+	.globl	st_pool_acquire
+	.type	st_pool_acquire, @function
+st_pool_acquire:
+.LVL332:
+.LFB35:
+	.loc 1 192 67 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 193 3 view .LVU1161
+	.loc 1 192 67 is_stmt 0 view .LVU1162
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 193 35 view .LVU1163
+	leaq	string_tokenizer_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL333:
+	.loc 1 193 35 view .LVU1164
+	movq	string_tokenizer_pool_count@dtpoff(%rax), %rdx
+	.loc 1 193 6 view .LVU1165
+	testq	%rdx, %rdx
+	je	.L312
+	.loc 1 196 3 is_stmt 1 view .LVU1166
+	.loc 1 196 61 is_stmt 0 view .LVU1167
+	decq	%rdx
+	.loc 1 196 27 view .LVU1168
+	movq	string_tokenizer_pool@dtpoff(%rax,%rdx,8), %rbp
+.LVL334:
+	.loc 1 197 3 is_stmt 1 view .LVU1169
+	.loc 1 197 7 is_stmt 0 view .LVU1170
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	.loc 1 196 27 view .LVU1171
+	movq	%rdx, string_tokenizer_pool_count@dtpoff(%rax)
+	.loc 1 197 7 view .LVU1172
+	call	st_reserve@PLT
+.LVL335:
+	.loc 1 197 6 view .LVU1173
+	testl	%eax, %eax
+	je	.L313
+.LVL336:
+.L308:
+	.loc 1 202 1 view .LVU1174
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL337:
+	.loc 1 202 1 view .LVU1175
+	movq	%rbp, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL338:
+	.p2align 4,,10
+	.p2align 3
+.L312:
+	.cfi_restore_state
+	.loc 1 194 5 is_stmt 1 view .LVU1176
+	.loc 1 202 1 is_stmt 0 view .LVU1177
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 194 12 view .LVU1178
+	movq	%rbx, %rdi
+	.loc 1 202 1 view .LVU1179
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL339:
+	.loc 1 202 1 view .LVU1180
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	.loc 1 194 12 view .LVU1181
+	jmp	st_create_empty@PLT
+.LVL340:
+	.p2align 4,,10
+	.p2align 3
+.L313:
+	.cfi_restore_state
+	.loc 1 198 5 is_stmt 1 view .LVU1182
+	movq	%rbp, %rdi
+	call	st_destroy@PLT
+.LVL341:
+	.loc 1 199 5 view .LVU1183
+	.loc 1 199 11 is_stmt 0 view .LVU1184
+	xorl	%ebp, %ebp
+.LVL342:
+	.loc 1 199 11 view .LVU1185
+	jmp	.L308
+	.cfi_endproc
+.LFE35:
+	.size	st_pool_acquire, .-st_pool_acquire
+	.p2align 4
+	.globl	st_shrink_to_fit
+	.type	st_shrink_to_fit, @function
+st_shrink_to_fit:
+.LVL343:
+.LFB61:
+	.loc 1 712 57 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 713 3 view .LVU1187
+	.loc 1 712 57 is_stmt 0 view .LVU1188
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$8, %rsp
+	.cfi_offset 13, -24
+	.cfi_offset 12, -32
+	.cfi_offset 3, -40
+	.loc 1 713 28 view .LVU1189
+	movq	16(%rdi), %rdx
+	.loc 1 713 10 view .LVU1190
+	leaq	1(%rdx), %r12
+.LVL344:
+	.loc 1 714 3 is_stmt 1 view .LVU1191
+	.loc 1 714 6 is_stmt 0 view .LVU1192
+	cmpq	8(%rdi), %r12
+	jb	.L331
+.LVL345:
+.L315:
+	.loc 1 724 1 view .LVU1193
+	addq	$8, %rsp
+	popq	%rbx
+	popq	%r12
+.LVL346:
+	.loc 1 724 1 view .LVU1194
+	popq	%r13
+	.loc 1 716 12 view .LVU1195
+	movl	$1, %eax
+	.loc 1 724 1 view .LVU1196
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL347:
+	.p2align 4,,10
+	.p2align 3
+.L331:
+	.cfi_restore_state
+.LBB172:
+.LBB173:
+	.loc 1 619 16 view .LVU1197
+	movl	56(%rdi), %eax
+	movq	%rdi, %rbx
+.LBE173:
+.LBE172:
+	.loc 1 718 3 is_stmt 1 view .LVU1198
+.LVL348:
+.LBB179:
+.LBI172:
+	.loc 1 618 12 view .LVU1199
+.LBB176:
+	.loc 1 619 3 view .LVU1200
+	.loc 1 619 6 is_stmt 0 view .LVU1201
+	cmpl	$2, %eax
+	je	.L318
+.LVL349:
+	.loc 1 619 48 view .LVU1202
+	cmpq	$0, 48(%rdi)
+	je	.L332
+.L318:
+	.loc 1 619 48 view .LVU1203
+.LBE176:
+.LBE179:
+	.loc 1 724 1 view .LVU1204
+	addq	$8, %rsp
+	popq	%rbx
+.LVL350:
+	.loc 1 724 1 view .LVU1205
+	popq	%r12
+.LVL351:
+	.loc 1 724 1 view .LVU1206
+	popq	%r13
+	.loc 1 719 12 view .LVU1207
+	xorl	%eax, %eax
+	.loc 1 724 1 view .LVU1208
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL352:
+	.p2align 4,,10
+	.p2align 3
+.L332:
+	.cfi_restore_state
+.LBB180:
+.LBB177:
+	.loc 1 623 3 is_stmt 1 view .LVU1209
+	.loc 1 623 6 is_stmt 0 view .LVU1210
+	cmpl	$3, %eax
+	jne	.L319
+.LBB174:
+	.loc 1 624 5 is_stmt 1 view .LVU1211
+	.loc 1 624 8 is_stmt 0 view .LVU1212
+	cmpq	$256, %r12
+	ja	.L320
+.LBE174:
+	.loc 1 641 43 view .LVU1213
+	movq	(%rdi), %r13
+	jmp	.L321
+	.p2align 4,,10
+	.p2align 3
+.L319:
+	.loc 1 641 3 is_stmt 1 view .LVU1214
+	.loc 1 641 26 is_stmt 0 view .LVU1215
+	movq	(%rdi), %rdi
+	movq	%r12, %rsi
+	call	realloc@PLT
+.LVL353:
+	movq	%rax, %r13
+.LVL354:
+	.loc 1 642 3 is_stmt 1 view .LVU1216
+	.loc 1 642 8 view .LVU1217
+	movl	$1, %edx
+	movl	$24, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL355:
+	.loc 1 642 10 view .LVU1218
+	.loc 1 642 15 view .LVU1219
+	.loc 1 642 13 view .LVU1220
+	.loc 1 642 6 view .LVU1221
+	.loc 1 643 3 view .LVU1222
+	.loc 1 643 6 is_stmt 0 view .LVU1223
+	testq	%r13, %r13
+	je	.L318
+	.loc 1 648 3 is_stmt 1 view .LVU1224
+	.loc 1 648 8 view .LVU1225
+	xorl	%edx, %edx
+	cmpq	(%rbx), %r13
+	je	.L322
+	movq	16(%rbx), %rdx
+.L322:
+	.loc 1 648 8 is_stmt 0 view .LVU1226
+	movl	$40, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL356:
+	.loc 1 648 62 is_stmt 1 view .LVU1227
+	.loc 1 648 67 view .LVU1228
+	.loc 1 648 65 view .LVU1229
+	.loc 1 648 6 view .LVU1230
+	.loc 1 650 3 view .LVU1231
+	.loc 1 650 21 is_stmt 0 view .LVU1232
+	movq	%r13, (%rbx)
+	.loc 1 651 3 is_stmt 1 view .LVU1233
+	.loc 1 651 21 is_stmt 0 view .LVU1234
+	movq	%r12, 8(%rbx)
+	.loc 1 652 3 is_stmt 1 view .LVU1235
+.LVL357:
+	.loc 1 652 3 is_stmt 0 view .LVU1236
+.LBE177:
+.LBE180:
+	.loc 1 722 30 view .LVU1237
+	movq	16(%rbx), %rdx
+.L321:
+	.loc 1 722 3 is_stmt 1 view .LVU1238
+	.loc 1 722 42 is_stmt 0 view .LVU1239
+	movb	$0, 0(%r13,%rdx)
+	.loc 1 723 3 is_stmt 1 view .LVU1240
+	.loc 1 723 10 is_stmt 0 view .LVU1241
+	jmp	.L315
+.LVL358:
+	.p2align 4,,10
+	.p2align 3
+.L320:
+.LBB181:
+.LBB178:
+.LBB175:
+	.loc 1 629 5 is_stmt 1 view .LVU1242
+	.loc 1 629 28 is_stmt 0 view .LVU1243
+	movq	%r12, %rdi
+	call	malloc@PLT
+.LVL359:
+	movq	%rax, %r13
+.LVL360:
+	.loc 1 630 5 is_stmt 1 view .LVU1244
+	.loc 1 630 10 view .LVU1245
+	movl	$1, %edx
+	movl	$16, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL361:
+	.loc 1 630 12 view .LVU1246
+	.loc 1 630 17 view .LVU1247
+	.loc 1 630 15 view .LVU1248
+	.loc 1 630 8 view .LVU1249
+	.loc 1 631 5 view .LVU1250
+	.loc 1 631 8 is_stmt 0 view .LVU1251
+	testq	%r13, %r13
+	je	.L318
+	.loc 1 634 5 is_stmt 1 view .LVU1252
+	.loc 1 634 10 view .LVU1253
+	movl	$256, %edx
+	movl	$40, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL362:
+	.loc 1 634 14 view .LVU1254
+	.loc 1 634 19 view .LVU1255
+	.loc 1 634 17 view .LVU1256
+	.loc 1 634 8 view .LVU1257
+	.loc 1 635 5 view .LVU1258
+	.loc 1 636 5 view .LVU1259
+	.loc 1 635 5 is_stmt 0 view .LVU1260
+	vmovdqu64	72(%rbx), %zmm0
+	vmovdqu64	136(%rbx), %zmm1
+	vmovdqu64	200(%rbx), %zmm2
+	vmovdqu64	264(%rbx), %zmm3
+	.loc 1 636 23 view .LVU1261
+	movq	%r13, (%rbx)
+	.loc 1 637 5 is_stmt 1 view .LVU1262
+	.loc 1 637 23 is_stmt 0 view .LVU1263
+	movq	%r12, 8(%rbx)
+	.loc 1 638 5 is_stmt 1 view .LVU1264
+	.loc 1 638 26 is_stmt 0 view .LVU1265
+	movl	$1, 56(%rbx)
+	.loc 1 639 5 is_stmt 1 view .LVU1266
+.LVL363:
+	.loc 1 635 5 is_stmt 0 view .LVU1267
+	vmovdqu64	%zmm0, 0(%r13)
+	vmovdqu64	%zmm1, 64(%r13)
+	vmovdqu64	%zmm2, 128(%r13)
+	vmovdqu64	%zmm3, 192(%r13)
+.LBE175:
+.LBE178:
+.LBE181:
+	.loc 1 722 30 view .LVU1268
+	movq	16(%rbx), %rdx
+	vzeroupper
+.LVL364:
+	jmp	.L321
+	.cfi_endproc
+.LFE61:
+	.size	st_shrink_to_fit, .-st_shrink_to_fit
+	.p2align 4
+	.globl	st_append_n
+	.type	st_append_n, @function
+st_append_n:
+.LVL365:
+.LFB62:
+	.loc 1 729 93 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 731 3 view .LVU1270
+	.loc 1 729 93 is_stmt 0 view .LVU1271
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	.loc 1 731 7 view .LVU1272
+	movq	%rdx, %rsi
+.LVL366:
+	.loc 1 729 93 view .LVU1273
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 729 93 view .LVU1274
+	movq	%rdx, %rbx
+	.loc 1 731 7 view .LVU1275
+	call	st_expand_string@PLT
+.LVL367:
+	.loc 1 731 6 view .LVU1276
+	testl	%eax, %eax
+	je	.L333
+.LVL368:
+.LBB184:
+.LBI184:
+	.loc 1 729 5 is_stmt 1 view .LVU1277
+.LBB185:
+	.loc 1 735 3 view .LVU1278
+	.loc 1 735 28 is_stmt 0 view .LVU1279
+	movq	16(%rbp), %rdi
+	.loc 1 735 3 view .LVU1280
+	movq	%rbx, %rdx
+	.loc 1 735 28 view .LVU1281
+	addq	0(%rbp), %rdi
+	.loc 1 735 3 view .LVU1282
+	movq	%r12, %rsi
+	call	memcpy@PLT
+.LVL369:
+	.loc 1 736 3 is_stmt 1 view .LVU1283
+	.loc 1 738 42 is_stmt 0 view .LVU1284
+	movq	0(%rbp), %rax
+	.loc 1 736 23 view .LVU1285
+	addq	16(%rbp), %rbx
+.LVL370:
+	.loc 1 736 23 view .LVU1286
+	movq	%rbx, 16(%rbp)
+	.loc 1 738 3 is_stmt 1 view .LVU1287
+	.loc 1 738 42 is_stmt 0 view .LVU1288
+	movb	$0, (%rax,%rbx)
+	.loc 1 740 3 is_stmt 1 view .LVU1289
+.LVL371:
+	.loc 1 738 42 is_stmt 0 view .LVU1290
+	movl	$1, %eax
+.L333:
+.LBE185:
+.LBE184:
+	.loc 1 741 1 view .LVU1291
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL372:
+	.loc 1 741 1 view .LVU1292
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL373:
+	.loc 1 741 1 view .LVU1293
+	ret
+	.cfi_endproc
+.LFE62:
+	.size	st_append_n, .-st_append_n
+	.p2align 4
+	.globl	st_append_char
+	.type	st_append_char, @function
+st_append_char:
+.LVL374:
+.LFB63:
+	.loc 1 746 73 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 748 3 view .LVU1295
+	.loc 1 746 73 is_stmt 0 view .LVU1296
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%esi, %ebp
+	.loc 1 748 7 view .LVU1297
+	movl	$1, %esi
+.LVL375:
+	.loc 1 746 73 view .LVU1298
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 748 7 view .LVU1299
+	call	st_expand_string@PLT
+.LVL376:
+	.loc 1 748 6 view .LVU1300
+	testl	%eax, %eax
+	je	.L339
+	.loc 1 751 3 is_stmt 1 view .LVU1301
+	.loc 1 751 30 is_stmt 0 view .LVU1302
+	movq	16(%rbx), %rax
+	.loc 1 751 12 view .LVU1303
+	movq	(%rbx), %rdx
+	.loc 1 751 40 view .LVU1304
+	leaq	1(%rax), %rcx
+	movq	%rcx, 16(%rbx)
+	.loc 1 751 44 view .LVU1305
+	movb	%bpl, (%rdx,%rax)
+	.loc 1 753 3 is_stmt 1 view .LVU1306
+	.loc 1 753 42 is_stmt 0 view .LVU1307
+	movq	16(%rbx), %rax
+	movq	(%rbx), %rdx
+	movb	$0, (%rdx,%rax)
+	.loc 1 754 3 is_stmt 1 view .LVU1308
+	.loc 1 754 10 is_stmt 0 view .LVU1309
+	movl	$1, %eax
+.L339:
+	.loc 1 755 1 view .LVU1310
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL377:
+	.loc 1 755 1 view .LVU1311
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE63:
+	.size	st_append_char, .-st_append_char
+	.p2align 4
+	.globl	st_append_many
+	.type	st_append_many, @function
+st_append_many:
+.LVL378:
+.LFB64:
+	.loc 1 760 111 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 762 3 view .LVU1313
+	.loc 1 763 3 view .LVU1314
+.LBB186:
+	.loc 1 763 8 view .LVU1315
+	.loc 1 763 24 view .LVU1316
+.LBE186:
+	.loc 1 760 111 is_stmt 0 view .LVU1317
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_offset 14, -24
+	.cfi_offset 13, -32
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbx
+	andq	$-32, %rsp
+	.cfi_offset 3, -48
+.LBB187:
+	.loc 1 763 24 view .LVU1318
+	testq	%rdx, %rdx
+	je	.L346
+	movq	%rdx, %r14
+	leaq	-1(%rdx), %rdx
+.LVL379:
+	.loc 1 763 24 view .LVU1319
+	movq	%rsi, %rbx
+	cmpq	$4, %rdx
+	jbe	.L355
+	movq	%rdx, %rcx
+	shrq	$2, %rcx
+	salq	$6, %rcx
+	vmovdqa	.LC2(%rip), %ymm2
+	movq	%rsi, %rax
+	addq	%rsi, %rcx
+	vpxor	%xmm1, %xmm1, %xmm1
+.LVL380:
+	.p2align 4,,10
+	.p2align 3
+.L348:
+	.loc 1 764 5 is_stmt 1 discriminator 3 view .LVU1320
+	.loc 1 764 27 is_stmt 0 discriminator 3 view .LVU1321
+	vmovdqu	8(%rax), %ymm0
+	addq	$64, %rax
+	vpermt2q	-24(%rax), %ymm2, %ymm0
+	.loc 1 764 12 discriminator 3 view .LVU1322
+	vpaddq	%ymm0, %ymm1, %ymm1
+.LVL381:
+	.loc 1 763 34 is_stmt 1 discriminator 3 view .LVU1323
+	.loc 1 763 24 discriminator 3 view .LVU1324
+	cmpq	%rcx, %rax
+	jne	.L348
+	vmovdqa	%xmm1, %xmm0
+	vextracti64x2	$0x1, %ymm1, %xmm1
+	vpaddq	%xmm1, %xmm0, %xmm0
+	vpsrldq	$8, %xmm0, %xmm1
+	movq	%rdx, %rax
+	vpaddq	%xmm1, %xmm0, %xmm0
+	andq	$-4, %rax
+	vmovq	%xmm0, %r13
+	vzeroupper
+.LVL382:
+.L347:
+	.loc 1 764 5 view .LVU1325
+	.loc 1 764 24 is_stmt 0 view .LVU1326
+	movq	%rax, %rdx
+	salq	$4, %rdx
+	.loc 1 763 34 view .LVU1327
+	leaq	1(%rax), %rcx
+	.loc 1 764 12 view .LVU1328
+	addq	8(%rbx,%rdx), %r13
+.LVL383:
+	.loc 1 763 34 is_stmt 1 view .LVU1329
+	.loc 1 763 24 view .LVU1330
+	cmpq	%r14, %rcx
+	jnb	.L349
+	.loc 1 764 5 view .LVU1331
+	.loc 1 763 34 is_stmt 0 view .LVU1332
+	leaq	2(%rax), %rcx
+	.loc 1 764 12 view .LVU1333
+	addq	24(%rbx,%rdx), %r13
+.LVL384:
+	.loc 1 763 34 is_stmt 1 view .LVU1334
+	.loc 1 763 24 view .LVU1335
+	cmpq	%r14, %rcx
+	jnb	.L349
+	.loc 1 764 5 view .LVU1336
+	.loc 1 763 34 is_stmt 0 view .LVU1337
+	leaq	3(%rax), %rcx
+	.loc 1 764 12 view .LVU1338
+	addq	40(%rbx,%rdx), %r13
+.LVL385:
+	.loc 1 763 34 is_stmt 1 view .LVU1339
+	.loc 1 763 24 view .LVU1340
+	cmpq	%r14, %rcx
+	jnb	.L349
+	.loc 1 764 5 view .LVU1341
+	.loc 1 763 34 is_stmt 0 view .LVU1342
+	addq	$4, %rax
+	.loc 1 764 12 view .LVU1343
+	addq	56(%rbx,%rdx), %r13
+.LVL386:
+	.loc 1 763 34 is_stmt 1 view .LVU1344
+	.loc 1 763 24 view .LVU1345
+	cmpq	%r14, %rax
+	jnb	.L349
+	.loc 1 764 5 view .LVU1346
+	.loc 1 764 12 is_stmt 0 view .LVU1347
+	addq	72(%rbx,%rdx), %r13
+.LVL387:
+	.loc 1 763 34 is_stmt 1 view .LVU1348
+	.loc 1 763 24 view .LVU1349
+.L349:
+	.loc 1 763 24 is_stmt 0 view .LVU1350
+.LBE187:
+	.loc 1 766 3 is_stmt 1 view .LVU1351
+	.loc 1 766 7 is_stmt 0 view .LVU1352
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+.LVL388:
+	.loc 1 766 7 view .LVU1353
+	call	st_expand_string@PLT
+.LVL389:
+	.loc 1 766 6 view .LVU1354
+	testl	%eax, %eax
+	je	.L353
+	.loc 1 770 3 is_stmt 1 view .LVU1355
+	.loc 1 770 9 is_stmt 0 view .LVU1356
+	movq	16(%r12), %rcx
+	salq	$4, %r14
+.LVL390:
+	.loc 1 770 9 view .LVU1357
+	addq	(%r12), %rcx
+.LVL391:
+	.loc 1 771 3 is_stmt 1 view .LVU1358
+.LBB188:
+	.loc 1 771 8 view .LVU1359
+	.loc 1 771 24 view .LVU1360
+	addq	%rbx, %r14
+.LVL392:
+	.p2align 4,,10
+	.p2align 3
+.L352:
+	.loc 1 772 5 discriminator 3 view .LVU1361
+	movq	(%rbx), %rsi
+	movq	8(%rbx), %rdx
+	movq	%rcx, %rdi
+	call	memcpy@PLT
+.LVL393:
+	.loc 1 773 17 is_stmt 0 discriminator 3 view .LVU1362
+	movq	8(%rbx), %rcx
+	.loc 1 771 24 discriminator 3 view .LVU1363
+	addq	$16, %rbx
+	.loc 1 773 17 discriminator 3 view .LVU1364
+	addq	%rax, %rcx
+	.loc 1 771 34 is_stmt 1 discriminator 3 view .LVU1365
+	.loc 1 771 24 discriminator 3 view .LVU1366
+	cmpq	%r14, %rbx
+	jne	.L352
+.LVL394:
+.L354:
+	.loc 1 771 24 is_stmt 0 discriminator 3 view .LVU1367
+.LBE188:
+	.loc 1 775 3 is_stmt 1 view .LVU1368
+	.loc 1 777 42 is_stmt 0 view .LVU1369
+	movq	(%r12), %rax
+	.loc 1 775 23 view .LVU1370
+	addq	16(%r12), %r13
+	movq	%r13, 16(%r12)
+	.loc 1 777 3 is_stmt 1 view .LVU1371
+	.loc 1 777 42 is_stmt 0 view .LVU1372
+	movb	$0, (%rax,%r13)
+	.loc 1 778 3 is_stmt 1 view .LVU1373
+	.loc 1 779 1 is_stmt 0 view .LVU1374
+	leaq	-32(%rbp), %rsp
+	.loc 1 778 10 view .LVU1375
+	movl	$1, %eax
+	.loc 1 779 1 view .LVU1376
+	popq	%rbx
+	popq	%r12
+.LVL395:
+	.loc 1 779 1 view .LVU1377
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL396:
+	.p2align 4,,10
+	.p2align 3
+.L346:
+	.cfi_restore_state
+	.loc 1 766 3 is_stmt 1 view .LVU1378
+	.loc 1 766 7 is_stmt 0 view .LVU1379
+	xorl	%esi, %esi
+.LVL397:
+	.loc 1 766 7 view .LVU1380
+	call	st_expand_string@PLT
+.LVL398:
+	.loc 1 762 10 view .LVU1381
+	xorl	%r13d, %r13d
+	.loc 1 766 6 view .LVU1382
+	testl	%eax, %eax
+	jne	.L354
+.LVL399:
+.L353:
+	.loc 1 779 1 view .LVU1383
+	leaq	-32(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+.LVL400:
+	.loc 1 779 1 view .LVU1384
+	popq	%r13
+	popq	%r14
+	.loc 1 767 12 view .LVU1385
+	xorl	%eax, %eax
+	.loc 1 779 1 view .LVU1386
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL401:
+.L355:
+	.cfi_restore_state
+.LBB189:
+	.loc 1 763 15 view .LVU1387
+	xorl	%eax, %eax
+.LBE189:
+	.loc 1 762 10 view .LVU1388
+	xorl	%r13d, %r13d
+	jmp	.L347
+	.cfi_endproc
+.LFE64:
+	.size	st_append_many, .-st_append_many
+	.p2align 4
+	.globl	st_append_string
+	.type	st_append_string, @function
+st_append_string:
+.LVL402:
+.LFB65:
+	.loc 1 784 77 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 785 3 view .LVU1390
+	.loc 1 784 77 is_stmt 0 view .LVU1391
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	.loc 1 785 10 view .LVU1392
+	movq	%rsi, %rdi
+.LVL403:
+	.loc 1 784 77 view .LVU1393
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 785 10 view .LVU1394
+	call	strlen@PLT
+.LVL404:
+	.loc 1 786 1 view .LVU1395
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	.loc 1 785 10 view .LVU1396
+	movq	%rbx, %rsi
+	.loc 1 786 1 view .LVU1397
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL405:
+	.loc 1 785 10 view .LVU1398
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	.loc 1 786 1 view .LVU1399
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL406:
+	.loc 1 785 10 view .LVU1400
+	jmp	st_append_n@PLT
+.LVL407:
+	.loc 1 785 10 view .LVU1401
+	.cfi_endproc
+.LFE65:
+	.size	st_append_string, .-st_append_string
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"\""
+	.text
+	.p2align 4
+	.globl	st_append_quoted_string
+	.type	st_append_quoted_string, @function
+st_append_quoted_string:
+.LVL408:
+.LFB66:
+	.loc 1 791 84 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 792 3 view .LVU1403
+	.loc 1 791 84 is_stmt 0 view .LVU1404
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 792 21 view .LVU1405
+	leaq	.LC3(%rip), %rbp
+	.loc 1 791 84 view .LVU1406
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+.LVL409:
+	.loc 1 791 84 view .LVU1407
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 792 21 view .LVU1408
+	movq	%rbp, (%rsp)
+	movq	%rsi, 16(%rsp)
+	movq	$1, 8(%rsp)
+	.loc 1 792 56 view .LVU1409
+	call	strlen@PLT
+.LVL410:
+	.loc 1 793 10 view .LVU1410
+	movq	%rsp, %rsi
+	movq	%rbx, %rdi
+	movl	$3, %edx
+	.loc 1 792 21 view .LVU1411
+	movq	%rbp, 32(%rsp)
+	movq	%rax, 24(%rsp)
+	movq	$1, 40(%rsp)
+	.loc 1 793 3 is_stmt 1 view .LVU1412
+	.loc 1 793 10 is_stmt 0 view .LVU1413
+	call	st_append_many@PLT
+.LVL411:
+	.loc 1 794 1 view .LVU1414
+	addq	$56, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL412:
+	.loc 1 794 1 view .LVU1415
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE66:
+	.size	st_append_quoted_string, .-st_append_quoted_string
+	.p2align 4
+	.globl	st_append_escaped_n
+	.type	st_append_escaped_n, @function
+st_append_escaped_n:
+.LVL413:
+.LFB67:
+	.loc 1 799 101 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 800 3 view .LVU1417
+	.loc 1 802 3 view .LVU1418
+	.loc 1 799 101 is_stmt 0 view .LVU1419
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	.loc 1 802 7 view .LVU1420
+	leaq	2(%rdx), %rsi
+.LVL414:
+	.loc 1 799 101 view .LVU1421
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 802 7 view .LVU1422
+	call	st_expand_string@PLT
+.LVL415:
+	.loc 1 802 6 view .LVU1423
+	testl	%eax, %eax
+	je	.L370
+	.loc 1 805 3 is_stmt 1 view .LVU1424
+	.loc 1 805 30 is_stmt 0 view .LVU1425
+	movq	16(%r14), %rax
+	.loc 1 805 12 view .LVU1426
+	movq	(%r14), %rdx
+	.loc 1 805 40 view .LVU1427
+	leaq	1(%rax), %rsi
+	movq	%rsi, 16(%r14)
+	.loc 1 805 44 view .LVU1428
+	movb	$34, (%rdx,%rax)
+	.loc 1 806 3 is_stmt 1 view .LVU1429
+.LVL416:
+	.loc 1 807 3 view .LVU1430
+	.loc 1 807 16 view .LVU1431
+	testq	%rbp, %rbp
+	je	.L369
+	.loc 1 806 10 is_stmt 0 view .LVU1432
+	xorl	%r13d, %r13d
+.LVL417:
+	.p2align 4,,10
+	.p2align 3
+.L382:
+.LBB190:
+	.loc 1 809 5 is_stmt 1 view .LVU1433
+	.loc 1 809 18 is_stmt 0 view .LVU1434
+	leaq	(%r12,%r13), %r15
+	movq	%rbp, %rsi
+	subq	%r13, %rsi
+	movq	%r15, %rdi
+	call	st_scan_escape@PLT
+.LVL418:
+	.loc 1 810 9 view .LVU1435
+	leaq	7(%rax), %rsi
+	movq	%r14, %rdi
+	.loc 1 809 18 view .LVU1436
+	movq	%rax, %rbx
+.LVL419:
+	.loc 1 810 5 is_stmt 1 view .LVU1437
+	.loc 1 810 9 is_stmt 0 view .LVU1438
+	call	st_expand_string@PLT
+.LVL420:
+	.loc 1 810 8 view .LVU1439
+	testl	%eax, %eax
+	je	.L370
+	.loc 1 813 5 is_stmt 1 view .LVU1440
+	.loc 1 813 30 is_stmt 0 view .LVU1441
+	movq	16(%r14), %rdi
+	.loc 1 813 5 view .LVU1442
+	movq	%rbx, %rdx
+	.loc 1 813 30 view .LVU1443
+	addq	(%r14), %rdi
+	.loc 1 813 5 view .LVU1444
+	movq	%r15, %rsi
+	call	memcpy@PLT
+.LVL421:
+	.loc 1 814 5 is_stmt 1 view .LVU1445
+	.loc 1 814 25 is_stmt 0 view .LVU1446
+	movq	16(%r14), %rax
+	addq	%rbx, %rax
+	.loc 1 815 11 view .LVU1447
+	addq	%r13, %rbx
+.LVL422:
+	.loc 1 814 25 view .LVU1448
+	movq	%rax, 16(%r14)
+	.loc 1 815 5 is_stmt 1 view .LVU1449
+.LVL423:
+	.loc 1 816 5 view .LVU1450
+	.loc 1 816 8 is_stmt 0 view .LVU1451
+	cmpq	%rbx, %rbp
+	je	.L371
+	.loc 1 820 5 is_stmt 1 view .LVU1452
+	.loc 1 821 48 is_stmt 0 view .LVU1453
+	movzbl	(%r12,%rbx), %edx
+	.loc 1 820 11 view .LVU1454
+	addq	(%r14), %rax
+.LVL424:
+	.loc 1 821 5 is_stmt 1 view .LVU1455
+	.loc 1 822 20 is_stmt 0 view .LVU1456
+	movb	$92, (%rax)
+	.loc 1 821 54 view .LVU1457
+	leaq	1(%rbx), %r13
+.LVL425:
+	.loc 1 822 5 is_stmt 1 view .LVU1458
+	.loc 1 823 5 view .LVU1459
+	cmpb	$34, %dl
+	jg	.L372
+	cmpb	$7, %dl
+	jle	.L373
+	leal	-8(%rdx), %esi
+	cmpb	$26, %sil
+	ja	.L373
+	leaq	.L375(%rip), %rcx
+	movzbl	%sil, %esi
+	movslq	(%rcx,%rsi,4), %rsi
+	addq	%rcx, %rsi
+	jmp	*%rsi
+	.section	.rodata
+	.align 4
+	.align 4
+.L375:
+	.long	.L380-.L375
+	.long	.L379-.L375
+	.long	.L378-.L375
+	.long	.L373-.L375
+	.long	.L383-.L375
+	.long	.L376-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L373-.L375
+	.long	.L377-.L375
+	.text
+	.p2align 4,,10
+	.p2align 3
+.L372:
+	cmpb	$92, %dl
+	je	.L377
+.L373:
+	.loc 1 844 9 discriminator 1 view .LVU1460
+	.loc 1 845 43 is_stmt 0 discriminator 1 view .LVU1461
+	movl	%edx, %esi
+	.loc 1 844 9 discriminator 1 view .LVU1462
+	movl	$12405, %ecx
+	.loc 1 845 43 discriminator 1 view .LVU1463
+	shrb	$4, %sil
+	.loc 1 844 9 discriminator 1 view .LVU1464
+	movw	%cx, 1(%rax)
+	.loc 1 845 24 discriminator 1 view .LVU1465
+	xorl	%ebx, %ebx
+	leaq	hex_digits.0(%rip), %rcx
+	.loc 1 845 36 discriminator 1 view .LVU1466
+	andl	$15, %esi
+	.loc 1 845 24 discriminator 1 view .LVU1467
+	movb	(%rcx,%rsi), %bl
+	.loc 1 846 36 discriminator 1 view .LVU1468
+	andl	$15, %edx
+.LVL426:
+	.loc 1 845 24 discriminator 1 view .LVU1469
+	movb	(%rcx,%rdx), %bh
+	.loc 1 844 9 discriminator 1 view .LVU1470
+	movb	$48, 3(%rax)
+	.loc 1 845 9 is_stmt 1 discriminator 1 view .LVU1471
+	.loc 1 846 9 discriminator 1 view .LVU1472
+	.loc 1 845 24 is_stmt 0 discriminator 1 view .LVU1473
+	movw	%bx, 4(%rax)
+	.loc 1 847 9 is_stmt 1 discriminator 1 view .LVU1474
+	.loc 1 847 29 is_stmt 0 discriminator 1 view .LVU1475
+	movq	16(%r14), %rax
+.LVL427:
+	.loc 1 847 29 discriminator 1 view .LVU1476
+	addq	$6, %rax
+	.loc 1 848 9 is_stmt 1 discriminator 1 view .LVU1477
+	.p2align 4,,10
+	.p2align 3
+.L381:
+	.loc 1 847 29 is_stmt 0 view .LVU1478
+	movq	%rax, 16(%r14)
+	.loc 1 847 29 view .LVU1479
+.LBE190:
+	.loc 1 807 16 is_stmt 1 view .LVU1480
+	cmpq	%rbp, %r13
+	jb	.L382
+.LVL428:
+.L371:
+	.loc 1 852 3 view .LVU1481
+	.loc 1 852 12 is_stmt 0 view .LVU1482
+	movq	(%r14), %rdx
+	.loc 1 852 40 view .LVU1483
+	leaq	1(%rax), %rsi
+	movq	%rsi, 16(%r14)
+	.loc 1 852 44 view .LVU1484
+	movb	$34, (%rdx,%rax)
+	.loc 1 854 3 is_stmt 1 view .LVU1485
+	.loc 1 854 42 is_stmt 0 view .LVU1486
+	movq	16(%r14), %rax
+	movq	(%r14), %rdx
+	movb	$0, (%rdx,%rax)
+	.loc 1 855 3 is_stmt 1 view .LVU1487
+	.loc 1 856 1 is_stmt 0 view .LVU1488
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 855 10 view .LVU1489
+	movl	$1, %eax
+	.loc 1 856 1 view .LVU1490
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL429:
+	.loc 1 856 1 view .LVU1491
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL430:
+	.loc 1 856 1 view .LVU1492
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL431:
+	.loc 1 856 1 view .LVU1493
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL432:
+	.p2align 4,,10
+	.p2align 3
+.L378:
+	.cfi_restore_state
+.LBB191:
+	.loc 1 835 9 is_stmt 1 view .LVU1494
+	.loc 1 836 9 view .LVU1495
+	movl	$110, %edx
+.LVL433:
+.L377:
+	.loc 1 826 24 is_stmt 0 view .LVU1496
+	movb	%dl, 1(%rax)
+	.loc 1 850 5 is_stmt 1 view .LVU1497
+	.loc 1 850 25 is_stmt 0 view .LVU1498
+	movq	16(%r14), %rax
+.LVL434:
+	.loc 1 850 25 view .LVU1499
+	addq	$2, %rax
+	jmp	.L381
+.LVL435:
+	.p2align 4,,10
+	.p2align 3
+.L376:
+	.loc 1 838 9 is_stmt 1 view .LVU1500
+	.loc 1 839 9 view .LVU1501
+	movl	$114, %edx
+.LVL436:
+	.loc 1 826 24 is_stmt 0 view .LVU1502
+	movb	%dl, 1(%rax)
+	.loc 1 850 5 is_stmt 1 view .LVU1503
+	.loc 1 850 25 is_stmt 0 view .LVU1504
+	movq	16(%r14), %rax
+.LVL437:
+	.loc 1 850 25 view .LVU1505
+	addq	$2, %rax
+	jmp	.L381
+.LVL438:
+	.p2align 4,,10
+	.p2align 3
+.L379:
+	.loc 1 841 9 is_stmt 1 view .LVU1506
+	.loc 1 842 9 view .LVU1507
+	movl	$116, %edx
+.LVL439:
+	.loc 1 826 24 is_stmt 0 view .LVU1508
+	movb	%dl, 1(%rax)
+	.loc 1 850 5 is_stmt 1 view .LVU1509
+	.loc 1 850 25 is_stmt 0 view .LVU1510
+	movq	16(%r14), %rax
+.LVL440:
+	.loc 1 850 25 view .LVU1511
+	addq	$2, %rax
+	jmp	.L381
+.LVL441:
+	.p2align 4,,10
+	.p2align 3
+.L370:
+	.loc 1 850 25 view .LVU1512
+.LBE191:
+	.loc 1 856 1 view .LVU1513
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL442:
+	.loc 1 856 1 view .LVU1514
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL443:
+	.loc 1 856 1 view .LVU1515
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL444:
+	.loc 1 803 12 view .LVU1516
+	xorl	%eax, %eax
+	.loc 1 856 1 view .LVU1517
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL445:
+	.p2align 4,,10
+	.p2align 3
+.L383:
+	.cfi_restore_state
+.LBB192:
+	.loc 1 823 5 view .LVU1518
+	movl	$102, %edx
+.LVL446:
+	.loc 1 826 24 view .LVU1519
+	movb	%dl, 1(%rax)
+	.loc 1 850 5 is_stmt 1 view .LVU1520
+	.loc 1 850 25 is_stmt 0 view .LVU1521
+	movq	16(%r14), %rax
+.LVL447:
+	.loc 1 850 25 view .LVU1522
+	addq	$2, %rax
+	jmp	.L381
+.LVL448:
+	.p2align 4,,10
+	.p2align 3
+.L380:
+	.loc 1 823 5 view .LVU1523
+	movl	$98, %edx
+.LVL449:
+	.loc 1 826 24 view .LVU1524
+	movb	%dl, 1(%rax)
+	.loc 1 850 5 is_stmt 1 view .LVU1525
+	.loc 1 850 25 is_stmt 0 view .LVU1526
+	movq	16(%r14), %rax
+.LVL450:
+	.loc 1 850 25 view .LVU1527
+	addq	$2, %rax
+	jmp	.L381
+.LVL451:
+.L369:
+	.loc 1 850 25 view .LVU1528
+.LBE192:
+	.loc 1 852 30 view .LVU1529
+	movq	16(%r14), %rax
+	jmp	.L371
+	.cfi_endproc
+.LFE67:
+	.size	st_append_escaped_n, .-st_append_escaped_n
+	.p2align 4
+	.globl	st_append_escaped_string
+	.type	st_append_escaped_string, @function
+st_append_escaped_string:
+.LVL452:
+.LFB68:
+	.loc 1 861 85 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 862 3 view .LVU1531
+	.loc 1 861 85 is_stmt 0 view .LVU1532
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	.loc 1 862 10 view .LVU1533
+	movq	%rsi, %rdi
+.LVL453:
+	.loc 1 861 85 view .LVU1534
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 862 10 view .LVU1535
+	call	strlen@PLT
+.LVL454:
+	.loc 1 863 1 view .LVU1536
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	.loc 1 862 10 view .LVU1537
+	movq	%rbx, %rsi
+	.loc 1 863 1 view .LVU1538
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL455:
+	.loc 1 862 10 view .LVU1539
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	.loc 1 863 1 view .LVU1540
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL456:
+	.loc 1 862 10 view .LVU1541
+	jmp	st_append_escaped_n@PLT
+.LVL457:
+	.loc 1 862 10 view .LVU1542
+	.cfi_endproc
+.LFE68:
+	.size	st_append_escaped_string, .-st_append_escaped_string
+	.p2align 4
+	.globl	st_append_int
+	.type	st_append_int, @function
+st_append_int:
+.LVL458:
+.LFB69:
+	.loc 1 868 75 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 870 3 view .LVU1544
+	.loc 1 868 75 is_stmt 0 view .LVU1545
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	.loc 1 870 7 view .LVU1546
+	movl	$21, %esi
+.LVL459:
+	.loc 1 868 75 view .LVU1547
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 868 75 view .LVU1548
+	movq	%rdi, %rbx
+	.loc 1 870 7 view .LVU1549
+	call	st_expand_string@PLT
+.LVL460:
+	.loc 1 870 6 view .LVU1550
+	testl	%eax, %eax
+	jne	.L402
+	.loc 1 878 1 view .LVU1551
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL461:
+	.loc 1 878 1 view .LVU1552
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL462:
+	.loc 1 878 1 view .LVU1553
+	ret
+.LVL463:
+	.p2align 4,,10
+	.p2align 3
+.L402:
+	.cfi_restore_state
+	.loc 1 874 3 is_stmt 1 view .LVU1554
+	.loc 1 874 20 is_stmt 0 view .LVU1555
+	movq	%rbx, %rdi
+	call	st_stats_clock@PLT
+.LVL464:
+	.loc 1 875 26 view .LVU1556
+	movq	16(%rbx), %rdi
+	movq	%r12, %rsi
+	addq	(%rbx), %rdi
+	.loc 1 874 20 view .LVU1557
+	movq	%rax, %rbp
+.LVL465:
+	.loc 1 875 3 is_stmt 1 view .LVU1558
+	.loc 1 875 26 is_stmt 0 view .LVU1559
+	call	i64tos_to@PLT
+.LVL466:
+	.loc 1 875 23 view .LVU1560
+	addq	%rax, 16(%rbx)
+	.loc 1 876 3 is_stmt 1 view .LVU1561
+	.loc 1 876 8 view .LVU1562
+	.loc 1 876 11 is_stmt 0 view .LVU1563
+	testq	%rbp, %rbp
+	jne	.L396
+.L397:
+	.loc 1 878 1 view .LVU1564
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL467:
+	.loc 1 878 1 view .LVU1565
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL468:
+	.loc 1 877 10 view .LVU1566
+	movl	$1, %eax
+	.loc 1 878 1 view .LVU1567
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL469:
+	.loc 1 878 1 view .LVU1568
+	ret
+.LVL470:
+	.p2align 4,,10
+	.p2align 3
+.L396:
+	.cfi_restore_state
+	.loc 1 876 28 is_stmt 1 discriminator 1 view .LVU1569
+	.loc 1 876 33 discriminator 1 view .LVU1570
+	movl	$1, %edx
+	movl	$48, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL471:
+	.loc 1 876 10 discriminator 1 view .LVU1571
+	.loc 1 876 15 discriminator 1 view .LVU1572
+	.loc 1 876 13 discriminator 1 view .LVU1573
+	.loc 1 876 31 discriminator 1 view .LVU1574
+	.loc 1 876 41 discriminator 1 view .LVU1575
+	.loc 1 876 46 discriminator 1 view .LVU1576
+	.loc 1 876 5 is_stmt 0 discriminator 1 view .LVU1577
+	movq	%rbx, %rdi
+	call	st_stats_clock@PLT
+.LVL472:
+	.loc 1 876 46 discriminator 1 view .LVU1578
+	subq	%rbp, %rax
+	movq	%rax, %rdx
+	movl	$56, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL473:
+	jmp	.L397
+	.cfi_endproc
+.LFE69:
+	.size	st_append_int, .-st_append_int
+	.p2align 4
+	.globl	st_append_double
+	.type	st_append_double, @function
+st_append_double:
+.LVL474:
+.LFB70:
+	.loc 1 883 78 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 885 3 view .LVU1580
+	.loc 1 883 78 is_stmt 0 view .LVU1581
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	.loc 1 885 7 view .LVU1582
+	movl	$32, %esi
+.LVL475:
+	.loc 1 883 78 view .LVU1583
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 883 78 view .LVU1584
+	movq	%rdi, %rbx
+	.loc 1 885 7 view .LVU1585
+	call	st_expand_string@PLT
+.LVL476:
+	.loc 1 885 6 view .LVU1586
+	testl	%eax, %eax
+	jne	.L411
+	.loc 1 893 1 view .LVU1587
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL477:
+	.loc 1 893 1 view .LVU1588
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL478:
+	.loc 1 893 1 view .LVU1589
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL479:
+	.p2align 4,,10
+	.p2align 3
+.L411:
+	.cfi_restore_state
+	.loc 1 889 3 is_stmt 1 view .LVU1590
+	.loc 1 889 20 is_stmt 0 view .LVU1591
+	movq	%rbx, %rdi
+	call	st_stats_clock@PLT
+.LVL480:
+	.loc 1 890 26 view .LVU1592
+	movq	16(%rbx), %rdi
+	vmovsd	0(%rbp), %xmm0
+	addq	(%rbx), %rdi
+	.loc 1 889 20 view .LVU1593
+	movq	%rax, %r12
+.LVL481:
+	.loc 1 890 3 is_stmt 1 view .LVU1594
+	.loc 1 890 26 is_stmt 0 view .LVU1595
+	call	dtos_to@PLT
+.LVL482:
+	.loc 1 890 23 view .LVU1596
+	addq	%rax, 16(%rbx)
+	.loc 1 891 3 is_stmt 1 view .LVU1597
+	.loc 1 891 8 view .LVU1598
+	.loc 1 891 11 is_stmt 0 view .LVU1599
+	testq	%r12, %r12
+	jne	.L405
+.L406:
+	.loc 1 893 1 view .LVU1600
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL483:
+	.loc 1 893 1 view .LVU1601
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL484:
+	.loc 1 892 10 view .LVU1602
+	movl	$1, %eax
+	.loc 1 893 1 view .LVU1603
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL485:
+	.loc 1 893 1 view .LVU1604
+	ret
+.LVL486:
+	.p2align 4,,10
+	.p2align 3
+.L405:
+	.cfi_restore_state
+	.loc 1 891 28 is_stmt 1 discriminator 1 view .LVU1605
+	.loc 1 891 33 discriminator 1 view .LVU1606
+	movl	$1, %edx
+	movl	$48, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL487:
+	.loc 1 891 10 discriminator 1 view .LVU1607
+	.loc 1 891 15 discriminator 1 view .LVU1608
+	.loc 1 891 13 discriminator 1 view .LVU1609
+	.loc 1 891 31 discriminator 1 view .LVU1610
+	.loc 1 891 41 discriminator 1 view .LVU1611
+	.loc 1 891 46 discriminator 1 view .LVU1612
+	.loc 1 891 5 is_stmt 0 discriminator 1 view .LVU1613
+	movq	%rbx, %rdi
+	call	st_stats_clock@PLT
+.LVL488:
+	.loc 1 891 46 discriminator 1 view .LVU1614
+	subq	%r12, %rax
+	movq	%rax, %rdx
+	movl	$56, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL489:
+	jmp	.L406
+	.cfi_endproc
+.LFE70:
+	.size	st_append_double, .-st_append_double
+	.p2align 4
+	.globl	st_append_double_precision
+	.type	st_append_double_precision, @function
+st_append_double_precision:
+.LVL490:
+.LFB71:
+	.loc 1 898 109 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 900 3 view .LVU1616
+	.loc 1 898 109 is_stmt 0 view .LVU1617
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%edx, %r13d
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rsi, %r12
+	.loc 1 900 7 view .LVU1618
+	movl	$32, %esi
+.LVL491:
+	.loc 1 898 109 view .LVU1619
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 900 7 view .LVU1620
+	call	st_expand_string@PLT
+.LVL492:
+	.loc 1 900 6 view .LVU1621
+	testl	%eax, %eax
+	jne	.L420
+	.loc 1 908 1 view .LVU1622
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL493:
+	.loc 1 908 1 view .LVU1623
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL494:
+	.loc 1 908 1 view .LVU1624
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL495:
+	.loc 1 908 1 view .LVU1625
+	ret
+.LVL496:
+	.p2align 4,,10
+	.p2align 3
+.L420:
+	.cfi_restore_state
+	.loc 1 904 3 is_stmt 1 view .LVU1626
+	.loc 1 904 20 is_stmt 0 view .LVU1627
+	movq	%rbx, %rdi
+	call	st_stats_clock@PLT
+.LVL497:
+	.loc 1 905 26 view .LVU1628
+	movq	16(%rbx), %rdi
+	vmovsd	(%r12), %xmm0
+	addq	(%rbx), %rdi
+	movl	%r13d, %esi
+	.loc 1 904 20 view .LVU1629
+	movq	%rax, %rbp
+.LVL498:
+	.loc 1 905 3 is_stmt 1 view .LVU1630
+	.loc 1 905 26 is_stmt 0 view .LVU1631
+	call	dtos_precision_to@PLT
+.LVL499:
+	.loc 1 905 23 view .LVU1632
+	addq	%rax, 16(%rbx)
+	.loc 1 906 3 is_stmt 1 view .LVU1633
+	.loc 1 906 8 view .LVU1634
+	.loc 1 906 11 is_stmt 0 view .LVU1635
+	testq	%rbp, %rbp
+	jne	.L414
+.L415:
+	.loc 1 908 1 view .LVU1636
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL500:
+	.loc 1 908 1 view .LVU1637
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL501:
+	.loc 1 908 1 view .LVU1638
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL502:
+	.loc 1 907 10 view .LVU1639
+	movl	$1, %eax
+	.loc 1 908 1 view .LVU1640
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL503:
+	.loc 1 908 1 view .LVU1641
+	ret
+.LVL504:
+	.p2align 4,,10
+	.p2align 3
+.L414:
+	.cfi_restore_state
+	.loc 1 906 28 is_stmt 1 discriminator 1 view .LVU1642
+	.loc 1 906 33 discriminator 1 view .LVU1643
+	movl	$1, %edx
+	movl	$48, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL505:
+	.loc 1 906 10 discriminator 1 view .LVU1644
+	.loc 1 906 15 discriminator 1 view .LVU1645
+	.loc 1 906 13 discriminator 1 view .LVU1646
+	.loc 1 906 31 discriminator 1 view .LVU1647
+	.loc 1 906 41 discriminator 1 view .LVU1648
+	.loc 1 906 46 discriminator 1 view .LVU1649
+	.loc 1 906 5 is_stmt 0 discriminator 1 view .LVU1650
+	movq	%rbx, %rdi
+	call	st_stats_clock@PLT
+.LVL506:
+	.loc 1 906 46 discriminator 1 view .LVU1651
+	subq	%rbp, %rax
+	movq	%rax, %rdx
+	movl	$56, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL507:
+	jmp	.L415
+	.cfi_endproc
+.LFE71:
+	.size	st_append_double_precision, .-st_append_double_precision
+	.p2align 4
+	.globl	st_append_fixed
+	.type	st_append_fixed, @function
+st_append_fixed:
+.LVL508:
+.LFB72:
+	.loc 1 913 98 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 915 3 view .LVU1653
+	.loc 1 916 3 view .LVU1654
+	.loc 1 913 98 is_stmt 0 view .LVU1655
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$344, %rsp
+	.cfi_def_cfa_offset 384
+	.loc 1 916 20 view .LVU1656
+	call	st_stats_clock@PLT
+.LVL509:
+	.loc 1 917 19 view .LVU1657
+	vmovsd	0(%r13), %xmm0
+	movq	%rsp, %r13
+.LVL510:
+	.loc 1 917 19 view .LVU1658
+	movl	%r12d, %esi
+	movq	%r13, %rdi
+	.loc 1 916 20 view .LVU1659
+	movq	%rax, %rbp
+.LVL511:
+	.loc 1 917 3 is_stmt 1 view .LVU1660
+	.loc 1 917 19 is_stmt 0 view .LVU1661
+	call	dtos_fixed_to@PLT
+.LVL512:
+	.loc 1 917 19 view .LVU1662
+	movq	%rax, %r12
+.LVL513:
+	.loc 1 918 3 is_stmt 1 view .LVU1663
+	.loc 1 918 8 view .LVU1664
+	.loc 1 918 11 is_stmt 0 view .LVU1665
+	testq	%rbp, %rbp
+	jne	.L427
+.LVL514:
+.L422:
+	.loc 1 918 44 is_stmt 1 discriminator 3 view .LVU1666
+	.loc 1 918 49 discriminator 3 view .LVU1667
+	.loc 1 918 47 discriminator 3 view .LVU1668
+	.loc 1 918 44 discriminator 3 view .LVU1669
+	.loc 1 918 6 discriminator 3 view .LVU1670
+	.loc 1 919 3 discriminator 3 view .LVU1671
+	.loc 1 919 10 is_stmt 0 discriminator 3 view .LVU1672
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	st_append_n@PLT
+.LVL515:
+	.loc 1 920 1 discriminator 3 view .LVU1673
+	addq	$344, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL516:
+	.loc 1 920 1 discriminator 3 view .LVU1674
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL517:
+	.loc 1 920 1 discriminator 3 view .LVU1675
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL518:
+	.loc 1 920 1 discriminator 3 view .LVU1676
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL519:
+	.p2align 4,,10
+	.p2align 3
+.L427:
+	.cfi_restore_state
+	.loc 1 918 28 is_stmt 1 discriminator 1 view .LVU1677
+	.loc 1 918 33 discriminator 1 view .LVU1678
+	movl	$1, %edx
+	movl	$48, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL520:
+	.loc 1 918 10 discriminator 1 view .LVU1679
+	.loc 1 918 15 discriminator 1 view .LVU1680
+	.loc 1 918 13 discriminator 1 view .LVU1681
+	.loc 1 918 31 discriminator 1 view .LVU1682
+	.loc 1 918 41 discriminator 1 view .LVU1683
+	.loc 1 918 46 discriminator 1 view .LVU1684
+	.loc 1 918 5 is_stmt 0 discriminator 1 view .LVU1685
+	movq	%rbx, %rdi
+	call	st_stats_clock@PLT
+.LVL521:
+	.loc 1 918 46 discriminator 1 view .LVU1686
+	subq	%rbp, %rax
+	movq	%rax, %rdx
+	movl	$56, %esi
+	movq	%rbx, %rdi
+	call	st_stats_add@PLT
+.LVL522:
+	jmp	.L422
+	.cfi_endproc
+.LFE72:
+	.size	st_append_fixed, .-st_append_fixed
+	.section	.rodata
+	.align 16
+	.type	hex_digits.0, @object
+	.size	hex_digits.0, 17
+hex_digits.0:
+	.string	"0123456789abcdef"
+	.section	.tbss,"awT",@nobits
+	.align 8
+	.type	string_tokenizer_pool_count, @object
+	.size	string_tokenizer_pool_count, 8
+string_tokenizer_pool_count:
+	.zero	8
+	.align 8
+	.type	string_tokenizer_pool, @object
+	.size	string_tokenizer_pool, 64
+string_tokenizer_pool:
+	.zero	64
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC0:
+	.long	0
+	.long	-1008730112
+	.align 8
+.LC1:
+	.long	0
+	.long	1138753536
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC2:
+	.quad	0
+	.quad	2
+	.quad	4
+	.quad	6
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 8 "/usr/include/stdlib.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 11 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x3199
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3d
+	.long	.LASF189
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x15
+	.long	.LASF9
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xe
+	.long	0x2e
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.long	0x46
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x12
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xe
+	.long	0x6e
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x15
+	.long	.LASF10
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x60
+	.uleb128 0x12
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x15
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2c
+	.byte	0x19
+	.long	0x52
+	.uleb128 0x15
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x3f
+	.byte	0x8
+	.uleb128 0x15
+	.long	.LASF14
+	.byte	0x4
+	.byte	0xc2
+	.byte	0x12
+	.long	0x52
+	.uleb128 0xb
+	.long	0xbf
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0xe
+	.long	0xbf
+	.uleb128 0x15
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x6c
+	.byte	0x13
+	.long	0xae
+	.uleb128 0x15
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x13
+	.long	0x94
+	.uleb128 0xe
+	.long	0xd7
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0xb
+	.long	0xf4
+	.uleb128 0x40
+	.uleb128 0xb
+	.long	0xc6
+	.uleb128 0x15
+	.long	.LASF19
+	.byte	0x7
+	.byte	0x18
+	.byte	0x13
+	.long	0x81
+	.uleb128 0xe
+	.long	0xfa
+	.uleb128 0x15
+	.long	.LASF20
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa0
+	.uleb128 0xe
+	.long	0x10b
+	.uleb128 0x41
+	.long	.LASF28
+	.byte	0x10
+	.byte	0x2
+	.byte	0xd
+	.byte	0x8
+	.long	0x142
+	.uleb128 0x32
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0xf5
+	.byte	0
+	.uleb128 0x32
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0xe
+	.long	0x11c
+	.uleb128 0x42
+	.long	.LASF52
+	.byte	0x7
+	.byte	0x4
+	.long	0x6e
+	.byte	0x2
+	.byte	0x7a
+	.byte	0x6
+	.long	0x184
+	.uleb128 0xf
+	.long	.LASF21
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF22
+	.byte	0x2
+	.uleb128 0xf
+	.long	.LASF23
+	.byte	0x4
+	.uleb128 0xf
+	.long	.LASF24
+	.byte	0x8
+	.uleb128 0xf
+	.long	.LASF25
+	.byte	0x10
+	.uleb128 0xf
+	.long	.LASF26
+	.byte	0x20
+	.uleb128 0xf
+	.long	.LASF27
+	.byte	0x40
+	.byte	0
+	.uleb128 0x17
+	.long	0x106
+	.long	0x194
+	.uleb128 0x1b
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0xe
+	.long	0x184
+	.uleb128 0x43
+	.long	.LASF111
+	.byte	0x2
+	.byte	0xa6
+	.byte	0x16
+	.long	0x194
+	.uleb128 0x44
+	.long	.LASF29
+	.value	0x100
+	.byte	0x2
+	.byte	0xab
+	.byte	0x8
+	.long	0x1c1
+	.uleb128 0x45
+	.long	.LASF30
+	.byte	0x2
+	.byte	0xb0
+	.byte	0xb
+	.long	0x1c6
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x1a5
+	.uleb128 0x17
+	.long	0xfa
+	.long	0x1d6
+	.uleb128 0x1b
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF31
+	.byte	0x18
+	.value	0x175
+	.long	0x20a
+	.uleb128 0x7
+	.long	.LASF32
+	.value	0x17a
+	.byte	0x1c
+	.long	0x20f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF33
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF34
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF190
+	.uleb128 0xb
+	.long	0x20a
+	.uleb128 0x12
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF35
+	.uleb128 0x22
+	.long	.LASF36
+	.byte	0x40
+	.value	0x1e6
+	.long	0x290
+	.uleb128 0x7
+	.long	.LASF37
+	.value	0x1eb
+	.byte	0xc
+	.long	0x10b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF38
+	.value	0x1f0
+	.byte	0xc
+	.long	0x10b
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF39
+	.value	0x1f5
+	.byte	0xc
+	.long	0x10b
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF40
+	.value	0x1fa
+	.byte	0xc
+	.long	0x10b
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF41
+	.value	0x1ff
+	.byte	0xc
+	.long	0x10b
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF42
+	.value	0x204
+	.byte	0xc
+	.long	0x10b
+	.byte	0x28
+	.uleb128 0x7
+	.long	.LASF43
+	.value	0x209
+	.byte	0xc
+	.long	0x10b
+	.byte	0x30
+	.uleb128 0x7
+	.long	.LASF44
+	.value	0x20e
+	.byte	0xc
+	.long	0x10b
+	.byte	0x38
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF45
+	.byte	0x38
+	.value	0x26c
+	.long	0x302
+	.uleb128 0x7
+	.long	.LASF46
+	.value	0x272
+	.byte	0xd
+	.long	0x31b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF47
+	.value	0x277
+	.byte	0x9
+	.long	0xac
+	.byte	0x8
+	.uleb128 0x33
+	.string	"fd"
+	.value	0x27c
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF48
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF49
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF50
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x33
+	.string	"eof"
+	.value	0x290
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x7
+	.long	.LASF51
+	.value	0x295
+	.byte	0x7
+	.long	0x46
+	.byte	0x34
+	.byte	0
+	.uleb128 0x47
+	.long	0xcb
+	.long	0x31b
+	.uleb128 0x4
+	.long	0xac
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0xb
+	.long	0x302
+	.uleb128 0x34
+	.long	.LASF53
+	.long	0x6e
+	.value	0x29b
+	.long	0x33c
+	.uleb128 0xf
+	.long	.LASF54
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF55
+	.byte	0x1
+	.byte	0
+	.uleb128 0xe
+	.long	0x320
+	.uleb128 0x34
+	.long	.LASF56
+	.long	0x6e
+	.value	0x2b5
+	.long	0x369
+	.uleb128 0xf
+	.long	.LASF57
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF58
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF59
+	.byte	0x2
+	.uleb128 0xf
+	.long	.LASF60
+	.byte	0x3
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF61
+	.value	0x158
+	.byte	0x2
+	.value	0x2cf
+	.byte	0x8
+	.long	0x417
+	.uleb128 0x7
+	.long	.LASF62
+	.value	0x2d4
+	.byte	0x9
+	.long	0xba
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF63
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF64
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF65
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF66
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x320
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF67
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x7
+	.long	.LASF68
+	.value	0x2f2
+	.byte	0x18
+	.long	0x41c
+	.byte	0x30
+	.uleb128 0x7
+	.long	.LASF69
+	.value	0x2f7
+	.byte	0x18
+	.long	0x341
+	.byte	0x38
+	.uleb128 0x7
+	.long	.LASF70
+	.value	0x2fc
+	.byte	0x17
+	.long	0x421
+	.byte	0x40
+	.uleb128 0x7
+	.long	.LASF71
+	.value	0x301
+	.byte	0x8
+	.long	0x426
+	.byte	0x48
+	.uleb128 0x35
+	.long	.LASF72
+	.value	0x306
+	.byte	0x21
+	.long	0x489
+	.value	0x148
+	.uleb128 0x35
+	.long	.LASF73
+	.value	0x30b
+	.byte	0x17
+	.long	0x48e
+	.value	0x150
+	.byte	0
+	.uleb128 0xe
+	.long	0x369
+	.uleb128 0xb
+	.long	0x290
+	.uleb128 0xb
+	.long	0x1d6
+	.uleb128 0x17
+	.long	0xbf
+	.long	0x436
+	.uleb128 0x1b
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF74
+	.byte	0x28
+	.value	0x764
+	.long	0x484
+	.uleb128 0x7
+	.long	.LASF75
+	.value	0x769
+	.byte	0xb
+	.long	0x4a4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF76
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF77
+	.value	0x774
+	.byte	0xd
+	.long	0x4a9
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF63
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF78
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0xe
+	.long	0x436
+	.uleb128 0xb
+	.long	0x436
+	.uleb128 0xb
+	.long	0x21b
+	.uleb128 0xb
+	.long	0x142
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF79
+	.uleb128 0xe
+	.long	0x498
+	.uleb128 0xb
+	.long	0x2e
+	.uleb128 0xb
+	.long	0x10b
+	.uleb128 0xb
+	.long	0x369
+	.uleb128 0x17
+	.long	0x4ae
+	.long	0x4c3
+	.uleb128 0x1b
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF80
+	.byte	0xe
+	.byte	0x2e
+	.long	0x4b3
+	.uleb128 0xa
+	.byte	0xe
+	.long	string_tokenizer_pool@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0x2a
+	.long	.LASF81
+	.byte	0x13
+	.byte	0x1d
+	.long	0x2e
+	.uleb128 0xa
+	.byte	0xe
+	.long	string_tokenizer_pool_count@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0xc
+	.long	.LASF82
+	.byte	0x2
+	.value	0x673
+	.byte	0x8
+	.long	0x2e
+	.long	0x510
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0x49f
+	.uleb128 0x4
+	.long	0x46
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF83
+	.byte	0x2
+	.value	0x660
+	.byte	0x8
+	.long	0x2e
+	.long	0x531
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0x49f
+	.uleb128 0x4
+	.long	0x46
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF84
+	.byte	0x2
+	.value	0x64e
+	.byte	0x8
+	.long	0x2e
+	.long	0x54d
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0x49f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF85
+	.byte	0x2
+	.value	0x607
+	.byte	0x8
+	.long	0x2e
+	.long	0x569
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0xd7
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF86
+	.byte	0x2
+	.value	0x148
+	.byte	0x8
+	.long	0x2e
+	.long	0x585
+	.uleb128 0x4
+	.long	0xf5
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF87
+	.byte	0x8
+	.value	0x234
+	.byte	0xe
+	.long	0xac
+	.long	0x5a1
+	.uleb128 0x4
+	.long	0xac
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF88
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.long	0xac
+	.long	0x5c1
+	.uleb128 0x4
+	.long	0xac
+	.uleb128 0x4
+	.long	0xef
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF89
+	.byte	0x9
+	.byte	0x40
+	.byte	0xc
+	.long	0x46
+	.long	0x5e1
+	.uleb128 0x4
+	.long	0xef
+	.uleb128 0x4
+	.long	0xef
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF90
+	.byte	0x2
+	.value	0x19d
+	.byte	0x7
+	.long	0xac
+	.long	0x5fd
+	.uleb128 0x4
+	.long	0x421
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF91
+	.byte	0x2
+	.value	0x688
+	.byte	0x8
+	.long	0x2e
+	.long	0x61e
+	.uleb128 0x4
+	.long	0xf5
+	.uleb128 0x4
+	.long	0x3a
+	.uleb128 0x4
+	.long	0x61e
+	.byte	0
+	.uleb128 0xb
+	.long	0xd7
+	.uleb128 0xc
+	.long	.LASF92
+	.byte	0x2
+	.value	0x63e
+	.byte	0x8
+	.long	0x2e
+	.long	0x644
+	.uleb128 0x4
+	.long	0xf5
+	.uleb128 0x4
+	.long	0x3a
+	.uleb128 0x4
+	.long	0x644
+	.byte	0
+	.uleb128 0xb
+	.long	0x498
+	.uleb128 0xc
+	.long	.LASF93
+	.byte	0x2
+	.value	0x25a
+	.byte	0xa
+	.long	0x10b
+	.long	0x660
+	.uleb128 0x4
+	.long	0x660
+	.byte	0
+	.uleb128 0xb
+	.long	0x417
+	.uleb128 0xc
+	.long	.LASF94
+	.byte	0x2
+	.value	0x157
+	.byte	0x8
+	.long	0x2e
+	.long	0x686
+	.uleb128 0x4
+	.long	0xf5
+	.uleb128 0x4
+	.long	0x3a
+	.uleb128 0x4
+	.long	0x686
+	.byte	0
+	.uleb128 0xb
+	.long	0x1c1
+	.uleb128 0xc
+	.long	.LASF95
+	.byte	0x2
+	.value	0x1aa
+	.byte	0x7
+	.long	0xba
+	.long	0x6a7
+	.uleb128 0x4
+	.long	0x421
+	.uleb128 0x4
+	.long	0x493
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF96
+	.byte	0x2
+	.value	0x11c
+	.byte	0x8
+	.long	0x2e
+	.long	0x6c8
+	.uleb128 0x4
+	.long	0xf5
+	.uleb128 0x4
+	.long	0x3a
+	.uleb128 0x4
+	.long	0xc6
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF97
+	.byte	0x2
+	.value	0x394
+	.byte	0x5
+	.long	0x46
+	.long	0x6e4
+	.uleb128 0x4
+	.long	0x4ae
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF98
+	.byte	0x2
+	.value	0x12b
+	.byte	0x8
+	.long	0x2e
+	.long	0x700
+	.uleb128 0x4
+	.long	0xf5
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF99
+	.byte	0x2
+	.value	0x7a4
+	.byte	0x8
+	.long	0x2e
+	.long	0x71c
+	.uleb128 0x4
+	.long	0x489
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF100
+	.byte	0x2
+	.byte	0x54
+	.byte	0x7
+	.long	0xba
+	.long	0x732
+	.uleb128 0x4
+	.long	0x493
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF101
+	.byte	0xa
+	.byte	0x4c
+	.byte	0xc
+	.long	0x46
+	.long	0x74d
+	.uleb128 0x4
+	.long	0xac
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF102
+	.byte	0x2
+	.value	0x797
+	.byte	0x6
+	.long	0x760
+	.uleb128 0x4
+	.long	0x4ae
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF103
+	.byte	0x8
+	.value	0x238
+	.byte	0xd
+	.long	0x773
+	.uleb128 0x4
+	.long	0xac
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF104
+	.byte	0x2
+	.value	0x24d
+	.byte	0x6
+	.long	0x790
+	.uleb128 0x4
+	.long	0x660
+	.uleb128 0x4
+	.long	0x3a
+	.uleb128 0x4
+	.long	0x117
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF105
+	.byte	0x8
+	.value	0x229
+	.byte	0xe
+	.long	0xac
+	.long	0x7a7
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF106
+	.byte	0x9
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0x7be
+	.uleb128 0x4
+	.long	0xf5
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF113
+	.value	0x391
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB72
+	.quad	.LFE72-.LFB72
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x904
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x391
+	.byte	0x2d
+	.long	0x4ae
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0x6
+	.long	.LASF108
+	.value	0x391
+	.byte	0x46
+	.long	0x904
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x6
+	.long	.LASF109
+	.value	0x391
+	.byte	0x57
+	.long	0x4d
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0x13
+	.long	.LASF110
+	.value	0x393
+	.byte	0x8
+	.long	0x909
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0x8
+	.long	.LASF112
+	.value	0x394
+	.byte	0xc
+	.long	0x10b
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x8
+	.long	.LASF63
+	.value	0x395
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x2
+	.quad	.LVL509
+	.long	0x649
+	.long	0x86c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL512
+	.long	0x4ef
+	.long	0x88a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL515
+	.long	0x1099
+	.long	0x8ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL520
+	.long	0x773
+	.long	0x8d1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL521
+	.long	0x649
+	.long	0x8e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL522
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x49f
+	.uleb128 0x17
+	.long	0xbf
+	.long	0x91a
+	.uleb128 0x49
+	.long	0x3f
+	.value	0x14b
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF114
+	.value	0x382
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB71
+	.quad	.LFE71-.LFB71
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa30
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x382
+	.byte	0x38
+	.long	0x4ae
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x6
+	.long	.LASF108
+	.value	0x382
+	.byte	0x51
+	.long	0x904
+	.long	.LLST190
+	.long	.LVUS190
+	.uleb128 0x6
+	.long	.LASF109
+	.value	0x382
+	.byte	0x62
+	.long	0x4d
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x8
+	.long	.LASF112
+	.value	0x388
+	.byte	0xc
+	.long	0x10b
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0x2
+	.quad	.LVL492
+	.long	0x13e1
+	.long	0x9aa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL497
+	.long	0x649
+	.long	0x9c2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL499
+	.long	0x510
+	.long	0x9da
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL505
+	.long	0x773
+	.long	0x9fd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL506
+	.long	0x649
+	.long	0xa15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL507
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF115
+	.value	0x373
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB70
+	.quad	.LFE70-.LFB70
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb27
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x373
+	.byte	0x2e
+	.long	0x4ae
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0x6
+	.long	.LASF108
+	.value	0x373
+	.byte	0x47
+	.long	0x904
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0x8
+	.long	.LASF112
+	.value	0x379
+	.byte	0xc
+	.long	0x10b
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0x2
+	.quad	.LVL476
+	.long	0x13e1
+	.long	0xaac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL480
+	.long	0x649
+	.long	0xac4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL482
+	.long	0x531
+	.uleb128 0x2
+	.quad	.LVL487
+	.long	0x773
+	.long	0xaf4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL488
+	.long	0x649
+	.long	0xb0c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL489
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF116
+	.value	0x364
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB69
+	.quad	.LFE69-.LFB69
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc28
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x364
+	.byte	0x2b
+	.long	0x4ae
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0x6
+	.long	.LASF108
+	.value	0x364
+	.byte	0x44
+	.long	0xe3
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x8
+	.long	.LASF112
+	.value	0x36a
+	.byte	0xc
+	.long	0x10b
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x2
+	.quad	.LVL460
+	.long	0x13e1
+	.long	0xba2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x45
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL464
+	.long	0x649
+	.long	0xbba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL466
+	.long	0x54d
+	.long	0xbd2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL471
+	.long	0x773
+	.long	0xbf5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL472
+	.long	0x649
+	.long	0xc0d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL473
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF117
+	.value	0x35d
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xca7
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x35d
+	.byte	0x36
+	.long	0x4ae
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0x6
+	.long	.LASF62
+	.value	0x35d
+	.byte	0x4d
+	.long	0xf5
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x2
+	.quad	.LVL454
+	.long	0x7a7
+	.long	0xc8a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL457
+	.long	0xca7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF118
+	.value	0x31f
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xde9
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x31f
+	.byte	0x31
+	.long	0x4ae
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x6
+	.long	.LASF62
+	.value	0x31f
+	.byte	0x48
+	.long	0xf5
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x6
+	.long	.LASF63
+	.value	0x31f
+	.byte	0x5d
+	.long	0x3a
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0x13
+	.long	.LASF119
+	.value	0x320
+	.byte	0x15
+	.long	0xdf9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	hex_digits.0
+	.uleb128 0x8
+	.long	.LASF120
+	.value	0x326
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x36
+	.long	.LLRL177
+	.long	0xdce
+	.uleb128 0x24
+	.string	"run"
+	.value	0x329
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x8
+	.long	.LASF121
+	.value	0x334
+	.byte	0xb
+	.long	0xba
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x8
+	.long	.LASF122
+	.value	0x335
+	.byte	0x13
+	.long	0x60
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x2
+	.quad	.LVL418
+	.long	0x569
+	.long	0xd95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL420
+	.long	0x13e1
+	.long	0xdb3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 7
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL421
+	.long	0x318a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL415
+	.long	0x13e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0xc6
+	.long	0xdf9
+	.uleb128 0x1b
+	.long	0x3f
+	.byte	0x10
+	.byte	0
+	.uleb128 0xe
+	.long	0xde9
+	.uleb128 0x9
+	.long	.LASF123
+	.value	0x317
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB66
+	.quad	.LFE66-.LFB66
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe92
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x317
+	.byte	0x35
+	.long	0x4ae
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x6
+	.long	.LASF62
+	.value	0x317
+	.byte	0x4c
+	.long	0xf5
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x13
+	.long	.LASF124
+	.value	0x318
+	.byte	0x15
+	.long	0xe92
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.quad	.LVL410
+	.long	0x7a7
+	.long	0xe71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL411
+	.long	0xf21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x11c
+	.long	0xea2
+	.uleb128 0x1b
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF125
+	.value	0x310
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB65
+	.quad	.LFE65-.LFB65
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf21
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x310
+	.byte	0x2e
+	.long	0x4ae
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x6
+	.long	.LASF62
+	.value	0x310
+	.byte	0x45
+	.long	0xf5
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x2
+	.quad	.LVL404
+	.long	0x7a7
+	.long	0xf04
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL407
+	.long	0x1099
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF126
+	.value	0x2f8
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB64
+	.quad	.LFE64-.LFB64
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1035
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x2f8
+	.byte	0x2c
+	.long	0x4ae
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x6
+	.long	.LASF124
+	.value	0x2f8
+	.byte	0x50
+	.long	0x493
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x6
+	.long	.LASF76
+	.value	0x2f8
+	.byte	0x68
+	.long	0x3a
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x8
+	.long	.LASF63
+	.value	0x2fa
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST164
+	.long	.LVUS164
+	.uleb128 0x8
+	.long	.LASF121
+	.value	0x302
+	.byte	0x9
+	.long	0xba
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x36
+	.long	.LLRL166
+	.long	0xfc3
+	.uleb128 0x24
+	.string	"i"
+	.value	0x2fb
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST167
+	.long	.LVUS167
+	.byte	0
+	.uleb128 0x25
+	.quad	.LBB188
+	.quad	.LBE188-.LBB188
+	.long	0xff8
+	.uleb128 0x24
+	.string	"i"
+	.value	0x303
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x10
+	.quad	.LVL393
+	.long	0x318a
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL382
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL389
+	.long	0x13e1
+	.long	0x1021
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL398
+	.long	0x13e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF127
+	.value	0x2ea
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB63
+	.quad	.LFE63-.LFB63
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1099
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x2ea
+	.byte	0x2c
+	.long	0x4ae
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x6
+	.long	.LASF122
+	.value	0x2ea
+	.byte	0x42
+	.long	0xc6
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x5
+	.quad	.LVL376
+	.long	0x13e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF128
+	.value	0x2d9
+	.long	0x46
+	.long	0x10d0
+	.uleb128 0xa
+	.long	.LASF107
+	.byte	0x1
+	.value	0x2d9
+	.byte	0x29
+	.long	0x4ae
+	.uleb128 0xa
+	.long	.LASF62
+	.byte	0x1
+	.value	0x2d9
+	.byte	0x40
+	.long	0xf5
+	.uleb128 0xa
+	.long	.LASF63
+	.byte	0x1
+	.value	0x2d9
+	.byte	0x55
+	.long	0x3a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF129
+	.value	0x2c8
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB61
+	.quad	.LFE61-.LFB61
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1237
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x2c8
+	.byte	0x2e
+	.long	0x4ae
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x8
+	.long	.LASF63
+	.value	0x2c9
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x11
+	.long	0x1423
+	.quad	.LBI172
+	.byte	.LVU1199
+	.long	.LLRL147
+	.value	0x2ce
+	.byte	0x7
+	.long	0x122b
+	.uleb128 0x3
+	.long	0x1442
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x3
+	.long	0x1435
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x18
+	.long	.LLRL147
+	.uleb128 0xd
+	.long	0x144f
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x37
+	.long	0x145b
+	.long	.LLRL151
+	.long	0x11d5
+	.uleb128 0xd
+	.long	0x145c
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x2
+	.quad	.LVL359
+	.long	0x790
+	.long	0x1191
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL361
+	.long	0x773
+	.long	0x11b3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL362
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL353
+	.long	0x585
+	.long	0x11ed
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL355
+	.long	0x773
+	.long	0x120f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL356
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL364
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF130
+	.value	0x2bd
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB60
+	.quad	.LFE60-.LFB60
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x139f
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x2bd
+	.byte	0x28
+	.long	0x4ae
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x6
+	.long	.LASF63
+	.value	0x2bd
+	.byte	0x40
+	.long	0x3a
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x11
+	.long	0x1423
+	.quad	.LBI162
+	.byte	.LVU1092
+	.long	.LLRL138
+	.value	0x2c2
+	.byte	0xa
+	.long	0x1393
+	.uleb128 0x3
+	.long	0x1442
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x3
+	.long	0x1435
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x18
+	.long	.LLRL138
+	.uleb128 0xd
+	.long	0x144f
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x38
+	.long	0x145b
+	.quad	.LBB164
+	.quad	.LBE164-.LBB164
+	.long	0x1348
+	.uleb128 0xd
+	.long	0x145c
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x2
+	.quad	.LVL321
+	.long	0x790
+	.long	0x1304
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL323
+	.long	0x773
+	.long	0x1326
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL324
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL327
+	.long	0x585
+	.uleb128 0x2
+	.quad	.LVL329
+	.long	0x773
+	.long	0x1377
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL330
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL325
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF164
+	.value	0x2b5
+	.quad	.LFB59
+	.quad	.LFE59-.LFB59
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13e1
+	.uleb128 0x2c
+	.long	.LASF107
+	.byte	0x33
+	.long	0x4ae
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2c
+	.long	.LASF131
+	.byte	0x5c
+	.long	0x33c
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2c
+	.long	.LASF67
+	.byte	0x71
+	.long	0x3a
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF132
+	.value	0x292
+	.long	0x46
+	.long	0x1423
+	.uleb128 0xa
+	.long	.LASF107
+	.byte	0x1
+	.value	0x292
+	.byte	0x2e
+	.long	0x4ae
+	.uleb128 0xa
+	.long	.LASF133
+	.byte	0x1
+	.value	0x292
+	.byte	0x46
+	.long	0x3a
+	.uleb128 0x20
+	.long	.LASF134
+	.value	0x29d
+	.byte	0xa
+	.long	0x2e
+	.uleb128 0x20
+	.long	.LASF135
+	.value	0x2a9
+	.byte	0xa
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF155
+	.byte	0x1
+	.value	0x26a
+	.byte	0xc
+	.long	0x46
+	.byte	0x1
+	.long	0x146a
+	.uleb128 0xa
+	.long	.LASF107
+	.byte	0x1
+	.value	0x26a
+	.byte	0x35
+	.long	0x4ae
+	.uleb128 0xa
+	.long	.LASF63
+	.byte	0x1
+	.value	0x26a
+	.byte	0x4d
+	.long	0x3a
+	.uleb128 0x20
+	.long	.LASF62
+	.value	0x281
+	.byte	0x9
+	.long	0xba
+	.uleb128 0x2d
+	.uleb128 0x20
+	.long	.LASF62
+	.value	0x275
+	.byte	0xb
+	.long	0xba
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF136
+	.value	0x250
+	.byte	0x6
+	.long	0x15b4
+	.quad	.LFB56
+	.quad	.LFE56-.LFB56
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15b4
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x250
+	.byte	0x31
+	.long	0x4ae
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x6
+	.long	.LASF137
+	.value	0x250
+	.byte	0x48
+	.long	0xf5
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x6
+	.long	.LASF138
+	.value	0x250
+	.byte	0x5e
+	.long	0x4d
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x8
+	.long	.LASF108
+	.value	0x256
+	.byte	0x8
+	.long	0x15b4
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x11
+	.long	0x23bc
+	.quad	.LBI139
+	.byte	.LVU945
+	.long	.LLRL119
+	.value	0x256
+	.byte	0x17
+	.long	0x1598
+	.uleb128 0x3
+	.long	0x23db
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x3
+	.long	0x23ce
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x16
+	.long	0x23bc
+	.quad	.LBI141
+	.byte	.LVU959
+	.quad	.LBB141
+	.quad	.LBE141-.LBB141
+	.value	0x104
+	.byte	0xe
+	.long	0x1584
+	.uleb128 0x3
+	.long	0x23db
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x3
+	.long	0x23ce
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x2
+	.quad	.LVL284
+	.long	0x773
+	.long	0x1570
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL285
+	.long	0x790
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL280
+	.long	0x5e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL278
+	.long	0x15b9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x46
+	.uleb128 0x9
+	.long	.LASF139
+	.value	0x23b
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB55
+	.quad	.LFE55-.LFB55
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x167d
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x23b
+	.byte	0x2c
+	.long	0x4ae
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x6
+	.long	.LASF140
+	.value	0x23b
+	.byte	0x43
+	.long	0xf5
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x8
+	.long	.LASF63
+	.value	0x23d
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x13
+	.long	.LASF141
+	.value	0x23f
+	.byte	0x15
+	.long	0x11c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x2
+	.quad	.LVL266
+	.long	0x7a7
+	.long	0x163e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL268
+	.long	0x1f7d
+	.long	0x165c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL269
+	.long	0x3193
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF142
+	.value	0x22a
+	.byte	0x9
+	.long	0x644
+	.quad	.LFB54
+	.quad	.LFE54-.LFB54
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17ad
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x22a
+	.byte	0x33
+	.long	0x4ae
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x13
+	.long	.LASF143
+	.value	0x22c
+	.byte	0xa
+	.long	0x498
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x8
+	.long	.LASF108
+	.value	0x231
+	.byte	0xb
+	.long	0x644
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x11
+	.long	0x23bc
+	.quad	.LBI129
+	.byte	.LVU880
+	.long	.LLRL107
+	.value	0x231
+	.byte	0x1d
+	.long	0x1792
+	.uleb128 0x3
+	.long	0x23db
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x3
+	.long	0x23ce
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x16
+	.long	0x23bc
+	.quad	.LBI131
+	.byte	.LVU893
+	.quad	.LBB131
+	.quad	.LBE131-.LBB131
+	.value	0x104
+	.byte	0xe
+	.long	0x177e
+	.uleb128 0x3
+	.long	0x23db
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x3
+	.long	0x23ce
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x2
+	.quad	.LVL260
+	.long	0x773
+	.long	0x176a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL261
+	.long	0x790
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL257
+	.long	0x5e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL255
+	.long	0x1a76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF144
+	.value	0x1fd
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a76
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x1fd
+	.byte	0x2e
+	.long	0x4ae
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x6
+	.long	.LASF108
+	.value	0x1fd
+	.byte	0x42
+	.long	0x61e
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x8
+	.long	.LASF112
+	.value	0x1fe
+	.byte	0xc
+	.long	0x10b
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x8
+	.long	.LASF145
+	.value	0x201
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x8
+	.long	.LASF146
+	.value	0x202
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x13
+	.long	.LASF143
+	.value	0x203
+	.byte	0xb
+	.long	0xd7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x8
+	.long	.LASF147
+	.value	0x20f
+	.byte	0x8
+	.long	0xbf
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x25
+	.quad	.LBB114
+	.quad	.LBE114-.LBB114
+	.long	0x194d
+	.uleb128 0x8
+	.long	.LASF141
+	.value	0x212
+	.byte	0x17
+	.long	0x11c
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x13
+	.long	.LASF148
+	.value	0x213
+	.byte	0xc
+	.long	0x498
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4a
+	.long	0x1e0c
+	.long	.LLRL99
+	.byte	0x1
+	.value	0x214
+	.byte	0x9
+	.long	0x1931
+	.uleb128 0x2e
+	.long	0x1e2b
+	.uleb128 0x2e
+	.long	0x1e1e
+	.uleb128 0x18
+	.long	.LLRL99
+	.uleb128 0xd
+	.long	0x1e38
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x11
+	.long	0x29ee
+	.quad	.LBI117
+	.byte	.LVU785
+	.long	.LLRL101
+	.value	0x1a2
+	.byte	0x30
+	.long	0x1915
+	.uleb128 0x3
+	.long	0x2a00
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x2f
+	.long	0x2a0e
+	.quad	.LBI118
+	.byte	.LVU787
+	.long	.LLRL101
+	.byte	0x2
+	.value	0x5c2
+	.byte	0xa
+	.uleb128 0x3
+	.long	0x2a2b
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x3
+	.long	0x2a1f
+	.long	.LLST104
+	.long	.LVUS104
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL234
+	.long	0x6c8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL237
+	.long	0x623
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL217
+	.long	0x649
+	.long	0x1965
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL219
+	.long	0x6c8
+	.long	0x1982
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x45
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL221
+	.long	0x5fd
+	.long	0x199f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL224
+	.long	0x6c8
+	.long	0x19bd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 1
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL227
+	.long	0x5fd
+	.long	0x19db
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL244
+	.long	0x773
+	.long	0x19fe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL245
+	.long	0x773
+	.long	0x1a20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL251
+	.long	0x773
+	.long	0x1a43
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL252
+	.long	0x649
+	.long	0x1a5b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL253
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF149
+	.value	0x1e8
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB52
+	.quad	.LFE52-.LFB52
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b9b
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x1e8
+	.byte	0x32
+	.long	0x4ae
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x6
+	.long	.LASF108
+	.value	0x1e8
+	.byte	0x45
+	.long	0x644
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x13
+	.long	.LASF141
+	.value	0x1ea
+	.byte	0x15
+	.long	0x11c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x8
+	.long	.LASF112
+	.value	0x1ef
+	.byte	0xc
+	.long	0x10b
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x8
+	.long	.LASF150
+	.value	0x1f0
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x2
+	.quad	.LVL199
+	.long	0x1dd7
+	.long	0x1b15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL203
+	.long	0x649
+	.long	0x1b2d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL205
+	.long	0x623
+	.long	0x1b45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL213
+	.long	0x773
+	.long	0x1b68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL214
+	.long	0x649
+	.long	0x1b80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL215
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF151
+	.value	0x1dc
+	.byte	0x7
+	.long	0xba
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cb9
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x1dc
+	.byte	0x32
+	.long	0x4ae
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x13
+	.long	.LASF141
+	.value	0x1dd
+	.byte	0x15
+	.long	0x11c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x11
+	.long	0x238f
+	.quad	.LBI102
+	.byte	.LVU679
+	.long	.LLRL83
+	.value	0x1e2
+	.byte	0xa
+	.long	0x1c9e
+	.uleb128 0x3
+	.long	0x23ae
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x3
+	.long	0x23a1
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x16
+	.long	0x238f
+	.quad	.LBI104
+	.byte	.LVU688
+	.quad	.LBB104
+	.quad	.LBE104-.LBB104
+	.value	0x117
+	.byte	0xe
+	.long	0x1c89
+	.uleb128 0x3
+	.long	0x23ae
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x3
+	.long	0x23a1
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x2
+	.quad	.LVL193
+	.long	0x773
+	.long	0x1c74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL194
+	.long	0x71c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL190
+	.long	0x68b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL188
+	.long	0x1dd7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF152
+	.value	0x1c1
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1dd2
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x1c1
+	.byte	0x33
+	.long	0x4ae
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x6
+	.long	.LASF153
+	.value	0x1c1
+	.byte	0x5c
+	.long	0x686
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x6
+	.long	.LASF141
+	.value	0x1c1
+	.byte	0x7b
+	.long	0x1dd2
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x24
+	.string	"end"
+	.value	0x1c3
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x25
+	.quad	.LBB97
+	.quad	.LBE97-.LBB97
+	.long	0x1d72
+	.uleb128 0x8
+	.long	.LASF145
+	.value	0x1c5
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x5
+	.quad	.LVL177
+	.long	0x665
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL180
+	.long	0x6c8
+	.long	0x1d90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 1
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL181
+	.long	0x773
+	.long	0x1db3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL182
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x11c
+	.uleb128 0x27
+	.long	.LASF154
+	.value	0x1b2
+	.long	0x46
+	.long	0x1e0c
+	.uleb128 0xa
+	.long	.LASF107
+	.byte	0x1
+	.value	0x1b2
+	.byte	0x35
+	.long	0x4ae
+	.uleb128 0xa
+	.long	.LASF141
+	.byte	0x1
+	.value	0x1b2
+	.byte	0x53
+	.long	0x1dd2
+	.uleb128 0x30
+	.string	"end"
+	.value	0x1b6
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF156
+	.byte	0x1
+	.value	0x19f
+	.byte	0xc
+	.long	0x46
+	.byte	0x1
+	.long	0x1e44
+	.uleb128 0xa
+	.long	.LASF107
+	.byte	0x1
+	.value	0x19f
+	.byte	0x34
+	.long	0x4ae
+	.uleb128 0xa
+	.long	.LASF141
+	.byte	0x1
+	.value	0x19f
+	.byte	0x52
+	.long	0x1dd2
+	.uleb128 0x30
+	.string	"end"
+	.value	0x1a1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF157
+	.value	0x18b
+	.byte	0x7
+	.long	0xba
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f7d
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x18b
+	.byte	0x2f
+	.long	0x4ae
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x6
+	.long	.LASF63
+	.value	0x18b
+	.byte	0x44
+	.long	0x4d
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x13
+	.long	.LASF141
+	.value	0x18c
+	.byte	0x15
+	.long	0x11c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x11
+	.long	0x238f
+	.quad	.LBI64
+	.byte	.LVU533
+	.long	.LLRL59
+	.value	0x191
+	.byte	0xa
+	.long	0x1f5b
+	.uleb128 0x3
+	.long	0x23ae
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x3
+	.long	0x23a1
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x16
+	.long	0x238f
+	.quad	.LBI66
+	.byte	.LVU542
+	.quad	.LBB66
+	.quad	.LBE66-.LBB66
+	.value	0x117
+	.byte	0xe
+	.long	0x1f46
+	.uleb128 0x3
+	.long	0x23ae
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x3
+	.long	0x23a1
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x2
+	.quad	.LVL159
+	.long	0x773
+	.long	0x1f31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL160
+	.long	0x71c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL156
+	.long	0x68b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL154
+	.long	0x1f7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF158
+	.value	0x176
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x203b
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x176
+	.byte	0x32
+	.long	0x4ae
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x6
+	.long	.LASF63
+	.value	0x176
+	.byte	0x47
+	.long	0x4d
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x6
+	.long	.LASF141
+	.value	0x176
+	.byte	0x62
+	.long	0x1dd2
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x2
+	.quad	.LVL139
+	.long	0x6c8
+	.long	0x1ff9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL148
+	.long	0x773
+	.long	0x201c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL149
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF159
+	.value	0x16a
+	.byte	0x7
+	.long	0xba
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x219b
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x16a
+	.byte	0x2d
+	.long	0x4ae
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x6
+	.long	.LASF160
+	.value	0x16a
+	.byte	0x43
+	.long	0xc6
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x6
+	.long	.LASF161
+	.value	0x16a
+	.byte	0x5b
+	.long	0xc6
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x13
+	.long	.LASF141
+	.value	0x16b
+	.byte	0x15
+	.long	0x11c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x11
+	.long	0x238f
+	.quad	.LBI54
+	.byte	.LVU448
+	.long	.LLRL49
+	.value	0x170
+	.byte	0xa
+	.long	0x2166
+	.uleb128 0x3
+	.long	0x23ae
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x3
+	.long	0x23a1
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x16
+	.long	0x238f
+	.quad	.LBI56
+	.byte	.LVU457
+	.quad	.LBB56
+	.quad	.LBE56-.LBB56
+	.value	0x117
+	.byte	0xe
+	.long	0x2151
+	.uleb128 0x3
+	.long	0x23ae
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x3
+	.long	0x23a1
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x2
+	.quad	.LVL133
+	.long	0x773
+	.long	0x213c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL134
+	.long	0x71c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL130
+	.long	0x68b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL128
+	.long	0x219b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF162
+	.value	0x14d
+	.long	0x46
+	.long	0x21f8
+	.uleb128 0xa
+	.long	.LASF107
+	.byte	0x1
+	.value	0x14d
+	.byte	0x30
+	.long	0x4ae
+	.uleb128 0xa
+	.long	.LASF160
+	.byte	0x1
+	.value	0x14d
+	.byte	0x46
+	.long	0xc6
+	.uleb128 0xa
+	.long	.LASF161
+	.byte	0x1
+	.value	0x14d
+	.byte	0x5e
+	.long	0xc6
+	.uleb128 0xa
+	.long	.LASF141
+	.byte	0x1
+	.value	0x14d
+	.byte	0x7c
+	.long	0x1dd2
+	.uleb128 0x30
+	.string	"end"
+	.value	0x154
+	.long	0x2e
+	.uleb128 0x2d
+	.uleb128 0x20
+	.long	.LASF145
+	.value	0x156
+	.byte	0xc
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF163
+	.value	0x142
+	.byte	0x6
+	.long	0xbf
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2248
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x142
+	.byte	0x2f
+	.long	0x4ae
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x5
+	.quad	.LVL111
+	.long	0x6c8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF165
+	.value	0x122
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x238f
+	.uleb128 0x6
+	.long	.LASF107
+	.value	0x122
+	.byte	0x2c
+	.long	0x4ae
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x8
+	.long	.LASF64
+	.value	0x124
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x8
+	.long	.LASF120
+	.value	0x125
+	.byte	0x21
+	.long	0x489
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x11
+	.long	0x2a0e
+	.quad	.LBI37
+	.byte	.LVU341
+	.long	.LLRL29
+	.value	0x126
+	.byte	0x37
+	.long	0x22d5
+	.uleb128 0x3
+	.long	0x2a2b
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x3
+	.long	0x2a1f
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.uleb128 0x16
+	.long	0x29bc
+	.quad	.LBI41
+	.byte	.LVU348
+	.quad	.LBB41
+	.quad	.LBE41-.LBB41
+	.value	0x126
+	.byte	0x77
+	.long	0x2315
+	.uleb128 0x3
+	.long	0x29db
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x3
+	.long	0x29ce
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL96
+	.long	0x6c8
+	.long	0x2332
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL98
+	.long	0x6e4
+	.uleb128 0x2
+	.quad	.LVL100
+	.long	0x773
+	.long	0x235c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL105
+	.long	0x700
+	.long	0x2374
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL109
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF166
+	.byte	0x1
+	.value	0x117
+	.byte	0xe
+	.long	0xba
+	.byte	0x1
+	.long	0x23bc
+	.uleb128 0xa
+	.long	.LASF107
+	.byte	0x1
+	.value	0x117
+	.byte	0x33
+	.long	0x4ae
+	.uleb128 0xa
+	.long	.LASF141
+	.byte	0x1
+	.value	0x117
+	.byte	0x57
+	.long	0x493
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF167
+	.byte	0x1
+	.value	0x104
+	.byte	0xe
+	.long	0xac
+	.byte	0x1
+	.long	0x23e9
+	.uleb128 0xa
+	.long	.LASF107
+	.byte	0x1
+	.value	0x104
+	.byte	0x32
+	.long	0x4ae
+	.uleb128 0xa
+	.long	.LASF133
+	.byte	0x1
+	.value	0x104
+	.byte	0x4a
+	.long	0x3a
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF168
+	.byte	0xf5
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2420
+	.uleb128 0x19
+	.long	.LASF107
+	.byte	0xf5
+	.byte	0x2e
+	.long	0x4ae
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x19
+	.long	.LASF73
+	.byte	0xf5
+	.byte	0x4d
+	.long	0x48e
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF169
+	.byte	0xee
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2457
+	.uleb128 0x19
+	.long	.LASF107
+	.byte	0xee
+	.byte	0x2e
+	.long	0x4ae
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x19
+	.long	.LASF70
+	.byte	0xee
+	.byte	0x4d
+	.long	0x421
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF170
+	.byte	0xe5
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2481
+	.uleb128 0x10
+	.quad	.LVL89
+	.long	0x273b
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF171
+	.byte	0xcf
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x252f
+	.uleb128 0x14
+	.long	.LASF107
+	.byte	0xcf
+	.byte	0x2e
+	.long	0x4ae
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x1a
+	.long	.LASF172
+	.byte	0xd3
+	.byte	0x7
+	.long	0x46
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x1a
+	.long	.LASF69
+	.byte	0xda
+	.byte	0x18
+	.long	0x341
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1a
+	.long	.LASF65
+	.byte	0xdb
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x3b
+	.quad	.LVL76
+	.long	0x273b
+	.long	0x2502
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL78
+	.long	0x2721
+	.long	0x251a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL81
+	.long	0x2916
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF173
+	.byte	0x1
+	.byte	0xc0
+	.byte	0x19
+	.long	0x4ae
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x25c3
+	.uleb128 0x14
+	.long	.LASF174
+	.byte	0xc0
+	.byte	0x36
+	.long	0x3a
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x1a
+	.long	.LASF107
+	.byte	0xc4
+	.byte	0x1b
+	.long	0x4ae
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x2
+	.quad	.LVL335
+	.long	0x1237
+	.long	0x2595
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3b
+	.quad	.LVL340
+	.long	0x280d
+	.long	0x25ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL341
+	.long	0x273b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF175
+	.byte	0xa5
+	.byte	0x7
+	.long	0xba
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2657
+	.uleb128 0x14
+	.long	.LASF107
+	.byte	0xa5
+	.byte	0x30
+	.long	0x4ae
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1a
+	.long	.LASF62
+	.byte	0xa6
+	.byte	0x9
+	.long	0xba
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x25
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.long	0x2642
+	.uleb128 0x2a
+	.long	.LASF141
+	.byte	0xa9
+	.byte	0x17
+	.long	0x11c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.quad	.LVL66
+	.long	0x71c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL69
+	.long	0x74d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF176
+	.byte	0x97
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2721
+	.uleb128 0x14
+	.long	.LASF107
+	.byte	0x97
+	.byte	0x27
+	.long	0x4ae
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x14
+	.long	.LASF62
+	.byte	0x97
+	.byte	0x38
+	.long	0xba
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x14
+	.long	.LASF63
+	.byte	0x97
+	.byte	0x4d
+	.long	0x3a
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x4c
+	.long	0x27f3
+	.quad	.LBI32
+	.byte	.LVU165
+	.long	.LLRL18
+	.byte	0x1
+	.byte	0x9b
+	.byte	0x3
+	.uleb128 0x3
+	.long	0x2800
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x2
+	.quad	.LVL49
+	.long	0x74d
+	.long	0x26eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL50
+	.long	0x760
+	.uleb128 0x10
+	.quad	.LVL51
+	.long	0x760
+	.uleb128 0x10
+	.quad	.LVL58
+	.long	0x732
+	.uleb128 0x10
+	.quad	.LVL59
+	.long	0x760
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF177
+	.byte	0x1
+	.byte	0x8b
+	.byte	0x6
+	.byte	0x1
+	.long	0x273b
+	.uleb128 0x21
+	.long	.LASF107
+	.byte	0x1
+	.byte	0x8b
+	.byte	0x27
+	.long	0x4ae
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF178
+	.byte	0x80
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x27f3
+	.uleb128 0x14
+	.long	.LASF107
+	.byte	0x80
+	.byte	0x29
+	.long	0x4ae
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x4e
+	.long	0x27f3
+	.quad	.LBI22
+	.byte	.LVU123
+	.long	.LLRL11
+	.byte	0x1
+	.byte	0x82
+	.byte	0x5
+	.long	0x27dd
+	.uleb128 0x3
+	.long	0x2800
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2
+	.quad	.LVL37
+	.long	0x74d
+	.long	0x27a8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL38
+	.long	0x760
+	.uleb128 0x10
+	.quad	.LVL39
+	.long	0x760
+	.uleb128 0x10
+	.quad	.LVL42
+	.long	0x732
+	.uleb128 0x10
+	.quad	.LVL43
+	.long	0x760
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL41
+	.long	0x760
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.long	.LASF191
+	.byte	0x1
+	.byte	0x6b
+	.byte	0xd
+	.byte	0x1
+	.long	0x280d
+	.uleb128 0x21
+	.long	.LASF107
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x37
+	.long	0x4ae
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF179
+	.byte	0x1
+	.byte	0x43
+	.byte	0x19
+	.long	0x4ae
+	.byte	0x1
+	.long	0x284e
+	.uleb128 0x21
+	.long	.LASF174
+	.byte	0x1
+	.byte	0x43
+	.byte	0x36
+	.long	0x3a
+	.uleb128 0x31
+	.long	.LASF62
+	.byte	0x51
+	.byte	0x9
+	.long	0xba
+	.uleb128 0x31
+	.long	.LASF107
+	.byte	0x59
+	.byte	0x1b
+	.long	0x4ae
+	.uleb128 0x2d
+	.uleb128 0x31
+	.long	.LASF107
+	.byte	0x46
+	.byte	0x1d
+	.long	0x4ae
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF180
+	.byte	0x33
+	.byte	0x19
+	.long	0x4ae
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2916
+	.uleb128 0x14
+	.long	.LASF62
+	.byte	0x33
+	.byte	0x2b
+	.long	0xba
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x14
+	.long	.LASF63
+	.byte	0x33
+	.byte	0x40
+	.long	0x3a
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1a
+	.long	.LASF133
+	.byte	0x37
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1a
+	.long	.LASF107
+	.byte	0x38
+	.byte	0x1b
+	.long	0x4ae
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x2
+	.quad	.LVL4
+	.long	0x790
+	.long	0x28d4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x158
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL6
+	.long	0x773
+	.long	0x28f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL7
+	.long	0x2916
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF181
+	.byte	0x22
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x295a
+	.uleb128 0x19
+	.long	.LASF107
+	.byte	0x22
+	.byte	0x26
+	.long	0x4ae
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x19
+	.long	.LASF62
+	.byte	0x22
+	.byte	0x37
+	.long	0xba
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x19
+	.long	.LASF63
+	.byte	0x22
+	.byte	0x4c
+	.long	0x3a
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF182
+	.byte	0x18
+	.byte	0x19
+	.long	0x4ae
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x29bc
+	.uleb128 0x14
+	.long	.LASF62
+	.byte	0x18
+	.byte	0x29
+	.long	0xba
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2
+	.quad	.LVL13
+	.long	0x7a7
+	.long	0x29a6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL15
+	.long	0x284e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF183
+	.byte	0x2
+	.value	0x7b1
+	.byte	0x13
+	.long	0x46
+	.byte	0x3
+	.long	0x29e9
+	.uleb128 0xa
+	.long	.LASF120
+	.byte	0x2
+	.value	0x7b1
+	.byte	0x4f
+	.long	0x29e9
+	.uleb128 0xa
+	.long	.LASF64
+	.byte	0x2
+	.value	0x7b1
+	.byte	0x63
+	.long	0x3a
+	.byte	0
+	.uleb128 0xb
+	.long	0x484
+	.uleb128 0x1d
+	.long	.LASF184
+	.byte	0x2
+	.value	0x5c1
+	.byte	0x13
+	.long	0x46
+	.byte	0x3
+	.long	0x2a0e
+	.uleb128 0xa
+	.long	.LASF122
+	.byte	0x2
+	.value	0x5c1
+	.byte	0x29
+	.long	0xc6
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF185
+	.byte	0x2
+	.byte	0xca
+	.byte	0x13
+	.long	0x46
+	.byte	0x3
+	.long	0x2a38
+	.uleb128 0x21
+	.long	.LASF122
+	.byte	0x2
+	.byte	0xca
+	.byte	0x29
+	.long	0xc6
+	.uleb128 0x21
+	.long	.LASF186
+	.byte	0x2
+	.byte	0xca
+	.byte	0x43
+	.long	0x75
+	.byte	0
+	.uleb128 0x1e
+	.long	0x280d
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ba1
+	.uleb128 0x3
+	.long	0x281e
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xd
+	.long	0x282a
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xd
+	.long	0x2835
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x52
+	.long	0x280d
+	.quad	.LBI17
+	.byte	.LVU90
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.byte	0x1
+	.byte	0x43
+	.byte	0x19
+	.long	0x2b35
+	.uleb128 0x3
+	.long	0x281e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1f
+	.long	0x282a
+	.uleb128 0x1f
+	.long	0x2835
+	.uleb128 0x53
+	.long	0x2840
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0xd
+	.long	0x2841
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2
+	.quad	.LVL27
+	.long	0x790
+	.long	0x2af1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x158
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL29
+	.long	0x773
+	.long	0x2b12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL30
+	.long	0x2916
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL18
+	.long	0x790
+	.long	0x2b4d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 1
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL20
+	.long	0x773
+	.long	0x2b6e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL21
+	.long	0x284e
+	.long	0x2b8c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL34
+	.long	0x760
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x2721
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2c0e
+	.uleb128 0x3
+	.long	0x272e
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x54
+	.long	0x2721
+	.quad	.LBI28
+	.byte	.LVU149
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.byte	0x1
+	.byte	0x8b
+	.byte	0x6
+	.uleb128 0x3
+	.long	0x272e
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1c
+	.quad	.LVL46
+	.long	0x74d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x219b
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d7a
+	.uleb128 0x3
+	.long	0x21aa
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x3
+	.long	0x21b7
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x3
+	.long	0x21c4
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x3
+	.long	0x21d1
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x1f
+	.long	0x21de
+	.uleb128 0x16
+	.long	0x219b
+	.quad	.LBI46
+	.byte	.LVU388
+	.quad	.LBB46
+	.quad	.LBE46-.LBB46
+	.value	0x14d
+	.byte	0x5
+	.long	0x2d60
+	.uleb128 0x3
+	.long	0x21b7
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x3
+	.long	0x21d1
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x3
+	.long	0x21c4
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x3
+	.long	0x21aa
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0xd
+	.long	0x21de
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x37
+	.long	0x21e9
+	.long	.LLRL44
+	.long	0x2d1e
+	.uleb128 0xd
+	.long	0x21ea
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x2
+	.quad	.LVL118
+	.long	0x6c8
+	.long	0x2d00
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 1
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL121
+	.long	0x6a7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL123
+	.long	0x773
+	.long	0x2d41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 1
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL124
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL115
+	.long	0x6c8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1dd7
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2eeb
+	.uleb128 0x3
+	.long	0x1de6
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x3
+	.long	0x1df3
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x1f
+	.long	0x1e00
+	.uleb128 0x11
+	.long	0x1e0c
+	.quad	.LBI77
+	.byte	.LVU558
+	.long	.LLRL66
+	.value	0x1b3
+	.byte	0x7
+	.long	0x2e6d
+	.uleb128 0x3
+	.long	0x1e2b
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x3
+	.long	0x1e1e
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x18
+	.long	.LLRL66
+	.uleb128 0xd
+	.long	0x1e38
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x11
+	.long	0x29ee
+	.quad	.LBI79
+	.byte	.LVU565
+	.long	.LLRL70
+	.value	0x1a2
+	.byte	0x30
+	.long	0x2e51
+	.uleb128 0x3
+	.long	0x2a00
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x2f
+	.long	0x2a0e
+	.quad	.LBI80
+	.byte	.LVU567
+	.long	.LLRL70
+	.byte	0x2
+	.value	0x5c2
+	.byte	0xa
+	.uleb128 0x3
+	.long	0x2a2b
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x3
+	.long	0x2a1f
+	.long	.LLST73
+	.long	.LVUS73
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL168
+	.long	0x6c8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	0x1dd7
+	.quad	.LBI92
+	.byte	.LVU592
+	.long	.LLRL74
+	.byte	0x1
+	.value	0x1b2
+	.byte	0x5
+	.uleb128 0x2e
+	.long	0x1df3
+	.uleb128 0x3
+	.long	0x1de6
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x18
+	.long	.LLRL74
+	.uleb128 0xd
+	.long	0x1e00
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x2
+	.quad	.LVL170
+	.long	0x773
+	.long	0x2eca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL171
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x13e1
+	.quad	.LFB58
+	.quad	.LFE58-.LFB58
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x30c6
+	.uleb128 0x3
+	.long	0x13f0
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x3
+	.long	0x13fd
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x1f
+	.long	0x140a
+	.uleb128 0x1f
+	.long	0x1416
+	.uleb128 0x11
+	.long	0x13e1
+	.quad	.LBI150
+	.byte	.LVU983
+	.long	.LLRL126
+	.value	0x292
+	.byte	0x5
+	.long	0x30ba
+	.uleb128 0x3
+	.long	0x13fd
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x3
+	.long	0x13f0
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x18
+	.long	.LLRL126
+	.uleb128 0xd
+	.long	0x140a
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0xd
+	.long	0x1416
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x11
+	.long	0x1423
+	.quad	.LBI152
+	.byte	.LVU1011
+	.long	.LLRL131
+	.value	0x2af
+	.byte	0xa
+	.long	0x3099
+	.uleb128 0x3
+	.long	0x1442
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x3
+	.long	0x1435
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x18
+	.long	.LLRL131
+	.uleb128 0xd
+	.long	0x144f
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x38
+	.long	0x145b
+	.quad	.LBB154
+	.quad	.LBE154-.LBB154
+	.long	0x3043
+	.uleb128 0xd
+	.long	0x145c
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x2
+	.quad	.LVL300
+	.long	0x790
+	.long	0x2fff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL302
+	.long	0x773
+	.long	0x3021
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL303
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL310
+	.long	0x585
+	.long	0x305b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL312
+	.long	0x773
+	.long	0x307d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL313
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL299
+	.long	0x773
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL304
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1099
+	.quad	.LFB62
+	.quad	.LFE62-.LFB62
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x318a
+	.uleb128 0x3
+	.long	0x10a8
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x3
+	.long	0x10b5
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x3
+	.long	0x10c2
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x16
+	.long	0x1099
+	.quad	.LBI184
+	.byte	.LVU1277
+	.quad	.LBB184
+	.quad	.LBE184-.LBB184
+	.value	0x2d9
+	.byte	0x5
+	.long	0x316f
+	.uleb128 0x3
+	.long	0x10c2
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x3
+	.long	0x10b5
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x3
+	.long	0x10a8
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x5
+	.quad	.LVL369
+	.long	0x318a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL367
+	.long	0x13e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF88
+	.long	.LASF187
+	.uleb128 0x3c
+	.long	.LASF89
+	.long	.LASF188
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 693
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS193:
+	.uleb128 0
+	.uleb128 .LVU1657
+	.uleb128 .LVU1657
+	.uleb128 .LVU1674
+	.uleb128 .LVU1674
+	.uleb128 .LVU1677
+	.uleb128 .LVU1677
+	.uleb128 0
+.LLST193:
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LVL509-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL509-1-.Ltext0
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS194:
+	.uleb128 0
+	.uleb128 .LVU1657
+	.uleb128 .LVU1657
+	.uleb128 .LVU1658
+	.uleb128 .LVU1658
+	.uleb128 0
+.LLST194:
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LVL509-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL509-1-.Ltext0
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS195:
+	.uleb128 0
+	.uleb128 .LVU1657
+	.uleb128 .LVU1657
+	.uleb128 .LVU1663
+	.uleb128 .LVU1663
+	.uleb128 0
+.LLST195:
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LVL509-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL509-1-.Ltext0
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU1660
+	.uleb128 .LVU1662
+	.uleb128 .LVU1662
+	.uleb128 .LVU1675
+	.uleb128 .LVU1677
+	.uleb128 0
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 .LVL512-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL512-1-.Ltext0
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU1663
+	.uleb128 .LVU1666
+	.uleb128 .LVU1666
+	.uleb128 .LVU1676
+	.uleb128 .LVU1677
+	.uleb128 .LVU1679
+	.uleb128 .LVU1679
+	.uleb128 0
+.LLST197:
+	.byte	0x4
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LVL520-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL520-1-.Ltext0
+	.uleb128 .LFE72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS189:
+	.uleb128 0
+	.uleb128 .LVU1621
+	.uleb128 .LVU1621
+	.uleb128 .LVU1623
+	.uleb128 .LVU1623
+	.uleb128 .LVU1626
+	.uleb128 .LVU1626
+	.uleb128 .LVU1637
+	.uleb128 .LVU1637
+	.uleb128 .LVU1642
+	.uleb128 .LVU1642
+	.uleb128 0
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 .LVL492-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL492-1-.Ltext0
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS190:
+	.uleb128 0
+	.uleb128 .LVU1619
+	.uleb128 .LVU1619
+	.uleb128 .LVU1624
+	.uleb128 .LVU1624
+	.uleb128 .LVU1626
+	.uleb128 .LVU1626
+	.uleb128 .LVU1639
+	.uleb128 .LVU1639
+	.uleb128 .LVU1642
+	.uleb128 .LVU1642
+	.uleb128 0
+.LLST190:
+	.byte	0x4
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS191:
+	.uleb128 0
+	.uleb128 .LVU1621
+	.uleb128 .LVU1621
+	.uleb128 .LVU1625
+	.uleb128 .LVU1625
+	.uleb128 .LVU1626
+	.uleb128 .LVU1626
+	.uleb128 .LVU1641
+	.uleb128 .LVU1641
+	.uleb128 .LVU1642
+	.uleb128 .LVU1642
+	.uleb128 0
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 .LVL492-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL492-1-.Ltext0
+	.uleb128 .LVL495-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL495-.Ltext0
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU1630
+	.uleb128 .LVU1632
+	.uleb128 .LVU1632
+	.uleb128 .LVU1638
+	.uleb128 .LVU1642
+	.uleb128 0
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL498-.Ltext0
+	.uleb128 .LVL499-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL499-1-.Ltext0
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 .LFE71-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS186:
+	.uleb128 0
+	.uleb128 .LVU1586
+	.uleb128 .LVU1586
+	.uleb128 .LVU1588
+	.uleb128 .LVU1588
+	.uleb128 .LVU1590
+	.uleb128 .LVU1590
+	.uleb128 .LVU1601
+	.uleb128 .LVU1601
+	.uleb128 .LVU1605
+	.uleb128 .LVU1605
+	.uleb128 0
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL476-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL476-1-.Ltext0
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS187:
+	.uleb128 0
+	.uleb128 .LVU1583
+	.uleb128 .LVU1583
+	.uleb128 .LVU1589
+	.uleb128 .LVU1589
+	.uleb128 .LVU1590
+	.uleb128 .LVU1590
+	.uleb128 .LVU1602
+	.uleb128 .LVU1602
+	.uleb128 .LVU1605
+	.uleb128 .LVU1605
+	.uleb128 0
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 .LVL478-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL478-.Ltext0
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU1594
+	.uleb128 .LVU1596
+	.uleb128 .LVU1596
+	.uleb128 .LVU1604
+	.uleb128 .LVU1605
+	.uleb128 0
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 .LVL482-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL482-1-.Ltext0
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LFE70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS183:
+	.uleb128 0
+	.uleb128 .LVU1550
+	.uleb128 .LVU1550
+	.uleb128 .LVU1552
+	.uleb128 .LVU1552
+	.uleb128 .LVU1554
+	.uleb128 .LVU1554
+	.uleb128 .LVU1565
+	.uleb128 .LVU1565
+	.uleb128 .LVU1569
+	.uleb128 .LVU1569
+	.uleb128 0
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 .LVL460-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL460-1-.Ltext0
+	.uleb128 .LVL461-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL461-.Ltext0
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS184:
+	.uleb128 0
+	.uleb128 .LVU1547
+	.uleb128 .LVU1547
+	.uleb128 .LVU1553
+	.uleb128 .LVU1553
+	.uleb128 .LVU1554
+	.uleb128 .LVU1554
+	.uleb128 .LVU1568
+	.uleb128 .LVU1568
+	.uleb128 .LVU1569
+	.uleb128 .LVU1569
+	.uleb128 0
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 .LVL459-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL459-.Ltext0
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU1558
+	.uleb128 .LVU1560
+	.uleb128 .LVU1560
+	.uleb128 .LVU1566
+	.uleb128 .LVU1569
+	.uleb128 0
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL466-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL466-1-.Ltext0
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 .LFE69-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS181:
+	.uleb128 0
+	.uleb128 .LVU1534
+	.uleb128 .LVU1534
+	.uleb128 .LVU1541
+	.uleb128 .LVU1541
+	.uleb128 .LVU1542
+	.uleb128 .LVU1542
+	.uleb128 0
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL456-.Ltext0
+	.uleb128 .LVL457-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL457-1-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS182:
+	.uleb128 0
+	.uleb128 .LVU1536
+	.uleb128 .LVU1536
+	.uleb128 .LVU1539
+	.uleb128 .LVU1539
+	.uleb128 .LVU1542
+	.uleb128 .LVU1542
+	.uleb128 0
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL454-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL454-1-.Ltext0
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 .LVL457-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL457-1-.Ltext0
+	.uleb128 .LFE68-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS173:
+	.uleb128 0
+	.uleb128 .LVU1423
+	.uleb128 .LVU1423
+	.uleb128 .LVU1493
+	.uleb128 .LVU1493
+	.uleb128 .LVU1494
+	.uleb128 .LVU1494
+	.uleb128 .LVU1516
+	.uleb128 .LVU1516
+	.uleb128 .LVU1518
+	.uleb128 .LVU1518
+	.uleb128 0
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL415-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL415-1-.Ltext0
+	.uleb128 .LVL431-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL431-.Ltext0
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS174:
+	.uleb128 0
+	.uleb128 .LVU1421
+	.uleb128 .LVU1421
+	.uleb128 .LVU1492
+	.uleb128 .LVU1492
+	.uleb128 .LVU1494
+	.uleb128 .LVU1494
+	.uleb128 .LVU1515
+	.uleb128 .LVU1515
+	.uleb128 .LVU1518
+	.uleb128 .LVU1518
+	.uleb128 0
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 .LVL430-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL430-.Ltext0
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS175:
+	.uleb128 0
+	.uleb128 .LVU1423
+	.uleb128 .LVU1423
+	.uleb128 .LVU1491
+	.uleb128 .LVU1491
+	.uleb128 .LVU1494
+	.uleb128 .LVU1494
+	.uleb128 .LVU1514
+	.uleb128 .LVU1514
+	.uleb128 .LVU1518
+	.uleb128 .LVU1518
+	.uleb128 0
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL415-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL415-1-.Ltext0
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL429-.Ltext0
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU1430
+	.uleb128 .LVU1433
+	.uleb128 .LVU1433
+	.uleb128 .LVU1450
+	.uleb128 .LVU1450
+	.uleb128 .LVU1458
+	.uleb128 .LVU1458
+	.uleb128 .LVU1481
+	.uleb128 .LVU1494
+	.uleb128 .LVU1512
+	.uleb128 .LVU1518
+	.uleb128 .LVU1528
+	.uleb128 .LVU1528
+	.uleb128 0
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LVL451-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL451-.Ltext0
+	.uleb128 .LFE67-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU1437
+	.uleb128 .LVU1439
+	.uleb128 .LVU1439
+	.uleb128 .LVU1448
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL419-.Ltext0
+	.uleb128 .LVL420-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL420-1-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU1455
+	.uleb128 .LVU1476
+	.uleb128 .LVU1494
+	.uleb128 .LVU1499
+	.uleb128 .LVU1500
+	.uleb128 .LVU1505
+	.uleb128 .LVU1506
+	.uleb128 .LVU1511
+	.uleb128 .LVU1518
+	.uleb128 .LVU1522
+	.uleb128 .LVU1523
+	.uleb128 .LVU1527
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL424-.Ltext0
+	.uleb128 .LVL427-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 .LVL437-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU1458
+	.uleb128 .LVU1469
+	.uleb128 .LVU1494
+	.uleb128 .LVU1496
+	.uleb128 .LVU1500
+	.uleb128 .LVU1502
+	.uleb128 .LVU1506
+	.uleb128 .LVU1508
+	.uleb128 .LVU1518
+	.uleb128 .LVU1519
+	.uleb128 .LVU1523
+	.uleb128 .LVU1524
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL433-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 .LVL446-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS171:
+	.uleb128 0
+	.uleb128 .LVU1407
+	.uleb128 .LVU1407
+	.uleb128 .LVU1415
+	.uleb128 .LVU1415
+	.uleb128 0
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 .LFE66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS172:
+	.uleb128 0
+	.uleb128 .LVU1410
+	.uleb128 .LVU1410
+	.uleb128 0
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL410-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL410-1-.Ltext0
+	.uleb128 .LFE66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS169:
+	.uleb128 0
+	.uleb128 .LVU1393
+	.uleb128 .LVU1393
+	.uleb128 .LVU1400
+	.uleb128 .LVU1400
+	.uleb128 .LVU1401
+	.uleb128 .LVU1401
+	.uleb128 0
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 .LVL407-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL407-1-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS170:
+	.uleb128 0
+	.uleb128 .LVU1395
+	.uleb128 .LVU1395
+	.uleb128 .LVU1398
+	.uleb128 .LVU1398
+	.uleb128 .LVU1401
+	.uleb128 .LVU1401
+	.uleb128 0
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL404-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL404-1-.Ltext0
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 .LVL407-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL407-1-.Ltext0
+	.uleb128 .LFE65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS161:
+	.uleb128 0
+	.uleb128 .LVU1353
+	.uleb128 .LVU1353
+	.uleb128 .LVU1377
+	.uleb128 .LVU1377
+	.uleb128 .LVU1378
+	.uleb128 .LVU1378
+	.uleb128 .LVU1381
+	.uleb128 .LVU1381
+	.uleb128 .LVU1384
+	.uleb128 .LVU1384
+	.uleb128 .LVU1387
+	.uleb128 .LVU1387
+	.uleb128 0
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 .LVL395-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL395-.Ltext0
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL398-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL398-1-.Ltext0
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS162:
+	.uleb128 0
+	.uleb128 .LVU1320
+	.uleb128 .LVU1320
+	.uleb128 .LVU1361
+	.uleb128 .LVU1361
+	.uleb128 .LVU1378
+	.uleb128 .LVU1378
+	.uleb128 .LVU1380
+	.uleb128 .LVU1380
+	.uleb128 .LVU1387
+	.uleb128 .LVU1387
+	.uleb128 0
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS163:
+	.uleb128 0
+	.uleb128 .LVU1319
+	.uleb128 .LVU1319
+	.uleb128 .LVU1357
+	.uleb128 .LVU1357
+	.uleb128 .LVU1378
+	.uleb128 .LVU1378
+	.uleb128 .LVU1381
+	.uleb128 .LVU1381
+	.uleb128 .LVU1387
+	.uleb128 .LVU1387
+	.uleb128 0
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL379-.Ltext0
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL390-.Ltext0
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL398-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL398-1-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU1314
+	.uleb128 .LVU1320
+	.uleb128 .LVU1325
+	.uleb128 .LVU1350
+	.uleb128 .LVU1378
+	.uleb128 .LVU1383
+	.uleb128 .LVU1387
+	.uleb128 0
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU1358
+	.uleb128 .LVU1362
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL393-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU1316
+	.uleb128 .LVU1320
+	.uleb128 .LVU1378
+	.uleb128 .LVU1383
+	.uleb128 .LVU1387
+	.uleb128 0
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL380-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 .LFE64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU1360
+	.uleb128 .LVU1361
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL392-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS159:
+	.uleb128 0
+	.uleb128 .LVU1300
+	.uleb128 .LVU1300
+	.uleb128 .LVU1311
+	.uleb128 .LVU1311
+	.uleb128 0
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL376-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL376-1-.Ltext0
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 .LFE63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS160:
+	.uleb128 0
+	.uleb128 .LVU1298
+	.uleb128 .LVU1298
+	.uleb128 0
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LFE63-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS145:
+	.uleb128 0
+	.uleb128 .LVU1193
+	.uleb128 .LVU1193
+	.uleb128 .LVU1197
+	.uleb128 .LVU1197
+	.uleb128 .LVU1202
+	.uleb128 .LVU1202
+	.uleb128 .LVU1205
+	.uleb128 .LVU1205
+	.uleb128 .LVU1209
+	.uleb128 .LVU1209
+	.uleb128 0
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LFE61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU1191
+	.uleb128 .LVU1194
+	.uleb128 .LVU1197
+	.uleb128 .LVU1206
+	.uleb128 .LVU1209
+	.uleb128 0
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LFE61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU1199
+	.uleb128 .LVU1206
+	.uleb128 .LVU1209
+	.uleb128 .LVU1236
+	.uleb128 .LVU1242
+	.uleb128 .LVU1267
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU1199
+	.uleb128 .LVU1205
+	.uleb128 .LVU1205
+	.uleb128 .LVU1209
+	.uleb128 .LVU1209
+	.uleb128 .LVU1236
+	.uleb128 .LVU1242
+	.uleb128 .LVU1267
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU1216
+	.uleb128 .LVU1218
+	.uleb128 .LVU1218
+	.uleb128 .LVU1236
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL355-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL355-1-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU1244
+	.uleb128 .LVU1246
+	.uleb128 .LVU1246
+	.uleb128 .LVU1267
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LVL361-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL361-1-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS136:
+	.uleb128 0
+	.uleb128 .LVU1097
+	.uleb128 .LVU1097
+	.uleb128 .LVU1100
+	.uleb128 .LVU1100
+	.uleb128 .LVU1101
+	.uleb128 .LVU1101
+	.uleb128 0
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS137:
+	.uleb128 0
+	.uleb128 .LVU1098
+	.uleb128 .LVU1098
+	.uleb128 .LVU1101
+	.uleb128 .LVU1101
+	.uleb128 .LVU1108
+	.uleb128 .LVU1108
+	.uleb128 .LVU1134
+	.uleb128 .LVU1134
+	.uleb128 .LVU1137
+	.uleb128 .LVU1137
+	.uleb128 0
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL321-1-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL327-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL327-1-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU1092
+	.uleb128 .LVU1098
+	.uleb128 .LVU1098
+	.uleb128 .LVU1101
+	.uleb128 .LVU1101
+	.uleb128 .LVU1108
+	.uleb128 .LVU1108
+	.uleb128 .LVU1134
+	.uleb128 .LVU1134
+	.uleb128 .LVU1137
+	.uleb128 .LVU1137
+	.uleb128 0
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL321-1-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL327-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL327-1-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU1092
+	.uleb128 .LVU1100
+	.uleb128 .LVU1100
+	.uleb128 .LVU1101
+	.uleb128 .LVU1101
+	.uleb128 0
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LFE60-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU1138
+	.uleb128 .LVU1140
+	.uleb128 .LVU1140
+	.uleb128 .LVU1158
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL329-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL329-1-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU1109
+	.uleb128 .LVU1111
+	.uleb128 .LVU1111
+	.uleb128 .LVU1134
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL323-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL323-1-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS115:
+	.uleb128 0
+	.uleb128 .LVU943
+	.uleb128 .LVU943
+	.uleb128 .LVU957
+	.uleb128 .LVU957
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU972
+	.uleb128 .LVU972
+	.uleb128 0
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 0
+	.uleb128 .LVU943
+	.uleb128 .LVU943
+	.uleb128 0
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS117:
+	.uleb128 0
+	.uleb128 .LVU943
+	.uleb128 .LVU943
+	.uleb128 .LVU958
+	.uleb128 .LVU958
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU974
+	.uleb128 .LVU974
+	.uleb128 0
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL278-1-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LFE56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU951
+	.uleb128 .LVU959
+	.uleb128 .LVU968
+	.uleb128 .LVU971
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU945
+	.uleb128 .LVU951
+	.uleb128 .LVU959
+	.uleb128 .LVU968
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU945
+	.uleb128 .LVU951
+	.uleb128 .LVU959
+	.uleb128 .LVU968
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU959
+	.uleb128 .LVU968
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU959
+	.uleb128 .LVU968
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU913
+	.uleb128 .LVU913
+	.uleb128 .LVU929
+	.uleb128 .LVU929
+	.uleb128 .LVU930
+	.uleb128 .LVU930
+	.uleb128 .LVU937
+	.uleb128 .LVU937
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU915
+	.uleb128 .LVU915
+	.uleb128 .LVU927
+	.uleb128 .LVU927
+	.uleb128 .LVU930
+	.uleb128 .LVU930
+	.uleb128 .LVU935
+	.uleb128 .LVU935
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL266-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL266-1-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LFE55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU917
+	.uleb128 .LVU920
+	.uleb128 .LVU920
+	.uleb128 .LVU928
+	.uleb128 .LVU930
+	.uleb128 .LVU936
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL268-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL268-1-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS105:
+	.uleb128 0
+	.uleb128 .LVU878
+	.uleb128 .LVU878
+	.uleb128 .LVU892
+	.uleb128 .LVU892
+	.uleb128 .LVU893
+	.uleb128 .LVU893
+	.uleb128 .LVU908
+	.uleb128 .LVU908
+	.uleb128 0
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL255-1-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LFE54-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU886
+	.uleb128 .LVU893
+	.uleb128 .LVU902
+	.uleb128 .LVU905
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU880
+	.uleb128 .LVU886
+	.uleb128 .LVU893
+	.uleb128 .LVU902
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU880
+	.uleb128 .LVU886
+	.uleb128 .LVU893
+	.uleb128 .LVU902
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU893
+	.uleb128 .LVU902
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU893
+	.uleb128 .LVU902
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS92:
+	.uleb128 0
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 .LVU823
+	.uleb128 .LVU823
+	.uleb128 .LVU827
+	.uleb128 .LVU827
+	.uleb128 .LVU858
+	.uleb128 .LVU858
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 0
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL217-1-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS93:
+	.uleb128 0
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 .LVU826
+	.uleb128 .LVU826
+	.uleb128 .LVU827
+	.uleb128 .LVU827
+	.uleb128 .LVU862
+	.uleb128 .LVU862
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 0
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL217-1-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU754
+	.uleb128 .LVU755
+	.uleb128 .LVU755
+	.uleb128 .LVU824
+	.uleb128 .LVU827
+	.uleb128 .LVU860
+	.uleb128 .LVU863
+	.uleb128 0
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL219-1-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU756
+	.uleb128 .LVU760
+	.uleb128 .LVU774
+	.uleb128 .LVU780
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU758
+	.uleb128 .LVU762
+	.uleb128 .LVU762
+	.uleb128 .LVU763
+	.uleb128 .LVU776
+	.uleb128 .LVU780
+	.uleb128 .LVU780
+	.uleb128 .LVU785
+	.uleb128 .LVU820
+	.uleb128 .LVU821
+	.uleb128 .LVU827
+	.uleb128 .LVU859
+	.uleb128 .LVU863
+	.uleb128 0
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL224-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL224-1-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LFE53-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU781
+	.uleb128 .LVU785
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU802
+	.uleb128 .LVU803
+	.uleb128 .LVU803
+	.uleb128 .LVU807
+	.uleb128 .LVU807
+	.uleb128 .LVU809
+	.uleb128 .LVU809
+	.uleb128 .LVU821
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x73
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x73
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5c
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x55
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5c
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL237-1-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x5
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5c
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU785
+	.uleb128 .LVU795
+	.uleb128 .LVU795
+	.uleb128 .LVU797
+	.uleb128 .LVU797
+	.uleb128 .LVU804
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU785
+	.uleb128 .LVU789
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x73
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU787
+	.uleb128 .LVU789
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU787
+	.uleb128 .LVU789
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x73
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+.LVUS88:
+	.uleb128 0
+	.uleb128 .LVU707
+	.uleb128 .LVU707
+	.uleb128 .LVU710
+	.uleb128 .LVU710
+	.uleb128 .LVU711
+	.uleb128 .LVU711
+	.uleb128 .LVU730
+	.uleb128 .LVU730
+	.uleb128 .LVU733
+	.uleb128 .LVU733
+	.uleb128 0
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL199-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL199-1-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS89:
+	.uleb128 0
+	.uleb128 .LVU706
+	.uleb128 .LVU706
+	.uleb128 .LVU709
+	.uleb128 .LVU709
+	.uleb128 .LVU711
+	.uleb128 .LVU711
+	.uleb128 .LVU718
+	.uleb128 .LVU718
+	.uleb128 0
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU715
+	.uleb128 .LVU717
+	.uleb128 .LVU717
+	.uleb128 .LVU732
+	.uleb128 .LVU733
+	.uleb128 0
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU718
+	.uleb128 .LVU721
+	.uleb128 .LVU721
+	.uleb128 .LVU731
+	.uleb128 .LVU733
+	.uleb128 .LVU738
+	.uleb128 .LVU738
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 0
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL213-1-.Ltext0
+	.uleb128 .LFE52-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS82:
+	.uleb128 0
+	.uleb128 .LVU675
+	.uleb128 .LVU675
+	.uleb128 .LVU687
+	.uleb128 .LVU687
+	.uleb128 .LVU688
+	.uleb128 .LVU688
+	.uleb128 .LVU699
+	.uleb128 .LVU699
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL188-1-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU679
+	.uleb128 .LVU685
+	.uleb128 .LVU688
+	.uleb128 .LVU700
+	.uleb128 .LVU700
+	.uleb128 0
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU679
+	.uleb128 .LVU685
+	.uleb128 .LVU688
+	.uleb128 .LVU699
+	.uleb128 .LVU699
+	.uleb128 0
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LFE51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU688
+	.uleb128 .LVU697
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU688
+	.uleb128 .LVU697
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS77:
+	.uleb128 0
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 .LVU669
+	.uleb128 .LVU669
+	.uleb128 0
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 0
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 0
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU616
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 .LVU666
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU625
+	.uleb128 .LVU634
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS57:
+	.uleb128 0
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 .LVU542
+	.uleb128 .LVU542
+	.uleb128 .LVU553
+	.uleb128 .LVU553
+	.uleb128 0
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL154-1-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 0
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL154-1-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU533
+	.uleb128 .LVU539
+	.uleb128 .LVU542
+	.uleb128 .LVU554
+	.uleb128 .LVU554
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU533
+	.uleb128 .LVU539
+	.uleb128 .LVU542
+	.uleb128 .LVU553
+	.uleb128 .LVU553
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU542
+	.uleb128 .LVU551
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU542
+	.uleb128 .LVU551
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU520
+	.uleb128 .LVU520
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU479
+	.uleb128 .LVU479
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 .LVU501
+	.uleb128 .LVU501
+	.uleb128 .LVU523
+	.uleb128 .LVU523
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 0
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL139-1-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU444
+	.uleb128 .LVU444
+	.uleb128 .LVU456
+	.uleb128 .LVU456
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 .LVU468
+	.uleb128 .LVU468
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU444
+	.uleb128 .LVU444
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU444
+	.uleb128 .LVU444
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU448
+	.uleb128 .LVU454
+	.uleb128 .LVU457
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU448
+	.uleb128 .LVU454
+	.uleb128 .LVU457
+	.uleb128 .LVU468
+	.uleb128 .LVU468
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU457
+	.uleb128 .LVU466
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU457
+	.uleb128 .LVU466
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU371
+	.uleb128 .LVU371
+	.uleb128 .LVU376
+	.uleb128 .LVU376
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU360
+	.uleb128 .LVU360
+	.uleb128 .LVU364
+	.uleb128 .LVU364
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU303
+	.uleb128 .LVU340
+	.uleb128 .LVU341
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU363
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU304
+	.uleb128 .LVU307
+	.uleb128 .LVU341
+	.uleb128 .LVU356
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU341
+	.uleb128 .LVU343
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU341
+	.uleb128 .LVU343
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU348
+	.uleb128 .LVU350
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU348
+	.uleb128 .LVU350
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU249
+	.uleb128 .LVU249
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU272
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL76-1-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU240
+	.uleb128 .LVU245
+	.uleb128 .LVU251
+	.uleb128 .LVU252
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x12
+	.byte	0x75
+	.sleb128 56
+	.byte	0x94
+	.byte	0x4
+	.byte	0x9
+	.byte	0xfd
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 0x12
+	.byte	0x73
+	.sleb128 56
+	.byte	0x94
+	.byte	0x4
+	.byte	0x9
+	.byte	0xfd
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU259
+	.uleb128 .LVU275
+	.uleb128 .LVU275
+	.uleb128 .LVU276
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU261
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU276
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x18
+	.byte	0
+.LVUS143:
+	.uleb128 0
+	.uleb128 .LVU1164
+	.uleb128 .LVU1164
+	.uleb128 .LVU1175
+	.uleb128 .LVU1175
+	.uleb128 .LVU1176
+	.uleb128 .LVU1176
+	.uleb128 .LVU1180
+	.uleb128 .LVU1180
+	.uleb128 .LVU1182
+	.uleb128 .LVU1182
+	.uleb128 .LVU1182
+	.uleb128 .LVU1182
+	.uleb128 0
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL333-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL333-1-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL340-1-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU1169
+	.uleb128 .LVU1174
+	.uleb128 .LVU1182
+	.uleb128 .LVU1185
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU204
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU165
+	.uleb128 .LVU176
+	.uleb128 .LVU192
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU123
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU130
+	.uleb128 .LVU134
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU29
+	.uleb128 .LVU46
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x158
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU33
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU46
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU67
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU88
+	.uleb128 .LVU114
+	.uleb128 .LVU116
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU81
+	.uleb128 .LVU88
+	.uleb128 .LVU114
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU90
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU114
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 24
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU94
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU114
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU149
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU383
+	.uleb128 .LVU383
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 0
+	.uleb128 .LVU383
+	.uleb128 .LVU383
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU383
+	.uleb128 .LVU383
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU389
+	.uleb128 .LVU390
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU388
+	.uleb128 .LVU431
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU388
+	.uleb128 .LVU431
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU388
+	.uleb128 .LVU431
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU390
+	.uleb128 .LVU431
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU390
+	.uleb128 .LVU395
+	.uleb128 .LVU398
+	.uleb128 .LVU431
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS64:
+	.uleb128 0
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 0
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 0
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU613
+	.uleb128 .LVU613
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU558
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU591
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU558
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU591
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU560
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU591
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU565
+	.uleb128 .LVU569
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 0
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU567
+	.uleb128 .LVU569
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU567
+	.uleb128 .LVU569
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 0
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU591
+	.uleb128 .LVU609
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU594
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU609
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS124:
+	.uleb128 0
+	.uleb128 .LVU980
+	.uleb128 .LVU980
+	.uleb128 .LVU982
+	.uleb128 .LVU982
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU1053
+	.uleb128 .LVU1053
+	.uleb128 .LVU1056
+	.uleb128 .LVU1056
+	.uleb128 0
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS125:
+	.uleb128 0
+	.uleb128 .LVU980
+	.uleb128 .LVU980
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU996
+	.uleb128 .LVU996
+	.uleb128 .LVU1048
+	.uleb128 .LVU1048
+	.uleb128 .LVU1056
+	.uleb128 .LVU1056
+	.uleb128 0
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU983
+	.uleb128 .LVU996
+	.uleb128 .LVU996
+	.uleb128 .LVU1047
+	.uleb128 .LVU1048
+	.uleb128 .LVU1053
+	.uleb128 .LVU1056
+	.uleb128 0
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU983
+	.uleb128 .LVU1047
+	.uleb128 .LVU1048
+	.uleb128 .LVU1053
+	.uleb128 .LVU1056
+	.uleb128 0
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU994
+	.uleb128 .LVU1002
+	.uleb128 .LVU1051
+	.uleb128 .LVU1053
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU1000
+	.uleb128 .LVU1046
+	.uleb128 .LVU1056
+	.uleb128 0
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU1011
+	.uleb128 .LVU1046
+	.uleb128 .LVU1056
+	.uleb128 0
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU1011
+	.uleb128 .LVU1046
+	.uleb128 .LVU1056
+	.uleb128 0
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU1058
+	.uleb128 .LVU1060
+	.uleb128 .LVU1060
+	.uleb128 0
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL312-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL312-1-.Ltext0
+	.uleb128 .LFE58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU1022
+	.uleb128 .LVU1024
+	.uleb128 .LVU1024
+	.uleb128 .LVU1046
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL302-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS153:
+	.uleb128 0
+	.uleb128 .LVU1276
+	.uleb128 .LVU1276
+	.uleb128 .LVU1292
+	.uleb128 .LVU1292
+	.uleb128 0
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL367-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL367-1-.Ltext0
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS154:
+	.uleb128 0
+	.uleb128 .LVU1273
+	.uleb128 .LVU1273
+	.uleb128 .LVU1293
+	.uleb128 .LVU1293
+	.uleb128 0
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS155:
+	.uleb128 0
+	.uleb128 .LVU1276
+	.uleb128 .LVU1276
+	.uleb128 .LVU1286
+	.uleb128 .LVU1286
+	.uleb128 0
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL365-.Ltext0
+	.uleb128 .LVL367-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL367-1-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LFE62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU1277
+	.uleb128 .LVU1286
+	.uleb128 .LVU1286
+	.uleb128 .LVU1290
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU1277
+	.uleb128 .LVU1290
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU1277
+	.uleb128 .LVU1290
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0
+.LLRL59:
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0
+.LLRL66:
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0
+.LLRL74:
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0
+.LLRL101:
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0
+.LLRL107:
+	.byte	0x4
+	.uleb128 .LBB129-.Ltext0
+	.uleb128 .LBE129-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB134-.Ltext0
+	.uleb128 .LBE134-.Ltext0
+	.byte	0
+.LLRL119:
+	.byte	0x4
+	.uleb128 .LBB139-.Ltext0
+	.uleb128 .LBE139-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0
+.LLRL126:
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0
+.LLRL131:
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0
+.LLRL138:
+	.byte	0x4
+	.uleb128 .LBB162-.Ltext0
+	.uleb128 .LBE162-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0
+.LLRL147:
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB179-.Ltext0
+	.uleb128 .LBE179-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0
+.LLRL151:
+	.byte	0x4
+	.uleb128 .LBB174-.Ltext0
+	.uleb128 .LBE174-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB175-.Ltext0
+	.uleb128 .LBE175-.Ltext0
+	.byte	0
+.LLRL166:
+	.byte	0x4
+	.uleb128 .LBB186-.Ltext0
+	.uleb128 .LBE186-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB187-.Ltext0
+	.uleb128 .LBE187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB189-.Ltext0
+	.uleb128 .LBE189-.Ltext0
+	.byte	0
+.LLRL177:
+	.byte	0x4
+	.uleb128 .LBB190-.Ltext0
+	.uleb128 .LBE190-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB191-.Ltext0
+	.uleb128 .LBE191-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB192-.Ltext0
+	.uleb128 .LBE192-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF126:
+	.string	"st_append_many"
+.LASF44:
+	.string	"conversion_ns"
+.LASF116:
+	.string	"st_append_int"
+.LASF95:
+	.string	"st_arena_string"
+.LASF151:
+	.string	"st_extract_numbers"
+.LASF106:
+	.string	"strlen"
+.LASF85:
+	.string	"i64tos_to"
+.LASF49:
+	.string	"capacity"
+.LASF31:
+	.string	"StringArena"
+.LASF172:
+	.string	"builder"
+.LASF110:
+	.string	"buffer"
+.LASF140:
+	.string	"needle"
+.LASF7:
+	.string	"unsigned int"
+.LASF52:
+	.string	"StringCharClassBits"
+.LASF65:
+	.string	"incremental_factor"
+.LASF123:
+	.string	"st_append_quoted_string"
+.LASF32:
+	.string	"head"
+.LASF53:
+	.string	"StringGrowthPolicy"
+.LASF167:
+	.string	"st_allocate"
+.LASF55:
+	.string	"ST_GROWTH_LINEAR"
+.LASF61:
+	.string	"StringTokenizer"
+.LASF102:
+	.string	"st_drop_structural_index"
+.LASF160:
+	.string	"start_delim"
+.LASF58:
+	.string	"ST_STRING_OWNED"
+.LASF51:
+	.string	"error"
+.LASF21:
+	.string	"ST_CLASS_WHITESPACE"
+.LASF100:
+	.string	"sv_to_string"
+.LASF187:
+	.string	"__builtin_memcpy"
+.LASF94:
+	.string	"st_scan_class"
+.LASF119:
+	.string	"hex_digits"
+.LASF185:
+	.string	"st_char_is"
+.LASF48:
+	.string	"chunk_size"
+.LASF148:
+	.string	"decimal"
+.LASF127:
+	.string	"st_append_char"
+.LASF170:
+	.string	"st_pool_clear"
+.LASF22:
+	.string	"ST_CLASS_DIGIT"
+.LASF131:
+	.string	"policy"
+.LASF92:
+	.string	"stod"
+.LASF105:
+	.string	"malloc"
+.LASF76:
+	.string	"count"
+.LASF120:
+	.string	"index"
+.LASF104:
+	.string	"st_stats_add"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF146:
+	.string	"consumed"
+.LASF169:
+	.string	"st_attach_arena"
+.LASF97:
+	.string	"st_ensure"
+.LASF98:
+	.string	"st_scan_non_whitespace"
+.LASF163:
+	.string	"st_current_token"
+.LASF152:
+	.string	"st_extract_until_view"
+.LASF59:
+	.string	"ST_STRING_MAPPED"
+.LASF70:
+	.string	"arena"
+.LASF108:
+	.string	"value"
+.LASF130:
+	.string	"st_reserve"
+.LASF34:
+	.string	"used"
+.LASF184:
+	.string	"is_numeric"
+.LASF132:
+	.string	"st_expand_string"
+.LASF155:
+	.string	"st_resize_string"
+.LASF9:
+	.string	"size_t"
+.LASF17:
+	.string	"int64_t"
+.LASF50:
+	.string	"offset"
+.LASF39:
+	.string	"allocations"
+.LASF81:
+	.string	"string_tokenizer_pool_count"
+.LASF173:
+	.string	"st_pool_acquire"
+.LASF149:
+	.string	"st_extract_double_to"
+.LASF128:
+	.string	"st_append_n"
+.LASF67:
+	.string	"max_increment"
+.LASF190:
+	.string	"StringArenaBlock"
+.LASF13:
+	.string	"__uint64_t"
+.LASF177:
+	.string	"st_reset"
+.LASF162:
+	.string	"st_sub_string_view"
+.LASF144:
+	.string	"st_extract_int64"
+.LASF86:
+	.string	"st_scan_escape"
+.LASF90:
+	.string	"st_arena_alloc"
+.LASF15:
+	.string	"char"
+.LASF62:
+	.string	"string"
+.LASF142:
+	.string	"st_extract_double"
+.LASF176:
+	.string	"st_rebind"
+.LASF161:
+	.string	"end_delim"
+.LASF16:
+	.string	"ssize_t"
+.LASF19:
+	.string	"uint8_t"
+.LASF27:
+	.string	"ST_CLASS_ALPHA"
+.LASF54:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF125:
+	.string	"st_append_string"
+.LASF164:
+	.string	"st_set_growth_policy"
+.LASF74:
+	.string	"StringStructuralIndex"
+.LASF191:
+	.string	"st_release_string"
+.LASF84:
+	.string	"dtos_to"
+.LASF25:
+	.string	"ST_CLASS_STRUCTURAL"
+.LASF4:
+	.string	"long long int"
+.LASF96:
+	.string	"st_scan_delimiter"
+.LASF171:
+	.string	"st_pool_release"
+.LASF47:
+	.string	"context"
+.LASF183:
+	.string	"st_structural_in_string"
+.LASF43:
+	.string	"conversions"
+.LASF103:
+	.string	"free"
+.LASF93:
+	.string	"st_stats_clock"
+.LASF78:
+	.string	"hint"
+.LASF133:
+	.string	"size"
+.LASF129:
+	.string	"st_shrink_to_fit"
+.LASF111:
+	.string	"st_char_classes"
+.LASF40:
+	.string	"reallocations"
+.LASF80:
+	.string	"string_tokenizer_pool"
+.LASF69:
+	.string	"ownership"
+.LASF178:
+	.string	"st_destroy"
+.LASF57:
+	.string	"ST_STRING_BORROWED"
+.LASF12:
+	.string	"__int64_t"
+.LASF35:
+	.string	"long double"
+.LASF122:
+	.string	"token"
+.LASF156:
+	.string	"st_numbers_view"
+.LASF36:
+	.string	"StringStats"
+.LASF109:
+	.string	"precision"
+.LASF75:
+	.string	"positions"
+.LASF117:
+	.string	"st_append_escaped_string"
+.LASF30:
+	.string	"members"
+.LASF135:
+	.string	"new_length"
+.LASF29:
+	.string	"StringCharClass"
+.LASF37:
+	.string	"bytes_scanned"
+.LASF11:
+	.string	"short int"
+.LASF159:
+	.string	"st_sub_string"
+.LASF157:
+	.string	"st_slice_string"
+.LASF3:
+	.string	"long int"
+.LASF145:
+	.string	"available"
+.LASF63:
+	.string	"length"
+.LASF136:
+	.string	"st_extract_boolean"
+.LASF153:
+	.string	"delimiters"
+.LASF147:
+	.string	"next"
+.LASF38:
+	.string	"tokens_extracted"
+.LASF114:
+	.string	"st_append_double_precision"
+.LASF138:
+	.string	"int_value"
+.LASF166:
+	.string	"st_copy_view"
+.LASF89:
+	.string	"memcmp"
+.LASF20:
+	.string	"uint64_t"
+.LASF24:
+	.string	"ST_CLASS_HEX"
+.LASF99:
+	.string	"st_structural_next"
+.LASF33:
+	.string	"block_size"
+.LASF79:
+	.string	"double"
+.LASF14:
+	.string	"__ssize_t"
+.LASF10:
+	.string	"__uint8_t"
+.LASF143:
+	.string	"number"
+.LASF56:
+	.string	"StringOwnership"
+.LASF46:
+	.string	"read"
+.LASF112:
+	.string	"start"
+.LASF179:
+	.string	"st_create_empty"
+.LASF182:
+	.string	"st_create"
+.LASF175:
+	.string	"st_detach_string"
+.LASF137:
+	.string	"bool_value"
+.LASF150:
+	.string	"converted"
+.LASF2:
+	.string	"long unsigned int"
+.LASF189:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF83:
+	.string	"dtos_precision_to"
+.LASF107:
+	.string	"tokenizer"
+.LASF72:
+	.string	"structural_index"
+.LASF60:
+	.string	"ST_STRING_INLINE"
+.LASF124:
+	.string	"fragments"
+.LASF118:
+	.string	"st_append_escaped_n"
+.LASF158:
+	.string	"st_slice_string_view"
+.LASF26:
+	.string	"ST_CLASS_ESCAPE"
+.LASF5:
+	.string	"unsigned char"
+.LASF71:
+	.string	"inline_buffer"
+.LASF28:
+	.string	"StringView"
+.LASF45:
+	.string	"StringStream"
+.LASF82:
+	.string	"dtos_fixed_to"
+.LASF41:
+	.string	"expansions"
+.LASF180:
+	.string	"st_create_n"
+.LASF73:
+	.string	"stats"
+.LASF87:
+	.string	"realloc"
+.LASF101:
+	.string	"munmap"
+.LASF121:
+	.string	"destination"
+.LASF8:
+	.string	"signed char"
+.LASF6:
+	.string	"short unsigned int"
+.LASF88:
+	.string	"memcpy"
+.LASF141:
+	.string	"view"
+.LASF113:
+	.string	"st_append_fixed"
+.LASF134:
+	.string	"add_size"
+.LASF188:
+	.string	"__builtin_memcmp"
+.LASF66:
+	.string	"growth_policy"
+.LASF168:
+	.string	"st_attach_stats"
+.LASF154:
+	.string	"st_extract_numbers_view"
+.LASF77:
+	.string	"in_string"
+.LASF23:
+	.string	"ST_CLASS_NUMERIC"
+.LASF174:
+	.string	"string_size"
+.LASF186:
+	.string	"classes"
+.LASF139:
+	.string	"st_starts_with"
+.LASF165:
+	.string	"st_next_token"
+.LASF91:
+	.string	"stoi64"
+.LASF42:
+	.string	"bytes_copied"
+.LASF115:
+	.string	"st_append_double"
+.LASF64:
+	.string	"position"
+.LASF181:
+	.string	"st_init"
+.LASF68:
+	.string	"stream"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/string_tokenizer.c"
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4622 @@
+	.file	"string_view_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/tests/string_view_unit_tests.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"key"
+.LC1:
+	.string	"abc"
+.LC2:
+	.string	"abd"
+.LC3:
+	.string	""
+.LC4:
+	.string	"ab"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC6:
+	.string	"------------------- sv_compare(a, b) -------------------"
+	.align 8
+.LC7:
+	.string	"[Failed] sv_compare(\"%s\", \"%s\") failed: expected %d, got %d.\n"
+	.align 8
+.LC8:
+	.string	"[Failed] sv_equals(\"%s\", \"%s\") failed: disagrees with sv_compare.\n"
+	.align 8
+.LC9:
+	.string	"[Failed] sv_hash(\"%s\") failed: equal views have different hashes.\n"
+	.align 8
+.LC10:
+	.string	"[Passed] sv_compare(\"%s\", \"%s\") is %d.\n"
+	.text
+	.p2align 4
+	.globl	run_sv_compare_unit_tests
+	.type	run_sv_compare_unit_tests, @function
+run_sv_compare_unit_tests:
+.LFB26:
+	.file 1 "/root/repo/tests/string_view_unit_tests.c"
+	.loc 1 9 33 view -0
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	.LC1(%rip), %rax
+	.loc 1 11 15 is_stmt 0 view .LVU1
+	leaq	.LC3(%rip), %rsi
+	.loc 1 9 33 view .LVU2
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	vmovq	%rax, %xmm0
+	.loc 1 11 15 view .LVU3
+	vmovq	%rsi, %xmm1
+	.loc 1 9 33 view .LVU4
+	pushq	%r14
+	leaq	.LC2(%rip), %rax
+	.loc 1 11 3 is_stmt 1 view .LVU5
+	.loc 1 11 15 is_stmt 0 view .LVU6
+	vpinsrq	$1, %rax, %xmm0, %xmm2
+	.loc 1 9 33 view .LVU7
+	pushq	%r13
+	.loc 1 11 15 view .LVU8
+	vpunpcklqdq	%xmm0, %xmm1, %xmm1
+	vinserti128	$0x1, %xmm2, %ymm1, %ymm2
+	.loc 1 9 33 view .LVU9
+	pushq	%r12
+	.loc 1 11 15 view .LVU10
+	leaq	.LC4(%rip), %rsi
+	leaq	.LC0(%rip), %rdx
+	.loc 1 9 33 view .LVU11
+	pushq	%rbx
+	.loc 1 12 15 view .LVU12
+	vmovq	%rax, %xmm3
+	.loc 1 13 7 view .LVU13
+	movl	$4294967295, %eax
+	.loc 1 9 33 view .LVU14
+	andq	$-32, %rsp
+	subq	$256, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 11 15 view .LVU15
+	vmovdqa	%ymm2, 128(%rsp)
+	vmovq	%rsi, %xmm2
+	vpinsrq	$1, %rdx, %xmm2, %xmm2
+	vmovdqa	%xmm2, 160(%rsp)
+	.loc 1 12 3 is_stmt 1 view .LVU16
+	.loc 1 12 15 is_stmt 0 view .LVU17
+	vpunpcklqdq	%xmm0, %xmm3, %xmm2
+	vpinsrq	$1, %rdx, %xmm0, %xmm0
+	.loc 1 13 7 view .LVU18
+	movq	%rax, 112(%rsp)
+	.loc 1 12 15 view .LVU19
+	vmovdqa	%xmm0, 224(%rsp)
+	.loc 1 13 3 is_stmt 1 view .LVU20
+	.loc 1 15 3 view .LVU21
+.LVL0:
+	.loc 1 17 3 view .LVU22
+	.loc 1 13 7 is_stmt 0 view .LVU23
+	vmovdqa	.LC5(%rip), %xmm0
+	.loc 1 12 15 view .LVU24
+	vinserti128	$0x1, %xmm2, %ymm1, %ymm1
+	vmovdqa	%ymm1, 192(%rsp)
+	.loc 1 13 7 view .LVU25
+	vmovdqa	%xmm0, 96(%rsp)
+	.loc 1 17 3 view .LVU26
+	leaq	.LC6(%rip), %rdi
+	vzeroupper
+.LVL1:
+	call	puts@PLT
+.LVL2:
+	.loc 1 19 3 is_stmt 1 view .LVU27
+	.loc 1 20 3 view .LVU28
+.LBB2:
+	.loc 1 20 8 view .LVU29
+	.loc 1 20 21 view .LVU30
+	leaq	80(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	leaq	64(%rsp), %rax
+	movq	%rax, 56(%rsp)
+	leaq	96(%rsp), %rax
+.LBE2:
+	.loc 1 19 7 is_stmt 0 view .LVU31
+	movl	$0, 36(%rsp)
+	movq	%rax, 40(%rsp)
+	.loc 1 17 3 view .LVU32
+	xorl	%ebx, %ebx
+	leaq	128(%rsp), %r15
+	leaq	192(%rsp), %r14
+	jmp	.L7
+.LVL3:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+.LBB7:
+.LBB3:
+	.loc 1 26 7 is_stmt 1 discriminator 1 view .LVU33
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL4:
+	.loc 1 27 7 discriminator 1 view .LVU34
+	.loc 1 28 7 discriminator 1 view .LVU35
+.L3:
+	.loc 1 28 7 is_stmt 0 discriminator 1 view .LVU36
+.LBE3:
+	.loc 1 20 21 view .LVU37
+	incq	%rbx
+.LVL5:
+	.loc 1 20 21 view .LVU38
+.LBE7:
+	.loc 1 19 7 view .LVU39
+	movl	$1, 36(%rsp)
+.LVL6:
+.LBB8:
+	.loc 1 20 35 is_stmt 1 view .LVU40
+	.loc 1 20 21 view .LVU41
+	cmpq	$6, %rbx
+	je	.L11
+.LVL7:
+.L7:
+.LBB4:
+	.loc 1 21 5 view .LVU42
+	.loc 1 21 30 is_stmt 0 view .LVU43
+	movq	(%r15,%rbx,8), %r13
+	movq	%r13, %rdi
+	call	sv_from_string@PLT
+.LVL8:
+	.loc 1 22 31 view .LVU44
+	movq	(%r14,%rbx,8), %r12
+	.loc 1 21 30 view .LVU45
+	movq	%rax, 64(%rsp)
+	.loc 1 22 31 view .LVU46
+	movq	%r12, %rdi
+	.loc 1 21 30 view .LVU47
+	movq	%rdx, 72(%rsp)
+	.loc 1 22 5 is_stmt 1 view .LVU48
+	.loc 1 22 31 is_stmt 0 view .LVU49
+	call	sv_from_string@PLT
+.LVL9:
+	.loc 1 23 18 view .LVU50
+	movq	48(%rsp), %rsi
+	movq	56(%rsp), %rdi
+	.loc 1 22 31 view .LVU51
+	movq	%rax, 80(%rsp)
+	movq	%rdx, 88(%rsp)
+	.loc 1 23 5 is_stmt 1 view .LVU52
+	.loc 1 23 18 is_stmt 0 view .LVU53
+	call	sv_compare@PLT
+.LVL10:
+	.loc 1 24 5 is_stmt 1 view .LVU54
+	.loc 1 24 24 is_stmt 0 view .LVU55
+	xorl	%r8d, %r8d
+	testl	%eax, %eax
+	setg	%r8b
+	.loc 1 24 39 view .LVU56
+	shrl	$31, %eax
+.LVL11:
+	.loc 1 24 9 view .LVU57
+	subl	%eax, %r8d
+.LVL12:
+	.loc 1 25 5 is_stmt 1 view .LVU58
+	.loc 1 25 32 is_stmt 0 view .LVU59
+	movq	40(%rsp), %rax
+	movl	(%rax,%rbx,4), %ecx
+	.loc 1 25 8 view .LVU60
+	cmpl	%r8d, %ecx
+	jne	.L12
+	.loc 1 30 24 view .LVU61
+	movq	56(%rsp), %rdi
+	movq	%r12, %rsi
+	movl	%r8d, 32(%rsp)
+	movl	%ecx, 24(%rsp)
+	.loc 1 30 5 is_stmt 1 view .LVU62
+	.loc 1 30 24 is_stmt 0 view .LVU63
+	call	sv_equals@PLT
+.LVL13:
+	.loc 1 30 15 view .LVU64
+	movl	24(%rsp), %ecx
+	xorl	%edx, %edx
+	testl	%ecx, %ecx
+	sete	%dl
+	.loc 1 30 8 view .LVU65
+	cmpl	%eax, %edx
+	movl	32(%rsp), %r8d
+	jne	.L13
+	.loc 1 35 5 is_stmt 1 view .LVU66
+	.loc 1 35 8 is_stmt 0 view .LVU67
+	testl	%ecx, %ecx
+	jne	.L5
+	.loc 1 35 22 discriminator 1 view .LVU68
+	movq	56(%rsp), %rdi
+	movl	%r8d, 32(%rsp)
+.LVL14:
+	.loc 1 35 22 discriminator 1 view .LVU69
+	call	sv_hash@PLT
+.LVL15:
+	.loc 1 35 40 discriminator 1 view .LVU70
+	movq	48(%rsp), %rdi
+	.loc 1 35 22 discriminator 1 view .LVU71
+	movq	%rax, 24(%rsp)
+	.loc 1 35 40 discriminator 1 view .LVU72
+	call	sv_hash@PLT
+.LVL16:
+	.loc 1 35 19 discriminator 1 view .LVU73
+	cmpq	%rax, 24(%rsp)
+	movl	32(%rsp), %r8d
+	jne	.L14
+.L5:
+	.loc 1 41 5 is_stmt 1 view .LVU74
+	movl	%r8d, %ecx
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	leaq	.LC10(%rip), %rdi
+	xorl	%eax, %eax
+.LBE4:
+	.loc 1 20 21 is_stmt 0 view .LVU75
+	incq	%rbx
+.LVL17:
+.LBB5:
+	.loc 1 41 5 view .LVU76
+	call	printf@PLT
+.LVL18:
+	.loc 1 41 5 view .LVU77
+.LBE5:
+	.loc 1 20 35 is_stmt 1 view .LVU78
+	.loc 1 20 21 view .LVU79
+	cmpq	$6, %rbx
+	jne	.L7
+.LVL19:
+.L11:
+	.loc 1 20 21 is_stmt 0 view .LVU80
+.LBE8:
+	.loc 1 43 3 is_stmt 1 view .LVU81
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL20:
+	.loc 1 45 3 view .LVU82
+	.loc 1 46 1 is_stmt 0 view .LVU83
+	movl	36(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL21:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.cfi_restore_state
+.LBB9:
+.LBB6:
+	.loc 1 31 7 is_stmt 1 discriminator 1 view .LVU84
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL22:
+	.loc 1 32 7 discriminator 1 view .LVU85
+	.loc 1 33 7 discriminator 1 view .LVU86
+	jmp	.L3
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.loc 1 36 7 discriminator 2 view .LVU87
+	movq	%r13, %rsi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL24:
+	.loc 1 37 7 discriminator 2 view .LVU88
+	.loc 1 38 7 discriminator 2 view .LVU89
+	jmp	.L3
+.LBE6:
+.LBE9:
+	.cfi_endproc
+.LFE26:
+	.size	run_sv_compare_unit_tests, .-run_sv_compare_unit_tests
+	.section	.rodata.str1.1
+.LC11:
+	.string	"NULL"
+.LC12:
+	.string	"\"key\": 1"
+.LC13:
+	.string	"\"\""
+.LC14:
+	.string	"\"unterminated"
+.LC15:
+	.string	"[a,b]"
+.LC16:
+	.string	"no-quotes"
+.LC17:
+	.string	"unterminated"
+.LC18:
+	.string	"a,b"
+	.section	.rodata.str1.8
+	.align 8
+.LC19:
+	.string	"------------------- st_sub_string_view(x) -------------------"
+	.align 8
+.LC20:
+	.string	"[Failed] st_sub_string_view(\"%s\") failed: expected '%s'.\n"
+	.align 8
+.LC21:
+	.string	"[Failed] st_sub_string(\"%s\") failed: expected '%s', got '%s'.\n"
+	.align 8
+.LC22:
+	.string	"[Passed] st_sub_string_view(\"%s\") is '%s'.\n"
+	.text
+	.p2align 4
+	.globl	run_st_sub_string_view_unit_tests
+	.type	run_st_sub_string_view_unit_tests, @function
+run_st_sub_string_view_unit_tests:
+.LFB27:
+	.loc 1 51 41 view -0
+	.cfi_startproc
+	.loc 1 53 3 view .LVU91
+	.loc 1 51 41 is_stmt 0 view .LVU92
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 53 15 view .LVU93
+	leaq	.LC14(%rip), %rcx
+	leaq	.LC15(%rip), %rax
+	.loc 1 51 41 view .LVU94
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 53 15 view .LVU95
+	vmovq	%rcx, %xmm1
+	leaq	.LC12(%rip), %rcx
+	.loc 1 51 41 view .LVU96
+	pushq	%r14
+	.loc 1 53 15 view .LVU97
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovq	%rcx, %xmm0
+	.loc 1 51 41 view .LVU98
+	pushq	%r13
+	.loc 1 53 15 view .LVU99
+	leaq	.LC13(%rip), %rax
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 51 41 view .LVU100
+	pushq	%r12
+	.loc 1 53 15 view .LVU101
+	leaq	.LC16(%rip), %rax
+	.loc 1 56 15 view .LVU102
+	leaq	.LC17(%rip), %rcx
+	.loc 1 51 41 view .LVU103
+	pushq	%rbx
+	.loc 1 53 15 view .LVU104
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	.loc 1 56 15 view .LVU105
+	vmovq	%rcx, %xmm1
+	.loc 1 51 41 view .LVU106
+	andq	$-32, %rsp
+	subq	$288, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 53 15 view .LVU107
+	movq	%rax, 128(%rsp)
+	.loc 1 54 3 is_stmt 1 view .LVU108
+	.loc 1 56 15 is_stmt 0 view .LVU109
+	leaq	.LC0(%rip), %rcx
+	leaq	.LC18(%rip), %rax
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	.loc 1 53 15 view .LVU110
+	vmovdqa	%ymm0, 96(%rsp)
+	.loc 1 56 15 view .LVU111
+	leaq	.LC3(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 54 14 view .LVU112
+	movl	$1528963618, 70(%rsp)
+	movb	$34, 74(%rsp)
+	.loc 1 55 3 is_stmt 1 view .LVU113
+	.loc 1 55 14 is_stmt 0 view .LVU114
+	movl	$1562518050, 75(%rsp)
+	movb	$34, 79(%rsp)
+	.loc 1 56 3 is_stmt 1 view .LVU115
+	.loc 1 56 15 is_stmt 0 view .LVU116
+	movq	$0, 192(%rsp)
+	.loc 1 58 3 is_stmt 1 view .LVU117
+.LVL25:
+	.loc 1 60 3 view .LVU118
+	.loc 1 56 15 is_stmt 0 view .LVU119
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	vmovdqa	%ymm0, 160(%rsp)
+	.loc 1 60 3 view .LVU120
+	leaq	.LC19(%rip), %rdi
+	vzeroupper
+.LVL26:
+	call	puts@PLT
+.LVL27:
+	.loc 1 62 3 is_stmt 1 view .LVU121
+	.loc 1 63 3 view .LVU122
+.LBB10:
+	.loc 1 63 8 view .LVU123
+	.loc 1 63 21 view .LVU124
+	leaq	96(%rsp), %rax
+	movq	%rax, 48(%rsp)
+	leaq	75(%rsp), %rax
+	movq	%rax, 24(%rsp)
+	leaq	70(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	leaq	80(%rsp), %rax
+	movq	%rax, 56(%rsp)
+	leaq	224(%rsp), %r15
+	leaq	160(%rsp), %rax
+.LBE10:
+	.loc 1 62 7 is_stmt 0 view .LVU125
+	movl	$0, 12(%rsp)
+	movq	%rax, 40(%rsp)
+.LBB17:
+.LBB11:
+	.loc 1 70 7 view .LVU126
+	movq	%r15, 16(%rsp)
+.LBE11:
+.LBE17:
+	.loc 1 60 3 view .LVU127
+	xorl	%ebx, %ebx
+	jmp	.L27
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L20:
+.LBB18:
+.LBB12:
+	.loc 1 70 7 is_stmt 1 view .LVU128
+	testq	%r8, %r8
+	leaq	.LC11(%rip), %rax
+	cmove	%rax, %r8
+	leaq	.LC20(%rip), %rdi
+	movq	%r8, %rdx
+	movq	%r13, %rsi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL29:
+	.loc 1 71 7 view .LVU129
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL30:
+	.loc 1 72 7 view .LVU130
+	.loc 1 73 7 view .LVU131
+.L22:
+	.loc 1 73 7 is_stmt 0 view .LVU132
+.LBE12:
+	.loc 1 63 21 view .LVU133
+	incq	%rbx
+.LVL31:
+.LBB13:
+	.loc 1 86 5 view .LVU134
+	movl	$1, 12(%rsp)
+.LVL32:
+	.loc 1 86 5 view .LVU135
+.LBE13:
+	.loc 1 63 35 is_stmt 1 view .LVU136
+	.loc 1 63 21 view .LVU137
+	cmpq	$5, %rbx
+	je	.L38
+.LVL33:
+.L27:
+.LBB14:
+	.loc 1 64 5 view .LVU138
+	.loc 1 65 5 view .LVU139
+	movq	48(%rsp), %rax
+	movq	16(%rsp), %r15
+	movq	(%rax,%rbx,8), %r13
+	movq	%r15, %rdi
+	movq	%r13, %rsi
+	call	strcpy@PLT
+.LVL34:
+	.loc 1 66 5 view .LVU140
+	.loc 1 66 41 is_stmt 0 view .LVU141
+	movq	%r15, %rdi
+	call	st_create@PLT
+.LVL35:
+	movq	%rax, %r12
+.LVL36:
+	.loc 1 67 5 is_stmt 1 view .LVU142
+	.loc 1 68 5 view .LVU143
+	.loc 1 68 17 is_stmt 0 view .LVU144
+	movq	24(%rsp), %rax
+.LVL37:
+	.loc 1 68 17 view .LVU145
+	movq	56(%rsp), %rcx
+	movsbl	(%rax,%rbx), %r15d
+	movq	32(%rsp), %rax
+	movl	%r15d, %edx
+	movsbl	(%rax,%rbx), %r14d
+	movq	%r12, %rdi
+	movl	%r14d, %esi
+	call	st_sub_string_view@PLT
+.LVL38:
+	movl	%eax, %edx
+.LVL39:
+	.loc 1 69 5 is_stmt 1 view .LVU146
+	.loc 1 69 34 is_stmt 0 view .LVU147
+	movq	40(%rsp), %rax
+.LVL40:
+	.loc 1 69 34 view .LVU148
+	movq	(%rax,%rbx,8), %r8
+	.loc 1 69 38 view .LVU149
+	xorl	%eax, %eax
+	testq	%r8, %r8
+	setne	%al
+	.loc 1 69 8 view .LVU150
+	cmpl	%edx, %eax
+	jne	.L20
+	.loc 1 69 46 discriminator 1 view .LVU151
+	cmpl	$1, %eax
+	je	.L39
+	.loc 1 76 25 view .LVU152
+	movq	$0, 16(%r12)
+	.loc 1 77 18 view .LVU153
+	movl	%r14d, %esi
+	movl	%r15d, %edx
+.LVL41:
+	.loc 1 77 18 view .LVU154
+	movq	%r12, %rdi
+	movq	%r8, (%rsp)
+	.loc 1 76 5 is_stmt 1 view .LVU155
+	.loc 1 77 5 view .LVU156
+	.loc 1 77 18 is_stmt 0 view .LVU157
+	call	st_sub_string@PLT
+.LVL42:
+	.loc 1 86 5 view .LVU158
+	movq	(%rsp), %r8
+	.loc 1 77 18 view .LVU159
+	movq	%rax, %r14
+.LVL43:
+	.loc 1 78 5 is_stmt 1 view .LVU160
+	.loc 1 86 5 view .LVU161
+	testq	%r8, %r8
+	leaq	.LC11(%rip), %rax
+.LVL44:
+	.loc 1 86 5 is_stmt 0 view .LVU162
+	cmove	%rax, %r8
+.L24:
+	.loc 1 86 5 discriminator 4 view .LVU163
+	movq	%r8, %rdx
+	movq	%r13, %rsi
+	leaq	.LC22(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL45:
+	.loc 1 87 5 is_stmt 1 discriminator 4 view .LVU164
+	movq	%r14, %rdi
+	call	free@PLT
+.LVL46:
+	.loc 1 88 5 discriminator 4 view .LVU165
+.LBE14:
+	.loc 1 63 21 is_stmt 0 discriminator 4 view .LVU166
+	incq	%rbx
+.LVL47:
+.LBB15:
+	.loc 1 88 5 discriminator 4 view .LVU167
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL48:
+	.loc 1 88 5 discriminator 4 view .LVU168
+.LBE15:
+	.loc 1 63 35 is_stmt 1 discriminator 4 view .LVU169
+	.loc 1 63 21 discriminator 4 view .LVU170
+	cmpq	$5, %rbx
+	jne	.L27
+.LVL49:
+.L38:
+	.loc 1 63 21 is_stmt 0 discriminator 4 view .LVU171
+.LBE18:
+	.loc 1 90 3 is_stmt 1 view .LVU172
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL50:
+	.loc 1 92 3 view .LVU173
+	.loc 1 93 1 is_stmt 0 view .LVU174
+	movl	12(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+.LVL51:
+	.loc 1 93 1 view .LVU175
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	.cfi_restore_state
+.LBB19:
+.LBB16:
+	.loc 1 69 64 discriminator 2 view .LVU176
+	movq	56(%rsp), %rdi
+	movq	%r8, %rsi
+	movq	%r8, (%rsp)
+	call	sv_equals@PLT
+.LVL53:
+	.loc 1 69 61 discriminator 2 view .LVU177
+	testl	%eax, %eax
+	movq	(%rsp), %r8
+	je	.L20
+	.loc 1 76 25 view .LVU178
+	movq	$0, 16(%r12)
+	.loc 1 77 18 view .LVU179
+	movl	%r14d, %esi
+	movl	%r15d, %edx
+	movq	%r12, %rdi
+	movq	%r8, (%rsp)
+	.loc 1 76 5 is_stmt 1 view .LVU180
+	.loc 1 77 5 view .LVU181
+	.loc 1 77 18 is_stmt 0 view .LVU182
+	call	st_sub_string@PLT
+.LVL54:
+	.loc 1 78 20 view .LVU183
+	testq	%rax, %rax
+	movq	(%rsp), %r8
+	.loc 1 77 18 view .LVU184
+	movq	%rax, %r14
+.LVL55:
+	.loc 1 78 5 is_stmt 1 view .LVU185
+	.loc 1 78 20 is_stmt 0 view .LVU186
+	je	.L28
+	.loc 1 78 39 discriminator 2 view .LVU187
+	movq	%r8, %rsi
+	movq	%rax, %rdi
+	call	strcmp@PLT
+.LVL56:
+	.loc 1 78 36 discriminator 2 view .LVU188
+	testl	%eax, %eax
+	movq	(%rsp), %r8
+	movq	%r14, %rcx
+	je	.L24
+.L25:
+	.loc 1 79 7 discriminator 4 view .LVU189
+	movq	%r8, %rdx
+	movq	%r13, %rsi
+	leaq	.LC21(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL57:
+	.loc 1 80 7 is_stmt 1 discriminator 4 view .LVU190
+	movq	%r14, %rdi
+	call	free@PLT
+.LVL58:
+	.loc 1 81 7 discriminator 4 view .LVU191
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL59:
+	.loc 1 82 7 discriminator 4 view .LVU192
+	.loc 1 83 7 discriminator 4 view .LVU193
+	jmp	.L22
+.LVL60:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.loc 1 79 7 is_stmt 0 view .LVU194
+	leaq	.LC11(%rip), %rcx
+	jmp	.L25
+.LBE16:
+.LBE19:
+	.cfi_endproc
+.LFE27:
+	.size	run_st_sub_string_view_unit_tests, .-run_st_sub_string_view_unit_tests
+	.section	.rodata.str1.1
+.LC23:
+	.string	"9223372036854775808"
+.LC24:
+	.string	"-42"
+.LC25:
+	.string	" 42"
+.LC26:
+	.string	"42 "
+.LC27:
+	.string	"4.2"
+.LC28:
+	.string	"123,"
+.LC29:
+	.string	"-4.5e3}"
+.LC30:
+	.string	"0"
+.LC31:
+	.string	"123"
+.LC32:
+	.string	"-4.5e3"
+	.section	.rodata.str1.8
+	.align 8
+.LC34:
+	.string	"------------------- st_extract_numbers_view(x) -------------------"
+	.align 8
+.LC35:
+	.string	"[Failed] st_extract_numbers_view(\"%s\") failed: expected '%s'.\n"
+	.align 8
+.LC37:
+	.string	"[Failed] sv_to_double(\"%s\") failed: expected %f, got %f.\n"
+	.align 8
+.LC38:
+	.string	"[Failed] st_extract_numbers_view(\"%s\") failed: cursor at %zu.\n"
+	.align 8
+.LC39:
+	.string	"[Passed] st_extract_numbers_view(\"%s\") is '%s'.\n"
+	.align 8
+.LC40:
+	.string	"[Failed] sv_to_int64() failed to reject the partial integers."
+	.align 8
+.LC41:
+	.string	"[Passed] sv_to_int64() converts only whole integers."
+	.text
+	.p2align 4
+	.globl	run_st_extract_numbers_view_unit_tests
+	.type	run_st_extract_numbers_view_unit_tests, @function
+run_st_extract_numbers_view_unit_tests:
+.LFB28:
+	.loc 1 98 46 is_stmt 1 view -0
+	.cfi_startproc
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-32, %rsp
+	pushq	-8(%r10)
+	leaq	.LC26(%rip), %rcx
+	leaq	.LC27(%rip), %rax
+	pushq	%rbp
+	vmovq	%rcx, %xmm0
+	leaq	.LC24(%rip), %rcx
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 100 15 is_stmt 0 view .LVU196
+	leaq	.LC30(%rip), %rdx
+	.loc 1 98 46 view .LVU197
+	pushq	%r14
+	leaq	.LC25(%rip), %rax
+	vmovq	%rcx, %xmm1
+	pushq	%r13
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	.loc 1 100 15 view .LVU198
+	vmovq	%rdx, %xmm3
+	.loc 1 98 46 view .LVU199
+	pushq	%r12
+	.loc 1 100 15 view .LVU200
+	leaq	.LC1(%rip), %rax
+	leaq	.LC28(%rip), %rcx
+	.loc 1 98 46 view .LVU201
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	vinserti128	$0x1, %xmm0, %ymm1, %ymm2
+	.loc 1 100 15 view .LVU202
+	vpinsrq	$1, %rax, %xmm3, %xmm1
+	.loc 1 98 46 view .LVU203
+	pushq	%rbx
+	.loc 1 100 15 view .LVU204
+	leaq	.LC29(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	.loc 1 101 15 view .LVU205
+	leaq	.LC31(%rip), %rcx
+	.loc 1 98 46 view .LVU206
+	subq	$288, %rsp
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	.loc 1 101 15 view .LVU207
+	leaq	.LC32(%rip), %rax
+	.loc 1 100 15 view .LVU208
+	vmovdqa	%ymm0, -208(%rbp)
+	.loc 1 101 15 view .LVU209
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	movq	%rdx, -128(%rbp)
+	vmovdqa	%xmm0, -144(%rbp)
+	movq	$0, -120(%rbp)
+	.loc 1 102 10 view .LVU210
+	vmovapd	.LC33(%rip), %ymm0
+	vmovdqa	%ymm2, -304(%rbp)
+	.loc 1 100 3 is_stmt 1 view .LVU211
+	.loc 1 101 3 view .LVU212
+	.loc 1 102 3 view .LVU213
+	.loc 1 102 10 is_stmt 0 view .LVU214
+	vmovapd	%ymm0, -176(%rbp)
+	.loc 1 104 3 is_stmt 1 view .LVU215
+.LVL61:
+	.loc 1 106 3 view .LVU216
+	leaq	.LC34(%rip), %rdi
+	vzeroupper
+.LVL62:
+	call	puts@PLT
+.LVL63:
+	.loc 1 108 3 view .LVU217
+	.loc 1 109 3 view .LVU218
+.LBB20:
+	.loc 1 109 8 view .LVU219
+	.loc 1 109 21 view .LVU220
+	leaq	-208(%rbp), %rax
+	movq	%rax, -264(%rbp)
+	leaq	-144(%rbp), %rax
+	movq	%rax, -256(%rbp)
+	leaq	-232(%rbp), %rax
+.LBE20:
+	.loc 1 108 7 is_stmt 0 view .LVU221
+	movl	$0, -268(%rbp)
+	movq	%rax, -248(%rbp)
+	.loc 1 106 3 view .LVU222
+	xorl	%ebx, %ebx
+	leaq	-112(%rbp), %r13
+	leaq	-224(%rbp), %r15
+.LVL64:
+.L54:
+.LBB24:
+.LBB21:
+	.loc 1 110 5 is_stmt 1 view .LVU223
+	.loc 1 111 5 view .LVU224
+	movq	-264(%rbp), %rax
+	movq	%r13, %rdi
+	movq	(%rax,%rbx), %r14
+	movq	%r14, %rsi
+	call	strcpy@PLT
+.LVL65:
+	.loc 1 112 5 view .LVU225
+	.loc 1 112 41 is_stmt 0 view .LVU226
+	movq	%r13, %rdi
+	call	st_create@PLT
+.LVL66:
+	.loc 1 114 17 view .LVU227
+	movq	%rax, %rdi
+	movq	%r15, %rsi
+	.loc 1 112 41 view .LVU228
+	movq	%rax, %r12
+.LVL67:
+	.loc 1 113 5 is_stmt 1 view .LVU229
+	.loc 1 114 5 view .LVU230
+	.loc 1 114 17 is_stmt 0 view .LVU231
+	call	st_extract_numbers_view@PLT
+.LVL68:
+	.loc 1 114 17 view .LVU232
+	movl	%eax, %ecx
+.LVL69:
+	.loc 1 115 5 is_stmt 1 view .LVU233
+	.loc 1 115 34 is_stmt 0 view .LVU234
+	movq	-256(%rbp), %rax
+.LVL70:
+	.loc 1 115 34 view .LVU235
+	movq	(%rax,%rbx), %rdx
+	.loc 1 115 38 view .LVU236
+	xorl	%eax, %eax
+	testq	%rdx, %rdx
+	setne	%al
+	.loc 1 115 8 view .LVU237
+	cmpl	%ecx, %eax
+	je	.L41
+.LVL71:
+.L44:
+	.loc 1 116 7 is_stmt 1 view .LVU238
+	testq	%rdx, %rdx
+	leaq	.LC11(%rip), %rax
+	cmove	%rax, %rdx
+	leaq	.LC35(%rip), %rdi
+	movq	%r14, %rsi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL72:
+	.loc 1 117 7 view .LVU239
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL73:
+	.loc 1 118 7 view .LVU240
+	.loc 1 119 7 view .LVU241
+.L46:
+	.loc 1 136 5 is_stmt 0 view .LVU242
+	movl	$1, -268(%rbp)
+.LVL74:
+.L53:
+	.loc 1 136 5 view .LVU243
+.LBE21:
+	.loc 1 109 35 is_stmt 1 discriminator 2 view .LVU244
+	.loc 1 109 21 discriminator 2 view .LVU245
+	addq	$8, %rbx
+.LVL75:
+	.loc 1 109 21 is_stmt 0 discriminator 2 view .LVU246
+	cmpq	$32, %rbx
+	jne	.L54
+.LBE24:
+	.loc 1 140 3 is_stmt 1 view .LVU247
+	.loc 1 140 15 is_stmt 0 view .LVU248
+	leaq	.LC3(%rip), %rcx
+	vmovdqa	-304(%rbp), %ymm4
+	leaq	.LC23(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vmovdqa	%ymm4, -112(%rbp)
+	vmovdqa	%xmm0, -80(%rbp)
+	.loc 1 141 3 is_stmt 1 view .LVU249
+.LVL76:
+	.loc 1 142 3 view .LVU250
+.LBB25:
+	.loc 1 142 8 view .LVU251
+	.loc 1 142 21 view .LVU252
+.LBE25:
+	.loc 1 140 15 is_stmt 0 view .LVU253
+	xorl	%r12d, %r12d
+.LVL77:
+	.loc 1 141 7 view .LVU254
+	movl	$1, %ebx
+.LVL78:
+	.loc 1 141 7 view .LVU255
+	vzeroupper
+.LVL79:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+.LBB28:
+.LBB26:
+	.loc 1 143 5 is_stmt 1 view .LVU256
+	.loc 1 143 45 is_stmt 0 view .LVU257
+	movq	0(%r13,%r12,8), %rdi
+	.loc 1 143 23 view .LVU258
+	movq	%rdi, -224(%rbp)
+	.loc 1 143 50 view .LVU259
+	call	strlen@PLT
+.LVL80:
+	.loc 1 143 23 view .LVU260
+	movq	%rax, -216(%rbp)
+	.loc 1 144 5 is_stmt 1 view .LVU261
+	.loc 1 144 13 is_stmt 0 view .LVU262
+	movq	$0, -232(%rbp)
+	.loc 1 145 5 is_stmt 1 view .LVU263
+	.loc 1 145 18 is_stmt 0 view .LVU264
+	movq	-248(%rbp), %rsi
+	movq	%r15, %rdi
+	call	sv_to_int64@PLT
+.LVL81:
+	movl	%eax, %edx
+	.loc 1 145 51 view .LVU265
+	xorl	%eax, %eax
+	testl	%r12d, %r12d
+	sete	%al
+	.loc 1 145 57 view .LVU266
+	cmpl	%eax, %edx
+	je	.L70
+	xorl	%ebx, %ebx
+.LVL82:
+.L55:
+	.loc 1 145 57 view .LVU267
+.LBE26:
+	.loc 1 142 27 is_stmt 1 discriminator 8 view .LVU268
+	.loc 1 142 21 discriminator 8 view .LVU269
+	incq	%r12
+.LVL83:
+	.loc 1 142 21 is_stmt 0 discriminator 8 view .LVU270
+	cmpq	$6, %r12
+	jne	.L58
+.LBE28:
+	.loc 1 147 3 is_stmt 1 view .LVU271
+	.loc 1 147 6 is_stmt 0 view .LVU272
+	testl	%ebx, %ebx
+	jne	.L59
+	.loc 1 148 5 is_stmt 1 view .LVU273
+	leaq	.LC40(%rip), %rdi
+	call	puts@PLT
+.LVL84:
+	.loc 1 149 5 view .LVU274
+	.loc 1 149 17 is_stmt 0 view .LVU275
+	movl	$1, -268(%rbp)
+.LVL85:
+.L60:
+	.loc 1 154 3 is_stmt 1 view .LVU276
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL86:
+	.loc 1 156 3 view .LVU277
+	.loc 1 157 1 is_stmt 0 view .LVU278
+	movl	-268(%rbp), %eax
+	addq	$288, %rsp
+	popq	%rbx
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+.LVL87:
+	.loc 1 157 1 view .LVU279
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+	ret
+.LVL88:
+	.p2align 4,,10
+	.p2align 3
+.L41:
+	.cfi_restore_state
+.LBB29:
+.LBB22:
+	.loc 1 115 46 discriminator 1 view .LVU280
+	cmpl	$1, %eax
+	je	.L71
+	.loc 1 121 5 is_stmt 1 view .LVU281
+	.loc 1 121 12 is_stmt 0 view .LVU282
+	movq	$0x000000000, -232(%rbp)
+	.loc 1 122 5 is_stmt 1 view .LVU283
+	.loc 1 129 5 view .LVU284
+.LVL89:
+.L47:
+	.loc 1 136 5 view .LVU285
+	testq	%rdx, %rdx
+	leaq	.LC11(%rip), %rax
+	cmove	%rax, %rdx
+	movq	%r14, %rsi
+	leaq	.LC39(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL90:
+	.loc 1 137 5 view .LVU286
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL91:
+	jmp	.L53
+.LVL92:
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	.loc 1 137 5 is_stmt 0 view .LVU287
+.LBE22:
+.LBE29:
+.LBB30:
+.LBB27:
+	.loc 1 145 57 discriminator 1 view .LVU288
+	testq	%r12, %r12
+	jne	.L55
+	.loc 1 145 68 view .LVU289
+	xorl	%eax, %eax
+	cmpq	$-42, -232(%rbp)
+	sete	%al
+	.loc 1 145 15 view .LVU290
+	andl	%eax, %ebx
+.LVL93:
+	.loc 1 145 15 view .LVU291
+.LBE27:
+	.loc 1 142 27 is_stmt 1 view .LVU292
+	.loc 1 142 21 view .LVU293
+	movl	$1, %r12d
+	jmp	.L58
+.LVL94:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.loc 1 142 21 is_stmt 0 view .LVU294
+.LBE30:
+	.loc 1 152 5 is_stmt 1 view .LVU295
+	leaq	.LC41(%rip), %rdi
+	call	puts@PLT
+.LVL95:
+	jmp	.L60
+.LVL96:
+	.p2align 4,,10
+	.p2align 3
+.L71:
+.LBB31:
+.LBB23:
+	.loc 1 115 64 is_stmt 0 discriminator 2 view .LVU296
+	movq	%rdx, %rsi
+	movq	%r15, %rdi
+	movq	%rdx, -312(%rbp)
+	call	sv_equals@PLT
+.LVL97:
+	.loc 1 115 61 discriminator 2 view .LVU297
+	testl	%eax, %eax
+	movq	-312(%rbp), %rdx
+	je	.L44
+	.loc 1 121 12 view .LVU298
+	movq	$0x000000000, -232(%rbp)
+	.loc 1 122 24 view .LVU299
+	movq	-248(%rbp), %rsi
+	movq	%r15, %rdi
+	movq	%rdx, -312(%rbp)
+	.loc 1 121 5 is_stmt 1 view .LVU300
+	.loc 1 122 5 view .LVU301
+	.loc 1 122 24 is_stmt 0 view .LVU302
+	call	sv_to_double@PLT
+.LVL98:
+	.loc 1 122 20 view .LVU303
+	testl	%eax, %eax
+	.loc 1 122 82 view .LVU304
+	vmovsd	-176(%rbp,%rbx), %xmm0
+	.loc 1 122 66 view .LVU305
+	vmovsd	-232(%rbp), %xmm1
+	.loc 1 122 20 view .LVU306
+	movq	-312(%rbp), %rdx
+	je	.L49
+	.loc 1 122 57 discriminator 3 view .LVU307
+	vucomisd	%xmm1, %xmm0
+	jp	.L49
+	jne	.L49
+	.loc 1 129 5 is_stmt 1 view .LVU308
+	.loc 1 129 55 is_stmt 0 view .LVU309
+	movq	-216(%rbp), %rax
+	.loc 1 129 32 view .LVU310
+	movq	16(%r12), %rcx
+	.loc 1 129 55 view .LVU311
+	decq	%rax
+	.loc 1 129 20 view .LVU312
+	cmpq	%rax, %rcx
+	je	.L47
+	.loc 1 130 7 is_stmt 1 discriminator 2 view .LVU313
+	movq	%rcx, %rdx
+	movq	%r14, %rsi
+	leaq	.LC38(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL99:
+	.loc 1 131 7 discriminator 2 view .LVU314
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL100:
+	.loc 1 132 7 discriminator 2 view .LVU315
+	.loc 1 133 7 discriminator 2 view .LVU316
+	jmp	.L46
+.LVL101:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.loc 1 123 7 discriminator 4 view .LVU317
+	movq	%rdx, %rsi
+	leaq	.LC37(%rip), %rdi
+	movl	$2, %eax
+	call	printf@PLT
+.LVL102:
+	.loc 1 124 7 discriminator 4 view .LVU318
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL103:
+	.loc 1 125 7 discriminator 4 view .LVU319
+	.loc 1 126 7 discriminator 4 view .LVU320
+	jmp	.L46
+.LBE23:
+.LBE31:
+	.cfi_endproc
+.LFE28:
+	.size	run_st_extract_numbers_view_unit_tests, .-run_st_extract_numbers_view_unit_tests
+	.p2align 4
+	.globl	run_string_view_tests
+	.type	run_string_view_tests, @function
+run_string_view_tests:
+.LFB29:
+	.loc 1 162 29 view -0
+	.cfi_startproc
+	.loc 1 164 3 view .LVU322
+	.loc 1 162 29 is_stmt 0 view .LVU323
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 164 7 view .LVU324
+	xorl	%eax, %eax
+	call	run_sv_compare_unit_tests@PLT
+.LVL104:
+	.loc 1 164 6 view .LVU325
+	cmpl	$1, %eax
+	je	.L75
+	.loc 1 168 3 is_stmt 1 view .LVU326
+	.loc 1 168 7 is_stmt 0 view .LVU327
+	xorl	%eax, %eax
+	call	run_st_sub_string_view_unit_tests@PLT
+.LVL105:
+	.loc 1 168 6 view .LVU328
+	cmpl	$1, %eax
+	je	.L75
+	.loc 1 172 3 is_stmt 1 view .LVU329
+	.loc 1 172 7 is_stmt 0 view .LVU330
+	xorl	%eax, %eax
+	call	run_st_extract_numbers_view_unit_tests@PLT
+.LVL106:
+	.loc 1 172 6 view .LVU331
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+	.loc 1 177 1 view .LVU332
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	.cfi_restore_state
+	.loc 1 165 11 view .LVU333
+	movl	$1, %eax
+	.loc 1 177 1 view .LVU334
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	run_string_view_tests, .-run_string_view_tests
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC5:
+	.long	0
+	.long	0
+	.long	-1
+	.long	1
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC33:
+	.long	0
+	.long	1079951360
+	.long	0
+	.long	-1062104064
+	.long	0
+	.long	0
+	.long	0
+	.long	0
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/stdio.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "/root/repo/tests/../include/strutils.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "/usr/include/stdlib.h"
+	.file 10 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xf0c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF112
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xc
+	.long	.LASF8
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x20
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xc
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x79
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xc
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0xc
+	.long	.LASF12
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x79
+	.uleb128 0x6
+	.long	0x9d
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x18
+	.long	0x9d
+	.uleb128 0xc
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x13
+	.long	0x8c
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF15
+	.uleb128 0xc
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x13
+	.long	0x6d
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF17
+	.uleb128 0x6
+	.long	0xa4
+	.uleb128 0xc
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0x80
+	.uleb128 0x22
+	.long	.LASF19
+	.byte	0x10
+	.byte	0x7
+	.byte	0xd
+	.byte	0x8
+	.long	0x106
+	.uleb128 0x19
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0xcf
+	.byte	0
+	.uleb128 0x19
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x18
+	.long	0xe0
+	.uleb128 0x10
+	.long	.LASF20
+	.byte	0x18
+	.value	0x175
+	.long	0x13f
+	.uleb128 0x3
+	.long	.LASF21
+	.value	0x17a
+	.byte	0x1c
+	.long	0x144
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF22
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF23
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF113
+	.uleb128 0x6
+	.long	0x13f
+	.uleb128 0x7
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF24
+	.uleb128 0x10
+	.long	.LASF25
+	.byte	0x40
+	.value	0x1e6
+	.long	0x1c5
+	.uleb128 0x3
+	.long	.LASF26
+	.value	0x1eb
+	.byte	0xc
+	.long	0xd4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF27
+	.value	0x1f0
+	.byte	0xc
+	.long	0xd4
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF28
+	.value	0x1f5
+	.byte	0xc
+	.long	0xd4
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF29
+	.value	0x1fa
+	.byte	0xc
+	.long	0xd4
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF30
+	.value	0x1ff
+	.byte	0xc
+	.long	0xd4
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF31
+	.value	0x204
+	.byte	0xc
+	.long	0xd4
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF32
+	.value	0x209
+	.byte	0xc
+	.long	0xd4
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF33
+	.value	0x20e
+	.byte	0xc
+	.long	0xd4
+	.byte	0x38
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF34
+	.byte	0x38
+	.value	0x26c
+	.long	0x237
+	.uleb128 0x3
+	.long	.LASF35
+	.value	0x272
+	.byte	0xd
+	.long	0x250
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF36
+	.value	0x277
+	.byte	0x9
+	.long	0x48
+	.byte	0x8
+	.uleb128 0x1a
+	.string	"fd"
+	.value	0x27c
+	.long	0x66
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF37
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF38
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF39
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x1a
+	.string	"eof"
+	.value	0x290
+	.long	0x66
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF40
+	.value	0x295
+	.byte	0x7
+	.long	0x66
+	.byte	0x34
+	.byte	0
+	.uleb128 0x24
+	.long	0xa9
+	.long	0x250
+	.uleb128 0x4
+	.long	0x48
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	0x237
+	.uleb128 0x1b
+	.long	.LASF43
+	.long	0x41
+	.value	0x29b
+	.long	0x271
+	.uleb128 0xe
+	.long	.LASF41
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF42
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF44
+	.long	0x41
+	.value	0x2b5
+	.long	0x299
+	.uleb128 0xe
+	.long	.LASF45
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF46
+	.byte	0x1
+	.uleb128 0xe
+	.long	.LASF47
+	.byte	0x2
+	.uleb128 0xe
+	.long	.LASF48
+	.byte	0x3
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF49
+	.value	0x158
+	.byte	0x7
+	.value	0x2cf
+	.byte	0x8
+	.long	0x347
+	.uleb128 0x3
+	.long	.LASF50
+	.value	0x2d4
+	.byte	0x9
+	.long	0x98
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF51
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF52
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF53
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF54
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x255
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF55
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF56
+	.value	0x2f2
+	.byte	0x18
+	.long	0x347
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF57
+	.value	0x2f7
+	.byte	0x18
+	.long	0x271
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF58
+	.value	0x2fc
+	.byte	0x17
+	.long	0x34c
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF59
+	.value	0x301
+	.byte	0x8
+	.long	0x351
+	.byte	0x48
+	.uleb128 0x1c
+	.long	.LASF60
+	.value	0x306
+	.byte	0x21
+	.long	0x3af
+	.value	0x148
+	.uleb128 0x1c
+	.long	.LASF61
+	.value	0x30b
+	.byte	0x17
+	.long	0x3b4
+	.value	0x150
+	.byte	0
+	.uleb128 0x6
+	.long	0x1c5
+	.uleb128 0x6
+	.long	0x10b
+	.uleb128 0x9
+	.long	0x9d
+	.long	0x361
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0xff
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF62
+	.byte	0x28
+	.value	0x764
+	.long	0x3af
+	.uleb128 0x3
+	.long	.LASF63
+	.value	0x769
+	.byte	0xb
+	.long	0x3c5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF64
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF65
+	.value	0x774
+	.byte	0xd
+	.long	0x3ca
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF51
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF66
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0x361
+	.uleb128 0x6
+	.long	0x150
+	.uleb128 0x6
+	.long	0x106
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF67
+	.uleb128 0x6
+	.long	0x2e
+	.uleb128 0x6
+	.long	0xd4
+	.uleb128 0x6
+	.long	0x299
+	.uleb128 0xb
+	.long	.LASF68
+	.byte	0x7
+	.byte	0x6e
+	.byte	0x5
+	.long	0x66
+	.long	0x3ef
+	.uleb128 0x4
+	.long	0x3b9
+	.uleb128 0x4
+	.long	0x3ef
+	.byte	0
+	.uleb128 0x6
+	.long	0xbc
+	.uleb128 0xf
+	.long	.LASF69
+	.byte	0x8
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0x40b
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF70
+	.byte	0x7
+	.byte	0x61
+	.byte	0x5
+	.long	0x66
+	.long	0x426
+	.uleb128 0x4
+	.long	0x3b9
+	.uleb128 0x4
+	.long	0x426
+	.byte	0
+	.uleb128 0x6
+	.long	0x3be
+	.uleb128 0xf
+	.long	.LASF71
+	.byte	0x7
+	.value	0x473
+	.byte	0x5
+	.long	0x66
+	.long	0x447
+	.uleb128 0x4
+	.long	0x3cf
+	.uleb128 0x4
+	.long	0x447
+	.byte	0
+	.uleb128 0x6
+	.long	0xe0
+	.uleb128 0x1d
+	.long	.LASF74
+	.byte	0x9
+	.value	0x238
+	.byte	0xd
+	.long	0x45f
+	.uleb128 0x4
+	.long	0x48
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF72
+	.byte	0x8
+	.byte	0x9c
+	.byte	0xc
+	.long	0x66
+	.long	0x47a
+	.uleb128 0x4
+	.long	0xcf
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF73
+	.byte	0x7
+	.value	0x425
+	.byte	0x7
+	.long	0x98
+	.long	0x49b
+	.uleb128 0x4
+	.long	0x3cf
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x4
+	.long	0xa4
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF75
+	.byte	0x7
+	.value	0x403
+	.byte	0x6
+	.long	0x4ae
+	.uleb128 0x4
+	.long	0x3cf
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF76
+	.byte	0x7
+	.value	0x451
+	.byte	0x5
+	.long	0x66
+	.long	0x4d4
+	.uleb128 0x4
+	.long	0x3cf
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x4
+	.long	0x447
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF77
+	.byte	0x7
+	.value	0x317
+	.byte	0x19
+	.long	0x3cf
+	.long	0x4eb
+	.uleb128 0x4
+	.long	0x98
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF78
+	.byte	0x8
+	.byte	0x8d
+	.byte	0xe
+	.long	0x98
+	.long	0x506
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF79
+	.byte	0x7
+	.byte	0x48
+	.byte	0xa
+	.long	0xd4
+	.long	0x51c
+	.uleb128 0x4
+	.long	0x3b9
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF80
+	.byte	0x7
+	.byte	0x3d
+	.byte	0x5
+	.long	0x66
+	.long	0x537
+	.uleb128 0x4
+	.long	0x3b9
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF81
+	.byte	0x4
+	.value	0x164
+	.byte	0xc
+	.long	0x66
+	.long	0x54f
+	.uleb128 0x4
+	.long	0xcf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF82
+	.byte	0x7
+	.byte	0x30
+	.byte	0x5
+	.long	0x66
+	.long	0x56a
+	.uleb128 0x4
+	.long	0x3b9
+	.uleb128 0x4
+	.long	0x3b9
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF83
+	.byte	0x7
+	.byte	0x23
+	.byte	0x13
+	.long	0xe0
+	.long	0x580
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF84
+	.byte	0xa2
+	.long	0x66
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5c8
+	.uleb128 0x12
+	.quad	.LVL104
+	.long	0xc9d
+	.uleb128 0x12
+	.quad	.LVL105
+	.long	0x97c
+	.uleb128 0x12
+	.quad	.LVL106
+	.long	0x5c8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF85
+	.byte	0x62
+	.long	0x66
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x93c
+	.uleb128 0x5
+	.long	.LASF86
+	.byte	0x64
+	.byte	0xf
+	.long	0x93c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -208
+	.uleb128 0x5
+	.long	.LASF87
+	.byte	0x65
+	.byte	0xf
+	.long	0x93c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -144
+	.uleb128 0x5
+	.long	.LASF88
+	.byte	0x66
+	.byte	0xa
+	.long	0x94c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -176
+	.uleb128 0x17
+	.long	.LASF89
+	.byte	0x68
+	.long	0x66
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF91
+	.byte	0x6c
+	.byte	0x7
+	.long	0x66
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x5
+	.long	.LASF90
+	.byte	0x8c
+	.byte	0xf
+	.long	0x95c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -112
+	.uleb128 0x8
+	.long	.LASF92
+	.byte	0x8d
+	.byte	0x7
+	.long	0x66
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x13
+	.long	.LLRL15
+	.long	0x84e
+	.uleb128 0x14
+	.string	"i"
+	.byte	0x6d
+	.long	0x66
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x15
+	.long	.LLRL17
+	.uleb128 0x5
+	.long	.LASF50
+	.byte	0x6e
+	.byte	0xa
+	.long	0x96c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -112
+	.uleb128 0x8
+	.long	.LASF93
+	.byte	0x70
+	.byte	0x1d
+	.long	0x3cf
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x5
+	.long	.LASF94
+	.byte	0x71
+	.byte	0x17
+	.long	0xe0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -224
+	.uleb128 0x8
+	.long	.LASF95
+	.byte	0x72
+	.byte	0x9
+	.long	0x66
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x5
+	.long	.LASF96
+	.byte	0x79
+	.byte	0xc
+	.long	0x3be
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -232
+	.uleb128 0x2
+	.quad	.LVL65
+	.long	0x4eb
+	.long	0x6e4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL66
+	.long	0x4d4
+	.long	0x6fc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL68
+	.long	0x42b
+	.long	0x71a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL72
+	.long	0x537
+	.long	0x73f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL73
+	.long	0x49b
+	.long	0x757
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL90
+	.long	0x537
+	.long	0x77c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL91
+	.long	0x49b
+	.long	0x794
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL97
+	.long	0x51c
+	.long	0x7b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -312
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL98
+	.long	0x40b
+	.long	0x7d4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -248
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL99
+	.long	0x537
+	.long	0x7f9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL100
+	.long	0x49b
+	.long	0x811
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL102
+	.long	0x537
+	.long	0x838
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -312
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL103
+	.long	0x49b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LLRL20
+	.long	0x8b5
+	.uleb128 0x14
+	.string	"i"
+	.byte	0x8e
+	.long	0x66
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x15
+	.long	.LLRL22
+	.uleb128 0x5
+	.long	.LASF94
+	.byte	0x8f
+	.byte	0x17
+	.long	0xe0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -224
+	.uleb128 0x5
+	.long	.LASF96
+	.byte	0x90
+	.byte	0xd
+	.long	0xbc
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -232
+	.uleb128 0x12
+	.quad	.LVL80
+	.long	0x3f4
+	.uleb128 0xd
+	.quad	.LVL81
+	.long	0x3d4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -248
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL62
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL63
+	.long	0xefd
+	.long	0x8df
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC34
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL79
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL84
+	.long	0xefd
+	.long	0x909
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC40
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL86
+	.long	0xf06
+	.long	0x920
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL95
+	.long	0xefd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC41
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xcf
+	.long	0x94c
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	0x3be
+	.long	0x95c
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	0xcf
+	.long	0x96c
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x5
+	.byte	0
+	.uleb128 0x9
+	.long	0x9d
+	.long	0x97c
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF97
+	.byte	0x33
+	.long	0x66
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc7d
+	.uleb128 0x5
+	.long	.LASF86
+	.byte	0x35
+	.byte	0xf
+	.long	0xc7d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0x5
+	.long	.LASF98
+	.byte	0x36
+	.byte	0xe
+	.long	0xc8d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 70
+	.uleb128 0x5
+	.long	.LASF99
+	.byte	0x37
+	.byte	0xe
+	.long	0xc8d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 75
+	.uleb128 0x5
+	.long	.LASF87
+	.byte	0x38
+	.byte	0xf
+	.long	0xc7d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0x17
+	.long	.LASF89
+	.byte	0x3a
+	.long	0x66
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF91
+	.byte	0x3e
+	.byte	0x7
+	.long	0x66
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x13
+	.long	.LLRL7
+	.long	0xc3f
+	.uleb128 0x14
+	.string	"i"
+	.byte	0x3f
+	.long	0x66
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x15
+	.long	.LLRL9
+	.uleb128 0x5
+	.long	.LASF50
+	.byte	0x40
+	.byte	0xa
+	.long	0x96c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 224
+	.uleb128 0x8
+	.long	.LASF93
+	.byte	0x42
+	.byte	0x1d
+	.long	0x3cf
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x5
+	.long	.LASF94
+	.byte	0x43
+	.byte	0x17
+	.long	0xe0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.uleb128 0x8
+	.long	.LASF95
+	.byte	0x44
+	.byte	0x9
+	.long	0x66
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x8
+	.long	.LASF100
+	.byte	0x4d
+	.byte	0xb
+	.long	0x98
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2
+	.quad	.LVL29
+	.long	0x537
+	.long	0xa90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL30
+	.long	0x49b
+	.long	0xaa8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL34
+	.long	0x4eb
+	.long	0xac6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL35
+	.long	0x4d4
+	.long	0xade
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL38
+	.long	0x4ae
+	.long	0xb09
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL42
+	.long	0x47a
+	.long	0xb2d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL45
+	.long	0x537
+	.long	0xb52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL46
+	.long	0x44c
+	.long	0xb6a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL48
+	.long	0x49b
+	.long	0xb82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL53
+	.long	0x51c
+	.long	0xba2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 0
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL54
+	.long	0x47a
+	.long	0xbc6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL56
+	.long	0x45f
+	.long	0xbe5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 0
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL57
+	.long	0x537
+	.long	0xc11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 0
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL58
+	.long	0x44c
+	.long	0xc29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL59
+	.long	0x49b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL26
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL27
+	.long	0xefd
+	.long	0xc69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL50
+	.long	0xf06
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xcf
+	.long	0xc8d
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	0xa4
+	.long	0xc9d
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x4
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF101
+	.byte	0x9
+	.long	0x66
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xeed
+	.uleb128 0x5
+	.long	.LASF102
+	.byte	0xb
+	.byte	0xf
+	.long	0x95c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x5
+	.long	.LASF103
+	.byte	0xc
+	.byte	0xf
+	.long	0x95c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.uleb128 0x5
+	.long	.LASF87
+	.byte	0xd
+	.byte	0x7
+	.long	0xeed
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0x17
+	.long	.LASF89
+	.byte	0xf
+	.long	0x66
+	.byte	0x6
+	.uleb128 0x8
+	.long	.LASF91
+	.byte	0x13
+	.byte	0x7
+	.long	0x66
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x13
+	.long	.LLRL1
+	.long	0xeaf
+	.uleb128 0x14
+	.string	"i"
+	.byte	0x14
+	.long	0x66
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x15
+	.long	.LLRL3
+	.uleb128 0x5
+	.long	.LASF104
+	.byte	0x15
+	.byte	0x17
+	.long	0xe0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x5
+	.long	.LASF105
+	.byte	0x16
+	.byte	0x17
+	.long	0xe0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.uleb128 0x8
+	.long	.LASF106
+	.byte	0x17
+	.byte	0x9
+	.long	0x66
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x8
+	.long	.LASF107
+	.byte	0x18
+	.byte	0x9
+	.long	0x66
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2
+	.quad	.LVL4
+	.long	0x537
+	.long	0xd95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL8
+	.long	0x56a
+	.long	0xdad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL9
+	.long	0x56a
+	.long	0xdc5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL10
+	.long	0x54f
+	.long	0xde5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL13
+	.long	0x51c
+	.long	0xe04
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL15
+	.long	0x506
+	.long	0xe1d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL16
+	.long	0x506
+	.long	0xe36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 48
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL18
+	.long	0x537
+	.long	0xe61
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL22
+	.long	0x537
+	.long	0xe8c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL24
+	.long	0x537
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL1
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL2
+	.long	0xefd
+	.long	0xed9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL20
+	.long	0xf06
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x66
+	.long	0xefd
+	.uleb128 0xa
+	.long	0x3a
+	.byte	0x5
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF108
+	.long	.LASF110
+	.uleb128 0x1e
+	.long	.LASF109
+	.long	.LASF111
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS13:
+	.uleb128 .LVU218
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU275
+	.uleb128 .LVU275
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU279
+	.uleb128 .LVU279
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 .LVU316
+	.uleb128 .LVU316
+	.uleb128 .LVU317
+	.uleb128 .LVU317
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -268
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -268
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -268
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -8
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x11c
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -268
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -268
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU250
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU267
+	.uleb128 .LVU287
+	.uleb128 .LVU291
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU220
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU255
+	.uleb128 .LVU280
+	.uleb128 .LVU287
+	.uleb128 .LVU296
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU229
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU254
+	.uleb128 .LVU280
+	.uleb128 .LVU287
+	.uleb128 .LVU296
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU233
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 .LVU238
+	.uleb128 .LVU280
+	.uleb128 .LVU285
+	.uleb128 .LVU296
+	.uleb128 .LVU297
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU252
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU270
+	.uleb128 .LVU287
+	.uleb128 .LVU293
+	.uleb128 .LVU293
+	.uleb128 .LVU294
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU122
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU171
+	.uleb128 .LVU176
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 12
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 12
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 12
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 12
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU124
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU134
+	.uleb128 .LVU138
+	.uleb128 .LVU167
+	.uleb128 .LVU176
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU128
+	.uleb128 .LVU138
+	.uleb128 .LVU142
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU175
+	.uleb128 .LVU176
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU146
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU154
+	.uleb128 .LVU176
+	.uleb128 .LVU177
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU160
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 .LVU171
+	.uleb128 .LVU185
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU28
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU80
+	.uleb128 .LVU84
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU30
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU38
+	.uleb128 .LVU42
+	.uleb128 .LVU76
+	.uleb128 .LVU84
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU54
+	.uleb128 .LVU57
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU33
+	.uleb128 .LVU34
+	.uleb128 .LVU58
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU69
+	.uleb128 .LVU84
+	.uleb128 .LVU87
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF94:
+	.string	"view"
+.LASF106:
+	.string	"result"
+.LASF110:
+	.string	"__builtin_puts"
+.LASF22:
+	.string	"block_size"
+.LASF87:
+	.string	"expected_values"
+.LASF48:
+	.string	"ST_STRING_INLINE"
+.LASF83:
+	.string	"sv_from_string"
+.LASF91:
+	.string	"exit_status"
+.LASF59:
+	.string	"inline_buffer"
+.LASF18:
+	.string	"uint64_t"
+.LASF7:
+	.string	"short int"
+.LASF8:
+	.string	"size_t"
+.LASF75:
+	.string	"st_destroy"
+.LASF63:
+	.string	"positions"
+.LASF109:
+	.string	"putchar"
+.LASF60:
+	.string	"structural_index"
+.LASF61:
+	.string	"stats"
+.LASF101:
+	.string	"run_sv_compare_unit_tests"
+.LASF80:
+	.string	"sv_equals"
+.LASF27:
+	.string	"tokens_extracted"
+.LASF23:
+	.string	"used"
+.LASF14:
+	.string	"ssize_t"
+.LASF76:
+	.string	"st_sub_string_view"
+.LASF16:
+	.string	"int64_t"
+.LASF96:
+	.string	"value"
+.LASF32:
+	.string	"conversions"
+.LASF21:
+	.string	"head"
+.LASF47:
+	.string	"ST_STRING_MAPPED"
+.LASF20:
+	.string	"StringArena"
+.LASF77:
+	.string	"st_create"
+.LASF74:
+	.string	"free"
+.LASF97:
+	.string	"run_st_sub_string_view_unit_tests"
+.LASF66:
+	.string	"hint"
+.LASF51:
+	.string	"length"
+.LASF68:
+	.string	"sv_to_int64"
+.LASF98:
+	.string	"start_delims"
+.LASF35:
+	.string	"read"
+.LASF15:
+	.string	"long long int"
+.LASF102:
+	.string	"left_values"
+.LASF12:
+	.string	"__ssize_t"
+.LASF31:
+	.string	"bytes_copied"
+.LASF10:
+	.string	"long int"
+.LASF9:
+	.string	"__int64_t"
+.LASF50:
+	.string	"string"
+.LASF93:
+	.string	"tokenizer"
+.LASF39:
+	.string	"offset"
+.LASF88:
+	.string	"double_values"
+.LASF36:
+	.string	"context"
+.LASF55:
+	.string	"max_increment"
+.LASF71:
+	.string	"st_extract_numbers_view"
+.LASF73:
+	.string	"st_sub_string"
+.LASF53:
+	.string	"incremental_factor"
+.LASF45:
+	.string	"ST_STRING_BORROWED"
+.LASF43:
+	.string	"StringGrowthPolicy"
+.LASF29:
+	.string	"reallocations"
+.LASF24:
+	.string	"long double"
+.LASF105:
+	.string	"right"
+.LASF4:
+	.string	"unsigned char"
+.LASF42:
+	.string	"ST_GROWTH_LINEAR"
+.LASF38:
+	.string	"capacity"
+.LASF17:
+	.string	"long long unsigned int"
+.LASF3:
+	.string	"unsigned int"
+.LASF57:
+	.string	"ownership"
+.LASF108:
+	.string	"puts"
+.LASF84:
+	.string	"run_string_view_tests"
+.LASF92:
+	.string	"converted"
+.LASF82:
+	.string	"sv_compare"
+.LASF103:
+	.string	"right_values"
+.LASF13:
+	.string	"char"
+.LASF81:
+	.string	"printf"
+.LASF69:
+	.string	"strlen"
+.LASF104:
+	.string	"left"
+.LASF58:
+	.string	"arena"
+.LASF5:
+	.string	"short unsigned int"
+.LASF78:
+	.string	"strcpy"
+.LASF111:
+	.string	"__builtin_putchar"
+.LASF11:
+	.string	"__uint64_t"
+.LASF89:
+	.string	"num_tests"
+.LASF25:
+	.string	"StringStats"
+.LASF79:
+	.string	"sv_hash"
+.LASF2:
+	.string	"long unsigned int"
+.LASF107:
+	.string	"sign"
+.LASF67:
+	.string	"double"
+.LASF62:
+	.string	"StringStructuralIndex"
+.LASF112:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF46:
+	.string	"ST_STRING_OWNED"
+.LASF70:
+	.string	"sv_to_double"
+.LASF99:
+	.string	"end_delims"
+.LASF65:
+	.string	"in_string"
+.LASF95:
+	.string	"found"
+.LASF64:
+	.string	"count"
+.LASF90:
+	.string	"integer_values"
+.LASF37:
+	.string	"chunk_size"
+.LASF72:
+	.string	"strcmp"
+.LASF6:
+	.string	"signed char"
+.LASF44:
+	.string	"StringOwnership"
+.LASF33:
+	.string	"conversion_ns"
+.LASF100:
+	.string	"copy"
+.LASF41:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF85:
+	.string	"run_st_extract_numbers_view_unit_tests"
+.LASF40:
+	.string	"error"
+.LASF52:
+	.string	"position"
+.LASF19:
+	.string	"StringView"
+.LASF49:
+	.string	"StringTokenizer"
+.LASF86:
+	.string	"string_values"
+.LASF26:
+	.string	"bytes_scanned"
+.LASF54:
+	.string	"growth_policy"
+.LASF56:
+	.string	"stream"
+.LASF113:
+	.string	"StringArenaBlock"
+.LASF34:
+	.string	"StringStream"
+.LASF30:
+	.string	"expansions"
+.LASF28:
+	.string	"allocations"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/tests/string_view_unit_tests.c"
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4882 @@
+	.file	"structural_index_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test-stats" "/root/repo/tests/structural_index_unit_tests.c"
+	.p2align 4
+	.type	structural_test_document, @function
+structural_test_document:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/tests/structural_index_unit_tests.c"
+	.loc 1 17 54 view -0
+	.cfi_startproc
+	.loc 1 18 3 view .LVU1
+	.loc 1 19 3 view .LVU2
+	.loc 1 19 13 is_stmt 0 view .LVU3
+	vmovdqa	.LC0(%rip), %ymm1
+	vmovdqa	.LC1(%rip), %ymm2
+	vmovdqu	%ymm1, (%rdi)
+	.loc 1 21 18 view .LVU4
+	movl	$58, %eax
+	.loc 1 19 13 view .LVU5
+	vmovdqu	%ymm2, 26(%rdi)
+.LVL1:
+	.loc 1 21 3 is_stmt 1 view .LVU6
+	.loc 1 21 28 view .LVU7
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 22 5 view .LVU8
+	.loc 1 22 22 is_stmt 0 view .LVU9
+	movb	$120, -1(%rdi,%rax)
+	.loc 1 21 28 is_stmt 1 view .LVU10
+	movq	%rax, %rdx
+	.loc 1 21 18 is_stmt 0 view .LVU11
+	incq	%rax
+.LVL2:
+	.loc 1 21 28 view .LVU12
+	testb	$63, %al
+	jne	.L2
+	.loc 1 24 3 is_stmt 1 view .LVU13
+	.loc 1 24 13 is_stmt 0 view .LVU14
+	vmovdqa	.LC2(%rip), %ymm3
+	vmovdqa	.LC3(%rip), %ymm4
+	leaq	(%rdi,%rdx), %rax
+	vmovdqu	%ymm3, (%rax)
+	.loc 1 26 13 view .LVU15
+	movabsq	$7310302547462463532, %rcx
+	movabsq	$9605583265428329, %rsi
+	.loc 1 24 13 view .LVU16
+	vmovdqu	%ymm4, 28(%rax)
+.LVL3:
+	.loc 1 26 3 is_stmt 1 view .LVU17
+	.loc 1 26 13 is_stmt 0 view .LVU18
+	leaq	59(%rdi,%rdx), %rax
+	movq	%rcx, (%rax)
+	.loc 1 26 10 view .LVU19
+	addq	$71, %rdx
+.LVL4:
+	.loc 1 27 3 is_stmt 1 view .LVU20
+.LBB2:
+	.loc 1 27 8 view .LVU21
+	.loc 1 27 21 view .LVU22
+.LBE2:
+	.loc 1 26 13 is_stmt 0 view .LVU23
+	movq	%rsi, 5(%rax)
+	.loc 1 26 10 view .LVU24
+	movl	$40, %ecx
+.LBB3:
+	.loc 1 28 15 view .LVU25
+	movabsq	$9109991449066331, %rsi
+.LVL5:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 28 5 is_stmt 1 discriminator 3 view .LVU26
+	.loc 1 28 15 is_stmt 0 discriminator 3 view .LVU27
+	movq	%rsi, (%rdi,%rdx)
+	movq	%rdx, %rax
+	.loc 1 28 12 discriminator 3 view .LVU28
+	addq	$7, %rdx
+.LVL6:
+	.loc 1 27 28 is_stmt 1 discriminator 3 view .LVU29
+	.loc 1 27 21 discriminator 3 view .LVU30
+	decl	%ecx
+	jne	.L3
+.LBE3:
+	.loc 1 30 3 view .LVU31
+	.loc 1 30 13 is_stmt 0 view .LVU32
+	addq	%rdx, %rdi
+.LVL7:
+	.loc 1 30 13 view .LVU33
+	vmovdqa	.LC4(%rip), %xmm0
+	movl	$2105376, 16(%rdi)
+.LVL8:
+	.loc 1 31 3 is_stmt 1 view .LVU34
+	.loc 1 30 13 is_stmt 0 view .LVU35
+	vmovdqu	%xmm0, (%rdi)
+	.loc 1 30 10 view .LVU36
+	addq	$26, %rax
+.LVL9:
+	.loc 1 30 10 view .LVU37
+	vzeroupper
+.LVL10:
+	.loc 1 32 1 view .LVU38
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	structural_test_document, .-structural_test_document
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC5:
+	.string	"{}[]:,"
+	.text
+	.p2align 4
+	.type	structural_test_reference, @function
+structural_test_reference:
+.LVL11:
+.LFB27:
+	.loc 1 47 101 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 48 3 view .LVU40
+	.loc 1 49 3 view .LVU41
+	.loc 1 50 3 view .LVU42
+	.loc 1 51 3 view .LVU43
+	.loc 1 52 3 view .LVU44
+.LBB4:
+	.loc 1 52 8 view .LVU45
+	.loc 1 52 24 view .LVU46
+.LBE4:
+	.loc 1 47 101 is_stmt 0 view .LVU47
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 47 101 view .LVU48
+	movq	%rdx, 8(%rsp)
+.LBB9:
+	.loc 1 52 24 view .LVU49
+	testq	%rsi, %rsi
+	je	.L14
+.LBE9:
+	.loc 1 51 7 view .LVU50
+	movl	$0, 4(%rsp)
+	.loc 1 50 7 view .LVU51
+	movl	$0, (%rsp)
+	movq	%rdi, %r13
+	movq	%rsi, %rbp
+.LBB10:
+	.loc 1 52 15 view .LVU52
+	xorl	%ebx, %ebx
+.LBE10:
+	.loc 1 49 7 view .LVU53
+	xorl	%r12d, %r12d
+	.loc 1 48 10 view .LVU54
+	xorl	%r15d, %r15d
+	jmp	.L13
+.LVL12:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+.LBB11:
+.LBB5:
+	.loc 1 67 5 is_stmt 1 view .LVU55
+	.loc 1 67 8 is_stmt 0 view .LVU56
+	cmpb	$34, %r14b
+	je	.L11
+	.loc 1 67 25 discriminator 1 view .LVU57
+	movsbl	%r14b, %esi
+	leaq	.LC5(%rip), %rdi
+	call	strchr@PLT
+.LVL13:
+	.loc 1 67 22 discriminator 1 view .LVU58
+	testq	%rax, %rax
+	je	.L12
+.L11:
+	.loc 1 68 7 is_stmt 1 view .LVU59
+.LVL14:
+	.loc 1 69 25 is_stmt 0 view .LVU60
+	cmpb	$34, %r14b
+	.loc 1 68 26 view .LVU61
+	movq	8(%rsp), %rax
+	.loc 1 70 17 view .LVU62
+	movl	$0, 4(%rsp)
+.LVL15:
+	.loc 1 69 17 view .LVU63
+	sete	%r12b
+	.loc 1 68 26 view .LVU64
+	movq	%rbx, (%rax,%r15,8)
+	.loc 1 69 7 is_stmt 1 view .LVU65
+.LVL16:
+	.loc 1 70 7 view .LVU66
+	.loc 1 69 17 is_stmt 0 view .LVU67
+	movzbl	%r12b, %r12d
+.LVL17:
+	.loc 1 68 22 view .LVU68
+	incq	%r15
+.LVL18:
+.L10:
+	.loc 1 68 22 view .LVU69
+.LBE5:
+	.loc 1 52 35 is_stmt 1 discriminator 2 view .LVU70
+	incq	%rbx
+.LVL19:
+	.loc 1 52 24 discriminator 2 view .LVU71
+	cmpq	%rbx, %rbp
+	je	.L7
+.LVL20:
+.L13:
+.LBB6:
+	.loc 1 53 5 view .LVU72
+	.loc 1 53 10 is_stmt 0 view .LVU73
+	movzbl	0(%r13,%rbx), %r14d
+.LVL21:
+	.loc 1 54 5 is_stmt 1 view .LVU74
+	.loc 1 54 8 is_stmt 0 view .LVU75
+	testl	%r12d, %r12d
+	je	.L9
+	.loc 1 55 7 is_stmt 1 view .LVU76
+	.loc 1 55 10 is_stmt 0 view .LVU77
+	movl	(%rsp), %edx
+	testl	%edx, %edx
+	jne	.L15
+	.loc 1 58 12 is_stmt 1 view .LVU78
+	.loc 1 58 15 is_stmt 0 view .LVU79
+	cmpb	$92, %r14b
+	je	.L16
+	.loc 1 61 12 is_stmt 1 view .LVU80
+	.loc 1 61 15 is_stmt 0 view .LVU81
+	cmpb	$34, %r14b
+	jne	.L10
+	.loc 1 62 9 is_stmt 1 view .LVU82
+.LVL22:
+	.loc 1 62 28 is_stmt 0 view .LVU83
+	movq	8(%rsp), %rax
+	.loc 1 63 19 view .LVU84
+	xorl	%r12d, %r12d
+.LVL23:
+	.loc 1 62 28 view .LVU85
+	movq	%rbx, (%rax,%r15,8)
+	.loc 1 63 9 is_stmt 1 view .LVU86
+.LVL24:
+	.loc 1 63 9 is_stmt 0 view .LVU87
+.LBE6:
+	.loc 1 52 35 view .LVU88
+	incq	%rbx
+.LVL25:
+.LBB7:
+	.loc 1 62 24 view .LVU89
+	incq	%r15
+.LVL26:
+	.loc 1 62 24 view .LVU90
+.LBE7:
+	.loc 1 52 35 is_stmt 1 view .LVU91
+	.loc 1 52 24 view .LVU92
+	cmpq	%rbx, %rbp
+	jne	.L13
+.LVL27:
+.L7:
+	.loc 1 52 24 is_stmt 0 view .LVU93
+.LBE11:
+	.loc 1 81 1 view .LVU94
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	movq	%r15, %rax
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.cfi_restore_state
+.LBB12:
+.LBB8:
+	.loc 1 81 1 view .LVU95
+	movl	(%rsp), %r12d
+.LVL29:
+	.loc 1 56 17 view .LVU96
+	movl	$0, (%rsp)
+	jmp	.L10
+.LVL30:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 72 10 is_stmt 1 view .LVU97
+	.loc 1 72 13 is_stmt 0 view .LVU98
+	cmpb	$32, %r14b
+	jbe	.L17
+	.loc 1 75 10 is_stmt 1 view .LVU99
+	.loc 1 75 13 is_stmt 0 view .LVU100
+	movl	4(%rsp), %eax
+	testl	%eax, %eax
+	jne	.L10
+	.loc 1 76 7 is_stmt 1 view .LVU101
+.LVL31:
+	.loc 1 76 26 is_stmt 0 view .LVU102
+	movq	8(%rsp), %rax
+	.loc 1 77 17 view .LVU103
+	movl	$1, 4(%rsp)
+.LVL32:
+	.loc 1 76 26 view .LVU104
+	movq	%rbx, (%rax,%r15,8)
+	.loc 1 77 7 is_stmt 1 view .LVU105
+.LVL33:
+	.loc 1 76 22 is_stmt 0 view .LVU106
+	incq	%r15
+.LVL34:
+	.loc 1 76 22 view .LVU107
+	jmp	.L10
+.LVL35:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 73 17 view .LVU108
+	movl	$0, 4(%rsp)
+.LVL36:
+	.loc 1 73 17 view .LVU109
+	jmp	.L10
+.LVL37:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 59 17 view .LVU110
+	movl	%r12d, (%rsp)
+	jmp	.L10
+.LVL38:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.loc 1 59 17 view .LVU111
+.LBE8:
+.LBE12:
+	.loc 1 48 10 view .LVU112
+	xorl	%r15d, %r15d
+	.loc 1 80 3 is_stmt 1 view .LVU113
+	.loc 1 80 10 is_stmt 0 view .LVU114
+	jmp	.L7
+	.cfi_endproc
+.LFE27:
+	.size	structural_test_reference, .-structural_test_reference
+	.section	.rodata.str1.1
+.LC7:
+	.string	"scalar"
+.LC8:
+	.string	"SSE2"
+.LC9:
+	.string	"AVX2"
+.LC10:
+	.string	"AVX-512"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC11:
+	.string	"------------------- st_build_structural_index(x) -------------------"
+	.align 8
+.LC12:
+	.string	"[Skipped] %s index is not supported by this CPU.\n"
+	.align 8
+.LC13:
+	.string	"[Passed] %s index found %zu token starts.\n"
+	.align 8
+.LC14:
+	.string	"[Failed] %s index failed: wrong positions.\n"
+	.text
+	.p2align 4
+	.globl	run_st_build_structural_index_unit_tests
+	.type	run_st_build_structural_index_unit_tests, @function
+run_st_build_structural_index_unit_tests:
+.LFB28:
+	.loc 1 86 48 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 88 3 view .LVU116
+	.loc 1 86 48 is_stmt 0 view .LVU117
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 89 15 view .LVU118
+	leaq	.LC9(%rip), %rcx
+	leaq	.LC10(%rip), %rax
+	.loc 1 86 48 view .LVU119
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 89 15 view .LVU120
+	vmovq	%rcx, %xmm1
+	leaq	.LC7(%rip), %rcx
+	.loc 1 86 48 view .LVU121
+	pushq	%r14
+	.loc 1 89 15 view .LVU122
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	leaq	.LC8(%rip), %rax
+	.loc 1 86 48 view .LVU123
+	pushq	%r13
+	.loc 1 93 3 view .LVU124
+	leaq	.LC11(%rip), %rdi
+	.loc 1 86 48 view .LVU125
+	pushq	%r12
+	pushq	%rbx
+	andq	$-32, %rsp
+	subq	$9344, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 88 22 view .LVU126
+	vmovdqa	.LC6(%rip), %xmm0
+	.loc 1 96 19 view .LVU127
+	leaq	128(%rsp), %r13
+	.loc 1 88 22 view .LVU128
+	vmovdqa	%xmm0, 80(%rsp)
+	.loc 1 89 3 is_stmt 1 view .LVU129
+	.loc 1 89 15 is_stmt 0 view .LVU130
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	vmovdqa	%ymm0, 96(%rsp)
+	.loc 1 91 3 is_stmt 1 view .LVU131
+.LVL39:
+	.loc 1 93 3 view .LVU132
+	vzeroupper
+.LVL40:
+	call	puts@PLT
+.LVL41:
+	.loc 1 95 3 view .LVU133
+	.loc 1 96 3 view .LVU134
+	.loc 1 96 19 is_stmt 0 view .LVU135
+	movq	%r13, %rdi
+	call	structural_test_document
+.LVL42:
+	.loc 1 98 18 view .LVU136
+	leaq	1152(%rsp), %r14
+	movq	%r14, %rdx
+	movq	%rax, %rsi
+	movq	%r13, %rdi
+	.loc 1 96 19 view .LVU137
+	movq	%rax, %r15
+	movq	%rax, 56(%rsp)
+.LVL43:
+	.loc 1 97 3 is_stmt 1 view .LVU138
+	.loc 1 98 3 view .LVU139
+	.loc 1 98 18 is_stmt 0 view .LVU140
+	call	structural_test_reference
+.LVL44:
+	.loc 1 98 18 view .LVU141
+	movq	%rax, 24(%rsp)
+.LVL45:
+	.loc 1 100 3 is_stmt 1 view .LVU142
+	.loc 1 101 3 view .LVU143
+	.loc 1 101 37 is_stmt 0 view .LVU144
+	xorl	%eax, %eax
+.LVL46:
+	.loc 1 101 37 view .LVU145
+	call	st_scan_isa@PLT
+.LVL47:
+	movl	%eax, %ebx
+.LVL48:
+	.loc 1 102 3 is_stmt 1 view .LVU146
+.LBB13:
+	.loc 1 102 8 view .LVU147
+	.loc 1 102 21 view .LVU148
+.LBB14:
+.LBB15:
+	.loc 1 109 17 is_stmt 0 view .LVU149
+	leaq	-64(%r15), %rax
+.LVL49:
+	.loc 1 109 17 view .LVU150
+	leaq	96(%rsp), %rdx
+	movq	%rax, 40(%rsp)
+	leaq	80(%rsp), %rax
+	movq	%rax, 72(%rsp)
+.LBE15:
+.LBE14:
+.LBE13:
+	.loc 1 100 7 view .LVU151
+	movl	$0, 36(%rsp)
+.LBB26:
+.LBB24:
+	.loc 1 104 7 view .LVU152
+	movq	%rdx, 48(%rsp)
+	movq	%rdx, 64(%rsp)
+	movl	%ebx, 32(%rsp)
+.LVL50:
+.L32:
+	.loc 1 103 5 is_stmt 1 view .LVU153
+	.loc 1 103 9 is_stmt 0 view .LVU154
+	movq	72(%rsp), %rax
+	movl	(%rax), %edi
+	call	st_scan_set_isa@PLT
+.LVL51:
+	.loc 1 103 8 view .LVU155
+	testl	%eax, %eax
+	je	.L44
+	.loc 1 108 5 is_stmt 1 view .LVU156
+.LVL52:
+	.loc 1 109 5 view .LVU157
+.LBB22:
+	.loc 1 109 10 view .LVU158
+	.loc 1 109 56 view .LVU159
+	movq	40(%rsp), %rax
+	cmpq	%rax, 56(%rsp)
+	jb	.L26
+	.loc 1 109 17 is_stmt 0 view .LVU160
+	movq	%rax, %r12
+.LVL53:
+.L30:
+.LBB16:
+	.loc 1 110 7 is_stmt 1 view .LVU161
+	.loc 1 110 43 is_stmt 0 view .LVU162
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	call	st_create_n@PLT
+.LVL54:
+	movq	%rax, %r15
+.LVL55:
+	.loc 1 111 7 is_stmt 1 view .LVU163
+	.loc 1 111 29 is_stmt 0 view .LVU164
+	movq	%r13, %rdi
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	call	structural_test_reference
+.LVL56:
+	.loc 1 112 11 view .LVU165
+	movq	%r15, %rdi
+	.loc 1 111 29 view .LVU166
+	movq	%rax, %rbx
+.LVL57:
+	.loc 1 112 7 is_stmt 1 view .LVU167
+	.loc 1 112 11 is_stmt 0 view .LVU168
+	call	st_build_structural_index@PLT
+.LVL58:
+	.loc 1 112 10 view .LVU169
+	testl	%eax, %eax
+	je	.L43
+.LBB17:
+	.loc 1 116 9 is_stmt 1 view .LVU170
+	.loc 1 116 39 is_stmt 0 view .LVU171
+	movq	328(%r15), %rax
+.LVL59:
+	.loc 1 117 9 is_stmt 1 view .LVU172
+	.loc 1 117 46 is_stmt 0 view .LVU173
+	cmpq	%rbx, 8(%rax)
+	je	.L29
+.LVL60:
+.L43:
+	.loc 1 117 46 view .LVU174
+.LBE17:
+	.loc 1 119 7 is_stmt 1 view .LVU175
+	movq	%r15, %rdi
+	call	st_destroy@PLT
+.LVL61:
+.LBE16:
+	.loc 1 109 72 view .LVU176
+	.loc 1 109 56 view .LVU177
+.L28:
+	.loc 1 109 56 is_stmt 0 view .LVU178
+.LBE22:
+	.loc 1 121 5 is_stmt 1 view .LVU179
+	.loc 1 122 7 view .LVU180
+	movq	64(%rsp), %rax
+	leaq	.LC14(%rip), %rdi
+	movq	(%rax), %rsi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL62:
+	.loc 1 123 7 view .LVU181
+	.loc 1 124 7 view .LVU182
+	.loc 1 123 19 is_stmt 0 view .LVU183
+	movl	$1, 36(%rsp)
+.LVL63:
+.L33:
+	.loc 1 123 19 view .LVU184
+.LBE24:
+	.loc 1 102 35 is_stmt 1 discriminator 2 view .LVU185
+	.loc 1 102 21 discriminator 2 view .LVU186
+	addq	$4, 72(%rsp)
+.LVL64:
+	.loc 1 102 21 is_stmt 0 discriminator 2 view .LVU187
+	movq	48(%rsp), %rcx
+	addq	$8, 64(%rsp)
+	movq	72(%rsp), %rax
+	cmpq	%rcx, %rax
+	jne	.L32
+.LBE26:
+	.loc 1 129 3 view .LVU188
+	movl	32(%rsp), %edi
+	call	st_scan_set_isa@PLT
+.LVL65:
+	.loc 1 130 3 is_stmt 1 view .LVU189
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL66:
+	.loc 1 132 3 view .LVU190
+	.loc 1 133 1 is_stmt 0 view .LVU191
+	movl	36(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL67:
+	.loc 1 133 1 view .LVU192
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+.LVL68:
+	.loc 1 133 1 view .LVU193
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL69:
+	.loc 1 133 1 view .LVU194
+	ret
+.LVL70:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.cfi_restore_state
+.LBB27:
+.LBB25:
+.LBB23:
+.LBB20:
+.LBB18:
+	.loc 1 117 49 discriminator 1 view .LVU195
+	movq	(%rax), %rdi
+	leaq	0(,%rbx,8), %rdx
+	movq	%r14, %rsi
+	call	memcmp@PLT
+.LVL71:
+	.loc 1 117 49 discriminator 1 view .LVU196
+.LBE18:
+.LBE20:
+	.loc 1 109 72 discriminator 1 view .LVU197
+	incq	%r12
+.LBB21:
+	.loc 1 119 7 discriminator 1 view .LVU198
+	movq	%r15, %rdi
+.LBB19:
+	.loc 1 117 49 discriminator 1 view .LVU199
+	movl	%eax, %ebx
+.LVL72:
+	.loc 1 117 49 discriminator 1 view .LVU200
+.LBE19:
+	.loc 1 119 7 is_stmt 1 discriminator 1 view .LVU201
+	call	st_destroy@PLT
+.LVL73:
+	.loc 1 119 7 is_stmt 0 discriminator 1 view .LVU202
+.LBE21:
+	.loc 1 109 72 is_stmt 1 discriminator 1 view .LVU203
+	.loc 1 109 56 discriminator 1 view .LVU204
+	cmpq	%r12, 56(%rsp)
+	jb	.L34
+	testl	%ebx, %ebx
+	je	.L30
+	jmp	.L28
+	.p2align 4,,10
+	.p2align 3
+.L34:
+.LBE23:
+	.loc 1 121 5 view .LVU205
+	.loc 1 121 8 is_stmt 0 view .LVU206
+	testl	%ebx, %ebx
+	jne	.L28
+.LVL74:
+.L26:
+	.loc 1 127 5 is_stmt 1 view .LVU207
+	movq	64(%rsp), %rax
+	movq	24(%rsp), %rdx
+	movq	(%rax), %rsi
+	leaq	.LC13(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL75:
+	jmp	.L33
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	.loc 1 104 7 discriminator 1 view .LVU208
+	movq	64(%rsp), %rax
+	leaq	.LC12(%rip), %rdi
+	movq	(%rax), %rsi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL76:
+	.loc 1 105 7 discriminator 1 view .LVU209
+	jmp	.L33
+.LBE25:
+.LBE27:
+	.cfi_endproc
+.LFE28:
+	.size	run_st_build_structural_index_unit_tests, .-run_st_build_structural_index_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC15:
+	.string	"------------------- st_next_structural(x) -------------------"
+	.align 8
+.LC16:
+	.string	"[Failed] st_build_structural_index() failed."
+	.align 8
+.LC17:
+	.string	"[Passed] st_next_token() lands on the same positions with the index."
+	.align 8
+.LC18:
+	.string	"[Failed] st_next_token() failed: from %zu expected %zu, got %zu.\n"
+	.align 8
+.LC19:
+	.string	"[Failed] st_next_structural() failed: visited %zu of %zu token starts.\n"
+	.align 8
+.LC20:
+	.string	"[Passed] st_next_structural() visited %zu token starts.\n"
+	.text
+	.p2align 4
+	.globl	run_st_next_structural_unit_tests
+	.type	run_st_next_structural_unit_tests, @function
+run_st_next_structural_unit_tests:
+.LFB29:
+	.loc 1 138 41 view -0
+	.cfi_startproc
+	.loc 1 140 3 view .LVU211
+	.loc 1 138 41 is_stmt 0 view .LVU212
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 140 3 view .LVU213
+	leaq	.LC15(%rip), %rdi
+	.loc 1 138 41 view .LVU214
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$9240, %rsp
+	.cfi_def_cfa_offset 9296
+	.loc 1 142 19 view .LVU215
+	leaq	16(%rsp), %rbx
+	.loc 1 140 3 view .LVU216
+	call	puts@PLT
+.LVL77:
+	.loc 1 141 3 is_stmt 1 view .LVU217
+	.loc 1 142 3 view .LVU218
+	.loc 1 142 19 is_stmt 0 view .LVU219
+	movq	%rbx, %rdi
+	call	structural_test_document
+.LVL78:
+	.loc 1 144 18 view .LVU220
+	leaq	1040(%rsp), %r14
+	.loc 1 142 19 view .LVU221
+	movq	%rax, %r12
+.LVL79:
+	.loc 1 143 3 is_stmt 1 view .LVU222
+	.loc 1 144 3 view .LVU223
+	.loc 1 144 18 is_stmt 0 view .LVU224
+	movq	%r14, %rdx
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	structural_test_reference
+.LVL80:
+	.loc 1 145 35 view .LVU225
+	movq	%rbx, %rdi
+	movq	%r12, %rsi
+	.loc 1 144 18 view .LVU226
+	movq	%rax, %r13
+.LVL81:
+	.loc 1 145 3 is_stmt 1 view .LVU227
+	.loc 1 145 35 is_stmt 0 view .LVU228
+	call	st_create_n@PLT
+.LVL82:
+	.loc 1 146 37 view .LVU229
+	movq	%rbx, %rdi
+	movq	%r12, %rsi
+	.loc 1 145 35 view .LVU230
+	movq	%rax, %rbp
+.LVL83:
+	.loc 1 146 3 is_stmt 1 view .LVU231
+	.loc 1 146 37 is_stmt 0 view .LVU232
+	call	st_create_n@PLT
+.LVL84:
+	.loc 1 148 7 view .LVU233
+	movq	%rax, %rdi
+	.loc 1 146 37 view .LVU234
+	movq	%rax, %rbx
+.LVL85:
+	.loc 1 147 3 is_stmt 1 view .LVU235
+	.loc 1 148 3 view .LVU236
+	.loc 1 148 7 is_stmt 0 view .LVU237
+	call	st_build_structural_index@PLT
+.LVL86:
+	.loc 1 148 6 view .LVU238
+	testl	%eax, %eax
+	je	.L78
+.LVL87:
+.LBB28:
+	.loc 1 153 47 is_stmt 1 view .LVU239
+	xorl	%r15d, %r15d
+	testq	%r12, %r12
+	je	.L79
+.LVL88:
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	.loc 1 154 5 view .LVU240
+	.loc 1 154 21 is_stmt 0 view .LVU241
+	movq	%r15, 16(%rbp)
+	.loc 1 155 5 is_stmt 1 view .LVU242
+	.loc 1 155 23 is_stmt 0 view .LVU243
+	movq	%r15, 16(%rbx)
+	.loc 1 156 5 is_stmt 1 view .LVU244
+	movq	%rbp, %rdi
+	call	st_next_token@PLT
+.LVL89:
+	.loc 1 157 5 view .LVU245
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL90:
+	.loc 1 158 5 view .LVU246
+	.loc 1 158 14 is_stmt 0 view .LVU247
+	movq	16(%rbp), %rdx
+	.loc 1 158 35 view .LVU248
+	movq	16(%rbx), %rcx
+	.loc 1 158 8 view .LVU249
+	cmpq	%rcx, %rdx
+	je	.L52
+	.loc 1 159 7 is_stmt 1 view .LVU250
+	movq	%r15, %rsi
+	leaq	.LC18(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL91:
+	.loc 1 160 7 view .LVU251
+	.loc 1 153 86 view .LVU252
+	.loc 1 153 47 view .LVU253
+.L47:
+	.loc 1 153 47 is_stmt 0 view .LVU254
+.LBE28:
+	.loc 1 163 3 is_stmt 1 view .LVU255
+	.loc 1 167 3 view .LVU256
+	.loc 1 168 3 view .LVU257
+	.loc 1 169 37 is_stmt 0 view .LVU258
+	testq	%r13, %r13
+	setne	%dl
+	.loc 1 169 56 view .LVU259
+	testq	%r12, %r12
+	.loc 1 168 21 view .LVU260
+	movq	$0, 16(%rbx)
+	.loc 1 169 3 is_stmt 1 view .LVU261
+	.loc 1 169 56 view .LVU262
+	.loc 1 169 37 is_stmt 0 view .LVU263
+	setne	%al
+	je	.L65
+	movl	$1, 12(%rsp)
+	testb	%dl, %dl
+	je	.L65
+.LVL92:
+.L50:
+	.loc 1 167 10 view .LVU264
+	xorl	%r15d, %r15d
+	.loc 1 169 17 view .LVU265
+	xorl	%eax, %eax
+	jmp	.L54
+.LVL93:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.loc 1 170 5 is_stmt 1 view .LVU266
+	.loc 1 171 5 is_stmt 0 view .LVU267
+	movq	%rbx, %rdi
+	call	st_next_structural@PLT
+.LVL94:
+	.loc 1 169 17 view .LVU268
+	movq	16(%rbx), %rax
+	.loc 1 170 12 view .LVU269
+	incq	%r15
+.LVL95:
+	.loc 1 171 5 is_stmt 1 view .LVU270
+	.loc 1 169 56 view .LVU271
+	.loc 1 169 37 is_stmt 0 view .LVU272
+	cmpq	%r12, %rax
+	jnb	.L64
+	cmpq	%r13, %r15
+	jnb	.L64
+.LVL96:
+.L54:
+	.loc 1 169 56 discriminator 2 view .LVU273
+	cmpq	%rax, (%r14,%r15,8)
+	je	.L56
+	.loc 1 173 6 view .LVU274
+	cmpq	%r15, %r13
+	setne	%dl
+	.loc 1 173 24 view .LVU275
+	cmpq	%rax, %r12
+	setne	%al
+	.loc 1 173 3 is_stmt 1 view .LVU276
+	.loc 1 173 24 is_stmt 0 view .LVU277
+	testb	%dl, %dl
+	je	.L80
+.LVL97:
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	.loc 1 174 5 is_stmt 1 view .LVU278
+	movq	%r13, %rdx
+	movq	%r15, %rsi
+	leaq	.LC19(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL98:
+	.loc 1 175 5 view .LVU279
+	.loc 1 175 17 is_stmt 0 view .LVU280
+	movl	$1, 12(%rsp)
+.LVL99:
+.L59:
+	.loc 1 180 3 is_stmt 1 view .LVU281
+	movq	%rbp, %rdi
+	call	st_destroy@PLT
+.LVL100:
+	.loc 1 181 3 view .LVU282
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL101:
+	.loc 1 182 3 view .LVU283
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL102:
+	.loc 1 184 3 view .LVU284
+	.loc 1 185 1 is_stmt 0 view .LVU285
+	movl	12(%rsp), %eax
+	addq	$9240, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL103:
+	.loc 1 185 1 view .LVU286
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL104:
+	.loc 1 185 1 view .LVU287
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL105:
+	.loc 1 185 1 view .LVU288
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL106:
+	.loc 1 185 1 view .LVU289
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL107:
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	.cfi_restore_state
+.LBB29:
+	.loc 1 153 86 is_stmt 1 discriminator 2 view .LVU290
+	.loc 1 153 86 is_stmt 0 discriminator 2 view .LVU291
+	incq	%r15
+.LVL108:
+	.loc 1 153 47 is_stmt 1 discriminator 2 view .LVU292
+	cmpq	%r15, %r12
+	jne	.L48
+.LBE29:
+	.loc 1 164 5 view .LVU293
+	leaq	.LC17(%rip), %rdi
+	call	puts@PLT
+.LVL109:
+	.loc 1 167 3 view .LVU294
+	.loc 1 168 3 view .LVU295
+	.loc 1 167 10 is_stmt 0 view .LVU296
+	xorl	%r15d, %r15d
+.LVL110:
+	.loc 1 168 21 view .LVU297
+	movq	$0, 16(%rbx)
+	.loc 1 169 3 is_stmt 1 view .LVU298
+	.loc 1 169 56 view .LVU299
+	.loc 1 169 37 is_stmt 0 view .LVU300
+	movl	$0, 12(%rsp)
+	testq	%r13, %r13
+	jne	.L50
+	jmp	.L51
+.LVL111:
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	.loc 1 173 6 view .LVU301
+	cmpq	%r15, %r13
+	setne	%dl
+	.loc 1 173 24 view .LVU302
+	cmpq	%r12, %rax
+	setne	%al
+.LVL112:
+.L49:
+	.loc 1 173 3 is_stmt 1 discriminator 1 view .LVU303
+	.loc 1 173 24 is_stmt 0 discriminator 1 view .LVU304
+	testb	%dl, %dl
+	jne	.L51
+.L80:
+	testb	%al, %al
+	jne	.L51
+	.loc 1 178 5 is_stmt 1 view .LVU305
+	movq	%r15, %rsi
+	leaq	.LC20(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL113:
+	jmp	.L59
+.LVL114:
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.loc 1 149 5 view .LVU306
+	leaq	.LC16(%rip), %rdi
+	call	puts@PLT
+.LVL115:
+	.loc 1 150 5 view .LVU307
+.LBB30:
+	.loc 1 153 47 view .LVU308
+	jmp	.L47
+.LVL116:
+.L65:
+	.loc 1 153 47 is_stmt 0 view .LVU309
+.LBE30:
+	.loc 1 169 37 view .LVU310
+	movl	$1, 12(%rsp)
+	.loc 1 167 10 view .LVU311
+	xorl	%r15d, %r15d
+	jmp	.L49
+.LVL117:
+.L79:
+	.loc 1 164 5 is_stmt 1 view .LVU312
+	leaq	.LC17(%rip), %rdi
+	call	puts@PLT
+.LVL118:
+	.loc 1 167 3 view .LVU313
+	.loc 1 168 3 view .LVU314
+	.loc 1 169 37 is_stmt 0 view .LVU315
+	testq	%r13, %r13
+	setne	%dl
+	.loc 1 168 21 view .LVU316
+	movq	$0, 16(%rbx)
+	.loc 1 169 3 is_stmt 1 view .LVU317
+	.loc 1 169 56 view .LVU318
+	.loc 1 169 37 is_stmt 0 view .LVU319
+	movl	$0, 12(%rsp)
+	.loc 1 169 56 view .LVU320
+	xorl	%eax, %eax
+	jmp	.L49
+	.cfi_endproc
+.LFE29:
+	.size	run_st_next_structural_unit_tests, .-run_st_next_structural_unit_tests
+	.p2align 4
+	.globl	run_structural_index_tests
+	.type	run_structural_index_tests, @function
+run_structural_index_tests:
+.LFB30:
+	.loc 1 190 34 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 192 3 view .LVU322
+	.loc 1 190 34 is_stmt 0 view .LVU323
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 192 7 view .LVU324
+	xorl	%eax, %eax
+	call	run_st_build_structural_index_unit_tests@PLT
+.LVL119:
+	.loc 1 192 6 view .LVU325
+	cmpl	$1, %eax
+	je	.L81
+	.loc 1 196 3 is_stmt 1 view .LVU326
+	.loc 1 196 7 is_stmt 0 view .LVU327
+	xorl	%eax, %eax
+	call	run_st_next_structural_unit_tests@PLT
+.LVL120:
+	.loc 1 196 6 view .LVU328
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+.L81:
+	.loc 1 201 1 view .LVU329
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	run_structural_index_tests, .-run_structural_index_tests
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC0:
+	.quad	2482448102123446907
+	.quad	3615581450027081786
+	.quad	8247252191835141422
+	.quad	7812748569427600757
+	.align 32
+.LC1:
+	.quad	2318347121271382060
+	.quad	9035200768120742178
+	.quad	7791825627286101282
+	.quad	9605583265558127
+	.align 32
+.LC2:
+	.quad	2336361506879513180
+	.quad	8295742012915740265
+	.quad	2475955494450721396
+	.quad	2482741671622746156
+	.align 32
+.LC3:
+	.quad	7018360978994919525
+	.quad	7215339638127686508
+	.quad	6582890714390095205
+	.quad	26277366575496571
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC4:
+	.quad	2478227075603901474
+	.quad	9022174822996713530
+	.align 16
+.LC6:
+	.long	0
+	.long	1
+	.long	2
+	.long	3
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/stdio.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/root/repo/tests/../include/strutils.h"
+	.file 7 "/usr/include/string.h"
+	.file 8 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xc97
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF109
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xb
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x13
+	.long	0x2e
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0xb
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xb
+	.long	.LASF11
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x72
+	.uleb128 0x7
+	.long	0x96
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0x13
+	.long	0x96
+	.uleb128 0xb
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x13
+	.long	0x85
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF14
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF15
+	.uleb128 0x7
+	.long	0xc1
+	.uleb128 0x24
+	.uleb128 0x7
+	.long	0x9d
+	.uleb128 0xb
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0x79
+	.uleb128 0x25
+	.long	.LASF42
+	.byte	0x7
+	.byte	0x4
+	.long	0x46
+	.byte	0x6
+	.byte	0xe7
+	.byte	0x6
+	.long	0xfe
+	.uleb128 0x8
+	.long	.LASF17
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF18
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF19
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF20
+	.byte	0x3
+	.byte	0
+	.uleb128 0x13
+	.long	0xd3
+	.uleb128 0xf
+	.long	.LASF25
+	.byte	0x18
+	.value	0x175
+	.long	0x137
+	.uleb128 0x2
+	.long	.LASF21
+	.value	0x17a
+	.byte	0x1c
+	.long	0x13c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF22
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF23
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF110
+	.uleb128 0x7
+	.long	0x137
+	.uleb128 0x6
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF24
+	.uleb128 0xf
+	.long	.LASF26
+	.byte	0x40
+	.value	0x1e6
+	.long	0x1bd
+	.uleb128 0x2
+	.long	.LASF27
+	.value	0x1eb
+	.byte	0xc
+	.long	0xc7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF28
+	.value	0x1f0
+	.byte	0xc
+	.long	0xc7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF29
+	.value	0x1f5
+	.byte	0xc
+	.long	0xc7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF30
+	.value	0x1fa
+	.byte	0xc
+	.long	0xc7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF31
+	.value	0x1ff
+	.byte	0xc
+	.long	0xc7
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF32
+	.value	0x204
+	.byte	0xc
+	.long	0xc7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF33
+	.value	0x209
+	.byte	0xc
+	.long	0xc7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF34
+	.value	0x20e
+	.byte	0xc
+	.long	0xc7
+	.byte	0x38
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF35
+	.byte	0x38
+	.value	0x26c
+	.long	0x22f
+	.uleb128 0x2
+	.long	.LASF36
+	.value	0x272
+	.byte	0xd
+	.long	0x248
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF37
+	.value	0x277
+	.byte	0x9
+	.long	0x4d
+	.byte	0x8
+	.uleb128 0x1a
+	.string	"fd"
+	.value	0x27c
+	.long	0x6b
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF38
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF39
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF40
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x1a
+	.string	"eof"
+	.value	0x290
+	.long	0x6b
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF41
+	.value	0x295
+	.byte	0x7
+	.long	0x6b
+	.byte	0x34
+	.byte	0
+	.uleb128 0x27
+	.long	0xa2
+	.long	0x248
+	.uleb128 0x5
+	.long	0x4d
+	.uleb128 0x5
+	.long	0x91
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	0x22f
+	.uleb128 0x1b
+	.long	.LASF43
+	.long	0x46
+	.value	0x29b
+	.long	0x269
+	.uleb128 0x8
+	.long	.LASF44
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF45
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF46
+	.long	0x46
+	.value	0x2b5
+	.long	0x291
+	.uleb128 0x8
+	.long	.LASF47
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF48
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF49
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF50
+	.byte	0x3
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF51
+	.value	0x158
+	.byte	0x6
+	.value	0x2cf
+	.byte	0x8
+	.long	0x33f
+	.uleb128 0x2
+	.long	.LASF52
+	.value	0x2d4
+	.byte	0x9
+	.long	0x91
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF53
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF54
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF55
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF56
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x24d
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF57
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF58
+	.value	0x2f2
+	.byte	0x18
+	.long	0x33f
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF59
+	.value	0x2f7
+	.byte	0x18
+	.long	0x269
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF60
+	.value	0x2fc
+	.byte	0x17
+	.long	0x344
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF61
+	.value	0x301
+	.byte	0x8
+	.long	0x349
+	.byte	0x48
+	.uleb128 0x1c
+	.long	.LASF62
+	.value	0x306
+	.byte	0x21
+	.long	0x3a7
+	.value	0x148
+	.uleb128 0x1c
+	.long	.LASF63
+	.value	0x30b
+	.byte	0x17
+	.long	0x3ac
+	.value	0x150
+	.byte	0
+	.uleb128 0x7
+	.long	0x1bd
+	.uleb128 0x7
+	.long	0x103
+	.uleb128 0xc
+	.long	0x96
+	.long	0x359
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF64
+	.byte	0x28
+	.value	0x764
+	.long	0x3a7
+	.uleb128 0x2
+	.long	.LASF65
+	.value	0x769
+	.byte	0xb
+	.long	0x3b8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF66
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF67
+	.value	0x774
+	.byte	0xd
+	.long	0x3bd
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF53
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF68
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0x359
+	.uleb128 0x7
+	.long	0x148
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF69
+	.uleb128 0x7
+	.long	0x2e
+	.uleb128 0x7
+	.long	0xc7
+	.uleb128 0x7
+	.long	0x291
+	.uleb128 0x15
+	.long	.LASF70
+	.value	0x7bf
+	.long	0x3d8
+	.uleb128 0x5
+	.long	0x3c2
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF71
+	.value	0x40b
+	.long	0x3e9
+	.uleb128 0x5
+	.long	0x3c2
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF72
+	.byte	0xf6
+	.byte	0xe
+	.long	0x91
+	.long	0x403
+	.uleb128 0x5
+	.long	0xc2
+	.uleb128 0x5
+	.long	0x6b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF73
+	.byte	0x4
+	.value	0x166
+	.byte	0xc
+	.long	0x6b
+	.long	0x420
+	.uleb128 0x5
+	.long	0x91
+	.uleb128 0x5
+	.long	0xc2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF74
+	.value	0x403
+	.long	0x431
+	.uleb128 0x5
+	.long	0x3c2
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF75
+	.byte	0x40
+	.byte	0xc
+	.long	0x6b
+	.long	0x450
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF76
+	.byte	0x6
+	.value	0x78f
+	.byte	0x5
+	.long	0x6b
+	.long	0x467
+	.uleb128 0x5
+	.long	0x3c2
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF77
+	.byte	0x6
+	.value	0x326
+	.byte	0x19
+	.long	0x3c2
+	.long	0x483
+	.uleb128 0x5
+	.long	0x91
+	.uleb128 0x5
+	.long	0x3a
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF78
+	.byte	0x4
+	.value	0x164
+	.byte	0xc
+	.long	0x6b
+	.long	0x49b
+	.uleb128 0x5
+	.long	0xc2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF79
+	.byte	0x6
+	.value	0x105
+	.byte	0x5
+	.long	0x6b
+	.long	0x4b2
+	.uleb128 0x5
+	.long	0xfe
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF80
+	.byte	0x6
+	.value	0x10d
+	.byte	0x14
+	.long	0xd3
+	.long	0x4c5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF81
+	.byte	0xbe
+	.long	0x6b
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x500
+	.uleb128 0x10
+	.quad	.LVL119
+	.long	0x7f6
+	.uleb128 0x10
+	.quad	.LVL120
+	.long	0x500
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF82
+	.byte	0x8a
+	.long	0x6b
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7d8
+	.uleb128 0xa
+	.long	.LASF52
+	.byte	0x8d
+	.byte	0x8
+	.long	0x7d8
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -9280
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0x8e
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0xa
+	.long	.LASF83
+	.byte	0x8f
+	.byte	0xa
+	.long	0x7e7
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8256
+	.uleb128 0x4
+	.long	.LASF66
+	.byte	0x90
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x4
+	.long	.LASF84
+	.byte	0x91
+	.byte	0x1b
+	.long	0x3c2
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x4
+	.long	.LASF85
+	.byte	0x92
+	.byte	0x1b
+	.long	0x3c2
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0x93
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x4
+	.long	.LASF87
+	.byte	0xa7
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xe
+	.long	.LLRL36
+	.long	0x620
+	.uleb128 0x4
+	.long	.LASF54
+	.byte	0x99
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x3
+	.quad	.LVL89
+	.long	0x3d8
+	.long	0x5e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL90
+	.long	0x3d8
+	.long	0x5fe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL91
+	.long	0x483
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL77
+	.long	0xc7f
+	.long	0x63f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL78
+	.long	0xc12
+	.long	0x657
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL80
+	.long	0xb15
+	.long	0x67b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL82
+	.long	0x467
+	.long	0x699
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL84
+	.long	0x467
+	.long	0x6b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL86
+	.long	0x450
+	.long	0x6cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL94
+	.long	0x3c7
+	.long	0x6e7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL98
+	.long	0x483
+	.long	0x712
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL100
+	.long	0x420
+	.long	0x72a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL101
+	.long	0x420
+	.long	0x742
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL102
+	.long	0xc88
+	.long	0x759
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL109
+	.long	0xc7f
+	.long	0x778
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL113
+	.long	0x483
+	.long	0x79d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL115
+	.long	0xc7f
+	.long	0x7bc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL118
+	.long	0xc7f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x96
+	.long	0x7e7
+	.uleb128 0x1e
+	.long	0x3f
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e
+	.long	0x7f6
+	.uleb128 0x1e
+	.long	0x3f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF88
+	.byte	0x56
+	.long	0x6b
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xaf5
+	.uleb128 0xa
+	.long	.LASF89
+	.byte	0x58
+	.byte	0x16
+	.long	0xaf5
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.uleb128 0xa
+	.long	.LASF90
+	.byte	0x59
+	.byte	0xf
+	.long	0xb05
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0x2a
+	.long	.LASF91
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x7
+	.long	0x6b
+	.byte	0x4
+	.uleb128 0xa
+	.long	.LASF52
+	.byte	0x5f
+	.byte	0x8
+	.long	0x7d8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0x60
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xa
+	.long	.LASF83
+	.byte	0x61
+	.byte	0xa
+	.long	0x7e7
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1152
+	.uleb128 0x4
+	.long	.LASF66
+	.byte	0x62
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0x64
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x4
+	.long	.LASF92
+	.byte	0x65
+	.byte	0x16
+	.long	0xd3
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xe
+	.long	.LLRL19
+	.long	0xa54
+	.uleb128 0x18
+	.string	"i"
+	.byte	0x66
+	.byte	0xc
+	.long	0x6b
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x11
+	.long	.LLRL21
+	.uleb128 0x4
+	.long	.LASF93
+	.byte	0x6c
+	.byte	0x9
+	.long	0x6b
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xe
+	.long	.LLRL23
+	.long	0x9e5
+	.uleb128 0x4
+	.long	.LASF94
+	.byte	0x6d
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x11
+	.long	.LLRL25
+	.uleb128 0x4
+	.long	.LASF95
+	.byte	0x6e
+	.byte	0x1f
+	.long	0x3c2
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x4
+	.long	.LASF96
+	.byte	0x6f
+	.byte	0xe
+	.long	0x2e
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xe
+	.long	.LLRL28
+	.long	0x95d
+	.uleb128 0x4
+	.long	.LASF97
+	.byte	0x74
+	.byte	0x27
+	.long	0x3a7
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x9
+	.quad	.LVL71
+	.long	0xc91
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL54
+	.long	0x467
+	.long	0x97b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL56
+	.long	0xb15
+	.long	0x99f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL58
+	.long	0x450
+	.long	0x9b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL61
+	.long	0x420
+	.long	0x9cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL73
+	.long	0x420
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL51
+	.long	0x49b
+	.uleb128 0x3
+	.quad	.LVL62
+	.long	0x483
+	.long	0xa11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL75
+	.long	0x483
+	.long	0xa37
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL76
+	.long	0x483
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL40
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL41
+	.long	0xc7f
+	.long	0xa7e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL42
+	.long	0xc12
+	.long	0xa96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL44
+	.long	0xb15
+	.long	0xaba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL47
+	.long	0x4b2
+	.uleb128 0x3
+	.quad	.LVL65
+	.long	0x49b
+	.long	0xae1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 32
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL66
+	.long	0xc88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0xd3
+	.long	0xb05
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	0xc2
+	.long	0xb15
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF101
+	.byte	0x2f
+	.long	0x2e
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc12
+	.uleb128 0x12
+	.long	.LASF52
+	.byte	0x2f
+	.byte	0x35
+	.long	0xc2
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x12
+	.long	.LASF53
+	.byte	0x2f
+	.byte	0x4a
+	.long	0x3a
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x12
+	.long	.LASF65
+	.byte	0x2f
+	.byte	0x5a
+	.long	0x3b8
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x4
+	.long	.LASF66
+	.byte	0x30
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x4
+	.long	.LASF67
+	.byte	0x31
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x4
+	.long	.LASF98
+	.byte	0x32
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x4
+	.long	.LASF99
+	.byte	0x33
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x11
+	.long	.LLRL11
+	.uleb128 0x18
+	.string	"i"
+	.byte	0x34
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x11
+	.long	.LLRL13
+	.uleb128 0x4
+	.long	.LASF100
+	.byte	0x35
+	.byte	0xa
+	.long	0x96
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x9
+	.quad	.LVL13
+	.long	0x3e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF102
+	.byte	0x11
+	.long	0x2e
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc7f
+	.uleb128 0x12
+	.long	.LASF103
+	.byte	0x11
+	.byte	0x2e
+	.long	0x91
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0x12
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xe
+	.long	.LLRL2
+	.long	0xc73
+	.uleb128 0x18
+	.string	"i"
+	.byte	0x1b
+	.byte	0xc
+	.long	0x6b
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL10
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF104
+	.long	.LASF106
+	.uleb128 0x19
+	.long	.LASF105
+	.long	.LASF107
+	.uleb128 0x19
+	.long	.LASF75
+	.long	.LASF108
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 1023
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS30:
+	.uleb128 .LVU222
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU288
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL80-1-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU227
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU289
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU231
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU287
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL84-1-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU235
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU286
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU236
+	.uleb128 .LVU252
+	.uleb128 .LVU252
+	.uleb128 .LVU264
+	.uleb128 .LVU280
+	.uleb128 .LVU281
+	.uleb128 .LVU281
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU301
+	.uleb128 .LVU306
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -9284
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU257
+	.uleb128 .LVU266
+	.uleb128 .LVU266
+	.uleb128 .LVU278
+	.uleb128 .LVU295
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU303
+	.uleb128 .LVU309
+	.uleb128 .LVU312
+	.uleb128 .LVU314
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU239
+	.uleb128 .LVU240
+	.uleb128 .LVU291
+	.uleb128 .LVU292
+	.uleb128 .LVU292
+	.uleb128 .LVU297
+	.uleb128 .LVU308
+	.uleb128 .LVU309
+	.uleb128 .LVU312
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU138
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL44-1-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 56
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1096
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2448
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2448
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 56
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU142
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1128
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2468
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2468
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU143
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1116
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x245c
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x245c
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU146
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1120
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2460
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2460
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU148
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU187
+	.uleb128 .LVU195
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0xd
+	.byte	0x77
+	.sleb128 72
+	.byte	0x6
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x50
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0xf
+	.byte	0x77
+	.sleb128 72
+	.byte	0x6
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x50
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0xd
+	.byte	0x77
+	.sleb128 72
+	.byte	0x6
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x50
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU157
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU178
+	.uleb128 .LVU195
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU207
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-1-.Ltext0
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-1-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x7
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU184
+	.uleb128 .LVU195
+	.uleb128 .LVU207
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU167
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU178
+	.uleb128 .LVU195
+	.uleb128 .LVU200
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU172
+	.uleb128 .LVU174
+	.uleb128 .LVU195
+	.uleb128 .LVU196
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU41
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU42
+	.uleb128 .LVU66
+	.uleb128 .LVU68
+	.uleb128 .LVU85
+	.uleb128 .LVU87
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+	.uleb128 .LVU96
+	.uleb128 .LVU97
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU43
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU44
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU63
+	.uleb128 .LVU67
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+	.uleb128 .LVU104
+	.uleb128 .LVU106
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU109
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU46
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x7
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x7
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0x33
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU55
+	.uleb128 .LVU72
+	.uleb128 .LVU74
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+	.uleb128 .LVU111
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU2
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU8
+	.uleb128 .LVU9
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 59
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU22
+	.uleb128 .LVU26
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF93:
+	.string	"valid"
+.LASF100:
+	.string	"token"
+.LASF54:
+	.string	"position"
+.LASF106:
+	.string	"__builtin_puts"
+.LASF22:
+	.string	"block_size"
+.LASF50:
+	.string	"ST_STRING_INLINE"
+.LASF86:
+	.string	"exit_status"
+.LASF16:
+	.string	"uint64_t"
+.LASF7:
+	.string	"short int"
+.LASF9:
+	.string	"size_t"
+.LASF74:
+	.string	"st_destroy"
+.LASF48:
+	.string	"ST_STRING_OWNED"
+.LASF65:
+	.string	"positions"
+.LASF105:
+	.string	"putchar"
+.LASF63:
+	.string	"stats"
+.LASF101:
+	.string	"structural_test_reference"
+.LASF28:
+	.string	"tokens_extracted"
+.LASF13:
+	.string	"ssize_t"
+.LASF108:
+	.string	"__builtin_memcmp"
+.LASF42:
+	.string	"StringScanIsa"
+.LASF59:
+	.string	"ownership"
+.LASF33:
+	.string	"conversions"
+.LASF21:
+	.string	"head"
+.LASF97:
+	.string	"index"
+.LASF20:
+	.string	"ST_SCAN_AVX512"
+.LASF80:
+	.string	"st_scan_isa"
+.LASF83:
+	.string	"expected"
+.LASF18:
+	.string	"ST_SCAN_SSE2"
+.LASF49:
+	.string	"ST_STRING_MAPPED"
+.LASF25:
+	.string	"StringArena"
+.LASF70:
+	.string	"st_next_structural"
+.LASF87:
+	.string	"visited"
+.LASF68:
+	.string	"hint"
+.LASF53:
+	.string	"length"
+.LASF19:
+	.string	"ST_SCAN_AVX2"
+.LASF75:
+	.string	"memcmp"
+.LASF14:
+	.string	"long long int"
+.LASF11:
+	.string	"__ssize_t"
+.LASF8:
+	.string	"long int"
+.LASF52:
+	.string	"string"
+.LASF95:
+	.string	"tokenizer"
+.LASF40:
+	.string	"offset"
+.LASF62:
+	.string	"structural_index"
+.LASF94:
+	.string	"prefix"
+.LASF90:
+	.string	"isa_names"
+.LASF17:
+	.string	"ST_SCAN_SCALAR"
+.LASF57:
+	.string	"max_increment"
+.LASF55:
+	.string	"incremental_factor"
+.LASF85:
+	.string	"indexed"
+.LASF47:
+	.string	"ST_STRING_BORROWED"
+.LASF43:
+	.string	"StringGrowthPolicy"
+.LASF30:
+	.string	"reallocations"
+.LASF24:
+	.string	"long double"
+.LASF92:
+	.string	"original_isa"
+.LASF88:
+	.string	"run_st_build_structural_index_unit_tests"
+.LASF4:
+	.string	"unsigned char"
+.LASF72:
+	.string	"strchr"
+.LASF36:
+	.string	"read"
+.LASF45:
+	.string	"ST_GROWTH_LINEAR"
+.LASF39:
+	.string	"capacity"
+.LASF15:
+	.string	"long long unsigned int"
+.LASF73:
+	.string	"sprintf"
+.LASF84:
+	.string	"plain"
+.LASF3:
+	.string	"unsigned int"
+.LASF37:
+	.string	"context"
+.LASF104:
+	.string	"puts"
+.LASF5:
+	.string	"short unsigned int"
+.LASF12:
+	.string	"char"
+.LASF96:
+	.string	"prefix_count"
+.LASF78:
+	.string	"printf"
+.LASF60:
+	.string	"arena"
+.LASF102:
+	.string	"structural_test_document"
+.LASF71:
+	.string	"st_next_token"
+.LASF107:
+	.string	"__builtin_putchar"
+.LASF10:
+	.string	"__uint64_t"
+.LASF103:
+	.string	"buffer"
+.LASF91:
+	.string	"num_tests"
+.LASF26:
+	.string	"StringStats"
+.LASF2:
+	.string	"long unsigned int"
+.LASF61:
+	.string	"inline_buffer"
+.LASF69:
+	.string	"double"
+.LASF64:
+	.string	"StringStructuralIndex"
+.LASF109:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF98:
+	.string	"escaped"
+.LASF32:
+	.string	"bytes_copied"
+.LASF67:
+	.string	"in_string"
+.LASF66:
+	.string	"count"
+.LASF81:
+	.string	"run_structural_index_tests"
+.LASF38:
+	.string	"chunk_size"
+.LASF6:
+	.string	"signed char"
+.LASF82:
+	.string	"run_st_next_structural_unit_tests"
+.LASF46:
+	.string	"StringOwnership"
+.LASF34:
+	.string	"conversion_ns"
+.LASF23:
+	.string	"used"
+.LASF44:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF99:
+	.string	"in_scalar"
+.LASF41:
+	.string	"error"
+.LASF77:
+	.string	"st_create_n"
+.LASF51:
+	.string	"StringTokenizer"
+.LASF79:
+	.string	"st_scan_set_isa"
+.LASF27:
+	.string	"bytes_scanned"
+.LASF56:
+	.string	"growth_policy"
+.LASF58:
+	.string	"stream"
+.LASF110:
+	.string	"StringArenaBlock"
+.LASF35:
+	.string	"StringStream"
+.LASF76:
+	.string	"st_build_structural_index"
+.LASF31:
+	.string	"expansions"
+.LASF29:
+	.string	"allocations"
+.LASF89:
+	.string	"isa_values"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test-stats"
+.LASF0:
+	.string	"/root/repo/tests/structural_index_unit_tests.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
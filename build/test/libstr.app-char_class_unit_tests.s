@@ -0,0 +1,3768 @@
+	.file	"char_class_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/tests/char_class_unit_tests.c"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"------------------- is_numeric(x) -------------------"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"+-.eE"
+	.section	.rodata.str1.8
+	.align 8
+.LC2:
+	.string	"[Failed] is_numeric(%d) failed: expected %d.\n"
+	.align 8
+.LC3:
+	.string	"[Passed] is_numeric() classifies the 256 byte values."
+	.text
+	.p2align 4
+	.globl	run_is_numeric_unit_tests
+	.type	run_is_numeric_unit_tests, @function
+run_is_numeric_unit_tests:
+.LFB26:
+	.file 1 "/root/repo/tests/char_class_unit_tests.c"
+	.loc 1 11 33 view -0
+	.cfi_startproc
+	.loc 1 13 3 view .LVU1
+	.loc 1 11 33 is_stmt 0 view .LVU2
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 13 3 view .LVU3
+	leaq	.LC0(%rip), %rdi
+.LBB32:
+.LBB33:
+	.loc 1 22 7 view .LVU4
+	leaq	.LC2(%rip), %r15
+.LBE33:
+.LBE32:
+	.loc 1 11 33 view .LVU5
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	.loc 1 14 7 view .LVU6
+	xorl	%r14d, %r14d
+	.loc 1 11 33 view .LVU7
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+.LBB44:
+.LBB40:
+	.loc 1 17 54 view .LVU8
+	leaq	.LC1(%rip), %r12
+.LBE40:
+.LBE44:
+	.loc 1 11 33 view .LVU9
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+.LBB45:
+.LBB41:
+	.loc 1 19 16 view .LVU10
+	xorl	%ebp, %ebp
+.LBE41:
+.LBE45:
+	.loc 1 11 33 view .LVU11
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	.loc 1 13 3 view .LVU12
+	xorl	%ebx, %ebx
+	.loc 1 11 33 view .LVU13
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 13 3 view .LVU14
+	call	puts@PLT
+.LVL0:
+	.loc 1 14 3 is_stmt 1 view .LVU15
+	.loc 1 15 3 view .LVU16
+.LBB46:
+	.loc 1 15 8 view .LVU17
+	.loc 1 15 21 view .LVU18
+	movq	st_char_classes@GOTPCREL(%rip), %r13
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+.LBB42:
+	.loc 1 16 5 view .LVU19
+	.loc 1 17 5 view .LVU20
+	.loc 1 17 51 is_stmt 0 view .LVU21
+	leal	-48(%rbx), %eax
+	cmpb	$9, %al
+	jbe	.L7
+	.loc 1 17 54 discriminator 2 view .LVU22
+	movsbl	%bl, %esi
+	movq	%r12, %rdi
+	call	strchr@PLT
+.LVL2:
+	.loc 1 17 51 discriminator 2 view .LVU23
+	xorl	%edx, %edx
+	testq	%rax, %rax
+	setne	%dl
+.L2:
+.LVL3:
+	.loc 1 18 5 is_stmt 1 discriminator 6 view .LVU24
+.LBB34:
+.LBB35:
+.LBB36:
+	.file 2 "/root/repo/tests/../include/strutils.h"
+	.loc 2 203 60 is_stmt 0 discriminator 6 view .LVU25
+	movzbl	(%rbx,%r13), %eax
+.LBE36:
+.LBE35:
+.LBE34:
+	.loc 1 19 16 discriminator 6 view .LVU26
+	testb	%bl, %bl
+	cmove	%ebp, %edx
+.LVL4:
+	.loc 1 21 5 is_stmt 1 discriminator 6 view .LVU27
+.LBB39:
+.LBI34:
+	.loc 2 1473 19 discriminator 6 view .LVU28
+	.loc 2 1474 3 discriminator 6 view .LVU29
+.LBB38:
+.LBI35:
+	.loc 2 202 19 discriminator 6 view .LVU30
+.LBB37:
+	.loc 2 203 3 discriminator 6 view .LVU31
+	.loc 2 203 60 is_stmt 0 discriminator 6 view .LVU32
+	shrb	$2, %al
+	andl	$1, %eax
+.LBE37:
+.LBE38:
+.LBE39:
+	.loc 1 21 8 discriminator 6 view .LVU33
+	cmpl	%eax, %edx
+	je	.L4
+	.loc 1 22 7 is_stmt 1 view .LVU34
+	movl	%ebx, %esi
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL5:
+	.loc 1 23 7 view .LVU35
+	.loc 1 23 19 is_stmt 0 view .LVU36
+	movl	$1, %r14d
+.LVL6:
+.L4:
+	.loc 1 23 19 view .LVU37
+.LBE42:
+	.loc 1 15 29 is_stmt 1 discriminator 2 view .LVU38
+	.loc 1 15 21 discriminator 2 view .LVU39
+	incq	%rbx
+.LVL7:
+	.loc 1 15 21 is_stmt 0 discriminator 2 view .LVU40
+	cmpq	$256, %rbx
+	jne	.L5
+.LBE46:
+	.loc 1 26 3 is_stmt 1 view .LVU41
+	.loc 1 26 6 is_stmt 0 view .LVU42
+	testl	%r14d, %r14d
+	je	.L12
+.L6:
+	.loc 1 29 3 is_stmt 1 view .LVU43
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL8:
+	.loc 1 31 3 view .LVU44
+	.loc 1 32 1 is_stmt 0 view .LVU45
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	movl	%r14d, %eax
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL9:
+	.loc 1 32 1 view .LVU46
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL10:
+.L12:
+	.cfi_restore_state
+	.loc 1 27 5 is_stmt 1 view .LVU47
+	leaq	.LC3(%rip), %rdi
+	call	puts@PLT
+.LVL11:
+	jmp	.L6
+.LVL12:
+.L7:
+.LBB47:
+.LBB43:
+	.loc 1 17 51 is_stmt 0 view .LVU48
+	movl	$1, %edx
+	jmp	.L2
+.LBE43:
+.LBE47:
+	.cfi_endproc
+.LFE26:
+	.size	run_is_numeric_unit_tests, .-run_is_numeric_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC4:
+	.string	"------------------- st_char_classes[x] -------------------"
+	.section	.rodata.str1.1
+.LC5:
+	.string	"{}[]:,"
+	.section	.rodata.str1.8
+	.align 8
+.LC6:
+	.string	"[Failed] st_char_classes[%d] failed: expected 0x%02X, got 0x%02X.\n"
+	.align 8
+.LC7:
+	.string	"[Passed] st_char_classes[] classifies the 256 byte values."
+	.align 8
+.LC8:
+	.string	"[Failed] st_char_is() failed to combine the classes."
+	.align 8
+.LC9:
+	.string	"[Passed] st_char_is() combines the classes."
+	.text
+	.p2align 4
+	.globl	run_st_char_classes_unit_tests
+	.type	run_st_char_classes_unit_tests, @function
+run_st_char_classes_unit_tests:
+.LFB27:
+	.loc 1 37 38 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 39 3 view .LVU50
+	.loc 1 37 38 is_stmt 0 view .LVU51
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 39 3 view .LVU52
+	leaq	.LC4(%rip), %rdi
+	xorl	%r15d, %r15d
+	.loc 1 37 38 view .LVU53
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 39 3 view .LVU54
+	call	puts@PLT
+.LVL13:
+	.loc 1 40 3 is_stmt 1 view .LVU55
+	.loc 1 41 3 view .LVU56
+.LBB48:
+	.loc 1 41 8 view .LVU57
+	.loc 1 41 21 view .LVU58
+.LBE48:
+	.loc 1 40 7 is_stmt 0 view .LVU59
+	movl	$0, 12(%rsp)
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L19:
+.LBB60:
+.LBB49:
+	.loc 1 44 56 view .LVU60
+	movl	%r15d, %eax
+	andl	$-33, %eax
+	subl	$65, %eax
+	cmpl	$25, %eax
+	.loc 1 47 43 view .LVU61
+	leal	-48(%r15), %ecx
+	.loc 1 44 56 view .LVU62
+	setbe	%r14b
+	.loc 1 47 43 view .LVU63
+	cmpl	$9, %ecx
+.LBB50:
+.LBB51:
+.LBB52:
+	.loc 2 203 26 view .LVU64
+	movq	st_char_classes@GOTPCREL(%rip), %rcx
+.LBE52:
+.LBE51:
+.LBE50:
+	.loc 1 47 43 view .LVU65
+	setbe	%dil
+.LBB57:
+.LBB55:
+.LBB53:
+	.loc 2 203 26 view .LVU66
+	movzbl	(%rcx,%r15), %r13d
+.LBE53:
+.LBE55:
+.LBE57:
+	.loc 1 47 43 view .LVU67
+	movzbl	%dil, %esi
+	.loc 1 48 54 view .LVU68
+	movl	%r13d, %ebx
+	shrb	$2, %bl
+	andl	$1, %ebx
+	.loc 1 47 43 view .LVU69
+	addl	%esi, %esi
+	.loc 1 48 54 view .LVU70
+	sall	$2, %ebx
+	.loc 1 48 14 view .LVU71
+	orl	%esi, %ebx
+	.loc 1 46 48 view .LVU72
+	xorl	%esi, %esi
+	cmpl	$32, %r15d
+	setle	%sil
+	movl	%r15d, %ebp
+.LVL15:
+	.loc 1 42 5 is_stmt 1 view .LVU73
+	.loc 1 43 5 view .LVU74
+	.loc 1 44 5 view .LVU75
+	.loc 1 45 5 view .LVU76
+	.loc 1 46 5 view .LVU77
+	movl	%r15d, %r12d
+.LVL16:
+	.loc 1 47 5 view .LVU78
+	.loc 1 48 5 view .LVU79
+.LBB58:
+.LBI50:
+	.loc 2 1473 19 view .LVU80
+	.loc 2 1474 3 view .LVU81
+.LBB56:
+.LBI51:
+	.loc 2 202 19 view .LVU82
+.LBB54:
+	.loc 2 203 3 view .LVU83
+	.loc 2 203 3 is_stmt 0 view .LVU84
+.LBE54:
+.LBE56:
+.LBE58:
+	.loc 1 48 14 view .LVU85
+	orl	%esi, %ebx
+.LVL17:
+	.loc 1 49 5 is_stmt 1 view .LVU86
+	.loc 1 49 52 is_stmt 0 view .LVU87
+	cmpl	$5, %eax
+	jbe	.L25
+	testb	%dil, %dil
+	jne	.L25
+	.loc 1 50 5 is_stmt 1 discriminator 8 view .LVU88
+	.loc 1 51 68 is_stmt 0 discriminator 8 view .LVU89
+	movl	$32, %eax
+	.loc 1 50 80 discriminator 8 view .LVU90
+	testq	%r15, %r15
+	je	.L17
+.L16:
+	.loc 1 48 17 discriminator 1 view .LVU91
+	movsbl	%r15b, %esi
+	.loc 1 50 27 discriminator 1 view .LVU92
+	leaq	.LC5(%rip), %rdi
+	call	strchr@PLT
+.LVL18:
+	.loc 1 50 24 discriminator 1 view .LVU93
+	testq	%rax, %rax
+	setne	%al
+	movzbl	%al, %eax
+	sall	$4, %eax
+	.loc 1 50 14 discriminator 1 view .LVU94
+	orl	%eax, %ebx
+.LVL19:
+	.loc 1 51 5 is_stmt 1 discriminator 1 view .LVU95
+	.loc 1 51 19 is_stmt 0 discriminator 1 view .LVU96
+	cmpl	$31, %r12d
+	setle	%al
+	.loc 1 51 30 discriminator 1 view .LVU97
+	cmpl	$34, %r12d
+	sete	%sil
+	.loc 1 51 25 discriminator 1 view .LVU98
+	orl	%esi, %eax
+	.loc 1 51 37 discriminator 1 view .LVU99
+	cmpl	$92, %r12d
+	sete	%sil
+	orl	%esi, %eax
+	movzbl	%al, %eax
+	sall	$5, %eax
+.L17:
+.LVL20:
+	.loc 1 52 43 discriminator 6 view .LVU100
+	movzbl	%r14b, %edx
+	.loc 1 51 14 discriminator 6 view .LVU101
+	orl	%ebx, %eax
+.LVL21:
+	.loc 1 52 5 is_stmt 1 discriminator 6 view .LVU102
+	.loc 1 52 43 is_stmt 0 discriminator 6 view .LVU103
+	sall	$6, %edx
+	.loc 1 52 14 discriminator 6 view .LVU104
+	orl	%eax, %edx
+.LVL22:
+	.loc 1 53 5 is_stmt 1 discriminator 6 view .LVU105
+	.loc 1 53 24 is_stmt 0 discriminator 6 view .LVU106
+	movzbl	%r13b, %eax
+	.loc 1 53 8 discriminator 6 view .LVU107
+	cmpl	%edx, %eax
+	je	.L18
+	.loc 1 54 7 is_stmt 1 view .LVU108
+	movzbl	%r13b, %ecx
+	movl	%ebp, %esi
+	leaq	.LC6(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL23:
+	.loc 1 55 7 view .LVU109
+	.loc 1 55 19 is_stmt 0 view .LVU110
+	movl	$1, 12(%rsp)
+.LVL24:
+.L18:
+	.loc 1 55 19 view .LVU111
+.LBE49:
+	.loc 1 41 29 is_stmt 1 discriminator 2 view .LVU112
+	.loc 1 41 21 discriminator 2 view .LVU113
+	incq	%r15
+.LVL25:
+	.loc 1 41 21 is_stmt 0 discriminator 2 view .LVU114
+	cmpq	$256, %r15
+	jne	.L19
+.LBE60:
+	.loc 1 58 3 is_stmt 1 view .LVU115
+	.loc 1 58 6 is_stmt 0 view .LVU116
+	movl	12(%rsp), %eax
+	testl	%eax, %eax
+	je	.L35
+.L20:
+	.loc 1 62 3 is_stmt 1 view .LVU117
+.LVL26:
+.LBB61:
+.LBI61:
+	.loc 2 202 19 view .LVU118
+.LBB62:
+	.loc 2 203 3 view .LVU119
+	.loc 2 203 3 is_stmt 0 view .LVU120
+.LBE62:
+.LBE61:
+	.loc 1 62 6 view .LVU121
+	movq	st_char_classes@GOTPCREL(%rip), %rax
+	testb	$17, 32(%rax)
+	je	.L21
+.LVL27:
+.LBB63:
+.LBI63:
+	.loc 2 202 19 is_stmt 1 view .LVU122
+.LBB64:
+	.loc 2 203 3 view .LVU123
+	.loc 2 203 3 is_stmt 0 view .LVU124
+.LBE64:
+.LBE63:
+	.loc 1 62 71 view .LVU125
+	testb	$17, 44(%rax)
+	jne	.L36
+.L21:
+	.loc 1 63 5 is_stmt 1 view .LVU126
+	leaq	.LC8(%rip), %rdi
+	call	puts@PLT
+.LVL28:
+	.loc 1 64 5 view .LVU127
+	.loc 1 64 17 is_stmt 0 view .LVU128
+	movl	$1, 12(%rsp)
+.LVL29:
+.L23:
+	.loc 1 69 3 is_stmt 1 view .LVU129
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL30:
+	.loc 1 71 3 view .LVU130
+	.loc 1 72 1 is_stmt 0 view .LVU131
+	movl	12(%rsp), %eax
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL31:
+	.loc 1 72 1 view .LVU132
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL32:
+	.loc 1 72 1 view .LVU133
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL33:
+	.loc 1 72 1 view .LVU134
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL34:
+.L36:
+	.cfi_restore_state
+.LBB65:
+.LBI65:
+	.loc 2 202 19 is_stmt 1 view .LVU135
+.LBB66:
+	.loc 2 203 3 view .LVU136
+	.loc 2 203 3 is_stmt 0 view .LVU137
+.LBE66:
+.LBE65:
+	.loc 1 62 138 view .LVU138
+	testb	$17, 97(%rax)
+	jne	.L21
+	.loc 1 67 5 is_stmt 1 view .LVU139
+	leaq	.LC9(%rip), %rdi
+	call	puts@PLT
+.LVL35:
+	jmp	.L23
+.LVL36:
+.L35:
+	.loc 1 59 5 view .LVU140
+	leaq	.LC7(%rip), %rdi
+	call	puts@PLT
+.LVL37:
+	.loc 1 59 5 is_stmt 0 view .LVU141
+	jmp	.L20
+.LVL38:
+.L25:
+.LBB67:
+.LBB59:
+	.loc 1 49 14 view .LVU142
+	orl	$8, %ebx
+.LVL39:
+	.loc 1 50 5 is_stmt 1 view .LVU143
+	jmp	.L16
+.LBE59:
+.LBE67:
+	.cfi_endproc
+.LFE27:
+	.size	run_st_char_classes_unit_tests, .-run_st_char_classes_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC10:
+	.string	"------------------- st_scan_class(x) -------------------"
+	.section	.rodata.str1.1
+.LC11:
+	.string	"|\303"
+	.section	.rodata.str1.8
+	.align 8
+.LC12:
+	.string	"[Failed] st_char_class_init() failed to build the class."
+	.align 8
+.LC13:
+	.string	"[Passed] st_char_class_init() builds the class."
+	.align 8
+.LC15:
+	.string	"[Failed] st_scan_class() failed to find the delimiters."
+	.align 8
+.LC16:
+	.string	"[Passed] st_scan_class() finds the delimiters at every offset."
+	.text
+	.p2align 4
+	.globl	run_st_scan_class_unit_tests
+	.type	run_st_scan_class_unit_tests, @function
+run_st_scan_class_unit_tests:
+.LFB28:
+	.loc 1 77 36 view -0
+	.cfi_startproc
+	.loc 1 79 3 view .LVU145
+	.loc 1 77 36 is_stmt 0 view .LVU146
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 79 3 view .LVU147
+	leaq	.LC10(%rip), %rdi
+	.loc 1 77 36 view .LVU148
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$512, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 83 3 view .LVU149
+	leaq	256(%rsp), %r14
+	.loc 1 79 3 view .LVU150
+	call	puts@PLT
+.LVL40:
+	.loc 1 80 3 is_stmt 1 view .LVU151
+	.loc 1 82 3 view .LVU152
+	.loc 1 83 3 view .LVU153
+	leaq	.LC11(%rip), %rdx
+	movl	$16, %esi
+	movq	%r14, %rdi
+	call	st_char_class_init@PLT
+.LVL41:
+	.loc 1 84 3 view .LVU154
+.LBB68:
+.LBI68:
+	.loc 2 217 19 view .LVU155
+.LBB69:
+	.loc 2 218 3 view .LVU156
+	.loc 2 218 3 is_stmt 0 view .LVU157
+.LBE69:
+.LBE68:
+	.loc 1 84 6 view .LVU158
+	cmpb	$0, 380(%rsp)
+	je	.L38
+.LVL42:
+.LBB70:
+.LBI70:
+	.loc 2 217 19 is_stmt 1 view .LVU159
+.LBB71:
+	.loc 2 218 3 view .LVU160
+	.loc 2 218 3 is_stmt 0 view .LVU161
+.LBE71:
+.LBE70:
+	.loc 1 84 48 view .LVU162
+	cmpb	$0, 314(%rsp)
+	jne	.L50
+.L38:
+	.loc 1 85 5 is_stmt 1 view .LVU163
+	leaq	.LC12(%rip), %rdi
+	call	puts@PLT
+.LVL43:
+	.loc 1 86 5 view .LVU164
+	.loc 1 86 17 is_stmt 0 view .LVU165
+	movl	$1, 60(%rsp)
+.LVL44:
+.L40:
+	.loc 1 92 3 is_stmt 1 view .LVU166
+.LBB72:
+	.loc 1 96 5 is_stmt 0 view .LVU167
+	movl	$97, %eax
+.LBE72:
+	.loc 1 92 14 view .LVU168
+	movl	$-1020502660, 140(%rsp)
+	.loc 1 93 3 is_stmt 1 view .LVU169
+	.loc 1 94 3 view .LVU170
+.LVL45:
+	.loc 1 95 3 view .LVU171
+.LBB74:
+	.loc 1 95 8 view .LVU172
+	.loc 1 95 34 view .LVU173
+	.loc 1 96 5 is_stmt 0 view .LVU174
+	vpbroadcastb	%eax, %zmm3
+	.loc 1 95 15 view .LVU175
+	xorl	%r12d, %r12d
+.LBE74:
+	.loc 1 94 7 view .LVU176
+	movl	$1, %r13d
+	leaq	144(%rsp), %r15
+.LBB75:
+	.loc 1 96 5 view .LVU177
+	vmovdqa64	%zmm3, 64(%rsp)
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	.loc 1 96 5 is_stmt 1 view .LVU178
+	vmovdqa64	64(%rsp), %zmm1
+	.loc 1 97 14 is_stmt 0 view .LVU179
+	movq	%r14, %rdx
+	.loc 1 96 5 view .LVU180
+	vmovdqu8	%zmm1, (%r15)
+	.loc 1 97 14 view .LVU181
+	movq	%r12, %rsi
+	.loc 1 96 5 view .LVU182
+	vmovdqu8	%zmm1, 36(%r15)
+	.loc 1 97 5 is_stmt 1 view .LVU183
+	.loc 1 97 14 is_stmt 0 view .LVU184
+	movq	%r15, %rdi
+	vzeroupper
+.LVL47:
+	call	st_scan_class@PLT
+.LVL48:
+	.loc 1 97 57 view .LVU185
+	cmpq	%r12, %rax
+	sete	%al
+	movzbl	%al, %eax
+	.loc 1 97 11 view .LVU186
+	andl	%eax, %r13d
+.LVL49:
+	.loc 1 98 5 is_stmt 1 view .LVU187
+.LBB73:
+	.loc 1 98 10 view .LVU188
+	.loc 1 98 36 view .LVU189
+	testq	%r12, %r12
+	je	.L47
+	.loc 1 98 17 is_stmt 0 view .LVU190
+	xorl	%ebx, %ebx
+.LVL50:
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	.loc 1 99 7 is_stmt 1 discriminator 3 view .LVU191
+	.loc 1 100 39 is_stmt 0 discriminator 3 view .LVU192
+	movq	%rbx, %rax
+	andl	$3, %eax
+	.loc 1 99 7 discriminator 3 view .LVU193
+	vmovdqa64	64(%rsp), %zmm0
+	.loc 1 100 22 discriminator 3 view .LVU194
+	movzbl	140(%rsp,%rax), %eax
+	.loc 1 99 7 discriminator 3 view .LVU195
+	vmovdqu8	%zmm0, (%r15)
+	vmovdqu8	%zmm0, 36(%r15)
+	.loc 1 100 7 is_stmt 1 discriminator 3 view .LVU196
+	.loc 1 100 22 is_stmt 0 discriminator 3 view .LVU197
+	movb	%al, (%r15,%rbx)
+	.loc 1 101 7 is_stmt 1 discriminator 3 view .LVU198
+	.loc 1 101 16 is_stmt 0 discriminator 3 view .LVU199
+	movq	%r14, %rdx
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	vzeroupper
+.LVL51:
+	call	st_scan_class@PLT
+.LVL52:
+	.loc 1 101 59 discriminator 3 view .LVU200
+	cmpq	%rbx, %rax
+	sete	%al
+	movzbl	%al, %eax
+	.loc 1 98 52 discriminator 3 view .LVU201
+	incq	%rbx
+.LVL53:
+	.loc 1 101 13 discriminator 3 view .LVU202
+	andl	%eax, %r13d
+.LVL54:
+	.loc 1 98 52 is_stmt 1 discriminator 3 view .LVU203
+	.loc 1 98 36 discriminator 3 view .LVU204
+	cmpq	%r12, %rbx
+	jne	.L42
+.LBE73:
+	.loc 1 95 49 discriminator 2 view .LVU205
+	leaq	7(%rbx), %r12
+.LVL55:
+	.loc 1 95 34 discriminator 2 view .LVU206
+	cmpq	$98, %rbx
+	jne	.L44
+.LBE75:
+	.loc 1 105 3 view .LVU207
+	vmovdqa64	64(%rsp), %zmm2
+	.loc 1 106 27 is_stmt 0 view .LVU208
+	movb	$-1, 353(%rsp)
+	.loc 1 105 3 view .LVU209
+	vmovdqu8	%zmm2, 144(%rsp)
+	.loc 1 107 12 view .LVU210
+	movq	%r14, %rdx
+	.loc 1 105 3 view .LVU211
+	vmovdqu8	%zmm2, 180(%rsp)
+	.loc 1 106 3 is_stmt 1 view .LVU212
+	.loc 1 107 3 view .LVU213
+	.loc 1 107 12 is_stmt 0 view .LVU214
+	movl	$100, %esi
+	movq	%r15, %rdi
+	vzeroupper
+.LVL56:
+	call	st_scan_class@PLT
+.LVL57:
+	movq	%rax, %rbx
+.LVL58:
+	.loc 1 108 3 is_stmt 1 view .LVU215
+	.loc 1 109 3 view .LVU216
+	.loc 1 111 12 is_stmt 0 view .LVU217
+	movq	%r14, %rdx
+	.loc 1 108 27 view .LVU218
+	movl	$512, %eax
+.LVL59:
+	.loc 1 111 12 view .LVU219
+	movl	$100, %esi
+	movq	%r15, %rdi
+	.loc 1 108 27 view .LVU220
+	movw	%ax, 353(%rsp)
+	.loc 1 110 3 is_stmt 1 view .LVU221
+	.loc 1 110 13 is_stmt 0 view .LVU222
+	movb	$98, 149(%rsp)
+	.loc 1 111 3 is_stmt 1 view .LVU223
+	.loc 1 111 12 is_stmt 0 view .LVU224
+	call	st_scan_class@PLT
+.LVL60:
+	.loc 1 112 3 is_stmt 1 view .LVU225
+	.loc 1 107 52 is_stmt 0 view .LVU226
+	testq	%rbx, %rbx
+	sete	%dl
+	.loc 1 111 52 view .LVU227
+	cmpq	$5, %rax
+	.loc 1 111 9 view .LVU228
+	sete	%al
+.LVL61:
+	.loc 1 111 9 view .LVU229
+	movzbl	%al, %eax
+	andl	%edx, %eax
+	.loc 1 112 6 view .LVU230
+	testl	%r13d, %eax
+	jne	.L45
+	.loc 1 113 5 is_stmt 1 view .LVU231
+	leaq	.LC15(%rip), %rdi
+	call	puts@PLT
+.LVL62:
+	.loc 1 114 5 view .LVU232
+	.loc 1 114 17 is_stmt 0 view .LVU233
+	movl	$1, 60(%rsp)
+.LVL63:
+.L46:
+	.loc 1 119 3 is_stmt 1 view .LVU234
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL64:
+	.loc 1 121 3 view .LVU235
+	.loc 1 122 1 is_stmt 0 view .LVU236
+	movl	60(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL65:
+	.loc 1 122 1 view .LVU237
+	popq	%rbx
+	.loc 1 122 1 view .LVU238
+	popq	%r12
+.LVL66:
+	.loc 1 122 1 view .LVU239
+	popq	%r13
+	popq	%r14
+.LVL67:
+	.loc 1 122 1 view .LVU240
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL68:
+	.loc 1 122 1 view .LVU241
+	ret
+.LVL69:
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	.cfi_restore_state
+.LBB76:
+	.loc 1 95 49 view .LVU242
+	movl	$7, %r12d
+.LVL70:
+	.loc 1 95 49 view .LVU243
+	jmp	.L44
+.LVL71:
+.L45:
+	.loc 1 95 49 view .LVU244
+.LBE76:
+	.loc 1 117 5 is_stmt 1 view .LVU245
+	leaq	.LC16(%rip), %rdi
+	call	puts@PLT
+.LVL72:
+	jmp	.L46
+.LVL73:
+.L50:
+.LBB77:
+.LBI77:
+	.loc 2 217 19 view .LVU246
+.LBB78:
+	.loc 2 218 3 view .LVU247
+	.loc 2 218 3 is_stmt 0 view .LVU248
+.LBE78:
+.LBE77:
+.LBB79:
+.LBI79:
+	.loc 2 217 19 is_stmt 1 view .LVU249
+.LBB80:
+	.loc 2 218 3 view .LVU250
+	.loc 2 218 3 is_stmt 0 view .LVU251
+.LBE80:
+.LBE79:
+	.loc 1 84 136 view .LVU252
+	movzbl	353(%rsp), %eax
+	orb	256(%rsp), %al
+	jne	.L38
+	.loc 1 89 5 is_stmt 1 view .LVU253
+	leaq	.LC13(%rip), %rdi
+	call	puts@PLT
+.LVL74:
+	.loc 1 80 7 is_stmt 0 view .LVU254
+	movl	$0, 60(%rsp)
+	jmp	.L40
+	.cfi_endproc
+.LFE28:
+	.size	run_st_scan_class_unit_tests, .-run_st_scan_class_unit_tests
+	.p2align 4
+	.globl	run_char_class_tests
+	.type	run_char_class_tests, @function
+run_char_class_tests:
+.LFB29:
+	.loc 1 127 28 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 129 3 view .LVU256
+	.loc 1 127 28 is_stmt 0 view .LVU257
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 129 7 view .LVU258
+	xorl	%eax, %eax
+	call	run_is_numeric_unit_tests@PLT
+.LVL75:
+	.loc 1 129 6 view .LVU259
+	cmpl	$1, %eax
+	je	.L54
+	.loc 1 133 3 is_stmt 1 view .LVU260
+	.loc 1 133 7 is_stmt 0 view .LVU261
+	xorl	%eax, %eax
+	call	run_st_char_classes_unit_tests@PLT
+.LVL76:
+	.loc 1 133 6 view .LVU262
+	cmpl	$1, %eax
+	je	.L54
+	.loc 1 137 3 is_stmt 1 view .LVU263
+	.loc 1 137 7 is_stmt 0 view .LVU264
+	xorl	%eax, %eax
+	call	run_st_scan_class_unit_tests@PLT
+.LVL77:
+	.loc 1 137 6 view .LVU265
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+	.loc 1 142 1 view .LVU266
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.cfi_restore_state
+	.loc 1 130 11 view .LVU267
+	movl	$1, %eax
+	.loc 1 142 1 view .LVU268
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	run_char_class_tests, .-run_char_class_tests
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/usr/include/string.h"
+	.file 7 "/usr/include/stdio.h"
+	.file 8 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x9fa
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1d
+	.long	.LASF53
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x10
+	.long	.LASF7
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xa
+	.long	0x2e
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0xa
+	.long	0x46
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x10
+	.long	.LASF8
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x54
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xb
+	.long	0x8f
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF11
+	.uleb128 0xa
+	.long	0x8f
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF12
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF13
+	.uleb128 0xb
+	.long	0x96
+	.uleb128 0x10
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x69
+	.uleb128 0xa
+	.long	0xae
+	.uleb128 0x20
+	.long	.LASF54
+	.byte	0x7
+	.byte	0x4
+	.long	0x46
+	.byte	0x2
+	.byte	0x7a
+	.byte	0x6
+	.long	0xfc
+	.uleb128 0x7
+	.long	.LASF15
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF16
+	.byte	0x2
+	.uleb128 0x7
+	.long	.LASF17
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF18
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF19
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF20
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF21
+	.byte	0x40
+	.byte	0
+	.uleb128 0xc
+	.long	0xba
+	.long	0x10c
+	.uleb128 0xd
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0xa
+	.long	0xfc
+	.uleb128 0x21
+	.long	.LASF30
+	.byte	0x2
+	.byte	0xa6
+	.byte	0x16
+	.long	0x10c
+	.uleb128 0x22
+	.long	.LASF55
+	.value	0x100
+	.byte	0x2
+	.byte	0xab
+	.byte	0x8
+	.long	0x139
+	.uleb128 0x23
+	.long	.LASF56
+	.byte	0x2
+	.byte	0xb0
+	.byte	0xb
+	.long	0x13e
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x11d
+	.uleb128 0xc
+	.long	0xae
+	.long	0x14e
+	.uleb128 0xd
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF22
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF23
+	.uleb128 0x15
+	.long	.LASF24
+	.byte	0x2
+	.value	0x157
+	.byte	0x8
+	.long	0x2e
+	.long	0x17d
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x5
+	.long	0x3a
+	.uleb128 0x5
+	.long	0x17d
+	.byte	0
+	.uleb128 0xb
+	.long	0x139
+	.uleb128 0x16
+	.long	.LASF25
+	.byte	0x3d
+	.long	0x52
+	.long	0x1a0
+	.uleb128 0x5
+	.long	0x52
+	.uleb128 0x5
+	.long	0x7c
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF57
+	.byte	0x2
+	.byte	0xbd
+	.byte	0x6
+	.long	0x1bc
+	.uleb128 0x5
+	.long	0x1bc
+	.uleb128 0x5
+	.long	0x4d
+	.uleb128 0x5
+	.long	0xa9
+	.byte	0
+	.uleb128 0xb
+	.long	0x11d
+	.uleb128 0x15
+	.long	.LASF26
+	.byte	0x7
+	.value	0x164
+	.byte	0xc
+	.long	0x7c
+	.long	0x1d9
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x25
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF27
+	.byte	0xf6
+	.long	0x8a
+	.long	0x1f2
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x5
+	.long	0x7c
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF28
+	.byte	0x7f
+	.long	0x7c
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x23a
+	.uleb128 0x11
+	.quad	.LVL75
+	.long	0x825
+	.uleb128 0x11
+	.quad	.LVL76
+	.long	0x591
+	.uleb128 0x11
+	.quad	.LVL77
+	.long	0x23a
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF29
+	.byte	0x4d
+	.long	0x7c
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x571
+	.uleb128 0x6
+	.long	.LASF31
+	.byte	0x50
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x12
+	.long	.LASF32
+	.byte	0x52
+	.byte	0x1a
+	.long	0x11d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 256
+	.uleb128 0x12
+	.long	.LASF33
+	.byte	0x5c
+	.byte	0xe
+	.long	0x571
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 140
+	.uleb128 0x12
+	.long	.LASF34
+	.byte	0x5d
+	.byte	0x8
+	.long	0x581
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 144
+	.uleb128 0x6
+	.long	.LASF35
+	.byte	0x5e
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x13
+	.long	.LLRL34
+	.long	0x349
+	.uleb128 0x6
+	.long	.LASF36
+	.byte	0x5f
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x26
+	.quad	.LBB73
+	.quad	.LBE73-.LBB73
+	.long	0x31d
+	.uleb128 0x6
+	.long	.LASF37
+	.byte	0x62
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x14
+	.quad	.LVL51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x8
+	.quad	.LVL52
+	.long	0x15c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL47
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x8
+	.quad	.LVL48
+	.long	0x15c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x9a1
+	.quad	.LBI68
+	.byte	.LVU155
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.byte	0x54
+	.byte	0x7
+	.long	0x388
+	.uleb128 0x2
+	.long	0x9ba
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x2
+	.long	0x9af
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.uleb128 0x9
+	.long	0x9a1
+	.quad	.LBI70
+	.byte	.LVU159
+	.quad	.LBB70
+	.quad	.LBE70-.LBB70
+	.byte	0x54
+	.byte	0x33
+	.long	0x3c7
+	.uleb128 0x2
+	.long	0x9ba
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x2
+	.long	0x9af
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x9
+	.long	0x9a1
+	.quad	.LBI77
+	.byte	.LVU246
+	.quad	.LBB77
+	.quad	.LBE77-.LBB77
+	.byte	0x54
+	.byte	0x5f
+	.long	0x406
+	.uleb128 0x2
+	.long	0x9ba
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x2
+	.long	0x9af
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.uleb128 0x9
+	.long	0x9a1
+	.quad	.LBI79
+	.byte	.LVU249
+	.quad	.LBB79
+	.quad	.LBE79-.LBB79
+	.byte	0x54
+	.byte	0x8b
+	.long	0x445
+	.uleb128 0x2
+	.long	0x9ba
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x2
+	.long	0x9af
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL40
+	.long	0x9eb
+	.long	0x464
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL41
+	.long	0x1a0
+	.long	0x48e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL43
+	.long	0x9eb
+	.long	0x4ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL56
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL57
+	.long	0x15c
+	.long	0x4dc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL60
+	.long	0x15c
+	.long	0x500
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL62
+	.long	0x9eb
+	.long	0x51f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL64
+	.long	0x9f4
+	.long	0x536
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL72
+	.long	0x9eb
+	.long	0x555
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL74
+	.long	0x9eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x96
+	.long	0x581
+	.uleb128 0xd
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	0x8f
+	.long	0x591
+	.uleb128 0xd
+	.long	0x3f
+	.byte	0x63
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF38
+	.byte	0x25
+	.long	0x7c
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x825
+	.uleb128 0x6
+	.long	.LASF31
+	.byte	0x28
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x13
+	.long	.LLRL11
+	.long	0x6d8
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x29
+	.long	0x7c
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x18
+	.long	.LLRL13
+	.uleb128 0x6
+	.long	.LASF39
+	.byte	0x2a
+	.byte	0xa
+	.long	0x8f
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x6
+	.long	.LASF40
+	.byte	0x2b
+	.byte	0x9
+	.long	0x7c
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x6
+	.long	.LASF41
+	.byte	0x2c
+	.byte	0x9
+	.long	0x7c
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x6
+	.long	.LASF42
+	.byte	0x2d
+	.byte	0x12
+	.long	0x46
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x19
+	.long	0x981
+	.quad	.LBI50
+	.byte	.LVU80
+	.long	.LLRL18
+	.byte	0x30
+	.byte	0x11
+	.long	0x681
+	.uleb128 0x2
+	.long	0x993
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x1a
+	.long	0x9c6
+	.quad	.LBI51
+	.byte	.LVU82
+	.long	.LLRL18
+	.uleb128 0x2
+	.long	0x9df
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x2
+	.long	0x9d4
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL18
+	.long	0x1d9
+	.long	0x6ac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL23
+	.long	0x1c1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x9c6
+	.quad	.LBI61
+	.byte	.LVU118
+	.quad	.LBB61
+	.quad	.LBE61-.LBB61
+	.byte	0x3e
+	.byte	0x7
+	.long	0x717
+	.uleb128 0x2
+	.long	0x9df
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x2
+	.long	0x9d4
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.uleb128 0x9
+	.long	0x9c6
+	.quad	.LBI63
+	.byte	.LVU122
+	.quad	.LBB63
+	.quad	.LBE63-.LBB63
+	.byte	0x3e
+	.byte	0x4a
+	.long	0x756
+	.uleb128 0x2
+	.long	0x9df
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x2
+	.long	0x9d4
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.uleb128 0x9
+	.long	0x9c6
+	.quad	.LBI65
+	.byte	.LVU135
+	.quad	.LBB65
+	.quad	.LBE65-.LBB65
+	.byte	0x3e
+	.byte	0x8d
+	.long	0x795
+	.uleb128 0x2
+	.long	0x9df
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x2
+	.long	0x9d4
+	.long	.LLST27
+	.long	.LVUS27
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL13
+	.long	0x9eb
+	.long	0x7b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL28
+	.long	0x9eb
+	.long	0x7d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL30
+	.long	0x9f4
+	.long	0x7ea
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL35
+	.long	0x9eb
+	.long	0x809
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL37
+	.long	0x9eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF43
+	.byte	0xb
+	.long	0x7c
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x981
+	.uleb128 0x6
+	.long	.LASF31
+	.byte	0xe
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x13
+	.long	.LLRL1
+	.long	0x92f
+	.uleb128 0x17
+	.string	"i"
+	.byte	0xf
+	.long	0x7c
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x18
+	.long	.LLRL3
+	.uleb128 0x6
+	.long	.LASF39
+	.byte	0x10
+	.byte	0xa
+	.long	0x8f
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x6
+	.long	.LASF42
+	.byte	0x11
+	.byte	0x9
+	.long	0x7c
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x19
+	.long	0x981
+	.quad	.LBI34
+	.byte	.LVU28
+	.long	.LLRL6
+	.byte	0x15
+	.byte	0x9
+	.long	0x8ef
+	.uleb128 0x2
+	.long	0x993
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x1a
+	.long	0x9c6
+	.quad	.LBI35
+	.byte	.LVU30
+	.long	.LLRL6
+	.uleb128 0x2
+	.long	0x9df
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x2
+	.long	0x9d4
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL2
+	.long	0x1d9
+	.long	0x913
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL5
+	.long	0x1c1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL0
+	.long	0x9eb
+	.long	0x94e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL8
+	.long	0x9f4
+	.long	0x965
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL11
+	.long	0x9eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF44
+	.byte	0x2
+	.value	0x5c1
+	.byte	0x13
+	.long	0x7c
+	.byte	0x3
+	.long	0x9a1
+	.uleb128 0x28
+	.long	.LASF39
+	.byte	0x2
+	.value	0x5c1
+	.byte	0x29
+	.long	0x96
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF45
+	.byte	0xd9
+	.long	0x7c
+	.long	0x9c6
+	.uleb128 0xf
+	.long	.LASF46
+	.byte	0xd9
+	.byte	0x43
+	.long	0x17d
+	.uleb128 0xf
+	.long	.LASF39
+	.byte	0xd9
+	.byte	0x5a
+	.long	0x96
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF47
+	.byte	0xca
+	.long	0x7c
+	.long	0x9eb
+	.uleb128 0xf
+	.long	.LASF39
+	.byte	0xca
+	.byte	0x29
+	.long	0x96
+	.uleb128 0xf
+	.long	.LASF48
+	.byte	0xca
+	.byte	0x43
+	.long	0x4d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF49
+	.long	.LASF51
+	.uleb128 0x1c
+	.long	.LASF50
+	.long	.LASF52
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x59
+	.uleb128 0x21
+	.sleb128 1474
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 10
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS28:
+	.uleb128 .LVU152
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 60
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 60
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -196
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x1c4
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x1c4
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 60
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU171
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU229
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x10
+	.byte	0x73
+	.sleb128 0
+	.byte	0x30
+	.byte	0x29
+	.byte	0x70
+	.sleb128 0
+	.byte	0x35
+	.byte	0x29
+	.byte	0x1a
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU173
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU239
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+	.uleb128 .LVU244
+	.uleb128 .LVU246
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU189
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 .LVU239
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+	.uleb128 .LVU244
+	.uleb128 .LVU246
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -7
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -7
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU155
+	.uleb128 .LVU157
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7c
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU155
+	.uleb128 .LVU157
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU246
+	.uleb128 .LVU248
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x61
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU246
+	.uleb128 .LVU248
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 256
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU248
+	.uleb128 .LVU251
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU248
+	.uleb128 .LVU251
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 256
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU56
+	.uleb128 .LVU60
+	.uleb128 .LVU73
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU58
+	.uleb128 .LVU60
+	.uleb128 .LVU73
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU133
+	.uleb128 .LVU135
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU74
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU133
+	.uleb128 .LVU135
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU75
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU133
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 -48
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x39
+	.byte	0x2c
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0xe
+	.byte	0x7c
+	.sleb128 -48
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x39
+	.byte	0x2c
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 -48
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x39
+	.byte	0x2c
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU76
+	.uleb128 .LVU134
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU77
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU100
+	.uleb128 .LVU102
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 .LVU109
+	.uleb128 .LVU142
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0xe
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x8
+	.byte	0x21
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x16
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x31
+	.byte	0x24
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x8
+	.byte	0x21
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x21
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU80
+	.uleb128 .LVU84
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU118
+	.uleb128 .LVU120
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x41
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU118
+	.uleb128 .LVU120
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU122
+	.uleb128 .LVU124
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x2
+	.byte	0x41
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU122
+	.uleb128 .LVU124
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x2c
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU135
+	.uleb128 .LVU137
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x41
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU135
+	.uleb128 .LVU137
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x61
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU16
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU18
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU40
+	.uleb128 .LVU48
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU20
+	.uleb128 .LVU40
+	.uleb128 .LVU48
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU24
+	.uleb128 .LVU35
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU28
+	.uleb128 .LVU32
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU30
+	.uleb128 .LVU32
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU30
+	.uleb128 .LVU32
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF12:
+	.string	"long long int"
+.LASF8:
+	.string	"__uint8_t"
+.LASF7:
+	.string	"size_t"
+.LASF55:
+	.string	"StringCharClass"
+.LASF54:
+	.string	"StringCharClassBits"
+.LASF30:
+	.string	"st_char_classes"
+.LASF38:
+	.string	"run_st_char_classes_unit_tests"
+.LASF18:
+	.string	"ST_CLASS_HEX"
+.LASF52:
+	.string	"__builtin_putchar"
+.LASF27:
+	.string	"strchr"
+.LASF47:
+	.string	"st_char_is"
+.LASF56:
+	.string	"members"
+.LASF57:
+	.string	"st_char_class_init"
+.LASF37:
+	.string	"target"
+.LASF51:
+	.string	"__builtin_puts"
+.LASF4:
+	.string	"unsigned char"
+.LASF21:
+	.string	"ST_CLASS_ALPHA"
+.LASF32:
+	.string	"delimiters"
+.LASF42:
+	.string	"expected"
+.LASF2:
+	.string	"long unsigned int"
+.LASF5:
+	.string	"short unsigned int"
+.LASF10:
+	.string	"long int"
+.LASF50:
+	.string	"putchar"
+.LASF25:
+	.string	"memset"
+.LASF23:
+	.string	"double"
+.LASF28:
+	.string	"run_char_class_tests"
+.LASF9:
+	.string	"short int"
+.LASF40:
+	.string	"is_digit"
+.LASF3:
+	.string	"unsigned int"
+.LASF15:
+	.string	"ST_CLASS_WHITESPACE"
+.LASF13:
+	.string	"long long unsigned int"
+.LASF14:
+	.string	"uint8_t"
+.LASF48:
+	.string	"classes"
+.LASF17:
+	.string	"ST_CLASS_NUMERIC"
+.LASF22:
+	.string	"long double"
+.LASF31:
+	.string	"exit_status"
+.LASF45:
+	.string	"st_char_class_has"
+.LASF35:
+	.string	"found"
+.LASF43:
+	.string	"run_is_numeric_unit_tests"
+.LASF53:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF24:
+	.string	"st_scan_class"
+.LASF29:
+	.string	"run_st_scan_class_unit_tests"
+.LASF26:
+	.string	"printf"
+.LASF33:
+	.string	"targets"
+.LASF34:
+	.string	"buffer"
+.LASF44:
+	.string	"is_numeric"
+.LASF39:
+	.string	"token"
+.LASF11:
+	.string	"char"
+.LASF41:
+	.string	"is_alpha"
+.LASF49:
+	.string	"puts"
+.LASF20:
+	.string	"ST_CLASS_ESCAPE"
+.LASF6:
+	.string	"signed char"
+.LASF19:
+	.string	"ST_CLASS_STRUCTURAL"
+.LASF36:
+	.string	"length"
+.LASF16:
+	.string	"ST_CLASS_DIGIT"
+.LASF46:
+	.string	"char_class"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test"
+.LASF0:
+	.string	"/root/repo/tests/char_class_unit_tests.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
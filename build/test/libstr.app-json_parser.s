@@ -0,0 +1,10836 @@
+	.file	"json_parser.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/src/json_parser.c"
+	.p2align 4
+	.type	json_parser_string, @function
+json_parser_string:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/src/json_parser.c"
+	.loc 1 47 91 view -0
+	.cfi_startproc
+	.loc 1 49 3 view .LVU1
+	.loc 1 47 91 is_stmt 0 view .LVU2
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	.loc 1 49 10 view .LVU3
+	movl	$1, %ebx
+	.loc 1 47 91 view .LVU4
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	jmp	.L13
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+.LBB22:
+	.loc 1 67 10 is_stmt 1 view .LVU5
+	.loc 1 67 14 is_stmt 0 view .LVU6
+	leaq	1(%rbx), %rsi
+	movq	%r13, %rdi
+	call	st_ensure@PLT
+.LVL2:
+	.loc 1 67 13 view .LVU7
+	testl	%eax, %eax
+	je	.L8
+.LVL3:
+.L13:
+	.loc 1 67 13 view .LVU8
+	movq	16(%r13), %rdi
+.L2:
+.LVL4:
+	.loc 1 67 13 view .LVU9
+.LBE22:
+	.loc 1 50 3 is_stmt 1 view .LVU10
+.LBB25:
+	.loc 1 51 5 view .LVU11
+	.loc 1 51 12 is_stmt 0 view .LVU12
+	movq	8(%r13), %r12
+	subq	%rdi, %r12
+.LVL5:
+	.loc 1 52 5 is_stmt 1 view .LVU13
+	.loc 1 52 8 is_stmt 0 view .LVU14
+	cmpq	%r12, %rbx
+	jnb	.L3
+	.loc 1 53 7 is_stmt 1 view .LVU15
+	.loc 1 53 69 is_stmt 0 view .LVU16
+	addq	%rbx, %rdi
+	.loc 1 53 14 view .LVU17
+	movq	%r12, %rsi
+	subq	%rbx, %rsi
+	.loc 1 53 69 view .LVU18
+	addq	0(%r13), %rdi
+	.loc 1 53 14 view .LVU19
+	call	st_scan_escape@PLT
+.LVL6:
+	.loc 1 53 11 view .LVU20
+	addq	%rax, %rbx
+.LVL7:
+	.loc 1 55 5 is_stmt 1 view .LVU21
+	.loc 1 55 8 is_stmt 0 view .LVU22
+	cmpq	%r12, %rbx
+	jnb	.L3
+.LBB23:
+	.loc 1 56 7 is_stmt 1 view .LVU23
+	.loc 1 56 47 is_stmt 0 view .LVU24
+	movq	16(%r13), %rdi
+	.loc 1 56 29 view .LVU25
+	movq	0(%r13), %rcx
+	.loc 1 56 58 view .LVU26
+	leaq	(%rdi,%rbx), %rdx
+	.loc 1 56 12 view .LVU27
+	movzbl	(%rcx,%rdx), %eax
+.LVL8:
+	.loc 1 57 7 is_stmt 1 view .LVU28
+	.loc 1 57 10 is_stmt 0 view .LVU29
+	cmpb	$34, %al
+	je	.L4
+	.loc 1 60 7 is_stmt 1 view .LVU30
+	.loc 1 60 10 is_stmt 0 view .LVU31
+	cmpb	$92, %al
+	jne	.L8
+	.loc 1 65 7 is_stmt 1 view .LVU32
+	.loc 1 65 11 is_stmt 0 view .LVU33
+	addq	$2, %rbx
+.LVL9:
+	.loc 1 65 11 view .LVU34
+.LBE23:
+	jmp	.L2
+.LVL10:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 65 11 view .LVU35
+.LBE25:
+	.loc 1 76 1 view .LVU36
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL11:
+	.loc 1 76 1 view .LVU37
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL12:
+	.loc 1 76 1 view .LVU38
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL13:
+.LBB26:
+.LBB24:
+	.loc 1 62 16 view .LVU39
+	xorl	%eax, %eax
+.LBE24:
+.LBE26:
+	.loc 1 76 1 view .LVU40
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL14:
+	.loc 1 76 1 view .LVU41
+	ret
+.LVL15:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.cfi_restore_state
+	.loc 1 72 3 is_stmt 1 view .LVU42
+	.loc 1 72 55 is_stmt 0 view .LVU43
+	leaq	1(%rcx,%rdi), %rax
+.LVL16:
+	.loc 1 73 19 view .LVU44
+	decq	%rbx
+.LVL17:
+	.loc 1 72 55 view .LVU45
+	movq	%rax, 0(%rbp)
+.LVL18:
+	.loc 1 73 3 is_stmt 1 view .LVU46
+	.loc 1 73 19 is_stmt 0 view .LVU47
+	movq	%rbx, 8(%rbp)
+	.loc 1 74 3 is_stmt 1 view .LVU48
+	.loc 1 74 23 is_stmt 0 view .LVU49
+	movq	%rdx, 16(%r13)
+	.loc 1 75 3 is_stmt 1 view .LVU50
+	.loc 1 76 1 is_stmt 0 view .LVU51
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	.loc 1 75 10 view .LVU52
+	movl	$1, %eax
+	.loc 1 76 1 view .LVU53
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL19:
+	.loc 1 76 1 view .LVU54
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL20:
+	.loc 1 76 1 view .LVU55
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL21:
+	.loc 1 76 1 view .LVU56
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL22:
+	.loc 1 76 1 view .LVU57
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	json_parser_string, .-json_parser_string
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"false"
+	.text
+	.p2align 4
+	.globl	st_json_parse
+	.type	st_json_parse, @function
+st_json_parse:
+.LVL23:
+.LFB29:
+	.loc 1 149 104 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 151 3 view .LVU59
+	.loc 1 152 3 view .LVU60
+	.loc 1 153 3 view .LVU61
+	.loc 1 154 3 view .LVU62
+	.loc 1 156 3 view .LVU63
+	.loc 1 149 104 is_stmt 0 view .LVU64
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$568, %rsp
+	.cfi_def_cfa_offset 624
+	.loc 1 156 18 view .LVU65
+	call	st_current_token@PLT
+.LVL24:
+.LBB64:
+.LBI64:
+	.file 2 "/root/repo/src/../include/strutils.h"
+	.loc 2 202 19 is_stmt 1 view .LVU66
+.LBB65:
+	.loc 2 203 3 view .LVU67
+	.loc 2 203 26 is_stmt 0 view .LVU68
+	movq	st_char_classes@GOTPCREL(%rip), %r15
+	movzbl	%al, %eax
+.LBE65:
+.LBE64:
+	.loc 1 156 6 view .LVU69
+	testb	$1, (%r15,%rax)
+	jne	.L153
+.L16:
+.LBB66:
+	.loc 1 197 13 view .LVU70
+	xorl	%ebp, %ebp
+	xorl	%r14d, %r14d
+.LVL25:
+.L17:
+	.loc 1 197 13 view .LVU71
+.LBE66:
+	.loc 1 159 3 is_stmt 1 view .LVU72
+.LBB113:
+	.loc 1 160 5 view .LVU73
+	.loc 1 160 18 is_stmt 0 view .LVU74
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL26:
+	.loc 1 162 5 is_stmt 1 view .LVU75
+	.loc 1 162 8 is_stmt 0 view .LVU76
+	cmpb	$125, %al
+	je	.L154
+	.loc 1 169 10 is_stmt 1 view .LVU77
+	.loc 1 169 13 is_stmt 0 view .LVU78
+	cmpb	$93, %al
+	je	.L155
+	.loc 1 176 10 is_stmt 1 view .LVU79
+	.loc 1 176 13 is_stmt 0 view .LVU80
+	cmpl	$4, %ebp
+	je	.L156
+	.loc 1 185 10 is_stmt 1 view .LVU81
+	.loc 1 185 39 is_stmt 0 view .LVU82
+	subl	$2, %ebp
+.LVL27:
+	.loc 1 185 13 view .LVU83
+	cmpl	$1, %ebp
+	jbe	.L157
+.LBB67:
+	.loc 1 203 7 is_stmt 1 view .LVU84
+	.loc 1 204 7 view .LVU85
+	cmpb	$34, %al
+	je	.L36
+	leal	-91(%rax), %edx
+	cmpb	$32, %dl
+	ja	.L21
+	leaq	.L38(%rip), %rcx
+	movzbl	%dl, %edx
+	movslq	(%rcx,%rdx,4), %rdx
+	addq	%rcx, %rdx
+	jmp	*%rdx
+	.section	.rodata
+	.align 4
+	.align 4
+.L38:
+	.long	.L37-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L41-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L40-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L39-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L21-.L38
+	.long	.L37-.L38
+	.text
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L154:
+	.loc 1 204 7 is_stmt 0 view .LVU86
+.LBE67:
+	.loc 1 162 58 view .LVU87
+	leal	-3(%rbp), %eax
+.LVL29:
+	.loc 1 162 22 view .LVU88
+	cmpl	$1, %eax
+	jbe	.L19
+.L24:
+	.loc 1 185 10 is_stmt 1 view .LVU89
+	.loc 1 185 39 is_stmt 0 view .LVU90
+	subl	$2, %ebp
+.LVL30:
+	.loc 1 185 13 view .LVU91
+	cmpl	$1, %ebp
+	jbe	.L70
+.LVL31:
+.L21:
+.LBB107:
+.LBB68:
+	.loc 1 242 11 is_stmt 1 view .LVU92
+	.loc 1 243 11 view .LVU93
+	.loc 1 243 20 is_stmt 0 view .LVU94
+	leaq	32(%rsp), %rbp
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	st_extract_numbers_view@PLT
+.LVL32:
+	.loc 1 243 94 view .LVU95
+	testl	%eax, %eax
+	je	.L70
+	movq	32(%rsp), %rdi
+	movq	40(%rsp), %rsi
+.LBB69:
+.LBI69:
+	.loc 1 108 12 is_stmt 1 discriminator 1 view .LVU96
+.LVL33:
+.LBB70:
+	.loc 1 109 3 discriminator 1 view .LVU97
+	.loc 1 110 3 discriminator 1 view .LVU98
+	.loc 1 110 15 is_stmt 0 discriminator 1 view .LVU99
+	leaq	(%rdi,%rsi), %rdx
+.LVL34:
+	.loc 1 111 3 is_stmt 1 discriminator 1 view .LVU100
+	.loc 1 111 6 is_stmt 0 discriminator 1 view .LVU101
+	cmpq	%rdx, %rdi
+	jnb	.L73
+	.loc 1 111 18 view .LVU102
+	movzbl	(%rdi), %r8d
+	.loc 1 109 15 view .LVU103
+	movq	%rdi, %rcx
+	.loc 1 111 15 view .LVU104
+	cmpb	$45, %r8b
+	je	.L158
+.LVL35:
+.L53:
+.LBB71:
+.LBI71:
+	.loc 2 202 19 is_stmt 1 view .LVU105
+.LBB72:
+	.loc 2 203 3 view .LVU106
+	.loc 2 203 26 is_stmt 0 view .LVU107
+	movzbl	%r8b, %eax
+.LBE72:
+.LBE71:
+	.loc 1 115 16 view .LVU108
+	testb	$2, (%r15,%rax)
+	je	.L70
+	.loc 1 118 3 is_stmt 1 view .LVU109
+	.loc 1 118 9 is_stmt 0 view .LVU110
+	leaq	1(%rcx), %rax
+.LVL36:
+	.loc 1 118 6 view .LVU111
+	cmpb	$48, %r8b
+	je	.L54
+	.loc 1 119 20 is_stmt 1 view .LVU112
+	cmpq	%rdx, %rax
+	jb	.L55
+	jmp	.L57
+.LVL37:
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.loc 1 119 20 is_stmt 0 view .LVU113
+.LBE70:
+.LBE69:
+.LBE68:
+.LBE107:
+	.loc 1 162 88 discriminator 2 view .LVU114
+	testq	%r14, %r14
+	jne	.L159
+.LVL38:
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	.loc 1 165 16 view .LVU115
+	xorl	%eax, %eax
+.LVL39:
+.L15:
+	.loc 1 165 16 view .LVU116
+.LBE113:
+	.loc 1 259 1 view .LVU117
+	addq	$568, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL40:
+	.loc 1 259 1 view .LVU118
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL41:
+	.loc 1 259 1 view .LVU119
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL42:
+	.loc 1 259 1 view .LVU120
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL43:
+	.p2align 4,,10
+	.p2align 3
+.L155:
+	.cfi_restore_state
+.LBB114:
+	.loc 1 169 27 discriminator 1 view .LVU121
+	movl	$18, %eax
+.LVL44:
+	.loc 1 169 27 discriminator 1 view .LVU122
+	btq	%rbp, %rax
+	jnc	.L24
+	.loc 1 169 95 view .LVU123
+	testq	%r14, %r14
+	je	.L160
+	.loc 1 169 108 discriminator 3 view .LVU124
+	cmpb	$91, 47(%rsp,%r14)
+	.loc 1 169 123 discriminator 3 view .LVU125
+	leaq	-1(%r14), %rdx
+	.loc 1 169 108 discriminator 3 view .LVU126
+	je	.L161
+	.loc 1 176 10 is_stmt 1 view .LVU127
+	.loc 1 176 13 is_stmt 0 view .LVU128
+	subl	$2, %ebp
+.LVL45:
+	.loc 1 176 13 view .LVU129
+	cmpl	$2, %ebp
+	ja	.L21
+	jmp	.L70
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L153:
+	.loc 1 176 13 view .LVU130
+.LBE114:
+	.loc 1 157 5 is_stmt 1 view .LVU131
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL47:
+	jmp	.L16
+.LVL48:
+	.p2align 4,,10
+	.p2align 3
+.L156:
+.LBB115:
+	.loc 1 178 7 view .LVU132
+	.loc 1 178 10 is_stmt 0 view .LVU133
+	cmpb	$44, %al
+	jne	.L70
+	.loc 1 181 7 is_stmt 1 view .LVU134
+	.loc 1 181 57 is_stmt 0 view .LVU135
+	xorl	%ebp, %ebp
+.LVL49:
+	.loc 1 181 57 view .LVU136
+	cmpb	$123, 47(%rsp,%r14)
+	sete	%bpl
+	.loc 1 182 7 view .LVU137
+	movq	%rbx, %rdi
+	.loc 1 181 57 view .LVU138
+	addl	%ebp, %ebp
+.LVL50:
+	.loc 1 182 7 is_stmt 1 view .LVU139
+	call	st_next_token@PLT
+.LVL51:
+	.loc 1 183 7 view .LVU140
+	jmp	.L17
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L157:
+	.loc 1 187 7 view .LVU141
+	.loc 1 187 10 is_stmt 0 view .LVU142
+	cmpb	$34, %al
+	jne	.L70
+	.loc 1 187 27 discriminator 1 view .LVU143
+	leaq	32(%rsp), %rbp
+.LVL53:
+	.loc 1 187 27 discriminator 1 view .LVU144
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	json_parser_string
+.LVL54:
+	.loc 1 187 24 discriminator 1 view .LVU145
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 190 7 is_stmt 1 view .LVU146
+	.loc 1 190 18 is_stmt 0 view .LVU147
+	movq	32(%r12), %rax
+	.loc 1 190 10 view .LVU148
+	testq	%rax, %rax
+	je	.L35
+	.loc 1 190 34 discriminator 1 view .LVU149
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	call	*%rax
+.LVL55:
+	.loc 1 190 31 discriminator 1 view .LVU150
+	testl	%eax, %eax
+	je	.L70
+.L35:
+	.loc 1 193 7 is_stmt 1 view .LVU151
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL56:
+	.loc 1 194 7 view .LVU152
+	.loc 1 194 11 is_stmt 0 view .LVU153
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL57:
+	.loc 1 194 10 view .LVU154
+	cmpb	$58, %al
+	jne	.L70
+	.loc 1 197 7 is_stmt 1 view .LVU155
+.LVL58:
+	.loc 1 198 7 view .LVU156
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL59:
+	.loc 1 199 7 view .LVU157
+	.loc 1 197 13 is_stmt 0 view .LVU158
+	xorl	%ebp, %ebp
+	.loc 1 199 7 view .LVU159
+	jmp	.L17
+.LVL60:
+	.p2align 4,,10
+	.p2align 3
+.L159:
+	.loc 1 162 116 discriminator 3 view .LVU160
+	decq	%r14
+.LVL61:
+	.loc 1 162 101 discriminator 3 view .LVU161
+	cmpb	$123, 48(%rsp,%r14)
+	jne	.L70
+	.loc 1 163 7 is_stmt 1 view .LVU162
+.LVL62:
+	.loc 1 164 7 view .LVU163
+	.loc 1 164 18 is_stmt 0 view .LVU164
+	movq	8(%r12), %rax
+	.loc 1 164 10 view .LVU165
+	testq	%rax, %rax
+	je	.L28
+.LBB108:
+	.loc 1 238 90 discriminator 4 view .LVU166
+	movq	%r13, %rdi
+	call	*%rax
+.LVL63:
+	.loc 1 238 87 discriminator 4 view .LVU167
+	testl	%eax, %eax
+	jne	.L28
+	jmp	.L70
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	.loc 1 238 87 discriminator 4 view .LVU168
+.LBE108:
+	.loc 1 176 10 is_stmt 1 view .LVU169
+	.loc 1 176 13 is_stmt 0 view .LVU170
+	cmpl	$4, %ebp
+	jne	.L21
+	jmp	.L70
+.LVL64:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+.LBB109:
+	.loc 1 226 11 is_stmt 1 view .LVU171
+	.loc 1 226 20 is_stmt 0 view .LVU172
+	leaq	32(%rsp), %rbp
+.LVL65:
+	.loc 1 226 20 view .LVU173
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	json_parser_string
+.LVL66:
+	.loc 1 226 57 view .LVU174
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 226 68 discriminator 1 view .LVU175
+	movq	40(%r12), %rax
+	.loc 1 226 57 discriminator 1 view .LVU176
+	testq	%rax, %rax
+	je	.L28
+	.loc 1 226 87 discriminator 4 view .LVU177
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	call	*%rax
+.LVL67:
+	.loc 1 226 84 discriminator 4 view .LVU178
+	testl	%eax, %eax
+	je	.L70
+.LVL68:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.loc 1 226 84 discriminator 4 view .LVU179
+.LBE109:
+	.loc 1 254 5 is_stmt 1 view .LVU180
+	.loc 1 254 8 is_stmt 0 view .LVU181
+	testq	%r14, %r14
+	je	.L78
+	.loc 1 257 5 is_stmt 1 view .LVU182
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL69:
+	movl	$4, %ebp
+	jmp	.L17
+.LVL70:
+	.p2align 4,,10
+	.p2align 3
+.L37:
+.LBB110:
+	.loc 1 207 11 view .LVU183
+	.loc 1 207 14 is_stmt 0 view .LVU184
+	cmpq	$512, %r14
+	je	.L70
+	.loc 1 210 11 is_stmt 1 view .LVU185
+.LVL71:
+	.loc 1 210 26 is_stmt 0 view .LVU186
+	movb	%al, 48(%rsp,%r14)
+	.loc 1 211 11 is_stmt 1 view .LVU187
+	.loc 1 211 14 is_stmt 0 view .LVU188
+	cmpb	$123, %al
+	je	.L162
+	.loc 1 216 13 is_stmt 1 view .LVU189
+	.loc 1 216 29 is_stmt 0 view .LVU190
+	movq	16(%r12), %rax
+.LVL72:
+	.loc 1 216 50 view .LVU191
+	testq	%rax, %rax
+	je	.L47
+	.loc 1 216 53 discriminator 2 view .LVU192
+	movq	%r13, %rdi
+	call	*%rax
+.LVL73:
+	.loc 1 216 50 discriminator 2 view .LVU193
+	testl	%eax, %eax
+	je	.L70
+.L47:
+	.loc 1 217 19 view .LVU194
+	movl	$1, %ebp
+.LVL74:
+.L44:
+	.loc 1 222 11 view .LVU195
+	movq	%rbx, %rdi
+	.loc 1 210 22 view .LVU196
+	incq	%r14
+.LVL75:
+	.loc 1 222 11 is_stmt 1 view .LVU197
+	call	st_next_token@PLT
+.LVL76:
+	.loc 1 223 11 view .LVU198
+	jmp	.L17
+.LVL77:
+	.p2align 4,,10
+	.p2align 3
+.L60:
+.LBB96:
+.LBB91:
+.LBB86:
+	.loc 1 120 7 view .LVU199
+	.loc 1 120 8 is_stmt 0 view .LVU200
+	incq	%rax
+.LVL78:
+	.loc 1 119 20 is_stmt 1 view .LVU201
+	cmpq	%rax, %rdx
+	je	.L66
+.L55:
+.LVL79:
+.LBB73:
+.LBI73:
+	.loc 2 202 19 view .LVU202
+.LBB74:
+	.loc 2 203 3 view .LVU203
+	.loc 2 203 26 is_stmt 0 view .LVU204
+	movzbl	(%rax), %ecx
+.LBE74:
+.LBE73:
+	.loc 1 119 20 view .LVU205
+	testb	$2, (%r15,%rcx)
+	jne	.L60
+	.loc 1 124 3 is_stmt 1 view .LVU206
+	.loc 1 124 6 is_stmt 0 view .LVU207
+	cmpq	%rdx, %rax
+	jnb	.L57
+	.loc 1 124 18 view .LVU208
+	movzbl	(%rax), %r8d
+	.loc 1 124 15 view .LVU209
+	cmpb	$46, %r8b
+	je	.L58
+.L59:
+.LVL80:
+	.loc 1 132 29 view .LVU210
+	andl	$-33, %r8d
+	.loc 1 132 15 view .LVU211
+	cmpb	$69, %r8b
+	jne	.L70
+	.loc 1 133 5 is_stmt 1 view .LVU212
+	.loc 1 133 8 is_stmt 0 view .LVU213
+	leaq	1(%rax), %rcx
+.LVL81:
+	.loc 1 133 8 view .LVU214
+	cmpq	%rdx, %rcx
+	jnb	.L63
+	.loc 1 133 33 view .LVU215
+	movzbl	1(%rax), %r8d
+	leal	-43(%r8), %r9d
+	.loc 1 133 19 view .LVU216
+	andl	$253, %r9d
+	jne	.L64
+	.loc 1 134 7 is_stmt 1 view .LVU217
+	.loc 1 134 8 is_stmt 0 view .LVU218
+	leaq	2(%rax), %rcx
+.LVL82:
+.L63:
+	.loc 1 136 5 is_stmt 1 view .LVU219
+	.loc 1 136 8 is_stmt 0 view .LVU220
+	cmpq	%rcx, %rdx
+	je	.L70
+.LBB75:
+.LBB76:
+	.loc 2 203 27 view .LVU221
+	movzbl	(%rcx), %r8d
+.L64:
+.LVL83:
+	.loc 2 203 27 view .LVU222
+.LBE76:
+.LBI75:
+	.loc 2 202 19 is_stmt 1 view .LVU223
+.LBB77:
+	.loc 2 203 3 view .LVU224
+	.loc 2 203 26 is_stmt 0 view .LVU225
+	movzbl	(%r15,%r8), %eax
+.LVL84:
+	.loc 2 203 26 view .LVU226
+.LBE77:
+.LBE75:
+	.loc 1 136 18 view .LVU227
+	testb	$2, %al
+	je	.L70
+.LVL85:
+	.loc 1 139 20 is_stmt 1 view .LVU228
+	cmpq	%rdx, %rcx
+	jb	.L65
+	jmp	.L77
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	.loc 1 140 7 view .LVU229
+	.loc 1 140 8 is_stmt 0 view .LVU230
+	incq	%rcx
+.LVL86:
+	.loc 1 139 20 is_stmt 1 view .LVU231
+	cmpq	%rcx, %rdx
+	je	.L66
+.LBB78:
+.LBB79:
+	.loc 2 203 26 is_stmt 0 view .LVU232
+	movzbl	(%rcx), %eax
+	movzbl	(%r15,%rax), %eax
+.L65:
+.LVL87:
+	.loc 2 203 26 view .LVU233
+.LBE79:
+.LBI78:
+	.loc 2 202 19 is_stmt 1 view .LVU234
+.LBB80:
+	.loc 2 203 3 view .LVU235
+	.loc 2 203 3 is_stmt 0 view .LVU236
+.LBE80:
+.LBE78:
+	.loc 1 139 20 view .LVU237
+	testb	$2, %al
+	jne	.L67
+.L77:
+	.loc 1 139 20 view .LVU238
+	movq	%rcx, %rax
+.LVL88:
+.L57:
+	.loc 1 143 3 is_stmt 1 view .LVU239
+	.loc 1 143 3 is_stmt 0 view .LVU240
+.LBE86:
+.LBE91:
+	.loc 1 243 62 view .LVU241
+	cmpq	%rax, %rdx
+	jne	.L70
+.L66:
+	.loc 1 243 97 discriminator 3 view .LVU242
+	leaq	24(%rsp), %rdx
+	call	stod@PLT
+.LVL89:
+	.loc 1 243 94 discriminator 3 view .LVU243
+	cmpq	40(%rsp), %rax
+	jne	.L70
+.LVL90:
+	.loc 1 244 11 is_stmt 1 view .LVU244
+	.loc 1 244 38 is_stmt 0 view .LVU245
+	movq	48(%r12), %rax
+	.loc 1 244 27 view .LVU246
+	testq	%rax, %rax
+	je	.L28
+	.loc 1 244 57 discriminator 4 view .LVU247
+	vmovsd	24(%rsp), %xmm0
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	call	*%rax
+.LVL91:
+	.loc 1 244 54 discriminator 4 view .LVU248
+	testl	%eax, %eax
+	jne	.L28
+	jmp	.L70
+.LVL92:
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	.loc 1 244 54 discriminator 4 view .LVU249
+.LBE96:
+	.loc 1 230 11 is_stmt 1 view .LVU250
+.LBB97:
+.LBI97:
+	.loc 1 91 12 view .LVU251
+.LBB98:
+	.loc 1 92 3 view .LVU252
+	.loc 1 92 7 is_stmt 0 view .LVU253
+	movl	$4, %esi
+	movq	%rbx, %rdi
+	call	st_ensure@PLT
+.LVL93:
+	.loc 1 92 6 view .LVU254
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 92 80 view .LVU255
+	movq	16(%rbx), %rax
+	.loc 1 92 44 view .LVU256
+	movq	(%rbx), %rdx
+	.loc 1 92 41 view .LVU257
+	cmpl	$1702195828, (%rdx,%rax)
+	jne	.L70
+	.loc 1 95 3 is_stmt 1 view .LVU258
+	.loc 1 95 23 is_stmt 0 view .LVU259
+	addq	$3, %rax
+	movq	%rax, 16(%rbx)
+	.loc 1 96 3 is_stmt 1 view .LVU260
+.LVL94:
+	.loc 1 96 3 is_stmt 0 view .LVU261
+.LBE98:
+.LBE97:
+	.loc 1 230 73 view .LVU262
+	movq	56(%r12), %rax
+	.loc 1 230 62 view .LVU263
+	testq	%rax, %rax
+	je	.L28
+	.loc 1 230 93 discriminator 4 view .LVU264
+	movl	$1, %esi
+	movq	%r13, %rdi
+	call	*%rax
+.LVL95:
+	.loc 1 230 90 discriminator 4 view .LVU265
+	testl	%eax, %eax
+	jne	.L28
+	jmp	.L70
+.LVL96:
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	.loc 1 238 11 is_stmt 1 view .LVU266
+.LBB99:
+.LBI99:
+	.loc 1 91 12 view .LVU267
+.LBB100:
+	.loc 1 92 3 view .LVU268
+	.loc 1 92 7 is_stmt 0 view .LVU269
+	movl	$4, %esi
+	movq	%rbx, %rdi
+	call	st_ensure@PLT
+.LVL97:
+	.loc 1 92 6 view .LVU270
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 92 80 view .LVU271
+	movq	16(%rbx), %rax
+	.loc 1 92 44 view .LVU272
+	movq	(%rbx), %rdx
+	.loc 1 92 41 view .LVU273
+	cmpl	$1819047278, (%rdx,%rax)
+	jne	.L70
+	.loc 1 95 3 is_stmt 1 view .LVU274
+	.loc 1 95 23 is_stmt 0 view .LVU275
+	addq	$3, %rax
+	movq	%rax, 16(%rbx)
+	.loc 1 96 3 is_stmt 1 view .LVU276
+.LVL98:
+	.loc 1 96 3 is_stmt 0 view .LVU277
+.LBE100:
+.LBE99:
+	.loc 1 238 73 view .LVU278
+	movq	64(%r12), %rax
+	.loc 1 238 62 view .LVU279
+	testq	%rax, %rax
+	je	.L28
+	.loc 1 238 90 view .LVU280
+	movq	%r13, %rdi
+	call	*%rax
+.LVL99:
+	.loc 1 238 87 view .LVU281
+	testl	%eax, %eax
+	jne	.L28
+	jmp	.L70
+.LVL100:
+	.p2align 4,,10
+	.p2align 3
+.L41:
+	.loc 1 234 11 is_stmt 1 view .LVU282
+.LBB101:
+.LBI101:
+	.loc 1 91 12 view .LVU283
+.LBB102:
+	.loc 1 92 3 view .LVU284
+	.loc 1 92 7 is_stmt 0 view .LVU285
+	movl	$5, %esi
+	movq	%rbx, %rdi
+	call	st_ensure@PLT
+.LVL101:
+	.loc 1 92 6 view .LVU286
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 92 80 view .LVU287
+	movq	16(%rbx), %rax
+	.loc 1 92 69 view .LVU288
+	movq	(%rbx), %rdx
+	addq	%rax, %rdx
+	.loc 1 92 44 view .LVU289
+	cmpl	$1936482662, (%rdx)
+	jne	.L70
+	cmpb	$101, 4(%rdx)
+	jne	.L70
+	.loc 1 95 3 is_stmt 1 view .LVU290
+	.loc 1 95 23 is_stmt 0 view .LVU291
+	addq	$4, %rax
+	movq	%rax, 16(%rbx)
+	.loc 1 96 3 is_stmt 1 view .LVU292
+.LVL102:
+	.loc 1 96 3 is_stmt 0 view .LVU293
+.LBE102:
+.LBE101:
+	.loc 1 234 74 view .LVU294
+	movq	56(%r12), %rax
+	.loc 1 234 63 view .LVU295
+	testq	%rax, %rax
+	je	.L28
+	.loc 1 234 94 discriminator 4 view .LVU296
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	call	*%rax
+.LVL103:
+	.loc 1 234 91 discriminator 4 view .LVU297
+	testl	%eax, %eax
+	jne	.L28
+	jmp	.L70
+.LVL104:
+	.p2align 4,,10
+	.p2align 3
+.L73:
+.LBB103:
+.LBB92:
+.LBB87:
+	.loc 1 234 91 discriminator 4 view .LVU298
+	movq	%rdi, %rcx
+.LVL105:
+.L52:
+	.loc 1 115 3 is_stmt 1 view .LVU299
+	.loc 1 115 6 is_stmt 0 view .LVU300
+	cmpq	%rcx, %rdx
+	je	.L70
+	.loc 1 115 30 view .LVU301
+	movzbl	(%rcx), %r8d
+	jmp	.L53
+.LVL106:
+	.p2align 4,,10
+	.p2align 3
+.L161:
+	.loc 1 115 30 view .LVU302
+.LBE87:
+.LBE92:
+.LBE103:
+.LBE110:
+	.loc 1 170 7 is_stmt 1 view .LVU303
+	.loc 1 171 7 view .LVU304
+	.loc 1 171 18 is_stmt 0 view .LVU305
+	movq	24(%r12), %rax
+	.loc 1 171 10 view .LVU306
+	testq	%rax, %rax
+	je	.L29
+	.loc 1 171 40 discriminator 1 view .LVU307
+	movq	%r13, %rdi
+	movq	%rdx, 8(%rsp)
+	call	*%rax
+.LVL107:
+	.loc 1 171 37 discriminator 1 view .LVU308
+	testl	%eax, %eax
+	movq	8(%rsp), %rdx
+	je	.L70
+.LVL108:
+.L29:
+	.loc 1 170 12 view .LVU309
+	movq	%rdx, %r14
+.LVL109:
+	.loc 1 170 12 view .LVU310
+	jmp	.L28
+.LVL110:
+	.p2align 4,,10
+	.p2align 3
+.L158:
+.LBB111:
+.LBB104:
+.LBB93:
+.LBB88:
+	.loc 1 112 5 is_stmt 1 view .LVU311
+	.loc 1 112 6 is_stmt 0 view .LVU312
+	leaq	1(%rdi), %rcx
+.LVL111:
+	.loc 1 112 6 view .LVU313
+	jmp	.L52
+.LVL112:
+	.p2align 4,,10
+	.p2align 3
+.L162:
+	.loc 1 112 6 view .LVU314
+.LBE88:
+.LBE93:
+.LBE104:
+	.loc 1 212 13 is_stmt 1 view .LVU315
+	.loc 1 212 29 is_stmt 0 view .LVU316
+	movq	(%r12), %rax
+.LVL113:
+	.loc 1 212 51 view .LVU317
+	testq	%rax, %rax
+	je	.L45
+	.loc 1 212 54 discriminator 2 view .LVU318
+	movq	%r13, %rdi
+	call	*%rax
+.LVL114:
+	.loc 1 212 51 discriminator 2 view .LVU319
+	testl	%eax, %eax
+	je	.L70
+.L45:
+	.loc 1 213 19 view .LVU320
+	movl	$3, %ebp
+.LVL115:
+	.loc 1 213 19 view .LVU321
+	jmp	.L44
+.LVL116:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+.LBB105:
+.LBB94:
+.LBB89:
+	.loc 1 124 3 is_stmt 1 view .LVU322
+	.loc 1 124 6 is_stmt 0 view .LVU323
+	cmpq	%rdx, %rax
+	jnb	.L57
+	.loc 1 124 18 view .LVU324
+	movzbl	1(%rcx), %r8d
+	.loc 1 124 15 view .LVU325
+	cmpb	$46, %r8b
+	jne	.L59
+.L58:
+	.loc 1 125 5 is_stmt 1 view .LVU326
+	.loc 1 125 8 is_stmt 0 view .LVU327
+	leaq	1(%rax), %rcx
+.LVL117:
+	.loc 1 125 8 view .LVU328
+	cmpq	%rcx, %rdx
+	je	.L70
+.LVL118:
+.LBB81:
+.LBI81:
+	.loc 2 202 19 is_stmt 1 view .LVU329
+.LBB82:
+	.loc 2 203 3 view .LVU330
+	.loc 2 203 26 is_stmt 0 view .LVU331
+	movzbl	1(%rax), %eax
+	movzbl	(%r15,%rax), %eax
+.LVL119:
+	.loc 2 203 26 view .LVU332
+.LBE82:
+.LBE81:
+	.loc 1 125 20 view .LVU333
+	testb	$2, %al
+	je	.L70
+	.loc 1 128 20 is_stmt 1 view .LVU334
+	cmpq	%rdx, %rcx
+	jb	.L61
+	jmp	.L70
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	.loc 1 129 7 view .LVU335
+	.loc 1 129 8 is_stmt 0 view .LVU336
+	incq	%rcx
+.LVL120:
+	.loc 1 128 20 is_stmt 1 view .LVU337
+	cmpq	%rcx, %rdx
+	je	.L76
+.LBB83:
+.LBB84:
+	.loc 2 203 26 is_stmt 0 view .LVU338
+	movzbl	(%rcx), %eax
+	movzbl	(%r15,%rax), %eax
+.L61:
+.LVL121:
+	.loc 2 203 26 view .LVU339
+.LBE84:
+.LBI83:
+	.loc 2 202 19 is_stmt 1 view .LVU340
+.LBB85:
+	.loc 2 203 3 view .LVU341
+	.loc 2 203 3 is_stmt 0 view .LVU342
+.LBE85:
+.LBE83:
+	.loc 1 128 20 view .LVU343
+	testb	$2, %al
+	jne	.L62
+	.loc 1 132 3 is_stmt 1 view .LVU344
+	.loc 1 132 6 is_stmt 0 view .LVU345
+	cmpq	%rdx, %rcx
+	jnb	.L77
+	.loc 1 132 19 view .LVU346
+	movzbl	(%rcx), %r8d
+	movq	%rcx, %rax
+	jmp	.L59
+.LVL122:
+.L78:
+	.loc 1 132 19 view .LVU347
+.LBE89:
+.LBE94:
+.LBE105:
+.LBE111:
+	.loc 1 255 14 view .LVU348
+	movl	$1, %eax
+.LVL123:
+	.loc 1 255 14 view .LVU349
+	jmp	.L15
+.LVL124:
+.L76:
+.LBB112:
+.LBB106:
+.LBB95:
+.LBB90:
+	.loc 1 129 8 view .LVU350
+	movq	%rdx, %rax
+	jmp	.L57
+.LBE90:
+.LBE95:
+.LBE106:
+.LBE112:
+.LBE115:
+	.cfi_endproc
+.LFE29:
+	.size	st_json_parse, .-st_json_parse
+	.p2align 4
+	.globl	st_skip_value
+	.type	st_skip_value, @function
+st_skip_value:
+.LVL125:
+.LFB31:
+	.loc 1 317 54 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 318 3 view .LVU352
+	.loc 1 317 54 is_stmt 0 view .LVU353
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 318 7 view .LVU354
+	movl	$1, %esi
+	.loc 1 317 54 view .LVU355
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 318 7 view .LVU356
+	call	st_ensure@PLT
+.LVL126:
+	.loc 1 318 6 view .LVU357
+	testl	%eax, %eax
+	je	.L166
+	.loc 1 321 3 is_stmt 1 view .LVU358
+	.loc 1 321 25 is_stmt 0 view .LVU359
+	movq	0(%rbp), %rbx
+	.loc 1 321 43 view .LVU360
+	movq	16(%rbp), %rsi
+	.loc 1 321 8 view .LVU361
+	movzbl	(%rbx,%rsi), %eax
+.LVL127:
+	.loc 1 322 3 is_stmt 1 view .LVU362
+	.loc 1 322 29 is_stmt 0 view .LVU363
+	movl	%eax, %edx
+	andl	$-33, %edx
+	.loc 1 322 6 view .LVU364
+	cmpb	$93, %dl
+	je	.L166
+	.loc 1 322 52 discriminator 1 view .LVU365
+	cmpb	$44, %al
+	je	.L166
+	cmpb	$58, %al
+	je	.L166
+	.loc 1 326 3 is_stmt 1 view .LVU366
+	.loc 1 326 16 is_stmt 0 view .LVU367
+	movq	328(%rbp), %r12
+	.loc 1 326 6 view .LVU368
+	testq	%r12, %r12
+	jne	.L212
+	.loc 1 329 3 is_stmt 1 view .LVU369
+	.loc 1 330 3 view .LVU370
+	.loc 1 330 6 is_stmt 0 view .LVU371
+	cmpb	$34, %al
+	je	.L213
+	.loc 1 333 3 is_stmt 1 view .LVU372
+	.loc 1 337 32 is_stmt 0 view .LVU373
+	movabsq	$-288247976927690752, %rbx
+	.loc 1 333 6 view .LVU374
+	cmpb	$91, %dl
+	jne	.L178
+	.loc 1 345 10 view .LVU375
+	xorl	%ebx, %ebx
+.LBB122:
+	.loc 1 365 11 view .LVU376
+	movq	%rsp, %r12
+.LVL128:
+	.p2align 4,,10
+	.p2align 3
+.L179:
+	.loc 1 365 11 view .LVU377
+.LBE122:
+	.loc 1 346 34 is_stmt 1 view .LVU378
+	.loc 1 346 10 is_stmt 0 view .LVU379
+	movl	$1, %esi
+	movq	%rbp, %rdi
+	call	st_ensure@PLT
+.LVL129:
+	.loc 1 346 34 view .LVU380
+	cmpl	$1, %eax
+	jne	.L166
+.LBB123:
+	.loc 1 347 5 is_stmt 1 view .LVU381
+	.loc 1 348 12 is_stmt 0 view .LVU382
+	movq	8(%rbp), %rcx
+	.loc 1 349 12 view .LVU383
+	movq	16(%rbp), %rdx
+	.loc 1 347 17 view .LVU384
+	movq	0(%rbp), %rsi
+.LVL130:
+	.loc 1 348 5 is_stmt 1 view .LVU385
+	.loc 1 349 5 view .LVU386
+	.loc 1 350 5 view .LVU387
+	.loc 1 350 21 view .LVU388
+	cmpq	%rcx, %rdx
+	jb	.L187
+	jmp	.L179
+.LVL131:
+	.p2align 4,,10
+	.p2align 3
+.L215:
+	.loc 1 356 9 view .LVU389
+	.loc 1 356 14 is_stmt 0 view .LVU390
+	incq	%rbx
+.LVL132:
+.L186:
+	.loc 1 350 39 is_stmt 1 view .LVU391
+	incq	%rdx
+.LVL133:
+	.loc 1 350 21 view .LVU392
+	cmpq	%rdx, %rcx
+	je	.L214
+.LVL134:
+.L187:
+	.loc 1 351 7 view .LVU393
+	.loc 1 351 13 is_stmt 0 view .LVU394
+	movzbl	(%rsi,%rdx), %eax
+.LVL135:
+	.loc 1 352 7 is_stmt 1 view .LVU395
+	.loc 1 352 10 is_stmt 0 view .LVU396
+	cmpb	$34, %al
+	je	.L184
+	.loc 1 355 7 is_stmt 1 view .LVU397
+	.loc 1 355 33 is_stmt 0 view .LVU398
+	andl	$-33, %eax
+.LVL136:
+	.loc 1 355 10 view .LVU399
+	cmpb	$91, %al
+	je	.L215
+	.loc 1 358 12 is_stmt 1 view .LVU400
+	.loc 1 358 15 is_stmt 0 view .LVU401
+	cmpb	$93, %al
+	jne	.L186
+.LVL137:
+	.loc 1 358 47 discriminator 1 view .LVU402
+	decq	%rbx
+.LVL138:
+	.loc 1 358 47 discriminator 1 view .LVU403
+	jne	.L186
+.LVL139:
+.L211:
+	.loc 1 359 9 is_stmt 1 view .LVU404
+	.loc 1 359 29 is_stmt 0 view .LVU405
+	movq	%rdx, 16(%rbp)
+	.loc 1 360 9 is_stmt 1 view .LVU406
+.L176:
+	.loc 1 360 9 is_stmt 0 view .LVU407
+.LBE123:
+	.loc 1 342 12 view .LVU408
+	movl	$1, %eax
+	jmp	.L163
+.LVL140:
+.L217:
+.LBB124:
+.LBB125:
+	.loc 1 277 5 is_stmt 1 view .LVU409
+	.loc 1 277 16 is_stmt 0 view .LVU410
+	incq	%rsi
+.LVL141:
+	.loc 1 277 16 view .LVU411
+	movq	%r12, %rdi
+	call	st_structural_next@PLT
+.LVL142:
+	.loc 1 277 16 view .LVU412
+	movq	%rax, %rdx
+.LVL143:
+	.loc 1 278 5 is_stmt 1 view .LVU413
+	.loc 1 278 8 is_stmt 0 view .LVU414
+	cmpq	24(%r12), %rax
+	jne	.L211
+.LVL144:
+	.p2align 4,,10
+	.p2align 3
+.L166:
+	.loc 1 278 8 view .LVU415
+.LBE125:
+.LBE124:
+	.loc 1 319 12 view .LVU416
+	xorl	%eax, %eax
+.L163:
+	.loc 1 372 1 view .LVU417
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL145:
+	.loc 1 372 1 view .LVU418
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL146:
+	.p2align 4,,10
+	.p2align 3
+.L216:
+	.cfi_restore_state
+	.loc 1 337 80 view .LVU419
+	andl	$-33, %eax
+.LVL147:
+	.loc 1 337 87 view .LVU420
+	cmpb	$93, %al
+	je	.L176
+.L181:
+	.loc 1 340 7 is_stmt 1 view .LVU421
+	.loc 1 340 26 is_stmt 0 view .LVU422
+	movq	%rcx, 16(%rbp)
+.LVL148:
+.L178:
+	.loc 1 335 36 is_stmt 1 view .LVU423
+	.loc 1 335 12 is_stmt 0 view .LVU424
+	movl	$2, %esi
+	movq	%rbp, %rdi
+	call	st_ensure@PLT
+.LVL149:
+	.loc 1 335 36 view .LVU425
+	cmpl	$1, %eax
+	jne	.L176
+	.loc 1 336 7 is_stmt 1 view .LVU426
+	.loc 1 336 32 is_stmt 0 view .LVU427
+	movq	16(%rbp), %rax
+	.loc 1 336 13 view .LVU428
+	movq	0(%rbp), %rdx
+	.loc 1 336 32 view .LVU429
+	leaq	1(%rax), %rcx
+	.loc 1 336 13 view .LVU430
+	movzbl	1(%rdx,%rax), %eax
+.LVL150:
+	.loc 1 337 7 is_stmt 1 view .LVU431
+	.loc 1 337 32 is_stmt 0 view .LVU432
+	cmpb	$58, %al
+	ja	.L216
+	.loc 1 337 10 view .LVU433
+	btq	%rax, %rbx
+	jc	.L181
+	jmp	.L176
+	.p2align 4,,10
+	.p2align 3
+.L212:
+	.loc 1 327 5 is_stmt 1 view .LVU434
+.LVL151:
+.LBB133:
+.LBI124:
+	.loc 1 270 12 view .LVU435
+.LBB131:
+	.loc 1 271 3 view .LVU436
+	.loc 1 272 3 view .LVU437
+	.loc 1 273 3 view .LVU438
+	.loc 1 274 3 view .LVU439
+	.loc 1 275 3 view .LVU440
+	.loc 1 275 6 is_stmt 0 view .LVU441
+	cmpb	$34, %al
+	je	.L217
+	.loc 1 282 8 is_stmt 1 view .LVU442
+	.loc 1 282 11 is_stmt 0 view .LVU443
+	cmpb	$91, %dl
+	jne	.L170
+.LBB126:
+	.loc 1 284 5 is_stmt 1 view .LVU444
+	movq	%r12, %rdi
+	call	st_structural_next@PLT
+.LVL152:
+	.loc 1 285 5 view .LVU445
+	.loc 1 286 5 view .LVU446
+	.loc 1 286 12 is_stmt 0 view .LVU447
+	movq	32(%r12), %rdx
+.LVL153:
+	.loc 1 287 5 is_stmt 1 view .LVU448
+	.loc 1 288 7 view .LVU449
+	.loc 1 288 27 is_stmt 0 view .LVU450
+	movq	8(%r12), %rdi
+	.loc 1 288 10 view .LVU451
+	cmpq	%rdx, %rdi
+	je	.L166
+	movq	(%r12), %rax
+	.loc 1 285 12 view .LVU452
+	xorl	%esi, %esi
+	leaq	(%rax,%rdx,8), %rcx
+	jmp	.L174
+.LVL154:
+	.p2align 4,,10
+	.p2align 3
+.L218:
+	.loc 1 293 9 is_stmt 1 view .LVU453
+	.loc 1 293 14 is_stmt 0 view .LVU454
+	incq	%rsi
+.LVL155:
+.L172:
+	.loc 1 298 7 is_stmt 1 view .LVU455
+	.loc 1 298 14 is_stmt 0 view .LVU456
+	incq	%rdx
+.LVL156:
+	.loc 1 287 11 is_stmt 1 view .LVU457
+	.loc 1 287 5 view .LVU458
+	.loc 1 288 7 view .LVU459
+	.loc 1 288 10 is_stmt 0 view .LVU460
+	addq	$8, %rcx
+.LVL157:
+	.loc 1 288 10 view .LVU461
+	cmpq	%rdx, %rdi
+	je	.L166
+.LVL158:
+.L174:
+	.loc 1 291 7 is_stmt 1 view .LVU462
+	.loc 1 292 7 view .LVU463
+	.loc 1 291 13 is_stmt 0 view .LVU464
+	movq	(%rcx), %rax
+	.loc 1 292 33 view .LVU465
+	movzbl	(%rbx,%rax), %eax
+	andl	$-33, %eax
+	.loc 1 292 10 view .LVU466
+	cmpb	$91, %al
+	je	.L218
+	.loc 1 295 12 is_stmt 1 view .LVU467
+	.loc 1 295 15 is_stmt 0 view .LVU468
+	cmpb	$93, %al
+	jne	.L172
+.LVL159:
+	.loc 1 295 47 view .LVU469
+	decq	%rsi
+.LVL160:
+	.loc 1 295 47 view .LVU470
+	jne	.L172
+	.loc 1 300 5 is_stmt 1 view .LVU471
+	.loc 1 300 17 is_stmt 0 view .LVU472
+	movq	%rdx, 32(%r12)
+.LVL161:
+	.loc 1 301 5 is_stmt 1 view .LVU473
+	.loc 1 301 14 is_stmt 0 view .LVU474
+	movq	(%rcx), %rdx
+.LVL162:
+	.loc 1 301 14 view .LVU475
+.LBE126:
+	jmp	.L211
+.LVL163:
+	.p2align 4,,10
+	.p2align 3
+.L184:
+	.loc 1 301 14 view .LVU476
+.LBE131:
+.LBE133:
+.LBB134:
+	.loc 1 363 5 is_stmt 1 view .LVU477
+	.loc 1 363 25 is_stmt 0 view .LVU478
+	movq	%rdx, 16(%rbp)
+	.loc 1 364 5 is_stmt 1 view .LVU479
+	.loc 1 364 8 is_stmt 0 view .LVU480
+	cmpq	%rcx, %rdx
+	jnb	.L179
+	.loc 1 365 7 is_stmt 1 view .LVU481
+	.loc 1 365 11 is_stmt 0 view .LVU482
+	movq	%r12, %rsi
+.LVL164:
+	.loc 1 365 11 view .LVU483
+	movq	%rbp, %rdi
+	call	json_parser_string
+.LVL165:
+	.loc 1 365 10 view .LVU484
+	testl	%eax, %eax
+	je	.L166
+	.loc 1 368 7 is_stmt 1 view .LVU485
+	.loc 1 368 26 is_stmt 0 view .LVU486
+	incq	16(%rbp)
+	jmp	.L179
+.LVL166:
+	.p2align 4,,10
+	.p2align 3
+.L214:
+	.loc 1 363 5 is_stmt 1 view .LVU487
+	.loc 1 363 25 is_stmt 0 view .LVU488
+	movq	%rcx, 16(%rbp)
+.LVL167:
+	.loc 1 364 5 is_stmt 1 view .LVU489
+	jmp	.L179
+.LVL168:
+.L170:
+	.loc 1 364 5 is_stmt 0 view .LVU490
+.LBE134:
+.LBB135:
+.LBB132:
+	.loc 1 305 5 is_stmt 1 view .LVU491
+	.loc 1 305 16 is_stmt 0 view .LVU492
+	incq	%rsi
+.LVL169:
+	.loc 1 305 16 view .LVU493
+	movq	%r12, %rdi
+	call	st_structural_next@PLT
+.LVL170:
+	.loc 1 305 14 view .LVU494
+	leaq	-1(%rax), %rdx
+.LVL171:
+	.loc 1 306 5 is_stmt 1 view .LVU495
+	.loc 1 306 12 view .LVU496
+.LBB127:
+.LBI127:
+	.loc 2 202 19 view .LVU497
+.LBB128:
+	.loc 2 203 3 view .LVU498
+	.loc 2 203 26 is_stmt 0 view .LVU499
+	movq	st_char_classes@GOTPCREL(%rip), %rcx
+	movzbl	-1(%rbx,%rax), %eax
+.LBE128:
+.LBE127:
+	.loc 1 306 12 view .LVU500
+	testb	$1, (%rcx,%rax)
+	je	.L211
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	.loc 1 307 7 is_stmt 1 view .LVU501
+	.loc 1 307 15 is_stmt 0 view .LVU502
+	decq	%rdx
+.LVL172:
+	.loc 1 306 12 is_stmt 1 view .LVU503
+.LBB130:
+	.loc 2 202 19 view .LVU504
+.LBB129:
+	.loc 2 203 3 view .LVU505
+	.loc 2 203 26 is_stmt 0 view .LVU506
+	movzbl	(%rbx,%rdx), %eax
+.LBE129:
+.LBE130:
+	.loc 1 306 12 view .LVU507
+	testb	$1, (%rcx,%rax)
+	jne	.L175
+	jmp	.L211
+.LVL173:
+.L213:
+	.loc 1 306 12 view .LVU508
+.LBE132:
+.LBE135:
+	.loc 1 331 5 is_stmt 1 view .LVU509
+	.loc 1 331 12 is_stmt 0 view .LVU510
+	movq	%rsp, %rsi
+	movq	%rbp, %rdi
+	call	json_parser_string
+.LVL174:
+	.loc 1 331 12 view .LVU511
+	jmp	.L163
+	.cfi_endproc
+.LFE31:
+	.size	st_skip_value, .-st_skip_value
+	.p2align 4
+	.globl	st_find_key
+	.type	st_find_key, @function
+st_find_key:
+.LVL175:
+.LFB32:
+	.loc 1 377 69 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 378 3 view .LVU513
+	.loc 1 377 69 is_stmt 0 view .LVU514
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movq	%rdi, %rbx
+	.loc 1 378 23 view .LVU515
+	movq	%rsi, %rdi
+.LVL176:
+	.loc 1 377 69 view .LVU516
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 378 23 view .LVU517
+	call	strlen@PLT
+.LVL177:
+	.loc 1 381 16 view .LVU518
+	movq	%rbx, %rdi
+	.loc 1 378 23 view .LVU519
+	movq	%rax, %rbp
+.LVL178:
+	.loc 1 379 3 is_stmt 1 view .LVU520
+	.loc 1 381 3 view .LVU521
+	.loc 1 381 16 is_stmt 0 view .LVU522
+	call	st_current_token@PLT
+.LVL179:
+	.loc 1 382 3 is_stmt 1 view .LVU523
+	.loc 1 382 6 is_stmt 0 view .LVU524
+	cmpb	$123, %al
+	je	.L222
+	.loc 1 383 5 is_stmt 1 view .LVU525
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL180:
+	.loc 1 384 5 view .LVU526
+	.loc 1 384 13 is_stmt 0 view .LVU527
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL181:
+	.loc 1 385 5 is_stmt 1 view .LVU528
+	.loc 1 385 8 is_stmt 0 view .LVU529
+	cmpb	$44, %al
+	jne	.L224
+.L222:
+	.loc 1 389 3 is_stmt 1 view .LVU530
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL182:
+	.loc 1 390 3 view .LVU531
+.LBB136:
+	.loc 1 391 9 is_stmt 0 view .LVU532
+	movq	%rsp, %r12
+.LBE136:
+	.loc 1 390 9 view .LVU533
+	jmp	.L221
+	.p2align 4,,10
+	.p2align 3
+.L225:
+.LVL183:
+.LBB137:
+	.loc 1 395 5 is_stmt 1 view .LVU534
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL184:
+	.loc 1 396 5 view .LVU535
+	.loc 1 396 9 is_stmt 0 view .LVU536
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL185:
+	.loc 1 396 8 view .LVU537
+	cmpb	$58, %al
+	jne	.L224
+	.loc 1 399 5 is_stmt 1 view .LVU538
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL186:
+	.loc 1 400 5 view .LVU539
+.L227:
+	.loc 1 404 5 view .LVU540
+	.loc 1 404 9 is_stmt 0 view .LVU541
+	movq	%rbx, %rdi
+	call	st_skip_value@PLT
+.LVL187:
+	.loc 1 404 8 view .LVU542
+	testl	%eax, %eax
+	je	.L224
+	.loc 1 407 5 is_stmt 1 view .LVU543
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL188:
+	.loc 1 408 5 view .LVU544
+	.loc 1 408 9 is_stmt 0 view .LVU545
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL189:
+	.loc 1 408 8 view .LVU546
+	cmpb	$44, %al
+	jne	.L224
+	.loc 1 411 5 is_stmt 1 view .LVU547
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL190:
+.L221:
+	.loc 1 411 5 is_stmt 0 view .LVU548
+.LBE137:
+	.loc 1 390 38 is_stmt 1 view .LVU549
+	.loc 1 390 10 is_stmt 0 view .LVU550
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL191:
+	.loc 1 390 38 view .LVU551
+	cmpb	$34, %al
+	jne	.L224
+.LBB138:
+	.loc 1 391 5 is_stmt 1 view .LVU552
+	.loc 1 391 9 is_stmt 0 view .LVU553
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	json_parser_string
+.LVL192:
+	.loc 1 391 8 view .LVU554
+	testl	%eax, %eax
+	je	.L224
+	.loc 1 394 5 is_stmt 1 view .LVU555
+	.loc 1 394 40 is_stmt 0 view .LVU556
+	cmpq	%rbp, 8(%rsp)
+	jne	.L225
+	.loc 1 394 43 discriminator 1 view .LVU557
+	movq	(%rsp), %rdi
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	call	memcmp@PLT
+.LVL193:
+	.loc 1 395 5 discriminator 1 view .LVU558
+	movq	%rbx, %rdi
+	.loc 1 394 43 discriminator 1 view .LVU559
+	movl	%eax, %r14d
+.LVL194:
+	.loc 1 395 5 is_stmt 1 discriminator 1 view .LVU560
+	call	st_next_token@PLT
+.LVL195:
+	.loc 1 396 5 discriminator 1 view .LVU561
+	.loc 1 396 9 is_stmt 0 discriminator 1 view .LVU562
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL196:
+	.loc 1 396 8 discriminator 1 view .LVU563
+	cmpb	$58, %al
+	jne	.L224
+	.loc 1 399 5 is_stmt 1 view .LVU564
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL197:
+	.loc 1 400 5 view .LVU565
+	.loc 1 400 8 is_stmt 0 view .LVU566
+	testl	%r14d, %r14d
+	jne	.L227
+.LBE138:
+	.loc 1 414 1 view .LVU567
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL198:
+	.loc 1 414 1 view .LVU568
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL199:
+	.loc 1 414 1 view .LVU569
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL200:
+.LBB139:
+	.loc 1 401 14 view .LVU570
+	movl	$1, %eax
+.LBE139:
+	.loc 1 414 1 view .LVU571
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL201:
+	.loc 1 414 1 view .LVU572
+	ret
+.LVL202:
+	.p2align 4,,10
+	.p2align 3
+.L224:
+	.cfi_restore_state
+	.loc 1 414 1 view .LVU573
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL203:
+	.loc 1 414 1 view .LVU574
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL204:
+	.loc 1 414 1 view .LVU575
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL205:
+	.loc 1 386 14 view .LVU576
+	xorl	%eax, %eax
+	.loc 1 414 1 view .LVU577
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	st_find_key, .-st_find_key
+	.p2align 4
+	.globl	st_json_unescape
+	.type	st_json_unescape, @function
+st_json_unescape:
+.LVL206:
+.LFB34:
+	.loc 1 450 83 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 451 3 view .LVU579
+	.loc 1 450 83 is_stmt 0 view .LVU580
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 454 22 view .LVU581
+	movq	8(%rdi), %r14
+	.loc 1 450 83 view .LVU582
+	movq	%rdi, 16(%rsp)
+	movq	%rsi, 8(%rsp)
+	movq	%rdx, 24(%rsp)
+	.loc 1 451 15 view .LVU583
+	movq	(%rdi), %r12
+.LVL207:
+	.loc 1 452 3 is_stmt 1 view .LVU584
+	.loc 1 453 3 view .LVU585
+	.loc 1 454 3 view .LVU586
+	.loc 1 454 16 view .LVU587
+	testq	%r14, %r14
+	je	.L286
+	.loc 1 453 10 is_stmt 0 view .LVU588
+	xorl	%ebp, %ebp
+	.loc 1 452 10 view .LVU589
+	xorl	%r15d, %r15d
+.LVL208:
+	.p2align 4,,10
+	.p2align 3
+.L285:
+.LBB151:
+	.loc 1 456 5 is_stmt 1 view .LVU590
+	.loc 1 456 43 is_stmt 0 view .LVU591
+	movq	%r14, %rbx
+	subq	%r15, %rbx
+	.loc 1 456 57 view .LVU592
+	leaq	(%r12,%r15), %r13
+	.loc 1 456 43 view .LVU593
+	movq	%rbx, %rdx
+	movl	$92, %esi
+	movq	%r13, %rdi
+	call	memchr@PLT
+.LVL209:
+	.loc 1 457 5 is_stmt 1 view .LVU594
+	.loc 1 457 74 is_stmt 0 view .LVU595
+	testq	%rax, %rax
+	je	.L243
+	.loc 1 457 56 discriminator 1 view .LVU596
+	subq	%r12, %rax
+.LVL210:
+	.loc 1 457 74 discriminator 1 view .LVU597
+	movq	%rax, %rbx
+	.loc 1 457 56 discriminator 1 view .LVU598
+	movq	%rax, %r14
+	.loc 1 457 74 discriminator 1 view .LVU599
+	subq	%r15, %rbx
+.L243:
+.LVL211:
+	.loc 1 458 5 is_stmt 1 discriminator 4 view .LVU600
+	.loc 1 458 19 is_stmt 0 discriminator 4 view .LVU601
+	movq	8(%rsp), %rax
+	.loc 1 458 5 discriminator 4 view .LVU602
+	movq	%rbx, %rdx
+	.loc 1 458 19 discriminator 4 view .LVU603
+	leaq	(%rax,%rbp), %rdi
+	.loc 1 458 5 discriminator 4 view .LVU604
+	movq	%r13, %rsi
+	call	memcpy@PLT
+.LVL212:
+	.loc 1 459 5 is_stmt 1 discriminator 4 view .LVU605
+	.loc 1 461 22 is_stmt 0 discriminator 4 view .LVU606
+	movq	16(%rsp), %rax
+	.loc 1 459 13 discriminator 4 view .LVU607
+	addq	%rbp, %rbx
+.LVL213:
+	.loc 1 460 5 is_stmt 1 discriminator 4 view .LVU608
+	.loc 1 461 5 discriminator 4 view .LVU609
+	.loc 1 461 22 is_stmt 0 discriminator 4 view .LVU610
+	movq	8(%rax), %rdx
+	.loc 1 461 8 discriminator 4 view .LVU611
+	cmpq	%r14, %rdx
+	je	.L310
+	.loc 1 464 5 is_stmt 1 view .LVU612
+	.loc 1 464 15 is_stmt 0 view .LVU613
+	leaq	1(%r14), %rax
+	.loc 1 464 8 view .LVU614
+	cmpq	%rax, %rdx
+	je	.L303
+	.loc 1 467 5 is_stmt 1 view .LVU615
+	.loc 1 467 10 is_stmt 0 view .LVU616
+	movzbl	1(%r12,%r14), %eax
+.LVL214:
+	.loc 1 468 5 is_stmt 1 view .LVU617
+	.loc 1 468 11 is_stmt 0 view .LVU618
+	leaq	2(%r14), %r15
+.LVL215:
+	.loc 1 469 5 is_stmt 1 view .LVU619
+	cmpb	$92, %al
+	jle	.L311
+	subl	$98, %eax
+.LVL216:
+	.loc 1 469 5 is_stmt 0 view .LVU620
+	cmpb	$19, %al
+	ja	.L303
+	leaq	.L249(%rip), %rcx
+	movzbl	%al, %eax
+	movslq	(%rcx,%rax,4), %rax
+	addq	%rcx, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L249:
+	.long	.L254-.L249
+	.long	.L303-.L249
+	.long	.L303-.L249
+	.long	.L303-.L249
+	.long	.L253-.L249
+	.long	.L303-.L249
+	.long	.L303-.L249
+	.long	.L303-.L249
+	.long	.L303-.L249
+	.long	.L303-.L249
+	.long	.L303-.L249
+	.long	.L303-.L249
+	.long	.L252-.L249
+	.long	.L303-.L249
+	.long	.L303-.L249
+	.long	.L303-.L249
+	.long	.L251-.L249
+	.long	.L303-.L249
+	.long	.L250-.L249
+	.long	.L248-.L249
+	.text
+.LVL217:
+	.p2align 4,,10
+	.p2align 3
+.L311:
+	.loc 1 469 5 view .LVU621
+	cmpb	$33, %al
+	jle	.L303
+	leal	-34(%rax), %edx
+	movabsq	$288230376151719937, %rsi
+	btq	%rdx, %rsi
+	jc	.L255
+.LVL218:
+.L303:
+	.loc 1 469 5 view .LVU622
+.LBE151:
+	.loc 1 543 1 view .LVU623
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL219:
+	.loc 1 543 1 view .LVU624
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LBB185:
+	.loc 1 465 14 view .LVU625
+	xorl	%eax, %eax
+.LBE185:
+	.loc 1 543 1 view .LVU626
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL220:
+	.p2align 4,,10
+	.p2align 3
+.L248:
+	.cfi_restore_state
+.LBB186:
+.LBB152:
+	.loc 1 497 9 is_stmt 1 view .LVU627
+	.loc 1 497 27 is_stmt 0 view .LVU628
+	leaq	6(%r14), %rsi
+	.loc 1 497 79 view .LVU629
+	cmpq	%rsi, %rdx
+	jb	.L303
+	.loc 1 497 46 discriminator 1 view .LVU630
+	leaq	(%r12,%r15), %r8
+.LVL221:
+.LBB153:
+.LBI153:
+	.loc 1 425 13 is_stmt 1 discriminator 1 view .LVU631
+.LBB154:
+	.loc 1 426 3 discriminator 1 view .LVU632
+	.loc 1 427 3 discriminator 1 view .LVU633
+.LBB155:
+	.loc 1 427 8 discriminator 1 view .LVU634
+	.loc 1 427 21 discriminator 1 view .LVU635
+.LBB156:
+	.loc 1 428 5 discriminator 1 view .LVU636
+	.loc 1 428 10 is_stmt 0 discriminator 1 view .LVU637
+	movzbl	(%r8), %eax
+.LVL222:
+	.loc 1 429 5 is_stmt 1 discriminator 1 view .LVU638
+	.loc 1 430 5 discriminator 1 view .LVU639
+	.loc 1 430 22 is_stmt 0 discriminator 1 view .LVU640
+	leal	-48(%rax), %edi
+	.loc 1 430 8 discriminator 1 view .LVU641
+	cmpb	$9, %dil
+	ja	.L312
+	.loc 1 431 7 is_stmt 1 view .LVU642
+	.loc 1 431 13 is_stmt 0 view .LVU643
+	movsbq	%dil, %rdi
+.LVL223:
+.L260:
+	.loc 1 442 5 is_stmt 1 view .LVU644
+	.loc 1 442 5 is_stmt 0 view .LVU645
+.LBE156:
+	.loc 1 427 27 is_stmt 1 view .LVU646
+	.loc 1 427 21 view .LVU647
+.LBB157:
+	.loc 1 428 5 view .LVU648
+	.loc 1 428 10 is_stmt 0 view .LVU649
+	movzbl	1(%r8), %r9d
+.LVL224:
+	.loc 1 429 5 is_stmt 1 view .LVU650
+	.loc 1 430 5 view .LVU651
+	.loc 1 430 22 is_stmt 0 view .LVU652
+	leal	-48(%r9), %eax
+	.loc 1 430 8 view .LVU653
+	cmpb	$9, %al
+	jbe	.L261
+.L313:
+	.loc 1 433 10 is_stmt 1 view .LVU654
+	.loc 1 433 27 is_stmt 0 view .LVU655
+	leal	-97(%r9), %eax
+	.loc 1 433 13 view .LVU656
+	cmpb	$5, %al
+	jbe	.L262
+	.loc 1 436 10 is_stmt 1 view .LVU657
+	.loc 1 436 27 is_stmt 0 view .LVU658
+	leal	-65(%r9), %eax
+	.loc 1 436 13 view .LVU659
+	cmpb	$5, %al
+	ja	.L303
+	.loc 1 437 7 is_stmt 1 view .LVU660
+	.loc 1 437 13 is_stmt 0 view .LVU661
+	subl	$55, %r9d
+.LVL225:
+	.loc 1 437 13 view .LVU662
+	movsbq	%r9b, %rax
+.LVL226:
+	.loc 1 437 13 view .LVU663
+	jmp	.L263
+.LVL227:
+	.p2align 4,,10
+	.p2align 3
+.L250:
+	.loc 1 437 13 view .LVU664
+.LBE157:
+.LBE155:
+.LBE154:
+.LBE153:
+.LBE152:
+	.loc 1 493 9 is_stmt 1 view .LVU665
+	.loc 1 493 27 is_stmt 0 view .LVU666
+	movq	8(%rsp), %rax
+	.loc 1 493 23 view .LVU667
+	leaq	1(%rbx), %rbp
+.LVL228:
+	.loc 1 493 27 view .LVU668
+	movb	$9, (%rax,%rbx)
+.LVL229:
+	.loc 1 494 9 is_stmt 1 view .LVU669
+	.p2align 4,,10
+	.p2align 3
+.L257:
+	.loc 1 494 9 is_stmt 0 view .LVU670
+.LBE186:
+	.loc 1 454 16 is_stmt 1 view .LVU671
+	.loc 1 454 22 is_stmt 0 view .LVU672
+	movq	16(%rsp), %rax
+	movq	8(%rax), %r14
+	.loc 1 454 16 view .LVU673
+	cmpq	%r14, %r15
+	jb	.L285
+	.loc 1 540 9 view .LVU674
+	addq	%rbp, 8(%rsp)
+.LVL230:
+	.loc 1 540 9 view .LVU675
+	movq	%rbp, %rbx
+.LVL231:
+.L242:
+	.loc 1 540 3 is_stmt 1 view .LVU676
+	.loc 1 540 19 is_stmt 0 view .LVU677
+	movq	8(%rsp), %rax
+	movb	$0, (%rax)
+	.loc 1 541 3 is_stmt 1 view .LVU678
+	.loc 1 541 11 is_stmt 0 view .LVU679
+	movq	24(%rsp), %rax
+	movq	%rbx, (%rax)
+	.loc 1 542 3 is_stmt 1 view .LVU680
+	.loc 1 543 1 is_stmt 0 view .LVU681
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 542 10 view .LVU682
+	movl	$1, %eax
+	.loc 1 543 1 view .LVU683
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL232:
+	.loc 1 543 1 view .LVU684
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL233:
+	.p2align 4,,10
+	.p2align 3
+.L251:
+	.cfi_restore_state
+.LBB187:
+	.loc 1 489 9 is_stmt 1 view .LVU685
+	.loc 1 489 27 is_stmt 0 view .LVU686
+	movq	8(%rsp), %rax
+	.loc 1 489 23 view .LVU687
+	leaq	1(%rbx), %rbp
+.LVL234:
+	.loc 1 489 27 view .LVU688
+	movb	$13, (%rax,%rbx)
+.LVL235:
+	.loc 1 490 9 is_stmt 1 view .LVU689
+	jmp	.L257
+.LVL236:
+	.p2align 4,,10
+	.p2align 3
+.L252:
+	.loc 1 485 9 view .LVU690
+	.loc 1 485 27 is_stmt 0 view .LVU691
+	movq	8(%rsp), %rax
+	.loc 1 485 23 view .LVU692
+	leaq	1(%rbx), %rbp
+.LVL237:
+	.loc 1 485 27 view .LVU693
+	movb	$10, (%rax,%rbx)
+.LVL238:
+	.loc 1 486 9 is_stmt 1 view .LVU694
+	jmp	.L257
+.LVL239:
+	.p2align 4,,10
+	.p2align 3
+.L253:
+	.loc 1 481 9 view .LVU695
+	.loc 1 481 27 is_stmt 0 view .LVU696
+	movq	8(%rsp), %rax
+	.loc 1 481 23 view .LVU697
+	leaq	1(%rbx), %rbp
+.LVL240:
+	.loc 1 481 27 view .LVU698
+	movb	$12, (%rax,%rbx)
+.LVL241:
+	.loc 1 482 9 is_stmt 1 view .LVU699
+	jmp	.L257
+.LVL242:
+	.p2align 4,,10
+	.p2align 3
+.L254:
+	.loc 1 477 9 view .LVU700
+	.loc 1 477 27 is_stmt 0 view .LVU701
+	movq	8(%rsp), %rax
+	.loc 1 477 23 view .LVU702
+	leaq	1(%rbx), %rbp
+.LVL243:
+	.loc 1 477 27 view .LVU703
+	movb	$8, (%rax,%rbx)
+.LVL244:
+	.loc 1 478 9 is_stmt 1 view .LVU704
+	jmp	.L257
+.LVL245:
+	.p2align 4,,10
+	.p2align 3
+.L255:
+	.loc 1 473 9 view .LVU705
+	.loc 1 473 27 is_stmt 0 view .LVU706
+	movq	8(%rsp), %rsi
+	.loc 1 473 23 view .LVU707
+	leaq	1(%rbx), %rbp
+.LVL246:
+	.loc 1 473 27 view .LVU708
+	movb	%al, (%rsi,%rbx)
+	.loc 1 474 9 is_stmt 1 view .LVU709
+	jmp	.L257
+.LVL247:
+	.p2align 4,,10
+	.p2align 3
+.L312:
+.LBB182:
+.LBB167:
+.LBB165:
+.LBB163:
+.LBB158:
+	.loc 1 433 10 view .LVU710
+	.loc 1 433 27 is_stmt 0 view .LVU711
+	leal	-97(%rax), %edi
+	.loc 1 433 13 view .LVU712
+	cmpb	$5, %dil
+	jbe	.L259
+	.loc 1 436 10 is_stmt 1 view .LVU713
+	.loc 1 436 27 is_stmt 0 view .LVU714
+	leal	-65(%rax), %edi
+	.loc 1 436 13 view .LVU715
+	cmpb	$5, %dil
+	ja	.L303
+	.loc 1 437 7 is_stmt 1 view .LVU716
+	.loc 1 428 10 is_stmt 0 view .LVU717
+	movzbl	1(%r8), %r9d
+	.loc 1 437 13 view .LVU718
+	subl	$55, %eax
+.LVL248:
+	.loc 1 437 13 view .LVU719
+	movsbq	%al, %rdi
+.LVL249:
+	.loc 1 442 5 is_stmt 1 view .LVU720
+	.loc 1 442 5 is_stmt 0 view .LVU721
+.LBE158:
+	.loc 1 427 27 is_stmt 1 view .LVU722
+	.loc 1 427 21 view .LVU723
+.LBB159:
+	.loc 1 428 5 view .LVU724
+	.loc 1 429 5 view .LVU725
+	.loc 1 430 5 view .LVU726
+	.loc 1 430 22 is_stmt 0 view .LVU727
+	leal	-48(%r9), %eax
+	.loc 1 430 8 view .LVU728
+	cmpb	$9, %al
+	ja	.L313
+.L261:
+	.loc 1 431 7 is_stmt 1 view .LVU729
+	.loc 1 431 13 is_stmt 0 view .LVU730
+	movsbq	%al, %rax
+.LVL250:
+.L263:
+	.loc 1 442 5 is_stmt 1 view .LVU731
+	.loc 1 428 10 is_stmt 0 view .LVU732
+	movzbl	2(%r8), %r9d
+	.loc 1 442 20 view .LVU733
+	salq	$4, %rdi
+.LVL251:
+	.loc 1 442 11 view .LVU734
+	orq	%rax, %rdi
+.LVL252:
+	.loc 1 442 11 view .LVU735
+.LBE159:
+	.loc 1 427 27 is_stmt 1 view .LVU736
+	.loc 1 427 21 view .LVU737
+.LBB160:
+	.loc 1 428 5 view .LVU738
+	.loc 1 429 5 view .LVU739
+	.loc 1 430 5 view .LVU740
+	.loc 1 430 22 is_stmt 0 view .LVU741
+	leal	-48(%r9), %eax
+.LVL253:
+	.loc 1 430 8 view .LVU742
+	cmpb	$9, %al
+	jbe	.L264
+	.loc 1 433 10 is_stmt 1 view .LVU743
+	.loc 1 433 27 is_stmt 0 view .LVU744
+	leal	-97(%r9), %eax
+	.loc 1 433 13 view .LVU745
+	cmpb	$5, %al
+	jbe	.L265
+	.loc 1 436 10 is_stmt 1 view .LVU746
+	.loc 1 436 27 is_stmt 0 view .LVU747
+	leal	-65(%r9), %eax
+	.loc 1 436 13 view .LVU748
+	cmpb	$5, %al
+	ja	.L303
+	.loc 1 437 7 is_stmt 1 view .LVU749
+	.loc 1 437 13 is_stmt 0 view .LVU750
+	subl	$55, %r9d
+.LVL254:
+	.loc 1 437 13 view .LVU751
+	movsbq	%r9b, %rax
+.LVL255:
+	.loc 1 437 13 view .LVU752
+	jmp	.L266
+.LVL256:
+	.p2align 4,,10
+	.p2align 3
+.L264:
+	.loc 1 431 7 is_stmt 1 view .LVU753
+	.loc 1 431 13 is_stmt 0 view .LVU754
+	movsbq	%al, %rax
+.LVL257:
+.L266:
+	.loc 1 442 5 is_stmt 1 view .LVU755
+	.loc 1 428 10 is_stmt 0 view .LVU756
+	movzbl	3(%r8), %r8d
+.LVL258:
+	.loc 1 442 20 view .LVU757
+	salq	$4, %rdi
+.LVL259:
+	.loc 1 442 11 view .LVU758
+	orq	%rax, %rdi
+.LVL260:
+	.loc 1 442 11 view .LVU759
+.LBE160:
+	.loc 1 427 27 is_stmt 1 view .LVU760
+	.loc 1 427 21 view .LVU761
+.LBB161:
+	.loc 1 428 5 view .LVU762
+	.loc 1 429 5 view .LVU763
+	.loc 1 430 5 view .LVU764
+	.loc 1 430 22 is_stmt 0 view .LVU765
+	leal	-48(%r8), %eax
+.LVL261:
+	.loc 1 430 8 view .LVU766
+	cmpb	$9, %al
+	jbe	.L267
+	.loc 1 433 10 is_stmt 1 view .LVU767
+	.loc 1 433 27 is_stmt 0 view .LVU768
+	leal	-97(%r8), %eax
+	.loc 1 433 13 view .LVU769
+	cmpb	$5, %al
+	jbe	.L268
+	.loc 1 436 10 is_stmt 1 view .LVU770
+	.loc 1 436 27 is_stmt 0 view .LVU771
+	leal	-65(%r8), %eax
+	.loc 1 436 13 view .LVU772
+	cmpb	$5, %al
+	ja	.L303
+	.loc 1 437 7 is_stmt 1 view .LVU773
+	.loc 1 437 13 is_stmt 0 view .LVU774
+	subl	$55, %r8d
+.LVL262:
+	.loc 1 437 13 view .LVU775
+	movsbq	%r8b, %rax
+.LVL263:
+	.loc 1 437 13 view .LVU776
+	jmp	.L269
+.LVL264:
+	.p2align 4,,10
+	.p2align 3
+.L267:
+	.loc 1 431 7 is_stmt 1 view .LVU777
+	.loc 1 431 13 is_stmt 0 view .LVU778
+	movsbq	%al, %rax
+.LVL265:
+.L269:
+	.loc 1 442 5 is_stmt 1 view .LVU779
+	.loc 1 442 20 is_stmt 0 view .LVU780
+	salq	$4, %rdi
+.LVL266:
+	.loc 1 442 11 view .LVU781
+	orq	%rdi, %rax
+.LVL267:
+	.loc 1 442 11 view .LVU782
+.LBE161:
+	.loc 1 427 27 is_stmt 1 view .LVU783
+	.loc 1 427 21 view .LVU784
+	.loc 1 427 21 is_stmt 0 view .LVU785
+.LBE163:
+.LBE165:
+.LBE167:
+	.loc 1 498 9 is_stmt 1 view .LVU786
+	.loc 1 501 9 view .LVU787
+	.loc 1 503 9 view .LVU788
+	.loc 1 503 28 is_stmt 0 view .LVU789
+	leaq	-55296(%rax), %rdi
+	.loc 1 503 12 view .LVU790
+	cmpq	$1023, %rdi
+	ja	.L270
+.LBB168:
+	.loc 1 504 11 is_stmt 1 view .LVU791
+.LVL268:
+	.loc 1 504 28 is_stmt 0 view .LVU792
+	leaq	12(%r14), %r15
+	.loc 1 504 137 view .LVU793
+	cmpq	%r15, %rdx
+	jb	.L303
+	.loc 1 504 45 discriminator 1 view .LVU794
+	cmpb	$92, (%r12,%rsi)
+	jne	.L303
+	.loc 1 504 70 discriminator 3 view .LVU795
+	cmpb	$117, 7(%r12,%r14)
+	jne	.L303
+	.loc 1 504 100 discriminator 5 view .LVU796
+	leaq	8(%r12,%r14), %rcx
+.LVL269:
+.LBB169:
+.LBI169:
+	.loc 1 425 13 is_stmt 1 discriminator 5 view .LVU797
+.LBB170:
+	.loc 1 426 3 discriminator 5 view .LVU798
+	.loc 1 427 3 discriminator 5 view .LVU799
+.LBB171:
+	.loc 1 427 8 discriminator 5 view .LVU800
+	.loc 1 427 21 discriminator 5 view .LVU801
+.LBB172:
+	.loc 1 428 5 discriminator 5 view .LVU802
+	.loc 1 428 10 is_stmt 0 discriminator 5 view .LVU803
+	movzbl	(%rcx), %edx
+.LVL270:
+	.loc 1 429 5 is_stmt 1 discriminator 5 view .LVU804
+	.loc 1 430 5 discriminator 5 view .LVU805
+	.loc 1 430 22 is_stmt 0 discriminator 5 view .LVU806
+	leal	-48(%rdx), %eax
+.LVL271:
+	.loc 1 430 8 discriminator 5 view .LVU807
+	cmpb	$9, %al
+	jbe	.L271
+	.loc 1 433 10 is_stmt 1 view .LVU808
+	.loc 1 433 27 is_stmt 0 view .LVU809
+	leal	-97(%rdx), %eax
+	.loc 1 433 13 view .LVU810
+	cmpb	$5, %al
+	jbe	.L272
+	.loc 1 436 10 is_stmt 1 view .LVU811
+	.loc 1 436 27 is_stmt 0 view .LVU812
+	leal	-65(%rdx), %eax
+	.loc 1 436 13 view .LVU813
+	cmpb	$5, %al
+	ja	.L303
+	.loc 1 437 7 is_stmt 1 view .LVU814
+	.loc 1 437 13 is_stmt 0 view .LVU815
+	subl	$55, %edx
+.LVL272:
+	.loc 1 437 13 view .LVU816
+	movsbq	%dl, %rax
+.LVL273:
+.L273:
+	.loc 1 442 5 is_stmt 1 view .LVU817
+	.loc 1 442 5 is_stmt 0 view .LVU818
+.LBE172:
+	.loc 1 427 27 is_stmt 1 view .LVU819
+	.loc 1 427 21 view .LVU820
+.LBB173:
+	.loc 1 428 5 view .LVU821
+	.loc 1 428 10 is_stmt 0 view .LVU822
+	movzbl	1(%rcx), %esi
+.LVL274:
+	.loc 1 429 5 is_stmt 1 view .LVU823
+	.loc 1 430 5 view .LVU824
+	.loc 1 430 22 is_stmt 0 view .LVU825
+	leal	-48(%rsi), %edx
+	.loc 1 430 8 view .LVU826
+	cmpb	$9, %dl
+	jbe	.L274
+	.loc 1 433 10 is_stmt 1 view .LVU827
+	.loc 1 433 27 is_stmt 0 view .LVU828
+	leal	-97(%rsi), %edx
+	.loc 1 433 13 view .LVU829
+	cmpb	$5, %dl
+	jbe	.L275
+	.loc 1 436 10 is_stmt 1 view .LVU830
+	.loc 1 436 27 is_stmt 0 view .LVU831
+	leal	-65(%rsi), %edx
+	.loc 1 436 13 view .LVU832
+	cmpb	$5, %dl
+	ja	.L303
+	.loc 1 437 7 is_stmt 1 view .LVU833
+	.loc 1 437 13 is_stmt 0 view .LVU834
+	subl	$55, %esi
+.LVL275:
+	.loc 1 437 13 view .LVU835
+	movsbq	%sil, %rdx
+.LVL276:
+.L276:
+	.loc 1 442 5 is_stmt 1 view .LVU836
+	.loc 1 428 10 is_stmt 0 view .LVU837
+	movzbl	2(%rcx), %esi
+	.loc 1 442 20 view .LVU838
+	salq	$4, %rax
+.LVL277:
+	.loc 1 442 11 view .LVU839
+	orq	%rdx, %rax
+.LVL278:
+	.loc 1 442 11 view .LVU840
+.LBE173:
+	.loc 1 427 27 is_stmt 1 view .LVU841
+	.loc 1 427 21 view .LVU842
+.LBB174:
+	.loc 1 428 5 view .LVU843
+	.loc 1 429 5 view .LVU844
+	.loc 1 430 5 view .LVU845
+	.loc 1 430 22 is_stmt 0 view .LVU846
+	leal	-48(%rsi), %edx
+.LVL279:
+	.loc 1 430 8 view .LVU847
+	cmpb	$9, %dl
+	jbe	.L277
+	.loc 1 433 10 is_stmt 1 view .LVU848
+	.loc 1 433 27 is_stmt 0 view .LVU849
+	leal	-97(%rsi), %edx
+	.loc 1 433 13 view .LVU850
+	cmpb	$5, %dl
+	jbe	.L278
+	.loc 1 436 10 is_stmt 1 view .LVU851
+	.loc 1 436 27 is_stmt 0 view .LVU852
+	leal	-65(%rsi), %edx
+	.loc 1 436 13 view .LVU853
+	cmpb	$5, %dl
+	ja	.L303
+	.loc 1 437 7 is_stmt 1 view .LVU854
+	.loc 1 437 13 is_stmt 0 view .LVU855
+	subl	$55, %esi
+.LVL280:
+	.loc 1 437 13 view .LVU856
+	movsbq	%sil, %rdx
+.LVL281:
+.L279:
+	.loc 1 442 5 is_stmt 1 view .LVU857
+	.loc 1 428 10 is_stmt 0 view .LVU858
+	movzbl	3(%rcx), %ecx
+.LVL282:
+	.loc 1 442 20 view .LVU859
+	salq	$4, %rax
+.LVL283:
+	.loc 1 442 11 view .LVU860
+	orq	%rax, %rdx
+.LVL284:
+	.loc 1 442 11 view .LVU861
+.LBE174:
+	.loc 1 427 27 is_stmt 1 view .LVU862
+	.loc 1 427 21 view .LVU863
+.LBB175:
+	.loc 1 428 5 view .LVU864
+	.loc 1 429 5 view .LVU865
+	.loc 1 430 5 view .LVU866
+	.loc 1 430 22 is_stmt 0 view .LVU867
+	leal	-48(%rcx), %eax
+	.loc 1 430 8 view .LVU868
+	cmpb	$9, %al
+	jbe	.L280
+	.loc 1 433 10 is_stmt 1 view .LVU869
+	.loc 1 433 27 is_stmt 0 view .LVU870
+	leal	-97(%rcx), %eax
+	.loc 1 433 13 view .LVU871
+	cmpb	$5, %al
+	jbe	.L281
+	.loc 1 436 10 is_stmt 1 view .LVU872
+	.loc 1 436 27 is_stmt 0 view .LVU873
+	leal	-65(%rcx), %eax
+	.loc 1 436 13 view .LVU874
+	cmpb	$5, %al
+	ja	.L303
+	.loc 1 437 7 is_stmt 1 view .LVU875
+	.loc 1 437 13 is_stmt 0 view .LVU876
+	subl	$55, %ecx
+.LVL285:
+	.loc 1 437 13 view .LVU877
+	movsbq	%cl, %rax
+.LVL286:
+.L282:
+	.loc 1 442 5 is_stmt 1 view .LVU878
+	.loc 1 442 20 is_stmt 0 view .LVU879
+	salq	$4, %rdx
+.LVL287:
+	.loc 1 442 11 view .LVU880
+	orq	%rdx, %rax
+.LVL288:
+	.loc 1 442 11 view .LVU881
+.LBE175:
+	.loc 1 427 27 is_stmt 1 view .LVU882
+	.loc 1 427 21 view .LVU883
+	.loc 1 427 21 is_stmt 0 view .LVU884
+.LBE171:
+.LBE170:
+.LBE169:
+	.loc 1 505 11 is_stmt 1 view .LVU885
+	.loc 1 505 28 is_stmt 0 view .LVU886
+	subq	$56320, %rax
+.LVL289:
+	.loc 1 505 14 view .LVU887
+	cmpq	$1023, %rax
+	ja	.L303
+	.loc 1 508 11 is_stmt 1 view .LVU888
+	.loc 1 508 45 is_stmt 0 view .LVU889
+	salq	$10, %rdi
+.LVL290:
+	.loc 1 508 16 view .LVU890
+	leaq	65536(%rax,%rdi), %rax
+.LVL291:
+	.loc 1 509 11 is_stmt 1 view .LVU891
+	.loc 1 509 11 is_stmt 0 view .LVU892
+.LBE168:
+	.loc 1 515 9 is_stmt 1 view .LVU893
+	.loc 1 518 14 view .LVU894
+	.loc 1 528 11 view .LVU895
+	.loc 1 528 51 is_stmt 0 view .LVU896
+	movq	%rax, %rdx
+	.loc 1 528 31 view .LVU897
+	movq	8(%rsp), %rsi
+	.loc 1 528 51 view .LVU898
+	sarq	$18, %rdx
+	.loc 1 528 31 view .LVU899
+	orl	$-16, %edx
+	movb	%dl, (%rsi,%rbx)
+.LVL292:
+	.loc 1 529 11 is_stmt 1 view .LVU900
+	.loc 1 529 52 is_stmt 0 view .LVU901
+	movq	%rax, %rdx
+	sarq	$12, %rdx
+	.loc 1 529 59 view .LVU902
+	andl	$63, %edx
+	.loc 1 529 31 view .LVU903
+	orl	$-128, %edx
+	movb	%dl, 1(%rsi,%rbx)
+	.loc 1 530 11 is_stmt 1 view .LVU904
+.LVL293:
+	.loc 1 530 52 is_stmt 0 view .LVU905
+	movq	%rax, %rdx
+	sarq	$6, %rdx
+	.loc 1 530 58 view .LVU906
+	andl	$63, %edx
+	.loc 1 531 51 view .LVU907
+	andl	$63, %eax
+.LVL294:
+	.loc 1 530 31 view .LVU908
+	orl	$-128, %edx
+	.loc 1 531 31 view .LVU909
+	orl	$-128, %eax
+	.loc 1 530 31 view .LVU910
+	movb	%dl, 2(%rsi,%rbx)
+	.loc 1 531 11 is_stmt 1 view .LVU911
+	.loc 1 531 31 is_stmt 0 view .LVU912
+	movb	%al, 3(%rsi,%rbx)
+	.loc 1 531 25 view .LVU913
+	leaq	4(%rbx), %rbp
+.LVL295:
+	.loc 1 531 25 view .LVU914
+	jmp	.L257
+.LVL296:
+	.p2align 4,,10
+	.p2align 3
+.L270:
+	.loc 1 511 14 is_stmt 1 view .LVU915
+	.loc 1 511 33 is_stmt 0 view .LVU916
+	leaq	-56320(%rax), %rdx
+	.loc 1 511 17 view .LVU917
+	cmpq	$1023, %rdx
+	jbe	.L303
+	.loc 1 515 9 is_stmt 1 view .LVU918
+.LBE182:
+	.loc 1 473 15 is_stmt 0 view .LVU919
+	movq	8(%rsp), %rcx
+	.loc 1 473 23 view .LVU920
+	leaq	1(%rbx), %rbp
+.LVL297:
+	.loc 1 473 15 view .LVU921
+	leaq	(%rcx,%rbx), %rdi
+.LBB183:
+	.loc 1 515 12 view .LVU922
+	cmpq	$127, %rax
+	jle	.L314
+	.loc 1 520 51 view .LVU923
+	movl	%eax, %r8d
+	.loc 1 519 51 view .LVU924
+	movq	%rax, %rdx
+	.loc 1 520 51 view .LVU925
+	andl	$63, %r8d
+	.loc 1 520 17 view .LVU926
+	addq	%rbp, %rcx
+	.loc 1 518 14 is_stmt 1 view .LVU927
+	.loc 1 519 51 is_stmt 0 view .LVU928
+	sarq	$6, %rdx
+	.loc 1 529 25 view .LVU929
+	leaq	2(%rbx), %rbp
+	.loc 1 520 31 view .LVU930
+	orl	$-128, %r8d
+	.loc 1 518 17 view .LVU931
+	cmpq	$2047, %rax
+	jle	.L315
+	.loc 1 522 14 is_stmt 1 view .LVU932
+	.loc 1 523 11 view .LVU933
+	.loc 1 523 51 is_stmt 0 view .LVU934
+	sarq	$12, %rax
+.LVL298:
+	.loc 1 523 31 view .LVU935
+	orl	$-32, %eax
+	movb	%al, (%rdi)
+.LVL299:
+	.loc 1 524 11 is_stmt 1 view .LVU936
+	.loc 1 524 58 is_stmt 0 view .LVU937
+	andl	$63, %edx
+	.loc 1 525 29 view .LVU938
+	movq	8(%rsp), %rax
+	.loc 1 524 31 view .LVU939
+	orl	$-128, %edx
+	movb	%dl, (%rcx)
+	.loc 1 525 11 is_stmt 1 view .LVU940
+.LVL300:
+	.loc 1 525 25 is_stmt 0 view .LVU941
+	leaq	3(%rbx), %rbp
+.LVL301:
+	.loc 1 525 29 view .LVU942
+	movb	%r8b, 2(%rax,%rbx)
+	.loc 1 501 15 view .LVU943
+	movq	%rsi, %r15
+	jmp	.L257
+.LVL302:
+	.p2align 4,,10
+	.p2align 3
+.L314:
+	.loc 1 516 11 is_stmt 1 view .LVU944
+	.loc 1 516 29 is_stmt 0 view .LVU945
+	movb	%al, (%rdi)
+.LVL303:
+	.loc 1 516 29 view .LVU946
+	movq	%rsi, %r15
+	jmp	.L257
+.LVL304:
+	.p2align 4,,10
+	.p2align 3
+.L259:
+.LBB180:
+.LBB166:
+.LBB164:
+.LBB162:
+	.loc 1 434 7 is_stmt 1 view .LVU947
+	.loc 1 434 13 is_stmt 0 view .LVU948
+	subl	$87, %eax
+.LVL305:
+	.loc 1 434 13 view .LVU949
+	movsbq	%al, %rdi
+.LVL306:
+	.loc 1 434 13 view .LVU950
+	jmp	.L260
+.LVL307:
+	.p2align 4,,10
+	.p2align 3
+.L262:
+	.loc 1 434 7 is_stmt 1 view .LVU951
+	.loc 1 434 13 is_stmt 0 view .LVU952
+	subl	$87, %r9d
+.LVL308:
+	.loc 1 434 13 view .LVU953
+	movsbq	%r9b, %rax
+.LVL309:
+	.loc 1 434 13 view .LVU954
+	jmp	.L263
+.LVL310:
+	.p2align 4,,10
+	.p2align 3
+.L265:
+	.loc 1 434 7 is_stmt 1 view .LVU955
+	.loc 1 434 13 is_stmt 0 view .LVU956
+	subl	$87, %r9d
+.LVL311:
+	.loc 1 434 13 view .LVU957
+	movsbq	%r9b, %rax
+.LVL312:
+	.loc 1 434 13 view .LVU958
+	jmp	.L266
+.LVL313:
+	.p2align 4,,10
+	.p2align 3
+.L268:
+	.loc 1 434 7 is_stmt 1 view .LVU959
+	.loc 1 434 13 is_stmt 0 view .LVU960
+	subl	$87, %r8d
+.LVL314:
+	.loc 1 434 13 view .LVU961
+	movsbq	%r8b, %rax
+.LVL315:
+	.loc 1 434 13 view .LVU962
+	jmp	.L269
+.LVL316:
+	.p2align 4,,10
+	.p2align 3
+.L315:
+	.loc 1 434 13 view .LVU963
+.LBE162:
+.LBE164:
+.LBE166:
+.LBE180:
+	.loc 1 519 11 is_stmt 1 view .LVU964
+	.loc 1 519 31 is_stmt 0 view .LVU965
+	orl	$-64, %edx
+	movb	%dl, (%rdi)
+.LVL317:
+	.loc 1 520 11 is_stmt 1 view .LVU966
+	.loc 1 520 11 is_stmt 0 view .LVU967
+	movq	%rsi, %r15
+	.loc 1 520 29 view .LVU968
+	movb	%r8b, (%rcx)
+.LVL318:
+	.loc 1 520 29 view .LVU969
+	jmp	.L257
+.LVL319:
+	.p2align 4,,10
+	.p2align 3
+.L310:
+	.loc 1 520 29 view .LVU970
+.LBE183:
+	.loc 1 473 15 view .LVU971
+	addq	%rbx, 8(%rsp)
+.LVL320:
+	.loc 1 473 15 view .LVU972
+	jmp	.L242
+.LVL321:
+.L286:
+	.loc 1 473 15 view .LVU973
+.LBE187:
+	.loc 1 453 10 view .LVU974
+	xorl	%ebx, %ebx
+	jmp	.L242
+.LVL322:
+.L280:
+.LBB188:
+.LBB184:
+.LBB181:
+.LBB179:
+.LBB178:
+.LBB177:
+.LBB176:
+	.loc 1 431 7 is_stmt 1 view .LVU975
+	.loc 1 431 13 is_stmt 0 view .LVU976
+	movsbq	%al, %rax
+.LVL323:
+	.loc 1 431 13 view .LVU977
+	jmp	.L282
+.LVL324:
+.L277:
+	.loc 1 431 7 is_stmt 1 view .LVU978
+	.loc 1 431 13 is_stmt 0 view .LVU979
+	movsbq	%dl, %rdx
+.LVL325:
+	.loc 1 431 13 view .LVU980
+	jmp	.L279
+.LVL326:
+.L274:
+	.loc 1 431 7 is_stmt 1 view .LVU981
+	.loc 1 431 13 is_stmt 0 view .LVU982
+	movsbq	%dl, %rdx
+.LVL327:
+	.loc 1 431 13 view .LVU983
+	jmp	.L276
+.LVL328:
+.L271:
+	.loc 1 431 7 is_stmt 1 view .LVU984
+	.loc 1 431 13 is_stmt 0 view .LVU985
+	movsbq	%al, %rax
+.LVL329:
+	.loc 1 431 13 view .LVU986
+	jmp	.L273
+.LVL330:
+.L275:
+	.loc 1 434 7 is_stmt 1 view .LVU987
+	.loc 1 434 13 is_stmt 0 view .LVU988
+	subl	$87, %esi
+.LVL331:
+	.loc 1 434 13 view .LVU989
+	movsbq	%sil, %rdx
+.LVL332:
+	.loc 1 434 13 view .LVU990
+	jmp	.L276
+.LVL333:
+.L272:
+	.loc 1 434 7 is_stmt 1 view .LVU991
+	.loc 1 434 13 is_stmt 0 view .LVU992
+	subl	$87, %edx
+.LVL334:
+	.loc 1 434 13 view .LVU993
+	movsbq	%dl, %rax
+.LVL335:
+	.loc 1 434 13 view .LVU994
+	jmp	.L273
+.LVL336:
+.L281:
+	.loc 1 434 7 is_stmt 1 view .LVU995
+	.loc 1 434 13 is_stmt 0 view .LVU996
+	subl	$87, %ecx
+.LVL337:
+	.loc 1 434 13 view .LVU997
+	movsbq	%cl, %rax
+.LVL338:
+	.loc 1 434 13 view .LVU998
+	jmp	.L282
+.LVL339:
+.L278:
+	.loc 1 434 7 is_stmt 1 view .LVU999
+	.loc 1 434 13 is_stmt 0 view .LVU1000
+	subl	$87, %esi
+.LVL340:
+	.loc 1 434 13 view .LVU1001
+	movsbq	%sil, %rdx
+.LVL341:
+	.loc 1 434 13 view .LVU1002
+	jmp	.L279
+.LBE176:
+.LBE177:
+.LBE178:
+.LBE179:
+.LBE181:
+.LBE184:
+.LBE188:
+	.cfi_endproc
+.LFE34:
+	.size	st_json_unescape, .-st_json_unescape
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "/usr/include/string.h"
+	.file 8 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1605
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x31
+	.long	.LASF134
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xf
+	.long	.LASF9
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x10
+	.long	0x2e
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x10
+	.long	0x69
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xf
+	.long	.LASF10
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x5b
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0xf
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x33
+	.byte	0x8
+	.uleb128 0xf
+	.long	.LASF13
+	.byte	0x4
+	.byte	0xc2
+	.byte	0x12
+	.long	0x4d
+	.uleb128 0x6
+	.long	0xae
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0x10
+	.long	0xae
+	.uleb128 0xf
+	.long	.LASF15
+	.byte	0x5
+	.byte	0x6c
+	.byte	0x13
+	.long	0x9d
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF16
+	.uleb128 0x6
+	.long	0xd2
+	.uleb128 0x34
+	.uleb128 0x6
+	.long	0xb5
+	.uleb128 0xf
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x18
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x10
+	.long	0xd8
+	.uleb128 0xf
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x35
+	.long	.LASF26
+	.byte	0x10
+	.byte	0x2
+	.byte	0xd
+	.byte	0x8
+	.long	0x11b
+	.uleb128 0x23
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0xd3
+	.byte	0
+	.uleb128 0x23
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.long	0xf5
+	.uleb128 0x24
+	.long	.LASF48
+	.long	0x69
+	.byte	0x2
+	.byte	0x7a
+	.long	0x15a
+	.uleb128 0x7
+	.long	.LASF19
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF20
+	.byte	0x2
+	.uleb128 0x7
+	.long	.LASF21
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF22
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF23
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF24
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF25
+	.byte	0x40
+	.byte	0
+	.uleb128 0x1b
+	.long	0xe4
+	.long	0x16a
+	.uleb128 0x25
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x10
+	.long	0x15a
+	.uleb128 0x36
+	.long	.LASF102
+	.byte	0x2
+	.byte	0xa6
+	.byte	0x16
+	.long	0x16a
+	.uleb128 0x16
+	.long	.LASF27
+	.byte	0x18
+	.value	0x175
+	.long	0x1af
+	.uleb128 0x2
+	.long	.LASF28
+	.value	0x17a
+	.byte	0x1c
+	.long	0x1b4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF29
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF30
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF135
+	.uleb128 0x6
+	.long	0x1af
+	.uleb128 0xa
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF31
+	.uleb128 0x16
+	.long	.LASF32
+	.byte	0x40
+	.value	0x1e6
+	.long	0x235
+	.uleb128 0x2
+	.long	.LASF33
+	.value	0x1eb
+	.byte	0xc
+	.long	0xe9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF34
+	.value	0x1f0
+	.byte	0xc
+	.long	0xe9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF35
+	.value	0x1f5
+	.byte	0xc
+	.long	0xe9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF36
+	.value	0x1fa
+	.byte	0xc
+	.long	0xe9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF37
+	.value	0x1ff
+	.byte	0xc
+	.long	0xe9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF38
+	.value	0x204
+	.byte	0xc
+	.long	0xe9
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF39
+	.value	0x209
+	.byte	0xc
+	.long	0xe9
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF40
+	.value	0x20e
+	.byte	0xc
+	.long	0xe9
+	.byte	0x38
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF41
+	.byte	0x38
+	.value	0x26c
+	.long	0x2a9
+	.uleb128 0x2
+	.long	.LASF42
+	.value	0x272
+	.byte	0xd
+	.long	0x2c2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF43
+	.value	0x277
+	.byte	0x9
+	.long	0x9b
+	.byte	0x8
+	.uleb128 0x1c
+	.string	"fd"
+	.value	0x27c
+	.byte	0x7
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF44
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF45
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF46
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x1c
+	.string	"eof"
+	.value	0x290
+	.byte	0x7
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF47
+	.value	0x295
+	.byte	0x7
+	.long	0x46
+	.byte	0x34
+	.byte	0
+	.uleb128 0x17
+	.long	0xba
+	.long	0x2c2
+	.uleb128 0x3
+	.long	0x9b
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	0x2a9
+	.uleb128 0x26
+	.long	.LASF49
+	.long	0x69
+	.value	0x29b
+	.long	0x2e3
+	.uleb128 0x7
+	.long	.LASF50
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF51
+	.byte	0x1
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF52
+	.long	0x69
+	.value	0x2b5
+	.long	0x30b
+	.uleb128 0x7
+	.long	.LASF53
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF54
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF55
+	.byte	0x2
+	.uleb128 0x7
+	.long	.LASF56
+	.byte	0x3
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF57
+	.value	0x158
+	.byte	0x2
+	.value	0x2cf
+	.byte	0x8
+	.long	0x3b9
+	.uleb128 0x2
+	.long	.LASF58
+	.value	0x2d4
+	.byte	0x9
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF59
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF60
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF61
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF62
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x2c7
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF63
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF64
+	.value	0x2f2
+	.byte	0x18
+	.long	0x3b9
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF65
+	.value	0x2f7
+	.byte	0x18
+	.long	0x2e3
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF66
+	.value	0x2fc
+	.byte	0x17
+	.long	0x3be
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF67
+	.value	0x301
+	.byte	0x8
+	.long	0x3c3
+	.byte	0x48
+	.uleb128 0x27
+	.long	.LASF68
+	.value	0x306
+	.byte	0x21
+	.long	0x421
+	.value	0x148
+	.uleb128 0x27
+	.long	.LASF69
+	.value	0x30b
+	.byte	0x17
+	.long	0x426
+	.value	0x150
+	.byte	0
+	.uleb128 0x6
+	.long	0x235
+	.uleb128 0x6
+	.long	0x17b
+	.uleb128 0x1b
+	.long	0xae
+	.long	0x3d3
+	.uleb128 0x25
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF70
+	.byte	0x28
+	.value	0x764
+	.long	0x421
+	.uleb128 0x2
+	.long	.LASF71
+	.value	0x769
+	.byte	0xb
+	.long	0x522
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF72
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF73
+	.value	0x774
+	.byte	0xd
+	.long	0x527
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF59
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF74
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0x3d3
+	.uleb128 0x6
+	.long	0x1c0
+	.uleb128 0x16
+	.long	.LASF75
+	.byte	0x48
+	.value	0x6dc
+	.long	0x4ad
+	.uleb128 0x2
+	.long	.LASF76
+	.value	0x6e1
+	.byte	0x9
+	.long	0x4c1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF77
+	.value	0x6e6
+	.byte	0x9
+	.long	0x4c1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF78
+	.value	0x6eb
+	.byte	0x9
+	.long	0x4c1
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF79
+	.value	0x6f0
+	.byte	0x9
+	.long	0x4c1
+	.byte	0x18
+	.uleb128 0x1c
+	.string	"key"
+	.value	0x6f5
+	.byte	0x9
+	.long	0x4df
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF58
+	.value	0x6fa
+	.byte	0x9
+	.long	0x4df
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF80
+	.value	0x6ff
+	.byte	0x9
+	.long	0x504
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF81
+	.value	0x704
+	.byte	0x9
+	.long	0x51d
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF82
+	.value	0x709
+	.byte	0x9
+	.long	0x4c1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x10
+	.long	0x42b
+	.uleb128 0x17
+	.long	0x46
+	.long	0x4c1
+	.uleb128 0x3
+	.long	0x9b
+	.byte	0
+	.uleb128 0x6
+	.long	0x4b2
+	.uleb128 0x17
+	.long	0x46
+	.long	0x4da
+	.uleb128 0x3
+	.long	0x9b
+	.uleb128 0x3
+	.long	0x4da
+	.byte	0
+	.uleb128 0x6
+	.long	0x11b
+	.uleb128 0x6
+	.long	0x4c6
+	.uleb128 0x17
+	.long	0x46
+	.long	0x4fd
+	.uleb128 0x3
+	.long	0x9b
+	.uleb128 0x3
+	.long	0x4da
+	.uleb128 0x3
+	.long	0x4fd
+	.byte	0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF83
+	.uleb128 0x6
+	.long	0x4e4
+	.uleb128 0x17
+	.long	0x46
+	.long	0x51d
+	.uleb128 0x3
+	.long	0x9b
+	.uleb128 0x3
+	.long	0x46
+	.byte	0
+	.uleb128 0x6
+	.long	0x509
+	.uleb128 0x6
+	.long	0x2e
+	.uleb128 0x6
+	.long	0xe9
+	.uleb128 0x6
+	.long	0x30b
+	.uleb128 0x24
+	.long	.LASF84
+	.long	0x69
+	.byte	0x1
+	.byte	0x8
+	.long	0x55f
+	.uleb128 0x7
+	.long	.LASF85
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF86
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF87
+	.byte	0x2
+	.uleb128 0x7
+	.long	.LASF88
+	.byte	0x3
+	.uleb128 0x7
+	.long	.LASF89
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF90
+	.byte	0x2b
+	.byte	0xe
+	.long	0x9b
+	.long	0x57e
+	.uleb128 0x3
+	.long	0x9b
+	.uleb128 0x3
+	.long	0xcd
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF91
+	.byte	0x6b
+	.byte	0xe
+	.long	0x9b
+	.long	0x59d
+	.uleb128 0x3
+	.long	0xcd
+	.uleb128 0x3
+	.long	0x46
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF92
+	.byte	0x7
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0x5b4
+	.uleb128 0x3
+	.long	0xd3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF93
+	.byte	0x2
+	.value	0x7a4
+	.byte	0x8
+	.long	0x2e
+	.long	0x5d0
+	.uleb128 0x3
+	.long	0x421
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF94
+	.byte	0x40
+	.byte	0xc
+	.long	0x46
+	.long	0x5ef
+	.uleb128 0x3
+	.long	0xcd
+	.uleb128 0x3
+	.long	0xcd
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF95
+	.byte	0x2
+	.value	0x394
+	.byte	0x5
+	.long	0x46
+	.long	0x60b
+	.uleb128 0x3
+	.long	0x52c
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF96
+	.byte	0x2
+	.value	0x148
+	.byte	0x8
+	.long	0x2e
+	.long	0x627
+	.uleb128 0x3
+	.long	0xd3
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF97
+	.byte	0x2
+	.value	0x63e
+	.byte	0x8
+	.long	0x2e
+	.long	0x648
+	.uleb128 0x3
+	.long	0xd3
+	.uleb128 0x3
+	.long	0x3a
+	.uleb128 0x3
+	.long	0x648
+	.byte	0
+	.uleb128 0x6
+	.long	0x4fd
+	.uleb128 0x11
+	.long	.LASF98
+	.byte	0x2
+	.value	0x473
+	.byte	0x5
+	.long	0x46
+	.long	0x669
+	.uleb128 0x3
+	.long	0x52c
+	.uleb128 0x3
+	.long	0x669
+	.byte	0
+	.uleb128 0x6
+	.long	0xf5
+	.uleb128 0x39
+	.long	.LASF136
+	.byte	0x2
+	.value	0x40b
+	.byte	0x6
+	.long	0x681
+	.uleb128 0x3
+	.long	0x52c
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF99
+	.byte	0x2
+	.value	0x416
+	.byte	0x6
+	.long	0xae
+	.long	0x698
+	.uleb128 0x3
+	.long	0x52c
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF110
+	.value	0x1c2
+	.long	0x46
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8dd
+	.uleb128 0x18
+	.long	.LASF100
+	.value	0x1c2
+	.byte	0x2f
+	.long	0x4da
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x18
+	.long	.LASF101
+	.value	0x1c2
+	.byte	0x3b
+	.long	0xa9
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x18
+	.long	.LASF59
+	.value	0x1c2
+	.byte	0x4b
+	.long	0x522
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x9
+	.long	.LASF58
+	.value	0x1c3
+	.byte	0xf
+	.long	0xd3
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x9
+	.long	.LASF103
+	.value	0x1c4
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x9
+	.long	.LASF104
+	.value	0x1c5
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x13
+	.long	.LLRL74
+	.uleb128 0x9
+	.long	.LASF105
+	.value	0x1c8
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x28
+	.string	"run"
+	.value	0x1c9
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x9
+	.long	.LASF106
+	.value	0x1d3
+	.byte	0xa
+	.long	0xae
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0xe
+	.long	.LLRL78
+	.long	0x892
+	.uleb128 0x9
+	.long	.LASF107
+	.value	0x1f1
+	.byte	0xe
+	.long	0x4d
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0xe
+	.long	.LLRL87
+	.long	0x81f
+	.uleb128 0x28
+	.string	"low"
+	.value	0x1f8
+	.byte	0x10
+	.long	0x4d
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x29
+	.long	0x8dd
+	.quad	.LBI169
+	.value	.LVU797
+	.long	.LLRL89
+	.value	0x1f8
+	.byte	0x64
+	.uleb128 0x5
+	.long	0x8ed
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x13
+	.long	.LLRL89
+	.uleb128 0x8
+	.long	0x8f9
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x1a
+	.long	0x905
+	.long	.LLRL89
+	.uleb128 0x8
+	.long	0x906
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x1a
+	.long	0x911
+	.long	.LLRL93
+	.uleb128 0x8
+	.long	0x912
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x8
+	.long	0x91e
+	.long	.LLST95
+	.long	.LVUS95
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	0x8dd
+	.quad	.LBI153
+	.value	.LVU631
+	.long	.LLRL80
+	.value	0x1f1
+	.byte	0x2e
+	.uleb128 0x5
+	.long	0x8ed
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x13
+	.long	.LLRL80
+	.uleb128 0x8
+	.long	0x8f9
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x1a
+	.long	0x905
+	.long	.LLRL80
+	.uleb128 0x8
+	.long	0x906
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x1a
+	.long	0x911
+	.long	.LLRL84
+	.uleb128 0x8
+	.long	0x912
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x8
+	.long	0x91e
+	.long	.LLST86
+	.long	.LVUS86
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL209
+	.long	0x57e
+	.long	0x8b6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL212
+	.long	0x15e4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF117
+	.value	0x1a9
+	.byte	0xd
+	.long	0x4d
+	.long	0x92d
+	.uleb128 0x2b
+	.long	.LASF119
+	.value	0x1a9
+	.byte	0x2a
+	.long	0xd3
+	.uleb128 0xc
+	.long	.LASF108
+	.value	0x1aa
+	.byte	0x8
+	.long	0x4d
+	.uleb128 0x1f
+	.uleb128 0x3a
+	.string	"i"
+	.byte	0x1
+	.value	0x1ab
+	.byte	0xc
+	.long	0x46
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF106
+	.value	0x1ac
+	.byte	0xa
+	.long	0xae
+	.uleb128 0xc
+	.long	.LASF109
+	.value	0x1ad
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF111
+	.value	0x179
+	.long	0x46
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb80
+	.uleb128 0x18
+	.long	.LASF112
+	.value	0x179
+	.byte	0x29
+	.long	0x52c
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x3b
+	.string	"key"
+	.byte	0x1
+	.value	0x179
+	.byte	0x40
+	.long	0xd3
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x9
+	.long	.LASF113
+	.value	0x17a
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x2c
+	.long	.LASF100
+	.value	0x17b
+	.long	0xf5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x9
+	.long	.LASF106
+	.value	0x17d
+	.byte	0x8
+	.long	0xae
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xe
+	.long	.LLRL66
+	.long	0xaf3
+	.uleb128 0x9
+	.long	.LASF114
+	.value	0x18a
+	.byte	0x9
+	.long	0x46
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x4
+	.quad	.LVL184
+	.long	0x66e
+	.long	0x9e2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL185
+	.long	0x681
+	.long	0x9fa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL186
+	.long	0x66e
+	.long	0xa12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL187
+	.long	0xb80
+	.long	0xa2a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL188
+	.long	0x66e
+	.long	0xa42
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL189
+	.long	0x681
+	.long	0xa5a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL190
+	.long	0x66e
+	.long	0xa72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL192
+	.long	0x14f2
+	.long	0xa90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL193
+	.long	0x15ed
+	.long	0xaae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL195
+	.long	0x66e
+	.long	0xac6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL196
+	.long	0x681
+	.long	0xade
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL197
+	.long	0x66e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL177
+	.long	0x59d
+	.long	0xb0b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL179
+	.long	0x681
+	.long	0xb23
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL180
+	.long	0x66e
+	.long	0xb3b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL181
+	.long	0x681
+	.long	0xb53
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL182
+	.long	0x66e
+	.long	0xb6b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL191
+	.long	0x681
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF115
+	.value	0x13d
+	.long	0x46
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdc6
+	.uleb128 0x18
+	.long	.LASF112
+	.value	0x13d
+	.byte	0x2b
+	.long	0x52c
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x9
+	.long	.LASF106
+	.value	0x141
+	.byte	0x8
+	.long	0xae
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x2c
+	.long	.LASF100
+	.value	0x149
+	.long	0xf5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x9
+	.long	.LASF116
+	.value	0x159
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0xe
+	.long	.LLRL47
+	.long	0xc4b
+	.uleb128 0x9
+	.long	.LASF58
+	.value	0x15b
+	.byte	0x11
+	.long	0xd3
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x9
+	.long	.LASF59
+	.value	0x15c
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x9
+	.long	.LASF60
+	.value	0x15d
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0xb
+	.quad	.LVL165
+	.long	0x14f2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	0xdc6
+	.quad	.LBI124
+	.value	.LVU435
+	.long	.LLRL51
+	.value	0x147
+	.long	0xd54
+	.uleb128 0x5
+	.long	0xdd6
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x13
+	.long	.LLRL51
+	.uleb128 0x8
+	.long	0xde2
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x8
+	.long	0xdee
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x8
+	.long	0xdfa
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x8
+	.long	0xe06
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x3c
+	.long	0xe12
+	.quad	.LBB126
+	.quad	.LBE126-.LBB126
+	.long	0xcf2
+	.uleb128 0x8
+	.long	0xe13
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x8
+	.long	0xe1f
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0xb
+	.quad	.LVL152
+	.long	0x5b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	0x15ba
+	.quad	.LBI127
+	.value	.LVU497
+	.long	.LLRL59
+	.value	0x132
+	.long	0xd26
+	.uleb128 0x5
+	.long	0x15d7
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x5
+	.long	0x15cb
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL142
+	.long	0x5b4
+	.long	0xd3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL170
+	.long	0x5b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL126
+	.long	0x5ef
+	.long	0xd71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL129
+	.long	0x5ef
+	.long	0xd8e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL149
+	.long	0x5ef
+	.long	0xdab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL174
+	.long	0x14f2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF118
+	.value	0x10e
+	.byte	0xc
+	.long	0x46
+	.long	0xe2d
+	.uleb128 0x2b
+	.long	.LASF112
+	.value	0x10e
+	.byte	0x3d
+	.long	0x52c
+	.uleb128 0xc
+	.long	.LASF103
+	.value	0x10f
+	.byte	0x21
+	.long	0x421
+	.uleb128 0xc
+	.long	.LASF58
+	.value	0x110
+	.byte	0xf
+	.long	0xd3
+	.uleb128 0xc
+	.long	.LASF60
+	.value	0x111
+	.byte	0xa
+	.long	0x2e
+	.uleb128 0xc
+	.long	.LASF106
+	.value	0x112
+	.byte	0x8
+	.long	0xae
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF116
+	.value	0x11d
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0xc
+	.long	.LASF120
+	.value	0x11e
+	.byte	0xc
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF121
+	.byte	0x1
+	.byte	0x95
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1476
+	.uleb128 0x19
+	.long	.LASF112
+	.byte	0x95
+	.byte	0x2b
+	.long	0x52c
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x19
+	.long	.LASF122
+	.byte	0x95
+	.byte	0x50
+	.long	0x1476
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x19
+	.long	.LASF43
+	.byte	0x95
+	.byte	0x5f
+	.long	0x9b
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x20
+	.long	.LASF123
+	.byte	0x97
+	.byte	0x8
+	.long	0x147b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -576
+	.uleb128 0x14
+	.long	.LASF116
+	.byte	0x98
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x14
+	.long	.LASF124
+	.byte	0x99
+	.byte	0x18
+	.long	0x531
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x20
+	.long	.LASF100
+	.byte	0x9a
+	.byte	0x15
+	.long	0xf5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.uleb128 0xe
+	.long	.LLRL14
+	.long	0x1409
+	.uleb128 0x14
+	.long	.LASF106
+	.byte	0xa0
+	.byte	0xa
+	.long	0xae
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xe
+	.long	.LLRL16
+	.long	0x1330
+	.uleb128 0x14
+	.long	.LASF125
+	.byte	0xcb
+	.byte	0xb
+	.long	0x46
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0xe
+	.long	.LLRL18
+	.long	0x112f
+	.uleb128 0x20
+	.long	.LASF108
+	.byte	0xf2
+	.byte	0x12
+	.long	0x4fd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -600
+	.uleb128 0x3e
+	.long	0x148c
+	.quad	.LBI69
+	.value	.LVU96
+	.long	.LLRL19
+	.byte	0x1
+	.byte	0xf3
+	.byte	0x41
+	.long	0x10e1
+	.uleb128 0x5
+	.long	0x149d
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x13
+	.long	.LLRL19
+	.uleb128 0x8
+	.long	0x14a9
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x8
+	.long	0x14b1
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xd
+	.long	0x15ba
+	.quad	.LBI71
+	.value	.LVU105
+	.quad	.LBB71
+	.quad	.LBE71-.LBB71
+	.byte	0x73
+	.byte	0x13
+	.long	0xfa2
+	.uleb128 0x5
+	.long	0x15d7
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x5
+	.long	0x15cb
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.uleb128 0xd
+	.long	0x15ba
+	.quad	.LBI73
+	.value	.LVU202
+	.quad	.LBB73
+	.quad	.LBE73-.LBB73
+	.byte	0x77
+	.byte	0x17
+	.long	0xfe2
+	.uleb128 0x5
+	.long	0x15d7
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x5
+	.long	0x15cb
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0xd
+	.long	0x15ba
+	.quad	.LBI75
+	.value	.LVU223
+	.quad	.LBB75
+	.quad	.LBE75-.LBB75
+	.byte	0x88
+	.byte	0x15
+	.long	0x1022
+	.uleb128 0x5
+	.long	0x15d7
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x5
+	.long	0x15cb
+	.long	.LLST28
+	.long	.LVUS28
+	.byte	0
+	.uleb128 0xd
+	.long	0x15ba
+	.quad	.LBI78
+	.value	.LVU234
+	.quad	.LBB78
+	.quad	.LBE78-.LBB78
+	.byte	0x8b
+	.byte	0x17
+	.long	0x1062
+	.uleb128 0x5
+	.long	0x15d7
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x5
+	.long	0x15cb
+	.long	.LLST30
+	.long	.LVUS30
+	.byte	0
+	.uleb128 0xd
+	.long	0x15ba
+	.quad	.LBI81
+	.value	.LVU329
+	.quad	.LBB81
+	.quad	.LBE81-.LBB81
+	.byte	0x7d
+	.byte	0x17
+	.long	0x10a2
+	.uleb128 0x5
+	.long	0x15d7
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x5
+	.long	0x15cb
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x3f
+	.long	0x15ba
+	.quad	.LBI83
+	.value	.LVU340
+	.quad	.LBB83
+	.quad	.LBE83-.LBB83
+	.byte	0x1
+	.byte	0x80
+	.byte	0x17
+	.uleb128 0x5
+	.long	0x15d7
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x5
+	.long	0x15cb
+	.long	.LLST34
+	.long	.LVUS34
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL32
+	.long	0x64d
+	.long	0x10ff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL89
+	.long	0x627
+	.long	0x1118
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -600
+	.byte	0
+	.uleb128 0x21
+	.quad	.LVL91
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x14bc
+	.quad	.LBI97
+	.value	.LVU251
+	.quad	.LBB97
+	.quad	.LBE97-.LBB97
+	.byte	0xe6
+	.byte	0x14
+	.long	0x1195
+	.uleb128 0x5
+	.long	0x14e5
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x5
+	.long	0x14d9
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x5
+	.long	0x14cd
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xb
+	.quad	.LVL93
+	.long	0x5ef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x14bc
+	.quad	.LBI99
+	.value	.LVU267
+	.quad	.LBB99
+	.quad	.LBE99-.LBB99
+	.byte	0xee
+	.byte	0x14
+	.long	0x11fb
+	.uleb128 0x5
+	.long	0x14e5
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x5
+	.long	0x14d9
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x5
+	.long	0x14cd
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0xb
+	.quad	.LVL97
+	.long	0x5ef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x14bc
+	.quad	.LBI101
+	.value	.LVU283
+	.quad	.LBB101
+	.quad	.LBE101-.LBB101
+	.byte	0xea
+	.byte	0x14
+	.long	0x1261
+	.uleb128 0x5
+	.long	0x14e5
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x5
+	.long	0x14d9
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x5
+	.long	0x14cd
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0xb
+	.quad	.LVL101
+	.long	0x5ef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL63
+	.long	0x1275
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL66
+	.long	0x14f2
+	.long	0x1293
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL67
+	.long	0x12ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL73
+	.long	0x12c1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL76
+	.long	0x66e
+	.long	0x12d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL95
+	.long	0x12f2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL99
+	.long	0x1306
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL103
+	.long	0x131f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x21
+	.quad	.LVL114
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL26
+	.long	0x681
+	.long	0x1348
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL51
+	.long	0x66e
+	.long	0x1360
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL54
+	.long	0x14f2
+	.long	0x137e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL55
+	.long	0x1398
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL56
+	.long	0x66e
+	.long	0x13b0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL57
+	.long	0x681
+	.long	0x13c8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL59
+	.long	0x66e
+	.long	0x13e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL69
+	.long	0x66e
+	.long	0x13f8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x21
+	.quad	.LVL107
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x15ba
+	.quad	.LBI64
+	.value	.LVU66
+	.quad	.LBB64
+	.quad	.LBE64-.LBB64
+	.byte	0x9c
+	.byte	0x7
+	.long	0x1449
+	.uleb128 0x5
+	.long	0x15d7
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x5
+	.long	0x15cb
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL24
+	.long	0x681
+	.long	0x1461
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL47
+	.long	0x66e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x4ad
+	.uleb128 0x1b
+	.long	0xae
+	.long	0x148c
+	.uleb128 0x40
+	.long	0x3f
+	.value	0x1ff
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF126
+	.byte	0x1
+	.byte	0x6c
+	.byte	0xc
+	.long	0x46
+	.byte	0x1
+	.long	0x14bc
+	.uleb128 0x15
+	.long	.LASF100
+	.byte	0x1
+	.byte	0x6c
+	.byte	0x3b
+	.long	0x4da
+	.uleb128 0x2e
+	.string	"p"
+	.byte	0x6d
+	.long	0xd3
+	.uleb128 0x2e
+	.string	"end"
+	.byte	0x6e
+	.long	0xd3
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF127
+	.byte	0x1
+	.byte	0x5b
+	.byte	0xc
+	.long	0x46
+	.byte	0x1
+	.long	0x14f2
+	.uleb128 0x15
+	.long	.LASF112
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x38
+	.long	0x52c
+	.uleb128 0x15
+	.long	.LASF128
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x4f
+	.long	0xd3
+	.uleb128 0x15
+	.long	.LASF59
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x65
+	.long	0x3a
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF137
+	.byte	0x1
+	.byte	0x2f
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15ba
+	.uleb128 0x19
+	.long	.LASF112
+	.byte	0x2f
+	.byte	0x37
+	.long	0x52c
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x19
+	.long	.LASF100
+	.byte	0x2f
+	.byte	0x55
+	.long	0x669
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x42
+	.string	"end"
+	.byte	0x1
+	.byte	0x31
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x13
+	.long	.LLRL3
+	.uleb128 0x14
+	.long	.LASF129
+	.byte	0x33
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xe
+	.long	.LLRL5
+	.long	0x1583
+	.uleb128 0x14
+	.long	.LASF106
+	.byte	0x38
+	.byte	0xc
+	.long	0xae
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL2
+	.long	0x5ef
+	.long	0x15a1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 1
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL6
+	.long	0x60b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF130
+	.byte	0x2
+	.byte	0xca
+	.byte	0x13
+	.long	0x46
+	.byte	0x3
+	.long	0x15e4
+	.uleb128 0x15
+	.long	.LASF106
+	.byte	0x2
+	.byte	0xca
+	.byte	0x29
+	.long	0xb5
+	.uleb128 0x15
+	.long	.LASF131
+	.byte	0x2
+	.byte	0xca
+	.byte	0x43
+	.long	0x70
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF90
+	.long	.LASF132
+	.uleb128 0x2f
+	.long	.LASF94
+	.long	.LASF133
+	.uleb128 0x30
+	.uleb128 0x7
+	.byte	0x9e
+	.uleb128 0x5
+	.byte	0x74
+	.byte	0x72
+	.byte	0x75
+	.byte	0x65
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x7
+	.byte	0x9e
+	.uleb128 0x5
+	.byte	0x6e
+	.byte	0x75
+	.byte	0x6c
+	.byte	0x6c
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x36
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU973
+	.uleb128 .LVU973
+	.uleb128 .LVU975
+	.uleb128 .LVU975
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU675
+	.uleb128 .LVU675
+	.uleb128 .LVU685
+	.uleb128 .LVU685
+	.uleb128 .LVU972
+	.uleb128 .LVU972
+	.uleb128 .LVU973
+	.uleb128 .LVU973
+	.uleb128 .LVU975
+	.uleb128 .LVU975
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS70:
+	.uleb128 0
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU973
+	.uleb128 .LVU973
+	.uleb128 .LVU975
+	.uleb128 .LVU975
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU584
+	.uleb128 .LVU624
+	.uleb128 .LVU627
+	.uleb128 .LVU684
+	.uleb128 .LVU685
+	.uleb128 0
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU585
+	.uleb128 .LVU590
+	.uleb128 .LVU618
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 .LVU622
+	.uleb128 .LVU627
+	.uleb128 .LVU670
+	.uleb128 .LVU685
+	.uleb128 .LVU788
+	.uleb128 .LVU788
+	.uleb128 .LVU823
+	.uleb128 .LVU823
+	.uleb128 .LVU892
+	.uleb128 .LVU892
+	.uleb128 .LVU915
+	.uleb128 .LVU915
+	.uleb128 .LVU947
+	.uleb128 .LVU947
+	.uleb128 .LVU963
+	.uleb128 .LVU963
+	.uleb128 .LVU970
+	.uleb128 .LVU973
+	.uleb128 .LVU975
+	.uleb128 .LVU975
+	.uleb128 .LVU984
+	.uleb128 .LVU984
+	.uleb128 .LVU987
+	.uleb128 .LVU987
+	.uleb128 .LVU991
+	.uleb128 .LVU991
+	.uleb128 .LVU995
+	.uleb128 .LVU995
+	.uleb128 0
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 6
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 12
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 6
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 6
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 6
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU586
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU608
+	.uleb128 .LVU618
+	.uleb128 .LVU622
+	.uleb128 .LVU627
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 .LVU676
+	.uleb128 .LVU685
+	.uleb128 .LVU688
+	.uleb128 .LVU688
+	.uleb128 .LVU690
+	.uleb128 .LVU690
+	.uleb128 .LVU693
+	.uleb128 .LVU693
+	.uleb128 .LVU695
+	.uleb128 .LVU695
+	.uleb128 .LVU698
+	.uleb128 .LVU698
+	.uleb128 .LVU700
+	.uleb128 .LVU700
+	.uleb128 .LVU703
+	.uleb128 .LVU703
+	.uleb128 .LVU705
+	.uleb128 .LVU705
+	.uleb128 .LVU708
+	.uleb128 .LVU708
+	.uleb128 .LVU710
+	.uleb128 .LVU710
+	.uleb128 .LVU792
+	.uleb128 .LVU792
+	.uleb128 .LVU896
+	.uleb128 .LVU896
+	.uleb128 .LVU901
+	.uleb128 .LVU901
+	.uleb128 .LVU905
+	.uleb128 .LVU905
+	.uleb128 .LVU914
+	.uleb128 .LVU914
+	.uleb128 .LVU915
+	.uleb128 .LVU915
+	.uleb128 .LVU921
+	.uleb128 .LVU941
+	.uleb128 .LVU942
+	.uleb128 .LVU942
+	.uleb128 .LVU944
+	.uleb128 .LVU947
+	.uleb128 .LVU963
+	.uleb128 .LVU973
+	.uleb128 .LVU975
+	.uleb128 .LVU975
+	.uleb128 0
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -12
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -11
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -10
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -9
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -12
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU594
+	.uleb128 .LVU597
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU618
+	.uleb128 .LVU622
+	.uleb128 .LVU627
+	.uleb128 .LVU670
+	.uleb128 .LVU685
+	.uleb128 .LVU792
+	.uleb128 .LVU792
+	.uleb128 .LVU915
+	.uleb128 .LVU915
+	.uleb128 .LVU942
+	.uleb128 .LVU942
+	.uleb128 .LVU944
+	.uleb128 .LVU944
+	.uleb128 .LVU946
+	.uleb128 .LVU946
+	.uleb128 .LVU947
+	.uleb128 .LVU947
+	.uleb128 .LVU969
+	.uleb128 .LVU969
+	.uleb128 .LVU970
+	.uleb128 .LVU975
+	.uleb128 0
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xf4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xf4
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU617
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 .LVU621
+	.uleb128 .LVU621
+	.uleb128 .LVU622
+	.uleb128 .LVU627
+	.uleb128 .LVU669
+	.uleb128 .LVU685
+	.uleb128 .LVU689
+	.uleb128 .LVU690
+	.uleb128 .LVU694
+	.uleb128 .LVU695
+	.uleb128 .LVU699
+	.uleb128 .LVU700
+	.uleb128 .LVU704
+	.uleb128 .LVU705
+	.uleb128 .LVU710
+	.uleb128 .LVU710
+	.uleb128 .LVU900
+	.uleb128 .LVU915
+	.uleb128 .LVU936
+	.uleb128 .LVU944
+	.uleb128 .LVU946
+	.uleb128 .LVU947
+	.uleb128 .LVU966
+	.uleb128 .LVU975
+	.uleb128 0
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU785
+	.uleb128 .LVU807
+	.uleb128 .LVU807
+	.uleb128 .LVU890
+	.uleb128 .LVU891
+	.uleb128 .LVU908
+	.uleb128 .LVU915
+	.uleb128 .LVU935
+	.uleb128 .LVU944
+	.uleb128 .LVU947
+	.uleb128 .LVU963
+	.uleb128 .LVU970
+	.uleb128 .LVU975
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x5
+	.byte	0x75
+	.sleb128 55296
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x5
+	.byte	0x75
+	.sleb128 55296
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU884
+	.uleb128 .LVU887
+	.uleb128 .LVU887
+	.uleb128 .LVU891
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 56320
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU797
+	.uleb128 .LVU859
+	.uleb128 .LVU859
+	.uleb128 .LVU884
+	.uleb128 .LVU975
+	.uleb128 .LVU978
+	.uleb128 .LVU978
+	.uleb128 .LVU995
+	.uleb128 .LVU995
+	.uleb128 .LVU999
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU799
+	.uleb128 .LVU818
+	.uleb128 .LVU818
+	.uleb128 .LVU839
+	.uleb128 .LVU840
+	.uleb128 .LVU860
+	.uleb128 .LVU861
+	.uleb128 .LVU880
+	.uleb128 .LVU881
+	.uleb128 .LVU884
+	.uleb128 .LVU975
+	.uleb128 .LVU978
+	.uleb128 .LVU978
+	.uleb128 .LVU984
+	.uleb128 .LVU984
+	.uleb128 .LVU987
+	.uleb128 .LVU987
+	.uleb128 .LVU991
+	.uleb128 .LVU991
+	.uleb128 .LVU995
+	.uleb128 .LVU995
+	.uleb128 .LVU999
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU801
+	.uleb128 .LVU820
+	.uleb128 .LVU820
+	.uleb128 .LVU842
+	.uleb128 .LVU842
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 .LVU883
+	.uleb128 .LVU883
+	.uleb128 .LVU884
+	.uleb128 .LVU975
+	.uleb128 .LVU978
+	.uleb128 .LVU978
+	.uleb128 .LVU981
+	.uleb128 .LVU981
+	.uleb128 .LVU984
+	.uleb128 .LVU984
+	.uleb128 .LVU987
+	.uleb128 .LVU987
+	.uleb128 .LVU991
+	.uleb128 .LVU991
+	.uleb128 .LVU995
+	.uleb128 .LVU995
+	.uleb128 .LVU999
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU804
+	.uleb128 .LVU816
+	.uleb128 .LVU816
+	.uleb128 .LVU823
+	.uleb128 .LVU823
+	.uleb128 .LVU835
+	.uleb128 .LVU835
+	.uleb128 .LVU844
+	.uleb128 .LVU844
+	.uleb128 .LVU856
+	.uleb128 .LVU856
+	.uleb128 .LVU859
+	.uleb128 .LVU859
+	.uleb128 .LVU865
+	.uleb128 .LVU865
+	.uleb128 .LVU877
+	.uleb128 .LVU877
+	.uleb128 .LVU884
+	.uleb128 .LVU975
+	.uleb128 .LVU978
+	.uleb128 .LVU978
+	.uleb128 .LVU984
+	.uleb128 .LVU984
+	.uleb128 .LVU987
+	.uleb128 .LVU987
+	.uleb128 .LVU989
+	.uleb128 .LVU989
+	.uleb128 .LVU991
+	.uleb128 .LVU991
+	.uleb128 .LVU993
+	.uleb128 .LVU993
+	.uleb128 .LVU995
+	.uleb128 .LVU995
+	.uleb128 .LVU997
+	.uleb128 .LVU997
+	.uleb128 .LVU999
+	.uleb128 .LVU999
+	.uleb128 .LVU1001
+	.uleb128 .LVU1001
+	.uleb128 0
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 1
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 2
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xa
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xb
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 1
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xb
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 2
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU817
+	.uleb128 .LVU836
+	.uleb128 .LVU836
+	.uleb128 .LVU847
+	.uleb128 .LVU857
+	.uleb128 .LVU861
+	.uleb128 .LVU878
+	.uleb128 .LVU881
+	.uleb128 .LVU977
+	.uleb128 .LVU978
+	.uleb128 .LVU980
+	.uleb128 .LVU981
+	.uleb128 .LVU981
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU984
+	.uleb128 .LVU986
+	.uleb128 .LVU990
+	.uleb128 .LVU990
+	.uleb128 .LVU991
+	.uleb128 .LVU994
+	.uleb128 .LVU995
+	.uleb128 .LVU998
+	.uleb128 .LVU999
+	.uleb128 .LVU1002
+	.uleb128 0
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU631
+	.uleb128 .LVU664
+	.uleb128 .LVU710
+	.uleb128 .LVU757
+	.uleb128 .LVU757
+	.uleb128 .LVU785
+	.uleb128 .LVU947
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU963
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU633
+	.uleb128 .LVU645
+	.uleb128 .LVU645
+	.uleb128 .LVU664
+	.uleb128 .LVU710
+	.uleb128 .LVU721
+	.uleb128 .LVU721
+	.uleb128 .LVU734
+	.uleb128 .LVU735
+	.uleb128 .LVU758
+	.uleb128 .LVU759
+	.uleb128 .LVU781
+	.uleb128 .LVU782
+	.uleb128 .LVU785
+	.uleb128 .LVU947
+	.uleb128 .LVU951
+	.uleb128 .LVU951
+	.uleb128 .LVU963
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU635
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU664
+	.uleb128 .LVU710
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU737
+	.uleb128 .LVU737
+	.uleb128 .LVU761
+	.uleb128 .LVU761
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU785
+	.uleb128 .LVU947
+	.uleb128 .LVU951
+	.uleb128 .LVU951
+	.uleb128 .LVU955
+	.uleb128 .LVU955
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU963
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU638
+	.uleb128 .LVU644
+	.uleb128 .LVU644
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU662
+	.uleb128 .LVU710
+	.uleb128 .LVU719
+	.uleb128 .LVU719
+	.uleb128 .LVU725
+	.uleb128 .LVU725
+	.uleb128 .LVU731
+	.uleb128 .LVU739
+	.uleb128 .LVU751
+	.uleb128 .LVU751
+	.uleb128 .LVU753
+	.uleb128 .LVU753
+	.uleb128 .LVU755
+	.uleb128 .LVU755
+	.uleb128 .LVU757
+	.uleb128 .LVU757
+	.uleb128 .LVU763
+	.uleb128 .LVU763
+	.uleb128 .LVU775
+	.uleb128 .LVU775
+	.uleb128 .LVU777
+	.uleb128 .LVU777
+	.uleb128 .LVU779
+	.uleb128 .LVU779
+	.uleb128 .LVU785
+	.uleb128 .LVU947
+	.uleb128 .LVU949
+	.uleb128 .LVU949
+	.uleb128 .LVU951
+	.uleb128 .LVU951
+	.uleb128 .LVU953
+	.uleb128 .LVU955
+	.uleb128 .LVU957
+	.uleb128 .LVU957
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 .LVU963
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 2
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 2
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 2
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU644
+	.uleb128 .LVU663
+	.uleb128 .LVU663
+	.uleb128 .LVU664
+	.uleb128 .LVU720
+	.uleb128 .LVU731
+	.uleb128 .LVU731
+	.uleb128 .LVU742
+	.uleb128 .LVU752
+	.uleb128 .LVU753
+	.uleb128 .LVU755
+	.uleb128 .LVU766
+	.uleb128 .LVU776
+	.uleb128 .LVU777
+	.uleb128 .LVU779
+	.uleb128 .LVU782
+	.uleb128 .LVU950
+	.uleb128 .LVU954
+	.uleb128 .LVU954
+	.uleb128 .LVU955
+	.uleb128 .LVU958
+	.uleb128 .LVU959
+	.uleb128 .LVU962
+	.uleb128 .LVU963
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS62:
+	.uleb128 0
+	.uleb128 .LVU516
+	.uleb128 .LVU516
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU574
+	.uleb128 .LVU574
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 0
+	.uleb128 .LVU518
+	.uleb128 .LVU518
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL177-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL177-1-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU520
+	.uleb128 .LVU523
+	.uleb128 .LVU523
+	.uleb128 .LVU569
+	.uleb128 .LVU573
+	.uleb128 .LVU575
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL179-1-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU523
+	.uleb128 .LVU526
+	.uleb128 .LVU528
+	.uleb128 .LVU531
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU534
+	.uleb128 .LVU540
+	.uleb128 .LVU560
+	.uleb128 .LVU561
+	.uleb128 .LVU561
+	.uleb128 .LVU572
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL195-1-.Ltext0
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-1-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0xb
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU357
+	.uleb128 .LVU357
+	.uleb128 .LVU418
+	.uleb128 .LVU418
+	.uleb128 .LVU419
+	.uleb128 .LVU419
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU362
+	.uleb128 .LVU377
+	.uleb128 .LVU389
+	.uleb128 .LVU392
+	.uleb128 .LVU392
+	.uleb128 .LVU393
+	.uleb128 .LVU395
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 .LVU404
+	.uleb128 .LVU409
+	.uleb128 .LVU412
+	.uleb128 .LVU419
+	.uleb128 .LVU420
+	.uleb128 .LVU420
+	.uleb128 .LVU423
+	.uleb128 .LVU431
+	.uleb128 .LVU445
+	.uleb128 .LVU476
+	.uleb128 .LVU484
+	.uleb128 .LVU487
+	.uleb128 .LVU489
+	.uleb128 .LVU490
+	.uleb128 .LVU494
+	.uleb128 .LVU508
+	.uleb128 .LVU511
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL142-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL152-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU377
+	.uleb128 .LVU402
+	.uleb128 .LVU402
+	.uleb128 .LVU403
+	.uleb128 .LVU403
+	.uleb128 .LVU404
+	.uleb128 .LVU476
+	.uleb128 .LVU490
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU385
+	.uleb128 .LVU404
+	.uleb128 .LVU476
+	.uleb128 .LVU483
+	.uleb128 .LVU483
+	.uleb128 .LVU484
+	.uleb128 .LVU487
+	.uleb128 .LVU490
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU386
+	.uleb128 .LVU404
+	.uleb128 .LVU476
+	.uleb128 .LVU484
+	.uleb128 .LVU487
+	.uleb128 .LVU490
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU387
+	.uleb128 .LVU404
+	.uleb128 .LVU476
+	.uleb128 .LVU484
+	.uleb128 .LVU487
+	.uleb128 .LVU490
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU409
+	.uleb128 .LVU415
+	.uleb128 .LVU435
+	.uleb128 .LVU476
+	.uleb128 .LVU490
+	.uleb128 .LVU508
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU409
+	.uleb128 .LVU415
+	.uleb128 .LVU437
+	.uleb128 .LVU476
+	.uleb128 .LVU490
+	.uleb128 .LVU508
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU409
+	.uleb128 .LVU415
+	.uleb128 .LVU438
+	.uleb128 .LVU476
+	.uleb128 .LVU490
+	.uleb128 .LVU508
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU409
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU412
+	.uleb128 .LVU413
+	.uleb128 .LVU415
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+	.uleb128 .LVU475
+	.uleb128 .LVU476
+	.uleb128 .LVU490
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU494
+	.uleb128 .LVU495
+	.uleb128 .LVU508
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU409
+	.uleb128 .LVU412
+	.uleb128 .LVU440
+	.uleb128 .LVU445
+	.uleb128 .LVU453
+	.uleb128 .LVU461
+	.uleb128 .LVU461
+	.uleb128 .LVU462
+	.uleb128 .LVU463
+	.uleb128 .LVU473
+	.uleb128 .LVU490
+	.uleb128 .LVU494
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL142-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x6
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x72
+	.sleb128 -8
+	.byte	0x6
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x6
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU446
+	.uleb128 .LVU453
+	.uleb128 .LVU453
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 .LVU476
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU448
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU476
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 32
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU497
+	.uleb128 .LVU499
+	.uleb128 .LVU504
+	.uleb128 .LVU506
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU497
+	.uleb128 .LVU499
+	.uleb128 .LVU504
+	.uleb128 .LVU506
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU61
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU115
+	.uleb128 .LVU121
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU310
+	.uleb128 .LVU311
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -616
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU62
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU92
+	.uleb128 .LVU113
+	.uleb128 .LVU115
+	.uleb128 .LVU121
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU136
+	.uleb128 .LVU139
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU144
+	.uleb128 .LVU156
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU173
+	.uleb128 .LVU179
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU195
+	.uleb128 .LVU249
+	.uleb128 .LVU298
+	.uleb128 .LVU302
+	.uleb128 .LVU311
+	.uleb128 .LVU314
+	.uleb128 .LVU321
+	.uleb128 .LVU347
+	.uleb128 .LVU349
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU75
+	.uleb128 .LVU88
+	.uleb128 .LVU121
+	.uleb128 .LVU122
+	.uleb128 .LVU132
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU145
+	.uleb128 .LVU171
+	.uleb128 .LVU174
+	.uleb128 .LVU183
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU199
+	.uleb128 .LVU249
+	.uleb128 .LVU254
+	.uleb128 .LVU266
+	.uleb128 .LVU270
+	.uleb128 .LVU282
+	.uleb128 .LVU286
+	.uleb128 .LVU314
+	.uleb128 .LVU317
+	.uleb128 .LVU317
+	.uleb128 .LVU322
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL51-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x240
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x241
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x240
+	.byte	0x1c
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU244
+	.uleb128 .LVU249
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU97
+	.uleb128 .LVU113
+	.uleb128 .LVU199
+	.uleb128 .LVU240
+	.uleb128 .LVU298
+	.uleb128 .LVU302
+	.uleb128 .LVU311
+	.uleb128 .LVU314
+	.uleb128 .LVU322
+	.uleb128 .LVU347
+	.uleb128 .LVU350
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU98
+	.uleb128 .LVU105
+	.uleb128 .LVU111
+	.uleb128 .LVU113
+	.uleb128 .LVU199
+	.uleb128 .LVU210
+	.uleb128 .LVU214
+	.uleb128 .LVU222
+	.uleb128 .LVU228
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU240
+	.uleb128 .LVU298
+	.uleb128 .LVU299
+	.uleb128 .LVU299
+	.uleb128 .LVU302
+	.uleb128 .LVU311
+	.uleb128 .LVU314
+	.uleb128 .LVU322
+	.uleb128 .LVU328
+	.uleb128 .LVU328
+	.uleb128 .LVU347
+	.uleb128 .LVU350
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU100
+	.uleb128 .LVU113
+	.uleb128 .LVU199
+	.uleb128 .LVU240
+	.uleb128 .LVU298
+	.uleb128 .LVU302
+	.uleb128 .LVU311
+	.uleb128 .LVU314
+	.uleb128 .LVU322
+	.uleb128 .LVU347
+	.uleb128 .LVU350
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU105
+	.uleb128 .LVU107
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU105
+	.uleb128 .LVU107
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU202
+	.uleb128 .LVU204
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU202
+	.uleb128 .LVU204
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU222
+	.uleb128 .LVU226
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU222
+	.uleb128 .LVU226
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU233
+	.uleb128 .LVU236
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU233
+	.uleb128 .LVU236
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU329
+	.uleb128 .LVU332
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU329
+	.uleb128 .LVU332
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU339
+	.uleb128 .LVU342
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU339
+	.uleb128 .LVU342
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU251
+	.uleb128 .LVU261
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU251
+	.uleb128 .LVU261
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+5622
+	.sleb128 0
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU251
+	.uleb128 .LVU261
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU267
+	.uleb128 .LVU277
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU267
+	.uleb128 .LVU277
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+5631
+	.sleb128 0
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU267
+	.uleb128 .LVU277
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU283
+	.uleb128 .LVU293
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU283
+	.uleb128 .LVU293
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC0
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU283
+	.uleb128 .LVU293
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU66
+	.uleb128 .LVU68
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU66
+	.uleb128 .LVU68
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU2
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU8
+	.uleb128 .LVU9
+	.uleb128 .LVU37
+	.uleb128 .LVU42
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 8
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU5
+	.uleb128 .LVU8
+	.uleb128 .LVU13
+	.uleb128 .LVU39
+	.uleb128 .LVU42
+	.uleb128 .LVU56
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU28
+	.uleb128 .LVU35
+	.uleb128 .LVU42
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU46
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB103-.Ltext0
+	.uleb128 .LBE103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB93-.Ltext0
+	.uleb128 .LBE93-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0
+.LLRL47:
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB134-.Ltext0
+	.uleb128 .LBE134-.Ltext0
+	.byte	0
+.LLRL51:
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB133-.Ltext0
+	.uleb128 .LBE133-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0
+.LLRL59:
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB130-.Ltext0
+	.uleb128 .LBE130-.Ltext0
+	.byte	0
+.LLRL66:
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB139-.Ltext0
+	.uleb128 .LBE139-.Ltext0
+	.byte	0
+.LLRL74:
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB185-.Ltext0
+	.uleb128 .LBE185-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB186-.Ltext0
+	.uleb128 .LBE186-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB187-.Ltext0
+	.uleb128 .LBE187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB188-.Ltext0
+	.uleb128 .LBE188-.Ltext0
+	.byte	0
+.LLRL78:
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0
+.LLRL80:
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0
+.LLRL84:
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB157-.Ltext0
+	.uleb128 .LBE157-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB161-.Ltext0
+	.uleb128 .LBE161-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB162-.Ltext0
+	.uleb128 .LBE162-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0
+.LLRL89:
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB179-.Ltext0
+	.uleb128 .LBE179-.Ltext0
+	.byte	0
+.LLRL93:
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB173-.Ltext0
+	.uleb128 .LBE173-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB174-.Ltext0
+	.uleb128 .LBE174-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB175-.Ltext0
+	.uleb128 .LBE175-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB176-.Ltext0
+	.uleb128 .LBE176-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF107:
+	.string	"code"
+.LASF40:
+	.string	"conversion_ns"
+.LASF85:
+	.string	"JSON_PARSER_VALUE"
+.LASF92:
+	.string	"strlen"
+.LASF45:
+	.string	"capacity"
+.LASF78:
+	.string	"start_array"
+.LASF27:
+	.string	"StringArena"
+.LASF101:
+	.string	"buffer"
+.LASF7:
+	.string	"unsigned int"
+.LASF48:
+	.string	"StringCharClassBits"
+.LASF61:
+	.string	"incremental_factor"
+.LASF28:
+	.string	"head"
+.LASF76:
+	.string	"start_object"
+.LASF49:
+	.string	"StringGrowthPolicy"
+.LASF51:
+	.string	"ST_GROWTH_LINEAR"
+.LASF57:
+	.string	"StringTokenizer"
+.LASF122:
+	.string	"handler"
+.LASF54:
+	.string	"ST_STRING_OWNED"
+.LASF47:
+	.string	"error"
+.LASF19:
+	.string	"ST_CLASS_WHITESPACE"
+.LASF132:
+	.string	"__builtin_memcpy"
+.LASF130:
+	.string	"st_char_is"
+.LASF44:
+	.string	"chunk_size"
+.LASF114:
+	.string	"found"
+.LASF84:
+	.string	"JsonParserState"
+.LASF20:
+	.string	"ST_CLASS_DIGIT"
+.LASF97:
+	.string	"stod"
+.LASF72:
+	.string	"count"
+.LASF103:
+	.string	"index"
+.LASF125:
+	.string	"result"
+.LASF16:
+	.string	"long long unsigned int"
+.LASF95:
+	.string	"st_ensure"
+.LASF127:
+	.string	"json_parser_literal"
+.LASF99:
+	.string	"st_current_token"
+.LASF119:
+	.string	"digits"
+.LASF55:
+	.string	"ST_STRING_MAPPED"
+.LASF66:
+	.string	"arena"
+.LASF108:
+	.string	"value"
+.LASF30:
+	.string	"used"
+.LASF9:
+	.string	"size_t"
+.LASF46:
+	.string	"offset"
+.LASF35:
+	.string	"allocations"
+.LASF63:
+	.string	"max_increment"
+.LASF135:
+	.string	"StringArenaBlock"
+.LASF12:
+	.string	"__uint64_t"
+.LASF137:
+	.string	"json_parser_string"
+.LASF86:
+	.string	"JSON_PARSER_VALUE_OR_END"
+.LASF91:
+	.string	"memchr"
+.LASF96:
+	.string	"st_scan_escape"
+.LASF14:
+	.string	"char"
+.LASF58:
+	.string	"string"
+.LASF121:
+	.string	"st_json_parse"
+.LASF15:
+	.string	"ssize_t"
+.LASF17:
+	.string	"uint8_t"
+.LASF25:
+	.string	"ST_CLASS_ALPHA"
+.LASF50:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF70:
+	.string	"StringStructuralIndex"
+.LASF81:
+	.string	"boolean"
+.LASF23:
+	.string	"ST_CLASS_STRUCTURAL"
+.LASF4:
+	.string	"long long int"
+.LASF116:
+	.string	"depth"
+.LASF43:
+	.string	"context"
+.LASF39:
+	.string	"conversions"
+.LASF117:
+	.string	"json_parser_hex4"
+.LASF109:
+	.string	"digit"
+.LASF118:
+	.string	"json_parser_skip_indexed"
+.LASF74:
+	.string	"hint"
+.LASF88:
+	.string	"JSON_PARSER_KEY_OR_END"
+.LASF89:
+	.string	"JSON_PARSER_NEXT"
+.LASF102:
+	.string	"st_char_classes"
+.LASF36:
+	.string	"reallocations"
+.LASF87:
+	.string	"JSON_PARSER_KEY"
+.LASF65:
+	.string	"ownership"
+.LASF53:
+	.string	"ST_STRING_BORROWED"
+.LASF31:
+	.string	"long double"
+.LASF82:
+	.string	"null"
+.LASF106:
+	.string	"token"
+.LASF32:
+	.string	"StringStats"
+.LASF71:
+	.string	"positions"
+.LASF98:
+	.string	"st_extract_numbers_view"
+.LASF33:
+	.string	"bytes_scanned"
+.LASF11:
+	.string	"short int"
+.LASF3:
+	.string	"long int"
+.LASF105:
+	.string	"backslash"
+.LASF129:
+	.string	"available"
+.LASF59:
+	.string	"length"
+.LASF126:
+	.string	"json_parser_is_number"
+.LASF110:
+	.string	"st_json_unescape"
+.LASF34:
+	.string	"tokens_extracted"
+.LASF94:
+	.string	"memcmp"
+.LASF18:
+	.string	"uint64_t"
+.LASF22:
+	.string	"ST_CLASS_HEX"
+.LASF93:
+	.string	"st_structural_next"
+.LASF29:
+	.string	"block_size"
+.LASF83:
+	.string	"double"
+.LASF113:
+	.string	"key_length"
+.LASF13:
+	.string	"__ssize_t"
+.LASF10:
+	.string	"__uint8_t"
+.LASF80:
+	.string	"number"
+.LASF52:
+	.string	"StringOwnership"
+.LASF42:
+	.string	"read"
+.LASF128:
+	.string	"literal"
+.LASF123:
+	.string	"stack"
+.LASF2:
+	.string	"long unsigned int"
+.LASF134:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF112:
+	.string	"tokenizer"
+.LASF68:
+	.string	"structural_index"
+.LASF56:
+	.string	"ST_STRING_INLINE"
+.LASF24:
+	.string	"ST_CLASS_ESCAPE"
+.LASF5:
+	.string	"unsigned char"
+.LASF67:
+	.string	"inline_buffer"
+.LASF26:
+	.string	"StringView"
+.LASF41:
+	.string	"StringStream"
+.LASF79:
+	.string	"end_array"
+.LASF124:
+	.string	"state"
+.LASF37:
+	.string	"expansions"
+.LASF69:
+	.string	"stats"
+.LASF75:
+	.string	"JsonHandler"
+.LASF8:
+	.string	"signed char"
+.LASF6:
+	.string	"short unsigned int"
+.LASF90:
+	.string	"memcpy"
+.LASF115:
+	.string	"st_skip_value"
+.LASF100:
+	.string	"view"
+.LASF120:
+	.string	"current"
+.LASF77:
+	.string	"end_object"
+.LASF133:
+	.string	"__builtin_memcmp"
+.LASF62:
+	.string	"growth_policy"
+.LASF104:
+	.string	"written"
+.LASF73:
+	.string	"in_string"
+.LASF21:
+	.string	"ST_CLASS_NUMERIC"
+.LASF131:
+	.string	"classes"
+.LASF136:
+	.string	"st_next_token"
+.LASF38:
+	.string	"bytes_copied"
+.LASF111:
+	.string	"st_find_key"
+.LASF60:
+	.string	"position"
+.LASF64:
+	.string	"stream"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test"
+.LASF0:
+	.string	"/root/repo/src/json_parser.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
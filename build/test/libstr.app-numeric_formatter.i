@@ -0,0 +1,4421 @@
+# 0 "/root/repo/src/numeric_formatter.c"
+# 1 "/root/repo/build/test//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "/root/repo/src/numeric_formatter.c"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 39 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 2 "/root/repo/src/numeric_formatter.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 59 "/usr/include/stdlib.h" 3 4
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 3 "/root/repo/src/numeric_formatter.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 4 "/root/repo/src/numeric_formatter.c" 2
+# 1 "/root/repo/src/../include/strutils.h" 1
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 6 "/root/repo/src/../include/strutils.h" 2
+
+
+
+
+
+
+
+
+# 13 "/root/repo/src/../include/strutils.h"
+struct StringView {
+
+
+
+
+  const char *ptr;
+
+
+
+
+  size_t len;
+};
+# 35 "/root/repo/src/../include/strutils.h"
+struct StringView sv_from_string(const char *string);
+# 48 "/root/repo/src/../include/strutils.h"
+int sv_compare(const struct StringView *a, const struct StringView *b);
+# 61 "/root/repo/src/../include/strutils.h"
+int sv_equals(const struct StringView *view, const char *string);
+# 72 "/root/repo/src/../include/strutils.h"
+uint64_t sv_hash(const struct StringView *view);
+# 84 "/root/repo/src/../include/strutils.h"
+char *sv_to_string(const struct StringView *view);
+# 97 "/root/repo/src/../include/strutils.h"
+int sv_to_double(const struct StringView *view, double *value);
+# 110 "/root/repo/src/../include/strutils.h"
+int sv_to_int64(const struct StringView *view, int64_t *value);
+# 122 "/root/repo/src/../include/strutils.h"
+enum StringCharClassBits {
+
+
+
+
+  ST_CLASS_WHITESPACE = 1 << 0,
+
+
+
+
+  ST_CLASS_DIGIT = 1 << 1,
+
+
+
+
+  ST_CLASS_NUMERIC = 1 << 2,
+
+
+
+
+  ST_CLASS_HEX = 1 << 3,
+
+
+
+
+  ST_CLASS_STRUCTURAL = 1 << 4,
+
+
+
+
+
+  ST_CLASS_ESCAPE = 1 << 5,
+
+
+
+
+  ST_CLASS_ALPHA = 1 << 6,
+};
+
+
+
+
+
+
+extern const uint8_t st_char_classes[256];
+
+
+
+
+struct StringCharClass {
+
+
+
+
+  uint8_t members[256];
+};
+# 189 "/root/repo/src/../include/strutils.h"
+void st_char_class_init(struct StringCharClass *char_class, const unsigned int classes, const char *members);
+# 202 "/root/repo/src/../include/strutils.h"
+static inline int st_char_is(const char token, const unsigned int classes) {
+  return (st_char_classes[(unsigned char)token] & classes) != 0;
+}
+# 217 "/root/repo/src/../include/strutils.h"
+static inline int st_char_class_has(const struct StringCharClass *char_class, const char token) {
+  return char_class->members[(unsigned char)token] != 0;
+}
+# 231 "/root/repo/src/../include/strutils.h"
+enum StringScanIsa {
+  ST_SCAN_SCALAR,
+  ST_SCAN_SSE2,
+  ST_SCAN_AVX2,
+  ST_SCAN_AVX512,
+};
+# 247 "/root/repo/src/../include/strutils.h"
+int st_scan_isa_supported(const enum StringScanIsa isa);
+# 261 "/root/repo/src/../include/strutils.h"
+int st_scan_set_isa(const enum StringScanIsa isa);
+
+
+
+
+
+
+
+enum StringScanIsa st_scan_isa();
+# 284 "/root/repo/src/../include/strutils.h"
+size_t st_scan_delimiter(const char *string, const size_t length, const char delim);
+# 299 "/root/repo/src/../include/strutils.h"
+size_t st_scan_non_whitespace(const char *string, const size_t length);
+# 312 "/root/repo/src/../include/strutils.h"
+size_t st_scan_nul(const char *string, const size_t length);
+# 328 "/root/repo/src/../include/strutils.h"
+size_t st_scan_escape(const char *string, const size_t length);
+# 343 "/root/repo/src/../include/strutils.h"
+size_t st_scan_class(const char *string, const size_t length, const struct StringCharClass *char_class);
+# 365 "/root/repo/src/../include/strutils.h"
+struct StringArenaBlock;
+
+
+
+
+
+
+
+struct StringArena {
+
+
+
+
+  struct StringArenaBlock *head;
+
+
+
+
+  size_t block_size;
+
+
+
+
+  size_t used;
+};
+# 400 "/root/repo/src/../include/strutils.h"
+struct StringArena *st_arena_create(const size_t block_size);
+# 413 "/root/repo/src/../include/strutils.h"
+void *st_arena_alloc(struct StringArena *arena, const size_t size);
+# 426 "/root/repo/src/../include/strutils.h"
+char *st_arena_string(struct StringArena *arena, const struct StringView *view);
+# 436 "/root/repo/src/../include/strutils.h"
+void st_arena_reset(struct StringArena *arena);
+
+
+
+
+
+
+
+void st_arena_destroy(struct StringArena *arena);
+
+
+
+
+
+
+
+struct StringArena *st_arena_acquire(void);
+# 462 "/root/repo/src/../include/strutils.h"
+void st_arena_release(struct StringArena *arena);
+
+
+
+
+
+
+void st_arena_pool_clear(void);
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 477 "/root/repo/src/../include/strutils.h" 2
+# 486 "/root/repo/src/../include/strutils.h"
+
+# 486 "/root/repo/src/../include/strutils.h"
+struct StringStats {
+
+
+
+
+  uint64_t bytes_scanned;
+
+
+
+
+  uint64_t tokens_extracted;
+
+
+
+
+  uint64_t allocations;
+
+
+
+
+  uint64_t reallocations;
+
+
+
+
+  uint64_t expansions;
+
+
+
+
+  uint64_t bytes_copied;
+
+
+
+
+  uint64_t conversions;
+
+
+
+
+  uint64_t conversion_ns;
+};
+
+struct StringTokenizer;
+# 554 "/root/repo/src/../include/strutils.h"
+int st_stats_available(void);
+
+
+
+
+
+
+
+void st_stats_enable(const int enabled);
+
+
+
+
+
+
+
+void st_stats_snapshot(struct StringStats *stats);
+
+
+
+
+void st_stats_reset(void);
+# 589 "/root/repo/src/../include/strutils.h"
+void st_stats_add(const struct StringTokenizer *tokenizer, const size_t field, const uint64_t value);
+# 602 "/root/repo/src/../include/strutils.h"
+uint64_t st_stats_clock(const struct StringTokenizer *tokenizer);
+# 620 "/root/repo/src/../include/strutils.h"
+struct StringStream {
+
+
+
+
+
+  ssize_t (*read)(void *context, char *buffer, size_t size);
+
+
+
+
+  void *context;
+
+
+
+
+  int fd;
+
+
+
+
+  size_t chunk_size;
+
+
+
+
+  size_t capacity;
+
+
+
+
+  size_t offset;
+
+
+
+
+  int eof;
+
+
+
+
+  int error;
+};
+
+
+
+
+enum StringGrowthPolicy {
+
+
+
+
+  ST_GROWTH_GEOMETRIC,
+
+
+
+
+  ST_GROWTH_LINEAR,
+};
+# 693 "/root/repo/src/../include/strutils.h"
+enum StringOwnership {
+
+
+
+
+  ST_STRING_BORROWED,
+
+
+
+
+  ST_STRING_OWNED,
+
+
+
+
+  ST_STRING_MAPPED,
+
+
+
+
+  ST_STRING_INLINE,
+};
+
+
+
+
+struct StringTokenizer {
+
+
+
+
+  char *string;
+
+
+
+
+  size_t length;
+
+
+
+
+  size_t position;
+
+
+
+
+  size_t incremental_factor;
+
+
+
+
+  enum StringGrowthPolicy growth_policy;
+
+
+
+
+  size_t max_increment;
+
+
+
+
+  struct StringStream *stream;
+
+
+
+
+  enum StringOwnership ownership;
+
+
+
+
+  struct StringArena *arena;
+
+
+
+
+  char inline_buffer[256];
+
+
+
+
+  struct StringStructuralIndex *structural_index;
+
+
+
+
+  struct StringStats *stats;
+};
+# 791 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create(char *string);
+# 806 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_n(char *string, const size_t length);
+# 821 "/root/repo/src/../include/strutils.h"
+void st_init(struct StringTokenizer *tokenizer, char *string, const size_t length);
+# 836 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_mmap(const char *path);
+# 851 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_empty(const size_t string_size);
+# 866 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_fd(const int fd, const size_t chunk_size);
+# 881 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_file(FILE *file, const size_t chunk_size);
+# 900 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_create_from_callback(ssize_t (*read)(void *context, char *buffer, size_t size), void *context, const size_t chunk_size);
+# 916 "/root/repo/src/../include/strutils.h"
+int st_ensure(struct StringTokenizer *tokenizer, const size_t size);
+# 930 "/root/repo/src/../include/strutils.h"
+void st_attach_arena(struct StringTokenizer *tokenizer, struct StringArena *arena);
+# 942 "/root/repo/src/../include/strutils.h"
+void st_attach_stats(struct StringTokenizer *tokenizer, struct StringStats *stats);
+# 953 "/root/repo/src/../include/strutils.h"
+void st_reset(struct StringTokenizer *tokenizer);
+# 971 "/root/repo/src/../include/strutils.h"
+int st_rebind(struct StringTokenizer *tokenizer, char *string, const size_t length);
+# 988 "/root/repo/src/../include/strutils.h"
+char *st_detach_string(struct StringTokenizer *tokenizer);
+# 1001 "/root/repo/src/../include/strutils.h"
+struct StringTokenizer *st_pool_acquire(const size_t string_size);
+# 1012 "/root/repo/src/../include/strutils.h"
+void st_pool_release(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+void st_pool_clear(void);
+
+
+
+
+
+
+
+void st_destroy(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+void st_next_token(struct StringTokenizer *tokenizer);
+# 1046 "/root/repo/src/../include/strutils.h"
+char st_current_token(struct StringTokenizer *tokenizer);
+# 1061 "/root/repo/src/../include/strutils.h"
+char *st_sub_string(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim);
+# 1074 "/root/repo/src/../include/strutils.h"
+char *st_slice_string(struct StringTokenizer *tokenizer, const int length);
+# 1085 "/root/repo/src/../include/strutils.h"
+char *st_extract_numbers(struct StringTokenizer *tokenizer);
+# 1105 "/root/repo/src/../include/strutils.h"
+int st_sub_string_view(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim, struct StringView *view);
+# 1123 "/root/repo/src/../include/strutils.h"
+int st_slice_string_view(struct StringTokenizer *tokenizer, const int length, struct StringView *view);
+# 1139 "/root/repo/src/../include/strutils.h"
+int st_extract_numbers_view(struct StringTokenizer *tokenizer, struct StringView *view);
+# 1158 "/root/repo/src/../include/strutils.h"
+int st_extract_until_view(struct StringTokenizer *tokenizer, const struct StringCharClass *delimiters, struct StringView *view);
+# 1172 "/root/repo/src/../include/strutils.h"
+double *st_extract_double(struct StringTokenizer *tokenizer);
+# 1188 "/root/repo/src/../include/strutils.h"
+int st_extract_double_to(struct StringTokenizer *tokenizer, double *value);
+# 1207 "/root/repo/src/../include/strutils.h"
+int st_extract_int64(struct StringTokenizer *tokenizer, int64_t *value);
+# 1222 "/root/repo/src/../include/strutils.h"
+int *st_extract_boolean(struct StringTokenizer *tokenizer, const char *bool_value, const int int_value);
+# 1235 "/root/repo/src/../include/strutils.h"
+int st_starts_with(struct StringTokenizer *tokenizer, const char *needle);
+# 1251 "/root/repo/src/../include/strutils.h"
+int st_expand_string(struct StringTokenizer *tokenizer, const size_t size);
+# 1264 "/root/repo/src/../include/strutils.h"
+void st_set_growth_policy(struct StringTokenizer *tokenizer, const enum StringGrowthPolicy policy, const size_t max_increment);
+# 1278 "/root/repo/src/../include/strutils.h"
+int st_reserve(struct StringTokenizer *tokenizer, const size_t length);
+# 1292 "/root/repo/src/../include/strutils.h"
+int st_shrink_to_fit(struct StringTokenizer *tokenizer);
+# 1305 "/root/repo/src/../include/strutils.h"
+int st_append_string(struct StringTokenizer *tokenizer, const char *string);
+# 1320 "/root/repo/src/../include/strutils.h"
+int st_append_n(struct StringTokenizer *tokenizer, const char *string, const size_t length);
+# 1333 "/root/repo/src/../include/strutils.h"
+int st_append_char(struct StringTokenizer *tokenizer, const char token);
+# 1350 "/root/repo/src/../include/strutils.h"
+int st_append_many(struct StringTokenizer *tokenizer, const struct StringView *fragments, const size_t count);
+# 1365 "/root/repo/src/../include/strutils.h"
+int st_append_quoted_string(struct StringTokenizer *tokenizer, const char *string);
+# 1381 "/root/repo/src/../include/strutils.h"
+int st_append_escaped_string(struct StringTokenizer *tokenizer, const char *string);
+# 1398 "/root/repo/src/../include/strutils.h"
+int st_append_escaped_n(struct StringTokenizer *tokenizer, const char *string, const size_t length);
+# 1411 "/root/repo/src/../include/strutils.h"
+int st_append_int(struct StringTokenizer *tokenizer, const int64_t value);
+# 1427 "/root/repo/src/../include/strutils.h"
+int st_append_double(struct StringTokenizer *tokenizer, const double *value);
+# 1442 "/root/repo/src/../include/strutils.h"
+int st_append_double_precision(struct StringTokenizer *tokenizer, const double *value, const int precision);
+# 1457 "/root/repo/src/../include/strutils.h"
+int st_append_fixed(struct StringTokenizer *tokenizer, const double *value, const int precision);
+# 1473 "/root/repo/src/../include/strutils.h"
+static inline int is_numeric(const char token) {
+  return st_char_is(token, ST_CLASS_NUMERIC);
+}
+# 1517 "/root/repo/src/../include/strutils.h"
+char *itos(int value);
+# 1530 "/root/repo/src/../include/strutils.h"
+size_t itos_to(char *buffer, int value);
+# 1543 "/root/repo/src/../include/strutils.h"
+size_t i64tos_to(char *buffer, int64_t value);
+# 1556 "/root/repo/src/../include/strutils.h"
+size_t u64tos_to(char *buffer, uint64_t value);
+# 1568 "/root/repo/src/../include/strutils.h"
+char *ldtos(long double value);
+# 1579 "/root/repo/src/../include/strutils.h"
+long double stold(const char *numeric_string);
+# 1598 "/root/repo/src/../include/strutils.h"
+size_t stod(const char *string, const size_t length, double *value);
+# 1614 "/root/repo/src/../include/strutils.h"
+size_t dtos_to(char *buffer, const double value);
+# 1632 "/root/repo/src/../include/strutils.h"
+size_t dtos_precision_to(char *buffer, const double value, int precision);
+# 1651 "/root/repo/src/../include/strutils.h"
+size_t dtos_fixed_to(char *buffer, const double value, int precision);
+# 1672 "/root/repo/src/../include/strutils.h"
+size_t stoi64(const char *string, const size_t length, int64_t *value);
+# 1687 "/root/repo/src/../include/strutils.h"
+size_t stod_batch(const struct StringView *views, const size_t count, double *values);
+# 1702 "/root/repo/src/../include/strutils.h"
+size_t stoi64_batch(const struct StringView *views, const size_t count, int64_t *values);
+# 1719 "/root/repo/src/../include/strutils.h"
+size_t i64tos_batch(char *buffer, const int64_t *values, const size_t count, size_t *offsets);
+# 1736 "/root/repo/src/../include/strutils.h"
+size_t dtos_batch(char *buffer, const double *values, const size_t count, size_t *offsets);
+# 1756 "/root/repo/src/../include/strutils.h"
+struct JsonHandler {
+
+
+
+
+  int (*start_object)(void *context);
+
+
+
+
+  int (*end_object)(void *context);
+
+
+
+
+  int (*start_array)(void *context);
+
+
+
+
+  int (*end_array)(void *context);
+
+
+
+
+  int (*key)(void *context, const struct StringView *key);
+
+
+
+
+  int (*string)(void *context, const struct StringView *value);
+
+
+
+
+  int (*number)(void *context, const struct StringView *raw, double value);
+
+
+
+
+  int (*boolean)(void *context, int value);
+
+
+
+
+  int (*null)(void *context);
+};
+# 1822 "/root/repo/src/../include/strutils.h"
+int st_json_parse(struct StringTokenizer *tokenizer, const struct JsonHandler *handler, void *context);
+# 1840 "/root/repo/src/../include/strutils.h"
+int st_json_unescape(const struct StringView *view, char *buffer, size_t *length);
+# 1856 "/root/repo/src/../include/strutils.h"
+int st_skip_value(struct StringTokenizer *tokenizer);
+# 1875 "/root/repo/src/../include/strutils.h"
+int st_find_key(struct StringTokenizer *tokenizer, const char *key);
+# 1892 "/root/repo/src/../include/strutils.h"
+struct StringStructuralIndex {
+
+
+
+
+  size_t *positions;
+
+
+
+
+  size_t count;
+
+
+
+
+
+  uint64_t *in_string;
+
+
+
+
+  size_t length;
+
+
+
+
+  size_t hint;
+};
+# 1935 "/root/repo/src/../include/strutils.h"
+int st_build_structural_index(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+void st_drop_structural_index(struct StringTokenizer *tokenizer);
+# 1956 "/root/repo/src/../include/strutils.h"
+size_t st_structural_next(struct StringStructuralIndex *index, const size_t position);
+# 1969 "/root/repo/src/../include/strutils.h"
+static inline int st_structural_in_string(const struct StringStructuralIndex *index, const size_t position) {
+  return (int)((index->in_string[position / 64] >> (position % 64)) & 1);
+}
+# 1983 "/root/repo/src/../include/strutils.h"
+void st_next_structural(struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/uio.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 2 3 4
+
+
+
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 3 4
+struct iovec
+  {
+    void *iov_base;
+    size_t iov_len;
+  };
+# 24 "/usr/include/x86_64-linux-gnu/sys/uio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uio_lim.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/sys/uio.h" 2 3 4
+
+
+
+
+
+
+
+# 41 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t readv (int __fd, const struct iovec *__iovec, int __count)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 52 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t writev (int __fd, const struct iovec *__iovec, int __count)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 67 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t preadv (int __fd, const struct iovec *__iovec, int __count,
+         __off_t __offset)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 80 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t pwritev (int __fd, const struct iovec *__iovec, int __count,
+   __off_t __offset)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 174 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+
+# 1991 "/root/repo/src/../include/strutils.h" 2
+# 2010 "/root/repo/src/../include/strutils.h"
+
+# 2010 "/root/repo/src/../include/strutils.h"
+struct StringParallelHandler {
+
+
+
+
+
+  int (*process)(void *context, struct StringTokenizer *tokenizer, void **result);
+
+
+
+
+
+  int (*merge)(void *context, void *result);
+};
+# 2050 "/root/repo/src/../include/strutils.h"
+int st_parallel_lines(char *string, const size_t length, size_t threads, size_t chunk_size, const struct StringParallelHandler *handler, void *context);
+
+
+
+
+struct StringFragments {
+
+
+
+
+  struct StringTokenizer **fragments;
+
+
+
+
+  size_t count;
+
+
+
+
+  struct iovec *iov;
+
+
+
+
+  size_t iov_count;
+
+
+
+
+  size_t length;
+
+
+
+
+  char *separator;
+};
+# 2113 "/root/repo/src/../include/strutils.h"
+int st_parallel_serialize(struct StringFragments *fragments, const size_t count, size_t threads, size_t batch_size, int (*serialize)(void *context, struct StringTokenizer *tokenizer, size_t index), void *context, const char *separator);
+# 2128 "/root/repo/src/../include/strutils.h"
+int st_fragments_stitch(const struct StringFragments *fragments, struct StringTokenizer *tokenizer);
+
+
+
+
+
+
+
+void st_fragments_free(struct StringFragments *fragments);
+# 2158 "/root/repo/src/../include/strutils.h"
+struct StringOutputBlock;
+# 2167 "/root/repo/src/../include/strutils.h"
+struct StringOutput {
+
+
+
+
+  struct StringOutputBlock *head;
+
+
+
+
+  struct StringOutputBlock *tail;
+
+
+
+
+  struct StringOutputBlock *spare;
+
+
+
+
+  size_t block_size;
+
+
+
+
+  size_t length;
+
+
+
+
+  size_t flush_threshold;
+
+
+
+
+  int fd;
+
+
+
+
+  size_t written;
+
+
+
+
+  int error;
+};
+# 2228 "/root/repo/src/../include/strutils.h"
+struct StringOutput *st_output_create(const int fd, const size_t block_size, const size_t flush_threshold);
+# 2243 "/root/repo/src/../include/strutils.h"
+char *st_output_reserve(struct StringOutput *output, const size_t size);
+# 2256 "/root/repo/src/../include/strutils.h"
+int st_output_commit(struct StringOutput *output, const size_t size);
+# 2271 "/root/repo/src/../include/strutils.h"
+int st_output_append_n(struct StringOutput *output, const char *string, const size_t length);
+# 2284 "/root/repo/src/../include/strutils.h"
+int st_output_append_string(struct StringOutput *output, const char *string);
+# 2297 "/root/repo/src/../include/strutils.h"
+int st_output_append_char(struct StringOutput *output, const char token);
+# 2310 "/root/repo/src/../include/strutils.h"
+int st_output_append_int(struct StringOutput *output, const int64_t value);
+# 2323 "/root/repo/src/../include/strutils.h"
+int st_output_append_double(struct StringOutput *output, const double value);
+# 2338 "/root/repo/src/../include/strutils.h"
+size_t st_output_iov(const struct StringOutput *output, struct iovec *iov, const size_t count);
+# 2353 "/root/repo/src/../include/strutils.h"
+int st_output_flush(struct StringOutput *output);
+
+
+
+
+
+
+
+void st_output_reset(struct StringOutput *output);
+
+
+
+
+
+
+
+void st_output_destroy(struct StringOutput *output);
+# 5 "/root/repo/src/numeric_formatter.c" 2
+# 35 "/root/repo/src/numeric_formatter.c"
+static const uint64_t numeric_formatter_pow5_inv_split[342][2] = {
+  {1ULL, 2305843009213693952ULL},
+  {11068046444225730970ULL, 1844674407370955161ULL},
+  {5165088340638674453ULL, 1475739525896764129ULL},
+  {7821419487252849886ULL, 1180591620717411303ULL},
+  {8824922364862649494ULL, 1888946593147858085ULL},
+  {7059937891890119595ULL, 1511157274518286468ULL},
+  {13026647942995916322ULL, 1208925819614629174ULL},
+  {9774590264567735146ULL, 1934281311383406679ULL},
+  {11509021026396098440ULL, 1547425049106725343ULL},
+  {16585914450600699399ULL, 1237940039285380274ULL},
+  {15469416676735388068ULL, 1980704062856608439ULL},
+  {16064882156130220778ULL, 1584563250285286751ULL},
+  {9162556910162266299ULL, 1267650600228229401ULL},
+  {7281393426775805432ULL, 2028240960365167042ULL},
+  {16893161185646375315ULL, 1622592768292133633ULL},
+  {2446482504291369283ULL, 1298074214633706907ULL},
+  {7603720821608101175ULL, 2076918743413931051ULL},
+  {2393627842544570617ULL, 1661534994731144841ULL},
+  {16672297533003297786ULL, 1329227995784915872ULL},
+  {11918280793837635165ULL, 2126764793255865396ULL},
+  {5845275820328197809ULL, 1701411834604692317ULL},
+  {15744267100488289217ULL, 1361129467683753853ULL},
+  {3054734472329800808ULL, 2177807148294006166ULL},
+  {17201182836831481939ULL, 1742245718635204932ULL},
+  {6382248639981364905ULL, 1393796574908163946ULL},
+  {2832900194486363201ULL, 2230074519853062314ULL},
+  {5955668970331000884ULL, 1784059615882449851ULL},
+  {1075186361522890384ULL, 1427247692705959881ULL},
+  {12788344622662355584ULL, 2283596308329535809ULL},
+  {13920024512871794791ULL, 1826877046663628647ULL},
+  {3757321980813615186ULL, 1461501637330902918ULL},
+  {10384555214134712795ULL, 1169201309864722334ULL},
+  {5547241898389809503ULL, 1870722095783555735ULL},
+  {4437793518711847602ULL, 1496577676626844588ULL},
+  {10928932444453298728ULL, 1197262141301475670ULL},
+  {17486291911125277965ULL, 1915619426082361072ULL},
+  {6610335899416401726ULL, 1532495540865888858ULL},
+  {12666966349016942027ULL, 1225996432692711086ULL},
+  {12888448528943286597ULL, 1961594292308337738ULL},
+  {17689456452638449924ULL, 1569275433846670190ULL},
+  {14151565162110759939ULL, 1255420347077336152ULL},
+  {7885109000409574610ULL, 2008672555323737844ULL},
+  {9997436015069570011ULL, 1606938044258990275ULL},
+  {7997948812055656009ULL, 1285550435407192220ULL},
+  {12796718099289049614ULL, 2056880696651507552ULL},
+  {2858676849947419045ULL, 1645504557321206042ULL},
+  {13354987924183666206ULL, 1316403645856964833ULL},
+  {17678631863951955605ULL, 2106245833371143733ULL},
+  {3074859046935833515ULL, 1684996666696914987ULL},
+  {13527933681774397782ULL, 1347997333357531989ULL},
+  {10576647446613305481ULL, 2156795733372051183ULL},
+  {15840015586774465031ULL, 1725436586697640946ULL},
+  {8982663654677661702ULL, 1380349269358112757ULL},
+  {18061610662226169046ULL, 2208558830972980411ULL},
+  {10759939715039024913ULL, 1766847064778384329ULL},
+  {12297300586773130254ULL, 1413477651822707463ULL},
+  {15986332124095098083ULL, 2261564242916331941ULL},
+  {9099716884534168143ULL, 1809251394333065553ULL},
+  {14658471137111155161ULL, 1447401115466452442ULL},
+  {4348079280205103483ULL, 1157920892373161954ULL},
+  {14335624477811986218ULL, 1852673427797059126ULL},
+  {7779150767507678651ULL, 1482138742237647301ULL},
+  {2533971799264232598ULL, 1185710993790117841ULL},
+  {15122401323048503126ULL, 1897137590064188545ULL},
+  {12097921058438802501ULL, 1517710072051350836ULL},
+  {5988988032009131678ULL, 1214168057641080669ULL},
+  {16961078480698431330ULL, 1942668892225729070ULL},
+  {13568862784558745064ULL, 1554135113780583256ULL},
+  {7165741412905085728ULL, 1243308091024466605ULL},
+  {11465186260648137165ULL, 1989292945639146568ULL},
+  {16550846638002330379ULL, 1591434356511317254ULL},
+  {16930026125143774626ULL, 1273147485209053803ULL},
+  {4951948911778577463ULL, 2037035976334486086ULL},
+  {272210314680951647ULL, 1629628781067588869ULL},
+  {3907117066486671641ULL, 1303703024854071095ULL},
+  {6251387306378674625ULL, 2085924839766513752ULL},
+  {16069156289328670670ULL, 1668739871813211001ULL},
+  {9165976216721026213ULL, 1334991897450568801ULL},
+  {7286864317269821294ULL, 2135987035920910082ULL},
+  {16897537898041588005ULL, 1708789628736728065ULL},
+  {13518030318433270404ULL, 1367031702989382452ULL},
+  {6871453250525591353ULL, 2187250724783011924ULL},
+  {9186511415162383406ULL, 1749800579826409539ULL},
+  {11038557946871817048ULL, 1399840463861127631ULL},
+  {10282995085511086630ULL, 2239744742177804210ULL},
+  {8226396068408869304ULL, 1791795793742243368ULL},
+  {13959814484210916090ULL, 1433436634993794694ULL},
+  {11267656730511734774ULL, 2293498615990071511ULL},
+  {5324776569667477496ULL, 1834798892792057209ULL},
+  {7949170070475892320ULL, 1467839114233645767ULL},
+  {17427382500606444826ULL, 1174271291386916613ULL},
+  {5747719112518849781ULL, 1878834066219066582ULL},
+  {15666221734240810795ULL, 1503067252975253265ULL},
+  {12532977387392648636ULL, 1202453802380202612ULL},
+  {5295368560860596524ULL, 1923926083808324180ULL},
+  {4236294848688477220ULL, 1539140867046659344ULL},
+  {7078384693692692099ULL, 1231312693637327475ULL},
+  {11325415509908307358ULL, 1970100309819723960ULL},
+  {9060332407926645887ULL, 1576080247855779168ULL},
+  {14626963555825137356ULL, 1260864198284623334ULL},
+  {12335095245094488799ULL, 2017382717255397335ULL},
+  {9868076196075591040ULL, 1613906173804317868ULL},
+  {15273158586344293478ULL, 1291124939043454294ULL},
+  {13369007293925138595ULL, 2065799902469526871ULL},
+  {7005857020398200553ULL, 1652639921975621497ULL},
+  {16672732060544291412ULL, 1322111937580497197ULL},
+  {11918976037903224966ULL, 2115379100128795516ULL},
+  {5845832015580669650ULL, 1692303280103036413ULL},
+  {12055363241948356366ULL, 1353842624082429130ULL},
+  {841837113407818570ULL, 2166148198531886609ULL},
+  {4362818505468165179ULL, 1732918558825509287ULL},
+  {14558301248600263113ULL, 1386334847060407429ULL},
+  {12225235553534690011ULL, 2218135755296651887ULL},
+  {2401490813343931363ULL, 1774508604237321510ULL},
+  {1921192650675145090ULL, 1419606883389857208ULL},
+  {17831303500047873437ULL, 2271371013423771532ULL},
+  {6886345170554478103ULL, 1817096810739017226ULL},
+  {1819727321701672159ULL, 1453677448591213781ULL},
+  {16213177116328979020ULL, 1162941958872971024ULL},
+  {14873036941900635463ULL, 1860707134196753639ULL},
+  {15587778368262418694ULL, 1488565707357402911ULL},
+  {8780873879868024632ULL, 1190852565885922329ULL},
+  {2981351763563108441ULL, 1905364105417475727ULL},
+  {13453127855076217722ULL, 1524291284333980581ULL},
+  {7073153469319063855ULL, 1219433027467184465ULL},
+  {11317045550910502167ULL, 1951092843947495144ULL},
+  {12742985255470312057ULL, 1560874275157996115ULL},
+  {10194388204376249646ULL, 1248699420126396892ULL},
+  {1553625868034358140ULL, 1997919072202235028ULL},
+  {8621598323911307159ULL, 1598335257761788022ULL},
+  {17965325103354776697ULL, 1278668206209430417ULL},
+  {13987124906400001422ULL, 2045869129935088668ULL},
+  {121653480894270168ULL, 1636695303948070935ULL},
+  {97322784715416134ULL, 1309356243158456748ULL},
+  {14913111714512307107ULL, 2094969989053530796ULL},
+  {8241140556867935363ULL, 1675975991242824637ULL},
+  {17660958889720079260ULL, 1340780792994259709ULL},
+  {17189487779326395846ULL, 2145249268790815535ULL},
+  {13751590223461116677ULL, 1716199415032652428ULL},
+  {18379969808252713988ULL, 1372959532026121942ULL},
+  {14650556434236701088ULL, 2196735251241795108ULL},
+  {652398703163629901ULL, 1757388200993436087ULL},
+  {11589965406756634890ULL, 1405910560794748869ULL},
+  {7475898206584884855ULL, 2249456897271598191ULL},
+  {2291369750525997561ULL, 1799565517817278553ULL},
+  {9211793429904618695ULL, 1439652414253822842ULL},
+  {18428218302589300235ULL, 2303443862806116547ULL},
+  {7363877012587619542ULL, 1842755090244893238ULL},
+  {13269799239553916280ULL, 1474204072195914590ULL},
+  {10615839391643133024ULL, 1179363257756731672ULL},
+  {2227947767661371545ULL, 1886981212410770676ULL},
+  {16539753473096738529ULL, 1509584969928616540ULL},
+  {13231802778477390823ULL, 1207667975942893232ULL},
+  {6413489186596184024ULL, 1932268761508629172ULL},
+  {16198837793502678189ULL, 1545815009206903337ULL},
+  {5580372605318321905ULL, 1236652007365522670ULL},
+  {8928596168509315048ULL, 1978643211784836272ULL},
+  {18210923379033183008ULL, 1582914569427869017ULL},
+  {7190041073742725760ULL, 1266331655542295214ULL},
+  {436019273762630246ULL, 2026130648867672343ULL},
+  {7727513048493924843ULL, 1620904519094137874ULL},
+  {9871359253537050198ULL, 1296723615275310299ULL},
+  {4726128361433549347ULL, 2074757784440496479ULL},
+  {7470251503888749801ULL, 1659806227552397183ULL},
+  {13354898832594820487ULL, 1327844982041917746ULL},
+  {13989140502667892133ULL, 2124551971267068394ULL},
+  {14880661216876224029ULL, 1699641577013654715ULL},
+  {11904528973500979224ULL, 1359713261610923772ULL},
+  {4289851098633925465ULL, 2175541218577478036ULL},
+  {18189276137874781665ULL, 1740432974861982428ULL},
+  {3483374466074094362ULL, 1392346379889585943ULL},
+  {1884050330976640656ULL, 2227754207823337509ULL},
+  {5196589079523222848ULL, 1782203366258670007ULL},
+  {15225317707844309248ULL, 1425762693006936005ULL},
+  {5913764258841343181ULL, 2281220308811097609ULL},
+  {8420360221814984868ULL, 1824976247048878087ULL},
+  {17804334621677718864ULL, 1459980997639102469ULL},
+  {17932816512084085415ULL, 1167984798111281975ULL},
+  {10245762345624985047ULL, 1868775676978051161ULL},
+  {4507261061758077715ULL, 1495020541582440929ULL},
+  {7295157664148372495ULL, 1196016433265952743ULL},
+  {7982903447895485668ULL, 1913626293225524389ULL},
+  {10075671573058298858ULL, 1530901034580419511ULL},
+  {4371188443704728763ULL, 1224720827664335609ULL},
+  {14372599139411386667ULL, 1959553324262936974ULL},
+  {15187428126271019657ULL, 1567642659410349579ULL},
+  {15839291315758726049ULL, 1254114127528279663ULL},
+  {3206773216762499739ULL, 2006582604045247462ULL},
+  {13633465017635730761ULL, 1605266083236197969ULL},
+  {14596120828850494932ULL, 1284212866588958375ULL},
+  {4907049252451240275ULL, 2054740586542333401ULL},
+  {236290587219081897ULL, 1643792469233866721ULL},
+  {14946427728742906810ULL, 1315033975387093376ULL},
+  {16535586736504830250ULL, 2104054360619349402ULL},
+  {5849771759720043554ULL, 1683243488495479522ULL},
+  {15747863852001765813ULL, 1346594790796383617ULL},
+  {10439186904235184007ULL, 2154551665274213788ULL},
+  {15730047152871967852ULL, 1723641332219371030ULL},
+  {12584037722297574282ULL, 1378913065775496824ULL},
+  {9066413911450387881ULL, 2206260905240794919ULL},
+  {10942479943902220628ULL, 1765008724192635935ULL},
+  {8753983955121776503ULL, 1412006979354108748ULL},
+  {10317025513452932081ULL, 2259211166966573997ULL},
+  {874922781278525018ULL, 1807368933573259198ULL},
+  {8078635854506640661ULL, 1445895146858607358ULL},
+  {13841606313089133175ULL, 1156716117486885886ULL},
+  {14767872471458792434ULL, 1850745787979017418ULL},
+  {746251532941302978ULL, 1480596630383213935ULL},
+  {597001226353042382ULL, 1184477304306571148ULL},
+  {15712597221132509104ULL, 1895163686890513836ULL},
+  {8880728962164096960ULL, 1516130949512411069ULL},
+  {10793931984473187891ULL, 1212904759609928855ULL},
+  {17270291175157100626ULL, 1940647615375886168ULL},
+  {2748186495899949531ULL, 1552518092300708935ULL},
+  {2198549196719959625ULL, 1242014473840567148ULL},
+  {18275073973719576693ULL, 1987223158144907436ULL},
+  {10930710364233751031ULL, 1589778526515925949ULL},
+  {12433917106128911148ULL, 1271822821212740759ULL},
+  {8826220925580526867ULL, 2034916513940385215ULL},
+  {7060976740464421494ULL, 1627933211152308172ULL},
+  {16716827836597268165ULL, 1302346568921846537ULL},
+  {11989529279587987770ULL, 2083754510274954460ULL},
+  {9591623423670390216ULL, 1667003608219963568ULL},
+  {15051996368420132820ULL, 1333602886575970854ULL},
+  {13015147745246481542ULL, 2133764618521553367ULL},
+  {3033420566713364587ULL, 1707011694817242694ULL},
+  {6116085268112601993ULL, 1365609355853794155ULL},
+  {9785736428980163188ULL, 2184974969366070648ULL},
+  {15207286772667951197ULL, 1747979975492856518ULL},
+  {1097782973908629988ULL, 1398383980394285215ULL},
+  {1756452758253807981ULL, 2237414368630856344ULL},
+  {5094511021344956708ULL, 1789931494904685075ULL},
+  {4075608817075965366ULL, 1431945195923748060ULL},
+  {6520974107321544586ULL, 2291112313477996896ULL},
+  {1527430471115325346ULL, 1832889850782397517ULL},
+  {12289990821117991246ULL, 1466311880625918013ULL},
+  {17210690286378213644ULL, 1173049504500734410ULL},
+  {9090360384495590213ULL, 1876879207201175057ULL},
+  {18340334751822203140ULL, 1501503365760940045ULL},
+  {14672267801457762512ULL, 1201202692608752036ULL},
+  {16096930852848599373ULL, 1921924308174003258ULL},
+  {1809498238053148529ULL, 1537539446539202607ULL},
+  {12515645034668249793ULL, 1230031557231362085ULL},
+  {1578287981759648052ULL, 1968050491570179337ULL},
+  {12330676829633449412ULL, 1574440393256143469ULL},
+  {13553890278448669853ULL, 1259552314604914775ULL},
+  {3239480371808320148ULL, 2015283703367863641ULL},
+  {17348979556414297411ULL, 1612226962694290912ULL},
+  {6500486015647617283ULL, 1289781570155432730ULL},
+  {10400777625036187652ULL, 2063650512248692368ULL},
+  {15699319729512770768ULL, 1650920409798953894ULL},
+  {16248804598352126938ULL, 1320736327839163115ULL},
+  {7551343283653851484ULL, 2113178124542660985ULL},
+  {6041074626923081187ULL, 1690542499634128788ULL},
+  {12211557331022285596ULL, 1352433999707303030ULL},
+  {1091747655926105338ULL, 2163894399531684849ULL},
+  {4562746939482794594ULL, 1731115519625347879ULL},
+  {7339546366328145998ULL, 1384892415700278303ULL},
+  {8053925371383123274ULL, 2215827865120445285ULL},
+  {6443140297106498619ULL, 1772662292096356228ULL},
+  {12533209867169019542ULL, 1418129833677084982ULL},
+  {5295740528502789974ULL, 2269007733883335972ULL},
+  {15304638867027962949ULL, 1815206187106668777ULL},
+  {4865013464138549713ULL, 1452164949685335022ULL},
+  {14960057215536570740ULL, 1161731959748268017ULL},
+  {9178696285890871890ULL, 1858771135597228828ULL},
+  {14721654658196518159ULL, 1487016908477783062ULL},
+  {4398626097073393881ULL, 1189613526782226450ULL},
+  {7037801755317430209ULL, 1903381642851562320ULL},
+  {5630241404253944167ULL, 1522705314281249856ULL},
+  {814844308661245011ULL, 1218164251424999885ULL},
+  {1303750893857992017ULL, 1949062802279999816ULL},
+  {15800395974054034906ULL, 1559250241823999852ULL},
+  {5261619149759407279ULL, 1247400193459199882ULL},
+  {12107939454356961969ULL, 1995840309534719811ULL},
+  {5997002748743659252ULL, 1596672247627775849ULL},
+  {8486951013736837725ULL, 1277337798102220679ULL},
+  {2511075177753209390ULL, 2043740476963553087ULL},
+  {13076906586428298482ULL, 1634992381570842469ULL},
+  {14150874083884549109ULL, 1307993905256673975ULL},
+  {4194654460505726958ULL, 2092790248410678361ULL},
+  {18113118827372222859ULL, 1674232198728542688ULL},
+  {3422448617672047318ULL, 1339385758982834151ULL},
+  {16543964232501006678ULL, 2143017214372534641ULL},
+  {9545822571258895019ULL, 1714413771498027713ULL},
+  {15015355686490936662ULL, 1371531017198422170ULL},
+  {5577825024675947042ULL, 2194449627517475473ULL},
+  {11840957649224578280ULL, 1755559702013980378ULL},
+  {16851463748863483271ULL, 1404447761611184302ULL},
+  {12204946739213931940ULL, 2247116418577894884ULL},
+  {13453306206113055875ULL, 1797693134862315907ULL},
+  {3383947335406624054ULL, 1438154507889852726ULL},
+  {16482362180876329456ULL, 2301047212623764361ULL},
+  {9496540929959153242ULL, 1840837770099011489ULL},
+  {11286581558709232917ULL, 1472670216079209191ULL},
+  {5339916432225476010ULL, 1178136172863367353ULL},
+  {4854517476818851293ULL, 1885017876581387765ULL},
+  {3883613981455081034ULL, 1508014301265110212ULL},
+  {14174937629389795797ULL, 1206411441012088169ULL},
+  {11611853762797942306ULL, 1930258305619341071ULL},
+  {5600134195496443521ULL, 1544206644495472857ULL},
+  {15548153800622885787ULL, 1235365315596378285ULL},
+  {6430302007287065643ULL, 1976584504954205257ULL},
+  {16212288050055383484ULL, 1581267603963364205ULL},
+  {12969830440044306787ULL, 1265014083170691364ULL},
+  {9683682259845159889ULL, 2024022533073106183ULL},
+  {15125643437359948558ULL, 1619218026458484946ULL},
+  {8411165935146048523ULL, 1295374421166787957ULL},
+  {17147214310975587960ULL, 2072599073866860731ULL},
+  {10028422634038560045ULL, 1658079259093488585ULL},
+  {8022738107230848036ULL, 1326463407274790868ULL},
+  {9147032156827446534ULL, 2122341451639665389ULL},
+  {11006974540203867551ULL, 1697873161311732311ULL},
+  {5116230817421183718ULL, 1358298529049385849ULL},
+  {15564666937357714594ULL, 2173277646479017358ULL},
+  {1383687105660440706ULL, 1738622117183213887ULL},
+  {12174996128754083534ULL, 1390897693746571109ULL},
+  {8411947361780802685ULL, 2225436309994513775ULL},
+  {6729557889424642148ULL, 1780349047995611020ULL},
+  {5383646311539713719ULL, 1424279238396488816ULL},
+  {1235136468979721303ULL, 2278846781434382106ULL},
+  {15745504434151418335ULL, 1823077425147505684ULL},
+  {16285752362063044992ULL, 1458461940118004547ULL},
+  {5649904260166615347ULL, 1166769552094403638ULL},
+  {5350498001524674232ULL, 1866831283351045821ULL},
+  {591049586477829062ULL, 1493465026680836657ULL},
+  {11540886113407994219ULL, 1194772021344669325ULL},
+  {18673707743239135ULL, 1911635234151470921ULL},
+  {14772334225162232601ULL, 1529308187321176736ULL},
+  {8128518565387875758ULL, 1223446549856941389ULL},
+  {1937583260394870242ULL, 1957514479771106223ULL},
+  {8928764237799716840ULL, 1566011583816884978ULL},
+  {14521709019723594119ULL, 1252809267053507982ULL},
+  {8477339172590109297ULL, 2004494827285612772ULL},
+  {17849917782297818407ULL, 1603595861828490217ULL},
+  {6901236596354434079ULL, 1282876689462792174ULL},
+  {18420676183650915173ULL, 2052602703140467478ULL},
+  {3668494502695001169ULL, 1642082162512373983ULL},
+  {10313493231639821582ULL, 1313665730009899186ULL},
+  {9122891541139893884ULL, 2101865168015838698ULL},
+  {14677010862395735754ULL, 1681492134412670958ULL},
+  {673562245690857633ULL, 1345193707530136767ULL},
+};
+
+
+
+
+
+
+static const uint64_t numeric_formatter_pow5_split[326][2] = {
+  {0ULL, 1152921504606846976ULL},
+  {0ULL, 1441151880758558720ULL},
+  {0ULL, 1801439850948198400ULL},
+  {0ULL, 2251799813685248000ULL},
+  {0ULL, 1407374883553280000ULL},
+  {0ULL, 1759218604441600000ULL},
+  {0ULL, 2199023255552000000ULL},
+  {0ULL, 1374389534720000000ULL},
+  {0ULL, 1717986918400000000ULL},
+  {0ULL, 2147483648000000000ULL},
+  {0ULL, 1342177280000000000ULL},
+  {0ULL, 1677721600000000000ULL},
+  {0ULL, 2097152000000000000ULL},
+  {0ULL, 1310720000000000000ULL},
+  {0ULL, 1638400000000000000ULL},
+  {0ULL, 2048000000000000000ULL},
+  {0ULL, 1280000000000000000ULL},
+  {0ULL, 1600000000000000000ULL},
+  {0ULL, 2000000000000000000ULL},
+  {0ULL, 1250000000000000000ULL},
+  {0ULL, 1562500000000000000ULL},
+  {0ULL, 1953125000000000000ULL},
+  {0ULL, 1220703125000000000ULL},
+  {0ULL, 1525878906250000000ULL},
+  {0ULL, 1907348632812500000ULL},
+  {0ULL, 1192092895507812500ULL},
+  {0ULL, 1490116119384765625ULL},
+  {4611686018427387904ULL, 1862645149230957031ULL},
+  {9799832789158199296ULL, 1164153218269348144ULL},
+  {12249790986447749120ULL, 1455191522836685180ULL},
+  {15312238733059686400ULL, 1818989403545856475ULL},
+  {14528612397897220096ULL, 2273736754432320594ULL},
+  {13692068767113150464ULL, 1421085471520200371ULL},
+  {12503399940464050176ULL, 1776356839400250464ULL},
+  {15629249925580062720ULL, 2220446049250313080ULL},
+  {9768281203487539200ULL, 1387778780781445675ULL},
+  {7598665485932036096ULL, 1734723475976807094ULL},
+  {274959820560269312ULL, 2168404344971008868ULL},
+  {9395221924704944128ULL, 1355252715606880542ULL},
+  {2520655369026404352ULL, 1694065894508600678ULL},
+  {12374191248137781248ULL, 2117582368135750847ULL},
+  {14651398557727195136ULL, 1323488980084844279ULL},
+  {13702562178731606016ULL, 1654361225106055349ULL},
+  {3293144668132343808ULL, 2067951531382569187ULL},
+  {18199116482078572544ULL, 1292469707114105741ULL},
+  {8913837547316051968ULL, 1615587133892632177ULL},
+  {15753982952572452864ULL, 2019483917365790221ULL},
+  {12152082354571476992ULL, 1262177448353618888ULL},
+  {15190102943214346240ULL, 1577721810442023610ULL},
+  {9764256642163156992ULL, 1972152263052529513ULL},
+  {17631875447420442880ULL, 1232595164407830945ULL},
+  {8204786253993389888ULL, 1540743955509788682ULL},
+  {1032610780636961552ULL, 1925929944387235853ULL},
+  {2951224747111794922ULL, 1203706215242022408ULL},
+  {3689030933889743652ULL, 1504632769052528010ULL},
+  {13834660704216955373ULL, 1880790961315660012ULL},
+  {17870034976990372916ULL, 1175494350822287507ULL},
+  {17725857702810578241ULL, 1469367938527859384ULL},
+  {3710578054803671186ULL, 1836709923159824231ULL},
+  {26536550077201078ULL, 2295887403949780289ULL},
+  {11545800389866720434ULL, 1434929627468612680ULL},
+  {14432250487333400542ULL, 1793662034335765850ULL},
+  {8816941072311974870ULL, 2242077542919707313ULL},
+  {17039803216263454053ULL, 1401298464324817070ULL},
+  {12076381983474541759ULL, 1751623080406021338ULL},
+  {5872105442488401391ULL, 2189528850507526673ULL},
+  {15199280947623720629ULL, 1368455531567204170ULL},
+  {9775729147674874978ULL, 1710569414459005213ULL},
+  {16831347453020981627ULL, 2138211768073756516ULL},
+  {1296220121283337709ULL, 1336382355046097823ULL},
+  {15455333206886335848ULL, 1670477943807622278ULL},
+  {10095794471753144002ULL, 2088097429759527848ULL},
+  {6309871544845715001ULL, 1305060893599704905ULL},
+  {12499025449484531656ULL, 1631326116999631131ULL},
+  {11012095793428276666ULL, 2039157646249538914ULL},
+  {11494245889320060820ULL, 1274473528905961821ULL},
+  {532749306367912313ULL, 1593091911132452277ULL},
+  {5277622651387278295ULL, 1991364888915565346ULL},
+  {7910200175544436838ULL, 1244603055572228341ULL},
+  {14499436237857933952ULL, 1555753819465285426ULL},
+  {8900923260467641632ULL, 1944692274331606783ULL},
+  {12480606065433357876ULL, 1215432671457254239ULL},
+  {10989071563364309441ULL, 1519290839321567799ULL},
+  {9124653435777998898ULL, 1899113549151959749ULL},
+  {8008751406574943263ULL, 1186945968219974843ULL},
+  {5399253239791291175ULL, 1483682460274968554ULL},
+  {15972438586593889776ULL, 1854603075343710692ULL},
+  {759402079766405302ULL, 1159126922089819183ULL},
+  {14784310654990170340ULL, 1448908652612273978ULL},
+  {9257016281882937117ULL, 1811135815765342473ULL},
+  {16182956370781059300ULL, 2263919769706678091ULL},
+  {7808504722524468110ULL, 1414949856066673807ULL},
+  {5148944884728197234ULL, 1768687320083342259ULL},
+  {1824495087482858639ULL, 2210859150104177824ULL},
+  {1140309429676786649ULL, 1381786968815111140ULL},
+  {1425386787095983311ULL, 1727233711018888925ULL},
+  {6393419502297367043ULL, 2159042138773611156ULL},
+  {13219259225790630210ULL, 1349401336733506972ULL},
+  {16524074032238287762ULL, 1686751670916883715ULL},
+  {16043406521870471799ULL, 2108439588646104644ULL},
+  {803757039314269066ULL, 1317774742903815403ULL},
+  {14839754354425000045ULL, 1647218428629769253ULL},
+  {4714634887749086344ULL, 2059023035787211567ULL},
+  {9864175832484260821ULL, 1286889397367007229ULL},
+  {16941905809032713930ULL, 1608611746708759036ULL},
+  {2730638187581340797ULL, 2010764683385948796ULL},
+  {10930020904093113806ULL, 1256727927116217997ULL},
+  {18274212148543780162ULL, 1570909908895272496ULL},
+  {4396021111970173586ULL, 1963637386119090621ULL},
+  {5053356204195052443ULL, 1227273366324431638ULL},
+  {15540067292098591362ULL, 1534091707905539547ULL},
+  {14813398096695851299ULL, 1917614634881924434ULL},
+  {13870059828862294966ULL, 1198509146801202771ULL},
+  {12725888767650480803ULL, 1498136433501503464ULL},
+  {15907360959563101004ULL, 1872670541876879330ULL},
+  {14553786618154326031ULL, 1170419088673049581ULL},
+  {4357175217410743827ULL, 1463023860841311977ULL},
+  {10058155040190817688ULL, 1828779826051639971ULL},
+  {7961007781811134206ULL, 2285974782564549964ULL},
+  {14199001900486734687ULL, 1428734239102843727ULL},
+  {13137066357181030455ULL, 1785917798878554659ULL},
+  {11809646928048900164ULL, 2232397248598193324ULL},
+  {16604401366885338411ULL, 1395248280373870827ULL},
+  {16143815690179285109ULL, 1744060350467338534ULL},
+  {10956397575869330579ULL, 2180075438084173168ULL},
+  {6847748484918331612ULL, 1362547148802608230ULL},
+  {17783057643002690323ULL, 1703183936003260287ULL},
+  {17617136035325974999ULL, 2128979920004075359ULL},
+  {17928239049719816230ULL, 1330612450002547099ULL},
+  {17798612793722382384ULL, 1663265562503183874ULL},
+  {13024893955298202172ULL, 2079081953128979843ULL},
+  {5834715712847682405ULL, 1299426220705612402ULL},
+  {16516766677914378815ULL, 1624282775882015502ULL},
+  {11422586310538197711ULL, 2030353469852519378ULL},
+  {11750802462513761473ULL, 1268970918657824611ULL},
+  {10076817059714813937ULL, 1586213648322280764ULL},
+  {12596021324643517422ULL, 1982767060402850955ULL},
+  {5566670318688504437ULL, 1239229412751781847ULL},
+  {2346651879933242642ULL, 1549036765939727309ULL},
+  {7545000868343941206ULL, 1936295957424659136ULL},
+  {4715625542714963254ULL, 1210184973390411960ULL},
+  {5894531928393704067ULL, 1512731216738014950ULL},
+  {16591536947346905892ULL, 1890914020922518687ULL},
+  {17287239619732898039ULL, 1181821263076574179ULL},
+  {16997363506238734644ULL, 1477276578845717724ULL},
+  {2799960309088866689ULL, 1846595723557147156ULL},
+  {10973347230035317489ULL, 1154122327223216972ULL},
+  {13716684037544146861ULL, 1442652909029021215ULL},
+  {12534169028502795672ULL, 1803316136286276519ULL},
+  {11056025267201106687ULL, 2254145170357845649ULL},
+  {18439230838069161439ULL, 1408840731473653530ULL},
+  {13825666510731675991ULL, 1761050914342066913ULL},
+  {3447025083132431277ULL, 2201313642927583642ULL},
+  {6766076695385157452ULL, 1375821026829739776ULL},
+  {8457595869231446815ULL, 1719776283537174720ULL},
+  {10571994836539308519ULL, 2149720354421468400ULL},
+  {6607496772837067824ULL, 1343575221513417750ULL},
+  {17482743002901110588ULL, 1679469026891772187ULL},
+  {17241742735199000331ULL, 2099336283614715234ULL},
+  {15387775227926763111ULL, 1312085177259197021ULL},
+  {5399660979626290177ULL, 1640106471573996277ULL},
+  {11361262242960250625ULL, 2050133089467495346ULL},
+  {11712474920277544544ULL, 1281333180917184591ULL},
+  {10028907631919542777ULL, 1601666476146480739ULL},
+  {7924448521472040567ULL, 2002083095183100924ULL},
+  {14176152362774801162ULL, 1251301934489438077ULL},
+  {3885132398186337741ULL, 1564127418111797597ULL},
+  {9468101516160310080ULL, 1955159272639746996ULL},
+  {15140935484454969608ULL, 1221974545399841872ULL},
+  {479425281859160394ULL, 1527468181749802341ULL},
+  {5210967620751338397ULL, 1909335227187252926ULL},
+  {17091912818251750210ULL, 1193334516992033078ULL},
+  {12141518985959911954ULL, 1491668146240041348ULL},
+  {15176898732449889943ULL, 1864585182800051685ULL},
+  {11791404716994875166ULL, 1165365739250032303ULL},
+  {10127569877816206054ULL, 1456707174062540379ULL},
+  {8047776328842869663ULL, 1820883967578175474ULL},
+  {836348374198811271ULL, 2276104959472719343ULL},
+  {7440246761515338900ULL, 1422565599670449589ULL},
+  {13911994470321561530ULL, 1778206999588061986ULL},
+  {8166621051047176104ULL, 2222758749485077483ULL},
+  {2798295147690791113ULL, 1389224218428173427ULL},
+  {17332926989895652603ULL, 1736530273035216783ULL},
+  {17054472718942177850ULL, 2170662841294020979ULL},
+  {8353202440125167204ULL, 1356664275808763112ULL},
+  {10441503050156459005ULL, 1695830344760953890ULL},
+  {3828506775840797949ULL, 2119787930951192363ULL},
+  {86973725686804766ULL, 1324867456844495227ULL},
+  {13943775212390669669ULL, 1656084321055619033ULL},
+  {3594660960206173375ULL, 2070105401319523792ULL},
+  {2246663100128858359ULL, 1293815875824702370ULL},
+  {12031700912015848757ULL, 1617269844780877962ULL},
+  {5816254103165035138ULL, 2021587305976097453ULL},
+  {5941001823691840913ULL, 1263492066235060908ULL},
+  {7426252279614801142ULL, 1579365082793826135ULL},
+  {4671129331091113523ULL, 1974206353492282669ULL},
+  {5225298841145639904ULL, 1233878970932676668ULL},
+  {6531623551432049880ULL, 1542348713665845835ULL},
+  {3552843420862674446ULL, 1927935892082307294ULL},
+  {16055585193321335241ULL, 1204959932551442058ULL},
+  {10846109454796893243ULL, 1506199915689302573ULL},
+  {18169322836923504458ULL, 1882749894611628216ULL},
+  {11355826773077190286ULL, 1176718684132267635ULL},
+  {9583097447919099954ULL, 1470898355165334544ULL},
+  {11978871809898874942ULL, 1838622943956668180ULL},
+  {14973589762373593678ULL, 2298278679945835225ULL},
+  {2440964573842414192ULL, 1436424174966147016ULL},
+  {3051205717303017741ULL, 1795530218707683770ULL},
+  {13037379183483547984ULL, 2244412773384604712ULL},
+  {8148361989677217490ULL, 1402757983365377945ULL},
+  {14797138505523909766ULL, 1753447479206722431ULL},
+  {13884737113477499304ULL, 2191809349008403039ULL},
+  {15595489723564518921ULL, 1369880843130251899ULL},
+  {14882676136028260747ULL, 1712351053912814874ULL},
+  {9379973133180550126ULL, 2140438817391018593ULL},
+  {17391698254306313589ULL, 1337774260869386620ULL},
+  {3292878744173340370ULL, 1672217826086733276ULL},
+  {4116098430216675462ULL, 2090272282608416595ULL},
+  {266718509671728212ULL, 1306420176630260372ULL},
+  {333398137089660265ULL, 1633025220787825465ULL},
+  {5028433689789463235ULL, 2041281525984781831ULL},
+  {10060300083759496378ULL, 1275800953740488644ULL},
+  {12575375104699370472ULL, 1594751192175610805ULL},
+  {1884160825592049379ULL, 1993438990219513507ULL},
+  {17318501580490888525ULL, 1245899368887195941ULL},
+  {7813068920331446945ULL, 1557374211108994927ULL},
+  {5154650131986920777ULL, 1946717763886243659ULL},
+  {915813323278131534ULL, 1216698602428902287ULL},
+  {14979824709379828129ULL, 1520873253036127858ULL},
+  {9501408849870009354ULL, 1901091566295159823ULL},
+  {12855909558809837702ULL, 1188182228934474889ULL},
+  {2234828893230133415ULL, 1485227786168093612ULL},
+  {2793536116537666769ULL, 1856534732710117015ULL},
+  {8663489100477123587ULL, 1160334207943823134ULL},
+  {1605989338741628675ULL, 1450417759929778918ULL},
+  {11230858710281811652ULL, 1813022199912223647ULL},
+  {9426887369424876662ULL, 2266277749890279559ULL},
+  {12809333633531629769ULL, 1416423593681424724ULL},
+  {16011667041914537212ULL, 1770529492101780905ULL},
+  {6179525747111007803ULL, 2213161865127226132ULL},
+  {13085575628799155685ULL, 1383226165704516332ULL},
+  {16356969535998944606ULL, 1729032707130645415ULL},
+  {15834525901571292854ULL, 2161290883913306769ULL},
+  {2979049660840976177ULL, 1350806802445816731ULL},
+  {17558870131333383934ULL, 1688508503057270913ULL},
+  {8113529608884566205ULL, 2110635628821588642ULL},
+  {9682642023980241782ULL, 1319147268013492901ULL},
+  {16714988548402690132ULL, 1648934085016866126ULL},
+  {11670363648648586857ULL, 2061167606271082658ULL},
+  {11905663298832754689ULL, 1288229753919426661ULL},
+  {1047021068258779650ULL, 1610287192399283327ULL},
+  {15143834390605638274ULL, 2012858990499104158ULL},
+  {4853210475701136017ULL, 1258036869061940099ULL},
+  {1454827076199032118ULL, 1572546086327425124ULL},
+  {1818533845248790147ULL, 1965682607909281405ULL},
+  {3442426662494187794ULL, 1228551629943300878ULL},
+  {13526405364972510550ULL, 1535689537429126097ULL},
+  {3072948650933474476ULL, 1919611921786407622ULL},
+  {15755650962115585259ULL, 1199757451116504763ULL},
+  {15082877684217093670ULL, 1499696813895630954ULL},
+  {9630225068416591280ULL, 1874621017369538693ULL},
+  {8324733676974063502ULL, 1171638135855961683ULL},
+  {5794231077790191473ULL, 1464547669819952104ULL},
+  {7242788847237739342ULL, 1830684587274940130ULL},
+  {18276858095901949986ULL, 2288355734093675162ULL},
+  {16034722328366106645ULL, 1430222333808546976ULL},
+  {1596658836748081690ULL, 1787777917260683721ULL},
+  {6607509564362490017ULL, 2234722396575854651ULL},
+  {1823850468512862308ULL, 1396701497859909157ULL},
+  {6891499104068465790ULL, 1745876872324886446ULL},
+  {17837745916940358045ULL, 2182346090406108057ULL},
+  {4231062170446641922ULL, 1363966306503817536ULL},
+  {5288827713058302403ULL, 1704957883129771920ULL},
+  {6611034641322878003ULL, 2131197353912214900ULL},
+  {13355268687681574560ULL, 1331998346195134312ULL},
+  {16694085859601968200ULL, 1664997932743917890ULL},
+  {11644235287647684442ULL, 2081247415929897363ULL},
+  {4971804045566108824ULL, 1300779634956185852ULL},
+  {6214755056957636030ULL, 1625974543695232315ULL},
+  {3156757802769657134ULL, 2032468179619040394ULL},
+  {6584659645158423613ULL, 1270292612261900246ULL},
+  {17454196593302805324ULL, 1587865765327375307ULL},
+  {17206059723201118751ULL, 1984832206659219134ULL},
+  {6142101308573311315ULL, 1240520129162011959ULL},
+  {3065940617289251240ULL, 1550650161452514949ULL},
+  {8444111790038951954ULL, 1938312701815643686ULL},
+  {665883850346957067ULL, 1211445438634777304ULL},
+  {832354812933696334ULL, 1514306798293471630ULL},
+  {10263815553021896226ULL, 1892883497866839537ULL},
+  {17944099766707154901ULL, 1183052186166774710ULL},
+  {13206752671529167818ULL, 1478815232708468388ULL},
+  {16508440839411459773ULL, 1848519040885585485ULL},
+  {12623618533845856310ULL, 1155324400553490928ULL},
+  {15779523167307320387ULL, 1444155500691863660ULL},
+  {1277659885424598868ULL, 1805194375864829576ULL},
+  {1597074856780748586ULL, 2256492969831036970ULL},
+  {5609857803915355770ULL, 1410308106144398106ULL},
+  {16235694291748970521ULL, 1762885132680497632ULL},
+  {1847873790976661535ULL, 2203606415850622041ULL},
+  {12684136165428883219ULL, 1377254009906638775ULL},
+  {11243484188358716120ULL, 1721567512383298469ULL},
+  {219297180166231438ULL, 2151959390479123087ULL},
+  {7054589765244976505ULL, 1344974619049451929ULL},
+  {13429923224983608535ULL, 1681218273811814911ULL},
+  {12175718012802122765ULL, 2101522842264768639ULL},
+  {14527352785642408584ULL, 1313451776415480399ULL},
+  {13547504963625622826ULL, 1641814720519350499ULL},
+  {12322695186104640628ULL, 2052268400649188124ULL},
+  {16925056528170176201ULL, 1282667750405742577ULL},
+  {7321262604930556539ULL, 1603334688007178222ULL},
+  {18374950293017971482ULL, 2004168360008972777ULL},
+  {4566814905495150320ULL, 1252605225005607986ULL},
+  {14931890668723713708ULL, 1565756531257009982ULL},
+  {9441491299049866327ULL, 1957195664071262478ULL},
+  {1289246043478778550ULL, 1223247290044539049ULL},
+  {6223243572775861092ULL, 1529059112555673811ULL},
+  {3167368447542438461ULL, 1911323890694592264ULL},
+  {1979605279714024038ULL, 1194577431684120165ULL},
+  {7086192618069917952ULL, 1493221789605150206ULL},
+  {18081112809442173248ULL, 1866527237006437757ULL},
+  {13606538515115052232ULL, 1166579523129023598ULL},
+  {7784801107039039482ULL, 1458224403911279498ULL},
+  {507629346944023544ULL, 1822780504889099373ULL},
+  {5246222702107417334ULL, 2278475631111374216ULL},
+  {3278889188817135834ULL, 1424047269444608885ULL},
+  {8710297504448807696ULL, 1780059086805761106ULL},
+};
+
+
+
+
+struct NumericFormatterDecimal {
+
+
+
+
+  uint64_t mantissa;
+
+
+
+
+  int32_t exponent;
+};
+
+
+
+
+static inline int32_t numeric_formatter_pow5_bits(const int32_t e) {
+  return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+
+
+
+static inline uint32_t numeric_formatter_log10_pow2(const int32_t e) {
+  return ((uint32_t)e * 78913) >> 18;
+}
+
+
+
+
+static inline uint32_t numeric_formatter_log10_pow5(const int32_t e) {
+  return ((uint32_t)e * 732923) >> 20;
+}
+
+
+
+
+static inline int numeric_formatter_multiple_of_pow5(uint64_t value, const uint32_t p) {
+  uint32_t count = 0;
+  while (value % 5 == 0) {
+    value /= 5;
+    count++;
+  }
+  return count >= p;
+}
+
+
+
+
+static inline int numeric_formatter_multiple_of_pow2(const uint64_t value, const uint32_t p) {
+  return (value & ((1ULL << p) - 1)) == 0;
+}
+
+
+
+
+static inline uint64_t numeric_formatter_mul_shift(const uint64_t m, const uint64_t *mul, const int32_t j) {
+
+  __extension__ typedef unsigned __int128 uint128;
+  const uint128 b0 = (uint128)m * mul[0];
+  const uint128 b2 = (uint128)m * mul[1];
+  return (uint64_t)(((b0 >> 64) + b2) >> (j - 64));
+# 803 "/root/repo/src/numeric_formatter.c"
+}
+# 816 "/root/repo/src/numeric_formatter.c"
+static struct NumericFormatterDecimal numeric_formatter_shortest(const uint64_t ieee_mantissa, const uint32_t ieee_exponent) {
+  int32_t e2;
+  uint64_t m2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - 1023 - 52 - 2;
+    m2 = ieee_mantissa;
+  }
+  else {
+    e2 = (int32_t)ieee_exponent - 1023 - 52 - 2;
+    m2 = (1ULL << 52) | ieee_mantissa;
+  }
+  const int accept_bounds = (m2 & 1) == 0;
+
+  const uint64_t mv = 4 * m2;
+  const uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+
+  uint64_t vr, vp, vm;
+  int32_t e10;
+  int vm_is_trailing_zeros = 0;
+  int vr_is_trailing_zeros = 0;
+  if (e2 >= 0) {
+    const uint32_t q = numeric_formatter_log10_pow2(e2) - (e2 > 3);
+    e10 = (int32_t)q;
+    const int32_t k = 125 + numeric_formatter_pow5_bits((int32_t)q) - 1;
+    const int32_t i = -e2 + (int32_t)q + k;
+    vr = numeric_formatter_mul_shift(4 * m2, numeric_formatter_pow5_inv_split[q], i);
+    vp = numeric_formatter_mul_shift(4 * m2 + 2, numeric_formatter_pow5_inv_split[q], i);
+    vm = numeric_formatter_mul_shift(4 * m2 - 1 - mm_shift, numeric_formatter_pow5_inv_split[q], i);
+    if (q <= 21) {
+
+      if (mv % 5 == 0) {
+        vr_is_trailing_zeros = numeric_formatter_multiple_of_pow5(mv, q);
+      }
+      else if (accept_bounds) {
+        vm_is_trailing_zeros = numeric_formatter_multiple_of_pow5(mv - 1 - mm_shift, q);
+      }
+      else {
+        vp -= numeric_formatter_multiple_of_pow5(mv + 2, q);
+      }
+    }
+  }
+  else {
+    const uint32_t q = numeric_formatter_log10_pow5(-e2) - (-e2 > 1);
+    e10 = (int32_t)q + e2;
+    const int32_t i = -e2 - (int32_t)q;
+    const int32_t k = numeric_formatter_pow5_bits(i) - 125;
+    const int32_t j = (int32_t)q - k;
+    vr = numeric_formatter_mul_shift(4 * m2, numeric_formatter_pow5_split[i], j);
+    vp = numeric_formatter_mul_shift(4 * m2 + 2, numeric_formatter_pow5_split[i], j);
+    vm = numeric_formatter_mul_shift(4 * m2 - 1 - mm_shift, numeric_formatter_pow5_split[i], j);
+    if (q <= 1) {
+
+      vr_is_trailing_zeros = 1;
+      if (accept_bounds) {
+        vm_is_trailing_zeros = mm_shift == 1;
+      }
+      else {
+        --vp;
+      }
+    }
+    else if (q < 63) {
+      vr_is_trailing_zeros = numeric_formatter_multiple_of_pow2(mv, q);
+    }
+  }
+
+  int32_t removed = 0;
+  uint8_t last_removed_digit = 0;
+  uint64_t output;
+  if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+
+    while (vp / 10 > vm / 10) {
+      vm_is_trailing_zeros &= vm % 10 == 0;
+      vr_is_trailing_zeros &= last_removed_digit == 0;
+      last_removed_digit = (uint8_t)(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    if (vm_is_trailing_zeros) {
+      while (vm % 10 == 0) {
+        vr_is_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = (uint8_t)(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++removed;
+      }
+    }
+    if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+
+      last_removed_digit = 4;
+    }
+
+    output = vr + ((vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) || last_removed_digit >= 5);
+  }
+  else {
+
+    int round_up = 0;
+    if (vp / 100 > vm / 100) {
+      round_up = vr % 100 >= 50;
+      vr /= 100;
+      vp /= 100;
+      vm /= 100;
+      removed += 2;
+    }
+    while (vp / 10 > vm / 10) {
+      round_up = vr % 10 >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    output = vr + (vr == vm || round_up);
+  }
+  struct NumericFormatterDecimal decimal = {output, e10 + removed};
+  return decimal;
+}
+# 955 "/root/repo/src/numeric_formatter.c"
+static size_t numeric_formatter_write(char *buffer, int negative, const char *digits, size_t count, int32_t point) {
+  char *p = buffer;
+  if (negative) {
+    *p++ = '-';
+  }
+  if (point > 0 && point <= 21) {
+
+    if ((size_t)point >= count) {
+      memcpy(p, digits, count);
+      memset(p + count, '0', point - count);
+      p += point;
+    }
+    else {
+      memcpy(p, digits, point);
+      p[point] = '.';
+      memcpy(p + point + 1, digits + point, count - point);
+      p += count + 1;
+    }
+  }
+  else if (point <= 0 && point > -5) {
+
+    *p++ = '0';
+    *p++ = '.';
+    memset(p, '0', -point);
+    p += -point;
+    memcpy(p, digits, count);
+    p += count;
+  }
+  else {
+
+    *p++ = digits[0];
+    if (count > 1) {
+      *p++ = '.';
+      memcpy(p, digits + 1, count - 1);
+      p += count - 1;
+    }
+    int32_t exponent = point - 1;
+    *p++ = 'e';
+    *p++ = exponent < 0 ? '-' : '+';
+    p += u64tos_to(p, (uint64_t)(exponent < 0 ? -exponent : exponent));
+  }
+  *p = '\0';
+  return (size_t)(p - buffer);
+}
+
+
+
+
+
+
+
+static size_t numeric_formatter_write_special(char *buffer, const uint64_t bits) {
+  const uint64_t ieee_mantissa = bits & ((1ULL << 52) - 1);
+  const uint32_t ieee_exponent = (uint32_t)((bits >> 52) & ((1U << 11) - 1));
+  const int negative = (int)(bits >> 63);
+  const char *special = 
+# 1010 "/root/repo/src/numeric_formatter.c" 3 4
+                       ((void *)0)
+# 1010 "/root/repo/src/numeric_formatter.c"
+                           ;
+  if (ieee_exponent == ((1U << 11) - 1)) {
+    special = ieee_mantissa != 0 ? "nan" : (negative ? "-inf" : "inf");
+  }
+  else if (ieee_exponent == 0 && ieee_mantissa == 0) {
+    special = negative ? "-0" : "0";
+  }
+  if (special == 
+# 1017 "/root/repo/src/numeric_formatter.c" 3 4
+                ((void *)0)
+# 1017 "/root/repo/src/numeric_formatter.c"
+                    ) {
+    return 0;
+  }
+  strcpy(buffer, special);
+  return strlen(special);
+}
+
+
+
+
+size_t dtos_to(char *buffer, const double value) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(double));
+  size_t length = numeric_formatter_write_special(buffer, bits);
+  if (length != 0) {
+    return length;
+  }
+  const uint64_t ieee_mantissa = bits & ((1ULL << 52) - 1);
+  const uint32_t ieee_exponent = (uint32_t)((bits >> 52) & ((1U << 11) - 1));
+  struct NumericFormatterDecimal decimal = numeric_formatter_shortest(ieee_mantissa, ieee_exponent);
+
+  while (decimal.mantissa % 10 == 0) {
+    decimal.mantissa /= 10;
+    decimal.exponent++;
+  }
+  char digits[20];
+  size_t count = u64tos_to(digits, decimal.mantissa);
+  return numeric_formatter_write(buffer, (int)(bits >> 63), digits, count, (int32_t)count + decimal.exponent);
+}
+
+
+
+
+
+
+
+static size_t numeric_formatter_libc_digits(const double value, const int precision, char *digits, int32_t *point) {
+  char string[32 + 17];
+  snprintf(string, sizeof(string), "%.*e", precision - 1, value < 0 ? -value : value);
+
+  size_t count = 0;
+  const char *p = string;
+  for (; *p != 'e'; p++) {
+    if (*p >= '0' && *p <= '9') {
+      digits[count++] = *p;
+    }
+  }
+  *point = (int32_t)strtol(p + 1, 
+# 1064 "/root/repo/src/numeric_formatter.c" 3 4
+                                 ((void *)0)
+# 1064 "/root/repo/src/numeric_formatter.c"
+                                     , 10) + 1;
+  while (count > 1 && digits[count - 1] == '0') {
+    count--;
+  }
+  return count;
+}
+
+
+
+
+size_t dtos_precision_to(char *buffer, const double value, int precision) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(double));
+  size_t length = numeric_formatter_write_special(buffer, bits);
+  if (length != 0) {
+    return length;
+  }
+  if (precision < 1) {
+    precision = 1;
+  }
+  if (precision > 17) {
+    precision = 17;
+  }
+  const uint64_t ieee_mantissa = bits & ((1ULL << 52) - 1);
+  const uint32_t ieee_exponent = (uint32_t)((bits >> 52) & ((1U << 11) - 1));
+  struct NumericFormatterDecimal decimal = numeric_formatter_shortest(ieee_mantissa, ieee_exponent);
+  char digits[17 + 20];
+  size_t count = u64tos_to(digits, decimal.mantissa);
+  int32_t point = (int32_t)count + decimal.exponent;
+  if (count > (size_t)precision) {
+
+
+    size_t tail = precision + 1;
+    while (tail < count && digits[tail] == '0') {
+      tail++;
+    }
+    if (digits[precision] == '5' && tail == count) {
+      count = numeric_formatter_libc_digits(value, precision, digits, &point);
+    }
+    else {
+      int round_up = digits[precision] >= '5';
+      count = precision;
+      for (size_t i = count; round_up && i > 0; i--) {
+        round_up = digits[i - 1] == '9';
+        digits[i - 1] = round_up ? '0' : digits[i - 1] + 1;
+      }
+      if (round_up) {
+
+        digits[0] = '1';
+        point++;
+      }
+    }
+  }
+  else if (precision > 15 || ieee_exponent == 0) {
+
+
+    count = numeric_formatter_libc_digits(value, precision, digits, &point);
+  }
+  while (count > 1 && digits[count - 1] == '0') {
+    count--;
+  }
+  return numeric_formatter_write(buffer, (int)(bits >> 63), digits, count, point);
+}
+
+
+
+
+static const uint64_t numeric_formatter_fixed_powers[] = {
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+  1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+  100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+  1000000000000000000ULL, 10000000000000000000ULL,
+};
+# 1147 "/root/repo/src/numeric_formatter.c"
+static int numeric_formatter_fixed_scale(const uint64_t m, const int32_t e, const int precision, uint64_t *scaled) {
+  uint64_t power = numeric_formatter_fixed_powers[precision];
+  if (e >= 0) {
+
+    if (e > 63 - 53 || (m << e) > 
+# 1151 "/root/repo/src/numeric_formatter.c" 3 4
+                                 (18446744073709551615UL) 
+# 1151 "/root/repo/src/numeric_formatter.c"
+                                            / power) {
+      return 0;
+    }
+    *scaled = (m << e) * power;
+    return 1;
+  }
+
+  __extension__ typedef unsigned __int128 uint128;
+  const uint128 product = (uint128)m * power;
+  const int32_t shift = -e;
+  if (shift >= 128) {
+
+    *scaled = 0;
+    return 1;
+  }
+  const uint128 quotient = product >> shift;
+  if ((quotient >> 64) != 0 || (uint64_t)quotient == 
+# 1167 "/root/repo/src/numeric_formatter.c" 3 4
+                                                    (18446744073709551615UL)
+# 1167 "/root/repo/src/numeric_formatter.c"
+                                                              ) {
+    return 0;
+  }
+  const uint128 remainder = product - (quotient << shift);
+  const uint128 half = (uint128)1 << (shift - 1);
+  *scaled = (uint64_t)quotient + (remainder > half || (remainder == half && (quotient & 1)));
+  return 1;
+
+
+
+}
+
+
+
+
+size_t dtos_fixed_to(char *buffer, const double value, int precision) {
+  if (precision < 0) {
+    precision = 0;
+  }
+  if (precision > 20) {
+    precision = 20;
+  }
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(double));
+  const uint64_t ieee_mantissa = bits & ((1ULL << 52) - 1);
+  const uint32_t ieee_exponent = (uint32_t)((bits >> 52) & ((1U << 11) - 1));
+  if (ieee_exponent == ((1U << 11) - 1)) {
+    return numeric_formatter_write_special(buffer, bits);
+  }
+
+  uint64_t m = ieee_exponent == 0 ? ieee_mantissa : ieee_mantissa | (1ULL << 52);
+  int32_t e = (ieee_exponent == 0 ? 1 : (int32_t)ieee_exponent) - 1023 - 52;
+  uint64_t scaled;
+  if (precision >= (int)(sizeof(numeric_formatter_fixed_powers) / sizeof(uint64_t)) || numeric_formatter_fixed_scale(m, e, precision, &scaled) == 0) {
+
+    int length = snprintf(buffer, (1 + 309 + 1 + 20 + 1), "%.*f", precision, value);
+    char *separator = precision > 0 ? buffer + length - precision - 1 : 
+# 1203 "/root/repo/src/numeric_formatter.c" 3 4
+                                                                       ((void *)0)
+# 1203 "/root/repo/src/numeric_formatter.c"
+                                                                           ;
+    if (separator != 
+# 1204 "/root/repo/src/numeric_formatter.c" 3 4
+                    ((void *)0)
+# 1204 "/root/repo/src/numeric_formatter.c"
+                        ) {
+
+      *separator = '.';
+    }
+    return (size_t)length;
+  }
+
+  size_t length = 0;
+  if (bits >> 63) {
+    buffer[length++] = '-';
+  }
+  uint64_t power = numeric_formatter_fixed_powers[precision];
+  length += u64tos_to(buffer + length, scaled / power);
+  if (precision > 0) {
+    uint64_t fraction = scaled % power;
+    buffer[length] = '.';
+    for (int i = precision; i > 0; i--) {
+      buffer[length + i] = (char)('0' + fraction % 10);
+      fraction /= 10;
+    }
+    length += precision + 1;
+  }
+  buffer[length] = '\0';
+  return length;
+}
+
+
+
+
+size_t dtos_batch(char *buffer, const double *values, const size_t count, size_t *offsets) {
+  size_t length = 0;
+  buffer[0] = '\0';
+  for (size_t i = 0; i < count; i++) {
+    if (offsets != 
+# 1237 "/root/repo/src/numeric_formatter.c" 3 4
+                  ((void *)0)
+# 1237 "/root/repo/src/numeric_formatter.c"
+                      ) {
+      offsets[i] = length;
+    }
+
+    length += dtos_to(buffer + length, values[i]);
+  }
+  if (offsets != 
+# 1243 "/root/repo/src/numeric_formatter.c" 3 4
+                ((void *)0)
+# 1243 "/root/repo/src/numeric_formatter.c"
+                    ) {
+    offsets[count] = length;
+  }
+  return length;
+}
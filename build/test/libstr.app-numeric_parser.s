@@ -0,0 +1,13012 @@
+	.file	"numeric_parser.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/src/numeric_parser.c"
+	.p2align 4
+	.type	numeric_parser_bigint_mul_pow5, @function
+numeric_parser_bigint_mul_pow5:
+.LVL0:
+.LFB35:
+	.file 1 "/root/repo/src/numeric_parser.c"
+	.loc 1 942 97 view -0
+	.cfi_startproc
+	.loc 1 942 97 is_stmt 0 view .LVU1
+	movq	%rdi, %r8
+	.loc 1 944 3 is_stmt 1 view .LVU2
+	.loc 1 944 19 view .LVU3
+.LBB56:
+.LBB57:
+.LBB58:
+	.loc 1 900 32 is_stmt 0 view .LVU4
+	movq	512(%r8), %r9
+.LBE58:
+.LBE57:
+.LBE56:
+	.loc 1 942 97 view .LVU5
+	movq	%rsi, %rdi
+.LVL1:
+	.loc 1 944 19 view .LVU6
+	cmpq	$12, %rsi
+	jle	.L3
+.LVL2:
+.LBB64:
+.LBB65:
+.LBB66:
+	.loc 1 900 24 is_stmt 1 view .LVU7
+	testq	%r9, %r9
+	je	.L54
+.LVL3:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 900 24 is_stmt 0 view .LVU8
+	movq	%r8, %rdx
+	leaq	(%r8,%r9,4), %rsi
+.LBE66:
+	.loc 1 899 12 view .LVU9
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L4:
+.LVL4:
+.LBB69:
+.LBB67:
+	.loc 1 901 5 is_stmt 1 view .LVU10
+	.loc 1 901 24 is_stmt 0 view .LVU11
+	movl	(%rdx), %ecx
+.LBE67:
+	.loc 1 900 24 view .LVU12
+	addq	$4, %rdx
+.LBB68:
+	.loc 1 901 51 view .LVU13
+	imulq	$1220703125, %rcx, %rcx
+	.loc 1 901 14 view .LVU14
+	addq	%rcx, %rax
+.LVL5:
+	.loc 1 902 5 is_stmt 1 view .LVU15
+	.loc 1 902 24 is_stmt 0 view .LVU16
+	movl	%eax, -4(%rdx)
+	.loc 1 903 5 is_stmt 1 view .LVU17
+	.loc 1 903 11 is_stmt 0 view .LVU18
+	shrq	$32, %rax
+.LVL6:
+	.loc 1 903 11 view .LVU19
+.LBE68:
+	.loc 1 900 41 is_stmt 1 view .LVU20
+	.loc 1 900 24 view .LVU21
+	cmpq	%rsi, %rdx
+	jne	.L4
+.LBE69:
+	.loc 1 905 3 view .LVU22
+	.loc 1 905 6 is_stmt 0 view .LVU23
+	testq	%rax, %rax
+	je	.L5
+	.loc 1 906 5 is_stmt 1 view .LVU24
+	.loc 1 906 8 is_stmt 0 view .LVU25
+	cmpq	$128, %r9
+	je	.L22
+	.loc 1 909 5 is_stmt 1 view .LVU26
+	.loc 1 909 31 is_stmt 0 view .LVU27
+	leaq	1(%r9), %rdx
+	movq	%rdx, 512(%r8)
+	.loc 1 909 37 view .LVU28
+	movl	%eax, (%r8,%r9,4)
+	.loc 1 909 31 view .LVU29
+	movq	%rdx, %r9
+.L5:
+.LVL7:
+	.loc 1 909 31 view .LVU30
+.LBE65:
+.LBE64:
+	.loc 1 948 5 is_stmt 1 view .LVU31
+	.loc 1 948 14 is_stmt 0 view .LVU32
+	subq	$13, %rdi
+.LVL8:
+	.loc 1 944 19 is_stmt 1 view .LVU33
+	cmpq	$12, %rdi
+	jg	.L8
+.L3:
+.LVL9:
+	.loc 1 951 21 view .LVU34
+	.loc 1 951 18 is_stmt 0 view .LVU35
+	leaq	-1(%rdi), %rax
+.LVL10:
+	.loc 1 951 21 view .LVU36
+	testq	%rdi, %rdi
+	jle	.L25
+.L9:
+	.loc 1 952 5 is_stmt 1 view .LVU37
+.LVL11:
+	.loc 1 951 21 view .LVU38
+	.loc 1 951 21 is_stmt 0 view .LVU39
+	testq	%rax, %rax
+	je	.L26
+	.loc 1 952 5 is_stmt 1 view .LVU40
+.LVL12:
+	.loc 1 951 21 view .LVU41
+	.loc 1 951 21 is_stmt 0 view .LVU42
+	cmpq	$2, %rdi
+	jle	.L27
+	.loc 1 952 5 is_stmt 1 view .LVU43
+.LVL13:
+	.loc 1 951 21 view .LVU44
+	.loc 1 951 21 is_stmt 0 view .LVU45
+	cmpq	$3, %rdi
+	je	.L28
+	.loc 1 952 5 is_stmt 1 view .LVU46
+.LVL14:
+	.loc 1 951 21 view .LVU47
+	.loc 1 951 21 is_stmt 0 view .LVU48
+	cmpq	$4, %rdi
+	je	.L29
+	.loc 1 952 5 is_stmt 1 view .LVU49
+.LVL15:
+	.loc 1 951 21 view .LVU50
+	.loc 1 951 21 is_stmt 0 view .LVU51
+	cmpq	$5, %rdi
+	je	.L30
+	.loc 1 952 5 is_stmt 1 view .LVU52
+.LVL16:
+	.loc 1 951 21 view .LVU53
+	.loc 1 951 21 is_stmt 0 view .LVU54
+	cmpq	$6, %rdi
+	je	.L31
+	.loc 1 952 5 is_stmt 1 view .LVU55
+.LVL17:
+	.loc 1 951 21 view .LVU56
+	.loc 1 951 21 is_stmt 0 view .LVU57
+	cmpq	$7, %rdi
+	je	.L32
+	.loc 1 952 5 is_stmt 1 view .LVU58
+.LVL18:
+	.loc 1 951 21 view .LVU59
+	.loc 1 951 21 is_stmt 0 view .LVU60
+	cmpq	$8, %rdi
+	je	.L33
+	.loc 1 952 5 is_stmt 1 view .LVU61
+.LVL19:
+	.loc 1 951 21 view .LVU62
+	.loc 1 951 21 is_stmt 0 view .LVU63
+	cmpq	$9, %rdi
+	je	.L34
+	.loc 1 952 5 is_stmt 1 view .LVU64
+.LVL20:
+	.loc 1 951 21 view .LVU65
+	.loc 1 951 21 is_stmt 0 view .LVU66
+	cmpq	$10, %rdi
+	je	.L35
+	.loc 1 952 5 is_stmt 1 view .LVU67
+.LVL21:
+	.loc 1 951 21 view .LVU68
+	.loc 1 952 12 is_stmt 0 view .LVU69
+	cmpq	$11, %rdi
+	movl	$48828125, %esi
+	movl	$244140625, %eax
+	cmovne	%rax, %rsi
+.LVL22:
+.L18:
+.LBB76:
+.LBB63:
+.LBB61:
+	.loc 1 900 24 is_stmt 1 view .LVU70
+	testq	%r9, %r9
+	je	.L23
+	movq	%r8, %rdx
+	leaq	(%r8,%r9,4), %rdi
+.LBE61:
+	.loc 1 899 12 is_stmt 0 view .LVU71
+	xorl	%eax, %eax
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L21:
+.LBB62:
+.LBB59:
+	.loc 1 901 5 is_stmt 1 view .LVU72
+	.loc 1 901 24 is_stmt 0 view .LVU73
+	movl	(%rdx), %ecx
+.LBE59:
+	.loc 1 900 24 view .LVU74
+	addq	$4, %rdx
+.LBB60:
+	.loc 1 901 51 view .LVU75
+	imulq	%rsi, %rcx
+	.loc 1 901 14 view .LVU76
+	addq	%rcx, %rax
+.LVL24:
+	.loc 1 902 5 is_stmt 1 view .LVU77
+	.loc 1 902 24 is_stmt 0 view .LVU78
+	movl	%eax, -4(%rdx)
+	.loc 1 903 5 is_stmt 1 view .LVU79
+	.loc 1 903 11 is_stmt 0 view .LVU80
+	shrq	$32, %rax
+.LVL25:
+	.loc 1 903 11 view .LVU81
+.LBE60:
+	.loc 1 900 41 is_stmt 1 view .LVU82
+	.loc 1 900 24 view .LVU83
+	cmpq	%rdi, %rdx
+	jne	.L21
+.LBE62:
+	.loc 1 905 3 view .LVU84
+	.loc 1 905 6 is_stmt 0 view .LVU85
+	testq	%rax, %rax
+	je	.L23
+	.loc 1 906 5 is_stmt 1 view .LVU86
+	.loc 1 906 8 is_stmt 0 view .LVU87
+	cmpq	$128, %r9
+	je	.L22
+	.loc 1 909 5 is_stmt 1 view .LVU88
+	.loc 1 909 31 is_stmt 0 view .LVU89
+	leaq	1(%r9), %rdx
+	movq	%rdx, 512(%r8)
+	.loc 1 909 37 view .LVU90
+	movl	%eax, (%r8,%r9,4)
+.LVL26:
+.L23:
+	.loc 1 911 10 view .LVU91
+	movl	$1, %eax
+.LBE63:
+.LBE76:
+	.loc 1 955 1 view .LVU92
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.loc 1 946 14 view .LVU93
+	xorl	%eax, %eax
+	ret
+.LVL27:
+.L54:
+	.loc 1 948 5 is_stmt 1 view .LVU94
+	.loc 1 948 14 is_stmt 0 view .LVU95
+	leaq	-13(%rsi), %rcx
+.LVL28:
+	.loc 1 944 19 is_stmt 1 view .LVU96
+	cmpq	$12, %rcx
+	jle	.L55
+	leaq	-26(%rdi), %rdx
+	movabsq	$5675921253449092805, %rax
+	mulq	%rdx
+	shrq	$2, %rdx
+	incq	%rdx
+	cmpq	$51, %rcx
+	jle	.L11
+	vpbroadcastq	%rdi, %ymm0
+	movq	%rdx, %r10
+	movq	$-52, %rsi
+	vpaddq	.LC0(%rip), %ymm0, %ymm0
+	shrq	$2, %r10
+	xorl	%eax, %eax
+	vpbroadcastq	%rsi, %ymm2
+.LVL29:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 944 19 is_stmt 0 view .LVU97
+	incq	%rax
+	vmovdqa	%ymm0, %ymm1
+	vpaddq	%ymm2, %ymm0, %ymm0
+.LVL30:
+.LBB77:
+.LBB73:
+.LBB70:
+	.loc 1 900 24 is_stmt 1 view .LVU98
+	.loc 1 900 24 is_stmt 0 view .LVU99
+.LBE70:
+.LBE73:
+.LBE77:
+	.loc 1 948 5 is_stmt 1 view .LVU100
+	.loc 1 944 19 view .LVU101
+	cmpq	%rax, %r10
+	jne	.L12
+	testb	$3, %dl
+	je	.L14
+	movq	%rdx, %rax
+	andq	$-4, %rax
+	imulq	$-13, %rax, %rax
+	addq	%rax, %rcx
+	vzeroupper
+.LVL31:
+.L11:
+.LBB78:
+.LBB74:
+.LBB71:
+	.loc 1 900 24 view .LVU102
+	.loc 1 900 24 is_stmt 0 view .LVU103
+.LBE71:
+.LBE74:
+.LBE78:
+	.loc 1 948 5 is_stmt 1 view .LVU104
+	.loc 1 948 14 is_stmt 0 view .LVU105
+	leaq	-13(%rcx), %rdi
+.LVL32:
+	.loc 1 944 19 is_stmt 1 view .LVU106
+	cmpq	$12, %rdi
+	jle	.L15
+.LVL33:
+.LBB79:
+.LBB75:
+.LBB72:
+	.loc 1 900 24 view .LVU107
+	.loc 1 900 24 is_stmt 0 view .LVU108
+.LBE72:
+.LBE75:
+.LBE79:
+	.loc 1 948 5 is_stmt 1 view .LVU109
+	.loc 1 948 14 is_stmt 0 view .LVU110
+	leaq	-26(%rcx), %rdi
+.LVL34:
+	.loc 1 944 19 is_stmt 1 view .LVU111
+	.loc 1 948 14 is_stmt 0 view .LVU112
+	subq	$39, %rcx
+	cmpq	$12, %rdi
+	cmovg	%rcx, %rdi
+.LVL35:
+.L15:
+	.loc 1 951 21 is_stmt 1 view .LVU113
+	.loc 1 951 18 is_stmt 0 view .LVU114
+	leaq	-1(%rdi), %rax
+.LVL36:
+	.loc 1 951 21 view .LVU115
+	testq	%rdi, %rdi
+	jg	.L9
+	jmp	.L23
+.LVL37:
+.L29:
+	.loc 1 952 12 view .LVU116
+	movl	$625, %esi
+	jmp	.L18
+.LVL38:
+.L25:
+	.loc 1 950 12 view .LVU117
+	movl	$1, %esi
+	jmp	.L18
+.LVL39:
+.L26:
+	.loc 1 952 12 view .LVU118
+	movl	$5, %esi
+	jmp	.L18
+.LVL40:
+.L27:
+	.loc 1 952 12 view .LVU119
+	movl	$25, %esi
+	jmp	.L18
+.LVL41:
+.L55:
+	.loc 1 951 21 is_stmt 1 view .LVU120
+	.loc 1 951 18 is_stmt 0 view .LVU121
+	leaq	-14(%rdi), %rax
+.LVL42:
+	.loc 1 948 14 view .LVU122
+	movq	%rcx, %rdi
+	.loc 1 951 21 view .LVU123
+	testq	%rcx, %rcx
+	jne	.L9
+	jmp	.L23
+.LVL43:
+.L28:
+	.loc 1 952 12 view .LVU124
+	movl	$125, %esi
+	jmp	.L18
+.LVL44:
+.L14:
+	.loc 1 948 14 view .LVU125
+	movq	$-13, %rax
+	vpbroadcastq	%rax, %ymm0
+	vpaddq	%ymm0, %ymm1, %ymm1
+	valignq	$3, %ymm1, %ymm1, %ymm3
+	vmovq	%xmm3, %rdi
+	vzeroupper
+.LVL45:
+	jmp	.L15
+.LVL46:
+.L30:
+	.loc 1 952 12 view .LVU126
+	movl	$3125, %esi
+	jmp	.L18
+.LVL47:
+.L31:
+	.loc 1 952 12 view .LVU127
+	movl	$15625, %esi
+	jmp	.L18
+.LVL48:
+.L33:
+	.loc 1 952 12 view .LVU128
+	movl	$390625, %esi
+	jmp	.L18
+.LVL49:
+.L32:
+	.loc 1 952 12 view .LVU129
+	movl	$78125, %esi
+	jmp	.L18
+.LVL50:
+.L35:
+	.loc 1 952 12 view .LVU130
+	movl	$9765625, %esi
+	jmp	.L18
+.LVL51:
+.L34:
+	.loc 1 952 12 view .LVU131
+	movl	$1953125, %esi
+	jmp	.L18
+	.cfi_endproc
+.LFE35:
+	.size	numeric_parser_bigint_mul_pow5, .-numeric_parser_bigint_mul_pow5
+	.p2align 4
+	.type	numeric_parser_bigint_shl, @function
+numeric_parser_bigint_shl:
+.LVL52:
+.LFB36:
+	.loc 1 963 89 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 964 3 view .LVU133
+	.loc 1 963 89 is_stmt 0 view .LVU134
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 964 33 view .LVU135
+	testq	%rsi, %rsi
+	.loc 1 963 89 view .LVU136
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 964 33 view .LVU137
+	leaq	31(%rsi), %rbx
+	cmovns	%rsi, %rbx
+	.loc 1 966 13 view .LVU138
+	movq	512(%rdi), %rdx
+	.loc 1 964 33 view .LVU139
+	sarq	$5, %rbx
+.LVL53:
+	.loc 1 965 3 is_stmt 1 view .LVU140
+	.loc 1 966 3 view .LVU141
+	leaq	1(%rdx), %r9
+	.loc 1 966 28 is_stmt 0 view .LVU142
+	leaq	(%r9,%rbx), %rcx
+	xorl	%eax, %eax
+	.loc 1 966 6 view .LVU143
+	cmpq	$128, %rcx
+	ja	.L56
+	movq	%rdi, %rbp
+	.loc 1 970 3 is_stmt 1 view .LVU144
+	.loc 1 970 6 is_stmt 0 view .LVU145
+	testb	$31, %sil
+	je	.L59
+.LVL54:
+.LBB80:
+.LBB81:
+	.loc 1 972 26 is_stmt 1 view .LVU146
+	testq	%rdx, %rdx
+	je	.L59
+.LBE81:
+.LBE80:
+	.loc 1 965 26 is_stmt 0 view .LVU147
+	movq	%rsi, %rax
+	sarq	$63, %rax
+	shrq	$59, %rax
+	addq	%rax, %rsi
+.LVL55:
+	.loc 1 965 26 view .LVU148
+	andl	$31, %esi
+	subq	%rax, %rsi
+.LBB89:
+.LBB86:
+.LBB82:
+	.loc 1 975 27 view .LVU149
+	movl	$32, %r8d
+	movq	%rdi, %rax
+	leaq	(%rdi,%rdx,4), %r10
+.LBE82:
+.LBE86:
+.LBE89:
+	.loc 1 965 7 view .LVU150
+	movl	%esi, %r11d
+.LBB90:
+.LBB87:
+.LBB83:
+	.loc 1 975 27 view .LVU151
+	subl	%esi, %r8d
+.LBE83:
+.LBE87:
+	.loc 1 971 14 view .LVU152
+	xorl	%edi, %edi
+.LVL56:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+.LBB88:
+.LBB84:
+	.loc 1 973 7 is_stmt 1 discriminator 3 view .LVU153
+	.loc 1 973 16 is_stmt 0 discriminator 3 view .LVU154
+	movl	(%rax), %esi
+.LVL57:
+	.loc 1 974 7 is_stmt 1 discriminator 3 view .LVU155
+.LBE84:
+	.loc 1 972 26 is_stmt 0 discriminator 3 view .LVU156
+	addq	$4, %rax
+.LBB85:
+	.loc 1 974 32 discriminator 3 view .LVU157
+	shlx	%r11d, %esi, %ecx
+	.loc 1 974 41 discriminator 3 view .LVU158
+	orl	%edi, %ecx
+	movl	%ecx, -4(%rax)
+	.loc 1 975 7 is_stmt 1 discriminator 3 view .LVU159
+	.loc 1 975 13 is_stmt 0 discriminator 3 view .LVU160
+	shrx	%r8d, %esi, %edi
+.LVL58:
+	.loc 1 975 13 discriminator 3 view .LVU161
+.LBE85:
+	.loc 1 972 43 is_stmt 1 discriminator 3 view .LVU162
+	.loc 1 972 26 discriminator 3 view .LVU163
+	cmpq	%rax, %r10
+	jne	.L61
+.LBE88:
+	.loc 1 977 5 view .LVU164
+	.loc 1 977 8 is_stmt 0 view .LVU165
+	testl	%edi, %edi
+	je	.L59
+	.loc 1 978 7 is_stmt 1 view .LVU166
+	.loc 1 978 33 is_stmt 0 view .LVU167
+	movq	%r9, 512(%rbp)
+	.loc 1 978 37 view .LVU168
+	movl	%edi, 0(%rbp,%rdx,4)
+	movq	%r9, %rdx
+.LVL59:
+.L59:
+	.loc 1 978 37 view .LVU169
+.LBE90:
+	.loc 1 981 3 is_stmt 1 view .LVU170
+	.loc 1 981 6 is_stmt 0 view .LVU171
+	testq	%rbx, %rbx
+	jne	.L62
+	.loc 1 986 10 view .LVU172
+	movl	$1, %eax
+.LVL60:
+.L56:
+	.loc 1 987 1 view .LVU173
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL61:
+	.loc 1 987 1 view .LVU174
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL62:
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	.cfi_restore_state
+	.loc 1 982 5 is_stmt 1 view .LVU175
+	.loc 1 982 27 is_stmt 0 view .LVU176
+	leaq	0(,%rbx,4), %r12
+	.loc 1 982 5 view .LVU177
+	salq	$2, %rdx
+	leaq	0(%rbp,%r12), %rdi
+	movq	%rbp, %rsi
+	call	memmove@PLT
+.LVL63:
+	.loc 1 983 5 is_stmt 1 view .LVU178
+	movq	%r12, %rdx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	memset@PLT
+.LVL64:
+	.loc 1 984 5 view .LVU179
+	.loc 1 984 18 is_stmt 0 view .LVU180
+	addq	%rbx, 512(%rbp)
+	.loc 1 986 10 view .LVU181
+	movl	$1, %eax
+	jmp	.L56
+	.cfi_endproc
+.LFE36:
+	.size	numeric_parser_bigint_shl, .-numeric_parser_bigint_shl
+	.p2align 4
+	.type	numeric_parser_slow_path, @function
+numeric_parser_slow_path:
+.LVL65:
+.LFB38:
+	.loc 1 1030 112 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1032 3 view .LVU183
+	.loc 1 1030 112 is_stmt 0 view .LVU184
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 1032 30 view .LVU185
+	vpxor	%xmm0, %xmm0, %xmm0
+	.loc 1 1030 112 view .LVU186
+	movq	%rdx, %r9
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	%rcx, %rbx
+	subq	$1064, %rsp
+	.loc 1 1032 30 view .LVU187
+	movq	$0, 512(%rsp)
+	.loc 1 1033 3 is_stmt 1 view .LVU188
+.LVL66:
+	.loc 1 1034 3 view .LVU189
+	.loc 1 1035 3 view .LVU190
+.LBB105:
+	.loc 1 1035 8 view .LVU191
+	.loc 1 1035 34 view .LVU192
+.LBE105:
+	.loc 1 1032 30 is_stmt 0 view .LVU193
+	vmovdqu8	%zmm0, (%rsp)
+	vmovdqu8	%zmm0, 64(%rsp)
+	vmovdqu8	%zmm0, 128(%rsp)
+	vmovdqu8	%zmm0, 192(%rsp)
+	vmovdqu8	%zmm0, 256(%rsp)
+	vmovdqu8	%zmm0, 320(%rsp)
+	vmovdqu8	%zmm0, 384(%rsp)
+	vmovdqu8	%zmm0, 448(%rsp)
+.LBB126:
+	.loc 1 1035 34 view .LVU194
+	cmpq	%rsi, %rdi
+	jnb	.L108
+	movq	%rsi, %r8
+	xorl	%r15d, %r15d
+	xorl	%esi, %esi
+.LVL67:
+	.loc 1 1035 34 view .LVU195
+.LBE126:
+	.loc 1 1034 7 view .LVU196
+	xorl	%r12d, %r12d
+	.loc 1 1033 7 view .LVU197
+	xorl	%r10d, %r10d
+	movq	%rsp, %rcx
+.LVL68:
+	.p2align 4,,10
+	.p2align 3
+.L93:
+.LBB127:
+	.loc 1 1036 5 is_stmt 1 view .LVU198
+	.loc 1 1036 34 is_stmt 0 view .LVU199
+	movsbl	(%rdi), %r13d
+.LVL69:
+.LBB106:
+.LBI106:
+	.loc 1 756 19 is_stmt 1 view .LVU200
+.LBB107:
+	.loc 1 757 3 view .LVU201
+	.loc 1 757 10 is_stmt 0 view .LVU202
+	leal	-48(%r13), %eax
+.LBE107:
+.LBE106:
+	.loc 1 1036 8 view .LVU203
+	cmpb	$9, %al
+	ja	.L76
+	.loc 1 1039 5 is_stmt 1 view .LVU204
+	.loc 1 1039 8 is_stmt 0 view .LVU205
+	cmpl	$768, %r10d
+	je	.L77
+.LVL70:
+.LBB108:
+.LBB109:
+.LBB110:
+	.loc 1 900 24 is_stmt 1 view .LVU206
+	testq	%rsi, %rsi
+	je	.L142
+	movq	%rcx, %rdx
+	leaq	(%rcx,%rsi,4), %r14
+.LBE110:
+	.loc 1 899 12 is_stmt 0 view .LVU207
+	xorl	%eax, %eax
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+.LBB113:
+.LBB111:
+	.loc 1 901 5 is_stmt 1 view .LVU208
+	.loc 1 901 24 is_stmt 0 view .LVU209
+	movl	(%rdx), %r11d
+.LBE111:
+	.loc 1 900 24 view .LVU210
+	addq	$4, %rdx
+.LBB112:
+	.loc 1 901 51 view .LVU211
+	leaq	(%r11,%r11,4), %r11
+	.loc 1 901 14 view .LVU212
+	leaq	(%rax,%r11,2), %rax
+.LVL72:
+	.loc 1 902 5 is_stmt 1 view .LVU213
+	.loc 1 902 24 is_stmt 0 view .LVU214
+	movl	%eax, -4(%rdx)
+	.loc 1 903 5 is_stmt 1 view .LVU215
+	.loc 1 903 11 is_stmt 0 view .LVU216
+	shrq	$32, %rax
+.LVL73:
+	.loc 1 903 11 view .LVU217
+.LBE112:
+	.loc 1 900 41 is_stmt 1 view .LVU218
+	.loc 1 900 24 view .LVU219
+	cmpq	%r14, %rdx
+	jne	.L80
+.LBE113:
+	.loc 1 905 3 view .LVU220
+	.loc 1 905 6 is_stmt 0 view .LVU221
+	testq	%rax, %rax
+	je	.L84
+	.loc 1 906 5 is_stmt 1 view .LVU222
+	.loc 1 906 8 is_stmt 0 view .LVU223
+	cmpq	$128, %rsi
+	je	.L140
+	.loc 1 909 5 is_stmt 1 view .LVU224
+	.loc 1 909 37 is_stmt 0 view .LVU225
+	movl	%eax, (%rsp,%rsi,4)
+	.loc 1 909 35 view .LVU226
+	movl	$1, %r15d
+	.loc 1 909 31 view .LVU227
+	incq	%rsi
+.L84:
+.LVL74:
+	.loc 1 909 31 view .LVU228
+.LBE109:
+.LBE108:
+	.loc 1 1043 107 view .LVU229
+	subl	$48, %r13d
+.LVL75:
+.LBB115:
+.LBI115:
+	.loc 1 920 12 is_stmt 1 view .LVU230
+.LBB116:
+	.loc 1 921 3 view .LVU231
+	.loc 1 921 12 is_stmt 0 view .LVU232
+	movslq	%r13d, %rax
+.LVL76:
+	.loc 1 922 3 is_stmt 1 view .LVU233
+.LBB117:
+	.loc 1 922 8 view .LVU234
+	.loc 1 922 39 view .LVU235
+	.loc 1 922 15 is_stmt 0 view .LVU236
+	movl	$0, %edx
+	.loc 1 922 39 view .LVU237
+	jne	.L88
+	jmp	.L83
+.LVL77:
+	.p2align 4,,10
+	.p2align 3
+.L143:
+	.loc 1 922 39 view .LVU238
+	testq	%rax, %rax
+	je	.L83
+.LVL78:
+.L88:
+.LBB118:
+	.loc 1 923 5 is_stmt 1 view .LVU239
+	.loc 1 923 20 is_stmt 0 view .LVU240
+	movl	(%rcx,%rdx,4), %r11d
+	.loc 1 923 14 view .LVU241
+	addq	%r11, %rax
+.LVL79:
+	.loc 1 924 5 is_stmt 1 view .LVU242
+	.loc 1 924 24 is_stmt 0 view .LVU243
+	movl	%eax, (%rcx,%rdx,4)
+	.loc 1 925 5 is_stmt 1 view .LVU244
+.LBE118:
+	.loc 1 922 55 is_stmt 0 view .LVU245
+	incq	%rdx
+.LVL80:
+.LBB119:
+	.loc 1 925 11 view .LVU246
+	shrq	$32, %rax
+.LVL81:
+	.loc 1 925 11 view .LVU247
+.LBE119:
+	.loc 1 922 55 is_stmt 1 view .LVU248
+	.loc 1 922 39 view .LVU249
+	cmpq	%rsi, %rdx
+	jb	.L143
+.LBE117:
+	.loc 1 927 3 view .LVU250
+	.loc 1 927 6 is_stmt 0 view .LVU251
+	testq	%rax, %rax
+	je	.L83
+	.loc 1 928 5 is_stmt 1 view .LVU252
+	.loc 1 928 8 is_stmt 0 view .LVU253
+	cmpq	$128, %rsi
+	je	.L140
+.LBB120:
+	.loc 1 922 32 view .LVU254
+	movq	%rsi, %rax
+.LVL82:
+	.loc 1 922 32 view .LVU255
+.LBE120:
+	.loc 1 931 31 view .LVU256
+	movl	$1, %r13d
+.LVL83:
+	.loc 1 931 31 view .LVU257
+	incq	%rsi
+.LVL84:
+.L92:
+	.loc 1 931 5 is_stmt 1 view .LVU258
+	.loc 1 931 35 is_stmt 0 view .LVU259
+	movl	%r13d, (%rsp,%rax,4)
+	movl	$1, %r15d
+.L83:
+.LVL85:
+	.loc 1 931 35 view .LVU260
+.LBE116:
+.LBE115:
+	.loc 1 1046 5 is_stmt 1 view .LVU261
+	.loc 1 1046 16 is_stmt 0 view .LVU262
+	incl	%r10d
+.LVL86:
+.L76:
+	.loc 1 1035 42 is_stmt 1 discriminator 2 view .LVU263
+	incq	%rdi
+.LVL87:
+	.loc 1 1035 34 discriminator 2 view .LVU264
+	cmpq	%rdi, %r8
+	jne	.L93
+	.loc 1 1035 34 is_stmt 0 discriminator 2 view .LVU265
+	testb	%r15b, %r15b
+	je	.L94
+	movq	%rsi, 512(%rsp)
+.L94:
+.LBE127:
+	.loc 1 1049 26 view .LVU266
+	movslq	%r10d, %rsi
+	.loc 1 1049 11 view .LVU267
+	movq	%r9, %r11
+	subq	%rsi, %r11
+.LVL88:
+.L75:
+	.loc 1 1049 3 is_stmt 1 view .LVU268
+	.loc 1 1051 3 view .LVU269
+	.loc 1 1051 12 is_stmt 0 view .LVU270
+	movabsq	$4503599627370495, %rax
+	.loc 1 1053 6 view .LVU271
+	movq	%rbx, %rdx
+	.loc 1 1051 12 view .LVU272
+	andq	%rbx, %rax
+.LVL89:
+	.loc 1 1052 3 is_stmt 1 view .LVU273
+	.loc 1 1053 3 view .LVU274
+	.loc 1 1053 6 is_stmt 0 view .LVU275
+	shrq	$52, %rdx
+.LVL90:
+	.loc 1 1053 6 view .LVU276
+	movq	$-1075, %r14
+	jne	.L144
+.LVL91:
+.L95:
+	.loc 1 1060 3 is_stmt 1 view .LVU277
+	.loc 1 1060 30 is_stmt 0 view .LVU278
+	vpxor	%xmm0, %xmm0, %xmm0
+	.loc 1 1061 12 view .LVU279
+	leaq	1(%rax,%rax), %rax
+.LVL92:
+	.loc 1 1060 30 view .LVU280
+	vmovdqu8	%zmm0, 528(%rsp)
+	.loc 1 1064 16 view .LVU281
+	movq	$2, 1040(%rsp)
+	.loc 1 1061 12 view .LVU282
+	movq	%rax, 528(%rsp)
+	.loc 1 1060 30 view .LVU283
+	vmovdqu8	%zmm0, 592(%rsp)
+	vmovdqu8	%zmm0, 656(%rsp)
+	vmovdqu8	%zmm0, 720(%rsp)
+	vmovdqu8	%zmm0, 784(%rsp)
+	vmovdqu8	%zmm0, 848(%rsp)
+	vmovdqu8	%zmm0, 912(%rsp)
+	vmovdqu8	%zmm0, 976(%rsp)
+	.loc 1 1061 3 is_stmt 1 view .LVU284
+	.loc 1 1062 3 view .LVU285
+	.loc 1 1063 3 view .LVU286
+	.loc 1 1064 3 view .LVU287
+	.loc 1 1065 3 view .LVU288
+	.loc 1 1067 3 view .LVU289
+.LVL93:
+	.loc 1 1068 3 view .LVU290
+	.loc 1 1068 6 is_stmt 0 view .LVU291
+	testq	%r11, %r11
+	js	.L96
+	.loc 1 1069 5 is_stmt 1 view .LVU292
+	.loc 1 1069 13 is_stmt 0 view .LVU293
+	movq	%r11, %rsi
+	movq	%rsp, %rdi
+.LVL94:
+	.loc 1 1069 13 view .LVU294
+	vzeroupper
+.LVL95:
+	call	numeric_parser_bigint_mul_pow5
+.LVL96:
+	.loc 1 1069 10 view .LVU295
+	andl	$1, %eax
+	.loc 1 1075 6 view .LVU296
+	movq	%r11, %rsi
+	.loc 1 1069 10 view .LVU297
+	movl	%eax, %r13d
+.LVL97:
+	.loc 1 1074 3 is_stmt 1 view .LVU298
+	.loc 1 1075 3 view .LVU299
+	.loc 1 1075 6 is_stmt 0 view .LVU300
+	subq	%r14, %rsi
+.LVL98:
+	.loc 1 1075 6 view .LVU301
+	js	.L98
+.L149:
+	.loc 1 1076 5 is_stmt 1 view .LVU302
+	.loc 1 1076 13 is_stmt 0 view .LVU303
+	movq	%rsp, %rdi
+	call	numeric_parser_bigint_shl
+.LVL99:
+	.loc 1 1076 10 view .LVU304
+	andl	%eax, %r13d
+.LVL100:
+.L99:
+	.loc 1 1081 3 is_stmt 1 view .LVU305
+	.loc 1 1081 6 is_stmt 0 view .LVU306
+	testl	%r13d, %r13d
+	je	.L91
+	.loc 1 1084 3 is_stmt 1 view .LVU307
+.LVL101:
+.LBB128:
+.LBI128:
+	.loc 1 995 12 view .LVU308
+.LBB129:
+	.loc 1 996 3 view .LVU309
+	.loc 1 996 10 is_stmt 0 view .LVU310
+	movq	512(%rsp), %rax
+.LVL102:
+	.loc 1 996 28 view .LVU311
+	movq	1040(%rsp), %rdx
+.LVL103:
+	.loc 1 997 3 is_stmt 1 view .LVU312
+	.loc 1 997 32 is_stmt 0 view .LVU313
+	movq	%rsp, %rsi
+	.loc 1 997 9 view .LVU314
+	jmp	.L101
+.LVL104:
+	.p2align 4,,10
+	.p2align 3
+.L145:
+	.loc 1 997 21 view .LVU315
+	movl	-4(%rsi,%rax,4), %r8d
+	.loc 1 997 40 view .LVU316
+	leaq	-1(%rax), %rcx
+	.loc 1 997 21 view .LVU317
+	testl	%r8d, %r8d
+	jne	.L100
+	.loc 1 998 11 view .LVU318
+	movq	%rcx, %rax
+.LVL105:
+.L101:
+	.loc 1 997 21 is_stmt 1 view .LVU319
+	testq	%rax, %rax
+	jne	.L145
+.L100:
+	.loc 1 1000 32 is_stmt 0 view .LVU320
+	leaq	528(%rsp), %rsi
+.LVL106:
+	.loc 1 1000 32 view .LVU321
+	jmp	.L103
+	.p2align 4,,10
+	.p2align 3
+.L147:
+	.loc 1 1000 21 view .LVU322
+	movl	-4(%rsi,%rdx,4), %edi
+	.loc 1 1000 40 view .LVU323
+	leaq	-1(%rdx), %rcx
+	.loc 1 1000 21 view .LVU324
+	testl	%edi, %edi
+	jne	.L146
+	.loc 1 1001 11 view .LVU325
+	movq	%rcx, %rdx
+.LVL107:
+.L103:
+	.loc 1 1000 21 is_stmt 1 view .LVU326
+	testq	%rdx, %rdx
+	jne	.L147
+	.loc 1 1003 3 view .LVU327
+	.loc 1 1003 6 is_stmt 0 view .LVU328
+	testq	%rax, %rax
+	jne	.L105
+.LVL108:
+.L139:
+	.loc 1 1003 6 view .LVU329
+.LBE129:
+.LBE128:
+	.loc 1 1085 3 is_stmt 1 view .LVU330
+	.loc 1 1085 6 is_stmt 0 view .LVU331
+	testl	%r12d, %r12d
+	je	.L148
+.LVL109:
+.L105:
+	.loc 1 1089 5 is_stmt 1 view .LVU332
+	.loc 1 1089 17 is_stmt 0 view .LVU333
+	leaq	1(%rbx), %rax
+	jmp	.L74
+.LVL110:
+	.p2align 4,,10
+	.p2align 3
+.L77:
+.LBB133:
+	.loc 1 1040 7 is_stmt 1 discriminator 1 view .LVU334
+	.loc 1 1040 20 is_stmt 0 discriminator 1 view .LVU335
+	xorl	%eax, %eax
+	cmpb	$48, %r13b
+	setne	%al
+	.loc 1 1040 14 discriminator 1 view .LVU336
+	orl	%eax, %r12d
+.LVL111:
+	.loc 1 1041 7 is_stmt 1 discriminator 1 view .LVU337
+	jmp	.L76
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	.loc 1 1041 7 is_stmt 0 discriminator 1 view .LVU338
+	vzeroupper
+.LVL112:
+.L91:
+	.loc 1 1041 7 discriminator 1 view .LVU339
+.LBE133:
+.LBB134:
+.LBB131:
+	.loc 1 1001 11 view .LVU340
+	movq	%rbx, %rax
+.L74:
+	.loc 1 1001 11 view .LVU341
+.LBE131:
+.LBE134:
+	.loc 1 1092 1 view .LVU342
+	addq	$1064, %rsp
+	popq	%rbx
+.LVL113:
+	.loc 1 1092 1 view .LVU343
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL114:
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	.cfi_restore_state
+.LBB135:
+.LBB124:
+.LBB114:
+	.loc 1 905 3 is_stmt 1 view .LVU344
+	.loc 1 905 3 is_stmt 0 view .LVU345
+.LBE114:
+.LBE124:
+.LBB125:
+	.loc 1 920 12 is_stmt 1 view .LVU346
+.LBB123:
+	.loc 1 921 3 view .LVU347
+	.loc 1 922 3 view .LVU348
+.LBB121:
+	.loc 1 922 8 view .LVU349
+	.loc 1 922 39 view .LVU350
+	.loc 1 922 39 is_stmt 0 view .LVU351
+.LBE121:
+	.loc 1 927 3 is_stmt 1 view .LVU352
+	.loc 1 927 6 is_stmt 0 view .LVU353
+	subl	$48, %r13d
+.LVL115:
+	.loc 1 927 6 view .LVU354
+	je	.L83
+.LBB122:
+	.loc 1 922 32 view .LVU355
+	xorl	%eax, %eax
+.LVL116:
+	.loc 1 922 32 view .LVU356
+.LBE122:
+	.loc 1 931 37 view .LVU357
+	movl	$1, %esi
+	jmp	.L92
+.LVL117:
+.L144:
+	.loc 1 931 37 view .LVU358
+.LBE123:
+.LBE125:
+.LBE135:
+	.loc 1 1057 5 is_stmt 1 view .LVU359
+	.loc 1 1057 7 is_stmt 0 view .LVU360
+	btsq	$52, %rax
+.LVL118:
+	.loc 1 1058 5 is_stmt 1 view .LVU361
+	.loc 1 1065 6 is_stmt 0 view .LVU362
+	leaq	-1076(%rdx), %r14
+	jmp	.L95
+.LVL119:
+.L96:
+	.loc 1 1072 5 is_stmt 1 view .LVU363
+	.loc 1 1072 13 is_stmt 0 view .LVU364
+	subq	%r9, %rsi
+	leaq	528(%rsp), %rdi
+.LVL120:
+	.loc 1 1072 13 view .LVU365
+	vzeroupper
+.LVL121:
+	call	numeric_parser_bigint_mul_pow5
+.LVL122:
+	.loc 1 1072 10 view .LVU366
+	andl	$1, %eax
+	.loc 1 1075 6 view .LVU367
+	movq	%r11, %rsi
+	.loc 1 1072 10 view .LVU368
+	movl	%eax, %r13d
+.LVL123:
+	.loc 1 1074 3 is_stmt 1 view .LVU369
+	.loc 1 1075 3 view .LVU370
+	.loc 1 1075 6 is_stmt 0 view .LVU371
+	subq	%r14, %rsi
+.LVL124:
+	.loc 1 1075 6 view .LVU372
+	jns	.L149
+.L98:
+	.loc 1 1079 5 is_stmt 1 view .LVU373
+	.loc 1 1079 13 is_stmt 0 view .LVU374
+	movq	%r14, %rsi
+.LVL125:
+	.loc 1 1079 13 view .LVU375
+	subq	%r11, %rsi
+	leaq	528(%rsp), %rdi
+	call	numeric_parser_bigint_shl
+.LVL126:
+	.loc 1 1079 10 view .LVU376
+	andl	%eax, %r13d
+.LVL127:
+	.loc 1 1079 10 view .LVU377
+	jmp	.L99
+.LVL128:
+.L146:
+.LBB136:
+.LBB132:
+	.loc 1 1003 3 is_stmt 1 view .LVU378
+	.loc 1 1003 6 is_stmt 0 view .LVU379
+	cmpq	%rax, %rdx
+	je	.L106
+	.loc 1 1004 5 is_stmt 1 view .LVU380
+	.loc 1 1004 33 is_stmt 0 view .LVU381
+	cmpq	%rdx, %rax
+	jb	.L91
+	jmp	.L105
+.LVL129:
+	.p2align 4,,10
+	.p2align 3
+.L106:
+.LBB130:
+	.loc 1 1006 29 is_stmt 1 view .LVU382
+	testq	%rax, %rax
+	je	.L139
+	.loc 1 1007 5 view .LVU383
+	.loc 1 1007 20 is_stmt 0 view .LVU384
+	decq	%rax
+.LVL130:
+	.loc 1 1007 8 view .LVU385
+	movl	528(%rsp,%rax,4), %edi
+	cmpl	%edi, (%rsp,%rax,4)
+	je	.L106
+	.loc 1 1008 7 is_stmt 1 view .LVU386
+	.loc 1 1008 53 is_stmt 0 view .LVU387
+	jb	.L91
+	jmp	.L105
+.LVL131:
+.L148:
+	.loc 1 1008 53 view .LVU388
+.LBE130:
+.LBE132:
+.LBE136:
+	.loc 1 1088 3 is_stmt 1 view .LVU389
+	.loc 1 1088 32 is_stmt 0 view .LVU390
+	testb	$1, %bl
+	je	.L91
+	jmp	.L105
+.LVL132:
+.L108:
+.LBB137:
+	.loc 1 1035 34 view .LVU391
+	movq	%rdx, %r11
+	xorl	%esi, %esi
+.LVL133:
+	.loc 1 1035 34 view .LVU392
+.LBE137:
+	.loc 1 1034 7 view .LVU393
+	xorl	%r12d, %r12d
+	jmp	.L75
+	.cfi_endproc
+.LFE38:
+	.size	numeric_parser_slow_path, .-numeric_parser_slow_path
+	.p2align 4
+	.type	numeric_parser_eisel_lemire.part.0, @function
+numeric_parser_eisel_lemire.part.0:
+.LVL134:
+.LFB43:
+	.loc 1 834 17 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 842 3 view .LVU395
+	.loc 1 842 12 is_stmt 0 view .LVU396
+	xorl	%r9d, %r9d
+	lzcntq	%rsi, %r9
+.LVL135:
+	.loc 1 843 3 is_stmt 1 view .LVU397
+	.loc 1 843 5 is_stmt 0 view .LVU398
+	shlx	%r9, %rsi, %rdx
+.LVL136:
+	.loc 1 845 3 is_stmt 1 view .LVU399
+	.loc 1 845 65 is_stmt 0 view .LVU400
+	leaq	342(%rdi), %rsi
+	.loc 1 845 19 view .LVU401
+	leaq	numeric_parser_power_of_five(%rip), %rax
+	.loc 1 845 56 view .LVU402
+	salq	$4, %rsi
+	.loc 1 845 19 view .LVU403
+	addq	%rax, %rsi
+.LVL137:
+	.loc 1 846 3 is_stmt 1 view .LVU404
+	.loc 1 847 3 view .LVU405
+.LBB138:
+.LBI138:
+	.loc 1 735 24 view .LVU406
+.LBB139:
+	.loc 1 737 17 view .LVU407
+	.loc 1 737 35 is_stmt 0 view .LVU408
+	mulx	(%rsi), %r10, %r11
+.LVL138:
+	.loc 1 738 3 is_stmt 1 view .LVU409
+.LBE139:
+.LBE138:
+	.loc 1 834 17 is_stmt 0 view .LVU410
+	movq	%rdi, %rcx
+	.loc 1 849 13 view .LVU411
+	movq	%r11, %rax
+	andl	$511, %eax
+.LBB141:
+.LBB140:
+	.loc 1 738 30 view .LVU412
+	movq	%r11, %r8
+.LVL139:
+	.loc 1 739 3 is_stmt 1 view .LVU413
+	.loc 1 739 10 is_stmt 0 view .LVU414
+	movq	%r10, %rdi
+.LVL140:
+	.loc 1 739 10 view .LVU415
+.LBE140:
+.LBE141:
+	.loc 1 848 3 is_stmt 1 view .LVU416
+	.loc 1 849 3 view .LVU417
+	.loc 1 849 6 is_stmt 0 view .LVU418
+	cmpq	$511, %rax
+	jne	.L151
+.LBB142:
+	.loc 1 850 5 is_stmt 1 view .LVU419
+	.loc 1 851 5 view .LVU420
+.LVL141:
+.LBB143:
+.LBI143:
+	.loc 1 735 24 view .LVU421
+.LBB144:
+	.loc 1 737 17 view .LVU422
+	.loc 1 738 3 view .LVU423
+	.loc 1 739 3 view .LVU424
+	.loc 1 739 3 is_stmt 0 view .LVU425
+.LBE144:
+.LBE143:
+	.loc 1 852 5 is_stmt 1 view .LVU426
+.LBB146:
+.LBB145:
+	.loc 1 738 30 is_stmt 0 view .LVU427
+	movq	%rdx, %rax
+	mulq	8(%rsi)
+.LVL142:
+	.loc 1 738 30 view .LVU428
+	xorl	%eax, %eax
+	addq	%r10, %rdx
+	setc	%al
+.LBE145:
+.LBE146:
+	.loc 1 854 11 view .LVU429
+	cmpq	$1, %rax
+	.loc 1 852 9 view .LVU430
+	movq	%rdx, %rdi
+.LVL143:
+	.loc 1 853 5 is_stmt 1 view .LVU431
+	.loc 1 854 11 is_stmt 0 view .LVU432
+	sbbq	$-1, %r8
+.LVL144:
+.L151:
+	.loc 1 854 11 view .LVU433
+.LBE142:
+	.loc 1 857 3 is_stmt 1 view .LVU434
+	.loc 1 861 48 is_stmt 0 view .LVU435
+	imulq	$217706, %rcx, %rax
+	.loc 1 857 29 view .LVU436
+	movq	%r8, %rsi
+.LVL145:
+	.loc 1 857 29 view .LVU437
+	shrq	$63, %rsi
+.LVL146:
+	.loc 1 858 3 is_stmt 1 view .LVU438
+	.loc 1 861 53 is_stmt 0 view .LVU439
+	sarq	$16, %rax
+	.loc 1 861 65 view .LVU440
+	leal	63(%rax,%rsi), %eax
+	.loc 1 861 76 view .LVU441
+	subl	%r9d, %eax
+	.loc 1 858 7 view .LVU442
+	leal	9(%rsi), %r10d
+.LVL147:
+	.loc 1 859 3 is_stmt 1 view .LVU443
+	.loc 1 861 11 is_stmt 0 view .LVU444
+	leal	1023(%rax), %esi
+.LVL148:
+	.loc 1 859 12 view .LVU445
+	shrx	%r10, %r8, %rdx
+.LVL149:
+	.loc 1 861 3 is_stmt 1 view .LVU446
+	.loc 1 862 3 view .LVU447
+	.loc 1 862 6 is_stmt 0 view .LVU448
+	testl	%esi, %esi
+	jle	.L169
+	.loc 1 874 3 is_stmt 1 view .LVU449
+	.loc 1 874 27 is_stmt 0 view .LVU450
+	addq	$4, %rcx
+.LVL150:
+	.loc 1 874 27 view .LVU451
+	cmpq	$27, %rcx
+	ja	.L156
+	cmpq	$1, %rdi
+	jbe	.L170
+.LVL151:
+.L156:
+	.loc 1 879 3 is_stmt 1 view .LVU452
+	.loc 1 880 3 view .LVU453
+	.loc 1 879 12 is_stmt 0 view .LVU454
+	incq	%rdx
+.LVL152:
+	.loc 1 879 12 view .LVU455
+	movq	%rdx, %rcx
+	shrq	%rcx
+.LVL153:
+	.loc 1 881 3 is_stmt 1 view .LVU456
+	.loc 1 881 6 is_stmt 0 view .LVU457
+	shrq	$54, %rdx
+	jne	.L157
+	.loc 1 885 12 view .LVU458
+	btrq	$52, %rcx
+.LVL154:
+.L158:
+	.loc 1 885 3 is_stmt 1 view .LVU459
+	.loc 1 886 3 view .LVU460
+	.loc 1 889 35 is_stmt 0 view .LVU461
+	movq	%rsi, %rdx
+	salq	$52, %rdx
+	orq	%rcx, %rdx
+	.loc 1 839 12 view .LVU462
+	movabsq	$9218868437227405312, %rax
+	.loc 1 889 35 view .LVU463
+	cmpl	$2047, %esi
+	cmovl	%rdx, %rax
+.L150:
+	.loc 1 890 1 view .LVU464
+	ret
+.LVL155:
+	.p2align 4,,10
+	.p2align 3
+.L157:
+	.loc 1 882 5 is_stmt 1 view .LVU465
+	.loc 1 883 5 view .LVU466
+	.loc 1 883 11 is_stmt 0 view .LVU467
+	leal	1024(%rax), %esi
+.LVL156:
+	.loc 1 883 11 view .LVU468
+	xorl	%ecx, %ecx
+	jmp	.L158
+.LVL157:
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	.loc 1 864 5 is_stmt 1 view .LVU469
+	.loc 1 864 17 is_stmt 0 view .LVU470
+	movl	$1, %ecx
+.LVL158:
+	.loc 1 864 17 view .LVU471
+	subl	%esi, %ecx
+	.loc 1 836 12 view .LVU472
+	xorl	%eax, %eax
+	.loc 1 864 8 view .LVU473
+	cmpl	$63, %ecx
+	jg	.L150
+	.loc 1 867 5 is_stmt 1 view .LVU474
+.LVL159:
+	.loc 1 868 5 view .LVU475
+	.loc 1 869 5 view .LVU476
+	.loc 1 867 14 is_stmt 0 view .LVU477
+	shrx	%rcx, %rdx, %rcx
+.LVL160:
+	.loc 1 868 14 view .LVU478
+	incq	%rcx
+	.loc 1 870 44 view .LVU479
+	movabsq	$4503599627370495, %rdx
+.LVL161:
+	.loc 1 870 44 view .LVU480
+	shrq	%rcx
+.LVL162:
+	.loc 1 870 5 is_stmt 1 view .LVU481
+	.loc 1 871 5 view .LVU482
+	.loc 1 870 44 is_stmt 0 view .LVU483
+	xorl	%eax, %eax
+	cmpq	%rcx, %rdx
+	setb	%al
+	.loc 1 871 30 view .LVU484
+	salq	$52, %rax
+	.loc 1 871 49 view .LVU485
+	andq	%rdx, %rcx
+.LVL163:
+	.loc 1 871 37 view .LVU486
+	orq	%rcx, %rax
+	ret
+.LVL164:
+	.p2align 4,,10
+	.p2align 3
+.L170:
+	.loc 1 874 51 view .LVU487
+	movq	%rdx, %rcx
+	andl	$3, %ecx
+	.loc 1 874 38 view .LVU488
+	cmpq	$1, %rcx
+	jne	.L156
+	.loc 1 875 5 is_stmt 1 view .LVU489
+	.loc 1 876 16 is_stmt 0 view .LVU490
+	movq	%rdx, %rcx
+	andq	$-2, %rcx
+	.loc 1 875 19 view .LVU491
+	shlx	%r10, %rdx, %r10
+.LVL165:
+	.loc 1 876 16 view .LVU492
+	cmpq	%r10, %r8
+	cmove	%rcx, %rdx
+.LVL166:
+	.loc 1 876 16 view .LVU493
+	jmp	.L156
+	.cfi_endproc
+.LFE43:
+	.size	numeric_parser_eisel_lemire.part.0, .-numeric_parser_eisel_lemire.part.0
+	.p2align 4
+	.globl	stod
+	.type	stod, @function
+stod:
+.LVL167:
+.LFB39:
+	.loc 1 1097 69 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1098 3 view .LVU495
+	.loc 1 1099 3 view .LVU496
+	.loc 1 1097 69 is_stmt 0 view .LVU497
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	.loc 1 1099 15 view .LVU498
+	leaq	(%rdi,%rsi), %rbp
+.LVL168:
+	.loc 1 1101 3 is_stmt 1 view .LVU499
+	.loc 1 1102 3 view .LVU500
+	.loc 1 1097 69 is_stmt 0 view .LVU501
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 1097 69 view .LVU502
+	movq	%rdx, (%rsp)
+	.loc 1 1102 6 view .LVU503
+	cmpq	%rbp, %rdi
+	jnb	.L211
+	.loc 1 1102 19 discriminator 1 view .LVU504
+	movzbl	(%rdi), %eax
+	.loc 1 1102 29 discriminator 1 view .LVU505
+	leal	-43(%rax), %edx
+.LVL169:
+	.loc 1 1102 15 discriminator 1 view .LVU506
+	andl	$253, %edx
+	je	.L257
+	.loc 1 1101 7 view .LVU507
+	movl	$0, 8(%rsp)
+	movq	%rdi, %r12
+.LVL170:
+.L173:
+	.loc 1 1107 3 is_stmt 1 view .LVU508
+	.loc 1 1108 3 view .LVU509
+	.loc 1 1109 3 view .LVU510
+.LBB185:
+.LBI185:
+	.loc 1 802 27 view .LVU511
+.LBB186:
+	.loc 1 803 3 view .LVU512
+	.loc 1 804 3 view .LVU513
+	.loc 1 804 18 view .LVU514
+	.loc 1 804 14 is_stmt 0 view .LVU515
+	movq	%rbp, %rax
+	subq	%r12, %rax
+	.loc 1 804 18 view .LVU516
+	movq	%r12, %rbx
+	.loc 1 803 12 view .LVU517
+	xorl	%esi, %esi
+.LVL171:
+	.loc 1 804 18 view .LVU518
+	cmpq	$7, %rax
+	jle	.L174
+.LVL172:
+.LBB187:
+.LBB188:
+.LBB189:
+	.loc 1 777 19 view .LVU519
+	movabsq	$5063812098665367110, %r9
+	.loc 1 777 53 view .LVU520
+	movabsq	$-3472328296227680304, %r8
+	.loc 1 777 79 view .LVU521
+	movabsq	$-9187201950435737472, %rdi
+.LVL173:
+	.loc 1 777 79 view .LVU522
+.LBE189:
+.LBE188:
+.LBB191:
+.LBB192:
+	.loc 1 784 19 view .LVU523
+	movabsq	$1085102592571150095, %r15
+	.loc 1 785 19 view .LVU524
+	movabsq	$71777214294589695, %r14
+	.loc 1 786 18 view .LVU525
+	movabsq	$281470681808895, %r11
+	.loc 1 786 43 view .LVU526
+	movabsq	$42949672960001, %r10
+	jmp	.L177
+.LVL174:
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	.loc 1 786 43 view .LVU527
+.LBE192:
+.LBE191:
+	.loc 1 809 5 is_stmt 1 view .LVU528
+.LBB196:
+.LBB193:
+	.loc 1 784 19 is_stmt 0 view .LVU529
+	andq	%r15, %rax
+.LVL175:
+	.loc 1 784 44 view .LVU530
+	imulq	$2561, %rax, %rax
+.LBE193:
+.LBE196:
+	.loc 1 809 19 view .LVU531
+	imulq	$100000000, %rsi, %rsi
+.LVL176:
+.LBB197:
+.LBI191:
+	.loc 1 783 24 is_stmt 1 view .LVU532
+.LBB194:
+	.loc 1 784 3 view .LVU533
+	.loc 1 785 3 view .LVU534
+.LBE194:
+.LBE197:
+	.loc 1 810 7 is_stmt 0 view .LVU535
+	addq	$8, %rbx
+.LVL177:
+.LBB198:
+.LBB195:
+	.loc 1 784 9 view .LVU536
+	shrq	$8, %rax
+	.loc 1 785 19 view .LVU537
+	andq	%r14, %rax
+	.loc 1 785 44 view .LVU538
+	imulq	$6553601, %rax, %rax
+.LVL178:
+	.loc 1 786 3 is_stmt 1 view .LVU539
+	.loc 1 785 9 is_stmt 0 view .LVU540
+	shrq	$16, %rax
+	.loc 1 786 18 view .LVU541
+	andq	%r11, %rax
+	.loc 1 786 43 view .LVU542
+	imulq	%r10, %rax
+	.loc 1 786 74 view .LVU543
+	shrq	$32, %rax
+.LBE195:
+.LBE198:
+	.loc 1 809 11 view .LVU544
+	addq	%rax, %rsi
+.LVL179:
+	.loc 1 810 5 is_stmt 1 view .LVU545
+	.loc 1 810 5 is_stmt 0 view .LVU546
+.LBE187:
+	.loc 1 804 18 is_stmt 1 view .LVU547
+	.loc 1 804 14 is_stmt 0 view .LVU548
+	movq	%rbp, %rax
+	subq	%rbx, %rax
+	.loc 1 804 18 view .LVU549
+	cmpq	$7, %rax
+	jle	.L174
+.LVL180:
+.L177:
+.LBB202:
+	.loc 1 805 5 is_stmt 1 view .LVU550
+.LBB199:
+.LBI199:
+	.loc 1 763 24 view .LVU551
+.LBB200:
+	.loc 1 764 3 view .LVU552
+	.loc 1 765 3 view .LVU553
+	movq	(%rbx), %rax
+.LVL181:
+	.loc 1 769 3 view .LVU554
+	.loc 1 769 3 is_stmt 0 view .LVU555
+.LBE200:
+.LBE199:
+	.loc 1 806 5 is_stmt 1 view .LVU556
+.LBB201:
+.LBI188:
+	.loc 1 775 19 view .LVU557
+.LBB190:
+	.loc 1 777 3 view .LVU558
+	.loc 1 777 19 is_stmt 0 view .LVU559
+	leaq	(%rax,%r9), %rdx
+	.loc 1 777 53 view .LVU560
+	leaq	(%rax,%r8), %rcx
+	.loc 1 777 44 view .LVU561
+	orq	%rcx, %rdx
+.LBE190:
+.LBE201:
+	.loc 1 806 8 view .LVU562
+	testq	%rdi, %rdx
+	je	.L175
+.LVL182:
+.L174:
+	.loc 1 806 8 view .LVU563
+.LBE202:
+	.loc 1 812 18 is_stmt 1 view .LVU564
+	cmpq	%rbp, %rbx
+	jb	.L176
+	.loc 1 812 18 is_stmt 0 view .LVU565
+	jmp	.L258
+	.p2align 4,,10
+	.p2align 3
+.L179:
+	.loc 1 813 5 is_stmt 1 view .LVU566
+	.loc 1 813 40 is_stmt 0 view .LVU567
+	subl	$48, %eax
+	.loc 1 813 19 view .LVU568
+	leaq	(%rsi,%rsi,4), %rdx
+	.loc 1 813 26 view .LVU569
+	cltq
+	.loc 1 814 6 view .LVU570
+	incq	%rbx
+.LVL183:
+	.loc 1 813 11 view .LVU571
+	leaq	(%rax,%rdx,2), %rsi
+.LVL184:
+	.loc 1 814 5 is_stmt 1 view .LVU572
+	.loc 1 812 18 view .LVU573
+	cmpq	%rbx, %rbp
+	je	.L178
+.L176:
+	.loc 1 812 45 is_stmt 0 view .LVU574
+	movsbl	(%rbx), %eax
+.LBB203:
+.LBB204:
+	.loc 1 757 10 view .LVU575
+	leal	-48(%rax), %edx
+.LBE204:
+.LBE203:
+	.loc 1 812 45 view .LVU576
+	movl	%eax, %ecx
+.LVL185:
+.LBB206:
+.LBI203:
+	.loc 1 756 19 is_stmt 1 view .LVU577
+.LBB205:
+	.loc 1 757 3 view .LVU578
+	.loc 1 757 3 is_stmt 0 view .LVU579
+.LBE205:
+.LBE206:
+	.loc 1 812 18 view .LVU580
+	cmpb	$9, %dl
+	jbe	.L179
+	.loc 1 816 3 is_stmt 1 view .LVU581
+.LVL186:
+	.loc 1 817 3 view .LVU582
+	.loc 1 817 3 is_stmt 0 view .LVU583
+.LBE186:
+.LBE185:
+	.loc 1 1110 3 is_stmt 1 view .LVU584
+	.loc 1 1110 11 is_stmt 0 view .LVU585
+	movq	%rbx, %rdx
+	subq	%r12, %rdx
+.LVL187:
+	.loc 1 1111 3 is_stmt 1 view .LVU586
+	.loc 1 1112 3 view .LVU587
+	.loc 1 1112 6 is_stmt 0 view .LVU588
+	cmpq	%rbp, %rbx
+	jnb	.L214
+	.loc 1 1112 15 discriminator 1 view .LVU589
+	cmpb	$46, %al
+	je	.L259
+	.loc 1 1118 3 is_stmt 1 view .LVU590
+	.loc 1 1120 12 is_stmt 0 view .LVU591
+	xorl	%eax, %eax
+	.loc 1 1118 6 view .LVU592
+	testq	%rdx, %rdx
+	je	.L171
+	.loc 1 1110 11 view .LVU593
+	movq	%rdx, %r8
+	.loc 1 1111 11 view .LVU594
+	xorl	%edi, %edi
+.LVL188:
+.L210:
+	.loc 1 1125 29 discriminator 1 view .LVU595
+	andl	$-33, %ecx
+	.loc 1 1125 15 discriminator 1 view .LVU596
+	cmpb	$69, %cl
+	jne	.L224
+.LBB210:
+	.loc 1 1126 5 is_stmt 1 view .LVU597
+.LVL189:
+	.loc 1 1127 5 view .LVU598
+	.loc 1 1127 6 is_stmt 0 view .LVU599
+	leaq	1(%rbx), %rcx
+.LVL190:
+	.loc 1 1128 5 is_stmt 1 view .LVU600
+	.loc 1 1129 5 view .LVU601
+	.loc 1 1129 8 is_stmt 0 view .LVU602
+	cmpq	%rbp, %rcx
+	jnb	.L224
+	.loc 1 1129 21 view .LVU603
+	movzbl	1(%rbx), %eax
+	.loc 1 1129 31 view .LVU604
+	leal	-43(%rax), %r9d
+	.loc 1 1129 17 view .LVU605
+	andl	$253, %r9d
+	jne	.L190
+	.loc 1 1130 7 is_stmt 1 view .LVU606
+.LVL191:
+	.loc 1 1131 7 view .LVU607
+	.loc 1 1131 8 is_stmt 0 view .LVU608
+	leaq	2(%rbx), %rcx
+.LVL192:
+	.loc 1 1133 5 is_stmt 1 view .LVU609
+	.loc 1 1133 8 is_stmt 0 view .LVU610
+	cmpq	%rbp, %rcx
+	jnb	.L224
+.LVL193:
+.LBB211:
+.LBI211:
+	.loc 1 756 19 is_stmt 1 view .LVU611
+.LBB212:
+	.loc 1 757 3 view .LVU612
+	.loc 1 757 10 is_stmt 0 view .LVU613
+	movzbl	2(%rbx), %r11d
+	leal	-48(%r11), %r9d
+.LBE212:
+.LBE211:
+	.loc 1 1133 17 view .LVU614
+	cmpb	$9, %r9b
+	ja	.L224
+	.loc 1 1130 25 view .LVU615
+	xorl	%r10d, %r10d
+	cmpb	$45, %al
+	sete	%r10b
+.L191:
+.LVL194:
+	.loc 1 1130 25 view .LVU616
+.LBE210:
+	.loc 1 1124 11 view .LVU617
+	xorl	%r9d, %r9d
+	jmp	.L192
+.LVL195:
+	.p2align 4,,10
+	.p2align 3
+.L195:
+.LBB217:
+	.loc 1 1135 9 is_stmt 1 view .LVU618
+	.loc 1 1135 12 is_stmt 0 view .LVU619
+	cmpq	$268435455, %r9
+	jg	.L193
+	.loc 1 1136 11 is_stmt 1 view .LVU620
+	.loc 1 1136 42 is_stmt 0 view .LVU621
+	subl	$48, %eax
+	.loc 1 1136 31 view .LVU622
+	leaq	(%r9,%r9,4), %r9
+.LVL196:
+	.loc 1 1136 42 view .LVU623
+	cltq
+	.loc 1 1136 20 view .LVU624
+	leaq	(%rax,%r9,2), %r9
+.LVL197:
+.L193:
+	.loc 1 1138 9 is_stmt 1 view .LVU625
+	.loc 1 1138 10 is_stmt 0 view .LVU626
+	incq	%rcx
+.LVL198:
+	.loc 1 1134 22 is_stmt 1 view .LVU627
+	cmpq	%rcx, %rbp
+	je	.L194
+.LVL199:
+.L192:
+	.loc 1 1134 49 is_stmt 0 discriminator 1 view .LVU628
+	movsbl	(%rcx), %eax
+.LVL200:
+.LBB214:
+.LBI214:
+	.loc 1 756 19 is_stmt 1 discriminator 1 view .LVU629
+.LBB215:
+	.loc 1 757 3 discriminator 1 view .LVU630
+	.loc 1 757 10 is_stmt 0 discriminator 1 view .LVU631
+	leal	-48(%rax), %r11d
+.LBE215:
+.LBE214:
+	.loc 1 1134 22 discriminator 1 view .LVU632
+	cmpb	$9, %r11b
+	jbe	.L195
+	movq	%rcx, %rbp
+.LVL201:
+.L194:
+	.loc 1 1140 7 is_stmt 1 view .LVU633
+	.loc 1 1140 48 is_stmt 0 view .LVU634
+	movq	%r9, %rax
+	negq	%rax
+	testl	%r10d, %r10d
+	cmovne	%rax, %r9
+.LVL202:
+	.loc 1 1140 48 view .LVU635
+	jmp	.L186
+.LVL203:
+	.p2align 4,,10
+	.p2align 3
+.L211:
+	.loc 1 1140 48 view .LVU636
+.LBE217:
+	.loc 1 1101 7 view .LVU637
+	movl	$0, 8(%rsp)
+	movq	%rdi, %r12
+	movq	%rdi, %rbp
+.LVL204:
+.LBB218:
+.LBB207:
+	.loc 1 803 12 view .LVU638
+	xorl	%esi, %esi
+.LVL205:
+	.loc 1 816 3 is_stmt 1 view .LVU639
+	.loc 1 817 3 view .LVU640
+	.loc 1 817 3 is_stmt 0 view .LVU641
+.LBE207:
+.LBE218:
+	.loc 1 1110 3 is_stmt 1 view .LVU642
+.L178:
+.LBB219:
+.LBB208:
+	.loc 1 816 3 view .LVU643
+	.loc 1 817 3 view .LVU644
+	.loc 1 817 3 is_stmt 0 view .LVU645
+.LBE208:
+.LBE219:
+	.loc 1 1110 3 is_stmt 1 view .LVU646
+	.loc 1 1110 11 is_stmt 0 view .LVU647
+	movq	%rbp, %rdx
+	subq	%r12, %rdx
+.LVL206:
+	.loc 1 1111 3 is_stmt 1 view .LVU648
+	.loc 1 1112 3 view .LVU649
+	.loc 1 1110 11 is_stmt 0 view .LVU650
+	movq	%rdx, %r8
+.L180:
+	.loc 1 1118 3 is_stmt 1 view .LVU651
+	.loc 1 1120 12 is_stmt 0 view .LVU652
+	xorl	%eax, %eax
+	.loc 1 1118 6 view .LVU653
+	testq	%rdx, %rdx
+	je	.L171
+	.loc 1 1118 6 view .LVU654
+	movq	%rbp, %rbx
+	xorl	%edi, %edi
+	.loc 1 1124 11 view .LVU655
+	xorl	%r9d, %r9d
+.LVL207:
+.L186:
+	.loc 1 1147 3 is_stmt 1 view .LVU656
+	.loc 1 1148 3 view .LVU657
+	.loc 1 1149 3 view .LVU658
+	.loc 1 1149 37 view .LVU659
+	.loc 1 1148 11 is_stmt 0 view .LVU660
+	xorl	%ecx, %ecx
+	.loc 1 1149 37 view .LVU661
+	cmpq	%rbx, %r12
+	jb	.L196
+	jmp	.L197
+.LVL208:
+	.p2align 4,,10
+	.p2align 3
+.L199:
+	.loc 1 1150 5 is_stmt 1 view .LVU662
+	.loc 1 1150 35 is_stmt 0 view .LVU663
+	movzbl	%r10b, %r10d
+	.loc 1 1151 16 view .LVU664
+	incq	%r12
+.LVL209:
+	.loc 1 1150 19 view .LVU665
+	addq	%r10, %rcx
+.LVL210:
+	.loc 1 1151 5 is_stmt 1 view .LVU666
+	.loc 1 1149 37 view .LVU667
+	cmpq	%rbx, %r12
+	je	.L198
+.LVL211:
+.L196:
+	.loc 1 1149 41 is_stmt 0 discriminator 1 view .LVU668
+	movzbl	(%r12), %eax
+	.loc 1 1149 61 discriminator 1 view .LVU669
+	cmpb	$48, %al
+	sete	%r10b
+	subl	$46, %eax
+	.loc 1 1149 37 discriminator 1 view .LVU670
+	testb	$-3, %al
+	je	.L199
+.L198:
+	.loc 1 1153 3 is_stmt 1 view .LVU671
+.LVL212:
+	.loc 1 1154 3 view .LVU672
+	.loc 1 1155 3 view .LVU673
+	.loc 1 1154 12 is_stmt 0 view .LVU674
+	xorl	%r14d, %r14d
+	.loc 1 1155 6 view .LVU675
+	subq	%rcx, %r8
+.LVL213:
+	.loc 1 1155 6 view .LVU676
+	jne	.L197
+.LVL214:
+.L200:
+	.loc 1 1188 3 is_stmt 1 view .LVU677
+	.loc 1 1189 3 view .LVU678
+	.loc 1 1188 30 is_stmt 0 view .LVU679
+	movq	8(%rsp), %rax
+	.loc 1 1188 8 view .LVU680
+	movq	(%rsp), %rdi
+	.loc 1 1188 30 view .LVU681
+	salq	$63, %rax
+	.loc 1 1188 8 view .LVU682
+	orq	%r14, %rax
+	movq	%rax, (%rdi)
+	.loc 1 1190 3 is_stmt 1 view .LVU683
+	.loc 1 1190 21 is_stmt 0 view .LVU684
+	movq	%rbp, %rax
+	subq	%r13, %rax
+.LVL215:
+.L171:
+	.loc 1 1191 1 view .LVU685
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL216:
+	.loc 1 1191 1 view .LVU686
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL217:
+	.p2align 4,,10
+	.p2align 3
+.L257:
+	.cfi_restore_state
+	.loc 1 1103 5 is_stmt 1 view .LVU687
+	.loc 1 1102 29 is_stmt 0 view .LVU688
+	cmpb	$45, %al
+	.loc 1 1103 14 view .LVU689
+	sete	%al
+	movzbl	%al, %eax
+	movl	%eax, 8(%rsp)
+.LVL218:
+	.loc 1 1104 5 is_stmt 1 view .LVU690
+	.loc 1 1104 6 is_stmt 0 view .LVU691
+	leaq	1(%rdi), %r12
+.LVL219:
+	.loc 1 1104 6 view .LVU692
+	jmp	.L173
+.LVL220:
+.L190:
+.LBB220:
+.LBB216:
+	.loc 1 756 19 is_stmt 1 discriminator 1 view .LVU693
+.LBB213:
+	.loc 1 757 3 discriminator 1 view .LVU694
+	.loc 1 757 10 is_stmt 0 discriminator 1 view .LVU695
+	subl	$48, %eax
+.LBE213:
+.LBE216:
+	.loc 1 1133 17 discriminator 1 view .LVU696
+	cmpb	$9, %al
+	jbe	.L260
+.LVL221:
+	.p2align 4,,10
+	.p2align 3
+.L224:
+	.loc 1 1133 17 discriminator 1 view .LVU697
+	movq	%rbx, %rbp
+.LVL222:
+	.loc 1 1133 17 discriminator 1 view .LVU698
+.LBE220:
+	.loc 1 1124 11 view .LVU699
+	xorl	%r9d, %r9d
+	jmp	.L186
+.LVL223:
+	.p2align 4,,10
+	.p2align 3
+.L197:
+	.loc 1 1158 8 is_stmt 1 view .LVU700
+	.loc 1 1158 11 is_stmt 0 view .LVU701
+	cmpq	$19, %r8
+	jg	.L228
+.LBB221:
+	.loc 1 1159 5 is_stmt 1 view .LVU702
+	.loc 1 1159 13 is_stmt 0 view .LVU703
+	movq	%r9, %rax
+	subq	%rdi, %rax
+.LVL224:
+	.loc 1 1160 5 is_stmt 1 view .LVU704
+	.loc 1 1160 18 is_stmt 0 view .LVU705
+	leaq	22(%rax), %rdx
+	.loc 1 1160 8 view .LVU706
+	cmpq	$44, %rdx
+	ja	.L202
+	.loc 1 1160 29 discriminator 1 view .LVU707
+	movabsq	$9007199254740992, %rdx
+	cmpq	%rsi, %rdx
+	jnb	.L261
+.L203:
+.LBB222:
+.LBB223:
+	.loc 1 1160 29 discriminator 1 view .LVU708
+	movq	%rax, %rdi
+	call	numeric_parser_eisel_lemire.part.0
+.LVL225:
+	.loc 1 1160 29 discriminator 1 view .LVU709
+	movq	%rax, %r14
+	jmp	.L200
+.LVL226:
+	.p2align 4,,10
+	.p2align 3
+.L228:
+	.loc 1 1160 29 discriminator 1 view .LVU710
+.LBE223:
+.LBE222:
+.LBE221:
+	movq	%r12, %rsi
+.LVL227:
+.LBB232:
+	.loc 1 1172 9 view .LVU711
+	xorl	%edi, %edi
+	.loc 1 1171 14 view .LVU712
+	xorl	%r15d, %r15d
+.LVL228:
+	.p2align 4,,10
+	.p2align 3
+.L201:
+.LBB233:
+	.loc 1 1174 7 is_stmt 1 view .LVU713
+	.loc 1 1174 11 is_stmt 0 view .LVU714
+	movsbl	(%rsi), %eax
+	.loc 1 1174 10 view .LVU715
+	cmpb	$46, %al
+	je	.L207
+	.loc 1 1175 9 is_stmt 1 view .LVU716
+	.loc 1 1175 40 is_stmt 0 view .LVU717
+	subl	$48, %eax
+	.loc 1 1175 15 view .LVU718
+	leaq	(%r15,%r15,4), %r8
+	.loc 1 1175 22 view .LVU719
+	cltq
+	.loc 1 1176 14 view .LVU720
+	incl	%edi
+.LVL229:
+	.loc 1 1175 11 view .LVU721
+	leaq	(%rax,%r8,2), %r15
+.LVL230:
+	.loc 1 1176 9 is_stmt 1 view .LVU722
+	.loc 1 1173 60 view .LVU723
+	incq	%rsi
+.LVL231:
+	.loc 1 1173 49 view .LVU724
+	cmpl	$19, %edi
+	jne	.L201
+.LBE233:
+	.loc 1 1180 5 view .LVU725
+	.loc 1 1180 45 is_stmt 0 view .LVU726
+	subq	%rcx, %rdx
+	.loc 1 1180 13 view .LVU727
+	addq	%r9, %rdx
+.LVL232:
+	.loc 1 1181 5 is_stmt 1 view .LVU728
+	.loc 1 1181 13 is_stmt 0 view .LVU729
+	leaq	-19(%rdx), %rdi
+.LVL233:
+	.loc 1 1181 13 view .LVU730
+	movq	%rdx, 24(%rsp)
+.LVL234:
+	.loc 1 1182 5 is_stmt 1 view .LVU731
+.LBB234:
+.LBI234:
+	.loc 1 834 17 view .LVU732
+.LBB235:
+	.loc 1 835 3 view .LVU733
+.LBE235:
+.LBE234:
+.LBE232:
+	.loc 1 1154 12 is_stmt 0 view .LVU734
+	xorl	%r14d, %r14d
+.LBB247:
+.LBB239:
+.LBB236:
+	.loc 1 835 6 view .LVU735
+	cmpq	$-342, %rdi
+	jl	.L200
+	.loc 1 838 3 is_stmt 1 view .LVU736
+.LBE236:
+.LBE239:
+.LBE247:
+.LBB248:
+.LBB227:
+.LBB224:
+	.loc 1 839 12 is_stmt 0 view .LVU737
+	movabsq	$9218868437227405312, %r14
+.LBE224:
+.LBE227:
+.LBE248:
+.LBB249:
+.LBB240:
+.LBB237:
+	.loc 1 838 6 view .LVU738
+	cmpq	$308, %rdi
+	jg	.L200
+	movq	%r15, %rsi
+.LVL235:
+	.loc 1 838 6 view .LVU739
+	movq	%rdi, 16(%rsp)
+	call	numeric_parser_eisel_lemire.part.0
+.LVL236:
+	.loc 1 838 6 view .LVU740
+.LBE237:
+.LBE240:
+.LBB241:
+.LBB242:
+	movq	16(%rsp), %rdi
+.LBE242:
+.LBE241:
+	.loc 1 1183 17 view .LVU741
+	leaq	1(%r15), %rsi
+.LBB244:
+.LBB238:
+	movq	%rax, %r14
+.LVL237:
+	.loc 1 1183 17 view .LVU742
+.LBE238:
+.LBE244:
+	.loc 1 1183 5 is_stmt 1 view .LVU743
+.LBB245:
+.LBI241:
+	.loc 1 834 17 view .LVU744
+.LBB243:
+	.loc 1 835 3 view .LVU745
+	.loc 1 838 3 view .LVU746
+	call	numeric_parser_eisel_lemire.part.0
+.LVL238:
+	.loc 1 838 3 is_stmt 0 view .LVU747
+.LBE243:
+.LBE245:
+	.loc 1 1183 8 view .LVU748
+	cmpq	%r14, %rax
+	je	.L200
+	.loc 1 1184 7 is_stmt 1 view .LVU749
+	.loc 1 1184 14 is_stmt 0 view .LVU750
+	movq	24(%rsp), %rdx
+	movq	%r14, %rcx
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	numeric_parser_slow_path
+.LVL239:
+	movq	%rax, %r14
+.LVL240:
+	.loc 1 1184 14 view .LVU751
+	jmp	.L200
+.LVL241:
+	.p2align 4,,10
+	.p2align 3
+.L207:
+.LBB246:
+	.loc 1 1173 60 is_stmt 1 view .LVU752
+	incq	%rsi
+.LVL242:
+	.loc 1 1173 49 view .LVU753
+	jmp	.L201
+.LVL243:
+	.p2align 4,,10
+	.p2align 3
+.L259:
+	.loc 1 1173 49 is_stmt 0 view .LVU754
+.LBE246:
+.LBE249:
+.LBB250:
+	.loc 1 1113 5 is_stmt 1 view .LVU755
+	.loc 1 1113 6 is_stmt 0 view .LVU756
+	leaq	1(%rbx), %rax
+.LVL244:
+	.loc 1 1114 5 is_stmt 1 view .LVU757
+	.loc 1 1115 5 view .LVU758
+.LBB251:
+.LBI251:
+	.loc 1 802 27 view .LVU759
+.LBB252:
+	.loc 1 803 3 view .LVU760
+	.loc 1 804 3 view .LVU761
+	.loc 1 804 18 view .LVU762
+	.loc 1 804 14 is_stmt 0 view .LVU763
+	movq	%rbp, %rcx
+	subq	%rax, %rcx
+	.loc 1 804 18 view .LVU764
+	movq	%rax, %rbx
+	cmpq	$7, %rcx
+	jle	.L182
+.LBB253:
+.LBB254:
+.LBB255:
+	.loc 1 786 43 view .LVU765
+	movq	%rdx, 16(%rsp)
+.LBE255:
+.LBE254:
+.LBB260:
+.LBB261:
+	.loc 1 777 19 view .LVU766
+	movabsq	$5063812098665367110, %r9
+	.loc 1 777 53 view .LVU767
+	movabsq	$-3472328296227680304, %r8
+.LBE261:
+.LBE260:
+.LBB263:
+.LBB256:
+	.loc 1 784 19 view .LVU768
+	movabsq	$1085102592571150095, %r11
+	.loc 1 785 19 view .LVU769
+	movabsq	$71777214294589695, %r10
+	.loc 1 786 18 view .LVU770
+	movabsq	$281470681808895, %r14
+	.loc 1 786 43 view .LVU771
+	movabsq	$42949672960001, %r15
+	jmp	.L187
+.LVL245:
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	.loc 1 786 43 view .LVU772
+.LBE256:
+.LBE263:
+	.loc 1 809 5 is_stmt 1 view .LVU773
+.LBB264:
+.LBB257:
+	.loc 1 784 19 is_stmt 0 view .LVU774
+	andq	%r11, %rdx
+.LVL246:
+	.loc 1 784 44 view .LVU775
+	imulq	$2561, %rdx, %rdx
+.LBE257:
+.LBE264:
+	.loc 1 809 19 view .LVU776
+	imulq	$100000000, %rsi, %rsi
+.LVL247:
+.LBB265:
+.LBI254:
+	.loc 1 783 24 is_stmt 1 view .LVU777
+.LBB258:
+	.loc 1 784 3 view .LVU778
+	.loc 1 785 3 view .LVU779
+.LBE258:
+.LBE265:
+	.loc 1 810 7 is_stmt 0 view .LVU780
+	addq	$8, %rbx
+.LVL248:
+.LBB266:
+.LBB259:
+	.loc 1 784 9 view .LVU781
+	shrq	$8, %rdx
+	.loc 1 785 19 view .LVU782
+	andq	%r10, %rdx
+	.loc 1 785 44 view .LVU783
+	imulq	$6553601, %rdx, %rdx
+.LVL249:
+	.loc 1 786 3 is_stmt 1 view .LVU784
+	.loc 1 785 9 is_stmt 0 view .LVU785
+	shrq	$16, %rdx
+	.loc 1 786 18 view .LVU786
+	andq	%r14, %rdx
+	.loc 1 786 43 view .LVU787
+	imulq	%r15, %rdx
+	.loc 1 786 74 view .LVU788
+	shrq	$32, %rdx
+.LBE259:
+.LBE266:
+	.loc 1 809 11 view .LVU789
+	addq	%rdx, %rsi
+.LVL250:
+	.loc 1 810 5 is_stmt 1 view .LVU790
+	.loc 1 810 5 is_stmt 0 view .LVU791
+.LBE253:
+	.loc 1 804 18 is_stmt 1 view .LVU792
+	.loc 1 804 14 is_stmt 0 view .LVU793
+	movq	%rbp, %rdx
+	subq	%rbx, %rdx
+	.loc 1 804 18 view .LVU794
+	cmpq	$7, %rdx
+	jle	.L256
+.LVL251:
+.L187:
+.LBB270:
+	.loc 1 805 5 is_stmt 1 view .LVU795
+.LBB267:
+.LBI267:
+	.loc 1 763 24 view .LVU796
+.LBB268:
+	.loc 1 764 3 view .LVU797
+	.loc 1 765 3 view .LVU798
+	movq	(%rbx), %rdx
+.LVL252:
+	.loc 1 769 3 view .LVU799
+	.loc 1 769 3 is_stmt 0 view .LVU800
+.LBE268:
+.LBE267:
+	.loc 1 806 5 is_stmt 1 view .LVU801
+.LBB269:
+.LBI260:
+	.loc 1 775 19 view .LVU802
+.LBB262:
+	.loc 1 777 3 view .LVU803
+	.loc 1 777 53 is_stmt 0 view .LVU804
+	leaq	(%rdx,%r8), %rdi
+	.loc 1 777 19 view .LVU805
+	leaq	(%rdx,%r9), %rcx
+	.loc 1 777 44 view .LVU806
+	orq	%rdi, %rcx
+.LBE262:
+.LBE269:
+	.loc 1 806 8 view .LVU807
+	movabsq	$-9187201950435737472, %rdi
+	testq	%rdi, %rcx
+	je	.L183
+.LVL253:
+.L256:
+	.loc 1 806 8 view .LVU808
+.LBE270:
+	movq	16(%rsp), %rdx
+.LVL254:
+.L182:
+	.loc 1 812 18 is_stmt 1 view .LVU809
+	cmpq	%rbp, %rbx
+	jb	.L184
+	.loc 1 812 18 is_stmt 0 view .LVU810
+	jmp	.L262
+	.p2align 4,,10
+	.p2align 3
+.L189:
+	.loc 1 813 5 is_stmt 1 view .LVU811
+	.loc 1 813 40 is_stmt 0 view .LVU812
+	subl	$48, %ecx
+	.loc 1 813 19 view .LVU813
+	leaq	(%rsi,%rsi,4), %rsi
+.LVL255:
+	.loc 1 813 26 view .LVU814
+	movslq	%ecx, %rcx
+	.loc 1 814 6 view .LVU815
+	incq	%rbx
+.LVL256:
+	.loc 1 813 11 view .LVU816
+	leaq	(%rcx,%rsi,2), %rsi
+.LVL257:
+	.loc 1 814 5 is_stmt 1 view .LVU817
+	.loc 1 812 18 view .LVU818
+	cmpq	%rbx, %rbp
+	je	.L188
+.L184:
+	.loc 1 812 45 is_stmt 0 view .LVU819
+	movsbl	(%rbx), %ecx
+	movl	%ecx, %edi
+.LVL258:
+.LBB271:
+.LBI271:
+	.loc 1 756 19 is_stmt 1 view .LVU820
+.LBB272:
+	.loc 1 757 3 view .LVU821
+	.loc 1 757 10 is_stmt 0 view .LVU822
+	subl	$48, %edi
+.LBE272:
+.LBE271:
+	.loc 1 812 18 view .LVU823
+	cmpb	$9, %dil
+	jbe	.L189
+.L188:
+	.loc 1 816 3 is_stmt 1 view .LVU824
+.LVL259:
+	.loc 1 817 3 view .LVU825
+	.loc 1 817 3 is_stmt 0 view .LVU826
+.LBE252:
+.LBE251:
+	.loc 1 1116 5 is_stmt 1 view .LVU827
+	.loc 1 1116 21 is_stmt 0 view .LVU828
+	movq	%rbx, %rdi
+	subq	%rax, %rdi
+.LVL260:
+	.loc 1 1116 21 view .LVU829
+.LBE250:
+	.loc 1 1118 3 is_stmt 1 view .LVU830
+	.loc 1 1118 6 is_stmt 0 view .LVU831
+	movq	%rdx, %r8
+	.loc 1 1120 12 view .LVU832
+	xorl	%eax, %eax
+.LVL261:
+	.loc 1 1118 6 view .LVU833
+	addq	%rdi, %r8
+	je	.L171
+	.loc 1 1122 3 is_stmt 1 view .LVU834
+.LVL262:
+	.loc 1 1124 3 view .LVU835
+	.loc 1 1125 3 view .LVU836
+	.loc 1 1125 6 is_stmt 0 view .LVU837
+	cmpq	%rbp, %rbx
+	jnb	.L224
+	.loc 1 1125 19 view .LVU838
+	movzbl	(%rbx), %ecx
+	jmp	.L210
+.LVL263:
+.L202:
+.LBB275:
+	.loc 1 1167 5 is_stmt 1 view .LVU839
+.LBB228:
+.LBI222:
+	.loc 1 834 17 view .LVU840
+.LBB225:
+	.loc 1 835 3 view .LVU841
+.LBE225:
+.LBE228:
+.LBE275:
+	.loc 1 1154 12 is_stmt 0 view .LVU842
+	xorl	%r14d, %r14d
+.LBB276:
+.LBB229:
+.LBB226:
+	.loc 1 835 6 view .LVU843
+	cmpq	$-342, %rax
+	jl	.L200
+	.loc 1 838 3 is_stmt 1 view .LVU844
+	.loc 1 839 12 is_stmt 0 view .LVU845
+	movabsq	$9218868437227405312, %r14
+	.loc 1 838 6 view .LVU846
+	cmpq	$308, %rax
+	jg	.L200
+	jmp	.L203
+.LVL264:
+.L260:
+	.loc 1 838 6 view .LVU847
+.LBE226:
+.LBE229:
+.LBE276:
+.LBB277:
+	.loc 1 1128 9 view .LVU848
+	xorl	%r10d, %r10d
+	jmp	.L191
+.LVL265:
+.L261:
+	.loc 1 1128 9 view .LVU849
+.LBE277:
+.LBB278:
+.LBB230:
+	.loc 1 1162 7 is_stmt 1 view .LVU850
+	vxorps	%xmm0, %xmm0, %xmm0
+	.loc 1 1162 14 is_stmt 0 view .LVU851
+	vcvtsi2sdq	%rsi, %xmm0, %xmm0
+.LVL266:
+	.loc 1 1163 7 is_stmt 1 view .LVU852
+	.loc 1 1163 65 is_stmt 0 view .LVU853
+	testq	%rax, %rax
+	js	.L263
+	.loc 1 1163 103 discriminator 2 view .LVU854
+	leaq	numeric_parser_power_of_ten(%rip), %rdx
+	.loc 1 1163 65 discriminator 2 view .LVU855
+	vmulsd	(%rdx,%rax,8), %xmm0, %xmm0
+.LVL267:
+.L205:
+	.loc 1 1164 7 is_stmt 1 discriminator 4 view .LVU856
+	.loc 1 1164 35 is_stmt 0 discriminator 4 view .LVU857
+	movl	8(%rsp), %eax
+	testl	%eax, %eax
+	je	.L206
+	.loc 1 1164 35 discriminator 1 view .LVU858
+	vxorpd	.LC3(%rip), %xmm0, %xmm0
+.LVL268:
+.L206:
+	.loc 1 1164 14 discriminator 4 view .LVU859
+	movq	(%rsp), %rax
+	vmovsd	%xmm0, (%rax)
+	.loc 1 1165 7 is_stmt 1 discriminator 4 view .LVU860
+	.loc 1 1165 25 is_stmt 0 discriminator 4 view .LVU861
+	movq	%rbp, %rax
+	subq	%r13, %rax
+	.loc 1 1165 14 discriminator 4 view .LVU862
+	jmp	.L171
+.LVL269:
+.L258:
+	.loc 1 1165 14 discriminator 4 view .LVU863
+.LBE230:
+.LBE278:
+.LBB279:
+.LBB209:
+	.loc 1 812 18 view .LVU864
+	movq	%rbx, %rbp
+.LVL270:
+	.loc 1 812 18 view .LVU865
+	jmp	.L178
+.LVL271:
+.L263:
+	.loc 1 812 18 view .LVU866
+.LBE209:
+.LBE279:
+.LBB280:
+.LBB231:
+	.loc 1 1163 61 discriminator 1 view .LVU867
+	subq	%r9, %rdi
+	.loc 1 1163 65 discriminator 1 view .LVU868
+	leaq	numeric_parser_power_of_ten(%rip), %rax
+.LVL272:
+	.loc 1 1163 65 discriminator 1 view .LVU869
+	vdivsd	(%rax,%rdi,8), %xmm0, %xmm0
+.LVL273:
+	.loc 1 1163 65 discriminator 1 view .LVU870
+	jmp	.L205
+.LVL274:
+.L262:
+	.loc 1 1163 65 discriminator 1 view .LVU871
+.LBE231:
+.LBE280:
+.LBB281:
+.LBB274:
+.LBB273:
+	.loc 1 816 3 is_stmt 1 view .LVU872
+	.loc 1 817 3 view .LVU873
+	.loc 1 817 3 is_stmt 0 view .LVU874
+.LBE273:
+.LBE274:
+	.loc 1 1116 5 is_stmt 1 view .LVU875
+	.loc 1 1116 21 is_stmt 0 view .LVU876
+	movq	%rbx, %rdi
+	subq	%rax, %rdi
+.LVL275:
+	.loc 1 1116 21 view .LVU877
+.LBE281:
+	.loc 1 1118 3 is_stmt 1 view .LVU878
+	.loc 1 1118 6 is_stmt 0 view .LVU879
+	movq	%rdx, %r8
+	.loc 1 1120 12 view .LVU880
+	xorl	%eax, %eax
+.LVL276:
+	.loc 1 1118 6 view .LVU881
+	addq	%rdi, %r8
+	jne	.L224
+	jmp	.L171
+.LVL277:
+.L214:
+	.loc 1 1110 11 view .LVU882
+	movq	%rdx, %r8
+	movq	%rbx, %rbp
+.LVL278:
+	.loc 1 1110 11 view .LVU883
+	jmp	.L180
+	.cfi_endproc
+.LFE39:
+	.size	stod, .-stod
+	.p2align 4
+	.globl	stoi64
+	.type	stoi64, @function
+stoi64:
+.LVL279:
+.LFB40:
+	.loc 1 1196 72 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1197 3 view .LVU885
+	.loc 1 1198 3 view .LVU886
+	.loc 1 1198 15 is_stmt 0 view .LVU887
+	leaq	(%rdi,%rsi), %r8
+.LVL280:
+	.loc 1 1200 3 is_stmt 1 view .LVU888
+	.loc 1 1201 3 view .LVU889
+	.loc 1 1201 6 is_stmt 0 view .LVU890
+	cmpq	%r8, %rdi
+	jb	.L293
+.LVL281:
+	.loc 1 1215 12 view .LVU891
+	xorl	%eax, %eax
+	.loc 1 1224 1 view .LVU892
+	ret
+.LVL282:
+	.p2align 4,,10
+	.p2align 3
+.L293:
+	.loc 1 1196 72 discriminator 1 view .LVU893
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r9
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 1201 19 discriminator 1 view .LVU894
+	movzbl	(%rdi), %eax
+	.loc 1 1201 29 discriminator 1 view .LVU895
+	leal	-43(%rax), %ecx
+	.loc 1 1201 15 discriminator 1 view .LVU896
+	andl	$253, %ecx
+	jne	.L279
+	.loc 1 1202 5 is_stmt 1 view .LVU897
+	.loc 1 1202 14 is_stmt 0 view .LVU898
+	xorl	%r15d, %r15d
+	.loc 1 1203 6 view .LVU899
+	leaq	1(%rdi), %rsi
+.LVL283:
+	.loc 1 1202 14 view .LVU900
+	cmpb	$45, %al
+	sete	%r15b
+.LVL284:
+	.loc 1 1203 5 is_stmt 1 view .LVU901
+	.loc 1 1206 3 view .LVU902
+	.loc 1 1207 3 view .LVU903
+	.loc 1 1207 18 view .LVU904
+	cmpq	%r8, %rsi
+	jnb	.L265
+	.loc 1 1203 6 is_stmt 0 view .LVU905
+	movq	%rsi, 8(%rsp)
+.LVL285:
+	.loc 1 1203 6 view .LVU906
+	jmp	.L267
+.LVL286:
+	.p2align 4,,10
+	.p2align 3
+.L269:
+	.loc 1 1208 5 is_stmt 1 view .LVU907
+	.loc 1 1208 6 is_stmt 0 view .LVU908
+	incq	%rsi
+.LVL287:
+	.loc 1 1207 18 is_stmt 1 view .LVU909
+	cmpq	%rsi, %r8
+	je	.L294
+.LVL288:
+.L267:
+	.loc 1 1207 18 is_stmt 0 discriminator 1 view .LVU910
+	cmpb	$48, (%rsi)
+	je	.L269
+.LVL289:
+.LBB293:
+.LBB294:
+	.loc 1 804 18 is_stmt 1 view .LVU911
+	.loc 1 804 14 is_stmt 0 view .LVU912
+	movq	%r8, %rax
+	subq	%rsi, %rax
+	.loc 1 804 18 view .LVU913
+	cmpq	$7, %rax
+	movl	$0, %ecx
+	movq	%rsi, %rax
+	jle	.L268
+.LBB295:
+.LBB296:
+.LBB297:
+	.loc 1 786 43 view .LVU914
+	movl	%r15d, 20(%rsp)
+	movq	%rsi, 24(%rsp)
+.LBE297:
+.LBE296:
+.LBB302:
+.LBB303:
+	.loc 1 777 19 view .LVU915
+	movabsq	$5063812098665367110, %rbx
+	.loc 1 777 53 view .LVU916
+	movabsq	$-3472328296227680304, %r11
+	.loc 1 777 79 view .LVU917
+	movabsq	$-9187201950435737472, %r10
+.LBE303:
+.LBE302:
+.LBB305:
+.LBB298:
+	.loc 1 784 19 view .LVU918
+	movabsq	$1085102592571150095, %r14
+	.loc 1 785 19 view .LVU919
+	movabsq	$71777214294589695, %r13
+	.loc 1 786 18 view .LVU920
+	movabsq	$281470681808895, %r12
+	.loc 1 786 43 view .LVU921
+	movabsq	$42949672960001, %rbp
+	jmp	.L270
+.LVL290:
+	.p2align 4,,10
+	.p2align 3
+.L295:
+	.loc 1 786 43 view .LVU922
+.LBE298:
+.LBE305:
+	.loc 1 809 5 is_stmt 1 view .LVU923
+.LBB306:
+.LBB299:
+	.loc 1 784 19 is_stmt 0 view .LVU924
+	andq	%r14, %rsi
+.LVL291:
+	.loc 1 784 44 view .LVU925
+	imulq	$2561, %rsi, %rsi
+.LBE299:
+.LBE306:
+	.loc 1 809 19 view .LVU926
+	imulq	$100000000, %rcx, %rcx
+.LVL292:
+.LBB307:
+.LBI296:
+	.loc 1 783 24 is_stmt 1 view .LVU927
+.LBB300:
+	.loc 1 784 3 view .LVU928
+	.loc 1 785 3 view .LVU929
+.LBE300:
+.LBE307:
+	.loc 1 810 7 is_stmt 0 view .LVU930
+	addq	$8, %rax
+.LVL293:
+.LBB308:
+.LBB301:
+	.loc 1 784 9 view .LVU931
+	shrq	$8, %rsi
+	.loc 1 785 19 view .LVU932
+	andq	%r13, %rsi
+	.loc 1 785 44 view .LVU933
+	imulq	$6553601, %rsi, %rsi
+.LVL294:
+	.loc 1 786 3 is_stmt 1 view .LVU934
+	.loc 1 785 9 is_stmt 0 view .LVU935
+	shrq	$16, %rsi
+	.loc 1 786 18 view .LVU936
+	andq	%r12, %rsi
+	.loc 1 786 43 view .LVU937
+	imulq	%rbp, %rsi
+	.loc 1 786 74 view .LVU938
+	shrq	$32, %rsi
+.LBE301:
+.LBE308:
+	.loc 1 809 11 view .LVU939
+	addq	%rsi, %rcx
+.LVL295:
+	.loc 1 810 5 is_stmt 1 view .LVU940
+	.loc 1 810 5 is_stmt 0 view .LVU941
+.LBE295:
+	.loc 1 804 18 is_stmt 1 view .LVU942
+	.loc 1 804 14 is_stmt 0 view .LVU943
+	movq	%r8, %rsi
+	subq	%rax, %rsi
+	.loc 1 804 18 view .LVU944
+	cmpq	$7, %rsi
+	jle	.L286
+.LVL296:
+.L270:
+.LBB312:
+	.loc 1 805 5 is_stmt 1 view .LVU945
+.LBB309:
+.LBI309:
+	.loc 1 763 24 view .LVU946
+.LBB310:
+	.loc 1 764 3 view .LVU947
+	.loc 1 765 3 view .LVU948
+	movq	(%rax), %rsi
+.LVL297:
+	.loc 1 769 3 view .LVU949
+	.loc 1 769 3 is_stmt 0 view .LVU950
+.LBE310:
+.LBE309:
+	.loc 1 806 5 is_stmt 1 view .LVU951
+.LBB311:
+.LBI302:
+	.loc 1 775 19 view .LVU952
+.LBB304:
+	.loc 1 777 3 view .LVU953
+	.loc 1 777 19 is_stmt 0 view .LVU954
+	leaq	(%rsi,%rbx), %rdi
+	.loc 1 777 53 view .LVU955
+	leaq	(%rsi,%r11), %r15
+	.loc 1 777 44 view .LVU956
+	orq	%r15, %rdi
+.LBE304:
+.LBE311:
+	.loc 1 806 8 view .LVU957
+	testq	%r10, %rdi
+	je	.L295
+.LVL298:
+.L286:
+	.loc 1 806 8 view .LVU958
+	movl	20(%rsp), %r15d
+	movq	24(%rsp), %rsi
+.LVL299:
+.L268:
+	.loc 1 806 8 view .LVU959
+.LBE312:
+	.loc 1 812 18 is_stmt 1 view .LVU960
+	cmpq	%r8, %rax
+	jb	.L271
+	jmp	.L272
+	.p2align 4,,10
+	.p2align 3
+.L273:
+	.loc 1 813 5 view .LVU961
+	.loc 1 813 40 is_stmt 0 view .LVU962
+	subl	$48, %edi
+	.loc 1 813 19 view .LVU963
+	leaq	(%rcx,%rcx,4), %rcx
+.LVL300:
+	.loc 1 813 26 view .LVU964
+	movslq	%edi, %rdi
+	.loc 1 814 6 view .LVU965
+	incq	%rax
+.LVL301:
+	.loc 1 813 11 view .LVU966
+	leaq	(%rdi,%rcx,2), %rcx
+.LVL302:
+	.loc 1 814 5 is_stmt 1 view .LVU967
+	.loc 1 812 18 view .LVU968
+	cmpq	%rax, %r8
+	je	.L272
+.L271:
+	.loc 1 812 45 is_stmt 0 view .LVU969
+	movsbl	(%rax), %edi
+	movl	%edi, %r10d
+.LVL303:
+.LBB313:
+.LBI313:
+	.loc 1 756 19 is_stmt 1 view .LVU970
+.LBB314:
+	.loc 1 757 3 view .LVU971
+	.loc 1 757 10 is_stmt 0 view .LVU972
+	subl	$48, %r10d
+.LBE314:
+.LBE313:
+	.loc 1 812 18 view .LVU973
+	cmpb	$9, %r10b
+	jbe	.L273
+.L272:
+.LVL304:
+	.loc 1 816 3 is_stmt 1 view .LVU974
+	.loc 1 817 3 view .LVU975
+	.loc 1 817 3 is_stmt 0 view .LVU976
+.LBE294:
+.LBE293:
+	.loc 1 1213 3 is_stmt 1 view .LVU977
+	.loc 1 1213 6 is_stmt 0 view .LVU978
+	movq	8(%rsp), %rbx
+	cmpq	%rbx, %rax
+	je	.L265
+	.loc 1 1218 3 is_stmt 1 view .LVU979
+	.loc 1 1218 9 is_stmt 0 view .LVU980
+	movq	%rax, %rdi
+	subq	%rsi, %rdi
+	.loc 1 1218 6 view .LVU981
+	cmpq	$19, %rdi
+	jg	.L274
+	.loc 1 1218 91 discriminator 1 view .LVU982
+	testl	%r15d, %r15d
+	movabsq	$9223372036854775807, %rsi
+	movabsq	$-9223372036854775808, %rdi
+	cmovne	%rdi, %rsi
+	.loc 1 1218 28 discriminator 1 view .LVU983
+	cmpq	%rcx, %rsi
+	jb	.L274
+	.loc 1 1222 3 is_stmt 1 view .LVU984
+	.loc 1 1222 46 is_stmt 0 view .LVU985
+	movq	%rcx, %rsi
+	negq	%rsi
+	testl	%r15d, %r15d
+	cmove	%rcx, %rsi
+	.loc 1 1223 21 view .LVU986
+	subq	%r9, %rax
+.LVL305:
+	.loc 1 1222 10 view .LVU987
+	movq	%rsi, (%rdx)
+	.loc 1 1223 3 is_stmt 1 view .LVU988
+.LVL306:
+	.loc 1 1224 1 is_stmt 0 view .LVU989
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL307:
+	.p2align 4,,10
+	.p2align 3
+.L279:
+	.cfi_restore_state
+	.loc 1 1224 1 view .LVU990
+	movq	%rdi, 8(%rsp)
+	movq	%rdi, %rsi
+.LVL308:
+	.loc 1 1200 7 view .LVU991
+	xorl	%r15d, %r15d
+	jmp	.L267
+.LVL309:
+	.p2align 4,,10
+	.p2align 3
+.L274:
+	.loc 1 1219 4 is_stmt 1 view .LVU992
+	.loc 1 1219 6 is_stmt 0 view .LVU993
+	call	__errno_location@PLT
+.LVL310:
+	.loc 1 1219 10 view .LVU994
+	movl	$34, (%rax)
+	.loc 1 1220 5 is_stmt 1 view .LVU995
+.LVL311:
+.L265:
+	.loc 1 1224 1 is_stmt 0 view .LVU996
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	.loc 1 1215 12 view .LVU997
+	xorl	%eax, %eax
+	.loc 1 1224 1 view .LVU998
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL312:
+	.p2align 4,,10
+	.p2align 3
+.L294:
+	.cfi_restore_state
+	.loc 1 1208 6 view .LVU999
+	movq	%r8, %rax
+	xorl	%ecx, %ecx
+	jmp	.L268
+	.cfi_endproc
+.LFE40:
+	.size	stoi64, .-stoi64
+	.p2align 4
+	.globl	stod_batch
+	.type	stod_batch, @function
+stod_batch:
+.LVL313:
+.LFB41:
+	.loc 1 1229 87 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1230 3 view .LVU1001
+.LBB315:
+	.loc 1 1230 8 view .LVU1002
+	.loc 1 1230 24 view .LVU1003
+.LBE315:
+	.loc 1 1229 87 is_stmt 0 view .LVU1004
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+.LBB316:
+	.loc 1 1230 24 view .LVU1005
+	testq	%rsi, %rsi
+	je	.L300
+	movq	%rsi, %r12
+	movq	%rdx, %rbp
+	leaq	8(%rdi), %rbx
+	.loc 1 1230 15 view .LVU1006
+	xorl	%r13d, %r13d
+	jmp	.L299
+.LVL314:
+	.p2align 4,,10
+	.p2align 3
+.L306:
+	.loc 1 1232 30 discriminator 1 view .LVU1007
+	movq	-8(%rbx), %rdi
+	movq	%rbp, %rdx
+	call	stod@PLT
+.LVL315:
+	.loc 1 1232 27 discriminator 1 view .LVU1008
+	cmpq	(%rbx), %rax
+	jne	.L296
+	.loc 1 1230 34 is_stmt 1 discriminator 2 view .LVU1009
+	incq	%r13
+.LVL316:
+	.loc 1 1230 24 discriminator 2 view .LVU1010
+	addq	$8, %rbp
+	addq	$16, %rbx
+	cmpq	%r13, %r12
+	je	.L296
+.LVL317:
+.L299:
+	.loc 1 1232 5 view .LVU1011
+	.loc 1 1232 17 is_stmt 0 view .LVU1012
+	movq	(%rbx), %rsi
+	.loc 1 1232 8 view .LVU1013
+	testq	%rsi, %rsi
+	jne	.L306
+.LVL318:
+.L296:
+	.loc 1 1232 8 view .LVU1014
+.LBE316:
+	.loc 1 1237 1 view .LVU1015
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	movq	%r13, %rax
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL319:
+.L300:
+	.cfi_restore_state
+.LBB317:
+	.loc 1 1230 24 view .LVU1016
+	xorl	%r13d, %r13d
+	jmp	.L296
+.LBE317:
+	.cfi_endproc
+.LFE41:
+	.size	stod_batch, .-stod_batch
+	.p2align 4
+	.globl	stoi64_batch
+	.type	stoi64_batch, @function
+stoi64_batch:
+.LVL320:
+.LFB42:
+	.loc 1 1242 90 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1243 3 view .LVU1018
+.LBB318:
+	.loc 1 1243 8 view .LVU1019
+	.loc 1 1243 24 view .LVU1020
+.LBE318:
+	.loc 1 1242 90 is_stmt 0 view .LVU1021
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+.LBB319:
+	.loc 1 1243 24 view .LVU1022
+	testq	%rsi, %rsi
+	je	.L311
+	movq	%rsi, %r12
+	movq	%rdx, %rbp
+	leaq	8(%rdi), %rbx
+	.loc 1 1243 15 view .LVU1023
+	xorl	%r13d, %r13d
+	jmp	.L310
+.LVL321:
+	.p2align 4,,10
+	.p2align 3
+.L317:
+	.loc 1 1245 30 discriminator 1 view .LVU1024
+	movq	-8(%rbx), %rdi
+	movq	%rbp, %rdx
+	call	stoi64@PLT
+.LVL322:
+	.loc 1 1245 27 discriminator 1 view .LVU1025
+	cmpq	(%rbx), %rax
+	jne	.L307
+	.loc 1 1243 34 is_stmt 1 discriminator 2 view .LVU1026
+	incq	%r13
+.LVL323:
+	.loc 1 1243 24 discriminator 2 view .LVU1027
+	addq	$8, %rbp
+	addq	$16, %rbx
+	cmpq	%r13, %r12
+	je	.L307
+.LVL324:
+.L310:
+	.loc 1 1245 5 view .LVU1028
+	.loc 1 1245 17 is_stmt 0 view .LVU1029
+	movq	(%rbx), %rsi
+	.loc 1 1245 8 view .LVU1030
+	testq	%rsi, %rsi
+	jne	.L317
+.LVL325:
+.L307:
+	.loc 1 1245 8 view .LVU1031
+.LBE319:
+	.loc 1 1250 1 view .LVU1032
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	movq	%r13, %rax
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL326:
+.L311:
+	.cfi_restore_state
+.LBB320:
+	.loc 1 1243 24 view .LVU1033
+	xorl	%r13d, %r13d
+	jmp	.L307
+.LBE320:
+	.cfi_endproc
+.LFE42:
+	.size	stoi64_batch, .-stoi64_batch
+	.section	.rodata
+	.align 32
+	.type	numeric_parser_power_of_ten, @object
+	.size	numeric_parser_power_of_ten, 184
+numeric_parser_power_of_ten:
+	.long	0
+	.long	1072693248
+	.long	0
+	.long	1076101120
+	.long	0
+	.long	1079574528
+	.long	0
+	.long	1083129856
+	.long	0
+	.long	1086556160
+	.long	0
+	.long	1090021888
+	.long	0
+	.long	1093567616
+	.long	0
+	.long	1097011920
+	.long	0
+	.long	1100470148
+	.long	0
+	.long	1104006501
+	.long	536870912
+	.long	1107468383
+	.long	-402653184
+	.long	1110919286
+	.long	-1577058304
+	.long	1114446484
+	.long	-448790528
+	.long	1117925532
+	.long	512753664
+	.long	1121369284
+	.long	640942080
+	.long	1124887541
+	.long	937459712
+	.long	1128383353
+	.long	-2049400832
+	.long	1131820119
+	.long	1733216256
+	.long	1135329645
+	.long	1620131072
+	.long	1138841828
+	.long	2025163840
+	.long	1142271773
+	.long	-689770672
+	.long	1145772772
+	.long	105764242
+	.long	1149300943
+	.align 32
+	.type	numeric_parser_power_of_five, @object
+	.size	numeric_parser_power_of_five, 10416
+numeric_parser_power_of_five:
+	.quad	-1228264617323800998
+	.quad	1242899115359157055
+	.quad	-7685194413468457480
+	.quad	5388497965526861063
+	.quad	-4994806998408183946
+	.quad	6735622456908576329
+	.quad	-1631822729582842029
+	.quad	-803843965719055396
+	.quad	-7937418233630358124
+	.quad	8720969558280366185
+	.quad	-5310086773610559751
+	.quad	-7545532125859093884
+	.quad	-2025922448585811785
+	.quad	-208543120469091547
+	.quad	-8183730558007214222
+	.quad	-130339450293182217
+	.quad	-5617977179081629873
+	.quad	-4774610331293865675
+	.quad	-2410785455424649437
+	.quad	-5968262914117332094
+	.quad	-8424269937281487754
+	.quad	5493207715531443249
+	.quad	-5918651403174471789
+	.quad	-2356862392440471747
+	.quad	-2786628235540701832
+	.quad	-2946077990550589683
+	.quad	-8659171674854020501
+	.quad	-8758827771735200408
+	.quad	-6212278575140137722
+	.quad	7498209359040551106
+	.quad	-3153662200497784248
+	.quad	149389661945913074
+	.quad	-8888567902952197011
+	.quad	93368538716195671
+	.quad	-6499023860262858360
+	.quad	4728396691822632493
+	.quad	-3512093806901185046
+	.quad	5910495864778290617
+	.quad	-9112587656954322510
+	.quad	8305745933913819539
+	.quad	-6779048552765515233
+	.quad	1158810380537498616
+	.quad	-3862124672529506138
+	.quad	-3163173042755514634
+	.quad	-215969822234494768
+	.quad	-8565652321871781196
+	.quad	-7052510166537641086
+	.quad	6175682344898606512
+	.quad	-4203951689744663454
+	.quad	-1503769105731517667
+	.quad	-643253593753441413
+	.quad	-6491397400591784988
+	.quad	-7319562523736982739
+	.quad	5166248661484910190
+	.quad	-4537767136243840520
+	.quad	-7377247228426025974
+	.quad	-1060522901877412746
+	.quad	-4609873017105144563
+	.quad	-7580355841314464822
+	.quad	4036358391950366504
+	.quad	-4863758783215693124
+	.quad	-4177924046916817678
+	.quad	-1468012460592228501
+	.quad	-610719040218634194
+	.quad	-7835036815511224669
+	.quad	8841672636718129437
+	.quad	-5182110000961642932
+	.quad	6440404777470273892
+	.quad	-1865951482774665761
+	.quad	8050505971837842365
+	.quad	-8083748704375247957
+	.quad	-6497648813669818282
+	.quad	-5492999862041672042
+	.quad	-8122061017087272852
+	.quad	-2254563809124702148
+	.quad	3682481783923072647
+	.quad	-8326631408344020699
+	.quad	-6921820921902855404
+	.quad	-5796603242002637969
+	.quad	571095884476206553
+	.quad	-2634068034075909558
+	.quad	-3897816162832129712
+	.quad	-8563821548938525330
+	.quad	-4741978110983775022
+	.quad	-6093090917745768758
+	.quad	7907585416552444934
+	.quad	-3004677628754823043
+	.quad	661109733835780360
+	.quad	-8795452545612846258
+	.quad	2719036592861056677
+	.quad	-6382629663588669919
+	.quad	-5824576295778454962
+	.quad	-3366601061058449494
+	.quad	1942651667131707105
+	.quad	-9021654690802612790
+	.quad	5825843310384704845
+	.quad	-6665382345075878084
+	.quad	-1941067898873894752
+	.quad	-3720041912917459700
+	.quad	2185351144835019464
+	.quad	-38366372719436721
+	.quad	2731688931043774330
+	.quad	-6941508010590729807
+	.quad	8624834609543440812
+	.quad	-4065198994811024355
+	.quad	-3054014793352862697
+	.quad	-469812725086392539
+	.quad	5405853545163697437
+	.quad	-7211161980820077193
+	.quad	5684501474941004850
+	.quad	-4402266457597708587
+	.quad	2493940825248868159
+	.quad	-891147053569747830
+	.quad	7729112049988473103
+	.quad	-7474495936122174250
+	.quad	-9004363024039368023
+	.quad	-4731433901725329908
+	.quad	2579604275232953683
+	.quad	-1302606358729274481
+	.quad	3224505344041192104
+	.quad	-7731658001846878407
+	.quad	8932844867666826921
+	.quad	-5052886483881210105
+	.quad	-2669001970698630061
+	.quad	-1704422086424124727
+	.quad	-3336252463373287576
+	.quad	-7982792831656159810
+	.quad	2526528228819083169
+	.quad	-5366805021142811859
+	.quad	-6065211750830921846
+	.quad	-2096820258001126919
+	.quad	1641857348316123500
+	.quad	-8228041688891786181
+	.quad	-5891368184943504669
+	.quad	-5673366092687344822
+	.quad	-7364210231179380836
+	.quad	-2480021597431793123
+	.quad	4629795266307937667
+	.quad	-8467542526035952558
+	.quad	5199465050656154994
+	.quad	-5972742139117552794
+	.quad	-2724040723534582065
+	.quad	-2854241655469553088
+	.quad	-8016736922845615486
+	.quad	-8701430062309552536
+	.quad	6518754469289960081
+	.quad	-6265101559459552766
+	.quad	8148443086612450102
+	.quad	-3219690930897053053
+	.quad	962181821410786819
+	.quad	-8929835859451740015
+	.quad	-1704479370831952190
+	.quad	-6550608805887287114
+	.quad	7092772823314835570
+	.quad	-3576574988931720989
+	.quad	-357406007711231345
+	.quad	-9152888395723407474
+	.quad	8999993282035256217
+	.quad	-6829424476226871438
+	.quad	2026619565689294464
+	.quad	-3925094576856201394
+	.quad	-6690097579743157728
+	.quad	-294682202642863838
+	.quad	5472436080603216552
+	.quad	-7101705404292871755
+	.quad	8031958568804398249
+	.quad	-4265445736938701790
+	.quad	-3795109844276665901
+	.quad	-720121152745989333
+	.quad	9091170749936331336
+	.quad	-7367604748107325189
+	.quad	3376138709496513133
+	.quad	-4597819916706768583
+	.quad	-391512631556746488
+	.quad	-1135588877456072824
+	.quad	8733981247408842698
+	.quad	-7627272076051127371
+	.quad	5458738279630526686
+	.quad	-4922404076636521310
+	.quad	-7011635205744005354
+	.quad	-1541319077368263733
+	.quad	5070514048102157020
+	.quad	-7880853450996246689
+	.quad	863228270850154185
+	.quad	-5239380795317920458
+	.quad	-3532650679864695173
+	.quad	-1937539975720012668
+	.quad	-9027499368258256870
+	.quad	-8128491512466089774
+	.quad	-3336344095947716592
+	.quad	-5548928372155224313
+	.quad	-8782116138362033643
+	.quad	-2324474446766642487
+	.quad	7469098900757009562
+	.quad	-8370325556870233411
+	.quad	-2249342214667950880
+	.quad	-5851220927660403859
+	.quad	6411694268519837208
+	.quad	-2702340141148116920
+	.quad	-5820440219632367202
+	.quad	-8606491615858654931
+	.quad	7891439908798240259
+	.quad	-6146428501395930760
+	.quad	-3970758169284363389
+	.quad	-3071349608317525546
+	.quad	-351761693178066332
+	.quad	-8837122532839535322
+	.quad	6697677969404790399
+	.quad	-6434717147622031249
+	.quad	-851274575098787810
+	.quad	-3431710416100151157
+	.quad	-1064093218873484762
+	.quad	-9062348037703676329
+	.quad	8558313775058847832
+	.quad	-6716249028702207507
+	.quad	6086206200396171886
+	.quad	-3783625267450371480
+	.quad	-6227300304786948855
+	.quad	-117845565885576446
+	.quad	-3172439362556298164
+	.quad	-6991182506319567135
+	.quad	-4288617610811380305
+	.quad	-4127292114472071014
+	.quad	3862600023340550427
+	.quad	-547429124662700864
+	.quad	-4395122007679087774
+	.quad	-7259672230555269896
+	.quad	8782263791269039901
+	.quad	-4462904269766699466
+	.quad	-7468914334623251740
+	.quad	-966944318780986428
+	.quad	4498915137003099037
+	.quad	-7521869226879198374
+	.quad	-6411550076227838910
+	.quad	-4790650515171610063
+	.quad	5820620459997365075
+	.quad	-1376627125537124675
+	.quad	-6559282480285457368
+	.quad	-7777920981101784778
+	.quad	-8711237568605798759
+	.quad	-5110715207949843068
+	.quad	2946011094524915263
+	.quad	-1776707991509915931
+	.quad	3682513868156144079
+	.quad	-8027971522334779313
+	.quad	4607414176811284001
+	.quad	-5423278384491086237
+	.quad	1147581702586717097
+	.quad	-2167411962186469893
+	.quad	-3177208890193991532
+	.quad	-8272161504007625539
+	.quad	7237616480483531100
+	.quad	-5728515861582144020
+	.quad	-4788037454677749837
+	.quad	-2548958808550292121
+	.quad	-1373360799919799392
+	.quad	-8510628282985014432
+	.quad	-858350499949874620
+	.quad	-6026599335303880135
+	.quad	3538747893490044629
+	.quad	-2921563150702462265
+	.quad	9035120885289943691
+	.quad	-8743505996830120772
+	.quad	-5882264492762254953
+	.quad	-6317696477610263061
+	.quad	-2741144597525430788
+	.quad	-3285434578585440922
+	.quad	-3426430746906788485
+	.quad	-8970925639256982432
+	.quad	4776009810824339053
+	.quad	-6601971030643840136
+	.quad	5970012263530423816
+	.quad	-3640777769877412266
+	.quad	7462515329413029771
+	.quad	-9193015133814464522
+	.quad	52386062455755702
+	.quad	-6879582898840692749
+	.quad	-9157889458785081180
+	.quad	-3987792605123478032
+	.quad	6999382250228200141
+	.quad	-373054737976959636
+	.quad	8749227812785250177
+	.quad	-7150688238876681629
+	.quad	-3755104653863994448
+	.quad	-4326674280168464132
+	.quad	-4693880817329993060
+	.quad	-796656831783192261
+	.quad	-1255665003235103420
+	.quad	-7415439547505577019
+	.quad	8438581409832836170
+	.quad	-4657613415954583370
+	.quad	-3286831292991118499
+	.quad	-1210330751515841308
+	.quad	-8720225134666286028
+	.quad	-7673985747338482674
+	.quad	-3144297699952734816
+	.quad	-4980796165745715438
+	.quad	-8542058143368306423
+	.quad	-1614309188754756393
+	.quad	3157485376071780683
+	.quad	-7926472270612804602
+	.quad	8890957387685944783
+	.quad	-5296404319838617848
+	.quad	1890324697752655170
+	.quad	-2008819381370884406
+	.quad	2362905872190818963
+	.quad	-8173041140997884610
+	.quad	6088502188546649756
+	.quad	-5604615407819967859
+	.quad	-1612744301171463613
+	.quad	-2394083241347571919
+	.quad	7207441660390446292
+	.quad	-8413831053483314306
+	.quad	-2412877989897052924
+	.quad	-5905602798426754978
+	.quad	-7627783505798704059
+	.quad	-2770317479606055818
+	.quad	4300328673033783639
+	.quad	-8648977452394866743
+	.quad	-1923980597781273130
+	.quad	-6199535797066195524
+	.quad	6818396289628184396
+	.quad	-3137733727905356501
+	.quad	8522995362035230495
+	.quad	-8878612607581929669
+	.quad	3021029092058325107
+	.quad	-6486579741050024183
+	.quad	-835399653354481520
+	.quad	-3496538657885142324
+	.quad	8179122470161673908
+	.quad	-9102865688819295809
+	.quad	-4111420493003729616
+	.quad	-6766896092596731857
+	.quad	-5139275616254662020
+	.quad	-3846934097318526917
+	.quad	-6424094520318327524
+	.quad	-196981603220770742
+	.quad	-8030118150397909405
+	.quad	-7040642529654063570
+	.quad	-7324666853212387330
+	.quad	-4189117143640191558
+	.quad	4679224488766679549
+	.quad	-624710411122851544
+	.quad	-3374341425896426372
+	.quad	-7307973034592864071
+	.quad	-9026492418826348338
+	.quad	-4523280274813692185
+	.quad	-2059743486678159615
+	.quad	-1042414325089727327
+	.quad	-2574679358347699519
+	.quad	-7569037980822161435
+	.quad	3002511419460075705
+	.quad	-4849611457600313890
+	.quad	8364825292752482535
+	.quad	-1450328303573004458
+	.quad	1232659579085827361
+	.quad	-7823984217374209643
+	.quad	-3841273781498745804
+	.quad	-5168294253290374149
+	.quad	4421779809981343554
+	.quad	-1848681798185579782
+	.quad	915538744049291538
+	.quad	-8072955151507069220
+	.quad	5183897733458195115
+	.quad	-5479507920956448621
+	.quad	6479872166822743894
+	.quad	-2237698882768172872
+	.quad	3488154190101041964
+	.quad	-8316090829371189901
+	.quad	2180096368813151227
+	.quad	-5783427518286599473
+	.quad	-1886565557410948870
+	.quad	-2617598379430861437
+	.quad	-2358206946763686087
+	.quad	-8553528014785370254
+	.quad	7749492695127472003
+	.quad	-6080224000054324913
+	.quad	463493832054564196
+	.quad	-2988593981640518238
+	.quad	-4032318728359182659
+	.quad	-8785400266166405755
+	.quad	-4826042214438183114
+	.quad	-6370064314280619289
+	.quad	3190819268807046916
+	.quad	-3350894374423386208
+	.quad	-623161932418579259
+	.quad	-9011838011655698236
+	.quad	-7307005235402693893
+	.quad	-6653111496142234891
+	.quad	-4522070525825979462
+	.quad	-3704703351750405709
+	.quad	3570783879572301480
+	.quad	-19193171260619233
+	.quad	-148206168962011054
+	.quad	-6929524759678968877
+	.quad	-92628855601256909
+	.quad	-4050219931171323192
+	.quad	-115786069501571136
+	.quad	-451088895536766085
+	.quad	4466953431550423984
+	.quad	-7199459587351560659
+	.quad	486002885505321038
+	.quad	-4387638465762062920
+	.quad	5219189625309039202
+	.quad	-872862063775190746
+	.quad	6523987031636299002
+	.quad	-7463067817500576073
+	.quad	-534194123654701028
+	.quad	-4717148753448332187
+	.quad	-667742654568376285
+	.quad	-1284749923383027329
+	.quad	8388693718644305452
+	.quad	-7720497729755473937
+	.quad	-6286281471915778852
+	.quad	-5038936143766954517
+	.quad	-7857851839894723565
+	.quad	-1686984161281305242
+	.quad	8624429273841147159
+	.quad	-7971894128441897632
+	.quad	778582277723329070
+	.quad	-5353181642124984136
+	.quad	973227847154161338
+	.quad	-2079791034228842266
+	.quad	1216534808942701673
+	.quad	-8217398424034108273
+	.quad	-3851351762838199359
+	.quad	-5660062011615247437
+	.quad	-4814189703547749198
+	.quad	-2463391496091671392
+	.quad	-6017737129434686498
+	.quad	-8457148712698376476
+	.quad	7768129340171790699
+	.quad	-5959749872445582691
+	.quad	-8736582398494813242
+	.quad	-2838001322129590460
+	.quad	-1697355961263740745
+	.quad	-8691279853972075893
+	.quad	1244995533423855986
+	.quad	-6252413799037706963
+	.quad	-3055441601647567921
+	.quad	-3203831230369745799
+	.quad	5404070034795315907
+	.quad	-8919923546622172981
+	.quad	-3539985255894009414
+	.quad	-6538218414850328322
+	.quad	-4424981569867511768
+	.quad	-3561087000135522498
+	.quad	8303831092947774002
+	.quad	-9143208402725783417
+	.quad	578208414664970847
+	.quad	-6817324484979841368
+	.quad	-3888925500096174345
+	.quad	-3909969587797413806
+	.quad	-249470856692830027
+	.quad	-275775966319379353
+	.quad	-4923524589293425438
+	.quad	-7089889006590693952
+	.quad	-3077202868308390899
+	.quad	-4250675239810979535
+	.quad	765182433041899281
+	.quad	-701658031336336515
+	.quad	5568164059729762005
+	.quad	-7356065297226292178
+	.quad	5785945546544795205
+	.quad	-4583395603105477319
+	.quad	-1990940103673781802
+	.quad	-1117558485454458744
+	.quad	6734696907262548556
+	.quad	-7616003081050118571
+	.quad	4209185567039092847
+	.quad	-4908317832885260310
+	.quad	-8573576096483297653
+	.quad	-1523711272679187483
+	.quad	3118087934678041646
+	.quad	-7869848573065574033
+	.quad	4254647968387469981
+	.quad	-5225624697904579637
+	.quad	706623942056949572
+	.quad	-1920344853953336643
+	.quad	-3728406090856200939
+	.quad	-8117744561361917258
+	.quad	-6941939825212513491
+	.quad	-5535494683275008668
+	.quad	5157633273766521849
+	.quad	-2307682335666372931
+	.quad	6447041592208152311
+	.quad	-8359830487432564938
+	.quad	6335244004343789146
+	.quad	-5838102090863318269
+	.quad	-1304317031425039375
+	.quad	-2685941595151759932
+	.quad	-1630396289281299219
+	.quad	-8596242524610931813
+	.quad	1286845328412881940
+	.quad	-6133617137336276863
+	.quad	-3003129357911285479
+	.quad	-3055335403242958174
+	.quad	5469460339465668959
+	.quad	-8827113654667930715
+	.quad	8030098730593431003
+	.quad	-6422206049907525490
+	.quad	-3797434642040374958
+	.quad	-3416071543957018958
+	.quad	9088264752731695015
+	.quad	-9052573742614218705
+	.quad	-8154892584824854328
+	.quad	-6704031159840385477
+	.quad	8253128342678483706
+	.quad	-3768352931373093942
+	.quad	5704724409920716729
+	.quad	-98755145788979524
+	.quad	-2092466524453879896
+	.quad	-6979250993759194058
+	.quad	998051431430019017
+	.quad	-4112377723771604669
+	.quad	-7975807747567252037
+	.quad	-528786136287117932
+	.quad	8476984389250486570
+	.quad	-7248020362820530564
+	.quad	-3925256793573221702
+	.quad	-4448339435098275301
+	.quad	-294884973539139224
+	.quad	-948738275445456222
+	.quad	-368606216923924029
+	.quad	-7510490449794491995
+	.quad	-2536221894791146470
+	.quad	-4776427043815727089
+	.quad	6053094668365842720
+	.quad	-1358847786342270957
+	.quad	2954682317029915496
+	.quad	-7766808894105001205
+	.quad	-459166561069996767
+	.quad	-5096825099203863602
+	.quad	-573958201337495959
+	.quad	-1759345355577441598
+	.quad	-5329133770099257852
+	.quad	-8017119874876982855
+	.quad	-5636551615525730110
+	.quad	-5409713825168840664
+	.quad	2177682517447613171
+	.quad	-2150456263033662926
+	.quad	2722103146809516464
+	.quad	-8261564192037121185
+	.quad	6313000485183335694
+	.quad	-5715269221619013577
+	.quad	3279564588051781713
+	.quad	-2532400508596379068
+	.quad	-512230283362660763
+	.quad	-8500279345513818773
+	.quad	1985699082112030975
+	.quad	-6013663163464885563
+	.quad	-2129562165787349185
+	.quad	-2905392935903719049
+	.quad	6561419329620589327
+	.quad	-8733399612580906262
+	.quad	-7428327965055601431
+	.quad	-6305063497298744923
+	.quad	4549648098962661924
+	.quad	-3269643353196043250
+	.quad	-8147997931578836307
+	.quad	-8961056123388608887
+	.quad	1825030320404309164
+	.quad	-6589634135808373205
+	.quad	6892973918932774359
+	.quad	-3625356651333078602
+	.quad	4004531380238580045
+	.quad	-9183376934724255983
+	.quad	-2108853905778275376
+	.quad	-6867535149977932074
+	.quad	6587304654631931588
+	.quad	-3972732919045027189
+	.quad	-989241218564861323
+	.quad	-354230130378896082
+	.quad	-1236551523206076654
+	.quad	-7138922859127891907
+	.quad	6144684325637283947
+	.quad	-4311967555482476980
+	.quad	-6154202648235558778
+	.quad	-778273425925708321
+	.quad	-3081067291867060568
+	.quad	-7403949918844649557
+	.quad	-1925667057416912855
+	.quad	-4643251380128424042
+	.quad	-2407083821771141069
+	.quad	-1192378206733142148
+	.quad	-7620540795641314240
+	.quad	-7662765406849295699
+	.quad	-2456994988062127448
+	.quad	-4966770740134231719
+	.quad	6152128301777116498
+	.quad	-1596777406740401745
+	.quad	-6144897678060768090
+	.quad	-7915514906853832947
+	.quad	-3840561048787980056
+	.quad	-5282707615139903279
+	.quad	4422670725869800738
+	.quad	-1991698500497491195
+	.quad	-8306719647944912790
+	.quad	-8162340590452013853
+	.quad	8643358275316593218
+	.quad	-5591239719637629412
+	.quad	6192511825718353619
+	.quad	-2377363631119648861
+	.quad	7740639782147942024
+	.quad	-8403381297090862394
+	.quad	2532056854628769813
+	.quad	-5892540602936190089
+	.quad	-6058300968568813542
+	.quad	-2753989735242849707
+	.quad	-7572876210711016927
+	.quad	-8638772612167862923
+	.quad	9102010423587778132
+	.quad	-6186779746782440750
+	.quad	-2457545025797441047
+	.quad	-3121788665050663033
+	.quad	-7683617300674189212
+	.quad	-8868646943297746252
+	.quad	-4802260812921368258
+	.quad	-6474122660694794911
+	.quad	-1391139997724322418
+	.quad	-3480967307441105734
+	.quad	7484447039699372786
+	.quad	-9093133594791772940
+	.quad	-9157278655470055721
+	.quad	-6754730975062328271
+	.quad	-6834912300910181747
+	.quad	-3831727700400522434
+	.quad	679731660717048624
+	.quad	-177973607073265139
+	.quad	-8373707460958465028
+	.quad	-7028762532061872568
+	.quad	8601490892183123070
+	.quad	-4174267146649952806
+	.quad	-7694880458480647778
+	.quad	-606147914885053103
+	.quad	4216457482181353989
+	.quad	-7296371474444240046
+	.quad	-4282243101277735613
+	.quad	-4508778324627912153
+	.quad	8482254178684994196
+	.quad	-1024286887357502287
+	.quad	5991131704928854841
+	.quad	-7557708332239520786
+	.quad	-3173071712060547580
+	.quad	-4835449396872013078
+	.quad	-8578025658503072379
+	.quad	-1432625727662628443
+	.quad	3112525982153323238
+	.quad	-7812920107430224633
+	.quad	4251171748059520976
+	.quad	-5154464115860392887
+	.quad	702278666647013315
+	.quad	-1831394126398103205
+	.quad	5489534351736154548
+	.quad	-8062150356639896359
+	.quad	1125115960621402641
+	.quad	-5466001927372482545
+	.quad	6018080969204141205
+	.quad	-2220816390788215277
+	.quad	2910915193077788602
+	.quad	-8305539271883716405
+	.quad	-486521013540076076
+	.quad	-5770238071427257602
+	.quad	-608151266925095095
+	.quad	-2601111570856684098
+	.quad	-5371875102083756772
+	.quad	-8543223759426509417
+	.quad	3560107088838733873
+	.quad	-6067343680855748868
+	.quad	-161552157378970562
+	.quad	-2972493582642298180
+	.quad	4409745821703674701
+	.quad	-8775337516792518219
+	.quad	-6467280898289979120
+	.quad	-6357485877563259869
+	.quad	1139270913992301908
+	.quad	-3335171328526686933
+	.quad	-3187597375937010519
+	.quad	-9002011107970261189
+	.quad	7231123676894144234
+	.quad	-6640827866535438582
+	.quad	4427218577690292388
+	.quad	-3689348814741910324
+	.quad	-3689348814741910323
+	.quad	-9223372036854775808
+	.quad	0
+	.quad	-6917529027641081856
+	.quad	0
+	.quad	-4035225266123964416
+	.quad	0
+	.quad	-432345564227567616
+	.quad	0
+	.quad	-7187745005283311616
+	.quad	0
+	.quad	-4372995238176751616
+	.quad	0
+	.quad	-854558029293551616
+	.quad	0
+	.quad	-7451627795949551616
+	.quad	0
+	.quad	-4702848726509551616
+	.quad	0
+	.quad	-1266874889709551616
+	.quad	0
+	.quad	-7709325833709551616
+	.quad	0
+	.quad	-5024971273709551616
+	.quad	0
+	.quad	-1669528073709551616
+	.quad	0
+	.quad	-7960984073709551616
+	.quad	0
+	.quad	-5339544073709551616
+	.quad	0
+	.quad	-2062744073709551616
+	.quad	0
+	.quad	-8206744073709551616
+	.quad	0
+	.quad	-5646744073709551616
+	.quad	0
+	.quad	-2446744073709551616
+	.quad	0
+	.quad	-8446744073709551616
+	.quad	0
+	.quad	-5946744073709551616
+	.quad	0
+	.quad	-2821744073709551616
+	.quad	0
+	.quad	-8681119073709551616
+	.quad	0
+	.quad	-6239712823709551616
+	.quad	0
+	.quad	-3187955011209551616
+	.quad	0
+	.quad	-8910000909647051616
+	.quad	0
+	.quad	-6525815118631426616
+	.quad	0
+	.quad	-3545582879861895366
+	.quad	0
+	.quad	-9133518327554766460
+	.quad	4611686018427387904
+	.quad	-6805211891016070171
+	.quad	5764607523034234880
+	.quad	-3894828845342699810
+	.quad	-6629298651489370112
+	.quad	-256850038250986858
+	.quad	5548434740920451072
+	.quad	-7078060301547948643
+	.quad	-1143914305352105984
+	.quad	-4235889358507547899
+	.quad	7793479155164643328
+	.quad	-683175679707046970
+	.quad	-4093209111326359552
+	.quad	-7344513827457986212
+	.quad	4359273333062107136
+	.quad	-4568956265895094861
+	.quad	5449091666327633920
+	.quad	-1099509313941480672
+	.quad	2199678564482154496
+	.quad	-7604722348854507276
+	.quad	1374799102801346560
+	.quad	-4894216917640746191
+	.quad	1718498878501683200
+	.quad	-1506085128623544835
+	.quad	6759809616554491904
+	.quad	-7858832233030797378
+	.quad	6530724019560251392
+	.quad	-5211854272861108819
+	.quad	-1059967012404461568
+	.quad	-1903131822648998119
+	.quad	7898413271349198848
+	.quad	-8106986416796705681
+	.quad	-1981020733047832576
+	.quad	-5522047002568494197
+	.quad	-2476275916309790720
+	.quad	-2290872734783229842
+	.quad	-3095344895387238400
+	.quad	-8349324486880600507
+	.quad	4982938468024057856
+	.quad	-5824969590173362730
+	.quad	-7606384970252091392
+	.quad	-2669525969289315508
+	.quad	4327076842467049472
+	.quad	-8585982758446904049
+	.quad	-6518949010312869888
+	.quad	-6120792429631242157
+	.quad	-8148686262891087360
+	.quad	-3039304518611664792
+	.quad	8260886245095692416
+	.quad	-8817094351773372351
+	.quad	5163053903184807760
+	.quad	-6409681921289327535
+	.quad	-7381240676301154012
+	.quad	-3400416383184271515
+	.quad	-3178808521666707
+	.quad	-9042789267131251553
+	.quad	-4613672773753429596
+	.quad	-6691800565486676537
+	.quad	-5767090967191786995
+	.quad	-3753064688430957767
+	.quad	-7208863708989733744
+	.quad	-79644842111309304
+	.quad	212292400617608628
+	.quad	-6967307053960650171
+	.quad	132682750386005392
+	.quad	-4097447799023424810
+	.quad	4777539456409894645
+	.quad	-510123730351893109
+	.quad	-3251447716342407502
+	.quad	-7236356359111015049
+	.quad	7191217214140771119
+	.quad	-4433759430461380907
+	.quad	4377335499248575995
+	.quad	-930513269649338230
+	.quad	-8363388681221443718
+	.quad	-7499099821171918250
+	.quad	-7532960934977096276
+	.quad	-4762188758037509908
+	.quad	4418856886560793367
+	.quad	-1341049929119499481
+	.quad	5523571108200991709
+	.quad	-7755685233340769032
+	.quad	-8076983103442849942
+	.quad	-5082920523248573386
+	.quad	-5484542860876174524
+	.quad	-1741964635633328828
+	.quad	6979379479186945558
+	.quad	-8006256924911912374
+	.quad	-4861259862362934835
+	.quad	-5396135137712502563
+	.quad	7758483227328495169
+	.quad	-2133482903713240300
+	.quad	-4136954021121544751
+	.quad	-8250955842461857044
+	.quad	-279753253987271518
+	.quad	-5702008784649933400
+	.quad	4261994450943298507
+	.quad	-2515824962385028846
+	.quad	5327493063679123134
+	.quad	-8489919629131724885
+	.quad	7941369183226839863
+	.quad	-6000713517987268202
+	.quad	5315025460606161924
+	.quad	-2889205879056697349
+	.quad	-2579590211097073402
+	.quad	-8723282702051517699
+	.quad	7611128154919104931
+	.quad	-6292417359137009220
+	.quad	-4321147861633282548
+	.quad	-3253835680493873621
+	.quad	-789748808614215280
+	.quad	-8951176327949752869
+	.quad	8729779031470891258
+	.quad	-6577284391509803182
+	.quad	6300537770911226168
+	.quad	-3609919470959866074
+	.quad	-1347699823215743098
+	.quad	-9173728696990998152
+	.quad	6075216638131242420
+	.quad	-6855474852811359786
+	.quad	7594020797664053025
+	.quad	-3957657547586811828
+	.quad	269153960225290473
+	.quad	-335385916056126881
+	.quad	336442450281613091
+	.quad	-7127145225176161157
+	.quad	7127805559067090038
+	.quad	-4297245513042813542
+	.quad	4298070930406474644
+	.quad	-759870872876129024
+	.quad	-3850783373846682503
+	.quad	-7392448323188662496
+	.quad	9122475437414293195
+	.quad	-4628874385558440216
+	.quad	-7043649776941685122
+	.quad	-1174406963520662366
+	.quad	-4192876202749718498
+	.quad	-7651533379841495835
+	.quad	-4926390635932268014
+	.quad	-4952730706374481889
+	.quad	3065383741939440791
+	.quad	-1579227364540714458
+	.quad	-779956341003086915
+	.quad	-7904546130479028392
+	.quad	6430056314514152534
+	.quad	-5268996644671397586
+	.quad	8037570393142690668
+	.quad	-1974559787411859078
+	.quad	823590954573587527
+	.quad	-8151628894773493780
+	.quad	5126430365035880108
+	.quad	-5577850100039479321
+	.quad	6408037956294850135
+	.quad	-2360626606621961247
+	.quad	3398361426941174765
+	.quad	-8392920656779807636
+	.quad	-4793553135802847628
+	.quad	-5879464802547371641
+	.quad	-1380255401326171631
+	.quad	-2737644984756826647
+	.quad	-1725319251657714539
+	.quad	-8628557143114098510
+	.quad	3533361486141316317
+	.quad	-6174010410465235234
+	.quad	-4806670179178130411
+	.quad	-3105826994654156138
+	.quad	7826720331309500698
+	.quad	-8858670899299929442
+	.quad	280014188641050032
+	.quad	-6461652605697523899
+	.quad	-8873354301053463268
+	.quad	-3465379738694516970
+	.quad	-1868320839462053277
+	.quad	-9083391364325154962
+	.quad	5749828502977298558
+	.quad	-6742553186979055799
+	.quad	-2036086408133152611
+	.quad	-3816505465296431844
+	.quad	6678264026688335045
+	.quad	-158945813193151901
+	.quad	8347830033360418806
+	.quad	-7016870160886801794
+	.quad	2911550761636567802
+	.quad	-4159401682681114339
+	.quad	-5583933584809066056
+	.quad	-587566084924005019
+	.quad	2243455055843443238
+	.quad	-7284757830718584993
+	.quad	3708002419115845976
+	.quad	-4494261269970843337
+	.quad	23317005467419566
+	.quad	-1006140569036166268
+	.quad	-4582539761593113446
+	.quad	-7546366883288685774
+	.quad	-558244341782001952
+	.quad	-4821272585683469313
+	.quad	-5309491445654890344
+	.quad	-1414904713676948737
+	.quad	-6636864307068612930
+	.quad	-7801844473689174817
+	.quad	-4148040191917883081
+	.quad	-5140619573684080617
+	.quad	-5185050239897353852
+	.quad	-1814088448677712867
+	.quad	-6481312799871692315
+	.quad	-8051334308064652398
+	.quad	-8662506518347195601
+	.quad	-5452481866653427593
+	.quad	3006924907348169211
+	.quad	-2203916314889396588
+	.quad	-853029884242176390
+	.quad	-8294976724446954723
+	.quad	1772699331562333708
+	.quad	-5757034887131305500
+	.quad	6827560182880305039
+	.quad	-2584607590486743971
+	.quad	8534450228600381299
+	.quad	-8532908771695296838
+	.quad	7639874402088932264
+	.quad	-6054449946191733143
+	.quad	326470965756389522
+	.quad	-2956376414312278525
+	.quad	5019774725622874806
+	.quad	-8765264286586255934
+	.quad	831516194300602802
+	.quad	-6344894339805432014
+	.quad	-8183976793979022306
+	.quad	-3319431906329402113
+	.quad	3605087062808385830
+	.quad	-8992173969096958177
+	.quad	9170708441896323000
+	.quad	-6628531442943809817
+	.quad	6851699533943015846
+	.quad	-3673978285252374367
+	.quad	3952938399001381903
+	.quad	-9213765455923815836
+	.quad	-4446942528265218167
+	.quad	-6905520801477381891
+	.quad	-946992141904134804
+	.quad	-4020214983419339459
+	.quad	8039631859474607303
+	.quad	-413582710846786420
+	.quad	-3785518230938904583
+	.quad	-7176018221920323369
+	.quad	-60105885123121413
+	.quad	-4358336758973016307
+	.quad	-75132356403901766
+	.quad	-836234930288882479
+	.quad	9129456591349898601
+	.quad	-7440175859071633406
+	.quad	-1211618658047395231
+	.quad	-4688533805412153853
+	.quad	-6126209340986631942
+	.quad	-1248981238337804412
+	.quad	-7657761676233289928
+	.quad	-7698142301602209614
+	.quad	-2480258038432112253
+	.quad	-5010991858575374113
+	.quad	-7712008566467528220
+	.quad	-1652053804791829737
+	.quad	8806733365625141341
+	.quad	-7950062655635975442
+	.quad	-6025006692552756422
+	.quad	-5325892301117581398
+	.quad	6303799689591218185
+	.quad	-2045679357969588844
+	.quad	-1343622424865753077
+	.quad	-8196078626372074883
+	.quad	1466078993672598279
+	.quad	-5633412264537705700
+	.quad	6444284760518135752
+	.quad	-2430079312244744221
+	.quad	8055355950647669691
+	.quad	-8436328597794046994
+	.quad	2728754459941099604
+	.quad	-5933724728815170839
+	.quad	-5812428961928401302
+	.quad	-2805469892591575644
+	.quad	1957835834444274180
+	.quad	-8670947710510816634
+	.quad	-7999724640327104446
+	.quad	-6226998619711132888
+	.quad	3835402254873283155
+	.quad	-3172062256211528206
+	.quad	4794252818591603944
+	.quad	-8900067937773286985
+	.quad	7608094030047140369
+	.quad	-6513398903789220827
+	.quad	4898431519131537557
+	.quad	-3530062611309138130
+	.quad	-7712018656367741765
+	.quad	-9123818159709293187
+	.quad	2097517367411243253
+	.quad	-6793086681209228580
+	.quad	7233582727691441970
+	.quad	-3879672333084147821
+	.quad	9041978409614302462
+	.quad	-237904397927796872
+	.quad	6690786993590490174
+	.quad	-7066219276345954901
+	.quad	4181741870994056359
+	.quad	-4221088077005055722
+	.quad	615491320315182544
+	.quad	-664674077828931749
+	.quad	-8454007886460797627
+	.quad	-7332950326284164199
+	.quad	3939617107816777291
+	.quad	-4554501889427817345
+	.quad	-8910536670511192099
+	.quad	-1081441343357383777
+	.quad	7308573235570561493
+	.quad	-7593429867239446717
+	.quad	-6961356773836868827
+	.quad	-4880101315621920492
+	.quad	-8701695967296086034
+	.quad	-1488440626100012711
+	.quad	-6265433940692719638
+	.quad	-7847804418953589800
+	.quad	695789805494438130
+	.quad	-5198069505264599346
+	.quad	869737256868047663
+	.quad	-1885900863153361279
+	.quad	-8136200465769716230
+	.quad	-8096217067111932656
+	.quad	-473439272678684740
+	.quad	-5508585315462527915
+	.quad	4019886927579031980
+	.quad	-2274045625900771990
+	.quad	-8810199395808373737
+	.quad	-8338807543829064350
+	.quad	-7812217631593927538
+	.quad	-5811823411358942533
+	.quad	4069786015789754290
+	.quad	-2653093245771290262
+	.quad	475546501309804958
+	.quad	-8575712306248138270
+	.quad	4908902581746016003
+	.quad	-6107954364382784934
+	.quad	-3087243809672255805
+	.quad	-3023256937051093263
+	.quad	-8470740780517707660
+	.quad	-8807064613298015146
+	.quad	-682526969396179383
+	.quad	-6397144748195131028
+	.quad	-5464844730172612133
+	.quad	-3384744916816525881
+	.quad	-2219369894288377262
+	.quad	-9032994600651410532
+	.quad	-1387106183930235789
+	.quad	-6679557232386875260
+	.quad	2877803288514593168
+	.quad	-3737760522056206171
+	.quad	3597254110643241460
+	.quad	-60514634142869810
+	.quad	9108253656731439729
+	.quad	-6955350673980375487
+	.quad	1080972517029761926
+	.quad	-4082502324048081455
+	.quad	5962901664714590312
+	.quad	-491441886632713915
+	.quad	-6381430974388925822
+	.quad	-7224680206786528053
+	.quad	-8600080377420466543
+	.quad	-4419164240055772162
+	.quad	7696643601933968437
+	.quad	-912269281642327298
+	.quad	397432465562684739
+	.quad	-7487697328667536418
+	.quad	-4363290727450709942
+	.quad	-4747935642407032618
+	.quad	8380944645968776284
+	.quad	-1323233534581402868
+	.quad	1252808770606194547
+	.quad	-7744549986754458649
+	.quad	-8440366555225904216
+	.quad	-5069001465015685407
+	.quad	7896285879677171346
+	.quad	-1724565812842218855
+	.quad	-3964700705685699529
+	.quad	-7995382660667468640
+	.quad	2133748077373825698
+	.quad	-5382542307406947896
+	.quad	2667185096717282123
+	.quad	-2116491865831296966
+	.quad	3333981370896602653
+	.quad	-8240336443785642460
+	.quad	6695424375237764562
+	.quad	-5688734536304665171
+	.quad	8369280469047205703
+	.quad	-2499232151953443560
+	.quad	-3373457468973156583
+	.quad	-8479549122611984081
+	.quad	-9025939945749304721
+	.quad	-5987750384837592197
+	.quad	7164319141522920715
+	.quad	-2873001962619602342
+	.quad	4343712908476262990
+	.quad	-8713155254278333320
+	.quad	7326506586225052273
+	.quad	-6279758049420528746
+	.quad	9158133232781315341
+	.quad	-3238011543348273028
+	.quad	2224294504121868368
+	.quad	-8941286242233752499
+	.quad	-7833187971778608078
+	.quad	-6564921784364802720
+	.quad	-568112927868484289
+	.quad	-3594466212028615495
+	.quad	3901544858591782542
+	.quad	-9164070410158966541
+	.quad	-4479063491021217767
+	.quad	-6843401994271320272
+	.quad	-5598829363776522209
+	.quad	-3942566474411762436
+	.quad	-2386850686293264857
+	.quad	-316522074587315140
+	.quad	1628122660560806833
+	.quad	-7115355324258153819
+	.quad	-8205795374004271538
+	.quad	-4282508136895304370
+	.quad	-1033872180650563614
+	.quad	-741449152691742558
+	.quad	-5904026244240592421
+	.quad	-7380934748073420955
+	.quad	-5995859411864064215
+	.quad	-4614482416664388289
+	.quad	1728547772024695539
+	.quad	-1156417002403097458
+	.quad	-2451001303396518480
+	.quad	-7640289654143017767
+	.quad	5385653213018257806
+	.quad	-4938676049251384305
+	.quad	-7102991539009341455
+	.quad	-1561659043136842477
+	.quad	-8878739423761676819
+	.quad	-7893565929601608404
+	.quad	3674159897003727796
+	.quad	-5255271393574622601
+	.quad	4592699871254659745
+	.quad	-1957403223540890347
+	.quad	1129188820640936778
+	.quad	-8140906042354138323
+	.quad	3011586022114279438
+	.quad	-5564446534515285000
+	.quad	8376168546070237202
+	.quad	-2343872149716718346
+	.quad	-7976533391121755114
+	.quad	-8382449121214030822
+	.quad	1932195658189984910
+	.quad	-5866375383090150624
+	.quad	-6808127464117294671
+	.quad	-2721283210435300376
+	.quad	-3898473311719230434
+	.quad	-8618331034163144591
+	.quad	9092669226243950738
+	.quad	-6161227774276542835
+	.quad	-2469221522477225289
+	.quad	-3089848699418290639
+	.quad	6136845133758244197
+	.quad	-8848684464777513506
+	.quad	-3082000819042179233
+	.quad	-6449169562544503978
+	.quad	-8464187042230111945
+	.quad	-3449775934753242068
+	.quad	3254824252494523781
+	.quad	-9073638986861858149
+	.quad	-7189106879045698445
+	.quad	-6730362715149934782
+	.quad	-8986383598807123057
+	.quad	-3801267375510030573
+	.quad	2602078556773259891
+	.quad	-139898200960150313
+	.quad	-1359087822460813040
+	.quad	-7004965403241175802
+	.quad	-849429889038008150
+	.quad	-4144520735624081848
+	.quad	-5673473379724898091
+	.quad	-568964901102714406
+	.quad	-2480155706228734710
+	.quad	-7273132090830278360
+	.quad	-3855940325606653146
+	.quad	-4479729095110460046
+	.quad	-208239388580928528
+	.quad	-987975350460687153
+	.quad	-4871985254153548564
+	.quad	-7535013621679011327
+	.quad	-3044990783845967853
+	.quad	-4807081008671376254
+	.quad	5417133557047315992
+	.quad	-1397165242411832414
+	.quad	-2451955090545630818
+	.quad	-7790757304148477115
+	.quad	-3838314940804713213
+	.quad	-5126760611758208489
+	.quad	4425478360848884291
+	.quad	-1796764746270372707
+	.quad	920161932633717460
+	.quad	-8040506994060064798
+	.quad	2880944217109767365
+	.quad	-5438947724147693094
+	.quad	-5622191765467566602
+	.quad	-2186998636757228463
+	.quad	6807318348447705459
+	.quad	-8284403175614349646
+	.quad	-2662955059861265944
+	.quad	-5743817951090549153
+	.quad	-7940379843253970334
+	.quad	-2568086420435798537
+	.quad	8521269269642088699
+	.quad	-8522583040413455942
+	.quad	-6203421752542164323
+	.quad	-6041542782089432023
+	.quad	6080780864604458308
+	.quad	-2940242459184402125
+	.quad	-6234081974526590827
+	.quad	-8755180564631333184
+	.quad	5327070802775656541
+	.quad	-6332289687361778576
+	.quad	6658838503469570676
+	.quad	-3303676090774835316
+	.quad	8323548129336963345
+	.quad	-8982326584375353929
+	.quad	-4021154456019173717
+	.quad	-6616222212041804507
+	.quad	-5026443070023967147
+	.quad	-3658591746624867729
+	.quad	2940318199324816875
+	.quad	-9204148869281624187
+	.quad	8755227902219092403
+	.quad	-6893500068174642330
+	.quad	-2891023177508298209
+	.quad	-4005189066790915008
+	.quad	-8225464990312760665
+	.quad	-394800315061255856
+	.quad	-5670145219463562927
+	.quad	-7164279224554366766
+	.quad	7985374283903742931
+	.quad	-4343663012265570553
+	.quad	758345818024902856
+	.quad	-817892746904575288
+	.quad	-3663753745896259334
+	.quad	-7428711994456441411
+	.quad	-9207375118826243940
+	.quad	-4674203974643163860
+	.quad	-2285846861678029117
+	.quad	-1231068949876566920
+	.quad	1754377441329851508
+	.quad	-7686947121313936181
+	.quad	1096485900831157192
+	.quad	-4996997883215032323
+	.quad	-3241078642388441414
+	.quad	-1634561335591402499
+	.quad	5172023733869224041
+	.quad	-7939129862385708418
+	.quad	5538357842881958977
+	.quad	-5312226309554747619
+	.quad	-2300424733252327086
+	.quad	-2028596868516046619
+	.quad	6347841120289366950
+	.quad	-8185402070463610993
+	.quad	6273243709394548296
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC0:
+	.quad	-13
+	.quad	-26
+	.quad	-39
+	.quad	-52
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC3:
+	.long	0
+	.long	-2147483648
+	.long	0
+	.long	0
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/root/repo/src/../include/strutils.h"
+	.file 7 "/usr/include/string.h"
+	.file 8 "/usr/include/errno.h"
+	.file 9 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x157c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x28
+	.long	.LASF97
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x9
+	.byte	0x10
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0xf
+	.long	.LASF11
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x10
+	.long	0x3c
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF5
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF6
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xf
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x29
+	.byte	0x14
+	.long	0x4d
+	.uleb128 0xf
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x70
+	.uleb128 0xf
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x54
+	.uleb128 0xf
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x2a
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF16
+	.uleb128 0x10
+	.long	0xb7
+	.uleb128 0xf
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x13
+	.long	0x85
+	.uleb128 0xf
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x13
+	.long	0x9d
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF19
+	.uleb128 0xc
+	.long	0xe7
+	.uleb128 0x2b
+	.uleb128 0xc
+	.long	0xbe
+	.uleb128 0xf
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x14
+	.long	0x91
+	.uleb128 0xf
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x10
+	.long	0xf9
+	.uleb128 0x2c
+	.long	.LASF26
+	.byte	0x10
+	.byte	0x6
+	.byte	0xd
+	.byte	0x8
+	.long	0x130
+	.uleb128 0x23
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0xe8
+	.byte	0
+	.uleb128 0x23
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x3c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.long	0x10a
+	.uleb128 0x9
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF22
+	.uleb128 0xc
+	.long	0x130
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF23
+	.uleb128 0x10
+	.long	0x141
+	.uleb128 0xc
+	.long	0xf9
+	.uleb128 0x1e
+	.long	0x105
+	.long	0x163
+	.uleb128 0x2d
+	.long	0x35
+	.value	0x515
+	.byte	0
+	.uleb128 0x10
+	.long	0x152
+	.uleb128 0x2e
+	.long	.LASF24
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x17
+	.long	0x163
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numeric_parser_power_of_five
+	.uleb128 0x1e
+	.long	0x148
+	.long	0x18e
+	.uleb128 0x24
+	.long	0x35
+	.byte	0x16
+	.byte	0
+	.uleb128 0x10
+	.long	0x17e
+	.uleb128 0x1f
+	.long	.LASF25
+	.value	0x2bd
+	.byte	0x15
+	.long	0x18e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numeric_parser_power_of_ten
+	.uleb128 0x2f
+	.long	.LASF27
+	.value	0x208
+	.byte	0x1
+	.value	0x2c5
+	.byte	0x8
+	.long	0x1d6
+	.uleb128 0x30
+	.long	.LASF28
+	.byte	0x1
+	.value	0x2ca
+	.byte	0xc
+	.long	0x1db
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF29
+	.byte	0x1
+	.value	0x2cf
+	.byte	0xa
+	.long	0x3c
+	.value	0x200
+	.byte	0
+	.uleb128 0x10
+	.long	0x1a9
+	.uleb128 0x1e
+	.long	0xed
+	.long	0x1eb
+	.uleb128 0x24
+	.long	0x35
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF98
+	.byte	0x8
+	.byte	0x25
+	.byte	0xd
+	.long	0x1f7
+	.uleb128 0xc
+	.long	0x4d
+	.uleb128 0x25
+	.long	.LASF30
+	.byte	0x3d
+	.long	0xb5
+	.long	0x21a
+	.uleb128 0x18
+	.long	0xb5
+	.uleb128 0x18
+	.long	0x4d
+	.uleb128 0x18
+	.long	0x3c
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF31
+	.byte	0x2f
+	.long	0xb5
+	.long	0x238
+	.uleb128 0x18
+	.long	0xb5
+	.uleb128 0x18
+	.long	0xe2
+	.uleb128 0x18
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF35
+	.value	0x4da
+	.long	0x3c
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2c2
+	.uleb128 0x6
+	.long	.LASF32
+	.value	0x4da
+	.byte	0x2e
+	.long	0x13c
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x6
+	.long	.LASF33
+	.value	0x4da
+	.byte	0x42
+	.long	0x48
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x6
+	.long	.LASF34
+	.value	0x4da
+	.byte	0x52
+	.long	0x2c2
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x8
+	.long	.LLRL179
+	.uleb128 0xa
+	.string	"i"
+	.value	0x4db
+	.byte	0xf
+	.long	0x3c
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x15
+	.quad	.LVL322
+	.long	0x356
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0xcf
+	.uleb128 0x1c
+	.long	.LASF36
+	.value	0x4cd
+	.long	0x3c
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x351
+	.uleb128 0x6
+	.long	.LASF32
+	.value	0x4cd
+	.byte	0x2c
+	.long	0x13c
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x6
+	.long	.LASF33
+	.value	0x4cd
+	.byte	0x40
+	.long	0x48
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x6
+	.long	.LASF34
+	.value	0x4cd
+	.byte	0x4f
+	.long	0x351
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x8
+	.long	.LLRL174
+	.uleb128 0xa
+	.string	"i"
+	.value	0x4ce
+	.byte	0xf
+	.long	0x3c
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0x15
+	.quad	.LVL315
+	.long	0x549
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x141
+	.uleb128 0x1c
+	.long	.LASF37
+	.value	0x4ac
+	.long	0x3c
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x549
+	.uleb128 0x6
+	.long	.LASF38
+	.value	0x4ac
+	.byte	0x1b
+	.long	0xe8
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x6
+	.long	.LASF39
+	.value	0x4ac
+	.byte	0x30
+	.long	0x48
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x6
+	.long	.LASF40
+	.value	0x4ac
+	.byte	0x41
+	.long	0x2c2
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0xa
+	.string	"p"
+	.value	0x4ad
+	.byte	0xf
+	.long	0xe8
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0xa
+	.string	"end"
+	.value	0x4ae
+	.byte	0xf
+	.long	0xe8
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x3
+	.long	.LASF41
+	.value	0x4b0
+	.byte	0x7
+	.long	0x4d
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x3
+	.long	.LASF42
+	.value	0x4b6
+	.byte	0xf
+	.long	0xe8
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x7
+	.long	.LASF51
+	.value	0x4ba
+	.byte	0xf
+	.long	0xe8
+	.uleb128 0x3
+	.long	.LASF43
+	.value	0x4bb
+	.byte	0xc
+	.long	0xf9
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x33
+	.long	0x12fe
+	.quad	.LBB293
+	.quad	.LBE293-.LBB293
+	.byte	0x1
+	.value	0x4bc
+	.byte	0x7
+	.long	0x53b
+	.uleb128 0x11
+	.long	0x1325
+	.uleb128 0x11
+	.long	0x1319
+	.uleb128 0x1
+	.long	0x130f
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x2
+	.long	0x1331
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x20
+	.long	0x133d
+	.long	.LLRL162
+	.long	0x50a
+	.uleb128 0x2
+	.long	0x133e
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0xb
+	.long	0x134c
+	.quad	.LBI296
+	.value	.LVU927
+	.long	.LLRL164
+	.value	0x329
+	.byte	0x21
+	.long	0x4a4
+	.uleb128 0x1
+	.long	0x135d
+	.long	.LLST165
+	.long	.LVUS165
+	.byte	0
+	.uleb128 0xb
+	.long	0x136a
+	.quad	.LBI302
+	.value	.LVU952
+	.long	.LLRL166
+	.value	0x326
+	.byte	0x9
+	.long	0x4cc
+	.uleb128 0x1
+	.long	0x137b
+	.long	.LLST167
+	.long	.LVUS167
+	.byte	0
+	.uleb128 0x19
+	.long	0x1388
+	.quad	.LBI309
+	.value	.LVU946
+	.quad	.LBB309
+	.quad	.LBE309-.LBB309
+	.value	0x325
+	.byte	0x16
+	.uleb128 0x1
+	.long	0x1399
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x2
+	.long	0x13a5
+	.long	.LLST169
+	.long	.LVUS169
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x13b2
+	.quad	.LBI313
+	.value	.LVU970
+	.quad	.LBB313
+	.quad	.LBE313-.LBB313
+	.value	0x32c
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x13c3
+	.long	.LLST170
+	.long	.LVUS170
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL310
+	.long	0x1eb
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF44
+	.value	0x449
+	.long	0x3c
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbe6
+	.uleb128 0x6
+	.long	.LASF38
+	.value	0x449
+	.byte	0x19
+	.long	0xe8
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x6
+	.long	.LASF39
+	.value	0x449
+	.byte	0x2e
+	.long	0x48
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x6
+	.long	.LASF40
+	.value	0x449
+	.byte	0x3e
+	.long	0x351
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0xa
+	.string	"p"
+	.value	0x44a
+	.byte	0xf
+	.long	0xe8
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0xa
+	.string	"end"
+	.value	0x44b
+	.byte	0xf
+	.long	0xe8
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x3
+	.long	.LASF41
+	.value	0x44d
+	.byte	0x7
+	.long	0x4d
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x3
+	.long	.LASF45
+	.value	0x453
+	.byte	0xf
+	.long	0xe8
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x3
+	.long	.LASF46
+	.value	0x454
+	.byte	0xc
+	.long	0xf9
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x3
+	.long	.LASF47
+	.value	0x456
+	.byte	0xb
+	.long	0xcf
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x3
+	.long	.LASF48
+	.value	0x457
+	.byte	0xb
+	.long	0xcf
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x3
+	.long	.LASF49
+	.value	0x462
+	.byte	0xf
+	.long	0xe8
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x3
+	.long	.LASF50
+	.value	0x464
+	.byte	0xb
+	.long	0xcf
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x3
+	.long	.LASF51
+	.value	0x47b
+	.byte	0xf
+	.long	0xe8
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x3
+	.long	.LASF52
+	.value	0x47c
+	.byte	0xb
+	.long	0xcf
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x3
+	.long	.LASF53
+	.value	0x481
+	.byte	0xb
+	.long	0xcf
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x3
+	.long	.LASF54
+	.value	0x482
+	.byte	0xc
+	.long	0xf9
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x12
+	.long	.LLRL136
+	.long	0x7ef
+	.uleb128 0x3
+	.long	.LASF55
+	.value	0x45a
+	.byte	0x11
+	.long	0xe8
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x1a
+	.long	0x12fe
+	.quad	.LBI251
+	.value	.LVU759
+	.long	.LLRL138
+	.value	0x45b
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x1325
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x1
+	.long	0x1319
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x1
+	.long	0x130f
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x8
+	.long	.LLRL138
+	.uleb128 0x2
+	.long	0x1331
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x20
+	.long	0x133d
+	.long	.LLRL143
+	.long	0x7bc
+	.uleb128 0x2
+	.long	0x133e
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0xb
+	.long	0x134c
+	.quad	.LBI254
+	.value	.LVU777
+	.long	.LLRL145
+	.value	0x329
+	.byte	0x21
+	.long	0x756
+	.uleb128 0x1
+	.long	0x135d
+	.long	.LLST146
+	.long	.LVUS146
+	.byte	0
+	.uleb128 0xb
+	.long	0x136a
+	.quad	.LBI260
+	.value	.LVU802
+	.long	.LLRL147
+	.value	0x326
+	.byte	0x9
+	.long	0x77e
+	.uleb128 0x1
+	.long	0x137b
+	.long	.LLST148
+	.long	.LVUS148
+	.byte	0
+	.uleb128 0x19
+	.long	0x1388
+	.quad	.LBI267
+	.value	.LVU796
+	.quad	.LBB267
+	.quad	.LBE267-.LBB267
+	.value	0x325
+	.byte	0x16
+	.uleb128 0x1
+	.long	0x1399
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x2
+	.long	0x13a5
+	.long	.LLST150
+	.long	.LVUS150
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x13b2
+	.quad	.LBI271
+	.value	.LVU820
+	.quad	.LBB271
+	.quad	.LBE271-.LBB271
+	.value	0x32c
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x13c3
+	.long	.LLST151
+	.long	.LVUS151
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LLRL110
+	.long	0x879
+	.uleb128 0x3
+	.long	.LASF56
+	.value	0x466
+	.byte	0x11
+	.long	0xe8
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x3
+	.long	.LASF57
+	.value	0x468
+	.byte	0x9
+	.long	0x4d
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0xb
+	.long	0x13b2
+	.quad	.LBI211
+	.value	.LVU611
+	.long	.LLRL113
+	.value	0x46d
+	.byte	0x14
+	.long	0x848
+	.uleb128 0x1
+	.long	0x13c3
+	.long	.LLST114
+	.long	.LVUS114
+	.byte	0
+	.uleb128 0x19
+	.long	0x13b2
+	.quad	.LBI214
+	.value	.LVU629
+	.quad	.LBB214
+	.quad	.LBE214-.LBB214
+	.value	0x46e
+	.byte	0x19
+	.uleb128 0x1
+	.long	0x13c3
+	.long	.LLST115
+	.long	.LVUS115
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LLRL116
+	.long	0x924
+	.uleb128 0xa
+	.string	"q"
+	.value	0x487
+	.byte	0xd
+	.long	0xcf
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x12
+	.long	.LLRL121
+	.long	0x8b2
+	.uleb128 0x3
+	.long	.LASF58
+	.value	0x48a
+	.byte	0xe
+	.long	0x141
+	.long	.LLST122
+	.long	.LVUS122
+	.byte	0
+	.uleb128 0x1a
+	.long	0x125a
+	.quad	.LBI222
+	.value	.LVU840
+	.long	.LLRL118
+	.value	0x48f
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x1275
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x1
+	.long	0x126b
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x8
+	.long	.LLRL118
+	.uleb128 0x4
+	.long	0x127f
+	.uleb128 0x4
+	.long	0x128a
+	.uleb128 0x4
+	.long	0x1296
+	.uleb128 0x4
+	.long	0x12a2
+	.uleb128 0x4
+	.long	0x12ae
+	.uleb128 0x4
+	.long	0x12ba
+	.uleb128 0x4
+	.long	0x12c6
+	.uleb128 0x4
+	.long	0x12d2
+	.uleb128 0x4
+	.long	0x12de
+	.uleb128 0x26
+	.quad	.LVL225
+	.long	0x140e
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LLRL123
+	.long	0xac8
+	.uleb128 0xa
+	.string	"w"
+	.value	0x493
+	.byte	0xe
+	.long	0xf9
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x3
+	.long	.LASF59
+	.value	0x494
+	.byte	0x9
+	.long	0x4d
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x3
+	.long	.LASF60
+	.value	0x49c
+	.byte	0xd
+	.long	0xcf
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0xa
+	.string	"q"
+	.value	0x49d
+	.byte	0xd
+	.long	0xcf
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x12
+	.long	.LLRL128
+	.long	0x997
+	.uleb128 0x3
+	.long	.LASF61
+	.value	0x495
+	.byte	0x16
+	.long	0xe8
+	.long	.LLST129
+	.long	.LVUS129
+	.byte	0
+	.uleb128 0xb
+	.long	0x125a
+	.quad	.LBI234
+	.value	.LVU732
+	.long	.LLRL130
+	.value	0x49e
+	.byte	0xc
+	.long	0xa1b
+	.uleb128 0x1
+	.long	0x1275
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x1
+	.long	0x126b
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x8
+	.long	.LLRL130
+	.uleb128 0x4
+	.long	0x127f
+	.uleb128 0x4
+	.long	0x128a
+	.uleb128 0x4
+	.long	0x1296
+	.uleb128 0x4
+	.long	0x12a2
+	.uleb128 0x4
+	.long	0x12ae
+	.uleb128 0x4
+	.long	0x12ba
+	.uleb128 0x4
+	.long	0x12c6
+	.uleb128 0x4
+	.long	0x12d2
+	.uleb128 0x4
+	.long	0x12de
+	.uleb128 0x15
+	.quad	.LVL236
+	.long	0x140e
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x125a
+	.quad	.LBI241
+	.value	.LVU744
+	.long	.LLRL133
+	.value	0x49f
+	.byte	0x11
+	.long	0xa9f
+	.uleb128 0x1
+	.long	0x1275
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x1
+	.long	0x126b
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x8
+	.long	.LLRL133
+	.uleb128 0x4
+	.long	0x127f
+	.uleb128 0x4
+	.long	0x128a
+	.uleb128 0x4
+	.long	0x1296
+	.uleb128 0x4
+	.long	0x12a2
+	.uleb128 0x4
+	.long	0x12ae
+	.uleb128 0x4
+	.long	0x12ba
+	.uleb128 0x4
+	.long	0x12c6
+	.uleb128 0x4
+	.long	0x12d2
+	.uleb128 0x4
+	.long	0x12de
+	.uleb128 0x15
+	.quad	.LVL238
+	.long	0x140e
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL239
+	.long	0xbe6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x12fe
+	.quad	.LBI185
+	.value	.LVU511
+	.long	.LLRL95
+	.value	0x455
+	.byte	0x7
+	.uleb128 0x1
+	.long	0x1325
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x1
+	.long	0x1319
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x1
+	.long	0x130f
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x8
+	.long	.LLRL95
+	.uleb128 0x2
+	.long	0x1331
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x20
+	.long	0x133d
+	.long	.LLRL100
+	.long	0xbbf
+	.uleb128 0x2
+	.long	0x133e
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0xb
+	.long	0x136a
+	.quad	.LBI188
+	.value	.LVU557
+	.long	.LLRL102
+	.value	0x326
+	.byte	0x9
+	.long	0xb59
+	.uleb128 0x1
+	.long	0x137b
+	.long	.LLST103
+	.long	.LVUS103
+	.byte	0
+	.uleb128 0xb
+	.long	0x134c
+	.quad	.LBI191
+	.value	.LVU532
+	.long	.LLRL104
+	.value	0x329
+	.byte	0x21
+	.long	0xb81
+	.uleb128 0x1
+	.long	0x135d
+	.long	.LLST105
+	.long	.LVUS105
+	.byte	0
+	.uleb128 0x19
+	.long	0x1388
+	.quad	.LBI199
+	.value	.LVU551
+	.quad	.LBB199
+	.quad	.LBE199-.LBB199
+	.value	0x325
+	.byte	0x16
+	.uleb128 0x1
+	.long	0x1399
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x2
+	.long	0x13a5
+	.long	.LLST107
+	.long	.LVUS107
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x13b2
+	.quad	.LBI203
+	.value	.LVU577
+	.long	.LLRL108
+	.value	0x32c
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x13c3
+	.long	.LLST109
+	.long	.LVUS109
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF72
+	.value	0x406
+	.byte	0x11
+	.long	0xf9
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf36
+	.uleb128 0x6
+	.long	.LASF42
+	.value	0x406
+	.byte	0x36
+	.long	0xe8
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x34
+	.string	"end"
+	.byte	0x1
+	.value	0x406
+	.byte	0x4a
+	.long	0xe8
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x6
+	.long	.LASF50
+	.value	0x406
+	.byte	0x57
+	.long	0xcf
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x6
+	.long	.LASF54
+	.value	0x406
+	.byte	0x6a
+	.long	0xf9
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1f
+	.long	.LASF62
+	.value	0x408
+	.byte	0x1e
+	.long	0x1a9
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.uleb128 0x3
+	.long	.LASF63
+	.value	0x409
+	.byte	0x7
+	.long	0x4d
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x3
+	.long	.LASF64
+	.value	0x40a
+	.byte	0x7
+	.long	0x4d
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x16
+	.string	"e10"
+	.value	0x419
+	.byte	0xb
+	.long	0xcf
+	.uleb128 0xa
+	.string	"m"
+	.value	0x41b
+	.byte	0xc
+	.long	0xf9
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0xa
+	.string	"e2"
+	.value	0x41c
+	.byte	0xb
+	.long	0xcf
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1f
+	.long	.LASF65
+	.value	0x424
+	.byte	0x1e
+	.long	0x1a9
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 528
+	.uleb128 0x7
+	.long	.LASF66
+	.value	0x425
+	.byte	0xc
+	.long	0xf9
+	.uleb128 0x3
+	.long	.LASF67
+	.value	0x42b
+	.byte	0x7
+	.long	0x4d
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x3
+	.long	.LASF68
+	.value	0x432
+	.byte	0xb
+	.long	0xcf
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x3
+	.long	.LASF69
+	.value	0x43c
+	.byte	0x7
+	.long	0x4d
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x12
+	.long	.LLRL36
+	.long	0xe38
+	.uleb128 0xa
+	.string	"p"
+	.value	0x40b
+	.byte	0x14
+	.long	0xe8
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x35
+	.long	0x13b2
+	.quad	.LBI106
+	.value	.LVU200
+	.quad	.LBB106
+	.quad	.LBE106-.LBB106
+	.byte	0x1
+	.value	0x40c
+	.byte	0xa
+	.long	0xd69
+	.uleb128 0x1
+	.long	0x13c3
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.uleb128 0x22
+	.long	0x120a
+	.long	.LLRL39
+	.value	0x413
+	.byte	0x9
+	.long	0xdc5
+	.uleb128 0x11
+	.long	0x1227
+	.uleb128 0x11
+	.long	0x121b
+	.uleb128 0x8
+	.long	.LLRL39
+	.uleb128 0x2
+	.long	0x1233
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x13
+	.long	0x123f
+	.long	.LLRL41
+	.uleb128 0x2
+	.long	0x1240
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x13
+	.long	0x124a
+	.long	.LLRL43
+	.uleb128 0x2
+	.long	0x124b
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x11ba
+	.quad	.LBI115
+	.value	.LVU230
+	.long	.LLRL45
+	.value	0x413
+	.byte	0x39
+	.uleb128 0x1
+	.long	0x11d7
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x1
+	.long	0x11cb
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x8
+	.long	.LLRL45
+	.uleb128 0x2
+	.long	0x11e3
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x13
+	.long	0x11ef
+	.long	.LLRL49
+	.uleb128 0x2
+	.long	0x11f0
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x13
+	.long	0x11fa
+	.long	.LLRL51
+	.uleb128 0x2
+	.long	0x11fb
+	.long	.LLST52
+	.long	.LVUS52
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0xf36
+	.quad	.LBI128
+	.value	.LVU308
+	.long	.LLRL53
+	.value	0x43c
+	.byte	0xf
+	.long	0xeb0
+	.uleb128 0x1
+	.long	0xf51
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x1
+	.long	0xf47
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x8
+	.long	.LLRL53
+	.uleb128 0x2
+	.long	0xf5b
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x2
+	.long	0xf67
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x27
+	.long	0xf73
+	.quad	.LBB130
+	.quad	.LBE130-.LBB130
+	.uleb128 0x2
+	.long	0xf74
+	.long	.LLST58
+	.long	.LVUS58
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL95
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1d
+	.quad	.LVL96
+	.long	0x108d
+	.long	0xed9
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7b
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL99
+	.long	0xf85
+	.long	0xef1
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL112
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1b
+	.quad	.LVL121
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1d
+	.quad	.LVL122
+	.long	0x108d
+	.long	0xf20
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 528
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL126
+	.long	0xf85
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 528
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF78
+	.value	0x3e3
+	.byte	0xc
+	.long	0x4d
+	.byte	0x1
+	.long	0xf80
+	.uleb128 0x14
+	.string	"a"
+	.value	0x3e3
+	.byte	0x4c
+	.long	0xf80
+	.uleb128 0x14
+	.string	"b"
+	.value	0x3e3
+	.byte	0x71
+	.long	0xf80
+	.uleb128 0x7
+	.long	.LASF70
+	.value	0x3e4
+	.byte	0xa
+	.long	0x3c
+	.uleb128 0x7
+	.long	.LASF71
+	.value	0x3e4
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x17
+	.uleb128 0x16
+	.string	"i"
+	.value	0x3ee
+	.byte	0xf
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x1d6
+	.uleb128 0x21
+	.long	.LASF73
+	.value	0x3c3
+	.byte	0xc
+	.long	0x4d
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1088
+	.uleb128 0x6
+	.long	.LASF43
+	.value	0x3c3
+	.byte	0x42
+	.long	0x1088
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x3c3
+	.byte	0x52
+	.long	0xcf
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x3
+	.long	.LASF28
+	.value	0x3c4
+	.byte	0xa
+	.long	0x3c
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x3
+	.long	.LASF54
+	.value	0x3c5
+	.byte	0x7
+	.long	0x4d
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x12
+	.long	.LLRL19
+	.long	0x1047
+	.uleb128 0x3
+	.long	.LASF74
+	.value	0x3cb
+	.byte	0xe
+	.long	0xed
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x8
+	.long	.LLRL21
+	.uleb128 0xa
+	.string	"i"
+	.value	0x3cc
+	.byte	0x11
+	.long	0x3c
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x8
+	.long	.LLRL23
+	.uleb128 0x3
+	.long	.LASF75
+	.value	0x3cd
+	.byte	0x10
+	.long	0xed
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL63
+	.long	0x21a
+	.long	0x1068
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL64
+	.long	0x1574
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x1a9
+	.uleb128 0x21
+	.long	.LASF76
+	.value	0x3ae
+	.byte	0xc
+	.long	0x4d
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11ba
+	.uleb128 0x6
+	.long	.LASF43
+	.value	0x3ae
+	.byte	0x47
+	.long	0x1088
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x6
+	.long	.LASF50
+	.value	0x3ae
+	.byte	0x57
+	.long	0xcf
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x3
+	.long	.LASF77
+	.value	0x3b6
+	.byte	0xc
+	.long	0xed
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x22
+	.long	0x120a
+	.long	.LLRL3
+	.value	0x3ba
+	.byte	0xa
+	.long	0x1147
+	.uleb128 0x11
+	.long	0x1227
+	.uleb128 0x11
+	.long	0x121b
+	.uleb128 0x8
+	.long	.LLRL3
+	.uleb128 0x2
+	.long	0x1233
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x13
+	.long	0x123f
+	.long	.LLRL5
+	.uleb128 0x2
+	.long	0x1240
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x13
+	.long	0x124a
+	.long	.LLRL7
+	.uleb128 0x2
+	.long	0x124b
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0x120a
+	.long	.LLRL9
+	.value	0x3b1
+	.byte	0x9
+	.long	0x11a3
+	.uleb128 0x11
+	.long	0x1227
+	.uleb128 0x11
+	.long	0x121b
+	.uleb128 0x8
+	.long	.LLRL9
+	.uleb128 0x2
+	.long	0x1233
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x13
+	.long	0x123f
+	.long	.LLRL11
+	.uleb128 0x2
+	.long	0x1240
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x13
+	.long	0x124a
+	.long	.LLRL13
+	.uleb128 0x2
+	.long	0x124b
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL31
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1b
+	.quad	.LVL45
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF79
+	.value	0x398
+	.byte	0xc
+	.long	0x4d
+	.byte	0x1
+	.long	0x120a
+	.uleb128 0xe
+	.long	.LASF43
+	.value	0x398
+	.byte	0x42
+	.long	0x1088
+	.uleb128 0xe
+	.long	.LASF40
+	.value	0x398
+	.byte	0x53
+	.long	0xed
+	.uleb128 0x7
+	.long	.LASF74
+	.value	0x399
+	.byte	0xc
+	.long	0xf9
+	.uleb128 0x17
+	.uleb128 0x16
+	.string	"i"
+	.value	0x39a
+	.byte	0xf
+	.long	0x3c
+	.uleb128 0x17
+	.uleb128 0x16
+	.string	"sum"
+	.value	0x39b
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF80
+	.value	0x382
+	.byte	0xc
+	.long	0x4d
+	.byte	0x1
+	.long	0x125a
+	.uleb128 0xe
+	.long	.LASF43
+	.value	0x382
+	.byte	0x42
+	.long	0x1088
+	.uleb128 0xe
+	.long	.LASF77
+	.value	0x382
+	.byte	0x53
+	.long	0xed
+	.uleb128 0x7
+	.long	.LASF74
+	.value	0x383
+	.byte	0xc
+	.long	0xf9
+	.uleb128 0x17
+	.uleb128 0x16
+	.string	"i"
+	.value	0x384
+	.byte	0xf
+	.long	0x3c
+	.uleb128 0x17
+	.uleb128 0x7
+	.long	.LASF81
+	.value	0x385
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF82
+	.value	0x342
+	.byte	0x11
+	.long	0xf9
+	.byte	0x1
+	.long	0x12f9
+	.uleb128 0x14
+	.string	"q"
+	.value	0x342
+	.byte	0x35
+	.long	0xcf
+	.uleb128 0x14
+	.string	"w"
+	.value	0x342
+	.byte	0x41
+	.long	0xf9
+	.uleb128 0x16
+	.string	"lz"
+	.value	0x34a
+	.byte	0x7
+	.long	0x4d
+	.uleb128 0x7
+	.long	.LASF83
+	.value	0x34d
+	.byte	0x13
+	.long	0x12f9
+	.uleb128 0x7
+	.long	.LASF84
+	.value	0x34e
+	.byte	0xc
+	.long	0xf9
+	.uleb128 0x16
+	.string	"low"
+	.value	0x34f
+	.byte	0xc
+	.long	0xf9
+	.uleb128 0x7
+	.long	.LASF85
+	.value	0x350
+	.byte	0x12
+	.long	0x105
+	.uleb128 0x7
+	.long	.LASF86
+	.value	0x359
+	.byte	0x7
+	.long	0x4d
+	.uleb128 0x7
+	.long	.LASF68
+	.value	0x35a
+	.byte	0x7
+	.long	0x4d
+	.uleb128 0x7
+	.long	.LASF46
+	.value	0x35b
+	.byte	0xc
+	.long	0xf9
+	.uleb128 0x7
+	.long	.LASF87
+	.value	0x35d
+	.byte	0xb
+	.long	0xc3
+	.uleb128 0x17
+	.uleb128 0x7
+	.long	.LASF88
+	.value	0x352
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x105
+	.uleb128 0xd
+	.long	.LASF89
+	.value	0x322
+	.byte	0x1b
+	.long	0xe8
+	.byte	0x3
+	.long	0x134c
+	.uleb128 0x14
+	.string	"p"
+	.value	0x322
+	.byte	0x3d
+	.long	0xe8
+	.uleb128 0x14
+	.string	"end"
+	.value	0x322
+	.byte	0x4c
+	.long	0xe8
+	.uleb128 0xe
+	.long	.LASF43
+	.value	0x322
+	.byte	0x5b
+	.long	0x14d
+	.uleb128 0x7
+	.long	.LASF40
+	.value	0x323
+	.byte	0xc
+	.long	0xf9
+	.uleb128 0x17
+	.uleb128 0x7
+	.long	.LASF90
+	.value	0x325
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF91
+	.value	0x30f
+	.byte	0x18
+	.long	0xf9
+	.byte	0x3
+	.long	0x136a
+	.uleb128 0xe
+	.long	.LASF90
+	.value	0x30f
+	.byte	0x3f
+	.long	0xf9
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF92
+	.value	0x307
+	.byte	0x13
+	.long	0x4d
+	.byte	0x3
+	.long	0x1388
+	.uleb128 0xe
+	.long	.LASF90
+	.value	0x307
+	.byte	0x3d
+	.long	0x105
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF93
+	.value	0x2fb
+	.byte	0x18
+	.long	0xf9
+	.byte	0x3
+	.long	0x13b2
+	.uleb128 0xe
+	.long	.LASF38
+	.value	0x2fb
+	.byte	0x39
+	.long	0xe8
+	.uleb128 0x7
+	.long	.LASF90
+	.value	0x2fc
+	.byte	0xc
+	.long	0xf9
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF94
+	.value	0x2f4
+	.byte	0x13
+	.long	0x4d
+	.byte	0x3
+	.long	0x13d0
+	.uleb128 0xe
+	.long	.LASF95
+	.value	0x2f4
+	.byte	0x36
+	.long	0xbe
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF96
+	.value	0x2df
+	.byte	0x18
+	.long	0xf9
+	.byte	0x3
+	.long	0x140e
+	.uleb128 0x14
+	.string	"a"
+	.value	0x2df
+	.byte	0x37
+	.long	0xf9
+	.uleb128 0x14
+	.string	"b"
+	.value	0x2df
+	.byte	0x43
+	.long	0xf9
+	.uleb128 0xe
+	.long	.LASF84
+	.value	0x2df
+	.byte	0x50
+	.long	0x14d
+	.uleb128 0x7
+	.long	.LASF81
+	.value	0x2e1
+	.byte	0x23
+	.long	0x2e
+	.byte	0
+	.uleb128 0x36
+	.long	0x125a
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1574
+	.uleb128 0x1
+	.long	0x126b
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x1
+	.long	0x1275
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x2
+	.long	0x127f
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x2
+	.long	0x128a
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x2
+	.long	0x1296
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x2
+	.long	0x12a2
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x37
+	.long	0x12ae
+	.value	0x1ff
+	.uleb128 0x2
+	.long	0x12ba
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x2
+	.long	0x12c6
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x2
+	.long	0x12d2
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x2
+	.long	0x12de
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0xb
+	.long	0x13d0
+	.quad	.LBI138
+	.value	.LVU406
+	.long	.LLRL69
+	.value	0x34f
+	.byte	0x12
+	.long	0x1507
+	.uleb128 0x1
+	.long	0x13f5
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x1
+	.long	0x13eb
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x1
+	.long	0x13e1
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x8
+	.long	.LLRL69
+	.uleb128 0x2
+	.long	0x1401
+	.long	.LLST73
+	.long	.LVUS73
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	0x12ea
+	.quad	.LBB142
+	.quad	.LBE142-.LBB142
+	.uleb128 0x4
+	.long	0x12eb
+	.uleb128 0x1a
+	.long	0x13d0
+	.quad	.LBI143
+	.value	.LVU421
+	.long	.LLRL74
+	.value	0x353
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x13f5
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x1
+	.long	0x13eb
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x1
+	.long	0x13e1
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x8
+	.long	.LLRL74
+	.uleb128 0x2
+	.long	0x1401
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF30
+	.long	.LASF99
+	.byte	0x9
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS176:
+	.uleb128 0
+	.uleb128 .LVU1024
+	.uleb128 .LVU1024
+	.uleb128 .LVU1033
+	.uleb128 .LVU1033
+	.uleb128 0
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS177:
+	.uleb128 0
+	.uleb128 .LVU1024
+	.uleb128 .LVU1024
+	.uleb128 .LVU1031
+	.uleb128 .LVU1031
+	.uleb128 .LVU1033
+	.uleb128 .LVU1033
+	.uleb128 0
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS178:
+	.uleb128 0
+	.uleb128 .LVU1024
+	.uleb128 .LVU1024
+	.uleb128 .LVU1033
+	.uleb128 .LVU1033
+	.uleb128 0
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU1020
+	.uleb128 .LVU1024
+	.uleb128 .LVU1024
+	.uleb128 .LVU1031
+	.uleb128 .LVU1033
+	.uleb128 0
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS171:
+	.uleb128 0
+	.uleb128 .LVU1007
+	.uleb128 .LVU1007
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 0
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS172:
+	.uleb128 0
+	.uleb128 .LVU1007
+	.uleb128 .LVU1007
+	.uleb128 .LVU1014
+	.uleb128 .LVU1014
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 0
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS173:
+	.uleb128 0
+	.uleb128 .LVU1007
+	.uleb128 .LVU1007
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 0
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU1003
+	.uleb128 .LVU1007
+	.uleb128 .LVU1007
+	.uleb128 .LVU1014
+	.uleb128 .LVU1016
+	.uleb128 0
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS152:
+	.uleb128 0
+	.uleb128 .LVU922
+	.uleb128 .LVU922
+	.uleb128 .LVU990
+	.uleb128 .LVU990
+	.uleb128 .LVU992
+	.uleb128 .LVU992
+	.uleb128 .LVU994
+	.uleb128 .LVU994
+	.uleb128 .LVU999
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL310-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL310-1-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS153:
+	.uleb128 0
+	.uleb128 .LVU900
+	.uleb128 .LVU900
+	.uleb128 .LVU990
+	.uleb128 .LVU990
+	.uleb128 .LVU991
+	.uleb128 .LVU991
+	.uleb128 0
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS154:
+	.uleb128 0
+	.uleb128 .LVU994
+	.uleb128 .LVU994
+	.uleb128 .LVU999
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL310-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL310-1-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU886
+	.uleb128 .LVU891
+	.uleb128 .LVU893
+	.uleb128 .LVU902
+	.uleb128 .LVU902
+	.uleb128 .LVU906
+	.uleb128 .LVU907
+	.uleb128 .LVU922
+	.uleb128 .LVU922
+	.uleb128 .LVU959
+	.uleb128 .LVU976
+	.uleb128 .LVU987
+	.uleb128 .LVU990
+	.uleb128 .LVU992
+	.uleb128 .LVU992
+	.uleb128 .LVU994
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL310-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU888
+	.uleb128 .LVU994
+	.uleb128 .LVU994
+	.uleb128 .LVU999
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL310-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL310-1-.Ltext0
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL312-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU889
+	.uleb128 .LVU891
+	.uleb128 .LVU893
+	.uleb128 .LVU901
+	.uleb128 .LVU901
+	.uleb128 .LVU906
+	.uleb128 .LVU990
+	.uleb128 .LVU992
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU903
+	.uleb128 .LVU906
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU975
+	.uleb128 .LVU989
+	.uleb128 .LVU992
+	.uleb128 .LVU994
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL310-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU911
+	.uleb128 .LVU922
+	.uleb128 .LVU922
+	.uleb128 .LVU931
+	.uleb128 .LVU931
+	.uleb128 .LVU941
+	.uleb128 .LVU941
+	.uleb128 .LVU966
+	.uleb128 .LVU966
+	.uleb128 .LVU968
+	.uleb128 .LVU968
+	.uleb128 .LVU974
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU911
+	.uleb128 .LVU922
+	.uleb128 .LVU922
+	.uleb128 .LVU927
+	.uleb128 .LVU940
+	.uleb128 .LVU964
+	.uleb128 .LVU967
+	.uleb128 .LVU974
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU922
+	.uleb128 .LVU925
+	.uleb128 .LVU925
+	.uleb128 .LVU931
+	.uleb128 .LVU931
+	.uleb128 .LVU945
+	.uleb128 .LVU950
+	.uleb128 .LVU958
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU934
+	.uleb128 .LVU935
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 0
+	.byte	0x40
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU952
+	.uleb128 .LVU954
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU946
+	.uleb128 .LVU950
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU922
+	.uleb128 .LVU925
+	.uleb128 .LVU925
+	.uleb128 .LVU931
+	.uleb128 .LVU931
+	.uleb128 .LVU945
+	.uleb128 .LVU949
+	.uleb128 .LVU958
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU970
+	.uleb128 .LVU972
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS79:
+	.uleb128 0
+	.uleb128 .LVU522
+	.uleb128 .LVU522
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU643
+	.uleb128 .LVU643
+	.uleb128 .LVU686
+	.uleb128 .LVU686
+	.uleb128 .LVU687
+	.uleb128 .LVU687
+	.uleb128 .LVU693
+	.uleb128 .LVU693
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS80:
+	.uleb128 0
+	.uleb128 .LVU518
+	.uleb128 .LVU518
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU639
+	.uleb128 .LVU639
+	.uleb128 .LVU687
+	.uleb128 .LVU687
+	.uleb128 .LVU693
+	.uleb128 .LVU693
+	.uleb128 0
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 0
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU643
+	.uleb128 .LVU643
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU496
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU519
+	.uleb128 .LVU519
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 .LVU583
+	.uleb128 .LVU583
+	.uleb128 .LVU600
+	.uleb128 .LVU600
+	.uleb128 .LVU611
+	.uleb128 .LVU618
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU639
+	.uleb128 .LVU641
+	.uleb128 .LVU643
+	.uleb128 .LVU643
+	.uleb128 .LVU645
+	.uleb128 .LVU645
+	.uleb128 .LVU685
+	.uleb128 .LVU687
+	.uleb128 .LVU692
+	.uleb128 .LVU692
+	.uleb128 .LVU693
+	.uleb128 .LVU700
+	.uleb128 .LVU754
+	.uleb128 .LVU754
+	.uleb128 .LVU757
+	.uleb128 .LVU757
+	.uleb128 .LVU826
+	.uleb128 .LVU826
+	.uleb128 .LVU839
+	.uleb128 .LVU839
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU866
+	.uleb128 .LVU871
+	.uleb128 .LVU871
+	.uleb128 .LVU874
+	.uleb128 .LVU874
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU499
+	.uleb128 .LVU633
+	.uleb128 .LVU633
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 .LVU639
+	.uleb128 .LVU639
+	.uleb128 .LVU643
+	.uleb128 .LVU643
+	.uleb128 .LVU686
+	.uleb128 .LVU686
+	.uleb128 .LVU687
+	.uleb128 .LVU687
+	.uleb128 .LVU698
+	.uleb128 .LVU698
+	.uleb128 .LVU754
+	.uleb128 .LVU754
+	.uleb128 .LVU839
+	.uleb128 .LVU839
+	.uleb128 .LVU847
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+	.uleb128 .LVU849
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 .LVU865
+	.uleb128 .LVU865
+	.uleb128 .LVU871
+	.uleb128 .LVU871
+	.uleb128 .LVU883
+	.uleb128 .LVU883
+	.uleb128 0
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x7
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x7
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x7
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x7
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x7
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x7
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x7
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x7
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU500
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU639
+	.uleb128 .LVU687
+	.uleb128 .LVU690
+	.uleb128 .LVU690
+	.uleb128 .LVU693
+	.uleb128 .LVU693
+	.uleb128 .LVU700
+	.uleb128 .LVU754
+	.uleb128 .LVU839
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU871
+	.uleb128 0
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU509
+	.uleb128 .LVU519
+	.uleb128 .LVU519
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 .LVU636
+	.uleb128 .LVU693
+	.uleb128 .LVU700
+	.uleb128 .LVU754
+	.uleb128 .LVU839
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU871
+	.uleb128 0
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU510
+	.uleb128 .LVU582
+	.uleb128 .LVU582
+	.uleb128 .LVU636
+	.uleb128 .LVU640
+	.uleb128 .LVU643
+	.uleb128 .LVU644
+	.uleb128 .LVU677
+	.uleb128 .LVU693
+	.uleb128 .LVU709
+	.uleb128 .LVU710
+	.uleb128 .LVU711
+	.uleb128 .LVU754
+	.uleb128 .LVU772
+	.uleb128 .LVU825
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU866
+	.uleb128 .LVU871
+	.uleb128 .LVU873
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL225-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU586
+	.uleb128 .LVU595
+	.uleb128 .LVU648
+	.uleb128 .LVU656
+	.uleb128 .LVU754
+	.uleb128 .LVU772
+	.uleb128 .LVU772
+	.uleb128 .LVU809
+	.uleb128 .LVU809
+	.uleb128 .LVU833
+	.uleb128 .LVU871
+	.uleb128 .LVU881
+	.uleb128 .LVU882
+	.uleb128 0
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x20
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x20
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU587
+	.uleb128 .LVU595
+	.uleb128 .LVU649
+	.uleb128 .LVU656
+	.uleb128 .LVU754
+	.uleb128 .LVU829
+	.uleb128 .LVU829
+	.uleb128 .LVU839
+	.uleb128 .LVU871
+	.uleb128 .LVU877
+	.uleb128 .LVU877
+	.uleb128 .LVU882
+	.uleb128 .LVU882
+	.uleb128 0
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU595
+	.uleb128 .LVU636
+	.uleb128 .LVU693
+	.uleb128 .LVU697
+	.uleb128 .LVU835
+	.uleb128 .LVU839
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU595
+	.uleb128 .LVU616
+	.uleb128 .LVU618
+	.uleb128 .LVU623
+	.uleb128 .LVU625
+	.uleb128 .LVU635
+	.uleb128 .LVU635
+	.uleb128 .LVU636
+	.uleb128 .LVU656
+	.uleb128 .LVU677
+	.uleb128 .LVU693
+	.uleb128 .LVU697
+	.uleb128 .LVU700
+	.uleb128 .LVU709
+	.uleb128 .LVU710
+	.uleb128 .LVU740
+	.uleb128 .LVU752
+	.uleb128 .LVU754
+	.uleb128 .LVU836
+	.uleb128 .LVU839
+	.uleb128 .LVU839
+	.uleb128 .LVU847
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+	.uleb128 .LVU849
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU871
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL225-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL236-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU657
+	.uleb128 .LVU665
+	.uleb128 .LVU665
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU685
+	.uleb128 .LVU700
+	.uleb128 .LVU754
+	.uleb128 .LVU839
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU871
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU658
+	.uleb128 .LVU662
+	.uleb128 .LVU662
+	.uleb128 .LVU677
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU672
+	.uleb128 .LVU676
+	.uleb128 .LVU676
+	.uleb128 .LVU677
+	.uleb128 .LVU700
+	.uleb128 .LVU709
+	.uleb128 .LVU710
+	.uleb128 .LVU713
+	.uleb128 .LVU839
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU871
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL225-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU673
+	.uleb128 .LVU677
+	.uleb128 .LVU677
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 .LVU685
+	.uleb128 .LVU700
+	.uleb128 .LVU742
+	.uleb128 .LVU742
+	.uleb128 .LVU747
+	.uleb128 .LVU747
+	.uleb128 .LVU751
+	.uleb128 .LVU751
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 .LVU754
+	.uleb128 .LVU839
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+	.uleb128 .LVU871
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x12
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x24
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x21
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL238-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL238-1-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU758
+	.uleb128 .LVU833
+	.uleb128 .LVU871
+	.uleb128 .LVU881
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU759
+	.uleb128 .LVU826
+	.uleb128 .LVU871
+	.uleb128 .LVU874
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1524
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1524
+	.sleb128 0
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU759
+	.uleb128 .LVU826
+	.uleb128 .LVU871
+	.uleb128 .LVU874
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU759
+	.uleb128 .LVU772
+	.uleb128 .LVU772
+	.uleb128 .LVU781
+	.uleb128 .LVU781
+	.uleb128 .LVU791
+	.uleb128 .LVU791
+	.uleb128 .LVU816
+	.uleb128 .LVU816
+	.uleb128 .LVU818
+	.uleb128 .LVU818
+	.uleb128 .LVU826
+	.uleb128 .LVU871
+	.uleb128 .LVU874
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU761
+	.uleb128 .LVU777
+	.uleb128 .LVU790
+	.uleb128 .LVU814
+	.uleb128 .LVU817
+	.uleb128 .LVU826
+	.uleb128 .LVU871
+	.uleb128 .LVU874
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU772
+	.uleb128 .LVU775
+	.uleb128 .LVU775
+	.uleb128 .LVU781
+	.uleb128 .LVU781
+	.uleb128 .LVU795
+	.uleb128 .LVU800
+	.uleb128 .LVU808
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU784
+	.uleb128 .LVU785
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x40
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU802
+	.uleb128 .LVU804
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU796
+	.uleb128 .LVU800
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU772
+	.uleb128 .LVU775
+	.uleb128 .LVU775
+	.uleb128 .LVU781
+	.uleb128 .LVU781
+	.uleb128 .LVU795
+	.uleb128 .LVU799
+	.uleb128 .LVU808
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU820
+	.uleb128 .LVU822
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU598
+	.uleb128 .LVU636
+	.uleb128 .LVU693
+	.uleb128 .LVU697
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU601
+	.uleb128 .LVU607
+	.uleb128 .LVU607
+	.uleb128 .LVU611
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU611
+	.uleb128 .LVU613
+	.uleb128 .LVU693
+	.uleb128 .LVU695
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU629
+	.uleb128 .LVU631
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU704
+	.uleb128 .LVU709
+	.uleb128 .LVU839
+	.uleb128 .LVU847
+	.uleb128 .LVU849
+	.uleb128 .LVU856
+	.uleb128 .LVU866
+	.uleb128 .LVU869
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU852
+	.uleb128 .LVU859
+	.uleb128 .LVU866
+	.uleb128 .LVU870
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU840
+	.uleb128 .LVU847
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU840
+	.uleb128 .LVU847
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU713
+	.uleb128 .LVU754
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU713
+	.uleb128 .LVU721
+	.uleb128 .LVU721
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU730
+	.uleb128 .LVU752
+	.uleb128 .LVU754
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU728
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 .LVU752
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL236-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL236-1-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU731
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 .LVU752
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL236-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL236-1-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU713
+	.uleb128 .LVU739
+	.uleb128 .LVU752
+	.uleb128 .LVU754
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU732
+	.uleb128 .LVU742
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU732
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 .LVU742
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL236-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL236-1-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU744
+	.uleb128 .LVU747
+	.uleb128 .LVU747
+	.uleb128 .LVU747
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL238-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL238-1-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU744
+	.uleb128 .LVU747
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU511
+	.uleb128 .LVU583
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1524
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1524
+	.sleb128 0
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU511
+	.uleb128 .LVU583
+	.uleb128 .LVU863
+	.uleb128 .LVU865
+	.uleb128 .LVU865
+	.uleb128 .LVU866
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x7
+	.byte	0x7d
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU511
+	.uleb128 .LVU519
+	.uleb128 .LVU519
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 .LVU571
+	.uleb128 .LVU571
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU583
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU513
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 .LVU532
+	.uleb128 .LVU545
+	.uleb128 .LVU583
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU527
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU550
+	.uleb128 .LVU555
+	.uleb128 .LVU563
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU557
+	.uleb128 .LVU559
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU539
+	.uleb128 .LVU540
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x40
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU551
+	.uleb128 .LVU555
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU527
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU550
+	.uleb128 .LVU554
+	.uleb128 .LVU563
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU577
+	.uleb128 .LVU579
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 .LVU344
+	.uleb128 .LVU344
+	.uleb128 .LVU358
+	.uleb128 .LVU358
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 .LVU392
+	.uleb128 .LVU392
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 .LVU344
+	.uleb128 .LVU344
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU343
+	.uleb128 .LVU343
+	.uleb128 .LVU344
+	.uleb128 .LVU344
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU189
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU268
+	.uleb128 .LVU334
+	.uleb128 .LVU339
+	.uleb128 .LVU344
+	.uleb128 .LVU358
+	.uleb128 .LVU391
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU190
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU268
+	.uleb128 .LVU334
+	.uleb128 .LVU339
+	.uleb128 .LVU344
+	.uleb128 .LVU358
+	.uleb128 .LVU391
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU273
+	.uleb128 .LVU280
+	.uleb128 .LVU358
+	.uleb128 .LVU363
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU274
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU277
+	.uleb128 .LVU358
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU363
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 -1075
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU290
+	.uleb128 .LVU298
+	.uleb128 .LVU298
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU334
+	.uleb128 .LVU363
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 .LVU376
+	.uleb128 .LVU376
+	.uleb128 .LVU391
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL99-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL99-1-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU299
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU304
+	.uleb128 .LVU370
+	.uleb128 .LVU372
+	.uleb128 .LVU372
+	.uleb128 .LVU375
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x6
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU329
+	.uleb128 .LVU332
+	.uleb128 .LVU388
+	.uleb128 .LVU391
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU192
+	.uleb128 .LVU294
+	.uleb128 .LVU334
+	.uleb128 .LVU339
+	.uleb128 .LVU344
+	.uleb128 .LVU365
+	.uleb128 .LVU391
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU200
+	.uleb128 .LVU202
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU206
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+	.uleb128 .LVU228
+	.uleb128 .LVU344
+	.uleb128 .LVU345
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU206
+	.uleb128 .LVU208
+	.uleb128 .LVU344
+	.uleb128 .LVU345
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU230
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU258
+	.uleb128 .LVU345
+	.uleb128 .LVU354
+	.uleb128 .LVU354
+	.uleb128 .LVU358
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0xe
+	.byte	0x75
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0x8
+	.byte	0x30
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -48
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU230
+	.uleb128 .LVU260
+	.uleb128 .LVU345
+	.uleb128 .LVU358
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU233
+	.uleb128 .LVU242
+	.uleb128 .LVU247
+	.uleb128 .LVU255
+	.uleb128 .LVU348
+	.uleb128 .LVU354
+	.uleb128 .LVU354
+	.uleb128 .LVU356
+	.uleb128 .LVU356
+	.uleb128 .LVU358
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 -48
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x9
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x14
+	.byte	0x75
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0x8
+	.byte	0x30
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU235
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU249
+	.uleb128 .LVU249
+	.uleb128 .LVU258
+	.uleb128 .LVU350
+	.uleb128 .LVU358
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU242
+	.uleb128 .LVU247
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU308
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU321
+	.uleb128 .LVU321
+	.uleb128 .LVU329
+	.uleb128 .LVU378
+	.uleb128 .LVU388
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 528
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x4
+	.byte	0x74
+	.sleb128 528
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 528
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 528
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU308
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU321
+	.uleb128 .LVU321
+	.uleb128 .LVU329
+	.uleb128 .LVU378
+	.uleb128 .LVU388
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x57
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x57
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x57
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU311
+	.uleb128 .LVU329
+	.uleb128 .LVU378
+	.uleb128 .LVU382
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU312
+	.uleb128 .LVU329
+	.uleb128 .LVU378
+	.uleb128 .LVU388
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU382
+	.uleb128 .LVU385
+	.uleb128 .LVU385
+	.uleb128 .LVU388
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU140
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x15
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x1f
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x30
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x35
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU141
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0xa
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x14
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0xb
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x14
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU146
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU169
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU146
+	.uleb128 .LVU153
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU155
+	.uleb128 .LVU169
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU33
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU39
+	.uleb128 .LVU94
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU97
+	.uleb128 .LVU102
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU113
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+	.uleb128 .LVU120
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU124
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU34
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU70
+	.uleb128 .LVU113
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU125
+	.uleb128 .LVU126
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x271
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0xc35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x3d09
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x1312d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x5f5e1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x1dcd65
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x9502f9
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x2e90edd
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x271
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x49
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0xc35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x3d09
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x5f5e1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x1312d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x9502f9
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x1dcd65
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU70
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU77
+	.uleb128 .LVU81
+	.uleb128 .LVU91
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU70
+	.uleb128 .LVU72
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU77
+	.uleb128 .LVU81
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU7
+	.uleb128 .LVU8
+	.uleb128 .LVU10
+	.uleb128 .LVU15
+	.uleb128 .LVU19
+	.uleb128 .LVU30
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+	.uleb128 .LVU107
+	.uleb128 .LVU108
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU7
+	.uleb128 .LVU8
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+	.uleb128 .LVU107
+	.uleb128 .LVU108
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU15
+	.uleb128 .LVU19
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU471
+	.uleb128 .LVU471
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 .LVU428
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU397
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU404
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU471
+	.uleb128 .LVU471
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x10
+	.byte	0x72
+	.sleb128 342
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	numeric_parser_power_of_five
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x10
+	.byte	0x72
+	.sleb128 338
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	numeric_parser_power_of_five
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x13
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x156
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	numeric_parser_power_of_five
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x10
+	.byte	0x72
+	.sleb128 342
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	numeric_parser_power_of_five
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x13
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x156
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	numeric_parser_power_of_five
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU413
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU415
+	.uleb128 .LVU431
+	.uleb128 .LVU433
+	.uleb128 0
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU438
+	.uleb128 .LVU445
+	.uleb128 .LVU445
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 -9
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU443
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x9
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x9
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU446
+	.uleb128 .LVU453
+	.uleb128 .LVU453
+	.uleb128 .LVU455
+	.uleb128 .LVU455
+	.uleb128 .LVU456
+	.uleb128 .LVU456
+	.uleb128 .LVU459
+	.uleb128 .LVU465
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU480
+	.uleb128 .LVU480
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU486
+	.uleb128 .LVU487
+	.uleb128 .LVU493
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x5
+	.byte	0x40
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x11
+	.byte	0x71
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x13
+	.byte	0x71
+	.sleb128 0
+	.byte	0x31
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x16
+	.byte	0x78
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x25
+	.byte	0x31
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9
+	.byte	0xfe
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU447
+	.uleb128 .LVU482
+	.uleb128 .LVU482
+	.uleb128 .LVU486
+	.uleb128 .LVU487
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1d
+	.byte	0x72
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9218868437227405313
+	.byte	0x2b
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LFE43-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU406
+	.uleb128 .LVU415
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+5213
+	.sleb128 0
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU406
+	.uleb128 .LVU415
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU406
+	.uleb128 .LVU415
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU409
+	.uleb128 .LVU415
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x6
+	.byte	0x5a
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5b
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU421
+	.uleb128 .LVU425
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+5404
+	.sleb128 0
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU421
+	.uleb128 .LVU425
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU421
+	.uleb128 .LVU425
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU423
+	.uleb128 .LVU425
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0xf
+	.byte	0x71
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x74
+	.sleb128 8
+	.byte	0x6
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB133-.Ltext0
+	.uleb128 .LBE133-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0
+.LLRL51:
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB119-.Ltext0
+	.uleb128 .LBE119-.Ltext0
+	.byte	0
+.LLRL53:
+	.byte	0x4
+	.uleb128 .LBB128-.Ltext0
+	.uleb128 .LBE128-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB134-.Ltext0
+	.uleb128 .LBE134-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0
+.LLRL69:
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0
+.LLRL74:
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB146-.Ltext0
+	.uleb128 .LBE146-.Ltext0
+	.byte	0
+.LLRL95:
+	.byte	0x4
+	.uleb128 .LBB185-.Ltext0
+	.uleb128 .LBE185-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB218-.Ltext0
+	.uleb128 .LBE218-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB219-.Ltext0
+	.uleb128 .LBE219-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB279-.Ltext0
+	.uleb128 .LBE279-.Ltext0
+	.byte	0
+.LLRL100:
+	.byte	0x4
+	.uleb128 .LBB187-.Ltext0
+	.uleb128 .LBE187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB202-.Ltext0
+	.uleb128 .LBE202-.Ltext0
+	.byte	0
+.LLRL102:
+	.byte	0x4
+	.uleb128 .LBB188-.Ltext0
+	.uleb128 .LBE188-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB201-.Ltext0
+	.uleb128 .LBE201-.Ltext0
+	.byte	0
+.LLRL104:
+	.byte	0x4
+	.uleb128 .LBB191-.Ltext0
+	.uleb128 .LBE191-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB196-.Ltext0
+	.uleb128 .LBE196-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB197-.Ltext0
+	.uleb128 .LBE197-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB198-.Ltext0
+	.uleb128 .LBE198-.Ltext0
+	.byte	0
+.LLRL108:
+	.byte	0x4
+	.uleb128 .LBB203-.Ltext0
+	.uleb128 .LBE203-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB206-.Ltext0
+	.uleb128 .LBE206-.Ltext0
+	.byte	0
+.LLRL110:
+	.byte	0x4
+	.uleb128 .LBB210-.Ltext0
+	.uleb128 .LBE210-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB217-.Ltext0
+	.uleb128 .LBE217-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB277-.Ltext0
+	.uleb128 .LBE277-.Ltext0
+	.byte	0
+.LLRL113:
+	.byte	0x4
+	.uleb128 .LBB211-.Ltext0
+	.uleb128 .LBE211-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0
+.LLRL116:
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB248-.Ltext0
+	.uleb128 .LBE248-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB275-.Ltext0
+	.uleb128 .LBE275-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB276-.Ltext0
+	.uleb128 .LBE276-.Ltext0
+.LLRL121:
+	.byte	0x4
+	.uleb128 .LBB278-.Ltext0
+	.uleb128 .LBE278-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB280-.Ltext0
+	.uleb128 .LBE280-.Ltext0
+	.byte	0
+.LLRL118:
+	.byte	0x4
+	.uleb128 .LBB222-.Ltext0
+	.uleb128 .LBE222-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB227-.Ltext0
+	.uleb128 .LBE227-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB228-.Ltext0
+	.uleb128 .LBE228-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB229-.Ltext0
+	.uleb128 .LBE229-.Ltext0
+	.byte	0
+.LLRL123:
+	.byte	0x4
+	.uleb128 .LBB232-.Ltext0
+	.uleb128 .LBE232-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB247-.Ltext0
+	.uleb128 .LBE247-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB249-.Ltext0
+	.uleb128 .LBE249-.Ltext0
+	.byte	0
+.LLRL128:
+	.byte	0x4
+	.uleb128 .LBB233-.Ltext0
+	.uleb128 .LBE233-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB246-.Ltext0
+	.uleb128 .LBE246-.Ltext0
+	.byte	0
+.LLRL130:
+	.byte	0x4
+	.uleb128 .LBB234-.Ltext0
+	.uleb128 .LBE234-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB239-.Ltext0
+	.uleb128 .LBE239-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB240-.Ltext0
+	.uleb128 .LBE240-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB244-.Ltext0
+	.uleb128 .LBE244-.Ltext0
+	.byte	0
+.LLRL133:
+	.byte	0x4
+	.uleb128 .LBB241-.Ltext0
+	.uleb128 .LBE241-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB245-.Ltext0
+	.uleb128 .LBE245-.Ltext0
+	.byte	0
+.LLRL136:
+	.byte	0x4
+	.uleb128 .LBB250-.Ltext0
+	.uleb128 .LBE250-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB281-.Ltext0
+	.uleb128 .LBE281-.Ltext0
+	.byte	0
+.LLRL138:
+	.byte	0x4
+	.uleb128 .LBB251-.Ltext0
+	.uleb128 .LBE251-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB274-.Ltext0
+	.uleb128 .LBE274-.Ltext0
+	.byte	0
+.LLRL143:
+	.byte	0x4
+	.uleb128 .LBB253-.Ltext0
+	.uleb128 .LBE253-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB270-.Ltext0
+	.uleb128 .LBE270-.Ltext0
+	.byte	0
+.LLRL145:
+	.byte	0x4
+	.uleb128 .LBB254-.Ltext0
+	.uleb128 .LBE254-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB263-.Ltext0
+	.uleb128 .LBE263-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB264-.Ltext0
+	.uleb128 .LBE264-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB265-.Ltext0
+	.uleb128 .LBE265-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB266-.Ltext0
+	.uleb128 .LBE266-.Ltext0
+	.byte	0
+.LLRL147:
+	.byte	0x4
+	.uleb128 .LBB260-.Ltext0
+	.uleb128 .LBE260-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB269-.Ltext0
+	.uleb128 .LBE269-.Ltext0
+	.byte	0
+.LLRL162:
+	.byte	0x4
+	.uleb128 .LBB295-.Ltext0
+	.uleb128 .LBE295-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB312-.Ltext0
+	.uleb128 .LBE312-.Ltext0
+	.byte	0
+.LLRL164:
+	.byte	0x4
+	.uleb128 .LBB296-.Ltext0
+	.uleb128 .LBE296-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB305-.Ltext0
+	.uleb128 .LBE305-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB306-.Ltext0
+	.uleb128 .LBE306-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB307-.Ltext0
+	.uleb128 .LBE307-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB308-.Ltext0
+	.uleb128 .LBE308-.Ltext0
+	.byte	0
+.LLRL166:
+	.byte	0x4
+	.uleb128 .LBB302-.Ltext0
+	.uleb128 .LBE302-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB311-.Ltext0
+	.uleb128 .LBE311-.Ltext0
+	.byte	0
+.LLRL174:
+	.byte	0x4
+	.uleb128 .LBB315-.Ltext0
+	.uleb128 .LBE315-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB316-.Ltext0
+	.uleb128 .LBE316-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB317-.Ltext0
+	.uleb128 .LBE317-.Ltext0
+	.byte	0
+.LLRL179:
+	.byte	0x4
+	.uleb128 .LBB318-.Ltext0
+	.uleb128 .LBE318-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB319-.Ltext0
+	.uleb128 .LBE319-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB320-.Ltext0
+	.uleb128 .LBE320-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF63:
+	.string	"digit_count"
+.LASF98:
+	.string	"__errno_location"
+.LASF95:
+	.string	"token"
+.LASF58:
+	.string	"result"
+.LASF3:
+	.string	"long unsigned int"
+.LASF93:
+	.string	"numeric_parser_load8"
+.LASF51:
+	.string	"significant"
+.LASF76:
+	.string	"numeric_parser_bigint_mul_pow5"
+.LASF21:
+	.string	"uint64_t"
+.LASF10:
+	.string	"short int"
+.LASF11:
+	.string	"size_t"
+.LASF82:
+	.string	"numeric_parser_eisel_lemire"
+.LASF28:
+	.string	"limbs"
+.LASF37:
+	.string	"stoi64"
+.LASF5:
+	.string	"long long int"
+.LASF72:
+	.string	"numeric_parser_slow_path"
+.LASF60:
+	.string	"first_exponent"
+.LASF47:
+	.string	"integer_digits"
+.LASF46:
+	.string	"mantissa"
+.LASF86:
+	.string	"upperbit"
+.LASF18:
+	.string	"int64_t"
+.LASF40:
+	.string	"value"
+.LASF71:
+	.string	"b_size"
+.LASF99:
+	.string	"__builtin_memset"
+.LASF78:
+	.string	"numeric_parser_bigint_compare"
+.LASF87:
+	.string	"power2"
+.LASF36:
+	.string	"stod_batch"
+.LASF50:
+	.string	"exponent"
+.LASF39:
+	.string	"length"
+.LASF91:
+	.string	"numeric_parser_parse_8_digits"
+.LASF2:
+	.string	"__int128 unsigned"
+.LASF19:
+	.string	"long long unsigned int"
+.LASF54:
+	.string	"bits"
+.LASF53:
+	.string	"significant_digits"
+.LASF69:
+	.string	"order"
+.LASF30:
+	.string	"memset"
+.LASF4:
+	.string	"long int"
+.LASF68:
+	.string	"shift"
+.LASF38:
+	.string	"string"
+.LASF84:
+	.string	"high"
+.LASF49:
+	.string	"mantissa_end"
+.LASF34:
+	.string	"values"
+.LASF85:
+	.string	"precision_mask"
+.LASF42:
+	.string	"digits"
+.LASF27:
+	.string	"NumericParserBigInt"
+.LASF59:
+	.string	"taken"
+.LASF6:
+	.string	"unsigned char"
+.LASF56:
+	.string	"exponent_start"
+.LASF22:
+	.string	"long double"
+.LASF31:
+	.string	"memmove"
+.LASF55:
+	.string	"fraction_start"
+.LASF45:
+	.string	"mantissa_start"
+.LASF9:
+	.string	"signed char"
+.LASF24:
+	.string	"numeric_parser_power_of_five"
+.LASF20:
+	.string	"uint32_t"
+.LASF8:
+	.string	"unsigned int"
+.LASF25:
+	.string	"numeric_parser_power_of_ten"
+.LASF44:
+	.string	"stod"
+.LASF77:
+	.string	"factor"
+.LASF7:
+	.string	"short unsigned int"
+.LASF43:
+	.string	"number"
+.LASF74:
+	.string	"carry"
+.LASF94:
+	.string	"numeric_parser_is_digit"
+.LASF16:
+	.string	"char"
+.LASF17:
+	.string	"int32_t"
+.LASF32:
+	.string	"views"
+.LASF52:
+	.string	"leading_zeros"
+.LASF65:
+	.string	"halfway"
+.LASF96:
+	.string	"numeric_parser_mul128"
+.LASF15:
+	.string	"__uint64_t"
+.LASF62:
+	.string	"decimal"
+.LASF83:
+	.string	"power"
+.LASF79:
+	.string	"numeric_parser_bigint_add"
+.LASF64:
+	.string	"sticky"
+.LASF92:
+	.string	"numeric_parser_is_8_digits"
+.LASF73:
+	.string	"numeric_parser_bigint_shl"
+.LASF23:
+	.string	"double"
+.LASF97:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF13:
+	.string	"__uint32_t"
+.LASF29:
+	.string	"size"
+.LASF81:
+	.string	"product"
+.LASF33:
+	.string	"count"
+.LASF12:
+	.string	"__int32_t"
+.LASF89:
+	.string	"numeric_parser_digits"
+.LASF88:
+	.string	"second_high"
+.LASF41:
+	.string	"negative"
+.LASF70:
+	.string	"a_size"
+.LASF48:
+	.string	"fraction_digits"
+.LASF67:
+	.string	"fits"
+.LASF61:
+	.string	"digit"
+.LASF66:
+	.string	"halfway_mantissa"
+.LASF26:
+	.string	"StringView"
+.LASF35:
+	.string	"stoi64_batch"
+.LASF14:
+	.string	"__int64_t"
+.LASF80:
+	.string	"numeric_parser_bigint_mul"
+.LASF57:
+	.string	"negative_exponent"
+.LASF90:
+	.string	"chunk"
+.LASF75:
+	.string	"limb"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/numeric_parser.c"
+.LASF1:
+	.string	"/root/repo/build/test"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,11285 @@
+	.file	"numeric_string_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/tests/numeric_string_unit_tests.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"0"
+.LC2:
+	.string	"-123"
+.LC3:
+	.string	"456"
+.LC4:
+	.string	"2147483647"
+.LC5:
+	.string	"-2147483648"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC6:
+	.string	"------------------- itos(x) -------------------"
+	.align 8
+.LC7:
+	.string	"itos(%d) failed: returned NULL.\n"
+	.align 8
+.LC8:
+	.string	"itos(%d) failed: expected '%s', got '%s'\n"
+	.section	.rodata.str1.1
+.LC9:
+	.string	"[Passed] itos(%d) is '%s'.\n"
+	.text
+	.p2align 4
+	.globl	run_itos_unit_tests
+	.type	run_itos_unit_tests, @function
+run_itos_unit_tests:
+.LFB26:
+	.file 1 "/root/repo/tests/numeric_string_unit_tests.c"
+	.loc 1 12 27 view -0
+	.cfi_startproc
+	.loc 1 14 3 view .LVU1
+	.loc 1 12 27 is_stmt 0 view .LVU2
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 15 15 view .LVU3
+	leaq	.LC3(%rip), %rcx
+	leaq	.LC4(%rip), %rax
+	.loc 1 12 27 view .LVU4
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 15 15 view .LVU5
+	vmovq	%rcx, %xmm1
+	leaq	.LC1(%rip), %rcx
+	.loc 1 12 27 view .LVU6
+	pushq	%r14
+	.loc 1 15 15 view .LVU7
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	leaq	.LC2(%rip), %rax
+	.loc 1 12 27 view .LVU8
+	pushq	%r13
+	.loc 1 19 3 view .LVU9
+	leaq	.LC6(%rip), %rdi
+	.loc 1 12 27 view .LVU10
+	pushq	%r12
+	pushq	%rbx
+	andq	$-32, %rsp
+	addq	$-128, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 14 7 view .LVU11
+	vmovdqa	.LC0(%rip), %xmm0
+	movl	$-2147483648, 48(%rsp)
+	.loc 1 15 3 is_stmt 1 view .LVU12
+	.loc 1 14 7 is_stmt 0 view .LVU13
+	vmovdqa	%xmm0, 32(%rsp)
+	.loc 1 15 15 view .LVU14
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC5(%rip), %rax
+	movq	%rax, 96(%rsp)
+	.loc 1 17 3 is_stmt 1 view .LVU15
+.LVL0:
+	.loc 1 19 3 view .LVU16
+	.loc 1 15 15 is_stmt 0 view .LVU17
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	vmovdqa	%ymm0, 64(%rsp)
+	.loc 1 19 3 view .LVU18
+	vzeroupper
+.LVL1:
+	call	puts@PLT
+.LVL2:
+	.loc 1 21 3 is_stmt 1 view .LVU19
+	.loc 1 22 3 view .LVU20
+.LBB6:
+	.loc 1 22 8 view .LVU21
+	.loc 1 22 21 view .LVU22
+	leaq	64(%rsp), %rax
+.LBE6:
+	.loc 1 21 7 is_stmt 0 view .LVU23
+	movl	$0, 20(%rsp)
+	movq	%rax, 24(%rsp)
+	.loc 1 19 3 view .LVU24
+	xorl	%r12d, %r12d
+	leaq	32(%rsp), %r15
+	jmp	.L6
+.LVL3:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+.LBB12:
+.LBB7:
+	.loc 1 38 5 is_stmt 1 view .LVU25
+	movq	%rbx, %rdx
+	movl	%r13d, %esi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL4:
+	.loc 1 39 5 view .LVU26
+.LBE7:
+	.loc 1 22 21 is_stmt 0 view .LVU27
+	incq	%r12
+.LVL5:
+.LBB8:
+	.loc 1 39 5 view .LVU28
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL6:
+	.loc 1 39 5 view .LVU29
+.LBE8:
+	.loc 1 22 35 is_stmt 1 view .LVU30
+	.loc 1 22 21 view .LVU31
+	cmpq	$5, %r12
+	je	.L10
+.LVL7:
+.L6:
+.LBB9:
+	.loc 1 23 5 view .LVU32
+	.loc 1 23 9 is_stmt 0 view .LVU33
+	movl	(%r15,%r12,4), %r13d
+.LVL8:
+	.loc 1 24 5 is_stmt 1 view .LVU34
+	.loc 1 24 17 is_stmt 0 view .LVU35
+	movq	24(%rsp), %rax
+	.loc 1 25 20 view .LVU36
+	movl	%r13d, %edi
+	.loc 1 24 17 view .LVU37
+	movq	(%rax,%r12,8), %r14
+.LVL9:
+	.loc 1 25 5 is_stmt 1 view .LVU38
+	.loc 1 25 20 is_stmt 0 view .LVU39
+	call	itos@PLT
+.LVL10:
+	movq	%rax, %rbx
+.LVL11:
+	.loc 1 26 5 is_stmt 1 view .LVU40
+	.loc 1 26 8 is_stmt 0 view .LVU41
+	testq	%rax, %rax
+	je	.L11
+	.loc 1 31 5 is_stmt 1 view .LVU42
+	.loc 1 31 9 is_stmt 0 view .LVU43
+	movq	%r14, %rsi
+	movq	%rax, %rdi
+	call	strcmp@PLT
+.LVL12:
+	.loc 1 31 8 view .LVU44
+	testl	%eax, %eax
+	je	.L4
+	.loc 1 32 7 is_stmt 1 discriminator 1 view .LVU45
+	leaq	.LC8(%rip), %rdi
+	movq	%rbx, %rcx
+	movq	%r14, %rdx
+	movl	%r13d, %esi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL13:
+	.loc 1 33 7 discriminator 1 view .LVU46
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL14:
+	.loc 1 34 7 discriminator 1 view .LVU47
+	.loc 1 35 7 discriminator 1 view .LVU48
+.L3:
+.LBE9:
+	.loc 1 22 21 is_stmt 0 view .LVU49
+	incq	%r12
+.LVL15:
+.LBB10:
+	.loc 1 28 19 view .LVU50
+	movl	$1, 20(%rsp)
+.LVL16:
+	.loc 1 28 19 view .LVU51
+.LBE10:
+	.loc 1 22 35 is_stmt 1 view .LVU52
+	.loc 1 22 21 view .LVU53
+	cmpq	$5, %r12
+	jne	.L6
+.LVL17:
+.L10:
+	.loc 1 22 21 is_stmt 0 view .LVU54
+.LBE12:
+	.loc 1 41 3 is_stmt 1 view .LVU55
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL18:
+	.loc 1 43 3 view .LVU56
+	.loc 1 44 1 is_stmt 0 view .LVU57
+	movl	20(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+.LVL19:
+	.loc 1 44 1 view .LVU58
+	popq	%r12
+	popq	%r13
+.LVL20:
+	.loc 1 44 1 view .LVU59
+	popq	%r14
+.LVL21:
+	.loc 1 44 1 view .LVU60
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL22:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.cfi_restore_state
+.LBB13:
+.LBB11:
+	.loc 1 27 7 is_stmt 1 discriminator 1 view .LVU61
+	movl	%r13d, %esi
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+.LVL23:
+	.loc 1 27 7 is_stmt 0 discriminator 1 view .LVU62
+	call	printf@PLT
+.LVL24:
+	.loc 1 28 7 is_stmt 1 discriminator 1 view .LVU63
+	.loc 1 29 7 discriminator 1 view .LVU64
+	jmp	.L3
+.LBE11:
+.LBE13:
+	.cfi_endproc
+.LFE26:
+	.size	run_itos_unit_tests, .-run_itos_unit_tests
+	.section	.rodata.str1.1
+.LC12:
+	.string	"9"
+.LC13:
+	.string	"10"
+.LC14:
+	.string	"-99"
+.LC15:
+	.string	"100"
+.LC16:
+	.string	"1234567890123"
+.LC17:
+	.string	"9223372036854775807"
+.LC18:
+	.string	"-9223372036854775808"
+	.section	.rodata.str1.8
+	.align 8
+.LC19:
+	.string	"------------------- i64tos_to(x) -------------------"
+	.align 8
+.LC20:
+	.string	"[Failed] i64tos_to(%s) failed: got '%s'\n"
+	.align 8
+.LC21:
+	.string	"[Passed] i64tos_to(%s) is '%s'.\n"
+	.section	.rodata.str1.1
+.LC22:
+	.string	"%llu"
+	.section	.rodata.str1.8
+	.align 8
+.LC23:
+	.string	"[Failed] u64tos_to(%s) failed: got '%s'\n"
+	.section	.rodata.str1.1
+.LC24:
+	.string	"18446744073709551615"
+	.section	.rodata.str1.8
+	.align 8
+.LC25:
+	.string	"[Failed] u64tos_to(UINT64_MAX) failed: got '%s'\n"
+	.text
+	.p2align 4
+	.globl	run_i64tos_unit_tests
+	.type	run_i64tos_unit_tests, @function
+run_i64tos_unit_tests:
+.LFB27:
+	.loc 1 49 29 view -0
+	.cfi_startproc
+	.loc 1 51 3 view .LVU66
+	.loc 1 49 29 is_stmt 0 view .LVU67
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 52 15 view .LVU68
+	leaq	.LC13(%rip), %rcx
+	leaq	.LC14(%rip), %rax
+	.loc 1 49 29 view .LVU69
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 52 15 view .LVU70
+	vmovq	%rcx, %xmm1
+	leaq	.LC1(%rip), %rcx
+	.loc 1 49 29 view .LVU71
+	pushq	%r14
+	.loc 1 52 15 view .LVU72
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	leaq	.LC12(%rip), %rax
+	.loc 1 49 29 view .LVU73
+	pushq	%r13
+	.loc 1 56 3 view .LVU74
+	leaq	.LC19(%rip), %rdi
+	.loc 1 49 29 view .LVU75
+	pushq	%r12
+	pushq	%rbx
+	andq	$-32, %rsp
+	subq	$224, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 51 11 view .LVU76
+	vmovdqa	.LC10(%rip), %ymm0
+	leaq	96(%rsp), %r15
+	vmovdqa	%ymm0, 96(%rsp)
+	vmovdqa	.LC11(%rip), %ymm0
+	leaq	64(%rsp), %rbx
+	vmovdqa	%ymm0, 128(%rsp)
+	.loc 1 52 3 is_stmt 1 view .LVU77
+	.loc 1 52 15 is_stmt 0 view .LVU78
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC17(%rip), %rcx
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC18(%rip), %rax
+	vmovq	%rcx, %xmm1
+	leaq	.LC15(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovdqa	%ymm0, 160(%rsp)
+	leaq	.LC16(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	vmovdqa	%ymm0, 192(%rsp)
+	.loc 1 54 3 is_stmt 1 view .LVU79
+.LVL25:
+	.loc 1 56 3 view .LVU80
+	vzeroupper
+.LVL26:
+	call	puts@PLT
+.LVL27:
+	.loc 1 58 3 view .LVU81
+	.loc 1 59 3 view .LVU82
+.LBB14:
+	.loc 1 59 8 view .LVU83
+	.loc 1 59 21 view .LVU84
+	leaq	160(%rsp), %rax
+.LBE14:
+	.loc 1 58 7 is_stmt 0 view .LVU85
+	movl	$0, 28(%rsp)
+	movq	%rax, 16(%rsp)
+	.loc 1 56 3 view .LVU86
+	xorl	%r12d, %r12d
+	jmp	.L16
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+.LBB19:
+.LBB15:
+	.loc 1 68 5 is_stmt 1 view .LVU87
+	movq	%rbx, %rdx
+	movq	%r14, %rsi
+	leaq	.LC21(%rip), %rdi
+	xorl	%eax, %eax
+.LBE15:
+	.loc 1 59 21 is_stmt 0 view .LVU88
+	addq	$8, %r12
+.LVL29:
+.LBB16:
+	.loc 1 68 5 view .LVU89
+	call	printf@PLT
+.LVL30:
+	.loc 1 68 5 view .LVU90
+.LBE16:
+	.loc 1 59 35 is_stmt 1 view .LVU91
+	.loc 1 59 21 view .LVU92
+	cmpq	$64, %r12
+	je	.L29
+.LVL31:
+.L16:
+.LBB17:
+	.loc 1 60 5 view .LVU93
+	.loc 1 61 5 view .LVU94
+	.loc 1 61 21 is_stmt 0 view .LVU95
+	movq	(%r15,%r12), %rsi
+	movq	%rbx, %rdi
+	call	i64tos_to@PLT
+.LVL32:
+	movq	%rax, %r13
+.LVL33:
+	.loc 1 62 5 is_stmt 1 view .LVU96
+	.loc 1 62 19 is_stmt 0 view .LVU97
+	movq	16(%rsp), %rax
+.LVL34:
+	.loc 1 62 19 view .LVU98
+	movq	(%rax,%r12), %r14
+	movq	%r14, %rdi
+	call	strlen@PLT
+.LVL35:
+	.loc 1 62 8 view .LVU99
+	cmpq	%r13, %rax
+	jne	.L13
+	.loc 1 62 47 discriminator 2 view .LVU100
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL36:
+	.loc 1 62 44 discriminator 2 view .LVU101
+	testl	%eax, %eax
+	je	.L14
+.L13:
+	.loc 1 63 7 is_stmt 1 discriminator 3 view .LVU102
+	movq	%rbx, %rdx
+	movq	%r14, %rsi
+	leaq	.LC20(%rip), %rdi
+	xorl	%eax, %eax
+.LBE17:
+	.loc 1 59 21 is_stmt 0 discriminator 3 view .LVU103
+	addq	$8, %r12
+.LVL37:
+.LBB18:
+	.loc 1 63 7 discriminator 3 view .LVU104
+	call	printf@PLT
+.LVL38:
+	.loc 1 64 7 is_stmt 1 discriminator 3 view .LVU105
+	.loc 1 65 7 discriminator 3 view .LVU106
+	.loc 1 64 19 is_stmt 0 discriminator 3 view .LVU107
+	movl	$1, 28(%rsp)
+.LVL39:
+	.loc 1 64 19 discriminator 3 view .LVU108
+.LBE18:
+	.loc 1 59 35 is_stmt 1 discriminator 3 view .LVU109
+	.loc 1 59 21 discriminator 3 view .LVU110
+	cmpq	$64, %r12
+	jne	.L16
+.LVL40:
+.L29:
+	.loc 1 59 21 is_stmt 0 discriminator 3 view .LVU111
+	movl	$20, %r12d
+.LBE19:
+	.loc 1 73 12 view .LVU112
+	movl	$1, %r15d
+	leaq	32(%rsp), %r13
+.LVL41:
+	.loc 1 73 12 view .LVU113
+	jmp	.L18
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+.LBB20:
+	.loc 1 74 30 is_stmt 1 discriminator 2 view .LVU114
+	.loc 1 74 38 is_stmt 0 discriminator 2 view .LVU115
+	leaq	(%r15,%r15,4), %r8
+	leaq	(%r8,%r8), %r15
+.LVL43:
+	.loc 1 74 21 is_stmt 1 discriminator 2 view .LVU116
+	decl	%r12d
+	je	.L30
+.LVL44:
+.L18:
+	.loc 1 75 5 view .LVU117
+	leaq	-1(%r15), %r14
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	call	u64tos_to@PLT
+.LVL45:
+	.loc 1 76 5 view .LVU118
+	movl	$21, %esi
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	movq	%r14, %rcx
+	leaq	.LC22(%rip), %rdx
+	call	snprintf@PLT
+.LVL46:
+	.loc 1 77 5 view .LVU119
+	.loc 1 77 9 is_stmt 0 view .LVU120
+	movq	%rbx, %rsi
+	movq	%r13, %rdi
+	call	strcmp@PLT
+.LVL47:
+	.loc 1 77 8 view .LVU121
+	testl	%eax, %eax
+	je	.L17
+	.loc 1 78 7 is_stmt 1 view .LVU122
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	leaq	.LC23(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL48:
+	.loc 1 79 7 view .LVU123
+	.loc 1 74 38 is_stmt 0 view .LVU124
+	leaq	(%r15,%r15,4), %r8
+	.loc 1 79 19 view .LVU125
+	movl	$1, 28(%rsp)
+.LVL49:
+	.loc 1 74 30 is_stmt 1 view .LVU126
+	.loc 1 74 38 is_stmt 0 view .LVU127
+	leaq	(%r8,%r8), %r15
+.LVL50:
+	.loc 1 74 21 is_stmt 1 view .LVU128
+	decl	%r12d
+	jne	.L18
+.LVL51:
+.L30:
+	.loc 1 74 21 is_stmt 0 view .LVU129
+.LBE20:
+	.loc 1 82 3 is_stmt 1 view .LVU130
+	movq	$-1, %rsi
+	movq	%r13, %rdi
+	call	u64tos_to@PLT
+.LVL52:
+	.loc 1 83 3 view .LVU131
+	.loc 1 83 7 is_stmt 0 view .LVU132
+	leaq	.LC24(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp@PLT
+.LVL53:
+	.loc 1 83 6 view .LVU133
+	testl	%eax, %eax
+	jne	.L31
+.L19:
+.LVL54:
+	.loc 1 87 3 is_stmt 1 view .LVU134
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL55:
+	.loc 1 89 3 view .LVU135
+	.loc 1 90 1 is_stmt 0 view .LVU136
+	movl	28(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL56:
+	.loc 1 90 1 view .LVU137
+	popq	%rbx
+.LVL57:
+	.loc 1 90 1 view .LVU138
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL58:
+	.loc 1 90 1 view .LVU139
+	ret
+.LVL59:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.cfi_restore_state
+	.loc 1 84 5 is_stmt 1 view .LVU140
+	movq	%r13, %rsi
+	leaq	.LC25(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL60:
+	.loc 1 85 5 view .LVU141
+	.loc 1 85 17 is_stmt 0 view .LVU142
+	movl	$1, 28(%rsp)
+	jmp	.L19
+	.cfi_endproc
+.LFE27:
+	.size	run_i64tos_unit_tests, .-run_i64tos_unit_tests
+	.section	.rodata.str1.1
+.LC31:
+	.string	"0.0000000000000"
+.LC32:
+	.string	"-123.4561295663786"
+.LC33:
+	.string	"789.0123456788999"
+.LC34:
+	.string	"118.0472176809648"
+.LC35:
+	.string	"-118.0472176809648"
+	.section	.rodata.str1.8
+	.align 8
+.LC36:
+	.string	"------------------- ldtos(x) -------------------"
+	.align 8
+.LC37:
+	.string	"[Failed] ldtos(%.13Lf) failed: returned NULL.\n"
+	.align 8
+.LC38:
+	.string	"[Failed] ldtos(%.13Lf) failed: expected '%s', got '%s'\n"
+	.align 8
+.LC39:
+	.string	"[Passed] ldtos(%.13Lf) is '%s'.\n"
+	.text
+	.p2align 4
+	.globl	run_ldtos_unit_tests
+	.type	run_ldtos_unit_tests, @function
+run_ldtos_unit_tests:
+.LFB28:
+	.loc 1 95 28 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 97 3 view .LVU144
+	.loc 1 95 28 is_stmt 0 view .LVU145
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-32, %rsp
+	pushq	-8(%r10)
+	.loc 1 97 15 view .LVU146
+	fldz
+	.loc 1 98 9 view .LVU147
+	leaq	.LC33(%rip), %rcx
+	.loc 1 95 28 view .LVU148
+	pushq	%rbp
+	.loc 1 98 9 view .LVU149
+	leaq	.LC34(%rip), %rax
+	vmovq	%rcx, %xmm1
+	.loc 1 95 28 view .LVU150
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	.loc 1 98 9 view .LVU151
+	leaq	.LC31(%rip), %rdx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	.loc 1 95 28 view .LVU152
+	pushq	%r14
+	.loc 1 98 9 view .LVU153
+	leaq	.LC32(%rip), %rax
+	vmovq	%rdx, %xmm0
+	.loc 1 95 28 view .LVU154
+	pushq	%r13
+	.loc 1 98 9 view .LVU155
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC35(%rip), %rax
+	.loc 1 95 28 view .LVU156
+	pushq	%r12
+	.loc 1 98 9 view .LVU157
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	.loc 1 102 3 view .LVU158
+	leaq	.LC36(%rip), %rdi
+	.loc 1 95 28 view .LVU159
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	leaq	-128(%rbp), %r15
+	leaq	-176(%rbp), %r14
+	pushq	%rbx
+	subq	$160, %rsp
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	.loc 1 97 15 view .LVU160
+	fstpt	-128(%rbp)
+	.loc 1 98 9 view .LVU161
+	movq	%rax, -144(%rbp)
+	.loc 1 97 15 view .LVU162
+	fldl	.LC27(%rip)
+	.loc 1 98 9 view .LVU163
+	vmovdqa	%ymm0, -176(%rbp)
+	.loc 1 97 15 view .LVU164
+	fstpt	-112(%rbp)
+	fldl	.LC28(%rip)
+	fstpt	-96(%rbp)
+	fldl	.LC29(%rip)
+	fstpt	-80(%rbp)
+	fldl	.LC30(%rip)
+	fstpt	-64(%rbp)
+	.loc 1 98 3 is_stmt 1 view .LVU165
+	.loc 1 100 3 view .LVU166
+.LVL61:
+	.loc 1 102 3 view .LVU167
+	vzeroupper
+.LVL62:
+	call	puts@PLT
+.LVL63:
+	.loc 1 104 3 view .LVU168
+	.loc 1 105 3 view .LVU169
+.LBB21:
+	.loc 1 105 8 view .LVU170
+	.loc 1 105 21 view .LVU171
+.LBE21:
+	.loc 1 102 3 is_stmt 0 view .LVU172
+	xorl	%r12d, %r12d
+	.loc 1 104 7 view .LVU173
+	movl	$0, -196(%rbp)
+	jmp	.L37
+.LVL64:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+.LBB27:
+.LBB22:
+	.loc 1 121 5 is_stmt 1 view .LVU174
+	pushq	-184(%rbp)
+	movq	%rbx, %rsi
+	leaq	.LC39(%rip), %rdi
+	pushq	-192(%rbp)
+	xorl	%eax, %eax
+.LBE22:
+	.loc 1 105 21 is_stmt 0 view .LVU175
+	incq	%r12
+.LVL65:
+.LBB23:
+	.loc 1 121 5 view .LVU176
+	call	printf@PLT
+.LVL66:
+	.loc 1 122 5 is_stmt 1 view .LVU177
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL67:
+	popq	%rax
+	popq	%rdx
+	.loc 1 122 5 is_stmt 0 view .LVU178
+.LBE23:
+	.loc 1 105 35 is_stmt 1 view .LVU179
+.LVL68:
+	.loc 1 105 21 view .LVU180
+	cmpq	$5, %r12
+	je	.L40
+.LVL69:
+.L37:
+.LBB24:
+	.loc 1 106 5 view .LVU181
+	.loc 1 106 17 is_stmt 0 view .LVU182
+	movq	%r12, %rax
+	salq	$4, %rax
+	fldt	(%r15,%rax)
+	.loc 1 108 20 view .LVU183
+	subq	$16, %rsp
+	.loc 1 107 17 view .LVU184
+	movq	(%r14,%r12,8), %r13
+	.loc 1 106 17 view .LVU185
+	fld	%st(0)
+	fstpt	-192(%rbp)
+.LVL70:
+	.loc 1 107 5 is_stmt 1 view .LVU186
+	.loc 1 108 5 view .LVU187
+	.loc 1 108 20 is_stmt 0 view .LVU188
+	fstpt	(%rsp)
+	call	ldtos@PLT
+.LVL71:
+	.loc 1 109 8 view .LVU189
+	popq	%r9
+	.loc 1 108 20 view .LVU190
+	movq	%rax, %rbx
+.LVL72:
+	.loc 1 109 5 is_stmt 1 view .LVU191
+	.loc 1 109 8 is_stmt 0 view .LVU192
+	popq	%r10
+	testq	%rax, %rax
+	je	.L41
+	.loc 1 114 5 is_stmt 1 view .LVU193
+	.loc 1 114 9 is_stmt 0 view .LVU194
+	movq	%r13, %rsi
+	movq	%rax, %rdi
+	call	strcmp@PLT
+.LVL73:
+	.loc 1 114 8 view .LVU195
+	testl	%eax, %eax
+	je	.L35
+	.loc 1 115 7 is_stmt 1 discriminator 1 view .LVU196
+	pushq	-184(%rbp)
+	movq	%r13, %rsi
+	movq	%rbx, %rdx
+	pushq	-192(%rbp)
+	leaq	.LC38(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL74:
+	.loc 1 116 7 discriminator 1 view .LVU197
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL75:
+	.loc 1 117 7 discriminator 1 view .LVU198
+	.loc 1 118 7 discriminator 1 view .LVU199
+	popq	%rcx
+	popq	%rsi
+.L34:
+.LBE24:
+	.loc 1 105 21 is_stmt 0 view .LVU200
+	incq	%r12
+.LVL76:
+.LBB25:
+	.loc 1 111 19 view .LVU201
+	movl	$1, -196(%rbp)
+.LVL77:
+	.loc 1 111 19 view .LVU202
+.LBE25:
+	.loc 1 105 35 is_stmt 1 view .LVU203
+	.loc 1 105 21 view .LVU204
+	cmpq	$5, %r12
+	jne	.L37
+.LVL78:
+.L40:
+	.loc 1 105 21 is_stmt 0 view .LVU205
+.LBE27:
+	.loc 1 124 3 is_stmt 1 view .LVU206
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL79:
+	.loc 1 126 3 view .LVU207
+	.loc 1 127 1 is_stmt 0 view .LVU208
+	movl	-196(%rbp), %eax
+	leaq	-48(%rbp), %rsp
+	popq	%rbx
+.LVL80:
+	.loc 1 127 1 view .LVU209
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+.LVL81:
+	.loc 1 127 1 view .LVU210
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+.LVL82:
+	.loc 1 127 1 view .LVU211
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+.LVL83:
+	.loc 1 127 1 view .LVU212
+	ret
+.LVL84:
+	.p2align 4,,10
+	.p2align 3
+.L41:
+	.cfi_restore_state
+.LBB28:
+.LBB26:
+	.loc 1 110 7 is_stmt 1 discriminator 1 view .LVU213
+	pushq	-184(%rbp)
+	leaq	.LC37(%rip), %rdi
+	xorl	%eax, %eax
+.LVL85:
+	.loc 1 110 7 is_stmt 0 discriminator 1 view .LVU214
+	pushq	-192(%rbp)
+	call	printf@PLT
+.LVL86:
+	.loc 1 111 7 is_stmt 1 discriminator 1 view .LVU215
+	.loc 1 112 7 discriminator 1 view .LVU216
+	popq	%rdi
+	popq	%r8
+	jmp	.L34
+.LBE26:
+.LBE28:
+	.cfi_endproc
+.LFE28:
+	.size	run_ldtos_unit_tests, .-run_ldtos_unit_tests
+	.section	.rodata.str1.1
+.LC42:
+	.string	"invalid"
+	.section	.rodata.str1.8
+	.align 8
+.LC43:
+	.string	"------------------- stold(x) -------------------"
+	.align 8
+.LC44:
+	.string	"[Failed]  stold(\"%s\") failed: expected %.13Lf, got %.13Lf, and errno set to %d.\n"
+	.align 8
+.LC45:
+	.string	"[Failed]  stold(\"%s\") failed: expected %.13Lf, got %.13Lf, and expected errno to be set.\n"
+	.align 8
+.LC47:
+	.string	"[Failed]  stold(\"%s\") failed: expected %.13Lf, got %.13Lf.\n"
+	.align 8
+.LC48:
+	.string	"[Passed]  stold(\"%s\") is %.13Lf.\n"
+	.text
+	.p2align 4
+	.globl	run_stold_unit_tests
+	.type	run_stold_unit_tests, @function
+run_stold_unit_tests:
+.LFB30:
+	.loc 1 152 28 view -0
+	.cfi_startproc
+	.loc 1 154 3 view .LVU218
+	.loc 1 152 28 is_stmt 0 view .LVU219
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-32, %rsp
+	pushq	-8(%r10)
+	.loc 1 155 15 view .LVU220
+	fldz
+	.loc 1 154 15 view .LVU221
+	leaq	.LC33(%rip), %rcx
+	.loc 1 152 28 view .LVU222
+	pushq	%rbp
+	.loc 1 154 15 view .LVU223
+	leaq	.LC34(%rip), %rax
+	vmovq	%rcx, %xmm1
+	.loc 1 152 28 view .LVU224
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	.loc 1 154 15 view .LVU225
+	leaq	.LC31(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	.loc 1 152 28 view .LVU226
+	pushq	%r14
+	.loc 1 154 15 view .LVU227
+	leaq	.LC32(%rip), %rax
+	vmovq	%rcx, %xmm0
+	.loc 1 152 28 view .LVU228
+	pushq	%r13
+	.loc 1 154 15 view .LVU229
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	.loc 1 152 28 view .LVU230
+	pushq	%r12
+	.loc 1 154 15 view .LVU231
+	leaq	.LC35(%rip), %rcx
+	leaq	.LC42(%rip), %rax
+	.loc 1 152 28 view .LVU232
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	.loc 1 159 3 view .LVU233
+	leaq	.LC43(%rip), %rdi
+	leaq	-208(%rbp), %r12
+	.loc 1 152 28 view .LVU234
+	pushq	%rbx
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	leaq	-144(%rbp), %rbx
+	subq	$192, %rsp
+	.loc 1 155 15 view .LVU235
+	fstpt	-144(%rbp)
+	fldt	-144(%rbp)
+	.loc 1 154 15 view .LVU236
+	vmovdqa	%ymm0, -208(%rbp)
+	.loc 1 155 15 view .LVU237
+	fldl	.LC27(%rip)
+	.loc 1 154 15 view .LVU238
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 155 15 view .LVU239
+	fstpt	-128(%rbp)
+	.loc 1 154 15 view .LVU240
+	vmovdqa	%xmm0, -176(%rbp)
+	.loc 1 155 3 is_stmt 1 view .LVU241
+	.loc 1 155 15 is_stmt 0 view .LVU242
+	fldl	.LC28(%rip)
+	fstpt	-112(%rbp)
+	fldl	.LC29(%rip)
+	fstpt	-96(%rbp)
+	fldl	.LC30(%rip)
+	fstpt	-80(%rbp)
+	fstpt	-64(%rbp)
+	.loc 1 157 3 is_stmt 1 view .LVU243
+.LVL87:
+	.loc 1 159 3 view .LVU244
+	vzeroupper
+.LVL88:
+	call	puts@PLT
+.LVL89:
+	.loc 1 161 3 view .LVU245
+	.loc 1 162 3 view .LVU246
+.LBB29:
+	.loc 1 162 8 view .LVU247
+	.loc 1 162 21 view .LVU248
+.LBE29:
+	.loc 1 159 3 is_stmt 0 view .LVU249
+	xorl	%r14d, %r14d
+	.loc 1 161 7 view .LVU250
+	xorl	%r13d, %r13d
+.LVL90:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+.LBB37:
+.LBB30:
+	.loc 1 163 5 is_stmt 1 view .LVU251
+	.loc 1 164 17 is_stmt 0 view .LVU252
+	movq	%r14, %rax
+	salq	$4, %rax
+	fldt	(%rbx,%rax)
+	.loc 1 163 17 view .LVU253
+	movq	(%r12,%r14,8), %r15
+.LVL91:
+	.loc 1 164 5 is_stmt 1 view .LVU254
+	.loc 1 164 17 is_stmt 0 view .LVU255
+	fstpt	-240(%rbp)
+.LVL92:
+	.loc 1 165 5 is_stmt 1 view .LVU256
+	.loc 1 165 26 is_stmt 0 view .LVU257
+	movq	%r15, %rdi
+	call	stold@PLT
+.LVL93:
+	.loc 1 165 26 view .LVU258
+	fstpt	-224(%rbp)
+.LVL94:
+	.loc 1 166 5 is_stmt 1 view .LVU259
+	.loc 1 166 10 is_stmt 0 view .LVU260
+	call	__errno_location@PLT
+.LVL95:
+	.loc 1 166 9 view .LVU261
+	movl	(%rax), %edx
+	.loc 1 166 8 view .LVU262
+	fldt	-224(%rbp)
+	testl	%edx, %edx
+	fldt	-240(%rbp)
+	je	.L43
+	.loc 1 166 19 discriminator 1 view .LVU263
+	cmpq	$5, %r14
+	jne	.L57
+.L44:
+	.loc 1 177 5 is_stmt 1 view .LVU264
+.LVL96:
+.LBB31:
+.LBI31:
+	.loc 1 145 12 view .LVU265
+.LBB32:
+	.loc 1 146 3 view .LVU266
+	.loc 1 146 18 is_stmt 0 view .LVU267
+	fld	%st(1)
+	fsub	%st(1), %st
+	.loc 1 146 10 view .LVU268
+	fabs
+.LBE32:
+.LBE31:
+	.loc 1 177 8 view .LVU269
+	fldl	.LC46(%rip)
+	fcomip	%st(1), %st
+	fstp	%st(0)
+	jbe	.L58
+	fstp	%st(0)
+	.loc 1 183 5 is_stmt 1 view .LVU270
+	subq	$16, %rsp
+	fstpt	(%rsp)
+.LVL97:
+	.loc 1 183 5 is_stmt 0 view .LVU271
+	movq	%r15, %rsi
+	leaq	.LC48(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL98:
+	popq	%rax
+	popq	%rdx
+.LVL99:
+.L48:
+	.loc 1 183 5 view .LVU272
+.LBE30:
+	.loc 1 162 35 is_stmt 1 discriminator 2 view .LVU273
+	.loc 1 162 21 discriminator 2 view .LVU274
+	incq	%r14
+.LVL100:
+	.loc 1 162 21 is_stmt 0 discriminator 2 view .LVU275
+	cmpq	$6, %r14
+	jne	.L49
+.LVL101:
+.L46:
+	.loc 1 162 21 discriminator 2 view .LVU276
+.LBE37:
+	.loc 1 185 3 is_stmt 1 view .LVU277
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL102:
+	.loc 1 187 3 view .LVU278
+	.loc 1 188 1 is_stmt 0 view .LVU279
+	leaq	-48(%rbp), %rsp
+	popq	%rbx
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	movl	%r13d, %eax
+	popq	%r13
+	popq	%r14
+	popq	%r15
+.LVL103:
+	.loc 1 188 1 view .LVU280
+	popq	%rbp
+.LVL104:
+	.loc 1 188 1 view .LVU281
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+.LVL105:
+	.loc 1 188 1 view .LVU282
+	ret
+.LVL106:
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	.cfi_restore_state
+.LBB38:
+.LBB33:
+	.loc 1 172 5 is_stmt 1 view .LVU283
+	.loc 1 172 8 is_stmt 0 view .LVU284
+	cmpq	$5, %r14
+	jne	.L44
+	fxch	%st(1)
+	.loc 1 173 7 is_stmt 1 view .LVU285
+	subq	$32, %rsp
+	fstpt	16(%rsp)
+.LVL107:
+	.loc 1 173 7 is_stmt 0 view .LVU286
+	movq	%r15, %rsi
+	leaq	.LC45(%rip), %rdi
+	fstpt	(%rsp)
+	xorl	%eax, %eax
+	.loc 1 169 19 view .LVU287
+	movl	$1, %r13d
+.LVL108:
+	.loc 1 173 7 view .LVU288
+	call	printf@PLT
+.LVL109:
+	.loc 1 174 7 is_stmt 1 view .LVU289
+	.loc 1 175 7 view .LVU290
+	.loc 1 175 7 is_stmt 0 view .LVU291
+.LBE33:
+	.loc 1 162 35 is_stmt 1 view .LVU292
+	.loc 1 162 21 view .LVU293
+.LBB34:
+	.loc 1 173 7 is_stmt 0 view .LVU294
+	addq	$32, %rsp
+	jmp	.L46
+.LVL110:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	.loc 1 173 7 view .LVU295
+	fxch	%st(1)
+	.loc 1 178 7 is_stmt 1 discriminator 1 view .LVU296
+	subq	$32, %rsp
+	fstpt	16(%rsp)
+.LVL111:
+	.loc 1 178 7 is_stmt 0 discriminator 1 view .LVU297
+	movq	%r15, %rsi
+	leaq	.LC47(%rip), %rdi
+	fstpt	(%rsp)
+	xorl	%eax, %eax
+	.loc 1 169 19 discriminator 1 view .LVU298
+	movl	$1, %r13d
+.LVL112:
+	.loc 1 178 7 discriminator 1 view .LVU299
+	call	printf@PLT
+.LVL113:
+	.loc 1 179 7 is_stmt 1 discriminator 1 view .LVU300
+	.loc 1 180 7 discriminator 1 view .LVU301
+	.loc 1 178 7 is_stmt 0 discriminator 1 view .LVU302
+	addq	$32, %rsp
+	jmp	.L48
+.LVL114:
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	.loc 1 178 7 discriminator 1 view .LVU303
+	fxch	%st(1)
+	.loc 1 168 7 is_stmt 1 discriminator 2 view .LVU304
+	subq	$32, %rsp
+	fstpt	16(%rsp)
+.LVL115:
+	.loc 1 168 7 is_stmt 0 discriminator 2 view .LVU305
+	movq	%r15, %rsi
+	leaq	.LC44(%rip), %rdi
+	fstpt	(%rsp)
+	xorl	%eax, %eax
+.LBE34:
+	.loc 1 162 21 discriminator 2 view .LVU306
+	incq	%r14
+.LVL116:
+.LBB35:
+	.loc 1 168 7 discriminator 2 view .LVU307
+	call	printf@PLT
+.LVL117:
+	.loc 1 169 7 is_stmt 1 discriminator 2 view .LVU308
+	.loc 1 170 7 discriminator 2 view .LVU309
+	.loc 1 170 7 is_stmt 0 discriminator 2 view .LVU310
+.LBE35:
+	.loc 1 162 35 is_stmt 1 discriminator 2 view .LVU311
+	.loc 1 162 21 discriminator 2 view .LVU312
+.LBB36:
+	.loc 1 169 19 is_stmt 0 discriminator 2 view .LVU313
+	movl	$1, %r13d
+.LBE36:
+	.loc 1 162 21 discriminator 2 view .LVU314
+	addq	$32, %rsp
+	jmp	.L49
+.LBE38:
+	.cfi_endproc
+.LFE30:
+	.size	run_stold_unit_tests, .-run_stold_unit_tests
+	.section	.rodata.str1.1
+.LC49:
+	.string	"-0.5"
+.LC50:
+	.string	"1e-400"
+.LC51:
+	.string	"1.7976931348623157e308"
+.LC52:
+	.string	"4.9406564584124654e-324"
+.LC53:
+	.string	"9007199254740993"
+	.section	.rodata.str1.8
+	.align 8
+.LC54:
+	.string	"1.00000000000000011102230246251565404236316680908203125"
+	.section	.rodata.str1.1
+.LC55:
+	.string	"12.5e"
+.LC56:
+	.string	"-"
+	.section	.rodata.str1.8
+	.align 8
+.LC62:
+	.string	"------------------- stod(x) -------------------"
+	.align 8
+.LC64:
+	.string	"[Failed]  stod(\"%s\") failed: expected %zu characters converted, got %zu.\n"
+	.align 8
+.LC65:
+	.string	"[Failed]  stod(\"%s\") failed: expected %.17g, got %.17g.\n"
+	.align 8
+.LC66:
+	.string	"[Passed]  stod(\"%s\") is %.17g.\n"
+	.text
+	.p2align 4
+	.globl	run_stod_unit_tests
+	.type	run_stod_unit_tests, @function
+run_stod_unit_tests:
+.LFB31:
+	.loc 1 193 27 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 195 3 view .LVU316
+	.loc 1 193 27 is_stmt 0 view .LVU317
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-32, %rsp
+	pushq	-8(%r10)
+	.loc 1 195 15 view .LVU318
+	leaq	.LC34(%rip), %rcx
+	leaq	.LC50(%rip), %rax
+	.loc 1 193 27 view .LVU319
+	pushq	%rbp
+	.loc 1 195 15 view .LVU320
+	vmovq	%rcx, %xmm1
+	leaq	.LC1(%rip), %rcx
+	.loc 1 193 27 view .LVU321
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	.loc 1 195 15 view .LVU322
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovq	%rcx, %xmm0
+	.loc 1 193 27 view .LVU323
+	pushq	%r14
+	.loc 1 195 15 view .LVU324
+	leaq	.LC49(%rip), %rax
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 193 27 view .LVU325
+	pushq	%r13
+	.loc 1 195 15 view .LVU326
+	leaq	.LC53(%rip), %rcx
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	.loc 1 193 27 view .LVU327
+	pushq	%r12
+	.loc 1 195 15 view .LVU328
+	leaq	.LC54(%rip), %rax
+	vmovq	%rcx, %xmm1
+	.loc 1 193 27 view .LVU329
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	.loc 1 195 15 view .LVU330
+	leaq	.LC51(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	.loc 1 193 27 view .LVU331
+	pushq	%rbx
+	.loc 1 195 15 view .LVU332
+	leaq	.LC52(%rip), %rax
+	.loc 1 201 3 view .LVU333
+	leaq	.LC62(%rip), %rdi
+	.loc 1 193 27 view .LVU334
+	subq	$320, %rsp
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	.loc 1 195 15 view .LVU335
+	vmovdqa	%ymm0, -336(%rbp)
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC55(%rip), %rcx
+	vmovdqa	%ymm0, -304(%rbp)
+	leaq	.LC56(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vmovdqa	%xmm0, -272(%rbp)
+	.loc 1 196 3 is_stmt 1 view .LVU336
+	.loc 1 196 10 is_stmt 0 view .LVU337
+	vmovapd	.LC57(%rip), %ymm0
+	.loc 1 197 10 view .LVU338
+	movq	$4, -80(%rbp)
+	.loc 1 196 10 view .LVU339
+	vmovapd	%ymm0, -240(%rbp)
+	vmovapd	.LC58(%rip), %ymm0
+	.loc 1 197 10 view .LVU340
+	movq	$0, -72(%rbp)
+	.loc 1 196 10 view .LVU341
+	vmovapd	%ymm0, -208(%rbp)
+	vmovq	.LC59(%rip), %xmm0
+	leaq	-336(%rbp), %r14
+	vmovapd	%xmm0, -176(%rbp)
+	.loc 1 197 3 is_stmt 1 view .LVU342
+	.loc 1 199 3 view .LVU343
+.LVL118:
+	.loc 1 201 3 view .LVU344
+	.loc 1 197 10 is_stmt 0 view .LVU345
+	vmovdqa	.LC60(%rip), %ymm0
+	leaq	-144(%rbp), %r12
+	vmovdqa	%ymm0, -144(%rbp)
+	vmovdqa	.LC61(%rip), %ymm0
+	vmovdqa	%ymm0, -112(%rbp)
+	.loc 1 201 3 view .LVU346
+	vzeroupper
+.LVL119:
+	call	puts@PLT
+.LVL120:
+	.loc 1 203 3 is_stmt 1 view .LVU347
+	.loc 1 204 3 view .LVU348
+.LBB39:
+	.loc 1 204 8 view .LVU349
+	.loc 1 204 21 view .LVU350
+	leaq	-344(%rbp), %rax
+	movq	%rax, -360(%rbp)
+.LBE39:
+	.loc 1 201 3 is_stmt 0 view .LVU351
+	xorl	%r13d, %r13d
+	.loc 1 203 7 view .LVU352
+	xorl	%r15d, %r15d
+	jmp	.L65
+.LVL121:
+	.p2align 4,,10
+	.p2align 3
+.L60:
+.LBB44:
+.LBB40:
+	.loc 1 213 5 is_stmt 1 view .LVU353
+	.loc 1 213 33 is_stmt 0 view .LVU354
+	vmovsd	-344(%rbp), %xmm1
+	.loc 1 213 8 view .LVU355
+	testq	%rdx, %rdx
+	je	.L62
+	.loc 1 213 49 discriminator 1 view .LVU356
+	vmovsd	-240(%rbp,%r13), %xmm0
+	.loc 1 213 23 discriminator 1 view .LVU357
+	vucomisd	%xmm1, %xmm0
+	jp	.L66
+	.loc 1 213 23 discriminator 1 view .LVU358
+	jne	.L66
+.L62:
+	.loc 1 219 5 is_stmt 1 view .LVU359
+	vmovsd	%xmm1, %xmm1, %xmm0
+	movq	%rbx, %rsi
+	leaq	.LC66(%rip), %rdi
+	movl	$1, %eax
+.LVL122:
+	.loc 1 219 5 is_stmt 0 view .LVU360
+.LBE40:
+	.loc 1 204 21 view .LVU361
+	addq	$8, %r13
+.LVL123:
+.LBB41:
+	.loc 1 219 5 view .LVU362
+	call	printf@PLT
+.LVL124:
+	.loc 1 219 5 view .LVU363
+.LBE41:
+	.loc 1 204 35 is_stmt 1 view .LVU364
+	.loc 1 204 21 view .LVU365
+	cmpq	$80, %r13
+	je	.L72
+.LVL125:
+.L65:
+.LBB42:
+	.loc 1 205 5 view .LVU366
+	.loc 1 205 17 is_stmt 0 view .LVU367
+	movq	(%r14,%r13), %rbx
+.LVL126:
+	.loc 1 206 5 is_stmt 1 view .LVU368
+	.loc 1 206 12 is_stmt 0 view .LVU369
+	movq	$0x000000000, -344(%rbp)
+	.loc 1 207 5 is_stmt 1 view .LVU370
+	.loc 1 207 23 is_stmt 0 view .LVU371
+	movq	%rbx, %rdi
+	call	strlen@PLT
+.LVL127:
+	movq	-360(%rbp), %rdx
+	movq	%rax, %rsi
+	movq	%rbx, %rdi
+	call	stod@PLT
+.LVL128:
+	.loc 1 208 5 is_stmt 1 view .LVU372
+	.loc 1 208 36 is_stmt 0 view .LVU373
+	movq	(%r12,%r13), %rdx
+	.loc 1 208 8 view .LVU374
+	cmpq	%rax, %rdx
+	je	.L60
+	.loc 1 209 7 is_stmt 1 discriminator 1 view .LVU375
+	movq	%rax, %rcx
+	movq	%rbx, %rsi
+	leaq	.LC64(%rip), %rdi
+	xorl	%eax, %eax
+.LVL129:
+	.loc 1 209 7 is_stmt 0 discriminator 1 view .LVU376
+	call	printf@PLT
+.LVL130:
+	.loc 1 210 7 is_stmt 1 discriminator 1 view .LVU377
+	.loc 1 211 7 discriminator 1 view .LVU378
+.L61:
+	.loc 1 211 7 is_stmt 0 discriminator 1 view .LVU379
+.LBE42:
+	.loc 1 204 21 view .LVU380
+	addq	$8, %r13
+.LVL131:
+	.loc 1 204 21 view .LVU381
+.LBE44:
+	.loc 1 203 7 view .LVU382
+	movl	$1, %r15d
+.LVL132:
+.LBB45:
+	.loc 1 204 35 is_stmt 1 view .LVU383
+	.loc 1 204 21 view .LVU384
+	cmpq	$80, %r13
+	jne	.L65
+.L72:
+	.loc 1 204 21 is_stmt 0 view .LVU385
+.LBE45:
+	.loc 1 221 3 is_stmt 1 view .LVU386
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL133:
+	.loc 1 223 3 view .LVU387
+	.loc 1 224 1 is_stmt 0 view .LVU388
+	addq	$320, %rsp
+	popq	%rbx
+.LVL134:
+	.loc 1 224 1 view .LVU389
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	.loc 1 224 1 view .LVU390
+	movl	%r15d, %eax
+	popq	%r15
+.LVL135:
+	.loc 1 224 1 view .LVU391
+	popq	%rbp
+	.loc 1 224 1 view .LVU392
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+	ret
+.LVL136:
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	.cfi_restore_state
+.LBB46:
+.LBB43:
+	.loc 1 214 7 is_stmt 1 discriminator 2 view .LVU393
+	movq	%rbx, %rsi
+	leaq	.LC65(%rip), %rdi
+	movl	$2, %eax
+.LVL137:
+	.loc 1 214 7 is_stmt 0 discriminator 2 view .LVU394
+	call	printf@PLT
+.LVL138:
+	.loc 1 215 7 is_stmt 1 discriminator 2 view .LVU395
+	.loc 1 216 7 discriminator 2 view .LVU396
+	jmp	.L61
+.LBE43:
+.LBE46:
+	.cfi_endproc
+.LFE31:
+	.size	run_stod_unit_tests, .-run_stod_unit_tests
+	.section	.rodata.str1.1
+.LC67:
+	.string	"de_DE.UTF-8"
+.LC68:
+	.string	"de_DE.utf8"
+.LC69:
+	.string	"fr_FR.UTF-8"
+.LC70:
+	.string	"es_ES.UTF-8"
+.LC71:
+	.string	"1e+21"
+.LC72:
+	.string	"0.1"
+.LC73:
+	.string	"0.00001"
+.LC76:
+	.string	"-1234.5678"
+.LC77:
+	.string	"5e-324"
+.LC78:
+	.string	"1.7976931348623157e+308"
+.LC79:
+	.string	"0.6666666666666666"
+.LC80:
+	.string	"-1234.57"
+.LC81:
+	.string	"118.047"
+.LC82:
+	.string	"4.94066e-324"
+.LC83:
+	.string	"1.79769e+308"
+.LC84:
+	.string	"0.666667"
+	.section	.rodata.str1.8
+	.align 8
+.LC85:
+	.string	"------------------- dtos_to(x) -------------------"
+	.align 8
+.LC86:
+	.string	"[Failed] dtos_to(%.17g) failed: expected '%s', got '%s'\n"
+	.align 8
+.LC87:
+	.string	"[Failed] dtos_precision_to(%.17g, 6) failed: expected '%s', got '%s'\n"
+	.align 8
+.LC88:
+	.string	"[Passed] dtos_to(%.17g) is '%s'.\n"
+	.align 8
+.LC89:
+	.string	"[Passed] dtos_precision_to() locale test skipped: no comma locale is installed."
+	.align 8
+.LC91:
+	.string	"[Failed] dtos_precision_to(-1234.5678, 6) in %s failed: got '%s'\n"
+	.align 8
+.LC92:
+	.string	"[Passed] dtos_precision_to(-1234.5678, 6) in %s is '%s'.\n"
+	.section	.rodata.str1.1
+.LC93:
+	.string	"C"
+	.text
+	.p2align 4
+	.globl	run_dtos_unit_tests
+	.type	run_dtos_unit_tests, @function
+run_dtos_unit_tests:
+.LFB32:
+	.loc 1 229 27 view -0
+	.cfi_startproc
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-32, %rsp
+	pushq	-8(%r10)
+	leaq	.LC69(%rip), %rcx
+	leaq	.LC70(%rip), %rax
+	pushq	%rbp
+	vmovq	%rcx, %xmm0
+	leaq	.LC67(%rip), %rcx
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vmovq	%rcx, %xmm1
+	pushq	%r14
+	leaq	.LC68(%rip), %rax
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	pushq	%r13
+	leaq	.LC72(%rip), %rax
+	vinserti128	$0x1, %xmm0, %ymm1, %ymm4
+	pushq	%r12
+	vmovq	%rax, %xmm1
+	leaq	.LC73(%rip), %rax
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	vmovq	%rax, %xmm0
+	.loc 1 231 3 view .LVU398
+	.loc 1 232 15 is_stmt 0 view .LVU399
+	leaq	.LC34(%rip), %rax
+	.loc 1 229 27 view .LVU400
+	pushq	%rbx
+	leaq	.LC71(%rip), %rdx
+	.loc 1 232 15 view .LVU401
+	vmovq	%rax, %xmm3
+	.loc 1 229 27 view .LVU402
+	subq	$320, %rsp
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	.loc 1 231 10 view .LVU403
+	vmovapd	.LC74(%rip), %ymm2
+	.loc 1 232 15 view .LVU404
+	leaq	.LC76(%rip), %rax
+	.loc 1 231 10 view .LVU405
+	vmovapd	%ymm2, -240(%rbp)
+	vmovapd	.LC75(%rip), %ymm2
+	.loc 1 232 15 view .LVU406
+	vpinsrq	$1, %rdx, %xmm3, %xmm3
+	.loc 1 231 10 view .LVU407
+	vmovapd	%ymm2, -208(%rbp)
+	.loc 1 232 3 is_stmt 1 view .LVU408
+	.loc 1 232 15 is_stmt 0 view .LVU409
+	vpinsrq	$1, %rax, %xmm1, %xmm2
+	vinserti128	$0x1, %xmm3, %ymm2, %ymm2
+	leaq	.LC77(%rip), %rax
+	leaq	.LC78(%rip), %rcx
+	vmovdqa	%ymm2, -176(%rbp)
+	vmovq	%rcx, %xmm3
+	vpinsrq	$1, %rax, %xmm0, %xmm2
+	leaq	.LC79(%rip), %rax
+	vpinsrq	$1, %rax, %xmm3, %xmm3
+	vinserti128	$0x1, %xmm3, %ymm2, %ymm2
+	.loc 1 233 15 view .LVU410
+	leaq	.LC81(%rip), %rax
+	.loc 1 232 15 view .LVU411
+	vmovdqa	%ymm2, -144(%rbp)
+	.loc 1 233 3 is_stmt 1 view .LVU412
+	.loc 1 233 15 is_stmt 0 view .LVU413
+	vmovq	%rax, %xmm2
+	leaq	.LC80(%rip), %rax
+	vpinsrq	$1, %rdx, %xmm2, %xmm2
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vinserti128	$0x1, %xmm2, %ymm1, %ymm1
+	leaq	.LC82(%rip), %rax
+	leaq	.LC83(%rip), %rcx
+	vmovdqa	%ymm1, -112(%rbp)
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vmovq	%rcx, %xmm1
+	leaq	.LC84(%rip), %rax
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	vmovdqa	%ymm4, -368(%rbp)
+	vmovdqa	%ymm0, -80(%rbp)
+	.loc 1 235 3 is_stmt 1 view .LVU414
+.LVL139:
+	.loc 1 237 3 view .LVU415
+	leaq	.LC85(%rip), %rdi
+	vzeroupper
+.LVL140:
+	call	puts@PLT
+.LVL141:
+	.loc 1 239 3 view .LVU416
+	.loc 1 240 3 view .LVU417
+.LBB47:
+	.loc 1 240 8 view .LVU418
+	.loc 1 240 21 view .LVU419
+	leaq	-176(%rbp), %rax
+	movq	%rax, -320(%rbp)
+.LBE47:
+	.loc 1 237 3 is_stmt 0 view .LVU420
+	xorl	%ebx, %ebx
+	.loc 1 239 7 view .LVU421
+	xorl	%r15d, %r15d
+	leaq	-240(%rbp), %r14
+	leaq	-272(%rbp), %r12
+	jmp	.L80
+.LVL142:
+	.p2align 4,,10
+	.p2align 3
+.L76:
+.LBB52:
+.LBB48:
+	.loc 1 248 5 is_stmt 1 view .LVU422
+	vmovsd	-312(%rbp), %xmm0
+	movl	$6, %esi
+	movq	%r12, %rdi
+	call	dtos_precision_to@PLT
+.LVL143:
+	.loc 1 249 5 view .LVU423
+	.loc 1 249 9 is_stmt 0 view .LVU424
+	movq	-112(%rbp,%rbx), %rax
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	movq	%rax, -328(%rbp)
+	call	strcmp@PLT
+.LVL144:
+	.loc 1 249 8 view .LVU425
+	testl	%eax, %eax
+	jne	.L96
+	.loc 1 255 5 is_stmt 1 view .LVU426
+	vmovsd	-312(%rbp), %xmm0
+	movq	%r13, %rsi
+	leaq	.LC88(%rip), %rdi
+	movl	$1, %eax
+.LBE48:
+	.loc 1 240 21 is_stmt 0 view .LVU427
+	addq	$8, %rbx
+.LVL145:
+.LBB49:
+	.loc 1 255 5 view .LVU428
+	call	printf@PLT
+.LVL146:
+	.loc 1 255 5 view .LVU429
+.LBE49:
+	.loc 1 240 35 is_stmt 1 view .LVU430
+	.loc 1 240 21 view .LVU431
+	cmpq	$64, %rbx
+	je	.L97
+.LVL147:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+.LBB50:
+	.loc 1 241 5 view .LVU432
+	.loc 1 242 5 view .LVU433
+	.loc 1 242 21 is_stmt 0 view .LVU434
+	vmovsd	(%r14,%rbx), %xmm5
+	movq	%r12, %rdi
+	vmovsd	%xmm5, %xmm5, %xmm0
+	vmovsd	%xmm5, -312(%rbp)
+	call	dtos_to@PLT
+.LVL148:
+	.loc 1 243 19 view .LVU435
+	movq	%r12, %rdi
+	.loc 1 242 21 view .LVU436
+	movq	%rax, %r13
+.LVL149:
+	.loc 1 243 5 is_stmt 1 view .LVU437
+	.loc 1 243 19 is_stmt 0 view .LVU438
+	call	strlen@PLT
+.LVL150:
+	.loc 1 243 8 view .LVU439
+	cmpq	%r13, %rax
+	.loc 1 243 37 view .LVU440
+	movq	-320(%rbp), %rax
+	movq	(%rax,%rbx), %r13
+.LVL151:
+	.loc 1 243 8 view .LVU441
+	jne	.L75
+	.loc 1 243 37 discriminator 2 view .LVU442
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+.LVL152:
+	.loc 1 243 34 discriminator 2 view .LVU443
+	testl	%eax, %eax
+	je	.L76
+.L75:
+	.loc 1 244 7 is_stmt 1 discriminator 3 view .LVU444
+	vmovsd	-312(%rbp), %xmm0
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	leaq	.LC86(%rip), %rdi
+	movl	$1, %eax
+	call	printf@PLT
+.LVL153:
+	.loc 1 245 7 discriminator 3 view .LVU445
+	.loc 1 246 7 discriminator 3 view .LVU446
+.L77:
+	.loc 1 246 7 is_stmt 0 discriminator 3 view .LVU447
+.LBE50:
+	.loc 1 240 21 view .LVU448
+	addq	$8, %rbx
+.LVL154:
+	.loc 1 240 21 view .LVU449
+.LBE52:
+	.loc 1 239 7 view .LVU450
+	movl	$1, %r15d
+.LVL155:
+.LBB53:
+	.loc 1 240 35 is_stmt 1 view .LVU451
+	.loc 1 240 21 view .LVU452
+	cmpq	$64, %rbx
+	jne	.L80
+.L97:
+	.loc 1 240 21 is_stmt 0 view .LVU453
+.LBE53:
+	.loc 1 258 3 is_stmt 1 view .LVU454
+	.loc 1 258 15 is_stmt 0 view .LVU455
+	vmovdqa	-368(%rbp), %ymm6
+.LBB54:
+	.loc 1 260 15 view .LVU456
+	xorl	%ebx, %ebx
+.LBE54:
+	.loc 1 258 15 view .LVU457
+	vmovdqa	%ymm6, -304(%rbp)
+	.loc 1 259 3 is_stmt 1 view .LVU458
+.LVL156:
+	.loc 1 260 3 view .LVU459
+.LBB55:
+	.loc 1 260 8 view .LVU460
+	.loc 1 260 63 view .LVU461
+	leaq	-304(%rbp), %r14
+	vzeroupper
+.LVL157:
+.L81:
+	.loc 1 261 5 discriminator 3 view .LVU462
+	.loc 1 261 14 is_stmt 0 discriminator 3 view .LVU463
+	movq	(%r14,%rbx,8), %rsi
+	movl	$1, %edi
+	call	setlocale@PLT
+.LVL158:
+	.loc 1 260 82 discriminator 3 view .LVU464
+	incq	%rbx
+.LVL159:
+	.loc 1 261 14 discriminator 3 view .LVU465
+	movq	%rax, %r13
+.LVL160:
+	.loc 1 260 82 is_stmt 1 discriminator 3 view .LVU466
+	.loc 1 260 63 discriminator 3 view .LVU467
+	cmpq	$3, %rbx
+	ja	.L89
+	testq	%rax, %rax
+	je	.L81
+.L83:
+.LBE55:
+.LBB56:
+	.loc 1 267 5 view .LVU468
+	.loc 1 268 5 view .LVU469
+	vmovsd	.LC90(%rip), %xmm0
+	movl	$6, %esi
+	movq	%r12, %rdi
+	call	dtos_precision_to@PLT
+.LVL161:
+	.loc 1 269 5 view .LVU470
+	.loc 1 269 9 is_stmt 0 view .LVU471
+	movabsq	$3978136647583805741, %rax
+	.loc 1 270 7 view .LVU472
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	.loc 1 269 9 view .LVU473
+	cmpq	%rax, -272(%rbp)
+	je	.L98
+.LVL162:
+.L85:
+	.loc 1 270 7 is_stmt 1 view .LVU474
+	leaq	.LC91(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL163:
+	.loc 1 271 7 view .LVU475
+	.loc 1 271 19 is_stmt 0 view .LVU476
+	movl	$1, %r15d
+.LVL164:
+.L88:
+	.loc 1 276 5 is_stmt 1 view .LVU477
+	leaq	.LC93(%rip), %rsi
+	movl	$1, %edi
+	call	setlocale@PLT
+.LVL165:
+.L84:
+	.loc 1 276 5 is_stmt 0 view .LVU478
+.LBE56:
+	.loc 1 278 3 is_stmt 1 view .LVU479
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL166:
+	.loc 1 280 3 view .LVU480
+	.loc 1 281 1 is_stmt 0 view .LVU481
+	addq	$320, %rsp
+	popq	%rbx
+.LVL167:
+	.loc 1 281 1 view .LVU482
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+.LVL168:
+	.loc 1 281 1 view .LVU483
+	popq	%r14
+	movl	%r15d, %eax
+	popq	%r15
+.LVL169:
+	.loc 1 281 1 view .LVU484
+	popq	%rbp
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+	ret
+.LVL170:
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	.cfi_restore_state
+.LBB57:
+.LBB51:
+	.loc 1 250 7 is_stmt 1 discriminator 1 view .LVU485
+	movq	-328(%rbp), %rsi
+	vmovsd	-312(%rbp), %xmm0
+	movq	%r12, %rdx
+	leaq	.LC87(%rip), %rdi
+	movl	$1, %eax
+	call	printf@PLT
+.LVL171:
+	.loc 1 251 7 discriminator 1 view .LVU486
+	.loc 1 252 7 discriminator 1 view .LVU487
+	jmp	.L77
+.LVL172:
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	.loc 1 252 7 is_stmt 0 discriminator 1 view .LVU488
+.LBE51:
+.LBE57:
+	.loc 1 263 3 is_stmt 1 view .LVU489
+	.loc 1 263 6 is_stmt 0 view .LVU490
+	testq	%rax, %rax
+	jne	.L83
+	.loc 1 264 5 is_stmt 1 view .LVU491
+	leaq	.LC89(%rip), %rdi
+	call	puts@PLT
+.LVL173:
+	.loc 1 264 5 is_stmt 0 view .LVU492
+	jmp	.L84
+.LVL174:
+	.p2align 4,,10
+	.p2align 3
+.L98:
+.LBB58:
+	.loc 1 269 9 view .LVU493
+	cmpb	$0, -264(%rbp)
+	jne	.L85
+	.loc 1 274 7 is_stmt 1 view .LVU494
+	leaq	.LC92(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL175:
+	.loc 1 274 7 is_stmt 0 view .LVU495
+	jmp	.L88
+.LBE58:
+	.cfi_endproc
+.LFE32:
+	.size	run_dtos_unit_tests, .-run_dtos_unit_tests
+	.section	.rodata.str1.1
+.LC94:
+	.string	"-42"
+.LC95:
+	.string	"+7"
+.LC96:
+	.string	"12345678"
+.LC97:
+	.string	"123456789012345678"
+.LC98:
+	.string	"9223372036854775808"
+.LC99:
+	.string	"-9223372036854775809"
+.LC100:
+	.string	"000000000000000000000001"
+.LC101:
+	.string	"99999999999999999999"
+.LC102:
+	.string	"12.5"
+.LC103:
+	.string	"3e4,"
+.LC104:
+	.string	"x"
+	.section	.rodata.str1.8
+	.align 8
+.LC111:
+	.string	"------------------- stoi64(x) -------------------"
+	.align 8
+.LC112:
+	.string	"[Failed]  stoi64(\"%s\") failed: expected %lld in %zu characters, got %lld in %zu.\n"
+	.align 8
+.LC113:
+	.string	"[Passed]  stoi64(\"%s\") is %lld.\n"
+	.text
+	.p2align 4
+	.globl	run_stoi64_unit_tests
+	.type	run_stoi64_unit_tests, @function
+run_stoi64_unit_tests:
+.LFB33:
+	.loc 1 286 29 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 288 3 view .LVU497
+	.loc 1 286 29 is_stmt 0 view .LVU498
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 288 15 view .LVU499
+	leaq	.LC95(%rip), %rdi
+	leaq	.LC96(%rip), %rax
+	.loc 1 286 29 view .LVU500
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 288 15 view .LVU501
+	vmovq	%rdi, %xmm1
+	leaq	.LC1(%rip), %rdi
+	.loc 1 286 29 view .LVU502
+	pushq	%r14
+	.loc 1 288 15 view .LVU503
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovq	%rdi, %xmm0
+	.loc 1 286 29 view .LVU504
+	pushq	%r13
+	.loc 1 288 15 view .LVU505
+	leaq	.LC94(%rip), %rax
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 286 29 view .LVU506
+	pushq	%r12
+	.loc 1 288 15 view .LVU507
+	leaq	.LC18(%rip), %rdi
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	.loc 1 286 29 view .LVU508
+	pushq	%rbx
+	.loc 1 288 15 view .LVU509
+	leaq	.LC98(%rip), %rax
+	vmovq	%rdi, %xmm1
+	.loc 1 286 29 view .LVU510
+	andq	$-32, %rsp
+	subq	$416, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 288 15 view .LVU511
+	leaq	.LC97(%rip), %rdi
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovdqa	%ymm0, 32(%rsp)
+	leaq	.LC17(%rip), %rax
+	vmovq	%rdi, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC101(%rip), %rcx
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC102(%rip), %rax
+	vmovq	%rcx, %xmm1
+	leaq	.LC99(%rip), %rdx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovdqa	%ymm0, 64(%rsp)
+	leaq	.LC100(%rip), %rax
+	vmovq	%rdx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC103(%rip), %rdi
+	vmovdqa	%ymm0, 96(%rsp)
+	leaq	.LC56(%rip), %rax
+	vmovq	%rdi, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vmovdqa	%xmm0, 128(%rsp)
+	.loc 1 289 11 view .LVU512
+	vmovdqa	.LC105(%rip), %ymm0
+	.loc 1 288 15 view .LVU513
+	leaq	.LC104(%rip), %rax
+	.loc 1 289 11 view .LVU514
+	vmovdqa	%ymm0, 160(%rsp)
+	vmovdqa	.LC106(%rip), %ymm0
+	.loc 1 288 15 view .LVU515
+	movq	%rax, 144(%rsp)
+	.loc 1 289 3 is_stmt 1 view .LVU516
+	.loc 1 289 11 is_stmt 0 view .LVU517
+	vmovdqa	%ymm0, 192(%rsp)
+	vmovdqa	.LC107(%rip), %ymm0
+	movq	$3, 256(%rsp)
+	vmovdqa	%ymm0, 224(%rsp)
+	.loc 1 290 10 view .LVU518
+	vmovdqa	.LC108(%rip), %ymm0
+	.loc 1 289 11 view .LVU519
+	movq	$0, 264(%rsp)
+	.loc 1 290 10 view .LVU520
+	vmovdqa	%ymm0, 288(%rsp)
+	vmovdqa	.LC109(%rip), %ymm0
+	.loc 1 289 11 view .LVU521
+	movq	$0, 272(%rsp)
+	.loc 1 290 3 is_stmt 1 view .LVU522
+	.loc 1 290 10 is_stmt 0 view .LVU523
+	vmovdqa	%ymm0, 320(%rsp)
+	movq	$1, 384(%rsp)
+	vmovdqa	.LC110(%rip), %ymm0
+	movq	$0, 392(%rsp)
+	movq	$0, 400(%rsp)
+	.loc 1 292 3 is_stmt 1 view .LVU524
+.LVL176:
+	.loc 1 294 3 view .LVU525
+	.loc 1 290 10 is_stmt 0 view .LVU526
+	vmovdqa	%ymm0, 352(%rsp)
+	.loc 1 294 3 view .LVU527
+	leaq	.LC111(%rip), %rdi
+	vzeroupper
+.LVL177:
+	call	puts@PLT
+.LVL178:
+	.loc 1 296 3 is_stmt 1 view .LVU528
+	.loc 1 297 3 view .LVU529
+.LBB59:
+	.loc 1 297 8 view .LVU530
+	.loc 1 297 21 view .LVU531
+	leaq	24(%rsp), %rax
+	movq	%rax, 8(%rsp)
+.LBE59:
+	.loc 1 294 3 is_stmt 0 view .LVU532
+	xorl	%r13d, %r13d
+	.loc 1 296 7 view .LVU533
+	xorl	%r15d, %r15d
+	leaq	32(%rsp), %r14
+	leaq	288(%rsp), %r12
+	jmp	.L104
+.LVL179:
+	.p2align 4,,10
+	.p2align 3
+.L100:
+.LBB64:
+.LBB60:
+	.loc 1 301 68 discriminator 2 view .LVU534
+	movq	24(%rsp), %r8
+	.loc 1 301 40 discriminator 2 view .LVU535
+	testq	%rcx, %rcx
+	je	.L102
+	.loc 1 301 85 discriminator 3 view .LVU536
+	movq	160(%rsp,%r13), %rdx
+	.loc 1 301 58 discriminator 3 view .LVU537
+	cmpq	%r8, %rdx
+	jne	.L101
+.L102:
+	.loc 1 307 5 is_stmt 1 view .LVU538
+	movq	%r8, %rdx
+	movq	%rbx, %rsi
+	leaq	.LC113(%rip), %rdi
+	xorl	%eax, %eax
+.LVL180:
+	.loc 1 307 5 is_stmt 0 view .LVU539
+.LBE60:
+	.loc 1 297 21 view .LVU540
+	addq	$8, %r13
+.LVL181:
+.LBB61:
+	.loc 1 307 5 view .LVU541
+	call	printf@PLT
+.LVL182:
+	.loc 1 307 5 view .LVU542
+.LBE61:
+	.loc 1 297 35 is_stmt 1 view .LVU543
+	.loc 1 297 21 view .LVU544
+	cmpq	$120, %r13
+	je	.L110
+.LVL183:
+.L104:
+.LBB62:
+	.loc 1 298 5 view .LVU545
+	.loc 1 298 17 is_stmt 0 view .LVU546
+	movq	(%r14,%r13), %rbx
+.LVL184:
+	.loc 1 299 5 is_stmt 1 view .LVU547
+	.loc 1 299 13 is_stmt 0 view .LVU548
+	movq	$0, 24(%rsp)
+	.loc 1 300 5 is_stmt 1 view .LVU549
+	.loc 1 300 23 is_stmt 0 view .LVU550
+	movq	%rbx, %rdi
+	call	strlen@PLT
+.LVL185:
+	movq	8(%rsp), %rdx
+	movq	%rax, %rsi
+	movq	%rbx, %rdi
+	call	stoi64@PLT
+.LVL186:
+	.loc 1 301 36 view .LVU551
+	movq	(%r12,%r13), %rcx
+	.loc 1 300 23 view .LVU552
+	movq	%rax, %r9
+.LVL187:
+	.loc 1 301 5 is_stmt 1 view .LVU553
+	.loc 1 301 8 is_stmt 0 view .LVU554
+	cmpq	%rax, %rcx
+	je	.L100
+	.loc 1 301 85 view .LVU555
+	movq	160(%rsp,%r13), %rdx
+	.loc 1 301 68 view .LVU556
+	movq	24(%rsp), %r8
+.L101:
+	.loc 1 302 7 is_stmt 1 discriminator 4 view .LVU557
+	movq	%rbx, %rsi
+	leaq	.LC112(%rip), %rdi
+	xorl	%eax, %eax
+.LVL188:
+	.loc 1 302 7 is_stmt 0 discriminator 4 view .LVU558
+.LBE62:
+	.loc 1 297 21 discriminator 4 view .LVU559
+	addq	$8, %r13
+.LVL189:
+.LBB63:
+	.loc 1 302 7 discriminator 4 view .LVU560
+	call	printf@PLT
+.LVL190:
+	.loc 1 303 7 is_stmt 1 discriminator 4 view .LVU561
+	.loc 1 304 7 discriminator 4 view .LVU562
+	.loc 1 303 19 is_stmt 0 discriminator 4 view .LVU563
+	movl	$1, %r15d
+.LVL191:
+	.loc 1 303 19 discriminator 4 view .LVU564
+.LBE63:
+	.loc 1 297 35 is_stmt 1 discriminator 4 view .LVU565
+	.loc 1 297 21 discriminator 4 view .LVU566
+	cmpq	$120, %r13
+	jne	.L104
+.L110:
+	.loc 1 297 21 is_stmt 0 discriminator 4 view .LVU567
+.LBE64:
+	.loc 1 309 3 is_stmt 1 view .LVU568
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL192:
+	.loc 1 311 3 view .LVU569
+	.loc 1 312 1 is_stmt 0 view .LVU570
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+.LVL193:
+	.loc 1 312 1 view .LVU571
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	.loc 1 312 1 view .LVU572
+	movl	%r15d, %eax
+	popq	%r15
+.LVL194:
+	.loc 1 312 1 view .LVU573
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	.loc 1 312 1 view .LVU574
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	run_stoi64_unit_tests, .-run_stoi64_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC115:
+	.string	"------------------- stoi64_batch(x) / stod_batch(x) -------------------"
+	.align 8
+.LC121:
+	.string	"[Failed] %zu of %d integers round trip.\n"
+	.align 8
+.LC122:
+	.string	"[Passed] %d integers round trip through %zu characters.\n"
+	.align 8
+.LC123:
+	.string	"[Failed] %zu of %d doubles round trip.\n"
+	.align 8
+.LC124:
+	.string	"[Passed] %d doubles round trip through %zu characters.\n"
+	.section	.rodata.str1.1
+.LC125:
+	.string	"12"
+.LC126:
+	.string	"1.5"
+.LC127:
+	.string	"7"
+	.section	.rodata.str1.8
+	.align 8
+.LC128:
+	.string	"[Failed] The invalid view was not reported."
+	.align 8
+.LC129:
+	.string	"[Passed] The invalid view was reported at index 1."
+	.text
+	.p2align 4
+	.globl	run_numeric_batch_unit_tests
+	.type	run_numeric_batch_unit_tests, @function
+run_numeric_batch_unit_tests:
+.LFB34:
+	.loc 1 317 36 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 319 3 view .LVU576
+	.loc 1 317 36 is_stmt 0 view .LVU577
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 319 3 view .LVU578
+	leaq	.LC115(%rip), %rdi
+	.loc 1 317 36 view .LVU579
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-32, %rsp
+	subq	$56224, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 319 3 view .LVU580
+	call	puts@PLT
+.LVL195:
+	.loc 1 320 3 is_stmt 1 view .LVU581
+	.loc 1 321 3 view .LVU582
+	.loc 1 322 3 view .LVU583
+	.loc 1 323 3 view .LVU584
+	.loc 1 324 3 view .LVU585
+.LBB65:
+	.loc 1 324 8 view .LVU586
+	.loc 1 324 21 view .LVU587
+	leaq	8192(%rsp), %rdx
+	movl	$8, %ecx
+	vpbroadcastd	%ecx, %ymm7
+	movq	%rdx, 128(%rsp)
+	.loc 1 325 31 is_stmt 0 view .LVU588
+	movl	$-500, %ecx
+	leaq	192(%rsp), %r14
+	vpbroadcastd	%ecx, %ymm6
+.LBE65:
+	.loc 1 319 3 view .LVU589
+	vmovdqa	.LC114(%rip), %ymm3
+.LBB66:
+	.loc 1 325 44 view .LVU590
+	movabsq	$9876543210123, %rcx
+	vbroadcastsd	.LC120(%rip), %ymm5
+	movq	%r14, %rax
+	movq	%rdx, %rsi
+	vpbroadcastq	%rcx, %ymm4
+.LVL196:
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	.loc 1 325 44 view .LVU591
+	vmovdqa	%ymm3, %ymm0
+	.loc 1 325 31 discriminator 3 view .LVU592
+	vpaddd	%ymm6, %ymm0, %ymm0
+	.loc 1 325 19 discriminator 3 view .LVU593
+	vpmovsxdq	%xmm0, %ymm1
+	.loc 1 325 44 discriminator 3 view .LVU594
+	vpmullq	%ymm4, %ymm1, %ymm1
+	addq	$64, %rax
+	vpaddd	%ymm7, %ymm3, %ymm3
+	.loc 1 325 5 is_stmt 1 discriminator 3 view .LVU595
+	addq	$64, %rdx
+	.loc 1 325 17 is_stmt 0 discriminator 3 view .LVU596
+	vmovdqa	%ymm1, -64(%rax)
+	.loc 1 325 19 discriminator 3 view .LVU597
+	vextracti128	$0x1, %ymm0, %xmm1
+	vpmovsxdq	%xmm1, %ymm2
+	.loc 1 326 34 discriminator 3 view .LVU598
+	vcvtdq2pd	%xmm0, %ymm0
+	vcvtdq2pd	%xmm1, %ymm1
+	vdivpd	%ymm5, %ymm0, %ymm0
+	.loc 1 325 44 discriminator 3 view .LVU599
+	vpmullq	%ymm4, %ymm2, %ymm2
+	.loc 1 325 17 discriminator 3 view .LVU600
+	vmovdqa	%ymm2, -32(%rax)
+	.loc 1 326 5 is_stmt 1 discriminator 3 view .LVU601
+	.loc 1 326 34 is_stmt 0 discriminator 3 view .LVU602
+	vdivpd	%ymm5, %ymm1, %ymm1
+	.loc 1 326 16 discriminator 3 view .LVU603
+	vmovapd	%ymm0, -64(%rdx)
+	vmovapd	%ymm1, -32(%rdx)
+	.loc 1 324 31 is_stmt 1 discriminator 3 view .LVU604
+	.loc 1 324 21 discriminator 3 view .LVU605
+	cmpq	%rsi, %rax
+	jne	.L112
+.LBE66:
+	.loc 1 328 3 view .LVU606
+	.loc 1 328 15 is_stmt 0 view .LVU607
+	movabsq	$-9223372036854775808, %rax
+	movq	%rax, 192(%rsp)
+	.loc 1 329 3 is_stmt 1 view .LVU608
+	.loc 1 329 15 is_stmt 0 view .LVU609
+	decq	%rax
+	movq	%rax, 200(%rsp)
+	.loc 1 331 3 is_stmt 1 view .LVU610
+	.loc 1 331 26 is_stmt 0 view .LVU611
+	movl	$32000, %edi
+	.loc 1 336 19 view .LVU612
+	leaq	32192(%rsp), %r15
+	.loc 1 331 26 view .LVU613
+	vzeroupper
+.LVL197:
+	call	malloc@PLT
+.LVL198:
+	.loc 1 336 19 view .LVU614
+	movq	%rax, %rdi
+	movq	%r15, %rcx
+	movl	$1000, %edx
+	movq	%r14, %rsi
+	.loc 1 331 26 view .LVU615
+	movq	%rax, %rbx
+.LVL199:
+	.loc 1 332 3 is_stmt 1 view .LVU616
+	.loc 1 333 3 view .LVU617
+	.loc 1 334 3 view .LVU618
+	.loc 1 335 3 view .LVU619
+	.loc 1 336 3 view .LVU620
+	leaq	40224(%rsp), %r12
+	.loc 1 336 19 is_stmt 0 view .LVU621
+	movq	%r15, 88(%rsp)
+	call	i64tos_batch@PLT
+.LVL200:
+	.loc 1 336 19 view .LVU622
+	movq	%rax, %rcx
+.LVL201:
+	.loc 1 337 3 is_stmt 1 view .LVU623
+.LBB67:
+	.loc 1 337 8 view .LVU624
+	.loc 1 337 21 view .LVU625
+	vpbroadcastq	%rbx, %ymm3
+	movq	%r15, %rdx
+	movq	%r12, %r13
+	leaq	40192(%rsp), %rsi
+.LBE67:
+	.loc 1 336 19 is_stmt 0 view .LVU626
+	movq	%r12, %rax
+.LVL202:
+	.p2align 4,,10
+	.p2align 3
+.L113:
+.LBB68:
+	.loc 1 338 5 is_stmt 1 discriminator 3 view .LVU627
+	.loc 1 338 36 is_stmt 0 discriminator 3 view .LVU628
+	vmovdqa	(%rdx), %ymm1
+	.loc 1 339 35 discriminator 3 view .LVU629
+	vmovdqu	8(%rdx), %ymm6
+	.loc 1 338 27 discriminator 3 view .LVU630
+	vpaddq	%ymm3, %ymm1, %ymm0
+	.loc 1 338 18 discriminator 3 view .LVU631
+	vextracti64x2	$1, %ymm0, %xmm2
+	vmovq	%xmm0, (%rax)
+	vpextrq	$1, %xmm0, 16(%rax)
+	valignq	$3, %ymm0, %ymm0, %ymm0
+	addq	$32, %rdx
+	addq	$64, %rax
+	vmovq	%xmm2, -32(%rax)
+	vmovq	%xmm0, -16(%rax)
+	.loc 1 339 5 is_stmt 1 discriminator 3 view .LVU632
+	.loc 1 339 35 is_stmt 0 discriminator 3 view .LVU633
+	vpsubq	%ymm1, %ymm6, %ymm0
+	.loc 1 339 18 discriminator 3 view .LVU634
+	vextracti64x2	$1, %ymm0, %xmm1
+	vmovq	%xmm0, -56(%rax)
+	vpextrq	$1, %xmm0, -40(%rax)
+	valignq	$3, %ymm0, %ymm0, %ymm0
+	vmovq	%xmm1, -24(%rax)
+	vmovq	%xmm0, -8(%rax)
+	.loc 1 337 31 is_stmt 1 discriminator 3 view .LVU635
+	.loc 1 337 21 discriminator 3 view .LVU636
+	cmpq	%rsi, %rdx
+	jne	.L113
+.LBE68:
+	.loc 1 341 22 is_stmt 0 view .LVU637
+	leaq	16192(%rsp), %rax
+	movq	%rcx, 32(%rsp)
+	.loc 1 341 3 is_stmt 1 view .LVU638
+	.loc 1 341 22 is_stmt 0 view .LVU639
+	movq	%rax, 136(%rsp)
+	vmovdqa	%ymm3, (%rsp)
+	movq	%rax, %rdx
+	movl	$1000, %esi
+	movq	%r12, %rdi
+	vzeroupper
+.LVL203:
+	call	stoi64_batch@PLT
+.LVL204:
+	.loc 1 342 3 is_stmt 1 view .LVU640
+	.loc 1 342 17 is_stmt 0 view .LVU641
+	movq	%rbx, %rdi
+	.loc 1 341 22 view .LVU642
+	movq	%rax, 96(%rsp)
+.LVL205:
+	.loc 1 342 17 view .LVU643
+	call	strlen@PLT
+.LVL206:
+	.loc 1 342 6 view .LVU644
+	movq	32(%rsp), %rcx
+	vmovdqa	(%rsp), %ymm3
+	cmpq	%rcx, %rax
+	jne	.L114
+	.loc 1 342 60 discriminator 1 view .LVU645
+	cmpq	%rcx, 40192(%rsp)
+	jne	.L114
+	cmpq	$1000, 96(%rsp)
+	je	.L128
+.L114:
+	.loc 1 343 5 view .LVU646
+	movq	96(%rsp), %rsi
+	vmovdqa	%ymm3, 32(%rsp)
+.LVL207:
+	.loc 1 343 5 is_stmt 1 view .LVU647
+	xorl	%eax, %eax
+	movl	$1000, %edx
+	leaq	.LC121(%rip), %rdi
+	vzeroupper
+.LVL208:
+	call	printf@PLT
+.LVL209:
+	.loc 1 344 5 view .LVU648
+	.loc 1 344 17 is_stmt 0 view .LVU649
+	vmovdqa	32(%rsp), %ymm3
+	movl	$1, %r14d
+.LVL210:
+.L116:
+	.loc 1 349 12 view .LVU650
+	movq	88(%rsp), %rcx
+	movq	128(%rsp), %rsi
+	vmovdqa	%ymm3, 96(%rsp)
+.LVL211:
+	.loc 1 349 3 is_stmt 1 view .LVU651
+	.loc 1 349 12 is_stmt 0 view .LVU652
+	movl	$1000, %edx
+	movq	%rbx, %rdi
+	vzeroupper
+.LVL212:
+	call	dtos_batch@PLT
+.LVL213:
+	vmovdqa	96(%rsp), %ymm3
+	movq	%rax, 88(%rsp)
+.LVL214:
+	.loc 1 350 3 is_stmt 1 view .LVU653
+.LBB69:
+	.loc 1 350 8 view .LVU654
+	.loc 1 350 21 view .LVU655
+	leaq	16000(%r12), %rax
+.LVL215:
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	.loc 1 351 5 discriminator 3 view .LVU656
+	.loc 1 351 36 is_stmt 0 discriminator 3 view .LVU657
+	vmovdqa	(%r15), %ymm1
+	.loc 1 352 35 discriminator 3 view .LVU658
+	vmovdqu	8(%r15), %ymm7
+	.loc 1 351 27 discriminator 3 view .LVU659
+	vpaddq	%ymm3, %ymm1, %ymm0
+	.loc 1 351 18 discriminator 3 view .LVU660
+	vextracti64x2	$1, %ymm0, %xmm2
+	vmovq	%xmm0, 0(%r13)
+	vpextrq	$1, %xmm0, 16(%r13)
+	valignq	$3, %ymm0, %ymm0, %ymm0
+	addq	$64, %r13
+	addq	$32, %r15
+	vmovq	%xmm2, -32(%r13)
+	vmovq	%xmm0, -16(%r13)
+	.loc 1 352 5 is_stmt 1 discriminator 3 view .LVU661
+	.loc 1 352 35 is_stmt 0 discriminator 3 view .LVU662
+	vpsubq	%ymm1, %ymm7, %ymm0
+	.loc 1 352 18 discriminator 3 view .LVU663
+	vextracti64x2	$1, %ymm0, %xmm1
+	vmovq	%xmm0, -56(%r13)
+	vpextrq	$1, %xmm0, -40(%r13)
+	valignq	$3, %ymm0, %ymm0, %ymm0
+	vmovq	%xmm1, -24(%r13)
+	vmovq	%xmm0, -8(%r13)
+	.loc 1 350 31 is_stmt 1 discriminator 3 view .LVU664
+	.loc 1 350 21 discriminator 3 view .LVU665
+	cmpq	%rax, %r13
+	jne	.L117
+.LBE69:
+	.loc 1 354 3 view .LVU666
+	.loc 1 354 15 is_stmt 0 view .LVU667
+	leaq	24192(%rsp), %r13
+	movq	%r12, %rdi
+	movq	%r13, %rdx
+	movl	$1000, %esi
+	vzeroupper
+.LVL216:
+	call	stod_batch@PLT
+.LVL217:
+	movq	%rax, %r12
+.LVL218:
+	.loc 1 355 3 is_stmt 1 view .LVU668
+	.loc 1 355 17 is_stmt 0 view .LVU669
+	movq	%rbx, %rdi
+	call	strlen@PLT
+.LVL219:
+	.loc 1 355 32 view .LVU670
+	cmpq	$1000, %r12
+	jne	.L118
+	movq	88(%rsp), %rcx
+	cmpq	%rcx, %rax
+	je	.L129
+.L118:
+	.loc 1 356 5 is_stmt 1 view .LVU671
+	movl	$1000, %edx
+	movq	%r12, %rsi
+	leaq	.LC123(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL220:
+	.loc 1 357 5 view .LVU672
+	.loc 1 357 17 is_stmt 0 view .LVU673
+	movl	$1, %r14d
+.LVL221:
+.L120:
+	.loc 1 363 3 is_stmt 1 view .LVU674
+	.loc 1 363 21 is_stmt 0 view .LVU675
+	leaq	.LC125(%rip), %rax
+	movq	%rax, 144(%rsp)
+	.loc 1 364 7 view .LVU676
+	leaq	144(%rsp), %r12
+.LVL222:
+	.loc 1 363 21 view .LVU677
+	leaq	.LC126(%rip), %rax
+	.loc 1 364 7 view .LVU678
+	movq	136(%rsp), %rdx
+	.loc 1 363 21 view .LVU679
+	movq	%rax, 160(%rsp)
+	.loc 1 364 7 view .LVU680
+	movl	$3, %esi
+	.loc 1 363 21 view .LVU681
+	leaq	.LC127(%rip), %rax
+	.loc 1 364 7 view .LVU682
+	movq	%r12, %rdi
+	.loc 1 363 21 view .LVU683
+	movq	$2, 152(%rsp)
+	movq	$3, 168(%rsp)
+	movq	%rax, 176(%rsp)
+	movq	$1, 184(%rsp)
+	.loc 1 364 3 is_stmt 1 view .LVU684
+	.loc 1 364 7 is_stmt 0 view .LVU685
+	call	stoi64_batch@PLT
+.LVL223:
+	.loc 1 364 6 view .LVU686
+	cmpq	$1, %rax
+	je	.L121
+.L123:
+	.loc 1 365 5 is_stmt 1 view .LVU687
+	leaq	.LC128(%rip), %rdi
+	call	puts@PLT
+.LVL224:
+	.loc 1 366 5 view .LVU688
+	.loc 1 366 17 is_stmt 0 view .LVU689
+	movl	$1, %r14d
+.LVL225:
+.L122:
+	.loc 1 371 3 is_stmt 1 view .LVU690
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL226:
+	.loc 1 372 3 view .LVU691
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL227:
+	.loc 1 374 3 view .LVU692
+	.loc 1 375 1 is_stmt 0 view .LVU693
+	leaq	-40(%rbp), %rsp
+.LVL228:
+	.loc 1 375 1 view .LVU694
+	popq	%rbx
+.LVL229:
+	.loc 1 375 1 view .LVU695
+	popq	%r12
+	popq	%r13
+	movl	%r14d, %eax
+	popq	%r14
+.LVL230:
+	.loc 1 375 1 view .LVU696
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL231:
+	.loc 1 375 1 view .LVU697
+	ret
+.LVL232:
+.L121:
+	.cfi_restore_state
+	.loc 1 364 57 discriminator 1 view .LVU698
+	movq	%r13, %rdx
+	movl	$3, %esi
+	movq	%r12, %rdi
+	call	stod_batch@PLT
+.LVL233:
+	.loc 1 364 54 discriminator 1 view .LVU699
+	cmpq	$3, %rax
+	jne	.L123
+	.loc 1 369 5 is_stmt 1 view .LVU700
+	leaq	.LC129(%rip), %rdi
+	call	puts@PLT
+.LVL234:
+	jmp	.L122
+.LVL235:
+.L129:
+	.loc 1 355 57 is_stmt 0 discriminator 2 view .LVU701
+	movq	128(%rsp), %rdi
+	movl	$8000, %edx
+	movq	%r13, %rsi
+	call	memcmp@PLT
+.LVL236:
+	.loc 1 355 54 discriminator 2 view .LVU702
+	testl	%eax, %eax
+	jne	.L118
+	.loc 1 360 5 is_stmt 1 view .LVU703
+	movq	88(%rsp), %rdx
+	movl	$1000, %esi
+	leaq	.LC124(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL237:
+	jmp	.L120
+.LVL238:
+.L128:
+	.loc 1 342 85 is_stmt 0 discriminator 3 view .LVU704
+	movq	136(%rsp), %rsi
+	movq	%r14, %rdi
+	movl	$8000, %edx
+	vzeroupper
+.LVL239:
+	call	memcmp@PLT
+.LVL240:
+	.loc 1 342 82 discriminator 3 view .LVU705
+	testl	%eax, %eax
+	movq	32(%rsp), %rcx
+	vmovdqa	(%rsp), %ymm3
+	.loc 1 342 85 discriminator 3 view .LVU706
+	movl	%eax, %r14d
+	.loc 1 342 82 discriminator 3 view .LVU707
+	jne	.L114
+	vmovdqa	%ymm3, 96(%rsp)
+	.loc 1 347 5 is_stmt 1 view .LVU708
+	xorl	%eax, %eax
+	movq	%rcx, %rdx
+	movl	$1000, %esi
+	leaq	.LC122(%rip), %rdi
+	vzeroupper
+.LVL241:
+	call	printf@PLT
+.LVL242:
+	vmovdqa	96(%rsp), %ymm3
+	jmp	.L116
+	.cfi_endproc
+.LFE34:
+	.size	run_numeric_batch_unit_tests, .-run_numeric_batch_unit_tests
+	.section	.rodata.str1.1
+.LC136:
+	.string	"0.12"
+.LC137:
+	.string	"2"
+.LC138:
+	.string	"4"
+.LC139:
+	.string	"-0.000"
+.LC140:
+	.string	"0.01"
+.LC141:
+	.string	"1.00"
+.LC142:
+	.string	"-1234.6"
+.LC143:
+	.string	"0.0000"
+.LC144:
+	.string	"100000000000000000000.00"
+.LC145:
+	.string	"0.10000000000000000555"
+	.section	.rodata.str1.8
+	.align 8
+.LC146:
+	.ascii	"17976931348623157081452742373170435679807056752584499"
+	.string	"6598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368"
+	.section	.rodata.str1.1
+.LC147:
+	.string	"inf"
+.LC148:
+	.string	"-inf"
+	.section	.rodata.str1.8
+	.align 8
+.LC149:
+	.string	"------------------- dtos_fixed_to(x) -------------------"
+	.align 8
+.LC150:
+	.string	"[Failed] dtos_fixed_to(%.17g, %d) failed: expected '%s', got '%s'\n"
+	.align 8
+.LC151:
+	.string	"[Passed] dtos_fixed_to(%.17g, %d) is '%.32s'.\n"
+	.section	.rodata.str1.1
+.LC154:
+	.string	"%.*f"
+	.section	.rodata.str1.8
+	.align 8
+.LC155:
+	.string	"[Passed] dtos_fixed_to() matches printf(\"%%.*f\") for 100000 values.\n"
+	.section	.rodata.str1.1
+.LC158:
+	.string	"1.500 -0.250 %.3f "
+	.section	.rodata.str1.8
+	.align 8
+.LC159:
+	.string	"[Failed] st_append_fixed() failed: expected '%s', got '%.*s'\n"
+	.align 8
+.LC160:
+	.string	"[Passed] st_append_fixed() appends %zu characters.\n"
+	.text
+	.p2align 4
+	.globl	run_dtos_fixed_unit_tests
+	.type	run_dtos_fixed_unit_tests, @function
+run_dtos_fixed_unit_tests:
+.LFB35:
+	.loc 1 380 33 view -0
+	.cfi_startproc
+	.loc 1 382 3 view .LVU710
+	.loc 1 380 33 is_stmt 0 view .LVU711
+	leaq	8(%rsp), %r10
+	.cfi_def_cfa 10, 0
+	andq	$-32, %rsp
+	pushq	-8(%r10)
+	.loc 1 384 15 view .LVU712
+	leaq	.LC138(%rip), %rcx
+	vmovq	%rcx, %xmm1
+	.loc 1 380 33 view .LVU713
+	pushq	%rbp
+	.loc 1 384 15 view .LVU714
+	leaq	.LC136(%rip), %rcx
+	.loc 1 388 3 view .LVU715
+	leaq	.LC149(%rip), %rdi
+	.loc 1 380 33 view .LVU716
+	movq	%rsp, %rbp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	pushq	%r15
+	.cfi_escape 0x10,0xf,0x2,0x76,0x78
+	leaq	-1040(%rbp), %r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	.cfi_escape 0x10,0xe,0x2,0x76,0x70
+	.cfi_escape 0x10,0xd,0x2,0x76,0x68
+	.cfi_escape 0x10,0xc,0x2,0x76,0x60
+	leaq	-720(%rbp), %r12
+	pushq	%r10
+	.cfi_escape 0xf,0x3,0x76,0x58,0x6
+	pushq	%rbx
+	subq	$1056, %rsp
+	.cfi_escape 0x10,0x3,0x2,0x76,0x50
+	.loc 1 382 10 view .LVU717
+	vmovapd	.LC130(%rip), %ymm0
+	movq	.LC133(%rip), %rax
+	vmovapd	%ymm0, -976(%rbp)
+	vmovapd	.LC131(%rip), %ymm0
+	movq	%rax, -880(%rbp)
+	.loc 1 383 3 is_stmt 1 view .LVU718
+	.loc 1 382 10 is_stmt 0 view .LVU719
+	vmovapd	%ymm0, -944(%rbp)
+	vmovapd	.LC132(%rip), %ymm0
+	.loc 1 384 15 view .LVU720
+	leaq	.LC139(%rip), %rax
+	.loc 1 382 10 view .LVU721
+	vmovapd	%ymm0, -912(%rbp)
+	.loc 1 383 7 view .LVU722
+	vmovdqa	.LC134(%rip), %ymm0
+	.loc 1 384 15 view .LVU723
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	.loc 1 383 7 view .LVU724
+	vmovdqa	%ymm0, -1040(%rbp)
+	vmovdqa	.LC135(%rip), %xmm0
+	.loc 1 384 15 view .LVU725
+	leaq	.LC137(%rip), %rax
+	.loc 1 383 7 view .LVU726
+	vmovdqa	%xmm0, -1008(%rbp)
+	.loc 1 384 15 view .LVU727
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC142(%rip), %rcx
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC143(%rip), %rax
+	vmovq	%rcx, %xmm1
+	leaq	.LC140(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovdqa	%ymm0, -848(%rbp)
+	leaq	.LC141(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC146(%rip), %rcx
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC147(%rip), %rax
+	vmovq	%rcx, %xmm1
+	leaq	.LC144(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovdqa	%ymm0, -816(%rbp)
+	leaq	.LC145(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC148(%rip), %rax
+	movq	%rax, -752(%rbp)
+	.loc 1 383 7 view .LVU728
+	movl	$2, -992(%rbp)
+	.loc 1 384 3 is_stmt 1 view .LVU729
+	.loc 1 386 3 view .LVU730
+.LVL243:
+	.loc 1 388 3 view .LVU731
+	.loc 1 384 15 is_stmt 0 view .LVU732
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	vmovdqa	%ymm0, -784(%rbp)
+	.loc 1 388 3 view .LVU733
+	vzeroupper
+.LVL244:
+	call	puts@PLT
+.LVL245:
+	.loc 1 390 3 is_stmt 1 view .LVU734
+	.loc 1 391 3 view .LVU735
+	.loc 1 392 3 view .LVU736
+.LBB70:
+	.loc 1 392 8 view .LVU737
+	.loc 1 392 21 view .LVU738
+	leaq	-976(%rbp), %rax
+	movq	%rax, -1088(%rbp)
+	leaq	-848(%rbp), %rax
+.LBE70:
+	.loc 1 390 7 is_stmt 0 view .LVU739
+	movl	$0, -1100(%rbp)
+	movq	%rax, -1096(%rbp)
+	.loc 1 388 3 view .LVU740
+	xorl	%ebx, %ebx
+	jmp	.L135
+.LVL246:
+	.p2align 4,,10
+	.p2align 3
+.L133:
+.LBB75:
+.LBB71:
+	.loc 1 400 5 is_stmt 1 view .LVU741
+	vmovsd	-1080(%rbp), %xmm0
+	movq	%r12, %rdx
+	movl	%r14d, %esi
+	leaq	.LC151(%rip), %rdi
+	movl	$1, %eax
+.LBE71:
+	.loc 1 392 21 is_stmt 0 view .LVU742
+	incq	%rbx
+.LVL247:
+.LBB72:
+	.loc 1 400 5 view .LVU743
+	call	printf@PLT
+.LVL248:
+	.loc 1 400 5 view .LVU744
+.LBE72:
+	.loc 1 392 35 is_stmt 1 view .LVU745
+	.loc 1 392 21 view .LVU746
+	cmpq	$13, %rbx
+	je	.L158
+.LVL249:
+.L135:
+.LBB73:
+	.loc 1 393 5 view .LVU747
+	.loc 1 393 21 is_stmt 0 view .LVU748
+	movq	-1088(%rbp), %rax
+	movl	(%r15,%rbx,4), %r14d
+	vmovsd	(%rax,%rbx,8), %xmm5
+	movl	%r14d, %esi
+	vmovsd	%xmm5, %xmm5, %xmm0
+	movq	%r12, %rdi
+	vmovsd	%xmm5, -1080(%rbp)
+	call	dtos_fixed_to@PLT
+.LVL250:
+	.loc 1 394 19 view .LVU749
+	movq	%r12, %rdi
+	.loc 1 393 21 view .LVU750
+	movq	%rax, %r13
+.LVL251:
+	.loc 1 394 5 is_stmt 1 view .LVU751
+	.loc 1 394 19 is_stmt 0 view .LVU752
+	call	strlen@PLT
+.LVL252:
+	.loc 1 394 8 view .LVU753
+	cmpq	%r13, %rax
+	.loc 1 394 37 view .LVU754
+	movq	-1096(%rbp), %rax
+	movq	(%rax,%rbx,8), %r13
+.LVL253:
+	.loc 1 394 8 view .LVU755
+	jne	.L132
+	.loc 1 394 37 discriminator 2 view .LVU756
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+.LVL254:
+	.loc 1 394 34 discriminator 2 view .LVU757
+	testl	%eax, %eax
+	je	.L133
+.L132:
+	.loc 1 395 7 is_stmt 1 discriminator 3 view .LVU758
+	vmovsd	-1080(%rbp), %xmm0
+	movq	%r12, %rcx
+	movq	%r13, %rdx
+	movl	%r14d, %esi
+	leaq	.LC150(%rip), %rdi
+	movl	$1, %eax
+.LBE73:
+	.loc 1 392 21 is_stmt 0 discriminator 3 view .LVU759
+	incq	%rbx
+.LVL255:
+.LBB74:
+	.loc 1 395 7 discriminator 3 view .LVU760
+	call	printf@PLT
+.LVL256:
+	.loc 1 396 7 is_stmt 1 discriminator 3 view .LVU761
+	.loc 1 397 7 discriminator 3 view .LVU762
+	.loc 1 396 19 is_stmt 0 discriminator 3 view .LVU763
+	movl	$1, -1100(%rbp)
+.LVL257:
+	.loc 1 396 19 discriminator 3 view .LVU764
+.LBE74:
+	.loc 1 392 35 is_stmt 1 discriminator 3 view .LVU765
+	.loc 1 392 21 discriminator 3 view .LVU766
+	cmpq	$13, %rbx
+	jne	.L135
+.LVL258:
+.L158:
+	.loc 1 392 21 is_stmt 0 discriminator 3 view .LVU767
+.LBE75:
+	.loc 1 405 7 view .LVU768
+	movl	$0, -1088(%rbp)
+.LBB76:
+	.loc 1 406 12 view .LVU769
+	xorl	%ebx, %ebx
+.LBE76:
+	.loc 1 404 12 view .LVU770
+	movabsq	$-7046029254386353131, %r15
+	leaq	-384(%rbp), %r13
+	jmp	.L139
+.LVL259:
+	.p2align 4,,10
+	.p2align 3
+.L138:
+.LBB79:
+.LBB77:
+	.loc 1 415 52 view .LVU771
+	incl	-1088(%rbp)
+.LVL260:
+.L137:
+	.loc 1 415 52 view .LVU772
+.LBE77:
+	.loc 1 406 32 is_stmt 1 discriminator 2 view .LVU773
+	incl	%ebx
+.LVL261:
+	.loc 1 406 21 discriminator 2 view .LVU774
+	cmpl	$100000, %ebx
+	je	.L159
+.LVL262:
+.L139:
+.LBB78:
+	.loc 1 407 5 view .LVU775
+	.loc 1 407 20 is_stmt 0 view .LVU776
+	movq	%r15, %rdx
+	salq	$13, %rdx
+	.loc 1 407 11 view .LVU777
+	xorq	%r15, %rdx
+.LVL263:
+	.loc 1 408 5 is_stmt 1 view .LVU778
+	.loc 1 408 20 is_stmt 0 view .LVU779
+	movq	%rdx, %rax
+	shrq	$7, %rax
+	.loc 1 408 11 view .LVU780
+	xorq	%rdx, %rax
+.LVL264:
+	.loc 1 409 5 is_stmt 1 view .LVU781
+	.loc 1 409 20 is_stmt 0 view .LVU782
+	movq	%rax, %r8
+	salq	$17, %r8
+	.loc 1 409 11 view .LVU783
+	xorq	%rax, %r8
+	.loc 1 410 44 view .LVU784
+	movq	%r8, %rax
+.LVL265:
+	.loc 1 410 44 view .LVU785
+	shrq	$11, %rax
+	.loc 1 410 20 view .LVU786
+	vxorpd	%xmm2, %xmm2, %xmm2
+	vcvtsi2sdq	%rax, %xmm2, %xmm0
+	.loc 1 410 67 view .LVU787
+	movl	$1, %eax
+	shlx	%r8, %rax, %rax
+	.loc 1 409 11 view .LVU788
+	movq	%r8, %r15
+.LVL266:
+	.loc 1 410 5 is_stmt 1 view .LVU789
+	.loc 1 410 20 is_stmt 0 view .LVU790
+	vmovsd	%xmm0, %xmm0, %xmm1
+	.loc 1 410 53 view .LVU791
+	vcvtusi2sdq	%rax, %xmm2, %xmm0
+	.loc 1 410 12 view .LVU792
+	vdivsd	%xmm0, %xmm1, %xmm3
+	vmovsd	%xmm3, -1080(%rbp)
+.LVL267:
+	.loc 1 411 5 is_stmt 1 view .LVU793
+	.loc 1 411 32 is_stmt 0 view .LVU794
+	testb	$1, %bl
+	je	.L136
+	.loc 1 411 34 discriminator 1 view .LVU795
+	vxorpd	.LC152(%rip), %xmm3, %xmm0
+	.loc 1 411 32 discriminator 1 view .LVU796
+	vdivsd	.LC153(%rip), %xmm0, %xmm4
+	vmovsd	%xmm4, -1080(%rbp)
+.L136:
+.LVL268:
+	.loc 1 412 5 is_stmt 1 discriminator 4 view .LVU797
+	.loc 1 412 9 is_stmt 0 discriminator 4 view .LVU798
+	movslq	%ebx, %r14
+	imulq	$818089009, %r14, %r14
+	movl	%ebx, %eax
+	sarl	$31, %eax
+	sarq	$34, %r14
+	subl	%eax, %r14d
+	leal	(%r14,%r14,4), %eax
+	leal	(%r14,%rax,4), %eax
+	movl	%ebx, %r14d
+	subl	%eax, %r14d
+.LVL269:
+	.loc 1 413 5 is_stmt 1 discriminator 4 view .LVU799
+	vmovsd	-1080(%rbp), %xmm0
+	movl	%r14d, %ecx
+	leaq	.LC154(%rip), %rdx
+	movl	$332, %esi
+	movq	%r13, %rdi
+	movl	$1, %eax
+	call	snprintf@PLT
+.LVL270:
+	.loc 1 414 5 discriminator 4 view .LVU800
+	vmovsd	-1080(%rbp), %xmm0
+	movl	%r14d, %esi
+	movq	%r12, %rdi
+	call	dtos_fixed_to@PLT
+.LVL271:
+	.loc 1 415 5 discriminator 4 view .LVU801
+	.loc 1 415 9 is_stmt 0 discriminator 4 view .LVU802
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	call	strcmp@PLT
+.LVL272:
+	.loc 1 415 8 discriminator 4 view .LVU803
+	testl	%eax, %eax
+	je	.L137
+.LVL273:
+	.loc 1 415 39 discriminator 1 view .LVU804
+	cmpl	$4, -1088(%rbp)
+	jg	.L138
+	.loc 1 416 7 is_stmt 1 view .LVU805
+	vmovsd	-1080(%rbp), %xmm0
+	movq	%r12, %rcx
+	movq	%r13, %rdx
+	movl	%r14d, %esi
+	leaq	.LC150(%rip), %rdi
+	movl	$1, %eax
+	call	printf@PLT
+.LVL274:
+	jmp	.L138
+.LVL275:
+.L159:
+	.loc 1 416 7 is_stmt 0 view .LVU806
+.LBE78:
+.LBE79:
+	.loc 1 419 3 is_stmt 1 view .LVU807
+	.loc 1 419 6 is_stmt 0 view .LVU808
+	movl	-1088(%rbp), %eax
+	testl	%eax, %eax
+	je	.L160
+	.loc 1 420 17 view .LVU809
+	movl	$1, -1100(%rbp)
+.L140:
+.LVL276:
+	.loc 1 426 3 is_stmt 1 view .LVU810
+	.loc 1 426 39 is_stmt 0 view .LVU811
+	movl	$1, %edi
+	call	st_create_empty@PLT
+.LVL277:
+	movq	%rax, %rbx
+.LVL278:
+	.loc 1 427 3 is_stmt 1 view .LVU812
+	.loc 1 427 10 is_stmt 0 view .LVU813
+	movq	.LC157(%rip), %rax
+.LVL279:
+	.loc 1 427 10 view .LVU814
+	vmovapd	.LC156(%rip), %xmm0
+	movq	%rax, -1056(%rbp)
+	.loc 1 428 3 is_stmt 1 view .LVU815
+.LVL280:
+	.loc 1 429 3 view .LVU816
+.LBB80:
+	.loc 1 429 8 view .LVU817
+	.loc 1 429 21 view .LVU818
+	leaq	-1048(%rbp), %rax
+	movq	%rax, -1080(%rbp)
+.LVL281:
+	.loc 1 429 21 is_stmt 0 view .LVU819
+.LBE80:
+	.loc 1 427 10 view .LVU820
+	vmovapd	%xmm0, -1072(%rbp)
+	leaq	-1072(%rbp), %r15
+.LVL282:
+	.loc 1 427 10 view .LVU821
+	leaq	-1056(%rbp), %r14
+.LVL283:
+	.loc 1 428 7 view .LVU822
+	movl	$1, %r12d
+.LVL284:
+.L142:
+.LBB81:
+	.loc 1 430 5 is_stmt 1 view .LVU823
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	movl	$3, %edx
+	call	st_append_fixed@PLT
+.LVL285:
+	.loc 1 431 5 view .LVU824
+	movl	$32, %esi
+	movq	%rbx, %rdi
+	call	st_append_char@PLT
+.LVL286:
+	.loc 1 432 5 view .LVU825
+	.loc 1 432 27 is_stmt 0 view .LVU826
+	cmpq	%r14, %r15
+	je	.L141
+	.loc 1 432 27 discriminator 2 view .LVU827
+	xorl	%eax, %eax
+	cmpl	$3, 56(%rbx)
+	sete	%al
+	.loc 1 432 17 discriminator 2 view .LVU828
+	andl	%eax, %r12d
+.LVL287:
+	.loc 1 429 27 is_stmt 1 discriminator 2 view .LVU829
+	.loc 1 429 21 discriminator 2 view .LVU830
+	movq	-1080(%rbp), %rax
+	addq	$8, %r15
+.LVL288:
+	.loc 1 429 21 is_stmt 0 discriminator 2 view .LVU831
+	cmpq	%rax, %r15
+	jne	.L142
+.LVL289:
+.L141:
+	.loc 1 429 21 discriminator 2 view .LVU832
+.LBE81:
+	.loc 1 434 3 is_stmt 1 view .LVU833
+	movq	.LC157(%rip), %rax
+	leaq	.LC158(%rip), %rdx
+	vmovq	%rax, %xmm0
+	movl	$332, %esi
+	movq	%r13, %rdi
+	movl	$1, %eax
+	call	snprintf@PLT
+.LVL290:
+	.loc 1 435 3 view .LVU834
+	.loc 1 435 6 is_stmt 0 view .LVU835
+	testl	%r12d, %r12d
+	.loc 1 435 36 view .LVU836
+	movq	16(%rbx), %r12
+	.loc 1 435 6 view .LVU837
+	je	.L161
+	.loc 1 435 50 discriminator 1 view .LVU838
+	movq	%r13, %rdi
+	call	strlen@PLT
+.LVL291:
+	.loc 1 435 87 discriminator 1 view .LVU839
+	movq	(%rbx), %rcx
+	.loc 1 435 24 discriminator 1 view .LVU840
+	cmpq	%rax, %r12
+	je	.L162
+.L144:
+	.loc 1 436 5 is_stmt 1 view .LVU841
+	movl	%r12d, %edx
+	movq	%r13, %rsi
+	leaq	.LC159(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL292:
+	.loc 1 437 5 view .LVU842
+	.loc 1 437 17 is_stmt 0 view .LVU843
+	movl	$1, -1100(%rbp)
+.LVL293:
+.L146:
+	.loc 1 442 3 is_stmt 1 view .LVU844
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL294:
+	.loc 1 443 3 view .LVU845
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL295:
+	.loc 1 445 3 view .LVU846
+	.loc 1 446 1 is_stmt 0 view .LVU847
+	movl	-1100(%rbp), %eax
+	addq	$1056, %rsp
+	popq	%rbx
+.LVL296:
+	.loc 1 446 1 view .LVU848
+	popq	%r10
+	.cfi_remember_state
+	.cfi_def_cfa 10, 0
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+.LVL297:
+	.loc 1 446 1 view .LVU849
+	leaq	-8(%r10), %rsp
+	.cfi_def_cfa 7, 8
+	ret
+.LVL298:
+.L162:
+	.cfi_restore_state
+	.loc 1 435 70 discriminator 2 view .LVU850
+	movq	%rcx, %rdi
+	movq	%r12, %rdx
+	movq	%r13, %rsi
+	movq	%rcx, -1080(%rbp)
+	call	strncmp@PLT
+.LVL299:
+	.loc 1 435 67 discriminator 2 view .LVU851
+	testl	%eax, %eax
+	movq	-1080(%rbp), %rcx
+	jne	.L144
+	.loc 1 440 5 is_stmt 1 view .LVU852
+	movq	%r12, %rsi
+	leaq	.LC160(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL300:
+	jmp	.L146
+.L161:
+	.loc 1 435 87 is_stmt 0 view .LVU853
+	movq	(%rbx), %rcx
+	jmp	.L144
+.LVL301:
+.L160:
+	.loc 1 423 5 is_stmt 1 view .LVU854
+	leaq	.LC155(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL302:
+	jmp	.L140
+	.cfi_endproc
+.LFE35:
+	.size	run_dtos_fixed_unit_tests, .-run_dtos_fixed_unit_tests
+	.p2align 4
+	.globl	run_numeric_string_tests
+	.type	run_numeric_string_tests, @function
+run_numeric_string_tests:
+.LFB36:
+	.loc 1 451 32 view -0
+	.cfi_startproc
+	.loc 1 453 3 view .LVU856
+	.loc 1 451 32 is_stmt 0 view .LVU857
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 453 7 view .LVU858
+	xorl	%eax, %eax
+	call	run_itos_unit_tests@PLT
+.LVL303:
+	.loc 1 453 6 view .LVU859
+	cmpl	$1, %eax
+	je	.L166
+	.loc 1 457 3 is_stmt 1 view .LVU860
+	.loc 1 457 7 is_stmt 0 view .LVU861
+	xorl	%eax, %eax
+	call	run_i64tos_unit_tests@PLT
+.LVL304:
+	.loc 1 457 6 view .LVU862
+	cmpl	$1, %eax
+	je	.L166
+	.loc 1 461 3 is_stmt 1 view .LVU863
+	.loc 1 461 7 is_stmt 0 view .LVU864
+	xorl	%eax, %eax
+	call	run_ldtos_unit_tests@PLT
+.LVL305:
+	.loc 1 461 6 view .LVU865
+	cmpl	$1, %eax
+	je	.L166
+	.loc 1 465 3 is_stmt 1 view .LVU866
+	.loc 1 465 7 is_stmt 0 view .LVU867
+	xorl	%eax, %eax
+	call	run_stold_unit_tests@PLT
+.LVL306:
+	.loc 1 465 6 view .LVU868
+	cmpl	$1, %eax
+	je	.L166
+	.loc 1 469 3 is_stmt 1 view .LVU869
+	.loc 1 469 7 is_stmt 0 view .LVU870
+	xorl	%eax, %eax
+	call	run_stod_unit_tests@PLT
+.LVL307:
+	.loc 1 469 6 view .LVU871
+	cmpl	$1, %eax
+	je	.L166
+	.loc 1 473 3 is_stmt 1 view .LVU872
+	.loc 1 473 7 is_stmt 0 view .LVU873
+	xorl	%eax, %eax
+	call	run_dtos_unit_tests@PLT
+.LVL308:
+	.loc 1 473 6 view .LVU874
+	cmpl	$1, %eax
+	je	.L166
+	.loc 1 477 3 is_stmt 1 view .LVU875
+	.loc 1 477 7 is_stmt 0 view .LVU876
+	xorl	%eax, %eax
+	call	run_dtos_fixed_unit_tests@PLT
+.LVL309:
+	.loc 1 477 6 view .LVU877
+	cmpl	$1, %eax
+	je	.L166
+	.loc 1 481 3 is_stmt 1 view .LVU878
+	.loc 1 481 7 is_stmt 0 view .LVU879
+	xorl	%eax, %eax
+	call	run_stoi64_unit_tests@PLT
+.LVL310:
+	.loc 1 481 6 view .LVU880
+	cmpl	$1, %eax
+	je	.L166
+	.loc 1 485 3 is_stmt 1 view .LVU881
+	.loc 1 485 7 is_stmt 0 view .LVU882
+	xorl	%eax, %eax
+	call	run_numeric_batch_unit_tests@PLT
+.LVL311:
+	.loc 1 485 6 view .LVU883
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+	jmp	.L163
+	.p2align 4,,10
+	.p2align 3
+.L166:
+	.loc 1 454 11 view .LVU884
+	movl	$1, %eax
+.L163:
+	.loc 1 490 1 view .LVU885
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	run_numeric_string_tests, .-run_numeric_string_tests
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.long	0
+	.long	-123
+	.long	456
+	.long	2147483647
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC10:
+	.quad	0
+	.quad	9
+	.quad	10
+	.quad	-99
+	.align 32
+.LC11:
+	.quad	100
+	.quad	1234567890123
+	.quad	9223372036854775807
+	.quad	-9223372036854775808
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC27:
+	.long	974165357
+	.long	-1067524815
+	.align 8
+.LC28:
+	.long	1219557626
+	.long	1082697753
+	.set	.LC29,.LC57+16
+	.align 8
+.LC30:
+	.long	-1655774629
+	.long	-1067613435
+	.align 8
+.LC46:
+	.long	1749644930
+	.long	1027352002
+	.section	.rodata.cst32
+	.align 32
+.LC57:
+	.long	0
+	.long	0
+	.long	0
+	.long	-1075838976
+	.long	-1655774629
+	.long	1079870213
+	.long	0
+	.long	0
+	.align 32
+.LC58:
+	.long	-1
+	.long	2146435071
+	.long	1
+	.long	0
+	.long	0
+	.long	1128267776
+	.long	0
+	.long	1072693248
+	.section	.rodata.cst16
+	.align 16
+.LC59:
+	.long	0
+	.long	1076428800
+	.long	0
+	.long	0
+	.section	.rodata.cst32
+	.align 32
+.LC60:
+	.quad	1
+	.quad	4
+	.quad	17
+	.quad	6
+	.align 32
+.LC61:
+	.quad	22
+	.quad	23
+	.quad	16
+	.quad	55
+	.align 32
+.LC74:
+	.long	-1717986918
+	.long	1069128089
+	.long	1834810029
+	.long	-1064089019
+	.long	-1655774629
+	.long	1079870213
+	.long	-689770672
+	.long	1145772772
+	.align 32
+.LC75:
+	.long	-1998362383
+	.long	1055193269
+	.long	1
+	.long	0
+	.long	-1
+	.long	2146435071
+	.long	1431655765
+	.long	1071994197
+	.set	.LC90,.LC74+8
+	.align 32
+.LC105:
+	.quad	0
+	.quad	-42
+	.quad	7
+	.quad	12345678
+	.align 32
+.LC106:
+	.quad	123456789012345678
+	.quad	9223372036854775807
+	.quad	-9223372036854775808
+	.quad	0
+	.align 32
+.LC107:
+	.quad	0
+	.quad	1
+	.quad	0
+	.quad	12
+	.align 32
+.LC108:
+	.quad	1
+	.quad	3
+	.quad	2
+	.quad	8
+	.align 32
+.LC109:
+	.quad	18
+	.quad	19
+	.quad	20
+	.quad	0
+	.align 32
+.LC110:
+	.quad	0
+	.quad	24
+	.quad	0
+	.quad	2
+	.align 32
+.LC114:
+	.long	0
+	.long	1
+	.long	2
+	.long	3
+	.long	4
+	.long	5
+	.long	6
+	.long	7
+	.section	.rodata.cst8
+	.align 8
+.LC120:
+	.long	0
+	.long	1075576832
+	.section	.rodata.cst32
+	.align 32
+.LC130:
+	.long	0
+	.long	1069547520
+	.long	0
+	.long	1074003968
+	.long	0
+	.long	1074528256
+	.long	0
+	.long	-2147483648
+	.align 32
+.LC131:
+	.long	1202590843
+	.long	1064598241
+	.long	-515396076
+	.long	1072698490
+	.long	1834810029
+	.long	-1064089019
+	.long	1
+	.long	0
+	.align 32
+.LC132:
+	.long	2025163840
+	.long	1142271773
+	.long	-1717986918
+	.long	1069128089
+	.long	-1
+	.long	2146435071
+	.long	0
+	.long	2146435072
+	.section	.rodata.cst8
+	.align 8
+.LC133:
+	.long	0
+	.long	-1048576
+	.section	.rodata.cst32
+	.align 32
+.LC134:
+	.long	2
+	.long	0
+	.long	0
+	.long	3
+	.long	2
+	.long	2
+	.long	1
+	.long	4
+	.section	.rodata.cst16
+	.align 16
+.LC135:
+	.long	2
+	.long	20
+	.long	0
+	.long	2
+	.set	.LC152,.LC106+16
+	.section	.rodata.cst8
+	.align 8
+.LC153:
+	.long	0
+	.long	1093567616
+	.section	.rodata.cst16
+	.align 16
+.LC156:
+	.long	0
+	.long	1073217536
+	.long	0
+	.long	-1076887552
+	.section	.rodata.cst8
+	.align 8
+.LC157:
+	.long	-2013235812
+	.long	2117592124
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/stdio.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "/root/repo/tests/../include/strutils.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "/usr/include/stdlib.h"
+	.file 10 "/usr/include/locale.h"
+	.file 11 "<built-in>"
+	.file 12 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x21ae
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x29
+	.long	.LASF147
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0x14
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x15
+	.long	0x35
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF4
+	.uleb128 0x2a
+	.byte	0x8
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x15
+	.long	0x72
+	.uleb128 0x14
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x8a
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x14
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0x14
+	.long	.LASF13
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x8a
+	.uleb128 0xc
+	.long	0xae
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0x15
+	.long	0xae
+	.uleb128 0x14
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x13
+	.long	0x9d
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF16
+	.uleb128 0x14
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x13
+	.long	0x7e
+	.uleb128 0x15
+	.long	0xcd
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0x5
+	.long	0xae
+	.long	0xf5
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x1f
+	.byte	0
+	.uleb128 0xc
+	.long	0xfa
+	.uleb128 0x2c
+	.uleb128 0x5
+	.long	0x10b
+	.long	0x10b
+	.uleb128 0x6
+	.long	0x46
+	.byte	0xc
+	.byte	0
+	.uleb128 0xc
+	.long	0xb5
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF19
+	.uleb128 0x15
+	.long	0x2e
+	.uleb128 0x14
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0x91
+	.uleb128 0x2d
+	.long	.LASF21
+	.byte	0x10
+	.byte	0x7
+	.byte	0xd
+	.byte	0x8
+	.long	0x14e
+	.uleb128 0x20
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0x10b
+	.byte	0
+	.uleb128 0x20
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0x15
+	.long	0x128
+	.uleb128 0x1b
+	.long	.LASF22
+	.byte	0x18
+	.value	0x175
+	.long	0x187
+	.uleb128 0x4
+	.long	.LASF23
+	.value	0x17a
+	.byte	0x1c
+	.long	0x18c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF24
+	.value	0x17f
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF25
+	.value	0x184
+	.byte	0xa
+	.long	0x35
+	.byte	0x10
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF148
+	.uleb128 0xc
+	.long	0x187
+	.uleb128 0x10
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF26
+	.uleb128 0x1b
+	.long	.LASF27
+	.byte	0x40
+	.value	0x1e6
+	.long	0x20d
+	.uleb128 0x4
+	.long	.LASF28
+	.value	0x1eb
+	.byte	0xc
+	.long	0x11c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF29
+	.value	0x1f0
+	.byte	0xc
+	.long	0x11c
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF30
+	.value	0x1f5
+	.byte	0xc
+	.long	0x11c
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF31
+	.value	0x1fa
+	.byte	0xc
+	.long	0x11c
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF32
+	.value	0x1ff
+	.byte	0xc
+	.long	0x11c
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF33
+	.value	0x204
+	.byte	0xc
+	.long	0x11c
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF34
+	.value	0x209
+	.byte	0xc
+	.long	0x11c
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF35
+	.value	0x20e
+	.byte	0xc
+	.long	0x11c
+	.byte	0x38
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF36
+	.byte	0x38
+	.value	0x26c
+	.long	0x27f
+	.uleb128 0x4
+	.long	.LASF37
+	.value	0x272
+	.byte	0xd
+	.long	0x298
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF38
+	.value	0x277
+	.byte	0x9
+	.long	0x54
+	.byte	0x8
+	.uleb128 0x21
+	.string	"fd"
+	.value	0x27c
+	.long	0x72
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF39
+	.value	0x281
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF40
+	.value	0x286
+	.byte	0xa
+	.long	0x35
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF41
+	.value	0x28b
+	.byte	0xa
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x21
+	.string	"eof"
+	.value	0x290
+	.long	0x72
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF42
+	.value	0x295
+	.byte	0x7
+	.long	0x72
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2f
+	.long	0xba
+	.long	0x298
+	.uleb128 0x3
+	.long	0x54
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0xc
+	.long	0x27f
+	.uleb128 0x22
+	.long	.LASF45
+	.long	0x4d
+	.value	0x29b
+	.long	0x2b9
+	.uleb128 0x16
+	.long	.LASF43
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF44
+	.byte	0x1
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF46
+	.long	0x4d
+	.value	0x2b5
+	.long	0x2e1
+	.uleb128 0x16
+	.long	.LASF47
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF48
+	.byte	0x1
+	.uleb128 0x16
+	.long	.LASF49
+	.byte	0x2
+	.uleb128 0x16
+	.long	.LASF50
+	.byte	0x3
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF51
+	.value	0x158
+	.byte	0x7
+	.value	0x2cf
+	.byte	0x8
+	.long	0x38f
+	.uleb128 0x4
+	.long	.LASF52
+	.value	0x2d4
+	.byte	0x9
+	.long	0xa9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF53
+	.value	0x2d9
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF54
+	.value	0x2de
+	.byte	0xa
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF55
+	.value	0x2e3
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF56
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x29d
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF57
+	.value	0x2ed
+	.byte	0xa
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF58
+	.value	0x2f2
+	.byte	0x18
+	.long	0x38f
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF59
+	.value	0x2f7
+	.byte	0x18
+	.long	0x2b9
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x2fc
+	.byte	0x17
+	.long	0x394
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF61
+	.value	0x301
+	.byte	0x8
+	.long	0x399
+	.byte	0x48
+	.uleb128 0x23
+	.long	.LASF62
+	.value	0x306
+	.byte	0x21
+	.long	0x3f7
+	.value	0x148
+	.uleb128 0x23
+	.long	.LASF63
+	.value	0x30b
+	.byte	0x17
+	.long	0x3fc
+	.value	0x150
+	.byte	0
+	.uleb128 0xc
+	.long	0x20d
+	.uleb128 0xc
+	.long	0x153
+	.uleb128 0x5
+	.long	0xae
+	.long	0x3a9
+	.uleb128 0x6
+	.long	0x46
+	.byte	0xff
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF64
+	.byte	0x28
+	.value	0x764
+	.long	0x3f7
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x769
+	.byte	0xb
+	.long	0x406
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF66
+	.value	0x76e
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF67
+	.value	0x774
+	.byte	0xd
+	.long	0x40b
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF53
+	.value	0x779
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF68
+	.value	0x77e
+	.byte	0xa
+	.long	0x35
+	.byte	0x20
+	.byte	0
+	.uleb128 0xc
+	.long	0x3a9
+	.uleb128 0xc
+	.long	0x198
+	.uleb128 0xc
+	.long	0x14e
+	.uleb128 0xc
+	.long	0x35
+	.uleb128 0xc
+	.long	0x11c
+	.uleb128 0xc
+	.long	0x2e1
+	.uleb128 0x24
+	.long	.LASF91
+	.byte	0x7
+	.value	0x403
+	.byte	0x6
+	.long	0x428
+	.uleb128 0x3
+	.long	0x410
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF69
+	.byte	0x8
+	.byte	0x9f
+	.byte	0xc
+	.long	0x72
+	.long	0x448
+	.uleb128 0x3
+	.long	0x10b
+	.uleb128 0x3
+	.long	0x10b
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF70
+	.byte	0x7
+	.value	0x535
+	.byte	0x5
+	.long	0x72
+	.long	0x464
+	.uleb128 0x3
+	.long	0x410
+	.uleb128 0x3
+	.long	0xb5
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF71
+	.byte	0x7
+	.value	0x5b1
+	.byte	0x5
+	.long	0x72
+	.long	0x485
+	.uleb128 0x3
+	.long	0x410
+	.uleb128 0x3
+	.long	0x485
+	.uleb128 0x3
+	.long	0x79
+	.byte	0
+	.uleb128 0xc
+	.long	0x117
+	.uleb128 0x8
+	.long	.LASF72
+	.byte	0x7
+	.value	0x353
+	.byte	0x19
+	.long	0x410
+	.long	0x4a1
+	.uleb128 0x3
+	.long	0x41
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF73
+	.byte	0x7
+	.value	0x673
+	.byte	0x8
+	.long	0x35
+	.long	0x4c2
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x117
+	.uleb128 0x3
+	.long	0x72
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF74
+	.byte	0x7
+	.value	0x697
+	.byte	0x8
+	.long	0x35
+	.long	0x4e3
+	.uleb128 0x3
+	.long	0x401
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x4e3
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e
+	.uleb128 0x8
+	.long	.LASF75
+	.byte	0x7
+	.value	0x6c8
+	.byte	0x8
+	.long	0x35
+	.long	0x50e
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x485
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x406
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF76
+	.byte	0x8
+	.byte	0x40
+	.byte	0xc
+	.long	0x72
+	.long	0x52e
+	.uleb128 0x3
+	.long	0xf5
+	.uleb128 0x3
+	.long	0xf5
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF77
+	.byte	0x7
+	.value	0x6a6
+	.byte	0x8
+	.long	0x35
+	.long	0x54f
+	.uleb128 0x3
+	.long	0x401
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x54f
+	.byte	0
+	.uleb128 0xc
+	.long	0xcd
+	.uleb128 0x8
+	.long	.LASF78
+	.byte	0x7
+	.value	0x6b7
+	.byte	0x8
+	.long	0x35
+	.long	0x57a
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x57a
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x406
+	.byte	0
+	.uleb128 0xc
+	.long	0xd9
+	.uleb128 0x8
+	.long	.LASF79
+	.byte	0x9
+	.value	0x229
+	.byte	0xe
+	.long	0x54
+	.long	0x596
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF80
+	.byte	0x7
+	.value	0x688
+	.byte	0x8
+	.long	0x35
+	.long	0x5b7
+	.uleb128 0x3
+	.long	0x10b
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x54f
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF81
+	.byte	0xa
+	.byte	0x7a
+	.byte	0xe
+	.long	0xa9
+	.long	0x5d2
+	.uleb128 0x3
+	.long	0x72
+	.uleb128 0x3
+	.long	0x10b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF82
+	.byte	0x7
+	.value	0x660
+	.byte	0x8
+	.long	0x35
+	.long	0x5f3
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x117
+	.uleb128 0x3
+	.long	0x72
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF83
+	.byte	0x7
+	.value	0x64e
+	.byte	0x8
+	.long	0x35
+	.long	0x60f
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x117
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF84
+	.byte	0x7
+	.value	0x63e
+	.byte	0x8
+	.long	0x35
+	.long	0x630
+	.uleb128 0x3
+	.long	0x10b
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x4e3
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF149
+	.byte	0xc
+	.byte	0x25
+	.byte	0xd
+	.long	0x63c
+	.uleb128 0xc
+	.long	0x72
+	.uleb128 0x8
+	.long	.LASF85
+	.byte	0x7
+	.value	0x62b
+	.byte	0xd
+	.long	0x191
+	.long	0x658
+	.uleb128 0x3
+	.long	0x10b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF86
+	.byte	0x7
+	.value	0x620
+	.byte	0x7
+	.long	0xa9
+	.long	0x66f
+	.uleb128 0x3
+	.long	0x191
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF87
+	.byte	0x4
+	.value	0x17a
+	.byte	0xc
+	.long	0x72
+	.long	0x691
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x10b
+	.uleb128 0x25
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF88
+	.byte	0x7
+	.value	0x614
+	.byte	0x8
+	.long	0x35
+	.long	0x6ad
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x11c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF89
+	.byte	0x8
+	.value	0x197
+	.byte	0xf
+	.long	0x35
+	.long	0x6c4
+	.uleb128 0x3
+	.long	0x10b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF90
+	.byte	0x7
+	.value	0x607
+	.byte	0x8
+	.long	0x35
+	.long	0x6e0
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0xcd
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF92
+	.byte	0x9
+	.value	0x238
+	.byte	0xd
+	.long	0x6f3
+	.uleb128 0x3
+	.long	0x54
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF93
+	.byte	0x8
+	.byte	0x9c
+	.byte	0xc
+	.long	0x72
+	.long	0x70e
+	.uleb128 0x3
+	.long	0x10b
+	.uleb128 0x3
+	.long	0x10b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF94
+	.byte	0x4
+	.value	0x164
+	.byte	0xc
+	.long	0x72
+	.long	0x726
+	.uleb128 0x3
+	.long	0x10b
+	.uleb128 0x25
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF95
+	.byte	0x7
+	.value	0x5ed
+	.byte	0x7
+	.long	0xa9
+	.long	0x73d
+	.uleb128 0x3
+	.long	0x72
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF96
+	.value	0x1c3
+	.long	0x72
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7d4
+	.uleb128 0x11
+	.quad	.LVL303
+	.long	0x1fa1
+	.uleb128 0x11
+	.quad	.LVL304
+	.long	0x1cb0
+	.uleb128 0x11
+	.quad	.LVL305
+	.long	0x1ad7
+	.uleb128 0x11
+	.quad	.LVL306
+	.long	0x1892
+	.uleb128 0x11
+	.quad	.LVL307
+	.long	0x16b7
+	.uleb128 0x11
+	.quad	.LVL308
+	.long	0x1332
+	.uleb128 0x11
+	.quad	.LVL309
+	.long	0x7d4
+	.uleb128 0x11
+	.quad	.LVL310
+	.long	0x117e
+	.uleb128 0x11
+	.quad	.LVL311
+	.long	0xcbd
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF97
+	.value	0x17c
+	.long	0x72
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc7c
+	.uleb128 0xa
+	.long	.LASF98
+	.value	0x17e
+	.byte	0xa
+	.long	0xc7c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -976
+	.uleb128 0xa
+	.long	.LASF99
+	.value	0x17f
+	.byte	0x7
+	.long	0xc8c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1040
+	.uleb128 0xa
+	.long	.LASF100
+	.value	0x180
+	.byte	0xf
+	.long	0xfb
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -848
+	.uleb128 0x26
+	.long	.LASF101
+	.value	0x182
+	.long	0x72
+	.byte	0xd
+	.uleb128 0xd
+	.long	.LASF104
+	.value	0x186
+	.byte	0x7
+	.long	0x72
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0xa
+	.long	.LASF102
+	.value	0x187
+	.byte	0x8
+	.long	0xc9c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -720
+	.uleb128 0xa
+	.long	.LASF103
+	.value	0x193
+	.byte	0x8
+	.long	0xc9c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -384
+	.uleb128 0xd
+	.long	.LASF105
+	.value	0x194
+	.byte	0xc
+	.long	0x11c
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0xd
+	.long	.LASF106
+	.value	0x195
+	.byte	0x7
+	.long	0x72
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0xd
+	.long	.LASF107
+	.value	0x1aa
+	.byte	0x1b
+	.long	0x410
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0xa
+	.long	.LASF108
+	.value	0x1ab
+	.byte	0xa
+	.long	0xcad
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1072
+	.uleb128 0xd
+	.long	.LASF109
+	.value	0x1ac
+	.byte	0x7
+	.long	0x72
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0xf
+	.long	.LLRL65
+	.long	0x9cb
+	.uleb128 0x13
+	.string	"i"
+	.value	0x188
+	.byte	0xc
+	.long	0x72
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x12
+	.long	.LLRL67
+	.uleb128 0xd
+	.long	.LASF53
+	.value	0x189
+	.byte	0xc
+	.long	0x35
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x2
+	.quad	.LVL248
+	.long	0x70e
+	.long	0x92e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC151
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 -1080
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL250
+	.long	0x4a1
+	.long	0x95c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x76
+	.sleb128 -1088
+	.byte	0x6
+	.byte	0x22
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL252
+	.long	0x6ad
+	.long	0x974
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL254
+	.long	0x6f3
+	.long	0x992
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL256
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC150
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 -1080
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL69
+	.long	0xace
+	.uleb128 0x13
+	.string	"i"
+	.value	0x196
+	.byte	0xc
+	.long	0x72
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x12
+	.long	.LLRL71
+	.uleb128 0xd
+	.long	.LASF110
+	.value	0x19a
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0xd
+	.long	.LASF111
+	.value	0x19c
+	.byte	0x9
+	.long	0x72
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x2
+	.quad	.LVL270
+	.long	0x66f
+	.long	0xa4f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x14c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC154
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 -1080
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL271
+	.long	0x4a1
+	.long	0xa77
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 -1080
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL272
+	.long	0x6f3
+	.long	0xa95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL274
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC150
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 -1080
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL74
+	.long	0xb27
+	.uleb128 0x13
+	.string	"i"
+	.value	0x1ad
+	.byte	0xc
+	.long	0x72
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x2
+	.quad	.LVL285
+	.long	0x464
+	.long	0xb0c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL286
+	.long	0x448
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL244
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL245
+	.long	0x2196
+	.long	0xb51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC149
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL277
+	.long	0x48a
+	.long	0xb68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL290
+	.long	0x66f
+	.long	0xba3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x14c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC158
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0x8800759c
+	.long	0x7e37e43c
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL291
+	.long	0x6ad
+	.long	0xbbb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL292
+	.long	0x70e
+	.long	0xbe6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC159
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL294
+	.long	0x415
+	.long	0xbfe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL295
+	.long	0x219f
+	.long	0xc15
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL299
+	.long	0x428
+	.long	0xc3b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -1080
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL300
+	.long	0x70e
+	.long	0xc60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC160
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL302
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC155
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x2e
+	.long	0xc8c
+	.uleb128 0x6
+	.long	0x46
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	0x72
+	.long	0xc9c
+	.uleb128 0x6
+	.long	0x46
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	0xae
+	.long	0xcad
+	.uleb128 0x1a
+	.long	0x46
+	.value	0x14b
+	.byte	0
+	.uleb128 0x5
+	.long	0x2e
+	.long	0xcbd
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF112
+	.value	0x13d
+	.long	0x72
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x112a
+	.uleb128 0xd
+	.long	.LASF104
+	.value	0x140
+	.byte	0x7
+	.long	0x72
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x32
+	.byte	0x7
+	.byte	0x4
+	.long	0x4d
+	.byte	0x1
+	.value	0x141
+	.byte	0x8
+	.long	0xd09
+	.uleb128 0x33
+	.long	.LASF66
+	.value	0x3e8
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF113
+	.value	0x142
+	.byte	0xb
+	.long	0x112a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.uleb128 0xa
+	.long	.LASF114
+	.value	0x143
+	.byte	0xa
+	.long	0x113b
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 8192
+	.uleb128 0xd
+	.long	.LASF115
+	.value	0x14b
+	.byte	0x9
+	.long	0xa9
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0xa
+	.long	.LASF116
+	.value	0x14c
+	.byte	0xa
+	.long	0x114c
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 32192
+	.uleb128 0xa
+	.long	.LASF117
+	.value	0x14d
+	.byte	0x15
+	.long	0x115d
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 40224
+	.uleb128 0xa
+	.long	.LASF118
+	.value	0x14e
+	.byte	0xb
+	.long	0x112a
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 16192
+	.uleb128 0xa
+	.long	.LASF119
+	.value	0x14f
+	.byte	0xa
+	.long	0x113b
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 24192
+	.uleb128 0xd
+	.long	.LASF53
+	.value	0x150
+	.byte	0xa
+	.long	0x35
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0xd
+	.long	.LASF120
+	.value	0x155
+	.byte	0xa
+	.long	0x35
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0xa
+	.long	.LASF121
+	.value	0x16b
+	.byte	0x15
+	.long	0x116e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 144
+	.uleb128 0xf
+	.long	.LLRL55
+	.long	0xdd6
+	.uleb128 0x13
+	.string	"i"
+	.value	0x144
+	.byte	0xc
+	.long	0x72
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL57
+	.long	0xdf2
+	.uleb128 0x13
+	.string	"i"
+	.value	0x151
+	.byte	0xc
+	.long	0x72
+	.long	.LLST58
+	.long	.LVUS58
+	.byte	0
+	.uleb128 0x27
+	.quad	.LBB69
+	.quad	.LBE69-.LBB69
+	.long	0xe1a
+	.uleb128 0x13
+	.string	"i"
+	.value	0x15e
+	.byte	0xc
+	.long	0x72
+	.long	.LLST59
+	.long	.LVUS59
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL195
+	.long	0x2196
+	.long	0xe39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC115
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL197
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL198
+	.long	0x57f
+	.long	0xe5d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x7d00
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL200
+	.long	0x554
+	.long	0xe88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL203
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL204
+	.long	0x52e
+	.long	0xeba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 136
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL206
+	.long	0x6ad
+	.long	0xed2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL208
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL209
+	.long	0x70e
+	.long	0xf0b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC121
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 96
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL212
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL213
+	.long	0x4e8
+	.long	0xf45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 128
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 88
+	.byte	0x6
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL216
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL217
+	.long	0x4c2
+	.long	0xf75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL219
+	.long	0x6ad
+	.long	0xf8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL220
+	.long	0x70e
+	.long	0xfb9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC123
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL223
+	.long	0x52e
+	.long	0xfde
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 136
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL224
+	.long	0x2196
+	.long	0xffd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC128
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL226
+	.long	0x6e0
+	.long	0x1015
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL227
+	.long	0x219f
+	.long	0x102c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL233
+	.long	0x4c2
+	.long	0x104f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL234
+	.long	0x2196
+	.long	0x106e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC129
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL236
+	.long	0x21a8
+	.long	0x1095
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 128
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1f40
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL237
+	.long	0x70e
+	.long	0x10c3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC124
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 88
+	.byte	0x6
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL239
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL240
+	.long	0x21a8
+	.long	0x10f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 136
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1f40
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL241
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x7
+	.quad	.LVL242
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC122
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 32
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xcd
+	.long	0x113b
+	.uleb128 0x1a
+	.long	0x46
+	.value	0x3e7
+	.byte	0
+	.uleb128 0x5
+	.long	0x2e
+	.long	0x114c
+	.uleb128 0x1a
+	.long	0x46
+	.value	0x3e7
+	.byte	0
+	.uleb128 0x5
+	.long	0x35
+	.long	0x115d
+	.uleb128 0x1a
+	.long	0x46
+	.value	0x3e8
+	.byte	0
+	.uleb128 0x5
+	.long	0x128
+	.long	0x116e
+	.uleb128 0x1a
+	.long	0x46
+	.value	0x3e7
+	.byte	0
+	.uleb128 0x5
+	.long	0x128
+	.long	0x117e
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF122
+	.value	0x11e
+	.long	0x72
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1302
+	.uleb128 0xa
+	.long	.LASF100
+	.value	0x120
+	.byte	0xf
+	.long	0x1302
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0xa
+	.long	.LASF123
+	.value	0x121
+	.byte	0xb
+	.long	0x1312
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0xa
+	.long	.LASF124
+	.value	0x122
+	.byte	0xa
+	.long	0x1322
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 288
+	.uleb128 0x26
+	.long	.LASF101
+	.value	0x124
+	.long	0x72
+	.byte	0xf
+	.uleb128 0xd
+	.long	.LASF104
+	.value	0x128
+	.byte	0x7
+	.long	0x72
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0xf
+	.long	.LLRL46
+	.long	0x12c4
+	.uleb128 0x13
+	.string	"i"
+	.value	0x129
+	.byte	0xc
+	.long	0x72
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x12
+	.long	.LLRL48
+	.uleb128 0xd
+	.long	.LASF125
+	.value	0x12a
+	.byte	0x11
+	.long	0x10b
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0xa
+	.long	.LASF102
+	.value	0x12b
+	.byte	0xd
+	.long	0xcd
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.uleb128 0xd
+	.long	.LASF126
+	.value	0x12c
+	.byte	0xc
+	.long	0x35
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x2
+	.quad	.LVL182
+	.long	0x70e
+	.long	0x126a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC113
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL185
+	.long	0x6ad
+	.long	0x1282
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL186
+	.long	0x596
+	.long	0x12a1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL190
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC112
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL177
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL178
+	.long	0x2196
+	.long	0x12ee
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC111
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL192
+	.long	0x219f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x10b
+	.long	0x1312
+	.uleb128 0x6
+	.long	0x46
+	.byte	0xe
+	.byte	0
+	.uleb128 0x5
+	.long	0xcd
+	.long	0x1322
+	.uleb128 0x6
+	.long	0x46
+	.byte	0xe
+	.byte	0
+	.uleb128 0x5
+	.long	0x35
+	.long	0x1332
+	.uleb128 0x6
+	.long	0x46
+	.byte	0xe
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF127
+	.byte	0xe5
+	.long	0x72
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1687
+	.uleb128 0xb
+	.long	.LASF98
+	.byte	0xe7
+	.byte	0xa
+	.long	0x1687
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -240
+	.uleb128 0xb
+	.long	.LASF100
+	.byte	0xe8
+	.byte	0xf
+	.long	0x1697
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -176
+	.uleb128 0xb
+	.long	.LASF128
+	.byte	0xe9
+	.byte	0xf
+	.long	0x1697
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -112
+	.uleb128 0x18
+	.long	.LASF101
+	.byte	0xeb
+	.long	0x72
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF104
+	.byte	0xef
+	.byte	0x7
+	.long	0x72
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0xa
+	.long	.LASF129
+	.value	0x102
+	.byte	0xf
+	.long	0x16a7
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -304
+	.uleb128 0xd
+	.long	.LASF130
+	.value	0x103
+	.byte	0xf
+	.long	0x10b
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xf
+	.long	.LLRL38
+	.long	0x1540
+	.uleb128 0x19
+	.string	"i"
+	.byte	0xf0
+	.long	0x72
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x12
+	.long	.LLRL40
+	.uleb128 0xb
+	.long	.LASF102
+	.byte	0xf1
+	.byte	0xa
+	.long	0xe5
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -272
+	.uleb128 0x9
+	.long	.LASF53
+	.byte	0xf2
+	.byte	0xc
+	.long	0x35
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x2
+	.quad	.LVL143
+	.long	0x5d2
+	.long	0x1428
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 -312
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x36
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL144
+	.long	0x6f3
+	.long	0x144d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x70
+	.byte	0x1c
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL146
+	.long	0x70e
+	.long	0x147c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 -312
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL148
+	.long	0x5f3
+	.long	0x14a0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL150
+	.long	0x6ad
+	.long	0x14b8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL152
+	.long	0x6f3
+	.long	0x14d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL153
+	.long	0x70e
+	.long	0x150b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC86
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 -312
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL171
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC87
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 -312
+	.byte	0xa6
+	.byte	0x8
+	.uleb128 0x2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -328
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL42
+	.long	0x157b
+	.uleb128 0x13
+	.string	"i"
+	.value	0x104
+	.byte	0xf
+	.long	0x35
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x7
+	.quad	.LVL158
+	.long	0x5b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LLRL44
+	.long	0x161f
+	.uleb128 0xa
+	.long	.LASF102
+	.value	0x10b
+	.byte	0xa
+	.long	0xe5
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -272
+	.uleb128 0x2
+	.quad	.LVL161
+	.long	0x5d2
+	.long	0x15c0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xb
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x8
+	.long	0x6d5cfaad
+	.long	0xc0934a45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x36
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL163
+	.long	0x70e
+	.long	0x15df
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC91
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL165
+	.long	0x5b7
+	.long	0x1603
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC93
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL175
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC92
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL140
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL141
+	.long	0x2196
+	.long	0x1649
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC85
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL157
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL166
+	.long	0x219f
+	.long	0x166b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL173
+	.long	0x2196
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC89
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x2e
+	.long	0x1697
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	0x10b
+	.long	0x16a7
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	0x10b
+	.long	0x16b7
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x3
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF131
+	.byte	0xc1
+	.long	0x72
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1862
+	.uleb128 0xb
+	.long	.LASF100
+	.byte	0xc3
+	.byte	0xf
+	.long	0x1862
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -336
+	.uleb128 0xb
+	.long	.LASF98
+	.byte	0xc4
+	.byte	0xa
+	.long	0x1872
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -240
+	.uleb128 0xb
+	.long	.LASF124
+	.byte	0xc5
+	.byte	0xa
+	.long	0x1882
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -144
+	.uleb128 0x18
+	.long	.LASF101
+	.byte	0xc7
+	.long	0x72
+	.byte	0xa
+	.uleb128 0x9
+	.long	.LASF104
+	.byte	0xcb
+	.byte	0x7
+	.long	0x72
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0xf
+	.long	.LLRL31
+	.long	0x1824
+	.uleb128 0x19
+	.string	"i"
+	.byte	0xcc
+	.long	0x72
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x12
+	.long	.LLRL33
+	.uleb128 0x9
+	.long	.LASF125
+	.byte	0xcd
+	.byte	0x11
+	.long	0x10b
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xb
+	.long	.LASF102
+	.byte	0xce
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -344
+	.uleb128 0x9
+	.long	.LASF126
+	.byte	0xcf
+	.byte	0xc
+	.long	0x35
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x2
+	.quad	.LVL124
+	.long	0x70e
+	.long	0x179a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC66
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL127
+	.long	0x6ad
+	.long	0x17b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL128
+	.long	0x60f
+	.long	0x17d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -360
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL130
+	.long	0x70e
+	.long	0x1801
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL138
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL119
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL120
+	.long	0x2196
+	.long	0x184e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC62
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL133
+	.long	0x219f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x10b
+	.long	0x1872
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x9
+	.byte	0
+	.uleb128 0x5
+	.long	0x2e
+	.long	0x1882
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x9
+	.byte	0
+	.uleb128 0x5
+	.long	0x35
+	.long	0x1892
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x9
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF132
+	.byte	0x98
+	.long	0x72
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a87
+	.uleb128 0xb
+	.long	.LASF100
+	.byte	0x9a
+	.byte	0xf
+	.long	0x1a87
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -208
+	.uleb128 0xb
+	.long	.LASF133
+	.byte	0x9b
+	.byte	0xf
+	.long	0x1a97
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -144
+	.uleb128 0x18
+	.long	.LASF101
+	.byte	0x9d
+	.long	0x72
+	.byte	0x6
+	.uleb128 0x9
+	.long	.LASF104
+	.byte	0xa1
+	.byte	0x7
+	.long	0x72
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xf
+	.long	.LLRL21
+	.long	0x1a49
+	.uleb128 0x19
+	.string	"i"
+	.byte	0xa2
+	.long	0x72
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x12
+	.long	.LLRL23
+	.uleb128 0x9
+	.long	.LASF125
+	.byte	0xa3
+	.byte	0x11
+	.long	0x10b
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x9
+	.long	.LASF134
+	.byte	0xa4
+	.byte	0x11
+	.long	0x191
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x9
+	.long	.LASF102
+	.byte	0xa5
+	.byte	0x11
+	.long	0x191
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x34
+	.long	0x1aa7
+	.quad	.LBI31
+	.byte	.LVU265
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.byte	0x1
+	.byte	0xb1
+	.byte	0xa
+	.long	0x1992
+	.uleb128 0x1e
+	.long	0x1aca
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1e
+	.long	0x1ac1
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1e
+	.long	0x1ab8
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL93
+	.long	0x641
+	.long	0x19aa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL95
+	.long	0x630
+	.uleb128 0x2
+	.quad	.LVL98
+	.long	0x70e
+	.long	0x19dc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL109
+	.long	0x70e
+	.long	0x1a01
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL113
+	.long	0x70e
+	.long	0x1a26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL117
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL88
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL89
+	.long	0x2196
+	.long	0x1a73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL102
+	.long	0x219f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x10b
+	.long	0x1a97
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x5
+	.byte	0
+	.uleb128 0x5
+	.long	0x191
+	.long	0x1aa7
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x5
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF150
+	.byte	0x1
+	.byte	0x91
+	.byte	0xc
+	.long	0x72
+	.byte	0x1
+	.long	0x1ad7
+	.uleb128 0x28
+	.string	"a"
+	.byte	0x91
+	.byte	0x27
+	.long	0x191
+	.uleb128 0x28
+	.string	"b"
+	.byte	0x91
+	.byte	0x36
+	.long	0x191
+	.uleb128 0x36
+	.long	.LASF135
+	.byte	0x1
+	.byte	0x91
+	.byte	0x45
+	.long	0x191
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF136
+	.byte	0x5f
+	.long	0x72
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c90
+	.uleb128 0xb
+	.long	.LASF133
+	.byte	0x61
+	.byte	0xf
+	.long	0x1c90
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -128
+	.uleb128 0xb
+	.long	.LASF100
+	.byte	0x62
+	.byte	0x9
+	.long	0x1ca0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -176
+	.uleb128 0x18
+	.long	.LASF101
+	.byte	0x64
+	.long	0x72
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF104
+	.byte	0x68
+	.byte	0x7
+	.long	0x72
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xf
+	.long	.LLRL14
+	.long	0x1c52
+	.uleb128 0x19
+	.string	"i"
+	.byte	0x69
+	.long	0x72
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x12
+	.long	.LLRL16
+	.uleb128 0x9
+	.long	.LASF134
+	.byte	0x6a
+	.byte	0x11
+	.long	0x191
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x9
+	.long	.LASF125
+	.byte	0x6b
+	.byte	0x11
+	.long	0x10b
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x9
+	.long	.LASF102
+	.byte	0x6c
+	.byte	0xb
+	.long	0xa9
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x2
+	.quad	.LVL66
+	.long	0x70e
+	.long	0x1baf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC39
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL67
+	.long	0x6e0
+	.long	0x1bc7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL71
+	.long	0x658
+	.uleb128 0x2
+	.quad	.LVL73
+	.long	0x6f3
+	.long	0x1bf2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL74
+	.long	0x70e
+	.long	0x1c1d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC38
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL75
+	.long	0x6e0
+	.long	0x1c35
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL86
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC37
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL62
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL63
+	.long	0x2196
+	.long	0x1c7c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC36
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL79
+	.long	0x219f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x191
+	.long	0x1ca0
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	0xa9
+	.long	0x1cb0
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x4
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF137
+	.byte	0x31
+	.long	0x72
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f81
+	.uleb128 0xb
+	.long	.LASF138
+	.byte	0x33
+	.byte	0xb
+	.long	0x1f81
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0xb
+	.long	.LASF100
+	.byte	0x34
+	.byte	0xf
+	.long	0x1697
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0x18
+	.long	.LASF101
+	.byte	0x36
+	.long	0x72
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF104
+	.byte	0x3a
+	.byte	0x7
+	.long	0x72
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xb
+	.long	.LASF102
+	.byte	0x47
+	.byte	0x8
+	.long	0x1f91
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0xb
+	.long	.LASF103
+	.byte	0x48
+	.byte	0x8
+	.long	0x1f91
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x9
+	.long	.LASF139
+	.byte	0x49
+	.byte	0xc
+	.long	0x11c
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xf
+	.long	.LLRL9
+	.long	0x1e28
+	.uleb128 0x19
+	.string	"i"
+	.byte	0x3b
+	.long	0x72
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x12
+	.long	.LLRL11
+	.uleb128 0xb
+	.long	.LASF102
+	.byte	0x3c
+	.byte	0xa
+	.long	0x1f91
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x9
+	.long	.LASF53
+	.byte	0x3d
+	.byte	0xc
+	.long	0x35
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2
+	.quad	.LVL30
+	.long	0x70e
+	.long	0x1da7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL32
+	.long	0x6c4
+	.long	0x1dc9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL35
+	.long	0x6ad
+	.long	0x1de1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL36
+	.long	0x6f3
+	.long	0x1dff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL38
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.long	0x1edb
+	.uleb128 0x37
+	.string	"i"
+	.byte	0x1
+	.byte	0x4a
+	.byte	0xc
+	.long	0x72
+	.uleb128 0x2
+	.quad	.LVL45
+	.long	0x691
+	.long	0x1e65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL46
+	.long	0x66f
+	.long	0x1e95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL47
+	.long	0x6f3
+	.long	0x1eb3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL48
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL26
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL27
+	.long	0x2196
+	.long	0x1f05
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL52
+	.long	0x691
+	.long	0x1f23
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL53
+	.long	0x6f3
+	.long	0x1f48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL55
+	.long	0x219f
+	.long	0x1f5f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL60
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xcd
+	.long	0x1f91
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	0xae
+	.long	0x1fa1
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x14
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF140
+	.byte	0xc
+	.long	0x72
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2176
+	.uleb128 0xb
+	.long	.LASF138
+	.byte	0xe
+	.byte	0x7
+	.long	0x2176
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0xb
+	.long	.LASF100
+	.byte	0xf
+	.byte	0xf
+	.long	0x2186
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x18
+	.long	.LASF101
+	.byte	0x11
+	.long	0x72
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF104
+	.byte	0x15
+	.byte	0x7
+	.long	0x72
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xf
+	.long	.LLRL1
+	.long	0x2138
+	.uleb128 0x19
+	.string	"i"
+	.byte	0x16
+	.long	0x72
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x12
+	.long	.LLRL3
+	.uleb128 0x9
+	.long	.LASF141
+	.byte	0x17
+	.byte	0x9
+	.long	0x72
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x9
+	.long	.LASF125
+	.byte	0x18
+	.byte	0x11
+	.long	0x10b
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x9
+	.long	.LASF102
+	.byte	0x19
+	.byte	0xb
+	.long	0xa9
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x2
+	.quad	.LVL4
+	.long	0x70e
+	.long	0x207e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL6
+	.long	0x6e0
+	.long	0x2096
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL10
+	.long	0x726
+	.long	0x20ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL12
+	.long	0x6f3
+	.long	0x20cc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL13
+	.long	0x70e
+	.long	0x20fd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL14
+	.long	0x6e0
+	.long	0x2115
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL24
+	.long	0x70e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL1
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL2
+	.long	0x2196
+	.long	0x2162
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL18
+	.long	0x219f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x72
+	.long	0x2186
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	0x10b
+	.long	0x2196
+	.uleb128 0x6
+	.long	0x46
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF142
+	.long	.LASF144
+	.uleb128 0x1f
+	.long	.LASF143
+	.long	.LASF145
+	.uleb128 0x1f
+	.long	.LASF76
+	.long	.LASF146
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS60:
+	.uleb128 .LVU735
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU762
+	.uleb128 .LVU762
+	.uleb128 .LVU764
+	.uleb128 .LVU764
+	.uleb128 .LVU767
+	.uleb128 .LVU810
+	.uleb128 .LVU843
+	.uleb128 .LVU843
+	.uleb128 .LVU844
+	.uleb128 .LVU844
+	.uleb128 .LVU849
+	.uleb128 .LVU849
+	.uleb128 .LVU850
+	.uleb128 .LVU850
+	.uleb128 .LVU854
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1100
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1100
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1100
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1100
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -8
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x45c
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1100
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU771
+	.uleb128 .LVU778
+	.uleb128 .LVU778
+	.uleb128 .LVU781
+	.uleb128 .LVU781
+	.uleb128 .LVU785
+	.uleb128 .LVU785
+	.uleb128 .LVU789
+	.uleb128 .LVU789
+	.uleb128 .LVU800
+	.uleb128 .LVU800
+	.uleb128 .LVU821
+	.uleb128 .LVU854
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x37
+	.byte	0x25
+	.byte	0x71
+	.sleb128 0
+	.byte	0x27
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL270-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL270-1-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU771
+	.uleb128 .LVU772
+	.uleb128 .LVU772
+	.uleb128 .LVU804
+	.uleb128 .LVU804
+	.uleb128 .LVU806
+	.uleb128 .LVU806
+	.uleb128 .LVU849
+	.uleb128 .LVU849
+	.uleb128 .LVU850
+	.uleb128 .LVU850
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -1088
+	.byte	0x94
+	.byte	0x4
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1088
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -1088
+	.byte	0x94
+	.byte	0x4
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1088
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -8
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x450
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1088
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU812
+	.uleb128 .LVU814
+	.uleb128 .LVU814
+	.uleb128 .LVU848
+	.uleb128 .LVU850
+	.uleb128 .LVU854
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU816
+	.uleb128 .LVU823
+	.uleb128 .LVU823
+	.uleb128 .LVU832
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU738
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU743
+	.uleb128 .LVU747
+	.uleb128 .LVU760
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU751
+	.uleb128 .LVU753
+	.uleb128 .LVU753
+	.uleb128 .LVU755
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL252-1-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU771
+	.uleb128 .LVU812
+	.uleb128 .LVU854
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU771
+	.uleb128 .LVU775
+	.uleb128 .LVU793
+	.uleb128 .LVU797
+	.uleb128 .LVU797
+	.uleb128 .LVU819
+	.uleb128 .LVU854
+	.uleb128 0
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1080
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1080
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1080
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU771
+	.uleb128 .LVU775
+	.uleb128 .LVU799
+	.uleb128 .LVU822
+	.uleb128 .LVU854
+	.uleb128 0
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU818
+	.uleb128 .LVU823
+	.uleb128 .LVU823
+	.uleb128 .LVU830
+	.uleb128 .LVU830
+	.uleb128 .LVU831
+	.uleb128 .LVU831
+	.uleb128 .LVU832
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0xb
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x430
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0xd
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x430
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0xd
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x428
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU582
+	.uleb128 .LVU649
+	.uleb128 .LVU649
+	.uleb128 .LVU650
+	.uleb128 .LVU651
+	.uleb128 .LVU673
+	.uleb128 .LVU673
+	.uleb128 .LVU674
+	.uleb128 .LVU674
+	.uleb128 .LVU689
+	.uleb128 .LVU689
+	.uleb128 .LVU690
+	.uleb128 .LVU690
+	.uleb128 .LVU696
+	.uleb128 .LVU696
+	.uleb128 .LVU698
+	.uleb128 .LVU698
+	.uleb128 .LVU704
+	.uleb128 .LVU704
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU616
+	.uleb128 .LVU622
+	.uleb128 .LVU622
+	.uleb128 .LVU695
+	.uleb128 .LVU698
+	.uleb128 0
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL200-1-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU623
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 .LVU640
+	.uleb128 .LVU640
+	.uleb128 .LVU647
+	.uleb128 .LVU653
+	.uleb128 .LVU656
+	.uleb128 .LVU656
+	.uleb128 .LVU694
+	.uleb128 .LVU694
+	.uleb128 .LVU697
+	.uleb128 .LVU697
+	.uleb128 .LVU698
+	.uleb128 .LVU698
+	.uleb128 .LVU704
+	.uleb128 .LVU704
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL204-1-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 88
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0xdb48
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0xdb48
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 88
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU640
+	.uleb128 .LVU643
+	.uleb128 .LVU668
+	.uleb128 .LVU670
+	.uleb128 .LVU670
+	.uleb128 .LVU677
+	.uleb128 .LVU701
+	.uleb128 .LVU704
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL219-1-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU587
+	.uleb128 .LVU591
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU625
+	.uleb128 .LVU627
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU655
+	.uleb128 .LVU656
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU529
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU531
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 .LVU544
+	.uleb128 .LVU545
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 .LVU566
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU534
+	.uleb128 .LVU545
+	.uleb128 .LVU547
+	.uleb128 .LVU571
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU534
+	.uleb128 .LVU539
+	.uleb128 .LVU539
+	.uleb128 .LVU542
+	.uleb128 .LVU553
+	.uleb128 .LVU558
+	.uleb128 .LVU558
+	.uleb128 .LVU561
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL182-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL190-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU417
+	.uleb128 .LVU422
+	.uleb128 .LVU422
+	.uleb128 .LVU446
+	.uleb128 .LVU446
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU485
+	.uleb128 .LVU485
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU459
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU483
+	.uleb128 .LVU488
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL163-1-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL175-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU419
+	.uleb128 .LVU422
+	.uleb128 .LVU422
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 .LVU431
+	.uleb128 .LVU432
+	.uleb128 .LVU449
+	.uleb128 .LVU449
+	.uleb128 .LVU452
+	.uleb128 .LVU485
+	.uleb128 .LVU488
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU437
+	.uleb128 .LVU439
+	.uleb128 .LVU439
+	.uleb128 .LVU441
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU461
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU467
+	.uleb128 .LVU467
+	.uleb128 .LVU482
+	.uleb128 .LVU488
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU348
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 .LVU383
+	.uleb128 .LVU383
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU396
+	.uleb128 .LVU396
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU350
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU365
+	.uleb128 .LVU366
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU384
+	.uleb128 .LVU393
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU353
+	.uleb128 .LVU366
+	.uleb128 .LVU368
+	.uleb128 .LVU389
+	.uleb128 .LVU393
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU353
+	.uleb128 .LVU360
+	.uleb128 .LVU372
+	.uleb128 .LVU376
+	.uleb128 .LVU376
+	.uleb128 .LVU377
+	.uleb128 .LVU393
+	.uleb128 .LVU394
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU246
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU276
+	.uleb128 .LVU283
+	.uleb128 .LVU288
+	.uleb128 .LVU290
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU299
+	.uleb128 .LVU301
+	.uleb128 .LVU303
+	.uleb128 .LVU303
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU248
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU275
+	.uleb128 .LVU283
+	.uleb128 .LVU293
+	.uleb128 .LVU293
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU307
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU254
+	.uleb128 .LVU280
+	.uleb128 .LVU283
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU256
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 .LVU281
+	.uleb128 .LVU281
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU303
+	.uleb128 .LVU303
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x21
+	.byte	0x4
+	.uleb128 .LVL93-1-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -240
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -248
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -8
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x100
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -240
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -240
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x34
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -240
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU259
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU281
+	.uleb128 .LVU281
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x21
+	.byte	0x4
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -224
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -232
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -8
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -224
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU265
+	.uleb128 .LVU267
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x12
+	.byte	0x9e
+	.uleb128 0x10
+	.long	0x4bb41000
+	.long	0xe12e1342
+	.long	0x3fd3
+	.long	0
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU265
+	.uleb128 .LVU267
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x21
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU265
+	.uleb128 .LVU267
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x22
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU169
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU205
+	.uleb128 .LVU213
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -196
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -196
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -196
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU171
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU176
+	.uleb128 .LVU181
+	.uleb128 .LVU201
+	.uleb128 .LVU213
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU174
+	.uleb128 .LVU181
+	.uleb128 .LVU186
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -192
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x21
+	.byte	0x4
+	.uleb128 .LVL71-1-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -192
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -200
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -8
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0xd0
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -192
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU174
+	.uleb128 .LVU181
+	.uleb128 .LVU187
+	.uleb128 .LVU210
+	.uleb128 .LVU213
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU174
+	.uleb128 .LVU181
+	.uleb128 .LVU191
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU209
+	.uleb128 .LVU213
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL73-1-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU82
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU129
+	.uleb128 .LVU134
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU140
+	.uleb128 .LVU142
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 28
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 28
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 28
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 28
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 28
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -36
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0xc4
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x8
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0xc4
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU114
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU129
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x5
+	.byte	0x78
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x5
+	.byte	0x78
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU84
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU92
+	.uleb128 .LVU93
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU110
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU87
+	.uleb128 .LVU93
+	.uleb128 .LVU96
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU113
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU20
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU54
+	.uleb128 .LVU61
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 20
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 20
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 20
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU22
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU28
+	.uleb128 .LVU32
+	.uleb128 .LVU50
+	.uleb128 .LVU61
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU25
+	.uleb128 .LVU32
+	.uleb128 .LVU34
+	.uleb128 .LVU59
+	.uleb128 .LVU61
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU25
+	.uleb128 .LVU32
+	.uleb128 .LVU38
+	.uleb128 .LVU60
+	.uleb128 .LVU61
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU25
+	.uleb128 .LVU32
+	.uleb128 .LVU40
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU58
+	.uleb128 .LVU61
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0
+.LLRL42:
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0
+.LLRL46:
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL48:
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0
+.LLRL55:
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0
+.LLRL65:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL67:
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0
+.LLRL69:
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0
+.LLRL71:
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0
+.LLRL74:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF78:
+	.string	"i64tos_batch"
+.LASF109:
+	.string	"inline_kept"
+.LASF137:
+	.string	"run_i64tos_unit_tests"
+.LASF97:
+	.string	"run_dtos_fixed_unit_tests"
+.LASF100:
+	.string	"string_values"
+.LASF150:
+	.string	"compare_floats"
+.LASF35:
+	.string	"conversion_ns"
+.LASF86:
+	.string	"ldtos"
+.LASF89:
+	.string	"strlen"
+.LASF90:
+	.string	"i64tos_to"
+.LASF40:
+	.string	"capacity"
+.LASF69:
+	.string	"strncmp"
+.LASF22:
+	.string	"StringArena"
+.LASF113:
+	.string	"integers"
+.LASF115:
+	.string	"buffer"
+.LASF4:
+	.string	"unsigned int"
+.LASF55:
+	.string	"incremental_factor"
+.LASF23:
+	.string	"head"
+.LASF44:
+	.string	"ST_GROWTH_LINEAR"
+.LASF51:
+	.string	"StringTokenizer"
+.LASF101:
+	.string	"num_tests"
+.LASF48:
+	.string	"ST_STRING_OWNED"
+.LASF106:
+	.string	"mismatches"
+.LASF42:
+	.string	"error"
+.LASF143:
+	.string	"putchar"
+.LASF39:
+	.string	"chunk_size"
+.LASF70:
+	.string	"st_append_char"
+.LASF140:
+	.string	"run_itos_unit_tests"
+.LASF149:
+	.string	"__errno_location"
+.LASF136:
+	.string	"run_ldtos_unit_tests"
+.LASF84:
+	.string	"stod"
+.LASF119:
+	.string	"double_results"
+.LASF122:
+	.string	"run_stoi64_unit_tests"
+.LASF19:
+	.string	"float"
+.LASF79:
+	.string	"malloc"
+.LASF66:
+	.string	"count"
+.LASF102:
+	.string	"result"
+.LASF112:
+	.string	"run_numeric_batch_unit_tests"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF126:
+	.string	"consumed"
+.LASF117:
+	.string	"views"
+.LASF49:
+	.string	"ST_STRING_MAPPED"
+.LASF121:
+	.string	"invalid"
+.LASF60:
+	.string	"arena"
+.LASF110:
+	.string	"value"
+.LASF25:
+	.string	"used"
+.LASF132:
+	.string	"run_stold_unit_tests"
+.LASF142:
+	.string	"puts"
+.LASF9:
+	.string	"size_t"
+.LASF17:
+	.string	"int64_t"
+.LASF41:
+	.string	"offset"
+.LASF30:
+	.string	"allocations"
+.LASF57:
+	.string	"max_increment"
+.LASF148:
+	.string	"StringArenaBlock"
+.LASF12:
+	.string	"__uint64_t"
+.LASF135:
+	.string	"epsilon"
+.LASF98:
+	.string	"double_values"
+.LASF77:
+	.string	"stoi64_batch"
+.LASF104:
+	.string	"exit_status"
+.LASF14:
+	.string	"char"
+.LASF52:
+	.string	"string"
+.LASF133:
+	.string	"ld_values"
+.LASF134:
+	.string	"ld_value"
+.LASF131:
+	.string	"run_stod_unit_tests"
+.LASF56:
+	.string	"growth_policy"
+.LASF15:
+	.string	"ssize_t"
+.LASF59:
+	.string	"ownership"
+.LASF144:
+	.string	"__builtin_puts"
+.LASF43:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF64:
+	.string	"StringStructuralIndex"
+.LASF88:
+	.string	"u64tos_to"
+.LASF83:
+	.string	"dtos_to"
+.LASF16:
+	.string	"long long int"
+.LASF94:
+	.string	"printf"
+.LASF38:
+	.string	"context"
+.LASF103:
+	.string	"expected"
+.LASF127:
+	.string	"run_dtos_unit_tests"
+.LASF34:
+	.string	"conversions"
+.LASF68:
+	.string	"hint"
+.LASF95:
+	.string	"itos"
+.LASF87:
+	.string	"snprintf"
+.LASF75:
+	.string	"dtos_batch"
+.LASF108:
+	.string	"values"
+.LASF145:
+	.string	"__builtin_putchar"
+.LASF31:
+	.string	"reallocations"
+.LASF91:
+	.string	"st_destroy"
+.LASF47:
+	.string	"ST_STRING_BORROWED"
+.LASF10:
+	.string	"__int64_t"
+.LASF26:
+	.string	"long double"
+.LASF27:
+	.string	"StringStats"
+.LASF118:
+	.string	"integer_results"
+.LASF111:
+	.string	"precision"
+.LASF65:
+	.string	"positions"
+.LASF96:
+	.string	"run_numeric_string_tests"
+.LASF28:
+	.string	"bytes_scanned"
+.LASF8:
+	.string	"short int"
+.LASF11:
+	.string	"long int"
+.LASF53:
+	.string	"length"
+.LASF116:
+	.string	"offsets"
+.LASF29:
+	.string	"tokens_extracted"
+.LASF141:
+	.string	"int_value"
+.LASF76:
+	.string	"memcmp"
+.LASF20:
+	.string	"uint64_t"
+.LASF45:
+	.string	"StringGrowthPolicy"
+.LASF24:
+	.string	"block_size"
+.LASF74:
+	.string	"stod_batch"
+.LASF13:
+	.string	"__ssize_t"
+.LASF92:
+	.string	"free"
+.LASF46:
+	.string	"StringOwnership"
+.LASF37:
+	.string	"read"
+.LASF72:
+	.string	"st_create_empty"
+.LASF120:
+	.string	"converted"
+.LASF99:
+	.string	"precisions"
+.LASF114:
+	.string	"doubles"
+.LASF3:
+	.string	"long unsigned int"
+.LASF147:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF82:
+	.string	"dtos_precision_to"
+.LASF124:
+	.string	"consumed_values"
+.LASF107:
+	.string	"tokenizer"
+.LASF62:
+	.string	"structural_index"
+.LASF50:
+	.string	"ST_STRING_INLINE"
+.LASF138:
+	.string	"int_values"
+.LASF81:
+	.string	"setlocale"
+.LASF128:
+	.string	"precision_values"
+.LASF5:
+	.string	"unsigned char"
+.LASF61:
+	.string	"inline_buffer"
+.LASF21:
+	.string	"StringView"
+.LASF36:
+	.string	"StringStream"
+.LASF105:
+	.string	"state"
+.LASF73:
+	.string	"dtos_fixed_to"
+.LASF32:
+	.string	"expansions"
+.LASF63:
+	.string	"stats"
+.LASF139:
+	.string	"power"
+.LASF123:
+	.string	"integer_values"
+.LASF85:
+	.string	"stold"
+.LASF7:
+	.string	"signed char"
+.LASF6:
+	.string	"short unsigned int"
+.LASF71:
+	.string	"st_append_fixed"
+.LASF125:
+	.string	"string_value"
+.LASF146:
+	.string	"__builtin_memcmp"
+.LASF2:
+	.string	"double"
+.LASF130:
+	.string	"locale"
+.LASF67:
+	.string	"in_string"
+.LASF80:
+	.string	"stoi64"
+.LASF33:
+	.string	"bytes_copied"
+.LASF54:
+	.string	"position"
+.LASF93:
+	.string	"strcmp"
+.LASF58:
+	.string	"stream"
+.LASF129:
+	.string	"locales"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test"
+.LASF0:
+	.string	"/root/repo/tests/numeric_string_unit_tests.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2481 @@
+	.file	"string_arena.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/src/string_arena.c"
+	.p2align 4
+	.globl	st_arena_create
+	.type	st_arena_create, @function
+st_arena_create:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/src/string_arena.c"
+	.loc 1 50 62 view -0
+	.cfi_startproc
+	.loc 1 51 3 view .LVU1
+	.loc 1 50 62 is_stmt 0 view .LVU2
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 50 62 view .LVU3
+	movq	%rdi, %rbx
+	.loc 1 51 53 view .LVU4
+	movl	$24, %edi
+.LVL1:
+	.loc 1 51 53 view .LVU5
+	call	malloc@PLT
+.LVL2:
+	.loc 1 52 3 is_stmt 1 view .LVU6
+	.loc 1 52 8 view .LVU7
+	.loc 1 52 6 view .LVU8
+	.loc 1 53 3 view .LVU9
+	.loc 1 53 6 is_stmt 0 view .LVU10
+	testq	%rax, %rax
+	je	.L1
+	.loc 1 54 5 is_stmt 1 view .LVU11
+	.loc 1 55 53 is_stmt 0 view .LVU12
+	testq	%rbx, %rbx
+	movl	$65536, %edx
+	cmove	%rdx, %rbx
+.LVL3:
+	.loc 1 54 17 view .LVU13
+	movq	$0, (%rax)
+	.loc 1 55 5 is_stmt 1 view .LVU14
+	.loc 1 55 23 is_stmt 0 view .LVU15
+	movq	%rbx, 8(%rax)
+	.loc 1 56 5 is_stmt 1 view .LVU16
+	.loc 1 56 17 is_stmt 0 view .LVU17
+	movq	$0, 16(%rax)
+	.loc 1 58 3 is_stmt 1 view .LVU18
+.L1:
+	.loc 1 59 1 is_stmt 0 view .LVU19
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	st_arena_create, .-st_arena_create
+	.p2align 4
+	.globl	st_arena_alloc
+	.type	st_arena_alloc, @function
+st_arena_alloc:
+.LVL4:
+.LFB27:
+	.loc 1 64 68 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 66 3 view .LVU21
+	.loc 1 64 68 is_stmt 0 view .LVU22
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	.loc 1 66 55 view .LVU23
+	leaq	15(%rsi), %rbx
+	.loc 1 66 10 view .LVU24
+	andq	$-16, %rbx
+.LVL5:
+	.loc 1 67 3 is_stmt 1 view .LVU25
+	.loc 1 64 68 is_stmt 0 view .LVU26
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 67 6 view .LVU27
+	cmpq	%rsi, %rbx
+	jb	.L16
+	.loc 1 70 28 view .LVU28
+	movq	(%rdi), %r13
+	movq	%rdi, %rbp
+	.loc 1 70 3 is_stmt 1 view .LVU29
+.LVL6:
+	.loc 1 71 3 view .LVU30
+	.loc 1 71 6 is_stmt 0 view .LVU31
+	testq	%r13, %r13
+	je	.L12
+	.loc 1 71 28 discriminator 1 view .LVU32
+	movq	8(%r13), %r12
+	.loc 1 71 42 discriminator 1 view .LVU33
+	movq	16(%r13), %rdx
+	.loc 1 71 35 discriminator 1 view .LVU34
+	movq	%r12, %rax
+	subq	%rdx, %rax
+	.loc 1 71 20 discriminator 1 view .LVU35
+	cmpq	%rbx, %rax
+	jnb	.L21
+.LBB2:
+	.loc 1 73 5 is_stmt 1 discriminator 1 view .LVU36
+	.loc 1 73 56 is_stmt 0 discriminator 1 view .LVU37
+	addq	%r12, %r12
+.L15:
+.LVL7:
+	.loc 1 74 5 is_stmt 1 discriminator 4 view .LVU38
+	cmpq	%rbx, %r12
+	cmovb	%rbx, %r12
+.LVL8:
+	.loc 1 77 5 discriminator 4 view .LVU39
+	.loc 1 77 40 is_stmt 0 discriminator 4 view .LVU40
+	leaq	32(%r12), %rdi
+.LVL9:
+	.loc 1 77 40 discriminator 4 view .LVU41
+	call	malloc@PLT
+.LVL10:
+	.loc 1 78 5 is_stmt 1 discriminator 4 view .LVU42
+	.loc 1 78 10 discriminator 4 view .LVU43
+	.loc 1 78 8 discriminator 4 view .LVU44
+	.loc 1 79 5 discriminator 4 view .LVU45
+	.loc 1 79 8 is_stmt 0 discriminator 4 view .LVU46
+	testq	%rax, %rax
+	je	.L16
+	.loc 1 82 5 is_stmt 1 view .LVU47
+	.loc 1 82 17 is_stmt 0 view .LVU48
+	movq	%r13, (%rax)
+	.loc 1 83 5 is_stmt 1 view .LVU49
+	.loc 1 83 17 is_stmt 0 view .LVU50
+	movq	%r12, 8(%rax)
+	.loc 1 84 5 is_stmt 1 view .LVU51
+	.loc 1 84 17 is_stmt 0 view .LVU52
+	movq	$0, 16(%rax)
+	.loc 1 85 5 is_stmt 1 view .LVU53
+	.loc 1 85 17 is_stmt 0 view .LVU54
+	movq	%rax, 0(%rbp)
+	movq	%rbx, %rcx
+	xorl	%edx, %edx
+	jmp	.L14
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	.loc 1 85 17 view .LVU55
+.LBE2:
+	.loc 1 88 15 view .LVU56
+	leaq	(%rdx,%rbx), %rcx
+	movq	%r13, %rax
+.LVL12:
+.L14:
+	.loc 1 87 3 is_stmt 1 view .LVU57
+	.loc 1 88 15 is_stmt 0 view .LVU58
+	movq	%rcx, 16(%rax)
+	.loc 1 89 15 view .LVU59
+	addq	%rbx, 16(%rbp)
+	.loc 1 91 1 view .LVU60
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 87 9 view .LVU61
+	leaq	32(%rax,%rdx), %rdx
+.LVL13:
+	.loc 1 88 3 is_stmt 1 view .LVU62
+	.loc 1 89 3 view .LVU63
+	.loc 1 90 3 view .LVU64
+	.loc 1 91 1 is_stmt 0 view .LVU65
+	movq	%rdx, %rax
+.LVL14:
+	.loc 1 91 1 view .LVU66
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL15:
+	.loc 1 91 1 view .LVU67
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL16:
+	.loc 1 91 1 view .LVU68
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL17:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.cfi_restore_state
+.LBB3:
+	.loc 1 73 5 is_stmt 1 discriminator 2 view .LVU69
+	.loc 1 73 56 is_stmt 0 discriminator 2 view .LVU70
+	movq	8(%rdi), %r12
+	jmp	.L15
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 73 56 discriminator 2 view .LVU71
+.LBE3:
+	.loc 1 91 1 view .LVU72
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL19:
+	.loc 1 91 1 view .LVU73
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	.loc 1 68 11 view .LVU74
+	xorl	%edx, %edx
+	.loc 1 91 1 view .LVU75
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	movq	%rdx, %rax
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	st_arena_alloc, .-st_arena_alloc
+	.p2align 4
+	.globl	st_arena_string
+	.type	st_arena_string, @function
+st_arena_string:
+.LVL20:
+.LFB28:
+	.loc 1 96 81 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 97 3 view .LVU77
+	.loc 1 96 81 is_stmt 0 view .LVU78
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 96 81 view .LVU79
+	movq	%rsi, %rbx
+	.loc 1 97 26 view .LVU80
+	movq	8(%rsi), %rax
+	leaq	1(%rax), %rsi
+.LVL21:
+	.loc 1 97 26 view .LVU81
+	call	st_arena_alloc@PLT
+.LVL22:
+	.loc 1 97 26 view .LVU82
+	movq	%rax, %rcx
+.LVL23:
+	.loc 1 98 3 is_stmt 1 view .LVU83
+	.loc 1 98 6 is_stmt 0 view .LVU84
+	testq	%rax, %rax
+	je	.L22
+	.loc 1 102 3 is_stmt 1 view .LVU85
+	.loc 1 102 11 is_stmt 0 view .LVU86
+	movq	8(%rbx), %rdx
+	.loc 1 102 6 view .LVU87
+	testq	%rdx, %rdx
+	jne	.L32
+.LVL24:
+.L24:
+	.loc 1 105 3 is_stmt 1 view .LVU88
+	.loc 1 105 21 is_stmt 0 view .LVU89
+	movb	$0, (%rcx,%rdx)
+	.loc 1 106 3 is_stmt 1 view .LVU90
+.L22:
+	.loc 1 107 1 is_stmt 0 view .LVU91
+	movq	%rcx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL25:
+	.loc 1 107 1 view .LVU92
+	ret
+.LVL26:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.cfi_restore_state
+	.loc 1 103 5 is_stmt 1 view .LVU93
+	movq	(%rbx), %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.LVL27:
+	.loc 1 103 5 is_stmt 0 view .LVU94
+	movq	%rax, %rcx
+	.loc 1 105 14 view .LVU95
+	movq	8(%rbx), %rdx
+	jmp	.L24
+	.cfi_endproc
+.LFE28:
+	.size	st_arena_string, .-st_arena_string
+	.p2align 4
+	.globl	st_arena_reset
+	.type	st_arena_reset, @function
+st_arena_reset:
+.LVL28:
+.LFB29:
+	.loc 1 112 48 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 113 3 view .LVU97
+	.loc 1 112 48 is_stmt 0 view .LVU98
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 113 28 view .LVU99
+	movq	(%rdi), %r12
+.LVL29:
+	.loc 1 114 3 is_stmt 1 view .LVU100
+	.loc 1 114 6 is_stmt 0 view .LVU101
+	testq	%r12, %r12
+	je	.L44
+	.loc 1 118 28 view .LVU102
+	movq	(%r12), %rbx
+	movq	%rdi, %rbp
+	.loc 1 118 3 is_stmt 1 view .LVU103
+.LVL30:
+	.loc 1 119 3 view .LVU104
+	.loc 1 119 15 view .LVU105
+	testq	%rbx, %rbx
+	je	.L35
+.LVL31:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+.LBB4:
+	.loc 1 120 5 view .LVU106
+	movq	%rbx, %rdi
+	.loc 1 120 30 is_stmt 0 view .LVU107
+	movq	(%rbx), %rbx
+.LVL32:
+	.loc 1 121 5 is_stmt 1 view .LVU108
+	call	free@PLT
+.LVL33:
+	.loc 1 122 5 view .LVU109
+	.loc 1 122 5 is_stmt 0 view .LVU110
+.LBE4:
+	.loc 1 119 15 is_stmt 1 view .LVU111
+	testq	%rbx, %rbx
+	jne	.L36
+.LVL34:
+.L35:
+	.loc 1 124 3 view .LVU112
+	.loc 1 124 15 is_stmt 0 view .LVU113
+	movq	$0, (%r12)
+	.loc 1 125 3 is_stmt 1 view .LVU114
+	.loc 1 125 15 is_stmt 0 view .LVU115
+	movq	$0, 16(%r12)
+	.loc 1 126 3 is_stmt 1 view .LVU116
+	.loc 1 126 15 is_stmt 0 view .LVU117
+	movq	$0, 16(%rbp)
+.LVL35:
+.L44:
+	.loc 1 127 1 view .LVU118
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL36:
+	.loc 1 127 1 view .LVU119
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	st_arena_reset, .-st_arena_reset
+	.p2align 4
+	.globl	st_arena_destroy
+	.type	st_arena_destroy, @function
+st_arena_destroy:
+.LVL37:
+.LFB30:
+	.loc 1 132 50 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 133 3 view .LVU121
+	.loc 1 133 6 is_stmt 0 view .LVU122
+	testq	%rdi, %rdi
+	je	.L54
+	.loc 1 132 50 view .LVU123
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	.loc 1 136 3 is_stmt 1 view .LVU124
+	.loc 1 132 50 is_stmt 0 view .LVU125
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 136 28 view .LVU126
+	movq	(%rdi), %rbx
+.LVL38:
+	.loc 1 137 3 is_stmt 1 view .LVU127
+	.loc 1 137 16 view .LVU128
+	testq	%rbx, %rbx
+	je	.L48
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+.LBB5:
+	.loc 1 138 5 view .LVU129
+	movq	%rbx, %rdi
+	.loc 1 138 30 is_stmt 0 view .LVU130
+	movq	(%rbx), %rbx
+.LVL40:
+	.loc 1 139 5 is_stmt 1 view .LVU131
+	call	free@PLT
+.LVL41:
+	.loc 1 140 5 view .LVU132
+	.loc 1 140 5 is_stmt 0 view .LVU133
+.LBE5:
+	.loc 1 137 16 is_stmt 1 view .LVU134
+	testq	%rbx, %rbx
+	jne	.L49
+.LVL42:
+.L48:
+	.loc 1 142 3 view .LVU135
+	.loc 1 143 1 is_stmt 0 view .LVU136
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL43:
+	.loc 1 142 3 view .LVU137
+	movq	%rbp, %rdi
+	.loc 1 143 1 view .LVU138
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL44:
+	.loc 1 142 3 view .LVU139
+	jmp	free@PLT
+.LVL45:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.loc 1 142 3 view .LVU140
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	st_arena_destroy, .-st_arena_destroy
+	.p2align 4
+	.globl	st_arena_acquire
+	.type	st_arena_acquire, @function
+st_arena_acquire:
+.LFB31:
+	.loc 1 148 44 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 149 3 view .LVU142
+	.loc 1 148 44 is_stmt 0 view .LVU143
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 149 31 view .LVU144
+	leaq	string_arena_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL46:
+	movq	string_arena_pool_count@dtpoff(%rax), %rdx
+	.loc 1 149 6 view .LVU145
+	testq	%rdx, %rdx
+	je	.L64
+	.loc 1 150 5 is_stmt 1 view .LVU146
+	.loc 1 150 30 is_stmt 0 view .LVU147
+	decq	%rdx
+	.loc 1 150 29 view .LVU148
+	movq	%rdx, string_arena_pool_count@dtpoff(%rax)
+	movq	string_arena_pool@dtpoff(%rax,%rdx,8), %rax
+	.loc 1 153 1 view .LVU149
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	.cfi_restore_state
+	.loc 1 152 3 is_stmt 1 view .LVU150
+	.loc 1 152 10 is_stmt 0 view .LVU151
+	xorl	%edi, %edi
+	.loc 1 153 1 view .LVU152
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 152 10 view .LVU153
+	jmp	st_arena_create@PLT
+.LVL47:
+	.cfi_endproc
+.LFE31:
+	.size	st_arena_acquire, .-st_arena_acquire
+	.p2align 4
+	.globl	st_arena_release
+	.type	st_arena_release, @function
+st_arena_release:
+.LVL48:
+.LFB32:
+	.loc 1 158 50 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 159 3 view .LVU155
+	.loc 1 159 6 is_stmt 0 view .LVU156
+	testq	%rdi, %rdi
+	je	.L73
+	.loc 1 158 50 view .LVU157
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	.loc 1 162 3 is_stmt 1 view .LVU158
+	.loc 1 158 50 is_stmt 0 view .LVU159
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 162 31 view .LVU160
+	leaq	string_arena_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL49:
+	.loc 1 164 5 view .LVU161
+	movq	%rbx, %rdi
+	.loc 1 162 6 view .LVU162
+	cmpq	$4, string_arena_pool_count@dtpoff(%rax)
+	.loc 1 162 31 view .LVU163
+	movq	%rax, %rbp
+	.loc 1 162 6 view .LVU164
+	je	.L76
+	.loc 1 167 3 is_stmt 1 view .LVU165
+	call	st_arena_reset@PLT
+.LVL50:
+	.loc 1 168 3 view .LVU166
+	.loc 1 168 44 is_stmt 0 view .LVU167
+	movq	string_arena_pool_count@dtpoff(%rbp), %rax
+	leaq	1(%rax), %rdx
+	movq	%rdx, string_arena_pool_count@dtpoff(%rbp)
+	.loc 1 168 48 view .LVU168
+	movq	%rbx, string_arena_pool@dtpoff(%rbp,%rax,8)
+	.loc 1 169 1 view .LVU169
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL51:
+	.loc 1 169 1 view .LVU170
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL52:
+	.loc 1 169 1 view .LVU171
+	ret
+.LVL53:
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	.cfi_restore_state
+	.loc 1 164 5 is_stmt 1 view .LVU172
+	.loc 1 169 1 is_stmt 0 view .LVU173
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL54:
+	.loc 1 169 1 view .LVU174
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	.loc 1 164 5 view .LVU175
+	jmp	st_arena_destroy@PLT
+.LVL55:
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	.loc 1 164 5 view .LVU176
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	st_arena_release, .-st_arena_release
+	.p2align 4
+	.globl	st_arena_pool_clear
+	.type	st_arena_pool_clear, @function
+st_arena_pool_clear:
+.LFB33:
+	.loc 1 174 32 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 175 3 view .LVU178
+	.loc 1 175 34 view .LVU179
+	.loc 1 174 32 is_stmt 0 view .LVU180
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 175 34 view .LVU181
+	leaq	string_arena_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL56:
+	movq	string_arena_pool_count@dtpoff(%rax), %rax
+	testq	%rax, %rax
+	je	.L84
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.loc 1 176 5 is_stmt 1 view .LVU182
+	.loc 1 176 40 is_stmt 0 view .LVU183
+	leaq	-1(%rax), %rbx
+	.loc 1 176 5 view .LVU184
+	leaq	string_arena_pool_count@tlsld(%rip), %rdi
+	call	__tls_get_addr@PLT
+.LVL57:
+	movq	string_arena_pool@dtpoff(%rax,%rbx,8), %rdi
+	movq	%rax, %rbp
+	movq	%rbx, string_arena_pool_count@dtpoff(%rax)
+	call	st_arena_destroy@PLT
+.LVL58:
+	.loc 1 175 34 is_stmt 1 view .LVU185
+	movq	string_arena_pool_count@dtpoff(%rbp), %rax
+	testq	%rax, %rax
+	jne	.L79
+.L84:
+	.loc 1 178 1 is_stmt 0 view .LVU186
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	st_arena_pool_clear, .-st_arena_pool_clear
+	.section	.tbss,"awT",@nobits
+	.align 8
+	.type	string_arena_pool_count, @object
+	.size	string_arena_pool_count, 8
+string_arena_pool_count:
+	.zero	8
+	.align 8
+	.type	string_arena_pool, @object
+	.size	string_arena_pool, 32
+string_arena_pool:
+	.zero	32
+	.text
+.Letext0:
+	.file 2 "/root/repo/src/../include/strutils.h"
+	.file 3 "/usr/include/string.h"
+	.file 4 "/usr/include/stdlib.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x554
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x14
+	.long	.LASF40
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x15
+	.long	.LASF41
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x8
+	.long	0x2e
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x17
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x85
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x8
+	.long	0x85
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x18
+	.uleb128 0x1
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF12
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0x19
+	.long	.LASF13
+	.byte	0x10
+	.byte	0x2
+	.byte	0xd
+	.byte	0x8
+	.long	0xd0
+	.uleb128 0xc
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0xa5
+	.byte	0
+	.uleb128 0xc
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	0xaa
+	.uleb128 0x1a
+	.long	.LASF14
+	.byte	0x18
+	.byte	0x2
+	.value	0x175
+	.byte	0x8
+	.long	0x10b
+	.uleb128 0x9
+	.long	.LASF15
+	.value	0x17a
+	.byte	0x1c
+	.long	0x14c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF16
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF17
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF42
+	.byte	0x20
+	.byte	0x10
+	.byte	0x1
+	.byte	0xe
+	.byte	0x8
+	.long	0x14c
+	.uleb128 0xa
+	.long	.LASF18
+	.byte	0x13
+	.byte	0x1c
+	.long	0x14c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF19
+	.byte	0x18
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0xa
+	.long	.LASF17
+	.byte	0x1d
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1c
+	.long	.LASF43
+	.byte	0x1
+	.byte	0x22
+	.byte	0x1e
+	.long	0x162
+	.byte	0x10
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0x10b
+	.uleb128 0x4
+	.long	0xd5
+	.uleb128 0x4
+	.long	0xd0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF20
+	.uleb128 0xd
+	.long	0x85
+	.long	0x171
+	.uleb128 0x1d
+	.long	0x3f
+	.byte	0
+	.uleb128 0xd
+	.long	0x151
+	.long	0x181
+	.uleb128 0x1e
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF21
+	.byte	0x28
+	.byte	0x2a
+	.long	0x171
+	.uleb128 0xa
+	.byte	0xe
+	.long	string_arena_pool@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0xe
+	.long	.LASF22
+	.byte	0x2d
+	.byte	0x1d
+	.long	0x2e
+	.uleb128 0xa
+	.byte	0xe
+	.long	string_arena_pool_count@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0x1f
+	.long	.LASF44
+	.byte	0x4
+	.value	0x238
+	.byte	0xd
+	.long	0x1c0
+	.uleb128 0x6
+	.long	0x7e
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF23
+	.byte	0x3
+	.byte	0x2b
+	.byte	0xe
+	.long	0x7e
+	.long	0x1e0
+	.uleb128 0x6
+	.long	0x7e
+	.uleb128 0x6
+	.long	0x98
+	.uleb128 0x6
+	.long	0x2e
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF24
+	.byte	0x4
+	.value	0x229
+	.byte	0xe
+	.long	0x7e
+	.long	0x1f7
+	.uleb128 0x6
+	.long	0x2e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF25
+	.byte	0xae
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x221
+	.uleb128 0x7
+	.quad	.LVL58
+	.long	0x2ac
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF26
+	.byte	0x9e
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x276
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x9e
+	.byte	0x2b
+	.long	0x151
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x10
+	.quad	.LVL50
+	.long	0x33a
+	.long	0x268
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x22
+	.quad	.LVL55
+	.long	0x2ac
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x94
+	.byte	0x15
+	.long	0x151
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ac
+	.uleb128 0x11
+	.quad	.LVL47
+	.long	0x4f1
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF27
+	.byte	0x84
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x33a
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x84
+	.byte	0x2b
+	.long	0x151
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2
+	.long	.LASF29
+	.byte	0x88
+	.byte	0x1c
+	.long	0x14c
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x24
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.long	0x324
+	.uleb128 0x2
+	.long	.LASF18
+	.byte	0x8a
+	.byte	0x1e
+	.long	0x14c
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x7
+	.quad	.LVL41
+	.long	0x1ad
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL45
+	.long	0x1ad
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF30
+	.byte	0x70
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3c2
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x70
+	.byte	0x29
+	.long	0x151
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2
+	.long	.LASF29
+	.byte	0x71
+	.byte	0x1c
+	.long	0x14c
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x2
+	.long	.LASF18
+	.byte	0x76
+	.byte	0x1c
+	.long	0x14c
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x25
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x2
+	.long	.LASF31
+	.byte	0x78
+	.byte	0x1e
+	.long	0x14c
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x7
+	.quad	.LVL33
+	.long	0x1ad
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF33
+	.byte	0x60
+	.byte	0x7
+	.long	0x80
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x443
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x60
+	.byte	0x2b
+	.long	0x151
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x60
+	.byte	0x4b
+	.long	0x156
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0x61
+	.byte	0x9
+	.long	0x80
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x10
+	.quad	.LVL22
+	.long	0x443
+	.long	0x435
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL27
+	.long	0x54c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF36
+	.byte	0x40
+	.byte	0x7
+	.long	0x7e
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4f1
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x40
+	.byte	0x2a
+	.long	0x151
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x40
+	.byte	0x3e
+	.long	0x3a
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x2
+	.long	.LASF37
+	.byte	0x42
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2
+	.long	.LASF29
+	.byte	0x46
+	.byte	0x1c
+	.long	0x14c
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2
+	.long	.LASF38
+	.byte	0x57
+	.byte	0x9
+	.long	0x7e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x26
+	.long	.LLRL7
+	.uleb128 0x2
+	.long	.LASF16
+	.byte	0x49
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x13
+	.quad	.LVL10
+	.long	0x1e0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 32
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF39
+	.byte	0x32
+	.byte	0x15
+	.long	0x151
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x54c
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x32
+	.byte	0x32
+	.long	0x3a
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x2
+	.long	.LASF28
+	.byte	0x33
+	.byte	0x17
+	.long	0x151
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x13
+	.quad	.LVL2
+	.long	0x1e0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF23
+	.long	.LASF45
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU170
+	.uleb128 .LVU171
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL45-1-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU127
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 .LVU132
+	.uleb128 .LVU133
+	.uleb128 .LVU137
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU131
+	.uleb128 .LVU135
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU100
+	.uleb128 .LVU119
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU104
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU109
+	.uleb128 .LVU110
+	.uleb128 .LVU118
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU108
+	.uleb128 .LVU112
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU83
+	.uleb128 .LVU88
+	.uleb128 .LVU93
+	.uleb128 .LVU94
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU25
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0xf
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0xf
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU30
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU66
+	.uleb128 .LVU69
+	.uleb128 .LVU71
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU62
+	.uleb128 .LVU69
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU38
+	.uleb128 .LVU55
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF4:
+	.string	"long long int"
+.LASF34:
+	.string	"view"
+.LASF41:
+	.string	"size_t"
+.LASF14:
+	.string	"StringArena"
+.LASF21:
+	.string	"string_arena_pool"
+.LASF37:
+	.string	"aligned_size"
+.LASF33:
+	.string	"st_arena_string"
+.LASF17:
+	.string	"used"
+.LASF3:
+	.string	"long int"
+.LASF6:
+	.string	"short unsigned int"
+.LASF25:
+	.string	"st_arena_pool_clear"
+.LASF29:
+	.string	"block"
+.LASF20:
+	.string	"double"
+.LASF35:
+	.string	"string"
+.LASF42:
+	.string	"StringArenaBlock"
+.LASF43:
+	.string	"data"
+.LASF13:
+	.string	"StringView"
+.LASF19:
+	.string	"size"
+.LASF27:
+	.string	"st_arena_destroy"
+.LASF16:
+	.string	"block_size"
+.LASF22:
+	.string	"string_arena_pool_count"
+.LASF5:
+	.string	"unsigned char"
+.LASF40:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF2:
+	.string	"long unsigned int"
+.LASF31:
+	.string	"previous"
+.LASF15:
+	.string	"head"
+.LASF32:
+	.string	"st_arena_acquire"
+.LASF7:
+	.string	"unsigned int"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF45:
+	.string	"__builtin_memcpy"
+.LASF44:
+	.string	"free"
+.LASF26:
+	.string	"st_arena_release"
+.LASF10:
+	.string	"char"
+.LASF23:
+	.string	"memcpy"
+.LASF9:
+	.string	"short int"
+.LASF39:
+	.string	"st_arena_create"
+.LASF28:
+	.string	"arena"
+.LASF12:
+	.string	"long double"
+.LASF30:
+	.string	"st_arena_reset"
+.LASF8:
+	.string	"signed char"
+.LASF18:
+	.string	"next"
+.LASF38:
+	.string	"memory"
+.LASF36:
+	.string	"st_arena_alloc"
+.LASF24:
+	.string	"malloc"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test"
+.LASF0:
+	.string	"/root/repo/src/string_arena.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
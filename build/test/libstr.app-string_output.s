@@ -0,0 +1,5307 @@
+	.file	"string_output.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/src/string_output.c"
+	.p2align 4
+	.globl	st_output_create
+	.type	st_output_create, @function
+st_output_create:
+.LVL0:
+.LFB29:
+	.file 1 "/root/repo/src/string_output.c"
+	.loc 1 101 108 view -0
+	.cfi_startproc
+	.loc 1 102 3 view .LVU1
+	.loc 1 101 108 is_stmt 0 view .LVU2
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%edi, %ebp
+	.loc 1 102 56 view .LVU3
+	movl	$72, %edi
+.LVL1:
+	.loc 1 101 108 view .LVU4
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 101 108 view .LVU5
+	movq	%rsi, %rbx
+	.loc 1 102 56 view .LVU6
+	call	malloc@PLT
+.LVL2:
+	.loc 1 103 3 is_stmt 1 view .LVU7
+	.loc 1 103 6 is_stmt 0 view .LVU8
+	testq	%rax, %rax
+	je	.L1
+	.loc 1 104 5 is_stmt 1 view .LVU9
+	.loc 1 107 54 is_stmt 0 view .LVU10
+	testq	%rbx, %rbx
+	movl	$16384, %edx
+	cmove	%rdx, %rbx
+.LVL3:
+	.loc 1 104 18 view .LVU11
+	movq	$0, (%rax)
+	.loc 1 105 5 is_stmt 1 view .LVU12
+	.loc 1 105 18 is_stmt 0 view .LVU13
+	movq	$0, 8(%rax)
+	.loc 1 106 5 is_stmt 1 view .LVU14
+	.loc 1 106 19 is_stmt 0 view .LVU15
+	movq	$0, 16(%rax)
+	.loc 1 107 5 is_stmt 1 view .LVU16
+	.loc 1 107 24 is_stmt 0 view .LVU17
+	movq	%rbx, 24(%rax)
+	.loc 1 108 5 is_stmt 1 view .LVU18
+	.loc 1 108 20 is_stmt 0 view .LVU19
+	movq	$0, 32(%rax)
+	.loc 1 109 5 is_stmt 1 view .LVU20
+	.loc 1 109 29 is_stmt 0 view .LVU21
+	movq	%r12, 40(%rax)
+	.loc 1 110 5 is_stmt 1 view .LVU22
+	.loc 1 110 16 is_stmt 0 view .LVU23
+	movl	%ebp, 48(%rax)
+	.loc 1 111 5 is_stmt 1 view .LVU24
+	.loc 1 111 21 is_stmt 0 view .LVU25
+	movq	$0, 56(%rax)
+	.loc 1 112 5 is_stmt 1 view .LVU26
+	.loc 1 112 19 is_stmt 0 view .LVU27
+	movl	$0, 64(%rax)
+	.loc 1 114 3 is_stmt 1 view .LVU28
+.L1:
+	.loc 1 115 1 is_stmt 0 view .LVU29
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL4:
+	.loc 1 115 1 view .LVU30
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL5:
+	.loc 1 115 1 view .LVU31
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	st_output_create, .-st_output_create
+	.p2align 4
+	.globl	st_output_reserve
+	.type	st_output_reserve, @function
+st_output_reserve:
+.LVL6:
+.LFB30:
+	.loc 1 120 73 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 121 3 view .LVU33
+	.loc 1 120 73 is_stmt 0 view .LVU34
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 121 20 view .LVU35
+	movq	24(%rdi), %rdi
+.LVL7:
+	.loc 1 121 6 view .LVU36
+	cmpq	%rsi, %rdi
+	jb	.L16
+	.loc 1 124 3 is_stmt 1 view .LVU37
+	.loc 1 124 29 is_stmt 0 view .LVU38
+	movq	8(%rbx), %rbp
+.LVL8:
+	.loc 1 126 3 is_stmt 1 view .LVU39
+	.loc 1 126 6 is_stmt 0 view .LVU40
+	testq	%rbp, %rbp
+	je	.L12
+	.loc 1 126 49 discriminator 1 view .LVU41
+	movq	16(%rbp), %rax
+	.loc 1 126 42 discriminator 1 view .LVU42
+	movq	%rdi, %rdx
+	subq	%rax, %rdx
+	.loc 1 126 20 discriminator 1 view .LVU43
+	cmpq	%rsi, %rdx
+	jnb	.L13
+.L12:
+	.loc 1 127 5 is_stmt 1 view .LVU44
+.LVL9:
+.LBB15:
+.LBI15:
+	.loc 1 58 34 view .LVU45
+.LBB16:
+	.loc 1 59 3 view .LVU46
+	.loc 1 59 29 is_stmt 0 view .LVU47
+	movq	16(%rbx), %rax
+.LVL10:
+	.loc 1 60 3 is_stmt 1 view .LVU48
+	.loc 1 60 6 is_stmt 0 view .LVU49
+	testq	%rax, %rax
+	je	.L14
+	.loc 1 61 5 is_stmt 1 view .LVU50
+	.loc 1 61 19 is_stmt 0 view .LVU51
+	movq	$0, 16(%rbx)
+.LVL11:
+.L15:
+	.loc 1 69 3 is_stmt 1 view .LVU52
+	.loc 1 69 15 is_stmt 0 view .LVU53
+	movq	$0, (%rax)
+	.loc 1 70 3 is_stmt 1 view .LVU54
+	.loc 1 70 16 is_stmt 0 view .LVU55
+	movq	$0, 8(%rax)
+	.loc 1 71 3 is_stmt 1 view .LVU56
+	.loc 1 71 15 is_stmt 0 view .LVU57
+	movq	$0, 16(%rax)
+	.loc 1 72 3 is_stmt 1 view .LVU58
+	.loc 1 72 6 is_stmt 0 view .LVU59
+	testq	%rbp, %rbp
+	je	.L17
+	.loc 1 73 5 is_stmt 1 view .LVU60
+	.loc 1 73 24 is_stmt 0 view .LVU61
+	movq	%rax, 0(%rbp)
+.L18:
+	.loc 1 78 3 is_stmt 1 view .LVU62
+	.loc 1 78 16 is_stmt 0 view .LVU63
+	movq	%rax, 8(%rbx)
+	.loc 1 79 3 is_stmt 1 view .LVU64
+.LVL12:
+	.loc 1 79 3 is_stmt 0 view .LVU65
+.LBE16:
+.LBE15:
+	.loc 1 128 5 is_stmt 1 view .LVU66
+.LBB20:
+.LBB17:
+	.loc 1 78 16 is_stmt 0 view .LVU67
+	movq	%rax, %rbp
+	xorl	%eax, %eax
+.LVL13:
+.L13:
+	.loc 1 78 16 view .LVU68
+.LBE17:
+.LBE20:
+	.loc 1 132 3 is_stmt 1 view .LVU69
+	.loc 1 133 1 is_stmt 0 view .LVU70
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL14:
+	.loc 1 132 22 view .LVU71
+	leaq	24(%rbp,%rax), %rax
+.LVL15:
+	.loc 1 133 1 view .LVU72
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.cfi_restore_state
+.LBB21:
+.LBB18:
+	.loc 1 64 5 is_stmt 1 view .LVU73
+	.loc 1 64 41 is_stmt 0 view .LVU74
+	addq	$24, %rdi
+	call	malloc@PLT
+.LVL17:
+	.loc 1 65 5 is_stmt 1 view .LVU75
+	.loc 1 65 8 is_stmt 0 view .LVU76
+	testq	%rax, %rax
+	jne	.L15
+.LVL18:
+.L16:
+	.loc 1 65 8 view .LVU77
+.LBE18:
+.LBE21:
+	.loc 1 133 1 view .LVU78
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL19:
+	.loc 1 122 11 view .LVU79
+	xorl	%eax, %eax
+	.loc 1 133 1 view .LVU80
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL20:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.cfi_restore_state
+.LBB22:
+.LBB19:
+	.loc 1 76 5 is_stmt 1 view .LVU81
+	.loc 1 76 18 is_stmt 0 view .LVU82
+	movq	%rax, (%rbx)
+	jmp	.L18
+.LBE19:
+.LBE22:
+	.cfi_endproc
+.LFE30:
+	.size	st_output_reserve, .-st_output_reserve
+	.p2align 4
+	.globl	st_output_iov
+	.type	st_output_iov, @function
+st_output_iov:
+.LVL21:
+.LFB37:
+	.loc 1 213 96 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 214 3 view .LVU84
+	.loc 1 215 3 view .LVU85
+.LBB23:
+	.loc 1 215 8 view .LVU86
+	.loc 1 215 34 is_stmt 0 view .LVU87
+	movq	(%rdi), %rax
+.LVL22:
+	.loc 1 215 69 is_stmt 1 view .LVU88
+.LBE23:
+	.loc 1 214 10 is_stmt 0 view .LVU89
+	xorl	%r8d, %r8d
+.LBB24:
+	.loc 1 215 69 view .LVU90
+	testq	%rax, %rax
+	je	.L26
+	testq	%rdx, %rdx
+	je	.L26
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.loc 1 216 5 is_stmt 1 view .LVU91
+	.loc 1 216 14 is_stmt 0 view .LVU92
+	movq	16(%rax), %rcx
+	.loc 1 216 28 view .LVU93
+	movq	8(%rax), %rdi
+	.loc 1 216 8 view .LVU94
+	cmpq	%rcx, %rdi
+	jnb	.L28
+	.loc 1 217 7 is_stmt 1 view .LVU95
+	.loc 1 217 10 is_stmt 0 view .LVU96
+	movq	%r8, %r9
+	salq	$4, %r9
+	addq	%rsi, %r9
+	.loc 1 217 42 view .LVU97
+	leaq	24(%rax,%rdi), %r10
+	.loc 1 218 43 view .LVU98
+	subq	%rdi, %rcx
+	.loc 1 218 17 view .LVU99
+	incq	%r8
+.LVL24:
+	.loc 1 217 42 view .LVU100
+	movq	%r10, (%r9)
+	.loc 1 218 7 is_stmt 1 view .LVU101
+.LVL25:
+	.loc 1 218 43 is_stmt 0 view .LVU102
+	movq	%rcx, 8(%r9)
+	.loc 1 215 94 is_stmt 1 view .LVU103
+	movq	(%rax), %rax
+.LVL26:
+	.loc 1 215 69 view .LVU104
+	cmpq	%rdx, %r8
+	jnb	.L26
+	testq	%rax, %rax
+	jne	.L31
+.LVL27:
+.L26:
+	.loc 1 215 69 is_stmt 0 view .LVU105
+.LBE24:
+	.loc 1 222 1 view .LVU106
+	movq	%r8, %rax
+.LVL28:
+	.loc 1 222 1 view .LVU107
+	ret
+.LVL29:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+.LBB25:
+	.loc 1 215 94 is_stmt 1 view .LVU108
+	movq	(%rax), %rax
+.LVL30:
+	.loc 1 215 69 view .LVU109
+	testq	%rax, %rax
+	je	.L26
+	cmpq	%rdx, %r8
+	jb	.L31
+.LBE25:
+	.loc 1 222 1 is_stmt 0 view .LVU110
+	movq	%r8, %rax
+.LVL31:
+	.loc 1 222 1 view .LVU111
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	st_output_iov, .-st_output_iov
+	.p2align 4
+	.type	st_output_flush.part.0, @function
+st_output_flush.part.0:
+.LVL32:
+.LFB41:
+	.loc 1 227 5 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 227 5 is_stmt 0 view .LVU113
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$1024, %rsp
+	.cfi_def_cfa_offset 1056
+	movq	%rsp, %r12
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.loc 1 233 25 is_stmt 1 view .LVU114
+	cmpq	$0, 32(%rbp)
+	je	.L69
+.L59:
+.LBB26:
+	.loc 1 234 5 view .LVU115
+	.loc 1 234 20 is_stmt 0 view .LVU116
+	movl	$64, %edx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	st_output_iov@PLT
+.LVL34:
+	.loc 1 237 17 view .LVU117
+	movl	%eax, %ebx
+	jmp	.L51
+.LVL35:
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	.loc 1 238 30 view .LVU118
+	call	__errno_location@PLT
+.LVL36:
+	.loc 1 238 29 view .LVU119
+	movl	(%rax), %eax
+	.loc 1 238 26 view .LVU120
+	cmpl	$4, %eax
+	jne	.L68
+.LVL37:
+.L51:
+	.loc 1 235 5 is_stmt 1 view .LVU121
+	.loc 1 236 5 view .LVU122
+	.loc 1 237 7 view .LVU123
+	.loc 1 237 17 is_stmt 0 view .LVU124
+	movl	48(%rbp), %edi
+	movl	%ebx, %edx
+	movq	%r12, %rsi
+	call	writev@PLT
+.LVL38:
+	.loc 1 238 26 is_stmt 1 view .LVU125
+	testq	%rax, %rax
+	js	.L70
+	.loc 1 239 5 view .LVU126
+	.loc 1 243 5 view .LVU127
+	.loc 1 243 8 is_stmt 0 view .LVU128
+	je	.L61
+	.loc 1 248 5 is_stmt 1 view .LVU129
+	.loc 1 248 21 is_stmt 0 view .LVU130
+	addq	%rax, 56(%rbp)
+	.loc 1 249 5 is_stmt 1 view .LVU131
+	.loc 1 249 20 is_stmt 0 view .LVU132
+	subq	%rax, 32(%rbp)
+	.loc 1 251 5 is_stmt 1 view .LVU133
+.LVL39:
+	.loc 1 252 5 view .LVU134
+	.loc 1 252 22 view .LVU135
+	.loc 1 248 21 is_stmt 0 view .LVU136
+	movq	%rax, %rbx
+	jmp	.L58
+.LVL40:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+.LBB27:
+.LBB28:
+.LBB29:
+	.loc 1 46 3 is_stmt 1 view .LVU137
+	call	free@PLT
+.LVL41:
+.L57:
+	.loc 1 46 3 is_stmt 0 view .LVU138
+.LBE29:
+.LBE28:
+.LBE27:
+	.loc 1 252 22 is_stmt 1 view .LVU139
+	testq	%rbx, %rbx
+	je	.L49
+.LVL42:
+.L58:
+.LBB34:
+	.loc 1 253 7 view .LVU140
+	.loc 1 253 33 is_stmt 0 view .LVU141
+	movq	0(%rbp), %rdi
+.LVL43:
+	.loc 1 254 7 is_stmt 1 view .LVU142
+	.loc 1 254 29 is_stmt 0 view .LVU143
+	movq	16(%rdi), %rdx
+	.loc 1 254 43 view .LVU144
+	movq	8(%rdi), %rax
+.LVL44:
+	.loc 1 255 7 is_stmt 1 view .LVU145
+	.loc 1 254 14 is_stmt 0 view .LVU146
+	movq	%rdx, %rcx
+	subq	%rax, %rcx
+.LVL45:
+	.loc 1 255 10 view .LVU147
+	cmpq	%rcx, %rbx
+	jb	.L71
+	.loc 1 259 7 is_stmt 1 view .LVU148
+	.loc 1 259 17 is_stmt 0 view .LVU149
+	subq	%rdx, %rax
+	.loc 1 260 20 view .LVU150
+	movq	%rdx, 8(%rdi)
+	.loc 1 259 17 view .LVU151
+	addq	%rax, %rbx
+.LVL46:
+	.loc 1 260 7 is_stmt 1 view .LVU152
+	.loc 1 261 7 view .LVU153
+	.loc 1 261 10 is_stmt 0 view .LVU154
+	cmpq	8(%rbp), %rdi
+	je	.L72
+	.loc 1 267 7 is_stmt 1 view .LVU155
+	.loc 1 267 20 is_stmt 0 view .LVU156
+	movq	(%rdi), %rax
+.LBB32:
+.LBB30:
+	.loc 1 42 6 view .LVU157
+	cmpq	$0, 16(%rbp)
+.LBE30:
+.LBE32:
+	.loc 1 267 20 view .LVU158
+	movq	%rax, 0(%rbp)
+	.loc 1 268 7 is_stmt 1 view .LVU159
+.LVL47:
+.LBB33:
+.LBI28:
+	.loc 1 41 13 view .LVU160
+.LBB31:
+	.loc 1 42 3 view .LVU161
+	.loc 1 42 6 is_stmt 0 view .LVU162
+	jne	.L56
+	.loc 1 43 5 is_stmt 1 view .LVU163
+	.loc 1 43 19 is_stmt 0 view .LVU164
+	movq	%rdi, 16(%rbp)
+	.loc 1 44 5 is_stmt 1 view .LVU165
+	jmp	.L57
+.LVL48:
+.L61:
+	.loc 1 44 5 is_stmt 0 view .LVU166
+.LBE31:
+.LBE33:
+.LBE34:
+	movl	$5, %eax
+.LVL49:
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	.loc 1 241 14 view .LVU167
+	xorl	%edx, %edx
+.LVL50:
+.L52:
+	.loc 1 245 21 view .LVU168
+	movl	%eax, 64(%rbp)
+.LBE26:
+	.loc 1 273 1 view .LVU169
+	addq	$1024, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	movl	%edx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL51:
+	.loc 1 273 1 view .LVU170
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	.cfi_restore_state
+.LBB38:
+.LBB35:
+	.loc 1 256 9 is_stmt 1 view .LVU171
+	.loc 1 256 22 is_stmt 0 view .LVU172
+	addq	%rbx, %rax
+.LBE35:
+.LBE38:
+	.loc 1 233 25 view .LVU173
+	cmpq	$0, 32(%rbp)
+.LBB39:
+.LBB36:
+	.loc 1 256 22 view .LVU174
+	movq	%rax, 8(%rdi)
+	.loc 1 257 9 is_stmt 1 view .LVU175
+.LBE36:
+.LBE39:
+	.loc 1 233 25 view .LVU176
+	jne	.L59
+.LVL53:
+.L69:
+	.loc 1 271 3 view .LVU177
+	.loc 1 272 3 view .LVU178
+	.loc 1 272 10 is_stmt 0 view .LVU179
+	xorl	%eax, %eax
+	movl	$1, %edx
+	jmp	.L52
+.LVL54:
+	.p2align 4,,10
+	.p2align 3
+.L72:
+.LBB40:
+.LBB37:
+	.loc 1 263 9 is_stmt 1 view .LVU180
+	.loc 1 263 22 is_stmt 0 view .LVU181
+	movq	$0, 8(%rdi)
+	.loc 1 264 9 is_stmt 1 view .LVU182
+	.loc 1 264 21 is_stmt 0 view .LVU183
+	movq	$0, 16(%rdi)
+	.loc 1 265 9 is_stmt 1 view .LVU184
+	jmp	.L49
+.LBE37:
+.LBE40:
+	.cfi_endproc
+.LFE41:
+	.size	st_output_flush.part.0, .-st_output_flush.part.0
+	.p2align 4
+	.globl	st_output_flush
+	.type	st_output_flush, @function
+st_output_flush:
+.LVL55:
+.LFB38:
+	.loc 1 227 50 view -0
+	.cfi_startproc
+	.loc 1 228 3 view .LVU186
+	.loc 1 228 6 is_stmt 0 view .LVU187
+	movl	48(%rdi), %eax
+	testl	%eax, %eax
+	js	.L79
+	jmp	st_output_flush.part.0
+.LVL56:
+.L79:
+	.loc 1 229 5 is_stmt 1 view .LVU188
+	.loc 1 229 27 is_stmt 0 view .LVU189
+	movq	32(%rdi), %rdx
+	.loc 1 229 47 view .LVU190
+	movq	%rdx, %rax
+	negq	%rax
+	sbbl	%eax, %eax
+	andl	$9, %eax
+	.loc 1 229 19 view .LVU191
+	movl	%eax, 64(%rdi)
+	.loc 1 230 5 is_stmt 1 view .LVU192
+	.loc 1 273 1 is_stmt 0 view .LVU193
+	xorl	%eax, %eax
+	testq	%rdx, %rdx
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	st_output_flush, .-st_output_flush
+	.p2align 4
+	.globl	st_output_append_n
+	.type	st_output_append_n, @function
+st_output_append_n:
+.LVL57:
+.LFB32:
+	.loc 1 147 94 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 148 3 view .LVU195
+	.loc 1 149 3 view .LVU196
+	.loc 1 149 17 view .LVU197
+	.loc 1 147 94 is_stmt 0 view .LVU198
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%r15d, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rsi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 149 17 view .LVU199
+	testq	%rdx, %rdx
+	jne	.L81
+	jmp	.L90
+.LVL58:
+	.p2align 4,,10
+	.p2align 3
+.L104:
+.LBB46:
+	.loc 1 158 12 view .LVU200
+	subq	%rax, %rdx
+.L85:
+	.loc 1 158 5 is_stmt 1 view .LVU201
+.LVL59:
+	.loc 1 159 5 view .LVU202
+	.loc 1 159 24 is_stmt 0 view .LVU203
+	movq	%r13, %rbx
+	subq	%r15, %rbx
+	cmpq	%rdx, %rbx
+	cmova	%rdx, %rbx
+.LVL60:
+	.loc 1 162 5 is_stmt 1 view .LVU204
+	.loc 1 162 46 is_stmt 0 view .LVU205
+	leaq	(%r14,%r15), %rsi
+	.loc 1 162 5 view .LVU206
+	leaq	24(%rbp,%rax), %rdi
+	movq	%rbx, %rdx
+	.loc 1 165 12 view .LVU207
+	addq	%rbx, %r15
+.LVL61:
+	.loc 1 162 5 view .LVU208
+	call	memcpy@PLT
+.LVL62:
+	.loc 1 163 5 is_stmt 1 view .LVU209
+	.loc 1 163 17 is_stmt 0 view .LVU210
+	addq	%rbx, 16(%rbp)
+	.loc 1 164 5 is_stmt 1 view .LVU211
+	.loc 1 164 20 is_stmt 0 view .LVU212
+	addq	%rbx, 32(%r12)
+	.loc 1 165 5 is_stmt 1 view .LVU213
+.LVL63:
+	.loc 1 165 5 is_stmt 0 view .LVU214
+.LBE46:
+	.loc 1 149 17 is_stmt 1 view .LVU215
+	cmpq	%r13, %r15
+	jnb	.L90
+.LVL64:
+.L81:
+.LBB51:
+	.loc 1 150 5 view .LVU216
+	.loc 1 150 31 is_stmt 0 view .LVU217
+	movq	8(%r12), %rbp
+.LVL65:
+	.loc 1 151 5 is_stmt 1 view .LVU218
+	.loc 1 151 46 is_stmt 0 view .LVU219
+	movq	24(%r12), %rdx
+	.loc 1 151 8 view .LVU220
+	testq	%rbp, %rbp
+	je	.L84
+	.loc 1 151 30 discriminator 1 view .LVU221
+	movq	16(%rbp), %rax
+	.loc 1 151 22 discriminator 1 view .LVU222
+	cmpq	%rdx, %rax
+	jne	.L104
+.L84:
+	.loc 1 152 7 is_stmt 1 view .LVU223
+.LVL66:
+.LBB47:
+.LBI47:
+	.loc 1 58 34 view .LVU224
+.LBB48:
+	.loc 1 59 3 view .LVU225
+	.loc 1 59 29 is_stmt 0 view .LVU226
+	movq	16(%r12), %rax
+.LVL67:
+	.loc 1 60 3 is_stmt 1 view .LVU227
+	.loc 1 60 6 is_stmt 0 view .LVU228
+	testq	%rax, %rax
+	je	.L86
+	.loc 1 61 5 is_stmt 1 view .LVU229
+	.loc 1 61 19 is_stmt 0 view .LVU230
+	movq	$0, 16(%r12)
+.L87:
+	.loc 1 69 3 is_stmt 1 view .LVU231
+	.loc 1 69 15 is_stmt 0 view .LVU232
+	movq	$0, (%rax)
+	.loc 1 70 3 is_stmt 1 view .LVU233
+	.loc 1 70 16 is_stmt 0 view .LVU234
+	movq	$0, 8(%rax)
+	.loc 1 71 3 is_stmt 1 view .LVU235
+	.loc 1 71 15 is_stmt 0 view .LVU236
+	movq	$0, 16(%rax)
+	.loc 1 72 3 is_stmt 1 view .LVU237
+	.loc 1 72 6 is_stmt 0 view .LVU238
+	testq	%rbp, %rbp
+	je	.L88
+	.loc 1 73 5 is_stmt 1 view .LVU239
+	.loc 1 73 24 is_stmt 0 view .LVU240
+	movq	%rax, 0(%rbp)
+.L89:
+	.loc 1 78 3 is_stmt 1 view .LVU241
+	.loc 1 78 16 is_stmt 0 view .LVU242
+	movq	%rax, 8(%r12)
+	.loc 1 79 3 is_stmt 1 view .LVU243
+.LVL68:
+	.loc 1 79 3 is_stmt 0 view .LVU244
+.LBE48:
+.LBE47:
+	.loc 1 153 7 is_stmt 1 view .LVU245
+.LBB50:
+.LBB49:
+	.loc 1 78 16 is_stmt 0 view .LVU246
+	movq	%rax, %rbp
+	xorl	%eax, %eax
+	jmp	.L85
+.LVL69:
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	.loc 1 76 5 is_stmt 1 view .LVU247
+	.loc 1 76 18 is_stmt 0 view .LVU248
+	movq	%rax, (%r12)
+	jmp	.L89
+	.p2align 4,,10
+	.p2align 3
+.L86:
+	.loc 1 64 5 is_stmt 1 view .LVU249
+	.loc 1 64 41 is_stmt 0 view .LVU250
+	leaq	24(%rdx), %rdi
+	movq	%rdx, 8(%rsp)
+	call	malloc@PLT
+.LVL70:
+	.loc 1 65 5 is_stmt 1 view .LVU251
+	.loc 1 65 8 is_stmt 0 view .LVU252
+	testq	%rax, %rax
+	movq	8(%rsp), %rdx
+	jne	.L87
+.LBE49:
+.LBE50:
+	.loc 1 154 16 view .LVU253
+	xorl	%edx, %edx
+	jmp	.L80
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.loc 1 154 16 view .LVU254
+.LBE51:
+	.loc 1 167 3 is_stmt 1 view .LVU255
+.LBB52:
+.LBI52:
+	.loc 1 91 12 view .LVU256
+.LBB53:
+	.loc 1 92 3 view .LVU257
+	.loc 1 92 13 is_stmt 0 view .LVU258
+	movq	40(%r12), %rax
+	.loc 1 92 6 view .LVU259
+	testq	%rax, %rax
+	je	.L105
+	.loc 1 92 36 view .LVU260
+	movl	48(%r12), %ecx
+	.loc 1 93 12 view .LVU261
+	movl	$1, %edx
+	.loc 1 92 36 view .LVU262
+	testl	%ecx, %ecx
+	js	.L80
+	.loc 1 92 54 view .LVU263
+	cmpq	%rax, 32(%r12)
+	jb	.L80
+	.loc 1 95 3 is_stmt 1 view .LVU264
+.LBE53:
+.LBE52:
+	.loc 1 168 1 is_stmt 0 view .LVU265
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LBB56:
+.LBB54:
+	.loc 1 95 10 view .LVU266
+	movq	%r12, %rdi
+.LBE54:
+.LBE56:
+	.loc 1 168 1 view .LVU267
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL72:
+	.loc 1 168 1 view .LVU268
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL73:
+	.loc 1 168 1 view .LVU269
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL74:
+	.loc 1 168 1 view .LVU270
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LBB57:
+.LBB55:
+	.loc 1 95 10 view .LVU271
+	jmp	st_output_flush@PLT
+.LVL75:
+	.p2align 4,,10
+	.p2align 3
+.L105:
+	.cfi_restore_state
+	.loc 1 93 12 view .LVU272
+	movl	$1, %edx
+.LVL76:
+.L80:
+	.loc 1 93 12 view .LVU273
+.LBE55:
+.LBE57:
+	.loc 1 168 1 view .LVU274
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL77:
+	.loc 1 168 1 view .LVU275
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL78:
+	.loc 1 168 1 view .LVU276
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL79:
+	.loc 1 168 1 view .LVU277
+	movl	%edx, %eax
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	st_output_append_n, .-st_output_append_n
+	.p2align 4
+	.globl	st_output_append_string
+	.type	st_output_append_string, @function
+st_output_append_string:
+.LVL80:
+.LFB33:
+	.loc 1 173 78 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 174 3 view .LVU279
+	.loc 1 173 78 is_stmt 0 view .LVU280
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	.loc 1 174 10 view .LVU281
+	movq	%rsi, %rdi
+.LVL81:
+	.loc 1 173 78 view .LVU282
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 174 10 view .LVU283
+	call	strlen@PLT
+.LVL82:
+	.loc 1 175 1 view .LVU284
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	.loc 1 174 10 view .LVU285
+	movq	%rbx, %rsi
+	.loc 1 175 1 view .LVU286
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL83:
+	.loc 1 174 10 view .LVU287
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	.loc 1 175 1 view .LVU288
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL84:
+	.loc 1 174 10 view .LVU289
+	jmp	st_output_append_n@PLT
+.LVL85:
+	.loc 1 174 10 view .LVU290
+	.cfi_endproc
+.LFE33:
+	.size	st_output_append_string, .-st_output_append_string
+	.p2align 4
+	.globl	st_output_append_char
+	.type	st_output_append_char, @function
+st_output_append_char:
+.LVL86:
+.LFB34:
+	.loc 1 180 74 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 181 3 view .LVU292
+	.loc 1 180 74 is_stmt 0 view .LVU293
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 180 74 view .LVU294
+	movb	%sil, 12(%rsp)
+	.loc 1 181 10 view .LVU295
+	movl	$1, %edx
+	leaq	12(%rsp), %rsi
+.LVL87:
+	.loc 1 181 10 view .LVU296
+	call	st_output_append_n@PLT
+.LVL88:
+	.loc 1 182 1 view .LVU297
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	st_output_append_char, .-st_output_append_char
+	.p2align 4
+	.globl	st_output_commit
+	.type	st_output_commit, @function
+st_output_commit:
+.LVL89:
+.LFB31:
+	.loc 1 138 70 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 139 3 view .LVU299
+	.loc 1 139 9 is_stmt 0 view .LVU300
+	movq	8(%rdi), %rax
+	.loc 1 139 22 view .LVU301
+	addq	%rsi, 16(%rax)
+	.loc 1 140 3 is_stmt 1 view .LVU302
+.LBB60:
+.LBB61:
+	.loc 1 92 13 is_stmt 0 view .LVU303
+	movq	40(%rdi), %rax
+.LBE61:
+.LBE60:
+	.loc 1 140 18 view .LVU304
+	addq	32(%rdi), %rsi
+.LVL90:
+	.loc 1 140 18 view .LVU305
+	movq	%rsi, 32(%rdi)
+	.loc 1 141 3 is_stmt 1 view .LVU306
+.LVL91:
+.LBB63:
+.LBI60:
+	.loc 1 91 12 view .LVU307
+.LBB62:
+	.loc 1 92 3 view .LVU308
+	.loc 1 92 6 is_stmt 0 view .LVU309
+	testq	%rax, %rax
+	je	.L110
+	.loc 1 92 54 view .LVU310
+	movl	48(%rdi), %edx
+	testl	%edx, %edx
+	js	.L110
+	cmpq	%rax, %rsi
+	jb	.L110
+	.loc 1 95 3 is_stmt 1 view .LVU311
+	.loc 1 95 10 is_stmt 0 view .LVU312
+	jmp	st_output_flush@PLT
+.LVL92:
+	.p2align 4,,10
+	.p2align 3
+.L110:
+	.loc 1 95 10 view .LVU313
+.LBE62:
+.LBE63:
+	.loc 1 142 1 view .LVU314
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	st_output_commit, .-st_output_commit
+	.p2align 4
+	.globl	st_output_append_int
+	.type	st_output_append_int, @function
+st_output_append_int:
+.LVL93:
+.LFB35:
+	.loc 1 187 76 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 189 3 view .LVU316
+	.loc 1 187 76 is_stmt 0 view .LVU317
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 189 73 view .LVU318
+	cmpq	$20, 24(%rdi)
+	jbe	.L116
+	.loc 1 189 43 discriminator 1 view .LVU319
+	movl	$21, %esi
+.LVL94:
+	.loc 1 189 43 discriminator 1 view .LVU320
+	call	st_output_reserve@PLT
+.LVL95:
+	.loc 1 190 3 is_stmt 1 discriminator 1 view .LVU321
+	.loc 1 190 6 is_stmt 0 discriminator 1 view .LVU322
+	testq	%rax, %rax
+	jne	.L121
+.LVL96:
+.L116:
+	.loc 1 193 3 is_stmt 1 view .LVU323
+	.loc 1 194 3 view .LVU324
+	.loc 1 194 10 is_stmt 0 view .LVU325
+	movq	%rsp, %r12
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	i64tos_to@PLT
+.LVL97:
+	movq	%rax, %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	st_output_append_n@PLT
+.LVL98:
+	.loc 1 195 1 view .LVU326
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL99:
+	.loc 1 195 1 view .LVU327
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL100:
+	.loc 1 195 1 view .LVU328
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL101:
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	.cfi_restore_state
+	.loc 1 191 5 is_stmt 1 view .LVU329
+	.loc 1 191 12 is_stmt 0 view .LVU330
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	i64tos_to@PLT
+.LVL102:
+	.loc 1 195 1 view .LVU331
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 191 12 view .LVU332
+	movq	%rbx, %rdi
+	.loc 1 195 1 view .LVU333
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL103:
+	.loc 1 195 1 view .LVU334
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL104:
+	.loc 1 191 12 view .LVU335
+	movq	%rax, %rsi
+	.loc 1 195 1 view .LVU336
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	.loc 1 191 12 view .LVU337
+	jmp	st_output_commit@PLT
+.LVL105:
+	.loc 1 191 12 view .LVU338
+	.cfi_endproc
+.LFE35:
+	.size	st_output_append_int, .-st_output_append_int
+	.p2align 4
+	.globl	st_output_append_double
+	.type	st_output_append_double, @function
+st_output_append_double:
+.LVL106:
+.LFB36:
+	.loc 1 200 78 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 202 3 view .LVU340
+	.loc 1 200 78 is_stmt 0 view .LVU341
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 202 73 view .LVU342
+	cmpq	$31, 24(%rdi)
+	jbe	.L123
+	.loc 1 202 43 discriminator 1 view .LVU343
+	movl	$32, %esi
+	vmovsd	%xmm0, 8(%rsp)
+	call	st_output_reserve@PLT
+.LVL107:
+	.loc 1 203 3 is_stmt 1 discriminator 1 view .LVU344
+	.loc 1 203 6 is_stmt 0 discriminator 1 view .LVU345
+	testq	%rax, %rax
+	vmovsd	8(%rsp), %xmm0
+	jne	.L128
+.LVL108:
+.L123:
+	.loc 1 206 3 is_stmt 1 view .LVU346
+	.loc 1 207 3 view .LVU347
+	.loc 1 207 10 is_stmt 0 view .LVU348
+	leaq	16(%rsp), %rbp
+	movq	%rbp, %rdi
+	call	dtos_to@PLT
+.LVL109:
+	movq	%rax, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	st_output_append_n@PLT
+.LVL110:
+	.loc 1 208 1 view .LVU349
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL111:
+	.loc 1 208 1 view .LVU350
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL112:
+	.p2align 4,,10
+	.p2align 3
+.L128:
+	.cfi_restore_state
+	.loc 1 204 5 is_stmt 1 view .LVU351
+	.loc 1 204 12 is_stmt 0 view .LVU352
+	movq	%rax, %rdi
+	call	dtos_to@PLT
+.LVL113:
+	.loc 1 208 1 view .LVU353
+	addq	$56, %rsp
+	.cfi_def_cfa_offset 24
+	.loc 1 204 12 view .LVU354
+	movq	%rbx, %rdi
+	.loc 1 208 1 view .LVU355
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL114:
+	.loc 1 204 12 view .LVU356
+	movq	%rax, %rsi
+	.loc 1 208 1 view .LVU357
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	.loc 1 204 12 view .LVU358
+	jmp	st_output_commit@PLT
+.LVL115:
+	.loc 1 204 12 view .LVU359
+	.cfi_endproc
+.LFE36:
+	.size	st_output_append_double, .-st_output_append_double
+	.p2align 4
+	.globl	st_output_reset
+	.type	st_output_reset, @function
+st_output_reset:
+.LVL116:
+.LFB39:
+	.loc 1 278 51 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 279 3 view .LVU361
+	.loc 1 278 51 is_stmt 0 view .LVU362
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 279 29 view .LVU363
+	movq	(%rdi), %rbx
+.LVL117:
+.L139:
+	.loc 1 280 3 is_stmt 1 view .LVU364
+	.loc 1 280 16 view .LVU365
+	testq	%rbx, %rbx
+	je	.L130
+.L141:
+.LBB64:
+	.loc 1 281 5 view .LVU366
+.LBB65:
+.LBB66:
+	.loc 1 42 6 is_stmt 0 view .LVU367
+	cmpq	$0, 16(%rbp)
+	movq	%rbx, %rdi
+.LBE66:
+.LBE65:
+	.loc 1 281 31 view .LVU368
+	movq	(%rbx), %rbx
+.LVL118:
+	.loc 1 282 5 is_stmt 1 view .LVU369
+.LBB69:
+.LBI65:
+	.loc 1 41 13 view .LVU370
+.LBB67:
+	.loc 1 42 3 view .LVU371
+	.loc 1 42 6 is_stmt 0 view .LVU372
+	je	.L140
+	.loc 1 46 3 is_stmt 1 view .LVU373
+	call	free@PLT
+.LVL119:
+	.loc 1 46 3 is_stmt 0 view .LVU374
+.LBE67:
+.LBE69:
+.LBE64:
+	.loc 1 280 16 is_stmt 1 view .LVU375
+	.loc 1 280 3 view .LVU376
+	.loc 1 280 16 view .LVU377
+	testq	%rbx, %rbx
+	jne	.L141
+.LVL120:
+.L130:
+	.loc 1 285 3 view .LVU378
+	.loc 1 285 16 is_stmt 0 view .LVU379
+	movq	$0, 0(%rbp)
+	.loc 1 286 3 is_stmt 1 view .LVU380
+	.loc 1 286 16 is_stmt 0 view .LVU381
+	movq	$0, 8(%rbp)
+	.loc 1 287 3 is_stmt 1 view .LVU382
+	.loc 1 287 18 is_stmt 0 view .LVU383
+	movq	$0, 32(%rbp)
+	.loc 1 288 1 view .LVU384
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL121:
+	.loc 1 288 1 view .LVU385
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL122:
+	.loc 1 288 1 view .LVU386
+	ret
+.LVL123:
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	.cfi_restore_state
+.LBB71:
+.LBB70:
+.LBB68:
+	.loc 1 43 5 is_stmt 1 view .LVU387
+	.loc 1 43 19 is_stmt 0 view .LVU388
+	movq	%rdi, 16(%rbp)
+	.loc 1 44 5 is_stmt 1 view .LVU389
+	jmp	.L139
+.LBE68:
+.LBE70:
+.LBE71:
+	.cfi_endproc
+.LFE39:
+	.size	st_output_reset, .-st_output_reset
+	.p2align 4
+	.globl	st_output_destroy
+	.type	st_output_destroy, @function
+st_output_destroy:
+.LVL124:
+.LFB40:
+	.loc 1 293 53 view -0
+	.cfi_startproc
+	.loc 1 294 3 view .LVU391
+	.loc 1 294 6 is_stmt 0 view .LVU392
+	testq	%rdi, %rdi
+	je	.L144
+	.loc 1 293 53 view .LVU393
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 297 3 is_stmt 1 view .LVU394
+	call	st_output_reset@PLT
+.LVL125:
+	.loc 1 298 3 view .LVU395
+	movq	16(%rbx), %rdi
+	call	free@PLT
+.LVL126:
+	.loc 1 299 3 view .LVU396
+	movq	%rbx, %rdi
+	.loc 1 300 1 is_stmt 0 view .LVU397
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL127:
+	.loc 1 299 3 view .LVU398
+	jmp	free@PLT
+.LVL128:
+	.p2align 4,,10
+	.p2align 3
+.L144:
+	.loc 1 299 3 view .LVU399
+	ret
+	.cfi_endproc
+.LFE40:
+	.size	st_output_destroy, .-st_output_destroy
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.file 7 "/root/repo/src/../include/strutils.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/sys/uio.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "/usr/include/stdlib.h"
+	.file 11 "/usr/include/errno.h"
+	.file 12 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xc3e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x23
+	.long	.LASF69
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2
+	.uleb128 0x11
+	.long	.LASF11
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x46
+	.uleb128 0xb
+	.long	0x35
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.long	0x4d
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF5
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF6
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x11
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x59
+	.uleb128 0x25
+	.byte	0x8
+	.uleb128 0x11
+	.long	.LASF13
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x59
+	.uleb128 0x7
+	.long	0xa9
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0xb
+	.long	0xa9
+	.uleb128 0x11
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x6c
+	.byte	0x13
+	.long	0x98
+	.uleb128 0x11
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x13
+	.long	0x8a
+	.uleb128 0xb
+	.long	0xc1
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF17
+	.uleb128 0x14
+	.long	0xa9
+	.long	0xe9
+	.uleb128 0x17
+	.long	0x46
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x7
+	.long	0xee
+	.uleb128 0x26
+	.uleb128 0x7
+	.long	0xb0
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF18
+	.uleb128 0xb
+	.long	0x2e
+	.uleb128 0x19
+	.long	.LASF21
+	.byte	0x10
+	.byte	0x6
+	.byte	0x1a
+	.long	0x127
+	.uleb128 0xe
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x1c
+	.byte	0xb
+	.long	0x96
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x1d
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	0x100
+	.uleb128 0x7
+	.long	0x100
+	.uleb128 0x27
+	.long	.LASF22
+	.byte	0x48
+	.byte	0x7
+	.value	0x877
+	.byte	0x8
+	.long	0x1b5
+	.uleb128 0xa
+	.long	.LASF23
+	.value	0x87c
+	.byte	0x1d
+	.long	0x1fb
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF24
+	.value	0x881
+	.byte	0x1d
+	.long	0x1fb
+	.byte	0x8
+	.uleb128 0xa
+	.long	.LASF25
+	.value	0x886
+	.byte	0x1d
+	.long	0x1fb
+	.byte	0x10
+	.uleb128 0xa
+	.long	.LASF26
+	.value	0x88b
+	.byte	0xa
+	.long	0x35
+	.byte	0x18
+	.uleb128 0xa
+	.long	.LASF27
+	.value	0x890
+	.byte	0xa
+	.long	0x35
+	.byte	0x20
+	.uleb128 0xa
+	.long	.LASF28
+	.value	0x895
+	.byte	0xa
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x28
+	.string	"fd"
+	.byte	0x7
+	.value	0x89a
+	.byte	0x7
+	.long	0x4d
+	.byte	0x30
+	.uleb128 0xa
+	.long	.LASF29
+	.value	0x89f
+	.byte	0xa
+	.long	0x35
+	.byte	0x38
+	.uleb128 0xa
+	.long	.LASF30
+	.value	0x8a4
+	.byte	0x7
+	.long	0x4d
+	.byte	0x40
+	.byte	0
+	.uleb128 0xb
+	.long	0x131
+	.uleb128 0x19
+	.long	.LASF31
+	.byte	0x18
+	.byte	0x1
+	.byte	0xa
+	.long	0x1fb
+	.uleb128 0xe
+	.long	.LASF32
+	.byte	0x1
+	.byte	0xf
+	.byte	0x1d
+	.long	0x1fb
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF33
+	.byte	0x1
+	.byte	0x14
+	.byte	0xa
+	.long	0x35
+	.byte	0x8
+	.uleb128 0xe
+	.long	.LASF34
+	.byte	0x1
+	.byte	0x19
+	.byte	0xa
+	.long	0x35
+	.byte	0x10
+	.uleb128 0xe
+	.long	.LASF35
+	.byte	0x1
+	.byte	0x1e
+	.byte	0x8
+	.long	0x200
+	.byte	0x18
+	.byte	0
+	.uleb128 0x7
+	.long	0x1ba
+	.uleb128 0x14
+	.long	0xa9
+	.long	0x20f
+	.uleb128 0x29
+	.long	0x46
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF70
+	.byte	0xa
+	.value	0x238
+	.byte	0xd
+	.long	0x222
+	.uleb128 0x3
+	.long	0x96
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF71
+	.byte	0xb
+	.byte	0x25
+	.byte	0xd
+	.long	0x22e
+	.uleb128 0x7
+	.long	0x4d
+	.uleb128 0x1a
+	.long	.LASF36
+	.byte	0x8
+	.byte	0x34
+	.byte	0x10
+	.long	0xb5
+	.long	0x253
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x253
+	.uleb128 0x3
+	.long	0x4d
+	.byte	0
+	.uleb128 0x7
+	.long	0x127
+	.uleb128 0x15
+	.long	.LASF37
+	.byte	0x7
+	.value	0x64e
+	.byte	0x8
+	.long	0x35
+	.long	0x274
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0xfb
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF38
+	.byte	0x7
+	.value	0x607
+	.byte	0x8
+	.long	0x35
+	.long	0x290
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0xc1
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF39
+	.byte	0x9
+	.value	0x197
+	.byte	0xf
+	.long	0x35
+	.long	0x2a7
+	.uleb128 0x3
+	.long	0xef
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF40
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.long	0x96
+	.long	0x2c7
+	.uleb128 0x3
+	.long	0x96
+	.uleb128 0x3
+	.long	0xe9
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF41
+	.byte	0xa
+	.value	0x229
+	.byte	0xe
+	.long	0x96
+	.long	0x2de
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF42
+	.value	0x125
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x34a
+	.uleb128 0x1c
+	.long	.LASF44
+	.value	0x125
+	.byte	0x2d
+	.long	0x34a
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x5
+	.quad	.LVL125
+	.long	0x34f
+	.long	0x327
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL126
+	.long	0x20f
+	.uleb128 0xc
+	.quad	.LVL128
+	.long	0x20f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x131
+	.uleb128 0x1b
+	.long	.LASF43
+	.value	0x116
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ec
+	.uleb128 0x1c
+	.long	.LASF44
+	.value	0x116
+	.byte	0x2b
+	.long	0x34a
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x1d
+	.long	.LASF45
+	.value	0x117
+	.byte	0x1d
+	.long	0x1fb
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x16
+	.long	.LLRL54
+	.uleb128 0x1d
+	.long	.LASF32
+	.value	0x119
+	.byte	0x1f
+	.long	0x1fb
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x1e
+	.long	0xabc
+	.quad	.LBI65
+	.byte	.LVU370
+	.long	.LLRL56
+	.value	0x11a
+	.byte	0x5
+	.uleb128 0x6
+	.long	0xad4
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x6
+	.long	0xac9
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0xf
+	.quad	.LVL119
+	.long	0x20f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF46
+	.byte	0x1
+	.byte	0xe3
+	.byte	0x5
+	.long	0x4d
+	.byte	0x1
+	.long	0x450
+	.uleb128 0x12
+	.long	.LASF44
+	.byte	0xe3
+	.byte	0x2a
+	.long	0x34a
+	.uleb128 0x2d
+	.string	"iov"
+	.byte	0x1
+	.byte	0xe8
+	.byte	0x10
+	.long	0x450
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF47
+	.byte	0xea
+	.byte	0xc
+	.long	0x35
+	.uleb128 0x10
+	.long	.LASF29
+	.byte	0xeb
+	.byte	0xd
+	.long	0xb5
+	.uleb128 0x10
+	.long	.LASF48
+	.byte	0xfb
+	.byte	0xc
+	.long	0x35
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF45
+	.byte	0xfd
+	.byte	0x21
+	.long	0x1fb
+	.uleb128 0x10
+	.long	.LASF49
+	.byte	0xfe
+	.byte	0xe
+	.long	0x35
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x100
+	.long	0x460
+	.uleb128 0x17
+	.long	0x46
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF51
+	.byte	0xd5
+	.byte	0x8
+	.long	0x35
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4dd
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0xd5
+	.byte	0x31
+	.long	0x4dd
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2e
+	.string	"iov"
+	.byte	0x1
+	.byte	0xd5
+	.byte	0x47
+	.long	0x12c
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2f
+	.long	.LASF47
+	.byte	0x1
+	.byte	0xd5
+	.byte	0x59
+	.long	0x41
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.long	.LASF50
+	.byte	0xd6
+	.byte	0xa
+	.long	0x35
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x16
+	.long	.LLRL12
+	.uleb128 0x9
+	.long	.LASF45
+	.byte	0xd7
+	.byte	0x22
+	.long	0x1fb
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x1b5
+	.uleb128 0x8
+	.long	.LASF52
+	.byte	0xc8
+	.byte	0x5
+	.long	0x4d
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5c0
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0xc8
+	.byte	0x32
+	.long	0x34a
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x2
+	.long	.LASF53
+	.byte	0xc8
+	.byte	0x47
+	.long	0xfb
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x9
+	.long	.LASF54
+	.byte	0xca
+	.byte	0x9
+	.long	0xa4
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x20
+	.long	.LASF56
+	.byte	0xce
+	.long	0xd9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x5
+	.quad	.LVL107
+	.long	0x95c
+	.long	0x567
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL109
+	.long	0x258
+	.long	0x57f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL110
+	.long	0x7a2
+	.long	0x59d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL113
+	.long	0x258
+	.uleb128 0xc
+	.quad	.LVL115
+	.long	0x8dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF55
+	.byte	0xbb
+	.byte	0x5
+	.long	0x4d
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6ae
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0xbb
+	.byte	0x2f
+	.long	0x34a
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x2
+	.long	.LASF53
+	.byte	0xbb
+	.byte	0x45
+	.long	0xcd
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x9
+	.long	.LASF54
+	.byte	0xbd
+	.byte	0x9
+	.long	0xa4
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x20
+	.long	.LASF56
+	.byte	0xc1
+	.long	0x6ae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x5
+	.quad	.LVL95
+	.long	0x95c
+	.long	0x644
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x45
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL97
+	.long	0x274
+	.long	0x662
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL98
+	.long	0x7a2
+	.long	0x680
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL102
+	.long	0x274
+	.long	0x698
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL105
+	.long	0x8dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0xa9
+	.long	0x6be
+	.uleb128 0x17
+	.long	0x46
+	.byte	0x14
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF57
+	.byte	0xb4
+	.byte	0x5
+	.long	0x4d
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x726
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0xb4
+	.byte	0x30
+	.long	0x34a
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x2
+	.long	.LASF58
+	.byte	0xb4
+	.byte	0x43
+	.long	0xb0
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x13
+	.quad	.LVL88
+	.long	0x7a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF59
+	.byte	0xad
+	.byte	0x5
+	.long	0x4d
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7a2
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0xad
+	.byte	0x32
+	.long	0x34a
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x2
+	.long	.LASF60
+	.byte	0xad
+	.byte	0x46
+	.long	0xef
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x5
+	.quad	.LVL82
+	.long	0x290
+	.long	0x785
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL85
+	.long	0x7a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF61
+	.byte	0x93
+	.byte	0x5
+	.long	0x4d
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8dd
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x93
+	.byte	0x2d
+	.long	0x34a
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x2
+	.long	.LASF60
+	.byte	0x93
+	.byte	0x41
+	.long	0xef
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x2
+	.long	.LASF27
+	.byte	0x93
+	.byte	0x56
+	.long	0x41
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x9
+	.long	.LASF62
+	.byte	0x94
+	.byte	0xa
+	.long	0x35
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x30
+	.long	.LLRL30
+	.long	0x8a5
+	.uleb128 0x9
+	.long	.LASF45
+	.byte	0x96
+	.byte	0x1f
+	.long	0x1fb
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x9
+	.long	.LASF47
+	.byte	0x9e
+	.byte	0xc
+	.long	0x35
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x31
+	.long	0xa96
+	.quad	.LBI47
+	.byte	.LVU224
+	.long	.LLRL33
+	.byte	0x1
+	.byte	0x98
+	.byte	0xf
+	.long	0x890
+	.uleb128 0x6
+	.long	0xaa5
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x16
+	.long	.LLRL33
+	.uleb128 0xd
+	.long	0xab0
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x13
+	.quad	.LVL70
+	.long	0x2c7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL62
+	.long	0xc36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0xa7b
+	.quad	.LBI52
+	.byte	.LVU256
+	.long	.LLRL36
+	.byte	0xa7
+	.byte	0xa
+	.uleb128 0x6
+	.long	0xa8a
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xc
+	.quad	.LVL75
+	.long	0x3ec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF63
+	.byte	0x8a
+	.byte	0x5
+	.long	0x4d
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x95c
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x8a
+	.byte	0x2b
+	.long	0x34a
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x2
+	.long	.LASF64
+	.byte	0x8a
+	.byte	0x40
+	.long	0x41
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x18
+	.long	0xa7b
+	.quad	.LBI60
+	.byte	.LVU307
+	.long	.LLRL44
+	.byte	0x8d
+	.byte	0xa
+	.uleb128 0x6
+	.long	0xa8a
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0xc
+	.quad	.LVL92
+	.long	0x3ec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF65
+	.byte	0x78
+	.byte	0x7
+	.long	0xa4
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9f9
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x78
+	.byte	0x2e
+	.long	0x34a
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2
+	.long	.LASF64
+	.byte	0x78
+	.byte	0x43
+	.long	0x41
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x9
+	.long	.LASF45
+	.byte	0x7c
+	.byte	0x1d
+	.long	0x1fb
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x18
+	.long	0xa96
+	.quad	.LBI15
+	.byte	.LVU45
+	.long	.LLRL7
+	.byte	0x7f
+	.byte	0xd
+	.uleb128 0x6
+	.long	0xaa5
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x16
+	.long	.LLRL7
+	.uleb128 0xd
+	.long	0xab0
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xf
+	.quad	.LVL17
+	.long	0x2c7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF66
+	.byte	0x65
+	.byte	0x16
+	.long	0x34a
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa7b
+	.uleb128 0x32
+	.string	"fd"
+	.byte	0x1
+	.byte	0x65
+	.byte	0x31
+	.long	0x54
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x65
+	.byte	0x42
+	.long	0x41
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2
+	.long	.LASF28
+	.byte	0x65
+	.byte	0x5b
+	.long	0x41
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x9
+	.long	.LASF44
+	.byte	0x66
+	.byte	0x18
+	.long	0x34a
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x13
+	.quad	.LVL2
+	.long	0x2c7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x48
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF67
+	.byte	0x5b
+	.byte	0xc
+	.long	0x4d
+	.long	0xa96
+	.uleb128 0x12
+	.long	.LASF44
+	.byte	0x5b
+	.byte	0x3a
+	.long	0x34a
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF68
+	.byte	0x3a
+	.byte	0x22
+	.long	0x1fb
+	.long	0xabc
+	.uleb128 0x12
+	.long	.LASF44
+	.byte	0x3a
+	.byte	0x4a
+	.long	0x34a
+	.uleb128 0x10
+	.long	.LASF45
+	.byte	0x3b
+	.byte	0x1d
+	.long	0x1fb
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF72
+	.byte	0x1
+	.byte	0x29
+	.byte	0xd
+	.byte	0x1
+	.long	0xae0
+	.uleb128 0x12
+	.long	.LASF44
+	.byte	0x29
+	.byte	0x38
+	.long	0x34a
+	.uleb128 0x12
+	.long	.LASF45
+	.byte	0x29
+	.byte	0x5a
+	.long	0x1fb
+	.byte	0
+	.uleb128 0x22
+	.long	0x3ec
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbf3
+	.uleb128 0x6
+	.long	0x3fd
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x34
+	.long	0x408
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1056
+	.uleb128 0x35
+	.long	0x414
+	.long	.LLRL15
+	.uleb128 0xd
+	.long	0x415
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xd
+	.long	0x420
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0xd
+	.long	0x42b
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x36
+	.long	0x436
+	.long	.LLRL19
+	.long	0xba6
+	.uleb128 0xd
+	.long	0x437
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xd
+	.long	0x442
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x1e
+	.long	0xabc
+	.quad	.LBI28
+	.byte	.LVU160
+	.long	.LLRL22
+	.value	0x10c
+	.byte	0x7
+	.uleb128 0x6
+	.long	0xad4
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x6
+	.long	0xac9
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xf
+	.quad	.LVL41
+	.long	0x20f
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL34
+	.long	0x460
+	.long	0xbca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL36
+	.long	0x222
+	.uleb128 0x13
+	.quad	.LVL38
+	.long	0x233
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0x3ec
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc36
+	.uleb128 0x6
+	.long	0x3fd
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x37
+	.long	0x408
+	.uleb128 0xc
+	.quad	.LVL56
+	.long	0xae0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF40
+	.long	.LASF73
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU395
+	.uleb128 .LVU395
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL125-1-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU364
+	.uleb128 .LVU364
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 .LVU387
+	.uleb128 .LVU387
+	.uleb128 0
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU364
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU385
+	.uleb128 .LVU387
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU369
+	.uleb128 .LVU378
+	.uleb128 .LVU387
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU370
+	.uleb128 .LVU374
+	.uleb128 .LVU387
+	.uleb128 0
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU370
+	.uleb128 .LVU374
+	.uleb128 .LVU387
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU85
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU105
+	.uleb128 .LVU108
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU88
+	.uleb128 .LVU107
+	.uleb128 .LVU108
+	.uleb128 .LVU111
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS49:
+	.uleb128 0
+	.uleb128 .LVU344
+	.uleb128 .LVU344
+	.uleb128 .LVU350
+	.uleb128 .LVU350
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 .LVU356
+	.uleb128 .LVU356
+	.uleb128 .LVU359
+	.uleb128 .LVU359
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 0
+	.uleb128 .LVU344
+	.uleb128 .LVU344
+	.uleb128 .LVU346
+	.uleb128 .LVU346
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU344
+	.uleb128 .LVU346
+	.uleb128 .LVU351
+	.uleb128 .LVU353
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU321
+	.uleb128 .LVU321
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 .LVU328
+	.uleb128 .LVU328
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU321
+	.uleb128 .LVU323
+	.uleb128 .LVU329
+	.uleb128 .LVU331
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS40:
+	.uleb128 0
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL88-1-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 0
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU297
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU287
+	.uleb128 .LVU287
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL85-1-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU275
+	.uleb128 .LVU275
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL75-1-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU277
+	.uleb128 .LVU277
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU196
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU208
+	.uleb128 .LVU214
+	.uleb128 .LVU254
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU200
+	.uleb128 .LVU216
+	.uleb128 .LVU218
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU254
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU202
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU216
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 24
+	.byte	0x6
+	.byte	0x76
+	.sleb128 16
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU224
+	.uleb128 .LVU244
+	.uleb128 .LVU247
+	.uleb128 .LVU254
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU227
+	.uleb128 .LVU244
+	.uleb128 .LVU247
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU254
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU256
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU273
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL75-1-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU307
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU39
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+	.uleb128 .LVU77
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU45
+	.uleb128 .LVU65
+	.uleb128 .LVU73
+	.uleb128 .LVU77
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU48
+	.uleb128 .LVU65
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU77
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU7
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU118
+	.uleb128 .LVU119
+	.uleb128 .LVU125
+	.uleb128 .LVU137
+	.uleb128 .LVU166
+	.uleb128 .LVU167
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU134
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU166
+	.uleb128 .LVU171
+	.uleb128 .LVU177
+	.uleb128 .LVU180
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 .LVU142
+	.uleb128 .LVU166
+	.uleb128 .LVU171
+	.uleb128 .LVU177
+	.uleb128 .LVU180
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 .LVU145
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU166
+	.uleb128 .LVU171
+	.uleb128 .LVU177
+	.uleb128 .LVU180
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 .LVU160
+	.uleb128 .LVU166
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 .LVU160
+	.uleb128 .LVU166
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0
+.LLRL56:
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF46:
+	.string	"st_output_flush"
+.LASF71:
+	.string	"__errno_location"
+.LASF58:
+	.string	"token"
+.LASF73:
+	.string	"__builtin_memcpy"
+.LASF26:
+	.string	"block_size"
+.LASF28:
+	.string	"flush_threshold"
+.LASF10:
+	.string	"short int"
+.LASF11:
+	.string	"size_t"
+.LASF41:
+	.string	"malloc"
+.LASF37:
+	.string	"dtos_to"
+.LASF20:
+	.string	"iov_len"
+.LASF29:
+	.string	"written"
+.LASF40:
+	.string	"memcpy"
+.LASF15:
+	.string	"ssize_t"
+.LASF36:
+	.string	"writev"
+.LASF16:
+	.string	"int64_t"
+.LASF53:
+	.string	"value"
+.LASF31:
+	.string	"StringOutputBlock"
+.LASF23:
+	.string	"head"
+.LASF65:
+	.string	"st_output_reserve"
+.LASF72:
+	.string	"string_output_release"
+.LASF70:
+	.string	"free"
+.LASF62:
+	.string	"copied"
+.LASF27:
+	.string	"length"
+.LASF5:
+	.string	"long long int"
+.LASF13:
+	.string	"__ssize_t"
+.LASF52:
+	.string	"st_output_append_double"
+.LASF4:
+	.string	"long int"
+.LASF12:
+	.string	"__int64_t"
+.LASF60:
+	.string	"string"
+.LASF45:
+	.string	"block"
+.LASF67:
+	.string	"string_output_auto_flush"
+.LASF22:
+	.string	"StringOutput"
+.LASF18:
+	.string	"long double"
+.LASF24:
+	.string	"tail"
+.LASF6:
+	.string	"unsigned char"
+.LASF21:
+	.string	"iovec"
+.LASF38:
+	.string	"i64tos_to"
+.LASF25:
+	.string	"spare"
+.LASF9:
+	.string	"signed char"
+.LASF49:
+	.string	"pending"
+.LASF17:
+	.string	"long long unsigned int"
+.LASF8:
+	.string	"unsigned int"
+.LASF63:
+	.string	"st_output_commit"
+.LASF33:
+	.string	"start"
+.LASF7:
+	.string	"short unsigned int"
+.LASF14:
+	.string	"char"
+.LASF39:
+	.string	"strlen"
+.LASF35:
+	.string	"data"
+.LASF56:
+	.string	"buffer"
+.LASF42:
+	.string	"st_output_destroy"
+.LASF3:
+	.string	"long unsigned int"
+.LASF19:
+	.string	"iov_base"
+.LASF69:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF50:
+	.string	"filled"
+.LASF64:
+	.string	"size"
+.LASF55:
+	.string	"st_output_append_int"
+.LASF47:
+	.string	"count"
+.LASF66:
+	.string	"st_output_create"
+.LASF48:
+	.string	"remaining"
+.LASF34:
+	.string	"used"
+.LASF57:
+	.string	"st_output_append_char"
+.LASF44:
+	.string	"output"
+.LASF30:
+	.string	"error"
+.LASF2:
+	.string	"double"
+.LASF61:
+	.string	"st_output_append_n"
+.LASF68:
+	.string	"string_output_grow"
+.LASF43:
+	.string	"st_output_reset"
+.LASF54:
+	.string	"room"
+.LASF59:
+	.string	"st_output_append_string"
+.LASF51:
+	.string	"st_output_iov"
+.LASF32:
+	.string	"next"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/string_output.c"
+.LASF1:
+	.string	"/root/repo/build/test"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
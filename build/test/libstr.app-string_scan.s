@@ -0,0 +1,23719 @@
+	.file	"string_scan.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/src/string_scan.c"
+	.p2align 4
+	.type	st_scan_delimiter_scalar, @function
+st_scan_delimiter_scalar:
+.LVL0:
+.LFB6407:
+	.file 1 "/root/repo/src/string_scan.c"
+	.loc 1 48 99 view -0
+	.cfi_startproc
+	.loc 1 49 3 view .LVU1
+	.loc 1 50 3 view .LVU2
+	.loc 1 50 51 view .LVU3
+	.loc 1 49 10 is_stmt 0 view .LVU4
+	xorl	%eax, %eax
+	.loc 1 50 51 view .LVU5
+	testq	%rsi, %rsi
+	jne	.L2
+	jmp	.L13
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.loc 1 50 51 discriminator 1 view .LVU6
+	cmpb	%dl, %cl
+	je	.L1
+	.loc 1 51 5 is_stmt 1 view .LVU7
+	.loc 1 51 10 is_stmt 0 view .LVU8
+	incq	%rax
+.LVL2:
+	.loc 1 50 51 is_stmt 1 view .LVU9
+	cmpq	%rax, %rsi
+	je	.L1
+.LVL3:
+.L2:
+	.loc 1 50 34 is_stmt 0 discriminator 1 view .LVU10
+	movzbl	(%rdi,%rax), %ecx
+	.loc 1 50 51 discriminator 1 view .LVU11
+	testb	%cl, %cl
+	jne	.L14
+.L1:
+	.loc 1 54 1 view .LVU12
+	ret
+.LVL4:
+.L13:
+	.loc 1 54 1 view .LVU13
+	ret
+	.cfi_endproc
+.LFE6407:
+	.size	st_scan_delimiter_scalar, .-st_scan_delimiter_scalar
+	.p2align 4
+	.type	st_scan_non_whitespace_scalar, @function
+st_scan_non_whitespace_scalar:
+.LVL5:
+.LFB6408:
+	.loc 1 59 86 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 60 3 view .LVU15
+	.loc 1 61 3 view .LVU16
+	.loc 1 61 25 view .LVU17
+	.loc 1 59 86 is_stmt 0 view .LVU18
+	movq	%rsi, %rax
+	.loc 1 61 25 view .LVU19
+	testq	%rsi, %rsi
+	je	.L20
+	movq	st_char_classes@GOTPCREL(%rip), %rsi
+.LVL6:
+	.loc 1 60 10 view .LVU20
+	xorl	%edx, %edx
+	jmp	.L16
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.loc 1 62 5 is_stmt 1 view .LVU21
+	.loc 1 62 10 is_stmt 0 view .LVU22
+	incq	%rdx
+.LVL8:
+	.loc 1 61 25 is_stmt 1 view .LVU23
+	cmpq	%rdx, %rax
+	je	.L21
+.LVL9:
+.L16:
+.LBB269:
+.LBI269:
+	.file 2 "/root/repo/src/../include/strutils.h"
+	.loc 2 202 19 discriminator 1 view .LVU24
+.LBB270:
+	.loc 2 203 3 discriminator 1 view .LVU25
+	.loc 2 203 26 is_stmt 0 discriminator 1 view .LVU26
+	movzbl	(%rdi,%rdx), %ecx
+.LBE270:
+.LBE269:
+	.loc 1 61 25 discriminator 1 view .LVU27
+	testb	$1, (%rsi,%rcx)
+	jne	.L18
+	movq	%rdx, %rax
+.LVL10:
+	.loc 1 64 3 is_stmt 1 view .LVU28
+	.loc 1 65 1 is_stmt 0 view .LVU29
+	ret
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	.loc 1 65 1 view .LVU30
+	ret
+.LVL12:
+.L20:
+	.loc 1 65 1 view .LVU31
+	ret
+	.cfi_endproc
+.LFE6408:
+	.size	st_scan_non_whitespace_scalar, .-st_scan_non_whitespace_scalar
+	.p2align 4
+	.type	st_scan_nul_scalar, @function
+st_scan_nul_scalar:
+.LVL13:
+.LFB6409:
+	.loc 1 70 75 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 71 3 view .LVU33
+	.loc 1 72 3 view .LVU34
+	.loc 1 72 25 view .LVU35
+	.loc 1 70 75 is_stmt 0 view .LVU36
+	movq	%rsi, %rax
+	.loc 1 71 10 view .LVU37
+	xorl	%edx, %edx
+	.loc 1 72 25 view .LVU38
+	testq	%rsi, %rsi
+	jne	.L23
+	jmp	.L28
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.loc 1 73 5 is_stmt 1 view .LVU39
+	.loc 1 73 10 is_stmt 0 view .LVU40
+	incq	%rdx
+.LVL15:
+	.loc 1 72 25 is_stmt 1 view .LVU41
+	cmpq	%rdx, %rax
+	je	.L24
+.LVL16:
+.L23:
+	.loc 1 72 25 is_stmt 0 discriminator 1 view .LVU42
+	cmpb	$0, (%rdi,%rdx)
+	jne	.L25
+	movq	%rdx, %rax
+.LVL17:
+.L24:
+	.loc 1 75 3 is_stmt 1 view .LVU43
+	.loc 1 76 1 is_stmt 0 view .LVU44
+	ret
+.LVL18:
+.L28:
+	.loc 1 76 1 view .LVU45
+	ret
+	.cfi_endproc
+.LFE6409:
+	.size	st_scan_nul_scalar, .-st_scan_nul_scalar
+	.p2align 4
+	.type	st_scan_escape_scalar, @function
+st_scan_escape_scalar:
+.LVL19:
+.LFB6410:
+	.loc 1 81 78 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 82 3 view .LVU47
+	.loc 1 83 3 view .LVU48
+	.loc 1 83 25 view .LVU49
+	.loc 1 81 78 is_stmt 0 view .LVU50
+	movq	%rsi, %rax
+	.loc 1 83 25 view .LVU51
+	testq	%rsi, %rsi
+	je	.L34
+	movq	st_char_classes@GOTPCREL(%rip), %rsi
+.LVL20:
+	.loc 1 82 10 view .LVU52
+	xorl	%edx, %edx
+	jmp	.L30
+.LVL21:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.loc 1 84 5 is_stmt 1 view .LVU53
+	.loc 1 84 10 is_stmt 0 view .LVU54
+	incq	%rdx
+.LVL22:
+	.loc 1 83 25 is_stmt 1 view .LVU55
+	cmpq	%rdx, %rax
+	je	.L35
+.LVL23:
+.L30:
+.LBB271:
+.LBI271:
+	.loc 2 202 19 discriminator 1 view .LVU56
+.LBB272:
+	.loc 2 203 3 discriminator 1 view .LVU57
+	.loc 2 203 26 is_stmt 0 discriminator 1 view .LVU58
+	movzbl	(%rdi,%rdx), %ecx
+.LBE272:
+.LBE271:
+	.loc 1 83 25 discriminator 1 view .LVU59
+	testb	$32, (%rsi,%rcx)
+	je	.L32
+	movq	%rdx, %rax
+.LVL24:
+	.loc 1 86 3 is_stmt 1 view .LVU60
+	.loc 1 87 1 is_stmt 0 view .LVU61
+	ret
+.LVL25:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.loc 1 87 1 view .LVU62
+	ret
+.LVL26:
+.L34:
+	.loc 1 87 1 view .LVU63
+	ret
+	.cfi_endproc
+.LFE6410:
+	.size	st_scan_escape_scalar, .-st_scan_escape_scalar
+	.p2align 4
+	.type	st_scan_escape_sse2, @function
+st_scan_escape_sse2:
+.LVL27:
+.LFB6414:
+	.loc 1 160 76 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 161 3 view .LVU65
+	.loc 1 162 3 view .LVU66
+	.loc 1 163 3 view .LVU67
+	.loc 1 164 3 view .LVU68
+	.loc 1 165 3 view .LVU69
+.LBB294:
+.LBB295:
+.LBB296:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h"
+	.loc 3 1427 19 is_stmt 0 view .LVU70
+	movl	$31, %edx
+	vpbroadcastb	%edx, %xmm5
+.LBE296:
+.LBE295:
+.LBB299:
+.LBB300:
+	.loc 3 1335 34 view .LVU71
+	movl	$34, %edx
+	vpbroadcastb	%edx, %xmm4
+.LBE300:
+.LBE299:
+.LBB302:
+.LBB303:
+	movl	$92, %edx
+.LBE303:
+.LBE302:
+.LBE294:
+	.loc 1 164 10 view .LVU72
+	xorl	%eax, %eax
+.LBB327:
+.LBB306:
+.LBB304:
+	.loc 3 1335 34 view .LVU73
+	vpbroadcastb	%edx, %xmm3
+.LBE304:
+.LBE306:
+.LBE327:
+	.loc 1 165 3 view .LVU74
+	jmp	.L37
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L39:
+.LBB328:
+	.loc 1 166 5 is_stmt 1 view .LVU75
+.LBB307:
+.LBI307:
+	.loc 3 701 1 view .LVU76
+.LBB308:
+	.loc 3 703 3 view .LVU77
+	.loc 3 703 3 is_stmt 0 view .LVU78
+.LBE308:
+.LBE307:
+	.loc 1 168 5 is_stmt 1 view .LVU79
+.LBB310:
+.LBI295:
+	.loc 3 1425 1 view .LVU80
+.LBB297:
+	.loc 3 1427 3 view .LVU81
+.LBE297:
+.LBE310:
+.LBB311:
+.LBB309:
+	.loc 3 703 10 is_stmt 0 view .LVU82
+	vmovdqu	-16(%rdi,%rax), %xmm0
+.LBE309:
+.LBE311:
+.LBB312:
+.LBB298:
+	.loc 3 1427 19 view .LVU83
+	vpminub	%xmm0, %xmm5, %xmm1
+.LVL29:
+	.loc 3 1427 19 view .LVU84
+.LBE298:
+.LBE312:
+.LBB313:
+.LBI313:
+	.loc 3 1333 1 is_stmt 1 view .LVU85
+.LBB314:
+	.loc 3 1335 3 view .LVU86
+	.loc 3 1335 34 is_stmt 0 view .LVU87
+	vpcmpeqb	%xmm1, %xmm0, %xmm1
+.LVL30:
+	.loc 3 1335 34 view .LVU88
+.LBE314:
+.LBE313:
+	.loc 1 169 5 is_stmt 1 view .LVU89
+.LBB315:
+.LBI299:
+	.loc 3 1333 1 view .LVU90
+.LBB301:
+	.loc 3 1335 3 view .LVU91
+	.loc 3 1335 34 is_stmt 0 view .LVU92
+	vpcmpeqb	%xmm4, %xmm0, %xmm2
+.LVL31:
+	.loc 3 1335 34 view .LVU93
+.LBE301:
+.LBE315:
+.LBB316:
+.LBI316:
+	.loc 3 1321 1 is_stmt 1 view .LVU94
+.LBB317:
+	.loc 3 1323 3 view .LVU95
+	.loc 3 1323 3 is_stmt 0 view .LVU96
+.LBE317:
+.LBE316:
+	.loc 1 170 5 is_stmt 1 view .LVU97
+.LBB318:
+.LBI302:
+	.loc 3 1333 1 view .LVU98
+.LBB305:
+	.loc 3 1335 3 view .LVU99
+	.loc 3 1335 34 is_stmt 0 view .LVU100
+	vpcmpeqb	%xmm3, %xmm0, %xmm0
+.LVL32:
+	.loc 3 1335 34 view .LVU101
+.LBE305:
+.LBE318:
+.LBB319:
+.LBI319:
+	.loc 3 1321 1 is_stmt 1 view .LVU102
+.LBB320:
+	.loc 3 1323 3 view .LVU103
+	.loc 3 1323 3 is_stmt 0 view .LVU104
+.LBE320:
+.LBE319:
+	.loc 1 171 5 is_stmt 1 view .LVU105
+.LBB322:
+.LBI322:
+	.loc 3 1431 1 view .LVU106
+.LBB323:
+	.loc 3 1433 3 view .LVU107
+.LBE323:
+.LBE322:
+.LBB325:
+.LBB321:
+	.loc 3 1323 33 is_stmt 0 view .LVU108
+	vpternlogq	$254, %xmm0, %xmm2, %xmm1
+.LVL33:
+	.loc 3 1323 33 view .LVU109
+.LBE321:
+.LBE325:
+.LBB326:
+.LBB324:
+	.loc 3 1433 10 view .LVU110
+	vpmovmskb	%xmm1, %ecx
+.LVL34:
+	.loc 3 1433 10 view .LVU111
+.LBE324:
+.LBE326:
+	.loc 1 172 5 is_stmt 1 view .LVU112
+	.loc 1 172 8 is_stmt 0 view .LVU113
+	testl	%ecx, %ecx
+	jne	.L47
+.LVL35:
+.L37:
+	.loc 1 172 8 view .LVU114
+.LBE328:
+	.loc 1 165 21 is_stmt 1 discriminator 1 view .LVU115
+	movq	%rax, %rdx
+	.loc 1 165 16 is_stmt 0 discriminator 1 view .LVU116
+	leaq	16(%rax), %rax
+.LVL36:
+	.loc 1 165 21 discriminator 1 view .LVU117
+	cmpq	%rax, %rsi
+	jnb	.L39
+	.loc 1 176 3 is_stmt 1 view .LVU118
+.LVL37:
+.LBB329:
+.LBI329:
+	.loc 1 81 15 view .LVU119
+.LBB330:
+	.loc 1 82 3 view .LVU120
+	.loc 1 83 3 view .LVU121
+	.loc 1 83 25 view .LVU122
+	subq	%rdx, %rsi
+.LVL38:
+	.loc 1 83 25 is_stmt 0 view .LVU123
+	je	.L36
+	movq	st_char_classes@GOTPCREL(%rip), %r8
+	.loc 1 82 10 view .LVU124
+	xorl	%eax, %eax
+	addq	%rdx, %rdi
+.LVL39:
+	.loc 1 82 10 view .LVU125
+	jmp	.L40
+.LVL40:
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	.loc 1 84 5 is_stmt 1 view .LVU126
+	.loc 1 84 10 is_stmt 0 view .LVU127
+	incq	%rax
+.LVL41:
+	.loc 1 83 25 is_stmt 1 view .LVU128
+	cmpq	%rax, %rsi
+	je	.L48
+.LVL42:
+.L40:
+.LBB331:
+.LBI331:
+	.loc 2 202 19 view .LVU129
+.LBB332:
+	.loc 2 203 3 view .LVU130
+	.loc 2 203 26 is_stmt 0 view .LVU131
+	movzbl	(%rdi,%rax), %ecx
+.LBE332:
+.LBE331:
+	.loc 1 83 25 view .LVU132
+	testb	$32, (%r8,%rcx)
+	je	.L42
+	addq	%rax, %rdx
+.LVL43:
+	.loc 1 86 3 is_stmt 1 view .LVU133
+.L36:
+	.loc 1 86 3 is_stmt 0 view .LVU134
+.LBE330:
+.LBE329:
+	.loc 1 177 1 view .LVU135
+	movq	%rdx, %rax
+	ret
+.LVL44:
+	.p2align 4,,10
+	.p2align 3
+.L47:
+.LBB333:
+	.loc 1 173 7 is_stmt 1 view .LVU136
+	.loc 1 173 22 is_stmt 0 view .LVU137
+	tzcntl	%ecx, %ecx
+.LVL45:
+	.loc 1 173 20 view .LVU138
+	addq	%rcx, %rdx
+.LVL46:
+	.loc 1 173 20 view .LVU139
+.LBE333:
+	.loc 1 177 1 view .LVU140
+	movq	%rdx, %rax
+.LVL47:
+	.loc 1 177 1 view .LVU141
+	ret
+.LVL48:
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	.loc 1 176 16 view .LVU142
+	addq	%rsi, %rdx
+.LVL49:
+	.loc 1 177 1 view .LVU143
+	movq	%rdx, %rax
+.LVL50:
+	.loc 1 177 1 view .LVU144
+	ret
+	.cfi_endproc
+.LFE6414:
+	.size	st_scan_escape_sse2, .-st_scan_escape_sse2
+	.p2align 4
+	.type	st_scan_nul_sse2, @function
+st_scan_nul_sse2:
+.LVL51:
+.LFB6413:
+	.loc 1 143 73 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 144 3 view .LVU146
+	.loc 1 145 3 view .LVU147
+	.loc 1 146 3 view .LVU148
+	.loc 1 145 10 is_stmt 0 view .LVU149
+	xorl	%eax, %eax
+.LBB343:
+.LBB344:
+.LBB345:
+	.loc 3 1335 34 view .LVU150
+	vpxor	%xmm1, %xmm1, %xmm1
+.LBE345:
+.LBE344:
+.LBE343:
+	.loc 1 146 3 view .LVU151
+	jmp	.L50
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L52:
+.LBB352:
+	.loc 1 147 5 is_stmt 1 view .LVU152
+.LBB347:
+.LBI347:
+	.loc 3 701 1 view .LVU153
+.LBB348:
+	.loc 3 703 3 view .LVU154
+	.loc 3 703 3 is_stmt 0 view .LVU155
+.LBE348:
+.LBE347:
+	.loc 1 148 5 is_stmt 1 view .LVU156
+.LBB349:
+.LBI344:
+	.loc 3 1333 1 view .LVU157
+.LBB346:
+	.loc 3 1335 3 view .LVU158
+	.loc 3 1335 34 is_stmt 0 view .LVU159
+	vpcmpeqb	-16(%rdi,%rax), %xmm1, %xmm0
+.LVL53:
+	.loc 3 1335 34 view .LVU160
+.LBE346:
+.LBE349:
+.LBB350:
+.LBI350:
+	.loc 3 1431 1 is_stmt 1 view .LVU161
+.LBB351:
+	.loc 3 1433 3 view .LVU162
+	.loc 3 1433 10 is_stmt 0 view .LVU163
+	vpmovmskb	%xmm0, %ecx
+.LVL54:
+	.loc 3 1433 10 view .LVU164
+.LBE351:
+.LBE350:
+	.loc 1 149 5 is_stmt 1 view .LVU165
+	.loc 1 149 8 is_stmt 0 view .LVU166
+	testl	%ecx, %ecx
+	jne	.L61
+.LVL55:
+.L50:
+	.loc 1 149 8 view .LVU167
+.LBE352:
+	.loc 1 146 21 is_stmt 1 discriminator 1 view .LVU168
+	movq	%rax, %rdx
+	.loc 1 146 16 is_stmt 0 discriminator 1 view .LVU169
+	leaq	16(%rax), %rax
+.LVL56:
+	.loc 1 146 21 discriminator 1 view .LVU170
+	cmpq	%rax, %rsi
+	jnb	.L52
+	.loc 1 153 3 is_stmt 1 view .LVU171
+.LVL57:
+.LBB353:
+.LBI353:
+	.loc 1 70 15 view .LVU172
+.LBB354:
+	.loc 1 71 3 view .LVU173
+	.loc 1 72 3 view .LVU174
+	.loc 1 72 25 view .LVU175
+	.loc 1 71 10 is_stmt 0 view .LVU176
+	xorl	%eax, %eax
+	leaq	(%rdi,%rdx), %rcx
+.LVL58:
+	.loc 1 72 25 view .LVU177
+	subq	%rdx, %rsi
+.LVL59:
+	.loc 1 72 25 view .LVU178
+	jne	.L53
+.LBE354:
+.LBE353:
+	.loc 1 154 1 view .LVU179
+	movq	%rdx, %rax
+	ret
+.LVL60:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+.LBB356:
+.LBB355:
+	.loc 1 73 5 is_stmt 1 view .LVU180
+	.loc 1 73 10 is_stmt 0 view .LVU181
+	incq	%rax
+.LVL61:
+	.loc 1 72 25 is_stmt 1 view .LVU182
+	cmpq	%rax, %rsi
+	je	.L62
+.LVL62:
+.L53:
+	.loc 1 72 25 is_stmt 0 view .LVU183
+	cmpb	$0, (%rcx,%rax)
+	jne	.L55
+	addq	%rax, %rdx
+.LVL63:
+	.loc 1 75 3 is_stmt 1 view .LVU184
+	.loc 1 75 3 is_stmt 0 view .LVU185
+.LBE355:
+.LBE356:
+	.loc 1 154 1 view .LVU186
+	movq	%rdx, %rax
+	ret
+.LVL64:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+.LBB357:
+	.loc 1 150 7 is_stmt 1 view .LVU187
+	.loc 1 150 22 is_stmt 0 view .LVU188
+	tzcntl	%ecx, %ecx
+.LVL65:
+	.loc 1 150 20 view .LVU189
+	addq	%rcx, %rdx
+.LVL66:
+	.loc 1 150 20 view .LVU190
+.LBE357:
+	.loc 1 154 1 view .LVU191
+	movq	%rdx, %rax
+.LVL67:
+	.loc 1 154 1 view .LVU192
+	ret
+.LVL68:
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	.loc 1 153 16 view .LVU193
+	addq	%rsi, %rdx
+.LVL69:
+	.loc 1 154 1 view .LVU194
+	movq	%rdx, %rax
+.LVL70:
+	.loc 1 154 1 view .LVU195
+	ret
+	.cfi_endproc
+.LFE6413:
+	.size	st_scan_nul_sse2, .-st_scan_nul_sse2
+	.p2align 4
+	.type	st_scan_delimiter_sse2, @function
+st_scan_delimiter_sse2:
+.LVL71:
+.LFB6411:
+	.loc 1 105 97 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 106 3 view .LVU197
+.LBB374:
+.LBI374:
+	.loc 3 654 1 view .LVU198
+	.loc 3 656 3 view .LVU199
+.LBB375:
+.LBI375:
+	.loc 3 616 1 view .LVU200
+.LBB376:
+	.loc 3 621 3 view .LVU201
+.LBE376:
+.LBE375:
+.LBE374:
+	.loc 1 105 97 is_stmt 0 view .LVU202
+	movl	%edx, %r8d
+.LBB379:
+.LBB378:
+.LBB377:
+	.loc 3 621 42 view .LVU203
+	vpbroadcastb	%edx, %xmm2
+.LVL72:
+	.loc 3 621 42 view .LVU204
+.LBE377:
+.LBE378:
+.LBE379:
+	.loc 1 107 3 is_stmt 1 view .LVU205
+	.loc 1 108 3 view .LVU206
+	.loc 1 109 3 view .LVU207
+	.loc 1 108 10 is_stmt 0 view .LVU208
+	xorl	%eax, %eax
+.LBB380:
+.LBB381:
+.LBB382:
+	.loc 3 1335 34 view .LVU209
+	vpxor	%xmm3, %xmm3, %xmm3
+.LBE382:
+.LBE381:
+.LBE380:
+	.loc 1 109 3 view .LVU210
+	jmp	.L64
+.LVL73:
+	.p2align 4,,10
+	.p2align 3
+.L66:
+.LBB401:
+	.loc 1 110 5 is_stmt 1 view .LVU211
+.LBB385:
+.LBI385:
+	.loc 3 701 1 view .LVU212
+.LBB386:
+	.loc 3 703 3 view .LVU213
+	.loc 3 703 3 is_stmt 0 view .LVU214
+.LBE386:
+.LBE385:
+	.loc 1 111 5 is_stmt 1 view .LVU215
+.LBB388:
+.LBI381:
+	.loc 3 1333 1 view .LVU216
+.LBB383:
+	.loc 3 1335 3 view .LVU217
+.LBE383:
+.LBE388:
+.LBB389:
+.LBB387:
+	.loc 3 703 10 is_stmt 0 view .LVU218
+	vmovdqu	-16(%rdi,%rax), %xmm0
+.LBE387:
+.LBE389:
+.LBB390:
+.LBB384:
+	.loc 3 1335 34 view .LVU219
+	vpcmpeqb	%xmm3, %xmm0, %xmm1
+.LVL74:
+	.loc 3 1335 34 view .LVU220
+.LBE384:
+.LBE390:
+.LBB391:
+.LBI391:
+	.loc 3 1333 1 is_stmt 1 view .LVU221
+.LBB392:
+	.loc 3 1335 3 view .LVU222
+	.loc 3 1335 34 is_stmt 0 view .LVU223
+	vpcmpeqb	%xmm0, %xmm2, %xmm0
+.LVL75:
+	.loc 3 1335 34 view .LVU224
+.LBE392:
+.LBE391:
+.LBB393:
+.LBI393:
+	.loc 3 1321 1 is_stmt 1 view .LVU225
+.LBB394:
+	.loc 3 1323 3 view .LVU226
+	.loc 3 1323 3 is_stmt 0 view .LVU227
+.LBE394:
+.LBE393:
+	.loc 1 112 5 is_stmt 1 view .LVU228
+.LBB396:
+.LBI396:
+	.loc 3 1431 1 view .LVU229
+.LBB397:
+	.loc 3 1433 3 view .LVU230
+.LBE397:
+.LBE396:
+.LBB399:
+.LBB395:
+	.loc 3 1323 33 is_stmt 0 view .LVU231
+	vpor	%xmm0, %xmm1, %xmm0
+.LVL76:
+	.loc 3 1323 33 view .LVU232
+.LBE395:
+.LBE399:
+.LBB400:
+.LBB398:
+	.loc 3 1433 10 view .LVU233
+	vpmovmskb	%xmm0, %ecx
+.LVL77:
+	.loc 3 1433 10 view .LVU234
+.LBE398:
+.LBE400:
+	.loc 1 113 5 is_stmt 1 view .LVU235
+	.loc 1 113 8 is_stmt 0 view .LVU236
+	testl	%ecx, %ecx
+	jne	.L80
+.LVL78:
+.L64:
+	.loc 1 113 8 view .LVU237
+.LBE401:
+	.loc 1 109 21 is_stmt 1 discriminator 1 view .LVU238
+	movq	%rax, %rdx
+	.loc 1 109 16 is_stmt 0 discriminator 1 view .LVU239
+	leaq	16(%rax), %rax
+.LVL79:
+	.loc 1 109 21 discriminator 1 view .LVU240
+	cmpq	%rax, %rsi
+	jnb	.L66
+	.loc 1 117 3 is_stmt 1 view .LVU241
+.LVL80:
+.LBB402:
+.LBI402:
+	.loc 1 48 15 view .LVU242
+.LBB403:
+	.loc 1 49 3 view .LVU243
+	.loc 1 50 3 view .LVU244
+	.loc 1 50 51 view .LVU245
+	.loc 1 49 10 is_stmt 0 view .LVU246
+	xorl	%eax, %eax
+	addq	%rdx, %rdi
+.LVL81:
+	.loc 1 50 51 view .LVU247
+	subq	%rdx, %rsi
+.LVL82:
+	.loc 1 50 51 view .LVU248
+	jne	.L67
+.LBE403:
+.LBE402:
+	.loc 1 118 1 view .LVU249
+	movq	%rdx, %rax
+	ret
+.LVL83:
+	.p2align 4,,10
+	.p2align 3
+.L82:
+.LBB405:
+.LBB404:
+	.loc 1 50 51 view .LVU250
+	testb	%cl, %cl
+	je	.L72
+	.loc 1 51 5 is_stmt 1 view .LVU251
+	.loc 1 51 10 is_stmt 0 view .LVU252
+	incq	%rax
+.LVL84:
+	.loc 1 50 51 is_stmt 1 view .LVU253
+	cmpq	%rax, %rsi
+	je	.L81
+.LVL85:
+.L67:
+	.loc 1 50 34 is_stmt 0 view .LVU254
+	movzbl	(%rdi,%rax), %ecx
+	.loc 1 50 51 view .LVU255
+	cmpb	%cl, %r8b
+	jne	.L82
+.L72:
+	addq	%rax, %rdx
+.LVL86:
+	.loc 1 53 3 is_stmt 1 view .LVU256
+	.loc 1 53 3 is_stmt 0 view .LVU257
+.LBE404:
+.LBE405:
+	.loc 1 118 1 view .LVU258
+	movq	%rdx, %rax
+	ret
+.LVL87:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+.LBB406:
+	.loc 1 114 7 is_stmt 1 view .LVU259
+	.loc 1 114 22 is_stmt 0 view .LVU260
+	tzcntl	%ecx, %ecx
+.LVL88:
+	.loc 1 114 20 view .LVU261
+	addq	%rcx, %rdx
+.LVL89:
+	.loc 1 114 20 view .LVU262
+.LBE406:
+	.loc 1 118 1 view .LVU263
+	movq	%rdx, %rax
+.LVL90:
+	.loc 1 118 1 view .LVU264
+	ret
+.LVL91:
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.loc 1 117 16 view .LVU265
+	addq	%rsi, %rdx
+.LVL92:
+	.loc 1 118 1 view .LVU266
+	movq	%rdx, %rax
+.LVL93:
+	.loc 1 118 1 view .LVU267
+	ret
+	.cfi_endproc
+.LFE6411:
+	.size	st_scan_delimiter_sse2, .-st_scan_delimiter_sse2
+	.p2align 4
+	.type	st_scan_non_whitespace_sse2, @function
+st_scan_non_whitespace_sse2:
+.LVL94:
+.LFB6412:
+	.loc 1 124 84 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 125 3 view .LVU269
+	.loc 1 126 3 view .LVU270
+	.loc 1 127 3 view .LVU271
+.LBB420:
+.LBB421:
+.LBB422:
+	.loc 3 1415 19 is_stmt 0 view .LVU272
+	movl	$33, %edx
+.LBE422:
+.LBE421:
+.LBE420:
+	.loc 1 126 10 view .LVU273
+	xorl	%eax, %eax
+.LBB437:
+.LBB426:
+.LBB423:
+	.loc 3 1415 19 view .LVU274
+	vpbroadcastb	%edx, %xmm2
+.LBE423:
+.LBE426:
+.LBE437:
+	.loc 1 127 3 view .LVU275
+	jmp	.L84
+.LVL95:
+	.p2align 4,,10
+	.p2align 3
+.L86:
+.LBB438:
+	.loc 1 128 5 is_stmt 1 view .LVU276
+.LBB427:
+.LBI427:
+	.loc 3 701 1 view .LVU277
+.LBB428:
+	.loc 3 703 3 view .LVU278
+	.loc 3 703 3 is_stmt 0 view .LVU279
+.LBE428:
+.LBE427:
+	.loc 1 130 5 is_stmt 1 view .LVU280
+.LBB430:
+.LBI421:
+	.loc 3 1413 1 view .LVU281
+.LBB424:
+	.loc 3 1415 3 view .LVU282
+.LBE424:
+.LBE430:
+.LBB431:
+.LBB429:
+	.loc 3 703 10 is_stmt 0 view .LVU283
+	vmovdqu	-16(%rdi,%rax), %xmm0
+.LBE429:
+.LBE431:
+.LBB432:
+.LBB425:
+	.loc 3 1415 19 view .LVU284
+	vpmaxub	%xmm0, %xmm2, %xmm1
+.LVL96:
+	.loc 3 1415 19 view .LVU285
+.LBE425:
+.LBE432:
+.LBB433:
+.LBI433:
+	.loc 3 1333 1 is_stmt 1 view .LVU286
+.LBB434:
+	.loc 3 1335 3 view .LVU287
+	.loc 3 1335 34 is_stmt 0 view .LVU288
+	vpcmpeqb	%xmm1, %xmm0, %xmm0
+.LVL97:
+	.loc 3 1335 34 view .LVU289
+.LBE434:
+.LBE433:
+	.loc 1 131 5 is_stmt 1 view .LVU290
+.LBB435:
+.LBI435:
+	.loc 3 1431 1 view .LVU291
+.LBB436:
+	.loc 3 1433 3 view .LVU292
+	.loc 3 1433 10 is_stmt 0 view .LVU293
+	vpmovmskb	%xmm0, %ecx
+.LVL98:
+	.loc 3 1433 10 view .LVU294
+.LBE436:
+.LBE435:
+	.loc 1 132 5 is_stmt 1 view .LVU295
+	.loc 1 132 8 is_stmt 0 view .LVU296
+	testl	%ecx, %ecx
+	jne	.L94
+.LVL99:
+.L84:
+	.loc 1 132 8 view .LVU297
+.LBE438:
+	.loc 1 127 21 is_stmt 1 discriminator 1 view .LVU298
+	movq	%rax, %rdx
+	.loc 1 127 16 is_stmt 0 discriminator 1 view .LVU299
+	leaq	16(%rax), %rax
+.LVL100:
+	.loc 1 127 21 discriminator 1 view .LVU300
+	cmpq	%rax, %rsi
+	jnb	.L86
+	.loc 1 136 3 is_stmt 1 view .LVU301
+.LVL101:
+.LBB439:
+.LBI439:
+	.loc 1 59 15 view .LVU302
+.LBB440:
+	.loc 1 60 3 view .LVU303
+	.loc 1 61 3 view .LVU304
+	.loc 1 61 25 view .LVU305
+	subq	%rdx, %rsi
+.LVL102:
+	.loc 1 61 25 is_stmt 0 view .LVU306
+	je	.L83
+	movq	st_char_classes@GOTPCREL(%rip), %r8
+	.loc 1 60 10 view .LVU307
+	xorl	%eax, %eax
+	addq	%rdx, %rdi
+.LVL103:
+	.loc 1 60 10 view .LVU308
+	jmp	.L87
+.LVL104:
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	.loc 1 62 5 is_stmt 1 view .LVU309
+	.loc 1 62 10 is_stmt 0 view .LVU310
+	incq	%rax
+.LVL105:
+	.loc 1 61 25 is_stmt 1 view .LVU311
+	cmpq	%rax, %rsi
+	je	.L95
+.LVL106:
+.L87:
+.LBB441:
+.LBI441:
+	.loc 2 202 19 view .LVU312
+.LBB442:
+	.loc 2 203 3 view .LVU313
+	.loc 2 203 26 is_stmt 0 view .LVU314
+	movzbl	(%rdi,%rax), %ecx
+.LBE442:
+.LBE441:
+	.loc 1 61 25 view .LVU315
+	testb	$1, (%r8,%rcx)
+	jne	.L89
+	addq	%rax, %rdx
+.LVL107:
+	.loc 1 64 3 is_stmt 1 view .LVU316
+.L83:
+	.loc 1 64 3 is_stmt 0 view .LVU317
+.LBE440:
+.LBE439:
+	.loc 1 137 1 view .LVU318
+	movq	%rdx, %rax
+	ret
+.LVL108:
+	.p2align 4,,10
+	.p2align 3
+.L94:
+.LBB443:
+	.loc 1 133 7 is_stmt 1 view .LVU319
+	.loc 1 133 22 is_stmt 0 view .LVU320
+	tzcntl	%ecx, %ecx
+.LVL109:
+	.loc 1 133 20 view .LVU321
+	addq	%rcx, %rdx
+.LVL110:
+	.loc 1 133 20 view .LVU322
+.LBE443:
+	.loc 1 137 1 view .LVU323
+	movq	%rdx, %rax
+.LVL111:
+	.loc 1 137 1 view .LVU324
+	ret
+.LVL112:
+	.p2align 4,,10
+	.p2align 3
+.L95:
+	.loc 1 136 16 view .LVU325
+	addq	%rsi, %rdx
+.LVL113:
+	.loc 1 137 1 view .LVU326
+	movq	%rdx, %rax
+.LVL114:
+	.loc 1 137 1 view .LVU327
+	ret
+	.cfi_endproc
+.LFE6412:
+	.size	st_scan_non_whitespace_sse2, .-st_scan_non_whitespace_sse2
+	.p2align 4
+	.type	st_scan_nul_avx2, @function
+st_scan_nul_avx2:
+.LVL115:
+.LFB6417:
+	.loc 1 230 73 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 231 3 view .LVU329
+	.loc 1 232 3 view .LVU330
+	.loc 1 233 3 view .LVU331
+	.loc 1 232 10 is_stmt 0 view .LVU332
+	xorl	%edx, %edx
+.LBB469:
+.LBB470:
+.LBB471:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h"
+	.loc 4 233 34 view .LVU333
+	vpxor	%xmm1, %xmm1, %xmm1
+.LBE471:
+.LBE470:
+.LBE469:
+	.loc 1 233 3 view .LVU334
+	jmp	.L97
+.LVL116:
+	.p2align 4,,10
+	.p2align 3
+.L99:
+.LBB478:
+	.loc 1 234 5 is_stmt 1 view .LVU335
+.LBB473:
+.LBI473:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h"
+	.loc 5 927 1 view .LVU336
+.LBB474:
+	.loc 5 929 3 view .LVU337
+	.loc 5 929 3 is_stmt 0 view .LVU338
+.LBE474:
+.LBE473:
+	.loc 1 235 5 is_stmt 1 view .LVU339
+.LBB475:
+.LBI470:
+	.loc 4 231 1 view .LVU340
+.LBB472:
+	.loc 4 233 3 view .LVU341
+	.loc 4 233 34 is_stmt 0 view .LVU342
+	vpcmpeqb	-32(%rdi,%rdx), %ymm1, %ymm0
+.LVL117:
+	.loc 4 233 34 view .LVU343
+.LBE472:
+.LBE475:
+.LBB476:
+.LBI476:
+	.loc 4 433 1 is_stmt 1 view .LVU344
+.LBB477:
+	.loc 4 435 3 view .LVU345
+	.loc 4 435 10 is_stmt 0 view .LVU346
+	vpmovmskb	%ymm0, %ecx
+.LVL118:
+	.loc 4 435 10 view .LVU347
+.LBE477:
+.LBE476:
+	.loc 1 236 5 is_stmt 1 view .LVU348
+	.loc 1 236 8 is_stmt 0 view .LVU349
+	testl	%ecx, %ecx
+	jne	.L113
+.LVL119:
+.L97:
+	.loc 1 236 8 view .LVU350
+.LBE478:
+	.loc 1 233 21 is_stmt 1 discriminator 1 view .LVU351
+	movq	%rdx, %rax
+	.loc 1 233 16 is_stmt 0 discriminator 1 view .LVU352
+	leaq	32(%rdx), %rdx
+.LVL120:
+	.loc 1 233 21 discriminator 1 view .LVU353
+	cmpq	%rdx, %rsi
+	jnb	.L99
+	.loc 1 240 3 is_stmt 1 view .LVU354
+	.loc 1 240 18 is_stmt 0 view .LVU355
+	subq	%rax, %rsi
+.LVL121:
+.LBB479:
+.LBI479:
+	.loc 1 143 15 is_stmt 1 view .LVU356
+.LBB480:
+	.loc 1 145 10 is_stmt 0 view .LVU357
+	xorl	%edx, %edx
+.LBB481:
+.LBB482:
+.LBB483:
+	.loc 3 703 10 view .LVU358
+	leaq	(%rdi,%rax), %r9
+.LVL122:
+	.loc 3 703 10 view .LVU359
+.LBE483:
+.LBE482:
+.LBB485:
+.LBB486:
+	.loc 3 1335 34 view .LVU360
+	vpxor	%xmm1, %xmm1, %xmm1
+	jmp	.L100
+.LVL123:
+	.p2align 4,,10
+	.p2align 3
+.L102:
+	.loc 3 1335 34 view .LVU361
+.LBE486:
+.LBE485:
+	.loc 1 147 5 is_stmt 1 view .LVU362
+.LBB488:
+.LBI482:
+	.loc 3 701 1 view .LVU363
+.LBB484:
+	.loc 3 703 3 view .LVU364
+	.loc 3 703 3 is_stmt 0 view .LVU365
+.LBE484:
+.LBE488:
+	.loc 1 148 5 is_stmt 1 view .LVU366
+.LBB489:
+.LBI485:
+	.loc 3 1333 1 view .LVU367
+.LBB487:
+	.loc 3 1335 3 view .LVU368
+	.loc 3 1335 34 is_stmt 0 view .LVU369
+	vpcmpeqb	-16(%rdx,%r9), %xmm1, %xmm0
+.LVL124:
+	.loc 3 1335 34 view .LVU370
+.LBE487:
+.LBE489:
+.LBB490:
+.LBI490:
+	.loc 3 1431 1 is_stmt 1 view .LVU371
+.LBB491:
+	.loc 3 1433 3 view .LVU372
+	.loc 3 1433 10 is_stmt 0 view .LVU373
+	vpmovmskb	%xmm0, %r8d
+.LVL125:
+	.loc 3 1433 10 view .LVU374
+.LBE491:
+.LBE490:
+	.loc 1 149 5 is_stmt 1 view .LVU375
+	.loc 1 149 8 is_stmt 0 view .LVU376
+	testl	%r8d, %r8d
+	jne	.L114
+.LVL126:
+.L100:
+	.loc 1 149 8 view .LVU377
+.LBE481:
+	.loc 1 146 21 is_stmt 1 view .LVU378
+	movq	%rdx, %rcx
+	.loc 1 146 16 is_stmt 0 view .LVU379
+	leaq	16(%rdx), %rdx
+.LVL127:
+	.loc 1 146 21 view .LVU380
+	cmpq	%rdx, %rsi
+	jnb	.L102
+	.loc 1 153 3 is_stmt 1 view .LVU381
+.LVL128:
+.LBB492:
+.LBI492:
+	.loc 1 70 15 view .LVU382
+.LBB493:
+	.loc 1 71 3 view .LVU383
+	.loc 1 72 3 view .LVU384
+	.loc 1 72 25 view .LVU385
+	leaq	(%rax,%rcx), %r8
+	.loc 1 71 10 is_stmt 0 view .LVU386
+	xorl	%edx, %edx
+	.loc 1 72 34 view .LVU387
+	addq	%r8, %rdi
+.LVL129:
+	.loc 1 72 25 view .LVU388
+	subq	%rcx, %rsi
+.LVL130:
+	.loc 1 72 25 view .LVU389
+	jne	.L103
+	jmp	.L101
+.LVL131:
+	.p2align 4,,10
+	.p2align 3
+.L105:
+	.loc 1 73 5 is_stmt 1 view .LVU390
+	.loc 1 73 10 is_stmt 0 view .LVU391
+	incq	%rdx
+.LVL132:
+	.loc 1 72 25 is_stmt 1 view .LVU392
+	cmpq	%rdx, %rsi
+	je	.L115
+.LVL133:
+.L103:
+	.loc 1 72 25 is_stmt 0 view .LVU393
+	cmpb	$0, (%rdi,%rdx)
+	jne	.L105
+	addq	%rdx, %rcx
+.LVL134:
+	.loc 1 75 3 is_stmt 1 view .LVU394
+.L101:
+	.loc 1 75 3 is_stmt 0 view .LVU395
+.LBE493:
+.LBE492:
+.LBE480:
+.LBE479:
+	.loc 1 240 16 view .LVU396
+	addq	%rcx, %rax
+.LVL135:
+	.loc 1 240 16 view .LVU397
+	vzeroupper
+.LVL136:
+	.loc 1 241 1 view .LVU398
+	ret
+.LVL137:
+	.p2align 4,,10
+	.p2align 3
+.L113:
+.LBB496:
+	.loc 1 237 7 is_stmt 1 view .LVU399
+	.loc 1 237 22 is_stmt 0 view .LVU400
+	tzcntl	%ecx, %ecx
+.LVL138:
+	.loc 1 237 20 view .LVU401
+	addq	%rcx, %rax
+.LVL139:
+	.loc 1 237 20 view .LVU402
+	vzeroupper
+.LVL140:
+	.loc 1 237 20 view .LVU403
+.LBE496:
+	.loc 1 241 1 view .LVU404
+	ret
+.LVL141:
+	.p2align 4,,10
+	.p2align 3
+.L114:
+.LBB497:
+.LBB495:
+.LBB494:
+	.loc 1 150 7 is_stmt 1 view .LVU405
+	.loc 1 150 22 is_stmt 0 view .LVU406
+	tzcntl	%r8d, %r8d
+.LVL142:
+	.loc 1 150 20 view .LVU407
+	addq	%r8, %rcx
+.LVL143:
+	.loc 1 150 20 view .LVU408
+	jmp	.L101
+.LVL144:
+	.p2align 4,,10
+	.p2align 3
+.L115:
+	.loc 1 150 20 view .LVU409
+.LBE494:
+	.loc 1 153 16 view .LVU410
+	addq	%rsi, %rcx
+.LVL145:
+	.loc 1 153 16 view .LVU411
+	jmp	.L101
+.LBE495:
+.LBE497:
+	.cfi_endproc
+.LFE6417:
+	.size	st_scan_nul_avx2, .-st_scan_nul_avx2
+	.p2align 4
+	.type	st_scan_delimiter_avx2, @function
+st_scan_delimiter_avx2:
+.LVL146:
+.LFB6415:
+	.loc 1 193 97 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 193 97 is_stmt 0 view .LVU413
+	movq	%rdi, %r8
+	.loc 1 194 3 is_stmt 1 view .LVU414
+.LVL147:
+.LBB544:
+.LBI544:
+	.loc 5 1340 1 view .LVU415
+	.loc 5 1342 3 view .LVU416
+.LBB545:
+.LBI545:
+	.loc 5 1285 1 view .LVU417
+.LBB546:
+	.loc 5 1294 3 view .LVU418
+.LBE546:
+.LBE545:
+.LBE544:
+	.loc 1 193 97 is_stmt 0 view .LVU419
+	movl	%edx, %r10d
+.LBB549:
+.LBB548:
+.LBB547:
+	.loc 5 1294 42 view .LVU420
+	vpbroadcastb	%edx, %ymm3
+.LVL148:
+	.loc 5 1294 42 view .LVU421
+.LBE547:
+.LBE548:
+.LBE549:
+	.loc 1 195 3 is_stmt 1 view .LVU422
+	.loc 1 196 3 view .LVU423
+	.loc 1 197 3 view .LVU424
+	.loc 1 196 10 is_stmt 0 view .LVU425
+	xorl	%ecx, %ecx
+.LBB550:
+.LBB551:
+.LBB552:
+	.loc 4 233 34 view .LVU426
+	vpxor	%xmm2, %xmm2, %xmm2
+.LBE552:
+.LBE551:
+.LBE550:
+	.loc 1 197 3 view .LVU427
+	jmp	.L117
+.LVL149:
+	.p2align 4,,10
+	.p2align 3
+.L119:
+.LBB571:
+	.loc 1 198 5 is_stmt 1 view .LVU428
+.LBB555:
+.LBI555:
+	.loc 5 927 1 view .LVU429
+.LBB556:
+	.loc 5 929 3 view .LVU430
+	.loc 5 929 3 is_stmt 0 view .LVU431
+.LBE556:
+.LBE555:
+	.loc 1 199 5 is_stmt 1 view .LVU432
+.LBB558:
+.LBI551:
+	.loc 4 231 1 view .LVU433
+.LBB553:
+	.loc 4 233 3 view .LVU434
+.LBE553:
+.LBE558:
+.LBB559:
+.LBB557:
+	.loc 5 929 10 is_stmt 0 view .LVU435
+	vmovdqu	-32(%r8,%rcx), %ymm0
+.LBE557:
+.LBE559:
+.LBB560:
+.LBB554:
+	.loc 4 233 34 view .LVU436
+	vpcmpeqb	%ymm2, %ymm0, %ymm1
+.LVL150:
+	.loc 4 233 34 view .LVU437
+.LBE554:
+.LBE560:
+.LBB561:
+.LBI561:
+	.loc 4 231 1 is_stmt 1 view .LVU438
+.LBB562:
+	.loc 4 233 3 view .LVU439
+	.loc 4 233 34 is_stmt 0 view .LVU440
+	vpcmpeqb	%ymm0, %ymm3, %ymm0
+.LVL151:
+	.loc 4 233 34 view .LVU441
+.LBE562:
+.LBE561:
+.LBB563:
+.LBI563:
+	.loc 4 574 1 is_stmt 1 view .LVU442
+.LBB564:
+	.loc 4 576 3 view .LVU443
+	.loc 4 576 3 is_stmt 0 view .LVU444
+.LBE564:
+.LBE563:
+	.loc 1 200 5 is_stmt 1 view .LVU445
+.LBB566:
+.LBI566:
+	.loc 4 433 1 view .LVU446
+.LBB567:
+	.loc 4 435 3 view .LVU447
+.LBE567:
+.LBE566:
+.LBB569:
+.LBB565:
+	.loc 4 576 33 is_stmt 0 view .LVU448
+	vpor	%ymm0, %ymm1, %ymm0
+.LVL152:
+	.loc 4 576 33 view .LVU449
+.LBE565:
+.LBE569:
+.LBB570:
+.LBB568:
+	.loc 4 435 10 view .LVU450
+	vpmovmskb	%ymm0, %edi
+.LVL153:
+	.loc 4 435 10 view .LVU451
+.LBE568:
+.LBE570:
+	.loc 1 201 5 is_stmt 1 view .LVU452
+	.loc 1 201 8 is_stmt 0 view .LVU453
+	testl	%edi, %edi
+	jne	.L138
+.LVL154:
+.L117:
+	.loc 1 201 8 view .LVU454
+.LBE571:
+	.loc 1 197 21 is_stmt 1 discriminator 1 view .LVU455
+	movq	%rcx, %rax
+	.loc 1 197 16 is_stmt 0 discriminator 1 view .LVU456
+	leaq	32(%rcx), %rcx
+.LVL155:
+	.loc 1 197 21 discriminator 1 view .LVU457
+	cmpq	%rcx, %rsi
+	jnb	.L119
+	.loc 1 205 3 is_stmt 1 view .LVU458
+.LBB572:
+.LBB573:
+.LBB574:
+.LBB575:
+.LBB576:
+	.loc 3 621 42 is_stmt 0 view .LVU459
+	vpbroadcastb	%edx, %xmm1
+.LBE576:
+.LBE575:
+.LBE574:
+.LBE573:
+.LBE572:
+	.loc 1 205 18 view .LVU460
+	subq	%rax, %rsi
+.LVL156:
+.LBB609:
+.LBI572:
+	.loc 1 105 15 is_stmt 1 view .LVU461
+.LBB607:
+	.loc 1 106 3 view .LVU462
+.LBB579:
+.LBI574:
+	.loc 3 654 1 view .LVU463
+	.loc 3 656 3 view .LVU464
+.LBB578:
+.LBI575:
+	.loc 3 616 1 view .LVU465
+.LBB577:
+	.loc 3 621 3 view .LVU466
+	.loc 3 621 3 is_stmt 0 view .LVU467
+.LBE577:
+.LBE578:
+.LBE579:
+	.loc 1 107 3 is_stmt 1 view .LVU468
+	.loc 1 108 3 view .LVU469
+	.loc 1 109 3 view .LVU470
+	.loc 1 108 10 is_stmt 0 view .LVU471
+	xorl	%edx, %edx
+.LVL157:
+.LBB580:
+.LBB581:
+.LBB582:
+	.loc 3 703 10 view .LVU472
+	leaq	(%r8,%rax), %r9
+.LVL158:
+	.loc 3 703 10 view .LVU473
+.LBE582:
+.LBE581:
+.LBB585:
+.LBB586:
+	.loc 3 1335 34 view .LVU474
+	vpxor	%xmm3, %xmm3, %xmm3
+.LVL159:
+	.loc 3 1335 34 view .LVU475
+.LBE586:
+.LBE585:
+.LBE580:
+	.loc 1 109 3 view .LVU476
+	jmp	.L120
+.LVL160:
+	.p2align 4,,10
+	.p2align 3
+.L122:
+.LBB603:
+	.loc 1 110 5 is_stmt 1 view .LVU477
+.LBB589:
+.LBI581:
+	.loc 3 701 1 view .LVU478
+.LBB583:
+	.loc 3 703 3 view .LVU479
+	.loc 3 703 3 is_stmt 0 view .LVU480
+.LBE583:
+.LBE589:
+	.loc 1 111 5 is_stmt 1 view .LVU481
+.LBB590:
+.LBI585:
+	.loc 3 1333 1 view .LVU482
+.LBB587:
+	.loc 3 1335 3 view .LVU483
+.LBE587:
+.LBE590:
+.LBB591:
+.LBB584:
+	.loc 3 703 10 is_stmt 0 view .LVU484
+	vmovdqu	-16(%r9,%rdx), %xmm0
+.LBE584:
+.LBE591:
+.LBB592:
+.LBB588:
+	.loc 3 1335 34 view .LVU485
+	vpcmpeqb	%xmm3, %xmm0, %xmm2
+.LVL161:
+	.loc 3 1335 34 view .LVU486
+.LBE588:
+.LBE592:
+.LBB593:
+.LBI593:
+	.loc 3 1333 1 is_stmt 1 view .LVU487
+.LBB594:
+	.loc 3 1335 3 view .LVU488
+	.loc 3 1335 34 is_stmt 0 view .LVU489
+	vpcmpeqb	%xmm0, %xmm1, %xmm0
+.LVL162:
+	.loc 3 1335 34 view .LVU490
+.LBE594:
+.LBE593:
+.LBB595:
+.LBI595:
+	.loc 3 1321 1 is_stmt 1 view .LVU491
+.LBB596:
+	.loc 3 1323 3 view .LVU492
+	.loc 3 1323 3 is_stmt 0 view .LVU493
+.LBE596:
+.LBE595:
+	.loc 1 112 5 is_stmt 1 view .LVU494
+.LBB598:
+.LBI598:
+	.loc 3 1431 1 view .LVU495
+.LBB599:
+	.loc 3 1433 3 view .LVU496
+.LBE599:
+.LBE598:
+.LBB601:
+.LBB597:
+	.loc 3 1323 33 is_stmt 0 view .LVU497
+	vpor	%xmm2, %xmm0, %xmm0
+.LVL163:
+	.loc 3 1323 33 view .LVU498
+.LBE597:
+.LBE601:
+.LBB602:
+.LBB600:
+	.loc 3 1433 10 view .LVU499
+	vpmovmskb	%xmm0, %edi
+.LVL164:
+	.loc 3 1433 10 view .LVU500
+.LBE600:
+.LBE602:
+	.loc 1 113 5 is_stmt 1 view .LVU501
+	.loc 1 113 8 is_stmt 0 view .LVU502
+	testl	%edi, %edi
+	jne	.L139
+.LVL165:
+.L120:
+	.loc 1 113 8 view .LVU503
+.LBE603:
+	.loc 1 109 21 is_stmt 1 view .LVU504
+	movq	%rdx, %rcx
+	.loc 1 109 16 is_stmt 0 view .LVU505
+	leaq	16(%rdx), %rdx
+.LVL166:
+	.loc 1 109 21 view .LVU506
+	cmpq	%rdx, %rsi
+	jnb	.L122
+	.loc 1 117 3 is_stmt 1 view .LVU507
+.LVL167:
+.LBB604:
+.LBI604:
+	.loc 1 48 15 view .LVU508
+.LBB605:
+	.loc 1 49 3 view .LVU509
+	.loc 1 50 3 view .LVU510
+	.loc 1 50 51 view .LVU511
+	leaq	(%rax,%rcx), %rdi
+	.loc 1 49 10 is_stmt 0 view .LVU512
+	xorl	%edx, %edx
+	.loc 1 50 34 view .LVU513
+	addq	%rdi, %r8
+.LVL168:
+	.loc 1 50 51 view .LVU514
+	subq	%rcx, %rsi
+.LVL169:
+	.loc 1 50 51 view .LVU515
+	jne	.L123
+	jmp	.L121
+.LVL170:
+	.p2align 4,,10
+	.p2align 3
+.L141:
+	.loc 1 50 51 view .LVU516
+	cmpb	%dil, %r10b
+	je	.L128
+	.loc 1 51 5 is_stmt 1 view .LVU517
+	.loc 1 51 10 is_stmt 0 view .LVU518
+	incq	%rdx
+.LVL171:
+	.loc 1 50 51 is_stmt 1 view .LVU519
+	cmpq	%rdx, %rsi
+	je	.L140
+.LVL172:
+.L123:
+	.loc 1 50 34 is_stmt 0 view .LVU520
+	movzbl	(%r8,%rdx), %edi
+	.loc 1 50 51 view .LVU521
+	testb	%dil, %dil
+	jne	.L141
+.L128:
+	addq	%rdx, %rcx
+.LVL173:
+	.loc 1 53 3 is_stmt 1 view .LVU522
+.L121:
+	.loc 1 53 3 is_stmt 0 view .LVU523
+.LBE605:
+.LBE604:
+.LBE607:
+.LBE609:
+	.loc 1 205 16 view .LVU524
+	addq	%rcx, %rax
+.LVL174:
+	.loc 1 205 16 view .LVU525
+	vzeroupper
+.LVL175:
+	.loc 1 206 1 view .LVU526
+	ret
+.LVL176:
+	.p2align 4,,10
+	.p2align 3
+.L138:
+.LBB610:
+	.loc 1 202 7 is_stmt 1 view .LVU527
+	.loc 1 202 22 is_stmt 0 view .LVU528
+	tzcntl	%edi, %edi
+.LVL177:
+	.loc 1 202 20 view .LVU529
+	addq	%rdi, %rax
+.LVL178:
+	.loc 1 202 20 view .LVU530
+	vzeroupper
+.LVL179:
+	.loc 1 202 20 view .LVU531
+.LBE610:
+	.loc 1 206 1 view .LVU532
+	ret
+.LVL180:
+	.p2align 4,,10
+	.p2align 3
+.L139:
+.LBB611:
+.LBB608:
+.LBB606:
+	.loc 1 114 7 is_stmt 1 view .LVU533
+	.loc 1 114 22 is_stmt 0 view .LVU534
+	tzcntl	%edi, %edi
+.LVL181:
+	.loc 1 114 20 view .LVU535
+	addq	%rdi, %rcx
+.LVL182:
+	.loc 1 114 20 view .LVU536
+	jmp	.L121
+.LVL183:
+.L140:
+	.loc 1 114 20 view .LVU537
+.LBE606:
+	.loc 1 117 16 view .LVU538
+	addq	%rsi, %rcx
+.LVL184:
+	.loc 1 117 16 view .LVU539
+	jmp	.L121
+.LBE608:
+.LBE611:
+	.cfi_endproc
+.LFE6415:
+	.size	st_scan_delimiter_avx2, .-st_scan_delimiter_avx2
+	.p2align 4
+	.type	st_scan_non_whitespace_avx2, @function
+st_scan_non_whitespace_avx2:
+.LVL185:
+.LFB6416:
+	.loc 1 212 84 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 213 3 view .LVU541
+	.loc 1 214 3 view .LVU542
+	.loc 1 215 3 view .LVU543
+.LBB645:
+.LBB646:
+.LBB647:
+	.loc 4 372 19 is_stmt 0 view .LVU544
+	movl	$33, %eax
+.LBE647:
+.LBE646:
+.LBE645:
+	.loc 1 214 10 view .LVU545
+	xorl	%edx, %edx
+.LBB662:
+.LBB651:
+.LBB648:
+	.loc 4 372 19 view .LVU546
+	vpbroadcastb	%eax, %ymm2
+.LBE648:
+.LBE651:
+.LBE662:
+	.loc 1 215 3 view .LVU547
+	jmp	.L143
+.LVL186:
+	.p2align 4,,10
+	.p2align 3
+.L145:
+.LBB663:
+	.loc 1 216 5 is_stmt 1 view .LVU548
+.LBB652:
+.LBI652:
+	.loc 5 927 1 view .LVU549
+.LBB653:
+	.loc 5 929 3 view .LVU550
+	.loc 5 929 3 is_stmt 0 view .LVU551
+.LBE653:
+.LBE652:
+	.loc 1 217 5 is_stmt 1 view .LVU552
+.LBB655:
+.LBI646:
+	.loc 4 370 1 view .LVU553
+.LBB649:
+	.loc 4 372 3 view .LVU554
+.LBE649:
+.LBE655:
+.LBB656:
+.LBB654:
+	.loc 5 929 10 is_stmt 0 view .LVU555
+	vmovdqu	-32(%rdi,%rdx), %ymm0
+.LBE654:
+.LBE656:
+.LBB657:
+.LBB650:
+	.loc 4 372 19 view .LVU556
+	vpmaxub	%ymm0, %ymm2, %ymm1
+.LVL187:
+	.loc 4 372 19 view .LVU557
+.LBE650:
+.LBE657:
+.LBB658:
+.LBI658:
+	.loc 4 231 1 is_stmt 1 view .LVU558
+.LBB659:
+	.loc 4 233 3 view .LVU559
+	.loc 4 233 34 is_stmt 0 view .LVU560
+	vpcmpeqb	%ymm1, %ymm0, %ymm0
+.LVL188:
+	.loc 4 233 34 view .LVU561
+.LBE659:
+.LBE658:
+	.loc 1 218 5 is_stmt 1 view .LVU562
+.LBB660:
+.LBI660:
+	.loc 4 433 1 view .LVU563
+.LBB661:
+	.loc 4 435 3 view .LVU564
+	.loc 4 435 10 is_stmt 0 view .LVU565
+	vpmovmskb	%ymm0, %ecx
+.LVL189:
+	.loc 4 435 10 view .LVU566
+.LBE661:
+.LBE660:
+	.loc 1 219 5 is_stmt 1 view .LVU567
+	.loc 1 219 8 is_stmt 0 view .LVU568
+	testl	%ecx, %ecx
+	jne	.L158
+.LVL190:
+.L143:
+	.loc 1 219 8 view .LVU569
+.LBE663:
+	.loc 1 215 21 is_stmt 1 discriminator 1 view .LVU570
+	movq	%rdx, %rax
+	.loc 1 215 16 is_stmt 0 discriminator 1 view .LVU571
+	leaq	32(%rdx), %rdx
+.LVL191:
+	.loc 1 215 21 discriminator 1 view .LVU572
+	cmpq	%rdx, %rsi
+	jnb	.L145
+	.loc 1 223 3 is_stmt 1 view .LVU573
+.LBB664:
+.LBB665:
+.LBB666:
+.LBB667:
+.LBB668:
+	.loc 3 1415 19 is_stmt 0 view .LVU574
+	movl	$33, %ecx
+.LBE668:
+.LBE667:
+.LBE666:
+.LBE665:
+.LBE664:
+	.loc 1 223 18 view .LVU575
+	subq	%rax, %rsi
+.LVL192:
+.LBB693:
+.LBI664:
+	.loc 1 124 15 is_stmt 1 view .LVU576
+.LBB691:
+	.loc 1 126 10 is_stmt 0 view .LVU577
+	xorl	%edx, %edx
+.LBB685:
+.LBB672:
+.LBB673:
+	.loc 3 703 10 view .LVU578
+	leaq	(%rdi,%rax), %r9
+.LBE673:
+.LBE672:
+.LBB676:
+.LBB669:
+	.loc 3 1415 19 view .LVU579
+	vpbroadcastb	%ecx, %xmm2
+	jmp	.L146
+.LVL193:
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	.loc 3 1415 19 view .LVU580
+.LBE669:
+.LBE676:
+	.loc 1 128 5 is_stmt 1 view .LVU581
+.LBB677:
+.LBI672:
+	.loc 3 701 1 view .LVU582
+.LBB674:
+	.loc 3 703 3 view .LVU583
+	.loc 3 703 3 is_stmt 0 view .LVU584
+.LBE674:
+.LBE677:
+	.loc 1 130 5 is_stmt 1 view .LVU585
+.LBB678:
+.LBI667:
+	.loc 3 1413 1 view .LVU586
+.LBB670:
+	.loc 3 1415 3 view .LVU587
+.LBE670:
+.LBE678:
+.LBB679:
+.LBB675:
+	.loc 3 703 10 is_stmt 0 view .LVU588
+	vmovdqu	-16(%r9,%rdx), %xmm0
+.LBE675:
+.LBE679:
+.LBB680:
+.LBB671:
+	.loc 3 1415 19 view .LVU589
+	vpmaxub	%xmm0, %xmm2, %xmm1
+.LVL194:
+	.loc 3 1415 19 view .LVU590
+.LBE671:
+.LBE680:
+.LBB681:
+.LBI681:
+	.loc 3 1333 1 is_stmt 1 view .LVU591
+.LBB682:
+	.loc 3 1335 3 view .LVU592
+	.loc 3 1335 34 is_stmt 0 view .LVU593
+	vpcmpeqb	%xmm1, %xmm0, %xmm0
+.LVL195:
+	.loc 3 1335 34 view .LVU594
+.LBE682:
+.LBE681:
+	.loc 1 131 5 is_stmt 1 view .LVU595
+.LBB683:
+.LBI683:
+	.loc 3 1431 1 view .LVU596
+.LBB684:
+	.loc 3 1433 3 view .LVU597
+	.loc 3 1433 10 is_stmt 0 view .LVU598
+	vpmovmskb	%xmm0, %r8d
+.LVL196:
+	.loc 3 1433 10 view .LVU599
+.LBE684:
+.LBE683:
+	.loc 1 132 5 is_stmt 1 view .LVU600
+	.loc 1 132 8 is_stmt 0 view .LVU601
+	testl	%r8d, %r8d
+	jne	.L159
+.LVL197:
+.L146:
+	.loc 1 132 8 view .LVU602
+.LBE685:
+	.loc 1 127 21 is_stmt 1 view .LVU603
+	movq	%rdx, %rcx
+	.loc 1 127 16 is_stmt 0 view .LVU604
+	leaq	16(%rdx), %rdx
+.LVL198:
+	.loc 1 127 21 view .LVU605
+	cmpq	%rdx, %rsi
+	jnb	.L148
+	.loc 1 136 3 is_stmt 1 view .LVU606
+.LVL199:
+.LBB686:
+.LBI686:
+	.loc 1 59 15 view .LVU607
+.LBB687:
+	.loc 1 60 3 view .LVU608
+	.loc 1 61 3 view .LVU609
+	.loc 1 61 25 view .LVU610
+	subq	%rcx, %rsi
+.LVL200:
+	.loc 1 61 25 is_stmt 0 view .LVU611
+	je	.L147
+	leaq	(%rax,%rcx), %r8
+	movq	st_char_classes@GOTPCREL(%rip), %r9
+	.loc 1 60 10 view .LVU612
+	xorl	%edx, %edx
+	.loc 1 61 45 view .LVU613
+	addq	%r8, %rdi
+.LVL201:
+	.loc 1 61 45 view .LVU614
+	jmp	.L149
+.LVL202:
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	.loc 1 62 5 is_stmt 1 view .LVU615
+	.loc 1 62 10 is_stmt 0 view .LVU616
+	incq	%rdx
+.LVL203:
+	.loc 1 61 25 is_stmt 1 view .LVU617
+	cmpq	%rdx, %rsi
+	je	.L160
+.LVL204:
+.L149:
+.LBB688:
+.LBI688:
+	.loc 2 202 19 view .LVU618
+.LBB689:
+	.loc 2 203 3 view .LVU619
+	.loc 2 203 26 is_stmt 0 view .LVU620
+	movzbl	(%rdi,%rdx), %r8d
+.LBE689:
+.LBE688:
+	.loc 1 61 25 view .LVU621
+	testb	$1, (%r9,%r8)
+	jne	.L151
+	addq	%rdx, %rcx
+.LVL205:
+	.loc 1 64 3 is_stmt 1 view .LVU622
+.L147:
+	.loc 1 64 3 is_stmt 0 view .LVU623
+.LBE687:
+.LBE686:
+.LBE691:
+.LBE693:
+	.loc 1 223 16 view .LVU624
+	addq	%rcx, %rax
+.LVL206:
+	.loc 1 223 16 view .LVU625
+	vzeroupper
+.LVL207:
+	.loc 1 224 1 view .LVU626
+	ret
+.LVL208:
+	.p2align 4,,10
+	.p2align 3
+.L158:
+.LBB694:
+	.loc 1 220 7 is_stmt 1 view .LVU627
+	.loc 1 220 22 is_stmt 0 view .LVU628
+	tzcntl	%ecx, %ecx
+.LVL209:
+	.loc 1 220 20 view .LVU629
+	addq	%rcx, %rax
+.LVL210:
+	.loc 1 220 20 view .LVU630
+	vzeroupper
+.LVL211:
+	.loc 1 220 20 view .LVU631
+.LBE694:
+	.loc 1 224 1 view .LVU632
+	ret
+.LVL212:
+	.p2align 4,,10
+	.p2align 3
+.L159:
+.LBB695:
+.LBB692:
+.LBB690:
+	.loc 1 133 7 is_stmt 1 view .LVU633
+	.loc 1 133 22 is_stmt 0 view .LVU634
+	tzcntl	%r8d, %r8d
+.LVL213:
+	.loc 1 133 20 view .LVU635
+	addq	%r8, %rcx
+.LVL214:
+	.loc 1 133 20 view .LVU636
+	jmp	.L147
+.LVL215:
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	.loc 1 133 20 view .LVU637
+.LBE690:
+	.loc 1 136 16 view .LVU638
+	addq	%rsi, %rcx
+.LVL216:
+	.loc 1 136 16 view .LVU639
+	jmp	.L147
+.LBE692:
+.LBE695:
+	.cfi_endproc
+.LFE6416:
+	.size	st_scan_non_whitespace_avx2, .-st_scan_non_whitespace_avx2
+	.p2align 4
+	.type	st_scan_nul_avx512, @function
+st_scan_nul_avx512:
+.LVL217:
+.LFB6421:
+	.loc 1 314 75 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 315 3 view .LVU641
+	.loc 1 316 3 view .LVU642
+	.loc 1 317 3 view .LVU643
+	.loc 1 314 75 is_stmt 0 view .LVU644
+	movq	%rdi, %rcx
+	.loc 1 316 10 view .LVU645
+	xorl	%edx, %edx
+	.loc 1 317 3 view .LVU646
+	jmp	.L162
+.LVL218:
+	.p2align 4,,10
+	.p2align 3
+.L164:
+.LBB721:
+	.loc 1 318 5 is_stmt 1 view .LVU647
+.LBB722:
+.LBI722:
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx512fintrin.h"
+	.loc 6 6490 1 view .LVU648
+.LBB723:
+	.loc 6 6492 3 view .LVU649
+	.loc 6 6492 3 is_stmt 0 view .LVU650
+.LBE723:
+.LBE722:
+	.loc 1 319 5 is_stmt 1 view .LVU651
+.LBB724:
+.LBI724:
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx512bwintrin.h"
+	.loc 7 1653 1 view .LVU652
+.LBB725:
+	.loc 7 1655 3 view .LVU653
+	.loc 7 1655 10 is_stmt 0 view .LVU654
+	vpxor	%xmm2, %xmm2, %xmm2
+	vpcmpeqb	-64(%rcx,%rdx), %zmm2, %k0
+.LVL219:
+	.loc 7 1655 10 view .LVU655
+.LBE725:
+.LBE724:
+	.loc 1 320 5 is_stmt 1 view .LVU656
+	.loc 1 320 8 is_stmt 0 view .LVU657
+	kortestq	%k0, %k0
+	jne	.L183
+.LVL220:
+.L162:
+	.loc 1 320 8 view .LVU658
+.LBE721:
+	.loc 1 317 21 is_stmt 1 discriminator 1 view .LVU659
+	movq	%rdx, %rax
+	.loc 1 317 16 is_stmt 0 discriminator 1 view .LVU660
+	leaq	64(%rdx), %rdx
+.LVL221:
+	.loc 1 317 21 discriminator 1 view .LVU661
+	cmpq	%rdx, %rsi
+	jnb	.L164
+	.loc 1 324 3 is_stmt 1 view .LVU662
+	.loc 1 324 18 is_stmt 0 view .LVU663
+	subq	%rax, %rsi
+.LVL222:
+.LBB726:
+.LBI726:
+	.loc 1 230 15 is_stmt 1 view .LVU664
+.LBB727:
+	.loc 1 232 10 is_stmt 0 view .LVU665
+	xorl	%edx, %edx
+.LBB728:
+.LBB729:
+.LBB730:
+	.loc 5 929 10 view .LVU666
+	leaq	(%rcx,%rax), %r9
+.LVL223:
+	.loc 5 929 10 view .LVU667
+.LBE730:
+.LBE729:
+.LBB732:
+.LBB733:
+	.loc 4 233 34 view .LVU668
+	vpxor	%xmm1, %xmm1, %xmm1
+	jmp	.L165
+.LVL224:
+	.p2align 4,,10
+	.p2align 3
+.L167:
+	.loc 4 233 34 view .LVU669
+.LBE733:
+.LBE732:
+	.loc 1 234 5 is_stmt 1 view .LVU670
+.LBB735:
+.LBI729:
+	.loc 5 927 1 view .LVU671
+.LBB731:
+	.loc 5 929 3 view .LVU672
+	.loc 5 929 3 is_stmt 0 view .LVU673
+.LBE731:
+.LBE735:
+	.loc 1 235 5 is_stmt 1 view .LVU674
+.LBB736:
+.LBI732:
+	.loc 4 231 1 view .LVU675
+.LBB734:
+	.loc 4 233 3 view .LVU676
+	.loc 4 233 34 is_stmt 0 view .LVU677
+	vpcmpeqb	-32(%rdx,%r9), %ymm1, %ymm0
+.LVL225:
+	.loc 4 233 34 view .LVU678
+.LBE734:
+.LBE736:
+.LBB737:
+.LBI737:
+	.loc 4 433 1 is_stmt 1 view .LVU679
+.LBB738:
+	.loc 4 435 3 view .LVU680
+	.loc 4 435 10 is_stmt 0 view .LVU681
+	vpmovmskb	%ymm0, %r8d
+.LVL226:
+	.loc 4 435 10 view .LVU682
+.LBE738:
+.LBE737:
+	.loc 1 236 5 is_stmt 1 view .LVU683
+	.loc 1 236 8 is_stmt 0 view .LVU684
+	testl	%r8d, %r8d
+	jne	.L184
+.LVL227:
+.L165:
+	.loc 1 236 8 view .LVU685
+.LBE728:
+	.loc 1 233 21 is_stmt 1 view .LVU686
+	movq	%rdx, %rdi
+	.loc 1 233 16 is_stmt 0 view .LVU687
+	leaq	32(%rdx), %rdx
+.LVL228:
+	.loc 1 233 21 view .LVU688
+	cmpq	%rdx, %rsi
+	jnb	.L167
+	leaq	-32(%rdx,%rax), %r11
+	.loc 1 240 3 is_stmt 1 view .LVU689
+	.loc 1 240 18 is_stmt 0 view .LVU690
+	subq	%rdi, %rsi
+.LVL229:
+.LBB739:
+.LBI739:
+	.loc 1 143 15 is_stmt 1 view .LVU691
+.LBB740:
+	.loc 1 145 10 is_stmt 0 view .LVU692
+	xorl	%edx, %edx
+.LBB741:
+.LBB742:
+.LBB743:
+	.loc 3 703 10 view .LVU693
+	leaq	(%rcx,%r11), %r10
+.LBE743:
+.LBE742:
+.LBB745:
+.LBB746:
+	.loc 3 1335 34 view .LVU694
+	vpxor	%xmm1, %xmm1, %xmm1
+	jmp	.L168
+.LVL230:
+	.p2align 4,,10
+	.p2align 3
+.L170:
+	.loc 3 1335 34 view .LVU695
+.LBE746:
+.LBE745:
+	.loc 1 147 5 is_stmt 1 view .LVU696
+.LBB748:
+.LBI742:
+	.loc 3 701 1 view .LVU697
+.LBB744:
+	.loc 3 703 3 view .LVU698
+	.loc 3 703 3 is_stmt 0 view .LVU699
+.LBE744:
+.LBE748:
+	.loc 1 148 5 is_stmt 1 view .LVU700
+.LBB749:
+.LBI745:
+	.loc 3 1333 1 view .LVU701
+.LBB747:
+	.loc 3 1335 3 view .LVU702
+	.loc 3 1335 34 is_stmt 0 view .LVU703
+	vpcmpeqb	-16(%rdx,%r10), %xmm1, %xmm0
+.LVL231:
+	.loc 3 1335 34 view .LVU704
+.LBE747:
+.LBE749:
+.LBB750:
+.LBI750:
+	.loc 3 1431 1 is_stmt 1 view .LVU705
+.LBB751:
+	.loc 3 1433 3 view .LVU706
+	.loc 3 1433 10 is_stmt 0 view .LVU707
+	vpmovmskb	%xmm0, %r9d
+.LVL232:
+	.loc 3 1433 10 view .LVU708
+.LBE751:
+.LBE750:
+	.loc 1 149 5 is_stmt 1 view .LVU709
+	.loc 1 149 8 is_stmt 0 view .LVU710
+	testl	%r9d, %r9d
+	jne	.L185
+.LVL233:
+.L168:
+	.loc 1 149 8 view .LVU711
+.LBE741:
+	.loc 1 146 21 is_stmt 1 view .LVU712
+	movq	%rdx, %r8
+	.loc 1 146 16 is_stmt 0 view .LVU713
+	leaq	16(%rdx), %rdx
+.LVL234:
+	.loc 1 146 21 view .LVU714
+	cmpq	%rdx, %rsi
+	jnb	.L170
+	.loc 1 153 3 is_stmt 1 view .LVU715
+.LVL235:
+.LBB752:
+.LBI752:
+	.loc 1 70 15 view .LVU716
+.LBB753:
+	.loc 1 71 3 view .LVU717
+	.loc 1 72 3 view .LVU718
+	.loc 1 72 25 view .LVU719
+	leaq	(%r8,%r11), %r9
+	.loc 1 71 10 is_stmt 0 view .LVU720
+	xorl	%edx, %edx
+	.loc 1 72 34 view .LVU721
+	addq	%r9, %rcx
+.LVL236:
+	.loc 1 72 25 view .LVU722
+	subq	%r8, %rsi
+.LVL237:
+	.loc 1 72 25 view .LVU723
+	jne	.L171
+	jmp	.L169
+.LVL238:
+	.p2align 4,,10
+	.p2align 3
+.L173:
+	.loc 1 73 5 is_stmt 1 view .LVU724
+	.loc 1 73 10 is_stmt 0 view .LVU725
+	incq	%rdx
+.LVL239:
+	.loc 1 72 25 is_stmt 1 view .LVU726
+	cmpq	%rdx, %rsi
+	je	.L186
+.LVL240:
+.L171:
+	.loc 1 72 25 is_stmt 0 view .LVU727
+	cmpb	$0, (%rcx,%rdx)
+	jne	.L173
+	addq	%rdx, %r8
+.LVL241:
+	.loc 1 75 3 is_stmt 1 view .LVU728
+.L169:
+	.loc 1 75 3 is_stmt 0 view .LVU729
+.LBE753:
+.LBE752:
+.LBE740:
+.LBE739:
+	.loc 1 240 16 view .LVU730
+	addq	%r8, %rdi
+.LVL242:
+	.loc 1 240 16 view .LVU731
+	jmp	.L166
+.LVL243:
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	.loc 1 240 16 view .LVU732
+.LBE727:
+.LBE726:
+.LBB760:
+	.loc 1 321 7 is_stmt 1 view .LVU733
+	.loc 1 321 22 is_stmt 0 view .LVU734
+	xorl	%edx, %edx
+.LVL244:
+	.loc 1 321 22 view .LVU735
+	kmovq	%k0, %rcx
+.LVL245:
+	.loc 1 321 22 view .LVU736
+	tzcntq	%rcx, %rdx
+	.loc 1 321 20 view .LVU737
+	addq	%rdx, %rax
+.LVL246:
+	.loc 1 321 20 view .LVU738
+	vzeroupper
+.LVL247:
+	.loc 1 321 20 view .LVU739
+.LBE760:
+	.loc 1 325 1 view .LVU740
+	ret
+.LVL248:
+	.p2align 4,,10
+	.p2align 3
+.L184:
+.LBB761:
+.LBB758:
+.LBB756:
+	.loc 1 237 7 is_stmt 1 view .LVU741
+	.loc 1 237 22 is_stmt 0 view .LVU742
+	tzcntl	%r8d, %r8d
+.LVL249:
+	.loc 1 237 20 view .LVU743
+	addq	%r8, %rdi
+.LVL250:
+.L166:
+	.loc 1 237 20 view .LVU744
+.LBE756:
+.LBE758:
+.LBE761:
+	.loc 1 324 16 view .LVU745
+	addq	%rdi, %rax
+.LVL251:
+	.loc 1 324 16 view .LVU746
+	vzeroupper
+.LVL252:
+	.loc 1 325 1 view .LVU747
+	ret
+.LVL253:
+	.p2align 4,,10
+	.p2align 3
+.L185:
+.LBB762:
+.LBB759:
+.LBB757:
+.LBB755:
+.LBB754:
+	.loc 1 150 7 is_stmt 1 view .LVU748
+	.loc 1 150 22 is_stmt 0 view .LVU749
+	tzcntl	%r9d, %r9d
+.LVL254:
+	.loc 1 150 20 view .LVU750
+	addq	%r9, %r8
+.LVL255:
+	.loc 1 150 20 view .LVU751
+	jmp	.L169
+.LVL256:
+.L186:
+	.loc 1 150 20 view .LVU752
+.LBE754:
+	.loc 1 153 16 view .LVU753
+	addq	%rsi, %r8
+.LVL257:
+	.loc 1 153 16 view .LVU754
+	jmp	.L169
+.LBE755:
+.LBE757:
+.LBE759:
+.LBE762:
+	.cfi_endproc
+.LFE6421:
+	.size	st_scan_nul_avx512, .-st_scan_nul_avx512
+	.p2align 4
+	.type	st_scan_non_whitespace_avx512, @function
+st_scan_non_whitespace_avx512:
+.LVL258:
+.LFB6420:
+	.loc 1 297 86 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 298 3 view .LVU756
+	.loc 1 299 3 view .LVU757
+	.loc 1 300 3 view .LVU758
+.LBB794:
+.LBB795:
+.LBB796:
+	.loc 7 2590 10 is_stmt 0 view .LVU759
+	movl	$33, %eax
+.LBE796:
+.LBE795:
+.LBE794:
+	.loc 1 297 86 view .LVU760
+	movq	%rdi, %rcx
+	.loc 1 299 10 view .LVU761
+	xorl	%edx, %edx
+.LBB803:
+.LBB799:
+.LBB797:
+	.loc 7 2590 10 view .LVU762
+	vpbroadcastb	%eax, %zmm0
+.LBE797:
+.LBE799:
+.LBE803:
+	.loc 1 300 3 view .LVU763
+	jmp	.L188
+.LVL259:
+	.p2align 4,,10
+	.p2align 3
+.L190:
+.LBB804:
+	.loc 1 301 5 is_stmt 1 view .LVU764
+.LBB800:
+.LBI800:
+	.loc 6 6490 1 view .LVU765
+.LBB801:
+	.loc 6 6492 3 view .LVU766
+	.loc 6 6492 3 is_stmt 0 view .LVU767
+.LBE801:
+.LBE800:
+	.loc 1 302 5 is_stmt 1 view .LVU768
+.LBB802:
+.LBI795:
+	.loc 7 2588 1 view .LVU769
+.LBB798:
+	.loc 7 2590 3 view .LVU770
+	.loc 7 2590 10 is_stmt 0 view .LVU771
+	vmovdqu8	-64(%rcx,%rdx), %zmm3
+	vpcmpub	$5, %zmm0, %zmm3, %k0
+.LVL260:
+	.loc 7 2590 10 view .LVU772
+.LBE798:
+.LBE802:
+	.loc 1 303 5 is_stmt 1 view .LVU773
+	.loc 1 303 8 is_stmt 0 view .LVU774
+	kortestq	%k0, %k0
+	jne	.L208
+.LVL261:
+.L188:
+	.loc 1 303 8 view .LVU775
+.LBE804:
+	.loc 1 300 21 is_stmt 1 discriminator 1 view .LVU776
+	movq	%rdx, %rax
+	.loc 1 300 16 is_stmt 0 discriminator 1 view .LVU777
+	leaq	64(%rdx), %rdx
+.LVL262:
+	.loc 1 300 21 discriminator 1 view .LVU778
+	cmpq	%rdx, %rsi
+	jnb	.L190
+	.loc 1 307 3 is_stmt 1 view .LVU779
+.LBB805:
+.LBB806:
+.LBB807:
+.LBB808:
+.LBB809:
+	.loc 4 372 19 is_stmt 0 view .LVU780
+	movl	$33, %edi
+.LBE809:
+.LBE808:
+.LBE807:
+.LBE806:
+.LBE805:
+	.loc 1 307 18 view .LVU781
+	subq	%rax, %rsi
+.LVL263:
+.LBB862:
+.LBI805:
+	.loc 1 212 15 is_stmt 1 view .LVU782
+.LBB859:
+	.loc 1 214 10 is_stmt 0 view .LVU783
+	xorl	%edx, %edx
+.LBB826:
+.LBB813:
+.LBB814:
+	.loc 5 929 10 view .LVU784
+	leaq	(%rcx,%rax), %r9
+.LBE814:
+.LBE813:
+.LBB817:
+.LBB810:
+	.loc 4 372 19 view .LVU785
+	vpbroadcastb	%edi, %ymm2
+	jmp	.L191
+.LVL264:
+	.p2align 4,,10
+	.p2align 3
+.L193:
+	.loc 4 372 19 view .LVU786
+.LBE810:
+.LBE817:
+	.loc 1 216 5 is_stmt 1 view .LVU787
+.LBB818:
+.LBI813:
+	.loc 5 927 1 view .LVU788
+.LBB815:
+	.loc 5 929 3 view .LVU789
+	.loc 5 929 3 is_stmt 0 view .LVU790
+.LBE815:
+.LBE818:
+	.loc 1 217 5 is_stmt 1 view .LVU791
+.LBB819:
+.LBI808:
+	.loc 4 370 1 view .LVU792
+.LBB811:
+	.loc 4 372 3 view .LVU793
+.LBE811:
+.LBE819:
+.LBB820:
+.LBB816:
+	.loc 5 929 10 is_stmt 0 view .LVU794
+	vmovdqu	-32(%r9,%rdx), %ymm0
+.LBE816:
+.LBE820:
+.LBB821:
+.LBB812:
+	.loc 4 372 19 view .LVU795
+	vpmaxub	%ymm0, %ymm2, %ymm1
+.LVL265:
+	.loc 4 372 19 view .LVU796
+.LBE812:
+.LBE821:
+.LBB822:
+.LBI822:
+	.loc 4 231 1 is_stmt 1 view .LVU797
+.LBB823:
+	.loc 4 233 3 view .LVU798
+	.loc 4 233 34 is_stmt 0 view .LVU799
+	vpcmpeqb	%ymm1, %ymm0, %ymm0
+.LVL266:
+	.loc 4 233 34 view .LVU800
+.LBE823:
+.LBE822:
+	.loc 1 218 5 is_stmt 1 view .LVU801
+.LBB824:
+.LBI824:
+	.loc 4 433 1 view .LVU802
+.LBB825:
+	.loc 4 435 3 view .LVU803
+	.loc 4 435 10 is_stmt 0 view .LVU804
+	vpmovmskb	%ymm0, %r8d
+.LVL267:
+	.loc 4 435 10 view .LVU805
+.LBE825:
+.LBE824:
+	.loc 1 219 5 is_stmt 1 view .LVU806
+	.loc 1 219 8 is_stmt 0 view .LVU807
+	testl	%r8d, %r8d
+	jne	.L209
+.LVL268:
+.L191:
+	.loc 1 219 8 view .LVU808
+.LBE826:
+	.loc 1 215 21 is_stmt 1 view .LVU809
+	movq	%rdx, %rdi
+	.loc 1 215 16 is_stmt 0 view .LVU810
+	leaq	32(%rdx), %rdx
+.LVL269:
+	.loc 1 215 21 view .LVU811
+	cmpq	%rdx, %rsi
+	jnb	.L193
+	leaq	-32(%rdx,%rax), %r11
+	.loc 1 223 3 is_stmt 1 view .LVU812
+.LBB827:
+.LBB828:
+.LBB829:
+.LBB830:
+.LBB831:
+	.loc 3 1415 19 is_stmt 0 view .LVU813
+	movl	$33, %r8d
+.LBE831:
+.LBE830:
+.LBE829:
+.LBE828:
+.LBE827:
+	.loc 1 223 18 view .LVU814
+	subq	%rdi, %rsi
+.LVL270:
+.LBB856:
+.LBI827:
+	.loc 1 124 15 is_stmt 1 view .LVU815
+.LBB854:
+	.loc 1 126 10 is_stmt 0 view .LVU816
+	xorl	%edx, %edx
+.LBB848:
+.LBB835:
+.LBB836:
+	.loc 3 703 10 view .LVU817
+	leaq	(%rcx,%r11), %r10
+.LBE836:
+.LBE835:
+.LBB839:
+.LBB832:
+	.loc 3 1415 19 view .LVU818
+	vpbroadcastb	%r8d, %xmm2
+	jmp	.L194
+.LVL271:
+	.p2align 4,,10
+	.p2align 3
+.L196:
+	.loc 3 1415 19 view .LVU819
+.LBE832:
+.LBE839:
+	.loc 1 128 5 is_stmt 1 view .LVU820
+.LBB840:
+.LBI835:
+	.loc 3 701 1 view .LVU821
+.LBB837:
+	.loc 3 703 3 view .LVU822
+	.loc 3 703 3 is_stmt 0 view .LVU823
+.LBE837:
+.LBE840:
+	.loc 1 130 5 is_stmt 1 view .LVU824
+.LBB841:
+.LBI830:
+	.loc 3 1413 1 view .LVU825
+.LBB833:
+	.loc 3 1415 3 view .LVU826
+.LBE833:
+.LBE841:
+.LBB842:
+.LBB838:
+	.loc 3 703 10 is_stmt 0 view .LVU827
+	vmovdqu	-16(%r10,%rdx), %xmm0
+.LBE838:
+.LBE842:
+.LBB843:
+.LBB834:
+	.loc 3 1415 19 view .LVU828
+	vpmaxub	%xmm0, %xmm2, %xmm1
+.LVL272:
+	.loc 3 1415 19 view .LVU829
+.LBE834:
+.LBE843:
+.LBB844:
+.LBI844:
+	.loc 3 1333 1 is_stmt 1 view .LVU830
+.LBB845:
+	.loc 3 1335 3 view .LVU831
+	.loc 3 1335 34 is_stmt 0 view .LVU832
+	vpcmpeqb	%xmm1, %xmm0, %xmm0
+.LVL273:
+	.loc 3 1335 34 view .LVU833
+.LBE845:
+.LBE844:
+	.loc 1 131 5 is_stmt 1 view .LVU834
+.LBB846:
+.LBI846:
+	.loc 3 1431 1 view .LVU835
+.LBB847:
+	.loc 3 1433 3 view .LVU836
+	.loc 3 1433 10 is_stmt 0 view .LVU837
+	vpmovmskb	%xmm0, %r9d
+.LVL274:
+	.loc 3 1433 10 view .LVU838
+.LBE847:
+.LBE846:
+	.loc 1 132 5 is_stmt 1 view .LVU839
+	.loc 1 132 8 is_stmt 0 view .LVU840
+	testl	%r9d, %r9d
+	jne	.L210
+.LVL275:
+.L194:
+	.loc 1 132 8 view .LVU841
+.LBE848:
+	.loc 1 127 21 is_stmt 1 view .LVU842
+	movq	%rdx, %r8
+	.loc 1 127 16 is_stmt 0 view .LVU843
+	leaq	16(%rdx), %rdx
+.LVL276:
+	.loc 1 127 21 view .LVU844
+	cmpq	%rdx, %rsi
+	jnb	.L196
+	.loc 1 136 3 is_stmt 1 view .LVU845
+.LVL277:
+.LBB849:
+.LBI849:
+	.loc 1 59 15 view .LVU846
+.LBB850:
+	.loc 1 60 3 view .LVU847
+	.loc 1 61 3 view .LVU848
+	.loc 1 61 25 view .LVU849
+	subq	%r8, %rsi
+.LVL278:
+	.loc 1 61 25 is_stmt 0 view .LVU850
+	je	.L195
+	leaq	(%r8,%r11), %r9
+	movq	st_char_classes@GOTPCREL(%rip), %r10
+	.loc 1 60 10 view .LVU851
+	xorl	%edx, %edx
+	.loc 1 61 45 view .LVU852
+	addq	%r9, %rcx
+.LVL279:
+	.loc 1 61 45 view .LVU853
+	jmp	.L197
+.LVL280:
+	.p2align 4,,10
+	.p2align 3
+.L199:
+	.loc 1 62 5 is_stmt 1 view .LVU854
+	.loc 1 62 10 is_stmt 0 view .LVU855
+	incq	%rdx
+.LVL281:
+	.loc 1 61 25 is_stmt 1 view .LVU856
+	cmpq	%rdx, %rsi
+	je	.L211
+.LVL282:
+.L197:
+.LBB851:
+.LBI851:
+	.loc 2 202 19 view .LVU857
+.LBB852:
+	.loc 2 203 3 view .LVU858
+	.loc 2 203 26 is_stmt 0 view .LVU859
+	movzbl	(%rcx,%rdx), %r9d
+.LBE852:
+.LBE851:
+	.loc 1 61 25 view .LVU860
+	testb	$1, (%r10,%r9)
+	jne	.L199
+	addq	%rdx, %r8
+.LVL283:
+	.loc 1 64 3 is_stmt 1 view .LVU861
+.L195:
+	.loc 1 64 3 is_stmt 0 view .LVU862
+.LBE850:
+.LBE849:
+.LBE854:
+.LBE856:
+	.loc 1 223 16 view .LVU863
+	addq	%r8, %rdi
+.LVL284:
+	.loc 1 223 16 view .LVU864
+	jmp	.L192
+.LVL285:
+	.p2align 4,,10
+	.p2align 3
+.L208:
+	.loc 1 223 16 view .LVU865
+.LBE859:
+.LBE862:
+.LBB863:
+	.loc 1 304 7 is_stmt 1 view .LVU866
+	.loc 1 304 22 is_stmt 0 view .LVU867
+	xorl	%edx, %edx
+.LVL286:
+	.loc 1 304 22 view .LVU868
+	kmovq	%k0, %rcx
+.LVL287:
+	.loc 1 304 22 view .LVU869
+	tzcntq	%rcx, %rdx
+	.loc 1 304 20 view .LVU870
+	addq	%rdx, %rax
+.LVL288:
+	.loc 1 304 20 view .LVU871
+	vzeroupper
+.LVL289:
+	.loc 1 304 20 view .LVU872
+.LBE863:
+	.loc 1 308 1 view .LVU873
+	ret
+.LVL290:
+	.p2align 4,,10
+	.p2align 3
+.L209:
+.LBB864:
+.LBB860:
+.LBB857:
+	.loc 1 220 7 is_stmt 1 view .LVU874
+	.loc 1 220 22 is_stmt 0 view .LVU875
+	tzcntl	%r8d, %r8d
+.LVL291:
+	.loc 1 220 20 view .LVU876
+	addq	%r8, %rdi
+.LVL292:
+.L192:
+	.loc 1 220 20 view .LVU877
+.LBE857:
+.LBE860:
+.LBE864:
+	.loc 1 307 16 view .LVU878
+	addq	%rdi, %rax
+.LVL293:
+	.loc 1 307 16 view .LVU879
+	vzeroupper
+.LVL294:
+	.loc 1 308 1 view .LVU880
+	ret
+.LVL295:
+	.p2align 4,,10
+	.p2align 3
+.L210:
+.LBB865:
+.LBB861:
+.LBB858:
+.LBB855:
+.LBB853:
+	.loc 1 133 7 is_stmt 1 view .LVU881
+	.loc 1 133 22 is_stmt 0 view .LVU882
+	tzcntl	%r9d, %r9d
+.LVL296:
+	.loc 1 133 20 view .LVU883
+	addq	%r9, %r8
+.LVL297:
+	.loc 1 133 20 view .LVU884
+	jmp	.L195
+.LVL298:
+.L211:
+	.loc 1 133 20 view .LVU885
+.LBE853:
+	.loc 1 136 16 view .LVU886
+	addq	%rsi, %r8
+.LVL299:
+	.loc 1 136 16 view .LVU887
+	jmp	.L195
+.LBE855:
+.LBE858:
+.LBE861:
+.LBE865:
+	.cfi_endproc
+.LFE6420:
+	.size	st_scan_non_whitespace_avx512, .-st_scan_non_whitespace_avx512
+	.p2align 4
+	.type	st_scan_delimiter_avx512, @function
+st_scan_delimiter_avx512:
+.LVL300:
+.LFB6419:
+	.loc 1 279 99 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 279 99 is_stmt 0 view .LVU889
+	movq	%rdi, %r9
+	.loc 1 280 3 is_stmt 1 view .LVU890
+.LVL301:
+.LBB909:
+.LBI909:
+	.loc 6 214 1 view .LVU891
+.LBB910:
+	.loc 6 216 3 view .LVU892
+.LBE910:
+.LBE909:
+	.loc 1 279 99 is_stmt 0 view .LVU893
+	movl	%edx, %r11d
+.LBB912:
+.LBB911:
+	.loc 6 217 3 view .LVU894
+	vpbroadcastb	%edx, %zmm1
+.LVL302:
+	.loc 6 217 3 view .LVU895
+.LBE911:
+.LBE912:
+	.loc 1 281 3 is_stmt 1 view .LVU896
+	.loc 1 282 3 view .LVU897
+	.loc 1 283 3 view .LVU898
+	.loc 1 282 10 is_stmt 0 view .LVU899
+	xorl	%ecx, %ecx
+	.loc 1 283 3 view .LVU900
+	jmp	.L213
+.LVL303:
+	.p2align 4,,10
+	.p2align 3
+.L215:
+.LBB913:
+	.loc 1 284 5 is_stmt 1 view .LVU901
+.LBB914:
+.LBI914:
+	.loc 6 6490 1 view .LVU902
+.LBB915:
+	.loc 6 6492 3 view .LVU903
+	.loc 6 6492 3 is_stmt 0 view .LVU904
+.LBE915:
+.LBE914:
+	.loc 1 285 5 is_stmt 1 view .LVU905
+.LBB917:
+.LBI917:
+	.loc 7 1653 1 view .LVU906
+.LBB918:
+	.loc 7 1655 3 view .LVU907
+.LBE918:
+.LBE917:
+.LBB921:
+.LBB916:
+	.loc 6 6492 10 is_stmt 0 view .LVU908
+	vmovdqu64	-64(%r9,%rcx), %zmm0
+.LBE916:
+.LBE921:
+.LBB922:
+.LBB919:
+	.loc 7 1655 10 view .LVU909
+	vpcmpb	$0, %zmm1, %zmm0, %k0
+.LBE919:
+.LBE922:
+.LBB923:
+.LBB924:
+	vptestnmb	%zmm0, %zmm0, %k1
+.LBE924:
+.LBE923:
+.LBB926:
+.LBB920:
+	kmovq	%k0, %r8
+.LVL304:
+	.loc 7 1655 10 view .LVU910
+.LBE920:
+.LBE926:
+.LBB927:
+.LBI923:
+	.loc 7 1653 1 is_stmt 1 view .LVU911
+.LBB925:
+	.loc 7 1655 3 view .LVU912
+	.loc 7 1655 10 is_stmt 0 view .LVU913
+	kmovq	%k1, %rdi
+.LVL305:
+	.loc 7 1655 10 view .LVU914
+.LBE925:
+.LBE927:
+	.loc 1 286 5 is_stmt 1 view .LVU915
+	.loc 1 286 8 is_stmt 0 view .LVU916
+	orq	%r8, %rdi
+.LVL306:
+	.loc 1 286 8 view .LVU917
+	jne	.L244
+.LVL307:
+.L213:
+	.loc 1 286 8 view .LVU918
+.LBE913:
+	.loc 1 283 21 is_stmt 1 discriminator 1 view .LVU919
+	movq	%rcx, %rax
+	.loc 1 283 16 is_stmt 0 discriminator 1 view .LVU920
+	leaq	64(%rcx), %rcx
+.LVL308:
+	.loc 1 283 21 discriminator 1 view .LVU921
+	cmpq	%rcx, %rsi
+	jnb	.L215
+	.loc 1 290 3 is_stmt 1 view .LVU922
+	.loc 1 290 18 is_stmt 0 view .LVU923
+	subq	%rax, %rsi
+.LVL309:
+.LBB928:
+.LBI928:
+	.loc 1 193 15 is_stmt 1 view .LVU924
+.LBB929:
+	.loc 1 194 3 view .LVU925
+.LBB930:
+.LBI930:
+	.loc 5 1340 1 view .LVU926
+	.loc 5 1342 3 view .LVU927
+.LBB931:
+.LBI931:
+	.loc 5 1285 1 view .LVU928
+.LBB932:
+	.loc 5 1294 3 view .LVU929
+	.loc 5 1294 42 is_stmt 0 view .LVU930
+	vpbroadcastb	%edx, %ymm3
+.LVL310:
+	.loc 5 1294 42 view .LVU931
+.LBE932:
+.LBE931:
+.LBE930:
+	.loc 1 195 3 is_stmt 1 view .LVU932
+	.loc 1 196 3 view .LVU933
+	.loc 1 197 3 view .LVU934
+	.loc 1 196 10 is_stmt 0 view .LVU935
+	xorl	%ecx, %ecx
+.LBB933:
+.LBB934:
+.LBB935:
+	.loc 5 929 10 view .LVU936
+	leaq	(%r9,%rax), %r10
+.LVL311:
+	.loc 5 929 10 view .LVU937
+.LBE935:
+.LBE934:
+.LBB938:
+.LBB939:
+	.loc 4 233 34 view .LVU938
+	vpxor	%xmm2, %xmm2, %xmm2
+.LBE939:
+.LBE938:
+.LBE933:
+	.loc 1 197 3 view .LVU939
+	jmp	.L216
+.LVL312:
+	.p2align 4,,10
+	.p2align 3
+.L218:
+.LBB956:
+	.loc 1 198 5 is_stmt 1 view .LVU940
+.LBB942:
+.LBI934:
+	.loc 5 927 1 view .LVU941
+.LBB936:
+	.loc 5 929 3 view .LVU942
+	.loc 5 929 3 is_stmt 0 view .LVU943
+.LBE936:
+.LBE942:
+	.loc 1 199 5 is_stmt 1 view .LVU944
+.LBB943:
+.LBI938:
+	.loc 4 231 1 view .LVU945
+.LBB940:
+	.loc 4 233 3 view .LVU946
+.LBE940:
+.LBE943:
+.LBB944:
+.LBB937:
+	.loc 5 929 10 is_stmt 0 view .LVU947
+	vmovdqu	-32(%r10,%rcx), %ymm0
+.LBE937:
+.LBE944:
+.LBB945:
+.LBB941:
+	.loc 4 233 34 view .LVU948
+	vpcmpeqb	%ymm2, %ymm0, %ymm1
+.LVL313:
+	.loc 4 233 34 view .LVU949
+.LBE941:
+.LBE945:
+.LBB946:
+.LBI946:
+	.loc 4 231 1 is_stmt 1 view .LVU950
+.LBB947:
+	.loc 4 233 3 view .LVU951
+	.loc 4 233 34 is_stmt 0 view .LVU952
+	vpcmpeqb	%ymm0, %ymm3, %ymm0
+.LVL314:
+	.loc 4 233 34 view .LVU953
+.LBE947:
+.LBE946:
+.LBB948:
+.LBI948:
+	.loc 4 574 1 is_stmt 1 view .LVU954
+.LBB949:
+	.loc 4 576 3 view .LVU955
+	.loc 4 576 3 is_stmt 0 view .LVU956
+.LBE949:
+.LBE948:
+	.loc 1 200 5 is_stmt 1 view .LVU957
+.LBB951:
+.LBI951:
+	.loc 4 433 1 view .LVU958
+.LBB952:
+	.loc 4 435 3 view .LVU959
+.LBE952:
+.LBE951:
+.LBB954:
+.LBB950:
+	.loc 4 576 33 is_stmt 0 view .LVU960
+	vpor	%ymm1, %ymm0, %ymm0
+.LVL315:
+	.loc 4 576 33 view .LVU961
+.LBE950:
+.LBE954:
+.LBB955:
+.LBB953:
+	.loc 4 435 10 view .LVU962
+	vpmovmskb	%ymm0, %r8d
+.LVL316:
+	.loc 4 435 10 view .LVU963
+.LBE953:
+.LBE955:
+	.loc 1 201 5 is_stmt 1 view .LVU964
+	.loc 1 201 8 is_stmt 0 view .LVU965
+	testl	%r8d, %r8d
+	jne	.L245
+.LVL317:
+.L216:
+	.loc 1 201 8 view .LVU966
+.LBE956:
+	.loc 1 197 21 is_stmt 1 view .LVU967
+	movq	%rcx, %rdi
+	.loc 1 197 16 is_stmt 0 view .LVU968
+	leaq	32(%rcx), %rcx
+.LVL318:
+	.loc 1 197 21 view .LVU969
+	cmpq	%rcx, %rsi
+	jnb	.L218
+.LBE929:
+.LBE928:
+	.loc 1 279 99 view .LVU970
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB1004:
+.LBB999:
+.LBB957:
+.LBB958:
+.LBB959:
+.LBB960:
+.LBB961:
+	.loc 3 621 42 view .LVU971
+	vpbroadcastb	%edx, %xmm1
+.LBE961:
+.LBE960:
+.LBE959:
+.LBE958:
+.LBE957:
+	.loc 1 205 18 view .LVU972
+	subq	%rdi, %rsi
+.LVL319:
+	.loc 1 205 18 view .LVU973
+.LBE999:
+.LBE1004:
+	.loc 1 279 99 view .LVU974
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%rbx
+	.cfi_offset 3, -24
+	leaq	-32(%rcx,%rax), %rbx
+.LBB1005:
+.LBB1000:
+	.loc 1 205 3 is_stmt 1 view .LVU975
+.LVL320:
+.LBB995:
+.LBI957:
+	.loc 1 105 15 view .LVU976
+.LBB992:
+	.loc 1 106 3 view .LVU977
+.LBB964:
+.LBI959:
+	.loc 3 654 1 view .LVU978
+	.loc 3 656 3 view .LVU979
+.LBB963:
+.LBI960:
+	.loc 3 616 1 view .LVU980
+.LBB962:
+	.loc 3 621 3 view .LVU981
+	.loc 3 621 3 is_stmt 0 view .LVU982
+.LBE962:
+.LBE963:
+.LBE964:
+	.loc 1 107 3 is_stmt 1 view .LVU983
+	.loc 1 108 3 view .LVU984
+	.loc 1 109 3 view .LVU985
+	.loc 1 108 10 is_stmt 0 view .LVU986
+	xorl	%edx, %edx
+.LVL321:
+.LBB965:
+.LBB966:
+.LBB967:
+	.loc 3 703 10 view .LVU987
+	leaq	(%r9,%rbx), %r10
+.LVL322:
+	.loc 3 703 10 view .LVU988
+.LBE967:
+.LBE966:
+.LBB970:
+.LBB971:
+	.loc 3 1335 34 view .LVU989
+	vpxor	%xmm3, %xmm3, %xmm3
+.LVL323:
+	.loc 3 1335 34 view .LVU990
+.LBE971:
+.LBE970:
+.LBE965:
+	.loc 1 109 3 view .LVU991
+	jmp	.L219
+.LVL324:
+	.p2align 4,,10
+	.p2align 3
+.L221:
+.LBB988:
+	.loc 1 110 5 is_stmt 1 view .LVU992
+.LBB974:
+.LBI966:
+	.loc 3 701 1 view .LVU993
+.LBB968:
+	.loc 3 703 3 view .LVU994
+	.loc 3 703 3 is_stmt 0 view .LVU995
+.LBE968:
+.LBE974:
+	.loc 1 111 5 is_stmt 1 view .LVU996
+.LBB975:
+.LBI970:
+	.loc 3 1333 1 view .LVU997
+.LBB972:
+	.loc 3 1335 3 view .LVU998
+.LBE972:
+.LBE975:
+.LBB976:
+.LBB969:
+	.loc 3 703 10 is_stmt 0 view .LVU999
+	vmovdqu	-16(%r10,%rdx), %xmm0
+.LBE969:
+.LBE976:
+.LBB977:
+.LBB973:
+	.loc 3 1335 34 view .LVU1000
+	vpcmpeqb	%xmm3, %xmm0, %xmm2
+.LVL325:
+	.loc 3 1335 34 view .LVU1001
+.LBE973:
+.LBE977:
+.LBB978:
+.LBI978:
+	.loc 3 1333 1 is_stmt 1 view .LVU1002
+.LBB979:
+	.loc 3 1335 3 view .LVU1003
+	.loc 3 1335 34 is_stmt 0 view .LVU1004
+	vpcmpeqb	%xmm0, %xmm1, %xmm0
+.LVL326:
+	.loc 3 1335 34 view .LVU1005
+.LBE979:
+.LBE978:
+.LBB980:
+.LBI980:
+	.loc 3 1321 1 is_stmt 1 view .LVU1006
+.LBB981:
+	.loc 3 1323 3 view .LVU1007
+	.loc 3 1323 3 is_stmt 0 view .LVU1008
+.LBE981:
+.LBE980:
+	.loc 1 112 5 is_stmt 1 view .LVU1009
+.LBB983:
+.LBI983:
+	.loc 3 1431 1 view .LVU1010
+.LBB984:
+	.loc 3 1433 3 view .LVU1011
+.LBE984:
+.LBE983:
+.LBB986:
+.LBB982:
+	.loc 3 1323 33 is_stmt 0 view .LVU1012
+	vpor	%xmm2, %xmm0, %xmm0
+.LVL327:
+	.loc 3 1323 33 view .LVU1013
+.LBE982:
+.LBE986:
+.LBB987:
+.LBB985:
+	.loc 3 1433 10 view .LVU1014
+	vpmovmskb	%xmm0, %r8d
+.LVL328:
+	.loc 3 1433 10 view .LVU1015
+.LBE985:
+.LBE987:
+	.loc 1 113 5 is_stmt 1 view .LVU1016
+	.loc 1 113 8 is_stmt 0 view .LVU1017
+	testl	%r8d, %r8d
+	jne	.L246
+.LVL329:
+.L219:
+	.loc 1 113 8 view .LVU1018
+.LBE988:
+	.loc 1 109 21 is_stmt 1 view .LVU1019
+	movq	%rdx, %rcx
+	.loc 1 109 16 is_stmt 0 view .LVU1020
+	leaq	16(%rdx), %rdx
+.LVL330:
+	.loc 1 109 21 view .LVU1021
+	cmpq	%rdx, %rsi
+	jnb	.L221
+	.loc 1 117 3 is_stmt 1 view .LVU1022
+.LVL331:
+.LBB989:
+.LBI989:
+	.loc 1 48 15 view .LVU1023
+.LBB990:
+	.loc 1 49 3 view .LVU1024
+	.loc 1 50 3 view .LVU1025
+	.loc 1 50 51 view .LVU1026
+	leaq	(%rcx,%rbx), %r8
+	.loc 1 49 10 is_stmt 0 view .LVU1027
+	xorl	%edx, %edx
+	.loc 1 50 34 view .LVU1028
+	addq	%r8, %r9
+.LVL332:
+	.loc 1 50 51 view .LVU1029
+	subq	%rcx, %rsi
+.LVL333:
+	.loc 1 50 51 view .LVU1030
+	jne	.L222
+	jmp	.L220
+.LVL334:
+	.p2align 4,,10
+	.p2align 3
+.L248:
+	.loc 1 50 51 view .LVU1031
+	cmpb	%r8b, %r11b
+	je	.L227
+	.loc 1 51 5 is_stmt 1 view .LVU1032
+	.loc 1 51 10 is_stmt 0 view .LVU1033
+	incq	%rdx
+.LVL335:
+	.loc 1 50 51 is_stmt 1 view .LVU1034
+	cmpq	%rdx, %rsi
+	je	.L247
+.LVL336:
+.L222:
+	.loc 1 50 34 is_stmt 0 view .LVU1035
+	movzbl	(%r9,%rdx), %r8d
+	.loc 1 50 51 view .LVU1036
+	testb	%r8b, %r8b
+	jne	.L248
+.L227:
+	addq	%rdx, %rcx
+.LVL337:
+	.loc 1 53 3 is_stmt 1 view .LVU1037
+.L220:
+	.loc 1 53 3 is_stmt 0 view .LVU1038
+.LBE990:
+.LBE989:
+.LBE992:
+.LBE995:
+	.loc 1 205 16 view .LVU1039
+	addq	%rcx, %rdi
+.LVL338:
+	.loc 1 205 16 view .LVU1040
+.LBE1000:
+.LBE1005:
+	.loc 1 290 16 view .LVU1041
+	addq	%rdi, %rax
+.LVL339:
+	.loc 1 290 16 view .LVU1042
+	vzeroupper
+.LVL340:
+	.loc 1 291 1 view .LVU1043
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+.LVL341:
+	.p2align 4,,10
+	.p2align 3
+.L244:
+	.cfi_restore 3
+	.cfi_restore 6
+.LBB1006:
+	.loc 1 287 7 is_stmt 1 view .LVU1044
+	.loc 1 287 22 is_stmt 0 view .LVU1045
+	tzcntq	%rdi, %rdi
+.LVL342:
+	.loc 1 287 20 view .LVU1046
+	addq	%rdi, %rax
+.LVL343:
+	.loc 1 287 20 view .LVU1047
+	vzeroupper
+.LVL344:
+	ret
+.LVL345:
+	.p2align 4,,10
+	.p2align 3
+.L245:
+	.loc 1 287 20 view .LVU1048
+.LBE1006:
+.LBB1007:
+.LBB1001:
+.LBB996:
+	.loc 1 202 7 is_stmt 1 view .LVU1049
+	.loc 1 202 22 is_stmt 0 view .LVU1050
+	tzcntl	%r8d, %r8d
+.LVL346:
+	.loc 1 202 20 view .LVU1051
+	addq	%r8, %rdi
+.LVL347:
+	.loc 1 202 20 view .LVU1052
+.LBE996:
+.LBE1001:
+.LBE1007:
+	.loc 1 290 16 view .LVU1053
+	addq	%rdi, %rax
+.LVL348:
+	.loc 1 290 16 view .LVU1054
+	vzeroupper
+.LVL349:
+	.loc 1 290 16 view .LVU1055
+	ret
+.LVL350:
+	.p2align 4,,10
+	.p2align 3
+.L246:
+	.cfi_def_cfa 6, 16
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+.LBB1008:
+.LBB1002:
+.LBB997:
+.LBB993:
+.LBB991:
+	.loc 1 114 7 is_stmt 1 view .LVU1056
+	.loc 1 114 22 is_stmt 0 view .LVU1057
+	tzcntl	%r8d, %r8d
+.LVL351:
+	.loc 1 114 20 view .LVU1058
+	addq	%r8, %rcx
+.LVL352:
+	.loc 1 114 20 view .LVU1059
+.LBE991:
+.LBE993:
+.LBE997:
+	.loc 1 205 16 view .LVU1060
+	addq	%rcx, %rdi
+.LVL353:
+	.loc 1 205 16 view .LVU1061
+.LBE1002:
+.LBE1008:
+	.loc 1 290 16 view .LVU1062
+	addq	%rdi, %rax
+.LVL354:
+	.loc 1 290 16 view .LVU1063
+	vzeroupper
+.LVL355:
+	.loc 1 291 1 view .LVU1064
+	movq	-8(%rbp), %rbx
+	leave
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL356:
+.L247:
+	.cfi_restore_state
+.LBB1009:
+.LBB1003:
+.LBB998:
+.LBB994:
+	.loc 1 117 16 view .LVU1065
+	addq	%rsi, %rcx
+.LVL357:
+	.loc 1 117 16 view .LVU1066
+	jmp	.L220
+.LBE994:
+.LBE998:
+.LBE1003:
+.LBE1009:
+	.cfi_endproc
+.LFE6419:
+	.size	st_scan_delimiter_avx512, .-st_scan_delimiter_avx512
+	.p2align 4
+	.type	st_scan_escape_avx2, @function
+st_scan_escape_avx2:
+.LVL358:
+.LFB6418:
+	.loc 1 247 76 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 248 3 view .LVU1068
+	.loc 1 249 3 view .LVU1069
+	.loc 1 250 3 view .LVU1070
+	.loc 1 251 3 view .LVU1071
+	.loc 1 252 3 view .LVU1072
+.LBB1067:
+.LBB1068:
+.LBB1069:
+	.loc 4 414 19 is_stmt 0 view .LVU1073
+	movl	$31, %eax
+	vpbroadcastb	%eax, %ymm5
+.LBE1069:
+.LBE1068:
+.LBB1072:
+.LBB1073:
+	.loc 4 233 34 view .LVU1074
+	movl	$34, %eax
+	vpbroadcastb	%eax, %ymm4
+.LBE1073:
+.LBE1072:
+.LBB1075:
+.LBB1076:
+	movl	$92, %eax
+.LBE1076:
+.LBE1075:
+.LBE1067:
+	.loc 1 251 10 view .LVU1075
+	xorl	%edx, %edx
+.LBB1100:
+.LBB1079:
+.LBB1077:
+	.loc 4 233 34 view .LVU1076
+	vpbroadcastb	%eax, %ymm3
+.LBE1077:
+.LBE1079:
+.LBE1100:
+	.loc 1 252 3 view .LVU1077
+	jmp	.L250
+.LVL359:
+	.p2align 4,,10
+	.p2align 3
+.L252:
+.LBB1101:
+	.loc 1 253 5 is_stmt 1 view .LVU1078
+.LBB1080:
+.LBI1080:
+	.loc 5 927 1 view .LVU1079
+.LBB1081:
+	.loc 5 929 3 view .LVU1080
+	.loc 5 929 3 is_stmt 0 view .LVU1081
+.LBE1081:
+.LBE1080:
+	.loc 1 254 5 is_stmt 1 view .LVU1082
+.LBB1083:
+.LBI1068:
+	.loc 4 412 1 view .LVU1083
+.LBB1070:
+	.loc 4 414 3 view .LVU1084
+.LBE1070:
+.LBE1083:
+.LBB1084:
+.LBB1082:
+	.loc 5 929 10 is_stmt 0 view .LVU1085
+	vmovdqu	-32(%rdi,%rdx), %ymm0
+.LBE1082:
+.LBE1084:
+.LBB1085:
+.LBB1071:
+	.loc 4 414 19 view .LVU1086
+	vpminub	%ymm0, %ymm5, %ymm1
+.LVL360:
+	.loc 4 414 19 view .LVU1087
+.LBE1071:
+.LBE1085:
+.LBB1086:
+.LBI1086:
+	.loc 4 231 1 is_stmt 1 view .LVU1088
+.LBB1087:
+	.loc 4 233 3 view .LVU1089
+	.loc 4 233 34 is_stmt 0 view .LVU1090
+	vpcmpeqb	%ymm1, %ymm0, %ymm1
+.LVL361:
+	.loc 4 233 34 view .LVU1091
+.LBE1087:
+.LBE1086:
+	.loc 1 255 5 is_stmt 1 view .LVU1092
+.LBB1088:
+.LBI1072:
+	.loc 4 231 1 view .LVU1093
+.LBB1074:
+	.loc 4 233 3 view .LVU1094
+	.loc 4 233 34 is_stmt 0 view .LVU1095
+	vpcmpeqb	%ymm4, %ymm0, %ymm2
+.LVL362:
+	.loc 4 233 34 view .LVU1096
+.LBE1074:
+.LBE1088:
+.LBB1089:
+.LBI1089:
+	.loc 4 574 1 is_stmt 1 view .LVU1097
+.LBB1090:
+	.loc 4 576 3 view .LVU1098
+	.loc 4 576 3 is_stmt 0 view .LVU1099
+.LBE1090:
+.LBE1089:
+	.loc 1 256 5 is_stmt 1 view .LVU1100
+.LBB1091:
+.LBI1075:
+	.loc 4 231 1 view .LVU1101
+.LBB1078:
+	.loc 4 233 3 view .LVU1102
+	.loc 4 233 34 is_stmt 0 view .LVU1103
+	vpcmpeqb	%ymm3, %ymm0, %ymm0
+.LVL363:
+	.loc 4 233 34 view .LVU1104
+.LBE1078:
+.LBE1091:
+.LBB1092:
+.LBI1092:
+	.loc 4 574 1 is_stmt 1 view .LVU1105
+.LBB1093:
+	.loc 4 576 3 view .LVU1106
+	.loc 4 576 3 is_stmt 0 view .LVU1107
+.LBE1093:
+.LBE1092:
+	.loc 1 257 5 is_stmt 1 view .LVU1108
+.LBB1095:
+.LBI1095:
+	.loc 4 433 1 view .LVU1109
+.LBB1096:
+	.loc 4 435 3 view .LVU1110
+.LBE1096:
+.LBE1095:
+.LBB1098:
+.LBB1094:
+	.loc 4 576 33 is_stmt 0 view .LVU1111
+	vpternlogq	$254, %ymm0, %ymm2, %ymm1
+.LVL364:
+	.loc 4 576 33 view .LVU1112
+.LBE1094:
+.LBE1098:
+.LBB1099:
+.LBB1097:
+	.loc 4 435 10 view .LVU1113
+	vpmovmskb	%ymm1, %ecx
+.LVL365:
+	.loc 4 435 10 view .LVU1114
+.LBE1097:
+.LBE1099:
+	.loc 1 258 5 is_stmt 1 view .LVU1115
+	.loc 1 258 8 is_stmt 0 view .LVU1116
+	testl	%ecx, %ecx
+	jne	.L265
+.LVL366:
+.L250:
+	.loc 1 258 8 view .LVU1117
+.LBE1101:
+	.loc 1 252 21 is_stmt 1 discriminator 1 view .LVU1118
+	movq	%rdx, %rax
+	.loc 1 252 16 is_stmt 0 discriminator 1 view .LVU1119
+	leaq	32(%rdx), %rdx
+.LVL367:
+	.loc 1 252 21 discriminator 1 view .LVU1120
+	cmpq	%rdx, %rsi
+	jnb	.L252
+	.loc 1 262 3 is_stmt 1 view .LVU1121
+.LBB1102:
+.LBB1103:
+.LBB1104:
+.LBB1105:
+.LBB1106:
+	.loc 3 1427 19 is_stmt 0 view .LVU1122
+	movl	$31, %ecx
+	vpbroadcastb	%ecx, %xmm5
+.LBE1106:
+.LBE1105:
+.LBB1109:
+.LBB1110:
+	.loc 3 1335 34 view .LVU1123
+	movl	$34, %ecx
+	vpbroadcastb	%ecx, %xmm4
+.LBE1110:
+.LBE1109:
+.LBB1112:
+.LBB1113:
+	movl	$92, %ecx
+.LBE1113:
+.LBE1112:
+.LBE1104:
+.LBE1103:
+.LBE1102:
+	.loc 1 262 18 view .LVU1124
+	subq	%rax, %rsi
+.LVL368:
+.LBB1147:
+.LBI1102:
+	.loc 1 160 15 is_stmt 1 view .LVU1125
+.LBB1145:
+	.loc 1 164 10 is_stmt 0 view .LVU1126
+	xorl	%edx, %edx
+.LBB1139:
+.LBB1116:
+.LBB1117:
+	.loc 3 703 10 view .LVU1127
+	leaq	(%rdi,%rax), %r9
+.LBE1117:
+.LBE1116:
+.LBB1120:
+.LBB1114:
+	.loc 3 1335 34 view .LVU1128
+	vpbroadcastb	%ecx, %xmm3
+	jmp	.L253
+.LVL369:
+	.p2align 4,,10
+	.p2align 3
+.L255:
+	.loc 3 1335 34 view .LVU1129
+.LBE1114:
+.LBE1120:
+	.loc 1 166 5 is_stmt 1 view .LVU1130
+.LBB1121:
+.LBI1116:
+	.loc 3 701 1 view .LVU1131
+.LBB1118:
+	.loc 3 703 3 view .LVU1132
+	.loc 3 703 3 is_stmt 0 view .LVU1133
+.LBE1118:
+.LBE1121:
+	.loc 1 168 5 is_stmt 1 view .LVU1134
+.LBB1122:
+.LBI1105:
+	.loc 3 1425 1 view .LVU1135
+.LBB1107:
+	.loc 3 1427 3 view .LVU1136
+.LBE1107:
+.LBE1122:
+.LBB1123:
+.LBB1119:
+	.loc 3 703 10 is_stmt 0 view .LVU1137
+	vmovdqu	-16(%r9,%rdx), %xmm0
+.LBE1119:
+.LBE1123:
+.LBB1124:
+.LBB1108:
+	.loc 3 1427 19 view .LVU1138
+	vpminub	%xmm0, %xmm5, %xmm1
+.LVL370:
+	.loc 3 1427 19 view .LVU1139
+.LBE1108:
+.LBE1124:
+.LBB1125:
+.LBI1125:
+	.loc 3 1333 1 is_stmt 1 view .LVU1140
+.LBB1126:
+	.loc 3 1335 3 view .LVU1141
+	.loc 3 1335 34 is_stmt 0 view .LVU1142
+	vpcmpeqb	%xmm1, %xmm0, %xmm1
+.LVL371:
+	.loc 3 1335 34 view .LVU1143
+.LBE1126:
+.LBE1125:
+	.loc 1 169 5 is_stmt 1 view .LVU1144
+.LBB1127:
+.LBI1109:
+	.loc 3 1333 1 view .LVU1145
+.LBB1111:
+	.loc 3 1335 3 view .LVU1146
+	.loc 3 1335 34 is_stmt 0 view .LVU1147
+	vpcmpeqb	%xmm4, %xmm0, %xmm2
+.LVL372:
+	.loc 3 1335 34 view .LVU1148
+.LBE1111:
+.LBE1127:
+.LBB1128:
+.LBI1128:
+	.loc 3 1321 1 is_stmt 1 view .LVU1149
+.LBB1129:
+	.loc 3 1323 3 view .LVU1150
+	.loc 3 1323 3 is_stmt 0 view .LVU1151
+.LBE1129:
+.LBE1128:
+	.loc 1 170 5 is_stmt 1 view .LVU1152
+.LBB1130:
+.LBI1112:
+	.loc 3 1333 1 view .LVU1153
+.LBB1115:
+	.loc 3 1335 3 view .LVU1154
+	.loc 3 1335 34 is_stmt 0 view .LVU1155
+	vpcmpeqb	%xmm3, %xmm0, %xmm0
+.LVL373:
+	.loc 3 1335 34 view .LVU1156
+.LBE1115:
+.LBE1130:
+.LBB1131:
+.LBI1131:
+	.loc 3 1321 1 is_stmt 1 view .LVU1157
+.LBB1132:
+	.loc 3 1323 3 view .LVU1158
+	.loc 3 1323 3 is_stmt 0 view .LVU1159
+.LBE1132:
+.LBE1131:
+	.loc 1 171 5 is_stmt 1 view .LVU1160
+.LBB1134:
+.LBI1134:
+	.loc 3 1431 1 view .LVU1161
+.LBB1135:
+	.loc 3 1433 3 view .LVU1162
+.LBE1135:
+.LBE1134:
+.LBB1137:
+.LBB1133:
+	.loc 3 1323 33 is_stmt 0 view .LVU1163
+	vpternlogq	$254, %xmm2, %xmm0, %xmm1
+.LVL374:
+	.loc 3 1323 33 view .LVU1164
+.LBE1133:
+.LBE1137:
+.LBB1138:
+.LBB1136:
+	.loc 3 1433 10 view .LVU1165
+	vpmovmskb	%xmm1, %r8d
+.LVL375:
+	.loc 3 1433 10 view .LVU1166
+.LBE1136:
+.LBE1138:
+	.loc 1 172 5 is_stmt 1 view .LVU1167
+	.loc 1 172 8 is_stmt 0 view .LVU1168
+	testl	%r8d, %r8d
+	jne	.L266
+.LVL376:
+.L253:
+	.loc 1 172 8 view .LVU1169
+.LBE1139:
+	.loc 1 165 21 is_stmt 1 view .LVU1170
+	movq	%rdx, %rcx
+	.loc 1 165 16 is_stmt 0 view .LVU1171
+	leaq	16(%rdx), %rdx
+.LVL377:
+	.loc 1 165 21 view .LVU1172
+	cmpq	%rdx, %rsi
+	jnb	.L255
+	.loc 1 176 3 is_stmt 1 view .LVU1173
+.LVL378:
+.LBB1140:
+.LBI1140:
+	.loc 1 81 15 view .LVU1174
+.LBB1141:
+	.loc 1 82 3 view .LVU1175
+	.loc 1 83 3 view .LVU1176
+	.loc 1 83 25 view .LVU1177
+	subq	%rcx, %rsi
+.LVL379:
+	.loc 1 83 25 is_stmt 0 view .LVU1178
+	je	.L254
+	leaq	(%rax,%rcx), %r8
+	movq	st_char_classes@GOTPCREL(%rip), %r9
+	.loc 1 82 10 view .LVU1179
+	xorl	%edx, %edx
+	.loc 1 83 45 view .LVU1180
+	addq	%r8, %rdi
+.LVL380:
+	.loc 1 83 45 view .LVU1181
+	jmp	.L256
+.LVL381:
+	.p2align 4,,10
+	.p2align 3
+.L258:
+	.loc 1 84 5 is_stmt 1 view .LVU1182
+	.loc 1 84 10 is_stmt 0 view .LVU1183
+	incq	%rdx
+.LVL382:
+	.loc 1 83 25 is_stmt 1 view .LVU1184
+	cmpq	%rdx, %rsi
+	je	.L267
+.LVL383:
+.L256:
+.LBB1142:
+.LBI1142:
+	.loc 2 202 19 view .LVU1185
+.LBB1143:
+	.loc 2 203 3 view .LVU1186
+	.loc 2 203 26 is_stmt 0 view .LVU1187
+	movzbl	(%rdi,%rdx), %r8d
+.LBE1143:
+.LBE1142:
+	.loc 1 83 25 view .LVU1188
+	testb	$32, (%r9,%r8)
+	je	.L258
+	addq	%rdx, %rcx
+.LVL384:
+	.loc 1 86 3 is_stmt 1 view .LVU1189
+.L254:
+	.loc 1 86 3 is_stmt 0 view .LVU1190
+.LBE1141:
+.LBE1140:
+.LBE1145:
+.LBE1147:
+	.loc 1 262 16 view .LVU1191
+	addq	%rcx, %rax
+.LVL385:
+	.loc 1 262 16 view .LVU1192
+	vzeroupper
+.LVL386:
+	.loc 1 263 1 view .LVU1193
+	ret
+.LVL387:
+	.p2align 4,,10
+	.p2align 3
+.L265:
+.LBB1148:
+	.loc 1 259 7 is_stmt 1 view .LVU1194
+	.loc 1 259 22 is_stmt 0 view .LVU1195
+	tzcntl	%ecx, %ecx
+.LVL388:
+	.loc 1 259 20 view .LVU1196
+	addq	%rcx, %rax
+.LVL389:
+	.loc 1 259 20 view .LVU1197
+	vzeroupper
+.LVL390:
+	.loc 1 259 20 view .LVU1198
+.LBE1148:
+	.loc 1 263 1 view .LVU1199
+	ret
+.LVL391:
+	.p2align 4,,10
+	.p2align 3
+.L266:
+.LBB1149:
+.LBB1146:
+.LBB1144:
+	.loc 1 173 7 is_stmt 1 view .LVU1200
+	.loc 1 173 22 is_stmt 0 view .LVU1201
+	tzcntl	%r8d, %r8d
+.LVL392:
+	.loc 1 173 20 view .LVU1202
+	addq	%r8, %rcx
+.LVL393:
+	.loc 1 173 20 view .LVU1203
+	jmp	.L254
+.LVL394:
+	.p2align 4,,10
+	.p2align 3
+.L267:
+	.loc 1 173 20 view .LVU1204
+.LBE1144:
+	.loc 1 176 16 view .LVU1205
+	addq	%rsi, %rcx
+.LVL395:
+	.loc 1 176 16 view .LVU1206
+	jmp	.L254
+.LBE1146:
+.LBE1149:
+	.cfi_endproc
+.LFE6418:
+	.size	st_scan_escape_avx2, .-st_scan_escape_avx2
+	.p2align 4
+	.type	st_scan_escape_avx512, @function
+st_scan_escape_avx512:
+.LVL396:
+.LFB6422:
+	.loc 1 331 78 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 332 3 view .LVU1208
+	.loc 1 333 3 view .LVU1209
+	.loc 1 334 3 view .LVU1210
+	.loc 1 335 3 view .LVU1211
+	.loc 1 336 3 view .LVU1212
+.LBB1201:
+.LBB1202:
+.LBB1203:
+	.loc 7 2581 10 is_stmt 0 view .LVU1213
+	movl	$32, %eax
+	vpbroadcastb	%eax, %zmm3
+.LBE1203:
+.LBE1202:
+.LBB1206:
+.LBB1207:
+	.loc 7 1655 10 view .LVU1214
+	movl	$34, %eax
+	vpbroadcastb	%eax, %zmm2
+.LBE1207:
+.LBE1206:
+.LBB1209:
+.LBB1210:
+	movl	$92, %eax
+.LBE1210:
+.LBE1209:
+.LBE1201:
+	.loc 1 331 78 view .LVU1215
+	movq	%rdi, %r8
+	.loc 1 335 10 view .LVU1216
+	xorl	%ecx, %ecx
+.LBB1224:
+.LBB1214:
+.LBB1211:
+	.loc 7 1655 10 view .LVU1217
+	vpbroadcastb	%eax, %zmm1
+.LBE1211:
+.LBE1214:
+.LBE1224:
+	.loc 1 336 3 view .LVU1218
+	jmp	.L269
+.LVL397:
+	.p2align 4,,10
+	.p2align 3
+.L271:
+.LBB1225:
+	.loc 1 337 5 is_stmt 1 view .LVU1219
+.LBB1215:
+.LBI1215:
+	.loc 6 6490 1 view .LVU1220
+.LBB1216:
+	.loc 6 6492 3 view .LVU1221
+	.loc 6 6492 3 is_stmt 0 view .LVU1222
+.LBE1216:
+.LBE1215:
+	.loc 1 338 5 is_stmt 1 view .LVU1223
+.LBB1218:
+.LBI1202:
+	.loc 7 2579 1 view .LVU1224
+.LBB1204:
+	.loc 7 2581 3 view .LVU1225
+.LBE1204:
+.LBE1218:
+.LBB1219:
+.LBB1217:
+	.loc 6 6492 10 is_stmt 0 view .LVU1226
+	vmovdqu64	-64(%r8,%rcx), %zmm0
+.LBE1217:
+.LBE1219:
+.LBB1220:
+.LBB1205:
+	.loc 7 2581 10 view .LVU1227
+	vpcmpub	$1, %zmm3, %zmm0, %k0
+.LVL398:
+	.loc 7 2581 10 view .LVU1228
+.LBE1205:
+.LBE1220:
+	.loc 1 339 5 is_stmt 1 view .LVU1229
+.LBB1221:
+.LBI1206:
+	.loc 7 1653 1 view .LVU1230
+.LBB1208:
+	.loc 7 1655 3 view .LVU1231
+	.loc 7 1655 10 is_stmt 0 view .LVU1232
+	vpcmpb	$0, %zmm2, %zmm0, %k1
+.LVL399:
+	.loc 7 1655 10 view .LVU1233
+.LBE1208:
+.LBE1221:
+.LBB1222:
+.LBI1209:
+	.loc 7 1653 1 is_stmt 1 view .LVU1234
+.LBB1212:
+	.loc 7 1655 3 view .LVU1235
+	.loc 7 1655 10 is_stmt 0 view .LVU1236
+	vpcmpb	$0, %zmm1, %zmm0, %k2
+.LBE1212:
+.LBE1222:
+	.loc 1 339 10 view .LVU1237
+	kmovq	%k0, %r10
+	kmovq	%k1, %rdx
+	orq	%r10, %rdx
+.LBB1223:
+.LBB1213:
+	.loc 7 1655 10 view .LVU1238
+	kmovq	%k2, %rdi
+.LVL400:
+	.loc 7 1655 10 view .LVU1239
+.LBE1213:
+.LBE1223:
+	.loc 1 340 5 is_stmt 1 view .LVU1240
+	.loc 1 340 8 is_stmt 0 view .LVU1241
+	orq	%rdi, %rdx
+.LVL401:
+	.loc 1 340 8 view .LVU1242
+	jne	.L289
+.LVL402:
+.L269:
+	.loc 1 340 8 view .LVU1243
+.LBE1225:
+	.loc 1 336 21 is_stmt 1 discriminator 1 view .LVU1244
+	movq	%rcx, %rax
+	.loc 1 336 16 is_stmt 0 discriminator 1 view .LVU1245
+	leaq	64(%rcx), %rcx
+.LVL403:
+	.loc 1 336 21 discriminator 1 view .LVU1246
+	cmpq	%rcx, %rsi
+	jnb	.L271
+	.loc 1 344 3 is_stmt 1 view .LVU1247
+.LBB1226:
+.LBB1227:
+.LBB1228:
+.LBB1229:
+.LBB1230:
+	.loc 4 414 19 is_stmt 0 view .LVU1248
+	movl	$31, %ecx
+	vpbroadcastb	%ecx, %ymm5
+.LBE1230:
+.LBE1229:
+.LBB1233:
+.LBB1234:
+	.loc 4 233 34 view .LVU1249
+	movl	$34, %ecx
+	vpbroadcastb	%ecx, %ymm4
+.LBE1234:
+.LBE1233:
+.LBB1236:
+.LBB1237:
+	movl	$92, %ecx
+.LBE1237:
+.LBE1236:
+.LBE1228:
+.LBE1227:
+.LBE1226:
+	.loc 1 344 18 view .LVU1250
+	subq	%rax, %rsi
+.LVL404:
+.LBB1320:
+.LBI1226:
+	.loc 1 247 15 is_stmt 1 view .LVU1251
+.LBB1317:
+	.loc 1 251 10 is_stmt 0 view .LVU1252
+	xorl	%edx, %edx
+.LBB1263:
+.LBB1240:
+.LBB1241:
+	.loc 5 929 10 view .LVU1253
+	leaq	(%r8,%rax), %r9
+.LBE1241:
+.LBE1240:
+.LBB1244:
+.LBB1238:
+	.loc 4 233 34 view .LVU1254
+	vpbroadcastb	%ecx, %ymm3
+	jmp	.L272
+.LVL405:
+	.p2align 4,,10
+	.p2align 3
+.L274:
+	.loc 4 233 34 view .LVU1255
+.LBE1238:
+.LBE1244:
+	.loc 1 253 5 is_stmt 1 view .LVU1256
+.LBB1245:
+.LBI1240:
+	.loc 5 927 1 view .LVU1257
+.LBB1242:
+	.loc 5 929 3 view .LVU1258
+	.loc 5 929 3 is_stmt 0 view .LVU1259
+.LBE1242:
+.LBE1245:
+	.loc 1 254 5 is_stmt 1 view .LVU1260
+.LBB1246:
+.LBI1229:
+	.loc 4 412 1 view .LVU1261
+.LBB1231:
+	.loc 4 414 3 view .LVU1262
+.LBE1231:
+.LBE1246:
+.LBB1247:
+.LBB1243:
+	.loc 5 929 10 is_stmt 0 view .LVU1263
+	vmovdqu	-32(%r9,%rdx), %ymm0
+.LBE1243:
+.LBE1247:
+.LBB1248:
+.LBB1232:
+	.loc 4 414 19 view .LVU1264
+	vpminub	%ymm0, %ymm5, %ymm1
+.LVL406:
+	.loc 4 414 19 view .LVU1265
+.LBE1232:
+.LBE1248:
+.LBB1249:
+.LBI1249:
+	.loc 4 231 1 is_stmt 1 view .LVU1266
+.LBB1250:
+	.loc 4 233 3 view .LVU1267
+	.loc 4 233 34 is_stmt 0 view .LVU1268
+	vpcmpeqb	%ymm1, %ymm0, %ymm1
+.LVL407:
+	.loc 4 233 34 view .LVU1269
+.LBE1250:
+.LBE1249:
+	.loc 1 255 5 is_stmt 1 view .LVU1270
+.LBB1251:
+.LBI1233:
+	.loc 4 231 1 view .LVU1271
+.LBB1235:
+	.loc 4 233 3 view .LVU1272
+	.loc 4 233 34 is_stmt 0 view .LVU1273
+	vpcmpeqb	%ymm4, %ymm0, %ymm2
+.LVL408:
+	.loc 4 233 34 view .LVU1274
+.LBE1235:
+.LBE1251:
+.LBB1252:
+.LBI1252:
+	.loc 4 574 1 is_stmt 1 view .LVU1275
+.LBB1253:
+	.loc 4 576 3 view .LVU1276
+	.loc 4 576 3 is_stmt 0 view .LVU1277
+.LBE1253:
+.LBE1252:
+	.loc 1 256 5 is_stmt 1 view .LVU1278
+.LBB1254:
+.LBI1236:
+	.loc 4 231 1 view .LVU1279
+.LBB1239:
+	.loc 4 233 3 view .LVU1280
+	.loc 4 233 34 is_stmt 0 view .LVU1281
+	vpcmpeqb	%ymm3, %ymm0, %ymm0
+.LVL409:
+	.loc 4 233 34 view .LVU1282
+.LBE1239:
+.LBE1254:
+.LBB1255:
+.LBI1255:
+	.loc 4 574 1 is_stmt 1 view .LVU1283
+.LBB1256:
+	.loc 4 576 3 view .LVU1284
+	.loc 4 576 3 is_stmt 0 view .LVU1285
+.LBE1256:
+.LBE1255:
+	.loc 1 257 5 is_stmt 1 view .LVU1286
+.LBB1258:
+.LBI1258:
+	.loc 4 433 1 view .LVU1287
+.LBB1259:
+	.loc 4 435 3 view .LVU1288
+.LBE1259:
+.LBE1258:
+.LBB1261:
+.LBB1257:
+	.loc 4 576 33 is_stmt 0 view .LVU1289
+	vpternlogq	$254, %ymm2, %ymm0, %ymm1
+.LVL410:
+	.loc 4 576 33 view .LVU1290
+.LBE1257:
+.LBE1261:
+.LBB1262:
+.LBB1260:
+	.loc 4 435 10 view .LVU1291
+	vpmovmskb	%ymm1, %edi
+.LVL411:
+	.loc 4 435 10 view .LVU1292
+.LBE1260:
+.LBE1262:
+	.loc 1 258 5 is_stmt 1 view .LVU1293
+	.loc 1 258 8 is_stmt 0 view .LVU1294
+	testl	%edi, %edi
+	jne	.L290
+.LVL412:
+.L272:
+	.loc 1 258 8 view .LVU1295
+.LBE1263:
+	.loc 1 252 21 is_stmt 1 view .LVU1296
+	movq	%rdx, %rcx
+	.loc 1 252 16 is_stmt 0 view .LVU1297
+	leaq	32(%rdx), %rdx
+.LVL413:
+	.loc 1 252 21 view .LVU1298
+	cmpq	%rdx, %rsi
+	jnb	.L274
+.LBB1264:
+.LBB1265:
+.LBB1266:
+.LBB1267:
+.LBB1268:
+	.loc 3 1427 19 view .LVU1299
+	movl	$31, %edi
+	vpbroadcastb	%edi, %xmm5
+.LBE1268:
+.LBE1267:
+.LBB1271:
+.LBB1272:
+	.loc 3 1335 34 view .LVU1300
+	movl	$34, %edi
+	leaq	-32(%rdx,%rax), %r10
+.LBE1272:
+.LBE1271:
+.LBE1266:
+.LBE1265:
+.LBE1264:
+	.loc 1 262 3 is_stmt 1 view .LVU1301
+.LBB1313:
+.LBB1310:
+.LBB1303:
+.LBB1275:
+.LBB1273:
+	.loc 3 1335 34 is_stmt 0 view .LVU1302
+	vpbroadcastb	%edi, %xmm4
+.LBE1273:
+.LBE1275:
+.LBB1276:
+.LBB1277:
+	movl	$92, %edi
+.LBE1277:
+.LBE1276:
+.LBE1303:
+.LBE1310:
+.LBE1313:
+	.loc 1 262 18 view .LVU1303
+	subq	%rcx, %rsi
+.LVL414:
+.LBB1314:
+.LBI1264:
+	.loc 1 160 15 is_stmt 1 view .LVU1304
+.LBB1311:
+	.loc 1 164 10 is_stmt 0 view .LVU1305
+	xorl	%edx, %edx
+.LBB1304:
+.LBB1280:
+.LBB1281:
+	.loc 3 703 10 view .LVU1306
+	leaq	(%r8,%r10), %r11
+.LBE1281:
+.LBE1280:
+.LBB1284:
+.LBB1278:
+	.loc 3 1335 34 view .LVU1307
+	vpbroadcastb	%edi, %xmm3
+	jmp	.L275
+.LVL415:
+	.p2align 4,,10
+	.p2align 3
+.L277:
+	.loc 3 1335 34 view .LVU1308
+.LBE1278:
+.LBE1284:
+	.loc 1 166 5 is_stmt 1 view .LVU1309
+.LBB1285:
+.LBI1280:
+	.loc 3 701 1 view .LVU1310
+.LBB1282:
+	.loc 3 703 3 view .LVU1311
+	.loc 3 703 3 is_stmt 0 view .LVU1312
+.LBE1282:
+.LBE1285:
+	.loc 1 168 5 is_stmt 1 view .LVU1313
+.LBB1286:
+.LBI1267:
+	.loc 3 1425 1 view .LVU1314
+.LBB1269:
+	.loc 3 1427 3 view .LVU1315
+.LBE1269:
+.LBE1286:
+.LBB1287:
+.LBB1283:
+	.loc 3 703 10 is_stmt 0 view .LVU1316
+	vmovdqu	-16(%r11,%rdx), %xmm0
+.LBE1283:
+.LBE1287:
+.LBB1288:
+.LBB1270:
+	.loc 3 1427 19 view .LVU1317
+	vpminub	%xmm0, %xmm5, %xmm1
+.LVL416:
+	.loc 3 1427 19 view .LVU1318
+.LBE1270:
+.LBE1288:
+.LBB1289:
+.LBI1289:
+	.loc 3 1333 1 is_stmt 1 view .LVU1319
+.LBB1290:
+	.loc 3 1335 3 view .LVU1320
+	.loc 3 1335 34 is_stmt 0 view .LVU1321
+	vpcmpeqb	%xmm1, %xmm0, %xmm1
+.LVL417:
+	.loc 3 1335 34 view .LVU1322
+.LBE1290:
+.LBE1289:
+	.loc 1 169 5 is_stmt 1 view .LVU1323
+.LBB1291:
+.LBI1271:
+	.loc 3 1333 1 view .LVU1324
+.LBB1274:
+	.loc 3 1335 3 view .LVU1325
+	.loc 3 1335 34 is_stmt 0 view .LVU1326
+	vpcmpeqb	%xmm4, %xmm0, %xmm2
+.LVL418:
+	.loc 3 1335 34 view .LVU1327
+.LBE1274:
+.LBE1291:
+.LBB1292:
+.LBI1292:
+	.loc 3 1321 1 is_stmt 1 view .LVU1328
+.LBB1293:
+	.loc 3 1323 3 view .LVU1329
+	.loc 3 1323 3 is_stmt 0 view .LVU1330
+.LBE1293:
+.LBE1292:
+	.loc 1 170 5 is_stmt 1 view .LVU1331
+.LBB1294:
+.LBI1276:
+	.loc 3 1333 1 view .LVU1332
+.LBB1279:
+	.loc 3 1335 3 view .LVU1333
+	.loc 3 1335 34 is_stmt 0 view .LVU1334
+	vpcmpeqb	%xmm3, %xmm0, %xmm0
+.LVL419:
+	.loc 3 1335 34 view .LVU1335
+.LBE1279:
+.LBE1294:
+.LBB1295:
+.LBI1295:
+	.loc 3 1321 1 is_stmt 1 view .LVU1336
+.LBB1296:
+	.loc 3 1323 3 view .LVU1337
+	.loc 3 1323 3 is_stmt 0 view .LVU1338
+.LBE1296:
+.LBE1295:
+	.loc 1 171 5 is_stmt 1 view .LVU1339
+.LBB1298:
+.LBI1298:
+	.loc 3 1431 1 view .LVU1340
+.LBB1299:
+	.loc 3 1433 3 view .LVU1341
+.LBE1299:
+.LBE1298:
+.LBB1301:
+.LBB1297:
+	.loc 3 1323 33 is_stmt 0 view .LVU1342
+	vpternlogq	$254, %xmm2, %xmm0, %xmm1
+.LVL420:
+	.loc 3 1323 33 view .LVU1343
+.LBE1297:
+.LBE1301:
+.LBB1302:
+.LBB1300:
+	.loc 3 1433 10 view .LVU1344
+	vpmovmskb	%xmm1, %r9d
+.LVL421:
+	.loc 3 1433 10 view .LVU1345
+.LBE1300:
+.LBE1302:
+	.loc 1 172 5 is_stmt 1 view .LVU1346
+	.loc 1 172 8 is_stmt 0 view .LVU1347
+	testl	%r9d, %r9d
+	jne	.L291
+.LVL422:
+.L275:
+	.loc 1 172 8 view .LVU1348
+.LBE1304:
+	.loc 1 165 21 is_stmt 1 view .LVU1349
+	movq	%rdx, %rdi
+	.loc 1 165 16 is_stmt 0 view .LVU1350
+	leaq	16(%rdx), %rdx
+.LVL423:
+	.loc 1 165 21 view .LVU1351
+	cmpq	%rdx, %rsi
+	jnb	.L277
+	.loc 1 176 3 is_stmt 1 view .LVU1352
+.LVL424:
+.LBB1305:
+.LBI1305:
+	.loc 1 81 15 view .LVU1353
+.LBB1306:
+	.loc 1 82 3 view .LVU1354
+	.loc 1 83 3 view .LVU1355
+	.loc 1 83 25 view .LVU1356
+	subq	%rdi, %rsi
+.LVL425:
+	.loc 1 83 25 is_stmt 0 view .LVU1357
+	je	.L276
+	leaq	(%rdi,%r10), %r9
+	movq	st_char_classes@GOTPCREL(%rip), %r11
+	.loc 1 82 10 view .LVU1358
+	xorl	%edx, %edx
+	.loc 1 83 45 view .LVU1359
+	addq	%r9, %r8
+.LVL426:
+	.loc 1 83 45 view .LVU1360
+	jmp	.L278
+.LVL427:
+	.p2align 4,,10
+	.p2align 3
+.L280:
+	.loc 1 84 5 is_stmt 1 view .LVU1361
+	.loc 1 84 10 is_stmt 0 view .LVU1362
+	incq	%rdx
+.LVL428:
+	.loc 1 83 25 is_stmt 1 view .LVU1363
+	cmpq	%rdx, %rsi
+	je	.L292
+.LVL429:
+.L278:
+.LBB1307:
+.LBI1307:
+	.loc 2 202 19 view .LVU1364
+.LBB1308:
+	.loc 2 203 3 view .LVU1365
+	.loc 2 203 26 is_stmt 0 view .LVU1366
+	movzbl	(%r8,%rdx), %r9d
+.LBE1308:
+.LBE1307:
+	.loc 1 83 25 view .LVU1367
+	testb	$32, (%r11,%r9)
+	je	.L280
+	addq	%rdx, %rdi
+.LVL430:
+	.loc 1 86 3 is_stmt 1 view .LVU1368
+.L276:
+	.loc 1 86 3 is_stmt 0 view .LVU1369
+.LBE1306:
+.LBE1305:
+.LBE1311:
+.LBE1314:
+	.loc 1 262 16 view .LVU1370
+	addq	%rdi, %rcx
+.LVL431:
+	.loc 1 262 16 view .LVU1371
+	jmp	.L273
+.LVL432:
+	.p2align 4,,10
+	.p2align 3
+.L289:
+	.loc 1 262 16 view .LVU1372
+.LBE1317:
+.LBE1320:
+.LBB1321:
+	.loc 1 341 7 is_stmt 1 view .LVU1373
+	.loc 1 341 22 is_stmt 0 view .LVU1374
+	tzcntq	%rdx, %rdx
+.LVL433:
+	.loc 1 341 20 view .LVU1375
+	addq	%rdx, %rax
+.LVL434:
+	.loc 1 341 20 view .LVU1376
+	vzeroupper
+.LVL435:
+	.loc 1 341 20 view .LVU1377
+.LBE1321:
+	.loc 1 345 1 view .LVU1378
+	ret
+.LVL436:
+	.p2align 4,,10
+	.p2align 3
+.L290:
+.LBB1322:
+.LBB1318:
+.LBB1315:
+	.loc 1 259 7 is_stmt 1 view .LVU1379
+	.loc 1 259 22 is_stmt 0 view .LVU1380
+	tzcntl	%edi, %edi
+.LVL437:
+	.loc 1 259 20 view .LVU1381
+	addq	%rdi, %rcx
+.LVL438:
+.L273:
+	.loc 1 259 20 view .LVU1382
+.LBE1315:
+.LBE1318:
+.LBE1322:
+	.loc 1 344 16 view .LVU1383
+	addq	%rcx, %rax
+.LVL439:
+	.loc 1 344 16 view .LVU1384
+	vzeroupper
+.LVL440:
+	.loc 1 345 1 view .LVU1385
+	ret
+.LVL441:
+	.p2align 4,,10
+	.p2align 3
+.L291:
+.LBB1323:
+.LBB1319:
+.LBB1316:
+.LBB1312:
+.LBB1309:
+	.loc 1 173 7 is_stmt 1 view .LVU1386
+	.loc 1 173 22 is_stmt 0 view .LVU1387
+	tzcntl	%r9d, %r9d
+.LVL442:
+	.loc 1 173 20 view .LVU1388
+	addq	%r9, %rdi
+.LVL443:
+	.loc 1 173 20 view .LVU1389
+	jmp	.L276
+.LVL444:
+.L292:
+	.loc 1 173 20 view .LVU1390
+.LBE1309:
+	.loc 1 176 16 view .LVU1391
+	addq	%rsi, %rdi
+.LVL445:
+	.loc 1 176 16 view .LVU1392
+	jmp	.L276
+.LBE1312:
+.LBE1316:
+.LBE1319:
+.LBE1323:
+	.cfi_endproc
+.LFE6422:
+	.size	st_scan_escape_avx512, .-st_scan_escape_avx512
+	.p2align 4
+	.globl	st_scan_isa_supported
+	.type	st_scan_isa_supported, @function
+st_scan_isa_supported:
+.LVL446:
+.LFB6423:
+	.loc 1 372 57 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 375 3 view .LVU1394
+	.loc 1 372 57 is_stmt 0 view .LVU1395
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 372 57 view .LVU1396
+	movl	%edi, %ebx
+	.loc 1 375 3 view .LVU1397
+	call	__cpu_indicator_init@PLT
+.LVL447:
+	.loc 1 377 3 is_stmt 1 view .LVU1398
+	cmpl	$2, %ebx
+	je	.L294
+	ja	.L295
+	.loc 1 379 14 is_stmt 0 view .LVU1399
+	movl	$1, %eax
+	.loc 1 377 3 view .LVU1400
+	testl	%ebx, %ebx
+	je	.L293
+.LBB1326:
+.LBI1326:
+	.loc 1 372 5 is_stmt 1 view .LVU1401
+.LVL448:
+.LBB1327:
+	.loc 1 382 7 view .LVU1402
+	.loc 1 382 49 is_stmt 0 view .LVU1403
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	movl	12(%rax), %eax
+	shrl	$4, %eax
+	andl	$1, %eax
+.LVL449:
+.L293:
+	.loc 1 382 49 view .LVU1404
+.LBE1327:
+.LBE1326:
+	.loc 1 391 1 view .LVU1405
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL450:
+	.loc 1 391 1 view .LVU1406
+	ret
+.LVL451:
+	.p2align 4,,10
+	.p2align 3
+.L295:
+	.cfi_restore_state
+	.loc 1 377 3 view .LVU1407
+	xorl	%eax, %eax
+	cmpl	$3, %ebx
+	jne	.L293
+	.loc 1 386 7 is_stmt 1 view .LVU1408
+	.loc 1 386 48 is_stmt 0 view .LVU1409
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	.loc 1 391 1 view .LVU1410
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL452:
+	.loc 1 386 48 view .LVU1411
+	movl	12(%rax), %eax
+	andl	$2129920, %eax
+	.loc 1 386 90 view .LVU1412
+	cmpl	$2129920, %eax
+	sete	%al
+	movzbl	%al, %eax
+	.loc 1 391 1 view .LVU1413
+	ret
+.LVL453:
+	.p2align 4,,10
+	.p2align 3
+.L294:
+	.cfi_restore_state
+	.loc 1 384 7 is_stmt 1 view .LVU1414
+	.loc 1 384 49 is_stmt 0 view .LVU1415
+	movq	__cpu_model@GOTPCREL(%rip), %rax
+	.loc 1 391 1 view .LVU1416
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL454:
+	.loc 1 384 49 view .LVU1417
+	movl	12(%rax), %eax
+	shrl	$10, %eax
+	andl	$1, %eax
+	.loc 1 391 1 view .LVU1418
+	ret
+	.cfi_endproc
+.LFE6423:
+	.size	st_scan_isa_supported, .-st_scan_isa_supported
+	.p2align 4
+	.globl	st_scan_set_isa
+	.type	st_scan_set_isa, @function
+st_scan_set_isa:
+.LVL455:
+.LFB6424:
+	.loc 1 396 51 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 397 3 view .LVU1420
+	.loc 1 396 51 is_stmt 0 view .LVU1421
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 396 51 view .LVU1422
+	movl	%edi, %ebx
+	.loc 1 397 7 view .LVU1423
+	call	st_scan_isa_supported@PLT
+.LVL456:
+	.loc 1 397 6 view .LVU1424
+	testl	%eax, %eax
+	je	.L303
+.LVL457:
+.LBB1330:
+.LBI1330:
+	.loc 1 396 5 is_stmt 1 view .LVU1425
+.LBB1331:
+	.loc 1 400 3 view .LVU1426
+	leaq	st_scan_avx2_kernels(%rip), %rax
+	cmpl	$2, %ebx
+	je	.L305
+	leaq	st_scan_avx512_kernels(%rip), %rax
+	cmpl	$3, %ebx
+	je	.L305
+	cmpl	$1, %ebx
+	leaq	st_scan_sse2_kernels(%rip), %rax
+	leaq	st_scan_scalar_kernels(%rip), %rdx
+	cmovne	%rdx, %rax
+.L305:
+	.loc 1 416 23 is_stmt 0 view .LVU1427
+	movl	%ebx, st_scan_current_isa(%rip)
+	.loc 1 403 23 view .LVU1428
+	movq	%rax, st_scan_kernels(%rip)
+	.loc 1 416 3 is_stmt 1 view .LVU1429
+	.loc 1 417 3 view .LVU1430
+.LVL458:
+	.loc 1 416 23 is_stmt 0 view .LVU1431
+	movl	$1, %eax
+.L303:
+	.loc 1 416 23 view .LVU1432
+.LBE1331:
+.LBE1330:
+	.loc 1 418 1 view .LVU1433
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL459:
+	.loc 1 418 1 view .LVU1434
+	ret
+	.cfi_endproc
+.LFE6424:
+	.size	st_scan_set_isa, .-st_scan_set_isa
+	.p2align 4
+	.globl	st_scan_isa
+	.type	st_scan_isa, @function
+st_scan_isa:
+.LFB6425:
+	.loc 1 423 34 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 424 3 view .LVU1436
+	.loc 1 425 1 is_stmt 0 view .LVU1437
+	movl	st_scan_current_isa(%rip), %eax
+	ret
+	.cfi_endproc
+.LFE6425:
+	.size	st_scan_isa, .-st_scan_isa
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.type	st_scan_init, @function
+st_scan_init:
+.LFB6426:
+	.loc 1 431 28 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 432 3 view .LVU1439
+.LVL460:
+	.loc 1 433 3 view .LVU1440
+	.loc 1 433 32 view .LVU1441
+	.loc 1 431 28 is_stmt 0 view .LVU1442
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 432 22 view .LVU1443
+	movl	$3, %ebx
+.LVL461:
+.L317:
+	.loc 1 433 35 discriminator 1 view .LVU1444
+	movl	%ebx, %edi
+	call	st_scan_set_isa@PLT
+.LVL462:
+	.loc 1 433 32 discriminator 1 view .LVU1445
+	testl	%eax, %eax
+	jne	.L323
+	.loc 1 434 5 is_stmt 1 view .LVU1446
+.LVL463:
+	.loc 1 433 32 view .LVU1447
+	decl	%ebx
+.LVL464:
+	.loc 1 433 32 is_stmt 0 view .LVU1448
+	jne	.L317
+.L323:
+	.loc 1 436 1 view .LVU1449
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL465:
+	.loc 1 436 1 view .LVU1450
+	ret
+	.cfi_endproc
+.LFE6426:
+	.size	st_scan_init, .-st_scan_init
+	.section	.init_array,"aw"
+	.align 8
+	.quad	st_scan_init
+	.text
+	.p2align 4
+	.globl	st_scan_delimiter
+	.type	st_scan_delimiter, @function
+st_scan_delimiter:
+.LVL466:
+.LFB6427:
+	.loc 1 441 85 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 442 3 view .LVU1452
+	.loc 1 442 25 is_stmt 0 view .LVU1453
+	movq	st_scan_kernels(%rip), %rax
+	.loc 1 442 10 view .LVU1454
+	movsbl	%dl, %edx
+	.loc 1 442 10 view .LVU1455
+	jmp	*(%rax)
+.LVL467:
+	.loc 1 442 10 view .LVU1456
+	.cfi_endproc
+.LFE6427:
+	.size	st_scan_delimiter, .-st_scan_delimiter
+	.p2align 4
+	.globl	st_scan_non_whitespace
+	.type	st_scan_non_whitespace, @function
+st_scan_non_whitespace:
+.LVL468:
+.LFB6428:
+	.loc 1 448 72 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 449 3 view .LVU1458
+	.loc 1 449 25 is_stmt 0 view .LVU1459
+	movq	st_scan_kernels(%rip), %rax
+	.loc 1 449 10 view .LVU1460
+	jmp	*8(%rax)
+.LVL469:
+	.loc 1 449 10 view .LVU1461
+	.cfi_endproc
+.LFE6428:
+	.size	st_scan_non_whitespace, .-st_scan_non_whitespace
+	.p2align 4
+	.globl	st_scan_nul
+	.type	st_scan_nul, @function
+st_scan_nul:
+.LVL470:
+.LFB6429:
+	.loc 1 455 61 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 456 3 view .LVU1463
+	.loc 1 456 25 is_stmt 0 view .LVU1464
+	movq	st_scan_kernels(%rip), %rax
+	.loc 1 456 10 view .LVU1465
+	jmp	*16(%rax)
+.LVL471:
+	.loc 1 456 10 view .LVU1466
+	.cfi_endproc
+.LFE6429:
+	.size	st_scan_nul, .-st_scan_nul
+	.p2align 4
+	.globl	st_scan_escape
+	.type	st_scan_escape, @function
+st_scan_escape:
+.LVL472:
+.LFB6430:
+	.loc 1 462 64 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 463 3 view .LVU1468
+	.loc 1 463 25 is_stmt 0 view .LVU1469
+	movq	st_scan_kernels(%rip), %rax
+	.loc 1 463 10 view .LVU1470
+	jmp	*24(%rax)
+.LVL473:
+	.loc 1 463 10 view .LVU1471
+	.cfi_endproc
+.LFE6430:
+	.size	st_scan_escape, .-st_scan_escape
+	.p2align 4
+	.globl	st_scan_class
+	.type	st_scan_class, @function
+st_scan_class:
+.LVL474:
+.LFB6431:
+	.loc 1 469 105 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 470 3 view .LVU1473
+	.loc 1 472 3 view .LVU1474
+	.loc 1 470 10 is_stmt 0 view .LVU1475
+	xorl	%r8d, %r8d
+.LVL475:
+	.loc 1 472 20 is_stmt 1 view .LVU1476
+	.loc 1 469 105 is_stmt 0 view .LVU1477
+	movq	%rdx, %rcx
+	movq	%rsi, %r9
+	.loc 1 472 16 view .LVU1478
+	leaq	4(%r8), %rdx
+.LVL476:
+	.loc 1 472 20 view .LVU1479
+	cmpq	%rdx, %r9
+	jb	.L345
+.LVL477:
+	.p2align 4,,10
+	.p2align 3
+.L334:
+.LBB1332:
+	.loc 1 473 5 is_stmt 1 view .LVU1480
+	.loc 1 474 5 view .LVU1481
+	.loc 1 475 34 is_stmt 0 view .LVU1482
+	movzbl	-2(%rdi,%rdx), %eax
+	.loc 1 474 81 view .LVU1483
+	movzbl	-3(%rdi,%rdx), %esi
+	.loc 1 475 74 view .LVU1484
+	cmpb	$0, (%rcx,%rax)
+	setne	%al
+	movzbl	%al, %eax
+	sall	$2, %eax
+	.loc 1 474 121 view .LVU1485
+	cmpb	$0, (%rcx,%rsi)
+	setne	%sil
+	movzbl	%sil, %esi
+	addl	%esi, %esi
+	.loc 1 474 126 view .LVU1486
+	orl	%esi, %eax
+	.loc 1 474 34 view .LVU1487
+	movzbl	-4(%rdi,%rdx), %esi
+	.loc 1 474 64 view .LVU1488
+	cmpb	$0, (%rcx,%rsi)
+	setne	%sil
+	movzbl	%sil, %esi
+	.loc 1 474 126 view .LVU1489
+	orl	%esi, %eax
+	.loc 1 475 90 view .LVU1490
+	movzbl	-1(%rdi,%rdx), %esi
+	.loc 1 475 130 view .LVU1491
+	cmpb	$0, (%rcx,%rsi)
+	je	.L331
+	.loc 1 475 79 view .LVU1492
+	orl	$8, %eax
+.LVL478:
+	.loc 1 476 5 is_stmt 1 view .LVU1493
+.L332:
+	.loc 1 477 7 view .LVU1494
+	.loc 1 477 22 is_stmt 0 view .LVU1495
+	tzcntl	%eax, %eax
+.LVL479:
+	.loc 1 477 20 view .LVU1496
+	leaq	(%rax,%r8), %rdx
+.LVL480:
+.L329:
+	.loc 1 477 20 view .LVU1497
+.LBE1332:
+	.loc 1 484 1 view .LVU1498
+	movq	%rdx, %rax
+	ret
+.LVL481:
+	.p2align 4,,10
+	.p2align 3
+.L331:
+.LBB1333:
+	.loc 1 476 5 is_stmt 1 discriminator 8 view .LVU1499
+	.loc 1 476 8 is_stmt 0 discriminator 8 view .LVU1500
+	testl	%eax, %eax
+	jne	.L332
+.LBE1333:
+	.loc 1 472 16 view .LVU1501
+	movq	%rdx, %r8
+.LVL482:
+	.loc 1 472 20 is_stmt 1 view .LVU1502
+	.loc 1 472 16 is_stmt 0 view .LVU1503
+	leaq	4(%r8), %rdx
+	.loc 1 472 20 view .LVU1504
+	cmpq	%rdx, %r9
+	jnb	.L334
+.LVL483:
+.L345:
+	.loc 1 480 25 is_stmt 1 view .LVU1505
+	cmpq	%r9, %r8
+	jnb	.L339
+.LVL484:
+.LBB1334:
+.LBI1334:
+	.loc 2 217 19 view .LVU1506
+.LBB1335:
+	.loc 2 218 3 view .LVU1507
+	.loc 2 218 29 is_stmt 0 view .LVU1508
+	movzbl	(%rdi,%r8), %eax
+.LBE1335:
+.LBE1334:
+	.loc 1 480 25 view .LVU1509
+	cmpb	$0, (%rcx,%rax)
+	jne	.L339
+	.loc 1 481 5 is_stmt 1 view .LVU1510
+	.loc 1 481 10 is_stmt 0 view .LVU1511
+	leaq	1(%r8), %rax
+.LVL485:
+	.loc 1 480 25 is_stmt 1 view .LVU1512
+	cmpq	%r9, %rax
+	jnb	.L344
+.LVL486:
+.LBB1339:
+	.loc 2 217 19 view .LVU1513
+.LBB1336:
+	.loc 2 218 3 view .LVU1514
+	.loc 2 218 29 is_stmt 0 view .LVU1515
+	movzbl	1(%rdi,%r8), %esi
+.LBE1336:
+.LBE1339:
+	.loc 1 480 25 view .LVU1516
+	cmpb	$0, (%rcx,%rsi)
+	jne	.L344
+	.loc 1 481 5 is_stmt 1 view .LVU1517
+	.loc 1 481 10 is_stmt 0 view .LVU1518
+	leaq	2(%r8), %rax
+.LVL487:
+	.loc 1 480 25 is_stmt 1 view .LVU1519
+	cmpq	%r9, %rax
+	jnb	.L344
+.LVL488:
+.LBB1340:
+	.loc 2 217 19 view .LVU1520
+.LBB1337:
+	.loc 2 218 3 view .LVU1521
+	.loc 2 218 29 is_stmt 0 view .LVU1522
+	movzbl	2(%rdi,%r8), %esi
+.LBE1337:
+.LBE1340:
+	.loc 1 480 25 view .LVU1523
+	cmpb	$0, (%rcx,%rsi)
+	jne	.L344
+	.loc 1 481 5 is_stmt 1 view .LVU1524
+	.loc 1 481 10 is_stmt 0 view .LVU1525
+	leaq	3(%r8), %rax
+.LVL489:
+	.loc 1 480 25 is_stmt 1 view .LVU1526
+	cmpq	%r9, %rax
+	jnb	.L344
+.LVL490:
+.LBB1341:
+	.loc 2 217 19 discriminator 1 view .LVU1527
+.LBB1338:
+	.loc 2 218 3 discriminator 1 view .LVU1528
+	.loc 2 218 29 is_stmt 0 discriminator 1 view .LVU1529
+	movzbl	3(%rdi,%r8), %esi
+.LBE1338:
+.LBE1341:
+	.loc 1 481 10 discriminator 1 view .LVU1530
+	cmpb	$0, (%rcx,%rsi)
+	cmovne	%rax, %rdx
+	.loc 1 484 1 discriminator 1 view .LVU1531
+	movq	%rdx, %rax
+.LVL491:
+	.loc 1 484 1 discriminator 1 view .LVU1532
+	ret
+.LVL492:
+.L339:
+	.loc 1 480 25 view .LVU1533
+	movq	%r8, %rdx
+	jmp	.L329
+.LVL493:
+	.p2align 4,,10
+	.p2align 3
+.L344:
+	.loc 1 481 10 view .LVU1534
+	movq	%rax, %rdx
+	.loc 1 484 1 view .LVU1535
+	movq	%rdx, %rax
+	.loc 1 484 1 view .LVU1536
+	ret
+	.cfi_endproc
+.LFE6431:
+	.size	st_scan_class, .-st_scan_class
+	.local	st_scan_current_isa
+	.comm	st_scan_current_isa,4,4
+	.section	.data.rel.local,"aw"
+	.align 8
+	.type	st_scan_kernels, @object
+	.size	st_scan_kernels, 8
+st_scan_kernels:
+	.quad	st_scan_scalar_kernels
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	st_scan_avx512_kernels, @object
+	.size	st_scan_avx512_kernels, 32
+st_scan_avx512_kernels:
+	.quad	st_scan_delimiter_avx512
+	.quad	st_scan_non_whitespace_avx512
+	.quad	st_scan_nul_avx512
+	.quad	st_scan_escape_avx512
+	.align 32
+	.type	st_scan_avx2_kernels, @object
+	.size	st_scan_avx2_kernels, 32
+st_scan_avx2_kernels:
+	.quad	st_scan_delimiter_avx2
+	.quad	st_scan_non_whitespace_avx2
+	.quad	st_scan_nul_avx2
+	.quad	st_scan_escape_avx2
+	.align 32
+	.type	st_scan_sse2_kernels, @object
+	.size	st_scan_sse2_kernels, 32
+st_scan_sse2_kernels:
+	.quad	st_scan_delimiter_sse2
+	.quad	st_scan_non_whitespace_sse2
+	.quad	st_scan_nul_sse2
+	.quad	st_scan_escape_sse2
+	.align 32
+	.type	st_scan_scalar_kernels, @object
+	.size	st_scan_scalar_kernels, 32
+st_scan_scalar_kernels:
+	.quad	st_scan_delimiter_scalar
+	.quad	st_scan_non_whitespace_scalar
+	.quad	st_scan_nul_scalar
+	.quad	st_scan_escape_scalar
+	.text
+.Letext0:
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x40e4
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x37
+	.long	.LASF157
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL597
+	.quad	0
+	.long	.Ldebug_line0
+	.uleb128 0x12
+	.long	.LASF9
+	.byte	0x8
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3b
+	.uleb128 0x19
+	.long	0x2a
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x19
+	.long	0x65
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x12
+	.long	.LASF10
+	.byte	0x9
+	.byte	0x26
+	.byte	0x17
+	.long	0x57
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0x19
+	.long	0x8b
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF13
+	.uleb128 0x1e
+	.long	0xa3
+	.uleb128 0x39
+	.uleb128 0x12
+	.long	.LASF14
+	.byte	0xa
+	.byte	0x18
+	.byte	0x13
+	.long	0x78
+	.uleb128 0x19
+	.long	0xa4
+	.uleb128 0x1e
+	.long	0x92
+	.uleb128 0x2e
+	.long	.LASF22
+	.long	0x65
+	.byte	0x7a
+	.long	0xf3
+	.uleb128 0x1a
+	.long	.LASF15
+	.byte	0x1
+	.uleb128 0x1a
+	.long	.LASF16
+	.byte	0x2
+	.uleb128 0x1a
+	.long	.LASF17
+	.byte	0x4
+	.uleb128 0x1a
+	.long	.LASF18
+	.byte	0x8
+	.uleb128 0x1a
+	.long	.LASF19
+	.byte	0x10
+	.uleb128 0x1a
+	.long	.LASF20
+	.byte	0x20
+	.uleb128 0x1a
+	.long	.LASF21
+	.byte	0x40
+	.byte	0
+	.uleb128 0x2f
+	.long	0xb0
+	.long	0x103
+	.uleb128 0x30
+	.long	0x3b
+	.byte	0xff
+	.byte	0
+	.uleb128 0x19
+	.long	0xf3
+	.uleb128 0x3a
+	.long	.LASF60
+	.byte	0x2
+	.byte	0xa6
+	.byte	0x16
+	.long	0x103
+	.uleb128 0x3b
+	.long	.LASF46
+	.value	0x100
+	.byte	0x2
+	.byte	0xab
+	.byte	0x8
+	.long	0x130
+	.uleb128 0x25
+	.long	.LASF48
+	.byte	0x2
+	.byte	0xb0
+	.byte	0xb
+	.long	0x135
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x114
+	.uleb128 0x2f
+	.long	0xa4
+	.long	0x145
+	.uleb128 0x30
+	.long	0x3b
+	.byte	0xff
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF23
+	.long	0x65
+	.byte	0xe7
+	.long	0x16c
+	.uleb128 0x1a
+	.long	.LASF24
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF25
+	.byte	0x1
+	.uleb128 0x1a
+	.long	.LASF26
+	.byte	0x2
+	.uleb128 0x1a
+	.long	.LASF27
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.long	0x145
+	.uleb128 0x13
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF28
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF29
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF30
+	.uleb128 0x12
+	.long	.LASF31
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x1c
+	.long	0x192
+	.uleb128 0x1b
+	.long	0x97
+	.long	0x19e
+	.uleb128 0x17
+	.byte	0x1
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF32
+	.byte	0x3
+	.byte	0x2b
+	.byte	0xd
+	.long	0x1aa
+	.uleb128 0x1b
+	.long	0x42
+	.long	0x1b6
+	.uleb128 0x17
+	.byte	0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF33
+	.byte	0x3
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1c2
+	.uleb128 0x1b
+	.long	0x8b
+	.long	0x1ce
+	.uleb128 0x17
+	.byte	0xf
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF34
+	.byte	0x3
+	.byte	0x35
+	.byte	0x13
+	.long	0x1df
+	.uleb128 0x19
+	.long	0x1ce
+	.uleb128 0x1b
+	.long	0x50
+	.long	0x1eb
+	.uleb128 0x17
+	.byte	0x1
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF39
+	.byte	0x3
+	.byte	0x39
+	.long	0x1df
+	.uleb128 0x19
+	.long	0x1eb
+	.uleb128 0x12
+	.long	.LASF35
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x13
+	.long	0x207
+	.uleb128 0x1b
+	.long	0x50
+	.long	0x213
+	.uleb128 0x17
+	.byte	0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF36
+	.byte	0x5
+	.byte	0x2c
+	.byte	0x1c
+	.long	0x21f
+	.uleb128 0x1b
+	.long	0x97
+	.long	0x22b
+	.uleb128 0x17
+	.byte	0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF37
+	.byte	0x5
+	.byte	0x31
+	.byte	0xe
+	.long	0x237
+	.uleb128 0x1b
+	.long	0x8b
+	.long	0x243
+	.uleb128 0x17
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF38
+	.byte	0x5
+	.byte	0x39
+	.byte	0x13
+	.long	0x254
+	.uleb128 0x19
+	.long	0x243
+	.uleb128 0x1b
+	.long	0x50
+	.long	0x260
+	.uleb128 0x17
+	.byte	0x3
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF40
+	.byte	0x5
+	.byte	0x42
+	.long	0x254
+	.uleb128 0x19
+	.long	0x260
+	.uleb128 0x12
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x28
+	.byte	0x13
+	.long	0x27c
+	.uleb128 0x1b
+	.long	0x50
+	.long	0x288
+	.uleb128 0x17
+	.byte	0x7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0x294
+	.uleb128 0x1b
+	.long	0x8b
+	.long	0x2a0
+	.uleb128 0x17
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1b
+	.long	0x50
+	.long	0x2ac
+	.uleb128 0x17
+	.byte	0x7
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x39
+	.long	0x2a0
+	.uleb128 0x12
+	.long	.LASF44
+	.byte	0x7
+	.byte	0x2d
+	.byte	0x1c
+	.long	0x97
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x4
+	.long	.LASF45
+	.uleb128 0x3c
+	.long	.LASF47
+	.byte	0x20
+	.byte	0x1
+	.byte	0x16
+	.byte	0x8
+	.long	0x30c
+	.uleb128 0x25
+	.long	.LASF49
+	.byte	0x1
+	.byte	0x1b
+	.byte	0xc
+	.long	0x32a
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF50
+	.byte	0x1
+	.byte	0x20
+	.byte	0xc
+	.long	0x343
+	.byte	0x8
+	.uleb128 0x3d
+	.string	"nul"
+	.byte	0x1
+	.byte	0x25
+	.byte	0xc
+	.long	0x343
+	.byte	0x10
+	.uleb128 0x25
+	.long	.LASF51
+	.byte	0x1
+	.byte	0x2a
+	.byte	0xc
+	.long	0x343
+	.byte	0x18
+	.byte	0
+	.uleb128 0x19
+	.long	0x2ca
+	.uleb128 0x31
+	.long	0x2a
+	.long	0x32a
+	.uleb128 0x22
+	.long	0xb5
+	.uleb128 0x22
+	.long	0x36
+	.uleb128 0x22
+	.long	0x92
+	.byte	0
+	.uleb128 0x1e
+	.long	0x311
+	.uleb128 0x31
+	.long	0x2a
+	.long	0x343
+	.uleb128 0x22
+	.long	0xb5
+	.uleb128 0x22
+	.long	0x36
+	.byte	0
+	.uleb128 0x1e
+	.long	0x32f
+	.uleb128 0x32
+	.long	.LASF52
+	.byte	0x5c
+	.long	0x30c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	st_scan_scalar_kernels
+	.uleb128 0x32
+	.long	.LASF53
+	.byte	0xb6
+	.long	0x30c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	st_scan_sse2_kernels
+	.uleb128 0x26
+	.long	.LASF54
+	.value	0x10c
+	.byte	0x27
+	.long	0x30c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	st_scan_avx2_kernels
+	.uleb128 0x26
+	.long	.LASF55
+	.value	0x15e
+	.byte	0x27
+	.long	0x30c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	st_scan_avx512_kernels
+	.uleb128 0x26
+	.long	.LASF56
+	.value	0x16a
+	.byte	0x28
+	.long	0x3b2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	st_scan_kernels
+	.uleb128 0x1e
+	.long	0x30c
+	.uleb128 0x26
+	.long	.LASF57
+	.value	0x16f
+	.byte	0x1b
+	.long	0x145
+	.uleb128 0x9
+	.byte	0x3
+	.quad	st_scan_current_isa
+	.uleb128 0x23
+	.long	.LASF63
+	.value	0x1d5
+	.long	0x2a
+	.quad	.LFB6431
+	.quad	.LFE6431-.LFB6431
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x49d
+	.uleb128 0x3e
+	.long	.LASF65
+	.byte	0x1
+	.value	0x1d5
+	.byte	0x22
+	.long	0xb5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xc
+	.long	.LASF58
+	.value	0x1d5
+	.byte	0x37
+	.long	0x36
+	.long	.LLST588
+	.long	.LVUS588
+	.uleb128 0xc
+	.long	.LASF59
+	.value	0x1d5
+	.byte	0x5d
+	.long	0x49d
+	.long	.LLST589
+	.long	.LVUS589
+	.uleb128 0x10
+	.long	.LASF61
+	.value	0x1d6
+	.byte	0xa
+	.long	0x2a
+	.long	.LLST590
+	.long	.LVUS590
+	.uleb128 0x24
+	.long	.LLRL591
+	.long	0x46b
+	.uleb128 0x10
+	.long	.LASF48
+	.value	0x1d9
+	.byte	0x14
+	.long	0x4a2
+	.long	.LLST592
+	.long	.LVUS592
+	.uleb128 0x10
+	.long	.LASF62
+	.value	0x1da
+	.byte	0x12
+	.long	0x65
+	.long	.LLST593
+	.long	.LVUS593
+	.byte	0
+	.uleb128 0x1d
+	.long	0x25e5
+	.quad	.LBI1334
+	.byte	.LVU1506
+	.long	.LLRL594
+	.byte	0x1
+	.value	0x1e0
+	.byte	0x1c
+	.uleb128 0x1
+	.long	0x2602
+	.long	.LLST595
+	.long	.LVUS595
+	.uleb128 0x1
+	.long	0x25f6
+	.long	.LLST596
+	.long	.LVUS596
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x130
+	.uleb128 0x1e
+	.long	0xb0
+	.uleb128 0x23
+	.long	.LASF64
+	.value	0x1ce
+	.long	0x2a
+	.quad	.LFB6430
+	.quad	.LFE6430-.LFB6430
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x509
+	.uleb128 0xc
+	.long	.LASF65
+	.value	0x1ce
+	.byte	0x23
+	.long	0xb5
+	.long	.LLST586
+	.long	.LVUS586
+	.uleb128 0xc
+	.long	.LASF58
+	.value	0x1ce
+	.byte	0x38
+	.long	0x36
+	.long	.LLST587
+	.long	.LVUS587
+	.uleb128 0x27
+	.quad	.LVL473
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF66
+	.value	0x1c7
+	.long	0x2a
+	.quad	.LFB6429
+	.quad	.LFE6429-.LFB6429
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x56b
+	.uleb128 0xc
+	.long	.LASF65
+	.value	0x1c7
+	.byte	0x20
+	.long	0xb5
+	.long	.LLST584
+	.long	.LVUS584
+	.uleb128 0xc
+	.long	.LASF58
+	.value	0x1c7
+	.byte	0x35
+	.long	0x36
+	.long	.LLST585
+	.long	.LVUS585
+	.uleb128 0x27
+	.quad	.LVL471
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF67
+	.value	0x1c0
+	.long	0x2a
+	.quad	.LFB6428
+	.quad	.LFE6428-.LFB6428
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5cd
+	.uleb128 0xc
+	.long	.LASF65
+	.value	0x1c0
+	.byte	0x2b
+	.long	0xb5
+	.long	.LLST582
+	.long	.LVUS582
+	.uleb128 0xc
+	.long	.LASF58
+	.value	0x1c0
+	.byte	0x40
+	.long	0x36
+	.long	.LLST583
+	.long	.LVUS583
+	.uleb128 0x27
+	.quad	.LVL469
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF68
+	.value	0x1b9
+	.long	0x2a
+	.quad	.LFB6427
+	.quad	.LFE6427-.LFB6427
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x650
+	.uleb128 0xc
+	.long	.LASF65
+	.value	0x1b9
+	.byte	0x26
+	.long	0xb5
+	.long	.LLST579
+	.long	.LVUS579
+	.uleb128 0xc
+	.long	.LASF58
+	.value	0x1b9
+	.byte	0x3b
+	.long	0x36
+	.long	.LLST580
+	.long	.LVUS580
+	.uleb128 0xc
+	.long	.LASF69
+	.value	0x1b9
+	.byte	0x4e
+	.long	0x92
+	.long	.LLST581
+	.long	.LVUS581
+	.uleb128 0x27
+	.quad	.LVL467
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF158
+	.byte	0x1
+	.value	0x1af
+	.byte	0xd
+	.quad	.LFB6426
+	.quad	.LFE6426-.LFB6426
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x699
+	.uleb128 0x40
+	.string	"isa"
+	.byte	0x1
+	.value	0x1b0
+	.byte	0x16
+	.long	0x145
+	.long	.LLST578
+	.long	.LVUS578
+	.uleb128 0x33
+	.quad	.LVL462
+	.long	0x6b8
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF159
+	.byte	0x1
+	.value	0x1a7
+	.byte	0x14
+	.long	0x145
+	.quad	.LFB6425
+	.quad	.LFE6425-.LFB6425
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x34
+	.long	.LASF70
+	.value	0x18c
+	.long	0x42
+	.long	0x6d5
+	.uleb128 0x9
+	.string	"isa"
+	.byte	0x1
+	.value	0x18c
+	.byte	0x2e
+	.long	0x16c
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF71
+	.value	0x174
+	.long	0x42
+	.long	0x6f2
+	.uleb128 0x9
+	.string	"isa"
+	.byte	0x1
+	.value	0x174
+	.byte	0x34
+	.long	0x16c
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF77
+	.value	0x14b
+	.long	0x2a
+	.quad	.LFB6422
+	.quad	.LFE6422-.LFB6422
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcd2
+	.uleb128 0xc
+	.long	.LASF65
+	.value	0x14b
+	.byte	0x31
+	.long	0xb5
+	.long	.LLST509
+	.long	.LVUS509
+	.uleb128 0xc
+	.long	.LASF58
+	.value	0x14b
+	.byte	0x46
+	.long	0x36
+	.long	.LLST510
+	.long	.LVUS510
+	.uleb128 0x20
+	.long	.LASF72
+	.value	0x14c
+	.byte	0x11
+	.long	0xcd2
+	.uleb128 0x20
+	.long	.LASF73
+	.value	0x14d
+	.byte	0x11
+	.long	0xcd2
+	.uleb128 0x20
+	.long	.LASF74
+	.value	0x14e
+	.byte	0x11
+	.long	0xcd2
+	.uleb128 0x10
+	.long	.LASF61
+	.value	0x14f
+	.byte	0xa
+	.long	0x2a
+	.long	.LLST511
+	.long	.LVUS511
+	.uleb128 0x24
+	.long	.LLRL512
+	.long	0x84d
+	.uleb128 0x10
+	.long	.LASF75
+	.value	0x151
+	.byte	0xd
+	.long	0xce2
+	.long	.LLST513
+	.long	.LVUS513
+	.uleb128 0x10
+	.long	.LASF62
+	.value	0x152
+	.byte	0xf
+	.long	0x2b7
+	.long	.LLST514
+	.long	.LVUS514
+	.uleb128 0x11
+	.long	0x208c
+	.quad	.LBI1202
+	.byte	.LVU1224
+	.long	.LLRL515
+	.value	0x152
+	.byte	0x16
+	.long	0x7d0
+	.uleb128 0x4
+	.long	0x20a9
+	.uleb128 0x1
+	.long	0x209c
+	.long	.LLST516
+	.long	.LVUS516
+	.byte	0
+	.uleb128 0x11
+	.long	0x20b7
+	.quad	.LBI1206
+	.byte	.LVU1230
+	.long	.LLRL517
+	.value	0x153
+	.byte	0xd
+	.long	0x7fc
+	.uleb128 0x4
+	.long	0x20d4
+	.uleb128 0x1
+	.long	0x20c7
+	.long	.LLST518
+	.long	.LVUS518
+	.byte	0
+	.uleb128 0x11
+	.long	0x20b7
+	.quad	.LBI1209
+	.byte	.LVU1234
+	.long	.LLRL519
+	.value	0x153
+	.byte	0x35
+	.long	0x828
+	.uleb128 0x4
+	.long	0x20d4
+	.uleb128 0x1
+	.long	0x20c7
+	.long	.LLST520
+	.long	.LVUS520
+	.byte	0
+	.uleb128 0x1d
+	.long	0x20e2
+	.quad	.LBI1215
+	.byte	.LVU1220
+	.long	.LLRL521
+	.byte	0x1
+	.value	0x151
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x20f2
+	.long	.LLST522
+	.long	.LVUS522
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x1c24
+	.quad	.LBI1226
+	.byte	.LVU1251
+	.long	.LLRL523
+	.value	0x158
+	.byte	0x12
+	.long	0xcbb
+	.uleb128 0x1
+	.long	0x1c41
+	.long	.LLST524
+	.long	.LVUS524
+	.uleb128 0x1
+	.long	0x1c35
+	.long	.LLST525
+	.long	.LVUS525
+	.uleb128 0x14
+	.long	.LLRL523
+	.uleb128 0x8
+	.long	0x1c4d
+	.uleb128 0x8
+	.long	0x1c58
+	.uleb128 0x8
+	.long	0x1c63
+	.uleb128 0x2
+	.long	0x1c6e
+	.long	.LLST526
+	.long	.LVUS526
+	.uleb128 0xd
+	.long	0x1c79
+	.long	.LLRL527
+	.long	0xa44
+	.uleb128 0x2
+	.long	0x1c7a
+	.long	.LLST528
+	.long	.LVUS528
+	.uleb128 0x2
+	.long	0x1c85
+	.long	.LLST529
+	.long	.LVUS529
+	.uleb128 0x2
+	.long	0x1c90
+	.long	.LLST530
+	.long	.LVUS530
+	.uleb128 0x3
+	.long	0x2171
+	.quad	.LBI1229
+	.byte	.LVU1261
+	.long	.LLRL531
+	.byte	0xfe
+	.byte	0x17
+	.long	0x900
+	.uleb128 0x4
+	.long	0x218e
+	.uleb128 0x1
+	.long	0x2181
+	.long	.LLST532
+	.long	.LVUS532
+	.byte	0
+	.uleb128 0x3
+	.long	0x21c7
+	.quad	.LBI1233
+	.byte	.LVU1271
+	.long	.LLRL533
+	.byte	0xff
+	.byte	0xf
+	.long	0x92b
+	.uleb128 0x4
+	.long	0x21e2
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST534
+	.long	.LVUS534
+	.byte	0
+	.uleb128 0x11
+	.long	0x21c7
+	.quad	.LBI1236
+	.byte	.LVU1279
+	.long	.LLRL535
+	.value	0x100
+	.byte	0xf
+	.long	0x957
+	.uleb128 0x4
+	.long	0x21e2
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST536
+	.long	.LVUS536
+	.byte	0
+	.uleb128 0x3
+	.long	0x23ca
+	.quad	.LBI1240
+	.byte	.LVU1257
+	.long	.LLRL537
+	.byte	0xfd
+	.byte	0x15
+	.long	0x97d
+	.uleb128 0x1
+	.long	0x23da
+	.long	.LLST538
+	.long	.LVUS538
+	.byte	0
+	.uleb128 0xb
+	.long	0x21c7
+	.quad	.LBI1249
+	.byte	.LVU1266
+	.quad	.LBB1249
+	.quad	.LBE1249-.LBB1249
+	.byte	0xfe
+	.byte	0x17
+	.long	0x9bc
+	.uleb128 0x1
+	.long	0x21e2
+	.long	.LLST539
+	.long	.LVUS539
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST540
+	.long	.LVUS540
+	.byte	0
+	.uleb128 0xb
+	.long	0x2128
+	.quad	.LBI1252
+	.byte	.LVU1275
+	.quad	.LBB1252
+	.quad	.LBE1252-.LBB1252
+	.byte	0xff
+	.byte	0xf
+	.long	0x9fb
+	.uleb128 0x1
+	.long	0x2145
+	.long	.LLST541
+	.long	.LVUS541
+	.uleb128 0x1
+	.long	0x2138
+	.long	.LLST542
+	.long	.LVUS542
+	.byte	0
+	.uleb128 0x11
+	.long	0x2128
+	.quad	.LBI1255
+	.byte	.LVU1283
+	.long	.LLRL543
+	.value	0x100
+	.byte	0xf
+	.long	0xa27
+	.uleb128 0x1
+	.long	0x2145
+	.long	.LLST544
+	.long	.LVUS544
+	.uleb128 0x4
+	.long	0x2138
+	.byte	0
+	.uleb128 0x1d
+	.long	0x2153
+	.quad	.LBI1258
+	.byte	.LVU1287
+	.long	.LLRL545
+	.byte	0x1
+	.value	0x101
+	.byte	0x27
+	.uleb128 0x4
+	.long	0x2163
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x1dd3
+	.quad	.LBI1264
+	.byte	.LVU1304
+	.long	.LLRL546
+	.byte	0x1
+	.value	0x106
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x1df0
+	.long	.LLST547
+	.long	.LVUS547
+	.uleb128 0x1
+	.long	0x1de4
+	.long	.LLST548
+	.long	.LVUS548
+	.uleb128 0x14
+	.long	.LLRL546
+	.uleb128 0x8
+	.long	0x1dfc
+	.uleb128 0x8
+	.long	0x1e07
+	.uleb128 0x8
+	.long	0x1e12
+	.uleb128 0x2
+	.long	0x1e1d
+	.long	.LLST549
+	.long	.LVUS549
+	.uleb128 0xd
+	.long	0x1e28
+	.long	.LLRL550
+	.long	0xc34
+	.uleb128 0x2
+	.long	0x1e29
+	.long	.LLST551
+	.long	.LVUS551
+	.uleb128 0x2
+	.long	0x1e34
+	.long	.LLST552
+	.long	.LVUS552
+	.uleb128 0x2
+	.long	0x1e3f
+	.long	.LLST553
+	.long	.LVUS553
+	.uleb128 0x3
+	.long	0x240b
+	.quad	.LBI1267
+	.byte	.LVU1314
+	.long	.LLRL554
+	.byte	0xa8
+	.byte	0x17
+	.long	0xaf4
+	.uleb128 0x4
+	.long	0x2428
+	.uleb128 0x1
+	.long	0x241b
+	.long	.LLST555
+	.long	.LVUS555
+	.byte	0
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI1271
+	.byte	.LVU1324
+	.long	.LLRL556
+	.byte	0xa9
+	.byte	0xf
+	.long	0xb1f
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST557
+	.long	.LVUS557
+	.byte	0
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI1276
+	.byte	.LVU1332
+	.long	.LLRL558
+	.byte	0xaa
+	.byte	0xf
+	.long	0xb4a
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST559
+	.long	.LVUS559
+	.byte	0
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI1280
+	.byte	.LVU1310
+	.long	.LLRL560
+	.byte	0xa6
+	.byte	0x15
+	.long	0xb70
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST561
+	.long	.LVUS561
+	.byte	0
+	.uleb128 0xb
+	.long	0x2461
+	.quad	.LBI1289
+	.byte	.LVU1319
+	.quad	.LBB1289
+	.quad	.LBE1289-.LBB1289
+	.byte	0xa8
+	.byte	0x17
+	.long	0xbaf
+	.uleb128 0x1
+	.long	0x247e
+	.long	.LLST562
+	.long	.LVUS562
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST563
+	.long	.LVUS563
+	.byte	0
+	.uleb128 0xb
+	.long	0x248c
+	.quad	.LBI1292
+	.byte	.LVU1328
+	.quad	.LBB1292
+	.quad	.LBE1292-.LBB1292
+	.byte	0xa9
+	.byte	0xf
+	.long	0xbee
+	.uleb128 0x1
+	.long	0x24a9
+	.long	.LLST564
+	.long	.LVUS564
+	.uleb128 0x1
+	.long	0x249c
+	.long	.LLST565
+	.long	.LVUS565
+	.byte	0
+	.uleb128 0x3
+	.long	0x248c
+	.quad	.LBI1295
+	.byte	.LVU1336
+	.long	.LLRL566
+	.byte	0xaa
+	.byte	0xf
+	.long	0xc19
+	.uleb128 0x1
+	.long	0x24a9
+	.long	.LLST567
+	.long	.LVUS567
+	.uleb128 0x4
+	.long	0x249c
+	.byte	0
+	.uleb128 0x18
+	.long	0x23ed
+	.quad	.LBI1298
+	.byte	.LVU1340
+	.long	.LLRL568
+	.byte	0xab
+	.byte	0x27
+	.uleb128 0x4
+	.long	0x23fd
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1f81
+	.quad	.LBI1305
+	.byte	.LVU1353
+	.quad	.LBB1305
+	.quad	.LBE1305-.LBB1305
+	.byte	0xb0
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x1f9e
+	.long	.LLST569
+	.long	.LVUS569
+	.uleb128 0x1
+	.long	0x1f92
+	.long	.LLST570
+	.long	.LVUS570
+	.uleb128 0x2
+	.long	0x1faa
+	.long	.LLST571
+	.long	.LVUS571
+	.uleb128 0xa
+	.long	0x260f
+	.quad	.LBI1307
+	.byte	.LVU1364
+	.quad	.LBB1307
+	.quad	.LBE1307-.LBB1307
+	.byte	0x53
+	.byte	0x1c
+	.uleb128 0x1
+	.long	0x262c
+	.long	.LLST572
+	.long	.LVUS572
+	.uleb128 0x1
+	.long	0x2620
+	.long	.LLST573
+	.long	.LVUS573
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL435
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xf
+	.quad	.LVL440
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF76
+	.long	0x50
+	.long	0xce2
+	.uleb128 0x17
+	.byte	0x7
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF76
+	.long	0x50
+	.long	0xcf2
+	.uleb128 0x17
+	.byte	0x7
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF78
+	.value	0x13a
+	.long	0x2a
+	.quad	.LFB6421
+	.quad	.LFE6421-.LFB6421
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1035
+	.uleb128 0xc
+	.long	.LASF65
+	.value	0x13a
+	.byte	0x2e
+	.long	0xb5
+	.long	.LLST267
+	.long	.LVUS267
+	.uleb128 0xc
+	.long	.LASF58
+	.value	0x13a
+	.byte	0x43
+	.long	0x36
+	.long	.LLST268
+	.long	.LVUS268
+	.uleb128 0x20
+	.long	.LASF79
+	.value	0x13b
+	.byte	0x11
+	.long	0xcd2
+	.uleb128 0x10
+	.long	.LASF61
+	.value	0x13c
+	.byte	0xa
+	.long	0x2a
+	.long	.LLST269
+	.long	.LVUS269
+	.uleb128 0x24
+	.long	.LLRL270
+	.long	0xdf5
+	.uleb128 0x10
+	.long	.LASF75
+	.value	0x13e
+	.byte	0xd
+	.long	0xce2
+	.long	.LLST271
+	.long	.LVUS271
+	.uleb128 0x10
+	.long	.LASF62
+	.value	0x13f
+	.byte	0xf
+	.long	0x2b7
+	.long	.LLST272
+	.long	.LVUS272
+	.uleb128 0x2a
+	.long	0x20e2
+	.quad	.LBI722
+	.byte	.LVU648
+	.quad	.LBB722
+	.quad	.LBE722-.LBB722
+	.value	0x13e
+	.byte	0x15
+	.long	0xdbf
+	.uleb128 0x1
+	.long	0x20f2
+	.long	.LLST273
+	.long	.LVUS273
+	.byte	0
+	.uleb128 0x2b
+	.long	0x20b7
+	.quad	.LBI724
+	.byte	.LVU652
+	.quad	.LBB724
+	.quad	.LBE724-.LBB724
+	.byte	0x1
+	.value	0x13f
+	.byte	0x16
+	.uleb128 0x4
+	.long	0x20d4
+	.uleb128 0x1
+	.long	0x20c7
+	.long	.LLST274
+	.long	.LVUS274
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x1c9e
+	.quad	.LBI726
+	.byte	.LVU664
+	.long	.LLRL275
+	.value	0x144
+	.byte	0x12
+	.long	0x101e
+	.uleb128 0x1
+	.long	0x1cbb
+	.long	.LLST276
+	.long	.LVUS276
+	.uleb128 0x1
+	.long	0x1caf
+	.long	.LLST277
+	.long	.LVUS277
+	.uleb128 0x14
+	.long	.LLRL275
+	.uleb128 0x8
+	.long	0x1cc7
+	.uleb128 0x2
+	.long	0x1cd2
+	.long	.LLST278
+	.long	.LVUS278
+	.uleb128 0xd
+	.long	0x1cdd
+	.long	.LLRL279
+	.long	0xee6
+	.uleb128 0x2
+	.long	0x1cde
+	.long	.LLST280
+	.long	.LVUS280
+	.uleb128 0x2
+	.long	0x1ce9
+	.long	.LLST281
+	.long	.LVUS281
+	.uleb128 0x3
+	.long	0x23ca
+	.quad	.LBI729
+	.byte	.LVU671
+	.long	.LLRL282
+	.byte	0xea
+	.byte	0x15
+	.long	0xe8c
+	.uleb128 0x1
+	.long	0x23da
+	.long	.LLST283
+	.long	.LVUS283
+	.byte	0
+	.uleb128 0x3
+	.long	0x21c7
+	.quad	.LBI732
+	.byte	.LVU675
+	.long	.LLRL284
+	.byte	0xeb
+	.byte	0x27
+	.long	0xeb7
+	.uleb128 0x4
+	.long	0x21e2
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST285
+	.long	.LVUS285
+	.byte	0
+	.uleb128 0xa
+	.long	0x2153
+	.quad	.LBI737
+	.byte	.LVU679
+	.quad	.LBB737
+	.quad	.LBE737-.LBB737
+	.byte	0xeb
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x2163
+	.long	.LLST286
+	.long	.LVUS286
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x1e4c
+	.quad	.LBI739
+	.byte	.LVU691
+	.long	.LLRL287
+	.byte	0xf0
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x1e69
+	.long	.LLST288
+	.long	.LVUS288
+	.uleb128 0x1
+	.long	0x1e5d
+	.long	.LLST289
+	.long	.LVUS289
+	.uleb128 0x14
+	.long	.LLRL287
+	.uleb128 0x8
+	.long	0x1e75
+	.uleb128 0x2
+	.long	0x1e80
+	.long	.LLST290
+	.long	.LVUS290
+	.uleb128 0xd
+	.long	0x1e8b
+	.long	.LLRL291
+	.long	0xfd2
+	.uleb128 0x2
+	.long	0x1e8c
+	.long	.LLST292
+	.long	.LVUS292
+	.uleb128 0x2
+	.long	0x1e97
+	.long	.LLST293
+	.long	.LVUS293
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI742
+	.byte	.LVU697
+	.long	.LLRL294
+	.byte	0x93
+	.byte	0x15
+	.long	0xf78
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST295
+	.long	.LVUS295
+	.byte	0
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI745
+	.byte	.LVU701
+	.long	.LLRL296
+	.byte	0x94
+	.byte	0x27
+	.long	0xfa3
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST297
+	.long	.LVUS297
+	.byte	0
+	.uleb128 0xa
+	.long	0x23ed
+	.quad	.LBI750
+	.byte	.LVU705
+	.quad	.LBB750
+	.quad	.LBE750-.LBB750
+	.byte	0x94
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x23fd
+	.long	.LLST298
+	.long	.LVUS298
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1fb6
+	.quad	.LBI752
+	.byte	.LVU716
+	.quad	.LBB752
+	.quad	.LBE752-.LBB752
+	.byte	0x99
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x1fd3
+	.long	.LLST299
+	.long	.LVUS299
+	.uleb128 0x1
+	.long	0x1fc7
+	.long	.LLST300
+	.long	.LVUS300
+	.uleb128 0x2
+	.long	0x1fdf
+	.long	.LLST301
+	.long	.LVUS301
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL247
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xf
+	.quad	.LVL252
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF80
+	.value	0x129
+	.long	0x2a
+	.quad	.LFB6420
+	.quad	.LFE6420-.LFB6420
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x143f
+	.uleb128 0xc
+	.long	.LASF65
+	.value	0x129
+	.byte	0x39
+	.long	0xb5
+	.long	.LLST302
+	.long	.LVUS302
+	.uleb128 0xc
+	.long	.LASF58
+	.value	0x129
+	.byte	0x4e
+	.long	0x36
+	.long	.LLST303
+	.long	.LVUS303
+	.uleb128 0x20
+	.long	.LASF81
+	.value	0x12a
+	.byte	0x11
+	.long	0xcd2
+	.uleb128 0x10
+	.long	.LASF61
+	.value	0x12b
+	.byte	0xa
+	.long	0x2a
+	.long	.LLST304
+	.long	.LVUS304
+	.uleb128 0x24
+	.long	.LLRL305
+	.long	0x112c
+	.uleb128 0x10
+	.long	.LASF75
+	.value	0x12d
+	.byte	0xd
+	.long	0xce2
+	.long	.LLST306
+	.long	.LVUS306
+	.uleb128 0x10
+	.long	.LASF62
+	.value	0x12e
+	.byte	0xf
+	.long	0x2b7
+	.long	.LLST307
+	.long	.LVUS307
+	.uleb128 0x11
+	.long	0x2061
+	.quad	.LBI795
+	.byte	.LVU769
+	.long	.LLRL308
+	.value	0x12e
+	.byte	0x16
+	.long	0x10fb
+	.uleb128 0x4
+	.long	0x207e
+	.uleb128 0x1
+	.long	0x2071
+	.long	.LLST309
+	.long	.LVUS309
+	.byte	0
+	.uleb128 0x2b
+	.long	0x20e2
+	.quad	.LBI800
+	.byte	.LVU765
+	.quad	.LBB800
+	.quad	.LBE800-.LBB800
+	.byte	0x1
+	.value	0x12d
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x20f2
+	.long	.LLST310
+	.long	.LVUS310
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x1cf6
+	.quad	.LBI805
+	.byte	.LVU782
+	.long	.LLRL311
+	.value	0x133
+	.byte	0x12
+	.long	0x1428
+	.uleb128 0x1
+	.long	0x1d13
+	.long	.LLST312
+	.long	.LVUS312
+	.uleb128 0x1
+	.long	0x1d07
+	.long	.LLST313
+	.long	.LVUS313
+	.uleb128 0x14
+	.long	.LLRL311
+	.uleb128 0x8
+	.long	0x1d1f
+	.uleb128 0x2
+	.long	0x1d2a
+	.long	.LLST314
+	.long	.LVUS314
+	.uleb128 0xd
+	.long	0x1d35
+	.long	.LLRL315
+	.long	0x1269
+	.uleb128 0x2
+	.long	0x1d36
+	.long	.LLST316
+	.long	.LVUS316
+	.uleb128 0x2
+	.long	0x1d41
+	.long	.LLST317
+	.long	.LVUS317
+	.uleb128 0x2
+	.long	0x1d4c
+	.long	.LLST318
+	.long	.LVUS318
+	.uleb128 0x3
+	.long	0x219c
+	.quad	.LBI808
+	.byte	.LVU792
+	.long	.LLRL319
+	.byte	0xd9
+	.byte	0x17
+	.long	0x11d5
+	.uleb128 0x4
+	.long	0x21b9
+	.uleb128 0x1
+	.long	0x21ac
+	.long	.LLST320
+	.long	.LVUS320
+	.byte	0
+	.uleb128 0x3
+	.long	0x23ca
+	.quad	.LBI813
+	.byte	.LVU788
+	.long	.LLRL321
+	.byte	0xd8
+	.byte	0x15
+	.long	0x11fb
+	.uleb128 0x1
+	.long	0x23da
+	.long	.LLST322
+	.long	.LVUS322
+	.byte	0
+	.uleb128 0xb
+	.long	0x21c7
+	.quad	.LBI822
+	.byte	.LVU797
+	.quad	.LBB822
+	.quad	.LBE822-.LBB822
+	.byte	0xd9
+	.byte	0x17
+	.long	0x123a
+	.uleb128 0x1
+	.long	0x21e2
+	.long	.LLST323
+	.long	.LVUS323
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST324
+	.long	.LVUS324
+	.byte	0
+	.uleb128 0xa
+	.long	0x2153
+	.quad	.LBI824
+	.byte	.LVU802
+	.quad	.LBB824
+	.quad	.LBE824-.LBB824
+	.byte	0xda
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x2163
+	.long	.LLST325
+	.long	.LVUS325
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x1ea4
+	.quad	.LBI827
+	.byte	.LVU815
+	.long	.LLRL326
+	.byte	0xdf
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x1ec1
+	.long	.LLST327
+	.long	.LVUS327
+	.uleb128 0x1
+	.long	0x1eb5
+	.long	.LLST328
+	.long	.LVUS328
+	.uleb128 0x14
+	.long	.LLRL326
+	.uleb128 0x8
+	.long	0x1ecd
+	.uleb128 0x2
+	.long	0x1ed8
+	.long	.LLST329
+	.long	.LVUS329
+	.uleb128 0xd
+	.long	0x1ee3
+	.long	.LLRL330
+	.long	0x13a1
+	.uleb128 0x2
+	.long	0x1ee4
+	.long	.LLST331
+	.long	.LVUS331
+	.uleb128 0x2
+	.long	0x1eef
+	.long	.LLST332
+	.long	.LVUS332
+	.uleb128 0x2
+	.long	0x1efa
+	.long	.LLST333
+	.long	.LVUS333
+	.uleb128 0x3
+	.long	0x2436
+	.quad	.LBI830
+	.byte	.LVU825
+	.long	.LLRL334
+	.byte	0x82
+	.byte	0x17
+	.long	0x130d
+	.uleb128 0x4
+	.long	0x2453
+	.uleb128 0x1
+	.long	0x2446
+	.long	.LLST335
+	.long	.LVUS335
+	.byte	0
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI835
+	.byte	.LVU821
+	.long	.LLRL336
+	.byte	0x80
+	.byte	0x15
+	.long	0x1333
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST337
+	.long	.LVUS337
+	.byte	0
+	.uleb128 0xb
+	.long	0x2461
+	.quad	.LBI844
+	.byte	.LVU830
+	.quad	.LBB844
+	.quad	.LBE844-.LBB844
+	.byte	0x82
+	.byte	0x17
+	.long	0x1372
+	.uleb128 0x1
+	.long	0x247e
+	.long	.LLST338
+	.long	.LVUS338
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST339
+	.long	.LVUS339
+	.byte	0
+	.uleb128 0xa
+	.long	0x23ed
+	.quad	.LBI846
+	.byte	.LVU835
+	.quad	.LBB846
+	.quad	.LBE846-.LBB846
+	.byte	0x83
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x23fd
+	.long	.LLST340
+	.long	.LVUS340
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1feb
+	.quad	.LBI849
+	.byte	.LVU846
+	.quad	.LBB849
+	.quad	.LBE849-.LBB849
+	.byte	0x88
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x2008
+	.long	.LLST341
+	.long	.LVUS341
+	.uleb128 0x1
+	.long	0x1ffc
+	.long	.LLST342
+	.long	.LVUS342
+	.uleb128 0x2
+	.long	0x2014
+	.long	.LLST343
+	.long	.LVUS343
+	.uleb128 0xa
+	.long	0x260f
+	.quad	.LBI851
+	.byte	.LVU857
+	.quad	.LBB851
+	.quad	.LBE851-.LBB851
+	.byte	0x3d
+	.byte	0x1c
+	.uleb128 0x1
+	.long	0x262c
+	.long	.LLST344
+	.long	.LVUS344
+	.uleb128 0x1
+	.long	0x2620
+	.long	.LLST345
+	.long	.LVUS345
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL289
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xf
+	.quad	.LVL294
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF82
+	.value	0x117
+	.long	0x2a
+	.quad	.LFB6419
+	.quad	.LFE6419-.LFB6419
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c24
+	.uleb128 0xc
+	.long	.LASF65
+	.value	0x117
+	.byte	0x34
+	.long	0xb5
+	.long	.LLST346
+	.long	.LVUS346
+	.uleb128 0xc
+	.long	.LASF58
+	.value	0x117
+	.byte	0x49
+	.long	0x36
+	.long	.LLST347
+	.long	.LVUS347
+	.uleb128 0xc
+	.long	.LASF69
+	.value	0x117
+	.byte	0x5c
+	.long	0x92
+	.long	.LLST348
+	.long	.LVUS348
+	.uleb128 0x10
+	.long	.LASF83
+	.value	0x118
+	.byte	0x11
+	.long	0xcd2
+	.long	.LLST349
+	.long	.LVUS349
+	.uleb128 0x20
+	.long	.LASF79
+	.value	0x119
+	.byte	0x11
+	.long	0xcd2
+	.uleb128 0x10
+	.long	.LASF61
+	.value	0x11a
+	.byte	0xa
+	.long	0x2a
+	.long	.LLST350
+	.long	.LVUS350
+	.uleb128 0x24
+	.long	.LLRL353
+	.long	0x1586
+	.uleb128 0x10
+	.long	.LASF75
+	.value	0x11c
+	.byte	0xd
+	.long	0xce2
+	.long	.LLST354
+	.long	.LVUS354
+	.uleb128 0x10
+	.long	.LASF62
+	.value	0x11d
+	.byte	0xf
+	.long	0x2b7
+	.long	.LLST355
+	.long	.LVUS355
+	.uleb128 0x11
+	.long	0x20e2
+	.quad	.LBI914
+	.byte	.LVU902
+	.long	.LLRL356
+	.value	0x11c
+	.byte	0x15
+	.long	0x1528
+	.uleb128 0x1
+	.long	0x20f2
+	.long	.LLST357
+	.long	.LVUS357
+	.byte	0
+	.uleb128 0x11
+	.long	0x20b7
+	.quad	.LBI917
+	.byte	.LVU906
+	.long	.LLRL358
+	.value	0x11d
+	.byte	0x16
+	.long	0x155c
+	.uleb128 0x1
+	.long	0x20d4
+	.long	.LLST359
+	.long	.LVUS359
+	.uleb128 0x1
+	.long	0x20c7
+	.long	.LLST360
+	.long	.LVUS360
+	.byte	0
+	.uleb128 0x1d
+	.long	0x20b7
+	.quad	.LBI923
+	.byte	.LVU911
+	.long	.LLRL361
+	.byte	0x1
+	.value	0x11d
+	.byte	0x3e
+	.uleb128 0x4
+	.long	0x20d4
+	.uleb128 0x1
+	.long	0x20c7
+	.long	.LLST362
+	.long	.LVUS362
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x210c
+	.quad	.LBI909
+	.byte	.LVU891
+	.long	.LLRL351
+	.value	0x118
+	.byte	0x1a
+	.long	0x15ad
+	.uleb128 0x1
+	.long	0x211b
+	.long	.LLST352
+	.long	.LVUS352
+	.byte	0
+	.uleb128 0x11
+	.long	0x1d59
+	.quad	.LBI928
+	.byte	.LVU924
+	.long	.LLRL363
+	.value	0x122
+	.byte	0x12
+	.long	0x1bf7
+	.uleb128 0x1
+	.long	0x1d82
+	.long	.LLST364
+	.long	.LVUS364
+	.uleb128 0x1
+	.long	0x1d76
+	.long	.LLST365
+	.long	.LVUS365
+	.uleb128 0x1
+	.long	0x1d6a
+	.long	.LLST366
+	.long	.LVUS366
+	.uleb128 0x14
+	.long	.LLRL363
+	.uleb128 0x2
+	.long	0x1d8e
+	.long	.LLST367
+	.long	.LVUS367
+	.uleb128 0x8
+	.long	0x1d99
+	.uleb128 0x2
+	.long	0x1da4
+	.long	.LLST368
+	.long	.LVUS368
+	.uleb128 0xb
+	.long	0x21ef
+	.quad	.LBI930
+	.byte	.LVU926
+	.quad	.LBB930
+	.quad	.LBE930-.LBB930
+	.byte	0xc2
+	.byte	0x1a
+	.long	0x1806
+	.uleb128 0x1
+	.long	0x21ff
+	.long	.LLST369
+	.long	.LVUS369
+	.uleb128 0x2b
+	.long	0x220d
+	.quad	.LBI931
+	.byte	.LVU928
+	.quad	.LBB931
+	.quad	.LBE931-.LBB931
+	.byte	0x5
+	.value	0x53e
+	.byte	0xa
+	.uleb128 0x1
+	.long	0x23b0
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x23a3
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2396
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2389
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x237c
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x236f
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2362
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2355
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2348
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x233b
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x232e
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2321
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2314
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2307
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x22fa
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x22ed
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x22e0
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x22d3
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x22c6
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x22b9
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x22ac
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x229f
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2292
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2285
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2278
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x226b
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x225e
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2251
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2244
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x2237
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x222a
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1
+	.long	0x221d
+	.long	.LLST370
+	.long	.LVUS370
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x1daf
+	.long	.LLRL402
+	.long	0x1920
+	.uleb128 0x2
+	.long	0x1db0
+	.long	.LLST403
+	.long	.LVUS403
+	.uleb128 0x2
+	.long	0x1dbb
+	.long	.LLST404
+	.long	.LVUS404
+	.uleb128 0x2
+	.long	0x1dc6
+	.long	.LLST405
+	.long	.LVUS405
+	.uleb128 0x3
+	.long	0x23ca
+	.quad	.LBI934
+	.byte	.LVU941
+	.long	.LLRL406
+	.byte	0xc6
+	.byte	0x15
+	.long	0x1860
+	.uleb128 0x1
+	.long	0x23da
+	.long	.LLST407
+	.long	.LVUS407
+	.byte	0
+	.uleb128 0x3
+	.long	0x21c7
+	.quad	.LBI938
+	.byte	.LVU945
+	.long	.LLRL408
+	.byte	0xc7
+	.byte	0x17
+	.long	0x188b
+	.uleb128 0x4
+	.long	0x21e2
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST409
+	.long	.LVUS409
+	.byte	0
+	.uleb128 0xb
+	.long	0x21c7
+	.quad	.LBI946
+	.byte	.LVU950
+	.quad	.LBB946
+	.quad	.LBE946-.LBB946
+	.byte	0xc7
+	.byte	0x17
+	.long	0x18ca
+	.uleb128 0x1
+	.long	0x21e2
+	.long	.LLST410
+	.long	.LVUS410
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST411
+	.long	.LVUS411
+	.byte	0
+	.uleb128 0x3
+	.long	0x2128
+	.quad	.LBI948
+	.byte	.LVU954
+	.long	.LLRL412
+	.byte	0xc7
+	.byte	0x17
+	.long	0x18fd
+	.uleb128 0x1
+	.long	0x2145
+	.long	.LLST413
+	.long	.LVUS413
+	.uleb128 0x1
+	.long	0x2138
+	.long	.LLST414
+	.long	.LVUS414
+	.byte	0
+	.uleb128 0x18
+	.long	0x2153
+	.quad	.LBI951
+	.byte	.LVU958
+	.long	.LLRL415
+	.byte	0xc8
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x2163
+	.long	.LLST416
+	.long	.LVUS416
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x1f07
+	.quad	.LBI957
+	.byte	.LVU976
+	.long	.LLRL417
+	.byte	0xcd
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x1f30
+	.long	.LLST418
+	.long	.LVUS418
+	.uleb128 0x1
+	.long	0x1f24
+	.long	.LLST419
+	.long	.LVUS419
+	.uleb128 0x1
+	.long	0x1f18
+	.long	.LLST420
+	.long	.LVUS420
+	.uleb128 0x14
+	.long	.LLRL417
+	.uleb128 0x2
+	.long	0x1f3c
+	.long	.LLST421
+	.long	.LVUS421
+	.uleb128 0x8
+	.long	0x1f47
+	.uleb128 0x2
+	.long	0x1f52
+	.long	.LLST422
+	.long	.LVUS422
+	.uleb128 0x3
+	.long	0x24e6
+	.quad	.LBI959
+	.byte	.LVU978
+	.long	.LLRL423
+	.byte	0x6a
+	.byte	0x1a
+	.long	0x1a8c
+	.uleb128 0x1
+	.long	0x24f6
+	.long	.LLST424
+	.long	.LVUS424
+	.uleb128 0x1d
+	.long	0x2504
+	.quad	.LBI960
+	.byte	.LVU980
+	.long	.LLRL423
+	.byte	0x3
+	.value	0x290
+	.byte	0xa
+	.uleb128 0x1
+	.long	0x25d7
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x25ca
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x25bd
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x25b0
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x25a3
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x2596
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x2589
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x257c
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x256f
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x2562
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x2555
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x2548
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x253b
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x252e
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x2521
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x1
+	.long	0x2514
+	.long	.LLST425
+	.long	.LVUS425
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x1f5d
+	.long	.LLRL441
+	.long	0x1ba6
+	.uleb128 0x2
+	.long	0x1f5e
+	.long	.LLST442
+	.long	.LVUS442
+	.uleb128 0x2
+	.long	0x1f69
+	.long	.LLST443
+	.long	.LVUS443
+	.uleb128 0x2
+	.long	0x1f74
+	.long	.LLST444
+	.long	.LVUS444
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI966
+	.byte	.LVU993
+	.long	.LLRL445
+	.byte	0x6e
+	.byte	0x15
+	.long	0x1ae6
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST446
+	.long	.LVUS446
+	.byte	0
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI970
+	.byte	.LVU997
+	.long	.LLRL447
+	.byte	0x6f
+	.byte	0x17
+	.long	0x1b11
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST448
+	.long	.LVUS448
+	.byte	0
+	.uleb128 0xb
+	.long	0x2461
+	.quad	.LBI978
+	.byte	.LVU1002
+	.quad	.LBB978
+	.quad	.LBE978-.LBB978
+	.byte	0x6f
+	.byte	0x17
+	.long	0x1b50
+	.uleb128 0x1
+	.long	0x247e
+	.long	.LLST449
+	.long	.LVUS449
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST450
+	.long	.LVUS450
+	.byte	0
+	.uleb128 0x3
+	.long	0x248c
+	.quad	.LBI980
+	.byte	.LVU1006
+	.long	.LLRL451
+	.byte	0x6f
+	.byte	0x17
+	.long	0x1b83
+	.uleb128 0x1
+	.long	0x24a9
+	.long	.LLST452
+	.long	.LVUS452
+	.uleb128 0x1
+	.long	0x249c
+	.long	.LLST453
+	.long	.LVUS453
+	.byte	0
+	.uleb128 0x18
+	.long	0x23ed
+	.quad	.LBI983
+	.byte	.LVU1010
+	.long	.LLRL454
+	.byte	0x70
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x23fd
+	.long	.LLST455
+	.long	.LVUS455
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x2020
+	.quad	.LBI989
+	.byte	.LVU1023
+	.quad	.LBB989
+	.quad	.LBE989-.LBB989
+	.byte	0x75
+	.byte	0x12
+	.uleb128 0x4
+	.long	0x2049
+	.uleb128 0x1
+	.long	0x203d
+	.long	.LLST456
+	.long	.LVUS456
+	.uleb128 0x1
+	.long	0x2031
+	.long	.LLST457
+	.long	.LVUS457
+	.uleb128 0x2
+	.long	0x2055
+	.long	.LLST458
+	.long	.LVUS458
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL340
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xf
+	.quad	.LVL344
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xf
+	.quad	.LVL349
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xf
+	.quad	.LVL355
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF85
+	.byte	0x1
+	.byte	0xf7
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x1c9e
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0xf7
+	.byte	0x2f
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0xf7
+	.byte	0x44
+	.long	0x36
+	.uleb128 0x6
+	.long	.LASF72
+	.byte	0xf8
+	.byte	0x11
+	.long	0x24f
+	.uleb128 0x6
+	.long	.LASF73
+	.byte	0xf9
+	.byte	0x11
+	.long	0x24f
+	.uleb128 0x6
+	.long	.LASF74
+	.byte	0xfa
+	.byte	0x11
+	.long	0x24f
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0xfb
+	.byte	0xa
+	.long	0x2a
+	.uleb128 0x1f
+	.uleb128 0x6
+	.long	.LASF75
+	.byte	0xfd
+	.byte	0xd
+	.long	0x243
+	.uleb128 0x6
+	.long	.LASF84
+	.byte	0xfe
+	.byte	0xd
+	.long	0x243
+	.uleb128 0x20
+	.long	.LASF62
+	.value	0x101
+	.byte	0x12
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF86
+	.byte	0x1
+	.byte	0xe6
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x1cf6
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0xe6
+	.byte	0x2c
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0xe6
+	.byte	0x41
+	.long	0x36
+	.uleb128 0x6
+	.long	.LASF79
+	.byte	0xe7
+	.byte	0x11
+	.long	0x24f
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0xe8
+	.byte	0xa
+	.long	0x2a
+	.uleb128 0x1f
+	.uleb128 0x6
+	.long	.LASF75
+	.byte	0xea
+	.byte	0xd
+	.long	0x243
+	.uleb128 0x6
+	.long	.LASF62
+	.byte	0xeb
+	.byte	0x12
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF87
+	.byte	0x1
+	.byte	0xd4
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x1d59
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0xd4
+	.byte	0x37
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0xd4
+	.byte	0x4c
+	.long	0x36
+	.uleb128 0x6
+	.long	.LASF81
+	.byte	0xd5
+	.byte	0x11
+	.long	0x24f
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0xd6
+	.byte	0xa
+	.long	0x2a
+	.uleb128 0x1f
+	.uleb128 0x6
+	.long	.LASF75
+	.byte	0xd8
+	.byte	0xd
+	.long	0x243
+	.uleb128 0x6
+	.long	.LASF84
+	.byte	0xd9
+	.byte	0xd
+	.long	0x243
+	.uleb128 0x6
+	.long	.LASF62
+	.byte	0xda
+	.byte	0x12
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF88
+	.byte	0x1
+	.byte	0xc1
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x1dd3
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0xc1
+	.byte	0x32
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0xc1
+	.byte	0x47
+	.long	0x36
+	.uleb128 0x7
+	.long	.LASF69
+	.byte	0x1
+	.byte	0xc1
+	.byte	0x5a
+	.long	0x92
+	.uleb128 0x6
+	.long	.LASF83
+	.byte	0xc2
+	.byte	0x11
+	.long	0x24f
+	.uleb128 0x6
+	.long	.LASF79
+	.byte	0xc3
+	.byte	0x11
+	.long	0x24f
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0xc4
+	.byte	0xa
+	.long	0x2a
+	.uleb128 0x1f
+	.uleb128 0x6
+	.long	.LASF75
+	.byte	0xc6
+	.byte	0xd
+	.long	0x243
+	.uleb128 0x6
+	.long	.LASF84
+	.byte	0xc7
+	.byte	0xd
+	.long	0x243
+	.uleb128 0x6
+	.long	.LASF62
+	.byte	0xc8
+	.byte	0x12
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF89
+	.byte	0x1
+	.byte	0xa0
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x1e4c
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0xa0
+	.byte	0x2f
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0xa0
+	.byte	0x44
+	.long	0x36
+	.uleb128 0x6
+	.long	.LASF72
+	.byte	0xa1
+	.byte	0x11
+	.long	0x1da
+	.uleb128 0x6
+	.long	.LASF73
+	.byte	0xa2
+	.byte	0x11
+	.long	0x1da
+	.uleb128 0x6
+	.long	.LASF74
+	.byte	0xa3
+	.byte	0x11
+	.long	0x1da
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0xa4
+	.byte	0xa
+	.long	0x2a
+	.uleb128 0x1f
+	.uleb128 0x6
+	.long	.LASF75
+	.byte	0xa6
+	.byte	0xd
+	.long	0x1ce
+	.uleb128 0x6
+	.long	.LASF84
+	.byte	0xa8
+	.byte	0xd
+	.long	0x1ce
+	.uleb128 0x6
+	.long	.LASF62
+	.byte	0xab
+	.byte	0x12
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF90
+	.byte	0x1
+	.byte	0x8f
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x1ea4
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0x8f
+	.byte	0x2c
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x8f
+	.byte	0x41
+	.long	0x36
+	.uleb128 0x6
+	.long	.LASF79
+	.byte	0x90
+	.byte	0x11
+	.long	0x1da
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0x91
+	.byte	0xa
+	.long	0x2a
+	.uleb128 0x1f
+	.uleb128 0x6
+	.long	.LASF75
+	.byte	0x93
+	.byte	0xd
+	.long	0x1ce
+	.uleb128 0x6
+	.long	.LASF62
+	.byte	0x94
+	.byte	0x12
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF91
+	.byte	0x1
+	.byte	0x7c
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x1f07
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0x7c
+	.byte	0x37
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x7c
+	.byte	0x4c
+	.long	0x36
+	.uleb128 0x6
+	.long	.LASF81
+	.byte	0x7d
+	.byte	0x11
+	.long	0x1da
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0x7e
+	.byte	0xa
+	.long	0x2a
+	.uleb128 0x1f
+	.uleb128 0x6
+	.long	.LASF75
+	.byte	0x80
+	.byte	0xd
+	.long	0x1ce
+	.uleb128 0x6
+	.long	.LASF84
+	.byte	0x82
+	.byte	0xd
+	.long	0x1ce
+	.uleb128 0x6
+	.long	.LASF62
+	.byte	0x83
+	.byte	0x12
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF92
+	.byte	0x1
+	.byte	0x69
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x1f81
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0x69
+	.byte	0x32
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x69
+	.byte	0x47
+	.long	0x36
+	.uleb128 0x7
+	.long	.LASF69
+	.byte	0x1
+	.byte	0x69
+	.byte	0x5a
+	.long	0x92
+	.uleb128 0x6
+	.long	.LASF83
+	.byte	0x6a
+	.byte	0x11
+	.long	0x1da
+	.uleb128 0x6
+	.long	.LASF79
+	.byte	0x6b
+	.byte	0x11
+	.long	0x1da
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0x6c
+	.byte	0xa
+	.long	0x2a
+	.uleb128 0x1f
+	.uleb128 0x6
+	.long	.LASF75
+	.byte	0x6e
+	.byte	0xd
+	.long	0x1ce
+	.uleb128 0x6
+	.long	.LASF84
+	.byte	0x6f
+	.byte	0xd
+	.long	0x1ce
+	.uleb128 0x6
+	.long	.LASF62
+	.byte	0x70
+	.byte	0x12
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF93
+	.byte	0x1
+	.byte	0x51
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x1fb6
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0x51
+	.byte	0x31
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x51
+	.byte	0x46
+	.long	0x36
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0x52
+	.byte	0xa
+	.long	0x2a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF94
+	.byte	0x1
+	.byte	0x46
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x1feb
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0x46
+	.byte	0x2e
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x46
+	.byte	0x43
+	.long	0x36
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0x47
+	.byte	0xa
+	.long	0x2a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF95
+	.byte	0x1
+	.byte	0x3b
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x2020
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0x3b
+	.byte	0x39
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x3b
+	.byte	0x4e
+	.long	0x36
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0x3c
+	.byte	0xa
+	.long	0x2a
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF96
+	.byte	0x1
+	.byte	0x30
+	.byte	0xf
+	.long	0x2a
+	.byte	0x1
+	.long	0x2061
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.byte	0x30
+	.byte	0x34
+	.long	0xb5
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x30
+	.byte	0x49
+	.long	0x36
+	.uleb128 0x7
+	.long	.LASF69
+	.byte	0x1
+	.byte	0x30
+	.byte	0x5c
+	.long	0x92
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0x31
+	.byte	0xa
+	.long	0x2a
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF97
+	.byte	0x7
+	.value	0xa1c
+	.long	0x2b7
+	.long	0x208c
+	.uleb128 0x9
+	.string	"__X"
+	.byte	0x7
+	.value	0xa1c
+	.byte	0x21
+	.long	0xce2
+	.uleb128 0x9
+	.string	"__Y"
+	.byte	0x7
+	.value	0xa1c
+	.byte	0x2e
+	.long	0xce2
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF98
+	.byte	0x7
+	.value	0xa13
+	.long	0x2b7
+	.long	0x20b7
+	.uleb128 0x9
+	.string	"__X"
+	.byte	0x7
+	.value	0xa13
+	.byte	0x21
+	.long	0xce2
+	.uleb128 0x9
+	.string	"__Y"
+	.byte	0x7
+	.value	0xa13
+	.byte	0x2e
+	.long	0xce2
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF99
+	.byte	0x7
+	.value	0x675
+	.long	0x2b7
+	.long	0x20e2
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x7
+	.value	0x675
+	.byte	0x21
+	.long	0xce2
+	.uleb128 0x9
+	.string	"__B"
+	.byte	0x7
+	.value	0x675
+	.byte	0x2e
+	.long	0xce2
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF100
+	.byte	0x6
+	.value	0x195a
+	.long	0xce2
+	.long	0x2100
+	.uleb128 0x9
+	.string	"__P"
+	.byte	0x6
+	.value	0x195a
+	.byte	0x21
+	.long	0x9e
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF141
+	.byte	0x6
+	.value	0x14e
+	.long	0xce2
+	.uleb128 0x36
+	.long	.LASF101
+	.byte	0x6
+	.byte	0xd6
+	.long	0xce2
+	.long	0x2128
+	.uleb128 0x2d
+	.string	"__A"
+	.byte	0x6
+	.byte	0xd6
+	.byte	0x18
+	.long	0x8b
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF102
+	.byte	0x4
+	.value	0x23e
+	.long	0x243
+	.long	0x2153
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x4
+	.value	0x23e
+	.byte	0x1a
+	.long	0x243
+	.uleb128 0x9
+	.string	"__B"
+	.byte	0x4
+	.value	0x23e
+	.byte	0x27
+	.long	0x243
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF103
+	.byte	0x4
+	.value	0x1b1
+	.long	0x42
+	.long	0x2171
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x4
+	.value	0x1b1
+	.byte	0x1f
+	.long	0x243
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF104
+	.byte	0x4
+	.value	0x19c
+	.long	0x243
+	.long	0x219c
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x4
+	.value	0x19c
+	.byte	0x1a
+	.long	0x243
+	.uleb128 0x9
+	.string	"__B"
+	.byte	0x4
+	.value	0x19c
+	.byte	0x27
+	.long	0x243
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF105
+	.byte	0x4
+	.value	0x172
+	.long	0x243
+	.long	0x21c7
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x4
+	.value	0x172
+	.byte	0x1a
+	.long	0x243
+	.uleb128 0x9
+	.string	"__B"
+	.byte	0x4
+	.value	0x172
+	.byte	0x27
+	.long	0x243
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF106
+	.byte	0x4
+	.byte	0xe7
+	.long	0x243
+	.long	0x21ef
+	.uleb128 0x2d
+	.string	"__A"
+	.byte	0x4
+	.byte	0xe7
+	.byte	0x1c
+	.long	0x243
+	.uleb128 0x2d
+	.string	"__B"
+	.byte	0x4
+	.byte	0xe7
+	.byte	0x29
+	.long	0x243
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF107
+	.byte	0x5
+	.value	0x53c
+	.long	0x243
+	.long	0x220d
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x5
+	.value	0x53c
+	.byte	0x18
+	.long	0x8b
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF108
+	.byte	0x5
+	.value	0x505
+	.long	0x243
+	.long	0x23be
+	.uleb128 0x5
+	.long	.LASF109
+	.byte	0x5
+	.value	0x505
+	.byte	0x17
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF110
+	.byte	0x5
+	.value	0x505
+	.byte	0x23
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF111
+	.byte	0x5
+	.value	0x505
+	.byte	0x2f
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF112
+	.byte	0x5
+	.value	0x505
+	.byte	0x3b
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF113
+	.byte	0x5
+	.value	0x506
+	.byte	0xa
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF114
+	.byte	0x5
+	.value	0x506
+	.byte	0x16
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF115
+	.byte	0x5
+	.value	0x506
+	.byte	0x22
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF116
+	.byte	0x5
+	.value	0x506
+	.byte	0x2e
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF117
+	.byte	0x5
+	.value	0x507
+	.byte	0xa
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF118
+	.byte	0x5
+	.value	0x507
+	.byte	0x16
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF119
+	.byte	0x5
+	.value	0x507
+	.byte	0x22
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF120
+	.byte	0x5
+	.value	0x507
+	.byte	0x2e
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF121
+	.byte	0x5
+	.value	0x508
+	.byte	0xa
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF122
+	.byte	0x5
+	.value	0x508
+	.byte	0x16
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF123
+	.byte	0x5
+	.value	0x508
+	.byte	0x22
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF124
+	.byte	0x5
+	.value	0x508
+	.byte	0x2e
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF125
+	.byte	0x5
+	.value	0x509
+	.byte	0xa
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF126
+	.byte	0x5
+	.value	0x509
+	.byte	0x16
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF127
+	.byte	0x5
+	.value	0x509
+	.byte	0x22
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF128
+	.byte	0x5
+	.value	0x509
+	.byte	0x2e
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF129
+	.byte	0x5
+	.value	0x50a
+	.byte	0xa
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF130
+	.byte	0x5
+	.value	0x50a
+	.byte	0x16
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF131
+	.byte	0x5
+	.value	0x50a
+	.byte	0x22
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF132
+	.byte	0x5
+	.value	0x50a
+	.byte	0x2e
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF133
+	.byte	0x5
+	.value	0x50b
+	.byte	0xa
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF134
+	.byte	0x5
+	.value	0x50b
+	.byte	0x16
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF135
+	.byte	0x5
+	.value	0x50b
+	.byte	0x22
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF136
+	.byte	0x5
+	.value	0x50b
+	.byte	0x2e
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF137
+	.byte	0x5
+	.value	0x50c
+	.byte	0xa
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF138
+	.byte	0x5
+	.value	0x50c
+	.byte	0x16
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF139
+	.byte	0x5
+	.value	0x50c
+	.byte	0x22
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF140
+	.byte	0x5
+	.value	0x50c
+	.byte	0x2e
+	.long	0x8b
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF142
+	.byte	0x5
+	.value	0x4da
+	.long	0x243
+	.uleb128 0xe
+	.long	.LASF143
+	.byte	0x5
+	.value	0x39f
+	.long	0x243
+	.long	0x23e8
+	.uleb128 0x9
+	.string	"__P"
+	.byte	0x5
+	.value	0x39f
+	.byte	0x26
+	.long	0x23e8
+	.byte	0
+	.uleb128 0x1e
+	.long	0x26b
+	.uleb128 0xe
+	.long	.LASF144
+	.byte	0x3
+	.value	0x597
+	.long	0x42
+	.long	0x240b
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x3
+	.value	0x597
+	.byte	0x1c
+	.long	0x1ce
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF145
+	.byte	0x3
+	.value	0x591
+	.long	0x1ce
+	.long	0x2436
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x3
+	.value	0x591
+	.byte	0x17
+	.long	0x1ce
+	.uleb128 0x9
+	.string	"__B"
+	.byte	0x3
+	.value	0x591
+	.byte	0x24
+	.long	0x1ce
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF146
+	.byte	0x3
+	.value	0x585
+	.long	0x1ce
+	.long	0x2461
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x3
+	.value	0x585
+	.byte	0x17
+	.long	0x1ce
+	.uleb128 0x9
+	.string	"__B"
+	.byte	0x3
+	.value	0x585
+	.byte	0x24
+	.long	0x1ce
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF147
+	.byte	0x3
+	.value	0x535
+	.long	0x1ce
+	.long	0x248c
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x3
+	.value	0x535
+	.byte	0x19
+	.long	0x1ce
+	.uleb128 0x9
+	.string	"__B"
+	.byte	0x3
+	.value	0x535
+	.byte	0x26
+	.long	0x1ce
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF148
+	.byte	0x3
+	.value	0x529
+	.long	0x1ce
+	.long	0x24b7
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x3
+	.value	0x529
+	.byte	0x17
+	.long	0x1ce
+	.uleb128 0x9
+	.string	"__B"
+	.byte	0x3
+	.value	0x529
+	.byte	0x24
+	.long	0x1ce
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF149
+	.byte	0x3
+	.value	0x31a
+	.long	0x1ce
+	.uleb128 0xe
+	.long	.LASF150
+	.byte	0x3
+	.value	0x2bd
+	.long	0x1ce
+	.long	0x24e1
+	.uleb128 0x9
+	.string	"__P"
+	.byte	0x3
+	.value	0x2bd
+	.byte	0x23
+	.long	0x24e1
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1f6
+	.uleb128 0xe
+	.long	.LASF151
+	.byte	0x3
+	.value	0x28e
+	.long	0x1ce
+	.long	0x2504
+	.uleb128 0x9
+	.string	"__A"
+	.byte	0x3
+	.value	0x28e
+	.byte	0x15
+	.long	0x8b
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF152
+	.byte	0x3
+	.value	0x268
+	.long	0x1ce
+	.long	0x25e5
+	.uleb128 0x5
+	.long	.LASF125
+	.byte	0x3
+	.value	0x268
+	.byte	0x14
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF126
+	.byte	0x3
+	.value	0x268
+	.byte	0x20
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF127
+	.byte	0x3
+	.value	0x268
+	.byte	0x2c
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF128
+	.byte	0x3
+	.value	0x268
+	.byte	0x38
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF129
+	.byte	0x3
+	.value	0x269
+	.byte	0xd
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF130
+	.byte	0x3
+	.value	0x269
+	.byte	0x19
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF131
+	.byte	0x3
+	.value	0x269
+	.byte	0x25
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF132
+	.byte	0x3
+	.value	0x269
+	.byte	0x31
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF133
+	.byte	0x3
+	.value	0x26a
+	.byte	0xd
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF134
+	.byte	0x3
+	.value	0x26a
+	.byte	0x19
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF135
+	.byte	0x3
+	.value	0x26a
+	.byte	0x25
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF136
+	.byte	0x3
+	.value	0x26a
+	.byte	0x31
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF137
+	.byte	0x3
+	.value	0x26b
+	.byte	0xd
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF138
+	.byte	0x3
+	.value	0x26b
+	.byte	0x19
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF139
+	.byte	0x3
+	.value	0x26b
+	.byte	0x25
+	.long	0x8b
+	.uleb128 0x5
+	.long	.LASF140
+	.byte	0x3
+	.value	0x26b
+	.byte	0x31
+	.long	0x8b
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF153
+	.byte	0x2
+	.byte	0xd9
+	.byte	0x13
+	.long	0x42
+	.byte	0x3
+	.long	0x260f
+	.uleb128 0x7
+	.long	.LASF59
+	.byte	0x2
+	.byte	0xd9
+	.byte	0x43
+	.long	0x49d
+	.uleb128 0x7
+	.long	.LASF154
+	.byte	0x2
+	.byte	0xd9
+	.byte	0x5a
+	.long	0x92
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF155
+	.byte	0x2
+	.byte	0xca
+	.byte	0x13
+	.long	0x42
+	.byte	0x3
+	.long	0x2639
+	.uleb128 0x7
+	.long	.LASF154
+	.byte	0x2
+	.byte	0xca
+	.byte	0x29
+	.long	0x92
+	.uleb128 0x7
+	.long	.LASF156
+	.byte	0x2
+	.byte	0xca
+	.byte	0x43
+	.long	0x6c
+	.byte	0
+	.uleb128 0x16
+	.long	0x2020
+	.quad	.LFB6407
+	.quad	.LFE6407-.LFB6407
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2677
+	.uleb128 0x21
+	.long	0x2031
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x21
+	.long	0x203d
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x21
+	.long	0x2049
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.long	0x2055
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.uleb128 0x16
+	.long	0x1feb
+	.quad	.LFB6408
+	.quad	.LFE6408-.LFB6408
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x26ef
+	.uleb128 0x21
+	.long	0x1ffc
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.long	0x2008
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2
+	.long	0x2014
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xa
+	.long	0x260f
+	.quad	.LBI269
+	.byte	.LVU24
+	.quad	.LBB269
+	.quad	.LBE269-.LBB269
+	.byte	0x3d
+	.byte	0x1c
+	.uleb128 0x1
+	.long	0x262c
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0x2620
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x1fb6
+	.quad	.LFB6409
+	.quad	.LFE6409-.LFB6409
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x272c
+	.uleb128 0x21
+	.long	0x1fc7
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.long	0x1fd3
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2
+	.long	0x1fdf
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.uleb128 0x16
+	.long	0x1f81
+	.quad	.LFB6410
+	.quad	.LFE6410-.LFB6410
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x27a4
+	.uleb128 0x21
+	.long	0x1f92
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.long	0x1f9e
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x2
+	.long	0x1faa
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xa
+	.long	0x260f
+	.quad	.LBI271
+	.byte	.LVU56
+	.quad	.LBB271
+	.quad	.LBE271-.LBB271
+	.byte	0x53
+	.byte	0x1c
+	.uleb128 0x1
+	.long	0x262c
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x1
+	.long	0x2620
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x1dd3
+	.quad	.LFB6414
+	.quad	.LFE6414-.LFB6414
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a18
+	.uleb128 0x1
+	.long	0x1de4
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1
+	.long	0x1df0
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x8
+	.long	0x1dfc
+	.uleb128 0x8
+	.long	0x1e07
+	.uleb128 0x8
+	.long	0x1e12
+	.uleb128 0x2
+	.long	0x1e1d
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xd
+	.long	0x1e28
+	.long	.LLRL14
+	.long	0x2994
+	.uleb128 0x2
+	.long	0x1e29
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2
+	.long	0x1e34
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2
+	.long	0x1e3f
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x3
+	.long	0x240b
+	.quad	.LBI295
+	.byte	.LVU80
+	.long	.LLRL18
+	.byte	0xa8
+	.byte	0x17
+	.long	0x2854
+	.uleb128 0x4
+	.long	0x2428
+	.uleb128 0x1
+	.long	0x241b
+	.long	.LLST19
+	.long	.LVUS19
+	.byte	0
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI299
+	.byte	.LVU90
+	.long	.LLRL20
+	.byte	0xa9
+	.byte	0xf
+	.long	0x287f
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI302
+	.byte	.LVU98
+	.long	.LLRL22
+	.byte	0xaa
+	.byte	0xf
+	.long	0x28aa
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI307
+	.byte	.LVU76
+	.long	.LLRL24
+	.byte	0xa6
+	.byte	0x15
+	.long	0x28d0
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.uleb128 0xb
+	.long	0x2461
+	.quad	.LBI313
+	.byte	.LVU85
+	.quad	.LBB313
+	.quad	.LBE313-.LBB313
+	.byte	0xa8
+	.byte	0x17
+	.long	0x290f
+	.uleb128 0x1
+	.long	0x247e
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST27
+	.long	.LVUS27
+	.byte	0
+	.uleb128 0xb
+	.long	0x248c
+	.quad	.LBI316
+	.byte	.LVU94
+	.quad	.LBB316
+	.quad	.LBE316-.LBB316
+	.byte	0xa9
+	.byte	0xf
+	.long	0x294e
+	.uleb128 0x1
+	.long	0x24a9
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1
+	.long	0x249c
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0x3
+	.long	0x248c
+	.quad	.LBI319
+	.byte	.LVU102
+	.long	.LLRL30
+	.byte	0xaa
+	.byte	0xf
+	.long	0x2979
+	.uleb128 0x1
+	.long	0x24a9
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x4
+	.long	0x249c
+	.byte	0
+	.uleb128 0x18
+	.long	0x23ed
+	.quad	.LBI322
+	.byte	.LVU106
+	.long	.LLRL32
+	.byte	0xab
+	.byte	0x27
+	.uleb128 0x4
+	.long	0x23fd
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1f81
+	.quad	.LBI329
+	.byte	.LVU119
+	.quad	.LBB329
+	.quad	.LBE329-.LBB329
+	.byte	0xb0
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x1f9e
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1
+	.long	0x1f92
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x2
+	.long	0x1faa
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xa
+	.long	0x260f
+	.quad	.LBI331
+	.byte	.LVU129
+	.quad	.LBB331
+	.quad	.LBE331-.LBB331
+	.byte	0x53
+	.byte	0x1c
+	.uleb128 0x1
+	.long	0x262c
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1
+	.long	0x2620
+	.long	.LLST37
+	.long	.LVUS37
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x1e4c
+	.quad	.LFB6413
+	.quad	.LFE6413-.LFB6413
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2b4f
+	.uleb128 0x21
+	.long	0x1e5d
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.long	0x1e69
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x8
+	.long	0x1e75
+	.uleb128 0x2
+	.long	0x1e80
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0xd
+	.long	0x1e8b
+	.long	.LLRL40
+	.long	0x2b0c
+	.uleb128 0x2
+	.long	0x1e8c
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x2
+	.long	0x1e97
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI344
+	.byte	.LVU157
+	.long	.LLRL43
+	.byte	0x94
+	.byte	0x27
+	.long	0x2aab
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.uleb128 0xb
+	.long	0x24c3
+	.quad	.LBI347
+	.byte	.LVU153
+	.quad	.LBB347
+	.quad	.LBE347-.LBB347
+	.byte	0x93
+	.byte	0x15
+	.long	0x2add
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0xa
+	.long	0x23ed
+	.quad	.LBI350
+	.byte	.LVU161
+	.quad	.LBB350
+	.quad	.LBE350-.LBB350
+	.byte	0x94
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x23fd
+	.long	.LLST46
+	.long	.LVUS46
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x1fb6
+	.quad	.LBI353
+	.byte	.LVU172
+	.long	.LLRL47
+	.byte	0x99
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x1fd3
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1
+	.long	0x1fc7
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x14
+	.long	.LLRL47
+	.uleb128 0x2
+	.long	0x1fdf
+	.long	.LLST50
+	.long	.LVUS50
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x1f07
+	.quad	.LFB6411
+	.quad	.LFE6411-.LFB6411
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e1f
+	.uleb128 0x1
+	.long	0x1f18
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x1
+	.long	0x1f24
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x1
+	.long	0x1f30
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x2
+	.long	0x1f3c
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x8
+	.long	0x1f47
+	.uleb128 0x2
+	.long	0x1f52
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x3
+	.long	0x24e6
+	.quad	.LBI374
+	.byte	.LVU198
+	.long	.LLRL56
+	.byte	0x6a
+	.byte	0x1a
+	.long	0x2cbd
+	.uleb128 0x1
+	.long	0x24f6
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x1d
+	.long	0x2504
+	.quad	.LBI375
+	.byte	.LVU200
+	.long	.LLRL56
+	.byte	0x3
+	.value	0x290
+	.byte	0xa
+	.uleb128 0x1
+	.long	0x25d7
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x25ca
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x25bd
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x25b0
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x25a3
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x2596
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x2589
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x257c
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x256f
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x2562
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x2555
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x2548
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x253b
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x252e
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x2521
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0x2514
+	.long	.LLST58
+	.long	.LVUS58
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x1f5d
+	.long	.LLRL74
+	.long	0x2dd7
+	.uleb128 0x2
+	.long	0x1f5e
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x2
+	.long	0x1f69
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x2
+	.long	0x1f74
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI381
+	.byte	.LVU216
+	.long	.LLRL78
+	.byte	0x6f
+	.byte	0x17
+	.long	0x2d1c
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST79
+	.long	.LVUS79
+	.byte	0
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI385
+	.byte	.LVU212
+	.long	.LLRL80
+	.byte	0x6e
+	.byte	0x15
+	.long	0x2d42
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST81
+	.long	.LVUS81
+	.byte	0
+	.uleb128 0xb
+	.long	0x2461
+	.quad	.LBI391
+	.byte	.LVU221
+	.quad	.LBB391
+	.quad	.LBE391-.LBB391
+	.byte	0x6f
+	.byte	0x17
+	.long	0x2d81
+	.uleb128 0x1
+	.long	0x247e
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST83
+	.long	.LVUS83
+	.byte	0
+	.uleb128 0x3
+	.long	0x248c
+	.quad	.LBI393
+	.byte	.LVU225
+	.long	.LLRL84
+	.byte	0x6f
+	.byte	0x17
+	.long	0x2db4
+	.uleb128 0x1
+	.long	0x24a9
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x1
+	.long	0x249c
+	.long	.LLST86
+	.long	.LVUS86
+	.byte	0
+	.uleb128 0x18
+	.long	0x23ed
+	.quad	.LBI396
+	.byte	.LVU229
+	.long	.LLRL87
+	.byte	0x70
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x23fd
+	.long	.LLST88
+	.long	.LVUS88
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x2020
+	.quad	.LBI402
+	.byte	.LVU242
+	.long	.LLRL89
+	.byte	0x75
+	.byte	0x12
+	.uleb128 0x4
+	.long	0x2049
+	.uleb128 0x1
+	.long	0x203d
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x1
+	.long	0x2031
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x14
+	.long	.LLRL89
+	.uleb128 0x2
+	.long	0x2055
+	.long	.LLST92
+	.long	.LVUS92
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x1ea4
+	.quad	.LFB6412
+	.quad	.LFE6412-.LFB6412
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2fdd
+	.uleb128 0x1
+	.long	0x1eb5
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x1
+	.long	0x1ec1
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x8
+	.long	0x1ecd
+	.uleb128 0x2
+	.long	0x1ed8
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0xd
+	.long	0x1ee3
+	.long	.LLRL96
+	.long	0x2f59
+	.uleb128 0x2
+	.long	0x1ee4
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x2
+	.long	0x1eef
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x2
+	.long	0x1efa
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x3
+	.long	0x2436
+	.quad	.LBI421
+	.byte	.LVU281
+	.long	.LLRL100
+	.byte	0x82
+	.byte	0x17
+	.long	0x2ec5
+	.uleb128 0x4
+	.long	0x2453
+	.uleb128 0x1
+	.long	0x2446
+	.long	.LLST101
+	.long	.LVUS101
+	.byte	0
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI427
+	.byte	.LVU277
+	.long	.LLRL102
+	.byte	0x80
+	.byte	0x15
+	.long	0x2eeb
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST103
+	.long	.LVUS103
+	.byte	0
+	.uleb128 0xb
+	.long	0x2461
+	.quad	.LBI433
+	.byte	.LVU286
+	.quad	.LBB433
+	.quad	.LBE433-.LBB433
+	.byte	0x82
+	.byte	0x17
+	.long	0x2f2a
+	.uleb128 0x1
+	.long	0x247e
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST105
+	.long	.LVUS105
+	.byte	0
+	.uleb128 0xa
+	.long	0x23ed
+	.quad	.LBI435
+	.byte	.LVU291
+	.quad	.LBB435
+	.quad	.LBE435-.LBB435
+	.byte	0x83
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x23fd
+	.long	.LLST106
+	.long	.LVUS106
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1feb
+	.quad	.LBI439
+	.byte	.LVU302
+	.quad	.LBB439
+	.quad	.LBE439-.LBB439
+	.byte	0x88
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x2008
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x1
+	.long	0x1ffc
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x2
+	.long	0x2014
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0xa
+	.long	0x260f
+	.quad	.LBI441
+	.byte	.LVU312
+	.quad	.LBB441
+	.quad	.LBE441-.LBB441
+	.byte	0x3d
+	.byte	0x1c
+	.uleb128 0x1
+	.long	0x262c
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x1
+	.long	0x2620
+	.long	.LLST111
+	.long	.LVUS111
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x1c9e
+	.quad	.LFB6417
+	.quad	.LFE6417-.LFB6417
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3228
+	.uleb128 0x1
+	.long	0x1caf
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x1
+	.long	0x1cbb
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x8
+	.long	0x1cc7
+	.uleb128 0x2
+	.long	0x1cd2
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0xd
+	.long	0x1cdd
+	.long	.LLRL115
+	.long	0x30d7
+	.uleb128 0x2
+	.long	0x1cde
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x2
+	.long	0x1ce9
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x3
+	.long	0x21c7
+	.quad	.LBI470
+	.byte	.LVU340
+	.long	.LLRL118
+	.byte	0xeb
+	.byte	0x27
+	.long	0x3076
+	.uleb128 0x4
+	.long	0x21e2
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST119
+	.long	.LVUS119
+	.byte	0
+	.uleb128 0xb
+	.long	0x23ca
+	.quad	.LBI473
+	.byte	.LVU336
+	.quad	.LBB473
+	.quad	.LBE473-.LBB473
+	.byte	0xea
+	.byte	0x15
+	.long	0x30a8
+	.uleb128 0x1
+	.long	0x23da
+	.long	.LLST120
+	.long	.LVUS120
+	.byte	0
+	.uleb128 0xa
+	.long	0x2153
+	.quad	.LBI476
+	.byte	.LVU344
+	.quad	.LBB476
+	.quad	.LBE476-.LBB476
+	.byte	0xeb
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x2163
+	.long	.LLST121
+	.long	.LVUS121
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x1e4c
+	.quad	.LBI479
+	.byte	.LVU356
+	.long	.LLRL122
+	.byte	0xf0
+	.byte	0x12
+	.long	0x3211
+	.uleb128 0x1
+	.long	0x1e69
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x1
+	.long	0x1e5d
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x14
+	.long	.LLRL122
+	.uleb128 0x8
+	.long	0x1e75
+	.uleb128 0x2
+	.long	0x1e80
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0xd
+	.long	0x1e8b
+	.long	.LLRL126
+	.long	0x31c7
+	.uleb128 0x2
+	.long	0x1e8c
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x2
+	.long	0x1e97
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI482
+	.byte	.LVU363
+	.long	.LLRL129
+	.byte	0x93
+	.byte	0x15
+	.long	0x316d
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST130
+	.long	.LVUS130
+	.byte	0
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI485
+	.byte	.LVU367
+	.long	.LLRL131
+	.byte	0x94
+	.byte	0x27
+	.long	0x3198
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST132
+	.long	.LVUS132
+	.byte	0
+	.uleb128 0xa
+	.long	0x23ed
+	.quad	.LBI490
+	.byte	.LVU371
+	.quad	.LBB490
+	.quad	.LBE490-.LBB490
+	.byte	0x94
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x23fd
+	.long	.LLST133
+	.long	.LVUS133
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1fb6
+	.quad	.LBI492
+	.byte	.LVU382
+	.quad	.LBB492
+	.quad	.LBE492-.LBB492
+	.byte	0x99
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x1fd3
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x1
+	.long	0x1fc7
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x2
+	.long	0x1fdf
+	.long	.LLST136
+	.long	.LVUS136
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL136
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xf
+	.quad	.LVL140
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x16
+	.long	0x1d59
+	.quad	.LFB6415
+	.quad	.LFE6415-.LFB6415
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3870
+	.uleb128 0x1
+	.long	0x1d6a
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x1
+	.long	0x1d76
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x1
+	.long	0x1d82
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x2
+	.long	0x1d8e
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x8
+	.long	0x1d99
+	.uleb128 0x2
+	.long	0x1da4
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x3
+	.long	0x21ef
+	.quad	.LBI544
+	.byte	.LVU415
+	.long	.LLRL142
+	.byte	0xc2
+	.byte	0x1a
+	.long	0x3466
+	.uleb128 0x1
+	.long	0x21ff
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x1d
+	.long	0x220d
+	.quad	.LBI545
+	.byte	.LVU417
+	.long	.LLRL142
+	.byte	0x5
+	.value	0x53e
+	.byte	0xa
+	.uleb128 0x1
+	.long	0x23b0
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x23a3
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2396
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2389
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x237c
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x236f
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2362
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2355
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2348
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x233b
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x232e
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2321
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2314
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2307
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x22fa
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x22ed
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x22e0
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x22d3
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x22c6
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x22b9
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x22ac
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x229f
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2292
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2285
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2278
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x226b
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x225e
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2251
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2244
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2237
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x222a
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x221d
+	.long	.LLST144
+	.long	.LVUS144
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x1daf
+	.long	.LLRL176
+	.long	0x3580
+	.uleb128 0x2
+	.long	0x1db0
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x2
+	.long	0x1dbb
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x2
+	.long	0x1dc6
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x3
+	.long	0x21c7
+	.quad	.LBI551
+	.byte	.LVU433
+	.long	.LLRL180
+	.byte	0xc7
+	.byte	0x17
+	.long	0x34c5
+	.uleb128 0x4
+	.long	0x21e2
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST181
+	.long	.LVUS181
+	.byte	0
+	.uleb128 0x3
+	.long	0x23ca
+	.quad	.LBI555
+	.byte	.LVU429
+	.long	.LLRL182
+	.byte	0xc6
+	.byte	0x15
+	.long	0x34eb
+	.uleb128 0x1
+	.long	0x23da
+	.long	.LLST183
+	.long	.LVUS183
+	.byte	0
+	.uleb128 0xb
+	.long	0x21c7
+	.quad	.LBI561
+	.byte	.LVU438
+	.quad	.LBB561
+	.quad	.LBE561-.LBB561
+	.byte	0xc7
+	.byte	0x17
+	.long	0x352a
+	.uleb128 0x1
+	.long	0x21e2
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST185
+	.long	.LVUS185
+	.byte	0
+	.uleb128 0x3
+	.long	0x2128
+	.quad	.LBI563
+	.byte	.LVU442
+	.long	.LLRL186
+	.byte	0xc7
+	.byte	0x17
+	.long	0x355d
+	.uleb128 0x1
+	.long	0x2145
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0x1
+	.long	0x2138
+	.long	.LLST188
+	.long	.LVUS188
+	.byte	0
+	.uleb128 0x18
+	.long	0x2153
+	.quad	.LBI566
+	.byte	.LVU446
+	.long	.LLRL189
+	.byte	0xc8
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x2163
+	.long	.LLST190
+	.long	.LVUS190
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x1f07
+	.quad	.LBI572
+	.byte	.LVU461
+	.long	.LLRL191
+	.byte	0xcd
+	.byte	0x12
+	.long	0x3859
+	.uleb128 0x1
+	.long	0x1f30
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0x1
+	.long	0x1f24
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0x1
+	.long	0x1f18
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x14
+	.long	.LLRL191
+	.uleb128 0x2
+	.long	0x1f3c
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0x8
+	.long	0x1f47
+	.uleb128 0x2
+	.long	0x1f52
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x3
+	.long	0x24e6
+	.quad	.LBI574
+	.byte	.LVU463
+	.long	.LLRL197
+	.byte	0x6a
+	.byte	0x1a
+	.long	0x36f0
+	.uleb128 0x1
+	.long	0x24f6
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0x1d
+	.long	0x2504
+	.quad	.LBI575
+	.byte	.LVU465
+	.long	.LLRL197
+	.byte	0x3
+	.value	0x290
+	.byte	0xa
+	.uleb128 0x1
+	.long	0x25d7
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x25ca
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x25bd
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x25b0
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x25a3
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x2596
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x2589
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x257c
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x256f
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x2562
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x2555
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x2548
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x253b
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x252e
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x2521
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x2514
+	.long	.LLST199
+	.long	.LVUS199
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x1f5d
+	.long	.LLRL215
+	.long	0x380a
+	.uleb128 0x2
+	.long	0x1f5e
+	.long	.LLST216
+	.long	.LVUS216
+	.uleb128 0x2
+	.long	0x1f69
+	.long	.LLST217
+	.long	.LVUS217
+	.uleb128 0x2
+	.long	0x1f74
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI581
+	.byte	.LVU478
+	.long	.LLRL219
+	.byte	0x6e
+	.byte	0x15
+	.long	0x374a
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST220
+	.long	.LVUS220
+	.byte	0
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI585
+	.byte	.LVU482
+	.long	.LLRL221
+	.byte	0x6f
+	.byte	0x17
+	.long	0x3775
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST222
+	.long	.LVUS222
+	.byte	0
+	.uleb128 0xb
+	.long	0x2461
+	.quad	.LBI593
+	.byte	.LVU487
+	.quad	.LBB593
+	.quad	.LBE593-.LBB593
+	.byte	0x6f
+	.byte	0x17
+	.long	0x37b4
+	.uleb128 0x1
+	.long	0x247e
+	.long	.LLST223
+	.long	.LVUS223
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST224
+	.long	.LVUS224
+	.byte	0
+	.uleb128 0x3
+	.long	0x248c
+	.quad	.LBI595
+	.byte	.LVU491
+	.long	.LLRL225
+	.byte	0x6f
+	.byte	0x17
+	.long	0x37e7
+	.uleb128 0x1
+	.long	0x24a9
+	.long	.LLST226
+	.long	.LVUS226
+	.uleb128 0x1
+	.long	0x249c
+	.long	.LLST227
+	.long	.LVUS227
+	.byte	0
+	.uleb128 0x18
+	.long	0x23ed
+	.quad	.LBI598
+	.byte	.LVU495
+	.long	.LLRL228
+	.byte	0x70
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x23fd
+	.long	.LLST229
+	.long	.LVUS229
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x2020
+	.quad	.LBI604
+	.byte	.LVU508
+	.quad	.LBB604
+	.quad	.LBE604-.LBB604
+	.byte	0x75
+	.byte	0x12
+	.uleb128 0x4
+	.long	0x2049
+	.uleb128 0x1
+	.long	0x203d
+	.long	.LLST230
+	.long	.LVUS230
+	.uleb128 0x1
+	.long	0x2031
+	.long	.LLST231
+	.long	.LVUS231
+	.uleb128 0x2
+	.long	0x2055
+	.long	.LLST232
+	.long	.LVUS232
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL175
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xf
+	.quad	.LVL179
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x16
+	.long	0x1cf6
+	.quad	.LFB6416
+	.quad	.LFE6416-.LFB6416
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3b82
+	.uleb128 0x1
+	.long	0x1d07
+	.long	.LLST233
+	.long	.LVUS233
+	.uleb128 0x1
+	.long	0x1d13
+	.long	.LLST234
+	.long	.LVUS234
+	.uleb128 0x8
+	.long	0x1d1f
+	.uleb128 0x2
+	.long	0x1d2a
+	.long	.LLST235
+	.long	.LVUS235
+	.uleb128 0xd
+	.long	0x1d35
+	.long	.LLRL236
+	.long	0x39aa
+	.uleb128 0x2
+	.long	0x1d36
+	.long	.LLST237
+	.long	.LVUS237
+	.uleb128 0x2
+	.long	0x1d41
+	.long	.LLST238
+	.long	.LVUS238
+	.uleb128 0x2
+	.long	0x1d4c
+	.long	.LLST239
+	.long	.LVUS239
+	.uleb128 0x3
+	.long	0x219c
+	.quad	.LBI646
+	.byte	.LVU553
+	.long	.LLRL240
+	.byte	0xd9
+	.byte	0x17
+	.long	0x3916
+	.uleb128 0x4
+	.long	0x21b9
+	.uleb128 0x1
+	.long	0x21ac
+	.long	.LLST241
+	.long	.LVUS241
+	.byte	0
+	.uleb128 0x3
+	.long	0x23ca
+	.quad	.LBI652
+	.byte	.LVU549
+	.long	.LLRL242
+	.byte	0xd8
+	.byte	0x15
+	.long	0x393c
+	.uleb128 0x1
+	.long	0x23da
+	.long	.LLST243
+	.long	.LVUS243
+	.byte	0
+	.uleb128 0xb
+	.long	0x21c7
+	.quad	.LBI658
+	.byte	.LVU558
+	.quad	.LBB658
+	.quad	.LBE658-.LBB658
+	.byte	0xd9
+	.byte	0x17
+	.long	0x397b
+	.uleb128 0x1
+	.long	0x21e2
+	.long	.LLST244
+	.long	.LVUS244
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST245
+	.long	.LVUS245
+	.byte	0
+	.uleb128 0xa
+	.long	0x2153
+	.quad	.LBI660
+	.byte	.LVU563
+	.quad	.LBB660
+	.quad	.LBE660-.LBB660
+	.byte	0xda
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x2163
+	.long	.LLST246
+	.long	.LVUS246
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x1ea4
+	.quad	.LBI664
+	.byte	.LVU576
+	.long	.LLRL247
+	.byte	0xdf
+	.byte	0x12
+	.long	0x3b6b
+	.uleb128 0x1
+	.long	0x1ec1
+	.long	.LLST248
+	.long	.LVUS248
+	.uleb128 0x1
+	.long	0x1eb5
+	.long	.LLST249
+	.long	.LVUS249
+	.uleb128 0x14
+	.long	.LLRL247
+	.uleb128 0x8
+	.long	0x1ecd
+	.uleb128 0x2
+	.long	0x1ed8
+	.long	.LLST250
+	.long	.LVUS250
+	.uleb128 0xd
+	.long	0x1ee3
+	.long	.LLRL251
+	.long	0x3ae6
+	.uleb128 0x2
+	.long	0x1ee4
+	.long	.LLST252
+	.long	.LVUS252
+	.uleb128 0x2
+	.long	0x1eef
+	.long	.LLST253
+	.long	.LVUS253
+	.uleb128 0x2
+	.long	0x1efa
+	.long	.LLST254
+	.long	.LVUS254
+	.uleb128 0x3
+	.long	0x2436
+	.quad	.LBI667
+	.byte	.LVU586
+	.long	.LLRL255
+	.byte	0x82
+	.byte	0x17
+	.long	0x3a52
+	.uleb128 0x4
+	.long	0x2453
+	.uleb128 0x1
+	.long	0x2446
+	.long	.LLST256
+	.long	.LVUS256
+	.byte	0
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI672
+	.byte	.LVU582
+	.long	.LLRL257
+	.byte	0x80
+	.byte	0x15
+	.long	0x3a78
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST258
+	.long	.LVUS258
+	.byte	0
+	.uleb128 0xb
+	.long	0x2461
+	.quad	.LBI681
+	.byte	.LVU591
+	.quad	.LBB681
+	.quad	.LBE681-.LBB681
+	.byte	0x82
+	.byte	0x17
+	.long	0x3ab7
+	.uleb128 0x1
+	.long	0x247e
+	.long	.LLST259
+	.long	.LVUS259
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST260
+	.long	.LVUS260
+	.byte	0
+	.uleb128 0xa
+	.long	0x23ed
+	.quad	.LBI683
+	.byte	.LVU596
+	.quad	.LBB683
+	.quad	.LBE683-.LBB683
+	.byte	0x83
+	.byte	0x27
+	.uleb128 0x1
+	.long	0x23fd
+	.long	.LLST261
+	.long	.LVUS261
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1feb
+	.quad	.LBI686
+	.byte	.LVU607
+	.quad	.LBB686
+	.quad	.LBE686-.LBB686
+	.byte	0x88
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x2008
+	.long	.LLST262
+	.long	.LVUS262
+	.uleb128 0x1
+	.long	0x1ffc
+	.long	.LLST263
+	.long	.LVUS263
+	.uleb128 0x2
+	.long	0x2014
+	.long	.LLST264
+	.long	.LVUS264
+	.uleb128 0xa
+	.long	0x260f
+	.quad	.LBI688
+	.byte	.LVU618
+	.quad	.LBB688
+	.quad	.LBE688-.LBB688
+	.byte	0x3d
+	.byte	0x1c
+	.uleb128 0x1
+	.long	0x262c
+	.long	.LLST265
+	.long	.LVUS265
+	.uleb128 0x1
+	.long	0x2620
+	.long	.LLST266
+	.long	.LVUS266
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL207
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xf
+	.quad	.LVL211
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x16
+	.long	0x1c24
+	.quad	.LFB6418
+	.quad	.LFE6418-.LFB6418
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4005
+	.uleb128 0x1
+	.long	0x1c35
+	.long	.LLST459
+	.long	.LVUS459
+	.uleb128 0x1
+	.long	0x1c41
+	.long	.LLST460
+	.long	.LVUS460
+	.uleb128 0x8
+	.long	0x1c4d
+	.uleb128 0x8
+	.long	0x1c58
+	.uleb128 0x8
+	.long	0x1c63
+	.uleb128 0x2
+	.long	0x1c6e
+	.long	.LLST461
+	.long	.LVUS461
+	.uleb128 0xd
+	.long	0x1c79
+	.long	.LLRL462
+	.long	0x3d76
+	.uleb128 0x2
+	.long	0x1c7a
+	.long	.LLST463
+	.long	.LVUS463
+	.uleb128 0x2
+	.long	0x1c85
+	.long	.LLST464
+	.long	.LVUS464
+	.uleb128 0x2
+	.long	0x1c90
+	.long	.LLST465
+	.long	.LVUS465
+	.uleb128 0x3
+	.long	0x2171
+	.quad	.LBI1068
+	.byte	.LVU1083
+	.long	.LLRL466
+	.byte	0xfe
+	.byte	0x17
+	.long	0x3c32
+	.uleb128 0x4
+	.long	0x218e
+	.uleb128 0x1
+	.long	0x2181
+	.long	.LLST467
+	.long	.LVUS467
+	.byte	0
+	.uleb128 0x3
+	.long	0x21c7
+	.quad	.LBI1072
+	.byte	.LVU1093
+	.long	.LLRL468
+	.byte	0xff
+	.byte	0xf
+	.long	0x3c5d
+	.uleb128 0x4
+	.long	0x21e2
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST469
+	.long	.LVUS469
+	.byte	0
+	.uleb128 0x11
+	.long	0x21c7
+	.quad	.LBI1075
+	.byte	.LVU1101
+	.long	.LLRL470
+	.value	0x100
+	.byte	0xf
+	.long	0x3c89
+	.uleb128 0x4
+	.long	0x21e2
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST471
+	.long	.LVUS471
+	.byte	0
+	.uleb128 0x3
+	.long	0x23ca
+	.quad	.LBI1080
+	.byte	.LVU1079
+	.long	.LLRL472
+	.byte	0xfd
+	.byte	0x15
+	.long	0x3caf
+	.uleb128 0x1
+	.long	0x23da
+	.long	.LLST473
+	.long	.LVUS473
+	.byte	0
+	.uleb128 0xb
+	.long	0x21c7
+	.quad	.LBI1086
+	.byte	.LVU1088
+	.quad	.LBB1086
+	.quad	.LBE1086-.LBB1086
+	.byte	0xfe
+	.byte	0x17
+	.long	0x3cee
+	.uleb128 0x1
+	.long	0x21e2
+	.long	.LLST474
+	.long	.LVUS474
+	.uleb128 0x1
+	.long	0x21d6
+	.long	.LLST475
+	.long	.LVUS475
+	.byte	0
+	.uleb128 0xb
+	.long	0x2128
+	.quad	.LBI1089
+	.byte	.LVU1097
+	.quad	.LBB1089
+	.quad	.LBE1089-.LBB1089
+	.byte	0xff
+	.byte	0xf
+	.long	0x3d2d
+	.uleb128 0x1
+	.long	0x2145
+	.long	.LLST476
+	.long	.LVUS476
+	.uleb128 0x1
+	.long	0x2138
+	.long	.LLST477
+	.long	.LVUS477
+	.byte	0
+	.uleb128 0x11
+	.long	0x2128
+	.quad	.LBI1092
+	.byte	.LVU1105
+	.long	.LLRL478
+	.value	0x100
+	.byte	0xf
+	.long	0x3d59
+	.uleb128 0x1
+	.long	0x2145
+	.long	.LLST479
+	.long	.LVUS479
+	.uleb128 0x4
+	.long	0x2138
+	.byte	0
+	.uleb128 0x1d
+	.long	0x2153
+	.quad	.LBI1095
+	.byte	.LVU1109
+	.long	.LLRL480
+	.byte	0x1
+	.value	0x101
+	.byte	0x27
+	.uleb128 0x4
+	.long	0x2163
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x1dd3
+	.quad	.LBI1102
+	.byte	.LVU1125
+	.long	.LLRL481
+	.value	0x106
+	.byte	0x12
+	.long	0x3fee
+	.uleb128 0x1
+	.long	0x1df0
+	.long	.LLST482
+	.long	.LVUS482
+	.uleb128 0x1
+	.long	0x1de4
+	.long	.LLST483
+	.long	.LVUS483
+	.uleb128 0x14
+	.long	.LLRL481
+	.uleb128 0x8
+	.long	0x1dfc
+	.uleb128 0x8
+	.long	0x1e07
+	.uleb128 0x8
+	.long	0x1e12
+	.uleb128 0x2
+	.long	0x1e1d
+	.long	.LLST484
+	.long	.LVUS484
+	.uleb128 0xd
+	.long	0x1e28
+	.long	.LLRL485
+	.long	0x3f69
+	.uleb128 0x2
+	.long	0x1e29
+	.long	.LLST486
+	.long	.LVUS486
+	.uleb128 0x2
+	.long	0x1e34
+	.long	.LLST487
+	.long	.LVUS487
+	.uleb128 0x2
+	.long	0x1e3f
+	.long	.LLST488
+	.long	.LVUS488
+	.uleb128 0x3
+	.long	0x240b
+	.quad	.LBI1105
+	.byte	.LVU1135
+	.long	.LLRL489
+	.byte	0xa8
+	.byte	0x17
+	.long	0x3e29
+	.uleb128 0x4
+	.long	0x2428
+	.uleb128 0x1
+	.long	0x241b
+	.long	.LLST490
+	.long	.LVUS490
+	.byte	0
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI1109
+	.byte	.LVU1145
+	.long	.LLRL491
+	.byte	0xa9
+	.byte	0xf
+	.long	0x3e54
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST492
+	.long	.LVUS492
+	.byte	0
+	.uleb128 0x3
+	.long	0x2461
+	.quad	.LBI1112
+	.byte	.LVU1153
+	.long	.LLRL493
+	.byte	0xaa
+	.byte	0xf
+	.long	0x3e7f
+	.uleb128 0x4
+	.long	0x247e
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST494
+	.long	.LVUS494
+	.byte	0
+	.uleb128 0x3
+	.long	0x24c3
+	.quad	.LBI1116
+	.byte	.LVU1131
+	.long	.LLRL495
+	.byte	0xa6
+	.byte	0x15
+	.long	0x3ea5
+	.uleb128 0x1
+	.long	0x24d3
+	.long	.LLST496
+	.long	.LVUS496
+	.byte	0
+	.uleb128 0xb
+	.long	0x2461
+	.quad	.LBI1125
+	.byte	.LVU1140
+	.quad	.LBB1125
+	.quad	.LBE1125-.LBB1125
+	.byte	0xa8
+	.byte	0x17
+	.long	0x3ee4
+	.uleb128 0x1
+	.long	0x247e
+	.long	.LLST497
+	.long	.LVUS497
+	.uleb128 0x1
+	.long	0x2471
+	.long	.LLST498
+	.long	.LVUS498
+	.byte	0
+	.uleb128 0xb
+	.long	0x248c
+	.quad	.LBI1128
+	.byte	.LVU1149
+	.quad	.LBB1128
+	.quad	.LBE1128-.LBB1128
+	.byte	0xa9
+	.byte	0xf
+	.long	0x3f23
+	.uleb128 0x1
+	.long	0x24a9
+	.long	.LLST499
+	.long	.LVUS499
+	.uleb128 0x1
+	.long	0x249c
+	.long	.LLST500
+	.long	.LVUS500
+	.byte	0
+	.uleb128 0x3
+	.long	0x248c
+	.quad	.LBI1131
+	.byte	.LVU1157
+	.long	.LLRL501
+	.byte	0xaa
+	.byte	0xf
+	.long	0x3f4e
+	.uleb128 0x1
+	.long	0x24a9
+	.long	.LLST502
+	.long	.LVUS502
+	.uleb128 0x4
+	.long	0x249c
+	.byte	0
+	.uleb128 0x18
+	.long	0x23ed
+	.quad	.LBI1134
+	.byte	.LVU1161
+	.long	.LLRL503
+	.byte	0xab
+	.byte	0x27
+	.uleb128 0x4
+	.long	0x23fd
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1f81
+	.quad	.LBI1140
+	.byte	.LVU1174
+	.quad	.LBB1140
+	.quad	.LBE1140-.LBB1140
+	.byte	0xb0
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x1f9e
+	.long	.LLST504
+	.long	.LVUS504
+	.uleb128 0x1
+	.long	0x1f92
+	.long	.LLST505
+	.long	.LVUS505
+	.uleb128 0x2
+	.long	0x1faa
+	.long	.LLST506
+	.long	.LVUS506
+	.uleb128 0xa
+	.long	0x260f
+	.quad	.LBI1142
+	.byte	.LVU1185
+	.quad	.LBB1142
+	.quad	.LBE1142-.LBB1142
+	.byte	0x53
+	.byte	0x1c
+	.uleb128 0x1
+	.long	0x262c
+	.long	.LLST507
+	.long	.LVUS507
+	.uleb128 0x1
+	.long	0x2620
+	.long	.LLST508
+	.long	.LVUS508
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL386
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xf
+	.quad	.LVL390
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x16
+	.long	0x6d5
+	.quad	.LFB6423
+	.quad	.LFE6423-.LFB6423
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x406e
+	.uleb128 0x1
+	.long	0x6e4
+	.long	.LLST574
+	.long	.LVUS574
+	.uleb128 0x2a
+	.long	0x6d5
+	.quad	.LBI1326
+	.byte	.LVU1401
+	.quad	.LBB1326
+	.quad	.LBE1326-.LBB1326
+	.value	0x174
+	.byte	0x5
+	.long	0x4060
+	.uleb128 0x1
+	.long	0x6e4
+	.long	.LLST575
+	.long	.LVUS575
+	.byte	0
+	.uleb128 0x42
+	.quad	.LVL447
+	.long	0x40de
+	.byte	0
+	.uleb128 0x16
+	.long	0x6b8
+	.quad	.LFB6424
+	.quad	.LFE6424-.LFB6424
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x40de
+	.uleb128 0x1
+	.long	0x6c7
+	.long	.LLST576
+	.long	.LVUS576
+	.uleb128 0x2a
+	.long	0x6b8
+	.quad	.LBI1330
+	.byte	.LVU1425
+	.quad	.LBB1330
+	.quad	.LBE1330-.LBB1330
+	.value	0x18c
+	.byte	0x5
+	.long	0x40c9
+	.uleb128 0x1
+	.long	0x6c7
+	.long	.LLST577
+	.long	.LVUS577
+	.byte	0
+	.uleb128 0x33
+	.quad	.LVL456
+	.long	0x6d5
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF160
+	.long	.LASF160
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 39
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS588:
+	.uleb128 0
+	.uleb128 .LVU1480
+	.uleb128 .LVU1480
+	.uleb128 0
+.LLST588:
+	.byte	0x6
+	.quad	.LVL474
+	.byte	0x4
+	.uleb128 .LVL474-.LVL474
+	.uleb128 .LVL477-.LVL474
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL477-.LVL474
+	.uleb128 .LFE6431-.LVL474
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS589:
+	.uleb128 0
+	.uleb128 .LVU1479
+	.uleb128 .LVU1479
+	.uleb128 0
+.LLST589:
+	.byte	0x6
+	.quad	.LVL474
+	.byte	0x4
+	.uleb128 .LVL474-.LVL474
+	.uleb128 .LVL476-.LVL474
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL476-.LVL474
+	.uleb128 .LFE6431-.LVL474
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS590:
+	.uleb128 .LVU1474
+	.uleb128 .LVU1476
+	.uleb128 .LVU1476
+	.uleb128 .LVU1512
+	.uleb128 .LVU1512
+	.uleb128 .LVU1532
+	.uleb128 .LVU1532
+	.uleb128 .LVU1533
+	.uleb128 .LVU1533
+	.uleb128 .LVU1534
+	.uleb128 .LVU1534
+	.uleb128 0
+.LLST590:
+	.byte	0x6
+	.quad	.LVL474
+	.byte	0x4
+	.uleb128 .LVL474-.LVL474
+	.uleb128 .LVL475-.LVL474
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL475-.LVL474
+	.uleb128 .LVL485-.LVL474
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL485-.LVL474
+	.uleb128 .LVL491-.LVL474
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL491-.LVL474
+	.uleb128 .LVL492-.LVL474
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL492-.LVL474
+	.uleb128 .LVL493-.LVL474
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL493-.LVL474
+	.uleb128 .LFE6431-.LVL474
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS592:
+	.uleb128 .LVU1481
+	.uleb128 .LVU1497
+	.uleb128 .LVU1499
+	.uleb128 .LVU1505
+.LLST592:
+	.byte	0x6
+	.quad	.LVL477
+	.byte	0x4
+	.uleb128 .LVL477-.LVL477
+	.uleb128 .LVL480-.LVL477
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL481-.LVL477
+	.uleb128 .LVL483-.LVL477
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS593:
+	.uleb128 .LVU1493
+	.uleb128 .LVU1496
+	.uleb128 .LVU1499
+	.uleb128 .LVU1505
+.LLST593:
+	.byte	0x6
+	.quad	.LVL478
+	.byte	0x4
+	.uleb128 .LVL478-.LVL478
+	.uleb128 .LVL479-.LVL478
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL481-.LVL478
+	.uleb128 .LVL483-.LVL478
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS595:
+	.uleb128 .LVU1506
+	.uleb128 .LVU1508
+	.uleb128 .LVU1513
+	.uleb128 .LVU1515
+	.uleb128 .LVU1520
+	.uleb128 .LVU1522
+	.uleb128 .LVU1527
+	.uleb128 .LVU1529
+.LLST595:
+	.byte	0x8
+	.quad	.LVL484
+	.uleb128 .LVL484-.LVL484
+	.uleb128 0x5
+	.byte	0x75
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.quad	.LVL486
+	.uleb128 .LVL486-.LVL486
+	.uleb128 0x7
+	.byte	0x75
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x8
+	.quad	.LVL488
+	.uleb128 .LVL488-.LVL488
+	.uleb128 0x7
+	.byte	0x75
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x8
+	.quad	.LVL490
+	.uleb128 .LVL490-.LVL490
+	.uleb128 0x7
+	.byte	0x75
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0
+.LVUS596:
+	.uleb128 .LVU1506
+	.uleb128 .LVU1508
+	.uleb128 .LVU1513
+	.uleb128 .LVU1515
+	.uleb128 .LVU1520
+	.uleb128 .LVU1522
+	.uleb128 .LVU1527
+	.uleb128 .LVU1529
+.LLST596:
+	.byte	0x8
+	.quad	.LVL484
+	.uleb128 .LVL484-.LVL484
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x8
+	.quad	.LVL486
+	.uleb128 .LVL486-.LVL486
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x8
+	.quad	.LVL488
+	.uleb128 .LVL488-.LVL488
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x8
+	.quad	.LVL490
+	.uleb128 .LVL490-.LVL490
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS586:
+	.uleb128 0
+	.uleb128 .LVU1471
+	.uleb128 .LVU1471
+	.uleb128 0
+.LLST586:
+	.byte	0x6
+	.quad	.LVL472
+	.byte	0x4
+	.uleb128 .LVL472-.LVL472
+	.uleb128 .LVL473-1-.LVL472
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL473-1-.LVL472
+	.uleb128 .LFE6430-.LVL472
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS587:
+	.uleb128 0
+	.uleb128 .LVU1471
+	.uleb128 .LVU1471
+	.uleb128 0
+.LLST587:
+	.byte	0x6
+	.quad	.LVL472
+	.byte	0x4
+	.uleb128 .LVL472-.LVL472
+	.uleb128 .LVL473-1-.LVL472
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL473-1-.LVL472
+	.uleb128 .LFE6430-.LVL472
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS584:
+	.uleb128 0
+	.uleb128 .LVU1466
+	.uleb128 .LVU1466
+	.uleb128 0
+.LLST584:
+	.byte	0x6
+	.quad	.LVL470
+	.byte	0x4
+	.uleb128 .LVL470-.LVL470
+	.uleb128 .LVL471-1-.LVL470
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL471-1-.LVL470
+	.uleb128 .LFE6429-.LVL470
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS585:
+	.uleb128 0
+	.uleb128 .LVU1466
+	.uleb128 .LVU1466
+	.uleb128 0
+.LLST585:
+	.byte	0x6
+	.quad	.LVL470
+	.byte	0x4
+	.uleb128 .LVL470-.LVL470
+	.uleb128 .LVL471-1-.LVL470
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL471-1-.LVL470
+	.uleb128 .LFE6429-.LVL470
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS582:
+	.uleb128 0
+	.uleb128 .LVU1461
+	.uleb128 .LVU1461
+	.uleb128 0
+.LLST582:
+	.byte	0x6
+	.quad	.LVL468
+	.byte	0x4
+	.uleb128 .LVL468-.LVL468
+	.uleb128 .LVL469-1-.LVL468
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL469-1-.LVL468
+	.uleb128 .LFE6428-.LVL468
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS583:
+	.uleb128 0
+	.uleb128 .LVU1461
+	.uleb128 .LVU1461
+	.uleb128 0
+.LLST583:
+	.byte	0x6
+	.quad	.LVL468
+	.byte	0x4
+	.uleb128 .LVL468-.LVL468
+	.uleb128 .LVL469-1-.LVL468
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL469-1-.LVL468
+	.uleb128 .LFE6428-.LVL468
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS579:
+	.uleb128 0
+	.uleb128 .LVU1456
+	.uleb128 .LVU1456
+	.uleb128 0
+.LLST579:
+	.byte	0x6
+	.quad	.LVL466
+	.byte	0x4
+	.uleb128 .LVL466-.LVL466
+	.uleb128 .LVL467-1-.LVL466
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL467-1-.LVL466
+	.uleb128 .LFE6427-.LVL466
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS580:
+	.uleb128 0
+	.uleb128 .LVU1456
+	.uleb128 .LVU1456
+	.uleb128 0
+.LLST580:
+	.byte	0x6
+	.quad	.LVL466
+	.byte	0x4
+	.uleb128 .LVL466-.LVL466
+	.uleb128 .LVL467-1-.LVL466
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL467-1-.LVL466
+	.uleb128 .LFE6427-.LVL466
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS581:
+	.uleb128 0
+	.uleb128 .LVU1456
+	.uleb128 .LVU1456
+	.uleb128 0
+.LLST581:
+	.byte	0x6
+	.quad	.LVL466
+	.byte	0x4
+	.uleb128 .LVL466-.LVL466
+	.uleb128 .LVL467-1-.LVL466
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL467-1-.LVL466
+	.uleb128 .LFE6427-.LVL466
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS578:
+	.uleb128 .LVU1440
+	.uleb128 .LVU1444
+	.uleb128 .LVU1444
+	.uleb128 .LVU1447
+	.uleb128 .LVU1447
+	.uleb128 .LVU1448
+	.uleb128 .LVU1448
+	.uleb128 .LVU1450
+.LLST578:
+	.byte	0x6
+	.quad	.LVL460
+	.byte	0x4
+	.uleb128 .LVL460-.LVL460
+	.uleb128 .LVL461-.LVL460
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL461-.LVL460
+	.uleb128 .LVL463-.LVL460
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL463-.LVL460
+	.uleb128 .LVL464-.LVL460
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL464-.LVL460
+	.uleb128 .LVL465-.LVL460
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS509:
+	.uleb128 0
+	.uleb128 .LVU1219
+	.uleb128 .LVU1219
+	.uleb128 .LVU1360
+	.uleb128 .LVU1360
+	.uleb128 .LVU1372
+	.uleb128 .LVU1372
+	.uleb128 .LVU1382
+	.uleb128 .LVU1382
+	.uleb128 .LVU1386
+	.uleb128 .LVU1386
+	.uleb128 .LVU1390
+	.uleb128 .LVU1390
+	.uleb128 0
+.LLST509:
+	.byte	0x6
+	.quad	.LVL396
+	.byte	0x4
+	.uleb128 .LVL396-.LVL396
+	.uleb128 .LVL397-.LVL396
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL397-.LVL396
+	.uleb128 .LVL426-.LVL396
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL426-.LVL396
+	.uleb128 .LVL432-.LVL396
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL432-.LVL396
+	.uleb128 .LVL438-.LVL396
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL438-.LVL396
+	.uleb128 .LVL441-.LVL396
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL441-.LVL396
+	.uleb128 .LVL444-.LVL396
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL444-.LVL396
+	.uleb128 .LFE6422-.LVL396
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS510:
+	.uleb128 0
+	.uleb128 .LVU1251
+	.uleb128 .LVU1251
+	.uleb128 .LVU1372
+	.uleb128 .LVU1372
+	.uleb128 .LVU1379
+	.uleb128 .LVU1379
+	.uleb128 0
+.LLST510:
+	.byte	0x6
+	.quad	.LVL396
+	.byte	0x4
+	.uleb128 .LVL396-.LVL396
+	.uleb128 .LVL404-.LVL396
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL404-.LVL396
+	.uleb128 .LVL432-.LVL396
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL432-.LVL396
+	.uleb128 .LVL436-.LVL396
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL436-.LVL396
+	.uleb128 .LFE6422-.LVL396
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS511:
+	.uleb128 .LVU1212
+	.uleb128 .LVU1219
+	.uleb128 .LVU1219
+	.uleb128 .LVU1243
+	.uleb128 .LVU1243
+	.uleb128 .LVU1246
+	.uleb128 .LVU1246
+	.uleb128 .LVU1376
+	.uleb128 .LVU1376
+	.uleb128 .LVU1379
+	.uleb128 .LVU1379
+	.uleb128 .LVU1384
+	.uleb128 .LVU1386
+	.uleb128 0
+.LLST511:
+	.byte	0x6
+	.quad	.LVL396
+	.byte	0x4
+	.uleb128 .LVL396-.LVL396
+	.uleb128 .LVL397-.LVL396
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL397-.LVL396
+	.uleb128 .LVL402-.LVL396
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL402-.LVL396
+	.uleb128 .LVL403-.LVL396
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL403-.LVL396
+	.uleb128 .LVL434-.LVL396
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL434-.LVL396
+	.uleb128 .LVL436-.LVL396
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL436-.LVL396
+	.uleb128 .LVL439-.LVL396
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL441-.LVL396
+	.uleb128 .LFE6422-.LVL396
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS513:
+	.uleb128 .LVU1222
+	.uleb128 .LVU1243
+	.uleb128 .LVU1372
+	.uleb128 .LVU1377
+.LLST513:
+	.byte	0x6
+	.quad	.LVL397
+	.byte	0x4
+	.uleb128 .LVL397-.LVL397
+	.uleb128 .LVL402-.LVL397
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL432-.LVL397
+	.uleb128 .LVL435-1-.LVL397
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS514:
+	.uleb128 .LVU1228
+	.uleb128 .LVU1239
+	.uleb128 .LVU1239
+	.uleb128 .LVU1242
+	.uleb128 .LVU1242
+	.uleb128 .LVU1243
+	.uleb128 .LVU1372
+	.uleb128 .LVU1375
+	.uleb128 .LVU1375
+	.uleb128 .LVU1379
+.LLST514:
+	.byte	0x6
+	.quad	.LVL398
+	.byte	0x4
+	.uleb128 .LVL398-.LVL398
+	.uleb128 .LVL400-.LVL398
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x76
+	.byte	0x4
+	.uleb128 .LVL400-.LVL398
+	.uleb128 .LVL401-.LVL398
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x21
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL401-.LVL398
+	.uleb128 .LVL402-.LVL398
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL432-.LVL398
+	.uleb128 .LVL433-.LVL398
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL433-.LVL398
+	.uleb128 .LVL436-.LVL398
+	.uleb128 0xa
+	.byte	0x92
+	.uleb128 0x77
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x21
+	.byte	0x75
+	.sleb128 0
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS516:
+	.uleb128 .LVU1224
+	.uleb128 .LVU1228
+.LLST516:
+	.byte	0x8
+	.quad	.LVL397
+	.uleb128 .LVL398-.LVL397
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS518:
+	.uleb128 .LVU1230
+	.uleb128 .LVU1233
+.LLST518:
+	.byte	0x8
+	.quad	.LVL398
+	.uleb128 .LVL399-.LVL398
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS520:
+	.uleb128 .LVU1233
+	.uleb128 .LVU1239
+.LLST520:
+	.byte	0x8
+	.quad	.LVL399
+	.uleb128 .LVL400-.LVL399
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS522:
+	.uleb128 .LVU1220
+	.uleb128 .LVU1222
+.LLST522:
+	.byte	0x8
+	.quad	.LVL397
+	.uleb128 .LVL397-.LVL397
+	.uleb128 0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS524:
+	.uleb128 .LVU1251
+	.uleb128 .LVU1304
+	.uleb128 .LVU1304
+	.uleb128 .LVU1372
+	.uleb128 .LVU1379
+	.uleb128 .LVU1382
+	.uleb128 .LVU1386
+	.uleb128 0
+.LLST524:
+	.byte	0x6
+	.quad	.LVL404
+	.byte	0x4
+	.uleb128 .LVL404-.LVL404
+	.uleb128 .LVL414-.LVL404
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL414-.LVL404
+	.uleb128 .LVL432-.LVL404
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL436-.LVL404
+	.uleb128 .LVL438-.LVL404
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL441-.LVL404
+	.uleb128 .LFE6422-.LVL404
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS525:
+	.uleb128 .LVU1251
+	.uleb128 .LVU1360
+	.uleb128 .LVU1360
+	.uleb128 .LVU1372
+	.uleb128 .LVU1379
+	.uleb128 .LVU1382
+	.uleb128 .LVU1386
+	.uleb128 .LVU1390
+	.uleb128 .LVU1390
+	.uleb128 0
+.LLST525:
+	.byte	0x6
+	.quad	.LVL404
+	.byte	0x4
+	.uleb128 .LVL404-.LVL404
+	.uleb128 .LVL426-.LVL404
+	.uleb128 0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL426-.LVL404
+	.uleb128 .LVL432-.LVL404
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL436-.LVL404
+	.uleb128 .LVL438-.LVL404
+	.uleb128 0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL441-.LVL404
+	.uleb128 .LVL444-.LVL404
+	.uleb128 0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL444-.LVL404
+	.uleb128 .LFE6422-.LVL404
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS526:
+	.uleb128 .LVU1255
+	.uleb128 .LVU1295
+	.uleb128 .LVU1295
+	.uleb128 .LVU1298
+	.uleb128 .LVU1298
+	.uleb128 .LVU1371
+	.uleb128 .LVU1379
+	.uleb128 .LVU1382
+	.uleb128 .LVU1386
+	.uleb128 0
+.LLST526:
+	.byte	0x6
+	.quad	.LVL405
+	.byte	0x4
+	.uleb128 .LVL405-.LVL405
+	.uleb128 .LVL412-.LVL405
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL412-.LVL405
+	.uleb128 .LVL413-.LVL405
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL413-.LVL405
+	.uleb128 .LVL431-.LVL405
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL436-.LVL405
+	.uleb128 .LVL438-.LVL405
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL441-.LVL405
+	.uleb128 .LFE6422-.LVL405
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS528:
+	.uleb128 .LVU1259
+	.uleb128 .LVU1295
+	.uleb128 .LVU1379
+	.uleb128 .LVU1382
+.LLST528:
+	.byte	0x6
+	.quad	.LVL405
+	.byte	0x4
+	.uleb128 .LVL405-.LVL405
+	.uleb128 .LVL412-.LVL405
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL436-.LVL405
+	.uleb128 .LVL438-.LVL405
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS529:
+	.uleb128 .LVU1269
+	.uleb128 .LVU1277
+.LLST529:
+	.byte	0x8
+	.quad	.LVL407
+	.uleb128 .LVL408-.LVL407
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS530:
+	.uleb128 .LVU1292
+	.uleb128 .LVU1295
+	.uleb128 .LVU1379
+	.uleb128 .LVU1381
+.LLST530:
+	.byte	0x6
+	.quad	.LVL411
+	.byte	0x4
+	.uleb128 .LVL411-.LVL411
+	.uleb128 .LVL412-.LVL411
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL436-.LVL411
+	.uleb128 .LVL437-.LVL411
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS532:
+	.uleb128 .LVU1261
+	.uleb128 .LVU1265
+.LLST532:
+	.byte	0x8
+	.quad	.LVL405
+	.uleb128 .LVL406-.LVL405
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS534:
+	.uleb128 .LVU1271
+	.uleb128 .LVU1274
+.LLST534:
+	.byte	0x8
+	.quad	.LVL407
+	.uleb128 .LVL408-.LVL407
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS536:
+	.uleb128 .LVU1279
+	.uleb128 .LVU1282
+.LLST536:
+	.byte	0x8
+	.quad	.LVL408
+	.uleb128 .LVL409-.LVL408
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS538:
+	.uleb128 .LVU1257
+	.uleb128 .LVU1259
+.LLST538:
+	.byte	0x8
+	.quad	.LVL405
+	.uleb128 .LVL405-.LVL405
+	.uleb128 0x9
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS539:
+	.uleb128 .LVU1265
+	.uleb128 .LVU1269
+.LLST539:
+	.byte	0x8
+	.quad	.LVL406
+	.uleb128 .LVL407-.LVL406
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS540:
+	.uleb128 .LVU1265
+	.uleb128 .LVU1269
+.LLST540:
+	.byte	0x8
+	.quad	.LVL406
+	.uleb128 .LVL407-.LVL406
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS541:
+	.uleb128 .LVU1274
+	.uleb128 .LVU1277
+.LLST541:
+	.byte	0x8
+	.quad	.LVL408
+	.uleb128 .LVL408-.LVL408
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS542:
+	.uleb128 .LVU1274
+	.uleb128 .LVU1277
+.LLST542:
+	.byte	0x8
+	.quad	.LVL408
+	.uleb128 .LVL408-.LVL408
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS544:
+	.uleb128 .LVU1282
+	.uleb128 .LVU1285
+.LLST544:
+	.byte	0x8
+	.quad	.LVL409
+	.uleb128 .LVL409-.LVL409
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS547:
+	.uleb128 .LVU1304
+	.uleb128 .LVU1357
+	.uleb128 .LVU1357
+	.uleb128 .LVU1369
+	.uleb128 .LVU1386
+	.uleb128 .LVU1390
+	.uleb128 .LVU1390
+	.uleb128 0
+.LLST547:
+	.byte	0x6
+	.quad	.LVL414
+	.byte	0x4
+	.uleb128 .LVL414-.LVL414
+	.uleb128 .LVL425-.LVL414
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL425-.LVL414
+	.uleb128 .LVL430-.LVL414
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL441-.LVL414
+	.uleb128 .LVL444-.LVL414
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL444-.LVL414
+	.uleb128 .LFE6422-.LVL414
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS548:
+	.uleb128 .LVU1304
+	.uleb128 .LVU1360
+	.uleb128 .LVU1360
+	.uleb128 .LVU1369
+	.uleb128 .LVU1386
+	.uleb128 .LVU1390
+	.uleb128 .LVU1390
+	.uleb128 0
+.LLST548:
+	.byte	0x6
+	.quad	.LVL414
+	.byte	0x4
+	.uleb128 .LVL414-.LVL414
+	.uleb128 .LVL426-.LVL414
+	.uleb128 0x9
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL426-.LVL414
+	.uleb128 .LVL430-.LVL414
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL441-.LVL414
+	.uleb128 .LVL444-.LVL414
+	.uleb128 0x9
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL444-.LVL414
+	.uleb128 .LFE6422-.LVL414
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS549:
+	.uleb128 .LVU1308
+	.uleb128 .LVU1348
+	.uleb128 .LVU1348
+	.uleb128 .LVU1351
+	.uleb128 .LVU1351
+	.uleb128 .LVU1368
+	.uleb128 .LVU1386
+	.uleb128 .LVU1389
+	.uleb128 .LVU1389
+	.uleb128 .LVU1390
+	.uleb128 .LVU1390
+	.uleb128 .LVU1392
+.LLST549:
+	.byte	0x6
+	.quad	.LVL415
+	.byte	0x4
+	.uleb128 .LVL415-.LVL415
+	.uleb128 .LVL422-.LVL415
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL422-.LVL415
+	.uleb128 .LVL423-.LVL415
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL423-.LVL415
+	.uleb128 .LVL430-.LVL415
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL441-.LVL415
+	.uleb128 .LVL443-.LVL415
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL443-.LVL415
+	.uleb128 .LVL444-.LVL415
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL444-.LVL415
+	.uleb128 .LVL445-.LVL415
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS551:
+	.uleb128 .LVU1312
+	.uleb128 .LVU1348
+	.uleb128 .LVU1386
+	.uleb128 .LVU1390
+.LLST551:
+	.byte	0x6
+	.quad	.LVL415
+	.byte	0x4
+	.uleb128 .LVL415-.LVL415
+	.uleb128 .LVL422-.LVL415
+	.uleb128 0xa
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL441-.LVL415
+	.uleb128 .LVL444-.LVL415
+	.uleb128 0xa
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS552:
+	.uleb128 .LVU1322
+	.uleb128 .LVU1330
+.LLST552:
+	.byte	0x8
+	.quad	.LVL417
+	.uleb128 .LVL418-.LVL417
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS553:
+	.uleb128 .LVU1345
+	.uleb128 .LVU1348
+	.uleb128 .LVU1386
+	.uleb128 .LVU1388
+.LLST553:
+	.byte	0x6
+	.quad	.LVL421
+	.byte	0x4
+	.uleb128 .LVL421-.LVL421
+	.uleb128 .LVL422-.LVL421
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL441-.LVL421
+	.uleb128 .LVL442-.LVL421
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS555:
+	.uleb128 .LVU1314
+	.uleb128 .LVU1318
+.LLST555:
+	.byte	0x8
+	.quad	.LVL415
+	.uleb128 .LVL416-.LVL415
+	.uleb128 0xa
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS557:
+	.uleb128 .LVU1324
+	.uleb128 .LVU1327
+.LLST557:
+	.byte	0x8
+	.quad	.LVL417
+	.uleb128 .LVL418-.LVL417
+	.uleb128 0xa
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS559:
+	.uleb128 .LVU1332
+	.uleb128 .LVU1335
+.LLST559:
+	.byte	0x8
+	.quad	.LVL418
+	.uleb128 .LVL419-.LVL418
+	.uleb128 0xa
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS561:
+	.uleb128 .LVU1310
+	.uleb128 .LVU1312
+.LLST561:
+	.byte	0x8
+	.quad	.LVL415
+	.uleb128 .LVL415-.LVL415
+	.uleb128 0xe
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS562:
+	.uleb128 .LVU1318
+	.uleb128 .LVU1322
+.LLST562:
+	.byte	0x8
+	.quad	.LVL416
+	.uleb128 .LVL417-.LVL416
+	.uleb128 0xa
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS563:
+	.uleb128 .LVU1318
+	.uleb128 .LVU1322
+.LLST563:
+	.byte	0x8
+	.quad	.LVL416
+	.uleb128 .LVL417-.LVL416
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS564:
+	.uleb128 .LVU1327
+	.uleb128 .LVU1330
+.LLST564:
+	.byte	0x8
+	.quad	.LVL418
+	.uleb128 .LVL418-.LVL418
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS565:
+	.uleb128 .LVU1327
+	.uleb128 .LVU1330
+.LLST565:
+	.byte	0x8
+	.quad	.LVL418
+	.uleb128 .LVL418-.LVL418
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS567:
+	.uleb128 .LVU1335
+	.uleb128 .LVU1338
+.LLST567:
+	.byte	0x8
+	.quad	.LVL419
+	.uleb128 .LVL419-.LVL419
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS569:
+	.uleb128 .LVU1353
+	.uleb128 .LVU1357
+	.uleb128 .LVU1357
+	.uleb128 .LVU1369
+	.uleb128 .LVU1390
+	.uleb128 0
+.LLST569:
+	.byte	0x6
+	.quad	.LVL424
+	.byte	0x4
+	.uleb128 .LVL424-.LVL424
+	.uleb128 .LVL425-.LVL424
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL425-.LVL424
+	.uleb128 .LVL430-.LVL424
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL444-.LVL424
+	.uleb128 .LFE6422-.LVL424
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS570:
+	.uleb128 .LVU1353
+	.uleb128 .LVU1360
+	.uleb128 .LVU1360
+	.uleb128 .LVU1368
+	.uleb128 .LVU1390
+	.uleb128 .LVU1392
+.LLST570:
+	.byte	0x6
+	.quad	.LVL424
+	.byte	0x4
+	.uleb128 .LVL424-.LVL424
+	.uleb128 .LVL426-.LVL424
+	.uleb128 0xc
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL426-.LVL424
+	.uleb128 .LVL430-.LVL424
+	.uleb128 0xd
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL444-.LVL424
+	.uleb128 .LVL445-.LVL424
+	.uleb128 0xd
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS571:
+	.uleb128 .LVU1355
+	.uleb128 .LVU1361
+	.uleb128 .LVU1361
+	.uleb128 .LVU1369
+	.uleb128 .LVU1390
+	.uleb128 0
+.LLST571:
+	.byte	0x6
+	.quad	.LVL424
+	.byte	0x4
+	.uleb128 .LVL424-.LVL424
+	.uleb128 .LVL427-.LVL424
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL427-.LVL424
+	.uleb128 .LVL430-.LVL424
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL444-.LVL424
+	.uleb128 .LFE6422-.LVL424
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS572:
+	.uleb128 .LVU1364
+	.uleb128 .LVU1366
+.LLST572:
+	.byte	0x8
+	.quad	.LVL429
+	.uleb128 .LVL429-.LVL429
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS573:
+	.uleb128 .LVU1364
+	.uleb128 .LVU1366
+.LLST573:
+	.byte	0x8
+	.quad	.LVL429
+	.uleb128 .LVL429-.LVL429
+	.uleb128 0xc
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS267:
+	.uleb128 0
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU732
+	.uleb128 .LVU732
+	.uleb128 .LVU736
+	.uleb128 .LVU736
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU744
+	.uleb128 .LVU744
+	.uleb128 .LVU748
+	.uleb128 .LVU748
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 0
+.LLST267:
+	.byte	0x6
+	.quad	.LVL217
+	.byte	0x4
+	.uleb128 .LVL217-.LVL217
+	.uleb128 .LVL220-.LVL217
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL220-.LVL217
+	.uleb128 .LVL236-.LVL217
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL236-.LVL217
+	.uleb128 .LVL243-.LVL217
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL243-.LVL217
+	.uleb128 .LVL245-.LVL217
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL245-.LVL217
+	.uleb128 .LVL248-.LVL217
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL248-.LVL217
+	.uleb128 .LVL250-.LVL217
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL250-.LVL217
+	.uleb128 .LVL253-.LVL217
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL253-.LVL217
+	.uleb128 .LVL256-.LVL217
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL256-.LVL217
+	.uleb128 .LFE6421-.LVL217
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS268:
+	.uleb128 0
+	.uleb128 .LVU664
+	.uleb128 .LVU664
+	.uleb128 .LVU732
+	.uleb128 .LVU732
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 0
+.LLST268:
+	.byte	0x6
+	.quad	.LVL217
+	.byte	0x4
+	.uleb128 .LVL217-.LVL217
+	.uleb128 .LVL222-.LVL217
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL222-.LVL217
+	.uleb128 .LVL243-.LVL217
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL243-.LVL217
+	.uleb128 .LVL248-.LVL217
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL248-.LVL217
+	.uleb128 .LFE6421-.LVL217
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS269:
+	.uleb128 .LVU643
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU738
+	.uleb128 .LVU741
+	.uleb128 .LVU746
+	.uleb128 .LVU748
+	.uleb128 0
+.LLST269:
+	.byte	0x6
+	.quad	.LVL217
+	.byte	0x4
+	.uleb128 .LVL217-.LVL217
+	.uleb128 .LVL218-.LVL217
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL218-.LVL217
+	.uleb128 .LVL220-.LVL217
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL220-.LVL217
+	.uleb128 .LVL221-.LVL217
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL221-.LVL217
+	.uleb128 .LVL246-.LVL217
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL248-.LVL217
+	.uleb128 .LVL251-.LVL217
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL253-.LVL217
+	.uleb128 .LFE6421-.LVL217
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS271:
+	.uleb128 .LVU650
+	.uleb128 .LVU658
+	.uleb128 .LVU732
+	.uleb128 .LVU735
+	.uleb128 .LVU735
+	.uleb128 .LVU736
+	.uleb128 .LVU736
+	.uleb128 .LVU738
+.LLST271:
+	.byte	0x6
+	.quad	.LVL218
+	.byte	0x4
+	.uleb128 .LVL218-.LVL218
+	.uleb128 .LVL220-.LVL218
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL243-.LVL218
+	.uleb128 .LVL244-.LVL218
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL244-.LVL218
+	.uleb128 .LVL245-.LVL218
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL245-.LVL218
+	.uleb128 .LVL246-.LVL218
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS272:
+	.uleb128 .LVU655
+	.uleb128 .LVU658
+	.uleb128 .LVU732
+	.uleb128 .LVU741
+.LLST272:
+	.byte	0x6
+	.quad	.LVL219
+	.byte	0x4
+	.uleb128 .LVL219-.LVL219
+	.uleb128 .LVL220-.LVL219
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x76
+	.byte	0x4
+	.uleb128 .LVL243-.LVL219
+	.uleb128 .LVL248-.LVL219
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x76
+	.byte	0
+.LVUS273:
+	.uleb128 .LVU648
+	.uleb128 .LVU650
+.LLST273:
+	.byte	0x8
+	.quad	.LVL218
+	.uleb128 .LVL218-.LVL218
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS274:
+	.uleb128 .LVU652
+	.uleb128 .LVU655
+.LLST274:
+	.byte	0x8
+	.quad	.LVL218
+	.uleb128 .LVL219-.LVL218
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS276:
+	.uleb128 .LVU664
+	.uleb128 .LVU691
+	.uleb128 .LVU691
+	.uleb128 .LVU732
+	.uleb128 .LVU741
+	.uleb128 .LVU744
+	.uleb128 .LVU748
+	.uleb128 0
+.LLST276:
+	.byte	0x6
+	.quad	.LVL222
+	.byte	0x4
+	.uleb128 .LVL222-.LVL222
+	.uleb128 .LVL229-.LVL222
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL229-.LVL222
+	.uleb128 .LVL243-.LVL222
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL248-.LVL222
+	.uleb128 .LVL250-.LVL222
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL253-.LVL222
+	.uleb128 .LFE6421-.LVL222
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS277:
+	.uleb128 .LVU664
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU695
+	.uleb128 .LVU695
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU732
+	.uleb128 .LVU741
+	.uleb128 .LVU744
+	.uleb128 .LVU748
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 0
+.LLST277:
+	.byte	0x6
+	.quad	.LVL222
+	.byte	0x4
+	.uleb128 .LVL222-.LVL222
+	.uleb128 .LVL223-.LVL222
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.LVL222
+	.uleb128 .LVL230-.LVL222
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL230-.LVL222
+	.uleb128 .LVL236-.LVL222
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.LVL222
+	.uleb128 .LVL243-.LVL222
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL248-.LVL222
+	.uleb128 .LVL250-.LVL222
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL253-.LVL222
+	.uleb128 .LVL256-.LVL222
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL256-.LVL222
+	.uleb128 .LFE6421-.LVL222
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS278:
+	.uleb128 .LVU669
+	.uleb128 .LVU685
+	.uleb128 .LVU685
+	.uleb128 .LVU688
+	.uleb128 .LVU688
+	.uleb128 .LVU731
+	.uleb128 .LVU741
+	.uleb128 .LVU744
+	.uleb128 .LVU748
+	.uleb128 0
+.LLST278:
+	.byte	0x6
+	.quad	.LVL224
+	.byte	0x4
+	.uleb128 .LVL224-.LVL224
+	.uleb128 .LVL227-.LVL224
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL227-.LVL224
+	.uleb128 .LVL228-.LVL224
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL228-.LVL224
+	.uleb128 .LVL242-.LVL224
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL248-.LVL224
+	.uleb128 .LVL250-.LVL224
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL253-.LVL224
+	.uleb128 .LFE6421-.LVL224
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS280:
+	.uleb128 .LVU673
+	.uleb128 .LVU685
+	.uleb128 .LVU741
+	.uleb128 .LVU744
+.LLST280:
+	.byte	0x6
+	.quad	.LVL224
+	.byte	0x4
+	.uleb128 .LVL224-.LVL224
+	.uleb128 .LVL227-.LVL224
+	.uleb128 0xb
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL248-.LVL224
+	.uleb128 .LVL250-.LVL224
+	.uleb128 0xb
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS281:
+	.uleb128 .LVU682
+	.uleb128 .LVU685
+	.uleb128 .LVU741
+	.uleb128 .LVU743
+.LLST281:
+	.byte	0x6
+	.quad	.LVL226
+	.byte	0x4
+	.uleb128 .LVL226-.LVL226
+	.uleb128 .LVL227-.LVL226
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL248-.LVL226
+	.uleb128 .LVL249-.LVL226
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS283:
+	.uleb128 .LVU671
+	.uleb128 .LVU673
+.LLST283:
+	.byte	0x8
+	.quad	.LVL224
+	.uleb128 .LVL224-.LVL224
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS285:
+	.uleb128 .LVU675
+	.uleb128 .LVU678
+.LLST285:
+	.byte	0x8
+	.quad	.LVL224
+	.uleb128 .LVL225-.LVL224
+	.uleb128 0xb
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS286:
+	.uleb128 .LVU678
+	.uleb128 .LVU682
+.LLST286:
+	.byte	0x8
+	.quad	.LVL225
+	.uleb128 .LVL226-.LVL225
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS288:
+	.uleb128 .LVU691
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU729
+	.uleb128 .LVU748
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 0
+.LLST288:
+	.byte	0x6
+	.quad	.LVL229
+	.byte	0x4
+	.uleb128 .LVL229-.LVL229
+	.uleb128 .LVL237-.LVL229
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL237-.LVL229
+	.uleb128 .LVL241-.LVL229
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL253-.LVL229
+	.uleb128 .LVL256-.LVL229
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL256-.LVL229
+	.uleb128 .LFE6421-.LVL229
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS289:
+	.uleb128 .LVU691
+	.uleb128 .LVU695
+	.uleb128 .LVU695
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU729
+	.uleb128 .LVU748
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 0
+.LLST289:
+	.byte	0x6
+	.quad	.LVL229
+	.byte	0x4
+	.uleb128 .LVL229-.LVL229
+	.uleb128 .LVL230-.LVL229
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL230-.LVL229
+	.uleb128 .LVL236-.LVL229
+	.uleb128 0x9
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.LVL229
+	.uleb128 .LVL241-.LVL229
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL253-.LVL229
+	.uleb128 .LVL256-.LVL229
+	.uleb128 0x9
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL256-.LVL229
+	.uleb128 .LFE6421-.LVL229
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS290:
+	.uleb128 .LVU695
+	.uleb128 .LVU711
+	.uleb128 .LVU711
+	.uleb128 .LVU714
+	.uleb128 .LVU714
+	.uleb128 .LVU728
+	.uleb128 .LVU748
+	.uleb128 .LVU751
+	.uleb128 .LVU751
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 .LVU754
+.LLST290:
+	.byte	0x6
+	.quad	.LVL230
+	.byte	0x4
+	.uleb128 .LVL230-.LVL230
+	.uleb128 .LVL233-.LVL230
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL233-.LVL230
+	.uleb128 .LVL234-.LVL230
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL234-.LVL230
+	.uleb128 .LVL241-.LVL230
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL253-.LVL230
+	.uleb128 .LVL255-.LVL230
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL255-.LVL230
+	.uleb128 .LVL256-.LVL230
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL256-.LVL230
+	.uleb128 .LVL257-.LVL230
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS292:
+	.uleb128 .LVU699
+	.uleb128 .LVU711
+	.uleb128 .LVU748
+	.uleb128 .LVU752
+.LLST292:
+	.byte	0x6
+	.quad	.LVL230
+	.byte	0x4
+	.uleb128 .LVL230-.LVL230
+	.uleb128 .LVL233-.LVL230
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL253-.LVL230
+	.uleb128 .LVL256-.LVL230
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS293:
+	.uleb128 .LVU708
+	.uleb128 .LVU711
+	.uleb128 .LVU748
+	.uleb128 .LVU750
+.LLST293:
+	.byte	0x6
+	.quad	.LVL232
+	.byte	0x4
+	.uleb128 .LVL232-.LVL232
+	.uleb128 .LVL233-.LVL232
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL253-.LVL232
+	.uleb128 .LVL254-.LVL232
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS295:
+	.uleb128 .LVU697
+	.uleb128 .LVU699
+.LLST295:
+	.byte	0x8
+	.quad	.LVL230
+	.uleb128 .LVL230-.LVL230
+	.uleb128 0xe
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS297:
+	.uleb128 .LVU701
+	.uleb128 .LVU704
+.LLST297:
+	.byte	0x8
+	.quad	.LVL230
+	.uleb128 .LVL231-.LVL230
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS298:
+	.uleb128 .LVU704
+	.uleb128 .LVU708
+.LLST298:
+	.byte	0x8
+	.quad	.LVL231
+	.uleb128 .LVL232-.LVL231
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS299:
+	.uleb128 .LVU716
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU729
+	.uleb128 .LVU752
+	.uleb128 0
+.LLST299:
+	.byte	0x6
+	.quad	.LVL235
+	.byte	0x4
+	.uleb128 .LVL235-.LVL235
+	.uleb128 .LVL237-.LVL235
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL237-.LVL235
+	.uleb128 .LVL241-.LVL235
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL256-.LVL235
+	.uleb128 .LFE6421-.LVL235
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS300:
+	.uleb128 .LVU716
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU728
+	.uleb128 .LVU752
+	.uleb128 .LVU754
+.LLST300:
+	.byte	0x6
+	.quad	.LVL235
+	.byte	0x4
+	.uleb128 .LVL235-.LVL235
+	.uleb128 .LVL236-.LVL235
+	.uleb128 0xc
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.LVL235
+	.uleb128 .LVL241-.LVL235
+	.uleb128 0xd
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL256-.LVL235
+	.uleb128 .LVL257-.LVL235
+	.uleb128 0xd
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS301:
+	.uleb128 .LVU718
+	.uleb128 .LVU724
+	.uleb128 .LVU724
+	.uleb128 .LVU729
+	.uleb128 .LVU752
+	.uleb128 0
+.LLST301:
+	.byte	0x6
+	.quad	.LVL235
+	.byte	0x4
+	.uleb128 .LVL235-.LVL235
+	.uleb128 .LVL238-.LVL235
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL238-.LVL235
+	.uleb128 .LVL241-.LVL235
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL256-.LVL235
+	.uleb128 .LFE6421-.LVL235
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS302:
+	.uleb128 0
+	.uleb128 .LVU775
+	.uleb128 .LVU775
+	.uleb128 .LVU853
+	.uleb128 .LVU853
+	.uleb128 .LVU865
+	.uleb128 .LVU865
+	.uleb128 .LVU869
+	.uleb128 .LVU869
+	.uleb128 .LVU874
+	.uleb128 .LVU874
+	.uleb128 .LVU877
+	.uleb128 .LVU877
+	.uleb128 .LVU881
+	.uleb128 .LVU881
+	.uleb128 .LVU885
+	.uleb128 .LVU885
+	.uleb128 0
+.LLST302:
+	.byte	0x6
+	.quad	.LVL258
+	.byte	0x4
+	.uleb128 .LVL258-.LVL258
+	.uleb128 .LVL261-.LVL258
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL261-.LVL258
+	.uleb128 .LVL279-.LVL258
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL279-.LVL258
+	.uleb128 .LVL285-.LVL258
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL285-.LVL258
+	.uleb128 .LVL287-.LVL258
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL287-.LVL258
+	.uleb128 .LVL290-.LVL258
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL290-.LVL258
+	.uleb128 .LVL292-.LVL258
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL292-.LVL258
+	.uleb128 .LVL295-.LVL258
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL295-.LVL258
+	.uleb128 .LVL298-.LVL258
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL298-.LVL258
+	.uleb128 .LFE6420-.LVL258
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS303:
+	.uleb128 0
+	.uleb128 .LVU782
+	.uleb128 .LVU782
+	.uleb128 .LVU865
+	.uleb128 .LVU865
+	.uleb128 .LVU874
+	.uleb128 .LVU874
+	.uleb128 0
+.LLST303:
+	.byte	0x6
+	.quad	.LVL258
+	.byte	0x4
+	.uleb128 .LVL258-.LVL258
+	.uleb128 .LVL263-.LVL258
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL263-.LVL258
+	.uleb128 .LVL285-.LVL258
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL285-.LVL258
+	.uleb128 .LVL290-.LVL258
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL290-.LVL258
+	.uleb128 .LFE6420-.LVL258
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS304:
+	.uleb128 .LVU758
+	.uleb128 .LVU764
+	.uleb128 .LVU764
+	.uleb128 .LVU775
+	.uleb128 .LVU775
+	.uleb128 .LVU778
+	.uleb128 .LVU778
+	.uleb128 .LVU871
+	.uleb128 .LVU874
+	.uleb128 .LVU879
+	.uleb128 .LVU881
+	.uleb128 0
+.LLST304:
+	.byte	0x6
+	.quad	.LVL258
+	.byte	0x4
+	.uleb128 .LVL258-.LVL258
+	.uleb128 .LVL259-.LVL258
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.LVL258
+	.uleb128 .LVL261-.LVL258
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL261-.LVL258
+	.uleb128 .LVL262-.LVL258
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL262-.LVL258
+	.uleb128 .LVL288-.LVL258
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL290-.LVL258
+	.uleb128 .LVL293-.LVL258
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL295-.LVL258
+	.uleb128 .LFE6420-.LVL258
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS306:
+	.uleb128 .LVU767
+	.uleb128 .LVU775
+	.uleb128 .LVU865
+	.uleb128 .LVU868
+	.uleb128 .LVU868
+	.uleb128 .LVU869
+	.uleb128 .LVU869
+	.uleb128 .LVU871
+.LLST306:
+	.byte	0x6
+	.quad	.LVL259
+	.byte	0x4
+	.uleb128 .LVL259-.LVL259
+	.uleb128 .LVL261-.LVL259
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL285-.LVL259
+	.uleb128 .LVL286-.LVL259
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL286-.LVL259
+	.uleb128 .LVL287-.LVL259
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL287-.LVL259
+	.uleb128 .LVL288-.LVL259
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS307:
+	.uleb128 .LVU772
+	.uleb128 .LVU775
+	.uleb128 .LVU865
+	.uleb128 .LVU874
+.LLST307:
+	.byte	0x6
+	.quad	.LVL260
+	.byte	0x4
+	.uleb128 .LVL260-.LVL260
+	.uleb128 .LVL261-.LVL260
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x76
+	.byte	0x4
+	.uleb128 .LVL285-.LVL260
+	.uleb128 .LVL290-.LVL260
+	.uleb128 0x2
+	.byte	0x90
+	.uleb128 0x76
+	.byte	0
+.LVUS309:
+	.uleb128 .LVU769
+	.uleb128 .LVU772
+.LLST309:
+	.byte	0x8
+	.quad	.LVL259
+	.uleb128 .LVL260-.LVL259
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS310:
+	.uleb128 .LVU765
+	.uleb128 .LVU767
+.LLST310:
+	.byte	0x8
+	.quad	.LVL259
+	.uleb128 .LVL259-.LVL259
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS312:
+	.uleb128 .LVU782
+	.uleb128 .LVU815
+	.uleb128 .LVU815
+	.uleb128 .LVU865
+	.uleb128 .LVU874
+	.uleb128 .LVU877
+	.uleb128 .LVU881
+	.uleb128 0
+.LLST312:
+	.byte	0x6
+	.quad	.LVL263
+	.byte	0x4
+	.uleb128 .LVL263-.LVL263
+	.uleb128 .LVL270-.LVL263
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL270-.LVL263
+	.uleb128 .LVL285-.LVL263
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL290-.LVL263
+	.uleb128 .LVL292-.LVL263
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL295-.LVL263
+	.uleb128 .LFE6420-.LVL263
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS313:
+	.uleb128 .LVU782
+	.uleb128 .LVU853
+	.uleb128 .LVU853
+	.uleb128 .LVU865
+	.uleb128 .LVU874
+	.uleb128 .LVU877
+	.uleb128 .LVU881
+	.uleb128 .LVU885
+	.uleb128 .LVU885
+	.uleb128 0
+.LLST313:
+	.byte	0x6
+	.quad	.LVL263
+	.byte	0x4
+	.uleb128 .LVL263-.LVL263
+	.uleb128 .LVL279-.LVL263
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL279-.LVL263
+	.uleb128 .LVL285-.LVL263
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL290-.LVL263
+	.uleb128 .LVL292-.LVL263
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL295-.LVL263
+	.uleb128 .LVL298-.LVL263
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL298-.LVL263
+	.uleb128 .LFE6420-.LVL263
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS314:
+	.uleb128 .LVU786
+	.uleb128 .LVU808
+	.uleb128 .LVU808
+	.uleb128 .LVU811
+	.uleb128 .LVU811
+	.uleb128 .LVU864
+	.uleb128 .LVU874
+	.uleb128 .LVU877
+	.uleb128 .LVU881
+	.uleb128 0
+.LLST314:
+	.byte	0x6
+	.quad	.LVL264
+	.byte	0x4
+	.uleb128 .LVL264-.LVL264
+	.uleb128 .LVL268-.LVL264
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL268-.LVL264
+	.uleb128 .LVL269-.LVL264
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL269-.LVL264
+	.uleb128 .LVL284-.LVL264
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL290-.LVL264
+	.uleb128 .LVL292-.LVL264
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL295-.LVL264
+	.uleb128 .LFE6420-.LVL264
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS316:
+	.uleb128 .LVU790
+	.uleb128 .LVU808
+	.uleb128 .LVU874
+	.uleb128 .LVU877
+.LLST316:
+	.byte	0x6
+	.quad	.LVL264
+	.byte	0x4
+	.uleb128 .LVL264-.LVL264
+	.uleb128 .LVL268-.LVL264
+	.uleb128 0xb
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL290-.LVL264
+	.uleb128 .LVL292-.LVL264
+	.uleb128 0xb
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS317:
+	.uleb128 .LVU800
+	.uleb128 .LVU808
+	.uleb128 .LVU874
+	.uleb128 .LVU877
+.LLST317:
+	.byte	0x6
+	.quad	.LVL266
+	.byte	0x4
+	.uleb128 .LVL266-.LVL266
+	.uleb128 .LVL268-.LVL266
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL290-.LVL266
+	.uleb128 .LVL292-.LVL266
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS318:
+	.uleb128 .LVU805
+	.uleb128 .LVU808
+	.uleb128 .LVU874
+	.uleb128 .LVU876
+.LLST318:
+	.byte	0x6
+	.quad	.LVL267
+	.byte	0x4
+	.uleb128 .LVL267-.LVL267
+	.uleb128 .LVL268-.LVL267
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL290-.LVL267
+	.uleb128 .LVL291-.LVL267
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS320:
+	.uleb128 .LVU792
+	.uleb128 .LVU796
+.LLST320:
+	.byte	0x8
+	.quad	.LVL264
+	.uleb128 .LVL265-.LVL264
+	.uleb128 0xb
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS322:
+	.uleb128 .LVU788
+	.uleb128 .LVU790
+.LLST322:
+	.byte	0x8
+	.quad	.LVL264
+	.uleb128 .LVL264-.LVL264
+	.uleb128 0x9
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS323:
+	.uleb128 .LVU796
+	.uleb128 .LVU800
+.LLST323:
+	.byte	0x8
+	.quad	.LVL265
+	.uleb128 .LVL266-.LVL265
+	.uleb128 0xb
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS324:
+	.uleb128 .LVU796
+	.uleb128 .LVU800
+.LLST324:
+	.byte	0x8
+	.quad	.LVL265
+	.uleb128 .LVL266-.LVL265
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS325:
+	.uleb128 .LVU802
+	.uleb128 .LVU805
+.LLST325:
+	.byte	0x8
+	.quad	.LVL266
+	.uleb128 .LVL267-.LVL266
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS327:
+	.uleb128 .LVU815
+	.uleb128 .LVU850
+	.uleb128 .LVU850
+	.uleb128 .LVU862
+	.uleb128 .LVU881
+	.uleb128 .LVU885
+	.uleb128 .LVU885
+	.uleb128 0
+.LLST327:
+	.byte	0x6
+	.quad	.LVL270
+	.byte	0x4
+	.uleb128 .LVL270-.LVL270
+	.uleb128 .LVL278-.LVL270
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL278-.LVL270
+	.uleb128 .LVL283-.LVL270
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL295-.LVL270
+	.uleb128 .LVL298-.LVL270
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL298-.LVL270
+	.uleb128 .LFE6420-.LVL270
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS328:
+	.uleb128 .LVU815
+	.uleb128 .LVU853
+	.uleb128 .LVU853
+	.uleb128 .LVU862
+	.uleb128 .LVU881
+	.uleb128 .LVU885
+	.uleb128 .LVU885
+	.uleb128 0
+.LLST328:
+	.byte	0x6
+	.quad	.LVL270
+	.byte	0x4
+	.uleb128 .LVL270-.LVL270
+	.uleb128 .LVL279-.LVL270
+	.uleb128 0x9
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL279-.LVL270
+	.uleb128 .LVL283-.LVL270
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL295-.LVL270
+	.uleb128 .LVL298-.LVL270
+	.uleb128 0x9
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL298-.LVL270
+	.uleb128 .LFE6420-.LVL270
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS329:
+	.uleb128 .LVU819
+	.uleb128 .LVU841
+	.uleb128 .LVU841
+	.uleb128 .LVU844
+	.uleb128 .LVU844
+	.uleb128 .LVU861
+	.uleb128 .LVU881
+	.uleb128 .LVU884
+	.uleb128 .LVU884
+	.uleb128 .LVU885
+	.uleb128 .LVU885
+	.uleb128 .LVU887
+.LLST329:
+	.byte	0x6
+	.quad	.LVL271
+	.byte	0x4
+	.uleb128 .LVL271-.LVL271
+	.uleb128 .LVL275-.LVL271
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL275-.LVL271
+	.uleb128 .LVL276-.LVL271
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL276-.LVL271
+	.uleb128 .LVL283-.LVL271
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL295-.LVL271
+	.uleb128 .LVL297-.LVL271
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL297-.LVL271
+	.uleb128 .LVL298-.LVL271
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL298-.LVL271
+	.uleb128 .LVL299-.LVL271
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS331:
+	.uleb128 .LVU823
+	.uleb128 .LVU841
+	.uleb128 .LVU881
+	.uleb128 .LVU885
+.LLST331:
+	.byte	0x6
+	.quad	.LVL271
+	.byte	0x4
+	.uleb128 .LVL271-.LVL271
+	.uleb128 .LVL275-.LVL271
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL295-.LVL271
+	.uleb128 .LVL298-.LVL271
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS332:
+	.uleb128 .LVU833
+	.uleb128 .LVU841
+	.uleb128 .LVU881
+	.uleb128 .LVU885
+.LLST332:
+	.byte	0x6
+	.quad	.LVL273
+	.byte	0x4
+	.uleb128 .LVL273-.LVL273
+	.uleb128 .LVL275-.LVL273
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL295-.LVL273
+	.uleb128 .LVL298-.LVL273
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS333:
+	.uleb128 .LVU838
+	.uleb128 .LVU841
+	.uleb128 .LVU881
+	.uleb128 .LVU883
+.LLST333:
+	.byte	0x6
+	.quad	.LVL274
+	.byte	0x4
+	.uleb128 .LVL274-.LVL274
+	.uleb128 .LVL275-.LVL274
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL295-.LVL274
+	.uleb128 .LVL296-.LVL274
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS335:
+	.uleb128 .LVU825
+	.uleb128 .LVU829
+.LLST335:
+	.byte	0x8
+	.quad	.LVL271
+	.uleb128 .LVL272-.LVL271
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS337:
+	.uleb128 .LVU821
+	.uleb128 .LVU823
+.LLST337:
+	.byte	0x8
+	.quad	.LVL271
+	.uleb128 .LVL271-.LVL271
+	.uleb128 0xe
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS338:
+	.uleb128 .LVU829
+	.uleb128 .LVU833
+.LLST338:
+	.byte	0x8
+	.quad	.LVL272
+	.uleb128 .LVL273-.LVL272
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS339:
+	.uleb128 .LVU829
+	.uleb128 .LVU833
+.LLST339:
+	.byte	0x8
+	.quad	.LVL272
+	.uleb128 .LVL273-.LVL272
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS340:
+	.uleb128 .LVU835
+	.uleb128 .LVU838
+.LLST340:
+	.byte	0x8
+	.quad	.LVL273
+	.uleb128 .LVL274-.LVL273
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS341:
+	.uleb128 .LVU846
+	.uleb128 .LVU850
+	.uleb128 .LVU850
+	.uleb128 .LVU862
+	.uleb128 .LVU885
+	.uleb128 0
+.LLST341:
+	.byte	0x6
+	.quad	.LVL277
+	.byte	0x4
+	.uleb128 .LVL277-.LVL277
+	.uleb128 .LVL278-.LVL277
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.LVL277
+	.uleb128 .LVL283-.LVL277
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL298-.LVL277
+	.uleb128 .LFE6420-.LVL277
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS342:
+	.uleb128 .LVU846
+	.uleb128 .LVU853
+	.uleb128 .LVU853
+	.uleb128 .LVU861
+	.uleb128 .LVU885
+	.uleb128 .LVU887
+.LLST342:
+	.byte	0x6
+	.quad	.LVL277
+	.byte	0x4
+	.uleb128 .LVL277-.LVL277
+	.uleb128 .LVL279-.LVL277
+	.uleb128 0xc
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL279-.LVL277
+	.uleb128 .LVL283-.LVL277
+	.uleb128 0xd
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL298-.LVL277
+	.uleb128 .LVL299-.LVL277
+	.uleb128 0xd
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS343:
+	.uleb128 .LVU848
+	.uleb128 .LVU854
+	.uleb128 .LVU854
+	.uleb128 .LVU862
+	.uleb128 .LVU885
+	.uleb128 0
+.LLST343:
+	.byte	0x6
+	.quad	.LVL277
+	.byte	0x4
+	.uleb128 .LVL277-.LVL277
+	.uleb128 .LVL280-.LVL277
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL280-.LVL277
+	.uleb128 .LVL283-.LVL277
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL298-.LVL277
+	.uleb128 .LFE6420-.LVL277
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS344:
+	.uleb128 .LVU857
+	.uleb128 .LVU859
+.LLST344:
+	.byte	0x8
+	.quad	.LVL282
+	.uleb128 .LVL282-.LVL282
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS345:
+	.uleb128 .LVU857
+	.uleb128 .LVU859
+.LLST345:
+	.byte	0x8
+	.quad	.LVL282
+	.uleb128 .LVL282-.LVL282
+	.uleb128 0xc
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS346:
+	.uleb128 0
+	.uleb128 .LVU901
+	.uleb128 .LVU901
+	.uleb128 .LVU1029
+	.uleb128 .LVU1029
+	.uleb128 .LVU1044
+	.uleb128 .LVU1044
+	.uleb128 .LVU1065
+	.uleb128 .LVU1065
+	.uleb128 0
+.LLST346:
+	.byte	0x6
+	.quad	.LVL300
+	.byte	0x4
+	.uleb128 .LVL300-.LVL300
+	.uleb128 .LVL303-.LVL300
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL303-.LVL300
+	.uleb128 .LVL332-.LVL300
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL332-.LVL300
+	.uleb128 .LVL341-.LVL300
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL341-.LVL300
+	.uleb128 .LVL356-.LVL300
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL356-.LVL300
+	.uleb128 .LFE6419-.LVL300
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS347:
+	.uleb128 0
+	.uleb128 .LVU924
+	.uleb128 .LVU924
+	.uleb128 .LVU1044
+	.uleb128 .LVU1044
+	.uleb128 .LVU1048
+	.uleb128 .LVU1048
+	.uleb128 0
+.LLST347:
+	.byte	0x6
+	.quad	.LVL300
+	.byte	0x4
+	.uleb128 .LVL300-.LVL300
+	.uleb128 .LVL309-.LVL300
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL309-.LVL300
+	.uleb128 .LVL341-.LVL300
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL341-.LVL300
+	.uleb128 .LVL345-.LVL300
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL345-.LVL300
+	.uleb128 .LFE6419-.LVL300
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS348:
+	.uleb128 0
+	.uleb128 .LVU987
+	.uleb128 .LVU987
+	.uleb128 .LVU1044
+	.uleb128 .LVU1044
+	.uleb128 .LVU1056
+	.uleb128 .LVU1056
+	.uleb128 0
+.LLST348:
+	.byte	0x6
+	.quad	.LVL300
+	.byte	0x4
+	.uleb128 .LVL300-.LVL300
+	.uleb128 .LVL321-.LVL300
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL321-.LVL300
+	.uleb128 .LVL341-.LVL300
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL341-.LVL300
+	.uleb128 .LVL350-.LVL300
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL350-.LVL300
+	.uleb128 .LFE6419-.LVL300
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS349:
+	.uleb128 .LVU895
+	.uleb128 .LVU940
+	.uleb128 .LVU1044
+	.uleb128 .LVU1048
+.LLST349:
+	.byte	0x6
+	.quad	.LVL302
+	.byte	0x4
+	.uleb128 .LVL302-.LVL302
+	.uleb128 .LVL312-.LVL302
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL341-.LVL302
+	.uleb128 .LVL345-.LVL302
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS350:
+	.uleb128 .LVU898
+	.uleb128 .LVU901
+	.uleb128 .LVU901
+	.uleb128 .LVU918
+	.uleb128 .LVU918
+	.uleb128 .LVU921
+	.uleb128 .LVU921
+	.uleb128 .LVU1042
+	.uleb128 .LVU1044
+	.uleb128 .LVU1047
+	.uleb128 .LVU1047
+	.uleb128 .LVU1048
+	.uleb128 .LVU1048
+	.uleb128 .LVU1054
+	.uleb128 .LVU1056
+	.uleb128 .LVU1063
+	.uleb128 .LVU1065
+	.uleb128 0
+.LLST350:
+	.byte	0x6
+	.quad	.LVL302
+	.byte	0x4
+	.uleb128 .LVL302-.LVL302
+	.uleb128 .LVL303-.LVL302
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL303-.LVL302
+	.uleb128 .LVL307-.LVL302
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL307-.LVL302
+	.uleb128 .LVL308-.LVL302
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL308-.LVL302
+	.uleb128 .LVL339-.LVL302
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL341-.LVL302
+	.uleb128 .LVL343-.LVL302
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL343-.LVL302
+	.uleb128 .LVL345-.LVL302
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL345-.LVL302
+	.uleb128 .LVL348-.LVL302
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL350-.LVL302
+	.uleb128 .LVL354-.LVL302
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL356-.LVL302
+	.uleb128 .LFE6419-.LVL302
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS354:
+	.uleb128 .LVU904
+	.uleb128 .LVU918
+	.uleb128 .LVU1044
+	.uleb128 .LVU1048
+.LLST354:
+	.byte	0x6
+	.quad	.LVL303
+	.byte	0x4
+	.uleb128 .LVL303-.LVL303
+	.uleb128 .LVL307-.LVL303
+	.uleb128 0x8
+	.byte	0x79
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL341-.LVL303
+	.uleb128 .LVL345-.LVL303
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS355:
+	.uleb128 .LVU914
+	.uleb128 .LVU917
+	.uleb128 .LVU917
+	.uleb128 .LVU918
+	.uleb128 .LVU1044
+	.uleb128 .LVU1046
+	.uleb128 .LVU1046
+	.uleb128 .LVU1048
+.LLST355:
+	.byte	0x6
+	.quad	.LVL305
+	.byte	0x4
+	.uleb128 .LVL305-.LVL305
+	.uleb128 .LVL306-.LVL305
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x21
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL306-.LVL305
+	.uleb128 .LVL307-.LVL305
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL341-.LVL305
+	.uleb128 .LVL342-.LVL305
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL342-.LVL305
+	.uleb128 .LVL345-.LVL305
+	.uleb128 0x7
+	.byte	0x92
+	.uleb128 0x77
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS357:
+	.uleb128 .LVU902
+	.uleb128 .LVU904
+.LLST357:
+	.byte	0x8
+	.quad	.LVL303
+	.uleb128 .LVL303-.LVL303
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS359:
+	.uleb128 .LVU906
+	.uleb128 .LVU910
+.LLST359:
+	.byte	0x8
+	.quad	.LVL303
+	.uleb128 .LVL304-.LVL303
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS360:
+	.uleb128 .LVU906
+	.uleb128 .LVU910
+.LLST360:
+	.byte	0x8
+	.quad	.LVL303
+	.uleb128 .LVL304-.LVL303
+	.uleb128 0x8
+	.byte	0x79
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS362:
+	.uleb128 .LVU910
+	.uleb128 .LVU914
+.LLST362:
+	.byte	0x8
+	.quad	.LVL304
+	.uleb128 .LVL305-.LVL304
+	.uleb128 0x8
+	.byte	0x79
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS352:
+	.uleb128 .LVU891
+	.uleb128 .LVU895
+.LLST352:
+	.byte	0x8
+	.quad	.LVL301
+	.uleb128 .LVL302-.LVL301
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS364:
+	.uleb128 .LVU924
+	.uleb128 .LVU987
+	.uleb128 .LVU1048
+	.uleb128 .LVU1052
+.LLST364:
+	.byte	0x6
+	.quad	.LVL309
+	.byte	0x4
+	.uleb128 .LVL309-.LVL309
+	.uleb128 .LVL321-.LVL309
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL345-.LVL309
+	.uleb128 .LVL347-.LVL309
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS365:
+	.uleb128 .LVU924
+	.uleb128 .LVU973
+	.uleb128 .LVU973
+	.uleb128 .LVU1040
+	.uleb128 .LVU1048
+	.uleb128 .LVU1052
+	.uleb128 .LVU1056
+	.uleb128 .LVU1061
+	.uleb128 .LVU1065
+	.uleb128 0
+.LLST365:
+	.byte	0x6
+	.quad	.LVL309
+	.byte	0x4
+	.uleb128 .LVL309-.LVL309
+	.uleb128 .LVL319-.LVL309
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL319-.LVL309
+	.uleb128 .LVL338-.LVL309
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL345-.LVL309
+	.uleb128 .LVL347-.LVL309
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL350-.LVL309
+	.uleb128 .LVL353-.LVL309
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL356-.LVL309
+	.uleb128 .LFE6419-.LVL309
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS366:
+	.uleb128 .LVU924
+	.uleb128 .LVU937
+	.uleb128 .LVU937
+	.uleb128 .LVU988
+	.uleb128 .LVU988
+	.uleb128 .LVU1029
+	.uleb128 .LVU1029
+	.uleb128 .LVU1040
+	.uleb128 .LVU1048
+	.uleb128 .LVU1052
+	.uleb128 .LVU1056
+	.uleb128 .LVU1061
+	.uleb128 .LVU1065
+	.uleb128 0
+.LLST366:
+	.byte	0x6
+	.quad	.LVL309
+	.byte	0x4
+	.uleb128 .LVL309-.LVL309
+	.uleb128 .LVL311-.LVL309
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL311-.LVL309
+	.uleb128 .LVL322-.LVL309
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL322-.LVL309
+	.uleb128 .LVL332-.LVL309
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL332-.LVL309
+	.uleb128 .LVL338-.LVL309
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL345-.LVL309
+	.uleb128 .LVL347-.LVL309
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL350-.LVL309
+	.uleb128 .LVL353-.LVL309
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL356-.LVL309
+	.uleb128 .LFE6419-.LVL309
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS367:
+	.uleb128 .LVU931
+	.uleb128 .LVU990
+	.uleb128 .LVU1048
+	.uleb128 .LVU1056
+.LLST367:
+	.byte	0x6
+	.quad	.LVL310
+	.byte	0x4
+	.uleb128 .LVL310-.LVL310
+	.uleb128 .LVL323-.LVL310
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL345-.LVL310
+	.uleb128 .LVL350-.LVL310
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS368:
+	.uleb128 .LVU934
+	.uleb128 .LVU940
+	.uleb128 .LVU940
+	.uleb128 .LVU966
+	.uleb128 .LVU966
+	.uleb128 .LVU969
+	.uleb128 .LVU969
+	.uleb128 .LVU1040
+	.uleb128 .LVU1048
+	.uleb128 .LVU1052
+	.uleb128 .LVU1056
+	.uleb128 .LVU1061
+	.uleb128 .LVU1065
+	.uleb128 0
+.LLST368:
+	.byte	0x6
+	.quad	.LVL310
+	.byte	0x4
+	.uleb128 .LVL310-.LVL310
+	.uleb128 .LVL312-.LVL310
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL312-.LVL310
+	.uleb128 .LVL317-.LVL310
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL317-.LVL310
+	.uleb128 .LVL318-.LVL310
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL318-.LVL310
+	.uleb128 .LVL338-.LVL310
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL345-.LVL310
+	.uleb128 .LVL347-.LVL310
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL350-.LVL310
+	.uleb128 .LVL353-.LVL310
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL356-.LVL310
+	.uleb128 .LFE6419-.LVL310
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS369:
+	.uleb128 .LVU926
+	.uleb128 .LVU931
+.LLST369:
+	.byte	0x8
+	.quad	.LVL309
+	.uleb128 .LVL310-.LVL309
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS370:
+	.uleb128 .LVU928
+	.uleb128 .LVU931
+.LLST370:
+	.byte	0x8
+	.quad	.LVL309
+	.uleb128 .LVL310-.LVL309
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS403:
+	.uleb128 .LVU943
+	.uleb128 .LVU966
+	.uleb128 .LVU1048
+	.uleb128 .LVU1054
+.LLST403:
+	.byte	0x6
+	.quad	.LVL312
+	.byte	0x4
+	.uleb128 .LVL312-.LVL312
+	.uleb128 .LVL317-.LVL312
+	.uleb128 0xb
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL345-.LVL312
+	.uleb128 .LVL348-.LVL312
+	.uleb128 0xb
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS404:
+	.uleb128 .LVU961
+	.uleb128 .LVU966
+	.uleb128 .LVU1048
+	.uleb128 .LVU1056
+.LLST404:
+	.byte	0x6
+	.quad	.LVL315
+	.byte	0x4
+	.uleb128 .LVL315-.LVL315
+	.uleb128 .LVL317-.LVL315
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL345-.LVL315
+	.uleb128 .LVL350-.LVL315
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS405:
+	.uleb128 .LVU963
+	.uleb128 .LVU966
+	.uleb128 .LVU1048
+	.uleb128 .LVU1051
+.LLST405:
+	.byte	0x6
+	.quad	.LVL316
+	.byte	0x4
+	.uleb128 .LVL316-.LVL316
+	.uleb128 .LVL317-.LVL316
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL345-.LVL316
+	.uleb128 .LVL346-.LVL316
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS407:
+	.uleb128 .LVU941
+	.uleb128 .LVU943
+.LLST407:
+	.byte	0x8
+	.quad	.LVL312
+	.uleb128 .LVL312-.LVL312
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS409:
+	.uleb128 .LVU945
+	.uleb128 .LVU949
+.LLST409:
+	.byte	0x8
+	.quad	.LVL312
+	.uleb128 .LVL313-.LVL312
+	.uleb128 0xb
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS410:
+	.uleb128 .LVU949
+	.uleb128 .LVU953
+.LLST410:
+	.byte	0x8
+	.quad	.LVL313
+	.uleb128 .LVL314-.LVL313
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS411:
+	.uleb128 .LVU949
+	.uleb128 .LVU953
+.LLST411:
+	.byte	0x8
+	.quad	.LVL313
+	.uleb128 .LVL314-.LVL313
+	.uleb128 0xb
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS413:
+	.uleb128 .LVU953
+	.uleb128 .LVU956
+.LLST413:
+	.byte	0x8
+	.quad	.LVL314
+	.uleb128 .LVL314-.LVL314
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS414:
+	.uleb128 .LVU953
+	.uleb128 .LVU956
+.LLST414:
+	.byte	0x8
+	.quad	.LVL314
+	.uleb128 .LVL314-.LVL314
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS416:
+	.uleb128 .LVU961
+	.uleb128 .LVU963
+.LLST416:
+	.byte	0x8
+	.quad	.LVL315
+	.uleb128 .LVL316-.LVL315
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS418:
+	.uleb128 .LVU976
+	.uleb128 .LVU987
+.LLST418:
+	.byte	0x8
+	.quad	.LVL320
+	.uleb128 .LVL321-.LVL320
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS419:
+	.uleb128 .LVU976
+	.uleb128 .LVU1030
+	.uleb128 .LVU1030
+	.uleb128 .LVU1038
+	.uleb128 .LVU1056
+	.uleb128 .LVU1059
+	.uleb128 .LVU1065
+	.uleb128 0
+.LLST419:
+	.byte	0x6
+	.quad	.LVL320
+	.byte	0x4
+	.uleb128 .LVL320-.LVL320
+	.uleb128 .LVL333-.LVL320
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL333-.LVL320
+	.uleb128 .LVL337-.LVL320
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL350-.LVL320
+	.uleb128 .LVL352-.LVL320
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL356-.LVL320
+	.uleb128 .LFE6419-.LVL320
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS420:
+	.uleb128 .LVU976
+	.uleb128 .LVU988
+	.uleb128 .LVU988
+	.uleb128 .LVU1029
+	.uleb128 .LVU1029
+	.uleb128 .LVU1038
+	.uleb128 .LVU1056
+	.uleb128 .LVU1059
+	.uleb128 .LVU1065
+	.uleb128 0
+.LLST420:
+	.byte	0x6
+	.quad	.LVL320
+	.byte	0x4
+	.uleb128 .LVL320-.LVL320
+	.uleb128 .LVL322-.LVL320
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL322-.LVL320
+	.uleb128 .LVL332-.LVL320
+	.uleb128 0x9
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL332-.LVL320
+	.uleb128 .LVL337-.LVL320
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL350-.LVL320
+	.uleb128 .LVL352-.LVL320
+	.uleb128 0x9
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL356-.LVL320
+	.uleb128 .LFE6419-.LVL320
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS421:
+	.uleb128 .LVU982
+	.uleb128 .LVU1044
+	.uleb128 .LVU1056
+	.uleb128 0
+.LLST421:
+	.byte	0x6
+	.quad	.LVL320
+	.byte	0x4
+	.uleb128 .LVL320-.LVL320
+	.uleb128 .LVL341-.LVL320
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL350-.LVL320
+	.uleb128 .LFE6419-.LVL320
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS422:
+	.uleb128 .LVU985
+	.uleb128 .LVU992
+	.uleb128 .LVU992
+	.uleb128 .LVU1018
+	.uleb128 .LVU1018
+	.uleb128 .LVU1021
+	.uleb128 .LVU1021
+	.uleb128 .LVU1037
+	.uleb128 .LVU1056
+	.uleb128 .LVU1059
+	.uleb128 .LVU1065
+	.uleb128 .LVU1066
+.LLST422:
+	.byte	0x6
+	.quad	.LVL320
+	.byte	0x4
+	.uleb128 .LVL320-.LVL320
+	.uleb128 .LVL324-.LVL320
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.LVL320
+	.uleb128 .LVL329-.LVL320
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL329-.LVL320
+	.uleb128 .LVL330-.LVL320
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL330-.LVL320
+	.uleb128 .LVL337-.LVL320
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL350-.LVL320
+	.uleb128 .LVL352-.LVL320
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL356-.LVL320
+	.uleb128 .LVL357-.LVL320
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS424:
+	.uleb128 .LVU978
+	.uleb128 .LVU982
+.LLST424:
+	.byte	0x8
+	.quad	.LVL320
+	.uleb128 .LVL320-.LVL320
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS425:
+	.uleb128 .LVU980
+	.uleb128 .LVU982
+.LLST425:
+	.byte	0x8
+	.quad	.LVL320
+	.uleb128 .LVL320-.LVL320
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS442:
+	.uleb128 .LVU995
+	.uleb128 .LVU1018
+	.uleb128 .LVU1056
+	.uleb128 .LVU1064
+.LLST442:
+	.byte	0x6
+	.quad	.LVL324
+	.byte	0x4
+	.uleb128 .LVL324-.LVL324
+	.uleb128 .LVL329-.LVL324
+	.uleb128 0xa
+	.byte	0x79
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL350-.LVL324
+	.uleb128 .LVL355-1-.LVL324
+	.uleb128 0xa
+	.byte	0x79
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS443:
+	.uleb128 .LVU1013
+	.uleb128 .LVU1018
+	.uleb128 .LVU1056
+	.uleb128 .LVU1065
+.LLST443:
+	.byte	0x6
+	.quad	.LVL327
+	.byte	0x4
+	.uleb128 .LVL327-.LVL327
+	.uleb128 .LVL329-.LVL327
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL350-.LVL327
+	.uleb128 .LVL356-.LVL327
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS444:
+	.uleb128 .LVU1015
+	.uleb128 .LVU1018
+	.uleb128 .LVU1056
+	.uleb128 .LVU1058
+.LLST444:
+	.byte	0x6
+	.quad	.LVL328
+	.byte	0x4
+	.uleb128 .LVL328-.LVL328
+	.uleb128 .LVL329-.LVL328
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL350-.LVL328
+	.uleb128 .LVL351-.LVL328
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS446:
+	.uleb128 .LVU993
+	.uleb128 .LVU995
+.LLST446:
+	.byte	0x8
+	.quad	.LVL324
+	.uleb128 .LVL324-.LVL324
+	.uleb128 0xe
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS448:
+	.uleb128 .LVU997
+	.uleb128 .LVU1001
+.LLST448:
+	.byte	0x8
+	.quad	.LVL324
+	.uleb128 .LVL325-.LVL324
+	.uleb128 0xa
+	.byte	0x79
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS449:
+	.uleb128 .LVU1001
+	.uleb128 .LVU1005
+.LLST449:
+	.byte	0x8
+	.quad	.LVL325
+	.uleb128 .LVL326-.LVL325
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS450:
+	.uleb128 .LVU1001
+	.uleb128 .LVU1005
+.LLST450:
+	.byte	0x8
+	.quad	.LVL325
+	.uleb128 .LVL326-.LVL325
+	.uleb128 0xa
+	.byte	0x79
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS452:
+	.uleb128 .LVU1005
+	.uleb128 .LVU1008
+.LLST452:
+	.byte	0x8
+	.quad	.LVL326
+	.uleb128 .LVL326-.LVL326
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS453:
+	.uleb128 .LVU1005
+	.uleb128 .LVU1008
+.LLST453:
+	.byte	0x8
+	.quad	.LVL326
+	.uleb128 .LVL326-.LVL326
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS455:
+	.uleb128 .LVU1013
+	.uleb128 .LVU1015
+.LLST455:
+	.byte	0x8
+	.quad	.LVL327
+	.uleb128 .LVL328-.LVL327
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS456:
+	.uleb128 .LVU1023
+	.uleb128 .LVU1030
+	.uleb128 .LVU1030
+	.uleb128 .LVU1038
+	.uleb128 .LVU1065
+	.uleb128 0
+.LLST456:
+	.byte	0x6
+	.quad	.LVL331
+	.byte	0x4
+	.uleb128 .LVL331-.LVL331
+	.uleb128 .LVL333-.LVL331
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL333-.LVL331
+	.uleb128 .LVL337-.LVL331
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL356-.LVL331
+	.uleb128 .LFE6419-.LVL331
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS457:
+	.uleb128 .LVU1023
+	.uleb128 .LVU1029
+	.uleb128 .LVU1029
+	.uleb128 .LVU1037
+	.uleb128 .LVU1065
+	.uleb128 .LVU1066
+.LLST457:
+	.byte	0x6
+	.quad	.LVL331
+	.byte	0x4
+	.uleb128 .LVL331-.LVL331
+	.uleb128 .LVL332-.LVL331
+	.uleb128 0xc
+	.byte	0x79
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL332-.LVL331
+	.uleb128 .LVL337-.LVL331
+	.uleb128 0xd
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL356-.LVL331
+	.uleb128 .LVL357-.LVL331
+	.uleb128 0xd
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS458:
+	.uleb128 .LVU1025
+	.uleb128 .LVU1031
+	.uleb128 .LVU1031
+	.uleb128 .LVU1038
+	.uleb128 .LVU1065
+	.uleb128 0
+.LLST458:
+	.byte	0x6
+	.quad	.LVL331
+	.byte	0x4
+	.uleb128 .LVL331-.LVL331
+	.uleb128 .LVL334-.LVL331
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL334-.LVL331
+	.uleb128 .LVL337-.LVL331
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL356-.LVL331
+	.uleb128 .LFE6419-.LVL331
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU2
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL4-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-.LVL0
+	.uleb128 .LFE6407-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL10-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.LVL5
+	.uleb128 .LVL11-.LVL5
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL5
+	.uleb128 .LFE6408-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU16
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL7-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL5
+	.uleb128 .LVL12-.LVL5
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL12-.LVL5
+	.uleb128 .LFE6408-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+.LLST3:
+	.byte	0x8
+	.quad	.LVL9
+	.uleb128 .LVL9-.LVL9
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+.LLST4:
+	.byte	0x8
+	.quad	.LVL9
+	.uleb128 .LVL9-.LVL9
+	.uleb128 0x5
+	.byte	0x75
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL13
+	.byte	0x4
+	.uleb128 .LVL13-.LVL13
+	.uleb128 .LVL16-.LVL13
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL16-.LVL13
+	.uleb128 .LVL17-.LVL13
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL17-.LVL13
+	.uleb128 .LVL18-.LVL13
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL18-.LVL13
+	.uleb128 .LFE6409-.LVL13
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU34
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL13
+	.byte	0x4
+	.uleb128 .LVL13-.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.LVL13
+	.uleb128 .LVL18-.LVL13
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL18-.LVL13
+	.uleb128 .LFE6409-.LVL13
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL19
+	.byte	0x4
+	.uleb128 .LVL19-.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL20-.LVL19
+	.uleb128 .LVL24-.LVL19
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-.LVL19
+	.uleb128 .LVL25-.LVL19
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.LVL19
+	.uleb128 .LFE6410-.LVL19
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU48
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL19
+	.byte	0x4
+	.uleb128 .LVL19-.LVL19
+	.uleb128 .LVL21-.LVL19
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL19
+	.uleb128 .LVL26-.LVL19
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL26-.LVL19
+	.uleb128 .LFE6410-.LVL19
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU56
+	.uleb128 .LVU58
+.LLST9:
+	.byte	0x8
+	.quad	.LVL23
+	.uleb128 .LVL23-.LVL23
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU56
+	.uleb128 .LVU58
+.LLST10:
+	.byte	0x8
+	.quad	.LVL23
+	.uleb128 .LVL23-.LVL23
+	.uleb128 0x5
+	.byte	0x75
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL27
+	.byte	0x4
+	.uleb128 .LVL27-.LVL27
+	.uleb128 .LVL39-.LVL27
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-.LVL27
+	.uleb128 .LVL44-.LVL27
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.LVL27
+	.uleb128 .LVL48-.LVL27
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL48-.LVL27
+	.uleb128 .LFE6414-.LVL27
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL27
+	.byte	0x4
+	.uleb128 .LVL27-.LVL27
+	.uleb128 .LVL38-.LVL27
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL38-.LVL27
+	.uleb128 .LVL44-.LVL27
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.LVL27
+	.uleb128 .LVL48-.LVL27
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL48-.LVL27
+	.uleb128 .LFE6414-.LVL27
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU69
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU133
+	.uleb128 .LVU136
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU141
+	.uleb128 .LVU142
+	.uleb128 .LVU143
+.LLST13:
+	.byte	0x6
+	.quad	.LVL27
+	.byte	0x4
+	.uleb128 .LVL27-.LVL27
+	.uleb128 .LVL28-.LVL27
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL27
+	.uleb128 .LVL35-.LVL27
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL35-.LVL27
+	.uleb128 .LVL36-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL36-.LVL27
+	.uleb128 .LVL43-.LVL27
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL44-.LVL27
+	.uleb128 .LVL46-.LVL27
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL46-.LVL27
+	.uleb128 .LVL47-.LVL27
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL27
+	.uleb128 .LVL49-.LVL27
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU78
+	.uleb128 .LVU114
+	.uleb128 .LVU136
+	.uleb128 .LVU141
+.LLST15:
+	.byte	0x6
+	.quad	.LVL28
+	.byte	0x4
+	.uleb128 .LVL28-.LVL28
+	.uleb128 .LVL35-.LVL28
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL44-.LVL28
+	.uleb128 .LVL47-.LVL28
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU88
+	.uleb128 .LVU96
+.LLST16:
+	.byte	0x8
+	.quad	.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU136
+	.uleb128 .LVU138
+.LLST17:
+	.byte	0x6
+	.quad	.LVL34
+	.byte	0x4
+	.uleb128 .LVL34-.LVL34
+	.uleb128 .LVL35-.LVL34
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL44-.LVL34
+	.uleb128 .LVL45-.LVL34
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU80
+	.uleb128 .LVU84
+.LLST19:
+	.byte	0x8
+	.quad	.LVL28
+	.uleb128 .LVL29-.LVL28
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU90
+	.uleb128 .LVU93
+.LLST21:
+	.byte	0x8
+	.quad	.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU98
+	.uleb128 .LVU101
+.LLST23:
+	.byte	0x8
+	.quad	.LVL31
+	.uleb128 .LVL32-.LVL31
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU76
+	.uleb128 .LVU78
+.LLST25:
+	.byte	0x8
+	.quad	.LVL28
+	.uleb128 .LVL28-.LVL28
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU84
+	.uleb128 .LVU88
+.LLST26:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL30-.LVL29
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU84
+	.uleb128 .LVU88
+.LLST27:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL30-.LVL29
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU93
+	.uleb128 .LVU96
+.LLST28:
+	.byte	0x8
+	.quad	.LVL31
+	.uleb128 .LVL31-.LVL31
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU93
+	.uleb128 .LVU96
+.LLST29:
+	.byte	0x8
+	.quad	.LVL31
+	.uleb128 .LVL31-.LVL31
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU101
+	.uleb128 .LVU104
+.LLST31:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL32-.LVL32
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU119
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU134
+	.uleb128 .LVU142
+	.uleb128 0
+.LLST33:
+	.byte	0x6
+	.quad	.LVL37
+	.byte	0x4
+	.uleb128 .LVL37-.LVL37
+	.uleb128 .LVL38-.LVL37
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.LVL37
+	.uleb128 .LVL43-.LVL37
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL48-.LVL37
+	.uleb128 .LFE6414-.LVL37
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU119
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU133
+	.uleb128 .LVU142
+	.uleb128 .LVU143
+.LLST34:
+	.byte	0x6
+	.quad	.LVL37
+	.byte	0x4
+	.uleb128 .LVL37-.LVL37
+	.uleb128 .LVL39-.LVL37
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL37
+	.uleb128 .LVL43-.LVL37
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL37
+	.uleb128 .LVL49-.LVL37
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU121
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU134
+	.uleb128 .LVU142
+	.uleb128 .LVU144
+.LLST35:
+	.byte	0x6
+	.quad	.LVL37
+	.byte	0x4
+	.uleb128 .LVL37-.LVL37
+	.uleb128 .LVL40-.LVL37
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.LVL37
+	.uleb128 .LVL43-.LVL37
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL48-.LVL37
+	.uleb128 .LVL50-.LVL37
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU129
+	.uleb128 .LVU131
+.LLST36:
+	.byte	0x8
+	.quad	.LVL42
+	.uleb128 .LVL42-.LVL42
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU129
+	.uleb128 .LVU131
+.LLST37:
+	.byte	0x8
+	.quad	.LVL42
+	.uleb128 .LVL42-.LVL42
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST38:
+	.byte	0x6
+	.quad	.LVL51
+	.byte	0x4
+	.uleb128 .LVL51-.LVL51
+	.uleb128 .LVL59-.LVL51
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL59-.LVL51
+	.uleb128 .LVL64-.LVL51
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.LVL51
+	.uleb128 .LVL68-.LVL51
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL68-.LVL51
+	.uleb128 .LFE6413-.LVL51
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU148
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU184
+	.uleb128 .LVU187
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU194
+.LLST39:
+	.byte	0x6
+	.quad	.LVL51
+	.byte	0x4
+	.uleb128 .LVL51-.LVL51
+	.uleb128 .LVL52-.LVL51
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.LVL51
+	.uleb128 .LVL55-.LVL51
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL55-.LVL51
+	.uleb128 .LVL56-.LVL51
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL56-.LVL51
+	.uleb128 .LVL63-.LVL51
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL64-.LVL51
+	.uleb128 .LVL66-.LVL51
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL66-.LVL51
+	.uleb128 .LVL67-.LVL51
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.LVL51
+	.uleb128 .LVL69-.LVL51
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU155
+	.uleb128 .LVU167
+	.uleb128 .LVU187
+	.uleb128 .LVU192
+.LLST41:
+	.byte	0x6
+	.quad	.LVL52
+	.byte	0x4
+	.uleb128 .LVL52-.LVL52
+	.uleb128 .LVL55-.LVL52
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL64-.LVL52
+	.uleb128 .LVL67-.LVL52
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU164
+	.uleb128 .LVU167
+	.uleb128 .LVU187
+	.uleb128 .LVU189
+.LLST42:
+	.byte	0x6
+	.quad	.LVL54
+	.byte	0x4
+	.uleb128 .LVL54-.LVL54
+	.uleb128 .LVL55-.LVL54
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL64-.LVL54
+	.uleb128 .LVL65-.LVL54
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU157
+	.uleb128 .LVU160
+.LLST44:
+	.byte	0x8
+	.quad	.LVL52
+	.uleb128 .LVL53-.LVL52
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU153
+	.uleb128 .LVU155
+.LLST45:
+	.byte	0x8
+	.quad	.LVL52
+	.uleb128 .LVL52-.LVL52
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU160
+	.uleb128 .LVU164
+.LLST46:
+	.byte	0x8
+	.quad	.LVL53
+	.uleb128 .LVL54-.LVL53
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU172
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU185
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST48:
+	.byte	0x6
+	.quad	.LVL57
+	.byte	0x4
+	.uleb128 .LVL57-.LVL57
+	.uleb128 .LVL59-.LVL57
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.LVL57
+	.uleb128 .LVL63-.LVL57
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL68-.LVL57
+	.uleb128 .LFE6413-.LVL57
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU172
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU185
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST49:
+	.byte	0x6
+	.quad	.LVL57
+	.byte	0x4
+	.uleb128 .LVL57-.LVL57
+	.uleb128 .LVL58-.LVL57
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.LVL57
+	.uleb128 .LVL63-.LVL57
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL68-.LVL57
+	.uleb128 .LFE6413-.LVL57
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU174
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU185
+	.uleb128 .LVU193
+	.uleb128 .LVU195
+.LLST50:
+	.byte	0x6
+	.quad	.LVL57
+	.byte	0x4
+	.uleb128 .LVL57-.LVL57
+	.uleb128 .LVL60-.LVL57
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.LVL57
+	.uleb128 .LVL63-.LVL57
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL68-.LVL57
+	.uleb128 .LVL70-.LVL57
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS51:
+	.uleb128 0
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 0
+.LLST51:
+	.byte	0x6
+	.quad	.LVL71
+	.byte	0x4
+	.uleb128 .LVL71-.LVL71
+	.uleb128 .LVL81-.LVL71
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL81-.LVL71
+	.uleb128 .LVL87-.LVL71
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.LVL71
+	.uleb128 .LVL91-.LVL71
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL91-.LVL71
+	.uleb128 .LFE6411-.LVL71
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 0
+.LLST52:
+	.byte	0x6
+	.quad	.LVL71
+	.byte	0x4
+	.uleb128 .LVL71-.LVL71
+	.uleb128 .LVL82-.LVL71
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL82-.LVL71
+	.uleb128 .LVL87-.LVL71
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.LVL71
+	.uleb128 .LVL91-.LVL71
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL91-.LVL71
+	.uleb128 .LFE6411-.LVL71
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 0
+.LLST53:
+	.byte	0x6
+	.quad	.LVL71
+	.byte	0x4
+	.uleb128 .LVL71-.LVL71
+	.uleb128 .LVL73-.LVL71
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL73-.LVL71
+	.uleb128 .LFE6411-.LVL71
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST54:
+	.byte	0x8
+	.quad	.LVL72
+	.uleb128 .LFE6411-.LVL72
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU207
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU256
+	.uleb128 .LVU259
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU264
+	.uleb128 .LVU265
+	.uleb128 .LVU266
+.LLST55:
+	.byte	0x6
+	.quad	.LVL72
+	.byte	0x4
+	.uleb128 .LVL72-.LVL72
+	.uleb128 .LVL73-.LVL72
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.LVL72
+	.uleb128 .LVL78-.LVL72
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL78-.LVL72
+	.uleb128 .LVL79-.LVL72
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL79-.LVL72
+	.uleb128 .LVL86-.LVL72
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL87-.LVL72
+	.uleb128 .LVL89-.LVL72
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL89-.LVL72
+	.uleb128 .LVL90-.LVL72
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.LVL72
+	.uleb128 .LVL92-.LVL72
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU198
+	.uleb128 .LVU204
+.LLST57:
+	.byte	0x8
+	.quad	.LVL71
+	.uleb128 .LVL72-.LVL71
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU200
+	.uleb128 .LVU204
+.LLST58:
+	.byte	0x8
+	.quad	.LVL71
+	.uleb128 .LVL72-.LVL71
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU214
+	.uleb128 .LVU237
+	.uleb128 .LVU259
+	.uleb128 .LVU264
+.LLST75:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL78-.LVL73
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL87-.LVL73
+	.uleb128 .LVL90-.LVL73
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU232
+	.uleb128 .LVU237
+	.uleb128 .LVU259
+	.uleb128 .LVU265
+.LLST76:
+	.byte	0x6
+	.quad	.LVL76
+	.byte	0x4
+	.uleb128 .LVL76-.LVL76
+	.uleb128 .LVL78-.LVL76
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL87-.LVL76
+	.uleb128 .LVL91-.LVL76
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU234
+	.uleb128 .LVU237
+	.uleb128 .LVU259
+	.uleb128 .LVU261
+.LLST77:
+	.byte	0x6
+	.quad	.LVL77
+	.byte	0x4
+	.uleb128 .LVL77-.LVL77
+	.uleb128 .LVL78-.LVL77
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL87-.LVL77
+	.uleb128 .LVL88-.LVL77
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU216
+	.uleb128 .LVU220
+.LLST79:
+	.byte	0x8
+	.quad	.LVL73
+	.uleb128 .LVL74-.LVL73
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU212
+	.uleb128 .LVU214
+.LLST81:
+	.byte	0x8
+	.quad	.LVL73
+	.uleb128 .LVL73-.LVL73
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU220
+	.uleb128 .LVU224
+.LLST82:
+	.byte	0x8
+	.quad	.LVL74
+	.uleb128 .LVL75-.LVL74
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU220
+	.uleb128 .LVU224
+.LLST83:
+	.byte	0x8
+	.quad	.LVL74
+	.uleb128 .LVL75-.LVL74
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU224
+	.uleb128 .LVU227
+.LLST85:
+	.byte	0x8
+	.quad	.LVL75
+	.uleb128 .LVL75-.LVL75
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU224
+	.uleb128 .LVU227
+.LLST86:
+	.byte	0x8
+	.quad	.LVL75
+	.uleb128 .LVL75-.LVL75
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU232
+	.uleb128 .LVU234
+.LLST88:
+	.byte	0x8
+	.quad	.LVL76
+	.uleb128 .LVL77-.LVL76
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU242
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU257
+	.uleb128 .LVU265
+	.uleb128 0
+.LLST90:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL82-.LVL80
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.LVL80
+	.uleb128 .LVL86-.LVL80
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL91-.LVL80
+	.uleb128 .LFE6411-.LVL80
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU242
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU257
+	.uleb128 .LVU265
+	.uleb128 0
+.LLST91:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL81-.LVL80
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.LVL80
+	.uleb128 .LVL86-.LVL80
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL91-.LVL80
+	.uleb128 .LFE6411-.LVL80
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU244
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 .LVU257
+	.uleb128 .LVU265
+	.uleb128 .LVU267
+.LLST92:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL83-.LVL80
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.LVL80
+	.uleb128 .LVL86-.LVL80
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL91-.LVL80
+	.uleb128 .LVL93-.LVL80
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS93:
+	.uleb128 0
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 0
+.LLST93:
+	.byte	0x6
+	.quad	.LVL94
+	.byte	0x4
+	.uleb128 .LVL94-.LVL94
+	.uleb128 .LVL103-.LVL94
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL103-.LVL94
+	.uleb128 .LVL108-.LVL94
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.LVL94
+	.uleb128 .LVL112-.LVL94
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL112-.LVL94
+	.uleb128 .LFE6412-.LVL94
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 0
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 0
+.LLST94:
+	.byte	0x6
+	.quad	.LVL94
+	.byte	0x4
+	.uleb128 .LVL94-.LVL94
+	.uleb128 .LVL102-.LVL94
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL102-.LVL94
+	.uleb128 .LVL108-.LVL94
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.LVL94
+	.uleb128 .LVL112-.LVL94
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL112-.LVL94
+	.uleb128 .LFE6412-.LVL94
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU271
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU316
+	.uleb128 .LVU319
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+	.uleb128 .LVU325
+	.uleb128 .LVU326
+.LLST95:
+	.byte	0x6
+	.quad	.LVL94
+	.byte	0x4
+	.uleb128 .LVL94-.LVL94
+	.uleb128 .LVL95-.LVL94
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.LVL94
+	.uleb128 .LVL99-.LVL94
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL99-.LVL94
+	.uleb128 .LVL100-.LVL94
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL100-.LVL94
+	.uleb128 .LVL107-.LVL94
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL108-.LVL94
+	.uleb128 .LVL110-.LVL94
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL110-.LVL94
+	.uleb128 .LVL111-.LVL94
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.LVL94
+	.uleb128 .LVL113-.LVL94
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU279
+	.uleb128 .LVU297
+	.uleb128 .LVU319
+	.uleb128 .LVU324
+.LLST97:
+	.byte	0x6
+	.quad	.LVL95
+	.byte	0x4
+	.uleb128 .LVL95-.LVL95
+	.uleb128 .LVL99-.LVL95
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL108-.LVL95
+	.uleb128 .LVL111-.LVL95
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU289
+	.uleb128 .LVU297
+	.uleb128 .LVU319
+	.uleb128 .LVU325
+.LLST98:
+	.byte	0x6
+	.quad	.LVL97
+	.byte	0x4
+	.uleb128 .LVL97-.LVL97
+	.uleb128 .LVL99-.LVL97
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL108-.LVL97
+	.uleb128 .LVL112-.LVL97
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU294
+	.uleb128 .LVU297
+	.uleb128 .LVU319
+	.uleb128 .LVU321
+.LLST99:
+	.byte	0x6
+	.quad	.LVL98
+	.byte	0x4
+	.uleb128 .LVL98-.LVL98
+	.uleb128 .LVL99-.LVL98
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL108-.LVL98
+	.uleb128 .LVL109-.LVL98
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU281
+	.uleb128 .LVU285
+.LLST101:
+	.byte	0x8
+	.quad	.LVL95
+	.uleb128 .LVL96-.LVL95
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU277
+	.uleb128 .LVU279
+.LLST103:
+	.byte	0x8
+	.quad	.LVL95
+	.uleb128 .LVL95-.LVL95
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU285
+	.uleb128 .LVU289
+.LLST104:
+	.byte	0x8
+	.quad	.LVL96
+	.uleb128 .LVL97-.LVL96
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU285
+	.uleb128 .LVU289
+.LLST105:
+	.byte	0x8
+	.quad	.LVL96
+	.uleb128 .LVL97-.LVL96
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU291
+	.uleb128 .LVU294
+.LLST106:
+	.byte	0x8
+	.quad	.LVL97
+	.uleb128 .LVL98-.LVL97
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU302
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU317
+	.uleb128 .LVU325
+	.uleb128 0
+.LLST107:
+	.byte	0x6
+	.quad	.LVL101
+	.byte	0x4
+	.uleb128 .LVL101-.LVL101
+	.uleb128 .LVL102-.LVL101
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.LVL101
+	.uleb128 .LVL107-.LVL101
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL112-.LVL101
+	.uleb128 .LFE6412-.LVL101
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU302
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU316
+	.uleb128 .LVU325
+	.uleb128 .LVU326
+.LLST108:
+	.byte	0x6
+	.quad	.LVL101
+	.byte	0x4
+	.uleb128 .LVL101-.LVL101
+	.uleb128 .LVL103-.LVL101
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.LVL101
+	.uleb128 .LVL107-.LVL101
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.LVL101
+	.uleb128 .LVL113-.LVL101
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU304
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU317
+	.uleb128 .LVU325
+	.uleb128 .LVU327
+.LLST109:
+	.byte	0x6
+	.quad	.LVL101
+	.byte	0x4
+	.uleb128 .LVL101-.LVL101
+	.uleb128 .LVL104-.LVL101
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.LVL101
+	.uleb128 .LVL107-.LVL101
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL112-.LVL101
+	.uleb128 .LVL114-.LVL101
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU312
+	.uleb128 .LVU314
+.LLST110:
+	.byte	0x8
+	.quad	.LVL106
+	.uleb128 .LVL106-.LVL106
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU312
+	.uleb128 .LVU314
+.LLST111:
+	.byte	0x8
+	.quad	.LVL106
+	.uleb128 .LVL106-.LVL106
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 0
+.LLST112:
+	.byte	0x6
+	.quad	.LVL115
+	.byte	0x4
+	.uleb128 .LVL115-.LVL115
+	.uleb128 .LVL129-.LVL115
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL129-.LVL115
+	.uleb128 .LVL137-.LVL115
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.LVL115
+	.uleb128 .LVL144-.LVL115
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL144-.LVL115
+	.uleb128 .LFE6417-.LVL115
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU356
+	.uleb128 .LVU356
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 .LVU405
+	.uleb128 .LVU405
+	.uleb128 0
+.LLST113:
+	.byte	0x6
+	.quad	.LVL115
+	.byte	0x4
+	.uleb128 .LVL115-.LVL115
+	.uleb128 .LVL121-.LVL115
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL121-.LVL115
+	.uleb128 .LVL137-.LVL115
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.LVL115
+	.uleb128 .LVL141-.LVL115
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL141-.LVL115
+	.uleb128 .LFE6417-.LVL115
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU331
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU350
+	.uleb128 .LVU350
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU397
+	.uleb128 .LVU399
+	.uleb128 .LVU402
+	.uleb128 .LVU402
+	.uleb128 .LVU405
+	.uleb128 .LVU405
+	.uleb128 0
+.LLST114:
+	.byte	0x6
+	.quad	.LVL115
+	.byte	0x4
+	.uleb128 .LVL115-.LVL115
+	.uleb128 .LVL116-.LVL115
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.LVL115
+	.uleb128 .LVL119-.LVL115
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL119-.LVL115
+	.uleb128 .LVL120-.LVL115
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL120-.LVL115
+	.uleb128 .LVL135-.LVL115
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL137-.LVL115
+	.uleb128 .LVL139-.LVL115
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL139-.LVL115
+	.uleb128 .LVL141-.LVL115
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.LVL115
+	.uleb128 .LFE6417-.LVL115
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU338
+	.uleb128 .LVU350
+	.uleb128 .LVU399
+	.uleb128 .LVU403
+.LLST116:
+	.byte	0x6
+	.quad	.LVL116
+	.byte	0x4
+	.uleb128 .LVL116-.LVL116
+	.uleb128 .LVL119-.LVL116
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL137-.LVL116
+	.uleb128 .LVL140-1-.LVL116
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU347
+	.uleb128 .LVU350
+	.uleb128 .LVU399
+	.uleb128 .LVU401
+.LLST117:
+	.byte	0x6
+	.quad	.LVL118
+	.byte	0x4
+	.uleb128 .LVL118-.LVL118
+	.uleb128 .LVL119-.LVL118
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL137-.LVL118
+	.uleb128 .LVL138-.LVL118
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU340
+	.uleb128 .LVU343
+.LLST119:
+	.byte	0x8
+	.quad	.LVL116
+	.uleb128 .LVL117-.LVL116
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU336
+	.uleb128 .LVU338
+.LLST120:
+	.byte	0x8
+	.quad	.LVL116
+	.uleb128 .LVL116-.LVL116
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU343
+	.uleb128 .LVU347
+.LLST121:
+	.byte	0x8
+	.quad	.LVL117
+	.uleb128 .LVL118-.LVL117
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU356
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 .LVU395
+	.uleb128 .LVU405
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 0
+.LLST123:
+	.byte	0x6
+	.quad	.LVL121
+	.byte	0x4
+	.uleb128 .LVL121-.LVL121
+	.uleb128 .LVL130-.LVL121
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL130-.LVL121
+	.uleb128 .LVL134-.LVL121
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.LVL121
+	.uleb128 .LVL144-.LVL121
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL144-.LVL121
+	.uleb128 .LFE6417-.LVL121
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU356
+	.uleb128 .LVU359
+	.uleb128 .LVU359
+	.uleb128 .LVU395
+	.uleb128 .LVU405
+	.uleb128 0
+.LLST124:
+	.byte	0x6
+	.quad	.LVL121
+	.byte	0x4
+	.uleb128 .LVL121-.LVL121
+	.uleb128 .LVL122-.LVL121
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.LVL121
+	.uleb128 .LVL134-.LVL121
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL141-.LVL121
+	.uleb128 .LFE6417-.LVL121
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU361
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU394
+	.uleb128 .LVU405
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU411
+.LLST125:
+	.byte	0x6
+	.quad	.LVL123
+	.byte	0x4
+	.uleb128 .LVL123-.LVL123
+	.uleb128 .LVL126-.LVL123
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL126-.LVL123
+	.uleb128 .LVL127-.LVL123
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL127-.LVL123
+	.uleb128 .LVL134-.LVL123
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL141-.LVL123
+	.uleb128 .LVL143-.LVL123
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL143-.LVL123
+	.uleb128 .LVL144-.LVL123
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.LVL123
+	.uleb128 .LVL145-.LVL123
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU365
+	.uleb128 .LVU377
+	.uleb128 .LVU405
+	.uleb128 .LVU409
+.LLST127:
+	.byte	0x6
+	.quad	.LVL123
+	.byte	0x4
+	.uleb128 .LVL123-.LVL123
+	.uleb128 .LVL126-.LVL123
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL141-.LVL123
+	.uleb128 .LVL144-.LVL123
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU374
+	.uleb128 .LVU377
+	.uleb128 .LVU405
+	.uleb128 .LVU407
+.LLST128:
+	.byte	0x6
+	.quad	.LVL125
+	.byte	0x4
+	.uleb128 .LVL125-.LVL125
+	.uleb128 .LVL126-.LVL125
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL141-.LVL125
+	.uleb128 .LVL142-.LVL125
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU363
+	.uleb128 .LVU365
+.LLST130:
+	.byte	0x8
+	.quad	.LVL123
+	.uleb128 .LVL123-.LVL123
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU367
+	.uleb128 .LVU370
+.LLST132:
+	.byte	0x8
+	.quad	.LVL123
+	.uleb128 .LVL124-.LVL123
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU370
+	.uleb128 .LVU374
+.LLST133:
+	.byte	0x8
+	.quad	.LVL124
+	.uleb128 .LVL125-.LVL124
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU382
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 .LVU395
+	.uleb128 .LVU409
+	.uleb128 0
+.LLST134:
+	.byte	0x6
+	.quad	.LVL128
+	.byte	0x4
+	.uleb128 .LVL128-.LVL128
+	.uleb128 .LVL130-.LVL128
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.LVL128
+	.uleb128 .LVL134-.LVL128
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL144-.LVL128
+	.uleb128 .LFE6417-.LVL128
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU382
+	.uleb128 .LVU394
+	.uleb128 .LVU409
+	.uleb128 .LVU411
+.LLST135:
+	.byte	0x6
+	.quad	.LVL128
+	.byte	0x4
+	.uleb128 .LVL128-.LVL128
+	.uleb128 .LVL134-.LVL128
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.LVL128
+	.uleb128 .LVL145-.LVL128
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU384
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 .LVU395
+	.uleb128 .LVU409
+	.uleb128 0
+.LLST136:
+	.byte	0x6
+	.quad	.LVL128
+	.byte	0x4
+	.uleb128 .LVL128-.LVL128
+	.uleb128 .LVL131-.LVL128
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.LVL128
+	.uleb128 .LVL134-.LVL128
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL144-.LVL128
+	.uleb128 .LFE6417-.LVL128
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS137:
+	.uleb128 0
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 .LVU514
+	.uleb128 .LVU514
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 0
+.LLST137:
+	.byte	0x6
+	.quad	.LVL146
+	.byte	0x4
+	.uleb128 .LVL146-.LVL146
+	.uleb128 .LVL149-.LVL146
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL149-.LVL146
+	.uleb128 .LVL168-.LVL146
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL168-.LVL146
+	.uleb128 .LVL176-.LVL146
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL176-.LVL146
+	.uleb128 .LVL183-.LVL146
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL183-.LVL146
+	.uleb128 .LFE6415-.LVL146
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS138:
+	.uleb128 0
+	.uleb128 .LVU461
+	.uleb128 .LVU461
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 0
+.LLST138:
+	.byte	0x6
+	.quad	.LVL146
+	.byte	0x4
+	.uleb128 .LVL146-.LVL146
+	.uleb128 .LVL156-.LVL146
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL156-.LVL146
+	.uleb128 .LVL176-.LVL146
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL176-.LVL146
+	.uleb128 .LVL180-.LVL146
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL180-.LVL146
+	.uleb128 .LFE6415-.LVL146
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS139:
+	.uleb128 0
+	.uleb128 .LVU472
+	.uleb128 .LVU472
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 0
+.LLST139:
+	.byte	0x6
+	.quad	.LVL146
+	.byte	0x4
+	.uleb128 .LVL146-.LVL146
+	.uleb128 .LVL157-.LVL146
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL157-.LVL146
+	.uleb128 .LVL176-.LVL146
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL176-.LVL146
+	.uleb128 .LVL180-.LVL146
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL180-.LVL146
+	.uleb128 .LFE6415-.LVL146
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU421
+	.uleb128 .LVU475
+	.uleb128 .LVU527
+	.uleb128 .LVU533
+.LLST140:
+	.byte	0x6
+	.quad	.LVL148
+	.byte	0x4
+	.uleb128 .LVL148-.LVL148
+	.uleb128 .LVL159-.LVL148
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL176-.LVL148
+	.uleb128 .LVL180-.LVL148
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU424
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 .LVU454
+	.uleb128 .LVU454
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 .LVU525
+	.uleb128 .LVU527
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 0
+.LLST141:
+	.byte	0x6
+	.quad	.LVL148
+	.byte	0x4
+	.uleb128 .LVL148-.LVL148
+	.uleb128 .LVL149-.LVL148
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.LVL148
+	.uleb128 .LVL154-.LVL148
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL154-.LVL148
+	.uleb128 .LVL155-.LVL148
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL155-.LVL148
+	.uleb128 .LVL174-.LVL148
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL176-.LVL148
+	.uleb128 .LVL178-.LVL148
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL178-.LVL148
+	.uleb128 .LVL180-.LVL148
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.LVL148
+	.uleb128 .LFE6415-.LVL148
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU415
+	.uleb128 .LVU421
+.LLST143:
+	.byte	0x8
+	.quad	.LVL147
+	.uleb128 .LVL148-.LVL147
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU417
+	.uleb128 .LVU421
+.LLST144:
+	.byte	0x8
+	.quad	.LVL147
+	.uleb128 .LVL148-.LVL147
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU431
+	.uleb128 .LVU454
+	.uleb128 .LVU527
+	.uleb128 .LVU531
+.LLST177:
+	.byte	0x6
+	.quad	.LVL149
+	.byte	0x4
+	.uleb128 .LVL149-.LVL149
+	.uleb128 .LVL154-.LVL149
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL176-.LVL149
+	.uleb128 .LVL179-1-.LVL149
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU449
+	.uleb128 .LVU454
+	.uleb128 .LVU527
+	.uleb128 .LVU533
+.LLST178:
+	.byte	0x6
+	.quad	.LVL152
+	.byte	0x4
+	.uleb128 .LVL152-.LVL152
+	.uleb128 .LVL154-.LVL152
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL176-.LVL152
+	.uleb128 .LVL180-.LVL152
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU451
+	.uleb128 .LVU454
+	.uleb128 .LVU527
+	.uleb128 .LVU529
+.LLST179:
+	.byte	0x6
+	.quad	.LVL153
+	.byte	0x4
+	.uleb128 .LVL153-.LVL153
+	.uleb128 .LVL154-.LVL153
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL176-.LVL153
+	.uleb128 .LVL177-.LVL153
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU433
+	.uleb128 .LVU437
+.LLST181:
+	.byte	0x8
+	.quad	.LVL149
+	.uleb128 .LVL150-.LVL149
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU429
+	.uleb128 .LVU431
+.LLST183:
+	.byte	0x8
+	.quad	.LVL149
+	.uleb128 .LVL149-.LVL149
+	.uleb128 0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU437
+	.uleb128 .LVU441
+.LLST184:
+	.byte	0x8
+	.quad	.LVL150
+	.uleb128 .LVL151-.LVL150
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU437
+	.uleb128 .LVU441
+.LLST185:
+	.byte	0x8
+	.quad	.LVL150
+	.uleb128 .LVL151-.LVL150
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU441
+	.uleb128 .LVU444
+.LLST187:
+	.byte	0x8
+	.quad	.LVL151
+	.uleb128 .LVL151-.LVL151
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU441
+	.uleb128 .LVU444
+.LLST188:
+	.byte	0x8
+	.quad	.LVL151
+	.uleb128 .LVL151-.LVL151
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS190:
+	.uleb128 .LVU449
+	.uleb128 .LVU451
+.LLST190:
+	.byte	0x8
+	.quad	.LVL152
+	.uleb128 .LVL153-.LVL152
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU461
+	.uleb128 .LVU472
+.LLST192:
+	.byte	0x8
+	.quad	.LVL156
+	.uleb128 .LVL157-.LVL156
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU461
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 .LVU523
+	.uleb128 .LVU533
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 0
+.LLST193:
+	.byte	0x6
+	.quad	.LVL156
+	.byte	0x4
+	.uleb128 .LVL156-.LVL156
+	.uleb128 .LVL169-.LVL156
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL169-.LVL156
+	.uleb128 .LVL173-.LVL156
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.LVL156
+	.uleb128 .LVL183-.LVL156
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL183-.LVL156
+	.uleb128 .LFE6415-.LVL156
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU461
+	.uleb128 .LVU473
+	.uleb128 .LVU473
+	.uleb128 .LVU523
+	.uleb128 .LVU533
+	.uleb128 0
+.LLST194:
+	.byte	0x6
+	.quad	.LVL156
+	.byte	0x4
+	.uleb128 .LVL156-.LVL156
+	.uleb128 .LVL158-.LVL156
+	.uleb128 0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.LVL156
+	.uleb128 .LVL173-.LVL156
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL180-.LVL156
+	.uleb128 .LFE6415-.LVL156
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU467
+	.uleb128 .LVU527
+	.uleb128 .LVU533
+	.uleb128 0
+.LLST195:
+	.byte	0x6
+	.quad	.LVL156
+	.byte	0x4
+	.uleb128 .LVL156-.LVL156
+	.uleb128 .LVL176-.LVL156
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL180-.LVL156
+	.uleb128 .LFE6415-.LVL156
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU470
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU522
+	.uleb128 .LVU533
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU539
+.LLST196:
+	.byte	0x6
+	.quad	.LVL156
+	.byte	0x4
+	.uleb128 .LVL156-.LVL156
+	.uleb128 .LVL160-.LVL156
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.LVL156
+	.uleb128 .LVL165-.LVL156
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL165-.LVL156
+	.uleb128 .LVL166-.LVL156
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL166-.LVL156
+	.uleb128 .LVL173-.LVL156
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL180-.LVL156
+	.uleb128 .LVL182-.LVL156
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL182-.LVL156
+	.uleb128 .LVL183-.LVL156
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL183-.LVL156
+	.uleb128 .LVL184-.LVL156
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU463
+	.uleb128 .LVU467
+.LLST198:
+	.byte	0x8
+	.quad	.LVL156
+	.uleb128 .LVL156-.LVL156
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU465
+	.uleb128 .LVU467
+.LLST199:
+	.byte	0x8
+	.quad	.LVL156
+	.uleb128 .LVL156-.LVL156
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU480
+	.uleb128 .LVU503
+	.uleb128 .LVU533
+	.uleb128 .LVU537
+.LLST216:
+	.byte	0x6
+	.quad	.LVL160
+	.byte	0x4
+	.uleb128 .LVL160-.LVL160
+	.uleb128 .LVL165-.LVL160
+	.uleb128 0xa
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL180-.LVL160
+	.uleb128 .LVL183-.LVL160
+	.uleb128 0xa
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS217:
+	.uleb128 .LVU498
+	.uleb128 .LVU503
+	.uleb128 .LVU533
+	.uleb128 .LVU537
+.LLST217:
+	.byte	0x6
+	.quad	.LVL163
+	.byte	0x4
+	.uleb128 .LVL163-.LVL163
+	.uleb128 .LVL165-.LVL163
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL180-.LVL163
+	.uleb128 .LVL183-.LVL163
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU500
+	.uleb128 .LVU503
+	.uleb128 .LVU533
+	.uleb128 .LVU535
+.LLST218:
+	.byte	0x6
+	.quad	.LVL164
+	.byte	0x4
+	.uleb128 .LVL164-.LVL164
+	.uleb128 .LVL165-.LVL164
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL180-.LVL164
+	.uleb128 .LVL181-.LVL164
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS220:
+	.uleb128 .LVU478
+	.uleb128 .LVU480
+.LLST220:
+	.byte	0x8
+	.quad	.LVL160
+	.uleb128 .LVL160-.LVL160
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS222:
+	.uleb128 .LVU482
+	.uleb128 .LVU486
+.LLST222:
+	.byte	0x8
+	.quad	.LVL160
+	.uleb128 .LVL161-.LVL160
+	.uleb128 0xa
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS223:
+	.uleb128 .LVU486
+	.uleb128 .LVU490
+.LLST223:
+	.byte	0x8
+	.quad	.LVL161
+	.uleb128 .LVL162-.LVL161
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU486
+	.uleb128 .LVU490
+.LLST224:
+	.byte	0x8
+	.quad	.LVL161
+	.uleb128 .LVL162-.LVL161
+	.uleb128 0xa
+	.byte	0x78
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS226:
+	.uleb128 .LVU490
+	.uleb128 .LVU493
+.LLST226:
+	.byte	0x8
+	.quad	.LVL162
+	.uleb128 .LVL162-.LVL162
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU490
+	.uleb128 .LVU493
+.LLST227:
+	.byte	0x8
+	.quad	.LVL162
+	.uleb128 .LVL162-.LVL162
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS229:
+	.uleb128 .LVU498
+	.uleb128 .LVU500
+.LLST229:
+	.byte	0x8
+	.quad	.LVL163
+	.uleb128 .LVL164-.LVL163
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS230:
+	.uleb128 .LVU508
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 .LVU523
+	.uleb128 .LVU537
+	.uleb128 0
+.LLST230:
+	.byte	0x6
+	.quad	.LVL167
+	.byte	0x4
+	.uleb128 .LVL167-.LVL167
+	.uleb128 .LVL169-.LVL167
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.LVL167
+	.uleb128 .LVL173-.LVL167
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL183-.LVL167
+	.uleb128 .LFE6415-.LVL167
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS231:
+	.uleb128 .LVU508
+	.uleb128 .LVU522
+	.uleb128 .LVU537
+	.uleb128 .LVU539
+.LLST231:
+	.byte	0x6
+	.quad	.LVL167
+	.byte	0x4
+	.uleb128 .LVL167-.LVL167
+	.uleb128 .LVL173-.LVL167
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL183-.LVL167
+	.uleb128 .LVL184-.LVL167
+	.uleb128 0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS232:
+	.uleb128 .LVU510
+	.uleb128 .LVU516
+	.uleb128 .LVU516
+	.uleb128 .LVU523
+	.uleb128 .LVU537
+	.uleb128 0
+.LLST232:
+	.byte	0x6
+	.quad	.LVL167
+	.byte	0x4
+	.uleb128 .LVL167-.LVL167
+	.uleb128 .LVL170-.LVL167
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.LVL167
+	.uleb128 .LVL173-.LVL167
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL183-.LVL167
+	.uleb128 .LFE6415-.LVL167
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS233:
+	.uleb128 0
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+	.uleb128 0
+.LLST233:
+	.byte	0x6
+	.quad	.LVL185
+	.byte	0x4
+	.uleb128 .LVL185-.LVL185
+	.uleb128 .LVL201-.LVL185
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL201-.LVL185
+	.uleb128 .LVL208-.LVL185
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.LVL185
+	.uleb128 .LVL215-.LVL185
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL215-.LVL185
+	.uleb128 .LFE6416-.LVL185
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS234:
+	.uleb128 0
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 .LVU633
+	.uleb128 .LVU633
+	.uleb128 0
+.LLST234:
+	.byte	0x6
+	.quad	.LVL185
+	.byte	0x4
+	.uleb128 .LVL185-.LVL185
+	.uleb128 .LVL192-.LVL185
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL192-.LVL185
+	.uleb128 .LVL208-.LVL185
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.LVL185
+	.uleb128 .LVL212-.LVL185
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL212-.LVL185
+	.uleb128 .LFE6416-.LVL185
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS235:
+	.uleb128 .LVU543
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU572
+	.uleb128 .LVU572
+	.uleb128 .LVU625
+	.uleb128 .LVU627
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 .LVU633
+	.uleb128 .LVU633
+	.uleb128 0
+.LLST235:
+	.byte	0x6
+	.quad	.LVL185
+	.byte	0x4
+	.uleb128 .LVL185-.LVL185
+	.uleb128 .LVL186-.LVL185
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.LVL185
+	.uleb128 .LVL190-.LVL185
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL190-.LVL185
+	.uleb128 .LVL191-.LVL185
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL191-.LVL185
+	.uleb128 .LVL206-.LVL185
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL208-.LVL185
+	.uleb128 .LVL210-.LVL185
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL210-.LVL185
+	.uleb128 .LVL212-.LVL185
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.LVL185
+	.uleb128 .LFE6416-.LVL185
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS237:
+	.uleb128 .LVU551
+	.uleb128 .LVU569
+	.uleb128 .LVU627
+	.uleb128 .LVU631
+.LLST237:
+	.byte	0x6
+	.quad	.LVL186
+	.byte	0x4
+	.uleb128 .LVL186-.LVL186
+	.uleb128 .LVL190-.LVL186
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL208-.LVL186
+	.uleb128 .LVL211-1-.LVL186
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS238:
+	.uleb128 .LVU561
+	.uleb128 .LVU569
+	.uleb128 .LVU627
+	.uleb128 .LVU633
+.LLST238:
+	.byte	0x6
+	.quad	.LVL188
+	.byte	0x4
+	.uleb128 .LVL188-.LVL188
+	.uleb128 .LVL190-.LVL188
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL208-.LVL188
+	.uleb128 .LVL212-.LVL188
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS239:
+	.uleb128 .LVU566
+	.uleb128 .LVU569
+	.uleb128 .LVU627
+	.uleb128 .LVU629
+.LLST239:
+	.byte	0x6
+	.quad	.LVL189
+	.byte	0x4
+	.uleb128 .LVL189-.LVL189
+	.uleb128 .LVL190-.LVL189
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL208-.LVL189
+	.uleb128 .LVL209-.LVL189
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS241:
+	.uleb128 .LVU553
+	.uleb128 .LVU557
+.LLST241:
+	.byte	0x8
+	.quad	.LVL186
+	.uleb128 .LVL187-.LVL186
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS243:
+	.uleb128 .LVU549
+	.uleb128 .LVU551
+.LLST243:
+	.byte	0x8
+	.quad	.LVL186
+	.uleb128 .LVL186-.LVL186
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS244:
+	.uleb128 .LVU557
+	.uleb128 .LVU561
+.LLST244:
+	.byte	0x8
+	.quad	.LVL187
+	.uleb128 .LVL188-.LVL187
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS245:
+	.uleb128 .LVU557
+	.uleb128 .LVU561
+.LLST245:
+	.byte	0x8
+	.quad	.LVL187
+	.uleb128 .LVL188-.LVL187
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS246:
+	.uleb128 .LVU563
+	.uleb128 .LVU566
+.LLST246:
+	.byte	0x8
+	.quad	.LVL188
+	.uleb128 .LVL189-.LVL188
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS248:
+	.uleb128 .LVU576
+	.uleb128 .LVU611
+	.uleb128 .LVU611
+	.uleb128 .LVU623
+	.uleb128 .LVU633
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+	.uleb128 0
+.LLST248:
+	.byte	0x6
+	.quad	.LVL192
+	.byte	0x4
+	.uleb128 .LVL192-.LVL192
+	.uleb128 .LVL200-.LVL192
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL200-.LVL192
+	.uleb128 .LVL205-.LVL192
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.LVL192
+	.uleb128 .LVL215-.LVL192
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL215-.LVL192
+	.uleb128 .LFE6416-.LVL192
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS249:
+	.uleb128 .LVU576
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU623
+	.uleb128 .LVU633
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+	.uleb128 0
+.LLST249:
+	.byte	0x6
+	.quad	.LVL192
+	.byte	0x4
+	.uleb128 .LVL192-.LVL192
+	.uleb128 .LVL201-.LVL192
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL201-.LVL192
+	.uleb128 .LVL205-.LVL192
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.LVL192
+	.uleb128 .LVL215-.LVL192
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.LVL192
+	.uleb128 .LFE6416-.LVL192
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU580
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 .LVU605
+	.uleb128 .LVU605
+	.uleb128 .LVU622
+	.uleb128 .LVU633
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+	.uleb128 .LVU639
+.LLST250:
+	.byte	0x6
+	.quad	.LVL193
+	.byte	0x4
+	.uleb128 .LVL193-.LVL193
+	.uleb128 .LVL197-.LVL193
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL197-.LVL193
+	.uleb128 .LVL198-.LVL193
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL198-.LVL193
+	.uleb128 .LVL205-.LVL193
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL212-.LVL193
+	.uleb128 .LVL214-.LVL193
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL214-.LVL193
+	.uleb128 .LVL215-.LVL193
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.LVL193
+	.uleb128 .LVL216-.LVL193
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS252:
+	.uleb128 .LVU584
+	.uleb128 .LVU602
+	.uleb128 .LVU633
+	.uleb128 .LVU637
+.LLST252:
+	.byte	0x6
+	.quad	.LVL193
+	.byte	0x4
+	.uleb128 .LVL193-.LVL193
+	.uleb128 .LVL197-.LVL193
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL212-.LVL193
+	.uleb128 .LVL215-.LVL193
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS253:
+	.uleb128 .LVU594
+	.uleb128 .LVU602
+	.uleb128 .LVU633
+	.uleb128 .LVU637
+.LLST253:
+	.byte	0x6
+	.quad	.LVL195
+	.byte	0x4
+	.uleb128 .LVL195-.LVL195
+	.uleb128 .LVL197-.LVL195
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL212-.LVL195
+	.uleb128 .LVL215-.LVL195
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS254:
+	.uleb128 .LVU599
+	.uleb128 .LVU602
+	.uleb128 .LVU633
+	.uleb128 .LVU635
+.LLST254:
+	.byte	0x6
+	.quad	.LVL196
+	.byte	0x4
+	.uleb128 .LVL196-.LVL196
+	.uleb128 .LVL197-.LVL196
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL212-.LVL196
+	.uleb128 .LVL213-.LVL196
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS256:
+	.uleb128 .LVU586
+	.uleb128 .LVU590
+.LLST256:
+	.byte	0x8
+	.quad	.LVL193
+	.uleb128 .LVL194-.LVL193
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS258:
+	.uleb128 .LVU582
+	.uleb128 .LVU584
+.LLST258:
+	.byte	0x8
+	.quad	.LVL193
+	.uleb128 .LVL193-.LVL193
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS259:
+	.uleb128 .LVU590
+	.uleb128 .LVU594
+.LLST259:
+	.byte	0x8
+	.quad	.LVL194
+	.uleb128 .LVL195-.LVL194
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS260:
+	.uleb128 .LVU590
+	.uleb128 .LVU594
+.LLST260:
+	.byte	0x8
+	.quad	.LVL194
+	.uleb128 .LVL195-.LVL194
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS261:
+	.uleb128 .LVU596
+	.uleb128 .LVU599
+.LLST261:
+	.byte	0x8
+	.quad	.LVL195
+	.uleb128 .LVL196-.LVL195
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS262:
+	.uleb128 .LVU607
+	.uleb128 .LVU611
+	.uleb128 .LVU611
+	.uleb128 .LVU623
+	.uleb128 .LVU637
+	.uleb128 0
+.LLST262:
+	.byte	0x6
+	.quad	.LVL199
+	.byte	0x4
+	.uleb128 .LVL199-.LVL199
+	.uleb128 .LVL200-.LVL199
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.LVL199
+	.uleb128 .LVL205-.LVL199
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL215-.LVL199
+	.uleb128 .LFE6416-.LVL199
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS263:
+	.uleb128 .LVU607
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU622
+	.uleb128 .LVU637
+	.uleb128 .LVU639
+.LLST263:
+	.byte	0x6
+	.quad	.LVL199
+	.byte	0x4
+	.uleb128 .LVL199-.LVL199
+	.uleb128 .LVL201-.LVL199
+	.uleb128 0x9
+	.byte	0x70
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL201-.LVL199
+	.uleb128 .LVL205-.LVL199
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.LVL199
+	.uleb128 .LVL216-.LVL199
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS264:
+	.uleb128 .LVU609
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 .LVU623
+	.uleb128 .LVU637
+	.uleb128 0
+.LLST264:
+	.byte	0x6
+	.quad	.LVL199
+	.byte	0x4
+	.uleb128 .LVL199-.LVL199
+	.uleb128 .LVL202-.LVL199
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.LVL199
+	.uleb128 .LVL205-.LVL199
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL215-.LVL199
+	.uleb128 .LFE6416-.LVL199
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS265:
+	.uleb128 .LVU618
+	.uleb128 .LVU620
+.LLST265:
+	.byte	0x8
+	.quad	.LVL204
+	.uleb128 .LVL204-.LVL204
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS266:
+	.uleb128 .LVU618
+	.uleb128 .LVU620
+.LLST266:
+	.byte	0x8
+	.quad	.LVL204
+	.uleb128 .LVL204-.LVL204
+	.uleb128 0xc
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS459:
+	.uleb128 0
+	.uleb128 .LVU1181
+	.uleb128 .LVU1181
+	.uleb128 .LVU1194
+	.uleb128 .LVU1194
+	.uleb128 .LVU1204
+	.uleb128 .LVU1204
+	.uleb128 0
+.LLST459:
+	.byte	0x6
+	.quad	.LVL358
+	.byte	0x4
+	.uleb128 .LVL358-.LVL358
+	.uleb128 .LVL380-.LVL358
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL380-.LVL358
+	.uleb128 .LVL387-.LVL358
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL387-.LVL358
+	.uleb128 .LVL394-.LVL358
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL394-.LVL358
+	.uleb128 .LFE6418-.LVL358
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS460:
+	.uleb128 0
+	.uleb128 .LVU1125
+	.uleb128 .LVU1125
+	.uleb128 .LVU1194
+	.uleb128 .LVU1194
+	.uleb128 .LVU1200
+	.uleb128 .LVU1200
+	.uleb128 0
+.LLST460:
+	.byte	0x6
+	.quad	.LVL358
+	.byte	0x4
+	.uleb128 .LVL358-.LVL358
+	.uleb128 .LVL368-.LVL358
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL368-.LVL358
+	.uleb128 .LVL387-.LVL358
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL387-.LVL358
+	.uleb128 .LVL391-.LVL358
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL391-.LVL358
+	.uleb128 .LFE6418-.LVL358
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS461:
+	.uleb128 .LVU1072
+	.uleb128 .LVU1078
+	.uleb128 .LVU1078
+	.uleb128 .LVU1117
+	.uleb128 .LVU1117
+	.uleb128 .LVU1120
+	.uleb128 .LVU1120
+	.uleb128 .LVU1192
+	.uleb128 .LVU1194
+	.uleb128 .LVU1197
+	.uleb128 .LVU1197
+	.uleb128 .LVU1200
+	.uleb128 .LVU1200
+	.uleb128 0
+.LLST461:
+	.byte	0x6
+	.quad	.LVL358
+	.byte	0x4
+	.uleb128 .LVL358-.LVL358
+	.uleb128 .LVL359-.LVL358
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL359-.LVL358
+	.uleb128 .LVL366-.LVL358
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL366-.LVL358
+	.uleb128 .LVL367-.LVL358
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL367-.LVL358
+	.uleb128 .LVL385-.LVL358
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL387-.LVL358
+	.uleb128 .LVL389-.LVL358
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL389-.LVL358
+	.uleb128 .LVL391-.LVL358
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL391-.LVL358
+	.uleb128 .LFE6418-.LVL358
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS463:
+	.uleb128 .LVU1081
+	.uleb128 .LVU1117
+	.uleb128 .LVU1194
+	.uleb128 .LVU1198
+.LLST463:
+	.byte	0x6
+	.quad	.LVL359
+	.byte	0x4
+	.uleb128 .LVL359-.LVL359
+	.uleb128 .LVL366-.LVL359
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL387-.LVL359
+	.uleb128 .LVL390-1-.LVL359
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS464:
+	.uleb128 .LVU1091
+	.uleb128 .LVU1099
+.LLST464:
+	.byte	0x8
+	.quad	.LVL361
+	.uleb128 .LVL362-.LVL361
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS465:
+	.uleb128 .LVU1114
+	.uleb128 .LVU1117
+	.uleb128 .LVU1194
+	.uleb128 .LVU1196
+.LLST465:
+	.byte	0x6
+	.quad	.LVL365
+	.byte	0x4
+	.uleb128 .LVL365-.LVL365
+	.uleb128 .LVL366-.LVL365
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL387-.LVL365
+	.uleb128 .LVL388-.LVL365
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS467:
+	.uleb128 .LVU1083
+	.uleb128 .LVU1087
+.LLST467:
+	.byte	0x8
+	.quad	.LVL359
+	.uleb128 .LVL360-.LVL359
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS469:
+	.uleb128 .LVU1093
+	.uleb128 .LVU1096
+.LLST469:
+	.byte	0x8
+	.quad	.LVL361
+	.uleb128 .LVL362-.LVL361
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS471:
+	.uleb128 .LVU1101
+	.uleb128 .LVU1104
+.LLST471:
+	.byte	0x8
+	.quad	.LVL362
+	.uleb128 .LVL363-.LVL362
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS473:
+	.uleb128 .LVU1079
+	.uleb128 .LVU1081
+.LLST473:
+	.byte	0x8
+	.quad	.LVL359
+	.uleb128 .LVL359-.LVL359
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS474:
+	.uleb128 .LVU1087
+	.uleb128 .LVU1091
+.LLST474:
+	.byte	0x8
+	.quad	.LVL360
+	.uleb128 .LVL361-.LVL360
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0
+.LVUS475:
+	.uleb128 .LVU1087
+	.uleb128 .LVU1091
+.LLST475:
+	.byte	0x8
+	.quad	.LVL360
+	.uleb128 .LVL361-.LVL360
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS476:
+	.uleb128 .LVU1096
+	.uleb128 .LVU1099
+.LLST476:
+	.byte	0x8
+	.quad	.LVL362
+	.uleb128 .LVL362-.LVL362
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS477:
+	.uleb128 .LVU1096
+	.uleb128 .LVU1099
+.LLST477:
+	.byte	0x8
+	.quad	.LVL362
+	.uleb128 .LVL362-.LVL362
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS479:
+	.uleb128 .LVU1104
+	.uleb128 .LVU1107
+.LLST479:
+	.byte	0x8
+	.quad	.LVL363
+	.uleb128 .LVL363-.LVL363
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS482:
+	.uleb128 .LVU1125
+	.uleb128 .LVU1178
+	.uleb128 .LVU1178
+	.uleb128 .LVU1190
+	.uleb128 .LVU1200
+	.uleb128 .LVU1204
+	.uleb128 .LVU1204
+	.uleb128 0
+.LLST482:
+	.byte	0x6
+	.quad	.LVL368
+	.byte	0x4
+	.uleb128 .LVL368-.LVL368
+	.uleb128 .LVL379-.LVL368
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL379-.LVL368
+	.uleb128 .LVL384-.LVL368
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL391-.LVL368
+	.uleb128 .LVL394-.LVL368
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL394-.LVL368
+	.uleb128 .LFE6418-.LVL368
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS483:
+	.uleb128 .LVU1125
+	.uleb128 .LVU1181
+	.uleb128 .LVU1181
+	.uleb128 .LVU1190
+	.uleb128 .LVU1200
+	.uleb128 .LVU1204
+	.uleb128 .LVU1204
+	.uleb128 0
+.LLST483:
+	.byte	0x6
+	.quad	.LVL368
+	.byte	0x4
+	.uleb128 .LVL368-.LVL368
+	.uleb128 .LVL380-.LVL368
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL380-.LVL368
+	.uleb128 .LVL384-.LVL368
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL391-.LVL368
+	.uleb128 .LVL394-.LVL368
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL394-.LVL368
+	.uleb128 .LFE6418-.LVL368
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS484:
+	.uleb128 .LVU1129
+	.uleb128 .LVU1169
+	.uleb128 .LVU1169
+	.uleb128 .LVU1172
+	.uleb128 .LVU1172
+	.uleb128 .LVU1189
+	.uleb128 .LVU1200
+	.uleb128 .LVU1203
+	.uleb128 .LVU1203
+	.uleb128 .LVU1204
+	.uleb128 .LVU1204
+	.uleb128 .LVU1206
+.LLST484:
+	.byte	0x6
+	.quad	.LVL369
+	.byte	0x4
+	.uleb128 .LVL369-.LVL369
+	.uleb128 .LVL376-.LVL369
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL376-.LVL369
+	.uleb128 .LVL377-.LVL369
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL377-.LVL369
+	.uleb128 .LVL384-.LVL369
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL391-.LVL369
+	.uleb128 .LVL393-.LVL369
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL393-.LVL369
+	.uleb128 .LVL394-.LVL369
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL394-.LVL369
+	.uleb128 .LVL395-.LVL369
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS486:
+	.uleb128 .LVU1133
+	.uleb128 .LVU1169
+	.uleb128 .LVU1200
+	.uleb128 .LVU1204
+.LLST486:
+	.byte	0x6
+	.quad	.LVL369
+	.byte	0x4
+	.uleb128 .LVL369-.LVL369
+	.uleb128 .LVL376-.LVL369
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL391-.LVL369
+	.uleb128 .LVL394-.LVL369
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS487:
+	.uleb128 .LVU1143
+	.uleb128 .LVU1151
+.LLST487:
+	.byte	0x8
+	.quad	.LVL371
+	.uleb128 .LVL372-.LVL371
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS488:
+	.uleb128 .LVU1166
+	.uleb128 .LVU1169
+	.uleb128 .LVU1200
+	.uleb128 .LVU1202
+.LLST488:
+	.byte	0x6
+	.quad	.LVL375
+	.byte	0x4
+	.uleb128 .LVL375-.LVL375
+	.uleb128 .LVL376-.LVL375
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL391-.LVL375
+	.uleb128 .LVL392-.LVL375
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS490:
+	.uleb128 .LVU1135
+	.uleb128 .LVU1139
+.LLST490:
+	.byte	0x8
+	.quad	.LVL369
+	.uleb128 .LVL370-.LVL369
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS492:
+	.uleb128 .LVU1145
+	.uleb128 .LVU1148
+.LLST492:
+	.byte	0x8
+	.quad	.LVL371
+	.uleb128 .LVL372-.LVL371
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS494:
+	.uleb128 .LVU1153
+	.uleb128 .LVU1156
+.LLST494:
+	.byte	0x8
+	.quad	.LVL372
+	.uleb128 .LVL373-.LVL372
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS496:
+	.uleb128 .LVU1131
+	.uleb128 .LVU1133
+.LLST496:
+	.byte	0x8
+	.quad	.LVL369
+	.uleb128 .LVL369-.LVL369
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS497:
+	.uleb128 .LVU1139
+	.uleb128 .LVU1143
+.LLST497:
+	.byte	0x8
+	.quad	.LVL370
+	.uleb128 .LVL371-.LVL370
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS498:
+	.uleb128 .LVU1139
+	.uleb128 .LVU1143
+.LLST498:
+	.byte	0x8
+	.quad	.LVL370
+	.uleb128 .LVL371-.LVL370
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS499:
+	.uleb128 .LVU1148
+	.uleb128 .LVU1151
+.LLST499:
+	.byte	0x8
+	.quad	.LVL372
+	.uleb128 .LVL372-.LVL372
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS500:
+	.uleb128 .LVU1148
+	.uleb128 .LVU1151
+.LLST500:
+	.byte	0x8
+	.quad	.LVL372
+	.uleb128 .LVL372-.LVL372
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS502:
+	.uleb128 .LVU1156
+	.uleb128 .LVU1159
+.LLST502:
+	.byte	0x8
+	.quad	.LVL373
+	.uleb128 .LVL373-.LVL373
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS504:
+	.uleb128 .LVU1174
+	.uleb128 .LVU1178
+	.uleb128 .LVU1178
+	.uleb128 .LVU1190
+	.uleb128 .LVU1204
+	.uleb128 0
+.LLST504:
+	.byte	0x6
+	.quad	.LVL378
+	.byte	0x4
+	.uleb128 .LVL378-.LVL378
+	.uleb128 .LVL379-.LVL378
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL379-.LVL378
+	.uleb128 .LVL384-.LVL378
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL394-.LVL378
+	.uleb128 .LFE6418-.LVL378
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS505:
+	.uleb128 .LVU1174
+	.uleb128 .LVU1181
+	.uleb128 .LVU1181
+	.uleb128 .LVU1189
+	.uleb128 .LVU1204
+	.uleb128 .LVU1206
+.LLST505:
+	.byte	0x6
+	.quad	.LVL378
+	.byte	0x4
+	.uleb128 .LVL378-.LVL378
+	.uleb128 .LVL380-.LVL378
+	.uleb128 0x9
+	.byte	0x70
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL380-.LVL378
+	.uleb128 .LVL384-.LVL378
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL394-.LVL378
+	.uleb128 .LVL395-.LVL378
+	.uleb128 0xa
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS506:
+	.uleb128 .LVU1176
+	.uleb128 .LVU1182
+	.uleb128 .LVU1182
+	.uleb128 .LVU1190
+	.uleb128 .LVU1204
+	.uleb128 0
+.LLST506:
+	.byte	0x6
+	.quad	.LVL378
+	.byte	0x4
+	.uleb128 .LVL378-.LVL378
+	.uleb128 .LVL381-.LVL378
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL381-.LVL378
+	.uleb128 .LVL384-.LVL378
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL394-.LVL378
+	.uleb128 .LFE6418-.LVL378
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS507:
+	.uleb128 .LVU1185
+	.uleb128 .LVU1187
+.LLST507:
+	.byte	0x8
+	.quad	.LVL383
+	.uleb128 .LVL383-.LVL383
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS508:
+	.uleb128 .LVU1185
+	.uleb128 .LVU1187
+.LLST508:
+	.byte	0x8
+	.quad	.LVL383
+	.uleb128 .LVL383-.LVL383
+	.uleb128 0xc
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS574:
+	.uleb128 0
+	.uleb128 .LVU1398
+	.uleb128 .LVU1398
+	.uleb128 .LVU1406
+	.uleb128 .LVU1406
+	.uleb128 .LVU1407
+	.uleb128 .LVU1407
+	.uleb128 .LVU1411
+	.uleb128 .LVU1411
+	.uleb128 .LVU1414
+	.uleb128 .LVU1414
+	.uleb128 .LVU1417
+	.uleb128 .LVU1417
+	.uleb128 0
+.LLST574:
+	.byte	0x6
+	.quad	.LVL446
+	.byte	0x4
+	.uleb128 .LVL446-.LVL446
+	.uleb128 .LVL447-1-.LVL446
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL447-1-.LVL446
+	.uleb128 .LVL450-.LVL446
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL450-.LVL446
+	.uleb128 .LVL451-.LVL446
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL451-.LVL446
+	.uleb128 .LVL452-.LVL446
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL452-.LVL446
+	.uleb128 .LVL453-.LVL446
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL453-.LVL446
+	.uleb128 .LVL454-.LVL446
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL454-.LVL446
+	.uleb128 .LFE6423-.LVL446
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS575:
+	.uleb128 .LVU1402
+	.uleb128 .LVU1404
+.LLST575:
+	.byte	0x8
+	.quad	.LVL448
+	.uleb128 .LVL449-.LVL448
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS576:
+	.uleb128 0
+	.uleb128 .LVU1424
+	.uleb128 .LVU1424
+	.uleb128 .LVU1434
+	.uleb128 .LVU1434
+	.uleb128 0
+.LLST576:
+	.byte	0x6
+	.quad	.LVL455
+	.byte	0x4
+	.uleb128 .LVL455-.LVL455
+	.uleb128 .LVL456-1-.LVL455
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL456-1-.LVL455
+	.uleb128 .LVL459-.LVL455
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL459-.LVL455
+	.uleb128 .LFE6424-.LVL455
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS577:
+	.uleb128 .LVU1425
+	.uleb128 .LVU1431
+.LLST577:
+	.byte	0x8
+	.quad	.LVL457
+	.uleb128 .LVL458-.LVL457
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x3c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	.LFB6426
+	.quad	.LFE6426-.LFB6426
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL14:
+	.byte	0x5
+	.quad	.LBB294
+	.byte	0x4
+	.uleb128 .LBB294-.LBB294
+	.uleb128 .LBE294-.LBB294
+	.byte	0x4
+	.uleb128 .LBB327-.LBB294
+	.uleb128 .LBE327-.LBB294
+	.byte	0x4
+	.uleb128 .LBB328-.LBB294
+	.uleb128 .LBE328-.LBB294
+	.byte	0x4
+	.uleb128 .LBB333-.LBB294
+	.uleb128 .LBE333-.LBB294
+	.byte	0
+.LLRL18:
+	.byte	0x5
+	.quad	.LBB295
+	.byte	0x4
+	.uleb128 .LBB295-.LBB295
+	.uleb128 .LBE295-.LBB295
+	.byte	0x4
+	.uleb128 .LBB310-.LBB295
+	.uleb128 .LBE310-.LBB295
+	.byte	0x4
+	.uleb128 .LBB312-.LBB295
+	.uleb128 .LBE312-.LBB295
+	.byte	0
+.LLRL20:
+	.byte	0x5
+	.quad	.LBB299
+	.byte	0x4
+	.uleb128 .LBB299-.LBB299
+	.uleb128 .LBE299-.LBB299
+	.byte	0x4
+	.uleb128 .LBB315-.LBB299
+	.uleb128 .LBE315-.LBB299
+	.byte	0
+.LLRL22:
+	.byte	0x5
+	.quad	.LBB302
+	.byte	0x4
+	.uleb128 .LBB302-.LBB302
+	.uleb128 .LBE302-.LBB302
+	.byte	0x4
+	.uleb128 .LBB306-.LBB302
+	.uleb128 .LBE306-.LBB302
+	.byte	0x4
+	.uleb128 .LBB318-.LBB302
+	.uleb128 .LBE318-.LBB302
+	.byte	0
+.LLRL24:
+	.byte	0x5
+	.quad	.LBB307
+	.byte	0x4
+	.uleb128 .LBB307-.LBB307
+	.uleb128 .LBE307-.LBB307
+	.byte	0x4
+	.uleb128 .LBB311-.LBB307
+	.uleb128 .LBE311-.LBB307
+	.byte	0
+.LLRL30:
+	.byte	0x5
+	.quad	.LBB319
+	.byte	0x4
+	.uleb128 .LBB319-.LBB319
+	.uleb128 .LBE319-.LBB319
+	.byte	0x4
+	.uleb128 .LBB325-.LBB319
+	.uleb128 .LBE325-.LBB319
+	.byte	0
+.LLRL32:
+	.byte	0x5
+	.quad	.LBB322
+	.byte	0x4
+	.uleb128 .LBB322-.LBB322
+	.uleb128 .LBE322-.LBB322
+	.byte	0x4
+	.uleb128 .LBB326-.LBB322
+	.uleb128 .LBE326-.LBB322
+	.byte	0
+.LLRL40:
+	.byte	0x5
+	.quad	.LBB343
+	.byte	0x4
+	.uleb128 .LBB343-.LBB343
+	.uleb128 .LBE343-.LBB343
+	.byte	0x4
+	.uleb128 .LBB352-.LBB343
+	.uleb128 .LBE352-.LBB343
+	.byte	0x4
+	.uleb128 .LBB357-.LBB343
+	.uleb128 .LBE357-.LBB343
+	.byte	0
+.LLRL43:
+	.byte	0x5
+	.quad	.LBB344
+	.byte	0x4
+	.uleb128 .LBB344-.LBB344
+	.uleb128 .LBE344-.LBB344
+	.byte	0x4
+	.uleb128 .LBB349-.LBB344
+	.uleb128 .LBE349-.LBB344
+	.byte	0
+.LLRL47:
+	.byte	0x5
+	.quad	.LBB353
+	.byte	0x4
+	.uleb128 .LBB353-.LBB353
+	.uleb128 .LBE353-.LBB353
+	.byte	0x4
+	.uleb128 .LBB356-.LBB353
+	.uleb128 .LBE356-.LBB353
+	.byte	0
+.LLRL56:
+	.byte	0x5
+	.quad	.LBB374
+	.byte	0x4
+	.uleb128 .LBB374-.LBB374
+	.uleb128 .LBE374-.LBB374
+	.byte	0x4
+	.uleb128 .LBB379-.LBB374
+	.uleb128 .LBE379-.LBB374
+	.byte	0
+.LLRL74:
+	.byte	0x5
+	.quad	.LBB380
+	.byte	0x4
+	.uleb128 .LBB380-.LBB380
+	.uleb128 .LBE380-.LBB380
+	.byte	0x4
+	.uleb128 .LBB401-.LBB380
+	.uleb128 .LBE401-.LBB380
+	.byte	0x4
+	.uleb128 .LBB406-.LBB380
+	.uleb128 .LBE406-.LBB380
+	.byte	0
+.LLRL78:
+	.byte	0x5
+	.quad	.LBB381
+	.byte	0x4
+	.uleb128 .LBB381-.LBB381
+	.uleb128 .LBE381-.LBB381
+	.byte	0x4
+	.uleb128 .LBB388-.LBB381
+	.uleb128 .LBE388-.LBB381
+	.byte	0x4
+	.uleb128 .LBB390-.LBB381
+	.uleb128 .LBE390-.LBB381
+	.byte	0
+.LLRL80:
+	.byte	0x5
+	.quad	.LBB385
+	.byte	0x4
+	.uleb128 .LBB385-.LBB385
+	.uleb128 .LBE385-.LBB385
+	.byte	0x4
+	.uleb128 .LBB389-.LBB385
+	.uleb128 .LBE389-.LBB385
+	.byte	0
+.LLRL84:
+	.byte	0x5
+	.quad	.LBB393
+	.byte	0x4
+	.uleb128 .LBB393-.LBB393
+	.uleb128 .LBE393-.LBB393
+	.byte	0x4
+	.uleb128 .LBB399-.LBB393
+	.uleb128 .LBE399-.LBB393
+	.byte	0
+.LLRL87:
+	.byte	0x5
+	.quad	.LBB396
+	.byte	0x4
+	.uleb128 .LBB396-.LBB396
+	.uleb128 .LBE396-.LBB396
+	.byte	0x4
+	.uleb128 .LBB400-.LBB396
+	.uleb128 .LBE400-.LBB396
+	.byte	0
+.LLRL89:
+	.byte	0x5
+	.quad	.LBB402
+	.byte	0x4
+	.uleb128 .LBB402-.LBB402
+	.uleb128 .LBE402-.LBB402
+	.byte	0x4
+	.uleb128 .LBB405-.LBB402
+	.uleb128 .LBE405-.LBB402
+	.byte	0
+.LLRL96:
+	.byte	0x5
+	.quad	.LBB420
+	.byte	0x4
+	.uleb128 .LBB420-.LBB420
+	.uleb128 .LBE420-.LBB420
+	.byte	0x4
+	.uleb128 .LBB437-.LBB420
+	.uleb128 .LBE437-.LBB420
+	.byte	0x4
+	.uleb128 .LBB438-.LBB420
+	.uleb128 .LBE438-.LBB420
+	.byte	0x4
+	.uleb128 .LBB443-.LBB420
+	.uleb128 .LBE443-.LBB420
+	.byte	0
+.LLRL100:
+	.byte	0x5
+	.quad	.LBB421
+	.byte	0x4
+	.uleb128 .LBB421-.LBB421
+	.uleb128 .LBE421-.LBB421
+	.byte	0x4
+	.uleb128 .LBB426-.LBB421
+	.uleb128 .LBE426-.LBB421
+	.byte	0x4
+	.uleb128 .LBB430-.LBB421
+	.uleb128 .LBE430-.LBB421
+	.byte	0x4
+	.uleb128 .LBB432-.LBB421
+	.uleb128 .LBE432-.LBB421
+	.byte	0
+.LLRL102:
+	.byte	0x5
+	.quad	.LBB427
+	.byte	0x4
+	.uleb128 .LBB427-.LBB427
+	.uleb128 .LBE427-.LBB427
+	.byte	0x4
+	.uleb128 .LBB431-.LBB427
+	.uleb128 .LBE431-.LBB427
+	.byte	0
+.LLRL115:
+	.byte	0x5
+	.quad	.LBB469
+	.byte	0x4
+	.uleb128 .LBB469-.LBB469
+	.uleb128 .LBE469-.LBB469
+	.byte	0x4
+	.uleb128 .LBB478-.LBB469
+	.uleb128 .LBE478-.LBB469
+	.byte	0x4
+	.uleb128 .LBB496-.LBB469
+	.uleb128 .LBE496-.LBB469
+	.byte	0
+.LLRL118:
+	.byte	0x5
+	.quad	.LBB470
+	.byte	0x4
+	.uleb128 .LBB470-.LBB470
+	.uleb128 .LBE470-.LBB470
+	.byte	0x4
+	.uleb128 .LBB475-.LBB470
+	.uleb128 .LBE475-.LBB470
+	.byte	0
+.LLRL122:
+	.byte	0x5
+	.quad	.LBB479
+	.byte	0x4
+	.uleb128 .LBB479-.LBB479
+	.uleb128 .LBE479-.LBB479
+	.byte	0x4
+	.uleb128 .LBB497-.LBB479
+	.uleb128 .LBE497-.LBB479
+	.byte	0
+.LLRL126:
+	.byte	0x5
+	.quad	.LBB481
+	.byte	0x4
+	.uleb128 .LBB481-.LBB481
+	.uleb128 .LBE481-.LBB481
+	.byte	0x4
+	.uleb128 .LBB494-.LBB481
+	.uleb128 .LBE494-.LBB481
+	.byte	0
+.LLRL129:
+	.byte	0x5
+	.quad	.LBB482
+	.byte	0x4
+	.uleb128 .LBB482-.LBB482
+	.uleb128 .LBE482-.LBB482
+	.byte	0x4
+	.uleb128 .LBB488-.LBB482
+	.uleb128 .LBE488-.LBB482
+	.byte	0
+.LLRL131:
+	.byte	0x5
+	.quad	.LBB485
+	.byte	0x4
+	.uleb128 .LBB485-.LBB485
+	.uleb128 .LBE485-.LBB485
+	.byte	0x4
+	.uleb128 .LBB489-.LBB485
+	.uleb128 .LBE489-.LBB485
+	.byte	0
+.LLRL142:
+	.byte	0x5
+	.quad	.LBB544
+	.byte	0x4
+	.uleb128 .LBB544-.LBB544
+	.uleb128 .LBE544-.LBB544
+	.byte	0x4
+	.uleb128 .LBB549-.LBB544
+	.uleb128 .LBE549-.LBB544
+	.byte	0
+.LLRL176:
+	.byte	0x5
+	.quad	.LBB550
+	.byte	0x4
+	.uleb128 .LBB550-.LBB550
+	.uleb128 .LBE550-.LBB550
+	.byte	0x4
+	.uleb128 .LBB571-.LBB550
+	.uleb128 .LBE571-.LBB550
+	.byte	0x4
+	.uleb128 .LBB610-.LBB550
+	.uleb128 .LBE610-.LBB550
+	.byte	0
+.LLRL180:
+	.byte	0x5
+	.quad	.LBB551
+	.byte	0x4
+	.uleb128 .LBB551-.LBB551
+	.uleb128 .LBE551-.LBB551
+	.byte	0x4
+	.uleb128 .LBB558-.LBB551
+	.uleb128 .LBE558-.LBB551
+	.byte	0x4
+	.uleb128 .LBB560-.LBB551
+	.uleb128 .LBE560-.LBB551
+	.byte	0
+.LLRL182:
+	.byte	0x5
+	.quad	.LBB555
+	.byte	0x4
+	.uleb128 .LBB555-.LBB555
+	.uleb128 .LBE555-.LBB555
+	.byte	0x4
+	.uleb128 .LBB559-.LBB555
+	.uleb128 .LBE559-.LBB555
+	.byte	0
+.LLRL186:
+	.byte	0x5
+	.quad	.LBB563
+	.byte	0x4
+	.uleb128 .LBB563-.LBB563
+	.uleb128 .LBE563-.LBB563
+	.byte	0x4
+	.uleb128 .LBB569-.LBB563
+	.uleb128 .LBE569-.LBB563
+	.byte	0
+.LLRL189:
+	.byte	0x5
+	.quad	.LBB566
+	.byte	0x4
+	.uleb128 .LBB566-.LBB566
+	.uleb128 .LBE566-.LBB566
+	.byte	0x4
+	.uleb128 .LBB570-.LBB566
+	.uleb128 .LBE570-.LBB566
+	.byte	0
+.LLRL191:
+	.byte	0x5
+	.quad	.LBB572
+	.byte	0x4
+	.uleb128 .LBB572-.LBB572
+	.uleb128 .LBE572-.LBB572
+	.byte	0x4
+	.uleb128 .LBB609-.LBB572
+	.uleb128 .LBE609-.LBB572
+	.byte	0x4
+	.uleb128 .LBB611-.LBB572
+	.uleb128 .LBE611-.LBB572
+	.byte	0
+.LLRL197:
+	.byte	0x5
+	.quad	.LBB574
+	.byte	0x4
+	.uleb128 .LBB574-.LBB574
+	.uleb128 .LBE574-.LBB574
+	.byte	0x4
+	.uleb128 .LBB579-.LBB574
+	.uleb128 .LBE579-.LBB574
+	.byte	0
+.LLRL215:
+	.byte	0x5
+	.quad	.LBB580
+	.byte	0x4
+	.uleb128 .LBB580-.LBB580
+	.uleb128 .LBE580-.LBB580
+	.byte	0x4
+	.uleb128 .LBB603-.LBB580
+	.uleb128 .LBE603-.LBB580
+	.byte	0x4
+	.uleb128 .LBB606-.LBB580
+	.uleb128 .LBE606-.LBB580
+	.byte	0
+.LLRL219:
+	.byte	0x5
+	.quad	.LBB581
+	.byte	0x4
+	.uleb128 .LBB581-.LBB581
+	.uleb128 .LBE581-.LBB581
+	.byte	0x4
+	.uleb128 .LBB589-.LBB581
+	.uleb128 .LBE589-.LBB581
+	.byte	0x4
+	.uleb128 .LBB591-.LBB581
+	.uleb128 .LBE591-.LBB581
+	.byte	0
+.LLRL221:
+	.byte	0x5
+	.quad	.LBB585
+	.byte	0x4
+	.uleb128 .LBB585-.LBB585
+	.uleb128 .LBE585-.LBB585
+	.byte	0x4
+	.uleb128 .LBB590-.LBB585
+	.uleb128 .LBE590-.LBB585
+	.byte	0x4
+	.uleb128 .LBB592-.LBB585
+	.uleb128 .LBE592-.LBB585
+	.byte	0
+.LLRL225:
+	.byte	0x5
+	.quad	.LBB595
+	.byte	0x4
+	.uleb128 .LBB595-.LBB595
+	.uleb128 .LBE595-.LBB595
+	.byte	0x4
+	.uleb128 .LBB601-.LBB595
+	.uleb128 .LBE601-.LBB595
+	.byte	0
+.LLRL228:
+	.byte	0x5
+	.quad	.LBB598
+	.byte	0x4
+	.uleb128 .LBB598-.LBB598
+	.uleb128 .LBE598-.LBB598
+	.byte	0x4
+	.uleb128 .LBB602-.LBB598
+	.uleb128 .LBE602-.LBB598
+	.byte	0
+.LLRL236:
+	.byte	0x5
+	.quad	.LBB645
+	.byte	0x4
+	.uleb128 .LBB645-.LBB645
+	.uleb128 .LBE645-.LBB645
+	.byte	0x4
+	.uleb128 .LBB662-.LBB645
+	.uleb128 .LBE662-.LBB645
+	.byte	0x4
+	.uleb128 .LBB663-.LBB645
+	.uleb128 .LBE663-.LBB645
+	.byte	0x4
+	.uleb128 .LBB694-.LBB645
+	.uleb128 .LBE694-.LBB645
+	.byte	0
+.LLRL240:
+	.byte	0x5
+	.quad	.LBB646
+	.byte	0x4
+	.uleb128 .LBB646-.LBB646
+	.uleb128 .LBE646-.LBB646
+	.byte	0x4
+	.uleb128 .LBB651-.LBB646
+	.uleb128 .LBE651-.LBB646
+	.byte	0x4
+	.uleb128 .LBB655-.LBB646
+	.uleb128 .LBE655-.LBB646
+	.byte	0x4
+	.uleb128 .LBB657-.LBB646
+	.uleb128 .LBE657-.LBB646
+	.byte	0
+.LLRL242:
+	.byte	0x5
+	.quad	.LBB652
+	.byte	0x4
+	.uleb128 .LBB652-.LBB652
+	.uleb128 .LBE652-.LBB652
+	.byte	0x4
+	.uleb128 .LBB656-.LBB652
+	.uleb128 .LBE656-.LBB652
+	.byte	0
+.LLRL247:
+	.byte	0x5
+	.quad	.LBB664
+	.byte	0x4
+	.uleb128 .LBB664-.LBB664
+	.uleb128 .LBE664-.LBB664
+	.byte	0x4
+	.uleb128 .LBB693-.LBB664
+	.uleb128 .LBE693-.LBB664
+	.byte	0x4
+	.uleb128 .LBB695-.LBB664
+	.uleb128 .LBE695-.LBB664
+	.byte	0
+.LLRL251:
+	.byte	0x5
+	.quad	.LBB666
+	.byte	0x4
+	.uleb128 .LBB666-.LBB666
+	.uleb128 .LBE666-.LBB666
+	.byte	0x4
+	.uleb128 .LBB685-.LBB666
+	.uleb128 .LBE685-.LBB666
+	.byte	0x4
+	.uleb128 .LBB690-.LBB666
+	.uleb128 .LBE690-.LBB666
+	.byte	0
+.LLRL255:
+	.byte	0x5
+	.quad	.LBB667
+	.byte	0x4
+	.uleb128 .LBB667-.LBB667
+	.uleb128 .LBE667-.LBB667
+	.byte	0x4
+	.uleb128 .LBB676-.LBB667
+	.uleb128 .LBE676-.LBB667
+	.byte	0x4
+	.uleb128 .LBB678-.LBB667
+	.uleb128 .LBE678-.LBB667
+	.byte	0x4
+	.uleb128 .LBB680-.LBB667
+	.uleb128 .LBE680-.LBB667
+	.byte	0
+.LLRL257:
+	.byte	0x5
+	.quad	.LBB672
+	.byte	0x4
+	.uleb128 .LBB672-.LBB672
+	.uleb128 .LBE672-.LBB672
+	.byte	0x4
+	.uleb128 .LBB677-.LBB672
+	.uleb128 .LBE677-.LBB672
+	.byte	0x4
+	.uleb128 .LBB679-.LBB672
+	.uleb128 .LBE679-.LBB672
+	.byte	0
+.LLRL270:
+	.byte	0x5
+	.quad	.LBB721
+	.byte	0x4
+	.uleb128 .LBB721-.LBB721
+	.uleb128 .LBE721-.LBB721
+	.byte	0x4
+	.uleb128 .LBB760-.LBB721
+	.uleb128 .LBE760-.LBB721
+	.byte	0
+.LLRL275:
+	.byte	0x5
+	.quad	.LBB726
+	.byte	0x4
+	.uleb128 .LBB726-.LBB726
+	.uleb128 .LBE726-.LBB726
+	.byte	0x4
+	.uleb128 .LBB761-.LBB726
+	.uleb128 .LBE761-.LBB726
+	.byte	0x4
+	.uleb128 .LBB762-.LBB726
+	.uleb128 .LBE762-.LBB726
+	.byte	0
+.LLRL279:
+	.byte	0x5
+	.quad	.LBB728
+	.byte	0x4
+	.uleb128 .LBB728-.LBB728
+	.uleb128 .LBE728-.LBB728
+	.byte	0x4
+	.uleb128 .LBB756-.LBB728
+	.uleb128 .LBE756-.LBB728
+	.byte	0
+.LLRL282:
+	.byte	0x5
+	.quad	.LBB729
+	.byte	0x4
+	.uleb128 .LBB729-.LBB729
+	.uleb128 .LBE729-.LBB729
+	.byte	0x4
+	.uleb128 .LBB735-.LBB729
+	.uleb128 .LBE735-.LBB729
+	.byte	0
+.LLRL284:
+	.byte	0x5
+	.quad	.LBB732
+	.byte	0x4
+	.uleb128 .LBB732-.LBB732
+	.uleb128 .LBE732-.LBB732
+	.byte	0x4
+	.uleb128 .LBB736-.LBB732
+	.uleb128 .LBE736-.LBB732
+	.byte	0
+.LLRL287:
+	.byte	0x5
+	.quad	.LBB739
+	.byte	0x4
+	.uleb128 .LBB739-.LBB739
+	.uleb128 .LBE739-.LBB739
+	.byte	0x4
+	.uleb128 .LBB757-.LBB739
+	.uleb128 .LBE757-.LBB739
+	.byte	0
+.LLRL291:
+	.byte	0x5
+	.quad	.LBB741
+	.byte	0x4
+	.uleb128 .LBB741-.LBB741
+	.uleb128 .LBE741-.LBB741
+	.byte	0x4
+	.uleb128 .LBB754-.LBB741
+	.uleb128 .LBE754-.LBB741
+	.byte	0
+.LLRL294:
+	.byte	0x5
+	.quad	.LBB742
+	.byte	0x4
+	.uleb128 .LBB742-.LBB742
+	.uleb128 .LBE742-.LBB742
+	.byte	0x4
+	.uleb128 .LBB748-.LBB742
+	.uleb128 .LBE748-.LBB742
+	.byte	0
+.LLRL296:
+	.byte	0x5
+	.quad	.LBB745
+	.byte	0x4
+	.uleb128 .LBB745-.LBB745
+	.uleb128 .LBE745-.LBB745
+	.byte	0x4
+	.uleb128 .LBB749-.LBB745
+	.uleb128 .LBE749-.LBB745
+	.byte	0
+.LLRL305:
+	.byte	0x5
+	.quad	.LBB794
+	.byte	0x4
+	.uleb128 .LBB794-.LBB794
+	.uleb128 .LBE794-.LBB794
+	.byte	0x4
+	.uleb128 .LBB803-.LBB794
+	.uleb128 .LBE803-.LBB794
+	.byte	0x4
+	.uleb128 .LBB804-.LBB794
+	.uleb128 .LBE804-.LBB794
+	.byte	0x4
+	.uleb128 .LBB863-.LBB794
+	.uleb128 .LBE863-.LBB794
+	.byte	0
+.LLRL308:
+	.byte	0x5
+	.quad	.LBB795
+	.byte	0x4
+	.uleb128 .LBB795-.LBB795
+	.uleb128 .LBE795-.LBB795
+	.byte	0x4
+	.uleb128 .LBB799-.LBB795
+	.uleb128 .LBE799-.LBB795
+	.byte	0x4
+	.uleb128 .LBB802-.LBB795
+	.uleb128 .LBE802-.LBB795
+	.byte	0
+.LLRL311:
+	.byte	0x5
+	.quad	.LBB805
+	.byte	0x4
+	.uleb128 .LBB805-.LBB805
+	.uleb128 .LBE805-.LBB805
+	.byte	0x4
+	.uleb128 .LBB862-.LBB805
+	.uleb128 .LBE862-.LBB805
+	.byte	0x4
+	.uleb128 .LBB864-.LBB805
+	.uleb128 .LBE864-.LBB805
+	.byte	0x4
+	.uleb128 .LBB865-.LBB805
+	.uleb128 .LBE865-.LBB805
+	.byte	0
+.LLRL315:
+	.byte	0x5
+	.quad	.LBB807
+	.byte	0x4
+	.uleb128 .LBB807-.LBB807
+	.uleb128 .LBE807-.LBB807
+	.byte	0x4
+	.uleb128 .LBB826-.LBB807
+	.uleb128 .LBE826-.LBB807
+	.byte	0x4
+	.uleb128 .LBB857-.LBB807
+	.uleb128 .LBE857-.LBB807
+	.byte	0
+.LLRL319:
+	.byte	0x5
+	.quad	.LBB808
+	.byte	0x4
+	.uleb128 .LBB808-.LBB808
+	.uleb128 .LBE808-.LBB808
+	.byte	0x4
+	.uleb128 .LBB817-.LBB808
+	.uleb128 .LBE817-.LBB808
+	.byte	0x4
+	.uleb128 .LBB819-.LBB808
+	.uleb128 .LBE819-.LBB808
+	.byte	0x4
+	.uleb128 .LBB821-.LBB808
+	.uleb128 .LBE821-.LBB808
+	.byte	0
+.LLRL321:
+	.byte	0x5
+	.quad	.LBB813
+	.byte	0x4
+	.uleb128 .LBB813-.LBB813
+	.uleb128 .LBE813-.LBB813
+	.byte	0x4
+	.uleb128 .LBB818-.LBB813
+	.uleb128 .LBE818-.LBB813
+	.byte	0x4
+	.uleb128 .LBB820-.LBB813
+	.uleb128 .LBE820-.LBB813
+	.byte	0
+.LLRL326:
+	.byte	0x5
+	.quad	.LBB827
+	.byte	0x4
+	.uleb128 .LBB827-.LBB827
+	.uleb128 .LBE827-.LBB827
+	.byte	0x4
+	.uleb128 .LBB856-.LBB827
+	.uleb128 .LBE856-.LBB827
+	.byte	0x4
+	.uleb128 .LBB858-.LBB827
+	.uleb128 .LBE858-.LBB827
+	.byte	0
+.LLRL330:
+	.byte	0x5
+	.quad	.LBB829
+	.byte	0x4
+	.uleb128 .LBB829-.LBB829
+	.uleb128 .LBE829-.LBB829
+	.byte	0x4
+	.uleb128 .LBB848-.LBB829
+	.uleb128 .LBE848-.LBB829
+	.byte	0x4
+	.uleb128 .LBB853-.LBB829
+	.uleb128 .LBE853-.LBB829
+	.byte	0
+.LLRL334:
+	.byte	0x5
+	.quad	.LBB830
+	.byte	0x4
+	.uleb128 .LBB830-.LBB830
+	.uleb128 .LBE830-.LBB830
+	.byte	0x4
+	.uleb128 .LBB839-.LBB830
+	.uleb128 .LBE839-.LBB830
+	.byte	0x4
+	.uleb128 .LBB841-.LBB830
+	.uleb128 .LBE841-.LBB830
+	.byte	0x4
+	.uleb128 .LBB843-.LBB830
+	.uleb128 .LBE843-.LBB830
+	.byte	0
+.LLRL336:
+	.byte	0x5
+	.quad	.LBB835
+	.byte	0x4
+	.uleb128 .LBB835-.LBB835
+	.uleb128 .LBE835-.LBB835
+	.byte	0x4
+	.uleb128 .LBB840-.LBB835
+	.uleb128 .LBE840-.LBB835
+	.byte	0x4
+	.uleb128 .LBB842-.LBB835
+	.uleb128 .LBE842-.LBB835
+	.byte	0
+.LLRL351:
+	.byte	0x5
+	.quad	.LBB909
+	.byte	0x4
+	.uleb128 .LBB909-.LBB909
+	.uleb128 .LBE909-.LBB909
+	.byte	0x4
+	.uleb128 .LBB912-.LBB909
+	.uleb128 .LBE912-.LBB909
+	.byte	0
+.LLRL353:
+	.byte	0x5
+	.quad	.LBB913
+	.byte	0x4
+	.uleb128 .LBB913-.LBB913
+	.uleb128 .LBE913-.LBB913
+	.byte	0x4
+	.uleb128 .LBB1006-.LBB913
+	.uleb128 .LBE1006-.LBB913
+	.byte	0
+.LLRL356:
+	.byte	0x5
+	.quad	.LBB914
+	.byte	0x4
+	.uleb128 .LBB914-.LBB914
+	.uleb128 .LBE914-.LBB914
+	.byte	0x4
+	.uleb128 .LBB921-.LBB914
+	.uleb128 .LBE921-.LBB914
+	.byte	0
+.LLRL358:
+	.byte	0x5
+	.quad	.LBB917
+	.byte	0x4
+	.uleb128 .LBB917-.LBB917
+	.uleb128 .LBE917-.LBB917
+	.byte	0x4
+	.uleb128 .LBB922-.LBB917
+	.uleb128 .LBE922-.LBB917
+	.byte	0x4
+	.uleb128 .LBB926-.LBB917
+	.uleb128 .LBE926-.LBB917
+	.byte	0
+.LLRL361:
+	.byte	0x5
+	.quad	.LBB923
+	.byte	0x4
+	.uleb128 .LBB923-.LBB923
+	.uleb128 .LBE923-.LBB923
+	.byte	0x4
+	.uleb128 .LBB927-.LBB923
+	.uleb128 .LBE927-.LBB923
+	.byte	0
+.LLRL363:
+	.byte	0x5
+	.quad	.LBB928
+	.byte	0x4
+	.uleb128 .LBB928-.LBB928
+	.uleb128 .LBE928-.LBB928
+	.byte	0x4
+	.uleb128 .LBB1004-.LBB928
+	.uleb128 .LBE1004-.LBB928
+	.byte	0x4
+	.uleb128 .LBB1005-.LBB928
+	.uleb128 .LBE1005-.LBB928
+	.byte	0x4
+	.uleb128 .LBB1007-.LBB928
+	.uleb128 .LBE1007-.LBB928
+	.byte	0x4
+	.uleb128 .LBB1008-.LBB928
+	.uleb128 .LBE1008-.LBB928
+	.byte	0x4
+	.uleb128 .LBB1009-.LBB928
+	.uleb128 .LBE1009-.LBB928
+	.byte	0
+.LLRL402:
+	.byte	0x5
+	.quad	.LBB933
+	.byte	0x4
+	.uleb128 .LBB933-.LBB933
+	.uleb128 .LBE933-.LBB933
+	.byte	0x4
+	.uleb128 .LBB956-.LBB933
+	.uleb128 .LBE956-.LBB933
+	.byte	0x4
+	.uleb128 .LBB996-.LBB933
+	.uleb128 .LBE996-.LBB933
+	.byte	0
+.LLRL406:
+	.byte	0x5
+	.quad	.LBB934
+	.byte	0x4
+	.uleb128 .LBB934-.LBB934
+	.uleb128 .LBE934-.LBB934
+	.byte	0x4
+	.uleb128 .LBB942-.LBB934
+	.uleb128 .LBE942-.LBB934
+	.byte	0x4
+	.uleb128 .LBB944-.LBB934
+	.uleb128 .LBE944-.LBB934
+	.byte	0
+.LLRL408:
+	.byte	0x5
+	.quad	.LBB938
+	.byte	0x4
+	.uleb128 .LBB938-.LBB938
+	.uleb128 .LBE938-.LBB938
+	.byte	0x4
+	.uleb128 .LBB943-.LBB938
+	.uleb128 .LBE943-.LBB938
+	.byte	0x4
+	.uleb128 .LBB945-.LBB938
+	.uleb128 .LBE945-.LBB938
+	.byte	0
+.LLRL412:
+	.byte	0x5
+	.quad	.LBB948
+	.byte	0x4
+	.uleb128 .LBB948-.LBB948
+	.uleb128 .LBE948-.LBB948
+	.byte	0x4
+	.uleb128 .LBB954-.LBB948
+	.uleb128 .LBE954-.LBB948
+	.byte	0
+.LLRL415:
+	.byte	0x5
+	.quad	.LBB951
+	.byte	0x4
+	.uleb128 .LBB951-.LBB951
+	.uleb128 .LBE951-.LBB951
+	.byte	0x4
+	.uleb128 .LBB955-.LBB951
+	.uleb128 .LBE955-.LBB951
+	.byte	0
+.LLRL417:
+	.byte	0x5
+	.quad	.LBB957
+	.byte	0x4
+	.uleb128 .LBB957-.LBB957
+	.uleb128 .LBE957-.LBB957
+	.byte	0x4
+	.uleb128 .LBB995-.LBB957
+	.uleb128 .LBE995-.LBB957
+	.byte	0x4
+	.uleb128 .LBB997-.LBB957
+	.uleb128 .LBE997-.LBB957
+	.byte	0x4
+	.uleb128 .LBB998-.LBB957
+	.uleb128 .LBE998-.LBB957
+	.byte	0
+.LLRL423:
+	.byte	0x5
+	.quad	.LBB959
+	.byte	0x4
+	.uleb128 .LBB959-.LBB959
+	.uleb128 .LBE959-.LBB959
+	.byte	0x4
+	.uleb128 .LBB964-.LBB959
+	.uleb128 .LBE964-.LBB959
+	.byte	0
+.LLRL441:
+	.byte	0x5
+	.quad	.LBB965
+	.byte	0x4
+	.uleb128 .LBB965-.LBB965
+	.uleb128 .LBE965-.LBB965
+	.byte	0x4
+	.uleb128 .LBB988-.LBB965
+	.uleb128 .LBE988-.LBB965
+	.byte	0x4
+	.uleb128 .LBB991-.LBB965
+	.uleb128 .LBE991-.LBB965
+	.byte	0
+.LLRL445:
+	.byte	0x5
+	.quad	.LBB966
+	.byte	0x4
+	.uleb128 .LBB966-.LBB966
+	.uleb128 .LBE966-.LBB966
+	.byte	0x4
+	.uleb128 .LBB974-.LBB966
+	.uleb128 .LBE974-.LBB966
+	.byte	0x4
+	.uleb128 .LBB976-.LBB966
+	.uleb128 .LBE976-.LBB966
+	.byte	0
+.LLRL447:
+	.byte	0x5
+	.quad	.LBB970
+	.byte	0x4
+	.uleb128 .LBB970-.LBB970
+	.uleb128 .LBE970-.LBB970
+	.byte	0x4
+	.uleb128 .LBB975-.LBB970
+	.uleb128 .LBE975-.LBB970
+	.byte	0x4
+	.uleb128 .LBB977-.LBB970
+	.uleb128 .LBE977-.LBB970
+	.byte	0
+.LLRL451:
+	.byte	0x5
+	.quad	.LBB980
+	.byte	0x4
+	.uleb128 .LBB980-.LBB980
+	.uleb128 .LBE980-.LBB980
+	.byte	0x4
+	.uleb128 .LBB986-.LBB980
+	.uleb128 .LBE986-.LBB980
+	.byte	0
+.LLRL454:
+	.byte	0x5
+	.quad	.LBB983
+	.byte	0x4
+	.uleb128 .LBB983-.LBB983
+	.uleb128 .LBE983-.LBB983
+	.byte	0x4
+	.uleb128 .LBB987-.LBB983
+	.uleb128 .LBE987-.LBB983
+	.byte	0
+.LLRL462:
+	.byte	0x5
+	.quad	.LBB1067
+	.byte	0x4
+	.uleb128 .LBB1067-.LBB1067
+	.uleb128 .LBE1067-.LBB1067
+	.byte	0x4
+	.uleb128 .LBB1100-.LBB1067
+	.uleb128 .LBE1100-.LBB1067
+	.byte	0x4
+	.uleb128 .LBB1101-.LBB1067
+	.uleb128 .LBE1101-.LBB1067
+	.byte	0x4
+	.uleb128 .LBB1148-.LBB1067
+	.uleb128 .LBE1148-.LBB1067
+	.byte	0
+.LLRL466:
+	.byte	0x5
+	.quad	.LBB1068
+	.byte	0x4
+	.uleb128 .LBB1068-.LBB1068
+	.uleb128 .LBE1068-.LBB1068
+	.byte	0x4
+	.uleb128 .LBB1083-.LBB1068
+	.uleb128 .LBE1083-.LBB1068
+	.byte	0x4
+	.uleb128 .LBB1085-.LBB1068
+	.uleb128 .LBE1085-.LBB1068
+	.byte	0
+.LLRL468:
+	.byte	0x5
+	.quad	.LBB1072
+	.byte	0x4
+	.uleb128 .LBB1072-.LBB1072
+	.uleb128 .LBE1072-.LBB1072
+	.byte	0x4
+	.uleb128 .LBB1088-.LBB1072
+	.uleb128 .LBE1088-.LBB1072
+	.byte	0
+.LLRL470:
+	.byte	0x5
+	.quad	.LBB1075
+	.byte	0x4
+	.uleb128 .LBB1075-.LBB1075
+	.uleb128 .LBE1075-.LBB1075
+	.byte	0x4
+	.uleb128 .LBB1079-.LBB1075
+	.uleb128 .LBE1079-.LBB1075
+	.byte	0x4
+	.uleb128 .LBB1091-.LBB1075
+	.uleb128 .LBE1091-.LBB1075
+	.byte	0
+.LLRL472:
+	.byte	0x5
+	.quad	.LBB1080
+	.byte	0x4
+	.uleb128 .LBB1080-.LBB1080
+	.uleb128 .LBE1080-.LBB1080
+	.byte	0x4
+	.uleb128 .LBB1084-.LBB1080
+	.uleb128 .LBE1084-.LBB1080
+	.byte	0
+.LLRL478:
+	.byte	0x5
+	.quad	.LBB1092
+	.byte	0x4
+	.uleb128 .LBB1092-.LBB1092
+	.uleb128 .LBE1092-.LBB1092
+	.byte	0x4
+	.uleb128 .LBB1098-.LBB1092
+	.uleb128 .LBE1098-.LBB1092
+	.byte	0
+.LLRL480:
+	.byte	0x5
+	.quad	.LBB1095
+	.byte	0x4
+	.uleb128 .LBB1095-.LBB1095
+	.uleb128 .LBE1095-.LBB1095
+	.byte	0x4
+	.uleb128 .LBB1099-.LBB1095
+	.uleb128 .LBE1099-.LBB1095
+	.byte	0
+.LLRL481:
+	.byte	0x5
+	.quad	.LBB1102
+	.byte	0x4
+	.uleb128 .LBB1102-.LBB1102
+	.uleb128 .LBE1102-.LBB1102
+	.byte	0x4
+	.uleb128 .LBB1147-.LBB1102
+	.uleb128 .LBE1147-.LBB1102
+	.byte	0x4
+	.uleb128 .LBB1149-.LBB1102
+	.uleb128 .LBE1149-.LBB1102
+	.byte	0
+.LLRL485:
+	.byte	0x5
+	.quad	.LBB1104
+	.byte	0x4
+	.uleb128 .LBB1104-.LBB1104
+	.uleb128 .LBE1104-.LBB1104
+	.byte	0x4
+	.uleb128 .LBB1139-.LBB1104
+	.uleb128 .LBE1139-.LBB1104
+	.byte	0x4
+	.uleb128 .LBB1144-.LBB1104
+	.uleb128 .LBE1144-.LBB1104
+	.byte	0
+.LLRL489:
+	.byte	0x5
+	.quad	.LBB1105
+	.byte	0x4
+	.uleb128 .LBB1105-.LBB1105
+	.uleb128 .LBE1105-.LBB1105
+	.byte	0x4
+	.uleb128 .LBB1122-.LBB1105
+	.uleb128 .LBE1122-.LBB1105
+	.byte	0x4
+	.uleb128 .LBB1124-.LBB1105
+	.uleb128 .LBE1124-.LBB1105
+	.byte	0
+.LLRL491:
+	.byte	0x5
+	.quad	.LBB1109
+	.byte	0x4
+	.uleb128 .LBB1109-.LBB1109
+	.uleb128 .LBE1109-.LBB1109
+	.byte	0x4
+	.uleb128 .LBB1127-.LBB1109
+	.uleb128 .LBE1127-.LBB1109
+	.byte	0
+.LLRL493:
+	.byte	0x5
+	.quad	.LBB1112
+	.byte	0x4
+	.uleb128 .LBB1112-.LBB1112
+	.uleb128 .LBE1112-.LBB1112
+	.byte	0x4
+	.uleb128 .LBB1120-.LBB1112
+	.uleb128 .LBE1120-.LBB1112
+	.byte	0x4
+	.uleb128 .LBB1130-.LBB1112
+	.uleb128 .LBE1130-.LBB1112
+	.byte	0
+.LLRL495:
+	.byte	0x5
+	.quad	.LBB1116
+	.byte	0x4
+	.uleb128 .LBB1116-.LBB1116
+	.uleb128 .LBE1116-.LBB1116
+	.byte	0x4
+	.uleb128 .LBB1121-.LBB1116
+	.uleb128 .LBE1121-.LBB1116
+	.byte	0x4
+	.uleb128 .LBB1123-.LBB1116
+	.uleb128 .LBE1123-.LBB1116
+	.byte	0
+.LLRL501:
+	.byte	0x5
+	.quad	.LBB1131
+	.byte	0x4
+	.uleb128 .LBB1131-.LBB1131
+	.uleb128 .LBE1131-.LBB1131
+	.byte	0x4
+	.uleb128 .LBB1137-.LBB1131
+	.uleb128 .LBE1137-.LBB1131
+	.byte	0
+.LLRL503:
+	.byte	0x5
+	.quad	.LBB1134
+	.byte	0x4
+	.uleb128 .LBB1134-.LBB1134
+	.uleb128 .LBE1134-.LBB1134
+	.byte	0x4
+	.uleb128 .LBB1138-.LBB1134
+	.uleb128 .LBE1138-.LBB1134
+	.byte	0
+.LLRL512:
+	.byte	0x5
+	.quad	.LBB1201
+	.byte	0x4
+	.uleb128 .LBB1201-.LBB1201
+	.uleb128 .LBE1201-.LBB1201
+	.byte	0x4
+	.uleb128 .LBB1224-.LBB1201
+	.uleb128 .LBE1224-.LBB1201
+	.byte	0x4
+	.uleb128 .LBB1225-.LBB1201
+	.uleb128 .LBE1225-.LBB1201
+	.byte	0x4
+	.uleb128 .LBB1321-.LBB1201
+	.uleb128 .LBE1321-.LBB1201
+	.byte	0
+.LLRL515:
+	.byte	0x5
+	.quad	.LBB1202
+	.byte	0x4
+	.uleb128 .LBB1202-.LBB1202
+	.uleb128 .LBE1202-.LBB1202
+	.byte	0x4
+	.uleb128 .LBB1218-.LBB1202
+	.uleb128 .LBE1218-.LBB1202
+	.byte	0x4
+	.uleb128 .LBB1220-.LBB1202
+	.uleb128 .LBE1220-.LBB1202
+	.byte	0
+.LLRL517:
+	.byte	0x5
+	.quad	.LBB1206
+	.byte	0x4
+	.uleb128 .LBB1206-.LBB1206
+	.uleb128 .LBE1206-.LBB1206
+	.byte	0x4
+	.uleb128 .LBB1221-.LBB1206
+	.uleb128 .LBE1221-.LBB1206
+	.byte	0
+.LLRL519:
+	.byte	0x5
+	.quad	.LBB1209
+	.byte	0x4
+	.uleb128 .LBB1209-.LBB1209
+	.uleb128 .LBE1209-.LBB1209
+	.byte	0x4
+	.uleb128 .LBB1214-.LBB1209
+	.uleb128 .LBE1214-.LBB1209
+	.byte	0x4
+	.uleb128 .LBB1222-.LBB1209
+	.uleb128 .LBE1222-.LBB1209
+	.byte	0x4
+	.uleb128 .LBB1223-.LBB1209
+	.uleb128 .LBE1223-.LBB1209
+	.byte	0
+.LLRL521:
+	.byte	0x5
+	.quad	.LBB1215
+	.byte	0x4
+	.uleb128 .LBB1215-.LBB1215
+	.uleb128 .LBE1215-.LBB1215
+	.byte	0x4
+	.uleb128 .LBB1219-.LBB1215
+	.uleb128 .LBE1219-.LBB1215
+	.byte	0
+.LLRL523:
+	.byte	0x5
+	.quad	.LBB1226
+	.byte	0x4
+	.uleb128 .LBB1226-.LBB1226
+	.uleb128 .LBE1226-.LBB1226
+	.byte	0x4
+	.uleb128 .LBB1320-.LBB1226
+	.uleb128 .LBE1320-.LBB1226
+	.byte	0x4
+	.uleb128 .LBB1322-.LBB1226
+	.uleb128 .LBE1322-.LBB1226
+	.byte	0x4
+	.uleb128 .LBB1323-.LBB1226
+	.uleb128 .LBE1323-.LBB1226
+	.byte	0
+.LLRL527:
+	.byte	0x5
+	.quad	.LBB1228
+	.byte	0x4
+	.uleb128 .LBB1228-.LBB1228
+	.uleb128 .LBE1228-.LBB1228
+	.byte	0x4
+	.uleb128 .LBB1263-.LBB1228
+	.uleb128 .LBE1263-.LBB1228
+	.byte	0x4
+	.uleb128 .LBB1315-.LBB1228
+	.uleb128 .LBE1315-.LBB1228
+	.byte	0
+.LLRL531:
+	.byte	0x5
+	.quad	.LBB1229
+	.byte	0x4
+	.uleb128 .LBB1229-.LBB1229
+	.uleb128 .LBE1229-.LBB1229
+	.byte	0x4
+	.uleb128 .LBB1246-.LBB1229
+	.uleb128 .LBE1246-.LBB1229
+	.byte	0x4
+	.uleb128 .LBB1248-.LBB1229
+	.uleb128 .LBE1248-.LBB1229
+	.byte	0
+.LLRL533:
+	.byte	0x5
+	.quad	.LBB1233
+	.byte	0x4
+	.uleb128 .LBB1233-.LBB1233
+	.uleb128 .LBE1233-.LBB1233
+	.byte	0x4
+	.uleb128 .LBB1251-.LBB1233
+	.uleb128 .LBE1251-.LBB1233
+	.byte	0
+.LLRL535:
+	.byte	0x5
+	.quad	.LBB1236
+	.byte	0x4
+	.uleb128 .LBB1236-.LBB1236
+	.uleb128 .LBE1236-.LBB1236
+	.byte	0x4
+	.uleb128 .LBB1244-.LBB1236
+	.uleb128 .LBE1244-.LBB1236
+	.byte	0x4
+	.uleb128 .LBB1254-.LBB1236
+	.uleb128 .LBE1254-.LBB1236
+	.byte	0
+.LLRL537:
+	.byte	0x5
+	.quad	.LBB1240
+	.byte	0x4
+	.uleb128 .LBB1240-.LBB1240
+	.uleb128 .LBE1240-.LBB1240
+	.byte	0x4
+	.uleb128 .LBB1245-.LBB1240
+	.uleb128 .LBE1245-.LBB1240
+	.byte	0x4
+	.uleb128 .LBB1247-.LBB1240
+	.uleb128 .LBE1247-.LBB1240
+	.byte	0
+.LLRL543:
+	.byte	0x5
+	.quad	.LBB1255
+	.byte	0x4
+	.uleb128 .LBB1255-.LBB1255
+	.uleb128 .LBE1255-.LBB1255
+	.byte	0x4
+	.uleb128 .LBB1261-.LBB1255
+	.uleb128 .LBE1261-.LBB1255
+	.byte	0
+.LLRL545:
+	.byte	0x5
+	.quad	.LBB1258
+	.byte	0x4
+	.uleb128 .LBB1258-.LBB1258
+	.uleb128 .LBE1258-.LBB1258
+	.byte	0x4
+	.uleb128 .LBB1262-.LBB1258
+	.uleb128 .LBE1262-.LBB1258
+	.byte	0
+.LLRL546:
+	.byte	0x5
+	.quad	.LBB1264
+	.byte	0x4
+	.uleb128 .LBB1264-.LBB1264
+	.uleb128 .LBE1264-.LBB1264
+	.byte	0x4
+	.uleb128 .LBB1313-.LBB1264
+	.uleb128 .LBE1313-.LBB1264
+	.byte	0x4
+	.uleb128 .LBB1314-.LBB1264
+	.uleb128 .LBE1314-.LBB1264
+	.byte	0x4
+	.uleb128 .LBB1316-.LBB1264
+	.uleb128 .LBE1316-.LBB1264
+	.byte	0
+.LLRL550:
+	.byte	0x5
+	.quad	.LBB1266
+	.byte	0x4
+	.uleb128 .LBB1266-.LBB1266
+	.uleb128 .LBE1266-.LBB1266
+	.byte	0x4
+	.uleb128 .LBB1303-.LBB1266
+	.uleb128 .LBE1303-.LBB1266
+	.byte	0x4
+	.uleb128 .LBB1304-.LBB1266
+	.uleb128 .LBE1304-.LBB1266
+	.byte	0x4
+	.uleb128 .LBB1309-.LBB1266
+	.uleb128 .LBE1309-.LBB1266
+	.byte	0
+.LLRL554:
+	.byte	0x5
+	.quad	.LBB1267
+	.byte	0x4
+	.uleb128 .LBB1267-.LBB1267
+	.uleb128 .LBE1267-.LBB1267
+	.byte	0x4
+	.uleb128 .LBB1286-.LBB1267
+	.uleb128 .LBE1286-.LBB1267
+	.byte	0x4
+	.uleb128 .LBB1288-.LBB1267
+	.uleb128 .LBE1288-.LBB1267
+	.byte	0
+.LLRL556:
+	.byte	0x5
+	.quad	.LBB1271
+	.byte	0x4
+	.uleb128 .LBB1271-.LBB1271
+	.uleb128 .LBE1271-.LBB1271
+	.byte	0x4
+	.uleb128 .LBB1275-.LBB1271
+	.uleb128 .LBE1275-.LBB1271
+	.byte	0x4
+	.uleb128 .LBB1291-.LBB1271
+	.uleb128 .LBE1291-.LBB1271
+	.byte	0
+.LLRL558:
+	.byte	0x5
+	.quad	.LBB1276
+	.byte	0x4
+	.uleb128 .LBB1276-.LBB1276
+	.uleb128 .LBE1276-.LBB1276
+	.byte	0x4
+	.uleb128 .LBB1284-.LBB1276
+	.uleb128 .LBE1284-.LBB1276
+	.byte	0x4
+	.uleb128 .LBB1294-.LBB1276
+	.uleb128 .LBE1294-.LBB1276
+	.byte	0
+.LLRL560:
+	.byte	0x5
+	.quad	.LBB1280
+	.byte	0x4
+	.uleb128 .LBB1280-.LBB1280
+	.uleb128 .LBE1280-.LBB1280
+	.byte	0x4
+	.uleb128 .LBB1285-.LBB1280
+	.uleb128 .LBE1285-.LBB1280
+	.byte	0x4
+	.uleb128 .LBB1287-.LBB1280
+	.uleb128 .LBE1287-.LBB1280
+	.byte	0
+.LLRL566:
+	.byte	0x5
+	.quad	.LBB1295
+	.byte	0x4
+	.uleb128 .LBB1295-.LBB1295
+	.uleb128 .LBE1295-.LBB1295
+	.byte	0x4
+	.uleb128 .LBB1301-.LBB1295
+	.uleb128 .LBE1301-.LBB1295
+	.byte	0
+.LLRL568:
+	.byte	0x5
+	.quad	.LBB1298
+	.byte	0x4
+	.uleb128 .LBB1298-.LBB1298
+	.uleb128 .LBE1298-.LBB1298
+	.byte	0x4
+	.uleb128 .LBB1302-.LBB1298
+	.uleb128 .LBE1302-.LBB1298
+	.byte	0
+.LLRL591:
+	.byte	0x5
+	.quad	.LBB1332
+	.byte	0x4
+	.uleb128 .LBB1332-.LBB1332
+	.uleb128 .LBE1332-.LBB1332
+	.byte	0x4
+	.uleb128 .LBB1333-.LBB1332
+	.uleb128 .LBE1333-.LBB1332
+	.byte	0
+.LLRL594:
+	.byte	0x5
+	.quad	.LBB1334
+	.byte	0x4
+	.uleb128 .LBB1334-.LBB1334
+	.uleb128 .LBE1334-.LBB1334
+	.byte	0x4
+	.uleb128 .LBB1339-.LBB1334
+	.uleb128 .LBE1339-.LBB1334
+	.byte	0x4
+	.uleb128 .LBB1340-.LBB1334
+	.uleb128 .LBE1340-.LBB1334
+	.byte	0x4
+	.uleb128 .LBB1341-.LBB1334
+	.uleb128 .LBE1341-.LBB1334
+	.byte	0
+.LLRL597:
+	.byte	0x7
+	.quad	.Ltext0
+	.uleb128 .Letext0-.Ltext0
+	.byte	0x7
+	.quad	.LFB6426
+	.uleb128 .LFE6426-.LFB6426
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF54:
+	.string	"st_scan_avx2_kernels"
+.LASF147:
+	.string	"_mm_cmpeq_epi8"
+.LASF71:
+	.string	"st_scan_isa_supported"
+.LASF64:
+	.string	"st_scan_escape"
+.LASF9:
+	.string	"size_t"
+.LASF24:
+	.string	"ST_SCAN_SCALAR"
+.LASF65:
+	.string	"string"
+.LASF10:
+	.string	"__uint8_t"
+.LASF101:
+	.string	"_mm512_set1_epi8"
+.LASF156:
+	.string	"classes"
+.LASF90:
+	.string	"st_scan_nul_sse2"
+.LASF85:
+	.string	"st_scan_escape_avx2"
+.LASF110:
+	.string	"__q30"
+.LASF109:
+	.string	"__q31"
+.LASF80:
+	.string	"st_scan_non_whitespace_avx512"
+.LASF99:
+	.string	"_mm512_cmpeq_epi8_mask"
+.LASF160:
+	.string	"__cpu_indicator_init"
+.LASF149:
+	.string	"_mm_setzero_si128"
+.LASF39:
+	.string	"__m128i_u"
+.LASF81:
+	.string	"limit"
+.LASF87:
+	.string	"st_scan_non_whitespace_avx2"
+.LASF57:
+	.string	"st_scan_current_isa"
+.LASF89:
+	.string	"st_scan_escape_sse2"
+.LASF153:
+	.string	"st_char_class_has"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF13:
+	.string	"long long unsigned int"
+.LASF46:
+	.string	"StringCharClass"
+.LASF69:
+	.string	"delim"
+.LASF88:
+	.string	"st_scan_delimiter_avx2"
+.LASF3:
+	.string	"long int"
+.LASF52:
+	.string	"st_scan_scalar_kernels"
+.LASF77:
+	.string	"st_scan_escape_avx512"
+.LASF91:
+	.string	"st_scan_non_whitespace_sse2"
+.LASF53:
+	.string	"st_scan_sse2_kernels"
+.LASF142:
+	.string	"_mm256_setzero_si256"
+.LASF63:
+	.string	"st_scan_class"
+.LASF44:
+	.string	"__mmask64"
+.LASF29:
+	.string	"double"
+.LASF92:
+	.string	"st_scan_delimiter_sse2"
+.LASF145:
+	.string	"_mm_min_epu8"
+.LASF33:
+	.string	"__v16qi"
+.LASF146:
+	.string	"_mm_max_epu8"
+.LASF107:
+	.string	"_mm256_set1_epi8"
+.LASF22:
+	.string	"StringCharClassBits"
+.LASF62:
+	.string	"mask"
+.LASF93:
+	.string	"st_scan_escape_scalar"
+.LASF86:
+	.string	"st_scan_nul_avx2"
+.LASF42:
+	.string	"__v64qi"
+.LASF100:
+	.string	"_mm512_loadu_si512"
+.LASF73:
+	.string	"backslashes"
+.LASF7:
+	.string	"unsigned int"
+.LASF2:
+	.string	"long unsigned int"
+.LASF82:
+	.string	"st_scan_delimiter_avx512"
+.LASF6:
+	.string	"short unsigned int"
+.LASF158:
+	.string	"st_scan_init"
+.LASF32:
+	.string	"__v4si"
+.LASF47:
+	.string	"StringScanKernels"
+.LASF60:
+	.string	"st_char_classes"
+.LASF159:
+	.string	"st_scan_isa"
+.LASF17:
+	.string	"ST_CLASS_NUMERIC"
+.LASF35:
+	.string	"__v4di"
+.LASF27:
+	.string	"ST_SCAN_AVX512"
+.LASF152:
+	.string	"_mm_set_epi8"
+.LASF11:
+	.string	"short int"
+.LASF36:
+	.string	"__v4du"
+.LASF96:
+	.string	"st_scan_delimiter_scalar"
+.LASF94:
+	.string	"st_scan_nul_scalar"
+.LASF140:
+	.string	"__q00"
+.LASF98:
+	.string	"_mm512_cmplt_epu8_mask"
+.LASF34:
+	.string	"__m128i"
+.LASF43:
+	.string	"__m512i_u"
+.LASF155:
+	.string	"st_char_is"
+.LASF26:
+	.string	"ST_SCAN_AVX2"
+.LASF79:
+	.string	"zeros"
+.LASF59:
+	.string	"char_class"
+.LASF56:
+	.string	"st_scan_kernels"
+.LASF105:
+	.string	"_mm256_max_epu8"
+.LASF55:
+	.string	"st_scan_avx512_kernels"
+.LASF103:
+	.string	"_mm256_movemask_epi8"
+.LASF25:
+	.string	"ST_SCAN_SSE2"
+.LASF30:
+	.string	"float"
+.LASF154:
+	.string	"token"
+.LASF72:
+	.string	"quotes"
+.LASF37:
+	.string	"__v32qi"
+.LASF150:
+	.string	"_mm_loadu_si128"
+.LASF106:
+	.string	"_mm256_cmpeq_epi8"
+.LASF157:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF5:
+	.string	"unsigned char"
+.LASF84:
+	.string	"matches"
+.LASF144:
+	.string	"_mm_movemask_epi8"
+.LASF78:
+	.string	"st_scan_nul_avx512"
+.LASF141:
+	.string	"_mm512_setzero_si512"
+.LASF67:
+	.string	"st_scan_non_whitespace"
+.LASF139:
+	.string	"__q01"
+.LASF138:
+	.string	"__q02"
+.LASF137:
+	.string	"__q03"
+.LASF136:
+	.string	"__q04"
+.LASF135:
+	.string	"__q05"
+.LASF134:
+	.string	"__q06"
+.LASF133:
+	.string	"__q07"
+.LASF132:
+	.string	"__q08"
+.LASF131:
+	.string	"__q09"
+.LASF41:
+	.string	"__v8di"
+.LASF97:
+	.string	"_mm512_cmpge_epu8_mask"
+.LASF19:
+	.string	"ST_CLASS_STRUCTURAL"
+.LASF130:
+	.string	"__q10"
+.LASF74:
+	.string	"controls"
+.LASF108:
+	.string	"_mm256_set_epi8"
+.LASF70:
+	.string	"st_scan_set_isa"
+.LASF151:
+	.string	"_mm_set1_epi8"
+.LASF28:
+	.string	"long double"
+.LASF75:
+	.string	"chunk"
+.LASF102:
+	.string	"_mm256_or_si256"
+.LASF12:
+	.string	"char"
+.LASF76:
+	.string	"__m512i"
+.LASF21:
+	.string	"ST_CLASS_ALPHA"
+.LASF61:
+	.string	"index"
+.LASF16:
+	.string	"ST_CLASS_DIGIT"
+.LASF66:
+	.string	"st_scan_nul"
+.LASF23:
+	.string	"StringScanIsa"
+.LASF31:
+	.string	"__v2du"
+.LASF129:
+	.string	"__q11"
+.LASF128:
+	.string	"__q12"
+.LASF127:
+	.string	"__q13"
+.LASF126:
+	.string	"__q14"
+.LASF125:
+	.string	"__q15"
+.LASF124:
+	.string	"__q16"
+.LASF123:
+	.string	"__q17"
+.LASF122:
+	.string	"__q18"
+.LASF121:
+	.string	"__q19"
+.LASF68:
+	.string	"st_scan_delimiter"
+.LASF83:
+	.string	"delims"
+.LASF58:
+	.string	"length"
+.LASF20:
+	.string	"ST_CLASS_ESCAPE"
+.LASF15:
+	.string	"ST_CLASS_WHITESPACE"
+.LASF104:
+	.string	"_mm256_min_epu8"
+.LASF51:
+	.string	"escape"
+.LASF95:
+	.string	"st_scan_non_whitespace_scalar"
+.LASF49:
+	.string	"delimiter"
+.LASF18:
+	.string	"ST_CLASS_HEX"
+.LASF48:
+	.string	"members"
+.LASF14:
+	.string	"uint8_t"
+.LASF38:
+	.string	"__m256i"
+.LASF143:
+	.string	"_mm256_loadu_si256"
+.LASF40:
+	.string	"__m256i_u"
+.LASF120:
+	.string	"__q20"
+.LASF119:
+	.string	"__q21"
+.LASF148:
+	.string	"_mm_or_si128"
+.LASF117:
+	.string	"__q23"
+.LASF116:
+	.string	"__q24"
+.LASF115:
+	.string	"__q25"
+.LASF114:
+	.string	"__q26"
+.LASF113:
+	.string	"__q27"
+.LASF112:
+	.string	"__q28"
+.LASF111:
+	.string	"__q29"
+.LASF50:
+	.string	"non_whitespace"
+.LASF45:
+	.string	"_Float16"
+.LASF118:
+	.string	"__q22"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test"
+.LASF0:
+	.string	"/root/repo/src/string_scan.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3431 @@
+	.file	"string_scan_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/tests/string_scan_unit_tests.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"scalar"
+.LC2:
+	.string	"SSE2"
+.LC3:
+	.string	"AVX2"
+.LC4:
+	.string	"AVX-512"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC5:
+	.string	"------------------- st_scan_*(x) -------------------"
+	.align 8
+.LC6:
+	.string	"[Skipped] %s kernels are not supported by this CPU.\n"
+	.align 8
+.LC9:
+	.string	"[Failed] %s kernels failed: wrong index found.\n"
+	.align 8
+.LC10:
+	.string	"[Passed] %s kernels found every character.\n"
+	.text
+	.p2align 4
+	.globl	run_st_scan_kernels_unit_tests
+	.type	run_st_scan_kernels_unit_tests, @function
+run_st_scan_kernels_unit_tests:
+.LFB27:
+	.file 1 "/root/repo/tests/string_scan_unit_tests.c"
+	.loc 1 56 38 view -0
+	.cfi_startproc
+	.loc 1 58 3 view .LVU1
+	.loc 1 56 38 is_stmt 0 view .LVU2
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 59 15 view .LVU3
+	leaq	.LC3(%rip), %rcx
+	leaq	.LC4(%rip), %rax
+	.loc 1 56 38 view .LVU4
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 59 15 view .LVU5
+	vmovq	%rcx, %xmm1
+	leaq	.LC1(%rip), %rcx
+	.loc 1 56 38 view .LVU6
+	pushq	%r14
+	.loc 1 59 15 view .LVU7
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	leaq	.LC2(%rip), %rax
+	.loc 1 56 38 view .LVU8
+	pushq	%r13
+	.loc 1 63 3 view .LVU9
+	leaq	.LC5(%rip), %rdi
+	.loc 1 56 38 view .LVU10
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$448, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 58 22 view .LVU11
+	vmovdqa	.LC0(%rip), %xmm0
+	leaq	192(%rsp), %r15
+	vmovdqa	%xmm0, 176(%rsp)
+	.loc 1 59 3 is_stmt 1 view .LVU12
+	.loc 1 59 15 is_stmt 0 view .LVU13
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	vmovdqa	%ymm0, 192(%rsp)
+	.loc 1 61 3 is_stmt 1 view .LVU14
+.LVL0:
+	.loc 1 63 3 view .LVU15
+	vzeroupper
+.LVL1:
+	call	puts@PLT
+.LVL2:
+	.loc 1 65 3 view .LVU16
+	.loc 1 66 3 view .LVU17
+	.loc 1 66 37 is_stmt 0 view .LVU18
+	xorl	%eax, %eax
+	call	st_scan_isa@PLT
+.LVL3:
+	movl	%eax, 160(%rsp)
+.LVL4:
+	.loc 1 67 3 is_stmt 1 view .LVU19
+	.loc 1 68 3 view .LVU20
+.LBB7:
+	.loc 1 68 8 view .LVU21
+	.loc 1 68 21 view .LVU22
+	leaq	176(%rsp), %rax
+.LVL5:
+	.loc 1 68 21 is_stmt 0 view .LVU23
+	movq	%rax, 168(%rsp)
+.LBE7:
+	.loc 1 65 7 view .LVU24
+	movl	$0, 164(%rsp)
+.LBB17:
+.LBB8:
+.LBB9:
+	.loc 1 45 5 view .LVU25
+	movl	$10, %eax
+	vpbroadcastb	%eax, %zmm3
+.LBE9:
+.LBE8:
+.LBE17:
+	.loc 1 66 37 view .LVU26
+	xorl	%r14d, %r14d
+.LBB18:
+.LBB14:
+.LBB11:
+	.loc 1 45 5 view .LVU27
+	vmovdqa64	%zmm3, (%rsp)
+	vzeroupper
+.LVL6:
+.L8:
+	.loc 1 45 5 view .LVU28
+.LBE11:
+.LBE14:
+	.loc 1 69 5 is_stmt 1 view .LVU29
+	.loc 1 69 9 is_stmt 0 view .LVU30
+	movq	168(%rsp), %rax
+.LBB15:
+.LBB12:
+	.loc 1 18 15 view .LVU31
+	xorl	%r13d, %r13d
+.LBE12:
+.LBE15:
+	.loc 1 69 9 view .LVU32
+	movl	(%rax,%r14,4), %edi
+	leaq	240(%rsp), %rbx
+	call	st_scan_set_isa@PLT
+.LVL7:
+	.loc 1 69 8 view .LVU33
+	testl	%eax, %eax
+	je	.L17
+.L2:
+.LBB16:
+.LBB13:
+	.loc 1 45 5 is_stmt 1 view .LVU34
+	movabsq	$723401728380766730, %rax
+	vmovdqa64	(%rsp), %zmm4
+	movq	%rax, 192(%rbx)
+	.loc 1 46 5 view .LVU35
+	.loc 1 45 5 is_stmt 0 view .LVU36
+	vmovdqu8	%zmm4, (%rbx)
+	vmovdqu8	%zmm4, 64(%rbx)
+	vmovdqu8	%zmm4, 128(%rbx)
+	.loc 1 46 9 view .LVU37
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	vzeroupper
+.LVL8:
+	call	st_scan_non_whitespace@PLT
+.LVL9:
+	.loc 1 46 8 view .LVU38
+	cmpq	%rax, %r13
+	jne	.L4
+	.loc 1 46 61 view .LVU39
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	st_scan_nul@PLT
+.LVL10:
+	.loc 1 46 58 view .LVU40
+	cmpq	%rax, %r13
+	jne	.L4
+	.loc 1 18 49 is_stmt 1 view .LVU41
+	addq	$7, %r13
+.LVL11:
+	.loc 1 18 34 view .LVU42
+	cmpq	$203, %r13
+	je	.L18
+.LBB10:
+	.loc 1 21 7 is_stmt 0 view .LVU43
+	movl	$32, %eax
+	vpbroadcastb	%eax, %zmm5
+	.loc 1 19 17 view .LVU44
+	xorl	%r12d, %r12d
+	.loc 1 21 7 view .LVU45
+	vmovdqa64	%zmm5, 64(%rsp)
+	jmp	.L5
+.LVL12:
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.loc 1 23 63 view .LVU46
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	st_scan_non_whitespace@PLT
+.LVL13:
+	.loc 1 23 60 view .LVU47
+	cmpq	%r12, %rax
+	jne	.L4
+	.loc 1 26 7 is_stmt 1 view .LVU48
+	.loc 1 27 11 is_stmt 0 view .LVU49
+	movl	$34, %edx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	.loc 1 26 22 view .LVU50
+	movb	$0, (%rbx,%r12)
+	.loc 1 27 7 is_stmt 1 view .LVU51
+	.loc 1 27 11 is_stmt 0 view .LVU52
+	call	st_scan_delimiter@PLT
+.LVL14:
+	.loc 1 27 10 view .LVU53
+	cmpq	%r12, %rax
+	jne	.L4
+	.loc 1 27 63 view .LVU54
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	st_scan_nul@PLT
+.LVL15:
+	.loc 1 27 60 view .LVU55
+	cmpq	%r12, %rax
+	jne	.L4
+	.loc 1 30 7 is_stmt 1 view .LVU56
+	.loc 1 31 11 is_stmt 0 view .LVU57
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	.loc 1 30 22 view .LVU58
+	movb	$92, (%rbx,%r12)
+	.loc 1 31 7 is_stmt 1 view .LVU59
+	.loc 1 31 11 is_stmt 0 view .LVU60
+	call	st_scan_escape@PLT
+.LVL16:
+	.loc 1 31 10 view .LVU61
+	cmpq	%r12, %rax
+	jne	.L4
+	.loc 1 34 7 is_stmt 1 view .LVU62
+	.loc 1 35 11 is_stmt 0 view .LVU63
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	.loc 1 34 22 view .LVU64
+	movb	$31, (%rbx,%r12)
+	.loc 1 35 7 is_stmt 1 view .LVU65
+	.loc 1 35 11 is_stmt 0 view .LVU66
+	call	st_scan_escape@PLT
+.LVL17:
+	.loc 1 35 10 view .LVU67
+	cmpq	%r12, %rax
+	jne	.L4
+	.loc 1 39 7 is_stmt 1 view .LVU68
+	.loc 1 40 11 is_stmt 0 view .LVU69
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	.loc 1 39 22 view .LVU70
+	movb	$-61, (%rbx,%r12)
+	.loc 1 40 7 is_stmt 1 view .LVU71
+	.loc 1 40 11 is_stmt 0 view .LVU72
+	call	st_scan_non_whitespace@PLT
+.LVL18:
+	.loc 1 40 10 view .LVU73
+	cmpq	%r12, %rax
+	jne	.L4
+	.loc 1 40 63 view .LVU74
+	movl	$34, %edx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	st_scan_delimiter@PLT
+.LVL19:
+	.loc 1 40 60 view .LVU75
+	cmpq	%r13, %rax
+	jne	.L4
+	.loc 1 40 115 view .LVU76
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	st_scan_escape@PLT
+.LVL20:
+	.loc 1 40 112 view .LVU77
+	cmpq	%r13, %rax
+	jne	.L4
+	.loc 1 19 52 is_stmt 1 view .LVU78
+	incq	%r12
+.LVL21:
+	.loc 1 19 36 view .LVU79
+	cmpq	%r13, %r12
+	je	.L2
+.LVL22:
+.L5:
+	.loc 1 21 7 view .LVU80
+	vmovdqa64	64(%rsp), %zmm2
+	movabsq	$2314885530818453536, %rax
+	movq	%rax, 192(%rbx)
+	.loc 1 22 7 view .LVU81
+	.loc 1 21 7 is_stmt 0 view .LVU82
+	vmovdqu8	%zmm2, (%rbx)
+	vmovdqu8	%zmm2, 64(%rbx)
+	vmovdqu8	%zmm2, 128(%rbx)
+	.loc 1 22 22 view .LVU83
+	movb	$34, (%rbx,%r12)
+	.loc 1 23 7 is_stmt 1 view .LVU84
+	.loc 1 23 11 is_stmt 0 view .LVU85
+	movl	$34, %edx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	vzeroupper
+.LVL23:
+	call	st_scan_delimiter@PLT
+.LVL24:
+	.loc 1 23 10 view .LVU86
+	cmpq	%r12, %rax
+	je	.L19
+.LVL25:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 1 23 10 view .LVU87
+.LBE10:
+.LBE13:
+.LBE16:
+	.loc 1 74 7 is_stmt 1 view .LVU88
+	movq	(%r15,%r14,8), %rsi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL26:
+	.loc 1 75 7 view .LVU89
+	.loc 1 76 7 view .LVU90
+	.loc 1 75 19 is_stmt 0 view .LVU91
+	movl	$1, 164(%rsp)
+.LVL27:
+.L7:
+	.loc 1 68 35 is_stmt 1 discriminator 2 view .LVU92
+	.loc 1 68 21 discriminator 2 view .LVU93
+	incq	%r14
+.LVL28:
+	.loc 1 68 21 is_stmt 0 discriminator 2 view .LVU94
+	cmpq	$4, %r14
+	jne	.L8
+.LBE18:
+	.loc 1 81 3 is_stmt 1 view .LVU95
+	movl	160(%rsp), %edi
+	call	st_scan_set_isa@PLT
+.LVL29:
+	.loc 1 82 3 view .LVU96
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL30:
+	.loc 1 84 3 view .LVU97
+	.loc 1 85 1 is_stmt 0 view .LVU98
+	movl	164(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL31:
+	.loc 1 85 1 view .LVU99
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+.LVL32:
+	.loc 1 85 1 view .LVU100
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL33:
+	.loc 1 85 1 view .LVU101
+	ret
+.LVL34:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.cfi_restore_state
+.LBB19:
+	.loc 1 70 7 is_stmt 1 discriminator 1 view .LVU102
+	movq	(%r15,%r14,8), %rsi
+	leaq	.LC6(%rip), %rdi
+	call	printf@PLT
+.LVL35:
+	.loc 1 71 7 discriminator 1 view .LVU103
+	jmp	.L7
+.LVL36:
+.L18:
+	.loc 1 79 5 view .LVU104
+	movq	(%r15,%r14,8), %rsi
+	leaq	.LC10(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL37:
+	jmp	.L7
+.LBE19:
+	.cfi_endproc
+.LFE27:
+	.size	run_st_scan_kernels_unit_tests, .-run_st_scan_kernels_unit_tests
+	.section	.rodata.str1.1
+.LC11:
+	.string	"ab"
+.LC12:
+	.string	"{ \"a\""
+.LC13:
+	.string	"[\n\t  1,2]"
+.LC14:
+	.string	"x     "
+.LC15:
+	.string	"{\"a\""
+.LC16:
+	.string	"[1,2]"
+.LC17:
+	.string	"x"
+	.section	.rodata.str1.8
+	.align 8
+.LC18:
+	.string	"------------------- st_next_token(x) -------------------"
+	.align 8
+.LC19:
+	.string	"[Failed] st_next_token() failed: expected '%s', got '%s'.\n"
+	.align 8
+.LC20:
+	.string	"[Passed] st_next_token() visited '%s'.\n"
+	.text
+	.p2align 4
+	.globl	run_st_next_token_unit_tests
+	.type	run_st_next_token_unit_tests, @function
+run_st_next_token_unit_tests:
+.LFB28:
+	.loc 1 90 36 view -0
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 92 15 is_stmt 0 view .LVU106
+	leaq	.LC14(%rip), %rcx
+	vmovq	%rcx, %xmm1
+	.loc 1 90 36 view .LVU107
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 92 15 view .LVU108
+	leaq	.LC12(%rip), %rcx
+	leaq	.LC11(%rip), %rax
+	.loc 1 92 3 is_stmt 1 view .LVU109
+	.loc 1 90 36 is_stmt 0 view .LVU110
+	pushq	%r14
+	.loc 1 92 15 view .LVU111
+	leaq	.LC13(%rip), %rdx
+	vmovq	%rcx, %xmm0
+	.loc 1 90 36 view .LVU112
+	pushq	%r13
+	.loc 1 92 15 view .LVU113
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vpinsrq	$1, %rdx, %xmm0, %xmm0
+	.loc 1 90 36 view .LVU114
+	pushq	%r12
+	.loc 1 93 15 view .LVU115
+	leaq	.LC17(%rip), %rcx
+	.loc 1 92 15 view .LVU116
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	.loc 1 90 36 view .LVU117
+	pushq	%rbx
+	.loc 1 93 15 view .LVU118
+	vmovq	%rcx, %xmm1
+	leaq	.LC15(%rip), %rdx
+	.loc 1 90 36 view .LVU119
+	andq	$-32, %rsp
+	subq	$224, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 93 15 view .LVU120
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	.loc 1 92 15 view .LVU121
+	vmovdqa	%ymm0, 32(%rsp)
+	.loc 1 93 3 is_stmt 1 view .LVU122
+	.loc 1 93 15 is_stmt 0 view .LVU123
+	leaq	.LC16(%rip), %rax
+	vmovq	%rdx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	vmovdqa	%ymm0, 64(%rsp)
+	.loc 1 95 3 is_stmt 1 view .LVU124
+.LVL38:
+	.loc 1 97 3 view .LVU125
+	leaq	.LC18(%rip), %rdi
+	vzeroupper
+.LVL39:
+	call	puts@PLT
+.LVL40:
+	.loc 1 99 3 view .LVU126
+	.loc 1 100 3 view .LVU127
+.LBB20:
+	.loc 1 100 8 view .LVU128
+	.loc 1 100 21 view .LVU129
+	leaq	96(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	leaq	64(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	leaq	160(%rsp), %rax
+.LBE20:
+	.loc 1 99 7 is_stmt 0 view .LVU130
+	movl	$0, 4(%rsp)
+	movq	%rax, 24(%rsp)
+	.loc 1 97 3 view .LVU131
+	xorl	%r14d, %r14d
+	leaq	32(%rsp), %r15
+.LBB23:
+.LBB21:
+	.loc 1 107 23 view .LVU132
+	leaq	159(%rsp), %r13
+.LVL41:
+.L26:
+	.loc 1 101 5 is_stmt 1 view .LVU133
+	.loc 1 102 5 view .LVU134
+	movq	8(%rsp), %rbx
+	movq	(%r15,%r14), %rsi
+	movq	%rbx, %rdi
+	call	strcpy@PLT
+.LVL42:
+	.loc 1 103 5 view .LVU135
+	.loc 1 103 41 is_stmt 0 view .LVU136
+	movq	%rbx, %rdi
+	call	st_create@PLT
+.LVL43:
+	movq	%rax, %rbx
+.LVL44:
+	.loc 1 104 5 is_stmt 1 view .LVU137
+	.loc 1 105 5 view .LVU138
+	.loc 1 106 5 view .LVU139
+	.loc 1 105 12 is_stmt 0 view .LVU140
+	xorl	%r12d, %r12d
+	.loc 1 106 11 view .LVU141
+	jmp	.L21
+.LVL45:
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.loc 1 107 7 is_stmt 1 view .LVU142
+	.loc 1 107 25 is_stmt 0 view .LVU143
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL46:
+	.loc 1 107 19 view .LVU144
+	incq	%r12
+.LVL47:
+	.loc 1 108 7 view .LVU145
+	movq	%rbx, %rdi
+	.loc 1 107 23 view .LVU146
+	movb	%al, 0(%r13,%r12)
+	.loc 1 108 7 is_stmt 1 view .LVU147
+	call	st_next_token@PLT
+.LVL48:
+.L21:
+	.loc 1 106 40 view .LVU148
+	.loc 1 106 12 is_stmt 0 view .LVU149
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL49:
+	.loc 1 106 40 view .LVU150
+	testb	%al, %al
+	jne	.L22
+	.loc 1 110 5 is_stmt 1 view .LVU151
+	.loc 1 111 9 is_stmt 0 view .LVU152
+	movq	16(%rsp), %rax
+	.loc 1 110 19 view .LVU153
+	movb	$0, 160(%rsp,%r12)
+	.loc 1 111 5 is_stmt 1 view .LVU154
+	.loc 1 111 9 is_stmt 0 view .LVU155
+	movq	(%rax,%r14), %r12
+.LVL50:
+	.loc 1 111 9 view .LVU156
+	movq	24(%rsp), %rdi
+	movq	%r12, %rsi
+	call	strcmp@PLT
+.LVL51:
+	.loc 1 111 8 view .LVU157
+	testl	%eax, %eax
+	jne	.L23
+	.loc 1 111 49 discriminator 2 view .LVU158
+	movq	8(%rbx), %rax
+	cmpq	%rax, 16(%rbx)
+	je	.L24
+.L23:
+	.loc 1 112 7 is_stmt 1 discriminator 3 view .LVU159
+	movq	24(%rsp), %rdx
+	movq	%r12, %rsi
+	leaq	.LC19(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL52:
+	.loc 1 113 7 discriminator 3 view .LVU160
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL53:
+	.loc 1 114 7 discriminator 3 view .LVU161
+	.loc 1 115 7 discriminator 3 view .LVU162
+	.loc 1 114 19 is_stmt 0 discriminator 3 view .LVU163
+	movl	$1, 4(%rsp)
+.LVL54:
+.L25:
+	.loc 1 114 19 discriminator 3 view .LVU164
+.LBE21:
+	.loc 1 100 35 is_stmt 1 discriminator 2 view .LVU165
+	.loc 1 100 21 discriminator 2 view .LVU166
+	addq	$8, %r14
+.LVL55:
+	.loc 1 100 21 is_stmt 0 discriminator 2 view .LVU167
+	cmpq	$32, %r14
+	jne	.L26
+.LBE23:
+	.loc 1 121 3 is_stmt 1 view .LVU168
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL56:
+	.loc 1 123 3 view .LVU169
+	.loc 1 124 1 is_stmt 0 view .LVU170
+	movl	4(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL57:
+	.loc 1 124 1 view .LVU171
+	popq	%rbx
+.LVL58:
+	.loc 1 124 1 view .LVU172
+	popq	%r12
+	popq	%r13
+.LVL59:
+	.loc 1 124 1 view .LVU173
+	popq	%r14
+.LVL60:
+	.loc 1 124 1 view .LVU174
+	popq	%r15
+.LVL61:
+	.loc 1 124 1 view .LVU175
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL62:
+	.loc 1 124 1 view .LVU176
+	ret
+.LVL63:
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	.cfi_restore_state
+.LBB24:
+.LBB22:
+	.loc 1 118 5 is_stmt 1 view .LVU177
+	movq	24(%rsp), %rsi
+	leaq	.LC20(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL64:
+	.loc 1 119 5 view .LVU178
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL65:
+	jmp	.L25
+.LBE22:
+.LBE24:
+	.cfi_endproc
+.LFE28:
+	.size	run_st_next_token_unit_tests, .-run_st_next_token_unit_tests
+	.p2align 4
+	.globl	run_string_scan_tests
+	.type	run_string_scan_tests, @function
+run_string_scan_tests:
+.LFB29:
+	.loc 1 129 29 view -0
+	.cfi_startproc
+	.loc 1 131 3 view .LVU180
+	.loc 1 129 29 is_stmt 0 view .LVU181
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 131 7 view .LVU182
+	xorl	%eax, %eax
+	call	run_st_scan_kernels_unit_tests@PLT
+.LVL66:
+	.loc 1 131 6 view .LVU183
+	cmpl	$1, %eax
+	je	.L29
+	.loc 1 135 3 is_stmt 1 view .LVU184
+	.loc 1 135 7 is_stmt 0 view .LVU185
+	xorl	%eax, %eax
+	call	run_st_next_token_unit_tests@PLT
+.LVL67:
+	.loc 1 135 6 view .LVU186
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+.L29:
+	.loc 1 140 1 view .LVU187
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	run_string_scan_tests, .-run_string_scan_tests
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.long	0
+	.long	1
+	.long	2
+	.long	3
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/stdio.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/root/repo/tests/../include/strutils.h"
+	.file 7 "/usr/include/string.h"
+	.file 8 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xb5c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF102
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xb
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x11
+	.long	0x2e
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF8
+	.uleb128 0xb
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xb
+	.long	.LASF11
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x72
+	.uleb128 0x6
+	.long	0x96
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0x11
+	.long	0x96
+	.uleb128 0xb
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x13
+	.long	0x85
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF14
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF15
+	.uleb128 0x6
+	.long	0x9d
+	.uleb128 0xb
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0x79
+	.uleb128 0x24
+	.long	.LASF42
+	.byte	0x7
+	.byte	0x4
+	.long	0x46
+	.byte	0x6
+	.byte	0xe7
+	.byte	0x6
+	.long	0xf8
+	.uleb128 0x7
+	.long	.LASF17
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF18
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF19
+	.byte	0x2
+	.uleb128 0x7
+	.long	.LASF20
+	.byte	0x3
+	.byte	0
+	.uleb128 0x11
+	.long	0xcd
+	.uleb128 0x10
+	.long	.LASF25
+	.byte	0x18
+	.value	0x175
+	.long	0x131
+	.uleb128 0x2
+	.long	.LASF21
+	.value	0x17a
+	.byte	0x1c
+	.long	0x136
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF22
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF23
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF103
+	.uleb128 0x6
+	.long	0x131
+	.uleb128 0x5
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF24
+	.uleb128 0x10
+	.long	.LASF26
+	.byte	0x40
+	.value	0x1e6
+	.long	0x1b7
+	.uleb128 0x2
+	.long	.LASF27
+	.value	0x1eb
+	.byte	0xc
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF28
+	.value	0x1f0
+	.byte	0xc
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF29
+	.value	0x1f5
+	.byte	0xc
+	.long	0xc1
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF30
+	.value	0x1fa
+	.byte	0xc
+	.long	0xc1
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF31
+	.value	0x1ff
+	.byte	0xc
+	.long	0xc1
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF32
+	.value	0x204
+	.byte	0xc
+	.long	0xc1
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF33
+	.value	0x209
+	.byte	0xc
+	.long	0xc1
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF34
+	.value	0x20e
+	.byte	0xc
+	.long	0xc1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF35
+	.byte	0x38
+	.value	0x26c
+	.long	0x229
+	.uleb128 0x2
+	.long	.LASF36
+	.value	0x272
+	.byte	0xd
+	.long	0x242
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF37
+	.value	0x277
+	.byte	0x9
+	.long	0x4d
+	.byte	0x8
+	.uleb128 0x15
+	.string	"fd"
+	.value	0x27c
+	.long	0x6b
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF38
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF39
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF40
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x15
+	.string	"eof"
+	.value	0x290
+	.long	0x6b
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF41
+	.value	0x295
+	.byte	0x7
+	.long	0x6b
+	.byte	0x34
+	.byte	0
+	.uleb128 0x26
+	.long	0xa2
+	.long	0x242
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x91
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	0x229
+	.uleb128 0x16
+	.long	.LASF43
+	.long	0x46
+	.value	0x29b
+	.long	0x263
+	.uleb128 0x7
+	.long	.LASF44
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF45
+	.byte	0x1
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF46
+	.long	0x46
+	.value	0x2b5
+	.long	0x28b
+	.uleb128 0x7
+	.long	.LASF47
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF48
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF49
+	.byte	0x2
+	.uleb128 0x7
+	.long	.LASF50
+	.byte	0x3
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF51
+	.value	0x158
+	.byte	0x6
+	.value	0x2cf
+	.byte	0x8
+	.long	0x339
+	.uleb128 0x2
+	.long	.LASF52
+	.value	0x2d4
+	.byte	0x9
+	.long	0x91
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF53
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF54
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF55
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF56
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x247
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF57
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF58
+	.value	0x2f2
+	.byte	0x18
+	.long	0x339
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF59
+	.value	0x2f7
+	.byte	0x18
+	.long	0x263
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF60
+	.value	0x2fc
+	.byte	0x17
+	.long	0x33e
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF61
+	.value	0x301
+	.byte	0x8
+	.long	0x343
+	.byte	0x48
+	.uleb128 0x17
+	.long	.LASF62
+	.value	0x306
+	.byte	0x21
+	.long	0x3a1
+	.value	0x148
+	.uleb128 0x17
+	.long	.LASF63
+	.value	0x30b
+	.byte	0x17
+	.long	0x3a6
+	.value	0x150
+	.byte	0
+	.uleb128 0x6
+	.long	0x1b7
+	.uleb128 0x6
+	.long	0xfd
+	.uleb128 0xc
+	.long	0x96
+	.long	0x353
+	.uleb128 0xd
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF64
+	.byte	0x28
+	.value	0x764
+	.long	0x3a1
+	.uleb128 0x2
+	.long	.LASF65
+	.value	0x769
+	.byte	0xb
+	.long	0x3b2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF66
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF67
+	.value	0x774
+	.byte	0xd
+	.long	0x3b7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF53
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF68
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0x353
+	.uleb128 0x6
+	.long	0x142
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF69
+	.uleb128 0x6
+	.long	0x2e
+	.uleb128 0x6
+	.long	0xc1
+	.uleb128 0x6
+	.long	0x28b
+	.uleb128 0x18
+	.long	.LASF70
+	.value	0x403
+	.long	0x3d2
+	.uleb128 0x3
+	.long	0x3bc
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF72
+	.byte	0x9c
+	.byte	0xc
+	.long	0x6b
+	.long	0x3ec
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0xbc
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF71
+	.value	0x40b
+	.long	0x3fd
+	.uleb128 0x3
+	.long	0x3bc
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF73
+	.byte	0x6
+	.value	0x416
+	.byte	0x6
+	.long	0x96
+	.long	0x414
+	.uleb128 0x3
+	.long	0x3bc
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF74
+	.byte	0x6
+	.value	0x317
+	.byte	0x19
+	.long	0x3bc
+	.long	0x42b
+	.uleb128 0x3
+	.long	0x91
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF75
+	.byte	0x8d
+	.byte	0xe
+	.long	0x91
+	.long	0x445
+	.uleb128 0x3
+	.long	0x91
+	.uleb128 0x3
+	.long	0xbc
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF76
+	.byte	0x6
+	.value	0x148
+	.byte	0x8
+	.long	0x2e
+	.long	0x461
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF77
+	.byte	0x6
+	.value	0x138
+	.byte	0x8
+	.long	0x2e
+	.long	0x47d
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF78
+	.byte	0x6
+	.value	0x12b
+	.byte	0x8
+	.long	0x2e
+	.long	0x499
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0x3a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF79
+	.byte	0x6
+	.value	0x11c
+	.byte	0x8
+	.long	0x2e
+	.long	0x4ba
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0x3a
+	.uleb128 0x3
+	.long	0x9d
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF80
+	.byte	0x3d
+	.byte	0xe
+	.long	0x4d
+	.long	0x4d9
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x3
+	.long	0x6b
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF81
+	.byte	0x4
+	.value	0x164
+	.byte	0xc
+	.long	0x6b
+	.long	0x4f1
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x19
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF82
+	.byte	0x6
+	.value	0x105
+	.byte	0x5
+	.long	0x6b
+	.long	0x508
+	.uleb128 0x3
+	.long	0xf8
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF83
+	.byte	0x6
+	.value	0x10d
+	.byte	0x14
+	.long	0xcd
+	.long	0x51b
+	.uleb128 0x19
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF84
+	.byte	0x81
+	.long	0x6b
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x556
+	.uleb128 0x14
+	.quad	.LVL66
+	.long	0x791
+	.uleb128 0x14
+	.quad	.LVL67
+	.long	0x556
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF85
+	.byte	0x5a
+	.long	0x6b
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x771
+	.uleb128 0x9
+	.long	.LASF86
+	.byte	0x5c
+	.byte	0xf
+	.long	0x771
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0x9
+	.long	.LASF87
+	.byte	0x5d
+	.byte	0xf
+	.long	0x771
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x1a
+	.long	.LASF88
+	.byte	0x5f
+	.long	0x6b
+	.uleb128 0xe
+	.long	.LASF89
+	.byte	0x63
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x1b
+	.long	.LLRL8
+	.long	0x733
+	.uleb128 0x1c
+	.string	"i"
+	.byte	0x64
+	.long	0x6b
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x29
+	.long	.LLRL10
+	.uleb128 0x9
+	.long	.LASF52
+	.byte	0x65
+	.byte	0xa
+	.long	0x781
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0xe
+	.long	.LASF90
+	.byte	0x67
+	.byte	0x1d
+	.long	0x3bc
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x9
+	.long	.LASF91
+	.byte	0x68
+	.byte	0xa
+	.long	0x781
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0xe
+	.long	.LASF66
+	.byte	0x69
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x4
+	.quad	.LVL42
+	.long	0x42b
+	.long	0x634
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL43
+	.long	0x414
+	.long	0x64c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL46
+	.long	0x3fd
+	.long	0x664
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL48
+	.long	0x3ec
+	.long	0x67c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL49
+	.long	0x3fd
+	.long	0x694
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL51
+	.long	0x3d2
+	.long	0x6b3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL52
+	.long	0x4d9
+	.long	0x6df
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL53
+	.long	0x3c1
+	.long	0x6f7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL64
+	.long	0x4d9
+	.long	0x71d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL65
+	.long	0x3c1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL39
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.quad	.LVL40
+	.long	0xb4d
+	.long	0x75d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL56
+	.long	0xb56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0xbc
+	.long	0x781
+	.uleb128 0xd
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	0x96
+	.long	0x791
+	.uleb128 0xd
+	.long	0x3f
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF92
+	.byte	0x38
+	.long	0x6b
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xaf5
+	.uleb128 0x9
+	.long	.LASF93
+	.byte	0x3a
+	.byte	0x16
+	.long	0xaf5
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 176
+	.uleb128 0x9
+	.long	.LASF94
+	.byte	0x3b
+	.byte	0xf
+	.long	0x771
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.uleb128 0x1a
+	.long	.LASF88
+	.byte	0x3d
+	.long	0x6b
+	.uleb128 0xe
+	.long	.LASF89
+	.byte	0x41
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xe
+	.long	.LASF95
+	.byte	0x42
+	.byte	0x16
+	.long	0xcd
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x9
+	.long	.LASF96
+	.byte	0x43
+	.byte	0x8
+	.long	0xb05
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 240
+	.uleb128 0x1b
+	.long	.LLRL2
+	.long	0xa84
+	.uleb128 0x1c
+	.string	"i"
+	.byte	0x44
+	.long	0x6b
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x2a
+	.long	0xb15
+	.long	.LLRL4
+	.byte	0x1
+	.byte	0x49
+	.byte	0x9
+	.long	0x9e5
+	.uleb128 0x2b
+	.long	0xb26
+	.uleb128 0x2c
+	.long	0xb32
+	.long	.LLRL4
+	.uleb128 0x1d
+	.long	0xb33
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2d
+	.long	0xb3e
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.long	0x9a0
+	.uleb128 0x1d
+	.long	0xb3f
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x4
+	.quad	.LVL13
+	.long	0x47d
+	.long	0x896
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL14
+	.long	0x499
+	.long	0x8ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL15
+	.long	0x461
+	.long	0x8d8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL16
+	.long	0x445
+	.long	0x8f6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL17
+	.long	0x445
+	.long	0x914
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL18
+	.long	0x47d
+	.long	0x932
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL19
+	.long	0x499
+	.long	0x956
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL20
+	.long	0x445
+	.long	0x974
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL23
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xa
+	.quad	.LVL24
+	.long	0x499
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL8
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.quad	.LVL9
+	.long	0x47d
+	.long	0x9c9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL10
+	.long	0x461
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL7
+	.long	0x4f1
+	.long	0xa06
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xb
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x77
+	.sleb128 168
+	.byte	0x6
+	.byte	0x22
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL26
+	.long	0x4d9
+	.long	0xa31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL35
+	.long	0x4d9
+	.long	0xa5c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL37
+	.long	0x4d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL1
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.quad	.LVL2
+	.long	0xb4d
+	.long	0xaae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL3
+	.long	0x508
+	.uleb128 0xf
+	.quad	.LVL6
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.quad	.LVL29
+	.long	0x4f1
+	.long	0xae1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x77
+	.sleb128 160
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL30
+	.long	0xb56
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0xcd
+	.long	0xb05
+	.uleb128 0xd
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	0x96
+	.long	0xb15
+	.uleb128 0xd
+	.long	0x3f
+	.byte	0xc7
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF104
+	.byte	0x1
+	.byte	0x11
+	.byte	0xc
+	.long	0x6b
+	.byte	0x1
+	.long	0xb4d
+	.uleb128 0x2f
+	.long	.LASF96
+	.byte	0x1
+	.byte	0x11
+	.byte	0x25
+	.long	0x91
+	.uleb128 0x1e
+	.uleb128 0x1f
+	.long	.LASF53
+	.byte	0x12
+	.byte	0xf
+	.long	0x2e
+	.uleb128 0x1e
+	.uleb128 0x1f
+	.long	.LASF97
+	.byte	0x13
+	.byte	0x11
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF98
+	.long	.LASF100
+	.uleb128 0x20
+	.long	.LASF99
+	.long	.LASF101
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 4
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS7:
+	.uleb128 .LVU127
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 4
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 4
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -155
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 -28
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0xdc
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x8
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0xdc
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 4
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU129
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU174
+	.uleb128 .LVU177
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU137
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU172
+	.uleb128 .LVU177
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU139
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU156
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU17
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 164
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 164
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 -28
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x11c
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x11c
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 164
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU19
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 -32
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x120
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x120
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU22
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU94
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU42
+	.uleb128 .LVU46
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU46
+	.uleb128 .LVU87
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF104:
+	.string	"check_scan_offsets"
+.LASF27:
+	.string	"bytes_scanned"
+.LASF54:
+	.string	"position"
+.LASF100:
+	.string	"__builtin_puts"
+.LASF22:
+	.string	"block_size"
+.LASF87:
+	.string	"expected_values"
+.LASF50:
+	.string	"ST_STRING_INLINE"
+.LASF89:
+	.string	"exit_status"
+.LASF97:
+	.string	"target"
+.LASF7:
+	.string	"short int"
+.LASF9:
+	.string	"size_t"
+.LASF70:
+	.string	"st_destroy"
+.LASF65:
+	.string	"positions"
+.LASF99:
+	.string	"putchar"
+.LASF63:
+	.string	"stats"
+.LASF28:
+	.string	"tokens_extracted"
+.LASF13:
+	.string	"ssize_t"
+.LASF42:
+	.string	"StringScanIsa"
+.LASF59:
+	.string	"ownership"
+.LASF33:
+	.string	"conversions"
+.LASF21:
+	.string	"head"
+.LASF20:
+	.string	"ST_SCAN_AVX512"
+.LASF83:
+	.string	"st_scan_isa"
+.LASF18:
+	.string	"ST_SCAN_SSE2"
+.LASF49:
+	.string	"ST_STRING_MAPPED"
+.LASF25:
+	.string	"StringArena"
+.LASF74:
+	.string	"st_create"
+.LASF68:
+	.string	"hint"
+.LASF53:
+	.string	"length"
+.LASF77:
+	.string	"st_scan_nul"
+.LASF19:
+	.string	"ST_SCAN_AVX2"
+.LASF36:
+	.string	"read"
+.LASF14:
+	.string	"long long int"
+.LASF11:
+	.string	"__ssize_t"
+.LASF80:
+	.string	"memset"
+.LASF8:
+	.string	"long int"
+.LASF52:
+	.string	"string"
+.LASF90:
+	.string	"tokenizer"
+.LASF40:
+	.string	"offset"
+.LASF62:
+	.string	"structural_index"
+.LASF76:
+	.string	"st_scan_escape"
+.LASF37:
+	.string	"context"
+.LASF94:
+	.string	"isa_names"
+.LASF17:
+	.string	"ST_SCAN_SCALAR"
+.LASF57:
+	.string	"max_increment"
+.LASF55:
+	.string	"incremental_factor"
+.LASF47:
+	.string	"ST_STRING_BORROWED"
+.LASF43:
+	.string	"StringGrowthPolicy"
+.LASF30:
+	.string	"reallocations"
+.LASF24:
+	.string	"long double"
+.LASF95:
+	.string	"original_isa"
+.LASF4:
+	.string	"unsigned char"
+.LASF45:
+	.string	"ST_GROWTH_LINEAR"
+.LASF39:
+	.string	"capacity"
+.LASF15:
+	.string	"long long unsigned int"
+.LASF3:
+	.string	"unsigned int"
+.LASF73:
+	.string	"st_current_token"
+.LASF98:
+	.string	"puts"
+.LASF92:
+	.string	"run_st_scan_kernels_unit_tests"
+.LASF5:
+	.string	"short unsigned int"
+.LASF12:
+	.string	"char"
+.LASF81:
+	.string	"printf"
+.LASF60:
+	.string	"arena"
+.LASF75:
+	.string	"strcpy"
+.LASF101:
+	.string	"__builtin_putchar"
+.LASF10:
+	.string	"__uint64_t"
+.LASF96:
+	.string	"buffer"
+.LASF88:
+	.string	"num_tests"
+.LASF26:
+	.string	"StringStats"
+.LASF2:
+	.string	"long unsigned int"
+.LASF61:
+	.string	"inline_buffer"
+.LASF69:
+	.string	"double"
+.LASF64:
+	.string	"StringStructuralIndex"
+.LASF102:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF48:
+	.string	"ST_STRING_OWNED"
+.LASF32:
+	.string	"bytes_copied"
+.LASF67:
+	.string	"in_string"
+.LASF91:
+	.string	"tokens"
+.LASF66:
+	.string	"count"
+.LASF38:
+	.string	"chunk_size"
+.LASF72:
+	.string	"strcmp"
+.LASF6:
+	.string	"signed char"
+.LASF85:
+	.string	"run_st_next_token_unit_tests"
+.LASF34:
+	.string	"conversion_ns"
+.LASF23:
+	.string	"used"
+.LASF44:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF46:
+	.string	"StringOwnership"
+.LASF78:
+	.string	"st_scan_non_whitespace"
+.LASF56:
+	.string	"growth_policy"
+.LASF41:
+	.string	"error"
+.LASF71:
+	.string	"st_next_token"
+.LASF51:
+	.string	"StringTokenizer"
+.LASF86:
+	.string	"string_values"
+.LASF82:
+	.string	"st_scan_set_isa"
+.LASF84:
+	.string	"run_string_scan_tests"
+.LASF79:
+	.string	"st_scan_delimiter"
+.LASF58:
+	.string	"stream"
+.LASF103:
+	.string	"StringArenaBlock"
+.LASF35:
+	.string	"StringStream"
+.LASF16:
+	.string	"uint64_t"
+.LASF31:
+	.string	"expansions"
+.LASF29:
+	.string	"allocations"
+.LASF93:
+	.string	"isa_values"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/tests/string_scan_unit_tests.c"
+.LASF1:
+	.string	"/root/repo/build/test"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3258 @@
+	.file	"string_stats_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/tests/string_stats_unit_tests.c"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"------------------- st_attach_stats(x) -------------------"
+	.align 8
+.LC2:
+	.string	"[Failed] The counters changed while compiled out."
+	.align 8
+.LC3:
+	.string	"[Passed] The counters stay at zero without LIBSTR_ENABLE_STATS."
+	.align 8
+.LC5:
+	.string	"[Failed] %llu tokens, %llu allocations and %llu conversions counted.\n"
+	.align 8
+.LC6:
+	.string	"[Passed] 5 tokens, 3 allocations and 1003 conversions counted."
+	.align 8
+.LC7:
+	.string	"[Failed] %llu bytes scanned and %llu expansions counted.\n"
+	.align 8
+.LC8:
+	.string	"[Passed] %llu bytes scanned and %llu expansions counted.\n"
+	.text
+	.p2align 4
+	.globl	run_st_attach_stats_unit_tests
+	.type	run_st_attach_stats_unit_tests, @function
+run_st_attach_stats_unit_tests:
+.LFB26:
+	.file 1 "/root/repo/tests/string_stats_unit_tests.c"
+	.loc 1 9 38 view -0
+	.cfi_startproc
+	.loc 1 11 3 view .LVU1
+	.loc 1 9 38 is_stmt 0 view .LVU2
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 11 3 view .LVU3
+	leaq	.LC0(%rip), %rdi
+	.loc 1 9 38 view .LVU4
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$232, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 11 3 view .LVU5
+	call	puts@PLT
+.LVL0:
+	.loc 1 12 3 is_stmt 1 view .LVU6
+	.loc 1 13 3 view .LVU7
+	.loc 1 14 3 view .LVU8
+	.loc 1 17 39 is_stmt 0 view .LVU9
+	leaq	48(%rsp), %rax
+	.loc 1 14 3 view .LVU10
+	vpxor	%xmm0, %xmm0, %xmm0
+	.loc 1 17 39 view .LVU11
+	movq	%rax, 8(%rsp)
+	.loc 1 14 3 view .LVU12
+	vmovdqu8	%zmm0, 96(%rsp)
+	.loc 1 16 3 is_stmt 1 view .LVU13
+	.loc 1 16 8 is_stmt 0 view .LVU14
+	vmovdqa	.LC10(%rip), %xmm0
+	.loc 1 17 39 view .LVU15
+	movq	%rax, %rdi
+	.loc 1 16 8 view .LVU16
+	vmovdqa	%xmm0, 48(%rsp)
+	.loc 1 17 3 is_stmt 1 view .LVU17
+	.loc 1 17 39 is_stmt 0 view .LVU18
+	vzeroupper
+.LVL1:
+	.loc 1 14 3 view .LVU19
+	leaq	96(%rsp), %rbx
+	.loc 1 17 39 view .LVU20
+	call	st_create@PLT
+.LVL2:
+	movq	%rax, %r12
+.LVL3:
+	.loc 1 18 3 is_stmt 1 view .LVU21
+	movq	%rax, %rdi
+	movq	%rbx, %rsi
+	call	st_attach_stats@PLT
+.LVL4:
+	.loc 1 19 3 view .LVU22
+	.loc 1 19 17 is_stmt 0 view .LVU23
+	movl	$34, %edx
+	movl	$34, %esi
+	movq	%r12, %rdi
+	call	st_sub_string@PLT
+.LVL5:
+	.loc 1 20 3 view .LVU24
+	movq	%r12, %rdi
+	.loc 1 19 17 view .LVU25
+	movq	%rax, %r15
+.LVL6:
+	.loc 1 20 3 is_stmt 1 view .LVU26
+	call	st_next_token@PLT
+.LVL7:
+	.loc 1 21 3 view .LVU27
+	.loc 1 21 18 is_stmt 0 view .LVU28
+	movl	$34, %edx
+	movl	$34, %esi
+	movq	%r12, %rdi
+	call	st_sub_string@PLT
+.LVL8:
+	.loc 1 22 3 view .LVU29
+	movq	%r12, %rdi
+	.loc 1 21 18 view .LVU30
+	movq	%rax, %r13
+.LVL9:
+	.loc 1 22 3 is_stmt 1 view .LVU31
+	call	st_next_token@PLT
+.LVL10:
+	.loc 1 23 3 view .LVU32
+	.loc 1 24 3 is_stmt 0 view .LVU33
+	leaq	24(%rsp), %rsi
+	movq	%r12, %rdi
+	.loc 1 23 10 view .LVU34
+	movq	$0x000000000, 24(%rsp)
+	.loc 1 24 3 is_stmt 1 view .LVU35
+	call	st_extract_double_to@PLT
+.LVL11:
+	.loc 1 25 3 view .LVU36
+	movq	%r15, %rdi
+	call	free@PLT
+.LVL12:
+	.loc 1 26 3 view .LVU37
+	movq	%r13, %rdi
+	call	free@PLT
+.LVL13:
+	.loc 1 27 3 view .LVU38
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL14:
+	.loc 1 29 3 view .LVU39
+	.loc 1 29 8 is_stmt 0 view .LVU40
+	movabsq	$3539889918500024881, %rax
+	.loc 1 31 15 view .LVU41
+	leaq	36(%rsp), %rdi
+	.loc 1 29 8 view .LVU42
+	movq	%rax, 36(%rsp)
+	movl	$3485234, 44(%rsp)
+	.loc 1 30 3 is_stmt 1 view .LVU43
+	.loc 1 30 11 is_stmt 0 view .LVU44
+	movq	$0, 64(%rsp)
+	movq	$0, 72(%rsp)
+	movq	$0, 80(%rsp)
+	.loc 1 31 3 is_stmt 1 view .LVU45
+	.loc 1 31 15 is_stmt 0 view .LVU46
+	call	st_create@PLT
+.LVL15:
+	.loc 1 32 3 view .LVU47
+	movq	%rax, %rdi
+	movq	%rbx, %rsi
+	.loc 1 31 15 view .LVU48
+	movq	%rax, %r12
+.LVL16:
+	.loc 1 32 3 is_stmt 1 view .LVU49
+	leaq	64(%rsp), %r14
+	call	st_attach_stats@PLT
+.LVL17:
+	.loc 1 33 3 view .LVU50
+	.loc 1 34 3 view .LVU51
+.LBB2:
+	.loc 1 34 8 view .LVU52
+	.loc 1 34 21 view .LVU53
+	leaq	88(%rsp), %r15
+.LVL18:
+	.loc 1 34 21 is_stmt 0 view .LVU54
+.LBE2:
+	.loc 1 33 7 view .LVU55
+	xorl	%r13d, %r13d
+.LVL19:
+.L2:
+.LBB3:
+	.loc 1 35 5 is_stmt 1 discriminator 3 view .LVU56
+	.loc 1 35 17 is_stmt 0 discriminator 3 view .LVU57
+	movq	%r14, %rsi
+	movq	%r12, %rdi
+	call	st_extract_int64@PLT
+.LVL20:
+	.loc 1 35 14 discriminator 3 view .LVU58
+	cmpl	$1, %eax
+	adcl	$0, %r13d
+.LVL21:
+	.loc 1 36 5 is_stmt 1 discriminator 3 view .LVU59
+	movq	%r12, %rdi
+	.loc 1 34 21 is_stmt 0 discriminator 3 view .LVU60
+	addq	$8, %r14
+.LVL22:
+	.loc 1 36 5 discriminator 3 view .LVU61
+	call	st_next_token@PLT
+.LVL23:
+	.loc 1 34 27 is_stmt 1 discriminator 3 view .LVU62
+	.loc 1 34 21 discriminator 3 view .LVU63
+	cmpq	%r15, %r14
+	jne	.L2
+.LBE3:
+	.loc 1 38 3 view .LVU64
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL24:
+	.loc 1 40 3 view .LVU65
+	.loc 1 40 37 is_stmt 0 view .LVU66
+	movl	$1, %edi
+	call	st_create_empty@PLT
+.LVL25:
+	.loc 1 41 3 view .LVU67
+	movq	%rax, %rdi
+	movq	%rbx, %rsi
+	.loc 1 40 37 view .LVU68
+	movq	%rax, %r12
+.LVL26:
+	.loc 1 41 3 is_stmt 1 view .LVU69
+	xorl	%ebx, %ebx
+	call	st_attach_stats@PLT
+.LVL27:
+	.loc 1 42 3 view .LVU70
+.LBB4:
+	.loc 1 42 8 view .LVU71
+	.loc 1 42 21 view .LVU72
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 43 5 discriminator 3 view .LVU73
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	.loc 1 42 21 is_stmt 0 discriminator 3 view .LVU74
+	incq	%rbx
+.LVL28:
+	.loc 1 43 5 discriminator 3 view .LVU75
+	call	st_append_int@PLT
+.LVL29:
+	.loc 1 42 30 is_stmt 1 discriminator 3 view .LVU76
+	.loc 1 42 21 discriminator 3 view .LVU77
+	cmpq	$1000, %rbx
+	jne	.L3
+.LBE4:
+	.loc 1 45 3 view .LVU78
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL30:
+	.loc 1 46 3 view .LVU79
+	.loc 1 46 7 is_stmt 0 view .LVU80
+	call	st_stats_available@PLT
+.LVL31:
+	.loc 1 46 6 view .LVU81
+	testl	%eax, %eax
+	je	.L24
+	.loc 1 61 3 is_stmt 1 view .LVU82
+	.loc 1 61 12 is_stmt 0 view .LVU83
+	movq	104(%rsp), %rsi
+	.loc 1 61 43 view .LVU84
+	movq	112(%rsp), %rdx
+	.loc 1 61 69 view .LVU85
+	movq	144(%rsp), %rcx
+	.loc 1 61 6 view .LVU86
+	cmpq	$5, %rsi
+	jne	.L10
+	.loc 1 61 35 discriminator 1 view .LVU87
+	cmpq	$3, %rdx
+	je	.L25
+.L10:
+	.loc 1 62 5 is_stmt 1 view .LVU88
+	leaq	.LC5(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL32:
+	.loc 1 63 5 view .LVU89
+	.loc 1 63 17 is_stmt 0 view .LVU90
+	movl	$1, %ebx
+.LVL33:
+.L13:
+	.loc 1 68 3 is_stmt 1 view .LVU91
+	.loc 1 68 29 is_stmt 0 view .LVU92
+	movq	8(%rsp), %rdi
+	.loc 1 68 12 view .LVU93
+	movq	96(%rsp), %r12
+.LVL34:
+	.loc 1 68 29 view .LVU94
+	call	strlen@PLT
+.LVL35:
+	.loc 1 68 44 view .LVU95
+	decq	%rax
+	.loc 1 68 56 view .LVU96
+	movq	128(%rsp), %rdx
+	.loc 1 68 6 view .LVU97
+	cmpq	%rax, %r12
+	jb	.L14
+	.loc 1 68 48 discriminator 1 view .LVU98
+	testq	%rdx, %rdx
+	jne	.L26
+.L14:
+	.loc 1 69 5 is_stmt 1 view .LVU99
+	movq	%r12, %rsi
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL36:
+	.loc 1 70 5 view .LVU100
+	.loc 1 70 17 is_stmt 0 view .LVU101
+	movl	$1, %ebx
+.LVL37:
+.L16:
+	.loc 1 75 3 is_stmt 1 view .LVU102
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL38:
+	.loc 1 77 3 view .LVU103
+	.loc 1 78 1 is_stmt 0 view .LVU104
+	addq	$232, %rsp
+	movl	%ebx, %eax
+	popq	%rbx
+.LVL39:
+	.loc 1 78 1 view .LVU105
+	popq	%r12
+	popq	%r13
+.LVL40:
+	.loc 1 78 1 view .LVU106
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL41:
+.L26:
+	.cfi_restore_state
+	.loc 1 68 96 discriminator 2 view .LVU107
+	movq	120(%rsp), %rax
+	incq	%rax
+	.loc 1 68 73 discriminator 2 view .LVU108
+	cmpq	%rdx, %rax
+	jb	.L14
+	.loc 1 68 119 discriminator 3 view .LVU109
+	cmpq	$255, 136(%rsp)
+	jbe	.L14
+	.loc 1 73 5 is_stmt 1 view .LVU110
+	movq	%r12, %rsi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL42:
+	jmp	.L16
+.LVL43:
+.L24:
+.LBB5:
+	.loc 1 48 5 view .LVU111
+	.loc 1 49 5 view .LVU112
+	.loc 1 50 9 is_stmt 0 view .LVU113
+	movq	96(%rsp), %rax
+	.loc 1 49 5 view .LVU114
+	vpxor	%xmm0, %xmm0, %xmm0
+	.loc 1 50 9 view .LVU115
+	orq	104(%rsp), %rax
+	.loc 1 49 5 view .LVU116
+	vmovdqu8	%zmm0, 160(%rsp)
+	.loc 1 50 5 is_stmt 1 view .LVU117
+	.loc 1 50 9 is_stmt 0 view .LVU118
+	jne	.L5
+	movq	120(%rsp), %rax
+	movq	112(%rsp), %rdx
+	xorq	184(%rsp), %rax
+	xorq	176(%rsp), %rdx
+	orq	%rdx, %rax
+	jne	.L5
+	movq	136(%rsp), %rax
+	movq	128(%rsp), %rdx
+	xorq	200(%rsp), %rax
+	xorq	192(%rsp), %rdx
+	orq	%rdx, %rax
+	jne	.L5
+	movq	152(%rsp), %rax
+	movq	144(%rsp), %rdx
+	xorq	216(%rsp), %rax
+	xorq	208(%rsp), %rdx
+	orq	%rdx, %rax
+	jne	.L5
+	.loc 1 55 7 view .LVU119
+	leaq	.LC3(%rip), %rdi
+	.loc 1 50 9 view .LVU120
+	xorl	%ebx, %ebx
+	.loc 1 55 7 is_stmt 1 view .LVU121
+	vzeroupper
+.LVL44:
+	call	puts@PLT
+.LVL45:
+	jmp	.L16
+	.p2align 4,,10
+	.p2align 3
+.L25:
+.LBE5:
+	.loc 1 61 61 is_stmt 0 discriminator 2 view .LVU122
+	cmpq	$1003, %rcx
+	jne	.L10
+	.loc 1 61 90 discriminator 3 view .LVU123
+	vmovsd	24(%rsp), %xmm0
+	movl	$1, %edi
+	vucomisd	.LC4(%rip), %xmm0
+	vmovsd	.LC4(%rip), %xmm0
+	setp	%al
+	vucomisd	24(%rsp), %xmm0
+	cmovne	%edi, %eax
+	.loc 1 61 107 discriminator 3 view .LVU124
+	testb	%al, %al
+	jne	.L10
+	cmpl	$1, %r13d
+	jne	.L10
+	.loc 1 66 5 is_stmt 1 view .LVU125
+	leaq	.LC6(%rip), %rdi
+	call	puts@PLT
+.LVL46:
+	.loc 1 12 7 is_stmt 0 view .LVU126
+	xorl	%ebx, %ebx
+	jmp	.L13
+	.p2align 4,,10
+	.p2align 3
+.L5:
+.LBB6:
+	.loc 1 51 7 is_stmt 1 view .LVU127
+	leaq	.LC2(%rip), %rdi
+	vzeroupper
+.LVL47:
+	.loc 1 52 19 is_stmt 0 view .LVU128
+	movl	$1, %ebx
+	.loc 1 51 7 view .LVU129
+	call	puts@PLT
+.LVL48:
+	.loc 1 52 7 is_stmt 1 view .LVU130
+	.loc 1 57 5 view .LVU131
+	jmp	.L16
+.LBE6:
+	.cfi_endproc
+.LFE26:
+	.size	run_st_attach_stats_unit_tests, .-run_st_attach_stats_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC11:
+	.string	"------------------- st_stats_snapshot(x) -------------------"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC13:
+	.string	"2.5"
+	.section	.rodata.str1.8
+	.align 8
+.LC14:
+	.string	"[Failed] %llu conversions and %llu allocations counted.\n"
+	.align 8
+.LC15:
+	.string	"[Passed] %llu conversions and %llu allocations counted.\n"
+	.text
+	.p2align 4
+	.globl	run_st_stats_snapshot_unit_tests
+	.type	run_st_stats_snapshot_unit_tests, @function
+run_st_stats_snapshot_unit_tests:
+.LFB27:
+	.loc 1 83 40 view -0
+	.cfi_startproc
+	.loc 1 85 3 view .LVU133
+	.loc 1 83 40 is_stmt 0 view .LVU134
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 85 3 view .LVU135
+	leaq	.LC11(%rip), %rdi
+	.loc 1 83 40 view .LVU136
+	subq	$144, %rsp
+	.cfi_def_cfa_offset 160
+	.loc 1 85 3 view .LVU137
+	call	puts@PLT
+.LVL49:
+	.loc 1 86 3 is_stmt 1 view .LVU138
+	.loc 1 87 3 view .LVU139
+	.loc 1 88 3 view .LVU140
+	.loc 1 90 3 view .LVU141
+	call	st_stats_reset@PLT
+.LVL50:
+	.loc 1 91 3 view .LVU142
+	movl	$1, %edi
+	call	st_stats_enable@PLT
+.LVL51:
+	.loc 1 92 3 view .LVU143
+	.loc 1 92 8 is_stmt 0 view .LVU144
+	movl	$42, %edi
+	call	itos@PLT
+.LVL52:
+	movq	%rax, %rdi
+	.loc 1 92 3 view .LVU145
+	call	free@PLT
+.LVL53:
+	.loc 1 93 3 is_stmt 1 view .LVU146
+	.loc 1 93 8 is_stmt 0 view .LVU147
+	flds	.LC12(%rip)
+	fstpt	(%rsp)
+	movl	8(%rsp), %edx
+	movq	(%rsp), %rax
+	pushq	%rdx
+	.cfi_def_cfa_offset 168
+	pushq	%rax
+	.cfi_def_cfa_offset 176
+	call	ldtos@PLT
+.LVL54:
+	movq	%rax, %rdi
+	.loc 1 93 3 view .LVU148
+	call	free@PLT
+.LVL55:
+	.loc 1 94 3 is_stmt 1 view .LVU149
+	leaq	.LC13(%rip), %rdi
+	call	stold@PLT
+.LVL56:
+	fstp	%st(0)
+	.loc 1 95 3 view .LVU150
+	leaq	32(%rsp), %rdi
+	call	st_stats_snapshot@PLT
+.LVL57:
+	.loc 1 97 3 view .LVU151
+	xorl	%edi, %edi
+	call	st_stats_enable@PLT
+.LVL58:
+	.loc 1 98 3 view .LVU152
+	.loc 1 98 8 is_stmt 0 view .LVU153
+	movl	$43, %edi
+	call	itos@PLT
+.LVL59:
+	movq	%rax, %rdi
+	.loc 1 98 3 view .LVU154
+	call	free@PLT
+.LVL60:
+	.loc 1 99 3 is_stmt 1 view .LVU155
+	leaq	96(%rsp), %rdi
+	call	st_stats_snapshot@PLT
+.LVL61:
+	.loc 1 100 3 view .LVU156
+	call	st_stats_reset@PLT
+.LVL62:
+	.loc 1 101 3 view .LVU157
+	.loc 1 101 23 is_stmt 0 view .LVU158
+	call	st_stats_available@PLT
+.LVL63:
+	.loc 1 101 48 view .LVU159
+	popq	%rdx
+	.cfi_def_cfa_offset 168
+	popq	%rcx
+	.cfi_def_cfa_offset 160
+	testl	%eax, %eax
+	je	.L28
+.LVL64:
+	.loc 1 102 3 is_stmt 1 view .LVU160
+	.loc 1 102 14 is_stmt 0 view .LVU161
+	movq	64(%rsp), %rsi
+	.loc 1 102 49 view .LVU162
+	movq	32(%rsp), %rdx
+	.loc 1 102 79 view .LVU163
+	movl	$2, %eax
+	.loc 1 102 6 view .LVU164
+	cmpq	$3, %rsi
+	jne	.L29
+	.loc 1 102 39 discriminator 5 view .LVU165
+	cmpq	%rdx, %rax
+	je	.L37
+.LVL65:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 103 5 is_stmt 1 view .LVU166
+	leaq	.LC14(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL66:
+	.loc 1 104 5 view .LVU167
+	.loc 1 104 17 is_stmt 0 view .LVU168
+	movl	$1, %ebx
+.LVL67:
+.L34:
+	.loc 1 109 3 is_stmt 1 view .LVU169
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL68:
+	.loc 1 111 3 view .LVU170
+	.loc 1 112 1 is_stmt 0 view .LVU171
+	addq	$144, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL69:
+	.loc 1 112 1 view .LVU172
+	ret
+.LVL70:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.cfi_restore_state
+	.loc 1 102 3 is_stmt 1 view .LVU173
+	.loc 1 102 14 is_stmt 0 view .LVU174
+	movq	64(%rsp), %rax
+	.loc 1 102 49 view .LVU175
+	movq	32(%rsp), %rdx
+	.loc 1 102 6 view .LVU176
+	testq	%rax, %rax
+	jne	.L35
+	xorl	%esi, %esi
+	.loc 1 102 39 view .LVU177
+	cmpq	%rdx, %rax
+	jne	.L29
+	jmp	.L37
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.loc 1 102 6 view .LVU178
+	movq	%rax, %rsi
+	jmp	.L29
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	.loc 1 102 87 discriminator 6 view .LVU179
+	movq	24(%rsp), %rcx
+	movq	16(%rsp), %rdi
+	xorq	88(%rsp), %rcx
+	xorq	80(%rsp), %rdi
+	orq	%rdi, %rcx
+	jne	.L29
+	movq	40(%rsp), %rcx
+	movq	32(%rsp), %rdi
+	xorq	104(%rsp), %rcx
+	xorq	96(%rsp), %rdi
+	orq	%rdi, %rcx
+	jne	.L29
+	movq	56(%rsp), %rcx
+	movq	48(%rsp), %rdi
+	xorq	120(%rsp), %rcx
+	xorq	112(%rsp), %rdi
+	orq	%rdi, %rcx
+	jne	.L29
+	movq	72(%rsp), %rcx
+	movq	64(%rsp), %rdi
+	xorq	136(%rsp), %rcx
+	xorq	128(%rsp), %rdi
+	orq	%rdi, %rcx
+	jne	.L29
+	.loc 1 107 5 discriminator 6 view .LVU180
+	movq	%rax, %rdx
+	leaq	.LC15(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 102 87 discriminator 6 view .LVU181
+	xorl	%ebx, %ebx
+	.loc 1 107 5 is_stmt 1 discriminator 6 view .LVU182
+	call	printf@PLT
+.LVL72:
+	jmp	.L34
+	.cfi_endproc
+.LFE27:
+	.size	run_st_stats_snapshot_unit_tests, .-run_st_stats_snapshot_unit_tests
+	.p2align 4
+	.globl	run_string_stats_tests
+	.type	run_string_stats_tests, @function
+run_string_stats_tests:
+.LFB28:
+	.loc 1 117 30 view -0
+	.cfi_startproc
+	.loc 1 119 3 view .LVU184
+	.loc 1 117 30 is_stmt 0 view .LVU185
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 119 7 view .LVU186
+	xorl	%eax, %eax
+	call	run_st_attach_stats_unit_tests@PLT
+.LVL73:
+	.loc 1 119 6 view .LVU187
+	cmpl	$1, %eax
+	je	.L38
+	.loc 1 123 3 is_stmt 1 view .LVU188
+	.loc 1 123 7 is_stmt 0 view .LVU189
+	xorl	%eax, %eax
+	call	run_st_stats_snapshot_unit_tests@PLT
+.LVL74:
+	.loc 1 123 6 view .LVU190
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+.L38:
+	.loc 1 128 1 view .LVU191
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	run_string_stats_tests, .-run_string_stats_tests
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC4:
+	.long	0
+	.long	1076428800
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC10:
+	.quad	7215364885069324578
+	.quad	14968966873096805
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC12:
+	.long	1069547520
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/stdio.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "/root/repo/tests/../include/strutils.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "/usr/include/stdlib.h"
+	.file 10 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xc6d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF106
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xb
+	.long	.LASF8
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xf
+	.long	0x2e
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xf
+	.long	0x6b
+	.uleb128 0xb
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x83
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0xb
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xb
+	.long	.LASF12
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x5
+	.long	0xa7
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0xf
+	.long	0xa7
+	.uleb128 0xb
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x13
+	.long	0x96
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF15
+	.uleb128 0xb
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x13
+	.long	0x77
+	.uleb128 0xf
+	.long	0xc6
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF17
+	.uleb128 0x5
+	.long	0xe3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.long	0xae
+	.uleb128 0xb
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x10
+	.long	.LASF23
+	.byte	0x18
+	.value	0x175
+	.long	0x129
+	.uleb128 0x3
+	.long	.LASF19
+	.value	0x17a
+	.byte	0x1c
+	.long	0x12e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF20
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF21
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF107
+	.uleb128 0x5
+	.long	0x129
+	.uleb128 0x6
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF22
+	.uleb128 0x10
+	.long	.LASF24
+	.byte	0x40
+	.value	0x1e6
+	.long	0x1af
+	.uleb128 0x3
+	.long	.LASF25
+	.value	0x1eb
+	.byte	0xc
+	.long	0xe9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF26
+	.value	0x1f0
+	.byte	0xc
+	.long	0xe9
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF27
+	.value	0x1f5
+	.byte	0xc
+	.long	0xe9
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF28
+	.value	0x1fa
+	.byte	0xc
+	.long	0xe9
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF29
+	.value	0x1ff
+	.byte	0xc
+	.long	0xe9
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF30
+	.value	0x204
+	.byte	0xc
+	.long	0xe9
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF31
+	.value	0x209
+	.byte	0xc
+	.long	0xe9
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF32
+	.value	0x20e
+	.byte	0xc
+	.long	0xe9
+	.byte	0x38
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF33
+	.byte	0x38
+	.value	0x26c
+	.long	0x221
+	.uleb128 0x3
+	.long	.LASF34
+	.value	0x272
+	.byte	0xd
+	.long	0x23a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF35
+	.value	0x277
+	.byte	0x9
+	.long	0x4d
+	.byte	0x8
+	.uleb128 0x15
+	.string	"fd"
+	.value	0x27c
+	.long	0x6b
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF36
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF37
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF38
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x15
+	.string	"eof"
+	.value	0x290
+	.long	0x6b
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF39
+	.value	0x295
+	.byte	0x7
+	.long	0x6b
+	.byte	0x34
+	.byte	0
+	.uleb128 0x21
+	.long	0xb3
+	.long	0x23a
+	.uleb128 0x4
+	.long	0x4d
+	.uleb128 0x4
+	.long	0xa2
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x221
+	.uleb128 0x16
+	.long	.LASF42
+	.long	0x46
+	.value	0x29b
+	.long	0x25b
+	.uleb128 0xc
+	.long	.LASF40
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF43
+	.long	0x46
+	.value	0x2b5
+	.long	0x283
+	.uleb128 0xc
+	.long	.LASF44
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF45
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF46
+	.byte	0x2
+	.uleb128 0xc
+	.long	.LASF47
+	.byte	0x3
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF48
+	.value	0x158
+	.byte	0x7
+	.value	0x2cf
+	.byte	0x8
+	.long	0x331
+	.uleb128 0x3
+	.long	.LASF49
+	.value	0x2d4
+	.byte	0x9
+	.long	0xa2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF50
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF51
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF52
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF53
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x23f
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF54
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF55
+	.value	0x2f2
+	.byte	0x18
+	.long	0x331
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF56
+	.value	0x2f7
+	.byte	0x18
+	.long	0x25b
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF57
+	.value	0x2fc
+	.byte	0x17
+	.long	0x336
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF58
+	.value	0x301
+	.byte	0x8
+	.long	0x33b
+	.byte	0x48
+	.uleb128 0x17
+	.long	.LASF59
+	.value	0x306
+	.byte	0x21
+	.long	0x399
+	.value	0x148
+	.uleb128 0x17
+	.long	.LASF60
+	.value	0x30b
+	.byte	0x17
+	.long	0x39e
+	.value	0x150
+	.byte	0
+	.uleb128 0x5
+	.long	0x1af
+	.uleb128 0x5
+	.long	0xf5
+	.uleb128 0x11
+	.long	0xa7
+	.long	0x34b
+	.uleb128 0x12
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF61
+	.byte	0x28
+	.value	0x764
+	.long	0x399
+	.uleb128 0x3
+	.long	.LASF62
+	.value	0x769
+	.byte	0xb
+	.long	0x3aa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF63
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF64
+	.value	0x774
+	.byte	0xd
+	.long	0x3af
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF50
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF65
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x34b
+	.uleb128 0x5
+	.long	0x13a
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF66
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x5
+	.long	0xe9
+	.uleb128 0x5
+	.long	0x283
+	.uleb128 0xd
+	.long	.LASF70
+	.byte	0x7
+	.value	0x23a
+	.byte	0x6
+	.long	0x3cc
+	.uleb128 0x4
+	.long	0x39e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x7
+	.value	0x62b
+	.byte	0xd
+	.long	0x133
+	.long	0x3e3
+	.uleb128 0x4
+	.long	0xe4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF68
+	.byte	0x7
+	.value	0x620
+	.byte	0x7
+	.long	0xa2
+	.long	0x3fa
+	.uleb128 0x4
+	.long	0x133
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF69
+	.byte	0x7
+	.value	0x5ed
+	.byte	0x7
+	.long	0xa2
+	.long	0x411
+	.uleb128 0x4
+	.long	0x6b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF71
+	.byte	0x7
+	.value	0x232
+	.byte	0x6
+	.long	0x424
+	.uleb128 0x4
+	.long	0x72
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF108
+	.byte	0x7
+	.value	0x23f
+	.byte	0x6
+	.uleb128 0x7
+	.long	.LASF72
+	.byte	0x8
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0x444
+	.uleb128 0x4
+	.long	0xe4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF73
+	.byte	0x4
+	.value	0x164
+	.byte	0xc
+	.long	0x6b
+	.long	0x45c
+	.uleb128 0x4
+	.long	0xe4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF74
+	.byte	0x40
+	.byte	0xc
+	.long	0x6b
+	.long	0x47b
+	.uleb128 0x4
+	.long	0xde
+	.uleb128 0x4
+	.long	0xde
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF109
+	.byte	0x7
+	.value	0x22a
+	.byte	0x5
+	.long	0x6b
+	.uleb128 0x7
+	.long	.LASF75
+	.byte	0x7
+	.value	0x583
+	.byte	0x5
+	.long	0x6b
+	.long	0x4a4
+	.uleb128 0x4
+	.long	0x3b4
+	.uleb128 0x4
+	.long	0xd2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF76
+	.byte	0x7
+	.value	0x353
+	.byte	0x19
+	.long	0x3b4
+	.long	0x4bb
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF77
+	.byte	0x7
+	.value	0x4b7
+	.byte	0x5
+	.long	0x6b
+	.long	0x4d7
+	.uleb128 0x4
+	.long	0x3b4
+	.uleb128 0x4
+	.long	0x4d7
+	.byte	0
+	.uleb128 0x5
+	.long	0xc6
+	.uleb128 0xd
+	.long	.LASF78
+	.byte	0x7
+	.value	0x403
+	.byte	0x6
+	.long	0x4ef
+	.uleb128 0x4
+	.long	0x3b4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF79
+	.byte	0x9
+	.value	0x238
+	.byte	0xd
+	.long	0x502
+	.uleb128 0x4
+	.long	0x4d
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF80
+	.byte	0x7
+	.value	0x4a4
+	.byte	0x5
+	.long	0x6b
+	.long	0x51e
+	.uleb128 0x4
+	.long	0x3b4
+	.uleb128 0x4
+	.long	0x51e
+	.byte	0
+	.uleb128 0x5
+	.long	0x3a3
+	.uleb128 0xd
+	.long	.LASF81
+	.byte	0x7
+	.value	0x40b
+	.byte	0x6
+	.long	0x536
+	.uleb128 0x4
+	.long	0x3b4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF82
+	.byte	0x7
+	.value	0x425
+	.byte	0x7
+	.long	0xa2
+	.long	0x557
+	.uleb128 0x4
+	.long	0x3b4
+	.uleb128 0x4
+	.long	0xae
+	.uleb128 0x4
+	.long	0xae
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF83
+	.byte	0x7
+	.value	0x3ae
+	.byte	0x6
+	.long	0x56f
+	.uleb128 0x4
+	.long	0x3b4
+	.uleb128 0x4
+	.long	0x39e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF84
+	.byte	0x7
+	.value	0x317
+	.byte	0x19
+	.long	0x3b4
+	.long	0x586
+	.uleb128 0x4
+	.long	0xa2
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF85
+	.byte	0x3d
+	.byte	0xe
+	.long	0x4d
+	.long	0x5a5
+	.uleb128 0x4
+	.long	0x4d
+	.uleb128 0x4
+	.long	0x6b
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF86
+	.byte	0x75
+	.long	0x6b
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5e0
+	.uleb128 0x8
+	.quad	.LVL73
+	.long	0x7bf
+	.uleb128 0x8
+	.quad	.LVL74
+	.long	0x5e0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF87
+	.byte	0x53
+	.long	0x6b
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7bf
+	.uleb128 0x9
+	.long	.LASF90
+	.byte	0x56
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xa
+	.long	.LASF88
+	.byte	0x57
+	.byte	0x16
+	.long	0x13a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0xa
+	.long	.LASF89
+	.byte	0x58
+	.byte	0x16
+	.long	0x13a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x9
+	.long	.LASF91
+	.byte	0x65
+	.byte	0xc
+	.long	0xe9
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x2
+	.quad	.LVL49
+	.long	0xc5e
+	.long	0x663
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL50
+	.long	0x424
+	.uleb128 0x2
+	.quad	.LVL51
+	.long	0x411
+	.long	0x687
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL52
+	.long	0x3fa
+	.long	0x69f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL53
+	.long	0x4ef
+	.uleb128 0x8
+	.quad	.LVL54
+	.long	0x3e3
+	.uleb128 0x8
+	.quad	.LVL55
+	.long	0x4ef
+	.uleb128 0x2
+	.quad	.LVL56
+	.long	0x3cc
+	.long	0x6e5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL57
+	.long	0x3b9
+	.long	0x6fe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL58
+	.long	0x411
+	.long	0x715
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL59
+	.long	0x3fa
+	.long	0x72d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2b
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL60
+	.long	0x4ef
+	.uleb128 0x2
+	.quad	.LVL61
+	.long	0x3b9
+	.long	0x753
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL62
+	.long	0x424
+	.uleb128 0x8
+	.quad	.LVL63
+	.long	0x47b
+	.uleb128 0x2
+	.quad	.LVL66
+	.long	0x444
+	.long	0x78c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL68
+	.long	0xc67
+	.long	0x7a3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL72
+	.long	0x444
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF92
+	.byte	0x9
+	.long	0x6b
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc2e
+	.uleb128 0x9
+	.long	.LASF90
+	.byte	0xc
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xa
+	.long	.LASF60
+	.byte	0xd
+	.byte	0x16
+	.long	0x13a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0xa
+	.long	.LASF49
+	.byte	0x10
+	.byte	0x8
+	.long	0xc2e
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 48
+	.uleb128 0x9
+	.long	.LASF93
+	.byte	0x11
+	.byte	0x1b
+	.long	0x3b4
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x9
+	.long	.LASF94
+	.byte	0x13
+	.byte	0x9
+	.long	0xa2
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x9
+	.long	.LASF95
+	.byte	0x15
+	.byte	0x9
+	.long	0xa2
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xa
+	.long	.LASF96
+	.byte	0x17
+	.byte	0xa
+	.long	0x3a3
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.uleb128 0xa
+	.long	.LASF97
+	.byte	0x1d
+	.byte	0x8
+	.long	0xc3e
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.uleb128 0xa
+	.long	.LASF98
+	.byte	0x1e
+	.byte	0xb
+	.long	0xc4e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x9
+	.long	.LASF99
+	.byte	0x21
+	.byte	0x7
+	.long	0x6b
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x9
+	.long	.LASF100
+	.byte	0x28
+	.byte	0x1b
+	.long	0x3b4
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x19
+	.long	.LLRL6
+	.long	0x8e5
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0x22
+	.long	0x6b
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x2
+	.quad	.LVL20
+	.long	0x4bb
+	.long	0x8d0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL23
+	.long	0x523
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.long	0x925
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0x2a
+	.long	0x6b
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xe
+	.quad	.LVL29
+	.long	0x488
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LLRL9
+	.long	0x98e
+	.uleb128 0xa
+	.long	.LASF101
+	.byte	0x30
+	.byte	0x18
+	.long	0x13a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0x14
+	.quad	.LVL44
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL45
+	.long	0xc5e
+	.long	0x967
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL47
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xe
+	.quad	.LVL48
+	.long	0xc5e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL0
+	.long	0xc5e
+	.long	0x9ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL1
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.quad	.LVL2
+	.long	0x56f
+	.long	0x9d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 -264
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL4
+	.long	0x557
+	.long	0x9f0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL5
+	.long	0x536
+	.long	0xa14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL7
+	.long	0x523
+	.long	0xa2c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL8
+	.long	0x536
+	.long	0xa50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL10
+	.long	0x523
+	.long	0xa68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL11
+	.long	0x502
+	.long	0xa87
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -248
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL12
+	.long	0x4ef
+	.long	0xa9f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL13
+	.long	0x4ef
+	.long	0xab7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL14
+	.long	0x4dc
+	.long	0xacf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL15
+	.long	0x56f
+	.long	0xae8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -236
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL17
+	.long	0x557
+	.long	0xb06
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL24
+	.long	0x4dc
+	.long	0xb1e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL25
+	.long	0x4a4
+	.long	0xb35
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL27
+	.long	0x557
+	.long	0xb54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -176
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL30
+	.long	0x4dc
+	.long	0xb6c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL31
+	.long	0x47b
+	.uleb128 0x2
+	.quad	.LVL32
+	.long	0x444
+	.long	0xb98
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL35
+	.long	0x42d
+	.long	0xbb1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL36
+	.long	0x444
+	.long	0xbd6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL38
+	.long	0xc67
+	.long	0xbed
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL42
+	.long	0x444
+	.long	0xc12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL46
+	.long	0xc5e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xa7
+	.long	0xc3e
+	.uleb128 0x12
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0x11
+	.long	0xa7
+	.long	0xc4e
+	.uleb128 0x12
+	.long	0x3f
+	.byte	0xb
+	.byte	0
+	.uleb128 0x11
+	.long	0xc6
+	.long	0xc5e
+	.uleb128 0x12
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF102
+	.long	.LASF104
+	.uleb128 0x1b
+	.long	.LASF103
+	.long	.LASF105
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS10:
+	.uleb128 .LVU139
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU160
+	.uleb128 .LVU166
+	.uleb128 .LVU173
+	.uleb128 .LVU179
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU7
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU21
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU69
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-1-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU26
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU54
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU31
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU56
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-1-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU51
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU106
+	.uleb128 .LVU107
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU69
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU94
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU53
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU63
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0xb
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0xb
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF89:
+	.string	"disabled"
+.LASF51:
+	.string	"position"
+.LASF104:
+	.string	"__builtin_puts"
+.LASF100:
+	.string	"builder"
+.LASF20:
+	.string	"block_size"
+.LASF47:
+	.string	"ST_STRING_INLINE"
+.LASF40:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF18:
+	.string	"uint64_t"
+.LASF67:
+	.string	"stold"
+.LASF7:
+	.string	"short int"
+.LASF8:
+	.string	"size_t"
+.LASF78:
+	.string	"st_destroy"
+.LASF62:
+	.string	"positions"
+.LASF103:
+	.string	"putchar"
+.LASF83:
+	.string	"st_attach_stats"
+.LASF60:
+	.string	"stats"
+.LASF76:
+	.string	"st_create_empty"
+.LASF26:
+	.string	"tokens_extracted"
+.LASF14:
+	.string	"ssize_t"
+.LASF16:
+	.string	"int64_t"
+.LASF96:
+	.string	"value"
+.LASF31:
+	.string	"conversions"
+.LASF19:
+	.string	"head"
+.LASF95:
+	.string	"second"
+.LASF46:
+	.string	"ST_STRING_MAPPED"
+.LASF23:
+	.string	"StringArena"
+.LASF84:
+	.string	"st_create"
+.LASF79:
+	.string	"free"
+.LASF92:
+	.string	"run_st_attach_stats_unit_tests"
+.LASF65:
+	.string	"hint"
+.LASF50:
+	.string	"length"
+.LASF74:
+	.string	"memcmp"
+.LASF15:
+	.string	"long long int"
+.LASF12:
+	.string	"__ssize_t"
+.LASF85:
+	.string	"memset"
+.LASF10:
+	.string	"long int"
+.LASF9:
+	.string	"__int64_t"
+.LASF49:
+	.string	"string"
+.LASF93:
+	.string	"tokenizer"
+.LASF38:
+	.string	"offset"
+.LASF59:
+	.string	"structural_index"
+.LASF71:
+	.string	"st_stats_enable"
+.LASF35:
+	.string	"context"
+.LASF54:
+	.string	"max_increment"
+.LASF82:
+	.string	"st_sub_string"
+.LASF52:
+	.string	"incremental_factor"
+.LASF99:
+	.string	"rejected"
+.LASF44:
+	.string	"ST_STRING_BORROWED"
+.LASF42:
+	.string	"StringGrowthPolicy"
+.LASF97:
+	.string	"integers"
+.LASF28:
+	.string	"reallocations"
+.LASF22:
+	.string	"long double"
+.LASF4:
+	.string	"unsigned char"
+.LASF75:
+	.string	"st_append_int"
+.LASF68:
+	.string	"ldtos"
+.LASF34:
+	.string	"read"
+.LASF41:
+	.string	"ST_GROWTH_LINEAR"
+.LASF37:
+	.string	"capacity"
+.LASF17:
+	.string	"long long unsigned int"
+.LASF69:
+	.string	"itos"
+.LASF3:
+	.string	"unsigned int"
+.LASF56:
+	.string	"ownership"
+.LASF102:
+	.string	"puts"
+.LASF86:
+	.string	"run_string_stats_tests"
+.LASF5:
+	.string	"short unsigned int"
+.LASF13:
+	.string	"char"
+.LASF77:
+	.string	"st_extract_int64"
+.LASF72:
+	.string	"strlen"
+.LASF57:
+	.string	"arena"
+.LASF80:
+	.string	"st_extract_double_to"
+.LASF81:
+	.string	"st_next_token"
+.LASF105:
+	.string	"__builtin_putchar"
+.LASF11:
+	.string	"__uint64_t"
+.LASF91:
+	.string	"expected"
+.LASF24:
+	.string	"StringStats"
+.LASF2:
+	.string	"long unsigned int"
+.LASF58:
+	.string	"inline_buffer"
+.LASF66:
+	.string	"double"
+.LASF61:
+	.string	"StringStructuralIndex"
+.LASF106:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF45:
+	.string	"ST_STRING_OWNED"
+.LASF87:
+	.string	"run_st_stats_snapshot_unit_tests"
+.LASF30:
+	.string	"bytes_copied"
+.LASF64:
+	.string	"in_string"
+.LASF63:
+	.string	"count"
+.LASF98:
+	.string	"integer_values"
+.LASF36:
+	.string	"chunk_size"
+.LASF88:
+	.string	"enabled"
+.LASF6:
+	.string	"signed char"
+.LASF43:
+	.string	"StringOwnership"
+.LASF32:
+	.string	"conversion_ns"
+.LASF21:
+	.string	"used"
+.LASF109:
+	.string	"st_stats_available"
+.LASF108:
+	.string	"st_stats_reset"
+.LASF39:
+	.string	"error"
+.LASF90:
+	.string	"exit_status"
+.LASF48:
+	.string	"StringTokenizer"
+.LASF73:
+	.string	"printf"
+.LASF25:
+	.string	"bytes_scanned"
+.LASF53:
+	.string	"growth_policy"
+.LASF70:
+	.string	"st_stats_snapshot"
+.LASF55:
+	.string	"stream"
+.LASF107:
+	.string	"StringArenaBlock"
+.LASF94:
+	.string	"first"
+.LASF33:
+	.string	"StringStream"
+.LASF101:
+	.string	"zero"
+.LASF29:
+	.string	"expansions"
+.LASF27:
+	.string	"allocations"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo/build/test"
+.LASF0:
+	.string	"/root/repo/tests/string_stats_unit_tests.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4626 @@
+	.file	"string_stream.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/src/string_stream.c"
+	.p2align 4
+	.type	string_stream_read_fd, @function
+string_stream_read_fd:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/src/string_stream.c"
+	.loc 1 20 80 view -0
+	.cfi_startproc
+	.loc 1 20 80 is_stmt 0 view .LVU1
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	jmp	.L3
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.loc 1 24 26 discriminator 1 view .LVU2
+	call	__errno_location@PLT
+.LVL2:
+	.loc 1 24 22 discriminator 1 view .LVU3
+	cmpl	$4, (%rax)
+	jne	.L1
+.LVL3:
+.L3:
+	.loc 1 21 3 is_stmt 1 discriminator 2 view .LVU4
+	.loc 1 22 3 discriminator 2 view .LVU5
+	.loc 1 23 5 discriminator 2 view .LVU6
+	.loc 1 23 13 is_stmt 0 discriminator 2 view .LVU7
+	movl	0(%r13), %edi
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	call	read@PLT
+.LVL4:
+	movq	%rax, %rbx
+.LVL5:
+	.loc 1 24 22 is_stmt 1 discriminator 2 view .LVU8
+	testq	%rax, %rax
+	js	.L7
+.LVL6:
+.L1:
+	.loc 1 26 1 is_stmt 0 view .LVU9
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL7:
+	.loc 1 26 1 view .LVU10
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL8:
+	.loc 1 26 1 view .LVU11
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL9:
+	.loc 1 26 1 view .LVU12
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL10:
+	.loc 1 26 1 view .LVU13
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	string_stream_read_fd, .-string_stream_read_fd
+	.p2align 4
+	.type	string_stream_read_file, @function
+string_stream_read_file:
+.LVL11:
+.LFB27:
+	.loc 1 41 82 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 42 3 view .LVU15
+	.loc 1 41 82 is_stmt 0 view .LVU16
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+.LVL12:
+	.loc 1 43 3 is_stmt 1 view .LVU17
+	.loc 1 43 18 is_stmt 0 view .LVU18
+	movq	%rbp, %rcx
+	.loc 1 41 82 view .LVU19
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rdi
+.LVL13:
+	.loc 1 43 18 view .LVU20
+	movl	$1, %esi
+.LVL14:
+	.loc 1 41 82 view .LVU21
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 43 18 view .LVU22
+	call	fread@PLT
+.LVL15:
+	.loc 1 43 18 view .LVU23
+	movq	%rax, %rbx
+.LVL16:
+	.loc 1 44 3 is_stmt 1 view .LVU24
+	.loc 1 44 6 is_stmt 0 view .LVU25
+	testq	%rax, %rax
+	je	.L9
+.LVL17:
+.L11:
+	.loc 1 47 3 is_stmt 1 view .LVU26
+	.loc 1 47 10 is_stmt 0 view .LVU27
+	movq	%rbx, %rax
+.L8:
+	.loc 1 48 1 view .LVU28
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL18:
+	.loc 1 48 1 view .LVU29
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL19:
+	.loc 1 48 1 view .LVU30
+	ret
+.LVL20:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.cfi_restore_state
+	.loc 1 44 21 discriminator 1 view .LVU31
+	movq	%rbp, %rdi
+	call	ferror@PLT
+.LVL21:
+	.loc 1 44 18 discriminator 1 view .LVU32
+	testl	%eax, %eax
+	je	.L11
+	.loc 1 45 12 view .LVU33
+	movq	$-1, %rax
+	jmp	.L8
+	.cfi_endproc
+.LFE27:
+	.size	string_stream_read_file, .-string_stream_read_file
+	.p2align 4
+	.globl	st_ensure
+	.type	st_ensure, @function
+st_ensure:
+.LVL22:
+.LFB32:
+	.loc 1 136 69 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 137 3 view .LVU35
+	.loc 1 136 69 is_stmt 0 view .LVU36
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 138 33 view .LVU37
+	movq	16(%rdi), %rdx
+	.loc 1 137 24 view .LVU38
+	movq	48(%rdi), %r13
+.LVL23:
+	.loc 1 138 3 is_stmt 1 view .LVU39
+	.loc 1 138 63 is_stmt 0 view .LVU40
+	movq	8(%rdi), %rax
+	.loc 1 138 44 view .LVU41
+	leaq	(%rsi,%rdx), %rbx
+	.loc 1 138 6 view .LVU42
+	testq	%r13, %r13
+	je	.L17
+	.loc 1 138 21 discriminator 1 view .LVU43
+	cmpq	%rbx, %rax
+	jnb	.L17
+	.loc 1 141 3 is_stmt 1 view .LVU44
+	.loc 1 141 6 is_stmt 0 view .LVU45
+	movl	48(%r13), %ecx
+	testl	%ecx, %ecx
+	jne	.L23
+	.loc 1 145 10 view .LVU46
+	cmpq	%rax, %rdx
+	cmova	%rax, %rdx
+	movq	%rdi, %r12
+	.loc 1 145 3 is_stmt 1 view .LVU47
+	.loc 1 145 10 is_stmt 0 view .LVU48
+	movq	%rdx, %r14
+.LVL24:
+	.loc 1 146 3 is_stmt 1 view .LVU49
+	.loc 1 146 6 is_stmt 0 view .LVU50
+	testq	%rdx, %rdx
+	jne	.L38
+	.loc 1 154 3 is_stmt 1 view .LVU51
+.LVL25:
+	.loc 1 155 3 view .LVU52
+	.loc 1 155 35 is_stmt 0 view .LVU53
+	movq	32(%r13), %rbp
+	.loc 1 155 14 view .LVU54
+	leaq	1(%rbx), %rdx
+.LVL26:
+.LBB2:
+	.loc 1 160 45 view .LVU55
+	movq	(%rdi), %rdi
+.LVL27:
+	.loc 1 160 45 view .LVU56
+.LBE2:
+	.loc 1 155 6 view .LVU57
+	cmpq	%rdx, %rbp
+	jnb	.L26
+.LVL28:
+.L28:
+.LBB3:
+	.loc 1 156 5 is_stmt 1 view .LVU58
+	.loc 1 157 5 view .LVU59
+	.loc 1 156 12 is_stmt 0 view .LVU60
+	addq	%rbp, %rbp
+.LVL29:
+	.loc 1 156 12 view .LVU61
+	cmpq	%rdx, %rbp
+	cmovb	%rdx, %rbp
+.LVL30:
+	.loc 1 160 5 is_stmt 1 view .LVU62
+	.loc 1 160 28 is_stmt 0 view .LVU63
+	movq	%rbp, %rsi
+	call	realloc@PLT
+.LVL31:
+	movq	%rax, %rdi
+.LVL32:
+	.loc 1 161 5 is_stmt 1 view .LVU64
+	.loc 1 161 10 view .LVU65
+	.loc 1 161 8 view .LVU66
+	.loc 1 162 5 view .LVU67
+	.loc 1 162 8 is_stmt 0 view .LVU68
+	testq	%rax, %rax
+	je	.L23
+	.loc 1 165 5 is_stmt 1 view .LVU69
+	.loc 1 165 23 is_stmt 0 view .LVU70
+	movq	%rax, (%r12)
+	.loc 1 166 5 is_stmt 1 view .LVU71
+	.loc 1 166 22 is_stmt 0 view .LVU72
+	movq	%rbp, 32(%r13)
+.LVL33:
+.L22:
+	.loc 1 166 22 view .LVU73
+.LBE3:
+	.loc 1 169 28 is_stmt 1 view .LVU74
+	.loc 1 169 19 is_stmt 0 view .LVU75
+	movq	8(%r12), %rax
+	.loc 1 169 28 view .LVU76
+	cmpq	%rbx, %rax
+	jb	.L26
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	.loc 1 179 3 is_stmt 1 view .LVU77
+	.loc 1 179 40 is_stmt 0 view .LVU78
+	movb	$0, (%rdi,%rax)
+	.loc 1 180 3 is_stmt 1 view .LVU79
+	.loc 1 180 28 is_stmt 0 view .LVU80
+	xorl	%eax, %eax
+	cmpq	%rbx, 8(%r12)
+	setnb	%al
+.L39:
+	.loc 1 181 1 view .LVU81
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL34:
+	.loc 1 181 1 view .LVU82
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL35:
+	.loc 1 181 1 view .LVU83
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL36:
+	.loc 1 181 1 view .LVU84
+	ret
+.LVL37:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.cfi_restore_state
+.LBB4:
+	.loc 1 176 5 is_stmt 1 view .LVU85
+	.loc 1 176 23 is_stmt 0 view .LVU86
+	addq	8(%r12), %rax
+.LVL38:
+	.loc 1 176 23 view .LVU87
+	movq	%rax, 8(%r12)
+.LBE4:
+	.loc 1 169 28 is_stmt 1 view .LVU88
+	.loc 1 179 12 is_stmt 0 view .LVU89
+	movq	(%r12), %rdi
+	.loc 1 169 28 view .LVU90
+	cmpq	%rbx, %rax
+	jnb	.L24
+.LBB5:
+	.loc 1 170 96 view .LVU91
+	movq	32(%r13), %rbp
+.LVL39:
+.L26:
+	.loc 1 170 5 is_stmt 1 view .LVU92
+	.loc 1 170 21 is_stmt 0 view .LVU93
+	subq	%rax, %rbp
+	leaq	(%rdi,%rax), %rsi
+	movq	8(%r13), %rdi
+	leaq	-1(%rbp), %rdx
+	call	*0(%r13)
+.LVL40:
+	.loc 1 171 5 is_stmt 1 view .LVU94
+	.loc 1 171 8 is_stmt 0 view .LVU95
+	testq	%rax, %rax
+	jg	.L25
+	.loc 1 172 7 is_stmt 1 view .LVU96
+	.loc 1 172 29 is_stmt 0 view .LVU97
+	shrq	$63, %rax
+.LVL41:
+	.loc 1 172 21 view .LVU98
+	movl	%eax, 52(%r13)
+	.loc 1 173 7 is_stmt 1 view .LVU99
+.LBE5:
+	.loc 1 179 12 is_stmt 0 view .LVU100
+	movq	(%r12), %rdi
+.LBB6:
+	.loc 1 176 14 view .LVU101
+	movq	8(%r12), %rax
+	.loc 1 173 19 view .LVU102
+	movl	$1, 48(%r13)
+	.loc 1 174 7 is_stmt 1 view .LVU103
+.LBE6:
+	.loc 1 179 3 view .LVU104
+	.loc 1 179 40 is_stmt 0 view .LVU105
+	movb	$0, (%rdi,%rax)
+	.loc 1 180 3 is_stmt 1 view .LVU106
+	.loc 1 180 28 is_stmt 0 view .LVU107
+	xorl	%eax, %eax
+	cmpq	%rbx, 8(%r12)
+	setnb	%al
+	jmp	.L39
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 139 5 is_stmt 1 view .LVU108
+	.loc 1 139 39 is_stmt 0 view .LVU109
+	cmpq	%rbx, %rax
+	.loc 1 181 1 view .LVU110
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	.loc 1 139 39 view .LVU111
+	setnb	%al
+	.loc 1 181 1 view .LVU112
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL43:
+	.loc 1 139 39 view .LVU113
+	movzbl	%al, %eax
+	.loc 1 181 1 view .LVU114
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL44:
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	.cfi_restore_state
+	.loc 1 181 1 view .LVU115
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL45:
+	.loc 1 142 12 view .LVU116
+	xorl	%eax, %eax
+	.loc 1 181 1 view .LVU117
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.cfi_restore_state
+	.loc 1 147 23 view .LVU118
+	subq	%rdx, %rax
+.LBB7:
+	.loc 1 160 45 view .LVU119
+	movq	(%rdi), %rdi
+.LVL47:
+	.loc 1 160 45 view .LVU120
+.LBE7:
+	.loc 1 147 5 is_stmt 1 view .LVU121
+	.loc 1 147 23 is_stmt 0 view .LVU122
+	movq	%rax, 8(%r12)
+	.loc 1 148 5 is_stmt 1 view .LVU123
+	movq	%rsi, %rbp
+	.loc 1 147 23 is_stmt 0 view .LVU124
+	movq	%rax, %rdx
+.LVL48:
+	.loc 1 148 50 view .LVU125
+	leaq	(%rdi,%r14), %rsi
+.LVL49:
+	.loc 1 148 5 view .LVU126
+	call	memmove@PLT
+.LVL50:
+	.loc 1 149 5 is_stmt 1 view .LVU127
+	.loc 1 149 10 view .LVU128
+	.loc 1 149 8 view .LVU129
+	.loc 1 150 5 view .LVU130
+	.loc 1 151 25 is_stmt 0 view .LVU131
+	movq	16(%r12), %rbx
+	.loc 1 150 20 view .LVU132
+	addq	%r14, 40(%r13)
+	.loc 1 151 5 is_stmt 1 view .LVU133
+	.loc 1 151 25 is_stmt 0 view .LVU134
+	subq	%r14, %rbx
+	movq	%rbx, 16(%r12)
+	.loc 1 154 10 view .LVU135
+	addq	%rbp, %rbx
+	.loc 1 154 3 is_stmt 1 view .LVU136
+.LVL51:
+	.loc 1 155 3 view .LVU137
+	.loc 1 155 35 is_stmt 0 view .LVU138
+	movq	32(%r13), %rbp
+.LVL52:
+	.loc 1 155 14 view .LVU139
+	leaq	1(%rbx), %rdx
+.LBB8:
+	.loc 1 160 45 view .LVU140
+	movq	(%r12), %rdi
+.LBE8:
+	.loc 1 155 6 view .LVU141
+	cmpq	%rdx, %rbp
+	jnb	.L22
+	jmp	.L28
+	.cfi_endproc
+.LFE32:
+	.size	st_ensure, .-st_ensure
+	.p2align 4
+	.globl	st_create_from_callback
+	.type	st_create_from_callback, @function
+st_create_from_callback:
+.LVL53:
+.LFB29:
+	.loc 1 97 148 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 98 3 view .LVU143
+.LBB11:
+.LBI11:
+	.loc 1 63 32 view .LVU144
+.LBB12:
+	.loc 1 64 3 view .LVU145
+.LBE12:
+.LBE11:
+	.loc 1 97 148 is_stmt 0 view .LVU146
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+.LBB16:
+.LBB13:
+	.loc 1 64 6 view .LVU147
+	testq	%rdi, %rdi
+	je	.L46
+	movq	%rdx, %r12
+	testq	%rdx, %rdx
+	je	.L46
+	movq	%rdi, %r13
+	.loc 1 67 65 view .LVU148
+	movl	$344, %edi
+.LVL54:
+	.loc 1 67 65 view .LVU149
+	movq	%rsi, %r15
+	.loc 1 67 3 is_stmt 1 view .LVU150
+	.loc 1 70 26 is_stmt 0 view .LVU151
+	leaq	1(%r12), %r14
+	.loc 1 67 65 view .LVU152
+	call	malloc@PLT
+.LVL55:
+	.loc 1 68 56 view .LVU153
+	movl	$56, %edi
+	.loc 1 67 65 view .LVU154
+	movq	%rax, %rbp
+.LVL56:
+	.loc 1 68 3 is_stmt 1 view .LVU155
+	.loc 1 68 56 is_stmt 0 view .LVU156
+	call	malloc@PLT
+.LVL57:
+	.loc 1 70 26 view .LVU157
+	movq	%r14, %rdi
+	.loc 1 68 56 view .LVU158
+	movq	%rax, %rbx
+.LVL58:
+	.loc 1 70 3 is_stmt 1 view .LVU159
+	.loc 1 70 26 is_stmt 0 view .LVU160
+	call	malloc@PLT
+.LVL59:
+	.loc 1 72 17 view .LVU161
+	testq	%rbp, %rbp
+	.loc 1 70 26 view .LVU162
+	movq	%rax, %rsi
+.LVL60:
+	.loc 1 71 3 is_stmt 1 view .LVU163
+	.loc 1 71 8 view .LVU164
+	.loc 1 71 6 view .LVU165
+	.loc 1 72 3 view .LVU166
+	.loc 1 72 17 is_stmt 0 view .LVU167
+	sete	%al
+.LVL61:
+	.loc 1 72 34 view .LVU168
+	testq	%rbx, %rbx
+	sete	%dl
+	.loc 1 72 42 view .LVU169
+	orb	%dl, %al
+	jne	.L47
+	testq	%rsi, %rsi
+	je	.L47
+	.loc 1 79 3 is_stmt 1 view .LVU170
+	.loc 1 88 13 is_stmt 0 view .LVU171
+	movb	$0, (%rsi)
+	.loc 1 79 16 view .LVU172
+	movq	%r13, (%rbx)
+	.loc 1 80 3 is_stmt 1 view .LVU173
+	.loc 1 80 19 is_stmt 0 view .LVU174
+	movq	%r15, 8(%rbx)
+	.loc 1 81 3 is_stmt 1 view .LVU175
+	.loc 1 81 14 is_stmt 0 view .LVU176
+	movl	$-1, 16(%rbx)
+	.loc 1 82 3 is_stmt 1 view .LVU177
+	.loc 1 82 22 is_stmt 0 view .LVU178
+	movq	%r12, 24(%rbx)
+	.loc 1 83 3 is_stmt 1 view .LVU179
+	.loc 1 83 20 is_stmt 0 view .LVU180
+	movq	%r14, 32(%rbx)
+	.loc 1 84 3 is_stmt 1 view .LVU181
+	.loc 1 85 3 view .LVU182
+	.loc 1 86 3 view .LVU183
+	.loc 1 84 18 is_stmt 0 view .LVU184
+	movq	$0, 40(%rbx)
+	.loc 1 85 15 view .LVU185
+	movq	$0, 48(%rbx)
+	.loc 1 88 3 is_stmt 1 view .LVU186
+	.loc 1 89 3 view .LVU187
+	movq	%rbp, %rdi
+	xorl	%edx, %edx
+	call	st_init@PLT
+.LVL62:
+	.loc 1 90 3 view .LVU188
+	.loc 1 90 21 is_stmt 0 view .LVU189
+	movq	%rbx, 48(%rbp)
+	.loc 1 91 3 is_stmt 1 view .LVU190
+.LVL63:
+	.loc 1 91 3 is_stmt 0 view .LVU191
+.LBE13:
+.LBE16:
+	.loc 1 99 3 is_stmt 1 view .LVU192
+	.loc 1 101 5 view .LVU193
+	movl	$1, %esi
+	movq	%rbp, %rdi
+	call	st_ensure@PLT
+.LVL64:
+	.loc 1 103 3 view .LVU194
+.L40:
+	.loc 1 104 1 is_stmt 0 view .LVU195
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	movq	%rbp, %rax
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL65:
+.L47:
+	.cfi_restore_state
+.LBB17:
+.LBB14:
+	.loc 1 73 5 view .LVU196
+	movq	%rbp, %rdi
+	movq	%rsi, 8(%rsp)
+	.loc 1 73 5 is_stmt 1 view .LVU197
+	call	free@PLT
+.LVL66:
+	.loc 1 74 5 view .LVU198
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL67:
+	.loc 1 75 5 view .LVU199
+	movq	8(%rsp), %rdi
+	call	free@PLT
+.LVL68:
+	.loc 1 76 5 view .LVU200
+	.loc 1 76 5 is_stmt 0 view .LVU201
+.LBE14:
+.LBE17:
+	.loc 1 99 3 is_stmt 1 view .LVU202
+	.p2align 4,,10
+	.p2align 3
+.L46:
+.LBB18:
+.LBB15:
+	.loc 1 65 11 is_stmt 0 view .LVU203
+	xorl	%ebp, %ebp
+	jmp	.L40
+.LBE15:
+.LBE18:
+	.cfi_endproc
+.LFE29:
+	.size	st_create_from_callback, .-st_create_from_callback
+	.p2align 4
+	.globl	st_create_from_file
+	.type	st_create_from_file, @function
+st_create_from_file:
+.LVL69:
+.LFB31:
+	.loc 1 126 82 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 127 3 view .LVU205
+	.loc 1 126 82 is_stmt 0 view .LVU206
+	movq	%rsi, %rdx
+	.loc 1 127 6 view .LVU207
+	testq	%rdi, %rdi
+	je	.L50
+	.loc 1 130 3 is_stmt 1 view .LVU208
+	.loc 1 130 10 is_stmt 0 view .LVU209
+	movq	%rdi, %rsi
+.LVL70:
+	.loc 1 130 10 view .LVU210
+	leaq	string_stream_read_file(%rip), %rdi
+.LVL71:
+	.loc 1 130 10 view .LVU211
+	jmp	st_create_from_callback@PLT
+.LVL72:
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	.loc 1 131 1 view .LVU212
+	xorl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	st_create_from_file, .-st_create_from_file
+	.p2align 4
+	.globl	st_create_from_fd
+	.type	st_create_from_fd, @function
+st_create_from_fd:
+.LVL73:
+.LFB30:
+	.loc 1 109 82 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 110 3 view .LVU214
+	.loc 1 113 3 view .LVU215
+.LBB21:
+.LBI21:
+	.loc 1 63 32 view .LVU216
+.LBB22:
+	.loc 1 64 3 view .LVU217
+.LBE22:
+.LBE21:
+	.loc 1 109 82 is_stmt 0 view .LVU218
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+.LBB27:
+.LBB23:
+	.loc 1 64 6 view .LVU219
+	testq	%rsi, %rsi
+	je	.L52
+	movl	%edi, %r13d
+	testl	%edi, %edi
+	js	.L52
+	movq	%rsi, %rbp
+	.loc 1 67 3 is_stmt 1 view .LVU220
+	.loc 1 67 65 is_stmt 0 view .LVU221
+	movl	$344, %edi
+.LVL74:
+	.loc 1 67 65 view .LVU222
+	call	malloc@PLT
+.LVL75:
+	.loc 1 70 26 view .LVU223
+	leaq	1(%rbp), %r14
+	.loc 1 68 56 view .LVU224
+	movl	$56, %edi
+	.loc 1 67 65 view .LVU225
+	movq	%rax, %r12
+.LVL76:
+	.loc 1 68 3 is_stmt 1 view .LVU226
+	.loc 1 68 56 is_stmt 0 view .LVU227
+	call	malloc@PLT
+.LVL77:
+	.loc 1 70 26 view .LVU228
+	movq	%r14, %rdi
+	.loc 1 68 56 view .LVU229
+	movq	%rax, %rbx
+.LVL78:
+	.loc 1 70 3 is_stmt 1 view .LVU230
+	.loc 1 70 26 is_stmt 0 view .LVU231
+	call	malloc@PLT
+.LVL79:
+	.loc 1 72 17 view .LVU232
+	testq	%r12, %r12
+	.loc 1 70 26 view .LVU233
+	movq	%rax, %rsi
+.LVL80:
+	.loc 1 71 3 is_stmt 1 view .LVU234
+	.loc 1 71 8 view .LVU235
+	.loc 1 71 6 view .LVU236
+	.loc 1 72 3 view .LVU237
+	.loc 1 72 17 is_stmt 0 view .LVU238
+	sete	%al
+.LVL81:
+	.loc 1 72 34 view .LVU239
+	testq	%rbx, %rbx
+	sete	%dl
+	.loc 1 72 42 view .LVU240
+	orb	%dl, %al
+	jne	.L56
+	testq	%rsi, %rsi
+	je	.L56
+	.loc 1 79 3 is_stmt 1 view .LVU241
+	.loc 1 79 16 is_stmt 0 view .LVU242
+	leaq	string_stream_read_fd(%rip), %rax
+	movq	%rax, (%rbx)
+	.loc 1 80 3 is_stmt 1 view .LVU243
+	.loc 1 88 13 is_stmt 0 view .LVU244
+	movb	$0, (%rsi)
+	.loc 1 80 19 view .LVU245
+	movq	$0, 8(%rbx)
+	.loc 1 81 3 is_stmt 1 view .LVU246
+	.loc 1 81 14 is_stmt 0 view .LVU247
+	movl	$-1, 16(%rbx)
+	.loc 1 82 3 is_stmt 1 view .LVU248
+	.loc 1 82 22 is_stmt 0 view .LVU249
+	movq	%rbp, 24(%rbx)
+	.loc 1 83 3 is_stmt 1 view .LVU250
+	.loc 1 83 20 is_stmt 0 view .LVU251
+	movq	%r14, 32(%rbx)
+	.loc 1 84 3 is_stmt 1 view .LVU252
+	.loc 1 85 3 view .LVU253
+	.loc 1 86 3 view .LVU254
+	.loc 1 84 18 is_stmt 0 view .LVU255
+	movq	$0, 40(%rbx)
+	.loc 1 85 15 view .LVU256
+	movq	$0, 48(%rbx)
+	.loc 1 88 3 is_stmt 1 view .LVU257
+	.loc 1 89 3 view .LVU258
+	movq	%r12, %rdi
+	xorl	%edx, %edx
+	call	st_init@PLT
+.LVL82:
+	.loc 1 90 3 view .LVU259
+.LBE23:
+.LBE27:
+	.loc 1 117 34 is_stmt 0 view .LVU260
+	leaq	16(%rbx), %rax
+.LBB28:
+.LBB24:
+	.loc 1 90 21 view .LVU261
+	movq	%rbx, 48(%r12)
+	.loc 1 91 3 is_stmt 1 view .LVU262
+.LVL83:
+	.loc 1 91 3 is_stmt 0 view .LVU263
+.LBE24:
+.LBE28:
+	.loc 1 114 3 is_stmt 1 view .LVU264
+	.loc 1 116 5 view .LVU265
+	.loc 1 116 27 is_stmt 0 view .LVU266
+	movl	%r13d, 16(%rbx)
+	.loc 1 117 5 is_stmt 1 view .LVU267
+	.loc 1 117 34 is_stmt 0 view .LVU268
+	movq	%rax, 8(%rbx)
+	.loc 1 118 5 is_stmt 1 view .LVU269
+	movl	$1, %esi
+	movq	%r12, %rdi
+	call	st_ensure@PLT
+.LVL84:
+.L51:
+	.loc 1 121 1 is_stmt 0 view .LVU270
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	movq	%r12, %rax
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL85:
+.L56:
+	.cfi_restore_state
+.LBB29:
+.LBB25:
+	.loc 1 73 5 view .LVU271
+	movq	%r12, %rdi
+	movq	%rsi, 8(%rsp)
+	.loc 1 73 5 is_stmt 1 view .LVU272
+	call	free@PLT
+.LVL86:
+	.loc 1 74 5 view .LVU273
+	movq	%rbx, %rdi
+	call	free@PLT
+.LVL87:
+	.loc 1 75 5 view .LVU274
+	movq	8(%rsp), %rdi
+	call	free@PLT
+.LVL88:
+	.loc 1 76 5 view .LVU275
+	.loc 1 76 5 is_stmt 0 view .LVU276
+.LBE25:
+.LBE29:
+	.loc 1 114 3 is_stmt 1 view .LVU277
+.L52:
+.LBB30:
+.LBB26:
+	.loc 1 65 11 is_stmt 0 view .LVU278
+	xorl	%r12d, %r12d
+	jmp	.L51
+.LBE26:
+.LBE30:
+	.cfi_endproc
+.LFE30:
+	.size	st_create_from_fd, .-st_create_from_fd
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/root/repo/src/../include/strutils.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 9 "/usr/include/stdlib.h"
+	.file 10 "/usr/include/string.h"
+	.file 11 "/usr/include/stdio.h"
+	.file 12 "/usr/include/unistd.h"
+	.file 13 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xcac
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF118
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xa
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x17
+	.long	0x2e
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x17
+	.long	0x46
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0xa
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0xa
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x98
+	.byte	0x12
+	.long	0x52
+	.uleb128 0xa
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x99
+	.byte	0x12
+	.long	0x52
+	.uleb128 0x23
+	.byte	0x8
+	.uleb128 0x18
+	.long	0xa7
+	.uleb128 0xa
+	.long	.LASF14
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x52
+	.uleb128 0x5
+	.long	0xbf
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0xa
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x6c
+	.byte	0x13
+	.long	0xae
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF17
+	.uleb128 0x5
+	.long	0xde
+	.uleb128 0x24
+	.uleb128 0xa
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x10
+	.long	.LASF23
+	.byte	0x18
+	.value	0x175
+	.long	0x11f
+	.uleb128 0x1
+	.long	.LASF19
+	.value	0x17a
+	.byte	0x1c
+	.long	0x124
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF20
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF21
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF64
+	.uleb128 0x5
+	.long	0x11f
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF22
+	.uleb128 0x10
+	.long	.LASF24
+	.byte	0x40
+	.value	0x1e6
+	.long	0x1a5
+	.uleb128 0x1
+	.long	.LASF25
+	.value	0x1eb
+	.byte	0xc
+	.long	0xdf
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF26
+	.value	0x1f0
+	.byte	0xc
+	.long	0xdf
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF27
+	.value	0x1f5
+	.byte	0xc
+	.long	0xdf
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF28
+	.value	0x1fa
+	.byte	0xc
+	.long	0xdf
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF29
+	.value	0x1ff
+	.byte	0xc
+	.long	0xdf
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF30
+	.value	0x204
+	.byte	0xc
+	.long	0xdf
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF31
+	.value	0x209
+	.byte	0xc
+	.long	0xdf
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF32
+	.value	0x20e
+	.byte	0xc
+	.long	0xdf
+	.byte	0x38
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF33
+	.byte	0xd8
+	.byte	0x7
+	.byte	0x31
+	.byte	0x8
+	.long	0x30f
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x33
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x36
+	.byte	0x9
+	.long	0xba
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x37
+	.byte	0x9
+	.long	0xba
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x38
+	.byte	0x9
+	.long	0xba
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x39
+	.byte	0x9
+	.long	0xba
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x3a
+	.byte	0x9
+	.long	0xba
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0x3b
+	.byte	0x9
+	.long	0xba
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0x3c
+	.byte	0x9
+	.long	0xba
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x3d
+	.byte	0x9
+	.long	0xba
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0x40
+	.byte	0x9
+	.long	0xba
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0x41
+	.byte	0x9
+	.long	0xba
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF45
+	.byte	0x42
+	.byte	0x9
+	.long	0xba
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF46
+	.byte	0x44
+	.byte	0x16
+	.long	0x328
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF47
+	.byte	0x46
+	.byte	0x14
+	.long	0x32d
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0x48
+	.byte	0x7
+	.long	0x46
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF49
+	.byte	0x49
+	.byte	0x7
+	.long	0x46
+	.byte	0x74
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x4a
+	.byte	0xb
+	.long	0x8f
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF51
+	.byte	0x4d
+	.byte	0x12
+	.long	0x67
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF52
+	.byte	0x4e
+	.byte	0xf
+	.long	0x75
+	.byte	0x82
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x4f
+	.byte	0x8
+	.long	0x332
+	.byte	0x83
+	.uleb128 0x3
+	.long	.LASF54
+	.byte	0x51
+	.byte	0xf
+	.long	0x342
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF55
+	.byte	0x59
+	.byte	0xd
+	.long	0x9b
+	.byte	0x90
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0x5b
+	.byte	0x17
+	.long	0x34c
+	.byte	0x98
+	.uleb128 0x3
+	.long	.LASF57
+	.byte	0x5c
+	.byte	0x19
+	.long	0x356
+	.byte	0xa0
+	.uleb128 0x3
+	.long	.LASF58
+	.byte	0x5d
+	.byte	0x14
+	.long	0x32d
+	.byte	0xa8
+	.uleb128 0x3
+	.long	.LASF59
+	.byte	0x5e
+	.byte	0x9
+	.long	0xa7
+	.byte	0xb0
+	.uleb128 0x3
+	.long	.LASF60
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x3
+	.long	.LASF61
+	.byte	0x60
+	.byte	0x7
+	.long	0x46
+	.byte	0xc0
+	.uleb128 0x3
+	.long	.LASF62
+	.byte	0x62
+	.byte	0x8
+	.long	0x35b
+	.byte	0xc4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF63
+	.byte	0x8
+	.byte	0x7
+	.byte	0x19
+	.long	0x1a5
+	.uleb128 0x26
+	.long	.LASF119
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x11
+	.long	.LASF65
+	.uleb128 0x5
+	.long	0x323
+	.uleb128 0x5
+	.long	0x1a5
+	.uleb128 0x13
+	.long	0xbf
+	.long	0x342
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x31b
+	.uleb128 0x11
+	.long	.LASF66
+	.uleb128 0x5
+	.long	0x347
+	.uleb128 0x11
+	.long	.LASF67
+	.uleb128 0x5
+	.long	0x351
+	.uleb128 0x13
+	.long	0xbf
+	.long	0x36b
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0x30f
+	.uleb128 0x18
+	.long	0x36b
+	.uleb128 0x10
+	.long	.LASF68
+	.byte	0x38
+	.value	0x26c
+	.long	0x3e7
+	.uleb128 0x1
+	.long	.LASF69
+	.value	0x272
+	.byte	0xd
+	.long	0x400
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF70
+	.value	0x277
+	.byte	0x9
+	.long	0xa7
+	.byte	0x8
+	.uleb128 0x19
+	.string	"fd"
+	.value	0x27c
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF71
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF72
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF73
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x19
+	.string	"eof"
+	.value	0x290
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF74
+	.value	0x295
+	.byte	0x7
+	.long	0x46
+	.byte	0x34
+	.byte	0
+	.uleb128 0x27
+	.long	0xc6
+	.long	0x400
+	.uleb128 0x4
+	.long	0xa7
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x3e7
+	.uleb128 0x1a
+	.long	.LASF77
+	.long	0x6e
+	.value	0x29b
+	.long	0x421
+	.uleb128 0xc
+	.long	.LASF75
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF76
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF78
+	.long	0x6e
+	.value	0x2b5
+	.long	0x449
+	.uleb128 0xc
+	.long	.LASF79
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF80
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF81
+	.byte	0x2
+	.uleb128 0xc
+	.long	.LASF82
+	.byte	0x3
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF83
+	.value	0x158
+	.byte	0x6
+	.value	0x2cf
+	.byte	0x8
+	.long	0x4f7
+	.uleb128 0x1
+	.long	.LASF84
+	.value	0x2d4
+	.byte	0x9
+	.long	0xba
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF85
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF86
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF87
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF88
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x405
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF89
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF90
+	.value	0x2f2
+	.byte	0x18
+	.long	0x4f7
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF91
+	.value	0x2f7
+	.byte	0x18
+	.long	0x421
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF92
+	.value	0x2fc
+	.byte	0x17
+	.long	0x4fc
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF93
+	.value	0x301
+	.byte	0x8
+	.long	0x501
+	.byte	0x48
+	.uleb128 0x1b
+	.long	.LASF94
+	.value	0x306
+	.byte	0x21
+	.long	0x55f
+	.value	0x148
+	.uleb128 0x1b
+	.long	.LASF95
+	.value	0x30b
+	.byte	0x17
+	.long	0x564
+	.value	0x150
+	.byte	0
+	.uleb128 0x5
+	.long	0x375
+	.uleb128 0x5
+	.long	0xeb
+	.uleb128 0x13
+	.long	0xbf
+	.long	0x511
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF96
+	.byte	0x28
+	.value	0x764
+	.long	0x55f
+	.uleb128 0x1
+	.long	.LASF97
+	.value	0x769
+	.byte	0xb
+	.long	0x570
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF98
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF99
+	.value	0x774
+	.byte	0xd
+	.long	0x575
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF85
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF100
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x511
+	.uleb128 0x5
+	.long	0x130
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF101
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x5
+	.long	0xdf
+	.uleb128 0x5
+	.long	0x449
+	.uleb128 0xf
+	.long	.LASF102
+	.byte	0x9
+	.value	0x234
+	.byte	0xe
+	.long	0xa7
+	.long	0x59b
+	.uleb128 0x4
+	.long	0xa7
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF103
+	.byte	0xa
+	.byte	0x2f
+	.byte	0xe
+	.long	0xa7
+	.long	0x5bb
+	.uleb128 0x4
+	.long	0xa7
+	.uleb128 0x4
+	.long	0xd9
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF104
+	.byte	0xb
+	.value	0x316
+	.byte	0xc
+	.long	0x46
+	.long	0x5d2
+	.uleb128 0x4
+	.long	0x36b
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF105
+	.byte	0xb
+	.value	0x2a3
+	.byte	0xf
+	.long	0x2e
+	.long	0x5f8
+	.uleb128 0x4
+	.long	0xa9
+	.uleb128 0x4
+	.long	0x2e
+	.uleb128 0x4
+	.long	0x2e
+	.uleb128 0x4
+	.long	0x370
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF120
+	.byte	0xd
+	.byte	0x25
+	.byte	0xd
+	.long	0x604
+	.uleb128 0x5
+	.long	0x46
+	.uleb128 0xf
+	.long	.LASF69
+	.byte	0xc
+	.value	0x173
+	.byte	0x10
+	.long	0xc6
+	.long	0x62a
+	.uleb128 0x4
+	.long	0x46
+	.uleb128 0x4
+	.long	0xa7
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF106
+	.byte	0x6
+	.value	0x335
+	.byte	0x6
+	.long	0x647
+	.uleb128 0x4
+	.long	0x57a
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF107
+	.byte	0x9
+	.value	0x238
+	.byte	0xd
+	.long	0x65a
+	.uleb128 0x4
+	.long	0xa7
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF108
+	.byte	0x9
+	.value	0x229
+	.byte	0xe
+	.long	0xa7
+	.long	0x671
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF112
+	.byte	0x88
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x770
+	.uleb128 0x6
+	.long	.LASF109
+	.byte	0x88
+	.byte	0x27
+	.long	0x57a
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x6
+	.long	.LASF110
+	.byte	0x88
+	.byte	0x3f
+	.long	0x3a
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x9
+	.long	.LASF90
+	.byte	0x89
+	.byte	0x18
+	.long	0x4f7
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x9
+	.long	.LASF86
+	.byte	0x91
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x9
+	.long	.LASF111
+	.byte	0x9a
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1d
+	.long	.LLRL14
+	.long	0x735
+	.uleb128 0x9
+	.long	.LASF72
+	.byte	0x9c
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x9
+	.long	.LASF84
+	.byte	0xa0
+	.byte	0xb
+	.long	0xba
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xb
+	.quad	.LVL31
+	.long	0x57f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LLRL17
+	.long	0x762
+	.uleb128 0x9
+	.long	.LASF98
+	.byte	0xaa
+	.byte	0xd
+	.long	0xc6
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x2b
+	.quad	.LVL40
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL50
+	.long	0x59b
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF113
+	.byte	0x7e
+	.byte	0x19
+	.long	0x57a
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e1
+	.uleb128 0x6
+	.long	.LASF114
+	.byte	0x7e
+	.byte	0x33
+	.long	0x36b
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x6
+	.long	.LASF71
+	.byte	0x7e
+	.byte	0x46
+	.long	0x3a
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x2c
+	.quad	.LVL72
+	.long	0x96c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	string_stream_read_file
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF115
+	.byte	0x6d
+	.byte	0x19
+	.long	0x57a
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x96c
+	.uleb128 0x2d
+	.string	"fd"
+	.byte	0x1
+	.byte	0x6d
+	.byte	0x35
+	.long	0x4d
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x6
+	.long	.LASF71
+	.byte	0x6d
+	.byte	0x46
+	.long	0x3a
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x9
+	.long	.LASF109
+	.byte	0x71
+	.byte	0x1b
+	.long	0x57a
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1f
+	.long	0xb0b
+	.quad	.LBI21
+	.byte	.LVU216
+	.long	.LLRL35
+	.byte	0x71
+	.long	0x952
+	.uleb128 0xd
+	.long	0xb30
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0xd
+	.long	0xb26
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xd
+	.long	0xb1c
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x20
+	.long	.LLRL35
+	.uleb128 0xe
+	.long	0xb3a
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0xe
+	.long	0xb45
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0xe
+	.long	0xb50
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x7
+	.quad	.LVL75
+	.long	0x65a
+	.long	0x8be
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x158
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL77
+	.long	0x65a
+	.long	0x8d6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL79
+	.long	0x65a
+	.long	0x8ee
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL82
+	.long	0x62a
+	.long	0x90b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL86
+	.long	0x647
+	.long	0x923
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL87
+	.long	0x647
+	.long	0x93b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL88
+	.long	0x647
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -56
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL84
+	.long	0x671
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF116
+	.byte	0x61
+	.byte	0x19
+	.long	0x57a
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb0b
+	.uleb128 0x6
+	.long	.LASF69
+	.byte	0x61
+	.byte	0x3b
+	.long	0x400
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x6
+	.long	.LASF70
+	.byte	0x61
+	.byte	0x72
+	.long	0xa7
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x6
+	.long	.LASF71
+	.byte	0x61
+	.byte	0x88
+	.long	0x3a
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x9
+	.long	.LASF109
+	.byte	0x62
+	.byte	0x1b
+	.long	0x57a
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x1f
+	.long	0xb0b
+	.quad	.LBI11
+	.byte	.LVU144
+	.long	.LLRL23
+	.byte	0x62
+	.long	0xaf1
+	.uleb128 0xd
+	.long	0xb30
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xd
+	.long	0xb26
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0xd
+	.long	0xb1c
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x20
+	.long	.LLRL23
+	.uleb128 0xe
+	.long	0xb3a
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xe
+	.long	0xb45
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0xe
+	.long	0xb50
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x7
+	.quad	.LVL55
+	.long	0x65a
+	.long	0xa5c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x158
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL57
+	.long	0x65a
+	.long	0xa74
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL59
+	.long	0x65a
+	.long	0xa8c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL62
+	.long	0x62a
+	.long	0xaa9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL66
+	.long	0x647
+	.long	0xac1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL67
+	.long	0x647
+	.long	0xad9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL68
+	.long	0x647
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL64
+	.long	0x671
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF121
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x20
+	.long	0x57a
+	.byte	0x1
+	.long	0xb5c
+	.uleb128 0x15
+	.long	.LASF69
+	.byte	0x3f
+	.long	0x400
+	.uleb128 0x15
+	.long	.LASF70
+	.byte	0x76
+	.long	0xa7
+	.uleb128 0x15
+	.long	.LASF71
+	.byte	0x8c
+	.long	0x3a
+	.uleb128 0x16
+	.long	.LASF109
+	.byte	0x43
+	.byte	0x1b
+	.long	0x57a
+	.uleb128 0x16
+	.long	.LASF90
+	.byte	0x44
+	.byte	0x18
+	.long	0x4f7
+	.uleb128 0x16
+	.long	.LASF84
+	.byte	0x46
+	.byte	0x9
+	.long	0xba
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF122
+	.byte	0x1
+	.byte	0x29
+	.byte	0x10
+	.long	0xc6
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc1d
+	.uleb128 0x6
+	.long	.LASF70
+	.byte	0x29
+	.byte	0x2e
+	.long	0xa7
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x6
+	.long	.LASF117
+	.byte	0x29
+	.byte	0x3d
+	.long	0xba
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x6
+	.long	.LASF110
+	.byte	0x29
+	.byte	0x4c
+	.long	0x2e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x9
+	.long	.LASF114
+	.byte	0x2a
+	.byte	0x9
+	.long	0x36b
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x9
+	.long	.LASF98
+	.byte	0x2b
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x7
+	.quad	.LVL15
+	.long	0x5d2
+	.long	0xc08
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL21
+	.long	0x5bb
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF123
+	.byte	0x1
+	.byte	0x14
+	.byte	0x10
+	.long	0xc6
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x6
+	.long	.LASF70
+	.byte	0x14
+	.byte	0x2c
+	.long	0xa7
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x6
+	.long	.LASF117
+	.byte	0x14
+	.byte	0x3b
+	.long	0xba
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x6
+	.long	.LASF110
+	.byte	0x14
+	.byte	0x4a
+	.long	0x2e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x9
+	.long	.LASF98
+	.byte	0x15
+	.byte	0xb
+	.long	0xc6
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1e
+	.quad	.LVL2
+	.long	0x5f8
+	.uleb128 0xb
+	.quad	.LVL4
+	.long	0x609
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 63
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 39
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU39
+	.uleb128 .LVU83
+	.uleb128 .LVU85
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+	.uleb128 .LVU118
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 48
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU49
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU84
+	.uleb128 .LVU85
+	.uleb128 .LVU108
+	.uleb128 .LVU118
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU52
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU58
+	.uleb128 .LVU137
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x7
+	.byte	0x75
+	.sleb128 16
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 16
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 16
+	.byte	0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 16
+	.byte	0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU59
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU73
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU64
+	.uleb128 .LVU73
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU85
+	.uleb128 .LVU87
+	.uleb128 .LVU94
+	.uleb128 .LVU98
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL72-1-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL75-1-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU263
+	.uleb128 .LVU270
+	.uleb128 .LVU276
+	.uleb128 .LVU278
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU216
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU263
+	.uleb128 .LVU271
+	.uleb128 .LVU276
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL75-1-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU216
+	.uleb128 .LVU263
+	.uleb128 .LVU271
+	.uleb128 .LVU276
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU216
+	.uleb128 .LVU263
+	.uleb128 .LVU271
+	.uleb128 .LVU276
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	string_stream_read_fd
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	string_stream_read_fd
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU226
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU263
+	.uleb128 .LVU271
+	.uleb128 .LVU276
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU230
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU263
+	.uleb128 .LVU271
+	.uleb128 .LVU276
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL79-1-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU234
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU259
+	.uleb128 .LVU271
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL86-1-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU191
+	.uleb128 .LVU194
+	.uleb128 .LVU201
+	.uleb128 .LVU203
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU144
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU191
+	.uleb128 .LVU196
+	.uleb128 .LVU201
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU144
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU191
+	.uleb128 .LVU196
+	.uleb128 .LVU201
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU144
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU191
+	.uleb128 .LVU196
+	.uleb128 .LVU201
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU155
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU191
+	.uleb128 .LVU196
+	.uleb128 .LVU201
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL57-1-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU191
+	.uleb128 .LVU196
+	.uleb128 .LVU201
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL59-1-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU163
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU188
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU201
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL66-1-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU17
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU29
+	.uleb128 .LVU31
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-1-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU2
+	.uleb128 .LVU2
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU2
+	.uleb128 .LVU2
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU2
+	.uleb128 .LVU2
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU2
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 .LVU4
+	.uleb128 .LVU8
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF120:
+	.string	"__errno_location"
+.LASF49:
+	.string	"_flags2"
+.LASF86:
+	.string	"position"
+.LASF20:
+	.string	"block_size"
+.LASF37:
+	.string	"_IO_read_base"
+.LASF113:
+	.string	"st_create_from_file"
+.LASF33:
+	.string	"_IO_FILE"
+.LASF8:
+	.string	"signed char"
+.LASF45:
+	.string	"_IO_save_end"
+.LASF9:
+	.string	"short int"
+.LASF10:
+	.string	"size_t"
+.LASF108:
+	.string	"malloc"
+.LASF55:
+	.string	"_offset"
+.LASF97:
+	.string	"positions"
+.LASF95:
+	.string	"stats"
+.LASF112:
+	.string	"st_ensure"
+.LASF39:
+	.string	"_IO_write_ptr"
+.LASF34:
+	.string	"_flags"
+.LASF26:
+	.string	"tokens_extracted"
+.LASF41:
+	.string	"_IO_buf_base"
+.LASF114:
+	.string	"file"
+.LASF46:
+	.string	"_markers"
+.LASF91:
+	.string	"ownership"
+.LASF31:
+	.string	"conversions"
+.LASF59:
+	.string	"_freeres_buf"
+.LASF19:
+	.string	"head"
+.LASF116:
+	.string	"st_create_from_callback"
+.LASF123:
+	.string	"string_stream_read_fd"
+.LASF81:
+	.string	"ST_STRING_MAPPED"
+.LASF23:
+	.string	"StringArena"
+.LASF107:
+	.string	"free"
+.LASF62:
+	.string	"_unused2"
+.LASF100:
+	.string	"hint"
+.LASF85:
+	.string	"length"
+.LASF101:
+	.string	"double"
+.LASF4:
+	.string	"long long int"
+.LASF106:
+	.string	"st_init"
+.LASF14:
+	.string	"__ssize_t"
+.LASF54:
+	.string	"_lock"
+.LASF3:
+	.string	"long int"
+.LASF84:
+	.string	"string"
+.LASF109:
+	.string	"tokenizer"
+.LASF73:
+	.string	"offset"
+.LASF94:
+	.string	"structural_index"
+.LASF51:
+	.string	"_cur_column"
+.LASF70:
+	.string	"context"
+.LASF89:
+	.string	"max_increment"
+.LASF87:
+	.string	"incremental_factor"
+.LASF111:
+	.string	"needed"
+.LASF79:
+	.string	"ST_STRING_BORROWED"
+.LASF77:
+	.string	"StringGrowthPolicy"
+.LASF28:
+	.string	"reallocations"
+.LASF22:
+	.string	"long double"
+.LASF13:
+	.string	"__off64_t"
+.LASF103:
+	.string	"memmove"
+.LASF5:
+	.string	"unsigned char"
+.LASF43:
+	.string	"_IO_save_base"
+.LASF69:
+	.string	"read"
+.LASF76:
+	.string	"ST_GROWTH_LINEAR"
+.LASF72:
+	.string	"capacity"
+.LASF17:
+	.string	"long long unsigned int"
+.LASF7:
+	.string	"unsigned int"
+.LASF65:
+	.string	"_IO_marker"
+.LASF53:
+	.string	"_shortbuf"
+.LASF82:
+	.string	"ST_STRING_INLINE"
+.LASF102:
+	.string	"realloc"
+.LASF36:
+	.string	"_IO_read_end"
+.LASF90:
+	.string	"stream"
+.LASF38:
+	.string	"_IO_write_base"
+.LASF121:
+	.string	"string_stream_create"
+.LASF35:
+	.string	"_IO_read_ptr"
+.LASF42:
+	.string	"_IO_buf_end"
+.LASF105:
+	.string	"fread"
+.LASF15:
+	.string	"char"
+.LASF92:
+	.string	"arena"
+.LASF57:
+	.string	"_wide_data"
+.LASF58:
+	.string	"_freeres_list"
+.LASF115:
+	.string	"st_create_from_fd"
+.LASF99:
+	.string	"in_string"
+.LASF60:
+	.string	"__pad5"
+.LASF11:
+	.string	"__uint64_t"
+.LASF117:
+	.string	"buffer"
+.LASF6:
+	.string	"short unsigned int"
+.LASF24:
+	.string	"StringStats"
+.LASF2:
+	.string	"long unsigned int"
+.LASF93:
+	.string	"inline_buffer"
+.LASF40:
+	.string	"_IO_write_end"
+.LASF96:
+	.string	"StringStructuralIndex"
+.LASF118:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF80:
+	.string	"ST_STRING_OWNED"
+.LASF48:
+	.string	"_fileno"
+.LASF30:
+	.string	"bytes_copied"
+.LASF47:
+	.string	"_chain"
+.LASF110:
+	.string	"size"
+.LASF67:
+	.string	"_IO_wide_data"
+.LASF98:
+	.string	"count"
+.LASF61:
+	.string	"_mode"
+.LASF71:
+	.string	"chunk_size"
+.LASF44:
+	.string	"_IO_backup_base"
+.LASF12:
+	.string	"__off_t"
+.LASF78:
+	.string	"StringOwnership"
+.LASF32:
+	.string	"conversion_ns"
+.LASF66:
+	.string	"_IO_codecvt"
+.LASF21:
+	.string	"used"
+.LASF75:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF16:
+	.string	"ssize_t"
+.LASF52:
+	.string	"_vtable_offset"
+.LASF56:
+	.string	"_codecvt"
+.LASF122:
+	.string	"string_stream_read_file"
+.LASF74:
+	.string	"error"
+.LASF50:
+	.string	"_old_offset"
+.LASF83:
+	.string	"StringTokenizer"
+.LASF63:
+	.string	"FILE"
+.LASF25:
+	.string	"bytes_scanned"
+.LASF88:
+	.string	"growth_policy"
+.LASF64:
+	.string	"StringArenaBlock"
+.LASF68:
+	.string	"StringStream"
+.LASF18:
+	.string	"uint64_t"
+.LASF104:
+	.string	"ferror"
+.LASF119:
+	.string	"_IO_lock_t"
+.LASF29:
+	.string	"expansions"
+.LASF27:
+	.string	"allocations"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/string_stream.c"
+.LASF1:
+	.string	"/root/repo/build/test"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
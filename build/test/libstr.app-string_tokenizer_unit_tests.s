@@ -0,0 +1,13971 @@
+	.file	"string_tokenizer_unit_tests.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/tests/string_tokenizer_unit_tests.c"
+	.p2align 4
+	.type	tokenizer_test_read, @function
+tokenizer_test_read:
+.LVL0:
+.LFB26:
+	.file 1 "/root/repo/tests/string_tokenizer_unit_tests.c"
+	.loc 1 23 78 view -0
+	.cfi_startproc
+	.loc 1 24 3 view .LVU1
+	.loc 1 23 78 is_stmt 0 view .LVU2
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+.LVL1:
+	.loc 1 25 3 is_stmt 1 view .LVU3
+	.loc 1 23 78 is_stmt 0 view .LVU4
+	movq	%rsi, %rdi
+.LVL2:
+	.loc 1 23 78 view .LVU5
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 25 41 view .LVU6
+	movq	16(%rbp), %rsi
+.LVL3:
+	.loc 1 26 3 is_stmt 1 view .LVU7
+	.loc 1 25 10 is_stmt 0 view .LVU8
+	movq	8(%rbp), %rbx
+	subq	%rsi, %rbx
+.LVL4:
+	.loc 1 25 10 view .LVU9
+	cmpq	%rdx, %rbx
+	cmova	%rdx, %rbx
+.LVL5:
+	.loc 1 29 3 is_stmt 1 view .LVU10
+	.loc 1 29 31 is_stmt 0 view .LVU11
+	addq	0(%rbp), %rsi
+	.loc 1 29 3 view .LVU12
+	movq	%rbx, %rdx
+.LVL6:
+	.loc 1 29 3 view .LVU13
+	call	memcpy@PLT
+.LVL7:
+	.loc 1 30 3 is_stmt 1 view .LVU14
+	.loc 1 30 18 is_stmt 0 view .LVU15
+	addq	%rbx, 16(%rbp)
+	.loc 1 31 3 is_stmt 1 view .LVU16
+	.loc 1 32 1 is_stmt 0 view .LVU17
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL8:
+	.loc 1 32 1 view .LVU18
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL9:
+	.loc 1 32 1 view .LVU19
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	tokenizer_test_read, .-tokenizer_test_read
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"%.*s|"
+.LC1:
+	.string	"%g|"
+.LC2:
+	.string	"true"
+.LC3:
+	.string	"true|"
+	.text
+	.p2align 4
+	.type	tokenizer_test_walk.constprop.0, @function
+tokenizer_test_walk.constprop.0:
+.LVL10:
+.LFB38:
+	.loc 1 37 13 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 38 3 view .LVU21
+	.loc 1 39 3 view .LVU22
+	.loc 1 40 3 view .LVU23
+	.loc 1 37 13 is_stmt 0 view .LVU24
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+.LBB3:
+	.loc 1 48 17 view .LVU25
+	movl	$256, %r15d
+.LBE3:
+	.loc 1 37 13 view .LVU26
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+.LBB4:
+	.loc 1 50 14 view .LVU27
+	leaq	.LC2(%rip), %r14
+.LBE4:
+	.loc 1 37 13 view .LVU28
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	.loc 1 38 10 view .LVU29
+	xorl	%ebp, %ebp
+	.loc 1 37 13 view .LVU30
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+.LBB5:
+	.loc 1 47 14 view .LVU31
+	leaq	8(%rsp), %r12
+.LBE5:
+	.loc 1 40 16 view .LVU32
+	movb	$0, (%rsi)
+	.loc 1 41 3 is_stmt 1 view .LVU33
+	.loc 1 41 9 is_stmt 0 view .LVU34
+	jmp	.L5
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L6:
+.LBB6:
+	.loc 1 47 10 is_stmt 1 view .LVU35
+	.loc 1 47 14 is_stmt 0 view .LVU36
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	st_extract_double_to@PLT
+.LVL12:
+	.loc 1 47 13 view .LVU37
+	cmpl	$1, %eax
+	je	.L17
+	.loc 1 50 10 is_stmt 1 view .LVU38
+	.loc 1 50 14 is_stmt 0 view .LVU39
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	st_starts_with@PLT
+.LVL13:
+	.loc 1 50 13 view .LVU40
+	cmpl	$1, %eax
+	je	.L18
+.L7:
+	.loc 1 54 5 is_stmt 1 view .LVU41
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL14:
+.L5:
+	.loc 1 54 5 is_stmt 0 view .LVU42
+.LBE6:
+	.loc 1 41 56 is_stmt 1 view .LVU43
+	.loc 1 41 19 is_stmt 0 view .LVU44
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL15:
+	.loc 1 41 56 view .LVU45
+	cmpq	$255, %rbp
+	ja	.L15
+	testb	%al, %al
+	je	.L15
+.LBB7:
+	.loc 1 42 5 is_stmt 1 view .LVU46
+	.loc 1 43 5 view .LVU47
+	.loc 1 44 5 view .LVU48
+	.loc 1 44 8 is_stmt 0 view .LVU49
+	cmpb	$34, %al
+	jne	.L6
+	.loc 1 44 25 view .LVU50
+	leaq	16(%rsp), %rcx
+	movl	$34, %edx
+	movl	$34, %esi
+	movq	%rbx, %rdi
+	call	st_sub_string_view@PLT
+.LVL16:
+	.loc 1 44 22 view .LVU51
+	cmpl	$1, %eax
+	jne	.L6
+	.loc 1 45 7 is_stmt 1 view .LVU52
+	.loc 1 45 17 is_stmt 0 view .LVU53
+	movq	16(%rsp), %r8
+	movl	24(%rsp), %ecx
+	movl	$256, %esi
+	subq	%rbp, %rsi
+	leaq	0(%r13,%rbp), %rdi
+	leaq	.LC0(%rip), %rdx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+.LVL17:
+	cltq
+	.loc 1 45 14 view .LVU54
+	addq	%rax, %rbp
+.LVL18:
+	.loc 1 45 7 view .LVU55
+	jmp	.L7
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 48 7 is_stmt 1 view .LVU56
+	.loc 1 48 17 is_stmt 0 view .LVU57
+	vmovsd	8(%rsp), %xmm0
+	movq	%r15, %rsi
+	subq	%rbp, %rsi
+	leaq	0(%r13,%rbp), %rdi
+	leaq	.LC1(%rip), %rdx
+	call	snprintf@PLT
+.LVL19:
+	cltq
+	.loc 1 48 14 view .LVU58
+	addq	%rax, %rbp
+.LVL20:
+	.loc 1 48 14 view .LVU59
+	jmp	.L7
+.LVL21:
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.loc 1 48 14 view .LVU60
+.LBE7:
+	.loc 1 56 1 view .LVU61
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL22:
+	.loc 1 56 1 view .LVU62
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL23:
+	.loc 1 56 1 view .LVU63
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL24:
+	.loc 1 56 1 view .LVU64
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL25:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.cfi_restore_state
+.LBB8:
+	.loc 1 51 7 is_stmt 1 view .LVU65
+	.loc 1 51 17 is_stmt 0 view .LVU66
+	movl	$256, %esi
+	subq	%rbp, %rsi
+	leaq	0(%r13,%rbp), %rdi
+	leaq	.LC3(%rip), %rdx
+	xorl	%eax, %eax
+	call	snprintf@PLT
+.LVL26:
+	.loc 1 51 14 view .LVU67
+	addq	$5, %rbp
+.LVL27:
+	.loc 1 52 7 is_stmt 1 view .LVU68
+	jmp	.L5
+.LBE8:
+	.cfi_endproc
+.LFE38:
+	.size	tokenizer_test_walk.constprop.0, .-tokenizer_test_walk.constprop.0
+	.section	.rodata.str1.1
+.LC4:
+	.string	"geometric"
+.LC5:
+	.string	"linear"
+.LC6:
+	.string	"geometric capped"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC7:
+	.string	"------------------- st_expand_string(x) -------------------"
+	.section	.rodata.str1.1
+.LC8:
+	.string	"abc"
+	.section	.rodata.str1.8
+	.align 8
+.LC9:
+	.string	"[Failed] %s growth failed: %zu expansions.\n"
+	.section	.rodata.str1.1
+.LC10:
+	.string	"abcabc"
+	.section	.rodata.str1.8
+	.align 8
+.LC11:
+	.string	"[Failed] %s growth failed: st_shrink_to_fit() lost the content.\n"
+	.align 8
+.LC12:
+	.string	"[Failed] %s growth failed: st_reserve() did not keep the length.\n"
+	.section	.rodata.str1.1
+.LC13:
+	.string	"d"
+	.section	.rodata.str1.8
+	.align 8
+.LC14:
+	.string	"[Passed] %s growth used %zu expansions.\n"
+	.text
+	.p2align 4
+	.globl	run_st_expand_string_unit_tests
+	.type	run_st_expand_string_unit_tests, @function
+run_st_expand_string_unit_tests:
+.LFB28:
+	.loc 1 61 39 view -0
+	.cfi_startproc
+	.loc 1 63 3 view .LVU70
+	.loc 1 61 39 is_stmt 0 view .LVU71
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 63 27 view .LVU72
+	movabsq	$4294967296, %rax
+	.loc 1 66 15 view .LVU73
+	leaq	.LC4(%rip), %rcx
+	.loc 1 61 39 view .LVU74
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	.loc 1 66 15 view .LVU75
+	vmovq	%rcx, %xmm0
+	.loc 1 70 3 view .LVU76
+	leaq	.LC7(%rip), %rdi
+	.loc 1 61 39 view .LVU77
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	.loc 1 70 3 view .LVU78
+	xorl	%r14d, %r14d
+	leaq	.LC8(%rip), %r13
+	.loc 1 61 39 view .LVU79
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 224
+	.loc 1 63 27 view .LVU80
+	movq	%rax, 52(%rsp)
+	.loc 1 66 15 view .LVU81
+	leaq	.LC5(%rip), %rax
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC6(%rip), %rax
+	.loc 1 63 27 view .LVU82
+	movl	$0, 60(%rsp)
+	.loc 1 64 3 is_stmt 1 view .LVU83
+	.loc 1 64 10 is_stmt 0 view .LVU84
+	movq	$0, 64(%rsp)
+	movq	$0, 72(%rsp)
+	movq	$4096, 80(%rsp)
+	.loc 1 65 3 is_stmt 1 view .LVU85
+	.loc 1 65 10 is_stmt 0 view .LVU86
+	movq	$16, 96(%rsp)
+	movq	$10000, 104(%rsp)
+	movq	$32, 112(%rsp)
+	.loc 1 66 3 is_stmt 1 view .LVU87
+	.loc 1 66 15 is_stmt 0 view .LVU88
+	movq	%rax, 144(%rsp)
+	.loc 1 68 3 is_stmt 1 view .LVU89
+.LVL28:
+	.loc 1 70 3 view .LVU90
+	.loc 1 66 15 is_stmt 0 view .LVU91
+	vmovdqa	%xmm0, 128(%rsp)
+	.loc 1 70 3 view .LVU92
+	call	puts@PLT
+.LVL29:
+	.loc 1 72 3 is_stmt 1 view .LVU93
+	.loc 1 73 3 view .LVU94
+.LBB9:
+	.loc 1 73 8 view .LVU95
+	.loc 1 73 21 view .LVU96
+	leaq	64(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	leaq	52(%rsp), %rax
+	movq	%rax, 32(%rsp)
+	leaq	96(%rsp), %rax
+	movq	%rax, 24(%rsp)
+	leaq	128(%rsp), %rax
+.LBE9:
+	.loc 1 72 7 is_stmt 0 view .LVU97
+	movl	$0, 44(%rsp)
+	movq	%rax, 8(%rsp)
+.LVL30:
+.L29:
+.LBB17:
+.LBB10:
+	.loc 1 74 5 is_stmt 1 view .LVU98
+	.loc 1 74 41 is_stmt 0 view .LVU99
+	movl	$16, %edi
+	call	st_create_empty@PLT
+.LVL31:
+	movq	%rax, %rbp
+.LVL32:
+	.loc 1 75 5 is_stmt 1 view .LVU100
+	movq	16(%rsp), %rax
+.LVL33:
+	.loc 1 75 5 is_stmt 0 view .LVU101
+	movq	%rbp, %rdi
+	movq	(%rax,%r14,8), %rdx
+	movq	32(%rsp), %rax
+.LBB11:
+.LBB12:
+	.loc 1 79 14 view .LVU102
+	movl	$10000, %ebx
+.LBE12:
+.LBE11:
+	.loc 1 75 5 view .LVU103
+	movl	(%rax,%r14,4), %esi
+	.loc 1 77 12 view .LVU104
+	xorl	%r12d, %r12d
+	.loc 1 75 5 view .LVU105
+	call	st_set_growth_policy@PLT
+.LVL34:
+	.loc 1 76 5 is_stmt 1 view .LVU106
+	.loc 1 76 25 is_stmt 0 view .LVU107
+	movq	$0, 16(%rbp)
+	.loc 1 77 5 is_stmt 1 view .LVU108
+.LVL35:
+	.loc 1 78 5 view .LVU109
+.LBB14:
+	.loc 1 78 10 view .LVU110
+	.loc 1 78 23 view .LVU111
+.LBB13:
+	.loc 1 79 14 is_stmt 0 view .LVU112
+	movq	8(%rbp), %r15
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	.loc 1 79 7 is_stmt 1 discriminator 3 view .LVU113
+	.loc 1 80 7 discriminator 3 view .LVU114
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+	call	st_append_string@PLT
+.LVL37:
+	.loc 1 81 7 discriminator 3 view .LVU115
+	movq	%r15, %rax
+	.loc 1 81 40 is_stmt 0 discriminator 3 view .LVU116
+	movq	8(%rbp), %r15
+	.loc 1 81 28 discriminator 3 view .LVU117
+	cmpq	%rax, %r15
+	setne	%al
+	movzbl	%al, %eax
+	.loc 1 81 18 discriminator 3 view .LVU118
+	addq	%rax, %r12
+.LVL38:
+	.loc 1 81 18 discriminator 3 view .LVU119
+.LBE13:
+	.loc 1 78 33 is_stmt 1 discriminator 3 view .LVU120
+	.loc 1 78 23 discriminator 3 view .LVU121
+	decl	%ebx
+	jne	.L20
+.LBE14:
+	.loc 1 83 5 view .LVU122
+	.loc 1 83 8 is_stmt 0 view .LVU123
+	movq	24(%rsp), %rax
+	cmpq	%r12, (%rax,%r14,8)
+	jb	.L21
+	.loc 1 83 40 discriminator 1 view .LVU124
+	cmpq	$30000, 16(%rbp)
+	je	.L22
+.L21:
+	.loc 1 84 7 is_stmt 1 view .LVU125
+	movq	8(%rsp), %rax
+	movq	%r12, %rdx
+	movq	(%rax,%r14,8), %rsi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL39:
+	.loc 1 85 7 view .LVU126
+.L23:
+	.loc 1 85 19 is_stmt 0 view .LVU127
+	movl	$1, 44(%rsp)
+.LVL40:
+.L26:
+	.loc 1 99 5 is_stmt 1 discriminator 2 view .LVU128
+	movq	%rbp, %rdi
+.LBE10:
+	.loc 1 73 21 is_stmt 0 discriminator 2 view .LVU129
+	incq	%r14
+.LVL41:
+.LBB15:
+	.loc 1 99 5 discriminator 2 view .LVU130
+	call	st_destroy@PLT
+.LVL42:
+.LBE15:
+	.loc 1 73 35 is_stmt 1 discriminator 2 view .LVU131
+	.loc 1 73 21 discriminator 2 view .LVU132
+	cmpq	$3, %r14
+	jne	.L29
+.LBE17:
+	.loc 1 101 3 view .LVU133
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL43:
+	.loc 1 103 3 view .LVU134
+	.loc 1 104 1 is_stmt 0 view .LVU135
+	movl	44(%rsp), %eax
+	addq	$168, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL44:
+	.loc 1 104 1 view .LVU136
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL45:
+	.loc 1 104 1 view .LVU137
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL46:
+.L22:
+	.cfi_restore_state
+.LBB18:
+.LBB16:
+	.loc 1 87 10 is_stmt 1 view .LVU138
+	.loc 1 87 14 is_stmt 0 view .LVU139
+	movq	%rbp, %rdi
+	call	st_shrink_to_fit@PLT
+.LVL47:
+	.loc 1 87 13 view .LVU140
+	testl	%eax, %eax
+	je	.L24
+	.loc 1 87 80 discriminator 1 view .LVU141
+	movq	16(%rbp), %rax
+	.loc 1 87 91 discriminator 1 view .LVU142
+	leaq	1(%rax), %rdx
+	.loc 1 87 47 discriminator 1 view .LVU143
+	cmpq	%rdx, 8(%rbp)
+	je	.L39
+.L24:
+	.loc 1 88 7 is_stmt 1 view .LVU144
+	movq	8(%rsp), %rax
+	leaq	.LC11(%rip), %rdi
+	movq	(%rax,%r14,8), %rsi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL48:
+	.loc 1 89 7 view .LVU145
+	.loc 1 89 19 is_stmt 0 view .LVU146
+	jmp	.L23
+.LVL49:
+.L39:
+	.loc 1 87 146 discriminator 2 view .LVU147
+	movq	0(%rbp), %rdx
+	.loc 1 87 98 discriminator 2 view .LVU148
+	leaq	.LC10(%rip), %rsi
+	.loc 1 87 146 discriminator 2 view .LVU149
+	leaq	-6(%rdx,%rax), %rdi
+	.loc 1 87 98 discriminator 2 view .LVU150
+	call	strcmp@PLT
+.LVL50:
+	.loc 1 87 95 discriminator 2 view .LVU151
+	testl	%eax, %eax
+	jne	.L24
+	.loc 1 91 10 is_stmt 1 view .LVU152
+	.loc 1 91 14 is_stmt 0 view .LVU153
+	movl	$1048576, %esi
+	movq	%rbp, %rdi
+	call	st_reserve@PLT
+.LVL51:
+	.loc 1 91 13 view .LVU154
+	testl	%eax, %eax
+	je	.L28
+	.loc 1 91 50 discriminator 1 view .LVU155
+	cmpq	$1048576, 8(%rbp)
+	je	.L40
+.L28:
+	.loc 1 92 7 is_stmt 1 view .LVU156
+	movq	8(%rsp), %rax
+	leaq	.LC12(%rip), %rdi
+	movq	(%rax,%r14,8), %rsi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL52:
+	.loc 1 93 7 view .LVU157
+	.loc 1 93 19 is_stmt 0 view .LVU158
+	jmp	.L23
+.LVL53:
+.L40:
+	.loc 1 91 85 discriminator 2 view .LVU159
+	leaq	.LC13(%rip), %rsi
+	movq	%rbp, %rdi
+	call	st_append_string@PLT
+.LVL54:
+	.loc 1 91 82 discriminator 2 view .LVU160
+	testl	%eax, %eax
+	je	.L28
+	.loc 1 97 7 discriminator 3 view .LVU161
+	movq	8(%rsp), %rax
+	.loc 1 91 123 discriminator 3 view .LVU162
+	cmpq	$1048576, 8(%rbp)
+	.loc 1 97 7 discriminator 3 view .LVU163
+	movq	(%rax,%r14,8), %rsi
+	.loc 1 91 123 discriminator 3 view .LVU164
+	jne	.L28
+	.loc 1 97 7 is_stmt 1 view .LVU165
+	movq	%r12, %rdx
+	leaq	.LC14(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL55:
+	jmp	.L26
+.LBE16:
+.LBE18:
+	.cfi_endproc
+.LFE28:
+	.size	run_st_expand_string_unit_tests, .-run_st_expand_string_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC15:
+	.string	"------------------- st_append_*(x) -------------------"
+	.section	.rodata.str1.1
+.LC17:
+	.string	"\"b\""
+.LC18:
+	.string	":"
+.LC19:
+	.string	"[1,2]"
+.LC20:
+	.string	"{\"a\":1.5,\"b\":[1,2],\"c\":-42}"
+	.section	.rodata.str1.8
+	.align 8
+.LC21:
+	.string	"[Failed] st_append_*() failed: expected '%s', got '%s'.\n"
+	.section	.rodata.str1.1
+.LC22:
+	.string	"a"
+.LC23:
+	.string	":xyz"
+.LC24:
+	.string	",\"c\":"
+	.section	.rodata.str1.8
+	.align 8
+.LC25:
+	.string	"[Passed] st_append_*() built '%s'.\n"
+	.text
+	.p2align 4
+	.globl	run_st_append_unit_tests
+	.type	run_st_append_unit_tests, @function
+run_st_append_unit_tests:
+.LFB29:
+	.loc 1 109 32 view -0
+	.cfi_startproc
+	.loc 1 111 3 view .LVU167
+	.loc 1 109 32 is_stmt 0 view .LVU168
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 111 3 view .LVU169
+	leaq	.LC15(%rip), %rdi
+	.loc 1 109 32 view .LVU170
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 112
+	.loc 1 111 3 view .LVU171
+	call	puts@PLT
+.LVL56:
+	.loc 1 112 3 is_stmt 1 view .LVU172
+	.loc 1 113 3 view .LVU173
+	.loc 1 113 39 is_stmt 0 view .LVU174
+	movl	$4, %edi
+	call	st_create_empty@PLT
+.LVL57:
+	.loc 1 114 23 view .LVU175
+	movq	$0, 16(%rax)
+	.loc 1 113 39 view .LVU176
+	movq	%rax, %rbx
+.LVL58:
+	.loc 1 114 3 is_stmt 1 view .LVU177
+	.loc 1 116 3 view .LVU178
+	.loc 1 116 10 is_stmt 0 view .LVU179
+	movq	.LC16(%rip), %rax
+.LVL59:
+	.loc 1 118 18 view .LVU180
+	movl	$123, %esi
+	.loc 1 116 10 view .LVU181
+	movq	%rax, 24(%rsp)
+	.loc 1 117 3 is_stmt 1 view .LVU182
+	.loc 1 117 21 is_stmt 0 view .LVU183
+	leaq	.LC17(%rip), %rax
+	movq	%rax, 32(%rsp)
+	leaq	.LC18(%rip), %rax
+	movq	%rax, 48(%rsp)
+	.loc 1 118 18 view .LVU184
+	movq	%rbx, %rdi
+	.loc 1 117 21 view .LVU185
+	leaq	.LC19(%rip), %rax
+	movq	$3, 40(%rsp)
+	movq	$1, 56(%rsp)
+	movq	%rax, 64(%rsp)
+	movq	$5, 72(%rsp)
+	.loc 1 118 3 is_stmt 1 view .LVU186
+	.loc 1 118 18 is_stmt 0 view .LVU187
+	call	st_append_char@PLT
+.LVL60:
+	.loc 1 126 5 view .LVU188
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 119 8 view .LVU189
+	leaq	.LC22(%rip), %rsi
+	movq	%rbx, %rdi
+	call	st_append_quoted_string@PLT
+.LVL61:
+	.loc 1 119 5 view .LVU190
+	testl	%eax, %eax
+	jne	.L61
+.L70:
+	movq	(%rbx), %rdx
+	leaq	.LC20(%rip), %rsi
+.L44:
+	.loc 1 129 5 is_stmt 1 view .LVU191
+	leaq	.LC21(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL62:
+	.loc 1 130 5 view .LVU192
+	.loc 1 130 17 is_stmt 0 view .LVU193
+	movl	$1, %ebp
+.LVL63:
+.L43:
+	.loc 1 136 3 is_stmt 1 view .LVU194
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL64:
+	.loc 1 137 3 view .LVU195
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL65:
+	.loc 1 139 3 view .LVU196
+	.loc 1 140 1 is_stmt 0 view .LVU197
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL66:
+	.loc 1 140 1 view .LVU198
+	movl	%ebp, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL67:
+	.loc 1 140 1 view .LVU199
+	ret
+.LVL68:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	.cfi_restore_state
+	.loc 1 120 8 view .LVU200
+	movl	$1, %edx
+	leaq	.LC23(%rip), %rsi
+	movq	%rbx, %rdi
+	call	st_append_n@PLT
+.LVL69:
+	.loc 1 120 5 view .LVU201
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 121 8 view .LVU202
+	leaq	24(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	st_append_double@PLT
+.LVL70:
+	.loc 1 121 5 view .LVU203
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 122 8 view .LVU204
+	movl	$44, %esi
+	movq	%rbx, %rdi
+	call	st_append_char@PLT
+.LVL71:
+	.loc 1 122 5 view .LVU205
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 123 8 view .LVU206
+	leaq	32(%rsp), %rsi
+	movl	$3, %edx
+	movq	%rbx, %rdi
+	call	st_append_many@PLT
+.LVL72:
+	.loc 1 123 5 view .LVU207
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 124 8 view .LVU208
+	leaq	.LC24(%rip), %rsi
+	movq	%rbx, %rdi
+	call	st_append_string@PLT
+.LVL73:
+	.loc 1 124 5 view .LVU209
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 125 8 view .LVU210
+	movq	$-42, %rsi
+	movq	%rbx, %rdi
+	call	st_append_int@PLT
+.LVL74:
+	.loc 1 125 5 view .LVU211
+	testl	%eax, %eax
+	je	.L70
+	.loc 1 126 8 discriminator 3 view .LVU212
+	movl	$125, %esi
+	movq	%rbx, %rdi
+	call	st_append_char@PLT
+.LVL75:
+	.loc 1 126 5 discriminator 3 view .LVU213
+	testl	%eax, %eax
+	je	.L70
+.LVL76:
+	.loc 1 127 3 is_stmt 1 view .LVU214
+	.loc 1 128 3 view .LVU215
+	.loc 1 128 40 is_stmt 0 view .LVU216
+	movq	(%rbx), %rdx
+	.loc 1 128 24 view .LVU217
+	leaq	.LC20(%rip), %rsi
+	movq	%rdx, %rdi
+	movq	%rsi, 8(%rsp)
+	movq	%rdx, (%rsp)
+	call	strcmp@PLT
+.LVL77:
+	.loc 1 128 21 view .LVU218
+	testl	%eax, %eax
+	movq	(%rsp), %rdx
+	.loc 1 128 24 view .LVU219
+	movl	%eax, %ebp
+	.loc 1 128 21 view .LVU220
+	leaq	.LC20(%rip), %rsi
+	jne	.L44
+	.loc 1 128 65 discriminator 2 view .LVU221
+	cmpq	$27, 16(%rbx)
+	jne	.L44
+	.loc 1 134 5 is_stmt 1 view .LVU222
+	movq	%rdx, %rsi
+	leaq	.LC25(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL78:
+	jmp	.L43
+	.cfi_endproc
+.LFE29:
+	.size	run_st_append_unit_tests, .-run_st_append_unit_tests
+	.section	.rodata.str1.1
+.LC26:
+	.string	""
+.LC27:
+	.string	"plain text"
+.LC28:
+	.string	"say \"hi\""
+.LC29:
+	.string	"C:\\dir\\"
+.LC30:
+	.string	"line\nbreak\ttab"
+.LC31:
+	.string	"\001\037"
+	.section	.rodata.str1.8
+	.align 8
+.LC32:
+	.string	"a long run of clean characters before the \"quote\" and after it"
+	.section	.rodata.str1.1
+.LC33:
+	.string	"\"\""
+.LC34:
+	.string	"\"plain text\""
+.LC35:
+	.string	"\"say \\\"hi\\\"\""
+.LC36:
+	.string	"\"C:\\\\dir\\\\\""
+.LC37:
+	.string	"\"line\\nbreak\\ttab\""
+.LC38:
+	.string	"\"\\u0001\\u001f\""
+	.section	.rodata.str1.8
+	.align 8
+.LC39:
+	.string	"\"a long run of clean characters before the \\\"quote\\\" and after it\""
+	.align 8
+.LC40:
+	.string	"------------------- st_append_escaped_string(x) -------------------"
+	.align 8
+.LC41:
+	.string	"[Failed] st_append_escaped_string() failed: expected '%s', got '%s'.\n"
+	.align 8
+.LC42:
+	.string	"[Passed] st_append_escaped_string() is '%s'.\n"
+	.text
+	.p2align 4
+	.globl	run_st_append_escaped_string_unit_tests
+	.type	run_st_append_escaped_string_unit_tests, @function
+run_st_append_escaped_string_unit_tests:
+.LFB30:
+	.loc 1 145 47 view -0
+	.cfi_startproc
+	.loc 1 147 3 view .LVU224
+	.loc 1 145 47 is_stmt 0 view .LVU225
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 147 15 view .LVU226
+	leaq	.LC28(%rip), %rcx
+	leaq	.LC29(%rip), %rax
+	.loc 1 145 47 view .LVU227
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 147 15 view .LVU228
+	vmovq	%rcx, %xmm1
+	leaq	.LC26(%rip), %rcx
+	.loc 1 145 47 view .LVU229
+	pushq	%r14
+	.loc 1 147 15 view .LVU230
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovq	%rcx, %xmm0
+	.loc 1 145 47 view .LVU231
+	pushq	%r13
+	.loc 1 147 15 view .LVU232
+	leaq	.LC27(%rip), %rax
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 145 47 view .LVU233
+	pushq	%r12
+	.loc 1 147 15 view .LVU234
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC30(%rip), %rcx
+	.loc 1 145 47 view .LVU235
+	pushq	%rbx
+	.loc 1 147 15 view .LVU236
+	leaq	.LC31(%rip), %rax
+	.loc 1 152 3 view .LVU237
+	leaq	.LC40(%rip), %rdi
+	.loc 1 145 47 view .LVU238
+	andq	$-32, %rsp
+	subq	$160, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 147 15 view .LVU239
+	vmovdqa	%ymm0, 32(%rsp)
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	.loc 1 148 15 view .LVU240
+	leaq	.LC35(%rip), %rcx
+	.loc 1 147 15 view .LVU241
+	leaq	.LC32(%rip), %rax
+	movq	%rax, 80(%rsp)
+	.loc 1 148 3 is_stmt 1 view .LVU242
+	.loc 1 148 15 is_stmt 0 view .LVU243
+	vmovq	%rcx, %xmm1
+	leaq	.LC36(%rip), %rax
+	leaq	.LC33(%rip), %rcx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	.loc 1 147 15 view .LVU244
+	vmovdqa	%xmm0, 64(%rsp)
+	.loc 1 148 15 view .LVU245
+	leaq	.LC34(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC37(%rip), %rcx
+	vmovdqa	%ymm0, 96(%rsp)
+	leaq	.LC38(%rip), %rax
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC39(%rip), %rax
+	movq	%rax, 144(%rsp)
+	.loc 1 150 3 is_stmt 1 view .LVU246
+.LVL79:
+	.loc 1 152 3 view .LVU247
+	.loc 1 148 15 is_stmt 0 view .LVU248
+	vmovdqa	%xmm0, 128(%rsp)
+	leaq	32(%rsp), %r13
+	.loc 1 152 3 view .LVU249
+	vzeroupper
+.LVL80:
+	leaq	96(%rsp), %r14
+	call	puts@PLT
+.LVL81:
+	.loc 1 154 3 is_stmt 1 view .LVU250
+	.loc 1 155 3 view .LVU251
+.LBB19:
+	.loc 1 155 8 view .LVU252
+	.loc 1 155 21 view .LVU253
+.LBE19:
+	.loc 1 152 3 is_stmt 0 view .LVU254
+	xorl	%r12d, %r12d
+	.loc 1 154 7 view .LVU255
+	xorl	%r15d, %r15d
+	jmp	.L76
+.LVL82:
+	.p2align 4,,10
+	.p2align 3
+.L73:
+.LBB23:
+.LBB20:
+	.loc 1 159 7 is_stmt 1 view .LVU256
+	leaq	.LC41(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL83:
+	.loc 1 160 7 view .LVU257
+	.loc 1 160 19 is_stmt 0 view .LVU258
+	movl	$1, %r15d
+.LVL84:
+.L75:
+	.loc 1 166 5 is_stmt 1 discriminator 2 view .LVU259
+	movq	%rbx, %rdi
+.LBE20:
+	.loc 1 155 21 is_stmt 0 discriminator 2 view .LVU260
+	addq	$8, %r12
+.LVL85:
+.LBB21:
+	.loc 1 166 5 discriminator 2 view .LVU261
+	call	st_destroy@PLT
+.LVL86:
+.LBE21:
+	.loc 1 155 35 is_stmt 1 discriminator 2 view .LVU262
+	.loc 1 155 21 discriminator 2 view .LVU263
+	cmpq	$56, %r12
+	je	.L79
+.LVL87:
+.L76:
+.LBB22:
+	.loc 1 156 5 view .LVU264
+	.loc 1 156 41 is_stmt 0 view .LVU265
+	movl	$2, %edi
+	call	st_create_empty@PLT
+.LVL88:
+	.loc 1 157 25 view .LVU266
+	movq	$0, 16(%rax)
+	.loc 1 158 9 view .LVU267
+	movq	0(%r13,%r12), %rsi
+	movq	%rax, %rdi
+	.loc 1 156 41 view .LVU268
+	movq	%rax, %rbx
+.LVL89:
+	.loc 1 157 5 is_stmt 1 view .LVU269
+	.loc 1 158 5 view .LVU270
+	.loc 1 158 9 is_stmt 0 view .LVU271
+	call	st_append_escaped_string@PLT
+.LVL90:
+	.loc 1 158 71 view .LVU272
+	movq	(%r14,%r12), %rsi
+	.loc 1 158 87 view .LVU273
+	movq	(%rbx), %rdx
+	.loc 1 158 8 view .LVU274
+	testl	%eax, %eax
+	je	.L73
+	.loc 1 158 71 discriminator 1 view .LVU275
+	movq	%rdx, %rdi
+	movq	%rsi, 16(%rsp)
+	movq	%rdx, 24(%rsp)
+	call	strcmp@PLT
+.LVL91:
+	.loc 1 158 68 discriminator 1 view .LVU276
+	testl	%eax, %eax
+	movq	24(%rsp), %rdx
+	movq	16(%rsp), %rsi
+	jne	.L73
+	.loc 1 164 7 is_stmt 1 view .LVU277
+	movq	%rdx, %rsi
+	leaq	.LC42(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL92:
+	jmp	.L75
+.LVL93:
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.loc 1 164 7 is_stmt 0 view .LVU278
+.LBE22:
+.LBE23:
+	.loc 1 168 3 is_stmt 1 view .LVU279
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL94:
+	.loc 1 170 3 view .LVU280
+	.loc 1 171 1 is_stmt 0 view .LVU281
+	leaq	-40(%rbp), %rsp
+	popq	%rbx
+.LVL95:
+	.loc 1 171 1 view .LVU282
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	movl	%r15d, %eax
+	popq	%r15
+.LVL96:
+	.loc 1 171 1 view .LVU283
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	run_st_append_escaped_string_unit_tests, .-run_st_append_escaped_string_unit_tests
+	.section	.rodata.str1.1
+.LC44:
+	.string	"callback"
+.LC45:
+	.string	"FILE*"
+.LC46:
+	.string	"fd"
+	.section	.rodata.str1.8
+	.align 8
+.LC47:
+	.string	"------------------- st_create_from_*(x) -------------------"
+	.align 8
+.LC48:
+	.string	"  {\"name\" : \"streaming tokenizer\", \"values\": [12345, -6.5e2, 0.125],\n \"ok\": true, \"end\": \"\"}"
+	.align 8
+.LC49:
+	.string	"name|streaming tokenizer|values|12345|-650|0.125|ok|true|end||"
+	.align 8
+.LC50:
+	.string	"[Failed] %s stream with chunks of %zu failed: got '%s'.\n"
+	.align 8
+.LC51:
+	.string	"[Passed] %s stream with chunks of %zu.\n"
+	.align 8
+.LC54:
+	.string	"[Failed] in-memory tokenizer failed: got '%s'.\n"
+	.align 8
+.LC55:
+	.string	"[Passed] in-memory tokenizer finds the same tokens."
+	.text
+	.p2align 4
+	.globl	run_st_stream_unit_tests
+	.type	run_st_stream_unit_tests, @function
+run_st_stream_unit_tests:
+.LFB31:
+	.loc 1 176 32 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 178 3 view .LVU285
+	.loc 1 176 32 is_stmt 0 view .LVU286
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 179 15 view .LVU287
+	leaq	.LC44(%rip), %rcx
+	leaq	.LC45(%rip), %rax
+	.loc 1 176 32 view .LVU288
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 184 3 view .LVU289
+	leaq	.LC47(%rip), %rdi
+	.loc 1 176 32 view .LVU290
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-32, %rsp
+	subq	$480, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 178 10 view .LVU291
+	vmovdqa	.LC43(%rip), %ymm0
+	leaq	96(%rsp), %r14
+	vmovdqa	%ymm0, 96(%rsp)
+	.loc 1 179 3 is_stmt 1 view .LVU292
+	.loc 1 179 15 is_stmt 0 view .LVU293
+	vmovq	%rcx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC46(%rip), %rax
+	movq	%rax, 80(%rsp)
+	.loc 1 181 3 is_stmt 1 view .LVU294
+.LVL97:
+	.loc 1 182 3 view .LVU295
+	.loc 1 184 3 view .LVU296
+	.loc 1 179 15 is_stmt 0 view .LVU297
+	vmovdqa	%xmm0, 64(%rsp)
+	leaq	224(%rsp), %r13
+	.loc 1 184 3 view .LVU298
+	vzeroupper
+.LVL98:
+	call	puts@PLT
+.LVL99:
+	.loc 1 186 3 is_stmt 1 view .LVU299
+	.loc 1 187 3 view .LVU300
+.LBB24:
+	.loc 1 187 8 view .LVU301
+	.loc 1 187 21 view .LVU302
+	leaq	128(%rsp), %rax
+	movq	%rax, 24(%rsp)
+.LBE24:
+	.loc 1 186 7 is_stmt 0 view .LVU303
+	movl	$0, 36(%rsp)
+	leaq	64(%rsp), %r15
+.LVL100:
+.L81:
+.LBB35:
+.LBB25:
+	.loc 1 188 23 is_stmt 1 view .LVU304
+.LBE25:
+.LBE35:
+	.loc 1 176 32 is_stmt 0 view .LVU305
+	xorl	%ebx, %ebx
+.LVL101:
+.L99:
+.LBB36:
+.LBB32:
+.LBB26:
+	.loc 1 189 7 is_stmt 1 view .LVU306
+	.loc 1 189 34 is_stmt 0 view .LVU307
+	leaq	.LC48(%rip), %rax
+	movq	%rax, 128(%rsp)
+	movq	$92, 136(%rsp)
+	movq	$0, 144(%rsp)
+	.loc 1 190 7 is_stmt 1 view .LVU308
+.LVL102:
+	.loc 1 191 7 view .LVU309
+	.loc 1 192 7 view .LVU310
+	.loc 1 192 11 is_stmt 0 view .LVU311
+	movq	$-1, 56(%rsp)
+	.loc 1 193 7 is_stmt 1 view .LVU312
+	.loc 1 193 10 is_stmt 0 view .LVU313
+	testq	%rbx, %rbx
+	je	.L108
+	.loc 1 196 12 is_stmt 1 view .LVU314
+	.loc 1 196 15 is_stmt 0 view .LVU315
+	cmpq	$1, %rbx
+	je	.L109
+	.loc 1 201 12 is_stmt 1 view .LVU316
+	.loc 1 201 26 is_stmt 0 view .LVU317
+	leaq	56(%rsp), %rdi
+	call	pipe@PLT
+.LVL103:
+	.loc 1 201 23 view .LVU318
+	testl	%eax, %eax
+	je	.L110
+.L107:
+	.loc 1 206 7 is_stmt 1 view .LVU319
+	.loc 1 206 12 is_stmt 0 view .LVU320
+	vpxor	%xmm0, %xmm0, %xmm0
+	vmovdqu64	%zmm0, 224(%rsp)
+	vmovdqu64	%zmm0, 288(%rsp)
+	vmovdqu64	%zmm0, 352(%rsp)
+	vmovdqu64	%zmm0, 416(%rsp)
+	.loc 1 207 7 is_stmt 1 view .LVU321
+	.loc 1 194 21 is_stmt 0 view .LVU322
+	movq	(%r14), %rdx
+	movq	$0, 40(%rsp)
+	.loc 1 190 31 view .LVU323
+	xorl	%r12d, %r12d
+	vzeroupper
+.LVL104:
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	.loc 1 212 9 is_stmt 1 view .LVU324
+	movq	(%r15,%rbx,8), %rsi
+	movq	%r13, %rcx
+	leaq	.LC50(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL105:
+	.loc 1 213 9 view .LVU325
+	.loc 1 213 21 is_stmt 0 view .LVU326
+	movl	$1, 36(%rsp)
+.LVL106:
+.L93:
+	.loc 1 219 7 is_stmt 1 view .LVU327
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL107:
+	.loc 1 220 7 view .LVU328
+	.loc 1 220 10 is_stmt 0 view .LVU329
+	movq	40(%rsp), %rax
+	testq	%rax, %rax
+	je	.L94
+	.loc 1 221 9 is_stmt 1 view .LVU330
+	movq	%rax, %rdi
+	call	fclose@PLT
+.LVL108:
+.L94:
+	.loc 1 223 7 view .LVU331
+	.loc 1 223 14 is_stmt 0 view .LVU332
+	movl	56(%rsp), %edi
+	.loc 1 223 10 view .LVU333
+	testl	%edi, %edi
+	jns	.L111
+.LBE26:
+	.loc 1 188 39 is_stmt 1 discriminator 2 view .LVU334
+.LVL109:
+	.loc 1 188 23 discriminator 2 view .LVU335
+	incq	%rbx
+.LVL110:
+	.loc 1 188 23 is_stmt 0 discriminator 2 view .LVU336
+	cmpq	$3, %rbx
+	jne	.L99
+.LVL111:
+.L97:
+	.loc 1 188 23 discriminator 2 view .LVU337
+.LBE32:
+	.loc 1 187 36 is_stmt 1 discriminator 2 view .LVU338
+	.loc 1 187 21 discriminator 2 view .LVU339
+	movq	24(%rsp), %rax
+	addq	$8, %r14
+.LVL112:
+	.loc 1 187 21 is_stmt 0 discriminator 2 view .LVU340
+	cmpq	%rax, %r14
+	jne	.L81
+.LBE36:
+	.loc 1 229 3 is_stmt 1 view .LVU341
+	.loc 1 229 8 is_stmt 0 view .LVU342
+	vmovdqa64	.LC52(%rip), %zmm1
+	vmovdqa	.LC53(%rip), %ymm2
+	vmovdqu64	%zmm1, 128(%rsp)
+	.loc 1 230 39 view .LVU343
+	movq	%r14, %rdi
+	.loc 1 229 8 view .LVU344
+	vmovdqu	%ymm2, 189(%rsp)
+	.loc 1 230 3 is_stmt 1 view .LVU345
+	.loc 1 230 39 is_stmt 0 view .LVU346
+	vzeroupper
+.LVL113:
+	call	st_create@PLT
+.LVL114:
+	.loc 1 232 3 view .LVU347
+	movq	%rax, %rdi
+	movq	%r13, %rsi
+	.loc 1 230 39 view .LVU348
+	movq	%rax, %rbx
+.LVL115:
+	.loc 1 231 3 is_stmt 1 view .LVU349
+	.loc 1 232 3 view .LVU350
+	call	tokenizer_test_walk.constprop.0
+.LVL116:
+	.loc 1 233 3 view .LVU351
+	.loc 1 233 7 is_stmt 0 view .LVU352
+	leaq	.LC49(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp@PLT
+.LVL117:
+	.loc 1 233 6 view .LVU353
+	testl	%eax, %eax
+	je	.L100
+	.loc 1 234 5 is_stmt 1 view .LVU354
+	movq	%r13, %rsi
+	leaq	.LC54(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL118:
+	.loc 1 235 5 view .LVU355
+	.loc 1 235 17 is_stmt 0 view .LVU356
+	movl	$1, 36(%rsp)
+.LVL119:
+.L101:
+	.loc 1 240 3 is_stmt 1 view .LVU357
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL120:
+	.loc 1 241 3 view .LVU358
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL121:
+	.loc 1 243 3 view .LVU359
+	.loc 1 244 1 is_stmt 0 view .LVU360
+	movl	36(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL122:
+	.loc 1 244 1 view .LVU361
+	popq	%rbx
+.LVL123:
+	.loc 1 244 1 view .LVU362
+	popq	%r12
+	popq	%r13
+	popq	%r14
+.LVL124:
+	.loc 1 244 1 view .LVU363
+	popq	%r15
+.LVL125:
+	.loc 1 244 1 view .LVU364
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL126:
+	.loc 1 244 1 view .LVU365
+	ret
+.LVL127:
+	.p2align 4,,10
+	.p2align 3
+.L111:
+	.cfi_restore_state
+.LBB37:
+.LBB33:
+.LBB28:
+	.loc 1 224 9 is_stmt 1 view .LVU366
+.LBE28:
+	.loc 1 188 23 is_stmt 0 view .LVU367
+	incq	%rbx
+.LVL128:
+.LBB29:
+	.loc 1 224 9 view .LVU368
+	call	close@PLT
+.LVL129:
+.LBE29:
+	.loc 1 188 39 is_stmt 1 view .LVU369
+	.loc 1 188 23 view .LVU370
+	cmpq	$3, %rbx
+	jne	.L99
+	jmp	.L97
+.LVL130:
+	.p2align 4,,10
+	.p2align 3
+.L108:
+.LBB30:
+	.loc 1 194 9 view .LVU371
+	.loc 1 194 21 is_stmt 0 view .LVU372
+	movq	(%r14), %rdx
+	movq	24(%rsp), %rsi
+	leaq	tokenizer_test_read(%rip), %rdi
+	call	st_create_from_callback@PLT
+.LVL131:
+	.loc 1 191 13 view .LVU373
+	movq	$0, 40(%rsp)
+	.loc 1 194 21 view .LVU374
+	movq	%rax, %r12
+.LVL132:
+.L83:
+	.loc 1 206 7 is_stmt 1 view .LVU375
+	.loc 1 206 12 is_stmt 0 view .LVU376
+	vpxor	%xmm0, %xmm0, %xmm0
+	vmovdqu64	%zmm0, 224(%rsp)
+	vmovdqu64	%zmm0, 288(%rsp)
+	vmovdqu64	%zmm0, 352(%rsp)
+	vmovdqu64	%zmm0, 416(%rsp)
+	.loc 1 207 7 is_stmt 1 view .LVU377
+	.loc 1 207 10 is_stmt 0 view .LVU378
+	testq	%r12, %r12
+	je	.L112
+	.loc 1 208 9 is_stmt 1 view .LVU379
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	vzeroupper
+.LVL133:
+	call	tokenizer_test_walk.constprop.0
+.LVL134:
+	.loc 1 211 7 view .LVU380
+	.loc 1 211 31 is_stmt 0 view .LVU381
+	leaq	.LC49(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp@PLT
+.LVL135:
+	.loc 1 194 21 view .LVU382
+	movq	(%r14), %rdx
+	.loc 1 211 28 view .LVU383
+	testl	%eax, %eax
+	jne	.L88
+	.loc 1 211 140 discriminator 2 view .LVU384
+	movq	48(%r12), %rax
+	.loc 1 211 168 discriminator 2 view .LVU385
+	leaq	64(%rdx), %rcx
+	.loc 1 217 9 discriminator 2 view .LVU386
+	movq	(%r15,%rbx,8), %rsi
+	.loc 1 211 120 discriminator 2 view .LVU387
+	cmpq	32(%rax), %rcx
+	jb	.L88
+	.loc 1 217 9 is_stmt 1 view .LVU388
+	leaq	.LC51(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL136:
+	jmp	.L93
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	.loc 1 194 21 is_stmt 0 view .LVU389
+	movq	(%r14), %rdx
+	vzeroupper
+.LVL137:
+	jmp	.L88
+.LVL138:
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	.loc 1 196 34 discriminator 1 view .LVU390
+	call	tmpfile@PLT
+.LVL139:
+	movq	%rax, 40(%rsp)
+.LVL140:
+	.loc 1 196 34 discriminator 1 view .LVU391
+	movq	%rax, %r12
+	.loc 1 196 23 discriminator 1 view .LVU392
+	testq	%rax, %rax
+	je	.L85
+	.loc 1 197 9 is_stmt 1 view .LVU393
+	movq	%rax, %rcx
+	movl	$92, %edx
+	movl	$1, %esi
+	leaq	.LC48(%rip), %rdi
+	call	fwrite@PLT
+.LVL141:
+	.loc 1 198 9 view .LVU394
+	movq	%r12, %rdi
+	call	rewind@PLT
+.LVL142:
+	.loc 1 199 9 view .LVU395
+	.loc 1 199 21 is_stmt 0 view .LVU396
+	movq	(%r14), %rsi
+	movq	%r12, %rdi
+	call	st_create_from_file@PLT
+.LVL143:
+	movq	%rax, %r12
+.LVL144:
+	.loc 1 199 19 view .LVU397
+	jmp	.L83
+.LVL145:
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	.loc 1 199 19 view .LVU398
+.LBE30:
+.LBE33:
+.LBE37:
+	.loc 1 238 5 is_stmt 1 view .LVU399
+	leaq	.LC55(%rip), %rdi
+	call	puts@PLT
+.LVL146:
+	jmp	.L101
+.LVL147:
+	.p2align 4,,10
+	.p2align 3
+.L110:
+.LBB38:
+.LBB34:
+.LBB31:
+.LBB27:
+	.loc 1 202 9 view .LVU400
+	.loc 1 202 27 is_stmt 0 view .LVU401
+	movl	60(%rsp), %edi
+	movq	136(%rsp), %rdx
+	movq	128(%rsp), %rsi
+	call	write@PLT
+.LVL148:
+	.loc 1 203 9 view .LVU402
+	movl	60(%rsp), %edi
+	.loc 1 202 27 view .LVU403
+	movq	%rax, %r12
+.LVL149:
+	.loc 1 203 9 is_stmt 1 view .LVU404
+	call	close@PLT
+.LVL150:
+	.loc 1 204 9 view .LVU405
+	.loc 1 204 99 is_stmt 0 view .LVU406
+	cmpq	%r12, 136(%rsp)
+	jne	.L107
+	.loc 1 204 57 discriminator 1 view .LVU407
+	movq	(%r14), %rsi
+	movl	56(%rsp), %edi
+	call	st_create_from_fd@PLT
+.LVL151:
+	movq	%rax, %r12
+.LVL152:
+	.loc 1 204 57 discriminator 1 view .LVU408
+	movq	$0, 40(%rsp)
+	jmp	.L83
+.LVL153:
+.L85:
+	.loc 1 204 57 discriminator 1 view .LVU409
+.LBE27:
+	.loc 1 201 12 is_stmt 1 view .LVU410
+	.loc 1 206 7 view .LVU411
+	.loc 1 206 12 is_stmt 0 view .LVU412
+	vpxor	%xmm0, %xmm0, %xmm0
+	leaq	288(%rsp), %rdi
+	xorl	%eax, %eax
+	movl	$48, %ecx
+	vmovdqu64	%zmm0, 224(%rsp)
+	rep stosl
+	.loc 1 207 7 is_stmt 1 view .LVU413
+	.loc 1 190 31 is_stmt 0 view .LVU414
+	xorl	%r12d, %r12d
+	.loc 1 194 21 view .LVU415
+	movq	(%r14), %rdx
+	vzeroupper
+.LVL154:
+	jmp	.L88
+.LBE31:
+.LBE34:
+.LBE38:
+	.cfi_endproc
+.LFE31:
+	.size	run_st_stream_unit_tests, .-run_st_stream_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC56:
+	.string	"------------------- st_create_from_mmap(x) -------------------"
+	.align 8
+.LC57:
+	.string	"[Failed] st_create_from_mmap() failed: could not create a temporary file."
+	.align 8
+.LC59:
+	.string	"[Failed] st_create_from_mmap() failed: got '%s'.\n"
+	.align 8
+.LC60:
+	.string	"name|streaming tokenizer|values|12345|-650|0.125|ok|true|end||125|"
+	.align 8
+.LC61:
+	.string	"[Passed] st_create_from_mmap() tokenizes %zu bytes in place.\n"
+	.align 8
+.LC62:
+	.string	"[Failed] st_shrink_to_fit() and st_append_string() resized the mapped string."
+	.section	.rodata.str1.1
+.LC63:
+	.string	"x"
+	.section	.rodata.str1.8
+	.align 8
+.LC64:
+	.string	"[Passed] st_shrink_to_fit() and st_append_string() refuse the mapped string."
+	.align 8
+.LC65:
+	.string	"[Failed] st_create_from_mmap() failed: mapped a missing or empty file."
+	.section	.rodata.str1.1
+.LC66:
+	.string	"/dev/null"
+	.section	.rodata.str1.8
+	.align 8
+.LC67:
+	.string	"[Passed] st_create_from_mmap() rejects missing and empty files."
+	.text
+	.p2align 4
+	.globl	run_st_create_from_mmap_unit_tests
+	.type	run_st_create_from_mmap_unit_tests, @function
+run_st_create_from_mmap_unit_tests:
+.LFB32:
+	.loc 1 249 42 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 251 3 view .LVU417
+	.loc 1 249 42 is_stmt 0 view .LVU418
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 251 3 view .LVU419
+	leaq	.LC56(%rip), %rdi
+	.loc 1 249 42 view .LVU420
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$296, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 251 3 view .LVU421
+	call	puts@PLT
+.LVL155:
+	.loc 1 253 3 is_stmt 1 view .LVU422
+	.loc 1 254 12 is_stmt 0 view .LVU423
+	movq	%rsp, %r13
+	.loc 1 253 8 view .LVU424
+	vmovdqa	.LC68(%rip), %xmm0
+	movabsq	$24866934413088863, %rax
+	.loc 1 254 12 view .LVU425
+	movq	%r13, %rdi
+	.loc 1 253 8 view .LVU426
+	movq	%rax, 16(%rsp)
+	.loc 1 254 3 is_stmt 1 view .LVU427
+	.loc 1 253 8 is_stmt 0 view .LVU428
+	vmovdqa	%xmm0, (%rsp)
+	.loc 1 254 12 view .LVU429
+	call	mkstemp@PLT
+.LVL156:
+	.loc 1 255 3 is_stmt 1 view .LVU430
+	.loc 1 255 6 is_stmt 0 view .LVU431
+	testl	%eax, %eax
+	js	.L130
+	.loc 1 259 30 view .LVU432
+	movl	$30, %edi
+	movl	%eax, %r14d
+	.loc 1 259 3 is_stmt 1 view .LVU433
+	.loc 1 259 30 is_stmt 0 view .LVU434
+	call	sysconf@PLT
+.LVL157:
+	.loc 1 260 28 view .LVU435
+	movq	%rax, %rdi
+	.loc 1 259 30 view .LVU436
+	movq	%rax, %rbx
+.LVL158:
+	.loc 1 260 3 is_stmt 1 view .LVU437
+	.loc 1 260 28 is_stmt 0 view .LVU438
+	call	malloc@PLT
+.LVL159:
+	.loc 1 261 3 view .LVU439
+	movq	%rax, %rdi
+	movq	%rbx, %rdx
+	movl	$32, %esi
+	.loc 1 260 28 view .LVU440
+	movq	%rax, %r12
+.LVL160:
+	.loc 1 261 3 is_stmt 1 view .LVU441
+	call	memset@PLT
+.LVL161:
+	.loc 1 262 3 view .LVU442
+	vmovdqa64	.LC52(%rip), %zmm1
+	vmovdqa	.LC58(%rip), %ymm2
+	.loc 1 263 31 is_stmt 0 view .LVU443
+	leaq	-3(%r12,%rbx), %rax
+	.loc 1 263 3 view .LVU444
+	movl	$12849, %edx
+	.loc 1 262 3 view .LVU445
+	vmovdqu64	%zmm1, (%r12)
+	vmovdqu	%ymm2, 60(%r12)
+	.loc 1 263 3 is_stmt 1 view .LVU446
+	movw	%dx, (%rax)
+	movb	$53, 2(%rax)
+	.loc 1 264 3 view .LVU447
+	.loc 1 264 21 is_stmt 0 view .LVU448
+	movq	%rbx, %rdx
+	movq	%r12, %rsi
+	movl	%r14d, %edi
+	vzeroupper
+.LVL162:
+	call	write@PLT
+.LVL163:
+	.loc 1 265 3 view .LVU449
+	movl	%r14d, %edi
+	.loc 1 264 21 view .LVU450
+	movq	%rax, %r15
+.LVL164:
+	.loc 1 265 3 is_stmt 1 view .LVU451
+	call	close@PLT
+.LVL165:
+	.loc 1 266 3 view .LVU452
+	movq	%r12, %rdi
+	call	free@PLT
+.LVL166:
+	.loc 1 268 3 view .LVU453
+	.loc 1 269 3 view .LVU454
+	.loc 1 269 97 is_stmt 0 view .LVU455
+	cmpq	%r15, %rbx
+	je	.L116
+.LVL167:
+	.loc 1 270 3 is_stmt 1 view .LVU456
+	.loc 1 270 8 is_stmt 0 view .LVU457
+	vpxor	%xmm0, %xmm0, %xmm0
+	vmovdqu64	%zmm0, 32(%rsp)
+	vmovdqu64	%zmm0, 96(%rsp)
+	vmovdqu64	%zmm0, 160(%rsp)
+	vmovdqu64	%zmm0, 224(%rsp)
+.LVL168:
+.L129:
+	.loc 1 271 3 is_stmt 1 view .LVU458
+	.loc 1 275 5 view .LVU459
+	xorl	%eax, %eax
+	leaq	32(%rsp), %rsi
+	leaq	.LC59(%rip), %rdi
+	vzeroupper
+.LVL169:
+	.loc 1 276 17 is_stmt 0 view .LVU460
+	movl	$1, %r14d
+.LVL170:
+	.loc 1 275 5 view .LVU461
+	call	printf@PLT
+.LVL171:
+	.loc 1 276 5 is_stmt 1 view .LVU462
+	.loc 1 282 3 view .LVU463
+	.loc 1 276 17 is_stmt 0 view .LVU464
+	xorl	%r12d, %r12d
+.LVL172:
+.L117:
+	.loc 1 292 3 is_stmt 1 view .LVU465
+	movq	%r12, %rdi
+	call	st_destroy@PLT
+.LVL173:
+	.loc 1 293 3 view .LVU466
+	movq	%r13, %rdi
+	call	unlink@PLT
+.LVL174:
+	.loc 1 295 3 view .LVU467
+	.loc 1 295 7 is_stmt 0 view .LVU468
+	movq	%r13, %rdi
+	call	st_create_from_mmap@PLT
+.LVL175:
+	.loc 1 295 6 view .LVU469
+	testq	%rax, %rax
+	je	.L125
+.L127:
+	.loc 1 296 5 is_stmt 1 view .LVU470
+	leaq	.LC65(%rip), %rdi
+	call	puts@PLT
+.LVL176:
+	.loc 1 297 5 view .LVU471
+	.loc 1 297 17 is_stmt 0 view .LVU472
+	movl	$1, %r14d
+.LVL177:
+.L126:
+	.loc 1 302 3 is_stmt 1 view .LVU473
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL178:
+	.loc 1 304 3 view .LVU474
+.L113:
+	.loc 1 305 1 is_stmt 0 view .LVU475
+	addq	$296, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	movl	%r14d, %eax
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+	ret
+.LVL179:
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	.cfi_restore_state
+	.loc 1 256 5 is_stmt 1 view .LVU476
+	leaq	.LC57(%rip), %rdi
+	call	puts@PLT
+.LVL180:
+	.loc 1 257 5 view .LVU477
+	.loc 1 257 11 is_stmt 0 view .LVU478
+	movl	$1, %r14d
+	jmp	.L113
+.LVL181:
+	.p2align 4,,10
+	.p2align 3
+.L125:
+	.loc 1 295 43 discriminator 1 view .LVU479
+	leaq	.LC66(%rip), %rdi
+	call	st_create_from_mmap@PLT
+.LVL182:
+	.loc 1 295 40 discriminator 1 view .LVU480
+	testq	%rax, %rax
+	jne	.L127
+	.loc 1 300 5 is_stmt 1 view .LVU481
+	leaq	.LC67(%rip), %rdi
+	call	puts@PLT
+.LVL183:
+	jmp	.L126
+.LVL184:
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	.loc 1 269 71 is_stmt 0 discriminator 1 view .LVU482
+	movq	%r13, %rdi
+	call	st_create_from_mmap@PLT
+.LVL185:
+	.loc 1 270 8 discriminator 1 view .LVU483
+	vpxor	%xmm0, %xmm0, %xmm0
+	.loc 1 269 71 discriminator 1 view .LVU484
+	movq	%rax, %r12
+.LVL186:
+	.loc 1 270 3 is_stmt 1 discriminator 1 view .LVU485
+	.loc 1 270 8 is_stmt 0 discriminator 1 view .LVU486
+	vmovdqu64	%zmm0, 32(%rsp)
+	vmovdqu64	%zmm0, 96(%rsp)
+	vmovdqu64	%zmm0, 160(%rsp)
+	vmovdqu64	%zmm0, 224(%rsp)
+	.loc 1 271 3 is_stmt 1 discriminator 1 view .LVU487
+	.loc 1 271 6 is_stmt 0 discriminator 1 view .LVU488
+	testq	%rax, %rax
+	je	.L129
+	.loc 1 272 5 is_stmt 1 view .LVU489
+	leaq	32(%rsp), %r15
+.LVL187:
+	.loc 1 272 5 is_stmt 0 view .LVU490
+	movq	%r15, %rsi
+	movq	%rax, %rdi
+	vzeroupper
+.LVL188:
+	call	tokenizer_test_walk.constprop.0
+.LVL189:
+	.loc 1 274 3 is_stmt 1 view .LVU491
+	.loc 1 274 24 is_stmt 0 view .LVU492
+	cmpq	%rbx, 8(%r12)
+	je	.L131
+.LVL190:
+.L119:
+	.loc 1 275 5 is_stmt 1 view .LVU493
+	movq	%r15, %rsi
+	leaq	.LC59(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL191:
+	.loc 1 276 5 view .LVU494
+	.loc 1 282 3 view .LVU495
+	.loc 1 276 17 is_stmt 0 view .LVU496
+	movl	$1, %r14d
+.LVL192:
+.L121:
+	.loc 1 283 5 is_stmt 1 view .LVU497
+	movq	%r12, %rdi
+	call	st_reset@PLT
+.LVL193:
+	.loc 1 284 5 view .LVU498
+	.loc 1 284 9 is_stmt 0 view .LVU499
+	movq	%r12, %rdi
+	call	st_shrink_to_fit@PLT
+.LVL194:
+	.loc 1 284 8 view .LVU500
+	testl	%eax, %eax
+	jne	.L124
+	.loc 1 284 45 discriminator 1 view .LVU501
+	leaq	(%rbx,%rbx), %rsi
+	movq	%r12, %rdi
+	call	st_reserve@PLT
+.LVL195:
+	.loc 1 284 42 discriminator 1 view .LVU502
+	testl	%eax, %eax
+	je	.L132
+.L124:
+	.loc 1 285 7 is_stmt 1 view .LVU503
+	leaq	.LC62(%rip), %rdi
+	call	puts@PLT
+.LVL196:
+	.loc 1 286 7 view .LVU504
+	.loc 1 276 17 is_stmt 0 view .LVU505
+	movl	$1, %r14d
+	.loc 1 286 19 view .LVU506
+	jmp	.L117
+.LVL197:
+	.p2align 4,,10
+	.p2align 3
+.L131:
+	.loc 1 274 61 discriminator 2 view .LVU507
+	leaq	.LC60(%rip), %rsi
+	movq	%r15, %rdi
+	call	strcmp@PLT
+.LVL198:
+	movl	%eax, %r14d
+.LVL199:
+	.loc 1 274 58 discriminator 2 view .LVU508
+	testl	%eax, %eax
+	jne	.L119
+	.loc 1 279 5 is_stmt 1 view .LVU509
+	movq	%rbx, %rsi
+	leaq	.LC61(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL200:
+	.loc 1 282 3 view .LVU510
+	jmp	.L121
+.LVL201:
+	.p2align 4,,10
+	.p2align 3
+.L132:
+	.loc 1 284 90 is_stmt 0 discriminator 2 view .LVU511
+	leaq	.LC63(%rip), %rsi
+	movq	%r12, %rdi
+	call	st_append_string@PLT
+.LVL202:
+	.loc 1 284 87 discriminator 2 view .LVU512
+	testl	%eax, %eax
+	jne	.L124
+	.loc 1 289 7 is_stmt 1 view .LVU513
+	leaq	.LC64(%rip), %rdi
+	call	puts@PLT
+.LVL203:
+	jmp	.L117
+	.cfi_endproc
+.LFE32:
+	.size	run_st_create_from_mmap_unit_tests, .-run_st_create_from_mmap_unit_tests
+	.section	.rodata.str1.8
+	.align 8
+.LC69:
+	.string	"------------------- st_pool_acquire(x) -------------------"
+	.align 8
+.LC70:
+	.string	"[Failed] st_pool_acquire() failed: the grown tokenizer was not reused."
+	.align 8
+.LC71:
+	.string	"[Passed] st_pool_acquire() reuses a buffer of %zu bytes.\n"
+	.section	.rodata.str1.1
+.LC72:
+	.string	"kept"
+.LC73:
+	.string	"more"
+	.section	.rodata.str1.8
+	.align 8
+.LC74:
+	.string	"[Failed] st_detach_string() failed: got '%s'.\n"
+	.align 8
+.LC75:
+	.string	"[Passed] st_detach_string() keeps '%s'.\n"
+	.align 8
+.LC76:
+	.string	"[Failed] st_rebind() failed: the new string was not tokenized."
+	.section	.rodata.str1.1
+.LC77:
+	.string	"second"
+	.section	.rodata.str1.8
+	.align 8
+.LC78:
+	.string	"[Passed] st_rebind() tokenizes the new string."
+	.text
+	.p2align 4
+	.globl	run_st_pool_unit_tests
+	.type	run_st_pool_unit_tests, @function
+run_st_pool_unit_tests:
+.LFB33:
+	.loc 1 310 30 view -0
+	.cfi_startproc
+	.loc 1 312 3 view .LVU515
+	.loc 1 310 30 is_stmt 0 view .LVU516
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 312 3 view .LVU517
+	leaq	.LC69(%rip), %rdi
+	.loc 1 310 30 view .LVU518
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leaq	.LC8(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	.loc 1 315 39 view .LVU519
+	movl	$10000, %ebx
+	.loc 1 310 30 view .LVU520
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	.loc 1 312 3 view .LVU521
+	call	puts@PLT
+.LVL204:
+	.loc 1 313 3 is_stmt 1 view .LVU522
+	.loc 1 315 3 view .LVU523
+	.loc 1 315 39 is_stmt 0 view .LVU524
+	movl	$16, %edi
+	call	st_pool_acquire@PLT
+.LVL205:
+	movq	%rax, %r12
+.LVL206:
+	.loc 1 316 3 is_stmt 1 view .LVU525
+.LBB39:
+	.loc 1 316 8 view .LVU526
+	.loc 1 316 21 view .LVU527
+	.p2align 4,,10
+	.p2align 3
+.L134:
+	.loc 1 317 5 discriminator 3 view .LVU528
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	st_append_string@PLT
+.LVL207:
+	.loc 1 316 31 discriminator 3 view .LVU529
+	.loc 1 316 21 discriminator 3 view .LVU530
+	decl	%ebx
+	jne	.L134
+.LBE39:
+	.loc 1 319 3 view .LVU531
+	.loc 1 320 3 is_stmt 0 view .LVU532
+	movq	%r12, %rdi
+	.loc 1 319 10 view .LVU533
+	movq	8(%r12), %rbx
+.LVL208:
+	.loc 1 320 3 is_stmt 1 view .LVU534
+	call	st_pool_release@PLT
+.LVL209:
+	.loc 1 321 3 view .LVU535
+	.loc 1 321 36 is_stmt 0 view .LVU536
+	movl	$16, %edi
+	call	st_pool_acquire@PLT
+.LVL210:
+	movq	%rax, %rbp
+.LVL211:
+	.loc 1 322 3 is_stmt 1 view .LVU537
+	.loc 1 322 6 is_stmt 0 view .LVU538
+	cmpq	%rax, %r12
+	je	.L156
+.LVL212:
+.L135:
+	.loc 1 323 5 is_stmt 1 view .LVU539
+	leaq	.LC70(%rip), %rdi
+	call	puts@PLT
+.LVL213:
+	.loc 1 324 5 view .LVU540
+	.loc 1 324 17 is_stmt 0 view .LVU541
+	movl	$1, %r14d
+.LVL214:
+.L137:
+	.loc 1 330 3 is_stmt 1 view .LVU542
+	leaq	.LC72(%rip), %rsi
+	movq	%rbp, %rdi
+	call	st_append_string@PLT
+.LVL215:
+	.loc 1 331 3 view .LVU543
+	.loc 1 331 18 is_stmt 0 view .LVU544
+	movq	%rbp, %rdi
+	call	st_detach_string@PLT
+.LVL216:
+	.loc 1 333 37 view .LVU545
+	cmpq	$0, 16(%rbp)
+	.loc 1 331 18 view .LVU546
+	movq	%rax, %r13
+.LVL217:
+	.loc 1 333 3 is_stmt 1 view .LVU547
+	movl	$1, %r15d
+	.loc 1 333 37 is_stmt 0 view .LVU548
+	jne	.L138
+	.loc 1 338 21 discriminator 1 view .LVU549
+	cmpq	%rax, 0(%rbp)
+	sete	%r15b
+	.loc 1 338 14 discriminator 1 view .LVU550
+	testq	%rax, %rax
+	sete	%al
+.LVL218:
+	.loc 1 338 21 discriminator 1 view .LVU551
+	orl	%eax, %r15d
+.L138:
+	.loc 1 334 3 is_stmt 1 discriminator 6 view .LVU552
+.LBB40:
+	.loc 1 334 8 discriminator 6 view .LVU553
+.LVL219:
+	.loc 1 334 21 discriminator 6 view .LVU554
+.LBE40:
+	movl	$10000, %ebx
+.LVL220:
+	.loc 1 334 21 is_stmt 0 discriminator 6 view .LVU555
+	leaq	.LC73(%rip), %r12
+.LVL221:
+	.p2align 4,,10
+	.p2align 3
+.L139:
+.LBB41:
+	.loc 1 335 5 is_stmt 1 discriminator 3 view .LVU556
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	st_append_string@PLT
+.LVL222:
+	.loc 1 334 31 discriminator 3 view .LVU557
+	.loc 1 334 21 discriminator 3 view .LVU558
+	decl	%ebx
+	jne	.L139
+.LBE41:
+	.loc 1 337 3 view .LVU559
+	movq	%rbp, %rdi
+	call	st_pool_release@PLT
+.LVL223:
+	.loc 1 338 3 view .LVU560
+	.loc 1 338 6 is_stmt 0 view .LVU561
+	testb	%r15b, %r15b
+	jne	.L140
+	.loc 1 338 38 discriminator 1 view .LVU562
+	leaq	.LC72(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp@PLT
+.LVL224:
+	.loc 1 338 35 discriminator 1 view .LVU563
+	testl	%eax, %eax
+	je	.L141
+.L140:
+	.loc 1 339 5 is_stmt 1 view .LVU564
+	movq	%r13, %rsi
+	leaq	.LC74(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL225:
+	.loc 1 340 5 view .LVU565
+	.loc 1 340 17 is_stmt 0 view .LVU566
+	movl	$1, %r14d
+.LVL226:
+.L142:
+	.loc 1 345 3 is_stmt 1 view .LVU567
+	movq	%r13, %rdi
+	call	free@PLT
+.LVL227:
+	.loc 1 346 3 view .LVU568
+	call	st_pool_clear@PLT
+.LVL228:
+	.loc 1 348 3 view .LVU569
+	.loc 1 349 8 is_stmt 0 view .LVU570
+	vmovdqa	.LC79(%rip), %xmm0
+	.loc 1 348 8 view .LVU571
+	movabsq	$9698188397733410, %rax
+	movq	%rax, 8(%rsp)
+	.loc 1 349 3 is_stmt 1 view .LVU572
+	.loc 1 350 15 is_stmt 0 view .LVU573
+	leaq	8(%rsp), %rdi
+	.loc 1 349 8 view .LVU574
+	movl	$101, %eax
+	vmovdqa	%xmm0, 32(%rsp)
+	movw	%ax, 48(%rsp)
+	.loc 1 350 3 is_stmt 1 view .LVU575
+	.loc 1 352 3 is_stmt 0 view .LVU576
+	leaq	16(%rsp), %rbp
+.LVL229:
+	.loc 1 350 15 view .LVU577
+	call	st_create@PLT
+.LVL230:
+	movq	%rax, %rbx
+.LVL231:
+	.loc 1 351 3 is_stmt 1 view .LVU578
+	.loc 1 352 3 view .LVU579
+	movl	$34, %edx
+	movl	$34, %esi
+	movq	%rax, %rdi
+	movq	%rbp, %rcx
+	call	st_sub_string_view@PLT
+.LVL232:
+	.loc 1 353 3 view .LVU580
+	.loc 1 353 7 is_stmt 0 view .LVU581
+	leaq	32(%rsp), %rsi
+	movl	$8, %edx
+	movq	%rbx, %rdi
+	call	st_rebind@PLT
+.LVL233:
+	.loc 1 353 6 view .LVU582
+	testl	%eax, %eax
+	je	.L145
+	.loc 1 353 47 discriminator 1 view .LVU583
+	movq	%rbp, %rcx
+	movl	$34, %edx
+	movl	$34, %esi
+	movq	%rbx, %rdi
+	call	st_sub_string_view@PLT
+.LVL234:
+	.loc 1 353 44 discriminator 1 view .LVU584
+	testl	%eax, %eax
+	jne	.L157
+.L145:
+	.loc 1 354 5 is_stmt 1 view .LVU585
+	leaq	.LC76(%rip), %rdi
+	call	puts@PLT
+.LVL235:
+	.loc 1 355 5 view .LVU586
+	.loc 1 355 17 is_stmt 0 view .LVU587
+	movl	$1, %r14d
+.LVL236:
+.L144:
+	.loc 1 360 3 is_stmt 1 view .LVU588
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL237:
+	.loc 1 361 3 view .LVU589
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL238:
+	.loc 1 363 3 view .LVU590
+	.loc 1 364 1 is_stmt 0 view .LVU591
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL239:
+	.loc 1 364 1 view .LVU592
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL240:
+	.loc 1 364 1 view .LVU593
+	movl	%r14d, %eax
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL241:
+	.loc 1 364 1 view .LVU594
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL242:
+.L141:
+	.cfi_restore_state
+	.loc 1 343 5 is_stmt 1 view .LVU595
+	movq	%r13, %rsi
+	leaq	.LC75(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL243:
+	jmp	.L142
+.LVL244:
+.L156:
+	.loc 1 322 27 is_stmt 0 discriminator 1 view .LVU596
+	cmpq	%rbx, 8(%rax)
+	jne	.L135
+	.loc 1 322 55 discriminator 2 view .LVU597
+	cmpq	$0, 16(%rax)
+	jne	.L135
+	.loc 1 322 97 discriminator 3 view .LVU598
+	movq	(%rax), %rax
+.LVL245:
+	.loc 1 322 80 discriminator 3 view .LVU599
+	cmpb	$0, (%rax)
+	jne	.L135
+	.loc 1 327 5 is_stmt 1 view .LVU600
+	movq	%rbx, %rsi
+	leaq	.LC71(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL246:
+	.loc 1 313 7 is_stmt 0 view .LVU601
+	xorl	%r14d, %r14d
+	jmp	.L137
+.LVL247:
+.L157:
+	.loc 1 353 102 discriminator 2 view .LVU602
+	leaq	.LC77(%rip), %rsi
+	movq	%rbp, %rdi
+	call	sv_equals@PLT
+.LVL248:
+	.loc 1 353 99 discriminator 2 view .LVU603
+	testl	%eax, %eax
+	je	.L145
+	.loc 1 353 134 discriminator 3 view .LVU604
+	cmpq	$7, 16(%rbx)
+	jne	.L145
+	.loc 1 358 5 is_stmt 1 view .LVU605
+	leaq	.LC78(%rip), %rdi
+	call	puts@PLT
+.LVL249:
+	jmp	.L144
+	.cfi_endproc
+.LFE33:
+	.size	run_st_pool_unit_tests, .-run_st_pool_unit_tests
+	.section	.rodata.str1.1
+.LC80:
+	.string	"inline"
+.LC81:
+	.string	"on the heap"
+	.section	.rodata.str1.8
+	.align 8
+.LC83:
+	.string	"------------------- st_create_empty(x) inline buffer -------------------"
+	.section	.rodata.str1.1
+.LC84:
+	.string	"abcd"
+	.section	.rodata.str1.8
+	.align 8
+.LC85:
+	.string	"[Failed] %zu characters failed: inline is %d.\n"
+	.align 8
+.LC86:
+	.string	"[Passed] %zu characters are %s.\n"
+	.text
+	.p2align 4
+	.globl	run_st_inline_buffer_unit_tests
+	.type	run_st_inline_buffer_unit_tests, @function
+run_st_inline_buffer_unit_tests:
+.LFB34:
+	.loc 1 369 39 view -0
+	.cfi_startproc
+	.loc 1 371 3 view .LVU607
+	.loc 1 369 39 is_stmt 0 view .LVU608
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 375 3 view .LVU609
+	leaq	.LC83(%rip), %rdi
+	.loc 1 369 39 view .LVU610
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	leaq	.LC84(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	.loc 1 371 7 view .LVU611
+	vmovdqa	.LC82(%rip), %xmm0
+	leaq	32(%rsp), %r13
+	vmovdqa	%xmm0, 32(%rsp)
+	.loc 1 373 3 is_stmt 1 view .LVU612
+.LVL250:
+	.loc 1 375 3 view .LVU613
+	call	puts@PLT
+.LVL251:
+	.loc 1 377 3 view .LVU614
+	.loc 1 378 3 view .LVU615
+.LBB42:
+	.loc 1 378 8 view .LVU616
+	.loc 1 378 21 view .LVU617
+	leaq	48(%rsp), %rax
+	movq	%rax, 16(%rsp)
+.LBE42:
+	.loc 1 377 7 is_stmt 0 view .LVU618
+	movl	$0, 8(%rsp)
+.LVL252:
+.L165:
+.LBB48:
+.LBB43:
+	.loc 1 379 5 is_stmt 1 view .LVU619
+	.loc 1 379 41 is_stmt 0 view .LVU620
+	movl	$32, %edi
+	call	st_create_empty@PLT
+.LVL253:
+.LBB44:
+	.loc 1 380 38 view .LVU621
+	movl	0(%r13), %ebx
+.LBE44:
+	.loc 1 379 41 view .LVU622
+	movq	%rax, %rbp
+.LVL254:
+	.loc 1 380 5 is_stmt 1 view .LVU623
+.LBB45:
+	.loc 1 380 10 view .LVU624
+	.loc 1 380 23 view .LVU625
+	testl	%ebx, %ebx
+	jle	.L159
+	.loc 1 380 14 is_stmt 0 view .LVU626
+	xorl	%r14d, %r14d
+.LVL255:
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	.loc 1 381 7 is_stmt 1 discriminator 3 view .LVU627
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	.loc 1 380 44 is_stmt 0 discriminator 3 view .LVU628
+	incl	%r14d
+.LVL256:
+	.loc 1 381 7 discriminator 3 view .LVU629
+	call	st_append_string@PLT
+.LVL257:
+	.loc 1 380 44 is_stmt 1 discriminator 3 view .LVU630
+	.loc 1 380 23 discriminator 3 view .LVU631
+	cmpl	%ebx, %r14d
+	jne	.L160
+.LVL258:
+.L159:
+	.loc 1 380 23 is_stmt 0 discriminator 3 view .LVU632
+.LBE45:
+	.loc 1 383 5 is_stmt 1 view .LVU633
+	.loc 1 383 30 is_stmt 0 view .LVU634
+	movq	0(%rbp), %r14
+	.loc 1 383 39 view .LVU635
+	leaq	72(%rbp), %r15
+	cmpq	%r15, %r14
+	.loc 1 383 9 view .LVU636
+	sete	%al
+	.loc 1 383 39 view .LVU637
+	sete	15(%rsp)
+	.loc 1 383 9 view .LVU638
+	movzbl	%al, %eax
+	.loc 1 384 23 view .LVU639
+	sall	$2, %ebx
+	.loc 1 385 17 view .LVU640
+	movq	%r14, %rdi
+	.loc 1 384 12 view .LVU641
+	movslq	%ebx, %rbx
+	.loc 1 383 9 view .LVU642
+	movl	%eax, 4(%rsp)
+.LVL259:
+	.loc 1 384 5 is_stmt 1 view .LVU643
+	.loc 1 385 5 view .LVU644
+	.loc 1 385 17 is_stmt 0 view .LVU645
+	call	strlen@PLT
+.LVL260:
+	.loc 1 385 53 view .LVU646
+	cmpq	%rbx, %rax
+	jne	.L161
+	.loc 1 385 91 discriminator 1 view .LVU647
+	leaq	-4(%r14,%rax), %rdi
+	.loc 1 385 56 discriminator 1 view .LVU648
+	movl	$4, %edx
+	movq	%r12, %rsi
+	.loc 1 385 91 discriminator 1 view .LVU649
+	movq	%rax, 24(%rsp)
+	.loc 1 385 56 discriminator 1 view .LVU650
+	call	strncmp@PLT
+.LVL261:
+	.loc 1 385 53 discriminator 1 view .LVU651
+	testl	%eax, %eax
+	jne	.L161
+.LVL262:
+	.loc 1 386 5 is_stmt 1 view .LVU652
+	.loc 1 386 44 is_stmt 0 view .LVU653
+	movq	24(%rsp), %rcx
+	cmpq	$255, %rcx
+	setbe	%al
+	.loc 1 386 20 view .LVU654
+	cmpb	%al, 15(%rsp)
+	je	.L162
+.LVL263:
+	.p2align 4,,10
+	.p2align 3
+.L161:
+	.loc 1 387 7 is_stmt 1 view .LVU655
+	movl	4(%rsp), %edx
+	movq	%rbx, %rsi
+	leaq	.LC85(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL264:
+	.loc 1 388 7 view .LVU656
+	.loc 1 388 19 is_stmt 0 view .LVU657
+	movl	$1, 8(%rsp)
+.LVL265:
+.L163:
+	.loc 1 394 5 is_stmt 1 discriminator 2 view .LVU658
+	movq	%rbp, %rdi
+.LBE43:
+	.loc 1 378 21 is_stmt 0 discriminator 2 view .LVU659
+	addq	$4, %r13
+.LVL266:
+.LBB46:
+	.loc 1 394 5 discriminator 2 view .LVU660
+	call	st_destroy@PLT
+.LVL267:
+.LBE46:
+	.loc 1 378 35 is_stmt 1 discriminator 2 view .LVU661
+	.loc 1 378 21 discriminator 2 view .LVU662
+	cmpq	%r13, 16(%rsp)
+	jne	.L165
+.LBE48:
+	.loc 1 396 3 view .LVU663
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL268:
+	.loc 1 398 3 view .LVU664
+	.loc 1 399 1 is_stmt 0 view .LVU665
+	movl	8(%rsp), %eax
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL269:
+	.loc 1 399 1 view .LVU666
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL270:
+	.loc 1 399 1 view .LVU667
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL271:
+	.loc 1 399 1 view .LVU668
+	ret
+.LVL272:
+.L162:
+	.cfi_restore_state
+.LBB49:
+.LBB47:
+	.loc 1 392 7 is_stmt 1 view .LVU669
+	cmpq	%r15, %r14
+	leaq	.LC81(%rip), %rax
+	leaq	.LC80(%rip), %rdx
+	cmovne	%rax, %rdx
+	movq	%rcx, %rsi
+	leaq	.LC86(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL273:
+	jmp	.L163
+.LBE47:
+.LBE49:
+	.cfi_endproc
+.LFE34:
+	.size	run_st_inline_buffer_unit_tests, .-run_st_inline_buffer_unit_tests
+	.section	.rodata.str1.1
+.LC87:
+	.string	"streamed"
+.LC88:
+	.string	"in memory"
+.LC89:
+	.string	"42,"
+.LC90:
+	.string	"-9223372036854775808]"
+.LC91:
+	.string	"1234567890123456789 x"
+.LC92:
+	.string	"00000000000000000007}"
+.LC93:
+	.string	"12.0,"
+.LC94:
+	.string	"-1e3 "
+.LC95:
+	.string	"12.5,"
+.LC96:
+	.string	"9223372036854775808,"
+.LC97:
+	.string	"1e19,"
+.LC98:
+	.string	"-x"
+	.section	.rodata.str1.8
+	.align 8
+.LC102:
+	.string	"------------------- st_extract_int64(x) -------------------"
+	.section	.rodata.str1.1
+.LC103:
+	.string	"%s"
+	.section	.rodata.str1.8
+	.align 8
+.LC104:
+	.string	"[Failed] st_extract_int64(\"%s\") %s failed: got %lld, returned %d, cursor on '%c'.\n"
+	.align 8
+.LC105:
+	.string	"[Passed] st_extract_int64(\"%s\") %s.\n"
+	.text
+	.p2align 4
+	.globl	run_st_extract_int64_unit_tests
+	.type	run_st_extract_int64_unit_tests, @function
+run_st_extract_int64_unit_tests:
+.LFB35:
+	.loc 1 404 39 view -0
+	.cfi_startproc
+	.loc 1 406 3 view .LVU671
+	.loc 1 404 39 is_stmt 0 view .LVU672
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 406 15 view .LVU673
+	leaq	.LC92(%rip), %rax
+	.loc 1 413 3 view .LVU674
+	leaq	.LC102(%rip), %rdi
+	.loc 1 404 39 view .LVU675
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 406 15 view .LVU676
+	leaq	.LC91(%rip), %rbx
+	vmovq	%rbx, %xmm1
+	leaq	.LC89(%rip), %rbx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovq	%rbx, %xmm0
+	leaq	.LC90(%rip), %rax
+	.loc 1 404 39 view .LVU677
+	andq	$-32, %rsp
+	.loc 1 406 15 view .LVU678
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	leaq	.LC95(%rip), %rbx
+	.loc 1 404 39 view .LVU679
+	subq	$416, %rsp
+	.loc 1 406 15 view .LVU680
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC96(%rip), %rax
+	vmovq	%rbx, %xmm1
+	leaq	.LC93(%rip), %rbx
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	vmovdqa	%ymm0, 224(%rsp)
+	leaq	.LC94(%rip), %rax
+	vmovq	%rbx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	leaq	.LC97(%rip), %rbx
+	vmovdqa	%ymm0, 256(%rsp)
+	leaq	.LC8(%rip), %rax
+	vmovq	%rbx, %xmm0
+	vpinsrq	$1, %rax, %xmm0, %xmm0
+	vmovdqa	%xmm0, 288(%rsp)
+	.loc 1 407 7 view .LVU681
+	vmovdqa	.LC99(%rip), %ymm0
+	.loc 1 406 15 view .LVU682
+	leaq	.LC98(%rip), %rax
+	.loc 1 407 7 view .LVU683
+	vmovdqa	%ymm0, 96(%rsp)
+	.loc 1 408 11 view .LVU684
+	vmovdqa	.LC100(%rip), %ymm0
+	.loc 1 406 15 view .LVU685
+	movq	%rax, 304(%rsp)
+	.loc 1 407 3 is_stmt 1 view .LVU686
+	.loc 1 409 8 is_stmt 0 view .LVU687
+	movabsq	$4121075325104315692, %rax
+	movq	%rax, 53(%rsp)
+	.loc 1 408 11 view .LVU688
+	vmovdqa	%ymm0, 320(%rsp)
+	.loc 1 407 7 view .LVU689
+	movq	$0, 128(%rsp)
+	.loc 1 408 11 view .LVU690
+	vmovdqa	.LC101(%rip), %ymm0
+	.loc 1 407 7 view .LVU691
+	movl	$0, 136(%rsp)
+	.loc 1 408 3 is_stmt 1 view .LVU692
+	.loc 1 408 11 is_stmt 0 view .LVU693
+	movq	$0, 384(%rsp)
+	movq	$0, 392(%rsp)
+	movq	$0, 400(%rsp)
+	.loc 1 409 3 is_stmt 1 view .LVU694
+	.loc 1 409 8 is_stmt 0 view .LVU695
+	movl	$761344313, 60(%rsp)
+	.loc 1 411 3 is_stmt 1 view .LVU696
+.LVL274:
+	.loc 1 413 3 view .LVU697
+	.loc 1 408 11 is_stmt 0 view .LVU698
+	vmovdqa	%ymm0, 352(%rsp)
+	leaq	160(%rsp), %r14
+	.loc 1 413 3 view .LVU699
+	vzeroupper
+.LVL275:
+	call	puts@PLT
+.LVL276:
+	.loc 1 415 3 is_stmt 1 view .LVU700
+	.loc 1 416 3 view .LVU701
+.LBB50:
+	.loc 1 416 8 view .LVU702
+	.loc 1 416 21 view .LVU703
+	leaq	224(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	leaq	40(%rsp), %rax
+	movq	%rax, 8(%rsp)
+	leaq	96(%rsp), %rax
+.LBE50:
+	.loc 1 415 7 is_stmt 0 view .LVU704
+	movl	$0, 24(%rsp)
+	movq	%rax, (%rsp)
+	.loc 1 413 3 view .LVU705
+	xorl	%r15d, %r15d
+.LVL277:
+	.p2align 4,,10
+	.p2align 3
+.L171:
+.LBB55:
+.LBB51:
+	.loc 1 417 37 is_stmt 1 view .LVU706
+	.loc 1 417 14 is_stmt 0 view .LVU707
+	xorl	%r13d, %r13d
+.LVL278:
+.L182:
+.LBB52:
+	.loc 1 418 7 is_stmt 1 view .LVU708
+	.loc 1 419 7 view .LVU709
+	movq	16(%rsp), %rax
+	leaq	.LC103(%rip), %rdx
+	movq	(%rax,%r15,8), %r12
+	movl	$64, %esi
+	movq	%r12, %rcx
+	movq	%r14, %rdi
+	xorl	%eax, %eax
+	call	snprintf@PLT
+.LVL279:
+	.loc 1 420 7 view .LVU710
+	.loc 1 420 62 is_stmt 0 view .LVU711
+	movq	%r12, %rdi
+	.loc 1 420 34 view .LVU712
+	movq	%r12, 64(%rsp)
+	.loc 1 420 62 view .LVU713
+	call	strlen@PLT
+.LVL280:
+	.loc 1 420 34 view .LVU714
+	movq	%rax, 72(%rsp)
+	movq	$0, 80(%rsp)
+	.loc 1 421 7 is_stmt 1 view .LVU715
+	.loc 1 421 111 is_stmt 0 view .LVU716
+	testl	%r13d, %r13d
+	je	.L172
+	.loc 1 421 54 discriminator 1 view .LVU717
+	leaq	64(%rsp), %rsi
+	movl	$3, %edx
+	leaq	tokenizer_test_read(%rip), %rdi
+	call	st_create_from_callback@PLT
+.LVL281:
+	movq	%rax, %rbx
+.LVL282:
+.L173:
+	.loc 1 422 7 is_stmt 1 discriminator 4 view .LVU718
+	.loc 1 423 23 is_stmt 0 discriminator 4 view .LVU719
+	movq	8(%rsp), %rsi
+	movq	%rbx, %rdi
+	.loc 1 422 15 discriminator 4 view .LVU720
+	movq	$0, 40(%rsp)
+	.loc 1 423 7 is_stmt 1 discriminator 4 view .LVU721
+	.loc 1 423 23 is_stmt 0 discriminator 4 view .LVU722
+	call	st_extract_int64@PLT
+.LVL283:
+	.loc 1 424 7 is_stmt 1 discriminator 4 view .LVU723
+	movl	%eax, 28(%rsp)
+	.loc 1 425 9 discriminator 4 view .LVU724
+	movq	%rbx, %rdi
+	.loc 1 424 10 is_stmt 0 discriminator 4 view .LVU725
+	testl	%eax, %eax
+	jne	.L174
+	.loc 1 427 20 view .LVU726
+	call	st_current_token@PLT
+.LVL284:
+	.loc 1 428 7 is_stmt 1 view .LVU727
+	.loc 1 428 10 is_stmt 0 view .LVU728
+	movq	(%rsp), %rcx
+	movl	28(%rsp), %r8d
+	movl	(%rcx,%r15,4), %edx
+	testl	%edx, %edx
+	je	.L175
+.L188:
+	.loc 1 429 9 view .LVU729
+	movq	40(%rsp), %rcx
+.L176:
+	.loc 1 429 9 is_stmt 1 view .LVU730
+	testl	%r13d, %r13d
+	leaq	.LC87(%rip), %rsi
+	leaq	.LC88(%rip), %rdx
+	cmovne	%rsi, %rdx
+	movsbl	%al, %r9d
+	movq	%r12, %rsi
+	leaq	.LC104(%rip), %rdi
+	xorl	%eax, %eax
+.LVL285:
+	.loc 1 429 9 is_stmt 0 view .LVU731
+	call	printf@PLT
+.LVL286:
+	.loc 1 430 9 is_stmt 1 view .LVU732
+	.loc 1 430 21 is_stmt 0 view .LVU733
+	movl	$1, 24(%rsp)
+.LVL287:
+.L180:
+	.loc 1 436 7 is_stmt 1 discriminator 2 view .LVU734
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL288:
+.LBE52:
+	.loc 1 417 50 discriminator 2 view .LVU735
+	.loc 1 417 37 discriminator 2 view .LVU736
+	testl	%r13d, %r13d
+	jne	.L189
+	.loc 1 417 50 is_stmt 0 view .LVU737
+	movl	$1, %r13d
+.LVL289:
+	.loc 1 417 50 view .LVU738
+	jmp	.L182
+.LVL290:
+	.p2align 4,,10
+	.p2align 3
+.L189:
+	.loc 1 417 50 view .LVU739
+.LBE51:
+	.loc 1 416 35 is_stmt 1 discriminator 2 view .LVU740
+	.loc 1 416 21 discriminator 2 view .LVU741
+	incq	%r15
+.LVL291:
+	.loc 1 416 21 is_stmt 0 discriminator 2 view .LVU742
+	cmpq	$11, %r15
+	jne	.L171
+.LBE55:
+	.loc 1 439 3 is_stmt 1 view .LVU743
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL292:
+	.loc 1 441 3 view .LVU744
+	.loc 1 442 1 is_stmt 0 view .LVU745
+	movl	24(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL293:
+	.loc 1 442 1 view .LVU746
+	popq	%rbx
+.LVL294:
+	.loc 1 442 1 view .LVU747
+	popq	%r12
+	popq	%r13
+.LVL295:
+	.loc 1 442 1 view .LVU748
+	popq	%r14
+.LVL296:
+	.loc 1 442 1 view .LVU749
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL297:
+	.loc 1 442 1 view .LVU750
+	ret
+.LVL298:
+	.p2align 4,,10
+	.p2align 3
+.L172:
+	.cfi_restore_state
+.LBB56:
+.LBB54:
+.LBB53:
+	.loc 1 421 113 discriminator 2 view .LVU751
+	movq	%r14, %rdi
+	call	st_create@PLT
+.LVL299:
+	movq	%rax, %rbx
+	jmp	.L173
+.LVL300:
+	.p2align 4,,10
+	.p2align 3
+.L174:
+	.loc 1 425 9 view .LVU752
+	call	st_next_token@PLT
+.LVL301:
+	.loc 1 427 7 is_stmt 1 view .LVU753
+	.loc 1 427 20 is_stmt 0 view .LVU754
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL302:
+	.loc 1 428 7 is_stmt 1 view .LVU755
+	.loc 1 428 10 is_stmt 0 view .LVU756
+	movq	(%rsp), %rcx
+	movl	28(%rsp), %r8d
+	cmpl	(%rcx,%r15,4), %r8d
+	.loc 1 428 67 view .LVU757
+	movq	40(%rsp), %rcx
+	.loc 1 428 10 view .LVU758
+	jne	.L176
+	.loc 1 428 58 discriminator 2 view .LVU759
+	cmpq	%rcx, 320(%rsp,%r15,8)
+	jne	.L176
+.L175:
+	.loc 1 428 89 discriminator 4 view .LVU760
+	cmpb	%al, 53(%rsp,%r15)
+	jne	.L188
+	.loc 1 434 9 is_stmt 1 view .LVU761
+	testl	%r13d, %r13d
+	leaq	.LC87(%rip), %rax
+.LVL303:
+	.loc 1 434 9 is_stmt 0 view .LVU762
+	leaq	.LC88(%rip), %rdx
+	cmovne	%rax, %rdx
+	movq	%r12, %rsi
+	leaq	.LC105(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL304:
+	jmp	.L180
+.LBE53:
+.LBE54:
+.LBE56:
+	.cfi_endproc
+.LFE35:
+	.size	run_st_extract_int64_unit_tests, .-run_st_extract_int64_unit_tests
+	.section	.rodata.str1.1
+.LC106:
+	.string	"key=value"
+.LC107:
+	.string	"no delimiter"
+.LC108:
+	.string	"a b;c"
+.LC109:
+	.string	";x"
+.LC110:
+	.string	"\n"
+.LC112:
+	.string	"key"
+.LC113:
+	.string	"a b"
+.LC114:
+	.string	"=;"
+	.section	.rodata.str1.8
+	.align 8
+.LC115:
+	.string	"------------------- st_extract_until_view(x) -------------------"
+	.align 8
+.LC116:
+	.string	"[Failed] st_extract_until_view(\"%s\") %s failed: returned %d, cursor on '%c'.\n"
+	.align 8
+.LC117:
+	.string	"[Passed] st_extract_until_view(\"%s\") %s.\n"
+	.text
+	.p2align 4
+	.globl	run_st_extract_until_view_unit_tests
+	.type	run_st_extract_until_view_unit_tests, @function
+run_st_extract_until_view_unit_tests:
+.LFB36:
+	.loc 1 447 44 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	.LC107(%rip), %rax
+	vmovq	%rax, %xmm1
+	.loc 1 449 3 view .LVU764
+	.loc 1 447 44 is_stmt 0 view .LVU765
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.loc 1 449 15 view .LVU766
+	leaq	.LC109(%rip), %rax
+	vpinsrq	$1, %rax, %xmm1, %xmm2
+	.loc 1 447 44 view .LVU767
+	pushq	%r14
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.loc 1 449 15 view .LVU768
+	leaq	.LC106(%rip), %r14
+	vmovq	%r14, %xmm3
+	.loc 1 447 44 view .LVU769
+	pushq	%r13
+	.loc 1 449 15 view .LVU770
+	leaq	.LC108(%rip), %rax
+	vpinsrq	$1, %rax, %xmm3, %xmm0
+	.loc 1 447 44 view .LVU771
+	pushq	%r12
+	.loc 1 449 15 view .LVU772
+	vinserti128	$0x1, %xmm2, %ymm0, %ymm0
+	leaq	.LC110(%rip), %rax
+	.loc 1 447 44 view .LVU773
+	pushq	%rbx
+	.loc 1 451 15 view .LVU774
+	leaq	.LC112(%rip), %rcx
+	leaq	.LC113(%rip), %rdx
+	.loc 1 447 44 view .LVU775
+	andq	$-32, %rsp
+	subq	$608, %rsp
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 449 15 view .LVU776
+	vmovdqa	%ymm0, 160(%rsp)
+	.loc 1 450 7 view .LVU777
+	vmovdqa	.LC111(%rip), %xmm0
+	.loc 1 449 15 view .LVU778
+	movq	%rax, 192(%rsp)
+	.loc 1 450 3 is_stmt 1 view .LVU779
+	.loc 1 451 15 is_stmt 0 view .LVU780
+	leaq	.LC26(%rip), %rax
+	vpinsrq	$1, %rax, %xmm1, %xmm1
+	movq	%rax, 256(%rsp)
+	.loc 1 450 7 view .LVU781
+	vmovdqa	%xmm0, 96(%rsp)
+	.loc 1 455 3 view .LVU782
+	leaq	352(%rsp), %rax
+	.loc 1 451 15 view .LVU783
+	vmovq	%rcx, %xmm0
+	.loc 1 455 3 view .LVU784
+	movq	%rax, 40(%rsp)
+	.loc 1 451 15 view .LVU785
+	vpinsrq	$1, %rdx, %xmm0, %xmm0
+	.loc 1 450 7 view .LVU786
+	movl	$0, 112(%rsp)
+	.loc 1 451 3 is_stmt 1 view .LVU787
+	.loc 1 452 3 view .LVU788
+	.loc 1 452 8 is_stmt 0 view .LVU789
+	movl	$989870909, 75(%rsp)
+	movb	$10, 79(%rsp)
+	.loc 1 454 3 is_stmt 1 view .LVU790
+	.loc 1 455 3 view .LVU791
+	.loc 1 451 15 is_stmt 0 view .LVU792
+	vinserti128	$0x1, %xmm1, %ymm0, %ymm0
+	vmovdqa	%ymm0, 224(%rsp)
+	.loc 1 455 3 view .LVU793
+	movq	%rax, %rdi
+	leaq	.LC114(%rip), %rdx
+	movl	$32, %esi
+	vzeroupper
+.LVL305:
+	call	st_char_class_init@PLT
+.LVL306:
+	.loc 1 457 3 is_stmt 1 view .LVU794
+	.loc 1 459 3 view .LVU795
+	leaq	.LC115(%rip), %rdi
+	call	puts@PLT
+.LVL307:
+	.loc 1 461 3 view .LVU796
+	.loc 1 462 3 view .LVU797
+.LBB57:
+	.loc 1 462 8 view .LVU798
+	.loc 1 462 21 view .LVU799
+	leaq	288(%rsp), %rax
+	movq	%rax, 56(%rsp)
+	leaq	80(%rsp), %rax
+.LBE57:
+	.loc 1 461 7 is_stmt 0 view .LVU800
+	movl	$0, 52(%rsp)
+	movq	%rax, 32(%rsp)
+	.loc 1 459 3 view .LVU801
+	xorl	%r15d, %r15d
+.LVL308:
+	.p2align 4,,10
+	.p2align 3
+.L191:
+.LBB64:
+.LBB58:
+	.loc 1 463 37 is_stmt 1 view .LVU802
+	.loc 1 463 14 is_stmt 0 view .LVU803
+	xorl	%r13d, %r13d
+.LVL309:
+.L204:
+.LBB59:
+	.loc 1 464 7 is_stmt 1 view .LVU804
+	.loc 1 465 7 view .LVU805
+	movq	56(%rsp), %rdi
+	movq	%r14, %rcx
+	leaq	.LC103(%rip), %rdx
+	movl	$64, %esi
+	xorl	%eax, %eax
+	call	snprintf@PLT
+.LVL310:
+	.loc 1 466 7 view .LVU806
+	.loc 1 466 62 is_stmt 0 view .LVU807
+	movq	%r14, %rdi
+	.loc 1 466 34 view .LVU808
+	movq	%r14, 128(%rsp)
+	.loc 1 466 62 view .LVU809
+	call	strlen@PLT
+.LVL311:
+	.loc 1 466 34 view .LVU810
+	movq	%rax, 136(%rsp)
+	movq	$0, 144(%rsp)
+	.loc 1 467 7 is_stmt 1 view .LVU811
+	.loc 1 467 111 is_stmt 0 view .LVU812
+	testl	%r13d, %r13d
+	je	.L192
+	.loc 1 467 54 discriminator 1 view .LVU813
+	leaq	128(%rsp), %rsi
+	movl	$3, %edx
+	leaq	tokenizer_test_read(%rip), %rdi
+	call	st_create_from_callback@PLT
+.LVL312:
+	movq	%rax, %rbx
+.LVL313:
+.L193:
+	.loc 1 468 7 is_stmt 1 discriminator 4 view .LVU814
+	.loc 1 469 23 is_stmt 0 discriminator 4 view .LVU815
+	movq	32(%rsp), %rdx
+	movq	40(%rsp), %rsi
+	movq	%rbx, %rdi
+	.loc 1 468 25 discriminator 4 view .LVU816
+	movq	$0, 80(%rsp)
+	movq	$0, 88(%rsp)
+	.loc 1 469 7 is_stmt 1 discriminator 4 view .LVU817
+	.loc 1 469 23 is_stmt 0 discriminator 4 view .LVU818
+	call	st_extract_until_view@PLT
+.LVL314:
+	movl	%eax, %r12d
+.LVL315:
+	.loc 1 470 7 is_stmt 1 discriminator 4 view .LVU819
+	.loc 1 470 36 is_stmt 0 discriminator 4 view .LVU820
+	testl	%eax, %eax
+	jne	.L194
+	.loc 1 474 7 is_stmt 1 view .LVU821
+	.loc 1 474 20 is_stmt 0 view .LVU822
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL316:
+	.loc 1 475 7 is_stmt 1 view .LVU823
+	.loc 1 475 10 is_stmt 0 view .LVU824
+	movl	96(%rsp,%r15,4), %ecx
+	testl	%ecx, %ecx
+	je	.L196
+.L195:
+	.loc 1 476 9 is_stmt 1 view .LVU825
+	testl	%r13d, %r13d
+	leaq	.LC87(%rip), %rcx
+	leaq	.LC88(%rip), %rdx
+	cmovne	%rcx, %rdx
+	movsbl	%al, %r8d
+	movl	%r12d, %ecx
+	movq	%r14, %rsi
+	leaq	.LC116(%rip), %rdi
+	xorl	%eax, %eax
+.LVL317:
+	.loc 1 476 9 is_stmt 0 view .LVU826
+	call	printf@PLT
+.LVL318:
+	.loc 1 477 9 is_stmt 1 view .LVU827
+	.loc 1 477 21 is_stmt 0 view .LVU828
+	movl	$1, 52(%rsp)
+.LVL319:
+.L200:
+	.loc 1 483 7 is_stmt 1 discriminator 2 view .LVU829
+	movq	%rbx, %rdi
+	call	st_destroy@PLT
+.LVL320:
+.LBE59:
+	.loc 1 463 50 discriminator 2 view .LVU830
+	.loc 1 463 37 discriminator 2 view .LVU831
+	testl	%r13d, %r13d
+	jne	.L209
+.LBB60:
+	.loc 1 465 7 is_stmt 0 view .LVU832
+	movq	160(%rsp,%r15,8), %r14
+.LBE60:
+	.loc 1 463 50 view .LVU833
+	movl	$1, %r13d
+.LVL321:
+	.loc 1 463 50 view .LVU834
+	jmp	.L204
+.LVL322:
+	.p2align 4,,10
+	.p2align 3
+.L194:
+.LBB61:
+	.loc 1 470 52 discriminator 2 view .LVU835
+	movq	224(%rsp,%r15,8), %rax
+.LVL323:
+	.loc 1 470 44 discriminator 2 view .LVU836
+	movq	88(%rsp), %rdx
+	.loc 1 470 52 discriminator 2 view .LVU837
+	movq	%rax, %rdi
+	.loc 1 470 44 discriminator 2 view .LVU838
+	movq	%rdx, 24(%rsp)
+	.loc 1 470 52 discriminator 2 view .LVU839
+	movq	%rax, 16(%rsp)
+	call	strlen@PLT
+.LVL324:
+	.loc 1 470 36 discriminator 2 view .LVU840
+	movq	24(%rsp), %rdx
+	cmpq	%rax, %rdx
+	je	.L210
+.LVL325:
+	.loc 1 471 7 is_stmt 1 view .LVU841
+	.loc 1 472 9 view .LVU842
+	movq	%rbx, %rdi
+	call	st_next_token@PLT
+.LVL326:
+	.loc 1 474 7 view .LVU843
+	.loc 1 474 20 is_stmt 0 view .LVU844
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL327:
+	.loc 1 475 7 is_stmt 1 view .LVU845
+	jmp	.L195
+.LVL328:
+	.p2align 4,,10
+	.p2align 3
+.L209:
+	.loc 1 475 7 is_stmt 0 view .LVU846
+.LBE61:
+.LBE58:
+	.loc 1 462 35 is_stmt 1 discriminator 2 view .LVU847
+	.loc 1 462 21 discriminator 2 view .LVU848
+	incq	%r15
+.LVL329:
+	.loc 1 462 21 is_stmt 0 discriminator 2 view .LVU849
+	cmpq	$5, %r15
+	je	.L203
+.LBB63:
+.LBB62:
+	.loc 1 465 7 view .LVU850
+	movq	160(%rsp,%r15,8), %r14
+	jmp	.L191
+.LVL330:
+	.p2align 4,,10
+	.p2align 3
+.L192:
+	.loc 1 467 113 discriminator 2 view .LVU851
+	movq	56(%rsp), %rdi
+	call	st_create@PLT
+.LVL331:
+	movq	%rax, %rbx
+	jmp	.L193
+.LVL332:
+	.p2align 4,,10
+	.p2align 3
+.L210:
+	.loc 1 470 78 discriminator 3 view .LVU852
+	movq	80(%rsp), %rdi
+	movq	16(%rsp), %rsi
+	call	memcmp@PLT
+.LVL333:
+	.loc 1 471 7 is_stmt 1 discriminator 3 view .LVU853
+	.loc 1 472 9 discriminator 3 view .LVU854
+	movq	%rbx, %rdi
+	.loc 1 470 78 is_stmt 0 discriminator 3 view .LVU855
+	movl	%eax, 24(%rsp)
+.LVL334:
+	.loc 1 472 9 discriminator 3 view .LVU856
+	call	st_next_token@PLT
+.LVL335:
+	.loc 1 474 7 is_stmt 1 discriminator 3 view .LVU857
+	.loc 1 474 20 is_stmt 0 discriminator 3 view .LVU858
+	movq	%rbx, %rdi
+	call	st_current_token@PLT
+.LVL336:
+	.loc 1 475 7 is_stmt 1 discriminator 3 view .LVU859
+	.loc 1 475 44 is_stmt 0 discriminator 3 view .LVU860
+	cmpl	%r12d, 96(%rsp,%r15,4)
+	jne	.L195
+	movl	24(%rsp), %edx
+	testl	%edx, %edx
+	jne	.L195
+	.p2align 4,,10
+	.p2align 3
+.L196:
+	.loc 1 475 60 discriminator 2 view .LVU861
+	cmpb	%al, 75(%rsp,%r15)
+	jne	.L195
+	.loc 1 481 9 is_stmt 1 view .LVU862
+	testl	%r13d, %r13d
+	leaq	.LC88(%rip), %rax
+.LVL337:
+	.loc 1 481 9 is_stmt 0 view .LVU863
+	leaq	.LC87(%rip), %rdx
+	cmove	%rax, %rdx
+	movq	%r14, %rsi
+	leaq	.LC117(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL338:
+	jmp	.L200
+.LVL339:
+	.p2align 4,,10
+	.p2align 3
+.L203:
+	.loc 1 481 9 view .LVU864
+.LBE62:
+.LBE63:
+.LBE64:
+	.loc 1 486 3 is_stmt 1 view .LVU865
+	movl	$10, %edi
+	call	putchar@PLT
+.LVL340:
+	.loc 1 488 3 view .LVU866
+	.loc 1 489 1 is_stmt 0 view .LVU867
+	movl	52(%rsp), %eax
+	leaq	-40(%rbp), %rsp
+.LVL341:
+	.loc 1 489 1 view .LVU868
+	popq	%rbx
+.LVL342:
+	.loc 1 489 1 view .LVU869
+	popq	%r12
+.LVL343:
+	.loc 1 489 1 view .LVU870
+	popq	%r13
+.LVL344:
+	.loc 1 489 1 view .LVU871
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+.LVL345:
+	.loc 1 489 1 view .LVU872
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	run_st_extract_until_view_unit_tests, .-run_st_extract_until_view_unit_tests
+	.p2align 4
+	.globl	run_string_tokenizer_tests
+	.type	run_string_tokenizer_tests, @function
+run_string_tokenizer_tests:
+.LFB37:
+	.loc 1 494 34 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 496 3 view .LVU874
+	.loc 1 494 34 is_stmt 0 view .LVU875
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 496 7 view .LVU876
+	xorl	%eax, %eax
+	call	run_st_expand_string_unit_tests@PLT
+.LVL346:
+	.loc 1 496 6 view .LVU877
+	cmpl	$1, %eax
+	je	.L214
+	.loc 1 500 3 is_stmt 1 view .LVU878
+	.loc 1 500 7 is_stmt 0 view .LVU879
+	xorl	%eax, %eax
+	call	run_st_append_unit_tests@PLT
+.LVL347:
+	.loc 1 500 6 view .LVU880
+	cmpl	$1, %eax
+	je	.L214
+	.loc 1 504 3 is_stmt 1 view .LVU881
+	.loc 1 504 7 is_stmt 0 view .LVU882
+	xorl	%eax, %eax
+	call	run_st_append_escaped_string_unit_tests@PLT
+.LVL348:
+	.loc 1 504 6 view .LVU883
+	cmpl	$1, %eax
+	je	.L214
+	.loc 1 508 3 is_stmt 1 view .LVU884
+	.loc 1 508 7 is_stmt 0 view .LVU885
+	xorl	%eax, %eax
+	call	run_st_extract_int64_unit_tests@PLT
+.LVL349:
+	.loc 1 508 6 view .LVU886
+	cmpl	$1, %eax
+	je	.L214
+	.loc 1 512 3 is_stmt 1 view .LVU887
+	.loc 1 512 7 is_stmt 0 view .LVU888
+	xorl	%eax, %eax
+	call	run_st_extract_until_view_unit_tests@PLT
+.LVL350:
+	.loc 1 512 6 view .LVU889
+	cmpl	$1, %eax
+	je	.L214
+	.loc 1 516 3 is_stmt 1 view .LVU890
+	.loc 1 516 7 is_stmt 0 view .LVU891
+	xorl	%eax, %eax
+	call	run_st_stream_unit_tests@PLT
+.LVL351:
+	.loc 1 516 6 view .LVU892
+	cmpl	$1, %eax
+	je	.L214
+	.loc 1 520 3 is_stmt 1 view .LVU893
+	.loc 1 520 7 is_stmt 0 view .LVU894
+	xorl	%eax, %eax
+	call	run_st_create_from_mmap_unit_tests@PLT
+.LVL352:
+	.loc 1 520 6 view .LVU895
+	cmpl	$1, %eax
+	je	.L214
+	.loc 1 524 3 is_stmt 1 view .LVU896
+	.loc 1 524 7 is_stmt 0 view .LVU897
+	xorl	%eax, %eax
+	call	run_st_pool_unit_tests@PLT
+.LVL353:
+	.loc 1 524 6 view .LVU898
+	cmpl	$1, %eax
+	je	.L214
+	.loc 1 528 3 is_stmt 1 view .LVU899
+	.loc 1 528 7 is_stmt 0 view .LVU900
+	xorl	%eax, %eax
+	call	run_st_inline_buffer_unit_tests@PLT
+.LVL354:
+	.loc 1 528 6 view .LVU901
+	cmpl	$1, %eax
+	sete	%al
+	movzbl	%al, %eax
+	jmp	.L211
+	.p2align 4,,10
+	.p2align 3
+.L214:
+	.loc 1 497 11 view .LVU902
+	movl	$1, %eax
+.L211:
+	.loc 1 533 1 view .LVU903
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	run_string_tokenizer_tests, .-run_string_tokenizer_tests
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC16:
+	.long	0
+	.long	1073217536
+	.section	.rodata.cst32,"aM",@progbits,32
+	.align 32
+.LC43:
+	.quad	1
+	.quad	3
+	.quad	7
+	.quad	4096
+	.section	.rodata
+	.align 64
+.LC52:
+	.quad	7308604895944974368
+	.quad	8247343408028983330
+	.quad	8367801831567221093
+	.quad	8243129286213856111
+	.quad	8461244959928888354
+	.quad	3616772169727636325
+	.quad	3329898590690948147
+	.quad	3543822871525745973
+	.section	.rodata.cst32
+	.align 32
+.LC53:
+	.quad	733063322411281968
+	.quad	8367752027160125984
+	.quad	7954801838398993778
+	.quad	35221902053745252
+	.align 32
+.LC58:
+	.quad	3196769800192667680
+	.quad	2322206402684264458
+	.quad	7287422522091729524
+	.quad	9016806925758784622
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC68:
+	.quad	7091318039277040687
+	.quad	8097873921509061747
+	.align 16
+.LC79:
+	.quad	2478227119648633634
+	.quad	8245929428630004000
+	.align 16
+.LC82:
+	.long	1
+	.long	63
+	.long	64
+	.long	200
+	.section	.rodata.cst32
+	.align 32
+.LC99:
+	.long	1
+	.long	1
+	.long	1
+	.long	1
+	.long	1
+	.long	1
+	.long	0
+	.long	0
+	.align 32
+.LC100:
+	.quad	42
+	.quad	-9223372036854775808
+	.quad	1234567890123456789
+	.quad	7
+	.align 32
+.LC101:
+	.quad	12
+	.quad	-1000
+	.quad	0
+	.quad	0
+	.section	.rodata.cst16
+	.align 16
+.LC111:
+	.long	1
+	.long	1
+	.long	1
+	.long	0
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 6 "/usr/include/stdio.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 9 "/root/repo/tests/../include/strutils.h"
+	.file 10 "/usr/include/string.h"
+	.file 11 "/usr/include/unistd.h"
+	.file 12 "/usr/include/stdlib.h"
+	.file 13 "<built-in>"
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x31b1
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x30
+	.long	.LASF448
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x11
+	.long	.LASF7
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x15
+	.long	0x2e
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x15
+	.long	0x46
+	.uleb128 0x31
+	.byte	0x8
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF4
+	.uleb128 0x12
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x11
+	.long	.LASF8
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x54
+	.uleb128 0x12
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x15
+	.long	0x7c
+	.uleb128 0x11
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x94
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x11
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x11
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x98
+	.byte	0x12
+	.long	0x94
+	.uleb128 0x11
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x99
+	.byte	0x12
+	.long	0x94
+	.uleb128 0xa
+	.long	0x7c
+	.long	0xcf
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF15
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x94
+	.uleb128 0x8
+	.long	0xe0
+	.uleb128 0x12
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF16
+	.uleb128 0x15
+	.long	0xe0
+	.uleb128 0x22
+	.long	.LASF273
+	.byte	0xd8
+	.byte	0x4
+	.byte	0x31
+	.long	0x272
+	.uleb128 0x6
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x33
+	.byte	0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x36
+	.byte	0x9
+	.long	0xdb
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x37
+	.byte	0x9
+	.long	0xdb
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF20
+	.byte	0x4
+	.byte	0x38
+	.byte	0x9
+	.long	0xdb
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF21
+	.byte	0x4
+	.byte	0x39
+	.byte	0x9
+	.long	0xdb
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x3a
+	.byte	0x9
+	.long	0xdb
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x9
+	.long	0xdb
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF24
+	.byte	0x4
+	.byte	0x3c
+	.byte	0x9
+	.long	0xdb
+	.byte	0x38
+	.uleb128 0x6
+	.long	.LASF25
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x9
+	.long	0xdb
+	.byte	0x40
+	.uleb128 0x6
+	.long	.LASF26
+	.byte	0x4
+	.byte	0x40
+	.byte	0x9
+	.long	0xdb
+	.byte	0x48
+	.uleb128 0x6
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x41
+	.byte	0x9
+	.long	0xdb
+	.byte	0x50
+	.uleb128 0x6
+	.long	.LASF28
+	.byte	0x4
+	.byte	0x42
+	.byte	0x9
+	.long	0xdb
+	.byte	0x58
+	.uleb128 0x6
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x44
+	.byte	0x16
+	.long	0x28b
+	.byte	0x60
+	.uleb128 0x6
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x46
+	.byte	0x14
+	.long	0x290
+	.byte	0x68
+	.uleb128 0x6
+	.long	.LASF31
+	.byte	0x4
+	.byte	0x48
+	.byte	0x7
+	.long	0x7c
+	.byte	0x70
+	.uleb128 0x6
+	.long	.LASF32
+	.byte	0x4
+	.byte	0x49
+	.byte	0x7
+	.long	0x7c
+	.byte	0x74
+	.uleb128 0x6
+	.long	.LASF33
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xb
+	.long	0xa7
+	.byte	0x78
+	.uleb128 0x6
+	.long	.LASF34
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x12
+	.long	0x5b
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF35
+	.byte	0x4
+	.byte	0x4e
+	.byte	0xf
+	.long	0x62
+	.byte	0x82
+	.uleb128 0x6
+	.long	.LASF36
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x8
+	.long	0x295
+	.byte	0x83
+	.uleb128 0x6
+	.long	.LASF37
+	.byte	0x4
+	.byte	0x51
+	.byte	0xf
+	.long	0x2a5
+	.byte	0x88
+	.uleb128 0x6
+	.long	.LASF38
+	.byte	0x4
+	.byte	0x59
+	.byte	0xd
+	.long	0xb3
+	.byte	0x90
+	.uleb128 0x6
+	.long	.LASF39
+	.byte	0x4
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2af
+	.byte	0x98
+	.uleb128 0x6
+	.long	.LASF40
+	.byte	0x4
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2b9
+	.byte	0xa0
+	.uleb128 0x6
+	.long	.LASF41
+	.byte	0x4
+	.byte	0x5d
+	.byte	0x14
+	.long	0x290
+	.byte	0xa8
+	.uleb128 0x6
+	.long	.LASF42
+	.byte	0x4
+	.byte	0x5e
+	.byte	0x9
+	.long	0x52
+	.byte	0xb0
+	.uleb128 0x6
+	.long	.LASF43
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x6
+	.long	.LASF44
+	.byte	0x4
+	.byte	0x60
+	.byte	0x7
+	.long	0x7c
+	.byte	0xc0
+	.uleb128 0x6
+	.long	.LASF45
+	.byte	0x4
+	.byte	0x62
+	.byte	0x8
+	.long	0x2be
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF46
+	.byte	0x5
+	.byte	0x7
+	.byte	0x19
+	.long	0xec
+	.uleb128 0x33
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1f
+	.long	.LASF47
+	.uleb128 0x8
+	.long	0x286
+	.uleb128 0x8
+	.long	0xec
+	.uleb128 0xa
+	.long	0xe0
+	.long	0x2a5
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x27e
+	.uleb128 0x1f
+	.long	.LASF48
+	.uleb128 0x8
+	.long	0x2aa
+	.uleb128 0x1f
+	.long	.LASF49
+	.uleb128 0x8
+	.long	0x2b4
+	.uleb128 0xa
+	.long	0xe0
+	.long	0x2ce
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x13
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF50
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x13
+	.long	0xcf
+	.uleb128 0x8
+	.long	0x272
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF51
+	.uleb128 0x11
+	.long	.LASF52
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x13
+	.long	0x88
+	.uleb128 0x15
+	.long	0x2e6
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF53
+	.uleb128 0xa
+	.long	0xe0
+	.long	0x30e
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x313
+	.uleb128 0x34
+	.uleb128 0x8
+	.long	0xe7
+	.uleb128 0x35
+	.byte	0x7
+	.byte	0x4
+	.long	0x46
+	.byte	0xe
+	.byte	0x48
+	.byte	0x3
+	.long	0x83e
+	.uleb128 0x2
+	.long	.LASF54
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF55
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF56
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF57
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF58
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF60
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF61
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF62
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF63
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF64
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF65
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF66
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF67
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF68
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF69
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF70
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF71
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF72
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF73
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF74
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF75
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF76
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF77
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF78
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF79
+	.byte	0x19
+	.uleb128 0x2
+	.long	.LASF80
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF81
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF82
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF83
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF84
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF85
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF86
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF87
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF88
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF89
+	.byte	0x23
+	.uleb128 0x2
+	.long	.LASF90
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF91
+	.byte	0x25
+	.uleb128 0x2
+	.long	.LASF92
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF93
+	.byte	0x27
+	.uleb128 0x2
+	.long	.LASF94
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF95
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF96
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF97
+	.byte	0x2b
+	.uleb128 0x2
+	.long	.LASF98
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF99
+	.byte	0x2d
+	.uleb128 0x2
+	.long	.LASF100
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF101
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF102
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF103
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF104
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF105
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF106
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF107
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF108
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF109
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF110
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF111
+	.byte	0x39
+	.uleb128 0x2
+	.long	.LASF112
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF113
+	.byte	0x3b
+	.uleb128 0x2
+	.long	.LASF114
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF115
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF116
+	.byte	0x3d
+	.uleb128 0x2
+	.long	.LASF117
+	.byte	0x3e
+	.uleb128 0x2
+	.long	.LASF118
+	.byte	0x3f
+	.uleb128 0x2
+	.long	.LASF119
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF120
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF121
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF122
+	.byte	0x43
+	.uleb128 0x2
+	.long	.LASF123
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF124
+	.byte	0x45
+	.uleb128 0x2
+	.long	.LASF125
+	.byte	0x46
+	.uleb128 0x2
+	.long	.LASF126
+	.byte	0x47
+	.uleb128 0x2
+	.long	.LASF127
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF128
+	.byte	0x49
+	.uleb128 0x2
+	.long	.LASF129
+	.byte	0x4a
+	.uleb128 0x2
+	.long	.LASF130
+	.byte	0x4b
+	.uleb128 0x2
+	.long	.LASF131
+	.byte	0x4c
+	.uleb128 0x2
+	.long	.LASF132
+	.byte	0x4d
+	.uleb128 0x2
+	.long	.LASF133
+	.byte	0x4e
+	.uleb128 0x2
+	.long	.LASF134
+	.byte	0x4f
+	.uleb128 0x2
+	.long	.LASF135
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF136
+	.byte	0x51
+	.uleb128 0x2
+	.long	.LASF137
+	.byte	0x52
+	.uleb128 0x2
+	.long	.LASF138
+	.byte	0x53
+	.uleb128 0x2
+	.long	.LASF139
+	.byte	0x54
+	.uleb128 0x2
+	.long	.LASF140
+	.byte	0x55
+	.uleb128 0x2
+	.long	.LASF141
+	.byte	0x56
+	.uleb128 0x2
+	.long	.LASF142
+	.byte	0x57
+	.uleb128 0x2
+	.long	.LASF143
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF144
+	.byte	0x59
+	.uleb128 0x2
+	.long	.LASF145
+	.byte	0x5a
+	.uleb128 0x2
+	.long	.LASF146
+	.byte	0x5b
+	.uleb128 0x2
+	.long	.LASF147
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF148
+	.byte	0x5d
+	.uleb128 0x2
+	.long	.LASF149
+	.byte	0x5e
+	.uleb128 0x2
+	.long	.LASF150
+	.byte	0x5f
+	.uleb128 0x2
+	.long	.LASF151
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF152
+	.byte	0x61
+	.uleb128 0x2
+	.long	.LASF153
+	.byte	0x62
+	.uleb128 0x2
+	.long	.LASF154
+	.byte	0x63
+	.uleb128 0x2
+	.long	.LASF155
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF156
+	.byte	0x65
+	.uleb128 0x2
+	.long	.LASF157
+	.byte	0x66
+	.uleb128 0x2
+	.long	.LASF158
+	.byte	0x67
+	.uleb128 0x2
+	.long	.LASF159
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF160
+	.byte	0x69
+	.uleb128 0x2
+	.long	.LASF161
+	.byte	0x6a
+	.uleb128 0x2
+	.long	.LASF162
+	.byte	0x6b
+	.uleb128 0x2
+	.long	.LASF163
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF164
+	.byte	0x6d
+	.uleb128 0x2
+	.long	.LASF165
+	.byte	0x6e
+	.uleb128 0x2
+	.long	.LASF166
+	.byte	0x6f
+	.uleb128 0x2
+	.long	.LASF167
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF168
+	.byte	0x71
+	.uleb128 0x2
+	.long	.LASF169
+	.byte	0x72
+	.uleb128 0x2
+	.long	.LASF170
+	.byte	0x73
+	.uleb128 0x2
+	.long	.LASF171
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF172
+	.byte	0x75
+	.uleb128 0x2
+	.long	.LASF173
+	.byte	0x76
+	.uleb128 0x2
+	.long	.LASF174
+	.byte	0x77
+	.uleb128 0x2
+	.long	.LASF175
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF176
+	.byte	0x79
+	.uleb128 0x2
+	.long	.LASF177
+	.byte	0x7a
+	.uleb128 0x2
+	.long	.LASF178
+	.byte	0x7b
+	.uleb128 0x2
+	.long	.LASF179
+	.byte	0x7c
+	.uleb128 0x2
+	.long	.LASF180
+	.byte	0x7d
+	.uleb128 0x2
+	.long	.LASF181
+	.byte	0x7e
+	.uleb128 0x2
+	.long	.LASF182
+	.byte	0x7f
+	.uleb128 0x2
+	.long	.LASF183
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF184
+	.byte	0x81
+	.uleb128 0x2
+	.long	.LASF185
+	.byte	0x82
+	.uleb128 0x2
+	.long	.LASF186
+	.byte	0x83
+	.uleb128 0x2
+	.long	.LASF187
+	.byte	0x84
+	.uleb128 0x2
+	.long	.LASF188
+	.byte	0x85
+	.uleb128 0x2
+	.long	.LASF189
+	.byte	0x86
+	.uleb128 0x2
+	.long	.LASF190
+	.byte	0x87
+	.uleb128 0x2
+	.long	.LASF191
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF192
+	.byte	0x89
+	.uleb128 0x2
+	.long	.LASF193
+	.byte	0x8a
+	.uleb128 0x2
+	.long	.LASF194
+	.byte	0x8b
+	.uleb128 0x2
+	.long	.LASF195
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF196
+	.byte	0x8d
+	.uleb128 0x2
+	.long	.LASF197
+	.byte	0x8e
+	.uleb128 0x2
+	.long	.LASF198
+	.byte	0x8f
+	.uleb128 0x2
+	.long	.LASF199
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF200
+	.byte	0x91
+	.uleb128 0x2
+	.long	.LASF201
+	.byte	0x92
+	.uleb128 0x2
+	.long	.LASF202
+	.byte	0x93
+	.uleb128 0x2
+	.long	.LASF203
+	.byte	0x94
+	.uleb128 0x2
+	.long	.LASF204
+	.byte	0x95
+	.uleb128 0x2
+	.long	.LASF205
+	.byte	0x96
+	.uleb128 0x2
+	.long	.LASF206
+	.byte	0x97
+	.uleb128 0x2
+	.long	.LASF207
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF208
+	.byte	0x99
+	.uleb128 0x2
+	.long	.LASF209
+	.byte	0x9a
+	.uleb128 0x2
+	.long	.LASF210
+	.byte	0x9b
+	.uleb128 0x2
+	.long	.LASF211
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF212
+	.byte	0x9d
+	.uleb128 0x2
+	.long	.LASF213
+	.byte	0x9e
+	.uleb128 0x2
+	.long	.LASF214
+	.byte	0x9f
+	.uleb128 0x2
+	.long	.LASF215
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF216
+	.byte	0xa1
+	.uleb128 0x2
+	.long	.LASF217
+	.byte	0xa2
+	.uleb128 0x2
+	.long	.LASF218
+	.byte	0xa3
+	.uleb128 0x2
+	.long	.LASF219
+	.byte	0xa4
+	.uleb128 0x2
+	.long	.LASF220
+	.byte	0xa5
+	.uleb128 0x2
+	.long	.LASF221
+	.byte	0xa6
+	.uleb128 0x2
+	.long	.LASF222
+	.byte	0xa7
+	.uleb128 0x2
+	.long	.LASF223
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF224
+	.byte	0xa9
+	.uleb128 0x2
+	.long	.LASF225
+	.byte	0xaa
+	.uleb128 0x2
+	.long	.LASF226
+	.byte	0xab
+	.uleb128 0x2
+	.long	.LASF227
+	.byte	0xac
+	.uleb128 0x2
+	.long	.LASF228
+	.byte	0xad
+	.uleb128 0x2
+	.long	.LASF229
+	.byte	0xae
+	.uleb128 0x2
+	.long	.LASF230
+	.byte	0xaf
+	.uleb128 0x2
+	.long	.LASF231
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF232
+	.byte	0xb1
+	.uleb128 0x2
+	.long	.LASF233
+	.byte	0xb2
+	.uleb128 0x2
+	.long	.LASF234
+	.byte	0xb3
+	.uleb128 0x2
+	.long	.LASF235
+	.byte	0xb4
+	.uleb128 0x2
+	.long	.LASF236
+	.byte	0xb5
+	.uleb128 0x2
+	.long	.LASF237
+	.byte	0xb6
+	.uleb128 0x2
+	.long	.LASF238
+	.byte	0xb7
+	.uleb128 0x2
+	.long	.LASF239
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF240
+	.byte	0xb9
+	.uleb128 0x2
+	.long	.LASF241
+	.byte	0xba
+	.uleb128 0x2
+	.long	.LASF242
+	.byte	0xbb
+	.uleb128 0x2
+	.long	.LASF243
+	.byte	0xbc
+	.uleb128 0x2
+	.long	.LASF244
+	.byte	0xbd
+	.uleb128 0x2
+	.long	.LASF245
+	.byte	0xbe
+	.uleb128 0x2
+	.long	.LASF246
+	.byte	0xbf
+	.uleb128 0x2
+	.long	.LASF247
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF248
+	.byte	0xc1
+	.uleb128 0x2
+	.long	.LASF249
+	.byte	0xc2
+	.uleb128 0x2
+	.long	.LASF250
+	.byte	0xc3
+	.uleb128 0x2
+	.long	.LASF251
+	.byte	0xc4
+	.uleb128 0x2
+	.long	.LASF252
+	.byte	0xc5
+	.uleb128 0x2
+	.long	.LASF253
+	.byte	0xc6
+	.uleb128 0x2
+	.long	.LASF254
+	.byte	0xc7
+	.uleb128 0x2
+	.long	.LASF255
+	.byte	0xeb
+	.uleb128 0x2
+	.long	.LASF256
+	.byte	0xec
+	.uleb128 0x2
+	.long	.LASF257
+	.byte	0xed
+	.uleb128 0x2
+	.long	.LASF258
+	.byte	0xee
+	.uleb128 0x2
+	.long	.LASF259
+	.byte	0xef
+	.uleb128 0x2
+	.long	.LASF260
+	.byte	0xf0
+	.uleb128 0x2
+	.long	.LASF261
+	.byte	0xf1
+	.uleb128 0x2
+	.long	.LASF262
+	.byte	0xf2
+	.uleb128 0x2
+	.long	.LASF263
+	.byte	0xf3
+	.uleb128 0x2
+	.long	.LASF264
+	.byte	0xf4
+	.uleb128 0x2
+	.long	.LASF265
+	.byte	0xf5
+	.uleb128 0x2
+	.long	.LASF266
+	.byte	0xf6
+	.uleb128 0x2
+	.long	.LASF267
+	.byte	0xf7
+	.uleb128 0x2
+	.long	.LASF268
+	.byte	0xf8
+	.uleb128 0x2
+	.long	.LASF269
+	.byte	0xf9
+	.uleb128 0x2
+	.long	.LASF270
+	.byte	0xfa
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF271
+	.byte	0x8
+	.byte	0x18
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x11
+	.long	.LASF272
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x22
+	.long	.LASF274
+	.byte	0x10
+	.byte	0x9
+	.byte	0xd
+	.long	0x87b
+	.uleb128 0x27
+	.string	"ptr"
+	.byte	0x12
+	.byte	0xf
+	.long	0x314
+	.byte	0
+	.uleb128 0x27
+	.string	"len"
+	.byte	0x17
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x15
+	.long	0x856
+	.uleb128 0x36
+	.long	.LASF306
+	.byte	0x7
+	.byte	0x4
+	.long	0x46
+	.byte	0x9
+	.byte	0x7a
+	.byte	0x6
+	.long	0x8bd
+	.uleb128 0x2
+	.long	.LASF275
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF276
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF277
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF278
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF279
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF280
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF281
+	.byte	0x40
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF282
+	.value	0x100
+	.byte	0x9
+	.byte	0xab
+	.byte	0x8
+	.long	0x8d9
+	.uleb128 0x6
+	.long	.LASF283
+	.byte	0x9
+	.byte	0xb0
+	.byte	0xb
+	.long	0x8de
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x8bd
+	.uleb128 0xa
+	.long	0x83e
+	.long	0x8ee
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF284
+	.byte	0x18
+	.value	0x175
+	.long	0x922
+	.uleb128 0x7
+	.long	.LASF285
+	.value	0x17a
+	.byte	0x1c
+	.long	0x927
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF286
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF287
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF288
+	.uleb128 0x8
+	.long	0x922
+	.uleb128 0x12
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF289
+	.uleb128 0x20
+	.long	.LASF290
+	.byte	0x40
+	.value	0x1e6
+	.long	0x9a8
+	.uleb128 0x7
+	.long	.LASF291
+	.value	0x1eb
+	.byte	0xc
+	.long	0x84a
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF292
+	.value	0x1f0
+	.byte	0xc
+	.long	0x84a
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF293
+	.value	0x1f5
+	.byte	0xc
+	.long	0x84a
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF294
+	.value	0x1fa
+	.byte	0xc
+	.long	0x84a
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF295
+	.value	0x1ff
+	.byte	0xc
+	.long	0x84a
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF296
+	.value	0x204
+	.byte	0xc
+	.long	0x84a
+	.byte	0x28
+	.uleb128 0x7
+	.long	.LASF297
+	.value	0x209
+	.byte	0xc
+	.long	0x84a
+	.byte	0x30
+	.uleb128 0x7
+	.long	.LASF298
+	.value	0x20e
+	.byte	0xc
+	.long	0x84a
+	.byte	0x38
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF299
+	.byte	0x38
+	.value	0x26c
+	.long	0xa1a
+	.uleb128 0x7
+	.long	.LASF300
+	.value	0x272
+	.byte	0xd
+	.long	0xa33
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF301
+	.value	0x277
+	.byte	0x9
+	.long	0x52
+	.byte	0x8
+	.uleb128 0x28
+	.string	"fd"
+	.value	0x27c
+	.long	0x7c
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF302
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF303
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF304
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x28
+	.string	"eof"
+	.value	0x290
+	.long	0x7c
+	.byte	0x30
+	.uleb128 0x7
+	.long	.LASF305
+	.value	0x295
+	.byte	0x7
+	.long	0x7c
+	.byte	0x34
+	.byte	0
+	.uleb128 0x38
+	.long	0x2ce
+	.long	0xa33
+	.uleb128 0x4
+	.long	0x52
+	.uleb128 0x4
+	.long	0xdb
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	0xa1a
+	.uleb128 0x29
+	.long	.LASF307
+	.long	0x46
+	.value	0x29b
+	.long	0xa54
+	.uleb128 0x2
+	.long	.LASF308
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF309
+	.byte	0x1
+	.byte	0
+	.uleb128 0x15
+	.long	0xa38
+	.uleb128 0x29
+	.long	.LASF310
+	.long	0x46
+	.value	0x2b5
+	.long	0xa81
+	.uleb128 0x2
+	.long	.LASF311
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF312
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF313
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF314
+	.byte	0x3
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF315
+	.value	0x158
+	.byte	0x9
+	.value	0x2cf
+	.byte	0x8
+	.long	0xb2f
+	.uleb128 0x7
+	.long	.LASF316
+	.value	0x2d4
+	.byte	0x9
+	.long	0xdb
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF317
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF318
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF319
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF320
+	.value	0x2e8
+	.byte	0x1b
+	.long	0xa38
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF321
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x7
+	.long	.LASF322
+	.value	0x2f2
+	.byte	0x18
+	.long	0xb2f
+	.byte	0x30
+	.uleb128 0x7
+	.long	.LASF323
+	.value	0x2f7
+	.byte	0x18
+	.long	0xa59
+	.byte	0x38
+	.uleb128 0x7
+	.long	.LASF324
+	.value	0x2fc
+	.byte	0x17
+	.long	0xb34
+	.byte	0x40
+	.uleb128 0x7
+	.long	.LASF325
+	.value	0x301
+	.byte	0x8
+	.long	0xb39
+	.byte	0x48
+	.uleb128 0x2a
+	.long	.LASF326
+	.value	0x306
+	.byte	0x21
+	.long	0xb97
+	.value	0x148
+	.uleb128 0x2a
+	.long	.LASF327
+	.value	0x30b
+	.byte	0x17
+	.long	0xb9c
+	.value	0x150
+	.byte	0
+	.uleb128 0x8
+	.long	0x9a8
+	.uleb128 0x8
+	.long	0x8ee
+	.uleb128 0xa
+	.long	0xe0
+	.long	0xb49
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF328
+	.byte	0x28
+	.value	0x764
+	.long	0xb97
+	.uleb128 0x7
+	.long	.LASF329
+	.value	0x769
+	.byte	0xb
+	.long	0xbb2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF330
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF331
+	.value	0x774
+	.byte	0xd
+	.long	0xbb7
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF317
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF332
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	0xb49
+	.uleb128 0x8
+	.long	0x933
+	.uleb128 0x8
+	.long	0x87b
+	.uleb128 0x12
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF333
+	.uleb128 0x15
+	.long	0xba6
+	.uleb128 0x8
+	.long	0x2e
+	.uleb128 0x8
+	.long	0x84a
+	.uleb128 0x8
+	.long	0xa81
+	.uleb128 0x22
+	.long	.LASF334
+	.byte	0x18
+	.byte	0x1
+	.byte	0xe
+	.long	0xbf5
+	.uleb128 0x6
+	.long	.LASF335
+	.byte	0x1
+	.byte	0xf
+	.byte	0xf
+	.long	0x314
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF317
+	.byte	0x1
+	.byte	0x10
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF304
+	.byte	0x1
+	.byte	0x11
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF336
+	.byte	0xa
+	.byte	0x40
+	.byte	0xc
+	.long	0x7c
+	.long	0xc15
+	.uleb128 0x4
+	.long	0x30e
+	.uleb128 0x4
+	.long	0x30e
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF337
+	.byte	0x9
+	.value	0x486
+	.byte	0x5
+	.long	0x7c
+	.long	0xc36
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0xc36
+	.uleb128 0x4
+	.long	0xc3b
+	.byte	0
+	.uleb128 0x8
+	.long	0x8d9
+	.uleb128 0x8
+	.long	0x856
+	.uleb128 0x3a
+	.long	.LASF343
+	.byte	0x9
+	.byte	0xbd
+	.byte	0x6
+	.long	0xc5c
+	.uleb128 0x4
+	.long	0xc5c
+	.uleb128 0x4
+	.long	0x4d
+	.uleb128 0x4
+	.long	0x314
+	.byte	0
+	.uleb128 0x8
+	.long	0x8bd
+	.uleb128 0x5
+	.long	.LASF338
+	.byte	0x9
+	.value	0x4b7
+	.byte	0x5
+	.long	0x7c
+	.long	0xc7d
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0xc7d
+	.byte	0
+	.uleb128 0x8
+	.long	0x2e6
+	.uleb128 0x17
+	.long	.LASF339
+	.byte	0xa
+	.byte	0x9f
+	.byte	0xc
+	.long	0x7c
+	.long	0xca2
+	.uleb128 0x4
+	.long	0x314
+	.uleb128 0x4
+	.long	0x314
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF340
+	.byte	0x9
+	.byte	0x3d
+	.byte	0x5
+	.long	0x7c
+	.long	0xcbd
+	.uleb128 0x4
+	.long	0xba1
+	.uleb128 0x4
+	.long	0x314
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF341
+	.byte	0x9
+	.value	0x3cb
+	.byte	0x5
+	.long	0x7c
+	.long	0xcde
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0xdb
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF450
+	.byte	0x9
+	.value	0x3fb
+	.byte	0x6
+	.uleb128 0x5
+	.long	.LASF342
+	.byte	0x9
+	.value	0x3dc
+	.byte	0x7
+	.long	0xdb
+	.long	0xcfe
+	.uleb128 0x4
+	.long	0xbbc
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF344
+	.byte	0x9
+	.value	0x3f4
+	.byte	0x6
+	.long	0xd11
+	.uleb128 0x4
+	.long	0xbbc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF345
+	.byte	0x9
+	.value	0x3e9
+	.byte	0x19
+	.long	0xbbc
+	.long	0xd28
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF346
+	.byte	0xb
+	.value	0x35a
+	.byte	0xc
+	.long	0x7c
+	.long	0xd3f
+	.uleb128 0x4
+	.long	0x314
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF347
+	.byte	0x9
+	.value	0x3b9
+	.byte	0x6
+	.long	0xd52
+	.uleb128 0x4
+	.long	0xbbc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF348
+	.byte	0x9
+	.value	0x344
+	.byte	0x19
+	.long	0xbbc
+	.long	0xd69
+	.uleb128 0x4
+	.long	0x314
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF349
+	.byte	0xc
+	.value	0x238
+	.byte	0xd
+	.long	0xd7c
+	.uleb128 0x4
+	.long	0x52
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF350
+	.byte	0xa
+	.byte	0x3d
+	.byte	0xe
+	.long	0x52
+	.long	0xd9c
+	.uleb128 0x4
+	.long	0x52
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF351
+	.byte	0xc
+	.value	0x229
+	.byte	0xe
+	.long	0x52
+	.long	0xdb3
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF352
+	.byte	0xb
+	.value	0x280
+	.byte	0x11
+	.long	0x94
+	.long	0xdca
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF353
+	.byte	0xc
+	.value	0x2c4
+	.byte	0xc
+	.long	0x7c
+	.long	0xde1
+	.uleb128 0x4
+	.long	0xdb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF354
+	.byte	0x9
+	.value	0x416
+	.byte	0x6
+	.long	0xe0
+	.long	0xdf8
+	.uleb128 0x4
+	.long	0xbbc
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF355
+	.byte	0x9
+	.value	0x40b
+	.byte	0x6
+	.long	0xe0b
+	.uleb128 0x4
+	.long	0xbbc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF356
+	.byte	0x9
+	.value	0x4d3
+	.byte	0x5
+	.long	0x7c
+	.long	0xe27
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0x314
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF357
+	.byte	0x9
+	.value	0x4a4
+	.byte	0x5
+	.long	0x7c
+	.long	0xe43
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0xe43
+	.byte	0
+	.uleb128 0x8
+	.long	0xba6
+	.uleb128 0x5
+	.long	.LASF358
+	.byte	0x6
+	.value	0x17a
+	.byte	0xc
+	.long	0x7c
+	.long	0xe6a
+	.uleb128 0x4
+	.long	0xdb
+	.uleb128 0x4
+	.long	0x2e
+	.uleb128 0x4
+	.long	0x314
+	.uleb128 0x2b
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF359
+	.byte	0x9
+	.value	0x451
+	.byte	0x5
+	.long	0x7c
+	.long	0xe90
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0xe7
+	.uleb128 0x4
+	.long	0xe7
+	.uleb128 0x4
+	.long	0xc3b
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF360
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xe
+	.long	0x52
+	.long	0xeb0
+	.uleb128 0x4
+	.long	0x52
+	.uleb128 0x4
+	.long	0x30e
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF361
+	.byte	0x9
+	.value	0x317
+	.byte	0x19
+	.long	0xbbc
+	.long	0xec7
+	.uleb128 0x4
+	.long	0xdb
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF362
+	.byte	0x6
+	.byte	0xb2
+	.byte	0xc
+	.long	0x7c
+	.long	0xedd
+	.uleb128 0x4
+	.long	0x2da
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF363
+	.byte	0x9
+	.value	0x362
+	.byte	0x19
+	.long	0xbbc
+	.long	0xef9
+	.uleb128 0x4
+	.long	0x83
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF364
+	.byte	0xb
+	.value	0x166
+	.byte	0xc
+	.long	0x7c
+	.long	0xf10
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF365
+	.byte	0xb
+	.value	0x17a
+	.byte	0x10
+	.long	0x2ce
+	.long	0xf31
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x4
+	.long	0x30e
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF366
+	.byte	0xb
+	.value	0x1b5
+	.byte	0xc
+	.long	0x7c
+	.long	0xf48
+	.uleb128 0x4
+	.long	0xf48
+	.byte	0
+	.uleb128 0x8
+	.long	0x7c
+	.uleb128 0x5
+	.long	.LASF367
+	.byte	0x9
+	.value	0x371
+	.byte	0x19
+	.long	0xbbc
+	.long	0xf69
+	.uleb128 0x4
+	.long	0x2da
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF368
+	.byte	0x6
+	.value	0x2d3
+	.byte	0xd
+	.long	0xf7c
+	.uleb128 0x4
+	.long	0x2da
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF451
+	.byte	0x6
+	.byte	0xbc
+	.byte	0xe
+	.long	0x2da
+	.uleb128 0x5
+	.long	.LASF369
+	.byte	0x9
+	.value	0x384
+	.byte	0x19
+	.long	0xbbc
+	.long	0xfa9
+	.uleb128 0x4
+	.long	0xa33
+	.uleb128 0x4
+	.long	0x52
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF370
+	.byte	0x9
+	.value	0x565
+	.byte	0x5
+	.long	0x7c
+	.long	0xfc5
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0x314
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF371
+	.byte	0xa
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0xfdc
+	.uleb128 0x4
+	.long	0x314
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF372
+	.byte	0xa
+	.byte	0x9c
+	.byte	0xc
+	.long	0x7c
+	.long	0xff7
+	.uleb128 0x4
+	.long	0x314
+	.uleb128 0x4
+	.long	0x314
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF373
+	.byte	0x9
+	.value	0x583
+	.byte	0x5
+	.long	0x7c
+	.long	0x1013
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0x2f2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF374
+	.byte	0x9
+	.value	0x546
+	.byte	0x5
+	.long	0x7c
+	.long	0x1034
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0xba1
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF375
+	.byte	0x9
+	.value	0x593
+	.byte	0x5
+	.long	0x7c
+	.long	0x1050
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0x1050
+	.byte	0
+	.uleb128 0x8
+	.long	0xbad
+	.uleb128 0x5
+	.long	.LASF376
+	.byte	0x9
+	.value	0x528
+	.byte	0x5
+	.long	0x7c
+	.long	0x1076
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0x314
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF377
+	.byte	0x9
+	.value	0x555
+	.byte	0x5
+	.long	0x7c
+	.long	0x1092
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0x314
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF378
+	.byte	0x9
+	.value	0x535
+	.byte	0x5
+	.long	0x7c
+	.long	0x10ae
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0xe7
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF379
+	.byte	0x9
+	.value	0x403
+	.byte	0x6
+	.long	0x10c1
+	.uleb128 0x4
+	.long	0xbbc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF380
+	.byte	0x9
+	.value	0x4fe
+	.byte	0x5
+	.long	0x7c
+	.long	0x10dd
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF381
+	.byte	0x9
+	.value	0x50c
+	.byte	0x5
+	.long	0x7c
+	.long	0x10f4
+	.uleb128 0x4
+	.long	0xbbc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF382
+	.byte	0x6
+	.value	0x164
+	.byte	0xc
+	.long	0x7c
+	.long	0x110c
+	.uleb128 0x4
+	.long	0x314
+	.uleb128 0x2b
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF383
+	.byte	0x9
+	.value	0x519
+	.byte	0x5
+	.long	0x7c
+	.long	0x1128
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0x314
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF384
+	.byte	0x9
+	.value	0x4f0
+	.byte	0x6
+	.long	0x1145
+	.uleb128 0x4
+	.long	0xbbc
+	.uleb128 0x4
+	.long	0xa54
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF385
+	.byte	0x9
+	.value	0x353
+	.byte	0x19
+	.long	0xbbc
+	.long	0x115c
+	.uleb128 0x4
+	.long	0x3a
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF386
+	.value	0x1ee
+	.long	0x7c
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11f3
+	.uleb128 0xe
+	.quad	.LVL346
+	.long	0x2beb
+	.uleb128 0xe
+	.quad	.LVL347
+	.long	0x295d
+	.uleb128 0xe
+	.quad	.LVL348
+	.long	0x27cb
+	.uleb128 0xe
+	.quad	.LVL349
+	.long	0x15f8
+	.uleb128 0xe
+	.quad	.LVL350
+	.long	0x11f3
+	.uleb128 0xe
+	.quad	.LVL351
+	.long	0x2362
+	.uleb128 0xe
+	.quad	.LVL352
+	.long	0x1f42
+	.uleb128 0xe
+	.quad	.LVL353
+	.long	0x1b46
+	.uleb128 0xe
+	.quad	.LVL354
+	.long	0x1927
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF387
+	.value	0x1bf
+	.long	0x7c
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15b8
+	.uleb128 0xd
+	.long	.LASF388
+	.value	0x1c1
+	.byte	0xf
+	.long	0x15b8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0xd
+	.long	.LASF389
+	.value	0x1c2
+	.byte	0x7
+	.long	0x15c8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0xd
+	.long	.LASF390
+	.value	0x1c3
+	.byte	0xf
+	.long	0x15b8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 224
+	.uleb128 0xd
+	.long	.LASF391
+	.value	0x1c4
+	.byte	0x8
+	.long	0x15d8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 75
+	.uleb128 0xd
+	.long	.LASF392
+	.value	0x1c6
+	.byte	0x1a
+	.long	0x8bd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 352
+	.uleb128 0x23
+	.long	.LASF393
+	.value	0x1c9
+	.long	0x7c
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF394
+	.value	0x1cd
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x16
+	.long	.LLRL71
+	.long	0x154e
+	.uleb128 0x19
+	.string	"i"
+	.value	0x1ce
+	.byte	0xc
+	.long	0x7c
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x14
+	.long	.LLRL73
+	.uleb128 0x9
+	.long	.LASF395
+	.value	0x1cf
+	.byte	0xe
+	.long	0x7c
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x14
+	.long	.LLRL75
+	.uleb128 0xd
+	.long	.LASF316
+	.value	0x1d0
+	.byte	0xc
+	.long	0x15e8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 288
+	.uleb128 0xd
+	.long	.LASF396
+	.value	0x1d2
+	.byte	0x22
+	.long	0xbc1
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x9
+	.long	.LASF397
+	.value	0x1d3
+	.byte	0x1f
+	.long	0xbbc
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0xd
+	.long	.LASF398
+	.value	0x1d4
+	.byte	0x19
+	.long	0x856
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.uleb128 0x9
+	.long	.LASF399
+	.value	0x1d5
+	.byte	0xb
+	.long	0x7c
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x9
+	.long	.LASF400
+	.value	0x1d6
+	.byte	0xb
+	.long	0x7c
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x9
+	.long	.LASF401
+	.value	0x1da
+	.byte	0xc
+	.long	0xe0
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x3
+	.quad	.LVL310
+	.long	0xe48
+	.long	0x136f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC103
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL311
+	.long	0xfc5
+	.long	0x1387
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL312
+	.long	0xf88
+	.long	0x13b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tokenizer_test_read
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL314
+	.long	0xc15
+	.long	0x13d8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 40
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 32
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL316
+	.long	0xde1
+	.long	0x13f0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL318
+	.long	0x10f4
+	.long	0x143d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC116
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1e
+	.byte	0x3
+	.quad	.LC87
+	.byte	0x3
+	.quad	.LC88
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL320
+	.long	0x10ae
+	.long	0x1455
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL324
+	.long	0xfc5
+	.long	0x1476
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xb
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x77
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xe0
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL326
+	.long	0xdf8
+	.long	0x148e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL327
+	.long	0xde1
+	.long	0x14a6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL331
+	.long	0xeb0
+	.long	0x14bf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 56
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL333
+	.long	0x317e
+	.long	0x14d8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 16
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL335
+	.long	0xdf8
+	.long	0x14f0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL336
+	.long	0xde1
+	.long	0x1508
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL338
+	.long	0x10f4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC117
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1e
+	.byte	0x3
+	.quad	.LC87
+	.byte	0x3
+	.quad	.LC88
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL305
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL306
+	.long	0xc40
+	.long	0x1585
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 40
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC114
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL307
+	.long	0x3187
+	.long	0x15a4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC115
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL340
+	.long	0x3190
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x314
+	.long	0x15c8
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	0x7c
+	.long	0x15d8
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	0xe0
+	.long	0x15e8
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	0xe0
+	.long	0x15f8
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF402
+	.value	0x194
+	.long	0x7c
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18e7
+	.uleb128 0xd
+	.long	.LASF388
+	.value	0x196
+	.byte	0xf
+	.long	0x18e7
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 224
+	.uleb128 0xd
+	.long	.LASF389
+	.value	0x197
+	.byte	0x7
+	.long	0x18f7
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0xd
+	.long	.LASF403
+	.value	0x198
+	.byte	0xb
+	.long	0x1907
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 320
+	.uleb128 0xd
+	.long	.LASF391
+	.value	0x199
+	.byte	0x8
+	.long	0x1917
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 53
+	.uleb128 0x23
+	.long	.LASF393
+	.value	0x19b
+	.long	0x7c
+	.byte	0xb
+	.uleb128 0x9
+	.long	.LASF394
+	.value	0x19f
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x16
+	.long	.LLRL62
+	.long	0x18a9
+	.uleb128 0x19
+	.string	"i"
+	.value	0x1a0
+	.byte	0xc
+	.long	0x7c
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x14
+	.long	.LLRL64
+	.uleb128 0x9
+	.long	.LASF395
+	.value	0x1a1
+	.byte	0xe
+	.long	0x7c
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x14
+	.long	.LLRL66
+	.uleb128 0xd
+	.long	.LASF316
+	.value	0x1a2
+	.byte	0xc
+	.long	0x15e8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0xd
+	.long	.LASF396
+	.value	0x1a4
+	.byte	0x22
+	.long	0xbc1
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x9
+	.long	.LASF397
+	.value	0x1a5
+	.byte	0x1f
+	.long	0xbbc
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0xd
+	.long	.LASF404
+	.value	0x1a6
+	.byte	0xf
+	.long	0x2e6
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.uleb128 0x9
+	.long	.LASF399
+	.value	0x1a7
+	.byte	0xb
+	.long	0x7c
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x9
+	.long	.LASF401
+	.value	0x1ab
+	.byte	0xc
+	.long	0xe0
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x3
+	.quad	.LVL279
+	.long	0xe48
+	.long	0x174d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC103
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL280
+	.long	0xfc5
+	.long	0x1765
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL281
+	.long	0xf88
+	.long	0x1790
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tokenizer_test_read
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL283
+	.long	0xc61
+	.long	0x17af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 8
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL284
+	.long	0xde1
+	.long	0x17c7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL286
+	.long	0x10f4
+	.long	0x180e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC104
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1e
+	.byte	0x3
+	.quad	.LC87
+	.byte	0x3
+	.quad	.LC88
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL288
+	.long	0x10ae
+	.long	0x1826
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL299
+	.long	0xeb0
+	.long	0x183e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL301
+	.long	0xdf8
+	.uleb128 0x3
+	.quad	.LVL302
+	.long	0xde1
+	.long	0x1863
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL304
+	.long	0x10f4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC105
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1e
+	.byte	0x3
+	.quad	.LC87
+	.byte	0x3
+	.quad	.LC88
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL275
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL276
+	.long	0x3187
+	.long	0x18d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL292
+	.long	0x3190
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x314
+	.long	0x18f7
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0xa
+	.byte	0
+	.uleb128 0xa
+	.long	0x7c
+	.long	0x1907
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0xa
+	.byte	0
+	.uleb128 0xa
+	.long	0x2e6
+	.long	0x1917
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0xa
+	.byte	0
+	.uleb128 0xa
+	.long	0xe0
+	.long	0x1927
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0xa
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF405
+	.value	0x171
+	.long	0x7c
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b36
+	.uleb128 0xd
+	.long	.LASF406
+	.value	0x173
+	.byte	0x7
+	.long	0x1b36
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x23
+	.long	.LASF393
+	.value	0x175
+	.long	0x7c
+	.byte	0x4
+	.uleb128 0x9
+	.long	.LASF394
+	.value	0x179
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x16
+	.long	.LLRL52
+	.long	0x1b03
+	.uleb128 0x19
+	.string	"i"
+	.value	0x17a
+	.byte	0xc
+	.long	0x7c
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x14
+	.long	.LLRL54
+	.uleb128 0x9
+	.long	.LASF397
+	.value	0x17b
+	.byte	0x1d
+	.long	0xbbc
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x9
+	.long	.LASF407
+	.value	0x17f
+	.byte	0x9
+	.long	0x7c
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x9
+	.long	.LASF317
+	.value	0x180
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x9
+	.long	.LASF408
+	.value	0x181
+	.byte	0x9
+	.long	0x7c
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x16
+	.long	.LLRL59
+	.long	0x1a1e
+	.uleb128 0x19
+	.string	"j"
+	.value	0x17c
+	.byte	0xe
+	.long	0x7c
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0xc
+	.quad	.LVL257
+	.long	0x110c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL253
+	.long	0x1145
+	.long	0x1a36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL260
+	.long	0xfc5
+	.long	0x1a4e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL261
+	.long	0xc82
+	.long	0x1a78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x22
+	.byte	0x34
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL264
+	.long	0x10f4
+	.long	0x1aa6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL267
+	.long	0x10ae
+	.long	0x1abe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL273
+	.long	0x10f4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC86
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1c
+	.byte	0x3
+	.quad	.LC81
+	.byte	0x3
+	.quad	.LC80
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL251
+	.long	0x3187
+	.long	0x1b22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC83
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL268
+	.long	0x3190
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x7c
+	.long	0x1b46
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF409
+	.value	0x136
+	.long	0x7c
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f32
+	.uleb128 0x9
+	.long	.LASF394
+	.value	0x139
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x9
+	.long	.LASF397
+	.value	0x13b
+	.byte	0x1b
+	.long	0xbbc
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x9
+	.long	.LASF317
+	.value	0x13f
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x9
+	.long	.LASF410
+	.value	0x141
+	.byte	0x1b
+	.long	0xbbc
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x9
+	.long	.LASF316
+	.value	0x14b
+	.byte	0x9
+	.long	0xdb
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x3d
+	.long	.LASF437
+	.byte	0x1
+	.value	0x14d
+	.byte	0x7
+	.long	0x7c
+	.uleb128 0xd
+	.long	.LASF411
+	.value	0x15c
+	.byte	0x8
+	.long	0x2fe
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0xd
+	.long	.LASF412
+	.value	0x15d
+	.byte	0x8
+	.long	0x1f32
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0xd
+	.long	.LASF398
+	.value	0x15f
+	.byte	0x15
+	.long	0x856
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x2c
+	.quad	.LBB39
+	.quad	.LBE39-.LBB39
+	.long	0x1c4a
+	.uleb128 0x19
+	.string	"i"
+	.value	0x13c
+	.byte	0xc
+	.long	0x7c
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0xc
+	.quad	.LVL207
+	.long	0x110c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LLRL49
+	.long	0x1c80
+	.uleb128 0x19
+	.string	"i"
+	.value	0x14e
+	.byte	0xc
+	.long	0x7c
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0xc
+	.quad	.LVL222
+	.long	0x110c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL204
+	.long	0x3187
+	.long	0x1c9f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC69
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL205
+	.long	0xd11
+	.long	0x1cb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL209
+	.long	0xcfe
+	.long	0x1cce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL210
+	.long	0xd11
+	.long	0x1ce5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL213
+	.long	0x3187
+	.long	0x1d04
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL215
+	.long	0x110c
+	.long	0x1d29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL216
+	.long	0xce7
+	.long	0x1d41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL223
+	.long	0xcfe
+	.long	0x1d59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL224
+	.long	0xfdc
+	.long	0x1d7e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL225
+	.long	0x10f4
+	.long	0x1da3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL227
+	.long	0xd69
+	.long	0x1dbb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL228
+	.long	0xcde
+	.uleb128 0x3
+	.quad	.LVL230
+	.long	0xeb0
+	.long	0x1de1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL232
+	.long	0xe6a
+	.long	0x1e0b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL233
+	.long	0xcbd
+	.long	0x1e2f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL234
+	.long	0xe6a
+	.long	0x1e59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL235
+	.long	0x3187
+	.long	0x1e78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC76
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL237
+	.long	0x10ae
+	.long	0x1e90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL238
+	.long	0x3190
+	.long	0x1ea7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL243
+	.long	0x10f4
+	.long	0x1ecc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL246
+	.long	0x10f4
+	.long	0x1ef1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC71
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL248
+	.long	0xca2
+	.long	0x1f16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC77
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL249
+	.long	0x3187
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC78
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xe0
+	.long	0x1f42
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x11
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF413
+	.byte	0xf9
+	.long	0x7c
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2352
+	.uleb128 0xf
+	.long	.LASF414
+	.byte	0xfd
+	.byte	0x8
+	.long	0x2352
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.uleb128 0x1a
+	.string	"fd"
+	.byte	0xfe
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x9
+	.long	.LASF415
+	.value	0x103
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x9
+	.long	.LASF416
+	.value	0x104
+	.byte	0x9
+	.long	0xdb
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x9
+	.long	.LASF417
+	.value	0x108
+	.byte	0xb
+	.long	0x2ce
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x9
+	.long	.LASF394
+	.value	0x10c
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x9
+	.long	.LASF397
+	.value	0x10d
+	.byte	0x1b
+	.long	0xbbc
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0xd
+	.long	.LASF418
+	.value	0x10e
+	.byte	0x8
+	.long	0xb39
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0x3
+	.quad	.LVL155
+	.long	0x3187
+	.long	0x2014
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC56
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL156
+	.long	0xdca
+	.long	0x202c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL157
+	.long	0xdb3
+	.long	0x2043
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x4e
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL159
+	.long	0xd9c
+	.long	0x205b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL161
+	.long	0xd7c
+	.long	0x207f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL162
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL163
+	.long	0xf10
+	.long	0x20ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL165
+	.long	0xef9
+	.long	0x20c6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL166
+	.long	0xd69
+	.long	0x20de
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL169
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL171
+	.long	0x10f4
+	.long	0x210e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL173
+	.long	0x10ae
+	.long	0x2126
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL174
+	.long	0xd28
+	.long	0x213e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL175
+	.long	0xd52
+	.long	0x2156
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL176
+	.long	0x3187
+	.long	0x2175
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC65
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL178
+	.long	0x3190
+	.long	0x218c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL180
+	.long	0x3187
+	.long	0x21ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC57
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL182
+	.long	0xd52
+	.long	0x21ca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC66
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL183
+	.long	0x3187
+	.long	0x21e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC67
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL185
+	.long	0xd52
+	.long	0x2201
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL188
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL189
+	.long	0x2fe5
+	.long	0x2233
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x24
+	.long	0x2f0d
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL191
+	.long	0x10f4
+	.long	0x2258
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL193
+	.long	0xd3f
+	.long	0x2270
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL194
+	.long	0x10dd
+	.long	0x2288
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL195
+	.long	0x10c1
+	.long	0x22a8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL196
+	.long	0x3187
+	.long	0x22c7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC62
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL198
+	.long	0xfdc
+	.long	0x22ec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL200
+	.long	0x10f4
+	.long	0x2311
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC61
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL202
+	.long	0x110c
+	.long	0x2336
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC63
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL203
+	.long	0x3187
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xe0
+	.long	0x2362
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x17
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF419
+	.byte	0xb0
+	.long	0x7c
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x279b
+	.uleb128 0xf
+	.long	.LASF420
+	.byte	0xb2
+	.byte	0xa
+	.long	0x279b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0xf
+	.long	.LASF421
+	.byte	0xb3
+	.byte	0xf
+	.long	0x27ab
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x1e
+	.long	.LASF422
+	.byte	0xb5
+	.long	0x7c
+	.byte	0x4
+	.uleb128 0x1e
+	.long	.LASF423
+	.byte	0xb6
+	.long	0x7c
+	.byte	0x3
+	.uleb128 0x10
+	.long	.LASF394
+	.byte	0xba
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xf
+	.long	.LASF316
+	.byte	0xe5
+	.byte	0x8
+	.long	0x27bb
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x10
+	.long	.LASF397
+	.byte	0xe6
+	.byte	0x1b
+	.long	0xbbc
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0xf
+	.long	.LASF418
+	.byte	0xe7
+	.byte	0x8
+	.long	0xb39
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 224
+	.uleb128 0x16
+	.long	.LLRL29
+	.long	0x266d
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0xbb
+	.byte	0xc
+	.long	0x7c
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x14
+	.long	.LLRL31
+	.uleb128 0x1a
+	.string	"j"
+	.byte	0xbc
+	.byte	0xe
+	.long	0x7c
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x14
+	.long	.LLRL33
+	.uleb128 0xf
+	.long	.LASF396
+	.byte	0xbd
+	.byte	0x22
+	.long	0xbc1
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.uleb128 0x10
+	.long	.LASF397
+	.byte	0xbe
+	.byte	0x1f
+	.long	0xbbc
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x10
+	.long	.LASF424
+	.byte	0xbf
+	.byte	0xd
+	.long	0x2da
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x3e
+	.string	"fds"
+	.byte	0x1
+	.byte	0xc0
+	.byte	0xb
+	.long	0xbf
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 56
+	.uleb128 0xf
+	.long	.LASF418
+	.byte	0xce
+	.byte	0xc
+	.long	0xb39
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 224
+	.uleb128 0x2c
+	.quad	.LBB27
+	.quad	.LBE27-.LBB27
+	.long	0x24d2
+	.uleb128 0x10
+	.long	.LASF417
+	.byte	0xca
+	.byte	0x11
+	.long	0x2ce
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0xe
+	.quad	.LVL148
+	.long	0xf10
+	.uleb128 0xe
+	.quad	.LVL150
+	.long	0xef9
+	.uleb128 0xe
+	.quad	.LVL151
+	.long	0xedd
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL103
+	.long	0xf31
+	.long	0x24ea
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 56
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL105
+	.long	0x10f4
+	.long	0x251b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL107
+	.long	0x10ae
+	.long	0x2533
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL108
+	.long	0xec7
+	.long	0x254c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 40
+	.byte	0x6
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL129
+	.long	0xef9
+	.uleb128 0x3
+	.quad	.LVL131
+	.long	0xf88
+	.long	0x257f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	tokenizer_test_read
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL133
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL134
+	.long	0x2fe5
+	.long	0x25b1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x24
+	.long	0x2f0d
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL135
+	.long	0xfdc
+	.long	0x25d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC49
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL136
+	.long	0x10f4
+	.long	0x2601
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL139
+	.long	0xf7c
+	.uleb128 0x3
+	.quad	.LVL141
+	.long	0x3199
+	.long	0x263e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL142
+	.long	0xf69
+	.long	0x2656
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL143
+	.long	0xf4d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL98
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL99
+	.long	0x3187
+	.long	0x2697
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL104
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x13
+	.quad	.LVL113
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL114
+	.long	0xeb0
+	.long	0x26c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL116
+	.long	0x2fe5
+	.long	0x26ec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x24
+	.long	0x2f0d
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL117
+	.long	0x31a2
+	.long	0x2711
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC49
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL118
+	.long	0x10f4
+	.long	0x2736
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL120
+	.long	0x10ae
+	.long	0x274e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL121
+	.long	0x3190
+	.long	0x2765
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL137
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL146
+	.long	0x3187
+	.long	0x278f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC55
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL154
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.long	0x2e
+	.long	0x27ab
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	0x314
+	.long	0x27bb
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	0xe0
+	.long	0x27cb
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x5c
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF425
+	.byte	0x91
+	.long	0x7c
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x294d
+	.uleb128 0xf
+	.long	.LASF388
+	.byte	0x93
+	.byte	0xf
+	.long	0x294d
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0xf
+	.long	.LASF426
+	.byte	0x94
+	.byte	0xf
+	.long	0x294d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0x1e
+	.long	.LASF393
+	.byte	0x96
+	.long	0x7c
+	.byte	0x7
+	.uleb128 0x10
+	.long	.LASF394
+	.byte	0x9a
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x16
+	.long	.LLRL23
+	.long	0x290f
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0x9b
+	.byte	0xc
+	.long	0x7c
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x14
+	.long	.LLRL25
+	.uleb128 0x10
+	.long	.LASF397
+	.byte	0x9c
+	.byte	0x1d
+	.long	0xbbc
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x3
+	.quad	.LVL83
+	.long	0x10f4
+	.long	0x2877
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC41
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL86
+	.long	0x10ae
+	.long	0x288f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL88
+	.long	0x1145
+	.long	0x28a6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL90
+	.long	0xfa9
+	.long	0x28c8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL91
+	.long	0xfdc
+	.long	0x28eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL92
+	.long	0x10f4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC42
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 24
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL80
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.quad	.LVL81
+	.long	0x3187
+	.long	0x2939
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC40
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL94
+	.long	0x3190
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x314
+	.long	0x295d
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x6
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF427
+	.byte	0x6d
+	.long	0x7c
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2bdb
+	.uleb128 0x10
+	.long	.LASF394
+	.byte	0x70
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x10
+	.long	.LASF397
+	.byte	0x71
+	.byte	0x1b
+	.long	0xbbc
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xf
+	.long	.LASF404
+	.byte	0x74
+	.byte	0xa
+	.long	0xba6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0xf
+	.long	.LASF428
+	.byte	0x75
+	.byte	0x15
+	.long	0x2bdb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1e
+	.long	.LASF429
+	.byte	0x76
+	.long	0x7c
+	.byte	0x1
+	.uleb128 0xf
+	.long	.LASF430
+	.byte	0x7f
+	.byte	0xf
+	.long	0x314
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC20
+	.byte	0x9f
+	.uleb128 0x3
+	.quad	.LVL56
+	.long	0x3187
+	.long	0x2a01
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL57
+	.long	0x1145
+	.long	0x2a18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL60
+	.long	0x1092
+	.long	0x2a36
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7b
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL61
+	.long	0x1076
+	.long	0x2a5b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL62
+	.long	0x10f4
+	.long	0x2a7a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL64
+	.long	0x10ae
+	.long	0x2a92
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL65
+	.long	0x3190
+	.long	0x2aa9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL69
+	.long	0x1055
+	.long	0x2ad3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL70
+	.long	0x1034
+	.long	0x2af2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL71
+	.long	0x1092
+	.long	0x2b10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2c
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL72
+	.long	0x1013
+	.long	0x2b34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL73
+	.long	0x110c
+	.long	0x2b59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL74
+	.long	0xff7
+	.long	0x2b77
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xd6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL75
+	.long	0x1092
+	.long	0x2b95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7d
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL77
+	.long	0xfdc
+	.long	0x2bb7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL78
+	.long	0x10f4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x856
+	.long	0x2beb
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF431
+	.byte	0x3d
+	.long	0x7c
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ecc
+	.uleb128 0xf
+	.long	.LASF432
+	.byte	0x3f
+	.byte	0x1b
+	.long	0x2ecc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -172
+	.uleb128 0xf
+	.long	.LASF433
+	.byte	0x40
+	.byte	0xa
+	.long	0x2edc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0xf
+	.long	.LASF434
+	.byte	0x41
+	.byte	0xa
+	.long	0x2edc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0xf
+	.long	.LASF435
+	.byte	0x42
+	.byte	0xf
+	.long	0x27ab
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1e
+	.long	.LASF393
+	.byte	0x44
+	.long	0x7c
+	.byte	0x3
+	.uleb128 0x10
+	.long	.LASF394
+	.byte	0x48
+	.byte	0x7
+	.long	0x7c
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x16
+	.long	.LLRL11
+	.long	0x2e99
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0x49
+	.byte	0xc
+	.long	0x7c
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x14
+	.long	.LLRL13
+	.uleb128 0x10
+	.long	.LASF397
+	.byte	0x4a
+	.byte	0x1d
+	.long	0xbbc
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x10
+	.long	.LASF295
+	.byte	0x4d
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x16
+	.long	.LLRL16
+	.long	0x2cf8
+	.uleb128 0x1a
+	.string	"j"
+	.byte	0x4e
+	.byte	0xe
+	.long	0x7c
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x14
+	.long	.LLRL18
+	.uleb128 0x10
+	.long	.LASF317
+	.byte	0x4f
+	.byte	0xe
+	.long	0x2e
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xc
+	.quad	.LVL37
+	.long	0x110c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL31
+	.long	0x1145
+	.long	0x2d13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -200
+	.byte	0x6
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL34
+	.long	0x1128
+	.long	0x2d48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xb
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -192
+	.byte	0x6
+	.byte	0x22
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x6
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL39
+	.long	0x10f4
+	.long	0x2d7b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.byte	0x22
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL42
+	.long	0x10ae
+	.long	0x2d93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL47
+	.long	0x10dd
+	.long	0x2dab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL48
+	.long	0x10f4
+	.long	0x2dd8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL50
+	.long	0x31a2
+	.long	0x2df7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL51
+	.long	0x10c1
+	.long	0x2e16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL52
+	.long	0x10f4
+	.long	0x2e43
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL54
+	.long	0x110c
+	.long	0x2e68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL55
+	.long	0x10f4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.byte	0x22
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL29
+	.long	0x3187
+	.long	0x2eb8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL43
+	.long	0x3190
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xa38
+	.long	0x2edc
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	0x2e
+	.long	0x2eec
+	.uleb128 0xb
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF452
+	.byte	0x1
+	.byte	0x25
+	.byte	0xd
+	.byte	0x1
+	.long	0x2f46
+	.uleb128 0x25
+	.long	.LASF397
+	.byte	0x39
+	.long	0xbbc
+	.uleb128 0x25
+	.long	.LASF418
+	.byte	0x4a
+	.long	0xdb
+	.uleb128 0x25
+	.long	.LASF436
+	.byte	0x62
+	.long	0x3a
+	.uleb128 0x21
+	.long	.LASF317
+	.byte	0x26
+	.byte	0xa
+	.long	0x2e
+	.uleb128 0x21
+	.long	.LASF401
+	.byte	0x27
+	.byte	0x8
+	.long	0xe0
+	.uleb128 0x40
+	.uleb128 0x21
+	.long	.LASF398
+	.byte	0x2a
+	.byte	0x17
+	.long	0x856
+	.uleb128 0x21
+	.long	.LASF404
+	.byte	0x2b
+	.byte	0xc
+	.long	0xba6
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF453
+	.byte	0x1
+	.byte	0x17
+	.byte	0x10
+	.long	0x2ce
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2fe0
+	.uleb128 0x26
+	.long	.LASF301
+	.byte	0x2a
+	.long	0x52
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x26
+	.long	.LASF438
+	.byte	0x39
+	.long	0xdb
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x26
+	.long	.LASF436
+	.byte	0x48
+	.long	0x2e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x10
+	.long	.LASF396
+	.byte	0x18
+	.byte	0x1f
+	.long	0x2fe0
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x10
+	.long	.LASF330
+	.byte	0x19
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xc
+	.quad	.LVL7
+	.long	0x31ab
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xbc1
+	.uleb128 0x42
+	.long	0x2eec
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x317e
+	.uleb128 0x2d
+	.long	0x2ef9
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2d
+	.long	0x2f03
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x2e
+	.long	0x2f17
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x2e
+	.long	0x2f22
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x43
+	.long	0x2f0d
+	.value	0x100
+	.uleb128 0x44
+	.long	0x2f2d
+	.long	.LLRL9
+	.long	0x3169
+	.uleb128 0x2f
+	.long	0x2f2e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2f
+	.long	0x2f39
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x3
+	.quad	.LVL12
+	.long	0xe27
+	.long	0x3078
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL13
+	.long	0xe0b
+	.long	0x3096
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL14
+	.long	0xdf8
+	.long	0x30ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL16
+	.long	0xe6a
+	.long	0x30d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL17
+	.long	0xe48
+	.long	0x310a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL19
+	.long	0xe48
+	.long	0x313b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL26
+	.long	0xe48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL15
+	.long	0xde1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF336
+	.long	.LASF440
+	.uleb128 0x1b
+	.long	.LASF439
+	.long	.LASF441
+	.uleb128 0x1b
+	.long	.LASF442
+	.long	.LASF443
+	.uleb128 0x1b
+	.long	.LASF444
+	.long	.LASF445
+	.uleb128 0x1b
+	.long	.LASF372
+	.long	.LASF446
+	.uleb128 0x1b
+	.long	.LASF360
+	.long	.LASF447
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x80
+	.uleb128 0x13
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 37
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS70:
+	.uleb128 .LVU797
+	.uleb128 .LVU802
+	.uleb128 .LVU802
+	.uleb128 .LVU814
+	.uleb128 .LVU828
+	.uleb128 .LVU829
+	.uleb128 .LVU829
+	.uleb128 .LVU835
+	.uleb128 .LVU846
+	.uleb128 .LVU852
+	.uleb128 .LVU864
+	.uleb128 .LVU868
+	.uleb128 .LVU868
+	.uleb128 .LVU872
+	.uleb128 .LVU872
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 52
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 52
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 52
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 52
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x22c
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x22c
+	.byte	0x1c
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU799
+	.uleb128 .LVU802
+	.uleb128 .LVU802
+	.uleb128 .LVU848
+	.uleb128 .LVU848
+	.uleb128 .LVU849
+	.uleb128 .LVU851
+	.uleb128 .LVU864
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL307-.Ltext0
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU802
+	.uleb128 .LVU804
+	.uleb128 .LVU804
+	.uleb128 .LVU814
+	.uleb128 .LVU831
+	.uleb128 .LVU834
+	.uleb128 .LVU846
+	.uleb128 .LVU851
+	.uleb128 .LVU851
+	.uleb128 .LVU852
+	.uleb128 .LVU864
+	.uleb128 .LVU871
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL308-.Ltext0
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL309-.Ltext0
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0xf
+	.byte	0x31
+	.byte	0x32
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0xf
+	.byte	0x31
+	.byte	0x32
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0xf
+	.byte	0x31
+	.byte	0x32
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU814
+	.uleb128 .LVU851
+	.uleb128 .LVU852
+	.uleb128 .LVU869
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU819
+	.uleb128 .LVU823
+	.uleb128 .LVU823
+	.uleb128 .LVU835
+	.uleb128 .LVU835
+	.uleb128 .LVU836
+	.uleb128 .LVU836
+	.uleb128 .LVU851
+	.uleb128 .LVU852
+	.uleb128 .LVU870
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL316-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL316-1-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU841
+	.uleb128 .LVU843
+	.uleb128 .LVU853
+	.uleb128 .LVU856
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0xa
+	.byte	0x77
+	.sleb128 24
+	.byte	0x94
+	.byte	0x4
+	.byte	0x30
+	.byte	0x29
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU823
+	.uleb128 .LVU826
+	.uleb128 .LVU826
+	.uleb128 .LVU827
+	.uleb128 .LVU845
+	.uleb128 .LVU846
+	.uleb128 .LVU859
+	.uleb128 .LVU863
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL318-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL327-.Ltext0
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU701
+	.uleb128 .LVU706
+	.uleb128 .LVU706
+	.uleb128 .LVU718
+	.uleb128 .LVU733
+	.uleb128 .LVU734
+	.uleb128 .LVU734
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU749
+	.uleb128 .LVU749
+	.uleb128 .LVU750
+	.uleb128 .LVU750
+	.uleb128 .LVU751
+	.uleb128 .LVU751
+	.uleb128 .LVU752
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -136
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x188
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x188
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU703
+	.uleb128 .LVU706
+	.uleb128 .LVU706
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU742
+	.uleb128 .LVU751
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL276-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU706
+	.uleb128 .LVU708
+	.uleb128 .LVU708
+	.uleb128 .LVU718
+	.uleb128 .LVU736
+	.uleb128 .LVU738
+	.uleb128 .LVU739
+	.uleb128 .LVU748
+	.uleb128 .LVU751
+	.uleb128 .LVU752
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0xf
+	.byte	0x31
+	.byte	0x32
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0xf
+	.byte	0x31
+	.byte	0x32
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU718
+	.uleb128 .LVU747
+	.uleb128 .LVU752
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU723
+	.uleb128 .LVU727
+	.uleb128 .LVU727
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU749
+	.uleb128 .LVU749
+	.uleb128 .LVU750
+	.uleb128 .LVU750
+	.uleb128 .LVU751
+	.uleb128 .LVU752
+	.uleb128 .LVU753
+	.uleb128 .LVU753
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL284-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL284-1-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 28
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -132
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x184
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x184
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL301-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL301-1-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 28
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU727
+	.uleb128 .LVU731
+	.uleb128 .LVU731
+	.uleb128 .LVU732
+	.uleb128 .LVU755
+	.uleb128 .LVU762
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL286-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU615
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU617
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 .LVU660
+	.uleb128 .LVU660
+	.uleb128 .LVU662
+	.uleb128 .LVU669
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0xa
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x50
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0xa
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x4c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0xa
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x50
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU623
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU668
+	.uleb128 .LVU669
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL270-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x4
+	.byte	0x7f
+	.sleb128 -72
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU643
+	.uleb128 .LVU646
+	.uleb128 .LVU646
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL260-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL260-1-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU644
+	.uleb128 .LVU666
+	.uleb128 .LVU669
+	.uleb128 0
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU652
+	.uleb128 .LVU655
+	.uleb128 .LVU669
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU625
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 .LVU629
+	.uleb128 .LVU629
+	.uleb128 .LVU631
+	.uleb128 .LVU631
+	.uleb128 .LVU632
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU523
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 .LVU542
+	.uleb128 .LVU542
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU567
+	.uleb128 .LVU567
+	.uleb128 .LVU587
+	.uleb128 .LVU587
+	.uleb128 .LVU588
+	.uleb128 .LVU588
+	.uleb128 .LVU594
+	.uleb128 .LVU594
+	.uleb128 .LVU595
+	.uleb128 .LVU595
+	.uleb128 .LVU596
+	.uleb128 .LVU596
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU525
+	.uleb128 .LVU528
+	.uleb128 .LVU528
+	.uleb128 .LVU556
+	.uleb128 .LVU578
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU592
+	.uleb128 .LVU596
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL232-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL232-1-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU534
+	.uleb128 .LVU555
+	.uleb128 .LVU596
+	.uleb128 .LVU602
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU537
+	.uleb128 .LVU539
+	.uleb128 .LVU539
+	.uleb128 .LVU577
+	.uleb128 .LVU595
+	.uleb128 .LVU596
+	.uleb128 .LVU596
+	.uleb128 .LVU599
+	.uleb128 .LVU599
+	.uleb128 .LVU602
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU547
+	.uleb128 .LVU551
+	.uleb128 .LVU551
+	.uleb128 .LVU593
+	.uleb128 .LVU595
+	.uleb128 .LVU596
+	.uleb128 .LVU602
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU527
+	.uleb128 .LVU528
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU554
+	.uleb128 .LVU556
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU430
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 .LVU461
+	.uleb128 .LVU476
+	.uleb128 .LVU477
+	.uleb128 .LVU482
+	.uleb128 .LVU493
+	.uleb128 .LVU507
+	.uleb128 .LVU508
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL157-1-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU437
+	.uleb128 .LVU439
+	.uleb128 .LVU439
+	.uleb128 .LVU475
+	.uleb128 .LVU479
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL159-1-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU441
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 .LVU458
+	.uleb128 .LVU482
+	.uleb128 .LVU485
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU451
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU465
+	.uleb128 .LVU482
+	.uleb128 .LVU490
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU454
+	.uleb128 .LVU463
+	.uleb128 .LVU463
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU472
+	.uleb128 .LVU472
+	.uleb128 .LVU473
+	.uleb128 .LVU473
+	.uleb128 .LVU475
+	.uleb128 .LVU479
+	.uleb128 .LVU482
+	.uleb128 .LVU482
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU497
+	.uleb128 .LVU505
+	.uleb128 .LVU507
+	.uleb128 .LVU507
+	.uleb128 .LVU511
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU456
+	.uleb128 .LVU458
+	.uleb128 .LVU485
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL189-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL189-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU300
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU337
+	.uleb128 .LVU339
+	.uleb128 .LVU356
+	.uleb128 .LVU356
+	.uleb128 .LVU357
+	.uleb128 .LVU357
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU364
+	.uleb128 .LVU364
+	.uleb128 .LVU365
+	.uleb128 .LVU365
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU375
+	.uleb128 .LVU390
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 -28
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x1bc
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xe0
+	.byte	0x1a
+	.byte	0xa
+	.value	0x1bc
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU349
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 .LVU362
+	.uleb128 .LVU398
+	.uleb128 .LVU400
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU302
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 .LVU340
+	.uleb128 .LVU340
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU363
+	.uleb128 .LVU366
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0xb
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x60
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x60
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x68
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x28
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0xb
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x60
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0xd
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x68
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0xb
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x60
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU304
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU336
+	.uleb128 .LVU366
+	.uleb128 .LVU368
+	.uleb128 .LVU371
+	.uleb128 .LVU398
+	.uleb128 .LVU400
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU309
+	.uleb128 .LVU324
+	.uleb128 .LVU371
+	.uleb128 .LVU375
+	.uleb128 .LVU375
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 .LVU397
+	.uleb128 .LVU397
+	.uleb128 .LVU398
+	.uleb128 .LVU400
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU310
+	.uleb128 .LVU324
+	.uleb128 .LVU371
+	.uleb128 .LVU375
+	.uleb128 .LVU375
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 .LVU394
+	.uleb128 .LVU394
+	.uleb128 .LVU397
+	.uleb128 .LVU397
+	.uleb128 .LVU398
+	.uleb128 .LVU400
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL141-1-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU404
+	.uleb128 .LVU405
+	.uleb128 .LVU405
+	.uleb128 .LVU408
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU251
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU253
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU263
+	.uleb128 .LVU264
+	.uleb128 .LVU278
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU256
+	.uleb128 .LVU264
+	.uleb128 .LVU269
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU282
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU173
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU177
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU198
+	.uleb128 .LVU200
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU94
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -180
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -180
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -180
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -180
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU96
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU130
+	.uleb128 .LVU138
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU100
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU136
+	.uleb128 .LVU138
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU109
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU111
+	.uleb128 .LVU113
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU114
+	.uleb128 .LVU115
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 8
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU3
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU7
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x7
+	.byte	0x76
+	.sleb128 8
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU22
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU63
+	.uleb128 .LVU65
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU45
+	.uleb128 .LVU51
+	.uleb128 .LVU60
+	.uleb128 .LVU65
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0
+.LLRL59:
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0
+.LLRL64:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL66:
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0
+.LLRL71:
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL73:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF338:
+	.string	"st_extract_int64"
+.LASF337:
+	.string	"st_extract_until_view"
+.LASF311:
+	.string	"ST_STRING_BORROWED"
+.LASF249:
+	.string	"_SC_LEVEL3_CACHE_SIZE"
+.LASF159:
+	.string	"_SC_INT_MAX"
+.LASF7:
+	.string	"size_t"
+.LASF346:
+	.string	"unlink"
+.LASF70:
+	.string	"_SC_MAPPED_FILES"
+.LASF55:
+	.string	"_SC_CHILD_MAX"
+.LASF56:
+	.string	"_SC_CLK_TCK"
+.LASF287:
+	.string	"used"
+.LASF390:
+	.string	"view_values"
+.LASF88:
+	.string	"_SC_SIGQUEUE_MAX"
+.LASF15:
+	.string	"__ssize_t"
+.LASF394:
+	.string	"exit_status"
+.LASF48:
+	.string	"_IO_codecvt"
+.LASF267:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF195:
+	.string	"_SC_DEVICE_IO"
+.LASF297:
+	.string	"conversions"
+.LASF422:
+	.string	"num_chunks"
+.LASF28:
+	.string	"_IO_save_end"
+.LASF253:
+	.string	"_SC_LEVEL4_CACHE_ASSOC"
+.LASF61:
+	.string	"_SC_JOB_CONTROL"
+.LASF157:
+	.string	"_SC_CHAR_MAX"
+.LASF414:
+	.string	"path"
+.LASF365:
+	.string	"write"
+.LASF238:
+	.string	"_SC_TRACE_INHERIT"
+.LASF144:
+	.string	"_SC_XOPEN_VERSION"
+.LASF21:
+	.string	"_IO_write_base"
+.LASF339:
+	.string	"strncmp"
+.LASF124:
+	.string	"_SC_GETGR_R_SIZE_MAX"
+.LASF109:
+	.string	"_SC_PII_SOCKET"
+.LASF158:
+	.string	"_SC_CHAR_MIN"
+.LASF376:
+	.string	"st_append_n"
+.LASF388:
+	.string	"string_values"
+.LASF37:
+	.string	"_lock"
+.LASF62:
+	.string	"_SC_SAVED_IDS"
+.LASF439:
+	.string	"puts"
+.LASF327:
+	.string	"stats"
+.LASF391:
+	.string	"token_values"
+.LASF166:
+	.string	"_SC_SCHAR_MAX"
+.LASF54:
+	.string	"_SC_ARG_MAX"
+.LASF359:
+	.string	"st_sub_string_view"
+.LASF219:
+	.string	"_SC_TIMEOUTS"
+.LASF26:
+	.string	"_IO_save_base"
+.LASF156:
+	.string	"_SC_CHAR_BIT"
+.LASF77:
+	.string	"_SC_AIO_LISTIO_MAX"
+.LASF163:
+	.string	"_SC_MB_LEN_MAX"
+.LASF136:
+	.string	"_SC_THREAD_PRIO_PROTECT"
+.LASF110:
+	.string	"_SC_PII_INTERNET"
+.LASF137:
+	.string	"_SC_THREAD_PROCESS_SHARED"
+.LASF30:
+	.string	"_chain"
+.LASF50:
+	.string	"ssize_t"
+.LASF263:
+	.string	"_SC_TRACE_NAME_MAX"
+.LASF330:
+	.string	"count"
+.LASF34:
+	.string	"_cur_column"
+.LASF320:
+	.string	"growth_policy"
+.LASF107:
+	.string	"_SC_PII"
+.LASF79:
+	.string	"_SC_AIO_PRIO_DELTA_MAX"
+.LASF8:
+	.string	"__uint8_t"
+.LASF325:
+	.string	"inline_buffer"
+.LASF73:
+	.string	"_SC_MEMORY_PROTECTION"
+.LASF324:
+	.string	"arena"
+.LASF58:
+	.string	"_SC_OPEN_MAX"
+.LASF131:
+	.string	"_SC_THREAD_THREADS_MAX"
+.LASF208:
+	.string	"_SC_READER_WRITER_LOCKS"
+.LASF229:
+	.string	"_SC_STREAMS"
+.LASF310:
+	.string	"StringOwnership"
+.LASF11:
+	.string	"long int"
+.LASF81:
+	.string	"_SC_MQ_OPEN_MAX"
+.LASF280:
+	.string	"ST_CLASS_ESCAPE"
+.LASF199:
+	.string	"_SC_FIFO"
+.LASF151:
+	.string	"_SC_2_C_VERSION"
+.LASF268:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF47:
+	.string	"_IO_marker"
+.LASF91:
+	.string	"_SC_BC_DIM_MAX"
+.LASF317:
+	.string	"length"
+.LASF305:
+	.string	"error"
+.LASF285:
+	.string	"head"
+.LASF132:
+	.string	"_SC_THREAD_ATTR_STACKADDR"
+.LASF257:
+	.string	"_SC_V7_ILP32_OFF32"
+.LASF171:
+	.string	"_SC_UINT_MAX"
+.LASF347:
+	.string	"st_reset"
+.LASF440:
+	.string	"__builtin_memcmp"
+.LASF225:
+	.string	"_SC_2_PBS_LOCATE"
+.LASF370:
+	.string	"st_append_escaped_string"
+.LASF6:
+	.string	"signed char"
+.LASF245:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE"
+.LASF273:
+	.string	"_IO_FILE"
+.LASF384:
+	.string	"st_set_growth_policy"
+.LASF49:
+	.string	"_IO_wide_data"
+.LASF357:
+	.string	"st_extract_double_to"
+.LASF272:
+	.string	"uint64_t"
+.LASF237:
+	.string	"_SC_TRACE_EVENT_FILTER"
+.LASF301:
+	.string	"context"
+.LASF175:
+	.string	"_SC_NL_LANGMAX"
+.LASF233:
+	.string	"_SC_V6_LP64_OFF64"
+.LASF176:
+	.string	"_SC_NL_MSGMAX"
+.LASF4:
+	.string	"unsigned char"
+.LASF41:
+	.string	"_freeres_list"
+.LASF119:
+	.string	"_SC_PII_OSI_CLTS"
+.LASF362:
+	.string	"fclose"
+.LASF380:
+	.string	"st_reserve"
+.LASF241:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC"
+.LASF197:
+	.string	"_SC_DEVICE_SPECIFIC_R"
+.LASF423:
+	.string	"num_sources"
+.LASF164:
+	.string	"_SC_NZERO"
+.LASF153:
+	.string	"_SC_XOPEN_XPG2"
+.LASF154:
+	.string	"_SC_XOPEN_XPG3"
+.LASF155:
+	.string	"_SC_XOPEN_XPG4"
+.LASF172:
+	.string	"_SC_ULONG_MAX"
+.LASF148:
+	.string	"_SC_XOPEN_ENH_I18N"
+.LASF397:
+	.string	"tokenizer"
+.LASF404:
+	.string	"value"
+.LASF400:
+	.string	"matches"
+.LASF160:
+	.string	"_SC_INT_MIN"
+.LASF16:
+	.string	"char"
+.LASF152:
+	.string	"_SC_2_UPE"
+.LASF84:
+	.string	"_SC_PAGESIZE"
+.LASF203:
+	.string	"_SC_FILE_SYSTEM"
+.LASF303:
+	.string	"capacity"
+.LASF449:
+	.string	"_IO_lock_t"
+.LASF345:
+	.string	"st_pool_acquire"
+.LASF100:
+	.string	"_SC_2_VERSION"
+.LASF447:
+	.string	"__builtin_memcpy"
+.LASF98:
+	.string	"_SC_RE_DUP_MAX"
+.LASF402:
+	.string	"run_st_extract_int64_unit_tests"
+.LASF396:
+	.string	"source"
+.LASF250:
+	.string	"_SC_LEVEL3_CACHE_ASSOC"
+.LASF103:
+	.string	"_SC_2_FORT_DEV"
+.LASF18:
+	.string	"_IO_read_ptr"
+.LASF341:
+	.string	"st_rebind"
+.LASF115:
+	.string	"_SC_IOV_MAX"
+.LASF372:
+	.string	"strcmp"
+.LASF323:
+	.string	"ownership"
+.LASF194:
+	.string	"_SC_THREAD_CPUTIME"
+.LASF217:
+	.string	"_SC_SYSTEM_DATABASE"
+.LASF322:
+	.string	"stream"
+.LASF117:
+	.string	"_SC_PII_INTERNET_DGRAM"
+.LASF386:
+	.string	"run_string_tokenizer_tests"
+.LASF420:
+	.string	"chunk_sizes"
+.LASF202:
+	.string	"_SC_FILE_LOCKING"
+.LASF29:
+	.string	"_markers"
+.LASF424:
+	.string	"file"
+.LASF167:
+	.string	"_SC_SCHAR_MIN"
+.LASF279:
+	.string	"ST_CLASS_STRUCTURAL"
+.LASF373:
+	.string	"st_append_int"
+.LASF114:
+	.string	"_SC_UIO_MAXIOV"
+.LASF340:
+	.string	"sv_equals"
+.LASF313:
+	.string	"ST_STRING_MAPPED"
+.LASF382:
+	.string	"printf"
+.LASF438:
+	.string	"buffer"
+.LASF307:
+	.string	"StringGrowthPolicy"
+.LASF83:
+	.string	"_SC_VERSION"
+.LASF392:
+	.string	"delimiters"
+.LASF321:
+	.string	"max_increment"
+.LASF209:
+	.string	"_SC_SPIN_LOCKS"
+.LASF38:
+	.string	"_offset"
+.LASF277:
+	.string	"ST_CLASS_NUMERIC"
+.LASF243:
+	.string	"_SC_LEVEL1_DCACHE_SIZE"
+.LASF227:
+	.string	"_SC_2_PBS_TRACK"
+.LASF302:
+	.string	"chunk_size"
+.LASF256:
+	.string	"_SC_RAW_SOCKETS"
+.LASF122:
+	.string	"_SC_THREADS"
+.LASF123:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS"
+.LASF162:
+	.string	"_SC_WORD_BIT"
+.LASF210:
+	.string	"_SC_REGEXP"
+.LASF66:
+	.string	"_SC_ASYNCHRONOUS_IO"
+.LASF99:
+	.string	"_SC_CHARCLASS_NAME_MAX"
+.LASF244:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC"
+.LASF251:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE"
+.LASF445:
+	.string	"__builtin_fwrite"
+.LASF130:
+	.string	"_SC_THREAD_STACK_MIN"
+.LASF12:
+	.string	"__uint64_t"
+.LASF452:
+	.string	"tokenizer_test_walk"
+.LASF2:
+	.string	"long unsigned int"
+.LASF146:
+	.string	"_SC_XOPEN_UNIX"
+.LASF314:
+	.string	"ST_STRING_INLINE"
+.LASF448:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF332:
+	.string	"hint"
+.LASF179:
+	.string	"_SC_NL_TEXTMAX"
+.LASF32:
+	.string	"_flags2"
+.LASF116:
+	.string	"_SC_PII_INTERNET_STREAM"
+.LASF270:
+	.string	"_SC_SIGSTKSZ"
+.LASF232:
+	.string	"_SC_V6_ILP32_OFFBIG"
+.LASF20:
+	.string	"_IO_read_base"
+.LASF258:
+	.string	"_SC_V7_ILP32_OFFBIG"
+.LASF75:
+	.string	"_SC_SEMAPHORES"
+.LASF252:
+	.string	"_SC_LEVEL4_CACHE_SIZE"
+.LASF269:
+	.string	"_SC_MINSIGSTKSZ"
+.LASF45:
+	.string	"_unused2"
+.LASF430:
+	.string	"expected"
+.LASF450:
+	.string	"st_pool_clear"
+.LASF205:
+	.string	"_SC_MULTI_PROCESS"
+.LASF139:
+	.string	"_SC_NPROCESSORS_ONLN"
+.LASF283:
+	.string	"members"
+.LASF221:
+	.string	"_SC_USER_GROUPS"
+.LASF284:
+	.string	"StringArena"
+.LASF106:
+	.string	"_SC_2_LOCALEDEF"
+.LASF97:
+	.string	"_SC_LINE_MAX"
+.LASF33:
+	.string	"_old_offset"
+.LASF140:
+	.string	"_SC_PHYS_PAGES"
+.LASF185:
+	.string	"_SC_XOPEN_REALTIME"
+.LASF377:
+	.string	"st_append_quoted_string"
+.LASF213:
+	.string	"_SC_SIGNALS"
+.LASF403:
+	.string	"integer_values"
+.LASF204:
+	.string	"_SC_MONOTONIC_CLOCK"
+.LASF353:
+	.string	"mkstemp"
+.LASF85:
+	.string	"_SC_RTSIG_MAX"
+.LASF201:
+	.string	"_SC_FILE_ATTRIBUTES"
+.LASF222:
+	.string	"_SC_USER_GROUPS_R"
+.LASF145:
+	.string	"_SC_XOPEN_XCU_VERSION"
+.LASF108:
+	.string	"_SC_PII_XTI"
+.LASF186:
+	.string	"_SC_XOPEN_REALTIME_THREADS"
+.LASF51:
+	.string	"long long int"
+.LASF161:
+	.string	"_SC_LONG_BIT"
+.LASF410:
+	.string	"reused"
+.LASF433:
+	.string	"max_increment_values"
+.LASF399:
+	.string	"extracted"
+.LASF181:
+	.string	"_SC_XBS5_ILP32_OFFBIG"
+.LASF429:
+	.string	"appended"
+.LASF389:
+	.string	"extracted_values"
+.LASF412:
+	.string	"second"
+.LASF333:
+	.string	"double"
+.LASF435:
+	.string	"policy_names"
+.LASF23:
+	.string	"_IO_write_end"
+.LASF398:
+	.string	"view"
+.LASF366:
+	.string	"pipe"
+.LASF170:
+	.string	"_SC_UCHAR_MAX"
+.LASF200:
+	.string	"_SC_PIPE"
+.LASF220:
+	.string	"_SC_TYPED_MEMORY_OBJECTS"
+.LASF312:
+	.string	"ST_STRING_OWNED"
+.LASF441:
+	.string	"__builtin_puts"
+.LASF126:
+	.string	"_SC_LOGIN_NAME_MAX"
+.LASF129:
+	.string	"_SC_THREAD_KEYS_MAX"
+.LASF187:
+	.string	"_SC_ADVISORY_INFO"
+.LASF361:
+	.string	"st_create"
+.LASF281:
+	.string	"ST_CLASS_ALPHA"
+.LASF300:
+	.string	"read"
+.LASF24:
+	.string	"_IO_buf_base"
+.LASF316:
+	.string	"string"
+.LASF3:
+	.string	"unsigned int"
+.LASF292:
+	.string	"tokens_extracted"
+.LASF290:
+	.string	"StringStats"
+.LASF318:
+	.string	"position"
+.LASF94:
+	.string	"_SC_COLL_WEIGHTS_MAX"
+.LASF120:
+	.string	"_SC_PII_OSI_M"
+.LASF102:
+	.string	"_SC_2_C_DEV"
+.LASF43:
+	.string	"__pad5"
+.LASF218:
+	.string	"_SC_SYSTEM_DATABASE_R"
+.LASF344:
+	.string	"st_pool_release"
+.LASF288:
+	.string	"StringArenaBlock"
+.LASF262:
+	.string	"_SC_TRACE_EVENT_NAME_MAX"
+.LASF355:
+	.string	"st_next_token"
+.LASF173:
+	.string	"_SC_USHRT_MAX"
+.LASF413:
+	.string	"run_st_create_from_mmap_unit_tests"
+.LASF255:
+	.string	"_SC_IPV6"
+.LASF235:
+	.string	"_SC_HOST_NAME_MAX"
+.LASF93:
+	.string	"_SC_BC_STRING_MAX"
+.LASF134:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING"
+.LASF17:
+	.string	"_flags"
+.LASF304:
+	.string	"offset"
+.LASF407:
+	.string	"is_inline"
+.LASF443:
+	.string	"__builtin_putchar"
+.LASF395:
+	.string	"streamed"
+.LASF411:
+	.string	"first"
+.LASF44:
+	.string	"_mode"
+.LASF282:
+	.string	"StringCharClass"
+.LASF39:
+	.string	"_codecvt"
+.LASF105:
+	.string	"_SC_2_SW_DEV"
+.LASF63:
+	.string	"_SC_REALTIME_SIGNALS"
+.LASF378:
+	.string	"st_append_char"
+.LASF393:
+	.string	"num_tests"
+.LASF183:
+	.string	"_SC_XBS5_LPBIG_OFFBIG"
+.LASF224:
+	.string	"_SC_2_PBS_ACCOUNTING"
+.LASF128:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF239:
+	.string	"_SC_TRACE_LOG"
+.LASF289:
+	.string	"long double"
+.LASF71:
+	.string	"_SC_MEMLOCK"
+.LASF111:
+	.string	"_SC_PII_OSI"
+.LASF80:
+	.string	"_SC_DELAYTIMER_MAX"
+.LASF104:
+	.string	"_SC_2_FORT_RUN"
+.LASF259:
+	.string	"_SC_V7_LP64_OFF64"
+.LASF138:
+	.string	"_SC_NPROCESSORS_CONF"
+.LASF168:
+	.string	"_SC_SHRT_MAX"
+.LASF319:
+	.string	"incremental_factor"
+.LASF331:
+	.string	"in_string"
+.LASF46:
+	.string	"FILE"
+.LASF78:
+	.string	"_SC_AIO_MAX"
+.LASF188:
+	.string	"_SC_BARRIERS"
+.LASF211:
+	.string	"_SC_REGEX_VERSION"
+.LASF248:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE"
+.LASF431:
+	.string	"run_st_expand_string_unit_tests"
+.LASF196:
+	.string	"_SC_DEVICE_SPECIFIC"
+.LASF76:
+	.string	"_SC_SHARED_MEMORY_OBJECTS"
+.LASF343:
+	.string	"st_char_class_init"
+.LASF451:
+	.string	"tmpfile"
+.LASF354:
+	.string	"st_current_token"
+.LASF381:
+	.string	"st_shrink_to_fit"
+.LASF428:
+	.string	"fragments"
+.LASF436:
+	.string	"size"
+.LASF182:
+	.string	"_SC_XBS5_LP64_OFF64"
+.LASF53:
+	.string	"long long unsigned int"
+.LASF275:
+	.string	"ST_CLASS_WHITESPACE"
+.LASF274:
+	.string	"StringView"
+.LASF260:
+	.string	"_SC_V7_LPBIG_OFFBIG"
+.LASF271:
+	.string	"uint8_t"
+.LASF174:
+	.string	"_SC_NL_ARGMAX"
+.LASF425:
+	.string	"run_st_append_escaped_string_unit_tests"
+.LASF13:
+	.string	"__off_t"
+.LASF374:
+	.string	"st_append_many"
+.LASF329:
+	.string	"positions"
+.LASF206:
+	.string	"_SC_SINGLE_PROCESS"
+.LASF296:
+	.string	"bytes_copied"
+.LASF141:
+	.string	"_SC_AVPHYS_PAGES"
+.LASF149:
+	.string	"_SC_XOPEN_SHM"
+.LASF416:
+	.string	"document"
+.LASF216:
+	.string	"_SC_THREAD_SPORADIC_SERVER"
+.LASF42:
+	.string	"_freeres_buf"
+.LASF387:
+	.string	"run_st_extract_until_view_unit_tests"
+.LASF261:
+	.string	"_SC_SS_REPL_MAX"
+.LASF293:
+	.string	"allocations"
+.LASF334:
+	.string	"TokenizerTestSource"
+.LASF177:
+	.string	"_SC_NL_NMAX"
+.LASF406:
+	.string	"append_values"
+.LASF446:
+	.string	"__builtin_strcmp"
+.LASF350:
+	.string	"memset"
+.LASF27:
+	.string	"_IO_backup_base"
+.LASF36:
+	.string	"_shortbuf"
+.LASF356:
+	.string	"st_starts_with"
+.LASF315:
+	.string	"StringTokenizer"
+.LASF226:
+	.string	"_SC_2_PBS_MESSAGE"
+.LASF86:
+	.string	"_SC_SEM_NSEMS_MAX"
+.LASF298:
+	.string	"conversion_ns"
+.LASF121:
+	.string	"_SC_T_IOV_MAX"
+.LASF67:
+	.string	"_SC_PRIORITIZED_IO"
+.LASF421:
+	.string	"source_names"
+.LASF286:
+	.string	"block_size"
+.LASF351:
+	.string	"malloc"
+.LASF14:
+	.string	"__off64_t"
+.LASF231:
+	.string	"_SC_V6_ILP32_OFF32"
+.LASF59:
+	.string	"_SC_STREAM_MAX"
+.LASF60:
+	.string	"_SC_TZNAME_MAX"
+.LASF336:
+	.string	"memcmp"
+.LASF230:
+	.string	"_SC_2_PBS_CHECKPOINT"
+.LASF214:
+	.string	"_SC_SPAWN"
+.LASF72:
+	.string	"_SC_MEMLOCK_RANGE"
+.LASF92:
+	.string	"_SC_BC_SCALE_MAX"
+.LASF385:
+	.string	"st_create_empty"
+.LASF352:
+	.string	"sysconf"
+.LASF264:
+	.string	"_SC_TRACE_SYS_MAX"
+.LASF228:
+	.string	"_SC_SYMLOOP_MAX"
+.LASF368:
+	.string	"rewind"
+.LASF25:
+	.string	"_IO_buf_end"
+.LASF405:
+	.string	"run_st_inline_buffer_unit_tests"
+.LASF150:
+	.string	"_SC_2_CHAR_TERM"
+.LASF212:
+	.string	"_SC_SHELL"
+.LASF198:
+	.string	"_SC_FD_MGMT"
+.LASF276:
+	.string	"ST_CLASS_DIGIT"
+.LASF147:
+	.string	"_SC_XOPEN_CRYPT"
+.LASF242:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE"
+.LASF326:
+	.string	"structural_index"
+.LASF191:
+	.string	"_SC_C_LANG_SUPPORT_R"
+.LASF265:
+	.string	"_SC_TRACE_USER_EVENT_MAX"
+.LASF89:
+	.string	"_SC_TIMER_MAX"
+.LASF432:
+	.string	"policy_values"
+.LASF223:
+	.string	"_SC_2_PBS"
+.LASF193:
+	.string	"_SC_CPUTIME"
+.LASF215:
+	.string	"_SC_SPORADIC_SERVER"
+.LASF9:
+	.string	"short int"
+.LASF427:
+	.string	"run_st_append_unit_tests"
+.LASF192:
+	.string	"_SC_CLOCK_SELECTION"
+.LASF180:
+	.string	"_SC_XBS5_ILP32_OFF32"
+.LASF309:
+	.string	"ST_GROWTH_LINEAR"
+.LASF207:
+	.string	"_SC_NETWORKING"
+.LASF254:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE"
+.LASF142:
+	.string	"_SC_ATEXIT_MAX"
+.LASF306:
+	.string	"StringCharClassBits"
+.LASF291:
+	.string	"bytes_scanned"
+.LASF118:
+	.string	"_SC_PII_OSI_COTS"
+.LASF328:
+	.string	"StringStructuralIndex"
+.LASF82:
+	.string	"_SC_MQ_PRIO_MAX"
+.LASF35:
+	.string	"_vtable_offset"
+.LASF87:
+	.string	"_SC_SEM_VALUE_MAX"
+.LASF190:
+	.string	"_SC_C_LANG_SUPPORT"
+.LASF369:
+	.string	"st_create_from_callback"
+.LASF65:
+	.string	"_SC_TIMERS"
+.LASF143:
+	.string	"_SC_PASS_MAX"
+.LASF69:
+	.string	"_SC_FSYNC"
+.LASF113:
+	.string	"_SC_SELECT"
+.LASF342:
+	.string	"st_detach_string"
+.LASF358:
+	.string	"snprintf"
+.LASF127:
+	.string	"_SC_TTY_NAME_MAX"
+.LASF442:
+	.string	"putchar"
+.LASF418:
+	.string	"signature"
+.LASF408:
+	.string	"valid"
+.LASF371:
+	.string	"strlen"
+.LASF10:
+	.string	"__int64_t"
+.LASF112:
+	.string	"_SC_POLL"
+.LASF348:
+	.string	"st_create_from_mmap"
+.LASF360:
+	.string	"memcpy"
+.LASF417:
+	.string	"written"
+.LASF308:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF74:
+	.string	"_SC_MESSAGE_PASSING"
+.LASF19:
+	.string	"_IO_read_end"
+.LASF247:
+	.string	"_SC_LEVEL2_CACHE_ASSOC"
+.LASF419:
+	.string	"run_st_stream_unit_tests"
+.LASF90:
+	.string	"_SC_BC_BASE_MAX"
+.LASF379:
+	.string	"st_destroy"
+.LASF367:
+	.string	"st_create_from_file"
+.LASF246:
+	.string	"_SC_LEVEL2_CACHE_SIZE"
+.LASF96:
+	.string	"_SC_EXPR_NEST_MAX"
+.LASF68:
+	.string	"_SC_SYNCHRONIZED_IO"
+.LASF31:
+	.string	"_fileno"
+.LASF266:
+	.string	"_SC_XOPEN_STREAMS"
+.LASF169:
+	.string	"_SC_SHRT_MIN"
+.LASF40:
+	.string	"_wide_data"
+.LASF453:
+	.string	"tokenizer_test_read"
+.LASF401:
+	.string	"token"
+.LASF57:
+	.string	"_SC_NGROUPS_MAX"
+.LASF234:
+	.string	"_SC_V6_LPBIG_OFFBIG"
+.LASF349:
+	.string	"free"
+.LASF415:
+	.string	"page_size"
+.LASF5:
+	.string	"short unsigned int"
+.LASF240:
+	.string	"_SC_LEVEL1_ICACHE_SIZE"
+.LASF295:
+	.string	"expansions"
+.LASF294:
+	.string	"reallocations"
+.LASF375:
+	.string	"st_append_double"
+.LASF95:
+	.string	"_SC_EQUIV_CLASS_MAX"
+.LASF22:
+	.string	"_IO_write_ptr"
+.LASF189:
+	.string	"_SC_BASE"
+.LASF64:
+	.string	"_SC_PRIORITY_SCHEDULING"
+.LASF299:
+	.string	"StringStream"
+.LASF52:
+	.string	"int64_t"
+.LASF165:
+	.string	"_SC_SSIZE_MAX"
+.LASF125:
+	.string	"_SC_GETPW_R_SIZE_MAX"
+.LASF184:
+	.string	"_SC_XOPEN_LEGACY"
+.LASF437:
+	.string	"empty"
+.LASF135:
+	.string	"_SC_THREAD_PRIO_INHERIT"
+.LASF236:
+	.string	"_SC_TRACE"
+.LASF363:
+	.string	"st_create_from_fd"
+.LASF278:
+	.string	"ST_CLASS_HEX"
+.LASF335:
+	.string	"data"
+.LASF383:
+	.string	"st_append_string"
+.LASF364:
+	.string	"close"
+.LASF178:
+	.string	"_SC_NL_SETMAX"
+.LASF409:
+	.string	"run_st_pool_unit_tests"
+.LASF434:
+	.string	"max_expansions"
+.LASF444:
+	.string	"fwrite"
+.LASF101:
+	.string	"_SC_2_C_BIND"
+.LASF426:
+	.string	"expected_values"
+.LASF133:
+	.string	"_SC_THREAD_ATTR_STACKSIZE"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/tests/string_tokenizer_unit_tests.c"
+.LASF1:
+	.string	"/root/repo/build/test"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
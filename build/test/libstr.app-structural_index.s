@@ -0,0 +1,11129 @@
+	.file	"structural_index.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo/build/test" "/root/repo/src/structural_index.c"
+	.p2align 4
+	.type	structural_index_classify_scalar, @function
+structural_index_classify_scalar:
+.LVL0:
+.LFB6407:
+	.file 1 "/root/repo/src/structural_index.c"
+	.loc 1 49 101 view -0
+	.cfi_startproc
+	.loc 1 50 3 view .LVU1
+	.loc 1 51 3 view .LVU2
+	.loc 1 52 3 view .LVU3
+	.loc 1 53 3 view .LVU4
+	.loc 1 50 21 is_stmt 0 view .LVU5
+	vpxor	%xmm0, %xmm0, %xmm0
+	vmovdqu	%ymm0, (%rsi)
+	.loc 1 54 3 is_stmt 1 view .LVU6
+.LBB206:
+	.loc 1 54 8 view .LVU7
+.LVL1:
+	.loc 1 54 21 view .LVU8
+.LBE206:
+	.loc 1 50 21 is_stmt 0 view .LVU9
+	xorl	%edx, %edx
+.LBB211:
+.LBB207:
+	.loc 1 56 14 view .LVU10
+	movl	$1, %r9d
+	movabsq	$21474836485, %r10
+	jmp	.L8
+.LVL2:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.loc 1 58 7 is_stmt 1 view .LVU11
+	.loc 1 58 25 is_stmt 0 view .LVU12
+	orq	%r8, (%rsi)
+.L3:
+	.loc 1 58 25 view .LVU13
+.LBE207:
+	.loc 1 54 28 is_stmt 1 discriminator 2 view .LVU14
+.LVL3:
+	.loc 1 54 21 discriminator 2 view .LVU15
+	incq	%rdx
+.LVL4:
+	.loc 1 54 21 is_stmt 0 discriminator 2 view .LVU16
+	cmpq	$64, %rdx
+	je	.L17
+.LVL5:
+.L8:
+.LBB208:
+	.loc 1 55 5 is_stmt 1 view .LVU17
+	.loc 1 55 47 is_stmt 0 view .LVU18
+	movzbl	(%rdi,%rdx), %eax
+.LVL6:
+	.loc 1 56 5 is_stmt 1 view .LVU19
+	.loc 1 56 14 is_stmt 0 view .LVU20
+	shlx	%rdx, %r9, %r8
+.LVL7:
+	.loc 1 57 5 is_stmt 1 view .LVU21
+	.loc 1 57 8 is_stmt 0 view .LVU22
+	cmpb	$32, %al
+	jbe	.L18
+	.loc 1 60 10 is_stmt 1 view .LVU23
+	cmpb	$125, %al
+	jg	.L3
+	cmpb	$90, %al
+	jg	.L4
+	cmpb	$34, %al
+	jne	.L19
+	.loc 1 64 7 view .LVU24
+.LBE208:
+	.loc 1 54 21 is_stmt 0 view .LVU25
+	incq	%rdx
+.LVL8:
+.LBB209:
+	.loc 1 64 21 view .LVU26
+	orq	%r8, 16(%rsi)
+.LBE209:
+	.loc 1 54 28 is_stmt 1 view .LVU27
+.LVL9:
+	.loc 1 54 21 view .LVU28
+	cmpq	$64, %rdx
+	jne	.L8
+.L17:
+	.loc 1 54 21 is_stmt 0 view .LVU29
+	vzeroupper
+.LVL10:
+.LBE211:
+	.loc 1 70 1 view .LVU30
+	ret
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 1 70 1 view .LVU31
+	leal	-91(%rax), %ecx
+	shlx	%rcx, %r9, %rcx
+	testq	%r10, %rcx
+	jne	.L6
+	cmpb	$92, %al
+	jne	.L3
+.LBB212:
+.LBB210:
+	.loc 1 67 7 is_stmt 1 view .LVU32
+	.loc 1 67 26 is_stmt 0 view .LVU33
+	orq	%r8, 24(%rsi)
+	jmp	.L3
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.loc 1 67 26 view .LVU34
+	cmpb	$33, %al
+	jle	.L3
+	cmpb	$44, %al
+	je	.L6
+	cmpb	$58, %al
+	jne	.L3
+.L6:
+	.loc 1 61 7 is_stmt 1 view .LVU35
+	.loc 1 61 24 is_stmt 0 view .LVU36
+	orq	%r8, 8(%rsi)
+	jmp	.L3
+.LBE210:
+.LBE212:
+	.cfi_endproc
+.LFE6407:
+	.size	structural_index_classify_scalar, .-structural_index_classify_scalar
+	.p2align 4
+	.type	structural_index_classify_avx512, @function
+structural_index_classify_avx512:
+.LVL12:
+.LFB6410:
+	.loc 1 127 101 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 128 3 view .LVU38
+.LBB213:
+.LBI213:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx512fintrin.h"
+	.loc 2 6490 1 view .LVU39
+.LBB214:
+	.loc 2 6492 3 view .LVU40
+	.loc 2 6492 3 is_stmt 0 view .LVU41
+.LBE214:
+.LBE213:
+	.loc 1 129 3 is_stmt 1 view .LVU42
+.LBB216:
+.LBI216:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx512bwintrin.h"
+	.loc 3 2579 1 view .LVU43
+.LBB217:
+	.loc 3 2581 3 view .LVU44
+.LBE217:
+.LBE216:
+.LBB220:
+.LBB215:
+	.loc 2 6492 10 is_stmt 0 view .LVU45
+	vmovdqu64	(%rdi), %zmm0
+.LBE215:
+.LBE220:
+.LBB221:
+.LBB218:
+	.loc 3 2581 10 view .LVU46
+	movl	$33, %eax
+	vpbroadcastb	%eax, %zmm1
+.LBE218:
+.LBE221:
+.LBB222:
+.LBB223:
+	.loc 3 1655 10 view .LVU47
+	movl	$123, %eax
+.LBE223:
+.LBE222:
+.LBB227:
+.LBB219:
+	.loc 3 2581 10 view .LVU48
+	vpcmpub	$1, %zmm1, %zmm0, %k2
+.LVL13:
+	.loc 3 2581 10 view .LVU49
+.LBE219:
+.LBE227:
+.LBB228:
+.LBB224:
+	.loc 3 1655 10 view .LVU50
+	vpbroadcastb	%eax, %zmm1
+.LBE224:
+.LBE228:
+.LBB229:
+.LBB230:
+	movl	$125, %eax
+.LBE230:
+.LBE229:
+.LBB233:
+.LBB225:
+	vpcmpb	$0, %zmm1, %zmm0, %k0
+.LBE225:
+.LBE233:
+.LBB234:
+.LBB235:
+	movl	$91, %ecx
+.LBE235:
+.LBE234:
+.LBB240:
+.LBB231:
+	vpbroadcastb	%eax, %zmm1
+	vpcmpb	$0, %zmm1, %zmm0, %k1
+.LBE231:
+.LBE240:
+.LBB241:
+.LBB236:
+	vpbroadcastb	%ecx, %zmm1
+.LBE236:
+.LBE241:
+.LBB242:
+.LBB243:
+	movl	$93, %ecx
+.LBE243:
+.LBE242:
+.LBB248:
+.LBB237:
+	vpcmpb	$0, %zmm1, %zmm0, %k3
+.LBE237:
+.LBE248:
+.LBB249:
+.LBB244:
+	vpbroadcastb	%ecx, %zmm1
+.LBE244:
+.LBE249:
+.LBB250:
+.LBB251:
+	movl	$58, %ecx
+.LBE251:
+.LBE250:
+.LBB255:
+.LBB245:
+	vpcmpb	$0, %zmm1, %zmm0, %k4
+.LBE245:
+.LBE255:
+.LBB256:
+.LBB252:
+	vpbroadcastb	%ecx, %zmm1
+.LBE252:
+.LBE256:
+.LBB257:
+.LBB258:
+	movl	$44, %ecx
+.LBE258:
+.LBE257:
+.LBB263:
+.LBB253:
+	vpcmpb	$0, %zmm1, %zmm0, %k5
+.LBE253:
+.LBE263:
+	.loc 1 130 75 view .LVU51
+	kmovq	%k0, %r9
+.LBB264:
+.LBB259:
+	.loc 3 1655 10 view .LVU52
+	vpbroadcastb	%ecx, %zmm1
+.LBE259:
+.LBE264:
+	.loc 1 130 75 view .LVU53
+	kmovq	%k1, %rax
+	orq	%r9, %rax
+.LBB265:
+.LBB260:
+	.loc 3 1655 10 view .LVU54
+	vpcmpb	$0, %zmm1, %zmm0, %k6
+.LBE260:
+.LBE265:
+.LBB266:
+.LBB238:
+	kmovq	%k3, %r8
+.LBE238:
+.LBE266:
+	.loc 1 131 5 view .LVU55
+	orq	%r8, %rax
+.LBB267:
+.LBB246:
+	.loc 3 1655 10 view .LVU56
+	kmovq	%k4, %rdi
+.LVL14:
+	.loc 3 1655 10 view .LVU57
+.LBE246:
+.LBE267:
+	.loc 1 131 60 view .LVU58
+	orq	%rdi, %rax
+	.loc 1 127 101 view .LVU59
+	movq	%rsi, %rdx
+	.loc 1 129 21 view .LVU60
+	kmovq	%k2, (%rsi)
+	.loc 1 130 3 is_stmt 1 view .LVU61
+.LVL15:
+.LBB268:
+.LBI222:
+	.loc 3 1653 1 view .LVU62
+.LBB226:
+	.loc 3 1655 3 view .LVU63
+	.loc 3 1655 3 is_stmt 0 view .LVU64
+.LBE226:
+.LBE268:
+.LBB269:
+.LBI229:
+	.loc 3 1653 1 is_stmt 1 view .LVU65
+.LBB232:
+	.loc 3 1655 3 view .LVU66
+	.loc 3 1655 3 is_stmt 0 view .LVU67
+.LBE232:
+.LBE269:
+.LBB270:
+.LBI234:
+	.loc 3 1653 1 is_stmt 1 view .LVU68
+.LBB239:
+	.loc 3 1655 3 view .LVU69
+	.loc 3 1655 3 is_stmt 0 view .LVU70
+.LBE239:
+.LBE270:
+.LBB271:
+.LBI242:
+	.loc 3 1653 1 is_stmt 1 view .LVU71
+.LBB247:
+	.loc 3 1655 3 view .LVU72
+	.loc 3 1655 3 is_stmt 0 view .LVU73
+.LBE247:
+.LBE271:
+.LBB272:
+.LBI250:
+	.loc 3 1653 1 is_stmt 1 view .LVU74
+.LBB254:
+	.loc 3 1655 3 view .LVU75
+	.loc 3 1655 10 is_stmt 0 view .LVU76
+	kmovq	%k5, %rsi
+.LVL16:
+	.loc 3 1655 10 view .LVU77
+.LBE254:
+.LBE272:
+.LBB273:
+.LBI257:
+	.loc 3 1653 1 is_stmt 1 view .LVU78
+.LBB261:
+	.loc 3 1655 3 view .LVU79
+.LBE261:
+.LBE273:
+	.loc 1 132 5 is_stmt 0 view .LVU80
+	orq	%rsi, %rax
+.LBB274:
+.LBB262:
+	.loc 3 1655 10 view .LVU81
+	kmovq	%k6, %rcx
+.LVL17:
+	.loc 3 1655 10 view .LVU82
+.LBE262:
+.LBE274:
+	.loc 1 132 60 view .LVU83
+	orq	%rcx, %rax
+	movq	%rax, 8(%rdx)
+	.loc 1 133 3 is_stmt 1 view .LVU84
+.LVL18:
+.LBB275:
+.LBI275:
+	.loc 3 1653 1 view .LVU85
+.LBB276:
+	.loc 3 1655 3 view .LVU86
+	.loc 3 1655 10 is_stmt 0 view .LVU87
+	movl	$34, %eax
+	vpbroadcastb	%eax, %zmm1
+.LBE276:
+.LBE275:
+.LBB278:
+.LBB279:
+	movl	$92, %eax
+.LBE279:
+.LBE278:
+.LBB282:
+.LBB277:
+	vpcmpb	$0, %zmm1, %zmm0, %k7
+.LVL19:
+	.loc 3 1655 10 view .LVU88
+.LBE277:
+.LBE282:
+.LBB283:
+.LBB280:
+	vpbroadcastb	%eax, %zmm1
+	vpcmpb	$0, %zmm1, %zmm0, %k0
+.LBE280:
+.LBE283:
+	.loc 1 133 17 view .LVU89
+	kmovq	%k7, 16(%rdx)
+	.loc 1 134 3 is_stmt 1 view .LVU90
+.LVL20:
+.LBB284:
+.LBI278:
+	.loc 3 1653 1 view .LVU91
+.LBB281:
+	.loc 3 1655 3 view .LVU92
+	.loc 3 1655 3 is_stmt 0 view .LVU93
+.LBE281:
+.LBE284:
+	.loc 1 134 22 view .LVU94
+	kmovq	%k0, 24(%rdx)
+	vzeroupper
+.LVL21:
+	.loc 1 135 1 view .LVU95
+	ret
+	.cfi_endproc
+.LFE6410:
+	.size	structural_index_classify_avx512, .-structural_index_classify_avx512
+	.p2align 4
+	.type	structural_index_classify_avx2, @function
+structural_index_classify_avx2:
+.LVL22:
+.LFB6409:
+	.loc 1 103 99 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 104 3 view .LVU97
+	.loc 1 105 3 view .LVU98
+	.loc 1 106 3 view .LVU99
+	.loc 1 107 3 view .LVU100
+	.loc 1 108 3 view .LVU101
+.LBB285:
+.LBB286:
+.LBB287:
+.LBB288:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h"
+	.loc 4 233 34 is_stmt 0 view .LVU102
+	movl	$125, %eax
+	vpbroadcastb	%eax, %ymm4
+.LBE288:
+.LBE287:
+.LBE286:
+.LBE285:
+	.loc 1 105 21 view .LVU103
+	vpxor	%xmm0, %xmm0, %xmm0
+.LBB440:
+.LBB435:
+.LBB293:
+.LBB294:
+	.loc 4 233 34 view .LVU104
+	movl	$123, %eax
+.LBE294:
+.LBE293:
+.LBE435:
+.LBE440:
+	.loc 1 105 21 view .LVU105
+	vmovdqu	%ymm0, (%rsi)
+	.loc 1 109 3 is_stmt 1 view .LVU106
+.LBB441:
+	.loc 1 109 8 view .LVU107
+.LVL23:
+	.loc 1 109 21 view .LVU108
+.LBB436:
+	.loc 1 110 5 view .LVU109
+.LBB299:
+.LBI299:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h"
+	.loc 5 927 1 view .LVU110
+.LBB300:
+	.loc 5 929 3 view .LVU111
+	.loc 5 929 3 is_stmt 0 view .LVU112
+.LBE300:
+.LBE299:
+	.loc 1 111 5 is_stmt 1 view .LVU113
+.LBB304:
+.LBI287:
+	.loc 4 231 1 view .LVU114
+.LBB289:
+	.loc 4 233 3 view .LVU115
+.LBE289:
+.LBE304:
+.LBB305:
+.LBB295:
+	.loc 4 233 34 is_stmt 0 view .LVU116
+	vpbroadcastb	%eax, %ymm8
+.LBE295:
+.LBE305:
+.LBB306:
+.LBB307:
+	movl	$91, %eax
+.LBE307:
+.LBE306:
+.LBB313:
+.LBB301:
+	.loc 5 929 10 view .LVU117
+	vmovdqu	(%rdi), %ymm0
+.LBE301:
+.LBE313:
+.LBB314:
+.LBB308:
+	.loc 4 233 34 view .LVU118
+	vpbroadcastb	%eax, %ymm9
+.LBE308:
+.LBE314:
+.LBB315:
+.LBB316:
+	movl	$93, %eax
+	vpbroadcastb	%eax, %ymm5
+.LBE316:
+.LBE315:
+.LBB321:
+.LBB309:
+	vpcmpeqb	%ymm9, %ymm0, %ymm6
+.LBE309:
+.LBE321:
+.LBB322:
+.LBB317:
+	vpcmpeqb	%ymm5, %ymm0, %ymm2
+.LBE317:
+.LBE322:
+.LBB323:
+.LBB290:
+	vpcmpeqb	%ymm4, %ymm0, %ymm3
+.LVL24:
+	.loc 4 233 34 view .LVU119
+.LBE290:
+.LBE323:
+.LBB324:
+.LBI293:
+	.loc 4 231 1 is_stmt 1 view .LVU120
+.LBB296:
+	.loc 4 233 3 view .LVU121
+	.loc 4 233 34 is_stmt 0 view .LVU122
+	vpcmpeqb	%ymm8, %ymm0, %ymm1
+.LVL25:
+	.loc 4 233 34 view .LVU123
+.LBE296:
+.LBE324:
+.LBB325:
+.LBI325:
+	.loc 4 574 1 is_stmt 1 view .LVU124
+.LBB326:
+	.loc 4 576 3 view .LVU125
+	.loc 4 576 3 is_stmt 0 view .LVU126
+.LBE326:
+.LBE325:
+	.loc 1 112 5 is_stmt 1 view .LVU127
+.LBB328:
+.LBI306:
+	.loc 4 231 1 view .LVU128
+.LBB310:
+	.loc 4 233 3 view .LVU129
+	.loc 4 233 3 is_stmt 0 view .LVU130
+.LBE310:
+.LBE328:
+.LBB329:
+.LBI329:
+	.loc 4 574 1 is_stmt 1 view .LVU131
+.LBB330:
+	.loc 4 576 3 view .LVU132
+	.loc 4 576 3 is_stmt 0 view .LVU133
+.LBE330:
+.LBE329:
+	.loc 1 113 5 is_stmt 1 view .LVU134
+.LBB332:
+.LBI315:
+	.loc 4 231 1 view .LVU135
+.LBB318:
+	.loc 4 233 3 view .LVU136
+	.loc 4 233 3 is_stmt 0 view .LVU137
+.LBE318:
+.LBE332:
+.LBB333:
+.LBI333:
+	.loc 4 574 1 is_stmt 1 view .LVU138
+.LBB334:
+	.loc 4 576 3 view .LVU139
+	vpor	%ymm6, %ymm2, %ymm2
+.LVL26:
+	.loc 4 576 3 is_stmt 0 view .LVU140
+.LBE334:
+.LBE333:
+.LBB336:
+.LBB337:
+	.loc 4 233 34 view .LVU141
+	movl	$58, %eax
+	vpternlogq	$254, %ymm2, %ymm3, %ymm1
+.LVL27:
+	.loc 4 233 34 view .LVU142
+.LBE337:
+.LBE336:
+	.loc 1 114 5 is_stmt 1 view .LVU143
+.LBB342:
+.LBI336:
+	.loc 4 231 1 view .LVU144
+.LBB338:
+	.loc 4 233 3 view .LVU145
+	.loc 4 233 34 is_stmt 0 view .LVU146
+	vpbroadcastb	%eax, %ymm2
+.LBE338:
+.LBE342:
+.LBB343:
+.LBB344:
+	movl	$44, %eax
+	vpbroadcastb	%eax, %ymm7
+	vpcmpeqb	%ymm7, %ymm0, %ymm3
+.LBE344:
+.LBE343:
+.LBB348:
+.LBB339:
+	vpcmpeqb	%ymm2, %ymm0, %ymm6
+.LVL28:
+	.loc 4 233 34 view .LVU147
+.LBE339:
+.LBE348:
+.LBB349:
+.LBI349:
+	.loc 4 574 1 is_stmt 1 view .LVU148
+.LBB350:
+	.loc 4 576 3 view .LVU149
+	.loc 4 576 3 is_stmt 0 view .LVU150
+.LBE350:
+.LBE349:
+	.loc 1 115 5 is_stmt 1 view .LVU151
+.LBB352:
+.LBI343:
+	.loc 4 231 1 view .LVU152
+.LBB345:
+	.loc 4 233 3 view .LVU153
+	.loc 4 233 3 is_stmt 0 view .LVU154
+.LBE345:
+.LBE352:
+.LBB353:
+.LBI353:
+	.loc 4 574 1 is_stmt 1 view .LVU155
+.LBB354:
+	.loc 4 576 3 view .LVU156
+.LBE354:
+.LBE353:
+.LBB357:
+.LBB358:
+	.loc 4 414 19 is_stmt 0 view .LVU157
+	movl	$32, %eax
+.LBE358:
+.LBE357:
+.LBE436:
+.LBE441:
+	.loc 1 103 99 view .LVU158
+	movq	%rdi, %rcx
+.LBB442:
+.LBB437:
+.LBB362:
+.LBB355:
+	.loc 4 576 33 view .LVU159
+	vpternlogq	$254, %ymm1, %ymm3, %ymm6
+.LVL29:
+	.loc 4 576 33 view .LVU160
+.LBE355:
+.LBE362:
+	.loc 1 116 5 is_stmt 1 view .LVU161
+.LBB363:
+.LBI357:
+	.loc 4 412 1 view .LVU162
+.LBB359:
+	.loc 4 414 3 view .LVU163
+	.loc 4 414 19 is_stmt 0 view .LVU164
+	vpbroadcastb	%eax, %ymm3
+	vpminub	%ymm0, %ymm3, %ymm1
+.LVL30:
+	.loc 4 414 19 view .LVU165
+.LBE359:
+.LBE363:
+.LBB364:
+.LBI364:
+	.loc 4 231 1 is_stmt 1 view .LVU166
+.LBB365:
+	.loc 4 233 3 view .LVU167
+	.loc 4 233 34 is_stmt 0 view .LVU168
+	vpcmpeqb	%ymm0, %ymm1, %ymm1
+.LVL31:
+	.loc 4 233 34 view .LVU169
+.LBE365:
+.LBE364:
+.LBB368:
+.LBI368:
+	.loc 4 433 1 is_stmt 1 view .LVU170
+.LBB369:
+	.loc 4 435 3 view .LVU171
+.LBE369:
+.LBE368:
+.LBB372:
+.LBB373:
+	.loc 4 435 10 is_stmt 0 view .LVU172
+	vpmovmskb	%ymm6, %edi
+.LVL32:
+	.loc 4 435 10 view .LVU173
+.LBE373:
+.LBE372:
+.LBE437:
+.LBE442:
+	.loc 1 103 99 view .LVU174
+	movq	%rsi, %rdx
+.LBB443:
+.LBB438:
+.LBB377:
+.LBB370:
+	.loc 4 435 10 view .LVU175
+	vpmovmskb	%ymm1, %eax
+	vmovd	%eax, %xmm1
+.LVL33:
+	.loc 4 435 10 view .LVU176
+.LBE370:
+.LBE377:
+	.loc 1 117 5 is_stmt 1 view .LVU177
+.LBB378:
+.LBI372:
+	.loc 4 433 1 view .LVU178
+.LBB374:
+	.loc 4 435 3 view .LVU179
+	.loc 4 435 3 is_stmt 0 view .LVU180
+.LBE374:
+.LBE378:
+	.loc 1 118 5 is_stmt 1 view .LVU181
+.LBB379:
+.LBI379:
+	.loc 4 231 1 view .LVU182
+.LBB380:
+	.loc 4 233 3 view .LVU183
+	.loc 4 233 34 is_stmt 0 view .LVU184
+	movl	$34, %eax
+	vpbroadcastb	%eax, %ymm6
+.LVL34:
+	.loc 4 233 34 view .LVU185
+	vpcmpeqb	%ymm6, %ymm0, %ymm10
+.LVL35:
+	.loc 4 233 34 view .LVU186
+.LBE380:
+.LBE379:
+.LBB383:
+.LBI383:
+	.loc 4 433 1 is_stmt 1 view .LVU187
+.LBB384:
+	.loc 4 435 3 view .LVU188
+.LBE384:
+.LBE383:
+.LBB389:
+.LBB390:
+	.loc 4 233 34 is_stmt 0 view .LVU189
+	movl	$92, %eax
+.LBE390:
+.LBE389:
+	.loc 1 116 36 view .LVU190
+	vpinsrd	$1, %edi, %xmm1, %xmm1
+.LBB394:
+.LBB385:
+	.loc 4 435 10 view .LVU191
+	vpmovmskb	%ymm10, %esi
+.LVL36:
+	.loc 4 435 10 view .LVU192
+.LBE385:
+.LBE394:
+	.loc 1 119 5 is_stmt 1 view .LVU193
+.LBB395:
+.LBI389:
+	.loc 4 231 1 view .LVU194
+.LBB391:
+	.loc 4 233 3 view .LVU195
+	.loc 4 233 34 is_stmt 0 view .LVU196
+	vpbroadcastb	%eax, %ymm10
+	vpcmpeqb	%ymm10, %ymm0, %ymm0
+.LVL37:
+	.loc 4 233 34 view .LVU197
+.LBE391:
+.LBE395:
+.LBB396:
+.LBI396:
+	.loc 4 433 1 is_stmt 1 view .LVU198
+.LBB397:
+	.loc 4 435 3 view .LVU199
+	.loc 4 435 10 is_stmt 0 view .LVU200
+	vpmovmskb	%ymm0, %eax
+.LBE397:
+.LBE396:
+	.loc 1 116 36 view .LVU201
+	vmovd	%esi, %xmm0
+.LVL38:
+	.loc 1 116 36 view .LVU202
+	vpinsrd	$1, %eax, %xmm0, %xmm0
+	vpunpcklqdq	%xmm0, %xmm1, %xmm1
+	.loc 1 116 26 view .LVU203
+	vpmovzxdq	%xmm1, %ymm1
+.LVL39:
+	.loc 1 116 23 view .LVU204
+	vmovdqu	%ymm1, (%rdx)
+.LVL40:
+	.loc 1 116 23 view .LVU205
+.LBE438:
+	.loc 1 109 29 is_stmt 1 view .LVU206
+	.loc 1 109 21 view .LVU207
+.LBB439:
+	.loc 1 110 5 view .LVU208
+.LBB400:
+	.loc 5 927 1 view .LVU209
+.LBB302:
+	.loc 5 929 3 view .LVU210
+	.loc 5 929 3 is_stmt 0 view .LVU211
+.LBE302:
+.LBE400:
+	.loc 1 111 5 is_stmt 1 view .LVU212
+.LBB401:
+	.loc 4 231 1 view .LVU213
+.LBB291:
+	.loc 4 233 3 view .LVU214
+.LBE291:
+.LBE401:
+.LBB402:
+.LBB303:
+	.loc 5 929 10 is_stmt 0 view .LVU215
+	vmovdqu	32(%rcx), %ymm0
+.LBE303:
+.LBE402:
+.LBB403:
+.LBB311:
+	.loc 4 233 34 view .LVU216
+	vpcmpeqb	%ymm9, %ymm0, %ymm9
+.LBE311:
+.LBE403:
+.LBB404:
+.LBB319:
+	vpcmpeqb	%ymm5, %ymm0, %ymm5
+.LBE319:
+.LBE404:
+.LBB405:
+.LBB297:
+	vpcmpeqb	%ymm8, %ymm0, %ymm8
+.LBE297:
+.LBE405:
+.LBB406:
+.LBB292:
+	vpcmpeqb	%ymm4, %ymm0, %ymm4
+.LVL41:
+	.loc 4 233 34 view .LVU217
+.LBE292:
+.LBE406:
+.LBB407:
+	.loc 4 231 1 is_stmt 1 view .LVU218
+.LBB298:
+	.loc 4 233 3 view .LVU219
+	.loc 4 233 3 is_stmt 0 view .LVU220
+.LBE298:
+.LBE407:
+.LBB408:
+	.loc 4 574 1 is_stmt 1 view .LVU221
+.LBB327:
+	.loc 4 576 3 view .LVU222
+	.loc 4 576 3 is_stmt 0 view .LVU223
+.LBE327:
+.LBE408:
+	.loc 1 112 5 is_stmt 1 view .LVU224
+.LBB409:
+	.loc 4 231 1 view .LVU225
+.LBB312:
+	.loc 4 233 3 view .LVU226
+	.loc 4 233 3 is_stmt 0 view .LVU227
+.LBE312:
+.LBE409:
+.LBB410:
+	.loc 4 574 1 is_stmt 1 view .LVU228
+.LBB331:
+	.loc 4 576 3 view .LVU229
+	.loc 4 576 3 is_stmt 0 view .LVU230
+.LBE331:
+.LBE410:
+	.loc 1 113 5 is_stmt 1 view .LVU231
+.LBB411:
+	.loc 4 231 1 view .LVU232
+.LBB320:
+	.loc 4 233 3 view .LVU233
+	.loc 4 233 3 is_stmt 0 view .LVU234
+.LBE320:
+.LBE411:
+.LBB412:
+	.loc 4 574 1 is_stmt 1 view .LVU235
+.LBB335:
+	.loc 4 576 3 view .LVU236
+.LBE335:
+.LBE412:
+.LBB413:
+.LBB360:
+	.loc 4 414 19 is_stmt 0 view .LVU237
+	vpminub	%ymm0, %ymm3, %ymm3
+.LBE360:
+.LBE413:
+.LBB414:
+.LBB346:
+	.loc 4 233 34 view .LVU238
+	vpcmpeqb	%ymm7, %ymm0, %ymm7
+.LBE346:
+.LBE414:
+.LBB415:
+.LBB366:
+	vpcmpeqb	%ymm0, %ymm3, %ymm3
+.LBE366:
+.LBE415:
+.LBB416:
+.LBB381:
+	vpcmpeqb	%ymm6, %ymm0, %ymm6
+.LBE381:
+.LBE416:
+.LBB417:
+.LBB340:
+	vpcmpeqb	%ymm2, %ymm0, %ymm2
+	vpor	%ymm9, %ymm5, %ymm5
+.LVL42:
+	.loc 4 233 34 view .LVU239
+.LBE340:
+.LBE417:
+.LBB418:
+.LBB392:
+	vpcmpeqb	%ymm10, %ymm0, %ymm0
+	vpternlogq	$254, %ymm5, %ymm8, %ymm4
+.LVL43:
+	.loc 4 233 34 view .LVU240
+.LBE392:
+.LBE418:
+	.loc 1 114 5 is_stmt 1 view .LVU241
+.LBB419:
+	.loc 4 231 1 view .LVU242
+.LBB341:
+	.loc 4 233 3 view .LVU243
+	.loc 4 233 3 is_stmt 0 view .LVU244
+.LBE341:
+.LBE419:
+.LBB420:
+	.loc 4 574 1 is_stmt 1 view .LVU245
+.LBB351:
+	.loc 4 576 3 view .LVU246
+	.loc 4 576 3 is_stmt 0 view .LVU247
+.LBE351:
+.LBE420:
+	.loc 1 115 5 is_stmt 1 view .LVU248
+.LBB421:
+	.loc 4 231 1 view .LVU249
+.LBB347:
+	.loc 4 233 3 view .LVU250
+	.loc 4 233 3 is_stmt 0 view .LVU251
+.LBE347:
+.LBE421:
+.LBB422:
+	.loc 4 574 1 is_stmt 1 view .LVU252
+.LBB356:
+	.loc 4 576 3 view .LVU253
+	.loc 4 576 33 is_stmt 0 view .LVU254
+	vpternlogq	$254, %ymm4, %ymm7, %ymm2
+.LVL44:
+	.loc 4 576 33 view .LVU255
+.LBE356:
+.LBE422:
+	.loc 1 116 5 is_stmt 1 view .LVU256
+.LBB423:
+	.loc 4 412 1 view .LVU257
+.LBB361:
+	.loc 4 414 3 view .LVU258
+	.loc 4 414 3 is_stmt 0 view .LVU259
+.LBE361:
+.LBE423:
+.LBB424:
+	.loc 4 231 1 is_stmt 1 view .LVU260
+.LBB367:
+	.loc 4 233 3 view .LVU261
+	.loc 4 233 3 is_stmt 0 view .LVU262
+.LBE367:
+.LBE424:
+.LBB425:
+	.loc 4 433 1 is_stmt 1 view .LVU263
+.LBB371:
+	.loc 4 435 3 view .LVU264
+	.loc 4 435 10 is_stmt 0 view .LVU265
+	vpmovmskb	%ymm3, %eax
+.LVL45:
+	.loc 4 435 10 view .LVU266
+.LBE371:
+.LBE425:
+	.loc 1 117 5 is_stmt 1 view .LVU267
+.LBB426:
+	.loc 4 433 1 view .LVU268
+.LBB375:
+	.loc 4 435 3 view .LVU269
+.LBE375:
+.LBE426:
+.LBB427:
+.LBB386:
+	.loc 4 435 10 is_stmt 0 view .LVU270
+	vpmovmskb	%ymm6, %edi
+.LBE386:
+.LBE427:
+.LBB428:
+.LBB376:
+	vpmovmskb	%ymm2, %ecx
+.LVL46:
+	.loc 4 435 10 view .LVU271
+.LBE376:
+.LBE428:
+	.loc 1 118 5 is_stmt 1 view .LVU272
+.LBB429:
+	.loc 4 231 1 view .LVU273
+.LBB382:
+	.loc 4 233 3 view .LVU274
+	.loc 4 233 3 is_stmt 0 view .LVU275
+.LBE382:
+.LBE429:
+.LBB430:
+	.loc 4 433 1 is_stmt 1 view .LVU276
+.LBB387:
+	.loc 4 435 3 view .LVU277
+.LBE387:
+.LBE430:
+.LBB431:
+.LBB398:
+	.loc 4 435 10 is_stmt 0 view .LVU278
+	vpmovmskb	%ymm0, %esi
+.LBE398:
+.LBE431:
+.LBB432:
+.LBB388:
+	vmovd	%edi, %xmm2
+.LVL47:
+	.loc 4 435 10 view .LVU279
+.LBE388:
+.LBE432:
+	.loc 1 119 5 is_stmt 1 view .LVU280
+.LBB433:
+	.loc 4 231 1 view .LVU281
+.LBB393:
+	.loc 4 233 3 view .LVU282
+	.loc 4 233 3 is_stmt 0 view .LVU283
+.LBE393:
+.LBE433:
+.LBB434:
+	.loc 4 433 1 is_stmt 1 view .LVU284
+.LBB399:
+	.loc 4 435 3 view .LVU285
+	.loc 4 435 3 is_stmt 0 view .LVU286
+.LBE399:
+.LBE434:
+	.loc 1 116 36 view .LVU287
+	vmovd	%eax, %xmm7
+	vpinsrd	$1, %esi, %xmm2, %xmm2
+	vpinsrd	$1, %ecx, %xmm7, %xmm0
+	vpunpcklqdq	%xmm2, %xmm0, %xmm0
+	.loc 1 116 26 view .LVU288
+	vpmovzxdq	%xmm0, %ymm0
+	.loc 1 116 128 view .LVU289
+	vpsllq	$32, %ymm0, %ymm0
+	.loc 1 116 23 view .LVU290
+	vpor	%ymm1, %ymm0, %ymm0
+	vmovdqu	%ymm0, (%rdx)
+.LVL48:
+	.loc 1 116 23 view .LVU291
+.LBE439:
+	.loc 1 109 29 is_stmt 1 view .LVU292
+	.loc 1 109 21 view .LVU293
+	vzeroupper
+.LVL49:
+.LBE443:
+	.loc 1 121 1 is_stmt 0 view .LVU294
+	ret
+	.cfi_endproc
+.LFE6409:
+	.size	structural_index_classify_avx2, .-structural_index_classify_avx2
+	.p2align 4
+	.type	structural_index_classify_sse2, @function
+structural_index_classify_sse2:
+.LVL50:
+.LFB6408:
+	.loc 1 78 99 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 79 3 view .LVU296
+	.loc 1 80 3 view .LVU297
+	.loc 1 81 3 view .LVU298
+	.loc 1 82 3 view .LVU299
+	.loc 1 83 3 view .LVU300
+.LBB444:
+.LBB445:
+.LBB446:
+.LBB447:
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h"
+	.loc 6 1335 34 is_stmt 0 view .LVU301
+	movl	$125, %ecx
+	vpbroadcastb	%ecx, %xmm4
+.LBE447:
+.LBE446:
+.LBE445:
+.LBE444:
+	.loc 1 80 21 view .LVU302
+	vpxor	%xmm0, %xmm0, %xmm0
+.LBB723:
+.LBB716:
+.LBB456:
+.LBB457:
+	.loc 6 1335 34 view .LVU303
+	movl	$123, %ecx
+.LBE457:
+.LBE456:
+.LBE716:
+.LBE723:
+	.loc 1 80 21 view .LVU304
+	vmovdqu	%ymm0, (%rsi)
+	.loc 1 84 3 is_stmt 1 view .LVU305
+.LBB724:
+	.loc 1 84 8 view .LVU306
+.LVL51:
+	.loc 1 84 21 view .LVU307
+.LBB717:
+	.loc 1 85 5 view .LVU308
+.LBB465:
+.LBI465:
+	.loc 6 701 1 view .LVU309
+.LBB466:
+	.loc 6 703 3 view .LVU310
+	.loc 6 703 3 is_stmt 0 view .LVU311
+.LBE466:
+.LBE465:
+	.loc 1 86 5 is_stmt 1 view .LVU312
+.LBB474:
+.LBI446:
+	.loc 6 1333 1 view .LVU313
+.LBB448:
+	.loc 6 1335 3 view .LVU314
+.LBE448:
+.LBE474:
+.LBB475:
+.LBB458:
+	.loc 6 1335 34 is_stmt 0 view .LVU315
+	vpbroadcastb	%ecx, %xmm10
+.LBE458:
+.LBE475:
+.LBB476:
+.LBB477:
+	movl	$91, %ecx
+.LBE477:
+.LBE476:
+.LBB487:
+.LBB467:
+	.loc 6 703 10 view .LVU316
+	vmovdqu	(%rdi), %xmm0
+.LBE467:
+.LBE487:
+.LBB488:
+.LBB478:
+	.loc 6 1335 34 view .LVU317
+	vpbroadcastb	%ecx, %xmm11
+.LBE478:
+.LBE488:
+.LBB489:
+.LBB490:
+	movl	$93, %ecx
+	vpbroadcastb	%ecx, %xmm6
+.LBE490:
+.LBE489:
+.LBB499:
+.LBB479:
+	vpcmpeqb	%xmm11, %xmm0, %xmm5
+.LBE479:
+.LBE499:
+.LBB500:
+.LBB491:
+	vpcmpeqb	%xmm6, %xmm0, %xmm1
+.LBE491:
+.LBE500:
+.LBB501:
+.LBB449:
+	vpcmpeqb	%xmm4, %xmm0, %xmm3
+.LVL52:
+	.loc 6 1335 34 view .LVU318
+.LBE449:
+.LBE501:
+.LBB502:
+.LBI456:
+	.loc 6 1333 1 is_stmt 1 view .LVU319
+.LBB459:
+	.loc 6 1335 3 view .LVU320
+	.loc 6 1335 34 is_stmt 0 view .LVU321
+	vpcmpeqb	%xmm10, %xmm0, %xmm2
+.LVL53:
+	.loc 6 1335 34 view .LVU322
+.LBE459:
+.LBE502:
+.LBB503:
+.LBI503:
+	.loc 6 1321 1 is_stmt 1 view .LVU323
+.LBB504:
+	.loc 6 1323 3 view .LVU324
+	.loc 6 1323 3 is_stmt 0 view .LVU325
+.LBE504:
+.LBE503:
+	.loc 1 87 5 is_stmt 1 view .LVU326
+.LBB508:
+.LBI476:
+	.loc 6 1333 1 view .LVU327
+.LBB480:
+	.loc 6 1335 3 view .LVU328
+	.loc 6 1335 3 is_stmt 0 view .LVU329
+.LBE480:
+.LBE508:
+.LBB509:
+.LBI509:
+	.loc 6 1321 1 is_stmt 1 view .LVU330
+.LBB510:
+	.loc 6 1323 3 view .LVU331
+	.loc 6 1323 3 is_stmt 0 view .LVU332
+.LBE510:
+.LBE509:
+	.loc 1 88 5 is_stmt 1 view .LVU333
+.LBB514:
+.LBI489:
+	.loc 6 1333 1 view .LVU334
+.LBB492:
+	.loc 6 1335 3 view .LVU335
+	.loc 6 1335 3 is_stmt 0 view .LVU336
+.LBE492:
+.LBE514:
+.LBB515:
+.LBI515:
+	.loc 6 1321 1 is_stmt 1 view .LVU337
+.LBB516:
+	.loc 6 1323 3 view .LVU338
+	vpor	%xmm5, %xmm1, %xmm1
+.LVL54:
+	.loc 6 1323 3 is_stmt 0 view .LVU339
+.LBE516:
+.LBE515:
+.LBB520:
+.LBB521:
+	.loc 6 1335 34 view .LVU340
+	movl	$58, %ecx
+	vpternlogq	$254, %xmm1, %xmm3, %xmm2
+.LVL55:
+	.loc 6 1335 34 view .LVU341
+.LBE521:
+.LBE520:
+	.loc 1 89 5 is_stmt 1 view .LVU342
+.LBB528:
+.LBI520:
+	.loc 6 1333 1 view .LVU343
+.LBB522:
+	.loc 6 1335 3 view .LVU344
+	.loc 6 1335 34 is_stmt 0 view .LVU345
+	vpbroadcastb	%ecx, %xmm3
+.LBE522:
+.LBE528:
+.LBB529:
+.LBB530:
+	movl	$44, %ecx
+	vpbroadcastb	%ecx, %xmm9
+	vpcmpeqb	%xmm9, %xmm0, %xmm5
+.LBE530:
+.LBE529:
+.LBB536:
+.LBB523:
+	vpcmpeqb	%xmm3, %xmm0, %xmm1
+.LVL56:
+	.loc 6 1335 34 view .LVU346
+.LBE523:
+.LBE536:
+.LBB537:
+.LBI537:
+	.loc 6 1321 1 is_stmt 1 view .LVU347
+.LBB538:
+	.loc 6 1323 3 view .LVU348
+	.loc 6 1323 3 is_stmt 0 view .LVU349
+.LBE538:
+.LBE537:
+	.loc 1 90 5 is_stmt 1 view .LVU350
+.LBB542:
+.LBI529:
+	.loc 6 1333 1 view .LVU351
+.LBB531:
+	.loc 6 1335 3 view .LVU352
+	.loc 6 1335 3 is_stmt 0 view .LVU353
+.LBE531:
+.LBE542:
+.LBB543:
+.LBI543:
+	.loc 6 1321 1 is_stmt 1 view .LVU354
+.LBB544:
+	.loc 6 1323 3 view .LVU355
+.LBE544:
+.LBE543:
+.LBB550:
+.LBB551:
+	.loc 6 1427 19 is_stmt 0 view .LVU356
+	movl	$32, %ecx
+.LBE551:
+.LBE550:
+.LBE717:
+.LBE724:
+	.loc 1 78 99 view .LVU357
+	movq	%rsi, %rdx
+.LBB725:
+.LBB718:
+.LBB557:
+.LBB545:
+	.loc 6 1323 33 view .LVU358
+	vpternlogq	$254, %xmm2, %xmm5, %xmm1
+.LVL57:
+	.loc 6 1323 33 view .LVU359
+.LBE545:
+.LBE557:
+	.loc 1 92 5 is_stmt 1 view .LVU360
+.LBB558:
+.LBI550:
+	.loc 6 1425 1 view .LVU361
+.LBB552:
+	.loc 6 1427 3 view .LVU362
+	.loc 6 1427 19 is_stmt 0 view .LVU363
+	vpbroadcastb	%ecx, %xmm5
+	vpminub	%xmm0, %xmm5, %xmm2
+.LVL58:
+	.loc 6 1427 19 view .LVU364
+.LBE552:
+.LBE558:
+.LBB559:
+.LBI559:
+	.loc 6 1333 1 is_stmt 1 view .LVU365
+.LBB560:
+	.loc 6 1335 3 view .LVU366
+	.loc 6 1335 34 is_stmt 0 view .LVU367
+	vpcmpeqb	%xmm0, %xmm2, %xmm2
+.LVL59:
+	.loc 6 1335 34 view .LVU368
+.LBE560:
+.LBE559:
+.LBB565:
+.LBI565:
+	.loc 6 1431 1 is_stmt 1 view .LVU369
+.LBB566:
+	.loc 6 1433 3 view .LVU370
+.LBE566:
+.LBE565:
+.LBB574:
+.LBB575:
+	.loc 6 1335 34 is_stmt 0 view .LVU371
+	movl	$34, %ecx
+.LBE575:
+.LBE574:
+.LBE718:
+.LBE725:
+	.loc 1 78 99 view .LVU372
+	movq	%rdi, %rax
+.LBB726:
+.LBB719:
+.LBB583:
+.LBB576:
+	.loc 6 1335 34 view .LVU373
+	vpbroadcastb	%ecx, %xmm7
+.LBE576:
+.LBE583:
+.LBB584:
+.LBB567:
+	.loc 6 1433 10 view .LVU374
+	vpmovmskb	%xmm2, %esi
+.LVL60:
+	.loc 6 1433 10 view .LVU375
+.LBE567:
+.LBE584:
+.LBB585:
+.LBB586:
+	.loc 6 1335 34 view .LVU376
+	movl	$92, %edi
+.LVL61:
+	.loc 6 1335 34 view .LVU377
+	vpbroadcastb	%edi, %xmm8
+.LBE586:
+.LBE585:
+.LBB595:
+.LBB568:
+	.loc 6 1433 10 view .LVU378
+	vmovd	%esi, %xmm2
+.LVL62:
+	.loc 6 1433 10 view .LVU379
+.LBE568:
+.LBE595:
+	.loc 1 93 5 is_stmt 1 view .LVU380
+.LBB596:
+.LBI596:
+	.loc 6 1431 1 view .LVU381
+.LBB597:
+	.loc 6 1433 3 view .LVU382
+	.loc 6 1433 10 is_stmt 0 view .LVU383
+	vpmovmskb	%xmm1, %esi
+.LVL63:
+	.loc 6 1433 10 view .LVU384
+.LBE597:
+.LBE596:
+	.loc 1 94 5 is_stmt 1 view .LVU385
+.LBB603:
+.LBI574:
+	.loc 6 1333 1 view .LVU386
+.LBB577:
+	.loc 6 1335 3 view .LVU387
+	.loc 6 1335 34 is_stmt 0 view .LVU388
+	vpcmpeqb	%xmm7, %xmm0, %xmm1
+.LVL64:
+	.loc 6 1335 34 view .LVU389
+.LBE577:
+.LBE603:
+.LBB604:
+.LBI604:
+	.loc 6 1431 1 is_stmt 1 view .LVU390
+.LBB605:
+	.loc 6 1433 3 view .LVU391
+.LBE605:
+.LBE604:
+.LBB613:
+.LBB587:
+	.loc 6 1335 34 is_stmt 0 view .LVU392
+	vpcmpeqb	%xmm8, %xmm0, %xmm0
+.LVL65:
+	.loc 6 1335 34 view .LVU393
+.LBE587:
+.LBE613:
+	.loc 1 92 36 view .LVU394
+	vpinsrd	$1, %esi, %xmm2, %xmm2
+.LBB614:
+.LBB606:
+	.loc 6 1433 10 view .LVU395
+	vpmovmskb	%xmm1, %ecx
+.LVL66:
+	.loc 6 1433 10 view .LVU396
+.LBE606:
+.LBE614:
+	.loc 1 95 5 is_stmt 1 view .LVU397
+.LBB615:
+.LBI585:
+	.loc 6 1333 1 view .LVU398
+.LBB588:
+	.loc 6 1335 3 view .LVU399
+	.loc 6 1335 3 is_stmt 0 view .LVU400
+.LBE588:
+.LBE615:
+.LBB616:
+.LBI616:
+	.loc 6 1431 1 is_stmt 1 view .LVU401
+.LBB617:
+	.loc 6 1433 3 view .LVU402
+.LBE617:
+.LBE616:
+	.loc 1 92 36 is_stmt 0 view .LVU403
+	vmovd	%ecx, %xmm1
+.LBB623:
+.LBB618:
+	.loc 6 1433 10 view .LVU404
+	vpmovmskb	%xmm0, %edi
+.LBE618:
+.LBE623:
+	.loc 1 92 36 view .LVU405
+	vpinsrd	$1, %edi, %xmm1, %xmm0
+.LVL67:
+	.loc 1 92 36 view .LVU406
+	vpunpcklqdq	%xmm0, %xmm2, %xmm2
+	.loc 1 92 26 view .LVU407
+	vpmovzxdq	%xmm2, %ymm2
+.LVL68:
+	.loc 1 92 23 view .LVU408
+	vmovdqu	%ymm2, (%rdx)
+.LVL69:
+	.loc 1 92 23 view .LVU409
+.LBE719:
+	.loc 1 84 29 is_stmt 1 view .LVU410
+	.loc 1 84 21 view .LVU411
+.LBB720:
+	.loc 1 85 5 view .LVU412
+.LBB624:
+	.loc 6 701 1 view .LVU413
+.LBB468:
+	.loc 6 703 3 view .LVU414
+	.loc 6 703 3 is_stmt 0 view .LVU415
+.LBE468:
+.LBE624:
+	.loc 1 86 5 is_stmt 1 view .LVU416
+.LBB625:
+	.loc 6 1333 1 view .LVU417
+.LBB450:
+	.loc 6 1335 3 view .LVU418
+.LBE450:
+.LBE625:
+.LBB626:
+.LBB469:
+	.loc 6 703 10 is_stmt 0 view .LVU419
+	vmovdqu	16(%rax), %xmm0
+.LBE469:
+.LBE626:
+.LBB627:
+.LBB481:
+	.loc 6 1335 34 view .LVU420
+	vpcmpeqb	%xmm11, %xmm0, %xmm14
+.LBE481:
+.LBE627:
+.LBB628:
+.LBB493:
+	vpcmpeqb	%xmm6, %xmm0, %xmm12
+.LBE493:
+.LBE628:
+.LBB629:
+.LBB451:
+	vpcmpeqb	%xmm4, %xmm0, %xmm13
+.LVL70:
+	.loc 6 1335 34 view .LVU421
+.LBE451:
+.LBE629:
+.LBB630:
+	.loc 6 1333 1 is_stmt 1 view .LVU422
+.LBB460:
+	.loc 6 1335 3 view .LVU423
+	.loc 6 1335 34 is_stmt 0 view .LVU424
+	vpcmpeqb	%xmm10, %xmm0, %xmm1
+.LVL71:
+	.loc 6 1335 34 view .LVU425
+.LBE460:
+.LBE630:
+.LBB631:
+	.loc 6 1321 1 is_stmt 1 view .LVU426
+.LBB505:
+	.loc 6 1323 3 view .LVU427
+	.loc 6 1323 3 is_stmt 0 view .LVU428
+.LBE505:
+.LBE631:
+	.loc 1 87 5 is_stmt 1 view .LVU429
+.LBB632:
+	.loc 6 1333 1 view .LVU430
+.LBB482:
+	.loc 6 1335 3 view .LVU431
+	.loc 6 1335 3 is_stmt 0 view .LVU432
+.LBE482:
+.LBE632:
+.LBB633:
+	.loc 6 1321 1 is_stmt 1 view .LVU433
+.LBB511:
+	.loc 6 1323 3 view .LVU434
+	.loc 6 1323 3 is_stmt 0 view .LVU435
+.LBE511:
+.LBE633:
+	.loc 1 88 5 is_stmt 1 view .LVU436
+.LBB634:
+	.loc 6 1333 1 view .LVU437
+.LBB494:
+	.loc 6 1335 3 view .LVU438
+	.loc 6 1335 3 is_stmt 0 view .LVU439
+.LBE494:
+.LBE634:
+.LBB635:
+	.loc 6 1321 1 is_stmt 1 view .LVU440
+.LBB517:
+	.loc 6 1323 3 view .LVU441
+	vpor	%xmm14, %xmm12, %xmm12
+.LVL72:
+	.loc 6 1323 3 is_stmt 0 view .LVU442
+	vpternlogq	$254, %xmm12, %xmm13, %xmm1
+.LVL73:
+	.loc 6 1323 3 view .LVU443
+.LBE517:
+.LBE635:
+	.loc 1 89 5 is_stmt 1 view .LVU444
+.LBB636:
+	.loc 6 1333 1 view .LVU445
+.LBB524:
+	.loc 6 1335 3 view .LVU446
+	.loc 6 1335 34 is_stmt 0 view .LVU447
+	vpcmpeqb	%xmm3, %xmm0, %xmm13
+.LVL74:
+	.loc 6 1335 34 view .LVU448
+.LBE524:
+.LBE636:
+.LBB637:
+	.loc 6 1321 1 is_stmt 1 view .LVU449
+.LBB539:
+	.loc 6 1323 3 view .LVU450
+	.loc 6 1323 3 is_stmt 0 view .LVU451
+.LBE539:
+.LBE637:
+	.loc 1 90 5 is_stmt 1 view .LVU452
+.LBB638:
+	.loc 6 1333 1 view .LVU453
+.LBB532:
+	.loc 6 1335 3 view .LVU454
+	.loc 6 1335 34 is_stmt 0 view .LVU455
+	vpcmpeqb	%xmm9, %xmm0, %xmm12
+.LVL75:
+	.loc 6 1335 34 view .LVU456
+.LBE532:
+.LBE638:
+.LBB639:
+	.loc 6 1321 1 is_stmt 1 view .LVU457
+.LBB546:
+	.loc 6 1323 3 view .LVU458
+	.loc 6 1323 33 is_stmt 0 view .LVU459
+	vpternlogq	$254, %xmm1, %xmm13, %xmm12
+.LVL76:
+	.loc 6 1323 33 view .LVU460
+.LBE546:
+.LBE639:
+	.loc 1 92 5 is_stmt 1 view .LVU461
+.LBB640:
+	.loc 6 1425 1 view .LVU462
+.LBB553:
+	.loc 6 1427 3 view .LVU463
+	.loc 6 1427 19 is_stmt 0 view .LVU464
+	vpminub	%xmm0, %xmm5, %xmm1
+.LVL77:
+	.loc 6 1427 19 view .LVU465
+.LBE553:
+.LBE640:
+.LBB641:
+	.loc 6 1333 1 is_stmt 1 view .LVU466
+.LBB561:
+	.loc 6 1335 3 view .LVU467
+	.loc 6 1335 34 is_stmt 0 view .LVU468
+	vpcmpeqb	%xmm1, %xmm0, %xmm1
+.LVL78:
+	.loc 6 1335 34 view .LVU469
+.LBE561:
+.LBE641:
+.LBB642:
+	.loc 6 1431 1 is_stmt 1 view .LVU470
+.LBB569:
+	.loc 6 1433 3 view .LVU471
+.LBE569:
+.LBE642:
+.LBB643:
+.LBB598:
+	.loc 6 1433 10 is_stmt 0 view .LVU472
+	vpmovmskb	%xmm12, %esi
+.LBE598:
+.LBE643:
+.LBB644:
+.LBB578:
+	.loc 6 1335 34 view .LVU473
+	vpcmpeqb	%xmm7, %xmm0, %xmm12
+.LVL79:
+	.loc 6 1335 34 view .LVU474
+.LBE578:
+.LBE644:
+.LBB645:
+.LBB589:
+	vpcmpeqb	%xmm8, %xmm0, %xmm0
+.LBE589:
+.LBE645:
+.LBB646:
+.LBB570:
+	.loc 6 1433 10 view .LVU475
+	vpmovmskb	%xmm1, %edi
+.LBE570:
+.LBE646:
+.LBB647:
+.LBB607:
+	vpmovmskb	%xmm12, %ecx
+.LBE607:
+.LBE647:
+.LBB648:
+.LBB571:
+	vmovd	%edi, %xmm1
+.LVL80:
+	.loc 6 1433 10 view .LVU476
+.LBE571:
+.LBE648:
+	.loc 1 93 5 is_stmt 1 view .LVU477
+.LBB649:
+	.loc 6 1431 1 view .LVU478
+.LBB599:
+	.loc 6 1433 3 view .LVU479
+	.loc 6 1433 3 is_stmt 0 view .LVU480
+.LBE599:
+.LBE649:
+	.loc 1 94 5 is_stmt 1 view .LVU481
+.LBB650:
+	.loc 6 1333 1 view .LVU482
+.LBB579:
+	.loc 6 1335 3 view .LVU483
+	.loc 6 1335 3 is_stmt 0 view .LVU484
+.LBE579:
+.LBE650:
+.LBB651:
+	.loc 6 1431 1 is_stmt 1 view .LVU485
+.LBB608:
+	.loc 6 1433 3 view .LVU486
+	.loc 6 1433 3 is_stmt 0 view .LVU487
+.LBE608:
+.LBE651:
+	.loc 1 95 5 is_stmt 1 view .LVU488
+.LBB652:
+	.loc 6 1333 1 view .LVU489
+.LBB590:
+	.loc 6 1335 3 view .LVU490
+	.loc 6 1335 3 is_stmt 0 view .LVU491
+.LBE590:
+.LBE652:
+.LBB653:
+	.loc 6 1431 1 is_stmt 1 view .LVU492
+.LBB619:
+	.loc 6 1433 3 view .LVU493
+	.loc 6 1433 10 is_stmt 0 view .LVU494
+	vpmovmskb	%xmm0, %edi
+.LBE619:
+.LBE653:
+	.loc 1 92 36 view .LVU495
+	vmovd	%ecx, %xmm0
+.LVL81:
+	.loc 1 92 36 view .LVU496
+	vpinsrd	$1, %edi, %xmm0, %xmm0
+	vpinsrd	$1, %esi, %xmm1, %xmm1
+	vpunpcklqdq	%xmm0, %xmm1, %xmm1
+	.loc 1 92 26 view .LVU497
+	vpmovzxdq	%xmm1, %ymm1
+	.loc 1 92 119 view .LVU498
+	vpsllq	$16, %ymm1, %ymm1
+	.loc 1 92 23 view .LVU499
+	vpor	%ymm2, %ymm1, %ymm1
+.LVL82:
+	.loc 1 92 23 view .LVU500
+	vmovdqu	%ymm1, (%rdx)
+.LVL83:
+	.loc 1 92 23 view .LVU501
+.LBE720:
+	.loc 1 84 29 is_stmt 1 view .LVU502
+	.loc 1 84 21 view .LVU503
+.LBB721:
+	.loc 1 85 5 view .LVU504
+.LBB654:
+	.loc 6 701 1 view .LVU505
+.LBB470:
+	.loc 6 703 3 view .LVU506
+	.loc 6 703 3 is_stmt 0 view .LVU507
+.LBE470:
+.LBE654:
+	.loc 1 86 5 is_stmt 1 view .LVU508
+.LBB655:
+	.loc 6 1333 1 view .LVU509
+.LBB452:
+	.loc 6 1335 3 view .LVU510
+.LBE452:
+.LBE655:
+.LBB656:
+.LBB471:
+	.loc 6 703 10 is_stmt 0 view .LVU511
+	vmovdqu	32(%rax), %xmm2
+.LBE471:
+.LBE656:
+.LBB657:
+.LBB495:
+	.loc 6 1335 34 view .LVU512
+	vpcmpeqb	%xmm6, %xmm2, %xmm14
+.LBE495:
+.LBE657:
+.LBB658:
+.LBB483:
+	vpcmpeqb	%xmm11, %xmm2, %xmm12
+.LBE483:
+.LBE658:
+.LBB659:
+.LBB461:
+	vpcmpeqb	%xmm10, %xmm2, %xmm13
+.LBE461:
+.LBE659:
+.LBB660:
+.LBB453:
+	vpcmpeqb	%xmm4, %xmm2, %xmm0
+.LVL84:
+	.loc 6 1335 34 view .LVU513
+.LBE453:
+.LBE660:
+.LBB661:
+	.loc 6 1333 1 is_stmt 1 view .LVU514
+.LBB462:
+	.loc 6 1335 3 view .LVU515
+	.loc 6 1335 3 is_stmt 0 view .LVU516
+.LBE462:
+.LBE661:
+.LBB662:
+	.loc 6 1321 1 is_stmt 1 view .LVU517
+.LBB506:
+	.loc 6 1323 3 view .LVU518
+	.loc 6 1323 3 is_stmt 0 view .LVU519
+.LBE506:
+.LBE662:
+	.loc 1 87 5 is_stmt 1 view .LVU520
+.LBB663:
+	.loc 6 1333 1 view .LVU521
+.LBB484:
+	.loc 6 1335 3 view .LVU522
+	.loc 6 1335 3 is_stmt 0 view .LVU523
+.LBE484:
+.LBE663:
+.LBB664:
+	.loc 6 1321 1 is_stmt 1 view .LVU524
+.LBB512:
+	.loc 6 1323 3 view .LVU525
+	.loc 6 1323 3 is_stmt 0 view .LVU526
+.LBE512:
+.LBE664:
+	.loc 1 88 5 is_stmt 1 view .LVU527
+.LBB665:
+	.loc 6 1333 1 view .LVU528
+.LBB496:
+	.loc 6 1335 3 view .LVU529
+	.loc 6 1335 3 is_stmt 0 view .LVU530
+.LBE496:
+.LBE665:
+.LBB666:
+	.loc 6 1321 1 is_stmt 1 view .LVU531
+.LBB518:
+	.loc 6 1323 3 view .LVU532
+	vpor	%xmm14, %xmm12, %xmm12
+.LVL85:
+	.loc 6 1323 3 is_stmt 0 view .LVU533
+	vpternlogq	$254, %xmm12, %xmm13, %xmm0
+.LVL86:
+	.loc 6 1323 3 view .LVU534
+.LBE518:
+.LBE666:
+	.loc 1 89 5 is_stmt 1 view .LVU535
+.LBB667:
+	.loc 6 1333 1 view .LVU536
+.LBB525:
+	.loc 6 1335 3 view .LVU537
+	.loc 6 1335 34 is_stmt 0 view .LVU538
+	vpcmpeqb	%xmm3, %xmm2, %xmm13
+.LVL87:
+	.loc 6 1335 34 view .LVU539
+.LBE525:
+.LBE667:
+.LBB668:
+	.loc 6 1321 1 is_stmt 1 view .LVU540
+.LBB540:
+	.loc 6 1323 3 view .LVU541
+	.loc 6 1323 3 is_stmt 0 view .LVU542
+.LBE540:
+.LBE668:
+	.loc 1 90 5 is_stmt 1 view .LVU543
+.LBB669:
+	.loc 6 1333 1 view .LVU544
+.LBB533:
+	.loc 6 1335 3 view .LVU545
+	.loc 6 1335 34 is_stmt 0 view .LVU546
+	vpcmpeqb	%xmm9, %xmm2, %xmm12
+.LVL88:
+	.loc 6 1335 34 view .LVU547
+.LBE533:
+.LBE669:
+.LBB670:
+	.loc 6 1321 1 is_stmt 1 view .LVU548
+.LBB547:
+	.loc 6 1323 3 view .LVU549
+	.loc 6 1323 33 is_stmt 0 view .LVU550
+	vpternlogq	$254, %xmm0, %xmm13, %xmm12
+.LVL89:
+	.loc 6 1323 33 view .LVU551
+.LBE547:
+.LBE670:
+	.loc 1 92 5 is_stmt 1 view .LVU552
+.LBB671:
+	.loc 6 1425 1 view .LVU553
+.LBB554:
+	.loc 6 1427 3 view .LVU554
+	.loc 6 1427 19 is_stmt 0 view .LVU555
+	vpminub	%xmm2, %xmm5, %xmm0
+.LVL90:
+	.loc 6 1427 19 view .LVU556
+.LBE554:
+.LBE671:
+.LBB672:
+	.loc 6 1333 1 is_stmt 1 view .LVU557
+.LBB562:
+	.loc 6 1335 3 view .LVU558
+	.loc 6 1335 34 is_stmt 0 view .LVU559
+	vpcmpeqb	%xmm0, %xmm2, %xmm0
+.LVL91:
+	.loc 6 1335 34 view .LVU560
+.LBE562:
+.LBE672:
+.LBB673:
+	.loc 6 1431 1 is_stmt 1 view .LVU561
+.LBB572:
+	.loc 6 1433 3 view .LVU562
+	.loc 6 1433 10 is_stmt 0 view .LVU563
+	vpmovmskb	%xmm0, %esi
+	vmovd	%esi, %xmm0
+.LVL92:
+	.loc 6 1433 10 view .LVU564
+.LBE572:
+.LBE673:
+	.loc 1 93 5 is_stmt 1 view .LVU565
+.LBB674:
+	.loc 6 1431 1 view .LVU566
+.LBB600:
+	.loc 6 1433 3 view .LVU567
+	.loc 6 1433 10 is_stmt 0 view .LVU568
+	vpmovmskb	%xmm12, %esi
+.LVL93:
+	.loc 6 1433 10 view .LVU569
+.LBE600:
+.LBE674:
+	.loc 1 94 5 is_stmt 1 view .LVU570
+.LBB675:
+	.loc 6 1333 1 view .LVU571
+.LBB580:
+	.loc 6 1335 3 view .LVU572
+	.loc 6 1335 34 is_stmt 0 view .LVU573
+	vpcmpeqb	%xmm7, %xmm2, %xmm12
+.LVL94:
+	.loc 6 1335 34 view .LVU574
+.LBE580:
+.LBE675:
+.LBB676:
+	.loc 6 1431 1 is_stmt 1 view .LVU575
+.LBB609:
+	.loc 6 1433 3 view .LVU576
+.LBE609:
+.LBE676:
+.LBB677:
+.LBB591:
+	.loc 6 1335 34 is_stmt 0 view .LVU577
+	vpcmpeqb	%xmm8, %xmm2, %xmm2
+.LBE591:
+.LBE677:
+	.loc 1 92 36 view .LVU578
+	vpinsrd	$1, %esi, %xmm0, %xmm0
+.LBB678:
+.LBB610:
+	.loc 6 1433 10 view .LVU579
+	vpmovmskb	%xmm12, %ecx
+.LVL95:
+	.loc 6 1433 10 view .LVU580
+.LBE610:
+.LBE678:
+	.loc 1 95 5 is_stmt 1 view .LVU581
+.LBB679:
+	.loc 6 1333 1 view .LVU582
+.LBB592:
+	.loc 6 1335 3 view .LVU583
+	.loc 6 1335 3 is_stmt 0 view .LVU584
+.LBE592:
+.LBE679:
+.LBB680:
+	.loc 6 1431 1 is_stmt 1 view .LVU585
+.LBB620:
+	.loc 6 1433 3 view .LVU586
+	.loc 6 1433 10 is_stmt 0 view .LVU587
+	vpmovmskb	%xmm2, %edi
+.LBE620:
+.LBE680:
+	.loc 1 92 36 view .LVU588
+	vmovd	%ecx, %xmm2
+.LVL96:
+	.loc 1 92 36 view .LVU589
+	vpinsrd	$1, %edi, %xmm2, %xmm2
+	vpunpcklqdq	%xmm2, %xmm0, %xmm0
+	.loc 1 92 26 view .LVU590
+	vpmovzxdq	%xmm0, %ymm0
+	.loc 1 92 119 view .LVU591
+	vpsllq	$32, %ymm0, %ymm0
+	.loc 1 92 23 view .LVU592
+	vpor	%ymm1, %ymm0, %ymm0
+.LVL97:
+	.loc 1 92 23 view .LVU593
+	vmovdqu	%ymm0, (%rdx)
+.LVL98:
+	.loc 1 92 23 view .LVU594
+.LBE721:
+	.loc 1 84 29 is_stmt 1 view .LVU595
+	.loc 1 84 21 view .LVU596
+.LBB722:
+	.loc 1 85 5 view .LVU597
+.LBB681:
+	.loc 6 701 1 view .LVU598
+.LBB472:
+	.loc 6 703 3 view .LVU599
+	.loc 6 703 3 is_stmt 0 view .LVU600
+.LBE472:
+.LBE681:
+	.loc 1 86 5 is_stmt 1 view .LVU601
+.LBB682:
+	.loc 6 1333 1 view .LVU602
+.LBB454:
+	.loc 6 1335 3 view .LVU603
+.LBE454:
+.LBE682:
+.LBB683:
+.LBB473:
+	.loc 6 703 10 is_stmt 0 view .LVU604
+	vmovdqu	48(%rax), %xmm1
+.LBE473:
+.LBE683:
+.LBB684:
+.LBB485:
+	.loc 6 1335 34 view .LVU605
+	vpcmpeqb	%xmm11, %xmm1, %xmm11
+.LBE485:
+.LBE684:
+.LBB685:
+.LBB497:
+	vpcmpeqb	%xmm6, %xmm1, %xmm6
+.LBE497:
+.LBE685:
+.LBB686:
+.LBB463:
+	vpcmpeqb	%xmm10, %xmm1, %xmm10
+.LBE463:
+.LBE686:
+.LBB687:
+.LBB455:
+	vpcmpeqb	%xmm4, %xmm1, %xmm4
+.LVL99:
+	.loc 6 1335 34 view .LVU606
+.LBE455:
+.LBE687:
+.LBB688:
+	.loc 6 1333 1 is_stmt 1 view .LVU607
+.LBB464:
+	.loc 6 1335 3 view .LVU608
+	.loc 6 1335 3 is_stmt 0 view .LVU609
+.LBE464:
+.LBE688:
+.LBB689:
+	.loc 6 1321 1 is_stmt 1 view .LVU610
+.LBB507:
+	.loc 6 1323 3 view .LVU611
+	.loc 6 1323 3 is_stmt 0 view .LVU612
+.LBE507:
+.LBE689:
+	.loc 1 87 5 is_stmt 1 view .LVU613
+.LBB690:
+	.loc 6 1333 1 view .LVU614
+.LBB486:
+	.loc 6 1335 3 view .LVU615
+	.loc 6 1335 3 is_stmt 0 view .LVU616
+.LBE486:
+.LBE690:
+.LBB691:
+	.loc 6 1321 1 is_stmt 1 view .LVU617
+.LBB513:
+	.loc 6 1323 3 view .LVU618
+	.loc 6 1323 3 is_stmt 0 view .LVU619
+.LBE513:
+.LBE691:
+	.loc 1 88 5 is_stmt 1 view .LVU620
+.LBB692:
+	.loc 6 1333 1 view .LVU621
+.LBB498:
+	.loc 6 1335 3 view .LVU622
+	.loc 6 1335 3 is_stmt 0 view .LVU623
+.LBE498:
+.LBE692:
+.LBB693:
+	.loc 6 1321 1 is_stmt 1 view .LVU624
+.LBB519:
+	.loc 6 1323 3 view .LVU625
+.LBE519:
+.LBE693:
+.LBB694:
+.LBB555:
+	.loc 6 1427 19 is_stmt 0 view .LVU626
+	vpminub	%xmm1, %xmm5, %xmm5
+.LBE555:
+.LBE694:
+.LBB695:
+.LBB534:
+	.loc 6 1335 34 view .LVU627
+	vpcmpeqb	%xmm9, %xmm1, %xmm9
+.LBE534:
+.LBE695:
+.LBB696:
+.LBB563:
+	vpcmpeqb	%xmm1, %xmm5, %xmm5
+.LBE563:
+.LBE696:
+.LBB697:
+.LBB581:
+	vpcmpeqb	%xmm7, %xmm1, %xmm7
+.LBE581:
+.LBE697:
+.LBB698:
+.LBB526:
+	vpcmpeqb	%xmm3, %xmm1, %xmm3
+	vpor	%xmm11, %xmm6, %xmm6
+.LVL100:
+	.loc 6 1335 34 view .LVU628
+.LBE526:
+.LBE698:
+.LBB699:
+.LBB593:
+	vpcmpeqb	%xmm8, %xmm1, %xmm1
+	vpternlogq	$254, %xmm6, %xmm10, %xmm4
+.LVL101:
+	.loc 6 1335 34 view .LVU629
+.LBE593:
+.LBE699:
+	.loc 1 89 5 is_stmt 1 view .LVU630
+.LBB700:
+	.loc 6 1333 1 view .LVU631
+.LBB527:
+	.loc 6 1335 3 view .LVU632
+	.loc 6 1335 3 is_stmt 0 view .LVU633
+.LBE527:
+.LBE700:
+.LBB701:
+	.loc 6 1321 1 is_stmt 1 view .LVU634
+.LBB541:
+	.loc 6 1323 3 view .LVU635
+	.loc 6 1323 3 is_stmt 0 view .LVU636
+.LBE541:
+.LBE701:
+	.loc 1 90 5 is_stmt 1 view .LVU637
+.LBB702:
+	.loc 6 1333 1 view .LVU638
+.LBB535:
+	.loc 6 1335 3 view .LVU639
+	.loc 6 1335 3 is_stmt 0 view .LVU640
+.LBE535:
+.LBE702:
+.LBB703:
+	.loc 6 1321 1 is_stmt 1 view .LVU641
+.LBB548:
+	.loc 6 1323 3 view .LVU642
+.LBE548:
+.LBE703:
+.LBB704:
+.LBB611:
+	.loc 6 1433 10 is_stmt 0 view .LVU643
+	vpmovmskb	%xmm7, %edi
+.LBE611:
+.LBE704:
+.LBB705:
+.LBB549:
+	.loc 6 1323 33 view .LVU644
+	vpternlogq	$254, %xmm4, %xmm9, %xmm3
+.LVL102:
+	.loc 6 1323 33 view .LVU645
+.LBE549:
+.LBE705:
+	.loc 1 92 5 is_stmt 1 view .LVU646
+.LBB706:
+	.loc 6 1425 1 view .LVU647
+.LBB556:
+	.loc 6 1427 3 view .LVU648
+	.loc 6 1427 3 is_stmt 0 view .LVU649
+.LBE556:
+.LBE706:
+.LBB707:
+	.loc 6 1333 1 is_stmt 1 view .LVU650
+.LBB564:
+	.loc 6 1335 3 view .LVU651
+	.loc 6 1335 3 is_stmt 0 view .LVU652
+.LBE564:
+.LBE707:
+.LBB708:
+	.loc 6 1431 1 is_stmt 1 view .LVU653
+.LBB573:
+	.loc 6 1433 3 view .LVU654
+	.loc 6 1433 10 is_stmt 0 view .LVU655
+	vpmovmskb	%xmm5, %eax
+.LVL103:
+	.loc 6 1433 10 view .LVU656
+.LBE573:
+.LBE708:
+	.loc 1 93 5 is_stmt 1 view .LVU657
+.LBB709:
+	.loc 6 1431 1 view .LVU658
+.LBB601:
+	.loc 6 1433 3 view .LVU659
+.LBE601:
+.LBE709:
+.LBB710:
+.LBB621:
+	.loc 6 1433 10 is_stmt 0 view .LVU660
+	vpmovmskb	%xmm1, %esi
+.LBE621:
+.LBE710:
+.LBB711:
+.LBB602:
+	vpmovmskb	%xmm3, %ecx
+.LVL104:
+	.loc 6 1433 10 view .LVU661
+.LBE602:
+.LBE711:
+	.loc 1 94 5 is_stmt 1 view .LVU662
+.LBB712:
+	.loc 6 1333 1 view .LVU663
+.LBB582:
+	.loc 6 1335 3 view .LVU664
+	.loc 6 1335 3 is_stmt 0 view .LVU665
+.LBE582:
+.LBE712:
+.LBB713:
+	.loc 6 1431 1 is_stmt 1 view .LVU666
+.LBB612:
+	.loc 6 1433 3 view .LVU667
+	.loc 6 1433 10 is_stmt 0 view .LVU668
+	vmovd	%edi, %xmm2
+.LVL105:
+	.loc 6 1433 10 view .LVU669
+.LBE612:
+.LBE713:
+	.loc 1 95 5 is_stmt 1 view .LVU670
+.LBB714:
+	.loc 6 1333 1 view .LVU671
+.LBB594:
+	.loc 6 1335 3 view .LVU672
+	.loc 6 1335 3 is_stmt 0 view .LVU673
+.LBE594:
+.LBE714:
+.LBB715:
+	.loc 6 1431 1 is_stmt 1 view .LVU674
+.LBB622:
+	.loc 6 1433 3 view .LVU675
+	.loc 6 1433 3 is_stmt 0 view .LVU676
+.LBE622:
+.LBE715:
+	.loc 1 92 36 view .LVU677
+	vmovd	%eax, %xmm7
+	vpinsrd	$1, %esi, %xmm2, %xmm2
+	vpinsrd	$1, %ecx, %xmm7, %xmm1
+	vpunpcklqdq	%xmm2, %xmm1, %xmm1
+	.loc 1 92 26 view .LVU678
+	vpmovzxdq	%xmm1, %ymm1
+	.loc 1 92 119 view .LVU679
+	vpsllq	$48, %ymm1, %ymm1
+	.loc 1 92 23 view .LVU680
+	vpor	%ymm0, %ymm1, %ymm0
+	vmovdqu	%ymm0, (%rdx)
+.LVL106:
+	.loc 1 92 23 view .LVU681
+.LBE722:
+	.loc 1 84 29 is_stmt 1 view .LVU682
+	.loc 1 84 21 view .LVU683
+	vzeroupper
+.LVL107:
+.LBE726:
+	.loc 1 97 1 is_stmt 0 view .LVU684
+	ret
+	.cfi_endproc
+.LFE6408:
+	.size	structural_index_classify_sse2, .-structural_index_classify_sse2
+	.p2align 4
+	.globl	st_drop_structural_index
+	.type	st_drop_structural_index, @function
+st_drop_structural_index:
+.LVL108:
+.LFB6413:
+	.loc 1 265 66 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 266 3 view .LVU686
+	.loc 1 265 66 is_stmt 0 view .LVU687
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 266 33 view .LVU688
+	movq	328(%rdi), %rbp
+.LVL109:
+	.loc 1 267 3 is_stmt 1 view .LVU689
+	.loc 1 267 6 is_stmt 0 view .LVU690
+	testq	%rbp, %rbp
+	je	.L28
+	movq	%rdi, %rbx
+	.loc 1 268 5 is_stmt 1 view .LVU691
+	movq	0(%rbp), %rdi
+.LVL110:
+	.loc 1 268 5 is_stmt 0 view .LVU692
+	call	free@PLT
+.LVL111:
+	.loc 1 269 5 is_stmt 1 view .LVU693
+	movq	16(%rbp), %rdi
+	call	free@PLT
+.LVL112:
+	.loc 1 270 5 view .LVU694
+	movq	%rbp, %rdi
+	call	free@PLT
+.LVL113:
+	.loc 1 271 5 view .LVU695
+	.loc 1 271 33 is_stmt 0 view .LVU696
+	movq	$0, 328(%rbx)
+.LVL114:
+.L28:
+	.loc 1 273 1 view .LVU697
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL115:
+	.loc 1 273 1 view .LVU698
+	ret
+	.cfi_endproc
+.LFE6413:
+	.size	st_drop_structural_index, .-st_drop_structural_index
+	.p2align 4
+	.globl	st_build_structural_index
+	.type	st_build_structural_index, @function
+st_build_structural_index:
+.LVL116:
+.LFB6412:
+	.loc 1 161 66 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 162 3 view .LVU700
+	.loc 1 161 66 is_stmt 0 view .LVU701
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	andq	$-64, %rsp
+	subq	$256, %rsp
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	.loc 1 162 6 view .LVU702
+	cmpq	$0, 48(%rdi)
+	.loc 1 161 66 view .LVU703
+	movq	%rdi, 120(%rsp)
+	.loc 1 162 6 view .LVU704
+	je	.L64
+.LVL117:
+.L32:
+	.loc 1 163 12 view .LVU705
+	xorl	%eax, %eax
+	jmp	.L30
+.LVL118:
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	.loc 1 165 3 view .LVU706
+	call	st_drop_structural_index@PLT
+.LVL119:
+	.loc 1 167 3 is_stmt 1 view .LVU707
+	.loc 1 169 3 view .LVU708
+	.loc 1 169 11 is_stmt 0 view .LVU709
+	xorl	%eax, %eax
+	call	st_scan_isa@PLT
+.LVL120:
+	.loc 1 174 16 view .LVU710
+	leaq	structural_index_classify_avx2(%rip), %rbx
+	movq	%rbx, 112(%rsp)
+	.loc 1 169 3 view .LVU711
+	cmpl	$2, %eax
+	je	.L33
+	.loc 1 177 16 view .LVU712
+	leaq	structural_index_classify_avx512(%rip), %rbx
+	movq	%rbx, 112(%rsp)
+	.loc 1 169 3 view .LVU713
+	cmpl	$3, %eax
+	je	.L33
+	.loc 1 167 10 view .LVU714
+	cmpl	$1, %eax
+	leaq	structural_index_classify_sse2(%rip), %rdx
+	leaq	structural_index_classify_scalar(%rip), %rax
+	cmove	%rdx, %rax
+	movq	%rax, 112(%rsp)
+.L33:
+.LVL121:
+	.loc 1 183 3 is_stmt 1 view .LVU715
+	.loc 1 183 10 is_stmt 0 view .LVU716
+	movq	120(%rsp), %rax
+	.loc 1 186 73 view .LVU717
+	movl	$40, %edi
+	.loc 1 183 10 view .LVU718
+	movq	8(%rax), %r13
+	.loc 1 185 28 view .LVU719
+	movq	%r13, %rax
+	shrq	$3, %rax
+	.loc 1 185 10 view .LVU720
+	leaq	64(%rax), %r14
+	.loc 1 183 10 view .LVU721
+	movq	%r13, 152(%rsp)
+.LVL122:
+	.loc 1 184 3 is_stmt 1 view .LVU722
+	.loc 1 185 10 is_stmt 0 view .LVU723
+	movq	%r14, 128(%rsp)
+	.loc 1 184 32 view .LVU724
+	leaq	63(%r13), %rbx
+	.loc 1 186 73 view .LVU725
+	call	malloc@PLT
+.LVL123:
+	.loc 1 184 10 view .LVU726
+	shrq	$6, %rbx
+.LVL124:
+	.loc 1 185 3 is_stmt 1 view .LVU727
+	.loc 1 186 3 view .LVU728
+	.loc 1 186 73 is_stmt 0 view .LVU729
+	movq	%rax, %r12
+.LVL125:
+	.loc 1 187 3 is_stmt 1 view .LVU730
+	.loc 1 187 6 is_stmt 0 view .LVU731
+	testq	%rax, %rax
+	je	.L32
+	.loc 1 190 3 is_stmt 1 view .LVU732
+	.loc 1 190 32 is_stmt 0 view .LVU733
+	leaq	0(,%r14,8), %rdi
+	call	malloc@PLT
+.LVL126:
+	.loc 1 190 20 view .LVU734
+	movq	%rax, (%r12)
+	.loc 1 191 3 is_stmt 1 view .LVU735
+	.loc 1 191 34 is_stmt 0 view .LVU736
+	leaq	8(,%rbx,8), %r14
+.LVL127:
+	.loc 1 191 34 view .LVU737
+	movq	%r14, %rdi
+	.loc 1 190 32 view .LVU738
+	movq	%rax, %r15
+	.loc 1 191 34 view .LVU739
+	call	malloc@PLT
+.LVL128:
+	.loc 1 191 20 view .LVU740
+	movq	%rax, 16(%r12)
+	.loc 1 192 3 is_stmt 1 view .LVU741
+	.loc 1 192 16 is_stmt 0 view .LVU742
+	movq	$0, 8(%r12)
+	.loc 1 193 3 is_stmt 1 view .LVU743
+	.loc 1 193 17 is_stmt 0 view .LVU744
+	movq	%r13, 24(%r12)
+	.loc 1 194 3 is_stmt 1 view .LVU745
+	.loc 1 194 15 is_stmt 0 view .LVU746
+	movq	$0, 32(%r12)
+	.loc 1 195 3 is_stmt 1 view .LVU747
+	.loc 1 195 31 is_stmt 0 view .LVU748
+	testq	%rax, %rax
+	je	.L35
+	testq	%r15, %r15
+	je	.L35
+.LVL129:
+.LBB727:
+	.loc 1 206 44 is_stmt 1 view .LVU749
+	testq	%rbx, %rbx
+	je	.L46
+	leaq	-8(%r14), %rax
+	movq	%rax, 104(%rsp)
+	leaq	160(%rsp), %rax
+	movq	%rax, 96(%rsp)
+.LBE727:
+	.loc 1 203 12 is_stmt 0 view .LVU750
+	xorl	%ebx, %ebx
+.LVL130:
+.LBB747:
+.LBB728:
+	.loc 1 211 7 view .LVU751
+	leaq	192(%rsp), %rax
+	movq	%rax, 88(%rsp)
+.LBB729:
+	.loc 1 223 10 view .LVU752
+	movq	%rbx, 144(%rsp)
+.LBE729:
+	.loc 1 211 7 view .LVU753
+	movl	$32, %eax
+.LBE728:
+.LBE747:
+	.loc 1 204 12 view .LVU754
+	xorl	%r13d, %r13d
+.LVL131:
+.LBB748:
+.LBB743:
+	.loc 1 211 7 view .LVU755
+	vpbroadcastb	%eax, %zmm1
+.LBB730:
+	.loc 1 223 10 view .LVU756
+	movq	%r13, 136(%rsp)
+.LBE730:
+.LBE743:
+.LBE748:
+	.loc 1 202 12 view .LVU757
+	xorl	%r15d, %r15d
+.LBB749:
+.LBB744:
+	.loc 1 211 7 view .LVU758
+	vmovdqa64	%zmm1, (%rsp)
+.LBB731:
+	.loc 1 223 10 view .LVU759
+	movabsq	$-9223372036854775808, %r14
+	movq	%r12, %r13
+.LVL132:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.loc 1 223 10 view .LVU760
+.LBE731:
+	.loc 1 207 5 is_stmt 1 view .LVU761
+	.loc 1 208 17 is_stmt 0 view .LVU762
+	movq	120(%rsp), %rax
+	leaq	0(,%r15,8), %r12
+.LVL133:
+	.loc 1 208 5 is_stmt 1 view .LVU763
+	.loc 1 208 17 is_stmt 0 view .LVU764
+	movq	(%rax), %rdi
+	addq	%r12, %rdi
+.LVL134:
+	.loc 1 209 5 is_stmt 1 view .LVU765
+	.loc 1 209 8 is_stmt 0 view .LVU766
+	cmpq	$63, 152(%rsp)
+	jbe	.L65
+	vzeroupper
+.LVL135:
+.L38:
+	.loc 1 215 5 is_stmt 1 view .LVU767
+	.loc 1 216 5 view .LVU768
+	movq	112(%rsp), %rax
+	movq	96(%rsp), %rsi
+	call	*%rax
+.LVL136:
+	.loc 1 218 5 view .LVU769
+	.loc 1 219 5 view .LVU770
+	.loc 1 219 48 is_stmt 0 view .LVU771
+	movq	%rbx, %rdx
+	notq	%rdx
+.LVL137:
+	.loc 1 220 5 is_stmt 1 view .LVU772
+	.loc 1 221 5 view .LVU773
+	.loc 1 221 24 view .LVU774
+	movq	%rdx, %rax
+	andq	184(%rsp), %rax
+.LVL138:
+	.loc 1 221 24 is_stmt 0 view .LVU775
+	je	.L52
+.LBB732:
+	.loc 1 222 7 is_stmt 1 view .LVU776
+	.loc 1 222 17 is_stmt 0 view .LVU777
+	xorl	%esi, %esi
+	tzcntq	%rax, %rsi
+.LVL139:
+	.loc 1 223 7 is_stmt 1 view .LVU778
+	.loc 1 223 10 is_stmt 0 view .LVU779
+	cmpq	%r14, %rax
+	je	.L53
+	.loc 1 228 23 view .LVU780
+	movl	$1, %edi
+	.loc 1 229 29 view .LVU781
+	movl	$3, %edx
+	jmp	.L40
+.LVL140:
+	.p2align 4,,10
+	.p2align 3
+.L41:
+	.loc 1 222 7 is_stmt 1 view .LVU782
+	.loc 1 222 17 is_stmt 0 view .LVU783
+	xorl	%esi, %esi
+	tzcntq	%rax, %rsi
+.LVL141:
+	.loc 1 223 7 is_stmt 1 view .LVU784
+	.loc 1 223 10 is_stmt 0 view .LVU785
+	cmpq	%r14, %rax
+	je	.L66
+.LVL142:
+.L40:
+	.loc 1 228 7 is_stmt 1 view .LVU786
+	.loc 1 228 31 is_stmt 0 view .LVU787
+	leal	1(%rsi), %ecx
+	.loc 1 228 23 view .LVU788
+	shlx	%rcx, %rdi, %rcx
+	.loc 1 229 29 view .LVU789
+	shlx	%rsi, %rdx, %rsi
+.LVL143:
+	.loc 1 228 15 view .LVU790
+	orq	%rcx, %rbx
+.LVL144:
+	.loc 1 229 7 is_stmt 1 view .LVU791
+	.loc 1 229 19 is_stmt 0 view .LVU792
+	andn	%rax, %rsi, %rax
+.LVL145:
+	.loc 1 229 19 view .LVU793
+.LBE732:
+	.loc 1 221 24 is_stmt 1 view .LVU794
+	testq	%rax, %rax
+	jne	.L41
+	.loc 1 232 38 is_stmt 0 view .LVU795
+	notq	%rbx
+.LVL146:
+	.loc 1 232 38 view .LVU796
+	movq	%rbx, %rdx
+	.loc 1 220 18 view .LVU797
+	xorl	%ebx, %ebx
+.LVL147:
+.L39:
+	.loc 1 232 5 is_stmt 1 view .LVU798
+	.loc 1 232 14 is_stmt 0 view .LVU799
+	andq	176(%rsp), %rdx
+.LBB733:
+.LBB734:
+	.loc 1 149 16 view .LVU800
+	leaq	(%rdx,%rdx), %rsi
+	.loc 1 149 8 view .LVU801
+	xorq	%rdx, %rsi
+	.loc 1 150 16 view .LVU802
+	leaq	0(,%rsi,4), %rax
+	.loc 1 150 8 view .LVU803
+	xorq	%rax, %rsi
+	.loc 1 151 16 view .LVU804
+	movq	%rsi, %rax
+	salq	$4, %rax
+	.loc 1 151 8 view .LVU805
+	xorq	%rax, %rsi
+	.loc 1 152 16 view .LVU806
+	movq	%rsi, %rax
+	salq	$8, %rax
+	.loc 1 152 8 view .LVU807
+	xorq	%rax, %rsi
+	.loc 1 153 16 view .LVU808
+	movq	%rsi, %rax
+	salq	$16, %rax
+.LBE734:
+.LBE733:
+	.loc 1 233 14 view .LVU809
+	movq	144(%rsp), %rdi
+.LBB737:
+.LBB735:
+	.loc 1 153 8 view .LVU810
+	xorq	%rax, %rsi
+	.loc 1 154 16 view .LVU811
+	movq	%rsi, %rax
+	salq	$32, %rax
+.LBE735:
+.LBE737:
+	.loc 1 233 14 view .LVU812
+	xorq	%rdi, %rsi
+	xorq	%rsi, %rax
+	.loc 1 235 35 view .LVU813
+	movq	16(%r13), %rsi
+	.loc 1 232 14 view .LVU814
+	movq	%rdx, %r8
+.LVL148:
+	.loc 1 233 5 is_stmt 1 view .LVU815
+.LBB738:
+.LBI733:
+	.loc 1 148 24 view .LVU816
+.LBB736:
+	.loc 1 149 3 view .LVU817
+	.loc 1 150 3 view .LVU818
+	.loc 1 151 3 view .LVU819
+	.loc 1 152 3 view .LVU820
+	.loc 1 153 3 view .LVU821
+	.loc 1 154 3 view .LVU822
+	.loc 1 155 3 view .LVU823
+	.loc 1 155 3 is_stmt 0 view .LVU824
+.LBE736:
+.LBE738:
+	.loc 1 234 5 is_stmt 1 view .LVU825
+	.loc 1 235 35 is_stmt 0 view .LVU826
+	movq	%rax, (%rsi,%r15)
+	.loc 1 234 32 view .LVU827
+	cqto
+.LVL149:
+	.loc 1 234 32 view .LVU828
+	movq	%rdx, 144(%rsp)
+.LVL150:
+	.loc 1 235 5 is_stmt 1 view .LVU829
+	.loc 1 237 5 view .LVU830
+	.loc 1 237 50 is_stmt 0 view .LVU831
+	movq	168(%rsp), %r11
+	.loc 1 237 43 view .LVU832
+	movq	160(%rsp), %rsi
+	.loc 1 238 14 view .LVU833
+	movq	136(%rsp), %rdx
+.LVL151:
+	.loc 1 237 43 view .LVU834
+	orq	%r11, %rsi
+	.loc 1 237 61 view .LVU835
+	orq	%r8, %rsi
+	.loc 1 237 70 view .LVU836
+	orq	%rax, %rsi
+	.loc 1 237 14 view .LVU837
+	movq	%rsi, %rcx
+	notq	%rcx
+.LVL152:
+	.loc 1 238 5 is_stmt 1 view .LVU838
+	.loc 1 238 14 is_stmt 0 view .LVU839
+	orq	%rdx, %rsi
+	.loc 1 240 59 view .LVU840
+	movq	%r8, %rdx
+	.loc 1 238 51 view .LVU841
+	leaq	(%rcx,%rcx), %rdi
+	.loc 1 240 45 view .LVU842
+	andn	%r11, %rax, %rax
+.LVL153:
+	.loc 1 240 59 view .LVU843
+	orq	%rax, %rdx
+	.loc 1 242 22 view .LVU844
+	movq	8(%r13), %rax
+	.loc 1 238 14 view .LVU845
+	orq	%rsi, %rdi
+	notq	%rdi
+.LVL154:
+	.loc 1 239 5 is_stmt 1 view .LVU846
+	.loc 1 239 18 is_stmt 0 view .LVU847
+	shrq	$63, %rcx
+.LVL155:
+	.loc 1 242 22 view .LVU848
+	addq	$64, %rax
+	.loc 1 239 18 view .LVU849
+	movq	%rcx, 136(%rsp)
+.LVL156:
+	.loc 1 240 5 is_stmt 1 view .LVU850
+	.loc 1 240 14 is_stmt 0 view .LVU851
+	orq	%rdi, %rdx
+.LVL157:
+	.loc 1 242 5 is_stmt 1 view .LVU852
+	.loc 1 242 8 is_stmt 0 view .LVU853
+	cmpq	%rax, 128(%rsp)
+	jb	.L67
+.LVL158:
+.L42:
+	.loc 1 253 24 is_stmt 1 view .LVU854
+	testq	%rdx, %rdx
+	je	.L48
+	.loc 1 254 12 is_stmt 0 view .LVU855
+	movq	0(%r13), %rdi
+.LVL159:
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	.loc 1 254 7 is_stmt 1 view .LVU856
+	.loc 1 254 29 is_stmt 0 view .LVU857
+	movq	8(%r13), %rcx
+	.loc 1 254 36 view .LVU858
+	leaq	1(%rcx), %rax
+	movq	%rax, 8(%r13)
+	.loc 1 254 51 view .LVU859
+	xorl	%eax, %eax
+	tzcntq	%rdx, %rax
+	.loc 1 254 49 view .LVU860
+	addq	%r12, %rax
+	movq	%rax, (%rdi,%rcx,8)
+	.loc 1 255 7 is_stmt 1 view .LVU861
+.LVL160:
+	.loc 1 253 24 view .LVU862
+	blsr	%rdx, %rdx
+.LVL161:
+	.loc 1 253 24 is_stmt 0 view .LVU863
+	jne	.L44
+.LVL162:
+.L48:
+	.loc 1 253 24 view .LVU864
+.LBE744:
+	.loc 1 206 65 is_stmt 1 view .LVU865
+	.loc 1 206 44 view .LVU866
+	addq	$8, %r15
+	subq	$64, 152(%rsp)
+	cmpq	%r15, 104(%rsp)
+	jne	.L45
+	movq	%r13, %r12
+.LVL163:
+.L46:
+	.loc 1 206 44 is_stmt 0 view .LVU867
+.LBE749:
+	.loc 1 258 3 is_stmt 1 view .LVU868
+	.loc 1 258 31 is_stmt 0 view .LVU869
+	movq	120(%rsp), %rax
+	movq	%r12, 328(%rax)
+	.loc 1 259 3 is_stmt 1 view .LVU870
+	.loc 1 259 10 is_stmt 0 view .LVU871
+	movl	$1, %eax
+.LVL164:
+.L30:
+	.loc 1 260 1 view .LVU872
+	leaq	-40(%rbp), %rsp
+.LVL165:
+	.loc 1 260 1 view .LVU873
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_remember_state
+	.cfi_def_cfa 7, 8
+.LVL166:
+	.loc 1 260 1 view .LVU874
+	ret
+.LVL167:
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	.cfi_restore_state
+.LBB750:
+.LBB745:
+	.loc 1 232 38 view .LVU875
+	notq	%rbx
+.LVL168:
+	.loc 1 232 38 view .LVU876
+	movq	%rbx, %rdx
+.LBB739:
+	.loc 1 224 22 view .LVU877
+	movl	$1, %ebx
+.LVL169:
+	.loc 1 224 22 view .LVU878
+	jmp	.L39
+.LVL170:
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	.loc 1 224 22 view .LVU879
+.LBE739:
+.LBB740:
+	.loc 1 243 16 view .LVU880
+	movq	128(%rsp), %rax
+	movq	%rdx, 80(%rsp)
+	.loc 1 243 7 is_stmt 1 view .LVU881
+	.loc 1 243 16 is_stmt 0 view .LVU882
+	leaq	(%rax,%rax), %rdi
+.LVL171:
+	.loc 1 243 16 view .LVU883
+	movq	%rdi, 128(%rsp)
+.LVL172:
+	.loc 1 244 7 is_stmt 1 view .LVU884
+	.loc 1 244 37 is_stmt 0 view .LVU885
+	salq	$4, %rax
+	movq	0(%r13), %rdi
+.LVL173:
+	.loc 1 244 37 view .LVU886
+	movq	%rax, %rsi
+.LVL174:
+	.loc 1 244 37 view .LVU887
+	call	realloc@PLT
+.LVL175:
+	.loc 1 245 7 is_stmt 1 view .LVU888
+	.loc 1 245 10 is_stmt 0 view .LVU889
+	testq	%rax, %rax
+	movq	80(%rsp), %rdx
+	je	.L68
+	.loc 1 251 7 is_stmt 1 view .LVU890
+	.loc 1 251 24 is_stmt 0 view .LVU891
+	movq	%rax, 0(%r13)
+	jmp	.L42
+.LVL176:
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	.loc 1 251 24 view .LVU892
+.LBE740:
+	.loc 1 211 7 is_stmt 1 view .LVU893
+	movq	88(%rsp), %rax
+	vmovdqa64	(%rsp), %zmm0
+	.loc 1 212 7 is_stmt 0 view .LVU894
+	movq	152(%rsp), %rdx
+	.loc 1 211 7 view .LVU895
+	vmovdqu8	%zmm0, (%rax)
+	.loc 1 212 7 is_stmt 1 view .LVU896
+	movq	%rdi, %rsi
+	movq	%rax, %rdi
+.LVL177:
+	.loc 1 212 7 is_stmt 0 view .LVU897
+	vzeroupper
+.LVL178:
+	call	memcpy@PLT
+.LVL179:
+	.loc 1 213 7 is_stmt 1 view .LVU898
+	.loc 1 213 13 is_stmt 0 view .LVU899
+	movq	88(%rsp), %rdi
+	jmp	.L38
+.LVL180:
+.L52:
+	.loc 1 220 18 view .LVU900
+	xorl	%ebx, %ebx
+.LVL181:
+	.loc 1 220 18 view .LVU901
+	jmp	.L39
+.LVL182:
+.L53:
+.LBB741:
+	.loc 1 224 22 view .LVU902
+	movl	$1, %ebx
+	jmp	.L39
+.LVL183:
+.L35:
+	.loc 1 224 22 view .LVU903
+.LBE741:
+.LBE745:
+.LBE750:
+	.loc 1 196 5 view .LVU904
+	movq	%r15, %rdi
+	movq	%rax, 152(%rsp)
+	.loc 1 196 5 is_stmt 1 view .LVU905
+	call	free@PLT
+.LVL184:
+	.loc 1 197 5 view .LVU906
+	movq	152(%rsp), %rdi
+	call	free@PLT
+.LVL185:
+	.loc 1 198 5 view .LVU907
+	movq	%r12, %rdi
+	call	free@PLT
+.LVL186:
+	.loc 1 199 5 view .LVU908
+	.loc 1 163 12 is_stmt 0 view .LVU909
+	xorl	%eax, %eax
+	jmp	.L30
+.LVL187:
+.L68:
+.LBB751:
+.LBB746:
+.LBB742:
+	.loc 1 246 9 is_stmt 1 view .LVU910
+	movq	0(%r13), %rdi
+	call	free@PLT
+.LVL188:
+	.loc 1 247 9 view .LVU911
+	movq	16(%r13), %rdi
+	call	free@PLT
+.LVL189:
+	.loc 1 248 9 view .LVU912
+	movq	%r13, %rdi
+	call	free@PLT
+.LVL190:
+	.loc 1 249 9 view .LVU913
+.LBE742:
+.LBE746:
+.LBE751:
+	.loc 1 163 12 is_stmt 0 view .LVU914
+	xorl	%eax, %eax
+	jmp	.L30
+	.cfi_endproc
+.LFE6412:
+	.size	st_build_structural_index, .-st_build_structural_index
+	.p2align 4
+	.globl	st_structural_next
+	.type	st_structural_next, @function
+st_structural_next:
+.LVL191:
+.LFB6414:
+	.loc 1 278 87 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 279 3 view .LVU916
+	.loc 1 280 3 view .LVU917
+	.loc 1 280 10 is_stmt 0 view .LVU918
+	movq	8(%rdi), %r9
+.LVL192:
+	.loc 1 281 3 is_stmt 1 view .LVU919
+	.loc 1 281 10 is_stmt 0 view .LVU920
+	movq	32(%rdi), %rcx
+.LVL193:
+	.loc 1 283 3 is_stmt 1 view .LVU921
+	.loc 1 283 6 is_stmt 0 view .LVU922
+	cmpq	%r9, %rcx
+	jb	.L70
+	movq	%r9, %rcx
+.LVL194:
+	.loc 1 279 10 view .LVU923
+	xorl	%edx, %edx
+	jmp	.L75
+.LVL195:
+	.p2align 4,,10
+	.p2align 3
+.L76:
+.LBB752:
+	.loc 1 298 5 is_stmt 1 view .LVU924
+	.loc 1 298 33 is_stmt 0 view .LVU925
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	.loc 1 298 40 view .LVU926
+	shrq	%rax
+	.loc 1 299 25 view .LVU927
+	movq	(%rdi), %r8
+	.loc 1 298 12 view .LVU928
+	addq	%rdx, %rax
+.LVL196:
+	.loc 1 299 5 is_stmt 1 view .LVU929
+	.loc 1 299 8 is_stmt 0 view .LVU930
+	cmpq	%rsi, (%r8,%rax,8)
+	jb	.L84
+	.loc 1 298 12 view .LVU931
+	movq	%rax, %rcx
+.LVL197:
+.L75:
+	.loc 1 298 12 view .LVU932
+.LBE752:
+	.loc 1 297 14 is_stmt 1 view .LVU933
+	cmpq	%rcx, %rdx
+	jb	.L76
+	.loc 1 306 3 view .LVU934
+	.loc 1 306 15 is_stmt 0 view .LVU935
+	movq	%rdx, 32(%rdi)
+.LVL198:
+	.loc 1 307 3 is_stmt 1 view .LVU936
+	.loc 1 307 53 is_stmt 0 view .LVU937
+	cmpq	%r9, %rdx
+	jnb	.L77
+	.loc 1 307 53 discriminator 1 view .LVU938
+	movq	(%rdi), %rax
+	movq	(%rax,%rdx,8), %rax
+	ret
+.LVL199:
+	.p2align 4,,10
+	.p2align 3
+.L84:
+.LBB753:
+	.loc 1 300 7 is_stmt 1 view .LVU939
+	.loc 1 300 11 is_stmt 0 view .LVU940
+	leaq	1(%rax), %rdx
+.LVL200:
+	.loc 1 300 11 view .LVU941
+	jmp	.L75
+.LVL201:
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	.loc 1 300 11 view .LVU942
+.LBE753:
+	.loc 1 307 53 discriminator 2 view .LVU943
+	movq	24(%rdi), %rax
+.LVL202:
+.L69:
+	.loc 1 308 1 view .LVU944
+	ret
+.LVL203:
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	.loc 1 283 27 view .LVU945
+	movq	(%rdi), %r8
+	.loc 1 283 38 view .LVU946
+	leaq	0(,%rcx,8), %r10
+	movq	(%r8,%rcx,8), %rax
+	.loc 1 283 19 view .LVU947
+	cmpq	%rsi, %rax
+	jb	.L72
+	.loc 1 284 5 is_stmt 1 view .LVU948
+	.loc 1 284 8 is_stmt 0 view .LVU949
+	testq	%rcx, %rcx
+	je	.L69
+	.loc 1 279 10 discriminator 1 view .LVU950
+	xorl	%edx, %edx
+	.loc 1 284 19 discriminator 1 view .LVU951
+	cmpq	%rsi, -8(%r8,%r10)
+	jnb	.L75
+	.loc 1 308 1 view .LVU952
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	.loc 1 289 8 is_stmt 1 view .LVU953
+	.loc 1 290 5 view .LVU954
+	.loc 1 290 9 is_stmt 0 view .LVU955
+	leaq	1(%rcx), %rdx
+.LVL204:
+	.loc 1 291 5 is_stmt 1 view .LVU956
+	.loc 1 291 8 is_stmt 0 view .LVU957
+	cmpq	%r9, %rdx
+	jnb	.L78
+	.loc 1 291 39 discriminator 1 view .LVU958
+	leaq	8(%r8,%r10), %rax
+	movq	%r9, %rcx
+.LVL205:
+	.loc 1 291 20 discriminator 1 view .LVU959
+	cmpq	%rsi, (%rax)
+	jb	.L75
+.LVL206:
+	.loc 1 292 7 is_stmt 1 view .LVU960
+	.loc 1 292 19 is_stmt 0 view .LVU961
+	movq	%rdx, 32(%rdi)
+.LVL207:
+	.loc 1 293 7 is_stmt 1 view .LVU962
+	.loc 1 293 30 is_stmt 0 view .LVU963
+	movq	(%rax), %rax
+	ret
+.LVL208:
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.loc 1 293 30 view .LVU964
+	movq	%r9, %rcx
+.LVL209:
+	.loc 1 293 30 view .LVU965
+	jmp	.L75
+	.cfi_endproc
+.LFE6414:
+	.size	st_structural_next, .-st_structural_next
+	.p2align 4
+	.globl	st_next_structural
+	.type	st_next_structural, @function
+st_next_structural:
+.LVL210:
+.LFB6415:
+	.loc 1 313 60 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 314 3 view .LVU967
+	.loc 1 313 60 is_stmt 0 view .LVU968
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 313 60 view .LVU969
+	movq	%rdi, %rbx
+	.loc 1 314 16 view .LVU970
+	movq	328(%rdi), %rdi
+.LVL211:
+	.loc 1 314 6 view .LVU971
+	testq	%rdi, %rdi
+	je	.L88
+	.loc 1 318 3 is_stmt 1 view .LVU972
+	.loc 1 318 25 is_stmt 0 view .LVU973
+	movq	16(%rbx), %rax
+	leaq	1(%rax), %rsi
+	call	st_structural_next@PLT
+.LVL212:
+	.loc 1 318 23 view .LVU974
+	movq	%rax, 16(%rbx)
+	.loc 1 319 1 view .LVU975
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL213:
+	.loc 1 319 1 view .LVU976
+	ret
+.LVL214:
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	.cfi_restore_state
+	.loc 1 315 5 is_stmt 1 view .LVU977
+	movq	%rbx, %rdi
+	.loc 1 319 1 is_stmt 0 view .LVU978
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL215:
+	.loc 1 315 5 view .LVU979
+	jmp	st_next_token@PLT
+.LVL216:
+	.loc 1 315 5 view .LVU980
+	.cfi_endproc
+.LFE6415:
+	.size	st_next_structural, .-st_next_structural
+.Letext0:
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 11 "/root/repo/src/../include/strutils.h"
+	.file 12 "/usr/include/stdlib.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1a29
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x30
+	.long	.LASF174
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xc
+	.long	.LASF10
+	.byte	0x7
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x13
+	.long	0x2e
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0xc
+	.long	.LASF11
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x32
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF12
+	.byte	0x8
+	.byte	0xc2
+	.byte	0x12
+	.long	0x4d
+	.uleb128 0x8
+	.long	0x9d
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x13
+	.long	0x9d
+	.uleb128 0xc
+	.long	.LASF14
+	.byte	0x9
+	.byte	0x6c
+	.byte	0x13
+	.long	0x8c
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF15
+	.uleb128 0x8
+	.long	0xc1
+	.uleb128 0x33
+	.uleb128 0x8
+	.long	0xa4
+	.uleb128 0xc
+	.long	.LASF16
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x34
+	.long	.LASF42
+	.byte	0x7
+	.byte	0x4
+	.long	0x69
+	.byte	0xb
+	.byte	0xe7
+	.byte	0x6
+	.long	0xfe
+	.uleb128 0xe
+	.long	.LASF17
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF18
+	.byte	0x1
+	.uleb128 0xe
+	.long	.LASF19
+	.byte	0x2
+	.uleb128 0xe
+	.long	.LASF20
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF25
+	.byte	0x18
+	.value	0x175
+	.long	0x132
+	.uleb128 0x5
+	.long	.LASF21
+	.value	0x17a
+	.byte	0x1c
+	.long	0x137
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF22
+	.value	0x17f
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF23
+	.value	0x184
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF175
+	.uleb128 0x8
+	.long	0x132
+	.uleb128 0xb
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF24
+	.uleb128 0x19
+	.long	.LASF26
+	.byte	0x40
+	.value	0x1e6
+	.long	0x1b8
+	.uleb128 0x5
+	.long	.LASF27
+	.value	0x1eb
+	.byte	0xc
+	.long	0xc7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF28
+	.value	0x1f0
+	.byte	0xc
+	.long	0xc7
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF29
+	.value	0x1f5
+	.byte	0xc
+	.long	0xc7
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF30
+	.value	0x1fa
+	.byte	0xc
+	.long	0xc7
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF31
+	.value	0x1ff
+	.byte	0xc
+	.long	0xc7
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF32
+	.value	0x204
+	.byte	0xc
+	.long	0xc7
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF33
+	.value	0x209
+	.byte	0xc
+	.long	0xc7
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF34
+	.value	0x20e
+	.byte	0xc
+	.long	0xc7
+	.byte	0x38
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF35
+	.byte	0x38
+	.value	0x26c
+	.long	0x22a
+	.uleb128 0x5
+	.long	.LASF36
+	.value	0x272
+	.byte	0xd
+	.long	0x243
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF37
+	.value	0x277
+	.byte	0x9
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x20
+	.string	"fd"
+	.value	0x27c
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF38
+	.value	0x281
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF39
+	.value	0x286
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF40
+	.value	0x28b
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x20
+	.string	"eof"
+	.value	0x290
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF41
+	.value	0x295
+	.byte	0x7
+	.long	0x46
+	.byte	0x34
+	.byte	0
+	.uleb128 0x36
+	.long	0xa9
+	.long	0x243
+	.uleb128 0x9
+	.long	0x8a
+	.uleb128 0x9
+	.long	0x98
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	0x22a
+	.uleb128 0x21
+	.long	.LASF43
+	.long	0x69
+	.value	0x29b
+	.long	0x264
+	.uleb128 0xe
+	.long	.LASF44
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF45
+	.byte	0x1
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF46
+	.long	0x69
+	.value	0x2b5
+	.long	0x28c
+	.uleb128 0xe
+	.long	.LASF47
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF48
+	.byte	0x1
+	.uleb128 0xe
+	.long	.LASF49
+	.byte	0x2
+	.uleb128 0xe
+	.long	.LASF50
+	.byte	0x3
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF51
+	.value	0x158
+	.byte	0xb
+	.value	0x2cf
+	.byte	0x8
+	.long	0x33a
+	.uleb128 0x5
+	.long	.LASF52
+	.value	0x2d4
+	.byte	0x9
+	.long	0x98
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.value	0x2d9
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF54
+	.value	0x2de
+	.byte	0xa
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF55
+	.value	0x2e3
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF56
+	.value	0x2e8
+	.byte	0x1b
+	.long	0x248
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF57
+	.value	0x2ed
+	.byte	0xa
+	.long	0x2e
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF58
+	.value	0x2f2
+	.byte	0x18
+	.long	0x33a
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF59
+	.value	0x2f7
+	.byte	0x18
+	.long	0x264
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF60
+	.value	0x2fc
+	.byte	0x17
+	.long	0x33f
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF61
+	.value	0x301
+	.byte	0x8
+	.long	0x344
+	.byte	0x48
+	.uleb128 0x22
+	.long	.LASF62
+	.value	0x306
+	.byte	0x21
+	.long	0x3a2
+	.value	0x148
+	.uleb128 0x22
+	.long	.LASF63
+	.value	0x30b
+	.byte	0x17
+	.long	0x3a7
+	.value	0x150
+	.byte	0
+	.uleb128 0x8
+	.long	0x1b8
+	.uleb128 0x8
+	.long	0xfe
+	.uleb128 0x23
+	.long	0x9d
+	.long	0x354
+	.uleb128 0x24
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF64
+	.byte	0x28
+	.value	0x764
+	.long	0x3a2
+	.uleb128 0x5
+	.long	.LASF65
+	.value	0x769
+	.byte	0xb
+	.long	0x3b3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF66
+	.value	0x76e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF67
+	.value	0x774
+	.byte	0xd
+	.long	0x3b8
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF53
+	.value	0x779
+	.byte	0xa
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF68
+	.value	0x77e
+	.byte	0xa
+	.long	0x2e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	0x354
+	.uleb128 0x8
+	.long	0x143
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF69
+	.uleb128 0x8
+	.long	0x2e
+	.uleb128 0x8
+	.long	0xc7
+	.uleb128 0x8
+	.long	0x28c
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF70
+	.uleb128 0xc
+	.long	.LASF71
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x1c
+	.long	0x3d5
+	.uleb128 0x10
+	.long	0xb5
+	.long	0x3e1
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF72
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x3ed
+	.uleb128 0x10
+	.long	0x9d
+	.long	0x3f9
+	.uleb128 0xf
+	.byte	0xf
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF73
+	.byte	0x6
+	.byte	0x35
+	.byte	0x13
+	.long	0x40a
+	.uleb128 0x13
+	.long	0x3f9
+	.uleb128 0x10
+	.long	0x54
+	.long	0x416
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF77
+	.byte	0x6
+	.byte	0x39
+	.long	0x40a
+	.uleb128 0x13
+	.long	0x416
+	.uleb128 0xc
+	.long	.LASF74
+	.byte	0x5
+	.byte	0x2c
+	.byte	0x1c
+	.long	0x432
+	.uleb128 0x10
+	.long	0xb5
+	.long	0x43e
+	.uleb128 0xf
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF75
+	.byte	0x5
+	.byte	0x31
+	.byte	0xe
+	.long	0x44a
+	.uleb128 0x10
+	.long	0x9d
+	.long	0x456
+	.uleb128 0xf
+	.byte	0x1f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF76
+	.byte	0x5
+	.byte	0x39
+	.byte	0x13
+	.long	0x467
+	.uleb128 0x13
+	.long	0x456
+	.uleb128 0x10
+	.long	0x54
+	.long	0x473
+	.uleb128 0xf
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF78
+	.byte	0x5
+	.byte	0x42
+	.long	0x467
+	.uleb128 0x13
+	.long	0x473
+	.uleb128 0xc
+	.long	.LASF79
+	.byte	0x2
+	.byte	0x2e
+	.byte	0xe
+	.long	0x48f
+	.uleb128 0x10
+	.long	0x9d
+	.long	0x49b
+	.uleb128 0xf
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x10
+	.long	0x54
+	.long	0x4a7
+	.uleb128 0xf
+	.byte	0x7
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF80
+	.byte	0x2
+	.byte	0x39
+	.long	0x49b
+	.uleb128 0xc
+	.long	.LASF81
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1c
+	.long	0xb5
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x4
+	.long	.LASF82
+	.uleb128 0x38
+	.long	.LASF83
+	.byte	0x20
+	.byte	0x1
+	.byte	0x17
+	.byte	0x8
+	.long	0x4ff
+	.uleb128 0x1a
+	.long	.LASF84
+	.byte	0x1c
+	.long	0xc7
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF85
+	.byte	0x21
+	.long	0xc7
+	.byte	0x8
+	.uleb128 0x1a
+	.long	.LASF86
+	.byte	0x26
+	.long	0xc7
+	.byte	0x10
+	.uleb128 0x1a
+	.long	.LASF87
+	.byte	0x2b
+	.long	0xc7
+	.byte	0x18
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF91
+	.byte	0xb
+	.value	0x40b
+	.byte	0x6
+	.long	0x512
+	.uleb128 0x9
+	.long	0x3bd
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF88
+	.value	0x234
+	.long	0x8a
+	.long	0x52c
+	.uleb128 0x9
+	.long	0x8a
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF89
+	.byte	0x2b
+	.long	0x8a
+	.long	0x54a
+	.uleb128 0x9
+	.long	0x8a
+	.uleb128 0x9
+	.long	0xbc
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF90
+	.byte	0x3d
+	.long	0x8a
+	.long	0x568
+	.uleb128 0x9
+	.long	0x8a
+	.uleb128 0x9
+	.long	0x46
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF92
+	.byte	0xc
+	.value	0x238
+	.byte	0xd
+	.long	0x57b
+	.uleb128 0x9
+	.long	0x8a
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF93
+	.value	0x229
+	.long	0x8a
+	.long	0x590
+	.uleb128 0x9
+	.long	0x2e
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF94
+	.byte	0xb
+	.value	0x10d
+	.byte	0x14
+	.long	0xd3
+	.long	0x5a3
+	.uleb128 0x3a
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF98
+	.value	0x139
+	.quad	.LFB6415
+	.quad	.LFE6415-.LFB6415
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5f7
+	.uleb128 0x29
+	.long	.LASF100
+	.value	0x139
+	.byte	0x31
+	.long	0x3bd
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x11
+	.quad	.LVL212
+	.long	0x5f7
+	.uleb128 0x3b
+	.quad	.LVL216
+	.long	0x4ff
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF101
+	.byte	0x1
+	.value	0x116
+	.byte	0x8
+	.long	0x2e
+	.quad	.LFB6414
+	.quad	.LFE6414-.LFB6414
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x68a
+	.uleb128 0x2a
+	.long	.LASF95
+	.byte	0x39
+	.long	0x3a2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2a
+	.long	.LASF54
+	.byte	0x4d
+	.long	0x3a
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3d
+	.string	"low"
+	.byte	0x1
+	.value	0x117
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x1b
+	.long	.LASF96
+	.value	0x118
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x1b
+	.long	.LASF68
+	.value	0x119
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x16
+	.long	.LLRL158
+	.uleb128 0x1b
+	.long	.LASF97
+	.value	0x12a
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST159
+	.long	.LVUS159
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF99
+	.value	0x109
+	.quad	.LFB6413
+	.quad	.LFE6413-.LFB6413
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6fe
+	.uleb128 0x29
+	.long	.LASF100
+	.value	0x109
+	.byte	0x37
+	.long	0x3bd
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x1b
+	.long	.LASF95
+	.value	0x10a
+	.byte	0x21
+	.long	0x3a2
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x11
+	.quad	.LVL111
+	.long	0x568
+	.uleb128 0x11
+	.quad	.LVL112
+	.long	0x568
+	.uleb128 0x1c
+	.quad	.LVL113
+	.long	0x568
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF102
+	.byte	0x1
+	.byte	0xa1
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB6412
+	.quad	.LFE6412-.LFB6412
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa4d
+	.uleb128 0x12
+	.long	.LASF100
+	.byte	0xa1
+	.byte	0x37
+	.long	0x3bd
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x6
+	.long	.LASF103
+	.byte	0xa7
+	.byte	0xa
+	.long	0xa62
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x6
+	.long	.LASF53
+	.byte	0xb7
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x6
+	.long	.LASF104
+	.byte	0xb8
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x6
+	.long	.LASF39
+	.byte	0xb9
+	.byte	0xa
+	.long	0x2e
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x6
+	.long	.LASF95
+	.byte	0xba
+	.byte	0x21
+	.long	0x3a2
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x6
+	.long	.LASF105
+	.byte	0xca
+	.byte	0xc
+	.long	0xc7
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x6
+	.long	.LASF106
+	.byte	0xcb
+	.byte	0xc
+	.long	0xc7
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x6
+	.long	.LASF107
+	.byte	0xcc
+	.byte	0xc
+	.long	0xc7
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x2b
+	.long	.LASF110
+	.byte	0xcd
+	.byte	0x8
+	.long	0xa67
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.uleb128 0x14
+	.long	.LLRL137
+	.long	0x997
+	.uleb128 0x6
+	.long	.LASF108
+	.byte	0xce
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x16
+	.long	.LLRL139
+	.uleb128 0x6
+	.long	.LASF40
+	.byte	0xcf
+	.byte	0xc
+	.long	0x2e
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x6
+	.long	.LASF109
+	.byte	0xd0
+	.byte	0x11
+	.long	0xc2
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x2b
+	.long	.LASF111
+	.byte	0xd7
+	.byte	0x21
+	.long	0x4c5
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0x6
+	.long	.LASF112
+	.byte	0xda
+	.byte	0xe
+	.long	0xc7
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x6
+	.long	.LASF87
+	.byte	0xdb
+	.byte	0xe
+	.long	0xc7
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x6
+	.long	.LASF86
+	.byte	0xe8
+	.byte	0xe
+	.long	0xc7
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x6
+	.long	.LASF67
+	.byte	0xe9
+	.byte	0xe
+	.long	0xc7
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x6
+	.long	.LASF113
+	.byte	0xed
+	.byte	0xe
+	.long	0xc7
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x6
+	.long	.LASF114
+	.byte	0xee
+	.byte	0xe
+	.long	0xc7
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x6
+	.long	.LASF115
+	.byte	0xf0
+	.byte	0xe
+	.long	0xc7
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x14
+	.long	.LLRL149
+	.long	0x8d2
+	.uleb128 0x17
+	.string	"bit"
+	.byte	0xde
+	.byte	0xb
+	.long	0x46
+	.long	.LLST150
+	.long	.LVUS150
+	.byte	0
+	.uleb128 0x14
+	.long	.LLRL153
+	.long	0x92a
+	.uleb128 0x6
+	.long	.LASF65
+	.byte	0xf4
+	.byte	0xf
+	.long	0x3b3
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x11
+	.quad	.LVL175
+	.long	0x512
+	.uleb128 0x11
+	.quad	.LVL188
+	.long	0x568
+	.uleb128 0x11
+	.quad	.LVL189
+	.long	0x568
+	.uleb128 0x1c
+	.quad	.LVL190
+	.long	0x568
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0xa77
+	.quad	.LBI733
+	.value	.LVU816
+	.long	.LLRL151
+	.byte	0xe9
+	.byte	0x1a
+	.long	0x951
+	.uleb128 0x1
+	.long	0xa88
+	.long	.LLST152
+	.long	.LVUS152
+	.byte	0
+	.uleb128 0x3f
+	.quad	.LVL136
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 112
+	.byte	0x6
+	.long	0x96c
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 96
+	.byte	0x6
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL178
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1c
+	.quad	.LVL179
+	.long	0x1a21
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 88
+	.byte	0x6
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 152
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL119
+	.long	0x68a
+	.uleb128 0x11
+	.quad	.LVL120
+	.long	0x590
+	.uleb128 0x18
+	.quad	.LVL123
+	.long	0x57b
+	.long	0x9c9
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL126
+	.long	0x57b
+	.long	0x9e3
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL128
+	.long	0x57b
+	.long	0x9fb
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL135
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x18
+	.quad	.LVL184
+	.long	0x568
+	.long	0xa1e
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL185
+	.long	0x568
+	.long	0xa38
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 152
+	.byte	0x6
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL186
+	.long	0x568
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.long	0xa5d
+	.uleb128 0x9
+	.long	0xc2
+	.uleb128 0x9
+	.long	0xa5d
+	.byte	0
+	.uleb128 0x8
+	.long	0x4c5
+	.uleb128 0x8
+	.long	0xa4d
+	.uleb128 0x23
+	.long	0x9d
+	.long	0xa77
+	.uleb128 0x24
+	.long	0x3f
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF176
+	.byte	0x1
+	.byte	0x94
+	.byte	0x18
+	.long	0xc7
+	.byte	0x3
+	.long	0xa95
+	.uleb128 0x42
+	.long	.LASF123
+	.byte	0x1
+	.byte	0x94
+	.byte	0x3d
+	.long	0xc7
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF117
+	.byte	0x7f
+	.quad	.LFB6410
+	.quad	.LFE6410-.LFB6410
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xca9
+	.uleb128 0x12
+	.long	.LASF109
+	.byte	0x7f
+	.byte	0x3a
+	.long	0xc2
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x12
+	.long	.LASF111
+	.byte	0x7f
+	.byte	0x5e
+	.long	0xa5d
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x6
+	.long	.LASF116
+	.byte	0x80
+	.byte	0xb
+	.long	0xca9
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x2
+	.long	0x1598
+	.quad	.LBI213
+	.value	.LVU39
+	.long	.LLRL8
+	.byte	0x80
+	.byte	0x13
+	.long	0xb11
+	.uleb128 0x1
+	.long	0x15a8
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0x2
+	.long	0x1542
+	.quad	.LBI216
+	.value	.LVU43
+	.long	.LLRL10
+	.byte	0x81
+	.byte	0x17
+	.long	0xb3d
+	.uleb128 0x4
+	.long	0x155f
+	.uleb128 0x1
+	.long	0x1552
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.uleb128 0x2
+	.long	0x156d
+	.quad	.LBI222
+	.value	.LVU62
+	.long	.LLRL12
+	.byte	0x82
+	.byte	0x16
+	.long	0xb69
+	.uleb128 0x4
+	.long	0x158a
+	.uleb128 0x1
+	.long	0x157d
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.uleb128 0x2
+	.long	0x156d
+	.quad	.LBI229
+	.value	.LVU65
+	.long	.LLRL14
+	.byte	0x82
+	.byte	0x4d
+	.long	0xb95
+	.uleb128 0x4
+	.long	0x158a
+	.uleb128 0x1
+	.long	0x157d
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.uleb128 0x2
+	.long	0x156d
+	.quad	.LBI234
+	.value	.LVU68
+	.long	.LLRL16
+	.byte	0x83
+	.byte	0x7
+	.long	0xbc1
+	.uleb128 0x4
+	.long	0x158a
+	.uleb128 0x1
+	.long	0x157d
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.uleb128 0x2
+	.long	0x156d
+	.quad	.LBI242
+	.value	.LVU71
+	.long	.LLRL18
+	.byte	0x83
+	.byte	0x3e
+	.long	0xbed
+	.uleb128 0x4
+	.long	0x158a
+	.uleb128 0x1
+	.long	0x157d
+	.long	.LLST19
+	.long	.LVUS19
+	.byte	0
+	.uleb128 0x2
+	.long	0x156d
+	.quad	.LBI250
+	.value	.LVU74
+	.long	.LLRL20
+	.byte	0x84
+	.byte	0x7
+	.long	0xc19
+	.uleb128 0x4
+	.long	0x158a
+	.uleb128 0x1
+	.long	0x157d
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.uleb128 0x2
+	.long	0x156d
+	.quad	.LBI257
+	.value	.LVU78
+	.long	.LLRL22
+	.byte	0x84
+	.byte	0x3e
+	.long	0xc45
+	.uleb128 0x4
+	.long	0x158a
+	.uleb128 0x1
+	.long	0x157d
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.uleb128 0x2
+	.long	0x156d
+	.quad	.LBI275
+	.value	.LVU85
+	.long	.LLRL24
+	.byte	0x85
+	.byte	0x13
+	.long	0xc71
+	.uleb128 0x4
+	.long	0x158a
+	.uleb128 0x1
+	.long	0x157d
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.uleb128 0x2
+	.long	0x156d
+	.quad	.LBI278
+	.value	.LVU91
+	.long	.LLRL26
+	.byte	0x86
+	.byte	0x18
+	.long	0xc9d
+	.uleb128 0x4
+	.long	0x158a
+	.uleb128 0x1
+	.long	0x157d
+	.long	.LLST27
+	.long	.LVUS27
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL21
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF177
+	.long	0x54
+	.long	0xcb9
+	.uleb128 0xf
+	.byte	0x7
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF118
+	.byte	0x67
+	.quad	.LFB6409
+	.quad	.LFE6409-.LFB6409
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x10ba
+	.uleb128 0x12
+	.long	.LASF109
+	.byte	0x67
+	.byte	0x38
+	.long	0xc2
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x12
+	.long	.LASF111
+	.byte	0x67
+	.byte	0x5c
+	.long	0xa5d
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x2c
+	.long	.LASF120
+	.byte	0x68
+	.long	0x462
+	.uleb128 0x14
+	.long	.LLRL30
+	.long	0x10ae
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x6d
+	.byte	0xc
+	.long	0x46
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x16
+	.long	.LLRL32
+	.uleb128 0x6
+	.long	.LASF116
+	.byte	0x6e
+	.byte	0xd
+	.long	0x456
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x6
+	.long	.LASF85
+	.byte	0x6f
+	.byte	0xd
+	.long	0x456
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x2
+	.long	0x1646
+	.quad	.LBI287
+	.value	.LVU114
+	.long	.LLRL35
+	.byte	0x6f
+	.byte	0x19
+	.long	0xd76
+	.uleb128 0x4
+	.long	0x1661
+	.uleb128 0x1
+	.long	0x1655
+	.long	.LLST36
+	.long	.LVUS36
+	.byte	0
+	.uleb128 0x2
+	.long	0x1646
+	.quad	.LBI293
+	.value	.LVU120
+	.long	.LLRL37
+	.byte	0x6f
+	.byte	0x19
+	.long	0xda2
+	.uleb128 0x4
+	.long	0x1661
+	.uleb128 0x1
+	.long	0x1655
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.uleb128 0x2
+	.long	0x183d
+	.quad	.LBI299
+	.value	.LVU110
+	.long	.LLRL39
+	.byte	0x6e
+	.byte	0x15
+	.long	0xdc9
+	.uleb128 0x1
+	.long	0x184d
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.uleb128 0x2
+	.long	0x1646
+	.quad	.LBI306
+	.value	.LVU128
+	.long	.LLRL41
+	.byte	0x70
+	.byte	0x11
+	.long	0xdf5
+	.uleb128 0x4
+	.long	0x1661
+	.uleb128 0x1
+	.long	0x1655
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0x2
+	.long	0x1646
+	.quad	.LBI315
+	.value	.LVU135
+	.long	.LLRL43
+	.byte	0x71
+	.byte	0x11
+	.long	0xe21
+	.uleb128 0x4
+	.long	0x1661
+	.uleb128 0x1
+	.long	0x1655
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.uleb128 0x2
+	.long	0x15d2
+	.quad	.LBI325
+	.value	.LVU124
+	.long	.LLRL45
+	.byte	0x6f
+	.byte	0x19
+	.long	0xe55
+	.uleb128 0x1
+	.long	0x15ef
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x1
+	.long	0x15e2
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.uleb128 0x2
+	.long	0x15d2
+	.quad	.LBI329
+	.value	.LVU131
+	.long	.LLRL48
+	.byte	0x70
+	.byte	0x11
+	.long	0xe81
+	.uleb128 0x1
+	.long	0x15ef
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x4
+	.long	0x15e2
+	.byte	0
+	.uleb128 0x2
+	.long	0x15d2
+	.quad	.LBI333
+	.value	.LVU138
+	.long	.LLRL50
+	.byte	0x71
+	.byte	0x11
+	.long	0xead
+	.uleb128 0x1
+	.long	0x15ef
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x4
+	.long	0x15e2
+	.byte	0
+	.uleb128 0x2
+	.long	0x1646
+	.quad	.LBI336
+	.value	.LVU144
+	.long	.LLRL52
+	.byte	0x72
+	.byte	0x11
+	.long	0xed9
+	.uleb128 0x4
+	.long	0x1661
+	.uleb128 0x1
+	.long	0x1655
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.uleb128 0x2
+	.long	0x1646
+	.quad	.LBI343
+	.value	.LVU152
+	.long	.LLRL54
+	.byte	0x73
+	.byte	0x11
+	.long	0xf05
+	.uleb128 0x4
+	.long	0x1661
+	.uleb128 0x1
+	.long	0x1655
+	.long	.LLST55
+	.long	.LVUS55
+	.byte	0
+	.uleb128 0x2
+	.long	0x15d2
+	.quad	.LBI349
+	.value	.LVU148
+	.long	.LLRL56
+	.byte	0x72
+	.byte	0x11
+	.long	0xf31
+	.uleb128 0x1
+	.long	0x15ef
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x4
+	.long	0x15e2
+	.byte	0
+	.uleb128 0x2
+	.long	0x15d2
+	.quad	.LBI353
+	.value	.LVU155
+	.long	.LLRL58
+	.byte	0x73
+	.byte	0x11
+	.long	0xf5d
+	.uleb128 0x1
+	.long	0x15ef
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x4
+	.long	0x15e2
+	.byte	0
+	.uleb128 0x2
+	.long	0x161b
+	.quad	.LBI357
+	.value	.LVU162
+	.long	.LLRL60
+	.byte	0x74
+	.byte	0x32
+	.long	0xf89
+	.uleb128 0x4
+	.long	0x1638
+	.uleb128 0x1
+	.long	0x162b
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.uleb128 0x2
+	.long	0x1646
+	.quad	.LBI364
+	.value	.LVU166
+	.long	.LLRL62
+	.byte	0x74
+	.byte	0x32
+	.long	0xfbd
+	.uleb128 0x1
+	.long	0x1661
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x1
+	.long	0x1655
+	.long	.LLST64
+	.long	.LVUS64
+	.byte	0
+	.uleb128 0x2
+	.long	0x15fd
+	.quad	.LBI368
+	.value	.LVU170
+	.long	.LLRL65
+	.byte	0x74
+	.byte	0x32
+	.long	0xfe4
+	.uleb128 0x1
+	.long	0x160d
+	.long	.LLST66
+	.long	.LVUS66
+	.byte	0
+	.uleb128 0x2
+	.long	0x15fd
+	.quad	.LBI372
+	.value	.LVU178
+	.long	.LLRL67
+	.byte	0x75
+	.byte	0x31
+	.long	0x100b
+	.uleb128 0x1
+	.long	0x160d
+	.long	.LLST68
+	.long	.LVUS68
+	.byte	0
+	.uleb128 0x2
+	.long	0x1646
+	.quad	.LBI379
+	.value	.LVU182
+	.long	.LLRL69
+	.byte	0x76
+	.byte	0x2e
+	.long	0x1037
+	.uleb128 0x4
+	.long	0x1661
+	.uleb128 0x1
+	.long	0x1655
+	.long	.LLST70
+	.long	.LVUS70
+	.byte	0
+	.uleb128 0x2
+	.long	0x15fd
+	.quad	.LBI383
+	.value	.LVU187
+	.long	.LLRL71
+	.byte	0x76
+	.byte	0x2e
+	.long	0x105e
+	.uleb128 0x1
+	.long	0x160d
+	.long	.LLST72
+	.long	.LVUS72
+	.byte	0
+	.uleb128 0x2
+	.long	0x1646
+	.quad	.LBI389
+	.value	.LVU194
+	.long	.LLRL73
+	.byte	0x77
+	.byte	0x33
+	.long	0x108a
+	.uleb128 0x4
+	.long	0x1661
+	.uleb128 0x1
+	.long	0x1655
+	.long	.LLST74
+	.long	.LVUS74
+	.byte	0
+	.uleb128 0x2d
+	.long	0x15fd
+	.quad	.LBI396
+	.value	.LVU198
+	.long	.LLRL75
+	.byte	0x77
+	.uleb128 0x1
+	.long	0x160d
+	.long	.LLST76
+	.long	.LVUS76
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL49
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF119
+	.byte	0x4e
+	.quad	.LFB6408
+	.quad	.LFE6408-.LFB6408
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14bb
+	.uleb128 0x12
+	.long	.LASF109
+	.byte	0x4e
+	.byte	0x38
+	.long	0xc2
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x12
+	.long	.LASF111
+	.byte	0x4e
+	.byte	0x5c
+	.long	0xa5d
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x2c
+	.long	.LASF120
+	.byte	0x4f
+	.long	0x405
+	.uleb128 0x14
+	.long	.LLRL79
+	.long	0x14af
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x54
+	.byte	0xc
+	.long	0x46
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x16
+	.long	.LLRL81
+	.uleb128 0x6
+	.long	.LASF116
+	.byte	0x55
+	.byte	0xd
+	.long	0x3f9
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x6
+	.long	.LASF85
+	.byte	0x56
+	.byte	0xd
+	.long	0x3f9
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x2
+	.long	0x18a9
+	.quad	.LBI446
+	.value	.LVU313
+	.long	.LLRL84
+	.byte	0x56
+	.byte	0x19
+	.long	0x1177
+	.uleb128 0x4
+	.long	0x18c6
+	.uleb128 0x1
+	.long	0x18b9
+	.long	.LLST85
+	.long	.LVUS85
+	.byte	0
+	.uleb128 0x2
+	.long	0x18a9
+	.quad	.LBI456
+	.value	.LVU319
+	.long	.LLRL86
+	.byte	0x56
+	.byte	0x19
+	.long	0x11a3
+	.uleb128 0x4
+	.long	0x18c6
+	.uleb128 0x1
+	.long	0x18b9
+	.long	.LLST87
+	.long	.LVUS87
+	.byte	0
+	.uleb128 0x2
+	.long	0x18ff
+	.quad	.LBI465
+	.value	.LVU309
+	.long	.LLRL88
+	.byte	0x55
+	.byte	0x15
+	.long	0x11ca
+	.uleb128 0x1
+	.long	0x190f
+	.long	.LLST89
+	.long	.LVUS89
+	.byte	0
+	.uleb128 0x2
+	.long	0x18a9
+	.quad	.LBI476
+	.value	.LVU327
+	.long	.LLRL90
+	.byte	0x57
+	.byte	0x11
+	.long	0x11f6
+	.uleb128 0x4
+	.long	0x18c6
+	.uleb128 0x1
+	.long	0x18b9
+	.long	.LLST91
+	.long	.LVUS91
+	.byte	0
+	.uleb128 0x2
+	.long	0x18a9
+	.quad	.LBI489
+	.value	.LVU334
+	.long	.LLRL92
+	.byte	0x58
+	.byte	0x11
+	.long	0x1222
+	.uleb128 0x4
+	.long	0x18c6
+	.uleb128 0x1
+	.long	0x18b9
+	.long	.LLST93
+	.long	.LVUS93
+	.byte	0
+	.uleb128 0x2
+	.long	0x18d4
+	.quad	.LBI503
+	.value	.LVU323
+	.long	.LLRL94
+	.byte	0x56
+	.byte	0x19
+	.long	0x1256
+	.uleb128 0x1
+	.long	0x18f1
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x1
+	.long	0x18e4
+	.long	.LLST96
+	.long	.LVUS96
+	.byte	0
+	.uleb128 0x2
+	.long	0x18d4
+	.quad	.LBI509
+	.value	.LVU330
+	.long	.LLRL97
+	.byte	0x57
+	.byte	0x11
+	.long	0x1282
+	.uleb128 0x1
+	.long	0x18f1
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x4
+	.long	0x18e4
+	.byte	0
+	.uleb128 0x2
+	.long	0x18d4
+	.quad	.LBI515
+	.value	.LVU337
+	.long	.LLRL99
+	.byte	0x58
+	.byte	0x11
+	.long	0x12ae
+	.uleb128 0x1
+	.long	0x18f1
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x4
+	.long	0x18e4
+	.byte	0
+	.uleb128 0x2
+	.long	0x18a9
+	.quad	.LBI520
+	.value	.LVU343
+	.long	.LLRL101
+	.byte	0x59
+	.byte	0x11
+	.long	0x12da
+	.uleb128 0x4
+	.long	0x18c6
+	.uleb128 0x1
+	.long	0x18b9
+	.long	.LLST102
+	.long	.LVUS102
+	.byte	0
+	.uleb128 0x2
+	.long	0x18a9
+	.quad	.LBI529
+	.value	.LVU351
+	.long	.LLRL103
+	.byte	0x5a
+	.byte	0x11
+	.long	0x1306
+	.uleb128 0x4
+	.long	0x18c6
+	.uleb128 0x1
+	.long	0x18b9
+	.long	.LLST104
+	.long	.LVUS104
+	.byte	0
+	.uleb128 0x2
+	.long	0x18d4
+	.quad	.LBI537
+	.value	.LVU347
+	.long	.LLRL105
+	.byte	0x59
+	.byte	0x11
+	.long	0x1332
+	.uleb128 0x1
+	.long	0x18f1
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x4
+	.long	0x18e4
+	.byte	0
+	.uleb128 0x2
+	.long	0x18d4
+	.quad	.LBI543
+	.value	.LVU354
+	.long	.LLRL107
+	.byte	0x5a
+	.byte	0x11
+	.long	0x135e
+	.uleb128 0x1
+	.long	0x18f1
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x4
+	.long	0x18e4
+	.byte	0
+	.uleb128 0x2
+	.long	0x187e
+	.quad	.LBI550
+	.value	.LVU361
+	.long	.LLRL109
+	.byte	0x5c
+	.byte	0x32
+	.long	0x138a
+	.uleb128 0x4
+	.long	0x189b
+	.uleb128 0x1
+	.long	0x188e
+	.long	.LLST110
+	.long	.LVUS110
+	.byte	0
+	.uleb128 0x2
+	.long	0x18a9
+	.quad	.LBI559
+	.value	.LVU365
+	.long	.LLRL111
+	.byte	0x5c
+	.byte	0x32
+	.long	0x13be
+	.uleb128 0x1
+	.long	0x18c6
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x1
+	.long	0x18b9
+	.long	.LLST113
+	.long	.LVUS113
+	.byte	0
+	.uleb128 0x2
+	.long	0x1860
+	.quad	.LBI565
+	.value	.LVU369
+	.long	.LLRL114
+	.byte	0x5c
+	.byte	0x32
+	.long	0x13e5
+	.uleb128 0x1
+	.long	0x1870
+	.long	.LLST115
+	.long	.LVUS115
+	.byte	0
+	.uleb128 0x2
+	.long	0x18a9
+	.quad	.LBI574
+	.value	.LVU386
+	.long	.LLRL116
+	.byte	0x5e
+	.byte	0x2e
+	.long	0x1411
+	.uleb128 0x4
+	.long	0x18c6
+	.uleb128 0x1
+	.long	0x18b9
+	.long	.LLST117
+	.long	.LVUS117
+	.byte	0
+	.uleb128 0x2
+	.long	0x18a9
+	.quad	.LBI585
+	.value	.LVU398
+	.long	.LLRL118
+	.byte	0x5f
+	.byte	0x33
+	.long	0x143d
+	.uleb128 0x4
+	.long	0x18c6
+	.uleb128 0x1
+	.long	0x18b9
+	.long	.LLST119
+	.long	.LVUS119
+	.byte	0
+	.uleb128 0x2
+	.long	0x1860
+	.quad	.LBI596
+	.value	.LVU381
+	.long	.LLRL120
+	.byte	0x5d
+	.byte	0x31
+	.long	0x1464
+	.uleb128 0x1
+	.long	0x1870
+	.long	.LLST121
+	.long	.LVUS121
+	.byte	0
+	.uleb128 0x2
+	.long	0x1860
+	.quad	.LBI604
+	.value	.LVU390
+	.long	.LLRL122
+	.byte	0x5e
+	.byte	0x2e
+	.long	0x148b
+	.uleb128 0x1
+	.long	0x1870
+	.long	.LLST123
+	.long	.LVUS123
+	.byte	0
+	.uleb128 0x2d
+	.long	0x1860
+	.quad	.LBI616
+	.value	.LVU401
+	.long	.LLRL124
+	.byte	0x5f
+	.uleb128 0x1
+	.long	0x1870
+	.long	.LLST125
+	.long	.LVUS125
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL107
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF121
+	.byte	0x31
+	.quad	.LFB6407
+	.quad	.LFE6407-.LFB6407
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1542
+	.uleb128 0x2e
+	.long	.LASF109
+	.byte	0x3a
+	.long	0xc2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2e
+	.long	.LASF111
+	.byte	0x5e
+	.long	0xa5d
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x14
+	.long	.LLRL0
+	.long	0x1536
+	.uleb128 0x17
+	.string	"i"
+	.byte	0x36
+	.byte	0xc
+	.long	0x46
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x16
+	.long	.LLRL2
+	.uleb128 0x6
+	.long	.LASF122
+	.byte	0x37
+	.byte	0x13
+	.long	0x5b
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x17
+	.string	"bit"
+	.byte	0x38
+	.byte	0xe
+	.long	0xc7
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL10
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF124
+	.byte	0x3
+	.value	0xa13
+	.long	0x4b2
+	.long	0x156d
+	.uleb128 0x7
+	.string	"__X"
+	.byte	0x3
+	.value	0xa13
+	.byte	0x21
+	.long	0xca9
+	.uleb128 0x7
+	.string	"__Y"
+	.byte	0x3
+	.value	0xa13
+	.byte	0x2e
+	.long	0xca9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF125
+	.byte	0x3
+	.value	0x675
+	.long	0x4b2
+	.long	0x1598
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x3
+	.value	0x675
+	.byte	0x21
+	.long	0xca9
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x3
+	.value	0x675
+	.byte	0x2e
+	.long	0xca9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF126
+	.byte	0x2
+	.value	0x195a
+	.long	0xca9
+	.long	0x15b6
+	.uleb128 0x7
+	.string	"__P"
+	.byte	0x2
+	.value	0x195a
+	.byte	0x21
+	.long	0xbc
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF127
+	.byte	0x2
+	.byte	0xd6
+	.long	0xca9
+	.long	0x15d2
+	.uleb128 0x1f
+	.string	"__A"
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x18
+	.long	0x9d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF128
+	.byte	0x4
+	.value	0x23e
+	.long	0x456
+	.long	0x15fd
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x4
+	.value	0x23e
+	.byte	0x1a
+	.long	0x456
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x4
+	.value	0x23e
+	.byte	0x27
+	.long	0x456
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF129
+	.byte	0x4
+	.value	0x1b1
+	.long	0x46
+	.long	0x161b
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x4
+	.value	0x1b1
+	.byte	0x1f
+	.long	0x456
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF130
+	.byte	0x4
+	.value	0x19c
+	.long	0x456
+	.long	0x1646
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x4
+	.value	0x19c
+	.byte	0x1a
+	.long	0x456
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x4
+	.value	0x19c
+	.byte	0x27
+	.long	0x456
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF131
+	.byte	0x4
+	.byte	0xe7
+	.long	0x456
+	.long	0x166e
+	.uleb128 0x1f
+	.string	"__A"
+	.byte	0x4
+	.byte	0xe7
+	.byte	0x1c
+	.long	0x456
+	.uleb128 0x1f
+	.string	"__B"
+	.byte	0x4
+	.byte	0xe7
+	.byte	0x29
+	.long	0x456
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF132
+	.byte	0x5
+	.value	0x53c
+	.long	0x456
+	.long	0x168c
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x5
+	.value	0x53c
+	.byte	0x18
+	.long	0x9d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF133
+	.byte	0x5
+	.value	0x505
+	.long	0x456
+	.long	0x183d
+	.uleb128 0x3
+	.long	.LASF134
+	.byte	0x5
+	.value	0x505
+	.byte	0x17
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF135
+	.byte	0x5
+	.value	0x505
+	.byte	0x23
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF136
+	.byte	0x5
+	.value	0x505
+	.byte	0x2f
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF137
+	.byte	0x5
+	.value	0x505
+	.byte	0x3b
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF138
+	.byte	0x5
+	.value	0x506
+	.byte	0xa
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF139
+	.byte	0x5
+	.value	0x506
+	.byte	0x16
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF140
+	.byte	0x5
+	.value	0x506
+	.byte	0x22
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF141
+	.byte	0x5
+	.value	0x506
+	.byte	0x2e
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF142
+	.byte	0x5
+	.value	0x507
+	.byte	0xa
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF143
+	.byte	0x5
+	.value	0x507
+	.byte	0x16
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF144
+	.byte	0x5
+	.value	0x507
+	.byte	0x22
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF145
+	.byte	0x5
+	.value	0x507
+	.byte	0x2e
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF146
+	.byte	0x5
+	.value	0x508
+	.byte	0xa
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF147
+	.byte	0x5
+	.value	0x508
+	.byte	0x16
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF148
+	.byte	0x5
+	.value	0x508
+	.byte	0x22
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF149
+	.byte	0x5
+	.value	0x508
+	.byte	0x2e
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF150
+	.byte	0x5
+	.value	0x509
+	.byte	0xa
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF151
+	.byte	0x5
+	.value	0x509
+	.byte	0x16
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF152
+	.byte	0x5
+	.value	0x509
+	.byte	0x22
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF153
+	.byte	0x5
+	.value	0x509
+	.byte	0x2e
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF154
+	.byte	0x5
+	.value	0x50a
+	.byte	0xa
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF155
+	.byte	0x5
+	.value	0x50a
+	.byte	0x16
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF156
+	.byte	0x5
+	.value	0x50a
+	.byte	0x22
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF157
+	.byte	0x5
+	.value	0x50a
+	.byte	0x2e
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF158
+	.byte	0x5
+	.value	0x50b
+	.byte	0xa
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF159
+	.byte	0x5
+	.value	0x50b
+	.byte	0x16
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF160
+	.byte	0x5
+	.value	0x50b
+	.byte	0x22
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF161
+	.byte	0x5
+	.value	0x50b
+	.byte	0x2e
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF162
+	.byte	0x5
+	.value	0x50c
+	.byte	0xa
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF163
+	.byte	0x5
+	.value	0x50c
+	.byte	0x16
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF164
+	.byte	0x5
+	.value	0x50c
+	.byte	0x22
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF165
+	.byte	0x5
+	.value	0x50c
+	.byte	0x2e
+	.long	0x9d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF166
+	.byte	0x5
+	.value	0x39f
+	.long	0x456
+	.long	0x185b
+	.uleb128 0x7
+	.string	"__P"
+	.byte	0x5
+	.value	0x39f
+	.byte	0x26
+	.long	0x185b
+	.byte	0
+	.uleb128 0x8
+	.long	0x47e
+	.uleb128 0xa
+	.long	.LASF167
+	.byte	0x6
+	.value	0x597
+	.long	0x46
+	.long	0x187e
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x6
+	.value	0x597
+	.byte	0x1c
+	.long	0x3f9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF168
+	.byte	0x6
+	.value	0x591
+	.long	0x3f9
+	.long	0x18a9
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x6
+	.value	0x591
+	.byte	0x17
+	.long	0x3f9
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x6
+	.value	0x591
+	.byte	0x24
+	.long	0x3f9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF169
+	.byte	0x6
+	.value	0x535
+	.long	0x3f9
+	.long	0x18d4
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x6
+	.value	0x535
+	.byte	0x19
+	.long	0x3f9
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x6
+	.value	0x535
+	.byte	0x26
+	.long	0x3f9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF170
+	.byte	0x6
+	.value	0x529
+	.long	0x3f9
+	.long	0x18ff
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x6
+	.value	0x529
+	.byte	0x17
+	.long	0x3f9
+	.uleb128 0x7
+	.string	"__B"
+	.byte	0x6
+	.value	0x529
+	.byte	0x24
+	.long	0x3f9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF171
+	.byte	0x6
+	.value	0x2bd
+	.long	0x3f9
+	.long	0x191d
+	.uleb128 0x7
+	.string	"__P"
+	.byte	0x6
+	.value	0x2bd
+	.byte	0x23
+	.long	0x191d
+	.byte	0
+	.uleb128 0x8
+	.long	0x421
+	.uleb128 0xa
+	.long	.LASF172
+	.byte	0x6
+	.value	0x28e
+	.long	0x3f9
+	.long	0x1940
+	.uleb128 0x7
+	.string	"__A"
+	.byte	0x6
+	.value	0x28e
+	.byte	0x15
+	.long	0x9d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF173
+	.byte	0x6
+	.value	0x268
+	.long	0x3f9
+	.long	0x1a21
+	.uleb128 0x3
+	.long	.LASF150
+	.byte	0x6
+	.value	0x268
+	.byte	0x14
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF151
+	.byte	0x6
+	.value	0x268
+	.byte	0x20
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF152
+	.byte	0x6
+	.value	0x268
+	.byte	0x2c
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF153
+	.byte	0x6
+	.value	0x268
+	.byte	0x38
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF154
+	.byte	0x6
+	.value	0x269
+	.byte	0xd
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF155
+	.byte	0x6
+	.value	0x269
+	.byte	0x19
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF156
+	.byte	0x6
+	.value	0x269
+	.byte	0x25
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF157
+	.byte	0x6
+	.value	0x269
+	.byte	0x31
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF158
+	.byte	0x6
+	.value	0x26a
+	.byte	0xd
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF159
+	.byte	0x6
+	.value	0x26a
+	.byte	0x19
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF160
+	.byte	0x6
+	.value	0x26a
+	.byte	0x25
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF161
+	.byte	0x6
+	.value	0x26a
+	.byte	0x31
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF162
+	.byte	0x6
+	.value	0x26b
+	.byte	0xd
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF163
+	.byte	0x6
+	.value	0x26b
+	.byte	0x19
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF164
+	.byte	0x6
+	.value	0x26b
+	.byte	0x25
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF165
+	.byte	0x6
+	.value	0x26b
+	.byte	0x31
+	.long	0x9d
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF89
+	.long	.LASF178
+	.byte	0xe
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 278
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 51
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS160:
+	.uleb128 0
+	.uleb128 .LVU971
+	.uleb128 .LVU971
+	.uleb128 .LVU976
+	.uleb128 .LVU976
+	.uleb128 .LVU977
+	.uleb128 .LVU977
+	.uleb128 .LVU979
+	.uleb128 .LVU979
+	.uleb128 .LVU980
+	.uleb128 .LVU980
+	.uleb128 0
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 .LFE6415-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU917
+	.uleb128 .LVU924
+	.uleb128 .LVU924
+	.uleb128 .LVU944
+	.uleb128 .LVU945
+	.uleb128 .LVU956
+	.uleb128 .LVU956
+	.uleb128 0
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LFE6414-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU919
+	.uleb128 .LVU924
+	.uleb128 .LVU924
+	.uleb128 .LVU941
+	.uleb128 .LVU942
+	.uleb128 .LVU944
+	.uleb128 .LVU945
+	.uleb128 .LVU960
+	.uleb128 .LVU960
+	.uleb128 .LVU964
+	.uleb128 .LVU964
+	.uleb128 0
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LFE6414-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU921
+	.uleb128 .LVU923
+	.uleb128 .LVU923
+	.uleb128 .LVU936
+	.uleb128 .LVU939
+	.uleb128 .LVU942
+	.uleb128 .LVU945
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 .LVU962
+	.uleb128 .LVU962
+	.uleb128 .LVU964
+	.uleb128 .LVU964
+	.uleb128 .LVU965
+	.uleb128 .LVU965
+	.uleb128 0
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LFE6414-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 32
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU929
+	.uleb128 .LVU932
+	.uleb128 .LVU939
+	.uleb128 .LVU942
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS126:
+	.uleb128 0
+	.uleb128 .LVU692
+	.uleb128 .LVU692
+	.uleb128 .LVU697
+	.uleb128 .LVU697
+	.uleb128 0
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LFE6413-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU689
+	.uleb128 .LVU698
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS128:
+	.uleb128 0
+	.uleb128 .LVU705
+	.uleb128 .LVU705
+	.uleb128 .LVU706
+	.uleb128 .LVU706
+	.uleb128 .LVU707
+	.uleb128 .LVU707
+	.uleb128 .LVU873
+	.uleb128 .LVU873
+	.uleb128 .LVU874
+	.uleb128 .LVU874
+	.uleb128 .LVU875
+	.uleb128 .LVU875
+	.uleb128 0
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 120
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL119-1-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 120
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 -40
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x88
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x8
+	.byte	0x77
+	.sleb128 -48
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x88
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LFE6412-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 120
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU708
+	.uleb128 .LVU715
+	.uleb128 .LVU715
+	.uleb128 .LVU872
+	.uleb128 .LVU875
+	.uleb128 0
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	structural_index_classify_scalar
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 112
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LFE6412-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 112
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU722
+	.uleb128 .LVU755
+	.uleb128 .LVU755
+	.uleb128 .LVU760
+	.uleb128 .LVU903
+	.uleb128 .LVU910
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 152
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU727
+	.uleb128 .LVU751
+	.uleb128 .LVU751
+	.uleb128 .LVU755
+	.uleb128 .LVU755
+	.uleb128 .LVU760
+	.uleb128 .LVU903
+	.uleb128 .LVU910
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 63
+	.byte	0x36
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x9
+	.byte	0x77
+	.sleb128 152
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x3f
+	.byte	0x36
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU728
+	.uleb128 .LVU737
+	.uleb128 .LVU737
+	.uleb128 .LVU864
+	.uleb128 .LVU866
+	.uleb128 .LVU867
+	.uleb128 .LVU875
+	.uleb128 .LVU884
+	.uleb128 .LVU884
+	.uleb128 .LVU886
+	.uleb128 .LVU886
+	.uleb128 0
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LFE6412-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU730
+	.uleb128 .LVU734
+	.uleb128 .LVU734
+	.uleb128 .LVU760
+	.uleb128 .LVU760
+	.uleb128 .LVU867
+	.uleb128 .LVU867
+	.uleb128 .LVU872
+	.uleb128 .LVU875
+	.uleb128 .LVU903
+	.uleb128 .LVU903
+	.uleb128 .LVU910
+	.uleb128 .LVU910
+	.uleb128 0
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL126-1-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LFE6412-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU749
+	.uleb128 .LVU760
+	.uleb128 .LVU760
+	.uleb128 .LVU773
+	.uleb128 .LVU773
+	.uleb128 .LVU798
+	.uleb128 .LVU798
+	.uleb128 .LVU867
+	.uleb128 .LVU875
+	.uleb128 .LVU879
+	.uleb128 .LVU879
+	.uleb128 .LVU900
+	.uleb128 .LVU900
+	.uleb128 .LVU903
+	.uleb128 .LVU910
+	.uleb128 0
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LFE6412-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU749
+	.uleb128 .LVU760
+	.uleb128 .LVU760
+	.uleb128 .LVU829
+	.uleb128 .LVU829
+	.uleb128 .LVU834
+	.uleb128 .LVU834
+	.uleb128 .LVU867
+	.uleb128 .LVU875
+	.uleb128 .LVU903
+	.uleb128 .LVU910
+	.uleb128 0
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 144
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 144
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 144
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LFE6412-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 144
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU749
+	.uleb128 .LVU760
+	.uleb128 .LVU760
+	.uleb128 .LVU850
+	.uleb128 .LVU850
+	.uleb128 .LVU854
+	.uleb128 .LVU854
+	.uleb128 .LVU867
+	.uleb128 .LVU875
+	.uleb128 .LVU879
+	.uleb128 .LVU879
+	.uleb128 .LVU888
+	.uleb128 .LVU888
+	.uleb128 .LVU903
+	.uleb128 .LVU910
+	.uleb128 0
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL175-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL175-1-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LFE6412-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU749
+	.uleb128 .LVU760
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU763
+	.uleb128 .LVU867
+	.uleb128 .LVU875
+	.uleb128 .LVU903
+	.uleb128 .LVU910
+	.uleb128 0
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LFE6412-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU765
+	.uleb128 .LVU769
+	.uleb128 .LVU892
+	.uleb128 .LVU897
+	.uleb128 .LVU897
+	.uleb128 .LVU898
+	.uleb128 .LVU899
+	.uleb128 .LVU900
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL179-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x4
+	.byte	0x77
+	.sleb128 192
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU770
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 .LVU798
+	.uleb128 .LVU875
+	.uleb128 .LVU876
+	.uleb128 .LVU876
+	.uleb128 .LVU878
+	.uleb128 .LVU878
+	.uleb128 .LVU879
+	.uleb128 .LVU900
+	.uleb128 .LVU901
+	.uleb128 .LVU901
+	.uleb128 .LVU903
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU772
+	.uleb128 .LVU775
+	.uleb128 .LVU775
+	.uleb128 .LVU798
+	.uleb128 .LVU875
+	.uleb128 .LVU879
+	.uleb128 .LVU900
+	.uleb128 .LVU903
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x77
+	.sleb128 184
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU815
+	.uleb128 .LVU828
+	.uleb128 .LVU828
+	.uleb128 .LVU854
+	.uleb128 .LVU879
+	.uleb128 .LVU888
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL175-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU824
+	.uleb128 .LVU843
+	.uleb128 .LVU843
+	.uleb128 .LVU854
+	.uleb128 .LVU879
+	.uleb128 .LVU888
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 16
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL175-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 16
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU838
+	.uleb128 .LVU848
+	.uleb128 .LVU848
+	.uleb128 .LVU854
+	.uleb128 .LVU879
+	.uleb128 .LVU888
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x17
+	.byte	0x7d
+	.sleb128 16
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0x20
+	.byte	0x78
+	.sleb128 0
+	.byte	0x20
+	.byte	0x77
+	.sleb128 160
+	.byte	0x6
+	.byte	0x20
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x20
+	.byte	0x1a
+	.byte	0x1a
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL175-1-.Ltext0
+	.uleb128 0x17
+	.byte	0x7d
+	.sleb128 16
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0x20
+	.byte	0x78
+	.sleb128 0
+	.byte	0x20
+	.byte	0x77
+	.sleb128 160
+	.byte	0x6
+	.byte	0x20
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x20
+	.byte	0x1a
+	.byte	0x1a
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU846
+	.uleb128 .LVU854
+	.uleb128 .LVU879
+	.uleb128 .LVU883
+	.uleb128 .LVU883
+	.uleb128 .LVU887
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1e
+	.byte	0x7d
+	.sleb128 16
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x6
+	.byte	0x20
+	.byte	0x78
+	.sleb128 0
+	.byte	0x20
+	.byte	0x77
+	.sleb128 160
+	.byte	0x6
+	.byte	0x20
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x20
+	.byte	0x1a
+	.byte	0x1a
+	.byte	0x1a
+	.byte	0x31
+	.byte	0x24
+	.byte	0x20
+	.byte	0x74
+	.sleb128 0
+	.byte	0x20
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU852
+	.uleb128 .LVU862
+	.uleb128 .LVU862
+	.uleb128 .LVU863
+	.uleb128 .LVU863
+	.uleb128 .LVU864
+	.uleb128 .LVU879
+	.uleb128 .LVU888
+	.uleb128 .LVU888
+	.uleb128 .LVU892
+	.uleb128 .LVU910
+	.uleb128 0
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL175-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL175-1-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LFE6412-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 80
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU778
+	.uleb128 .LVU782
+	.uleb128 .LVU784
+	.uleb128 .LVU790
+	.uleb128 .LVU875
+	.uleb128 .LVU879
+	.uleb128 .LVU902
+	.uleb128 .LVU903
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU888
+	.uleb128 .LVU892
+	.uleb128 .LVU910
+	.uleb128 .LVU911
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU816
+	.uleb128 .LVU818
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE6410-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LFE6410-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU41
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE6410-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU39
+	.uleb128 .LVU41
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU43
+	.uleb128 .LVU49
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU62
+	.uleb128 .LVU64
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU64
+	.uleb128 .LVU67
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU67
+	.uleb128 .LVU70
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU70
+	.uleb128 .LVU73
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU73
+	.uleb128 .LVU77
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU77
+	.uleb128 .LVU82
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU85
+	.uleb128 .LVU88
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU91
+	.uleb128 .LVU93
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE6409-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LFE6409-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU108
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU293
+	.uleb128 .LVU293
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE6409-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU112
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU205
+	.uleb128 .LVU211
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 .LVU291
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU160
+	.uleb128 .LVU185
+	.uleb128 .LVU255
+	.uleb128 .LVU279
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU114
+	.uleb128 .LVU119
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 32
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU119
+	.uleb128 .LVU123
+	.uleb128 .LVU217
+	.uleb128 .LVU220
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 32
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU110
+	.uleb128 .LVU112
+	.uleb128 .LVU209
+	.uleb128 .LVU211
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU128
+	.uleb128 .LVU130
+	.uleb128 .LVU225
+	.uleb128 .LVU227
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 32
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU135
+	.uleb128 .LVU137
+	.uleb128 .LVU232
+	.uleb128 .LVU234
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 32
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU123
+	.uleb128 .LVU126
+	.uleb128 .LVU220
+	.uleb128 .LVU223
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU123
+	.uleb128 .LVU126
+	.uleb128 .LVU220
+	.uleb128 .LVU223
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU130
+	.uleb128 .LVU133
+	.uleb128 .LVU227
+	.uleb128 .LVU230
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU137
+	.uleb128 .LVU140
+	.uleb128 .LVU234
+	.uleb128 .LVU239
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU144
+	.uleb128 .LVU147
+	.uleb128 .LVU242
+	.uleb128 .LVU244
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 32
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU152
+	.uleb128 .LVU154
+	.uleb128 .LVU249
+	.uleb128 .LVU251
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 32
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU147
+	.uleb128 .LVU150
+	.uleb128 .LVU244
+	.uleb128 .LVU247
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU154
+	.uleb128 .LVU160
+	.uleb128 .LVU251
+	.uleb128 .LVU255
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU162
+	.uleb128 .LVU165
+	.uleb128 .LVU257
+	.uleb128 .LVU259
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 32
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU165
+	.uleb128 .LVU169
+	.uleb128 .LVU259
+	.uleb128 .LVU262
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 32
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU165
+	.uleb128 .LVU169
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU169
+	.uleb128 .LVU176
+	.uleb128 .LVU262
+	.uleb128 .LVU266
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU178
+	.uleb128 .LVU180
+	.uleb128 .LVU268
+	.uleb128 .LVU271
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU182
+	.uleb128 .LVU186
+	.uleb128 .LVU273
+	.uleb128 .LVU275
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU186
+	.uleb128 .LVU192
+	.uleb128 .LVU275
+	.uleb128 .LVU279
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU194
+	.uleb128 .LVU197
+	.uleb128 .LVU281
+	.uleb128 .LVU283
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU197
+	.uleb128 .LVU202
+	.uleb128 .LVU283
+	.uleb128 .LVU286
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS77:
+	.uleb128 0
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU656
+	.uleb128 .LVU656
+	.uleb128 0
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LFE6408-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 0
+	.uleb128 .LVU375
+	.uleb128 .LVU375
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE6408-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU307
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU596
+	.uleb128 .LVU596
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 0
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LFE6408-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU311
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU409
+	.uleb128 .LVU415
+	.uleb128 .LVU501
+	.uleb128 .LVU507
+	.uleb128 .LVU594
+	.uleb128 .LVU600
+	.uleb128 .LVU656
+	.uleb128 .LVU656
+	.uleb128 .LVU681
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 48
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU359
+	.uleb128 .LVU389
+	.uleb128 .LVU460
+	.uleb128 .LVU474
+	.uleb128 .LVU551
+	.uleb128 .LVU574
+	.uleb128 .LVU645
+	.uleb128 0
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LFE6408-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU313
+	.uleb128 .LVU318
+	.uleb128 .LVU417
+	.uleb128 .LVU421
+	.uleb128 .LVU509
+	.uleb128 .LVU513
+	.uleb128 .LVU602
+	.uleb128 .LVU606
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 48
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU318
+	.uleb128 .LVU322
+	.uleb128 .LVU421
+	.uleb128 .LVU425
+	.uleb128 .LVU513
+	.uleb128 .LVU516
+	.uleb128 .LVU606
+	.uleb128 .LVU609
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 48
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU309
+	.uleb128 .LVU311
+	.uleb128 .LVU413
+	.uleb128 .LVU415
+	.uleb128 .LVU505
+	.uleb128 .LVU507
+	.uleb128 .LVU598
+	.uleb128 .LVU600
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 48
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU327
+	.uleb128 .LVU329
+	.uleb128 .LVU430
+	.uleb128 .LVU432
+	.uleb128 .LVU521
+	.uleb128 .LVU523
+	.uleb128 .LVU614
+	.uleb128 .LVU616
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 48
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU334
+	.uleb128 .LVU336
+	.uleb128 .LVU437
+	.uleb128 .LVU439
+	.uleb128 .LVU528
+	.uleb128 .LVU530
+	.uleb128 .LVU621
+	.uleb128 .LVU623
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 48
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU322
+	.uleb128 .LVU325
+	.uleb128 .LVU425
+	.uleb128 .LVU428
+	.uleb128 .LVU516
+	.uleb128 .LVU519
+	.uleb128 .LVU609
+	.uleb128 .LVU612
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU322
+	.uleb128 .LVU325
+	.uleb128 .LVU425
+	.uleb128 .LVU428
+	.uleb128 .LVU516
+	.uleb128 .LVU519
+	.uleb128 .LVU609
+	.uleb128 .LVU612
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU329
+	.uleb128 .LVU332
+	.uleb128 .LVU432
+	.uleb128 .LVU435
+	.uleb128 .LVU523
+	.uleb128 .LVU526
+	.uleb128 .LVU616
+	.uleb128 .LVU619
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU336
+	.uleb128 .LVU339
+	.uleb128 .LVU439
+	.uleb128 .LVU442
+	.uleb128 .LVU530
+	.uleb128 .LVU534
+	.uleb128 .LVU623
+	.uleb128 .LVU628
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU343
+	.uleb128 .LVU346
+	.uleb128 .LVU445
+	.uleb128 .LVU448
+	.uleb128 .LVU536
+	.uleb128 .LVU539
+	.uleb128 .LVU631
+	.uleb128 .LVU633
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 48
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU351
+	.uleb128 .LVU353
+	.uleb128 .LVU453
+	.uleb128 .LVU456
+	.uleb128 .LVU544
+	.uleb128 .LVU547
+	.uleb128 .LVU638
+	.uleb128 .LVU640
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 48
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU346
+	.uleb128 .LVU349
+	.uleb128 .LVU448
+	.uleb128 .LVU451
+	.uleb128 .LVU539
+	.uleb128 .LVU542
+	.uleb128 .LVU633
+	.uleb128 .LVU636
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU353
+	.uleb128 .LVU359
+	.uleb128 .LVU456
+	.uleb128 .LVU460
+	.uleb128 .LVU547
+	.uleb128 .LVU551
+	.uleb128 .LVU640
+	.uleb128 .LVU645
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU361
+	.uleb128 .LVU364
+	.uleb128 .LVU462
+	.uleb128 .LVU465
+	.uleb128 .LVU553
+	.uleb128 .LVU556
+	.uleb128 .LVU647
+	.uleb128 .LVU649
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 48
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU364
+	.uleb128 .LVU368
+	.uleb128 .LVU465
+	.uleb128 .LVU469
+	.uleb128 .LVU556
+	.uleb128 .LVU560
+	.uleb128 .LVU649
+	.uleb128 .LVU652
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 48
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU364
+	.uleb128 .LVU368
+	.uleb128 .LVU465
+	.uleb128 .LVU469
+	.uleb128 .LVU556
+	.uleb128 .LVU560
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU368
+	.uleb128 .LVU379
+	.uleb128 .LVU469
+	.uleb128 .LVU476
+	.uleb128 .LVU560
+	.uleb128 .LVU564
+	.uleb128 .LVU652
+	.uleb128 .LVU656
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU386
+	.uleb128 .LVU389
+	.uleb128 .LVU482
+	.uleb128 .LVU484
+	.uleb128 .LVU571
+	.uleb128 .LVU574
+	.uleb128 .LVU663
+	.uleb128 .LVU665
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU398
+	.uleb128 .LVU400
+	.uleb128 .LVU489
+	.uleb128 .LVU491
+	.uleb128 .LVU582
+	.uleb128 .LVU584
+	.uleb128 .LVU671
+	.uleb128 .LVU673
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 32
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU381
+	.uleb128 .LVU384
+	.uleb128 .LVU566
+	.uleb128 .LVU569
+	.uleb128 .LVU658
+	.uleb128 .LVU661
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU389
+	.uleb128 .LVU396
+	.uleb128 .LVU484
+	.uleb128 .LVU487
+	.uleb128 .LVU574
+	.uleb128 .LVU580
+	.uleb128 .LVU665
+	.uleb128 .LVU669
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x6d
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU400
+	.uleb128 .LVU406
+	.uleb128 .LVU491
+	.uleb128 .LVU496
+	.uleb128 .LVU584
+	.uleb128 .LVU589
+	.uleb128 .LVU673
+	.uleb128 .LVU676
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU8
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU16
+	.uleb128 .LVU17
+	.uleb128 .LVU26
+	.uleb128 .LVU31
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE6407-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU11
+	.uleb128 .LVU17
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LFE6407-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU11
+	.uleb128 .LVU17
+	.uleb128 .LVU21
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LFE6407-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x4
+	.uleb128 .LBB206-.Ltext0
+	.uleb128 .LBE206-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB211-.Ltext0
+	.uleb128 .LBE211-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB212-.Ltext0
+	.uleb128 .LBE212-.Ltext0
+	.byte	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB207-.Ltext0
+	.uleb128 .LBE207-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB208-.Ltext0
+	.uleb128 .LBE208-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB209-.Ltext0
+	.uleb128 .LBE209-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB210-.Ltext0
+	.uleb128 .LBE210-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB213-.Ltext0
+	.uleb128 .LBE213-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB227-.Ltext0
+	.uleb128 .LBE227-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB222-.Ltext0
+	.uleb128 .LBE222-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB228-.Ltext0
+	.uleb128 .LBE228-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB233-.Ltext0
+	.uleb128 .LBE233-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB268-.Ltext0
+	.uleb128 .LBE268-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB229-.Ltext0
+	.uleb128 .LBE229-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB240-.Ltext0
+	.uleb128 .LBE240-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB269-.Ltext0
+	.uleb128 .LBE269-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB234-.Ltext0
+	.uleb128 .LBE234-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB241-.Ltext0
+	.uleb128 .LBE241-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB248-.Ltext0
+	.uleb128 .LBE248-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB266-.Ltext0
+	.uleb128 .LBE266-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB270-.Ltext0
+	.uleb128 .LBE270-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB242-.Ltext0
+	.uleb128 .LBE242-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB249-.Ltext0
+	.uleb128 .LBE249-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB255-.Ltext0
+	.uleb128 .LBE255-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB267-.Ltext0
+	.uleb128 .LBE267-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB271-.Ltext0
+	.uleb128 .LBE271-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB250-.Ltext0
+	.uleb128 .LBE250-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB256-.Ltext0
+	.uleb128 .LBE256-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB263-.Ltext0
+	.uleb128 .LBE263-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB272-.Ltext0
+	.uleb128 .LBE272-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB257-.Ltext0
+	.uleb128 .LBE257-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB264-.Ltext0
+	.uleb128 .LBE264-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB265-.Ltext0
+	.uleb128 .LBE265-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB273-.Ltext0
+	.uleb128 .LBE273-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB274-.Ltext0
+	.uleb128 .LBE274-.Ltext0
+	.byte	0
+.LLRL24:
+	.byte	0x4
+	.uleb128 .LBB275-.Ltext0
+	.uleb128 .LBE275-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB282-.Ltext0
+	.uleb128 .LBE282-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB278-.Ltext0
+	.uleb128 .LBE278-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB283-.Ltext0
+	.uleb128 .LBE283-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB284-.Ltext0
+	.uleb128 .LBE284-.Ltext0
+	.byte	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB285-.Ltext0
+	.uleb128 .LBE285-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB440-.Ltext0
+	.uleb128 .LBE440-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB441-.Ltext0
+	.uleb128 .LBE441-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB442-.Ltext0
+	.uleb128 .LBE442-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB443-.Ltext0
+	.uleb128 .LBE443-.Ltext0
+	.byte	0
+.LLRL32:
+	.byte	0x4
+	.uleb128 .LBB286-.Ltext0
+	.uleb128 .LBE286-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB435-.Ltext0
+	.uleb128 .LBE435-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB436-.Ltext0
+	.uleb128 .LBE436-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB437-.Ltext0
+	.uleb128 .LBE437-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB438-.Ltext0
+	.uleb128 .LBE438-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB439-.Ltext0
+	.uleb128 .LBE439-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB287-.Ltext0
+	.uleb128 .LBE287-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB304-.Ltext0
+	.uleb128 .LBE304-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB323-.Ltext0
+	.uleb128 .LBE323-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB401-.Ltext0
+	.uleb128 .LBE401-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB406-.Ltext0
+	.uleb128 .LBE406-.Ltext0
+	.byte	0
+.LLRL37:
+	.byte	0x4
+	.uleb128 .LBB293-.Ltext0
+	.uleb128 .LBE293-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB305-.Ltext0
+	.uleb128 .LBE305-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB324-.Ltext0
+	.uleb128 .LBE324-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB405-.Ltext0
+	.uleb128 .LBE405-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB407-.Ltext0
+	.uleb128 .LBE407-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB299-.Ltext0
+	.uleb128 .LBE299-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB313-.Ltext0
+	.uleb128 .LBE313-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB400-.Ltext0
+	.uleb128 .LBE400-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB402-.Ltext0
+	.uleb128 .LBE402-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB306-.Ltext0
+	.uleb128 .LBE306-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB314-.Ltext0
+	.uleb128 .LBE314-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB321-.Ltext0
+	.uleb128 .LBE321-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB328-.Ltext0
+	.uleb128 .LBE328-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB403-.Ltext0
+	.uleb128 .LBE403-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB409-.Ltext0
+	.uleb128 .LBE409-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB315-.Ltext0
+	.uleb128 .LBE315-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB322-.Ltext0
+	.uleb128 .LBE322-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB332-.Ltext0
+	.uleb128 .LBE332-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB404-.Ltext0
+	.uleb128 .LBE404-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB411-.Ltext0
+	.uleb128 .LBE411-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB325-.Ltext0
+	.uleb128 .LBE325-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB408-.Ltext0
+	.uleb128 .LBE408-.Ltext0
+	.byte	0
+.LLRL48:
+	.byte	0x4
+	.uleb128 .LBB329-.Ltext0
+	.uleb128 .LBE329-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB410-.Ltext0
+	.uleb128 .LBE410-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB333-.Ltext0
+	.uleb128 .LBE333-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB412-.Ltext0
+	.uleb128 .LBE412-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB336-.Ltext0
+	.uleb128 .LBE336-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB342-.Ltext0
+	.uleb128 .LBE342-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB348-.Ltext0
+	.uleb128 .LBE348-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB417-.Ltext0
+	.uleb128 .LBE417-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB419-.Ltext0
+	.uleb128 .LBE419-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB343-.Ltext0
+	.uleb128 .LBE343-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB352-.Ltext0
+	.uleb128 .LBE352-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB414-.Ltext0
+	.uleb128 .LBE414-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB421-.Ltext0
+	.uleb128 .LBE421-.Ltext0
+	.byte	0
+.LLRL56:
+	.byte	0x4
+	.uleb128 .LBB349-.Ltext0
+	.uleb128 .LBE349-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB420-.Ltext0
+	.uleb128 .LBE420-.Ltext0
+	.byte	0
+.LLRL58:
+	.byte	0x4
+	.uleb128 .LBB353-.Ltext0
+	.uleb128 .LBE353-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB362-.Ltext0
+	.uleb128 .LBE362-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB422-.Ltext0
+	.uleb128 .LBE422-.Ltext0
+	.byte	0
+.LLRL60:
+	.byte	0x4
+	.uleb128 .LBB357-.Ltext0
+	.uleb128 .LBE357-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB363-.Ltext0
+	.uleb128 .LBE363-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB413-.Ltext0
+	.uleb128 .LBE413-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB423-.Ltext0
+	.uleb128 .LBE423-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB364-.Ltext0
+	.uleb128 .LBE364-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB415-.Ltext0
+	.uleb128 .LBE415-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB424-.Ltext0
+	.uleb128 .LBE424-.Ltext0
+	.byte	0
+.LLRL65:
+	.byte	0x4
+	.uleb128 .LBB368-.Ltext0
+	.uleb128 .LBE368-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB377-.Ltext0
+	.uleb128 .LBE377-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB425-.Ltext0
+	.uleb128 .LBE425-.Ltext0
+	.byte	0
+.LLRL67:
+	.byte	0x4
+	.uleb128 .LBB372-.Ltext0
+	.uleb128 .LBE372-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB378-.Ltext0
+	.uleb128 .LBE378-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB426-.Ltext0
+	.uleb128 .LBE426-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB428-.Ltext0
+	.uleb128 .LBE428-.Ltext0
+	.byte	0
+.LLRL69:
+	.byte	0x4
+	.uleb128 .LBB379-.Ltext0
+	.uleb128 .LBE379-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB416-.Ltext0
+	.uleb128 .LBE416-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB429-.Ltext0
+	.uleb128 .LBE429-.Ltext0
+	.byte	0
+.LLRL71:
+	.byte	0x4
+	.uleb128 .LBB383-.Ltext0
+	.uleb128 .LBE383-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB394-.Ltext0
+	.uleb128 .LBE394-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB427-.Ltext0
+	.uleb128 .LBE427-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB430-.Ltext0
+	.uleb128 .LBE430-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB432-.Ltext0
+	.uleb128 .LBE432-.Ltext0
+	.byte	0
+.LLRL73:
+	.byte	0x4
+	.uleb128 .LBB389-.Ltext0
+	.uleb128 .LBE389-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB395-.Ltext0
+	.uleb128 .LBE395-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB418-.Ltext0
+	.uleb128 .LBE418-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB433-.Ltext0
+	.uleb128 .LBE433-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB396-.Ltext0
+	.uleb128 .LBE396-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB431-.Ltext0
+	.uleb128 .LBE431-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB434-.Ltext0
+	.uleb128 .LBE434-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB444-.Ltext0
+	.uleb128 .LBE444-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB723-.Ltext0
+	.uleb128 .LBE723-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB724-.Ltext0
+	.uleb128 .LBE724-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB725-.Ltext0
+	.uleb128 .LBE725-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB726-.Ltext0
+	.uleb128 .LBE726-.Ltext0
+	.byte	0
+.LLRL81:
+	.byte	0x4
+	.uleb128 .LBB445-.Ltext0
+	.uleb128 .LBE445-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB716-.Ltext0
+	.uleb128 .LBE716-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB717-.Ltext0
+	.uleb128 .LBE717-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB718-.Ltext0
+	.uleb128 .LBE718-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB719-.Ltext0
+	.uleb128 .LBE719-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB720-.Ltext0
+	.uleb128 .LBE720-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB721-.Ltext0
+	.uleb128 .LBE721-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB722-.Ltext0
+	.uleb128 .LBE722-.Ltext0
+	.byte	0
+.LLRL84:
+	.byte	0x4
+	.uleb128 .LBB446-.Ltext0
+	.uleb128 .LBE446-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB474-.Ltext0
+	.uleb128 .LBE474-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB501-.Ltext0
+	.uleb128 .LBE501-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB625-.Ltext0
+	.uleb128 .LBE625-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB629-.Ltext0
+	.uleb128 .LBE629-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB655-.Ltext0
+	.uleb128 .LBE655-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB660-.Ltext0
+	.uleb128 .LBE660-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB682-.Ltext0
+	.uleb128 .LBE682-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB687-.Ltext0
+	.uleb128 .LBE687-.Ltext0
+	.byte	0
+.LLRL86:
+	.byte	0x4
+	.uleb128 .LBB456-.Ltext0
+	.uleb128 .LBE456-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB475-.Ltext0
+	.uleb128 .LBE475-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB502-.Ltext0
+	.uleb128 .LBE502-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB630-.Ltext0
+	.uleb128 .LBE630-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB659-.Ltext0
+	.uleb128 .LBE659-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB661-.Ltext0
+	.uleb128 .LBE661-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB686-.Ltext0
+	.uleb128 .LBE686-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB688-.Ltext0
+	.uleb128 .LBE688-.Ltext0
+	.byte	0
+.LLRL88:
+	.byte	0x4
+	.uleb128 .LBB465-.Ltext0
+	.uleb128 .LBE465-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB487-.Ltext0
+	.uleb128 .LBE487-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB624-.Ltext0
+	.uleb128 .LBE624-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB626-.Ltext0
+	.uleb128 .LBE626-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB654-.Ltext0
+	.uleb128 .LBE654-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB656-.Ltext0
+	.uleb128 .LBE656-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB681-.Ltext0
+	.uleb128 .LBE681-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB683-.Ltext0
+	.uleb128 .LBE683-.Ltext0
+	.byte	0
+.LLRL90:
+	.byte	0x4
+	.uleb128 .LBB476-.Ltext0
+	.uleb128 .LBE476-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB488-.Ltext0
+	.uleb128 .LBE488-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB499-.Ltext0
+	.uleb128 .LBE499-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB508-.Ltext0
+	.uleb128 .LBE508-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB627-.Ltext0
+	.uleb128 .LBE627-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB632-.Ltext0
+	.uleb128 .LBE632-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB658-.Ltext0
+	.uleb128 .LBE658-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB663-.Ltext0
+	.uleb128 .LBE663-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB684-.Ltext0
+	.uleb128 .LBE684-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB690-.Ltext0
+	.uleb128 .LBE690-.Ltext0
+	.byte	0
+.LLRL92:
+	.byte	0x4
+	.uleb128 .LBB489-.Ltext0
+	.uleb128 .LBE489-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB500-.Ltext0
+	.uleb128 .LBE500-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB514-.Ltext0
+	.uleb128 .LBE514-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB628-.Ltext0
+	.uleb128 .LBE628-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB634-.Ltext0
+	.uleb128 .LBE634-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB657-.Ltext0
+	.uleb128 .LBE657-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB665-.Ltext0
+	.uleb128 .LBE665-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB685-.Ltext0
+	.uleb128 .LBE685-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB692-.Ltext0
+	.uleb128 .LBE692-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB503-.Ltext0
+	.uleb128 .LBE503-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB631-.Ltext0
+	.uleb128 .LBE631-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB662-.Ltext0
+	.uleb128 .LBE662-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB689-.Ltext0
+	.uleb128 .LBE689-.Ltext0
+	.byte	0
+.LLRL97:
+	.byte	0x4
+	.uleb128 .LBB509-.Ltext0
+	.uleb128 .LBE509-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB633-.Ltext0
+	.uleb128 .LBE633-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB664-.Ltext0
+	.uleb128 .LBE664-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB691-.Ltext0
+	.uleb128 .LBE691-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB515-.Ltext0
+	.uleb128 .LBE515-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB635-.Ltext0
+	.uleb128 .LBE635-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB666-.Ltext0
+	.uleb128 .LBE666-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB693-.Ltext0
+	.uleb128 .LBE693-.Ltext0
+	.byte	0
+.LLRL101:
+	.byte	0x4
+	.uleb128 .LBB520-.Ltext0
+	.uleb128 .LBE520-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB528-.Ltext0
+	.uleb128 .LBE528-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB536-.Ltext0
+	.uleb128 .LBE536-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB636-.Ltext0
+	.uleb128 .LBE636-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB667-.Ltext0
+	.uleb128 .LBE667-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB698-.Ltext0
+	.uleb128 .LBE698-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB700-.Ltext0
+	.uleb128 .LBE700-.Ltext0
+	.byte	0
+.LLRL103:
+	.byte	0x4
+	.uleb128 .LBB529-.Ltext0
+	.uleb128 .LBE529-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB542-.Ltext0
+	.uleb128 .LBE542-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB638-.Ltext0
+	.uleb128 .LBE638-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB669-.Ltext0
+	.uleb128 .LBE669-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB695-.Ltext0
+	.uleb128 .LBE695-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB702-.Ltext0
+	.uleb128 .LBE702-.Ltext0
+	.byte	0
+.LLRL105:
+	.byte	0x4
+	.uleb128 .LBB537-.Ltext0
+	.uleb128 .LBE537-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB637-.Ltext0
+	.uleb128 .LBE637-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB668-.Ltext0
+	.uleb128 .LBE668-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB701-.Ltext0
+	.uleb128 .LBE701-.Ltext0
+	.byte	0
+.LLRL107:
+	.byte	0x4
+	.uleb128 .LBB543-.Ltext0
+	.uleb128 .LBE543-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB557-.Ltext0
+	.uleb128 .LBE557-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB639-.Ltext0
+	.uleb128 .LBE639-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB670-.Ltext0
+	.uleb128 .LBE670-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB703-.Ltext0
+	.uleb128 .LBE703-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB705-.Ltext0
+	.uleb128 .LBE705-.Ltext0
+	.byte	0
+.LLRL109:
+	.byte	0x4
+	.uleb128 .LBB550-.Ltext0
+	.uleb128 .LBE550-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB558-.Ltext0
+	.uleb128 .LBE558-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB640-.Ltext0
+	.uleb128 .LBE640-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB671-.Ltext0
+	.uleb128 .LBE671-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB694-.Ltext0
+	.uleb128 .LBE694-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB706-.Ltext0
+	.uleb128 .LBE706-.Ltext0
+	.byte	0
+.LLRL111:
+	.byte	0x4
+	.uleb128 .LBB559-.Ltext0
+	.uleb128 .LBE559-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB641-.Ltext0
+	.uleb128 .LBE641-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB672-.Ltext0
+	.uleb128 .LBE672-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB696-.Ltext0
+	.uleb128 .LBE696-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB707-.Ltext0
+	.uleb128 .LBE707-.Ltext0
+	.byte	0
+.LLRL114:
+	.byte	0x4
+	.uleb128 .LBB565-.Ltext0
+	.uleb128 .LBE565-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB584-.Ltext0
+	.uleb128 .LBE584-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB595-.Ltext0
+	.uleb128 .LBE595-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB642-.Ltext0
+	.uleb128 .LBE642-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB646-.Ltext0
+	.uleb128 .LBE646-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB648-.Ltext0
+	.uleb128 .LBE648-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB673-.Ltext0
+	.uleb128 .LBE673-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB708-.Ltext0
+	.uleb128 .LBE708-.Ltext0
+	.byte	0
+.LLRL116:
+	.byte	0x4
+	.uleb128 .LBB574-.Ltext0
+	.uleb128 .LBE574-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB583-.Ltext0
+	.uleb128 .LBE583-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB603-.Ltext0
+	.uleb128 .LBE603-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB644-.Ltext0
+	.uleb128 .LBE644-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB650-.Ltext0
+	.uleb128 .LBE650-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB675-.Ltext0
+	.uleb128 .LBE675-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB697-.Ltext0
+	.uleb128 .LBE697-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB712-.Ltext0
+	.uleb128 .LBE712-.Ltext0
+	.byte	0
+.LLRL118:
+	.byte	0x4
+	.uleb128 .LBB585-.Ltext0
+	.uleb128 .LBE585-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB613-.Ltext0
+	.uleb128 .LBE613-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB615-.Ltext0
+	.uleb128 .LBE615-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB645-.Ltext0
+	.uleb128 .LBE645-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB652-.Ltext0
+	.uleb128 .LBE652-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB677-.Ltext0
+	.uleb128 .LBE677-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB679-.Ltext0
+	.uleb128 .LBE679-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB699-.Ltext0
+	.uleb128 .LBE699-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB714-.Ltext0
+	.uleb128 .LBE714-.Ltext0
+	.byte	0
+.LLRL120:
+	.byte	0x4
+	.uleb128 .LBB596-.Ltext0
+	.uleb128 .LBE596-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB643-.Ltext0
+	.uleb128 .LBE643-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB649-.Ltext0
+	.uleb128 .LBE649-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB674-.Ltext0
+	.uleb128 .LBE674-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB709-.Ltext0
+	.uleb128 .LBE709-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB711-.Ltext0
+	.uleb128 .LBE711-.Ltext0
+	.byte	0
+.LLRL122:
+	.byte	0x4
+	.uleb128 .LBB604-.Ltext0
+	.uleb128 .LBE604-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB614-.Ltext0
+	.uleb128 .LBE614-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB647-.Ltext0
+	.uleb128 .LBE647-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB651-.Ltext0
+	.uleb128 .LBE651-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB676-.Ltext0
+	.uleb128 .LBE676-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB678-.Ltext0
+	.uleb128 .LBE678-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB704-.Ltext0
+	.uleb128 .LBE704-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB713-.Ltext0
+	.uleb128 .LBE713-.Ltext0
+	.byte	0
+.LLRL124:
+	.byte	0x4
+	.uleb128 .LBB616-.Ltext0
+	.uleb128 .LBE616-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB623-.Ltext0
+	.uleb128 .LBE623-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB653-.Ltext0
+	.uleb128 .LBE653-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB680-.Ltext0
+	.uleb128 .LBE680-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB710-.Ltext0
+	.uleb128 .LBE710-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB715-.Ltext0
+	.uleb128 .LBE715-.Ltext0
+	.byte	0
+.LLRL137:
+	.byte	0x4
+	.uleb128 .LBB727-.Ltext0
+	.uleb128 .LBE727-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB747-.Ltext0
+	.uleb128 .LBE747-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB748-.Ltext0
+	.uleb128 .LBE748-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB749-.Ltext0
+	.uleb128 .LBE749-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB750-.Ltext0
+	.uleb128 .LBE750-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB751-.Ltext0
+	.uleb128 .LBE751-.Ltext0
+	.byte	0
+.LLRL139:
+	.byte	0x4
+	.uleb128 .LBB728-.Ltext0
+	.uleb128 .LBE728-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB743-.Ltext0
+	.uleb128 .LBE743-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB744-.Ltext0
+	.uleb128 .LBE744-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB745-.Ltext0
+	.uleb128 .LBE745-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB746-.Ltext0
+	.uleb128 .LBE746-.Ltext0
+	.byte	0
+.LLRL149:
+	.byte	0x4
+	.uleb128 .LBB729-.Ltext0
+	.uleb128 .LBE729-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB730-.Ltext0
+	.uleb128 .LBE730-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB731-.Ltext0
+	.uleb128 .LBE731-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB732-.Ltext0
+	.uleb128 .LBE732-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB739-.Ltext0
+	.uleb128 .LBE739-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB741-.Ltext0
+	.uleb128 .LBE741-.Ltext0
+	.byte	0
+.LLRL151:
+	.byte	0x4
+	.uleb128 .LBB733-.Ltext0
+	.uleb128 .LBE733-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB737-.Ltext0
+	.uleb128 .LBE737-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB738-.Ltext0
+	.uleb128 .LBE738-.Ltext0
+	.byte	0
+.LLRL153:
+	.byte	0x4
+	.uleb128 .LBB740-.Ltext0
+	.uleb128 .LBE740-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB742-.Ltext0
+	.uleb128 .LBE742-.Ltext0
+	.byte	0
+.LLRL158:
+	.byte	0x4
+	.uleb128 .LBB752-.Ltext0
+	.uleb128 .LBE752-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB753-.Ltext0
+	.uleb128 .LBE753-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF142:
+	.string	"__q23"
+.LASF66:
+	.string	"count"
+.LASF39:
+	.string	"capacity"
+.LASF93:
+	.string	"malloc"
+.LASF105:
+	.string	"escape_carry"
+.LASF10:
+	.string	"size_t"
+.LASF17:
+	.string	"ST_SCAN_SCALAR"
+.LASF16:
+	.string	"uint64_t"
+.LASF52:
+	.string	"string"
+.LASF14:
+	.string	"ssize_t"
+.LASF79:
+	.string	"__v64qi"
+.LASF49:
+	.string	"ST_STRING_MAPPED"
+.LASF135:
+	.string	"__q30"
+.LASF134:
+	.string	"__q31"
+.LASF125:
+	.string	"_mm512_cmpeq_epi8_mask"
+.LASF15:
+	.string	"long long unsigned int"
+.LASF47:
+	.string	"ST_STRING_BORROWED"
+.LASF120:
+	.string	"limit"
+.LASF46:
+	.string	"StringOwnership"
+.LASF92:
+	.string	"free"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF27:
+	.string	"bytes_scanned"
+.LASF44:
+	.string	"ST_GROWTH_GEOMETRIC"
+.LASF64:
+	.string	"StringStructuralIndex"
+.LASF30:
+	.string	"reallocations"
+.LASF3:
+	.string	"long int"
+.LASF67:
+	.string	"in_string"
+.LASF31:
+	.string	"expansions"
+.LASF12:
+	.string	"__ssize_t"
+.LASF63:
+	.string	"stats"
+.LASF81:
+	.string	"__mmask64"
+.LASF40:
+	.string	"offset"
+.LASF69:
+	.string	"double"
+.LASF51:
+	.string	"StringTokenizer"
+.LASF26:
+	.string	"StringStats"
+.LASF168:
+	.string	"_mm_min_epu8"
+.LASF72:
+	.string	"__v16qi"
+.LASF106:
+	.string	"string_carry"
+.LASF132:
+	.string	"_mm256_set1_epi8"
+.LASF117:
+	.string	"structural_index_classify_avx512"
+.LASF60:
+	.string	"arena"
+.LASF123:
+	.string	"mask"
+.LASF118:
+	.string	"structural_index_classify_avx2"
+.LASF56:
+	.string	"growth_policy"
+.LASF25:
+	.string	"StringArena"
+.LASF126:
+	.string	"_mm512_loadu_si512"
+.LASF87:
+	.string	"backslashes"
+.LASF109:
+	.string	"block"
+.LASF7:
+	.string	"unsigned int"
+.LASF22:
+	.string	"block_size"
+.LASF113:
+	.string	"scalars"
+.LASF54:
+	.string	"position"
+.LASF65:
+	.string	"positions"
+.LASF50:
+	.string	"ST_STRING_INLINE"
+.LASF119:
+	.string	"structural_index_classify_sse2"
+.LASF2:
+	.string	"long unsigned int"
+.LASF108:
+	.string	"block_index"
+.LASF35:
+	.string	"StringStream"
+.LASF6:
+	.string	"short unsigned int"
+.LASF43:
+	.string	"StringGrowthPolicy"
+.LASF55:
+	.string	"incremental_factor"
+.LASF107:
+	.string	"scalar_carry"
+.LASF94:
+	.string	"st_scan_isa"
+.LASF89:
+	.string	"memcpy"
+.LASF68:
+	.string	"hint"
+.LASF20:
+	.string	"ST_SCAN_AVX512"
+.LASF173:
+	.string	"_mm_set_epi8"
+.LASF32:
+	.string	"bytes_copied"
+.LASF101:
+	.string	"st_structural_next"
+.LASF74:
+	.string	"__v4du"
+.LASF18:
+	.string	"ST_SCAN_SSE2"
+.LASF124:
+	.string	"_mm512_cmplt_epu8_mask"
+.LASF45:
+	.string	"ST_GROWTH_LINEAR"
+.LASF104:
+	.string	"blocks"
+.LASF28:
+	.string	"tokens_extracted"
+.LASF73:
+	.string	"__m128i"
+.LASF102:
+	.string	"st_build_structural_index"
+.LASF24:
+	.string	"long double"
+.LASF80:
+	.string	"__m512i_u"
+.LASF19:
+	.string	"ST_SCAN_AVX2"
+.LASF110:
+	.string	"padded"
+.LASF91:
+	.string	"st_next_token"
+.LASF61:
+	.string	"inline_buffer"
+.LASF129:
+	.string	"_mm256_movemask_epi8"
+.LASF11:
+	.string	"__uint64_t"
+.LASF23:
+	.string	"used"
+.LASF41:
+	.string	"error"
+.LASF33:
+	.string	"conversions"
+.LASF122:
+	.string	"token"
+.LASF127:
+	.string	"_mm512_set1_epi8"
+.LASF86:
+	.string	"quotes"
+.LASF75:
+	.string	"__v32qi"
+.LASF171:
+	.string	"_mm_loadu_si128"
+.LASF131:
+	.string	"_mm256_cmpeq_epi8"
+.LASF58:
+	.string	"stream"
+.LASF174:
+	.ascii	"GNU C17 12.2.0 -march=sapphirerapids -mmmx -mpopcnt -msse -m"
+	.ascii	"sse2 -msse3 -mssse3 -msse4.1 -msse4.2 -mavx -mavx2 -mno-sse4"
+	.ascii	"a -mno-fma4 -mno-xop -mfma -mavx512f -mbmi -mbmi2 -maes -mpc"
+	.ascii	"lmul -mavx512vl -mavx512bw -mavx512dq -mavx512cd -mno-avx512"
+	.ascii	"er -mno-avx512pf -mavx512vbmi -mavx512ifma -mno-avx5124vnniw"
+	.ascii	" -mno-avx5124fmaps -mavx512vpopcntdq -mavx512vbmi2 -mgfni -m"
+	.ascii	"vpclmulqdq -mavx512vnni -mavx512bitalg -mavx512bf16 -mno-avx"
+	.ascii	"512vp2intersect -mno-3dnow -madx -mabm -mcldemote -mclflusho"
+	.ascii	"pt -mclwb -mno-clzero -mcx16 -mno-enqcmd -mf16c -mfsgsbase -"
+	.ascii	"mfxsr -mno-hle -msahf -mno-lwp -mlzcnt -mmovbe -mmovdir64b -"
+	.ascii	"mmovdiri -mno-mwaitx -mno-pconfig -mpku -mno-prefetchwt1 -mp"
+	.ascii	"rfchw -mno-ptwrite -mrdpid -mrdrnd -mrdseed -mno-rtm -mseria"
+	.ascii	"lize -mno-sgx -msha -mshstk -mno-tbm -mtsxldtrk -mvaes -mno-"
+	.ascii	"waitpkg -mwbnoinvd -mxsave -mxsavec -mxsaveopt -mxsaves -mam"
+	.ascii	"x-t"
+	.string	"ile -mamx-int8 -mamx-bf16 -mno-uintr -mno-hreset -mno-kl -mno-widekl -mavxvnni -mavx512fp16 --param=l1-cache-size=48 --param=l1-cache-line-size=64 --param=l2-cache-size=107520 -mtune=sapphirerapids -g -O3 -pedantic-errors -fpic -fasynchronous-unwind-tables"
+.LASF5:
+	.string	"unsigned char"
+.LASF103:
+	.string	"classify"
+.LASF115:
+	.string	"structurals"
+.LASF59:
+	.string	"ownership"
+.LASF34:
+	.string	"conversion_ns"
+.LASF167:
+	.string	"_mm_movemask_epi8"
+.LASF9:
+	.string	"short int"
+.LASF98:
+	.string	"st_next_structural"
+.LASF165:
+	.string	"__q00"
+.LASF164:
+	.string	"__q01"
+.LASF163:
+	.string	"__q02"
+.LASF162:
+	.string	"__q03"
+.LASF161:
+	.string	"__q04"
+.LASF160:
+	.string	"__q05"
+.LASF159:
+	.string	"__q06"
+.LASF158:
+	.string	"__q07"
+.LASF157:
+	.string	"__q08"
+.LASF156:
+	.string	"__q09"
+.LASF48:
+	.string	"ST_STRING_OWNED"
+.LASF155:
+	.string	"__q10"
+.LASF21:
+	.string	"head"
+.LASF178:
+	.string	"__builtin_memcpy"
+.LASF57:
+	.string	"max_increment"
+.LASF13:
+	.string	"char"
+.LASF99:
+	.string	"st_drop_structural_index"
+.LASF172:
+	.string	"_mm_set1_epi8"
+.LASF147:
+	.string	"__q18"
+.LASF85:
+	.string	"operators"
+.LASF116:
+	.string	"chunk"
+.LASF128:
+	.string	"_mm256_or_si256"
+.LASF84:
+	.string	"whitespace"
+.LASF177:
+	.string	"__m512i"
+.LASF100:
+	.string	"tokenizer"
+.LASF95:
+	.string	"index"
+.LASF111:
+	.string	"masks"
+.LASF96:
+	.string	"high"
+.LASF112:
+	.string	"escaped"
+.LASF42:
+	.string	"StringScanIsa"
+.LASF62:
+	.string	"structural_index"
+.LASF71:
+	.string	"__v2du"
+.LASF154:
+	.string	"__q11"
+.LASF153:
+	.string	"__q12"
+.LASF152:
+	.string	"__q13"
+.LASF151:
+	.string	"__q14"
+.LASF150:
+	.string	"__q15"
+.LASF149:
+	.string	"__q16"
+.LASF148:
+	.string	"__q17"
+.LASF37:
+	.string	"context"
+.LASF146:
+	.string	"__q19"
+.LASF169:
+	.string	"_mm_cmpeq_epi8"
+.LASF176:
+	.string	"structural_index_prefix_xor"
+.LASF53:
+	.string	"length"
+.LASF130:
+	.string	"_mm256_min_epu8"
+.LASF90:
+	.string	"memset"
+.LASF133:
+	.string	"_mm256_set_epi8"
+.LASF38:
+	.string	"chunk_size"
+.LASF175:
+	.string	"StringArenaBlock"
+.LASF77:
+	.string	"__m128i_u"
+.LASF76:
+	.string	"__m256i"
+.LASF166:
+	.string	"_mm256_loadu_si256"
+.LASF70:
+	.string	"float"
+.LASF114:
+	.string	"scalar_starts"
+.LASF121:
+	.string	"structural_index_classify_scalar"
+.LASF78:
+	.string	"__m256i_u"
+.LASF29:
+	.string	"allocations"
+.LASF36:
+	.string	"read"
+.LASF83:
+	.string	"StructuralIndexMasks"
+.LASF145:
+	.string	"__q20"
+.LASF144:
+	.string	"__q21"
+.LASF170:
+	.string	"_mm_or_si128"
+.LASF88:
+	.string	"realloc"
+.LASF141:
+	.string	"__q24"
+.LASF140:
+	.string	"__q25"
+.LASF139:
+	.string	"__q26"
+.LASF138:
+	.string	"__q27"
+.LASF137:
+	.string	"__q28"
+.LASF136:
+	.string	"__q29"
+.LASF97:
+	.string	"middle"
+.LASF82:
+	.string	"_Float16"
+.LASF143:
+	.string	"__q22"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"/root/repo/src/structural_index.c"
+.LASF1:
+	.string	"/root/repo/build/test"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -1,290 +1,2371 @@
-#ifndef STRING_TOKENIZER_H
-#define STRING_TOKENIZER_H
+#ifndef STRING_VIEW_H
+#define STRING_VIEW_H
 
 #include <stdlib.h>
+#include <stdint.h>
 
 /**
- * Struct definition for tokenizing a given string.
+ * Struct definition for a non-owning view into a character array.
+ *
+ * A view does not own the memory it points to and is not null-terminated, it
+ * stays valid as long as the underlying string is alive and unchanged.
  */
-struct StringTokenizer {
-
-  /**
-   * Pointer to the raw string.
-   */
-  char *string;
-
-  /**
-   * The length of the raw string.
-   */
-  size_t length;
+struct StringView {
 
   /**
-   * The current position on the string.
+   * Pointer to the first character of the view.
    */
-  size_t position;
+  const char *ptr;
 
   /**
-   * The incremental factor for the string.
+   * The number of characters in the view.
    */
-  size_t incremental_factor;
+  size_t len;
 };
 
 /**
- * Create a new StringTokenizer instance.
+ * Creates a view over the given null-terminated string.
  *
- * @param char *string
- *   The string to be tokenized.
+ * @param const char *string
+ *   The null-terminated string.
  *
- * @return struct StringTokenizer*
- *   Pointer to the StringTokenizer instance, or NULL on failure.
+ * @return struct StringView
+ *   The view over the whole string, or an empty view if string is NULL.
  */
-struct StringTokenizer *st_create(char *string);
+struct StringView sv_from_string(const char *string);
 
 /**
- * Create a StringTokenizer instance from an empty string of the given size.
+ * Compares two views lexicographically.
  *
- * @param const size_t string_size
- *   The size of the string.
+ * @param const struct StringView *a
+ *   The first view.
+ * @param const struct StringView *b
+ *   The second view.
  *
- * @return struct StringTokenizer*
- *   Pointer to the StringTokenizer instance, or NULL on failure.
+ * @return int
+ *   Returns a negative value if a < b, 0 if both are equal, a positive value if a > b.
  */
-struct StringTokenizer *st_create_empty(const size_t string_size);
+int sv_compare(const struct StringView *a, const struct StringView *b);
 
 /**
- * Frees the memory associated with a StringTokenizer instance.
+ * Checks if a view is equal to the given null-terminated string.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
+ * @param const struct StringView *view
+ *   The view to compare.
+ * @param const char *string
+ *   The null-terminated string to compare with.
+ *
+ * @return int
+ *   Returns 1 if both have the same characters, otherwise 0.
  */
-void st_destroy(struct StringTokenizer *tokenizer);
+int sv_equals(const struct StringView *view, const char *string);
 
 /**
- * String tokenizer, Moves the cursor forward to the next valid character.
+ * Computes the 64-bit FNV-1a hash of the view characters.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
+ * @param const struct StringView *view
+ *   The view to hash.
+ *
+ * @return uint64_t
+ *   The hash value.
  */
-void st_next_token(struct StringTokenizer *tokenizer);
+uint64_t sv_hash(const struct StringView *view);
 
 /**
- * String tokenizer, returns the current token element.
+ * Copies the view characters into a new null-terminated string.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
+ * @param const struct StringView *view
+ *   The view to copy.
  *
- * @return char
- *   The current token character.
+ * @return char*
+ *   Pointer to the new string, or NULL on failure.
+ *   The caller is responsible for freeing the allocated memory.
  */
-char st_current_token(struct StringTokenizer *tokenizer);
+char *sv_to_string(const struct StringView *view);
 
 /**
- * String tokenizer, extracts a substring between the given delimiters.
+ * Converts the view characters into a double value.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
- * @param const char start_delim
- *   The start character on the basis of which the split will be done.
- * @param const char end_delim
- *   The end character on the basis of which the split will be done.
+ * @param const struct StringView *view
+ *   The view to convert.
+ * @param double *value
+ *   Pointer to the variable that receives the converted value.
  *
- * @return char*
- *   Pointer to the extracted substring, or NULL on failure.
+ * @return int
+ *   Returns 1 if the whole view was converted, otherwise 0.
  */
-char *st_sub_string(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim);
+int sv_to_double(const struct StringView *view, double *value);
 
 /**
- * String tokenizer, extracts a slice of the string.
+ * Converts the view characters into a 64-bit integer value.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
- * @param const int length
- *   The length of the substring.
+ * @param const struct StringView *view
+ *   The view to convert.
+ * @param int64_t *value
+ *   Pointer to the variable that receives the converted value.
  *
- * @return char*
- *   Pointer to the extracted substring, or NULL on failure.
+ * @return int
+ *   Returns 1 if the whole view was converted, otherwise 0.
  */
-char *st_slice_string(struct StringTokenizer *tokenizer, const int length);
+int sv_to_int64(const struct StringView *view, int64_t *value);
+
+#endif /* STRING_VIEW_H */
+
+#ifndef CHAR_CLASS_H
+#define CHAR_CLASS_H
+
+#include <stdint.h>
 
 /**
- * String tokenizer, extracts numbers from the string.
- *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
+ * The character classes of the classification table, each one is a bit.
+ */
+enum StringCharClassBits {
+
+  /**
+   * Any byte from 0 to 32 (the space character).
+   */
+  ST_CLASS_WHITESPACE = 1 << 0,
+
+  /**
+   * The decimal digits.
+   */
+  ST_CLASS_DIGIT = 1 << 1,
+
+  /**
+   * The characters of a numeric token: digits, signs, '.', 'e' and 'E'.
+   */
+  ST_CLASS_NUMERIC = 1 << 2,
+
+  /**
+   * The hexadecimal digits, in lower and upper case.
+   */
+  ST_CLASS_HEX = 1 << 3,
+
+  /**
+   * The JSON structural characters: '{', '}', '[', ']', ':' and ','.
+   */
+  ST_CLASS_STRUCTURAL = 1 << 4,
+
+  /**
+   * The characters that need to be escaped in a JSON string: the double quote,
+   * the backslash and the control characters (0 to 31).
+   */
+  ST_CLASS_ESCAPE = 1 << 5,
+
+  /**
+   * The ASCII letters.
+   */
+  ST_CLASS_ALPHA = 1 << 6,
+};
+
+/**
+ * The classification table, the classes of every byte value.
  *
- * @return char*
- *   Pointer to the extracted numbers substring, or NULL on failure
+ * The table is built at compile time, index it with the byte as an unsigned char.
  */
-char *st_extract_numbers(struct StringTokenizer *tokenizer);
+extern const uint8_t st_char_classes[256];
 
 /**
- * String tokenizer, extracts a double value from the string.
+ * Struct definition for a custom character class, such as a set of delimiters.
+ */
+struct StringCharClass {
+
+  /**
+   * Non-zero for the bytes that belong to the class.
+   */
+  uint8_t members[256];
+};
+
+/**
+ * Initializes a custom character class.
  *
- * Extract numbers from string and converts them into to a floating-point
- * number (type double).
+ * @param struct StringCharClass *char_class
+ *   Pointer to the class to initialize.
+ * @param const unsigned int classes
+ *   The built-in classes included in the custom class, a mask of StringCharClassBits, or 0.
+ * @param const char *members
+ *   The null-terminated list of extra characters of the class, or NULL.
+ */
+void st_char_class_init(struct StringCharClass *char_class, const unsigned int classes, const char *members);
+
+/**
+ * Checks if a character belongs to any of the given built-in classes.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
+ * @param const char token
+ *   The character to classify.
+ * @param const unsigned int classes
+ *   A mask of StringCharClassBits.
  *
- * @return double*
- *   Pointer to the extracted double value, or NULL on failure.
+ * @return int
+ *   Returns 1 if the character belongs to any of the classes, otherwise 0.
  */
-double *st_extract_double(struct StringTokenizer *tokenizer);
+static inline int st_char_is(const char token, const unsigned int classes) {
+  return (st_char_classes[(unsigned char)token] & classes) != 0;
+}
 
 /**
- * String tokenizer, extracts a boolean value from the string.
+ * Checks if a character belongs to a custom class.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
- * @param const char* bool_value
- *   The string representation of the boolean value.
- * @param const int int_value
- *   The integer representation of the boolean value.
+ * @param const struct StringCharClass *char_class
+ *   Pointer to the custom class.
+ * @param const char token
+ *   The character to classify.
  *
- * @return int*
- *   Pointer to the extracted boolean value as an int, or NULL on failure.
+ * @return int
+ *   Returns 1 if the character belongs to the class, otherwise 0.
  */
-int *st_extract_boolean(struct StringTokenizer *tokenizer, const char *bool_value, const int int_value);
+static inline int st_char_class_has(const struct StringCharClass *char_class, const char token) {
+  return char_class->members[(unsigned char)token] != 0;
+}
+
+#endif /* CHAR_CLASS_H */
+
+#ifndef STRING_SCAN_H
+#define STRING_SCAN_H
+
+#include <stdlib.h>
 
 /**
- * String tokenizer, Checks if the tokenizer starts with a given substring.
+ * The instruction sets available for the scan kernels.
+ */
+enum StringScanIsa {
+  ST_SCAN_SCALAR,
+  ST_SCAN_SSE2,
+  ST_SCAN_AVX2,
+  ST_SCAN_AVX512,
+};
+
+/**
+ * Checks if the CPU supports the scan kernels of the given instruction set.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
- * @param const char *needle
- *   The substring to search for.
+ * @param const enum StringScanIsa isa
+ *   The instruction set to check.
  *
  * @return int
- *   Returns 1 if the tokenizer starts with a given substring, otherwise 0.
+ *   Returns 1 if the instruction set is supported, otherwise 0.
  */
-int st_starts_with(struct StringTokenizer *tokenizer, const char *needle);
+int st_scan_isa_supported(const enum StringScanIsa isa);
 
 /**
- * Checks if the tokenizer buffer has enough space for the requested string size.
+ * Forces the scan functions to use the kernels of the given instruction set.
  *
- * This function will try to reallocate more space if needed.
+ * The widest supported instruction set is selected when the library is loaded,
+ * this function is meant for testing and benchmarking the other kernels.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
- * @param const size_t size
- *   The requested string size to check.
+ * @param const enum StringScanIsa isa
+ *   The instruction set to use.
  *
  * @return int
- *   Returns 1 if the tokenizer has enough space for the requested size, otherwise 0.
+ *   Returns 1 if the kernels were selected, otherwise 0.
  */
-int st_expand_string(struct StringTokenizer *tokenizer, const size_t size);
+int st_scan_set_isa(const enum StringScanIsa isa);
 
 /**
- * String tokenizer, appends the given string to the tokenizer buffer.
+ * Gets the instruction set of the kernels used by the scan functions.
+ *
+ * @return enum StringScanIsa
+ *   The selected instruction set.
+ */
+enum StringScanIsa st_scan_isa();
+
+/**
+ * Finds the next delimiter or null character in the given string.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
  * @param const char *string
- *   The string to append.
+ *   Pointer to the characters to scan.
+ * @param const size_t length
+ *   The maximum number of characters to scan.
+ * @param const char delim
+ *   The delimiter to search for.
  *
- * @return int
- *   Returns 1 when the string was append, otherwise 0.
+ * @return size_t
+ *   The index of the first delimiter or null character, or length if none was found.
  */
-int st_append_string(struct StringTokenizer *tokenizer, const char *string);
+size_t st_scan_delimiter(const char *string, const size_t length, const char delim);
 
 /**
- * String tokenizer, appends the given string to the tokenizer buffer, wrapped in double quotes.
+ * Finds the next non-whitespace character in the given string.
  *
- * This function wraps the given string in double-quotes.
+ * Any byte from 0 to 32 (the space character) is considered whitespace.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
  * @param const char *string
- *   The string to append.
+ *   Pointer to the characters to scan.
+ * @param const size_t length
+ *   The maximum number of characters to scan.
  *
- * @return int
- *   Returns 1 when the string was append, otherwise 0.
+ * @return size_t
+ *   The index of the first non-whitespace character, or length if none was found.
  */
-int st_append_quoted_string(struct StringTokenizer *tokenizer, const char *string);
+size_t st_scan_non_whitespace(const char *string, const size_t length);
 
 /**
- * String tokenizer, appends the given double value to the tokenizer buffer, wrapped in double quotes.
+ * Finds the next null character in the given string.
  *
- * This function wraps the given string in double-quotes.
+ * @param const char *string
+ *   Pointer to the characters to scan.
+ * @param const size_t length
+ *   The maximum number of characters to scan.
  *
- * @param struct StringTokenizer* tokenizer
- *   Pointer to the tokenizer instance.
- * @param const double *value
- *   The double value to append.
+ * @return size_t
+ *   The index of the first null character, or length if none was found.
+ */
+size_t st_scan_nul(const char *string, const size_t length);
+
+/**
+ * Finds the next character that needs to be escaped in a JSON string.
  *
- * @return int
- *   Returns 1 when the string was append, otherwise 0.
+ * The double quote, the backslash and the control characters (0 to 31) need
+ * to be escaped.
+ *
+ * @param const char *string
+ *   Pointer to the characters to scan.
+ * @param const size_t length
+ *   The maximum number of characters to scan.
+ *
+ * @return size_t
+ *   The index of the first character to escape, or length if none was found.
  */
-int st_append_double(struct StringTokenizer *tokenizer, const double *value);
+size_t st_scan_escape(const char *string, const size_t length);
 
-#endif /* STRING_TOKENIZER_H */
+/**
+ * Finds the next character of a custom class in the given string.
+ *
+ * @param const char *string
+ *   Pointer to the characters to scan.
+ * @param const size_t length
+ *   The maximum number of characters to scan.
+ * @param const struct StringCharClass *char_class
+ *   The class to search for.
+ *
+ * @return size_t
+ *   The index of the first character of the class, or length if none was found.
+ */
+size_t st_scan_class(const char *string, const size_t length, const struct StringCharClass *char_class);
 
-#ifndef IS_NUMERIC_H
-#define IS_NUMERIC_H
+#endif /* STRING_SCAN_H */
+
+#ifndef STRING_ARENA_H
+#define STRING_ARENA_H
+
+#include <stdlib.h>
 
 /**
- * Determines if a character is a numeric token.
- *
- * @param const char token
- *   The character to validate.
+ * The default size of an arena block.
+ */
+#define ST_ARENA_BLOCK_SIZE 65536
+
+/**
+ * The number of released arenas kept by each thread.
+ */
+#define ST_ARENA_POOL_SIZE 4
+
+/**
+ * A block of arena memory, blocks are chained from the newest to the oldest.
+ */
+struct StringArenaBlock;
+
+/**
+ * Struct definition for a bump-pointer arena.
  *
- * @return int
- *   Returns 1 if value is a number or a numeric string, 0 otherwise.
+ * Memory is carved from large blocks and released all together by
+ * st_arena_reset() or st_arena_destroy(), single allocations can not be freed.
  */
-static inline int is_numeric(const char token) {
-  if (token == '-' || token == '+') {
-    return 1;
-  }
-  if (token >= '0' && token <= '9') {
-    return 1;
-  }
-  if (token == '.') {
-    return 1;
-  }
-  if (token == 'e' || token == 'E') {
-    return 1;
-  }
-  return 0;
-}
+struct StringArena {
 
-#endif /* IS_NUMERIC_H */
+  /**
+   * The block allocations are carved from.
+   */
+  struct StringArenaBlock *head;
 
-#ifndef NUMERIC_STRING_H
-#define NUMERIC_STRING_H
+  /**
+   * The minimum size of a new block.
+   */
+  size_t block_size;
+
+  /**
+   * The number of bytes handed out since the last reset.
+   */
+  size_t used;
+};
 
 /**
- * Converts an integer into a numeric string.
+ * Create a new arena.
  *
- * @param int value
- *   The integer value to convert.
+ * @param const size_t block_size
+ *   The minimum size of a block, 0 for ST_ARENA_BLOCK_SIZE.
  *
- * @return char*
- *   A pointer to the resulting numeric string, or NULL on failure.
- *   The caller is responsible for freeing the allocated memory.
+ * @return struct StringArena*
+ *   Pointer to the arena instance, or NULL on failure.
  */
-char *itos(int value);
+struct StringArena *st_arena_create(const size_t block_size);
 
 /**
- * Converts a long double into a numeric string.
+ * Allocates memory from the arena, aligned for any type.
  *
- * @param long double value
- *   The long double value to convert.
+ * @param struct StringArena *arena
+ *   Pointer to the arena instance.
+ * @param const size_t size
+ *   The number of bytes to allocate.
  *
- * @return char*
- *   A pointer to the resulting numeric string, or NULL on failure.
- *   The caller is responsible for freeing the allocated memory.
+ * @return void*
+ *   Pointer to the allocated memory, or NULL on failure.
  */
-char *ldtos(long double value);
+void *st_arena_alloc(struct StringArena *arena, const size_t size);
 
 /**
- * Converts a numeric string into a long double.
+ * Copies a view into a null-terminated string allocated from the arena.
  *
- * @param char *numeric_string
- *   A pointer to the null-terminated numeric string to convert.
+ * @param struct StringArena *arena
+ *   Pointer to the arena instance.
+ * @param const struct StringView *view
+ *   The view to copy.
  *
- * @return long double
+ * @return char*
+ *   Pointer to the copied string, or NULL on failure.
+ */
+char *st_arena_string(struct StringArena *arena, const struct StringView *view);
+
+/**
+ * Releases every allocation of the arena at once.
+ *
+ * The newest block is kept for the next allocations, the others are freed.
+ *
+ * @param struct StringArena *arena
+ *   Pointer to the arena instance.
+ */
+void st_arena_reset(struct StringArena *arena);
+
+/**
+ * Frees the arena and all its allocations.
+ *
+ * @param struct StringArena *arena
+ *   Pointer to the arena instance.
+ */
+void st_arena_destroy(struct StringArena *arena);
+
+/**
+ * Takes an arena from the pool of the calling thread, or creates a new one.
+ *
+ * @return struct StringArena*
+ *   Pointer to the arena instance, or NULL on failure.
+ */
+struct StringArena *st_arena_acquire(void);
+
+/**
+ * Resets an arena and returns it to the pool of the calling thread.
+ *
+ * The arena is destroyed when the pool is full.
+ *
+ * @param struct StringArena *arena
+ *   Pointer to the arena instance.
+ */
+void st_arena_release(struct StringArena *arena);
+
+/**
+ * Destroys the arenas kept in the pool of the calling thread.
+ *
+ * Threads that used st_arena_release() call it before exiting.
+ */
+void st_arena_pool_clear(void);
+
+#endif /* STRING_ARENA_H */
+
+#ifndef STRING_STATS_H
+#define STRING_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Struct definition for the instrumentation counters.
+ *
+ * The counters are only updated when the library is compiled with
+ * LIBSTR_ENABLE_STATS, per tokenizer once a StringStats instance is attached
+ * with st_attach_stats() and globally once st_stats_enable() is called.
+ */
+struct StringStats {
+
+  /**
+   * The number of characters scanned by the cursor functions.
+   */
+  uint64_t bytes_scanned;
+
+  /**
+   * The number of extracted tokens: sub strings, slices and numbers.
+   */
+  uint64_t tokens_extracted;
+
+  /**
+   * The number of malloc() calls.
+   */
+  uint64_t allocations;
+
+  /**
+   * The number of realloc() calls.
+   */
+  uint64_t reallocations;
+
+  /**
+   * The number of times st_expand_string() grew the buffer.
+   */
+  uint64_t expansions;
+
+  /**
+   * The number of characters copied while growing or compacting buffers.
+   */
+  uint64_t bytes_copied;
+
+  /**
+   * The number of numeric conversions.
+   */
+  uint64_t conversions;
+
+  /**
+   * The time spent in numeric conversions, in nanoseconds.
+   */
+  uint64_t conversion_ns;
+};
+
+struct StringTokenizer;
+
+#ifdef LIBSTR_ENABLE_USDT
+#include <sys/sdt.h>
+#define ST_STATS_PROBE(tokenizer, field, value) DTRACE_PROBE2(libstr, field, tokenizer, value)
+#else
+#define ST_STATS_PROBE(tokenizer, field, value) do { } while (0)
+#endif
+
+#ifdef LIBSTR_ENABLE_STATS
+#define ST_STATS_ADD(tokenizer, field, value) do { st_stats_add((tokenizer), offsetof(struct StringStats, field), (value)); ST_STATS_PROBE(tokenizer, field, value); } while (0)
+#define ST_STATS_CLOCK(tokenizer) st_stats_clock(tokenizer)
+#define ST_STATS_SINCE(tokenizer, start) do { if ((start) != 0) { ST_STATS_ADD(tokenizer, conversions, 1); ST_STATS_ADD(tokenizer, conversion_ns, st_stats_clock(tokenizer) - (start)); } } while (0)
+#else
+#define ST_STATS_ADD(tokenizer, field, value) do { } while (0)
+#define ST_STATS_CLOCK(tokenizer) ((uint64_t)0)
+#define ST_STATS_SINCE(tokenizer, start) do { (void)(start); } while (0)
+#endif
+
+/**
+ * Checks if the instrumentation was compiled in with LIBSTR_ENABLE_STATS.
+ *
+ * @return int
+ *   Returns 1 if the counters are updated, otherwise 0.
+ */
+int st_stats_available(void);
+
+/**
+ * Enables or disables the global counters, they are disabled by default.
+ *
+ * @param const int enabled
+ *   1 to enable the global counters, 0 to disable them.
+ */
+void st_stats_enable(const int enabled);
+
+/**
+ * Copies the global counters.
+ *
+ * @param struct StringStats *stats
+ *   Pointer to the instance that receives the counters.
+ */
+void st_stats_snapshot(struct StringStats *stats);
+
+/**
+ * Sets the global counters to zero.
+ */
+void st_stats_reset(void);
+
+/**
+ * Adds a value to a counter of the tokenizer and to the global counters.
+ *
+ * Used through the ST_STATS_ADD() macro.
+ *
+ * @param const struct StringTokenizer *tokenizer
+ *   Pointer to the tokenizer instance, or NULL for the global counters only.
+ * @param const size_t field
+ *   The offset of the counter in struct StringStats.
+ * @param const uint64_t value
+ *   The value to add.
+ */
+void st_stats_add(const struct StringTokenizer *tokenizer, const size_t field, const uint64_t value);
+
+/**
+ * Reads the monotonic clock when a conversion has to be timed.
+ *
+ * Used through the ST_STATS_CLOCK() macro.
+ *
+ * @param const struct StringTokenizer *tokenizer
+ *   Pointer to the tokenizer instance, or NULL.
+ *
+ * @return uint64_t
+ *   The time in nanoseconds, 0 when no counter would receive it.
+ */
+uint64_t st_stats_clock(const struct StringTokenizer *tokenizer);
+
+#endif /* STRING_STATS_H */
+
+#ifndef STRING_TOKENIZER_H
+#define STRING_TOKENIZER_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+/**
+ * Struct definition for the source of a streaming tokenizer.
+ *
+ * The tokenizer string is a window over the source, the characters before the
+ * cursor are discarded when the window is refilled so memory stays bounded by
+ * the chunk size plus the longest token.
+ */
+struct StringStream {
+
+  /**
+   * Reads up to size characters into the buffer, returns the number of
+   * characters read, 0 at the end of the source or -1 on error.
+   */
+  ssize_t (*read)(void *context, char *buffer, size_t size);
+
+  /**
+   * The context passed to the read function.
+   */
+  void *context;
+
+  /**
+   * The file descriptor, used when reading from a descriptor.
+   */
+  int fd;
+
+  /**
+   * The number of characters requested on every read.
+   */
+  size_t chunk_size;
+
+  /**
+   * The allocated size of the window.
+   */
+  size_t capacity;
+
+  /**
+   * The offset of the first window character in the source.
+   */
+  size_t offset;
+
+  /**
+   * Flag set when the source has no more data.
+   */
+  int eof;
+
+  /**
+   * Flag set when the source failed to read.
+   */
+  int error;
+};
+
+/**
+ * The policies used to grow the tokenizer string.
+ */
+enum StringGrowthPolicy {
+
+  /**
+   * Doubles the string length on every expansion, appends are amortized O(1).
+   */
+  ST_GROWTH_GEOMETRIC,
+
+  /**
+   * Adds the incremental factor on every expansion.
+   */
+  ST_GROWTH_LINEAR,
+};
+
+/**
+ * The number of released tokenizers kept by each thread.
+ */
+#define ST_TOKENIZER_POOL_SIZE 8
+
+/**
+ * The size of the buffer embedded in the tokenizer for short strings.
+ */
+#define ST_INLINE_BUFFER_SIZE 256
+
+/**
+ * Describes who owns the tokenizer string.
+ */
+enum StringOwnership {
+
+  /**
+   * The string belongs to the caller.
+   */
+  ST_STRING_BORROWED,
+
+  /**
+   * The string was allocated by the tokenizer, freed by st_destroy().
+   */
+  ST_STRING_OWNED,
+
+  /**
+   * The string is a read-only file mapping, unmapped by st_destroy().
+   */
+  ST_STRING_MAPPED,
+
+  /**
+   * The string lives in the inline buffer of the tokenizer.
+   */
+  ST_STRING_INLINE,
+};
+
+/**
+ * Struct definition for tokenizing a given string.
+ */
+struct StringTokenizer {
+
+  /**
+   * Pointer to the raw string.
+   */
+  char *string;
+
+  /**
+   * The length of the raw string.
+   */
+  size_t length;
+
+  /**
+   * The current position on the string.
+   */
+  size_t position;
+
+  /**
+   * The incremental factor for the string.
+   */
+  size_t incremental_factor;
+
+  /**
+   * The policy used to grow the string.
+   */
+  enum StringGrowthPolicy growth_policy;
+
+  /**
+   * The maximum number of bytes added by a single expansion, 0 for no limit.
+   */
+  size_t max_increment;
+
+  /**
+   * The source of a streaming tokenizer, NULL when the whole string is in memory.
+   */
+  struct StringStream *stream;
+
+  /**
+   * Who owns the string.
+   */
+  enum StringOwnership ownership;
+
+  /**
+   * The arena extracted strings and values are allocated from, NULL for malloc.
+   */
+  struct StringArena *arena;
+
+  /**
+   * Buffer for short strings, they move to the heap when they outgrow it.
+   */
+  char inline_buffer[ST_INLINE_BUFFER_SIZE];
+
+  /**
+   * The structural index of the string, NULL when it was not built.
+   */
+  struct StringStructuralIndex *structural_index;
+
+  /**
+   * The counters of the tokenizer, NULL when they are not collected.
+   */
+  struct StringStats *stats;
+};
+
+/**
+ * Create a new StringTokenizer instance.
+ *
+ * @param char *string
+ *   The string to be tokenized.
+ *
+ * @return struct StringTokenizer*
+ *   Pointer to the StringTokenizer instance, or NULL on failure.
+ */
+struct StringTokenizer *st_create(char *string);
+
+/**
+ * Create a new StringTokenizer instance from a string of known length.
+ *
+ * The string does not need to be null-terminated.
+ *
+ * @param char *string
+ *   The string to be tokenized.
+ * @param const size_t length
+ *   The length of the string.
+ *
+ * @return struct StringTokenizer*
+ *   Pointer to the StringTokenizer instance, or NULL on failure.
+ */
+struct StringTokenizer *st_create_n(char *string, const size_t length);
+
+/**
+ * Inits the String Tokenizer object properties.
+ *
+ * Used by every constructor, so a new property is initialized in one place.
+ * The string is borrowed and the tokenizer has no stream, arena, index or stats.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param char *string
+ *   The string to be tokenized.
+ * @param const size_t length
+ *   The length of the string.
+ */
+void st_init(struct StringTokenizer *tokenizer, char *string, const size_t length);
+
+/**
+ * Create a StringTokenizer instance that tokenizes a file in place.
+ *
+ * The file is mapped read-only and is not null-terminated, the tokenizer owns
+ * the mapping and unmaps it in st_destroy(). The append functions can not be
+ * used on a mapped tokenizer.
+ *
+ * @param const char *path
+ *   The path of the file to tokenize.
+ *
+ * @return struct StringTokenizer*
+ *   Pointer to the StringTokenizer instance, or NULL on failure.
+ */
+struct StringTokenizer *st_create_from_mmap(const char *path);
+
+/**
+ * Create a StringTokenizer instance from an empty string of the given size.
+ *
+ * The tokenizer owns the string, it is freed by st_destroy() unless it is
+ * detached with st_detach_string(). Strings shorter than ST_INLINE_BUFFER_SIZE
+ * start in the inline buffer and move to the heap when they outgrow it.
+ *
+ * @param const size_t string_size
+ *   The size of the string.
+ *
+ * @return struct StringTokenizer*
+ *   Pointer to the StringTokenizer instance, or NULL on failure.
+ */
+struct StringTokenizer *st_create_empty(const size_t string_size);
+
+/**
+ * Create a streaming StringTokenizer instance that reads from a file descriptor.
+ *
+ * The descriptor is not closed by st_destroy().
+ *
+ * @param const int fd
+ *   The file descriptor to read from.
+ * @param const size_t chunk_size
+ *   The number of characters read at once.
+ *
+ * @return struct StringTokenizer*
+ *   Pointer to the StringTokenizer instance, or NULL on failure.
+ */
+struct StringTokenizer *st_create_from_fd(const int fd, const size_t chunk_size);
+
+/**
+ * Create a streaming StringTokenizer instance that reads from a file.
+ *
+ * The file is not closed by st_destroy().
+ *
+ * @param FILE *file
+ *   The file to read from.
+ * @param const size_t chunk_size
+ *   The number of characters read at once.
+ *
+ * @return struct StringTokenizer*
+ *   Pointer to the StringTokenizer instance, or NULL on failure.
+ */
+struct StringTokenizer *st_create_from_file(FILE *file, const size_t chunk_size);
+
+/**
+ * Create a streaming StringTokenizer instance that reads from a callback.
+ *
+ * Views extracted from a streaming tokenizer point into the window, they stay
+ * valid until the next cursor operation refills it.
+ *
+ * @param ssize_t (*read)(void *context, char *buffer, size_t size)
+ *   Reads up to size characters, returns the number of characters read, 0 at
+ *   the end of the source or -1 on error.
+ * @param void *context
+ *   The context passed to the read function.
+ * @param const size_t chunk_size
+ *   The number of characters read at once.
+ *
+ * @return struct StringTokenizer*
+ *   Pointer to the StringTokenizer instance, or NULL on failure.
+ */
+struct StringTokenizer *st_create_from_callback(ssize_t (*read)(void *context, char *buffer, size_t size), void *context, const size_t chunk_size);
+
+/**
+ * Ensures the given number of characters are available from the cursor position.
+ *
+ * Streaming tokenizers discard the characters before the cursor and read from
+ * the source until the characters are available or the source ends.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const size_t size
+ *   The number of characters needed from the cursor position.
+ *
+ * @return int
+ *   Returns 1 if the characters are available, otherwise 0.
+ */
+int st_ensure(struct StringTokenizer *tokenizer, const size_t size);
+
+/**
+ * Attaches an arena to the tokenizer.
+ *
+ * While an arena is attached, the strings and values returned by st_sub_string(),
+ * st_slice_string(), st_extract_numbers(), st_extract_double() and
+ * st_extract_boolean() are allocated from it and must not be freed one by one.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param struct StringArena *arena
+ *   Pointer to the arena instance, or NULL to go back to malloc.
+ */
+void st_attach_arena(struct StringTokenizer *tokenizer, struct StringArena *arena);
+
+/**
+ * Attaches instrumentation counters to the tokenizer.
+ *
+ * The counters are only updated when the library is compiled with LIBSTR_ENABLE_STATS.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param struct StringStats *stats
+ *   Pointer to the counters, or NULL to stop collecting them.
+ */
+void st_attach_stats(struct StringTokenizer *tokenizer, struct StringStats *stats);
+
+/**
+ * Moves the cursor back to the start of the string, keeping the buffer.
+ *
+ * Tokenizers that own their string are emptied, so they can build a new
+ * string in the already grown buffer.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ */
+void st_reset(struct StringTokenizer *tokenizer);
+
+/**
+ * Points the tokenizer to a new string and moves the cursor to its start.
+ *
+ * The string owned by the tokenizer is released, streaming tokenizers can not
+ * be rebound.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param char *string
+ *   The string to be tokenized, it does not need to be null-terminated.
+ * @param const size_t length
+ *   The length of the string.
+ *
+ * @return int
+ *   Returns 1 if the tokenizer was rebound, otherwise 0.
+ */
+int st_rebind(struct StringTokenizer *tokenizer, char *string, const size_t length);
+
+/**
+ * Takes the string from the tokenizer, the caller becomes responsible for freeing it.
+ *
+ * A string in the inline buffer is returned as a heap copy of the characters
+ * before the cursor. After an owned or inline string is handed over, the
+ * tokenizer is empty: the cursor is at 0 and new appends go to the inline
+ * buffer, the detached string is never touched again. Strings the tokenizer
+ * does not own are returned as they are and the tokenizer is unchanged.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ *
+ * @return char*
+ *   The tokenizer string.
+ */
+char *st_detach_string(struct StringTokenizer *tokenizer);
+
+/**
+ * Takes an empty tokenizer from the pool of the calling thread, or creates a new one.
+ *
+ * Pooled tokenizers keep the buffer grown by their previous uses.
+ *
+ * @param const size_t string_size
+ *   The minimum size of the string.
+ *
+ * @return struct StringTokenizer*
+ *   Pointer to the StringTokenizer instance, or NULL on failure.
+ */
+struct StringTokenizer *st_pool_acquire(const size_t string_size);
+
+/**
+ * Returns a tokenizer to the pool of the calling thread.
+ *
+ * Only tokenizers that own their string are pooled, the others and the ones
+ * that do not fit in the pool are destroyed.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ */
+void st_pool_release(struct StringTokenizer *tokenizer);
+
+/**
+ * Destroys the tokenizers kept in the pool of the calling thread.
+ *
+ * Threads that used st_pool_release() call it before exiting.
+ */
+void st_pool_clear(void);
+
+/**
+ * Frees the memory associated with a StringTokenizer instance.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ */
+void st_destroy(struct StringTokenizer *tokenizer);
+
+/**
+ * String tokenizer, Moves the cursor forward to the next valid character.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ */
+void st_next_token(struct StringTokenizer *tokenizer);
+
+/**
+ * String tokenizer, returns the current token element.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ *
+ * @return char
+ *   The current token character.
+ */
+char st_current_token(struct StringTokenizer *tokenizer);
+
+/**
+ * String tokenizer, extracts a substring between the given delimiters.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char start_delim
+ *   The start character on the basis of which the split will be done.
+ * @param const char end_delim
+ *   The end character on the basis of which the split will be done.
+ *
+ * @return char*
+ *   Pointer to the extracted substring, or NULL on failure.
+ */
+char *st_sub_string(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim);
+
+/**
+ * String tokenizer, extracts a slice of the string.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const int length
+ *   The length of the substring.
+ *
+ * @return char*
+ *   Pointer to the extracted substring, or NULL on failure.
+ */
+char *st_slice_string(struct StringTokenizer *tokenizer, const int length);
+
+/**
+ * String tokenizer, extracts numbers from the string.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ *
+ * @return char*
+ *   Pointer to the extracted numbers substring, or NULL on failure
+ */
+char *st_extract_numbers(struct StringTokenizer *tokenizer);
+
+/**
+ * String tokenizer, gets a view of the substring between the given delimiters.
+ *
+ * This is the zero-copy version of st_sub_string(), the cursor is moved in the
+ * same way but no memory is allocated, the view points into the tokenizer string.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char start_delim
+ *   The start character on the basis of which the split will be done.
+ * @param const char end_delim
+ *   The end character on the basis of which the split will be done.
+ * @param struct StringView *view
+ *   Pointer to the view that receives the substring.
+ *
+ * @return int
+ *   Returns 1 when the substring was found, otherwise 0.
+ */
+int st_sub_string_view(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim, struct StringView *view);
+
+/**
+ * String tokenizer, gets a view of a slice of the string.
+ *
+ * This is the zero-copy version of st_slice_string(), the cursor is moved in the
+ * same way but no memory is allocated, the view points into the tokenizer string.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const int length
+ *   The length of the substring.
+ * @param struct StringView *view
+ *   Pointer to the view that receives the slice.
+ *
+ * @return int
+ *   Returns 1 when the slice was extracted, otherwise 0.
+ */
+int st_slice_string_view(struct StringTokenizer *tokenizer, const int length, struct StringView *view);
+
+/**
+ * String tokenizer, gets a view of the numbers at the cursor position.
+ *
+ * This is the zero-copy version of st_extract_numbers(), the cursor is moved in
+ * the same way but no memory is allocated, the view points into the tokenizer string.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param struct StringView *view
+ *   Pointer to the view that receives the numeric substring.
+ *
+ * @return int
+ *   Returns 1 when numbers were found, otherwise 0.
+ */
+int st_extract_numbers_view(struct StringTokenizer *tokenizer, struct StringView *view);
+
+/**
+ * String tokenizer, gets a view of the characters before the next delimiter.
+ *
+ * The delimiters are the characters of a custom class, the view starts at the
+ * cursor and the cursor is moved to the last character before the delimiter.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const struct StringCharClass *delimiters
+ *   The class of the delimiters.
+ * @param struct StringView *view
+ *   Pointer to the view that receives the substring.
+ *
+ * @return int
+ *   Returns 1 when at least one character was found before a delimiter or the
+ *   end of the string, otherwise 0.
+ */
+int st_extract_until_view(struct StringTokenizer *tokenizer, const struct StringCharClass *delimiters, struct StringView *view);
+
+/**
+ * String tokenizer, extracts a double value from the string.
+ *
+ * Extract numbers from string and converts them into to a floating-point
+ * number (type double).
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ *
+ * @return double*
+ *   Pointer to the extracted double value, or NULL on failure.
+ */
+double *st_extract_double(struct StringTokenizer *tokenizer);
+
+/**
+ * String tokenizer, extracts a double value from the string without allocating memory.
+ *
+ * The cursor is moved in the same way as st_extract_double(), the value is parsed
+ * directly from the tokenizer string.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param double *value
+ *   Pointer to the variable that receives the extracted value.
+ *
+ * @return int
+ *   Returns 1 when a number was extracted, otherwise 0.
+ */
+int st_extract_double_to(struct StringTokenizer *tokenizer, double *value);
+
+/**
+ * String tokenizer, extracts a 64-bit integer from the string without allocating memory.
+ *
+ * The digits are converted 8 at a time by stoi64(). Numbers with a fraction or
+ * an exponent go through the double conversion and are only accepted when
+ * their value is a 64-bit integer. On success the cursor is moved to the last
+ * character of the number, on failure it is not moved.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param int64_t *value
+ *   Pointer to the variable that receives the extracted value.
+ *
+ * @return int
+ *   Returns 1 when an integer was extracted, 0 when there is no number, it is
+ *   not an integer or it does not fit.
+ */
+int st_extract_int64(struct StringTokenizer *tokenizer, int64_t *value);
+
+/**
+ * String tokenizer, extracts a boolean value from the string.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char* bool_value
+ *   The string representation of the boolean value.
+ * @param const int int_value
+ *   The integer representation of the boolean value.
+ *
+ * @return int*
+ *   Pointer to the extracted boolean value as an int, or NULL on failure.
+ */
+int *st_extract_boolean(struct StringTokenizer *tokenizer, const char *bool_value, const int int_value);
+
+/**
+ * String tokenizer, Checks if the tokenizer starts with a given substring.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char *needle
+ *   The substring to search for.
+ *
+ * @return int
+ *   Returns 1 if the tokenizer starts with a given substring, otherwise 0.
+ */
+int st_starts_with(struct StringTokenizer *tokenizer, const char *needle);
+
+/**
+ * Checks if the tokenizer buffer has enough space for the requested string size.
+ *
+ * This function will try to reallocate more space if needed. Mapped files and
+ * streaming tokenizers are read-only, this function always returns 0 for them.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const size_t size
+ *   The requested string size to check.
+ *
+ * @return int
+ *   Returns 1 if the tokenizer has enough space for the requested size, otherwise 0.
+ */
+int st_expand_string(struct StringTokenizer *tokenizer, const size_t size);
+
+/**
+ * Sets the policy used to grow the tokenizer string.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const enum StringGrowthPolicy policy
+ *   The growth policy.
+ * @param const size_t max_increment
+ *   The maximum number of bytes added by a single expansion, 0 for no limit.
+ *   Expansions always add at least the requested size.
+ */
+void st_set_growth_policy(struct StringTokenizer *tokenizer, const enum StringGrowthPolicy policy, const size_t max_increment);
+
+/**
+ * Ensures the tokenizer string has at least the given length.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const size_t length
+ *   The minimum length of the string.
+ *
+ * @return int
+ *   Returns 1 if the string has the requested length, otherwise 0. Mapped
+ *   and streamed strings can not be resized.
+ */
+int st_reserve(struct StringTokenizer *tokenizer, const size_t length);
+
+/**
+ * Releases the unused space at the end of the tokenizer string.
+ *
+ * The string keeps the characters before the cursor and the null character.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ *
+ * @return int
+ *   Returns 1 if the string was shrunk, otherwise 0. Mapped and streamed
+ *   strings can not be resized.
+ */
+int st_shrink_to_fit(struct StringTokenizer *tokenizer);
+
+/**
+ * String tokenizer, appends the given string to the tokenizer buffer.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char *string
+ *   The string to append.
+ *
+ * @return int
+ *   Returns 1 when the string was append, otherwise 0.
+ */
+int st_append_string(struct StringTokenizer *tokenizer, const char *string);
+
+/**
+ * String tokenizer, appends the given characters to the tokenizer buffer.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char *string
+ *   Pointer to the characters to append, they don't need to be null-terminated.
+ * @param const size_t length
+ *   The number of characters to append.
+ *
+ * @return int
+ *   Returns 1 when the string was append, otherwise 0.
+ */
+int st_append_n(struct StringTokenizer *tokenizer, const char *string, const size_t length);
+
+/**
+ * String tokenizer, appends a single character to the tokenizer buffer.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char token
+ *   The character to append.
+ *
+ * @return int
+ *   Returns 1 when the character was append, otherwise 0.
+ */
+int st_append_char(struct StringTokenizer *tokenizer, const char token);
+
+/**
+ * String tokenizer, appends a group of fragments to the tokenizer buffer.
+ *
+ * The buffer is expanded once for the whole group.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const struct StringView *fragments
+ *   The fragments to append, in order.
+ * @param const size_t count
+ *   The number of fragments.
+ *
+ * @return int
+ *   Returns 1 when the fragments were append, otherwise 0.
+ */
+int st_append_many(struct StringTokenizer *tokenizer, const struct StringView *fragments, const size_t count);
+
+/**
+ * String tokenizer, appends the given string to the tokenizer buffer, wrapped in double quotes.
+ *
+ * This function wraps the given string in double-quotes.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char *string
+ *   The string to append.
+ *
+ * @return int
+ *   Returns 1 when the string was append, otherwise 0.
+ */
+int st_append_quoted_string(struct StringTokenizer *tokenizer, const char *string);
+
+/**
+ * String tokenizer, appends the given string as a JSON string.
+ *
+ * The string is wrapped in double quotes, and the double quotes, backslashes
+ * and control characters are escaped.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char *string
+ *   The string to append.
+ *
+ * @return int
+ *   Returns 1 when the string was append, otherwise 0.
+ */
+int st_append_escaped_string(struct StringTokenizer *tokenizer, const char *string);
+
+/**
+ * String tokenizer, appends the given characters as a JSON string.
+ *
+ * Same as st_append_escaped_string(), for characters that are not null-terminated.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char *string
+ *   Pointer to the characters to append.
+ * @param const size_t length
+ *   The number of characters to append.
+ *
+ * @return int
+ *   Returns 1 when the string was append, otherwise 0.
+ */
+int st_append_escaped_n(struct StringTokenizer *tokenizer, const char *string, const size_t length);
+
+/**
+ * String tokenizer, appends the given integer value to the tokenizer buffer.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const int64_t value
+ *   The integer value to append.
+ *
+ * @return int
+ *   Returns 1 when the string was append, otherwise 0.
+ */
+int st_append_int(struct StringTokenizer *tokenizer, const int64_t value);
+
+/**
+ * String tokenizer, appends the given double value to the tokenizer buffer.
+ *
+ * The value is written with the shortest representation that converts back to
+ * the same double.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const double *value
+ *   The double value to append.
+ *
+ * @return int
+ *   Returns 1 when the string was append, otherwise 0.
+ */
+int st_append_double(struct StringTokenizer *tokenizer, const double *value);
+
+/**
+ * String tokenizer, appends the given double value rounded to a number of significant digits.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const double *value
+ *   The double value to append.
+ * @param const int precision
+ *   The number of significant digits, from 1 to DTOS_MAX_PRECISION.
+ *
+ * @return int
+ *   Returns 1 when the string was append, otherwise 0.
+ */
+int st_append_double_precision(struct StringTokenizer *tokenizer, const double *value, const int precision);
+
+/**
+ * String tokenizer, appends the given double value with a fixed number of decimals.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const double *value
+ *   The double value to append.
+ * @param const int precision
+ *   The number of decimals, from 0 to DTOS_FIXED_MAX_PRECISION.
+ *
+ * @return int
+ *   Returns 1 when the string was append, otherwise 0.
+ */
+int st_append_fixed(struct StringTokenizer *tokenizer, const double *value, const int precision);
+
+#endif /* STRING_TOKENIZER_H */
+
+#ifndef IS_NUMERIC_H
+#define IS_NUMERIC_H
+
+/**
+ * Determines if a character is a numeric token.
+ *
+ * @param const char token
+ *   The character to validate.
+ *
+ * @return int
+ *   Returns 1 if value is a number or a numeric string, 0 otherwise.
+ */
+static inline int is_numeric(const char token) {
+  return st_char_is(token, ST_CLASS_NUMERIC);
+}
+
+#endif /* IS_NUMERIC_H */
+
+#ifndef NUMERIC_STRING_H
+#define NUMERIC_STRING_H
+
+/**
+ * The buffer size needed by itos_to(), i64tos_to() and u64tos_to(), including the null character.
+ */
+#define ITOS_BUFFER_SIZE 21
+
+/**
+ * The buffer size needed by dtos_to() and dtos_precision_to(), including the null character.
+ */
+#define DTOS_BUFFER_SIZE 32
+
+/**
+ * The maximum number of significant digits accepted by dtos_precision_to().
+ */
+#define DTOS_MAX_PRECISION 17
+
+/**
+ * The maximum number of decimals accepted by dtos_fixed_to().
+ */
+#define DTOS_FIXED_MAX_PRECISION 20
+
+/**
+ * The buffer size needed by dtos_fixed_to(), enough for the biggest double, including the null character.
+ */
+#define DTOS_FIXED_BUFFER_SIZE (1 + 309 + 1 + DTOS_FIXED_MAX_PRECISION + 1)
+
+/**
+ * Converts an integer into a numeric string.
+ *
+ * @param int value
+ *   The integer value to convert.
+ *
+ * @return char*
+ *   A pointer to the resulting numeric string, or NULL on failure.
+ *   The caller is responsible for freeing the allocated memory.
+ */
+char *itos(int value);
+
+/**
+ * Writes an integer as a numeric string into the given buffer.
+ *
+ * @param char *buffer
+ *   The destination buffer, of at least ITOS_BUFFER_SIZE bytes.
+ * @param int value
+ *   The integer value to convert.
+ *
+ * @return size_t
+ *   The number of characters written, not counting the null character.
+ */
+size_t itos_to(char *buffer, int value);
+
+/**
+ * Writes a 64-bit integer as a numeric string into the given buffer.
+ *
+ * @param char *buffer
+ *   The destination buffer, of at least ITOS_BUFFER_SIZE bytes.
+ * @param int64_t value
+ *   The integer value to convert.
+ *
+ * @return size_t
+ *   The number of characters written, not counting the null character.
+ */
+size_t i64tos_to(char *buffer, int64_t value);
+
+/**
+ * Writes an unsigned 64-bit integer as a numeric string into the given buffer.
+ *
+ * @param char *buffer
+ *   The destination buffer, of at least ITOS_BUFFER_SIZE bytes.
+ * @param uint64_t value
+ *   The integer value to convert.
+ *
+ * @return size_t
+ *   The number of characters written, not counting the null character.
+ */
+size_t u64tos_to(char *buffer, uint64_t value);
+
+/**
+ * Converts a long double into a numeric string.
+ *
+ * @param long double value
+ *   The long double value to convert.
+ *
+ * @return char*
+ *   A pointer to the resulting numeric string, or NULL on failure.
+ *   The caller is responsible for freeing the allocated memory.
+ */
+char *ldtos(long double value);
+
+/**
+ * Converts a numeric string into a long double.
+ *
+ * @param char *numeric_string
+ *   A pointer to the null-terminated numeric string to convert.
+ *
+ * @return long double
  *   The resulting long double. If the conversion fails, returns 0 and sets errno appropriately.
  */
-long double stold(const char *numeric_string);
+long double stold(const char *numeric_string);
+
+/**
+ * Converts the numeric characters at the start of the given string into a double.
+ *
+ * The conversion is correctly rounded, does not allocate memory and does not
+ * depend on the current locale, the decimal separator is always '.'.
+ * The string does not need to be null-terminated.
+ *
+ * @param const char *string
+ *   Pointer to the characters to convert.
+ * @param const size_t length
+ *   The maximum number of characters to read.
+ * @param double *value
+ *   Pointer to the variable that receives the converted value.
+ *
+ * @return size_t
+ *   The number of characters converted, or 0 if the string does not start with a number.
+ */
+size_t stod(const char *string, const size_t length, double *value);
+
+/**
+ * Writes the shortest numeric string that converts back to the same double.
+ *
+ * Values with an absolute decimal exponent in a reasonable range are written in
+ * fixed notation (0.001, 1500), the rest in exponential notation (1e+300).
+ *
+ * @param char *buffer
+ *   The destination buffer, of at least DTOS_BUFFER_SIZE bytes.
+ * @param const double value
+ *   The double value to convert.
+ *
+ * @return size_t
+ *   The number of characters written, not counting the null character.
+ */
+size_t dtos_to(char *buffer, const double value);
+
+/**
+ * Writes a double rounded to the given number of significant digits.
+ *
+ * Trailing zeros are not written, so the output is never longer than the
+ * dtos_to() output.
+ *
+ * @param char *buffer
+ *   The destination buffer, of at least DTOS_BUFFER_SIZE bytes.
+ * @param const double value
+ *   The double value to convert.
+ * @param int precision
+ *   The number of significant digits, from 1 to DTOS_MAX_PRECISION.
+ *
+ * @return size_t
+ *   The number of characters written, not counting the null character.
+ */
+size_t dtos_precision_to(char *buffer, const double value, int precision);
+
+/**
+ * Writes a double with a fixed number of decimals, as printf("%.*f") does.
+ *
+ * The output is exact for the whole double range and rounds halfway values to
+ * even on the exact binary value. Values whose scaled form fits in 64 bits are
+ * formatted without the C library, the decimal separator is always '.'.
+ *
+ * @param char *buffer
+ *   The destination buffer, of at least DTOS_FIXED_BUFFER_SIZE bytes.
+ * @param const double value
+ *   The double value to convert.
+ * @param int precision
+ *   The number of decimals, from 0 to DTOS_FIXED_MAX_PRECISION.
+ *
+ * @return size_t
+ *   The number of characters written, not counting the null character.
+ */
+size_t dtos_fixed_to(char *buffer, const double value, int precision);
+
+/**
+ * Converts the numeric characters at the start of the given string into a 64-bit integer.
+ *
+ * The digits are validated and converted 8 at a time, overflows are detected
+ * exactly. The conversion stops before a '.' or an exponent, callers that
+ * accept decimals fall back to stod() when the next character is one of them.
+ * The string does not need to be null-terminated.
+ *
+ * @param const char *string
+ *   Pointer to the characters to convert.
+ * @param const size_t length
+ *   The maximum number of characters to read.
+ * @param int64_t *value
+ *   Pointer to the variable that receives the converted value.
+ *
+ * @return size_t
+ *   The number of characters converted, or 0 if the string does not start with
+ *   an integer or the integer does not fit, errno is set to ERANGE then.
+ */
+size_t stoi64(const char *string, const size_t length, int64_t *value);
+
+/**
+ * Converts an array of numeric views into doubles.
+ *
+ * @param const struct StringView *views
+ *   The numeric views, every character of a view must be part of the number.
+ * @param const size_t count
+ *   The number of views.
+ * @param double *values
+ *   The array that receives the count converted values.
+ *
+ * @return size_t
+ *   The number of views converted, the index of the first invalid view when it is lower than count.
+ */
+size_t stod_batch(const struct StringView *views, const size_t count, double *values);
+
+/**
+ * Converts an array of numeric views into 64-bit integers.
+ *
+ * @param const struct StringView *views
+ *   The numeric views, every character of a view must be part of the integer.
+ * @param const size_t count
+ *   The number of views.
+ * @param int64_t *values
+ *   The array that receives the count converted values.
+ *
+ * @return size_t
+ *   The number of views converted, the index of the first invalid view when it is lower than count.
+ */
+size_t stoi64_batch(const struct StringView *views, const size_t count, int64_t *values);
+
+/**
+ * Writes an array of 64-bit integers into a single packed buffer.
+ *
+ * @param char *buffer
+ *   The destination buffer, of at least count * (ITOS_BUFFER_SIZE - 1) + 1 bytes.
+ * @param const int64_t *values
+ *   The integers to convert.
+ * @param const size_t count
+ *   The number of integers.
+ * @param size_t *offsets
+ *   The array that receives the start of every value and the total length, count + 1 entries, or NULL.
+ *
+ * @return size_t
+ *   The number of characters written, not counting the null character.
+ */
+size_t i64tos_batch(char *buffer, const int64_t *values, const size_t count, size_t *offsets);
+
+/**
+ * Writes an array of doubles into a single packed buffer, as dtos_to() does.
+ *
+ * @param char *buffer
+ *   The destination buffer, of at least count * (DTOS_BUFFER_SIZE - 1) + 1 bytes.
+ * @param const double *values
+ *   The doubles to convert.
+ * @param const size_t count
+ *   The number of doubles.
+ * @param size_t *offsets
+ *   The array that receives the start of every value and the total length, count + 1 entries, or NULL.
+ *
+ * @return size_t
+ *   The number of characters written, not counting the null character.
+ */
+size_t dtos_batch(char *buffer, const double *values, const size_t count, size_t *offsets);
+
+#endif /* NUMERIC_STRING_H */
+
+#ifndef JSON_PARSER_H
+#define JSON_PARSER_H
+
+/**
+ * The maximum nesting of objects and arrays accepted by st_json_parse().
+ */
+#define ST_JSON_MAX_DEPTH 512
+
+/**
+ * Struct definition for the callbacks of the JSON event parser.
+ *
+ * Every callback receives the context given to st_json_parse() and returns 1 to
+ * continue or 0 to stop the parser, NULL callbacks are skipped. The views point
+ * into the tokenizer string and are only valid during the callback, strings are
+ * given without the quotes and still escaped, see st_json_unescape().
+ */
+struct JsonHandler {
+
+  /**
+   * Called on '{'.
+   */
+  int (*start_object)(void *context);
+
+  /**
+   * Called on '}'.
+   */
+  int (*end_object)(void *context);
+
+  /**
+   * Called on '['.
+   */
+  int (*start_array)(void *context);
+
+  /**
+   * Called on ']'.
+   */
+  int (*end_array)(void *context);
+
+  /**
+   * Called on every object key.
+   */
+  int (*key)(void *context, const struct StringView *key);
+
+  /**
+   * Called on every string value.
+   */
+  int (*string)(void *context, const struct StringView *value);
+
+  /**
+   * Called on every number, with the raw characters and the parsed value.
+   */
+  int (*number)(void *context, const struct StringView *raw, double value);
+
+  /**
+   * Called on true and false.
+   */
+  int (*boolean)(void *context, int value);
+
+  /**
+   * Called on null.
+   */
+  int (*null)(void *context);
+};
+
+/**
+ * Parses one JSON value from the cursor position and emits its events.
+ *
+ * No memory is allocated, on success the cursor is left on the last character
+ * of the value so consecutive values can be parsed, on failure it is left on
+ * the offending character.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const struct JsonHandler *handler
+ *   The callbacks to call.
+ * @param void *context
+ *   The context passed to the callbacks.
+ *
+ * @return int
+ *   Returns 1 if a complete value was parsed, 0 on syntax errors or when a
+ *   callback stopped the parser.
+ */
+int st_json_parse(struct StringTokenizer *tokenizer, const struct JsonHandler *handler, void *context);
+
+/**
+ * Unescapes a JSON string into a caller buffer.
+ *
+ * The unescaped string is never longer than the escaped one, so a buffer of
+ * view->len + 1 bytes is always enough.
+ *
+ * @param const struct StringView *view
+ *   The escaped string, without the quotes.
+ * @param char *buffer
+ *   The destination buffer, the result is null-terminated.
+ * @param size_t *length
+ *   Pointer to the variable that receives the unescaped length.
+ *
+ * @return int
+ *   Returns 1 if the string was unescaped, 0 on invalid escape sequences.
+ */
+int st_json_unescape(const struct StringView *view, char *buffer, size_t *length);
+
+/**
+ * Skips the JSON value at the cursor without parsing it.
+ *
+ * Strings, objects and arrays are skipped as a whole, escaped quotes are
+ * honored but the value is not validated. With a structural index the skip
+ * jumps between the indexed positions.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance, the cursor is on the first character of the value.
+ *
+ * @return int
+ *   Returns 1 and leaves the cursor on the last character of the value, or 0
+ *   when the value is not terminated.
+ */
+int st_skip_value(struct StringTokenizer *tokenizer);
+
+/**
+ * Moves the cursor to the value of a key of the current object.
+ *
+ * The search starts from the cursor and only looks at the keys of the current
+ * object, the values of the other keys are skipped with st_skip_value(). Keys
+ * are compared before unescaping.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance, the cursor is on the '{' of the object
+ *   or on the last character of one of its values.
+ * @param const char *key
+ *   The key to find.
+ *
+ * @return int
+ *   Returns 1 and leaves the cursor on the first character of the value, or 0
+ *   when the key was not found, leaving the cursor on the closing '}'.
+ */
+int st_find_key(struct StringTokenizer *tokenizer, const char *key);
 
-#endif /* NUMERIC_STRING_H */
+#endif /* JSON_PARSER_H */
+
+#ifndef STRUCTURAL_INDEX_H
+#define STRUCTURAL_INDEX_H
+
+#include <stdint.h>
+
+/**
+ * Struct definition for the structural index of a JSON string.
+ *
+ * The index holds the positions where tokens start: the structural characters
+ * '{', '}', '[', ']', ':' and ',', both quotes of every string and the first
+ * character of every number or literal. Characters inside strings are masked
+ * out, escaped quotes do not end a string.
+ */
+struct StringStructuralIndex {
+
+  /**
+   * The sorted token start positions.
+   */
+  size_t *positions;
+
+  /**
+   * The number of positions.
+   */
+  size_t count;
+
+  /**
+   * One bit per character, set from the opening quote of a string to the
+   * character before its closing quote.
+   */
+  uint64_t *in_string;
+
+  /**
+   * The length of the indexed string.
+   */
+  size_t length;
+
+  /**
+   * The position index of the last lookup, lookups moving forward are O(1).
+   */
+  size_t hint;
+};
+
+/**
+ * Builds the structural index of the tokenizer string.
+ *
+ * While the index exists st_next_token() jumps over whitespace using it and
+ * st_next_structural() can be used, the cursor functions keep their behavior.
+ * The string must not change while it is indexed, streaming tokenizers can
+ * not be indexed.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ *
+ * @return int
+ *   Returns 1 if the index was built, otherwise 0.
+ */
+int st_build_structural_index(struct StringTokenizer *tokenizer);
+
+/**
+ * Frees the structural index of the tokenizer.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ */
+void st_drop_structural_index(struct StringTokenizer *tokenizer);
+
+/**
+ * Finds the first token start at or after the given position.
+ *
+ * @param struct StringStructuralIndex *index
+ *   Pointer to the index instance.
+ * @param const size_t position
+ *   The position to start from.
+ *
+ * @return size_t
+ *   The position of the token start, or the string length if there is none.
+ */
+size_t st_structural_next(struct StringStructuralIndex *index, const size_t position);
+
+/**
+ * Checks if a character is inside a string.
+ *
+ * @param const struct StringStructuralIndex *index
+ *   Pointer to the index instance.
+ * @param const size_t position
+ *   The position of the character.
+ *
+ * @return int
+ *   Returns 1 if the character is an opening quote or inside a string, otherwise 0.
+ */
+static inline int st_structural_in_string(const struct StringStructuralIndex *index, const size_t position) {
+  return (int)((index->in_string[position / 64] >> (position % 64)) & 1);
+}
+
+/**
+ * String tokenizer, moves the cursor to the start of the next token.
+ *
+ * Strings, numbers and literals are jumped over at once, the cursor goes to the
+ * end of the string when there are no more tokens. Without a structural index
+ * it behaves like st_next_token().
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ */
+void st_next_structural(struct StringTokenizer *tokenizer);
+
+#endif /* STRUCTURAL_INDEX_H */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <sys/uio.h>
+
+/**
+ * The default size of the chunks processed by each worker.
+ */
+#define ST_PARALLEL_CHUNK_SIZE 1048576
+
+/**
+ * The default number of items serialized by each fragment.
+ */
+#define ST_PARALLEL_BATCH_SIZE 1024
+
+/**
+ * The initial size of the fragment buffers.
+ */
+#define ST_PARALLEL_FRAGMENT_SIZE 4096
+
+/**
+ * Struct definition for the callbacks of a parallel job.
+ */
+struct StringParallelHandler {
+
+  /**
+   * Processes a chunk on a worker thread, the tokenizer covers whole lines.
+   * Returns 1 on success or 0 on failure, the result is passed to merge().
+   */
+  int (*process)(void *context, struct StringTokenizer *tokenizer, void **result);
+
+  /**
+   * Merges the result of a chunk on the calling thread, chunks are merged in
+   * order. Returns 1 on success or 0 on failure.
+   */
+  int (*merge)(void *context, void *result);
+};
+
+/**
+ * Processes newline-delimited records on several threads.
+ *
+ * The string is split into chunks that end after a newline, each chunk is
+ * processed by its own tokenizer on a worker thread. Workers take chunks from
+ * their own range and steal from the others when they run out, the results are
+ * merged in order once every chunk was processed. A file can be processed in
+ * place with the string of st_create_from_mmap().
+ *
+ * @param char *string
+ *   The records, it does not need to be null-terminated.
+ * @param const size_t length
+ *   The length of the string.
+ * @param size_t threads
+ *   The number of threads, 0 for the number of online processors.
+ * @param size_t chunk_size
+ *   The approximate size of a chunk, 0 for ST_PARALLEL_CHUNK_SIZE.
+ * @param const struct StringParallelHandler *handler
+ *   The callbacks to call.
+ * @param void *context
+ *   The context passed to the callbacks, shared by every thread.
+ *
+ * @return int
+ *   Returns 1 if every chunk was processed and merged, otherwise 0.
+ */
+int st_parallel_lines(char *string, const size_t length, size_t threads, size_t chunk_size, const struct StringParallelHandler *handler, void *context);
+
+/**
+ * Struct definition for the fragments of a parallel serialization.
+ */
+struct StringFragments {
+
+  /**
+   * The fragments in order, one tokenizer per batch of items.
+   */
+  struct StringTokenizer **fragments;
+
+  /**
+   * The number of fragments.
+   */
+  size_t count;
+
+  /**
+   * The fragments and the separators between them, ready for writev().
+   */
+  struct iovec *iov;
+
+  /**
+   * The number of iovec entries.
+   */
+  size_t iov_count;
+
+  /**
+   * The total length of the serialized items.
+   */
+  size_t length;
+
+  /**
+   * The copy of the separator the iovec entries point to, or NULL.
+   */
+  char *separator;
+};
+
+/**
+ * Serializes items on several threads.
+ *
+ * The items are split into batches, every batch is serialized into its own
+ * st_create_empty() tokenizer by a worker thread, the items are separated by
+ * the separator inside and between the fragments.
+ *
+ * @param struct StringFragments *fragments
+ *   Pointer to the fragments that receive the output, freed with st_fragments_free().
+ * @param const size_t count
+ *   The number of items.
+ * @param size_t threads
+ *   The number of threads, 0 for the number of online processors.
+ * @param size_t batch_size
+ *   The number of items of a fragment, 0 for ST_PARALLEL_BATCH_SIZE.
+ * @param int (*serialize)(void *context, struct StringTokenizer *tokenizer, size_t index)
+ *   Appends the item with the given index to the tokenizer, returns 1 on success.
+ * @param void *context
+ *   The context passed to the callback, shared by every thread.
+ * @param const char *separator
+ *   The separator between items, or NULL. The fragments keep their own copy.
+ *
+ * @return int
+ *   Returns 1 if every item was serialized, otherwise 0.
+ */
+int st_parallel_serialize(struct StringFragments *fragments, const size_t count, size_t threads, size_t batch_size, int (*serialize)(void *context, struct StringTokenizer *tokenizer, size_t index), void *context, const char *separator);
+
+/**
+ * Appends the fragments and their separators to a tokenizer.
+ *
+ * The tokenizer is expanded once, then every fragment is copied.
+ *
+ * @param const struct StringFragments *fragments
+ *   Pointer to the fragments.
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ *
+ * @return int
+ *   Returns 1 if the fragments were appended, otherwise 0.
+ */
+int st_fragments_stitch(const struct StringFragments *fragments, struct StringTokenizer *tokenizer);
+
+/**
+ * Frees the fragments of a parallel serialization.
+ *
+ * @param struct StringFragments *fragments
+ *   Pointer to the fragments.
+ */
+void st_fragments_free(struct StringFragments *fragments);
+
+#endif /* PARALLEL_H */
+
+#ifndef STRING_OUTPUT_H
+#define STRING_OUTPUT_H
+
+#include <sys/uio.h>
+
+/**
+ * The default size of an output block.
+ */
+#define ST_OUTPUT_BLOCK_SIZE 16384
+
+/**
+ * The maximum number of blocks written by a single writev() call.
+ */
+#define ST_OUTPUT_IOV_MAX 64
+
+/**
+ * A block of output, blocks are chained from the oldest to the newest.
+ */
+struct StringOutputBlock;
+
+/**
+ * Struct definition for a chained output buffer.
+ *
+ * Characters are appended to fixed-size blocks instead of one contiguous
+ * string, so the output never gets copied while it grows, and the blocks are
+ * written to the file descriptor with writev().
+ */
+struct StringOutput {
+
+  /**
+   * The oldest block, the next one to be written.
+   */
+  struct StringOutputBlock *head;
+
+  /**
+   * The newest block, the one characters are appended to.
+   */
+  struct StringOutputBlock *tail;
+
+  /**
+   * A written block kept for reuse.
+   */
+  struct StringOutputBlock *spare;
+
+  /**
+   * The size of a block.
+   */
+  size_t block_size;
+
+  /**
+   * The number of characters waiting to be written.
+   */
+  size_t length;
+
+  /**
+   * The number of pending characters that triggers a flush, 0 to disable.
+   */
+  size_t flush_threshold;
+
+  /**
+   * The file descriptor the output is written to, or -1.
+   */
+  int fd;
+
+  /**
+   * The number of characters written to the file descriptor.
+   */
+  size_t written;
+
+  /**
+   * The errno of the last failed write, 0 otherwise.
+   */
+  int error;
+};
+
+/**
+ * Create a new chained output.
+ *
+ * @param const int fd
+ *   The file descriptor the output is written to, or -1 to keep the output in memory.
+ * @param const size_t block_size
+ *   The size of a block, 0 for ST_OUTPUT_BLOCK_SIZE.
+ * @param const size_t flush_threshold
+ *   The number of pending characters that triggers a flush, 0 to flush only on request.
+ *
+ * @return struct StringOutput*
+ *   Pointer to the output instance, or NULL on failure.
+ */
+struct StringOutput *st_output_create(const int fd, const size_t block_size, const size_t flush_threshold);
+
+/**
+ * Returns room for at least the given number of contiguous characters.
+ *
+ * The characters are appended once they are committed by st_output_commit().
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ * @param const size_t size
+ *   The number of characters, at most the block size.
+ *
+ * @return char*
+ *   Pointer to the room, or NULL on failure.
+ */
+char *st_output_reserve(struct StringOutput *output, const size_t size);
+
+/**
+ * Appends the characters written to the room returned by st_output_reserve().
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ * @param const size_t size
+ *   The number of characters written.
+ *
+ * @return int
+ *   Returns 1 on success, 0 if the automatic flush failed.
+ */
+int st_output_commit(struct StringOutput *output, const size_t size);
+
+/**
+ * Appends a string of the given length to the output.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ * @param const char *string
+ *   The characters to append.
+ * @param const size_t length
+ *   The number of characters to append.
+ *
+ * @return int
+ *   Returns 1 on success, otherwise 0.
+ */
+int st_output_append_n(struct StringOutput *output, const char *string, const size_t length);
+
+/**
+ * Appends a null terminated string to the output.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ * @param const char *string
+ *   The string to append.
+ *
+ * @return int
+ *   Returns 1 on success, otherwise 0.
+ */
+int st_output_append_string(struct StringOutput *output, const char *string);
+
+/**
+ * Appends a character to the output.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ * @param const char token
+ *   The character to append.
+ *
+ * @return int
+ *   Returns 1 on success, otherwise 0.
+ */
+int st_output_append_char(struct StringOutput *output, const char token);
+
+/**
+ * Appends the string representation of an integer to the output.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ * @param const int64_t value
+ *   The integer to append.
+ *
+ * @return int
+ *   Returns 1 on success, otherwise 0.
+ */
+int st_output_append_int(struct StringOutput *output, const int64_t value);
+
+/**
+ * Appends the string representation of a double to the output.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ * @param const double value
+ *   The double to append.
+ *
+ * @return int
+ *   Returns 1 on success, otherwise 0.
+ */
+int st_output_append_double(struct StringOutput *output, const double value);
+
+/**
+ * Fills an iovec list with the pending blocks.
+ *
+ * @param const struct StringOutput *output
+ *   Pointer to the output instance.
+ * @param struct iovec *iov
+ *   The list that receives the blocks.
+ * @param const size_t count
+ *   The maximum number of entries.
+ *
+ * @return size_t
+ *   The number of entries filled.
+ */
+size_t st_output_iov(const struct StringOutput *output, struct iovec *iov, const size_t count);
+
+/**
+ * Writes the pending blocks to the file descriptor with writev().
+ *
+ * Partial writes are resumed, the written blocks are released. A write that
+ * makes no progress fails with EIO.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ *
+ * @return int
+ *   Returns 1 if every pending character was written, otherwise 0 and the
+ *   error is kept in output->error.
+ */
+int st_output_flush(struct StringOutput *output);
+
+/**
+ * Discards the pending characters.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ */
+void st_output_reset(struct StringOutput *output);
+
+/**
+ * Frees the output and its blocks, pending characters are not written.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ */
+void st_output_destroy(struct StringOutput *output);
+
+#endif /* STRING_OUTPUT_H */
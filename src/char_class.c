@@ -0,0 +1,55 @@
+#include <string.h>
+#include "../include/strutils.h"
+
+/**
+ * Checks if a byte is within the given range.
+ */
+#define CHAR_CLASS_IN(c, first, last) ((c) >= (first) && (c) <= (last))
+
+/**
+ * The classes of a byte, as a constant expression.
+ */
+#define CHAR_CLASS_OF(c) (                                                                                           \
+  ((c) <= ' ' ? ST_CLASS_WHITESPACE : 0) |                                                                           \
+  (CHAR_CLASS_IN(c, '0', '9') ? ST_CLASS_DIGIT : 0) |                                                                \
+  (CHAR_CLASS_IN(c, '0', '9') || (c) == '-' || (c) == '+' || (c) == '.' || (c) == 'e' || (c) == 'E' ? ST_CLASS_NUMERIC : 0) | \
+  (CHAR_CLASS_IN(c, '0', '9') || CHAR_CLASS_IN(c, 'a', 'f') || CHAR_CLASS_IN(c, 'A', 'F') ? ST_CLASS_HEX : 0) |      \
+  ((c) == '{' || (c) == '}' || (c) == '[' || (c) == ']' || (c) == ':' || (c) == ',' ? ST_CLASS_STRUCTURAL : 0) |     \
+  ((c) < ' ' || (c) == '"' || (c) == '\\' ? ST_CLASS_ESCAPE : 0) |                                                   \
+  (CHAR_CLASS_IN(c, 'a', 'z') || CHAR_CLASS_IN(c, 'A', 'Z') ? ST_CLASS_ALPHA : 0))
+
+/**
+ * The classes of the 16 bytes of a row of the table.
+ */
+#define CHAR_CLASS_ROW(row)                                                                                          \
+  CHAR_CLASS_OF((row) * 16 + 0), CHAR_CLASS_OF((row) * 16 + 1), CHAR_CLASS_OF((row) * 16 + 2),                       \
+  CHAR_CLASS_OF((row) * 16 + 3), CHAR_CLASS_OF((row) * 16 + 4), CHAR_CLASS_OF((row) * 16 + 5),                       \
+  CHAR_CLASS_OF((row) * 16 + 6), CHAR_CLASS_OF((row) * 16 + 7), CHAR_CLASS_OF((row) * 16 + 8),                       \
+  CHAR_CLASS_OF((row) * 16 + 9), CHAR_CLASS_OF((row) * 16 + 10), CHAR_CLASS_OF((row) * 16 + 11),                     \
+  CHAR_CLASS_OF((row) * 16 + 12), CHAR_CLASS_OF((row) * 16 + 13), CHAR_CLASS_OF((row) * 16 + 14),                    \
+  CHAR_CLASS_OF((row) * 16 + 15)
+
+/**
+ * {@inheritdoc}
+ */
+const uint8_t st_char_classes[256] = {
+  CHAR_CLASS_ROW(0), CHAR_CLASS_ROW(1), CHAR_CLASS_ROW(2), CHAR_CLASS_ROW(3),
+  CHAR_CLASS_ROW(4), CHAR_CLASS_ROW(5), CHAR_CLASS_ROW(6), CHAR_CLASS_ROW(7),
+  CHAR_CLASS_ROW(8), CHAR_CLASS_ROW(9), CHAR_CLASS_ROW(10), CHAR_CLASS_ROW(11),
+  CHAR_CLASS_ROW(12), CHAR_CLASS_ROW(13), CHAR_CLASS_ROW(14), CHAR_CLASS_ROW(15),
+};
+
+/**
+ * {@inheritdoc}
+ */
+void st_char_class_init(struct StringCharClass *char_class, const unsigned int classes, const char *members) {
+  for (int i = 0; i < 256; i++) {
+    char_class->members[i] = (st_char_classes[i] & classes) != 0;
+  }
+  if (members == NULL) {
+    return;
+  }
+  for (; *members != '\0'; members++) {
+    char_class->members[(unsigned char)*members] = 1;
+  }
+}
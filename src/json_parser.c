@@ -0,0 +1,543 @@
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+/**
+ * The states of the JSON parser.
+ */
+enum JsonParserState {
+
+  /**
+   * A value is expected.
+   */
+  JSON_PARSER_VALUE,
+
+  /**
+   * A value or the end of the array is expected, after '['.
+   */
+  JSON_PARSER_VALUE_OR_END,
+
+  /**
+   * A key is expected, after ',' in an object.
+   */
+  JSON_PARSER_KEY,
+
+  /**
+   * A key or the end of the object is expected, after '{'.
+   */
+  JSON_PARSER_KEY_OR_END,
+
+  /**
+   * A ',' or the end of the container is expected, after a value.
+   */
+  JSON_PARSER_NEXT,
+};
+
+/**
+ * Gets a view of the string at the cursor, the escape sequences are skipped.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance, the cursor is on the opening quote.
+ * @param struct StringView *view
+ *   Pointer to the view that receives the escaped string.
+ *
+ * @return int
+ *   Returns 1 and leaves the cursor on the closing quote, or 0 on failure.
+ */
+static int json_parser_string(struct StringTokenizer *tokenizer, struct StringView *view) {
+  // The end is relative to the opening quote, the window may move while reading.
+  size_t end = 1;
+  while (1) {
+    size_t available = tokenizer->length - tokenizer->position;
+    if (end < available) {
+      end += st_scan_escape(tokenizer->string + tokenizer->position + end, available - end);
+    }
+    if (end < available) {
+      char token = tokenizer->string[tokenizer->position + end];
+      if (token == '"') {
+        break;
+      }
+      if (token != '\\') {
+        // Control characters must be escaped.
+        return 0;
+      }
+      // Skip the backslash and the escaped character.
+      end += 2;
+    }
+    else if (st_ensure(tokenizer, end + 1) == 0) {
+      // Unterminated string.
+      return 0;
+    }
+  }
+  view->ptr = tokenizer->string + tokenizer->position + 1;
+  view->len = end - 1;
+  tokenizer->position += end;
+  return 1;
+}
+
+/**
+ * Matches a literal at the cursor.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const char *literal
+ *   The literal to match.
+ * @param const size_t length
+ *   The length of the literal.
+ *
+ * @return int
+ *   Returns 1 and leaves the cursor on the last character of the literal, or 0.
+ */
+static int json_parser_literal(struct StringTokenizer *tokenizer, const char *literal, const size_t length) {
+  if (st_ensure(tokenizer, length) == 0 || memcmp(tokenizer->string + tokenizer->position, literal, length) != 0) {
+    return 0;
+  }
+  tokenizer->position += length - 1;
+  return 1;
+}
+
+/**
+ * Checks the JSON number grammar: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+ *
+ * @param const struct StringView *view
+ *   The numeric characters.
+ *
+ * @return int
+ *   Returns 1 if the characters are a JSON number, otherwise 0.
+ */
+static int json_parser_is_number(const struct StringView *view) {
+  const char *p = view->ptr;
+  const char *end = view->ptr + view->len;
+  if (p < end && *p == '-') {
+    p++;
+  }
+  // The integer part has no leading zeros.
+  if (p == end || st_char_is(*p, ST_CLASS_DIGIT) == 0) {
+    return 0;
+  }
+  if (*p++ != '0') {
+    while (p < end && st_char_is(*p, ST_CLASS_DIGIT)) {
+      p++;
+    }
+  }
+  // The fraction and the exponent need at least one digit.
+  if (p < end && *p == '.') {
+    if (++p == end || st_char_is(*p, ST_CLASS_DIGIT) == 0) {
+      return 0;
+    }
+    while (p < end && st_char_is(*p, ST_CLASS_DIGIT)) {
+      p++;
+    }
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    if (++p < end && (*p == '+' || *p == '-')) {
+      p++;
+    }
+    if (p == end || st_char_is(*p, ST_CLASS_DIGIT) == 0) {
+      return 0;
+    }
+    while (p < end && st_char_is(*p, ST_CLASS_DIGIT)) {
+      p++;
+    }
+  }
+  return p == end;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_json_parse(struct StringTokenizer *tokenizer, const struct JsonHandler *handler, void *context) {
+  // The open containers, '{' or '['.
+  char stack[ST_JSON_MAX_DEPTH];
+  size_t depth = 0;
+  enum JsonParserState state = JSON_PARSER_VALUE;
+  struct StringView view;
+  // Skip the whitespaces before the value.
+  if (st_char_is(st_current_token(tokenizer), ST_CLASS_WHITESPACE)) {
+    st_next_token(tokenizer);
+  }
+  while (1) {
+    char token = st_current_token(tokenizer);
+    // Containers are closed by a single character.
+    if (token == '}' && (state == JSON_PARSER_KEY_OR_END || state == JSON_PARSER_NEXT) && depth > 0 && stack[depth - 1] == '{') {
+      depth--;
+      if (handler->end_object != NULL && handler->end_object(context) == 0) {
+        return 0;
+      }
+      state = JSON_PARSER_NEXT;
+    }
+    else if (token == ']' && (state == JSON_PARSER_VALUE_OR_END || state == JSON_PARSER_NEXT) && depth > 0 && stack[depth - 1] == '[') {
+      depth--;
+      if (handler->end_array != NULL && handler->end_array(context) == 0) {
+        return 0;
+      }
+      state = JSON_PARSER_NEXT;
+    }
+    else if (state == JSON_PARSER_NEXT) {
+      // Only a separator can follow a value inside a container.
+      if (token != ',') {
+        return 0;
+      }
+      state = stack[depth - 1] == '{' ? JSON_PARSER_KEY : JSON_PARSER_VALUE;
+      st_next_token(tokenizer);
+      continue;
+    }
+    else if (state == JSON_PARSER_KEY || state == JSON_PARSER_KEY_OR_END) {
+      // Read the key and the colon.
+      if (token != '"' || json_parser_string(tokenizer, &view) == 0) {
+        return 0;
+      }
+      if (handler->key != NULL && handler->key(context, &view) == 0) {
+        return 0;
+      }
+      st_next_token(tokenizer);
+      if (st_current_token(tokenizer) != ':') {
+        return 0;
+      }
+      state = JSON_PARSER_VALUE;
+      st_next_token(tokenizer);
+      continue;
+    }
+    else {
+      // Dispatch the value on its first character.
+      int result;
+      switch (token) {
+        case '{':
+        case '[':
+          if (depth == ST_JSON_MAX_DEPTH) {
+            return 0;
+          }
+          stack[depth++] = token;
+          if (token == '{') {
+            result = handler->start_object == NULL || handler->start_object(context);
+            state = JSON_PARSER_KEY_OR_END;
+          }
+          else {
+            result = handler->start_array == NULL || handler->start_array(context);
+            state = JSON_PARSER_VALUE_OR_END;
+          }
+          if (result == 0) {
+            return 0;
+          }
+          st_next_token(tokenizer);
+          continue;
+
+        case '"':
+          result = json_parser_string(tokenizer, &view) && (handler->string == NULL || handler->string(context, &view));
+          break;
+
+        case 't':
+          result = json_parser_literal(tokenizer, "true", 4) && (handler->boolean == NULL || handler->boolean(context, 1));
+          break;
+
+        case 'f':
+          result = json_parser_literal(tokenizer, "false", 5) && (handler->boolean == NULL || handler->boolean(context, 0));
+          break;
+
+        case 'n':
+          result = json_parser_literal(tokenizer, "null", 4) && (handler->null == NULL || handler->null(context));
+          break;
+
+        default: {
+          double value;
+          result = st_extract_numbers_view(tokenizer, &view) && json_parser_is_number(&view) && stod(view.ptr, view.len, &value) == view.len;
+          result = result && (handler->number == NULL || handler->number(context, &view, value));
+          break;
+        }
+      }
+      if (result == 0) {
+        return 0;
+      }
+      state = JSON_PARSER_NEXT;
+    }
+    // The cursor is on the last character of a complete value.
+    if (depth == 0) {
+      return 1;
+    }
+    st_next_token(tokenizer);
+  }
+}
+
+/**
+ * Skips a value using the structural index.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance, the cursor is on the first character of the value.
+ *
+ * @return int
+ *   Returns 1 and leaves the cursor on the last character of the value, otherwise 0.
+ */
+static int json_parser_skip_indexed(struct StringTokenizer *tokenizer) {
+  struct StringStructuralIndex *index = tokenizer->structural_index;
+  const char *string = tokenizer->string;
+  size_t position = tokenizer->position;
+  char token = string[position];
+  if (token == '"') {
+    // The next token start is the closing quote.
+    position = st_structural_next(index, position + 1);
+    if (position == index->length) {
+      return 0;
+    }
+  }
+  else if (token == '{' || token == '[') {
+    // Walk the indexed positions, the strings hold no structural characters.
+    st_structural_next(index, position);
+    size_t depth = 0;
+    size_t current = index->hint;
+    while (1) {
+      if (current == index->count) {
+        return 0;
+      }
+      token = string[index->positions[current]];
+      if (token == '{' || token == '[') {
+        depth++;
+      }
+      else if ((token == '}' || token == ']') && --depth == 0) {
+        break;
+      }
+      current++;
+    }
+    index->hint = current;
+    position = index->positions[current];
+  }
+  else {
+    // The scalar ends before the next token start and its whitespace.
+    position = st_structural_next(index, position + 1) - 1;
+    while (st_char_is(string[position], ST_CLASS_WHITESPACE)) {
+      position--;
+    }
+  }
+  tokenizer->position = position;
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_skip_value(struct StringTokenizer *tokenizer) {
+  if (st_ensure(tokenizer, 1) == 0) {
+    return 0;
+  }
+  char token = tokenizer->string[tokenizer->position];
+  if (token == '}' || token == ']' || token == ',' || token == ':') {
+    // A closing bracket or a separator, the value is missing.
+    return 0;
+  }
+  if (tokenizer->structural_index != NULL) {
+    return json_parser_skip_indexed(tokenizer);
+  }
+  struct StringView view;
+  if (token == '"') {
+    return json_parser_string(tokenizer, &view);
+  }
+  if (token != '{' && token != '[') {
+    // Scalars end before whitespace or the next structural character.
+    while (st_ensure(tokenizer, 2) == 1) {
+      token = tokenizer->string[tokenizer->position + 1];
+      if ((unsigned char)token <= ' ' || token == ',' || token == '}' || token == ']' || token == ':') {
+        break;
+      }
+      tokenizer->position++;
+    }
+    return 1;
+  }
+  // Count the brackets until the container is closed, the strings are jumped over.
+  size_t depth = 0;
+  while (st_ensure(tokenizer, 1) == 1) {
+    const char *string = tokenizer->string;
+    size_t length = tokenizer->length;
+    size_t position = tokenizer->position;
+    for (; position < length; position++) {
+      token = string[position];
+      if (token == '"') {
+        break;
+      }
+      if (token == '{' || token == '[') {
+        depth++;
+      }
+      else if ((token == '}' || token == ']') && --depth == 0) {
+        tokenizer->position = position;
+        return 1;
+      }
+    }
+    tokenizer->position = position;
+    if (position < length) {
+      if (json_parser_string(tokenizer, &view) == 0) {
+        return 0;
+      }
+      tokenizer->position++;
+    }
+  }
+  return 0;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_find_key(struct StringTokenizer *tokenizer, const char *key) {
+  size_t key_length = strlen(key);
+  struct StringView view;
+  // Move to the first key, or past the current value.
+  char token = st_current_token(tokenizer);
+  if (token != '{') {
+    st_next_token(tokenizer);
+    token = st_current_token(tokenizer);
+    if (token != ',') {
+      return 0;
+    }
+  }
+  st_next_token(tokenizer);
+  while (st_current_token(tokenizer) == '"') {
+    if (json_parser_string(tokenizer, &view) == 0) {
+      return 0;
+    }
+    int found = view.len == key_length && memcmp(view.ptr, key, key_length) == 0;
+    st_next_token(tokenizer);
+    if (st_current_token(tokenizer) != ':') {
+      return 0;
+    }
+    st_next_token(tokenizer);
+    if (found) {
+      return 1;
+    }
+    // Skip the value and the separator.
+    if (st_skip_value(tokenizer) == 0) {
+      return 0;
+    }
+    st_next_token(tokenizer);
+    if (st_current_token(tokenizer) != ',') {
+      return 0;
+    }
+    st_next_token(tokenizer);
+  }
+  return 0;
+}
+
+/**
+ * Parses the four hexadecimal digits of a \u escape sequence.
+ *
+ * @param const char *digits
+ *   Pointer to the digits.
+ *
+ * @return long
+ *   The code unit, or -1 on invalid digits.
+ */
+static long json_parser_hex4(const char *digits) {
+  long value = 0;
+  for (int i = 0; i < 4; i++) {
+    char token = digits[i];
+    int digit;
+    if (token >= '0' && token <= '9') {
+      digit = token - '0';
+    }
+    else if (token >= 'a' && token <= 'f') {
+      digit = token - 'a' + 10;
+    }
+    else if (token >= 'A' && token <= 'F') {
+      digit = token - 'A' + 10;
+    }
+    else {
+      return -1;
+    }
+    value = (value << 4) | digit;
+  }
+  return value;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_json_unescape(const struct StringView *view, char *buffer, size_t *length) {
+  const char *string = view->ptr;
+  size_t index = 0;
+  size_t written = 0;
+  while (index < view->len) {
+    // Copy the characters up to the next escape sequence at once.
+    const char *backslash = (const char *)memchr(string + index, '\\', view->len - index);
+    size_t run = backslash != NULL ? (size_t)(backslash - string) - index : view->len - index;
+    memcpy(buffer + written, string + index, run);
+    written += run;
+    index += run;
+    if (index == view->len) {
+      break;
+    }
+    if (index + 1 == view->len) {
+      return 0;
+    }
+    char token = string[index + 1];
+    index += 2;
+    switch (token) {
+      case '"':
+      case '\\':
+      case '/':
+        buffer[written++] = token;
+        break;
+
+      case 'b':
+        buffer[written++] = '\b';
+        break;
+
+      case 'f':
+        buffer[written++] = '\f';
+        break;
+
+      case 'n':
+        buffer[written++] = '\n';
+        break;
+
+      case 'r':
+        buffer[written++] = '\r';
+        break;
+
+      case 't':
+        buffer[written++] = '\t';
+        break;
+
+      case 'u': {
+        long code = index + 4 <= view->len ? json_parser_hex4(string + index) : -1;
+        if (code < 0) {
+          return 0;
+        }
+        index += 4;
+        // Join the surrogate pairs.
+        if (code >= 0xD800 && code <= 0xDBFF) {
+          long low = index + 6 <= view->len && string[index] == '\\' && string[index + 1] == 'u' ? json_parser_hex4(string + index + 2) : -1;
+          if (low < 0xDC00 || low > 0xDFFF) {
+            return 0;
+          }
+          code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+          index += 6;
+        }
+        else if (code >= 0xDC00 && code <= 0xDFFF) {
+          return 0;
+        }
+        // Encode the code point as UTF-8.
+        if (code < 0x80) {
+          buffer[written++] = (char)code;
+        }
+        else if (code < 0x800) {
+          buffer[written++] = (char)(0xC0 | (code >> 6));
+          buffer[written++] = (char)(0x80 | (code & 0x3F));
+        }
+        else if (code < 0x10000) {
+          buffer[written++] = (char)(0xE0 | (code >> 12));
+          buffer[written++] = (char)(0x80 | ((code >> 6) & 0x3F));
+          buffer[written++] = (char)(0x80 | (code & 0x3F));
+        }
+        else {
+          buffer[written++] = (char)(0xF0 | (code >> 18));
+          buffer[written++] = (char)(0x80 | ((code >> 12) & 0x3F));
+          buffer[written++] = (char)(0x80 | ((code >> 6) & 0x3F));
+          buffer[written++] = (char)(0x80 | (code & 0x3F));
+        }
+        break;
+      }
+
+      default:
+        return 0;
+    }
+  }
+  buffer[written] = '\0';
+  *length = written;
+  return 1;
+}
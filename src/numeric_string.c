@@ -1,23 +1,125 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include "../include/strutils.h"
 
 #define NUMERIC_STRING_MAX_SIZE 100
 #define NUMERIC_STRING_PRECISION 13
 
+/**
+ * The decimal digits of every number from 0 to 99, two characters each.
+ */
+static const char numeric_string_digit_pairs[] =
+  "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+  "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+/**
+ * The powers of ten that fit in 64 bits, 0 stands for 10^0 in the digit count.
+ */
+static const uint64_t numeric_string_powers_of_ten[] = {
+  0ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+  1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+  100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+  1000000000000000000ULL, 10000000000000000000ULL,
+};
+
+/**
+ * Counts the decimal digits of the given value.
+ *
+ * The bit length approximates log10 (1233 / 4096 ~ log10(2)), a single comparison
+ * against the table corrects it.
+ *
+ * @param uint64_t value
+ *   The value to measure.
+ *
+ * @return int
+ *   The number of decimal digits, 1 for zero.
+ */
+static inline int numeric_string_count_digits(uint64_t value) {
+  int bits = 64 - __builtin_clzll(value | 1);
+  int digits = (bits * 1233) >> 12;
+  return digits - (value < numeric_string_powers_of_ten[digits]) + 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t u64tos_to(char *buffer, uint64_t value) {
+  size_t length = numeric_string_count_digits(value);
+  char *p = buffer + length;
+  *p = '\0';
+  // Write two digits per step, from the least significant ones.
+  while (value >= 100) {
+    const char *pair = numeric_string_digit_pairs + (value % 100) * 2;
+    value /= 100;
+    *--p = pair[1];
+    *--p = pair[0];
+  }
+  if (value >= 10) {
+    const char *pair = numeric_string_digit_pairs + value * 2;
+    *--p = pair[1];
+    *--p = pair[0];
+  }
+  else {
+    *--p = (char)('0' + value);
+  }
+  return length;
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t i64tos_to(char *buffer, int64_t value) {
+  if (value < 0) {
+    buffer[0] = '-';
+    // Negate in unsigned arithmetic, INT64_MIN has no positive counterpart.
+    return u64tos_to(buffer + 1, 0 - (uint64_t)value) + 1;
+  }
+  return u64tos_to(buffer, (uint64_t)value);
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t i64tos_batch(char *buffer, const int64_t *values, const size_t count, size_t *offsets) {
+  size_t length = 0;
+  buffer[0] = '\0';
+  for (size_t i = 0; i < count; i++) {
+    if (offsets != NULL) {
+      offsets[i] = length;
+    }
+    // Each value overwrites the null character of the previous one.
+    length += i64tos_to(buffer + length, values[i]);
+  }
+  if (offsets != NULL) {
+    offsets[count] = length;
+  }
+  return length;
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t itos_to(char *buffer, int value) {
+  return i64tos_to(buffer, value);
+}
+
 /**
  * {@inheritdoc}
  */
 char *itos(int value) {
-  // Estimate the buffer size needed for the conversion
-  size_t buffer_size = snprintf(NULL, 0, "%d", value) + 1;
-  char *str = (char *)malloc(buffer_size);
+  // Convert the value on the stack, then allocate the exact size.
+  char buffer[ITOS_BUFFER_SIZE];
+  uint64_t start = ST_STATS_CLOCK(NULL);
+  size_t length = itos_to(buffer, value);
+  ST_STATS_SINCE(NULL, start);
+  char *str = (char *)malloc(length + sizeof(""));
+  ST_STATS_ADD(NULL, allocations, 1);
   if (str == NULL) {
     return NULL; // Memory allocation failed
   }
-  // @todo: sprintf's approach is slow, look for a faster and more robust solution.
-  snprintf(str, buffer_size, "%d", value);
+  memcpy(str, buffer, length + sizeof(""));
   return str;
 }
 
@@ -25,12 +127,25 @@ char *itos(int value) {
  * {@inheritdoc}
  */
 char *ldtos(long double value) {
-  // Allocate memory for the resulting string.
-  char *str = (char *)malloc(NUMERIC_STRING_MAX_SIZE);
+  // Convert the value on the stack, then allocate the exact size.
+  char buffer[DTOS_FIXED_BUFFER_SIZE];
+  size_t length;
+  uint64_t start = ST_STATS_CLOCK(NULL);
+  if ((long double)(double)value == value) {
+    // The value is a double, its digits do not need the long double formatter.
+    length = dtos_fixed_to(buffer, (double)value, NUMERIC_STRING_PRECISION);
+  }
+  else {
+    snprintf(buffer, NUMERIC_STRING_MAX_SIZE, "%.*Lf", NUMERIC_STRING_PRECISION, value);
+    length = strlen(buffer);
+  }
+  ST_STATS_SINCE(NULL, start);
+  char *str = (char *)malloc(length + sizeof(""));
+  ST_STATS_ADD(NULL, allocations, 1);
   if (str == NULL) {
     return NULL; // Memory allocation failed
   }
-  snprintf(str, NUMERIC_STRING_MAX_SIZE, "%.*Lf", NUMERIC_STRING_PRECISION, value);
+  memcpy(str, buffer, length + sizeof(""));
   return str;
 }
 
@@ -40,7 +155,9 @@ char *ldtos(long double value) {
 long double stold(const char *numeric_string) {
   char *endptr;
   errno = 0; // Reset errno before the call
+  uint64_t start = ST_STATS_CLOCK(NULL);
   long double value = strtold(numeric_string, &endptr);
+  ST_STATS_SINCE(NULL, start);
 
   if (errno != 0) {
     return 0; // Conversion error occurred
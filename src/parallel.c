@@ -0,0 +1,434 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "../include/strutils.h"
+
+struct ParallelJob;
+
+/**
+ * Struct definition for a worker of a parallel job.
+ */
+struct ParallelWorker {
+
+  /**
+   * Protects the range of chunks of the worker.
+   */
+  pthread_mutex_t lock;
+
+  /**
+   * The next chunk taken by the worker.
+   */
+  size_t next;
+
+  /**
+   * The end of the range, thieves take chunks from here.
+   */
+  size_t end;
+
+  /**
+   * The worker thread.
+   */
+  pthread_t thread;
+
+  /**
+   * The position of the worker in the job.
+   */
+  size_t id;
+
+  /**
+   * The job of the worker.
+   */
+  struct ParallelJob *job;
+
+  /**
+   * The tokenizer reused by the worker for its chunks, NULL until needed.
+   */
+  struct StringTokenizer *tokenizer;
+};
+
+/**
+ * Struct definition for a parallel job.
+ */
+struct ParallelJob {
+
+  /**
+   * Processes one chunk, returns 1 on success.
+   */
+  int (*work)(struct ParallelJob *job, struct ParallelWorker *worker, const size_t chunk);
+
+  /**
+   * The workers, the first one runs on the calling thread.
+   */
+  struct ParallelWorker *workers;
+
+  /**
+   * The number of workers.
+   */
+  size_t count;
+
+  /**
+   * Flag set when a chunk failed.
+   */
+  int failed;
+
+  /**
+   * The records string.
+   */
+  char *string;
+
+  /**
+   * The chunk boundaries, chunk i covers bounds[i] to bounds[i + 1].
+   */
+  size_t *bounds;
+
+  /**
+   * The results of the chunks.
+   */
+  void **results;
+
+  /**
+   * The callbacks of the lines job.
+   */
+  const struct StringParallelHandler *handler;
+
+  /**
+   * The context passed to the callbacks.
+   */
+  void *context;
+
+  /**
+   * The number of items of the serialize job.
+   */
+  size_t items;
+
+  /**
+   * The number of items of a fragment.
+   */
+  size_t batch_size;
+
+  /**
+   * Appends an item to a fragment.
+   */
+  int (*serialize)(void *context, struct StringTokenizer *tokenizer, size_t index);
+
+  /**
+   * The separator between items.
+   */
+  struct StringView separator;
+
+  /**
+   * The fragments of the serialize job.
+   */
+  struct StringTokenizer **fragments;
+};
+
+/**
+ * Takes the next chunk of a worker, or steals one from another worker.
+ *
+ * @param struct ParallelWorker *worker
+ *   Pointer to the worker.
+ * @param size_t *chunk
+ *   Pointer to the variable that receives the chunk.
+ *
+ * @return int
+ *   Returns 1 if a chunk was taken, 0 when there is no work left.
+ */
+static int parallel_take(struct ParallelWorker *worker, size_t *chunk) {
+  int taken = 0;
+  // Own chunks are taken from the front of the range.
+  pthread_mutex_lock(&worker->lock);
+  if (worker->next < worker->end) {
+    *chunk = worker->next++;
+    taken = 1;
+  }
+  pthread_mutex_unlock(&worker->lock);
+  // Stolen chunks are taken from the back, far from where the owner works.
+  struct ParallelJob *job = worker->job;
+  for (size_t i = 1; i < job->count && taken == 0; i++) {
+    struct ParallelWorker *victim = &job->workers[(worker->id + i) % job->count];
+    pthread_mutex_lock(&victim->lock);
+    if (victim->next < victim->end) {
+      *chunk = --victim->end;
+      taken = 1;
+    }
+    pthread_mutex_unlock(&victim->lock);
+  }
+  return taken;
+}
+
+/**
+ * Runs the chunks of a worker until there is no work left.
+ *
+ * @param void *argument
+ *   Pointer to the worker.
+ *
+ * @return void*
+ *   Always NULL.
+ */
+static void *parallel_worker_run(void *argument) {
+  struct ParallelWorker *worker = (struct ParallelWorker *)argument;
+  struct ParallelJob *job = worker->job;
+  size_t chunk;
+  while (parallel_take(worker, &chunk) == 1) {
+    if (job->work(job, worker, chunk) == 0) {
+      __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Runs a job, the chunks are split evenly between the workers.
+ *
+ * @param struct ParallelJob *job
+ *   Pointer to the job.
+ * @param size_t threads
+ *   The number of threads, 0 for the number of online processors.
+ * @param const size_t chunks
+ *   The number of chunks.
+ *
+ * @return int
+ *   Returns 1 if every chunk succeeded, otherwise 0.
+ */
+static int parallel_run(struct ParallelJob *job, size_t threads, const size_t chunks) {
+  if (threads == 0) {
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = processors > 0 ? (size_t)processors : 1;
+  }
+  if (threads > chunks) {
+    threads = chunks > 0 ? chunks : 1;
+  }
+  job->workers = (struct ParallelWorker *)malloc(threads * sizeof(struct ParallelWorker));
+  if (job->workers == NULL) {
+    return 0;
+  }
+  job->count = threads;
+  job->failed = 0;
+  for (size_t i = 0; i < threads; i++) {
+    struct ParallelWorker *worker = &job->workers[i];
+    pthread_mutex_init(&worker->lock, NULL);
+    worker->next = chunks * i / threads;
+    worker->end = chunks * (i + 1) / threads;
+    worker->id = i;
+    worker->job = job;
+    worker->tokenizer = NULL;
+  }
+  // The calling thread is the first worker.
+  size_t started = 1;
+  for (; started < threads; started++) {
+    if (pthread_create(&job->workers[started].thread, NULL, parallel_worker_run, &job->workers[started]) != 0) {
+      // The running workers steal the chunks of the missing ones.
+      break;
+    }
+  }
+  parallel_worker_run(&job->workers[0]);
+  for (size_t i = 1; i < started; i++) {
+    pthread_join(job->workers[i].thread, NULL);
+  }
+  // The workers that could not start left their chunks behind.
+  for (size_t i = started; i < threads; i++) {
+    parallel_worker_run(&job->workers[i]);
+  }
+  for (size_t i = 0; i < threads; i++) {
+    pthread_mutex_destroy(&job->workers[i].lock);
+    st_destroy(job->workers[i].tokenizer);
+  }
+  free(job->workers);
+  return job->failed == 0;
+}
+
+/**
+ * Processes a chunk of lines with the tokenizer of the worker.
+ */
+static int parallel_lines_work(struct ParallelJob *job, struct ParallelWorker *worker, const size_t chunk) {
+  char *string = job->string + job->bounds[chunk];
+  size_t length = job->bounds[chunk + 1] - job->bounds[chunk];
+  job->results[chunk] = NULL;
+  // The tokenizer of the worker is rebound to every chunk.
+  if (worker->tokenizer == NULL) {
+    worker->tokenizer = st_create_n(string, length);
+    if (worker->tokenizer == NULL) {
+      return 0;
+    }
+  }
+  else if (st_rebind(worker->tokenizer, string, length) == 0) {
+    return 0;
+  }
+  return job->handler->process(job->context, worker->tokenizer, &job->results[chunk]);
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_parallel_lines(char *string, const size_t length, size_t threads, size_t chunk_size, const struct StringParallelHandler *handler, void *context) {
+  if (string == NULL || length == 0) {
+    return 1;
+  }
+  if (chunk_size == 0) {
+    chunk_size = ST_PARALLEL_CHUNK_SIZE;
+  }
+  // Split the string after the first newline that follows every chunk size.
+  size_t capacity = length / chunk_size + 2;
+  size_t *bounds = (size_t *)malloc(capacity * sizeof(size_t));
+  if (bounds == NULL) {
+    return 0;
+  }
+  size_t chunks = 0;
+  size_t start = 0;
+  bounds[0] = 0;
+  while (start < length) {
+    size_t end = length;
+    if (length - start > chunk_size) {
+      const char *newline = (const char *)memchr(string + start + chunk_size - 1, '\n', length - start - chunk_size + 1);
+      end = newline != NULL ? (size_t)(newline - string) + 1 : length;
+    }
+    bounds[++chunks] = end;
+    start = end;
+  }
+  struct ParallelJob job;
+  job.work = parallel_lines_work;
+  job.string = string;
+  job.bounds = bounds;
+  job.handler = handler;
+  job.context = context;
+  job.results = (void **)calloc(chunks, sizeof(void *));
+  if (job.results == NULL) {
+    free(bounds);
+    return 0;
+  }
+  int processed = parallel_run(&job, threads, chunks);
+  // Merge the results in order.
+  int merged = 1;
+  for (size_t i = 0; i < chunks; i++) {
+    if (handler->merge != NULL && handler->merge(context, job.results[i]) == 0) {
+      merged = 0;
+    }
+  }
+  free(job.results);
+  free(bounds);
+  return processed && merged;
+}
+
+/**
+ * Serializes a batch of items into its own fragment.
+ */
+static int parallel_serialize_work(struct ParallelJob *job, struct ParallelWorker *worker, const size_t chunk) {
+  // Every fragment owns its tokenizer, the worker state is not needed.
+  (void)worker;
+  struct StringTokenizer *tokenizer = st_create_empty(ST_PARALLEL_FRAGMENT_SIZE);
+  job->fragments[chunk] = tokenizer;
+  if (tokenizer == NULL) {
+    return 0;
+  }
+  size_t first = chunk * job->batch_size;
+  size_t last = first + job->batch_size < job->items ? first + job->batch_size : job->items;
+  for (size_t index = first; index < last; index++) {
+    if (index > first && st_append_n(tokenizer, job->separator.ptr, job->separator.len) == 0) {
+      return 0;
+    }
+    if (job->serialize(job->context, tokenizer, index) == 0) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_parallel_serialize(struct StringFragments *fragments, const size_t count, size_t threads, size_t batch_size, int (*serialize)(void *context, struct StringTokenizer *tokenizer, size_t index), void *context, const char *separator) {
+  if (batch_size == 0) {
+    batch_size = ST_PARALLEL_BATCH_SIZE;
+  }
+  size_t chunks = (count + batch_size - 1) / batch_size;
+  fragments->count = chunks;
+  fragments->iov_count = 0;
+  fragments->length = 0;
+  fragments->iov = NULL;
+  fragments->separator = NULL;
+  fragments->fragments = (struct StringTokenizer **)calloc(chunks > 0 ? chunks : 1, sizeof(struct StringTokenizer *));
+  if (fragments->fragments == NULL) {
+    fragments->count = 0;
+    return 0;
+  }
+  // The iovec entries outlive the caller's separator, they point to a copy.
+  struct StringView separator_view = sv_from_string(separator != NULL ? separator : "");
+  if (separator_view.len > 0) {
+    fragments->separator = sv_to_string(&separator_view);
+    if (fragments->separator == NULL) {
+      return 0;
+    }
+    separator_view.ptr = fragments->separator;
+  }
+  if (chunks == 0) {
+    return 1;
+  }
+  // Serialize the batches.
+  struct ParallelJob job;
+  job.work = parallel_serialize_work;
+  job.items = count;
+  job.batch_size = batch_size;
+  job.serialize = serialize;
+  job.context = context;
+  job.separator = separator_view;
+  job.fragments = fragments->fragments;
+  if (parallel_run(&job, threads, chunks) == 0) {
+    return 0;
+  }
+  // List the fragments and the separators between them.
+  fragments->iov = (struct iovec *)malloc((2 * chunks - 1) * sizeof(struct iovec));
+  if (fragments->iov == NULL) {
+    return 0;
+  }
+  for (size_t i = 0; i < chunks; i++) {
+    if (i > 0 && job.separator.len > 0) {
+      fragments->iov[fragments->iov_count].iov_base = (void *)job.separator.ptr;
+      fragments->iov[fragments->iov_count++].iov_len = job.separator.len;
+      fragments->length += job.separator.len;
+    }
+    fragments->iov[fragments->iov_count].iov_base = fragments->fragments[i]->string;
+    fragments->iov[fragments->iov_count++].iov_len = fragments->fragments[i]->position;
+    fragments->length += fragments->fragments[i]->position;
+  }
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_fragments_stitch(const struct StringFragments *fragments, struct StringTokenizer *tokenizer) {
+  if (fragments->iov_count == 0) {
+    return fragments->count == 0;
+  }
+  // Expand the tokenizer once, the views are copied one after the other.
+  struct StringView *views = (struct StringView *)malloc(fragments->iov_count * sizeof(struct StringView));
+  if (views == NULL) {
+    return 0;
+  }
+  for (size_t i = 0; i < fragments->iov_count; i++) {
+    views[i].ptr = (const char *)fragments->iov[i].iov_base;
+    views[i].len = fragments->iov[i].iov_len;
+  }
+  int appended = st_append_many(tokenizer, views, fragments->iov_count);
+  free(views);
+  return appended;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_fragments_free(struct StringFragments *fragments) {
+  for (size_t i = 0; i < fragments->count; i++) {
+    st_destroy(fragments->fragments[i]);
+  }
+  free(fragments->fragments);
+  free(fragments->iov);
+  free(fragments->separator);
+  fragments->fragments = NULL;
+  fragments->iov = NULL;
+  fragments->separator = NULL;
+  fragments->count = 0;
+  fragments->iov_count = 0;
+  fragments->length = 0;
+}
@@ -0,0 +1,178 @@
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+/**
+ * The alignment of the arena allocations.
+ */
+#define STRING_ARENA_ALIGNMENT _Alignof(max_align_t)
+
+/**
+ * Struct definition for a block of arena memory.
+ */
+struct StringArenaBlock {
+
+  /**
+   * The previous block of the arena.
+   */
+  struct StringArenaBlock *next;
+
+  /**
+   * The number of usable bytes in the block.
+   */
+  size_t size;
+
+  /**
+   * The number of bytes handed out from the block.
+   */
+  size_t used;
+
+  /**
+   * The usable bytes.
+   */
+  _Alignas(max_align_t) char data[];
+};
+
+/**
+ * The released arenas of the calling thread.
+ */
+static _Thread_local struct StringArena *string_arena_pool[ST_ARENA_POOL_SIZE];
+
+/**
+ * The number of arenas in the pool of the calling thread.
+ */
+static _Thread_local size_t string_arena_pool_count = 0;
+
+/**
+ * {@inheritdoc}
+ */
+struct StringArena *st_arena_create(const size_t block_size) {
+  struct StringArena *arena = (struct StringArena *)malloc(sizeof(struct StringArena));
+  ST_STATS_ADD(NULL, allocations, 1);
+  if (arena != NULL) {
+    arena->head = NULL;
+    arena->block_size = block_size > 0 ? block_size : ST_ARENA_BLOCK_SIZE;
+    arena->used = 0;
+  }
+  return arena;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void *st_arena_alloc(struct StringArena *arena, const size_t size) {
+  // Round the size up, so the next allocation stays aligned.
+  size_t aligned_size = (size + STRING_ARENA_ALIGNMENT - 1) & ~(STRING_ARENA_ALIGNMENT - 1);
+  if (aligned_size < size) {
+    return NULL;
+  }
+  struct StringArenaBlock *block = arena->head;
+  if (block == NULL || block->size - block->used < aligned_size) {
+    // Blocks double in size, so a steady workload settles on a single block.
+    size_t block_size = block != NULL ? block->size * 2 : arena->block_size;
+    if (block_size < aligned_size) {
+      block_size = aligned_size;
+    }
+    block = (struct StringArenaBlock *)malloc(sizeof(struct StringArenaBlock) + block_size);
+    ST_STATS_ADD(NULL, allocations, 1);
+    if (block == NULL) {
+      return NULL;
+    }
+    block->next = arena->head;
+    block->size = block_size;
+    block->used = 0;
+    arena->head = block;
+  }
+  void *memory = block->data + block->used;
+  block->used += aligned_size;
+  arena->used += aligned_size;
+  return memory;
+}
+
+/**
+ * {@inheritdoc}
+ */
+char *st_arena_string(struct StringArena *arena, const struct StringView *view) {
+  char *string = (char *)st_arena_alloc(arena, view->len + sizeof(""));
+  if (string == NULL) {
+    return NULL;
+  }
+  // Copy the characters and zero/null terminate the string.
+  if (view->len > 0) {
+    memcpy(string, view->ptr, view->len);
+  }
+  string[view->len] = '\0';
+  return string;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_arena_reset(struct StringArena *arena) {
+  struct StringArenaBlock *block = arena->head;
+  if (block == NULL) {
+    return;
+  }
+  // Keep the newest block, it is the biggest one.
+  struct StringArenaBlock *next = block->next;
+  while (next != NULL) {
+    struct StringArenaBlock *previous = next->next;
+    free(next);
+    next = previous;
+  }
+  block->next = NULL;
+  block->used = 0;
+  arena->used = 0;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_arena_destroy(struct StringArena *arena) {
+  if (arena == NULL) {
+    return;
+  }
+  struct StringArenaBlock *block = arena->head;
+  while (block != NULL) {
+    struct StringArenaBlock *next = block->next;
+    free(block);
+    block = next;
+  }
+  free(arena);
+}
+
+/**
+ * {@inheritdoc}
+ */
+struct StringArena *st_arena_acquire(void) {
+  if (string_arena_pool_count > 0) {
+    return string_arena_pool[--string_arena_pool_count];
+  }
+  return st_arena_create(0);
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_arena_release(struct StringArena *arena) {
+  if (arena == NULL) {
+    return;
+  }
+  if (string_arena_pool_count == ST_ARENA_POOL_SIZE) {
+    // The pool is full.
+    st_arena_destroy(arena);
+    return;
+  }
+  st_arena_reset(arena);
+  string_arena_pool[string_arena_pool_count++] = arena;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_arena_pool_clear(void) {
+  while (string_arena_pool_count > 0) {
+    st_arena_destroy(string_arena_pool[--string_arena_pool_count]);
+  }
+}
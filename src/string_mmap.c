@@ -0,0 +1,43 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../include/strutils.h"
+
+/**
+ * {@inheritdoc}
+ */
+struct StringTokenizer *st_create_from_mmap(const char *path) {
+  if (path == NULL) {
+    return NULL;
+  }
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return NULL;
+  }
+  // Empty files can not be mapped, like empty strings can not be tokenized.
+  struct stat status;
+  if (fstat(fd, &status) != 0 || status.st_size <= 0) {
+    close(fd);
+    return NULL;
+  }
+  size_t length = (size_t)status.st_size;
+  void *string = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping stays valid after the descriptor is closed.
+  close(fd);
+  if (string == MAP_FAILED) {
+    return NULL;
+  }
+  // The tokenizer reads the file front to back, the hints are best effort.
+  madvise(string, length, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+  madvise(string, length, MADV_HUGEPAGE);
+#endif
+  struct StringTokenizer *tokenizer = st_create_n((char *)string, length);
+  if (tokenizer == NULL) {
+    munmap(string, length);
+    return NULL;
+  }
+  tokenizer->ownership = ST_STRING_MAPPED;
+  return tokenizer;
+}
@@ -0,0 +1,300 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include "../include/strutils.h"
+
+/**
+ * Struct definition for a block of output.
+ */
+struct StringOutputBlock {
+
+  /**
+   * The next, newer, block of the output.
+   */
+  struct StringOutputBlock *next;
+
+  /**
+   * The first character that was not written yet.
+   */
+  size_t start;
+
+  /**
+   * The number of characters appended to the block.
+   */
+  size_t used;
+
+  /**
+   * The characters.
+   */
+  char data[];
+};
+
+/**
+ * Releases a written block, one block is kept for reuse.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ * @param struct StringOutputBlock *block
+ *   The block to release.
+ */
+static void string_output_release(struct StringOutput *output, struct StringOutputBlock *block) {
+  if (output->spare == NULL) {
+    output->spare = block;
+    return;
+  }
+  free(block);
+}
+
+/**
+ * Chains a new block after the tail.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ *
+ * @return struct StringOutputBlock*
+ *   Pointer to the new tail, or NULL on failure.
+ */
+static struct StringOutputBlock *string_output_grow(struct StringOutput *output) {
+  struct StringOutputBlock *block = output->spare;
+  if (block != NULL) {
+    output->spare = NULL;
+  }
+  else {
+    block = (struct StringOutputBlock *)malloc(sizeof(struct StringOutputBlock) + output->block_size);
+    if (block == NULL) {
+      return NULL;
+    }
+  }
+  block->next = NULL;
+  block->start = 0;
+  block->used = 0;
+  if (output->tail != NULL) {
+    output->tail->next = block;
+  }
+  else {
+    output->head = block;
+  }
+  output->tail = block;
+  return block;
+}
+
+/**
+ * Flushes the output once the pending characters reach the threshold.
+ *
+ * @param struct StringOutput *output
+ *   Pointer to the output instance.
+ *
+ * @return int
+ *   Returns 0 if the flush failed, otherwise 1.
+ */
+static int string_output_auto_flush(struct StringOutput *output) {
+  if (output->flush_threshold == 0 || output->fd < 0 || output->length < output->flush_threshold) {
+    return 1;
+  }
+  return st_output_flush(output);
+}
+
+/**
+ * {@inheritdoc}
+ */
+struct StringOutput *st_output_create(const int fd, const size_t block_size, const size_t flush_threshold) {
+  struct StringOutput *output = (struct StringOutput *)malloc(sizeof(struct StringOutput));
+  if (output != NULL) {
+    output->head = NULL;
+    output->tail = NULL;
+    output->spare = NULL;
+    output->block_size = block_size > 0 ? block_size : ST_OUTPUT_BLOCK_SIZE;
+    output->length = 0;
+    output->flush_threshold = flush_threshold;
+    output->fd = fd;
+    output->written = 0;
+    output->error = 0;
+  }
+  return output;
+}
+
+/**
+ * {@inheritdoc}
+ */
+char *st_output_reserve(struct StringOutput *output, const size_t size) {
+  if (size > output->block_size) {
+    return NULL;
+  }
+  struct StringOutputBlock *block = output->tail;
+  // The rest of the tail is left unused when the room does not fit in it.
+  if (block == NULL || output->block_size - block->used < size) {
+    block = string_output_grow(output);
+    if (block == NULL) {
+      return NULL;
+    }
+  }
+  return block->data + block->used;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_output_commit(struct StringOutput *output, const size_t size) {
+  output->tail->used += size;
+  output->length += size;
+  return string_output_auto_flush(output);
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_output_append_n(struct StringOutput *output, const char *string, const size_t length) {
+  size_t copied = 0;
+  while (copied < length) {
+    struct StringOutputBlock *block = output->tail;
+    if (block == NULL || block->used == output->block_size) {
+      block = string_output_grow(output);
+      if (block == NULL) {
+        return 0;
+      }
+    }
+    // Fill the tail, the rest goes to the next block.
+    size_t count = output->block_size - block->used;
+    if (count > length - copied) {
+      count = length - copied;
+    }
+    memcpy(block->data + block->used, string + copied, count);
+    block->used += count;
+    output->length += count;
+    copied += count;
+  }
+  return string_output_auto_flush(output);
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_output_append_string(struct StringOutput *output, const char *string) {
+  return st_output_append_n(output, string, strlen(string));
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_output_append_char(struct StringOutput *output, const char token) {
+  return st_output_append_n(output, &token, 1);
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_output_append_int(struct StringOutput *output, const int64_t value) {
+  // Convert straight into the tail when the longest integer string fits.
+  char *room = output->block_size >= ITOS_BUFFER_SIZE ? st_output_reserve(output, ITOS_BUFFER_SIZE) : NULL;
+  if (room != NULL) {
+    return st_output_commit(output, i64tos_to(room, value));
+  }
+  char buffer[ITOS_BUFFER_SIZE];
+  return st_output_append_n(output, buffer, i64tos_to(buffer, value));
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_output_append_double(struct StringOutput *output, const double value) {
+  // Convert straight into the tail when the longest double string fits.
+  char *room = output->block_size >= DTOS_BUFFER_SIZE ? st_output_reserve(output, DTOS_BUFFER_SIZE) : NULL;
+  if (room != NULL) {
+    return st_output_commit(output, dtos_to(room, value));
+  }
+  char buffer[DTOS_BUFFER_SIZE];
+  return st_output_append_n(output, buffer, dtos_to(buffer, value));
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t st_output_iov(const struct StringOutput *output, struct iovec *iov, const size_t count) {
+  size_t filled = 0;
+  for (struct StringOutputBlock *block = output->head; block != NULL && filled < count; block = block->next) {
+    if (block->used > block->start) {
+      iov[filled].iov_base = block->data + block->start;
+      iov[filled++].iov_len = block->used - block->start;
+    }
+  }
+  return filled;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_output_flush(struct StringOutput *output) {
+  if (output->fd < 0) {
+    output->error = output->length > 0 ? EBADF : 0;
+    return output->length == 0;
+  }
+  struct iovec iov[ST_OUTPUT_IOV_MAX];
+  while (output->length > 0) {
+    size_t count = st_output_iov(output, iov, ST_OUTPUT_IOV_MAX);
+    ssize_t written;
+    do {
+      written = writev(output->fd, iov, (int)count);
+    } while (written < 0 && errno == EINTR);
+    if (written < 0) {
+      output->error = errno;
+      return 0;
+    }
+    if (written == 0) {
+      // Nothing was written although characters are pending, retrying would never end.
+      output->error = EIO;
+      return 0;
+    }
+    output->written += written;
+    output->length -= written;
+    // Release the written blocks, a partial write resumes from the start.
+    size_t remaining = written;
+    while (remaining > 0) {
+      struct StringOutputBlock *block = output->head;
+      size_t pending = block->used - block->start;
+      if (pending > remaining) {
+        block->start += remaining;
+        break;
+      }
+      remaining -= pending;
+      block->start = block->used;
+      if (block == output->tail) {
+        // Keep the tail, it is reused from its beginning.
+        block->start = 0;
+        block->used = 0;
+        break;
+      }
+      output->head = block->next;
+      string_output_release(output, block);
+    }
+  }
+  output->error = 0;
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_output_reset(struct StringOutput *output) {
+  struct StringOutputBlock *block = output->head;
+  while (block != NULL) {
+    struct StringOutputBlock *next = block->next;
+    string_output_release(output, block);
+    block = next;
+  }
+  output->head = NULL;
+  output->tail = NULL;
+  output->length = 0;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_output_destroy(struct StringOutput *output) {
+  if (output == NULL) {
+    return;
+  }
+  st_output_reset(output);
+  free(output->spare);
+  free(output);
+}
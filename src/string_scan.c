@@ -0,0 +1,484 @@
+#include <stdlib.h>
+#include "../include/strutils.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define STRING_SCAN_X86 1
+#endif
+
+/**
+ * The first byte value that is not considered whitespace.
+ */
+#define STRING_SCAN_WHITESPACE_LIMIT 33
+
+/**
+ * The first byte value that does not need to be escaped in a JSON string.
+ */
+#define STRING_SCAN_CONTROL_LIMIT 32
+
+/**
+ * Struct definition for the set of scan kernels of a given instruction set.
+ */
+struct StringScanKernels {
+
+  /**
+   * Kernel that finds the next delimiter or null character.
+   */
+  size_t (*delimiter)(const char *string, const size_t length, const char delim);
+
+  /**
+   * Kernel that finds the next non-whitespace character.
+   */
+  size_t (*non_whitespace)(const char *string, const size_t length);
+
+  /**
+   * Kernel that finds the next null character.
+   */
+  size_t (*nul)(const char *string, const size_t length);
+
+  /**
+   * Kernel that finds the next character that needs to be escaped.
+   */
+  size_t (*escape)(const char *string, const size_t length);
+};
+
+/**
+ * Scalar kernel, finds the next delimiter or null character.
+ */
+static size_t st_scan_delimiter_scalar(const char *string, const size_t length, const char delim) {
+  size_t index = 0;
+  while (index < length && string[index] != delim && string[index] != '\0') {
+    index++;
+  }
+  return index;
+}
+
+/**
+ * Scalar kernel, finds the next non-whitespace character.
+ */
+static size_t st_scan_non_whitespace_scalar(const char *string, const size_t length) {
+  size_t index = 0;
+  while (index < length && st_char_is(string[index], ST_CLASS_WHITESPACE)) {
+    index++;
+  }
+  return index;
+}
+
+/**
+ * Scalar kernel, finds the next null character.
+ */
+static size_t st_scan_nul_scalar(const char *string, const size_t length) {
+  size_t index = 0;
+  while (index < length && string[index] != '\0') {
+    index++;
+  }
+  return index;
+}
+
+/**
+ * Scalar kernel, finds the next character that needs to be escaped.
+ */
+static size_t st_scan_escape_scalar(const char *string, const size_t length) {
+  size_t index = 0;
+  while (index < length && st_char_is(string[index], ST_CLASS_ESCAPE) == 0) {
+    index++;
+  }
+  return index;
+}
+
+/**
+ * The scalar kernels, available on every platform.
+ */
+static const struct StringScanKernels st_scan_scalar_kernels = {
+  st_scan_delimiter_scalar,
+  st_scan_non_whitespace_scalar,
+  st_scan_nul_scalar,
+  st_scan_escape_scalar,
+};
+
+#ifdef STRING_SCAN_X86
+
+/**
+ * SSE2 kernel, finds the next delimiter or null character 16 bytes per step.
+ */
+__attribute__((target("sse2")))
+static size_t st_scan_delimiter_sse2(const char *string, const size_t length, const char delim) {
+  const __m128i delims = _mm_set1_epi8(delim);
+  const __m128i zeros = _mm_setzero_si128();
+  size_t index = 0;
+  for (; index + 16 <= length; index += 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i *)(string + index));
+    __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(chunk, delims), _mm_cmpeq_epi8(chunk, zeros));
+    unsigned int mask = (unsigned int)_mm_movemask_epi8(matches);
+    if (mask != 0) {
+      return index + __builtin_ctz(mask);
+    }
+  }
+  return index + st_scan_delimiter_scalar(string + index, length - index, delim);
+}
+
+/**
+ * SSE2 kernel, finds the next non-whitespace character 16 bytes per step.
+ */
+__attribute__((target("sse2")))
+static size_t st_scan_non_whitespace_sse2(const char *string, const size_t length) {
+  const __m128i limit = _mm_set1_epi8(STRING_SCAN_WHITESPACE_LIMIT);
+  size_t index = 0;
+  for (; index + 16 <= length; index += 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i *)(string + index));
+    // Unsigned chunk >= limit, the max is the chunk itself.
+    __m128i matches = _mm_cmpeq_epi8(_mm_max_epu8(chunk, limit), chunk);
+    unsigned int mask = (unsigned int)_mm_movemask_epi8(matches);
+    if (mask != 0) {
+      return index + __builtin_ctz(mask);
+    }
+  }
+  return index + st_scan_non_whitespace_scalar(string + index, length - index);
+}
+
+/**
+ * SSE2 kernel, finds the next null character 16 bytes per step.
+ */
+__attribute__((target("sse2")))
+static size_t st_scan_nul_sse2(const char *string, const size_t length) {
+  const __m128i zeros = _mm_setzero_si128();
+  size_t index = 0;
+  for (; index + 16 <= length; index += 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i *)(string + index));
+    unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zeros));
+    if (mask != 0) {
+      return index + __builtin_ctz(mask);
+    }
+  }
+  return index + st_scan_nul_scalar(string + index, length - index);
+}
+
+/**
+ * SSE2 kernel, finds the next character that needs to be escaped 16 bytes per step.
+ */
+__attribute__((target("sse2")))
+static size_t st_scan_escape_sse2(const char *string, const size_t length) {
+  const __m128i quotes = _mm_set1_epi8('"');
+  const __m128i backslashes = _mm_set1_epi8('\\');
+  const __m128i controls = _mm_set1_epi8(STRING_SCAN_CONTROL_LIMIT - 1);
+  size_t index = 0;
+  for (; index + 16 <= length; index += 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i *)(string + index));
+    // Unsigned chunk < limit, the min is the chunk itself.
+    __m128i matches = _mm_cmpeq_epi8(_mm_min_epu8(chunk, controls), chunk);
+    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, quotes));
+    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, backslashes));
+    unsigned int mask = (unsigned int)_mm_movemask_epi8(matches);
+    if (mask != 0) {
+      return index + __builtin_ctz(mask);
+    }
+  }
+  return index + st_scan_escape_scalar(string + index, length - index);
+}
+
+/**
+ * The SSE2 kernels.
+ */
+static const struct StringScanKernels st_scan_sse2_kernels = {
+  st_scan_delimiter_sse2,
+  st_scan_non_whitespace_sse2,
+  st_scan_nul_sse2,
+  st_scan_escape_sse2,
+};
+
+/**
+ * AVX2 kernel, finds the next delimiter or null character 32 bytes per step.
+ */
+__attribute__((target("avx2")))
+static size_t st_scan_delimiter_avx2(const char *string, const size_t length, const char delim) {
+  const __m256i delims = _mm256_set1_epi8(delim);
+  const __m256i zeros = _mm256_setzero_si256();
+  size_t index = 0;
+  for (; index + 32 <= length; index += 32) {
+    __m256i chunk = _mm256_loadu_si256((const __m256i *)(string + index));
+    __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, delims), _mm256_cmpeq_epi8(chunk, zeros));
+    unsigned int mask = (unsigned int)_mm256_movemask_epi8(matches);
+    if (mask != 0) {
+      return index + __builtin_ctz(mask);
+    }
+  }
+  return index + st_scan_delimiter_sse2(string + index, length - index, delim);
+}
+
+/**
+ * AVX2 kernel, finds the next non-whitespace character 32 bytes per step.
+ */
+__attribute__((target("avx2")))
+static size_t st_scan_non_whitespace_avx2(const char *string, const size_t length) {
+  const __m256i limit = _mm256_set1_epi8(STRING_SCAN_WHITESPACE_LIMIT);
+  size_t index = 0;
+  for (; index + 32 <= length; index += 32) {
+    __m256i chunk = _mm256_loadu_si256((const __m256i *)(string + index));
+    __m256i matches = _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, limit), chunk);
+    unsigned int mask = (unsigned int)_mm256_movemask_epi8(matches);
+    if (mask != 0) {
+      return index + __builtin_ctz(mask);
+    }
+  }
+  return index + st_scan_non_whitespace_sse2(string + index, length - index);
+}
+
+/**
+ * AVX2 kernel, finds the next null character 32 bytes per step.
+ */
+__attribute__((target("avx2")))
+static size_t st_scan_nul_avx2(const char *string, const size_t length) {
+  const __m256i zeros = _mm256_setzero_si256();
+  size_t index = 0;
+  for (; index + 32 <= length; index += 32) {
+    __m256i chunk = _mm256_loadu_si256((const __m256i *)(string + index));
+    unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, zeros));
+    if (mask != 0) {
+      return index + __builtin_ctz(mask);
+    }
+  }
+  return index + st_scan_nul_sse2(string + index, length - index);
+}
+
+/**
+ * AVX2 kernel, finds the next character that needs to be escaped 32 bytes per step.
+ */
+__attribute__((target("avx2")))
+static size_t st_scan_escape_avx2(const char *string, const size_t length) {
+  const __m256i quotes = _mm256_set1_epi8('"');
+  const __m256i backslashes = _mm256_set1_epi8('\\');
+  const __m256i controls = _mm256_set1_epi8(STRING_SCAN_CONTROL_LIMIT - 1);
+  size_t index = 0;
+  for (; index + 32 <= length; index += 32) {
+    __m256i chunk = _mm256_loadu_si256((const __m256i *)(string + index));
+    __m256i matches = _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, controls), chunk);
+    matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(chunk, quotes));
+    matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(chunk, backslashes));
+    unsigned int mask = (unsigned int)_mm256_movemask_epi8(matches);
+    if (mask != 0) {
+      return index + __builtin_ctz(mask);
+    }
+  }
+  return index + st_scan_escape_sse2(string + index, length - index);
+}
+
+/**
+ * The AVX2 kernels.
+ */
+static const struct StringScanKernels st_scan_avx2_kernels = {
+  st_scan_delimiter_avx2,
+  st_scan_non_whitespace_avx2,
+  st_scan_nul_avx2,
+  st_scan_escape_avx2,
+};
+
+/**
+ * AVX-512 kernel, finds the next delimiter or null character 64 bytes per step.
+ */
+__attribute__((target("avx512f,avx512bw")))
+static size_t st_scan_delimiter_avx512(const char *string, const size_t length, const char delim) {
+  const __m512i delims = _mm512_set1_epi8(delim);
+  const __m512i zeros = _mm512_setzero_si512();
+  size_t index = 0;
+  for (; index + 64 <= length; index += 64) {
+    __m512i chunk = _mm512_loadu_si512((const void *)(string + index));
+    __mmask64 mask = _mm512_cmpeq_epi8_mask(chunk, delims) | _mm512_cmpeq_epi8_mask(chunk, zeros);
+    if (mask != 0) {
+      return index + __builtin_ctzll(mask);
+    }
+  }
+  return index + st_scan_delimiter_avx2(string + index, length - index, delim);
+}
+
+/**
+ * AVX-512 kernel, finds the next non-whitespace character 64 bytes per step.
+ */
+__attribute__((target("avx512f,avx512bw")))
+static size_t st_scan_non_whitespace_avx512(const char *string, const size_t length) {
+  const __m512i limit = _mm512_set1_epi8(STRING_SCAN_WHITESPACE_LIMIT);
+  size_t index = 0;
+  for (; index + 64 <= length; index += 64) {
+    __m512i chunk = _mm512_loadu_si512((const void *)(string + index));
+    __mmask64 mask = _mm512_cmpge_epu8_mask(chunk, limit);
+    if (mask != 0) {
+      return index + __builtin_ctzll(mask);
+    }
+  }
+  return index + st_scan_non_whitespace_avx2(string + index, length - index);
+}
+
+/**
+ * AVX-512 kernel, finds the next null character 64 bytes per step.
+ */
+__attribute__((target("avx512f,avx512bw")))
+static size_t st_scan_nul_avx512(const char *string, const size_t length) {
+  const __m512i zeros = _mm512_setzero_si512();
+  size_t index = 0;
+  for (; index + 64 <= length; index += 64) {
+    __m512i chunk = _mm512_loadu_si512((const void *)(string + index));
+    __mmask64 mask = _mm512_cmpeq_epi8_mask(chunk, zeros);
+    if (mask != 0) {
+      return index + __builtin_ctzll(mask);
+    }
+  }
+  return index + st_scan_nul_avx2(string + index, length - index);
+}
+
+/**
+ * AVX-512 kernel, finds the next character that needs to be escaped 64 bytes per step.
+ */
+__attribute__((target("avx512f,avx512bw")))
+static size_t st_scan_escape_avx512(const char *string, const size_t length) {
+  const __m512i quotes = _mm512_set1_epi8('"');
+  const __m512i backslashes = _mm512_set1_epi8('\\');
+  const __m512i controls = _mm512_set1_epi8(STRING_SCAN_CONTROL_LIMIT);
+  size_t index = 0;
+  for (; index + 64 <= length; index += 64) {
+    __m512i chunk = _mm512_loadu_si512((const void *)(string + index));
+    __mmask64 mask = _mm512_cmplt_epu8_mask(chunk, controls);
+    mask |= _mm512_cmpeq_epi8_mask(chunk, quotes) | _mm512_cmpeq_epi8_mask(chunk, backslashes);
+    if (mask != 0) {
+      return index + __builtin_ctzll(mask);
+    }
+  }
+  return index + st_scan_escape_avx2(string + index, length - index);
+}
+
+/**
+ * The AVX-512 kernels.
+ */
+static const struct StringScanKernels st_scan_avx512_kernels = {
+  st_scan_delimiter_avx512,
+  st_scan_non_whitespace_avx512,
+  st_scan_nul_avx512,
+  st_scan_escape_avx512,
+};
+
+#endif /* STRING_SCAN_X86 */
+
+/**
+ * The kernels used by the scan functions, selected when the library is loaded.
+ */
+static const struct StringScanKernels *st_scan_kernels = &st_scan_scalar_kernels;
+
+/**
+ * The instruction set of the selected kernels.
+ */
+static enum StringScanIsa st_scan_current_isa = ST_SCAN_SCALAR;
+
+/**
+ * {@inheritdoc}
+ */
+int st_scan_isa_supported(const enum StringScanIsa isa) {
+#ifdef STRING_SCAN_X86
+  // Required when called before the other constructors ran.
+  __builtin_cpu_init();
+#endif
+  switch (isa) {
+    case ST_SCAN_SCALAR:
+      return 1;
+#ifdef STRING_SCAN_X86
+    case ST_SCAN_SSE2:
+      return __builtin_cpu_supports("sse2") ? 1 : 0;
+    case ST_SCAN_AVX2:
+      return __builtin_cpu_supports("avx2") ? 1 : 0;
+    case ST_SCAN_AVX512:
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") ? 1 : 0;
+#endif
+    default:
+      return 0;
+  }
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_scan_set_isa(const enum StringScanIsa isa) {
+  if (st_scan_isa_supported(isa) == 0) {
+    return 0;
+  }
+  switch (isa) {
+#ifdef STRING_SCAN_X86
+    case ST_SCAN_SSE2:
+      st_scan_kernels = &st_scan_sse2_kernels;
+      break;
+    case ST_SCAN_AVX2:
+      st_scan_kernels = &st_scan_avx2_kernels;
+      break;
+    case ST_SCAN_AVX512:
+      st_scan_kernels = &st_scan_avx512_kernels;
+      break;
+#endif
+    default:
+      st_scan_kernels = &st_scan_scalar_kernels;
+      break;
+  }
+  st_scan_current_isa = isa;
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+enum StringScanIsa st_scan_isa() {
+  return st_scan_current_isa;
+}
+
+/**
+ * Selects the widest kernels supported by the CPU when the library is loaded.
+ */
+__attribute__((constructor))
+static void st_scan_init() {
+  enum StringScanIsa isa = ST_SCAN_AVX512;
+  while (isa != ST_SCAN_SCALAR && st_scan_set_isa(isa) == 0) {
+    isa--;
+  }
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t st_scan_delimiter(const char *string, const size_t length, const char delim) {
+  return st_scan_kernels->delimiter(string, length, delim);
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t st_scan_non_whitespace(const char *string, const size_t length) {
+  return st_scan_kernels->non_whitespace(string, length);
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t st_scan_nul(const char *string, const size_t length) {
+  return st_scan_kernels->nul(string, length);
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t st_scan_escape(const char *string, const size_t length) {
+  return st_scan_kernels->escape(string, length);
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t st_scan_class(const char *string, const size_t length, const struct StringCharClass *char_class) {
+  size_t index = 0;
+  // Four lookups per step, the loads don't depend on each other.
+  for (; index + 4 <= length; index += 4) {
+    const uint8_t *members = char_class->members;
+    unsigned int mask = (members[(unsigned char)string[index]] != 0) | (members[(unsigned char)string[index + 1]] != 0) << 1 |
+                        (members[(unsigned char)string[index + 2]] != 0) << 2 | (members[(unsigned char)string[index + 3]] != 0) << 3;
+    if (mask != 0) {
+      return index + __builtin_ctz(mask);
+    }
+  }
+  while (index < length && st_char_class_has(char_class, string[index]) == 0) {
+    index++;
+  }
+  return index;
+}
@@ -0,0 +1,82 @@
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+#include "../include/strutils.h"
+
+/**
+ * The number of counters in struct StringStats.
+ */
+#define STRING_STATS_COUNTERS (sizeof(struct StringStats) / sizeof(uint64_t))
+
+/**
+ * Whether the global counters are updated.
+ */
+static atomic_int string_stats_enabled = 0;
+
+/**
+ * The global counters, shared by every thread.
+ */
+static _Atomic uint64_t string_stats_global[STRING_STATS_COUNTERS];
+
+/**
+ * {@inheritdoc}
+ */
+int st_stats_available(void) {
+#ifdef LIBSTR_ENABLE_STATS
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_stats_enable(const int enabled) {
+  atomic_store_explicit(&string_stats_enabled, enabled != 0, memory_order_relaxed);
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_stats_snapshot(struct StringStats *stats) {
+  uint64_t counters[STRING_STATS_COUNTERS];
+  for (size_t i = 0; i < STRING_STATS_COUNTERS; i++) {
+    counters[i] = atomic_load_explicit(&string_stats_global[i], memory_order_relaxed);
+  }
+  memcpy(stats, counters, sizeof(struct StringStats));
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_stats_reset(void) {
+  for (size_t i = 0; i < STRING_STATS_COUNTERS; i++) {
+    atomic_store_explicit(&string_stats_global[i], 0, memory_order_relaxed);
+  }
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_stats_add(const struct StringTokenizer *tokenizer, const size_t field, const uint64_t value) {
+  if (tokenizer != NULL && tokenizer->stats != NULL) {
+    // A tokenizer is used by a single thread at a time.
+    *(uint64_t *)((char *)tokenizer->stats + field) += value;
+  }
+  if (atomic_load_explicit(&string_stats_enabled, memory_order_relaxed)) {
+    atomic_fetch_add_explicit(&string_stats_global[field / sizeof(uint64_t)], value, memory_order_relaxed);
+  }
+}
+
+/**
+ * {@inheritdoc}
+ */
+uint64_t st_stats_clock(const struct StringTokenizer *tokenizer) {
+  if ((tokenizer == NULL || tokenizer->stats == NULL) && atomic_load_explicit(&string_stats_enabled, memory_order_relaxed) == 0) {
+    return 0;
+  }
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
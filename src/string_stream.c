@@ -0,0 +1,181 @@
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include "../include/strutils.h"
+
+/**
+ * Reads a chunk from a file descriptor, retrying on interrupted calls.
+ *
+ * @param void *context
+ *   Pointer to the file descriptor.
+ * @param char *buffer
+ *   The buffer that receives the characters.
+ * @param size_t size
+ *   The maximum number of characters to read.
+ *
+ * @return ssize_t
+ *   The number of characters read, 0 at the end of the file or -1 on error.
+ */
+static ssize_t string_stream_read_fd(void *context, char *buffer, size_t size) {
+  ssize_t count;
+  do {
+    count = read(*(int *)context, buffer, size);
+  } while (count < 0 && errno == EINTR);
+  return count;
+}
+
+/**
+ * Reads a chunk from a file.
+ *
+ * @param void *context
+ *   Pointer to the FILE instance.
+ * @param char *buffer
+ *   The buffer that receives the characters.
+ * @param size_t size
+ *   The maximum number of characters to read.
+ *
+ * @return ssize_t
+ *   The number of characters read, 0 at the end of the file or -1 on error.
+ */
+static ssize_t string_stream_read_file(void *context, char *buffer, size_t size) {
+  FILE *file = (FILE *)context;
+  size_t count = fread(buffer, 1, size, file);
+  if (count == 0 && ferror(file)) {
+    return -1;
+  }
+  return (ssize_t)count;
+}
+
+/**
+ * Creates a streaming tokenizer with an empty window.
+ *
+ * @param ssize_t (*read)(void *context, char *buffer, size_t size)
+ *   The function used to read from the source.
+ * @param void *context
+ *   The context passed to the read function.
+ * @param const size_t chunk_size
+ *   The number of characters read at once.
+ *
+ * @return struct StringTokenizer*
+ *   Pointer to the StringTokenizer instance, or NULL on failure.
+ */
+static struct StringTokenizer *string_stream_create(ssize_t (*read)(void *context, char *buffer, size_t size), void *context, const size_t chunk_size) {
+  if (read == NULL || chunk_size == 0) {
+    return NULL;
+  }
+  struct StringTokenizer *tokenizer = (struct StringTokenizer *)malloc(sizeof(struct StringTokenizer));
+  struct StringStream *stream = (struct StringStream *)malloc(sizeof(struct StringStream));
+  // The window holds one chunk and the null character.
+  char *string = (char *)malloc(chunk_size + sizeof(""));
+  ST_STATS_ADD(NULL, allocations, 3);
+  if (tokenizer == NULL || stream == NULL || string == NULL) {
+    free(tokenizer);
+    free(stream);
+    free(string);
+    return NULL;
+  }
+  // Init the stream properties.
+  stream->read = read;
+  stream->context = context;
+  stream->fd = -1;
+  stream->chunk_size = chunk_size;
+  stream->capacity = chunk_size + sizeof("");
+  stream->offset = 0;
+  stream->eof = 0;
+  stream->error = 0;
+  // Init String Tokenizer object properties with an empty window.
+  string[0] = '\0';
+  st_init(tokenizer, string, 0);
+  tokenizer->stream = stream;
+  return tokenizer;
+}
+
+/**
+ * {@inheritdoc}
+ */
+struct StringTokenizer *st_create_from_callback(ssize_t (*read)(void *context, char *buffer, size_t size), void *context, const size_t chunk_size) {
+  struct StringTokenizer *tokenizer = string_stream_create(read, context, chunk_size);
+  if (tokenizer != NULL) {
+    // Load the first chunk.
+    st_ensure(tokenizer, 1);
+  }
+  return tokenizer;
+}
+
+/**
+ * {@inheritdoc}
+ */
+struct StringTokenizer *st_create_from_fd(const int fd, const size_t chunk_size) {
+  if (fd < 0) {
+    return NULL;
+  }
+  struct StringTokenizer *tokenizer = string_stream_create(string_stream_read_fd, NULL, chunk_size);
+  if (tokenizer != NULL) {
+    // The stream keeps a copy of the descriptor for the read function.
+    tokenizer->stream->fd = fd;
+    tokenizer->stream->context = &tokenizer->stream->fd;
+    st_ensure(tokenizer, 1);
+  }
+  return tokenizer;
+}
+
+/**
+ * {@inheritdoc}
+ */
+struct StringTokenizer *st_create_from_file(FILE *file, const size_t chunk_size) {
+  if (file == NULL) {
+    return NULL;
+  }
+  return st_create_from_callback(string_stream_read_file, file, chunk_size);
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_ensure(struct StringTokenizer *tokenizer, const size_t size) {
+  struct StringStream *stream = tokenizer->stream;
+  if (stream == NULL || tokenizer->position + size <= tokenizer->length) {
+    return tokenizer->position + size <= tokenizer->length;
+  }
+  if (stream->eof) {
+    return 0;
+  }
+  // Discard the characters before the cursor.
+  size_t position = tokenizer->position < tokenizer->length ? tokenizer->position : tokenizer->length;
+  if (position > 0) {
+    tokenizer->length -= position;
+    memmove(tokenizer->string, tokenizer->string + position, tokenizer->length);
+    ST_STATS_ADD(tokenizer, bytes_copied, tokenizer->length);
+    stream->offset += position;
+    tokenizer->position -= position;
+  }
+  // Grow the window when the requested characters do not fit.
+  size_t needed = tokenizer->position + size;
+  if (needed + sizeof("") > stream->capacity) {
+    size_t capacity = stream->capacity * 2;
+    if (capacity < needed + sizeof("")) {
+      capacity = needed + sizeof("");
+    }
+    char *string = (char *)realloc(tokenizer->string, capacity);
+    ST_STATS_ADD(tokenizer, reallocations, 1);
+    if (string == NULL) {
+      return 0;
+    }
+    tokenizer->string = string;
+    stream->capacity = capacity;
+  }
+  // Read until the requested characters are available or the source ends.
+  while (tokenizer->length < needed) {
+    ssize_t count = stream->read(stream->context, tokenizer->string + tokenizer->length, stream->capacity - tokenizer->length - sizeof(""));
+    if (count <= 0) {
+      stream->error = count < 0;
+      stream->eof = 1;
+      break;
+    }
+    tokenizer->length += count;
+  }
+  // Zero/null terminate the window.
+  tokenizer->string[tokenizer->length] = '\0';
+  return tokenizer->length >= needed;
+}
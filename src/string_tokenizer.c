@@ -1,7 +1,23 @@
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include "../include/strutils.h"
 
+/**
+ * The longest escape sequence, \u00XX.
+ */
+#define STRING_TOKENIZER_MAX_ESCAPE_SIZE 6
+
+/**
+ * The released tokenizers of the calling thread.
+ */
+static _Thread_local struct StringTokenizer *string_tokenizer_pool[ST_TOKENIZER_POOL_SIZE];
+
+/**
+ * The number of tokenizers in the pool of the calling thread.
+ */
+static _Thread_local size_t string_tokenizer_pool_count = 0;
+
 /**
  * {@inheritdoc}
  */
@@ -9,18 +25,38 @@ struct StringTokenizer *st_create(char *string) {
   if (string == NULL) {
     return NULL;
   }
-  size_t length = strlen(string);
-  if (length == 0) {
+  return st_create_n(string, strlen(string));
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_init(struct StringTokenizer *tokenizer, char *string, const size_t length) {
+  tokenizer->string = string;
+  tokenizer->length = length;
+  tokenizer->position = 0;
+  tokenizer->incremental_factor = 0;
+  tokenizer->growth_policy = ST_GROWTH_GEOMETRIC;
+  tokenizer->max_increment = 0;
+  tokenizer->stream = NULL;
+  tokenizer->ownership = ST_STRING_BORROWED;
+  tokenizer->arena = NULL;
+  tokenizer->structural_index = NULL;
+  tokenizer->stats = NULL;
+}
+
+/**
+ * {@inheritdoc}
+ */
+struct StringTokenizer *st_create_n(char *string, const size_t length) {
+  if (string == NULL || length == 0) {
     return NULL;
   }
   size_t size = sizeof(struct StringTokenizer);
   struct StringTokenizer *tokenizer = (struct StringTokenizer *)malloc(size);
+  ST_STATS_ADD(NULL, allocations, 1);
   if (tokenizer != NULL) {
-    // Init String Tokenizer object properties.
-    tokenizer->string = string;
-    tokenizer->length = length;
-    tokenizer->position = 0;
-    tokenizer->incremental_factor = 0;
+    st_init(tokenizer, string, length);
   }
   return tokenizer;
 }
@@ -29,183 +65,523 @@ struct StringTokenizer *st_create(char *string) {
  * {@inheritdoc}
  */
 struct StringTokenizer *st_create_empty(const size_t string_size) {
+  if (string_size > 0 && string_size < ST_INLINE_BUFFER_SIZE) {
+    // Short strings live in the inline buffer until they outgrow it.
+    struct StringTokenizer *tokenizer = (struct StringTokenizer *)malloc(sizeof(struct StringTokenizer));
+    ST_STATS_ADD(NULL, allocations, 1);
+    if (tokenizer != NULL) {
+      st_init(tokenizer, tokenizer->inline_buffer, ST_INLINE_BUFFER_SIZE - sizeof(""));
+      tokenizer->inline_buffer[0] = '\0';
+      tokenizer->incremental_factor = string_size;
+      tokenizer->ownership = ST_STRING_INLINE;
+    }
+    return tokenizer;
+  }
   // Create the empty string.
   char *string = (char *)malloc(string_size + sizeof(""));
+  ST_STATS_ADD(NULL, allocations, 1);
   if (string == NULL) {
     return NULL;
   }
-  // Init an empty JSON string.
-  memset(string, ' ', string_size);
-  // Do the normal create.
-  struct StringTokenizer *tokenizer = st_create(string);
+  // Init an empty string, the length covers the whole buffer.
+  string[0] = '\0';
+  string[string_size] = '\0';
+  struct StringTokenizer *tokenizer = st_create_n(string, string_size);
   if (tokenizer == NULL) {
     free(string);
     return NULL;
   }
   // Set the incremental factor.
   tokenizer->incremental_factor = string_size;
+  tokenizer->ownership = ST_STRING_OWNED;
   // Return the tokenizer instance.
   return tokenizer;
 }
 
+/**
+ * Releases the string owned by the tokenizer.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ */
+static void st_release_string(struct StringTokenizer *tokenizer) {
+  st_drop_structural_index(tokenizer);
+  if (tokenizer->stream != NULL) {
+    // Streaming tokenizers own the window.
+    free(tokenizer->string);
+    free(tokenizer->stream);
+    tokenizer->stream = NULL;
+  }
+  else if (tokenizer->ownership == ST_STRING_OWNED) {
+    free(tokenizer->string);
+  }
+  else if (tokenizer->ownership == ST_STRING_MAPPED) {
+    munmap(tokenizer->string, tokenizer->length);
+  }
+  tokenizer->string = NULL;
+  tokenizer->ownership = ST_STRING_BORROWED;
+}
+
 /**
  * {@inheritdoc}
  */
 void st_destroy(struct StringTokenizer *tokenizer) {
+  if (tokenizer != NULL) {
+    st_release_string(tokenizer);
+  }
   free(tokenizer);
   tokenizer = NULL;
 }
 
+/**
+ * {@inheritdoc}
+ */
+void st_reset(struct StringTokenizer *tokenizer) {
+  tokenizer->position = 0;
+  if (tokenizer->ownership == ST_STRING_OWNED || tokenizer->ownership == ST_STRING_INLINE) {
+    // Empty the string, the buffer keeps its length.
+    tokenizer->string[0] = '\0';
+    st_drop_structural_index(tokenizer);
+  }
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_rebind(struct StringTokenizer *tokenizer, char *string, const size_t length) {
+  if (tokenizer->stream != NULL || string == NULL || length == 0) {
+    return 0;
+  }
+  st_release_string(tokenizer);
+  tokenizer->string = string;
+  tokenizer->length = length;
+  tokenizer->position = 0;
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+char *st_detach_string(struct StringTokenizer *tokenizer) {
+  char *string = tokenizer->string;
+  if (tokenizer->ownership == ST_STRING_INLINE) {
+    // The inline buffer dies with the tokenizer, the caller gets a copy.
+    struct StringView view = {tokenizer->string, tokenizer->position};
+    string = sv_to_string(&view);
+    if (string == NULL) {
+      return NULL;
+    }
+  }
+  else if (tokenizer->ownership != ST_STRING_OWNED) {
+    // The tokenizer does not own the string, there is nothing to hand over.
+    return string;
+  }
+  // The caller frees the string from now on, the tokenizer starts over empty in the inline buffer.
+  st_drop_structural_index(tokenizer);
+  tokenizer->string = tokenizer->inline_buffer;
+  tokenizer->length = ST_INLINE_BUFFER_SIZE - sizeof("");
+  tokenizer->position = 0;
+  tokenizer->inline_buffer[0] = '\0';
+  tokenizer->ownership = ST_STRING_INLINE;
+  return string;
+}
+
+/**
+ * {@inheritdoc}
+ */
+struct StringTokenizer *st_pool_acquire(const size_t string_size) {
+  if (string_tokenizer_pool_count == 0) {
+    return st_create_empty(string_size);
+  }
+  struct StringTokenizer *tokenizer = string_tokenizer_pool[--string_tokenizer_pool_count];
+  if (st_reserve(tokenizer, string_size) == 0) {
+    st_destroy(tokenizer);
+    return NULL;
+  }
+  return tokenizer;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_pool_release(struct StringTokenizer *tokenizer) {
+  if (tokenizer == NULL) {
+    return;
+  }
+  int builder = tokenizer->ownership == ST_STRING_OWNED || tokenizer->ownership == ST_STRING_INLINE;
+  if (builder == 0 || tokenizer->stream != NULL || string_tokenizer_pool_count == ST_TOKENIZER_POOL_SIZE) {
+    st_destroy(tokenizer);
+    return;
+  }
+  // Restore the defaults for the next user, the grown buffer is kept.
+  st_reset(tokenizer);
+  enum StringOwnership ownership = tokenizer->ownership;
+  size_t incremental_factor = tokenizer->incremental_factor;
+  st_init(tokenizer, tokenizer->string, tokenizer->length);
+  tokenizer->ownership = ownership;
+  tokenizer->incremental_factor = incremental_factor;
+  string_tokenizer_pool[string_tokenizer_pool_count++] = tokenizer;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_pool_clear(void) {
+  while (string_tokenizer_pool_count > 0) {
+    st_destroy(string_tokenizer_pool[--string_tokenizer_pool_count]);
+  }
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_attach_arena(struct StringTokenizer *tokenizer, struct StringArena *arena) {
+  tokenizer->arena = arena;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_attach_stats(struct StringTokenizer *tokenizer, struct StringStats *stats) {
+  tokenizer->stats = stats;
+}
+
+/**
+ * Allocates memory for an extracted value, from the arena when one is attached.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const size_t size
+ *   The number of bytes to allocate.
+ *
+ * @return void*
+ *   Pointer to the allocated memory, or NULL on failure.
+ */
+static void *st_allocate(struct StringTokenizer *tokenizer, const size_t size) {
+  if (tokenizer->arena != NULL) {
+    return st_arena_alloc(tokenizer->arena, size);
+  }
+  ST_STATS_ADD(tokenizer, allocations, 1);
+  return malloc(size);
+}
+
+/**
+ * Copies an extracted view, into the arena when one is attached.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const struct StringView *view
+ *   The view to copy.
+ *
+ * @return char*
+ *   Pointer to the copied string, or NULL on failure.
+ */
+static char *st_copy_view(struct StringTokenizer *tokenizer, const struct StringView *view) {
+  if (tokenizer->arena != NULL) {
+    return st_arena_string(tokenizer->arena, view);
+  }
+  ST_STATS_ADD(tokenizer, allocations, 1);
+  return sv_to_string(view);
+}
+
 /**
  * {@inheritdoc}
  */
 void st_next_token(struct StringTokenizer *tokenizer) {
-  do {
-    // Move the cursor to the next position.
-    tokenizer->position++;
-  } while (tokenizer->string[tokenizer->position] <= 32 && tokenizer->position <= tokenizer->length);
+  // Move the cursor to the next position.
+  size_t position = tokenizer->position + 1;
+  struct StringStructuralIndex *index = tokenizer->structural_index;
+  if (index != NULL && position < tokenizer->length && st_char_is(tokenizer->string[position], ST_CLASS_WHITESPACE) && st_structural_in_string(index, position) == 0) {
+    // Outside strings the next non-whitespace character is a token start.
+    tokenizer->position = st_structural_next(index, position);
+    ST_STATS_ADD(tokenizer, bytes_scanned, tokenizer->position - position + 1);
+    return;
+  }
+  while (1) {
+    // Skip the whitespaces.
+    if (position < tokenizer->length) {
+      position += st_scan_non_whitespace(tokenizer->string + position, tokenizer->length - position);
+      if (position < tokenizer->length) {
+        break;
+      }
+    }
+    // Refill the window of streaming tokenizers, the whitespaces are discarded.
+    tokenizer->position = tokenizer->length;
+    if (tokenizer->stream == NULL || st_ensure(tokenizer, 1) == 0) {
+      return;
+    }
+    position = tokenizer->position;
+  }
+  ST_STATS_ADD(tokenizer, bytes_scanned, position - tokenizer->position);
+  tokenizer->position = position;
 }
 
 /**
  * {@inheritdoc}
  */
 char st_current_token(struct StringTokenizer *tokenizer) {
+  if (st_ensure(tokenizer, 1) == 0) {
+    // The cursor is at the end of the string.
+    return '\0';
+  }
   return tokenizer->string[tokenizer->position];
 }
 
 /**
  * {@inheritdoc}
  */
-char *st_sub_string(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim) {
-  // Get the current token in the tokenizer.
-  char token = tokenizer->string[tokenizer->position];
+int st_sub_string_view(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim, struct StringView *view) {
   // Check the start of the string.
-  if (token != start_delim) {
+  if (st_ensure(tokenizer, 1) == 0 || tokenizer->string[tokenizer->position] != start_delim) {
     // Not an string, early exit.
+    return 0;
+  }
+  // Calculate the length of the string, relative to the start delimiter.
+  size_t end = 1;
+  while (1) {
+    size_t available = tokenizer->length - tokenizer->position;
+    end += st_scan_delimiter(tokenizer->string + tokenizer->position + end, available - end, end_delim);
+    // Stop on the delimiter or when no more characters can be read.
+    if (end < available || st_ensure(tokenizer, available + 1) == 0) {
+      break;
+    }
+  }
+  // Point the view to the sub string.
+  view->ptr = tokenizer->string + tokenizer->position + 1;
+  view->len = end - 1;
+  // Move the cursor to the end delimiter.
+  tokenizer->position += end;
+  ST_STATS_ADD(tokenizer, bytes_scanned, end + 1);
+  ST_STATS_ADD(tokenizer, tokens_extracted, 1);
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+char *st_sub_string(struct StringTokenizer *tokenizer, const char start_delim, const char end_delim) {
+  struct StringView view;
+  if (st_sub_string_view(tokenizer, start_delim, end_delim, &view) == 0) {
     return NULL;
   }
-  // Move to the next token in the tokenizer.
-  tokenizer->position++;
-  token = tokenizer->string[tokenizer->position];
-  // Calculate the length of the string.
-  size_t start = tokenizer->position;
-  while (token != '\0' && token != end_delim) {
-    tokenizer->position++;
-    token = tokenizer->string[tokenizer->position];
-  }
-  size_t end = tokenizer->position;
-  size_t length = end - start;
-  // Allocate enough space for the sub string.
-  char *sub_string = (char *)malloc(length + sizeof(""));
-  // Extract the sub string.
-  size_t index = 0;
-  for (int i = start; i < end; i++) {
-    sub_string[index] = tokenizer->string[i];
-    index++;
+  // Returns a copy of the extracted substring.
+  return st_copy_view(tokenizer, &view);
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_slice_string_view(struct StringTokenizer *tokenizer, const int length, struct StringView *view) {
+  // Ensure the requested lenght is under the limit.
+  if (length >= 0) {
+    st_ensure(tokenizer, length);
+  }
+  if (length < 0 || tokenizer->position > tokenizer->length || (size_t)length > (tokenizer->length - tokenizer->position)) {
+    return 0;
   }
-  // Zero/null terminate sub string.
-  sub_string[index] = '\0';
-  // Returns the extracted substring.
-  return sub_string;
+  // Point the view to the slice.
+  view->ptr = tokenizer->string + tokenizer->position;
+  view->len = length;
+  // Move the cursor past the slice.
+  tokenizer->position += length + 1;
+  ST_STATS_ADD(tokenizer, bytes_scanned, length);
+  ST_STATS_ADD(tokenizer, tokens_extracted, 1);
+  return 1;
 }
 
 /**
  * {@inheritdoc}
  */
 char *st_slice_string(struct StringTokenizer *tokenizer, const int length) {
-  // Ensure the requested lenght is under the limit.
-  if (length > (tokenizer->length - tokenizer->position)) {
+  struct StringView view;
+  if (st_slice_string_view(tokenizer, length, &view) == 0) {
     return NULL;
   }
-  // Allocate enough space for the requested string.
-  char *sub_string = (char *)malloc(length + sizeof(""));
-  // Extract the sub string.
-  size_t index = 0;
-  size_t end = tokenizer->position + length;
-  while (tokenizer->position <= end) {
-    sub_string[index] = tokenizer->string[tokenizer->position];
-    tokenizer->position++;
-    index++;
+  // Returns a copy of the extracted slice.
+  return st_copy_view(tokenizer, &view);
+}
+
+/**
+ * Gets a view of the numbers at the cursor position, without moving the cursor.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param struct StringView *view
+ *   Pointer to the view that receives the numeric substring.
+ *
+ * @return int
+ *   Returns 1 when numbers were found, otherwise 0.
+ */
+static int st_numbers_view(struct StringTokenizer *tokenizer, struct StringView *view) {
+  // Calculate the length of the numeric string, relative to the cursor.
+  size_t end = 0;
+  while (st_ensure(tokenizer, end + 1) == 1 && is_numeric(tokenizer->string[tokenizer->position + end]) == 1) {
+    end++;
+  }
+  // Check if the string indeed contains numbers.
+  if (end == 0) {
+    return 0;
+  }
+  // Point the view to the numbers.
+  view->ptr = tokenizer->string + tokenizer->position;
+  view->len = end;
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_extract_numbers_view(struct StringTokenizer *tokenizer, struct StringView *view) {
+  if (st_numbers_view(tokenizer, view) == 0) {
+    return 0;
+  }
+  size_t end = view->len;
+  // Set the pointer to the last valid numeric character.
+  tokenizer->position += end - 1;
+  ST_STATS_ADD(tokenizer, bytes_scanned, end);
+  ST_STATS_ADD(tokenizer, tokens_extracted, 1);
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_extract_until_view(struct StringTokenizer *tokenizer, const struct StringCharClass *delimiters, struct StringView *view) {
+  // Calculate the length of the substring, relative to the cursor.
+  size_t end = 0;
+  while (st_ensure(tokenizer, end + 1) == 1) {
+    size_t available = tokenizer->length - tokenizer->position;
+    end += st_scan_class(tokenizer->string + tokenizer->position + end, available - end, delimiters);
+    // Stop on the delimiter, or refill the window and continue.
+    if (end < available) {
+      break;
+    }
   }
-  // Zero/null terminate sub string.
-  sub_string[index] = '\0';
-  // Returns the extracted substring.
-  return sub_string;
+  if (end == 0) {
+    return 0;
+  }
+  // Point the view to the substring.
+  view->ptr = tokenizer->string + tokenizer->position;
+  view->len = end;
+  // Set the pointer to the last character before the delimiter.
+  tokenizer->position += end - 1;
+  ST_STATS_ADD(tokenizer, bytes_scanned, end);
+  ST_STATS_ADD(tokenizer, tokens_extracted, 1);
+  return 1;
 }
 
 /**
  * {@inheritdoc}
  */
 char *st_extract_numbers(struct StringTokenizer *tokenizer) {
-  // Get the current token in the tokenizer.
-  char token = tokenizer->string[tokenizer->position];
-  // Calculate the length of the numeric string.
-  size_t start = tokenizer->position;
-  while (token != '\0' && is_numeric(token) == 1) {
-    tokenizer->position++;
-    token = tokenizer->string[tokenizer->position];
-  }
-  size_t end = tokenizer->position;
-  size_t length = end - start;
-  // Set the pointer to the previous valid numeric character.
-  tokenizer->position--;
-  // Check if the string indeed contains numbers.
-  if (length == 0) {
+  struct StringView view;
+  if (st_extract_numbers_view(tokenizer, &view) == 0) {
     return NULL;
   }
-  // Allocate enough space for the string value.
-  char *numbers = (char *)malloc(length + sizeof(""));
-  // Extract the string.
-  size_t index = 0;
-  for (int i = start; i <= end; i++) {
-    numbers[index] = tokenizer->string[i];
-    index++;
+  // Returns a copy of the extracted numbers.
+  return st_copy_view(tokenizer, &view);
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_extract_double_to(struct StringTokenizer *tokenizer, double *value) {
+  // Get the numbers from the string.
+  struct StringView view;
+  if (st_extract_numbers_view(tokenizer, &view) == 0) {
+    return 0;
+  }
+  // Convert the numbers into a double value.
+  uint64_t start = ST_STATS_CLOCK(tokenizer);
+  size_t converted = stod(view.ptr, view.len, value);
+  ST_STATS_SINCE(tokenizer, start);
+  if (converted == 0) {
+    // Restore the cursor to the start of the numbers.
+    tokenizer->position = view.ptr - tokenizer->string;
+    return 0;
+  }
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_extract_int64(struct StringTokenizer *tokenizer, int64_t *value) {
+  uint64_t start = ST_STATS_CLOCK(tokenizer);
+  // Load enough characters for the longest integer.
+  st_ensure(tokenizer, ITOS_BUFFER_SIZE);
+  size_t available;
+  size_t consumed;
+  int64_t number;
+  while (1) {
+    available = tokenizer->position < tokenizer->length ? tokenizer->length - tokenizer->position : 0;
+    consumed = stoi64(tokenizer->string + tokenizer->position, available, &number);
+    // Stop after the digits or when no more characters can be read.
+    if (consumed < available || tokenizer->stream == NULL || st_ensure(tokenizer, available + 1) == 0) {
+      break;
+    }
   }
-  // Zero/null terminate sub string.
-  numbers[index] = '\0';
-  // Returns the extracted numbers.
-  return numbers;
+  if (consumed == 0) {
+    return 0;
+  }
+  char next = consumed < available ? tokenizer->string[tokenizer->position + consumed] : '\0';
+  if (next == '.' || next == 'e' || next == 'E') {
+    // Fractions and exponents take the double path, the cursor moves only on success.
+    struct StringView view;
+    double decimal;
+    if (st_numbers_view(tokenizer, &view) == 0 || stod(view.ptr, view.len, &decimal) == 0) {
+      return 0;
+    }
+    // The range is checked first, converting a double that does not fit is undefined.
+    if (decimal < -9223372036854775808.0 || decimal >= 9223372036854775808.0 || decimal != (double)(int64_t)decimal) {
+      return 0;
+    }
+    number = (int64_t)decimal;
+    consumed = view.len;
+  }
+  *value = number;
+  // Set the pointer to the last digit.
+  tokenizer->position += consumed - 1;
+  ST_STATS_SINCE(tokenizer, start);
+  ST_STATS_ADD(tokenizer, bytes_scanned, consumed);
+  ST_STATS_ADD(tokenizer, tokens_extracted, 1);
+  return 1;
 }
 
 /**
  * {@inheritdoc}
  */
 double *st_extract_double(struct StringTokenizer *tokenizer) {
-  // Extract numbers from string.
-  char *numbers = st_extract_numbers(tokenizer);
-  if (numbers == NULL) {
+  // Extract the double value from string.
+  double number;
+  if (st_extract_double_to(tokenizer, &number) == 0) {
     return NULL;
   }
-  // Convert the string numbers into a double value.
-  size_t size = sizeof(double);
-  double *value = (double *)malloc(size);
-  *value = strtod(numbers, NULL);
-  // Free the memory used for the string numbers.
-  free(numbers);
-  // Return the double pointer.
+  // Return the value in a double pointer.
+  double *value = (double *)st_allocate(tokenizer, sizeof(double));
+  if (value != NULL) {
+    *value = number;
+  }
   return value;
 }
 
+/**
+ * {@inheritdoc}
+ */
 int st_starts_with(struct StringTokenizer *tokenizer, const char *needle) {
-  // Save current tokenizer position.
-  size_t original_position = tokenizer->position;
   // Get the maximum number of characters to be extracted.
   size_t length = strlen(needle);
-  // Extract the slice.
-  char *extracted_string = st_slice_string(tokenizer, length);
-  // Check if the extraction succeeded.
-  if (extracted_string == NULL) {
-    tokenizer->position = original_position;
+  // Extract the slice, the cursor is not moved on failure.
+  struct StringView view;
+  if (st_slice_string_view(tokenizer, length, &view) == 0) {
     return 0;
   }
   // Check the extracted value vs the expected value.
-  if (strncmp(extracted_string, needle, length) != 0) {
-    tokenizer->position = original_position;
-    free(extracted_string);
+  if (memcmp(view.ptr, needle, length) != 0) {
+    // Restore the cursor to the start of the slice.
+    tokenizer->position = view.ptr - tokenizer->string;
     return 0;
   }
-  // Free the memory used for the extracted string.
-  free(extracted_string);
   // Returns a success response.
   return 1;
 }
@@ -219,57 +595,145 @@ int *st_extract_boolean(struct StringTokenizer *tokenizer, const char *bool_valu
     return NULL;
   }
   // Allocate space for the bool value as int.
-  int *value = (int *)malloc(sizeof(int));
+  int *value = (int *)st_allocate(tokenizer, sizeof(int));
   // Set the int value.
-  *value = int_value;
+  if (value != NULL) {
+    *value = int_value;
+  }
   // Return the int pointer.
   return value;
 }
 
+/**
+ * Resizes the tokenizer string.
+ *
+ * @param struct StringTokenizer* tokenizer
+ *   Pointer to the tokenizer instance.
+ * @param const size_t length
+ *   The new length of the string.
+ *
+ * @return int
+ *   Returns 1 if the string was resized, otherwise 0.
+ */
+static int st_resize_string(struct StringTokenizer *tokenizer, const size_t length) {
+  if (tokenizer->ownership == ST_STRING_MAPPED || tokenizer->stream != NULL) {
+    // File mappings and stream windows can not be resized.
+    return 0;
+  }
+  if (tokenizer->ownership == ST_STRING_INLINE) {
+    if (length <= ST_INLINE_BUFFER_SIZE) {
+      // The inline buffer is big enough.
+      return 1;
+    }
+    // Spill the inline buffer to the heap.
+    char *string = (char *)malloc(length);
+    ST_STATS_ADD(tokenizer, allocations, 1);
+    if (string == NULL) {
+      return 0;
+    }
+    ST_STATS_ADD(tokenizer, bytes_copied, ST_INLINE_BUFFER_SIZE);
+    memcpy(string, tokenizer->inline_buffer, ST_INLINE_BUFFER_SIZE);
+    tokenizer->string = string;
+    tokenizer->length = length;
+    tokenizer->ownership = ST_STRING_OWNED;
+    return 1;
+  }
+  char *string = (char *)realloc(tokenizer->string, length);
+  ST_STATS_ADD(tokenizer, reallocations, 1);
+  if (string == NULL) {
+    // Failed to resize the buffer.
+    return 0;
+  }
+  // The characters are moved when the block can not grow in place.
+  ST_STATS_ADD(tokenizer, bytes_copied, string != tokenizer->string ? tokenizer->position : 0);
+  // Update the buffer string and the length.
+  tokenizer->string = string;
+  tokenizer->length = length;
+  return 1;
+}
+
 /**
  * {@inheritdoc}
  */
 int st_expand_string(struct StringTokenizer *tokenizer, const size_t size) {
+  if (tokenizer->ownership == ST_STRING_MAPPED || tokenizer->stream != NULL) {
+    // File mappings and stream windows are read-only input.
+    return 0;
+  }
   // Check if we have enough space in the tokenizer buffer to append the requested string.
   if ((tokenizer->position + size) < tokenizer->length) {
     // The buffer already has enough space for the requested string size.
     return 1;
   }
   // Determine the size to add to the buffer.
-  size_t add_size = size > tokenizer->incremental_factor ? size : tokenizer->incremental_factor;
+  size_t add_size;
+  if (tokenizer->growth_policy == ST_GROWTH_LINEAR) {
+    add_size = size > tokenizer->incremental_factor ? size : tokenizer->incremental_factor;
+    tokenizer->incremental_factor = add_size;
+  }
+  else {
+    add_size = tokenizer->length > tokenizer->incremental_factor ? tokenizer->length : tokenizer->incremental_factor;
+  }
+  if (tokenizer->max_increment != 0 && add_size > tokenizer->max_increment) {
+    add_size = tokenizer->max_increment;
+  }
+  // Always make room for the requested size and the null character.
   size_t new_length = tokenizer->length + add_size;
+  if (new_length <= tokenizer->position + size) {
+    new_length = tokenizer->position + size + sizeof("");
+  }
   // Add more space to the buffer.
-  char *string = (char *)realloc(tokenizer->string, new_length);
-  if (string == NULL) {
-    // Failed to add more space.
+  ST_STATS_ADD(tokenizer, expansions, 1);
+  return st_resize_string(tokenizer, new_length);
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_set_growth_policy(struct StringTokenizer *tokenizer, const enum StringGrowthPolicy policy, const size_t max_increment) {
+  tokenizer->growth_policy = policy;
+  tokenizer->max_increment = max_increment;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_reserve(struct StringTokenizer *tokenizer, const size_t length) {
+  if (length <= tokenizer->length) {
+    // The buffer is already big enough.
+    return 1;
+  }
+  return st_resize_string(tokenizer, length);
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_shrink_to_fit(struct StringTokenizer *tokenizer) {
+  size_t length = tokenizer->position + sizeof("");
+  if (length >= tokenizer->length) {
+    // Nothing to release.
+    return 1;
+  }
+  if (st_resize_string(tokenizer, length) == 0) {
     return 0;
   }
-  // Update the buffer string and the length.
-  tokenizer->string = string;
-  tokenizer->length = new_length;
-  tokenizer->incremental_factor = add_size;
-  // String size expansion completed.
+  // Zero/null terminate the tokenizer string.
+  tokenizer->string[tokenizer->position] = '\0';
   return 1;
 }
 
 /**
  * {@inheritdoc}
  */
-int st_append_string(struct StringTokenizer *tokenizer, const char *string) {
-  // Get the length of the string to append.
-  size_t length = strlen(string);
+int st_append_n(struct StringTokenizer *tokenizer, const char *string, const size_t length) {
   // Check if we have enough space in the tokenizer buffer to append the given string.
   if (st_expand_string(tokenizer, length) == 0) {
     return 0;
   }
   // Copy values to the tokenizer buffer.
-  size_t index = 0;
-  size_t end = tokenizer->position + length;
-  while (tokenizer->position < end) {
-    tokenizer->string[tokenizer->position] = string[index];
-    tokenizer->position++;
-    index++;
-  }
+  memcpy(tokenizer->string + tokenizer->position, string, length);
+  tokenizer->position += length;
   // Zero/null terminate the tokenizer string.
   tokenizer->string[tokenizer->position] = '\0';
   // Append string completed.
@@ -279,16 +743,137 @@ int st_append_string(struct StringTokenizer *tokenizer, const char *string) {
 /**
  * {@inheritdoc}
  */
-int st_append_quoted_string(struct StringTokenizer *tokenizer, const char *string) {
-  if (st_append_string(tokenizer, "\"") == 0) {
+int st_append_char(struct StringTokenizer *tokenizer, const char token) {
+  // Check if we have enough space in the tokenizer buffer to append the character.
+  if (st_expand_string(tokenizer, 1) == 0) {
     return 0;
   }
-  if (st_append_string(tokenizer, string) == 0) {
+  tokenizer->string[tokenizer->position++] = token;
+  // Zero/null terminate the tokenizer string.
+  tokenizer->string[tokenizer->position] = '\0';
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_append_many(struct StringTokenizer *tokenizer, const struct StringView *fragments, const size_t count) {
+  // Make room for all the fragments at once.
+  size_t length = 0;
+  for (size_t i = 0; i < count; i++) {
+    length += fragments[i].len;
+  }
+  if (st_expand_string(tokenizer, length) == 0) {
     return 0;
   }
-  if (st_append_string(tokenizer, "\"") == 0) {
+  // Copy the fragments to the tokenizer buffer.
+  char *destination = tokenizer->string + tokenizer->position;
+  for (size_t i = 0; i < count; i++) {
+    memcpy(destination, fragments[i].ptr, fragments[i].len);
+    destination += fragments[i].len;
+  }
+  tokenizer->position += length;
+  // Zero/null terminate the tokenizer string.
+  tokenizer->string[tokenizer->position] = '\0';
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_append_string(struct StringTokenizer *tokenizer, const char *string) {
+  return st_append_n(tokenizer, string, strlen(string));
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_append_quoted_string(struct StringTokenizer *tokenizer, const char *string) {
+  struct StringView fragments[] = {{"\"", 1}, {string, strlen(string)}, {"\"", 1}};
+  return st_append_many(tokenizer, fragments, sizeof(fragments) / sizeof(fragments[0]));
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_append_escaped_n(struct StringTokenizer *tokenizer, const char *string, const size_t length) {
+  static const char hex_digits[] = "0123456789abcdef";
+  // Make room for the clean string and the quotes, escapes expand as they come.
+  if (st_expand_string(tokenizer, length + 2) == 0) {
     return 0;
   }
+  tokenizer->string[tokenizer->position++] = '"';
+  size_t index = 0;
+  while (index < length) {
+    // Copy the run of characters that don't need escaping.
+    size_t run = st_scan_escape(string + index, length - index);
+    if (st_expand_string(tokenizer, run + STRING_TOKENIZER_MAX_ESCAPE_SIZE + 1) == 0) {
+      return 0;
+    }
+    memcpy(tokenizer->string + tokenizer->position, string + index, run);
+    tokenizer->position += run;
+    index += run;
+    if (index == length) {
+      break;
+    }
+    // Escape the character that stopped the run.
+    char *destination = tokenizer->string + tokenizer->position;
+    unsigned char token = (unsigned char)string[index++];
+    destination[0] = '\\';
+    switch (token) {
+      case '"':
+      case '\\':
+        destination[1] = (char)token;
+        break;
+      case '\b':
+        destination[1] = 'b';
+        break;
+      case '\f':
+        destination[1] = 'f';
+        break;
+      case '\n':
+        destination[1] = 'n';
+        break;
+      case '\r':
+        destination[1] = 'r';
+        break;
+      case '\t':
+        destination[1] = 't';
+        break;
+      default:
+        memcpy(destination + 1, "u00", 3);
+        destination[4] = hex_digits[token >> 4];
+        destination[5] = hex_digits[token & 0xF];
+        tokenizer->position += STRING_TOKENIZER_MAX_ESCAPE_SIZE;
+        continue;
+    }
+    tokenizer->position += 2;
+  }
+  tokenizer->string[tokenizer->position++] = '"';
+  // Zero/null terminate the tokenizer string.
+  tokenizer->string[tokenizer->position] = '\0';
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_append_escaped_string(struct StringTokenizer *tokenizer, const char *string) {
+  return st_append_escaped_n(tokenizer, string, strlen(string));
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_append_int(struct StringTokenizer *tokenizer, const int64_t value) {
+  // Make room for the longest integer string.
+  if (st_expand_string(tokenizer, ITOS_BUFFER_SIZE) == 0) {
+    return 0;
+  }
+  // Convert the integer straight into the tokenizer buffer.
+  uint64_t start = ST_STATS_CLOCK(tokenizer);
+  tokenizer->position += i64tos_to(tokenizer->string + tokenizer->position, value);
+  ST_STATS_SINCE(tokenizer, start);
   return 1;
 }
 
@@ -296,13 +881,40 @@ int st_append_quoted_string(struct StringTokenizer *tokenizer, const char *strin
  * {@inheritdoc}
  */
 int st_append_double(struct StringTokenizer *tokenizer, const double *value) {
-  // Buffer to hold the converted double value as a string.
-  char string[32];
-  // Convert double to string with 6 decimal places precision.
-  char *result = gcvt(*value, 6, string);
-  if (result == NULL) {
+  // Make room for the longest double string.
+  if (st_expand_string(tokenizer, DTOS_BUFFER_SIZE) == 0) {
     return 0;
   }
-  // Append the string to the tokenizer.
-  return st_append_string(tokenizer, string);
+  // Convert the double straight into the tokenizer buffer.
+  uint64_t start = ST_STATS_CLOCK(tokenizer);
+  tokenizer->position += dtos_to(tokenizer->string + tokenizer->position, *value);
+  ST_STATS_SINCE(tokenizer, start);
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_append_double_precision(struct StringTokenizer *tokenizer, const double *value, const int precision) {
+  // Make room for the longest double string.
+  if (st_expand_string(tokenizer, DTOS_BUFFER_SIZE) == 0) {
+    return 0;
+  }
+  // Convert the double straight into the tokenizer buffer.
+  uint64_t start = ST_STATS_CLOCK(tokenizer);
+  tokenizer->position += dtos_precision_to(tokenizer->string + tokenizer->position, *value, precision);
+  ST_STATS_SINCE(tokenizer, start);
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_append_fixed(struct StringTokenizer *tokenizer, const double *value, const int precision) {
+  // Convert the double on the stack, then append the actual length.
+  char buffer[DTOS_FIXED_BUFFER_SIZE];
+  uint64_t start = ST_STATS_CLOCK(tokenizer);
+  size_t length = dtos_fixed_to(buffer, *value, precision);
+  ST_STATS_SINCE(tokenizer, start);
+  return st_append_n(tokenizer, buffer, length);
 }
@@ -0,0 +1,87 @@
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+#define STRING_VIEW_FNV_OFFSET_BASIS 14695981039346656037ULL
+#define STRING_VIEW_FNV_PRIME 1099511628211ULL
+
+/**
+ * {@inheritdoc}
+ */
+struct StringView sv_from_string(const char *string) {
+  struct StringView view = {string, 0};
+  if (string != NULL) {
+    view.len = strlen(string);
+  }
+  return view;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int sv_compare(const struct StringView *a, const struct StringView *b) {
+  size_t length = a->len < b->len ? a->len : b->len;
+  int result = length > 0 ? memcmp(a->ptr, b->ptr, length) : 0;
+  if (result != 0) {
+    return result;
+  }
+  // Same prefix, the shortest view goes first.
+  if (a->len == b->len) {
+    return 0;
+  }
+  return a->len < b->len ? -1 : 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int sv_equals(const struct StringView *view, const char *string) {
+  size_t length = strlen(string);
+  if (length != view->len) {
+    return 0;
+  }
+  return length == 0 || memcmp(view->ptr, string, length) == 0;
+}
+
+/**
+ * {@inheritdoc}
+ */
+uint64_t sv_hash(const struct StringView *view) {
+  uint64_t hash = STRING_VIEW_FNV_OFFSET_BASIS;
+  for (size_t i = 0; i < view->len; i++) {
+    hash ^= (unsigned char)view->ptr[i];
+    hash *= STRING_VIEW_FNV_PRIME;
+  }
+  return hash;
+}
+
+/**
+ * {@inheritdoc}
+ */
+char *sv_to_string(const struct StringView *view) {
+  // Allocate enough space for the string.
+  char *string = (char *)malloc(view->len + sizeof(""));
+  if (string == NULL) {
+    return NULL;
+  }
+  // Copy the characters and zero/null terminate the string.
+  if (view->len > 0) {
+    memcpy(string, view->ptr, view->len);
+  }
+  string[view->len] = '\0';
+  return string;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int sv_to_double(const struct StringView *view, double *value) {
+  return view->len > 0 && stod(view->ptr, view->len, value) == view->len;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int sv_to_int64(const struct StringView *view, int64_t *value) {
+  return view->len > 0 && stoi64(view->ptr, view->len, value) == view->len;
+}
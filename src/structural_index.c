@@ -0,0 +1,319 @@
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define STRUCTURAL_INDEX_X86 1
+#endif
+
+/**
+ * The number of characters classified at once, one bit per character.
+ */
+#define STRUCTURAL_INDEX_BLOCK_SIZE 64
+
+/**
+ * The first byte value that is not considered whitespace.
+ */
+#define STRUCTURAL_INDEX_WHITESPACE_LIMIT 33
+
+/**
+ * Struct definition for the character classes of a block.
+ */
+struct StructuralIndexMasks {
+
+  /**
+   * The whitespace characters.
+   */
+  uint64_t whitespace;
+
+  /**
+   * The structural characters '{', '}', '[', ']', ':' and ','.
+   */
+  uint64_t operators;
+
+  /**
+   * The double quotes.
+   */
+  uint64_t quotes;
+
+  /**
+   * The backslashes.
+   */
+  uint64_t backslashes;
+};
+
+/**
+ * Scalar kernel, classifies the characters of a block.
+ */
+static void structural_index_classify_scalar(const char *block, struct StructuralIndexMasks *masks) {
+  masks->whitespace = 0;
+  masks->operators = 0;
+  masks->quotes = 0;
+  masks->backslashes = 0;
+  for (int i = 0; i < STRUCTURAL_INDEX_BLOCK_SIZE; i++) {
+    unsigned char token = (unsigned char)block[i];
+    uint64_t bit = 1ULL << i;
+    if (token < STRUCTURAL_INDEX_WHITESPACE_LIMIT) {
+      masks->whitespace |= bit;
+    }
+    else if (token == '{' || token == '}' || token == '[' || token == ']' || token == ':' || token == ',') {
+      masks->operators |= bit;
+    }
+    else if (token == '"') {
+      masks->quotes |= bit;
+    }
+    else if (token == '\\') {
+      masks->backslashes |= bit;
+    }
+  }
+}
+
+#ifdef STRUCTURAL_INDEX_X86
+
+/**
+ * SSE2 kernel, classifies the characters of a block.
+ */
+__attribute__((target("sse2")))
+static void structural_index_classify_sse2(const char *block, struct StructuralIndexMasks *masks) {
+  const __m128i limit = _mm_set1_epi8(STRUCTURAL_INDEX_WHITESPACE_LIMIT - 1);
+  masks->whitespace = 0;
+  masks->operators = 0;
+  masks->quotes = 0;
+  masks->backslashes = 0;
+  for (int i = 0; i < STRUCTURAL_INDEX_BLOCK_SIZE; i += 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i *)(block + i));
+    __m128i operators = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('{')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('}')));
+    operators = _mm_or_si128(operators, _mm_cmpeq_epi8(chunk, _mm_set1_epi8('[')));
+    operators = _mm_or_si128(operators, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(']')));
+    operators = _mm_or_si128(operators, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(':')));
+    operators = _mm_or_si128(operators, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(',')));
+    // Unsigned chunk < limit, the min is the chunk itself.
+    masks->whitespace |= (uint64_t)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(chunk, limit), chunk)) << i;
+    masks->operators |= (uint64_t)(unsigned int)_mm_movemask_epi8(operators) << i;
+    masks->quotes |= (uint64_t)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"'))) << i;
+    masks->backslashes |= (uint64_t)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))) << i;
+  }
+}
+
+/**
+ * AVX2 kernel, classifies the characters of a block.
+ */
+__attribute__((target("avx2")))
+static void structural_index_classify_avx2(const char *block, struct StructuralIndexMasks *masks) {
+  const __m256i limit = _mm256_set1_epi8(STRUCTURAL_INDEX_WHITESPACE_LIMIT - 1);
+  masks->whitespace = 0;
+  masks->operators = 0;
+  masks->quotes = 0;
+  masks->backslashes = 0;
+  for (int i = 0; i < STRUCTURAL_INDEX_BLOCK_SIZE; i += 32) {
+    __m256i chunk = _mm256_loadu_si256((const __m256i *)(block + i));
+    __m256i operators = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('}')));
+    operators = _mm256_or_si256(operators, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('[')));
+    operators = _mm256_or_si256(operators, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(']')));
+    operators = _mm256_or_si256(operators, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(':')));
+    operators = _mm256_or_si256(operators, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(',')));
+    masks->whitespace |= (uint64_t)(unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(chunk, limit), chunk)) << i;
+    masks->operators |= (uint64_t)(unsigned int)_mm256_movemask_epi8(operators) << i;
+    masks->quotes |= (uint64_t)(unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('"'))) << i;
+    masks->backslashes |= (uint64_t)(unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\'))) << i;
+  }
+}
+
+/**
+ * AVX-512 kernel, classifies the characters of a block.
+ */
+__attribute__((target("avx512f,avx512bw")))
+static void structural_index_classify_avx512(const char *block, struct StructuralIndexMasks *masks) {
+  __m512i chunk = _mm512_loadu_si512((const void *)block);
+  masks->whitespace = _mm512_cmplt_epu8_mask(chunk, _mm512_set1_epi8(STRUCTURAL_INDEX_WHITESPACE_LIMIT));
+  masks->operators = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('{')) | _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('}'))
+    | _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('[')) | _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8(']'))
+    | _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8(':')) | _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8(','));
+  masks->quotes = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('"'));
+  masks->backslashes = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('\\'));
+}
+
+#endif
+
+/**
+ * Computes the prefix XOR of a mask, every bit becomes the XOR of itself and the lower bits.
+ *
+ * @param uint64_t mask
+ *   The mask.
+ *
+ * @return uint64_t
+ *   The prefix XOR.
+ */
+static inline uint64_t structural_index_prefix_xor(uint64_t mask) {
+  mask ^= mask << 1;
+  mask ^= mask << 2;
+  mask ^= mask << 4;
+  mask ^= mask << 8;
+  mask ^= mask << 16;
+  mask ^= mask << 32;
+  return mask;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int st_build_structural_index(struct StringTokenizer *tokenizer) {
+  if (tokenizer->stream != NULL) {
+    return 0;
+  }
+  st_drop_structural_index(tokenizer);
+  // Select the kernel of the current scan instruction set.
+  void (*classify)(const char *block, struct StructuralIndexMasks *masks) = structural_index_classify_scalar;
+#ifdef STRUCTURAL_INDEX_X86
+  switch (st_scan_isa()) {
+    case ST_SCAN_SSE2:
+      classify = structural_index_classify_sse2;
+      break;
+    case ST_SCAN_AVX2:
+      classify = structural_index_classify_avx2;
+      break;
+    case ST_SCAN_AVX512:
+      classify = structural_index_classify_avx512;
+      break;
+    default:
+      break;
+  }
+#endif
+  size_t length = tokenizer->length;
+  size_t blocks = (length + STRUCTURAL_INDEX_BLOCK_SIZE - 1) / STRUCTURAL_INDEX_BLOCK_SIZE;
+  size_t capacity = length / 8 + STRUCTURAL_INDEX_BLOCK_SIZE;
+  struct StringStructuralIndex *index = (struct StringStructuralIndex *)malloc(sizeof(struct StringStructuralIndex));
+  if (index == NULL) {
+    return 0;
+  }
+  index->positions = (size_t *)malloc(capacity * sizeof(size_t));
+  index->in_string = (uint64_t *)malloc((blocks + 1) * sizeof(uint64_t));
+  index->count = 0;
+  index->length = length;
+  index->hint = 0;
+  if (index->positions == NULL || index->in_string == NULL) {
+    free(index->positions);
+    free(index->in_string);
+    free(index);
+    return 0;
+  }
+  // The state carried from one block to the next.
+  uint64_t escape_carry = 0;
+  uint64_t string_carry = 0;
+  uint64_t scalar_carry = 0;
+  char padded[STRUCTURAL_INDEX_BLOCK_SIZE];
+  for (size_t block_index = 0; block_index < blocks; block_index++) {
+    size_t offset = block_index * STRUCTURAL_INDEX_BLOCK_SIZE;
+    const char *block = tokenizer->string + offset;
+    if (length - offset < STRUCTURAL_INDEX_BLOCK_SIZE) {
+      // Pad the last block with whitespace.
+      memset(padded, ' ', STRUCTURAL_INDEX_BLOCK_SIZE);
+      memcpy(padded, block, length - offset);
+      block = padded;
+    }
+    struct StructuralIndexMasks masks;
+    classify(block, &masks);
+    // Find the characters escaped by a backslash.
+    uint64_t escaped = escape_carry;
+    uint64_t backslashes = masks.backslashes & ~escape_carry;
+    escape_carry = 0;
+    while (backslashes != 0) {
+      int bit = __builtin_ctzll(backslashes);
+      if (bit == STRUCTURAL_INDEX_BLOCK_SIZE - 1) {
+        escape_carry = 1;
+        break;
+      }
+      // The escaped character can not escape the next one.
+      escaped |= 1ULL << (bit + 1);
+      backslashes &= ~(3ULL << bit);
+    }
+    // Mask the strings, from the opening quote to the closing one.
+    uint64_t quotes = masks.quotes & ~escaped;
+    uint64_t in_string = structural_index_prefix_xor(quotes) ^ string_carry;
+    string_carry = (uint64_t)0 - (in_string >> (STRUCTURAL_INDEX_BLOCK_SIZE - 1));
+    index->in_string[block_index] = in_string;
+    // Numbers and literals start after whitespace, an operator or a quote.
+    uint64_t scalars = ~(masks.whitespace | masks.operators | quotes | in_string);
+    uint64_t scalar_starts = scalars & ~((scalars << 1) | scalar_carry);
+    scalar_carry = scalars >> (STRUCTURAL_INDEX_BLOCK_SIZE - 1);
+    uint64_t structurals = (masks.operators & ~in_string) | quotes | scalar_starts;
+    // Append the positions.
+    if (index->count + STRUCTURAL_INDEX_BLOCK_SIZE > capacity) {
+      capacity *= 2;
+      size_t *positions = (size_t *)realloc(index->positions, capacity * sizeof(size_t));
+      if (positions == NULL) {
+        free(index->positions);
+        free(index->in_string);
+        free(index);
+        return 0;
+      }
+      index->positions = positions;
+    }
+    while (structurals != 0) {
+      index->positions[index->count++] = offset + __builtin_ctzll(structurals);
+      structurals &= structurals - 1;
+    }
+  }
+  tokenizer->structural_index = index;
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_drop_structural_index(struct StringTokenizer *tokenizer) {
+  struct StringStructuralIndex *index = tokenizer->structural_index;
+  if (index != NULL) {
+    free(index->positions);
+    free(index->in_string);
+    free(index);
+    tokenizer->structural_index = NULL;
+  }
+}
+
+/**
+ * {@inheritdoc}
+ */
+size_t st_structural_next(struct StringStructuralIndex *index, const size_t position) {
+  size_t low = 0;
+  size_t high = index->count;
+  size_t hint = index->hint;
+  // Most lookups land on the hint or right after it.
+  if (hint < high && index->positions[hint] >= position) {
+    if (hint == 0 || index->positions[hint - 1] < position) {
+      return index->positions[hint];
+    }
+    high = hint;
+  }
+  else if (hint < high) {
+    low = hint + 1;
+    if (low < high && index->positions[low] >= position) {
+      index->hint = low;
+      return index->positions[low];
+    }
+  }
+  // Binary search of the first position not lower than the given one.
+  while (low < high) {
+    size_t middle = low + (high - low) / 2;
+    if (index->positions[middle] < position) {
+      low = middle + 1;
+    }
+    else {
+      high = middle;
+    }
+  }
+  index->hint = low;
+  return low < index->count ? index->positions[low] : index->length;
+}
+
+/**
+ * {@inheritdoc}
+ */
+void st_next_structural(struct StringTokenizer *tokenizer) {
+  if (tokenizer->structural_index == NULL) {
+    st_next_token(tokenizer);
+    return;
+  }
+  tokenizer->position = st_structural_next(tokenizer->structural_index, tokenizer->position + 1);
+}
@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+#define CLASS_TEST_BUFFER_SIZE 100
+
+/**
+ * {@inheritdoc}
+ */
+int run_is_numeric_unit_tests() {
+  // Show friendly message.
+  printf("------------------- is_numeric(x) -------------------\n");
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < 256; i++) {
+    char token = (char)i;
+    int expected = (token >= '0' && token <= '9') || strchr("+-.eE", token) != NULL;
+    if (token == '\0') {
+      expected = 0;
+    }
+    if (is_numeric(token) != expected) {
+      printf("[Failed] is_numeric(%d) failed: expected %d.\n", i, expected);
+      exit_status = EXIT_FAILURE;
+    }
+  }
+  if (exit_status == EXIT_SUCCESS) {
+    printf("[Passed] is_numeric() classifies the 256 byte values.\n");
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_char_classes_unit_tests() {
+  // Show friendly message.
+  printf("------------------- st_char_classes[x] -------------------\n");
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < 256; i++) {
+    char token = (char)i;
+    int is_digit = i >= '0' && i <= '9';
+    int is_alpha = (i >= 'a' && i <= 'z') || (i >= 'A' && i <= 'Z');
+    unsigned int expected = 0;
+    expected |= i <= ' ' ? ST_CLASS_WHITESPACE : 0;
+    expected |= is_digit ? ST_CLASS_DIGIT : 0;
+    expected |= is_numeric(token) ? ST_CLASS_NUMERIC : 0;
+    expected |= is_digit || (i >= 'a' && i <= 'f') || (i >= 'A' && i <= 'F') ? ST_CLASS_HEX : 0;
+    expected |= i != 0 && strchr("{}[]:,", token) != NULL ? ST_CLASS_STRUCTURAL : 0;
+    expected |= i < ' ' || i == '"' || i == '\\' ? ST_CLASS_ESCAPE : 0;
+    expected |= is_alpha ? ST_CLASS_ALPHA : 0;
+    if (st_char_classes[i] != expected) {
+      printf("[Failed] st_char_classes[%d] failed: expected 0x%02X, got 0x%02X.\n", i, expected, st_char_classes[i]);
+      exit_status = EXIT_FAILURE;
+    }
+  }
+  if (exit_status == EXIT_SUCCESS) {
+    printf("[Passed] st_char_classes[] classifies the 256 byte values.\n");
+  }
+  // The built-in classes are combined with a mask.
+  if (st_char_is(' ', ST_CLASS_WHITESPACE | ST_CLASS_STRUCTURAL) != 1 || st_char_is(',', ST_CLASS_WHITESPACE | ST_CLASS_STRUCTURAL) != 1 || st_char_is('a', ST_CLASS_WHITESPACE | ST_CLASS_STRUCTURAL) != 0) {
+    printf("[Failed] st_char_is() failed to combine the classes.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_char_is() combines the classes.\n");
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_scan_class_unit_tests() {
+  // Show friendly message.
+  printf("------------------- st_scan_class(x) -------------------\n");
+  int exit_status = EXIT_SUCCESS;
+  // The delimiters are the structural characters, '|' and the byte 0xC3.
+  struct StringCharClass delimiters;
+  st_char_class_init(&delimiters, ST_CLASS_STRUCTURAL, "|\xC3");
+  if (st_char_class_has(&delimiters, '|') != 1 || st_char_class_has(&delimiters, ':') != 1 || st_char_class_has(&delimiters, 'a') != 0 || st_char_class_has(&delimiters, '\0') != 0) {
+    printf("[Failed] st_char_class_init() failed to build the class.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_char_class_init() builds the class.\n");
+  }
+  // Place each delimiter at every offset.
+  const char targets[] = {'|', ']', ',', (char)0xC3};
+  char buffer[CLASS_TEST_BUFFER_SIZE];
+  int found = 1;
+  for (size_t length = 0; length <= CLASS_TEST_BUFFER_SIZE; length += 7) {
+    memset(buffer, 'a', CLASS_TEST_BUFFER_SIZE);
+    found &= st_scan_class(buffer, length, &delimiters) == length;
+    for (size_t target = 0; target < length; target++) {
+      memset(buffer, 'a', CLASS_TEST_BUFFER_SIZE);
+      buffer[target] = targets[target % sizeof(targets)];
+      found &= st_scan_class(buffer, length, &delimiters) == target;
+    }
+  }
+  // Any non-zero member byte belongs to the class.
+  memset(buffer, 'a', CLASS_TEST_BUFFER_SIZE);
+  delimiters.members['a'] = 0xFF;
+  found &= st_scan_class(buffer, CLASS_TEST_BUFFER_SIZE, &delimiters) == 0;
+  delimiters.members['a'] = 0;
+  delimiters.members['b'] = 2;
+  buffer[5] = 'b';
+  found &= st_scan_class(buffer, CLASS_TEST_BUFFER_SIZE, &delimiters) == 5;
+  if (found == 0) {
+    printf("[Failed] st_scan_class() failed to find the delimiters.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_scan_class() finds the delimiters at every offset.\n");
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_char_class_tests() {
+  // Run is_numeric(x) unit tests.
+  if (run_is_numeric_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_char_classes[x] unit tests.
+  if (run_st_char_classes_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_scan_class(x) unit tests.
+  if (run_st_scan_class_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Return success status.
+  return EXIT_SUCCESS;
+}
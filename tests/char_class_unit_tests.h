@@ -0,0 +1,45 @@
+#ifndef CHAR_CLASS_UNIT_TESTS_H
+#define CHAR_CLASS_UNIT_TESTS_H
+
+/**
+ * Runs all the unit tests for character classification functions.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_char_class_tests();
+
+/**
+ * Run unit tests for the is_numeric() function.
+ *
+ * This function checks every byte value and compares the result with the
+ * characters of a numeric token.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_is_numeric_unit_tests();
+
+/**
+ * Run unit tests for the classification table.
+ *
+ * This function compares the classes of every byte value with the expected
+ * whitespace, digit, hexadecimal, structural, escape and letter characters.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_char_classes_unit_tests();
+
+/**
+ * Run unit tests for the custom classes and the st_scan_class() function.
+ *
+ * This function builds a class of delimiters and places them at every offset of
+ * buffers of different lengths, and checks the index found by the scan.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_scan_class_unit_tests();
+
+#endif // CHAR_CLASS_UNIT_TESTS_H
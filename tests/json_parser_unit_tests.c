@@ -0,0 +1,285 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+/**
+ * The events received by the test handler.
+ */
+struct JsonTestEvents {
+  char buffer[256];
+  size_t length;
+};
+
+/**
+ * Appends an event to the test events.
+ */
+static int json_test_event(void *context, const char *event, const struct StringView *view) {
+  struct JsonTestEvents *events = (struct JsonTestEvents *)context;
+  size_t size = sizeof(events->buffer) - events->length;
+  int written = view != NULL ? snprintf(events->buffer + events->length, size, "%s:%.*s ", event, (int)view->len, view->ptr) : snprintf(events->buffer + events->length, size, "%s ", event);
+  events->length += (size_t)written < size ? (size_t)written : size - 1;
+  return 1;
+}
+
+static int json_test_start_object(void *context) {
+  return json_test_event(context, "{", NULL);
+}
+
+static int json_test_end_object(void *context) {
+  return json_test_event(context, "}", NULL);
+}
+
+static int json_test_start_array(void *context) {
+  return json_test_event(context, "[", NULL);
+}
+
+static int json_test_end_array(void *context) {
+  return json_test_event(context, "]", NULL);
+}
+
+static int json_test_key(void *context, const struct StringView *key) {
+  return json_test_event(context, "k", key);
+}
+
+static int json_test_string(void *context, const struct StringView *value) {
+  return json_test_event(context, "s", value);
+}
+
+static int json_test_number(void *context, const struct StringView *raw, double value) {
+  char buffer[DTOS_BUFFER_SIZE];
+  struct StringView view = {buffer, dtos_to(buffer, value)};
+  return json_test_event(context, "n", &view);
+}
+
+static int json_test_boolean(void *context, int value) {
+  return json_test_event(context, value ? "true" : "false", NULL);
+}
+
+static int json_test_null(void *context) {
+  return json_test_event(context, "null", NULL);
+}
+
+/**
+ * The test handler, records every event.
+ */
+static const struct JsonHandler json_test_handler = {
+  json_test_start_object,
+  json_test_end_object,
+  json_test_start_array,
+  json_test_end_array,
+  json_test_key,
+  json_test_string,
+  json_test_number,
+  json_test_boolean,
+  json_test_null,
+};
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_json_parse_unit_tests() {
+  // Define documents and the expected events, NULL for invalid documents.
+  const char *document_values[] = {
+    " {\"a\": [1, -2.5e1, true], \"b\" : {\"c\": null, \"d\": \"x\\\"y\"}, \"e\": []} ",
+    "[]",
+    "  42",
+    "\"\\u00e9\"",
+    "[0, -0.5, 1E+2, 2e-1]",
+    "[1, 2,]",
+    "{\"a\" 1}",
+    "{\"a\": 1,}",
+    "[1 2]",
+    "[\"open",
+    "{\"a\": tru}",
+    "[01]",
+    "[+1]",
+    "[.5]",
+    "[1.]",
+    "[1e]",
+    "",
+  };
+  const char *expected_values[] = {
+    "{ k:a [ n:1 n:-25 true ] k:b { k:c null k:d s:x\\\"y } k:e [ ] } ",
+    "[ ] ",
+    "n:42 ",
+    "s:\\u00e9 ",
+    "[ n:0 n:-0.5 n:100 n:0.2 ] ",
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+  };
+  // Calculate the number of values to test.
+  int num_tests = sizeof(document_values) / sizeof(document_values[0]);
+  // Show friendly message.
+  printf("------------------- st_json_parse(x) -------------------\n");
+  // Test the values, from memory and from a stream with tiny chunks.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    for (int streaming = 0; streaming < 2; streaming++) {
+      struct JsonTestEvents events = {"", 0};
+      char string[128];
+      strcpy(string, document_values[i]);
+      FILE *file = NULL;
+      struct StringTokenizer *tokenizer = NULL;
+      if (streaming == 0) {
+        tokenizer = st_create_n(string, strlen(string) > 0 ? strlen(string) : 1);
+      }
+      else if ((file = tmpfile()) != NULL) {
+        fputs(string, file);
+        rewind(file);
+        tokenizer = st_create_from_file(file, 2);
+      }
+      int parsed = tokenizer != NULL && st_json_parse(tokenizer, &json_test_handler, &events);
+      if (parsed != (expected_values[i] != NULL) || (parsed == 1 && strcmp(events.buffer, expected_values[i]) != 0)) {
+        printf("[Failed] st_json_parse('%s') failed: got '%s'.\n", document_values[i], events.buffer);
+        exit_status = EXIT_FAILURE;
+      }
+      else if (streaming == 1) {
+        // Print success message.
+        printf("[Passed] st_json_parse('%s') is %s.\n", document_values[i], parsed ? "valid" : "invalid");
+      }
+      st_destroy(tokenizer);
+      if (file != NULL) {
+        fclose(file);
+      }
+    }
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_json_unescape_unit_tests() {
+  // Define escaped strings and the expected values, NULL for invalid ones.
+  const char *escaped_values[] = {"plain", "a\\\"b\\\\c\\/d", "\\n\\t\\r\\b\\f", "\\u0041\\u00e9\\u20ac", "\\ud83d\\ude00", "bad\\x", "\\ud83d", "\\u12"};
+  const char *expected_values[] = {"plain", "a\"b\\c/d", "\n\t\r\b\f", "A\xC3\xA9\xE2\x82\xAC", "\xF0\x9F\x98\x80", NULL, NULL, NULL};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(escaped_values) / sizeof(escaped_values[0]);
+  // Show friendly message.
+  printf("------------------- st_json_unescape(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    struct StringView view = sv_from_string(escaped_values[i]);
+    char buffer[64];
+    size_t length = 0;
+    int unescaped = st_json_unescape(&view, buffer, &length);
+    if (unescaped != (expected_values[i] != NULL) || (unescaped == 1 && (length != strlen(expected_values[i]) || strcmp(buffer, expected_values[i]) != 0))) {
+      printf("[Failed] st_json_unescape(\"%s\") failed.\n", escaped_values[i]);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] st_json_unescape(\"%s\") is %s.\n", escaped_values[i], unescaped ? "valid" : "invalid");
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_find_key_unit_tests() {
+  // Define the document and the keys to find in document order.
+  const char *document = "{\"skip\": {\"a\": [1, {\"id\": 0}], \"s\": \"}]\\\"\"}, \"list\": [[], \"id\"], \"n\": -1.5e2 ,\"id\": \"x\", \"last\": true}";
+  const char *key_values[] = {"id", "last", "missing"};
+  const char *expected_values[] = {"\"x\"", "true", NULL};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(key_values) / sizeof(key_values[0]);
+  const char *mode_names[] = {"plain", "indexed", "streaming"};
+  // Show friendly message.
+  printf("------------------- st_find_key(x) -------------------\n");
+  // Test the values in every mode.
+  int exit_status = EXIT_SUCCESS;
+  for (int mode = 0; mode < 3; mode++) {
+    char string[256];
+    strcpy(string, document);
+    FILE *file = NULL;
+    struct StringTokenizer *tokenizer = NULL;
+    if (mode < 2) {
+      tokenizer = st_create(string);
+      if (mode == 1) {
+        st_build_structural_index(tokenizer);
+      }
+    }
+    else if ((file = tmpfile()) != NULL) {
+      fputs(string, file);
+      rewind(file);
+      tokenizer = st_create_from_file(file, 3);
+    }
+    for (int i = 0; i < num_tests && tokenizer != NULL; i++) {
+      int found = st_find_key(tokenizer, key_values[i]);
+      // Skip the value to get its characters.
+      char value[32] = "";
+      if (found == 1) {
+        // Load the value at once, so the streaming window does not move while skipping it.
+        st_ensure(tokenizer, sizeof(value));
+        size_t start = tokenizer->position;
+        if (st_skip_value(tokenizer) == 1 && tokenizer->position - start < sizeof(value)) {
+          memcpy(value, tokenizer->string + start, tokenizer->position - start + 1);
+          value[tokenizer->position - start + 1] = '\0';
+        }
+      }
+      if (found != (expected_values[i] != NULL) || (found == 1 && strcmp(value, expected_values[i]) != 0) || (found == 0 && st_current_token(tokenizer) != '}')) {
+        printf("[Failed] %s st_find_key(\"%s\") failed: got '%s'.\n", mode_names[mode], key_values[i], value);
+        exit_status = EXIT_FAILURE;
+        continue;
+      }
+      // Print success message.
+      printf("[Passed] %s st_find_key(\"%s\") is '%s'.\n", mode_names[mode], key_values[i], found ? value : "not found");
+    }
+    st_destroy(tokenizer);
+    if (file != NULL) {
+      fclose(file);
+    }
+  }
+  // A missing value can not be skipped, with and without a structural index.
+  const char *missing_values[] = {"{\"a\":}", "{\"a\": ]", "{\"a\": ,\"b\": 1}", "{\"a\": :1}"};
+  for (int mode = 0; mode < 2; mode++) {
+    for (size_t i = 0; i < sizeof(missing_values) / sizeof(missing_values[0]); i++) {
+      char string[32];
+      strcpy(string, missing_values[i]);
+      struct StringTokenizer *tokenizer = st_create(string);
+      if (mode == 1) {
+        st_build_structural_index(tokenizer);
+      }
+      int found = st_find_key(tokenizer, "a");
+      size_t position = tokenizer->position;
+      if (found == 0 || st_skip_value(tokenizer) != 0 || tokenizer->position != position) {
+        printf("[Failed] %s st_skip_value('%s') skipped a missing value.\n", mode_names[mode], missing_values[i]);
+        exit_status = EXIT_FAILURE;
+      }
+      else {
+        // Print success message.
+        printf("[Passed] %s st_skip_value('%s') reports the missing value.\n", mode_names[mode], missing_values[i]);
+      }
+      st_destroy(tokenizer);
+    }
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_json_parser_tests() {
+  // Run st_json_parse(x) unit tests.
+  if (run_st_json_parse_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_json_unescape(x) unit tests.
+  if (run_st_json_unescape_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_find_key(x) unit tests.
+  if (run_st_find_key_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Return success status.
+  return EXIT_SUCCESS;
+}
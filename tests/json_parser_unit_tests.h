@@ -0,0 +1,46 @@
+#ifndef JSON_PARSER_UNIT_TESTS_H
+#define JSON_PARSER_UNIT_TESTS_H
+
+/**
+ * Runs all the unit tests for JSON parser functions.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_json_parser_tests();
+
+/**
+ * Run unit tests for the st_json_parse() function.
+ *
+ * This function parses a set of predefined documents, from memory and from a
+ * stream with tiny chunks, and compares the events with the expected ones.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_json_parse_unit_tests();
+
+/**
+ * Run unit tests for the st_json_unescape() function.
+ *
+ * This function unescapes a set of predefined JSON strings and compares the
+ * results with the expected UTF-8 strings.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_json_unescape_unit_tests();
+
+/**
+ * Run unit tests for the st_find_key() and st_skip_value() functions.
+ *
+ * This function looks up keys in a document with nested values and strings full
+ * of brackets, with and without a structural index and from a stream, and
+ * compares the skipped values with the expected ones.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_find_key_unit_tests();
+
+#endif // JSON_PARSER_UNIT_TESTS_H
@@ -2,6 +2,16 @@
 #include <stdio.h>
 #include "../include/strutils.h"
 #include "numeric_string_unit_tests.h"
+#include "string_view_unit_tests.h"
+#include "string_scan_unit_tests.h"
+#include "string_tokenizer_unit_tests.h"
+#include "string_arena_unit_tests.h"
+#include "json_parser_unit_tests.h"
+#include "structural_index_unit_tests.h"
+#include "parallel_unit_tests.h"
+#include "string_output_unit_tests.h"
+#include "string_stats_unit_tests.h"
+#include "char_class_unit_tests.h"
 
 /**
  * Main Unit Testing controller function.
@@ -19,8 +29,46 @@ int main(int argc, char const *argv[]) {
     // Unit tests failed.
     return EXIT_FAILURE;
   }
-  // @todo: Implement unit testing for string tokenizer functions and is_numeric function.
-  printf("@todo: Implement unit tests for the StringTokenizer functions and the is_numeric function.\n");
+  if (run_string_view_tests() == EXIT_FAILURE) {
+    // Unit tests failed.
+    return EXIT_FAILURE;
+  }
+  if (run_string_scan_tests() == EXIT_FAILURE) {
+    // Unit tests failed.
+    return EXIT_FAILURE;
+  }
+  if (run_string_tokenizer_tests() == EXIT_FAILURE) {
+    // Unit tests failed.
+    return EXIT_FAILURE;
+  }
+  if (run_string_arena_tests() == EXIT_FAILURE) {
+    // Unit tests failed.
+    return EXIT_FAILURE;
+  }
+  if (run_json_parser_tests() == EXIT_FAILURE) {
+    // Unit tests failed.
+    return EXIT_FAILURE;
+  }
+  if (run_structural_index_tests() == EXIT_FAILURE) {
+    // Unit tests failed.
+    return EXIT_FAILURE;
+  }
+  if (run_parallel_tests() == EXIT_FAILURE) {
+    // Unit tests failed.
+    return EXIT_FAILURE;
+  }
+  if (run_string_output_tests() == EXIT_FAILURE) {
+    // Unit tests failed.
+    return EXIT_FAILURE;
+  }
+  if (run_string_stats_tests() == EXIT_FAILURE) {
+    // Unit tests failed.
+    return EXIT_FAILURE;
+  }
+  if (run_char_class_tests() == EXIT_FAILURE) {
+    // Unit tests failed.
+    return EXIT_FAILURE;
+  }
   // Unit tests succeeded.
   return EXIT_SUCCESS;
 }
@@ -3,6 +3,7 @@
 #include <string.h>
 #include <math.h>
 #include <errno.h>
+#include <locale.h>
 #include "../include/strutils.h"
 
 /**
@@ -42,6 +43,52 @@ int run_itos_unit_tests() {
   return exit_status;
 }
 
+/**
+ * {@inheritdoc}
+ */
+int run_i64tos_unit_tests() {
+  // Define int64 and expected string values used for testing.
+  int64_t int_values[] = {0, 9, 10, -99, 100, 1234567890123LL, INT64_MAX, INT64_MIN};
+  const char *string_values[] = {"0", "9", "10", "-99", "100", "1234567890123", "9223372036854775807", "-9223372036854775808"};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(int_values) / sizeof(int_values[0]);
+  // Show friendly message.
+  printf("------------------- i64tos_to(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    char result[ITOS_BUFFER_SIZE];
+    size_t length = i64tos_to(result, int_values[i]);
+    if (length != strlen(string_values[i]) || strcmp(result, string_values[i]) != 0) {
+      printf("[Failed] i64tos_to(%s) failed: got '%s'\n", string_values[i], result);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] i64tos_to(%s) is '%s'.\n", string_values[i], result);
+  }
+  // Every power of ten and its predecessor have a different number of digits.
+  char result[ITOS_BUFFER_SIZE];
+  char expected[ITOS_BUFFER_SIZE];
+  uint64_t power = 1;
+  for (int i = 0; i < 20; i++, power *= 10) {
+    u64tos_to(result, power - 1);
+    snprintf(expected, sizeof(expected), "%llu", (unsigned long long)(power - 1));
+    if (strcmp(result, expected) != 0) {
+      printf("[Failed] u64tos_to(%s) failed: got '%s'\n", expected, result);
+      exit_status = EXIT_FAILURE;
+    }
+  }
+  u64tos_to(result, UINT64_MAX);
+  if (strcmp(result, "18446744073709551615") != 0) {
+    printf("[Failed] u64tos_to(UINT64_MAX) failed: got '%s'\n", result);
+    exit_status = EXIT_FAILURE;
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
 /**
  * {@inheritdoc}
  */
@@ -140,6 +187,264 @@ int run_stold_unit_tests() {
   return exit_status;
 }
 
+/**
+ * {@inheritdoc}
+ */
+int run_stod_unit_tests() {
+  // Define string and expected double values used for testing.
+  const char *string_values[] = {"0", "-0.5", "118.0472176809648", "1e-400", "1.7976931348623157e308", "4.9406564584124654e-324", "9007199254740993", "1.00000000000000011102230246251565404236316680908203125", "12.5e", "-"};
+  double double_values[] = {0.0, -0.5, 118.0472176809648, 0.0, 1.7976931348623157e308, 4.9406564584124654e-324, 9007199254740992.0, 1.0, 12.5, 0.0};
+  size_t consumed_values[] = {1, 4, 17, 6, 22, 23, 16, 55, 4, 0};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(string_values) / sizeof(string_values[0]);
+  // Show friendly message.
+  printf("------------------- stod(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    const char *string_value = string_values[i];
+    double result = 0.0;
+    size_t consumed = stod(string_value, strlen(string_value), &result);
+    if (consumed != consumed_values[i]) {
+      printf("[Failed]  stod(\"%s\") failed: expected %zu characters converted, got %zu.\n", string_value, consumed_values[i], consumed);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    if (consumed != 0 && result != double_values[i]) {
+      printf("[Failed]  stod(\"%s\") failed: expected %.17g, got %.17g.\n", string_value, double_values[i], result);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed]  stod(\"%s\") is %.17g.\n", string_value, result);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_dtos_unit_tests() {
+  // Define double and expected string values used for testing.
+  double double_values[] = {0.1, -1234.5678, 118.0472176809648, 1e21, 0.00001, 5e-324, 1.7976931348623157e308, 2.0 / 3.0};
+  const char *string_values[] = {"0.1", "-1234.5678", "118.0472176809648", "1e+21", "0.00001", "5e-324", "1.7976931348623157e+308", "0.6666666666666666"};
+  const char *precision_values[] = {"0.1", "-1234.57", "118.047", "1e+21", "0.00001", "4.94066e-324", "1.79769e+308", "0.666667"};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(double_values) / sizeof(double_values[0]);
+  // Show friendly message.
+  printf("------------------- dtos_to(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    char result[DTOS_BUFFER_SIZE];
+    size_t length = dtos_to(result, double_values[i]);
+    if (length != strlen(result) || strcmp(result, string_values[i]) != 0) {
+      printf("[Failed] dtos_to(%.17g) failed: expected '%s', got '%s'\n", double_values[i], string_values[i], result);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    dtos_precision_to(result, double_values[i], 6);
+    if (strcmp(result, precision_values[i]) != 0) {
+      printf("[Failed] dtos_precision_to(%.17g, 6) failed: expected '%s', got '%s'\n", double_values[i], precision_values[i], result);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] dtos_to(%.17g) is '%s'.\n", double_values[i], string_values[i]);
+  }
+  // The output does not depend on the decimal separator of the locale.
+  const char *locales[] = {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "es_ES.UTF-8"};
+  const char *locale = NULL;
+  for (size_t i = 0; i < sizeof(locales) / sizeof(locales[0]) && locale == NULL; i++) {
+    locale = setlocale(LC_NUMERIC, locales[i]);
+  }
+  if (locale == NULL) {
+    printf("[Passed] dtos_precision_to() locale test skipped: no comma locale is installed.\n");
+  }
+  else {
+    char result[DTOS_BUFFER_SIZE];
+    dtos_precision_to(result, -1234.5678, 6);
+    if (strcmp(result, "-1234.57") != 0) {
+      printf("[Failed] dtos_precision_to(-1234.5678, 6) in %s failed: got '%s'\n", locale, result);
+      exit_status = EXIT_FAILURE;
+    }
+    else {
+      printf("[Passed] dtos_precision_to(-1234.5678, 6) in %s is '%s'.\n", locale, result);
+    }
+    setlocale(LC_NUMERIC, "C");
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_stoi64_unit_tests() {
+  // Define string and expected integer values used for testing.
+  const char *string_values[] = {"0", "-42", "+7", "12345678", "123456789012345678", "9223372036854775807", "-9223372036854775808", "9223372036854775808", "-9223372036854775809", "000000000000000000000001", "99999999999999999999", "12.5", "3e4,", "-", "x"};
+  int64_t integer_values[] = {0, -42, 7, 12345678, 123456789012345678LL, INT64_MAX, INT64_MIN, 0, 0, 1, 0, 12, 3, 0, 0};
+  size_t consumed_values[] = {1, 3, 2, 8, 18, 19, 20, 0, 0, 24, 0, 2, 1, 0, 0};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(string_values) / sizeof(string_values[0]);
+  // Show friendly message.
+  printf("------------------- stoi64(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    const char *string_value = string_values[i];
+    int64_t result = 0;
+    size_t consumed = stoi64(string_value, strlen(string_value), &result);
+    if (consumed != consumed_values[i] || (consumed != 0 && result != integer_values[i])) {
+      printf("[Failed]  stoi64(\"%s\") failed: expected %lld in %zu characters, got %lld in %zu.\n", string_value, (long long)integer_values[i], consumed_values[i], (long long)result, consumed);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed]  stoi64(\"%s\") is %lld.\n", string_value, (long long)result);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_numeric_batch_unit_tests() {
+  // Show friendly message.
+  printf("------------------- stoi64_batch(x) / stod_batch(x) -------------------\n");
+  int exit_status = EXIT_SUCCESS;
+  enum { count = 1000 };
+  int64_t integers[count];
+  double doubles[count];
+  for (int i = 0; i < count; i++) {
+    integers[i] = (int64_t)(i - count / 2) * 9876543210123LL;
+    doubles[i] = (i - count / 2) / 7.0;
+  }
+  integers[0] = INT64_MIN;
+  integers[1] = INT64_MAX;
+  // Pack the values and point views to each of them.
+  char *buffer = (char *)malloc(count * DTOS_BUFFER_SIZE);
+  size_t offsets[count + 1];
+  struct StringView views[count];
+  int64_t integer_results[count];
+  double double_results[count];
+  size_t length = i64tos_batch(buffer, integers, count, offsets);
+  for (int i = 0; i < count; i++) {
+    views[i].ptr = buffer + offsets[i];
+    views[i].len = offsets[i + 1] - offsets[i];
+  }
+  size_t converted = stoi64_batch(views, count, integer_results);
+  if (length != strlen(buffer) || offsets[count] != length || converted != count || memcmp(integers, integer_results, sizeof(integers)) != 0) {
+    printf("[Failed] %zu of %d integers round trip.\n", converted, count);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] %d integers round trip through %zu characters.\n", count, length);
+  }
+  length = dtos_batch(buffer, doubles, count, offsets);
+  for (int i = 0; i < count; i++) {
+    views[i].ptr = buffer + offsets[i];
+    views[i].len = offsets[i + 1] - offsets[i];
+  }
+  converted = stod_batch(views, count, double_results);
+  if (length != strlen(buffer) || converted != count || memcmp(doubles, double_results, sizeof(doubles)) != 0) {
+    printf("[Failed] %zu of %d doubles round trip.\n", converted, count);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] %d doubles round trip through %zu characters.\n", count, length);
+  }
+  // The first invalid view is reported.
+  struct StringView invalid[] = {{"12", 2}, {"1.5", 3}, {"7", 1}};
+  if (stoi64_batch(invalid, 3, integer_results) != 1 || stod_batch(invalid, 3, double_results) != 3) {
+    printf("[Failed] The invalid view was not reported.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] The invalid view was reported at index 1.\n");
+  }
+  free(buffer);
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_dtos_fixed_unit_tests() {
+  // Define double, precision and expected string values used for testing.
+  double double_values[] = {0.125, 2.5, 3.5, -0.0, 0.005, 1.005, -1234.5678, 5e-324, 1e20, 0.1, 1.7976931348623157e308, INFINITY, -INFINITY};
+  int precisions[] = {2, 0, 0, 3, 2, 2, 1, 4, 2, 20, 0, 2, 2};
+  const char *string_values[] = {"0.12", "2", "4", "-0.000", "0.01", "1.00", "-1234.6", "0.0000", "100000000000000000000.00", "0.10000000000000000555", "179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368", "inf", "-inf"};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(double_values) / sizeof(double_values[0]);
+  // Show friendly message.
+  printf("------------------- dtos_fixed_to(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  char result[DTOS_FIXED_BUFFER_SIZE];
+  for (int i = 0; i < num_tests; i++) {
+    size_t length = dtos_fixed_to(result, double_values[i], precisions[i]);
+    if (length != strlen(result) || strcmp(result, string_values[i]) != 0) {
+      printf("[Failed] dtos_fixed_to(%.17g, %d) failed: expected '%s', got '%s'\n", double_values[i], precisions[i], string_values[i], result);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] dtos_fixed_to(%.17g, %d) is '%.32s'.\n", double_values[i], precisions[i], result);
+  }
+  // Compare many values and precisions with the C library.
+  char expected[DTOS_FIXED_BUFFER_SIZE];
+  uint64_t state = 0x9e3779b97f4a7c15;
+  int mismatches = 0;
+  for (int i = 0; i < 100000; i++) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    double value = (double)(int64_t)(state >> 11) / (double)(1ULL << (state % 64));
+    value = i % 2 == 0 ? value : -value / 1e6;
+    int precision = i % (DTOS_FIXED_MAX_PRECISION + 1);
+    snprintf(expected, sizeof(expected), "%.*f", precision, value);
+    dtos_fixed_to(result, value, precision);
+    if (strcmp(result, expected) != 0 && mismatches++ < 5) {
+      printf("[Failed] dtos_fixed_to(%.17g, %d) failed: expected '%s', got '%s'\n", value, precision, expected, result);
+    }
+  }
+  if (mismatches > 0) {
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] dtos_fixed_to() matches printf(\"%%.*f\") for 100000 values.\n");
+  }
+  // Append fixed decimals to a tokenizer, the short ones fit in the inline buffer.
+  struct StringTokenizer *tokenizer = st_create_empty(1);
+  double values[] = {1.5, -0.25, 1e300};
+  int inline_kept = 1;
+  for (int i = 0; i < 3; i++) {
+    st_append_fixed(tokenizer, &values[i], 3);
+    st_append_char(tokenizer, ' ');
+    inline_kept &= i == 2 || tokenizer->ownership == ST_STRING_INLINE;
+  }
+  snprintf(expected, sizeof(expected), "1.500 -0.250 %.3f ", 1e300);
+  if (inline_kept == 0 || tokenizer->position != strlen(expected) || strncmp(tokenizer->string, expected, tokenizer->position) != 0) {
+    printf("[Failed] st_append_fixed() failed: expected '%s', got '%.*s'\n", expected, (int)tokenizer->position, tokenizer->string);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_append_fixed() appends %zu characters.\n", tokenizer->position);
+  }
+  st_destroy(tokenizer);
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
 /**
  * {@inheritdoc}
  */
@@ -148,6 +453,10 @@ int run_numeric_string_tests() {
   if (run_itos_unit_tests() == EXIT_FAILURE) {
     return EXIT_FAILURE;
   }
+  // Run i64tos_to(x) unit tests.
+  if (run_i64tos_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
   // Run ldtos(x) unit tests.
   if (run_ldtos_unit_tests() == EXIT_FAILURE) {
     return EXIT_FAILURE;
@@ -156,6 +465,26 @@ int run_numeric_string_tests() {
   if (run_stold_unit_tests() == EXIT_FAILURE) {
     return EXIT_FAILURE;
   }
+  // Run stod(x) unit tests.
+  if (run_stod_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run dtos_to(x) unit tests.
+  if (run_dtos_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run dtos_fixed_to(x) unit tests.
+  if (run_dtos_fixed_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run stoi64(x) unit tests.
+  if (run_stoi64_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run batch conversion unit tests.
+  if (run_numeric_batch_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
   // Return success status.
   return EXIT_SUCCESS;
 }
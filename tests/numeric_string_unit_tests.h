@@ -21,6 +21,17 @@ int run_numeric_string_tests();
  */
 int run_itos_unit_tests();
 
+/**
+ * Run unit tests for the i64tos_to() and u64tos_to() functions.
+ *
+ * This function tests the non-allocating conversions with a set of predefined
+ * integers, including the 64-bit limits and every digit count boundary.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_i64tos_unit_tests();
+
 /**
  * Run unit tests for the ldtos() function.
  *
@@ -45,4 +56,63 @@ int run_ldtos_unit_tests();
  */
 int run_stold_unit_tests();
 
+/**
+ * Run unit tests for the stod() function.
+ *
+ * This function tests the stod function with a set of predefined strings, including
+ * halfway and out of range values, and compares the output with the expected
+ * double values and number of converted characters.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_stod_unit_tests();
+
+/**
+ * Run unit tests for the dtos_to() and dtos_precision_to() functions.
+ *
+ * This function tests the shortest and the fixed precision conversions with a set
+ * of predefined doubles and compares the output with the expected strings.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_dtos_unit_tests();
+
+/**
+ * Run unit tests for the dtos_fixed_to() and st_append_fixed() functions.
+ *
+ * This function tests the fixed decimals conversion with halfway values, signed
+ * zeros, subnormals and huge doubles, and compares many random values with the
+ * output of printf("%.*f").
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_dtos_fixed_unit_tests();
+
+/**
+ * Run unit tests for the stoi64() function.
+ *
+ * This function tests the stoi64 function with a set of predefined strings,
+ * including the 64-bit limits, overflows and decimals, and compares the output
+ * with the expected integers and number of converted characters.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_stoi64_unit_tests();
+
+/**
+ * Run unit tests for the batch conversion functions.
+ *
+ * This function writes arrays of integers and doubles with i64tos_batch() and
+ * dtos_batch(), converts them back with stoi64_batch() and stod_batch(), and
+ * checks that every value round trips and that invalid views are reported.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_numeric_batch_unit_tests();
+
 #endif // NUMERIC_STRING_UNIT_TESTS_H
\ No newline at end of file
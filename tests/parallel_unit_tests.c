@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+#define PARALLEL_TEST_RECORDS 5000
+
+/**
+ * The result of a chunk of records.
+ */
+struct ParallelTestResult {
+  long first;
+  long last;
+  long count;
+};
+
+/**
+ * The merged results.
+ */
+struct ParallelTestTotal {
+  long next;
+  long count;
+  int ordered;
+};
+
+/**
+ * Reads the ids of the records of a chunk.
+ */
+static int parallel_test_process(void *context, struct StringTokenizer *tokenizer, void **result) {
+  struct ParallelTestResult *chunk = (struct ParallelTestResult *)malloc(sizeof(struct ParallelTestResult));
+  if (chunk == NULL) {
+    return 0;
+  }
+  chunk->first = -1;
+  chunk->last = -1;
+  chunk->count = 0;
+  *result = chunk;
+  while (st_current_token(tokenizer) == '{') {
+    double id;
+    if (st_find_key(tokenizer, "id") == 0 || st_extract_double_to(tokenizer, &id) == 0) {
+      return 0;
+    }
+    // Walk to the end of the record.
+    st_find_key(tokenizer, "none");
+    if (chunk->count++ == 0) {
+      chunk->first = (long)id;
+    }
+    chunk->last = (long)id;
+    st_next_token(tokenizer);
+  }
+  return tokenizer->position == tokenizer->length;
+}
+
+/**
+ * Merges the results, the ids must follow each other.
+ */
+static int parallel_test_merge(void *context, void *result) {
+  struct ParallelTestTotal *total = (struct ParallelTestTotal *)context;
+  struct ParallelTestResult *chunk = (struct ParallelTestResult *)result;
+  if (chunk == NULL || chunk->first != total->next) {
+    total->ordered = 0;
+  }
+  else {
+    total->next = chunk->last + 1;
+    total->count += chunk->count;
+  }
+  free(chunk);
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_parallel_lines_unit_tests() {
+  // Define the thread counts and the chunk sizes.
+  size_t thread_values[] = {1, 4, 0, 8};
+  size_t chunk_values[] = {64, 1000, 0, 1};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(thread_values) / sizeof(thread_values[0]);
+  // Show friendly message.
+  printf("------------------- st_parallel_lines(x) -------------------\n");
+  // Build the records.
+  size_t size = PARALLEL_TEST_RECORDS * 64;
+  char *string = (char *)malloc(size);
+  size_t length = 0;
+  for (int i = 0; i < PARALLEL_TEST_RECORDS; i++) {
+    length += snprintf(string + length, size - length, "{\"id\": %d, \"name\": \"record\\n%d\", \"tags\": [%d]}\n", i, i, i % 7);
+  }
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  struct StringParallelHandler handler = {parallel_test_process, parallel_test_merge};
+  for (int i = 0; i < num_tests; i++) {
+    struct ParallelTestTotal total = {0, 0, 1};
+    int processed = st_parallel_lines(string, length, thread_values[i], chunk_values[i], &handler, &total);
+    if (processed == 0 || total.ordered == 0 || total.count != PARALLEL_TEST_RECORDS) {
+      printf("[Failed] %zu threads and chunks of %zu failed: %ld records merged.\n", thread_values[i], chunk_values[i], total.count);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] %zu threads and chunks of %zu merged %ld records in order.\n", thread_values[i], chunk_values[i], total.count);
+  }
+  free(string);
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * Appends the record with the given index.
+ */
+static int parallel_test_serialize(void *context, struct StringTokenizer *tokenizer, size_t index) {
+  return st_append_string(tokenizer, "{\"id\":") && st_append_int(tokenizer, (int64_t)index) && st_append_char(tokenizer, '}');
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_parallel_serialize_unit_tests() {
+  // Define the item counts, the thread counts and the batch sizes.
+  size_t count_values[] = {PARALLEL_TEST_RECORDS, PARALLEL_TEST_RECORDS, PARALLEL_TEST_RECORDS, 1, 0};
+  size_t thread_values[] = {1, 4, 0, 8, 4};
+  size_t batch_values[] = {64, 1, 0, 16, 16};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(thread_values) / sizeof(thread_values[0]);
+  // Show friendly message.
+  printf("------------------- st_parallel_serialize(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    // Build the expected output serially.
+    struct StringTokenizer *expected = st_create_empty(1);
+    st_append_char(expected, '[');
+    for (size_t index = 0; index < count_values[i]; index++) {
+      if (index > 0) {
+        st_append_char(expected, ',');
+      }
+      parallel_test_serialize(NULL, expected, index);
+    }
+    st_append_char(expected, ']');
+    // Serialize in parallel and stitch the fragments.
+    struct StringFragments fragments;
+    struct StringTokenizer *output = st_create_empty(1);
+    st_append_char(output, '[');
+    char separator[] = ",";
+    int serialized = st_parallel_serialize(&fragments, count_values[i], thread_values[i], batch_values[i], parallel_test_serialize, NULL, separator);
+    // The fragments keep their own copy of the separator.
+    separator[0] = '#';
+    int stitched = serialized && st_fragments_stitch(&fragments, output) && st_append_char(output, ']');
+    // The iovec list covers the same characters.
+    size_t iov_length = 0;
+    for (size_t j = 0; serialized && j < fragments.iov_count; j++) {
+      iov_length += fragments.iov[j].iov_len;
+    }
+    if (stitched == 0 || strcmp(output->string, expected->string) != 0 || iov_length != fragments.length || fragments.length + 2 != expected->position) {
+      printf("[Failed] %zu items on %zu threads in batches of %zu failed.\n", count_values[i], thread_values[i], batch_values[i]);
+      exit_status = EXIT_FAILURE;
+    }
+    else {
+      // Print success message.
+      printf("[Passed] %zu items on %zu threads in batches of %zu match the serial output.\n", count_values[i], thread_values[i], batch_values[i]);
+    }
+    st_fragments_free(&fragments);
+    st_destroy(expected);
+    st_destroy(output);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_parallel_tests() {
+  // Run st_parallel_lines(x) unit tests.
+  if (run_st_parallel_lines_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_parallel_serialize(x) unit tests.
+  if (run_st_parallel_serialize_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Return success status.
+  return EXIT_SUCCESS;
+}
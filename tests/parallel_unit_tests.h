@@ -0,0 +1,36 @@
+#ifndef PARALLEL_UNIT_TESTS_H
+#define PARALLEL_UNIT_TESTS_H
+
+/**
+ * Runs all the unit tests for parallel functions.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_parallel_tests();
+
+/**
+ * Run unit tests for the st_parallel_lines() function.
+ *
+ * This function processes newline-delimited records with several thread counts
+ * and chunk sizes, and checks that every record was seen once and that the
+ * results were merged in order.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_parallel_lines_unit_tests();
+
+/**
+ * Run unit tests for the st_parallel_serialize() function.
+ *
+ * This function serializes records with several thread counts and batch
+ * sizes, and checks that the stitched buffer and the iovec list match the
+ * serial output.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_parallel_serialize_unit_tests();
+
+#endif // PARALLEL_UNIT_TESTS_H
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_arena_alloc_unit_tests() {
+  // Define the allocation sizes, the last ones do not fit in a block.
+  size_t size_values[] = {1, 3, 8, 17, 100, 1000, 5000, 20000};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(size_values) / sizeof(size_values[0]);
+  // Show friendly message.
+  printf("------------------- st_arena_alloc(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  struct StringArena *arena = st_arena_create(4096);
+  unsigned char *allocations[sizeof(size_values) / sizeof(size_values[0])];
+  for (int i = 0; i < num_tests; i++) {
+    allocations[i] = (unsigned char *)st_arena_alloc(arena, size_values[i]);
+    if (allocations[i] == NULL || (uintptr_t)allocations[i] % _Alignof(max_align_t) != 0) {
+      printf("[Failed] st_arena_alloc(%zu) failed: misaligned or NULL.\n", size_values[i]);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    memset(allocations[i], i + 1, size_values[i]);
+    // Print success message.
+    printf("[Passed] st_arena_alloc(%zu) is aligned.\n", size_values[i]);
+  }
+  // Every allocation must keep its own content.
+  for (int i = 0; i < num_tests && exit_status == EXIT_SUCCESS; i++) {
+    for (size_t j = 0; j < size_values[i]; j++) {
+      if (allocations[i][j] != i + 1) {
+        printf("[Failed] st_arena_alloc(%zu) failed: overlapping allocations.\n", size_values[i]);
+        exit_status = EXIT_FAILURE;
+        break;
+      }
+    }
+  }
+  // The reset keeps a single block and starts from the beginning.
+  st_arena_reset(arena);
+  void *first = st_arena_alloc(arena, 1);
+  st_arena_reset(arena);
+  if (arena->used != 0 || first == NULL || st_arena_alloc(arena, 1) != first) {
+    printf("[Failed] st_arena_reset() failed: the block was not reused.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_arena_reset() reuses the newest block.\n");
+  }
+  st_arena_destroy(arena);
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_attach_arena_unit_tests() {
+  // Show friendly message.
+  printf("------------------- st_attach_arena(x) -------------------\n");
+  int exit_status = EXIT_SUCCESS;
+  struct StringArena *arena = st_arena_acquire();
+  char string[] = "\"key\" -12.5 true";
+  struct StringTokenizer *tokenizer = st_create(string);
+  st_attach_arena(tokenizer, arena);
+  // Extract the values, they are released all together.
+  char *key = st_sub_string(tokenizer, '"', '"');
+  st_next_token(tokenizer);
+  double *number = st_extract_double(tokenizer);
+  st_next_token(tokenizer);
+  int *boolean = st_extract_boolean(tokenizer, "true", 1);
+  if (key == NULL || strcmp(key, "key") != 0 || number == NULL || *number != -12.5 || boolean == NULL || *boolean != 1) {
+    printf("[Failed] st_attach_arena() failed: wrong extracted values.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else if (arena->used == 0) {
+    printf("[Failed] st_attach_arena() failed: the values were not allocated from the arena.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_attach_arena() carves %zu bytes from the arena.\n", arena->used);
+  }
+  st_destroy(tokenizer);
+  // The released arena goes back to the thread pool.
+  st_arena_release(arena);
+  if (arena->used != 0 || st_arena_acquire() != arena) {
+    printf("[Failed] st_arena_release() failed: the arena was not pooled.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_arena_acquire() reuses the released arena.\n");
+  }
+  st_arena_release(arena);
+  st_arena_pool_clear();
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_string_arena_tests() {
+  // Run st_arena_alloc(x) unit tests.
+  if (run_st_arena_alloc_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_attach_arena(x) unit tests.
+  if (run_st_attach_arena_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Return success status.
+  return EXIT_SUCCESS;
+}
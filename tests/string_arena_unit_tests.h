@@ -0,0 +1,35 @@
+#ifndef STRING_ARENA_UNIT_TESTS_H
+#define STRING_ARENA_UNIT_TESTS_H
+
+/**
+ * Runs all the unit tests for string arena functions.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_string_arena_tests();
+
+/**
+ * Run unit tests for the st_arena_alloc() and st_arena_reset() functions.
+ *
+ * This function allocates a set of predefined sizes, checks the alignment and
+ * that the allocations do not overlap, then checks that a reset keeps a single
+ * block.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_arena_alloc_unit_tests();
+
+/**
+ * Run unit tests for a tokenizer with an attached arena.
+ *
+ * This function extracts strings and values with an arena taken from the
+ * thread pool and checks that they were carved from the arena.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_attach_arena_unit_tests();
+
+#endif // STRING_ARENA_UNIT_TESTS_H
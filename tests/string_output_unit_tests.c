@@ -0,0 +1,138 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../include/strutils.h"
+
+#define OUTPUT_TEST_RECORDS 2000
+
+/**
+ * Appends the records to the output and to the expected tokenizer.
+ */
+static int output_test_fill(struct StringOutput *output, struct StringTokenizer *expected) {
+  for (int i = 0; i < OUTPUT_TEST_RECORDS; i++) {
+    double value = i / 8.0;
+    if (st_output_append_string(output, "{\"id\":") == 0 || st_output_append_int(output, i) == 0 ||
+        st_output_append_n(output, ",\"value\":", 9) == 0 || st_output_append_double(output, value) == 0 ||
+        st_output_append_char(output, '}') == 0) {
+      return 0;
+    }
+    st_append_string(expected, "{\"id\":");
+    st_append_int(expected, i);
+    st_append_n(expected, ",\"value\":", 9);
+    st_append_double(expected, &value);
+    st_append_char(expected, '}');
+  }
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_output_flush_unit_tests() {
+  // Define the block sizes and the flush thresholds.
+  size_t block_values[] = {16, 64, 0, 4096};
+  size_t threshold_values[] = {0, 100, 1, 65536};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(block_values) / sizeof(block_values[0]);
+  // Show friendly message.
+  printf("------------------- st_output_flush(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    FILE *file = tmpfile();
+    struct StringOutput *output = file != NULL ? st_output_create(fileno(file), block_values[i], threshold_values[i]) : NULL;
+    struct StringTokenizer *expected = st_create_empty(1);
+    int flushed = output != NULL && output_test_fill(output, expected) && st_output_flush(output);
+    // Read the file back.
+    char *string = (char *)malloc(expected->position + 1);
+    size_t length = 0;
+    if (flushed) {
+      rewind(file);
+      length = fread(string, 1, expected->position + 1, file);
+    }
+    if (flushed == 0 || output->length != 0 || output->written != expected->position || length != expected->position || memcmp(string, expected->string, length) != 0) {
+      printf("[Failed] Blocks of %zu with a threshold of %zu failed.\n", block_values[i], threshold_values[i]);
+      exit_status = EXIT_FAILURE;
+    }
+    else {
+      // Print success message.
+      printf("[Passed] Blocks of %zu with a threshold of %zu wrote %zu characters.\n", block_values[i], threshold_values[i], length);
+    }
+    free(string);
+    st_destroy(expected);
+    st_output_destroy(output);
+    if (file != NULL) {
+      fclose(file);
+    }
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_output_iov_unit_tests() {
+  // Define the block sizes.
+  size_t block_values[] = {8, 100, 0};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(block_values) / sizeof(block_values[0]);
+  // Show friendly message.
+  printf("------------------- st_output_iov(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    struct StringOutput *output = st_output_create(-1, block_values[i], 1);
+    struct StringTokenizer *expected = st_create_empty(1);
+    struct StringTokenizer *actual = st_create_empty(1);
+    int filled = output_test_fill(output, expected);
+    // Collect the blocks in order, every block holds at least one character.
+    size_t count = output->length + 1;
+    struct iovec *iov = (struct iovec *)malloc(count * sizeof(struct iovec));
+    size_t entries = st_output_iov(output, iov, count);
+    for (size_t j = 0; j < entries; j++) {
+      st_append_n(actual, (const char *)iov[j].iov_base, iov[j].iov_len);
+    }
+    // An output without file descriptor can not be flushed.
+    int flushed = st_output_flush(output);
+    if (filled == 0 || flushed != 0 || actual->position != output->length || strcmp(actual->string, expected->string) != 0) {
+      printf("[Failed] Blocks of %zu listed %zu entries.\n", block_values[i], entries);
+      exit_status = EXIT_FAILURE;
+    }
+    else {
+      // Print success message.
+      printf("[Passed] Blocks of %zu listed %zu entries in order.\n", block_values[i], entries);
+    }
+    // The discarded output is empty.
+    st_output_reset(output);
+    if (output->length != 0 || st_output_iov(output, iov, count) != 0 || st_output_flush(output) == 0) {
+      printf("[Failed] Blocks of %zu were not discarded.\n", block_values[i]);
+      exit_status = EXIT_FAILURE;
+    }
+    free(iov);
+    st_destroy(expected);
+    st_destroy(actual);
+    st_output_destroy(output);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_string_output_tests() {
+  // Run st_output_flush(x) unit tests.
+  if (run_st_output_flush_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_output_iov(x) unit tests.
+  if (run_st_output_iov_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Return success status.
+  return EXIT_SUCCESS;
+}
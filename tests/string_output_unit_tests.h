@@ -0,0 +1,35 @@
+#ifndef STRING_OUTPUT_UNIT_TESTS_H
+#define STRING_OUTPUT_UNIT_TESTS_H
+
+/**
+ * Runs all the unit tests for chained output functions.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_string_output_tests();
+
+/**
+ * Run unit tests for the st_output_flush() function.
+ *
+ * This function appends a set of predefined values with several block sizes
+ * and flush thresholds, writes them to a temporary file and checks that the
+ * file matches the tokenizer output.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_output_flush_unit_tests();
+
+/**
+ * Run unit tests for the st_output_iov() function.
+ *
+ * This function keeps the output in memory and checks that the iovec list
+ * covers the appended characters in order.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_output_iov_unit_tests();
+
+#endif // STRING_OUTPUT_UNIT_TESTS_H
@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+#define SCAN_TEST_BUFFER_SIZE 200
+
+/**
+ * Helper function to check every scan function at every offset of the buffer.
+ *
+ * @param char *buffer
+ *   The buffer to scan, of SCAN_TEST_BUFFER_SIZE bytes.
+ *
+ * @return int
+ *   Returns 1 if every scan found the expected index, otherwise 0.
+ */
+static int check_scan_offsets(char *buffer) {
+  for (size_t length = 0; length <= SCAN_TEST_BUFFER_SIZE; length += 7) {
+    for (size_t target = 0; target < length; target++) {
+      // Whitespace everywhere, except the target character.
+      memset(buffer, ' ', SCAN_TEST_BUFFER_SIZE);
+      buffer[target] = '"';
+      if (st_scan_delimiter(buffer, length, '"') != target || st_scan_non_whitespace(buffer, length) != target) {
+        return 0;
+      }
+      buffer[target] = '\0';
+      if (st_scan_delimiter(buffer, length, '"') != target || st_scan_nul(buffer, length) != target) {
+        return 0;
+      }
+      buffer[target] = '\\';
+      if (st_scan_escape(buffer, length) != target) {
+        return 0;
+      }
+      buffer[target] = '\x1F';
+      if (st_scan_escape(buffer, length) != target) {
+        return 0;
+      }
+      // Bytes over 127 are not whitespace and don't need escaping.
+      buffer[target] = (char)0xC3;
+      if (st_scan_non_whitespace(buffer, length) != target || st_scan_delimiter(buffer, length, '"') != length || st_scan_escape(buffer, length) != length) {
+        return 0;
+      }
+    }
+    // Nothing to find.
+    memset(buffer, '\n', SCAN_TEST_BUFFER_SIZE);
+    if (st_scan_non_whitespace(buffer, length) != length || st_scan_nul(buffer, length) != length) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_scan_kernels_unit_tests() {
+  // Define the instruction sets to test.
+  enum StringScanIsa isa_values[] = {ST_SCAN_SCALAR, ST_SCAN_SSE2, ST_SCAN_AVX2, ST_SCAN_AVX512};
+  const char *isa_names[] = {"scalar", "SSE2", "AVX2", "AVX-512"};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(isa_values) / sizeof(isa_values[0]);
+  // Show friendly message.
+  printf("------------------- st_scan_*(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  enum StringScanIsa original_isa = st_scan_isa();
+  char buffer[SCAN_TEST_BUFFER_SIZE];
+  for (int i = 0; i < num_tests; i++) {
+    if (st_scan_set_isa(isa_values[i]) == 0) {
+      printf("[Skipped] %s kernels are not supported by this CPU.\n", isa_names[i]);
+      continue;
+    }
+    if (check_scan_offsets(buffer) == 0) {
+      printf("[Failed] %s kernels failed: wrong index found.\n", isa_names[i]);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] %s kernels found every character.\n", isa_names[i]);
+  }
+  st_scan_set_isa(original_isa);
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_next_token_unit_tests() {
+  // Define strings and the expected tokens after each move.
+  const char *string_values[] = {"{ \"a\"", "[\n\t  1,2]", "x     ", "ab"};
+  const char *expected_values[] = {"{\"a\"", "[1,2]", "x", "ab"};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(string_values) / sizeof(string_values[0]);
+  // Show friendly message.
+  printf("------------------- st_next_token(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    char string[64];
+    strcpy(string, string_values[i]);
+    struct StringTokenizer *tokenizer = st_create(string);
+    char tokens[64];
+    size_t count = 0;
+    while (st_current_token(tokenizer) != '\0') {
+      tokens[count++] = st_current_token(tokenizer);
+      st_next_token(tokenizer);
+    }
+    tokens[count] = '\0';
+    if (strcmp(tokens, expected_values[i]) != 0 || tokenizer->position != tokenizer->length) {
+      printf("[Failed] st_next_token() failed: expected '%s', got '%s'.\n", expected_values[i], tokens);
+      st_destroy(tokenizer);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] st_next_token() visited '%s'.\n", tokens);
+    st_destroy(tokenizer);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_string_scan_tests() {
+  // Run st_scan_*(x) unit tests.
+  if (run_st_scan_kernels_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_next_token(x) unit tests.
+  if (run_st_next_token_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Return success status.
+  return EXIT_SUCCESS;
+}
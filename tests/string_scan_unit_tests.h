@@ -0,0 +1,35 @@
+#ifndef STRING_SCAN_UNIT_TESTS_H
+#define STRING_SCAN_UNIT_TESTS_H
+
+/**
+ * Runs all the unit tests for string scan functions.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_string_scan_tests();
+
+/**
+ * Run unit tests for the scan kernels of every supported instruction set.
+ *
+ * This function places delimiters, null and non-whitespace characters at every
+ * offset of buffers of different lengths and checks that each kernel finds them
+ * at the same index as the scalar kernel.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_scan_kernels_unit_tests();
+
+/**
+ * Run unit tests for the st_next_token() function.
+ *
+ * This function moves the cursor over a set of predefined strings and compares
+ * the current token with the expected characters.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_next_token_unit_tests();
+
+#endif // STRING_SCAN_UNIT_TESTS_H
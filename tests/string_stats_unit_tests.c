@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_attach_stats_unit_tests() {
+  // Show friendly message.
+  printf("------------------- st_attach_stats(x) -------------------\n");
+  int exit_status = EXIT_SUCCESS;
+  struct StringStats stats;
+  memset(&stats, 0, sizeof(stats));
+  // Extract two strings and a number.
+  char string[] = "\"abc\" \"de\" 12.5";
+  struct StringTokenizer *tokenizer = st_create(string);
+  st_attach_stats(tokenizer, &stats);
+  char *first = st_sub_string(tokenizer, '"', '"');
+  st_next_token(tokenizer);
+  char *second = st_sub_string(tokenizer, '"', '"');
+  st_next_token(tokenizer);
+  double value = 0;
+  st_extract_double_to(tokenizer, &value);
+  free(first);
+  free(second);
+  st_destroy(tokenizer);
+  // Extract two integers, the fraction is rejected and not counted.
+  char integers[] = "12.0 7 12.5";
+  int64_t integer_values[3] = {0, 0, 0};
+  tokenizer = st_create(integers);
+  st_attach_stats(tokenizer, &stats);
+  int rejected = 0;
+  for (int i = 0; i < 3; i++) {
+    rejected += st_extract_int64(tokenizer, &integer_values[i]) == 0;
+    st_next_token(tokenizer);
+  }
+  st_destroy(tokenizer);
+  // Grow an empty tokenizer past its inline buffer.
+  struct StringTokenizer *builder = st_create_empty(1);
+  st_attach_stats(builder, &stats);
+  for (int i = 0; i < 1000; i++) {
+    st_append_int(builder, i);
+  }
+  st_destroy(builder);
+  if (st_stats_available() == 0) {
+    // The counters are compiled out.
+    struct StringStats zero;
+    memset(&zero, 0, sizeof(zero));
+    if (memcmp(&stats, &zero, sizeof(stats)) != 0) {
+      printf("[Failed] The counters changed while compiled out.\n");
+      exit_status = EXIT_FAILURE;
+    }
+    else {
+      printf("[Passed] The counters stay at zero without LIBSTR_ENABLE_STATS.\n");
+    }
+    printf("\n");
+    return exit_status;
+  }
+  // Check the counters.
+  if (stats.tokens_extracted != 5 || stats.allocations != 3 || stats.conversions != 1003 || value != 12.5 || rejected != 1) {
+    printf("[Failed] %llu tokens, %llu allocations and %llu conversions counted.\n", (unsigned long long)stats.tokens_extracted, (unsigned long long)stats.allocations, (unsigned long long)stats.conversions);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] 5 tokens, 3 allocations and 1003 conversions counted.\n");
+  }
+  if (stats.bytes_scanned < strlen(string) - 1 || stats.expansions == 0 || stats.reallocations + 1 < stats.expansions || stats.bytes_copied < ST_INLINE_BUFFER_SIZE) {
+    printf("[Failed] %llu bytes scanned and %llu expansions counted.\n", (unsigned long long)stats.bytes_scanned, (unsigned long long)stats.expansions);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] %llu bytes scanned and %llu expansions counted.\n", (unsigned long long)stats.bytes_scanned, (unsigned long long)stats.expansions);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_stats_snapshot_unit_tests() {
+  // Show friendly message.
+  printf("------------------- st_stats_snapshot(x) -------------------\n");
+  int exit_status = EXIT_SUCCESS;
+  struct StringStats enabled;
+  struct StringStats disabled;
+  // Convert numbers with the global counters enabled.
+  st_stats_reset();
+  st_stats_enable(1);
+  free(itos(42));
+  free(ldtos(1.5L));
+  stold("2.5");
+  st_stats_snapshot(&enabled);
+  // The counters do not move once disabled.
+  st_stats_enable(0);
+  free(itos(43));
+  st_stats_snapshot(&disabled);
+  st_stats_reset();
+  uint64_t expected = st_stats_available() ? 3 : 0;
+  if (enabled.conversions != expected || enabled.allocations != (expected ? 2 : 0) || memcmp(&enabled, &disabled, sizeof(enabled)) != 0) {
+    printf("[Failed] %llu conversions and %llu allocations counted.\n", (unsigned long long)enabled.conversions, (unsigned long long)enabled.allocations);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] %llu conversions and %llu allocations counted.\n", (unsigned long long)enabled.conversions, (unsigned long long)enabled.allocations);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_string_stats_tests() {
+  // Run st_attach_stats(x) unit tests.
+  if (run_st_attach_stats_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_stats_snapshot(x) unit tests.
+  if (run_st_stats_snapshot_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Return success status.
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,35 @@
+#ifndef STRING_STATS_UNIT_TESTS_H
+#define STRING_STATS_UNIT_TESTS_H
+
+/**
+ * Runs all the unit tests for instrumentation functions.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_string_stats_tests();
+
+/**
+ * Run unit tests for the st_attach_stats() function.
+ *
+ * This function extracts tokens and appends values with counters attached to
+ * the tokenizer and checks the collected counters, or checks that they stay
+ * at zero when the instrumentation was not compiled in.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_attach_stats_unit_tests();
+
+/**
+ * Run unit tests for the st_stats_snapshot() function.
+ *
+ * This function converts numbers with the global counters enabled and
+ * disabled, and checks the snapshots.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_stats_snapshot_unit_tests();
+
+#endif // STRING_STATS_UNIT_TESTS_H
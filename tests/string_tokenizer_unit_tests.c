@@ -0,0 +1,533 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../include/strutils.h"
+
+#define TOKENIZER_TEST_APPENDS 10000
+#define TOKENIZER_TEST_DOCUMENT "  {\"name\" : \"streaming tokenizer\", \"values\": [12345, -6.5e2, 0.125],\n \"ok\": true, \"end\": \"\"}"
+#define TOKENIZER_TEST_SIGNATURE "name|streaming tokenizer|values|12345|-650|0.125|ok|true|end||"
+
+/**
+ * Memory source used to feed the streaming tokenizer from a callback.
+ */
+struct TokenizerTestSource {
+  const char *data;
+  size_t length;
+  size_t offset;
+};
+
+/**
+ * Reads the next characters of a memory source.
+ */
+static ssize_t tokenizer_test_read(void *context, char *buffer, size_t size) {
+  struct TokenizerTestSource *source = (struct TokenizerTestSource *)context;
+  size_t count = source->length - source->offset;
+  if (count > size) {
+    count = size;
+  }
+  memcpy(buffer, source->data + source->offset, count);
+  source->offset += count;
+  return count;
+}
+
+/**
+ * Walks a tokenizer and writes the strings, numbers and booleans found.
+ */
+static void tokenizer_test_walk(struct StringTokenizer *tokenizer, char *signature, const size_t size) {
+  size_t length = 0;
+  char token;
+  signature[0] = '\0';
+  while ((token = st_current_token(tokenizer)) != '\0' && length < size) {
+    struct StringView view;
+    double value;
+    if (token == '"' && st_sub_string_view(tokenizer, '"', '"', &view) == 1) {
+      length += snprintf(signature + length, size - length, "%.*s|", (int)view.len, view.ptr);
+    }
+    else if (st_extract_double_to(tokenizer, &value) == 1) {
+      length += snprintf(signature + length, size - length, "%g|", value);
+    }
+    else if (st_starts_with(tokenizer, "true") == 1) {
+      length += snprintf(signature + length, size - length, "true|");
+      continue;
+    }
+    st_next_token(tokenizer);
+  }
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_expand_string_unit_tests() {
+  // Define the policies and the maximum number of expansions expected.
+  enum StringGrowthPolicy policy_values[] = {ST_GROWTH_GEOMETRIC, ST_GROWTH_LINEAR, ST_GROWTH_GEOMETRIC};
+  size_t max_increment_values[] = {0, 0, 4096};
+  size_t max_expansions[] = {16, TOKENIZER_TEST_APPENDS, 32};
+  const char *policy_names[] = {"geometric", "linear", "geometric capped"};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(policy_values) / sizeof(policy_values[0]);
+  // Show friendly message.
+  printf("------------------- st_expand_string(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    struct StringTokenizer *tokenizer = st_create_empty(16);
+    st_set_growth_policy(tokenizer, policy_values[i], max_increment_values[i]);
+    tokenizer->position = 0;
+    size_t expansions = 0;
+    for (int j = 0; j < TOKENIZER_TEST_APPENDS; j++) {
+      size_t length = tokenizer->length;
+      st_append_string(tokenizer, "abc");
+      expansions += length != tokenizer->length;
+    }
+    if (expansions > max_expansions[i] || tokenizer->position != 3 * TOKENIZER_TEST_APPENDS) {
+      printf("[Failed] %s growth failed: %zu expansions.\n", policy_names[i], expansions);
+      exit_status = EXIT_FAILURE;
+    }
+    else if (st_shrink_to_fit(tokenizer) == 0 || tokenizer->length != tokenizer->position + 1 || strncmp(tokenizer->string + tokenizer->position - 6, "abcabc", 7) != 0) {
+      printf("[Failed] %s growth failed: st_shrink_to_fit() lost the content.\n", policy_names[i]);
+      exit_status = EXIT_FAILURE;
+    }
+    else if (st_reserve(tokenizer, 1 << 20) == 0 || tokenizer->length != 1 << 20 || st_append_string(tokenizer, "d") == 0 || tokenizer->length != 1 << 20) {
+      printf("[Failed] %s growth failed: st_reserve() did not keep the length.\n", policy_names[i]);
+      exit_status = EXIT_FAILURE;
+    }
+    else {
+      // Print success message.
+      printf("[Passed] %s growth used %zu expansions.\n", policy_names[i], expansions);
+    }
+    st_destroy(tokenizer);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_append_unit_tests() {
+  // Show friendly message.
+  printf("------------------- st_append_*(x) -------------------\n");
+  int exit_status = EXIT_SUCCESS;
+  struct StringTokenizer *tokenizer = st_create_empty(4);
+  tokenizer->position = 0;
+  // Build a small JSON object with every append function.
+  double value = 1.5;
+  struct StringView fragments[] = {{"\"b\"", 3}, {":", 1}, {"[1,2]", 5}};
+  int appended = st_append_char(tokenizer, '{')
+    && st_append_quoted_string(tokenizer, "a")
+    && st_append_n(tokenizer, ":xyz", 1)
+    && st_append_double(tokenizer, &value)
+    && st_append_char(tokenizer, ',')
+    && st_append_many(tokenizer, fragments, 3)
+    && st_append_string(tokenizer, ",\"c\":")
+    && st_append_int(tokenizer, -42)
+    && st_append_char(tokenizer, '}');
+  const char *expected = "{\"a\":1.5,\"b\":[1,2],\"c\":-42}";
+  if (appended == 0 || strcmp(tokenizer->string, expected) != 0 || tokenizer->position != strlen(expected)) {
+    printf("[Failed] st_append_*() failed: expected '%s', got '%s'.\n", expected, tokenizer->string);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    // Print success message.
+    printf("[Passed] st_append_*() built '%s'.\n", tokenizer->string);
+  }
+  st_destroy(tokenizer);
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_append_escaped_string_unit_tests() {
+  // Define strings and the expected JSON strings.
+  const char *string_values[] = {"", "plain text", "say \"hi\"", "C:\\dir\\", "line\nbreak\ttab", "\x01\x1F", "a long run of clean characters before the \"quote\" and after it"};
+  const char *expected_values[] = {"\"\"", "\"plain text\"", "\"say \\\"hi\\\"\"", "\"C:\\\\dir\\\\\"", "\"line\\nbreak\\ttab\"", "\"\\u0001\\u001f\"", "\"a long run of clean characters before the \\\"quote\\\" and after it\""};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(string_values) / sizeof(string_values[0]);
+  // Show friendly message.
+  printf("------------------- st_append_escaped_string(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    struct StringTokenizer *tokenizer = st_create_empty(2);
+    tokenizer->position = 0;
+    if (st_append_escaped_string(tokenizer, string_values[i]) == 0 || strcmp(tokenizer->string, expected_values[i]) != 0) {
+      printf("[Failed] st_append_escaped_string() failed: expected '%s', got '%s'.\n", expected_values[i], tokenizer->string);
+      exit_status = EXIT_FAILURE;
+    }
+    else {
+      // Print success message.
+      printf("[Passed] st_append_escaped_string() is '%s'.\n", tokenizer->string);
+    }
+    st_destroy(tokenizer);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_stream_unit_tests() {
+  // Define the chunk sizes, the smallest ones split every token.
+  size_t chunk_sizes[] = {1, 3, 7, 4096};
+  const char *source_names[] = {"callback", "FILE*", "fd"};
+  // Calculate the number of values to test.
+  int num_chunks = sizeof(chunk_sizes) / sizeof(chunk_sizes[0]);
+  int num_sources = sizeof(source_names) / sizeof(source_names[0]);
+  // Show friendly message.
+  printf("------------------- st_create_from_*(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_chunks; i++) {
+    for (int j = 0; j < num_sources; j++) {
+      struct TokenizerTestSource source = {TOKENIZER_TEST_DOCUMENT, strlen(TOKENIZER_TEST_DOCUMENT), 0};
+      struct StringTokenizer *tokenizer = NULL;
+      FILE *file = NULL;
+      int fds[2] = {-1, -1};
+      if (j == 0) {
+        tokenizer = st_create_from_callback(tokenizer_test_read, &source, chunk_sizes[i]);
+      }
+      else if (j == 1 && (file = tmpfile()) != NULL) {
+        fputs(TOKENIZER_TEST_DOCUMENT, file);
+        rewind(file);
+        tokenizer = st_create_from_file(file, chunk_sizes[i]);
+      }
+      else if (j == 2 && pipe(fds) == 0) {
+        ssize_t written = write(fds[1], source.data, source.length);
+        close(fds[1]);
+        tokenizer = written == (ssize_t)source.length ? st_create_from_fd(fds[0], chunk_sizes[i]) : NULL;
+      }
+      char signature[256] = "";
+      if (tokenizer != NULL) {
+        tokenizer_test_walk(tokenizer, signature, sizeof(signature));
+      }
+      // The window must stay bounded by the chunk size and the longest token.
+      if (tokenizer == NULL || strcmp(signature, TOKENIZER_TEST_SIGNATURE) != 0 || tokenizer->stream->capacity > chunk_sizes[i] + 64) {
+        printf("[Failed] %s stream with chunks of %zu failed: got '%s'.\n", source_names[j], chunk_sizes[i], signature);
+        exit_status = EXIT_FAILURE;
+      }
+      else {
+        // Print success message.
+        printf("[Passed] %s stream with chunks of %zu.\n", source_names[j], chunk_sizes[i]);
+      }
+      st_destroy(tokenizer);
+      if (file != NULL) {
+        fclose(file);
+      }
+      if (fds[0] >= 0) {
+        close(fds[0]);
+      }
+    }
+  }
+  // The in-memory tokenizer must find the same tokens.
+  char string[] = TOKENIZER_TEST_DOCUMENT;
+  struct StringTokenizer *tokenizer = st_create(string);
+  char signature[256];
+  tokenizer_test_walk(tokenizer, signature, sizeof(signature));
+  if (strcmp(signature, TOKENIZER_TEST_SIGNATURE) != 0) {
+    printf("[Failed] in-memory tokenizer failed: got '%s'.\n", signature);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] in-memory tokenizer finds the same tokens.\n");
+  }
+  st_destroy(tokenizer);
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_create_from_mmap_unit_tests() {
+  // Show friendly message.
+  printf("------------------- st_create_from_mmap(x) -------------------\n");
+  // Write the document padded to a whole page, so reading past the end faults.
+  char path[] = "/tmp/libstr_mmap_XXXXXX";
+  int fd = mkstemp(path);
+  if (fd < 0) {
+    printf("[Failed] st_create_from_mmap() failed: could not create a temporary file.\n");
+    return EXIT_FAILURE;
+  }
+  size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  char *document = (char *)malloc(page_size);
+  memset(document, ' ', page_size);
+  memcpy(document, TOKENIZER_TEST_DOCUMENT, strlen(TOKENIZER_TEST_DOCUMENT));
+  memcpy(document + page_size - 3, "125", 3);
+  ssize_t written = write(fd, document, page_size);
+  close(fd);
+  free(document);
+  // Walk the mapped file.
+  int exit_status = EXIT_SUCCESS;
+  struct StringTokenizer *tokenizer = written == (ssize_t)page_size ? st_create_from_mmap(path) : NULL;
+  char signature[256] = "";
+  if (tokenizer != NULL) {
+    tokenizer_test_walk(tokenizer, signature, sizeof(signature));
+  }
+  if (tokenizer == NULL || tokenizer->length != page_size || strcmp(signature, TOKENIZER_TEST_SIGNATURE "125|") != 0) {
+    printf("[Failed] st_create_from_mmap() failed: got '%s'.\n", signature);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_create_from_mmap() tokenizes %zu bytes in place.\n", tokenizer->length);
+  }
+  // The mapping is read-only, it can not be resized or appended to.
+  if (tokenizer != NULL) {
+    st_reset(tokenizer);
+    if (st_shrink_to_fit(tokenizer) != 0 || st_reserve(tokenizer, page_size * 2) != 0 || st_append_string(tokenizer, "x") != 0) {
+      printf("[Failed] st_shrink_to_fit() and st_append_string() resized the mapped string.\n");
+      exit_status = EXIT_FAILURE;
+    }
+    else {
+      printf("[Passed] st_shrink_to_fit() and st_append_string() refuse the mapped string.\n");
+    }
+  }
+  st_destroy(tokenizer);
+  unlink(path);
+  // Missing and empty files can not be mapped.
+  if (st_create_from_mmap(path) != NULL || st_create_from_mmap("/dev/null") != NULL) {
+    printf("[Failed] st_create_from_mmap() failed: mapped a missing or empty file.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_create_from_mmap() rejects missing and empty files.\n");
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_pool_unit_tests() {
+  // Show friendly message.
+  printf("------------------- st_pool_acquire(x) -------------------\n");
+  int exit_status = EXIT_SUCCESS;
+  // Grow a pooled tokenizer, the next user gets the same buffer back empty.
+  struct StringTokenizer *tokenizer = st_pool_acquire(16);
+  for (int i = 0; i < TOKENIZER_TEST_APPENDS; i++) {
+    st_append_string(tokenizer, "abc");
+  }
+  size_t length = tokenizer->length;
+  st_pool_release(tokenizer);
+  struct StringTokenizer *reused = st_pool_acquire(16);
+  if (reused != tokenizer || reused->length != length || reused->position != 0 || reused->string[0] != '\0') {
+    printf("[Failed] st_pool_acquire() failed: the grown tokenizer was not reused.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_pool_acquire() reuses a buffer of %zu bytes.\n", length);
+  }
+  // The detached string outlives the tokenizer.
+  st_append_string(reused, "kept");
+  char *string = st_detach_string(reused);
+  // The tokenizer starts over empty, appending does not touch the detached string.
+  int empty = reused->position == 0 && reused->string != string;
+  for (int i = 0; i < TOKENIZER_TEST_APPENDS; i++) {
+    st_append_string(reused, "more");
+  }
+  st_pool_release(reused);
+  if (string == NULL || empty == 0 || strcmp(string, "kept") != 0) {
+    printf("[Failed] st_detach_string() failed: got '%s'.\n", string);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_detach_string() keeps '%s'.\n", string);
+  }
+  free(string);
+  st_pool_clear();
+  // Rebind a reader to the next input.
+  char first[] = "\"first\"";
+  char second[] = "\"second\" and more";
+  tokenizer = st_create(first);
+  struct StringView view;
+  st_sub_string_view(tokenizer, '"', '"', &view);
+  if (st_rebind(tokenizer, second, 8) == 0 || st_sub_string_view(tokenizer, '"', '"', &view) == 0 || sv_equals(&view, "second") == 0 || tokenizer->position != 7) {
+    printf("[Failed] st_rebind() failed: the new string was not tokenized.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_rebind() tokenizes the new string.\n");
+  }
+  st_destroy(tokenizer);
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_inline_buffer_unit_tests() {
+  // Define the number of appended fragments, the inline buffer holds 63 of them.
+  int append_values[] = {1, 63, 64, 200};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(append_values) / sizeof(append_values[0]);
+  // Show friendly message.
+  printf("------------------- st_create_empty(x) inline buffer -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    struct StringTokenizer *tokenizer = st_create_empty(32);
+    for (int j = 0; j < append_values[i]; j++) {
+      st_append_string(tokenizer, "abcd");
+    }
+    int is_inline = tokenizer->string == tokenizer->inline_buffer;
+    size_t length = 4 * append_values[i];
+    int valid = strlen(tokenizer->string) == length && strncmp(tokenizer->string + length - 4, "abcd", 4) == 0;
+    if (valid == 0 || is_inline != (length < ST_INLINE_BUFFER_SIZE)) {
+      printf("[Failed] %zu characters failed: inline is %d.\n", length, is_inline);
+      exit_status = EXIT_FAILURE;
+    }
+    else {
+      // Print success message.
+      printf("[Passed] %zu characters are %s.\n", length, is_inline ? "inline" : "on the heap");
+    }
+    st_destroy(tokenizer);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_extract_int64_unit_tests() {
+  // Define the strings, the expected integers and the token the cursor ends on.
+  const char *string_values[] = {"42,", "-9223372036854775808]", "1234567890123456789 x", "00000000000000000007}", "12.0,", "-1e3 ", "12.5,", "9223372036854775808,", "1e19,", "abc", "-x"};
+  int extracted_values[] = {1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+  int64_t integer_values[] = {42, INT64_MIN, 1234567890123456789LL, 7, 12, -1000, 0, 0, 0, 0, 0};
+  char token_values[] = {',', ']', 'x', '}', ',', '\0', '1', '9', '1', 'a', '-'};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(string_values) / sizeof(string_values[0]);
+  // Show friendly message.
+  printf("------------------- st_extract_int64(x) -------------------\n");
+  // Test the values in memory and streamed 3 characters at a time.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    for (int streamed = 0; streamed < 2; streamed++) {
+      char string[64];
+      snprintf(string, sizeof(string), "%s", string_values[i]);
+      struct TokenizerTestSource source = {string_values[i], strlen(string_values[i]), 0};
+      struct StringTokenizer *tokenizer = streamed ? st_create_from_callback(tokenizer_test_read, &source, 3) : st_create(string);
+      int64_t value = 0;
+      int extracted = st_extract_int64(tokenizer, &value);
+      if (extracted) {
+        st_next_token(tokenizer);
+      }
+      char token = st_current_token(tokenizer);
+      if (extracted != extracted_values[i] || (extracted && value != integer_values[i]) || token != token_values[i]) {
+        printf("[Failed] st_extract_int64(\"%s\") %s failed: got %lld, returned %d, cursor on '%c'.\n", string_values[i], streamed ? "streamed" : "in memory", (long long)value, extracted, token);
+        exit_status = EXIT_FAILURE;
+      }
+      else {
+        // Print success message.
+        printf("[Passed] st_extract_int64(\"%s\") %s.\n", string_values[i], streamed ? "streamed" : "in memory");
+      }
+      st_destroy(tokenizer);
+    }
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_extract_until_view_unit_tests() {
+  // Define the strings, the expected substrings and the token the cursor ends on.
+  const char *string_values[] = {"key=value", "a b;c", "no delimiter", ";x", "\n"};
+  int extracted_values[] = {1, 1, 1, 0, 0};
+  const char *view_values[] = {"key", "a b", "no delimiter", "", ""};
+  char token_values[] = {'=', ';', '\0', ';', '\n'};
+  // The delimiters are '=', ';' and the control characters.
+  struct StringCharClass delimiters;
+  st_char_class_init(&delimiters, ST_CLASS_ESCAPE, "=;");
+  // Calculate the number of values to test.
+  int num_tests = sizeof(string_values) / sizeof(string_values[0]);
+  // Show friendly message.
+  printf("------------------- st_extract_until_view(x) -------------------\n");
+  // Test the values in memory and streamed 3 characters at a time.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    for (int streamed = 0; streamed < 2; streamed++) {
+      char string[64];
+      snprintf(string, sizeof(string), "%s", string_values[i]);
+      struct TokenizerTestSource source = {string_values[i], strlen(string_values[i]), 0};
+      struct StringTokenizer *tokenizer = streamed ? st_create_from_callback(tokenizer_test_read, &source, 3) : st_create(string);
+      struct StringView view = {NULL, 0};
+      int extracted = st_extract_until_view(tokenizer, &delimiters, &view);
+      int matches = extracted == 0 || (view.len == strlen(view_values[i]) && memcmp(view.ptr, view_values[i], view.len) == 0);
+      if (extracted) {
+        st_next_token(tokenizer);
+      }
+      char token = st_current_token(tokenizer);
+      if (extracted != extracted_values[i] || matches == 0 || token != token_values[i]) {
+        printf("[Failed] st_extract_until_view(\"%s\") %s failed: returned %d, cursor on '%c'.\n", string_values[i], streamed ? "streamed" : "in memory", extracted, token);
+        exit_status = EXIT_FAILURE;
+      }
+      else {
+        // Print success message.
+        printf("[Passed] st_extract_until_view(\"%s\") %s.\n", string_values[i], streamed ? "streamed" : "in memory");
+      }
+      st_destroy(tokenizer);
+    }
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_string_tokenizer_tests() {
+  // Run st_expand_string(x) unit tests.
+  if (run_st_expand_string_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_append_*(x) unit tests.
+  if (run_st_append_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_append_escaped_string(x) unit tests.
+  if (run_st_append_escaped_string_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_extract_int64(x) unit tests.
+  if (run_st_extract_int64_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_extract_until_view(x) unit tests.
+  if (run_st_extract_until_view_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_create_from_*(x) unit tests.
+  if (run_st_stream_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_create_from_mmap(x) unit tests.
+  if (run_st_create_from_mmap_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_pool_acquire(x) unit tests.
+  if (run_st_pool_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_create_empty(x) inline buffer unit tests.
+  if (run_st_inline_buffer_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Return success status.
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+#ifndef STRING_TOKENIZER_UNIT_TESTS_H
+#define STRING_TOKENIZER_UNIT_TESTS_H
+
+/**
+ * Runs all the unit tests for string tokenizer functions.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_string_tokenizer_tests();
+
+/**
+ * Run unit tests for the st_expand_string() growth policies.
+ *
+ * This function appends the same fragments with each growth policy, counts the
+ * expansions of the buffer and checks the content after st_reserve() and
+ * st_shrink_to_fit().
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_expand_string_unit_tests();
+
+/**
+ * Run unit tests for the st_append_*() functions.
+ *
+ * This function builds a small JSON string with every append function and
+ * compares the tokenizer string with the expected one.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_append_unit_tests();
+
+/**
+ * Run unit tests for the st_append_escaped_string() function.
+ *
+ * This function appends a set of predefined strings with characters that need
+ * escaping and compares the tokenizer string with the expected JSON strings.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_append_escaped_string_unit_tests();
+
+/**
+ * Run unit tests for the streaming tokenizers.
+ *
+ * This function walks the same document from a callback, a FILE* and a file
+ * descriptor with chunk sizes that split the tokens, and compares the tokens
+ * found with the in-memory tokenizer.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_stream_unit_tests();
+
+/**
+ * Run unit tests for the memory-mapped tokenizer.
+ *
+ * This function maps a file that fills a whole page and ends with a number, so
+ * reading past the mapping would fault, and compares the tokens found with the
+ * in-memory tokenizer.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_create_from_mmap_unit_tests();
+
+/**
+ * Run unit tests for the recyclable tokenizers.
+ *
+ * This function grows a pooled tokenizer and checks that the next acquire gets
+ * it back empty, then checks that st_detach_string() leaves the tokenizer empty
+ * and the detached string untouched by later appends, and checks st_rebind().
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_pool_unit_tests();
+
+/**
+ * Run unit tests for the inline buffer of the tokenizer.
+ *
+ * This function appends strings of increasing length to an empty tokenizer and
+ * checks that they stay in the inline buffer until they outgrow it.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_inline_buffer_unit_tests();
+
+/**
+ * Run unit tests for the st_extract_int64() function.
+ *
+ * This function extracts integers, limits, decimals and overflows from
+ * in-memory and streaming tokenizers and checks the values and where the
+ * cursor ends.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_extract_int64_unit_tests();
+
+/**
+ * Run unit tests for the st_extract_until_view() function.
+ *
+ * This function extracts the characters before a custom class of delimiters
+ * from in-memory and streaming tokenizers and checks the views and where the
+ * cursor ends.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_extract_until_view_unit_tests();
+
+#endif // STRING_TOKENIZER_UNIT_TESTS_H
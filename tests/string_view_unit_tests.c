@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+/**
+ * {@inheritdoc}
+ */
+int run_sv_compare_unit_tests() {
+  // Define pairs of strings and the expected comparison sign.
+  const char *left_values[] = {"", "abc", "abc", "abd", "ab", "key"};
+  const char *right_values[] = {"", "abc", "abd", "abc", "abc", "key"};
+  int expected_values[] = {0, 0, -1, 1, -1, 0};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(left_values) / sizeof(left_values[0]);
+  // Show friendly message.
+  printf("------------------- sv_compare(a, b) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    struct StringView left = sv_from_string(left_values[i]);
+    struct StringView right = sv_from_string(right_values[i]);
+    int result = sv_compare(&left, &right);
+    int sign = (result > 0) - (result < 0);
+    if (sign != expected_values[i]) {
+      printf("[Failed] sv_compare(\"%s\", \"%s\") failed: expected %d, got %d.\n", left_values[i], right_values[i], expected_values[i], sign);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    if ((sign == 0) != sv_equals(&left, right_values[i])) {
+      printf("[Failed] sv_equals(\"%s\", \"%s\") failed: disagrees with sv_compare.\n", left_values[i], right_values[i]);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    if (sign == 0 && sv_hash(&left) != sv_hash(&right)) {
+      printf("[Failed] sv_hash(\"%s\") failed: equal views have different hashes.\n", left_values[i]);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] sv_compare(\"%s\", \"%s\") is %d.\n", left_values[i], right_values[i], sign);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_sub_string_view_unit_tests() {
+  // Define strings and the expected substring values.
+  const char *string_values[] = {"\"key\": 1", "\"\"", "\"unterminated", "[a,b]", "no-quotes"};
+  const char start_delims[] = {'"', '"', '"', '[', '"'};
+  const char end_delims[] = {'"', '"', '"', ']', '"'};
+  const char *expected_values[] = {"key", "", "unterminated", "a,b", NULL};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(string_values) / sizeof(string_values[0]);
+  // Show friendly message.
+  printf("------------------- st_sub_string_view(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    char string[64];
+    strcpy(string, string_values[i]);
+    struct StringTokenizer *tokenizer = st_create(string);
+    struct StringView view;
+    int found = st_sub_string_view(tokenizer, start_delims[i], end_delims[i], &view);
+    if (found != (expected_values[i] != NULL) || (found == 1 && sv_equals(&view, expected_values[i]) == 0)) {
+      printf("[Failed] st_sub_string_view(\"%s\") failed: expected '%s'.\n", string_values[i], expected_values[i] ? expected_values[i] : "NULL");
+      st_destroy(tokenizer);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // The copying version must return the same characters.
+    tokenizer->position = 0;
+    char *copy = st_sub_string(tokenizer, start_delims[i], end_delims[i]);
+    if (found == 1 && (copy == NULL || strcmp(copy, expected_values[i]) != 0)) {
+      printf("[Failed] st_sub_string(\"%s\") failed: expected '%s', got '%s'.\n", string_values[i], expected_values[i], copy ? copy : "NULL");
+      free(copy);
+      st_destroy(tokenizer);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] st_sub_string_view(\"%s\") is '%s'.\n", string_values[i], expected_values[i] ? expected_values[i] : "NULL");
+    free(copy);
+    st_destroy(tokenizer);
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_extract_numbers_view_unit_tests() {
+  // Define strings and the expected numeric substrings.
+  const char *string_values[] = {"123,", "-4.5e3}", "0", "abc"};
+  const char *expected_values[] = {"123", "-4.5e3", "0", NULL};
+  double double_values[] = {123.0, -4500.0, 0.0, 0.0};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(string_values) / sizeof(string_values[0]);
+  // Show friendly message.
+  printf("------------------- st_extract_numbers_view(x) -------------------\n");
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  for (int i = 0; i < num_tests; i++) {
+    char string[64];
+    strcpy(string, string_values[i]);
+    struct StringTokenizer *tokenizer = st_create(string);
+    struct StringView view;
+    int found = st_extract_numbers_view(tokenizer, &view);
+    if (found != (expected_values[i] != NULL) || (found == 1 && sv_equals(&view, expected_values[i]) == 0)) {
+      printf("[Failed] st_extract_numbers_view(\"%s\") failed: expected '%s'.\n", string_values[i], expected_values[i] ? expected_values[i] : "NULL");
+      st_destroy(tokenizer);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    double value = 0.0;
+    if (found == 1 && (sv_to_double(&view, &value) == 0 || value != double_values[i])) {
+      printf("[Failed] sv_to_double(\"%s\") failed: expected %f, got %f.\n", expected_values[i], double_values[i], value);
+      st_destroy(tokenizer);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // The cursor must stay on the last numeric character.
+    if (found == 1 && tokenizer->position != view.len - 1) {
+      printf("[Failed] st_extract_numbers_view(\"%s\") failed: cursor at %zu.\n", string_values[i], tokenizer->position);
+      st_destroy(tokenizer);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] st_extract_numbers_view(\"%s\") is '%s'.\n", string_values[i], expected_values[i] ? expected_values[i] : "NULL");
+    st_destroy(tokenizer);
+  }
+  // Only views made entirely of an integer that fits are converted.
+  const char *integer_values[] = {"-42", " 42", "42 ", "4.2", "", "9223372036854775808"};
+  int converted = 1;
+  for (int i = 0; i < 6; i++) {
+    struct StringView view = {integer_values[i], strlen(integer_values[i])};
+    int64_t value = 0;
+    converted &= sv_to_int64(&view, &value) == (i == 0) && (i != 0 || value == -42);
+  }
+  if (converted == 0) {
+    printf("[Failed] sv_to_int64() failed to reject the partial integers.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] sv_to_int64() converts only whole integers.\n");
+  }
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_string_view_tests() {
+  // Run sv_compare(a, b) unit tests.
+  if (run_sv_compare_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_sub_string_view(x) unit tests.
+  if (run_st_sub_string_view_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_extract_numbers_view(x) unit tests.
+  if (run_st_extract_numbers_view_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Return success status.
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,47 @@
+#ifndef STRING_VIEW_UNIT_TESTS_H
+#define STRING_VIEW_UNIT_TESTS_H
+
+/**
+ * Runs all the unit tests for string view functions.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_string_view_tests();
+
+/**
+ * Run unit tests for the sv_compare(), sv_equals() and sv_hash() functions.
+ *
+ * This function compares views built from a set of predefined strings and checks
+ * that equal views compare and hash the same way.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_sv_compare_unit_tests();
+
+/**
+ * Run unit tests for the st_sub_string_view() function.
+ *
+ * This function extracts views from a set of predefined strings and compares them
+ * with the expected substrings, it also checks that the copying st_sub_string()
+ * function returns the same characters.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_sub_string_view_unit_tests();
+
+/**
+ * Run unit tests for the st_extract_numbers_view() function.
+ *
+ * This function extracts numeric views from a set of predefined strings and compares
+ * them with the expected numbers and converted values, then checks that
+ * sv_to_int64() only converts views made entirely of an integer.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_extract_numbers_view_unit_tests();
+
+#endif // STRING_VIEW_UNIT_TESTS_H
@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strutils.h"
+
+#define STRUCTURAL_TEST_BUFFER_SIZE 1024
+
+/**
+ * Builds the test document, the strings cross the 64 character blocks.
+ *
+ * @param char *buffer
+ *   The buffer of STRUCTURAL_TEST_BUFFER_SIZE bytes that receives the document.
+ *
+ * @return size_t
+ *   The length of the document.
+ */
+static size_t structural_test_document(char *buffer) {
+  size_t length = 0;
+  length += sprintf(buffer + length, "{\"items\": [1, -2.5e3, true, null, \"a,b:{c}\"],\n  \"long\": \"");
+  // A backslash as the last character of a block escapes the next block.
+  while ((length + 1) % 64 != 0) {
+    buffer[length++] = 'x';
+  }
+  length += sprintf(buffer + length, "\\\"still in the string\\\\\", \"next\" :false ,\t\"deep\": [[{}], []");
+  // A long string full of structural characters.
+  length += sprintf(buffer + length, ", \"noise\": \"");
+  for (int i = 0; i < 40; i++) {
+    length += sprintf(buffer + length, "[{:,}] ");
+  }
+  length += sprintf(buffer + length, "\", \"end\": 12345}   ");
+  return length;
+}
+
+/**
+ * Computes the token start positions character by character.
+ *
+ * @param const char *string
+ *   The document.
+ * @param const size_t length
+ *   The length of the document.
+ * @param size_t *positions
+ *   The buffer that receives the positions.
+ *
+ * @return size_t
+ *   The number of positions.
+ */
+static size_t structural_test_reference(const char *string, const size_t length, size_t *positions) {
+  size_t count = 0;
+  int in_string = 0;
+  int escaped = 0;
+  int in_scalar = 0;
+  for (size_t i = 0; i < length; i++) {
+    char token = string[i];
+    if (in_string) {
+      if (escaped) {
+        escaped = 0;
+      }
+      else if (token == '\\') {
+        escaped = 1;
+      }
+      else if (token == '"') {
+        positions[count++] = i;
+        in_string = 0;
+      }
+      continue;
+    }
+    if (token == '"' || strchr("{}[]:,", token) != NULL) {
+      positions[count++] = i;
+      in_string = token == '"';
+      in_scalar = 0;
+    }
+    else if ((unsigned char)token <= ' ') {
+      in_scalar = 0;
+    }
+    else if (in_scalar == 0) {
+      positions[count++] = i;
+      in_scalar = 1;
+    }
+  }
+  return count;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_build_structural_index_unit_tests() {
+  // Define the instruction sets to test.
+  enum StringScanIsa isa_values[] = {ST_SCAN_SCALAR, ST_SCAN_SSE2, ST_SCAN_AVX2, ST_SCAN_AVX512};
+  const char *isa_names[] = {"scalar", "SSE2", "AVX2", "AVX-512"};
+  // Calculate the number of values to test.
+  int num_tests = sizeof(isa_values) / sizeof(isa_values[0]);
+  // Show friendly message.
+  printf("------------------- st_build_structural_index(x) -------------------\n");
+  // Build the document and the expected positions.
+  char string[STRUCTURAL_TEST_BUFFER_SIZE];
+  size_t length = structural_test_document(string);
+  size_t expected[STRUCTURAL_TEST_BUFFER_SIZE];
+  size_t count = structural_test_reference(string, length, expected);
+  // Test the values.
+  int exit_status = EXIT_SUCCESS;
+  enum StringScanIsa original_isa = st_scan_isa();
+  for (int i = 0; i < num_tests; i++) {
+    if (st_scan_set_isa(isa_values[i]) == 0) {
+      printf("[Skipped] %s index is not supported by this CPU.\n", isa_names[i]);
+      continue;
+    }
+    // Index every prefix, so the last block is padded in every possible way.
+    int valid = 1;
+    for (size_t prefix = length - 64; prefix <= length && valid; prefix++) {
+      struct StringTokenizer *tokenizer = st_create_n(string, prefix);
+      size_t prefix_count = structural_test_reference(string, prefix, expected);
+      if (st_build_structural_index(tokenizer) == 0) {
+        valid = 0;
+      }
+      else {
+        struct StringStructuralIndex *index = tokenizer->structural_index;
+        valid = index->count == prefix_count && memcmp(index->positions, expected, prefix_count * sizeof(size_t)) == 0;
+      }
+      st_destroy(tokenizer);
+    }
+    if (valid == 0) {
+      printf("[Failed] %s index failed: wrong positions.\n", isa_names[i]);
+      exit_status = EXIT_FAILURE;
+      continue;
+    }
+    // Print success message.
+    printf("[Passed] %s index found %zu token starts.\n", isa_names[i], count);
+  }
+  st_scan_set_isa(original_isa);
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_st_next_structural_unit_tests() {
+  // Show friendly message.
+  printf("------------------- st_next_structural(x) -------------------\n");
+  char string[STRUCTURAL_TEST_BUFFER_SIZE];
+  size_t length = structural_test_document(string);
+  size_t expected[STRUCTURAL_TEST_BUFFER_SIZE];
+  size_t count = structural_test_reference(string, length, expected);
+  struct StringTokenizer *plain = st_create_n(string, length);
+  struct StringTokenizer *indexed = st_create_n(string, length);
+  int exit_status = EXIT_SUCCESS;
+  if (st_build_structural_index(indexed) == 0) {
+    printf("[Failed] st_build_structural_index() failed.\n");
+    exit_status = EXIT_FAILURE;
+  }
+  // The index must not change where st_next_token() lands.
+  for (size_t position = 0; position < length && exit_status == EXIT_SUCCESS; position++) {
+    plain->position = position;
+    indexed->position = position;
+    st_next_token(plain);
+    st_next_token(indexed);
+    if (plain->position != indexed->position) {
+      printf("[Failed] st_next_token() failed: from %zu expected %zu, got %zu.\n", position, plain->position, indexed->position);
+      exit_status = EXIT_FAILURE;
+    }
+  }
+  if (exit_status == EXIT_SUCCESS) {
+    printf("[Passed] st_next_token() lands on the same positions with the index.\n");
+  }
+  // Walk the token starts.
+  size_t visited = 0;
+  indexed->position = 0;
+  while (indexed->position < length && visited < count && indexed->position == expected[visited]) {
+    visited++;
+    st_next_structural(indexed);
+  }
+  if (visited != count || indexed->position != length) {
+    printf("[Failed] st_next_structural() failed: visited %zu of %zu token starts.\n", visited, count);
+    exit_status = EXIT_FAILURE;
+  }
+  else {
+    printf("[Passed] st_next_structural() visited %zu token starts.\n", visited);
+  }
+  st_destroy(plain);
+  st_destroy(indexed);
+  printf("\n");
+  // Return exist status
+  return exit_status;
+}
+
+/**
+ * {@inheritdoc}
+ */
+int run_structural_index_tests() {
+  // Run st_build_structural_index(x) unit tests.
+  if (run_st_build_structural_index_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Run st_next_structural(x) unit tests.
+  if (run_st_next_structural_unit_tests() == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  // Return success status.
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,36 @@
+#ifndef STRUCTURAL_INDEX_UNIT_TESTS_H
+#define STRUCTURAL_INDEX_UNIT_TESTS_H
+
+/**
+ * Runs all the unit tests for structural index functions.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_structural_index_tests();
+
+/**
+ * Run unit tests for the st_build_structural_index() function.
+ *
+ * This function indexes a document with long strings, escaped quotes and escape
+ * sequences across block boundaries with every instruction set, and compares
+ * the positions with a character by character reference.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_build_structural_index_unit_tests();
+
+/**
+ * Run unit tests for the cursor functions of an indexed tokenizer.
+ *
+ * This function checks that st_next_token() lands on the same positions with
+ * and without the index, from every position of the document, and that
+ * st_next_structural() visits every token start.
+ *
+ * @return int
+ *   Returns EXIT_SUCCESS if all tests pass, otherwise returns EXIT_FAILURE.
+ */
+int run_st_next_structural_unit_tests();
+
+#endif // STRUCTURAL_INDEX_UNIT_TESTS_H